@@ -0,0 +1,59 @@
+;
+; File generated by cc65 v 2.19 - Git 83224ba
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 83224ba"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.export		_fdopen
+	.import		__seterrno
+	.import		__fdesc
+
+; ---------------------------------------------------------------
+; struct _FILE *__near__ __fastcall__ fdopen (int handle, const char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fdopen: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	jsr     __fdesc
+	sta     regbank+4
+	stx     regbank+4+1
+	ora     regbank+4+1
+	beq     L0002
+	ldy     #$04
+	lda     (sp),y
+	ldy     #$00
+	sta     (regbank+4),y
+	lda     #$01
+	iny
+	sta     (regbank+4),y
+	jmp     L0003
+L0002:	lda     #$05
+	jsr     __seterrno
+L0003:	lda     regbank+4
+	ldx     regbank+4+1
+	pha
+	ldy     #$00
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	pla
+	jmp     incsp6
+
+.endproc
+
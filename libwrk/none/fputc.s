@@ -0,0 +1,75 @@
+;
+; File generated by cc65 v 2.19 - Git 83224ba
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 83224ba"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.export		_fputc
+	.import		_write
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ fputc (int c, register struct _FILE *f)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fputc: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$00
+	ldx     #$04
+	jsr     regswap2
+	ldy     #$01
+	lda     (regbank+4),y
+	and     #$01
+	beq     L0007
+	lda     (regbank+4),y
+	and     #$06
+	bne     L0007
+	tax
+	lda     (regbank+4,x)
+	jsr     pusha0
+	lda     #$04
+	jsr     leaa0sp
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     _write
+	cpx     #$00
+	bne     L000B
+	cmp     #$01
+	beq     L0008
+L000B:	ldy     #$01
+	lda     (regbank+4),y
+	ora     #$04
+	sta     (regbank+4),y
+L0007:	ldx     #$FF
+	txa
+	jmp     L0001
+L0008:	ldy     #$02
+	lda     (sp),y
+L0001:	pha
+	ldy     #$00
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	pla
+	jmp     incsp4
+
+.segment	"RODATA"
+
+M0001:
+	.word	$0000
+
+.endproc
+
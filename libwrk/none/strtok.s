@@ -0,0 +1,127 @@
+;
+; File generated by cc65 v 2.19 - Git 83224ba
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 83224ba"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.import		_strchr
+	.export		_strtok
+
+.segment	"DATA"
+
+_Last:
+	.word	$0000
+
+; ---------------------------------------------------------------
+; char *__near__ __fastcall__ strtok (register char *s1, const char *s2)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_strtok: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$02
+	ldx     #$04
+	jsr     regswap2
+	jsr     decsp3
+	lda     regbank+4
+	ora     regbank+4+1
+	bne     L0002
+	lda     _Last+1
+	sta     regbank+4+1
+	lda     _Last
+	sta     regbank+4
+L0002:	ldy     #$00
+	lda     (regbank+4),y
+	bne     L001B
+	tax
+	jmp     L0001
+L0005:	inc     regbank+4
+	bne     L000C
+	inc     regbank+4+1
+L000C:	ldy     #$00
+L001B:	lda     (regbank+4),y
+	ldy     #$02
+	sta     (sp),y
+	tax
+	beq     L0021
+	ldy     #$06
+	jsr     pushwysp
+	ldy     #$04
+	ldx     #$00
+	lda     (sp),y
+	jsr     _strchr
+	cpx     #$00
+	bne     L0005
+	cmp     #$00
+	bne     L0005
+	ldy     #$02
+L0021:	lda     (sp),y
+	bne     L000D
+	lda     regbank+4+1
+	sta     _Last+1
+	lda     regbank+4
+	sta     _Last
+	txa
+	jmp     L0001
+L000D:	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     stax0sp
+	jmp     L0010
+L000E:	inc     regbank+4
+	bne     L0010
+	inc     regbank+4+1
+L0010:	ldy     #$00
+	lda     (regbank+4),y
+	ldy     #$02
+	sta     (sp),y
+	tax
+	beq     L0022
+	ldy     #$06
+	jsr     pushwysp
+	ldy     #$04
+	ldx     #$00
+	lda     (sp),y
+	jsr     _strchr
+	cpx     #$00
+	bne     L0019
+	cmp     #$00
+	beq     L000E
+L0019:	ldy     #$02
+L0022:	lda     (sp),y
+	bne     L0016
+	lda     regbank+4+1
+	sta     _Last+1
+	lda     regbank+4
+	sta     _Last
+	jmp     L0017
+L0016:	lda     #$00
+	tay
+	sta     (regbank+4),y
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     incax1
+	sta     _Last
+	stx     _Last+1
+L0017:	jsr     ldax0sp
+L0001:	pha
+	ldy     #$05
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	pla
+	jmp     incsp7
+
+.endproc
+
@@ -0,0 +1,96 @@
+;
+; File generated by cc65 v 2.19 - Git 83224ba
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 83224ba"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.export		_gmtime
+	.import		_mktime
+
+; ---------------------------------------------------------------
+; struct tm *__near__ __fastcall__ gmtime (const unsigned long *timep)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_gmtime: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp4
+	ldy     #$04
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L0006
+	jsr     ldaxysp
+	jsr     ldeaxi
+	jsr     steax0sp
+	lda     sreg+1
+	asl     a
+	bcc     L0002
+L0006:	ldx     #$00
+	txa
+	jmp     L0001
+L0002:	jsr     ldeax0sp
+	jsr     pusheax
+	ldx     #$0E
+	lda     #$10
+	jsr     tosumod0ax
+	sta     M0001
+	stx     M0001+1
+	lda     #$00
+	sta     M0001+2
+	sta     M0001+2+1
+	jsr     ldeax0sp
+	jsr     pusheax
+	ldx     #$0E
+	lda     #$10
+	jsr     tosudiv0ax
+	jsr     pusheax
+	ldx     #$00
+	lda     #$18
+	jsr     tosumod0ax
+	sta     M0001+4
+	stx     M0001+4+1
+	jsr     ldeax0sp
+	jsr     pusheax
+	ldx     #$51
+	lda     #$01
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$80
+	jsr     tosudiveax
+	ldy     #$01
+	jsr     inceaxy
+	sta     M0001+6
+	stx     M0001+6+1
+	ldx     #$00
+	txa
+	sta     M0001+8
+	sta     M0001+8+1
+	lda     #$46
+	sta     M0001+10
+	stx     M0001+10+1
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     _mktime
+	lda     #<(M0001)
+	ldx     #>(M0001)
+L0001:	jmp     incsp6
+
+.segment	"BSS"
+
+M0001:
+	.res	18,$00
+
+.endproc
+
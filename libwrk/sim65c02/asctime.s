@@ -0,0 +1,58 @@
+;
+; File generated by cc65 v 2.19 - Git 83224ba
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 83224ba"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.export		_asctime
+	.import		_strftime
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$25,$63,$0A,$00
+
+; ---------------------------------------------------------------
+; char *__near__ __fastcall__ asctime (const struct tm *timep)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_asctime: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$1A
+	jsr     pusha0
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _strftime
+	stx     tmp1
+	ora     tmp1
+	beq     L0002
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	bra     L0001
+L0002:	tax
+L0001:	jmp     incsp2
+
+.segment	"BSS"
+
+M0001:
+	.res	26,$00
+
+.endproc
+
@@ -0,0 +1,92 @@
+;
+; File generated by cc65 v 2.19 - Git 83224ba
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 83224ba"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.import		_stdin
+	.import		_fgetc
+	.export		_gets
+
+; ---------------------------------------------------------------
+; char *__near__ __fastcall__ gets (char *s)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_gets: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	sta     regbank+4
+	stx     regbank+4+1
+	jsr     decsp2
+	jsr     push0
+L0002:	lda     _stdin
+	ldx     _stdin+1
+	jsr     _fgetc
+	ldy     #$02
+	jsr     staxysp
+	cpx     #$FF
+	bne     L000A
+	cmp     #$FF
+	bne     L000A
+	ina
+	sta     (regbank+4)
+	lda     _stdin+1
+	sta     ptr1+1
+	lda     _stdin
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	inx
+	and     #$04
+	beq     L000F
+	txa
+	bra     L0001
+L000F:	lda     (sp),y
+	ora     (sp)
+	beq     L0001
+	bra     L0003
+L000A:	ldy     #$02
+	lda     (sp),y
+	cmp     #$0A
+	bne     L000B
+	lda     #$00
+	sta     (regbank+4)
+	bra     L0003
+L000B:	lda     (sp),y
+	sta     (regbank+4)
+	inc     regbank+4
+	bne     L000D
+	inc     regbank+4+1
+L000D:	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	bra     L0002
+L0003:	ldy     #$07
+	jsr     ldaxysp
+L0001:	pha
+	ldy     #$04
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	pla
+	jmp     incsp8
+
+.endproc
+
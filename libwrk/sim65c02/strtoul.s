@@ -0,0 +1,284 @@
+;
+; File generated by cc65 v 2.19 - Git 83224ba
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 83224ba"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.import		_isdigit
+	.import		_islower
+	.import		_isspace
+	.import		_isupper
+	.import		__seterrno
+	.export		_strtoul
+
+; ---------------------------------------------------------------
+; unsigned long __near__ __fastcall__ strtoul (const char *nptr, char **endptr, int base)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_strtoul: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	sta     regbank+4
+	stx     regbank+4+1
+	jsr     pushl0
+	jsr     pusha
+	jsr     pusha
+	jsr     push0
+	jsr     decsp6
+	bra     L0004
+L0002:	inc     regbank+4
+	bne     L0004
+	inc     regbank+4+1
+L0004:	ldx     #$00
+	lda     (regbank+4)
+	jsr     _isspace
+	stx     tmp1
+	ora     tmp1
+	bne     L0002
+	lda     (regbank+4)
+	cmp     #$2B
+	beq     L0009
+	cmp     #$2D
+	bne     L0007
+	lda     #$01
+	ldy     #$09
+	sta     (sp),y
+L0009:	inc     regbank+4
+	bne     L0007
+	inc     regbank+4+1
+L0007:	ldy     #$10
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	bne     L003E
+	tax
+	lda     (regbank+4)
+	cmp     #$30
+	bne     L003D
+	inc     regbank+4
+	bne     L000E
+	inc     regbank+4+1
+L000E:	lda     (regbank+4)
+	cmp     #$78
+	beq     L003B
+	cmp     #$58
+	bne     L003C
+L003B:	inc     regbank+4
+	bne     L0012
+	inc     regbank+4+1
+L0012:	lda     #$10
+	bra     L004E
+L003C:	lda     #$08
+	dey
+	jsr     staxysp
+	bra     L0016
+L003D:	lda     #$0A
+L004E:	dey
+	jsr     staxysp
+	bra     L0016
+L003E:	lda     (sp),y
+	bne     L0016
+	dey
+	lda     (sp),y
+	cmp     #$10
+	bne     L0016
+	lda     (regbank+4)
+	cmp     #$30
+	bne     L0016
+	ldy     #$01
+	lda     (regbank+4),y
+	cmp     #$78
+	beq     L0043
+	cmp     #$58
+	bne     L0016
+L0043:	lda     #$02
+	clc
+	adc     regbank+4
+	sta     regbank+4
+	bcc     L0016
+	inc     regbank+4+1
+L0016:	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	txa
+	jsr     pusheax
+	ldy     #$15
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosumodeax
+	sta     (sp)
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	txa
+	jsr     pusheax
+	ldy     #$15
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosudiveax
+	ldy     #$01
+	jsr     steaxysp
+L001E:	ldx     #$00
+	lda     (regbank+4)
+	jsr     _isdigit
+	stx     tmp1
+	ora     tmp1
+	beq     L0021
+	ldx     #$00
+	lda     (regbank+4)
+	ldy     #$30
+	bra     L0053
+L0021:	tax
+	lda     (regbank+4)
+	jsr     _isupper
+	stx     tmp1
+	ora     tmp1
+	beq     L0023
+	ldx     #$00
+	lda     (regbank+4)
+	ldy     #$37
+	bra     L0053
+L0023:	tax
+	lda     (regbank+4)
+	jsr     _islower
+	stx     tmp1
+	ora     tmp1
+	jeq     L001F
+	ldx     #$00
+	lda     (regbank+4)
+	ldy     #$57
+L0053:	jsr     decaxy
+	ldy     #$05
+	sta     (sp),y
+	ldy     #$10
+	cmp     (sp),y
+	lda     #$00
+	iny
+	sbc     (sp),y
+	bvs     L0037
+	eor     #$80
+L0037:	bmi     L001F
+	ldy     #$0D
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$08
+	jsr     ldeaxysp
+	jsr     tosugteax
+	bne     L0029
+	ldy     #$0D
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$08
+	jsr     ldeaxysp
+	jsr     toseqeax
+	beq     L0028
+	ldy     #$05
+	lda     (sp),y
+	cmp     (sp)
+	beq     L0028
+	bcc     L0028
+L0029:	lda     #$01
+	ldy     #$08
+	sta     (sp),y
+L0028:	ldy     #$08
+	lda     (sp),y
+	bne     L002E
+	ldy     #$0D
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$15
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosumuleax
+	jsr     pusheax
+	ldy     #$09
+	ldx     #$00
+	lda     (sp),y
+	jsr     axulong
+	jsr     tosaddeax
+	ldy     #$0A
+	jsr     steaxysp
+	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L002E:	inc     regbank+4
+	jne     L001E
+	inc     regbank+4+1
+	jmp     L001E
+L001F:	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0033
+	ldy     #$06
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L0031
+	ldy     #$13
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	lda     regbank+4
+	sta     (sreg)
+	ldy     #$01
+	lda     regbank+4+1
+	bra     L0050
+L0031:	ldy     #$13
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$15
+	jsr     ldaxysp
+	sta     (sreg)
+	ldy     #$01
+	txa
+L0050:	sta     (sreg),y
+L0033:	ldy     #$08
+	lda     (sp),y
+	beq     L0034
+	lda     #$0F
+	jsr     __seterrno
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	txa
+	bra     L0036
+L0034:	iny
+	lda     (sp),y
+	beq     L0035
+	ldy     #$0D
+	jsr     ldeaxysp
+	jsr     negeax
+	bra     L0036
+L0035:	ldy     #$0D
+	jsr     ldeaxysp
+L0036:	pha
+	ldy     #$0E
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	pla
+	ldy     #$16
+	jmp     addysp
+
+.endproc
+
@@ -35,6 +35,7 @@
 
 /* common */
 #include "coll.h"
+#include "objwrite.h"
 #include "xmalloc.h"
 
 /* ca65 */
@@ -42,7 +43,6 @@
 #include "error.h"
 #include "expr.h"
 #include "lineinfo.h"
-#include "objfile.h"
 #include "spool.h"
 
 
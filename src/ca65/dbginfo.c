@@ -40,6 +40,7 @@
 #include "coll.h"
 #include "filepos.h"
 #include "hlldbgsym.h"
+#include "objwrite.h"
 #include "scopedefs.h"
 #include "strbuf.h"
 
@@ -50,7 +51,6 @@
 #include "filetab.h"
 #include "global.h"
 #include "lineinfo.h"
-#include "objfile.h"
 #include "nexttok.h"
 #include "symentry.h"
 #include "symtab.h"
@@ -56,6 +56,8 @@ struct EffAddr {
     unsigned            AddrMode;       /* Actual addressing mode used */
     unsigned long       AddrModeBit;    /* Addressing mode as bit mask */
     unsigned char       Opcode;         /* Opcode */
+    unsigned char       ShortOpcode;    /* Relaxed opcode, zero if none */
+    unsigned char       RelaxKind;      /* RELAX_xxx if ShortOpcode is set */
 };
 
 
@@ -40,6 +40,7 @@
 #include "check.h"
 #include "cpu.h"
 #include "exprdefs.h"
+#include "objwrite.h"
 #include "print.h"
 #include "shift.h"
 #include "segdefs.h"
@@ -54,7 +55,6 @@
 #include "global.h"
 #include "instr.h"
 #include "nexttok.h"
-#include "objfile.h"
 #include "segment.h"
 #include "sizeof.h"
 #include "studyexpr.h"
@@ -1062,6 +1062,14 @@ static ExprNode* Factor (void)
         case TOK_STAR:
         case TOK_PC:
             NextTok ();
+            /* Remember the reference, relaxable instructions must not change
+            ** the distance to an address calculated from the PC. Labels and
+            ** branches don't need this, since they refer to the part of a
+            ** split segment they're in, and the linker moves the parts.
+            */
+            if (GetRelocMode ()) {
+                ActiveSeg->PCRef = 1;
+            }
             N = GenCurrentPC ();
             break;
 
@@ -1633,12 +1641,12 @@ long ConstExpression (void)
     ExprNode* Expr = Expression ();
 
     /* Study the expression */
-    ExprDesc D;
-    ED_Init (&D);
+    ObjExprDesc D;
+    OED_Init (&D);
     StudyExpr (Expr, &D);
 
     /* Check if the expression is constant */
-    if (ED_IsConst (&D)) {
+    if (OED_IsConst (&D)) {
         Val = D.Val;
     } else {
         Error ("Constant expression expected");
@@ -1647,7 +1655,7 @@ long ConstExpression (void)
 
     /* Free the expression tree and allocated memory for D */
     FreeExpr (Expr);
-    ED_Done (&D);
+    OED_Done (&D);
 
     /* Return the value */
     return Val;
@@ -1667,10 +1675,10 @@ void FreeExpr (ExprNode* Root)
 
 
 
-ExprNode* SimplifyExpr (ExprNode* Expr, const ExprDesc* D)
+ExprNode* SimplifyExpr (ExprNode* Expr, const ObjExprDesc* D)
 /* Try to simplify the given expression tree */
 {
-    if (Expr->Op != EXPR_LITERAL && ED_IsConst (D)) {
+    if (Expr->Op != EXPR_LITERAL && OED_IsConst (D)) {
         /* No external references */
         FreeExpr (Expr);
         Expr = GenLiteralExpr (D->Val);
@@ -1948,18 +1956,18 @@ int IsConstExpr (ExprNode* Expr, long* Val)
     int IsConst;
 
     /* Study the expression */
-    ExprDesc D;
-    ED_Init (&D);
+    ObjExprDesc D;
+    OED_Init (&D);
     StudyExpr (Expr, &D);
 
     /* Check if the expression is constant */
-    IsConst = ED_IsConst (&D);
+    IsConst = OED_IsConst (&D);
     if (IsConst && Val != 0) {
         *Val = D.Val;
     }
 
     /* Delete allocated memory and return the result */
-    ED_Done (&D);
+    OED_Done (&D);
     return IsConst;
 }
 
@@ -50,7 +50,7 @@
 
 
 
-struct ExprDesc;
+struct ObjExprDesc;
 
 
 
@@ -74,7 +74,7 @@ long ConstExpression (void);
 void FreeExpr (ExprNode* Root);
 /* Free the expression tree, Root is pointing to. */
 
-ExprNode* SimplifyExpr (ExprNode* Expr, const struct ExprDesc* D);
+ExprNode* SimplifyExpr (ExprNode* Expr, const struct ObjExprDesc* D);
 /* Try to simplify the given expression tree */
 
 ExprNode* GenLiteralExpr (long Val);
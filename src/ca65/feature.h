@@ -68,6 +68,7 @@ typedef enum {
     FEAT_ADDRSIZE,
     FEAT_BRACKET_AS_INDIRECT,
     FEAT_STRING_ESCAPES,
+    FEAT_LINK_RELAX,
 
     /* Special value: Number of features available */
     FEAT_COUNT
@@ -41,13 +41,13 @@
 #include "check.h"
 #include "coll.h"
 #include "hashtab.h"
+#include "objwrite.h"
 #include "xmalloc.h"
 
 /* ca65 */
 #include "error.h"
 #include "filetab.h"
 #include "global.h"
-#include "objfile.h"
 #include "spool.h"
 
 
@@ -235,6 +235,28 @@ unsigned AddFile (const StrBuf* Name, FileType Type,
 
 
 
+unsigned GetFileCount (void)
+/* Return the number of entries in the file table */
+{
+    return CollCount (&FileTab);
+}
+
+
+
+const StrBuf* GetFileInfo (unsigned Index, unsigned long* Size,
+                           unsigned long* MTime)
+/* Return the name of the file with the given index (1 based) and put size
+** and modification time into the variables passed as arguments.
+*/
+{
+    const FileEntry* F = CollConstAt (&FileTab, Index-1);
+    *Size  = F->Size;
+    *MTime = F->MTime;
+    return GetStrBuf (F->Name);
+}
+
+
+
 void WriteFiles (void)
 /* Write the list of input files to the object file */
 {
@@ -79,6 +79,15 @@ unsigned AddFile (const StrBuf* Name, FileType Type,
 ** the table.
 */
 
+unsigned GetFileCount (void);
+/* Return the number of entries in the file table */
+
+const StrBuf* GetFileInfo (unsigned Index, unsigned long* Size,
+                           unsigned long* MTime);
+/* Return the name of the file with the given index (1 based) and put size
+** and modification time into the variables passed as arguments.
+*/
+
 void WriteFiles (void);
 /* Write the list of input files to the object file */
 
@@ -41,19 +41,39 @@
 
 
 
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Number of fragments allocated at once */
+#define FRAG_BLOCK_SIZE         256U
+
+
+
 /*****************************************************************************/
 /*                                   Code                                    */
 /*****************************************************************************/
 
 
 
-Fragment* NewFragment (unsigned char Type, unsigned short Len)
-/* Create, initialize and return a new fragment. The fragment will be inserted
-** into the current segment.
+Fragment* NewFragment (FragArena* A, unsigned char Type, unsigned short Len)
+/* Create, initialize and return a new fragment allocated from the given
+** arena. The fragment will be inserted into the current segment.
 */
 {
-    /* Create a new fragment */
-    Fragment* F = xmalloc (sizeof (*F));
+    Fragment* F;
+
+    /* Get a new block if the current one is used up */
+    if (A->Avail == 0) {
+        A->Block = xmalloc (FRAG_BLOCK_SIZE * sizeof (Fragment));
+        A->Avail = FRAG_BLOCK_SIZE;
+    }
+
+    /* Take the next fragment from the block */
+    F = A->Block++;
+    --A->Avail;
 
     /* Initialize it */
     F->Next     = 0;
@@ -63,9 +63,24 @@ struct Fragment {
     union {
         unsigned char   Data[sizeof (ExprNode*)];       /* Literal values */
         ExprNode*       Expr;                           /* Expression */
+        struct {
+            ExprNode*       Expr;                       /* Operand */
+            unsigned char   Kind;                       /* RELAX_xxx */
+            unsigned char   OPC;                        /* Opcode as emitted */
+            unsigned char   ShortOPC;                   /* Opcode if relaxed */
+        } Relax;                                        /* FRAG_RELAX */
     } V;
 };
 
+/* Fragments are allocated in blocks from an arena and are never freed one
+** by one.
+*/
+typedef struct FragArena FragArena;
+struct FragArena {
+    Fragment*           Block;      /* Current block of fragments */
+    unsigned            Avail;      /* Unused fragments in current block */
+};
+
 
 
 /*****************************************************************************/
@@ -74,9 +89,9 @@ struct Fragment {
 
 
 
-Fragment* NewFragment (unsigned char Type, unsigned short Len);
-/* Create, initialize and return a new fragment. The fragment will be inserted
-** into the current segment.
+Fragment* NewFragment (FragArena* A, unsigned char Type, unsigned short Len);
+/* Create, initialize and return a new fragment allocated from the given
+** arena. The fragment will be inserted into the current segment.
 */
 
 
@@ -67,6 +67,7 @@ unsigned char LineCont           = 0;   /* Allow line continuation */
 unsigned char LargeAlignment     = 0;   /* Don't warn about large alignments */
 unsigned char RelaxChecks        = 0;   /* Relax a few assembler checks */
 unsigned char StringEscapes      = 0;   /* Allow C-style escapes in strings */
+unsigned char Precompile         = 0;   /* Create a precompiled include */
 
 /* Emulation features */
 unsigned char DollarIsPC         = 0;   /* Allow the $ symbol as current PC */
@@ -85,3 +86,4 @@ unsigned char ForceRange         = 0;   /* Force values into expected range */
 unsigned char UnderlineInNumbers = 0;   /* Allow underlines in numbers */
 unsigned char AddrSize           = 0;   /* Allow .ADDRSIZE function */
 unsigned char BracketAsIndirect  = 0;   /* Use '[]' not '()' for indirection */
+unsigned char LinkRelax          = 0;   /* Let the linker shorten instructions */
@@ -69,6 +69,7 @@ extern unsigned char    LineCont;           /* Allow line continuation */
 extern unsigned char    LargeAlignment;     /* Don't warn about large alignments */
 extern unsigned char    RelaxChecks;        /* Relax a few assembler checks */
 extern unsigned char    StringEscapes;      /* Allow C-style escapes in strings */
+extern unsigned char    Precompile;         /* Create a precompiled include */
 
 /* Emulation features */
 extern unsigned char    DollarIsPC;         /* Allow the $ symbol as current PC */
@@ -87,6 +88,7 @@ extern unsigned char    ForceRange;         /* Force values into expected range
 extern unsigned char    UnderlineInNumbers; /* Allow underlines in numbers */
 extern unsigned char    AddrSize;           /* Allow .ADDRSIZE function */
 extern unsigned char    BracketAsIndirect;  /* Use '[]' not '()' for indirection */
+extern unsigned char    LinkRelax;          /* Let the linker shorten instructions */
 
 
 
@@ -55,6 +55,7 @@
 #include "instr.h"
 #include "nexttok.h"
 #include "objcode.h"
+#include "segment.h"
 #include "spool.h"
 #include "studyexpr.h"
 #include "symtab.h"
@@ -1165,11 +1166,70 @@ static unsigned char Sweet16ExtBytes[AMSW16I_COUNT] = {
 
 
 
+static void CheckRelax (const InsDesc* Ins, EffAddr* A, unsigned long AddrModeSet)
+/* Check if the linker may replace the instruction by a shorter one, once the
+** final value of the operand is known. AddrModeSet contains the addressing
+** modes that were possible before the size of the operand was considered.
+*/
+{
+    static const StrBuf BRA = LIT_STRBUF_INITIALIZER ("BRA");
+    int I;
+
+    /* Assume we cannot relax the instruction */
+    A->ShortOpcode = 0;
+
+    /* Only relocatable two byte operands are candidates */
+    if (!LinkRelax || A->Expr == 0 || !GetRelocMode ()  ||
+        ExtBytes[A->AddrMode] != 2 || IsEasyConst (A->Expr, 0)) {
+        return;
+    }
+
+    /* An imported symbol may turn out to be a zero page symbol. The zero
+    ** page variant of an absolute addressing mode has the next lower mode
+    ** number. CPUs with a movable zero page are not supported.
+    */
+    if ((A->AddrModeBit & (AM65_ABS | AM65_ABS_X | AM65_ABS_Y)) != 0 &&
+        (AddrModeSet & (A->AddrModeBit >> 1)) != 0                   &&
+        A->Expr->Op == EXPR_SYMBOL                                   &&
+        SymIsImport (A->Expr->V.Sym)) {
+
+        switch (CPU) {
+            case CPU_6502:
+            case CPU_6502X:
+            case CPU_6502DTV:
+            case CPU_65SC02:
+            case CPU_65C02:
+                A->ShortOpcode = Ins->BaseCode | EATab[Ins->ExtCode][A->AddrMode-1];
+                A->RelaxKind   = RELAX_ZP;
+                break;
+
+            default:
+                break;
+        }
+        return;
+    }
+
+    /* An absolute jump may be replaced by a branch, if the CPU has one */
+    if (A->AddrModeBit == AM65_ABS && CPU != CPU_65816 &&
+        strcmp (Ins->Mnemonic, "JMP") == 0) {
+
+        I = FindInstruction (&BRA);
+        if (I >= 0 && InsTab->Ins[I].AddrMode == AM65_REL) {
+            A->ShortOpcode = InsTab->Ins[I].BaseCode;
+            A->RelaxKind   = RELAX_BRANCH;
+        }
+    }
+}
+
+
+
 static int EvalEA (const InsDesc* Ins, EffAddr* A)
 /* Evaluate the effective address. All fields in A will be valid after calling
 ** this function. The function returns true on success and false on errors.
 */
 {
+    unsigned long AddrModeSet;
+
     /* Get the set of possible addressing modes */
     GetEA (A);
 
@@ -1177,14 +1237,15 @@ static int EvalEA (const InsDesc* Ins, EffAddr* A)
     ** for this instruction or CPU.
     */
     A->AddrModeSet &= Ins->AddrMode;
+    AddrModeSet = A->AddrModeSet;
 
     /* If we have an expression, check it and remove any addressing modes that
     ** are too small for the expression size. Because we have to study the
     ** expression anyway, do also replace it by a simpler one if possible.
     */
     if (A->Expr) {
-        ExprDesc ED;
-        ED_Init (&ED);
+        ObjExprDesc ED;
+        OED_Init (&ED);
 
         /* Study the expression */
         StudyExpr (A->Expr, &ED);
@@ -1232,7 +1293,7 @@ static int EvalEA (const InsDesc* Ins, EffAddr* A)
         }
 
         /* Free any resource associated with the expression desc */
-        ED_Done (&ED);
+        OED_Done (&ED);
     }
 
     /* Check if we have any adressing modes left */
@@ -1267,6 +1328,9 @@ static int EvalEA (const InsDesc* Ins, EffAddr* A)
     /* Build the opcode */
     A->Opcode = Ins->BaseCode | EATab[Ins->ExtCode][A->AddrMode];
 
+    /* If requested, check if the linker may shorten the instruction */
+    CheckRelax (Ins, A, AddrModeSet);
+
     /* If feature force_range is active, and we have immediate addressing mode,
     ** limit the expression to the maximum possible value.
     */
@@ -1304,6 +1368,9 @@ static void EmitCode (EffAddr* A)
                 ** addressing inside a 64K segment.
                 */
                 Emit2 (A->Opcode, GenNearAddrExpr (A->Expr));
+            } else if (A->ShortOpcode != 0) {
+                /* The linker may replace this by a two byte instruction */
+                EmitRelax (A->Opcode, A->ShortOpcode, A->RelaxKind, A->Expr);
             } else {
                 Emit2 (A->Opcode, A->Expr);
             }
@@ -39,13 +39,13 @@
 /* common */
 #include "coll.h"
 #include "hashfunc.h"
+#include "objwrite.h"
 #include "xmalloc.h"
 
 /* ca65 */
 #include "filetab.h"
 #include "global.h"
 #include "lineinfo.h"
-#include "objfile.h"
 #include "scanner.h"
 #include "span.h"
 
@@ -496,14 +496,8 @@ void WriteLineInfos (void)
         /* Get a pointer to this line info */
         LineInfo* LI = CollAt (&LineInfoList, I);
 
-        /* Write the source file position */
-        ObjWritePos (&LI->Key.Pos);
-
-        /* Write the type and count of the line info */
-        ObjWriteVar (LI->Key.Type);
-
-        /* Write the ids of the spans for this line */
-        WriteSpanList (&LI->Spans);
+        /* Write the position, the type and count, and the spans */
+        WriteObjLineInfo (&LI->Key.Pos, LI->Key.Type, &LI->Spans);
     }
 
     /* End of line infos */
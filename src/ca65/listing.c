@@ -369,6 +369,11 @@ void CreateListing (void)
                     B = AddMult (B, 'r', Frag->Len*2);
                     break;
 
+                case FRAG_RELAX:
+                    B = AddHex (B, Frag->V.Relax.OPC);
+                    B = AddMult (B, 'r', (Frag->Len-1)*2);
+                    break;
+
                 case FRAG_FILL:
                     B = AddMult (B, 'x', Frag->Len*2);
                     break;
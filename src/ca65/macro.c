@@ -37,6 +37,7 @@
 #include <string.h>
 
 /* common */
+#include "attrib.h"
 #include "check.h"
 #include "hashfunc.h"
 #include "hashtab.h"
@@ -50,6 +51,7 @@
 #include "istack.h"
 #include "lineinfo.h"
 #include "nexttok.h"
+#include "precomp.h"
 #include "pseudo.h"
 #include "toklist.h"
 #include "macro.h"
@@ -91,6 +93,23 @@ struct IdDesc {
 
 
 
+/* Struct that holds one token of a macro body. The string values of all
+** tokens are stored in one string buffer of the macro.
+*/
+typedef struct MacTok MacTok;
+struct MacTok {
+    token_t         Tok;        /* The actual token value */
+    int             WS;         /* Flag for "whitespace before token" */
+    long            IVal;       /* Integer attribute value */
+    unsigned        SOffs;      /* Offset of string attribute in Strings */
+    unsigned        SLen;       /* Length of string attribute */
+    unsigned        Local;      /* Index of local symbol or NO_LOCAL */
+    FilePos         Pos;        /* Position from which token was read */
+};
+
+/* Marker for body tokens that are not local symbols */
+#define NO_LOCAL        (~0U)
+
 /* Struct that describes a macro definition */
 struct Macro {
     HashNode        Node;       /* Hash list node */
@@ -100,8 +119,9 @@ struct Macro {
     unsigned        ParamCount; /* Parameter count of macro */
     IdDesc*         Params;     /* Identifiers of macro parameters */
     unsigned        TokCount;   /* Number of tokens for this macro */
-    TokNode*        TokRoot;    /* Root of token list */
-    TokNode*        TokLast;    /* Pointer to last token in list */
+    unsigned        TokMax;     /* Number of allocated tokens */
+    MacTok*         Toks;       /* Tokens of the macro body */
+    StrBuf          Strings;    /* String attributes of all body tokens */
     StrBuf          Name;       /* Macro name, dynamically allocated */
     unsigned        Expansions; /* Number of active macro expansions */
     unsigned char   Style;      /* Macro style */
@@ -124,7 +144,7 @@ struct MacExp {
     MacExp*     Next;           /* Pointer to next expansion */
     Macro*      M;              /* Which macro do we expand? */
     unsigned    IfSP;           /* .IF stack pointer at start of expansion */
-    TokNode*    Exp;            /* Pointer to current token */
+    unsigned    Exp;            /* Index of next body token */
     TokNode*    Final;          /* Pointer to final token */
     unsigned    MacExpansions;  /* Number of active macro expansions */
     unsigned    LocalStart;     /* Start of counter for local symbol names */
@@ -133,6 +153,8 @@ struct MacExp {
     TokNode*    ParamExp;       /* Node for expanding parameters */
     LineInfo*   LI;             /* Line info for the expansion */
     LineInfo*   ParamLI;        /* Line info for parameter expansion */
+    FilePos     LIPos;          /* Source position of LI */
+    FilePos     ParamLIPos;     /* Source position of ParamLI */
 };
 
 /* Maximum number of nested macro expansions */
@@ -245,8 +267,9 @@ static Macro* NewMacro (const StrBuf* Name, unsigned char Style)
     M->ParamCount = 0;
     M->Params     = 0;
     M->TokCount   = 0;
-    M->TokRoot    = 0;
-    M->TokLast    = 0;
+    M->TokMax     = 0;
+    M->Toks       = 0;
+    SB_Init (&M->Strings);
     SB_Init (&M->Name);
     SB_Copy (&M->Name, Name);
     M->Expansions = 0;
@@ -265,19 +288,15 @@ static Macro* NewMacro (const StrBuf* Name, unsigned char Style)
 static void FreeMacro (Macro* M)
 /* Free a macro entry which has already been removed from the macro table. */
 {
-    TokNode* T;
-
     /* Free locals */
     FreeIdDescList (M->Locals);
 
     /* Free identifiers of parameters */
     FreeIdDescList (M->Params);
 
-    /* Free the token list for the macro */
-    while ((T = M->TokRoot) != 0) {
-        M->TokRoot = T->Next;
-        FreeTokNode (T);
-    }
+    /* Free the macro body */
+    xfree (M->Toks);
+    SB_Done (&M->Strings);
 
     /* Free the macro name */
     SB_Done (&M->Name);
@@ -288,6 +307,101 @@ static void FreeMacro (Macro* M)
 
 
 
+static MacTok* NewMacTok (Macro* M)
+/* Append the current token to the body of the given macro and return the
+** new body token.
+*/
+{
+    MacTok* T;
+
+    /* Grow the token array if necessary */
+    if (M->TokCount == M->TokMax) {
+        M->TokMax = (M->TokMax == 0)? 16 : M->TokMax * 2;
+        M->Toks   = xrealloc (M->Toks, M->TokMax * sizeof (MacTok));
+    }
+
+    /* Initialize the token from the current token */
+    T = M->Toks + M->TokCount++;
+    T->Tok   = CurTok.Tok;
+    T->WS    = CurTok.WS;
+    T->IVal  = CurTok.IVal;
+    T->SOffs = SB_GetLen (&M->Strings);
+    T->SLen  = SB_GetLen (&CurTok.SVal);
+    T->Local = NO_LOCAL;
+    T->Pos   = CurTok.Pos;
+    SB_Append (&M->Strings, &CurTok.SVal);
+
+    /* Return the new token */
+    return T;
+}
+
+
+
+static void MacTokSet (const Macro* M, const MacTok* T)
+/* Set the scanner token from the given body token */
+{
+    CurTok.Tok  = T->Tok;
+    CurTok.WS   = T->WS;
+    CurTok.IVal = T->IVal;
+    SB_CopyBuf (&CurTok.SVal, SB_GetConstBuf (&M->Strings) + T->SOffs, T->SLen);
+    SB_Terminate (&CurTok.SVal);
+    CurTok.Pos  = T->Pos;
+}
+
+
+
+static void ResolveLocals (Macro* M)
+/* Mark all identifiers in the body of the macro that are local symbols, so
+** they need not be searched on each expansion.
+*/
+{
+    unsigned I;
+
+    for (I = 0; I < M->TokCount; ++I) {
+
+        MacTok* T = M->Toks + I;
+        unsigned Index;
+        const IdDesc* L;
+
+        if (T->Tok != TOK_IDENT && T->Tok != TOK_LOCAL_IDENT) {
+            continue;
+        }
+
+        /* Search for the identifier in the list of locals */
+        for (Index = 0, L = M->Locals; L; ++Index, L = L->Next) {
+            if (SB_GetLen (&L->Id) == T->SLen &&
+                memcmp (SB_GetConstBuf (&L->Id),
+                        SB_GetConstBuf (&M->Strings) + T->SOffs,
+                        T->SLen) == 0) {
+                T->Local = Index;
+                break;
+            }
+        }
+    }
+}
+
+
+
+static void MacStartLine (LineInfo** LI, FilePos* LIPos, unsigned Type,
+                          unsigned Count)
+/* Start line info for the current token. Since line infos are kept per
+** source line, a new one is needed only if the token is from another line
+** than the last one.
+*/
+{
+    if (*LI) {
+        if (LIPos->Line == CurTok.Pos.Line && LIPos->Name == CurTok.Pos.Name) {
+            /* Same line, keep the line info */
+            return;
+        }
+        EndLine (*LI);
+    }
+    *LI    = StartLine (&CurTok.Pos, Type, Count);
+    *LIPos = CurTok.Pos;
+}
+
+
+
 static MacExp* NewMacExp (Macro* M)
 /* Create a new expansion structure for the given macro */
 {
@@ -299,7 +413,7 @@ static MacExp* NewMacExp (Macro* M)
     /* Initialize the data */
     E->M                = M;
     E->IfSP             = GetIfStack ();
-    E->Exp              = M->TokRoot;
+    E->Exp              = 0;
     E->Final            = 0;
     E->MacExpansions    = ++MacExpansions;      /* One macro expansion more */
     E->LocalStart       = LocalName;
@@ -389,7 +503,7 @@ void MacDef (unsigned Style)
 /* Parse a macro definition */
 {
     Macro* M;
-    TokNode* N;
+    MacTok* T;
     int HaveParams;
 
     /* We expect a macro name here */
@@ -407,7 +521,7 @@ void MacDef (unsigned Style)
     }
 
     /* Did we already define that macro? */
-    if (HT_Find (&MacroTab, &CurTok.SVal) != 0) {
+    if (FindAnyMacro (&CurTok.SVal) != 0) {
         /* Macro is already defined */
         Error ("A macro named '%m%p' is already defined", &CurTok.SVal);
         /* Skip tokens until we reach the final .endmacro */
@@ -546,8 +660,8 @@ void MacDef (unsigned Style)
             continue;
         }
 
-        /* Create a token node for the current token */
-        N = NewTokNode ();
+        /* Add the current token to the macro body */
+        T = NewMacTok (M);
 
         /* If the token is an identifier, check if it is a local parameter */
         if (CurTok.Tok == TOK_IDENT) {
@@ -556,8 +670,8 @@ void MacDef (unsigned Style)
             while (I) {
                 if (SB_Compare (&I->Id, &CurTok.SVal) == 0) {
                     /* Local param name, replace it */
-                    N->T.Tok  = TOK_MACPARAM;
-                    N->T.IVal = Count;
+                    T->Tok  = TOK_MACPARAM;
+                    T->IVal = Count;
                     break;
                 }
                 ++Count;
@@ -565,17 +679,6 @@ void MacDef (unsigned Style)
             }
         }
 
-        /* Insert the new token in the list */
-        if (M->TokCount == 0) {
-            /* First token */
-            M->TokRoot = M->TokLast = N;
-        } else {
-            /* We have already tokens */
-            M->TokLast->Next = N;
-            M->TokLast = N;
-        }
-        ++M->TokCount;
-
         /* Read the next token */
         NextTok ();
     }
@@ -585,6 +688,11 @@ void MacDef (unsigned Style)
         NextTok ();
     }
 
+    /* All local symbols are known now */
+    if (M->LocalCount) {
+        ResolveLocals (M);
+    }
+
     /* Reset the Incomplete flag now that parsing is done */
     M->Incomplete = 0;
 
@@ -653,11 +761,9 @@ ExpandParam:
         /* Ok, use token from parameter list */
         TokSet (Mac->ParamExp);
 
-        /* Create new line info for this parameter token */
-        if (Mac->ParamLI) {
-            EndLine (Mac->ParamLI);
-        }
-        Mac->ParamLI = StartLine (&CurTok.Pos, LI_TYPE_MACPARAM, Mac->MacExpansions);
+        /* Create new line info for this parameter token if needed */
+        MacStartLine (&Mac->ParamLI, &Mac->ParamLIPos, LI_TYPE_MACPARAM,
+                      Mac->MacExpansions);
 
         /* Set pointer to next token */
         Mac->ParamExp = Mac->ParamExp->Next;
@@ -676,19 +782,14 @@ ExpandParam:
     /* We're not expanding macro parameters. Check if we have tokens left from
     ** the macro itself.
     */
-    if (Mac->Exp) {
+    if (Mac->Exp < Mac->M->TokCount) {
 
         /* Use next macro token */
-        TokSet (Mac->Exp);
+        const MacTok* T = Mac->M->Toks + Mac->Exp++;
+        MacTokSet (Mac->M, T);
 
-        /* Create new line info for this token */
-        if (Mac->LI) {
-            EndLine (Mac->LI);
-        }
-        Mac->LI = StartLine (&CurTok.Pos, LI_TYPE_MACRO, Mac->MacExpansions);
-
-        /* Set pointer to next token */
-        Mac->Exp = Mac->Exp->Next;
+        /* Create new line info for this token if needed */
+        MacStartLine (&Mac->LI, &Mac->LIPos, LI_TYPE_MACRO, Mac->MacExpansions);
 
         /* Is it a request for actual parameter count? */
         if (CurTok.Tok == TOK_PARAMCOUNT) {
@@ -707,37 +808,24 @@ ExpandParam:
             goto ExpandParam;
         }
 
-        /* If it's an identifier, it may in fact be a local symbol */
-        if ((CurTok.Tok == TOK_IDENT || CurTok.Tok == TOK_LOCAL_IDENT) &&
-            Mac->M->LocalCount) {
-            /* Search for the local symbol in the list */
-            unsigned Index = 0;
-            IdDesc* I = Mac->M->Locals;
-            while (I) {
-                if (SB_Compare (&CurTok.SVal, &I->Id) == 0) {
-                    /* This is in fact a local symbol, change the name. Be sure
-                    ** to generate a local label name if the original name was
-                    ** a local label, and also generate a name that cannot be
-                    ** generated by a user.
-                    */
-                    if (SB_At (&I->Id, 0) == LocalStart) {
-                        /* Must generate a local symbol */
-                        SB_Printf (&CurTok.SVal, "%cLOCAL-MACRO_SYMBOL-%04X",
-                                   LocalStart, Mac->LocalStart + Index);
-                    } else {
-                        /* Global symbol */
-                        SB_Printf (&CurTok.SVal, "LOCAL-MACRO_SYMBOL-%04X",
-                                   Mac->LocalStart + Index);
-                    }
-                    break;
-                }
-                /* Next symbol */
-                ++Index;
-                I = I->Next;
+        /* If it's an identifier, it may in fact be a local symbol. These
+        ** have been marked when the macro was defined.
+        */
+        if (T->Local != NO_LOCAL) {
+            /* This is in fact a local symbol, change the name. Be sure to
+            ** generate a local label name if the original name was a local
+            ** label, and also generate a name that cannot be generated by a
+            ** user.
+            */
+            if (SB_At (&CurTok.SVal, 0) == LocalStart) {
+                /* Must generate a local symbol */
+                SB_Printf (&CurTok.SVal, "%cLOCAL-MACRO_SYMBOL-%04X",
+                           LocalStart, Mac->LocalStart + T->Local);
+            } else {
+                /* Global symbol */
+                SB_Printf (&CurTok.SVal, "LOCAL-MACRO_SYMBOL-%04X",
+                           Mac->LocalStart + T->Local);
             }
-
-            /* Done */
-            return 1;
         }
 
         /* The token was successfully set */
@@ -1000,7 +1088,7 @@ Macro* FindMacro (const StrBuf* Name)
 ** this name was found, return NULL.
 */
 {
-    Macro* M = HT_Find (&MacroTab, Name);
+    Macro* M = FindAnyMacro (Name);
     return (M != 0 && M->Style == MAC_STYLE_CLASSIC)? M : 0;
 }
 
@@ -1019,12 +1107,28 @@ Macro* FindDefine (const StrBuf* Name)
     }
 
     /* Check if we have such a macro */
-    M = HT_Find (&MacroTab, Name);
+    M = FindAnyMacro (Name);
     return (M != 0 && M->Style == MAC_STYLE_DEFINE)? M : 0;
 }
 
 
 
+Macro* FindAnyMacro (const StrBuf* Name)
+/* Try to find a macro of any style with the given name and return it. If no
+** macro with this name was found, return NULL.
+*/
+{
+    Macro* M = HT_Find (&MacroTab, Name);
+
+    /* A precompiled include depends on the names it did not find */
+    if (M == 0 && Precompile) {
+        PrecompRefMacro (Name);
+    }
+    return M;
+}
+
+
+
 int InMacExpansion (void)
 /* Return true if we're currently expanding a macro */
 {
@@ -1049,3 +1153,119 @@ void EnableDefineStyleMacros (void)
     PRECONDITION (DisableDefines > 0);
     --DisableDefines;
 }
+
+
+
+static void WriteIdList (const IdDesc* ID, unsigned Count)
+/* Write a list of identifiers to a precompiled include */
+{
+    PrecompWriteVar (Count);
+    while (ID) {
+        PrecompWriteStr (&ID->Id);
+        ID = ID->Next;
+    }
+}
+
+
+
+static unsigned ReadIdList (IdDesc** List)
+/* Read a list of identifiers from a precompiled include and return the
+** number of identifiers read.
+*/
+{
+    StrBuf Id = STATIC_STRBUF_INITIALIZER;
+    unsigned Count = PrecompReadVar ();
+    unsigned I;
+    for (I = 0; I < Count; ++I) {
+        PrecompReadStr (&Id);
+        *List = NewIdDesc (&Id);
+        List = &(*List)->Next;
+    }
+    SB_Done (&Id);
+    return Count;
+}
+
+
+
+static int WriteOneMacro (void* Entry, void* Data attribute ((unused)))
+/* Write one macro to a precompiled include */
+{
+    const Macro* M = Entry;
+    unsigned I;
+
+    PrecompWriteStr (&M->Name);
+    PrecompWrite8 (M->Style);
+    WriteIdList (M->Params, M->ParamCount);
+    WriteIdList (M->Locals, M->LocalCount);
+
+    /* Write the body */
+    PrecompWriteVar (M->TokCount);
+    for (I = 0; I < M->TokCount; ++I) {
+        const MacTok* T = M->Toks + I;
+        PrecompWriteVar (T->Tok);
+        PrecompWrite8 (T->WS);
+        PrecompWriteVal (T->IVal);
+        PrecompWriteVar (T->SOffs);
+        PrecompWriteVar (T->SLen);
+        PrecompWriteVar (T->Local + 1);         /* NO_LOCAL becomes zero */
+        PrecompWriteVar (T->Pos.Line);
+        PrecompWriteVar (T->Pos.Col);
+        PrecompWriteVar (T->Pos.Name);
+    }
+    PrecompWriteStr (&M->Strings);
+
+    /* Keep the macro */
+    return 0;
+}
+
+
+
+void MacWritePrecomp (void)
+/* Write all macros to a precompiled include */
+{
+    PrecompWriteVar (HT_GetCount (&MacroTab));
+    HT_Walk (&MacroTab, WriteOneMacro, 0);
+}
+
+
+
+void MacReadPrecomp (void)
+/* Read the macros from a precompiled include and define them */
+{
+    StrBuf Name = STATIC_STRBUF_INITIALIZER;
+    unsigned Count = PrecompReadVar ();
+
+    while (Count--) {
+
+        Macro* M;
+        unsigned I;
+
+        /* Create the macro */
+        PrecompReadStr (&Name);
+        M = NewMacro (&Name, PrecompRead8 ());
+        M->ParamCount = ReadIdList (&M->Params);
+        M->LocalCount = ReadIdList (&M->Locals);
+
+        /* Read the body. Positions refer to the files of the include. */
+        M->TokCount = M->TokMax = PrecompReadVar ();
+        M->Toks = xmalloc (M->TokMax * sizeof (MacTok));
+        for (I = 0; I < M->TokCount; ++I) {
+            MacTok* T = M->Toks + I;
+            T->Tok      = (token_t) PrecompReadVar ();
+            T->WS       = PrecompRead8 ();
+            T->IVal     = PrecompReadVal ();
+            T->SOffs    = PrecompReadVar ();
+            T->SLen     = PrecompReadVar ();
+            T->Local    = PrecompReadVar () - 1;
+            T->Pos.Line = PrecompReadVar ();
+            T->Pos.Col  = PrecompReadVar ();
+            T->Pos.Name = PrecompMapFile (PrecompReadVar ());
+        }
+        PrecompReadStr (&M->Strings);
+
+        /* The macro is ready for use */
+        M->Incomplete = 0;
+    }
+
+    SB_Done (&Name);
+}
@@ -94,6 +94,11 @@ Macro* FindDefine (const struct StrBuf* Name);
 ** such macro was found, return NULL.
 */
 
+Macro* FindAnyMacro (const struct StrBuf* Name);
+/* Try to find a macro of any style with the given name and return it. If no
+** macro with this name was found, return NULL.
+*/
+
 int InMacExpansion (void);
 /* Return true if we're currently expanding a macro */
 
@@ -105,6 +110,12 @@ void EnableDefineStyleMacros (void);
 ** DisableDefineStyleMacros.
 */
 
+void MacWritePrecomp (void);
+/* Write all macros to a precompiled include */
+
+void MacReadPrecomp (void);
+/* Read the macros from a precompiled include and define them */
+
 
 
 /* End of macro.h */
@@ -43,7 +43,11 @@
 #include "chartype.h"
 #include "cmdline.h"
 #include "debugflag.h"
+#include "fname.h"
 #include "mmodel.h"
+#include "objdefs.h"
+#include "objspan.h"
+#include "objwrite.h"
 #include "print.h"
 #include "scopedefs.h"
 #include "strbuf.h"
@@ -67,8 +71,8 @@
 #include "listing.h"
 #include "macro.h"
 #include "nexttok.h"
-#include "objfile.h"
 #include "options.h"
+#include "precomp.h"
 #include "pseudo.h"
 #include "scanner.h"
 #include "segment.h"
@@ -81,6 +85,17 @@
 
 
 
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Default extension for object files */
+#define OBJ_EXT ".o"
+
+
+
 /*****************************************************************************/
 /*                                   Code                                    */
 /*****************************************************************************/
@@ -125,6 +140,7 @@ static void Usage (void)
             "  --list-bytes n\t\tMaximum number of bytes per listing line\n"
             "  --memory-model model\t\tSet the memory model\n"
             "  --pagelength n\t\tSet the page length for the listing\n"
+            "  --precompile\t\t\tCreate a precompiled include file\n"
             "  --relax-checks\t\tRelax some checks (see docs)\n"
             "  --smart\t\t\tEnable smart mode\n"
             "  --target sys\t\t\tSet the target system\n"
@@ -599,6 +615,15 @@ static void OptPageLength (const char* Opt attribute ((unused)), const char* Arg
 
 
 
+static void OptPrecompile (const char* Opt attribute ((unused)),
+                           const char* Arg attribute ((unused)))
+/* Handle the --precompile option */
+{
+    Precompile = 1;
+}
+
+
+
 static void OptRelaxChecks (const char* Opt attribute ((unused)),
                             const char* Arg attribute ((unused)))
 /* Handle the --relax-checks options */
@@ -830,6 +855,9 @@ static void OneLine (void)
         if (Seg == ActiveSeg) {
             /* Same segment */
             Size = GetPC () - PC;
+        } else if (Seg->Def == ActiveSeg->Def) {
+            /* A relaxable instruction has split the segment */
+            Size = Seg->PC - PC + GetPC ();
         } else {
             /* The line has switched the segment */
             Size = 0;
@@ -860,8 +888,18 @@ static void Assemble (void)
 static void CreateObjFile (void)
 /* Create the object file */
 {
-    /* Open the object, write the header */
-    ObjOpen ();
+    /* Do we have a name for the output file? */
+    if (OutFile == 0) {
+        /* We don't have an output name explicitly given, construct one from
+        ** the name of the input file.
+        */
+        OutFile = MakeFilename (InFile, OBJ_EXT);
+    }
+
+    /* Open the object, write the header. If we have debug infos, set the
+    ** flag in the header.
+    */
+    ObjOpen (OutFile, DbgSyms? OBJ_FLAGS_DBGINFO : 0);
 
     /* Write the object file options */
     WriteOptions ();
@@ -894,7 +932,7 @@ static void CreateObjFile (void)
     WriteAssertions ();
 
     /* Write the spans */
-    WriteSpans ();
+    WriteObjSpans ();
 
     /* Write an updated header and close the file */
     ObjClose ();
@@ -923,6 +961,7 @@ int main (int argc, char* argv [])
         { "--listing",          1,      OptListing              },
         { "--memory-model",     1,      OptMemoryModel          },
         { "--pagelength",       1,      OptPageLength           },
+        { "--precompile",       0,      OptPrecompile           },
         { "--relax-checks",     0,      OptRelaxChecks          },
         { "--smart",            0,      OptSmart                },
         { "--target",           1,      OptTarget               },
@@ -1088,9 +1127,29 @@ int main (int argc, char* argv [])
     /* Define the default options */
     SetOptions ();
 
+    /* If a precompiled include is created, remember what exists before */
+    if (Precompile) {
+        PrecompStart ();
+    }
+
     /* Assemble the input */
     Assemble ();
 
+    /* A precompiled include contains the state after assembling the input,
+    ** so nothing of the remaining processing is needed.
+    */
+    if (Precompile) {
+        if (ErrorCount == 0) {
+            CheckPseudo ();
+            PrecompDone ();
+        }
+        if (ErrorCount == 0) {
+            CreateDependencies ();
+        }
+        DoneScanner ();
+        return (ErrorCount == 0)? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
     /* If we didn't have any errors, check the pseudo insn stacks */
     if (ErrorCount == 0) {
         CheckPseudo ();
@@ -133,6 +133,27 @@ void Emit3 (unsigned char OPC, ExprNode* Expr)
 
 
 
+void EmitRelax (unsigned char OPC, unsigned char ShortOPC, unsigned char Kind,
+                ExprNode* Expr)
+/* Emit an instruction with a two byte argument, that the linker may replace
+** by the two byte instruction ShortOPC. Kind is one of the RELAX_xxx values
+** and tells how the operand of the short instruction is determined.
+*/
+{
+    Fragment* F = GenFragment (FRAG_RELAX, 3);
+    F->V.Relax.Expr     = Expr;
+    F->V.Relax.Kind     = Kind;
+    F->V.Relax.OPC      = OPC;
+    F->V.Relax.ShortOPC = ShortOPC;
+
+    /* Anything that follows goes into a new section, so it will move
+    ** together with its labels if the instruction is shortened.
+    */
+    SegSplit ();
+}
+
+
+
 void EmitSigned (ExprNode* Expr, unsigned Size)
 /* Emit a signed expression with the given size */
 {
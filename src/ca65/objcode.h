@@ -62,6 +62,13 @@ void Emit2 (unsigned char OPC, ExprNode* Value);
 void Emit3 (unsigned char OPC, ExprNode* Expr);
 /* Emit an instruction with a three byte argument */
 
+void EmitRelax (unsigned char OPC, unsigned char ShortOPC, unsigned char Kind,
+                ExprNode* Expr);
+/* Emit an instruction with a two byte argument, that the linker may replace
+** by the two byte instruction ShortOPC. Kind is one of the RELAX_xxx values
+** and tells how the operand of the short instruction is determined.
+*/
+
 void EmitSigned (ExprNode* Expr, unsigned Size);
 /* Emit a signed expression with the given size */
 
@@ -36,12 +36,12 @@
 #include <string.h>
 
 /* common */
+#include "objwrite.h"
 #include "optdefs.h"
 #include "xmalloc.h"
 
 /* ca65 */
 #include "error.h"
-#include "objfile.h"
 #include "options.h"
 #include "spool.h"
 
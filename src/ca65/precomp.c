@@ -0,0 +1,1032 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                 precomp.c                                 */
+/*                                                                           */
+/*           Precompiled include files for the ca65 macroassembler           */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <errno.h>
+
+/* common */
+#include "coll.h"
+#include "filestat.h"
+#include "fname.h"
+#include "mmodel.h"
+#include "print.h"
+#include "searchpath.h"
+#include "strpool.h"
+#include "xmalloc.h"
+
+/* ca65 */
+#include "anonname.h"
+#include "error.h"
+#include "expr.h"
+#include "filetab.h"
+#include "global.h"
+#include "incpath.h"
+#include "instr.h"
+#include "lineinfo.h"
+#include "macro.h"
+#include "precomp.h"
+#include "segment.h"
+#include "spool.h"
+#include "symtab.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Magic and version of precompiled include files */
+#define PRECOMP_MAGIC           0x434E4950UL    /* "PINC" */
+#define PRECOMP_VERSION         1U
+
+/* States of symbols the precompiled file depends on */
+enum {
+    DEP_ABSENT,                         /* Symbol must not exist */
+    DEP_CONST,                          /* Symbol must have a constant value */
+    DEP_OTHER                           /* Symbol must not be used */
+};
+
+/* A source file of a precompiled include */
+typedef struct SrcFile SrcFile;
+struct SrcFile {
+    char*               Name;           /* Name of the file */
+    unsigned long       Size;           /* Size of file */
+    unsigned long       MTime;          /* Time of last modification */
+};
+
+/* A symbol the precompiled include depends on */
+typedef struct SymDep SymDep;
+struct SymDep {
+    unsigned            State;          /* One of the DEP_xxx values */
+    long                Val;            /* Value if State is DEP_CONST */
+};
+
+/* Assembler options that change the meaning of the source. Precompiled
+** includes may only be used with the same settings.
+*/
+static unsigned char* const Options[] = {
+    &IgnoreCase,        &AutoImport,        &SmartMode,
+    &LineCont,          &LargeAlignment,    &RelaxChecks,
+    &StringEscapes,     &DollarIsPC,        &NoColonLabels,
+    &LooseStringTerm,   &LooseCharTerm,     &AtInIdents,
+    &DollarInIdents,    &LeadingDotInIdents,&PCAssignment,
+    &MissingCharTerm,   &UbiquitousIdents,  &OrgPerSeg,
+    &CComments,         &ForceRange,        &UnderlineInNumbers,
+    &AddrSize,          &BracketAsIndirect, &LinkRelax,
+};
+#define OPTION_COUNT    (sizeof (Options) / sizeof (Options[0]))
+
+/* Size of the fingerprint of the assembler settings */
+#define FINGERPRINT_SIZE        (OPTION_COUNT + 4)
+
+/* True while dependencies of the main file are recorded */
+static int Tracking = 0;
+
+/* State captured when precompiling starts */
+static SymEntry*        FirstSym;       /* Head of SymList before the file */
+static SymTable*        LastScope;      /* Last scope before the file */
+static Collection       Predefined = STATIC_COLLECTION_INITIALIZER;
+
+/* Dependencies recorded while precompiling */
+static StringPool*      SymDeps;        /* Names of symbols */
+static Collection       SymStates = STATIC_COLLECTION_INITIALIZER;
+static StringPool*      ScopeDeps;      /* Names of missing scopes */
+static StringPool*      MacroDeps;      /* Names of missing macros */
+
+/* File written */
+static FILE*            F = 0;
+
+/* Contents of the file read */
+static const char*      RName;          /* Name of the file */
+static unsigned char*   RBuf;           /* File contents */
+static const unsigned char* RPos;       /* Read position */
+static const unsigned char* REnd;       /* End of file contents */
+
+/* Mapping of file indices in the file read to indices in the file table */
+static unsigned*        FileMap = 0;
+static unsigned         FileMapCount = 0;
+
+
+
+/*****************************************************************************/
+/*                        Reading and writing helpers                        */
+/*****************************************************************************/
+
+
+
+static void PrecompWriteError (void)
+/* Called on a write error. Will try to close and remove the file, then
+** print a fatal error.
+*/
+{
+    /* Remember the error */
+    int Error = errno;
+
+    /* Force a close of the file, ignoring errors */
+    fclose (F);
+
+    /* Try to remove the file, also ignoring errors */
+    remove (OutFile);
+
+    /* Now abort with a fatal error */
+    Fatal ("Cannot write to output file '%s': %s", OutFile, strerror (Error));
+}
+
+
+
+static void PrecompCorrupt (void)
+/* Called if the precompiled include read is damaged */
+{
+    Fatal ("Precompiled include file '%s' is corrupt", RName);
+}
+
+
+
+void PrecompWrite8 (unsigned V)
+/* Write an 8 bit value to the precompiled include */
+{
+    if (putc (V & 0xFF, F) == EOF) {
+        PrecompWriteError ();
+    }
+}
+
+
+
+void PrecompWriteVar (unsigned long V)
+/* Write a variable sized value to the precompiled include */
+{
+    /* Use the same encoding as the object files: 7 bit chunks with the 8th
+    ** bit set if another chunk follows.
+    */
+    do {
+        unsigned char C = (V & 0x7F);
+        V >>= 7;
+        if (V) {
+            C |= 0x80;
+        }
+        PrecompWrite8 (C);
+    } while (V != 0);
+}
+
+
+
+void PrecompWriteVal (long V)
+/* Write a signed value to the precompiled include */
+{
+    /* Move the sign into bit 0, so small negative values stay short */
+    if (V < 0) {
+        PrecompWriteVar ((((unsigned long) -(V + 1)) << 1) | 1UL);
+    } else {
+        PrecompWriteVar (((unsigned long) V) << 1);
+    }
+}
+
+
+
+void PrecompWriteStr (const StrBuf* S)
+/* Write a string to the precompiled include */
+{
+    unsigned Len = SB_GetLen (S);
+    PrecompWriteVar (Len);
+    if (Len > 0 && fwrite (SB_GetConstBuf (S), 1, Len, F) != Len) {
+        PrecompWriteError ();
+    }
+}
+
+
+
+unsigned PrecompRead8 (void)
+/* Read an 8 bit value from the precompiled include */
+{
+    if (RPos >= REnd) {
+        PrecompCorrupt ();
+    }
+    return *RPos++;
+}
+
+
+
+unsigned long PrecompReadVar (void)
+/* Read a variable sized value from the precompiled include */
+{
+    unsigned long V = 0;
+    unsigned Shift = 0;
+    unsigned char C;
+    do {
+        C = PrecompRead8 ();
+        V |= ((unsigned long) (C & 0x7F)) << Shift;
+        Shift += 7;
+    } while (C & 0x80);
+    return V;
+}
+
+
+
+long PrecompReadVal (void)
+/* Read a signed value from the precompiled include */
+{
+    unsigned long V = PrecompReadVar ();
+    if (V & 1UL) {
+        return -(long) (V >> 1) - 1;
+    } else {
+        return (long) (V >> 1);
+    }
+}
+
+
+
+void PrecompReadStr (StrBuf* S)
+/* Read a string from the precompiled include */
+{
+    unsigned long Len = PrecompReadVar ();
+    if (Len > (unsigned long) (REnd - RPos)) {
+        PrecompCorrupt ();
+    }
+    SB_CopyBuf (S, (const char*) RPos, Len);
+    SB_Terminate (S);
+    RPos += Len;
+}
+
+
+
+unsigned PrecompMapFile (unsigned Index)
+/* Map the index of a file when the include was precompiled to the index of
+** the same file in the current file table.
+*/
+{
+    if (Index == 0) {
+        /* Outside of any file */
+        return 0;
+    }
+    if (Index > FileMapCount) {
+        PrecompCorrupt ();
+    }
+    return FileMap[Index-1];
+}
+
+
+
+/*****************************************************************************/
+/*                            Dependency tracking                            */
+/*****************************************************************************/
+
+
+
+void PrecompRefSym (const StrBuf* Name, const SymEntry* S)
+/* Called when a symbol is searched in the root scope while precompiling. S
+** is the symbol found or NULL.
+*/
+{
+    SymDep* D;
+
+    /* Only the first lookup of a name is of interest */
+    if (!Tracking || SP_Add (SymDeps, Name) < CollCount (&SymStates)) {
+        return;
+    }
+
+    D = xmalloc (sizeof (SymDep));
+    D->Val = 0;
+    if (S == 0 || CollIndex (&Predefined, (void*) S) < 0) {
+        D->State = DEP_ABSENT;
+    } else if (SymIsConst (S, &D->Val)) {
+        D->State = DEP_CONST;
+    } else {
+        D->State = DEP_OTHER;
+    }
+    CollAppend (&SymStates, D);
+}
+
+
+
+void PrecompRefScope (const StrBuf* Name)
+/* Called when a scope was not found in the root scope while precompiling */
+{
+    if (Tracking) {
+        SP_Add (ScopeDeps, Name);
+    }
+}
+
+
+
+void PrecompRefMacro (const StrBuf* Name)
+/* Called when a macro was not found while precompiling */
+{
+    if (Tracking) {
+        SP_Add (MacroDeps, Name);
+    }
+}
+
+
+
+/*****************************************************************************/
+/*                              Writing the file                             */
+/*****************************************************************************/
+
+
+
+static unsigned GetFingerprint (unsigned char* Buf)
+/* Put the settings a precompiled include depends on into Buf and return the
+** number of bytes used.
+*/
+{
+    unsigned I;
+    for (I = 0; I < OPTION_COUNT; ++I) {
+        Buf[I] = *Options[I];
+    }
+    Buf[I++] = (unsigned char) LocalStart;
+    Buf[I++] = (unsigned char) GetCPU ();
+    Buf[I++] = (unsigned char) MemoryModel;
+    Buf[I++] = GetCurrentSegAddrSize ();
+    return I;
+}
+
+
+
+static void CollectSyms (Collection* Syms)
+/* Put all symbols created by the main file into Syms in order of creation */
+{
+    SymEntry* S;
+    unsigned I, J;
+
+    for (S = SymList; S != FirstSym; S = S->List) {
+        CollAppend (Syms, S);
+    }
+    for (I = 0, J = CollCount (Syms); I + 1 < J; ++I, --J) {
+        void* T = CollAt (Syms, I);
+        CollReplace (Syms, CollAt (Syms, J-1), I);
+        CollReplace (Syms, T, J-1);
+    }
+}
+
+
+
+static void CollectScopes (Collection* Scopes)
+/* Put all scopes created by the main file into Scopes in order of creation */
+{
+    SymTable* S;
+    for (S = LastScope->Next; S; S = S->Next) {
+        CollAppend (Scopes, S);
+    }
+}
+
+
+
+static void CheckContents (Collection* Syms, const Collection* Scopes)
+/* Check that the main file contains only things that can be precompiled */
+{
+    unsigned I;
+
+    /* The file must not emit code or data */
+    for (I = 0; I < CollCount (&SegmentList); ++I) {
+        const Segment* Seg = CollConstAt (&SegmentList, I);
+        if (Seg->Root != 0 || Seg->PC != 0) {
+            Error ("Precompiled include files must not emit code or data");
+            break;
+        }
+    }
+
+    /* All scopes must be closed */
+    if (CurrentScope != RootScope) {
+        Error ("Local scope was not closed");
+    }
+
+    /* Scopes must not have labels */
+    for (I = 0; I < CollCount (Scopes); ++I) {
+        const SymTable* S = CollConstAt (Scopes, I);
+        if (S->Label != 0) {
+            Error ("Scope '%m%p' cannot be precompiled", GetStrBuf (S->Name));
+        }
+    }
+
+    /* Symbols must be constants or declarations */
+    for (I = 0; I < CollCount (Syms); ++I) {
+        SymEntry* S = CollAt (Syms, I);
+        if (S->Flags & SF_LOCAL) {
+            if (CollIndex (Syms, S->Sym.Entry) < 0) {
+                LIError (&S->DefLines,
+                         "Cheap local symbol '%m%p' has no parent in this file",
+                         GetSymName (S));
+                continue;
+            }
+        } else if (S->Sym.Tab == 0) {
+            /* Symbol not in a table. May happen after errors. */
+            continue;
+        }
+        if (SymIsDef (S)) {
+            if (!SymIsConst (S, 0)) {
+                LIError (&S->DefLines,
+                         "Symbol '%m%p' is not constant and cannot be precompiled",
+                         GetSymName (S));
+            }
+        } else if (SymIsRef (S) &&
+                   (S->Flags & (SF_IMPORT | SF_GLOBAL | SF_EXPORT)) == 0) {
+            /* Symbols in nested scopes are not yet resolved to the ones in
+            ** the enclosing scopes, so they cannot be used here.
+            */
+            LIError (&S->RefLines,
+                     "Symbol '%m%p' is undefined or from an enclosing scope",
+                     GetSymName (S));
+        }
+    }
+
+    /* Predefined symbols must not be changed */
+    for (I = 0; I < CollCount (&Predefined); ++I) {
+        const SymEntry* S = CollConstAt (&Predefined, I);
+        if (S->Flags & (SF_EXPORT | SF_IMPORT | SF_GLOBAL)) {
+            Error ("Cannot change symbol '%m%p' in a precompiled include",
+                   GetSymName (S));
+        }
+    }
+}
+
+
+
+static void WriteStringPool (const StringPool* P)
+/* Write a list of names */
+{
+    unsigned I;
+    unsigned Count = SP_GetCount (P);
+    PrecompWriteVar (Count);
+    for (I = 0; I < Count; ++I) {
+        PrecompWriteStr (SP_Get (P, I));
+    }
+}
+
+
+
+static void WriteHeader (void)
+/* Write the header, files and dependencies */
+{
+    unsigned char FP[FINGERPRINT_SIZE];
+    unsigned Count, I;
+
+    /* Magic, version and settings */
+    PrecompWrite8 (PRECOMP_MAGIC);
+    PrecompWrite8 (PRECOMP_MAGIC >> 8);
+    PrecompWrite8 (PRECOMP_MAGIC >> 16);
+    PrecompWrite8 (PRECOMP_MAGIC >> 24);
+    PrecompWriteVar (PRECOMP_VERSION);
+    Count = GetFingerprint (FP);
+    PrecompWriteVar (Count);
+    for (I = 0; I < Count; ++I) {
+        PrecompWrite8 (FP[I]);
+    }
+
+    /* Source files */
+    Count = GetFileCount ();
+    PrecompWriteVar (Count);
+    for (I = 1; I <= Count; ++I) {
+        unsigned long Size, MTime;
+        const StrBuf* Name = GetFileInfo (I, &Size, &MTime);
+        PrecompWriteStr (Name);
+        PrecompWriteVar (Size);
+        PrecompWriteVar (MTime);
+    }
+
+    /* Symbols from outside */
+    Count = SP_GetCount (SymDeps);
+    PrecompWriteVar (Count);
+    for (I = 0; I < Count; ++I) {
+        const SymDep* D = CollConstAt (&SymStates, I);
+        PrecompWriteStr (SP_Get (SymDeps, I));
+        PrecompWrite8 (D->State);
+        if (D->State == DEP_CONST) {
+            PrecompWriteVal (D->Val);
+        }
+    }
+
+    /* Missing scopes and macros */
+    WriteStringPool (ScopeDeps);
+    WriteStringPool (MacroDeps);
+}
+
+
+
+static void WritePrecompScopes (Collection* Scopes)
+/* Write the scopes created by the main file */
+{
+    unsigned I;
+    PrecompWriteVar (CollCount (Scopes));
+    for (I = 0; I < CollCount (Scopes); ++I) {
+        const SymTable* S = CollConstAt (Scopes, I);
+        /* Index zero is the root scope, the others are offset by one */
+        PrecompWriteVar (CollIndex (Scopes, S->Parent) + 1);
+        PrecompWriteStr (GetStrBuf (S->Name));
+        PrecompWrite8 (S->Type);
+        PrecompWrite8 (S->AddrSize);
+        PrecompWrite8 (S->Flags);
+    }
+}
+
+
+
+static void WritePrecompSyms (Collection* Syms, Collection* Scopes)
+/* Write the symbols created by the main file */
+{
+    unsigned I;
+    long Val;
+
+    PrecompWriteVar (CollCount (Syms));
+    for (I = 0; I < CollCount (Syms); ++I) {
+        SymEntry* S = CollAt (Syms, I);
+        /* Bit 0 of the parent tells if it's a symbol or a scope */
+        if (S->Flags & SF_LOCAL) {
+            PrecompWriteVar ((CollIndex (Syms, S->Sym.Entry) << 1) | 1);
+        } else {
+            PrecompWriteVar ((CollIndex (Scopes, S->Sym.Tab) + 1) << 1);
+        }
+        PrecompWriteStr (GetSymName (S));
+        PrecompWriteVar (S->Flags);
+        PrecompWrite8 (S->AddrSize);
+        PrecompWrite8 (S->ExportSize);
+        if (SymIsConst (S, &Val)) {
+            PrecompWriteVal (Val);
+        }
+    }
+
+    /* The last global symbol is needed for cheap locals */
+    PrecompWriteVar (CollIndex (Syms, SymLast) + 1);
+}
+
+
+
+/*****************************************************************************/
+/*                              Reading the file                             */
+/*****************************************************************************/
+
+
+
+static unsigned char* ReadWholeFile (const char* Name, size_t* Size)
+/* Read the given file into memory and return it. Return NULL if the file
+** cannot be opened.
+*/
+{
+    unsigned char* Buf = 0;
+    size_t Avail = 0;
+    size_t Len = 0;
+    FILE* RF = fopen (Name, "rb");
+    if (RF == 0) {
+        return 0;
+    }
+    while (1) {
+        if (Len == Avail) {
+            Avail = (Avail == 0)? 4096 : Avail * 2;
+            Buf = xrealloc (Buf, Avail);
+        }
+        Len += fread (Buf + Len, 1, Avail - Len, RF);
+        if (Len < Avail) {
+            break;
+        }
+    }
+    if (ferror (RF)) {
+        Fatal ("Cannot read from precompiled include file '%s': %s",
+               Name, strerror (errno));
+    }
+    (void) fclose (RF);
+    *Size = Len;
+    return Buf;
+}
+
+
+
+static int OutOfDate (const char* Format, ...)
+/* Tell the user why the precompiled include cannot be used and return
+** false.
+*/
+{
+    StrBuf Reason = STATIC_STRBUF_INITIALIZER;
+    va_list ap;
+
+    va_start (ap, Format);
+    SB_VPrintf (&Reason, Format, ap);
+    va_end (ap);
+
+    Print (stdout, 1, "Precompiled include file '%s' not used: %s\n",
+           RName, SB_GetConstBuf (&Reason));
+
+    SB_Done (&Reason);
+    return 0;
+}
+
+
+
+static int MatchingFile (const char* Name, unsigned long Size,
+                         unsigned long MTime)
+/* Return true if the file with the given name exists and has the given size
+** and modification time.
+*/
+{
+    struct stat Buf;
+    return FileStat (Name, &Buf) == 0                   &&
+           (unsigned long) Buf.st_size == Size          &&
+           (unsigned long) Buf.st_mtime == MTime;
+}
+
+
+
+static int CheckHeader (const char* Path, Collection* Files)
+/* Read and check the header, files and dependencies of the precompiled
+** include. Return true if it is usable. The names and sizes of the source
+** files are stored in Files.
+*/
+{
+    StrBuf Name = STATIC_STRBUF_INITIALIZER;
+    unsigned char FP[FINGERPRINT_SIZE];
+    unsigned long Magic, Count, I;
+    SrcFile* SF;
+    int Ok = 0;
+
+    /* Check magic and version */
+    if (REnd - RPos < 4) {
+        return OutOfDate ("Not a precompiled include file");
+    }
+    Magic  = PrecompRead8 ();
+    Magic |= PrecompRead8 () << 8;
+    Magic |= ((unsigned long) PrecompRead8 ()) << 16;
+    Magic |= ((unsigned long) PrecompRead8 ()) << 24;
+    if (Magic != PRECOMP_MAGIC) {
+        return OutOfDate ("Not a precompiled include file");
+    }
+    if (PrecompReadVar () != PRECOMP_VERSION) {
+        return OutOfDate ("Version mismatch");
+    }
+
+    /* Check the settings */
+    Count = PrecompReadVar ();
+    if (Count != GetFingerprint (FP)) {
+        return OutOfDate ("Assembler options differ");
+    }
+    for (I = 0; I < Count; ++I) {
+        if (PrecompRead8 () != FP[I]) {
+            return OutOfDate ("Assembler options differ");
+        }
+    }
+
+    /* Check the source files. The main file is searched for by the include,
+    ** so its name may differ.
+    */
+    Count = PrecompReadVar ();
+    if (Count == 0) {
+        PrecompCorrupt ();
+    }
+    for (I = 0; I < Count; ++I) {
+        unsigned long Size, MTime;
+        const char* FName;
+        PrecompReadStr (&Name);
+        Size  = PrecompReadVar ();
+        MTime = PrecompReadVar ();
+        FName = (I == 0)? Path : SB_GetConstBuf (&Name);
+        if (!MatchingFile (FName, Size, MTime)) {
+            OutOfDate ("File '%s' has changed", FName);
+            goto ExitPoint;
+        }
+        SF = xmalloc (sizeof (SrcFile));
+        SF->Name  = xstrdup (FName);
+        SF->Size  = Size;
+        SF->MTime = MTime;
+        CollAppend (Files, SF);
+    }
+
+    /* Check symbols from outside */
+    Count = PrecompReadVar ();
+    for (I = 0; I < Count; ++I) {
+        SymEntry* S;
+        long Val;
+        unsigned State;
+        PrecompReadStr (&Name);
+        State = PrecompRead8 ();
+        S = SymFind (RootScope, &Name, SYM_FIND_EXISTING);
+        if (State == DEP_ABSENT) {
+            if (S != 0) {
+                OutOfDate ("Symbol '%s' is already in use", SB_GetConstBuf (&Name));
+                goto ExitPoint;
+            }
+        } else if (State == DEP_CONST) {
+            long DepVal = PrecompReadVal ();
+            if (S == 0 || !SymIsConst (S, &Val) || Val != DepVal) {
+                OutOfDate ("Value of symbol '%s' differs", SB_GetConstBuf (&Name));
+                goto ExitPoint;
+            }
+        } else {
+            OutOfDate ("Symbol '%s' is not constant", SB_GetConstBuf (&Name));
+            goto ExitPoint;
+        }
+    }
+
+    /* Check scopes and macros that must not exist */
+    Count = PrecompReadVar ();
+    for (I = 0; I < Count; ++I) {
+        PrecompReadStr (&Name);
+        if (SymFindScope (RootScope, &Name, SYM_FIND_EXISTING) != 0) {
+            OutOfDate ("Scope '%s' is already in use", SB_GetConstBuf (&Name));
+            goto ExitPoint;
+        }
+    }
+    Count = PrecompReadVar ();
+    for (I = 0; I < Count; ++I) {
+        PrecompReadStr (&Name);
+        if (FindAnyMacro (&Name) != 0) {
+            OutOfDate ("Macro '%s' is already in use", SB_GetConstBuf (&Name));
+            goto ExitPoint;
+        }
+    }
+
+    /* Usable */
+    Ok = 1;
+
+ExitPoint:
+    SB_Done (&Name);
+    return Ok;
+}
+
+
+
+static void ReadFiles (const Collection* Files)
+/* Add the source files to the file table and set up the file map */
+{
+    unsigned I;
+    StrBuf Name;
+
+    FileMapCount = CollCount (Files);
+    FileMap = xmalloc (FileMapCount * sizeof (FileMap[0]));
+    for (I = 0; I < FileMapCount; ++I) {
+        const SrcFile* SF = CollConstAt (Files, I);
+        FileMap[I] = AddFile (SB_InitFromString (&Name, SF->Name),
+                              FT_INCLUDE, SF->Size, SF->MTime);
+    }
+}
+
+
+
+static void ReadScopes (Collection* Scopes)
+/* Read the scopes and create them */
+{
+    StrBuf Name = STATIC_STRBUF_INITIALIZER;
+    unsigned long Count = PrecompReadVar ();
+    unsigned long I;
+
+    for (I = 0; I < Count; ++I) {
+        SymTable* Parent;
+        SymTable* S;
+        unsigned long P = PrecompReadVar ();
+        if (P > I) {
+            PrecompCorrupt ();
+        }
+        Parent = (P == 0)? RootScope : CollAt (Scopes, P-1);
+        PrecompReadStr (&Name);
+        if (IsAnonName (&Name)) {
+            /* Anonymous scopes need a new unique name */
+            AnonName (&Name, "SCOPE");
+        }
+        S = SymFindScope (Parent, &Name, SYM_ALLOC_NEW);
+        S->Type     = PrecompRead8 ();
+        S->AddrSize = PrecompRead8 ();
+        S->Flags    = PrecompRead8 ();
+        CollAppend (Scopes, S);
+    }
+
+    SB_Done (&Name);
+}
+
+
+
+static void ReadSyms (const Collection* Scopes)
+/* Read the symbols and create them */
+{
+    StrBuf Name = STATIC_STRBUF_INITIALIZER;
+    Collection Syms = AUTO_COLLECTION_INITIALIZER;
+    unsigned long Count = PrecompReadVar ();
+    unsigned long I;
+
+    for (I = 0; I < Count; ++I) {
+        SymEntry* S;
+        unsigned long P = PrecompReadVar ();
+        PrecompReadStr (&Name);
+        if (P & 1) {
+            if ((P >> 1) >= I) {
+                PrecompCorrupt ();
+            }
+            S = SymFindLocal (CollAt (&Syms, P >> 1), &Name, SYM_ALLOC_NEW);
+        } else {
+            if ((P >> 1) > CollCount (Scopes)) {
+                PrecompCorrupt ();
+            }
+            S = SymFind ((P >> 1) == 0? RootScope : CollAt (Scopes, (P >> 1) - 1),
+                         &Name, SYM_ALLOC_NEW);
+        }
+        S->Flags      = PrecompReadVar ();
+        S->AddrSize   = PrecompRead8 ();
+        S->ExportSize = PrecompRead8 ();
+        if (SymIsDef (S)) {
+            S->Expr = GenLiteralExpr (PrecompReadVal ());
+        }
+
+        /* The include statement is the place of definition and use */
+        if (S->Flags & (SF_DEFINED | SF_IMPORT | SF_GLOBAL)) {
+            GetFullLineInfo (&S->DefLines);
+        }
+        if (S->Flags & SF_REFERENCED) {
+            CollAppend (&S->RefLines, GetAsmLineInfo ());
+        }
+        CollAppend (&Syms, S);
+    }
+
+    /* Set the last global symbol if the file has one */
+    I = PrecompReadVar ();
+    if (I > CollCount (&Syms)) {
+        PrecompCorrupt ();
+    } else if (I > 0) {
+        SymLast = CollAt (&Syms, I-1);
+    }
+
+    DoneCollection (&Syms);
+    SB_Done (&Name);
+}
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void PrecompStart (void)
+/* Start tracking dependencies of the main file, which is precompiled */
+{
+    SymEntry* S;
+
+    /* Remember what existed before the main file */
+    FirstSym = SymList;
+    for (S = SymList; S; S = S->List) {
+        CollAppend (&Predefined, S);
+    }
+    LastScope = RootScope;
+    while (LastScope->Next) {
+        LastScope = LastScope->Next;
+    }
+
+    /* Start recording */
+    SymDeps   = NewStringPool (211);
+    ScopeDeps = NewStringPool (31);
+    MacroDeps = NewStringPool (211);
+    Tracking  = 1;
+}
+
+
+
+void PrecompDone (void)
+/* Check the state after assembling the main file and write the precompiled
+** include.
+*/
+{
+    Collection Syms   = AUTO_COLLECTION_INITIALIZER;
+    Collection Scopes = AUTO_COLLECTION_INITIALIZER;
+
+    /* Stop recording */
+    Tracking = 0;
+
+    /* Check if the file can be precompiled */
+    CollectSyms (&Syms);
+    CollectScopes (&Scopes);
+    CheckContents (&Syms, &Scopes);
+
+    if (ErrorCount == 0) {
+
+        /* Do we have a name for the output file? */
+        if (OutFile == 0) {
+            OutFile = MakeFilename (InFile, PRECOMP_EXT);
+        }
+
+        /* Create the output file */
+        F = fopen (OutFile, "wb");
+        if (F == 0) {
+            Fatal ("Cannot open output file '%s': %s", OutFile, strerror (errno));
+        }
+
+        /* Write the data */
+        WriteHeader ();
+        WritePrecompScopes (&Scopes);
+        WritePrecompSyms (&Syms, &Scopes);
+        MacWritePrecomp ();
+
+        /* Close the file */
+        if (fclose (F) != 0) {
+            PrecompWriteError ();
+        }
+        F = 0;
+    }
+
+    DoneCollection (&Scopes);
+    DoneCollection (&Syms);
+}
+
+
+
+int PrecompLoad (const char* Name)
+/* Load the precompiled version of the include file with the given name if
+** there is one that is up to date. Return true if this was successful, and
+** false if the include file must be read.
+*/
+{
+    Collection Files = AUTO_COLLECTION_INITIALIZER;
+    char*      PathName;
+    char*      PName;
+    size_t     Size;
+    unsigned   I;
+    int        Ok = 0;
+
+    /* Precompiled includes are not used when creating one, if the include is
+    ** not on the global level, and if debug info or a listing is requested,
+    ** since they don't contain the necessary information.
+    */
+    if (Precompile || DbgSyms || SB_GetLen (&ListingName) > 0 ||
+        CurrentScope != RootScope) {
+        return 0;
+    }
+
+    /* Search for the include file. If it isn't found, let the caller handle
+    ** the error.
+    */
+    PathName = SearchFile (IncSearchPath, Name);
+    if (PathName == 0) {
+        return 0;
+    }
+
+    /* Read the precompiled include if there is one */
+    PName = MakeFilename (PathName, PRECOMP_EXT);
+    RBuf = ReadWholeFile (PName, &Size);
+    if (RBuf != 0) {
+
+        RName = PName;
+        RPos  = RBuf;
+        REnd  = RBuf + Size;
+
+        /* If it is up to date, create its contents */
+        if (CheckHeader (PathName, &Files)) {
+            Collection Scopes = AUTO_COLLECTION_INITIALIZER;
+            ReadFiles (&Files);
+            ReadScopes (&Scopes);
+            ReadSyms (&Scopes);
+            MacReadPrecomp ();
+            if (RPos != REnd) {
+                PrecompCorrupt ();
+            }
+            DoneCollection (&Scopes);
+            xfree (FileMap);
+            FileMap = 0;
+            FileMapCount = 0;
+            Ok = 1;
+        }
+
+        /* Free the file data */
+        for (I = 0; I < CollCount (&Files); ++I) {
+            SrcFile* SF = CollAt (&Files, I);
+            xfree (SF->Name);
+            xfree (SF);
+        }
+        xfree (RBuf);
+        RBuf = 0;
+    }
+
+    /* Free the names */
+    DoneCollection (&Files);
+    xfree (PName);
+    xfree (PathName);
+
+    /* Return the result */
+    return Ok;
+}
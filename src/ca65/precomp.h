@@ -0,0 +1,144 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                 precomp.h                                 */
+/*                                                                           */
+/*           Precompiled include files for the ca65 macroassembler           */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#ifndef PRECOMP_H
+#define PRECOMP_H
+
+
+
+/* common */
+#include "strbuf.h"
+
+
+
+/*****************************************************************************/
+/*                                 Forwards                                  */
+/*****************************************************************************/
+
+
+
+struct SymEntry;
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Default extension for precompiled include files */
+#define PRECOMP_EXT     ".pinc"
+
+
+
+/*****************************************************************************/
+/*                        Reading and writing helpers                        */
+/*****************************************************************************/
+
+
+
+void PrecompWrite8 (unsigned V);
+/* Write an 8 bit value to the precompiled include */
+
+void PrecompWriteVar (unsigned long V);
+/* Write a variable sized value to the precompiled include */
+
+void PrecompWriteVal (long V);
+/* Write a signed value to the precompiled include */
+
+void PrecompWriteStr (const StrBuf* S);
+/* Write a string to the precompiled include */
+
+unsigned PrecompRead8 (void);
+/* Read an 8 bit value from the precompiled include */
+
+unsigned long PrecompReadVar (void);
+/* Read a variable sized value from the precompiled include */
+
+long PrecompReadVal (void);
+/* Read a signed value from the precompiled include */
+
+void PrecompReadStr (StrBuf* S);
+/* Read a string from the precompiled include */
+
+unsigned PrecompMapFile (unsigned Index);
+/* Map the index of a file when the include was precompiled to the index of
+** the same file in the current file table.
+*/
+
+
+
+/*****************************************************************************/
+/*                            Dependency tracking                            */
+/*****************************************************************************/
+
+
+
+void PrecompRefSym (const StrBuf* Name, const struct SymEntry* S);
+/* Called when a symbol is searched in the root scope while precompiling. S
+** is the symbol found or NULL.
+*/
+
+void PrecompRefScope (const StrBuf* Name);
+/* Called when a scope was not found in the root scope while precompiling */
+
+void PrecompRefMacro (const StrBuf* Name);
+/* Called when a macro was not found while precompiling */
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void PrecompStart (void);
+/* Start tracking dependencies of the main file, which is precompiled */
+
+void PrecompDone (void);
+/* Check the state after assembling the main file and write the precompiled
+** include.
+*/
+
+int PrecompLoad (const char* Name);
+/* Load the precompiled version of the include file with the given name if
+** there is one that is up to date. Return true if this was successful, and
+** false if the include file must be read.
+*/
+
+
+
+/* End of precomp.h */
+
+#endif
@@ -71,6 +71,7 @@
 #include "nexttok.h"
 #include "objcode.h"
 #include "options.h"
+#include "precomp.h"
 #include "pseudo.h"
 #include "repeat.h"
 #include "segment.h"
@@ -363,7 +364,7 @@ static void DoAddr (void)
     static const char EType[2] = { GT_PTR, GT_VOID };
 
     /* Record type information */
-    Span* S = OpenSpan ();
+    ObjSpan* S = OpenSpan ();
     StrBuf Type = STATIC_STRBUF_INITIALIZER;
 
     /* Parse arguments */
@@ -573,7 +574,7 @@ static void DoByte (void)
     static const char EType[1] = { GT_BYTE };
 
     /* Record type information */
-    Span* S = OpenSpan ();
+    ObjSpan* S = OpenSpan ();
     StrBuf Type = AUTO_STRBUF_INITIALIZER;
 
     /* Parse arguments */
@@ -789,7 +790,7 @@ static void DoDByt (void)
     static const char EType[1] = { GT_DBYTE };
 
     /* Record type information */
-    Span* S = OpenSpan ();
+    ObjSpan* S = OpenSpan ();
     StrBuf Type = STATIC_STRBUF_INITIALIZER;
 
     /* Parse arguments */
@@ -972,7 +973,7 @@ static void DoFarAddr (void)
     static const char EType[2] = { GT_FAR_PTR, GT_VOID };
 
     /* Record type information */
-    Span* S = OpenSpan ();
+    ObjSpan* S = OpenSpan ();
     StrBuf Type = STATIC_STRBUF_INITIALIZER;
 
     /* Parse arguments */
@@ -1345,7 +1346,10 @@ static void DoInclude (void)
         ErrorSkip ("String constant expected");
     } else {
         SB_Terminate (&CurTok.SVal);
-        if (NewInputFile (SB_GetConstBuf (&CurTok.SVal)) == 0) {
+        if (PrecompLoad (SB_GetConstBuf (&CurTok.SVal))) {
+            /* Contents taken from the precompiled include file */
+            NextTok ();
+        } else if (NewInputFile (SB_GetConstBuf (&CurTok.SVal)) == 0) {
             /* Error opening the file, skip remainder of line */
             SkipUntilSep ();
         }
@@ -1939,7 +1943,7 @@ static void DoWord (void)
     static const char EType[1] = { GT_WORD };
 
     /* Record type information */
-    Span* S = OpenSpan ();
+    ObjSpan* S = OpenSpan ();
     StrBuf Type = STATIC_STRBUF_INITIALIZER;
 
     /* Parse arguments */
@@ -1979,7 +1983,8 @@ static void DoZeropage (void)
 /* Control commands flags */
 enum {
     ccNone      = 0x0000,               /* No special flags */
-    ccKeepToken = 0x0001                /* Do not skip the control token */
+    ccKeepToken = 0x0001,               /* Do not skip the control token */
+    ccPrecomp   = 0x0002                /* Allowed in precompiled includes */
 };
 
 /* Control command table */
@@ -1991,149 +1996,149 @@ struct CtrlDesc {
 
 #define PSEUDO_COUNT    (sizeof (CtrlCmdTab) / sizeof (CtrlCmdTab [0]))
 static CtrlDesc CtrlCmdTab [] = {
-    { ccNone,           DoA16           },
-    { ccNone,           DoA8            },
-    { ccNone,           DoAddr          },      /* .ADDR */
-    { ccNone,           DoUnexpected    },      /* .ADDRSIZE */
-    { ccNone,           DoAlign         },
-    { ccNone,           DoASCIIZ        },
-    { ccNone,           DoUnexpected    },      /* .ASIZE */
-    { ccNone,           DoAssert        },
-    { ccNone,           DoAutoImport    },
-    { ccNone,           DoUnexpected    },      /* .BANK */
-    { ccNone,           DoUnexpected    },      /* .BANKBYTE */
-    { ccNone,           DoBankBytes     },
-    { ccNone,           DoUnexpected    },      /* .BLANK */
-    { ccNone,           DoBss           },
-    { ccNone,           DoByte          },
-    { ccNone,           DoCase          },
-    { ccNone,           DoCharMap       },
-    { ccNone,           DoCode          },
-    { ccNone,           DoUnexpected,   },      /* .CONCAT */
-    { ccNone,           DoConDes        },
-    { ccNone,           DoUnexpected    },      /* .CONST */
-    { ccNone,           DoConstructor   },
-    { ccNone,           DoUnexpected    },      /* .CPU */
-    { ccNone,           DoData          },
-    { ccNone,           DoDbg,          },
-    { ccNone,           DoDByt          },
-    { ccNone,           DoDebugInfo     },
-    { ccKeepToken,      DoDefine        },
-    { ccNone,           DoUnexpected    },      /* .DEFINED */
-    { ccNone,           DoUnexpected    },      /* .DEFINEDMACRO */
-    { ccNone,           DoDelMac        },
-    { ccNone,           DoDestructor    },
-    { ccNone,           DoDWord         },
-    { ccKeepToken,      DoConditionals  },      /* .ELSE */
-    { ccKeepToken,      DoConditionals  },      /* .ELSEIF */
-    { ccKeepToken,      DoEnd           },
-    { ccNone,           DoUnexpected    },      /* .ENDENUM */
-    { ccKeepToken,      DoConditionals  },      /* .ENDIF */
-    { ccNone,           DoUnexpected    },      /* .ENDMACRO */
-    { ccNone,           DoEndProc       },
-    { ccNone,           DoUnexpected    },      /* .ENDREPEAT */
-    { ccNone,           DoEndScope      },
-    { ccNone,           DoUnexpected    },      /* .ENDSTRUCT */
-    { ccNone,           DoUnexpected    },      /* .ENDUNION */
-    { ccNone,           DoEnum          },
-    { ccNone,           DoError         },
-    { ccNone,           DoExitMacro     },
-    { ccNone,           DoExport        },
-    { ccNone,           DoExportZP      },
-    { ccNone,           DoFarAddr       },
-    { ccNone,           DoFatal         },
-    { ccNone,           DoFeature       },
-    { ccNone,           DoFileOpt       },
-    { ccNone,           DoForceImport   },
-    { ccNone,           DoUnexpected    },      /* .FORCEWORD */
-    { ccNone,           DoGlobal        },
-    { ccNone,           DoGlobalZP      },
-    { ccNone,           DoUnexpected    },      /* .HIBYTE */
-    { ccNone,           DoHiBytes       },
-    { ccNone,           DoUnexpected    },      /* .HIWORD */
-    { ccNone,           DoI16           },
-    { ccNone,           DoI8            },
-    { ccNone,           DoUnexpected    },      /* .IDENT */
-    { ccKeepToken,      DoConditionals  },      /* .IF */
-    { ccKeepToken,      DoConditionals  },      /* .IFBLANK */
-    { ccKeepToken,      DoConditionals  },      /* .IFCONST */
-    { ccKeepToken,      DoConditionals  },      /* .IFDEF */
-    { ccKeepToken,      DoConditionals  },      /* .IFNBLANK */
-    { ccKeepToken,      DoConditionals  },      /* .IFNCONST */
-    { ccKeepToken,      DoConditionals  },      /* .IFNDEF */
-    { ccKeepToken,      DoConditionals  },      /* .IFNREF */
-    { ccKeepToken,      DoConditionals  },      /* .IFP02 */
-    { ccKeepToken,      DoConditionals  },      /* .IFP4510 */
-    { ccKeepToken,      DoConditionals  },      /* .IFP816 */
-    { ccKeepToken,      DoConditionals  },      /* .IFPC02 */
-    { ccKeepToken,      DoConditionals  },      /* .IFPDTV */
-    { ccKeepToken,      DoConditionals  },      /* .IFPSC02 */
-    { ccKeepToken,      DoConditionals  },      /* .IFREF */
-    { ccNone,           DoImport        },
-    { ccNone,           DoImportZP      },
-    { ccNone,           DoIncBin        },
-    { ccNone,           DoInclude       },
-    { ccNone,           DoInterruptor   },
-    { ccNone,           DoUnexpected    },      /* .ISIZE */
-    { ccNone,           DoUnexpected    },      /* .ISMNEMONIC */
-    { ccNone,           DoInvalid       },      /* .LEFT */
-    { ccNone,           DoLineCont      },
-    { ccNone,           DoList          },
-    { ccNone,           DoListBytes     },
-    { ccNone,           DoUnexpected    },      /* .LOBYTE */
-    { ccNone,           DoLoBytes       },
-    { ccNone,           DoUnexpected    },      /* .LOCAL */
-    { ccNone,           DoLocalChar     },
-    { ccNone,           DoUnexpected    },      /* .LOWORD */
-    { ccNone,           DoMacPack       },
-    { ccNone,           DoMacro         },
-    { ccNone,           DoUnexpected    },      /* .MATCH */
-    { ccNone,           DoUnexpected    },      /* .MAX */
-    { ccNone,           DoInvalid       },      /* .MID */
-    { ccNone,           DoUnexpected    },      /* .MIN */
-    { ccNone,           DoNull          },
-    { ccNone,           DoOrg           },
-    { ccNone,           DoOut           },
-    { ccNone,           DoP02           },
-    { ccNone,           DoP4510         },
-    { ccNone,           DoP816          },
-    { ccNone,           DoPageLength    },
-    { ccNone,           DoUnexpected    },      /* .PARAMCOUNT */
-    { ccNone,           DoPC02          },
-    { ccNone,           DoPDTV          },
-    { ccNone,           DoPopCPU        },
-    { ccNone,           DoPopSeg        },
-    { ccNone,           DoProc          },
-    { ccNone,           DoPSC02         },
-    { ccNone,           DoPushCPU       },
-    { ccNone,           DoPushSeg       },
-    { ccNone,           DoUnexpected    },      /* .REFERENCED */
-    { ccNone,           DoReloc         },
-    { ccNone,           DoRepeat        },
-    { ccNone,           DoRes           },
-    { ccNone,           DoInvalid       },      /* .RIGHT */
-    { ccNone,           DoROData        },
-    { ccNone,           DoScope         },
-    { ccNone,           DoSegment       },
-    { ccNone,           DoUnexpected    },      /* .SET */
-    { ccNone,           DoSetCPU        },
-    { ccNone,           DoUnexpected    },      /* .SIZEOF */
-    { ccNone,           DoSmart         },
-    { ccNone,           DoUnexpected    },      /* .SPRINTF */
-    { ccNone,           DoUnexpected    },      /* .STRAT */
-    { ccNone,           DoUnexpected    },      /* .STRING */
-    { ccNone,           DoUnexpected    },      /* .STRLEN */
-    { ccNone,           DoStruct        },
-    { ccNone,           DoTag           },
-    { ccNone,           DoUnexpected    },      /* .TCOUNT */
-    { ccNone,           DoUnexpected    },      /* .TIME */
-    { ccKeepToken,      DoUnDef         },
-    { ccNone,           DoUnion         },
-    { ccNone,           DoUnexpected    },      /* .VERSION */
-    { ccNone,           DoWarning       },
-    { ccNone,           DoWord          },
-    { ccNone,           DoUnexpected    },      /* .XMATCH */
-    { ccNone,           DoZeropage      },
+    { ccNone,                   DoA16           },
+    { ccNone,                   DoA8            },
+    { ccNone,                   DoAddr          },      /* .ADDR */
+    { ccNone,                   DoUnexpected    },      /* .ADDRSIZE */
+    { ccNone,                   DoAlign         },
+    { ccNone,                   DoASCIIZ        },
+    { ccNone,                   DoUnexpected    },      /* .ASIZE */
+    { ccNone,                   DoAssert        },
+    { ccNone,                   DoAutoImport    },
+    { ccNone,                   DoUnexpected    },      /* .BANK */
+    { ccNone,                   DoUnexpected    },      /* .BANKBYTE */
+    { ccNone,                   DoBankBytes     },
+    { ccNone,                   DoUnexpected    },      /* .BLANK */
+    { ccNone,                   DoBss           },
+    { ccNone,                   DoByte          },
+    { ccNone,                   DoCase          },
+    { ccNone,                   DoCharMap       },
+    { ccNone,                   DoCode          },
+    { ccNone,                   DoUnexpected,   },      /* .CONCAT */
+    { ccNone,                   DoConDes        },
+    { ccNone,                   DoUnexpected    },      /* .CONST */
+    { ccNone,                   DoConstructor   },
+    { ccNone,                   DoUnexpected    },      /* .CPU */
+    { ccNone,                   DoData          },
+    { ccNone,                   DoDbg,          },
+    { ccNone,                   DoDByt          },
+    { ccNone,                   DoDebugInfo     },
+    { ccKeepToken | ccPrecomp,  DoDefine        },
+    { ccNone,                   DoUnexpected    },      /* .DEFINED */
+    { ccNone,                   DoUnexpected    },      /* .DEFINEDMACRO */
+    { ccPrecomp,                DoDelMac        },
+    { ccNone,                   DoDestructor    },
+    { ccNone,                   DoDWord         },
+    { ccKeepToken | ccPrecomp,  DoConditionals  },      /* .ELSE */
+    { ccKeepToken | ccPrecomp,  DoConditionals  },      /* .ELSEIF */
+    { ccKeepToken,              DoEnd           },
+    { ccNone,                   DoUnexpected    },      /* .ENDENUM */
+    { ccKeepToken | ccPrecomp,  DoConditionals  },      /* .ENDIF */
+    { ccNone,                   DoUnexpected    },      /* .ENDMACRO */
+    { ccNone,                   DoEndProc       },
+    { ccNone,                   DoUnexpected    },      /* .ENDREPEAT */
+    { ccPrecomp,                DoEndScope      },
+    { ccNone,                   DoUnexpected    },      /* .ENDSTRUCT */
+    { ccNone,                   DoUnexpected    },      /* .ENDUNION */
+    { ccPrecomp,                DoEnum          },
+    { ccPrecomp,                DoError         },
+    { ccPrecomp,                DoExitMacro     },
+    { ccPrecomp,                DoExport        },
+    { ccPrecomp,                DoExportZP      },
+    { ccNone,                   DoFarAddr       },
+    { ccPrecomp,                DoFatal         },
+    { ccNone,                   DoFeature       },
+    { ccNone,                   DoFileOpt       },
+    { ccPrecomp,                DoForceImport   },
+    { ccNone,                   DoUnexpected    },      /* .FORCEWORD */
+    { ccPrecomp,                DoGlobal        },
+    { ccPrecomp,                DoGlobalZP      },
+    { ccNone,                   DoUnexpected    },      /* .HIBYTE */
+    { ccNone,                   DoHiBytes       },
+    { ccNone,                   DoUnexpected    },      /* .HIWORD */
+    { ccNone,                   DoI16           },
+    { ccNone,                   DoI8            },
+    { ccNone,                   DoUnexpected    },      /* .IDENT */
+    { ccKeepToken | ccPrecomp,  DoConditionals  },      /* .IF */
+    { ccKeepToken | ccPrecomp,  DoConditionals  },      /* .IFBLANK */
+    { ccKeepToken | ccPrecomp,  DoConditionals  },      /* .IFCONST */
+    { ccKeepToken | ccPrecomp,  DoConditionals  },      /* .IFDEF */
+    { ccKeepToken | ccPrecomp,  DoConditionals  },      /* .IFNBLANK */
+    { ccKeepToken | ccPrecomp,  DoConditionals  },      /* .IFNCONST */
+    { ccKeepToken | ccPrecomp,  DoConditionals  },      /* .IFNDEF */
+    { ccKeepToken | ccPrecomp,  DoConditionals  },      /* .IFNREF */
+    { ccKeepToken | ccPrecomp,  DoConditionals  },      /* .IFP02 */
+    { ccKeepToken | ccPrecomp,  DoConditionals  },      /* .IFP4510 */
+    { ccKeepToken | ccPrecomp,  DoConditionals  },      /* .IFP816 */
+    { ccKeepToken | ccPrecomp,  DoConditionals  },      /* .IFPC02 */
+    { ccKeepToken | ccPrecomp,  DoConditionals  },      /* .IFPDTV */
+    { ccKeepToken | ccPrecomp,  DoConditionals  },      /* .IFPSC02 */
+    { ccKeepToken | ccPrecomp,  DoConditionals  },      /* .IFREF */
+    { ccPrecomp,                DoImport        },
+    { ccPrecomp,                DoImportZP      },
+    { ccNone,                   DoIncBin        },
+    { ccPrecomp,                DoInclude       },
+    { ccNone,                   DoInterruptor   },
+    { ccNone,                   DoUnexpected    },      /* .ISIZE */
+    { ccNone,                   DoUnexpected    },      /* .ISMNEMONIC */
+    { ccNone,                   DoInvalid       },      /* .LEFT */
+    { ccNone,                   DoLineCont      },
+    { ccNone,                   DoList          },
+    { ccNone,                   DoListBytes     },
+    { ccNone,                   DoUnexpected    },      /* .LOBYTE */
+    { ccNone,                   DoLoBytes       },
+    { ccNone,                   DoUnexpected    },      /* .LOCAL */
+    { ccNone,                   DoLocalChar     },
+    { ccNone,                   DoUnexpected    },      /* .LOWORD */
+    { ccPrecomp,                DoMacPack       },
+    { ccPrecomp,                DoMacro         },
+    { ccNone,                   DoUnexpected    },      /* .MATCH */
+    { ccNone,                   DoUnexpected    },      /* .MAX */
+    { ccNone,                   DoInvalid       },      /* .MID */
+    { ccNone,                   DoUnexpected    },      /* .MIN */
+    { ccNone,                   DoNull          },
+    { ccNone,                   DoOrg           },
+    { ccPrecomp,                DoOut           },
+    { ccNone,                   DoP02           },
+    { ccNone,                   DoP4510         },
+    { ccNone,                   DoP816          },
+    { ccNone,                   DoPageLength    },
+    { ccNone,                   DoUnexpected    },      /* .PARAMCOUNT */
+    { ccNone,                   DoPC02          },
+    { ccNone,                   DoPDTV          },
+    { ccNone,                   DoPopCPU        },
+    { ccNone,                   DoPopSeg        },
+    { ccNone,                   DoProc          },
+    { ccNone,                   DoPSC02         },
+    { ccNone,                   DoPushCPU       },
+    { ccNone,                   DoPushSeg       },
+    { ccNone,                   DoUnexpected    },      /* .REFERENCED */
+    { ccNone,                   DoReloc         },
+    { ccPrecomp,                DoRepeat        },
+    { ccNone,                   DoRes           },
+    { ccNone,                   DoInvalid       },      /* .RIGHT */
+    { ccNone,                   DoROData        },
+    { ccPrecomp,                DoScope         },
+    { ccNone,                   DoSegment       },
+    { ccNone,                   DoUnexpected    },      /* .SET */
+    { ccNone,                   DoSetCPU        },
+    { ccNone,                   DoUnexpected    },      /* .SIZEOF */
+    { ccNone,                   DoSmart         },
+    { ccNone,                   DoUnexpected    },      /* .SPRINTF */
+    { ccNone,                   DoUnexpected    },      /* .STRAT */
+    { ccNone,                   DoUnexpected    },      /* .STRING */
+    { ccNone,                   DoUnexpected    },      /* .STRLEN */
+    { ccPrecomp,                DoStruct        },
+    { ccNone,                   DoTag           },
+    { ccNone,                   DoUnexpected    },      /* .TCOUNT */
+    { ccNone,                   DoUnexpected    },      /* .TIME */
+    { ccKeepToken | ccPrecomp,  DoUnDef         },
+    { ccPrecomp,                DoUnion         },
+    { ccNone,                   DoUnexpected    },      /* .VERSION */
+    { ccPrecomp,                DoWarning       },
+    { ccNone,                   DoWord          },
+    { ccNone,                   DoUnexpected    },      /* .XMATCH */
+    { ccNone,                   DoZeropage      },
 };
 
 
@@ -2162,6 +2167,13 @@ void HandlePseudo (void)
     /* Get the pseudo intruction descriptor */
     D = &CtrlCmdTab [Index];
 
+    /* Precompiled includes may only contain declarations */
+    if (Precompile && (D->Flags & ccPrecomp) == 0) {
+        ErrorSkip ("'%m%p' is not allowed in precompiled include files",
+                   &CurTok.SVal);
+        return;
+    }
+
     /* Remember the instruction, then skip it if needed */
     if ((D->Flags & ccKeepToken) == 0) {
         SB_Copy (&Keyword, &CurTok.SVal);
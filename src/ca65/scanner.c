@@ -75,11 +75,15 @@ Token CurTok = STATIC_TOKEN_INITIALIZER;
 /* Struct to handle include files. */
 typedef struct InputFile InputFile;
 struct InputFile {
-    FILE*           F;                  /* Input file descriptor */
+    char*           Text;               /* Contents of the input file */
+    const char*     TextEnd;            /* End of the file contents */
+    const char*     NextLine;           /* Start of the next input line */
+    const char*     Line;               /* The current input line */
+    unsigned        LineLen;            /* Line length w/o trailing white space */
+    unsigned        LineIdx;            /* Index of next char in the line */
     FilePos         Pos;                /* Position in file */
     token_t         Tok;                /* Last token */
     int             C;                  /* Last character */
-    StrBuf          Line;               /* The current input line */
     int             IncSearchPath;      /* True if we've added a search path */
     int             BinSearchPath;      /* True if we've added a search path */
     InputFile*      Next;               /* Linked list of input files */
@@ -371,72 +375,64 @@ static void IFMarkStart (CharSource* S)
 static void IFNextChar (CharSource* S)
 /* Read the next character from the input file */
 {
-    /* Check for end of line, read the next line if needed */
-    while (SB_GetIndex (&S->V.File.Line) >= SB_GetLen (&S->V.File.Line)) {
+    InputFile* I = &S->V.File;
 
-        unsigned Len;
-
-        /* End of current line reached, read next line */
-        SB_Clear (&S->V.File.Line);
-        while (1) {
-
-            int N = fgetc (S->V.File.F);
-            if (N == EOF) {
-                /* End of file. Accept files without a newline at the end */
-                if (SB_NotEmpty (&S->V.File.Line)) {
-                    break;
-                }
-
-                /* No more data - add an empty line to the listing. This
-                ** is a small hack needed to keep the PC output in sync.
-                */
-                NewListingLine (&EmptyStrBuf, S->V.File.Pos.Name, FCount);
-                C = EOF;
-                return;
-
-            /* Check for end of line */
-            } else if (N == '\n') {
-
-                /* End of line */
-                break;
-
-            /* Collect other stuff */
-            } else {
+    /* Check for end of line, use the next line if needed. The newline
+    ** itself is returned at index LineLen.
+    */
+    if (I->LineIdx > I->LineLen) {
 
-                /* Append data to line */
-                SB_AppendChar (&S->V.File.Line, N);
+        const char* End;
+        StrBuf      Line = AUTO_STRBUF_INITIALIZER;
 
-            }
+        /* Check for end of file. Accept files without a newline at the end */
+        if (I->NextLine >= I->TextEnd) {
+            /* No more data - add an empty line to the listing. This
+            ** is a small hack needed to keep the PC output in sync.
+            */
+            NewListingLine (&EmptyStrBuf, I->Pos.Name, FCount);
+            C = EOF;
+            return;
         }
 
+        /* Search for the end of the line */
+        I->Line = I->NextLine;
+        End = memchr (I->Line, '\n', I->TextEnd - I->Line);
+        if (End) {
+            I->NextLine = End + 1;
+        } else {
+            I->NextLine = End = I->TextEnd;
+        }
 
-        /* If we come here, we have a new input line. To avoid problems
-        ** with strange line terminators, remove all whitespace from the
-        ** end of the line, then add a single newline.
+        /* To avoid problems with strange line terminators, ignore all
+        ** whitespace at the end of the line.
         */
-        Len = SB_GetLen (&S->V.File.Line);
-        while (Len > 0 && IsSpace (SB_AtUnchecked (&S->V.File.Line, Len-1))) {
-            --Len;
+        while (End > I->Line && IsSpace (End[-1])) {
+            --End;
         }
-        SB_Drop (&S->V.File.Line, SB_GetLen (&S->V.File.Line) - Len);
-        SB_AppendChar (&S->V.File.Line, '\n');
-
-        /* Terminate the string buffer */
-        SB_Terminate (&S->V.File.Line);
+        I->LineLen = End - I->Line;
+        I->LineIdx = 0;
 
         /* One more line */
-        S->V.File.Pos.Line++;
+        I->Pos.Line++;
 
         /* Remember the new line for the listing */
-        NewListingLine (&S->V.File.Line, S->V.File.Pos.Name, FCount);
+        Line.Buf = (char*) I->Line;
+        Line.Len = I->LineLen;
+        NewListingLine (&Line, I->Pos.Name, FCount);
 
     }
 
     /* Set the column pointer */
-    S->V.File.Pos.Col = SB_GetIndex (&S->V.File.Line);
+    I->Pos.Col = I->LineIdx;
 
-    /* Return the next character from the buffer */
-    C = SB_Get (&S->V.File.Line);
+    /* Return the next character from the line, then the newline */
+    if (I->LineIdx < I->LineLen) {
+        C = I->Line[I->LineIdx];
+    } else {
+        C = '\n';
+    }
+    ++I->LineIdx;
 }
 
 
@@ -460,13 +456,8 @@ void IFDone (CharSource* S)
         PopSearchPath (BinSearchPath);
     }
 
-    /* Free the line buffer */
-    SB_Done (&S->V.File.Line);
-
-    /* Close the input file and decrement the file count. We will ignore
-    ** errors here, since we were just reading from the file.
-    */
-    (void) fclose (S->V.File.F);
+    /* Free the file contents and decrement the file count */
+    xfree (S->V.File.Text);
     --FCount;
 }
 
@@ -481,6 +472,33 @@ static const CharSourceFunctions IFFunc = {
 
 
 
+static char* ReadInputFile (FILE* F, const char* Name, size_t Expected, size_t* Size)
+/* Read the complete contents of an input file into memory. Expected is the
+** size as reported by stat, which is used as a hint only. The actual number
+** of bytes read is returned in Size.
+*/
+{
+    size_t Allocated = Expected + 1;
+    char*  Text      = xmalloc (Allocated);
+    size_t N;
+
+    *Size = 0;
+    while ((N = fread (Text + *Size, 1, Allocated - *Size, F)) > 0) {
+        *Size += N;
+        if (*Size == Allocated) {
+            /* The file is larger than expected */
+            Allocated *= 2;
+            Text = xrealloc (Text, Allocated);
+        }
+    }
+    if (ferror (F)) {
+        Fatal ("Cannot read input file '%s': %s", Name, strerror (errno));
+    }
+    return Text;
+}
+
+
+
 int NewInputFile (const char* Name)
 /* Open a new input file. Returns true if the file could be successfully opened
 ** and false otherwise.
@@ -490,6 +508,7 @@ int NewInputFile (const char* Name)
     char*       PathName = 0;
     FILE*       F;
     struct stat Buf;
+    size_t      Size;
     StrBuf      NameBuf;                /* No need to initialize */
     StrBuf      Path = AUTO_STRBUF_INITIALIZER;
     unsigned    FileIdx;
@@ -537,14 +556,21 @@ int NewInputFile (const char* Name)
                        (FCount == 0)? FT_MAIN : FT_INCLUDE,
                        Buf.st_size, (unsigned long) Buf.st_mtime);
 
-    /* Create a new input source variable and initialize it */
+    /* Create a new input source variable and initialize it. The file is
+    ** read as a whole, the scanner works on the lines in memory.
+    */
     S                   = xmalloc (sizeof (*S));
     S->Func             = &IFFunc;
-    S->V.File.F         = F;
+    S->V.File.Text      = ReadInputFile (F, Name, Buf.st_size, &Size);
+    S->V.File.TextEnd   = S->V.File.Text + Size;
+    S->V.File.NextLine  = S->V.File.Text;
+    S->V.File.Line      = S->V.File.Text;
+    S->V.File.LineLen   = 0;
+    S->V.File.LineIdx   = 1;
     S->V.File.Pos.Line  = 0;
     S->V.File.Pos.Col   = 0;
     S->V.File.Pos.Name  = FileIdx;
-    SB_Init (&S->V.File.Line);
+    (void) fclose (F);
 
     /* Push the path for this file onto the include search lists */
     SB_CopyBuf (&Path, Name, FindName (Name) - Name);
@@ -41,6 +41,7 @@
 #include "alignment.h"
 #include "coll.h"
 #include "mmodel.h"
+#include "objwrite.h"
 #include "segdefs.h"
 #include "segnames.h"
 #include "xmalloc.h"
@@ -52,7 +53,6 @@
 #include "lineinfo.h"
 #include "listing.h"
 #include "objcode.h"
-#include "objfile.h"
 #include "segment.h"
 #include "span.h"
 #include "spool.h"
@@ -106,13 +106,15 @@ static Segment* NewSegFromDef (SegDef* Def)
     /* Initialize it */
     S->Root      = 0;
     S->Last      = 0;
-    S->FragCount = 0;
     S->Num       = CollCount (&SegmentList);
     S->Flags     = SEG_FLAG_NONE;
     S->Align     = 1;
     S->RelocMode = 1;
     S->PC        = 0;
     S->AbsPC     = 0;
+    S->PCRef     = 0;
+    S->Frags.Block = 0;
+    S->Frags.Avail = 0;
     S->Def       = Def;
 
     /* Insert it into the segment list */
@@ -147,7 +149,7 @@ Fragment* GenFragment (unsigned char Type, unsigned short Len)
 /* Generate a new fragment, add it to the current segment and return it. */
 {
     /* Create the new fragment */
-    Fragment* F = NewFragment (Type, Len);
+    Fragment* F = NewFragment (&ActiveSeg->Frags, Type, Len);
 
     /* Insert the fragment into the current segment */
     if (ActiveSeg->Root) {
@@ -156,7 +158,6 @@ Fragment* GenFragment (unsigned char Type, unsigned short Len)
     } else {
         ActiveSeg->Root = ActiveSeg->Last = F;
     }
-    ++ActiveSeg->FragCount;
 
     /* Add this fragment to the current listing line */
     if (LineCur) {
@@ -191,8 +192,9 @@ Fragment* GenFragment (unsigned char Type, unsigned short Len)
 void UseSeg (const SegDef* D)
 /* Use the segment with the given name */
 {
-    unsigned I;
-    for (I = 0; I < CollCount (&SegmentList); ++I) {
+    /* Search backwards, so we will find the last part of a split segment */
+    unsigned I = CollCount (&SegmentList);
+    while (I-- > 0) {
         Segment* Seg = CollAtUnchecked (&SegmentList, I);
         if (strcmp (Seg->Def->Name, D->Name) == 0) {
             /* We found this segment. Check if the type is identical */
@@ -217,6 +219,18 @@ void UseSeg (const SegDef* D)
 
 
 
+void SegSplit (void)
+/* Continue the active segment in a new section. The linker may change the
+** size of the data emitted so far without moving the labels that follow.
+*/
+{
+    Segment* S = NewSegFromDef (ActiveSeg->Def);
+    S->Flags = ActiveSeg->Flags | SEG_FLAG_CONTINUED;
+    ActiveSeg = S;
+}
+
+
+
 unsigned long GetPC (void)
 /* Get the program counter of the current segment */
 {
@@ -289,6 +303,20 @@ void SegAlign (unsigned long Alignment, int FillVal)
     unsigned long CombinedAlignment;
     unsigned long Count;
 
+    /* The start address of a continued part of a split segment depends on
+    ** the size of the preceding parts after relaxation. So start a new part
+    ** and leave the alignment to the linker.
+    */
+    if (ActiveSeg->Flags & SEG_FLAG_CONTINUED) {
+        if (FillVal != -1) {
+            Error ("Fill value not possible after a relaxable instruction");
+            FillVal = -1;
+        }
+        if (ActiveSeg->PC > 0) {
+            SegSplit ();
+        }
+    }
+
     /* The segment must have the combined alignment of all separate alignments
     ** in the source. Calculate this alignment and check it for sanity.
     */
@@ -352,6 +380,130 @@ unsigned char GetSegAddrSize (unsigned SegNum)
 
 
 
+const SegDef* GetSegDef (unsigned SegNum)
+/* Return the definition of the segment with the given number */
+{
+    /* Is there such a segment? */
+    if (SegNum >= CollCount (&SegmentList)) {
+        FAIL ("Invalid segment number");
+    }
+
+    /* Return the segment definition */
+    return ((const Segment*) CollAtUnchecked (&SegmentList, SegNum))->Def;
+}
+
+
+
+static int IsSplitSegmentDistance (const ObjExprDesc* ED)
+/* Return true if the expression is the distance between two locations in
+** the parts of a segment that was split by relaxable instructions.
+*/
+{
+    unsigned I;
+    long Count = 0;
+    const SegDef* Def = 0;
+
+    for (I = 0; I < ED->SymCount; ++I) {
+        if (ED->SymRef[I].Count != 0) {
+            return 0;
+        }
+    }
+    for (I = 0; I < ED->SecCount; ++I) {
+        if (ED->SecRef[I].Count != 0) {
+            const Segment* S = CollAtUnchecked (&SegmentList, ED->SecRef[I].Ref);
+            if (Def == 0) {
+                Def = S->Def;
+            } else if (S->Def != Def) {
+                return 0;
+            }
+            Count += ED->SecRef[I].Count;
+        }
+    }
+    return Def != 0 && Count == 0;
+}
+
+
+
+static int NextPartUsesPC (unsigned Index)
+/* Return true if '*' was used in the part that continues the segment with
+** the given index.
+*/
+{
+    const Segment* S = CollAtUnchecked (&SegmentList, Index);
+    while (++Index < CollCount (&SegmentList)) {
+        const Segment* Next = CollAtUnchecked (&SegmentList, Index);
+        if (Next->Def == S->Def) {
+            return Next->PCRef;
+        }
+    }
+    return 0;
+}
+
+
+
+static int SameLineInfo (const Fragment* F1, const Fragment* F2)
+/* Return true if both fragments have the same line infos */
+{
+    unsigned I;
+
+    if (CollCount (&F1->LI) != CollCount (&F2->LI)) {
+        return 0;
+    }
+    for (I = 0; I < CollCount (&F1->LI); ++I) {
+        if (CollConstAt (&F1->LI, I) != CollConstAt (&F2->LI, I)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+
+
+static int CanJoinLiterals (const Fragment* F, const Fragment* Next)
+/* Return true if F and the following fragment Next are both literals with
+** the same line infos, so they may be handled as one fragment.
+*/
+{
+    return F->Type == FRAG_LITERAL && Next->Type == FRAG_LITERAL &&
+           SameLineInfo (F, Next);
+}
+
+
+
+static int MergeLiteral (Segment* S, Fragment* F)
+/* Try to append the data of the fragment following F to F. This is possible
+** if the data fits and both fragments belong to the same listing line.
+** Return true if the fragments were merged.
+*/
+{
+    Fragment* Next = F->Next;
+
+    if (Next == 0                                               ||
+        !CanJoinLiterals (F, Next)                              ||
+        F->Len + Next->Len > sizeof (F->V.Data)                 ||
+        (SB_GetLen (&ListingName) > 0 && F->LineList != Next)) {
+        return 0;
+    }
+
+    /* Move the data over */
+    memcpy (F->V.Data + F->Len, Next->V.Data, Next->Len);
+    F->Len += Next->Len;
+
+    /* Remove Next from the segment and the listing line */
+    F->Next     = Next->Next;
+    F->LineList = Next->LineList;
+    if (S->Last == Next) {
+        S->Last = F;
+    }
+    ReleaseFullLineInfo (&Next->LI);
+    DoneCollection (&Next->LI);
+
+    /* Fragments were merged */
+    return 1;
+}
+
+
+
 void SegDone (void)
 /* Check the segments for range and other errors. Do cleanup. */
 {
@@ -365,17 +517,18 @@ void SegDone (void)
     unsigned I;
     for (I = 0; I < CollCount (&SegmentList); ++I) {
         Segment* S = CollAtUnchecked (&SegmentList, I);
+        Fragment* Prev = 0;
         Fragment* F = S->Root;
         while (F) {
             if (F->Type == FRAG_EXPR || F->Type == FRAG_SEXPR) {
 
                 /* We have an expression, study it */
-                ExprDesc ED;
-                ED_Init (&ED);
+                ObjExprDesc ED;
+                OED_Init (&ED);
                 StudyExpr (F->V.Expr, &ED);
 
                 /* Check if the expression is constant */
-                if (ED_IsConst (&ED)) {
+                if (OED_IsConst (&ED)) {
 
                     unsigned J;
 
@@ -407,12 +560,13 @@ void SegDone (void)
                     }
                     F->Type = FRAG_LITERAL;
 
-                } else if (RelaxChecks == 0) {
+                } else if (RelaxChecks == 0 && !IsSplitSegmentDistance (&ED)) {
 
                     /* We cannot evaluate the expression now, leave the job for
                     ** the linker. However, we can check if the address size
                     ** matches the fragment size. Mismatches are errors in
-                    ** most situations.
+                    ** most situations. Distances within a split segment are
+                    ** range checked by the linker.
                     */
                     if ((F->Len == 1 && ED.AddrSize > ADDR_SIZE_ZP)  ||
                         (F->Len == 2 && ED.AddrSize > ADDR_SIZE_ABS) ||
@@ -422,9 +576,40 @@ void SegDone (void)
                 }
 
                 /* Release memory allocated for the expression decriptor */
-                ED_Done (&ED);
+                OED_Done (&ED);
+
+            } else if (F->Type == FRAG_RELAX) {
+
+                /* If the operand turned out to be constant, there's nothing
+                ** left to do for the linker.
+                */
+                long Val;
+                if (IsConstExpr (F->V.Relax.Expr, &Val)) {
+                    if (!IsWordRange (Val)) {
+                        LIError (&F->LI,
+                                 "Range error (%ld not in [0..65535])", Val);
+                    }
+                    FreeExpr (F->V.Relax.Expr);
+                    F->V.Data[0] = F->V.Relax.OPC;
+                    F->V.Data[1] = (unsigned char) Val;
+                    F->V.Data[2] = (unsigned char) (Val >> 8);
+                    F->Type = FRAG_LITERAL;
+                } else if (S->PCRef || NextPartUsesPC (I)) {
+                    /* Something like "bcs *+5" may jump over the instruction.
+                    ** The distance is constant, so the instruction must keep
+                    ** its size.
+                    */
+                    F->V.Relax.Kind |= RELAX_FIXED;
+                }
             }
-            F = F->Next;
+
+            /* Try to append the fragment to the previous one if both are
+            ** literals, so there are less fragments to list and to write.
+            */
+            if (Prev == 0 || !MergeLiteral (S, Prev)) {
+                Prev = F;
+            }
+            F = Prev->Next;
         }
     }
 }
@@ -460,6 +645,11 @@ void SegDump (void)
                 State = 1;
                 printf ("\n  Expression (%u): ", F->Len);
                 DumpExpr (F->V.Expr, SymResolve);
+            } else if (F->Type == FRAG_RELAX) {
+                State = 1;
+                printf ("\n  Relaxable %02X/%02X (%u): ",
+                        F->V.Relax.OPC, F->V.Relax.ShortOPC, F->Len);
+                DumpExpr (F->V.Relax.Expr, SymResolve);
             } else if (F->Type == FRAG_FILL) {
                 State = 1;
                 printf ("\n  Fill bytes (%u)", F->Len);
@@ -526,6 +716,9 @@ static void WriteOneSeg (Segment* Seg)
 /* Write one segment to the object file */
 {
     Fragment* Frag;
+    Fragment* Last;
+    unsigned long Len;
+    unsigned long FragCount;
     unsigned long DataSize;
     unsigned long EndPos;
 
@@ -541,7 +734,18 @@ static void WriteOneSeg (Segment* Seg)
     ObjWriteVar (Seg->PC);                      /* Size */
     ObjWriteVar (Seg->Align);                   /* Segment alignment */
     ObjWrite8 (Seg->Def->AddrSize);             /* Address size of the segment */
-    ObjWriteVar (Seg->FragCount);               /* Number of fragments */
+
+    /* Count the fragments. A run of literal fragments with the same line
+    ** infos is written as one fragment, since the linker needn't know where
+    ** the assembler split the data.
+    */
+    FragCount = 0;
+    for (Frag = Seg->Root; Frag; Frag = Frag->Next) {
+        if (Frag->Next == 0 || !CanJoinLiterals (Frag, Frag->Next)) {
+            ++FragCount;
+        }
+    }
+    ObjWriteVar (FragCount);                    /* Number of fragments */
 
     /* Now walk through the fragment list for this segment and write the
     ** fragments.
@@ -553,9 +757,22 @@ static void WriteOneSeg (Segment* Seg)
         switch (Frag->Type) {
 
             case FRAG_LITERAL:
+                /* Determine the run of literals to write as one */
+                Last = Frag;
+                Len  = Frag->Len;
+                while (Last->Next && CanJoinLiterals (Last, Last->Next)) {
+                    Last = Last->Next;
+                    Len += Last->Len;
+                }
                 ObjWrite8 (FRAG_LITERAL);
-                ObjWriteVar (Frag->Len);
-                ObjWriteData (Frag->V.Data, Frag->Len);
+                ObjWriteVar (Len);
+                while (1) {
+                    ObjWriteData (Frag->V.Data, Frag->Len);
+                    if (Frag == Last) {
+                        break;
+                    }
+                    Frag = Frag->Next;
+                }
                 break;
 
             case FRAG_EXPR:
@@ -580,6 +797,14 @@ static void WriteOneSeg (Segment* Seg)
                 WriteExpr (Frag->V.Expr);
                 break;
 
+            case FRAG_RELAX:
+                ObjWrite8 (FRAG_RELAX);
+                ObjWrite8 (Frag->V.Relax.Kind);
+                ObjWrite8 (Frag->V.Relax.OPC);
+                ObjWrite8 (Frag->V.Relax.ShortOPC);
+                WriteExpr (Frag->V.Relax.Expr);
+                break;
+
             case FRAG_FILL:
                 ObjWrite8 (FRAG_FILL);
                 ObjWriteVar (Frag->Len);
@@ -60,7 +60,6 @@ typedef struct Segment Segment;
 struct Segment {
     Fragment*       Root;               /* Root of fragment list */
     Fragment*       Last;               /* Pointer to last fragment */
-    unsigned long   FragCount;          /* Number of fragments */
     unsigned        Num;                /* Segment number */
     unsigned        Flags;              /* Segment flags */
     unsigned long   Align;              /* Segment alignment */
@@ -68,6 +67,8 @@ struct Segment {
     unsigned long   PC;                 /* PC if in relocatable mode */
     unsigned long   AbsPC;              /* PC if in local absolute mode */
                                         /* (OrgPerSeg is true) */
+    int             PCRef;              /* True if '*' was used in this part */
+    FragArena       Frags;              /* Storage for the fragments */
     SegDef*         Def;                /* Segment definition (name and type) */
 };
 
@@ -99,6 +100,11 @@ Fragment* GenFragment (unsigned char Type, unsigned short Len);
 void UseSeg (const SegDef* D);
 /* Use the given segment */
 
+void SegSplit (void);
+/* Continue the active segment in a new section. The linker may change the
+** size of the data emitted so far without moving the labels that follow.
+*/
+
 #if defined(HAVE_INLINE)
 INLINE const SegDef* GetCurrentSegDef (void)
 /* Get a pointer to the segment defininition of the current segment */
@@ -138,6 +144,9 @@ void SegAlign (unsigned long Alignment, int FillVal);
 unsigned char GetSegAddrSize (unsigned SegNum);
 /* Return the address size of the segment with the given number */
 
+const SegDef* GetSegDef (unsigned SegNum);
+/* Return the definition of the segment with the given number */
+
 unsigned long GetPC (void);
 /* Get the program counter of the current segment */
 
@@ -40,35 +40,12 @@
 
 /* common */
 #include "coll.h"
-#include "gentype.h"
-#include "hashtab.h"
 #include "inline.h"
+#include "objspan.h"
 #include "strbuf.h"
 
 
 
-/*****************************************************************************/
-/*                                   Data                                    */
-/*****************************************************************************/
-
-
-
-/* Forwards */
-struct Segment;
-
-/* Span definition */
-typedef struct Span Span;
-struct Span{
-    HashNode        Node;               /* Node for hash table */
-    unsigned        Id;                 /* Id of span */
-    struct Segment* Seg;                /* Pointer to segment */
-    unsigned        Start;              /* Start of range */
-    unsigned        End;                /* End of range */
-    unsigned        Type;               /* Type of data in span */
-};
-
-
-
 /*****************************************************************************/
 /*                                   Code                                    */
 /*****************************************************************************/
@@ -76,7 +53,7 @@ struct Span{
 
 
 #if defined(HAVE_INLINE)
-INLINE unsigned long GetSpanSize (const Span* R)
+INLINE unsigned long GetSpanSize (const ObjSpan* R)
 /* Return the span size in bytes */
 {
     return (R->End - R->Start);
@@ -85,13 +62,13 @@ INLINE unsigned long GetSpanSize (const Span* R)
 #  define GetSpanSize(R)   ((R)->End - (R)->Start)
 #endif
 
-void SetSpanType (Span* S, const StrBuf* Type);
+void SetSpanType (ObjSpan* S, const StrBuf* Type);
 /* Set the generic type of the span to Type */
 
-Span* OpenSpan (void);
+ObjSpan* OpenSpan (void);
 /* Open a span for the active segment and return it. */
 
-Span* CloseSpan (Span* S);
+ObjSpan* CloseSpan (ObjSpan* S);
 /* Close the given span. Be sure to replace the passed span by the one
 ** returned, since the span will get deleted if it is empty or may be
 ** replaced if a duplicate exists.
@@ -106,13 +83,6 @@ void OpenSpanList (Collection* Spans);
 void CloseSpanList (Collection* Spans);
 /* Close all open spans by setting PC to the current PC for the segment. */
 
-void WriteSpanList (const Collection* Spans);
-/* Write a list of spans to the output file */
-
-void WriteSpans (void);
-/* Write all spans to the object file */
-
-
 
 /* End of span.h */
 
@@ -33,8 +33,10 @@
 
 
 
+/* common */
+#include "objwrite.h"
+
 /* ca65 */
-#include "objfile.h"
 #include "spool.h"
 
 
@@ -58,24 +60,7 @@ StringPool* StrPool = 0;
 void WriteStrPool (void)
 /* Write the string pool to the object file */
 {
-    unsigned I;
-
-    /* Get the number of strings in the string pool */
-    unsigned Count = SP_GetCount (StrPool);
-
-    /* Tell the object file module that we're about to start the string pool */
-    ObjStartStrPool ();
-
-    /* Write the string count to the list */
-    ObjWriteVar (Count);
-
-    /* Write the strings in id order */
-    for (I = 0; I < Count; ++I) {
-        ObjWriteBuf (SP_Get (StrPool, I));
-    }
-
-    /* Done writing the string pool */
-    ObjEndStrPool ();
+    ObjWriteStrPool (StrPool);
 }
 
 
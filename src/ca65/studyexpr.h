@@ -39,7 +39,7 @@
                                             
 
 /* common */
-#include "exprdefs.h"
+#include "objexprdesc.h"
 
 
 
@@ -49,60 +49,8 @@
 
 
 
-/* Flags */
-#define ED_OK           0x00            /* Nothing special */
-#define ED_TOO_COMPLEX  0x01            /* Expression is too complex */
-#define ED_ERROR        0x02            /* Error evaluating the expression */
-
-/* Symbol reference */
-typedef struct ED_SymRef ED_SymRef;
-struct ED_SymRef {
-    long                Count;          /* Number of references */
-    struct SymEntry*    Ref;            /* Actual reference */
-};
-
-/* Section reference */
-typedef struct ED_SecRef ED_SecRef;
-struct ED_SecRef {
-    long                Count;          /* Number of references */
-    unsigned            Ref;            /* Actual reference */
-};
-
-/* Structure for parsing expression trees */
-typedef struct ExprDesc ExprDesc;
-struct ExprDesc {
-    unsigned short      Flags;          /* See ED_xxx */
-    unsigned char       AddrSize;       /* Address size of the expression */
-    long                Val;            /* The offset value */
-    long                Right;          /* Right value for StudyBinaryExpr */
-
-    /* Symbol reference management */
-    unsigned            SymCount;       /* Number of symbols referenced */
-    unsigned            SymLimit;       /* Memory allocated */
-    ED_SymRef*          SymRef;         /* Symbol references */
-
-    /* Section reference management */
-    unsigned            SecCount;       /* Number of sections referenced */
-    unsigned            SecLimit;       /* Memory allocated */
-    ED_SecRef*          SecRef;         /* Section references */
-};
-
-
-
-/*****************************************************************************/
-/*                              struct ExprDesc                              */
-/*****************************************************************************/
-
-
-
-ExprDesc* ED_Init (ExprDesc* ED);
-/* Initialize an ExprDesc structure for use with StudyExpr */
-
-void ED_Done (ExprDesc* ED);
-/* Delete allocated memory for an ExprDesc. */
-
-int ED_IsConst (const ExprDesc* ED);
-/* Return true if the expression is constant */
+/* Forwards */
+struct SymEntry;
 
 
 
@@ -112,9 +60,14 @@ int ED_IsConst (const ExprDesc* ED);
 
 
 
-void StudyExpr (ExprNode* Expr, ExprDesc* D);
+void StudyExpr (ExprNode* Expr, ObjExprDesc* D);
 /* Study an expression tree and place the contents into D */
 
+void StudyInvalidate (struct SymEntry* S);
+/* Must be called before the value, type or address size of S is changed.
+** Discards cached study results that may depend on S.
+*/
+
 
 
 /* End of studyexpr.h */
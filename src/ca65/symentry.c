@@ -98,6 +98,8 @@ SymEntry* NewSymEntry (const StrBuf* Name, unsigned Flags)
     S->ExportId   = ~0U;
     S->Expr       = 0;
     S->ExprRefs   = AUTO_COLLECTION_INITIALIZER;
+    S->Study      = 0;
+    S->StudyGen   = 0;
     S->ExportSize = ADDR_SIZE_DEFAULT;
     S->AddrSize   = ADDR_SIZE_DEFAULT;
     memset (S->ConDesPrio, 0, sizeof (S->ConDesPrio));
@@ -155,6 +157,9 @@ void SymTransferExprRefs (SymEntry* From, SymEntry* To)
 {
     unsigned I;
 
+    /* The expressions will change, so forget what we know about them */
+    StudyInvalidate (From);
+
     for (I = 0; I < CollCount (&From->ExprRefs); ++I) {
 
         /* Get the expression node */
@@ -244,14 +249,17 @@ void SymDef (SymEntry* S, ExprNode* Expr, unsigned char AddrSize, unsigned Flags
     /* Map a default address size to a real value */
     if (AddrSize == ADDR_SIZE_DEFAULT) {
         /* ### Must go! Delay address size calculation until end of assembly! */
-        ExprDesc ED;
-        ED_Init (&ED);
+        ObjExprDesc ED;
+        OED_Init (&ED);
         StudyExpr (Expr, &ED);
         AddrSize = ED.AddrSize;
-        ED_Done (&ED);
+        OED_Done (&ED);
     }
 
-    /* Set the symbol value */
+    /* Set the symbol value. Cached study results that include the old value
+    ** are no longer valid.
+    */
+    StudyInvalidate (S);
     S->Expr = Expr;
 
     /* In case of a variable symbol, walk over all expressions containing
@@ -351,6 +359,7 @@ void SymImport (SymEntry* S, unsigned char AddrSize, unsigned Flags)
     }
 
     /* Set the symbol data */
+    StudyInvalidate (S);
     S->Flags |= (SF_IMPORT | Flags);
     S->AddrSize = AddrSize;
 
@@ -504,6 +513,7 @@ void SymGlobal (SymEntry* S, unsigned char AddrSize, unsigned Flags)
         ** remember two different address sizes: One for an import in AddrSize,
         ** and the other one for an export in ExportSize.
         */
+        StudyInvalidate (S);
         S->AddrSize = AddrSize;
         if (S->AddrSize == ADDR_SIZE_DEFAULT) {
             /* Use the size of the current segment */
@@ -633,6 +643,7 @@ void SymImportFromGlobal (SymEntry* S)
 */
 {
     /* Remove the global flag and make it an import */
+    StudyInvalidate (S);
     S->Flags &= ~SF_GLOBAL;
     S->Flags |= SF_IMPORT;
 }
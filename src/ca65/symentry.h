@@ -57,6 +57,7 @@
 
 
 /* Forwards */
+struct ObjExprDesc;
 struct HLLDbgSym;
 
 /* Bits for the Flags value in SymEntry */
@@ -104,6 +105,8 @@ struct SymEntry {
     unsigned            ExportId;       /* Id of export if this is one */
     struct ExprNode*    Expr;           /* Symbol expression */
     Collection          ExprRefs;       /* Expressions using this symbol */
+    struct ObjExprDesc* Study;          /* Cached study of Expr or NULL */
+    unsigned long       StudyGen;       /* Cache generation of Study */
     unsigned char       ExportSize;     /* Export address size */
     unsigned char       AddrSize;       /* Address size of label */
     unsigned char       ConDesPrio[CD_TYPE_COUNT];      /* ConDes priorities... */
@@ -40,6 +40,7 @@
 #include "check.h"
 #include "hashfunc.h"
 #include "mmodel.h"
+#include "objwrite.h"
 #include "scopedefs.h"
 #include "symdefs.h"
 #include "xmalloc.h"
@@ -49,7 +50,7 @@
 #include "error.h"
 #include "expr.h"
 #include "global.h"
-#include "objfile.h"
+#include "precomp.h"
 #include "scanner.h"
 #include "segment.h"
 #include "sizeof.h"
@@ -258,8 +259,19 @@ void SymLeaveLevel (void)
     ** this symbol, too.
     */
     if (CollCount (&CurrentScope->Spans) > 0) {
-        const Span* S = CollAtUnchecked (&CurrentScope->Spans, 0);
+        unsigned I;
+        const ObjSpan* S = CollAtUnchecked (&CurrentScope->Spans, 0);
         unsigned long Size = GetSpanSize (S);
+
+        /* If relaxable instructions have split the segment, add the sizes
+        ** of the other parts.
+        */
+        for (I = 1; I < CollCount (&CurrentScope->Spans); ++I) {
+            const ObjSpan* P = CollAtUnchecked (&CurrentScope->Spans, I);
+            if (GetSegDef (P->Seg) == GetSegDef (S->Seg)) {
+                Size += GetSpanSize (P);
+            }
+        }
         DefSizeOfScope (CurrentScope, Size);
         if (CurrentScope->Label) {
             DefSizeOfSymbol (CurrentScope->Label, Size);
@@ -291,6 +303,11 @@ SymTable* SymFindScope (SymTable* Parent, const StrBuf* Name, SymFindAction Acti
         }
     }
 
+    /* A precompiled include depends on the names it did not find */
+    if (Precompile && Parent == RootScope) {
+        PrecompRefScope (Name);
+    }
+
     /* Create a new scope if requested and we didn't find one */
     if (*T == 0 && (Action & SYM_ALLOC_NEW) != 0) {
         *T = NewSymTable (Parent, Name);
@@ -388,6 +405,11 @@ SymEntry* SymFind (SymTable* Scope, const StrBuf* Name, SymFindAction Action)
     /* Search for the entry */
     int Cmp = SymSearchTree (Scope->Table[Hash], Name, &S);
 
+    /* A precompiled include depends on the global symbols it uses */
+    if (Precompile && Scope == RootScope) {
+        PrecompRefSym (Name, (Cmp == 0)? S : 0);
+    }
+
     /* If we found an entry, return it */
     if (Cmp == 0) {
         if ((Action & SYM_CHECK_ONLY) == 0 && SymTabIsClosed (Scope)) {
@@ -441,18 +463,17 @@ SymEntry* SymFindAny (SymTable* Scope, const StrBuf* Name)
         ** because for such symbols there is a real entry in one of the parent
         ** scopes.
         */
-        if (SymSearchTree (Scope->Table[Hash % Scope->TableSlots], Name, &Sym) == 0) {
-            if (Sym->Flags & SF_UNUSED) {
-                Sym = 0;
-            } else {
-                /* Found, return it */
-                break;
-            }
-        } else {
+        if (SymSearchTree (Scope->Table[Hash % Scope->TableSlots], Name, &Sym) != 0 ||
+            (Sym->Flags & SF_UNUSED) != 0) {
             Sym = 0;
         }
 
-        /* Not found, search in the parent scope, if we have one */
+        /* A precompiled include depends on the global symbols it uses */
+        if (Precompile && Scope == RootScope) {
+            PrecompRefSym (Name, Sym);
+        }
+
+        /* If not found, search in the parent scope, if we have one */
         Scope = Scope->Parent;
 
     } while (Sym == 0 && Scope != 0);
@@ -546,6 +567,7 @@ static void SymCheckUndefined (SymEntry* S)
         } else {
             if (AutoImport) {
                 /* Mark as import, will be indexed later */
+                StudyInvalidate (S);
                 S->Flags |= SF_IMPORT;
                 /* Use the address size for code */
                 S->AddrSize = CodeAddrSize;
@@ -642,9 +664,10 @@ void SymCheck (void)
             ** recalculate it.
             */
             if (SymHasExpr (S) && S->AddrSize == ADDR_SIZE_DEFAULT) {
-                ExprDesc ED;
-                ED_Init (&ED);
+                ObjExprDesc ED;
+                OED_Init (&ED);
                 StudyExpr (S->Expr, &ED);
+                StudyInvalidate (S);
                 S->AddrSize = ED.AddrSize;
                 if (SymIsExport (S)) {
                     if (S->ExportSize == ADDR_SIZE_DEFAULT) {
@@ -659,7 +682,7 @@ void SymCheck (void)
                                    AddrSizeToStr (S->ExportSize));
                     }
                 }
-                ED_Done (&ED);
+                OED_Done (&ED);
             }
 
             /* If the address size of the symbol was guessed, check the guess
@@ -961,7 +984,7 @@ void WriteScopes (void)
             /* Check if this scope has a size. If so, remember it in the
             ** flags.
             */
-            long Size;
+            long Size = 0;
             SymEntry* SizeSym = FindSizeOfScope (S);
             if (SizeSym != 0 && SymIsConst (SizeSym, &Size)) {
                 Flags |= SCOPE_SIZE;
@@ -975,37 +998,10 @@ void WriteScopes (void)
             /* Scope must be defined */
             CHECK (S->Type != SCOPE_UNDEF);
 
-            /* Id of parent scope */
-            if (S->Parent) {
-                ObjWriteVar (S->Parent->Id);
-            } else {
-                ObjWriteVar (0);
-            }
-
-            /* Lexical level */
-            ObjWriteVar (S->Level);
-
-            /* Scope flags */
-            ObjWriteVar (Flags);
-
-            /* Type of scope */
-            ObjWriteVar (S->Type);
-
-            /* Name of the scope */
-            ObjWriteVar (S->Name);
-
-            /* If the scope has a size, write it to the file */
-            if (SCOPE_HAS_SIZE (Flags)) {
-                ObjWriteVar (Size);
-            }
-
-            /* If the scope has a label, write its id to the file */
-            if (SCOPE_HAS_LABEL (Flags)) {
-                ObjWriteVar (S->Label->DebugSymId);
-            }
-
-            /* Spans for this scope */
-            WriteSpanList (&S->Spans);
+            /* Write the scope with the id of its parent */
+            WriteObjScope (S->Parent? S->Parent->Id : 0, S->Level, Flags,
+                           S->Type, S->Name, Size,
+                           S->Label? S->Label->DebugSymId : 0, &S->Spans);
 
             /* Next scope */
             S = S->Next;
@@ -53,6 +53,9 @@
 
 static const char AnonTag[] = "$anon";
 
+/* Counter for anonymous names */
+static unsigned ACount = 0;
+
 
 
 /*****************************************************************************/
@@ -77,13 +80,30 @@ char* AnonName (char* Buf, const char* Spec)
 ** to be IDENTSIZE characters long. A pointer to the buffer is returned.
 */
 {
-    static unsigned ACount = 0;
     xsprintf (Buf, IDENTSIZE, "%s-%s-%04X", AnonTag, Spec, ++ACount);
     return Buf;
 }
 
 
 
+unsigned GetAnonNameCount (void)
+/* Return the number of anonymous names created so far */
+{
+    return ACount;
+}
+
+
+
+void SetAnonNameCount (unsigned Count)
+/* Set the number of anonymous names created so far. Used when loading a
+** precompiled header.
+*/
+{
+    ACount = Count;
+}
+
+
+
 int IsAnonName (const char* Name)
 /* Check if the given symbol name is that of an anonymous symbol */
 {
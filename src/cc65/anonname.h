@@ -54,6 +54,14 @@ char* AnonName (char* Buf, const char* Spec);
 ** to be IDENTSIZE characters long. A pointer to the buffer is returned.
 */
 
+unsigned GetAnonNameCount (void);
+/* Return the number of anonymous names created so far */
+
+void SetAnonNameCount (unsigned Count);
+/* Set the number of anonymous names created so far. Used when loading a
+** precompiled header.
+*/
+
 int IsAnonName (const char* Name);
 /* Check if the given symbol name is that of an anonymous symbol */
 
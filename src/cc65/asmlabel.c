@@ -54,6 +54,9 @@
 
 static struct Segments* CurrentFunctionSegment;
 
+/* Number to generate unique literal labels */
+static unsigned NextLiteralLabel = 0;
+
 
 
 /*****************************************************************************/
@@ -150,16 +153,31 @@ const char* LocalDataLabelName (unsigned L)
 unsigned GetPooledLiteralLabel (void)
 /* Get an unused literal label. Will never return zero. */
 {
-    /* Number to generate unique labels */
-    static unsigned NextLabel = 0;
-
     /* Check for an overflow */
-    if (NextLabel >= 0xFFFF) {
+    if (NextLiteralLabel >= 0xFFFF) {
         Internal ("Literal label overflow");
     }
 
     /* Return the next label */
-    return ++NextLabel;
+    return ++NextLiteralLabel;
+}
+
+
+
+unsigned GetPooledLiteralLabelCount (void)
+/* Return the number of literal labels used so far */
+{
+    return NextLiteralLabel;
+}
+
+
+
+void SetPooledLiteralLabelCount (unsigned Count)
+/* Set the number of literal labels used so far. Used when loading a
+** precompiled header.
+*/
+{
+    NextLiteralLabel = Count;
 }
 
 
@@ -80,6 +80,14 @@ const char* LocalDataLabelName (unsigned L);
 unsigned GetPooledLiteralLabel (void);
 /* Get an unused literal label. Will never return zero. */
 
+unsigned GetPooledLiteralLabelCount (void);
+/* Return the number of literal labels used so far */
+
+void SetPooledLiteralLabelCount (unsigned Count);
+/* Set the number of literal labels used so far. Used when loading a
+** precompiled header.
+*/
+
 const char* PooledLiteralLabelName (unsigned L);
 /* Make a litral label name from the given label number. The label name will be
 ** created in static storage and overwritten when calling the function again.
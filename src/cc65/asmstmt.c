@@ -40,6 +40,7 @@
 
 /* cc65 */
 #include "asmlabel.h"
+#include "callgraph.h"
 #include "codegen.h"
 #include "codeseg.h"
 #include "datatype.h"
@@ -224,6 +225,11 @@ static void ParseGVarArg (StrBuf* T, unsigned Arg)
         return;
     }
 
+    /* The code may call a function or take its address */
+    if (Sym->Flags & SC_FUNC) {
+        CG_FuncRef (Sym);
+    }
+
     /* Check for external linkage */
     if (Sym->Flags & (SC_EXTERN | SC_STORAGE | SC_FUNC)) {
         /* External linkage or a function */
@@ -420,6 +426,9 @@ void AsmStatement (void)
     /* Skip the ASM */
     NextToken ();
 
+    /* We cannot tell what the code does, so keep it out of the call graph */
+    CG_AsmStatement ();
+
     /* An optional volatile qualifier disables optimization for
     ** the entire function [same as #pragma optimize(push, off)].
     */
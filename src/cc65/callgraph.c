@@ -0,0 +1,661 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                callgraph.c                                */
+/*                                                                           */
+/*                     Call graph and static stack frames                    */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#include <errno.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+/* common */
+#include "attrib.h"
+#include "coll.h"
+#include "xmalloc.h"
+#include "xsprintf.h"
+
+/* cc65 */
+#include "callgraph.h"
+#include "codegen.h"
+#include "error.h"
+#include "function.h"
+#include "global.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* The call graph file is a text file with one record per line, so the files
+** of all translation units of a program may just be concatenated:
+**
+**      unit <name>                     Start of a translation unit
+**      func <name> <static> <frame> <size>
+**                                      Function definition
+**      call <caller> <callee>          Call, callee is '*' for pointers
+**      addr <name>                     Address of a function is taken
+**      regs <name> <use> <chg>         Registers used and changed by an
+**                                      external function (hex masks)
+**
+** The names are assembler names. Names of static functions are only known
+** within their unit.
+*/
+
+/* Function flags */
+#define CGF_STATIC      0x01U           /* Function has internal linkage */
+#define CGF_CANFRAME    0x02U           /* Function may use a static frame */
+#define CGF_ADDR        0x04U           /* Address of function is taken */
+#define CGF_FRAME       0x08U           /* Function uses a static frame */
+#define CGF_ONSTACK     0x10U           /* Function is on the search stack */
+#define CGF_REGS        0x20U           /* RegUse and RegChg are valid */
+
+/* A function in the call graph of the program */
+typedef struct CGFunc CGFunc;
+struct CGFunc {
+    char*       Name;                   /* Assembler name */
+    unsigned    Unit;                   /* Index of the translation unit */
+    unsigned    Flags;                  /* Flags, see above */
+    unsigned    FrameSize;              /* Size of parameters and locals */
+    Collection  Calls;                  /* Called functions */
+    unsigned    Index;                  /* Search index, zero if not visited */
+    unsigned    Low;                    /* Lowest index reachable */
+    unsigned    Offs;                   /* Offset of the frame */
+    unsigned    High;                   /* End of all frames reachable */
+    unsigned    RegUse;                 /* Registers used by the function */
+    unsigned    RegChg;                 /* Registers changed by the function */
+};
+
+/* A call in the call graph file, resolved after all units are read */
+typedef struct CGCall CGCall;
+struct CGCall {
+    unsigned    Unit;                   /* Index of the translation unit */
+    char*       Caller;                 /* Name of the caller */
+    char*       Callee;                 /* Name of the callee or "*" */
+};
+
+/* A function reference while recording */
+typedef struct CGRef CGRef;
+struct CGRef {
+    const char* Name;                   /* Assembler name */
+    int         Count;                  /* References not used for calls */
+};
+
+/* Name of the translation unit */
+static const char* UnitName     = 0;
+
+/* The program call graph read from --static-frames */
+static Collection   Funcs       = STATIC_COLLECTION_INITIALIZER;
+static CGFunc       IndirectNode;       /* Unknown code, called via pointers */
+static unsigned     Unit        = ~0U;  /* Index of this unit in the graph */
+static unsigned     FrameArea   = 0;    /* Size of the frame area */
+static int          FramesUsed  = 0;    /* This unit uses the frame area */
+
+/* Recording for --call-graph */
+static int          Recording   = 0;    /* True if recording */
+static Collection   Lines       = STATIC_COLLECTION_INITIALIZER;
+static Collection   Refs        = STATIC_COLLECTION_INITIALIZER;
+static Collection   OpenCalls   = STATIC_COLLECTION_INITIALIZER;
+static int          CanFrame    = 0;    /* Current function may use a frame */
+
+/* Search state */
+static unsigned     SearchIndex = 0;
+static Collection   SearchStack = STATIC_COLLECTION_INITIALIZER;
+
+
+
+/*****************************************************************************/
+/*                              Helper functions                             */
+/*****************************************************************************/
+
+
+
+static const char* FuncName (const SymEntry* Func)
+/* Return the assembler name of a function */
+{
+    return Func->AsmName? Func->AsmName : Func->Name;
+}
+
+
+
+static int IsStaticFunc (const SymEntry* Func)
+/* Return true if the function has internal linkage */
+{
+    return (Func->Flags & SC_EXTERN) == 0;
+}
+
+
+
+static void AddLine (const char* Format, ...) attribute ((format (printf, 1, 2)));
+static void AddLine (const char* Format, ...)
+/* Add a line to the recorded call graph */
+{
+    char Buf[512];
+    va_list ap;
+    va_start (ap, Format);
+    xvsprintf (Buf, sizeof (Buf), Format, ap);
+    va_end (ap);
+    CollAppend (&Lines, xstrdup (Buf));
+}
+
+
+
+static CGRef* GetRef (const char* Name)
+/* Return the reference counter for a function, create one if needed */
+{
+    CGRef* R;
+    unsigned I;
+    for (I = 0; I < CollCount (&Refs); ++I) {
+        R = CollAtUnchecked (&Refs, I);
+        if (strcmp (R->Name, Name) == 0) {
+            return R;
+        }
+    }
+    R = xmalloc (sizeof (CGRef));
+    R->Name  = Name;
+    R->Count = 0;
+    CollAppend (&Refs, R);
+    return R;
+}
+
+
+
+static CGFunc* FindFunc (unsigned U, const char* Name)
+/* Find a function as seen from unit U. A static function of the unit hides
+** the external function with the same name. Return NULL if the function is
+** not part of the program.
+*/
+{
+    CGFunc* Extern = 0;
+    unsigned I;
+    for (I = 0; I < CollCount (&Funcs); ++I) {
+        CGFunc* F = CollAtUnchecked (&Funcs, I);
+        if (strcmp (F->Name, Name) == 0) {
+            if ((F->Flags & CGF_STATIC) == 0) {
+                if (Extern == 0) {
+                    Extern = F;
+                }
+            } else if (F->Unit == U) {
+                return F;
+            }
+        }
+    }
+    return Extern;
+}
+
+
+
+static void Search (CGFunc* F)
+/* Search the call graph starting at F for cycles and assign the frames. This
+** is Tarjan's algorithm for strongly connected components, which completes
+** all callees before their callers.
+*/
+{
+    unsigned I;
+    unsigned Base;
+    unsigned Start;
+    int      Cycle;
+
+    F->Index = F->Low = ++SearchIndex;
+    F->Flags |= CGF_ONSTACK;
+    Start = CollCount (&SearchStack);
+    CollAppend (&SearchStack, F);
+
+    for (I = 0; I < CollCount (&F->Calls); ++I) {
+        CGFunc* C = CollAtUnchecked (&F->Calls, I);
+        if (C->Index == 0) {
+            Search (C);
+            if (C->Low < F->Low) {
+                F->Low = C->Low;
+            }
+        } else if ((C->Flags & CGF_ONSTACK) != 0 && C->Index < F->Low) {
+            F->Low = C->Index;
+        }
+    }
+
+    /* Nothing to do if F is not the root of a component */
+    if (F->Low != F->Index) {
+        return;
+    }
+
+    /* All frames reachable from the component lie below it. A component
+    ** with more than one function, or a function calling itself, is
+    ** recursive.
+    */
+    Base  = 0;
+    Cycle = (CollCount (&SearchStack) - Start > 1);
+    for (I = Start; I < CollCount (&SearchStack); ++I) {
+        CGFunc* G = CollAtUnchecked (&SearchStack, I);
+        unsigned J;
+        for (J = 0; J < CollCount (&G->Calls); ++J) {
+            CGFunc* C = CollAtUnchecked (&G->Calls, J);
+            if (C == F) {
+                Cycle = 1;
+            } else if ((C->Flags & CGF_ONSTACK) == 0 && C->High > Base) {
+                Base = C->High;
+            }
+        }
+    }
+
+    /* Assign the frames and pop the component */
+    while (CollCount (&SearchStack) > Start) {
+        CGFunc* G = CollPop (&SearchStack);
+        G->Flags &= ~CGF_ONSTACK;
+        G->Offs = G->High = Base;
+        if (!Cycle && (G->Flags & (CGF_CANFRAME | CGF_ADDR)) == CGF_CANFRAME) {
+            G->Flags |= CGF_FRAME;
+            G->High += G->FrameSize;
+            if (G->High > FrameArea) {
+                FrameArea = G->High;
+            }
+        }
+    }
+}
+
+
+
+static void ReadCallGraph (const char* Name)
+/* Read the call graph of the program and assign the frames */
+{
+    char        Line[512];
+    char        Kind[16];
+    char        A[256];
+    char        B[256];
+    unsigned    Static, CanFrame, Size;
+    unsigned    LineNum = 0;
+    unsigned    Units = 0;
+    Collection  Calls = AUTO_COLLECTION_INITIALIZER;
+    unsigned    I;
+
+    /* Open the file */
+    FILE* F = fopen (Name, "r");
+    if (F == 0) {
+        Fatal ("Cannot open call graph file '%s': %s", Name, strerror (errno));
+    }
+
+    /* Read the records */
+    while (fgets (Line, sizeof (Line), F) != 0) {
+
+        ++LineNum;
+        if (sscanf (Line, "%15s", Kind) != 1) {
+            /* Empty line */
+            continue;
+        }
+
+        if (strcmp (Kind, "unit") == 0) {
+            /* Remove the trailing newline from the name */
+            char* S = Line + 4;
+            S += strspn (S, " \t");
+            S[strcspn (S, "\r\n")] = '\0';
+            if (strcmp (S, UnitName) == 0) {
+                Unit = Units;
+            }
+            ++Units;
+        } else if (Units == 0) {
+            Fatal ("%s(%u): Missing unit record", Name, LineNum);
+        } else if (strcmp (Kind, "func") == 0) {
+            CGFunc* Func;
+            if (sscanf (Line, "%*s %255s %u %u %u", A, &Static, &CanFrame, &Size) != 4) {
+                Fatal ("%s(%u): Invalid function record", Name, LineNum);
+            }
+            Func = xmalloc (sizeof (CGFunc));
+            Func->Name      = xstrdup (A);
+            Func->Unit      = Units - 1;
+            Func->Flags     = (Static? CGF_STATIC : 0) | (CanFrame? CGF_CANFRAME : 0);
+            Func->FrameSize = Size;
+            InitCollection (&Func->Calls);
+            Func->Index     = 0;
+            Func->Low       = 0;
+            Func->Offs      = 0;
+            Func->High      = 0;
+            Func->RegUse    = 0;
+            Func->RegChg    = 0;
+            CollAppend (&Funcs, Func);
+        } else if (strcmp (Kind, "call") == 0 || strcmp (Kind, "addr") == 0) {
+            CGCall* C = xmalloc (sizeof (CGCall));
+            if (Kind[0] == 'c') {
+                if (sscanf (Line, "%*s %255s %255s", A, B) != 2) {
+                    Fatal ("%s(%u): Invalid call record", Name, LineNum);
+                }
+                C->Caller = xstrdup (A);
+            } else {
+                /* The address of a function may be used by unknown code */
+                if (sscanf (Line, "%*s %255s", B) != 1) {
+                    Fatal ("%s(%u): Invalid address record", Name, LineNum);
+                }
+                C->Caller = 0;
+            }
+            C->Unit   = Units - 1;
+            C->Callee = xstrdup (B);
+            CollAppend (&Calls, C);
+        } else if (strcmp (Kind, "regs") == 0) {
+            CGFunc* Func;
+            unsigned Use, Chg;
+            if (sscanf (Line, "%*s %255s %x %x", A, &Use, &Chg) != 3) {
+                Fatal ("%s(%u): Invalid register record", Name, LineNum);
+            }
+            /* The function record comes first */
+            Func = FindFunc (Units - 1, A);
+            if (Func) {
+                Func->Flags  |= CGF_REGS;
+                Func->RegUse  = Use;
+                Func->RegChg  = Chg;
+            }
+        } else {
+            Fatal ("%s(%u): Unknown record '%s'", Name, LineNum, Kind);
+        }
+    }
+    (void) fclose (F);
+
+    /* Resolve the calls. Functions that are not part of the program are
+    ** library functions which may call back through pointers.
+    */
+    InitCollection (&IndirectNode.Calls);
+    for (I = 0; I < CollCount (&Calls); ++I) {
+        CGCall* C = CollAtUnchecked (&Calls, I);
+        CGFunc* Callee = (strcmp (C->Callee, "*") == 0)? 0 : FindFunc (C->Unit, C->Callee);
+        if (C->Caller == 0) {
+            if (Callee) {
+                Callee->Flags |= CGF_ADDR;
+                CollAppend (&IndirectNode.Calls, Callee);
+            }
+        } else {
+            CGFunc* Caller = FindFunc (C->Unit, C->Caller);
+            if (Caller) {
+                CollAppend (&Caller->Calls, Callee? Callee : &IndirectNode);
+            }
+        }
+        xfree (C->Caller);
+        xfree (C->Callee);
+        xfree (C);
+    }
+    DoneCollection (&Calls);
+
+    /* Assign the frames */
+    for (I = 0; I < CollCount (&Funcs); ++I) {
+        CGFunc* Func = CollAtUnchecked (&Funcs, I);
+        if (Func->Index == 0) {
+            Search (Func);
+        }
+    }
+}
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void CG_Init (const char* Unit)
+/* Initialize the call graph module for the translation unit with the given
+** name. If requested, read the call graph of the program and assign the
+** static frames.
+*/
+{
+    UnitName = Unit;
+    if (SB_NotEmpty (&StaticFramesName)) {
+        ReadCallGraph (SB_GetConstBuf (&StaticFramesName));
+    }
+    Recording = SB_NotEmpty (&CallGraphName);
+    if (Recording) {
+        AddLine ("unit %s", UnitName);
+    }
+}
+
+
+
+void CG_Done (void)
+/* Write the call graph of the translation unit if requested */
+{
+    const char* Name;
+    FILE*       F;
+    unsigned    I;
+
+    if (!Recording) {
+        return;
+    }
+
+    /* References that are not direct calls take the address */
+    for (I = 0; I < CollCount (&Refs); ++I) {
+        const CGRef* R = CollConstAt (&Refs, I);
+        if (R->Count > 0) {
+            AddLine ("addr %s", R->Name);
+        }
+    }
+
+    /* Write the file */
+    Name = SB_GetConstBuf (&CallGraphName);
+    F = fopen (Name, "w");
+    if (F == 0) {
+        Fatal ("Cannot open call graph file '%s': %s", Name, strerror (errno));
+    }
+    for (I = 0; I < CollCount (&Lines); ++I) {
+        fprintf (F, "%s\n", (const char*) CollConstAt (&Lines, I));
+    }
+    if (fclose (F) != 0) {
+        Fatal ("Cannot write to call graph file (disk full?)");
+    }
+}
+
+
+
+int CG_GetFrame (const SymEntry* Func)
+/* Return the offset of the static frame of the given function in the frame
+** area, or -1 if the function uses the C stack.
+*/
+{
+    const CGFunc* F;
+
+    if (CollCount (&Funcs) == 0) {
+        return -1;
+    }
+    F = FindFunc (Unit, FuncName (Func));
+    if (F == 0 || (F->Flags & CGF_FRAME) == 0) {
+        return -1;
+    }
+
+    /* A static function of this unit may be missing in the call graph */
+    if (((F->Flags & CGF_STATIC) != 0) != IsStaticFunc (Func)) {
+        return -1;
+    }
+
+    FramesUsed = 1;
+    return (int) F->Offs;
+}
+
+
+
+void CG_EmitFrames (void)
+/* Emit the definition of or a reference to the frame area */
+{
+    /* The first unit of the program owns the frame area */
+    if (FrameArea > 0 && Unit == 0) {
+        g_defexport (CG_FRAMES, 0);
+        g_usebss ();
+        g_defgloblabel (CG_FRAMES);
+        g_res (FrameArea);
+    } else if (FramesUsed) {
+        g_defimport (CG_FRAMES, 0);
+    }
+}
+
+
+
+void CG_FuncStart (int CanHaveFrame)
+/* Start recording a function definition. CanHaveFrame is false if the
+** function cannot use a static frame because of its parameters.
+*/
+{
+    CanFrame = CanHaveFrame;
+}
+
+
+
+void CG_FuncEnd (const SymEntry* Func, unsigned FrameSize)
+/* End of a function definition with the given size of parameters plus local
+** variables.
+*/
+{
+    const CGFunc* F;
+
+    if (Recording) {
+        AddLine ("func %s %d %d %u", FuncName (Func), IsStaticFunc (Func),
+                 CanFrame, FrameSize);
+    }
+
+    /* The frame must have the size recorded in the call graph, and the
+    ** function must still be able to use it.
+    */
+    if (CollCount (&Funcs) > 0 && (F = FindFunc (Unit, FuncName (Func))) != 0 &&
+        (F->Flags & CGF_FRAME) != 0 && (F->FrameSize != FrameSize || !CanFrame)) {
+        Error ("Call graph is out of date for function '%s'", Func->Name);
+    }
+}
+
+
+
+void CG_FuncRef (const SymEntry* Func)
+/* Record a reference to a function */
+{
+    if (Recording) {
+        ++GetRef (FuncName (Func))->Count;
+    }
+}
+
+
+
+void CG_CallStart (const SymEntry* Callee)
+/* Record the start of a call to the given function. Callee is NULL for calls
+** through a pointer. Calls made while evaluating the arguments are recorded
+** as calls of the callee, so the frames don't overlap.
+*/
+{
+    const char* Name = "*";
+    unsigned I;
+
+    if (!Recording) {
+        return;
+    }
+
+    /* A direct call doesn't take the address */
+    if (Callee) {
+        Name = FuncName (Callee);
+        --GetRef (Name)->Count;
+    }
+
+    if (CurrentFunc) {
+        AddLine ("call %s %s", FuncName (CurrentFunc->FuncEntry), Name);
+    }
+    for (I = 0; I < CollCount (&OpenCalls); ++I) {
+        const char* Caller = CollConstAt (&OpenCalls, I);
+        if (strcmp (Caller, "*") != 0) {
+            AddLine ("call %s %s", Caller, Name);
+        }
+    }
+    CollAppend (&OpenCalls, (void*) Name);
+}
+
+
+
+void CG_CallEnd (void)
+/* Record the end of the argument list of a call */
+{
+    if (Recording) {
+        CollPop (&OpenCalls);
+    }
+}
+
+
+
+void CG_FuncRegs (const SymEntry* Func, unsigned Use, unsigned Chg)
+/* Record the registers used and changed by the optimized code of a function */
+{
+    const CGFunc* F;
+
+    /* Only external functions may be called from other units */
+    if (IsStaticFunc (Func)) {
+        return;
+    }
+
+    /* The code changes once the static frames are used, so only record the
+    ** registers if this unit already uses the call graph of the program.
+    */
+    if (Recording && CollCount (&Funcs) > 0) {
+        AddLine ("regs %s %X %X", FuncName (Func), Use, Chg);
+    }
+
+    /* Other units rely on the registers recorded in the call graph */
+    if (CollCount (&Funcs) > 0 && (F = FindFunc (Unit, FuncName (Func))) != 0 &&
+        (F->Flags & CGF_REGS) != 0 &&
+        ((Use & ~F->RegUse) != 0 || (Chg & ~F->RegChg) != 0)) {
+        Error ("Call graph is out of date for function '%s'", Func->Name);
+    }
+}
+
+
+
+int CG_GetRegs (const SymEntry* Func, unsigned* Use, unsigned* Chg)
+/* Get the registers used and changed by an external function from the call
+** graph of the program. Return false if they are not known.
+*/
+{
+    const CGFunc* F;
+
+    if (CollCount (&Funcs) == 0 || IsStaticFunc (Func)) {
+        return 0;
+    }
+    F = FindFunc (Unit, FuncName (Func));
+    if (F == 0 || (F->Flags & (CGF_STATIC | CGF_REGS)) != CGF_REGS) {
+        return 0;
+    }
+    *Use = F->RegUse;
+    *Chg = F->RegChg;
+    return 1;
+}
+
+
+
+void CG_AsmStatement (void)
+/* Record an assembler statement in the current function */
+{
+    /* The assembler code may access the parameters on the stack and call
+    ** anything.
+    */
+    if (CurrentFunc) {
+        CanFrame = 0;
+        if (Recording) {
+            AddLine ("call %s *", FuncName (CurrentFunc->FuncEntry));
+        }
+    }
+}
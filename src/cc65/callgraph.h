@@ -0,0 +1,116 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                callgraph.h                                */
+/*                                                                           */
+/*                     Call graph and static stack frames                    */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#ifndef CALLGRAPH_H
+#define CALLGRAPH_H
+
+
+
+/* cc65 */
+#include "symentry.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Name of the frame area as used for CF_EXTERNAL. The assembler name gets an
+** additional underscore, so it is __FRAMES__.
+*/
+#define CG_FRAMES       "_FRAMES__"
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void CG_Init (const char* Unit);
+/* Initialize the call graph module for the translation unit with the given
+** name. If requested, read the call graph of the program and assign the
+** static frames.
+*/
+
+void CG_Done (void);
+/* Write the call graph of the translation unit if requested */
+
+int CG_GetFrame (const SymEntry* Func);
+/* Return the offset of the static frame of the given function in the frame
+** area, or -1 if the function uses the C stack.
+*/
+
+void CG_EmitFrames (void);
+/* Emit the definition of or a reference to the frame area */
+
+void CG_FuncStart (int CanHaveFrame);
+/* Start recording a function definition. CanHaveFrame is false if the
+** function cannot use a static frame because of its parameters.
+*/
+
+void CG_FuncEnd (const SymEntry* Func, unsigned FrameSize);
+/* End of a function definition with the given size of parameters plus local
+** variables.
+*/
+
+void CG_FuncRef (const SymEntry* Func);
+/* Record a reference to a function */
+
+void CG_CallStart (const SymEntry* Callee);
+/* Record the start of a call to the given function. Callee is NULL for calls
+** through a pointer. Calls made while evaluating the arguments are recorded
+** as calls of the callee, so the frames don't overlap.
+*/
+
+void CG_CallEnd (void);
+/* Record the end of the argument list of a call */
+
+void CG_AsmStatement (void);
+/* Record an assembler statement in the current function */
+
+void CG_FuncRegs (const SymEntry* Func, unsigned Use, unsigned Chg);
+/* Record the registers used and changed by the optimized code of a function */
+
+int CG_GetRegs (const SymEntry* Func, unsigned* Use, unsigned* Chg);
+/* Get the registers used and changed by an external function from the call
+** graph of the program. Return false if they are not known.
+*/
+
+
+
+/* End of callgraph.h */
+
+#endif
@@ -40,7 +40,6 @@
 #include "xmalloc.h"
 
 /* cc65 */
-#include "asmlabel.h"
 #include "error.h"
 #include "casenode.h"
 
@@ -132,13 +131,13 @@ int SearchCaseNode (const Collection* Nodes, unsigned char Key, int* Index)
 
 
 
-unsigned InsertCaseValue (Collection* Nodes, unsigned long Val, unsigned Depth)
-/* Insert a new case value into a CaseNode tree with the given depth. Return
-** the code label for the value.
+void InsertCaseValue (Collection* Nodes, unsigned long Val, unsigned Depth,
+                      unsigned CaseLabel)
+/* Insert a new case value with the given code label into a CaseNode tree
+** with the given depth.
 */
 {
     CaseNode* N = 0;
-    unsigned CaseLabel = GetLocalLabel ();  /* Code label */
 
     while (Depth--) {
 
@@ -178,7 +177,4 @@ unsigned InsertCaseValue (Collection* Nodes, unsigned long Val, unsigned Depth)
         /* Get the collection from the node for the next round. */
         Nodes = N->Nodes;
     }
-
-    /* Return the label of the node we found/created */
-    return CaseLabel;
 }
@@ -120,9 +120,10 @@ int SearchCaseNode (const Collection* Nodes, unsigned char Key, int* Index);
 ** false.
 */
 
-unsigned InsertCaseValue (Collection* Nodes, unsigned long Val, unsigned Depth);
-/* Insert a new case value into a CaseNode tree with the given depth. Return
-** the code label for the value.
+void InsertCaseValue (Collection* Nodes, unsigned long Val, unsigned Depth,
+                      unsigned CaseLabel);
+/* Insert a new case value with the given code label into a CaseNode tree
+** with the given depth.
 */
 
 
@@ -987,6 +987,18 @@ int CE_UseLoadFlags (CodeEntry* E)
 
 
 
+void CE_UpdateFuncInfo (CodeEntry* E)
+/* If the entry is a subroutine call or a jump to an external function,
+** update Use and Chg with the current information about the function.
+*/
+{
+    if ((E->Info & (OF_UBRA | OF_CALL)) != 0 && E->JumpTo == 0) {
+        GetFuncInfo (E->Arg, &E->Use, &E->Chg);
+    }
+}
+
+
+
 void CE_FreeRegInfo (CodeEntry* E)
 /* Free an existing register info struct */
 {
@@ -286,6 +286,11 @@ int CE_UseLoadFlags (CodeEntry* E);
 ** a register (N and Z).
 */
 
+void CE_UpdateFuncInfo (CodeEntry* E);
+/* If the entry is a subroutine call or a jump to an external function,
+** update Use and Chg with the current information about the function.
+*/
+
 void CE_FreeRegInfo (CodeEntry* E);
 /* Free an existing register info struct */
 
@@ -51,6 +51,7 @@
 /* cc65 */
 #include "asmcode.h"
 #include "asmlabel.h"
+#include "callgraph.h"
 #include "casenode.h"
 #include "codeseg.h"
 #include "dataseg.h"
@@ -467,6 +468,14 @@ void g_importmainargs (void)
 
 
 
+void g_defframelabel (unsigned Label, unsigned Offs)
+/* Define a local data label for a variable in the frame area */
+{
+    AddDataLine ("%s\t:= _%s+%u", LocalDataLabelName (Label), CG_FRAMES, Offs);
+}
+
+
+
 /*****************************************************************************/
 /*                          Function entry and exit                          */
 /*****************************************************************************/
@@ -2157,6 +2166,644 @@ void g_addaddr_static (unsigned flags, uintptr_t label, long offs)
 
 
 
+/*****************************************************************************/
+/*                   Multiplication and division by constants                */
+/*****************************************************************************/
+
+
+
+/* Multiplications by a constant are done inline with a chain of shifts and
+** adds or subtracts, unsigned divisions by a constant with an unrolled
+** multiplication by the reciprocal. A sequence that is faster and not larger
+** than the runtime call it replaces is always used. Larger sequences need a
+** CodeSizeFactor of at least MD_MIN_FACTOR. At that factor, every additional
+** byte must save at least MD_BYTE_CYCLES cycles, and the sequence may not be
+** larger than MD_MAX_BYTES. Higher factors scale both limits.
+*/
+#define MD_MIN_FACTOR   200
+#define MD_BYTE_CYCLES  20
+#define MD_MAX_BYTES    32
+
+/* Steps of the inline sequences. The operand is kept in tmp1 (8 bit),
+** ptr1 (16 bit) or ptr1/ptr2 (32 bit), the accumulator lives in A, tmp1 and
+** sreg. Division and modulo keep a second copy of the operand in tmp2, ptr2
+** or ptr3/ptr4.
+*/
+typedef enum {
+    MD_LOAD,                    /* Save the operand, it is the accumulator */
+    MD_KEEP,                    /* Save a second copy of the operand */
+    MD_ASL,                     /* Shift left by one bit */
+    MD_ASL8,                    /* Shift left by eight bits */
+    MD_LSR,                     /* Shift right by one bit */
+    MD_ROR,                     /* Shift right by one bit, carry goes into the MSB */
+    MD_ADD,                     /* Add the operand */
+    MD_SUB,                     /* Subtract the operand */
+    MD_RSUB,                    /* Subtract from the second copy */
+    MD_DONE,                    /* Move the accumulator into the primary */
+    MD_COUNT
+} MDStep;
+
+typedef struct MDCode MDCode;
+struct MDCode {
+    unsigned char       Bytes;          /* Size of the code */
+    unsigned char       Cycles;         /* Execution time of the code */
+    const char*         Lines[18];      /* Code lines, terminated by NULL */
+};
+
+static const MDCode MDCodeTab[3][MD_COUNT] = {
+    {   /* 8 bit */
+        {  2,  3, { "sta tmp1" } },
+        {  2,  3, { "sta tmp2" } },
+        {  1,  2, { "asl a" } },
+        {  0,  0, { 0 } },
+        {  1,  2, { "lsr a" } },
+        {  1,  2, { "ror a" } },
+        {  3,  5, { "clc", "adc tmp1" } },
+        {  3,  5, { "sec", "sbc tmp1" } },
+        {  5,  7, { "eor #$FF", "sec", "adc tmp2" } },
+        {  0,  0, { 0 } },
+    },
+    {   /* 16 bit */
+        {  6,  9, { "sta ptr1", "stx ptr1+1", "stx tmp1" } },
+        {  4,  6, { "sta ptr2", "stx ptr2+1" } },
+        {  3,  7, { "asl a", "rol tmp1" } },
+        {  4,  5, { "sta tmp1", "lda #$00" } },
+        {  3,  7, { "lsr tmp1", "ror a" } },
+        {  3,  7, { "ror tmp1", "ror a" } },
+        { 11, 18, { "clc", "adc ptr1", "tay", "lda tmp1", "adc ptr1+1",
+                    "sta tmp1", "tya" } },
+        { 11, 18, { "sec", "sbc ptr1", "tay", "lda tmp1", "sbc ptr1+1",
+                    "sta tmp1", "tya" } },
+        { 15, 22, { "eor #$FF", "sec", "adc ptr2", "tay", "lda tmp1",
+                    "eor #$FF", "adc ptr2+1", "sta tmp1", "tya" } },
+        {  2,  3, { "ldx tmp1" } },
+    },
+    {   /* 32 bit */
+        { 14, 21, { "sta ptr1", "stx ptr1+1", "stx tmp1", "ldy sreg",
+                    "sty ptr2", "ldy sreg+1", "sty ptr2+1" } },
+        { 12, 18, { "sta ptr3", "stx ptr3+1", "ldy sreg", "sty ptr4",
+                    "ldy sreg+1", "sty ptr4+1" } },
+        {  7, 17, { "asl a", "rol tmp1", "rol sreg", "rol sreg+1" } },
+        { 12, 17, { "ldy sreg", "sty sreg+1", "ldy tmp1", "sty sreg",
+                    "sta tmp1", "lda #$00" } },
+        {  7, 17, { "lsr sreg+1", "ror sreg", "ror tmp1", "ror a" } },
+        {  7, 17, { "ror sreg+1", "ror sreg", "ror tmp1", "ror a" } },
+        { 23, 36, { "clc", "adc ptr1", "tay", "lda tmp1", "adc ptr1+1",
+                    "sta tmp1", "lda sreg", "adc ptr2", "sta sreg",
+                    "lda sreg+1", "adc ptr2+1", "sta sreg+1", "tya" } },
+        { 23, 36, { "sec", "sbc ptr1", "tay", "lda tmp1", "sbc ptr1+1",
+                    "sta tmp1", "lda sreg", "sbc ptr2", "sta sreg",
+                    "lda sreg+1", "sbc ptr2+1", "sta sreg+1", "tya" } },
+        { 31, 44, { "eor #$FF", "sec", "adc ptr3", "tay", "lda tmp1",
+                    "eor #$FF", "adc ptr3+1", "sta tmp1", "lda sreg",
+                    "eor #$FF", "adc ptr4", "sta sreg", "lda sreg+1",
+                    "eor #$FF", "adc ptr4+1", "sta sreg+1", "tya" } },
+        {  2,  3, { "ldx tmp1" } },
+    },
+};
+
+/* Approximate size and execution time of the runtime calls for a
+** multiplication and a division or modulo operation, including the push of
+** the left operand and the load of the constant.
+*/
+static const unsigned char MDCallBytes[3] = { 10, 10, 16 };
+static const unsigned MDMulCycles[3] = { 250, 650, 1900 };
+static const unsigned MDDivCycles[3] = { 570, 590, 2700 };
+
+/* The same for the mulaxN subroutines */
+#define MD_MULAXN_BYTES         3
+#define MD_MULAXN_CYCLES        45
+
+/* An inline sequence being generated or just measured */
+typedef struct MDSeq MDSeq;
+struct MDSeq {
+    unsigned            Width;          /* 0 = 8, 1 = 16, 2 = 32 bit */
+    unsigned            Flags;          /* Code generator flags */
+    int                 Emit;           /* Output code if true */
+    unsigned            Bytes;          /* Size of the sequence */
+    unsigned            Cycles;         /* Execution time of the sequence */
+};
+
+
+
+static void MDInit (MDSeq* S, unsigned Flags, unsigned Width, int Emit)
+/* Initialize an inline sequence */
+{
+    S->Width  = Width;
+    S->Flags  = Flags;
+    S->Emit   = Emit;
+    S->Bytes  = 0;
+    S->Cycles = 0;
+}
+
+
+
+static void MDAddStep (MDSeq* S, MDStep Step)
+/* Add one step to an inline sequence */
+{
+    const MDCode* C = &MDCodeTab[S->Width][Step];
+
+    S->Bytes  += C->Bytes;
+    S->Cycles += C->Cycles;
+    if (S->Emit) {
+        const char* const* L;
+        for (L = C->Lines; *L; ++L) {
+            AddCodeLine ("%s", *L);
+        }
+    }
+}
+
+
+
+static void MDAddNeg (MDSeq* S)
+/* Negate the primary register */
+{
+    static const unsigned char Cycles[3] = { 6, 33, 50 };
+
+    S->Bytes  += S->Width == 0? 5 : 3;
+    S->Cycles += Cycles[S->Width];
+    if (S->Emit) {
+        g_neg (S->Flags);
+    }
+}
+
+
+
+static void MDAddShr8 (MDSeq* S, unsigned Count)
+/* Shift the primary register right by Count * 8 bits */
+{
+    if (Count > 0) {
+        S->Bytes  += S->Width == 1? 3 : 10;
+        S->Cycles += S->Width == 1? 4 : 15;
+        if (S->Emit) {
+            g_asr (S->Flags | CF_UNSIGNED | CF_CONST, Count * 8);
+        }
+    }
+}
+
+
+
+static int MDWorthIt (const MDSeq* S, unsigned CallBytes, unsigned CallCycles)
+/* Return true if the inline sequence should be used instead of a runtime
+** call with the given size and execution time.
+*/
+{
+    unsigned long Factor = IS_Get (&CodeSizeFactor);
+
+    if (S->Cycles >= CallCycles) {
+        return 0;
+    }
+    if (S->Bytes <= CallBytes) {
+        return 1;
+    }
+    if (Factor < MD_MIN_FACTOR) {
+        return 0;
+    }
+    if (S->Bytes * (unsigned long) MD_MIN_FACTOR > MD_MAX_BYTES * Factor) {
+        return 0;
+    }
+    return (S->Bytes - CallBytes) * MD_BYTE_CYCLES * (unsigned long) MD_MIN_FACTOR <=
+           (CallCycles - S->Cycles) * Factor;
+}
+
+
+
+static unsigned MDBits (unsigned Width)
+/* Return the number of bits for a width index */
+{
+    return 8U << Width;
+}
+
+
+
+static unsigned long MDMask (unsigned Width)
+/* Return the value mask for a width index */
+{
+    return 0xFFFFFFFFUL >> (32 - MDBits (Width));
+}
+
+
+
+static int MDDigits (unsigned long Val, unsigned Bits, int NAF, signed char* Digits)
+/* Split Val into Bits digits, either binary or in non-adjacent form, where
+** each digit is -1, 0 or 1 and no two adjacent digits are nonzero. Carries
+** beyond the width are dropped. Return true if the leading nonzero digit is
+** positive, so the chain can start with the operand itself.
+*/
+{
+    unsigned I;
+    int      Lead = 0;
+
+    for (I = 0; I < Bits; ++I) {
+        if ((Val & 0x01) == 0) {
+            Digits[I] = 0;
+        } else if (NAF && (Val & 0x02) != 0 && I + 1 < Bits) {
+            Digits[I] = -1;
+            ++Val;
+        } else {
+            Digits[I] = 1;
+            --Val;
+        }
+        if (Digits[I] != 0) {
+            Lead = Digits[I];
+        }
+        Val >>= 1;
+    }
+    return Lead > 0;
+}
+
+
+
+static void MDShl (MDSeq* S, unsigned Count)
+/* Shift the accumulator left by Count bits */
+{
+    while (Count >= 8 && S->Width > 0) {
+        MDAddStep (S, MD_ASL8);
+        Count -= 8;
+    }
+    while (Count > 0) {
+        MDAddStep (S, MD_ASL);
+        --Count;
+    }
+}
+
+
+
+static void MDMulChain (MDSeq* S, const signed char* Digits)
+/* Multiply the primary register by the digits using Horner's scheme. The
+** leading nonzero digit must be positive. The product is left in the
+** accumulator.
+*/
+{
+    unsigned I = MDBits (S->Width) - 1;
+    unsigned Shift = 0;
+
+    /* The leading digit gives the start value */
+    while (Digits[I] == 0) {
+        --I;
+    }
+    MDAddStep (S, MD_LOAD);
+
+    /* Shift the accumulator for each of the following digits, and add or
+    ** subtract the operand where the digit is nonzero.
+    */
+    while (I-- > 0) {
+        ++Shift;
+        if (Digits[I] != 0) {
+            MDShl (S, Shift);
+            MDAddStep (S, Digits[I] > 0? MD_ADD : MD_SUB);
+            Shift = 0;
+        }
+    }
+    MDShl (S, Shift);
+}
+
+
+
+static int MDMulDigits (MDSeq* S, unsigned long Val, int AllowNeg,
+                        signed char* Digits, int* Neg)
+/* Find the fastest chain of digits for a multiplication by Val and add its
+** costs to S, which must be a measurement. If AllowNeg is true, the chain
+** may be for the negated value, which is flagged in Neg. Return false if
+** there is no chain.
+*/
+{
+    signed char   Cand[32];
+    unsigned      Bits = MDBits (S->Width);
+    unsigned      BestBytes = 0;
+    unsigned      BestCycles = UINT_MAX;
+    unsigned      I;
+
+    for (I = 0; I < 4; ++I) {
+
+        int           CandNeg = (I & 0x02) != 0;
+        unsigned long CandVal = (CandNeg? 0UL - Val : Val) & MDMask (S->Width);
+        MDSeq         T;
+
+        /* Check if this variant is possible */
+        if ((CandNeg && !AllowNeg) || CandVal == 0 ||
+            !MDDigits (CandVal, Bits, I & 0x01, Cand)) {
+            continue;
+        }
+
+        /* Measure it */
+        MDInit (&T, S->Flags, S->Width, 0);
+        MDMulChain (&T, Cand);
+        if (CandNeg) {
+            MDAddNeg (&T);
+        }
+        if (T.Cycles < BestCycles ||
+            (T.Cycles == BestCycles && T.Bytes < BestBytes)) {
+            BestBytes  = T.Bytes;
+            BestCycles = T.Cycles;
+            memcpy (Digits, Cand, Bits);
+            *Neg = CandNeg;
+        }
+    }
+
+    if (BestCycles == UINT_MAX) {
+        return 0;
+    }
+    S->Bytes  += BestBytes;
+    S->Cycles += BestCycles;
+    return 1;
+}
+
+
+
+static void MDDivChain (MDSeq* S, unsigned long M, unsigned L)
+/* Replace the primary register by (primary * M) >> L. The multiplication
+** runs from the low to the high bits of M, shifting the accumulator right
+** after each step, so only the upper half of the product is ever needed.
+*/
+{
+    unsigned I = 0;
+    unsigned Top;
+    unsigned Shift;
+    unsigned Bytes;
+    MDStep   Step = MD_LSR;
+
+    /* The lowest set bit of M gives the start value */
+    while ((M & (1UL << I)) == 0) {
+        ++I;
+    }
+    Top = I;
+    while ((M >> Top) > 1) {
+        ++Top;
+    }
+    MDAddStep (S, MD_LOAD);
+
+    /* For each of the following bits, shift right and add the operand if
+    ** the bit is set. The carry from the add is shifted in by the next step.
+    */
+    while (I < Top) {
+        MDAddStep (S, Step);
+        if ((M & (1UL << ++I)) != 0) {
+            MDAddStep (S, MD_ADD);
+            Step = MD_ROR;
+        } else {
+            Step = MD_LSR;
+        }
+    }
+    MDAddStep (S, Step);
+
+    /* Do the remaining shifts, whole bytes are moved after the result is in
+    ** the primary.
+    */
+    Shift = L - Top - 1;
+    Bytes = S->Width > 0? Shift / 8 : 0;
+    Shift -= Bytes * 8;
+    while (Shift-- > 0) {
+        MDAddStep (S, MD_LSR);
+    }
+    MDAddStep (S, MD_DONE);
+    MDAddShr8 (S, Bytes);
+}
+
+
+
+static int MDPow2Div (unsigned L, unsigned long D, unsigned long* Q, unsigned long* R)
+/* Compute 2^L / D and 2^L % D for D > 1. Return false if the quotient
+** doesn't fit into 32 bits.
+*/
+{
+    unsigned long Quot = 0;
+    unsigned long Rem  = 1;
+
+    while (L-- > 0) {
+        int Carry = (Rem & 0x80000000UL) != 0;
+        if ((Quot & 0x80000000UL) != 0) {
+            return 0;
+        }
+        Rem  = (Rem << 1) & 0xFFFFFFFFUL;
+        Quot <<= 1;
+        if (Carry || Rem >= D) {
+            Rem = (Rem - D) & 0xFFFFFFFFUL;
+            Quot |= 0x01;
+        }
+    }
+    *Q = Quot;
+    *R = Rem;
+    return 1;
+}
+
+
+
+static unsigned long MDSparsest (unsigned long Lo, unsigned long Hi)
+/* Return the value in Lo..Hi with the fewest bits set */
+{
+    unsigned long Bit = 0x80000000UL;
+
+    if (Lo == Hi) {
+        return Lo;
+    }
+
+    /* Find the highest bit where Lo and Hi differ. It is set in Hi, so the
+    ** common upper part plus this bit is in the range, and no other value
+    ** has fewer bits set except Lo itself if it has no lower bits.
+    */
+    while (((Lo ^ Hi) & Bit) == 0) {
+        Bit >>= 1;
+    }
+    if ((Lo & (Bit - 1)) == 0) {
+        return Lo;
+    }
+    return (Hi & ~(Bit - 1)) | Bit;
+}
+
+
+
+static int MDFindRecip (MDSeq* S, unsigned long D, unsigned long* M, unsigned* L)
+/* Find the fastest multiplier M and shift count L, so that x / D is equal
+** to (x * M) >> L for all unsigned x of the width of S. This is the case if
+** 2^L <= M * D <= 2^L + 2^(L - Bits). Add the costs to S, which must be a
+** measurement. Return false if there is no usable multiplier.
+*/
+{
+    unsigned Bits = MDBits (S->Width);
+    unsigned Len = 0;
+    unsigned Shift;
+    unsigned BestBytes = 0;
+    unsigned BestCycles = UINT_MAX;
+
+    /* Keep the intermediate values within 32 bits */
+    if (D < 2 || D > MDMask (S->Width) || D >= 0x80000000UL) {
+        return 0;
+    }
+    while ((D >> Len) != 0) {
+        ++Len;
+    }
+
+    for (Shift = Bits; Shift <= Bits + Len; ++Shift) {
+
+        unsigned long Q, R, Lo, Hi, Extra;
+        unsigned long Cand[2];
+        unsigned      I;
+
+        /* Determine the range of possible multipliers */
+        if (!MDPow2Div (Shift, D, &Q, &R) || Q == 0xFFFFFFFFUL) {
+            break;
+        }
+        Lo    = Q + (R != 0);
+        Extra = (R + (1UL << (Shift - Bits))) / D;
+        Hi    = (Q > 0xFFFFFFFFUL - Extra)? 0xFFFFFFFFUL : Q + Extra;
+        if (Lo > Hi) {
+            continue;
+        }
+
+        /* Try the smallest one and the one with the fewest adds */
+        Cand[0] = Lo;
+        Cand[1] = MDSparsest (Lo, Hi);
+        for (I = 0; I < 2; ++I) {
+            MDSeq T;
+            MDInit (&T, S->Flags, S->Width, 0);
+            MDDivChain (&T, Cand[I], Shift);
+            if (T.Cycles < BestCycles ||
+                (T.Cycles == BestCycles && T.Bytes < BestBytes)) {
+                BestBytes  = T.Bytes;
+                BestCycles = T.Cycles;
+                *M = Cand[I];
+                *L = Shift;
+            }
+        }
+    }
+
+    if (BestCycles == UINT_MAX) {
+        return 0;
+    }
+    S->Bytes  += BestBytes;
+    S->Cycles += BestCycles;
+    return 1;
+}
+
+
+
+static int MDMul (unsigned Flags, unsigned long Val)
+/* Generate an inline multiplication of the primary register by Val if that
+** is worth it. Return true if code was generated.
+*/
+{
+    signed char Digits[32];
+    int         Neg = 0;
+    unsigned    Width;
+    unsigned    CallBytes;
+    unsigned    CallCycles;
+    MDSeq       S;
+
+    switch (Flags & CF_TYPEMASK) {
+        case CF_CHAR:   Width = (Flags & CF_FORCECHAR)? 0 : 1;  break;
+        case CF_INT:    Width = 1;                              break;
+        case CF_LONG:   Width = 2;                              break;
+        default:        return 0;
+    }
+    Val &= MDMask (Width);
+
+    /* Measure the sequence */
+    MDInit (&S, Flags, Width, 0);
+    if (!MDMulDigits (&S, Val, 1, Digits, &Neg)) {
+        return 0;
+    }
+    MDAddStep (&S, MD_DONE);
+
+    /* Compare it against the runtime call. There are special subroutines
+    ** for some small factors.
+    */
+    CallBytes  = MDCallBytes[Width];
+    CallCycles = MDMulCycles[Width];
+    if (Width == 1) {
+        switch (Val) {
+            case 3: case 5: case 6: case 7: case 9: case 10:
+                CallBytes  = MD_MULAXN_BYTES;
+                CallCycles = MD_MULAXN_CYCLES;
+                break;
+        }
+    }
+    if (!MDWorthIt (&S, CallBytes, CallCycles)) {
+        return 0;
+    }
+
+    /* Generate the code */
+    MDInit (&S, Flags, Width, 1);
+    MDMulChain (&S, Digits);
+    MDAddStep (&S, MD_DONE);
+    if (Neg) {
+        MDAddNeg (&S);
+    }
+    return 1;
+}
+
+
+
+static int MDDiv (unsigned Flags, unsigned long Val, int Mod)
+/* Generate an inline unsigned division or modulo operation of the primary
+** register by Val if that is worth it. Return true if code was generated.
+*/
+{
+    signed char   Digits[32];
+    int           Neg = 0;
+    unsigned      Width;
+    unsigned long M = 0;
+    unsigned      L = 0;
+    MDSeq         S;
+
+    if ((Flags & CF_UNSIGNED) == 0) {
+        return 0;
+    }
+    switch (Flags & CF_TYPEMASK) {
+        /* A char operand is in A, even if the result is an int */
+        case CF_CHAR:   Width = 0;      break;
+        case CF_INT:    Width = 1;      break;
+        case CF_LONG:   Width = 2;      break;
+        default:        return 0;
+    }
+
+    /* Measure the sequence. The remainder is the dividend minus the
+    ** product of quotient and divisor.
+    */
+    MDInit (&S, Flags, Width, 0);
+    if (Mod) {
+        MDAddStep (&S, MD_KEEP);
+    }
+    if (!MDFindRecip (&S, Val, &M, &L)) {
+        return 0;
+    }
+    if (Mod) {
+        if (!MDMulDigits (&S, Val, 0, Digits, &Neg)) {
+            return 0;
+        }
+        MDAddStep (&S, MD_RSUB);
+        MDAddStep (&S, MD_DONE);
+    }
+    if ((Flags & CF_FORCECHAR) == 0 && Width == 0) {
+        S.Bytes  += 2;
+        S.Cycles += 2;
+    }
+
+    /* Compare it against the runtime call */
+    if (!MDWorthIt (&S, MDCallBytes[Width], MDDivCycles[Width])) {
+        return 0;
+    }
+
+    /* Generate the code */
+    MDInit (&S, Flags, Width, 1);
+    if (Mod) {
+        MDAddStep (&S, MD_KEEP);
+    }
+    MDDivChain (&S, M, L);
+    if (Mod) {
+        MDMulChain (&S, Digits);
+        MDAddStep (&S, MD_RSUB);
+        MDAddStep (&S, MD_DONE);
+    }
+    if ((Flags & CF_FORCECHAR) == 0 && Width == 0) {
+        /* The result is an int */
+        AddCodeLine ("ldx #$00");
+    }
+    return 1;
+}
+
+
+
 /*****************************************************************************/
 /*                                                                           */
 /*****************************************************************************/
@@ -2642,6 +3289,11 @@ void g_mul (unsigned flags, unsigned long val)
             /* Done */
             return;
         }
+
+        /* Use a sequence of shifts and adds if that is worth it */
+        if (MDMul (flags, val)) {
+            return;
+        }
     }
 
     /* If the right hand side is const, the lhs is not on stack but still
@@ -2652,45 +3304,6 @@ void g_mul (unsigned flags, unsigned long val)
         switch (flags & CF_TYPEMASK) {
 
             case CF_CHAR:
-                if (flags & CF_FORCECHAR) {
-                    /* Handle some special cases */
-                    switch (val) {
-
-                        case 3:
-                            AddCodeLine ("sta tmp1");
-                            AddCodeLine ("asl a");
-                            AddCodeLine ("clc");
-                            AddCodeLine ("adc tmp1");
-                            return;
-
-                        case 5:
-                            AddCodeLine ("sta tmp1");
-                            AddCodeLine ("asl a");
-                            AddCodeLine ("asl a");
-                            AddCodeLine ("clc");
-                            AddCodeLine ("adc tmp1");
-                            return;
-
-                        case 6:
-                            AddCodeLine ("sta tmp1");
-                            AddCodeLine ("asl a");
-                            AddCodeLine ("clc");
-                            AddCodeLine ("adc tmp1");
-                            AddCodeLine ("asl a");
-                            return;
-
-                        case 10:
-                            AddCodeLine ("sta tmp1");
-                            AddCodeLine ("asl a");
-                            AddCodeLine ("asl a");
-                            AddCodeLine ("clc");
-                            AddCodeLine ("adc tmp1");
-                            AddCodeLine ("asl a");
-                            return;
-                    }
-                }
-                /* FALLTHROUGH */
-
             case CF_INT:
                 switch (val) {
                     case 3:
@@ -2831,6 +3444,11 @@ void g_div (unsigned flags, unsigned long val)
             return;
         }
 
+        /* Multiply unsigned values by the reciprocal if that is worth it */
+        if (MDDiv (flags, val, 0)) {
+            return;
+        }
+
         /* If we go here, we didn't emit code. Push the lhs on stack and fall
         ** into the normal, non-optimized stuff.
         */
@@ -2857,6 +3475,8 @@ void g_mod (unsigned flags, unsigned long val)
     if ((flags & CF_CONST) && (flags & CF_UNSIGNED) && val != 0xFFFFFFFF && (p2 = PowerOf2 (val)) >= 0) {
         /* We can do that with an AND operation */
         g_and (flags, val - 1);
+    } else if ((flags & CF_CONST) && MDDiv (flags, val, 1)) {
+        /* Done with a multiplication by the reciprocal */
     } else {
         /* Do it the hard way... */
         if (flags & CF_CONST) {
@@ -4643,12 +5263,148 @@ void g_extractbitfield (unsigned Flags, unsigned FullWidthFlags, int IsSigned,
 
 
 
-void g_switch (Collection* Nodes, unsigned DefaultLabel, unsigned Depth)
-/* Generate code for a switch statement */
+/* A run of consecutive selector values on one level of the case node tree.
+** On the last level, all values of the run share one case label, on all
+** other levels a run is always a single value with a collection of subnodes.
+*/
+typedef struct SwitchRange SwitchRange;
+struct SwitchRange {
+    unsigned    Lo;             /* First value of the run */
+    unsigned    Hi;             /* Last value of the run */
+    unsigned    Label;          /* Case label if last level */
+    Collection* Nodes;          /* Subnodes if not last level */
+};
+
+
+
+static unsigned SwitchLinearLimit (void)
+/* Return the maximum number of runs that are checked one after the other.
+** Above this limit, a binary search is generated. Every split of the search
+** costs a compare and a branch, so be more reluctant when optimizing for
+** size.
+*/
+{
+    long CodeSize = IS_Get (&CodeSizeFactor);
+    if (CodeSize >= 200) {
+        return 3;
+    } else if (CodeSize >= 100) {
+        return 4;
+    } else {
+        return 6;
+    }
+}
+
+
+
+static void g_switchlevel (const SwitchRange* R, unsigned Count,
+                           unsigned Min, unsigned Max,
+                           unsigned DefaultLabel, unsigned Depth,
+                           const char* Compare, int MinFlags)
+/* Generate the checks for the runs in R. The selector byte is known to be
+** in the range Min..Max, values not covered by one of the runs go to the
+** default label. If MinFlags is true, the flags are still set from a compare
+** of the selector byte with Min.
+*/
 {
-    unsigned NextLabel = 0;
     unsigned I;
 
+    /* Split the runs in two halves if there are too many of them */
+    if (Count > SwitchLinearLimit ()) {
+
+        unsigned Mid        = Count / 2;
+        unsigned Split      = R[Mid].Lo;
+        unsigned UpperLabel = GetLocalLabel ();
+
+        AddCodeLine (Compare, Split);
+        AddCodeLine ("jcs %s", LocalLabelName (UpperLabel));
+        g_switchlevel (R, Mid, Min, Split - 1, DefaultLabel, Depth, Compare, 0);
+        g_defcodelabel (UpperLabel);
+        g_switchlevel (R + Mid, Count - Mid, Split, Max, DefaultLabel, Depth, Compare, 1);
+        return;
+    }
+
+    /* Check the runs in ascending order */
+    for (I = 0; I < Count; ++I) {
+
+        unsigned Lo = R[I].Lo;
+        unsigned Hi = R[I].Hi;
+        unsigned NextLabel;
+
+        if (Depth == 1) {
+
+            /* If the run covers all remaining values, we're done */
+            if (Lo <= Min && Hi >= Max) {
+                g_jump (R[I].Label);
+                return;
+            }
+
+            if (Lo == Hi) {
+                if (!MinFlags || Lo != Min) {
+                    AddCodeLine (Compare, Lo);
+                }
+                g_falsejump (0, R[I].Label);
+                if (Lo == Min) {
+                    ++Min;
+                }
+            } else {
+                /* All smaller values have been checked before, so anything
+                ** below the run goes to the default label.
+                */
+                if (Lo > Min) {
+                    AddCodeLine (Compare, Lo);
+                    AddCodeLine ("jcc %s", LocalLabelName (DefaultLabel));
+                }
+                if (Hi >= Max) {
+                    g_jump (R[I].Label);
+                    return;
+                }
+                AddCodeLine (Compare, Hi + 1);
+                AddCodeLine ("jcc %s", LocalLabelName (R[I].Label));
+                Min = Hi + 1;
+            }
+
+        } else {
+
+            /* If this is the only value possible, no compare is needed */
+            if (Lo == Min && Lo == Max) {
+                g_switch (R[I].Nodes, DefaultLabel, Depth - 1);
+                return;
+            }
+
+            /* Check the value and the next level */
+            NextLabel = GetLocalLabel ();
+            if (!MinFlags || Lo != Min) {
+                AddCodeLine (Compare, Lo);
+            }
+            g_truejump (0, NextLabel);
+            g_switch (R[I].Nodes, DefaultLabel, Depth - 1);
+            g_defcodelabel (NextLabel);
+            if (Lo == Min) {
+                ++Min;
+            }
+        }
+
+        /* The flags are from a compare made here from now on */
+        MinFlags = 0;
+    }
+
+    /* If we go here, we haven't found the label */
+    g_jump (DefaultLabel);
+}
+
+
+
+void g_switch (Collection* Nodes, unsigned DefaultLabel, unsigned Depth)
+/* Generate code for a switch statement. The case values on each level of the
+** case node tree are combined into runs of consecutive values with the same
+** label, which are then checked by range compares and, if there are many of
+** them, a binary search over the sorted nodes.
+*/
+{
+    SwitchRange R[256];
+    unsigned    Count = 0;
+    unsigned    I;
+
     /* Setup registers and determine which compare insn to use */
     const char* Compare;
     switch (Depth) {
@@ -4670,47 +5426,30 @@ void g_switch (Collection* Nodes, unsigned DefaultLabel, unsigned Depth)
             Internal ("Invalid depth in g_switch: %u", Depth);
     }
 
-    /* Walk over all nodes */
+    /* Build the runs. The nodes are sorted by value. */
     for (I = 0; I < CollCount (Nodes); ++I) {
 
         /* Get the next case node */
-        CaseNode* N = CollAtUnchecked (Nodes, I);
-
-        /* If we have a next label, define it */
-        if (NextLabel) {
-            g_defcodelabel (NextLabel);
-            NextLabel = 0;
-        }
-
-        /* Do the compare */
-        AddCodeLine (Compare, CN_GetValue (N));
-
-        /* If this is the last level, jump directly to the case code if found */
-        if (Depth == 1) {
-
-            /* Branch if equal */
-            g_falsejump (0, CN_GetLabel (N));
-
+        const CaseNode* N = CollAtUnchecked (Nodes, I);
+        unsigned Value    = CN_GetValue (N);
+
+        if (Depth == 1                          &&
+            Count > 0                           &&
+            R[Count-1].Hi + 1 == Value          &&
+            R[Count-1].Label == CN_GetLabel (N)) {
+            /* Extend the last run */
+            R[Count-1].Hi = Value;
         } else {
-
-            /* Determine the next label */
-            if (I == CollCount (Nodes) - 1) {
-                /* Last node means not found */
-                g_truejump (0, DefaultLabel);
-            } else {
-                /* Jump to the next check */
-                NextLabel = GetLocalLabel ();
-                g_truejump (0, NextLabel);
-            }
-
-            /* Check the next level */
-            g_switch (N->Nodes, DefaultLabel, Depth-1);
-
+            R[Count].Lo    = Value;
+            R[Count].Hi    = Value;
+            R[Count].Label = (Depth == 1)? CN_GetLabel (N) : 0;
+            R[Count].Nodes = N->Nodes;
+            ++Count;
         }
     }
 
-    /* If we go here, we haven't found the label */
-    g_jump (DefaultLabel);
+    /* Generate the checks */
+    g_switchlevel (R, Count, 0x00, 0xFF, DefaultLabel, Depth, Compare, 0);
 }
 
 
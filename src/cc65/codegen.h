@@ -177,6 +177,9 @@ void g_importstartup (void);
 void g_importmainargs (void);
 /* Forced import of a special symbol that handles arguments to main */
 
+void g_defframelabel (unsigned Label, unsigned Offs);
+/* Define a local data label for a variable in the frame area */
+
 
 
 /*****************************************************************************/
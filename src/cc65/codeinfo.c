@@ -42,6 +42,7 @@
 #include "debugflag.h"
 
 /* cc65 */
+#include "callgraph.h"
 #include "codeent.h"
 #include "codeseg.h"
 #include "datatype.h"
@@ -468,6 +469,8 @@ fncls_t GetFuncInfo (const char* Name, unsigned int* Use, unsigned int* Chg)
 ** load all registers as well as touching the processor flags.
 */
 {
+    unsigned RegUse, RegChg;
+
     /* If the function name starts with an underline, it is an external
     ** function. Search for it in the symbol table. If the function does
     ** not start with an underline, it may be a runtime support function.
@@ -521,11 +524,24 @@ fncls_t GetFuncInfo (const char* Name, unsigned int* Use, unsigned int* Chg)
                 *Use = REG_NONE;
             }
 
-            /* Will destroy all registers */
-            *Chg = REG_ALL;
+            /* If the function has already been optimized, or its registers
+            ** are known from the call graph of the program, use what it
+            ** really does. The descriptor may be shared with other functions
+            ** declared by the same typedef, so check the owner.
+            */
+            if (D->RegFunc == E) {
+                *Use |= D->RegUse;
+                *Chg  = D->RegChg;
+            } else if (CG_GetRegs (E, &RegUse, &RegChg)) {
+                *Use |= RegUse;
+                *Chg  = RegChg;
+            } else {
+                /* Will destroy all registers */
+                *Chg = REG_ALL;
 
-            /* and will destroy all processor flags */
-            *Chg |= PSTATE_ALL;
+                /* and will destroy all processor flags */
+                *Chg |= PSTATE_ALL;
+            }
 
             /* Done */
             return FNCLS_GLOBAL;
@@ -581,6 +597,46 @@ fncls_t GetFuncInfo (const char* Name, unsigned int* Use, unsigned int* Chg)
 
 
 
+void SetFuncInfo (CodeSeg* S)
+/* Determine the registers used and changed by the function that owns the
+** given code segment, and remember them for calls to the function. Must be
+** called after the segment has been optimized.
+*/
+{
+    FuncDesc* D = GetFuncDesc (S->Func->Type);
+    unsigned  Use;
+    unsigned  Chg = REG_NONE;
+    unsigned  I;
+
+    /* Registers that are used before they are changed. The C stack pointer
+    ** is always valid and not tracked for calls.
+    */
+    Use = GetRegInfo (S, 0, REG_ALL) & REG_ALL & ~REG_SP;
+
+    /* Registers changed by the function, including everything changed by
+    ** called functions. Branches to labels outside of the function may end
+    ** up anywhere.
+    */
+    for (I = 0; I < CS_GetEntryCount (S); ++I) {
+        const CodeEntry* E = CS_GetEntry (S, I);
+        if ((E->Info & OF_CBRA) != 0 && E->JumpTo == 0) {
+            Chg = REG_ALL | PSTATE_ALL;
+            break;
+        }
+        Chg |= E->Chg;
+    }
+
+    /* Remember the info */
+    D->RegFunc = S->Func;
+    D->RegUse  = Use;
+    D->RegChg  = Chg;
+
+    /* Record it in the call graph */
+    CG_FuncRegs (S->Func, Use, Chg);
+}
+
+
+
 static int CompareZPInfo (const void* Name, const void* Info)
 /* Compare function for bsearch */
 {
@@ -173,6 +173,12 @@ fncls_t GetFuncInfo (const char* Name, unsigned int* Use, unsigned int* Chg);
 ** Return the whatever category the function is in.
 */
 
+void SetFuncInfo (struct CodeSeg* S);
+/* Determine the registers used and changed by the function that owns the
+** given code segment, and remember them for calls to the function. Must be
+** called after the segment has been optimized.
+*/
+
 const ZPInfo* GetZPInfo (const char* Name);
 /* If the given name is a zero page symbol, return a pointer to the info
 ** struct for this symbol, otherwise return NULL.
@@ -1473,6 +1473,19 @@ void CS_Output (CodeSeg* S)
 
 
 
+void CS_UpdateFuncInfo (CodeSeg* S)
+/* Update the register usage of all calls with the current information about
+** the called functions.
+*/
+{
+    unsigned I;
+    for (I = 0; I < CS_GetEntryCount (S); ++I) {
+        CE_UpdateFuncInfo (CS_GetEntry (S, I));
+    }
+}
+
+
+
 void CS_FreeRegInfo (CodeSeg* S)
 /* Free register infos for all instructions */
 {
@@ -288,6 +288,11 @@ void CS_OutputEpilogue (const CodeSeg* S);
 void CS_Output (CodeSeg* S);
 /* Output the code segment data to a file */
 
+void CS_UpdateFuncInfo (CodeSeg* S);
+/* Update the register usage of all calls with the current information about
+** the called functions.
+*/
+
 void CS_FreeRegInfo (CodeSeg* S);
 /* Free register infos for all instructions */
 
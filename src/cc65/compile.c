@@ -47,8 +47,11 @@
 /* cc65 */
 #include "asmlabel.h"
 #include "asmstmt.h"
+#include "callgraph.h"
 #include "codegen.h"
+#include "codeinfo.h"
 #include "codeopt.h"
+#include "codeseg.h"
 #include "compile.h"
 #include "declare.h"
 #include "error.h"
@@ -60,6 +63,7 @@
 #include "macrotab.h"
 #include "output.h"
 #include "pragma.h"
+#include "precomp.h"
 #include "preproc.h"
 #include "standard.h"
 #include "staticassert.h"
@@ -174,6 +178,10 @@ static void Parse (void)
             ** or semicolon, it must be followed by a function body.
             */
             if ((Decl.StorageClass & SC_FUNC) != 0) {
+                /* Remember the inline hint for the inliner */
+                if ((Spec.Flags & DS_INLINE) != 0) {
+                    Decl.StorageClass |= SC_INLINE;
+                }
                 if (CurTok.Tok != TOK_COMMA && CurTok.Tok != TOK_SEMI) {
                     /* A definition */
                     Decl.StorageClass |= SC_DEF;
@@ -189,6 +197,8 @@ static void Parse (void)
                     /* Just a declaration */
                     Decl.StorageClass |= SC_DECL;
                 }
+            } else if ((Spec.Flags & DS_INLINE) != 0) {
+                Error ("'inline' is only allowed for functions");
             }
 
             /* Add an entry to the symbol table */
@@ -418,9 +428,24 @@ void Compile (const char* FileName)
     /* Generate the code generator preamble */
     g_preamble ();
 
+    /* Remember the state before the file that is precompiled */
+    if (Precompile) {
+        PrecompStart ();
+    }
+
     /* Open the input file */
     OpenMainFile (FileName);
 
+    /* The prefix header is read before the input file. Use the precompiled
+    ** version if there is one.
+    */
+    if (SB_NotEmpty (&PrefixHeader)) {
+        SB_Terminate (&PrefixHeader);
+        if (!PrecompLoad (SB_GetConstBuf (&PrefixHeader))) {
+            OpenPrefixFile (SB_GetConstBuf (&PrefixHeader));
+        }
+    }
+
     /* Are we supposed to compile or just preprocess the input? */
     if (PreprocessOnly) {
 
@@ -444,6 +469,11 @@ void Compile (const char* FileName)
         /* Ok, start the ball rolling... */
         Parse ();
 
+        /* Write the precompiled header if requested */
+        if (Precompile) {
+            PrecompDone ();
+        }
+
         /* Reset the BSS segment name to its default; so that the below strcmp()
         ** will work as expected, at the beginning of the list of variables
         */
@@ -519,7 +549,13 @@ void FinishCompile (void)
             /* Function which is defined and referenced or extern */
             MoveLiteralPool (Entry->V.F.LitPool);
             CS_MergeLabels (Entry->V.F.Seg->Code);
+            CS_UpdateFuncInfo (Entry->V.F.Seg->Code);
             RunOpt (Entry->V.F.Seg->Code);
+
+            /* Remember the registers the function really uses and changes,
+            ** so the functions optimized after it can make use of them.
+            */
+            SetFuncInfo (Entry->V.F.Seg->Code);
         }
     }
 
@@ -529,6 +565,9 @@ void FinishCompile (void)
     /* Emit debug infos if enabled */
     EmitDebugInfo ();
 
+    /* Define or import the area for static frames */
+    CG_EmitFrames ();
+
     /* Write imported/exported symbols */
     EmitExternals ();
 
@@ -134,47 +134,61 @@ static short RegVal (unsigned short Use, const RegContents* RC)
 
 
 unsigned OptBranchDist (CodeSeg* S)
-/* Change branches for the distance needed. */
+/* Change branches for the distance needed. Short branches that are out of
+** range are made long first, until there are no more of them. Since making
+** a branch long moves the insns behind it, this may push other short
+** branches out of range. Long branches are made short only after that,
+** because this shrinks the code, and so cannot make any other branch go
+** out of range.
+*/
 {
     unsigned Changes = 0;
+    unsigned C;
+    unsigned I;
 
-    /* Walk over the entries */
-    unsigned I = 0;
-    while (I < CS_GetEntryCount (S)) {
+    /* Make branches long where needed */
+    do {
+        C = 0;
+        for (I = 0; I < CS_GetEntryCount (S); ++I) {
 
-        /* Get next entry */
-        CodeEntry* E = CS_GetEntry (S, I);
-
-        /* Check if it's a conditional branch to a local label. */
-        if (E->Info & OF_CBRA) {
+            /* Get next entry */
+            CodeEntry* E = CS_GetEntry (S, I);
 
-            /* Is this a branch to a local symbol? */
-            if (E->JumpTo != 0) {
+            /* Check for a short branch */
+            if (((E->Info & OF_CBRA) == 0 && E->OPC != OP65_BRA) ||
+                (E->Info & OF_LBRA) != 0) {
+                continue;
+            }
 
-                /* Check if the branch distance is short */
-                int IsShort = IsShortDist (GetBranchDist (S, I, E->JumpTo->Owner));
+            /* A branch to an external symbol is always made long */
+            if (E->JumpTo == 0 ||
+                !IsShortDist (GetBranchDist (S, I, E->JumpTo->Owner))) {
+                CE_ReplaceOPC (E, (E->OPC == OP65_BRA)? OP65_JMP : MakeLongBranch (E->OPC));
+                ++C;
+            }
+        }
+        Changes += C;
+    } while (C > 0);
 
-                /* Make the branch short/long according to distance */
-                if ((E->Info & OF_LBRA) == 0 && !IsShort) {
-                    /* Short branch but long distance */
-                    CE_ReplaceOPC (E, MakeLongBranch (E->OPC));
-                    ++Changes;
-                } else if ((E->Info & OF_LBRA) != 0 && IsShort) {
-                    /* Long branch but short distance */
-                    CE_ReplaceOPC (E, MakeShortBranch (E->OPC));
-                    ++Changes;
-                }
+    /* Make branches short where possible */
+    for (I = 0; I < CS_GetEntryCount (S); ++I) {
 
-            } else if ((E->Info & OF_LBRA) == 0) {
+        /* Get next entry */
+        CodeEntry* E = CS_GetEntry (S, I);
 
-                /* Short branch to external symbol - make it long */
-                CE_ReplaceOPC (E, MakeLongBranch (E->OPC));
-                ++Changes;
+        /* Check if it's a long conditional branch to a local label with
+        ** a short distance.
+        */
+        if ((E->Info & OF_CBRA) != 0                            &&
+            (E->Info & OF_LBRA) != 0                            &&
+            E->JumpTo != 0                                      &&
+            IsShortDist (GetBranchDist (S, I, E->JumpTo->Owner))) {
 
-            }
+            CE_ReplaceOPC (E, MakeShortBranch (E->OPC));
+            ++Changes;
 
         } else if ((CPUIsets[CPU] & (CPU_ISET_65SC02 |CPU_ISET_6502DTV)) != 0 &&
-                   (E->Info & OF_UBRA) != 0               &&
+                   E->OPC == OP65_JMP                     &&
                    E->JumpTo != 0                         &&
                    IsShortDist (GetBranchDist (S, I, E->JumpTo->Owner))) {
 
@@ -182,10 +196,6 @@ unsigned OptBranchDist (CodeSeg* S)
             CE_ReplaceOPC (E, OP65_BRA);
             ++Changes;
         }
-
-        /* Next entry */
-        ++I;
-
     }
 
     /* Return the number of changes made */
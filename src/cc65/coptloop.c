@@ -0,0 +1,690 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                 coptloop.c                                */
+/*                                                                           */
+/*                  Optimize loops with byte sized counters                  */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#include <stdlib.h>
+#include <string.h>
+
+/* cc65 */
+#include "codeent.h"
+#include "codeinfo.h"
+#include "coptloop.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Maximum number of insns looked at when following the flow of control */
+#define MAX_SCAN        64
+
+
+/* A loop in the code segment. The loop consists of the insns from Head to
+** Tail, where Tail is a conditional branch back to Head. The loop is either
+** entered by falling into Head, or by a jump to the loop condition at the
+** bottom, which is then the insn before Head.
+*/
+typedef struct LoopDesc LoopDesc;
+struct LoopDesc {
+    unsigned    Head;           /* Index of the first insn of the loop */
+    unsigned    Tail;           /* Index of the branch back to Head */
+    int         Jump;           /* True if entered by a jump at Head-1 */
+};
+
+/* The loop counter */
+typedef struct CounterDesc CounterDesc;
+struct CounterDesc {
+    char        Name[32];       /* Name of the memory location */
+    am_t        AM;             /* Addressing mode for the location */
+    long        RegBankOffs;    /* Offset into the register bank or -1 */
+};
+
+
+
+/*****************************************************************************/
+/*                             Helper functions                              */
+/*****************************************************************************/
+
+
+
+static long GetRegBankOffs (const char* Arg)
+/* If Arg is a location in the register bank, return the offset, otherwise
+** return -1.
+*/
+{
+    long Offs = 0;
+
+    if (Arg == 0 || strncmp (Arg, "regbank", 7) != 0) {
+        return -1;
+    }
+    Arg += 7;
+    while (*Arg == '+') {
+        char* End;
+        Offs += strtol (Arg + 1, &End, 10);
+        if (End == Arg + 1) {
+            return -1;
+        }
+        Arg = End;
+    }
+    return (*Arg == '\0')? Offs : -1;
+}
+
+
+
+static int InitCounter (CounterDesc* C, const CodeEntry* E)
+/* Setup C for the counter that is incremented or decremented by E. Return
+** true if the location may be used as a loop counter. These are register
+** variables and static locals, because they cannot be volatile and cannot
+** be changed by other code behind our back.
+*/
+{
+    if ((E->AM != AM65_ZP && E->AM != AM65_ABS) ||
+        strlen (E->Arg) >= sizeof (C->Name)) {
+        return 0;
+    }
+    strcpy (C->Name, E->Arg);
+    C->AM          = E->AM;
+    C->RegBankOffs = GetRegBankOffs (E->Arg);
+    if (C->RegBankOffs >= 0) {
+        return 1;
+    }
+    return (E->Arg[0] == 'M' && strlen (E->Arg) == 5 &&
+            strspn (E->Arg + 1, "0123456789ABCDEF") == 4);
+}
+
+
+
+static int RefersTo (const CodeEntry* E, const CounterDesc* C)
+/* Return true if E accesses the memory location of the counter */
+{
+    long Offs;
+
+    if (E->Arg == 0) {
+        return 0;
+    }
+    if (C->RegBankOffs < 0) {
+        return strcmp (E->Arg, C->Name) == 0;
+    }
+    if ((Offs = GetRegBankOffs (E->Arg)) < 0) {
+        /* The register bank is swapped with the stack by some routines */
+        return (E->OPC == OP65_JSR && strncmp (E->Arg, "regswap", 7) == 0);
+    }
+    if (Offs == C->RegBankOffs) {
+        return 1;
+    }
+    /* A pointer in the register bank covers two bytes */
+    return ((E->AM == AM65_ZP_INDY      ||
+             E->AM == AM65_ZP_IND       ||
+             E->AM == AM65_ZPX_IND)             &&
+            Offs + 1 == C->RegBankOffs);
+}
+
+
+
+static int IsCounterAccess (const CodeEntry* E, const CounterDesc* C, opc_t OPC)
+/* Return true if E is the insn OPC with the counter as direct operand */
+{
+    return (E->OPC == OPC                                       &&
+            (E->AM == AM65_ZP || E->AM == AM65_ABS)             &&
+            RefersTo (E, C));
+}
+
+
+
+static int CounterIsUsed (CodeSeg* S, unsigned I, const CounterDesc* C)
+/* Check if the value of the counter is used starting at index I. This is a
+** simple linear search that stops at the first access, and assumes that the
+** value is used if the flow of control splits before.
+*/
+{
+    unsigned Count = 0;
+    while (I < CS_GetEntryCount (S) && ++Count < MAX_SCAN) {
+        const CodeEntry* E = CS_GetEntry (S, I++);
+        if (RefersTo (E, C)) {
+            return (E->Info & OF_READ) != 0             ||
+                   (E->AM != AM65_ZP && E->AM != AM65_ABS);
+        }
+        if (E->OPC == OP65_JMP && E->JumpTo != 0) {
+            I = CS_GetEntryIndex (S, E->JumpTo->Owner);
+        } else if ((E->Info & (OF_BRA | OF_RET | OF_CALL)) != 0) {
+            return 1;
+        }
+    }
+    return 1;
+}
+
+
+
+static int FlagsUsed (CodeSeg* S, unsigned I, unsigned Flags)
+/* Check if any of the given processor flags is used starting at index I
+** before it is changed. Calls are assumed to change all flags.
+*/
+{
+    unsigned Count = 0;
+    while (I < CS_GetEntryCount (S) && ++Count < MAX_SCAN) {
+        const CodeEntry* E = CS_GetEntry (S, I++);
+        if ((E->Use & Flags) != 0) {
+            return 1;
+        }
+        if ((E->Info & OF_CALL) != 0) {
+            return 0;
+        }
+        Flags &= ~E->Chg;
+        if (Flags == 0) {
+            return 0;
+        }
+        if (E->OPC == OP65_JMP && E->JumpTo != 0) {
+            I = CS_GetEntryIndex (S, E->JumpTo->Owner);
+        } else if ((E->Info & (OF_BRA | OF_RET)) != 0) {
+            return 1;
+        }
+    }
+    return 1;
+}
+
+
+
+static int GetLoop (CodeSeg* S, unsigned I, LoopDesc* L)
+/* If the entry at index I is a conditional branch back to the start of a
+** loop that has no other entries and exits than the ones described above,
+** fill in L and return true.
+*/
+{
+    unsigned J;
+    CodeEntry* E = CS_GetEntry (S, I);
+
+    /* Must be a conditional branch backwards */
+    if ((E->Info & OF_CBRA) == 0 || E->JumpTo == 0) {
+        return 0;
+    }
+    L->Head = CS_GetEntryIndex (S, E->JumpTo->Owner);
+    L->Tail = I;
+    if (L->Head >= L->Tail) {
+        return 0;
+    }
+
+    /* Check for a jump to the loop condition that enters the loop */
+    L->Jump = 0;
+    if (L->Head > 0) {
+        CodeEntry* P = CS_GetEntry (S, L->Head - 1);
+        if (P->OPC == OP65_JMP && P->JumpTo != 0) {
+            unsigned T = CS_GetEntryIndex (S, P->JumpTo->Owner);
+            L->Jump = (T > L->Head && T <= L->Tail && !CE_HasLabel (P));
+        }
+    }
+
+    /* Check the labels and jumps of all insns in the loop */
+    for (J = L->Head; J <= L->Tail; ++J) {
+
+        unsigned K;
+        E = CS_GetEntry (S, J);
+
+        /* All labels must be referenced from within the loop */
+        for (K = 0; K < CE_GetLabelCount (E); ++K) {
+            CodeLabel* Label = CE_GetLabel (E, K);
+            unsigned R;
+            for (R = 0; R < CL_GetRefCount (Label); ++R) {
+                unsigned From = CS_GetEntryIndex (S, CL_GetRef (Label, R));
+                if ((From < L->Head || From > L->Tail) &&
+                    (!L->Jump || From != L->Head - 1)) {
+                    return 0;
+                }
+            }
+        }
+
+        /* Jumps must stay in the loop or go to the insn behind it */
+        if ((E->Info & OF_RET) != 0) {
+            return 0;
+        }
+        if ((E->Info & OF_BRA) != 0) {
+            unsigned T;
+            if (E->JumpTo == 0) {
+                return 0;
+            }
+            T = CS_GetEntryIndex (S, E->JumpTo->Owner);
+            if (T < L->Head || T > L->Tail + 1) {
+                return 0;
+            }
+        }
+    }
+
+    /* There must be an insn behind the loop */
+    return L->Tail + 1 < CS_GetEntryCount (S);
+}
+
+
+
+static int ExitLabelsLocal (CodeSeg* S, const LoopDesc* L)
+/* Return true if the insn behind the loop is reached from the loop only */
+{
+    unsigned K;
+    CodeEntry* E = CS_GetEntry (S, L->Tail + 1);
+
+    for (K = 0; K < CE_GetLabelCount (E); ++K) {
+        CodeLabel* Label = CE_GetLabel (E, K);
+        unsigned R;
+        for (R = 0; R < CL_GetRefCount (Label); ++R) {
+            unsigned From = CS_GetEntryIndex (S, CL_GetRef (Label, R));
+            if (From < L->Head || From > L->Tail) {
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+
+
+/*****************************************************************************/
+/*                           Count loops downwards                           */
+/*****************************************************************************/
+
+
+
+unsigned OptLoopCountDown (CodeSeg* S)
+/* Search for loops with a byte sized counter that is counted up from a
+** known start value to a constant end value, and is not used otherwise,
+** and replace them by a counter that is counted down to zero.
+*/
+{
+    unsigned Changes = 0;
+
+    /* Walk over the entries */
+    unsigned I = 0;
+    while (I < CS_GetEntryCount (S)) {
+
+        LoopDesc    L;
+        CounterDesc C;
+        CodeEntry*  E[6];
+        short       Start;
+        unsigned    Trips;
+        unsigned    J;
+        opc_t       Load;
+        unsigned    Reg;
+
+        /* Check for a loop entered by a jump to the test */
+        if (!GetLoop (S, I, &L) || !L.Jump || L.Head < 2 || L.Tail < L.Head + 3) {
+            ++I;
+            continue;
+        }
+
+        /* Check the loop test and the setup of the counter:
+        **
+        **      E[0]:   sta     cnt
+        **      E[1]:   jmp     E[3]
+        **              ...
+        **      E[2]:   inc     cnt
+        **      E[3]:   lda     cnt
+        **      E[4]:   cmp     #end
+        **      E[5]:   bcc/bne Head
+        */
+        E[0] = CS_GetEntry (S, L.Head - 2);
+        E[1] = CS_GetEntry (S, L.Head - 1);
+        CS_GetEntries (S, E+2, L.Tail - 3, 4);
+        if (E[2]->OPC != OP65_INC                               ||
+            !InitCounter (&C, E[2])                             ||
+            !IsCounterAccess (E[3], &C, OP65_LDA)               ||
+            E[1]->JumpTo->Owner != E[3]                         ||
+            CL_GetRefCount (E[1]->JumpTo) != 1                  ||
+            CE_GetLabelCount (E[3]) != 1                        ||
+            E[4]->OPC != OP65_CMP                               ||
+            !CE_IsConstImm (E[4])                               ||
+            CE_HasLabel (E[4])                                  ||
+            CE_HasLabel (E[0])) {
+            ++I;
+            continue;
+        }
+
+        /* Determine the start value from the register that is stored */
+        switch (E[0]->OPC) {
+            case OP65_STA:
+                Start = E[0]->RI->In.RegA;
+                Load  = OP65_LDA;
+                Reg   = REG_A;
+                break;
+            case OP65_STX:
+                Start = E[0]->RI->In.RegX;
+                Load  = OP65_LDX;
+                Reg   = REG_X;
+                break;
+            case OP65_STY:
+                Start = E[0]->RI->In.RegY;
+                Load  = OP65_LDY;
+                Reg   = REG_Y;
+                break;
+            default:
+                Start = -1;
+                Load  = OP65_LDA;
+                Reg   = REG_A;
+                break;
+        }
+        if (!RegValIsKnown (Start) ||
+            (E[0]->AM != AM65_ZP && E[0]->AM != AM65_ABS) ||
+            !RefersTo (E[0], &C)) {
+            ++I;
+            continue;
+        }
+
+        /* Determine the number of iterations. It must not be zero, because
+        ** the first test is removed.
+        */
+        switch (E[5]->OPC) {
+            case OP65_BCC:
+            case OP65_JCC:
+                Trips = (Start < (long) E[4]->Num)? E[4]->Num - Start : 0;
+                break;
+            case OP65_BNE:
+            case OP65_JNE:
+                Trips = (E[4]->Num - Start) & 0xFF;
+                break;
+            default:
+                Trips = 0;
+                break;
+        }
+        if (Trips == 0) {
+            ++I;
+            continue;
+        }
+
+        /* The counter must not be used in the loop body, or after the loop.
+        ** The registers and flags set by the loop test must not be used
+        ** at the start of the body and after the loop, because the new
+        ** test leaves other values.
+        */
+        for (J = L.Head; J < L.Tail - 3; ++J) {
+            if (RefersTo (CS_GetEntry (S, J), &C)) {
+                break;
+            }
+        }
+        if (J < L.Tail - 3                                      ||
+            CounterIsUsed (S, L.Tail + 1, &C)                   ||
+            RegAUsed (S, L.Tail + 1)                            ||
+            FlagsUsed (S, L.Tail + 1, PSTATE_CZN)               ||
+            (GetRegInfo (S, L.Head, REG_A | Reg) & (REG_A | Reg)) != 0 ||
+            FlagsUsed (S, L.Head, PSTATE_CZN)) {
+            ++I;
+            continue;
+        }
+
+        /* Replace the test by a decrement and a branch on not zero */
+        CE_ReplaceOPC (E[2], OP65_DEC);
+        CE_ReplaceOPC (E[5], (E[5]->Info & OF_LBRA)? OP65_JNE : OP65_BNE);
+        CS_DelEntries (S, L.Tail - 2, 2);
+
+        /* Remove the jump, which also removes the label at the test, and
+        ** load the number of iterations into the counter.
+        */
+        CS_DelEntry (S, L.Head - 1);
+        CS_InsertEntry (S, NewCodeEntry (Load, AM65_IMM, MakeHexArg (Trips),
+                                         0, E[0]->LI), L.Head - 2);
+
+        /* Remember, we had changes */
+        ++Changes;
+
+        /* Continue behind the loop */
+        I = L.Tail;
+    }
+
+    /* Return the number of changes made */
+    return Changes;
+}
+
+
+
+/*****************************************************************************/
+/*                   Keep loop counters in index registers                   */
+/*****************************************************************************/
+
+
+
+static int CanUseIndexReg (CodeSeg* S, const LoopDesc* L, const CounterDesc* C,
+                           unsigned Reg)
+/* Check if the counter C may be held in the index register Reg (REG_X or
+** REG_Y) while the loop L is running. Loads of the counter into A that are
+** followed by a compare are marked if the compare may use the index register
+** instead.
+*/
+{
+    opc_t    LoadReg = (Reg == REG_Y)? OP65_LDY : OP65_LDX;
+    unsigned J;
+
+    CS_ResetMarks (S, L->Head, L->Tail);
+
+    for (J = L->Head; J <= L->Tail; ++J) {
+
+        CodeEntry* E = CS_GetEntry (S, J);
+
+        if (RefersTo (E, C)) {
+            CodeEntry* N;
+            if (E->AM != AM65_ZP && E->AM != AM65_ABS) {
+                return 0;
+            }
+            if (E->OPC == OP65_LDA) {
+                /* Check if this is the load for a compare */
+                N = CS_GetNextEntry (S, J);
+                if (N->OPC == OP65_CMP                          &&
+                    (N->AM == AM65_IMM          ||
+                     N->AM == AM65_ZP           ||
+                     N->AM == AM65_ABS)                         &&
+                    !RefersTo (N, C)                            &&
+                    !CE_HasLabel (N)                            &&
+                    !RegAUsed (S, J + 2)) {
+                    CE_SetMark (E);
+                }
+            } else if (E->OPC != LoadReg        &&
+                       E->OPC != OP65_INC       &&
+                       E->OPC != OP65_DEC) {
+                return 0;
+            }
+            continue;
+        }
+
+        /* Other insns must not change the register */
+        if ((E->Chg & Reg) != 0) {
+            return 0;
+        }
+
+        /* If the register is used, it must have been loaded with the counter
+        ** before, without a change of the counter in between.
+        */
+        if ((E->Use & Reg) != 0) {
+            unsigned K = J;
+            while (1) {
+                CodeEntry* P;
+                if (CE_HasLabel (CS_GetEntry (S, K)) || K == L->Head) {
+                    return 0;
+                }
+                P = CS_GetEntry (S, --K);
+                if (IsCounterAccess (P, C, LoadReg)) {
+                    break;
+                }
+                if (RefersTo (P, C) && P->OPC != OP65_LDA) {
+                    return 0;
+                }
+            }
+        }
+    }
+
+    /* The old contents of the register must not be used behind the loop */
+    if ((GetRegInfo (S, L->Tail + 1, Reg) & Reg) != 0) {
+        return 0;
+    }
+
+    /* Loading the register where the loop is entered changes the flags */
+    J = L->Jump? CS_GetEntryIndex (S, CS_GetEntry (S, L->Head - 1)->JumpTo->Owner)
+               : L->Head;
+    if ((CS_GetEntry (S, J)->Use & PSTATE_ZN) != 0) {
+        return 0;
+    }
+
+    /* Ok */
+    return 1;
+}
+
+
+
+static void UseIndexReg (CodeSeg* S, const LoopDesc* L, const CounterDesc* C,
+                         unsigned Reg, int Store)
+/* Hold the counter C in the index register Reg while the loop L is running.
+** If Store is true, the counter is stored back behind the loop.
+*/
+{
+    int        IsY  = (Reg == REG_Y);
+    CodeEntry* Exit = CS_GetEntry (S, L->Tail + 1);
+    CodeEntry* X;
+    unsigned   J;
+
+    /* Rewrite the accesses to the counter. Work backwards, so the indices
+    ** of the insns not yet handled don't change.
+    */
+    J = L->Tail + 1;
+    while (J-- > L->Head) {
+
+        CodeEntry* E = CS_GetEntry (S, J);
+        if (!RefersTo (E, C)) {
+            continue;
+        }
+
+        switch (E->OPC) {
+            case OP65_LDA:
+                if (CE_HasMark (E)) {
+                    /* Compare the register directly */
+                    CodeEntry* N = CS_GetEntry (S, J + 1);
+                    X = NewCodeEntry (IsY? OP65_CPY : OP65_CPX, N->AM, N->Arg, 0, N->LI);
+                    CS_InsertEntry (S, X, J + 2);
+                    CS_DelEntry (S, J + 1);
+                } else {
+                    X = NewCodeEntry (IsY? OP65_TYA : OP65_TXA, AM65_IMP, 0, 0, E->LI);
+                    CS_InsertEntry (S, X, J + 1);
+                }
+                break;
+            case OP65_INC:
+                X = NewCodeEntry (IsY? OP65_INY : OP65_INX, AM65_IMP, 0, 0, E->LI);
+                CS_InsertEntry (S, X, J + 1);
+                break;
+            case OP65_DEC:
+                X = NewCodeEntry (IsY? OP65_DEY : OP65_DEX, AM65_IMP, 0, 0, E->LI);
+                CS_InsertEntry (S, X, J + 1);
+                break;
+            default:
+                /* The load of the register */
+                break;
+        }
+
+        /* Delete the old insn. Labels are moved to the next one. */
+        CS_DelEntry (S, J);
+    }
+
+    /* Store the counter behind the loop if it's still used there */
+    if (Store) {
+        X = NewCodeEntry (IsY? OP65_STY : OP65_STX, C->AM, C->Name, 0, Exit->LI);
+        CS_InsertEntry (S, X, CS_GetEntryIndex (S, Exit));
+        CS_MoveLabels (S, Exit, X);
+    }
+
+    /* Load the counter into the register where the loop is entered. If the
+    ** counter has just been stored, transfer it from A instead.
+    */
+    J = L->Jump? L->Head - 1 : L->Head;
+    if (J > 0 && IsCounterAccess (CS_GetEntry (S, J - 1), C, OP65_STA)) {
+        X = NewCodeEntry (IsY? OP65_TAY : OP65_TAX, AM65_IMP, 0, 0,
+                          CS_GetEntry (S, J - 1)->LI);
+    } else {
+        X = NewCodeEntry (IsY? OP65_LDY : OP65_LDX, C->AM, C->Name, 0,
+                          CS_GetEntry (S, L->Head)->LI);
+    }
+    CS_InsertEntry (S, X, J);
+}
+
+
+
+unsigned OptLoopIndex (CodeSeg* S)
+/* Search for loops with a byte sized counter, and keep the counter in the Y
+** or X register while the loop is running.
+*/
+{
+    unsigned Changes = 0;
+
+    /* Walk over the entries */
+    unsigned I = 0;
+    while (I < CS_GetEntryCount (S)) {
+
+        LoopDesc    L;
+        CounterDesc C;
+        unsigned    J;
+        unsigned    Reg = REG_NONE;
+        int         Store = 0;
+
+        /* Check for a loop */
+        if (!GetLoop (S, I, &L)) {
+            ++I;
+            continue;
+        }
+
+        /* Search for an increment or decrement of a counter, and check if
+        ** the counter may be held in an index register.
+        */
+        for (J = L.Head; J <= L.Tail && Reg == REG_NONE; ++J) {
+            CodeEntry* E = CS_GetEntry (S, J);
+            if ((E->OPC == OP65_INC || E->OPC == OP65_DEC)      &&
+                InitCounter (&C, E)) {
+                if (CanUseIndexReg (S, &L, &C, REG_Y)) {
+                    Reg = REG_Y;
+                } else if (CanUseIndexReg (S, &L, &C, REG_X)) {
+                    Reg = REG_X;
+                }
+            }
+        }
+
+        /* If the counter must be stored behind the loop, the insn there
+        ** must not be reached otherwise.
+        */
+        if (Reg != REG_NONE && (Store = CounterIsUsed (S, L.Tail + 1, &C)) != 0 &&
+            !ExitLabelsLocal (S, &L)) {
+            Reg = REG_NONE;
+        }
+
+        if (Reg != REG_NONE) {
+            UseIndexReg (S, &L, &C, Reg, Store);
+            ++Changes;
+        }
+        CS_ResetMarks (S, 0, CS_GetEntryCount (S) - 1);
+
+        /* Next entry */
+        ++I;
+    }
+
+    /* Return the number of changes made */
+    return Changes;
+}
@@ -0,0 +1,83 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                 coptloop.h                                */
+/*                                                                           */
+/*                  Optimize loops with byte sized counters                  */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#ifndef COPTLOOP_H
+#define COPTLOOP_H
+
+
+
+/* cc65 */
+#include "codeseg.h"
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+unsigned OptLoopCountDown (CodeSeg* S);
+/* Search for loops with a byte sized counter that is counted up from a
+** known start value to a constant end value, and is not used otherwise:
+**
+**              sta     cnt             ; A contains the start value
+**              jmp     L2
+**      L1:     ...                     ; cnt is not used here
+**              inc     cnt
+**      L2:     lda     cnt
+**              cmp     #end
+**              bcc     L1              ; or bne
+**
+** and replace them by a counter that is counted down to zero:
+**
+**              lda     #end-start
+**              sta     cnt
+**      L1:     ...
+**              dec     cnt
+**              bne     L1
+*/
+
+unsigned OptLoopIndex (CodeSeg* S);
+/* Search for loops with a byte sized counter, and keep the counter in the Y
+** or X register while the loop is running. Loads of the counter into the
+** index register are removed, loads into A are replaced by transfers, and
+** the increments and decrements work on the register. The counter is loaded
+** into the register when the loop is entered, and stored back when it
+** is left, but only if it is still used after the loop.
+*/
+
+
+
+/* End of coptloop.h */
+
+#endif
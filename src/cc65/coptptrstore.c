@@ -756,3 +756,168 @@ unsigned OptPtrStore3 (CodeSeg* S)
     /* Return the number of changes made */
     return Changes;
 }
+
+
+
+unsigned OptPtrStore4 (CodeSeg* S)
+/* Search for the sequence:
+**
+**      clc
+**      adc     xxx
+**      bcc     L
+**      inx
+** L:   sta     ptr1
+**      stx     ptr1+1
+**      ...
+**      ldy     #$00
+**      sta     (ptr1),y
+**
+** where A/X is loaded with an address label or a register bank pointer
+** before the sequence, and the insns in between just calculate the value
+** to store. Replace it by:
+**
+**      ...
+**      ldy     xxx
+**      sta     label,y
+**
+** or by
+**
+**      ...
+**      ldy     xxx
+**      sta     (zp),y
+**
+** This is what a byte array indexed by a byte sized variable looks like on
+** the left side of an assignment. The loads of A and X are left in place and
+** are removed later if they are no longer needed.
+*/
+{
+    unsigned Changes = 0;
+
+    /* Walk over the entries */
+    unsigned I = 0;
+    while (I < CS_GetEntryCount (S)) {
+
+        CodeEntry* L[6];
+
+        /* Get next entry */
+        L[0] = CS_GetEntry (S, I);
+
+        /* Check for the sequence */
+        if (L[0]->OPC == OP65_CLC                               &&
+            CS_GetEntries (S, L+1, I+1, 5)                      &&
+            L[1]->OPC == OP65_ADC                               &&
+            (L[1]->AM == AM65_ABS || L[1]->AM == AM65_ZP)       &&
+            (L[2]->OPC == OP65_BCC || L[2]->OPC == OP65_JCC)    &&
+            L[2]->JumpTo != 0                                   &&
+            L[2]->JumpTo->Owner == L[4]                         &&
+            CL_GetRefCount (L[2]->JumpTo) == 1                  &&
+            CE_GetLabelCount (L[4]) == 1                        &&
+            L[3]->OPC == OP65_INX                               &&
+            L[4]->OPC == OP65_STA                               &&
+            L[4]->AM == AM65_ZP                                 &&
+            strcmp (L[4]->Arg, "ptr1") == 0                     &&
+            L[5]->OPC == OP65_STX                               &&
+            L[5]->AM == AM65_ZP                                 &&
+            strcmp (L[5]->Arg, "ptr1+1") == 0                   &&
+            !CS_RangeHasLabel (S, I+1, 3)                       &&
+            !CE_HasLabel (L[5])) {
+
+            const char* Loc;
+            am_t        AM;
+            unsigned    Set;
+            unsigned    J;
+            int         Ok;
+
+            /* Determine the base address */
+            if ((Loc = LoadAXZP (S, I)) != 0) {
+                AM = AM65_ZP_INDY;
+            } else if ((Loc = LoadAXImm (S, I)) != 0) {
+                AM = AM65_ABSY;
+            } else {
+                ++I;
+                continue;
+            }
+
+            /* Check the insns calculating the value. They must not read the
+            ** address in A/X or the carry, must not use ptr1, must not
+            ** change the index or the base pointer, and must be plain code
+            ** without jumps, calls or labels.
+            */
+            Set = REG_NONE;
+            Ok  = 0;
+            J   = I + 6;
+            while (J + 1 < CS_GetEntryCount (S)) {
+
+                CodeEntry* E = CS_GetEntry (S, J);
+
+                /* Check for the store */
+                if (E->OPC == OP65_LDY                          &&
+                    CE_IsKnownImm (E, 0)) {
+                    CodeEntry* N = CS_GetEntry (S, J+1);
+                    Ok = (N->OPC == OP65_STA                    &&
+                          N->AM == AM65_ZP_INDY                 &&
+                          strcmp (N->Arg, "ptr1") == 0          &&
+                          !CE_HasLabel (E)                      &&
+                          !CE_HasLabel (N));
+                    break;
+                }
+
+                if (CE_HasLabel (E)                                     ||
+                    (E->Info & (OF_BRA | OF_CALL | OF_RET)) != 0        ||
+                    ((E->Use | E->Chg) & REG_PTR1) != 0                 ||
+                    (E->Use & ~Set & (REG_AX | PSTATE_C)) != 0          ||
+                    J - I > 16) {
+                    break;
+                }
+                if ((E->Info & OF_WRITE) != 0) {
+                    /* Only direct stores to other locations are allowed */
+                    if ((E->AM != AM65_ZP && E->AM != AM65_ABS)         ||
+                        strcmp (E->Arg, L[1]->Arg) == 0                 ||
+                        (AM == AM65_ZP_INDY                     &&
+                         strncmp (E->Arg, Loc, strlen (Loc)) == 0)) {
+                        break;
+                    }
+                }
+                Set |= E->Chg;
+                ++J;
+            }
+
+            /* After the store, the registers and ptr1 have other contents
+            ** than before, so they must not be used.
+            */
+            if (Ok                                                      &&
+                (GetRegInfo (S, J+2, REG_XY | REG_PTR1) & (REG_XY | REG_PTR1)) == 0 &&
+                (J + 2 >= CS_GetEntryCount (S)                  ||
+                 (CS_GetEntry (S, J+2)->Use & PSTATE_ZN) == 0)) {
+
+                CodeEntry* X;
+
+                /* Replace the store */
+                X = NewCodeEntry (OP65_STA, AM, Loc, 0, CS_GetEntry (S, J+1)->LI);
+                CS_InsertEntry (S, X, J+2);
+                X = NewCodeEntry (OP65_LDY, L[1]->AM, L[1]->Arg, 0, L[1]->LI);
+                CS_InsertEntry (S, X, J+2);
+                CS_DelEntries (S, J, 2);
+
+                /* Remove the address calculation. Delete the branch first, so
+                ** the label goes away with it.
+                */
+                CS_DelEntry (S, I+2);
+                CS_DelEntries (S, I, 5);
+
+                /* Remember, we had changes */
+                ++Changes;
+
+                /* Next entry */
+                continue;
+            }
+        }
+
+        /* Next entry */
+        ++I;
+
+    }
+
+    /* Return the number of changes made */
+    return Changes;
+}
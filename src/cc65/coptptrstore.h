@@ -171,6 +171,34 @@ unsigned OptPtrStore3 (CodeSeg* S);
 ** use the register bank instead of ptr1.
 */
 
+unsigned OptPtrStore4 (CodeSeg* S);
+/* Search for the sequence:
+**
+**      clc
+**      adc     xxx
+**      bcc     L
+**      inx
+** L:   sta     ptr1
+**      stx     ptr1+1
+**      ...
+**      ldy     #$00
+**      sta     (ptr1),y
+**
+** where A/X is loaded with an address label or a register bank pointer
+** before the sequence, and the insns in between just calculate the value
+** to store. Replace it by:
+**
+**      ...
+**      ldy     xxx
+**      sta     label,y
+**
+** or by
+**
+**      ...
+**      ldy     xxx
+**      sta     (zp),y
+*/
+
 
 
 /* End of coptptrstore.h */
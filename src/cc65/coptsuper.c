@@ -0,0 +1,519 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                coptsuper.c                                */
+/*                                                                           */
+/*             Apply code replacements found by a superoptimizer             */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#include <string.h>
+
+/* cc65 */
+#include "codeent.h"
+#include "codeinfo.h"
+#include "coptsuper.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Maximum length of a sequence in a rule */
+#define SR_MAX_LEN      6
+
+/* Number of memory operands in a rule */
+#define SR_MAX_MEM      2
+
+/* Operand of an immediate insn that matches any value */
+#define SR_SYM          0x100
+
+/* One insn of a rule. For immediate insns, Op is the value or SR_SYM, for
+** zero page and absolute insns, it is the number of the memory operand.
+** Different numbers may match the same location.
+*/
+typedef struct SuperInsn SuperInsn;
+struct SuperInsn {
+    opc_t           OPC;
+    am_t            AM;
+    unsigned        Op;
+};
+
+/* A replacement rule */
+typedef struct SuperRule SuperRule;
+struct SuperRule {
+    unsigned        MatchLen;
+    SuperInsn       Match[SR_MAX_LEN];
+    unsigned        ReplLen;
+    SuperInsn       Repl[SR_MAX_LEN];
+    unsigned        Dead;           /* Must be unused after the sequence */
+    int             Distinct;       /* Memory operands must be different */
+};
+
+/* Operands bound while matching a rule */
+typedef struct SuperArgs SuperArgs;
+struct SuperArgs {
+    const char*     Mem[SR_MAX_MEM];
+    const char*     Sym;
+};
+
+/* The rules. They were created by util/superopt, see there on how to
+** update them. Longer sequences come first.
+*/
+static const SuperRule Rules[] = {
+    /* lda abs0; sec; sbc #$01; sta abs0
+    ** -> dec abs0; lda abs0
+    ** 8 times, 12 cycles, 9 bytes -> 10 cycles, 6 bytes
+    */
+    {
+        4, { { OP65_LDA, AM65_ABS, 0 }, { OP65_SEC, AM65_IMP, 0 }, { OP65_SBC, AM65_IMM, 0x01 }, { OP65_STA, AM65_ABS, 0 } },
+        2, { { OP65_DEC, AM65_ABS, 0 }, { OP65_LDA, AM65_ABS, 0 } },
+        PSTATE_CZVN, 0
+    },
+    /* lda abs0; sec; sbc #$01; sta abs0
+    ** -> dec abs0
+    ** 8 times, 12 cycles, 9 bytes -> 6 cycles, 3 bytes
+    */
+    {
+        4, { { OP65_LDA, AM65_ABS, 0 }, { OP65_SEC, AM65_IMP, 0 }, { OP65_SBC, AM65_IMM, 0x01 }, { OP65_STA, AM65_ABS, 0 } },
+        1, { { OP65_DEC, AM65_ABS, 0 } },
+        PSTATE_CZVN | REG_A, 0
+    },
+    /* lda #$FD; sec; adc zp0; sta zp0
+    ** -> dec zp0; dec zp0
+    ** 6 times, 10 cycles, 7 bytes -> 10 cycles, 4 bytes
+    */
+    {
+        4, { { OP65_LDA, AM65_IMM, 0xFD }, { OP65_SEC, AM65_IMP, 0 }, { OP65_ADC, AM65_ZP, 0 }, { OP65_STA, AM65_ZP, 0 } },
+        2, { { OP65_DEC, AM65_ZP, 0 }, { OP65_DEC, AM65_ZP, 0 } },
+        PSTATE_CZVN | REG_A, 0
+    },
+    /* lda #$01; sta zp0; lda #$00
+    ** -> lda #$01; sta zp0; lsr a
+    ** 40 times, 7 cycles, 6 bytes -> 7 cycles, 5 bytes
+    */
+    {
+        3, { { OP65_LDA, AM65_IMM, 0x01 }, { OP65_STA, AM65_ZP, 0 }, { OP65_LDA, AM65_IMM, 0x00 } },
+        3, { { OP65_LDA, AM65_IMM, 0x01 }, { OP65_STA, AM65_ZP, 0 }, { OP65_LSR, AM65_ACC, 0 } },
+        PSTATE_CZVN, 0
+    },
+    /* sta abs0; ldx #$00; lda abs0
+    ** -> ldx #$00; sta abs0; and #$FF
+    ** 31 times, 10 cycles, 8 bytes -> 8 cycles, 7 bytes
+    */
+    {
+        3, { { OP65_STA, AM65_ABS, 0 }, { OP65_LDX, AM65_IMM, 0x00 }, { OP65_LDA, AM65_ABS, 0 } },
+        3, { { OP65_LDX, AM65_IMM, 0x00 }, { OP65_STA, AM65_ABS, 0 }, { OP65_AND, AM65_IMM, 0xFF } },
+        REG_NONE, 0
+    },
+    /* sta zp0; ldx #$00; lda zp0
+    ** -> ldx #$00; sta zp0; and #$FF
+    ** 12 times, 8 cycles, 6 bytes -> 7 cycles, 6 bytes
+    */
+    {
+        3, { { OP65_STA, AM65_ZP, 0 }, { OP65_LDX, AM65_IMM, 0x00 }, { OP65_LDA, AM65_ZP, 0 } },
+        3, { { OP65_LDX, AM65_IMM, 0x00 }, { OP65_STA, AM65_ZP, 0 }, { OP65_AND, AM65_IMM, 0xFF } },
+        REG_NONE, 0
+    },
+    /* lda abs0; asl a; sta abs0
+    ** -> asl abs0; lda abs0
+    ** 11 times, 10 cycles, 7 bytes -> 10 cycles, 6 bytes
+    */
+    {
+        3, { { OP65_LDA, AM65_ABS, 0 }, { OP65_ASL, AM65_ACC, 0 }, { OP65_STA, AM65_ABS, 0 } },
+        2, { { OP65_ASL, AM65_ABS, 0 }, { OP65_LDA, AM65_ABS, 0 } },
+        PSTATE_CZVN, 0
+    },
+    /* lda abs0; asl a; sta abs0
+    ** -> asl abs0
+    ** 11 times, 10 cycles, 7 bytes -> 6 cycles, 3 bytes
+    */
+    {
+        3, { { OP65_LDA, AM65_ABS, 0 }, { OP65_ASL, AM65_ACC, 0 }, { OP65_STA, AM65_ABS, 0 } },
+        1, { { OP65_ASL, AM65_ABS, 0 } },
+        PSTATE_CZVN | REG_A, 0
+    },
+    /* sta zp0; lda #$00; tay
+    ** -> ldy #$00; sta zp0
+    ** 9 times, 7 cycles, 5 bytes -> 5 cycles, 4 bytes
+    */
+    {
+        3, { { OP65_STA, AM65_ZP, 0 }, { OP65_LDA, AM65_IMM, 0x00 }, { OP65_TAY, AM65_IMP, 0 } },
+        2, { { OP65_LDY, AM65_IMM, 0x00 }, { OP65_STA, AM65_ZP, 0 } },
+        PSTATE_CZVN | REG_A, 0
+    },
+    /* ldx zp0; clc; adc #$80
+    ** -> eor #$80; ldx zp0
+    ** 5 times, 7 cycles, 5 bytes -> 5 cycles, 4 bytes
+    */
+    {
+        3, { { OP65_LDX, AM65_ZP, 0 }, { OP65_CLC, AM65_IMP, 0 }, { OP65_ADC, AM65_IMM, 0x80 } },
+        2, { { OP65_EOR, AM65_IMM, 0x80 }, { OP65_LDX, AM65_ZP, 0 } },
+        PSTATE_CZVN, 0
+    },
+    /* sta zp0; clc; lda zp0
+    ** -> clc; sta zp0; and #$FF
+    ** 5 times, 8 cycles, 5 bytes -> 7 cycles, 5 bytes
+    */
+    {
+        3, { { OP65_STA, AM65_ZP, 0 }, { OP65_CLC, AM65_IMP, 0 }, { OP65_LDA, AM65_ZP, 0 } },
+        3, { { OP65_CLC, AM65_IMP, 0 }, { OP65_STA, AM65_ZP, 0 }, { OP65_AND, AM65_IMM, 0xFF } },
+        REG_NONE, 0
+    },
+    /* and #$7F; clc; adc #$01
+    ** -> asl a; lsr a; adc #$01
+    ** 4 times, 6 cycles, 5 bytes -> 6 cycles, 4 bytes
+    */
+    {
+        3, { { OP65_AND, AM65_IMM, 0x7F }, { OP65_CLC, AM65_IMP, 0 }, { OP65_ADC, AM65_IMM, 0x01 } },
+        3, { { OP65_ASL, AM65_ACC, 0 }, { OP65_LSR, AM65_ACC, 0 }, { OP65_ADC, AM65_IMM, 0x01 } },
+        REG_NONE, 0
+    },
+    /* cmp #$00; lda abs0; sbc #$01
+    ** -> clc; lda #$FF; adc abs0
+    ** 4 times, 8 cycles, 7 bytes -> 8 cycles, 6 bytes
+    */
+    {
+        3, { { OP65_CMP, AM65_IMM, 0x00 }, { OP65_LDA, AM65_ABS, 0 }, { OP65_SBC, AM65_IMM, 0x01 } },
+        3, { { OP65_CLC, AM65_IMP, 0 }, { OP65_LDA, AM65_IMM, 0xFF }, { OP65_ADC, AM65_ABS, 0 } },
+        REG_NONE, 0
+    },
+    /* cmp #$00; lda abs0; sbc #$02
+    ** -> clc; lda abs0; sbc #$01
+    ** 4 times, 8 cycles, 7 bytes -> 8 cycles, 6 bytes
+    */
+    {
+        3, { { OP65_CMP, AM65_IMM, 0x00 }, { OP65_LDA, AM65_ABS, 0 }, { OP65_SBC, AM65_IMM, 0x02 } },
+        3, { { OP65_CLC, AM65_IMP, 0 }, { OP65_LDA, AM65_ABS, 0 }, { OP65_SBC, AM65_IMM, 0x01 } },
+        REG_NONE, 0
+    },
+    /* cmp #$00; lda abs0; sbc #$FF
+    ** -> and #$00; sec; adc abs0
+    ** 4 times, 8 cycles, 7 bytes -> 8 cycles, 6 bytes
+    */
+    {
+        3, { { OP65_CMP, AM65_IMM, 0x00 }, { OP65_LDA, AM65_ABS, 0 }, { OP65_SBC, AM65_IMM, 0xFF } },
+        3, { { OP65_AND, AM65_IMM, 0x00 }, { OP65_SEC, AM65_IMP, 0 }, { OP65_ADC, AM65_ABS, 0 } },
+        REG_NONE, 0
+    },
+    /* lda #$00; asl a; rol zp0
+    ** -> and #$00; asl zp0
+    ** 4 times, 9 cycles, 5 bytes -> 7 cycles, 4 bytes
+    */
+    {
+        3, { { OP65_LDA, AM65_IMM, 0x00 }, { OP65_ASL, AM65_ACC, 0 }, { OP65_ROL, AM65_ZP, 0 } },
+        2, { { OP65_AND, AM65_IMM, 0x00 }, { OP65_ASL, AM65_ZP, 0 } },
+        REG_NONE, 0
+    },
+    /* lda #$00; asl a; rol zp0
+    ** -> asl zp0
+    ** 4 times, 9 cycles, 5 bytes -> 5 cycles, 2 bytes
+    */
+    {
+        3, { { OP65_LDA, AM65_IMM, 0x00 }, { OP65_ASL, AM65_ACC, 0 }, { OP65_ROL, AM65_ZP, 0 } },
+        1, { { OP65_ASL, AM65_ZP, 0 } },
+        PSTATE_CZVN | REG_A, 0
+    },
+    /* lda #$01; sta abs0; lda #$02
+    ** -> lda #$01; sta abs0; asl a
+    ** 4 times, 8 cycles, 7 bytes -> 8 cycles, 6 bytes
+    */
+    {
+        3, { { OP65_LDA, AM65_IMM, 0x01 }, { OP65_STA, AM65_ABS, 0 }, { OP65_LDA, AM65_IMM, 0x02 } },
+        3, { { OP65_LDA, AM65_IMM, 0x01 }, { OP65_STA, AM65_ABS, 0 }, { OP65_ASL, AM65_ACC, 0 } },
+        PSTATE_CZVN, 0
+    },
+    /* ldx #$00; txa
+    ** -> lda #$00
+    ** 407 times, 4 cycles, 3 bytes -> 2 cycles, 2 bytes
+    */
+    {
+        2, { { OP65_LDX, AM65_IMM, 0x00 }, { OP65_TXA, AM65_IMP, 0 } },
+        1, { { OP65_LDA, AM65_IMM, 0x00 } },
+        PSTATE_CZVN | REG_X, 0
+    },
+    /* sty abs0; lda abs0
+    ** -> sty abs0; tya
+    ** 68 times, 8 cycles, 6 bytes -> 6 cycles, 4 bytes
+    */
+    {
+        2, { { OP65_STY, AM65_ABS, 0 }, { OP65_LDA, AM65_ABS, 0 } },
+        2, { { OP65_STY, AM65_ABS, 0 }, { OP65_TYA, AM65_IMP, 0 } },
+        REG_NONE, 0
+    },
+    /* lda abs0; tay
+    ** -> ldy abs0
+    ** 23 times, 6 cycles, 4 bytes -> 4 cycles, 3 bytes
+    */
+    {
+        2, { { OP65_LDA, AM65_ABS, 0 }, { OP65_TAY, AM65_IMP, 0 } },
+        1, { { OP65_LDY, AM65_ABS, 0 } },
+        PSTATE_CZVN | REG_A, 0
+    },
+    /* cmp #$00; lda abs0
+    ** -> sec; lda abs0
+    ** 17 times, 6 cycles, 5 bytes -> 6 cycles, 4 bytes
+    */
+    {
+        2, { { OP65_CMP, AM65_IMM, 0x00 }, { OP65_LDA, AM65_ABS, 0 } },
+        2, { { OP65_SEC, AM65_IMP, 0 }, { OP65_LDA, AM65_ABS, 0 } },
+        REG_NONE, 0
+    },
+    /* lda #$00; tay
+    ** -> ldy #$00
+    ** 10 times, 4 cycles, 3 bytes -> 2 cycles, 2 bytes
+    */
+    {
+        2, { { OP65_LDA, AM65_IMM, 0x00 }, { OP65_TAY, AM65_IMP, 0 } },
+        1, { { OP65_LDY, AM65_IMM, 0x00 } },
+        PSTATE_CZVN | REG_A, 0
+    },
+    /* ldx #$FF; txa
+    ** -> lda #$FF
+    ** 9 times, 4 cycles, 3 bytes -> 2 cycles, 2 bytes
+    */
+    {
+        2, { { OP65_LDX, AM65_IMM, 0xFF }, { OP65_TXA, AM65_IMP, 0 } },
+        1, { { OP65_LDA, AM65_IMM, 0xFF } },
+        PSTATE_CZVN | REG_X, 0
+    },
+    /* ldx abs0; txa
+    ** -> lda abs0
+    ** 8 times, 6 cycles, 4 bytes -> 4 cycles, 3 bytes
+    */
+    {
+        2, { { OP65_LDX, AM65_ABS, 0 }, { OP65_TXA, AM65_IMP, 0 } },
+        1, { { OP65_LDA, AM65_ABS, 0 } },
+        PSTATE_CZVN | REG_X, 0
+    },
+    /* sta abs0; lda abs0
+    ** -> sta abs0; and #$FF
+    ** 8 times, 8 cycles, 6 bytes -> 6 cycles, 5 bytes
+    */
+    {
+        2, { { OP65_STA, AM65_ABS, 0 }, { OP65_LDA, AM65_ABS, 0 } },
+        2, { { OP65_STA, AM65_ABS, 0 }, { OP65_AND, AM65_IMM, 0xFF } },
+        REG_NONE, 0
+    },
+    /* ldx #$01; txa
+    ** -> lda #$01
+    ** 6 times, 4 cycles, 3 bytes -> 2 cycles, 2 bytes
+    */
+    {
+        2, { { OP65_LDX, AM65_IMM, 0x01 }, { OP65_TXA, AM65_IMP, 0 } },
+        1, { { OP65_LDA, AM65_IMM, 0x01 } },
+        PSTATE_CZVN | REG_X, 0
+    },
+    /* clc; adc #$80
+    ** -> eor #$80
+    ** 5 times, 4 cycles, 3 bytes -> 2 cycles, 2 bytes
+    */
+    {
+        2, { { OP65_CLC, AM65_IMP, 0 }, { OP65_ADC, AM65_IMM, 0x80 } },
+        1, { { OP65_EOR, AM65_IMM, 0x80 } },
+        PSTATE_CZVN, 0
+    },
+    /* lda #$00; tax
+    ** -> ldx #$00
+    ** 4 times, 4 cycles, 3 bytes -> 2 cycles, 2 bytes
+    */
+    {
+        2, { { OP65_LDA, AM65_IMM, 0x00 }, { OP65_TAX, AM65_IMP, 0 } },
+        1, { { OP65_LDX, AM65_IMM, 0x00 } },
+        PSTATE_CZVN | REG_A, 0
+    },
+};
+
+
+
+/*****************************************************************************/
+/*                                  Helpers                                  */
+/*****************************************************************************/
+
+
+
+static int BindArg (const char** Bound, const char* Arg)
+/* Bind an operand of a rule, or check that it has the same value as before */
+{
+    if (*Bound == 0) {
+        *Bound = Arg;
+        return 1;
+    }
+    return strcmp (*Bound, Arg) == 0;
+}
+
+
+
+static int MatchInsn (const SuperInsn* P, const CodeEntry* E, SuperArgs* A)
+/* Check if an insn matches one of a rule */
+{
+    if (E->OPC != P->OPC || E->AM != P->AM) {
+        return 0;
+    }
+    switch (P->AM) {
+
+        case AM65_IMM:
+            if (P->Op == SR_SYM) {
+                return BindArg (&A->Sym, E->Arg);
+            }
+            return CE_IsKnownImm (E, P->Op);
+
+        case AM65_ZP:
+        case AM65_ABS:
+            /* Numeric addresses may be I/O locations, leave them alone */
+            if (CE_HasNumArg (E)) {
+                return 0;
+            }
+            return BindArg (&A->Mem[P->Op], E->Arg);
+
+        default:
+            return 1;
+    }
+}
+
+
+
+static int IsDistinct (const char* L, const char* R)
+/* Check if two operands are known to be different locations. This is true
+** if they refer to different symbols.
+*/
+{
+    size_t LLen = strcspn (L, "+-");
+    size_t RLen = strcspn (R, "+-");
+    return LLen != RLen || strncmp (L, R, LLen) != 0;
+}
+
+
+
+static int MatchRule (CodeSeg* S, unsigned I, const SuperRule* R, SuperArgs* A)
+/* Check if the code at index I matches a rule */
+{
+    unsigned K;
+
+    /* There must be enough code, and no labels inside the sequence */
+    if (I + R->MatchLen > CS_GetEntryCount (S) ||
+        CS_RangeHasLabel (S, I + 1, R->MatchLen - 1)) {
+        return 0;
+    }
+
+    memset (A, 0, sizeof (*A));
+    for (K = 0; K < R->MatchLen; ++K) {
+        if (!MatchInsn (R->Match + K, CS_GetEntry (S, I + K), A)) {
+            return 0;
+        }
+    }
+
+    if (R->Distinct && !IsDistinct (A->Mem[0], A->Mem[1])) {
+        return 0;
+    }
+
+    /* Check the registers that must be unused after the sequence */
+    return R->Dead == REG_NONE ||
+           (GetRegInfo (S, I + R->MatchLen, R->Dead) & R->Dead) == 0;
+}
+
+
+
+static void ApplyRule (CodeSeg* S, unsigned I, const SuperRule* R, const SuperArgs* A)
+/* Replace the code at index I according to a rule */
+{
+    const CodeEntry* E = CS_GetEntry (S, I);
+    unsigned K;
+
+    /* Insert the new code after the old one, then delete the old code. This
+    ** will move labels of the first insn to the new code.
+    */
+    for (K = 0; K < R->ReplLen; ++K) {
+        const SuperInsn* P = R->Repl + K;
+        const char* Arg;
+        CodeEntry* X;
+
+        switch (P->AM) {
+            case AM65_IMM:
+                Arg = (P->Op == SR_SYM)? A->Sym : MakeHexArg (P->Op);
+                break;
+            case AM65_ZP:
+            case AM65_ABS:
+                Arg = A->Mem[P->Op];
+                break;
+            default:
+                Arg = 0;
+                break;
+        }
+        X = NewCodeEntry (P->OPC, P->AM, Arg, 0, E->LI);
+        CS_InsertEntry (S, X, I + R->MatchLen + K);
+    }
+    CS_DelEntries (S, I, R->MatchLen);
+}
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+unsigned OptSuper (CodeSeg* S)
+/* Replace short sequences of simple instructions by cheaper ones with the
+** same effect. The rules were found by an exhaustive search run by
+** util/superopt on the code created by cc65 for a corpus of programs, and
+** checked by simulating both sequences for all possible inputs. Some of
+** the rules require that registers or flags are unused after the sequence.
+*/
+{
+    unsigned Changes = 0;
+
+    /* Walk over the entries */
+    unsigned I = 0;
+    while (I < CS_GetEntryCount (S)) {
+
+        /* Get next entry */
+        CodeEntry* E = CS_GetEntry (S, I);
+
+        /* Try the rules starting with this insn */
+        unsigned K;
+        for (K = 0; K < sizeof (Rules) / sizeof (Rules[0]); ++K) {
+            const SuperRule* R = Rules + K;
+            SuperArgs A;
+            if (R->Match[0].OPC == E->OPC && MatchRule (S, I, R, &A)) {
+                ApplyRule (S, I, R, &A);
+                ++Changes;
+                break;
+            }
+        }
+
+        /* Next entry */
+        ++I;
+
+    }
+
+    /* Return the number of changes made */
+    return Changes;
+}
@@ -0,0 +1,61 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                coptsuper.h                                */
+/*                                                                           */
+/*             Apply code replacements found by a superoptimizer             */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#ifndef COPTSUPER_H
+#define COPTSUPER_H
+
+
+
+/* cc65 */
+#include "codeseg.h"
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+unsigned OptSuper (CodeSeg* S);
+/* Replace short sequences of simple instructions by cheaper ones with the
+** same effect. The rules were found by an exhaustive search run by
+** util/superopt on the code created by cc65 for a corpus of programs, and
+** checked by simulating both sequences for all possible inputs. Some of
+** the rules require that registers or flags are unused after the sequence.
+*/
+
+
+
+/* End of coptsuper.h */
+
+#endif
@@ -488,6 +488,19 @@ static void CheckArrayElementType (Type* DataType)
 
 
 
+static void ParseFuncSpec (DeclSpec* D)
+/* Parse the inline function specifier which may be mixed with the storage
+** class.
+*/
+{
+    while (CurTok.Tok == TOK_INLINE) {
+        D->Flags |= DS_INLINE;
+        NextToken ();
+    }
+}
+
+
+
 static void ParseStorageClass (DeclSpec* D, unsigned DefStorage)
 /* Parse a storage class */
 {
@@ -495,7 +508,9 @@ static void ParseStorageClass (DeclSpec* D, unsigned DefStorage)
     D->Flags &= ~DS_DEF_STORAGE;
 
     /* Check the storage class given */
+    ParseFuncSpec (D);
     D->StorageClass = ParseOneStorageClass ();
+    ParseFuncSpec (D);
     if (D->StorageClass == 0) {
         /* No storage class given, use default */
         D->Flags |= DS_DEF_STORAGE;
@@ -508,6 +523,7 @@ static void ParseStorageClass (DeclSpec* D, unsigned DefStorage)
             } else {
                 Error ("Conflicting storage class specifier");
             }
+            ParseFuncSpec (D);
             StorageClass = ParseOneStorageClass ();
         }
     }
@@ -60,6 +60,7 @@
 #define DS_NEW_TYPE_DECL        0x0010U /* New type declared            */
 #define DS_NEW_TYPE_DEF         0x0020U /* New type defined             */
 #define DS_NEW_TYPE             (DS_NEW_TYPE_DECL | DS_NEW_TYPE_DEF)
+#define DS_INLINE               0x0040U /* inline function specifier    */
 
 /* Result of ParseDeclSpec */
 typedef struct DeclSpec DeclSpec;
@@ -19,12 +19,14 @@
 #include "asmlabel.h"
 #include "asmstmt.h"
 #include "assignment.h"
+#include "callgraph.h"
 #include "codegen.h"
 #include "declare.h"
 #include "error.h"
 #include "funcdesc.h"
 #include "function.h"
 #include "global.h"
+#include "inlinefunc.h"
 #include "litpool.h"
 #include "loadexpr.h"
 #include "macrotab.h"
@@ -600,11 +602,14 @@ void DoDeferred (unsigned Flags, ExprDesc* Expr)
 }
 
 
-static unsigned FunctionParamList (FuncDesc* Func, int IsFastcall, ExprDesc* ED)
+static unsigned FunctionParamList (FuncDesc* Func, int IsFastcall, ExprDesc* ED,
+                                   int StaticFrame)
 /* Parse a function parameter list, and pass the arguments to the called
 ** function. Depending on several criteria, this may be done by just pushing
 ** into each parameter separately, or creating the parameter frame once, and
-** then storing into this frame.
+** then storing into this frame. If StaticFrame is not negative, the called
+** function has a static frame at this offset in the frame area, and all
+** arguments are stored there.
 ** The function returns the size of the arguments pushed in bytes.
 */
 {
@@ -622,6 +627,14 @@ static unsigned FunctionParamList (FuncDesc* Func, int IsFastcall, ExprDesc* ED)
     /* Make sure the size of all parameters are known */
     int ParamComplete = F_CheckParamList (Func, 1);
 
+    /* Storing into a static frame needs the parameter types. Calls without
+    ** a prototype keep the callee out of the call graph, so the graph is
+    ** outdated if it has a frame.
+    */
+    if (StaticFrame >= 0 && (Func->Flags & FD_EMPTY) != 0) {
+        Error ("Call graph is out of date for function '%s'", ED->Sym->Name);
+    }
+
     /* As an optimization, we may allocate the complete parameter frame at
     ** once instead of pushing into each parameter as it comes. We may do that,
     ** if...
@@ -635,7 +648,7 @@ static unsigned FunctionParamList (FuncDesc* Func, int IsFastcall, ExprDesc* ED)
     ** (instead of pushing) is enabled.
     **
     */
-    if (ParamComplete && IS_Get (&CodeSizeFactor) >= 200) {
+    if (ParamComplete && StaticFrame < 0 && IS_Get (&CodeSizeFactor) >= 200) {
         /* Calculate the number and size of the parameters */
         FrameParams = Func->ParamCount;
         FrameSize   = Func->ParamSize;
@@ -737,8 +750,15 @@ static unsigned FunctionParamList (FuncDesc* Func, int IsFastcall, ExprDesc* ED)
             /* Load the value into the primary if it is not already there */
             LoadExpr (Flags, &Expr);
 
+            /* Store into the static frame. The frames of all functions called
+            ** while evaluating the other arguments lie below this one.
+            */
+            if (StaticFrame >= 0) {
+                g_putstatic (Flags | CF_EXTERNAL, (uintptr_t) CG_FRAMES, StaticFrame);
+                StaticFrame += sizeofarg (Flags);
+
             /* If this is a fastcall function, don't push the last argument */
-            if ((CurTok.Tok == TOK_COMMA && NextTok.Tok != TOK_RPAREN) || !IsFastcall) {
+            } else if ((CurTok.Tok == TOK_COMMA && NextTok.Tok != TOK_RPAREN) || !IsFastcall) {
                 unsigned ArgSize = sizeofarg (Flags);
 
                 if (FrameSize > 0) {
@@ -814,6 +834,8 @@ static void FunctionCall (ExprDesc* Expr)
     int           PtrOffs = 0;    /* Offset of function pointer on stack */
     int           IsFastcall = 0; /* True if it's a fast-call function */
     int           PtrOnStack = 0; /* True if a pointer copy is on stack */
+    int           StaticFrame = -1; /* Offset of the callee's static frame */
+    SymEntry*     Callee = 0;     /* Callee for the call graph if known */
     Type*         ReturnType;
 
     /* Skip the left paren */
@@ -879,15 +901,40 @@ static void FunctionCall (ExprDesc* Expr)
             }
         }
 
+        /* Expand small static functions in place. If this isn't possible,
+        ** the call is a reference to the function.
+        */
+        if (Expr->Sym && IsInlineFunc (Expr->Sym)) {
+            if (!ED_IsUneval (Expr) && InlineFuncCall (Expr)) {
+                return;
+            }
+            Expr->Sym->Flags |= SC_REF;
+            CG_FuncRef (Expr->Sym);
+        }
+
         /* If we didn't inline the function, get fastcall info */
         IsFastcall = (Func->Flags & FD_VARIADIC) == 0 &&
             (AutoCDecl ?
              IsQualFastcall (Expr->Type) :
              !IsQualCDecl (Expr->Type));
+
+        /* Check if the arguments go into a static frame. Wrapped calls go
+        ** through the wrapper which needs them on the stack. A call without
+        ** a prototype is recorded like a call through a pointer, so the
+        ** callee keeps using the stack.
+        */
+        if (Expr->Sym && !Func->WrappedCall) {
+            if ((Func->Flags & FD_EMPTY) == 0) {
+                Callee = Expr->Sym;
+            }
+            StaticFrame = CG_GetFrame (Expr->Sym);
+        }
     }
 
     /* Parse the parameter list */
-    ParamSize = FunctionParamList (Func, IsFastcall, Expr);
+    CG_CallStart (Callee);
+    ParamSize = FunctionParamList (Func, IsFastcall, Expr, StaticFrame);
+    CG_CallEnd ();
 
     /* We need the closing paren here */
     ConsumeRParen ();
@@ -1104,8 +1151,12 @@ static void Primary (ExprDesc* E)
                     return;
                 }
 
-                /* Mark the symbol as referenced */
-                Sym->Flags |= SC_REF;
+                /* Mark the symbol as referenced. A call of a function that
+                ** may be inlined is a reference only if it isn't inlined.
+                */
+                if (CurTok.Tok != TOK_LPAREN || !IsInlineFunc (Sym)) {
+                    Sym->Flags |= SC_REF;
+                }
 
                 /* The expression type is the symbol type */
                 E->Type = Sym->Type;
@@ -1119,6 +1170,9 @@ static void Primary (ExprDesc* E)
                     /* Function */
                     E->Flags = E_LOC_GLOBAL | E_RTYPE_LVAL;
                     E->Name = (uintptr_t) Sym->Name;
+                    if (CurTok.Tok != TOK_LPAREN || !IsInlineFunc (Sym)) {
+                        CG_FuncRef (Sym);
+                    }
                 } else if ((Sym->Flags & SC_AUTO) == SC_AUTO) {
                     /* Local variable. If this is a parameter for a variadic
                     ** function, we have to add some address calculations, and the
@@ -63,6 +63,9 @@ FuncDesc* NewFuncDesc (void)
     F->FuncDef    = 0;
     F->WrappedCall = 0;
     F->WrappedCallData = 0;
+    F->RegFunc    = 0;
+    F->RegUse     = 0;
+    F->RegChg     = 0;
 
     /* Return the new struct */
     return F;
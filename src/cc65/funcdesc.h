@@ -72,6 +72,9 @@ struct FuncDesc {
     struct FuncDesc*    FuncDef;        /* Descriptor used in definition     */
     struct SymEntry*    WrappedCall;    /* Pointer to the WrappedCall        */
     unsigned char       WrappedCallData;/* The WrappedCall's user data       */
+    struct SymEntry*    RegFunc;        /* Function RegUse/RegChg belong to  */
+    unsigned            RegUse;         /* Registers used by the function    */
+    unsigned            RegChg;         /* Registers changed by the function */
 };
 
 
@@ -40,12 +40,16 @@
 /* cc65 */
 #include "asmcode.h"
 #include "asmlabel.h"
+#include "callgraph.h"
 #include "codegen.h"
 #include "error.h"
 #include "funcdesc.h"
 #include "global.h"
+#include "inlinefunc.h"
 #include "litpool.h"
 #include "locals.h"
+#include "profile.h"
+#include "regvars.h"
 #include "scanner.h"
 #include "stackptr.h"
 #include "standard.h"
@@ -87,6 +91,8 @@ static Function* NewFunction (struct SymEntry* Sym, FuncDesc* D)
     F->TopLevelSP = 0;
     F->RegOffs    = RegisterSpace;
     F->Flags      = IsTypeVoid (F->ReturnType) ? FF_VOID_RETURN : FF_NONE;
+    F->FrameOffs  = CG_GetFrame (Sym);
+    F->FrameSize  = 0;
 
     InitCollection (&F->LocalsBlockStack);
 
@@ -320,6 +326,28 @@ void F_AllocLocalSpace (Function* F)
 
 
 
+int F_HasStaticFrame (const Function* F)
+/* Return true if the parameters and locals of the function are in a static
+** frame instead of the stack.
+*/
+{
+    return F->FrameOffs >= 0;
+}
+
+
+
+unsigned F_AllocFrameSpace (Function* F, unsigned Size)
+/* Allocate the given space in the static frame and return its offset in the
+** frame area. Without a static frame, the size is only counted.
+*/
+{
+    unsigned Offs = (unsigned) F->FrameOffs + F->FrameSize;
+    F->FrameSize += Size;
+    return Offs;
+}
+
+
+
 int F_AllocRegVar (Function* F, const Type* Type)
 /* Allocate a register variable for the given variable type. If the allocation
 ** was successful, return the offset of the register variable in the register
@@ -445,11 +473,45 @@ static void F_EmitDebugInfo (void)
 
 
 
+static int CanHaveStaticFrame (const SymEntry* Func, const FuncDesc* D)
+/* Return true if the arguments for the function can be stored into a static
+** frame by the caller, which needs the exact parameter types for that.
+*/
+{
+    const SymEntry* Param;
+
+    /* Variadic and old style functions get promoted arguments, and wrappers
+    ** are called with their own convention.
+    */
+    if ((D->Flags & (FD_VARIADIC | FD_OLDSTYLE | FD_CALL_WRAPPER)) != 0) {
+        return 0;
+    }
+
+    /* The startup code passes the arguments for main() on the stack */
+    if (strcmp (Func->Name, "main") == 0 && D->ParamCount > 0) {
+        return 0;
+    }
+
+    /* Struct parameters and register parameters need the stack */
+    for (Param = D->SymTab->SymHead; Param && (Param->Flags & SC_PARAM) != 0; Param = Param->NextSym) {
+        if (IsClassStruct (Param->Type) || SymIsRegVar (Param)) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+
+
 void NewFunc (SymEntry* Func, FuncDesc* D)
 /* Parse argument declarations and function body. */
 {
     int         ParamComplete;  /* If all paramemters have complete types */
     int         C99MainFunc = 0;/* Flag for C99 main function returning int */
+    int         CanFrame;       /* If the function may use a static frame */
+    int         Complete = 0;   /* If the body was read ahead completely */
+    Collection  Body = AUTO_COLLECTION_INITIALIZER;
     SymEntry*   Param;
     const Type* RType;          /* Real type used for struct parameters */
     const Type* ReturnType;     /* Return type */
@@ -478,6 +540,16 @@ void NewFunc (SymEntry* Func, FuncDesc* D)
     */
     ParamComplete = F_CheckParamList (D, 1);
 
+    /* Parameters and locals may go into a static frame if the parameters
+    ** can be passed in memory.
+    */
+    CanFrame = ParamComplete && CanHaveStaticFrame (Func, D);
+    CG_FuncStart (CanFrame);
+    if (F_HasStaticFrame (CurrentFunc) && !CanFrame) {
+        Error ("Call graph is out of date for function '%s'", Func->Name);
+        CurrentFunc->FrameOffs = -1;
+    }
+
     /* Check if the function header contains unnamed parameters. These are
     ** only allowed in cc65 mode.
     */
@@ -545,6 +617,9 @@ void NewFunc (SymEntry* Func, FuncDesc* D)
         }
     }
 
+    /* Choose the code size factor from the execution profile */
+    PF_FuncStart (Func);
+
     /* Allocate code and data segments for this function */
     Func->V.F.Seg = PushSegments (Func);
 
@@ -557,8 +632,11 @@ void NewFunc (SymEntry* Func, FuncDesc* D)
     /* Allocate a new literal pool */
     PushLiteralPool (Func);
 
-    /* If this is a fastcall function, push the last parameter onto the stack */
-    if ((D->Flags & FD_VARIADIC) == 0 && D->ParamCount > 0 &&
+    /* If this is a fastcall function, push the last parameter onto the stack.
+    ** With a static frame, all parameters are already in place.
+    */
+    if (!F_HasStaticFrame (CurrentFunc) &&
+        (D->Flags & FD_VARIADIC) == 0 && D->ParamCount > 0 &&
         (AutoCDecl ?
          IsQualFastcall (Func->Type) :
          !IsQualCDecl (Func->Type))) {
@@ -575,7 +653,8 @@ void NewFunc (SymEntry* Func, FuncDesc* D)
     }
 
     /* Generate function entry code if needed */
-    g_enter (FuncTypeOf (Func->Type), F_GetParamSize (CurrentFunc));
+    g_enter (FuncTypeOf (Func->Type),
+             F_HasStaticFrame (CurrentFunc)? 0 : F_GetParamSize (CurrentFunc));
 
     /* If stack checking code is requested, emit a call to the helper routine */
     if (IS_Get (&CheckStack)) {
@@ -586,7 +665,22 @@ void NewFunc (SymEntry* Func, FuncDesc* D)
     StackPtr = 0;
 
     /* Emit code to handle the parameters if all of them have complete types */
-    if (ParamComplete) {
+    if (ParamComplete && F_HasStaticFrame (CurrentFunc)) {
+        /* Turn the parameters into static variables in the frame */
+        Param = D->SymTab->SymHead;
+        while (Param && (Param->Flags & SC_PARAM) != 0) {
+            unsigned Label = GetLocalDataLabel ();
+            unsigned Offs  = F_AllocFrameSpace (CurrentFunc, CheckedSizeOf (Param->Type));
+            Param->Flags = (Param->Flags & ~SC_AUTO) | SC_STATIC;
+            Param->V.L.Label = Label;
+            Param->AsmName = xstrdup (LocalDataLabelName (Label));
+            g_defframelabel (Label, Offs);
+            Param = Param->NextSym;
+        }
+    } else if (ParamComplete) {
+        /* Count the parameters for the call graph */
+        F_AllocFrameSpace (CurrentFunc, F_GetParamSize (CurrentFunc));
+
         /* Walk through the parameter list and allocate register variable space
         ** for parameters declared as register. Generate code to swap the contents
         ** of the register bank with the save area on the stack.
@@ -631,6 +725,24 @@ void NewFunc (SymEntry* Func, FuncDesc* D)
         }
     }
 
+    /* Read the body ahead if it is needed to choose the register variables
+    ** or to inline calls of the function.
+    */
+    if (CurTok.Tok == TOK_LCURLY &&
+        ((IS_Get (&EnableRegVars) && IS_Get (&AutoRegVars)) ||
+         MayInlineFunc (Func, D))) {
+        Complete = ReadAheadBlock (&Body);
+    }
+
+    /* Choose local variables for the register bank */
+    ScanRegVars (Complete? &Body : 0);
+
+    /* Remember the body of small functions for inlining */
+    if (Complete) {
+        RecordInlineFunc (Func, D, &Body);
+    }
+    DoneCollection (&Body);
+
     /* Need a starting curly brace */
     ConsumeLCurly ();
 
@@ -700,6 +812,12 @@ void NewFunc (SymEntry* Func, FuncDesc* D)
     /* Switch back to the old segments */
     PopSegments ();
 
+    /* Restore the code size factor */
+    PF_FuncEnd ();
+
+    /* Record the function in the call graph */
+    CG_FuncEnd (Func, CurrentFunc->FrameSize);
+
     /* Reset the current function pointer */
     FreeFunction (CurrentFunc);
     CurrentFunc = 0;
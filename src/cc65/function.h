@@ -62,6 +62,8 @@ struct Function {
     unsigned            RegOffs;          /* Register variable space offset */
     funcflags_t         Flags;            /* Function flags */
     Collection          LocalsBlockStack; /* Stack of blocks with local vars */
+    int                 FrameOffs;        /* Static frame offset or -1 */
+    unsigned            FrameSize;        /* Size of params and locals */
 };
 
 /* Structure that holds all data needed for function activation */
@@ -144,6 +146,16 @@ void F_AllocLocalSpace (Function* F);
 ** nothing if there is no reserved local space.
 */
 
+int F_HasStaticFrame (const Function* F);
+/* Return true if the parameters and locals of the function are in a static
+** frame instead of the stack.
+*/
+
+unsigned F_AllocFrameSpace (Function* F, unsigned Size);
+/* Allocate the given space in the static frame and return its offset in the
+** frame area. Without a static frame, the size is only counted.
+*/
+
 int F_AllocRegVar (Function* F, const Type* Type);
 /* Allocate a register variable for the given variable type. If the allocation
 ** was successful, return the offset of the register variable in the register
@@ -48,6 +48,8 @@ unsigned char AutoCDecl         = 0;    /* Make functions default to __cdecl__ *
 unsigned char DebugInfo         = 0;    /* Add debug info to the obj */
 unsigned char PreprocessOnly    = 0;    /* Just preprocess the input */
 unsigned char DebugOptOutput    = 0;    /* Output debug stuff */
+unsigned char IntegratedAs      = 0;    /* Write an object file */
+unsigned char Precompile        = 0;    /* Write a precompiled header */
 unsigned      RegisterSpace     = 6;    /* Space available for register vars */
 
 /* Stackable options */
@@ -56,6 +58,7 @@ IntStack LocalStrings       = INTSTACK(0);  /* Emit string literals immediately
 IntStack InlineStdFuncs     = INTSTACK(0);  /* Inline some standard functions */
 IntStack EagerlyInlineFuncs = INTSTACK(0);  /* Eagerly inline some known functions */
 IntStack EnableRegVars      = INTSTACK(0);  /* Enable register variables */
+IntStack AutoRegVars        = INTSTACK(0);  /* Place locals into registers automatically */
 IntStack AllowRegVarAddr    = INTSTACK(0);  /* Allow taking addresses of register vars */
 IntStack RegVarsToCallStack = INTSTACK(0);  /* Save reg variables on call stack */
 IntStack StaticLocals       = INTSTACK(0);  /* Make local variables static */
@@ -69,3 +72,7 @@ IntStack DataAlignment      = INTSTACK(1);  /* Alignment for data */
 StrBuf DepName     = STATIC_STRBUF_INITIALIZER; /* Name of dependencies file */
 StrBuf FullDepName = STATIC_STRBUF_INITIALIZER; /* Name of full dependencies file */
 StrBuf DepTarget   = STATIC_STRBUF_INITIALIZER; /* Name of dependency target */
+StrBuf PrefixHeader = STATIC_STRBUF_INITIALIZER; /* Name of prefix header */
+StrBuf CallGraphName = STATIC_STRBUF_INITIALIZER; /* Name of call graph output */
+StrBuf StaticFramesName = STATIC_STRBUF_INITIALIZER; /* Name of program call graph */
+StrBuf ProfileName = STATIC_STRBUF_INITIALIZER; /* Name of execution profile */
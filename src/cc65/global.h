@@ -56,6 +56,8 @@ extern unsigned char    AutoCDecl;              /* Make functions default to __c
 extern unsigned char    DebugInfo;              /* Add debug info to the obj */
 extern unsigned char    PreprocessOnly;         /* Just preprocess the input */
 extern unsigned char    DebugOptOutput;         /* Output debug stuff */
+extern unsigned char    IntegratedAs;           /* Write an object file */
+extern unsigned char    Precompile;             /* Write a precompiled header */
 extern unsigned         RegisterSpace;          /* Space available for register vars */
 
 /* Stackable options */
@@ -64,6 +66,7 @@ extern IntStack         LocalStrings;           /* Emit string literals immediat
 extern IntStack         InlineStdFuncs;         /* Inline some standard functions */
 extern IntStack         EagerlyInlineFuncs;     /* Eagerly inline some known functions */
 extern IntStack         EnableRegVars;          /* Enable register variables */
+extern IntStack         AutoRegVars;            /* Place locals into registers automatically */
 extern IntStack         AllowRegVarAddr;        /* Allow taking addresses of register vars */
 extern IntStack         RegVarsToCallStack;     /* Save reg variables on call stack */
 extern IntStack         StaticLocals;           /* Make local variables static */
@@ -77,6 +80,10 @@ extern IntStack         DataAlignment;          /* Alignment for data */
 extern StrBuf           DepName;                /* Name of dependencies file */
 extern StrBuf           FullDepName;            /* Name of full dependencies file */
 extern StrBuf           DepTarget;              /* Name of dependency target */
+extern StrBuf           PrefixHeader;           /* Name of prefix header */
+extern StrBuf           CallGraphName;          /* Name of call graph output */
+extern StrBuf           StaticFramesName;       /* Name of program call graph */
+extern StrBuf           ProfileName;            /* Name of execution profile */
 
 
 
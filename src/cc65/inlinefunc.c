@@ -0,0 +1,604 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                inlinefunc.c                               */
+/*                                                                           */
+/*                     Inlining of small static functions                    */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#include <string.h>
+
+/* common */
+#include "check.h"
+#include "coll.h"
+#include "xmalloc.h"
+
+/* cc65 */
+#include "codegen.h"
+#include "datatype.h"
+#include "error.h"
+#include "expr.h"
+#include "function.h"
+#include "global.h"
+#include "loadexpr.h"
+#include "scanner.h"
+#include "stackptr.h"
+#include "symtab.h"
+#include "typeconv.h"
+#include "inlinefunc.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Only bodies consisting of expression statements and an optional final
+** return statement are inlined. Their size is measured in tokens. With a
+** code size factor of 100, bodies up to INLINE_TOKENS tokens are inlined,
+** which is usually smaller than the code to pass the arguments and call the
+** function. Larger code size factors and functions declared inline raise
+** the limit up to INLINE_MAX_TOKENS.
+*/
+#define INLINE_TOKENS           10      /* Limit for a code size factor of 100 */
+#define INLINE_HINT_FACTOR      4       /* Limit factor for inline functions */
+#define INLINE_MAX_TOKENS       64      /* Longest body remembered */
+#define INLINE_MAX_PARAMS       8       /* Max. number of parameters */
+
+/* How parameters are bound to the arguments */
+enum {
+    BIND_NONE,                          /* Missing argument */
+    BIND_CONST,                         /* Constant */
+    BIND_STACK,                         /* Variable on the stack */
+    BIND_REGISTER                       /* Register variable */
+};
+
+/* A function that may be inlined */
+typedef struct InlineFunc InlineFunc;
+struct InlineFunc {
+    SymEntry*   Func;                   /* The function */
+    FuncDesc*   Desc;                   /* Descriptor of the definition */
+    Collection  Tokens;                 /* Body without the left curly brace */
+    Collection  Globals;                /* Global symbols used in the body */
+    unsigned    Size;                   /* Number of tokens in the body */
+    unsigned    Changed;                /* Bit set of changed parameters */
+    int         Pure;                   /* No assignments and calls */
+    int         Expanding;              /* Expansion in progress */
+};
+
+/* All functions that may be inlined */
+static Collection InlineFuncs = STATIC_COLLECTION_INITIALIZER;
+
+/* Nesting level of expansions */
+static unsigned ExpandLevel = 0;
+
+
+
+/*****************************************************************************/
+/*                              Helper functions                             */
+/*****************************************************************************/
+
+
+
+static InlineFunc* FindInlineFunc (const SymEntry* Func)
+/* Find the inline function for the given symbol. Return NULL if the function
+** cannot be inlined.
+*/
+{
+    unsigned I;
+    for (I = 0; I < CollCount (&InlineFuncs); ++I) {
+        InlineFunc* F = CollAtUnchecked (&InlineFuncs, I);
+        if (F->Func == Func) {
+            return F;
+        }
+    }
+    return 0;
+}
+
+
+
+static int IsSimpleType (const Type* T)
+/* Return true if values of the given type may be passed into and out of an
+** inlined function.
+*/
+{
+    return IsClassInt (T) || IsClassPtr (T);
+}
+
+
+
+static int GetParamIndex (const FuncDesc* D, const char* Name)
+/* Return the index of the parameter with the given name or -1 */
+{
+    int       Index = 0;
+    SymEntry* Param = D->SymTab->SymHead;
+    while (Param && (Param->Flags & SC_PARAM) != 0) {
+        if (strcmp (Param->Name, Name) == 0) {
+            return Index;
+        }
+        ++Index;
+        Param = Param->NextSym;
+    }
+    return -1;
+}
+
+
+
+static int IsAssignTok (token_t Tok)
+/* Return true if the token is an assignment or increment operator */
+{
+    switch (Tok) {
+        case TOK_INC:
+        case TOK_DEC:
+        case TOK_ASSIGN:
+        case TOK_PLUS_ASSIGN:
+        case TOK_MINUS_ASSIGN:
+        case TOK_MUL_ASSIGN:
+        case TOK_DIV_ASSIGN:
+        case TOK_MOD_ASSIGN:
+        case TOK_AND_ASSIGN:
+        case TOK_OR_ASSIGN:
+        case TOK_XOR_ASSIGN:
+        case TOK_SHL_ASSIGN:
+        case TOK_SHR_ASSIGN:
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+
+
+static int IsExprTok (token_t Tok)
+/* Return true if the token may appear within an expression of an inlined
+** body.
+*/
+{
+    switch (Tok) {
+        case TOK_CONST:
+        case TOK_VOLATILE:
+        case TOK_CHAR:
+        case TOK_INT:
+        case TOK_LONG:
+        case TOK_UNSIGNED:
+        case TOK_SIGNED:
+        case TOK_SHORT:
+        case TOK_VOID:
+        case TOK_SIZEOF:
+        case TOK_IDENT:
+        case TOK_ICONST:
+        case TOK_CCONST:
+            return 1;
+        case TOK_LCURLY:
+        case TOK_RCURLY:
+            return 0;
+        default:
+            /* Operators and punctuation */
+            return Tok >= TOK_LBRACK && Tok <= TOK_RPAREN;
+    }
+}
+
+
+
+static int CheckBody (InlineFunc* F, const Collection* Body)
+/* Check if the body is simple enough to be inlined and collect the global
+** symbols and the changed parameters. Return true if so.
+*/
+{
+    const Type* ReturnType = GetFuncReturn (F->Func->Type);
+    int         Start      = 1;         /* At the start of a statement */
+    int         Return     = 0;         /* Within the return statement */
+    unsigned    I;
+
+    for (I = 0; I < F->Size; ++I) {
+
+        const Token* T     = CollConstAt (Body, I);
+        const Token* Prev  = I > 0? CollConstAt (Body, I - 1) : 0;
+        const Token* Next  = CollConstAt (Body, I + 1);
+        int          First = Start;
+
+        if (Start) {
+            /* A return statement must be the last one */
+            if (T->Tok == TOK_RETURN && !Return) {
+                if (IsTypeVoid (ReturnType) != (Next->Tok == TOK_SEMI)) {
+                    return 0;
+                }
+                Return = 1;
+                Start  = 0;
+                continue;
+            }
+            /* No declarations, labels or empty statements */
+            if (T->Tok == TOK_SEMI || TokIsType (T) || TokIsTypeQual (T) ||
+                (T->Tok == TOK_IDENT && Next->Tok == TOK_COLON)) {
+                return 0;
+            }
+            Start = 0;
+        }
+
+        /* Check for assignments and function calls */
+        if (IsAssignTok (T->Tok) ||
+            (T->Tok == TOK_LPAREN && Prev &&
+             (Prev->Tok == TOK_IDENT || Prev->Tok == TOK_RPAREN || Prev->Tok == TOK_RBRACK))) {
+            F->Pure = 0;
+        }
+
+        if (T->Tok == TOK_SEMI) {
+            if (Return && I + 1 < F->Size) {
+                return 0;
+            }
+            Start = 1;
+        } else if (!IsExprTok (T->Tok)) {
+            return 0;
+        } else if (T->Tok == TOK_IDENT &&
+                   (Prev == 0 || (Prev->Tok != TOK_DOT && Prev->Tok != TOK_PTR_REF))) {
+
+            /* A parameter or a global symbol */
+            int Index = GetParamIndex (F->Desc, T->Ident);
+            if (Index >= 0) {
+                /* Remember parameters that are changed or whose address may
+                ** be taken.
+                */
+                if ((Prev && (IsAssignTok (Prev->Tok) || Prev->Tok == TOK_AND)) ||
+                    IsAssignTok (Next->Tok)) {
+                    F->Changed |= (0x01U << Index);
+                }
+            } else {
+                SymEntry* Sym = FindGlobalSym (T->Ident);
+                if (Sym == 0 || Sym == F->Func || (First && SymIsTypeDef (Sym))) {
+                    return 0;
+                }
+                if (CollIndex (&F->Globals, Sym) < 0) {
+                    CollAppend (&F->Globals, Sym);
+                }
+            }
+        }
+    }
+
+    /* The last statement must be complete, and a value must be returned if
+    ** the function has one.
+    */
+    return Start && (Return || IsTypeVoid (ReturnType));
+}
+
+
+
+static void FreeInlineFunc (InlineFunc* F)
+/* Free an inline function */
+{
+    unsigned I;
+    for (I = 0; I < CollCount (&F->Tokens); ++I) {
+        xfree (CollAtUnchecked (&F->Tokens, I));
+    }
+    DoneCollection (&F->Tokens);
+    DoneCollection (&F->Globals);
+    xfree (F);
+}
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+int MayInlineFunc (const SymEntry* Func, const FuncDesc* D)
+/* Return true if calls of the given function may be inlined, judging from
+** its declaration only.
+*/
+{
+    const SymEntry* Param;
+
+    /* Only static functions with a prototype and simple parameter and return
+    ** types when optimizing.
+    */
+    if (!IS_Get (&Optimize)                                        ||
+        (Func->Flags & SC_EXTERN) != 0                             ||
+        (D->Flags & (FD_VARIADIC | FD_OLDSTYLE | FD_UNNAMED_PARAMS |
+                     FD_CALL_WRAPPER)) != 0                        ||
+        D->WrappedCall != 0                                        ||
+        D->ParamCount > INLINE_MAX_PARAMS) {
+        return 0;
+    }
+    if (!IsTypeVoid (GetFuncReturn (Func->Type)) &&
+        !IsSimpleType (GetFuncReturn (Func->Type))) {
+        return 0;
+    }
+    Param = D->SymTab->SymHead;
+    while (Param && (Param->Flags & SC_PARAM) != 0) {
+        if (!IsSimpleType (Param->Type)) {
+            return 0;
+        }
+        Param = Param->NextSym;
+    }
+    return 1;
+}
+
+
+
+void RecordInlineFunc (SymEntry* Func, FuncDesc* D, const Collection* Body)
+/* Must be called at the start of a function definition. Body contains the
+** tokens of the body as read by ReadAheadBlock. If the function is small and
+** simple enough, remember a copy of the body, so calls of the function may
+** be expanded in place.
+*/
+{
+    InlineFunc* F;
+    unsigned    I;
+
+    /* The body ends with the right curly brace */
+    if (!MayInlineFunc (Func, D) || CollCount (Body) > INLINE_MAX_TOKENS + 1) {
+        return;
+    }
+
+    F = xmalloc (sizeof (InlineFunc));
+    F->Func      = Func;
+    F->Desc      = D;
+    InitCollection (&F->Tokens);
+    InitCollection (&F->Globals);
+    F->Size      = CollCount (Body) - 1;
+    F->Changed   = 0;
+    F->Pure      = 1;
+    F->Expanding = 0;
+
+    if (!CheckBody (F, Body)) {
+        FreeInlineFunc (F);
+        return;
+    }
+
+    /* Copy the tokens. There are no string literals, and the line infos are
+    ** those of the call when the tokens are inserted.
+    */
+    for (I = 0; I < CollCount (Body); ++I) {
+        Token* T = xdup (CollConstAt (Body, I), sizeof (Token));
+        T->SVal = 0;
+        T->LI   = 0;
+        CollAppend (&F->Tokens, T);
+    }
+    CollAppend (&InlineFuncs, F);
+}
+
+
+
+int IsInlineFunc (const SymEntry* Func)
+/* Return true if calls of the given function are candidates for inlining */
+{
+    return FindInlineFunc (Func) != 0;
+}
+
+
+
+int InlineFuncCall (ExprDesc* Expr)
+/* Must be called by the expression parser for a call of the function in Expr
+** with the first token of the argument list as the current token. If the
+** call should be inlined, parse the arguments, expand the body of the
+** function in place, and return true. Otherwise return false without
+** consuming any tokens.
+*/
+{
+    InlineFunc* F = FindInlineFunc (Expr->Sym);
+    Type*       ReturnType;
+    SymEntry*   Param;
+    ExprDesc    Arg;
+    ExprDesc    Result;
+    unsigned    Binds[INLINE_MAX_PARAMS];
+    long        Values[INLINE_MAX_PARAMS];
+    unsigned    PushedSize = 0;         /* Size of the parameters pushed */
+    unsigned    Count  = 0;             /* Number of arguments */
+    unsigned    Limit;
+    unsigned    I;
+
+    /* The call must be evaluated within a function, and may not be part of
+    ** a constant expression.
+    */
+    if (F == 0 || F->Expanding || !IS_Get (&Optimize) || CurrentFunc == 0 ||
+        ErrorCount > 0 ||
+        (Expr->Flags & E_MASK_EVAL & ~E_EVAL_MAYBE_UNUSED) != 0 ||
+        F_GetStackPtr (CurrentFunc) != StackPtr) {
+        return 0;
+    }
+
+    /* Check the size of the body */
+    Limit = INLINE_TOKENS * IS_Get (&CodeSizeFactor) / 100;
+    if ((F->Func->Flags & SC_INLINE) != 0) {
+        Limit *= INLINE_HINT_FACTOR;
+    }
+    if (F->Size > Limit) {
+        return 0;
+    }
+
+    /* The names in the body must still denote the same global symbols */
+    for (I = 0; I < CollCount (&F->Globals); ++I) {
+        const SymEntry* Sym = CollConstAt (&F->Globals, I);
+        if (FindSym (Sym->Name) != Sym) {
+            return 0;
+        }
+    }
+
+    ReturnType = GetFuncReturn (F->Func->Type);
+
+    /* Parse the arguments. Constants for parameters that are not changed
+    ** are used as they are. If the body doesn't change anything, such
+    ** parameters may also use local and register variables passed as
+    ** arguments. All others are pushed onto the stack where they become the
+    ** local variables of the inlined body.
+    */
+    Param = F->Desc->SymTab->SymHead;
+    for (I = 0; I < INLINE_MAX_PARAMS; ++I) {
+        Binds[I] = BIND_NONE;
+    }
+    ED_Init (&Arg);
+    while (CurTok.Tok != TOK_RPAREN) {
+
+        ED_Init (&Arg);
+        Arg.Flags |= Expr->Flags & E_MASK_KEEP_SUBEXPR;
+
+        /* Evaluate the argument expression */
+        hie1 (&Arg);
+
+        if (Count < F->Desc->ParamCount) {
+
+            /* Convert the argument to the parameter type. A conversion to a
+            ** type of the same or a smaller size leaves a variable alone.
+            */
+            int ReadOnly = (F->Changed & (0x01U << Count)) == 0;
+            int Volatile = IsQualVolatile (Arg.Type);
+            TypeConversion (&Arg, Param->Type);
+
+            if (ReadOnly && ED_IsConstAbsInt (&Arg)) {
+                Binds[Count]  = BIND_CONST;
+                Values[Count] = Arg.IVal;
+            } else if (ReadOnly && F->Pure && !Volatile && ED_IsLVal (&Arg) &&
+                       !ED_IsBitField (&Arg) && ED_IsLocStack (&Arg)) {
+                Binds[Count]  = BIND_STACK;
+                Values[Count] = Arg.IVal;
+            } else if (ReadOnly && F->Pure && !Volatile && ED_IsLVal (&Arg) &&
+                       ED_IsLocRegister (&Arg) && Arg.IVal == 0) {
+                Binds[Count]  = BIND_REGISTER;
+                Values[Count] = (long) Arg.Name;
+            } else {
+                unsigned Flags = TypeOf (Param->Type) | CF_FORCECHAR;
+                LoadExpr (Flags, &Arg);
+                g_push (Flags, 0);
+                Binds[Count]  = BIND_STACK;
+                Values[Count] = StackPtr;
+                PushedSize += sizeofarg (Flags);
+            }
+            Param = Param->NextSym;
+
+        } else if (Count == F->Desc->ParamCount) {
+            Error ("Too many arguments in function call");
+        }
+        ++Count;
+
+        /* Check for end of argument list */
+        if (CurTok.Tok != TOK_COMMA) {
+            break;
+        }
+        NextToken ();
+
+        /* Check for stray comma */
+        if (CurTok.Tok == TOK_RPAREN) {
+            Error ("Argument expected after comma");
+            break;
+        }
+
+        DoDeferred (SQP_KEEP_NONE, &Arg);
+    }
+    DoDeferred (SQP_KEEP_NONE, &Arg);
+
+    /* Check if we had enough arguments */
+    if (Count < F->Desc->ParamCount) {
+        Error ("Too few arguments in function call");
+    }
+
+    /* Insert the body after the closing paren, unless the arguments were
+    ** broken.
+    */
+    if (CurTok.Tok == TOK_RPAREN && ErrorCount == 0) {
+        InsertTokens (&F->Tokens);
+    } else {
+        F = 0;
+    }
+    ConsumeRParen ();
+
+    ED_Init (&Result);
+    if (F) {
+
+        /* Warnings for the body have been output for the definition */
+        if (ExpandLevel++ == 0) {
+            IS_Push (&WarnEnable, 0);
+        }
+        F->Expanding = 1;
+        F->Func->Flags |= SC_INLINED;
+
+        /* Make the parameters visible in a new block */
+        EnterBlockLevel ();
+        Param = F->Desc->SymTab->SymHead;
+        for (I = 0; I < F->Desc->ParamCount; ++I) {
+            if (Binds[I] == BIND_CONST) {
+                AddConstSym (Param->Name, Param->Type, SC_DEF | SC_CONST, Values[I]);
+            } else if (Binds[I] == BIND_STACK) {
+                AddLocalSym (Param->Name, Param->Type, SC_AUTO | SC_DEF | SC_REF, Values[I]);
+            } else if (Binds[I] == BIND_REGISTER) {
+                AddLocalSym (Param->Name, Param->Type, SC_REGISTER | SC_DEF | SC_REF, Values[I]);
+            }
+            Param = Param->NextSym;
+        }
+
+        /* Parse the expression statements */
+        while (CurTok.Tok != TOK_RCURLY && CurTok.Tok != TOK_RETURN) {
+            ExprDesc Stmt;
+            ED_Init (&Stmt);
+            Stmt.Flags |= E_NEED_NONE;
+            Expression0 (&Stmt);
+            ConsumeSemi ();
+        }
+
+        /* Parse the return statement */
+        if (CurTok.Tok == TOK_RETURN) {
+            NextToken ();
+            if (CurTok.Tok != TOK_SEMI) {
+                Result.Flags |= Expr->Flags & E_MASK_KEEP_SUBEXPR;
+                ExprWithCheck (hie0, &Result);
+                TypeConversion (&Result, ReturnType);
+                LoadExpr (CF_NONE, &Result);
+                DoDeferred (SQP_KEEP_EXPR, &Result);
+            }
+            ConsumeSemi ();
+        }
+
+        /* Skip the right curly brace of the body */
+        while (CurTok.Tok != TOK_RCURLY && CurTok.Tok != TOK_CEOF) {
+            NextToken ();
+        }
+        NextToken ();
+
+        LeaveBlockLevel ();
+
+        F->Expanding = 0;
+        if (--ExpandLevel == 0) {
+            IS_Drop (&WarnEnable);
+        }
+    }
+
+    /* The result is an rvalue in the primary register like that of a real
+    ** call. A constant result isn't used as such, since the call isn't a
+    ** constant expression, and diagnostics for constant conditions would
+    ** be wrong.
+    */
+    if (PushedSize > 0) {
+        g_drop (PushedSize);
+        StackPtr += PushedSize;
+    }
+    ED_FinalizeRValLoad (Expr);
+    Expr->Type = ReturnType;
+
+    return 1;
+}
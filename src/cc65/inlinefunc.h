@@ -0,0 +1,81 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                inlinefunc.h                               */
+/*                                                                           */
+/*                     Inlining of small static functions                    */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#ifndef INLINEFUNC_H
+#define INLINEFUNC_H
+
+
+
+/* common */
+#include "coll.h"
+
+/* cc65 */
+#include "exprdesc.h"
+#include "funcdesc.h"
+#include "symentry.h"
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+int MayInlineFunc (const SymEntry* Func, const FuncDesc* D);
+/* Return true if calls of the given function may be inlined, judging from
+** its declaration only.
+*/
+
+void RecordInlineFunc (SymEntry* Func, FuncDesc* D, const Collection* Body);
+/* Must be called at the start of a function definition. Body contains the
+** tokens of the body as read by ReadAheadBlock. If the function is small and
+** simple enough, remember a copy of the body, so calls of the function may
+** be expanded in place.
+*/
+
+int IsInlineFunc (const SymEntry* Func);
+/* Return true if calls of the given function are candidates for inlining */
+
+int InlineFuncCall (ExprDesc* Expr);
+/* Must be called by the expression parser for a call of the function in Expr
+** with the first token of the argument list as the current token. If the
+** call should be inlined, parse the arguments, expand the body of the
+** function in place, and return true. Otherwise return false without
+** consuming any tokens.
+*/
+
+
+
+/* End of inlinefunc.h */
+
+#endif
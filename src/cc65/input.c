@@ -53,6 +53,7 @@
 #include "incpath.h"
 #include "input.h"
 #include "lineinfo.h"
+#include "macrotab.h"
 #include "output.h"
 
 
@@ -81,9 +82,19 @@ struct IFile {
     unsigned long   Size;       /* File size */
     unsigned long   MTime;      /* Time of last modification */
     InputType       Type;       /* Type of input file */
+    char*           Guard;      /* Include guard macro or NULL */
+    unsigned char   Once;       /* Don't include the file again */
     char            Name[1];    /* Name of file (dynamically allocated) */
 };
 
+/* States of the include guard detection */
+enum {
+    GS_START,                   /* Nothing seen so far */
+    GS_INSIDE,                  /* Inside the #ifndef of the guard */
+    GS_AFTER,                   /* Behind the #endif of the guard */
+    GS_NONE,                    /* File has no guard */
+};
+
 /* Struct that describes an active input file */
 typedef struct AFile AFile;
 struct AFile {
@@ -91,6 +102,9 @@ struct AFile {
     FILE*       F;              /* Input file stream */
     IFile*      Input;          /* Points to corresponding IFile */
     int         SearchPath;     /* True if we've added a path for this file */
+    unsigned    GuardState;     /* State of the include guard detection */
+    int         GuardLevel;     /* #if level of the guard directives */
+    char*       Guard;          /* Macro name of the guard candidate */
 };
 
 /* List of all input files */
@@ -125,6 +139,8 @@ static IFile* NewIFile (const char* Name, InputType Type)
     IF->Size  = 0;
     IF->MTime = 0;
     IF->Type  = Type;
+    IF->Guard = 0;
+    IF->Once  = 0;
     memcpy (IF->Name, Name, Len+1);
 
     /* Insert the new structure into the IFile collection */
@@ -156,6 +172,9 @@ static AFile* NewAFile (IFile* IF, FILE* F)
     AF->Line  = 0;
     AF->F     = F;
     AF->Input = IF;
+    AF->GuardState = GS_START;
+    AF->GuardLevel = 0;
+    AF->Guard      = 0;
 
     /* Increment the usage counter of the corresponding IFile. If this
     ** is the first use, set the file data and output debug info if
@@ -204,6 +223,7 @@ static AFile* NewAFile (IFile* IF, FILE* F)
 static void FreeAFile (AFile* AF)
 /* Free an AFile structure */
 {
+    xfree (AF->Guard);
     xfree (AF);
 }
 
@@ -268,11 +288,38 @@ void OpenMainFile (const char* Name)
 
 
 
+static void OpenIFile (IFile* IF)
+/* Open an include file and make it the current input file */
+{
+    FILE* F;
+
+    /* If we know the file would add nothing, don't read it again */
+    if (IF->Once || (IF->Guard && IsMacro (IF->Guard))) {
+        Print (stdout, 1, "Skipped include file '%s'\n", IF->Name);
+        return;
+    }
+
+    /* Open the file */
+    F = fopen (IF->Name, "r");
+    if (F == 0) {
+        /* Error opening the file */
+        PPError ("Cannot open include file '%s': %s", IF->Name, strerror (errno));
+        return;
+    }
+
+    /* Debugging output */
+    Print (stdout, 1, "Opened include file '%s'\n", IF->Name);
+
+    /* Allocate a new AFile structure */
+    (void) NewAFile (IF, F);
+}
+
+
+
 void OpenIncludeFile (const char* Name, InputType IT)
 /* Open an include file and insert it into the tables. */
 {
     char*  N;
-    FILE*  F;
     IFile* IF;
 
     /* Check for the maximum include nesting */
@@ -300,18 +347,84 @@ void OpenIncludeFile (const char* Name, InputType IT)
     xfree (N);
 
     /* Open the file */
-    F = fopen (IF->Name, "r");
-    if (F == 0) {
-        /* Error opening the file */
-        PPError ("Cannot open include file '%s': %s", IF->Name, strerror (errno));
+    OpenIFile (IF);
+}
+
+
+
+void OpenPrefixFile (const char* Name)
+/* Open the prefix header given on the command line. Other than include
+** files, it is not searched for in the include paths.
+*/
+{
+    /* Create a new IFile object if we don't have one */
+    IFile* IF = FindFile (Name);
+    if (IF == 0) {
+        IF = NewIFile (Name, IT_USRINC);
+    }
+
+    /* Open the file */
+    OpenIFile (IF);
+}
+
+
+
+void TrackIncludeGuard (GuardLineType Type, int IfLevel, const char* Ident)
+/* Tell the include guard detection about a line of the current file. IfLevel
+** is the #if nesting level outside of the line; for #else, #elif and #endif
+** that is the level outside of the #if they belong to. Ident is the macro
+** name of an #ifndef directive.
+*/
+{
+    AFile* Input;
+
+    if (CollCount (&AFiles) == 0) {
         return;
     }
+    Input = CollLast (&AFiles);
 
-    /* Debugging output */
-    Print (stdout, 1, "Opened include file '%s'\n", IF->Name);
+    switch (Input->GuardState) {
 
-    /* Allocate a new AFile structure */
-    (void) NewAFile (IF, F);
+        case GS_START:
+            /* The first line of the file must be the #ifndef */
+            if (Type == GL_IFNDEF) {
+                Input->GuardState = GS_INSIDE;
+                Input->GuardLevel = IfLevel;
+                Input->Guard      = xstrdup (Ident);
+            } else {
+                Input->GuardState = GS_NONE;
+            }
+            break;
+
+        case GS_INSIDE:
+            /* Anything nested is fine. On the level of the guard, only the
+            ** #endif is allowed.
+            */
+            if (IfLevel == Input->GuardLevel) {
+                Input->GuardState = (Type == GL_ENDIF)? GS_AFTER : GS_NONE;
+            } else if (IfLevel < Input->GuardLevel) {
+                Input->GuardState = GS_NONE;
+            }
+            break;
+
+        case GS_AFTER:
+            /* Nothing may follow the #endif */
+            Input->GuardState = GS_NONE;
+            break;
+
+        default:
+            break;
+    }
+}
+
+
+
+void MarkFileOnce (void)
+/* Mark the current input file, so it isn't included again (#pragma once) */
+{
+    if (CollCount (&AFiles) > 0) {
+        ((AFile*) CollLast (&AFiles))->Input->Once = 1;
+    }
 }
 
 
@@ -335,6 +448,15 @@ static void CloseIncludeFile (void)
     /* Close the current input file (we're just reading so no error check) */
     fclose (Input->F);
 
+    /* If the file turned out to be completely enclosed in an include guard,
+    ** remember the guard macro.
+    */
+    if (Input->GuardState == GS_AFTER) {
+        xfree (Input->Input->Guard);
+        Input->Input->Guard = Input->Guard;
+        Input->Guard = 0;
+    }
+
     /* Delete the last active file from the active file collection */
     CollDelete (&AFiles, AFileCount-1);
 
@@ -531,6 +653,72 @@ const char* GetInputFile (const struct IFile* IF)
 
 
 
+unsigned GetInputFileCount (void)
+/* Return the number of input files seen so far */
+{
+    return CollCount (&IFiles);
+}
+
+
+
+void GetInputFileInfo (unsigned Index, const char** Name,
+                       unsigned long* Size, unsigned long* MTime)
+/* Return name, size and modification time of the input file with the given
+** zero based index.
+*/
+{
+    const IFile* IF = (const IFile*) CollConstAt (&IFiles, Index);
+    *Name  = IF->Name;
+    *Size  = IF->Size;
+    *MTime = IF->MTime;
+}
+
+
+
+void GetInputFileState (unsigned Index, InputType* Type,
+                        const char** Guard, int* Once)
+/* Return the type, the include guard macro (or NULL) and the #pragma once
+** flag of the input file with the given zero based index.
+*/
+{
+    const IFile* IF = (const IFile*) CollConstAt (&IFiles, Index);
+    *Type  = IF->Type;
+    *Guard = IF->Guard;
+    *Once  = IF->Once;
+}
+
+
+
+void AddInputFile (const char* Name, InputType Type, unsigned long Size,
+                   unsigned long MTime, const char* Guard, int Once)
+/* Add a file read by a precompiled header to the list of input files, so
+** it is part of the dependencies and is not included again if it has an
+** include guard.
+*/
+{
+    IFile* IF = FindFile (Name);
+    if (IF == 0) {
+        IF = NewIFile (Name, Type);
+        IF->Size  = Size;
+        IF->MTime = MTime;
+    }
+    if (Guard) {
+        xfree (IF->Guard);
+        IF->Guard = xstrdup (Guard);
+    }
+    IF->Once |= Once;
+}
+
+
+
+unsigned GetInputFileIndex (const struct IFile* IF)
+/* Return the zero based index of the given input file */
+{
+    return IF->Index - 1;
+}
+
+
+
 const char* GetCurrentFile (void)
 /* Return the name of the current input file */
 {
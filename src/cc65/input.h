@@ -60,6 +60,13 @@ typedef enum {
     IT_USRINC = 0x04,           /* User include file (using "") */
 } InputType;
 
+/* Kinds of lines reported to the include guard detection */
+typedef enum {
+    GL_IFNDEF,                  /* #ifndef directive */
+    GL_ENDIF,                   /* #endif directive */
+    GL_OTHER,                   /* Any other directive or code */
+} GuardLineType;
+
 /* Forward for an IFile structure */
 struct IFile;
 
@@ -84,6 +91,21 @@ void OpenMainFile (const char* Name);
 void OpenIncludeFile (const char* Name, InputType IT);
 /* Open an include file and insert it into the tables. */
 
+void OpenPrefixFile (const char* Name);
+/* Open the prefix header given on the command line. Other than include
+** files, it is not searched for in the include paths.
+*/
+
+void TrackIncludeGuard (GuardLineType Type, int IfLevel, const char* Ident);
+/* Tell the include guard detection about a line of the current file. IfLevel
+** is the #if nesting level outside of the line; for #else, #elif and #endif
+** that is the level outside of the #if they belong to. Ident is the macro
+** name of an #ifndef directive.
+*/
+
+void MarkFileOnce (void);
+/* Mark the current input file, so it isn't included again (#pragma once) */
+
 void NextChar (void);
 /* Read the next character from the input stream and make CurC and NextC
 ** valid. If end of line is reached, both are set to NUL, no more lines
@@ -104,6 +126,31 @@ int NextLine (void);
 const char* GetInputFile (const struct IFile* IF);
 /* Return a filename from an IFile struct */
 
+unsigned GetInputFileCount (void);
+/* Return the number of input files seen so far */
+
+void GetInputFileInfo (unsigned Index, const char** Name,
+                       unsigned long* Size, unsigned long* MTime);
+/* Return name, size and modification time of the input file with the given
+** zero based index.
+*/
+
+void GetInputFileState (unsigned Index, InputType* Type,
+                        const char** Guard, int* Once);
+/* Return the type, the include guard macro (or NULL) and the #pragma once
+** flag of the input file with the given zero based index.
+*/
+
+void AddInputFile (const char* Name, InputType Type, unsigned long Size,
+                   unsigned long MTime, const char* Guard, int Once);
+/* Add a file read by a precompiled header to the list of input files, so
+** it is part of the dependencies and is not included again if it has an
+** include guard.
+*/
+
+unsigned GetInputFileIndex (const struct IFile* IF);
+/* Return the zero based index of the given input file */
+
 const char* GetCurrentFile (void);
 /* Return the name of the current input file */
 
@@ -494,3 +494,41 @@ Literal* AddLiteralStr (const StrBuf* S)
 {
     return AddLiteralBuf (SB_GetConstBuf (S), SB_GetLen (S));
 }
+
+
+
+void CollectGlobalLiterals (Collection* Literals, int Writable)
+/* Add the writable or readonly literals of the global literal pool to the
+** given collection.
+*/
+{
+    const Collection* C = Writable? &GlobalPool->WritableLiterals :
+                                    &GlobalPool->ReadOnlyLiterals;
+    unsigned I;
+    for (I = 0; I < CollCount (C); ++I) {
+        CollAppend (Literals, CollAtUnchecked (C, I));
+    }
+}
+
+
+
+void AddGlobalLiteral (const StrBuf* S, unsigned Label, int Writable)
+/* Add a literal with the given label to the global literal pool. Used when
+** loading a precompiled header.
+*/
+{
+    /* Create a new literal using the given label */
+    Literal* L = xmalloc (sizeof (*L));
+    L->Label    = Label;
+    L->RefCount = 0;
+    L->Output   = 0;
+    SB_Init (&L->Data);
+    SB_Append (&L->Data, S);
+
+    /* Add it to the correct pool */
+    if (Writable) {
+        CollAppend (&GlobalPool->WritableLiterals, L);
+    } else {
+        CollAppend (&GlobalPool->ReadOnlyLiterals, L);
+    }
+}
@@ -41,6 +41,7 @@
 #include <stdio.h>
 
 /* common */
+#include "coll.h"
 #include "strbuf.h"
 
 
@@ -130,6 +131,16 @@ Literal* AddLiteralBuf (const void* Buf, unsigned Len);
 Literal* AddLiteralStr (const StrBuf* S);
 /* Add a literal string to the literal pool. Return the literal. */
 
+void CollectGlobalLiterals (Collection* Literals, int Writable);
+/* Add the writable or readonly literals of the global literal pool to the
+** given collection.
+*/
+
+void AddGlobalLiteral (const StrBuf* S, unsigned Label, int Writable);
+/* Add a literal with the given label to the global literal pool. Used when
+** loading a precompiled header.
+*/
+
 
 
 /* End of litpool.h */
@@ -46,8 +46,10 @@
 #include "expr.h"
 #include "function.h"
 #include "global.h"
+#include "lineinfo.h"
 #include "loadexpr.h"
 #include "locals.h"
+#include "regvars.h"
 #include "stackptr.h"
 #include "standard.h"
 #include "staticassert.h"
@@ -96,6 +98,20 @@ static void AllocStorage (unsigned DataLabel, void (*UseSeg) (), unsigned Size)
 
 
 
+static void AllocAutoStorage (unsigned DataLabel, unsigned Size)
+/* Reserve Size bytes of storage for an auto variable that is not on the
+** stack, either in the static frame of the function or in the BSS segment.
+*/
+{
+    if (F_HasStaticFrame (CurrentFunc)) {
+        g_defframelabel (DataLabel, F_AllocFrameSpace (CurrentFunc, Size));
+    } else {
+        AllocStorage (DataLabel, g_usebss, Size);
+    }
+}
+
+
+
 static void ParseRegisterDecl (Declaration* Decl, int Reg)
 /* Parse the declaration of a register variable. Reg is the offset of the
 ** variable in the register bank.
@@ -198,7 +214,7 @@ static void ParseAutoDecl (Declaration* Decl)
     unsigned Size = SizeOf (Decl->Type);
 
     /* Check if this is a variable on the stack or in static memory */
-    if (IS_Get (&StaticLocals) == 0) {
+    if (IS_Get (&StaticLocals) == 0 && !F_HasStaticFrame (CurrentFunc)) {
 
         /* Add the symbol to the symbol table. The stack offset we use here
         ** may get corrected later.
@@ -286,7 +302,7 @@ static void ParseAutoDecl (Declaration* Decl)
             ** We abuse the Collection somewhat by using it to store line
             ** numbers.
             */
-            CollReplace (&CurrentFunc->LocalsBlockStack, (void *)(long)GetCurrentLine (),
+            CollReplace (&CurrentFunc->LocalsBlockStack, (void *)(long)GetInputLine (CurTok.LI),
                 CollCount (&CurrentFunc->LocalsBlockStack) - 1);
 
         } else {
@@ -329,7 +345,7 @@ static void ParseAutoDecl (Declaration* Decl)
                 Size = ParseInit (Sym->Type);
 
                 /* Allocate space for the variable */
-                AllocStorage (DataLabel, g_usebss, Size);
+                AllocAutoStorage (DataLabel, Size);
 
                 /* Generate code to copy this data into the variable space */
                 g_initstatic (InitLabel, DataLabel, Size);
@@ -340,7 +356,7 @@ static void ParseAutoDecl (Declaration* Decl)
                 ED_Init (&Expr);
 
                 /* Allocate space for the variable */
-                AllocStorage (DataLabel, g_usebss, Size);
+                AllocAutoStorage (DataLabel, Size);
 
                 /* Parse the expression */
                 hie1 (&Expr);
@@ -364,11 +380,16 @@ static void ParseAutoDecl (Declaration* Decl)
         } else {
 
             /* No assignment - allocate a label and space for the variable */
-            AllocStorage (DataLabel, g_usebss, Size);
+            AllocAutoStorage (DataLabel, Size);
 
         }
     }
 
+    /* Count the variable for the call graph */
+    if (!F_HasStaticFrame (CurrentFunc)) {
+        F_AllocFrameSpace (CurrentFunc, Size);
+    }
+
     /* Cannot allocate a variable of zero size */
     if (Size == 0) {
         if (IsTypeArray (Decl->Type)) {
@@ -486,10 +507,23 @@ static void ParseOneDecl (const DeclSpec* Spec)
     if ((Decl.StorageClass & SC_DEF) == SC_DEF &&
         (Decl.StorageClass & SC_TYPEMASK) != SC_TYPEDEF) {
 
+        int Reg = 0;    /* Initialize to avoid gcc complains */
+
+        /* Auto variables of the outermost block may have been chosen for
+        ** the register bank because they are used often.
+        */
+        if ((Decl.StorageClass & SC_AUTO) != 0                  &&
+            GetLexicalLevel () == LEX_LEVEL_FUNCTION            &&
+            (IsClassInt (Decl.Type) || IsClassPtr (Decl.Type))  &&
+            !IsQualVolatile (Decl.Type)                         &&
+            IsAutoRegVar (Decl.Ident)) {
+            Decl.StorageClass = (Decl.StorageClass & ~SC_AUTO) | SC_REGISTER | SC_STATIC;
+        }
+
         /* If we have a register variable, try to allocate a register and
         ** convert the declaration to "auto" if this is not possible.
         */
-        int Reg = 0;    /* Initialize to avoid gcc complains */
+
         if ((Decl.StorageClass & SC_REGISTER) != 0 &&
             (Reg = F_AllocRegVar (CurrentFunc, Decl.Type)) < 0) {
             /* No space for this register variable, convert to auto */
@@ -83,6 +83,9 @@ Macro* NewMacro (const char* Name)
     InitCollection (&M->FormalArgs);
     SB_Init (&M->Replacement);
     M->Variadic    = 0;
+    M->Tokenized   = 0;
+    M->Plain       = 0;
+    InitCollection (&M->Tokens);
     memcpy (M->Name, Name, Len+1);
 
     /* Return the new macro */
@@ -103,11 +106,36 @@ void FreeMacro (Macro* M)
     }
     DoneCollection (&M->FormalArgs);
     SB_Done (&M->Replacement);
+    for (I = 0; I < CollCount (&M->Tokens); ++I) {
+        MacroTok* T = CollAtUnchecked (&M->Tokens, I);
+        SB_Done (&T->Text);
+        xfree (T);
+    }
+    DoneCollection (&M->Tokens);
     xfree (M);
 }
 
 
 
+MacroTok* AddMacroTok (Macro* M, MacroTokType Type, int Arg)
+/* Append a new token to the pre-tokenized replacement list of a macro and
+** return it.
+*/
+{
+    /* Allocate and initialize the token */
+    MacroTok* T = xmalloc (sizeof (MacroTok));
+    T->Type  = Type;
+    T->Arg   = Arg;
+    T->Space = 0;
+    SB_Init (&T->Text);
+
+    /* Add it to the list and return it */
+    CollAppend (&M->Tokens, T);
+    return T;
+}
+
+
+
 void DefineNumericMacro (const char* Name, long Val)
 /* Define a macro for a numeric constant */
 {
@@ -281,6 +309,21 @@ int MacroCmp (const Macro* M1, const Macro* M2)
 
 
 
+void CollectMacros (Collection* Macros)
+/* Add all macros in the macro table to the given collection */
+{
+    unsigned I;
+    Macro* M;
+
+    for (I = 0; I < MACRO_TAB_SIZE; ++I) {
+        for (M = MacroTab[I]; M; M = M->Next) {
+            CollAppend (Macros, M);
+        }
+    }
+}
+
+
+
 void PrintMacroStats (FILE* F)
 /* Print macro statistics to the given text file. */
 {
@@ -51,6 +51,25 @@
 
 
 
+/* Token types in a pre-tokenized macro replacement list */
+typedef enum {
+    MT_TEXT,                    /* Text without macro parameters */
+    MT_PARAM,                   /* Macro replaced actual argument */
+    MT_PARAM_RAW,               /* Actual argument as is (operand of ##) */
+    MT_PASTE,                   /* ## operator */
+    MT_STRINGIZE,               /* # operator applied to an argument */
+    MT_BAD_STRINGIZE,           /* # operator without a parameter */
+} MacroTokType;
+
+/* A token in a pre-tokenized macro replacement list */
+typedef struct MacroTok MacroTok;
+struct MacroTok {
+    MacroTokType  Type;         /* Type of the token */
+    int           Arg;          /* Argument index for parameter tokens */
+    unsigned char Space;        /* MT_PARAM: Whitespace followed the param */
+    StrBuf        Text;         /* MT_TEXT: The text of the token */
+};
+
 /* Structure describing a macro */
 typedef struct Macro Macro;
 struct Macro {
@@ -61,6 +80,9 @@ struct Macro {
     Collection    FormalArgs;   /* Formal argument list (char*) */
     StrBuf        Replacement;  /* Replacement text */
     unsigned char Variadic;     /* C99 variadic macro */
+    unsigned char Tokenized;    /* Tokens is valid */
+    unsigned char Plain;        /* Object like macro without identifiers */
+    Collection    Tokens;       /* Pre-tokenized replacement (MacroTok*) */
     char          Name[1];      /* Name, dynamically allocated */
 };
 
@@ -82,6 +104,11 @@ void FreeMacro (Macro* M);
 ** table, use UndefineMacro for that.
 */
 
+MacroTok* AddMacroTok (Macro* M, MacroTokType Type, int Arg);
+/* Append a new token to the pre-tokenized replacement list of a macro and
+** return it.
+*/
+
 void DefineNumericMacro (const char* Name, long Val);
 /* Define a macro for a numeric constant */
 
@@ -121,6 +148,9 @@ void AddMacroArg (Macro* M, const char* Arg);
 int MacroCmp (const Macro* M1, const Macro* M2);
 /* Compare two macros and return zero if both are identical. */
 
+void CollectMacros (Collection* Macros);
+/* Add all macros in the macro table to the given collection */
+
 void PrintMacroStats (FILE* F);
 /* Print macro statistics to the given text file. */
 
@@ -56,6 +56,7 @@
 
 /* cc65 */
 #include "asmcode.h"
+#include "callgraph.h"
 #include "compile.h"
 #include "codeopt.h"
 #include "error.h"
@@ -63,7 +64,9 @@
 #include "incpath.h"
 #include "input.h"
 #include "macrotab.h"
+#include "objasm.h"
 #include "output.h"
+#include "profile.h"
 #include "scanner.h"
 #include "segments.h"
 #include "standard.h"
@@ -105,7 +108,9 @@ static void Usage (void)
             "Long options:\n"
             "  --add-source\t\t\tInclude source as comment\n"
             "  --all-cdecl\t\t\tMake functions default to __cdecl__\n"
+            "  --auto-register-vars\t\tPlace often used locals into registers\n"
             "  --bss-name seg\t\tSet the name of the BSS segment\n"
+            "  --call-graph name\t\tWrite the call graph of the input file\n"
             "  --check-stack\t\t\tGenerate stack overflow checks\n"
             "  --code-name seg\t\tSet the name of the CODE segment\n"
             "  --codesize x\t\t\tAccept larger code by factor x\n"
@@ -124,15 +129,20 @@ static void Usage (void)
             "  --help\t\t\tHelp (this text)\n"
             "  --include-dir dir\t\tSet an include directory search path\n"
             "  --inline-stdfuncs\t\tInline some standard functions\n"
+            "  --integrated-as\t\tWrite an object file instead of assembler code\n"
             "  --list-opt-steps\t\tList all optimizer steps and exit\n"
             "  --list-warnings\t\tList available warning types for -W\n"
             "  --local-strings\t\tEmit string literals immediately\n"
             "  --memory-model model\t\tSet the memory model\n"
+            "  --precompile\t\t\tWrite a precompiled header\n"
+            "  --prefix-header file\t\tRead a header before the input file\n"
+            "  --profile-use name\t\tOptimize using an execution profile\n"
             "  --register-space b\t\tSet space available for register variables\n"
             "  --register-vars\t\tEnable register variables\n"
             "  --rodata-name seg\t\tSet the name of the RODATA segment\n"
             "  --signed-chars\t\tDefault characters are signed\n"
             "  --standard std\t\tLanguage standard (c89, c99, cc65)\n"
+            "  --static-frames name\t\tUse static frames from a program call graph\n"
             "  --static-locals\t\tMake local variables static\n"
             "  --target sys\t\t\tSet the target system\n"
             "  --verbose\t\t\tIncrease verbosity\n"
@@ -391,6 +401,15 @@ static void OptAllCDecl (const char* Opt attribute ((unused)),
 
 
 
+static void OptAutoRegisterVars (const char* Opt attribute ((unused)),
+                                 const char* Arg attribute ((unused)))
+/* Handle the --auto-register-vars option */
+{
+    IS_Set (&AutoRegVars, 1);
+}
+
+
+
 static void OptBssName (const char* Opt attribute ((unused)), const char* Arg)
 /* Handle the --bss-name option */
 {
@@ -403,6 +422,14 @@ static void OptBssName (const char* Opt attribute ((unused)), const char* Arg)
 
 
 
+static void OptCallGraph (const char* Opt, const char* Arg)
+/* Handle the --call-graph option */
+{
+    FileNameOption (Opt, Arg, &CallGraphName);
+}
+
+
+
 static void OptCheckStack (const char* Opt attribute ((unused)),
                            const char* Arg attribute ((unused)))
 /* Handle the --check-stack option */
@@ -639,6 +666,15 @@ static void OptInlineStdFuncs (const char* Opt attribute((unused)),
 
 
 
+static void OptIntegratedAs (const char* Opt attribute ((unused)),
+                             const char* Arg attribute ((unused)))
+/* Write an object file directly */
+{
+    IntegratedAs = 1;
+}
+
+
+
 static void OptListOptSteps (const char* Opt attribute ((unused)),
                              const char* Arg attribute ((unused)))
 /* List all optimizer steps */
@@ -698,6 +734,31 @@ static void OptMemoryModel (const char* Opt, const char* Arg)
 
 
 
+static void OptPrecompile (const char* Opt attribute ((unused)),
+                           const char* Arg attribute ((unused)))
+/* Write a precompiled header */
+{
+    Precompile = 1;
+}
+
+
+
+static void OptPrefixHeader (const char* Opt, const char* Arg)
+/* Handle the --prefix-header option */
+{
+    FileNameOption (Opt, Arg, &PrefixHeader);
+}
+
+
+
+static void OptProfileUse (const char* Opt, const char* Arg)
+/* Handle the --profile-use option */
+{
+    FileNameOption (Opt, Arg, &ProfileName);
+}
+
+
+
 static void OptRegisterSpace (const char* Opt, const char* Arg)
 /* Handle the --register-space option */
 {
@@ -755,6 +816,14 @@ static void OptStandard (const char* Opt, const char* Arg)
 
 
 
+static void OptStaticFrames (const char* Opt, const char* Arg)
+/* Handle the --static-frames option */
+{
+    FileNameOption (Opt, Arg, &StaticFramesName);
+}
+
+
+
 static void OptStaticLocals (const char* Opt attribute ((unused)),
                              const char* Arg attribute ((unused)))
 /* Place local variables in static storage */
@@ -852,7 +921,9 @@ int main (int argc, char* argv[])
     static const LongOpt OptTab[] = {
         { "--add-source",           0,      OptAddSource            },
         { "--all-cdecl",            0,      OptAllCDecl             },
+        { "--auto-register-vars",   0,      OptAutoRegisterVars     },
         { "--bss-name",             1,      OptBssName              },
+        { "--call-graph",           1,      OptCallGraph            },
         { "--check-stack",          0,      OptCheckStack           },
         { "--code-name",            1,      OptCodeName             },
         { "--codesize",             1,      OptCodeSize             },
@@ -871,15 +942,20 @@ int main (int argc, char* argv[])
         { "--help",                 0,      OptHelp                 },
         { "--include-dir",          1,      OptIncludeDir           },
         { "--inline-stdfuncs",      0,      OptInlineStdFuncs       },
+        { "--integrated-as",        0,      OptIntegratedAs         },
         { "--list-opt-steps",       0,      OptListOptSteps         },
         { "--list-warnings",        0,      OptListWarnings         },
         { "--local-strings",        0,      OptLocalStrings         },
         { "--memory-model",         1,      OptMemoryModel          },
+        { "--precompile",           0,      OptPrecompile           },
+        { "--prefix-header",        1,      OptPrefixHeader         },
+        { "--profile-use",          1,      OptProfileUse           },
         { "--register-space",       1,      OptRegisterSpace        },
         { "--register-vars",        0,      OptRegisterVars         },
         { "--rodata-name",          1,      OptRodataName           },
         { "--signed-chars",         0,      OptSignedChars          },
         { "--standard",             1,      OptStandard             },
+        { "--static-frames",        1,      OptStaticFrames         },
         { "--static-locals",        0,      OptStaticLocals         },
         { "--target",               1,      OptTarget               },
         { "--verbose",              0,      OptVerbose              },
@@ -1054,6 +1130,20 @@ int main (int argc, char* argv[])
         }
     }
 
+    /* A precompiled header has no preprocessor output */
+    if (Precompile && PreprocessOnly) {
+        AbEnd ("Cannot use option '--precompile' together with '-E'");
+    }
+
+    /* The integrated assembler knows only the CPUs the compiler generates
+    ** code for.
+    */
+    if (IntegratedAs && CPU != CPU_6502 && CPU != CPU_6502X &&
+        CPU != CPU_6502DTV && CPU != CPU_65SC02 && CPU != CPU_65C02) {
+        AbEnd ("CPU '%s' is not supported by the integrated assembler",
+               CPUNames[CPU]);
+    }
+
     /* If no memory model was given, use the default */
     if (MemoryModel == MMODEL_UNKNOWN) {
         SetMemoryModel (MMODEL_NEAR);
@@ -1067,27 +1157,55 @@ int main (int argc, char* argv[])
     /* Track string buffer allocation */
     InitDiagnosticStrBufs ();
 
+    /* Read the program call graph if we have one */
+    CG_Init (InputFile);
+
+    /* Read the execution profile if we have one */
+    PF_Init ();
+
     /* Go! */
     Compile (InputFile);
 
-    /* Create the output file if we didn't had any errors */
-    if (PreprocessOnly == 0 && (ErrorCount == 0 || Debug)) {
+    /* Create the output file if we didn't had any errors. A precompiled
+    ** header was already written by Compile().
+    */
+    if (Precompile) {
+
+        /* Create dependencies if requested */
+        if (ErrorCount == 0) {
+            CreateDependencies ();
+        }
+
+    } else if (PreprocessOnly == 0 && (ErrorCount == 0 || Debug)) {
 
         /* Emit literals, do cleanup and optimizations */
         FinishCompile ();
 
-        /* Open the file */
-        OpenOutputFile ();
+        if (IntegratedAs) {
 
-        /* Write the output to the file */
-        WriteAsmOutput ();
-        Print (stdout, 1, "Wrote output to '%s'\n", OutputFilename);
+            /* Translate the output into an object file */
+            WriteObjOutput ();
 
-        /* Close the file, check for errors */
-        CloseOutputFile ();
+        } else {
+
+            /* Open the file */
+            OpenOutputFile ();
+
+            /* Write the output to the file */
+            WriteAsmOutput ();
+            Print (stdout, 1, "Wrote output to '%s'\n", OutputFilename);
+
+            /* Close the file, check for errors */
+            CloseOutputFile ();
+        }
 
         /* Create dependencies if requested */
         CreateDependencies ();
+
+        /* Write the call graph if requested */
+        if (ErrorCount == 0) {
+            CG_Done ();
+        }
     }
 
     /* Done with tracked string buffer allocation */
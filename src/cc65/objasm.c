@@ -0,0 +1,1226 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                  objasm.c                                 */
+/*                                                                           */
+/*                Integrated assembler for the compiler output               */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* common */
+#include "addrsize.h"
+#include "assertion.h"
+#include "chartype.h"
+#include "check.h"
+#include "coll.h"
+#include "cpu.h"
+#include "exprdefs.h"
+#include "hlldbgsym.h"
+#include "objdefs.h"
+#include "objspan.h"
+#include "objwrite.h"
+#include "optdefs.h"
+#include "print.h"
+#include "strbuf.h"
+#include "strpool.h"
+#include "version.h"
+#include "xmalloc.h"
+
+/* cc65 */
+#include "codeent.h"
+#include "codeseg.h"
+#include "dataseg.h"
+#include "error.h"
+#include "global.h"
+#include "input.h"
+#include "objasm.h"
+#include "objexpr.h"
+#include "objseg.h"
+#include "objsym.h"
+#include "output.h"
+#include "segments.h"
+#include "symtab.h"
+#include "textseg.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Addressing modes of the target instructions. Each zero page mode comes
+** before its absolute counterpart, so the lowest mode left is the shortest.
+*/
+enum {
+    M_IMP,                      /* Implicit */
+    M_ACC,                      /* Accumulator */
+    M_IMM,                      /* Immediate */
+    M_ZP,                       /* Zeropage */
+    M_ABS,                      /* Absolute */
+    M_ZPX,                      /* Zeropage,X */
+    M_ABSX,                     /* Absolute,X */
+    M_ZPY,                      /* Zeropage,Y */
+    M_ABSY,                     /* Absolute,Y */
+    M_ZPXIND,                   /* (Zeropage,X) */
+    M_ABSXIND,                  /* (Absolute,X) */
+    M_ZPINDY,                   /* (Zeropage),Y */
+    M_ZPIND,                    /* (Zeropage) */
+    M_ABSIND,                   /* (Absolute) */
+    M_REL,                      /* Relative branch */
+    M_COUNT
+};
+
+/* Sets of addressing modes */
+#define MS(M)           (1U << (M))
+#define MS_ZP           (MS (M_ZP) | MS (M_ZPX) | MS (M_ZPY) | MS (M_ZPXIND) | \
+                         MS (M_ZPINDY) | MS (M_ZPIND))
+#define MS_ABS          (MS (M_ABS) | MS (M_ABSX) | MS (M_ABSY) |            \
+                         MS (M_ABSXIND) | MS (M_ABSIND))
+
+/* Size of the operand for each addressing mode */
+static const unsigned char OperandSize[M_COUNT] = {
+    0, 0, 1, 1, 2, 1, 2, 1, 2, 1, 2, 1, 1, 2, 1
+};
+
+/* Instruction sets. All CPUs include the 6502 set, the 65C02 includes the
+** 65SC02 set.
+*/
+#define IS_6502         CPU_ISET_6502
+#define IS_DTV          CPU_ISET_6502DTV
+#define IS_CMOS         CPU_ISET_65SC02
+#define IS_WDC          CPU_ISET_65C02
+
+/* Opcode of an instruction in one addressing mode */
+typedef struct InsCode InsCode;
+struct InsCode {
+    unsigned char       OPC;            /* Compiler opcode */
+    unsigned char       Mode;           /* Addressing mode */
+    unsigned char       Code;           /* Opcode byte */
+    unsigned            ISet;           /* Instruction set */
+};
+
+static const InsCode InsTab[] = {
+    { OP65_ADC, M_IMM,     0x69, IS_6502 },
+    { OP65_ADC, M_ZP,      0x65, IS_6502 },
+    { OP65_ADC, M_ZPX,     0x75, IS_6502 },
+    { OP65_ADC, M_ABS,     0x6D, IS_6502 },
+    { OP65_ADC, M_ABSX,    0x7D, IS_6502 },
+    { OP65_ADC, M_ABSY,    0x79, IS_6502 },
+    { OP65_ADC, M_ZPXIND,  0x61, IS_6502 },
+    { OP65_ADC, M_ZPINDY,  0x71, IS_6502 },
+    { OP65_ADC, M_ZPIND,   0x72, IS_CMOS },
+    { OP65_AND, M_IMM,     0x29, IS_6502 },
+    { OP65_AND, M_ZP,      0x25, IS_6502 },
+    { OP65_AND, M_ZPX,     0x35, IS_6502 },
+    { OP65_AND, M_ABS,     0x2D, IS_6502 },
+    { OP65_AND, M_ABSX,    0x3D, IS_6502 },
+    { OP65_AND, M_ABSY,    0x39, IS_6502 },
+    { OP65_AND, M_ZPXIND,  0x21, IS_6502 },
+    { OP65_AND, M_ZPINDY,  0x31, IS_6502 },
+    { OP65_AND, M_ZPIND,   0x32, IS_CMOS },
+    { OP65_ASL, M_ACC,     0x0A, IS_6502 },
+    { OP65_ASL, M_ZP,      0x06, IS_6502 },
+    { OP65_ASL, M_ZPX,     0x16, IS_6502 },
+    { OP65_ASL, M_ABS,     0x0E, IS_6502 },
+    { OP65_ASL, M_ABSX,    0x1E, IS_6502 },
+    { OP65_BCC, M_REL,     0x90, IS_6502 },
+    { OP65_BCS, M_REL,     0xB0, IS_6502 },
+    { OP65_BEQ, M_REL,     0xF0, IS_6502 },
+    { OP65_BIT, M_IMM,     0x89, IS_CMOS },
+    { OP65_BIT, M_ZP,      0x24, IS_6502 },
+    { OP65_BIT, M_ZPX,     0x34, IS_CMOS },
+    { OP65_BIT, M_ABS,     0x2C, IS_6502 },
+    { OP65_BIT, M_ABSX,    0x3C, IS_CMOS },
+    { OP65_BMI, M_REL,     0x30, IS_6502 },
+    { OP65_BNE, M_REL,     0xD0, IS_6502 },
+    { OP65_BPL, M_REL,     0x10, IS_6502 },
+    { OP65_BRA, M_REL,     0x80, IS_CMOS },
+    { OP65_BRA, M_REL,     0x12, IS_DTV  },
+    { OP65_BRK, M_IMP,     0x00, IS_6502 },
+    { OP65_BVC, M_REL,     0x50, IS_6502 },
+    { OP65_BVS, M_REL,     0x70, IS_6502 },
+    { OP65_CLC, M_IMP,     0x18, IS_6502 },
+    { OP65_CLD, M_IMP,     0xD8, IS_6502 },
+    { OP65_CLI, M_IMP,     0x58, IS_6502 },
+    { OP65_CLV, M_IMP,     0xB8, IS_6502 },
+    { OP65_CMP, M_IMM,     0xC9, IS_6502 },
+    { OP65_CMP, M_ZP,      0xC5, IS_6502 },
+    { OP65_CMP, M_ZPX,     0xD5, IS_6502 },
+    { OP65_CMP, M_ABS,     0xCD, IS_6502 },
+    { OP65_CMP, M_ABSX,    0xDD, IS_6502 },
+    { OP65_CMP, M_ABSY,    0xD9, IS_6502 },
+    { OP65_CMP, M_ZPXIND,  0xC1, IS_6502 },
+    { OP65_CMP, M_ZPINDY,  0xD1, IS_6502 },
+    { OP65_CMP, M_ZPIND,   0xD2, IS_CMOS },
+    { OP65_CPX, M_IMM,     0xE0, IS_6502 },
+    { OP65_CPX, M_ZP,      0xE4, IS_6502 },
+    { OP65_CPX, M_ABS,     0xEC, IS_6502 },
+    { OP65_CPY, M_IMM,     0xC0, IS_6502 },
+    { OP65_CPY, M_ZP,      0xC4, IS_6502 },
+    { OP65_CPY, M_ABS,     0xCC, IS_6502 },
+    { OP65_DEA, M_IMP,     0x3A, IS_CMOS },
+    { OP65_DEC, M_ACC,     0x3A, IS_CMOS },
+    { OP65_DEC, M_ZP,      0xC6, IS_6502 },
+    { OP65_DEC, M_ZPX,     0xD6, IS_6502 },
+    { OP65_DEC, M_ABS,     0xCE, IS_6502 },
+    { OP65_DEC, M_ABSX,    0xDE, IS_6502 },
+    { OP65_DEX, M_IMP,     0xCA, IS_6502 },
+    { OP65_DEY, M_IMP,     0x88, IS_6502 },
+    { OP65_EOR, M_IMM,     0x49, IS_6502 },
+    { OP65_EOR, M_ZP,      0x45, IS_6502 },
+    { OP65_EOR, M_ZPX,     0x55, IS_6502 },
+    { OP65_EOR, M_ABS,     0x4D, IS_6502 },
+    { OP65_EOR, M_ABSX,    0x5D, IS_6502 },
+    { OP65_EOR, M_ABSY,    0x59, IS_6502 },
+    { OP65_EOR, M_ZPXIND,  0x41, IS_6502 },
+    { OP65_EOR, M_ZPINDY,  0x51, IS_6502 },
+    { OP65_EOR, M_ZPIND,   0x52, IS_CMOS },
+    { OP65_INA, M_IMP,     0x1A, IS_CMOS },
+    { OP65_INC, M_ACC,     0x1A, IS_CMOS },
+    { OP65_INC, M_ZP,      0xE6, IS_6502 },
+    { OP65_INC, M_ZPX,     0xF6, IS_6502 },
+    { OP65_INC, M_ABS,     0xEE, IS_6502 },
+    { OP65_INC, M_ABSX,    0xFE, IS_6502 },
+    { OP65_INX, M_IMP,     0xE8, IS_6502 },
+    { OP65_INY, M_IMP,     0xC8, IS_6502 },
+    { OP65_JMP, M_ABS,     0x4C, IS_6502 },
+    { OP65_JMP, M_ABSIND,  0x6C, IS_6502 },
+    { OP65_JMP, M_ABSXIND, 0x7C, IS_CMOS },
+    { OP65_JSR, M_ABS,     0x20, IS_6502 },
+    { OP65_LDA, M_IMM,     0xA9, IS_6502 },
+    { OP65_LDA, M_ZP,      0xA5, IS_6502 },
+    { OP65_LDA, M_ZPX,     0xB5, IS_6502 },
+    { OP65_LDA, M_ABS,     0xAD, IS_6502 },
+    { OP65_LDA, M_ABSX,    0xBD, IS_6502 },
+    { OP65_LDA, M_ABSY,    0xB9, IS_6502 },
+    { OP65_LDA, M_ZPXIND,  0xA1, IS_6502 },
+    { OP65_LDA, M_ZPINDY,  0xB1, IS_6502 },
+    { OP65_LDA, M_ZPIND,   0xB2, IS_CMOS },
+    { OP65_LDX, M_IMM,     0xA2, IS_6502 },
+    { OP65_LDX, M_ZP,      0xA6, IS_6502 },
+    { OP65_LDX, M_ZPY,     0xB6, IS_6502 },
+    { OP65_LDX, M_ABS,     0xAE, IS_6502 },
+    { OP65_LDX, M_ABSY,    0xBE, IS_6502 },
+    { OP65_LDY, M_IMM,     0xA0, IS_6502 },
+    { OP65_LDY, M_ZP,      0xA4, IS_6502 },
+    { OP65_LDY, M_ZPX,     0xB4, IS_6502 },
+    { OP65_LDY, M_ABS,     0xAC, IS_6502 },
+    { OP65_LDY, M_ABSX,    0xBC, IS_6502 },
+    { OP65_LSR, M_ACC,     0x4A, IS_6502 },
+    { OP65_LSR, M_ZP,      0x46, IS_6502 },
+    { OP65_LSR, M_ZPX,     0x56, IS_6502 },
+    { OP65_LSR, M_ABS,     0x4E, IS_6502 },
+    { OP65_LSR, M_ABSX,    0x5E, IS_6502 },
+    { OP65_NOP, M_IMP,     0xEA, IS_6502 },
+    { OP65_ORA, M_IMM,     0x09, IS_6502 },
+    { OP65_ORA, M_ZP,      0x05, IS_6502 },
+    { OP65_ORA, M_ZPX,     0x15, IS_6502 },
+    { OP65_ORA, M_ABS,     0x0D, IS_6502 },
+    { OP65_ORA, M_ABSX,    0x1D, IS_6502 },
+    { OP65_ORA, M_ABSY,    0x19, IS_6502 },
+    { OP65_ORA, M_ZPXIND,  0x01, IS_6502 },
+    { OP65_ORA, M_ZPINDY,  0x11, IS_6502 },
+    { OP65_ORA, M_ZPIND,   0x12, IS_CMOS },
+    { OP65_PHA, M_IMP,     0x48, IS_6502 },
+    { OP65_PHP, M_IMP,     0x08, IS_6502 },
+    { OP65_PHX, M_IMP,     0xDA, IS_CMOS },
+    { OP65_PHY, M_IMP,     0x5A, IS_CMOS },
+    { OP65_PLA, M_IMP,     0x68, IS_6502 },
+    { OP65_PLP, M_IMP,     0x28, IS_6502 },
+    { OP65_PLX, M_IMP,     0xFA, IS_CMOS },
+    { OP65_PLY, M_IMP,     0x7A, IS_CMOS },
+    { OP65_ROL, M_ACC,     0x2A, IS_6502 },
+    { OP65_ROL, M_ZP,      0x26, IS_6502 },
+    { OP65_ROL, M_ZPX,     0x36, IS_6502 },
+    { OP65_ROL, M_ABS,     0x2E, IS_6502 },
+    { OP65_ROL, M_ABSX,    0x3E, IS_6502 },
+    { OP65_ROR, M_ACC,     0x6A, IS_6502 },
+    { OP65_ROR, M_ZP,      0x66, IS_6502 },
+    { OP65_ROR, M_ZPX,     0x76, IS_6502 },
+    { OP65_ROR, M_ABS,     0x6E, IS_6502 },
+    { OP65_ROR, M_ABSX,    0x7E, IS_6502 },
+    { OP65_RTI, M_IMP,     0x40, IS_6502 },
+    { OP65_RTS, M_IMP,     0x60, IS_6502 },
+    { OP65_SBC, M_IMM,     0xE9, IS_6502 },
+    { OP65_SBC, M_ZP,      0xE5, IS_6502 },
+    { OP65_SBC, M_ZPX,     0xF5, IS_6502 },
+    { OP65_SBC, M_ABS,     0xED, IS_6502 },
+    { OP65_SBC, M_ABSX,    0xFD, IS_6502 },
+    { OP65_SBC, M_ABSY,    0xF9, IS_6502 },
+    { OP65_SBC, M_ZPXIND,  0xE1, IS_6502 },
+    { OP65_SBC, M_ZPINDY,  0xF1, IS_6502 },
+    { OP65_SBC, M_ZPIND,   0xF2, IS_CMOS },
+    { OP65_SEC, M_IMP,     0x38, IS_6502 },
+    { OP65_SED, M_IMP,     0xF8, IS_6502 },
+    { OP65_SEI, M_IMP,     0x78, IS_6502 },
+    { OP65_STA, M_ZP,      0x85, IS_6502 },
+    { OP65_STA, M_ZPX,     0x95, IS_6502 },
+    { OP65_STA, M_ABS,     0x8D, IS_6502 },
+    { OP65_STA, M_ABSX,    0x9D, IS_6502 },
+    { OP65_STA, M_ABSY,    0x99, IS_6502 },
+    { OP65_STA, M_ZPXIND,  0x81, IS_6502 },
+    { OP65_STA, M_ZPINDY,  0x91, IS_6502 },
+    { OP65_STA, M_ZPIND,   0x92, IS_CMOS },
+    { OP65_STP, M_IMP,     0xDB, IS_WDC  },
+    { OP65_STX, M_ZP,      0x86, IS_6502 },
+    { OP65_STX, M_ZPY,     0x96, IS_6502 },
+    { OP65_STX, M_ABS,     0x8E, IS_6502 },
+    { OP65_STY, M_ZP,      0x84, IS_6502 },
+    { OP65_STY, M_ZPX,     0x94, IS_6502 },
+    { OP65_STY, M_ABS,     0x8C, IS_6502 },
+    { OP65_STZ, M_ZP,      0x64, IS_CMOS },
+    { OP65_STZ, M_ZPX,     0x74, IS_CMOS },
+    { OP65_STZ, M_ABS,     0x9C, IS_CMOS },
+    { OP65_STZ, M_ABSX,    0x9E, IS_CMOS },
+    { OP65_TAX, M_IMP,     0xAA, IS_6502 },
+    { OP65_TAY, M_IMP,     0xA8, IS_6502 },
+    { OP65_TRB, M_ZP,      0x14, IS_CMOS },
+    { OP65_TRB, M_ABS,     0x1C, IS_CMOS },
+    { OP65_TSB, M_ZP,      0x04, IS_CMOS },
+    { OP65_TSB, M_ABS,     0x0C, IS_CMOS },
+    { OP65_TSX, M_IMP,     0xBA, IS_6502 },
+    { OP65_TXA, M_IMP,     0x8A, IS_6502 },
+    { OP65_TXS, M_IMP,     0x9A, IS_6502 },
+    { OP65_TYA, M_IMP,     0x98, IS_6502 },
+};
+
+/* Opcode bytes for the current CPU, -1 if the mode is not available */
+static short Codes[OP65_COUNT][M_COUNT];
+
+/* Options for the object file */
+typedef struct ObjOption ObjOption;
+struct ObjOption {
+    unsigned char       Type;           /* Option type, see optdefs.h */
+    unsigned long       Val;            /* Number or string id */
+};
+static ObjOption        Options[4];
+static unsigned         OptionCount;
+
+/* String pool for the object file */
+static StringPool*      StrPool = 0;
+
+
+
+/*****************************************************************************/
+/*                              Helper functions                             */
+/*****************************************************************************/
+
+
+
+static void InitCodes (void)
+/* Fill the opcode table for the current CPU */
+{
+    unsigned I, J;
+
+    for (I = 0; I < OP65_COUNT; ++I) {
+        for (J = 0; J < M_COUNT; ++J) {
+            Codes[I][J] = -1;
+        }
+    }
+    for (I = 0; I < sizeof (InsTab) / sizeof (InsTab[0]); ++I) {
+        const InsCode* C = InsTab + I;
+        if (CPUIsets[CPU] & C->ISet) {
+            Codes[C->OPC][C->Mode] = C->Code;
+        }
+    }
+}
+
+
+
+static void AddOption (unsigned char Type, unsigned long Val)
+/* Add an option for the object file */
+{
+    CHECK (OptionCount < sizeof (Options) / sizeof (Options[0]));
+    Options[OptionCount].Type = Type;
+    Options[OptionCount].Val  = Val;
+    ++OptionCount;
+}
+
+
+
+static const char* SkipSpace (const char* S)
+/* Skip white space */
+{
+    while (IsBlank (*S)) {
+        ++S;
+    }
+    return S;
+}
+
+
+
+static const char* ReadIdent (const char* S, StrBuf* Ident)
+/* Read an identifier into Ident. Return a pointer behind it or NULL if there
+** is no identifier.
+*/
+{
+    SB_Clear (Ident);
+    if (!IsAlpha (*S) && *S != '_') {
+        return 0;
+    }
+    do {
+        SB_AppendChar (Ident, *S++);
+    } while (IsAlNum (*S) || *S == '_');
+    SB_Terminate (Ident);
+    return S;
+}
+
+
+
+static const char* ReadString (const char* S, StrBuf* Str)
+/* Read a string constant into Str. Return a pointer behind it or NULL if
+** there is no string.
+*/
+{
+    SB_Clear (Str);
+    if (*S != '\"') {
+        return 0;
+    }
+    while (*++S != '\"') {
+        if (*S == '\0') {
+            return 0;
+        }
+        SB_AppendChar (Str, *S);
+    }
+    SB_Terminate (Str);
+    return S + 1;
+}
+
+
+
+static const char* ReadNumber (const char* S, long* Val)
+/* Read a decimal number. Return a pointer behind it or NULL. */
+{
+    char* End;
+    *Val = strtol (S, &End, 10);
+    return (End == S)? 0 : End;
+}
+
+
+
+static const char* SkipComma (const char* S)
+/* Skip a comma with surrounding white space. Return NULL if there is none. */
+{
+    S = SkipSpace (S);
+    return (*S == ',')? SkipSpace (S + 1) : 0;
+}
+
+
+
+static void BadLine (const char* Line)
+/* The compiler generated a line we don't know about */
+{
+    Internal ("Integrated assembler: Unexpected line '%s'", Line);
+}
+
+
+
+static ExprNode* ParseOperand (const char* Arg)
+/* Parse an expression that makes up a complete operand */
+{
+    const char* S = Arg;
+    ExprNode* Expr = ParseObjExpr (&S);
+    if (Expr && *S != '\0') {
+        ObjError ("Syntax error in operand: '%s'", S);
+        FreeObjExpr (Expr);
+        Expr = 0;
+    }
+    return Expr? Expr : NewObjLiteral (0);
+}
+
+
+
+/*****************************************************************************/
+/*                               Instructions                                */
+/*****************************************************************************/
+
+
+
+static void EmitImplicit (opc_t OPC, unsigned Mode)
+/* Emit an instruction without an operand */
+{
+    if (Codes[OPC][Mode] < 0) {
+        ObjError ("Illegal addressing mode");
+    } else {
+        ObjEmitByte ((unsigned char) Codes[OPC][Mode]);
+    }
+}
+
+
+
+static void EmitOperand (opc_t OPC, unsigned Modes, const char* Arg)
+/* Emit an instruction with an operand. Modes is the set of addressing modes
+** that are possible for the syntax used. Like the assembler, use the address
+** size of the operand to select from the modes available, preferring zero
+** page addressing.
+*/
+{
+    unsigned Mode;
+    ExprNode* Expr = ParseOperand (Arg);
+
+    /* Remove the modes not available for the instruction */
+    for (Mode = 0; Mode < M_COUNT; ++Mode) {
+        if (Codes[OPC][Mode] < 0) {
+            Modes &= ~MS (Mode);
+        }
+    }
+
+    /* Remove the modes too small for the operand */
+    if (Modes) {
+        ObjExprDesc ED;
+        OED_Init (&ED);
+        StudyObjExpr (Expr, &ED);
+        if (ED.AddrSize == ADDR_SIZE_DEFAULT) {
+            ED.AddrSize = ((Modes & ~MS_ZP) == 0)? ADDR_SIZE_ZP : ADDR_SIZE_ABS;
+        }
+        if (ED.AddrSize == ADDR_SIZE_ABS) {
+            Modes &= ~MS_ZP;
+        } else if (ED.AddrSize > ADDR_SIZE_ABS) {
+            Modes &= ~(MS_ZP | MS_ABS);
+        }
+        OED_Done (&ED);
+    }
+
+    if (Modes == 0) {
+        ObjError ("Illegal addressing mode");
+        FreeObjExpr (Expr);
+        return;
+    }
+    Mode = 0;
+    while ((Modes & MS (Mode)) == 0) {
+        ++Mode;
+    }
+
+    /* The NMOS CPUs don't handle an indirect jump through a vector that
+    ** crosses a page. Let the linker check the address.
+    */
+    if (Mode == M_ABSIND && (CPUIsets[CPU] & CPU_ISET_65SC02) == 0) {
+        ExprNode* Lo = CloneObjExpr (Expr);
+        if (Lo->Op == EXPR_LITERAL) {
+            Lo->V.IVal &= 0xFF;
+        } else {
+            Lo = NewObjUnaryExpr (EXPR_BYTE0, Lo);
+        }
+        ObjAddAssertion (NewObjBinaryExpr (EXPR_NE, Lo, NewObjLiteral (0xFF)),
+                         ASSERT_ACT_WARN,
+                         "\"jmp (abs)\" across page border");
+    }
+
+    ObjEmitByte ((unsigned char) Codes[OPC][Mode]);
+    ObjEmitExpr (Expr, OperandSize[Mode], 0);
+}
+
+
+
+static void EmitBranch (opc_t OPC, const char* Target)
+/* Emit a relative branch */
+{
+    /* The offset is relative to the end of the instruction */
+    unsigned long PC = GetObjPC ();
+    ExprNode* Expr = NewObjBinaryExpr (EXPR_MINUS,
+                                      ParseOperand (Target),
+                                      NewObjLiteral ((long) (PC + 2)));
+    Expr = NewObjBinaryExpr (EXPR_MINUS, Expr,
+                             NewObjSectionExpr (GetObjSegNum ()));
+
+    if (Codes[OPC][M_REL] < 0) {
+        ObjError ("Illegal addressing mode");
+        FreeObjExpr (Expr);
+        return;
+    }
+    ObjEmitByte ((unsigned char) Codes[OPC][M_REL]);
+    ObjEmitExpr (Expr, 1, 1);
+}
+
+
+
+static int IsNearTarget (const char* Target)
+/* Return true if Target is a label defined before that is reachable with a
+** short branch from the current position. This is what the jxx macros from
+** the longbranch package check.
+*/
+{
+    long Dist;
+    ExprNode* Expr;
+    ObjSym* Sym;
+    const char* S = Target;
+
+    /* Must be a plain symbol that is already defined */
+    while (IsAlNum (*S) || *S == '_') {
+        ++S;
+    }
+    if (S == Target || *S != '\0') {
+        return 0;
+    }
+    Sym = FindAnyObjSym (GetCurObjScope (), Target);
+    if (Sym == 0 || (Sym->Flags & OSF_DEFINED) == 0) {
+        return 0;
+    }
+
+    /* The distance must be known now */
+    Expr = NewObjBinaryExpr (EXPR_MINUS, GenObjPCExpr (), NewObjSymExpr (Sym));
+    if (!IsConstObjExpr (Expr, &Dist)) {
+        Dist = 0x7FFF;
+    }
+    FreeObjExpr (Expr);
+
+    return Dist + 2 <= 127;
+}
+
+
+
+static void EmitLongBranch (opc_t OPC, const char* Target)
+/* Emit one of the jxx pseudo instructions */
+{
+    if (strcmp (Target, "0") != 0 && IsNearTarget (Target)) {
+        EmitBranch (MakeShortBranch (OPC), Target);
+    } else {
+        /* Branch around an absolute jump */
+        opc_t Inv = MakeShortBranch (GetInverseBranch (OPC));
+        EmitImplicit (Inv, M_REL);
+        ObjEmitByte (3);
+        EmitOperand (OP65_JMP, MS (M_ABS), Target);
+    }
+}
+
+
+
+static void TranslateCode (const CodeEntry* E)
+/* Translate one code entry */
+{
+    unsigned I;
+
+    for (I = 0; I < CollCount (&E->Labels); ++I) {
+        const CodeLabel* L = CollConstAt (&E->Labels, I);
+        DefObjLabel (L->Name);
+    }
+
+    switch (E->AM) {
+
+        case AM65_IMP:
+            EmitImplicit (E->OPC, M_IMP);
+            break;
+
+        case AM65_ACC:
+            EmitImplicit (E->OPC, M_ACC);
+            break;
+
+        case AM65_IMM:
+            EmitOperand (E->OPC, MS (M_IMM), E->Arg);
+            break;
+
+        case AM65_ZP:
+        case AM65_ABS:
+            EmitOperand (E->OPC, MS (M_ZP) | MS (M_ABS), E->Arg);
+            break;
+
+        case AM65_ZPX:
+        case AM65_ABSX:
+            EmitOperand (E->OPC, MS (M_ZPX) | MS (M_ABSX), E->Arg);
+            break;
+
+        case AM65_ZPY:
+        case AM65_ABSY:
+            EmitOperand (E->OPC, MS (M_ZPY) | MS (M_ABSY), E->Arg);
+            break;
+
+        case AM65_ZPX_IND:
+            EmitOperand (E->OPC, MS (M_ZPXIND) | MS (M_ABSXIND), E->Arg);
+            break;
+
+        case AM65_ZP_INDY:
+            EmitOperand (E->OPC, MS (M_ZPINDY), E->Arg);
+            break;
+
+        case AM65_ZP_IND:
+            EmitOperand (E->OPC, MS (M_ZPIND) | MS (M_ABSIND), E->Arg);
+            break;
+
+        case AM65_BRA: {
+            const char* Target = E->JumpTo? E->JumpTo->Name : E->Arg;
+            if (E->OPC == OP65_JMP) {
+                EmitOperand (OP65_JMP, MS (M_ABS), Target);
+            } else if (GetOPCInfo (E->OPC) & OF_LBRA) {
+                EmitLongBranch (E->OPC, Target);
+            } else {
+                EmitBranch (E->OPC, Target);
+            }
+            break;
+        }
+
+        default:
+            Internal ("Invalid addressing mode");
+
+    }
+}
+
+
+
+/*****************************************************************************/
+/*                                Directives                                 */
+/*****************************************************************************/
+
+
+
+static const char* DoSymList (const char* S, int Export, unsigned char AddrSize,
+                              unsigned Flags)
+/* Handle the symbol list of the .import and .export style directives */
+{
+    StrBuf Name = AUTO_STRBUF_INITIALIZER;
+
+    while ((S = ReadIdent (S, &Name)) != 0) {
+        if (Export) {
+            ExportObjSym (SB_GetConstBuf (&Name), AddrSize);
+        } else {
+            ImportObjSym (SB_GetConstBuf (&Name), AddrSize, Flags);
+        }
+        S = SkipSpace (S);
+        if (*S != ',') {
+            break;
+        }
+        S = SkipSpace (S + 1);
+    }
+
+    SB_Done (&Name);
+    return S;
+}
+
+
+
+static int ConvertType (StrBuf* Type)
+/* Convert the hex encoded type of a .dbg statement into binary. Return false
+** if the type is invalid.
+*/
+{
+    StrBuf Bin = AUTO_STRBUF_INITIALIZER;
+    const char* S = SB_GetConstBuf (Type);
+    int Ok = (SB_GetLen (Type) % 2) == 0;
+
+    while (Ok && *S) {
+        char Hex[3];
+        Hex[0] = S[0];
+        Hex[1] = S[1];
+        Hex[2] = '\0';
+        Ok = IsXDigit (S[0]) && IsXDigit (S[1]);
+        SB_AppendChar (&Bin, (char) strtoul (Hex, 0, 16));
+        S += 2;
+    }
+    SB_Copy (Type, &Bin);
+    SB_Done (&Bin);
+    return Ok;
+}
+
+
+
+static const char* DoDbg (const char* S)
+/* Handle the .dbg directive */
+{
+    StrBuf Kind    = AUTO_STRBUF_INITIALIZER;
+    StrBuf Name    = AUTO_STRBUF_INITIALIZER;
+    StrBuf Type    = AUTO_STRBUF_INITIALIZER;
+    StrBuf SC      = AUTO_STRBUF_INITIALIZER;
+    StrBuf AsmName = AUTO_STRBUF_INITIALIZER;
+    long   Offs    = 0;
+
+    S = ReadIdent (S, &Kind);
+    if (S == 0) {
+        goto ExitPoint;
+    }
+
+    /* The input files are taken from the compiler's file table */
+    if (SB_CompareStr (&Kind, "file") == 0) {
+        S = "";
+        goto ExitPoint;
+    }
+
+    /* func and sym have name, type and storage class in common */
+    if ((S = SkipComma (S)) == 0                        ||
+        (S = ReadString (S, &Name)) == 0                ||
+        (S = SkipComma (S)) == 0                        ||
+        (S = ReadString (S, &Type)) == 0                ||
+        (S = SkipComma (S)) == 0                        ||
+        (S = ReadIdent (S, &SC)) == 0                   ||
+        !ConvertType (&Type)) {
+        S = 0;
+        goto ExitPoint;
+    }
+
+    if (SB_CompareStr (&Kind, "func") == 0) {
+
+        unsigned Flags;
+        if (SB_CompareStr (&SC, "extern") == 0) {
+            Flags = HLL_SC_EXTERN;
+        } else if (SB_CompareStr (&SC, "static") == 0) {
+            Flags = HLL_SC_STATIC;
+        } else {
+            S = 0;
+            goto ExitPoint;
+        }
+        if ((S = SkipComma (S)) == 0 || (S = ReadString (S, &AsmName)) == 0) {
+            goto ExitPoint;
+        }
+        AddObjFuncInfo (SB_GetConstBuf (&Name), &Type, Flags,
+                        SB_GetConstBuf (&AsmName));
+
+    } else if (SB_CompareStr (&Kind, "sym") == 0) {
+
+        if (SB_CompareStr (&SC, "auto") == 0) {
+            if ((S = SkipComma (S)) == 0 || (S = ReadNumber (S, &Offs)) == 0) {
+                goto ExitPoint;
+            }
+            AddObjSymInfo (SB_GetConstBuf (&Name), &Type, HLL_SC_AUTO, 0, Offs);
+        } else if (SB_CompareStr (&SC, "register") == 0) {
+            if ((S = SkipComma (S)) == 0                ||
+                (S = ReadString (S, &AsmName)) == 0     ||
+                (S = SkipComma (S)) == 0                ||
+                (S = ReadNumber (S, &Offs)) == 0) {
+                goto ExitPoint;
+            }
+            AddObjSymInfo (SB_GetConstBuf (&Name), &Type, HLL_SC_REG,
+                           SB_GetConstBuf (&AsmName), Offs);
+        } else {
+            unsigned Flags;
+            if (SB_CompareStr (&SC, "extern") == 0) {
+                Flags = HLL_SC_EXTERN;
+            } else if (SB_CompareStr (&SC, "static") == 0) {
+                Flags = HLL_SC_STATIC;
+            } else {
+                S = 0;
+                goto ExitPoint;
+            }
+            if ((S = SkipComma (S)) == 0 || (S = ReadString (S, &AsmName)) == 0) {
+                goto ExitPoint;
+            }
+            AddObjSymInfo (SB_GetConstBuf (&Name), &Type, Flags,
+                           SB_GetConstBuf (&AsmName), 0);
+        }
+
+    } else {
+        S = 0;
+    }
+
+ExitPoint:
+    SB_Done (&Kind);
+    SB_Done (&Name);
+    SB_Done (&Type);
+    SB_Done (&SC);
+    SB_Done (&AsmName);
+    return S;
+}
+
+
+
+static void TranslateTextLine (const char* Line)
+/* Translate one line of a text segment */
+{
+    StrBuf Dir = AUTO_STRBUF_INITIALIZER;
+    const char* S = SkipSpace (Line);
+
+    /* Ignore empty lines and comments */
+    if (*S == '\0' || *S == ';') {
+        return;
+    }
+
+    /* Everything else is a directive */
+    if (*S != '.' || (S = ReadIdent (S + 1, &Dir)) == 0) {
+        BadLine (Line);
+    }
+    S = SkipSpace (S);
+
+    if (SB_CompareStr (&Dir, "import") == 0) {
+        S = DoSymList (S, 0, ADDR_SIZE_DEFAULT, OSF_NONE);
+    } else if (SB_CompareStr (&Dir, "importzp") == 0) {
+        S = DoSymList (S, 0, ADDR_SIZE_ZP, OSF_NONE);
+    } else if (SB_CompareStr (&Dir, "forceimport") == 0) {
+        S = DoSymList (S, 0, ADDR_SIZE_DEFAULT, OSF_FORCED);
+    } else if (SB_CompareStr (&Dir, "export") == 0) {
+        S = DoSymList (S, 1, ADDR_SIZE_DEFAULT, OSF_NONE);
+    } else if (SB_CompareStr (&Dir, "exportzp") == 0) {
+        S = DoSymList (S, 1, ADDR_SIZE_ZP, OSF_NONE);
+    } else if (SB_CompareStr (&Dir, "dbg") == 0) {
+        S = DoDbg (S);
+    } else if (SB_CompareStr (&Dir, "fopt") == 0) {
+        StrBuf Opt = AUTO_STRBUF_INITIALIZER;
+        if ((S = ReadIdent (S, &Opt)) == 0                  ||
+            SB_CompareStr (&Opt, "compiler") != 0           ||
+            (S = SkipComma (S)) == 0                        ||
+            (S = ReadString (S, &Opt)) == 0) {
+            BadLine (Line);
+        }
+        AddOption (OPT_COMPILER, ObjGetStrBufId (&Opt));
+        SB_Done (&Opt);
+    } else if (SB_CompareStr (&Dir, "setcpu") == 0          ||
+               SB_CompareStr (&Dir, "smart") == 0           ||
+               SB_CompareStr (&Dir, "autoimport") == 0      ||
+               SB_CompareStr (&Dir, "case") == 0            ||
+               SB_CompareStr (&Dir, "debuginfo") == 0       ||
+               SB_CompareStr (&Dir, "macpack") == 0) {
+        /* These describe the mode the integrated assembler works in anyway */
+        S = "";
+    } else {
+        S = 0;
+    }
+
+    if (S == 0 || *SkipSpace (S) != '\0') {
+        BadLine (Line);
+    }
+    SB_Done (&Dir);
+}
+
+
+
+static void DoData (const char* S, unsigned Size)
+/* Handle .byte, .word, .dword and .addr */
+{
+    while (1) {
+        ExprNode* Expr = ParseObjExpr (&S);
+        if (Expr == 0) {
+            return;
+        }
+        ObjEmitExpr (Expr, Size, 0);
+        if (*S != ',') {
+            break;
+        }
+        ++S;
+    }
+    if (*S != '\0') {
+        ObjError ("Syntax error in operand: '%s'", S);
+    }
+}
+
+
+
+static void TranslateDataLine (const char* Line)
+/* Translate one line of a data segment */
+{
+    StrBuf Ident = AUTO_STRBUF_INITIALIZER;
+    const char* S = SkipSpace (Line);
+
+    if (*S == '\0' || *S == ';') {
+
+        /* Empty line or comment */
+
+    } else if (*S == '.') {
+
+        if ((S = ReadIdent (S + 1, &Ident)) == 0) {
+            BadLine (Line);
+        }
+        S = SkipSpace (S);
+
+        if (SB_CompareStr (&Ident, "segment") == 0) {
+            unsigned char AddrSize = ADDR_SIZE_DEFAULT;
+            StrBuf Name = AUTO_STRBUF_INITIALIZER;
+            if ((S = ReadString (S, &Name)) == 0) {
+                BadLine (Line);
+            }
+            S = SkipSpace (S);
+            if (*S == ':') {
+                if ((S = ReadIdent (SkipSpace (S + 1), &Ident)) == 0 ||
+                    (AddrSize = AddrSizeFromStr (SB_GetConstBuf (&Ident))) == ADDR_SIZE_INVALID) {
+                    BadLine (Line);
+                }
+            }
+            UseObjSeg (SB_GetConstBuf (&Name), AddrSize);
+            SB_Done (&Name);
+        } else if (SB_CompareStr (&Ident, "byte") == 0) {
+            DoData (S, 1);
+        } else if (SB_CompareStr (&Ident, "word") == 0 ||
+                   SB_CompareStr (&Ident, "addr") == 0) {
+            DoData (S, 2);
+        } else if (SB_CompareStr (&Ident, "dword") == 0) {
+            DoData (S, 4);
+        } else if (SB_CompareStr (&Ident, "res") == 0) {
+            long Count;
+            if ((S = ReadNumber (S, &Count)) == 0 || Count < 0 ||
+                (S = SkipComma (S)) == 0 || strcmp (S, "$00") != 0) {
+                BadLine (Line);
+            }
+            ObjEmitFill ((unsigned long) Count);
+        } else {
+            BadLine (Line);
+        }
+
+    } else if ((S = ReadIdent (S, &Ident)) != 0 && *(S = SkipSpace (S)) == ':') {
+
+        if (S[1] == '=') {
+            /* Name := Expression */
+            ExprNode* Expr = ParseOperand (SkipSpace (S + 2));
+            DefObjSym (SB_GetConstBuf (&Ident), Expr, ADDR_SIZE_DEFAULT, OSF_LABEL);
+        } else if (*SkipSpace (S + 1) == '\0') {
+            /* Label */
+            DefObjLabel (SB_GetConstBuf (&Ident));
+        } else {
+            BadLine (Line);
+        }
+
+    } else {
+        BadLine (Line);
+    }
+
+    SB_Done (&Ident);
+}
+
+
+
+/*****************************************************************************/
+/*                                 Segments                                  */
+/*****************************************************************************/
+
+
+
+static void TranslateTextSeg (const TextSeg* S)
+/* Translate the lines of a text segment */
+{
+    unsigned I;
+    for (I = 0; I < CollCount (&S->Lines); ++I) {
+        TranslateTextLine (CollConstAt (&S->Lines, I));
+    }
+}
+
+
+
+static void TranslateDataSeg (const DataSeg* S)
+/* Translate the lines of a data segment */
+{
+    unsigned I;
+
+    if (CollCount (&S->Lines) == 0) {
+        return;
+    }
+    UseObjSeg (S->SegName, ADDR_SIZE_DEFAULT);
+    for (I = 0; I < CollCount (&S->Lines); ++I) {
+        TranslateDataLine (CollConstAt (&S->Lines, I));
+    }
+}
+
+
+
+static void TranslateCodeSeg (const CodeSeg* S)
+/* Translate the entries of a code segment */
+{
+    unsigned I;
+    const LineInfo* LI = 0;
+    unsigned Count = CS_GetEntryCount (S);
+
+    if (Count == 0) {
+        return;
+    }
+    UseObjSeg (S->SegName, ADDR_SIZE_DEFAULT);
+
+    for (I = 0; I < Count; ++I) {
+        const CodeEntry* E = CollConstAt (&S->Entries, I);
+        if (E->LI != LI) {
+            LI = E->LI;
+            ObjStartAsmLine (LI);
+            if (DebugInfo) {
+                ObjStartExtLine (LI);
+            }
+        }
+        TranslateCode (E);
+    }
+
+    /* Data following the code has no source position */
+    ObjStartAsmLine (0);
+    if (DebugInfo) {
+        ObjStartExtLine (0);
+    }
+}
+
+
+
+static void TranslateSegments (const Segments* S)
+/* Translate one set of segments in the order the assembler output would
+** have them.
+*/
+{
+    const SymEntry* Func = S->Code->Func;
+
+    if (Func) {
+        unsigned char AddrSize = ADDR_SIZE_DEFAULT;
+        StrBuf Name = AUTO_STRBUF_INITIALIZER;
+        if (IsQualNear (Func->Type)) {
+            AddrSize = ADDR_SIZE_ABS;
+        } else if (IsQualFar (Func->Type)) {
+            AddrSize = ADDR_SIZE_FAR;
+        }
+        SB_Printf (&Name, "_%s", Func->Name);
+        UseObjSeg (S->Code->SegName, ADDR_SIZE_DEFAULT);
+        EnterObjProc (SB_GetConstBuf (&Name), AddrSize);
+        SB_Done (&Name);
+    }
+
+    TranslateTextSeg (S->Text);
+    TranslateCodeSeg (S->Code);
+    TranslateDataSeg (S->Data);
+    TranslateDataSeg (S->ROData);
+    TranslateDataSeg (S->BSS);
+
+    if (Func) {
+        LeaveObjProc ();
+    }
+}
+
+
+
+/*****************************************************************************/
+/*                                Object file                                */
+/*****************************************************************************/
+
+
+
+static void WriteOptions (void)
+/* Write the options to the object file */
+{
+    unsigned I;
+
+    ObjStartOptions ();
+    ObjWriteVar (OptionCount);
+    for (I = 0; I < OptionCount; ++I) {
+        ObjWrite8 (Options[I].Type);
+        ObjWriteVar (Options[I].Val);
+    }
+    ObjEndOptions ();
+}
+
+
+
+static void WriteFiles (void)
+/* Write the input files of the compiler to the object file */
+{
+    unsigned I;
+    unsigned Count = GetInputFileCount ();
+
+    ObjStartFiles ();
+    ObjWriteVar (Count);
+    for (I = 0; I < Count; ++I) {
+        const char*   Name;
+        unsigned long Size;
+        unsigned long MTime;
+        GetInputFileInfo (I, &Name, &Size, &MTime);
+        ObjWriteVar (ObjGetStringId (Name));
+        ObjWrite32 (MTime);
+        ObjWriteVar (Size);
+    }
+    ObjEndFiles ();
+}
+
+
+
+static StringPool* GetStrPool (void)
+/* Return the string pool, creating it if necessary */
+{
+    if (StrPool == 0) {
+        /* The empty string has always id 0 */
+        StrPool = NewStringPool (1103);
+        SP_AddStr (StrPool, "");
+    }
+    return StrPool;
+}
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+unsigned ObjGetStringId (const char* S)
+/* Return the id of the given string in the object file string pool */
+{
+    return SP_AddStr (GetStrPool (), S);
+}
+
+
+
+unsigned ObjGetStrBufId (const StrBuf* S)
+/* Return the id of the given string in the object file string pool */
+{
+    return SP_Add (GetStrPool (), S);
+}
+
+
+
+void WriteObjOutput (void)
+/* Translate the generated code and data directly into an object file. This
+** replaces WriteAsmOutput if the integrated assembler is used.
+*/
+{
+    SymEntry* Entry;
+    StrBuf Translator = AUTO_STRBUF_INITIALIZER;
+
+    /* Setup */
+    InitCodes ();
+    InitObjSegs ();
+    InitObjSyms ();
+    OptionCount = 0;
+    SB_Printf (&Translator, "cc65 V%s", GetVersionAsString ());
+    AddOption (OPT_TRANSLATOR, ObjGetStrBufId (&Translator));
+    AddOption (OPT_DATETIME, (unsigned long) time (0));
+    SB_Done (&Translator);
+
+    /* Translate the global segments, then all functions */
+    CHECK (!HaveGlobalCode ());
+    TranslateSegments (CS);
+    for (Entry = GetGlobalSymTab ()->SymHead; Entry; Entry = Entry->NextSym) {
+        if (SymIsOutputFunc (Entry)) {
+            TranslateSegments (Entry->V.F.Seg);
+        }
+    }
+
+    /* Resolve the symbols and the segment data */
+    CheckObjSyms ();
+    ObjSegDone ();
+
+    /* Write the object file if there were no errors */
+    if (ErrorCount == 0) {
+        ObjOpen (OutputFilename, DebugInfo? OBJ_FLAGS_DBGINFO : 0);
+        WriteOptions ();
+        WriteFiles ();
+        WriteObjSegments ();
+        WriteObjImports ();
+        WriteObjExports ();
+        WriteObjDbgSyms ();
+        WriteObjScopes ();
+        WriteObjLineInfos ();
+        ObjWriteStrPool (GetStrPool ());
+        WriteObjAssertions ();
+        WriteObjSpans ();
+        ObjClose ();
+        Print (stdout, 1, "Wrote output to '%s'\n", OutputFilename);
+    }
+
+    DoneObjSyms ();
+    DoneObjSegs ();
+    FreeStringPool (StrPool);
+    StrPool = 0;
+}
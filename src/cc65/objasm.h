@@ -0,0 +1,64 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                  objasm.h                                 */
+/*                                                                           */
+/*                Integrated assembler for the compiler output               */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#ifndef OBJASM_H
+#define OBJASM_H
+
+
+
+/* common */
+#include "strbuf.h"
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+unsigned ObjGetStringId (const char* S);
+/* Return the id of the given string in the object file string pool */
+
+unsigned ObjGetStrBufId (const StrBuf* S);
+/* Return the id of the given string in the object file string pool */
+
+void WriteObjOutput (void);
+/* Translate the generated code and data directly into an object file. This
+** replaces WriteAsmOutput if the integrated assembler is used.
+*/
+
+
+
+/* End of objasm.h */
+
+#endif
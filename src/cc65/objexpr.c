@@ -0,0 +1,641 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                 objexpr.c                                 */
+/*                                                                           */
+/*                  Expressions for the integrated assembler                 */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#include <string.h>
+
+/* common */
+#include "addrsize.h"
+#include "chartype.h"
+#include "check.h"
+#include "objexprdesc.h"
+#include "objwrite.h"
+#include "shift.h"
+#include "strbuf.h"
+#include "tgttrans.h"
+#include "xmalloc.h"
+
+/* cc65 */
+#include "error.h"
+#include "objexpr.h"
+#include "objseg.h"
+#include "objsym.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Current position when parsing an expression */
+static const char* Cur;
+
+
+
+/*****************************************************************************/
+/*                              Expression nodes                             */
+/*****************************************************************************/
+
+
+
+static ExprNode* NewObjExpr (unsigned char Op)
+/* Create a new expression node */
+{
+    ExprNode* E = xmalloc (sizeof (ExprNode));
+    E->Op    = Op;
+    E->Left  = 0;
+    E->Right = 0;
+    E->Obj   = 0;
+    E->V.IVal = 0;
+    return E;
+}
+
+
+
+ExprNode* NewObjLiteral (long Val)
+/* Return a literal expression node */
+{
+    ExprNode* E = NewObjExpr (EXPR_LITERAL);
+    E->V.IVal = Val;
+    return E;
+}
+
+
+
+ExprNode* NewObjSymExpr (struct ObjSym* Sym)
+/* Return an expression node for the given symbol */
+{
+    ExprNode* E = NewObjExpr (EXPR_SYMBOL);
+    E->V.ObjSym = Sym;
+    return E;
+}
+
+
+
+ExprNode* NewObjSectionExpr (unsigned SecNum)
+/* Return an expression node for the given section */
+{
+    ExprNode* E = NewObjExpr (EXPR_SECTION);
+    E->V.SecNum = SecNum;
+    return E;
+}
+
+
+
+ExprNode* NewObjUnaryExpr (unsigned char Op, ExprNode* Left)
+/* Return an unary expression node */
+{
+    ExprNode* E = NewObjExpr (Op);
+    E->Left = Left;
+    return E;
+}
+
+
+
+ExprNode* NewObjBinaryExpr (unsigned char Op, ExprNode* Left, ExprNode* Right)
+/* Return a binary expression node */
+{
+    ExprNode* E = NewObjExpr (Op);
+    E->Left  = Left;
+    E->Right = Right;
+    return E;
+}
+
+
+
+ExprNode* CloneObjExpr (const ExprNode* Expr)
+/* Return a deep copy of the given expression tree */
+{
+    ExprNode* E;
+
+    if (Expr == 0) {
+        return 0;
+    }
+    E = NewObjExpr (Expr->Op);
+    E->V     = Expr->V;
+    E->Left  = CloneObjExpr (Expr->Left);
+    E->Right = CloneObjExpr (Expr->Right);
+    return E;
+}
+
+
+
+void FreeObjExpr (ExprNode* Expr)
+/* Free an expression tree */
+{
+    if (Expr) {
+        FreeObjExpr (Expr->Left);
+        FreeObjExpr (Expr->Right);
+        xfree (Expr);
+    }
+}
+
+
+
+/*****************************************************************************/
+/*                                  Parser                                   */
+/*****************************************************************************/
+
+
+
+static ExprNode* SimpleExpr (void);
+/* Parse an additive expression */
+
+
+
+static void SkipBlanks (void)
+/* Skip white space at the current position */
+{
+    while (IsSpace (*Cur)) {
+        ++Cur;
+    }
+}
+
+
+
+static int IsIdentStart (char C)
+/* Return true if C may start an identifier */
+{
+    return IsAlpha (C) || C == '_';
+}
+
+
+
+static int IsIdentChar (char C)
+/* Return true if C may be part of an identifier */
+{
+    return IsAlNum (C) || C == '_';
+}
+
+
+
+static ExprNode* UnaryOp (unsigned char Op, ExprNode* Operand)
+/* Apply a unary operator. A literal operand is folded. */
+{
+    if (Operand == 0) {
+        return 0;
+    }
+    if (Operand->Op == EXPR_LITERAL) {
+        long Val = Operand->V.IVal;
+        switch (Op) {
+            case EXPR_UNARY_MINUS:  Val = -Val;                 break;
+            case EXPR_NOT:          Val = ~Val;                 break;
+            case EXPR_BYTE0:        Val = Val & 0xFF;           break;
+            case EXPR_BYTE1:        Val = (Val >> 8) & 0xFF;    break;
+            case EXPR_BYTE2:        Val = (Val >> 16) & 0xFF;   break;
+            case EXPR_WORD0:        Val = Val & 0xFFFF;         break;
+            default:                Internal ("Invalid unary operator: %02X", Op);
+        }
+        Operand->V.IVal = Val;
+        return Operand;
+    }
+    return NewObjUnaryExpr (Op, Operand);
+}
+
+
+
+static ExprNode* BinaryOp (unsigned char Op, ExprNode* Left, ExprNode* Right)
+/* Apply a binary operator. If both sides are literals, the result is folded. */
+{
+    if (Left == 0 || Right == 0) {
+        FreeObjExpr (Left);
+        FreeObjExpr (Right);
+        return 0;
+    }
+    if (Left->Op == EXPR_LITERAL && Right->Op == EXPR_LITERAL) {
+        long LVal = Left->V.IVal;
+        long RVal = Right->V.IVal;
+        switch (Op) {
+            case EXPR_PLUS:     LVal += RVal;                   break;
+            case EXPR_MINUS:    LVal -= RVal;                   break;
+            case EXPR_OR:       LVal |= RVal;                   break;
+            case EXPR_MUL:      LVal *= RVal;                   break;
+            case EXPR_AND:      LVal &= RVal;                   break;
+            case EXPR_XOR:      LVal ^= RVal;                   break;
+            case EXPR_SHL:      LVal = shl_l (LVal, RVal);      break;
+            case EXPR_SHR:      LVal = shr_l (LVal, RVal);      break;
+            case EXPR_DIV:
+                if (RVal == 0) {
+                    ObjError ("Division by zero");
+                    LVal = 1;
+                } else {
+                    LVal /= RVal;
+                }
+                break;
+            default:
+                Internal ("Invalid binary operator: %02X", Op);
+        }
+        Left->V.IVal = LVal;
+        FreeObjExpr (Right);
+        return Left;
+    }
+    return NewObjBinaryExpr (Op, Left, Right);
+}
+
+
+
+static ExprNode* Number (unsigned Base)
+/* Parse a number in the given base */
+{
+    unsigned long Val = 0;
+    unsigned Digits = 0;
+
+    while (1) {
+        unsigned D;
+        if (IsDigit (*Cur)) {
+            D = *Cur - '0';
+        } else if (IsXDigit (*Cur)) {
+            D = (*Cur & 0x0F) + 9;
+        } else {
+            break;
+        }
+        if (D >= Base) {
+            break;
+        }
+        Val = Val * Base + D;
+        ++Digits;
+        ++Cur;
+    }
+    if (Digits == 0) {
+        ObjError ("Invalid number");
+        return 0;
+    }
+    return NewObjLiteral ((long) Val);
+}
+
+
+
+static ExprNode* Factor (void)
+/* Parse a factor */
+{
+    ExprNode* E;
+
+    SkipBlanks ();
+    switch (*Cur) {
+
+        case '$':
+            ++Cur;
+            return Number (16);
+
+        case '%':
+            ++Cur;
+            return Number (2);
+
+        case '\'':
+            if (Cur[1] == '\0' || Cur[2] != '\'') {
+                ObjError ("Invalid character constant");
+                return 0;
+            }
+            E = NewObjLiteral (TgtTranslateChar ((unsigned char) Cur[1]));
+            Cur += 3;
+            return E;
+
+        case '-':
+            ++Cur;
+            return UnaryOp (EXPR_UNARY_MINUS, Factor ());
+
+        case '+':
+            ++Cur;
+            return Factor ();
+
+        case '~':
+            ++Cur;
+            return UnaryOp (EXPR_NOT, Factor ());
+
+        case '<':
+            ++Cur;
+            return UnaryOp (EXPR_BYTE0, Factor ());
+
+        case '>':
+            ++Cur;
+            return UnaryOp (EXPR_BYTE1, Factor ());
+
+        case '^':
+            ++Cur;
+            return UnaryOp (EXPR_BYTE2, Factor ());
+
+        case '*':
+            ++Cur;
+            return GenObjPCExpr ();
+
+        case '(':
+            ++Cur;
+            E = SimpleExpr ();
+            SkipBlanks ();
+            if (*Cur != ')') {
+                if (E) {
+                    ObjError ("')' expected");
+                    FreeObjExpr (E);
+                }
+                return 0;
+            }
+            ++Cur;
+            return E;
+
+        case '.':
+            if (strncmp (Cur, ".loword", 7) == 0 && !IsIdentChar (Cur[7])) {
+                Cur += 7;
+                SkipBlanks ();
+                if (*Cur == '(') {
+                    return UnaryOp (EXPR_WORD0, Factor ());
+                }
+            }
+            break;
+
+        default:
+            if (IsDigit (*Cur)) {
+                return Number (10);
+            }
+            if (IsIdentStart (*Cur)) {
+                StrBuf Name = AUTO_STRBUF_INITIALIZER;
+                while (IsIdentChar (*Cur)) {
+                    SB_AppendChar (&Name, *Cur++);
+                }
+                SB_Terminate (&Name);
+                E = NewObjSymExpr (RefObjSym (SB_GetConstBuf (&Name)));
+                SB_Done (&Name);
+                return E;
+            }
+            break;
+    }
+
+    ObjError ("Syntax error in operand: '%s'", Cur);
+    return 0;
+}
+
+
+
+static ExprNode* Term (void)
+/* Parse a multiplicative expression */
+{
+    ExprNode* Root = Factor ();
+
+    while (Root) {
+        unsigned char Op;
+        SkipBlanks ();
+        switch (*Cur) {
+            case '*':   Op = EXPR_MUL;  break;
+            case '/':   Op = EXPR_DIV;  break;
+            case '&':   Op = EXPR_AND;  break;
+            case '^':   Op = EXPR_XOR;  break;
+            case '<':
+                if (Cur[1] != '<') {
+                    return Root;
+                }
+                ++Cur;
+                Op = EXPR_SHL;
+                break;
+            case '>':
+                if (Cur[1] != '>') {
+                    return Root;
+                }
+                ++Cur;
+                Op = EXPR_SHR;
+                break;
+            default:
+                return Root;
+        }
+        ++Cur;
+        Root = BinaryOp (Op, Root, Factor ());
+    }
+    return Root;
+}
+
+
+
+static ExprNode* SimpleExpr (void)
+/* Parse an additive expression */
+{
+    ExprNode* Root = Term ();
+
+    while (Root) {
+        unsigned char Op;
+        SkipBlanks ();
+        switch (*Cur) {
+            case '+':   Op = EXPR_PLUS;         break;
+            case '-':   Op = EXPR_MINUS;        break;
+            case '|':   Op = EXPR_OR;           break;
+            default:    return Root;
+        }
+        ++Cur;
+        Root = BinaryOp (Op, Root, Term ());
+    }
+    return Root;
+}
+
+
+
+ExprNode* ParseObjExpr (const char** S)
+/* Parse an assembler expression starting at *S and return it. *S is moved
+** behind the expression. The syntax is the subset of the ca65 expression
+** syntax that is used in the code generated by the compiler and in inline
+** assembler statements. On errors, an error message is output and NULL is
+** returned.
+*/
+{
+    ExprNode* E;
+
+    Cur = *S;
+    E = SimpleExpr ();
+    SkipBlanks ();
+    *S = Cur;
+    return E;
+}
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+static void StudySymbol (const ExprNode* Expr, ObjExprDesc* D)
+/* Study a symbol expression node */
+{
+    /* Get the symbol, following links to resolved symbols */
+    ObjSym* Sym = Expr->V.ObjSym;
+    while (Sym->Link) {
+        Sym = Sym->Link;
+    }
+
+    if ((Sym->Flags & OSF_DEFINED) != 0 && Sym->Expr != 0) {
+
+        /* Study the expression of the symbol, but check for circular
+        ** references first.
+        */
+        if (Sym->Flags & OSF_MARK) {
+            ObjLIError (&Sym->DefLines,
+                        "Circular reference in definition of symbol '%s'",
+                        Sym->Key.Name);
+            OED_SetError (D);
+        } else {
+            Sym->Flags |= OSF_MARK;
+            StudyExprNode (Sym->Expr, D);
+            Sym->Flags &= ~OSF_MARK;
+
+            /* An explicit address size of the symbol overrides the one of
+            ** the expression.
+            */
+            if (Sym->AddrSize != ADDR_SIZE_DEFAULT) {
+                D->AddrSize = Sym->AddrSize;
+            }
+        }
+
+    } else if (Sym->Flags & OSF_IMPORT) {
+
+        /* An import. Track the reference and update the address size. */
+        ++OED_GetSymRef (D, Sym)->Count;
+        OED_UpdateAddrSize (D, Sym->AddrSize);
+
+    } else {
+
+        /* The symbol is undefined. Track the reference, but the result
+        ** cannot be evaluated.
+        */
+        ++OED_GetSymRef (D, Sym)->Count;
+        OED_Invalidate (D);
+
+        /* The symbol may be a forward reference to a symbol in an
+        ** enclosing scope. Use the address size of such a symbol.
+        */
+        if (Sym->AddrSize == ADDR_SIZE_DEFAULT && Sym->Key.Scope->Parent != 0) {
+            ObjSym* H = FindAnyObjSym (Sym->Key.Scope->Parent, Sym->Key.Name);
+            if (H && H->AddrSize != ADDR_SIZE_DEFAULT) {
+                D->AddrSize = H->AddrSize;
+            }
+        } else {
+            D->AddrSize = Sym->AddrSize;
+        }
+    }
+}
+
+
+
+static unsigned char StudySymAddrSize (const void* Sym)
+/* Return the address size of a symbol */
+{
+    return ((const ObjSym*) Sym)->AddrSize;
+}
+
+
+
+static void StudyError (const char* Msg)
+/* Output an error message for the expression */
+{
+    ObjError ("%s", Msg);
+}
+
+
+
+void StudyObjExpr (const ExprNode* Expr, ObjExprDesc* D)
+/* Study an expression tree and place the contents into D */
+{
+    static const StudyFuncs Funcs = {
+        StudySymbol,
+        0,
+        StudySymAddrSize,
+        GetObjSegAddrSize,
+        StudyError
+    };
+
+    StudyExprTree (Expr, D, &Funcs);
+}
+
+
+
+int IsConstObjExpr (const ExprNode* Expr, long* Val)
+/* Return true if the given expression is constant. If Val is not NULL, the
+** value of the expression is returned there.
+*/
+{
+    int IsConst;
+
+    ObjExprDesc D;
+    OED_Init (&D);
+    StudyObjExpr (Expr, &D);
+    IsConst = OED_IsConst (&D);
+    if (IsConst && Val != 0) {
+        *Val = D.Val;
+    }
+    OED_Done (&D);
+    return IsConst;
+}
+
+
+
+void WriteObjExpr (const ExprNode* Expr)
+/* Write the given expression to the object file */
+{
+    const ObjSym* Sym;
+
+    /* Null expressions are encoded by a type byte of zero */
+    if (Expr == 0) {
+        ObjWrite8 (EXPR_NULL);
+        return;
+    }
+
+    switch (Expr->Op) {
+
+        case EXPR_LITERAL:
+            ObjWrite8 (EXPR_LITERAL);
+            ObjWrite32 (Expr->V.IVal);
+            break;
+
+        case EXPR_SYMBOL:
+            Sym = Expr->V.ObjSym;
+            while (Sym->Link) {
+                Sym = Sym->Link;
+            }
+            if (Sym->Flags & OSF_IMPORT) {
+                ObjWrite8 (EXPR_SYMBOL);
+                ObjWriteVar (Sym->ImportId);
+            } else {
+                CHECK (Sym->Expr != 0);
+                WriteObjExpr (Sym->Expr);
+            }
+            break;
+
+        case EXPR_SECTION:
+            ObjWrite8 (EXPR_SECTION);
+            ObjWriteVar (Expr->V.SecNum);
+            break;
+
+        default:
+            /* Not a leaf node */
+            ObjWrite8 (Expr->Op);
+            WriteObjExpr (Expr->Left);
+            WriteObjExpr (Expr->Right);
+            break;
+    }
+}
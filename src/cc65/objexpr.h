@@ -0,0 +1,104 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                 objexpr.h                                 */
+/*                                                                           */
+/*                  Expressions for the integrated assembler                 */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#ifndef OBJEXPR_H
+#define OBJEXPR_H
+
+
+
+/* common */
+#include "exprdefs.h"
+#include "objexprdesc.h"
+
+
+
+/*****************************************************************************/
+/*                                 Forwards                                  */
+/*****************************************************************************/
+
+
+
+struct ObjSym;
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+ExprNode* NewObjLiteral (long Val);
+/* Return a literal expression node */
+
+ExprNode* NewObjSymExpr (struct ObjSym* Sym);
+/* Return an expression node for the given symbol */
+
+ExprNode* NewObjSectionExpr (unsigned SecNum);
+/* Return an expression node for the given section */
+
+ExprNode* NewObjUnaryExpr (unsigned char Op, ExprNode* Left);
+/* Return an unary expression node */
+
+ExprNode* NewObjBinaryExpr (unsigned char Op, ExprNode* Left, ExprNode* Right);
+/* Return a binary expression node */
+
+ExprNode* CloneObjExpr (const ExprNode* Expr);
+/* Return a deep copy of the given expression tree */
+
+void FreeObjExpr (ExprNode* Expr);
+/* Free an expression tree */
+
+ExprNode* ParseObjExpr (const char** S);
+/* Parse an assembler expression starting at *S and return it. *S is moved
+** behind the expression. The syntax is the subset of the ca65 expression
+** syntax that is used in the code generated by the compiler and in inline
+** assembler statements. On errors, an error message is output and NULL is
+** returned.
+*/
+
+void StudyObjExpr (const ExprNode* Expr, ObjExprDesc* ED);
+/* Study an expression tree and place the contents into ED */
+
+int IsConstObjExpr (const ExprNode* Expr, long* Val);
+/* Return true if the given expression is constant. If Val is not NULL, the
+** value of the expression is returned there.
+*/
+
+void WriteObjExpr (const ExprNode* Expr);
+/* Write the given expression to the object file */
+
+
+
+/* End of objexpr.h */
+
+#endif
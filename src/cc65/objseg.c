@@ -0,0 +1,919 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                  objseg.c                                 */
+/*                                                                           */
+/*            Segments and line infos for the integrated assembler           */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#include <stdarg.h>
+#include <string.h>
+
+/* common */
+#include "addrsize.h"
+#include "assertion.h"
+#include "check.h"
+#include "coll.h"
+#include "fragdefs.h"
+#include "hashfunc.h"
+#include "lidefs.h"
+#include "objspan.h"
+#include "objwrite.h"
+#include "segdefs.h"
+#include "segnames.h"
+#include "strbuf.h"
+#include "xmalloc.h"
+
+/* cc65 */
+#include "error.h"
+#include "global.h"
+#include "input.h"
+#include "objasm.h"
+#include "objseg.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* A piece of segment data. The bytes of literal fragments live in the data
+** buffer of the segment, expressions reserve their space there, too.
+*/
+typedef struct ObjFrag ObjFrag;
+struct ObjFrag {
+    unsigned char       Type;           /* FRAG_LITERAL, FRAG_EXPR, FRAG_SEXPR */
+    unsigned            Len;            /* Length of the fragment */
+    unsigned long       Offs;           /* Offset in the segment */
+    ExprNode*           Expr;           /* Expression if not a literal */
+    ObjLine*            LI[2];          /* Assembler and external line */
+};
+
+/* A segment */
+typedef struct ObjSeg ObjSeg;
+struct ObjSeg {
+    unsigned            Num;            /* Segment number */
+    unsigned char       AddrSize;       /* Address size of the segment */
+    char*               Name;           /* Segment name */
+    StrBuf              Data;           /* Segment data, length is the PC */
+    Collection          Frags;          /* List of fragments */
+};
+
+/* An assertion */
+typedef struct ObjAssert ObjAssert;
+struct ObjAssert {
+    ExprNode*           Expr;           /* Expression to evaluate */
+    unsigned            Action;         /* Action to take */
+    unsigned            Msg;            /* Message id */
+    const char*         MsgText;        /* Message text */
+    Collection          LI;             /* Line infos for the assertion */
+};
+
+/* Hash table functions */
+static unsigned HT_GenHashLine (const void* Key);
+static const void* HT_GetKeyLine (const void* Entry);
+static int HT_CompareLine (const void* Key1, const void* Key2);
+
+static const HashFunctions LineHashFunc = {
+    HT_GenHashLine,
+    HT_GetKeyLine,
+    HT_CompareLine
+};
+
+/* Segments, the active one is ActiveSeg */
+static Collection       SegmentList = STATIC_COLLECTION_INITIALIZER;
+static ObjSeg*          ActiveSeg;
+
+/* Line infos in the order of their ids, and the current ones */
+static HashTable        LineTab = STATIC_HASHTABLE_INITIALIZER (1051, &LineHashFunc);
+static Collection       LineInfoList = STATIC_COLLECTION_INITIALIZER;
+static ObjLine*         AsmLine;
+static ObjLine*         ExtLine;
+
+/* Spans. All spans are in SpanPool, the ones written to the object file are
+** registered when writing the lists. SpanOwners contains the span
+** collections that are currently recording.
+*/
+static Collection       SpanPool = STATIC_COLLECTION_INITIALIZER;
+static Collection       SpanOwners = STATIC_COLLECTION_INITIALIZER;
+
+/* Assertions */
+static Collection       Assertions = STATIC_COLLECTION_INITIALIZER;
+
+
+
+/*****************************************************************************/
+/*                           Hash table functions                            */
+/*****************************************************************************/
+
+
+
+static unsigned HT_GenHashLine (const void* Key)
+/* Generate the hash over a key */
+{
+    const ObjLine* L = Key;
+    return L->File * 2287U + L->Line * 31U + L->Type;
+}
+
+
+
+static const void* HT_GetKeyLine (const void* Entry)
+/* Given a pointer to the user entry data, return a pointer to the key */
+{
+    return Entry;
+}
+
+
+
+static int HT_CompareLine (const void* Key1, const void* Key2)
+/* Compare two line info keys */
+{
+    const ObjLine* L1 = Key1;
+    const ObjLine* L2 = Key2;
+    if (L1->File != L2->File) {
+        return (L1->File < L2->File)? -1 : 1;
+    }
+    if (L1->Line != L2->Line) {
+        return (L1->Line < L2->Line)? -1 : 1;
+    }
+    return (int) L1->Type - (int) L2->Type;
+}
+
+
+
+/*****************************************************************************/
+/*                                   Spans                                   */
+/*****************************************************************************/
+
+
+
+void ObjOpenSpans (Collection* Spans)
+/* Start recording the data emitted from now on into Spans */
+{
+    if (DebugInfo) {
+        CollAppend (&SpanOwners, Spans);
+    }
+}
+
+
+
+void ObjCloseSpans (Collection* Spans)
+/* Stop recording data into Spans */
+{
+    if (DebugInfo) {
+        CollDeleteItem (&SpanOwners, Spans);
+    }
+}
+
+
+
+static void AddSpans (unsigned long Start, unsigned long End)
+/* Add the given range of the active segment to all recording spans */
+{
+    unsigned I, J;
+    for (I = 0; I < CollCount (&SpanOwners); ++I) {
+
+        Collection* Spans = CollAtUnchecked (&SpanOwners, I);
+
+        /* Extend a span of this segment if the new data follows it. There is
+        ** at most one span per segment for the scopes, so search them all.
+        */
+        ObjSpan* S = 0;
+        J = CollCount (Spans);
+        while (J-- > 0) {
+            ObjSpan* E = CollAtUnchecked (Spans, J);
+            if (E->Seg == ActiveSeg->Num && E->End == Start) {
+                S = E;
+                break;
+            }
+        }
+        if (S) {
+            S->End = End;
+        } else {
+            S = NewObjSpan (ActiveSeg->Num, Start, End);
+            CollAppend (&SpanPool, S);
+            CollAppend (Spans, S);
+        }
+    }
+}
+
+
+
+/*****************************************************************************/
+/*                                Line infos                                 */
+/*****************************************************************************/
+
+
+
+static ObjLine* GetObjLine (const LineInfo* LI, unsigned Type)
+/* Return the line info for the position of LI and the given type, creating
+** it if necessary.
+*/
+{
+    ObjLine Key;
+    ObjLine* L;
+
+    Key.File = LI? GetInputFileIndex (LI->InputFile) : 0;
+    Key.Line = LI? LI->LineNum : 0;
+    Key.Type = LI_MAKE_TYPE (Type, 0);
+
+    L = HT_Find (&LineTab, &Key);
+    if (L == 0) {
+        L = xmalloc (sizeof (ObjLine));
+        InitHashNode (&L->Node);
+        L->Id   = CollCount (&LineInfoList);
+        L->File = Key.File;
+        L->Line = Key.Line;
+        L->Type = Key.Type;
+        L->LI   = LI;
+        InitCollection (&L->Spans);
+        HT_Insert (&LineTab, L);
+        CollAppend (&LineInfoList, L);
+    }
+    return L;
+}
+
+
+
+void ObjStartAsmLine (const LineInfo* LI)
+/* Make the position of LI the current assembler line. Use NULL for the
+** default position.
+*/
+{
+    ObjLine* L = GetObjLine (LI, LI_TYPE_ASM);
+    if (L != AsmLine) {
+        if (AsmLine) {
+            ObjCloseSpans (&AsmLine->Spans);
+        }
+        AsmLine = L;
+        ObjOpenSpans (&AsmLine->Spans);
+    }
+}
+
+
+
+void ObjStartExtLine (const LineInfo* LI)
+/* Start an external line info for the position of LI, ending the current
+** one. If LI is NULL, just end the current external line info.
+*/
+{
+    if (ExtLine) {
+        ObjCloseSpans (&ExtLine->Spans);
+        ExtLine = 0;
+    }
+    if (LI) {
+        ExtLine = GetObjLine (LI, LI_TYPE_EXT);
+        ObjOpenSpans (&ExtLine->Spans);
+    }
+}
+
+
+
+void ObjGetFullLines (Collection* Lines)
+/* Add all current line infos to the given collection */
+{
+    CollAppend (Lines, AsmLine);
+    if (ExtLine) {
+        CollAppend (Lines, ExtLine);
+    }
+}
+
+
+
+void ObjGetAsmLine (Collection* Lines)
+/* Add the current assembler line to the given collection, if it is not
+** already the last one.
+*/
+{
+    if (CollCount (Lines) == 0 || CollLast (Lines) != AsmLine) {
+        CollAppend (Lines, AsmLine);
+    }
+}
+
+
+
+static const LineInfo* GetDiagLine (const Collection* Lines)
+/* Return a compiler line info from the given list, or NULL if there is none */
+{
+    unsigned I;
+    for (I = 0; I < CollCount (Lines); ++I) {
+        const ObjLine* L = CollConstAt (Lines, I);
+        if (L->LI) {
+            return L->LI;
+        }
+    }
+    return 0;
+}
+
+
+
+static void VDiag (const LineInfo* LI, int IsError, const char* Format, va_list ap)
+/* Output a diagnostic for the given line info */
+{
+    StrBuf Msg = AUTO_STRBUF_INITIALIZER;
+    SB_VPrintf (&Msg, Format, ap);
+    if (IsError) {
+        if (LI) {
+            LIError (LI, "%s", SB_GetConstBuf (&Msg));
+        } else {
+            Error ("%s", SB_GetConstBuf (&Msg));
+        }
+    } else {
+        if (LI) {
+            LIWarning (LI, "%s", SB_GetConstBuf (&Msg));
+        } else {
+            Warning ("%s", SB_GetConstBuf (&Msg));
+        }
+    }
+    SB_Done (&Msg);
+}
+
+
+
+void ObjError (const char* Format, ...)
+/* Print an error message for the current line */
+{
+    va_list ap;
+    va_start (ap, Format);
+    VDiag (AsmLine->LI, 1, Format, ap);
+    va_end (ap);
+}
+
+
+
+void ObjLIError (const Collection* Lines, const char* Format, ...)
+/* Print an error message for the given list of line infos */
+{
+    va_list ap;
+    va_start (ap, Format);
+    VDiag (GetDiagLine (Lines), 1, Format, ap);
+    va_end (ap);
+}
+
+
+
+void ObjLIWarning (const Collection* Lines, const char* Format, ...)
+/* Print a warning for the given list of line infos */
+{
+    va_list ap;
+    va_start (ap, Format);
+    VDiag (GetDiagLine (Lines), 0, Format, ap);
+    va_end (ap);
+}
+
+
+
+void WriteObjLineList (const Collection* Lines)
+/* Write a list of line infos to the object file */
+{
+    unsigned I;
+    ObjWriteVar (CollCount (Lines));
+    for (I = 0; I < CollCount (Lines); ++I) {
+        ObjWriteVar (((const ObjLine*) CollConstAt (Lines, I))->Id);
+    }
+}
+
+
+
+void WriteObjLineInfos (void)
+/* Write the line infos to the object file */
+{
+    unsigned I;
+
+    ObjStartLineInfos ();
+
+    ObjWriteVar (CollCount (&LineInfoList));
+    for (I = 0; I < CollCount (&LineInfoList); ++I) {
+        const ObjLine* L = CollConstAt (&LineInfoList, I);
+        FilePos Pos;
+        Pos.Line = L->Line;
+        Pos.Col  = 0;
+        Pos.Name = L->File + 1;         /* ObjWritePos writes Name - 1 */
+        WriteObjLineInfo (&Pos, L->Type, &L->Spans);
+    }
+
+    ObjEndLineInfos ();
+}
+
+
+
+/*****************************************************************************/
+/*                                 Segments                                  */
+/*****************************************************************************/
+
+
+
+static ObjSeg* NewObjSeg (const char* Name, unsigned char AddrSize)
+/* Create a new segment and add it to the segment list */
+{
+    ObjSeg* S;
+
+    /* Check for too many segments */
+    if (CollCount (&SegmentList) >= 256) {
+        Fatal ("Too many segments");
+    }
+
+    S = xmalloc (sizeof (ObjSeg));
+    S->Num      = CollCount (&SegmentList);
+    S->AddrSize = AddrSize;
+    S->Name     = xstrdup (Name);
+    SB_Init (&S->Data);
+    InitCollection (&S->Frags);
+    CollAppend (&SegmentList, S);
+    return S;
+}
+
+
+
+void InitObjSegs (void)
+/* Create the default segments and the default line info */
+{
+    /* Create the predefined segments in the order the assembler uses */
+    ActiveSeg = NewObjSeg (SEGNAME_CODE, ADDR_SIZE_ABS);
+    NewObjSeg (SEGNAME_RODATA, ADDR_SIZE_ABS);
+    NewObjSeg (SEGNAME_BSS, ADDR_SIZE_ABS);
+    NewObjSeg (SEGNAME_DATA, ADDR_SIZE_ABS);
+    NewObjSeg (SEGNAME_ZEROPAGE, ADDR_SIZE_ZP);
+    NewObjSeg (SEGNAME_NULL, ADDR_SIZE_ABS);
+
+    /* Line info for data that is not generated from source lines */
+    ObjStartAsmLine (0);
+}
+
+
+
+void DoneObjSegs (void)
+/* Free the segments, line infos and assertions */
+{
+    unsigned I, J;
+
+    for (I = 0; I < CollCount (&SegmentList); ++I) {
+        ObjSeg* S = CollAtUnchecked (&SegmentList, I);
+        for (J = 0; J < CollCount (&S->Frags); ++J) {
+            ObjFrag* F = CollAtUnchecked (&S->Frags, J);
+            FreeObjExpr (F->Expr);
+            xfree (F);
+        }
+        DoneCollection (&S->Frags);
+        SB_Done (&S->Data);
+        xfree (S->Name);
+        xfree (S);
+    }
+    DoneCollection (&SegmentList);
+    ActiveSeg = 0;
+
+    for (I = 0; I < CollCount (&LineInfoList); ++I) {
+        ObjLine* L = CollAtUnchecked (&LineInfoList, I);
+        DoneCollection (&L->Spans);
+        xfree (L);
+    }
+    DoneCollection (&LineInfoList);
+    DoneHashTable (&LineTab);
+    AsmLine = ExtLine = 0;
+
+    for (I = 0; I < CollCount (&SpanPool); ++I) {
+        FreeObjSpan (CollAtUnchecked (&SpanPool, I));
+    }
+    DoneCollection (&SpanPool);
+    DoneCollection (&SpanOwners);
+    DoneObjSpans ();
+
+    for (I = 0; I < CollCount (&Assertions); ++I) {
+        ObjAssert* A = CollAtUnchecked (&Assertions, I);
+        FreeObjExpr (A->Expr);
+        DoneCollection (&A->LI);
+        xfree (A);
+    }
+    DoneCollection (&Assertions);
+}
+
+
+
+void UseObjSeg (const char* Name, unsigned char AddrSize)
+/* Make the named segment the active one, creating it if necessary. If
+** AddrSize is ADDR_SIZE_DEFAULT, any address size is accepted for an
+** existing segment, and a new one will be absolute.
+*/
+{
+    unsigned I;
+    for (I = 0; I < CollCount (&SegmentList); ++I) {
+        ObjSeg* S = CollAtUnchecked (&SegmentList, I);
+        if (strcmp (S->Name, Name) == 0) {
+            if (AddrSize != ADDR_SIZE_DEFAULT && S->AddrSize != AddrSize) {
+                ObjError ("Segment attribute mismatch");
+                S->AddrSize = AddrSize;
+            }
+            ActiveSeg = S;
+            return;
+        }
+    }
+
+    /* Segment is not in list, create a new one */
+    if (!ValidSegName (Name)) {
+        ObjError ("Illegal segment name: '%s'", Name);
+    }
+    ActiveSeg = NewObjSeg (Name, (AddrSize == ADDR_SIZE_DEFAULT)? ADDR_SIZE_ABS : AddrSize);
+}
+
+
+
+unsigned GetObjSegNum (void)
+/* Return the number of the active segment */
+{
+    return ActiveSeg->Num;
+}
+
+
+
+unsigned char GetObjSegAddrSize (unsigned SegNum)
+/* Return the address size of the given segment */
+{
+    return ((const ObjSeg*) CollConstAt (&SegmentList, SegNum))->AddrSize;
+}
+
+
+
+unsigned long GetObjPC (void)
+/* Return the PC of the active segment */
+{
+    return SB_GetLen (&ActiveSeg->Data);
+}
+
+
+
+unsigned long GetObjSegPC (unsigned SegNum)
+/* Return the PC of the given segment */
+{
+    return SB_GetLen (&((const ObjSeg*) CollConstAt (&SegmentList, SegNum))->Data);
+}
+
+
+
+ExprNode* GenObjPCExpr (void)
+/* Return an expression for the current PC */
+{
+    ExprNode* E = NewObjSectionExpr (ActiveSeg->Num);
+    if (GetObjPC () != 0) {
+        E = NewObjBinaryExpr (EXPR_PLUS, E, NewObjLiteral ((long) GetObjPC ()));
+    }
+    return E;
+}
+
+
+
+static ObjFrag* NewFrag (unsigned char Type, unsigned Len)
+/* Add a fragment of the given type to the active segment. Literals are
+** appended to the last fragment if possible.
+*/
+{
+    unsigned long PC = GetObjPC ();
+    ObjFrag* F = 0;
+
+    if (Type == FRAG_LITERAL && CollCount (&ActiveSeg->Frags) > 0) {
+        F = CollLast (&ActiveSeg->Frags);
+        if (F->Type == FRAG_LITERAL && F->LI[0] == AsmLine && F->LI[1] == ExtLine) {
+            F->Len += Len;
+        } else {
+            F = 0;
+        }
+    }
+    if (F == 0) {
+        F = xmalloc (sizeof (ObjFrag));
+        F->Type  = Type;
+        F->Len   = Len;
+        F->Offs  = PC;
+        F->Expr  = 0;
+        F->LI[0] = AsmLine;
+        F->LI[1] = ExtLine;
+        CollAppend (&ActiveSeg->Frags, F);
+    }
+
+    /* Remember the data for the recording spans */
+    if (CollCount (&SpanOwners) > 0) {
+        AddSpans (PC, PC + Len);
+    }
+    return F;
+}
+
+
+
+void ObjEmitByte (unsigned char Val)
+/* Emit one literal byte into the active segment */
+{
+    ObjEmitData (&Val, 1);
+}
+
+
+
+void ObjEmitData (const void* Data, unsigned Size)
+/* Emit literal bytes into the active segment */
+{
+    if (Size > 0) {
+        NewFrag (FRAG_LITERAL, Size);
+        SB_AppendBuf (&ActiveSeg->Data, Data, Size);
+    }
+}
+
+
+
+void ObjEmitFill (unsigned long Count)
+/* Emit Count zero bytes into the active segment */
+{
+    if (Count > 0) {
+        NewFrag (FRAG_LITERAL, Count);
+        while (Count--) {
+            SB_AppendChar (&ActiveSeg->Data, 0);
+        }
+    }
+}
+
+
+
+void ObjEmitExpr (ExprNode* Expr, unsigned Size, int Signed)
+/* Emit an expression of the given size into the active segment. The
+** expression is consumed.
+*/
+{
+    static const char Zero[4] = { 0, 0, 0, 0 };
+
+    CHECK (Size >= 1 && Size <= 4);
+
+    if (Expr->Op == EXPR_LITERAL && !Signed) {
+        /* Simple constant, check the range now */
+        unsigned char Data[4];
+        unsigned long Val = (unsigned long) Expr->V.IVal;
+        unsigned I;
+        if (Size < 4 && (Val >> (Size * 8)) != 0) {
+            ObjError ("Range error (%ld not in [0..%lu])", Expr->V.IVal,
+                      (1UL << (Size * 8)) - 1);
+        }
+        for (I = 0; I < Size; ++I) {
+            Data[I] = (unsigned char) Val;
+            Val >>= 8;
+        }
+        ObjEmitData (Data, Size);
+        FreeObjExpr (Expr);
+    } else {
+        ObjFrag* F = NewFrag (Signed? FRAG_SEXPR : FRAG_EXPR, Size);
+        F->Expr = Expr;
+        SB_AppendBuf (&ActiveSeg->Data, Zero, Size);
+    }
+}
+
+
+
+void ObjSegDone (void)
+/* Resolve constant fragments, check ranges and evaluate assertions */
+{
+    static const unsigned long U_Hi[4] = {
+        0x000000FFUL, 0x0000FFFFUL, 0x00FFFFFFUL, 0xFFFFFFFFUL
+    };
+    static const long S_Hi[4] = {
+        0x0000007FL, 0x00007FFFL, 0x007FFFFFL, 0x7FFFFFFFL
+    };
+
+    unsigned I, J;
+
+    for (I = 0; I < CollCount (&SegmentList); ++I) {
+
+        ObjSeg* S = CollAtUnchecked (&SegmentList, I);
+
+        for (J = 0; J < CollCount (&S->Frags); ++J) {
+
+            ObjFrag* F = CollAtUnchecked (&S->Frags, J);
+            Collection LI = AUTO_COLLECTION_INITIALIZER;
+            ObjExprDesc ED;
+
+            if (F->Type == FRAG_LITERAL) {
+                continue;
+            }
+
+            /* Line infos for diagnostics */
+            CollAppend (&LI, F->LI[0]);
+
+            OED_Init (&ED);
+            StudyObjExpr (F->Expr, &ED);
+
+            if (OED_IsConst (&ED)) {
+
+                unsigned K;
+                long Val = ED.Val;
+
+                /* The expression is constant. Check for range errors. */
+                if (F->Type == FRAG_SEXPR) {
+                    long Hi = S_Hi[F->Len-1];
+                    long Lo = ~Hi;
+                    if (Val > Hi || Val < Lo) {
+                        ObjLIError (&LI, "Range error (%ld not in [%ld..%ld])",
+                                    Val, Lo, Hi);
+                    }
+                } else {
+                    if (((unsigned long) Val) > U_Hi[F->Len-1]) {
+                        ObjLIError (&LI, "Range error (%lu not in [0..%lu])",
+                                    (unsigned long) Val, U_Hi[F->Len-1]);
+                    }
+                }
+
+                /* Convert the fragment into a literal */
+                for (K = 0; K < F->Len; ++K) {
+                    SB_GetBuf (&S->Data)[F->Offs + K] = (char) (Val & 0xFF);
+                    Val >>= 8;
+                }
+                FreeObjExpr (F->Expr);
+                F->Expr = 0;
+                F->Type = FRAG_LITERAL;
+
+            } else if ((F->Len == 1 && ED.AddrSize > ADDR_SIZE_ZP)  ||
+                       (F->Len == 2 && ED.AddrSize > ADDR_SIZE_ABS) ||
+                       (F->Len == 3 && ED.AddrSize > ADDR_SIZE_FAR)) {
+                /* The linker will resolve the expression, but it won't fit */
+                ObjLIError (&LI, "Range error");
+            }
+
+            OED_Done (&ED);
+            DoneCollection (&LI);
+        }
+    }
+
+    /* Evaluate the assertions that can be evaluated now */
+    for (I = 0; I < CollCount (&Assertions); ++I) {
+        ObjAssert* A = CollAtUnchecked (&Assertions, I);
+        long Val;
+        if (IsConstObjExpr (A->Expr, &Val) && Val == 0) {
+            if (A->Action == ASSERT_ACT_WARN) {
+                ObjLIWarning (&A->LI, "%s", A->MsgText);
+            } else if (A->Action == ASSERT_ACT_ERROR) {
+                ObjLIError (&A->LI, "%s", A->MsgText);
+            }
+        }
+    }
+}
+
+
+
+static int SameLines (const ObjFrag* F1, const ObjFrag* F2)
+/* Return true if both fragments are literals with the same line infos */
+{
+    return F1->Type == FRAG_LITERAL && F2->Type == FRAG_LITERAL &&
+           F1->LI[0] == F2->LI[0] && F1->LI[1] == F2->LI[1];
+}
+
+
+
+static void WriteFragLines (const ObjFrag* F)
+/* Write the line infos of a fragment */
+{
+    ObjWriteVar (F->LI[1]? 2 : 1);
+    ObjWriteVar (F->LI[0]->Id);
+    if (F->LI[1]) {
+        ObjWriteVar (F->LI[1]->Id);
+    }
+}
+
+
+
+static void WriteOneSeg (const ObjSeg* S)
+/* Write one segment to the object file */
+{
+    unsigned I, Last;
+    unsigned long FragCount;
+    unsigned long EndPos;
+
+    /* Remember the file position, then write a dummy for the size */
+    unsigned long SizePos = ObjGetFilePos ();
+    ObjWrite32 (0);
+
+    /* Write the segment data */
+    ObjWriteVar (ObjGetStringId (S->Name));     /* Name of the segment */
+    ObjWriteVar (SEG_FLAG_NONE);                /* Segment flags */
+    ObjWriteVar (SB_GetLen (&S->Data));         /* Size */
+    ObjWriteVar (1);                            /* Segment alignment */
+    ObjWrite8 (S->AddrSize);                    /* Address size */
+
+    /* Count the fragments. A run of literals with the same line infos is
+    ** written as one fragment.
+    */
+    FragCount = 0;
+    for (I = 0; I < CollCount (&S->Frags); ++I) {
+        if (I + 1 == CollCount (&S->Frags) ||
+            !SameLines (CollConstAt (&S->Frags, I), CollConstAt (&S->Frags, I + 1))) {
+            ++FragCount;
+        }
+    }
+    ObjWriteVar (FragCount);
+
+    /* Write the fragments */
+    I = 0;
+    while (I < CollCount (&S->Frags)) {
+
+        const ObjFrag* F = CollConstAt (&S->Frags, I);
+
+        if (F->Type == FRAG_LITERAL) {
+            unsigned long Len = F->Len;
+            Last = I;
+            while (Last + 1 < CollCount (&S->Frags) &&
+                   SameLines (CollConstAt (&S->Frags, Last), CollConstAt (&S->Frags, Last + 1))) {
+                ++Last;
+                Len += ((const ObjFrag*) CollConstAt (&S->Frags, Last))->Len;
+            }
+            ObjWrite8 (FRAG_LITERAL);
+            ObjWriteVar (Len);
+            ObjWriteData (SB_GetConstBuf (&S->Data) + F->Offs, Len);
+            I = Last;
+        } else {
+            ObjWrite8 (F->Type | F->Len);
+            WriteObjExpr (F->Expr);
+        }
+
+        /* Write the line infos for this fragment */
+        WriteFragLines (F);
+        ++I;
+    }
+
+    /* Calculate the size of the data, seek back and write it */
+    EndPos = ObjGetFilePos ();
+    ObjSetFilePos (SizePos);
+    ObjWrite32 (EndPos - SizePos - 4);
+    ObjSetFilePos (EndPos);
+}
+
+
+
+void WriteObjSegments (void)
+/* Write the segments to the object file */
+{
+    unsigned I;
+
+    ObjStartSegments ();
+    ObjWriteVar (CollCount (&SegmentList));
+    for (I = 0; I < CollCount (&SegmentList); ++I) {
+        WriteOneSeg (CollConstAt (&SegmentList, I));
+    }
+    ObjEndSegments ();
+}
+
+
+
+/*****************************************************************************/
+/*                                Assertions                                 */
+/*****************************************************************************/
+
+
+
+void ObjAddAssertion (ExprNode* Expr, unsigned Action, const char* Msg)
+/* Add an assertion for the current line. The expression is consumed. */
+{
+    ObjAssert* A = xmalloc (sizeof (ObjAssert));
+    A->Expr    = Expr;
+    A->Action  = Action;
+    A->Msg     = ObjGetStringId (Msg);
+    A->MsgText = Msg;
+    InitCollection (&A->LI);
+    ObjGetFullLines (&A->LI);
+    CollAppend (&Assertions, A);
+}
+
+
+
+void WriteObjAssertions (void)
+/* Write the assertions to the object file */
+{
+    unsigned I;
+
+    ObjStartAssertions ();
+    ObjWriteVar (CollCount (&Assertions));
+    for (I = 0; I < CollCount (&Assertions); ++I) {
+        const ObjAssert* A = CollConstAt (&Assertions, I);
+        WriteObjExpr (A->Expr);
+        ObjWriteVar (A->Action);
+        ObjWriteVar (A->Msg);
+        WriteObjLineList (&A->LI);
+    }
+    ObjEndAssertions ();
+}
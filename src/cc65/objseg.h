@@ -0,0 +1,175 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                  objseg.h                                 */
+/*                                                                           */
+/*            Segments and line infos for the integrated assembler           */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#ifndef OBJSEG_H
+#define OBJSEG_H
+
+
+
+/* common */
+#include "attrib.h"
+#include "coll.h"
+#include "hashtab.h"
+
+/* cc65 */
+#include "lineinfo.h"
+#include "objexpr.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* A line info as it is written to the object file. The compiler line info
+** is kept for diagnostics.
+*/
+typedef struct ObjLine ObjLine;
+struct ObjLine {
+    HashNode            Node;           /* Node for the hash table */
+    unsigned            Id;             /* Id of the line info */
+    unsigned            File;           /* Index of the input file */
+    unsigned long       Line;           /* Line number */
+    unsigned            Type;           /* Type and count of the line info */
+    const LineInfo*     LI;             /* Compiler line info or NULL */
+    Collection          Spans;          /* Spans for this line */
+};
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void InitObjSegs (void);
+/* Create the default segments and the default line info */
+
+void DoneObjSegs (void);
+/* Free the segments, line infos and assertions */
+
+void UseObjSeg (const char* Name, unsigned char AddrSize);
+/* Make the named segment the active one, creating it if necessary. If
+** AddrSize is ADDR_SIZE_DEFAULT, any address size is accepted for an
+** existing segment, and a new one will be absolute.
+*/
+
+unsigned GetObjSegNum (void);
+/* Return the number of the active segment */
+
+unsigned char GetObjSegAddrSize (unsigned SegNum);
+/* Return the address size of the given segment */
+
+unsigned long GetObjPC (void);
+/* Return the PC of the active segment */
+
+unsigned long GetObjSegPC (unsigned SegNum);
+/* Return the PC of the given segment */
+
+ExprNode* GenObjPCExpr (void);
+/* Return an expression for the current PC */
+
+void ObjEmitByte (unsigned char Val);
+/* Emit one literal byte into the active segment */
+
+void ObjEmitData (const void* Data, unsigned Size);
+/* Emit literal bytes into the active segment */
+
+void ObjEmitFill (unsigned long Count);
+/* Emit Count zero bytes into the active segment */
+
+void ObjEmitExpr (ExprNode* Expr, unsigned Size, int Signed);
+/* Emit an expression of the given size into the active segment. The
+** expression is consumed.
+*/
+
+void ObjStartAsmLine (const LineInfo* LI);
+/* Make the position of LI the current assembler line. Use NULL for the
+** default position.
+*/
+
+void ObjStartExtLine (const LineInfo* LI);
+/* Start an external line info for the position of LI, ending the current
+** one. If LI is NULL, just end the current external line info.
+*/
+
+void ObjGetFullLines (Collection* Lines);
+/* Add all current line infos to the given collection */
+
+void ObjGetAsmLine (Collection* Lines);
+/* Add the current assembler line to the given collection, if it is not
+** already the last one.
+*/
+
+void ObjError (const char* Format, ...) attribute ((format (printf, 1, 2)));
+/* Print an error message for the current line */
+
+void ObjLIError (const Collection* Lines, const char* Format, ...)
+    attribute ((format (printf, 2, 3)));
+/* Print an error message for the given list of line infos */
+
+void ObjLIWarning (const Collection* Lines, const char* Format, ...)
+    attribute ((format (printf, 2, 3)));
+/* Print a warning for the given list of line infos */
+
+void ObjOpenSpans (Collection* Spans);
+/* Start recording the data emitted from now on into Spans */
+
+void ObjCloseSpans (Collection* Spans);
+/* Stop recording data into Spans */
+
+void WriteObjLineList (const Collection* Lines);
+/* Write a list of line infos to the object file */
+
+void ObjAddAssertion (ExprNode* Expr, unsigned Action, const char* Msg);
+/* Add an assertion for the current line. The expression is consumed. */
+
+void ObjSegDone (void);
+/* Resolve constant fragments, check ranges and evaluate assertions */
+
+void WriteObjSegments (void);
+/* Write the segments to the object file */
+
+void WriteObjLineInfos (void);
+/* Write the line infos to the object file */
+
+void WriteObjAssertions (void);
+/* Write the assertions to the object file */
+
+
+
+/* End of objseg.h */
+
+#endif
@@ -0,0 +1,842 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                  objsym.c                                 */
+/*                                                                           */
+/*                 Symbol table for the integrated assembler                 */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#include <string.h>
+
+/* common */
+#include "addrsize.h"
+#include "check.h"
+#include "hashfunc.h"
+#include "hlldbgsym.h"
+#include "objspan.h"
+#include "objwrite.h"
+#include "scopedefs.h"
+#include "symdefs.h"
+#include "xmalloc.h"
+
+/* cc65 */
+#include "global.h"
+#include "objasm.h"
+#include "objseg.h"
+#include "objsym.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* High level debug info for a C function or symbol */
+typedef struct ObjHLLSym ObjHLLSym;
+struct ObjHLLSym {
+    unsigned            Flags;          /* See hlldbgsym.h */
+    unsigned            Name;           /* String id of the C name */
+    char*               AsmName;        /* Assembler name if any */
+    ObjSym*             Sym;            /* The assembler symbol */
+    long                Offs;           /* Offset for auto and register */
+    unsigned            Type;           /* String id of the type */
+    ObjScope*           Scope;          /* Scope the info was given in */
+    Collection          LI;             /* Line infos for diagnostics */
+};
+
+/* Hash table functions */
+static unsigned HT_GenHash (const void* Key);
+static const void* HT_GetKey (const void* Entry);
+static int HT_Compare (const void* Key1, const void* Key2);
+
+static const HashFunctions HashFunc = {
+    HT_GenHash,
+    HT_GetKey,
+    HT_Compare
+};
+
+/* The symbols. SymList is in order of creation, it is walked backwards to
+** get the same order as the standalone assembler.
+*/
+static HashTable        SymTab = STATIC_HASHTABLE_INITIALIZER (2053, &HashFunc);
+static Collection       SymList = STATIC_COLLECTION_INITIALIZER;
+
+/* The scopes in order of creation, the root scope is the first one */
+static Collection       ScopeList = STATIC_COLLECTION_INITIALIZER;
+static ObjScope*        CurScope;
+
+/* High level debug info */
+static Collection       HLLSyms = STATIC_COLLECTION_INITIALIZER;
+
+/* Counters */
+static unsigned         ImportCount;
+static unsigned         ExportCount;
+
+
+
+/*****************************************************************************/
+/*                           Hash table functions                            */
+/*****************************************************************************/
+
+
+
+static unsigned HT_GenHash (const void* Key)
+/* Generate the hash over a key */
+{
+    const ObjSymKey* K = Key;
+    return HashStr (K->Name) + K->Scope->Id;
+}
+
+
+
+static const void* HT_GetKey (const void* Entry)
+/* Given a pointer to the user entry data, return a pointer to the key */
+{
+    return &((const ObjSym*) Entry)->Key;
+}
+
+
+
+static int HT_Compare (const void* Key1, const void* Key2)
+/* Compare two keys */
+{
+    const ObjSymKey* K1 = Key1;
+    const ObjSymKey* K2 = Key2;
+    if (K1->Scope != K2->Scope) {
+        return 1;
+    }
+    return strcmp (K1->Name, K2->Name);
+}
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+static ObjScope* NewObjScope (ObjScope* Parent, unsigned Type, const char* Name)
+/* Create a new scope, make it the current one and start recording spans */
+{
+    ObjScope* S = xmalloc (sizeof (ObjScope));
+
+    S->Parent   = Parent;
+    S->Id       = CollCount (&ScopeList);
+    S->Level    = Parent? Parent->Level + 1 : 0;
+    S->Type     = Type;
+    S->Name     = ObjGetStringId (Name);
+    S->Label    = 0;
+    InitCollection (&S->Spans);
+    S->SegNum   = GetObjSegNum ();
+    S->Start    = GetObjPC ();
+    S->Size     = 0;
+    S->HasSize  = 0;
+
+    CollAppend (&ScopeList, S);
+    ObjOpenSpans (&S->Spans);
+    CurScope = S;
+
+    return S;
+}
+
+
+
+static void LeaveObjScope (void)
+/* Close the current scope and determine its size */
+{
+    ObjScope* S = CurScope;
+
+    /* Like the standalone assembler, use the size of the data emitted into
+    ** the segment that was active when the scope was opened.
+    */
+    unsigned long Size = GetObjSegPC (S->SegNum) - S->Start;
+    if (Size > 0) {
+        S->Size    = Size;
+        S->HasSize = 1;
+        if (S->Label) {
+            S->Label->Size   = Size;
+            S->Label->Flags |= OSF_SIZE;
+        }
+    }
+
+    ObjCloseSpans (&S->Spans);
+    CurScope = S->Parent;
+}
+
+
+
+static ObjSym* FindObjSym (ObjScope* Scope, const char* Name)
+/* Return the symbol with the given name in the given scope or NULL */
+{
+    ObjSymKey Key;
+    Key.Scope = Scope;
+    Key.Name  = Name;
+    return HT_Find (&SymTab, &Key);
+}
+
+
+
+static ObjSym* GetObjSym (const char* Name)
+/* Return the symbol with the given name in the current scope. Create it if
+** it doesn't exist.
+*/
+{
+    ObjSym* S = FindObjSym (CurScope, Name);
+    if (S == 0) {
+        S = xmalloc (sizeof (ObjSym));
+        InitHashNode (&S->Node);
+        S->Key.Scope    = CurScope;
+        S->Key.Name     = xstrdup (Name);
+        S->Link         = 0;
+        S->Flags        = OSF_NONE;
+        S->AddrSize     = ADDR_SIZE_DEFAULT;
+        S->ExportSize   = ADDR_SIZE_DEFAULT;
+        S->Expr         = 0;
+        S->Size         = 0;
+        S->ImportId     = ~0U;
+        S->ExportId     = ~0U;
+        S->DbgId        = ~0U;
+        InitCollection (&S->DefLines);
+        InitCollection (&S->RefLines);
+        HT_Insert (&SymTab, S);
+        CollAppend (&SymList, S);
+    }
+    return S;
+}
+
+
+
+void InitObjSyms (void)
+/* Initialize the symbol table and enter the root scope */
+{
+    NewObjScope (0, SCOPE_FILE, "");
+}
+
+
+
+void DoneObjSyms (void)
+/* Free the symbol table */
+{
+    unsigned I;
+
+    for (I = 0; I < CollCount (&SymList); ++I) {
+        ObjSym* S = CollAtUnchecked (&SymList, I);
+        FreeObjExpr (S->Expr);
+        DoneCollection (&S->DefLines);
+        DoneCollection (&S->RefLines);
+        xfree ((char*) S->Key.Name);
+        xfree (S);
+    }
+    DoneCollection (&SymList);
+    DoneHashTable (&SymTab);
+
+    for (I = 0; I < CollCount (&ScopeList); ++I) {
+        ObjScope* S = CollAtUnchecked (&ScopeList, I);
+        DoneCollection (&S->Spans);
+        xfree (S);
+    }
+    DoneCollection (&ScopeList);
+    CurScope = 0;
+
+    for (I = 0; I < CollCount (&HLLSyms); ++I) {
+        ObjHLLSym* H = CollAtUnchecked (&HLLSyms, I);
+        xfree (H->AsmName);
+        DoneCollection (&H->LI);
+        xfree (H);
+    }
+    DoneCollection (&HLLSyms);
+}
+
+
+
+ObjScope* GetCurObjScope (void)
+/* Return the current scope */
+{
+    return CurScope;
+}
+
+
+
+ObjSym* FindAnyObjSym (ObjScope* Scope, const char* Name)
+/* Search for a symbol in the given scope and all enclosing scopes. Return
+** NULL if there is no such symbol.
+*/
+{
+    while (Scope) {
+        /* Unused entries are trampolines for a symbol in a parent scope */
+        ObjSym* S = FindObjSym (Scope, Name);
+        if (S && (S->Flags & OSF_UNUSED) == 0) {
+            return S;
+        }
+        Scope = Scope->Parent;
+    }
+    return 0;
+}
+
+
+
+ObjSym* RefObjSym (const char* Name)
+/* Return the symbol with the given name in the current scope, creating it if
+** it doesn't exist, and remember the current line as a reference.
+*/
+{
+    ObjSym* S = GetObjSym (Name);
+    S->Flags |= OSF_REFERENCED;
+    ObjGetAsmLine (&S->RefLines);
+    return S;
+}
+
+
+
+void DefObjSym (const char* Name, ExprNode* Expr, unsigned char AddrSize,
+                unsigned Flags)
+/* Define a symbol in the current scope. If AddrSize is ADDR_SIZE_DEFAULT, it
+** is determined from the expression.
+*/
+{
+    ObjSym* S = GetObjSym (Name);
+
+    if (S->Flags & OSF_IMPORT) {
+        ObjError ("Symbol '%s' is already an import", Name);
+        FreeObjExpr (Expr);
+        return;
+    }
+    if (S->Flags & OSF_DEFINED) {
+        ObjError ("Symbol '%s' is already defined", Name);
+        FreeObjExpr (Expr);
+        return;
+    }
+
+    if (AddrSize == ADDR_SIZE_DEFAULT) {
+        ObjExprDesc ED;
+        OED_Init (&ED);
+        StudyObjExpr (Expr, &ED);
+        AddrSize = ED.AddrSize;
+        OED_Done (&ED);
+    }
+
+    S->Expr      = Expr;
+    S->Flags    |= (OSF_DEFINED | Flags);
+    S->AddrSize  = AddrSize;
+    ObjGetFullLines (&S->DefLines);
+
+    if ((S->Flags & OSF_EXPORT) != 0 && S->ExportSize == ADDR_SIZE_DEFAULT) {
+        S->ExportSize = S->AddrSize;
+    }
+}
+
+
+
+void DefObjLabel (const char* Name)
+/* Define a label at the current PC in the current scope */
+{
+    DefObjSym (Name, GenObjPCExpr (), ADDR_SIZE_DEFAULT, OSF_LABEL);
+}
+
+
+
+void ImportObjSym (const char* Name, unsigned char AddrSize, unsigned Flags)
+/* Import a symbol into the current scope */
+{
+    ObjSym* S = GetObjSym (Name);
+
+    if (S->Flags & OSF_DEFINED) {
+        ObjError ("Symbol '%s' is already defined", Name);
+        return;
+    }
+    if (S->Flags & OSF_EXPORT) {
+        ObjError ("Cannot import exported symbol '%s'", Name);
+        return;
+    }
+
+    if (AddrSize == ADDR_SIZE_DEFAULT) {
+        AddrSize = GetObjSegAddrSize (GetObjSegNum ());
+    }
+    if ((S->Flags & OSF_IMPORT) != 0 && AddrSize != S->AddrSize) {
+        ObjError ("Address size mismatch for symbol '%s'", Name);
+    }
+
+    S->Flags    |= (OSF_IMPORT | Flags);
+    S->AddrSize  = AddrSize;
+    ObjGetFullLines (&S->DefLines);
+}
+
+
+
+void ExportObjSym (const char* Name, unsigned char AddrSize)
+/* Export a symbol from the current scope */
+{
+    ObjSym* S = GetObjSym (Name);
+
+    if (S->Flags & OSF_IMPORT) {
+        ObjError ("Symbol '%s' is already an import", Name);
+        return;
+    }
+
+    S->ExportSize = AddrSize;
+    if ((S->Flags & OSF_DEFINED) != 0 && S->ExportSize == ADDR_SIZE_DEFAULT) {
+        S->ExportSize = S->AddrSize;
+    }
+
+    S->Flags |= (OSF_EXPORT | OSF_REFERENCED);
+    ObjGetAsmLine (&S->RefLines);
+}
+
+
+
+void EnterObjProc (const char* Name, unsigned char AddrSize)
+/* Define Name as a label and open a scope for it */
+{
+    ObjScope* Scope;
+
+    DefObjSym (Name, GenObjPCExpr (), AddrSize, OSF_LABEL);
+
+    Scope = NewObjScope (CurScope, SCOPE_SCOPE, Name);
+    Scope->Label = FindObjSym (Scope->Parent, Name);
+}
+
+
+
+void LeaveObjProc (void)
+/* Close the scope of the current function */
+{
+    PRECONDITION (CurScope->Parent != 0);
+    LeaveObjScope ();
+}
+
+
+
+static ObjHLLSym* NewObjHLLSym (unsigned Flags, const char* Name,
+                                const StrBuf* Type)
+/* Create a new high level debug symbol in the current scope */
+{
+    ObjHLLSym* H = xmalloc (sizeof (ObjHLLSym));
+
+    H->Flags    = Flags;
+    H->Name     = ObjGetStringId (Name);
+    H->AsmName  = 0;
+    H->Sym      = 0;
+    H->Offs     = 0;
+    H->Type     = ObjGetStrBufId (Type);
+    H->Scope    = CurScope;
+    InitCollection (&H->LI);
+    ObjGetFullLines (&H->LI);
+
+    CollAppend (&HLLSyms, H);
+    return H;
+}
+
+
+
+void AddObjFuncInfo (const char* Name, const StrBuf* Type, unsigned Flags,
+                     const char* AsmName)
+/* Attach high level debug info for a function to the current scope */
+{
+    ObjHLLSym* H;
+
+    if (CurScope->Label == 0) {
+        ObjError ("Functions can only be tagged to .PROC scopes");
+        return;
+    }
+    if (strcmp (CurScope->Label->Key.Name, AsmName) != 0) {
+        ObjError ("Scope label and asm name for function must match");
+        return;
+    }
+
+    H = NewObjHLLSym (Flags | HLL_TYPE_FUNC, Name, Type);
+    H->Sym = CurScope->Label;
+}
+
+
+
+void AddObjSymInfo (const char* Name, const StrBuf* Type, unsigned Flags,
+                    const char* AsmName, long Offs)
+/* Add high level debug info for a C symbol in the current scope */
+{
+    ObjHLLSym* H = NewObjHLLSym (Flags | HLL_TYPE_SYM, Name, Type);
+    H->Offs = Offs;
+    if (AsmName) {
+        H->AsmName = xstrdup (AsmName);
+    }
+}
+
+
+
+static void CheckUndefined (ObjSym* S)
+/* Handle a symbol that was referenced but never defined */
+{
+    /* Search the enclosing scopes for a definition or an import */
+    ObjSym* Sym = 0;
+    ObjScope* Scope = S->Key.Scope->Parent;
+    while (Scope) {
+        Sym = FindObjSym (Scope, S->Key.Name);
+        if (Sym && (Sym->Flags & (OSF_DEFINED | OSF_IMPORT)) != 0) {
+            break;
+        }
+        Sym = 0;
+        Scope = Scope->Parent;
+    }
+
+    if (Sym) {
+
+        /* Make S a trampoline for the symbol found */
+        if (S->Flags & OSF_EXPORT) {
+            if (Sym->Flags & OSF_IMPORT) {
+                ObjLIError (&S->RefLines,
+                            "Symbol '%s' is already an import",
+                            Sym->Key.Name);
+            }
+            if ((Sym->Flags & OSF_EXPORT) == 0) {
+                Sym->Flags |= OSF_EXPORT;
+                Sym->ExportSize = S->ExportSize;
+                if (Sym->ExportSize == ADDR_SIZE_DEFAULT) {
+                    Sym->ExportSize = Sym->AddrSize;
+                }
+            }
+        }
+        if (S->Flags & OSF_REFERENCED) {
+            Sym->Flags |= OSF_REFERENCED;
+            CollTransfer (&Sym->RefLines, &S->RefLines);
+            CollDeleteAll (&S->RefLines);
+        }
+        S->Link  = Sym;
+        S->Flags = OSF_UNUSED;
+
+    } else if (S->Flags & OSF_EXPORT) {
+        /* We will not auto-import an export */
+        ObjLIError (&S->RefLines,
+                    "Exported symbol '%s' was never defined",
+                    S->Key.Name);
+    } else {
+        /* cc65 output is always assembled with auto import */
+        S->Flags    |= OSF_IMPORT;
+        S->AddrSize  = ADDR_SIZE_ABS;
+        ObjGetFullLines (&S->DefLines);
+    }
+}
+
+
+
+void CheckObjSyms (void)
+/* Resolve the symbols after all code has been translated. This must be
+** called before the segments are finished.
+*/
+{
+    unsigned I;
+
+    /* First pass: Turn undefined symbols into trampolines or imports */
+    I = CollCount (&SymList);
+    while (I-- > 0) {
+        ObjSym* S = CollAtUnchecked (&SymList, I);
+        if ((S->Flags & (OSF_DEFINED | OSF_IMPORT | OSF_UNUSED)) == 0) {
+            CheckUndefined (S);
+        }
+    }
+
+    /* Second pass: Assign ids and fix the address sizes */
+    I = CollCount (&SymList);
+    while (I-- > 0) {
+        ObjSym* S = CollAtUnchecked (&SymList, I);
+        if ((S->Flags & OSF_UNUSED) != 0 ||
+            (S->Flags & (OSF_DEFINED | OSF_IMPORT)) == 0) {
+            continue;
+        }
+
+        if ((S->Flags & OSF_IMPORT) != 0 &&
+            (S->Flags & (OSF_REFERENCED | OSF_FORCED)) != 0) {
+            S->ImportId = ImportCount++;
+        }
+        if (S->Flags & OSF_EXPORT) {
+            S->ExportId = ExportCount++;
+        }
+
+        if (S->Expr != 0 && S->AddrSize == ADDR_SIZE_DEFAULT) {
+            ObjExprDesc ED;
+            OED_Init (&ED);
+            StudyObjExpr (S->Expr, &ED);
+            S->AddrSize = ED.AddrSize;
+            if ((S->Flags & OSF_EXPORT) != 0 &&
+                S->ExportSize == ADDR_SIZE_DEFAULT) {
+                S->ExportSize = S->AddrSize;
+            }
+            OED_Done (&ED);
+        }
+    }
+
+    /* Resolve the assembler names of the C symbols. Functions have been
+    ** tagged already, and auto variables live on the stack.
+    */
+    for (I = 0; I < CollCount (&HLLSyms); ++I) {
+        ObjHLLSym* H = CollAtUnchecked (&HLLSyms, I);
+        if (HLL_IS_FUNC (H->Flags) || HLL_GET_SC (H->Flags) == HLL_SC_AUTO) {
+            continue;
+        }
+        H->Sym = FindAnyObjSym (H->Scope, H->AsmName);
+        if (H->Sym == 0) {
+            ObjLIError (&H->LI, "Assembler symbol '%s' not found", H->AsmName);
+        }
+    }
+
+    /* Leave the root scope */
+    PRECONDITION (CurScope != 0 && CurScope->Parent == 0);
+    LeaveObjScope ();
+}
+
+
+
+static unsigned GetSymInfoFlags (const ObjSym* S, long* ConstVal)
+/* Return the flags used when writing symbol information into a file. If
+** SYM_CONST is set, ConstVal contains the value of the symbol.
+*/
+{
+    unsigned Flags = 0;
+    Flags |= (S->Expr && IsConstObjExpr (S->Expr, ConstVal))? SYM_CONST : SYM_EXPR;
+    Flags |= (S->Flags & OSF_LABEL)? SYM_LABEL : SYM_EQUATE;
+    Flags |= SYM_STD;
+    if (S->Flags & OSF_EXPORT) {
+        Flags |= SYM_EXPORT;
+    }
+    if (S->Flags & OSF_IMPORT) {
+        Flags |= SYM_IMPORT;
+    }
+    if (S->Flags & OSF_SIZE) {
+        Flags |= SYM_SIZE;
+    }
+    return Flags;
+}
+
+
+
+static void WriteSymValue (const ObjSym* S, unsigned Flags, long ConstVal)
+/* Write the value and the size of a symbol */
+{
+    if (SYM_IS_CONST (Flags)) {
+        ObjWrite32 (ConstVal);
+    } else {
+        WriteObjExpr (S->Expr);
+    }
+    if (SYM_HAS_SIZE (Flags)) {
+        ObjWriteVar (S->Size);
+    }
+}
+
+
+
+void WriteObjImports (void)
+/* Write the import list to the object file */
+{
+    unsigned I;
+
+    ObjStartImports ();
+    ObjWriteVar (ImportCount);
+
+    I = CollCount (&SymList);
+    while (I-- > 0) {
+        const ObjSym* S = CollConstAt (&SymList, I);
+        if ((S->Flags & (OSF_UNUSED | OSF_IMPORT)) == OSF_IMPORT &&
+            (S->Flags & (OSF_REFERENCED | OSF_FORCED)) != 0) {
+            ObjWrite8 (S->AddrSize);
+            ObjWriteVar (ObjGetStringId (S->Key.Name));
+            WriteObjLineList (&S->DefLines);
+            WriteObjLineList (&S->RefLines);
+        }
+    }
+
+    ObjEndImports ();
+}
+
+
+
+void WriteObjExports (void)
+/* Write the export list to the object file */
+{
+    unsigned I;
+
+    ObjStartExports ();
+    ObjWriteVar (ExportCount);
+
+    I = CollCount (&SymList);
+    while (I-- > 0) {
+        const ObjSym* S = CollConstAt (&SymList, I);
+        if ((S->Flags & (OSF_UNUSED | OSF_EXPORT)) == OSF_EXPORT) {
+            long ConstVal;
+            unsigned Flags = GetSymInfoFlags (S, &ConstVal);
+            ObjWriteVar (Flags);
+            ObjWrite8 (S->ExportSize);
+            ObjWriteVar (ObjGetStringId (S->Key.Name));
+            WriteSymValue (S, Flags, ConstVal);
+            WriteObjLineList (&S->DefLines);
+            WriteObjLineList (&S->RefLines);
+        }
+    }
+
+    ObjEndExports ();
+}
+
+
+
+static int IsDbgSym (const ObjSym* S)
+/* Return true if this is a debug symbol */
+{
+    if ((S->Flags & (OSF_DEFINED | OSF_UNUSED)) == OSF_DEFINED) {
+        return 1;
+    }
+    return (S->Flags & (OSF_REFERENCED | OSF_IMPORT)) ==
+           (OSF_REFERENCED | OSF_IMPORT);
+}
+
+
+
+static void WriteHLLSyms (void)
+/* Write the high level debug symbols to the object file */
+{
+    unsigned I;
+
+    if (DebugInfo == 0) {
+        ObjWriteVar (0);
+        return;
+    }
+
+    ObjWriteVar (CollCount (&HLLSyms));
+    for (I = 0; I < CollCount (&HLLSyms); ++I) {
+        ObjHLLSym* H = CollAtUnchecked (&HLLSyms, I);
+        unsigned SC = HLL_GET_SC (H->Flags);
+
+        if (H->Sym && H->Sym->DbgId != ~0U) {
+            H->Flags |= HLL_DATA_SYM;
+        }
+
+        ObjWriteVar (H->Flags);
+        ObjWriteVar (H->Name);
+        if (HLL_HAS_SYM (H->Flags)) {
+            ObjWriteVar (H->Sym->DbgId);
+        }
+        if (SC == HLL_SC_AUTO || SC == HLL_SC_REG) {
+            ObjWriteVar ((unsigned long) H->Offs);
+        }
+        ObjWriteVar (H->Type);
+        ObjWriteVar (H->Scope->Id);
+    }
+}
+
+
+
+void WriteObjDbgSyms (void)
+/* Write the debug symbols to the object file */
+{
+    unsigned I;
+
+    ObjStartDbgSyms ();
+
+    if (DebugInfo) {
+
+        /* Give each debug symbol an id and count them */
+        unsigned Count = 0;
+        I = CollCount (&SymList);
+        while (I-- > 0) {
+            ObjSym* S = CollAtUnchecked (&SymList, I);
+            if (IsDbgSym (S)) {
+                S->DbgId = Count++;
+            }
+        }
+
+        ObjWriteVar (Count);
+        I = CollCount (&SymList);
+        while (I-- > 0) {
+            const ObjSym* S = CollConstAt (&SymList, I);
+            if (IsDbgSym (S)) {
+                long ConstVal;
+                unsigned Flags = GetSymInfoFlags (S, &ConstVal);
+                ObjWriteVar (Flags);
+                ObjWrite8 (S->AddrSize);
+                ObjWriteVar (S->Key.Scope->Id);
+                ObjWriteVar (ObjGetStringId (S->Key.Name));
+                WriteSymValue (S, Flags, ConstVal);
+                if (SYM_IS_IMPORT (Flags)) {
+                    ObjWriteVar (S->ImportId);
+                }
+                if (SYM_IS_EXPORT (Flags)) {
+                    ObjWriteVar (S->ExportId);
+                }
+                WriteObjLineList (&S->DefLines);
+                WriteObjLineList (&S->RefLines);
+            }
+        }
+
+    } else {
+
+        /* No debug symbols */
+        ObjWriteVar (0);
+
+    }
+
+    WriteHLLSyms ();
+
+    ObjEndDbgSyms ();
+}
+
+
+
+void WriteObjScopes (void)
+/* Write the scope table to the object file */
+{
+    unsigned I;
+
+    ObjStartScopes ();
+
+    if (DebugInfo) {
+
+        ObjWriteVar (CollCount (&ScopeList));
+        for (I = 0; I < CollCount (&ScopeList); ++I) {
+
+            const ObjScope* S = CollConstAt (&ScopeList, I);
+
+            unsigned Flags = 0;
+            if (S->HasSize) {
+                Flags |= SCOPE_SIZE;
+            }
+            if (S->Label) {
+                Flags |= SCOPE_LABELED;
+            }
+
+            WriteObjScope (S->Parent? S->Parent->Id : 0, S->Level, Flags,
+                           S->Type, S->Name, S->Size,
+                           S->Label? S->Label->DbgId : 0, &S->Spans);
+        }
+
+    } else {
+
+        /* No scope information */
+        ObjWriteVar (0);
+
+    }
+
+    ObjEndScopes ();
+}
@@ -0,0 +1,186 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                  objsym.h                                 */
+/*                                                                           */
+/*                    Symbols for the integrated assembler                   */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#ifndef OBJSYM_H
+#define OBJSYM_H
+
+
+
+/* common */
+#include "coll.h"
+#include "hashtab.h"
+#include "strbuf.h"
+
+/* cc65 */
+#include "objexpr.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Bits for the Flags value in ObjSym */
+#define OSF_NONE        0x0000U         /* Empty flag set */
+#define OSF_MARK        0x0001U         /* Used to detect circular references */
+#define OSF_UNUSED      0x0002U         /* Unused entry (trampoline) */
+#define OSF_EXPORT      0x0004U         /* Export this symbol */
+#define OSF_IMPORT      0x0008U         /* Import this symbol */
+#define OSF_LABEL       0x0040U         /* Used as a label */
+#define OSF_FORCED      0x0100U         /* Forced import, OSF_IMPORT also set */
+#define OSF_SIZE        0x0800U         /* Symbol has a size */
+#define OSF_DEFINED     0x2000U         /* Defined */
+#define OSF_REFERENCED  0x4000U         /* Referenced */
+
+/* A scope. The integrated assembler knows only the root scope and one
+** scope per function, since this is all the compiler generates.
+*/
+typedef struct ObjScope ObjScope;
+struct ObjScope {
+    ObjScope*           Parent;         /* Enclosing scope, NULL for root */
+    unsigned            Id;             /* Scope id */
+    unsigned            Level;          /* Lexical level */
+    unsigned            Type;           /* Scope type, see scopedefs.h */
+    unsigned            Name;           /* Name id */
+    struct ObjSym*      Label;          /* Owner symbol for .proc scopes */
+    Collection          Spans;          /* Spans for the scope */
+    unsigned            SegNum;         /* Segment active when opened */
+    unsigned long       Start;          /* PC of this segment when opened */
+    unsigned long       Size;           /* Size of the scope */
+    int                 HasSize;        /* True if the scope has a size */
+};
+
+/* Symbol table key */
+typedef struct ObjSymKey ObjSymKey;
+struct ObjSymKey {
+    ObjScope*           Scope;          /* Scope the symbol lives in */
+    const char*         Name;           /* Name of the symbol */
+};
+
+/* A symbol */
+typedef struct ObjSym ObjSym;
+struct ObjSym {
+    HashNode            Node;           /* Node for the symbol table */
+    ObjSymKey           Key;            /* Scope and name */
+    ObjSym*             Link;           /* Symbol this one was resolved to */
+    unsigned            Flags;          /* Symbol flags, see above */
+    unsigned char       AddrSize;       /* Address size of the symbol */
+    unsigned char       ExportSize;     /* Address size when exported */
+    ExprNode*           Expr;           /* Value if the symbol is defined */
+    unsigned long       Size;           /* Size of the symbol if OSF_SIZE */
+    unsigned            ImportId;       /* Id of the import */
+    unsigned            ExportId;       /* Id of the export */
+    unsigned            DbgId;          /* Id of the debug symbol */
+    Collection          DefLines;       /* Line infos of the definition */
+    Collection          RefLines;       /* Line infos of the references */
+};
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void InitObjSyms (void);
+/* Initialize the symbol table and enter the root scope */
+
+void DoneObjSyms (void);
+/* Free the symbol table */
+
+ObjScope* GetCurObjScope (void);
+/* Return the current scope */
+
+ObjSym* FindAnyObjSym (ObjScope* Scope, const char* Name);
+/* Search for a symbol in the given scope and all enclosing scopes. Return
+** NULL if there is no such symbol.
+*/
+
+ObjSym* RefObjSym (const char* Name);
+/* Return the symbol with the given name in the current scope, creating it if
+** it doesn't exist, and remember the current line as a reference.
+*/
+
+void DefObjSym (const char* Name, ExprNode* Expr, unsigned char AddrSize,
+                unsigned Flags);
+/* Define a symbol in the current scope. If AddrSize is ADDR_SIZE_DEFAULT, it
+** is determined from the expression.
+*/
+
+void DefObjLabel (const char* Name);
+/* Define a label at the current PC in the current scope */
+
+void ImportObjSym (const char* Name, unsigned char AddrSize, unsigned Flags);
+/* Import a symbol into the current scope */
+
+void ExportObjSym (const char* Name, unsigned char AddrSize);
+/* Export a symbol from the current scope */
+
+void EnterObjProc (const char* Name, unsigned char AddrSize);
+/* Define Name as a label and open a scope for it */
+
+void LeaveObjProc (void);
+/* Close the scope of the current function */
+
+void AddObjFuncInfo (const char* Name, const StrBuf* Type, unsigned Flags,
+                     const char* AsmName);
+/* Attach high level debug info for a function to the current scope */
+
+void AddObjSymInfo (const char* Name, const StrBuf* Type, unsigned Flags,
+                    const char* AsmName, long Offs);
+/* Add high level debug info for a C symbol in the current scope */
+
+void CheckObjSyms (void);
+/* Resolve the symbols after all code has been translated. This must be
+** called before the segments are finished.
+*/
+
+void WriteObjImports (void);
+/* Write the import list to the object file */
+
+void WriteObjExports (void);
+/* Write the export list to the object file */
+
+void WriteObjDbgSyms (void);
+/* Write the debug symbols to the object file */
+
+void WriteObjScopes (void);
+/* Write the scope table to the object file */
+
+
+
+/* End of objsym.h */
+
+#endif
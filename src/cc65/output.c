@@ -48,6 +48,7 @@
 #include "error.h"
 #include "global.h"
 #include "output.h"
+#include "precomp.h"
 
 
 
@@ -86,7 +87,9 @@ void MakeDefaultOutputName (const char* InputFilename)
 {
     if (OutputFilename == 0 || *OutputFilename == '\0') {
         /* We don't have an output file for now */
-        const char* Ext = PreprocessOnly? ".i" : ".s";
+        const char* Ext = PreprocessOnly? ".i"        :
+                          Precompile?     PRECOMP_EXT :
+                          IntegratedAs?   ".o"        : ".s";
         OutputFilename = MakeFilename (InputFilename, Ext);
     }
 }
@@ -48,6 +48,7 @@
 #include "expr.h"
 #include "global.h"
 #include "litpool.h"
+#include "precomp.h"
 #include "scanner.h"
 #include "scanstrbuf.h"
 #include "symtab.h"
@@ -67,6 +68,7 @@ typedef enum {
     PRAGMA_ILLEGAL = -1,
     PRAGMA_ALIGN,
     PRAGMA_ALLOW_EAGER_INLINE,
+    PRAGMA_AUTO_REGISTER_VARS,
     PRAGMA_BSS_NAME,
     PRAGMA_BSSSEG,                                      /* obsolete */
     PRAGMA_CHARMAP,
@@ -104,6 +106,7 @@ static const struct Pragma {
 } Pragmas[PRAGMA_COUNT] = {
     { "align",                  PRAGMA_ALIGN              },
     { "allow-eager-inline",     PRAGMA_ALLOW_EAGER_INLINE },
+    { "auto-register-vars",     PRAGMA_AUTO_REGISTER_VARS },
     { "bss-name",               PRAGMA_BSS_NAME           },
     { "bssseg",                 PRAGMA_BSSSEG             },      /* obsolete */
     { "charmap",                PRAGMA_CHARMAP            },
@@ -785,22 +788,15 @@ static void MakeMessage (const char* Message)
 
 
 
-static void ParsePragma (void)
-/* Parse the contents of the _Pragma statement */
+static void ParsePragmaString (StrBuf* B)
+/* Parse the contents of a pragma given as string */
 {
     pragma_t Pragma;
     StrBuf   Ident = AUTO_STRBUF_INITIALIZER;
 
-    /* Create a string buffer from the string literal */
-    StrBuf B = AUTO_STRBUF_INITIALIZER;
-    SB_Append (&B, GetLiteralStrBuf (CurTok.SVal));
-
-    /* Skip the string token */
-    NextToken ();
-
     /* Get the pragma name from the string */
-    SB_SkipWhite (&B);
-    if (!SB_GetSym (&B, &Ident, "-")) {
+    SB_SkipWhite (B);
+    if (!SB_GetSym (B, &Ident, "-")) {
         Error ("Invalid pragma");
         goto ExitPoint;
     }
@@ -819,125 +815,136 @@ static void ParsePragma (void)
         goto ExitPoint;
     }
 
+    /* A precompiled header repeats the pragmas when it is loaded. Messages
+    ** are not repeated.
+    */
+    if (Precompile && Pragma != PRAGMA_MESSAGE) {
+        PrecompPragma (B);
+    }
+
     /* Check for an open paren */
-    SB_SkipWhite (&B);
-    if (SB_Get (&B) != '(') {
+    SB_SkipWhite (B);
+    if (SB_Get (B) != '(') {
         Error ("'(' expected");
         goto ExitPoint;
     }
 
     /* Skip white space before the argument */
-    SB_SkipWhite (&B);
+    SB_SkipWhite (B);
 
     /* Switch for the different pragmas */
     switch (Pragma) {
 
         case PRAGMA_ALIGN:
-            IntPragma (&B, &DataAlignment, 1, 4096);
+            IntPragma (B, &DataAlignment, 1, 4096);
             break;
 
         case PRAGMA_ALLOW_EAGER_INLINE:
-            FlagPragma (&B, &EagerlyInlineFuncs);
+            FlagPragma (B, &EagerlyInlineFuncs);
+            break;
+
+        case PRAGMA_AUTO_REGISTER_VARS:
+            FlagPragma (B, &AutoRegVars);
             break;
 
         case PRAGMA_BSSSEG:
             Warning ("#pragma bssseg is obsolete, please use #pragma bss-name instead");
             /* FALLTHROUGH */
         case PRAGMA_BSS_NAME:
-            SegNamePragma (&B, SEG_BSS);
+            SegNamePragma (B, SEG_BSS);
             break;
 
         case PRAGMA_CHARMAP:
-            CharMapPragma (&B);
+            CharMapPragma (B);
             break;
 
         case PRAGMA_CHECKSTACK:
             Warning ("#pragma checkstack is obsolete, please use #pragma check-stack instead");
             /* FALLTHROUGH */
         case PRAGMA_CHECK_STACK:
-            FlagPragma (&B, &CheckStack);
+            FlagPragma (B, &CheckStack);
             break;
 
         case PRAGMA_CODESEG:
             Warning ("#pragma codeseg is obsolete, please use #pragma code-name instead");
             /* FALLTHROUGH */
         case PRAGMA_CODE_NAME:
-            SegNamePragma (&B, SEG_CODE);
+            SegNamePragma (B, SEG_CODE);
             break;
 
         case PRAGMA_CODESIZE:
-            IntPragma (&B, &CodeSizeFactor, 10, 1000);
+            IntPragma (B, &CodeSizeFactor, 10, 1000);
             break;
 
         case PRAGMA_DATASEG:
             Warning ("#pragma dataseg is obsolete, please use #pragma data-name instead");
             /* FALLTHROUGH */
         case PRAGMA_DATA_NAME:
-            SegNamePragma (&B, SEG_DATA);
+            SegNamePragma (B, SEG_DATA);
             break;
 
         case PRAGMA_INLINE_STDFUNCS:
-            FlagPragma (&B, &InlineStdFuncs);
+            FlagPragma (B, &InlineStdFuncs);
             break;
 
         case PRAGMA_LOCAL_STRINGS:
-            FlagPragma (&B, &LocalStrings);
+            FlagPragma (B, &LocalStrings);
             break;
 
         case PRAGMA_MESSAGE:
-            StringPragma (&B, MakeMessage);
+            StringPragma (B, MakeMessage);
             break;
 
         case PRAGMA_OPTIMIZE:
-            FlagPragma (&B, &Optimize);
+            FlagPragma (B, &Optimize);
             break;
 
         case PRAGMA_REGVARADDR:
-            FlagPragma (&B, &AllowRegVarAddr);
+            FlagPragma (B, &AllowRegVarAddr);
             break;
 
         case PRAGMA_REGVARS:
             Warning ("#pragma regvars is obsolete, please use #pragma register-vars instead");
             /* FALLTHROUGH */
         case PRAGMA_REGISTER_VARS:
-            FlagPragma (&B, &EnableRegVars);
+            FlagPragma (B, &EnableRegVars);
             break;
 
         case PRAGMA_RODATASEG:
             Warning ("#pragma rodataseg is obsolete, please use #pragma rodata-name instead");
             /* FALLTHROUGH */
         case PRAGMA_RODATA_NAME:
-            SegNamePragma (&B, SEG_RODATA);
+            SegNamePragma (B, SEG_RODATA);
             break;
 
         case PRAGMA_SIGNEDCHARS:
             Warning ("#pragma signedchars is obsolete, please use #pragma signed-chars instead");
             /* FALLTHROUGH */
         case PRAGMA_SIGNED_CHARS:
-            FlagPragma (&B, &SignedChars);
+            FlagPragma (B, &SignedChars);
             break;
 
         case PRAGMA_STATICLOCALS:
             Warning ("#pragma staticlocals is obsolete, please use #pragma static-locals instead");
             /* FALLTHROUGH */
         case PRAGMA_STATIC_LOCALS:
-            FlagPragma (&B, &StaticLocals);
+            FlagPragma (B, &StaticLocals);
             break;
 
         case PRAGMA_WRAPPED_CALL:
-            WrappedCallPragma(&B);
+            WrappedCallPragma(B);
             break;
 
         case PRAGMA_WARN:
-            WarnPragma (&B);
+            WarnPragma (B);
             break;
 
         case PRAGMA_WRITABLE_STRINGS:
-            FlagPragma (&B, &WritableStrings);
+            FlagPragma (B, &WritableStrings);
             break;
 
         case PRAGMA_ZPSYM:
-            StringPragma (&B, MakeZPSym);
+            StringPragma (B, MakeZPSym);
             break;
 
         default:
@@ -945,32 +952,50 @@ static void ParsePragma (void)
     }
 
     /* Closing paren expected */
-    SB_SkipWhite (&B);
-    if (SB_Get (&B) != ')') {
+    SB_SkipWhite (B);
+    if (SB_Get (B) != ')') {
         Error ("')' expected");
         goto ExitPoint;
     }
-    SB_SkipWhite (&B);
+    SB_SkipWhite (B);
 
     /* Allow an optional semicolon to be compatible with the old syntax */
-    if (SB_Peek (&B) == ';') {
-        SB_Skip (&B);
-        SB_SkipWhite (&B);
+    if (SB_Peek (B) == ';') {
+        SB_Skip (B);
+        SB_SkipWhite (B);
     }
 
     /* Make sure nothing follows */
-    if (SB_Peek (&B) != '\0') {
+    if (SB_Peek (B) != '\0') {
         Error ("Unexpected input following pragma directive");
     }
 
 ExitPoint:
-    /* Release the string buffers */
-    SB_Done (&B);
+    /* Release the string buffer */
     SB_Done (&Ident);
 }
 
 
 
+static void ParsePragma (void)
+/* Parse the contents of the _Pragma statement */
+{
+    /* Create a string buffer from the string literal */
+    StrBuf B = AUTO_STRBUF_INITIALIZER;
+    SB_Append (&B, GetLiteralStrBuf (CurTok.SVal));
+
+    /* Skip the string token */
+    NextToken ();
+
+    /* Parse the pragma */
+    ParsePragmaString (&B);
+
+    /* Release the string buffer */
+    SB_Done (&B);
+}
+
+
+
 void DoPragma (void)
 /* Handle pragmas. These come always in form of the new C99 _Pragma() operator. */
 {
@@ -1002,3 +1027,14 @@ void DoPragma (void)
     /* Closing paren needed */
     ConsumeRParen ();
 }
+
+
+
+void ApplyPragma (const StrBuf* Text)
+/* Handle a pragma recorded in a precompiled header */
+{
+    StrBuf B = AUTO_STRBUF_INITIALIZER;
+    SB_Append (&B, Text);
+    ParsePragmaString (&B);
+    SB_Done (&B);
+}
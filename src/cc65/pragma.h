@@ -38,6 +38,11 @@
 
 
 
+/* common */
+#include "strbuf.h"
+
+
+
 /*****************************************************************************/
 /*                                   Code                                    */
 /*****************************************************************************/
@@ -47,6 +52,9 @@
 void DoPragma (void);
 /* Handle pragmas. These come always in form of the new C99 _Pragma() operator. */
 
+void ApplyPragma (const StrBuf* Text);
+/* Handle a pragma recorded in a precompiled header */
+
 
 
 /* End of pragma.h */
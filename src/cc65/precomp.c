@@ -0,0 +1,1634 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                 precomp.c                                 */
+/*                                                                           */
+/*                Precompiled headers for the cc65 C compiler                */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <errno.h>
+
+/* common */
+#include "coll.h"
+#include "cpu.h"
+#include "filestat.h"
+#include "fname.h"
+#include "mmodel.h"
+#include "print.h"
+#include "target.h"
+#include "xmalloc.h"
+
+/* cc65 */
+#include "anonname.h"
+#include "asmlabel.h"
+#include "codeseg.h"
+#include "dataseg.h"
+#include "datatype.h"
+#include "declattr.h"
+#include "error.h"
+#include "funcdesc.h"
+#include "global.h"
+#include "input.h"
+#include "litpool.h"
+#include "macrotab.h"
+#include "output.h"
+#include "pragma.h"
+#include "precomp.h"
+#include "segments.h"
+#include "standard.h"
+#include "symentry.h"
+#include "symtab.h"
+#include "textseg.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Magic and version of precompiled headers */
+#define PRECOMP_MAGIC           0x48435043UL    /* "CPCH" */
+#define PRECOMP_VERSION         1U
+
+/* Size of the fingerprint of the compiler settings */
+#define FINGERPRINT_SIZE        5
+
+/* Kinds of data stored in the V union of a symbol table entry */
+enum {
+    SD_OFFS,                            /* Offset or nothing */
+    SD_ALIAS,                           /* Alias of an anonymous field */
+    SD_STRUCT,                          /* Struct or union tag */
+    SD_ENUM,                            /* Enum tag */
+    SD_BITFIELD,                        /* Bit-field */
+    SD_CONST,                           /* Enumerator */
+    SD_REGISTER,                        /* Register variable */
+    SD_FUNC                             /* Function */
+};
+
+/* A source file of a precompiled header */
+typedef struct SrcFile SrcFile;
+struct SrcFile {
+    char*               Name;           /* Name of the file */
+    InputType           Type;           /* Type of the input file */
+    unsigned long       Size;           /* Size of file */
+    unsigned long       MTime;          /* Time of last modification */
+    char*               Guard;          /* Include guard macro or NULL */
+    int                 Once;           /* File has #pragma once */
+};
+
+/* Entry in the table that maps objects to their index in the file */
+typedef struct ObjRef ObjRef;
+struct ObjRef {
+    const void*         Obj;            /* Table, symbol or function */
+    unsigned            Index;          /* Index in the list of its kind */
+};
+
+/* State captured when precompiling starts */
+static Collection       Predefined = STATIC_COLLECTION_INITIALIZER;
+static unsigned         StartOutputSize;
+
+/* Pragmas found while precompiling (StrBuf*) */
+static Collection       Pragmas = STATIC_COLLECTION_INITIALIZER;
+
+/* Symbol tables, symbols and function descriptors in file order */
+static Collection       Tabs    = STATIC_COLLECTION_INITIALIZER;
+static Collection       Entries = STATIC_COLLECTION_INITIALIZER;
+static Collection       Funcs   = STATIC_COLLECTION_INITIALIZER;
+
+/* Hash table mapping the objects written to their index */
+static ObjRef*          RefTab  = 0;
+static unsigned         RefSize = 0;
+static unsigned         RefCount = 0;
+
+/* File written */
+static FILE*            F = 0;
+
+/* Contents of the file read */
+static const char*      RName;          /* Name of the file */
+static unsigned char*   RBuf;           /* File contents */
+static const unsigned char* RPos;       /* Read position */
+static const unsigned char* REnd;       /* End of file contents */
+
+
+
+/*****************************************************************************/
+/*                        Reading and writing helpers                        */
+/*****************************************************************************/
+
+
+
+static void PrecompWriteError (void)
+/* Called on a write error. Will try to close and remove the file, then
+** print a fatal error.
+*/
+{
+    /* Remember the error */
+    int Error = errno;
+
+    /* Force a close of the file, ignoring errors */
+    fclose (F);
+
+    /* Try to remove the file, also ignoring errors */
+    remove (OutputFilename);
+
+    /* Now abort with a fatal error */
+    Fatal ("Cannot write to output file '%s': %s", OutputFilename, strerror (Error));
+}
+
+
+
+static void PrecompCorrupt (void)
+/* Called if the precompiled header read is damaged */
+{
+    Fatal ("Precompiled header '%s' is corrupt", RName);
+}
+
+
+
+static void PrecompWrite8 (unsigned V)
+/* Write an 8 bit value to the precompiled header */
+{
+    if (putc (V & 0xFF, F) == EOF) {
+        PrecompWriteError ();
+    }
+}
+
+
+
+static void PrecompWriteVar (unsigned long V)
+/* Write a variable sized value to the precompiled header */
+{
+    /* Use the same encoding as the object files: 7 bit chunks with the 8th
+    ** bit set if another chunk follows.
+    */
+    do {
+        unsigned char C = (V & 0x7F);
+        V >>= 7;
+        if (V) {
+            C |= 0x80;
+        }
+        PrecompWrite8 (C);
+    } while (V != 0);
+}
+
+
+
+static void PrecompWriteVal (long V)
+/* Write a signed value to the precompiled header */
+{
+    /* Move the sign into bit 0, so small negative values stay short */
+    if (V < 0) {
+        PrecompWriteVar ((((unsigned long) -(V + 1)) << 1) | 1UL);
+    } else {
+        PrecompWriteVar (((unsigned long) V) << 1);
+    }
+}
+
+
+
+static void PrecompWriteBuf (const char* S, unsigned Len)
+/* Write a string with the given length to the precompiled header */
+{
+    PrecompWriteVar (Len);
+    if (Len > 0 && fwrite (S, 1, Len, F) != Len) {
+        PrecompWriteError ();
+    }
+}
+
+
+
+static void PrecompWriteStr (const char* S)
+/* Write a zero terminated string to the precompiled header */
+{
+    PrecompWriteBuf (S, strlen (S));
+}
+
+
+
+static unsigned PrecompRead8 (void)
+/* Read an 8 bit value from the precompiled header */
+{
+    if (RPos >= REnd) {
+        PrecompCorrupt ();
+    }
+    return *RPos++;
+}
+
+
+
+static unsigned long PrecompReadVar (void)
+/* Read a variable sized value from the precompiled header */
+{
+    unsigned long V = 0;
+    unsigned Shift = 0;
+    unsigned char C;
+    do {
+        C = PrecompRead8 ();
+        V |= ((unsigned long) (C & 0x7F)) << Shift;
+        Shift += 7;
+    } while (C & 0x80);
+    return V;
+}
+
+
+
+static long PrecompReadVal (void)
+/* Read a signed value from the precompiled header */
+{
+    unsigned long V = PrecompReadVar ();
+    if (V & 1UL) {
+        return -(long) (V >> 1) - 1;
+    } else {
+        return (long) (V >> 1);
+    }
+}
+
+
+
+static void PrecompReadStr (StrBuf* S)
+/* Read a string from the precompiled header */
+{
+    unsigned long Len = PrecompReadVar ();
+    if (Len > (unsigned long) (REnd - RPos)) {
+        PrecompCorrupt ();
+    }
+    SB_CopyBuf (S, (const char*) RPos, Len);
+    SB_Terminate (S);
+    RPos += Len;
+}
+
+
+
+/*****************************************************************************/
+/*                                  Macros                                   */
+/*****************************************************************************/
+
+
+
+static int IsVisibleMacro (Macro* M)
+/* Return true if M is the macro found by its name and is not one of the
+** macros that change with every compilation.
+*/
+{
+    return FindMacro (M->Name) == M                &&
+           strcmp (M->Name, "__DATE__") != 0       &&
+           strcmp (M->Name, "__TIME__") != 0;
+}
+
+
+
+static void CollectVisibleMacros (Collection* Macros)
+/* Add all visible macros to the given collection */
+{
+    Collection All = AUTO_COLLECTION_INITIALIZER;
+    unsigned I;
+
+    CollectMacros (&All);
+    for (I = 0; I < CollCount (&All); ++I) {
+        Macro* M = CollAt (&All, I);
+        if (IsVisibleMacro (M)) {
+            CollAppend (Macros, M);
+        }
+    }
+    DoneCollection (&All);
+}
+
+
+
+static int SameMacro (const Macro* M1, const Macro* M2)
+/* Return true if both macros are identical */
+{
+    return M1->Variadic == M2->Variadic && MacroCmp (M1, M2) == 0;
+}
+
+
+
+static Macro* DupMacro (const Macro* M)
+/* Return a copy of the given macro */
+{
+    Macro* D = NewMacro (M->Name);
+    if (M->ArgCount >= 0) {
+        unsigned I;
+        D->ArgCount = 0;
+        for (I = 0; I < CollCount (&M->FormalArgs); ++I) {
+            AddMacroArg (D, CollConstAt (&M->FormalArgs, I));
+        }
+    }
+    D->Variadic = M->Variadic;
+    SB_Copy (&D->Replacement, &M->Replacement);
+    SB_Terminate (&D->Replacement);
+    return D;
+}
+
+
+
+static const Macro* FindPredefined (const char* Name)
+/* Return the macro with the given name that existed before the main file */
+{
+    unsigned I;
+    for (I = 0; I < CollCount (&Predefined); ++I) {
+        const Macro* M = CollConstAt (&Predefined, I);
+        if (strcmp (M->Name, Name) == 0) {
+            return M;
+        }
+    }
+    return 0;
+}
+
+
+
+static void WriteMacro (const Macro* M)
+/* Write one macro to the precompiled header */
+{
+    unsigned I;
+    PrecompWriteStr (M->Name);
+    PrecompWriteVal (M->ArgCount);
+    PrecompWrite8 (M->Variadic);
+    PrecompWriteVar (CollCount (&M->FormalArgs));
+    for (I = 0; I < CollCount (&M->FormalArgs); ++I) {
+        PrecompWriteStr (CollConstAt (&M->FormalArgs, I));
+    }
+    PrecompWriteBuf (SB_GetConstBuf (&M->Replacement),
+                     SB_GetLen (&M->Replacement));
+}
+
+
+
+static Macro* ReadMacro (void)
+/* Read one macro from the precompiled header and return it */
+{
+    StrBuf Buf = STATIC_STRBUF_INITIALIZER;
+    unsigned long Count, I;
+    long ArgCount;
+    Macro* M;
+
+    PrecompReadStr (&Buf);
+    M = NewMacro (SB_GetConstBuf (&Buf));
+    ArgCount = PrecompReadVal ();
+    M->Variadic = (unsigned char) PrecompRead8 ();
+    Count = PrecompReadVar ();
+    if (ArgCount < -1 || Count != (unsigned long) (ArgCount < 0? 0 : ArgCount)) {
+        PrecompCorrupt ();
+    }
+    if (ArgCount >= 0) {
+        M->ArgCount = 0;
+        for (I = 0; I < Count; ++I) {
+            PrecompReadStr (&Buf);
+            AddMacroArg (M, SB_GetConstBuf (&Buf));
+        }
+    }
+    PrecompReadStr (&M->Replacement);
+
+    SB_Done (&Buf);
+    return M;
+}
+
+
+
+static void WritePredefinedMacros (void)
+/* Write the macros the precompiled header depends on */
+{
+    unsigned I;
+    PrecompWriteVar (CollCount (&Predefined));
+    for (I = 0; I < CollCount (&Predefined); ++I) {
+        WriteMacro (CollConstAt (&Predefined, I));
+    }
+}
+
+
+
+static void WriteMacros (void)
+/* Write the macros defined and undefined by the main file */
+{
+    Collection Macros = AUTO_COLLECTION_INITIALIZER;
+    Collection Undefs = AUTO_COLLECTION_INITIALIZER;
+    Collection Defs   = AUTO_COLLECTION_INITIALIZER;
+    unsigned I;
+
+    /* Predefined macros that were removed */
+    for (I = 0; I < CollCount (&Predefined); ++I) {
+        const Macro* P = CollConstAt (&Predefined, I);
+        if (FindMacro (P->Name) == 0) {
+            CollAppend (&Undefs, (void*) P);
+        }
+    }
+    PrecompWriteVar (CollCount (&Undefs));
+    for (I = 0; I < CollCount (&Undefs); ++I) {
+        PrecompWriteStr (((const Macro*) CollConstAt (&Undefs, I))->Name);
+    }
+
+    /* New and changed macros */
+    CollectVisibleMacros (&Macros);
+    for (I = 0; I < CollCount (&Macros); ++I) {
+        Macro* M = CollAt (&Macros, I);
+        const Macro* P = FindPredefined (M->Name);
+        if (P == 0 || !SameMacro (P, M)) {
+            CollAppend (&Defs, M);
+        }
+    }
+    PrecompWriteVar (CollCount (&Defs));
+    for (I = 0; I < CollCount (&Defs); ++I) {
+        WriteMacro (CollConstAt (&Defs, I));
+    }
+
+    DoneCollection (&Defs);
+    DoneCollection (&Undefs);
+    DoneCollection (&Macros);
+}
+
+
+
+static void ReadMacros (void)
+/* Read the macros defined and undefined by the precompiled header */
+{
+    StrBuf Name = STATIC_STRBUF_INITIALIZER;
+    unsigned long Count, I;
+
+    Count = PrecompReadVar ();
+    for (I = 0; I < Count; ++I) {
+        PrecompReadStr (&Name);
+        UndefineMacro (SB_GetConstBuf (&Name));
+    }
+
+    Count = PrecompReadVar ();
+    for (I = 0; I < Count; ++I) {
+        Macro* M = ReadMacro ();
+        UndefineMacro (M->Name);
+        InsertMacro (M);
+    }
+
+    SB_Done (&Name);
+}
+
+
+
+/*****************************************************************************/
+/*                               Symbol tables                               */
+/*****************************************************************************/
+
+
+
+static unsigned HashObj (const void* Obj)
+/* Return a hash value for the given object address */
+{
+    size_t A = (size_t) Obj;
+    return (unsigned) ((A >> 3) ^ (A >> 11));
+}
+
+
+
+static int FindRef (const void* Obj, unsigned* Index)
+/* Search for Obj in the reference table. If found, return true and its index
+** in Index.
+*/
+{
+    if (RefSize > 0) {
+        unsigned H = HashObj (Obj) & (RefSize - 1);
+        while (RefTab[H].Obj) {
+            if (RefTab[H].Obj == Obj) {
+                *Index = RefTab[H].Index;
+                return 1;
+            }
+            H = (H + 1) & (RefSize - 1);
+        }
+    }
+    return 0;
+}
+
+
+
+static void InsertRef (const void* Obj, unsigned Index)
+/* Insert an object that is not in the reference table */
+{
+    unsigned H;
+
+    /* Keep the table at most half full */
+    if (2 * (RefCount + 1) > RefSize) {
+        ObjRef*  Old     = RefTab;
+        unsigned OldSize = RefSize;
+        unsigned I;
+        RefSize = (RefSize == 0)? 256 : RefSize * 2;
+        RefTab  = xmalloc (RefSize * sizeof (ObjRef));
+        memset (RefTab, 0, RefSize * sizeof (ObjRef));
+        RefCount = 0;
+        for (I = 0; I < OldSize; ++I) {
+            if (Old[I].Obj) {
+                InsertRef (Old[I].Obj, Old[I].Index);
+            }
+        }
+        xfree (Old);
+    }
+
+    H = HashObj (Obj) & (RefSize - 1);
+    while (RefTab[H].Obj) {
+        H = (H + 1) & (RefSize - 1);
+    }
+    RefTab[H].Obj   = Obj;
+    RefTab[H].Index = Index;
+    ++RefCount;
+}
+
+
+
+static void AddRef (const void* Obj, Collection* C)
+/* Add Obj to C if it is not NULL and wasn't seen before */
+{
+    unsigned Index;
+    if (Obj != 0 && !FindRef (Obj, &Index)) {
+        InsertRef (Obj, CollCount (C));
+        CollAppend (C, (void*) Obj);
+    }
+}
+
+
+
+static unsigned GetRef (const void* Obj)
+/* Return the index of an object that was collected */
+{
+    unsigned Index;
+    if (!FindRef (Obj, &Index)) {
+        Internal ("Object missing in precompiled header");
+    }
+    return Index;
+}
+
+
+
+static unsigned SymDataKind (unsigned Flags)
+/* Return the kind of data in the V union of a symbol with the given flags */
+{
+    if (Flags & SC_ALIAS) {
+        return SD_ALIAS;
+    }
+    switch (Flags & SC_TYPEMASK) {
+        case SC_STRUCT:
+        case SC_UNION:
+            return SD_STRUCT;
+        case SC_ENUM:
+            return SD_ENUM;
+        case SC_BITFIELD:
+            return SD_BITFIELD;
+    }
+    if (Flags & SC_CONST) {
+        return SD_CONST;
+    }
+    if (Flags & SC_FUNC) {
+        return SD_FUNC;
+    }
+    if (Flags & SC_REGISTER) {
+        return SD_REGISTER;
+    }
+    return SD_OFFS;
+}
+
+
+
+static void MarkTab (const SymTable* T)
+/* Add a symbol table to the objects written */
+{
+    if (T != &EmptySymTab) {
+        AddRef (T, &Tabs);
+    }
+}
+
+
+
+static void MarkEntry (const SymEntry* E)
+/* Make sure the symbol table containing E is written */
+{
+    if (E) {
+        MarkTab (E->Owner);
+    }
+}
+
+
+
+static void MarkType (const Type* T)
+/* Add the objects referenced by a type string */
+{
+    if (T) {
+        for (; T->C != T_END; ++T) {
+            switch (T->C & T_MASK_TYPE) {
+                case T_TYPE_STRUCT:
+                case T_TYPE_UNION:
+                case T_TYPE_ENUM:
+                    MarkEntry (T->A.P);
+                    break;
+                case T_TYPE_FUNC:
+                    AddRef (T->A.P, &Funcs);
+                    break;
+            }
+        }
+    }
+}
+
+
+
+static void ScanTab (const SymTable* T)
+/* Collect the symbols of a table and the objects they reference */
+{
+    const SymEntry* E;
+
+    MarkTab (T->PrevTab);
+    for (E = T->SymHead; E; E = E->NextSym) {
+        AddRef (E, &Entries);
+        MarkType (E->Type);
+        switch (SymDataKind (E->Flags)) {
+            case SD_ALIAS:
+                MarkEntry (E->V.A.Field);
+                break;
+            case SD_STRUCT:
+                MarkTab (E->V.S.SymTab);
+                break;
+            case SD_ENUM:
+                MarkTab (E->V.E.SymTab);
+                MarkType (E->V.E.Type);
+                break;
+        }
+    }
+}
+
+
+
+static void ScanFunc (const FuncDesc* D)
+/* Collect the objects referenced by a function descriptor */
+{
+    MarkTab (D->SymTab);
+    MarkTab (D->TagTab);
+    MarkEntry (D->LastParam);
+    MarkEntry (D->WrappedCall);
+    AddRef (D->FuncDef, &Funcs);
+}
+
+
+
+static void CollectObjects (void)
+/* Collect everything reachable from the global symbol tables */
+{
+    unsigned T = 0;
+    unsigned D = 0;
+
+    MarkTab (GetGlobalSymTab ());
+    MarkTab (GetGlobalTagTab ());
+    while (T < CollCount (&Tabs) || D < CollCount (&Funcs)) {
+        if (T < CollCount (&Tabs)) {
+            ScanTab (CollConstAt (&Tabs, T++));
+        } else {
+            ScanFunc (CollConstAt (&Funcs, D++));
+        }
+    }
+}
+
+
+
+static void WriteTabRef (const SymTable* T)
+/* Write a reference to a symbol table */
+{
+    if (T == 0) {
+        PrecompWriteVar (0);
+    } else if (T == &EmptySymTab) {
+        PrecompWriteVar (1);
+    } else {
+        PrecompWriteVar (GetRef (T) + 2);
+    }
+}
+
+
+
+static void WriteObjRef (const void* Obj)
+/* Write a reference to a symbol or function descriptor */
+{
+    PrecompWriteVar (Obj? GetRef (Obj) + 1 : 0);
+}
+
+
+
+static void WriteType (const Type* T)
+/* Write an optional type string */
+{
+    unsigned I, Len;
+
+    if (T == 0) {
+        PrecompWriteVar (0);
+        return;
+    }
+    Len = TypeLen (T);
+    PrecompWriteVar (Len + 1);
+    for (I = 0; I < Len; ++I) {
+        PrecompWriteVar (T[I].C);
+        switch (T[I].C & T_MASK_TYPE) {
+            case T_TYPE_STRUCT:
+            case T_TYPE_UNION:
+            case T_TYPE_ENUM:
+            case T_TYPE_FUNC:
+                WriteObjRef (T[I].A.P);
+                break;
+            default:
+                PrecompWriteVal (T[I].A.L);
+                break;
+        }
+    }
+}
+
+
+
+static void WriteEntry (const SymEntry* E)
+/* Write the data of a symbol table entry */
+{
+    unsigned I, Count;
+
+    WriteType (E->Type);
+    if (E->AsmName) {
+        PrecompWrite8 (1);
+        PrecompWriteStr (E->AsmName);
+    } else {
+        PrecompWrite8 (0);
+    }
+    Count = E->Attr? CollCount (E->Attr) : 0;
+    PrecompWriteVar (Count);
+    for (I = 0; I < Count; ++I) {
+        PrecompWriteVar (((const DeclAttr*) CollConstAt (E->Attr, I))->AttrType);
+    }
+
+    switch (SymDataKind (E->Flags)) {
+        case SD_ALIAS:
+            PrecompWriteVal (E->V.A.Offs);
+            PrecompWriteVar (E->V.A.ANumber);
+            WriteObjRef (E->V.A.Field);
+            break;
+        case SD_STRUCT:
+            WriteTabRef (E->V.S.SymTab);
+            PrecompWriteVar (E->V.S.Size);
+            PrecompWriteVar (E->V.S.ACount);
+            break;
+        case SD_ENUM:
+            WriteTabRef (E->V.E.SymTab);
+            WriteType (E->V.E.Type);
+            break;
+        case SD_BITFIELD:
+            PrecompWriteVar (E->V.B.Offs);
+            PrecompWriteVar (E->V.B.BitOffs);
+            PrecompWriteVar (E->V.B.BitWidth);
+            break;
+        case SD_CONST:
+            PrecompWriteVal (E->V.ConstVal);
+            break;
+        case SD_REGISTER:
+            PrecompWriteVal (E->V.R.RegOffs);
+            PrecompWriteVal (E->V.R.SaveOffs);
+            break;
+        case SD_FUNC:
+            /* Segments and literal pool exist only for definitions */
+            break;
+        default:
+            PrecompWriteVal (E->V.Offs);
+            break;
+    }
+}
+
+
+
+static void WriteFunc (const FuncDesc* D)
+/* Write a function descriptor */
+{
+    PrecompWriteVar (D->Flags);
+    WriteTabRef (D->SymTab);
+    WriteTabRef (D->TagTab);
+    PrecompWriteVar (D->ParamCount);
+    PrecompWriteVar (D->ParamSize);
+    WriteObjRef (D->LastParam);
+    WriteObjRef (D->FuncDef);
+    WriteObjRef (D->WrappedCall);
+    PrecompWrite8 (D->WrappedCallData);
+}
+
+
+
+static void WriteSymbols (void)
+/* Write the symbol tables */
+{
+    const SymEntry* E;
+    unsigned I, Count;
+
+    /* Tables and the names of their symbols */
+    PrecompWriteVar (CollCount (&Tabs));
+    for (I = 0; I < CollCount (&Tabs); ++I) {
+        const SymTable* T = CollConstAt (&Tabs, I);
+        PrecompWriteVar (T->Size);
+        for (Count = 0, E = T->SymHead; E; E = E->NextSym) {
+            ++Count;
+        }
+        PrecompWriteVar (Count);
+        for (E = T->SymHead; E; E = E->NextSym) {
+            PrecompWriteStr (E->Name);
+            PrecompWriteVar (E->Flags);
+        }
+    }
+    PrecompWriteVar (CollCount (&Funcs));
+
+    /* Links between the objects */
+    for (I = 0; I < CollCount (&Tabs); ++I) {
+        WriteTabRef (((const SymTable*) CollConstAt (&Tabs, I))->PrevTab);
+    }
+    for (I = 0; I < CollCount (&Entries); ++I) {
+        WriteEntry (CollConstAt (&Entries, I));
+    }
+    for (I = 0; I < CollCount (&Funcs); ++I) {
+        WriteFunc (CollConstAt (&Funcs, I));
+    }
+}
+
+
+
+static SymTable* ReadTabRef (void)
+/* Read a reference to a symbol table */
+{
+    unsigned long Ref = PrecompReadVar ();
+    if (Ref == 0) {
+        return 0;
+    } else if (Ref == 1) {
+        return &EmptySymTab;
+    } else if (Ref - 2 >= CollCount (&Tabs)) {
+        PrecompCorrupt ();
+    }
+    return CollAt (&Tabs, Ref - 2);
+}
+
+
+
+static void* ReadObjRef (Collection* C)
+/* Read a reference to an object in C */
+{
+    unsigned long Ref = PrecompReadVar ();
+    if (Ref == 0) {
+        return 0;
+    } else if (Ref > CollCount (C)) {
+        PrecompCorrupt ();
+    }
+    return CollAt (C, Ref - 1);
+}
+
+
+
+static Type* ReadType (void)
+/* Read an optional type string */
+{
+    unsigned long I, Len;
+    Type* T;
+
+    Len = PrecompReadVar ();
+    if (Len == 0) {
+        return 0;
+    }
+    if (--Len > (unsigned long) (REnd - RPos)) {
+        PrecompCorrupt ();
+    }
+    T = TypeAlloc (Len + 1);
+    for (I = 0; I < Len; ++I) {
+        T[I].C = PrecompReadVar ();
+        switch (T[I].C & T_MASK_TYPE) {
+            case T_TYPE_STRUCT:
+            case T_TYPE_UNION:
+            case T_TYPE_ENUM:
+                T[I].A.P = ReadObjRef (&Entries);
+                break;
+            case T_TYPE_FUNC:
+                T[I].A.P = ReadObjRef (&Funcs);
+                break;
+            default:
+                T[I].A.L = PrecompReadVal ();
+                break;
+        }
+    }
+    T[Len].C   = T_END;
+    T[Len].A.L = 0;
+    return T;
+}
+
+
+
+static void ReadEntry (SymEntry* E)
+/* Read the data of a symbol table entry */
+{
+    StrBuf Buf = STATIC_STRBUF_INITIALIZER;
+    unsigned long I, Count;
+
+    E->Type = ReadType ();
+    if (PrecompRead8 ()) {
+        PrecompReadStr (&Buf);
+        E->AsmName = xstrdup (SB_GetConstBuf (&Buf));
+    }
+    Count = PrecompReadVar ();
+    if (Count > 0) {
+        E->Attr = NewCollection ();
+        for (I = 0; I < Count; ++I) {
+            DeclAttr* A = xmalloc (sizeof (DeclAttr));
+            A->AttrType = (DeclAttrType) PrecompReadVar ();
+            CollAppend (E->Attr, A);
+        }
+    }
+
+    switch (SymDataKind (E->Flags)) {
+        case SD_ALIAS:
+            E->V.A.Offs    = PrecompReadVal ();
+            E->V.A.ANumber = PrecompReadVar ();
+            E->V.A.Field   = ReadObjRef (&Entries);
+            break;
+        case SD_STRUCT:
+            E->V.S.SymTab  = ReadTabRef ();
+            E->V.S.Size    = PrecompReadVar ();
+            E->V.S.ACount  = PrecompReadVar ();
+            break;
+        case SD_ENUM:
+            E->V.E.SymTab  = ReadTabRef ();
+            E->V.E.Type    = ReadType ();
+            break;
+        case SD_BITFIELD:
+            E->V.B.Offs     = PrecompReadVar ();
+            E->V.B.BitOffs  = PrecompReadVar ();
+            E->V.B.BitWidth = PrecompReadVar ();
+            break;
+        case SD_CONST:
+            E->V.ConstVal  = PrecompReadVal ();
+            break;
+        case SD_REGISTER:
+            E->V.R.RegOffs  = PrecompReadVal ();
+            E->V.R.SaveOffs = PrecompReadVal ();
+            break;
+        case SD_FUNC:
+            E->V.F.Seg     = 0;
+            E->V.F.LitPool = 0;
+            break;
+        default:
+            E->V.Offs      = PrecompReadVal ();
+            break;
+    }
+
+    SB_Done (&Buf);
+}
+
+
+
+static void ReadFunc (FuncDesc* D)
+/* Read a function descriptor */
+{
+    D->Flags           = PrecompReadVar ();
+    D->SymTab          = ReadTabRef ();
+    D->TagTab          = ReadTabRef ();
+    D->ParamCount      = PrecompReadVar ();
+    D->ParamSize       = PrecompReadVar ();
+    D->LastParam       = ReadObjRef (&Entries);
+    D->FuncDef         = ReadObjRef (&Funcs);
+    D->WrappedCall     = ReadObjRef (&Entries);
+    D->WrappedCallData = (unsigned char) PrecompRead8 ();
+}
+
+
+
+static void ReadSymbols (void)
+/* Read the symbol tables and add them to the global ones */
+{
+    StrBuf Name = STATIC_STRBUF_INITIALIZER;
+    unsigned long TabCount, Count, I, J;
+
+    /* Tables and their symbols. The first two are the global symbol and tag
+    ** tables.
+    */
+    TabCount = PrecompReadVar ();
+    if (TabCount < 2) {
+        PrecompCorrupt ();
+    }
+    for (I = 0; I < TabCount; ++I) {
+        SymTable* T;
+        unsigned long Size = PrecompReadVar ();
+        if (Size == 0 || Size > 0xFFFF) {
+            PrecompCorrupt ();
+        }
+        if (I == 0) {
+            T = GetGlobalSymTab ();
+        } else if (I == 1) {
+            T = GetGlobalTagTab ();
+        } else {
+            T = NewSymTable (Size);
+        }
+        CollAppend (&Tabs, T);
+        Count = PrecompReadVar ();
+        for (J = 0; J < Count; ++J) {
+            SymEntry* E;
+            PrecompReadStr (&Name);
+            E = NewSymEntry (SB_GetConstBuf (&Name), PrecompReadVar ());
+            AddSymEntry (T, E);
+            CollAppend (&Entries, E);
+        }
+    }
+    Count = PrecompReadVar ();
+    for (I = 0; I < Count; ++I) {
+        CollAppend (&Funcs, NewFuncDesc ());
+    }
+
+    /* Links between the objects */
+    for (I = 0; I < TabCount; ++I) {
+        SymTable* Prev = ReadTabRef ();
+        if (I >= 2) {
+            ((SymTable*) CollAt (&Tabs, I))->PrevTab = Prev;
+        }
+    }
+    for (I = 0; I < CollCount (&Entries); ++I) {
+        ReadEntry (CollAt (&Entries, I));
+    }
+    for (I = 0; I < CollCount (&Funcs); ++I) {
+        ReadFunc (CollAt (&Funcs, I));
+    }
+
+    SB_Done (&Name);
+}
+
+
+
+static void DoneObjects (void)
+/* Forget the objects written or read */
+{
+    CollDeleteAll (&Tabs);
+    CollDeleteAll (&Entries);
+    CollDeleteAll (&Funcs);
+    xfree (RefTab);
+    RefTab   = 0;
+    RefSize  = 0;
+    RefCount = 0;
+}
+
+
+
+/*****************************************************************************/
+/*                              Writing the file                             */
+/*****************************************************************************/
+
+
+
+static unsigned GetFingerprint (unsigned char* Buf)
+/* Put the settings a precompiled header depends on into Buf and return the
+** number of bytes used.
+*/
+{
+    Buf[0] = (unsigned char) Target;
+    Buf[1] = (unsigned char) CPU;
+    Buf[2] = (unsigned char) MemoryModel;
+    Buf[3] = (unsigned char) IS_Get (&Standard);
+    Buf[4] = (unsigned char) IS_Get (&SignedChars);
+    return FINGERPRINT_SIZE;
+}
+
+
+
+static unsigned OutputSize (void)
+/* Return a measure for the output generated so far */
+{
+    return CollCount (&GS->Text->Lines)   +
+           CS_GetEntryCount (GS->Code)    +
+           CollCount (&GS->Data->Lines)   +
+           CollCount (&GS->ROData->Lines) +
+           CollCount (&GS->BSS->Lines);
+}
+
+
+
+static void CheckContents (void)
+/* Check if the main file can be precompiled */
+{
+    const SymEntry* E;
+
+    /* Loading the precompiled header cannot recreate any output */
+    if (OutputSize () != StartOutputSize) {
+        Error ("Precompiled headers must not generate code or data");
+    }
+
+    /* Since the output is missing, there must be no definitions */
+    for (E = GetGlobalSymTab ()->SymHead; E; E = E->NextSym) {
+        if ((E->Flags & SC_FUNC) != 0 && SymIsDef (E)) {
+            Error ("Function definition '%s' cannot be precompiled", E->Name);
+        } else if ((E->Flags & SC_STORAGE) != 0) {
+            Error ("Definition of '%s' cannot be precompiled", E->Name);
+        }
+    }
+}
+
+
+
+static void WriteHeader (void)
+/* Write the header, the source files and the macros the file depends on */
+{
+    unsigned char FP[FINGERPRINT_SIZE];
+    unsigned I, Count;
+
+    /* Magic and version */
+    PrecompWrite8 (PRECOMP_MAGIC & 0xFF);
+    PrecompWrite8 ((PRECOMP_MAGIC >> 8) & 0xFF);
+    PrecompWrite8 ((PRECOMP_MAGIC >> 16) & 0xFF);
+    PrecompWrite8 ((PRECOMP_MAGIC >> 24) & 0xFF);
+    PrecompWriteVar (PRECOMP_VERSION);
+
+    /* Compiler settings */
+    Count = GetFingerprint (FP);
+    PrecompWriteVar (Count);
+    for (I = 0; I < Count; ++I) {
+        PrecompWrite8 (FP[I]);
+    }
+
+    /* Source files */
+    Count = GetInputFileCount ();
+    PrecompWriteVar (Count);
+    for (I = 0; I < Count; ++I) {
+        const char* Name;
+        const char* Guard;
+        unsigned long Size, MTime;
+        InputType Type;
+        int Once;
+        GetInputFileInfo (I, &Name, &Size, &MTime);
+        GetInputFileState (I, &Type, &Guard, &Once);
+        PrecompWriteStr (Name);
+        PrecompWriteVar (Type);
+        PrecompWriteVar (Size);
+        PrecompWriteVar (MTime);
+        if (Guard) {
+            PrecompWrite8 (1);
+            PrecompWriteStr (Guard);
+        } else {
+            PrecompWrite8 (0);
+        }
+        PrecompWrite8 (Once);
+    }
+
+    /* Macros that existed before the main file */
+    WritePredefinedMacros ();
+}
+
+
+
+static void WriteCounters (void)
+/* Write the counters used to create unique names and labels */
+{
+    PrecompWriteVar (GetAnonNameCount ());
+    PrecompWriteVar (GetPooledLiteralLabelCount ());
+    PrecompWriteVar (GS->NextLabel);
+    PrecompWriteVar (GS->NextDataLabel);
+}
+
+
+
+static void WriteLiterals (void)
+/* Write the literals found in the main file. They are never used, but they
+** change the order of the literal pool output.
+*/
+{
+    Collection Literals = AUTO_COLLECTION_INITIALIZER;
+    unsigned I, Writable;
+
+    for (Writable = 0; Writable <= 1; ++Writable) {
+        CollectGlobalLiterals (&Literals, Writable);
+        PrecompWriteVar (CollCount (&Literals));
+        for (I = 0; I < CollCount (&Literals); ++I) {
+            const Literal* L = CollConstAt (&Literals, I);
+            const StrBuf* S = GetLiteralStrBuf (L);
+            PrecompWriteVar (GetLiteralLabel (L));
+            PrecompWriteBuf (SB_GetConstBuf (S), SB_GetLen (S));
+        }
+        CollDeleteAll (&Literals);
+    }
+
+    DoneCollection (&Literals);
+}
+
+
+
+static void WritePragmas (void)
+/* Write the pragmas found in the main file */
+{
+    unsigned I;
+    PrecompWriteVar (CollCount (&Pragmas));
+    for (I = 0; I < CollCount (&Pragmas); ++I) {
+        const StrBuf* S = CollConstAt (&Pragmas, I);
+        PrecompWriteBuf (SB_GetConstBuf (S), SB_GetLen (S));
+    }
+}
+
+
+
+/*****************************************************************************/
+/*                              Reading the file                             */
+/*****************************************************************************/
+
+
+
+static unsigned char* ReadWholeFile (const char* Name, size_t* Size)
+/* Read the given file into memory and return it. Return NULL if the file
+** cannot be opened.
+*/
+{
+    unsigned char* Buf = 0;
+    size_t Avail = 0;
+    size_t Len = 0;
+    FILE* RF = fopen (Name, "rb");
+    if (RF == 0) {
+        return 0;
+    }
+    while (1) {
+        if (Len == Avail) {
+            Avail = (Avail == 0)? 4096 : Avail * 2;
+            Buf = xrealloc (Buf, Avail);
+        }
+        Len += fread (Buf + Len, 1, Avail - Len, RF);
+        if (Len < Avail) {
+            break;
+        }
+    }
+    if (ferror (RF)) {
+        Fatal ("Cannot read from precompiled header '%s': %s",
+               Name, strerror (errno));
+    }
+    (void) fclose (RF);
+    *Size = Len;
+    return Buf;
+}
+
+
+
+static int OutOfDate (const char* Format, ...)
+/* Tell the user why the precompiled header cannot be used and return false */
+{
+    StrBuf Reason = STATIC_STRBUF_INITIALIZER;
+    va_list ap;
+
+    va_start (ap, Format);
+    SB_VPrintf (&Reason, Format, ap);
+    va_end (ap);
+
+    Print (stdout, 1, "Precompiled header '%s' not used: %s\n",
+           RName, SB_GetConstBuf (&Reason));
+
+    SB_Done (&Reason);
+    return 0;
+}
+
+
+
+static int MatchingFile (const char* Name, unsigned long Size,
+                         unsigned long MTime)
+/* Return true if the file with the given name exists and has the given size
+** and modification time.
+*/
+{
+    struct stat Buf;
+    return FileStat (Name, &Buf) == 0                   &&
+           (unsigned long) Buf.st_size == Size          &&
+           (unsigned long) Buf.st_mtime == MTime;
+}
+
+
+
+static int CheckMacros (void)
+/* Check that the macros defined before the header are the same as when it
+** was precompiled.
+*/
+{
+    Collection Macros = AUTO_COLLECTION_INITIALIZER;
+    unsigned long Count, I;
+    int Ok = 1;
+
+    /* All macros stored must exist with the same definition */
+    CollectVisibleMacros (&Macros);
+    Count = PrecompReadVar ();
+    for (I = 0; I < Count; ++I) {
+        Macro* M = ReadMacro ();
+        if (Ok) {
+            Macro* Cur = FindMacro (M->Name);
+            if (Cur == 0 || !IsVisibleMacro (Cur) || !SameMacro (M, Cur)) {
+                Ok = OutOfDate ("Macro '%s' differs", M->Name);
+            } else {
+                /* Remove it from the list of current macros */
+                CollDeleteItem (&Macros, Cur);
+            }
+        }
+        FreeMacro (M);
+    }
+
+    /* There must be no other macros */
+    if (Ok && CollCount (&Macros) > 0) {
+        Ok = OutOfDate ("Macro '%s' differs",
+                        ((const Macro*) CollConstAt (&Macros, 0))->Name);
+    }
+
+    DoneCollection (&Macros);
+    return Ok;
+}
+
+
+
+static int CheckHeader (const char* Path, Collection* Files)
+/* Read and check the header, files and macros the precompiled header depends
+** on. Return true if it is usable. The source files are stored in Files.
+*/
+{
+    StrBuf Name  = STATIC_STRBUF_INITIALIZER;
+    StrBuf Guard = STATIC_STRBUF_INITIALIZER;
+    unsigned char FP[FINGERPRINT_SIZE];
+    unsigned long Magic, Count, I;
+    SrcFile* SF;
+    int Ok = 0;
+
+    /* Check magic and version */
+    if (REnd - RPos < 4) {
+        return OutOfDate ("Not a precompiled header");
+    }
+    Magic  = PrecompRead8 ();
+    Magic |= PrecompRead8 () << 8;
+    Magic |= ((unsigned long) PrecompRead8 ()) << 16;
+    Magic |= ((unsigned long) PrecompRead8 ()) << 24;
+    if (Magic != PRECOMP_MAGIC) {
+        return OutOfDate ("Not a precompiled header");
+    }
+    if (PrecompReadVar () != PRECOMP_VERSION) {
+        return OutOfDate ("Version mismatch");
+    }
+
+    /* Check the settings */
+    Count = PrecompReadVar ();
+    if (Count != GetFingerprint (FP)) {
+        return OutOfDate ("Compiler options differ");
+    }
+    for (I = 0; I < Count; ++I) {
+        if (PrecompRead8 () != FP[I]) {
+            return OutOfDate ("Compiler options differ");
+        }
+    }
+
+    /* Check the source files. The name of the header itself may differ. */
+    Count = PrecompReadVar ();
+    if (Count == 0) {
+        PrecompCorrupt ();
+    }
+    for (I = 0; I < Count; ++I) {
+        unsigned long Type, Size, MTime;
+        const char* FName;
+        int HasGuard, Once;
+        PrecompReadStr (&Name);
+        Type  = PrecompReadVar ();
+        Size  = PrecompReadVar ();
+        MTime = PrecompReadVar ();
+        HasGuard = PrecompRead8 ();
+        if (HasGuard) {
+            PrecompReadStr (&Guard);
+        }
+        Once = PrecompRead8 ();
+        FName = (I == 0)? Path : SB_GetConstBuf (&Name);
+        if (!MatchingFile (FName, Size, MTime)) {
+            OutOfDate ("File '%s' has changed", FName);
+            goto ExitPoint;
+        }
+        SF = xmalloc (sizeof (SrcFile));
+        SF->Name  = xstrdup (FName);
+        SF->Type  = (I == 0)? IT_USRINC : (InputType) Type;
+        SF->Size  = Size;
+        SF->MTime = MTime;
+        SF->Guard = HasGuard? xstrdup (SB_GetConstBuf (&Guard)) : 0;
+        SF->Once  = Once;
+        CollAppend (Files, SF);
+    }
+
+    /* Check the macros */
+    Ok = CheckMacros ();
+
+ExitPoint:
+    SB_Done (&Guard);
+    SB_Done (&Name);
+    return Ok;
+}
+
+
+
+static void ReadFiles (const Collection* Files)
+/* Add the source files to the list of input files */
+{
+    unsigned I;
+    for (I = 0; I < CollCount (Files); ++I) {
+        const SrcFile* SF = CollConstAt (Files, I);
+        AddInputFile (SF->Name, SF->Type, SF->Size, SF->MTime, SF->Guard, SF->Once);
+    }
+}
+
+
+
+static void ReadCounters (void)
+/* Read the counters used to create unique names and labels */
+{
+    SetAnonNameCount (PrecompReadVar ());
+    SetPooledLiteralLabelCount (PrecompReadVar ());
+    GS->NextLabel     = PrecompReadVar ();
+    GS->NextDataLabel = PrecompReadVar ();
+}
+
+
+
+static void ReadLiterals (void)
+/* Read the literals of the precompiled header */
+{
+    StrBuf Data = STATIC_STRBUF_INITIALIZER;
+    unsigned long Count, I;
+    unsigned Writable;
+
+    for (Writable = 0; Writable <= 1; ++Writable) {
+        Count = PrecompReadVar ();
+        for (I = 0; I < Count; ++I) {
+            unsigned Label = PrecompReadVar ();
+            PrecompReadStr (&Data);
+            AddGlobalLiteral (&Data, Label, Writable);
+        }
+    }
+
+    SB_Done (&Data);
+}
+
+
+
+static void ReadPragmas (void)
+/* Read the pragmas of the precompiled header and apply them */
+{
+    StrBuf Text = STATIC_STRBUF_INITIALIZER;
+    unsigned long Count, I;
+
+    Count = PrecompReadVar ();
+    for (I = 0; I < Count; ++I) {
+        PrecompReadStr (&Text);
+        ApplyPragma (&Text);
+    }
+
+    SB_Done (&Text);
+}
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void PrecompPragma (const StrBuf* Text)
+/* Remember a pragma found while precompiling, so it can be repeated when the
+** precompiled header is loaded.
+*/
+{
+    StrBuf* S = NewStrBuf ();
+    SB_Append (S, Text);
+    CollAppend (&Pragmas, S);
+}
+
+
+
+void PrecompStart (void)
+/* Remember the state before the main file, which is precompiled */
+{
+    Collection Macros = AUTO_COLLECTION_INITIALIZER;
+    unsigned I;
+
+    /* Remember the macros defined on the command line and by the compiler */
+    CollectVisibleMacros (&Macros);
+    for (I = 0; I < CollCount (&Macros); ++I) {
+        CollAppend (&Predefined, DupMacro (CollConstAt (&Macros, I)));
+    }
+    DoneCollection (&Macros);
+
+    /* Remember the output generated so far */
+    StartOutputSize = OutputSize ();
+}
+
+
+
+void PrecompDone (void)
+/* Check the state after compiling the main file and write the precompiled
+** header.
+*/
+{
+    /* Check if the file can be precompiled */
+    CheckContents ();
+
+    if (ErrorCount == 0) {
+
+        /* Create the output file */
+        F = fopen (OutputFilename, "wb");
+        if (F == 0) {
+            Fatal ("Cannot open output file '%s': %s", OutputFilename, strerror (errno));
+        }
+
+        /* Write the data */
+        CollectObjects ();
+        WriteHeader ();
+        WriteCounters ();
+        WriteLiterals ();
+        WriteSymbols ();
+        WriteMacros ();
+        WritePragmas ();
+        DoneObjects ();
+
+        /* Close the file */
+        if (fclose (F) != 0) {
+            PrecompWriteError ();
+        }
+        F = 0;
+
+        Print (stdout, 1, "Wrote precompiled header to '%s'\n", OutputFilename);
+    }
+}
+
+
+
+int PrecompLoad (const char* Name)
+/* Load the precompiled version of the prefix header with the given name if
+** there is one that is up to date. Return true if this was successful, and
+** false if the header must be read.
+*/
+{
+    Collection Files = AUTO_COLLECTION_INITIALIZER;
+    char*      PName;
+    size_t     Size;
+    unsigned   I;
+    int        Ok = 0;
+
+    /* Precompiled headers are not used when creating one, or if the
+    ** preprocessor output is requested.
+    */
+    if (Precompile || PreprocessOnly) {
+        return 0;
+    }
+
+    /* Read the precompiled header if there is one */
+    PName = MakeFilename (Name, PRECOMP_EXT);
+    RBuf = ReadWholeFile (PName, &Size);
+    if (RBuf != 0) {
+
+        RName = PName;
+        RPos  = RBuf;
+        REnd  = RBuf + Size;
+
+        /* If it is up to date, create its contents */
+        if (CheckHeader (Name, &Files)) {
+            ReadFiles (&Files);
+            ReadCounters ();
+            ReadLiterals ();
+            ReadSymbols ();
+            ReadMacros ();
+            ReadPragmas ();
+            if (RPos != REnd) {
+                PrecompCorrupt ();
+            }
+            DoneObjects ();
+            Print (stdout, 1, "Loaded precompiled header '%s'\n", PName);
+            Ok = 1;
+        }
+
+        /* Free the file data */
+        for (I = 0; I < CollCount (&Files); ++I) {
+            SrcFile* SF = CollAt (&Files, I);
+            xfree (SF->Name);
+            xfree (SF->Guard);
+            xfree (SF);
+        }
+        xfree (RBuf);
+        RBuf = 0;
+    }
+
+    /* Free the names */
+    DoneCollection (&Files);
+    xfree (PName);
+
+    /* Return the result */
+    return Ok;
+}
@@ -0,0 +1,83 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                 precomp.h                                 */
+/*                                                                           */
+/*                Precompiled headers for the cc65 C compiler                */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#ifndef PRECOMP_H
+#define PRECOMP_H
+
+
+
+/* common */
+#include "strbuf.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Default extension for precompiled headers */
+#define PRECOMP_EXT     ".pch"
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void PrecompPragma (const StrBuf* Text);
+/* Remember a pragma found while precompiling, so it can be repeated when the
+** precompiled header is loaded.
+*/
+
+void PrecompStart (void);
+/* Remember the state before the main file, which is precompiled */
+
+void PrecompDone (void);
+/* Check the state after compiling the main file and write the precompiled
+** header.
+*/
+
+int PrecompLoad (const char* Name);
+/* Load the precompiled version of the prefix header with the given name if
+** there is one that is up to date. Return true if this was successful, and
+** false if the header must be read.
+*/
+
+
+
+/* End of precomp.h */
+
+#endif
@@ -86,6 +86,7 @@ static StrBuf* MLine;
 typedef struct MacroExp MacroExp;
 struct MacroExp {
     Collection  ActualArgs;     /* Actual arguments */
+    Collection  ExpandedArgs;   /* Macro replaced actuals, created on demand */
     StrBuf      Replacement;    /* Replacement with arguments substituted */
     Macro*      M;              /* The macro we're handling */
 };
@@ -189,6 +190,7 @@ static MacroExp* InitMacroExp (MacroExp* E, Macro* M)
 /* Initialize a MacroExp structure */
 {
     InitCollection (&E->ActualArgs);
+    InitCollection (&E->ExpandedArgs);
     SB_Init (&E->Replacement);
     E->M = M;
     return E;
@@ -206,6 +208,13 @@ static void DoneMacroExp (MacroExp* E)
         FreeStrBuf (CollAtUnchecked (&E->ActualArgs, I));
     }
     DoneCollection (&E->ActualArgs);
+    for (I = 0; I < CollCount (&E->ExpandedArgs); ++I) {
+        StrBuf* A = CollAtUnchecked (&E->ExpandedArgs, I);
+        if (A) {
+            FreeStrBuf (A);
+        }
+    }
+    DoneCollection (&E->ExpandedArgs);
     SB_Done (&E->Replacement);
 }
 
@@ -222,8 +231,11 @@ static void ME_AppendActual (MacroExp* E, StrBuf* Arg)
     /* Move the contents of Arg to A */
     SB_Move (A, Arg);
 
-    /* Add A to the actual arguments */
+    /* Add A to the actual arguments. The macro replaced version is created
+    ** when it is needed first.
+    */
     CollAppend (&E->ActualArgs, A);
+    CollAppend (&E->ExpandedArgs, 0);
 }
 
 
@@ -236,6 +248,42 @@ static StrBuf* ME_GetActual (MacroExp* E, unsigned Index)
 
 
 
+static void AppendExpansion (StrBuf* Target, const StrBuf* Exp)
+/* Append the macro replaced text Exp to Target. A leading blank is squeezed
+** the same way MacroReplacement does it.
+*/
+{
+    const char* Buf = SB_GetConstBuf (Exp);
+    unsigned    Len = SB_GetLen (Exp);
+
+    if (Len > 0 && IsSpace (Buf[0]) && IsSpace (SB_LookAtLast (Target))) {
+        ++Buf;
+        --Len;
+    }
+    SB_AppendBuf (Target, Buf, Len);
+}
+
+
+
+static void ME_AppendExpanded (MacroExp* E, unsigned Index, StrBuf* Target)
+/* Append the macro replaced actual argument with the given index to Target.
+** Each argument is replaced only once, no matter how often the parameter is
+** used in the replacement list.
+*/
+{
+    StrBuf* Exp = CollAt (&E->ExpandedArgs, Index);
+    if (Exp == 0) {
+        StrBuf* Arg = ME_GetActual (E, Index);
+        Exp = NewStrBuf ();
+        SB_Reset (Arg);
+        MacroReplacement (Arg, Exp);
+        CollReplace (&E->ExpandedArgs, Exp, Index);
+    }
+    AppendExpansion (Target, Exp);
+}
+
+
+
 static int ME_ArgIsVariadic (const MacroExp* E)
 /* Return true if the next actual argument we will add is a variadic one */
 {
@@ -508,63 +556,65 @@ static void ReadMacroArgs (MacroExp* E)
 
 
 
-static void MacroArgSubst (MacroExp* E)
-/* Argument substitution according to ISO/IEC 9899:1999 (E), 6.10.3.1ff */
+static StrBuf* TextTok (Macro* M)
+/* Return the text of the last token of M if it is a text token. Otherwise
+** add a new text token and return its text.
+*/
+{
+    unsigned Count = CollCount (&M->Tokens);
+    MacroTok* T = Count? CollAtUnchecked (&M->Tokens, Count - 1) : 0;
+    if (T == 0 || T->Type != MT_TEXT) {
+        T = AddMacroTok (M, MT_TEXT, -1);
+    }
+    return &T->Text;
+}
+
+
+
+static void TokenizeMacro (Macro* M)
+/* Split the replacement list of a macro into text and parameter tokens, so
+** expanding the macro doesn't have to rescan and search the formal arguments
+** over and over.
+*/
 {
     ident       Ident;
     int         ArgIdx;
+    int         HaveIdents;
+    unsigned    I;
     StrBuf*     OldSource;
-    StrBuf*     Arg;
-    int         HaveSpace;
 
 
     /* Remember the current input and switch to the macro replacement. */
-    int OldIndex = SB_GetIndex (&E->M->Replacement);
-    SB_Reset (&E->M->Replacement);
-    OldSource = InitLine (&E->M->Replacement);
+    int OldIndex = SB_GetIndex (&M->Replacement);
+    SB_Reset (&M->Replacement);
+    OldSource = InitLine (&M->Replacement);
 
-    /* Argument handling loop */
+    /* Tokenizing loop */
+    HaveIdents = 0;
     while (CurC != '\0') {
 
-        /* If we have an identifier, check if it's a macro */
+        /* If we have an identifier, check if it's a macro argument */
         if (IsSym (Ident)) {
 
-            /* Check if it's a macro argument */
-            if ((ArgIdx = FindMacroArg (E->M, Ident)) >= 0) {
+            if ((ArgIdx = FindMacroArg (M, Ident)) >= 0) {
 
-                /* A macro argument. Get the corresponding actual argument. */
-                Arg = ME_GetActual (E, ArgIdx);
-
-                /* Copy any following whitespace */
-                HaveSpace = SkipWhitespace (0);
+                /* Skip any following whitespace */
+                int HaveSpace = SkipWhitespace (0);
 
                 /* If a ## operator follows, we have to insert the actual
                 ** argument as is, otherwise it must be macro replaced.
                 */
                 if (CurC == '#' && NextC == '#') {
-
-                    /* ### Add placemarker if necessary */
-                    SB_Append (&E->Replacement, Arg);
-
+                    AddMacroTok (M, MT_PARAM_RAW, ArgIdx);
                 } else {
-
-                    /* Replace the formal argument by a macro replaced copy
-                    ** of the actual.
-                    */
-                    SB_Reset (Arg);
-                    MacroReplacement (Arg, &E->Replacement);
-
-                    /* If we skipped whitespace before, re-add it now */
-                    if (HaveSpace) {
-                        SB_AppendChar (&E->Replacement, ' ');
-                    }
+                    AddMacroTok (M, MT_PARAM, ArgIdx)->Space = HaveSpace;
                 }
 
-
             } else {
 
                 /* An identifier, keep it */
-                SB_AppendStr (&E->Replacement, Ident);
+                SB_AppendStr (TextTok (M), Ident);
+                HaveIdents = 1;
 
             }
 
@@ -574,69 +624,132 @@ static void MacroArgSubst (MacroExp* E)
             NextChar ();
             NextChar ();
             SkipWhitespace (0);
-
-            /* Since we need to concatenate the token sequences, remove
-            ** any whitespace that was added to target, since it must come
-            ** from the input.
-            */
-            while (IsSpace (SB_LookAtLast (&E->Replacement))) {
-                SB_Drop (&E->Replacement, 1);
-            }
+            AddMacroTok (M, MT_PASTE, -1);
 
             /* If the next token is an identifier which is a macro argument,
-            ** replace it, otherwise do nothing.
+            ** it is inserted as is, otherwise do nothing.
             */
             if (IsSym (Ident)) {
-
-                /* Check if it's a macro argument */
-                if ((ArgIdx = FindMacroArg (E->M, Ident)) >= 0) {
-
-                    /* Get the corresponding actual argument and add it. */
-                    SB_Append (&E->Replacement, ME_GetActual (E, ArgIdx));
-
+                if ((ArgIdx = FindMacroArg (M, Ident)) >= 0) {
+                    AddMacroTok (M, MT_PARAM_RAW, ArgIdx);
                 } else {
-
-                    /* Just an ordinary identifier - add as is */
-                    SB_AppendStr (&E->Replacement, Ident);
-
+                    SB_AppendStr (TextTok (M), Ident);
+                    HaveIdents = 1;
                 }
             }
 
-        } else if (CurC == '#' && E->M->ArgCount >= 0) {
+        } else if (CurC == '#' && M->ArgCount >= 0) {
 
-            /* A # operator within a macro expansion of a function like
-            ** macro. Read the following identifier and check if it's a
-            ** macro parameter.
+            /* A # operator within a function like macro. Read the following
+            ** identifier and check if it's a macro parameter.
             */
             NextChar ();
             SkipWhitespace (0);
-            if (!IsSym (Ident) || (ArgIdx = FindMacroArg (E->M, Ident)) < 0) {
-                PPError ("'#' is not followed by a macro parameter");
+            if (!IsSym (Ident) || (ArgIdx = FindMacroArg (M, Ident)) < 0) {
+                AddMacroTok (M, MT_BAD_STRINGIZE, -1);
             } else {
-                /* Make a valid string from Replacement */
-                Arg = ME_GetActual (E, ArgIdx);
-                SB_Reset (Arg);
-                Stringize (Arg, &E->Replacement);
+                AddMacroTok (M, MT_STRINGIZE, ArgIdx);
             }
 
         } else if (IsQuote (CurC)) {
-            CopyQuotedString (&E->Replacement);
+            CopyQuotedString (TextTok (M));
         } else {
-            SB_AppendChar (&E->Replacement, CurC);
+            SB_AppendChar (TextTok (M), CurC);
             NextChar ();
         }
     }
 
-#if 0
-    /* Remove whitespace from the end of the line */
-    while (IsSpace (SB_LookAtLast (&E->Replacement))) {
-        SB_Drop (&E->Replacement, 1);
-    }
-#endif
-
     /* Switch back the input */
     InitLine (OldSource);
-    SB_SetIndex (&E->M->Replacement, OldIndex);
+    SB_SetIndex (&M->Replacement, OldIndex);
+
+    /* An object like macro that consists of text only will always expand to
+    ** the same text. Do the replacement once and remember the result.
+    */
+    M->Plain = (M->ArgCount < 0 && !HaveIdents);
+    for (I = 0; I < CollCount (&M->Tokens); ++I) {
+        if (((const MacroTok*) CollConstAt (&M->Tokens, I))->Type != MT_TEXT) {
+            M->Plain = 0;
+        }
+    }
+    if (M->Plain && CollCount (&M->Tokens) > 0) {
+        MacroTok* T = CollAtUnchecked (&M->Tokens, 0);
+        StrBuf Text = AUTO_STRBUF_INITIALIZER;
+        SB_Move (&Text, &T->Text);
+        SB_Reset (&Text);
+        MacroReplacement (&Text, &T->Text);
+        SB_Done (&Text);
+    }
+
+    M->Tokenized = 1;
+}
+
+
+
+static void MacroArgSubst (MacroExp* E)
+/* Argument substitution according to ISO/IEC 9899:1999 (E), 6.10.3.1ff */
+{
+    unsigned    I;
+    StrBuf*     Arg;
+    Macro*      M = E->M;
+
+
+    /* Split the replacement list into tokens if not already done */
+    if (!M->Tokenized) {
+        TokenizeMacro (M);
+    }
+
+    /* Substitute the arguments */
+    for (I = 0; I < CollCount (&M->Tokens); ++I) {
+
+        const MacroTok* T = CollConstAt (&M->Tokens, I);
+
+        switch (T->Type) {
+
+            case MT_TEXT:
+                SB_Append (&E->Replacement, &T->Text);
+                break;
+
+            case MT_PARAM:
+                /* Replace the formal argument by a macro replaced copy of
+                ** the actual. If we skipped whitespace before, re-add it.
+                */
+                ME_AppendExpanded (E, T->Arg, &E->Replacement);
+                if (T->Space) {
+                    SB_AppendChar (&E->Replacement, ' ');
+                }
+                break;
+
+            case MT_PARAM_RAW:
+                /* ### Add placemarker if necessary */
+                SB_Append (&E->Replacement, ME_GetActual (E, T->Arg));
+                break;
+
+            case MT_PASTE:
+                /* Since we need to concatenate the token sequences, remove
+                ** any whitespace that was added to target, since it must come
+                ** from the input.
+                */
+                while (IsSpace (SB_LookAtLast (&E->Replacement))) {
+                    SB_Drop (&E->Replacement, 1);
+                }
+                break;
+
+            case MT_STRINGIZE:
+                /* Make a valid string from the actual argument */
+                Arg = ME_GetActual (E, T->Arg);
+                SB_Reset (Arg);
+                Stringize (Arg, &E->Replacement);
+                break;
+
+            case MT_BAD_STRINGIZE:
+                PPError ("'#' is not followed by a macro parameter");
+                break;
+
+            default:
+                Internal ("Invalid macro token type: %d", T->Type);
+        }
+    }
 }
 
 
@@ -711,6 +824,21 @@ static void ExpandMacro (StrBuf* Target, Macro* M)
     } else {
 
         MacroExp E;
+
+        /* Plain text macros have their final expansion stored as the only
+        ** token, so there is nothing to substitute or rescan.
+        */
+        if (!M->Tokenized) {
+            TokenizeMacro (M);
+        }
+        if (M->Plain) {
+            if (CollCount (&M->Tokens) > 0) {
+                AppendExpansion (Target,
+                                 &((const MacroTok*) CollConstAt (&M->Tokens, 0))->Text);
+            }
+            return;
+        }
+
         InitMacroExp (&E, M);
 
         /* Handle # and ## operators for object like macros */
@@ -1001,6 +1129,20 @@ static void PreprocessLine (void)
 
 
 
+static int IsBlankLine (const StrBuf* L)
+/* Return true if the remainder of the line contains only white space */
+{
+    unsigned I;
+    for (I = SB_GetIndex (L); I < SB_GetLen (L); ++I) {
+        if (!IsSpace (SB_AtUnchecked (L, I))) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+
+
 static int PushIf (int Skip, int Invert, int Cond)
 /* Push a new if level onto the if stack */
 {
@@ -1098,8 +1240,10 @@ static int DoIfDef (int skip, int flag)
 
     SkipWhitespace (0);
     if (MacName (Ident) == 0) {
+        TrackIncludeGuard (GL_OTHER, IfIndex, 0);
         return 0;
     } else {
+        TrackIncludeGuard (flag? GL_OTHER : GL_IFNDEF, IfIndex, Ident);
         return PushIf (skip, flag, IsMacro(Ident));
     }
 }
@@ -1181,6 +1325,13 @@ static void DoPragma (void)
     SB_Clear (MLine);
     Pass1 (Line, MLine);
 
+    /* #pragma once is handled here, since it's about the input file */
+    if (SB_CompareStr (MLine, "once") == 0) {
+        MarkFileOnce ();
+        ClearLine ();
+        return;
+    }
+
     /* Convert the directive into the operator */
     SB_CopyStr (Line, "_Pragma (");
     SB_Reset (MLine);
@@ -1250,18 +1401,21 @@ void Preprocess (void)
                 continue;
             }
             if (!IsSym (Directive)) {
+                TrackIncludeGuard (GL_OTHER, IfIndex, 0);
                 PPError ("Preprocessor directive expected");
                 ClearLine ();
             } else {
                 switch (FindPPToken (Directive)) {
 
                     case PP_DEFINE:
+                        TrackIncludeGuard (GL_OTHER, IfIndex, 0);
                         if (!Skip) {
                             DefineMacro ();
                         }
                         break;
 
                     case PP_ELIF:
+                        TrackIncludeGuard (GL_OTHER, IfIndex - 1, 0);
                         if (IfIndex >= 0) {
                             if ((IfStack[IfIndex] & IFCOND_ELSE) == 0) {
 
@@ -1283,6 +1437,7 @@ void Preprocess (void)
                         break;
 
                     case PP_ELSE:
+                        TrackIncludeGuard (GL_OTHER, IfIndex - 1, 0);
                         if (IfIndex >= 0) {
                             if ((IfStack[IfIndex] & IFCOND_ELSE) == 0) {
                                 if ((IfStack[IfIndex] & IFCOND_SKIP) == 0) {
@@ -1311,18 +1466,21 @@ void Preprocess (void)
 
                             /* Remove the clause that needs a terminator */
                             Skip = (IfStack[IfIndex--] & IFCOND_SKIP) != 0;
+                            TrackIncludeGuard (GL_ENDIF, IfIndex, 0);
                         } else {
                             PPError ("Unexpected '#endif'");
                         }
                         break;
 
                     case PP_ERROR:
+                        TrackIncludeGuard (GL_OTHER, IfIndex, 0);
                         if (!Skip) {
                             DoError ();
                         }
                         break;
 
                     case PP_IF:
+                        TrackIncludeGuard (GL_OTHER, IfIndex, 0);
                         Skip = DoIf (Skip);
                         break;
 
@@ -1335,12 +1493,14 @@ void Preprocess (void)
                         break;
 
                     case PP_INCLUDE:
+                        TrackIncludeGuard (GL_OTHER, IfIndex, 0);
                         if (!Skip) {
                             DoInclude ();
                         }
                         break;
 
                     case PP_LINE:
+                        TrackIncludeGuard (GL_OTHER, IfIndex, 0);
                         /* Should do something in C99 at least, but we ignore it */
                         if (!Skip) {
                             ClearLine ();
@@ -1348,6 +1508,7 @@ void Preprocess (void)
                         break;
 
                     case PP_PRAGMA:
+                        TrackIncludeGuard (GL_OTHER, IfIndex, 0);
                         if (!Skip) {
                             DoPragma ();
                             goto Done;
@@ -1355,12 +1516,14 @@ void Preprocess (void)
                         break;
 
                     case PP_UNDEF:
+                        TrackIncludeGuard (GL_OTHER, IfIndex, 0);
                         if (!Skip) {
                             DoUndef ();
                         }
                         break;
 
                     case PP_WARNING:
+                        TrackIncludeGuard (GL_OTHER, IfIndex, 0);
                         /* #warning is a non standard extension */
                         if (IS_Get (&Standard) > STD_C99) {
                             if (!Skip) {
@@ -1375,6 +1538,7 @@ void Preprocess (void)
                         break;
 
                     default:
+                        TrackIncludeGuard (GL_OTHER, IfIndex, 0);
                         if (!Skip) {
                             PPError ("Preprocessor directive expected");
                         }
@@ -1394,6 +1558,11 @@ void Preprocess (void)
 
     PreprocessLine ();
 
+    /* Lines that contain only comments don't count for the include guard */
+    if (!IsBlankLine (Line)) {
+        TrackIncludeGuard (GL_OTHER, IfIndex, 0);
+    }
+
 Done:
     if (Verbosity > 1 && SB_NotEmpty (Line)) {
         printf ("%s(%u): %.*s\n", GetCurrentFile (), GetCurrentLine (),
@@ -0,0 +1,461 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                 profile.c                                 */
+/*                                                                           */
+/*                 Use of an execution profile of the program                */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+/* common */
+#include "coll.h"
+#include "intstack.h"
+#include "xmalloc.h"
+
+/* cc65 */
+#include "codeent.h"
+#include "codeseg.h"
+#include "error.h"
+#include "global.h"
+#include "profile.h"
+#include "scanner.h"
+#include "segments.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* The profile is written by sim65 with --profile. See there for the format.
+** Functions are classified by the cycles spent in their own code: The most
+** expensive functions that together take PF_HOT_SHARE percent of the cycles
+** of all C functions are hot, functions that were never called are cold.
+*/
+#define PF_HOT_SHARE    90              /* Percentage of cycles in hot code */
+#define PF_HOT_FACTOR   200             /* Minimum code size factor if hot */
+#define PF_COLD_FACTOR  50              /* Maximum code size factor if cold */
+
+/* Classification of a function */
+enum {
+    PF_WARM,
+    PF_HOT,
+    PF_COLD
+};
+
+/* A C function in the profile */
+typedef struct PFFunc PFFunc;
+struct PFFunc {
+    char*               Name;           /* C name of the function */
+    unsigned            File;           /* Index of the source file */
+    unsigned long       Calls;          /* Number of calls */
+    unsigned long       Cycles;         /* Cycles spent in the function */
+    int                 Heat;           /* Classification */
+};
+
+/* A C source line in the profile */
+typedef struct PFLine PFLine;
+struct PFLine {
+    unsigned            File;           /* Index of the source file */
+    unsigned            Line;           /* Line number */
+    unsigned long       Count;          /* Executions of the line */
+    unsigned long       Taken;          /* Conditional branches taken */
+    unsigned long       NotTaken;       /* Conditional branches not taken */
+};
+
+/* The profile data */
+static int              Loaded  = 0;
+static Collection       Files   = STATIC_COLLECTION_INITIALIZER;
+static Collection       Funcs   = STATIC_COLLECTION_INITIALIZER;
+static Collection       Lines   = STATIC_COLLECTION_INITIALIZER;
+
+/* True if PF_FuncStart has pushed a code size factor */
+static int              Pushed  = 0;
+
+
+
+/*****************************************************************************/
+/*                             Helper functions                              */
+/*****************************************************************************/
+
+
+
+static int FindFile (const char* Name, unsigned* Index)
+/* Search for a source file. Return true and its index if it is found */
+{
+    unsigned I;
+    for (I = 0; I < CollCount (&Files); ++I) {
+        if (strcmp (CollConstAt (&Files, I), Name) == 0) {
+            *Index = I;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+
+
+static unsigned GetFile (const char* Name)
+/* Return the index of a source file, adding it if needed */
+{
+    unsigned Index;
+    if (!FindFile (Name, &Index)) {
+        Index = CollCount (&Files);
+        CollAppend (&Files, xstrdup (Name));
+    }
+    return Index;
+}
+
+
+
+static PFFunc* FindFunc (const char* Name, unsigned File)
+/* Search for a function */
+{
+    unsigned I;
+    for (I = 0; I < CollCount (&Funcs); ++I) {
+        PFFunc* F = CollAtUnchecked (&Funcs, I);
+        if (F->File == File && strcmp (F->Name, Name) == 0) {
+            return F;
+        }
+    }
+    return 0;
+}
+
+
+
+static int CmpLine (const PFLine* L, unsigned File, unsigned Line)
+/* Compare a line record with a file and line number */
+{
+    if (L->File != File) {
+        return (L->File < File)? -1 : 1;
+    } else if (L->Line != Line) {
+        return (L->Line < Line)? -1 : 1;
+    }
+    return 0;
+}
+
+
+
+static int CmpLines (void* Data attribute ((unused)),
+                     const void* A, const void* B)
+/* Compare function for sorting the line records */
+{
+    const PFLine* L = B;
+    return CmpLine (A, L->File, L->Line);
+}
+
+
+
+static int CmpFuncCycles (void* Data attribute ((unused)),
+                          const void* A, const void* B)
+/* Compare function for sorting functions by descending cycles */
+{
+    unsigned long CA = ((const PFFunc*) A)->Cycles;
+    unsigned long CB = ((const PFFunc*) B)->Cycles;
+    return (CA > CB)? -1 : (CA < CB)? 1 : 0;
+}
+
+
+
+static const PFLine* FindLine (const LineInfo* LI)
+/* Search for the record of the line with the given line info */
+{
+    unsigned File;
+    unsigned Line = GetInputLine (LI);
+    int Lo, Hi;
+
+    if (!FindFile (GetInputName (LI), &File)) {
+        return 0;
+    }
+
+    /* Binary search in the sorted records */
+    Lo = 0;
+    Hi = (int) CollCount (&Lines) - 1;
+    while (Lo <= Hi) {
+        int Cur = (Lo + Hi) / 2;
+        const PFLine* L = CollConstAt (&Lines, Cur);
+        int Res = CmpLine (L, File, Line);
+        if (Res < 0) {
+            Lo = Cur + 1;
+        } else if (Res > 0) {
+            Hi = Cur - 1;
+        } else {
+            return L;
+        }
+    }
+    return 0;
+}
+
+
+
+static char* GetRest (char* S)
+/* Return the rest of a record line without the trailing newline */
+{
+    S += strspn (S, " \t");
+    S[strcspn (S, "\r\n")] = '\0';
+    return S;
+}
+
+
+
+static void ReadProfile (const char* Name)
+/* Read the execution profile of the program */
+{
+    char            Line[512];
+    char            Kind[16];
+    char            FuncName[256];
+    unsigned        LineNum = 0;
+    unsigned long   Calls, Cycles, Count, Taken, NotTaken, Total;
+    unsigned        Num;
+    int             Pos;
+    Collection      Sorted = AUTO_COLLECTION_INITIALIZER;
+    unsigned        I, J;
+
+    /* Open the file */
+    FILE* F = fopen (Name, "r");
+    if (F == 0) {
+        Fatal ("Cannot open profile '%s': %s", Name, strerror (errno));
+    }
+
+    /* Read the records */
+    while (fgets (Line, sizeof (Line), F) != 0) {
+
+        ++LineNum;
+        if (sscanf (Line, "%15s", Kind) != 1) {
+            /* Empty line */
+            continue;
+        }
+
+        if (strcmp (Kind, "total") == 0) {
+            /* Not needed */
+        } else if (strcmp (Kind, "func") == 0) {
+            PFFunc* Func;
+            unsigned File;
+            Pos = 0;
+            if (sscanf (Line, "%*s %lu %lu %255s %n", &Calls, &Cycles, FuncName, &Pos) != 3 ||
+                Pos == 0) {
+                Fatal ("%s(%u): Invalid function record", Name, LineNum);
+            }
+            File = GetFile (GetRest (Line + Pos));
+            Func = FindFunc (FuncName, File);
+            if (Func == 0) {
+                /* A static function in a header may appear more than once */
+                Func = xmalloc (sizeof (PFFunc));
+                Func->Name   = xstrdup (FuncName);
+                Func->File   = File;
+                Func->Calls  = 0;
+                Func->Cycles = 0;
+                Func->Heat   = PF_WARM;
+                CollAppend (&Funcs, Func);
+            }
+            Func->Calls  += Calls;
+            Func->Cycles += Cycles;
+        } else if (strcmp (Kind, "line") == 0) {
+            PFLine* L;
+            Pos = 0;
+            if (sscanf (Line, "%*s %lu %lu %lu %u %n", &Count, &Taken, &NotTaken, &Num, &Pos) != 4 ||
+                Pos == 0) {
+                Fatal ("%s(%u): Invalid line record", Name, LineNum);
+            }
+            L = xmalloc (sizeof (PFLine));
+            L->File     = GetFile (GetRest (Line + Pos));
+            L->Line     = Num;
+            L->Count    = Count;
+            L->Taken    = Taken;
+            L->NotTaken = NotTaken;
+            CollAppend (&Lines, L);
+        } else {
+            Fatal ("%s(%u): Unknown record '%s'", Name, LineNum, Kind);
+        }
+    }
+    (void) fclose (F);
+
+    /* Sort the lines and combine the records for the same line */
+    CollSort (&Lines, CmpLines, 0);
+    J = 0;
+    for (I = 0; I < CollCount (&Lines); ++I) {
+        PFLine* L = CollAtUnchecked (&Lines, I);
+        PFLine* Last = (J > 0)? CollAtUnchecked (&Lines, J - 1) : 0;
+        if (Last && CmpLine (Last, L->File, L->Line) == 0) {
+            if (L->Count > Last->Count) {
+                Last->Count = L->Count;
+            }
+            Last->Taken    += L->Taken;
+            Last->NotTaken += L->NotTaken;
+            xfree (L);
+        } else {
+            CollReplace (&Lines, L, J++);
+        }
+    }
+    while (CollCount (&Lines) > J) {
+        CollPop (&Lines);
+    }
+
+    /* Classify the functions */
+    Total = 0;
+    for (I = 0; I < CollCount (&Funcs); ++I) {
+        PFFunc* Func = CollAtUnchecked (&Funcs, I);
+        Total += Func->Cycles;
+        if (Func->Calls == 0) {
+            Func->Heat = PF_COLD;
+        }
+        CollAppend (&Sorted, Func);
+    }
+    CollSort (&Sorted, CmpFuncCycles, 0);
+    Cycles = 0;
+    for (I = 0; I < CollCount (&Sorted); ++I) {
+        PFFunc* Func = CollAtUnchecked (&Sorted, I);
+        if (Func->Cycles == 0 || Cycles >= Total / 100 * PF_HOT_SHARE) {
+            break;
+        }
+        Func->Heat = PF_HOT;
+        Cycles += Func->Cycles;
+    }
+    DoneCollection (&Sorted);
+
+    Loaded = 1;
+}
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void PF_Init (void)
+/* Read the execution profile given with --profile-use if there is one */
+{
+    if (SB_NotEmpty (&ProfileName)) {
+        ReadProfile (SB_GetConstBuf (&ProfileName));
+    }
+}
+
+
+
+int PF_HaveProfile (void)
+/* Return true if an execution profile was read */
+{
+    return Loaded;
+}
+
+
+
+void PF_FuncStart (const SymEntry* Func)
+/* Set the code size factor for a function from its share of the execution
+** time. Must be called before the segments of the function are created.
+*/
+{
+    const PFFunc* F;
+    unsigned      File;
+    long          Factor;
+
+    Pushed = 0;
+    if (!Loaded || IS_IsFull (&CodeSizeFactor) ||
+        !FindFile (GetInputName (CurTok.LI), &File) ||
+        (F = FindFunc (Func->Name, File)) == 0) {
+        return;
+    }
+
+    /* Hot functions are optimized for speed, cold ones for size */
+    Factor = IS_Get (&CodeSizeFactor);
+    if (F->Heat == PF_HOT && Factor < PF_HOT_FACTOR) {
+        Factor = PF_HOT_FACTOR;
+    } else if (F->Heat == PF_COLD && Factor > PF_COLD_FACTOR) {
+        Factor = PF_COLD_FACTOR;
+    }
+    IS_Push (&CodeSizeFactor, Factor);
+    Pushed = 1;
+}
+
+
+
+void PF_FuncEnd (void)
+/* Restore the code size factor at the end of a function */
+{
+    if (Pushed) {
+        IS_Drop (&CodeSizeFactor);
+        Pushed = 0;
+    }
+}
+
+
+
+int PF_GetCodeCount (const CodeMark* Start, const CodeMark* End,
+                     const LineInfo* Skip, unsigned long* Count)
+/* Get the execution count of the code between Start and End. This is the
+** count of the first line in the range the profile knows about, skipping
+** code of the line Skip. Return false if the count is unknown.
+*/
+{
+    unsigned I;
+
+    if (!Loaded) {
+        return 0;
+    }
+
+    for (I = Start->Pos; I < End->Pos; ++I) {
+        const CodeEntry* E = CS_GetEntry (CS->Code, I);
+        const PFLine* L;
+        if (E->LI == 0) {
+            continue;
+        }
+        if (Skip && GetInputLine (E->LI) == GetInputLine (Skip) &&
+            strcmp (GetInputName (E->LI), GetInputName (Skip)) == 0) {
+            continue;
+        }
+        if ((L = FindLine (E->LI)) != 0) {
+            *Count = L->Count;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+
+
+int PF_GetBranchCounts (const LineInfo* LI, unsigned long* Taken,
+                        unsigned long* NotTaken)
+/* Get the number of conditional branches in the code of the given line that
+** were taken and not taken. Return false if the counts are unknown.
+*/
+{
+    const PFLine* L;
+
+    if (!Loaded || (L = FindLine (LI)) == 0 || L->Taken + L->NotTaken == 0) {
+        return 0;
+    }
+    *Taken    = L->Taken;
+    *NotTaken = L->NotTaken;
+    return 1;
+}
@@ -0,0 +1,82 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                 profile.h                                 */
+/*                                                                           */
+/*                 Use of an execution profile of the program                */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#ifndef PROFILE_H
+#define PROFILE_H
+
+
+
+/* cc65 */
+#include "asmcode.h"
+#include "lineinfo.h"
+#include "symentry.h"
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void PF_Init (void);
+/* Read the execution profile given with --profile-use if there is one */
+
+int PF_HaveProfile (void);
+/* Return true if an execution profile was read */
+
+void PF_FuncStart (const SymEntry* Func);
+/* Set the code size factor for a function from its share of the execution
+** time. Must be called before the segments of the function are created.
+*/
+
+void PF_FuncEnd (void);
+/* Restore the code size factor at the end of a function */
+
+int PF_GetCodeCount (const CodeMark* Start, const CodeMark* End,
+                     const LineInfo* Skip, unsigned long* Count);
+/* Get the execution count of the code between Start and End. This is the
+** count of the first line in the range the profile knows about, skipping
+** code of the line Skip. Return false if the count is unknown.
+*/
+
+int PF_GetBranchCounts (const LineInfo* LI, unsigned long* Taken,
+                        unsigned long* NotTaken);
+/* Get the number of conditional branches in the code of the given line that
+** were taken and not taken. Return false if the counts are unknown.
+*/
+
+
+
+/* End of profile.h */
+
+#endif
@@ -0,0 +1,656 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                 regvars.c                                 */
+/*                                                                           */
+/*            Automatic placement of local variables in registers            */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#include <string.h>
+
+/* common */
+#include "attrib.h"
+#include "coll.h"
+#include "xmalloc.h"
+
+/* cc65 */
+#include "datatype.h"
+#include "global.h"
+#include "scanner.h"
+#include "symtab.h"
+#include "regvars.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* The register bank is a scarce resource, and saving and restoring a
+** variable costs about as much as a few accesses on the stack. So the
+** variables are ranked by their references, where a reference within a loop
+** counts four times as much as one outside of it. Only variables with a
+** minimum weight are considered.
+*/
+#define MAX_LOOP_LEVEL  4               /* Deeper loops don't count more */
+#define MIN_WEIGHT      4               /* Minimum weight of a variable */
+#define MIN_WEIGHT_CHAR 8               /* Chars are cheap on the stack */
+
+/* Candidate flags */
+#define RV_DECLARED     0x01U           /* Auto variable of the outermost block */
+#define RV_REGISTER     0x02U           /* Declared with 'register' */
+#define RV_ADDR         0x04U           /* Address may be taken */
+#define RV_CHOSEN       0x08U           /* Placed into the register bank */
+
+/* A name declared in the function body. Each declaration has its own entry,
+** so a name declared again in an inner block is counted separately.
+*/
+typedef struct RegVarCand RegVarCand;
+struct RegVarCand {
+    ident       Name;                   /* Name of the variable */
+    unsigned    Weight;                 /* Weighted count of references */
+    unsigned    Size;                   /* Estimated size, zero if unsuitable */
+    unsigned    Index;                  /* Index of the declaration */
+    unsigned    Flags;                  /* Flags, see above */
+};
+
+/* The declarations of the current function */
+static Collection Cands = STATIC_COLLECTION_INITIALIZER;
+
+/* The declarations visible at the current token, innermost last */
+static Collection Visible = STATIC_COLLECTION_INITIALIZER;
+
+/* Token returned past the end of the token list, TOK_INVALID */
+static const Token EndToken;
+
+
+
+/*****************************************************************************/
+/*                              Helper functions                             */
+/*****************************************************************************/
+
+
+
+static const Token* GetTok (const Collection* Tokens, unsigned I)
+/* Return token I, or an invalid token if there is none */
+{
+    return (I < CollCount (Tokens))? CollConstAt (Tokens, I) : &EndToken;
+}
+
+
+
+static RegVarCand* NewCand (const char* Name)
+/* Create a candidate for a declaration of Name and make it visible */
+{
+    RegVarCand* C = xmalloc (sizeof (RegVarCand));
+    strcpy (C->Name, Name);
+    C->Weight = 0;
+    C->Size   = 0;
+    C->Index  = CollCount (&Cands);
+    C->Flags  = 0;
+    CollAppend (&Cands, C);
+    CollAppend (&Visible, C);
+    return C;
+}
+
+
+
+static RegVarCand* FindCand (const char* Name)
+/* Return the innermost visible declaration of Name, or NULL if the name is
+** not declared in the function body.
+*/
+{
+    unsigned I = CollCount (&Visible);
+    while (I-- > 0) {
+        RegVarCand* C = CollAtUnchecked (&Visible, I);
+        if (strcmp (C->Name, Name) == 0) {
+            return C;
+        }
+    }
+    return 0;
+}
+
+
+
+static void AddRef (const Collection* Tokens, unsigned I, unsigned Level)
+/* Count token I as a reference if it is an identifier */
+{
+    const Token* T = GetTok (Tokens, I);
+    const Token* Prev;
+    RegVarCand*  C;
+
+    if (T->Tok != TOK_IDENT) {
+        return;
+    }
+
+    /* Struct members are not variables */
+    Prev = (I > 0)? GetTok (Tokens, I - 1) : &EndToken;
+    if (Prev->Tok == TOK_DOT || Prev->Tok == TOK_PTR_REF) {
+        return;
+    }
+
+    C = FindCand (T->Ident);
+    if (C == 0) {
+        return;
+    }
+    C->Weight += 1U << (2 * (Level < MAX_LOOP_LEVEL? Level : MAX_LOOP_LEVEL));
+
+    /* A register variable has no address. Since we don't know if an '&' is
+    ** unary, any '&' in front of the name counts.
+    */
+    if (Prev->Tok == TOK_AND ||
+        (Prev->Tok == TOK_LPAREN && I > 1 && GetTok (Tokens, I - 2)->Tok == TOK_AND)) {
+        C->Flags |= RV_ADDR;
+    }
+}
+
+
+
+static unsigned ScanParens (const Collection* Tokens, unsigned I, unsigned Level)
+/* Count the references in the parenthesized expression starting at token I,
+** and return the index of the token behind it.
+*/
+{
+    unsigned Depth = 0;
+
+    if (GetTok (Tokens, I)->Tok != TOK_LPAREN) {
+        return I;
+    }
+    while (I < CollCount (Tokens)) {
+        token_t Tok = GetTok (Tokens, I)->Tok;
+        AddRef (Tokens, I++, Level);
+        if (Tok == TOK_LPAREN) {
+            ++Depth;
+        } else if (Tok == TOK_RPAREN && --Depth == 0) {
+            break;
+        }
+    }
+    return I;
+}
+
+
+
+static unsigned ScanSimple (const Collection* Tokens, unsigned I, unsigned Level)
+/* Count the references in an expression statement or declaration starting at
+** token I, and return the index of the token behind it. Statements following
+** a label are handled separately, so loops are recognized.
+*/
+{
+    unsigned Start = I;
+    unsigned Depth = 0;
+
+    while (I < CollCount (Tokens)) {
+        token_t Tok = GetTok (Tokens, I)->Tok;
+        if (Depth == 0 && I > Start) {
+            if (Tok == TOK_DO || Tok == TOK_FOR || Tok == TOK_WHILE ||
+                Tok == TOK_IF || Tok == TOK_SWITCH || Tok == TOK_ELSE ||
+                (Tok == TOK_LCURLY && GetTok (Tokens, I - 1)->Tok == TOK_COLON)) {
+                break;
+            }
+        }
+        if (Tok == TOK_LPAREN || Tok == TOK_LBRACK || Tok == TOK_LCURLY) {
+            ++Depth;
+        } else if (Tok == TOK_RPAREN || Tok == TOK_RBRACK || Tok == TOK_RCURLY) {
+            if (Depth == 0) {
+                /* End of the enclosing block */
+                break;
+            }
+            --Depth;
+        }
+        AddRef (Tokens, I++, Level);
+        if (Depth == 0 && Tok == TOK_SEMI) {
+            break;
+        }
+    }
+
+    /* Always make progress */
+    return (I == Start)? I + 1 : I;
+}
+
+
+
+static unsigned ScanBlock (const Collection* Tokens, unsigned I, unsigned Level,
+                           int Outer);
+/* Forward */
+
+
+
+static unsigned ScanStatement (const Collection* Tokens, unsigned I, unsigned Level)
+/* Count the references in the statement starting at token I, and return the
+** index of the token behind it.
+*/
+{
+    switch (GetTok (Tokens, I)->Tok) {
+
+        case TOK_LCURLY:
+            return ScanBlock (Tokens, I + 1, Level, 0);
+
+        case TOK_FOR:
+        case TOK_WHILE:
+            I = ScanParens (Tokens, I + 1, Level + 1);
+            return ScanStatement (Tokens, I, Level + 1);
+
+        case TOK_DO:
+            I = ScanStatement (Tokens, I + 1, Level + 1);
+            if (GetTok (Tokens, I)->Tok == TOK_WHILE) {
+                I = ScanParens (Tokens, I + 1, Level + 1);
+            }
+            return I;
+
+        case TOK_IF:
+        case TOK_SWITCH:
+            I = ScanParens (Tokens, I + 1, Level);
+            I = ScanStatement (Tokens, I, Level);
+            if (GetTok (Tokens, I)->Tok == TOK_ELSE) {
+                I = ScanStatement (Tokens, I + 1, Level);
+            }
+            return I;
+
+        default:
+            return ScanSimple (Tokens, I, Level);
+    }
+}
+
+
+
+static int IsDeclStart (const Token* T)
+/* Return true if the token starts a declaration */
+{
+    if (T->Tok == TOK_IDENT) {
+        const SymEntry* Sym = FindSym (T->Ident);
+        return Sym != 0 && SymIsTypeDef (Sym);
+    }
+    return TokIsStorageClass (T) || TokIsType (T) || TokIsTypeQual (T) ||
+           TokIsFuncSpec (T)     || T->Tok == TOK_ATTRIBUTE;
+}
+
+
+
+static unsigned SkipNested (const Collection* Tokens, unsigned I)
+/* If token I opens parentheses or braces, skip up to and including the
+** closing one. Return the index of the token behind.
+*/
+{
+    unsigned Depth = 0;
+    do {
+        token_t Tok = GetTok (Tokens, I)->Tok;
+        if (Tok == TOK_LPAREN || Tok == TOK_LBRACK || Tok == TOK_LCURLY) {
+            ++Depth;
+        } else if (Tok == TOK_RPAREN || Tok == TOK_RBRACK || Tok == TOK_RCURLY) {
+            --Depth;
+        }
+        ++I;
+    } while (Depth > 0 && I < CollCount (Tokens));
+    return I;
+}
+
+
+
+static unsigned ScanDecl (const Collection* Tokens, unsigned I, unsigned Level,
+                          int Outer)
+/* Record the names of the declaration starting at token I, count the
+** references in the initializers, and return the index of the token behind
+** it. Auto and register variables of the outermost block (Outer is true)
+** become candidates for the register bank. The size of the variables is
+** estimated from the tokens, since the declaration has not been parsed yet.
+*/
+{
+    unsigned    Size     = 2;
+    int         HaveType = 0;
+    int         Auto     = 1;
+    int         Register = 0;
+    int         Volatile = 0;
+    int         Done     = 0;
+
+    /* Declaration specifiers */
+    while (!Done && I < CollCount (Tokens)) {
+        const Token* T = GetTok (Tokens, I);
+        switch (T->Tok) {
+
+            case TOK_REGISTER:
+                Register = 1;
+                break;
+
+            case TOK_STATIC:
+            case TOK_EXTERN:
+            case TOK_TYPEDEF:
+                Auto = 0;
+                break;
+
+            case TOK_VOLATILE:
+                Volatile = 1;
+                break;
+
+            case TOK_CHAR:
+                Size = 1;
+                HaveType = 1;
+                break;
+
+            case TOK_LONG:
+                Size = 4;
+                HaveType = 1;
+                break;
+
+            case TOK_INT:
+            case TOK_SHORT:
+            case TOK_SIGNED:
+            case TOK_UNSIGNED:
+                HaveType = 1;
+                break;
+
+            case TOK_FLOAT:
+            case TOK_DOUBLE:
+            case TOK_VOID:
+                Size = 0;
+                HaveType = 1;
+                break;
+
+            case TOK_ENUM:
+            case TOK_STRUCT:
+            case TOK_UNION:
+                /* Only pointers to structs and unions are suitable */
+                Size = (T->Tok == TOK_ENUM)? 2 : 0;
+                HaveType = 1;
+                if (GetTok (Tokens, I + 1)->Tok == TOK_IDENT) {
+                    ++I;
+                }
+                if (GetTok (Tokens, I + 1)->Tok == TOK_LCURLY) {
+                    I = SkipNested (Tokens, I + 1) - 1;
+                }
+                break;
+
+            case TOK_ATTRIBUTE:
+                I = SkipNested (Tokens, I + 1) - 1;
+                break;
+
+            case TOK_IDENT:
+                if (!HaveType && IsDeclStart (T)) {
+                    const Type* Type = FindSym (T->Ident)->Type;
+                    if ((IsClassInt (Type) || IsClassPtr (Type)) && !IsQualVolatile (Type)) {
+                        Size = SizeOf (Type);
+                    } else {
+                        Size = 0;
+                    }
+                    HaveType = 1;
+                } else {
+                    Done = 1;
+                }
+                break;
+
+            default:
+                Done = 1;
+                break;
+        }
+        if (!Done) {
+            ++I;
+        }
+    }
+
+    /* Declarators */
+    while (I < CollCount (Tokens)) {
+        const char* Name = 0;
+        int         Ptr  = 0;
+        int         Ok   = 1;
+        int         Init = 0;
+        unsigned    Depth = 0;
+        RegVarCand* C = 0;
+
+        /* Pointers. A volatile pointer is not suitable, a pointer to
+        ** volatile data is.
+        */
+        while (GetTok (Tokens, I)->Tok == TOK_STAR || TokIsTypeQual (GetTok (Tokens, I))) {
+            if (GetTok (Tokens, I)->Tok == TOK_STAR) {
+                Ptr = 1;
+            } else if (GetTok (Tokens, I)->Tok == TOK_VOLATILE) {
+                Ok = 0;
+            }
+            ++I;
+        }
+        if (Volatile && !Ptr) {
+            Ok = 0;
+        }
+
+        /* The name. Arrays, functions and complex declarators are not
+        ** suitable, but their names hide outer declarations, too.
+        */
+        if (GetTok (Tokens, I)->Tok == TOK_IDENT) {
+            Name = GetTok (Tokens, I)->Ident;
+            ++I;
+        } else {
+            unsigned J = I;
+            while (GetTok (Tokens, J)->Tok == TOK_LPAREN ||
+                   GetTok (Tokens, J)->Tok == TOK_STAR   ||
+                   TokIsTypeQual (GetTok (Tokens, J))) {
+                ++J;
+            }
+            if (GetTok (Tokens, J)->Tok == TOK_IDENT) {
+                Name = GetTok (Tokens, J)->Ident;
+            }
+            Ok = 0;
+        }
+        if (GetTok (Tokens, I)->Tok == TOK_LBRACK || GetTok (Tokens, I)->Tok == TOK_LPAREN) {
+            Ok = 0;
+        }
+
+        /* The name is visible from here on, including its own initializer.
+        ** Only auto variables of the outermost block are candidates.
+        */
+        if (Name) {
+            C = NewCand (Name);
+            C->Size = Ok? (Ptr? 2 : Size) : 0;
+            if (Outer && (Auto || Register)) {
+                C->Flags |= RV_DECLARED;
+                if (Register) {
+                    C->Flags |= RV_REGISTER;
+                }
+            }
+        }
+
+        /* Skip the rest of the declarator, and count the references in the
+        ** initializer.
+        */
+        while (I < CollCount (Tokens)) {
+            token_t Tok = GetTok (Tokens, I)->Tok;
+            if (Depth == 0 && (Tok == TOK_COMMA || Tok == TOK_SEMI)) {
+                break;
+            }
+            if (Tok == TOK_LPAREN || Tok == TOK_LBRACK || Tok == TOK_LCURLY) {
+                ++Depth;
+            } else if (Tok == TOK_RPAREN || Tok == TOK_RBRACK || Tok == TOK_RCURLY) {
+                if (Depth == 0) {
+                    /* Something is wrong, let the parser complain */
+                    return I;
+                }
+                --Depth;
+            } else if (Depth == 0 && Tok == TOK_ASSIGN) {
+                Init = 1;
+            }
+            if (Init) {
+                AddRef (Tokens, I, Level);
+            }
+            ++I;
+        }
+
+        /* Next declarator */
+        if (GetTok (Tokens, I)->Tok != TOK_COMMA) {
+            break;
+        }
+        ++I;
+    }
+
+    /* Skip the semicolon */
+    if (GetTok (Tokens, I)->Tok == TOK_SEMI) {
+        ++I;
+    }
+    return I;
+}
+
+
+
+static unsigned ScanBlock (const Collection* Tokens, unsigned I, unsigned Level,
+                           int Outer)
+/* Count the references in the block whose first token after the opening
+** curly brace is token I, and return the index of the token behind the
+** closing brace. Declarations are only allowed at the start of a block.
+*/
+{
+    unsigned Count = CollCount (&Visible);
+
+    while (IsDeclStart (GetTok (Tokens, I))) {
+        I = ScanDecl (Tokens, I, Level, Outer);
+    }
+    while (I < CollCount (Tokens) && GetTok (Tokens, I)->Tok != TOK_RCURLY) {
+        I = ScanStatement (Tokens, I, Level);
+    }
+
+    /* The declarations of the block are no longer visible */
+    while (CollCount (&Visible) > Count) {
+        CollPop (&Visible);
+    }
+    return I + 1;
+}
+
+
+
+static int CompareCands (void* Data attribute ((unused)),
+                         const void* Left, const void* Right)
+/* Compare function used when sorting the candidates: Higher weight first,
+** then declaration order.
+*/
+{
+    const RegVarCand* C1 = Left;
+    const RegVarCand* C2 = Right;
+    if (C1->Weight != C2->Weight) {
+        return (C1->Weight > C2->Weight)? -1 : 1;
+    }
+    return (C1->Index < C2->Index)? -1 : (C1->Index > C2->Index);
+}
+
+
+
+static void ChooseRegVars (void)
+/* Choose the variables for the register bank */
+{
+    Collection  Auto = AUTO_COLLECTION_INITIALIZER;
+    unsigned    Space = RegisterSpace;
+    unsigned    I;
+
+    /* Explicit register variables are allocated as before, so the others
+    ** get the remaining space.
+    */
+    for (I = 0; I < CollCount (&Cands); ++I) {
+        RegVarCand* C = CollAtUnchecked (&Cands, I);
+        if ((C->Flags & RV_DECLARED) == 0) {
+            continue;
+        }
+        if ((C->Flags & RV_REGISTER) != 0) {
+            Space -= (C->Size < Space)? C->Size : Space;
+        } else if (C->Size > 0 && (C->Flags & RV_ADDR) == 0 &&
+                   C->Weight >= ((C->Size == 1)? MIN_WEIGHT_CHAR : MIN_WEIGHT)) {
+            CollAppend (&Auto, C);
+        }
+    }
+
+    /* Take the variables with the highest weight that fit */
+    CollSort (&Auto, CompareCands, 0);
+    for (I = 0; I < CollCount (&Auto); ++I) {
+        RegVarCand* C = CollAtUnchecked (&Auto, I);
+        if (C->Size <= Space) {
+            C->Flags |= RV_CHOSEN;
+            Space -= C->Size;
+        }
+    }
+
+    DoneCollection (&Auto);
+}
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void ScanRegVars (const Collection* Body)
+/* Must be called at the start of a function body. Body contains the tokens
+** of the body as read by ReadAheadBlock, or is NULL if the body could not be
+** read completely. If register variables and their automatic placement are
+** enabled, count the references of the local variables weighted by the loop
+** nesting, and choose the variables of the outermost block that are placed
+** into the register bank.
+*/
+{
+    unsigned    I;
+
+    /* Forget the variables of the last function */
+    for (I = 0; I < CollCount (&Cands); ++I) {
+        xfree (CollAtUnchecked (&Cands, I));
+    }
+    CollDeleteAll (&Cands);
+    CollDeleteAll (&Visible);
+
+    if (!IS_Get (&EnableRegVars) || !IS_Get (&AutoRegVars) || Body == 0) {
+        return;
+    }
+
+    /* If the body contains inline assembler which may access the variables
+    ** on the stack, or a goto which may jump past the code that saves the
+    ** register bank, leave the variables alone.
+    */
+    for (I = 0; I < CollCount (Body); ++I) {
+        token_t Tok = GetTok (Body, I)->Tok;
+        if (Tok == TOK_ASM || Tok == TOK_GOTO) {
+            return;
+        }
+    }
+
+    /* Record the declarations and count the references */
+    ScanBlock (Body, 0, 0, 1);
+
+    /* Choose the best ones */
+    ChooseRegVars ();
+}
+
+
+
+int IsAutoRegVar (const char* Name)
+/* Return true if the auto variable with the given name in the outermost
+** block of the current function was chosen for the register bank.
+*/
+{
+    unsigned I;
+    for (I = 0; I < CollCount (&Cands); ++I) {
+        const RegVarCand* C = CollConstAt (&Cands, I);
+        if ((C->Flags & RV_CHOSEN) != 0 && strcmp (C->Name, Name) == 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
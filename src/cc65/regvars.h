@@ -0,0 +1,67 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                 regvars.h                                 */
+/*                                                                           */
+/*            Automatic placement of local variables in registers            */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#ifndef REGVARS_H
+#define REGVARS_H
+
+
+
+/* common */
+#include "coll.h"
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void ScanRegVars (const Collection* Body);
+/* Must be called at the start of a function body. Body contains the tokens
+** of the body as read by ReadAheadBlock, or is NULL if the body could not be
+** read completely. If register variables and their automatic placement are
+** enabled, count the references of the local variables weighted by the loop
+** nesting, and choose the variables of the outermost block that are placed
+** into the register bank.
+*/
+
+int IsAutoRegVar (const char* Name);
+/* Return true if the auto variable with the given name in the outermost
+** block of the current function was chosen for the register bank.
+*/
+
+
+
+/* End of regvars.h */
+
+#endif
@@ -42,8 +42,11 @@
 
 /* common */
 #include "chartype.h"
+#include "check.h"
+#include "coll.h"
 #include "fp.h"
 #include "tgttrans.h"
+#include "xmalloc.h"
 
 /* cc65 */
 #include "datatype.h"
@@ -70,6 +73,12 @@
 Token CurTok;           /* The current token */
 Token NextTok;          /* The next token */
 
+/* Tokens read ahead by ReadAheadBlock or inserted by InsertTokens, returned
+** by NextToken before reading more input.
+*/
+static Collection ReadAhead     = STATIC_COLLECTION_INITIALIZER;
+static unsigned   ReadAheadPos  = 0;
+
 
 
 /* Token types */
@@ -711,6 +720,25 @@ void NextToken (void)
 {
     ident token;
 
+    /* Return the tokens that were read ahead first */
+    if (ReadAheadPos < CollCount (&ReadAhead)) {
+        if (CurTok.LI) {
+            ReleaseLineInfo (CurTok.LI);
+        }
+        CurTok  = NextTok;
+        NextTok = *(const Token*) CollConstAt (&ReadAhead, ReadAheadPos);
+        if (++ReadAheadPos == CollCount (&ReadAhead)) {
+            /* All tokens returned, free them */
+            unsigned I;
+            for (I = 0; I < CollCount (&ReadAhead); ++I) {
+                xfree (CollAtUnchecked (&ReadAhead, I));
+            }
+            CollDeleteAll (&ReadAhead);
+            ReadAheadPos = 0;
+        }
+        return;
+    }
+
     /* We have to skip white space here before shifting tokens, since the
     ** tokens and the current line info is invalid at startup and will get
     ** initialized by reading the first time from the file. Remember if
@@ -1020,6 +1048,120 @@ void NextToken (void)
 
 
 
+int ReadAheadBlock (Collection* Tokens)
+/* The current token must be a left curly brace. Read the tokens up to and
+** including the matching right curly brace, and add them to Tokens. Reading
+** stops early at end of file or a pragma, since the pragma may change how the
+** following tokens are read. The function returns true if the complete block
+** was read. NextToken returns the tokens again afterwards. The entries in
+** Tokens are valid until the parser reaches the end of the block, but their
+** line infos must not be used.
+*/
+{
+    Token       Open;
+    Token*      T;
+    unsigned    First = CollCount (Tokens);
+    unsigned    Level = 0;
+    int         Complete = 0;
+
+    PRECONDITION (CurTok.Tok == TOK_LCURLY && CollCount (&ReadAhead) == 0);
+
+    /* Remember the current token */
+    Open = CurTok;
+    UseLineInfo (Open.LI);
+
+    /* Read the tokens of the block */
+    while (NextTok.Tok != TOK_CEOF && NextTok.Tok != TOK_PRAGMA) {
+        NextToken ();
+        T = xmalloc (sizeof (Token));
+        *T = CurTok;
+        UseLineInfo (T->LI);
+        CollAppend (Tokens, T);
+        if (CurTok.Tok == TOK_LCURLY) {
+            ++Level;
+        } else if (CurTok.Tok == TOK_RCURLY && Level-- == 0) {
+            Complete = 1;
+            break;
+        }
+    }
+
+    /* Queue the tokens for NextToken. The lookahead token follows the tokens
+    ** read.
+    */
+    while (First < CollCount (Tokens)) {
+        CollAppend (&ReadAhead, CollAtUnchecked (Tokens, First++));
+    }
+    T = xmalloc (sizeof (Token));
+    *T = NextTok;
+    CollAppend (&ReadAhead, T);
+
+    /* Go back to the start of the block */
+    if (CurTok.LI) {
+        ReleaseLineInfo (CurTok.LI);
+    }
+    CurTok  = Open;
+    NextTok = *(const Token*) CollConstAt (&ReadAhead, 0);
+    ReadAheadPos = 1;
+    if (ReadAheadPos == CollCount (&ReadAhead)) {
+        xfree (CollAtUnchecked (&ReadAhead, 0));
+        CollDeleteAll (&ReadAhead);
+        ReadAheadPos = 0;
+    }
+
+    return Complete;
+}
+
+
+
+void InsertTokens (const Collection* Tokens)
+/* Insert copies of the tokens in the collection between the current and the
+** next token, so NextToken returns them before the rest of the input. The
+** copies get the line info of the current token. The tokens must not contain
+** string literals.
+*/
+{
+    Collection  Queue = AUTO_COLLECTION_INITIALIZER;
+    Token*      T;
+    unsigned    I;
+
+    if (CollCount (Tokens) == 0) {
+        return;
+    }
+
+    /* The copies come first */
+    for (I = 0; I < CollCount (Tokens); ++I) {
+        T = xdup (CollConstAt (Tokens, I), sizeof (Token));
+        PRECONDITION (T->SVal == 0);
+        T->LI = CurTok.LI? UseLineInfo (CurTok.LI) : 0;
+        CollAppend (&Queue, T);
+    }
+
+    /* Then the lookahead token and the tokens not returned so far. Tokens
+    ** already returned have passed their line info on and are just freed.
+    */
+    T = xmalloc (sizeof (Token));
+    *T = NextTok;
+    CollAppend (&Queue, T);
+    for (I = 0; I < CollCount (&ReadAhead); ++I) {
+        if (I < ReadAheadPos) {
+            xfree (CollAtUnchecked (&ReadAhead, I));
+        } else {
+            CollAppend (&Queue, CollAtUnchecked (&ReadAhead, I));
+        }
+    }
+    CollDeleteAll (&ReadAhead);
+    for (I = 0; I < CollCount (&Queue); ++I) {
+        CollAppend (&ReadAhead, CollAtUnchecked (&Queue, I));
+    }
+    DoneCollection (&Queue);
+
+    /* The first copy is the new lookahead token */
+    NextTok = *(const Token*) CollConstAt (&ReadAhead, 0);
+    ReadAheadPos = 1;
+}
+
+
+
 void SkipTokens (const token_t* TokenList, unsigned TokenCount)
 /* Skip tokens until we reach TOK_CEOF or a token in the given token list.
 ** This routine is used for error recovery.
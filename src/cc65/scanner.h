@@ -39,6 +39,7 @@
 
 
 /* common */
+#include "coll.h"
 #include "fp.h"
 
 /* cc65 */
@@ -265,6 +266,23 @@ int IsSym (char* S);
 void NextToken (void);
 /* Get next token from input stream */
 
+int ReadAheadBlock (Collection* Tokens);
+/* The current token must be a left curly brace. Read the tokens up to and
+** including the matching right curly brace, and add them to Tokens. Reading
+** stops early at end of file or a pragma, since the pragma may change how the
+** following tokens are read. The function returns true if the complete block
+** was read. NextToken returns the tokens again afterwards. The entries in
+** Tokens are valid until the parser reaches the end of the block, but their
+** line infos must not be used.
+*/
+
+void InsertTokens (const Collection* Tokens);
+/* Insert copies of the tokens in the collection between the current and the
+** next token, so NextToken returns them before the rest of the input. The
+** copies get the line info of the current token. The tokens must not contain
+** string literals.
+*/
+
 void SkipTokens (const token_t* TokenList, unsigned TokenCount);
 /* Skip tokens until we reach TOK_CEOF or a token in the given token list.
 ** This routine is used for error recovery.
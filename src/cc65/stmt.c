@@ -55,6 +55,7 @@
 #include "locals.h"
 #include "loop.h"
 #include "pragma.h"
+#include "profile.h"
 #include "scanner.h"
 #include "stackptr.h"
 #include "stmt.h"
@@ -148,27 +149,81 @@ static void SkipPending (int PendingToken)
 
 
 
+static int SwapIfArms (const LineInfo* LI,
+                       const CodeMark* ThenStart, const CodeMark* ThenEnd, int ThenBreak,
+                       const CodeMark* ElseStart, const CodeMark* ElseEnd, int ElseBreak)
+/* Use the execution profile to decide if the else arm of an if statement
+** should be placed before the then arm. The arm placed first needs a taken
+** branch less, but a jump over the other arm, unless it ends with a jump
+** anyway. A taken branch costs one cycle more than one that is not taken,
+** a jump costs three cycles.
+*/
+{
+    unsigned long Then, Else;
+    unsigned long Gain = 0, Loss = 0;
+
+    if (!PF_GetCodeCount (ThenStart, ThenEnd, LI, &Then) ||
+        !PF_GetCodeCount (ElseStart, ElseEnd, LI, &Else)) {
+        /* Use the branches of the condition, which jump to the else arm */
+        if (!PF_GetBranchCounts (LI, &Else, &Then)) {
+            return 0;
+        }
+    }
+
+    /* The then arm needs one cycle more, but may save the jump */
+    if (ThenBreak) {
+        Loss += Then;
+    } else {
+        Gain += 2 * Then;
+    }
+
+    /* The else arm needs one cycle less, but may need the jump */
+    if (ElseBreak) {
+        Gain += Else;
+    } else {
+        Loss += 2 * Else;
+    }
+
+    return Gain > Loss;
+}
+
+
+
 static int IfStatement (void)
 /* Handle an 'if' statement */
 {
     unsigned Label1;
+    unsigned Label3 = 0;
     unsigned TestResult;
     int GotBreak;
+    LineInfo* LI;
+    CodeMark ThenStart;
 
-    /* Skip the if */
+    /* Remember the line of the condition, then skip the if */
+    LI = UseLineInfo (CurTok.LI);
     NextToken ();
 
     /* Generate a jump label and parse the condition */
     Label1 = GetLocalLabel ();
     TestResult = TestInParens (Label1, 0);
 
+    /* With an execution profile, the arms may be swapped later, so the then
+    ** arm needs a label.
+    */
+    if (PF_HaveProfile () && TestResult == TESTEXPR_UNKNOWN) {
+        Label3 = GetLocalLabel ();
+        g_defcodelabel (Label3);
+    }
+
     /* Parse the if body */
+    GetCodePos (&ThenStart);
     GotBreak = Statement (0);
 
     /* Else clause present? */
     if (CurTok.Tok != TOK_ELSE) {
 
         g_defcodelabel (Label1);
+        ReleaseLineInfo (LI);
 
         /* Since there's no else clause, we're not sure, if the a break
         ** statement is really executed.
@@ -179,8 +234,20 @@ static int IfStatement (void)
 
         /* Generate a jump around the else branch */
         unsigned Label2 = GetLocalLabel ();
+        CodeMark ThenEnd, JumpStart, ElseStart, ElseEnd;
+        int ElseBreak;
+
+        GetCodePos (&ThenEnd);
         g_jump (Label2);
 
+        /* If the arms may be swapped, add the jump to the then arm that is
+        ** needed in this case. It is removed again, if not.
+        */
+        GetCodePos (&JumpStart);
+        if (Label3) {
+            g_jump (Label3);
+        }
+
         /* Skip the else */
         NextToken ();
 
@@ -192,13 +259,35 @@ static int IfStatement (void)
         }
 
         /* Define the target for the first test */
+        GetCodePos (&ElseStart);
         g_defcodelabel (Label1);
 
+        /* Parse the else body */
+        ElseBreak = Statement (0);
+        GetCodePos (&ElseEnd);
+
+        /* Place the else arm first if the profile says that this is faster.
+        ** It gets a jump to the end, and is moved together with the jump to
+        ** the then arm directly behind the condition.
+        */
+        if (Label3) {
+            if (SwapIfArms (LI, &ThenStart, &ThenEnd, GotBreak,
+                            &ElseStart, &ElseEnd, ElseBreak)) {
+                CodeMark End;
+                g_jump (Label2);
+                GetCodePos (&End);
+                MoveCode (&JumpStart, &End, &ThenStart);
+            } else {
+                RemoveCodeRange (&JumpStart, &ElseStart);
+            }
+        }
+
         /* Total break only if both branches had a break. */
-        GotBreak &= Statement (0);
+        GotBreak &= ElseBreak;
 
         /* Generate the label for the else clause */
         g_defcodelabel (Label2);
+        ReleaseLineInfo (LI);
 
         /* Done */
         return GotBreak;
@@ -438,9 +527,12 @@ static void ContinueStatement (void)
 static void ForStatement (void)
 /* Handle a 'for' statement */
 {
-    int HaveIncExpr;
+    int HaveTestExpr;
+    CodeMark TestExprStart;
+    CodeMark TestExprEnd;
     CodeMark IncExprStart;
     CodeMark IncExprEnd;
+    CodeMark Here;
     int PendingToken;
 
     /* Get several local labels needed later */
@@ -470,27 +562,32 @@ static void ForStatement (void)
     }
     ConsumeSemi ();
 
-    /* Label for the test expressions */
-    g_defcodelabel (TestLabel);
+    /* The code for the test expression is moved to the bottom of the loop,
+    ** so the loop is entered by jumping to the test, and each iteration
+    ** needs just the conditional branch back to the body.
+    */
+    HaveTestExpr = (CurTok.Tok != TOK_SEMI);
+    if (HaveTestExpr) {
+        g_jump (TestLabel);
+    }
+
+    /* Remember the start of the test expression */
+    GetCodePos (&TestExprStart);
 
     /* Parse the test expression */
-    if (CurTok.Tok != TOK_SEMI) {
+    if (HaveTestExpr) {
         Test (BodyLabel, 1);
-        g_jump (BreakLabel);
-    } else {
-        g_jump (BodyLabel);
     }
     ConsumeSemi ();
 
+    /* Remember the end of the test expression */
+    GetCodePos (&TestExprEnd);
+
     /* Remember the start of the increment expression */
     GetCodePos (&IncExprStart);
 
-    /* Label for the increment expression */
-    g_defcodelabel (IncLabel);
-
     /* Parse the increment expression */
-    HaveIncExpr = (CurTok.Tok != TOK_RPAREN);
-    if (HaveIncExpr) {
+    if (CurTok.Tok != TOK_RPAREN) {
         /* The value of the expression is unused */
         ExprDesc lval3;
         ED_Init (&lval3);
@@ -498,8 +595,18 @@ static void ForStatement (void)
         Expression0 (&lval3);
     }
 
-    /* Jump to the test */
-    g_jump (TestLabel);
+    /* Jump to the test, or back to the body if there is none. The jump to
+    ** the test is needed even though the test follows the increment after
+    ** the code has been moved: The increment may end with a label that has
+    ** no insn yet (for example from a sign extension), and would otherwise
+    ** be attached to the first insn of the body. The optimizer removes the
+    ** jump if it is not needed.
+    */
+    if (HaveTestExpr) {
+        g_jump (TestLabel);
+    } else {
+        g_jump (BodyLabel);
+    }
 
     /* Remember the end of the increment expression */
     GetCodePos (&IncExprEnd);
@@ -511,18 +618,18 @@ static void ForStatement (void)
     g_defcodelabel (BodyLabel);
     Statement (&PendingToken);
 
-    /* If we had an increment expression, move the code to the bottom of
-    ** the loop. In this case we don't need to jump there at the end of
-    ** the loop body.
+    /* Move the increment expression and then the test to the bottom of
+    ** the loop. Both code ranges are in front of the body, and the test
+    ** comes first, so moving the increment doesn't change its position.
+    ** The labels are defined here and not within the moved code, because
+    ** any of the ranges may be empty.
     */
-    if (HaveIncExpr) {
-        CodeMark Here;
-        GetCodePos (&Here);
-        MoveCode (&IncExprStart, &IncExprEnd, &Here);
-    } else {
-        /* Jump back to the increment expression */
-        g_jump (IncLabel);
-    }
+    g_defcodelabel (IncLabel);
+    GetCodePos (&Here);
+    MoveCode (&IncExprStart, &IncExprEnd, &Here);
+    g_defcodelabel (TestLabel);
+    GetCodePos (&Here);
+    MoveCode (&TestExprStart, &TestExprEnd, &Here);
 
     /* Skip a pending token if we have one */
     SkipPending (PendingToken);
@@ -67,9 +67,8 @@ struct SwitchCtrl {
     TypeCode    ExprType;       /* Basic switch expression type */
     unsigned    Depth;          /* Number of bytes the selector type has */
     unsigned    DefaultLabel;   /* Label for the default branch */
-
-
-
+    unsigned    CaseLabel;      /* Label of the last case */
+    CodeMark    CasePos;        /* Code position of the last case */
 };
 
 /* Pointer to current switch control struct */
@@ -136,6 +135,7 @@ void SwitchStatement (void)
     SwitchData.ExprType     = GetUnderlyingTypeCode (&SwitchExpr.Type[0]);
     SwitchData.Depth        = SizeOf (SwitchExpr.Type);
     SwitchData.DefaultLabel = 0;
+    SwitchData.CaseLabel    = 0;
     OldSwitch = Switch;
     Switch = &SwitchData;
 
@@ -211,6 +211,7 @@ void CaseLabel (void)
     ExprDesc CaseExpr;          /* Case label expression */
     long     Val;               /* Case label value */
     unsigned CodeLabel;         /* Code label for this case */
+    CodeMark CasePos;           /* Current code position */
 
     /* Skip the "case" token */
     NextToken ();
@@ -260,11 +261,25 @@ void CaseLabel (void)
                 Internal ("Invalid type: %06lX", Switch->ExprType);
         }
 
-        /* Insert the case selector into the selector table */
-        CodeLabel = InsertCaseValue (Switch->Nodes, Val, Switch->Depth);
+        /* If there was no code since the last case label, both cases share
+        ** one label. This allows g_switch to check runs of consecutive case
+        ** values with one range compare.
+        */
+        GetCodePos (&CasePos);
+        if (Switch->CaseLabel != 0                  &&
+            Switch->CasePos.Pos == CasePos.Pos      &&
+            Switch->CasePos.SP == CasePos.SP) {
+            CodeLabel = Switch->CaseLabel;
+        } else {
+            /* Define a new label */
+            CodeLabel = GetLocalLabel ();
+            g_defcodelabel (CodeLabel);
+            Switch->CaseLabel = CodeLabel;
+            Switch->CasePos   = CasePos;
+        }
 
-        /* Define this label */
-        g_defcodelabel (CodeLabel);
+        /* Insert the case selector into the selector table */
+        InsertCaseValue (Switch->Nodes, Val, Switch->Depth, CodeLabel);
 
     } else {
 
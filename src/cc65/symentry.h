@@ -108,6 +108,8 @@ struct CodeEntry;
 #define SC_ALIAS        0x01000000U     /* Alias of anonymous field */
 #define SC_FICTITIOUS   0x02000000U     /* Symbol is fictitious */
 #define SC_HAVEFAM      0x04000000U     /* Type has a Flexible Array Member */
+#define SC_INLINE       0x08000000U     /* Function declared inline */
+#define SC_INLINED      0x10000000U     /* Calls of the function were inlined */
 
 
 
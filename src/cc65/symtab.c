@@ -56,6 +56,8 @@
 #include "function.h"
 #include "global.h"
 #include "input.h"
+#include "lineinfo.h"
+#include "scanner.h"
 #include "stackptr.h"
 #include "symentry.h"
 #include "typecmp.h"
@@ -103,7 +105,7 @@ static SymTable*        FailSafeTab     = 0;    /* For errors */
 
 
 
-static SymTable* NewSymTable (unsigned Size)
+SymTable* NewSymTable (unsigned Size)
 /* Create and return a symbol table for the given lexical level */
 {
     unsigned I;
@@ -166,6 +168,7 @@ static void CheckSymTable (SymTable* Tab)
             */
             if (((Flags & SC_AUTO) || (Flags & SC_STATIC)) && (Flags & SC_EXTERN) == 0) {
                 if (SymIsDef (Entry) && !SymIsRef (Entry) &&
+                    (Flags & SC_INLINED) == 0 &&
                     !SymHasAttr (Entry, atUnused)) {
                     if (Flags & SC_PARAM) {
                         if (IS_Get (&WarnUnusedParam)) {
@@ -658,7 +661,7 @@ static int HandleSymRedefinition (SymEntry* Entry, const Type* T, unsigned Flags
 
 
 
-static void AddSymEntry (SymTable* T, SymEntry* S)
+void AddSymEntry (SymTable* T, SymEntry* S)
 /* Add a symbol to a symbol table */
 {
     /* Get the hash value for the name */
@@ -931,7 +934,7 @@ DefOrRef* AddDefOrRef (SymEntry* E, unsigned Flags)
 
     DOR = xmalloc (sizeof (DefOrRef));
     CollAppend (E->V.L.DefsOrRefs, DOR);
-    DOR->Line = GetCurrentLine ();
+    DOR->Line = GetInputLine (CurTok.LI);
     DOR->LocalsBlockId = (long)CollLast (&CurrentFunc->LocalsBlockStack);
     DOR->Flags = Flags;
     DOR->StackPtr = StackPtr;
@@ -999,7 +1002,7 @@ SymEntry* AddLabelSym (const char* Name, unsigned Flags)
                     (long)CollAt (AIC, DOR->Depth - 1) != DOR->LocalsBlockId)) {
                     Warning ("Goto at line %d to label %s jumps into a block with "
                     "initialization of an object that has automatic storage duration",
-                    GetCurrentLine (), Name);
+                    GetInputLine (CurTok.LI), Name);
                 }
             }
 
@@ -1268,6 +1271,12 @@ SymTable* GetGlobalSymTab (void)
     return SymTab0;
 }
 
+SymTable* GetGlobalTagTab (void)
+/* Return the global tag table */
+{
+    return TagTab0;
+}
+
 SymTable* GetLabelSymTab (void)
 /* Return the global symbol table */
 {
@@ -74,6 +74,20 @@ struct FuncDesc;
 
 
 
+/*****************************************************************************/
+/*                              struct SymTable                              */
+/*****************************************************************************/
+
+
+
+SymTable* NewSymTable (unsigned Size);
+/* Create and return a symbol table for the given lexical level */
+
+void AddSymEntry (SymTable* T, SymEntry* S);
+/* Add a symbol to a symbol table */
+
+
+
 /*****************************************************************************/
 /*                        Handling of lexical levels                         */
 /*****************************************************************************/
@@ -185,6 +199,9 @@ SymTable* GetSymTab (void);
 SymTable* GetGlobalSymTab (void);
 /* Return the global symbol table */
 
+SymTable* GetGlobalTagTab (void);
+/* Return the global tag table */
+
 SymTable* GetLabelSymTab (void);
 /* Return the label symbol table */
 
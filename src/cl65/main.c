@@ -119,6 +119,9 @@ static CmdDesc RM   = { 0, 0, 0, 0, 0, 0, 0 };
 static int DoLink       = 1;
 static int DoAssemble   = 1;
 
+/* Let the compiler write object files instead of assembler code */
+static int IntegratedAs = 0;
+
 /* The name of the output file, NULL if none given */
 static const char* OutputName = 0;
 
@@ -144,6 +147,42 @@ static int Module = 0;
 static char* TargetLib   = 0;
 static int   NoTargetLib = 0;
 
+/* Maximum number of jobs running in parallel and number of running jobs */
+static unsigned MaxJobs  = 1;
+static unsigned JobCount = 0;
+
+/* Set while the father process just records the files of a job that is run
+** by a subprocess. No programs are executed and no files are touched then.
+*/
+static int RecordOnly = 0;
+
+/* Directory for cached object files, NULL if there is no cache. NoCache is
+** set if the tools create output a cached object file cannot replace.
+*/
+static const char* CacheDir = 0;
+static int         NoCache  = 0;
+
+/* Compiler options naming an input file. The contents of the file are part
+** of the key of a cached object file.
+*/
+static const char* const CacheInputOpts[] = {
+    "--prefix-header",
+    "--profile-use",
+    "--static-frames",
+};
+
+/* Compiler and assembler options that create more output than the object
+** file, so the tools must run even if the object file is in the cache.
+*/
+static const char* const NoCacheOpts[] = {
+    "--call-graph",
+    "--create-dep",
+    "--create-full-dep",
+    "--listing",
+    "--precompile",
+    "-l",
+};
+
 
 
 /*****************************************************************************/
@@ -429,6 +468,11 @@ static void ExecProgram (CmdDesc* Cmd)
 {
     int Status;
 
+    /* The program is run by a job if we're just recording */
+    if (RecordOnly) {
+        return;
+    }
+
     /* If in debug mode, output the command line we will execute */
     if (Debug) {
         printf ("Executing: ");
@@ -583,7 +627,7 @@ static void AssembleIntermediate (const char* SourceFile)
     AssembleFile (AsmName, CA65.ArgCount);
 
     /* Remove the input file */
-    if (remove (AsmName) < 0) {
+    if (!RecordOnly && remove (AsmName) < 0) {
         Warning ("Cannot remove temporary file '%s': %s",
                  AsmName, strerror (errno));
     }
@@ -617,12 +661,210 @@ static void Assemble (const char* File)
 
 
 
+static void HashData (unsigned long* Hash, const void* Data, unsigned long Size)
+/* Add Data to the hash value in Hash, which consists of two independent
+** 32 bit halves.
+*/
+{
+    const unsigned char* P = Data;
+    while (Size--) {
+        Hash[0] = ((Hash[0] ^ *P) * 16777619UL) & 0xFFFFFFFFUL;
+        Hash[1] = ((Hash[1] + *P) * 2654435761UL) & 0xFFFFFFFFUL;
+        ++P;
+    }
+}
+
+
+
+static void HashArgs (unsigned long* Hash, const CmdDesc* Cmd)
+/* Add the arguments of a command to the hash value */
+{
+    unsigned I;
+    for (I = 0; I < Cmd->ArgCount; ++I) {
+        HashData (Hash, Cmd->Args[I], strlen (Cmd->Args[I]) + 1);
+    }
+}
+
+
+
+static int IsOption (const char* Arg, const char* const* Opts, unsigned Count)
+/* Return true if Arg is one of the Count options in Opts */
+{
+    unsigned I;
+    for (I = 0; I < Count; ++I) {
+        if (strcmp (Arg, Opts[I]) == 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+
+
+static int CacheUsable (void)
+/* Return true if the object file may be taken from the cache */
+{
+    unsigned I;
+
+    if (NoCache) {
+        return 0;
+    }
+    for (I = 0; I < CC65.ArgCount; ++I) {
+        if (IsOption (CC65.Args[I], NoCacheOpts, sizeof (NoCacheOpts) / sizeof (NoCacheOpts[0]))) {
+            return 0;
+        }
+    }
+    for (I = 0; I < CA65.ArgCount; ++I) {
+        if (IsOption (CA65.Args[I], NoCacheOpts, sizeof (NoCacheOpts) / sizeof (NoCacheOpts[0]))) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+
+
+static int HashFile (unsigned long* Hash, unsigned long* Size, const char* Name)
+/* Add the contents of a file to the hash value and its length to Size.
+** Return true on success.
+*/
+{
+    char   Buf[4096];
+    size_t Count;
+    FILE*  F;
+
+    if ((F = fopen (Name, "rb")) == 0) {
+        return 0;
+    }
+    while ((Count = fread (Buf, 1, sizeof (Buf), F)) > 0) {
+        HashData (Hash, Buf, Count);
+        *Size += Count;
+    }
+    fclose (F);
+    return 1;
+}
+
+
+
+static int CopyFile (const char* From, const char* To)
+/* Copy a file. Return true on success. */
+{
+    char   Buf[4096];
+    size_t Count;
+    int    Ok;
+    FILE*  I;
+    FILE*  O;
+
+    if ((I = fopen (From, "rb")) == 0) {
+        return 0;
+    }
+    if ((O = fopen (To, "wb")) == 0) {
+        fclose (I);
+        return 0;
+    }
+    Ok = 1;
+    while ((Count = fread (Buf, 1, sizeof (Buf), I)) > 0) {
+        if (fwrite (Buf, 1, Count, O) != Count) {
+            Ok = 0;
+            break;
+        }
+    }
+    Ok = Ok && !ferror (I);
+    fclose (I);
+    if (fclose (O) != 0) {
+        Ok = 0;
+    }
+    if (!Ok) {
+        remove (To);
+    }
+    return Ok;
+}
+
+
+
+static char* MakeCacheName (const char* File)
+/* Return the name of the cache entry for the C file File. The key is a hash
+** over the preprocessed source, the version of the tools and the arguments
+** passed to the compiler and assembler, including the contents of the
+** files named by CacheInputOpts. The compiler arguments must be complete
+** with the exception of the output and input file names.
+*/
+{
+    unsigned long Hash[2] = { 2166136261UL, 0x6B43A9B5UL };
+    unsigned long Size = 0;
+    StrBuf        Name = STATIC_STRBUF_INITIALIZER;
+    unsigned      ArgCount = CC65.ArgCount;
+    char*         PPName = MakeFilename (File, ".i");
+    unsigned      I;
+
+    /* Hash the tool version, the arguments and the file name */
+    HashData (Hash, GetVersionAsString (), strlen (GetVersionAsString ()) + 1);
+    HashArgs (Hash, &CC65);
+    HashArgs (Hash, &CA65);
+    HashData (Hash, File, strlen (File) + 1);
+
+    /* Hash the files read by the compiler besides the source. If one of
+    ** them is missing, the compiler will complain about it.
+    */
+    for (I = 0; I + 1 < ArgCount; ++I) {
+        if (IsOption (CC65.Args[I], CacheInputOpts, sizeof (CacheInputOpts) / sizeof (CacheInputOpts[0]))) {
+            HashFile (Hash, &Size, CC65.Args[++I]);
+        }
+    }
+
+    /* Preprocess the file and hash the result */
+    CmdAddArg (&CC65, "-E");
+    CmdSetOutput (&CC65, PPName);
+    CmdAddArg (&CC65, File);
+    CmdAddArg (&CC65, 0);
+    ExecProgram (&CC65);
+    CmdDelArgs (&CC65, ArgCount);
+
+    if (!HashFile (Hash, &Size, PPName)) {
+        Error ("Cannot open '%s': %s", PPName, strerror (errno));
+    }
+    if (remove (PPName) < 0) {
+        Warning ("Cannot remove temporary file '%s': %s",
+                 PPName, strerror (errno));
+    }
+    xfree (PPName);
+
+    SB_Printf (&Name, "%s/%08lX%08lX%lX.o", CacheDir, Hash[0], Hash[1], Size);
+    SB_Terminate (&Name);
+    return SB_GetBuf (&Name);
+}
+
+
+
+static void StoreCached (const char* ObjName, const char* CacheName)
+/* Add an object file to the cache */
+{
+    /* Use a temporary name, so other jobs never see a partial file */
+    char* TmpName = MakeFilename (CacheName, ".tmp");
+    if (!CopyFile (ObjName, TmpName)) {
+        Warning ("Cannot write '%s': %s", TmpName, strerror (errno));
+    } else {
+        /* Some systems won't replace an existing file */
+        remove (CacheName);
+        if (rename (TmpName, CacheName) < 0) {
+            remove (TmpName);
+        }
+    }
+    xfree (TmpName);
+}
+
+
+
 static void Compile (const char* File)
 /* Compile the given file */
 {
     /* Remember the current compiler argument count */
     unsigned ArgCount = CC65.ArgCount;
 
+    /* The name of the cache entry and the object file stored there */
+    char* CacheName = 0;
+    char* CacheObj  = 0;
+
     /* Set the target system */
     CmdSetTarget (&CC65, Target);
 
@@ -645,6 +887,49 @@ static void Compile (const char* File)
                 xfree (ObjName);
             }
         }
+
+        /* If the compiler writes the object file itself, it is handled
+        ** like the output of the assembler.
+        */
+        if (IntegratedAs) {
+            CmdAddArg (&CC65, "--integrated-as");
+        }
+
+        /* Look for the object file in the cache. Dependency files are only
+        ** written when the tools run, so we cannot use the cache for them.
+        */
+        if (CacheDir && CacheUsable () && !DepName && !FullDepName && !RecordOnly) {
+            if (!DoLink && OutputName) {
+                CacheObj = xstrdup (OutputName);
+            } else {
+                CacheObj = MakeFilename (File, ".o");
+            }
+            CacheName = MakeCacheName (File);
+            if (CopyFile (CacheName, CacheObj)) {
+                if (Debug) {
+                    printf ("Using cached '%s'\n", CacheName);
+                }
+                if (DoLink) {
+                    CmdAddFile (&LD65, CacheObj);
+                    CmdAddFile (&RM, CacheObj);
+                }
+                CmdDelArgs (&CC65, ArgCount);
+                xfree (CacheName);
+                xfree (CacheObj);
+                return;
+            }
+        }
+
+        if (IntegratedAs) {
+            if (DoLink) {
+                char* ObjName = MakeFilename (File, ".o");
+                CmdAddFile (&LD65, ObjName);
+                CmdAddFile (&RM, ObjName);
+                xfree (ObjName);
+            } else if (OutputName) {
+                CmdSetOutput (&CC65, OutputName);
+            }
+        }
     } else {
         /* If we won't assemble, this is the final step. In this case, set
         ** the output name if it was given.
@@ -669,10 +954,17 @@ static void Compile (const char* File)
     /* If this is not the final step, assemble the generated file, then
     ** remove it
     */
-    if (DoAssemble) {
+    if (DoAssemble && !IntegratedAs) {
         /* Assemble the intermediate file and remove it */
         AssembleIntermediate (File);
     }
+
+    /* Remember the new object file */
+    if (CacheName) {
+        StoreCached (CacheObj, CacheName);
+        xfree (CacheName);
+        xfree (CacheObj);
+    }
 }
 
 
@@ -747,6 +1039,69 @@ static void ConvertO65 (const char* File)
 
 
 
+/*****************************************************************************/
+/*                               Parallel jobs                               */
+/*****************************************************************************/
+
+
+
+static void FinishJob (void)
+/* Wait until one of the running jobs terminates. If it failed, wait for the
+** other jobs and exit with its exit code.
+*/
+{
+#if defined(HAVE_JOBS)
+    int Status = WaitJob ();
+    --JobCount;
+    if (Status != 0) {
+        while (JobCount > 0) {
+            WaitJob ();
+            --JobCount;
+        }
+        exit (Status);
+    }
+#endif
+}
+
+
+
+static void FinishJobs (void)
+/* Wait until all running jobs have terminated */
+{
+    while (JobCount > 0) {
+        FinishJob ();
+    }
+}
+
+
+
+static void RunJob (void (*Func) (const char*), const char* File)
+/* Process File with Func. If jobs may run in parallel, this is done by a
+** subprocess, and the father just records the files the job will create.
+*/
+{
+#if defined(HAVE_JOBS)
+    if (MaxJobs > 1) {
+        while (JobCount >= MaxJobs) {
+            FinishJob ();
+        }
+        if (StartJob () == 0) {
+            /* The son - process the file. ExecProgram exits on errors. */
+            Func (File);
+            exit (EXIT_SUCCESS);
+        }
+        ++JobCount;
+        RecordOnly = 1;
+        Func (File);
+        RecordOnly = 0;
+        return;
+    }
+#endif
+    Func (File);
+}
+
+
+
 /*****************************************************************************/
 /*                                   Code                                    */
 /*****************************************************************************/
@@ -796,9 +1151,11 @@ static void Usage (void)
             "  --asm-args options\t\tPass options to the assembler\n"
             "  --asm-define sym[=v]\t\tDefine an assembler symbol\n"
             "  --asm-include-dir dir\t\tSet an assembler include directory\n"
+            "  --auto-register-vars\t\tPlace often used locals into registers\n"
             "  --bin-include-dir dir\t\tSet an assembler binary include directory\n"
             "  --bss-label name\t\tDefine and export a BSS segment label\n"
             "  --bss-name seg\t\tSet the name of the BSS segment\n"
+            "  --cache-dir dir\t\tCache object files of C files in dir\n"
             "  --cc-args options\t\tPass options to the compiler\n"
             "  --cfg-path path\t\tSpecify a config file search path\n"
             "  --check-stack\t\t\tGenerate stack overflow checks\n"
@@ -817,6 +1174,8 @@ static void Usage (void)
             "  --force-import sym\t\tForce an import of symbol 'sym'\n"
             "  --help\t\t\tHelp (this text)\n"
             "  --include-dir dir\t\tSet a compiler include directory path\n"
+            "  --integrated-as\t\tCompile C files directly to object files\n"
+            "  --jobs n\t\t\tProcess up to n files in parallel\n"
             "  --ld-args options\t\tPass options to the linker\n"
             "  --lib-path path\t\tSpecify a library search path\n"
             "  --list-targets\t\tList all available targets\n"
@@ -830,6 +1189,7 @@ static void Usage (void)
             "  --o65-model model\t\tOverride the o65 model\n"
             "  --obj file\t\t\tLink this object file\n"
             "  --obj-path path\t\tSpecify an object file search path\n"
+            "  --prefix-header file\t\tRead a header before each C file\n"
             "  --print-target-path\t\tPrint the target file path\n"
             "  --register-space b\t\tSet space available for register variables\n"
             "  --register-vars\t\tEnable register variables\n"
@@ -889,6 +1249,15 @@ static void OptAsmIncludeDir (const char* Opt attribute ((unused)), const char*
 
 
 
+static void OptAutoRegisterVars (const char* Opt attribute ((unused)),
+                                 const char* Arg attribute ((unused)))
+/* Handle the --auto-register-vars option */
+{
+    CmdAddArg (&CC65, "--auto-register-vars");
+}
+
+
+
 static void OptBinIncludeDir (const char* Opt attribute ((unused)), const char* Arg)
 /* Binary include directory (assembler) */
 {
@@ -914,6 +1283,14 @@ static void OptBssName (const char* Opt attribute ((unused)), const char* Arg)
 
 
 
+static void OptCacheDir (const char* Opt attribute ((unused)), const char* Arg)
+/* Set the directory for cached object files */
+{
+    CacheDir = Arg;
+}
+
+
+
 static void OptCCArgs (const char* Opt attribute ((unused)), const char* Arg)
 /* Pass arguments to the compiler */
 {
@@ -1082,6 +1459,26 @@ static void OptIncludeDir (const char* Opt attribute ((unused)), const char* Arg
 
 
 
+static void OptIntegratedAs (const char* Opt attribute ((unused)),
+                             const char* Arg attribute ((unused)))
+/* Let the compiler write object files */
+{
+    IntegratedAs = 1;
+}
+
+
+
+static void OptJobs (const char* Opt, const char* Arg)
+/* Set the number of jobs to run in parallel */
+{
+    char Check;
+    if (sscanf (Arg, "%u%c", &MaxJobs, &Check) != 1 || MaxJobs == 0) {
+        Error ("Invalid argument for %s: '%s'", Opt, Arg);
+    }
+}
+
+
+
 static void OptLdArgs (const char* Opt attribute ((unused)), const char* Arg)
 /* Pass arguments to the linker */
 {
@@ -1110,6 +1507,9 @@ static void OptListing (const char* Opt attribute ((unused)), const char* Arg)
 /* Create an assembler listing */
 {
     CmdAddArg2 (&CA65, "-l", Arg);
+
+    /* The cache contains only object files */
+    NoCache = 1;
 }
 
 
@@ -1207,6 +1607,14 @@ static void OptObjPath (const char* Opt attribute ((unused)), const char* Arg)
 
 
 
+static void OptPrefixHeader (const char* Opt attribute ((unused)), const char* Arg)
+/* Read a header before each C file */
+{
+    CmdAddArg2 (&CC65, "--prefix-header", Arg);
+}
+
+
+
 static void OptPrintTargetPath (const char* Opt attribute ((unused)),
                                 const char* Arg attribute ((unused)))
 /* Print the target file path */
@@ -1354,9 +1762,11 @@ int main (int argc, char* argv [])
         { "--asm-args",          1, OptAsmArgs        },
         { "--asm-define",        1, OptAsmDefine      },
         { "--asm-include-dir",   1, OptAsmIncludeDir  },
+        { "--auto-register-vars", 0, OptAutoRegisterVars },
         { "--bin-include-dir",   1, OptBinIncludeDir  },
         { "--bss-label",         1, OptBssLabel       },
         { "--bss-name",          1, OptBssName        },
+        { "--cache-dir",         1, OptCacheDir       },
         { "--cc-args",           1, OptCCArgs         },
         { "--cfg-path",          1, OptCfgPath        },
         { "--check-stack",       0, OptCheckStack     },
@@ -1375,6 +1785,8 @@ int main (int argc, char* argv [])
         { "--force-import",      1, OptForceImport    },
         { "--help",              0, OptHelp           },
         { "--include-dir",       1, OptIncludeDir     },
+        { "--integrated-as",     0, OptIntegratedAs   },
+        { "--jobs",              1, OptJobs           },
         { "--ld-args",           1, OptLdArgs         },
         { "--lib-path",          1, OptLibPath        },
         { "--list-targets",      0, OptListTargets    },
@@ -1388,6 +1800,7 @@ int main (int argc, char* argv [])
         { "--o65-model",         1, OptO65Model       },
         { "--obj",               1, OptObj            },
         { "--obj-path",          1, OptObjPath        },
+        { "--prefix-header",     1, OptPrefixHeader   },
         { "--print-target-path", 0, OptPrintTargetPath},
         { "--register-space",    1, OptRegisterSpace  },
         { "--register-vars",     0, OptRegisterVars   },
@@ -1605,13 +2018,13 @@ int main (int argc, char* argv [])
 
                 case FILETYPE_C:
                     /* Compile the file */
-                    Compile (Arg);
+                    RunJob (Compile, Arg);
                     break;
 
                 case FILETYPE_ASM:
                     /* Assemble the file */
                     if (DoAssemble) {
-                        Assemble (Arg);
+                        RunJob (Assemble, Arg);
                     }
                     break;
 
@@ -1647,6 +2060,9 @@ int main (int argc, char* argv [])
         Warning ("No input files");
     }
 
+    /* Wait until all files are translated */
+    FinishJobs ();
+
     /* Link the given files if requested and if we have any */
     if (DoLink && LD65.FileCount > 0) {
         Link ();
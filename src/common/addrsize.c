@@ -92,3 +92,69 @@ unsigned char AddrSizeFromStr (const char* Str)
     /* Not found */
     return ADDR_SIZE_INVALID;
 }
+
+
+
+unsigned char GetConstAddrSize (long Val)
+/* Get the address size of a constant */
+{
+    if ((Val & ~0xFFL) == 0) {
+        return ADDR_SIZE_ZP;
+    } else if ((Val & ~0xFFFFL) == 0) {
+        return ADDR_SIZE_ABS;
+    } else if ((Val & ~0xFFFFFFL) == 0) {
+        return ADDR_SIZE_FAR;
+    } else {
+        return ADDR_SIZE_LONG;
+    }
+}
+
+
+
+unsigned char UpdateAddrSize (unsigned char Cur, int Valid, unsigned char New)
+/* Return the address size of an expression with the address size Cur, after
+** a part with the address size New was added. Valid tells if the expression
+** can still be evaluated.
+*/
+{
+    if (Valid) {
+        /* ADDR_SIZE_DEFAULT may get overridden */
+        if (Cur == ADDR_SIZE_DEFAULT || New > Cur) {
+            Cur = New;
+        }
+    } else {
+        /* ADDR_SIZE_DEFAULT takes precedence */
+        if (Cur != ADDR_SIZE_DEFAULT) {
+            if (New == ADDR_SIZE_DEFAULT || New > Cur) {
+                Cur = New;
+            }
+        }
+    }
+    return Cur;
+}
+
+
+
+unsigned char MergeAddrSize (unsigned char Left, int LeftValid,
+                             unsigned char Right, int RightValid)
+/* Return the address size of an expression combined from two parts with the
+** given address sizes. The flags tell if the parts can be evaluated.
+*/
+{
+    if (Left == ADDR_SIZE_DEFAULT) {
+        /* If Left is valid, ADDR_SIZE_DEFAULT gets always overridden,
+        ** otherwise it takes precedence over anything else.
+        */
+        return LeftValid? Right : Left;
+    } else if (Right == ADDR_SIZE_DEFAULT) {
+        /* If Right is valid, ADDR_SIZE_DEFAULT gets always overridden,
+        ** otherwise it takes precedence over anything else.
+        */
+        return RightValid? Left : Right;
+    } else {
+        /* Neither side has a default address size, use the larger of the
+        ** two.
+        */
+        return (Right > Left)? Right : Left;
+    }
+}
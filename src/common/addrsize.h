@@ -67,6 +67,21 @@ unsigned char AddrSizeFromStr (const char* Str);
 ** the string cannot be mapped to an address size.
 */
 
+unsigned char GetConstAddrSize (long Val);
+/* Get the address size of a constant */
+
+unsigned char UpdateAddrSize (unsigned char Cur, int Valid, unsigned char New);
+/* Return the address size of an expression with the address size Cur, after
+** a part with the address size New was added. Valid tells if the expression
+** can still be evaluated.
+*/
+
+unsigned char MergeAddrSize (unsigned char Left, int LeftValid,
+                             unsigned char Right, int RightValid);
+/* Return the address size of an expression combined from two parts with the
+** given address sizes. The flags tell if the parts can be evaluated.
+*/
+
 
 
 /* End of addrsize.h */
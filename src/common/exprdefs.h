@@ -113,6 +113,7 @@ struct ExprNode {
     union {
         long                IVal;       /* If this is a int value */
         struct SymEntry*    Sym;        /* If this is a symbol */
+        struct ObjSym*      ObjSym;     /* If this is a symbol (cc65) */
         unsigned            SecNum;     /* If this is a section and Obj != 0 */
         unsigned            ImpNum;     /* If this is an import and Obj != 0 */
         struct Import*      Imp;        /* If this is an import and Obj == 0 */
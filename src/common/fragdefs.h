@@ -63,8 +63,15 @@
 #define FRAG_SEXPR24    (FRAG_SEXPR | 3)/* 24 bit signed expression */
 #define FRAG_SEXPR32    (FRAG_SEXPR | 4)/* 32 bit signed expression */
 
+#define FRAG_RELAX      0x18            /* Instruction the linker may shorten */
+
 #define FRAG_FILL       0x20            /* Fill bytes */
 
+/* Kinds of relaxable instructions (FRAG_RELAX) */
+#define RELAX_ZP        0x00            /* Absolute operand may be zero page */
+#define RELAX_BRANCH    0x01            /* JMP may be replaced by a branch */
+#define RELAX_FIXED     0x80            /* Flag: Instruction must keep its size */
+
 
 
 /* End of fragdefs.h */
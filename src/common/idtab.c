@@ -0,0 +1,179 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                  idtab.c                                  */
+/*                                                                           */
+/*                      Hash table keyed by integer ids                      */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+/* common */
+#include "check.h"
+#include "hashfunc.h"
+#include "idtab.h"
+#include "xmalloc.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Initial number of slots. Must be a power of two */
+#define IT_MIN_SLOTS    64U
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+IdTable* InitIdTable (IdTable* T)
+/* Initialize an id table and return it */
+{
+    /* Initialize the fields */
+    T->Slots    = 0;
+    T->Count    = 0;
+    T->Table    = 0;
+
+    /* Return the initialized table */
+    return T;
+}
+
+
+
+void DoneIdTable (IdTable* T)
+/* Destroy the contents of an id table. Note: This will not free the data
+** pointed to by the entries!
+*/
+{
+    xfree (T->Table);
+    T->Slots = 0;
+    T->Count = 0;
+    T->Table = 0;
+}
+
+
+
+static IdTabEntry* IT_Probe (IdTabEntry* Table, unsigned Slots, unsigned Id)
+/* Return the slot that contains Id, or the free slot where it would have to
+** be inserted.
+*/
+{
+    unsigned Mask = Slots - 1;
+    unsigned I    = HashInt (Id) & Mask;
+    while (Table[I].Data != 0 && Table[I].Id != Id) {
+        I = (I + 1) & Mask;
+    }
+    return Table + I;
+}
+
+
+
+static void IT_Grow (IdTable* T)
+/* Double the size of the table and rehash all entries */
+{
+    unsigned     I;
+    unsigned     NewSlots = (T->Slots == 0)? IT_MIN_SLOTS : T->Slots * 2;
+    IdTabEntry*  NewTable = xmalloc (NewSlots * sizeof (IdTabEntry));
+
+    /* Mark all new slots as free */
+    for (I = 0; I < NewSlots; ++I) {
+        NewTable[I].Data = 0;
+    }
+
+    /* Move the existing entries over */
+    for (I = 0; I < T->Slots; ++I) {
+        if (T->Table[I].Data != 0) {
+            *IT_Probe (NewTable, NewSlots, T->Table[I].Id) = T->Table[I];
+        }
+    }
+
+    /* Replace the old table */
+    xfree (T->Table);
+    T->Table = NewTable;
+    T->Slots = NewSlots;
+}
+
+
+
+void* IT_Find (const IdTable* T, unsigned Id)
+/* Return the data for the given id or NULL if it is not in the table */
+{
+    /* If we don't have a table, there's nothing to find */
+    if (T->Table == 0) {
+        return 0;
+    }
+
+    /* A free slot has a NULL data pointer, so we can just return it */
+    return IT_Probe (T->Table, T->Slots, Id)->Data;
+}
+
+
+
+void IT_Insert (IdTable* T, unsigned Id, void* Data)
+/* Insert Data for the given id into the table. If the id is already in the
+** table, the data pointer is replaced.
+*/
+{
+    IdTabEntry* E;
+
+    /* NULL marks a free slot and cannot be stored */
+    PRECONDITION (Data != 0);
+
+    /* Keep the load factor below 1/2 */
+    if ((T->Count + 1) * 2 > T->Slots) {
+        IT_Grow (T);
+    }
+
+    /* Search for the entry or a free slot */
+    E = IT_Probe (T->Table, T->Slots, Id);
+    if (E->Data == 0) {
+        E->Id = Id;
+        ++T->Count;
+    }
+    E->Data = Data;
+}
+
+
+
+void IT_Walk (const IdTable* T, void (*F) (unsigned Id, void* Data, void* Arg),
+              void* Arg)
+/* Call F for all entries in the table. The order is unspecified. F must not
+** change the table.
+*/
+{
+    unsigned I;
+    for (I = 0; I < T->Slots; ++I) {
+        if (T->Table[I].Data != 0) {
+            F (T->Table[I].Id, T->Table[I].Data, Arg);
+        }
+    }
+}
@@ -0,0 +1,115 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                  idtab.h                                  */
+/*                                                                           */
+/*                      Hash table keyed by integer ids                      */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#ifndef IDTAB_H
+#define IDTAB_H
+
+
+
+/* common */
+#include "inline.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* A table that maps integer ids (usually string pool ids) to pointers. It
+** uses open addressing with linear probing and grows when it becomes half
+** full, so lookups stay cheap regardless of the number of entries. Since the
+** ids are often allocated sequentially, they are scrambled with HashInt
+** before being used as a table index. Slots with a NULL data pointer are
+** free, so NULL cannot be stored as data.
+*/
+typedef struct IdTabEntry IdTabEntry;
+struct IdTabEntry {
+    unsigned            Id;             /* The key */
+    void*               Data;           /* The data, NULL if slot is free */
+};
+
+typedef struct IdTable IdTable;
+struct IdTable {
+    unsigned            Slots;          /* Number of table slots, power of 2 */
+    unsigned            Count;          /* Number of table entries */
+    IdTabEntry*         Table;          /* Table, dynamically allocated */
+};
+
+#define STATIC_IDTABLE_INITIALIZER      { 0, 0, 0 }
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+IdTable* InitIdTable (IdTable* T);
+/* Initialize an id table and return it */
+
+void DoneIdTable (IdTable* T);
+/* Destroy the contents of an id table. Note: This will not free the data
+** pointed to by the entries!
+*/
+
+#if defined(HAVE_INLINE)
+INLINE unsigned IT_GetCount (const IdTable* T)
+/* Return the number of items in the table. */
+{
+    return T->Count;
+}
+#else
+#define IT_GetCount(T)  ((T)->Count)
+#endif
+
+void* IT_Find (const IdTable* T, unsigned Id);
+/* Return the data for the given id or NULL if it is not in the table */
+
+void IT_Insert (IdTable* T, unsigned Id, void* Data);
+/* Insert Data for the given id into the table. If the id is already in the
+** table, the data pointer is replaced.
+*/
+
+void IT_Walk (const IdTable* T, void (*F) (unsigned Id, void* Data, void* Arg),
+              void* Arg);
+/* Call F for all entries in the table. The order is unspecified. F must not
+** change the table.
+*/
+
+
+
+/* End of idtab.h */
+
+#endif
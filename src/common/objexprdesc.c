@@ -0,0 +1,1438 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                               objexprdesc.c                               */
+/*                                                                           */
+/*         Study expression trees for the assembler and the compiler         */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2003-2012, Ullrich von Bassewitz                                      */
+/*                Roemerstrasse 52                                           */
+/*                D-70794 Filderstadt                                        */
+/* EMail:         uz@cc65.org                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#include <string.h>
+
+/* common */
+#include "abend.h"
+#include "addrsize.h"
+#include "check.h"
+#include "objexprdesc.h"
+#include "shift.h"
+#include "xmalloc.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* The tool specific functions for the expression studied at the moment */
+static const StudyFuncs* Funcs = 0;
+
+
+
+/*****************************************************************************/
+/*                             struct ObjExprDesc                            */
+/*****************************************************************************/
+
+
+
+ObjExprDesc* OED_Init (ObjExprDesc* ED)
+/* Initialize an ObjExprDesc structure for use with StudyExpr */
+{
+    ED->Flags     = OED_OK;
+    ED->AddrSize  = ADDR_SIZE_DEFAULT;
+    ED->Val       = 0;
+    ED->SymCount  = 0;
+    ED->SymLimit  = 0;
+    ED->SymRef    = 0;
+    ED->SecCount  = 0;
+    ED->SecLimit  = 0;
+    ED->SecRef    = 0;
+    return ED;
+}
+
+
+
+void OED_Done (ObjExprDesc* ED)
+/* Delete allocated memory for an ObjExprDesc. */
+{
+    xfree (ED->SymRef);
+    xfree (ED->SecRef);
+}
+
+
+
+int OED_IsConst (const ObjExprDesc* D)
+/* Return true if the expression is constant */
+{
+    unsigned I;
+
+    if (D->Flags & OED_TOO_COMPLEX) {
+        return 0;
+    }
+    for (I = 0; I < D->SymCount; ++I) {
+        if (D->SymRef[I].Count != 0) {
+            return 0;
+        }
+    }
+    for (I = 0; I < D->SecCount; ++I) {
+        if (D->SecRef[I].Count != 0) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+
+
+int OED_IsValid (const ObjExprDesc* D)
+/* Return true if the expression is valid, that is, neither the ERROR nor the
+** TOO_COMPLEX flags are set.
+*/
+{
+    return ((D->Flags & (OED_ERROR | OED_TOO_COMPLEX)) == 0);
+}
+
+
+
+int OED_HasError (const ObjExprDesc* D)
+/* Return true if the expression has an error. */
+{
+    return ((D->Flags & OED_ERROR) != 0);
+}
+
+
+
+void OED_Invalidate (ObjExprDesc* D)
+/* Set the TOO_COMPLEX flag for D */
+{
+    D->Flags |= OED_TOO_COMPLEX;
+}
+
+
+
+void OED_SetError (ObjExprDesc* D)
+/* Set the TOO_COMPLEX and ERROR flags for D */
+{
+    D->Flags |= (OED_ERROR | OED_TOO_COMPLEX);
+}
+
+
+
+void OED_UpdateAddrSize (ObjExprDesc* ED, unsigned char AddrSize)
+/* Update the address size of the expression */
+{
+    ED->AddrSize = UpdateAddrSize (ED->AddrSize, OED_IsValid (ED), AddrSize);
+}
+
+
+
+static void OED_MergeAddrSize (ObjExprDesc* ED, const ObjExprDesc* Right)
+/* Merge the address sizes of two expressions into ED */
+{
+    ED->AddrSize = MergeAddrSize (ED->AddrSize, OED_IsValid (ED),
+                                  Right->AddrSize, OED_IsValid (Right));
+}
+
+
+
+static OED_SymRef* OED_FindSymRef (ObjExprDesc* ED, void* Sym)
+/* Find a symbol reference and return it. Return NULL if the reference does
+** not exist.
+*/
+{
+    unsigned I;
+    OED_SymRef* SymRef;
+    for (I = 0, SymRef = ED->SymRef; I < ED->SymCount; ++I, ++SymRef) {
+        if (SymRef->Ref == Sym) {
+            return SymRef;
+        }
+    }
+    return 0;
+}
+
+
+
+static OED_SecRef* OED_FindSecRef (ObjExprDesc* ED, unsigned Sec)
+/* Find a section reference and return it. Return NULL if the reference does
+** not exist.
+*/
+{
+    unsigned I;
+    OED_SecRef* SecRef;
+    for (I = 0, SecRef = ED->SecRef; I < ED->SecCount; ++I, ++SecRef) {
+        if (SecRef->Ref == Sec) {
+            return SecRef;
+        }
+    }
+    return 0;
+}
+
+
+
+static OED_SymRef* OED_AllocSymRef (ObjExprDesc* ED, void* Sym)
+/* Allocate a new symbol reference and return it. The count of the new
+** reference will be set to zero, and the reference itself to Sym.
+*/
+{
+    OED_SymRef* SymRef;
+
+    /* Make sure we have enough SymRef slots */
+    if (ED->SymCount >= ED->SymLimit) {
+        ED->SymLimit *= 2;
+        if (ED->SymLimit == 0) {
+            ED->SymLimit = 2;
+        }
+        ED->SymRef = xrealloc (ED->SymRef, ED->SymLimit * sizeof (ED->SymRef[0]));
+    }
+
+    /* Allocate a new slot */
+    SymRef = ED->SymRef + ED->SymCount++;
+
+    /* Initialize the new struct and return it */
+    SymRef->Count = 0;
+    SymRef->Ref   = Sym;
+    return SymRef;
+}
+
+
+
+static OED_SecRef* OED_AllocSecRef (ObjExprDesc* ED, unsigned Sec)
+/* Allocate a new section reference and return it. The count of the new
+** reference will be set to zero, and the reference itself to Sec.
+*/
+{
+    OED_SecRef* SecRef;
+
+    /* Make sure we have enough SecRef slots */
+    if (ED->SecCount >= ED->SecLimit) {
+        ED->SecLimit *= 2;
+        if (ED->SecLimit == 0) {
+            ED->SecLimit = 2;
+        }
+        ED->SecRef = xrealloc (ED->SecRef, ED->SecLimit * sizeof (ED->SecRef[0]));
+    }
+
+    /* Allocate a new slot */
+    SecRef = ED->SecRef + ED->SecCount++;
+
+    /* Initialize the new struct and return it */
+    SecRef->Count = 0;
+    SecRef->Ref   = Sec;
+    return SecRef;
+}
+
+
+
+OED_SymRef* OED_GetSymRef (ObjExprDesc* ED, void* Sym)
+/* Get a symbol reference and return it. If the symbol reference does not
+** exist, a new one is created and returned.
+*/
+{
+    OED_SymRef* SymRef = OED_FindSymRef (ED, Sym);
+    if (SymRef == 0) {
+        SymRef = OED_AllocSymRef (ED, Sym);
+    }
+    return SymRef;
+}
+
+
+
+static OED_SecRef* OED_GetSecRef (ObjExprDesc* ED, unsigned Sec)
+/* Get a section reference and return it. If the section reference does not
+** exist, a new one is created and returned.
+*/
+{
+    OED_SecRef* SecRef = OED_FindSecRef (ED, Sec);
+    if (SecRef == 0) {
+        SecRef = OED_AllocSecRef (ED, Sec);
+    }
+    return SecRef;
+}
+
+
+
+static void OED_MergeSymRefs (ObjExprDesc* ED, const ObjExprDesc* New)
+/* Merge the symbol references from New into ED */
+{
+    unsigned I;
+    for (I = 0; I < New->SymCount; ++I) {
+
+        /* Get a pointer to the SymRef entry */
+        const OED_SymRef* NewRef = New->SymRef + I;
+
+        /* Get the corresponding entry in ED */
+        OED_SymRef* SymRef = OED_GetSymRef (ED, NewRef->Ref);
+
+        /* Sum up the references */
+        SymRef->Count += NewRef->Count;
+    }
+}
+
+
+
+static void OED_MergeSecRefs (ObjExprDesc* ED, const ObjExprDesc* New)
+/* Merge the section references from New into ED */
+{
+    unsigned I;
+    for (I = 0; I < New->SecCount; ++I) {
+
+        /* Get a pointer to the SymRef entry */
+        const OED_SecRef* NewRef = New->SecRef + I;
+
+        /* Get the corresponding entry in ED */
+        OED_SecRef* SecRef = OED_GetSecRef (ED, NewRef->Ref);
+
+        /* Sum up the references */
+        SecRef->Count += NewRef->Count;
+    }
+}
+
+
+
+static void OED_MergeRefs (ObjExprDesc* ED, const ObjExprDesc* New)
+/* Merge all references from New into ED */
+{
+    OED_MergeSymRefs (ED, New);
+    OED_MergeSecRefs (ED, New);
+}
+
+
+
+static void OED_NegRefs (ObjExprDesc* D)
+/* Negate the references in ED */
+{
+    unsigned I;
+    for (I = 0; I < D->SymCount; ++I) {
+        D->SymRef[I].Count = -D->SymRef[I].Count;
+    }
+    for (I = 0; I < D->SecCount; ++I) {
+        D->SecRef[I].Count = -D->SecRef[I].Count;
+    }
+}
+
+
+
+static void OED_Add (ObjExprDesc* ED, const ObjExprDesc* Right)
+/* Calculate ED = ED + Right, update address size in ED */
+{
+    ED->Val += Right->Val;
+    OED_MergeRefs (ED, Right);
+    OED_MergeAddrSize (ED, Right);
+}
+
+
+
+static void OED_Sub (ObjExprDesc* ED, const ObjExprDesc* Right)
+/* Calculate ED = ED - Right, update address size in ED */
+{
+    ObjExprDesc D = *Right;     /* Temporary */
+    OED_NegRefs (&D);
+
+    ED->Val -= Right->Val;
+    OED_MergeRefs (ED, &D);      /* Merge negatives */
+    OED_MergeAddrSize (ED, Right);
+}
+
+
+
+static void OED_Mul (ObjExprDesc* ED, const ObjExprDesc* Right)
+/* Calculate ED = ED * Right, update address size in ED */
+{
+    unsigned I;
+
+    ED->Val *= Right->Val;
+    for (I = 0; I < ED->SymCount; ++I) {
+        ED->SymRef[I].Count *= Right->Val;
+    }
+    for (I = 0; I < ED->SecCount; ++I) {
+        ED->SecRef[I].Count *= Right->Val;
+    }
+    OED_MergeAddrSize (ED, Right);
+}
+
+
+
+static void OED_Neg (ObjExprDesc* D)
+/* Negate an expression */
+{
+    D->Val = -D->Val;
+    OED_NegRefs (D);
+}
+
+
+
+static void OED_Move (ObjExprDesc* From, ObjExprDesc* To)
+/* Move the data from one ObjExprDesc to another. Old data is freed, and From
+** is prepared to that OED_Done may be called safely.
+*/
+{
+    /* Delete old data */
+    OED_Done (To);
+
+    /* Move the data */
+    *To = *From;
+
+    /* Cleanup From */
+    OED_Init (From);
+}
+
+
+
+void OED_Copy (const ObjExprDesc* From, ObjExprDesc* To)
+/* Copy the data from one ObjExprDesc to another. Old data is freed. */
+{
+    /* Delete old data */
+    OED_Done (To);
+
+    /* Copy the data */
+    *To = *From;
+
+    /* Duplicate the reference arrays */
+    To->SymLimit = To->SymCount;
+    To->SymRef   = 0;
+    if (To->SymCount > 0) {
+        To->SymRef = xdup (From->SymRef, To->SymCount * sizeof (To->SymRef[0]));
+    }
+    To->SecLimit = To->SecCount;
+    To->SecRef   = 0;
+    if (To->SecCount > 0) {
+        To->SecRef = xdup (From->SecRef, To->SecCount * sizeof (To->SecRef[0]));
+    }
+}
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+static void StudyBinaryExpr (const ExprNode* Expr, ObjExprDesc* D)
+/* Study a binary expression subtree. This is a helper function for StudyExpr
+** used for operations that succeed when both operands are known and constant.
+** It evaluates the two subtrees and checks if they are constant. If they
+** aren't constant, it will set the TOO_COMPLEX flag, and merge references.
+** Otherwise the first value is returned in D->Val, the second one in D->Right,
+** so the actual operation can be done by the caller.
+*/
+{
+    ObjExprDesc Right;
+
+    /* Study the left side of the expression */
+    StudyExprNode (Expr->Left, D);
+
+    /* Study the right side of the expression */
+    OED_Init (&Right);
+    StudyExprNode (Expr->Right, &Right);
+
+    /* Check if we can handle the operation */
+    if (OED_IsConst (D) && OED_IsConst (&Right)) {
+
+        /* Remember the constant value from Right */
+        D->Right = Right.Val;
+
+    } else {
+
+        /* Cannot evaluate */
+        OED_Invalidate (D);
+
+        /* Merge references and update address size */
+        OED_MergeRefs (D, &Right);
+        OED_MergeAddrSize (D, &Right);
+
+    }
+
+    /* Cleanup Right */
+    OED_Done (&Right);
+}
+
+
+
+static void StudyLiteral (const ExprNode* Expr, ObjExprDesc* D)
+/* Study a literal expression node */
+{
+    /* This one is easy */
+    D->Val      = Expr->V.IVal;
+    D->AddrSize = GetConstAddrSize (D->Val);
+}
+
+
+
+static void StudySection (const ExprNode* Expr, ObjExprDesc* D)
+/* Study a section expression node */
+{
+    /* Get the section reference */
+    OED_SecRef* SecRef = OED_GetSecRef (D, Expr->V.SecNum);
+
+    /* Update the data and the address size */
+    ++SecRef->Count;
+    OED_UpdateAddrSize (D, Funcs->SegAddrSize (SecRef->Ref));
+}
+
+
+
+static void StudyPlus (const ExprNode* Expr, ObjExprDesc* D)
+/* Study an EXPR_PLUS binary expression node */
+{
+    ObjExprDesc Right;
+
+    /* Study the left side of the expression */
+    StudyExprNode (Expr->Left, D);
+
+    /* Study the right side of the expression */
+    OED_Init (&Right);
+    StudyExprNode (Expr->Right, &Right);
+
+    /* Check if we can handle the operation */
+    if (OED_IsValid (D) && OED_IsValid (&Right)) {
+
+        /* Add both */
+        OED_Add (D, &Right);
+
+    } else {
+
+        /* Cannot evaluate */
+        OED_Invalidate (D);
+
+        /* Merge references and update address size */
+        OED_MergeRefs (D, &Right);
+        OED_MergeAddrSize (D, &Right);
+
+    }
+
+    /* Done */
+    OED_Done (&Right);
+}
+
+
+
+static void StudyMinus (const ExprNode* Expr, ObjExprDesc* D)
+/* Study an EXPR_MINUS binary expression node */
+{
+    ObjExprDesc Right;
+
+    /* Study the left side of the expression */
+    StudyExprNode (Expr->Left, D);
+
+    /* Study the right side of the expression */
+    OED_Init (&Right);
+    StudyExprNode (Expr->Right, &Right);
+
+    /* Check if we can handle the operation */
+    if (OED_IsValid (D) && OED_IsValid (&Right)) {
+
+        /* Subtract both */
+        OED_Sub (D, &Right);
+
+    } else {
+
+        /* Cannot evaluate */
+        OED_Invalidate (D);
+
+        /* Merge references and update address size */
+        OED_MergeRefs (D, &Right);
+        OED_MergeAddrSize (D, &Right);
+
+    }
+
+    /* Done */
+    OED_Done (&Right);
+}
+
+
+
+static void StudyMul (const ExprNode* Expr, ObjExprDesc* D)
+/* Study an EXPR_MUL binary expression node */
+{
+    ObjExprDesc Right;
+
+    /* Study the left side of the expression */
+    StudyExprNode (Expr->Left, D);
+
+    /* Study the right side of the expression */
+    OED_Init (&Right);
+    StudyExprNode (Expr->Right, &Right);
+
+    /* We can handle the operation if at least one of both operands is const
+    ** and the other one is valid.
+    */
+    if (OED_IsConst (D) && OED_IsValid (&Right)) {
+
+        /* Multiplicate both, result goes into Right */
+        OED_Mul (&Right, D);
+
+        /* Move result into D */
+        OED_Move (&Right, D);
+
+    } else if (OED_IsConst (&Right) && OED_IsValid (D)) {
+
+        /* Multiplicate both */
+        OED_Mul (D, &Right);
+
+    } else {
+
+        /* Cannot handle this operation */
+        OED_Invalidate (D);
+
+    }
+
+    /* If we could not handle the op, merge references and update address size */
+    if (!OED_IsValid (D)) {
+        OED_MergeRefs (D, &Right);
+        OED_MergeAddrSize (D, &Right);
+    }
+
+    /* Done */
+    OED_Done (&Right);
+}
+
+
+
+static void StudyDiv (const ExprNode* Expr, ObjExprDesc* D)
+/* Study an EXPR_DIV binary expression node */
+{
+    /* Use helper function */
+    StudyBinaryExpr (Expr, D);
+
+    /* If the result is valid, apply the operation */
+    if (OED_IsValid (D)) {
+        if (D->Right == 0) {
+            Funcs->Error ("Division by zero");
+            OED_SetError (D);
+        } else {
+            D->Val /= D->Right;
+        }
+    }
+}
+
+
+
+static void StudyMod (const ExprNode* Expr, ObjExprDesc* D)
+/* Study an EXPR_MOD binary expression node */
+{
+    /* Use helper function */
+    StudyBinaryExpr (Expr, D);
+
+    /* If the result is valid, apply the operation */
+    if (OED_IsValid (D)) {
+        if (D->Right == 0) {
+            Funcs->Error ("Modulo operation with zero");
+            OED_SetError (D);
+        } else {
+            D->Val %= D->Right;
+        }
+    }
+}
+
+
+
+static void StudyOr (const ExprNode* Expr, ObjExprDesc* D)
+/* Study an EXPR_OR binary expression node */
+{
+    /* Use helper function */
+    StudyBinaryExpr (Expr, D);
+
+    /* If the result is valid, apply the operation */
+    if (OED_IsValid (D)) {
+        D->Val |= D->Right;
+    }
+}
+
+
+
+static void StudyXor (const ExprNode* Expr, ObjExprDesc* D)
+/* Study an EXPR_XOR binary expression node */
+{
+    /* Use helper function */
+    StudyBinaryExpr (Expr, D);
+
+    /* If the result is valid, apply the operation */
+    if (OED_IsValid (D)) {
+        D->Val ^= D->Right;
+    }
+}
+
+
+
+static void StudyAnd (const ExprNode* Expr, ObjExprDesc* D)
+/* Study an EXPR_AND binary expression node */
+{
+    /* Use helper function */
+    StudyBinaryExpr (Expr, D);
+
+    /* If the result is valid, apply the operation */
+    if (OED_IsValid (D)) {
+        D->Val &= D->Right;
+    }
+}
+
+
+
+static void StudyShl (const ExprNode* Expr, ObjExprDesc* D)
+/* Study an EXPR_SHL binary expression node */
+{
+    /* Use helper function */
+    StudyBinaryExpr (Expr, D);
+
+    /* If the result is valid, apply the operation */
+    if (OED_IsValid (D)) {
+        D->Val = shl_l (D->Val, D->Right);
+    }
+}
+
+
+
+static void StudyShr (const ExprNode* Expr, ObjExprDesc* D)
+/* Study an EXPR_SHR binary expression node */
+{
+    /* Use helper function */
+    StudyBinaryExpr (Expr, D);
+
+    /* If the result is valid, apply the operation */
+    if (OED_IsValid (D)) {
+        D->Val = shr_l (D->Val, D->Right);
+    }
+}
+
+
+
+static void StudyEQ (const ExprNode* Expr, ObjExprDesc* D)
+/* Study an EXPR_EQ binary expression node */
+{
+    /* Use helper function */
+    StudyBinaryExpr (Expr, D);
+
+    /* If the result is valid, apply the operation */
+    if (OED_IsValid (D)) {
+        D->Val = (D->Val == D->Right);
+    }
+
+    /* In any case, the result is 0 or 1 */
+    D->AddrSize = ADDR_SIZE_ZP;
+}
+
+
+
+static void StudyNE (const ExprNode* Expr, ObjExprDesc* D)
+/* Study an EXPR_NE binary expression node */
+{
+    /* Use helper function */
+    StudyBinaryExpr (Expr, D);
+
+    /* If the result is valid, apply the operation */
+    if (OED_IsValid (D)) {
+        D->Val = (D->Val != D->Right);
+    }
+
+    /* In any case, the result is 0 or 1 */
+    D->AddrSize = ADDR_SIZE_ZP;
+}
+
+
+
+static void StudyLT (const ExprNode* Expr, ObjExprDesc* D)
+/* Study an EXPR_LT binary expression node */
+{
+    /* Use helper function */
+    StudyBinaryExpr (Expr, D);
+
+    /* If the result is valid, apply the operation */
+    if (OED_IsValid (D)) {
+        D->Val = (D->Val < D->Right);
+    }
+
+    /* In any case, the result is 0 or 1 */
+    D->AddrSize = ADDR_SIZE_ZP;
+}
+
+
+
+static void StudyGT (const ExprNode* Expr, ObjExprDesc* D)
+/* Study an EXPR_GT binary expression node */
+{
+    /* Use helper function */
+    StudyBinaryExpr (Expr, D);
+
+    /* If the result is valid, apply the operation */
+    if (OED_IsValid (D)) {
+        D->Val = (D->Val > D->Right);
+    }
+
+    /* In any case, the result is 0 or 1 */
+    D->AddrSize = ADDR_SIZE_ZP;
+}
+
+
+
+static void StudyLE (const ExprNode* Expr, ObjExprDesc* D)
+/* Study an EXPR_LE binary expression node */
+{
+    /* Use helper function */
+    StudyBinaryExpr (Expr, D);
+
+    /* If the result is valid, apply the operation */
+    if (OED_IsValid (D)) {
+        D->Val = (D->Val <= D->Right);
+    }
+
+    /* In any case, the result is 0 or 1 */
+    D->AddrSize = ADDR_SIZE_ZP;
+}
+
+
+
+static void StudyGE (const ExprNode* Expr, ObjExprDesc* D)
+/* Study an EXPR_GE binary expression node */
+{
+    /* Use helper function */
+    StudyBinaryExpr (Expr, D);
+
+    /* If the result is valid, apply the operation */
+    if (OED_IsValid (D)) {
+        D->Val = (D->Val >= D->Right);
+    }
+
+    /* In any case, the result is 0 or 1 */
+    D->AddrSize = ADDR_SIZE_ZP;
+}
+
+
+
+static void StudyBoolAnd (const ExprNode* Expr, ObjExprDesc* D)
+/* Study an EXPR_BOOLAND binary expression node */
+{
+    StudyExprNode (Expr->Left, D);
+    if (OED_IsConst (D)) {
+        if (D->Val != 0) {   /* Shortcut op */
+            OED_Done (D);
+            OED_Init (D);
+            StudyExprNode (Expr->Right, D);
+            if (OED_IsConst (D)) {
+                D->Val = (D->Val != 0);
+            } else {
+                OED_Invalidate (D);
+            }
+        }
+    } else {
+        OED_Invalidate (D);
+    }
+
+    /* In any case, the result is 0 or 1 */
+    D->AddrSize = ADDR_SIZE_ZP;
+}
+
+
+
+static void StudyBoolOr (const ExprNode* Expr, ObjExprDesc* D)
+/* Study an EXPR_BOOLOR binary expression node */
+{
+    StudyExprNode (Expr->Left, D);
+    if (OED_IsConst (D)) {
+        if (D->Val == 0) {   /* Shortcut op */
+            OED_Done (D);
+            OED_Init (D);
+            StudyExprNode (Expr->Right, D);
+            if (OED_IsConst (D)) {
+                D->Val = (D->Val != 0);
+            } else {
+                OED_Invalidate (D);
+            }
+        } else {
+            D->Val = 1;
+        }
+    } else {
+        OED_Invalidate (D);
+    }
+
+    /* In any case, the result is 0 or 1 */
+    D->AddrSize = ADDR_SIZE_ZP;
+}
+
+
+
+static void StudyBoolXor (const ExprNode* Expr, ObjExprDesc* D)
+/* Study an EXPR_BOOLXOR binary expression node */
+{
+    /* Use helper function */
+    StudyBinaryExpr (Expr, D);
+
+    /* If the result is valid, apply the operation */
+    if (OED_IsValid (D)) {
+        D->Val = (D->Val != 0) ^ (D->Right != 0);
+    }
+
+    /* In any case, the result is 0 or 1 */
+    D->AddrSize = ADDR_SIZE_ZP;
+}
+
+
+
+static void StudyMax (const ExprNode* Expr, ObjExprDesc* D)
+/* Study an MAX binary expression node */
+{
+    /* Use helper function */
+    StudyBinaryExpr (Expr, D);
+
+    /* If the result is valid, apply the operation */
+    if (OED_IsValid (D)) {
+        D->Val = (D->Val > D->Right)? D->Val : D->Right;
+    }
+}
+
+
+
+static void StudyMin (const ExprNode* Expr, ObjExprDesc* D)
+/* Study an MIN binary expression node */
+{
+    /* Use helper function */
+    StudyBinaryExpr (Expr, D);
+
+    /* If the result is valid, apply the operation */
+    if (OED_IsValid (D)) {
+        D->Val = (D->Val < D->Right)? D->Val : D->Right;
+    }
+}
+
+
+
+static void StudyUnaryMinus (const ExprNode* Expr, ObjExprDesc* D)
+/* Study an EXPR_UNARY_MINUS expression node */
+{
+    /* Study the expression */
+    StudyExprNode (Expr->Left, D);
+
+    /* If it is valid, negate it */
+    if (OED_IsValid (D)) {
+        OED_Neg (D);
+    }
+}
+
+
+
+static void StudyNot (const ExprNode* Expr, ObjExprDesc* D)
+/* Study an EXPR_NOT expression node */
+{
+    /* Study the expression */
+    StudyExprNode (Expr->Left, D);
+
+    /* We can handle only const expressions */
+    if (OED_IsConst (D)) {
+        D->Val = ~D->Val;
+    } else {
+        OED_Invalidate (D);
+    }
+}
+
+
+
+static void StudySwap (const ExprNode* Expr, ObjExprDesc* D)
+/* Study an EXPR_SWAP expression node */
+{
+    /* Study the expression */
+    StudyExprNode (Expr->Left, D);
+
+    /* We can handle only const expressions */
+    if (OED_IsConst (D)) {
+        D->Val = (D->Val & ~0xFFFFUL) | ((D->Val >> 8) & 0xFF) | ((D->Val << 8) & 0xFF00);
+    } else {
+        OED_Invalidate (D);
+    }
+}
+
+
+
+static void StudyBoolNot (const ExprNode* Expr, ObjExprDesc* D)
+/* Study an EXPR_BOOLNOT expression node */
+{
+    /* Study the expression */
+    StudyExprNode (Expr->Left, D);
+
+    /* We can handle only const expressions */
+    if (OED_IsConst (D)) {
+        D->Val = (D->Val == 0);
+    } else {
+        OED_Invalidate (D);
+    }
+
+    /* In any case, the result is 0 or 1 */
+    D->AddrSize = ADDR_SIZE_ZP;
+}
+
+
+
+static void StudyBank (const ExprNode* Expr, ObjExprDesc* D)
+/* Study an EXPR_BANK expression node */
+{
+    /* Study the expression extracting section references */
+    StudyExprNode (Expr->Left, D);
+
+    /* The expression is always linker evaluated, so invalidate it */
+    OED_Invalidate (D);
+}
+
+
+
+static void StudyByte0 (const ExprNode* Expr, ObjExprDesc* D)
+/* Study an EXPR_BYTE0 expression node */
+{
+    /* Study the expression */
+    StudyExprNode (Expr->Left, D);
+
+    /* We can handle only const expressions */
+    if (OED_IsConst (D)) {
+        D->Val = (D->Val & 0xFF);
+    } else {
+        OED_Invalidate (D);
+    }
+
+    /* In any case, the result is a zero page expression */
+    D->AddrSize = ADDR_SIZE_ZP;
+}
+
+
+
+static void StudyByte1 (const ExprNode* Expr, ObjExprDesc* D)
+/* Study an EXPR_BYTE1 expression node */
+{
+    /* Study the expression */
+    StudyExprNode (Expr->Left, D);
+
+    /* We can handle only const expressions */
+    if (OED_IsConst (D)) {
+        D->Val = (D->Val >> 8) & 0xFF;
+    } else {
+        OED_Invalidate (D);
+    }
+
+    /* In any case, the result is a zero page expression */
+    D->AddrSize = ADDR_SIZE_ZP;
+}
+
+
+
+static void StudyByte2 (const ExprNode* Expr, ObjExprDesc* D)
+/* Study an EXPR_BYTE2 expression node */
+{
+    /* Study the expression */
+    StudyExprNode (Expr->Left, D);
+
+    /* We can handle only const expressions */
+    if (OED_IsConst (D)) {
+        D->Val = (D->Val >> 16) & 0xFF;
+    } else {
+        OED_Invalidate (D);
+    }
+
+    /* In any case, the result is a zero page expression */
+    D->AddrSize = ADDR_SIZE_ZP;
+}
+
+
+
+static void StudyByte3 (const ExprNode* Expr, ObjExprDesc* D)
+/* Study an EXPR_BYTE3 expression node */
+{
+    /* Study the expression */
+    StudyExprNode (Expr->Left, D);
+
+    /* We can handle only const expressions */
+    if (OED_IsConst (D)) {
+        D->Val = (D->Val >> 24) & 0xFF;
+    } else {
+        OED_Invalidate (D);
+    }
+
+    /* In any case, the result is a zero page expression */
+    D->AddrSize = ADDR_SIZE_ZP;
+}
+
+
+
+static void StudyWord0 (const ExprNode* Expr, ObjExprDesc* D)
+/* Study an EXPR_WORD0 expression node */
+{
+    /* Study the expression */
+    StudyExprNode (Expr->Left, D);
+
+    /* We can handle only const expressions */
+    if (OED_IsConst (D)) {
+        D->Val &= 0xFFFFL;
+    } else {
+        OED_Invalidate (D);
+    }
+
+    /* In any case, the result is an absolute expression */
+    D->AddrSize = ADDR_SIZE_ABS;
+}
+
+
+
+static void StudyWord1 (const ExprNode* Expr, ObjExprDesc* D)
+/* Study an EXPR_WORD1 expression node */
+{
+    /* Study the expression */
+    StudyExprNode (Expr->Left, D);
+
+    /* We can handle only const expressions */
+    if (OED_IsConst (D)) {
+        D->Val = (D->Val >> 16) & 0xFFFFL;
+    } else {
+        OED_Invalidate (D);
+    }
+
+    /* In any case, the result is an absolute expression */
+    D->AddrSize = ADDR_SIZE_ABS;
+}
+
+
+
+static void StudyFarAddr (const ExprNode* Expr, ObjExprDesc* D)
+/* Study an EXPR_FARADDR expression node */
+{
+    /* Study the expression */
+    StudyExprNode (Expr->Left, D);
+
+    /* We can handle only const expressions */
+    if (OED_IsConst (D)) {
+        D->Val &= 0xFFFFFFL;
+    } else {
+        OED_Invalidate (D);
+    }
+
+    /* In any case, the result is a far address */
+    D->AddrSize = ADDR_SIZE_FAR;
+}
+
+
+
+static void StudyDWord (const ExprNode* Expr, ObjExprDesc* D)
+/* Study an EXPR_DWORD expression node */
+{
+    /* Study the expression */
+    StudyExprNode (Expr->Left, D);
+
+    /* We can handle only const expressions */
+    if (OED_IsConst (D)) {
+        D->Val &= 0xFFFFFFFFL;
+    } else {
+        OED_Invalidate (D);
+    }
+
+    /* In any case, the result is a long expression */
+    D->AddrSize = ADDR_SIZE_LONG;
+}
+
+
+
+static void StudyNearAddr (const ExprNode* Expr, ObjExprDesc* D)
+/* Study an EXPR_NEARADDR expression node */
+{
+    /* Study the expression */
+    StudyExprNode (Expr->Left, D);
+
+    /* We can handle only const expressions */
+    if (!OED_IsConst (D)) {
+        OED_Invalidate (D);
+    }
+
+    /* Promote to absolute if smaller. */
+    if (D->AddrSize < ADDR_SIZE_ABS)
+    {
+        D->AddrSize = ADDR_SIZE_ABS;
+    }
+}
+
+
+
+void StudyExprNode (const ExprNode* Expr, ObjExprDesc* D)
+/* Study an expression subtree and add the contents to D. This may only be
+** called from the functions passed to StudyExprTree.
+*/
+{
+    /* Study this expression node */
+    switch (Expr->Op) {
+
+        case EXPR_LITERAL:
+            StudyLiteral (Expr, D);
+            break;
+
+        case EXPR_SYMBOL:
+            Funcs->Symbol (Expr, D);
+            break;
+
+        case EXPR_SECTION:
+            StudySection (Expr, D);
+            break;
+
+        case EXPR_ULABEL:
+            CHECK (Funcs->ULabel != 0);
+            Funcs->ULabel (Expr, D);
+            break;
+
+        case EXPR_PLUS:
+            StudyPlus (Expr, D);
+            break;
+
+        case EXPR_MINUS:
+            StudyMinus (Expr, D);
+            break;
+
+        case EXPR_MUL:
+            StudyMul (Expr, D);
+            break;
+
+        case EXPR_DIV:
+            StudyDiv (Expr, D);
+            break;
+
+        case EXPR_MOD:
+            StudyMod (Expr, D);
+            break;
+
+        case EXPR_OR:
+            StudyOr (Expr, D);
+            break;
+
+        case EXPR_XOR:
+            StudyXor (Expr, D);
+            break;
+
+        case EXPR_AND:
+            StudyAnd (Expr, D);
+            break;
+
+        case EXPR_SHL:
+            StudyShl (Expr, D);
+            break;
+
+        case EXPR_SHR:
+            StudyShr (Expr, D);
+            break;
+
+        case EXPR_EQ:
+            StudyEQ (Expr, D);
+            break;
+
+        case EXPR_NE:
+            StudyNE (Expr, D);
+            break;
+
+        case EXPR_LT:
+            StudyLT (Expr, D);
+            break;
+
+        case EXPR_GT:
+            StudyGT (Expr, D);
+            break;
+
+        case EXPR_LE:
+            StudyLE (Expr, D);
+            break;
+
+        case EXPR_GE:
+            StudyGE (Expr, D);
+            break;
+
+        case EXPR_BOOLAND:
+            StudyBoolAnd (Expr, D);
+            break;
+
+        case EXPR_BOOLOR:
+            StudyBoolOr (Expr, D);
+            break;
+
+        case EXPR_BOOLXOR:
+            StudyBoolXor (Expr, D);
+            break;
+
+        case EXPR_MAX:
+            StudyMax (Expr, D);
+            break;
+
+        case EXPR_MIN:
+            StudyMin (Expr, D);
+            break;
+
+        case EXPR_UNARY_MINUS:
+            StudyUnaryMinus (Expr, D);
+            break;
+
+        case EXPR_NOT:
+            StudyNot (Expr, D);
+            break;
+
+        case EXPR_SWAP:
+            StudySwap (Expr, D);
+            break;
+
+        case EXPR_BOOLNOT:
+            StudyBoolNot (Expr, D);
+            break;
+
+        case EXPR_BANK:
+            StudyBank (Expr, D);
+            break;
+
+        case EXPR_BYTE0:
+            StudyByte0 (Expr, D);
+            break;
+
+        case EXPR_BYTE1:
+            StudyByte1 (Expr, D);
+            break;
+
+        case EXPR_BYTE2:
+            StudyByte2 (Expr, D);
+            break;
+
+        case EXPR_BYTE3:
+            StudyByte3 (Expr, D);
+            break;
+
+        case EXPR_WORD0:
+            StudyWord0 (Expr, D);
+            break;
+
+        case EXPR_WORD1:
+            StudyWord1 (Expr, D);
+            break;
+
+        case EXPR_FARADDR:
+            StudyFarAddr (Expr, D);
+            break;
+
+        case EXPR_DWORD:
+            StudyDWord (Expr, D);
+            break;
+
+        case EXPR_NEARADDR:
+            StudyNearAddr (Expr, D);
+            break;
+
+        default:
+            AbEnd ("Unknown Op type: %u", Expr->Op);
+            break;
+    }
+}
+
+
+
+void StudyExprTree (const ExprNode* Expr, ObjExprDesc* D, const StudyFuncs* F)
+/* Study an expression tree and place the contents into D. The functions in F
+** handle the nodes that depend on the tool.
+*/
+{
+    unsigned I;
+
+    /* Remember the functions. Studying may be nested. */
+    const StudyFuncs* OldFuncs = Funcs;
+    Funcs = F;
+
+    /* Call the internal function */
+    StudyExprNode (Expr, D);
+
+    /* Remove symbol references with count zero */
+    I = 0;
+    while (I < D->SymCount) {
+        if (D->SymRef[I].Count == 0) {
+            /* Delete the entry */
+            --D->SymCount;
+            memmove (D->SymRef + I, D->SymRef + I + 1,
+                     (D->SymCount - I) * sizeof (D->SymRef[0]));
+        } else {
+            /* Next entry */
+            ++I;
+        }
+    }
+
+    /* Remove section references with count zero */
+    I = 0;
+    while (I < D->SecCount) {
+        if (D->SecRef[I].Count == 0) {
+            /* Delete the entry */
+            --D->SecCount;
+            memmove (D->SecRef + I, D->SecRef + I + 1,
+                     (D->SecCount - I) * sizeof (D->SecRef[0]));
+        } else {
+            /* Next entry */
+            ++I;
+        }
+    }
+
+    /* If we don't have an address size, assign one if the expression is a
+    ** constant.
+    */
+    if (D->AddrSize == ADDR_SIZE_DEFAULT && OED_IsConst (D)) {
+        D->AddrSize = GetConstAddrSize (D->Val);
+    }
+
+    /* If the expression is valid, throw away the address size and recalculate
+    ** it using the data we have. This is more exact than the on-the-fly
+    ** calculation done when evaluating the tree, because symbols may have
+    ** been removed from the expression, and the final numeric value is now
+    ** known.
+    */
+    if (OED_IsValid (D)) {
+        unsigned char AddrSize;
+
+        /* If there are symbols or sections, use the largest one. If the
+        ** expression resolves to a const, use the address size of the value.
+        */
+        if (D->SymCount > 0 || D->SecCount > 0) {
+
+            D->AddrSize = ADDR_SIZE_DEFAULT;
+
+            for (I = 0; I < D->SymCount; ++I) {
+                AddrSize = Funcs->SymAddrSize (D->SymRef[I].Ref);
+                if (AddrSize > D->AddrSize) {
+                    D->AddrSize = AddrSize;
+                }
+            }
+
+            for (I = 0; I < D->SecCount; ++I) {
+                unsigned SegNum = D->SecRef[0].Ref;
+                AddrSize = Funcs->SegAddrSize (SegNum);
+                if (AddrSize > D->AddrSize) {
+                    D->AddrSize = AddrSize;
+                }
+            }
+
+        } else {
+            AddrSize = GetConstAddrSize (D->Val);
+            if (AddrSize > D->AddrSize) {
+                D->AddrSize = AddrSize;
+            }
+        }
+    }
+
+    /* Restore the functions of an enclosing study */
+    Funcs = OldFuncs;
+}
@@ -0,0 +1,173 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                               objexprdesc.h                               */
+/*                                                                           */
+/*         Study expression trees for the assembler and the compiler         */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2003-2012, Ullrich von Bassewitz                                      */
+/*                Roemerstrasse 52                                           */
+/*                D-70794 Filderstadt                                        */
+/* EMail:         uz@cc65.org                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#ifndef OBJEXPRDESC_H
+#define OBJEXPRDESC_H
+
+
+
+/* common */
+#include "exprdefs.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Flags */
+#define OED_OK          0x00            /* Nothing special */
+#define OED_TOO_COMPLEX 0x01            /* Expression is too complex */
+#define OED_ERROR       0x02            /* Error evaluating the expression */
+
+/* Symbol reference. The symbol type depends on the tool. */
+typedef struct OED_SymRef OED_SymRef;
+struct OED_SymRef {
+    long                Count;          /* Number of references */
+    void*               Ref;            /* Actual reference */
+};
+
+/* Section reference */
+typedef struct OED_SecRef OED_SecRef;
+struct OED_SecRef {
+    long                Count;          /* Number of references */
+    unsigned            Ref;            /* Actual reference */
+};
+
+/* Structure for parsing expression trees */
+typedef struct ObjExprDesc ObjExprDesc;
+struct ObjExprDesc {
+    unsigned short      Flags;          /* See OED_xxx */
+    unsigned char       AddrSize;       /* Address size of the expression */
+    long                Val;            /* The offset value */
+    long                Right;          /* Right value for StudyBinaryExpr */
+
+    /* Symbol reference management */
+    unsigned            SymCount;       /* Number of symbols referenced */
+    unsigned            SymLimit;       /* Memory allocated */
+    OED_SymRef*         SymRef;         /* Symbol references */
+
+    /* Section reference management */
+    unsigned            SecCount;       /* Number of sections referenced */
+    unsigned            SecLimit;       /* Memory allocated */
+    OED_SecRef*         SecRef;         /* Section references */
+};
+
+/* The parts of studying an expression that depend on the tool */
+typedef struct StudyFuncs StudyFuncs;
+struct StudyFuncs {
+    /* Study an EXPR_SYMBOL node */
+    void                (*Symbol) (const ExprNode* Expr, ObjExprDesc* D);
+
+    /* Study an EXPR_ULABEL node, NULL if there are none */
+    void                (*ULabel) (const ExprNode* Expr, ObjExprDesc* D);
+
+    /* Return the address size of a symbol in OED_SymRef */
+    unsigned char       (*SymAddrSize) (const void* Sym);
+
+    /* Return the address size of a segment */
+    unsigned char       (*SegAddrSize) (unsigned SegNum);
+
+    /* Output an error message for the expression */
+    void                (*Error) (const char* Msg);
+};
+
+
+
+/*****************************************************************************/
+/*                             struct ObjExprDesc                            */
+/*****************************************************************************/
+
+
+
+ObjExprDesc* OED_Init (ObjExprDesc* ED);
+/* Initialize an ObjExprDesc structure for use with StudyExprTree */
+
+void OED_Done (ObjExprDesc* ED);
+/* Delete allocated memory for an ObjExprDesc. */
+
+int OED_IsConst (const ObjExprDesc* ED);
+/* Return true if the expression is constant */
+
+int OED_IsValid (const ObjExprDesc* D);
+/* Return true if the expression is valid, that is, neither the ERROR nor the
+** TOO_COMPLEX flags are set.
+*/
+
+int OED_HasError (const ObjExprDesc* D);
+/* Return true if the expression has an error. */
+
+void OED_Invalidate (ObjExprDesc* D);
+/* Set the TOO_COMPLEX flag for D */
+
+void OED_SetError (ObjExprDesc* D);
+/* Set the TOO_COMPLEX and ERROR flags for D */
+
+void OED_UpdateAddrSize (ObjExprDesc* ED, unsigned char AddrSize);
+/* Update the address size of the expression */
+
+OED_SymRef* OED_GetSymRef (ObjExprDesc* ED, void* Sym);
+/* Get a symbol reference and return it. If the symbol reference does not
+** exist, a new one is created and returned.
+*/
+
+void OED_Copy (const ObjExprDesc* From, ObjExprDesc* To);
+/* Copy the data from one ObjExprDesc to another. Old data is freed. */
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void StudyExprNode (const ExprNode* Expr, ObjExprDesc* D);
+/* Study an expression subtree and add the contents to D. This may only be
+** called from the functions passed to StudyExprTree.
+*/
+
+void StudyExprTree (const ExprNode* Expr, ObjExprDesc* D, const StudyFuncs* F);
+/* Study an expression tree and place the contents into D. The functions in F
+** handle the nodes that depend on the tool.
+*/
+
+
+
+/* End of objexprdesc.h */
+
+#endif
@@ -0,0 +1,314 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                 objspan.c                                 */
+/*                                                                           */
+/*               Spans and the debug info records that use them              */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2003-2011, Ullrich von Bassewitz                                      */
+/*                Roemerstrasse 52                                           */
+/*                D-70794 Filderstadt                                        */
+/* EMail:         uz@cc65.org                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+/* common */
+#include "check.h"
+#include "hashfunc.h"
+#include "objspan.h"
+#include "objwrite.h"
+#include "scopedefs.h"
+#include "xmalloc.h"
+
+
+
+/*****************************************************************************/
+/*                                 Forwards                                  */
+/*****************************************************************************/
+
+
+
+static unsigned HT_GenHash (const void* Key);
+/* Generate the hash over a key. */
+
+static const void* HT_GetKey (const void* Entry);
+/* Given a pointer to the user entry data, return a pointer to the key */
+
+static int HT_Compare (const void* Key1, const void* Key2);
+/* Compare two keys. The function must return a value less than zero if
+** Key1 is smaller than Key2, zero if both are equal, and a value greater
+** than zero if Key1 is greater then Key2.
+*/
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Hash table functions */
+static const HashFunctions HashFunc = {
+    HT_GenHash,
+    HT_GetKey,
+    HT_Compare
+};
+
+/* Registered spans, in the hash table and in a list sorted by id */
+static HashTable SpanTab = STATIC_HASHTABLE_INITIALIZER (1051, &HashFunc);
+static Collection SpanList = STATIC_COLLECTION_INITIALIZER;
+
+
+
+/*****************************************************************************/
+/*                           Hash table functions                            */
+/*****************************************************************************/
+
+
+
+static unsigned HT_GenHash (const void* Key)
+/* Generate the hash over a key. */
+{
+    /* Key is a span pointer */
+    const ObjSpan* S = Key;
+
+    /* Hash over a combination of segment number, start and end */
+    return HashInt ((S->Seg << 28) ^ (S->Start << 14) ^ S->End);
+}
+
+
+
+static const void* HT_GetKey (const void* Entry)
+/* Given a pointer to the user entry data, return a pointer to the key */
+{
+    return Entry;
+}
+
+
+
+static int HT_Compare (const void* Key1, const void* Key2)
+/* Compare two keys. The function must return a value less than zero if
+** Key1 is smaller than Key2, zero if both are equal, and a value greater
+** than zero if Key1 is greater then Key2.
+*/
+{
+    /* Convert both parameters to span pointers */
+    const ObjSpan* S1 = Key1;
+    const ObjSpan* S2 = Key2;
+
+    /* Compare segment number, then start and end */
+    if (S1->Seg != S2->Seg) {
+        return (S1->Seg < S2->Seg)? -1 : 1;
+    }
+    if (S1->Start != S2->Start) {
+        return (S1->Start < S2->Start)? -1 : 1;
+    }
+    if (S1->End != S2->End) {
+        return (S1->End < S2->End)? -1 : 1;
+    }
+    return 0;
+}
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+ObjSpan* NewObjSpan (unsigned Seg, unsigned long Start, unsigned long End)
+/* Create a new span without an id and type */
+{
+    /* Allocate memory */
+    ObjSpan* S = xmalloc (sizeof (ObjSpan));
+
+    /* Initialize the struct. Type zero is the empty string. */
+    InitHashNode (&S->Node);
+    S->Id       = ~0U;
+    S->Seg      = Seg;
+    S->Start    = Start;
+    S->End      = End;
+    S->Type     = 0;
+
+    /* Return the new struct */
+    return S;
+}
+
+
+
+void FreeObjSpan (ObjSpan* S)
+/* Free a span */
+{
+    xfree (S);
+}
+
+
+
+ObjSpan* RegisterObjSpan (ObjSpan* S)
+/* Assign an id to S. If a span with the same segment and range has been
+** registered before, S gets its id and the existing span is returned.
+** Otherwise S is remembered and returned.
+*/
+{
+    ObjSpan* E = HT_Find (&SpanTab, S);
+    if (E) {
+        S->Id = E->Id;
+        return E;
+    } else {
+        S->Id = CollCount (&SpanList);
+        HT_Insert (&SpanTab, S);
+        CollAppend (&SpanList, S);
+        return S;
+    }
+}
+
+
+
+void DoneObjSpans (void)
+/* Forget all registered spans. The spans themselves are freed by the caller. */
+{
+    DoneHashTable (&SpanTab);
+    DoneCollection (&SpanList);
+}
+
+
+
+void WriteObjSpanList (const Collection* Spans)
+/* Write a list of spans to the object file. Spans without an id are
+** registered first. Nothing is written if there is no debug info.
+*/
+{
+    unsigned I;
+
+    /* We only write spans if debug info is enabled */
+    if (!ObjHasDbgInfo ()) {
+        /* Number of spans is zero */
+        ObjWriteVar (0);
+    } else {
+        /* Write the number of spans */
+        ObjWriteVar (CollCount (Spans));
+
+        /* Write the spans */
+        for (I = 0; I < CollCount (Spans); ++I) {
+            /* Write the id of the next span */
+            ObjSpan* S = CollAtUnchecked (Spans, I);
+            if (S->Id == ~0U) {
+                RegisterObjSpan (S);
+            }
+            ObjWriteVar (S->Id);
+        }
+    }
+}
+
+
+
+void WriteObjSpans (void)
+/* Write all registered spans to the object file */
+{
+    /* Tell the object file module that we're about to start the spans */
+    ObjStartSpans ();
+
+    /* We will write spans only if debug symbols are requested */
+    if (ObjHasDbgInfo ()) {
+
+        unsigned I;
+
+        /* Write the span count to the file */
+        ObjWriteVar (CollCount (&SpanList));
+
+        /* Write all spans */
+        for (I = 0; I < CollCount (&SpanList); ++I) {
+
+            /* Get the span and check it */
+            const ObjSpan* S = CollConstAt (&SpanList, I);
+            CHECK (S->End > S->Start);
+
+            /* Write data for the span We will write the size instead of the
+            ** end offset to save some bytes, since most spans are expected
+            ** to be rather small.
+            */
+            ObjWriteVar (S->Seg);
+            ObjWriteVar (S->Start);
+            ObjWriteVar (S->End - S->Start);
+            ObjWriteVar (S->Type);
+        }
+
+    } else {
+
+        /* No debug info requested */
+        ObjWriteVar (0);
+
+    }
+
+    /* Done writing the spans */
+    ObjEndSpans ();
+}
+
+
+
+void WriteObjLineInfo (const FilePos* Pos, unsigned Type,
+                       const Collection* Spans)
+/* Write one line info record to the object file */
+{
+    /* Write the source file position */
+    ObjWritePos (Pos);
+
+    /* Write the type and count of the line info */
+    ObjWriteVar (Type);
+
+    /* Write the ids of the spans for this line */
+    WriteObjSpanList (Spans);
+}
+
+
+
+void WriteObjScope (unsigned ParentId, unsigned Level, unsigned Flags,
+                    unsigned Type, unsigned Name, unsigned long Size,
+                    unsigned LabelId, const Collection* Spans)
+/* Write one scope record to the object file. Size and LabelId are written
+** only if the flags say so.
+*/
+{
+    /* Id of parent scope, lexical level, flags, type and name */
+    ObjWriteVar (ParentId);
+    ObjWriteVar (Level);
+    ObjWriteVar (Flags);
+    ObjWriteVar (Type);
+    ObjWriteVar (Name);
+
+    /* If the scope has a size, write it to the file */
+    if (SCOPE_HAS_SIZE (Flags)) {
+        ObjWriteVar (Size);
+    }
+
+    /* If the scope has a label, write its id to the file */
+    if (SCOPE_HAS_LABEL (Flags)) {
+        ObjWriteVar (LabelId);
+    }
+
+    /* Spans for this scope */
+    WriteObjSpanList (Spans);
+}
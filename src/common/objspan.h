@@ -0,0 +1,111 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                 objspan.h                                 */
+/*                                                                           */
+/*               Spans and the debug info records that use them              */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2003-2011, Ullrich von Bassewitz                                      */
+/*                Roemerstrasse 52                                           */
+/*                D-70794 Filderstadt                                        */
+/* EMail:         uz@cc65.org                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#ifndef OBJSPAN_H
+#define OBJSPAN_H
+
+
+
+/* common */
+#include "coll.h"
+#include "filepos.h"
+#include "hashtab.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* A span of data within a segment */
+typedef struct ObjSpan ObjSpan;
+struct ObjSpan {
+    HashNode            Node;           /* Node for hash table */
+    unsigned            Id;             /* Id of span, ~0U if none */
+    unsigned            Seg;            /* Segment number */
+    unsigned long       Start;          /* Start of range */
+    unsigned long       End;            /* End of range */
+    unsigned            Type;           /* Type of data in span */
+};
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+ObjSpan* NewObjSpan (unsigned Seg, unsigned long Start, unsigned long End);
+/* Create a new span without an id and type */
+
+void FreeObjSpan (ObjSpan* S);
+/* Free a span */
+
+ObjSpan* RegisterObjSpan (ObjSpan* S);
+/* Assign an id to S. If a span with the same segment and range has been
+** registered before, S gets its id and the existing span is returned.
+** Otherwise S is remembered and returned.
+*/
+
+void DoneObjSpans (void);
+/* Forget all registered spans. The spans themselves are freed by the caller. */
+
+void WriteObjSpanList (const Collection* Spans);
+/* Write a list of spans to the object file. Spans without an id are
+** registered first. Nothing is written if there is no debug info.
+*/
+
+void WriteObjSpans (void);
+/* Write all registered spans to the object file */
+
+void WriteObjLineInfo (const FilePos* Pos, unsigned Type,
+                       const Collection* Spans);
+/* Write one line info record to the object file */
+
+void WriteObjScope (unsigned ParentId, unsigned Level, unsigned Flags,
+                    unsigned Type, unsigned Name, unsigned long Size,
+                    unsigned LabelId, const Collection* Spans);
+/* Write one scope record to the object file. Size and LabelId are written
+** only if the flags say so.
+*/
+
+
+
+/* End of objspan.h */
+
+#endif
@@ -1,8 +1,8 @@
 /*****************************************************************************/
 /*                                                                           */
-/*                                 objfile.c                                 */
+/*                                objwrite.c                                 */
 /*                                                                           */
-/*         Object file writing routines for the ca65 macroassembler          */
+/*      Object file writing routines for the assembler and the compiler      */
 /*                                                                           */
 /*                                                                           */
 /*                                                                           */
@@ -39,13 +39,9 @@
 #include <errno.h>
 
 /* common */
-#include "fname.h"
+#include "abend.h"
 #include "objdefs.h"
-
-/* ca65 */
-#include "global.h"
-#include "error.h"
-#include "objfile.h"
+#include "objwrite.h"
 
 
 
@@ -55,11 +51,9 @@
 
 
 
-/* File descriptor */
-static FILE* F = 0;
-
-/* Default extension */
-#define OBJ_EXT ".o"
+/* File descriptor and name */
+static FILE*       F        = 0;
+static const char* FileName = 0;
 
 /* Header structure */
 static ObjHeader Header = {
@@ -110,10 +104,10 @@ static void ObjWriteError (void)
     fclose (F);
 
     /* Try to remove the file, also ignoring errors */
-    remove (OutFile);
+    remove (FileName);
 
     /* Now abort with a fatal error */
-    Fatal ("Cannot write to output file '%s': %s", OutFile, strerror (Error));
+    AbEnd ("Cannot write to output file '%s': %s", FileName, strerror (Error));
 }
 
 
@@ -156,42 +150,34 @@ static void ObjWriteHeader (void)
 
 
 
-void ObjOpen (void)
-/* Open the object file for writing, write a dummy header */
+void ObjOpen (const char* Name, unsigned Flags)
+/* Open the object file with the given name for writing, write a dummy
+** header. The name must stay valid until the file is closed. Flags are the
+** OBJ_FLAGS_xxx for the header.
+*/
 {
-    /* Do we have a name for the output file? */
-    if (OutFile == 0) {
-        /* We don't have an output name explicitly given, construct one from
-        ** the name of the input file.
-        */
-        OutFile = MakeFilename (InFile, OBJ_EXT);
-    }
-
     /* Create the output file */
-    F = fopen (OutFile, "w+b");
+    FileName = Name;
+    F = fopen (FileName, "w+b");
     if (F == 0) {
-        Fatal ("Cannot open output file '%s': %s", OutFile, strerror (errno));
+        AbEnd ("Cannot open output file '%s': %s", FileName, strerror (errno));
     }
 
     /* Write a dummy header */
+    Header.Flags = Flags;
     ObjWriteHeader ();
 }
 
 
 
 void ObjClose (void)
-/* Write an update header and close the object file. */
+/* Write an update header and close the object file */
 {
     /* Go back to the beginning */
     if (fseek (F, 0, SEEK_SET) != 0) {
         ObjWriteError ();
     }
 
-    /* If we have debug infos, set the flag in the header */
-    if (DbgSyms) {
-        Header.Flags |= OBJ_FLAGS_DBGINFO;
-    }
-
     /* Write the updated header */
     ObjWriteHeader ();
 
@@ -199,6 +185,15 @@ void ObjClose (void)
     if (fclose (F) != 0) {
         ObjWriteError ();
     }
+    F = 0;
+}
+
+
+
+int ObjHasDbgInfo (void)
+/* Return true if the object file contains debug info */
+{
+    return OBJ_HAS_DBGINFO (Header.Flags);
 }
 
 
@@ -339,6 +334,31 @@ void ObjWritePos (const FilePos* Pos)
 
 
 
+void ObjWriteStrPool (const StringPool* P)
+/* Write the string pool section to the object file */
+{
+    unsigned I;
+
+    /* Get the number of strings in the string pool */
+    unsigned Count = SP_GetCount (P);
+
+    /* Tell the object file module that we're about to start the string pool */
+    ObjStartStrPool ();
+
+    /* Write the string count to the list */
+    ObjWriteVar (Count);
+
+    /* Write the strings in id order */
+    for (I = 0; I < Count; ++I) {
+        ObjWriteBuf (SP_Get (P, I));
+    }
+
+    /* Done writing the string pool */
+    ObjEndStrPool ();
+}
+
+
+
 void ObjStartOptions (void)
 /* Mark the start of the option section */
 {
@@ -1,8 +1,8 @@
 /*****************************************************************************/
 /*                                                                           */
-/*                                 objfile.h                                 */
+/*                                objwrite.h                                 */
 /*                                                                           */
-/*         Object file writing routines for the ca65 macroassembler          */
+/*      Object file writing routines for the assembler and the compiler      */
 /*                                                                           */
 /*                                                                           */
 /*                                                                           */
@@ -33,14 +33,15 @@
 
 
 
-#ifndef OBJFILE_H
-#define OBJFILE_H
+#ifndef OBJWRITE_H
+#define OBJWRITE_H
 
 
 
 /* common */
 #include "filepos.h"
 #include "strbuf.h"
+#include "strpool.h"
 
 
 
@@ -50,11 +51,17 @@
 
 
 
-void ObjOpen (void);
-/* Open the object file for writing, write a dummy header */
+void ObjOpen (const char* Name, unsigned Flags);
+/* Open the object file with the given name for writing, write a dummy
+** header. The name must stay valid until the file is closed. Flags are the
+** OBJ_FLAGS_xxx for the header.
+*/
 
 void ObjClose (void);
-/* Write an update header and close the object file. */
+/* Write an update header and close the object file */
+
+int ObjHasDbgInfo (void);
+/* Return true if the object file contains debug info */
 
 unsigned long ObjGetFilePos (void);
 /* Get the current file position */
@@ -89,6 +96,9 @@ void ObjWriteData (const void* Data, unsigned Size);
 void ObjWritePos (const FilePos* Pos);
 /* Write a file position to the object file */
 
+void ObjWriteStrPool (const StringPool* P);
+/* Write the string pool section to the object file */
+
 void ObjStartOptions (void);
 /* Mark the start of the option section */
 
@@ -157,6 +167,6 @@ void ObjEndSpans (void);
 
 
 
-/* End of objfile.h */
+/* End of objwrite.h */
 
 #endif
@@ -46,6 +46,7 @@
 
 /* Segment flags */
 #define SEG_FLAG_NONE           0x00
+#define SEG_FLAG_CONTINUED      0x01    /* Continues the preceding section */
 
 
 
@@ -59,6 +59,23 @@
 #define VER_MAJOR       2U
 #define VER_MINOR       0U
 
+/* The binary format contains the same lines as the text format, encoded as a
+** stream of tokens. All names, keywords and strings are stored in a string
+** table at the end of the file, its offset follows the magic number. Numbers
+** use the variable length encoding from the object files. These definitions
+** must match the ones in ld65.
+*/
+static const unsigned char BinMagic[4] = { 0x7F, 'D', 'B', 'G' };
+#define BIN_HEADER_SIZE 8               /* Magic and string table offset */
+#define BIN_EOL         0x00            /* End of line */
+#define BIN_LINE        0x01            /* Start of line, keyword follows */
+#define BIN_ATTR        0x02            /* Attribute, keyword follows */
+#define BIN_INT         0x03            /* Number follows */
+#define BIN_NEG         0x04            /* Negated number follows */
+#define BIN_STR         0x05            /* String follows */
+#define BIN_IDENT       0x06            /* Keyword as value follows */
+#define BIN_PLUS        0x07            /* Separator for list items */
+
 /* Dynamic strings */
 typedef struct StrBuf StrBuf;
 struct StrBuf {
@@ -217,6 +234,14 @@ struct DbgInfo {
     char                FileName[1];    /* Name of input file */
 };
 
+/* An entry in the string table of a binary debug file */
+typedef struct BinString BinString;
+struct BinString {
+    const char*         Str;            /* Zero terminated string */
+    unsigned            Len;            /* Length of the string */
+    Token               Tok;            /* Token if the string is a keyword */
+};
+
 /* Data used when parsing the debug info file */
 typedef struct InputData InputData;
 struct InputData {
@@ -226,13 +251,26 @@ struct InputData {
     cc65_line           SLine;          /* Line number at start of token */
     unsigned            SCol;           /* Column number at start of token */
     unsigned            Errors;         /* Number of errors */
-    FILE*               F;              /* Input file */
+    unsigned char*      Buf;            /* Contents of the input file */
+    unsigned long       Size;           /* Size of the input file */
+    unsigned long       Pos;            /* Read position in Buf */
+    unsigned long       End;            /* End of the token data in Buf */
     int                 C;              /* Input character */
     Token               Tok;            /* Token from input stream */
     unsigned long       IVal;           /* Integer constant */
     StrBuf              SVal;           /* String constant */
     cc65_errorfunc      Error;          /* Function called in case of errors */
     DbgInfo*            Info;           /* Pointer to debug info */
+
+    /* Binary input */
+    int                 Binary;         /* True if the input is binary */
+    BinString*          BinStrings;     /* String table */
+    unsigned            BinStrCount;    /* Number of strings in the table */
+    char*               BinStrBuf;      /* Memory for the strings */
+    unsigned            BinAttrs;       /* Attributes in the current line */
+    unsigned            PendingCount;   /* Number of implied tokens */
+    Token               PendingTok[2];  /* Implied tokens */
+    unsigned long       PendingVal[2];  /* Values of the implied tokens */
 };
 
 /* Typedefs for the item structures. Do also serve as forwards */
@@ -2502,6 +2540,26 @@ static int DigitVal (int C)
 
 
 
+static unsigned long ReadBinVar (InputData* D)
+/* Read a variable sized value from a binary debug file */
+{
+    unsigned long V = 0;
+    unsigned Shift = 0;
+    unsigned char C;
+    do {
+        if (D->Pos >= D->End) {
+            ParseError (D, CC65_ERROR, "Unexpected end of binary data");
+            return 0;
+        }
+        C = D->Buf[D->Pos++];
+        V |= ((unsigned long) (C & 0x7F)) << Shift;
+        Shift += 7;
+    } while (C & 0x80);
+    return V;
+}
+
+
+
 static void NextChar (InputData* D)
 /* Read the next character from the input. Count lines and columns */
 {
@@ -2511,69 +2569,216 @@ static void NextChar (InputData* D)
             ++D->Line;
             D->Col = 0;
         }
-        D->C = fgetc (D->F);
+        D->C = (D->Pos < D->End)? D->Buf[D->Pos++] : EOF;
         ++D->Col;
     }
 }
 
 
 
+/* Keywords in the debug info file */
+static const struct KeywordEntry {
+    const char      Keyword[12];
+    Token           Tok;
+} KeywordTable[] = {
+    { "abs",        TOK_ABSOLUTE    },
+    { "addrsize",   TOK_ADDRSIZE    },
+    { "auto",       TOK_AUTO        },
+    { "count",      TOK_COUNT       },
+    { "csym",       TOK_CSYM        },
+    { "def",        TOK_DEF         },
+    { "enum",       TOK_ENUM        },
+    { "equ",        TOK_EQUATE      },
+    { "exp",        TOK_EXPORT      },
+    { "ext",        TOK_EXTERN      },
+    { "file",       TOK_FILE        },
+    { "func",       TOK_FUNC        },
+    { "global",     TOK_GLOBAL      },
+    { "id",         TOK_ID          },
+    { "imp",        TOK_IMPORT      },
+    { "info",       TOK_INFO        },
+    { "lab",        TOK_LABEL       },
+    { "lib",        TOK_LIBRARY     },
+    { "line",       TOK_LINE        },
+    { "long",       TOK_LONG        },
+    { "major",      TOK_MAJOR       },
+    { "minor",      TOK_MINOR       },
+    { "mod",        TOK_MODULE      },
+    { "mtime",      TOK_MTIME       },
+    { "name",       TOK_NAME        },
+    { "offs",       TOK_OFFS        },
+    { "oname",      TOK_OUTPUTNAME  },
+    { "ooffs",      TOK_OUTPUTOFFS  },
+    { "parent",     TOK_PARENT      },
+    { "ref",        TOK_REF         },
+    { "reg",        TOK_REGISTER    },
+    { "ro",         TOK_RO          },
+    { "rw",         TOK_RW          },
+    { "sc",         TOK_SC          },
+    { "scope",      TOK_SCOPE       },
+    { "seg",        TOK_SEGMENT     },
+    { "size",       TOK_SIZE        },
+    { "span",       TOK_SPAN        },
+    { "start",      TOK_START       },
+    { "static",     TOK_STATIC      },
+    { "struct",     TOK_STRUCT      },
+    { "sym",        TOK_SYM         },
+    { "type",       TOK_TYPE        },
+    { "val",        TOK_VALUE       },
+    { "var",        TOK_VAR         },
+    { "version",    TOK_VERSION     },
+    { "zp",         TOK_ZEROPAGE    },
+};
+
+
+
+static Token FindKeyword (const char* Name)
+/* Return the token for a keyword. Return TOK_IDENT if Name isn't a keyword */
+{
+    const struct KeywordEntry* Entry = bsearch (
+        Name,
+        KeywordTable,
+        sizeof (KeywordTable) / sizeof (KeywordTable[0]),
+        sizeof (KeywordTable[0]),
+        (int (*)(const void*, const void*)) strcmp
+    );
+    return (Entry == 0)? TOK_IDENT : Entry->Tok;
+}
+
+
+
+static void BinStringToken (InputData* D, unsigned long Index, int Keyword)
+/* Set the current token from the entry with the given index in the string
+** table of a binary debug file. If Keyword is true, the string is a keyword,
+** otherwise it is a string constant.
+*/
+{
+    const BinString* S;
+
+    if (Index >= D->BinStrCount) {
+        ParseError (D, CC65_ERROR, "Invalid string index %lu", Index);
+        D->Pos = D->End;
+        D->PendingCount = 0;
+        D->Tok = TOK_EOF;
+        return;
+    }
+
+    S = D->BinStrings + Index;
+    SB_CopyBuf (&D->SVal, S->Str, S->Len);
+    SB_Terminate (&D->SVal);
+    D->Tok = Keyword? S->Tok : TOK_STRCON;
+}
+
+
+
+static void PushBinToken (InputData* D, Token Tok, unsigned long Val)
+/* Remember a token that follows the current one. For TOK_INTCON, Val is the
+** value, for TOK_IDENT it is the index of a keyword in the string table.
+*/
+{
+    assert (D->PendingCount < sizeof (D->PendingTok) / sizeof (D->PendingTok[0]));
+    D->PendingTok[D->PendingCount] = Tok;
+    D->PendingVal[D->PendingCount] = Val;
+    ++D->PendingCount;
+}
+
+
+
+static void NextBinToken (InputData* D)
+/* Read the next token from a binary debug file. The binary file contains
+** the same tokens as a text file, but the separators are implied.
+*/
+{
+    unsigned long Val;
+
+    /* Handle tokens implied by the last one */
+    if (D->PendingCount > 0) {
+        Token Tok = D->PendingTok[0];
+        Val = D->PendingVal[0];
+        D->PendingTok[0] = D->PendingTok[1];
+        D->PendingVal[0] = D->PendingVal[1];
+        --D->PendingCount;
+        if (Tok == TOK_IDENT) {
+            BinStringToken (D, Val, 1);
+        } else {
+            D->IVal = Val;
+            D->Tok  = Tok;
+        }
+        return;
+    }
+
+    /* Use the record number as line number for error messages */
+    D->SLine = D->Line;
+    D->SCol  = 0;
+
+    if (D->Pos >= D->End) {
+        D->Tok = TOK_EOF;
+        return;
+    }
+
+    switch (D->Buf[D->Pos++]) {
+
+        case BIN_EOL:
+            ++D->Line;
+            D->Tok = TOK_EOL;
+            break;
+
+        case BIN_LINE:
+            D->BinAttrs = 0;
+            BinStringToken (D, ReadBinVar (D), 1);
+            break;
+
+        case BIN_ATTR:
+            Val = ReadBinVar (D);
+            if (D->BinAttrs++ == 0) {
+                BinStringToken (D, Val, 1);
+            } else {
+                D->Tok = TOK_COMMA;
+                PushBinToken (D, TOK_IDENT, Val);
+            }
+            PushBinToken (D, TOK_EQUAL, 0);
+            break;
+
+        case BIN_INT:
+            D->IVal = ReadBinVar (D);
+            D->Tok  = TOK_INTCON;
+            break;
+
+        case BIN_NEG:
+            D->Tok = TOK_MINUS;
+            PushBinToken (D, TOK_INTCON, ReadBinVar (D));
+            break;
+
+        case BIN_STR:
+            BinStringToken (D, ReadBinVar (D), 0);
+            break;
+
+        case BIN_IDENT:
+            BinStringToken (D, ReadBinVar (D), 1);
+            break;
+
+        case BIN_PLUS:
+            D->Tok = TOK_PLUS;
+            break;
+
+        default:
+            ParseError (D, CC65_ERROR, "Invalid token in binary data");
+            D->Pos = D->End;
+            D->Tok = TOK_EOF;
+            break;
+    }
+}
+
+
+
 static void NextToken (InputData* D)
 /* Read the next token from the input stream */
 {
-    static const struct KeywordEntry  {
-        const char      Keyword[12];
-        Token           Tok;
-    } KeywordTable[] = {
-        { "abs",        TOK_ABSOLUTE    },
-        { "addrsize",   TOK_ADDRSIZE    },
-        { "auto",       TOK_AUTO        },
-        { "count",      TOK_COUNT       },
-        { "csym",       TOK_CSYM        },
-        { "def",        TOK_DEF         },
-        { "enum",       TOK_ENUM        },
-        { "equ",        TOK_EQUATE      },
-        { "exp",        TOK_EXPORT      },
-        { "ext",        TOK_EXTERN      },
-        { "file",       TOK_FILE        },
-        { "func",       TOK_FUNC        },
-        { "global",     TOK_GLOBAL      },
-        { "id",         TOK_ID          },
-        { "imp",        TOK_IMPORT      },
-        { "info",       TOK_INFO        },
-        { "lab",        TOK_LABEL       },
-        { "lib",        TOK_LIBRARY     },
-        { "line",       TOK_LINE        },
-        { "long",       TOK_LONG        },
-        { "major",      TOK_MAJOR       },
-        { "minor",      TOK_MINOR       },
-        { "mod",        TOK_MODULE      },
-        { "mtime",      TOK_MTIME       },
-        { "name",       TOK_NAME        },
-        { "offs",       TOK_OFFS        },
-        { "oname",      TOK_OUTPUTNAME  },
-        { "ooffs",      TOK_OUTPUTOFFS  },
-        { "parent",     TOK_PARENT      },
-        { "ref",        TOK_REF         },
-        { "reg",        TOK_REGISTER    },
-        { "ro",         TOK_RO          },
-        { "rw",         TOK_RW          },
-        { "sc",         TOK_SC          },
-        { "scope",      TOK_SCOPE       },
-        { "seg",        TOK_SEGMENT     },
-        { "size",       TOK_SIZE        },
-        { "span",       TOK_SPAN        },
-        { "start",      TOK_START       },
-        { "static",     TOK_STATIC      },
-        { "struct",     TOK_STRUCT      },
-        { "sym",        TOK_SYM         },
-        { "type",       TOK_TYPE        },
-        { "val",        TOK_VALUE       },
-        { "var",        TOK_VAR         },
-        { "version",    TOK_VERSION     },
-        { "zp",         TOK_ZEROPAGE    },
-    };
-
+    /* Binary input has its own tokenizer */
+    if (D->Binary) {
+        NextBinToken (D);
+        return;
+    }
 
     /* Skip whitespace */
     while (D->C == ' ' || D->C == '\t' || D->C == '\r') {
@@ -2587,8 +2792,6 @@ static void NextToken (InputData* D)
     /* Identifier? */
     if (D->C == '_' || isalpha (D->C)) {
 
-        const struct KeywordEntry* Entry;
-
         /* Read the identifier */
         SB_Clear (&D->SVal);
         while (D->C == '_' || isalnum (D->C)) {
@@ -2598,16 +2801,7 @@ static void NextToken (InputData* D)
         SB_Terminate (&D->SVal);
 
         /* Search the identifier in the keyword table */
-        Entry = bsearch (SB_GetConstBuf (&D->SVal),
-                         KeywordTable,
-                         sizeof (KeywordTable) / sizeof (KeywordTable[0]),
-                         sizeof (KeywordTable[0]),
-                         (int (*)(const void*, const void*)) strcmp);
-        if (Entry == 0) {
-            D->Tok = TOK_IDENT;
-        } else {
-            D->Tok = Entry->Tok;
-        }
+        D->Tok = FindKeyword (SB_GetConstBuf (&D->SVal));
         return;
     }
 
@@ -4154,7 +4348,6 @@ static void ParseSym (InputData* D)
     */
     Collection          DefLineIds = COLLECTION_INITIALIZER;
     unsigned            ExportId = CC65_INV_ID;
-    unsigned            FileId = CC65_INV_ID;
     unsigned            Id = CC65_INV_ID;
     StrBuf              Name = STRBUF_INITIALIZER;
     unsigned            ParentId = CC65_INV_ID;
@@ -4256,7 +4449,6 @@ static void ParseSym (InputData* D)
                 if (!IntConstFollows (D)) {
                     goto ErrorExit;
                 }
-                FileId = D->IVal;
                 InfoBits |= ibFileId;
                 NextToken (D);
                 break;
@@ -4659,50 +4851,6 @@ static int FindCSymInfoByName (const Collection* CSymInfos, const char* Name,
 
 
 
-static int FindFileInfoByName (const Collection* FileInfos, const char* Name,
-                               unsigned* Index)
-/* Find the FileInfo for a given file name. The function returns true if the
-** name was found. In this case, Index contains the index of the first item
-** that matches. If the item wasn't found, the function returns false and
-** Index contains the insert position for Name.
-*/
-{
-    /* Do a binary search */
-    int Lo = 0;
-    int Hi = (int) CollCount (FileInfos) - 1;
-    int Found = 0;
-    while (Lo <= Hi) {
-
-        /* Mid of range */
-        int Cur = (Lo + Hi) / 2;
-
-        /* Get item */
-        const FileInfo* CurItem = CollAt (FileInfos, Cur);
-
-        /* Compare */
-        int Res = strcmp (CurItem->Name, Name);
-
-        /* Found? */
-        if (Res < 0) {
-            Lo = Cur + 1;
-        } else {
-            Hi = Cur - 1;
-            /* Since we may have duplicates, repeat the search until we've
-            ** the first item that has a match.
-            */
-            if (Res == 0) {
-                Found = 1;
-            }
-        }
-    }
-
-    /* Pass back the index. This is also the insert position */
-    *Index = Lo;
-    return Found;
-}
-
-
-
 static SpanInfoListEntry* FindSpanInfoByAddr (const SpanInfoList* L, cc65_addr Addr)
 /* Find the index of a SpanInfo for a given address. Returns 0 if no such
 ** SpanInfo was found.
@@ -5589,6 +5737,90 @@ static void ProcessSymInfo (InputData* D)
 
 
 
+static int ReadInput (InputData* D, FILE* F)
+/* Read the complete input file into memory. Return true on success */
+{
+    long Size;
+
+    if (fseek (F, 0, SEEK_END) != 0 || (Size = ftell (F)) < 0 ||
+        fseek (F, 0, SEEK_SET) != 0) {
+        ParseError (D, CC65_ERROR, "Cannot read input file \"%s\": %s",
+                    D->FileName, strerror (errno));
+        return 0;
+    }
+
+    D->Buf  = xmalloc (Size + 1);
+    D->Size = Size;
+    D->End  = Size;
+    if (fread (D->Buf, 1, Size, F) != (size_t) Size) {
+        ParseError (D, CC65_ERROR, "Cannot read input file \"%s\"",
+                    D->FileName);
+        return 0;
+    }
+    return 1;
+}
+
+
+
+static int ReadBinStrings (InputData* D)
+/* Read the string table of a binary debug file and prepare reading the
+** tokens. Return true on success.
+*/
+{
+    unsigned long StrOffs;
+    unsigned      I;
+    char*         P;
+
+    /* Get the offset of the string table from the header */
+    if (D->Size < BIN_HEADER_SIZE) {
+        ParseError (D, CC65_ERROR, "Invalid binary debug info file");
+        return 0;
+    }
+    StrOffs = (unsigned long) D->Buf[4]         |
+              ((unsigned long) D->Buf[5] << 8)  |
+              ((unsigned long) D->Buf[6] << 16) |
+              ((unsigned long) D->Buf[7] << 24);
+    if (StrOffs < BIN_HEADER_SIZE || StrOffs >= D->Size) {
+        ParseError (D, CC65_ERROR, "Invalid binary debug info file");
+        return 0;
+    }
+
+    /* Each string needs at least one byte for the length */
+    D->Pos = StrOffs;
+    D->BinStrCount = ReadBinVar (D);
+    if (D->BinStrCount > D->Size - D->Pos) {
+        ParseError (D, CC65_ERROR, "Invalid string table in binary file");
+        return 0;
+    }
+
+    /* Copy the strings, so they can be zero terminated */
+    D->BinStrings = xmalloc (D->BinStrCount * sizeof (BinString));
+    D->BinStrBuf  = P = xmalloc (D->Size - StrOffs + D->BinStrCount);
+    for (I = 0; I < D->BinStrCount; ++I) {
+        BinString* S = D->BinStrings + I;
+        unsigned long Len = ReadBinVar (D);
+        if (Len > D->Size - D->Pos) {
+            ParseError (D, CC65_ERROR, "Invalid string table in binary file");
+            return 0;
+        }
+        memcpy (P, D->Buf + D->Pos, Len);
+        P[Len] = '\0';
+        D->Pos += Len;
+        S->Str = P;
+        S->Len = Len;
+        S->Tok = FindKeyword (P);
+        P += Len + 1;
+    }
+
+    /* The tokens are located between header and string table */
+    D->Pos    = BIN_HEADER_SIZE;
+    D->End    = StrOffs;
+    D->Binary = 1;
+    return D->Errors == 0;
+}
+
+
+
 cc65_dbginfo cc65_read_dbginfo (const char* FileName, cc65_errorfunc ErrFunc)
 /* Parse the debug info file with the given name. On success, the function
 ** will return a pointer to an opaque cc65_dbginfo structure, that must be
@@ -5605,20 +5837,34 @@ cc65_dbginfo cc65_read_dbginfo (const char* FileName, cc65_errorfunc ErrFunc)
         0,                      /* Line at start of current token */
         0,                      /* Column at start of current token */
         0,                      /* Number of errors */
-        0,                      /* Input file */
+        0,                      /* Contents of input file */
+        0,                      /* Size of input file */
+        0,                      /* Read position */
+        0,                      /* End of token data */
         ' ',                    /* Input character */
         TOK_INVALID,            /* Input token */
         0,                      /* Integer constant */
         STRBUF_INITIALIZER,     /* String constant */
         0,                      /* Function called in case of errors */
         0,                      /* Pointer to debug info */
+        0,                      /* Binary input */
+        0,                      /* String table */
+        0,                      /* Number of strings */
+        0,                      /* Memory for the strings */
+        0,                      /* Attributes in current line */
+        0,                      /* Number of implied tokens */
+        { TOK_INVALID, TOK_INVALID },   /* Implied tokens */
+        { 0, 0 },               /* Values of implied tokens */
     };
+    FILE* F;
+    int   Ok;
+
     D.FileName = FileName;
     D.Error    = ErrFunc;
 
     /* Open the input file */
-    D.F = fopen (FileName, "rt");
-    if (D.F == 0) {
+    F = fopen (FileName, "rb");
+    if (F == 0) {
         /* Cannot open */
         ParseError (&D, CC65_ERROR,
                     "Cannot open input file \"%s\": %s",
@@ -5626,6 +5872,22 @@ cc65_dbginfo cc65_read_dbginfo (const char* FileName, cc65_errorfunc ErrFunc)
         return 0;
     }
 
+    /* Read the whole file into memory. If it is a binary debug info file,
+    ** read the string table.
+    */
+    Ok = ReadInput (&D, F);
+    fclose (F);
+    if (Ok && D.Size >= sizeof (BinMagic) &&
+        memcmp (D.Buf, BinMagic, sizeof (BinMagic)) == 0) {
+        Ok = ReadBinStrings (&D);
+    }
+    if (!Ok) {
+        xfree (D.Buf);
+        xfree (D.BinStrings);
+        xfree (D.BinStrBuf);
+        return 0;
+    }
+
     /* Create a new debug info struct */
     D.Info = NewDbgInfo (FileName);
 
@@ -5746,8 +6008,10 @@ cc65_dbginfo cc65_read_dbginfo (const char* FileName, cc65_errorfunc ErrFunc)
     }
 
 CloseAndExit:
-    /* Close the file */
-    fclose (D.F);
+    /* Free the input data */
+    xfree (D.Buf);
+    xfree (D.BinStrings);
+    xfree (D.BinStrBuf);
 
     /* Free memory allocated for SVal */
     SB_Done (&D.SVal);
@@ -100,6 +100,14 @@ Assertion* ReadAssertion (FILE* F, struct ObjData* O)
 
 
 
+ExprNode* GetAssertionExpr (const Assertion* A)
+/* Return the expression of the given assertion */
+{
+    return A->Expr;
+}
+
+
+
 void CheckAssertions (void)
 /* Check all assertions */
 {
@@ -57,6 +57,9 @@ typedef struct Assertion Assertion;
 /* ObjData forward decl */
 struct ObjData;
 
+/* ExprNode forward decl */
+struct ExprNode;
+
 
 
 /*****************************************************************************/
@@ -68,6 +71,9 @@ struct ObjData;
 Assertion* ReadAssertion (FILE* F, struct ObjData* O);
 /* Read an assertion from the given file */
 
+struct ExprNode* GetAssertionExpr (const Assertion* A);
+/* Return the expression of the given assertion */
+
 void CheckAssertions (void);
 /* Check all assertions */
 
@@ -54,6 +54,7 @@
 #include "memarea.h"
 #include "segments.h"
 #include "spool.h"
+#include "uptodate.h"
 
 
 
@@ -295,6 +296,7 @@ void BinWriteTarget (BinDesc* D, struct File* F)
     if (D->F == 0) {
         Error ("Cannot open '%s': %s", D->Filename, strerror (errno));
     }
+    UpToDateAddOutput (D->Filename);
 
     /* Keep the user happy */
     Print (stdout, 1, "Opened '%s'...\n", D->Filename);
@@ -46,6 +46,7 @@
 #include "addrsize.h"
 #include "bitops.h"
 #include "check.h"
+#include "idtab.h"
 #include "print.h"
 #include "segdefs.h"
 #include "target.h"
@@ -62,10 +63,12 @@
 #include "error.h"
 #include "exports.h"
 #include "expr.h"
+#include "gc.h"
 #include "global.h"
 #include "memarea.h"
 #include "o65.h"
 #include "objdata.h"
+#include "relax.h"
 #include "scanner.h"
 #include "spool.h"
 #include "xex.h"
@@ -97,6 +100,9 @@ static Collection       FileList = STATIC_COLLECTION_INITIALIZER;
 /* Memory list */
 static Collection       MemoryAreas = STATIC_COLLECTION_INITIALIZER;
 
+/* Memory areas by name */
+static IdTable          MemoryTab = STATIC_IDTABLE_INITIALIZER;
+
 /* Memory attributes */
 #define MA_START        0x0001
 #define MA_SIZE         0x0002
@@ -121,6 +127,7 @@ static Collection       SegDescList = STATIC_COLLECTION_INITIALIZER;
 #define SA_START        0x0080
 #define SA_OPTIONAL     0x0100
 #define SA_FILLVAL      0x0200
+#define SA_KEEP         0x0400
 
 /* Symbol types used in the CfgSymbol structure */
 typedef enum {
@@ -211,14 +218,7 @@ static void FileInsert (File* F, MemoryArea* M)
 static MemoryArea* CfgFindMemory (unsigned Name)
 /* Find the memory are with the given name. Return NULL if not found */
 {
-    unsigned I;
-    for (I = 0; I < CollCount (&MemoryAreas); ++I) {
-        MemoryArea* M = CollAtUnchecked (&MemoryAreas, I);
-        if (M->Name == Name) {
-            return M;
-        }
-    }
-    return 0;
+    return IT_Find (&MemoryTab, Name);
 }
 
 
@@ -329,8 +329,9 @@ static MemoryArea* CreateMemoryArea (const FilePos* Pos, unsigned Name)
     /* Create a new memory area */
     M = NewMemoryArea (Pos, Name);
 
-    /* Insert the struct into the list ... */
+    /* Insert the struct into the list and the table ... */
     CollAppend (&MemoryAreas, M);
+    IT_Insert (&MemoryTab, Name, M);
 
     /* ...and return it */
     return M;
@@ -648,6 +649,7 @@ static void ParseSegments (void)
         {   "ALIGN_LOAD",       CFGTOK_ALIGN_LOAD       },
         {   "DEFINE",           CFGTOK_DEFINE           },
         {   "FILLVAL",          CFGTOK_FILLVAL          },
+        {   "KEEP",             CFGTOK_KEEP             },
         {   "LOAD",             CFGTOK_LOAD             },
         {   "OFFSET",           CFGTOK_OFFSET           },
         {   "OPTIONAL",         CFGTOK_OPTIONAL         },
@@ -730,6 +732,15 @@ static void ParseSegments (void)
                     CfgNextTok ();
                     break;
 
+                case CFGTOK_KEEP:
+                    FlagAttr (&S->Attr, SA_KEEP, "KEEP");
+                    CfgBoolToken ();
+                    if (CfgTok == CFGTOK_TRUE) {
+                        S->Flags |= SF_KEEP;
+                    }
+                    CfgNextTok ();
+                    break;
+
                 case CFGTOK_OFFSET:
                     FlagAttr (&S->Attr, SA_OFFSET, "OFFSET");
                     S->Addr   = CfgCheckedConstExpr (0, 0x1000000);
@@ -1674,6 +1685,120 @@ void CfgRead (void)
 
 
 
+static void CollectGarbage (void)
+/* Remove the data of all sections that are not referenced. Segments with the
+** KEEP attribute and symbols exported in o65 format are used as additional
+** roots.
+*/
+{
+    unsigned I;
+
+    /* Keep all sections of segments marked with KEEP */
+    for (I = 0; I < CollCount (&SegDescList); ++I) {
+        const SegDesc* S = CollAtUnchecked (&SegDescList, I);
+        if (S->Flags & SF_KEEP) {
+            Segment* Seg = SegFind (S->Name);
+            if (Seg) {
+                GCKeepSegment (Seg);
+            }
+        }
+    }
+
+    /* Keep the symbols exported in o65 format */
+    for (I = 0; I < CollCount (&CfgSymbols); ++I) {
+        const CfgSymbol* Sym = CollAtUnchecked (&CfgSymbols, I);
+        if (Sym->Type == CfgSymO65Export) {
+            GCKeepExport (FindExport (Sym->Name));
+        }
+    }
+
+    /* Remove everything else that is not referenced */
+    GCRemoveSections ();
+}
+
+
+
+static void PlaceSegmentsForRelax (void)
+/* Assign preliminary start addresses to the segments, so the relaxable
+** instructions can be checked. This follows the rules of CfgProcess but
+** doesn't define any symbols or check for errors. Memory areas whose start
+** address depends on the final placement are skipped.
+*/
+{
+    unsigned I, J;
+
+    for (I = 0; I < CollCount (&MemoryAreas); ++I) {
+
+        unsigned long Addr;
+
+        /* Get the next memory area */
+        MemoryArea* M = CollAtUnchecked (&MemoryAreas, I);
+
+        /* Resolve the start address */
+        M->Relocatable = RelocatableBinFmt (M->F->Format);
+        if (!IsConstExpr (M->StartExpr)) {
+            continue;
+        }
+        Addr = M->Start = GetExprVal (M->StartExpr);
+        M->Flags |= MF_PLACED;
+
+        /* Walk through the segments in this memory area */
+        for (J = 0; J < CollCount (&M->SegList); ++J) {
+
+            SegDesc* S = CollAtUnchecked (&M->SegList, J);
+
+            if (S->Run == M) {
+                if (S->Flags & SF_ALIGN) {
+                    Addr = AlignAddr (Addr, S->RunAlignment);
+                } else if (S->Flags & (SF_OFFSET | SF_START)) {
+                    unsigned long NewAddr = S->Addr;
+                    if (S->Flags & SF_OFFSET) {
+                        NewAddr += M->Start;
+                    }
+                    if (NewAddr >= ((S->Flags & SF_OVERWRITE)? M->Start : Addr)) {
+                        Addr = NewAddr;
+                    }
+                }
+                S->Seg->PC      = Addr;
+                S->Seg->MemArea = M;
+            } else if (S->Load == M && (S->Flags & SF_ALIGN_LOAD)) {
+                Addr = AlignAddr (Addr, S->LoadAlignment);
+            }
+
+            Addr += S->Seg->Size;
+        }
+    }
+}
+
+
+
+static void RelaxInstructions (void)
+/* Shorten relaxable instructions. Since this depends on the addresses, and
+** changes them, place the segments and check again until nothing changes.
+*/
+{
+    unsigned I;
+
+    do {
+        PlaceSegmentsForRelax ();
+    } while (RelaxFragments () > 0);
+
+    /* Forget the preliminary placement */
+    for (I = 0; I < CollCount (&MemoryAreas); ++I) {
+        MemoryArea* M = CollAtUnchecked (&MemoryAreas, I);
+        M->Flags &= ~MF_PLACED;
+    }
+    for (I = 0; I < CollCount (&SegDescList); ++I) {
+        SegDesc* S = CollAtUnchecked (&SegDescList, I);
+        S->Seg->MemArea = 0;
+    }
+
+    /* Convert the operands of the shortened instructions */
+    RelaxDone ();
+}
+
+
+
 static void ProcessSegments (void)
 /* Process the SEGMENTS section */
 {
@@ -1881,9 +2006,23 @@ unsigned CfgProcess (void)
     */
     ProcessSymbols ();
 
+    /* Remove unreferenced sections if requested. This must be done before
+    ** the segments are placed.
+    */
+    if (GCSections) {
+        CollectGarbage ();
+    }
+
     /* Postprocess segments */
     ProcessSegments ();
 
+    /* Shorten instructions marked as relaxable by the assembler. This must be
+    ** done before the segments are placed for real.
+    */
+    if (RelaxCount () > 0) {
+        RelaxInstructions ();
+    }
+
     /* Walk through each of the memory sections. Add up the sizes; and, check
     ** for an overflow of the section. Assign the start addresses of the
     ** segments while doing that.
@@ -97,6 +97,7 @@ struct SegDesc {
 #define SF_LOAD_DEF     0x0400          /* LOAD symbols already defined */
 #define SF_FILLVAL      0x0800          /* Segment has separate fill value */
 #define SF_OVERWRITE    0x1000          /* Segment can overwrite (part of) another one */
+#define SF_KEEP         0x2000          /* Keep all sections (--gc-sections) */
 
 
 
@@ -37,11 +37,15 @@
 #include <string.h>
 #include <errno.h>
 
+/* common */
+#include "strpool.h"
+
 /* ld65 */
 #include "dbgfile.h"
 #include "dbgsyms.h"
 #include "error.h"
 #include "fileinfo.h"
+#include "fileio.h"
 #include "global.h"
 #include "library.h"
 #include "lineinfo.h"
@@ -49,6 +53,201 @@
 #include "segments.h"
 #include "span.h"
 #include "tpool.h"
+#include "uptodate.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* The binary format contains the same lines as the text format, encoded as a
+** stream of tokens. All names, keywords and strings are stored in a string
+** table at the end of the file. Numbers use the variable length encoding
+** from the object files. These definitions must match the ones in the
+** dbginfo module.
+*/
+static const unsigned char BinMagic[4] = { 0x7F, 'D', 'B', 'G' };
+#define BIN_EOL         0x00            /* End of line */
+#define BIN_LINE        0x01            /* Start of line, keyword follows */
+#define BIN_ATTR        0x02            /* Attribute, keyword follows */
+#define BIN_INT         0x03            /* Number follows */
+#define BIN_NEG         0x04            /* Negated number follows */
+#define BIN_STR         0x05            /* String follows */
+#define BIN_IDENT       0x06            /* Keyword as value follows */
+#define BIN_PLUS        0x07            /* Separator for list items */
+
+/* String table for the binary format. Null when writing the text format */
+static StringPool* BinStrings = 0;
+
+/* Character written before the next attribute in the text format */
+static char AttrSep;
+
+/* True if the next list item is the first one */
+static int FirstItem;
+
+
+
+/*****************************************************************************/
+/*                             Debug file lines                              */
+/*****************************************************************************/
+
+
+
+static void TextAttr (FILE* F, const char* Name)
+/* Start an attribute in the text format */
+{
+    fprintf (F, "%c%s=", AttrSep, Name);
+    AttrSep = ',';
+}
+
+
+
+static void BinToken (FILE* F, unsigned char Tok, const char* S)
+/* Write a token followed by a string id to a binary debug file */
+{
+    Write8 (F, Tok);
+    WriteVar (F, SP_AddStr (BinStrings, S));
+}
+
+
+
+void DbgStartLine (FILE* F, const char* Type)
+/* Start a new line with the given type in the debug file */
+{
+    if (BinStrings) {
+        BinToken (F, BIN_LINE, Type);
+    } else {
+        fputs (Type, F);
+        AttrSep = '\t';
+    }
+}
+
+
+
+void DbgEndLine (FILE* F)
+/* End the current line in the debug file */
+{
+    if (BinStrings) {
+        Write8 (F, BIN_EOL);
+    } else {
+        fputc ('\n', F);
+    }
+}
+
+
+
+void DbgAttrNum (FILE* F, const char* Name, unsigned long Val)
+/* Output a numeric attribute */
+{
+    if (BinStrings) {
+        BinToken (F, BIN_ATTR, Name);
+        Write8 (F, BIN_INT);
+        WriteVar (F, Val);
+    } else {
+        TextAttr (F, Name);
+        fprintf (F, "%lu", Val);
+    }
+}
+
+
+
+void DbgAttrSigned (FILE* F, const char* Name, long Val)
+/* Output a signed numeric attribute */
+{
+    if (BinStrings) {
+        BinToken (F, BIN_ATTR, Name);
+        if (Val < 0) {
+            Write8 (F, BIN_NEG);
+            WriteVar (F, - (unsigned long) Val);
+        } else {
+            Write8 (F, BIN_INT);
+            WriteVar (F, Val);
+        }
+    } else {
+        TextAttr (F, Name);
+        fprintf (F, "%ld", Val);
+    }
+}
+
+
+
+void DbgAttrHex (FILE* F, const char* Name, unsigned long Val, unsigned Digits)
+/* Output a numeric attribute. The text format will use hex notation with at
+** least the given number of digits.
+*/
+{
+    if (BinStrings) {
+        BinToken (F, BIN_ATTR, Name);
+        Write8 (F, BIN_INT);
+        WriteVar (F, Val);
+    } else {
+        TextAttr (F, Name);
+        fprintf (F, "0x%0*lX", (int) Digits, Val);
+    }
+}
+
+
+
+void DbgAttrStr (FILE* F, const char* Name, const char* Val)
+/* Output a string attribute */
+{
+    if (BinStrings) {
+        BinToken (F, BIN_ATTR, Name);
+        BinToken (F, BIN_STR, Val);
+    } else {
+        TextAttr (F, Name);
+        fprintf (F, "\"%s\"", Val);
+    }
+}
+
+
+
+void DbgAttrKeyword (FILE* F, const char* Name, const char* Val)
+/* Output an attribute with a keyword as value */
+{
+    if (BinStrings) {
+        BinToken (F, BIN_ATTR, Name);
+        BinToken (F, BIN_IDENT, Val);
+    } else {
+        TextAttr (F, Name);
+        fputs (Val, F);
+    }
+}
+
+
+
+void DbgAttrList (FILE* F, const char* Name)
+/* Start an attribute with a list of ids. The items must be output with
+** DbgListItem.
+*/
+{
+    if (BinStrings) {
+        BinToken (F, BIN_ATTR, Name);
+    } else {
+        TextAttr (F, Name);
+    }
+    FirstItem = 1;
+}
+
+
+
+void DbgListItem (FILE* F, unsigned Id)
+/* Output one item of a list started with DbgAttrList */
+{
+    if (BinStrings) {
+        if (!FirstItem) {
+            Write8 (F, BIN_PLUS);
+        }
+        Write8 (F, BIN_INT);
+        WriteVar (F, Id);
+    } else {
+        fprintf (F, FirstItem? "%u" : "+%u", Id);
+    }
+    FirstItem = 0;
+}
 
 
 
@@ -105,31 +304,42 @@ void CreateDbgFile (void)
 /* Create a debug info file */
 {
     /* Open the debug info file */
-    FILE* F = fopen (DbgFileName, "w");
+    FILE* F = fopen (DbgFileName, BinaryDbgFile? "wb" : "w");
     if (F == 0) {
         Error ("Cannot create debug file '%s': %s", DbgFileName, strerror (errno));
     }
+    UpToDateAddOutput (DbgFileName);
+
+    /* The binary format starts with a header containing the offset of the
+    ** string table, which is written last.
+    */
+    if (BinaryDbgFile) {
+        BinStrings = NewStringPool (1103);
+        WriteData (F, BinMagic, sizeof (BinMagic));
+        Write32 (F, 0);
+    }
 
     /* Output version information */
-    fprintf (F, "version\tmajor=2,minor=0\n");
+    DbgStartLine (F, "version");
+    DbgAttrNum (F, "major", 2);
+    DbgAttrNum (F, "minor", 0);
+    DbgEndLine (F);
 
     /* Output a line with the item numbers so the debug info module is able
     ** to preallocate the required memory.
     */
-    fprintf (
-        F,
-        "info\tcsym=%u,file=%u,lib=%u,line=%u,mod=%u,scope=%u,seg=%u,span=%u,sym=%u,type=%u\n",
-        HLLDbgSymCount (),
-        FileInfoCount (),
-        LibraryCount (),
-        LineInfoCount (),
-        ObjDataCount (),
-        ScopeCount (),
-        SegmentCount (),
-        SpanCount (),
-        DbgSymCount (),
-        TypeCount ()
-    );
+    DbgStartLine (F, "info");
+    DbgAttrNum (F, "csym", HLLDbgSymCount ());
+    DbgAttrNum (F, "file", FileInfoCount ());
+    DbgAttrNum (F, "lib", LibraryCount ());
+    DbgAttrNum (F, "line", LineInfoCount ());
+    DbgAttrNum (F, "mod", ObjDataCount ());
+    DbgAttrNum (F, "scope", ScopeCount ());
+    DbgAttrNum (F, "seg", SegmentCount ());
+    DbgAttrNum (F, "span", SpanCount ());
+    DbgAttrNum (F, "sym", DbgSymCount ());
+    DbgAttrNum (F, "type", TypeCount ());
+    DbgEndLine (F);
 
     /* Assign the ids to the items */
     AssignIds ();
@@ -164,6 +374,25 @@ void CreateDbgFile (void)
     /* Output types */
     PrintDbgTypes (F);
 
+    /* Write the string table for the binary format, then patch its offset
+    ** into the header.
+    */
+    if (BinStrings) {
+        unsigned I;
+        unsigned Count = SP_GetCount (BinStrings);
+        unsigned long StrPos = FileGetPos (F);
+        WriteVar (F, Count);
+        for (I = 0; I < Count; ++I) {
+            const StrBuf* S = SP_Get (BinStrings, I);
+            WriteVar (F, SB_GetLen (S));
+            WriteData (F, SB_GetConstBuf (S), SB_GetLen (S));
+        }
+        FileSetPos (F, sizeof (BinMagic));
+        Write32 (F, StrPos);
+        FreeStringPool (BinStrings);
+        BinStrings = 0;
+    }
+
     /* Close the file */
     if (fclose (F) != 0) {
         Error ("Error closing debug file '%s': %s", DbgFileName, strerror (errno));
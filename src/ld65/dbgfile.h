@@ -38,12 +38,47 @@
 
 
 
+#include <stdio.h>
+
+
+
 /*****************************************************************************/
 /*                                   Code                                    */
 /*****************************************************************************/
 
 
 
+void DbgStartLine (FILE* F, const char* Type);
+/* Start a new line with the given type in the debug file */
+
+void DbgEndLine (FILE* F);
+/* End the current line in the debug file */
+
+void DbgAttrNum (FILE* F, const char* Name, unsigned long Val);
+/* Output a numeric attribute */
+
+void DbgAttrSigned (FILE* F, const char* Name, long Val);
+/* Output a signed numeric attribute */
+
+void DbgAttrHex (FILE* F, const char* Name, unsigned long Val, unsigned Digits);
+/* Output a numeric attribute. The text format will use hex notation with at
+** least the given number of digits.
+*/
+
+void DbgAttrStr (FILE* F, const char* Name, const char* Val);
+/* Output a string attribute */
+
+void DbgAttrKeyword (FILE* F, const char* Name, const char* Val);
+/* Output an attribute with a keyword as value */
+
+void DbgAttrList (FILE* F, const char* Name);
+/* Start an attribute with a list of ids. The items must be output with
+** DbgListItem.
+*/
+
+void DbgListItem (FILE* F, unsigned Id);
+/* Output one item of a list started with DbgAttrList */
+
 void CreateDbgFile (void);
 /* Create a debug info file */
 
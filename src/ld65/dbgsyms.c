@@ -44,6 +44,7 @@
 #include "xmalloc.h"
 
 /* ld65 */
+#include "dbgfile.h"
 #include "dbgsyms.h"
 #include "error.h"
 #include "exports.h"
@@ -294,16 +295,15 @@ static long GetDbgSymVal (const DbgSym* D)
 
 
 
-static void PrintLineInfo (FILE* F, const Collection* LineInfos, const char* Format)
+static void PrintLineInfo (FILE* F, const Collection* LineInfos, const char* Name)
 /* Output an attribute with line infos */
 {
     if (CollCount (LineInfos) > 0) {
         unsigned I;
-        const LineInfo* LI = CollConstAt (LineInfos, 0);
-        fprintf (F, Format, LI->Id);
-        for (I = 1; I < CollCount (LineInfos); ++I) {
-            LI = CollConstAt (LineInfos, I);
-            fprintf (F, "+%u", LI->Id);
+        DbgAttrList (F, Name);
+        for (I = 0; I < CollCount (LineInfos); ++I) {
+            const LineInfo* LI = CollConstAt (LineInfos, I);
+            DbgListItem (F, LI->Id);
         }
     }
 }
@@ -365,29 +365,29 @@ void PrintDbgSyms (FILE* F)
             const DbgSym* S = CollConstAt (&O->DbgSyms, J);
 
             /* Emit the base data for the entry */
-            fprintf (F,
-                     "sym\tid=%u,name=\"%s\",addrsize=%s",
-                     O->SymBaseId + J,
-                     GetString (S->Name),
-                     AddrSizeToStr ((unsigned char) S->AddrSize));
+            DbgStartLine (F, "sym");
+            DbgAttrNum (F, "id", O->SymBaseId + J);
+            DbgAttrStr (F, "name", GetString (S->Name));
+            DbgAttrKeyword (F, "addrsize",
+                            AddrSizeToStr ((unsigned char) S->AddrSize));
 
             /* Emit the size only if we know it */
             if (S->Size != 0) {
-                fprintf (F, ",size=%u", S->Size);
+                DbgAttrNum (F, "size", S->Size);
             }
 
             /* For cheap local symbols, add the owner symbol, for others,
             ** add the owner scope.
             */
             if (SYM_IS_STD (S->Type)) {
-                fprintf (F, ",scope=%u", O->ScopeBaseId + S->OwnerId);
+                DbgAttrNum (F, "scope", O->ScopeBaseId + S->OwnerId);
             } else {
-                fprintf (F, ",parent=%u", O->SymBaseId + S->OwnerId);
+                DbgAttrNum (F, "parent", O->SymBaseId + S->OwnerId);
             }
 
             /* Output line infos */
-            PrintLineInfo (F, &S->DefLines, ",def=%u");
-            PrintLineInfo (F, &S->RefLines, ",ref=%u");
+            PrintLineInfo (F, &S->DefLines, "def");
+            PrintLineInfo (F, &S->RefLines, "ref");
 
             /* If this is an import, output the id of the matching export.
             ** If this is not an import, output its value and - if we have
@@ -402,14 +402,14 @@ void PrintDbgSyms (FILE* F)
                 const Export* Exp = Imp->Exp;
 
                 /* Output the type */
-                fputs (",type=imp", F);
+                DbgAttrKeyword (F, "type", "imp");
 
                 /* If this is not a linker generated symbol, and the module
                 ** that contains the export has debug info, output the debug
                 ** symbol id for the export
                 */
                 if (Exp->Obj && OBJ_HAS_DBGINFO (Exp->Obj->Header.Flags)) {
-                    fprintf (F, ",exp=%u", Exp->Obj->SymBaseId + Exp->DbgSymId);
+                    DbgAttrNum (F, "exp", Exp->Obj->SymBaseId + Exp->DbgSymId);
                 }
 
             } else {
@@ -420,22 +420,22 @@ void PrintDbgSyms (FILE* F)
                 long Val = GetDbgSymVal (S);
 
                 /* Output it */
-                fprintf (F, ",val=0x%lX", Val);
+                DbgAttrHex (F, "val", Val, 0);
 
                 /* Check for a segmented expression and add the segment id to
                 ** the debug info if we have one.
                 */
                 GetSegExprVal (S->Expr, &D);
                 if (!D.TooComplex && D.Seg != 0) {
-                    fprintf (F, ",seg=%u", D.Seg->Id);
+                    DbgAttrNum (F, "seg", D.Seg->Id);
                 }
 
                 /* Output the type */
-                fprintf (F, ",type=%s", SYM_IS_LABEL (S->Type)? "lab" : "equ");
+                DbgAttrKeyword (F, "type", SYM_IS_LABEL (S->Type)? "lab" : "equ");
             }
 
             /* Terminate the output line */
-            fputc ('\n', F);
+            DbgEndLine (F);
         }
     }
 }
@@ -462,16 +462,16 @@ void PrintHLLDbgSyms (FILE* F)
             unsigned SC = HLL_GET_SC (S->Flags);
 
             /* Output the base info */
-            fprintf (F, "csym\tid=%u,name=\"%s\",scope=%u,type=%u,sc=",
-                     O->HLLSymBaseId + J,
-                     GetString (S->Name),
-                     O->ScopeBaseId + S->ScopeId,
-                     S->Type);
+            DbgStartLine (F, "csym");
+            DbgAttrNum (F, "id", O->HLLSymBaseId + J);
+            DbgAttrStr (F, "name", GetString (S->Name));
+            DbgAttrNum (F, "scope", O->ScopeBaseId + S->ScopeId);
+            DbgAttrNum (F, "type", S->Type);
             switch (SC) {
-                case HLL_SC_AUTO:       fputs ("auto", F);      break;
-                case HLL_SC_REG:        fputs ("reg", F);       break;
-                case HLL_SC_STATIC:     fputs ("static", F);    break;
-                case HLL_SC_EXTERN:     fputs ("ext", F);       break;
+                case HLL_SC_AUTO:   DbgAttrKeyword (F, "sc", "auto");   break;
+                case HLL_SC_REG:    DbgAttrKeyword (F, "sc", "reg");    break;
+                case HLL_SC_STATIC: DbgAttrKeyword (F, "sc", "static"); break;
+                case HLL_SC_EXTERN: DbgAttrKeyword (F, "sc", "ext");    break;
                 default:
                     Error ("Invalid storage class %u for hll symbol", SC);
                     break;
@@ -479,16 +479,16 @@ void PrintHLLDbgSyms (FILE* F)
 
             /* Output the offset if it is not zero */
             if (S->Offs) {
-                fprintf (F, ",offs=%d", S->Offs);
+                DbgAttrSigned (F, "offs", S->Offs);
             }
 
             /* For non auto symbols output the debug symbol id of the asm sym */
             if (HLL_HAS_SYM (S->Flags)) {
-                fprintf (F, ",sym=%u", O->SymBaseId + S->Sym->Id);
+                DbgAttrNum (F, "sym", O->SymBaseId + S->Sym->Id);
             }
 
             /* Terminate the output line */
-            fputc ('\n', F);
+            DbgEndLine (F);
         }
     }
 }
@@ -39,8 +39,9 @@
 
 /* common */
 #include "addrsize.h"
+#include "attrib.h"
 #include "check.h"
-#include "hashfunc.h"
+#include "idtab.h"
 #include "lidefs.h"
 #include "symdefs.h"
 #include "xmalloc.h"
@@ -65,10 +66,8 @@
 
 
 
-/* Hash table */
-#define HASHTAB_MASK    0x0FFFU
-#define HASHTAB_SIZE    (HASHTAB_MASK + 1)
-static Export*          HashTab[HASHTAB_SIZE];
+/* Table with all exports (and dummy exports for open imports) by name */
+static IdTable          ExpTab = STATIC_IDTABLE_INITIALIZER;
 
 /* Import management variables */
 static unsigned         ImpCount = 0;           /* Import count */
@@ -85,6 +84,13 @@ static Export**         ExpPool  = 0;           /* Exports array */
 #define EXP_INLIST      0x0001U                 /* Export is in exports list */
 #define EXP_USERMARK    0x0002U                 /* User setable flag */
 
+/* Data passed to WalkOneExport */
+typedef struct WalkExportsData WalkExportsData;
+struct WalkExportsData {
+    void (*F) (Export* E, void* Data);  /* User function */
+    void* Data;                         /* User data */
+};
+
 
 
 /*****************************************************************************/
@@ -218,31 +224,14 @@ Import* InsertImport (Import* I)
     /* As long as the import is not inserted, V.Name is valid */
     unsigned Name = I->Name;
 
-    /* Create a hash value for the given name */
-    unsigned Hash = (Name & HASHTAB_MASK);
-
-    /* Search through the list in that slot for a symbol with that name */
-    if (HashTab[Hash] == 0) {
-        /* The slot is empty, we need to insert a dummy export */
-        E = HashTab[Hash] = NewExport (0, ADDR_SIZE_DEFAULT, Name, 0);
+    /* Search for an export with that name. If there is none, we need to
+    ** insert a dummy.
+    */
+    E = IT_Find (&ExpTab, Name);
+    if (E == 0) {
+        E = NewExport (0, ADDR_SIZE_DEFAULT, Name, 0);
+        IT_Insert (&ExpTab, Name, E);
         ++ExpCount;
-    } else {
-        E = HashTab [Hash];
-        while (1) {
-            if (E->Name == Name) {
-                /* We have an entry, L points to it */
-                break;
-            }
-            if (E->Next == 0) {
-                /* End of list an entry not found, insert a dummy */
-                E->Next = NewExport (0, ADDR_SIZE_DEFAULT, Name, 0);
-                E = E->Next;            /* Point to dummy */
-                ++ExpCount;             /* One export more */
-                break;
-            } else {
-                E = E->Next;
-            }
-        }
     }
 
     /* Ok, E now points to a valid exports entry for the given import. Insert
@@ -297,7 +286,6 @@ static Export* NewExport (unsigned Type, unsigned char AddrSize,
 
     /* Initialize the fields */
     E->Name      = Name;
-    E->Next      = 0;
     E->Flags     = 0;
     E->Obj       = Obj;
     E->ImpCount  = 0;
@@ -431,9 +419,7 @@ void InsertExport (Export* E)
 /* Insert an exported identifier and check if it's already in the list */
 {
     Export* L;
-    Export* Last;
     Import* Imp;
-    unsigned Hash;
 
     /* Mark the export as inserted */
     E->Flags |= EXP_INLIST;
@@ -443,59 +429,33 @@ void InsertExport (Export* E)
         ConDesAddExport (E);
     }
 
-    /* Create a hash value for the given name */
-    Hash = (E->Name & HASHTAB_MASK);
-
-    /* Search through the list in that slot */
-    if (HashTab[Hash] == 0) {
-        /* The slot is empty */
-        HashTab[Hash] = E;
+    /* Search for an export with this name */
+    L = IT_Find (&ExpTab, E->Name);
+    if (L == 0) {
+        /* Not found, insert it */
+        IT_Insert (&ExpTab, E->Name, E);
         ++ExpCount;
-    } else {
+    } else if (L->Expr == 0) {
 
-        Last = 0;
-        L = HashTab[Hash];
-        do {
-            if (L->Name == E->Name) {
-                /* This may be an unresolved external */
-                if (L->Expr == 0) {
-
-                    /* This *is* an unresolved external. Use the actual export
-                    ** in E instead of the dummy one in L.
-                    */
-                    E->Next     = L->Next;
-                    E->ImpCount = L->ImpCount;
-                    E->ImpList  = L->ImpList;
-                    if (Last) {
-                        Last->Next = E;
-                    } else {
-                        HashTab[Hash] = E;
-                    }
-                    ImpOpen -= E->ImpCount;     /* Decrease open imports now */
-                    xfree (L);
-                    /* We must run through the import list and change the
-                    ** export pointer now.
-                    */
-                    Imp = E->ImpList;
-                    while (Imp) {
-                        Imp->Exp = E;
-                        Imp = Imp->Next;
-                    }
-                } else if (AllowMultDef == 0) {
-                    /* Duplicate entry, this is fatal unless allowed by the user */
-                    Error ("Duplicate external identifier: '%s'",
-                           GetString (L->Name));
-                }
-                return;
-            }
-            Last = L;
-            L = L->Next;
-
-        } while (L);
-
-        /* Insert export at end of queue */
-        Last->Next = E;
-        ++ExpCount;
+        /* This *is* an unresolved external. Use the actual export in E
+        ** instead of the dummy one in L.
+        */
+        E->ImpCount = L->ImpCount;
+        E->ImpList  = L->ImpList;
+        IT_Insert (&ExpTab, E->Name, E);
+        ImpOpen -= E->ImpCount;         /* Decrease open imports now */
+        xfree (L);
+        /* We must run through the import list and change the export
+        ** pointer now.
+        */
+        Imp = E->ImpList;
+        while (Imp) {
+            Imp->Exp = E;
+            Imp = Imp->Next;
+        }
+    } else if (AllowMultDef == 0) {
+        /* Duplicate entry, this is fatal unless allowed by the user */
+        Error ("Duplicate external identifier: '%s'", GetString (L->Name));
     }
 }
 
@@ -609,19 +569,7 @@ Export* FindExport (unsigned Name)
 ** return a pointer to the export.
 */
 {
-    /* Get a pointer to the list with the symbols hash value */
-    Export* L = HashTab[Name & HASHTAB_MASK];
-    while (L) {
-        /* Search through the list in that slot */
-        if (L->Name == Name) {
-            /* Entry found */
-            return L;
-        }
-        L = L->Next;
-    }
-
-    /* Not found */
-    return 0;
+    return IT_Find (&ExpTab, Name);
 }
 
 
@@ -794,6 +742,29 @@ static void PrintUnresolved (ExpCheckFunc F, void* Data)
 
 
 
+static void WalkOneExport (unsigned Name attribute ((unused)), void* E,
+                           void* Data)
+/* Helper function for WalkExports. Called by IT_Walk */
+{
+    WalkExportsData* D = Data;
+    D->F (E, D->Data);
+}
+
+
+
+void WalkExports (void (*F) (Export* E, void* Data), void* Data)
+/* Call F for all exports in the table, including the dummy exports for
+** unresolved imports.
+*/
+{
+    WalkExportsData D;
+    D.F    = F;
+    D.Data = Data;
+    IT_Walk (&ExpTab, WalkOneExport, &D);
+}
+
+
+
 static int CmpExpName (const void* K1, const void* K2)
 /* Compare function for qsort */
 {
@@ -803,10 +774,21 @@ static int CmpExpName (const void* K1, const void* K2)
 
 
 
+static void AddToExportPool (unsigned Name attribute ((unused)), void* E,
+                             void* Index)
+/* Add one export to the export pool. Called by IT_Walk */
+{
+    unsigned* J = Index;
+    CHECK (*J < ExpCount);
+    ExpPool[(*J)++] = E;
+}
+
+
+
 static void CreateExportPool (void)
 /* Create an array with pointer to all exports */
 {
-    unsigned I, J;
+    unsigned J;
 
     /* Allocate memory */
     if (ExpPool) {
@@ -814,15 +796,10 @@ static void CreateExportPool (void)
     }
     ExpPool = xmalloc (ExpCount * sizeof (Export*));
 
-    /* Walk through the list and insert the exports */
-    for (I = 0, J = 0; I < sizeof (HashTab) / sizeof (HashTab [0]); ++I) {
-        Export* E = HashTab[I];
-        while (E) {
-            CHECK (J < ExpCount);
-            ExpPool[J++] = E;
-            E = E->Next;
-        }
-    }
+    /* Walk through the table and insert the exports */
+    J = 0;
+    IT_Walk (&ExpTab, AddToExportPool, &J);
+    CHECK (J == ExpCount);
 
     /* Sort them by name */
     qsort (ExpPool, ExpCount, sizeof (Export*), CmpExpName);
@@ -78,7 +78,6 @@ struct Import {
 typedef struct Export Export;
 struct Export {
     unsigned            Name;           /* Name */
-    Export*             Next;           /* Hash table link */
     unsigned            Flags;          /* Generic flags */
     ObjData*            Obj;            /* Object file that exports the name */
     unsigned            ImpCount;       /* How many imports for this symbol? */
@@ -176,6 +175,11 @@ int IsConstExport (const Export* E);
 long GetExportVal (const Export* E);
 /* Get the value of this export */
 
+void WalkExports (void (*F) (Export* E, void* Data), void* Data);
+/* Call F for all exports in the table, including the dummy exports for
+** unresolved imports.
+*/
+
 void CheckExports (void);
 /* Setup the list of all exports and check for export/import symbol type
 ** mismatches.
@@ -38,6 +38,7 @@
 #include "xmalloc.h"
 
 /* ld65 */
+#include "dbgfile.h"
 #include "fileio.h"
 #include "fileinfo.h"
 #include "objdata.h"
@@ -239,25 +240,24 @@ void PrintDbgFileInfo (FILE* F)
         const FileInfo* FI = CollAtUnchecked (&FileInfos, I);
 
         /* Base info */
-        fprintf (F,
-                 "file\tid=%u,name=\"%s\",size=%lu,mtime=0x%08lX,mod=",
-                 FI->Id, GetString (FI->Name), FI->Size, FI->MTime);
+        DbgStartLine (F, "file");
+        DbgAttrNum (F, "id", FI->Id);
+        DbgAttrStr (F, "name", GetString (FI->Name));
+        DbgAttrNum (F, "size", FI->Size);
+        DbgAttrHex (F, "mtime", FI->MTime, 8);
 
         /* Modules that use the file */
+        DbgAttrList (F, "mod");
         for (J = 0; J < CollCount (&FI->Modules); ++J) {
 
             /* Get the module */
             const ObjData* O = CollConstAt (&FI->Modules, J);
 
             /* Output its id */
-            if (J > 0) {
-                fprintf (F, "+%u", O->Id);
-            } else {
-                fprintf (F, "%u", O->Id);
-            }
+            DbgListItem (F, O->Id);
         }
 
         /* Terminate the output line */
-        fputc ('\n', F);
+        DbgEndLine (F);
     }
 }
@@ -57,11 +57,14 @@ Fragment* NewFragment (unsigned char Type, unsigned Size, Section* S)
     Fragment* F;
 
     /* Calculate the size of the memory block. LitBuf is only needed if the
-    ** fragment contains literal data.
+    ** fragment contains literal data, or the opcodes of a relaxable
+    ** instruction.
     */
     unsigned FragSize = sizeof (Fragment) - 1;
     if (Type == FRAG_LITERAL) {
         FragSize += Size;
+    } else if (Type == FRAG_RELAX) {
+        FragSize += RELAX_DATA_SIZE;
     }
 
     /* Allocate memory */
@@ -76,6 +76,13 @@ struct Fragment {
     unsigned char       LitBuf [1];     /* Dynamically alloc'ed literal buffer */
 };
 
+/* Layout of LitBuf for FRAG_RELAX fragments */
+#define RELAX_DATA_KIND         0       /* RELAX_xxx */
+#define RELAX_DATA_OPC          1       /* Opcode of the long instruction */
+#define RELAX_DATA_SHORTOPC     2       /* Opcode of the short instruction */
+#define RELAX_DATA_FIXED        3       /* Must not be shortened again */
+#define RELAX_DATA_SIZE         4
+
 
 
 /*****************************************************************************/
@@ -0,0 +1,315 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                    gc.c                                   */
+/*                                                                           */
+/*                      Removal of unreferenced sections                     */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#include <string.h>
+
+/* common */
+#include "attrib.h"
+#include "coll.h"
+#include "exprdefs.h"
+#include "fragdefs.h"
+#include "idtab.h"
+#include "print.h"
+#include "xmalloc.h"
+
+/* ld65 */
+#include "asserts.h"
+#include "expr.h"
+#include "fragment.h"
+#include "gc.h"
+#include "objdata.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Sections that are marked as used but have not been scanned yet */
+static Collection       PendingSections = STATIC_COLLECTION_INITIALIZER;
+
+/* Exports that have been marked as used, by name */
+static IdTable          UsedExports = STATIC_IDTABLE_INITIALIZER;
+
+
+
+/*****************************************************************************/
+/*                              Helper functions                             */
+/*****************************************************************************/
+
+
+
+static void UseSection (Section* S)
+/* Mark a section as used */
+{
+    if (!S->Used) {
+        S->Used = 1;
+        CollAppend (&PendingSections, S);
+
+        /* The parts of a section that was split by the assembler belong
+        ** together, since code may fall through from one into the next.
+        */
+        if (S->PrevPart) {
+            UseSection (S->PrevPart);
+        }
+        if (S->NextPart) {
+            UseSection (S->NextPart);
+        }
+    }
+}
+
+
+
+static int HasSectionRef (const ExprNode* Expr)
+/* Return true if the expression references a section */
+{
+    while (Expr) {
+        if (Expr->Op == EXPR_SECTION) {
+            return 1;
+        }
+        if (HasSectionRef (Expr->Left)) {
+            return 1;
+        }
+        Expr = Expr->Right;
+    }
+    return 0;
+}
+
+
+
+static void UseExpr (ExprNode* Expr);
+/* Mark everything referenced by the given expression as used */
+
+
+
+static void UseExport (Export* E)
+/* Mark an export and everything referenced by its value as used */
+{
+    /* Unresolved externals have no expression */
+    if (E != 0 && E->Expr != 0 && IT_Find (&UsedExports, E->Name) == 0) {
+        IT_Insert (&UsedExports, E->Name, E);
+        UseExpr (E->Expr);
+
+        /* Modules often export a constant (like __STARTUP__) just so they
+        ** get linked in when it is imported. Since we cannot tell which of
+        ** the module's sections are needed in this case, keep all of them.
+        */
+        if (E->Obj && !HasSectionRef (E->Expr)) {
+            unsigned I;
+            for (I = 0; I < CollCount (&E->Obj->Sections); ++I) {
+                UseSection (CollAtUnchecked (&E->Obj->Sections, I));
+            }
+        }
+    }
+}
+
+
+
+static void UseExpr (ExprNode* Expr)
+/* Mark everything referenced by the given expression as used */
+{
+    while (Expr) {
+        switch (Expr->Op) {
+
+            case EXPR_SYMBOL:
+                UseExport (GetExprExport (Expr));
+                return;
+
+            case EXPR_SECTION:
+                UseSection (GetExprSection (Expr));
+                return;
+
+            default:
+                /* Leaf nodes have no children, so this is safe */
+                UseExpr (Expr->Left);
+                Expr = Expr->Right;
+                break;
+        }
+    }
+}
+
+
+
+static void MarkImports (const ObjData* O, ExprNode* Expr, unsigned char* Refs)
+/* Set the flags in Refs for all imports of O that are referenced by Expr */
+{
+    while (Expr) {
+        if (Expr->Op == EXPR_SYMBOL) {
+            if (Expr->Obj == O) {
+                Refs[Expr->V.ImpNum] = 1;
+            }
+            return;
+        }
+        MarkImports (O, Expr->Left, Refs);
+        Expr = Expr->Right;
+    }
+}
+
+
+
+static void UseObjRoots (ObjData* O)
+/* Mark the roots contained in an object file: Imports that are not
+** referenced by any expression in the module (these are forced imports),
+** and assertions.
+*/
+{
+    unsigned I;
+    unsigned Count = CollCount (&O->Imports);
+    unsigned char* Refs;
+
+    /* Assertions must be evaluated, so everything they reference is used */
+    for (I = 0; I < CollCount (&O->Assertions); ++I) {
+        UseExpr (GetAssertionExpr (CollAtUnchecked (&O->Assertions, I)));
+    }
+
+    /* Nothing more to do if the module has no imports */
+    if (Count == 0) {
+        return;
+    }
+
+    /* Determine which imports are referenced in the module */
+    Refs = xmalloc (Count);
+    memset (Refs, 0, Count);
+    for (I = 0; I < CollCount (&O->Sections); ++I) {
+        const Section* S = CollAtUnchecked (&O->Sections, I);
+        const Fragment* F = S->FragRoot;
+        while (F) {
+            if (F->Expr) {
+                MarkImports (O, F->Expr, Refs);
+            }
+            F = F->Next;
+        }
+    }
+    for (I = 0; I < CollCount (&O->Exports); ++I) {
+        const Export* E = CollAtUnchecked (&O->Exports, I);
+        MarkImports (O, E->Expr, Refs);
+    }
+    for (I = 0; I < CollCount (&O->Assertions); ++I) {
+        MarkImports (O, GetAssertionExpr (CollAtUnchecked (&O->Assertions, I)), Refs);
+    }
+
+    /* All imports that are not referenced are roots */
+    for (I = 0; I < Count; ++I) {
+        if (!Refs[I]) {
+            UseExport (GetObjImport (O, I)->Exp);
+        }
+    }
+
+    /* Free the flags */
+    xfree (Refs);
+}
+
+
+
+static void UseLinkerImports (Export* E, void* Data attribute ((unused)))
+/* If the export is imported by the linker itself, mark it as used. Called
+** by WalkExports.
+*/
+{
+    const Import* I = E->ImpList;
+    while (I) {
+        if (I->Obj == 0) {
+            UseExport (E);
+            break;
+        }
+        I = I->Next;
+    }
+}
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void GCKeepSegment (Segment* S)
+/* Mark all sections of the given segment as used, so they're kept even if
+** they're not referenced.
+*/
+{
+    unsigned I;
+    for (I = 0; I < CollCount (&S->Sections); ++I) {
+        UseSection (CollAtUnchecked (&S->Sections, I));
+    }
+}
+
+
+
+void GCKeepExport (Export* E)
+/* Mark the given export and everything it references as used */
+{
+    UseExport (E);
+}
+
+
+
+void GCRemoveSections (void)
+/* Determine all sections that are reachable from the roots, and remove the
+** data of all other sections. The roots are the segments and exports passed
+** to GCKeepSegment and GCKeepExport, all symbols imported by the linker
+** itself (for example from the config or with --force-import), all symbols
+** an object file imports without referencing them (.forceimport), and all
+** assertions.
+*/
+{
+    unsigned I;
+    unsigned long Removed;
+
+    /* Mark the roots */
+    WalkExports (UseLinkerImports, 0);
+    for (I = 0; I < CollCount (&ObjDataList); ++I) {
+        UseObjRoots (CollAtUnchecked (&ObjDataList, I));
+    }
+
+    /* Scan the used sections until no new ones are found */
+    while (CollCount (&PendingSections) > 0) {
+        Section* S = CollPop (&PendingSections);
+        const Fragment* F = S->FragRoot;
+        while (F) {
+            if (F->Expr) {
+                UseExpr (F->Expr);
+            }
+            F = F->Next;
+        }
+    }
+
+    /* Remove the data of everything that is not used */
+    Removed = RemoveUnusedSections ();
+    Print (stdout, 1, "Removed %lu bytes in unreferenced sections\n", Removed);
+
+    /* Free memory */
+    DoneIdTable (&UsedExports);
+}
@@ -0,0 +1,71 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                    gc.h                                   */
+/*                                                                           */
+/*                      Removal of unreferenced sections                     */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#ifndef GC_H
+#define GC_H
+
+
+
+/* ld65 */
+#include "exports.h"
+#include "segments.h"
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void GCKeepSegment (Segment* S);
+/* Mark all sections of the given segment as used, so they're kept even if
+** they're not referenced.
+*/
+
+void GCKeepExport (Export* E);
+/* Mark the given export and everything it references as used */
+
+void GCRemoveSections (void);
+/* Determine all sections that are reachable from the roots, and remove the
+** data of all other sections. The roots are the segments and exports passed
+** to GCKeepSegment and GCKeepExport, all symbols imported by the linker
+** itself (for example from the config or with --force-import), all symbols
+** an object file imports without referencing them (.forceimport), and all
+** assertions.
+*/
+
+
+
+/* End of gc.h */
+
+#endif
@@ -55,7 +55,10 @@ unsigned long StartAddr     = 0x200;    /* Start address */
 unsigned char VerboseMap     = 0;       /* Verbose map file */
 unsigned char AllowMultDef   = 0;       /* Allow multiple definitions */
 unsigned char LargeAlignment = 0;       /* Don't warn about large alignments */
+unsigned char GCSections     = 0;       /* Remove unreferenced sections */
+unsigned char BinaryDbgFile  = 0;       /* Write the debug file in binary */
 
 const char* MapFileName     = 0;        /* Name of the map file */
 const char* LabelFileName   = 0;        /* Name of the label file */
 const char* DbgFileName     = 0;        /* Name of the debug file */
+const char* UpToDateName    = 0;        /* Name of the up-to-date state file */
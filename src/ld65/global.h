@@ -55,10 +55,13 @@ extern unsigned long    StartAddr;      /* Start address */
 extern unsigned char    VerboseMap;     /* Verbose map file */
 extern unsigned char    AllowMultDef;   /* Allow multiple definitions */
 extern unsigned char    LargeAlignment; /* Don't warn about large alignments */
+extern unsigned char    GCSections;     /* Remove unreferenced sections */
+extern unsigned char    BinaryDbgFile;  /* Write the debug file in binary */
 
 extern const char*      MapFileName;    /* Name of the map file */
 extern const char*      LabelFileName;  /* Name of the label file */
 extern const char*      DbgFileName;    /* Name of the debug file */
+extern const char*      UpToDateName;   /* Name of the up-to-date state file */
 
 
 
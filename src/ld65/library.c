@@ -46,6 +46,7 @@
 #include "xmalloc.h"
 
 /* ld65 */
+#include "dbgfile.h"
 #include "error.h"
 #include "exports.h"
 #include "fileio.h"
@@ -550,6 +551,9 @@ void PrintDbgLibraries (FILE* F)
         const Library* L = CollAtUnchecked (&LibraryList, I);
 
         /* Output the info */
-        fprintf (F, "lib\tid=%u,name=\"%s\"\n", L->Id, GetString (L->Name));
+        DbgStartLine (F, "lib");
+        DbgAttrNum (F, "id", L->Id);
+        DbgAttrStr (F, "name", GetString (L->Name));
+        DbgEndLine (F);
     }
 }
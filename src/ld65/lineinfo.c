@@ -39,6 +39,7 @@
 #include "xmalloc.h"
 
 /* ld65 */
+#include "dbgfile.h"
 #include "error.h"
 #include "fileinfo.h"
 #include "fileio.h"
@@ -264,23 +265,24 @@ void PrintDbgLineInfo (FILE* F)
             unsigned Count = LI_GET_COUNT (LI->Type);
 
             /* Print the start of the line */
-            fprintf (F,
-                     "line\tid=%u,file=%u,line=%u",
-                     LI->Id, LI->File->Id, GetSourceLine (LI));
+            DbgStartLine (F, "line");
+            DbgAttrNum (F, "id", LI->Id);
+            DbgAttrNum (F, "file", LI->File->Id);
+            DbgAttrNum (F, "line", GetSourceLine (LI));
 
             /* Print type if not LI_TYPE_ASM and count if not zero */
             if (Type != LI_TYPE_ASM) {
-                fprintf (F, ",type=%u", Type);
+                DbgAttrNum (F, "type", Type);
             }
             if (Count != 0) {
-                fprintf (F, ",count=%u", Count);
+                DbgAttrNum (F, "count", Count);
             }
 
             /* Add spans if the line info has it */
             PrintDbgSpanList (F, O, LI->Spans);
 
             /* Terminate line */
-            fputc ('\n', F);
+            DbgEndLine (F);
         }
     }
 }
@@ -68,6 +68,7 @@
 #include "segments.h"
 #include "spool.h"
 #include "tpool.h"
+#include "uptodate.h"
 
 
 
@@ -129,12 +130,14 @@ static void Usage (void)
             "\n"
             "Long options:\n"
             "  --allow-multiple-definition\tAllow multiple definitions\n"
+            "  --binary-dbgfile\t\tWrite the debug file in binary format\n"
             "  --cfg-path path\t\tSpecify a config file search path\n"
             "  --config name\t\t\tUse linker config file\n"
             "  --dbgfile name\t\tGenerate debug information\n"
             "  --define sym=val\t\tDefine a symbol\n"
             "  --end-group\t\t\tEnd a library group\n"
             "  --force-import sym\t\tForce an import of symbol 'sym'\n"
+            "  --gc-sections\t\t\tRemove unreferenced sections\n"
             "  --help\t\t\tHelp (this text)\n"
             "  --large-alignment\t\tDon't warn about large alignments\n"
             "  --lib file\t\t\tLink this library\n"
@@ -146,6 +149,7 @@ static void Usage (void)
             "  --start-addr addr\t\tSet the default start address\n"
             "  --start-group\t\t\tStart a library group\n"
             "  --target sys\t\t\tSet the target system\n"
+            "  --up-to-date-check name\tSkip the link if nothing changed\n"
             "  --version\t\t\tPrint the linker version\n",
             ProgName);
 }
@@ -224,6 +228,7 @@ static void LinkFile (const char* Name, FILETYPE Type)
     if (F == 0) {
         Error ("Cannot open '%s': %s", PathName, strerror (errno));
     }
+    UpToDateAddInput (PathName);
 
     /* Read the magic word */
     Magic = Read32 (F);
@@ -302,6 +307,15 @@ static void DefineSymbol (const char* Def)
 
 
 
+static void OptBinaryDbgFile (const char* Opt attribute ((unused)),
+                              const char* Arg attribute ((unused)))
+/* Write the debug file in binary format */
+{
+    BinaryDbgFile = 1;
+}
+
+
+
 static void OptCfgPath (const char* Opt attribute ((unused)), const char* Arg)
 /* Specify a config file search path */
 {
@@ -397,6 +411,15 @@ static void OptForceImport (const char* Opt attribute ((unused)), const char* Ar
 
 
 
+static void OptGCSections (const char* Opt attribute ((unused)),
+                           const char* Arg attribute ((unused)))
+/* Remove unreferenced sections */
+{
+    GCSections = 1;
+}
+
+
+
 static void OptHelp (const char* Opt attribute ((unused)),
                      const char* Arg attribute ((unused)))
 /* Print usage information and exit */
@@ -549,6 +572,14 @@ static void OptTarget (const char* Opt attribute ((unused)), const char* Arg)
 
 
 
+static void OptUpToDateCheck (const char* Opt attribute ((unused)), const char* Arg)
+/* Skip the link if the output files are up to date */
+{
+    UpToDateName = Arg;
+}
+
+
+
 static void OptVersion (const char* Opt attribute ((unused)),
                         const char* Arg attribute ((unused)))
 /* Print the assembler version */
@@ -619,12 +650,14 @@ static void ParseCommandLine(void)
     /* Program long options */
     static const LongOpt OptTab[] = {
         { "--allow-multiple-definition", 0,      OptMultDef              },
+        { "--binary-dbgfile",            0,      OptBinaryDbgFile        },
         { "--cfg-path",                  1,      OptCfgPath              },
         { "--config",                    1,      CmdlOptConfig           },
         { "--dbgfile",                   1,      OptDbgFile              },
         { "--define",                    1,      OptDefine               },
         { "--end-group",                 0,      CmdlOptEndGroup         },
         { "--force-import",              1,      OptForceImport          },
+        { "--gc-sections",               0,      OptGCSections           },
         { "--help",                      0,      OptHelp                 },
         { "--large-alignment",           0,      OptLargeAlignment       },
         { "--lib",                       1,      OptLib                  },
@@ -636,6 +669,7 @@ static void ParseCommandLine(void)
         { "--start-addr",                1,      OptStartAddr            },
         { "--start-group",               0,      CmdlOptStartGroup       },
         { "--target",                    1,      CmdlOptTarget           },
+        { "--up-to-date-check",          1,      OptUpToDateCheck        },
         { "--version",                   0,      OptVersion              },
     };
 
@@ -750,6 +784,13 @@ static void ParseCommandLine(void)
         ++I;
     }
 
+    /* Skip the link if the output files are up to date. Only the options
+    ** have been processed so far, so no config or input file was read.
+    */
+    if (UpToDateName && UpToDateCheck ()) {
+        exit (EXIT_SUCCESS);
+    }
+
     if (CmdlineTarget) {
         OptTarget (NULL, CmdlineTarget);
     } else if (CmdlineCfgFile) {
@@ -862,6 +903,11 @@ int main (int argc, char* argv [])
         CreateDbgFile ();
     }
 
+    /* Remember the state of this link if requested */
+    if (UpToDateName) {
+        UpToDateWrite ();
+    }
+
     /* Dump the data for debugging */
     if (Verbosity > 1) {
         SegDump ();
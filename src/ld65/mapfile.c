@@ -48,6 +48,7 @@
 #include "objdata.h"
 #include "segments.h"
 #include "spool.h"
+#include "uptodate.h"
 
 
 
@@ -69,6 +70,7 @@ void CreateMapFile (int ShortMap)
     if (F == 0) {
         Error ("Cannot create map file '%s': %s", MapFileName, strerror (errno));
     }
+    UpToDateAddOutput (MapFileName);
 
     /* Write a modules list */
     fprintf (F, "Modules list:\n"
@@ -146,6 +148,7 @@ void CreateLabelFile (void)
     if (F == 0) {
         Error ("Cannot create label file '%s': %s", LabelFileName, strerror (errno));
     }
+    UpToDateAddOutput (LabelFileName);
 
     /* Print the labels for the export symbols */
     PrintExportLabels (F);
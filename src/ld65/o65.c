@@ -57,6 +57,7 @@
 #include "memarea.h"
 #include "o65.h"
 #include "spool.h"
+#include "uptodate.h"
 
 
 
@@ -1374,6 +1375,7 @@ void O65WriteTarget (O65Desc* D, File* F)
     if (D->F == 0) {
         Error ("Cannot open '%s': %s", D->Filename, strerror (errno));
     }
+    UpToDateAddOutput (D->Filename);
 
     /* Keep the user happy */
     Print (stdout, 1, "Opened '%s'...\n", D->Filename);
@@ -40,6 +40,7 @@
 #include "xmalloc.h"
 
 /* ld65 */
+#include "dbgfile.h"
 #include "error.h"
 #include "exports.h"
 #include "fileinfo.h"
@@ -293,19 +294,18 @@ void PrintDbgModules (FILE* F)
         const FileInfo* Source = CollConstAt (&O->Files, 0);
 
         /* Output the module line */
-        fprintf (F,
-                 "mod\tid=%u,name=\"%s\",file=%u",
-                 I,
-                 GetObjFileName (O),
-                 Source->Id);
+        DbgStartLine (F, "mod");
+        DbgAttrNum (F, "id", I);
+        DbgAttrStr (F, "name", GetObjFileName (O));
+        DbgAttrNum (F, "file", Source->Id);
 
         /* Add library if any */
         if (O->Lib != 0) {
-            fprintf (F, ",lib=%u", GetLibId (O->Lib));
+            DbgAttrNum (F, "lib", GetLibId (O->Lib));
         }
 
         /* Terminate the output line */
-        fputc ('\n', F);
+        DbgEndLine (F);
     }
 
 }
@@ -0,0 +1,243 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                  relax.c                                  */
+/*                                                                           */
+/*                    Link time relaxation of instructions                   */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+/* common */
+#include "addrsize.h"
+#include "coll.h"
+#include "exprdefs.h"
+#include "fragdefs.h"
+#include "print.h"
+
+/* ld65 */
+#include "error.h"
+#include "exports.h"
+#include "expr.h"
+#include "global.h"
+#include "memarea.h"
+#include "relax.h"
+#include "segments.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* All relaxable instructions */
+static Collection       RelaxFrags = STATIC_COLLECTION_INITIALIZER;
+
+/* Segments whose size was changed during a pass */
+static Collection       ChangedSegs = STATIC_COLLECTION_INITIALIZER;
+
+
+
+/*****************************************************************************/
+/*                              Helper functions                             */
+/*****************************************************************************/
+
+
+
+static unsigned long GetFragmentOffs (const Fragment* F)
+/* Return the offset of the fragment within its section */
+{
+    unsigned long Offs = 0;
+    const Fragment* Cur = F->Sec->FragRoot;
+    while (Cur != F) {
+        Offs += Cur->Size;
+        Cur = Cur->Next;
+    }
+    return Offs;
+}
+
+
+
+static int IsShortPossible (const Fragment* F)
+/* Return true if the short form of the instruction may be used with the
+** current addresses of the segments.
+*/
+{
+    const Export*     E;
+    const MemoryArea* M;
+    long              Val;
+
+    /* The operand must be known */
+    if (!IsConstExpr (F->Expr)) {
+        return 0;
+    }
+    Val = GetExprVal (F->Expr);
+
+    switch (F->LitBuf[RELAX_DATA_KIND]) {
+
+        case RELAX_ZP:
+            /* The symbol must be defined as a zero page symbol. This is
+            ** what the assembler would have used if it had known it.
+            */
+            E = (F->Expr->Op == EXPR_SYMBOL)? GetExprExport (F->Expr) : 0;
+            return E != 0 && E->AddrSize == ADDR_SIZE_ZP &&
+                   Val >= 0 && Val <= 0xFF;
+
+        case RELAX_BRANCH:
+            /* The instruction itself must have a known address, and the
+            ** target must be in branch range.
+            */
+            M = F->Sec->Seg->MemArea;
+            if (M == 0 || (M->Flags & MF_PLACED) == 0 || M->Relocatable) {
+                return 0;
+            }
+            Val -= F->Sec->Seg->PC + F->Sec->Offs + GetFragmentOffs (F) + 2;
+            return Val >= -128 && Val <= 127;
+
+        default:
+            Error ("Unknown kind of relaxable instruction in module '%s', line %u",
+                   GetFragmentSourceName (F), GetFragmentSourceLine (F));
+            return 0;
+    }
+}
+
+
+
+static void ChangeSize (Fragment* F, unsigned Size)
+/* Change the size of a relaxable instruction */
+{
+    Section* S = F->Sec;
+    S->Size = S->Size - F->Size + Size;
+    F->Size = Size;
+    if (CollIndex (&ChangedSegs, S->Seg) < 0) {
+        CollAppend (&ChangedSegs, S->Seg);
+    }
+}
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void RelaxAddFragment (Fragment* F)
+/* Remember a relaxable instruction (FRAG_RELAX) read from an object file */
+{
+    CollAppend (&RelaxFrags, F);
+}
+
+
+
+unsigned RelaxCount (void)
+/* Return the number of relaxable instructions */
+{
+    return CollCount (&RelaxFrags);
+}
+
+
+
+unsigned RelaxFragments (void)
+/* Check all relaxable instructions against the current addresses of the
+** segments. Shorten the ones that allow it, and lengthen the ones that have
+** been shortened before, but don't fit any longer. The sizes of the affected
+** segments are updated. Return the number of instructions changed. An
+** instruction that had to be lengthened is never shortened again, so calling
+** the function repeatedly after placing the segments will terminate.
+*/
+{
+    unsigned I;
+    unsigned Changes = 0;
+
+    for (I = 0; I < CollCount (&RelaxFrags); ++I) {
+
+        Fragment* F = CollAtUnchecked (&RelaxFrags, I);
+
+        /* Skip instructions removed by --gc-sections */
+        if (GCSections && !F->Sec->Used) {
+            continue;
+        }
+
+        if (F->Size == 3) {
+            if (!F->LitBuf[RELAX_DATA_FIXED] && IsShortPossible (F)) {
+                ChangeSize (F, 2);
+                ++Changes;
+            }
+        } else if (!IsShortPossible (F)) {
+            /* Shortening other instructions has moved this one out of
+            ** range.
+            */
+            ChangeSize (F, 3);
+            F->LitBuf[RELAX_DATA_FIXED] = 1;
+            ++Changes;
+        }
+    }
+
+    /* Recalculate the layout of the segments that have changed */
+    for (I = 0; I < CollCount (&ChangedSegs); ++I) {
+        SegRelayout (CollAtUnchecked (&ChangedSegs, I));
+    }
+    CollDeleteAll (&ChangedSegs);
+
+    /* Return the number of changes */
+    return Changes;
+}
+
+
+
+void RelaxDone (void)
+/* Finish relaxation after the layout of the segments is final. This converts
+** the operands of shortened jumps into branch offsets.
+*/
+{
+    unsigned I;
+    unsigned Count = 0;
+
+    for (I = 0; I < CollCount (&RelaxFrags); ++I) {
+
+        Fragment* F = CollAtUnchecked (&RelaxFrags, I);
+
+        if ((GCSections && !F->Sec->Used) || F->Size == 3) {
+            continue;
+        }
+
+        if (F->LitBuf[RELAX_DATA_KIND] == RELAX_BRANCH) {
+            /* Branch offset is target minus the address behind the branch */
+            ExprNode* Expr = NewExprNode (0, EXPR_MINUS);
+            Expr->Left  = F->Expr;
+            Expr->Right = SectionExpr (F->Sec, GetFragmentOffs (F) + 2, 0);
+            F->Expr = Expr;
+        }
+
+        ++Count;
+    }
+
+    /* Each shortened instruction saves one byte */
+    Print (stdout, 1, "Shortened %u of %u relaxable instructions\n",
+           Count, CollCount (&RelaxFrags));
+}
@@ -0,0 +1,73 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                  relax.h                                  */
+/*                                                                           */
+/*                    Link time relaxation of instructions                   */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#ifndef RELAX_H
+#define RELAX_H
+
+
+
+/* ld65 */
+#include "fragment.h"
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void RelaxAddFragment (Fragment* F);
+/* Remember a relaxable instruction (FRAG_RELAX) read from an object file */
+
+unsigned RelaxCount (void);
+/* Return the number of relaxable instructions */
+
+unsigned RelaxFragments (void);
+/* Check all relaxable instructions against the current addresses of the
+** segments. Shorten the ones that allow it, and lengthen the ones that have
+** been shortened before, but don't fit any longer. The sizes of the affected
+** segments are updated. Return the number of instructions changed. An
+** instruction that had to be lengthened is never shortened again, so calling
+** the function repeatedly after placing the segments will terminate.
+*/
+
+void RelaxDone (void);
+/* Finish relaxation after the layout of the segments is final. This converts
+** the operands of shortened jumps into branch offsets.
+*/
+
+
+
+/* End of relax.h */
+
+#endif
@@ -49,6 +49,7 @@
 #include "error.h"
 #include "scanner.h"
 #include "spool.h"
+#include "uptodate.h"
 
 
 
@@ -560,6 +561,7 @@ void CfgOpenInput (void)
     if (InputFile == 0) {
         Error ("Cannot open '%s': %s", CfgName, strerror (errno));
     }
+    UpToDateAddInput (CfgName);
 
     /* Initialize variables */
     C         = ' ';
@@ -102,6 +102,7 @@ typedef enum {
     CFGTOK_ALIGN_LOAD,
     CFGTOK_OFFSET,
     CFGTOK_OPTIONAL,
+    CFGTOK_KEEP,
 
     CFGTOK_RO,
     CFGTOK_RW,
@@ -43,19 +43,21 @@
 #include "coll.h"
 #include "exprdefs.h"
 #include "fragdefs.h"
-#include "hashfunc.h"
+#include "idtab.h"
 #include "print.h"
 #include "segdefs.h"
 #include "symdefs.h"
 #include "xmalloc.h"
 
 /* ld65 */
+#include "dbgfile.h"
 #include "error.h"
 #include "expr.h"
 #include "fileio.h"
 #include "fragment.h"
 #include "global.h"
 #include "lineinfo.h"
+#include "relax.h"
 #include "segments.h"
 #include "spool.h"
 
@@ -67,10 +69,8 @@
 
 
 
-/* Hash table */
-#define HASHTAB_MASK    0x3FU
-#define HASHTAB_SIZE    (HASHTAB_MASK + 1)
-static Segment*         HashTab[HASHTAB_SIZE];
+/* Table with all segments by name */
+static IdTable          SegTab = STATIC_IDTABLE_INITIALIZER;
 
 /* List of all segments */
 static Collection       SegmentList = STATIC_COLLECTION_INITIALIZER;
@@ -86,14 +86,11 @@ static Collection       SegmentList = STATIC_COLLECTION_INITIALIZER;
 static Segment* NewSegment (unsigned Name, unsigned char AddrSize)
 /* Create a new segment and initialize it */
 {
-    unsigned Hash;
-
     /* Allocate memory */
     Segment* S = xmalloc (sizeof (Segment));
 
     /* Initialize the fields */
     S->Name        = Name;
-    S->Next        = 0;
     S->Flags       = SEG_FLAG_NONE;
     S->Sections    = EmptyCollection;
     S->MemArea     = 0;
@@ -111,10 +108,8 @@ static Segment* NewSegment (unsigned Name, unsigned char AddrSize)
     S->Id = CollCount (&SegmentList);
     CollAppend (&SegmentList, S);
 
-    /* Insert the segment into the segment hash list */
-    Hash = (S->Name & HASHTAB_MASK);
-    S->Next = HashTab[Hash];
-    HashTab[Hash] = S;
+    /* Insert the segment into the segment table */
+    IT_Insert (&SegTab, S->Name, S);
 
     /* Return the new entry */
     return S;
@@ -170,6 +165,9 @@ Section* NewSection (Segment* Seg, unsigned long Alignment, unsigned char AddrSi
     S->Size     = 0;
     S->Alignment= Alignment;
     S->AddrSize = AddrSize;
+    S->Used     = 0;
+    S->PrevPart = 0;
+    S->NextPart = 0;
 
     /* Calculate the alignment bytes needed for the section */
     S->Fill = AlignCount (Seg->Size, S->Alignment);
@@ -191,9 +189,11 @@ Section* ReadSection (FILE* F, ObjData* O)
 /* Read a section from a file */
 {
     unsigned      Name;
+    unsigned      Flags;
     unsigned      Size;
     unsigned long Alignment;
     unsigned char Type;
+    unsigned char Kind;
     unsigned      FragCount;
     Segment*      S;
     Section*      Sec;
@@ -201,7 +201,7 @@ Section* ReadSection (FILE* F, ObjData* O)
     /* Read the segment data */
     (void) Read32 (F);          /* File size of data */
     Name      = MakeGlobalStringId (O, ReadVar (F));    /* Segment name */
-                ReadVar (F);    /* Segment flags (currently unused) */
+    Flags     = ReadVar (F);    /* Segment flags */
     Size      = ReadVar (F);    /* Size of data */
     Alignment = ReadVar (F);    /* Alignment */
     Type      = Read8 (F);      /* Segment type */
@@ -222,6 +222,17 @@ Section* ReadSection (FILE* F, ObjData* O)
     /* Remember the object file this section was from */
     Sec->Obj = O;
 
+    /* If the assembler has split the segment after a relaxable instruction,
+    ** the section continues the preceding one from the same module.
+    */
+    if ((Flags & SEG_FLAG_CONTINUED) != 0 && CollCount (&S->Sections) > 1) {
+        Section* Prev = CollAt (&S->Sections, CollCount (&S->Sections) - 2);
+        if (Prev->Obj == O) {
+            Prev->NextPart = Sec;
+            Sec->PrevPart  = Prev;
+        }
+    }
+
     /* Set up the combined segment alignment */
     if (Sec->Alignment > 1) {
         Alignment = LeastCommonMultiple (S->Alignment, Sec->Alignment);
@@ -264,6 +275,19 @@ Section* ReadSection (FILE* F, ObjData* O)
                 Frag->Expr = ReadExpr (F, O);
                 break;
 
+            case FRAG_RELAX:
+                Frag = NewFragment (Type, 3, Sec);
+                Kind = Read8 (F);
+                Frag->LitBuf[RELAX_DATA_KIND]     = Kind & ~RELAX_FIXED;
+                Frag->LitBuf[RELAX_DATA_OPC]      = Read8 (F);
+                Frag->LitBuf[RELAX_DATA_SHORTOPC] = Read8 (F);
+                Frag->LitBuf[RELAX_DATA_FIXED]    = (Kind & RELAX_FIXED) != 0;
+                Frag->Expr = ReadExpr (F, O);
+                if ((Kind & RELAX_FIXED) == 0) {
+                    RelaxAddFragment (Frag);
+                }
+                break;
+
             case FRAG_FILL:
                 /* Will allocate memory, but we don't care... */
                 Frag = NewFragment (Type, ReadVar (F), Sec);
@@ -292,16 +316,7 @@ Section* ReadSection (FILE* F, ObjData* O)
 Segment* SegFind (unsigned Name)
 /* Return the given segment or NULL if not found. */
 {
-    Segment* S = HashTab[Name & HASHTAB_MASK];
-    while (S) {
-        if (Name == S->Name) {
-            /* Found */
-            break;
-        }
-        S = S->Next;
-    }
-    /* Not found */
-    return S;
+    return IT_Find (&SegTab, Name);
 }
 
 
@@ -333,6 +348,9 @@ int IsBSSType (Segment* S)
                 if (GetExprVal (F->Expr) != 0) {
                     return 0;
                 }
+            } else if (F->Type == FRAG_RELAX) {
+                /* An instruction is never BSS */
+                return 0;
             }
             F = F->Next;
         }
@@ -342,6 +360,77 @@ int IsBSSType (Segment* S)
 
 
 
+unsigned long RemoveUnusedSections (void)
+/* Remove the data of all sections that don't have the Used flag set, and
+** recalculate the offsets of the remaining sections and the segment sizes.
+** The sections itself stay in the segments with a size of zero, so any
+** references to them are still valid. Return the number of bytes removed.
+*/
+{
+    unsigned I, J;
+    unsigned long Removed = 0;
+
+    for (I = 0; I < CollCount (&SegmentList); ++I) {
+
+        /* Get the next segment */
+        Segment* Seg = CollAtUnchecked (&SegmentList, I);
+        unsigned long OldSize = Seg->Size;
+
+        /* Drop the data of unused sections */
+        for (J = 0; J < CollCount (&Seg->Sections); ++J) {
+
+            Section* Sec = CollAtUnchecked (&Seg->Sections, J);
+
+            if (!Sec->Used) {
+                if (Sec->Size > 0) {
+                    Print (stdout, 2, "Removing %lu bytes of segment '%s' from '%s'\n",
+                           Sec->Size, GetString (Seg->Name),
+                           GetObjFileName (Sec->Obj));
+                }
+                Sec->FragRoot = 0;
+                Sec->FragLast = 0;
+                Sec->Size     = 0;
+            }
+        }
+
+        /* Recalculate the layout of the segment */
+        SegRelayout (Seg);
+
+        Removed += OldSize - Seg->Size;
+    }
+
+    /* Return the number of bytes removed */
+    return Removed;
+}
+
+
+
+void SegRelayout (Segment* Seg)
+/* Recalculate the offsets of the sections and the size of the segment after
+** the size of some sections has changed. Sections removed by --gc-sections
+** need no alignment.
+*/
+{
+    unsigned I;
+
+    Seg->Size = 0;
+    for (I = 0; I < CollCount (&Seg->Sections); ++I) {
+
+        Section* Sec = CollAtUnchecked (&Seg->Sections, I);
+
+        if (GCSections && !Sec->Used) {
+            Sec->Fill = 0;
+        } else {
+            Sec->Fill = AlignCount (Seg->Size, Sec->Alignment);
+        }
+        Seg->Size += Sec->Fill;
+        Sec->Offs  = Seg->Size;
+        Seg->Size += Sec->Size;
+    }
+}
+
+
+
 void SegDump (void)
 /* Dump the segments and it's contents */
 {
@@ -388,6 +477,14 @@ void SegDump (void)
                         DumpExpr (F->Expr, 0);
                         break;
 
+                    case FRAG_RELAX:
+                        printf ("    Relaxable %02X/%02X (%u bytes):\n",
+                                F->LitBuf[RELAX_DATA_OPC],
+                                F->LitBuf[RELAX_DATA_SHORTOPC], F->Size);
+                        printf ("    ");
+                        DumpExpr (F->Expr, 0);
+                        break;
+
                     case FRAG_FILL:
                         printf ("    Empty space (%u bytes)\n", F->Size);
                         break;
@@ -447,13 +544,49 @@ unsigned SegWriteConstExpr (FILE* F, ExprNode* E, int Signed, unsigned Size)
 
 
 
+static void SegWriteExpr (const Fragment* Frag, ExprNode* Expr, int Signed,
+                          unsigned Size, unsigned long Offs,
+                          SegWriteFunc F, void* Data)
+/* Write an expression from the given fragment by calling F, and check the
+** result.
+*/
+{
+    switch (F (Expr, Signed, Size, Offs, Data)) {
+
+        case SEG_EXPR_OK:
+            break;
+
+        case SEG_EXPR_RANGE_ERROR:
+            Error ("Range error in module '%s', line %u",
+                   GetFragmentSourceName (Frag),
+                   GetFragmentSourceLine (Frag));
+            break;
+
+        case SEG_EXPR_TOO_COMPLEX:
+            Error ("Expression too complex in module '%s', line %u",
+                   GetFragmentSourceName (Frag),
+                   GetFragmentSourceLine (Frag));
+            break;
+
+        case SEG_EXPR_INVALID:
+            Error ("Invalid expression in module '%s', line %u",
+                   GetFragmentSourceName (Frag),
+                   GetFragmentSourceLine (Frag));
+            break;
+
+        default:
+            Internal ("Invalid return code from SegWriteFunc");
+    }
+}
+
+
+
 void SegWrite (const char* TgtName, FILE* Tgt, Segment* S, SegWriteFunc F, void* Data)
 /* Write the data from the given segment to a file. For expressions, F is
 ** called (see description of SegWriteFunc above).
 */
 {
     unsigned      I;
-    int           Sign;
     unsigned long Offs = 0;
 
 
@@ -494,33 +627,23 @@ void SegWrite (const char* TgtName, FILE* Tgt, Segment* S, SegWriteFunc F, void*
 
                 case FRAG_EXPR:
                 case FRAG_SEXPR:
-                    Sign = (Frag->Type == FRAG_SEXPR);
                     /* Call the users function and evaluate the result */
-                    switch (F (Frag->Expr, Sign, Frag->Size, Offs, Data)) {
-
-                        case SEG_EXPR_OK:
-                            break;
-
-                        case SEG_EXPR_RANGE_ERROR:
-                            Error ("Range error in module '%s', line %u",
-                                   GetFragmentSourceName (Frag),
-                                   GetFragmentSourceLine (Frag));
-                            break;
-
-                        case SEG_EXPR_TOO_COMPLEX:
-                            Error ("Expression too complex in module '%s', line %u",
-                                   GetFragmentSourceName (Frag),
-                                   GetFragmentSourceLine (Frag));
-                            break;
-
-                        case SEG_EXPR_INVALID:
-                            Error ("Invalid expression in module '%s', line %u",
-                                   GetFragmentSourceName (Frag),
-                                   GetFragmentSourceLine (Frag));
-                            break;
-
-                        default:
-                            Internal ("Invalid return code from SegWriteFunc");
+                    SegWriteExpr (Frag, Frag->Expr, Frag->Type == FRAG_SEXPR,
+                                  Frag->Size, Offs, F, Data);
+                    break;
+
+                case FRAG_RELAX:
+                    /* The opcode depends on whether the instruction was
+                    ** shortened. The operand of a branch is signed.
+                    */
+                    if (Frag->Size == 3) {
+                        Write8 (Tgt, Frag->LitBuf[RELAX_DATA_OPC]);
+                        SegWriteExpr (Frag, Frag->Expr, 0, 2, Offs + 1, F, Data);
+                    } else {
+                        Write8 (Tgt, Frag->LitBuf[RELAX_DATA_SHORTOPC]);
+                        SegWriteExpr (Frag, Frag->Expr,
+                                      Frag->LitBuf[RELAX_DATA_KIND] == RELAX_BRANCH,
+                                      1, Offs + 1, F, Data);
                     }
                     break;
 
@@ -629,16 +752,18 @@ void PrintDbgSegments (FILE* F)
         const Segment* S = CollAtUnchecked (&SegmentList, I);
 
         /* Print the segment data */
-        fprintf (F,
-                 "seg\tid=%u,name=\"%s\",start=0x%06lX,size=0x%04lX,addrsize=%s,type=%s",
-                 S->Id, GetString (S->Name), S->PC, S->Size,
-                 AddrSizeToStr (S->AddrSize),
-                 S->ReadOnly? "ro" : "rw");
+        DbgStartLine (F, "seg");
+        DbgAttrNum (F, "id", S->Id);
+        DbgAttrStr (F, "name", GetString (S->Name));
+        DbgAttrHex (F, "start", S->PC, 6);
+        DbgAttrHex (F, "size", S->Size, 4);
+        DbgAttrKeyword (F, "addrsize", AddrSizeToStr (S->AddrSize));
+        DbgAttrKeyword (F, "type", S->ReadOnly? "ro" : "rw");
         if (S->OutputName) {
-            fprintf (F, ",oname=\"%s\",ooffs=%lu",
-                     S->OutputName, S->OutputOffs);
+            DbgAttrStr (F, "oname", S->OutputName);
+            DbgAttrNum (F, "ooffs", S->OutputOffs);
         }
-        fputc ('\n', F);
+        DbgEndLine (F);
     }
 }
 
@@ -60,7 +60,6 @@ typedef struct Segment Segment;
 struct Segment {
     unsigned            Name;           /* Name index of the segment */
     unsigned            Id;             /* Segment id for debug info */
-    Segment*            Next;           /* Hash list */
     unsigned            Flags;          /* Segment flags */
     Collection          Sections;       /* Sections in this segment */
     struct MemoryArea*  MemArea;        /* Run memory area once placed */
@@ -90,6 +89,9 @@ struct Section {
     unsigned long       Fill;           /* Fill bytes for alignment */
     unsigned long       Alignment;      /* Alignment */
     unsigned char       AddrSize;       /* Address size of segment */
+    unsigned char       Used;           /* Section is referenced (gc only) */
+    Section*            PrevPart;       /* Preceding part of a split section */
+    Section*            NextPart;       /* Following part of a split section */
 };
 
 
@@ -136,6 +138,19 @@ int IsBSSType (Segment* S);
 ** contain non-zero data.
 */
 
+unsigned long RemoveUnusedSections (void);
+/* Remove the data of all sections that don't have the Used flag set, and
+** recalculate the offsets of the remaining sections and the segment sizes.
+** The sections itself stay in the segments with a size of zero, so any
+** references to them are still valid. Return the number of bytes removed.
+*/
+
+void SegRelayout (Segment* Seg);
+/* Recalculate the offsets of the sections and the size of the segment after
+** the size of some sections has changed. Sections removed by --gc-sections
+** need no alignment.
+*/
+
 void SegDump (void);
 /* Dump the segments and it's contents */
 
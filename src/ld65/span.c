@@ -38,6 +38,7 @@
 #include "xmalloc.h"
 
 /* ld65 */
+#include "dbgfile.h"
 #include "fileio.h"
 #include "objdata.h"
 #include "segments.h"
@@ -193,10 +194,9 @@ void PrintDbgSpanList (FILE* F, const ObjData* O, const unsigned* List)
 {
     if (List && *List) {
         unsigned I;
-        const char* Format = ",span=%u";
+        DbgAttrList (F, "span");
         for (I = 0; I < *List; ++I) {
-            fprintf (F, Format, O->SpanBaseId + List[I+1]);
-            Format = "+%u";
+            DbgListItem (F, O->SpanBaseId + List[I+1]);
         }
     }
 }
@@ -226,19 +226,19 @@ void PrintDbgSpans (FILE* F)
             const Section* Sec = GetObjSection (O, S->Sec);
 
             /* Output the data */
-            fprintf (F, "span\tid=%u,seg=%u,start=%lu,size=%lu",
-                     O->SpanBaseId + S->Id,
-                     Sec->Seg->Id,
-                     Sec->Offs + S->Offs,
-                     S->Size);
+            DbgStartLine (F, "span");
+            DbgAttrNum (F, "id", O->SpanBaseId + S->Id);
+            DbgAttrNum (F, "seg", Sec->Seg->Id);
+            DbgAttrNum (F, "start", Sec->Offs + S->Offs);
+            DbgAttrNum (F, "size", S->Size);
 
             /* If we have a type, add it */
             if (S->Type != INVALID_TYPE_ID) {
-                fprintf (F, ",type=%u", S->Type);
+                DbgAttrNum (F, "type", S->Type);
             }
 
             /* Terminate the output line */
-            fputc ('\n', F);
+            DbgEndLine (F);
         }
     }
 
@@ -37,6 +37,7 @@
 #include "gentype.h"
 
 /* ld65 */
+#include "dbgfile.h"
 #include "tpool.h"
 
 
@@ -71,8 +72,10 @@ void PrintDbgTypes (FILE* F)
     for (Id = 0; Id < Count; ++Id) {
 
         /* Output it */
-        fprintf (F, "type\tid=%u,val=\"%s\"\n", Id,
-                 GT_AsString (SP_Get (TypePool, Id), &Type));
+        DbgStartLine (F, "type");
+        DbgAttrNum (F, "id", Id);
+        DbgAttrStr (F, "val", GT_AsString (SP_Get (TypePool, Id), &Type));
+        DbgEndLine (F);
 
     }
 
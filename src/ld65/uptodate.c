@@ -0,0 +1,316 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                uptodate.c                                 */
+/*                                                                           */
+/*          Check if the output files of a link are still up to date         */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+/* common */
+#include "cmdline.h"
+#include "coll.h"
+#include "strbuf.h"
+#include "version.h"
+#include "xmalloc.h"
+
+/* ld65 */
+#include "error.h"
+#include "global.h"
+#include "uptodate.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* The state file is a text file. The first line identifies the file, the second
+** one contains a hash over everything that influences the link but is not a
+** file: the linker version, the command line and the environment variables
+** used for searching files. Then there's one line per input and output file
+** with the hash and size of the file contents followed by the file name.
+*/
+#define UTD_MAGIC       "ld65-up-to-date 1"
+
+/* Environment variables that influence where files are searched */
+static const char* const EnvVars[] = {
+    "LD65_LIB", "LD65_OBJ", "LD65_CFG", "CC65_HOME"
+};
+
+/* Names of all input and output files of this link */
+static Collection       InputFiles  = STATIC_COLLECTION_INITIALIZER;
+static Collection       OutputFiles = STATIC_COLLECTION_INITIALIZER;
+
+
+
+/*****************************************************************************/
+/*                              Helper functions                             */
+/*****************************************************************************/
+
+
+
+static unsigned long HashBytes (unsigned long H, const void* Data, size_t Len)
+/* Add Len bytes at Data to the 32 bit FNV-1a hash H and return the result */
+{
+    const unsigned char* P = Data;
+    while (Len--) {
+        H = ((H ^ *P++) * 16777619UL) & 0xFFFFFFFFUL;
+    }
+    return H;
+}
+
+
+
+static unsigned long HashKey (void)
+/* Return a hash over all link parameters that are not files */
+{
+    unsigned I;
+    unsigned long H = 2166136261UL;
+
+    /* Linker version */
+    const char* S = GetVersionAsString ();
+    H = HashBytes (H, S, strlen (S) + 1);
+
+    /* Command line */
+    for (I = 1; I < ArgCount; ++I) {
+        H = HashBytes (H, ArgVec[I], strlen (ArgVec[I]) + 1);
+    }
+
+    /* Environment */
+    for (I = 0; I < sizeof (EnvVars) / sizeof (EnvVars[0]); ++I) {
+        S = getenv (EnvVars[I]);
+        if (S == 0) {
+            S = "";
+        }
+        H = HashBytes (H, S, strlen (S) + 1);
+    }
+
+    /* Return the result */
+    return H;
+}
+
+
+
+static int HashFile (const char* Name, unsigned long* Hash, unsigned long* Size)
+/* Calculate a hash over the contents of the given file and determine its
+** size. Return false if the file cannot be read.
+*/
+{
+    char   Buf[4096];
+    size_t Count;
+
+    /* Open the file */
+    FILE* F = fopen (Name, "rb");
+    if (F == 0) {
+        return 0;
+    }
+
+    /* Read and hash it */
+    *Hash = 2166136261UL;
+    *Size = 0;
+    while ((Count = fread (Buf, 1, sizeof (Buf), F)) > 0) {
+        *Hash = HashBytes (*Hash, Buf, Count);
+        *Size += Count;
+    }
+
+    /* Close the file and return the result */
+    Count = ferror (F);
+    fclose (F);
+    return (Count == 0);
+}
+
+
+
+static void AddName (Collection* C, const char* Name)
+/* Add a file name to the given collection if it's not already there */
+{
+    unsigned I;
+    for (I = 0; I < CollCount (C); ++I) {
+        if (strcmp (CollConstAt (C, I), Name) == 0) {
+            return;
+        }
+    }
+    CollAppend (C, xstrdup (Name));
+}
+
+
+
+static int ReadLine (FILE* F, StrBuf* Line)
+/* Read one line from F into Line. Return false on end of file. */
+{
+    int C;
+    SB_Clear (Line);
+    while ((C = getc (F)) != EOF && C != '\n') {
+        SB_AppendChar (Line, (char) C);
+    }
+    SB_Terminate (Line);
+    return (C != EOF || SB_GetLen (Line) > 0);
+}
+
+
+
+static int CheckFileLine (const char* Line)
+/* Check one file line from the state file. Return true if the file is unchanged. */
+{
+    unsigned long Hash, Size;
+    unsigned long CurHash, CurSize;
+    int           Pos;
+
+    /* Parse the line */
+    if (sscanf (Line, "%*s %lx %lu %n", &Hash, &Size, &Pos) != 2) {
+        return 0;
+    }
+
+    /* Check the file */
+    return HashFile (Line + Pos, &CurHash, &CurSize) &&
+           CurHash == Hash                           &&
+           CurSize == Size;
+}
+
+
+
+static void WriteFileLines (FILE* F, const char* Kind, const Collection* C)
+/* Write the lines for all files in C to the state file */
+{
+    unsigned I;
+    for (I = 0; I < CollCount (C); ++I) {
+        unsigned long Hash, Size;
+        const char* Name = CollConstAt (C, I);
+        if (!HashFile (Name, &Hash, &Size)) {
+            Error ("Cannot read '%s' for the up-to-date check: %s",
+                   Name, strerror (errno));
+        }
+        fprintf (F, "%s %08lX %lu %s\n", Kind, Hash, Size, Name);
+    }
+}
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void UpToDateAddInput (const char* Name)
+/* Remember that the given file was read by the linker */
+{
+    if (UpToDateName) {
+        AddName (&InputFiles, Name);
+    }
+}
+
+
+
+void UpToDateAddOutput (const char* Name)
+/* Remember that the given file was written by the linker */
+{
+    if (UpToDateName) {
+        AddName (&OutputFiles, Name);
+    }
+}
+
+
+
+int UpToDateCheck (void)
+/* Read the state file and check if the last link was done with the same
+** command line and the same input files, and if all output files are still
+** unchanged. If so, return true, because linking again would not change
+** anything. Return false if there is no state file or if anything has
+** changed. The check needs nothing but the command line and the state file,
+** so it can be done before any input file is loaded.
+*/
+{
+    StrBuf        Line = STATIC_STRBUF_INITIALIZER;
+    unsigned long Key;
+    unsigned      Files = 0;
+    int           Valid = 0;
+
+    /* Open the state file. If it doesn't exist, the output is outdated */
+    FILE* F = fopen (UpToDateName, "r");
+    if (F == 0) {
+        return 0;
+    }
+
+    /* Check the header and the link parameters */
+    if (!ReadLine (F, &Line) || strcmp (SB_GetConstBuf (&Line), UTD_MAGIC) != 0) {
+        goto ExitPoint;
+    }
+    if (!ReadLine (F, &Line)                                 ||
+        sscanf (SB_GetConstBuf (&Line), "key %lx", &Key) != 1 ||
+        Key != HashKey ()) {
+        goto ExitPoint;
+    }
+
+    /* Check all files */
+    while (ReadLine (F, &Line)) {
+        if (!CheckFileLine (SB_GetConstBuf (&Line))) {
+            goto ExitPoint;
+        }
+        ++Files;
+    }
+
+    /* If we come here, the output is up to date if there were any files */
+    Valid = (Files > 0);
+
+ExitPoint:
+    /* Cleanup */
+    fclose (F);
+    SB_Done (&Line);
+    return Valid;
+}
+
+
+
+void UpToDateWrite (void)
+/* Write the state file after a successful link */
+{
+    /* Open the state file */
+    FILE* F = fopen (UpToDateName, "w");
+    if (F == 0) {
+        Error ("Cannot create up-to-date file '%s': %s",
+               UpToDateName, strerror (errno));
+    }
+
+    /* Write the header, the link parameters and the files */
+    fprintf (F, "%s\nkey %08lX\n", UTD_MAGIC, HashKey ());
+    WriteFileLines (F, "in", &InputFiles);
+    WriteFileLines (F, "out", &OutputFiles);
+
+    /* Close the file */
+    if (fclose (F) != 0) {
+        Error ("Error closing up-to-date file '%s': %s",
+               UpToDateName, strerror (errno));
+    }
+}
@@ -0,0 +1,66 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                uptodate.h                                 */
+/*                                                                           */
+/*          Check if the output files of a link are still up to date         */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#ifndef UPTODATE_H
+#define UPTODATE_H
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void UpToDateAddInput (const char* Name);
+/* Remember that the given file was read by the linker */
+
+void UpToDateAddOutput (const char* Name);
+/* Remember that the given file was written by the linker */
+
+int UpToDateCheck (void);
+/* Read the state file and check if the last link was done with the same
+** command line and the same input files, and if all output files are still
+** unchanged. If so, return true, because linking again would not change
+** anything. Return false if there is no state file or if anything has
+** changed. The check needs nothing but the command line and the state file,
+** so it can be done before any input file is loaded.
+*/
+
+void UpToDateWrite (void);
+/* Write the state file after a successful link */
+
+
+
+/* End of uptodate.h */
+
+#endif
@@ -51,6 +51,7 @@
 #include "memarea.h"
 #include "segments.h"
 #include "spool.h"
+#include "uptodate.h"
 
 
 
@@ -397,6 +398,7 @@ void XexWriteTarget (XexDesc* D, struct File* F)
     if (D->F == 0) {
         Error ("Cannot open `%s': %s", D->Filename, strerror (errno));
     }
+    UpToDateAddOutput (D->Filename);
     D->HeadPos = 0;
 
     /* Keep the user happy */
@@ -43,6 +43,7 @@
 #include "error.h"
 #include "6502.h"
 #include "paravirt.h"
+#include "profile.h"
 
 
 
@@ -3271,10 +3272,16 @@ unsigned ExecuteInsn (void)
     } else {
 
         /* Normal instruction - read the next opcode */
-        unsigned char OPC = MemReadByte (Regs.PC);
+        unsigned PC = Regs.PC;
+        unsigned char OPC = MemReadByte (PC);
 
         /* Execute it */
         Handlers[CPU][OPC] ();
+
+        /* Record it in the execution profile */
+        if (Profiling) {
+            ProfileInsn (PC, OPC, Regs.PC, Cycles);
+        }
     }
 
     /* Count cycles */
@@ -48,6 +48,7 @@
 #include "error.h"
 #include "memory.h"
 #include "paravirt.h"
+#include "profile.h"
 
 
 
@@ -63,6 +64,10 @@ const char* ProgramFile;
 /* exit simulator after MaxCycles Cycles */
 unsigned long MaxCycles;
 
+/* Execution profile and debug info file names */
+static const char* ProfileName;
+static const char* DbgFileName;
+
 /* Header signature 'sim65' */
 static const unsigned char HeaderSignature[] = {
     0x73, 0x69, 0x6D, 0x36, 0x35
@@ -92,6 +97,8 @@ static void Usage (void)
             "Long options:\n"
             "  --help\t\tHelp (this text)\n"
             "  --cycles\t\tPrint amount of executed CPU cycles\n"
+            "  --dbgfile name\t\tRead debug info of the program for the profile\n"
+            "  --profile name\t\tWrite an execution profile of the program\n"
             "  --verbose\t\tIncrease verbosity\n"
             "  --version\t\tPrint the simulator version number\n",
             ProgName);
@@ -127,6 +134,22 @@ static void OptCycles (const char* Opt attribute ((unused)),
 
 
 
+static void OptDbgFile (const char* Opt attribute ((unused)), const char* Arg)
+/* Set the name of the debug info file */
+{
+    DbgFileName = Arg;
+}
+
+
+
+static void OptProfile (const char* Opt attribute ((unused)), const char* Arg)
+/* Set the name of the profile output file */
+{
+    ProfileName = Arg;
+}
+
+
+
 static void OptVersion (const char* Opt attribute ((unused)),
                         const char* Arg attribute ((unused)))
 /* Print the simulator version */
@@ -230,6 +253,8 @@ int main (int argc, char* argv[])
     static const LongOpt OptTab[] = {
         { "--help",             0,      OptHelp                 },
         { "--cycles",           0,      OptCycles               },
+        { "--dbgfile",          1,      OptDbgFile              },
+        { "--profile",          1,      OptProfile              },
         { "--verbose",          0,      OptVerbose              },
         { "--version",          0,      OptVersion              },
     };
@@ -295,6 +320,14 @@ int main (int argc, char* argv[])
         AbEnd ("No program file");
     }
 
+    /* The profile maps addresses to C code using the debug info */
+    if (ProfileName) {
+        if (DbgFileName == 0) {
+            AbEnd ("--profile needs the debug info given with --dbgfile");
+        }
+        ProfileInit (ProfileName, DbgFileName);
+    }
+
     MemInit ();
 
     SPAddr = ReadProgramFile ();
@@ -306,6 +339,7 @@ int main (int argc, char* argv[])
     while (1) {
         ExecuteInsn ();
         if (MaxCycles && (GetCycles () >= MaxCycles)) {
+            ProfileDone ();
             ErrorCode (SIM65_ERROR_TIMEOUT, "Maximum number of cycles reached.");
         }
     }
@@ -65,6 +65,7 @@
 #include "6502.h"
 #include "memory.h"
 #include "paravirt.h"
+#include "profile.h"
 
 
 
@@ -126,6 +127,7 @@ static void PVExit (CPURegs* Regs)
     if (PrintCycles) {
         Print (stdout, 0, "%lu cycles\n", GetCycles ());
     }
+    ProfileDone ();
 
     exit (Regs->AC);
 }
@@ -0,0 +1,302 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                 profile.c                                 */
+/*                                                                           */
+/*                 Execution profile of the simulated program                */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+
+/* common */
+#include "xmalloc.h"
+
+/* dbginfo */
+#include "dbginfo.h"
+
+/* sim65 */
+#include "6502.h"
+#include "error.h"
+#include "profile.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* The profile is a text file with one record per line:
+**
+**      total <cycles>                  Cycles executed by the program
+**      func <calls> <cycles> <name> <file>
+**                                      Calls of a C function, and cycles
+**                                      spent in its own code
+**      line <count> <taken> <nottaken> <line> <file>
+**                                      Executions of the code of a C source
+**                                      line, and the conditional branches
+**                                      within it that were taken or not
+**
+** The count of a line is the count of the first instruction of its code.
+** There may be more than one record for a line, if the code of the line is
+** not contiguous. These are combined by the reader. Lines and functions that were never executed are included with
+** a count of zero.
+*/
+
+/* True if an execution profile is recorded */
+int Profiling = 0;
+
+/* File names */
+static const char*      ProfileFile;
+static const char*      DbgFile;
+
+/* Counters indexed by the address of an instruction */
+static unsigned long*   Count;
+static unsigned long*   Cycles;
+static unsigned long*   Taken;
+static unsigned long*   NotTaken;
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+static void DbgError (const cc65_parseerror* Info)
+/* Callback for errors in the debug info file */
+{
+    if (Info->type == CC65_WARNING) {
+        Warning ("%s(%u): %s", Info->name, (unsigned) Info->line, Info->errormsg);
+    } else {
+        Error ("%s(%u): %s", Info->name, (unsigned) Info->line, Info->errormsg);
+    }
+}
+
+
+
+static const char* GetCFile (cc65_dbginfo Info, unsigned long Addr)
+/* Return the name of the C source file for the code at Addr, or NULL if
+** the code has no C line info.
+*/
+{
+    const char* Name = 0;
+    const cc65_spaninfo* Spans = cc65_span_byaddr (Info, Addr);
+    unsigned I, J;
+
+    for (I = 0; Spans && I < Spans->count && Name == 0; ++I) {
+        const cc65_lineinfo* Lines = cc65_line_byspan (Info, Spans->data[I].span_id);
+        for (J = 0; Lines && J < Lines->count; ++J) {
+            if (Lines->data[J].line_type == CC65_LINE_EXT) {
+                const cc65_sourceinfo* S = cc65_source_byid (Info, Lines->data[J].source_id);
+                Name = S->data[0].source_name;
+                cc65_free_sourceinfo (Info, S);
+                break;
+            }
+        }
+        cc65_free_lineinfo (Info, Lines);
+    }
+    cc65_free_spaninfo (Info, Spans);
+
+    return Name;
+}
+
+
+
+static void WriteFuncs (FILE* F, cc65_dbginfo Info)
+/* Write the records for all C functions of the program */
+{
+    const cc65_moduleinfo* Mods = cc65_get_modulelist (Info);
+    unsigned I, J, K;
+
+    for (I = 0; I < Mods->count; ++I) {
+
+        const cc65_csyminfo* Funcs = cc65_cfunc_bymodule (Info, Mods->data[I].module_id);
+
+        for (J = 0; Funcs && J < Funcs->count; ++J) {
+
+            const cc65_csymdata*   Func = Funcs->data + J;
+            const cc65_symbolinfo* Sym;
+            const cc65_spaninfo*   Spans;
+            unsigned long          Entry;
+            unsigned long          FuncCycles = 0;
+            const char*            File;
+
+            /* The symbol gives the entry point of the function */
+            Sym = cc65_symbol_byid (Info, Func->symbol_id);
+            if (Sym == 0) {
+                continue;
+            }
+            Entry = (unsigned long) Sym->data[0].symbol_value & 0xFFFF;
+            cc65_free_symbolinfo (Info, Sym);
+
+            /* Add up the cycles of the code of the function */
+            Spans = cc65_span_byscope (Info, Func->scope_id);
+            for (K = 0; Spans && K < Spans->count; ++K) {
+                unsigned long Addr;
+                for (Addr = Spans->data[K].span_start; Addr <= Spans->data[K].span_end; ++Addr) {
+                    FuncCycles += Cycles[Addr & 0xFFFF];
+                }
+            }
+            cc65_free_spaninfo (Info, Spans);
+
+            /* Functions without C line info cannot be identified */
+            File = GetCFile (Info, Entry);
+            if (File) {
+                fprintf (F, "func %lu %lu %s %s\n",
+                         Count[Entry], FuncCycles, Func->csym_name, File);
+            }
+        }
+        cc65_free_csyminfo (Info, Funcs);
+    }
+    cc65_free_moduleinfo (Info, Mods);
+}
+
+
+
+static void WriteLines (FILE* F, cc65_dbginfo Info)
+/* Write the records for all C source lines of the program */
+{
+    const cc65_spaninfo* Spans = cc65_get_spanlist (Info);
+    unsigned I, J;
+
+    for (I = 0; I < Spans->count; ++I) {
+
+        const cc65_spandata* Span = Spans->data + I;
+        const cc65_lineinfo* Lines;
+        unsigned long        Addr;
+        unsigned long        SpanCount;
+        unsigned long        SpanTaken    = 0;
+        unsigned long        SpanNotTaken = 0;
+
+        if (Span->line_count == 0) {
+            continue;
+        }
+
+        /* Collect the counters of the instructions in the span */
+        SpanCount = Count[Span->span_start & 0xFFFF];
+        for (Addr = Span->span_start; Addr <= Span->span_end; ++Addr) {
+            SpanTaken    += Taken[Addr & 0xFFFF];
+            SpanNotTaken += NotTaken[Addr & 0xFFFF];
+        }
+
+        /* Write a record for each C line of the span */
+        Lines = cc65_line_byspan (Info, Span->span_id);
+        for (J = 0; Lines && J < Lines->count; ++J) {
+            const cc65_linedata* Line = Lines->data + J;
+            if (Line->line_type == CC65_LINE_EXT) {
+                const cc65_sourceinfo* S = cc65_source_byid (Info, Line->source_id);
+                fprintf (F, "line %lu %lu %lu %u %s\n",
+                         SpanCount, SpanTaken, SpanNotTaken,
+                         (unsigned) Line->source_line, S->data[0].source_name);
+                cc65_free_sourceinfo (Info, S);
+            }
+        }
+        cc65_free_lineinfo (Info, Lines);
+    }
+    cc65_free_spaninfo (Info, Spans);
+}
+
+
+
+void ProfileInit (const char* ProfileName, const char* DbgFileName)
+/* Start recording an execution profile. The profile is written to the file
+** ProfileName, the code addresses are mapped to C functions and lines using
+** the debug info file written by the linker.
+*/
+{
+    ProfileFile = ProfileName;
+    DbgFile     = DbgFileName;
+
+    Count    = xmalloc (0x10000 * sizeof (Count[0]));
+    Cycles   = xmalloc (0x10000 * sizeof (Cycles[0]));
+    Taken    = xmalloc (0x10000 * sizeof (Taken[0]));
+    NotTaken = xmalloc (0x10000 * sizeof (NotTaken[0]));
+    memset (Count,    0, 0x10000 * sizeof (Count[0]));
+    memset (Cycles,   0, 0x10000 * sizeof (Cycles[0]));
+    memset (Taken,    0, 0x10000 * sizeof (Taken[0]));
+    memset (NotTaken, 0, 0x10000 * sizeof (NotTaken[0]));
+
+    Profiling = 1;
+}
+
+
+
+void ProfileInsn (unsigned Addr, unsigned char OPC, unsigned NewPC, unsigned InsnCycles)
+/* Record the execution of the instruction at Addr */
+{
+    Addr &= 0xFFFF;
+    ++Count[Addr];
+    Cycles[Addr] += InsnCycles;
+
+    /* All conditional branches have the opcode xxx10000 */
+    if ((OPC & 0x1F) == 0x10) {
+        if ((NewPC & 0xFFFF) == ((Addr + 2) & 0xFFFF)) {
+            ++NotTaken[Addr];
+        } else {
+            ++Taken[Addr];
+        }
+    }
+}
+
+
+
+void ProfileDone (void)
+/* Write the profile if one is recorded */
+{
+    cc65_dbginfo Info;
+    FILE*        F;
+
+    if (!Profiling) {
+        return;
+    }
+    Profiling = 0;
+
+    /* Read the debug info */
+    Info = cc65_read_dbginfo (DbgFile, DbgError);
+    if (Info == 0) {
+        Error ("Cannot read debug info from '%s'", DbgFile);
+    }
+
+    /* Write the profile */
+    F = fopen (ProfileFile, "w");
+    if (F == 0) {
+        Error ("Cannot open '%s': %s", ProfileFile, strerror (errno));
+    }
+    fprintf (F, "total %lu\n", GetCycles ());
+    WriteFuncs (F, Info);
+    WriteLines (F, Info);
+    if (fclose (F) != 0) {
+        Error ("Cannot write to '%s': %s", ProfileFile, strerror (errno));
+    }
+
+    cc65_free_dbginfo (Info);
+}
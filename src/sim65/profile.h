@@ -0,0 +1,71 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                 profile.h                                 */
+/*                                                                           */
+/*                 Execution profile of the simulated program                */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#ifndef PROFILE_H
+#define PROFILE_H
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* True if an execution profile is recorded */
+extern int Profiling;
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void ProfileInit (const char* ProfileName, const char* DbgFileName);
+/* Start recording an execution profile. The profile is written to the file
+** ProfileName, the code addresses are mapped to C functions and lines using
+** the debug info file written by the linker.
+*/
+
+void ProfileInsn (unsigned Addr, unsigned char OPC, unsigned NewPC, unsigned Cycles);
+/* Record the execution of the instruction at Addr */
+
+void ProfileDone (void);
+/* Write the profile if one is recorded */
+
+
+
+/* End of profile.h */
+
+#endif
@@ -0,0 +1,8 @@
+; Zero page variables for the link time relaxation test in relax.s
+
+        .exportzp       zpvar, zpptr
+
+.zeropage
+
+zpvar:  .res    1
+zpptr:  .res    2
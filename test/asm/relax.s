@@ -0,0 +1,28 @@
+; Test link time relaxation (.feature link_relax). The module uses labels,
+; branches and unnamed labels like normal code does. The linker must shorten
+; the absolute accesses to the zero page variables imported from relax-zp.s,
+; and the jumps to near labels. The result is compared against relax.ref.
+
+        .setcpu         "65C02"
+        .feature        link_relax
+
+        .import         zpvar, zpptr
+
+.code
+
+start:  lda     zpvar           ; zero page
+        ldx     #3
+loop:   sta     zpptr           ; zero page, label in front
+        dex
+        bne     loop            ; branch back over a relaxable instruction
+        beq     :+              ; branch forward over a relaxable instruction
+        inc     zpvar           ; zero page
+:       jmp     done            ; bra, unnamed label in front
+        nop
+back:   ldy     zpptr+1         ; absolute, not a plain import
+        jmp     start           ; bra backwards
+done:   iny
+        jmp     back            ; long, '*' is used in the next part
+        bcs     *+5             ; uses the PC, so the next jump stays long
+        jmp     start
+        rts
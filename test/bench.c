@@ -0,0 +1,510 @@
+// benchmark driver for the cc65 toolchain
+
+/* Each program of the corpus is preprocessed and compiled with cc65,
+   assembled with ca65 and linked with ld65, and the time of each step is
+   measured. The time used by each optimizer step is taken from the
+   statistics cc65 writes if CC65_OPTSTATS is set. The programs are then run
+   in sim65 to count the cycles, and the size of the code is read from the
+   object files with od65.
+
+   The results are written to a text file with one "name metric value" line
+   per measurement. If a baseline file from an earlier run is given, the
+   results are compared to it. The exit code is non zero if the generated
+   code got slower or larger, if a program failed, or if the toolchain got
+   slower by more than the tolerance.
+
+   usage: bench [-B bindir] [-W workdir] [-f flags] [-r repeat]
+                [-t tolerance] [-b baseline] [-o results] file.c ...
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/time.h>
+
+#define MAX_RESULTS     2048
+#define MAX_STEPS       256
+#define MAX_CMD         1024
+
+/* A measurement. Name is a program, "total" or an optimizer step. */
+typedef struct {
+    char    Name[32];
+    char    Metric[16];
+    double  Value;
+} Result;
+
+/* Totals for one optimizer step */
+typedef struct {
+    char            Name[32];
+    unsigned long   Runs;
+    unsigned long   Changes;
+    double          Time;
+} OptStep;
+
+static const char*  BinDir      = 0;
+static const char*  WorkDir     = ".";
+static const char*  Flags       = "-Oirs";
+static unsigned     Repeat      = 3;
+static double       Tolerance   = 10.0;
+
+static Result       Results[MAX_RESULTS];
+static unsigned     ResultCount;
+static Result       Baseline[MAX_RESULTS];
+static unsigned     BaselineCount;
+static OptStep      Steps[MAX_STEPS];
+static unsigned     StepCount;
+
+/* Time metrics, in milliseconds */
+static const char* TimeMetrics[] = {
+    "preprocess", "compile", "optimize", "assemble", "link", "time"
+};
+#define TIME_METRICS    (sizeof (TimeMetrics) / sizeof (TimeMetrics[0]))
+
+/* Metrics of the generated code, smaller is better */
+static const char* CodeMetrics[] = {
+    "cycles", "code", "data", "prgsize"
+};
+#define CODE_METRICS    (sizeof (CodeMetrics) / sizeof (CodeMetrics[0]))
+
+
+
+static void Fail (const char* Msg, const char* Arg)
+{
+    fprintf (stderr, "bench: %s%s\n", Msg, Arg);
+    exit (EXIT_FAILURE);
+}
+
+
+
+static int IsIn (const char* S, const char** List, unsigned Count)
+{
+    unsigned I;
+    for (I = 0; I < Count; ++I) {
+        if (strcmp (S, List[I]) == 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+
+
+static void Add (const char* Name, const char* Metric, double Value)
+{
+    Result* R;
+    if (ResultCount == MAX_RESULTS) {
+        Fail ("Too many results", "");
+    }
+    R = Results + ResultCount++;
+    sprintf (R->Name, "%.31s", Name);
+    sprintf (R->Metric, "%.15s", Metric);
+    R->Value = Value;
+}
+
+
+
+static double Total (const char* Metric)
+{
+    double Sum = 0.0;
+    unsigned I;
+    for (I = 0; I < ResultCount; ++I) {
+        if (strcmp (Results[I].Metric, Metric) == 0) {
+            Sum += Results[I].Value;
+        }
+    }
+    return Sum;
+}
+
+
+
+static const char* Tool (const char* Name)
+/* Return the path of a tool */
+{
+    static char Buf[4][256];
+    static unsigned Index;
+    char* B = Buf[Index++ % 4];
+    if (BinDir) {
+        sprintf (B, "%.200s/%s", BinDir, Name);
+    } else {
+        sprintf (B, "%s", Name);
+    }
+    return B;
+}
+
+
+
+static double Now (void)
+/* Return the wall clock time in milliseconds */
+{
+    struct timeval T;
+    gettimeofday (&T, 0);
+    return T.tv_sec * 1000.0 + T.tv_usec / 1000.0;
+}
+
+
+
+static double Time (const char* Cmd)
+/* Run a command Repeat times and return the best time in milliseconds */
+{
+    double Best = 0.0;
+    unsigned I;
+    for (I = 0; I < Repeat; ++I) {
+        double Start = Now ();
+        double T;
+        if (system (Cmd) != 0) {
+            Fail ("Command failed: ", Cmd);
+        }
+        T = Now () - Start;
+        if (I == 0 || T < Best) {
+            Best = T;
+        }
+    }
+    return Best;
+}
+
+
+
+static double OptStats (const char* Name)
+/* Read an optimizer statistics file written by cc65 for one compile. Add
+   the counts to the totals per step and return the time used by all steps.
+*/
+{
+    char Line[256];
+    double Sum = 0.0;
+    FILE* F = fopen (Name, "r");
+    if (F == 0) {
+        Fail ("Cannot open ", Name);
+    }
+    while (fgets (Line, sizeof (Line), F)) {
+        char StepName[32];
+        unsigned long Runs, Changes, Time;
+        unsigned I;
+        if (Line[0] == ';' ||
+            sscanf (Line, "%31s %*u %lu %*u %lu %*u %lu", StepName, &Runs, &Changes, &Time) != 4) {
+            continue;
+        }
+        for (I = 0; I < StepCount && strcmp (Steps[I].Name, StepName) != 0; ++I) {
+        }
+        if (I == StepCount) {
+            if (StepCount == MAX_STEPS) {
+                continue;
+            }
+            strcpy (Steps[StepCount++].Name, StepName);
+        }
+        Steps[I].Runs    += Runs;
+        Steps[I].Changes += Changes;
+        Steps[I].Time    += Time / 1000.0;
+        Sum += Time / 1000.0;
+    }
+    fclose (F);
+    return Sum;
+}
+
+
+
+static unsigned long RunProgram (const char* Prg)
+/* Run a program in sim65 and return the number of cycles */
+{
+    char Cmd[MAX_CMD];
+    char Line[256];
+    unsigned long Cycles = 0;
+    FILE* P;
+
+    sprintf (Cmd, "%s -c %s 2>&1", Tool ("sim65"), Prg);
+    if ((P = popen (Cmd, "r")) == 0) {
+        Fail ("Cannot run ", Cmd);
+    }
+    while (fgets (Line, sizeof (Line), P)) {
+        unsigned long C;
+        char Word[8];
+        if (sscanf (Line, "%lu %7s", &C, Word) == 2 && strcmp (Word, "cycles") == 0) {
+            Cycles = C;
+        }
+    }
+    if (pclose (P) != 0) {
+        Fail ("Program failed: ", Prg);
+    }
+    return Cycles;
+}
+
+
+
+static void SegSizes (const char* Obj, unsigned long* Code, unsigned long* Data)
+/* Get the size of code and data of an object file */
+{
+    char Cmd[MAX_CMD];
+    char Line[256];
+    FILE* P;
+
+    *Code = *Data = 0;
+    sprintf (Cmd, "%s --dump-segsize %s", Tool ("od65"), Obj);
+    if ((P = popen (Cmd, "r")) == 0) {
+        Fail ("Cannot run ", Cmd);
+    }
+    while (fgets (Line, sizeof (Line), P)) {
+        char Seg[32];
+        unsigned long Size;
+        if (sscanf (Line, " %31[^:]: %lu", Seg, &Size) != 2) {
+            continue;
+        }
+        if (strcmp (Seg, "CODE") == 0) {
+            *Code += Size;
+        } else if (strcmp (Seg, "RODATA") == 0 || strcmp (Seg, "DATA") == 0) {
+            *Data += Size;
+        }
+    }
+    pclose (P);
+}
+
+
+
+static long FileSize (const char* Name)
+{
+    long Size;
+    FILE* F = fopen (Name, "rb");
+    if (F == 0) {
+        Fail ("Cannot open ", Name);
+    }
+    fseek (F, 0, SEEK_END);
+    Size = ftell (F);
+    fclose (F);
+    return Size;
+}
+
+
+
+static void Bench (const char* File)
+/* Run the benchmark for one program */
+{
+    char Cmd[MAX_CMD];
+    char Base[256];
+    char Out[4][320];
+    char Stats[320];
+    const char* S;
+    double Compile, Optimize;
+    unsigned long Code, Data;
+    size_t Len;
+
+    /* Name of the program without directory and extension */
+    S = strrchr (File, '/');
+    S = S? S + 1 : File;
+    Len = strcspn (S, ".");
+    sprintf (Base, "%.*s", (int) (Len < 200? Len : 200), S);
+    sprintf (Out[0], "%s/%s.i", WorkDir, Base);
+    sprintf (Out[1], "%s/%s.s", WorkDir, Base);
+    sprintf (Out[2], "%s/%s.o", WorkDir, Base);
+    sprintf (Out[3], "%s/%s.prg", WorkDir, Base);
+    sprintf (Stats, "%s/%s.optstats", WorkDir, Base);
+
+    printf ("bench: %s\n", File);
+    fflush (stdout);
+
+    /* The compiler. cc65 parses and generates code in one pass, so the
+       compile time includes the preprocessor and the optimizer. The time
+       of the optimizer is measured in a separate run, since collecting
+       the statistics slows it down.
+    */
+    sprintf (Cmd, "%s -t sim6502 %s -E -o %s %s", Tool ("cc65"), Flags, Out[0], File);
+    Add (Base, "preprocess", Time (Cmd));
+    sprintf (Cmd, "%s -t sim6502 %s -o %s %s", Tool ("cc65"), Flags, Out[1], File);
+    Compile = Time (Cmd);
+    Add (Base, "compile", Compile);
+    remove (Stats);
+    sprintf (Cmd, "CC65_OPTSTATS=%s %s -t sim6502 %s -o %s %s",
+             Stats, Tool ("cc65"), Flags, Out[1], File);
+    if (system (Cmd) != 0) {
+        Fail ("Command failed: ", Cmd);
+    }
+    Optimize = OptStats (Stats);
+    Add (Base, "optimize", Optimize);
+
+    /* Assembler and linker */
+    sprintf (Cmd, "%s -t sim6502 -o %s %s", Tool ("ca65"), Out[2], Out[1]);
+    Add (Base, "assemble", Time (Cmd));
+    sprintf (Cmd, "%s -t sim6502 -o %s %s sim6502.lib", Tool ("ld65"), Out[3], Out[2]);
+    Add (Base, "link", Time (Cmd));
+
+    /* The generated code */
+    Add (Base, "cycles", RunProgram (Out[3]));
+    SegSizes (Out[2], &Code, &Data);
+    Add (Base, "code", Code);
+    Add (Base, "data", Data);
+    Add (Base, "prgsize", FileSize (Out[3]));
+}
+
+
+
+static void WriteResults (const char* Name)
+{
+    unsigned I;
+    FILE* F = fopen (Name, "w");
+    if (F == 0) {
+        Fail ("Cannot create ", Name);
+    }
+    fprintf (F, "# cc65 benchmark results, flags: %s\n", Flags);
+    fprintf (F, "# name metric value (times in milliseconds)\n");
+    for (I = 0; I < ResultCount; ++I) {
+        const Result* R = Results + I;
+        if (IsIn (R->Metric, TimeMetrics, TIME_METRICS)) {
+            fprintf (F, "%s %s %.3f\n", R->Name, R->Metric, R->Value);
+        } else {
+            fprintf (F, "%s %s %.0f\n", R->Name, R->Metric, R->Value);
+        }
+    }
+    fclose (F);
+}
+
+
+
+static void ReadBaseline (const char* Name)
+{
+    char Line[256];
+    FILE* F = fopen (Name, "r");
+    if (F == 0) {
+        Fail ("Cannot open ", Name);
+    }
+    while (fgets (Line, sizeof (Line), F) && BaselineCount < MAX_RESULTS) {
+        Result* R = Baseline + BaselineCount;
+        if (Line[0] != '#' &&
+            sscanf (Line, "%31s %15s %lf", R->Name, R->Metric, &R->Value) == 3) {
+            ++BaselineCount;
+        }
+    }
+    fclose (F);
+}
+
+
+
+static const Result* FindBaseline (const Result* R)
+{
+    unsigned I;
+    for (I = 0; I < BaselineCount; ++I) {
+        if (strcmp (Baseline[I].Name, R->Name) == 0 &&
+            strcmp (Baseline[I].Metric, R->Metric) == 0) {
+            return Baseline + I;
+        }
+    }
+    return 0;
+}
+
+
+
+static unsigned Compare (void)
+/* Compare the results to the baseline and return the number of regressions.
+   The code metrics are exact, so any increase is a regression. Times are
+   only compared for the whole corpus and the optimizer steps, since the
+   times of single runs are too noisy. Times of the optimizer steps are
+   reported but don't count as regressions.
+*/
+{
+    unsigned Regressions = 0;
+    unsigned I;
+
+    printf ("\n%-16s %-10s %12s %12s %8s\n", "name", "metric", "baseline", "current", "change");
+    for (I = 0; I < ResultCount; ++I) {
+        const Result* R = Results + I;
+        const Result* B = FindBaseline (R);
+        const char* Note;
+        double Change;
+
+        if (B == 0 || B->Value == R->Value) {
+            continue;
+        }
+        Change = (B->Value != 0.0)? (R->Value - B->Value) * 100.0 / B->Value : 100.0;
+
+        if (IsIn (R->Metric, CodeMetrics, CODE_METRICS)) {
+            if (R->Value > B->Value) {
+                Note = "worse";
+                ++Regressions;
+            } else {
+                Note = "better";
+            }
+        } else if (strcmp (R->Name, "total") == 0 &&
+                   IsIn (R->Metric, TimeMetrics, TIME_METRICS)) {
+            if (Change > Tolerance) {
+                Note = "slower";
+                ++Regressions;
+            } else if (Change < -Tolerance) {
+                Note = "faster";
+            } else {
+                continue;
+            }
+        } else if (strcmp (R->Metric, "time") == 0 && B->Value >= 1.0) {
+            if (Change > Tolerance) {
+                Note = "slower";
+            } else if (Change < -Tolerance) {
+                Note = "faster";
+            } else {
+                continue;
+            }
+        } else {
+            continue;
+        }
+        printf ("%-16s %-10s %12.*f %12.*f %+7.1f%% %s\n",
+                R->Name, R->Metric,
+                IsIn (R->Metric, TimeMetrics, TIME_METRICS)? 3 : 0, B->Value,
+                IsIn (R->Metric, TimeMetrics, TIME_METRICS)? 3 : 0, R->Value,
+                Change, Note);
+    }
+    printf ("\nbench: %u regression(s)\n", Regressions);
+    return Regressions;
+}
+
+
+
+int main (int argc, char* argv[])
+{
+    const char* BaselineFile = 0;
+    const char* ResultFile = "results.txt";
+    unsigned Metric;
+    int I;
+
+    for (I = 1; I < argc && argv[I][0] == '-'; I += 2) {
+        const char* Arg;
+        if (I + 1 >= argc) {
+            Fail ("Missing argument for ", argv[I]);
+        }
+        Arg = argv[I + 1];
+        switch (argv[I][1]) {
+            case 'B':   BinDir = Arg;                   break;
+            case 'W':   WorkDir = Arg;                  break;
+            case 'f':   Flags = Arg;                    break;
+            case 'r':   Repeat = atoi (Arg);            break;
+            case 't':   Tolerance = atof (Arg);         break;
+            case 'b':   BaselineFile = Arg;             break;
+            case 'o':   ResultFile = Arg;               break;
+            default:    Fail ("Invalid option ", argv[I]);
+        }
+    }
+    if (I >= argc || Repeat == 0) {
+        Fail ("usage: bench [-B bindir] [-W workdir] [-f flags] [-r repeat] "
+              "[-t tolerance] [-b baseline] [-o results] file.c ...", "");
+    }
+
+    /* Run the benchmarks */
+    for (; I < argc; ++I) {
+        Bench (argv[I]);
+    }
+
+    /* Totals for the corpus, and the optimizer steps */
+    for (Metric = 0; Metric < TIME_METRICS - 1; ++Metric) {
+        Add ("total", TimeMetrics[Metric], Total (TimeMetrics[Metric]));
+    }
+    for (Metric = 0; Metric < CODE_METRICS; ++Metric) {
+        Add ("total", CodeMetrics[Metric], Total (CodeMetrics[Metric]));
+    }
+    for (Metric = 0; Metric < StepCount; ++Metric) {
+        Add (Steps[Metric].Name, "runs", Steps[Metric].Runs);
+        Add (Steps[Metric].Name, "changes", Steps[Metric].Changes);
+        Add (Steps[Metric].Name, "time", Steps[Metric].Time);
+    }
+
+    WriteResults (ResultFile);
+    printf ("bench: wrote %s\n", ResultFile);
+
+    if (BaselineFile) {
+        ReadBaseline (BaselineFile);
+        return Compare ()? EXIT_FAILURE : EXIT_SUCCESS;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,54 @@
+/*
+  !!DESCRIPTION!! Benchmark: table driven CRC-32
+  !!ORIGIN!!      cc65 benchmarks
+  !!LICENCE!!     Public Domain
+*/
+
+#include <stdio.h>
+
+#define SIZE    2048
+
+static unsigned long table[256];
+static unsigned char buf[SIZE];
+
+static void maketable (void)
+{
+    unsigned i;
+    unsigned char k;
+    unsigned long c;
+
+    for (i = 0; i < 256; ++i) {
+        c = i;
+        for (k = 0; k < 8; ++k) {
+            if (c & 1) {
+                c = (c >> 1) ^ 0xEDB88320UL;
+            } else {
+                c >>= 1;
+            }
+        }
+        table[i] = c;
+    }
+}
+
+static unsigned long crc32 (const unsigned char* p, unsigned len)
+{
+    unsigned long c = 0xFFFFFFFFUL;
+    while (len--) {
+        c = table[(unsigned char) c ^ *p++] ^ (c >> 8);
+    }
+    return c ^ 0xFFFFFFFFUL;
+}
+
+int main (void)
+{
+    unsigned i;
+    unsigned long crc;
+
+    maketable ();
+    for (i = 0; i < SIZE; ++i) {
+        buf[i] = (unsigned char) (i * 7 + (i >> 8));
+    }
+    crc = crc32 (buf, SIZE);
+    printf ("crc %08lX\n", crc);
+    return crc != 0x3870B657UL;
+}
@@ -0,0 +1,77 @@
+/*
+  !!DESCRIPTION!! Benchmark: linked lists and structures
+  !!ORIGIN!!      cc65 benchmarks
+  !!LICENCE!!     Public Domain
+*/
+
+#include <stdio.h>
+
+#define COUNT   200
+#define ROUNDS  10
+
+typedef struct node node;
+struct node {
+    node*           next;
+    unsigned        key;
+    unsigned char   tag;
+};
+
+static node nodes[COUNT];
+static node* head;
+
+static void build (void)
+{
+    unsigned i;
+    head = 0;
+    for (i = 0; i < COUNT; ++i) {
+        nodes[i].key = (i * 37) % COUNT;
+        nodes[i].tag = (unsigned char) i;
+        nodes[i].next = head;
+        head = &nodes[i];
+    }
+}
+
+static node* find (unsigned key)
+{
+    node* n;
+    for (n = head; n; n = n->next) {
+        if (n->key == key) {
+            return n;
+        }
+    }
+    return 0;
+}
+
+static void reverse (void)
+{
+    node* prev = 0;
+    node* n = head;
+    node* next;
+    while (n) {
+        next = n->next;
+        n->next = prev;
+        prev = n;
+        n = next;
+    }
+    head = prev;
+}
+
+int main (void)
+{
+    unsigned char r;
+    unsigned i;
+    unsigned long sum = 0;
+
+    build ();
+    for (r = 0; r < ROUNDS; ++r) {
+        reverse ();
+        for (i = 0; i < COUNT; i += 7) {
+            node* n = find (i);
+            if (n) {
+                sum += n->tag;
+            }
+        }
+    }
+    printf ("sum %lu\n", sum);
+    return sum != 24660UL;
+}
@@ -0,0 +1,55 @@
+/*
+  !!DESCRIPTION!! Benchmark: 32 bit arithmetic
+  !!ORIGIN!!      cc65 benchmarks
+  !!LICENCE!!     Public Domain
+*/
+
+#include <stdio.h>
+
+#define COUNT   40
+
+static unsigned long gcd (unsigned long a, unsigned long b)
+{
+    unsigned long t;
+    while (b) {
+        t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+static unsigned long isqrt (unsigned long n)
+{
+    unsigned long r = 0;
+    unsigned long bit = 1UL << 30;
+    while (bit > n) {
+        bit >>= 2;
+    }
+    while (bit) {
+        if (n >= r + bit) {
+            n -= r + bit;
+            r = (r >> 1) + bit;
+        } else {
+            r >>= 1;
+        }
+        bit >>= 2;
+    }
+    return r;
+}
+
+int main (void)
+{
+    unsigned char i;
+    unsigned long a = 1, b = 1, t;
+    unsigned long sum = 0;
+
+    for (i = 0; i < COUNT; ++i) {
+        t = a + b;
+        a = b;
+        b = t;
+        sum += gcd (a * 3UL, b * 5UL) + isqrt (b);
+    }
+    printf ("sum %lu\n", sum);
+    return sum != 76625UL;
+}
@@ -0,0 +1,67 @@
+/*
+  !!DESCRIPTION!! Benchmark: integer matrix multiplication
+  !!ORIGIN!!      cc65 benchmarks
+  !!LICENCE!!     Public Domain
+*/
+
+#include <stdio.h>
+
+#define N       12
+#define ROUNDS  4
+
+static int a[N][N];
+static int b[N][N];
+static int c[N][N];
+
+static void init (void)
+{
+    unsigned char i, j;
+    for (i = 0; i < N; ++i) {
+        for (j = 0; j < N; ++j) {
+            a[i][j] = i + j;
+            b[i][j] = i - j;
+        }
+    }
+}
+
+static void multiply (void)
+{
+    unsigned char i, j, k;
+    int sum;
+
+    for (i = 0; i < N; ++i) {
+        for (j = 0; j < N; ++j) {
+            sum = 0;
+            for (k = 0; k < N; ++k) {
+                sum += a[i][k] * b[k][j];
+            }
+            c[i][j] = sum;
+        }
+    }
+}
+
+static long checksum (void)
+{
+    unsigned char i, j;
+    long sum = 0;
+    for (i = 0; i < N; ++i) {
+        for (j = 0; j < N; ++j) {
+            sum += c[i][j] * (long) (i + 1);
+        }
+    }
+    return sum;
+}
+
+int main (void)
+{
+    unsigned char r;
+    long sum;
+
+    init ();
+    for (r = 0; r < ROUNDS; ++r) {
+        multiply ();
+    }
+    sum = checksum ();
+    printf ("checksum %ld\n", sum);
+    return sum != 133848L;
+}
@@ -0,0 +1,43 @@
+/*
+  !!DESCRIPTION!! Benchmark: sieve of Eratosthenes
+  !!ORIGIN!!      cc65 benchmarks
+  !!LICENCE!!     Public Domain
+*/
+
+#include <stdio.h>
+#include <string.h>
+
+#define SIZE    8190
+#define ROUNDS  3
+
+static unsigned char flags[SIZE + 1];
+
+static unsigned sieve (void)
+{
+    unsigned i, k, prime, count;
+
+    memset (flags, 1, sizeof (flags));
+    count = 0;
+    for (i = 0; i <= SIZE; ++i) {
+        if (flags[i]) {
+            prime = i + i + 3;
+            for (k = i + prime; k <= SIZE; k += prime) {
+                flags[k] = 0;
+            }
+            ++count;
+        }
+    }
+    return count;
+}
+
+int main (void)
+{
+    unsigned char r;
+    unsigned count = 0;
+
+    for (r = 0; r < ROUNDS; ++r) {
+        count = sieve ();
+    }
+    printf ("%u primes\n", count);
+    return count != 1899;
+}
@@ -0,0 +1,83 @@
+/*
+  !!DESCRIPTION!! Benchmark: sorting integers
+  !!ORIGIN!!      cc65 benchmarks
+  !!LICENCE!!     Public Domain
+*/
+
+#include <stdio.h>
+
+#define COUNT   400
+
+static int data[COUNT];
+static unsigned seed = 1;
+
+static int nextrand (void)
+{
+    seed = seed * 25173U + 13849U;
+    return (int) seed;
+}
+
+static void fill (void)
+{
+    unsigned i;
+    for (i = 0; i < COUNT; ++i) {
+        data[i] = nextrand ();
+    }
+}
+
+static void shellsort (int* a, unsigned n)
+{
+    unsigned gap, i, j;
+    int t;
+
+    for (gap = n / 2; gap > 0; gap /= 2) {
+        for (i = gap; i < n; ++i) {
+            t = a[i];
+            for (j = i; j >= gap && a[j - gap] > t; j -= gap) {
+                a[j] = a[j - gap];
+            }
+            a[j] = t;
+        }
+    }
+}
+
+static void insertionsort (int* a, unsigned n)
+{
+    unsigned i, j;
+    int t;
+
+    for (i = 1; i < n; ++i) {
+        t = a[i];
+        for (j = i; j > 0 && a[j - 1] > t; --j) {
+            a[j] = a[j - 1];
+        }
+        a[j] = t;
+    }
+}
+
+static int sorted (const int* a, unsigned n)
+{
+    unsigned i;
+    for (i = 1; i < n; ++i) {
+        if (a[i - 1] > a[i]) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+int main (void)
+{
+    int failures = 0;
+
+    fill ();
+    shellsort (data, COUNT);
+    failures += !sorted (data, COUNT);
+
+    fill ();
+    insertionsort (data, COUNT / 2);
+    failures += !sorted (data, COUNT / 2);
+
+    printf ("failures: %d\n", failures);
+    return failures;
+}
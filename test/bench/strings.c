@@ -0,0 +1,81 @@
+/*
+  !!DESCRIPTION!! Benchmark: string handling
+  !!ORIGIN!!      cc65 benchmarks
+  !!LICENCE!!     Public Domain
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+
+#define ROUNDS  20
+
+static const char text[] =
+    "The quick brown fox jumps over the lazy dog. "
+    "Pack my box with five dozen liquor jugs. "
+    "How vexingly quick daft zebras jump!";
+
+static char buf[sizeof (text)];
+
+static void reverse (char* s)
+{
+    char* e = s + strlen (s) - 1;
+    char c;
+    while (s < e) {
+        c = *s;
+        *s++ = *e;
+        *e-- = c;
+    }
+}
+
+static unsigned words (const char* s)
+{
+    unsigned n = 0;
+    char inword = 0;
+    while (*s) {
+        if (isalpha (*s)) {
+            if (!inword) {
+                ++n;
+                inword = 1;
+            }
+        } else {
+            inword = 0;
+        }
+        ++s;
+    }
+    return n;
+}
+
+static void upper (char* s)
+{
+    for (; *s; ++s) {
+        *s = toupper (*s);
+    }
+}
+
+static unsigned hash (const char* s)
+{
+    unsigned h = 0;
+    while (*s) {
+        h = (h << 5) + h + (unsigned char) *s++;
+    }
+    return h;
+}
+
+int main (void)
+{
+    unsigned char r;
+    unsigned n = 0;
+    unsigned h = 0;
+
+    for (r = 0; r < ROUNDS; ++r) {
+        strcpy (buf, text);
+        reverse (buf);
+        reverse (buf);
+        upper (buf);
+        n = words (buf);
+        h = hash (buf);
+    }
+    printf ("%u words, hash %04X\n", n, h);
+    return n != 23 || h != 0xB4C2;
+}
@@ -0,0 +1,21 @@
+/* cl65 --cache-dir must run the compiler when it writes a call graph, and
+** must not use a cached object file after the call graph has changed.
+** With TAKE_ADDR, sum() cannot have a static frame.
+*/
+
+#include <stdio.h>
+
+int sum (int a, int b)
+{
+    return a + b;
+}
+
+#ifdef TAKE_ADDR
+int (*p) (int, int) = sum;
+#endif
+
+int main (void)
+{
+    printf ("%d\n", sum (5, 10));
+    return 0;
+}
@@ -0,0 +1,50 @@
+/*
+  !!DESCRIPTION!! Second unit of static-frames.c
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+*/
+
+int mid (int a);
+int is_even (unsigned n);
+
+int twice (int x)
+{
+    int t = x;
+    return t + t;
+}
+
+int scale (int x, int y)
+{
+    int r = x * 10;
+    return r + y;
+}
+
+unsigned fact (unsigned n)
+{
+    unsigned r;
+    if (n <= 1) {
+        return 1;
+    }
+    r = fact (n - 1);
+    return n * r;
+}
+
+int is_odd (unsigned n)
+{
+    return n == 0 ? 0 : is_even (n - 1);
+}
+
+int apply (int (*f) (int), int x)
+{
+    int before = x;
+    int r = f (x);
+    return r + (before - x);
+}
+
+/* Calls a function of the other unit, whose frame lies below this one */
+int outer (int a)
+{
+    int s = twice (a);
+    s += mid (a) - 100;
+    return s + scale (a, 0);
+}
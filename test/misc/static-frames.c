@@ -0,0 +1,87 @@
+/*
+  !!DESCRIPTION!! Static stack frames, compiled in two passes with static-frames-2.c
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+*/
+
+#include <stdio.h>
+
+/* In static-frames-2.c */
+int twice (int x);
+int scale (int x, int y);
+unsigned fact (unsigned n);
+int is_odd (unsigned n);
+int apply (int (*f) (int), int x);
+int outer (int a);
+
+static unsigned failures;
+
+static void check (int got, int expected, const char* what)
+{
+    if (got != expected) {
+        printf ("%s: got %d, expected %d\n", what, got, expected);
+        ++failures;
+    }
+}
+
+/* leaf1 and leaf2 are never active at the same time, so their frames
+** overlap. The frame of mid is above both, so keep survives the calls.
+*/
+static int leaf1 (int a, int b)
+{
+    int t = a * b;
+    return t + a;
+}
+
+static int leaf2 (int a, int b)
+{
+    int u = a - b;
+    return u * 2;
+}
+
+int mid (int a)
+{
+    int keep = a + 100;
+    int r = leaf1 (a, 3);
+    r += leaf2 (a, 1);
+    return r + keep;
+}
+
+/* The arguments of sum3 are written to its frame one after the other, so
+** functions called while evaluating them must not overlap with it. This
+** includes sum3 itself.
+*/
+static int sum3 (int a, int b, int c)
+{
+    return a * 100 + b * 10 + c;
+}
+
+/* Recursive through is_odd in the other unit */
+int is_even (unsigned n)
+{
+    return n == 0 ? 1 : is_odd (n - 1);
+}
+
+/* The address is taken, so this one must use the stack */
+static int inc (int x)
+{
+    int y = x + 1;
+    return y;
+}
+
+int main (void)
+{
+    check (leaf1 (4, 5), 24, "leaf1");
+    check (leaf2 (9, 4), 10, "leaf2");
+    check (mid (5), 133, "mid");
+    check (sum3 (twice (2), scale (1, 2), twice (3)), 526, "sum3");
+    check (sum3 (1, sum3 (0, 2, 3), mid (0)), 428, "sum3 nested");
+    check (fact (7), 5040, "fact");
+    check (is_even (10), 1, "is_even");
+    check (is_even (7), 0, "is_even");
+    check (apply (inc, 41), 42, "apply");
+    check (outer (3), 55, "outer");
+
+    printf ("failures: %u\n", failures);
+    return failures;
+}
@@ -0,0 +1,110 @@
+/*
+  !!DESCRIPTION!! Register usage of called functions known to the optimizer
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+*/
+
+#include <stdio.h>
+
+static unsigned failures;
+
+static unsigned char buf[16];
+static unsigned char cnt;
+static unsigned total;
+
+static unsigned char later (unsigned char c);
+
+static void setb (unsigned char i)
+{
+    buf[i] = i;
+}
+
+static void inc (void)
+{
+    ++cnt;
+}
+
+static void clobber (void)
+{
+    /* Change registers behind the back of the compiler */
+    asm ("ldx #$55");
+    asm ("ldy #$AA");
+    asm ("sta tmp1");
+    asm ("sta ptr1");
+    asm ("sta sreg");
+}
+
+static unsigned char add (unsigned char a, unsigned char b)
+{
+    return a + b;
+}
+
+static unsigned char tail (unsigned char c)
+{
+    return add (c, 1);
+}
+
+static unsigned sum (unsigned n)
+{
+    if (n == 0) {
+        return 0;
+    }
+    return n + sum (n - 1);
+}
+
+static unsigned char (*fp) (unsigned char) = tail;
+
+static unsigned char f1 (void)
+{
+    unsigned char i;
+    for (i = 0; i < sizeof (buf); ++i) {
+        setb (i);
+        inc ();
+    }
+    return cnt;
+}
+
+static unsigned f2 (void)
+{
+    unsigned char i;
+    unsigned char j = 3;
+    for (i = 0; i < 10; ++i) {
+        clobber ();
+        total += i + j;
+        clobber ();
+    }
+    return total;
+}
+
+static unsigned f3 (void)
+{
+    unsigned char i;
+    unsigned s = 0;
+    for (i = 0; i < 10; ++i) {
+        s += tail (i);
+        s += fp (i);
+        s += later (i);
+        inc ();
+    }
+    return s;
+}
+
+static unsigned char later (unsigned char c)
+{
+    return c << 1;
+}
+
+int main (void)
+{
+    unsigned char i;
+    if (f1 () != 16) { printf ("f1 %u\n", cnt); ++failures; }
+    for (i = 0; i < sizeof (buf); ++i) {
+        if (buf[i] != i) { printf ("buf[%u] %u\n", i, buf[i]); ++failures; }
+    }
+    if (f2 () != 75) { printf ("f2 %u\n", total); ++failures; }
+    if (f3 () != 200) { printf ("f3\n"); ++failures; }
+    if (cnt != 26) { printf ("cnt %u\n", cnt); ++failures; }
+    if (sum (10) != 55) { printf ("sum %u\n", sum (10)); ++failures; }
+    printf ("failures: %u\n", failures);
+    return failures;
+}
@@ -0,0 +1,47 @@
+/*
+  !!DESCRIPTION!! Include guards and #pragma once
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+*/
+
+#include <stdio.h>
+
+/* The guarded header adds "first" only once */
+#include "inc-guard.h"
+#include "inc-guard.h"
+
+/* Must be read again after the guard macro is gone */
+#undef INC_GUARD_H
+#define SECOND
+#include "inc-guard.h"
+
+/* Code behind the #endif means there's no guard */
+int noguard = 0
+#include "inc-noguard.h"
+#include "inc-noguard.h"
+;
+
+/* #pragma once reads the header only once */
+int once = 0
+#include "inc-once.h"
+#include "inc-once.h"
+;
+
+int main (void)
+{
+    int failures = 0;
+
+    if (first + second != 3) {
+        printf ("guard: %d %d\n", first, second);
+        ++failures;
+    }
+    if (noguard != 2) {
+        printf ("noguard: %d\n", noguard);
+        ++failures;
+    }
+    if (once != 1) {
+        printf ("once: %d\n", once);
+        ++failures;
+    }
+    return failures;
+}
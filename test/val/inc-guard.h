@@ -0,0 +1,12 @@
+/* Header with an include guard, used by inc-guard.c */
+
+#ifndef INC_GUARD_H
+#define INC_GUARD_H
+
+#ifdef SECOND
+int second = 2;
+#else
+int first = 1;
+#endif
+
+#endif /* INC_GUARD_H */
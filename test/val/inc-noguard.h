@@ -0,0 +1,5 @@
+/* Header with code behind the #endif, used by inc-guard.c */
+#ifndef INC_NOGUARD_H
+#define INC_NOGUARD_H
+#endif
++ 1
@@ -0,0 +1,3 @@
+/* Header using #pragma once, used by inc-guard.c */
+#pragma once
++ 1
@@ -0,0 +1,126 @@
+/*
+  !!DESCRIPTION!! Small static functions inlined into their callers
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+*/
+
+#include <stdio.h>
+
+static unsigned failures;
+
+static unsigned char cnt;
+static int glob = 100;
+static unsigned order[4];
+static unsigned char pos;
+
+static void inc (void)
+{
+    ++cnt;
+}
+
+static inline void addcnt (unsigned char n)
+{
+    cnt += n;
+}
+
+inline static int twice (int x)
+{
+    return x + x;
+}
+
+static unsigned char low (unsigned x)
+{
+    return x & 0xFF;
+}
+
+static long lmul (long a, long b)
+{
+    return a * b;
+}
+
+static char first (const char* s)
+{
+    return *s;
+}
+
+static int bump (int x)
+{
+    /* The parameter is changed, so it must not alias the argument */
+    x += 3;
+    return x;
+}
+
+static int getglob (void)
+{
+    return glob;
+}
+
+static int addglob (int x)
+{
+    return x + getglob ();
+}
+
+static unsigned fact (unsigned n)
+{
+    return n? n * fact (n - 1) : 1;
+}
+
+static unsigned note (unsigned v)
+{
+    order[pos++] = v;
+    return v;
+}
+
+static unsigned sub (unsigned a, unsigned b)
+{
+    return a - b;
+}
+
+static int (*fp) (int) = twice;
+
+static int shadow (void)
+{
+    /* A local named like a global used by getglob must not be seen by it */
+    int glob = 1;
+    return getglob () + glob;
+}
+
+int main (void)
+{
+    int i;
+    int k = 7;
+    register int r = 5;
+    unsigned u;
+
+    for (i = 0; i < 10; ++i) {
+        inc ();
+    }
+    addcnt (5);
+    addcnt (cnt);
+    if (cnt != 30) { printf ("cnt %u\n", cnt); ++failures; }
+
+    if (twice (21) != 42) { printf ("twice const\n"); ++failures; }
+    if (twice (k) != 14) { printf ("twice local\n"); ++failures; }
+    if (twice (r) != 10) { printf ("twice register\n"); ++failures; }
+    if (twice (twice (k) + 1) != 30) { printf ("twice nested\n"); ++failures; }
+    if (fp (4) != 8) { printf ("fp\n"); ++failures; }
+
+    if (low (0x1234) != 0x34) { printf ("low\n"); ++failures; }
+    if (lmul (1000, 1000) != 1000000L) { printf ("lmul\n"); ++failures; }
+    if (first ("abc") != 'a') { printf ("first\n"); ++failures; }
+
+    if (bump (k) != 10 || k != 7) { printf ("bump %d\n", k); ++failures; }
+    if (bump (r) != 8 || r != 5) { printf ("bump register %d\n", r); ++failures; }
+
+    if (addglob (k) != 107) { printf ("addglob\n"); ++failures; }
+    if (shadow () != 101) { printf ("shadow %d\n", shadow ()); ++failures; }
+    if (fact (6) != 720) { printf ("fact %u\n", fact (6)); ++failures; }
+
+    u = sub (note (10), note (3));
+    if (u != 7) { printf ("sub %u\n", u); ++failures; }
+    if (pos != 2) { printf ("pos %u\n", pos); ++failures; }
+    if (order[0] + order[1] != 13) { printf ("order\n"); ++failures; }
+
+    printf ("failures: %u\n", failures);
+    return failures;
+}
@@ -0,0 +1,227 @@
+/*
+  !!DESCRIPTION!! Loops with byte sized counters kept in index registers
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+*/
+
+#include <stdio.h>
+#include <string.h>
+
+static unsigned failures;
+
+static unsigned char a[256], b[256];
+static unsigned char calls;
+
+static void touch (void)
+{
+    ++calls;
+}
+
+static void check (const char* name, unsigned got, unsigned expected)
+{
+    if (got != expected) {
+        printf ("%s: %u, expected %u\n", name, got, expected);
+        ++failures;
+    }
+}
+
+static void copy (void)
+{
+    register unsigned char i;
+    for (i = 0; i < 100; ++i) {
+        a[i] = b[i];
+    }
+}
+
+static void fill (unsigned char v)
+{
+    static unsigned char i;
+    for (i = 10; i != 60; ++i) {
+        a[i] = v;
+    }
+    /* The counter is a static and must have its final value */
+    check ("fill i", i, 60);
+}
+
+static unsigned sum (void)
+{
+    register unsigned char i;
+    register unsigned s = 0;
+    for (i = 0; i < 200; ++i) {
+        s += a[i];
+    }
+    return s;
+}
+
+static unsigned char count (unsigned char start, unsigned char end)
+{
+    register unsigned char i;
+    unsigned char n = 0;
+    for (i = start; i < end; ++i) {
+        ++n;
+    }
+    return n;
+}
+
+static void repeat (void)
+{
+    register unsigned char i;
+    for (i = 0; i < 10; ++i) {
+        touch ();
+    }
+    for (i = 5; i < 5; ++i) {
+        touch ();
+    }
+    for (i = 0; i != 0; ++i) {
+        touch ();
+    }
+}
+
+static unsigned char find (unsigned char c)
+{
+    register unsigned char i;
+    for (i = 0; i < 100; ++i) {
+        if (a[i] == c) {
+            break;
+        }
+    }
+    return i;
+}
+
+static unsigned char skip (void)
+{
+    register unsigned char i;
+    unsigned char n = 0;
+    for (i = 0; i < 50; ++i) {
+        if (i & 1) {
+            continue;
+        }
+        a[i] = i;
+        ++n;
+    }
+    return n;
+}
+
+static unsigned nested (void)
+{
+    register unsigned char i, j;
+    unsigned n = 0;
+    for (i = 0; i < 10; ++i) {
+        for (j = 0; j < 20; ++j) {
+            a[j] = i;
+            ++n;
+        }
+    }
+    return n + a[19];
+}
+
+static unsigned char negstart (signed char n)
+{
+    /* The increment ends with a sign extension */
+    signed char i;
+    unsigned char k = 0;
+    for (i = -5; i < n; ++i) {
+        a[i + 5] = i;
+        ++k;
+    }
+    return k;
+}
+
+static unsigned char regneg (signed char n)
+{
+    register signed char i;
+    unsigned char k = 0;
+    for (i = -5; i < n; ++i) {
+        a[i + 5] = i;
+        ++k;
+    }
+    return k;
+}
+
+static unsigned char staticneg (signed char n)
+{
+    static signed char i;
+    unsigned char k = 0;
+    for (i = -100; i < n; i += 3) {
+        ++k;
+    }
+    return k;
+}
+
+static unsigned char downneg (void)
+{
+    register signed char i;
+    unsigned char k = 0;
+    for (i = 5; i >= -3; --i) {
+        ++k;
+    }
+    return k;
+}
+
+static unsigned char signedwrap (void)
+{
+    register signed char i;
+    unsigned char k = 0;
+    for (i = 120; i > 0; ++i) {
+        ++k;
+    }
+    return k;
+}
+
+static void reverse (void)
+{
+    register unsigned char i;
+    i = 100;
+    while (i) {
+        --i;
+        b[i] = a[i];
+    }
+}
+
+int main (void)
+{
+    unsigned char i;
+
+    for (i = 0; i < 100; ++i) {
+        b[i] = i + 1;
+    }
+    copy ();
+    check ("copy", memcmp (a, b, 100), 0);
+    check ("sum", sum (), 5050);
+    check ("find", find (50), 49);
+    check ("find none", find (0), 100);
+
+    fill (7);
+    check ("fill", a[10] + a[59] + a[9] + a[60], 7 + 7 + 10 + 61);
+
+    check ("count 3 8", count (3, 8), 5);
+    check ("count 8 3", count (8, 3), 0);
+    check ("count 0 255", count (0, 255), 255);
+
+    repeat ();
+    check ("calls", calls, 10);
+
+    check ("skip", skip (), 25);
+    check ("skip a", a[48] + a[49], 48 + 7);
+
+    check ("nested", nested (), 209);
+
+    check ("negstart", negstart (3), 8);
+    check ("negstart a", a[0] + a[7], 0xFB + 2);
+    check ("negstart none", negstart (-5), 0);
+    check ("negstart neg", negstart (-2), 3);
+    check ("regneg", regneg (3), 8);
+    check ("regneg none", regneg (-6), 0);
+    check ("regneg a", a[4], 0xFF);
+    check ("staticneg", staticneg (20), 40);
+    check ("staticneg none", staticneg (-100), 0);
+    check ("downneg", downneg (), 9);
+    check ("signedwrap", signedwrap (), 8);
+
+    memset (b, 0, sizeof (b));
+    reverse ();
+    check ("reverse", memcmp (a, b, 100), 0);
+
+    printf ("failures: %u\n", failures);
+    return failures;
+}
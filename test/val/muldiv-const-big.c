@@ -0,0 +1,10 @@
+/*
+  !!DESCRIPTION!! Multiplication and division by constants with long inline sequences
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+*/
+
+/* Allow the largest inline sequences, so they are tested, too */
+#pragma codesize (1000)
+
+#include "muldiv-const.c"
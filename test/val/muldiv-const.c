@@ -0,0 +1,160 @@
+/*
+  !!DESCRIPTION!! Multiplication and division by constants
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+*/
+
+#include <stdio.h>
+
+static unsigned failures;
+
+static const unsigned char v8[] = {
+    0, 1, 2, 3, 7, 9, 10, 11, 99, 100, 127, 128, 199, 200, 254, 255
+};
+
+static const unsigned v16[] = {
+    0, 1, 3, 9, 10, 99, 100, 255, 256, 999, 1000, 4095, 9999, 12345,
+    32767, 32768U, 43690U, 54321U, 65534U, 65535U
+};
+
+static const unsigned long v32[] = {
+    0, 1, 9, 10, 255, 65535UL, 65536UL, 999999UL, 1000000UL, 86399UL, 86400UL,
+    0x12345678UL, 0x7FFFFFFFUL, 0x80000000UL, 0xAAAAAAAAUL, 0xFFFFFFFEUL,
+    0xFFFFFFFFUL
+};
+
+#define N(a)    (sizeof (a) / sizeof (a[0]))
+
+static void fail (const char* op, unsigned long c, unsigned long x)
+{
+    printf ("%s %lu x=%lu\n", op, c, x);
+    ++failures;
+}
+
+#define TEST8(c) do {                                                   \
+    volatile unsigned char d = c;                                       \
+    unsigned char r = x;                                                \
+    if ((unsigned char) (x * c) != (unsigned char) (x * d)) {           \
+        fail ("mul8", c, x);                                            \
+    }                                                                   \
+    if (x / c != x / d) {                                               \
+        fail ("div8", c, x);                                            \
+    }                                                                   \
+    if (x % c != x % d) {                                               \
+        fail ("mod8", c, x);                                            \
+    }                                                                   \
+    r *= c;                                                             \
+    if (r != (unsigned char) (x * d)) {                                 \
+        fail ("mul8=", c, x);                                           \
+    }                                                                   \
+    r = x;                                                              \
+    r /= c;                                                             \
+    if (r != x / d) {                                                   \
+        fail ("div8=", c, x);                                           \
+    }                                                                   \
+    r = x;                                                              \
+    r %= c;                                                             \
+    if (r != x % d) {                                                   \
+        fail ("mod8=", c, x);                                           \
+    }                                                                   \
+} while (0)
+
+#define TEST16(c) do {                                                  \
+    volatile unsigned d = c;                                            \
+    if (x * c##U != x * d) {                                            \
+        fail ("mul16", c, x);                                           \
+    }                                                                   \
+    if (x / c##U != x / d) {                                            \
+        fail ("div16", c, x);                                           \
+    }                                                                   \
+    if (x % c##U != x % d) {                                            \
+        fail ("mod16", c, x);                                           \
+    }                                                                   \
+    if ((int) x * -c != (int) x * -(int) d) {                           \
+        fail ("muls16", c, x);                                          \
+    }                                                                   \
+} while (0)
+
+#define TEST32(c) do {                                                  \
+    volatile unsigned long d = c;                                       \
+    if (x * c##UL != x * d) {                                           \
+        fail ("mul32", c, x);                                           \
+    }                                                                   \
+    if (x / c##UL != x / d) {                                           \
+        fail ("div32", c, x);                                           \
+    }                                                                   \
+    if (x % c##UL != x % d) {                                           \
+        fail ("mod32", c, x);                                           \
+    }                                                                   \
+    if ((long) x * -c##L != (long) x * -(long) d) {                     \
+        fail ("muls32", c, x);                                          \
+    }                                                                   \
+} while (0)
+
+static void test8 (void)
+{
+    unsigned char i;
+    for (i = 0; i < N (v8); ++i) {
+        unsigned char x = v8[i];
+        TEST8 (3);
+        TEST8 (5);
+        TEST8 (6);
+        TEST8 (7);
+        TEST8 (10);
+        TEST8 (13);
+        TEST8 (25);
+        TEST8 (100);
+        TEST8 (129);
+        TEST8 (200);
+        TEST8 (255);
+    }
+}
+
+static void test16 (void)
+{
+    unsigned char i;
+    for (i = 0; i < N (v16); ++i) {
+        unsigned x = v16[i];
+        TEST16 (3);
+        TEST16 (7);
+        TEST16 (10);
+        TEST16 (11);
+        TEST16 (12);
+        TEST16 (60);
+        TEST16 (100);
+        TEST16 (255);
+        TEST16 (257);
+        TEST16 (641);
+        TEST16 (1000);
+        TEST16 (3600);
+        TEST16 (10000);
+        TEST16 (12345);
+        TEST16 (32767);
+        TEST16 (30000);
+    }
+}
+
+static void test32 (void)
+{
+    unsigned char i;
+    for (i = 0; i < N (v32); ++i) {
+        unsigned long x = v32[i];
+        TEST32 (3);
+        TEST32 (10);
+        TEST32 (60);
+        TEST32 (1000);
+        TEST32 (3600);
+        TEST32 (86400);
+        TEST32 (1000000);
+        TEST32 (0x12345679);
+    }
+}
+
+int main (void)
+{
+    test8 ();
+    test16 ();
+    test32 ();
+    printf ("failures: %u\n", failures);
+    return failures;
+}
@@ -0,0 +1,49 @@
+/* preprocessor test #6 - arguments used more than once, plain text macros */
+
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+#define EMPTY
+#define ONE     1
+#define TEXT    "a  b"   "  c"
+#define MAX(a,b)        ((a) > (b) ? (a) : (b))
+#define MAX4(a,b,c,d)   MAX (MAX (a, b), MAX (c, d))
+#define STR(x)          #x
+#define XSTR(x)         STR (x)
+#define TWICE(x)        x EMPTY x
+#define CAT(a,b)        a ## b
+
+int m = MAX4 (MAX4 (1, 2, 3, ONE), 4, MAX (ONE, 7), 5);
+const char* s = TEXT;
+const char* t = XSTR (TWICE (ONE));
+const char* u = STR (TEXT);
+int CAT (v, ONE) = CAT (1, 2) + TWICE (+ONE);
+
+int main(void)
+{
+    int failures = 0;
+
+    if (m != 7) {
+        printf ("m: %d expect: 7\n", m);
+        ++failures;
+    }
+    if (strcmp (s, "a  b  c") != 0) {
+        printf ("s: '%s' expect: 'a  b  c'\n", s);
+        ++failures;
+    }
+    if (strcmp (t, "1 1") != 0) {
+        printf ("t: '%s' expect: '1 1'\n", t);
+        ++failures;
+    }
+    if (strcmp (u, "TEXT") != 0) {
+        printf ("u: '%s' expect: 'TEXT'\n", u);
+        ++failures;
+    }
+    if (vONE != 14) {
+        printf ("vONE: %d expect: 14\n", vONE);
+        ++failures;
+    }
+    printf ("failures: %d\n", failures);
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,143 @@
+/*
+  !!DESCRIPTION!! Often used locals placed into the register bank
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+*/
+
+#include <stdio.h>
+
+#pragma auto-register-vars (on)
+
+static unsigned failures;
+
+static unsigned char buf[100];
+
+static unsigned sum (const unsigned char* p, unsigned n)
+{
+    unsigned s = 0;
+    unsigned i;
+    for (i = 0; i < n; ++i) {
+        s += p[i];
+    }
+    return s;
+}
+
+static int addr (int x)
+{
+    int y = x;
+    int* p = &y;
+    int i;
+    for (i = 0; i < 3; ++i) {
+        *p += i;
+    }
+    return y;
+}
+
+static long lsum (int n)
+{
+    long acc = 0;
+    char c;
+    int k;
+    for (k = 0; k < n; ++k) {
+        for (c = 0; c < 3; ++c) {
+            acc += k;
+        }
+    }
+    return acc;
+}
+
+static int fib (int n)
+{
+    int a = 0, b = 1, t;
+    if (n < 2) {
+        return n;
+    }
+    while (--n) {
+        t = a + b;
+        a = b;
+        b = t;
+    }
+    return b + fib (0);
+}
+
+static unsigned many (unsigned n)
+{
+    /* More candidates than the register bank can hold */
+    unsigned a = 1, b = 2, c = 3, d = 4, e = 5;
+    unsigned i;
+    for (i = 0; i < n; ++i) {
+        a += b;
+        b += c;
+        c += d;
+        d += e;
+        e += i;
+    }
+    return a ^ b ^ c ^ d ^ e;
+}
+
+static unsigned rec (unsigned n)
+{
+    /* The caller's registers must survive the recursive call */
+    unsigned i;
+    unsigned s = 0;
+    if (n == 0) {
+        return 0;
+    }
+    for (i = 0; i < n; ++i) {
+        s += i;
+    }
+    return s + rec (n - 1) + s;
+}
+
+static int withgoto (int n)
+{
+    int i = 0;
+    int s = 0;
+again:
+    s += i;
+    if (++i < n) {
+        goto again;
+    }
+    return s;
+}
+
+static int shadow (int n)
+{
+    /* The inner declarations of i must be counted separately from the
+    ** outer one, and the outer value must survive the inner blocks.
+    */
+    int i = n;
+    int* p = &i;
+    int s = 0;
+    {
+        int i;
+        for (i = 0; i < n; ++i) {
+            s += i;
+        }
+    }
+    {
+        unsigned char i;
+        for (i = 0; i < 4; ++i) {
+            s += i;
+        }
+    }
+    return s + *p + i;
+}
+
+int main (void)
+{
+    unsigned i;
+    for (i = 0; i < sizeof (buf); ++i) {
+        buf[i] = i;
+    }
+    if (sum (buf, 100) != 4950) { printf ("sum %u\n", sum (buf, 100)); ++failures; }
+    if (addr (5) != 8) { printf ("addr %d\n", addr (5)); ++failures; }
+    if (lsum (10) != 135) { printf ("lsum %ld\n", lsum (10)); ++failures; }
+    if (fib (20) != 6765) { printf ("fib %d\n", fib (20)); ++failures; }
+    if (many (10) != 514) { printf ("many %u\n", many (10)); ++failures; }
+    if (rec (10) != 330) { printf ("rec %u\n", rec (10)); ++failures; }
+    if (withgoto (10) != 45) { printf ("withgoto %d\n", withgoto (10)); ++failures; }
+    if (shadow (10) != 71) { printf ("shadow %d\n", shadow (10)); ++failures; }
+    printf ("failures: %u\n", failures);
+    return failures;
+}
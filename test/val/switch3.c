@@ -0,0 +1,135 @@
+/*
+  !!DESCRIPTION!! Switch statements with case ranges and binary search
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+*/
+
+#include <stdio.h>
+
+static unsigned failures;
+
+static int f1 (unsigned char c)
+{
+    switch (c) {
+        case 0: case 1: case 2: case 3: return 1;
+        case 5: return 2;
+        case 7: case 8: return 3;
+        case 10: return 4;
+        case 20: case 21: case 22: case 23: case 24: return 5;
+        case 30: return 6;
+        case 40: return 7;
+        case 50: return 8;
+        case 60: return 9;
+        case 250: case 251: case 252: case 253: case 254: case 255: return 10;
+        default: return 0;
+    }
+}
+
+static int r1 (unsigned char c)
+{
+    if (c <= 3) return 1;
+    if (c == 5) return 2;
+    if (c == 7 || c == 8) return 3;
+    if (c == 10) return 4;
+    if (c >= 20 && c <= 24) return 5;
+    if (c == 30) return 6;
+    if (c == 40) return 7;
+    if (c == 50) return 8;
+    if (c == 60) return 9;
+    if (c >= 250) return 10;
+    return 0;
+}
+
+static int f2 (int i)
+{
+    switch (i) {
+        case -300: return 1;
+        case -2: case -1: case 0: case 1: return 2;
+        case 100: return 3;
+        case 256: case 257: case 258: return 4;
+        case 511: case 512: return 5;
+        case 1000: return 6;
+        case 0x7FFF: return 7;
+        case 200: return 8;
+        case 201: return 9;
+        case 202: return 10;
+        case 203: return 11;
+    }
+    return 0;
+}
+
+static int r2 (int i)
+{
+    if (i == -300) return 1;
+    if (i >= -2 && i <= 1) return 2;
+    if (i == 100) return 3;
+    if (i >= 256 && i <= 258) return 4;
+    if (i == 511 || i == 512) return 5;
+    if (i == 1000) return 6;
+    if (i == 0x7FFF) return 7;
+    if (i >= 200 && i <= 203) return i - 192;
+    return 0;
+}
+
+static int f3 (long l)
+{
+    switch (l) {
+        case 0x10000L: case 0x10001L: return 1;
+        case -1L: return 2;
+        case 0x12345678L: return 3;
+        case 5: case 6: case 7: return 4;
+        case 0x7F000000L: return 5;
+        default: return 0;
+    }
+}
+
+static int r3 (long l)
+{
+    if (l == 0x10000L || l == 0x10001L) return 1;
+    if (l == -1L) return 2;
+    if (l == 0x12345678L) return 3;
+    if (l >= 5 && l <= 7) return 4;
+    if (l == 0x7F000000L) return 5;
+    return 0;
+}
+
+static int f4 (signed char c)
+{
+    switch (c) {
+        case -128: case -127: return 1;
+        case -1: case 0: return 2;
+        case 126: case 127: return 3;
+        case 10: return 4;
+        case 12: case 13: return 5;
+    }
+    return 0;
+}
+
+static int r4 (signed char c)
+{
+    if (c == -128 || c == -127) return 1;
+    if (c == -1 || c == 0) return 2;
+    if (c == 126 || c == 127) return 3;
+    if (c == 10) return 4;
+    if (c == 12 || c == 13) return 5;
+    return 0;
+}
+
+int main (void)
+{
+    long i;
+    static const long l[] = { 0x10000L, 0x10001L, 0x10002L, 0xFFFFL, -1L, -2L, 0x12345678L,
+                              0x12345679L, 4, 5, 6, 7, 8, 0x7F000000L, 0x7F000001L, 0 };
+    for (i = 0; i < 256; ++i) {
+        if (f1 (i) != r1 (i)) { printf ("f1 %d\n", (int) i); ++failures; }
+        if (f4 (i) != r4 (i)) { printf ("f4 %d\n", (int) i); ++failures; }
+    }
+    for (i = -32768L; i < 32768L; i += 1) {
+        if (f2 (i) != r2 (i)) { printf ("f2 %ld\n", i); ++failures; }
+    }
+    for (i = 0; i < sizeof (l) / sizeof (l[0]); ++i) {
+        if (f3 (l[i]) != r3 (l[i])) { printf ("f3 %lx\n", l[i]); ++failures; }
+    }
+    printf ("failures: %u\n", failures);
+    return failures;
+}
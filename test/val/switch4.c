@@ -0,0 +1,194 @@
+/*
+  !!DESCRIPTION!! Large sparse switch statements with long case bodies
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+*/
+
+#include <stdio.h>
+
+static unsigned failures;
+
+static int g;
+
+/* The case values, sorted. The case with index I adds I + 1. */
+static const int values[] = {
+    -22040, -22039, -22038, -22035, -22034, -22032, -22030, -22028,
+    -9206, -9205, -9203, -9200, -9198, -9197, -9196, -9194,
+    6586, 6587, 6589, 6592, 6593, 6594, 6597, 6599,
+    26631, 26632, 26637, 26640, 26641, 26642, 26643, 26644,
+    32127, 32128, 32129, 32131, 32133, 32135, 32137, 32138
+};
+
+#define N (sizeof (values) / sizeof (values[0]))
+
+/* Each case body is long enough that the compares of the binary search
+** are spread over more than a short branch can reach.
+*/
+#define STEP(k)                                                         \
+    r += k;                                                             \
+    r ^= x;                                                             \
+    if (r & 1) {                                                        \
+        r = r * 3 + k;                                                  \
+    } else {                                                            \
+        r -= g;                                                         \
+    }                                                                   \
+    g += r;                                                             \
+    break
+
+static int step (int r, int x, int k)
+{
+    r += k;
+    r ^= x;
+    if (r & 1) {
+        r = r * 3 + k;
+    } else {
+        r -= g;
+    }
+    g += r;
+    return r;
+}
+
+static int ref (int x)
+{
+    unsigned char i;
+    for (i = 0; i < N; ++i) {
+        if (values[i] == x) {
+            return step (g, x, i + 1);
+        }
+    }
+    return -1;
+}
+
+static int sw1 (int x)
+{
+    register int r = g;
+    switch (x) {
+        case -22040: STEP (1);
+        case -22039: STEP (2);
+        case -22038: STEP (3);
+        case -22035: STEP (4);
+        case -22034: STEP (5);
+        case -22032: STEP (6);
+        case -22030: STEP (7);
+        case -22028: STEP (8);
+        case -9206: STEP (9);
+        case -9205: STEP (10);
+        case -9203: STEP (11);
+        case -9200: STEP (12);
+        case -9198: STEP (13);
+        case -9197: STEP (14);
+        case -9196: STEP (15);
+        case -9194: STEP (16);
+        case 6586: STEP (17);
+        case 6587: STEP (18);
+        case 6589: STEP (19);
+        case 6592: STEP (20);
+        case 6593: STEP (21);
+        case 6594: STEP (22);
+        case 6597: STEP (23);
+        case 6599: STEP (24);
+        case 26631: STEP (25);
+        case 26632: STEP (26);
+        case 26637: STEP (27);
+        case 26640: STEP (28);
+        case 26641: STEP (29);
+        case 26642: STEP (30);
+        case 26643: STEP (31);
+        case 26644: STEP (32);
+        case 32127: STEP (33);
+        case 32128: STEP (34);
+        case 32129: STEP (35);
+        case 32131: STEP (36);
+        case 32133: STEP (37);
+        case 32135: STEP (38);
+        case 32137: STEP (39);
+        case 32138: STEP (40);
+        default: r = -1; break;
+    }
+    return r;
+}
+
+/* Same without "register", so the variable may be placed automatically */
+static int sw2 (int x)
+{
+    int r = g;
+    switch (x) {
+        case -22040: STEP (1);
+        case -22039: STEP (2);
+        case -22038: STEP (3);
+        case -22035: STEP (4);
+        case -22034: STEP (5);
+        case -22032: STEP (6);
+        case -22030: STEP (7);
+        case -22028: STEP (8);
+        case -9206: STEP (9);
+        case -9205: STEP (10);
+        case -9203: STEP (11);
+        case -9200: STEP (12);
+        case -9198: STEP (13);
+        case -9197: STEP (14);
+        case -9196: STEP (15);
+        case -9194: STEP (16);
+        case 6586: STEP (17);
+        case 6587: STEP (18);
+        case 6589: STEP (19);
+        case 6592: STEP (20);
+        case 6593: STEP (21);
+        case 6594: STEP (22);
+        case 6597: STEP (23);
+        case 6599: STEP (24);
+        case 26631: STEP (25);
+        case 26632: STEP (26);
+        case 26637: STEP (27);
+        case 26640: STEP (28);
+        case 26641: STEP (29);
+        case 26642: STEP (30);
+        case 26643: STEP (31);
+        case 26644: STEP (32);
+        case 32127: STEP (33);
+        case 32128: STEP (34);
+        case 32129: STEP (35);
+        case 32131: STEP (36);
+        case 32133: STEP (37);
+        case 32135: STEP (38);
+        case 32137: STEP (39);
+        case 32138: STEP (40);
+        default: r = -1; break;
+    }
+    return r;
+}
+
+static void check (const char* name, int (*f) (int), int x)
+{
+    int start = g;
+    int expected = ref (x);
+    int got;
+
+    g = start;
+    got = f (x);
+    if (got != expected) {
+        printf ("%s (%d): %d, expected %d\n", name, x, got, expected);
+        ++failures;
+    }
+}
+
+int main (void)
+{
+    unsigned char i;
+    signed char d;
+
+    for (i = 0; i < N; ++i) {
+        for (d = -1; d <= 1; ++d) {
+            g = i * 17;
+            check ("sw1", sw1, values[i] + d);
+            g = i * 23;
+            check ("sw2", sw2, values[i] + d);
+        }
+    }
+    check ("sw1", sw1, -32767 - 1);
+    check ("sw1", sw1, 32767);
+    check ("sw2", sw2, 0);
+
+    printf ("failures: %u\n", failures);
+    return failures;
+}
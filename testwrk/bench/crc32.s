@@ -0,0 +1,328 @@
+;
+; File generated by cc65 v 2.19 - Git 0ea9c6d
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 0ea9c6d"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$63,$72,$63,$20,$25,$30,$38,$6C,$58,$0A,$00
+
+.segment	"BSS"
+
+_table:
+	.res	1024,$00
+_buf:
+	.res	2048,$00
+
+; ---------------------------------------------------------------
+; void __near__ maketable (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_maketable: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	lda     regbank+5
+	jsr     pusha
+	jsr     decsp4
+	ldy     #$03
+	ldx     #$04
+L0002:	lda     regbank+0,x
+	sta     (sp),y
+	dey
+	dex
+	bne     L0002
+	ldy     #$05
+	txa
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L0010
+L0006:	iny
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$00
+	sta     regbank+1
+	stx     regbank+1+1
+	sty     regbank+1+2
+	sty     regbank+1+3
+	sty     regbank+5
+	jmp     L000F
+L000A:	lda     regbank+1
+	ldx     #$00
+	stx     sreg+1
+	stx     sreg
+	and     #$01
+	jsr     utsteax
+	beq     L000B
+	lda     regbank+1+3
+	sta     sreg+1
+	lda     regbank+1+2
+	sta     sreg
+	ldx     regbank+1+1
+	lda     regbank+1
+	jsr     shreax1
+	jsr     pusheax
+	ldx     #$83
+	lda     #$B8
+	sta     sreg
+	lda     #$ED
+	sta     sreg+1
+	lda     #$20
+	jsr     tosxoreax
+	jmp     L0015
+L000B:	lda     regbank+1+3
+	sta     sreg+1
+	lda     regbank+1+2
+	sta     sreg
+	ldx     regbank+1+1
+	lda     regbank+1
+	jsr     shreax1
+L0015:	sta     regbank+1
+	stx     regbank+1+1
+	ldy     sreg
+	sty     regbank+1+2
+	ldy     sreg+1
+	sty     regbank+1+3
+	inc     regbank+5
+L000F:	lda     regbank+5
+	cmp     #$08
+	bcc     L000A
+	ldy     #$06
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     aslax2
+	clc
+	adc     #<(_table)
+	tay
+	txa
+	adc     #>(_table)
+	tax
+	tya
+	jsr     pushax
+	lda     regbank+1+3
+	sta     sreg+1
+	lda     regbank+1+2
+	sta     sreg
+	ldx     regbank+1+1
+	lda     regbank+1
+	ldy     #$00
+	jsr     steaxspidx
+	ldy     #$05
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$06
+L0010:	lda     (sp),y
+	tax
+	dey
+	cpx     #$01
+	jcc     L0006
+	ldy     #$00
+L000D:	lda     (sp),y
+	sta     regbank+1,y
+	iny
+	cpy     #$05
+	bne     L000D
+	jmp     incsp7
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned long __near__ crc32 (const unsigned char *p, unsigned int len)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_crc32: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp4
+	ldy     #$03
+	ldx     #$04
+L0002:	lda     regbank+1,x
+	sta     (sp),y
+	dey
+	dex
+	bne     L0002
+	lda     #$FF
+	sta     regbank+2
+	sta     regbank+2+1
+	sta     regbank+2+2
+	sta     regbank+2+3
+	jmp     L0005
+L0003:	ldy     #$07
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$00
+	lda     (ptr1),y
+	eor     regbank+2
+	ldx     #$00
+	jsr     aslax2
+	clc
+	adc     #<(_table)
+	tay
+	txa
+	adc     #>(_table)
+	tax
+	tya
+	jsr     ldeaxi
+	jsr     pusheax
+	lda     regbank+2+3
+	sta     sreg+1
+	lda     regbank+2+2
+	sta     sreg
+	lda     regbank+2+1
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	ldy     #$00
+	sty     sreg+1
+	jsr     tosxoreax
+	sta     regbank+2
+	stx     regbank+2+1
+	ldy     sreg
+	sty     regbank+2+2
+	ldy     sreg+1
+	sty     regbank+2+3
+	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L0005:	ldy     #$05
+	lda     (sp),y
+	sta     tmp1
+	dey
+	lda     (sp),y
+	ora     tmp1
+	php
+	ldx     #$00
+	lda     #$01
+	jsr     subeqysp
+	plp
+	bne     L0003
+	lda     regbank+2+3
+	sta     sreg+1
+	lda     regbank+2+2
+	sta     sreg
+	ldx     regbank+2+1
+	lda     regbank+2
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	txa
+	jsr     tosxoreax
+	pha
+	ldy     #$00
+L0006:	lda     (sp),y
+	sta     regbank+2,y
+	iny
+	cpy     #$04
+	bne     L0006
+	pla
+	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	jsr     decsp4
+	jsr     _maketable
+	lda     #$00
+	sta     regbank+4
+	sta     regbank+4+1
+	jmp     L0002
+L0005:	lda     #<(_buf)
+	clc
+	adc     regbank+4
+	tay
+	lda     #>(_buf)
+	adc     regbank+4+1
+	tax
+	tya
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     mulax7
+	clc
+	adc     regbank+5
+	ldy     #$00
+	jsr     staspidx
+	inc     regbank+4
+	bne     L0002
+	inc     regbank+4+1
+L0002:	ldx     regbank+4+1
+	cpx     #$08
+	bcc     L0005
+	lda     #<(_buf)
+	ldx     #>(_buf)
+	jsr     pushax
+	ldx     #$08
+	lda     #$00
+	jsr     _crc32
+	jsr     steax0sp
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+	jsr     ldeax0sp
+	jsr     pusheax
+	ldx     #$B6
+	lda     #$70
+	sta     sreg
+	lda     #$38
+	sta     sreg+1
+	lda     #$57
+	jsr     tosneeax
+	pha
+	ldy     #$04
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	pla
+	jmp     incsp6
+
+.endproc
+
@@ -0,0 +1,224 @@
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+typedef int ptrdiff_t;
+typedef char wchar_t;
+typedef unsigned size_t;
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+typedef unsigned char* va_list;
+ 
+ 
+typedef struct _FILE FILE;
+typedef unsigned long fpos_t;
+ 
+extern FILE* stdin;
+extern FILE* stdout;
+extern FILE* stderr;
+ 
+ 
+ 
+ 
+ 
+ 
+void __fastcall__ clearerr (FILE* f);
+int __fastcall__ fclose (FILE* f);
+int __fastcall__ feof (FILE* f);
+int __fastcall__ ferror (FILE* f);
+int __fastcall__ fflush (FILE* f);
+int __fastcall__ fgetc (FILE* f);
+char* __fastcall__ fgets (char* buf, size_t size, FILE* f);
+FILE* __fastcall__ fopen (const char* name, const char* mode);
+int fprintf (FILE* f, const char* format, ...);
+int __fastcall__ fputc (int c, FILE* f);
+int __fastcall__ fputs (const char* s, FILE* f);
+size_t __fastcall__ fread (void* buf, size_t size, size_t count, FILE* f);
+FILE* __fastcall__ freopen (const char* name, const char* mode, FILE* f);
+size_t __fastcall__ fwrite (const void* buf, size_t size, size_t count, FILE* f);
+int __fastcall__ fgetpos (FILE* f, fpos_t *pos);
+int __fastcall__ fsetpos (FILE* f, const fpos_t* pos);
+long __fastcall__ ftell (FILE* f);
+int __fastcall__ fseek (FILE* f, long offset, int whence);
+void __fastcall__ rewind (FILE *f);
+int getchar (void);
+char* __fastcall__ gets (char* s);
+void __fastcall__ perror (const char* s);
+int printf (const char* format, ...);
+int __fastcall__ putchar (int c);
+int __fastcall__ puts (const char* s);
+int __fastcall__ remove (const char* name);
+int __fastcall__ rename (const char* oldname, const char* newname);
+int snprintf (char* buf, size_t size, const char* format, ...);
+int sprintf (char* buf, const char* format, ...);
+int __fastcall__ ungetc (int c, FILE* f);
+int __fastcall__ vfprintf (FILE* f, const char* format, va_list ap);
+int __fastcall__ vprintf (const char* format, va_list ap);
+int __fastcall__ vsnprintf (char* buf, size_t size, const char* format, va_list ap);
+int __fastcall__ vsprintf (char* buf, const char* format, va_list ap);
+int scanf (const char* format, ...);
+int fscanf (FILE* f, const char* format, ...);
+int sscanf (const char* s, const char* format, ...);
+int __fastcall__ vscanf (const char* format, va_list ap);
+int __fastcall__ vsscanf (const char* s, const char* format, va_list ap);
+int __fastcall__ vfscanf (FILE* f, const char* format, va_list ap);
+FILE* __fastcall__ fdopen (int fd, const char* mode); 
+int __fastcall__ fileno (FILE* f); 
+void __fastcall__ _poserror (const char* msg); 
+ 
+ 
+typedef struct node node;
+struct node {
+node* next;
+unsigned key;
+unsigned char tag;
+};
+static node nodes[200];
+static node* head;
+static void build (void)
+{
+unsigned i;
+head = 0;
+for (i = 0; i < 200; ++i) {
+nodes[i].key = (i * 37) % 200;
+nodes[i].tag = (unsigned char) i;
+nodes[i].next = head;
+head = &nodes[i];
+}
+}
+static node* find (unsigned key)
+{
+node* n;
+for (n = head; n; n = n->next) {
+if (n->key == key) {
+return n;
+}
+}
+return 0;
+}
+static void reverse (void)
+{
+node* prev = 0;
+node* n = head;
+node* next;
+while (n) {
+next = n->next;
+n->next = prev;
+prev = n;
+n = next;
+}
+head = prev;
+}
+int main (void)
+{
+unsigned char r;
+unsigned i;
+unsigned long sum = 0;
+build ();
+for (r = 0; r < 10; ++r) {
+reverse ();
+for (i = 0; i < 200; i += 7) {
+node* n = find (i);
+if (n) {
+sum += n->tag;
+}
+}
+}
+printf ("sum %lu\n", sum);
+return sum != 24660UL;
+}
@@ -0,0 +1,357 @@
+;
+; File generated by cc65 v 2.19 - Git 0ea9c6d
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 0ea9c6d"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$73,$75,$6D,$20,$25,$6C,$75,$0A,$00
+
+.segment	"BSS"
+
+_nodes:
+	.res	1000,$00
+_head:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; void __near__ build (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_build: near
+
+.segment	"CODE"
+
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	lda     #$00
+	sta     _head
+	sta     _head+1
+	sta     regbank+4
+	sta     regbank+4+1
+	jmp     L0002
+L0005:	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     mulax5
+	clc
+	adc     #<(_nodes)
+	tay
+	txa
+	adc     #>(_nodes)
+	tax
+	tya
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	lda     #$25
+	jsr     tosumula0
+	jsr     pushax
+	lda     #$C8
+	jsr     tosumoda0
+	ldy     #$02
+	jsr     staxspidx
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     mulax5
+	clc
+	adc     #<(_nodes)
+	sta     ptr1
+	txa
+	adc     #>(_nodes)
+	sta     ptr1+1
+	lda     regbank+4
+	ldy     #$04
+	sta     (ptr1),y
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     mulax5
+	clc
+	adc     #<(_nodes)
+	sta     ptr1
+	txa
+	adc     #>(_nodes)
+	sta     ptr1+1
+	lda     _head
+	ldy     #$00
+	sta     (ptr1),y
+	iny
+	lda     _head+1
+	sta     (ptr1),y
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     mulax5
+	clc
+	adc     #<(_nodes)
+	sta     _head
+	txa
+	adc     #>(_nodes)
+	sta     _head+1
+	inc     regbank+4
+	bne     L0002
+	inc     regbank+4+1
+L0002:	lda     regbank+4+1
+	cmp     #$00
+	bne     L0006
+	lda     regbank+4
+	cmp     #$C8
+L0006:	jcc     L0005
+	ldy     #$00
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; struct node *__near__ find (unsigned int key)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_find: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	lda     _head+1
+	sta     regbank+4+1
+	lda     _head
+	sta     regbank+4
+	jmp     L0002
+L0005:	ldy     #$03
+	lda     (regbank+4),y
+	tax
+	dey
+	lda     (regbank+4),y
+	cmp     (sp),y
+	bne     L0006
+	txa
+	iny
+	cmp     (sp),y
+	bne     L0006
+	lda     regbank+4
+	ldx     regbank+4+1
+	jmp     L0001
+L0006:	ldy     #$01
+	lda     (regbank+4),y
+	tax
+	dey
+	lda     (regbank+4),y
+	sta     regbank+4
+	stx     regbank+4+1
+L0002:	lda     regbank+4
+	ora     regbank+4+1
+	bne     L0005
+	tax
+L0001:	pha
+	ldy     #$00
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	pla
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ reverse (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_reverse: near
+
+.segment	"CODE"
+
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	lda     #$00
+	sta     regbank+4
+	sta     regbank+4+1
+	lda     regbank+2
+	ldx     regbank+3
+	jsr     pushax
+	lda     _head+1
+	sta     regbank+2+1
+	lda     _head
+	sta     regbank+2
+	lda     regbank+0
+	ldx     regbank+1
+	jsr     pushax
+	jmp     L0004
+L0002:	ldy     #$01
+	lda     (regbank+2),y
+	tax
+	dey
+	lda     (regbank+2),y
+	sta     regbank+0
+	stx     regbank+0+1
+	lda     regbank+4
+	sta     (regbank+2),y
+	iny
+	lda     regbank+4+1
+	sta     (regbank+2),y
+	lda     regbank+2+1
+	sta     regbank+4+1
+	lda     regbank+2
+	sta     regbank+4
+	lda     regbank+0+1
+	sta     regbank+2+1
+	lda     regbank+0
+	sta     regbank+2
+L0004:	lda     regbank+2
+	ora     regbank+2+1
+	bne     L0002
+	lda     regbank+4+1
+	sta     _head+1
+	lda     regbank+4
+	sta     _head
+	ldy     #$00
+L0005:	lda     (sp),y
+	sta     regbank+0,y
+	iny
+	cpy     #$06
+	bne     L0005
+	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp1
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	jsr     decsp4
+	ldy     #$03
+	ldx     #$04
+L0002:	lda     regbank-1,x
+	sta     (sp),y
+	dey
+	dex
+	bne     L0002
+	txa
+	sta     regbank+0
+	sta     regbank+0+1
+	sta     regbank+0+2
+	sta     regbank+0+3
+	jsr     _build
+	lda     #$00
+	ldy     #$06
+	jmp     L000F
+L0006:	jsr     _reverse
+	lda     #$00
+	sta     regbank+4
+	sta     regbank+4+1
+	jmp     L0007
+L000A:	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     _find
+	jsr     pushax
+	ldy     #$01
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L000D
+	iny
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$04
+	lda     (ptr1),y
+	ldy     #<(regbank+0)
+	sty     ptr1
+	ldy     #>(regbank+0)
+	jsr     laddeqa
+L000D:	jsr     incsp2
+	lda     #$07
+	clc
+	adc     regbank+4
+	sta     regbank+4
+	bcc     L0007
+	inc     regbank+4+1
+L0007:	lda     regbank+4+1
+	cmp     #$00
+	bne     L000B
+	lda     regbank+4
+	cmp     #$C8
+L000B:	bcc     L000A
+	ldy     #$06
+	clc
+	lda     #$01
+	adc     (sp),y
+L000F:	sta     (sp),y
+	cmp     #$0A
+	bcc     L0006
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     regbank+0+3
+	sta     sreg+1
+	lda     regbank+0+2
+	sta     sreg
+	ldx     regbank+0+1
+	lda     regbank+0
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+	lda     regbank+0+3
+	sta     sreg+1
+	lda     regbank+0+2
+	sta     sreg
+	ldx     regbank+0+1
+	lda     regbank+0
+	jsr     pusheax
+	ldx     #$60
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	lda     #$54
+	jsr     tosneeax
+	pha
+	ldy     #$00
+L000E:	lda     (sp),y
+	sta     regbank+0,y
+	iny
+	cpy     #$06
+	bne     L000E
+	pla
+	jmp     incsp7
+
+.endproc
+
@@ -0,0 +1,206 @@
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+typedef int ptrdiff_t;
+typedef char wchar_t;
+typedef unsigned size_t;
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+typedef unsigned char* va_list;
+ 
+ 
+typedef struct _FILE FILE;
+typedef unsigned long fpos_t;
+ 
+extern FILE* stdin;
+extern FILE* stdout;
+extern FILE* stderr;
+ 
+ 
+ 
+ 
+ 
+ 
+void __fastcall__ clearerr (FILE* f);
+int __fastcall__ fclose (FILE* f);
+int __fastcall__ feof (FILE* f);
+int __fastcall__ ferror (FILE* f);
+int __fastcall__ fflush (FILE* f);
+int __fastcall__ fgetc (FILE* f);
+char* __fastcall__ fgets (char* buf, size_t size, FILE* f);
+FILE* __fastcall__ fopen (const char* name, const char* mode);
+int fprintf (FILE* f, const char* format, ...);
+int __fastcall__ fputc (int c, FILE* f);
+int __fastcall__ fputs (const char* s, FILE* f);
+size_t __fastcall__ fread (void* buf, size_t size, size_t count, FILE* f);
+FILE* __fastcall__ freopen (const char* name, const char* mode, FILE* f);
+size_t __fastcall__ fwrite (const void* buf, size_t size, size_t count, FILE* f);
+int __fastcall__ fgetpos (FILE* f, fpos_t *pos);
+int __fastcall__ fsetpos (FILE* f, const fpos_t* pos);
+long __fastcall__ ftell (FILE* f);
+int __fastcall__ fseek (FILE* f, long offset, int whence);
+void __fastcall__ rewind (FILE *f);
+int getchar (void);
+char* __fastcall__ gets (char* s);
+void __fastcall__ perror (const char* s);
+int printf (const char* format, ...);
+int __fastcall__ putchar (int c);
+int __fastcall__ puts (const char* s);
+int __fastcall__ remove (const char* name);
+int __fastcall__ rename (const char* oldname, const char* newname);
+int snprintf (char* buf, size_t size, const char* format, ...);
+int sprintf (char* buf, const char* format, ...);
+int __fastcall__ ungetc (int c, FILE* f);
+int __fastcall__ vfprintf (FILE* f, const char* format, va_list ap);
+int __fastcall__ vprintf (const char* format, va_list ap);
+int __fastcall__ vsnprintf (char* buf, size_t size, const char* format, va_list ap);
+int __fastcall__ vsprintf (char* buf, const char* format, va_list ap);
+int scanf (const char* format, ...);
+int fscanf (FILE* f, const char* format, ...);
+int sscanf (const char* s, const char* format, ...);
+int __fastcall__ vscanf (const char* format, va_list ap);
+int __fastcall__ vsscanf (const char* s, const char* format, va_list ap);
+int __fastcall__ vfscanf (FILE* f, const char* format, va_list ap);
+FILE* __fastcall__ fdopen (int fd, const char* mode); 
+int __fastcall__ fileno (FILE* f); 
+void __fastcall__ _poserror (const char* msg); 
+ 
+ 
+static unsigned long gcd (unsigned long a, unsigned long b)
+{
+unsigned long t;
+while (b) {
+t = a % b;
+a = b;
+b = t;
+}
+return a;
+}
+static unsigned long isqrt (unsigned long n)
+{
+unsigned long r = 0;
+unsigned long bit = 1UL << 30;
+while (bit > n) {
+bit >>= 2;
+}
+while (bit) {
+if (n >= r + bit) {
+n -= r + bit;
+r = (r >> 1) + bit;
+} else {
+r >>= 1;
+}
+bit >>= 2;
+}
+return r;
+}
+int main (void)
+{
+unsigned char i;
+unsigned long a = 1, b = 1, t;
+unsigned long sum = 0;
+for (i = 0; i < 40; ++i) {
+t = a + b;
+a = b;
+b = t;
+sum += gcd (a * 3UL, b * 5UL) + isqrt (b);
+}
+printf ("sum %lu\n", sum);
+return sum != 76625UL;
+}
@@ -0,0 +1,340 @@
+;
+; File generated by cc65 v 2.19 - Git 0ea9c6d
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 0ea9c6d"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$73,$75,$6D,$20,$25,$6C,$75,$0A,$00
+
+; ---------------------------------------------------------------
+; unsigned long __near__ gcd (unsigned long a, unsigned long b)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_gcd: near
+
+.segment	"CODE"
+
+	jsr     pusheax
+	jsr     decsp4
+	ldy     #$03
+	ldx     #$04
+L0002:	lda     regbank+1,x
+	sta     (sp),y
+	dey
+	dex
+	bne     L0002
+	jmp     L0005
+L0003:	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosumodeax
+	sta     regbank+2
+	stx     regbank+2+1
+	ldy     sreg
+	sty     regbank+2+2
+	ldy     sreg+1
+	sty     regbank+2+3
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     #$08
+	jsr     steaxysp
+	lda     regbank+2+3
+	sta     sreg+1
+	lda     regbank+2+2
+	sta     sreg
+	ldx     regbank+2+1
+	lda     regbank+2
+	ldy     #$04
+	jsr     steaxysp
+L0005:	ldy     #$07
+	jsr     ldeaxysp
+	jsr     utsteax
+	bne     L0003
+	ldy     #$0B
+	jsr     ldeaxysp
+	pha
+	ldy     #$00
+L0006:	lda     (sp),y
+	sta     regbank+2,y
+	iny
+	cpy     #$04
+	bne     L0006
+	pla
+	ldy     #$0C
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned long __near__ isqrt (unsigned long n)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_isqrt: near
+
+.segment	"CODE"
+
+	jsr     pusheax
+	jsr     pushl0
+	jsr     decsp4
+	ldy     #$03
+	ldx     #$04
+L0002:	lda     regbank+1,x
+	sta     (sp),y
+	dey
+	dex
+	bne     L0002
+	txa
+	sta     regbank+2
+	sta     regbank+2+1
+	sta     regbank+2+2
+	ldy     #$40
+	jmp     L000C
+L0003:	lda     regbank+2+3
+	sta     sreg+1
+	lda     regbank+2+2
+	sta     sreg
+	ldx     regbank+2+1
+	lda     regbank+2
+	jsr     shreax2
+	sta     regbank+2
+	stx     regbank+2+1
+	ldy     sreg
+	sty     regbank+2+2
+	ldy     sreg+1
+L000C:	sty     regbank+2+3
+	lda     regbank+2+3
+	sta     sreg+1
+	lda     regbank+2+2
+	sta     sreg
+	ldx     regbank+2+1
+	lda     regbank+2
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosugteax
+	bne     L0003
+	jmp     L0008
+L0006:	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	lda     regbank+2+3
+	sta     sreg+1
+	lda     regbank+2+2
+	sta     sreg
+	ldx     regbank+2+1
+	lda     regbank+2
+	jsr     tosaddeax
+	jsr     tosugeeax
+	beq     L0009
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	lda     regbank+2+3
+	sta     sreg+1
+	lda     regbank+2+2
+	sta     sreg
+	ldx     regbank+2+1
+	lda     regbank+2
+	jsr     tosaddeax
+	ldy     #$08
+	jsr     lsubeqysp
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     shreax1
+	jsr     pusheax
+	lda     regbank+2+3
+	sta     sreg+1
+	lda     regbank+2+2
+	sta     sreg
+	ldx     regbank+2+1
+	lda     regbank+2
+	jsr     tosaddeax
+	jmp     L000E
+L0009:	ldy     #$07
+	jsr     ldeaxysp
+	jsr     shreax1
+L000E:	ldy     #$04
+	jsr     steaxysp
+	lda     regbank+2+3
+	sta     sreg+1
+	lda     regbank+2+2
+	sta     sreg
+	ldx     regbank+2+1
+	lda     regbank+2
+	jsr     shreax2
+	sta     regbank+2
+	stx     regbank+2+1
+	ldy     sreg
+	sty     regbank+2+2
+	ldy     sreg+1
+	sty     regbank+2+3
+L0008:	lda     regbank+2+3
+	ora     regbank+2+2
+	ora     regbank+2+1
+	ora     regbank+2+0
+	jne     L0006
+	ldy     #$07
+	jsr     ldeaxysp
+	pha
+	ldy     #$00
+L000B:	lda     (sp),y
+	sta     regbank+2,y
+	iny
+	cpy     #$04
+	bne     L000B
+	pla
+	ldy     #$0C
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     regbank+5
+	jsr     pusha
+	ldx     #$00
+	lda     #$01
+	jsr     push0ax
+	jsr     decsp4
+	ldy     #$03
+	ldx     #$04
+L0002:	lda     regbank+0,x
+	sta     (sp),y
+	dey
+	dex
+	bne     L0002
+	lda     #$01
+	sta     regbank+1
+	stx     regbank+1+1
+	stx     regbank+1+2
+	stx     regbank+1+3
+	jsr     decsp4
+	jsr     pushl0
+	sta     regbank+5
+	jmp     L0008
+L0006:	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	lda     regbank+1+3
+	sta     sreg+1
+	lda     regbank+1+2
+	sta     sreg
+	ldx     regbank+1+1
+	lda     regbank+1
+	jsr     tosaddeax
+	ldy     #$04
+	jsr     steaxysp
+	lda     regbank+1+3
+	sta     sreg+1
+	lda     regbank+1+2
+	sta     sreg
+	ldx     regbank+1+1
+	lda     regbank+1
+	ldy     #$0C
+	jsr     steaxysp
+	ldy     #$07
+	jsr     ldeaxysp
+	sta     regbank+1
+	stx     regbank+1+1
+	ldy     sreg
+	sty     regbank+1+2
+	ldy     sreg+1
+	sty     regbank+1+3
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	lda     #$03
+	jsr     tosumul0ax
+	jsr     pusheax
+	lda     regbank+1+3
+	sta     sreg+1
+	lda     regbank+1+2
+	sta     sreg
+	ldx     regbank+1+1
+	lda     regbank+1
+	jsr     pusheax
+	ldx     #$00
+	lda     #$05
+	jsr     tosumul0ax
+	jsr     _gcd
+	jsr     pusheax
+	lda     regbank+1+3
+	sta     sreg+1
+	lda     regbank+1+2
+	sta     sreg
+	ldx     regbank+1+1
+	lda     regbank+1
+	jsr     _isqrt
+	jsr     tosaddeax
+	jsr     laddeq0sp
+	inc     regbank+5
+L0008:	lda     regbank+5
+	cmp     #$28
+	jcc     L0006
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+	jsr     ldeax0sp
+	jsr     pusheax
+	ldx     #$2B
+	lda     #$01
+	sta     sreg
+	lsr     a
+	sta     sreg+1
+	lda     #$51
+	jsr     tosneeax
+	pha
+	ldy     #$10
+	lda     (sp),y
+	sta     regbank+5
+	stx     tmp1
+	ldy     #$0B
+	ldx     #$03
+L0007:	lda     (sp),y
+	sta     regbank+1,x
+	dey
+	dex
+	bpl     L0007
+	ldx     tmp1
+	pla
+	ldy     #$11
+	jmp     addysp
+
+.endproc
+
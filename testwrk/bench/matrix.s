@@ -0,0 +1,516 @@
+;
+; File generated by cc65 v 2.19 - Git 0ea9c6d
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 0ea9c6d"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$63,$68,$65,$63,$6B,$73,$75,$6D,$20,$25,$6C,$64,$0A,$00
+
+.segment	"BSS"
+
+_a:
+	.res	288,$00
+_b:
+	.res	288,$00
+_c:
+	.res	288,$00
+
+; ---------------------------------------------------------------
+; void __near__ init (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_init: near
+
+.segment	"CODE"
+
+	lda     regbank+5
+	jsr     pusha
+	lda     regbank+4
+	jsr     pusha
+	ldx     #$00
+	stx     regbank+5
+	jmp     L0012
+L000F:	lda     #$00
+	sta     regbank+4
+	jmp     L0011
+L0010:	lda     regbank+5
+	sta     ptr1
+	stx     ptr1+1
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_a)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_a)
+	sta     ptr1+1
+	ldx     #$00
+	lda     regbank+4
+	asl     a
+	bcc     L000D
+	inx
+	clc
+L000D:	adc     ptr1
+	sta     ptr1
+	txa
+	adc     ptr1+1
+	sta     ptr1+1
+	ldx     #$00
+	lda     regbank+5
+	clc
+	adc     regbank+4
+	bcc     L000A
+	inx
+L000A:	ldy     #$00
+	sta     (ptr1),y
+	iny
+	txa
+	sta     (ptr1),y
+	ldx     #$00
+	lda     regbank+5
+	sta     ptr1
+	stx     ptr1+1
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_b)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_b)
+	sta     ptr1+1
+	lda     regbank+4
+	asl     a
+	bcc     L000E
+	inx
+	clc
+L000E:	adc     ptr1
+	sta     ptr1
+	txa
+	adc     ptr1+1
+	sta     ptr1+1
+	lda     regbank+5
+	sec
+	sbc     regbank+4
+	pha
+	lda     #$00
+	sbc     #$00
+	tax
+	pla
+	ldy     #$00
+	sta     (ptr1),y
+	iny
+	txa
+	sta     (ptr1),y
+	inc     regbank+4
+	ldx     #$00
+L0011:	lda     regbank+4
+	cmp     #$0C
+	jcc     L0010
+	inc     regbank+5
+L0012:	lda     regbank+5
+	cmp     #$0C
+	jcc     L000F
+	ldy     #$00
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ multiply (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_multiply: near
+
+.segment	"CODE"
+
+	lda     regbank+5
+	jsr     pusha
+	lda     regbank+4
+	jsr     pusha
+	lda     regbank+3
+	jsr     pusha
+	lda     regbank+1
+	ldx     regbank+2
+	jsr     pushax
+	ldx     #$00
+	stx     regbank+5
+	jmp     L001A
+L0015:	lda     #$00
+	sta     regbank+4
+	jmp     L0019
+L0016:	lda     #$00
+	sta     regbank+1
+	stx     regbank+1+1
+	tax
+	sta     regbank+3
+	jmp     L0018
+L0017:	lda     regbank+5
+	sta     ptr1
+	stx     ptr1+1
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_a)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_a)
+	sta     ptr1+1
+	lda     regbank+3
+	asl     a
+	bcc     L0012
+	inx
+	clc
+L0012:	adc     ptr1
+	sta     ptr1
+	txa
+	adc     ptr1+1
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     pushax
+	ldx     #$00
+	lda     regbank+3
+	sta     ptr1
+	stx     ptr1+1
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_b)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_b)
+	sta     ptr1+1
+	lda     regbank+4
+	asl     a
+	bcc     L0013
+	inx
+	clc
+L0013:	adc     ptr1
+	sta     ptr1
+	txa
+	adc     ptr1+1
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     tosmulax
+	clc
+	adc     regbank+1
+	sta     regbank+1
+	txa
+	adc     regbank+1+1
+	sta     regbank+1+1
+	inc     regbank+3
+	ldx     #$00
+L0018:	lda     regbank+3
+	cmp     #$0C
+	jcc     L0017
+	lda     regbank+5
+	sta     ptr1
+	stx     ptr1+1
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_c)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_c)
+	sta     ptr1+1
+	lda     regbank+4
+	asl     a
+	bcc     L0014
+	inx
+	clc
+L0014:	adc     ptr1
+	sta     ptr1
+	txa
+	adc     ptr1+1
+	sta     ptr1+1
+	lda     regbank+1
+	ldy     #$00
+	sta     (ptr1),y
+	iny
+	lda     regbank+1+1
+	sta     (ptr1),y
+	inc     regbank+4
+	ldx     #$00
+L0019:	lda     regbank+4
+	cmp     #$0C
+	jcc     L0016
+	inc     regbank+5
+L001A:	lda     regbank+5
+	cmp     #$0C
+	jcc     L0015
+	ldy     #$00
+L000E:	lda     (sp),y
+	sta     regbank+1,y
+	iny
+	cpy     #$05
+	bne     L000E
+	jmp     incsp5
+
+.endproc
+
+; ---------------------------------------------------------------
+; long __near__ checksum (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_checksum: near
+
+.segment	"CODE"
+
+	lda     regbank+5
+	jsr     pusha
+	lda     regbank+4
+	jsr     pusha
+	jsr     decsp4
+	ldy     #$03
+	ldx     #$04
+L0002:	lda     regbank-1,x
+	sta     (sp),y
+	dey
+	dex
+	bne     L0002
+	stx     sreg
+	stx     sreg+1
+	txa
+	sta     regbank+0
+	sta     regbank+0+1
+	sta     regbank+0+2
+	sta     regbank+0+3
+	sta     regbank+5
+	jmp     L0012
+L000F:	lda     #$00
+	sta     regbank+4
+	jmp     L0011
+L0010:	lda     regbank+5
+	sta     ptr1
+	stx     ptr1+1
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_c)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_c)
+	sta     ptr1+1
+	ldx     #$00
+	lda     regbank+4
+	asl     a
+	bcc     L000E
+	inx
+	clc
+L000E:	adc     ptr1
+	sta     ptr1
+	txa
+	adc     ptr1+1
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     pushax
+	ldx     #$00
+	lda     regbank+5
+	clc
+	adc     #$01
+	bcc     L000B
+	inx
+L000B:	jsr     axlong
+	jsr     toslong
+	jsr     tosmuleax
+	ldy     #<(regbank+0)
+	sty     ptr1
+	ldy     #>(regbank+0)
+	jsr     laddeq
+	inc     regbank+4
+	ldx     #$00
+L0011:	lda     regbank+4
+	cmp     #$0C
+	bcc     L0010
+	inc     regbank+5
+L0012:	lda     regbank+5
+	cmp     #$0C
+	bcc     L000F
+	lda     regbank+0+3
+	sta     sreg+1
+	lda     regbank+0+2
+	sta     sreg
+	ldx     regbank+0+1
+	lda     regbank+0
+	pha
+	ldy     #$00
+L000C:	lda     (sp),y
+	sta     regbank+0,y
+	iny
+	cpy     #$06
+	bne     L000C
+	pla
+	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     regbank+5
+	jsr     pusha
+	jsr     decsp4
+	jsr     _init
+	lda     #$00
+	sta     regbank+5
+	jmp     L0006
+L0005:	jsr     _multiply
+	inc     regbank+5
+L0006:	lda     regbank+5
+	cmp     #$04
+	bcc     L0005
+	jsr     _checksum
+	jsr     steax0sp
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+	jsr     ldeax0sp
+	jsr     pusheax
+	ldx     #$0A
+	lda     #$02
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$D8
+	jsr     tosneeax
+	pha
+	ldy     #$04
+	lda     (sp),y
+	sta     regbank+5
+	pla
+	jmp     incsp5
+
+.endproc
+
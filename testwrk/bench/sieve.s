@@ -0,0 +1,202 @@
+;
+; File generated by cc65 v 2.19 - Git 0ea9c6d
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 0ea9c6d"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.import		_memset
+	.export		_main
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$25,$75,$20,$70,$72,$69,$6D,$65,$73,$0A,$00
+
+.segment	"BSS"
+
+_flags:
+	.res	8191,$00
+
+; ---------------------------------------------------------------
+; unsigned int __near__ sieve (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_sieve: near
+
+.segment	"CODE"
+
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+3
+	jsr     pushax
+	lda     regbank+0
+	ldx     regbank+1
+	jsr     pushax
+	jsr     decsp2
+	lda     #<(_flags)
+	ldx     #>(_flags)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	ldx     #$1F
+	lda     #$FF
+	jsr     _memset
+	ldy     #$00
+	tya
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	sta     regbank+4
+	sta     regbank+4+1
+	jmp     L0002
+L0005:	lda     #<(_flags)
+	sta     ptr1
+	lda     #>(_flags)
+	clc
+	adc     regbank+4+1
+	sta     ptr1+1
+	ldy     regbank+4
+	lda     (ptr1),y
+	beq     L0008
+	lda     regbank+4
+	ldx     regbank+4+1
+	clc
+	adc     regbank+4
+	pha
+	txa
+	adc     regbank+4+1
+	tax
+	pla
+	clc
+	adc     #$03
+	bcc     L0009
+	inx
+L0009:	sta     regbank+0
+	stx     regbank+0+1
+	lda     regbank+4
+	clc
+	adc     regbank+0
+	sta     regbank+2
+	lda     regbank+4+1
+	adc     regbank+0+1
+	jmp     L0010
+L000D:	lda     #<(_flags)
+	clc
+	adc     regbank+2
+	sta     ptr1
+	lda     #>(_flags)
+	adc     regbank+2+1
+	sta     ptr1+1
+	lda     #$00
+	tay
+	sta     (ptr1),y
+	lda     regbank+0
+	clc
+	adc     regbank+2
+	sta     regbank+2
+	lda     regbank+0+1
+	adc     regbank+2+1
+L0010:	sta     regbank+2+1
+	cmp     #$1F
+	bne     L000E
+	lda     regbank+2
+	cmp     #$FF
+L000E:	bcc     L000D
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+L0008:	inc     regbank+4
+	bne     L0002
+	inc     regbank+4+1
+L0002:	lda     regbank+4+1
+	cmp     #$1F
+	bne     L0006
+	lda     regbank+4
+	cmp     #$FF
+L0006:	bcc     L0005
+	ldy     #$01
+	lda     (sp),y
+	sta     tmp1
+	dey
+	lda     (sp),y
+	pha
+	ldy     #$07
+	ldx     #$05
+L000F:	lda     (sp),y
+	sta     regbank+0,x
+	dey
+	dex
+	bpl     L000F
+	ldx     tmp1
+	pla
+	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     regbank+5
+	jsr     pusha
+	lda     regbank+3
+	ldx     regbank+4
+	jsr     pushax
+	lda     #$00
+	sta     regbank+3
+	sta     regbank+3+1
+	sta     regbank+5
+	jmp     L0007
+L0005:	jsr     _sieve
+	sta     regbank+3
+	stx     regbank+3+1
+	inc     regbank+5
+L0007:	lda     regbank+5
+	cmp     #$03
+	bcc     L0005
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     regbank+3
+	ldx     regbank+3+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     regbank+3
+	ldx     regbank+3+1
+	cpx     #$07
+	bne     L0006
+	cmp     #$6B
+L0006:	jsr     boolne
+	pha
+	lda     (sp,x)
+	sta     regbank+3
+	ldy     #$01
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	pla
+	jmp     incsp3
+
+.endproc
+
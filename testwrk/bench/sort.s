@@ -0,0 +1,628 @@
+;
+; File generated by cc65 v 2.19 - Git 0ea9c6d
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 0ea9c6d"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_seed:
+	.word	$0001
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+
+.segment	"BSS"
+
+_data:
+	.res	800,$00
+
+; ---------------------------------------------------------------
+; void __near__ fill (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fill: near
+
+.segment	"CODE"
+
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	lda     #$00
+	sta     regbank+4
+	sta     regbank+4+1
+	jmp     L0002
+L0005:	lda     regbank+4
+	ldx     regbank+4+1
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_data)
+	tay
+	lda     tmp1
+	adc     #>(_data)
+	tax
+	tya
+	jsr     pushax
+	lda     _seed
+	ldx     _seed+1
+	jsr     pushax
+	ldx     #$62
+	lda     #$55
+	jsr     tosumulax
+	clc
+	adc     #$19
+	pha
+	txa
+	adc     #$36
+	tax
+	pla
+	sta     _seed
+	stx     _seed+1
+	ldy     #$00
+	jsr     staxspidx
+	inc     regbank+4
+	bne     L0002
+	inc     regbank+4+1
+L0002:	lda     regbank+4+1
+	cmp     #$01
+	bne     L0006
+	lda     regbank+4
+	cmp     #$90
+L0006:	bcc     L0005
+	ldy     #$00
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ shellsort (int *a, unsigned int n)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_shellsort: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+3
+	jsr     pushax
+	lda     regbank+0
+	ldx     regbank+1
+	jsr     pushax
+	jsr     decsp2
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     shrax1
+	sta     regbank+4
+	stx     regbank+4+1
+	jmp     L0002
+L0005:	lda     regbank+4+1
+	sta     regbank+2+1
+	lda     regbank+4
+	sta     regbank+2
+	jmp     L0007
+L000A:	lda     regbank+2
+	ldx     regbank+2+1
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	iny
+	adc     (sp),y
+	sta     ptr1
+	lda     tmp1
+	iny
+	adc     (sp),y
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     stax0sp
+	lda     regbank+2+1
+	sta     regbank+0+1
+	lda     regbank+2
+	sta     regbank+0
+	jmp     L000C
+L000F:	lda     regbank+0
+	ldx     regbank+0+1
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	ldy     #$0A
+	adc     (sp),y
+	sta     sreg
+	lda     tmp1
+	iny
+	adc     (sp),y
+	sta     sreg+1
+	lda     regbank+0
+	sec
+	sbc     regbank+4
+	pha
+	lda     regbank+0+1
+	sbc     regbank+4+1
+	sta     tmp1
+	pla
+	asl     a
+	rol     tmp1
+	clc
+	dey
+	adc     (sp),y
+	sta     ptr1
+	lda     tmp1
+	iny
+	adc     (sp),y
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	sta     (sreg),y
+	iny
+	txa
+	sta     (sreg),y
+	lda     regbank+4
+	eor     #$FF
+	sec
+	adc     regbank+0
+	sta     regbank+0
+	lda     regbank+4+1
+	eor     #$FF
+	adc     regbank+0+1
+	sta     regbank+0+1
+L000C:	lda     regbank+0
+	cmp     regbank+4
+	lda     regbank+0+1
+	sbc     regbank+4+1
+	bcc     L0014
+	lda     regbank+0
+	sec
+	sbc     regbank+4
+	pha
+	lda     regbank+0+1
+	sbc     regbank+4+1
+	sta     tmp1
+	pla
+	asl     a
+	rol     tmp1
+	clc
+	ldy     #$0A
+	adc     (sp),y
+	sta     ptr1
+	lda     tmp1
+	iny
+	adc     (sp),y
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     pushax
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosicmp
+	beq     L0014
+	jpl     L000F
+L0014:	lda     regbank+0
+	ldx     regbank+0+1
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	ldy     #$0A
+	adc     (sp),y
+	sta     ptr1
+	lda     tmp1
+	iny
+	adc     (sp),y
+	sta     ptr1+1
+	ldy     #$01
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	sta     (ptr1),y
+	iny
+	txa
+	sta     (ptr1),y
+	inc     regbank+2
+	bne     L0007
+	inc     regbank+2+1
+L0007:	lda     regbank+2
+	ldy     #$08
+	cmp     (sp),y
+	lda     regbank+2+1
+	iny
+	sbc     (sp),y
+	jcc     L000A
+	lda     regbank+4+1
+	lsr     a
+	sta     regbank+4+1
+	lda     regbank+4
+	ror     a
+	sta     regbank+4
+L0002:	lda     regbank+4
+	ora     regbank+4+1
+	jne     L0005
+	ldy     #$07
+	ldx     #$05
+L0013:	lda     (sp),y
+	sta     regbank+0,x
+	dey
+	dex
+	bpl     L0013
+	ldy     #$0C
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ insertionsort (int *a, unsigned int n)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_insertionsort: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+3
+	jsr     pushax
+	lda     regbank+0
+	ldx     regbank+1
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	sta     regbank+4
+	stx     regbank+4+1
+	jmp     L0002
+L0005:	lda     regbank+4
+	ldx     regbank+4+1
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	iny
+	adc     (sp),y
+	sta     ptr1
+	lda     tmp1
+	iny
+	adc     (sp),y
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	sta     regbank+0
+	stx     regbank+0+1
+	lda     regbank+4+1
+	sta     regbank+2+1
+	lda     regbank+4
+	sta     regbank+2
+	jmp     L0007
+L000A:	lda     regbank+2
+	ldx     regbank+2+1
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	ldy     #$08
+	adc     (sp),y
+	sta     sreg
+	lda     tmp1
+	iny
+	adc     (sp),y
+	sta     sreg+1
+	lda     regbank+2
+	ldx     regbank+2+1
+	sec
+	sbc     #$01
+	bcs     L0011
+	dex
+L0011:	stx     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	dey
+	adc     (sp),y
+	sta     ptr1
+	lda     tmp1
+	iny
+	adc     (sp),y
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	sta     (sreg),y
+	iny
+	txa
+	sta     (sreg),y
+	lda     regbank+2
+	sec
+	sbc     #$01
+	sta     regbank+2
+	bcs     L0007
+	dec     regbank+2+1
+L0007:	lda     regbank+2
+	ora     regbank+2+1
+	beq     L0013
+	lda     regbank+2
+	ldx     regbank+2+1
+	sec
+	sbc     #$01
+	bcs     L000D
+	dex
+L000D:	stx     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	ldy     #$08
+	adc     (sp),y
+	sta     ptr1
+	lda     tmp1
+	iny
+	adc     (sp),y
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     pushax
+	lda     regbank+0
+	ldx     regbank+0+1
+	jsr     tosicmp
+	beq     L0013
+	jpl     L000A
+L0013:	lda     regbank+2
+	ldx     regbank+2+1
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	ldy     #$08
+	adc     (sp),y
+	sta     ptr1
+	lda     tmp1
+	iny
+	adc     (sp),y
+	sta     ptr1+1
+	lda     regbank+0
+	ldy     #$00
+	sta     (ptr1),y
+	iny
+	lda     regbank+0+1
+	sta     (ptr1),y
+	inc     regbank+4
+	bne     L0002
+	inc     regbank+4+1
+L0002:	lda     regbank+4
+	ldy     #$06
+	cmp     (sp),y
+	lda     regbank+4+1
+	iny
+	sbc     (sp),y
+	jcc     L0005
+	ldy     #$00
+L0012:	lda     (sp),y
+	sta     regbank+0,y
+	iny
+	cpy     #$06
+	bne     L0012
+	ldy     #$0A
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ sorted (const int *a, unsigned int n)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_sorted: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	sta     regbank+4
+	stx     regbank+4+1
+	jmp     L0002
+L0005:	lda     regbank+4
+	ldx     regbank+4+1
+	sec
+	sbc     #$01
+	bcs     L0008
+	dex
+L0008:	stx     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	ldy     #$04
+	adc     (sp),y
+	sta     ptr1
+	lda     tmp1
+	iny
+	adc     (sp),y
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+4+1
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	ldy     #$06
+	adc     (sp),y
+	sta     ptr1
+	lda     tmp1
+	iny
+	adc     (sp),y
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     tosicmp
+	bmi     L0007
+	beq     L0007
+	ldx     #$00
+	txa
+	jmp     L0001
+L0007:	inc     regbank+4
+	bne     L0002
+	inc     regbank+4+1
+L0002:	lda     regbank+4
+	ldy     #$02
+	cmp     (sp),y
+	lda     regbank+4+1
+	iny
+	sbc     (sp),y
+	bcc     L0005
+	ldx     #$00
+	lda     #$01
+L0001:	pha
+	lda     (sp,x)
+	sta     regbank+4
+	ldy     #$01
+	lda     (sp),y
+	sta     regbank+5
+	pla
+	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	lda     #$00
+	sta     regbank+4
+	sta     regbank+4+1
+	jsr     _fill
+	lda     #<(_data)
+	ldx     #>(_data)
+	jsr     pushax
+	ldx     #$01
+	lda     #$90
+	jsr     _shellsort
+	lda     #<(_data)
+	ldx     #>(_data)
+	jsr     pushax
+	ldx     #$01
+	lda     #$90
+	jsr     _sorted
+	jsr     bnegax
+	clc
+	adc     regbank+4
+	sta     regbank+4
+	txa
+	adc     regbank+4+1
+	sta     regbank+4+1
+	jsr     _fill
+	lda     #<(_data)
+	ldx     #>(_data)
+	jsr     pushax
+	ldx     #$00
+	lda     #$C8
+	jsr     _insertionsort
+	lda     #<(_data)
+	ldx     #>(_data)
+	jsr     pushax
+	ldx     #$00
+	lda     #$C8
+	jsr     _sorted
+	jsr     bnegax
+	clc
+	adc     regbank+4
+	sta     regbank+4
+	txa
+	adc     regbank+4+1
+	sta     regbank+4+1
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     regbank+4
+	ldx     regbank+4+1
+	pha
+	ldy     #$00
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	pla
+	jmp     incsp2
+
+.endproc
+
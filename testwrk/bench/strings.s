@@ -0,0 +1,398 @@
+;
+; File generated by cc65 v 2.19 - Git 0ea9c6d
+;
+	.fopt		compiler,"cc65 v 2.19 - Git 0ea9c6d"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.import		_strcpy
+	.import		_strlen
+	.import		_isalpha
+	.import		_toupper
+	.export		_main
+
+.segment	"RODATA"
+
+_text:
+	.byte	$54,$68,$65,$20,$71,$75,$69,$63,$6B,$20,$62,$72,$6F,$77,$6E,$20
+	.byte	$66,$6F,$78,$20,$6A,$75,$6D,$70,$73,$20,$6F,$76,$65,$72,$20,$74
+	.byte	$68,$65,$20,$6C,$61,$7A,$79,$20,$64,$6F,$67,$2E,$20,$50,$61,$63
+	.byte	$6B,$20,$6D,$79,$20,$62,$6F,$78,$20,$77,$69,$74,$68,$20,$66,$69
+	.byte	$76,$65,$20,$64,$6F,$7A,$65,$6E,$20,$6C,$69,$71,$75,$6F,$72,$20
+	.byte	$6A,$75,$67,$73,$2E,$20,$48,$6F,$77,$20,$76,$65,$78,$69,$6E,$67
+	.byte	$6C,$79,$20,$71,$75,$69,$63,$6B,$20,$64,$61,$66,$74,$20,$7A,$65
+	.byte	$62,$72,$61,$73,$20,$6A,$75,$6D,$70,$21,$00
+S0002:
+	.byte	$25,$75,$20,$77,$6F,$72,$64,$73,$2C,$20,$68,$61,$73,$68,$20,$25
+	.byte	$30,$34,$58,$0A,$00
+
+.segment	"BSS"
+
+_buf:
+	.res	123,$00
+
+; ---------------------------------------------------------------
+; void __near__ reverse (char *s)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_reverse: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _strlen
+	jsr     tosaddax
+	sec
+	sbc     #$01
+	bcs     L0002
+	dex
+L0002:	sta     regbank+4
+	stx     regbank+4+1
+	lda     regbank+3
+	jsr     pusha
+	jmp     L0005
+L0003:	ldy     #$04
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$00
+	lda     (ptr1),y
+	sta     regbank+3
+	ldy     #$04
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$00
+	lda     (regbank+4),y
+	sta     (ptr1),y
+	ldy     #$03
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	lda     regbank+3
+	ldy     #$00
+	sta     (regbank+4),y
+	lda     regbank+4
+	sec
+	sbc     #$01
+	sta     regbank+4
+	bcs     L0005
+	dec     regbank+4+1
+L0005:	ldy     #$04
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cmp     regbank+4
+	txa
+	sbc     regbank+4+1
+	bcc     L0003
+	ldy     #$00
+	lda     (sp),y
+	sta     regbank+3
+	iny
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	jmp     incsp5
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ words (const char *s)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_words: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	lda     #$00
+	sta     regbank+4
+	sta     regbank+4+1
+	lda     regbank+3
+	jsr     pusha
+	lda     #$00
+	sta     regbank+3
+	jmp     L0004
+L0002:	ldy     #$04
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldx     #$00
+	lda     (ptr1,x)
+	jsr     _isalpha
+	stx     tmp1
+	ora     tmp1
+	beq     L0009
+	lda     regbank+3
+	bne     L0008
+	inc     regbank+4
+	bne     L0007
+	inc     regbank+4+1
+L0007:	lda     #$01
+L0009:	sta     regbank+3
+L0008:	ldy     #$03
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L0004:	ldy     #$04
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$00
+	lda     (ptr1),y
+	bne     L0002
+	lda     regbank+4
+	ldx     regbank+4+1
+	pha
+	lda     (sp),y
+	sta     regbank+3
+	iny
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	pla
+	jmp     incsp5
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ upper (char *s)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_upper: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jmp     L0002
+L0005:	jsr     pushw0sp
+	ldy     #$03
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldx     #$00
+	lda     (ptr1,x)
+	jsr     _toupper
+	ldy     #$00
+	jsr     staspidx
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+L0002:	ldy     #$01
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	lda     (ptr1),y
+	bne     L0005
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ hash (const char *s)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_hash: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	lda     #$00
+	sta     regbank+4
+	sta     regbank+4+1
+	jmp     L0004
+L0002:	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     shlax4
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     regbank+4
+	sta     sreg
+	lda     tmp1
+	adc     regbank+4+1
+	sta     sreg+1
+	ldy     #$03
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$00
+	lda     (ptr1),y
+	clc
+	adc     sreg
+	ldx     sreg+1
+	bcc     L0005
+	inx
+L0005:	sta     regbank+4
+	stx     regbank+4+1
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L0004:	ldy     #$03
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$00
+	lda     (ptr1),y
+	bne     L0002
+	lda     regbank+4
+	ldx     regbank+4+1
+	pha
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	pla
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     regbank+5
+	jsr     pusha
+	lda     regbank+3
+	ldx     regbank+4
+	jsr     pushax
+	lda     #$00
+	sta     regbank+3
+	sta     regbank+3+1
+	lda     regbank+1
+	ldx     regbank+2
+	jsr     pushax
+	lda     #$00
+	sta     regbank+1
+	sta     regbank+1+1
+	sta     regbank+5
+	jmp     L000C
+L0005:	ldy     #$FF
+L0006:	iny
+	lda     _text,y
+	sta     _buf,y
+	bne     L0006
+	lda     #<(_buf)
+	ldx     #>(_buf)
+	jsr     _reverse
+	lda     #<(_buf)
+	ldx     #>(_buf)
+	jsr     _reverse
+	lda     #<(_buf)
+	ldx     #>(_buf)
+	jsr     _upper
+	lda     #<(_buf)
+	ldx     #>(_buf)
+	jsr     _words
+	sta     regbank+3
+	stx     regbank+3+1
+	lda     #<(_buf)
+	ldx     #>(_buf)
+	jsr     _hash
+	sta     regbank+1
+	stx     regbank+1+1
+	inc     regbank+5
+L000C:	lda     regbank+5
+	cmp     #$14
+	bcc     L0005
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     regbank+3
+	ldx     regbank+3+1
+	jsr     pushax
+	lda     regbank+1
+	ldx     regbank+1+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	lda     regbank+3+1
+	bne     L0008
+	lda     regbank+3
+	cmp     #$17
+	bne     L0008
+	lda     regbank+1+1
+	cmp     #$B4
+	bne     L0008
+	lda     regbank+1
+	cmp     #$C2
+	bne     L0008
+	ldx     #$00
+	txa
+	jmp     L0001
+L0008:	ldx     #$00
+	lda     #$01
+L0001:	pha
+	ldy     #$00
+L000B:	lda     (sp),y
+	sta     regbank+1,y
+	iny
+	cpy     #$05
+	bne     L000B
+	pla
+	jmp     incsp5
+
+.endproc
+
@@ -0,0 +1,131 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "bug1209-ind-goto-rev.c", 1572, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/stdlib.h", 5999, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_f
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$46,$41,$49,$4C,$0A,$00
+S0001:
+	.byte	$50,$41,$53,$53,$0A,$00
+
+; ---------------------------------------------------------------
+; int __near__ f (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f: near
+
+	.dbg	func, "f", "00", extern, "_f"
+
+.segment	"CODE"
+
+	.dbg	line, "bug1209-ind-goto-rev.c", 35
+	lda     M0001
+	ldx     M0001+1
+	cpx     #$00
+	bne     L0004
+	cmp     #$00
+L0004:	jsr     boolne
+	jeq     L0003
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "bug1209-ind-goto-rev.c", 36
+L0003:	lda     #<(L0002)
+	ldx     #>(L0002)
+	sta     M0001
+	stx     M0001+1
+	.dbg	line, "bug1209-ind-goto-rev.c", 37
+	ldy     #$00
+	lda     M0001,y
+	ldx     M0001+1,y
+	jmp     callax
+	.dbg	line, "bug1209-ind-goto-rev.c", 38
+L0001:	rts
+
+	.dbg	line
+.segment	"BSS"
+
+M0001:
+	.res	2,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "bug1209-ind-goto-rev.c", 44
+	jsr     _f
+	cpx     #$00
+	bne     L0003
+	cmp     #$00
+L0003:	jsr     boolne
+	jeq     L0002
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1209-ind-goto-rev.c", 46
+L0002:	ldx     #$00
+	lda     _failures
+	cmp     #$00
+	jsr     booleq
+	jeq     L0004
+	.dbg	line, "bug1209-ind-goto-rev.c", 47
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1209-ind-goto-rev.c", 48
+	jmp     L0005
+	.dbg	line, "bug1209-ind-goto-rev.c", 49
+L0004:	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1209-ind-goto-rev.c", 52
+L0005:	ldx     #$00
+	lda     _failures
+	jmp     L0001
+	.dbg	line, "bug1209-ind-goto-rev.c", 53
+L0001:	rts
+
+	.dbg	line
+.endproc
+
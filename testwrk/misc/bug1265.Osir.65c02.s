@@ -0,0 +1,282 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_puts
+	.import		_sprintf
+	.import		_strcmp
+	.export		_failures
+	.export		_str1
+	.export		_str2
+	.export		_f2
+	.export		_main
+	.export		_f1
+
+.segment	"DATA"
+
+_failures:
+	.word	$0000
+
+.segment	"RODATA"
+
+S0004:
+	.byte	$66,$31,$20,$72,$65,$74,$75,$72,$6E,$73,$20,$77,$72,$6F,$6E,$67
+	.byte	$20,$76,$61,$6C,$75,$65,$00
+S0008:
+	.byte	$66,$32,$20,$72,$65,$74,$75,$72,$6E,$73,$20,$77,$72,$6F,$6E,$67
+	.byte	$20,$76,$61,$6C,$75,$65,$00
+S0007:
+	.byte	$6E,$6F,$74,$20,$65,$71,$75,$61,$6C,$00
+S0003	:=	S0007+0
+S0006:
+	.byte	$25,$70,$0A,$00
+S0002	:=	S0006+0
+S0005	:=	S0006+0
+S0001	:=	S0006+0
+
+.segment	"BSS"
+
+_str1:
+	.res	10,$00
+_str2:
+	.res	10,$00
+
+; ---------------------------------------------------------------
+; int __near__ f2 (int x)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f2: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$01
+	lda     (sp),y
+	cmp     #$09
+	bne     L0003
+	lda     (sp)
+	cmp     #$29
+	bne     L0003
+	ldx     #$00
+	lda     #$17
+	bra     L0001
+L0003:	ldx     #$FF
+	txa
+L0001:	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp8
+	lda     #<(_str1)
+	ldy     #$02
+	sta     (sp),y
+	iny
+	lda     #>(_str1)
+	sta     (sp),y
+	lda     #<(S0001)
+	sta     (sp)
+	ldy     #$01
+	lda     #>(S0001)
+	sta     (sp),y
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$06
+	bcc     L0002
+	inx
+L0002:	jsr     pushax
+	ldy     #$06
+	jsr     _sprintf
+	ldx     #$04
+	lda     #$D2
+	ldy     #$02
+	jsr     staxysp
+	jsr     _f1
+	jsr     stax0sp
+	jsr     decsp4
+	lda     #<(_str2)
+	ldy     #$02
+	sta     (sp),y
+	iny
+	lda     #>(_str2)
+	sta     (sp),y
+	lda     #<(S0002)
+	sta     (sp)
+	ldy     #$01
+	lda     #>(S0002)
+	sta     (sp),y
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$06
+	bcc     L0003
+	inx
+L0003:	jsr     pushax
+	ldy     #$06
+	jsr     _sprintf
+	ldy     #$00
+	bra     L0005
+L0006:	tax
+	beq     L0007
+	iny
+L0005:	lda     _str1,y
+	cmp     _str2,y
+	beq     L0006
+	ldx     #$01
+	bcs     L0007
+	ldx     #$FF
+L0007:	stx     tmp1
+	ora     tmp1
+	beq     L0004
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     _puts
+	inc     _failures
+	bne     L0004
+	inc     _failures+1
+L0004:	ldy     #$01
+	lda     (sp),y
+	bne     L0016
+	lda     (sp)
+	cmp     #$2A
+	beq     L0009
+L0016:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     _puts
+	inc     _failures
+	bne     L0009
+	inc     _failures+1
+L0009:	jsr     decsp4
+	lda     #<(_str1)
+	ldy     #$02
+	sta     (sp),y
+	iny
+	lda     #>(_str1)
+	sta     (sp),y
+	lda     #<(S0005)
+	sta     (sp)
+	ldy     #$01
+	lda     #>(S0005)
+	sta     (sp),y
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$06
+	bcc     L000C
+	inx
+L000C:	jsr     pushax
+	ldy     #$06
+	jsr     _sprintf
+	ldx     #$09
+	lda     #$29
+	ldy     #$02
+	jsr     staxysp
+	jsr     _f2
+	jsr     stax0sp
+	jsr     decsp4
+	lda     #<(_str2)
+	ldy     #$02
+	sta     (sp),y
+	iny
+	lda     #>(_str2)
+	sta     (sp),y
+	lda     #<(S0006)
+	sta     (sp)
+	ldy     #$01
+	lda     #>(S0006)
+	sta     (sp),y
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$06
+	bcc     L000D
+	inx
+L000D:	jsr     pushax
+	ldy     #$06
+	jsr     _sprintf
+	ldy     #$00
+	bra     L000F
+L0010:	tax
+	beq     L0011
+	iny
+L000F:	lda     _str1,y
+	cmp     _str2,y
+	beq     L0010
+	ldx     #$01
+	bcs     L0011
+	ldx     #$FF
+L0011:	stx     tmp1
+	ora     tmp1
+	beq     L000E
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     _puts
+	inc     _failures
+	bne     L000E
+	inc     _failures+1
+L000E:	ldy     #$01
+	lda     (sp),y
+	bne     L0017
+	lda     (sp)
+	cmp     #$17
+	beq     L0013
+L0017:	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     _puts
+	inc     _failures
+	bne     L0013
+	inc     _failures+1
+L0013:	lda     _failures
+	ldx     _failures+1
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ f1 (int x)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f1: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$01
+	lda     (sp),y
+	cmp     #$04
+	bne     L0003
+	lda     (sp)
+	cmp     #$D2
+	bne     L0003
+	ldx     #$00
+	lda     #$2A
+	bra     L0001
+L0003:	ldx     #$FF
+	txa
+L0001:	jmp     incsp2
+
+.endproc
+
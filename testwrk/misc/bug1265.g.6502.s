@@ -0,0 +1,308 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "bug1265.c", 791, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/string.h", 5104, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "puts", "00", extern, "_puts"
+	.dbg		sym, "sprintf", "00", extern, "_sprintf"
+	.dbg		sym, "strcmp", "00", extern, "_strcmp"
+	.import		_puts
+	.import		_sprintf
+	.import		_strcmp
+	.export		_failures
+	.export		_str1
+	.export		_str2
+	.export		_f2
+	.export		_main
+	.export		_f1
+
+.segment	"DATA"
+
+_failures:
+	.word	$0000
+
+.segment	"RODATA"
+
+S0004:
+	.byte	$66,$31,$20,$72,$65,$74,$75,$72,$6E,$73,$20,$77,$72,$6F,$6E,$67
+	.byte	$20,$76,$61,$6C,$75,$65,$00
+S0008:
+	.byte	$66,$32,$20,$72,$65,$74,$75,$72,$6E,$73,$20,$77,$72,$6F,$6E,$67
+	.byte	$20,$76,$61,$6C,$75,$65,$00
+S0007:
+	.byte	$6E,$6F,$74,$20,$65,$71,$75,$61,$6C,$00
+S0003	:=	S0007+0
+S0006:
+	.byte	$25,$70,$0A,$00
+S0002	:=	S0006+0
+S0005	:=	S0006+0
+S0001	:=	S0006+0
+
+.segment	"BSS"
+
+_str1:
+	.res	10,$00
+_str2:
+	.res	10,$00
+
+; ---------------------------------------------------------------
+; int __near__ f2 (int x)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f2: near
+
+	.dbg	func, "f2", "00", extern, "_f2"
+	.dbg	sym, "x", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "bug1265.c", 11
+	jsr     pushax
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$09
+	bne     L0002
+	cmp     #$29
+L0002:	jsr     booleq
+	jeq     L0003
+	ldx     #$00
+	lda     #$17
+	jmp     L0004
+L0003:	ldx     #$FF
+	lda     #$FF
+L0004:	jmp     L0001
+L0001:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+	.dbg	sym, "x", "00", auto, -2
+	.dbg	sym, "n", "00", auto, -4
+
+.segment	"CODE"
+
+	.dbg	line, "bug1265.c", 16
+	jsr     decsp4
+	lda     #<(_str1)
+	ldx     #>(_str1)
+	jsr     pushax
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     #$06
+	jsr     leaa0sp
+	jsr     pushax
+	ldy     #$06
+	jsr     _sprintf
+	.dbg	line, "bug1265.c", 17
+	ldx     #$04
+	lda     #$D2
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "bug1265.c", 18
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f1
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "bug1265.c", 19
+	lda     #<(_str2)
+	ldx     #>(_str2)
+	jsr     pushax
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     #$06
+	jsr     leaa0sp
+	jsr     pushax
+	ldy     #$06
+	jsr     _sprintf
+	.dbg	line, "bug1265.c", 21
+	lda     #<(_str1)
+	ldx     #>(_str1)
+	jsr     pushax
+	lda     #<(_str2)
+	ldx     #>(_str2)
+	jsr     _strcmp
+	stx     tmp1
+	ora     tmp1
+	jeq     L0002
+	.dbg	line, "bug1265.c", 22
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     _puts
+	.dbg	line, "bug1265.c", 23
+	lda     _failures
+	ldx     _failures+1
+	inc     _failures
+	bne     L0003
+	inc     _failures+1
+L0003:	lda     _failures
+	ldx     _failures+1
+	.dbg	line, "bug1265.c", 25
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0005
+	cmp     #$2A
+L0005:	jsr     boolne
+	jeq     L0004
+	.dbg	line, "bug1265.c", 26
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     _puts
+	.dbg	line, "bug1265.c", 27
+	lda     _failures
+	ldx     _failures+1
+	inc     _failures
+	bne     L0006
+	inc     _failures+1
+L0006:	lda     _failures
+	ldx     _failures+1
+	.dbg	line, "bug1265.c", 30
+L0004:	lda     #<(_str1)
+	ldx     #>(_str1)
+	jsr     pushax
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     #$06
+	jsr     leaa0sp
+	jsr     pushax
+	ldy     #$06
+	jsr     _sprintf
+	.dbg	line, "bug1265.c", 31
+	ldx     #$09
+	lda     #$29
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "bug1265.c", 32
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _f2
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "bug1265.c", 33
+	lda     #<(_str2)
+	ldx     #>(_str2)
+	jsr     pushax
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	lda     #$06
+	jsr     leaa0sp
+	jsr     pushax
+	ldy     #$06
+	jsr     _sprintf
+	.dbg	line, "bug1265.c", 35
+	lda     #<(_str1)
+	ldx     #>(_str1)
+	jsr     pushax
+	lda     #<(_str2)
+	ldx     #>(_str2)
+	jsr     _strcmp
+	stx     tmp1
+	ora     tmp1
+	jeq     L0007
+	.dbg	line, "bug1265.c", 36
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     _puts
+	.dbg	line, "bug1265.c", 37
+	lda     _failures
+	ldx     _failures+1
+	inc     _failures
+	bne     L0008
+	inc     _failures+1
+L0008:	lda     _failures
+	ldx     _failures+1
+	.dbg	line, "bug1265.c", 39
+L0007:	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L000A
+	cmp     #$17
+L000A:	jsr     boolne
+	jeq     L0009
+	.dbg	line, "bug1265.c", 40
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     _puts
+	.dbg	line, "bug1265.c", 41
+	lda     _failures
+	ldx     _failures+1
+	inc     _failures
+	bne     L000B
+	inc     _failures+1
+L000B:	lda     _failures
+	ldx     _failures+1
+	.dbg	line, "bug1265.c", 44
+L0009:	lda     _failures
+	ldx     _failures+1
+	jmp     L0001
+	.dbg	line, "bug1265.c", 45
+L0001:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ f1 (int x)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f1: near
+
+	.dbg	func, "f1", "00", extern, "_f1"
+	.dbg	sym, "x", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "bug1265.c", 47
+	jsr     pushax
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$04
+	bne     L0002
+	cmp     #$D2
+L0002:	jsr     booleq
+	jeq     L0003
+	ldx     #$00
+	lda     #$2A
+	jmp     L0004
+L0003:	ldx     #$FF
+	lda     #$FF
+L0004:	jmp     L0001
+L0001:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,199 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_c
+	.export		_p
+	.export		_f1
+	.export		_data
+	.export		_f2
+	.export		_ret
+	.export		_main
+
+.segment	"DATA"
+
+_ret:
+	.word	$0000
+
+.segment	"RODATA"
+
+S0005:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+S0003:
+	.byte	$63,$3A,$20,$25,$68,$68,$78,$0A,$00
+S0001	:=	S0003+0
+S0002:
+	.byte	$70,$3A,$20,$25,$70,$0A,$00
+S0004	:=	S0002+0
+
+.segment	"BSS"
+
+_c:
+	.res	1,$00
+_p:
+	.res	2,$00
+_data:
+	.res	3,$00
+
+; ---------------------------------------------------------------
+; void __near__ f1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f1: near
+
+.segment	"CODE"
+
+	lda     #$01
+	jsr     pusha0
+	ldx     #$AA
+	txa
+	jsr     pushax
+	ldx     #$BB
+	txa
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+L0002:	jsr     booleq
+	beq     L0003
+	ldy     #$03
+	jmp     L0005
+L0003:	ldy     #$01
+L0005:	jsr     ldaxysp
+	sta     _p
+	stx     _p+1
+	lda     #$5A
+	sta     _c
+	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ f2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f2: near
+
+.segment	"CODE"
+
+	lda     #$01
+	jsr     pusha0
+	ldx     #$CC
+	txa
+	jsr     pushax
+	ldx     #$DD
+	txa
+	jsr     pushax
+	lda     #<(_data)
+	ldx     #>(_data)
+	jsr     pushax
+	jsr     pushw0sp
+	ldy     #$09
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+L0002:	jsr     booleq
+	beq     L0003
+	ldy     #$07
+	jmp     L0005
+L0003:	ldy     #$05
+L0005:	jsr     ldaxysp
+	ldy     #$01
+	jsr     staxspidx
+	jsr     ldax0sp
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$A5
+	ldy     #$00
+	sta     (ptr1),y
+	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     _f1
+	lda     _c
+	cmp     #$5A
+	jsr     boolne
+	beq     L0002
+	inc     _ret
+	bne     L0002
+	inc     _ret+1
+L0002:	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _c
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     _p
+	ldx     _p+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jsr     _f2
+	lda     _data
+	cmp     #$A5
+	jsr     boolne
+	beq     L0004
+	inc     _ret
+	bne     L0004
+	inc     _ret+1
+L0004:	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     _data
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     _data+1
+	ldx     _data+1+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     _ret
+	ldx     _ret+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     _ret
+	ldx     _ret+1
+	rts
+
+.endproc
+
@@ -0,0 +1,245 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "bug1397.c", 752, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_c
+	.export		_p
+	.export		_f1
+	.export		_data
+	.export		_f2
+	.export		_ret
+	.export		_main
+
+.segment	"DATA"
+
+_ret:
+	.word	$0000
+
+.segment	"RODATA"
+
+S0005:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+S0003:
+	.byte	$63,$3A,$20,$25,$68,$68,$78,$0A,$00
+S0001	:=	S0003+0
+S0002:
+	.byte	$70,$3A,$20,$25,$70,$0A,$00
+S0004	:=	S0002+0
+
+.segment	"BSS"
+
+_c:
+	.res	1,$00
+_p:
+	.res	2,$00
+_data:
+	.res	3,$00
+
+; ---------------------------------------------------------------
+; void __near__ f1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f1: near
+
+	.dbg	func, "f1", "00", extern, "_f1"
+	.dbg	sym, "i", "00", auto, -2
+	.dbg	sym, "pa", "00", auto, -4
+	.dbg	sym, "pb", "00", auto, -6
+
+.segment	"CODE"
+
+	.dbg	line, "bug1397.c", 10
+	lda     #$01
+	jsr     pusha0
+	.dbg	line, "bug1397.c", 11
+	ldx     #$AA
+	txa
+	jsr     pushax
+	.dbg	line, "bug1397.c", 12
+	ldx     #$BB
+	txa
+	jsr     pushax
+	.dbg	line, "bug1397.c", 14
+	ldy     #$05
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+L0002:	jsr     booleq
+	beq     L0003
+	ldy     #$03
+	bra     L0005
+L0003:	ldy     #$01
+L0005:	jsr     ldaxysp
+	sta     _p
+	stx     _p+1
+	.dbg	line, "bug1397.c", 15
+	lda     #$5A
+	sta     _c
+	.dbg	line, "bug1397.c", 16
+	jmp     incsp6
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ f2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f2: near
+
+	.dbg	func, "f2", "00", extern, "_f2"
+	.dbg	sym, "i", "00", auto, -2
+	.dbg	sym, "pa", "00", auto, -4
+	.dbg	sym, "pb", "00", auto, -6
+	.dbg	sym, "po", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "bug1397.c", 27
+	lda     #$01
+	jsr     pusha0
+	.dbg	line, "bug1397.c", 28
+	ldx     #$CC
+	txa
+	jsr     pushax
+	.dbg	line, "bug1397.c", 29
+	ldx     #$DD
+	txa
+	jsr     pushax
+	.dbg	line, "bug1397.c", 30
+	lda     #<(_data)
+	ldx     #>(_data)
+	jsr     pushax
+	.dbg	line, "bug1397.c", 32
+	jsr     pushw0sp
+	ldy     #$09
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+L0002:	jsr     booleq
+	beq     L0003
+	ldy     #$07
+	bra     L0005
+L0003:	ldy     #$05
+L0005:	jsr     ldaxysp
+	ldy     #$01
+	jsr     staxspidx
+	.dbg	line, "bug1397.c", 33
+	jsr     ldax0sp
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$A5
+	sta     (ptr1)
+	.dbg	line, "bug1397.c", 34
+	jmp     incsp8
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "bug1397.c", 39
+	jsr     _f1
+	.dbg	line, "bug1397.c", 40
+	lda     _c
+	cmp     #$5A
+	jsr     boolne
+	beq     L0002
+	.dbg	line, "bug1397.c", 41
+	inc     _ret
+	bne     L0002
+	inc     _ret+1
+	.dbg	line, "bug1397.c", 43
+L0002:	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _c
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1397.c", 44
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     _p
+	ldx     _p+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1397.c", 45
+	jsr     _f2
+	.dbg	line, "bug1397.c", 46
+	lda     _data
+	cmp     #$A5
+	jsr     boolne
+	beq     L0004
+	.dbg	line, "bug1397.c", 47
+	inc     _ret
+	bne     L0004
+	inc     _ret+1
+	.dbg	line, "bug1397.c", 49
+L0004:	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     _data
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1397.c", 50
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     _data+1
+	ldx     _data+1+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1397.c", 52
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     _ret
+	ldx     _ret+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1397.c", 53
+	lda     _ret
+	ldx     _ret+1
+	.dbg	line, "bug1397.c", 54
+	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,439 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "limits.c", 2040, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/limits.h", 3146, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_main
+
+.segment	"RODATA"
+
+S0017:
+	.byte	$55,$4C,$4F,$4E,$47,$5F,$4D,$49,$4E,$3A,$20,$30,$78,$25,$30,$38
+	.byte	$6C,$78,$3D,$25,$6C,$64,$0A,$00
+S0016:
+	.byte	$4C,$4F,$4E,$47,$5F,$4D,$49,$4E,$3A,$20,$20,$30,$78,$25,$30,$38
+	.byte	$6C,$78,$3D,$25,$6C,$64,$0A,$00
+S000C:
+	.byte	$53,$4C,$4F,$4E,$47,$5F,$4D,$41,$58,$3A,$20,$30,$78,$25,$30,$38
+	.byte	$6C,$78,$3D,$25,$6C,$64,$0A,$00
+S000B:
+	.byte	$55,$4C,$4F,$4E,$47,$5F,$4D,$41,$58,$3A,$20,$30,$78,$25,$30,$38
+	.byte	$6C,$78,$3D,$25,$6C,$64,$0A,$00
+S000A:
+	.byte	$4C,$4F,$4E,$47,$5F,$4D,$41,$58,$3A,$20,$20,$30,$78,$25,$30,$38
+	.byte	$6C,$78,$3D,$25,$6C,$64,$0A,$00
+S0018:
+	.byte	$53,$4C,$4F,$4E,$47,$5F,$4D,$49,$4E,$3A,$20,$30,$78,$25,$30,$38
+	.byte	$6C,$78,$3D,$25,$6C,$64,$0A,$00
+S0008:
+	.byte	$55,$49,$4E,$54,$5F,$4D,$41,$58,$3A,$20,$20,$30,$78,$25,$30,$38
+	.byte	$78,$3D,$25,$64,$0A,$00
+S0009:
+	.byte	$53,$49,$4E,$54,$5F,$4D,$41,$58,$3A,$20,$20,$30,$78,$25,$30,$38
+	.byte	$78,$3D,$25,$64,$0A,$00
+S0006:
+	.byte	$53,$53,$48,$52,$54,$5F,$4D,$41,$58,$3A,$20,$30,$78,$25,$30,$38
+	.byte	$78,$3D,$25,$64,$0A,$00
+S0005:
+	.byte	$55,$53,$48,$52,$54,$5F,$4D,$41,$58,$3A,$20,$30,$78,$25,$30,$38
+	.byte	$78,$3D,$25,$64,$0A,$00
+S0004:
+	.byte	$53,$48,$52,$54,$5F,$4D,$41,$58,$3A,$20,$20,$30,$78,$25,$30,$38
+	.byte	$78,$3D,$25,$64,$0A,$00
+S000D:
+	.byte	$43,$48,$41,$52,$5F,$4D,$49,$4E,$3A,$20,$20,$30,$78,$25,$30,$38
+	.byte	$78,$3D,$25,$64,$0A,$00
+S000E:
+	.byte	$55,$43,$48,$41,$52,$5F,$4D,$49,$4E,$3A,$20,$30,$78,$25,$30,$38
+	.byte	$78,$3D,$25,$64,$0A,$00
+S000F:
+	.byte	$53,$43,$48,$41,$52,$5F,$4D,$49,$4E,$3A,$20,$30,$78,$25,$30,$38
+	.byte	$78,$3D,$25,$64,$0A,$00
+S0010:
+	.byte	$53,$48,$52,$54,$5F,$4D,$49,$4E,$3A,$20,$20,$30,$78,$25,$30,$38
+	.byte	$78,$3D,$25,$64,$0A,$00
+S0011:
+	.byte	$55,$53,$48,$52,$54,$5F,$4D,$49,$4E,$3A,$20,$30,$78,$25,$30,$38
+	.byte	$78,$3D,$25,$64,$0A,$00
+S0012:
+	.byte	$53,$53,$48,$52,$54,$5F,$4D,$49,$4E,$3A,$20,$30,$78,$25,$30,$38
+	.byte	$78,$3D,$25,$64,$0A,$00
+S0013:
+	.byte	$49,$4E,$54,$5F,$4D,$49,$4E,$3A,$20,$20,$20,$30,$78,$25,$30,$38
+	.byte	$78,$3D,$25,$64,$0A,$00
+S0014:
+	.byte	$55,$49,$4E,$54,$5F,$4D,$49,$4E,$3A,$20,$20,$30,$78,$25,$30,$38
+	.byte	$78,$3D,$25,$64,$0A,$00
+S0015:
+	.byte	$53,$49,$4E,$54,$5F,$4D,$49,$4E,$3A,$20,$20,$30,$78,$25,$30,$38
+	.byte	$78,$3D,$25,$64,$0A,$00
+S0003:
+	.byte	$53,$43,$48,$41,$52,$5F,$4D,$41,$58,$3A,$20,$30,$78,$25,$30,$38
+	.byte	$78,$3D,$25,$64,$0A,$00
+S0002:
+	.byte	$55,$43,$48,$41,$52,$5F,$4D,$41,$58,$3A,$20,$30,$78,$25,$30,$38
+	.byte	$78,$3D,$25,$64,$0A,$00
+S0007:
+	.byte	$49,$4E,$54,$5F,$4D,$41,$58,$3A,$20,$20,$20,$30,$78,$25,$30,$38
+	.byte	$78,$3D,$25,$64,$0A,$00
+S0001:
+	.byte	$43,$48,$41,$52,$5F,$4D,$41,$58,$3A,$20,$20,$30,$78,$25,$30,$38
+	.byte	$78,$3D,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "limits.c", 23
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$FF
+	jsr     pushax
+	ldx     #$00
+	lda     #$FF
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "limits.c", 24
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldx     #$00
+	lda     #$FF
+	jsr     pushax
+	ldx     #$00
+	lda     #$FF
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "limits.c", 25
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldx     #$00
+	lda     #$7F
+	jsr     pushax
+	ldx     #$00
+	lda     #$7F
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "limits.c", 27
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldx     #$7F
+	lda     #$FF
+	jsr     pushax
+	ldx     #$7F
+	lda     #$FF
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "limits.c", 28
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldx     #$FF
+	lda     #$FF
+	jsr     pushax
+	ldx     #$FF
+	lda     #$FF
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "limits.c", 29
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldx     #$7F
+	lda     #$FF
+	jsr     pushax
+	ldx     #$7F
+	lda     #$FF
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "limits.c", 31
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldx     #$7F
+	lda     #$FF
+	jsr     pushax
+	ldx     #$7F
+	lda     #$FF
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "limits.c", 32
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldx     #$FF
+	lda     #$FF
+	jsr     pushax
+	ldx     #$FF
+	lda     #$FF
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "limits.c", 33
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldx     #$7F
+	lda     #$FF
+	jsr     pushax
+	ldx     #$7F
+	lda     #$FF
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "limits.c", 35
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldx     #$FF
+	stx     sreg
+	lda     #$7F
+	sta     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	lda     #$7F
+	sta     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	.dbg	line, "limits.c", 36
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	.dbg	line, "limits.c", 37
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	ldx     #$FF
+	stx     sreg
+	lda     #$7F
+	sta     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	lda     #$7F
+	sta     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	.dbg	line, "limits.c", 39
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "limits.c", 40
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "limits.c", 41
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	ldx     #$FF
+	lda     #$80
+	jsr     pushax
+	ldx     #$FF
+	lda     #$80
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "limits.c", 43
+	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	ldx     #$80
+	lda     #$00
+	jsr     pushax
+	ldx     #$80
+	lda     #$00
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "limits.c", 44
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "limits.c", 45
+	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	ldx     #$80
+	lda     #$00
+	jsr     pushax
+	ldx     #$80
+	lda     #$00
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "limits.c", 47
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	ldx     #$80
+	lda     #$00
+	jsr     pushax
+	ldx     #$80
+	lda     #$00
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "limits.c", 48
+	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "limits.c", 49
+	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+	ldx     #$80
+	lda     #$00
+	jsr     pushax
+	ldx     #$80
+	lda     #$00
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "limits.c", 51
+	lda     #<(S0016)
+	ldx     #>(S0016)
+	jsr     pushax
+	ldx     #$00
+	stx     sreg
+	lda     #$80
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$80
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	.dbg	line, "limits.c", 52
+	lda     #<(S0017)
+	ldx     #>(S0017)
+	jsr     pushax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	.dbg	line, "limits.c", 53
+	lda     #<(S0018)
+	ldx     #>(S0018)
+	jsr     pushax
+	ldx     #$00
+	stx     sreg
+	lda     #$80
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$80
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	.dbg	line, "limits.c", 55
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "limits.c", 56
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,518 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.export		__FRAMES__
+	.import		_printf
+	.import		_twice
+	.import		_scale
+	.import		_fact
+	.import		_is_odd
+	.import		_apply
+	.import		_outer
+	.export		_mid
+	.export		_is_even
+	.export		_main
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$25,$73,$3A,$20,$67,$6F,$74,$20,$25,$64,$2C,$20,$65,$78,$70,$65
+	.byte	$63,$74,$65,$64,$20,$25,$64,$0A,$00
+S000C:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+S0006:
+	.byte	$73,$75,$6D,$33,$20,$6E,$65,$73,$74,$65,$64,$00
+S0008:
+	.byte	$69,$73,$5F,$65,$76,$65,$6E,$00
+S0009	:=	S0008+0
+S000A:
+	.byte	$61,$70,$70,$6C,$79,$00
+S0003:
+	.byte	$6C,$65,$61,$66,$32,$00
+S000B:
+	.byte	$6F,$75,$74,$65,$72,$00
+S0002:
+	.byte	$6C,$65,$61,$66,$31,$00
+S0005:
+	.byte	$73,$75,$6D,$33,$00
+S0007:
+	.byte	$66,$61,$63,$74,$00
+S0004:
+	.byte	$6D,$69,$64,$00
+
+.segment	"BSS"
+
+_failures:
+	.res	2,$00
+__FRAMES__:
+	.res	22,$00
+
+; ---------------------------------------------------------------
+; void __near__ check (int got, int expected, const char *what)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_check: near
+
+.segment	"CODE"
+
+	lda     M0002
+	ldx     M0002+1
+	cpx     M0001+1
+	bne     L0005
+	cmp     M0001
+	beq     L0002
+L0005:	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     M0003
+	ldx     M0003+1
+	jsr     pushax
+	lda     M0001
+	ldx     M0001+1
+	jsr     pushax
+	lda     M0002
+	ldx     M0002+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	inc     _failures
+	bne     L0002
+	inc     _failures+1
+L0002:	rts
+
+.segment	"DATA"
+
+M0001	:= __FRAMES__+16
+M0002	:= __FRAMES__+18
+M0003	:= __FRAMES__+20
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ leaf1 (int a, int b)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_leaf1: near
+
+.segment	"CODE"
+
+	lda     M0001
+	ldx     M0001+1
+	jsr     pushax
+	lda     M0002
+	ldx     M0002+1
+	jsr     tosmulax
+	sta     M0003
+	stx     M0003+1
+	clc
+	adc     M0001
+	pha
+	txa
+	adc     M0001+1
+	tax
+	pla
+	rts
+
+.segment	"DATA"
+
+M0001	:= __FRAMES__+0
+M0002	:= __FRAMES__+2
+M0003	:= __FRAMES__+4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ leaf2 (int a, int b)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_leaf2: near
+
+.segment	"CODE"
+
+	lda     M0001
+	sec
+	sbc     M0002
+	pha
+	lda     M0001+1
+	sbc     M0002+1
+	tax
+	pla
+	sta     M0003
+	stx     M0003+1
+	jmp     aslax1
+
+.segment	"DATA"
+
+M0001	:= __FRAMES__+0
+M0002	:= __FRAMES__+2
+M0003	:= __FRAMES__+4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ mid (int a)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_mid: near
+
+.segment	"CODE"
+
+	lda     M0001
+	ldx     M0001+1
+	ldy     #$64
+	jsr     incaxy
+	sta     M0002
+	stx     M0002+1
+	lda     M0001+1
+	sta     __FRAMES__+1
+	lda     M0001
+	sta     __FRAMES__
+	ldx     #$00
+	lda     #$03
+	sta     __FRAMES__+2
+	stx     __FRAMES__+2+1
+	jsr     _leaf1
+	sta     M0003
+	stx     M0003+1
+	lda     M0001+1
+	sta     __FRAMES__+1
+	lda     M0001
+	sta     __FRAMES__
+	ldx     #$00
+	lda     #$01
+	sta     __FRAMES__+2
+	stx     __FRAMES__+2+1
+	jsr     _leaf2
+	clc
+	adc     M0003
+	sta     M0003
+	txa
+	adc     M0003+1
+	sta     M0003+1
+	lda     M0003
+	clc
+	adc     M0002
+	pha
+	lda     M0003+1
+	adc     M0002+1
+	tax
+	pla
+	rts
+
+.segment	"DATA"
+
+M0001	:= __FRAMES__+6
+M0002	:= __FRAMES__+8
+M0003	:= __FRAMES__+10
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ sum3 (int a, int b, int c)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_sum3: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	lda     #$64
+	jsr     tosmula0
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     mulax10
+	jsr     tosaddax
+	sta     ptr1
+	stx     ptr1+1
+	jsr     ldax0sp
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ is_even (unsigned int n)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_is_even: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$00
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	bne     L0005
+	tax
+	tya
+	jmp     L0001
+L0005:	jsr     ldax0sp
+	jsr     decax1
+	jsr     _is_odd
+L0001:	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ inc (int x)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_inc: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     ldax0sp
+	jsr     incax1
+	jsr     pushax
+	jsr     ldax0sp
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	lda     #$04
+	sta     __FRAMES__
+	stx     __FRAMES__+1
+	lda     #$05
+	sta     __FRAMES__+2
+	stx     __FRAMES__+2+1
+	jsr     _leaf1
+	sta     __FRAMES__+16
+	stx     __FRAMES__+16+1
+	ldx     #$00
+	lda     #$18
+	sta     __FRAMES__+18
+	stx     __FRAMES__+18+1
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	sta     __FRAMES__+20
+	stx     __FRAMES__+20+1
+	jsr     _check
+	ldx     #$00
+	lda     #$09
+	sta     __FRAMES__
+	stx     __FRAMES__+1
+	lda     #$04
+	sta     __FRAMES__+2
+	stx     __FRAMES__+2+1
+	jsr     _leaf2
+	sta     __FRAMES__+16
+	stx     __FRAMES__+16+1
+	ldx     #$00
+	lda     #$0A
+	sta     __FRAMES__+18
+	stx     __FRAMES__+18+1
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	sta     __FRAMES__+20
+	stx     __FRAMES__+20+1
+	jsr     _check
+	ldx     #$00
+	lda     #$05
+	sta     __FRAMES__+6
+	stx     __FRAMES__+6+1
+	jsr     _mid
+	sta     __FRAMES__+16
+	stx     __FRAMES__+16+1
+	ldx     #$00
+	lda     #$85
+	sta     __FRAMES__+18
+	stx     __FRAMES__+18+1
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	sta     __FRAMES__+20
+	stx     __FRAMES__+20+1
+	jsr     _check
+	ldx     #$00
+	lda     #$02
+	sta     __FRAMES__
+	stx     __FRAMES__+1
+	jsr     _twice
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	sta     __FRAMES__
+	stx     __FRAMES__+1
+	lda     #$02
+	sta     __FRAMES__+2
+	stx     __FRAMES__+2+1
+	jsr     _scale
+	jsr     pushax
+	ldx     #$00
+	lda     #$03
+	sta     __FRAMES__
+	stx     __FRAMES__+1
+	jsr     _twice
+	jsr     _sum3
+	sta     __FRAMES__+16
+	stx     __FRAMES__+16+1
+	ldx     #$02
+	lda     #$0E
+	sta     __FRAMES__+18
+	stx     __FRAMES__+18+1
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	sta     __FRAMES__+20
+	stx     __FRAMES__+20+1
+	jsr     _check
+	lda     #$01
+	jsr     pusha0
+	jsr     push0
+	lda     #$02
+	jsr     pusha0
+	lda     #$03
+	jsr     _sum3
+	jsr     pushax
+	ldx     #$00
+	txa
+	sta     __FRAMES__+6
+	sta     __FRAMES__+6+1
+	jsr     _mid
+	jsr     _sum3
+	sta     __FRAMES__+16
+	stx     __FRAMES__+16+1
+	ldx     #$01
+	lda     #$AC
+	sta     __FRAMES__+18
+	stx     __FRAMES__+18+1
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	sta     __FRAMES__+20
+	stx     __FRAMES__+20+1
+	jsr     _check
+	ldx     #$00
+	lda     #$07
+	jsr     _fact
+	sta     __FRAMES__+16
+	stx     __FRAMES__+16+1
+	ldx     #$13
+	lda     #$B0
+	sta     __FRAMES__+18
+	stx     __FRAMES__+18+1
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	sta     __FRAMES__+20
+	stx     __FRAMES__+20+1
+	jsr     _check
+	ldx     #$00
+	lda     #$0A
+	jsr     _is_even
+	sta     __FRAMES__+16
+	stx     __FRAMES__+16+1
+	ldx     #$00
+	lda     #$01
+	sta     __FRAMES__+18
+	stx     __FRAMES__+18+1
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	sta     __FRAMES__+20
+	stx     __FRAMES__+20+1
+	jsr     _check
+	ldx     #$00
+	lda     #$07
+	jsr     _is_even
+	sta     __FRAMES__+16
+	stx     __FRAMES__+16+1
+	lda     #$00
+	sta     __FRAMES__+18
+	sta     __FRAMES__+18+1
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	sta     __FRAMES__+20
+	stx     __FRAMES__+20+1
+	jsr     _check
+	lda     #>(_inc)
+	sta     __FRAMES__+1
+	lda     #<(_inc)
+	sta     __FRAMES__
+	ldx     #$00
+	lda     #$29
+	sta     __FRAMES__+2
+	stx     __FRAMES__+2+1
+	jsr     _apply
+	sta     __FRAMES__+16
+	stx     __FRAMES__+16+1
+	ldx     #$00
+	lda     #$2A
+	sta     __FRAMES__+18
+	stx     __FRAMES__+18+1
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	sta     __FRAMES__+20
+	stx     __FRAMES__+20+1
+	jsr     _check
+	ldx     #$00
+	lda     #$03
+	sta     __FRAMES__+12
+	stx     __FRAMES__+12+1
+	jsr     _outer
+	sta     __FRAMES__+16
+	stx     __FRAMES__+16+1
+	ldx     #$00
+	lda     #$37
+	sta     __FRAMES__+18
+	stx     __FRAMES__+18+1
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	sta     __FRAMES__+20
+	stx     __FRAMES__+20+1
+	jsr     _check
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	lda     _failures
+	ldx     _failures+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     _failures
+	ldx     _failures+1
+	rts
+
+.endproc
+
@@ -0,0 +1,256 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.import		__FRAMES__
+	.import		_mid
+	.import		_is_even
+	.export		_twice
+	.export		_scale
+	.export		_fact
+	.export		_is_odd
+	.export		_apply
+	.export		_outer
+
+; ---------------------------------------------------------------
+; int __near__ twice (int x)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_twice: near
+
+.segment	"CODE"
+
+	lda     M0001
+	ldx     M0001+1
+	sta     M0002
+	stx     M0002+1
+	clc
+	adc     M0002
+	pha
+	txa
+	adc     M0002+1
+	tax
+	pla
+	rts
+
+.segment	"DATA"
+
+M0001	:= __FRAMES__+0
+M0002	:= __FRAMES__+2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ scale (int x, int y)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_scale: near
+
+.segment	"CODE"
+
+	lda     M0001
+	ldx     M0001+1
+	jsr     mulax10
+	sta     M0003
+	stx     M0003+1
+	clc
+	adc     M0002
+	pha
+	txa
+	adc     M0002+1
+	tax
+	pla
+	rts
+
+.segment	"DATA"
+
+M0001	:= __FRAMES__+0
+M0002	:= __FRAMES__+2
+M0003	:= __FRAMES__+4
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ fact (unsigned int n)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fact: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp2
+	ldy     #$03
+	lda     (sp),y
+	cmp     #$00
+	bne     L0003
+	dey
+	lda     (sp),y
+	cmp     #$02
+L0003:	bcs     L0002
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+L0002:	ldy     #$03
+	jsr     ldaxysp
+	jsr     decax1
+	jsr     _fact
+	jsr     stax0sp
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosumulax
+L0001:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ is_odd (unsigned int n)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_is_odd: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$00
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	bne     L0005
+	tax
+	jmp     L0001
+L0005:	jsr     ldax0sp
+	jsr     decax1
+	jsr     _is_even
+L0001:	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ apply (int (*f)(int), int x)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_apply: near
+
+.segment	"CODE"
+
+	lda     M0002+1
+	sta     M0003+1
+	lda     M0002
+	sta     M0003
+	lda     M0001
+	ldx     M0001+1
+	jsr     pushax
+	lda     M0002
+	ldx     M0002+1
+	pha
+	ldy     #$00
+	lda     (sp),y
+	sta     jmpvec+1
+	iny
+	lda     (sp),y
+	sta     jmpvec+2
+	pla
+	jsr     jmpvec
+	jsr     incsp2
+	sta     M0004
+	stx     M0004+1
+	sta     ptr1
+	stx     ptr1+1
+	lda     M0003
+	sec
+	sbc     M0002
+	pha
+	lda     M0003+1
+	sbc     M0002+1
+	tax
+	pla
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	rts
+
+.segment	"DATA"
+
+M0001	:= __FRAMES__+0
+M0002	:= __FRAMES__+2
+M0003	:= __FRAMES__+4
+M0004	:= __FRAMES__+6
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ outer (int a)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_outer: near
+
+.segment	"CODE"
+
+	lda     M0001
+	ldx     M0001+1
+	sta     __FRAMES__
+	stx     __FRAMES__+1
+	jsr     _twice
+	sta     M0002
+	stx     M0002+1
+	lda     M0001
+	ldx     M0001+1
+	sta     __FRAMES__+6
+	stx     __FRAMES__+6+1
+	jsr     _mid
+	ldy     #$64
+	jsr     decaxy
+	clc
+	adc     M0002
+	sta     M0002
+	txa
+	adc     M0002+1
+	sta     M0002+1
+	lda     M0002
+	ldx     M0002+1
+	jsr     pushax
+	lda     M0001+1
+	sta     __FRAMES__+1
+	lda     M0001
+	sta     __FRAMES__
+	ldx     #$00
+	txa
+	sta     __FRAMES__+2
+	sta     __FRAMES__+2+1
+	jsr     _scale
+	jmp     tosaddax
+
+.segment	"DATA"
+
+M0001	:= __FRAMES__+12
+M0002	:= __FRAMES__+14
+
+.endproc
+
@@ -0,0 +1,310 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "static-frames-2.c", 775, 1792437062
+	.dbg		sym, "mid", "00", extern, "_mid"
+	.dbg		sym, "is_even", "00", extern, "_is_even"
+	.import		__FRAMES__
+	.import		_mid
+	.import		_is_even
+	.export		_twice
+	.export		_scale
+	.export		_fact
+	.export		_is_odd
+	.export		_apply
+	.export		_outer
+
+; ---------------------------------------------------------------
+; int __near__ twice (int x)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_twice: near
+
+	.dbg	func, "twice", "00", extern, "_twice"
+
+.segment	"CODE"
+
+	.dbg	line, "static-frames-2.c", 12
+	lda     M0001
+	ldx     M0001+1
+	sta     M0002
+	stx     M0002+1
+	.dbg	line, "static-frames-2.c", 13
+	lda     M0002
+	ldx     M0002+1
+	jsr     pushax
+	lda     M0002
+	ldx     M0002+1
+	jsr     tosaddax
+	jmp     L0001
+	.dbg	line, "static-frames-2.c", 14
+L0001:	rts
+
+	.dbg	line
+.segment	"DATA"
+
+M0001	:= __FRAMES__+0
+M0002	:= __FRAMES__+2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ scale (int x, int y)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_scale: near
+
+	.dbg	func, "scale", "00", extern, "_scale"
+
+.segment	"CODE"
+
+	.dbg	line, "static-frames-2.c", 18
+	lda     M0001
+	ldx     M0001+1
+	jsr     mulax10
+	sta     M0003
+	stx     M0003+1
+	.dbg	line, "static-frames-2.c", 19
+	lda     M0003
+	ldx     M0003+1
+	jsr     pushax
+	lda     M0002
+	ldx     M0002+1
+	jsr     tosaddax
+	jmp     L0001
+	.dbg	line, "static-frames-2.c", 20
+L0001:	rts
+
+	.dbg	line
+.segment	"DATA"
+
+M0001	:= __FRAMES__+0
+M0002	:= __FRAMES__+2
+M0003	:= __FRAMES__+4
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ fact (unsigned int n)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fact: near
+
+	.dbg	func, "fact", "00", extern, "_fact"
+	.dbg	sym, "n", "00", auto, 0
+	.dbg	sym, "r", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "static-frames-2.c", 23
+	jsr     pushax
+	.dbg	line, "static-frames-2.c", 25
+	jsr     decsp2
+	ldy     #$03
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0003
+	cmp     #$02
+L0003:	jsr     boolult
+	jeq     L0002
+	.dbg	line, "static-frames-2.c", 26
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+	.dbg	line, "static-frames-2.c", 28
+L0002:	ldy     #$03
+	jsr     ldaxysp
+	jsr     decax1
+	jsr     _fact
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "static-frames-2.c", 29
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosumulax
+	jmp     L0001
+	.dbg	line, "static-frames-2.c", 30
+L0001:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ is_odd (unsigned int n)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_is_odd: near
+
+	.dbg	func, "is_odd", "00", extern, "_is_odd"
+	.dbg	sym, "n", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "static-frames-2.c", 33
+	jsr     pushax
+	.dbg	line, "static-frames-2.c", 34
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+L0002:	jsr     booleq
+	jeq     L0003
+	ldx     #$00
+	lda     #$00
+	jmp     L0004
+L0003:	ldy     #$01
+	jsr     ldaxysp
+	jsr     decax1
+	jsr     _is_even
+L0004:	jmp     L0001
+	.dbg	line, "static-frames-2.c", 35
+L0001:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ apply (int (*f)(int), int x)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_apply: near
+
+	.dbg	func, "apply", "00", extern, "_apply"
+
+.segment	"CODE"
+
+	.dbg	line, "static-frames-2.c", 39
+	lda     M0002
+	ldx     M0002+1
+	sta     M0003
+	stx     M0003+1
+	.dbg	line, "static-frames-2.c", 40
+	lda     M0001
+	ldx     M0001+1
+	jsr     pushax
+	lda     M0002
+	ldx     M0002+1
+	pha
+	ldy     #$00
+	lda     (sp),y
+	sta     jmpvec+1
+	iny
+	lda     (sp),y
+	sta     jmpvec+2
+	pla
+	jsr     jmpvec
+	jsr     incsp2
+	sta     M0004
+	stx     M0004+1
+	.dbg	line, "static-frames-2.c", 41
+	lda     M0004
+	ldx     M0004+1
+	jsr     pushax
+	lda     M0003
+	ldx     M0003+1
+	jsr     pushax
+	lda     M0002
+	ldx     M0002+1
+	jsr     tossubax
+	jsr     tosaddax
+	jmp     L0001
+	.dbg	line, "static-frames-2.c", 42
+L0001:	rts
+
+	.dbg	line
+.segment	"DATA"
+
+M0001	:= __FRAMES__+0
+M0002	:= __FRAMES__+2
+M0003	:= __FRAMES__+4
+M0004	:= __FRAMES__+6
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ outer (int a)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_outer: near
+
+	.dbg	func, "outer", "00", extern, "_outer"
+
+.segment	"CODE"
+
+	.dbg	line, "static-frames-2.c", 47
+	lda     M0001
+	ldx     M0001+1
+	sta     __FRAMES__
+	stx     __FRAMES__+1
+	jsr     _twice
+	sta     M0002
+	stx     M0002+1
+	.dbg	line, "static-frames-2.c", 48
+	lda     M0001
+	ldx     M0001+1
+	sta     __FRAMES__+6
+	stx     __FRAMES__+6+1
+	jsr     _mid
+	ldy     #$64
+	jsr     decaxy
+	clc
+	adc     M0002
+	sta     M0002
+	txa
+	adc     M0002+1
+	sta     M0002+1
+	tax
+	lda     M0002
+	.dbg	line, "static-frames-2.c", 49
+	lda     M0002
+	ldx     M0002+1
+	jsr     pushax
+	lda     M0001
+	ldx     M0001+1
+	sta     __FRAMES__
+	stx     __FRAMES__+1
+	ldx     #$00
+	lda     #$00
+	sta     __FRAMES__+2
+	stx     __FRAMES__+2+1
+	jsr     _scale
+	jsr     tosaddax
+	jmp     L0001
+	.dbg	line, "static-frames-2.c", 50
+L0001:	rts
+
+	.dbg	line
+.segment	"DATA"
+
+M0001	:= __FRAMES__+12
+M0002	:= __FRAMES__+14
+
+.endproc
+
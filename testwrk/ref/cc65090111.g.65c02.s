@@ -0,0 +1,106 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "cc65090111.c", 645, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/stdint.h", 6196, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_test
+	.export		_main
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$69,$74,$20,$77,$6F,$72,$6B,$73,$20,$3A,$29,$0A,$00
+
+; ---------------------------------------------------------------
+; int __near__ test (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test: near
+
+	.dbg	func, "test", "00", extern, "_test"
+
+.segment	"CODE"
+
+	.dbg	line, "cc65090111.c", 39
+	ldx     #$00
+	lda     #$00
+	sta     M0001
+	jmp     L0002
+	.dbg	line, "cc65090111.c", 41
+L0005:	ldx     #$00
+	lda     M0002
+	ina
+	bne     L0006
+	inx
+L0006:	ldx     #$00
+	sta     M0002
+	.dbg	line, "cc65090111.c", 39
+	ldx     #$00
+	inc     M0001
+	lda     M0001
+	jmp     L0002
+L0002:	ldx     #$00
+	lda     M0001
+	cmp     #$10
+	jsr     boolult
+	jne     L0005
+	.dbg	line, "cc65090111.c", 43
+L0003:	jmp     L0003
+	.dbg	line, "cc65090111.c", 44
+	rts
+
+	.dbg	line
+.segment	"DATA"
+
+M0001:
+	.byte	$00
+M0002:
+	.byte	$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "cc65090111.c", 48
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cc65090111.c", 50
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "cc65090111.c", 51
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,146 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "cc65090726.c", 931, 1613073744
+	.dbg		file, "common.h", 522, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/stdlib.h", 5999, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_Proc3
+	.export		_Proc1
+	.export		_main
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$69,$74,$20,$77,$6F,$72,$6B,$73,$20,$3A,$29,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ Proc3 (struct Record **PtrParOut)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_Proc3: near
+
+	.dbg	func, "Proc3", "00", extern, "_Proc3"
+	.dbg	sym, "PtrParOut", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "cc65090726.c", 19
+	jsr     pushax
+	.dbg	line, "cc65090726.c", 21
+	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ Proc1 (struct Record *PtrParIn)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_Proc1: near
+
+	.dbg	func, "Proc1", "00", extern, "_Proc1"
+	.dbg	sym, "PtrParIn", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "cc65090726.c", 24
+	jsr     pushax
+	.dbg	line, "cc65090726.c", 26
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     _Proc3
+	.dbg	line, "cc65090726.c", 27
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     _Proc3
+	.dbg	line, "cc65090726.c", 28
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     _Proc3
+	.dbg	line, "cc65090726.c", 31
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     _Proc3
+	.dbg	line, "cc65090726.c", 32
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     _Proc3
+	.dbg	line, "cc65090726.c", 33
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     _Proc3
+	.dbg	line, "cc65090726.c", 41
+	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "cc65090726.c", 45
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cc65090726.c", 47
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "cc65090726.c", 48
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,171 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_block
+	.export		_calculate_checksum
+	.export		_main
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$30,$2E,$2E,$32,$35,$35,$3A,$20,$25,$75,$0A,$00
+S0001:
+	.byte	$7A,$65,$72,$6F,$65,$73,$3A,$20,$25,$75,$0A,$00
+
+.segment	"BSS"
+
+_block:
+	.res	256,$00
+
+; ---------------------------------------------------------------
+; unsigned int __near__ calculate_checksum (unsigned char *block)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_calculate_checksum: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp2
+	ldx     #$FF
+	txa
+	jsr     pushax
+	jsr     decsp1
+	inx
+	txa
+	ldy     #$03
+	jsr     staxysp
+	bra     L0002
+L0005:	ldy     #$04
+	jsr     ldaxysp
+	clc
+	ldy     #$05
+	adc     (sp),y
+	sta     ptr1
+	txa
+	iny
+	adc     (sp),y
+	sta     ptr1+1
+	lda     (ptr1)
+	tax
+	ldy     #$01
+	lda     (sp),y
+	pha
+	txa
+	iny
+	eor     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	lda     #$00
+	bra     L000C
+L0009:	ldy     #$02
+	jsr     ldaxysp
+	txa
+	and     #$80
+	beq     L000A
+	ldy     #$02
+	jsr     ldaxysp
+	jsr     shlax1
+	eor     #$21
+	pha
+	txa
+	eor     #$10
+	tax
+	pla
+	bra     L000E
+L000A:	ldy     #$02
+	jsr     ldaxysp
+	jsr     shlax1
+L000E:	ldy     #$01
+	jsr     staxysp
+	clc
+	lda     #$01
+	adc     (sp)
+L000C:	sta     (sp)
+	cmp     #$08
+	bcc     L0009
+	ldy     #$03
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L0002:	ldy     #$04
+	jsr     ldaxysp
+	cpx     #$01
+	bcc     L0005
+	ldy     #$02
+	jsr     ldaxysp
+	jsr     complax
+	jmp     incsp7
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     #<(_block)
+	ldx     #>(_block)
+	jsr     _calculate_checksum
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	txa
+	jsr     stax0sp
+	bra     L0002
+L0005:	lda     #<(_block)
+	clc
+	adc     (sp)
+	sta     ptr1
+	lda     #>(_block)
+	ldy     #$01
+	adc     (sp),y
+	sta     ptr1+1
+	lda     (sp)
+	sta     (ptr1)
+	ldx     #$00
+	tya
+	jsr     addeq0sp
+L0002:	jsr     ldax0sp
+	cpx     #$01
+	bcc     L0005
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     #<(_block)
+	ldx     #>(_block)
+	jsr     _calculate_checksum
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	txa
+	jmp     incsp2
+
+.endproc
+
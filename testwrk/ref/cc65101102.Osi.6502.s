@@ -0,0 +1,197 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_block
+	.export		_calculate_checksum
+	.export		_main
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$30,$2E,$2E,$32,$35,$35,$3A,$20,$25,$75,$0A,$00
+S0001:
+	.byte	$7A,$65,$72,$6F,$65,$73,$3A,$20,$25,$75,$0A,$00
+
+.segment	"BSS"
+
+_block:
+	.res	256,$00
+
+; ---------------------------------------------------------------
+; unsigned int __near__ calculate_checksum (unsigned char *block)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_calculate_checksum: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp2
+	ldx     #$FF
+	txa
+	jsr     pushax
+	jsr     decsp1
+	ldy     #$03
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L000E
+L0005:	ldy     #$05
+	lda     (sp),y
+	clc
+	ldy     #$03
+	adc     (sp),y
+	sta     ptr1
+	ldy     #$06
+	lda     (sp),y
+	ldy     #$04
+	adc     (sp),y
+	sta     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	tax
+	iny
+	lda     (sp),y
+	pha
+	txa
+	iny
+	eor     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	lda     #$00
+	tay
+	jmp     L000C
+L0009:	ldy     #$02
+	lda     (sp),y
+	tax
+	dey
+	txa
+	and     #$80
+	beq     L000A
+	iny
+	lda     (sp),y
+	sta     tmp1
+	dey
+	lda     (sp),y
+	asl     a
+	rol     tmp1
+	eor     #$21
+	pha
+	lda     tmp1
+	eor     #$10
+	tax
+	pla
+	jmp     L000F
+L000A:	iny
+	lda     (sp),y
+	sta     tmp1
+	dey
+	lda     (sp),y
+	asl     a
+	rol     tmp1
+	ldx     tmp1
+L000F:	jsr     staxysp
+	ldy     #$00
+	clc
+	lda     #$01
+	adc     (sp),y
+L000C:	sta     (sp),y
+	cmp     #$08
+	bcc     L0009
+	ldy     #$03
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$04
+L000E:	lda     (sp),y
+	tax
+	dey
+	cpx     #$01
+	jcc     L0005
+	dey
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     complax
+	jmp     incsp7
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     #<(_block)
+	ldx     #>(_block)
+	jsr     _calculate_checksum
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldy     #$00
+	tya
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L0006
+L0005:	lda     #<(_block)
+	ldy     #$00
+	clc
+	adc     (sp),y
+	sta     ptr1
+	lda     #>(_block)
+	iny
+	adc     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     (ptr1),y
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	ldy     #$01
+L0006:	lda     (sp),y
+	tax
+	cpx     #$01
+	bcc     L0005
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     #<(_block)
+	ldx     #>(_block)
+	jsr     _calculate_checksum
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	txa
+	jmp     incsp2
+
+.endproc
+
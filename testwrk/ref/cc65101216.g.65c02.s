@@ -0,0 +1,81 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "cc65101216.c", 347, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_a
+	.export		_main
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$61,$20,$2F,$20,$62,$20,$3D,$20,$25,$64,$00
+
+.segment	"BSS"
+
+_a:
+	.res	1,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+	.dbg	sym, "c", "00", auto, -1
+
+.segment	"CODE"
+
+	.dbg	line, "cc65101216.c", 22
+	jsr     decsp1
+	ldx     #$00
+	lda     #$64
+	sta     _a
+	.dbg	line, "cc65101216.c", 23
+	ldx     #$00
+	lda     _a
+	jsr     pushax
+	ldx     #$27
+	lda     #$10
+	jsr     tosdivax
+	ldx     #$00
+	ldy     #$00
+	sta     (sp),y
+	.dbg	line, "cc65101216.c", 24
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cc65101216.c", 26
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "cc65101216.c", 27
+L0001:	jsr     incsp1
+	rts
+
+	.dbg	line
+.endproc
+
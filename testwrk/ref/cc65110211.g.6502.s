@@ -0,0 +1,275 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "cc65110211.c", 1048, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_test1
+	.export		_test2
+	.export		_test3
+	.export		_main
+
+.segment	"DATA"
+
+_upper:
+	.byte	$41,$42,$43,$44,$45,$46,$47,$48,$49,$4A,$4B,$4C,$4D,$4E,$4F,$50
+	.byte	$51,$52,$53,$54,$55,$56,$57,$58,$59,$5A,$00
+
+.segment	"RODATA"
+
+S0005:
+	.byte	$69,$74,$20,$77,$6F,$72,$6B,$73,$20,$3A,$29,$0A,$00
+S0004:
+	.byte	$74,$65,$73,$74,$33,$3A,$6F,$6B,$0A,$00
+S0003:
+	.byte	$74,$65,$73,$74,$32,$3A,$6F,$6B,$0A,$00
+S0002:
+	.byte	$74,$65,$73,$74,$31,$3A,$6F,$6B,$0A,$00
+
+; ---------------------------------------------------------------
+; int __near__ test1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test1: near
+
+	.dbg	func, "test1", "00", extern, "_test1"
+	.dbg	sym, "res", "00", auto, -2
+	.dbg	sym, "p", "00", auto, -4
+
+.segment	"CODE"
+
+	.dbg	line, "cc65110211.c", 23
+	jsr     decsp4
+	lda     #<(_upper)
+	ldx     #>(_upper)
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "cc65110211.c", 24
+	ldx     #$00
+	lda     #$00
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "cc65110211.c", 26
+	jmp     L0004
+	.dbg	line, "cc65110211.c", 27
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	jmp     L0005
+	.dbg	line, "cc65110211.c", 28
+	ldx     #$00
+	lda     #$01
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "cc65110211.c", 30
+L0005:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	.dbg	line, "cc65110211.c", 26
+L0004:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	jne     L0002
+	.dbg	line, "cc65110211.c", 33
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cc65110211.c", 34
+	ldy     #$03
+	jsr     ldaxysp
+	jmp     L0001
+	.dbg	line, "cc65110211.c", 35
+L0001:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test2: near
+
+	.dbg	func, "test2", "00", extern, "_test2"
+	.dbg	sym, "res", "00", auto, -2
+	.dbg	sym, "p", "00", auto, -4
+
+.segment	"CODE"
+
+	.dbg	line, "cc65110211.c", 42
+	jsr     decsp4
+	lda     #<(_upper)
+	ldx     #>(_upper)
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "cc65110211.c", 43
+	ldx     #$00
+	lda     #$00
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "cc65110211.c", 45
+	jmp     L0005
+	.dbg	line, "cc65110211.c", 46
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0005
+	.dbg	line, "cc65110211.c", 47
+	ldx     #$00
+	lda     #$01
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "cc65110211.c", 45
+L0005:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	jne     L0002
+	.dbg	line, "cc65110211.c", 51
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cc65110211.c", 52
+	ldy     #$03
+	jsr     ldaxysp
+	jmp     L0001
+	.dbg	line, "cc65110211.c", 53
+L0001:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test3 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test3: near
+
+	.dbg	func, "test3", "00", extern, "_test3"
+	.dbg	sym, "res", "00", auto, -2
+	.dbg	sym, "p", "00", auto, -4
+
+.segment	"CODE"
+
+	.dbg	line, "cc65110211.c", 60
+	jsr     decsp4
+	lda     #<(_upper)
+	ldx     #>(_upper)
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "cc65110211.c", 61
+	ldx     #$00
+	lda     #$00
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "cc65110211.c", 63
+	jmp     L0005
+	.dbg	line, "cc65110211.c", 64
+L0002:	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$00
+	jsr     ldauidx
+	jmp     L0005
+	.dbg	line, "cc65110211.c", 65
+	ldx     #$00
+	lda     #$01
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "cc65110211.c", 63
+L0005:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	jne     L0002
+	.dbg	line, "cc65110211.c", 69
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cc65110211.c", 70
+	ldy     #$03
+	jsr     ldaxysp
+	jmp     L0001
+	.dbg	line, "cc65110211.c", 71
+L0001:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+	.dbg	sym, "n", "00", auto, 2
+	.dbg	sym, "args", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "cc65110211.c", 75
+	jsr     _test1
+	.dbg	line, "cc65110211.c", 76
+	jsr     _test2
+	.dbg	line, "cc65110211.c", 77
+	jsr     _test3
+	.dbg	line, "cc65110211.c", 79
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cc65110211.c", 81
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "cc65110211.c", 82
+L0001:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
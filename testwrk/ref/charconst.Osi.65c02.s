@@ -0,0 +1,135 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.import		_isprint
+	.export		_backslash
+	.export		_testbackslash
+	.export		_main
+
+.segment	"RODATA"
+
+S0003:
+	.byte	$66,$61,$69,$6C,$65,$64,$2E,$0A,$00
+S0001:
+	.byte	$25,$63,$20,$3A,$20,$00
+S0002:
+	.byte	$6F,$6B,$2E,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ backslash (unsigned char c)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_backslash: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$02
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     (sp)
+	cmp     #$72
+	bcs     L000A
+	cmp     #$62
+	beq     L000E
+	cmp     #$66
+	beq     L000F
+	cmp     #$6E
+	beq     L0010
+	bra     L0015
+L000A:	beq     L0011
+	cmp     #$74
+	beq     L0012
+	cmp     #$76
+	beq     L0013
+	bra     L0015
+L000E:	lda     #$08
+	sta     (sp)
+L000F:	lda     #$0C
+	sta     (sp)
+L0010:	lda     #$0A
+	sta     (sp)
+L0011:	lda     #$0D
+	sta     (sp)
+L0012:	lda     #$09
+	sta     (sp)
+L0013:	lda     #$0B
+	sta     (sp)
+L0015:	lda     (sp)
+	jsr     _isprint
+	stx     tmp1
+	ora     tmp1
+	bne     L000B
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	bra     L0017
+L000B:	lda     #<(S0003)
+	ldx     #>(S0003)
+L0017:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ testbackslash (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_testbackslash: near
+
+.segment	"CODE"
+
+	lda     #$62
+	jsr     _backslash
+	lda     #$66
+	jsr     _backslash
+	lda     #$6E
+	jsr     _backslash
+	lda     #$72
+	jsr     _backslash
+	lda     #$74
+	jsr     _backslash
+	lda     #$76
+	jmp     _backslash
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     _testbackslash
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
@@ -0,0 +1,205 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "charconst.c", 964, 1613073744
+	.dbg		file, "common.h", 522, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/stdlib.h", 5999, 1613073744
+	.dbg		file, "/root/repo/include/limits.h", 3146, 1613073744
+	.dbg		file, "/root/repo/include/ctype.h", 4390, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.dbg		sym, "isprint", "00", extern, "_isprint"
+	.import		_printf
+	.import		_isprint
+	.export		_backslash
+	.export		_testbackslash
+	.export		_main
+
+.segment	"RODATA"
+
+S0003:
+	.byte	$66,$61,$69,$6C,$65,$64,$2E,$0A,$00
+S0001:
+	.byte	$25,$63,$20,$3A,$20,$00
+S0002:
+	.byte	$6F,$6B,$2E,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ backslash (unsigned char c)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_backslash: near
+
+	.dbg	func, "backslash", "00", extern, "_backslash"
+	.dbg	sym, "c", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "charconst.c", 12
+	jsr     pusha
+	.dbg	line, "charconst.c", 13
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "charconst.c", 15
+	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	.dbg	line, "charconst.c", 16
+	jmp     L0002
+	.dbg	line, "charconst.c", 33
+L0002:	cmp     #$72
+	jcs     L000A
+	cmp     #$62
+	jeq     L0004
+	cmp     #$66
+	jeq     L0005
+	cmp     #$6E
+	jeq     L0006
+	jmp     L0003
+L000A:	jeq     L0007
+	cmp     #$74
+	jeq     L0008
+	cmp     #$76
+	jeq     L0009
+	jmp     L0003
+	.dbg	line, "charconst.c", 18
+L0004:	ldx     #$00
+	lda     #$08
+	ldy     #$00
+	sta     (sp),y
+	.dbg	line, "charconst.c", 20
+L0005:	ldx     #$00
+	lda     #$0C
+	ldy     #$00
+	sta     (sp),y
+	.dbg	line, "charconst.c", 22
+L0006:	ldx     #$00
+	lda     #$0A
+	ldy     #$00
+	sta     (sp),y
+	.dbg	line, "charconst.c", 24
+L0007:	ldx     #$00
+	lda     #$0D
+	ldy     #$00
+	sta     (sp),y
+	.dbg	line, "charconst.c", 26
+L0008:	ldx     #$00
+	lda     #$09
+	ldy     #$00
+	sta     (sp),y
+	.dbg	line, "charconst.c", 29
+L0009:	ldx     #$00
+	lda     #$0B
+	ldy     #$00
+	sta     (sp),y
+	.dbg	line, "charconst.c", 33
+	jmp     L0003
+	.dbg	line, "charconst.c", 35
+L0003:	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	jsr     _isprint
+	jsr     bnegax
+	jeq     L000B
+	.dbg	line, "charconst.c", 37
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "charconst.c", 39
+	jmp     L000C
+	.dbg	line, "charconst.c", 41
+L000B:	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "charconst.c", 43
+L000C:	jsr     incsp1
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ testbackslash (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_testbackslash: near
+
+	.dbg	func, "testbackslash", "00", extern, "_testbackslash"
+
+.segment	"CODE"
+
+	.dbg	line, "charconst.c", 47
+	lda     #$62
+	jsr     _backslash
+	.dbg	line, "charconst.c", 48
+	lda     #$66
+	jsr     _backslash
+	.dbg	line, "charconst.c", 49
+	lda     #$6E
+	jsr     _backslash
+	.dbg	line, "charconst.c", 50
+	lda     #$72
+	jsr     _backslash
+	.dbg	line, "charconst.c", 51
+	lda     #$74
+	jsr     _backslash
+	.dbg	line, "charconst.c", 52
+	lda     #$76
+	jsr     _backslash
+	.dbg	line, "charconst.c", 53
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "charconst.c", 57
+	jsr     _testbackslash
+	.dbg	line, "charconst.c", 59
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "charconst.c", 60
+L0001:	rts
+
+	.dbg	line
+.endproc
+
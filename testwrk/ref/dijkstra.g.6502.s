@@ -0,0 +1,1153 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "dijkstra.c", 8178, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/stdlib.h", 5999, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_Dijkstra_Init
+	.export		_Dijkstra_Search
+	.export		_Dijkstra_Path
+	.export		_Dijkstra_Table
+	.export		_Dijkstra_Distance
+	.export		_Dijkstra_Relax
+	.export		_Dijkstra_NextCheapest
+	.export		_Dijkstra_CountUnvisited
+	.export		_mynodes
+	.export		_myedges_A
+	.export		_myedges_B
+	.export		_myedges_C
+	.export		_myedges_D
+	.export		_myedges_E
+	.export		_myedges_F
+	.export		_myedges_G
+	.export		_myedges_H
+	.export		_myedges_I
+	.export		_myedges_J
+	.export		_myedges_K
+	.export		_myedges_L
+	.export		_mypoints
+	.export		_main
+
+.segment	"RODATA"
+
+_myedges_A:
+	.addr	_mynodes+8
+	.word	$0001
+	.word	$0000
+	.res	2,$00
+_myedges_B:
+	.addr	_mynodes
+	.word	$0001
+	.addr	_mynodes+16
+	.word	$0002
+	.addr	_mynodes+24
+	.word	$0001
+	.word	$0000
+	.res	2,$00
+_myedges_C:
+	.addr	_mynodes+8
+	.word	$0002
+	.addr	_mynodes+40
+	.word	$0001
+	.word	$0000
+	.res	2,$00
+_myedges_D:
+	.addr	_mynodes+8
+	.word	$0001
+	.addr	_mynodes+32
+	.word	$0001
+	.word	$0000
+	.res	2,$00
+_myedges_E:
+	.addr	_mynodes+48
+	.word	$0001
+	.word	$0000
+	.res	2,$00
+_myedges_F:
+	.addr	_mynodes+56
+	.word	$0001
+	.word	$0000
+	.res	2,$00
+_myedges_G:
+	.addr	_mynodes+64
+	.word	$0001
+	.addr	_mynodes+56
+	.word	$0004
+	.word	$0000
+	.res	2,$00
+_myedges_H:
+	.addr	_mynodes+72
+	.word	$0001
+	.addr	_mynodes+48
+	.word	$0004
+	.word	$0000
+	.res	2,$00
+_myedges_I:
+	.addr	_mynodes+80
+	.word	$0005
+	.word	$0000
+	.res	2,$00
+_myedges_J:
+	.addr	_mynodes+80
+	.word	$0001
+	.word	$0000
+	.res	2,$00
+_myedges_K:
+	.addr	_mynodes+88
+	.word	$0001
+	.word	$0000
+	.res	2,$00
+_myedges_L:
+	.addr	_mynodes+80
+	.word	$0001
+	.word	$0000
+	.res	2,$00
+_mypoints:
+	.addr	_myedges_A
+	.byte	$41
+	.res	5,$00
+	.addr	_myedges_B
+	.byte	$42
+	.res	5,$00
+	.addr	_myedges_C
+	.byte	$43
+	.res	5,$00
+	.addr	_myedges_D
+	.byte	$44
+	.res	5,$00
+	.addr	_myedges_E
+	.byte	$45
+	.res	5,$00
+	.addr	_myedges_F
+	.byte	$46
+	.res	5,$00
+	.addr	_myedges_G
+	.byte	$47
+	.res	5,$00
+	.addr	_myedges_H
+	.byte	$48
+	.res	5,$00
+	.addr	_myedges_I
+	.byte	$49
+	.res	5,$00
+	.addr	_myedges_J
+	.byte	$4A
+	.res	5,$00
+	.addr	_myedges_K
+	.byte	$4B
+	.res	5,$00
+	.addr	_myedges_L
+	.byte	$4C
+	.res	5,$00
+	.word	$0000
+	.res	6,$00
+S0002:
+	.byte	$6E,$65,$78,$74,$20,$63,$68,$65,$61,$70,$65,$73,$74,$20,$4E,$6F
+	.byte	$64,$65,$3A,$20,$3E,$25,$63,$3C,$0A,$00
+S0003:
+	.byte	$50,$61,$74,$68,$20,$66,$72,$6F,$6D,$20,$3E,$25,$63,$3C,$20,$74
+	.byte	$6F,$20,$3E,$25,$63,$3C,$20,$3A,$20,$00
+S0006:
+	.byte	$2D,$2D,$2D,$2D,$2D,$2D,$2D,$2D,$2D,$2D,$2D,$2D,$2D,$2D,$2D,$2D
+	.byte	$2D,$2D,$2D,$2D,$2D,$2D,$0A,$00
+S0016	:=	S0006+0
+S0001:
+	.byte	$72,$65,$6C,$61,$78,$20,$3E,$25,$63,$3C,$20,$74,$6F,$20,$3E,$25
+	.byte	$63,$3C,$0A,$00
+S0012:
+	.byte	$50,$72,$65,$76,$69,$6F,$75,$73,$7C,$00
+S000A:
+	.byte	$4D,$69,$6E,$44,$69,$73,$74,$20,$7C,$00
+S0007:
+	.byte	$4E,$6F,$64,$65,$20,$20,$20,$20,$7C,$00
+S000D:
+	.byte	$46,$6C,$61,$67,$20,$20,$20,$20,$7C,$00
+S0008:
+	.byte	$2D,$2D,$3E,$25,$63,$3C,$2D,$7C,$00
+S0014:
+	.byte	$20,$20,$28,$25,$63,$29,$20,$7C,$00
+S000F:
+	.byte	$6F,$70,$65,$6E,$65,$64,$7C,$00
+S0010:
+	.byte	$2D,$2D,$2D,$2D,$2D,$2D,$7C,$00
+S0013	:=	S0010+0
+S000E:
+	.byte	$63,$6C,$6F,$73,$65,$64,$7C,$00
+S000B:
+	.byte	$20,$25,$35,$75,$7C,$00
+S0004:
+	.byte	$3E,$25,$63,$3C,$20,$00
+S0005	:=	S0002+20
+S0011	:=	S0002+24
+S000C	:=	S0002+24
+S0009	:=	S0002+24
+S0015	:=	S0002+24
+
+.segment	"BSS"
+
+_mynodes:
+	.res	128,$00
+
+; ---------------------------------------------------------------
+; void __near__ Dijkstra_Init (const struct _DIJKSTRA_NODE *graph, struct _DIJKSTRA_NODE *start, struct _DIJKSTRA_NODE *nodes)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_Dijkstra_Init: near
+
+	.dbg	func, "Dijkstra_Init", "00", extern, "_Dijkstra_Init"
+	.dbg	sym, "graph", "00", auto, 4
+	.dbg	sym, "start", "00", auto, 2
+	.dbg	sym, "nodes", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "dijkstra.c", 138
+	jsr     pushax
+	.dbg	line, "dijkstra.c", 139
+	jmp     L0004
+	.dbg	line, "dijkstra.c", 140
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "dijkstra.c", 141
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     ldauidx
+	ldy     #$02
+	jsr     staspidx
+	.dbg	line, "dijkstra.c", 142
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	ldy     #$03
+	jsr     staspidx
+	.dbg	line, "dijkstra.c", 143
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldx     #$FF
+	lda     #$FF
+	ldy     #$04
+	jsr     staxspidx
+	.dbg	line, "dijkstra.c", 144
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	ldy     #$06
+	jsr     staxspidx
+	.dbg	line, "dijkstra.c", 146
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$04
+	ldx     #$00
+	lda     #$08
+	jsr     addeqysp
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	ldx     #$00
+	lda     #$08
+	jsr     addeqysp
+	.dbg	line, "dijkstra.c", 139
+L0004:	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0005
+	cmp     #$00
+L0005:	jsr     boolne
+	jne     L0002
+	.dbg	line, "dijkstra.c", 153
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	ldy     #$04
+	jsr     staxspidx
+	.dbg	line, "dijkstra.c", 154
+	jsr     incsp6
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ Dijkstra_Search (struct _DIJKSTRA_NODE *graph)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_Dijkstra_Search: near
+
+	.dbg	func, "Dijkstra_Search", "00", extern, "_Dijkstra_Search"
+	.dbg	sym, "graph", "00", auto, 0
+	.dbg	sym, "currnode", "00", auto, -2
+	.dbg	sym, "nextnode", "00", auto, -4
+	.dbg	sym, "edge", "00", auto, -6
+
+.segment	"CODE"
+
+	.dbg	line, "dijkstra.c", 253
+	jsr     pushax
+	.dbg	line, "dijkstra.c", 257
+	jsr     decsp6
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "dijkstra.c", 259
+	jmp     L0004
+	.dbg	line, "dijkstra.c", 260
+L0002:	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "dijkstra.c", 261
+	jmp     L0008
+	.dbg	line, "dijkstra.c", 262
+L0006:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "dijkstra.c", 263
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldauidx
+	cmp     #$02
+	jsr     boolne
+	jeq     L000A
+	.dbg	line, "dijkstra.c", 267
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _Dijkstra_Relax
+	.dbg	line, "dijkstra.c", 269
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _Dijkstra_Table
+	.dbg	line, "dijkstra.c", 272
+L000A:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	ldx     #$00
+	lda     #$04
+	jsr     addeqysp
+	.dbg	line, "dijkstra.c", 261
+L0008:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0009
+	cmp     #$00
+L0009:	jsr     boolne
+	jne     L0006
+	.dbg	line, "dijkstra.c", 274
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _Dijkstra_NextCheapest
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "dijkstra.c", 275
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	ldy     #$03
+	jsr     staspidx
+	.dbg	line, "dijkstra.c", 259
+L0004:	ldy     #$07
+	jsr     ldaxysp
+	jsr     _Dijkstra_CountUnvisited
+	cpx     #$00
+	bne     L0005
+	cmp     #$00
+L0005:	jsr     boolne
+	jne     L0002
+	.dbg	line, "dijkstra.c", 277
+	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ Dijkstra_Path (struct _DIJKSTRA_NODE *graph, struct _DIJKSTRA_NODE *end)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_Dijkstra_Path: near
+
+	.dbg	func, "Dijkstra_Path", "00", extern, "_Dijkstra_Path"
+	.dbg	sym, "graph", "00", auto, 2
+	.dbg	sym, "end", "00", auto, 0
+	.dbg	sym, "currnode", "00", auto, -2
+	.dbg	sym, "nextnode", "00", auto, -4
+
+.segment	"CODE"
+
+	.dbg	line, "dijkstra.c", 283
+	jsr     pushax
+	.dbg	line, "dijkstra.c", 286
+	jsr     decsp4
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     ldauidx
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     ldauidx
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "dijkstra.c", 288
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "dijkstra.c", 290
+	jmp     L0004
+	.dbg	line, "dijkstra.c", 291
+L0002:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     ldauidx
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "dijkstra.c", 292
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$07
+	jsr     ldaxidx
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "dijkstra.c", 290
+L0004:	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$07
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0005
+	cmp     #$00
+L0005:	jsr     boolne
+	jne     L0002
+	.dbg	line, "dijkstra.c", 295
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     ldauidx
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "dijkstra.c", 296
+	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ Dijkstra_Table (struct _DIJKSTRA_NODE *graph, struct _DIJKSTRA_NODE *current)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_Dijkstra_Table: near
+
+	.dbg	func, "Dijkstra_Table", "00", extern, "_Dijkstra_Table"
+	.dbg	sym, "graph", "00", auto, 2
+	.dbg	sym, "current", "00", auto, 0
+	.dbg	sym, "g", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "dijkstra.c", 302
+	jsr     pushax
+	.dbg	line, "dijkstra.c", 305
+	jsr     decsp2
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "dijkstra.c", 307
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "dijkstra.c", 308
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     staxysp
+	jmp     L0004
+	.dbg	line, "dijkstra.c", 309
+L0002:	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     ldauidx
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "dijkstra.c", 310
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	ldx     #$00
+	lda     #$08
+	jsr     addeqysp
+	.dbg	line, "dijkstra.c", 308
+L0004:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0005
+	cmp     #$00
+L0005:	jsr     boolne
+	jne     L0002
+	.dbg	line, "dijkstra.c", 312
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "dijkstra.c", 314
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "dijkstra.c", 315
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     staxysp
+	jmp     L0008
+	.dbg	line, "dijkstra.c", 316
+L0006:	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$05
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "dijkstra.c", 317
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	ldx     #$00
+	lda     #$08
+	jsr     addeqysp
+	.dbg	line, "dijkstra.c", 315
+L0008:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0009
+	cmp     #$00
+L0009:	jsr     boolne
+	jne     L0006
+	.dbg	line, "dijkstra.c", 319
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "dijkstra.c", 321
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "dijkstra.c", 322
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     staxysp
+	jmp     L000C
+	.dbg	line, "dijkstra.c", 323
+L000A:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldauidx
+	jmp     L000E
+	.dbg	line, "dijkstra.c", 339
+L000E:	cmp     #$02
+	jeq     L0010
+	jmp     L0011
+	.dbg	line, "dijkstra.c", 330
+L0010:	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "dijkstra.c", 331
+	jmp     L000F
+	.dbg	line, "dijkstra.c", 333
+L0011:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$05
+	jsr     ldaxidx
+	cpx     #$FF
+	bne     L0013
+	cmp     #$FF
+L0013:	jsr     boolne
+	jeq     L0012
+	.dbg	line, "dijkstra.c", 334
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "dijkstra.c", 335
+	jmp     L0014
+	.dbg	line, "dijkstra.c", 336
+L0012:	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "dijkstra.c", 338
+L0014:	jmp     L000F
+	.dbg	line, "dijkstra.c", 340
+L000F:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	ldx     #$00
+	lda     #$08
+	jsr     addeqysp
+	.dbg	line, "dijkstra.c", 322
+L000C:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L000D
+	cmp     #$00
+L000D:	jsr     boolne
+	jne     L000A
+	.dbg	line, "dijkstra.c", 342
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "dijkstra.c", 344
+	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "dijkstra.c", 345
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     staxysp
+	jmp     L0017
+	.dbg	line, "dijkstra.c", 346
+L0015:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$07
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L001A
+	cmp     #$00
+L001A:	jsr     booleq
+	jeq     L0019
+	.dbg	line, "dijkstra.c", 347
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "dijkstra.c", 348
+	jmp     L001B
+	.dbg	line, "dijkstra.c", 349
+L0019:	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$07
+	jsr     ldaxidx
+	ldy     #$02
+	jsr     ldauidx
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "dijkstra.c", 350
+L001B:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	ldx     #$00
+	lda     #$08
+	jsr     addeqysp
+	.dbg	line, "dijkstra.c", 345
+L0017:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0018
+	cmp     #$00
+L0018:	jsr     boolne
+	jne     L0015
+	.dbg	line, "dijkstra.c", 352
+	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "dijkstra.c", 354
+	lda     #<(S0016)
+	ldx     #>(S0016)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "dijkstra.c", 355
+	jsr     incsp6
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned short __near__ Dijkstra_Distance (struct _DIJKSTRA_NODE *currnode, struct _DIJKSTRA_NODE *nextnode)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_Dijkstra_Distance: near
+
+	.dbg	func, "Dijkstra_Distance", "00", extern, "_Dijkstra_Distance"
+	.dbg	sym, "currnode", "00", auto, 2
+	.dbg	sym, "nextnode", "00", auto, 0
+	.dbg	sym, "edge", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "dijkstra.c", 160
+	jsr     pushax
+	.dbg	line, "dijkstra.c", 163
+	jsr     decsp2
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "dijkstra.c", 165
+	jmp     L0004
+	.dbg	line, "dijkstra.c", 166
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     toseqax
+	jeq     L0006
+	.dbg	line, "dijkstra.c", 167
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldaxidx
+	jmp     L0001
+	.dbg	line, "dijkstra.c", 170
+L0006:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	ldx     #$00
+	lda     #$04
+	jsr     addeqysp
+	.dbg	line, "dijkstra.c", 165
+L0004:	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0005
+	cmp     #$00
+L0005:	jsr     boolne
+	jne     L0002
+	.dbg	line, "dijkstra.c", 174
+	ldx     #$FF
+	lda     #$FF
+	jmp     L0001
+	.dbg	line, "dijkstra.c", 175
+L0001:	jsr     incsp6
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ Dijkstra_Relax (struct _DIJKSTRA_NODE *currnode, struct _DIJKSTRA_NODE *nextnode)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_Dijkstra_Relax: near
+
+	.dbg	func, "Dijkstra_Relax", "00", extern, "_Dijkstra_Relax"
+	.dbg	sym, "currnode", "00", auto, 2
+	.dbg	sym, "nextnode", "00", auto, 0
+	.dbg	sym, "newdist", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "dijkstra.c", 181
+	jsr     pushax
+	.dbg	line, "dijkstra.c", 185
+	jsr     decsp2
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     ldauidx
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     ldauidx
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "dijkstra.c", 188
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$05
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _Dijkstra_Distance
+	jsr     tosaddax
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "dijkstra.c", 190
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$05
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosugtax
+	jeq     L0002
+	.dbg	line, "dijkstra.c", 191
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$04
+	jsr     staxspidx
+	.dbg	line, "dijkstra.c", 192
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$06
+	jsr     staxspidx
+	.dbg	line, "dijkstra.c", 195
+L0002:	jsr     incsp6
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; struct _DIJKSTRA_NODE *__near__ Dijkstra_NextCheapest (struct _DIJKSTRA_NODE *graph)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_Dijkstra_NextCheapest: near
+
+	.dbg	func, "Dijkstra_NextCheapest", "00", extern, "_Dijkstra_NextCheapest"
+	.dbg	sym, "graph", "00", auto, 0
+	.dbg	sym, "mindist", "00", auto, -2
+	.dbg	sym, "node", "00", auto, -4
+
+.segment	"CODE"
+
+	.dbg	line, "dijkstra.c", 202
+	jsr     pushax
+	.dbg	line, "dijkstra.c", 206
+	jsr     decsp4
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "dijkstra.c", 207
+	ldx     #$FF
+	lda     #$FF
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "dijkstra.c", 209
+	jmp     L0004
+	.dbg	line, "dijkstra.c", 210
+L0002:	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldauidx
+	cmp     #$02
+	jsr     boolne
+	jeq     L0007
+	.dbg	line, "dijkstra.c", 211
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$05
+	jsr     ldaxidx
+	jsr     tosultax
+	jsr     bnegax
+	jeq     L0007
+	.dbg	line, "dijkstra.c", 212
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$05
+	jsr     ldaxidx
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "dijkstra.c", 213
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "dijkstra.c", 217
+L0007:	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$04
+	ldx     #$00
+	lda     #$08
+	jsr     addeqysp
+	.dbg	line, "dijkstra.c", 209
+L0004:	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0005
+	cmp     #$00
+L0005:	jsr     boolne
+	jne     L0002
+	.dbg	line, "dijkstra.c", 222
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0009
+	cmp     #$00
+L0009:	jsr     boolne
+	jeq     L0008
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     ldauidx
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "dijkstra.c", 225
+L0008:	ldy     #$01
+	jsr     ldaxysp
+	jmp     L0001
+	.dbg	line, "dijkstra.c", 226
+L0001:	jsr     incsp6
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned short __near__ Dijkstra_CountUnvisited (struct _DIJKSTRA_NODE *graph)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_Dijkstra_CountUnvisited: near
+
+	.dbg	func, "Dijkstra_CountUnvisited", "00", extern, "_Dijkstra_CountUnvisited"
+	.dbg	sym, "graph", "00", auto, 0
+	.dbg	sym, "num", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "dijkstra.c", 232
+	jsr     pushax
+	.dbg	line, "dijkstra.c", 235
+	jsr     decsp2
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "dijkstra.c", 237
+	jmp     L0004
+	.dbg	line, "dijkstra.c", 238
+L0002:	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldauidx
+	cmp     #$02
+	jsr     boolne
+	jeq     L0006
+	.dbg	line, "dijkstra.c", 239
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	.dbg	line, "dijkstra.c", 242
+L0006:	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$02
+	ldx     #$00
+	lda     #$08
+	jsr     addeqysp
+	.dbg	line, "dijkstra.c", 237
+L0004:	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0005
+	cmp     #$00
+L0005:	jsr     boolne
+	jne     L0002
+	.dbg	line, "dijkstra.c", 246
+	ldy     #$01
+	jsr     ldaxysp
+	jmp     L0001
+	.dbg	line, "dijkstra.c", 247
+L0001:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "dijkstra.c", 360
+	lda     #<(_mypoints)
+	ldx     #>(_mypoints)
+	jsr     pushax
+	lda     #<(_mynodes)
+	ldx     #>(_mynodes)
+	jsr     pushax
+	lda     #<(_mynodes)
+	ldx     #>(_mynodes)
+	jsr     _Dijkstra_Init
+	.dbg	line, "dijkstra.c", 362
+	lda     #<(_mynodes)
+	ldx     #>(_mynodes)
+	jsr     _Dijkstra_Search
+	.dbg	line, "dijkstra.c", 364
+	lda     #<(_mynodes)
+	ldx     #>(_mynodes)
+	jsr     pushax
+	lda     #<(_mynodes+88)
+	ldx     #>(_mynodes+88)
+	jsr     _Dijkstra_Table
+	.dbg	line, "dijkstra.c", 366
+	lda     #<(_mynodes)
+	ldx     #>(_mynodes)
+	jsr     pushax
+	lda     #<(_mynodes+88)
+	ldx     #>(_mynodes+88)
+	jsr     _Dijkstra_Path
+	.dbg	line, "dijkstra.c", 368
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "dijkstra.c", 369
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,417 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "divmod.c", 816, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_printc
+	.export		_prints
+	.export		_printl
+	.export		_main
+
+.segment	"RODATA"
+
+S0003:
+	.byte	$25,$33,$6C,$64,$2C,$25,$33,$6C,$64,$20,$69,$73,$20,$25,$33,$6C
+	.byte	$64,$2C,$25,$33,$6C,$64,$2C,$25,$33,$6C,$64,$0A,$00
+S0002:
+	.byte	$25,$33,$64,$2C,$25,$33,$64,$20,$69,$73,$20,$25,$33,$64,$2C,$25
+	.byte	$33,$64,$2C,$25,$33,$64,$0A,$00
+S0001	:=	S0002+0
+S0005:
+	.byte	$2D,$0A,$00
+S0004	:=	S0005+0
+
+; ---------------------------------------------------------------
+; void __near__ printc (signed char a, signed char b)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_printc: near
+
+	.dbg	func, "printc", "00", extern, "_printc"
+	.dbg	sym, "a", "00", auto, 1
+	.dbg	sym, "b", "00", auto, 0
+	.dbg	sym, "x", "00", auto, -1
+	.dbg	sym, "y", "00", auto, -2
+	.dbg	sym, "z", "00", auto, -3
+
+.segment	"CODE"
+
+	.dbg	line, "divmod.c", 9
+	jsr     pusha
+	.dbg	line, "divmod.c", 10
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0002
+	dex
+L0002:	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0003
+	dex
+L0003:	jsr     tosdivax
+	ldx     #$00
+	cmp     #$80
+	bcc     L0004
+	dex
+L0004:	jsr     pusha
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0005
+	dex
+L0005:	jsr     pushax
+	ldy     #$03
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0006
+	dex
+L0006:	jsr     tosmodax
+	ldx     #$00
+	cmp     #$80
+	bcc     L0007
+	dex
+L0007:	jsr     pusha
+	ldy     #$03
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0008
+	dex
+L0008:	jsr     pushax
+	ldy     #$04
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0009
+	dex
+L0009:	jsr     tosmulax
+	ldx     #$00
+	cmp     #$80
+	bcc     L000A
+	dex
+L000A:	jsr     pusha
+	.dbg	line, "divmod.c", 11
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$06
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000B
+	dex
+L000B:	jsr     pushax
+	ldy     #$07
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000C
+	dex
+L000C:	jsr     pushax
+	ldy     #$08
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000D
+	dex
+L000D:	jsr     pushax
+	ldy     #$09
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000E
+	dex
+L000E:	jsr     pushax
+	ldy     #$0A
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000F
+	dex
+L000F:	jsr     pushax
+	ldy     #$0C
+	jsr     _printf
+	.dbg	line, "divmod.c", 12
+	jsr     incsp5
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ prints (short a, short b)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_prints: near
+
+	.dbg	func, "prints", "00", extern, "_prints"
+	.dbg	sym, "a", "00", auto, 2
+	.dbg	sym, "b", "00", auto, 0
+	.dbg	sym, "x", "00", auto, -2
+	.dbg	sym, "y", "00", auto, -4
+	.dbg	sym, "z", "00", auto, -6
+
+.segment	"CODE"
+
+	.dbg	line, "divmod.c", 13
+	jsr     pushax
+	.dbg	line, "divmod.c", 14
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosmodax
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosmulax
+	jsr     pushax
+	.dbg	line, "divmod.c", 15
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0C
+	jsr     _printf
+	.dbg	line, "divmod.c", 16
+	ldy     #$0A
+	jsr     addysp
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ printl (long a, long b)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_printl: near
+
+	.dbg	func, "printl", "00", extern, "_printl"
+	.dbg	sym, "a", "00", auto, 4
+	.dbg	sym, "b", "00", auto, 0
+	.dbg	sym, "x", "00", auto, -4
+	.dbg	sym, "y", "00", auto, -8
+	.dbg	sym, "z", "00", auto, -12
+
+.segment	"CODE"
+
+	.dbg	line, "divmod.c", 17
+	jsr     pusheax
+	.dbg	line, "divmod.c", 18
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosmodeax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosmuleax
+	jsr     pusheax
+	.dbg	line, "divmod.c", 19
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$16
+	jsr     _printf
+	.dbg	line, "divmod.c", 20
+	ldy     #$14
+	jsr     addysp
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "divmod.c", 23
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$03
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FE
+	jsr     _printl
+	.dbg	line, "divmod.c", 24
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FD
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FE
+	jsr     _printl
+	.dbg	line, "divmod.c", 25
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FD
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	jsr     _printl
+	.dbg	line, "divmod.c", 26
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$03
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	jsr     _printl
+	.dbg	line, "divmod.c", 27
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "divmod.c", 28
+	ldx     #$00
+	lda     #$03
+	jsr     pushax
+	ldx     #$FF
+	lda     #$FE
+	jsr     _prints
+	.dbg	line, "divmod.c", 29
+	ldx     #$FF
+	lda     #$FD
+	jsr     pushax
+	ldx     #$FF
+	lda     #$FE
+	jsr     _prints
+	.dbg	line, "divmod.c", 30
+	ldx     #$FF
+	lda     #$FD
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     _prints
+	.dbg	line, "divmod.c", 31
+	ldx     #$00
+	lda     #$03
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     _prints
+	.dbg	line, "divmod.c", 32
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "divmod.c", 33
+	lda     #$03
+	jsr     pusha
+	lda     #$FE
+	jsr     _printc
+	.dbg	line, "divmod.c", 34
+	lda     #$FD
+	jsr     pusha
+	lda     #$FE
+	jsr     _printc
+	.dbg	line, "divmod.c", 35
+	lda     #$FD
+	jsr     pusha
+	lda     #$02
+	jsr     _printc
+	.dbg	line, "divmod.c", 36
+	lda     #$03
+	jsr     pusha
+	lda     #$02
+	jsr     _printc
+	.dbg	line, "divmod.c", 37
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "divmod.c", 38
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,173 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"RODATA"
+
+S0005:
+	.byte	$0A,$25,$73,$0A,$00
+S0003:
+	.byte	$25,$63,$25,$63,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	ldy     #$C8
+	jsr     subysp
+	ldy     #$00
+L0002:	lda     M0001,y
+	sta     (sp),y
+	iny
+	cpy     #$C8
+	bne     L0002
+	jsr     push0
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$02
+	bcc     L0004
+	inx
+L0004:	clc
+	adc     (sp)
+	sta     ptr1
+	txa
+	ldy     #$01
+	adc     (sp),y
+	sta     ptr1+1
+	lda     (sp)
+	clc
+	adc     #$41
+	sta     (ptr1)
+	ldy     #$64
+	jsr     subysp
+	bra     L0014
+L0007:	lda     M0004,y
+	sta     (sp),y
+	dey
+	bpl     L0007
+L0008:	ldy     #$40
+	lda     (sp),y
+	clc
+	adc     #$61
+	sta     (sp)
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$44
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$06
+	jsr     _printf
+	ldy     #$41
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cmp     #$15
+	txa
+	sbc     #$00
+	bvs     L000E
+	eor     #$80
+L000E:	asl     a
+	lda     #$00
+	rol     a
+	php
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	beq     L000D
+	ldy     #$40
+	jsr     addysp
+	bra     L000F
+L000D:	ldy     #$24
+	jsr     subysp
+	bra     L0014
+L0011:	lda     M000A,y
+	sta     (sp),y
+	dey
+	bpl     L0011
+L0014:	lda     #$31
+	sta     (sp)
+	ina
+	ldy     #$63
+	sta     (sp),y
+	ldy     #$24
+	jsr     addysp
+	bra     L0008
+L000F:	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$02
+	bcc     L0012
+	inx
+L0012:	clc
+	adc     (sp)
+	sta     ptr1
+	txa
+	ldy     #$01
+	adc     (sp),y
+	sta     ptr1+1
+	lda     #$0A
+	sta     (ptr1)
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$04
+	bcc     L0013
+	inx
+L0013:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	txa
+	ldy     #$CA
+	jmp     addysp
+
+.segment	"RODATA"
+
+M0001:
+	.byte	$78,$79,$7A,$00
+	.res	196,$00
+M0004:
+	.byte	$78,$78,$78,$00
+	.res	60,$00
+M0006:
+	.word	$0000
+M000A:
+	.byte	$61,$61,$61,$00
+	.res	96,$00
+M0003:
+	.word	$FF9C
+M0009:
+	.word	$FFDC
+M0008:
+	.word	$0040
+
+.endproc
+
@@ -0,0 +1,165 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"RODATA"
+
+S0005:
+	.byte	$0A,$25,$73,$0A,$00
+S0003:
+	.byte	$25,$63,$25,$63,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	ldy     #$C8
+	jsr     subysp
+	ldy     #$00
+L0002:	lda     M0001,y
+	sta     (sp),y
+	iny
+	cpy     #$C8
+	bne     L0002
+	jsr     push0
+	lda     #$02
+	jsr     leaa0sp
+	ldy     #$00
+	clc
+	adc     (sp),y
+	sta     ptr1
+	txa
+	iny
+	adc     (sp),y
+	sta     ptr1+1
+	jsr     ldax0sp
+	ldy     #$41
+	jsr     incaxy
+	ldy     #$00
+	sta     (ptr1),y
+	ldy     #$64
+	jsr     subysp
+	jmp     L000D
+L0005:	lda     M0004,y
+	sta     (sp),y
+	dey
+	bpl     L0005
+L0006:	ldy     #$41
+	jsr     ldaxysp
+	ldy     #$61
+	jsr     incaxy
+	ldy     #$00
+	sta     (sp),y
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$44
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$06
+	jsr     _printf
+	ldy     #$41
+	jsr     ldaxysp
+	cmp     #$15
+	txa
+	sbc     #$00
+	bvs     L0009
+	eor     #$80
+L0009:	asl     a
+	lda     #$00
+	rol     a
+	php
+	ldy     #$40
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	beq     L0008
+	ldy     #$40
+	jsr     addysp
+	jmp     L000A
+L0008:	ldy     #$24
+	jsr     subysp
+	jmp     L000D
+L000C:	lda     M000A,y
+	sta     (sp),y
+	dey
+	bpl     L000C
+L000D:	lda     #$31
+	ldy     #$00
+	sta     (sp),y
+	lda     #$32
+	ldy     #$63
+	sta     (sp),y
+	ldy     #$24
+	jsr     addysp
+	jmp     L0006
+L000A:	lda     #$02
+	jsr     leaa0sp
+	ldy     #$00
+	clc
+	adc     (sp),y
+	sta     ptr1
+	txa
+	iny
+	adc     (sp),y
+	sta     ptr1+1
+	lda     #$0A
+	dey
+	sta     (ptr1),y
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     #$04
+	jsr     leaa0sp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	txa
+	ldy     #$CA
+	jmp     addysp
+
+.segment	"RODATA"
+
+M0001:
+	.byte	$78,$79,$7A,$00
+	.res	196,$00
+M0004:
+	.byte	$78,$78,$78,$00
+	.res	60,$00
+M0006:
+	.word	$0000
+M000A:
+	.byte	$61,$61,$61,$00
+	.res	96,$00
+M0003:
+	.word	$FF9C
+M0009:
+	.word	$FFDC
+M0008:
+	.word	$0040
+
+.endproc
+
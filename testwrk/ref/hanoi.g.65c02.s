@@ -0,0 +1,278 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "hanoi.c", 2320, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/stdlib.h", 5999, 1613073744
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_iter
+	.export		_num
+	.export		_cnt
+	.export		_disk
+	.export		_duration
+	.export		_mov
+	.export		_main
+
+.segment	"DATA"
+
+_iter:
+	.word	$0000
+_disk:
+	.word	$0005
+_duration:
+	.word	$000A
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$74,$6F,$77,$65,$72,$73,$20,$6F,$66,$20,$68,$61,$6E,$6F,$69,$0A
+	.byte	$64,$69,$73,$6B,$73,$3A,$20,$25,$64,$0A,$0A,$00
+S0003:
+	.byte	$25,$32,$64,$3A,$20,$25,$32,$64,$20,$25,$32,$64,$20,$25,$32,$64
+	.byte	$20,$25,$32,$64,$0A,$00
+S0001	:=	S0003+0
+
+.segment	"BSS"
+
+_num:
+	.res	4,$00
+_cnt:
+	.res	4,$00
+
+; ---------------------------------------------------------------
+; void __near__ mov (unsigned char n, unsigned char f, unsigned char t)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_mov: near
+
+	.dbg	func, "mov", "00", extern, "_mov"
+	.dbg	sym, "n", "00", auto, 2
+	.dbg	sym, "f", "00", auto, 1
+	.dbg	sym, "t", "00", auto, 0
+	.dbg	sym, "o", "00", auto, -1
+
+.segment	"CODE"
+
+	.dbg	line, "hanoi.c", 38
+	jsr     pusha
+	.dbg	line, "hanoi.c", 41
+	jsr     decsp1
+	ldy     #$03
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$01
+	jsr     booleq
+	jeq     L0002
+	.dbg	line, "hanoi.c", 43
+	lda     #<(_num)
+	ldx     #>(_num)
+	ldy     #$02
+	clc
+	adc     (sp),y
+	bcc     L0003
+	inx
+L0003:	jsr     pushax
+	ldy     #$00
+	jsr     ldauidx
+	pha
+	dea
+	ldy     #$00
+	jsr     staspidx
+	pla
+	.dbg	line, "hanoi.c", 44
+	lda     #<(_num)
+	ldx     #>(_num)
+	ldy     #$01
+	clc
+	adc     (sp),y
+	bcc     L0004
+	inx
+L0004:	jsr     pushax
+	ldy     #$00
+	jsr     ldauidx
+	pha
+	ina
+	ldy     #$00
+	jsr     staspidx
+	pla
+	.dbg	line, "hanoi.c", 46
+	jmp     L0005
+	.dbg	line, "hanoi.c", 48
+L0002:	ldx     #$00
+	lda     #$06
+	jsr     pushax
+	ldy     #$04
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$05
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosaddax
+	jsr     tossubax
+	ldx     #$00
+	ldy     #$00
+	sta     (sp),y
+	.dbg	line, "hanoi.c", 49
+	ldy     #$03
+	ldx     #$00
+	lda     (sp),y
+	jsr     decax1
+	ldx     #$00
+	jsr     pusha
+	ldy     #$03
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$02
+	lda     (sp),y
+	jsr     _mov
+	.dbg	line, "hanoi.c", 50
+	lda     #$01
+	jsr     pusha
+	ldy     #$03
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$03
+	lda     (sp),y
+	jsr     _mov
+	.dbg	line, "hanoi.c", 51
+	ldy     #$03
+	ldx     #$00
+	lda     (sp),y
+	jsr     decax1
+	ldx     #$00
+	jsr     pusha
+	ldy     #$01
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$03
+	lda     (sp),y
+	jsr     _mov
+	.dbg	line, "hanoi.c", 55
+L0005:	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	.dbg	line, "hanoi.c", 56
+	lda     _iter
+	ldx     _iter+1
+	jsr     pushax
+	ldx     #$00
+	lda     _num
+	jsr     pushax
+	ldx     #$00
+	lda     _num+1
+	jsr     pushax
+	ldx     #$00
+	lda     _num+2
+	jsr     pushax
+	ldx     #$00
+	lda     _num+3
+	jsr     pushax
+	ldy     #$0C
+	jsr     _printf
+	.dbg	line, "hanoi.c", 58
+	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int argc, char **argv)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+	.dbg	sym, "argc", "00", auto, 2
+	.dbg	sym, "argv", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "hanoi.c", 74
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     _disk
+	ldx     _disk+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "hanoi.c", 76
+	ldx     #$00
+	lda     _disk
+	sta     _num+1
+	.dbg	line, "hanoi.c", 79
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	.dbg	line, "hanoi.c", 80
+	lda     _iter
+	ldx     _iter+1
+	jsr     pushax
+	ldx     #$00
+	lda     _num
+	jsr     pushax
+	ldx     #$00
+	lda     _num+1
+	jsr     pushax
+	ldx     #$00
+	lda     _num+2
+	jsr     pushax
+	ldx     #$00
+	lda     _num+3
+	jsr     pushax
+	ldy     #$0C
+	jsr     _printf
+	.dbg	line, "hanoi.c", 83
+	jmp     L0004
+	.dbg	line, "hanoi.c", 85
+L0002:	lda     _disk
+	jsr     pusha
+	lda     #$01
+	jsr     pusha
+	lda     #$03
+	jsr     _mov
+	.dbg	line, "hanoi.c", 86
+	inc     _iter
+	bne     L0005
+	inc     _iter+1
+L0005:	lda     _iter
+	ldx     _iter+1
+	.dbg	line, "hanoi.c", 83
+L0004:	ldx     #$00
+	lda     _num+3
+	jsr     pushax
+	lda     _disk
+	ldx     _disk+1
+	jsr     tosltax
+	jne     L0002
+	.dbg	line, "hanoi.c", 89
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "hanoi.c", 90
+L0001:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
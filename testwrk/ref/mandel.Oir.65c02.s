@@ -0,0 +1,356 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.import		_abs
+	.export		_dither
+	.export		_mandelbrot
+	.export		_main
+
+.segment	"DATA"
+
+_dither:
+	.byte	$20,$2E,$2A,$6F,$2B,$30,$25,$23
+
+.segment	"RODATA"
+
+S0003:
+	.byte	$25,$63,$00
+S0004:
+	.byte	$0A,$00
+S0002:
+	.byte	$20,$00
+
+.segment	"BSS"
+
+_SCREEN_X:
+	.res	2,$00
+_SCREEN_Y:
+	.res	1,$00
+
+; ---------------------------------------------------------------
+; void __near__ mandelbrot (short x1, short y1, short x2, short y2)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_mandelbrot: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+3
+	jsr     pushax
+	lda     regbank+0
+	ldx     regbank+1
+	jsr     pushax
+	ldy     #$0C
+	jsr     subysp
+	ldy     #$15
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	sec
+	ldy     #$18
+	sbc     (sp),y
+	pha
+	txa
+	iny
+	sbc     (sp),y
+	tax
+	pla
+	jsr     pushax
+	lda     _SCREEN_X
+	ldx     _SCREEN_X+1
+	jsr     tosudivax
+	ldy     #$09
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	sec
+	ldy     #$16
+	sbc     (sp),y
+	pha
+	txa
+	iny
+	sbc     (sp),y
+	tax
+	pla
+	jsr     pushax
+	lda     _SCREEN_Y
+	jsr     tosdiva0
+	ldy     #$07
+	jsr     staxysp
+	ldy     #$17
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$03
+	jsr     staxysp
+	lda     #$00
+	jmp     L001A
+L0005:	ldy     #$07
+	lda     (sp),y
+	ldy     #$03
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	ldy     #$04
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$19
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$05
+	jsr     staxysp
+	ldy     #$01
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L0020
+L0009:	ldy     #$09
+	lda     (sp),y
+	ldy     #$05
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$0A
+	lda     (sp),y
+	ldy     #$06
+	adc     (sp),y
+	sta     (sp),y
+	lda     #$00
+	stz     regbank+4
+	stz     regbank+4+1
+	stz     regbank+0
+	stz     regbank+0+1
+	ldy     #$0B
+	jmp     L001B
+L000D:	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     axlong
+	jsr     pusheax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     axlong
+	jsr     tosmuleax
+	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0013
+	dey
+L0013:	sty     sreg+1
+	jsr     asreax4
+	jsr     pusheax
+	lda     regbank+0
+	ldx     regbank+0+1
+	jsr     axlong
+	jsr     pusheax
+	lda     regbank+0
+	ldx     regbank+0+1
+	jsr     axlong
+	jsr     tosmuleax
+	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0014
+	dey
+L0014:	sty     sreg+1
+	jsr     asreax4
+	jsr     tossubeax
+	jsr     pusheax
+	ldy     #$0A
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     axlong
+	jsr     tosaddeax
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     axlong
+	jsr     pusheax
+	lda     regbank+0
+	ldx     regbank+0+1
+	jsr     axlong
+	jsr     tosmuleax
+	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0015
+	dey
+L0015:	sty     sreg+1
+	jsr     asreax3
+	jsr     pusheax
+	ldy     #$08
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     axlong
+	jsr     tosaddeax
+	sta     regbank+0
+	stx     regbank+0+1
+	lda     regbank+2+1
+	sta     regbank+4+1
+	lda     regbank+2
+	sta     regbank+4
+	ldy     #$0B
+	clc
+	lda     #$01
+	adc     (sp),y
+L001B:	sta     (sp),y
+	cmp     #$10
+	bcs     L0021
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     _abs
+	cmp     #$00
+	txa
+	sbc     #$20
+	bvc     L000F
+	eor     #$80
+L000F:	bpl     L0019
+	lda     regbank+0
+	ldx     regbank+0+1
+	jsr     _abs
+	cmp     #$00
+	txa
+	sbc     #$20
+	bvc     L0010
+	eor     #$80
+L0010:	jmi     L000D
+L0019:	ldy     #$0B
+L0021:	lda     (sp),y
+	cmp     #$10
+	bne     L0016
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$02
+	bra     L001C
+L0016:	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$0D
+	lda     (sp),y
+	and     #$07
+	sta     ptr1
+	clc
+	lda     #>(_dither)
+	sta     ptr1+1
+	ldy     #<(_dither)
+	lda     (ptr1),y
+	jsr     pusha0
+	ldy     #$04
+L001C:	jsr     _printf
+	ldy     #$01
+	ldx     #$00
+	tya
+	jsr     addeqysp
+L0020:	ldy     #$04
+	jsr     pushwysp
+	lda     _SCREEN_X
+	ldx     _SCREEN_X+1
+	jsr     tosicmp
+	jcc     L0009
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	clc
+	lda     #$01
+	adc     (sp)
+L001A:	sta     (sp)
+	cmp     _SCREEN_Y
+	jcc     L0005
+	ldy     #$11
+	ldx     #$05
+L0018:	lda     (sp),y
+	sta     regbank+0,x
+	dey
+	dex
+	bpl     L0018
+	ldy     #$1A
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #$50
+	sta     _SCREEN_X
+	stz     _SCREEN_X+1
+	lda     #$28
+	sta     _SCREEN_Y
+	jsr     decsp6
+	lda     #$00
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #$E0
+	sta     (sp),y
+	lda     #$00
+	ldy     #$02
+	sta     (sp),y
+	iny
+	lda     #$E0
+	sta     (sp),y
+	lda     #$00
+	sta     (sp)
+	ldy     #$01
+	lda     #$20
+	sta     (sp),y
+	tax
+	lda     #$00
+	jsr     _mandelbrot
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
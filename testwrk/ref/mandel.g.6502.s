@@ -0,0 +1,399 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "mandel.c", 2164, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/stdlib.h", 5999, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.dbg		sym, "abs", "00", extern, "_abs"
+	.import		_printf
+	.import		_abs
+	.export		_dither
+	.export		_mandelbrot
+	.export		_main
+
+.segment	"DATA"
+
+_dither:
+	.byte	$20,$2E,$2A,$6F,$2B,$30,$25,$23
+
+.segment	"RODATA"
+
+S0003:
+	.byte	$25,$63,$00
+S0004:
+	.byte	$0A,$00
+S0002:
+	.byte	$20,$00
+
+.segment	"BSS"
+
+_SCREEN_X:
+	.res	2,$00
+_SCREEN_Y:
+	.res	1,$00
+
+; ---------------------------------------------------------------
+; void __near__ mandelbrot (short x1, short y1, short x2, short y2)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_mandelbrot: near
+
+	.dbg	func, "mandelbrot", "00", extern, "_mandelbrot"
+	.dbg	sym, "x1", "00", auto, 6
+	.dbg	sym, "y1", "00", auto, 4
+	.dbg	sym, "x2", "00", auto, 2
+	.dbg	sym, "y2", "00", auto, 0
+	.dbg	sym, "r", "00", auto, -2
+	.dbg	sym, "r1", "00", auto, -4
+	.dbg	sym, "i", "00", auto, -6
+	.dbg	sym, "count", "00", auto, -7
+	.dbg	sym, "xs", "00", auto, -9
+	.dbg	sym, "ys", "00", auto, -11
+	.dbg	sym, "xx", "00", auto, -13
+	.dbg	sym, "yy", "00", auto, -15
+	.dbg	sym, "x", "00", auto, -17
+	.dbg	sym, "y", "00", auto, -18
+
+.segment	"CODE"
+
+	.dbg	line, "mandel.c", 30
+	jsr     pushax
+	.dbg	line, "mandel.c", 38
+	ldy     #$12
+	jsr     subysp
+	ldy     #$15
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tossubax
+	jsr     pushax
+	lda     _SCREEN_X
+	ldx     _SCREEN_X+1
+	jsr     tosudivax
+	ldy     #$09
+	jsr     staxysp
+	.dbg	line, "mandel.c", 39
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$19
+	jsr     ldaxysp
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     _SCREEN_Y
+	jsr     tosdivax
+	ldy     #$07
+	jsr     staxysp
+	.dbg	line, "mandel.c", 41
+	ldy     #$17
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     staxysp
+	.dbg	line, "mandel.c", 42
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	sta     (sp),y
+	jmp     L0002
+	.dbg	line, "mandel.c", 44
+L0005:	ldy     #$08
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     addeqysp
+	ldy     #$19
+	jsr     ldaxysp
+	ldy     #$05
+	jsr     staxysp
+	.dbg	line, "mandel.c", 45
+	ldx     #$00
+	lda     #$00
+	ldy     #$01
+	jsr     staxysp
+	jmp     L0006
+	.dbg	line, "mandel.c", 47
+L0009:	ldy     #$0A
+	jsr     ldaxysp
+	ldy     #$05
+	jsr     addeqysp
+	.dbg	line, "mandel.c", 49
+	ldx     #$00
+	lda     #$00
+	ldy     #$10
+	jsr     staxysp
+	ldx     #$00
+	lda     #$00
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "mandel.c", 50
+	ldx     #$00
+	lda     #$00
+	ldy     #$0B
+	sta     (sp),y
+	jmp     L000A
+	.dbg	line, "mandel.c", 55
+L000D:	ldy     #$11
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$15
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosmuleax
+	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0013
+	dey
+L0013:	sty     sreg+1
+	jsr     asreax4
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$15
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosmuleax
+	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0014
+	dey
+L0014:	sty     sreg+1
+	jsr     asreax4
+	jsr     tossubeax
+	jsr     pusheax
+	ldy     #$0A
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosaddeax
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "mandel.c", 57
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosmuleax
+	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0015
+	dey
+L0015:	sty     sreg+1
+	jsr     asreax3
+	jsr     pusheax
+	ldy     #$08
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosaddeax
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "mandel.c", 58
+	ldy     #$0F
+	jsr     ldaxysp
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "mandel.c", 53
+	ldy     #$0B
+	ldx     #$00
+	clc
+	lda     #$01
+	adc     (sp),y
+	sta     (sp),y
+	jmp     L000A
+	.dbg	line, "mandel.c", 50
+L000A:	ldy     #$0B
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$10
+	jsr     boolult
+	jeq     L000E
+	.dbg	line, "mandel.c", 51
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     _abs
+	cmp     #$00
+	txa
+	sbc     #$20
+	bvc     L000F
+	eor     #$80
+L000F:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L000E
+	.dbg	line, "mandel.c", 52
+	ldy     #$0D
+	jsr     ldaxysp
+	jsr     _abs
+	cmp     #$00
+	txa
+	sbc     #$20
+	bvc     L0010
+	eor     #$80
+L0010:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	.dbg	line, "mandel.c", 53
+	jne     L0011
+L000E:	ldx     #$00
+	lda     #$00
+	jeq     L0012
+L0011:	ldx     #$00
+	lda     #$01
+L0012:	jne     L000D
+	.dbg	line, "mandel.c", 60
+	ldy     #$0B
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$10
+	jsr     booleq
+	jeq     L0016
+	.dbg	line, "mandel.c", 62
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "mandel.c", 64
+	jmp     L0017
+	.dbg	line, "mandel.c", 66
+L0016:	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$0D
+	ldx     #$00
+	lda     (sp),y
+	ldx     #$00
+	and     #$07
+	clc
+	adc     #<(_dither)
+	tay
+	txa
+	adc     #>(_dither)
+	tax
+	tya
+	ldy     #$00
+	jsr     ldauidx
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "mandel.c", 45
+L0017:	ldy     #$01
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0006
+L0006:	ldy     #$02
+	jsr     ldaxysp
+	jsr     pushax
+	lda     _SCREEN_X
+	ldx     _SCREEN_X+1
+	jsr     tosultax
+	jne     L0009
+	.dbg	line, "mandel.c", 69
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "mandel.c", 42
+	ldy     #$00
+	ldx     #$00
+	clc
+	lda     #$01
+	adc     (sp),y
+	sta     (sp),y
+	jmp     L0002
+L0002:	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldx     #$00
+	lda     _SCREEN_Y
+	jsr     tosultax
+	jne     L0005
+	.dbg	line, "mandel.c", 71
+	ldy     #$1A
+	jsr     addysp
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "mandel.c", 75
+	ldx     #$00
+	lda     #$50
+	sta     _SCREEN_X
+	stx     _SCREEN_X+1
+	.dbg	line, "mandel.c", 76
+	ldx     #$00
+	lda     #$28
+	sta     _SCREEN_Y
+	.dbg	line, "mandel.c", 79
+	ldx     #$E0
+	lda     #$00
+	jsr     pushax
+	ldx     #$E0
+	lda     #$00
+	jsr     pushax
+	ldx     #$20
+	lda     #$00
+	jsr     pushax
+	ldx     #$20
+	lda     #$00
+	jsr     _mandelbrot
+	.dbg	line, "mandel.c", 82
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "mandel.c", 83
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,6883 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_s
+	.export		_t
+	.export		_flags
+	.export		_f
+	.export		_f0
+	.export		_f1
+	.export		_f2
+	.export		_f3
+	.export		_f4
+	.export		_f5
+	.export		_f0_B
+	.export		_f1_B
+	.export		_f2_B
+	.export		_f3_B
+	.export		_f4_B
+	.export		_f5_B
+	.export		_main
+
+.segment	"RODATA"
+
+S0089:
+	.byte	$66,$34,$5F,$42,$28,$25,$64,$2C,$20,$25,$64,$2C,$20,$25,$64,$2C
+	.byte	$20,$25,$64,$29,$0A,$00
+S007C:
+	.byte	$66,$33,$5F,$42,$28,$25,$64,$2C,$20,$25,$64,$2C,$20,$25,$64,$2C
+	.byte	$20,$25,$64,$29,$0A,$00
+S0096:
+	.byte	$66,$35,$5F,$42,$28,$25,$64,$2C,$20,$25,$64,$2C,$20,$25,$64,$2C
+	.byte	$20,$25,$64,$29,$0A,$00
+S0038:
+	.byte	$66,$34,$28,$25,$64,$2C,$20,$25,$64,$2C,$20,$25,$64,$2C,$20,$25
+	.byte	$64,$29,$0A,$00
+S0045:
+	.byte	$66,$35,$28,$25,$64,$2C,$20,$25,$64,$2C,$20,$25,$64,$2C,$20,$25
+	.byte	$64,$29,$0A,$00
+S002B:
+	.byte	$66,$33,$28,$25,$64,$2C,$20,$25,$64,$2C,$20,$25,$64,$2C,$20,$25
+	.byte	$64,$29,$0A,$00
+S0064:
+	.byte	$66,$31,$5F,$42,$28,$25,$64,$2C,$20,$25,$64,$2C,$20,$25,$64,$29
+	.byte	$0A,$00
+S0070:
+	.byte	$66,$32,$5F,$42,$28,$25,$64,$2C,$20,$25,$64,$2C,$20,$25,$64,$29
+	.byte	$0A,$00
+S0013:
+	.byte	$66,$31,$28,$25,$64,$2C,$20,$25,$64,$2C,$20,$25,$64,$29,$0A,$00
+S001F:
+	.byte	$66,$32,$28,$25,$64,$2C,$20,$25,$64,$2C,$20,$25,$64,$29,$0A,$00
+S000C:
+	.byte	$25,$33,$64,$20,$25,$32,$58,$3A,$20,$25,$64,$0A,$00
+S000D	:=	S000C+0
+S000E	:=	S000C+0
+S000F	:=	S000C+0
+S0010	:=	S000C+0
+S0011	:=	S000C+0
+S00A1	:=	S000C+0
+S000A	:=	S000C+0
+S0014	:=	S000C+0
+S0015	:=	S000C+0
+S0016	:=	S000C+0
+S0017	:=	S000C+0
+S0018	:=	S000C+0
+S0019	:=	S000C+0
+S001A	:=	S000C+0
+S001B	:=	S000C+0
+S001C	:=	S000C+0
+S001D	:=	S000C+0
+S00A0	:=	S000C+0
+S000B	:=	S000C+0
+S0020	:=	S000C+0
+S0021	:=	S000C+0
+S0022	:=	S000C+0
+S0023	:=	S000C+0
+S0024	:=	S000C+0
+S0025	:=	S000C+0
+S0026	:=	S000C+0
+S0027	:=	S000C+0
+S0028	:=	S000C+0
+S0029	:=	S000C+0
+S009F	:=	S000C+0
+S0008	:=	S000C+0
+S002C	:=	S000C+0
+S002D	:=	S000C+0
+S002E	:=	S000C+0
+S002F	:=	S000C+0
+S0030	:=	S000C+0
+S0031	:=	S000C+0
+S0032	:=	S000C+0
+S0033	:=	S000C+0
+S0034	:=	S000C+0
+S0035	:=	S000C+0
+S0036	:=	S000C+0
+S009E	:=	S000C+0
+S0007	:=	S000C+0
+S0039	:=	S000C+0
+S003A	:=	S000C+0
+S003B	:=	S000C+0
+S003C	:=	S000C+0
+S003D	:=	S000C+0
+S003E	:=	S000C+0
+S003F	:=	S000C+0
+S0040	:=	S000C+0
+S0041	:=	S000C+0
+S0042	:=	S000C+0
+S0043	:=	S000C+0
+S009D	:=	S000C+0
+S0006	:=	S000C+0
+S0046	:=	S000C+0
+S0047	:=	S000C+0
+S0048	:=	S000C+0
+S0049	:=	S000C+0
+S004A	:=	S000C+0
+S004B	:=	S000C+0
+S004C	:=	S000C+0
+S004D	:=	S000C+0
+S004E	:=	S000C+0
+S004F	:=	S000C+0
+S0050	:=	S000C+0
+S009C	:=	S000C+0
+S0097	:=	S000C+0
+S0053	:=	S000C+0
+S0054	:=	S000C+0
+S0055	:=	S000C+0
+S0056	:=	S000C+0
+S0057	:=	S000C+0
+S0058	:=	S000C+0
+S0059	:=	S000C+0
+S005A	:=	S000C+0
+S005B	:=	S000C+0
+S005C	:=	S000C+0
+S005D	:=	S000C+0
+S005E	:=	S000C+0
+S005F	:=	S000C+0
+S0060	:=	S000C+0
+S0061	:=	S000C+0
+S0062	:=	S000C+0
+S009B	:=	S000C+0
+S0005	:=	S000C+0
+S0065	:=	S000C+0
+S0066	:=	S000C+0
+S0067	:=	S000C+0
+S0068	:=	S000C+0
+S0069	:=	S000C+0
+S006A	:=	S000C+0
+S006B	:=	S000C+0
+S006C	:=	S000C+0
+S006D	:=	S000C+0
+S006E	:=	S000C+0
+S009A	:=	S000C+0
+S0009	:=	S000C+0
+S0071	:=	S000C+0
+S0072	:=	S000C+0
+S0073	:=	S000C+0
+S0074	:=	S000C+0
+S0075	:=	S000C+0
+S0076	:=	S000C+0
+S0077	:=	S000C+0
+S0078	:=	S000C+0
+S0079	:=	S000C+0
+S007A	:=	S000C+0
+S0099	:=	S000C+0
+S0003	:=	S000C+0
+S007D	:=	S000C+0
+S007E	:=	S000C+0
+S007F	:=	S000C+0
+S0080	:=	S000C+0
+S0081	:=	S000C+0
+S0082	:=	S000C+0
+S0083	:=	S000C+0
+S0084	:=	S000C+0
+S0085	:=	S000C+0
+S0086	:=	S000C+0
+S0087	:=	S000C+0
+S0098	:=	S000C+0
+S0002	:=	S000C+0
+S008A	:=	S000C+0
+S008B	:=	S000C+0
+S008C	:=	S000C+0
+S008D	:=	S000C+0
+S008E	:=	S000C+0
+S008F	:=	S000C+0
+S0090	:=	S000C+0
+S0091	:=	S000C+0
+S0092	:=	S000C+0
+S0093	:=	S000C+0
+S0094	:=	S000C+0
+S0004	:=	S000C+0
+S0052:
+	.byte	$66,$30,$5F,$42,$28,$29,$0A,$00
+S0001:
+	.byte	$66,$30,$28,$29,$0A,$00
+S0088	:=	S0089+20
+S007B	:=	S0089+20
+S006F	:=	S0089+20
+S0063	:=	S0089+20
+S0051	:=	S0089+20
+S0044	:=	S0089+20
+S0037	:=	S0089+20
+S002A	:=	S0089+20
+S001E	:=	S0089+20
+S0012	:=	S0089+20
+S00A2	:=	S0089+20
+S0095	:=	S0089+20
+
+.segment	"BSS"
+
+_s:
+	.res	2,$00
+_t:
+	.res	2,$00
+_flags:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; int __near__ f (int x)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+L0002:	jsr     boolne
+	sta     ptr1
+	ldy     _s
+	lda     ptr1
+	jsr     aslaxy
+	jsr     tosorax
+	sta     _flags
+	stx     _flags+1
+	inc     _s
+	bne     L0003
+	inc     _s+1
+L0003:	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ f0 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f0: near
+
+.segment	"CODE"
+
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	txa
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	lda     #$01
+	sta     _t
+	stz     _t+1
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldx     #$01
+	jsr     _f
+	stz     _t
+	stz     _t+1
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	jsr     _f
+	lda     #$01
+	sta     _t
+	stz     _t+1
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	stz     _t
+	stz     _t+1
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	lda     #$01
+	sta     _t
+	stz     _t+1
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	stz     _t
+	stz     _t+1
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	stz     _t
+	stz     _t+1
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	stz     _t
+	stz     _t+1
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	lda     #$01
+	sta     _t
+	stz     _t+1
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	stz     _t
+	stz     _t+1
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	stz     _t
+	stz     _t+1
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	stz     _t
+	stz     _t+1
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	lda     #$01
+	sta     _t
+	stz     _t+1
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	stz     _t
+	stz     _t+1
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	lda     #$01
+	sta     _t
+	stz     _t+1
+	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	lda     #$01
+	sta     _t
+	stz     _t+1
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	ldy     #$02
+	jmp     _printf
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ f1 (int a, int b, int c)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f1: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0005
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0005
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0006
+L0005:	bra     L0007
+L0006:	lda     #$01
+L0007:	sta     _t
+	stz     _t+1
+	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	jsr     _f
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L000B
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L000C
+L000B:	bra     L000D
+L000C:	lda     #$01
+L000D:	sta     _t
+	stz     _t+1
+	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0011
+	ldx     #$00
+	txa
+	jsr     _f
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0012
+L0011:	bra     L0013
+L0012:	lda     #$01
+L0013:	sta     _t
+	stz     _t+1
+	lda     #<(S0016)
+	ldx     #>(S0016)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0017
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0017
+	ldx     #$00
+	txa
+	jsr     _f
+	bra     L0018
+L0017:	bra     L0019
+L0018:	lda     #$01
+L0019:	sta     _t
+	stz     _t+1
+	lda     #<(S0017)
+	ldx     #>(S0017)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldx     #$01
+	jsr     _f
+	stz     _t
+	stz     _t+1
+	lda     #<(S0018)
+	ldx     #>(S0018)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0036
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+L0036:	stz     _t
+	stz     _t+1
+	lda     #<(S0019)
+	ldx     #>(S0019)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0037
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0037
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+L0037:	stz     _t
+	stz     _t+1
+	lda     #<(S001A)
+	ldx     #>(S001A)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0028
+	bra     L0029
+L0028:	lda     #$01
+L0029:	sta     _t
+	stz     _t+1
+	lda     #<(S001B)
+	ldx     #>(S001B)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L002D
+	ldx     #$00
+	txa
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	bra     L002E
+L002D:	bra     L002F
+L002E:	lda     #$01
+L002F:	sta     _t
+	stz     _t+1
+	lda     #<(S001C)
+	ldx     #>(S001C)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	jsr     _f
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0033
+	ldx     #$00
+	txa
+	jsr     _f
+	bra     L0034
+L0033:	bra     L0035
+L0034:	lda     #$01
+L0035:	sta     _t
+	stz     _t+1
+	lda     #<(S001D)
+	ldx     #>(S001D)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #<(S001E)
+	ldx     #>(S001E)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ f2 (int a, int b, int c)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f2: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     #<(S001F)
+	ldx     #>(S001F)
+	jsr     pushax
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0005
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0005
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0005
+	bra     L0006
+L0005:	lda     #$01
+L0006:	sta     _t
+	stz     _t+1
+	lda     #<(S0020)
+	ldx     #>(S0020)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	jsr     _f
+	lda     #$01
+	sta     _t
+	stz     _t+1
+	lda     #<(S0021)
+	ldx     #>(S0021)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L000D
+	tax
+	jsr     _f
+L000D:	lda     #$01
+	sta     _t
+	stz     _t+1
+	lda     #<(S0022)
+	ldx     #>(S0022)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0012
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0012
+	tax
+	jsr     _f
+L0012:	lda     #$01
+	sta     _t
+	stz     _t+1
+	lda     #<(S0023)
+	ldx     #>(S0023)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0017
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0017
+	bra     L0018
+L0017:	lda     #$01
+L0018:	sta     _t
+	stz     _t+1
+	lda     #<(S0024)
+	ldx     #>(S0024)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L001C
+	ldx     #$01
+	jsr     _f
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L001C
+	bra     L001D
+L001C:	lda     #$01
+L001D:	sta     _t
+	stz     _t+1
+	lda     #<(S0025)
+	ldx     #>(S0025)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0021
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0021
+	ldx     #$01
+	jsr     _f
+	lda     #$00
+	bra     L0022
+L0021:	lda     #$01
+L0022:	sta     _t
+	stz     _t+1
+	lda     #<(S0026)
+	ldx     #>(S0026)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0026
+	bra     L0027
+L0026:	lda     #$01
+L0027:	sta     _t
+	stz     _t+1
+	lda     #<(S0027)
+	ldx     #>(S0027)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L002B
+	ldx     #$01
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	lda     #$00
+	bra     L002C
+L002B:	lda     #$01
+L002C:	sta     _t
+	stz     _t+1
+	lda     #<(S0028)
+	ldx     #>(S0028)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0030
+	ldx     #$01
+	jsr     _f
+	lda     #$00
+	bra     L0031
+L0030:	lda     #$01
+L0031:	sta     _t
+	stz     _t+1
+	lda     #<(S0029)
+	ldx     #>(S0029)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #<(S002A)
+	ldx     #>(S002A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ f3 (int a, int b, int c, int d)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f3: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     #<(S002B)
+	ldx     #>(S002B)
+	jsr     pushax
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0A
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0005
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0006
+L0005:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0007
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0006
+L0007:	bra     L0008
+L0006:	lda     #$01
+L0008:	sta     _t
+	stz     _t+1
+	lda     #<(S002C)
+	ldx     #>(S002C)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	lda     #$01
+	sta     _t
+	stz     _t+1
+	lda     #<(S002D)
+	ldx     #>(S002D)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L000F
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0010
+L000F:	tax
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+L0010:	lda     #$01
+	sta     _t
+	stz     _t+1
+	lda     #<(S002E)
+	ldx     #>(S002E)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	jsr     _f
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0015
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0016
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0015
+L0016:	bra     L0017
+L0015:	lda     #$01
+L0017:	sta     _t
+	stz     _t+1
+	lda     #<(S002F)
+	ldx     #>(S002F)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L001B
+	ldx     #$00
+	txa
+	jsr     _f
+	bra     L001C
+L001B:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L001D
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L001C
+L001D:	bra     L001E
+L001C:	lda     #$01
+L001E:	sta     _t
+	stz     _t+1
+	lda     #<(S0030)
+	ldx     #>(S0030)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0022
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0023
+L0022:	tax
+	jsr     _f
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0023
+	bra     L0024
+L0023:	lda     #$01
+L0024:	sta     _t
+	stz     _t+1
+	lda     #<(S0031)
+	ldx     #>(S0031)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0028
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0029
+L0028:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L002A
+	ldx     #$00
+	txa
+	jsr     _f
+	bra     L0029
+L002A:	bra     L002B
+L0029:	lda     #$01
+L002B:	sta     _t
+	stz     _t+1
+	lda     #<(S0032)
+	ldx     #>(S0032)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L002F
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0030
+L002F:	bra     L0031
+L0030:	lda     #$01
+L0031:	sta     _t
+	stz     _t+1
+	lda     #<(S0033)
+	ldx     #>(S0033)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0035
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+L0035:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0036
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0037
+L0036:	bra     L0038
+L0037:	lda     #$01
+L0038:	sta     _t
+	stz     _t+1
+	lda     #<(S0034)
+	ldx     #>(S0034)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L003C
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L003D
+L003C:	ldx     #$01
+	jsr     _f
+	lda     #$00
+	bra     L003E
+L003D:	lda     #$01
+L003E:	sta     _t
+	stz     _t+1
+	lda     #<(S0035)
+	ldx     #>(S0035)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0042
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0043
+L0042:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0044
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+L0044:	lda     #$00
+	bra     L0045
+L0043:	lda     #$01
+L0045:	sta     _t
+	stz     _t+1
+	lda     #<(S0036)
+	ldx     #>(S0036)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #<(S0037)
+	ldx     #>(S0037)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ f4 (int a, int b, int c, int d)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f4: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     #<(S0038)
+	ldx     #>(S0038)
+	jsr     pushax
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0A
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0064
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L000A
+L0064:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0009
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L000A
+L0009:	bra     L000C
+L000A:	lda     #$01
+L000C:	sta     _t
+	stz     _t+1
+	lda     #<(S0039)
+	ldx     #>(S0039)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	lda     #$01
+	sta     _t
+	stz     _t+1
+	lda     #<(S003A)
+	ldx     #>(S003A)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0013
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0092
+L0013:	tax
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+L0092:	lda     #$01
+	sta     _t
+	stz     _t+1
+	lda     #<(S003B)
+	ldx     #>(S003B)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	jsr     _f
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L001F
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L001E
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L001F
+L001E:	bra     L0021
+L001F:	lda     #$01
+L0021:	sta     _t
+	stz     _t+1
+	lda     #<(S003C)
+	ldx     #>(S003C)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0069
+	ldx     #$00
+	txa
+	jsr     _f
+	bra     L002A
+L0069:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0029
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L002A
+L0029:	bra     L002C
+L002A:	lda     #$01
+L002C:	sta     _t
+	stz     _t+1
+	lda     #<(S003D)
+	ldx     #>(S003D)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0030
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0034
+L0030:	tax
+	jsr     _f
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0034
+	bra     L0036
+L0034:	lda     #$01
+L0036:	sta     _t
+	stz     _t+1
+	lda     #<(S003E)
+	ldx     #>(S003E)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L006D
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L003F
+L006D:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L003E
+	ldx     #$00
+	txa
+	jsr     _f
+	bra     L003F
+L003E:	bra     L0041
+L003F:	lda     #$01
+L0041:	sta     _t
+	stz     _t+1
+	lda     #<(S003F)
+	ldx     #>(S003F)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0045
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0046
+L0045:	bra     L0049
+L0046:	lda     #$01
+L0049:	sta     _t
+	stz     _t+1
+	lda     #<(S0040)
+	ldx     #>(S0040)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L004D
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+L004D:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L004E
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L004F
+L004E:	bra     L0052
+L004F:	lda     #$01
+L0052:	sta     _t
+	stz     _t+1
+	lda     #<(S0041)
+	ldx     #>(S0041)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0071
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0071
+	lda     #$01
+	bra     L005A
+L0071:	ldx     #$01
+	jsr     _f
+	lda     #$00
+L005A:	sta     _t
+	stz     _t+1
+	lda     #<(S0042)
+	ldx     #>(S0042)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0072
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0072
+	lda     #$01
+	bra     L0063
+L0072:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0062
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+L0062:	lda     #$00
+L0063:	sta     _t
+	stz     _t+1
+	lda     #<(S0043)
+	ldx     #>(S0043)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #<(S0044)
+	ldx     #>(S0044)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ f5 (int a, int b, int c, int d)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f5: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     #<(S0045)
+	ldx     #>(S0045)
+	jsr     pushax
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0A
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0005
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0005
+	bra     L000B
+L0005:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0008
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0008
+	bra     L000B
+L0008:	lda     #$01
+L000B:	sta     _t
+	stz     _t+1
+	lda     #<(S0046)
+	ldx     #>(S0046)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	stz     _t
+	stz     _t+1
+	lda     #<(S0047)
+	ldx     #>(S0047)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0012
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0065
+L0012:	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+L0065:	stz     _t
+	stz     _t+1
+	lda     #<(S0048)
+	ldx     #>(S0048)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	jsr     _f
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0018
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0018
+	bra     L001B
+L0018:	lda     #$01
+L001B:	sta     _t
+	stz     _t+1
+	lda     #<(S0049)
+	ldx     #>(S0049)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L001F
+	tax
+	jsr     _f
+L001F:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0022
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0022
+	bra     L0025
+L0022:	lda     #$01
+L0025:	sta     _t
+	stz     _t+1
+	lda     #<(S004A)
+	ldx     #>(S004A)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0029
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0029
+	bra     L002D
+L0029:	ldx     #$00
+	txa
+	jsr     _f
+	lda     #$01
+L002D:	sta     _t
+	stz     _t+1
+	lda     #<(S004B)
+	ldx     #>(S004B)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0031
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0031
+	bra     L0037
+L0031:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0034
+	tax
+	jsr     _f
+L0034:	lda     #$01
+L0037:	sta     _t
+	stz     _t+1
+	lda     #<(S004C)
+	ldx     #>(S004C)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L003B
+	bra     L0041
+L003B:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L003E
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L003E
+	bra     L0041
+L003E:	lda     #$01
+L0041:	sta     _t
+	stz     _t+1
+	lda     #<(S004D)
+	ldx     #>(S004D)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0045
+	ldx     #$01
+	jsr     _f
+	lda     #$00
+	bra     L004B
+L0045:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0048
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0048
+	bra     L004B
+L0048:	lda     #$01
+L004B:	sta     _t
+	stz     _t+1
+	lda     #<(S004E)
+	ldx     #>(S004E)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L004F
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L004F
+	bra     L0055
+L004F:	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0052
+	bra     L0055
+L0052:	lda     #$01
+L0055:	sta     _t
+	stz     _t+1
+	lda     #<(S004F)
+	ldx     #>(S004F)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0059
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0059
+	bra     L005F
+L0059:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L005C
+	ldx     #$01
+	jsr     _f
+	lda     #$00
+	bra     L005F
+L005C:	lda     #$01
+L005F:	sta     _t
+	stz     _t+1
+	lda     #<(S0050)
+	ldx     #>(S0050)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #<(S0051)
+	ldx     #>(S0051)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ f0_B (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f0_B: near
+
+.segment	"CODE"
+
+	lda     #<(S0052)
+	ldx     #>(S0052)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	txa
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	lda     #$2A
+	sta     _t
+	stz     _t+1
+	lda     #<(S0053)
+	ldx     #>(S0053)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldx     #$FF
+	lda     #$D6
+	sta     _t
+	stx     _t+1
+	lda     #<(S0054)
+	ldx     #>(S0054)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	jsr     _f
+	lda     #$2A
+	sta     _t
+	stz     _t+1
+	lda     #<(S0055)
+	ldx     #>(S0055)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$FF
+	lda     #$D6
+	sta     _t
+	stx     _t+1
+	lda     #<(S0056)
+	ldx     #>(S0056)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	lda     #$2A
+	sta     _t
+	stz     _t+1
+	lda     #<(S0057)
+	ldx     #>(S0057)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$FF
+	lda     #$D6
+	sta     _t
+	stx     _t+1
+	lda     #<(S0058)
+	ldx     #>(S0058)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$FF
+	lda     #$D6
+	sta     _t
+	stx     _t+1
+	lda     #<(S0059)
+	ldx     #>(S0059)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$FF
+	lda     #$D6
+	sta     _t
+	stx     _t+1
+	lda     #<(S005A)
+	ldx     #>(S005A)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	lda     #$2A
+	sta     _t
+	stz     _t+1
+	lda     #<(S005B)
+	ldx     #>(S005B)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$FF
+	lda     #$D6
+	sta     _t
+	stx     _t+1
+	lda     #<(S005C)
+	ldx     #>(S005C)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$FF
+	lda     #$D6
+	sta     _t
+	stx     _t+1
+	lda     #<(S005D)
+	ldx     #>(S005D)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$FF
+	lda     #$D6
+	sta     _t
+	stx     _t+1
+	lda     #<(S005E)
+	ldx     #>(S005E)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	lda     #$2A
+	sta     _t
+	stz     _t+1
+	lda     #<(S005F)
+	ldx     #>(S005F)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$FF
+	lda     #$D6
+	sta     _t
+	stx     _t+1
+	lda     #<(S0060)
+	ldx     #>(S0060)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	lda     #$2A
+	sta     _t
+	stz     _t+1
+	lda     #<(S0061)
+	ldx     #>(S0061)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	lda     #$2A
+	sta     _t
+	stz     _t+1
+	lda     #<(S0062)
+	ldx     #>(S0062)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #<(S0063)
+	ldx     #>(S0063)
+	jsr     pushax
+	ldy     #$02
+	jmp     _printf
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ f1_B (int a, int b, int c)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f1_B: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     #<(S0064)
+	ldx     #>(S0064)
+	jsr     pushax
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0008
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0008
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0008
+	ldx     #$00
+	lda     #$2A
+	bra     L0009
+L0008:	ldx     #$FF
+	lda     #$D6
+L0009:	sta     _t
+	stx     _t+1
+	lda     #<(S0065)
+	ldx     #>(S0065)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	jsr     _f
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0010
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0010
+	ldx     #$00
+	lda     #$2A
+	bra     L0011
+L0010:	ldx     #$FF
+	lda     #$D6
+L0011:	sta     _t
+	stx     _t+1
+	lda     #<(S0066)
+	ldx     #>(S0066)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0018
+	ldx     #$00
+	txa
+	jsr     _f
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0018
+	ldx     #$00
+	lda     #$2A
+	bra     L0019
+L0018:	ldx     #$FF
+	lda     #$D6
+L0019:	sta     _t
+	stx     _t+1
+	lda     #<(S0067)
+	ldx     #>(S0067)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0020
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0020
+	ldx     #$00
+	txa
+	jsr     _f
+	ldx     #$00
+	lda     #$2A
+	bra     L0021
+L0020:	ldx     #$FF
+	lda     #$D6
+L0021:	sta     _t
+	stx     _t+1
+	lda     #<(S0068)
+	ldx     #>(S0068)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldx     #$FF
+	lda     #$D6
+	sta     _t
+	stx     _t+1
+	lda     #<(S0069)
+	ldx     #>(S0069)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0028
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+L0028:	ldx     #$FF
+	lda     #$D6
+	sta     _t
+	stx     _t+1
+	lda     #<(S006A)
+	ldx     #>(S006A)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L002C
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L002C
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+L002C:	ldx     #$FF
+	lda     #$D6
+	sta     _t
+	stx     _t+1
+	lda     #<(S006B)
+	ldx     #>(S006B)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0032
+	ldx     #$00
+	lda     #$2A
+	bra     L0033
+L0032:	ldx     #$FF
+	lda     #$D6
+L0033:	sta     _t
+	stx     _t+1
+	lda     #<(S006C)
+	ldx     #>(S006C)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L003A
+	ldx     #$00
+	txa
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	ldx     #$00
+	lda     #$2A
+	bra     L003B
+L003A:	ldx     #$FF
+	lda     #$D6
+L003B:	sta     _t
+	stx     _t+1
+	lda     #<(S006D)
+	ldx     #>(S006D)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	jsr     _f
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0042
+	ldx     #$00
+	txa
+	jsr     _f
+	ldx     #$00
+	lda     #$2A
+	bra     L0043
+L0042:	ldx     #$FF
+	lda     #$D6
+L0043:	sta     _t
+	stx     _t+1
+	lda     #<(S006E)
+	ldx     #>(S006E)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #<(S006F)
+	ldx     #>(S006F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ f2_B (int a, int b, int c)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f2_B: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     #<(S0070)
+	ldx     #>(S0070)
+	jsr     pushax
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0005
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0005
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0007
+L0005:	ldx     #$00
+	lda     #$2A
+	bra     L0008
+L0007:	ldx     #$FF
+	lda     #$D6
+L0008:	sta     _t
+	stx     _t+1
+	lda     #<(S0071)
+	ldx     #>(S0071)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	jsr     _f
+	lda     #$2A
+	sta     _t
+	stz     _t+1
+	lda     #<(S0072)
+	ldx     #>(S0072)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L000F
+	tax
+	jsr     _f
+L000F:	lda     #$2A
+	sta     _t
+	stz     _t+1
+	lda     #<(S0073)
+	ldx     #>(S0073)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0016
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0016
+	tax
+	jsr     _f
+L0016:	lda     #$2A
+	sta     _t
+	stz     _t+1
+	lda     #<(S0074)
+	ldx     #>(S0074)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L001D
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L001F
+L001D:	ldx     #$00
+	lda     #$2A
+	bra     L0020
+L001F:	ldx     #$FF
+	lda     #$D6
+L0020:	sta     _t
+	stx     _t+1
+	lda     #<(S0075)
+	ldx     #>(S0075)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0024
+	ldx     #$01
+	jsr     _f
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0026
+L0024:	ldx     #$00
+	lda     #$2A
+	bra     L0027
+L0026:	ldx     #$FF
+	lda     #$D6
+L0027:	sta     _t
+	stx     _t+1
+	lda     #<(S0076)
+	ldx     #>(S0076)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L002B
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L002B
+	ldx     #$01
+	jsr     _f
+	bra     L002D
+L002B:	ldx     #$00
+	lda     #$2A
+	bra     L002E
+L002D:	ldx     #$FF
+	lda     #$D6
+L002E:	sta     _t
+	stx     _t+1
+	lda     #<(S0077)
+	ldx     #>(S0077)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0034
+	ldx     #$00
+	lda     #$2A
+	bra     L0035
+L0034:	ldx     #$FF
+	lda     #$D6
+L0035:	sta     _t
+	stx     _t+1
+	lda     #<(S0078)
+	ldx     #>(S0078)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0039
+	ldx     #$01
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	bra     L003B
+L0039:	ldx     #$00
+	lda     #$2A
+	bra     L003C
+L003B:	ldx     #$FF
+	lda     #$D6
+L003C:	sta     _t
+	stx     _t+1
+	lda     #<(S0079)
+	ldx     #>(S0079)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0040
+	ldx     #$01
+	jsr     _f
+	bra     L0042
+L0040:	ldx     #$00
+	lda     #$2A
+	bra     L0043
+L0042:	ldx     #$FF
+	lda     #$D6
+L0043:	sta     _t
+	stx     _t+1
+	lda     #<(S007A)
+	ldx     #>(S007A)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #<(S007B)
+	ldx     #>(S007B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ f3_B (int a, int b, int c, int d)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f3_B: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     #<(S007C)
+	ldx     #>(S007C)
+	jsr     pushax
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0A
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0005
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0006
+L0005:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0009
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0009
+L0006:	ldx     #$00
+	lda     #$2A
+	bra     L000A
+L0009:	ldx     #$FF
+	lda     #$D6
+L000A:	sta     _t
+	stx     _t+1
+	lda     #<(S007D)
+	ldx     #>(S007D)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	lda     #$2A
+	sta     _t
+	stz     _t+1
+	lda     #<(S007E)
+	ldx     #>(S007E)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0011
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0012
+L0011:	tax
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+L0012:	lda     #$2A
+	sta     _t
+	stz     _t+1
+	lda     #<(S007F)
+	ldx     #>(S007F)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	jsr     _f
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0019
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L001C
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L001C
+L0019:	ldx     #$00
+	lda     #$2A
+	bra     L001D
+L001C:	ldx     #$FF
+	lda     #$D6
+L001D:	sta     _t
+	stx     _t+1
+	lda     #<(S0080)
+	ldx     #>(S0080)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0021
+	ldx     #$00
+	txa
+	jsr     _f
+	bra     L0022
+L0021:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0025
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0025
+L0022:	ldx     #$00
+	lda     #$2A
+	bra     L0026
+L0025:	ldx     #$FF
+	lda     #$D6
+L0026:	sta     _t
+	stx     _t+1
+	lda     #<(S0081)
+	ldx     #>(S0081)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L002A
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L002B
+L002A:	tax
+	jsr     _f
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L002D
+L002B:	ldx     #$00
+	lda     #$2A
+	bra     L002E
+L002D:	ldx     #$FF
+	lda     #$D6
+L002E:	sta     _t
+	stx     _t+1
+	lda     #<(S0082)
+	ldx     #>(S0082)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0032
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0033
+L0032:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0036
+	ldx     #$00
+	txa
+	jsr     _f
+L0033:	ldx     #$00
+	lda     #$2A
+	bra     L0037
+L0036:	ldx     #$FF
+	lda     #$D6
+L0037:	sta     _t
+	stx     _t+1
+	lda     #<(S0083)
+	ldx     #>(S0083)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L003E
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L003E
+	ldx     #$00
+	lda     #$2A
+	bra     L003F
+L003E:	ldx     #$FF
+	lda     #$D6
+L003F:	sta     _t
+	stx     _t+1
+	lda     #<(S0084)
+	ldx     #>(S0084)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0043
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+L0043:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0047
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0047
+	ldx     #$00
+	lda     #$2A
+	bra     L0048
+L0047:	ldx     #$FF
+	lda     #$D6
+L0048:	sta     _t
+	stx     _t+1
+	lda     #<(S0085)
+	ldx     #>(S0085)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L004C
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L004D
+L004C:	ldx     #$01
+	jsr     _f
+	bra     L004F
+L004D:	ldx     #$00
+	lda     #$2A
+	bra     L0050
+L004F:	ldx     #$FF
+	lda     #$D6
+L0050:	sta     _t
+	stx     _t+1
+	lda     #<(S0086)
+	ldx     #>(S0086)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0054
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0055
+L0054:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0058
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	bra     L0058
+L0055:	ldx     #$00
+	lda     #$2A
+	bra     L0059
+L0058:	ldx     #$FF
+	lda     #$D6
+L0059:	sta     _t
+	stx     _t+1
+	lda     #<(S0087)
+	ldx     #>(S0087)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #<(S0088)
+	ldx     #>(S0088)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ f4_B (int a, int b, int c, int d)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f4_B: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     #<(S0089)
+	ldx     #>(S0089)
+	jsr     pushax
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0A
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0078
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L00BB
+L0078:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L000D
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L000D
+L00BB:	ldx     #$00
+	lda     #$2A
+	bra     L000E
+L000D:	ldx     #$FF
+	lda     #$D6
+L000E:	sta     _t
+	stx     _t+1
+	lda     #<(S008A)
+	ldx     #>(S008A)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+	lda     #$2A
+	sta     _t
+	stz     _t+1
+	lda     #<(S008B)
+	ldx     #>(S008B)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0015
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L00B7
+L0015:	tax
+	jsr     _f
+	ldx     #$00
+	txa
+	jsr     _f
+L00B7:	lda     #$2A
+	sta     _t
+	stz     _t+1
+	lda     #<(S008C)
+	ldx     #>(S008C)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	jsr     _f
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L00BC
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0026
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0026
+L00BC:	ldx     #$00
+	lda     #$2A
+	bra     L0027
+L0026:	ldx     #$FF
+	lda     #$D6
+L0027:	sta     _t
+	stx     _t+1
+	lda     #<(S008D)
+	ldx     #>(S008D)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L007D
+	ldx     #$00
+	txa
+	jsr     _f
+	bra     L00BD
+L007D:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0033
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0033
+L00BD:	ldx     #$00
+	lda     #$2A
+	bra     L0034
+L0033:	ldx     #$FF
+	lda     #$D6
+L0034:	sta     _t
+	stx     _t+1
+	lda     #<(S008E)
+	ldx     #>(S008E)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0038
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L00B9
+L0038:	tax
+	jsr     _f
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L003F
+L00B9:	ldx     #$00
+	lda     #$2A
+	bra     L0040
+L003F:	ldx     #$FF
+	lda     #$D6
+L0040:	sta     _t
+	stx     _t+1
+	lda     #<(S008F)
+	ldx     #>(S008F)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0081
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L00BE
+L0081:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L004C
+	ldx     #$00
+	txa
+	jsr     _f
+L00BE:	ldx     #$00
+	lda     #$2A
+	bra     L004D
+L004C:	ldx     #$FF
+	lda     #$D6
+L004D:	sta     _t
+	stx     _t+1
+	lda     #<(S0090)
+	ldx     #>(S0090)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0056
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0056
+	ldx     #$00
+	lda     #$2A
+	bra     L0057
+L0056:	ldx     #$FF
+	lda     #$D6
+L0057:	sta     _t
+	stx     _t+1
+	lda     #<(S0091)
+	ldx     #>(S0091)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L005B
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+L005B:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0061
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0061
+	ldx     #$00
+	lda     #$2A
+	bra     L0062
+L0061:	ldx     #$FF
+	lda     #$D6
+L0062:	sta     _t
+	stx     _t+1
+	lda     #<(S0092)
+	ldx     #>(S0092)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0085
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0085
+	ldx     #$00
+	bra     L00B3
+L0085:	ldx     #$01
+	jsr     _f
+	bra     L006B
+L00B3:	lda     #$2A
+	bra     L006C
+L006B:	ldx     #$FF
+	lda     #$D6
+L006C:	sta     _t
+	stx     _t+1
+	lda     #<(S0093)
+	ldx     #>(S0093)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0086
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0086
+	ldx     #$00
+	bra     L00B6
+L0086:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0076
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	bra     L0076
+L00B6:	lda     #$2A
+	bra     L0077
+L0076:	ldx     #$FF
+	lda     #$D6
+L0077:	sta     _t
+	stx     _t+1
+	lda     #<(S0094)
+	ldx     #>(S0094)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #<(S0095)
+	ldx     #>(S0095)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ f5_B (int a, int b, int c, int d)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f5_B: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     #<(S0096)
+	ldx     #>(S0096)
+	jsr     pushax
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0A
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0005
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L000C
+L0005:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0008
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L000C
+L0008:	ldx     #$00
+	lda     #$2A
+	bra     L000D
+L000C:	ldx     #$FF
+	lda     #$D6
+L000D:	sta     _t
+	stx     _t+1
+	lda     #<(S0097)
+	ldx     #>(S0097)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$FF
+	lda     #$D6
+	sta     _t
+	stx     _t+1
+	lda     #<(S0098)
+	ldx     #>(S0098)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0014
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0016
+L0014:	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldx     #$01
+	lda     #$00
+	jsr     _f
+L0016:	ldx     #$FF
+	lda     #$D6
+	sta     _t
+	stx     _t+1
+	lda     #<(S0099)
+	ldx     #>(S0099)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldx     #$00
+	txa
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	jsr     _f
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L001A
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L001E
+L001A:	ldx     #$00
+	lda     #$2A
+	bra     L001F
+L001E:	ldx     #$FF
+	lda     #$D6
+L001F:	sta     _t
+	stx     _t+1
+	lda     #<(S009A)
+	ldx     #>(S009A)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0023
+	tax
+	jsr     _f
+L0023:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0026
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L002A
+L0026:	ldx     #$00
+	lda     #$2A
+	bra     L002B
+L002A:	ldx     #$FF
+	lda     #$D6
+L002B:	sta     _t
+	stx     _t+1
+	lda     #<(S009B)
+	ldx     #>(S009B)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L002F
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0034
+L002F:	ldx     #$00
+	txa
+	jsr     _f
+	ldx     #$00
+	lda     #$2A
+	bra     L0035
+L0034:	ldx     #$FF
+	lda     #$D6
+L0035:	sta     _t
+	stx     _t+1
+	lda     #<(S009C)
+	ldx     #>(S009C)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0039
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0040
+L0039:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L003C
+	tax
+	jsr     _f
+L003C:	ldx     #$00
+	lda     #$2A
+	bra     L0041
+L0040:	ldx     #$FF
+	lda     #$D6
+L0041:	sta     _t
+	stx     _t+1
+	lda     #<(S009D)
+	ldx     #>(S009D)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #$00
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldx     #$01
+	jsr     _f
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L004C
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0048
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L004C
+L0048:	ldx     #$00
+	lda     #$2A
+	bra     L004D
+L004C:	ldx     #$FF
+	lda     #$D6
+L004D:	sta     _t
+	stx     _t+1
+	lda     #<(S009E)
+	ldx     #>(S009E)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0051
+	ldx     #$01
+	jsr     _f
+	bra     L0058
+L0051:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0054
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0058
+L0054:	ldx     #$00
+	lda     #$2A
+	bra     L0059
+L0058:	ldx     #$FF
+	lda     #$D6
+L0059:	sta     _t
+	stx     _t+1
+	lda     #<(S009F)
+	ldx     #>(S009F)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L005D
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0064
+L005D:	ldx     #$01
+	lda     #$00
+	jsr     _f
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0064
+	ldx     #$00
+	lda     #$2A
+	bra     L0065
+L0064:	ldx     #$FF
+	lda     #$D6
+L0065:	sta     _t
+	stx     _t+1
+	lda     #<(S00A0)
+	ldx     #>(S00A0)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	stz     _s
+	stz     _s+1
+	stz     _flags
+	stz     _flags+1
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L0069
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	beq     L0070
+L0069:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _f
+	stx     tmp1
+	ora     tmp1
+	bne     L006C
+	ldx     #$01
+	jsr     _f
+	bra     L0070
+L006C:	ldx     #$00
+	lda     #$2A
+	bra     L0071
+L0070:	ldx     #$FF
+	lda     #$D6
+L0071:	sta     _t
+	stx     _t+1
+	lda     #<(S00A1)
+	ldx     #>(S00A1)
+	jsr     pushax
+	lda     _s
+	ldx     _s+1
+	jsr     pushax
+	lda     _flags
+	ldx     _flags+1
+	jsr     pushax
+	lda     _t
+	ldx     _t+1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	lda     #<(S00A2)
+	ldx     #>(S00A2)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     _f0
+	jsr     decsp4
+	lda     #$00
+	ldy     #$02
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	sta     (sp)
+	ldy     #$01
+	sta     (sp),y
+	tax
+	jsr     _f1
+	jsr     decsp4
+	lda     #$00
+	ldy     #$02
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	sta     (sp)
+	ldy     #$01
+	sta     (sp),y
+	tax
+	jsr     _f2
+	jsr     decsp6
+	lda     #$00
+	ldy     #$04
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$02
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	sta     (sp)
+	ldy     #$01
+	sta     (sp),y
+	tax
+	jsr     _f3
+	jsr     decsp6
+	lda     #$00
+	ldy     #$04
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$02
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	sta     (sp)
+	ldy     #$01
+	sta     (sp),y
+	tax
+	jsr     _f4
+	jsr     decsp6
+	lda     #$00
+	ldy     #$04
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$02
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	sta     (sp)
+	ldy     #$01
+	sta     (sp),y
+	tax
+	jsr     _f5
+	jsr     decsp4
+	lda     #$01
+	ldy     #$02
+	sta     (sp),y
+	iny
+	dea
+	sta     (sp),y
+	ina
+	sta     (sp)
+	tay
+	dea
+	sta     (sp),y
+	tax
+	tya
+	jsr     _f1
+	jsr     decsp4
+	lda     #$01
+	ldy     #$02
+	sta     (sp),y
+	iny
+	dea
+	sta     (sp),y
+	ina
+	sta     (sp)
+	tay
+	dea
+	sta     (sp),y
+	tax
+	tya
+	jsr     _f2
+	jsr     decsp6
+	lda     #$01
+	ldy     #$04
+	sta     (sp),y
+	iny
+	dea
+	sta     (sp),y
+	ina
+	ldy     #$02
+	sta     (sp),y
+	iny
+	dea
+	sta     (sp),y
+	ina
+	sta     (sp)
+	tay
+	dea
+	sta     (sp),y
+	tax
+	tya
+	jsr     _f3
+	jsr     decsp6
+	lda     #$01
+	ldy     #$04
+	sta     (sp),y
+	iny
+	dea
+	sta     (sp),y
+	ina
+	ldy     #$02
+	sta     (sp),y
+	iny
+	dea
+	sta     (sp),y
+	ina
+	sta     (sp)
+	tay
+	dea
+	sta     (sp),y
+	tax
+	tya
+	jsr     _f4
+	jsr     decsp6
+	lda     #$01
+	ldy     #$04
+	sta     (sp),y
+	iny
+	dea
+	sta     (sp),y
+	ina
+	ldy     #$02
+	sta     (sp),y
+	iny
+	dea
+	sta     (sp),y
+	ina
+	sta     (sp)
+	tay
+	dea
+	sta     (sp),y
+	tax
+	tya
+	jsr     _f5
+	jsr     decsp6
+	lda     #$01
+	ldy     #$04
+	sta     (sp),y
+	iny
+	dea
+	sta     (sp),y
+	ldy     #$02
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ina
+	sta     (sp)
+	tay
+	dea
+	sta     (sp),y
+	tax
+	jsr     _f3
+	jsr     decsp6
+	lda     #$01
+	ldy     #$04
+	sta     (sp),y
+	iny
+	dea
+	sta     (sp),y
+	ldy     #$02
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ina
+	sta     (sp)
+	tay
+	dea
+	sta     (sp),y
+	tax
+	jsr     _f4
+	jsr     decsp6
+	lda     #$01
+	ldy     #$04
+	sta     (sp),y
+	iny
+	dea
+	sta     (sp),y
+	ldy     #$02
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ina
+	sta     (sp)
+	tay
+	dea
+	sta     (sp),y
+	tax
+	jsr     _f5
+	jsr     decsp6
+	lda     #$00
+	ldy     #$04
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ina
+	ldy     #$02
+	sta     (sp),y
+	iny
+	dea
+	sta     (sp),y
+	sta     (sp)
+	ldy     #$01
+	sta     (sp),y
+	tax
+	tya
+	jsr     _f3
+	jsr     decsp6
+	lda     #$00
+	ldy     #$04
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ina
+	ldy     #$02
+	sta     (sp),y
+	iny
+	dea
+	sta     (sp),y
+	sta     (sp)
+	ldy     #$01
+	sta     (sp),y
+	tax
+	tya
+	jsr     _f4
+	jsr     decsp6
+	lda     #$00
+	ldy     #$04
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ina
+	ldy     #$02
+	sta     (sp),y
+	iny
+	dea
+	sta     (sp),y
+	sta     (sp)
+	ldy     #$01
+	sta     (sp),y
+	tax
+	tya
+	jsr     _f5
+	jsr     _f0_B
+	jsr     decsp4
+	lda     #$00
+	ldy     #$02
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	sta     (sp)
+	ldy     #$01
+	sta     (sp),y
+	tax
+	jsr     _f1_B
+	jsr     decsp4
+	lda     #$00
+	ldy     #$02
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	sta     (sp)
+	ldy     #$01
+	sta     (sp),y
+	tax
+	jsr     _f2_B
+	jsr     decsp6
+	lda     #$00
+	ldy     #$04
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$02
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	sta     (sp)
+	ldy     #$01
+	sta     (sp),y
+	tax
+	jsr     _f3_B
+	jsr     decsp6
+	lda     #$00
+	ldy     #$04
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$02
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	sta     (sp)
+	ldy     #$01
+	sta     (sp),y
+	tax
+	jsr     _f4_B
+	jsr     decsp6
+	lda     #$00
+	ldy     #$04
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$02
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	sta     (sp)
+	ldy     #$01
+	sta     (sp),y
+	tax
+	jsr     _f5_B
+	jsr     decsp4
+	lda     #$01
+	ldy     #$02
+	sta     (sp),y
+	iny
+	dea
+	sta     (sp),y
+	ina
+	sta     (sp)
+	tay
+	dea
+	sta     (sp),y
+	tax
+	tya
+	jsr     _f1_B
+	jsr     decsp4
+	lda     #$01
+	ldy     #$02
+	sta     (sp),y
+	iny
+	dea
+	sta     (sp),y
+	ina
+	sta     (sp)
+	tay
+	dea
+	sta     (sp),y
+	tax
+	tya
+	jsr     _f2_B
+	jsr     decsp6
+	lda     #$01
+	ldy     #$04
+	sta     (sp),y
+	iny
+	dea
+	sta     (sp),y
+	ina
+	ldy     #$02
+	sta     (sp),y
+	iny
+	dea
+	sta     (sp),y
+	ina
+	sta     (sp)
+	tay
+	dea
+	sta     (sp),y
+	tax
+	tya
+	jsr     _f3_B
+	jsr     decsp6
+	lda     #$01
+	ldy     #$04
+	sta     (sp),y
+	iny
+	dea
+	sta     (sp),y
+	ina
+	ldy     #$02
+	sta     (sp),y
+	iny
+	dea
+	sta     (sp),y
+	ina
+	sta     (sp)
+	tay
+	dea
+	sta     (sp),y
+	tax
+	tya
+	jsr     _f4_B
+	jsr     decsp6
+	lda     #$01
+	ldy     #$04
+	sta     (sp),y
+	iny
+	dea
+	sta     (sp),y
+	ina
+	ldy     #$02
+	sta     (sp),y
+	iny
+	dea
+	sta     (sp),y
+	ina
+	sta     (sp)
+	tay
+	dea
+	sta     (sp),y
+	tax
+	tya
+	jsr     _f5_B
+	jsr     decsp6
+	lda     #$01
+	ldy     #$04
+	sta     (sp),y
+	iny
+	dea
+	sta     (sp),y
+	ldy     #$02
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ina
+	sta     (sp)
+	tay
+	dea
+	sta     (sp),y
+	tax
+	jsr     _f3_B
+	jsr     decsp6
+	lda     #$01
+	ldy     #$04
+	sta     (sp),y
+	iny
+	dea
+	sta     (sp),y
+	ldy     #$02
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ina
+	sta     (sp)
+	tay
+	dea
+	sta     (sp),y
+	tax
+	jsr     _f4_B
+	jsr     decsp6
+	lda     #$01
+	ldy     #$04
+	sta     (sp),y
+	iny
+	dea
+	sta     (sp),y
+	ldy     #$02
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ina
+	sta     (sp)
+	tay
+	dea
+	sta     (sp),y
+	tax
+	jsr     _f5_B
+	jsr     decsp6
+	lda     #$00
+	ldy     #$04
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ina
+	ldy     #$02
+	sta     (sp),y
+	iny
+	dea
+	sta     (sp),y
+	sta     (sp)
+	ldy     #$01
+	sta     (sp),y
+	tax
+	tya
+	jsr     _f3_B
+	jsr     decsp6
+	lda     #$00
+	ldy     #$04
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ina
+	ldy     #$02
+	sta     (sp),y
+	iny
+	dea
+	sta     (sp),y
+	sta     (sp)
+	ldy     #$01
+	sta     (sp),y
+	tax
+	tya
+	jsr     _f4_B
+	jsr     decsp6
+	lda     #$00
+	ldy     #$04
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ina
+	ldy     #$02
+	sta     (sp),y
+	iny
+	dea
+	sta     (sp),y
+	sta     (sp)
+	ldy     #$01
+	sta     (sp),y
+	tax
+	tya
+	jsr     _f5_B
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
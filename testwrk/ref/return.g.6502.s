@@ -0,0 +1,770 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "return.c", 1614, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/stdlib.h", 5999, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_val_char
+	.export		_val_int
+	.export		_val_long
+	.export		_test1_int_char
+	.export		_test1_int_int
+	.export		_test2_int_char
+	.export		_test2_int_int
+	.export		_test1_long_char
+	.export		_test1_long_int
+	.export		_test1_long_long
+	.export		_test2_long_char
+	.export		_test2_long_int
+	.export		_test2_long_long
+	.export		_main
+
+.segment	"DATA"
+
+_val_char:
+	.byte	$76
+_val_int:
+	.word	$5678
+_val_long:
+	.dword	$12345678
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$0A,$77,$69,$74,$68,$6F,$75,$74,$20,$63,$61,$73,$74,$3A,$0A,$00
+S0003:
+	.byte	$25,$30,$34,$6C,$78,$20,$25,$30,$34,$6C,$78,$2C,$00
+S0022	:=	S0003+0
+S001F	:=	S0003+0
+S0006	:=	S0003+0
+S001C	:=	S0003+0
+S001B:
+	.byte	$72,$65,$74,$75,$72,$6E,$20,$6C,$6F,$6E,$67,$0A,$00
+S0009	:=	S001B+0
+S000A	:=	S0003+0
+S0018	:=	S0003+0
+S0015	:=	S0003+0
+S000D	:=	S0003+0
+S0013:
+	.byte	$0A,$77,$69,$74,$68,$20,$63,$61,$73,$74,$3A,$0A,$00
+S0010	:=	S0003+0
+S0014:
+	.byte	$72,$65,$74,$75,$72,$6E,$20,$69,$6E,$74,$0A,$00
+S0002	:=	S0014+0
+S0023:
+	.byte	$66,$61,$69,$6C,$65,$64,$0A,$00
+S0004	:=	S0023+0
+S000E	:=	S0023+0
+S0020	:=	S0023+0
+S0016	:=	S0023+0
+S001D	:=	S0023+0
+S000B	:=	S0023+0
+S0019	:=	S0023+0
+S0007	:=	S0023+0
+S0011	:=	S0023+0
+S001A:
+	.byte	$6F,$6B,$0A,$00
+S0017	:=	S001A+0
+S001E	:=	S001A+0
+S0005	:=	S001A+0
+S000C	:=	S001A+0
+S0021	:=	S001A+0
+S000F	:=	S001A+0
+S0012	:=	S001A+0
+S0024	:=	S001A+0
+S0008	:=	S001A+0
+
+; ---------------------------------------------------------------
+; int __near__ test1_int_char (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test1_int_char: near
+
+	.dbg	func, "test1_int_char", "00", extern, "_test1_int_char"
+
+.segment	"CODE"
+
+	.dbg	line, "return.c", 16
+	ldx     #$00
+	lda     _val_char
+	jmp     L0001
+	.dbg	line, "return.c", 17
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test1_int_int (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test1_int_int: near
+
+	.dbg	func, "test1_int_int", "00", extern, "_test1_int_int"
+
+.segment	"CODE"
+
+	.dbg	line, "return.c", 20
+	lda     _val_int
+	ldx     _val_int+1
+	jmp     L0001
+	.dbg	line, "return.c", 21
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test2_int_char (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test2_int_char: near
+
+	.dbg	func, "test2_int_char", "00", extern, "_test2_int_char"
+
+.segment	"CODE"
+
+	.dbg	line, "return.c", 25
+	ldx     #$00
+	lda     _val_char
+	jmp     L0001
+	.dbg	line, "return.c", 26
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test2_int_int (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test2_int_int: near
+
+	.dbg	func, "test2_int_int", "00", extern, "_test2_int_int"
+
+.segment	"CODE"
+
+	.dbg	line, "return.c", 29
+	lda     _val_int
+	ldx     _val_int+1
+	jmp     L0001
+	.dbg	line, "return.c", 30
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; long __near__ test1_long_char (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test1_long_char: near
+
+	.dbg	func, "test1_long_char", "00", extern, "_test1_long_char"
+
+.segment	"CODE"
+
+	.dbg	line, "return.c", 34
+	ldx     #$00
+	lda     _val_char
+	jsr     axulong
+	jmp     L0001
+	.dbg	line, "return.c", 35
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; long __near__ test1_long_int (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test1_long_int: near
+
+	.dbg	func, "test1_long_int", "00", extern, "_test1_long_int"
+
+.segment	"CODE"
+
+	.dbg	line, "return.c", 38
+	lda     _val_int
+	ldx     _val_int+1
+	jsr     axulong
+	jmp     L0001
+	.dbg	line, "return.c", 39
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; long __near__ test1_long_long (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test1_long_long: near
+
+	.dbg	func, "test1_long_long", "00", extern, "_test1_long_long"
+
+.segment	"CODE"
+
+	.dbg	line, "return.c", 42
+	lda     _val_long+3
+	sta     sreg+1
+	lda     _val_long+2
+	sta     sreg
+	ldx     _val_long+1
+	lda     _val_long
+	jmp     L0001
+	.dbg	line, "return.c", 43
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; long __near__ test2_long_char (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test2_long_char: near
+
+	.dbg	func, "test2_long_char", "00", extern, "_test2_long_char"
+
+.segment	"CODE"
+
+	.dbg	line, "return.c", 47
+	ldx     #$00
+	lda     _val_char
+	jsr     axulong
+	jmp     L0001
+	.dbg	line, "return.c", 48
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; long __near__ test2_long_int (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test2_long_int: near
+
+	.dbg	func, "test2_long_int", "00", extern, "_test2_long_int"
+
+.segment	"CODE"
+
+	.dbg	line, "return.c", 51
+	lda     _val_int
+	ldx     _val_int+1
+	jsr     axulong
+	jmp     L0001
+	.dbg	line, "return.c", 52
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; long __near__ test2_long_long (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test2_long_long: near
+
+	.dbg	func, "test2_long_long", "00", extern, "_test2_long_long"
+
+.segment	"CODE"
+
+	.dbg	line, "return.c", 55
+	lda     _val_long+3
+	sta     sreg+1
+	lda     _val_long+2
+	sta     sreg
+	ldx     _val_long+1
+	lda     _val_long
+	jmp     L0001
+	.dbg	line, "return.c", 56
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+	.dbg	sym, "i", "00", auto, -2
+	.dbg	sym, "l", "00", auto, -6
+
+.segment	"CODE"
+
+	.dbg	line, "return.c", 69
+	jsr     decsp6
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "return.c", 71
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "return.c", 73
+	jsr     _test1_int_char
+	ldy     #$04
+	jsr     staxysp
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$76
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldy     #$05
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0003
+	cmp     #$76
+L0003:	jsr     boolne
+	jeq     L0002
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0004
+L0002:	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "return.c", 74
+L0004:	jsr     _test1_int_int
+	ldy     #$04
+	jsr     staxysp
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$56
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$78
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldy     #$05
+	jsr     ldaxysp
+	cpx     #$56
+	bne     L0006
+	cmp     #$78
+L0006:	jsr     boolne
+	jeq     L0005
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0007
+L0005:	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "return.c", 76
+L0007:	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "return.c", 78
+	jsr     _test1_long_char
+	ldy     #$00
+	jsr     steaxysp
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$76
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldy     #$03
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$76
+	jsr     tosneeax
+	jeq     L0008
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0009
+L0008:	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "return.c", 79
+L0009:	jsr     _test1_long_int
+	ldy     #$00
+	jsr     steaxysp
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$56
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$78
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldy     #$03
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$56
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$78
+	jsr     tosneeax
+	jeq     L000A
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L000B
+L000A:	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "return.c", 80
+L000B:	jsr     _test1_long_long
+	ldy     #$00
+	jsr     steaxysp
+	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$56
+	lda     #$34
+	sta     sreg
+	lda     #$12
+	sta     sreg+1
+	lda     #$78
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldy     #$03
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$56
+	lda     #$34
+	sta     sreg
+	lda     #$12
+	sta     sreg+1
+	lda     #$78
+	jsr     tosneeax
+	jeq     L000C
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L000D
+L000C:	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "return.c", 82
+L000D:	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "return.c", 84
+	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "return.c", 86
+	jsr     _test2_int_char
+	ldy     #$04
+	jsr     staxysp
+	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$76
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldy     #$05
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L000F
+	cmp     #$76
+L000F:	jsr     boolne
+	jeq     L000E
+	lda     #<(S0016)
+	ldx     #>(S0016)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0010
+L000E:	lda     #<(S0017)
+	ldx     #>(S0017)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "return.c", 87
+L0010:	jsr     _test2_int_int
+	ldy     #$04
+	jsr     staxysp
+	lda     #<(S0018)
+	ldx     #>(S0018)
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$56
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$78
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldy     #$05
+	jsr     ldaxysp
+	cpx     #$56
+	bne     L0012
+	cmp     #$78
+L0012:	jsr     boolne
+	jeq     L0011
+	lda     #<(S0019)
+	ldx     #>(S0019)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0013
+L0011:	lda     #<(S001A)
+	ldx     #>(S001A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "return.c", 89
+L0013:	lda     #<(S001B)
+	ldx     #>(S001B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "return.c", 91
+	jsr     _test2_long_char
+	ldy     #$00
+	jsr     steaxysp
+	lda     #<(S001C)
+	ldx     #>(S001C)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$76
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldy     #$03
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$76
+	jsr     tosneeax
+	jeq     L0014
+	lda     #<(S001D)
+	ldx     #>(S001D)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0015
+L0014:	lda     #<(S001E)
+	ldx     #>(S001E)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "return.c", 92
+L0015:	jsr     _test2_long_int
+	ldy     #$00
+	jsr     steaxysp
+	lda     #<(S001F)
+	ldx     #>(S001F)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$56
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$78
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldy     #$03
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$56
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$78
+	jsr     tosneeax
+	jeq     L0016
+	lda     #<(S0020)
+	ldx     #>(S0020)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0017
+L0016:	lda     #<(S0021)
+	ldx     #>(S0021)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "return.c", 93
+L0017:	jsr     _test2_long_long
+	ldy     #$00
+	jsr     steaxysp
+	lda     #<(S0022)
+	ldx     #>(S0022)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$56
+	lda     #$34
+	sta     sreg
+	lda     #$12
+	sta     sreg+1
+	lda     #$78
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldy     #$03
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$56
+	lda     #$34
+	sta     sreg
+	lda     #$12
+	sta     sreg+1
+	lda     #$78
+	jsr     tosneeax
+	jeq     L0018
+	lda     #<(S0023)
+	ldx     #>(S0023)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0019
+L0018:	lda     #<(S0024)
+	ldx     #>(S0024)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "return.c", 95
+L0019:	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "return.c", 96
+L0001:	jsr     incsp6
+	rts
+
+	.dbg	line
+.endproc
+
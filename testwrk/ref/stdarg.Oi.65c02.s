@@ -0,0 +1,329 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_print
+	.export		_main
+
+.segment	"RODATA"
+
+S0010:
+	.byte	$25,$6C,$64,$2E,$30,$30,$30,$30,$30,$30,$00
+S0005:
+	.byte	$25,$73,$25,$73,$20,$25,$77,$25,$63,$00
+S0004:
+	.byte	$74,$65,$73,$74,$20,$25,$64,$25,$63,$00
+S0008:
+	.byte	$25,$73,$25,$73,$20,$25,$66,$25,$63,$00
+S000B:
+	.byte	$28,$31,$20,$32,$20,$33,$20,$34,$29,$00
+S0002:
+	.byte	$74,$65,$73,$74,$20,$25,$73,$0A,$00
+S0001:
+	.byte	$74,$65,$73,$74,$20,$31,$0A,$00
+S0012	:=	S0005+7
+S0011	:=	S0005+7
+S000A:
+	.byte	$73,$74,$00
+S000E:
+	.byte	$25,$78,$00
+S000D:
+	.byte	$25,$64,$00
+S0006:
+	.byte	$74,$65,$00
+S0007	:=	S000A+0
+S000C	:=	S0005+7
+S0009	:=	S0006+0
+S000F:
+	.byte	$25,$73,$00
+S0003:
+	.byte	$32,$00
+
+; ---------------------------------------------------------------
+; int __near__ print (char *fmt, ...)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_print: near
+
+.segment	"CODE"
+
+	jsr     enter
+	jsr     decsp2
+	ldy     #$02
+	lda     (sp),y
+	jsr     leaa0sp
+	ina
+	bne     L0002
+	inx
+L0002:	jsr     stax0sp
+	jmp     L0003
+L0006:	ldy     #$02
+	lda     (sp),y
+	jsr     leaa0sp
+	ina
+	bne     L000B
+	inx
+L000B:	sta     ptr1
+	stx     ptr1+1
+	dey
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1)
+	cmp     #$25
+	jne     L000A
+	iny
+	lda     (sp),y
+	jsr     leaa0sp
+	ina
+	bne     L000C
+	inx
+L000C:	jsr     pushax
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1)
+	ina
+	bne     L001C
+	inx
+L001C:	jsr     staxspidx
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1)
+	cmp     #$66
+	bcs     L0018
+	cmp     #$62
+	beq     L0010
+	cmp     #$63
+	beq     L0011
+	cmp     #$64
+	beq     L0012
+	jmp     L0016
+L0018:	jeq     L0015
+	cmp     #$73
+	beq     L0014
+	cmp     #$77
+	beq     L0013
+	jmp     L0016
+L0010:	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldy     #$02
+	jmp     L001B
+L0011:	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	tay
+	jsr     subeqysp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	jmp     L0020
+L0012:	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	tay
+	jsr     subeqysp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	bra     L0020
+L0013:	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	tay
+	jsr     subeqysp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	bra     L0020
+L0014:	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	tay
+	jsr     subeqysp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	bra     L0020
+L0015:	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	ldx     #$00
+	lda     #$04
+	ldy     #$02
+	jsr     subeqysp
+	jsr     ldeaxi
+	jsr     pusheax
+	ldy     #$06
+	bra     L001B
+L0016:	lda     #<(S0011)
+	ldx     #>(S0011)
+	bra     L0032
+L000A:	lda     #<(S0012)
+	ldx     #>(S0012)
+L0032:	jsr     pushax
+	ldy     #$04
+	lda     (sp),y
+	jsr     leaa0sp
+	clc
+	adc     #$03
+	bcc     L001A
+	inx
+L001A:	sta     ptr1
+	stx     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	sta     ptr1
+	stx     ptr1+1
+	ldx     #$00
+L0020:	lda     (ptr1)
+	jsr     pushax
+	ldy     #$04
+L001B:	jsr     _printf
+	ldy     #$02
+	lda     (sp),y
+	jsr     leaa0sp
+	ina
+	bne     L0008
+	inx
+L0008:	jsr     pushax
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1)
+	sta     regsave
+	stx     regsave+1
+	ina
+	bne     L001D
+	inx
+L001D:	jsr     staxspidx
+L0003:	ldy     #$02
+	lda     (sp),y
+	jsr     leaa0sp
+	ina
+	bne     L0007
+	inx
+L0007:	sta     ptr1
+	stx     ptr1+1
+	dey
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	sta     ptr1
+	stx     ptr1+1
+	ldx     #$00
+	lda     (ptr1)
+	jne     L0006
+	iny
+	jmp     leavey
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$02
+	jsr     _print
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$04
+	jsr     _print
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     #$03
+	jsr     pusha0
+	lda     #$0A
+	jsr     pusha0
+	ldy     #$06
+	jsr     _print
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	lda     #$0A
+	jsr     pusha0
+	tay
+	jsr     _print
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldx     #$00
+	lda     #$05
+	jsr     push0ax
+	lda     #$0A
+	jsr     pusha0
+	ldy     #$0C
+	jsr     _print
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
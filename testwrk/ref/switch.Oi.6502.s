@@ -0,0 +1,803 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_testbig
+	.export		_testbackslash
+	.export		_backslash
+	.export		_f
+	.export		_g
+	.export		_h
+	.export		_limit
+	.export		_big
+	.export		_main
+
+.segment	"RODATA"
+
+S001D:
+	.byte	$78,$20,$3D,$20,$30,$78,$25,$6C,$78,$20,$28,$64,$65,$66,$61,$75
+	.byte	$6C,$74,$29,$0A,$00
+S0019:
+	.byte	$25,$64,$20,$64,$65,$66,$61,$75,$6C,$74,$73,$0A,$00
+S001A:
+	.byte	$78,$20,$3D,$20,$30,$78,$25,$6C,$78,$0A,$00
+S001C	:=	S001A+0
+S001B	:=	S001A+0
+S0002:
+	.byte	$25,$63,$20,$3D,$20,$25,$63,$0A,$00
+S0004:
+	.byte	$78,$20,$3D,$20,$25,$64,$0A,$00
+S0018:
+	.byte	$69,$20,$3D,$20,$25,$64,$0A,$00
+S0017	:=	S0018+0
+S0016	:=	S0018+0
+S0015	:=	S0018+0
+S000D	:=	S0018+0
+S000E	:=	S0018+0
+S000F	:=	S0018+0
+S0010	:=	S0018+0
+S0011	:=	S0018+0
+S0012	:=	S0018+0
+S0013	:=	S0018+0
+S0014	:=	S0018+0
+S0001:
+	.byte	$62,$66,$6E,$72,$74,$76,$78,$00
+S000B:
+	.byte	$36,$20,$25,$64,$0A,$00
+S000A:
+	.byte	$35,$20,$25,$64,$0A,$00
+S0009:
+	.byte	$64,$20,$25,$64,$0A,$00
+S0008:
+	.byte	$33,$20,$25,$64,$0A,$00
+S0006:
+	.byte	$31,$20,$25,$64,$0A,$00
+S0007:
+	.byte	$32,$20,$25,$64,$0A,$00
+S0003:
+	.byte	$66,$3A,$0A,$00
+S0005:
+	.byte	$67,$3A,$0A,$00
+S000C:
+	.byte	$68,$3A,$0A,$00
+S0023:
+	.byte	$35,$0A,$00
+S0024:
+	.byte	$30,$0A,$00
+S0025:
+	.byte	$31,$0A,$00
+S0026:
+	.byte	$32,$0A,$00
+S0027:
+	.byte	$33,$0A,$00
+S0028:
+	.byte	$34,$0A,$00
+S0029	:=	S0023+0
+S0021	:=	S0027+0
+S0020	:=	S0026+0
+S001F	:=	S0025+0
+S001E	:=	S0024+0
+S0022	:=	S0028+0
+
+; ---------------------------------------------------------------
+; int __near__ testbig (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_testbig: near
+
+.segment	"CODE"
+
+	jsr     decsp4
+	ldy     #$00
+	tya
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$01
+	iny
+	sta     (sp),y
+	jmp     L0006
+L0005:	jsr     ldeax0sp
+	jsr     _big
+	ldx     #$00
+	stx     sreg
+	lda     #$01
+	sta     sreg+1
+	lsr     a
+	jsr     laddeq0sp
+L0006:	jsr     ldeax0sp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$07
+	sta     sreg+1
+	txa
+	jsr     tosandeax
+	jsr     tsteax
+	bne     L0005
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ testbackslash (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_testbackslash: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     stax0sp
+	jmp     L0002
+L0005:	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$03
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldx     #$00
+	lda     (ptr1,x)
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	lda     (ptr1,x)
+	jsr     _backslash
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+L0002:	ldy     #$01
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldx     #$00
+	lda     (ptr1),y
+	bne     L0005
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ backslash (int c)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_backslash: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$01
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cpx     #$00
+	bne     L0003
+	cmp     #$72
+	bcs     L000B
+	cmp     #$62
+	beq     L0001
+	cmp     #$66
+	beq     L0001
+	cmp     #$6E
+	beq     L0001
+	jmp     L0017
+L000B:	beq     L0012
+	cmp     #$74
+	beq     L0001
+	cmp     #$76
+	beq     L0001
+	jmp     L0017
+L0012:	lda     #$72
+	jmp     L0001
+L0003:	ldx     #$00
+L0017:	lda     #$78
+L0001:	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ f (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	jsr     push0
+	jsr     decsp2
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldy     #$04
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L0018
+L0005:	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     stax0sp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cpx     #$00
+	bne     L0008
+	cmp     #$10
+	bcs     L0014
+	cmp     #$07
+	bcs     L0015
+	cmp     #$01
+	beq     L0012
+	cmp     #$02
+	beq     L0012
+	jmp     L0008
+L0015:	beq     L0012
+	cmp     #$08
+	beq     L0012
+	cmp     #$09
+	beq     L0012
+	jmp     L0008
+L0014:	cmp     #$12
+	bcs     L0016
+	cmp     #$10
+	beq     L0012
+	jmp     L0012
+L0016:	beq     L0012
+	cmp     #$13
+	beq     L0012
+	cmp     #$14
+	bne     L0008
+L0012:	iny
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$02
+	jsr     staxysp
+L0008:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$05
+L0018:	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cmp     #$15
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	tax
+	rol     a
+	jne     L0005
+	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ g (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_g: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldy     #$00
+	lda     #$01
+	sta     (sp),y
+	tya
+	iny
+	sta     (sp),y
+	jmp     L0013
+L0005:	ldy     #$01
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cpx     #$00
+	bne     L000F
+	cmp     #$01
+	bcc     L000C
+	cmp     #$03
+	bcc     L0009
+	cmp     #$06
+	bcc     L000A
+	cmp     #$09
+	bcc     L000B
+	jmp     L000C
+L000F:	cpx     #$03
+	bne     L0010
+	cmp     #$E9
+	bcc     L000C
+	cmp     #$ED
+	bcc     L000D
+	jmp     L000C
+L0010:	cpx     #$0B
+	bne     L000C
+	cmp     #$B9
+	bcc     L000C
+	cmp     #$BD
+	bcc     L000E
+	jmp     L000C
+L0009:	lda     #<(S0006)
+	ldx     #>(S0006)
+	jmp     L0018
+L000A:	lda     #<(S0007)
+	ldx     #>(S0007)
+	jmp     L0018
+L000B:	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L000C:	lda     #<(S0009)
+	ldx     #>(S0009)
+	jmp     L0018
+L000D:	lda     #<(S000A)
+	ldx     #>(S000A)
+	jmp     L0018
+L000E:	lda     #<(S000B)
+	ldx     #>(S000B)
+L0018:	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	ldy     #$01
+L0013:	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cmp     #$0B
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	tya
+	tax
+	rol     a
+	jne     L0005
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ h (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_h: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	jsr     push0
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldy     #$02
+	lda     #$01
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	jmp     L001C
+L0005:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cpx     #$00
+	bne     L0016
+	cmp     #$78
+	bcs     L0017
+	cmp     #$08
+	beq     L000C
+	cmp     #$10
+	beq     L000B
+	jmp     L0009
+L0017:	beq     L000D
+	cmp     #$80
+	beq     L000A
+	cmp     #$F8
+	beq     L0010
+	jmp     L0009
+L0016:	cpx     #$01
+	bne     L0009
+	cmp     #$20
+	bcs     L0019
+	cmp     #$08
+	beq     L000F
+	cmp     #$10
+	beq     L0011
+	cmp     #$18
+	beq     L000E
+	jmp     L0009
+L0019:	cmp     #$30
+	bcs     L001A
+	cmp     #$20
+	beq     L0014
+	cmp     #$28
+	beq     L0013
+	jmp     L0009
+L001A:	beq     L0012
+	cmp     #$38
+	beq     L0015
+L0009:	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	jmp     L0008
+L000A:	lda     #<(S000D)
+	ldx     #>(S000D)
+	jmp     L0021
+L000B:	lda     #<(S000E)
+	ldx     #>(S000E)
+	jmp     L0021
+L000C:	lda     #<(S000F)
+	ldx     #>(S000F)
+	jmp     L0021
+L000D:	lda     #<(S0010)
+	ldx     #>(S0010)
+	jmp     L0021
+L000E:	lda     #<(S0011)
+	ldx     #>(S0011)
+	jmp     L0021
+L000F:	lda     #<(S0012)
+	ldx     #>(S0012)
+	jmp     L0021
+L0010:	lda     #<(S0013)
+	ldx     #>(S0013)
+	jmp     L0021
+L0011:	lda     #<(S0014)
+	ldx     #>(S0014)
+	jmp     L0021
+L0012:	lda     #<(S0015)
+	ldx     #>(S0015)
+	jmp     L0021
+L0013:	lda     #<(S0016)
+	ldx     #>(S0016)
+	jmp     L0021
+L0014:	lda     #<(S0017)
+	ldx     #>(S0017)
+	jmp     L0021
+L0015:	lda     #<(S0018)
+	ldx     #>(S0018)
+L0021:	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0008:	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$03
+L001C:	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cmp     #$F5
+	txa
+	sbc     #$01
+	bvc     L0006
+	eor     #$80
+L0006:	jmi     L0005
+	lda     #<(S0019)
+	ldx     #>(S0019)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ limit (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_limit: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	ldy     #$00
+	tya
+	sta     (sp),y
+	lda     #$80
+	iny
+	sta     (sp),y
+	jmp     L0022
+L0005:	ldy     #$01
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cpx     #$80
+	bne     L000E
+	cmp     #$02
+	bcs     L0010
+	cmp     #$00
+	beq     L0009
+	jmp     L000A
+L0010:	beq     L000B
+	cmp     #$03
+	beq     L000C
+	cmp     #$04
+	beq     L000D
+	jmp     L000E
+L0009:	lda     #<(S001E)
+	ldx     #>(S001E)
+	jmp     L0026
+L000A:	lda     #<(S001F)
+	ldx     #>(S001F)
+	jmp     L0026
+L000B:	lda     #<(S0020)
+	ldx     #>(S0020)
+	jmp     L0026
+L000C:	lda     #<(S0021)
+	ldx     #>(S0021)
+	jmp     L0026
+L000D:	lda     #<(S0022)
+	ldx     #>(S0022)
+	jmp     L0026
+L000E:	lda     #<(S0023)
+	ldx     #>(S0023)
+L0026:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	ldy     #$01
+L0022:	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cmp     #$06
+	txa
+	sbc     #$80
+	bvc     L0006
+	eor     #$80
+L0006:	bmi     L0005
+	lda     #$FF
+	sta     (sp),y
+	lda     #$7F
+	iny
+	sta     (sp),y
+	jmp     L0023
+L0014:	ldy     #$01
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cpx     #$7F
+	bne     L001D
+	cmp     #$FD
+	bcs     L001F
+	cmp     #$FB
+	beq     L001C
+	cmp     #$FC
+	beq     L001B
+	jmp     L001D
+L001F:	beq     L001A
+	cmp     #$FE
+	beq     L0019
+	lda     #<(S0024)
+	ldx     #>(S0024)
+	jmp     L0027
+L0019:	lda     #<(S0025)
+	ldx     #>(S0025)
+	jmp     L0027
+L001A:	lda     #<(S0026)
+	ldx     #>(S0026)
+	jmp     L0027
+L001B:	lda     #<(S0027)
+	ldx     #>(S0027)
+	jmp     L0027
+L001C:	lda     #<(S0028)
+	ldx     #>(S0028)
+	jmp     L0027
+L001D:	lda     #<(S0029)
+	ldx     #>(S0029)
+L0027:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     subeq0sp
+	ldy     #$01
+L0023:	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cmp     #$FA
+	txa
+	sbc     #$7F
+	bvs     L0015
+	eor     #$80
+L0015:	asl     a
+	tya
+	tax
+	rol     a
+	bne     L0014
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ big (unsigned long x)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_big: near
+
+.segment	"CODE"
+
+	jsr     pusheax
+	jsr     ldeax0sp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$06
+	sta     sreg+1
+	txa
+	jsr     tosandeax
+	ldy     sreg+1
+	cpy     #$04
+	bcs     L0008
+	cpy     #$00
+	bne     L0009
+	ldy     sreg
+	cpy     #$00
+	bne     L0007
+	cpx     #$00
+	bne     L0007
+	cmp     #$00
+	beq     L0004
+	jmp     L0007
+L0009:	cpy     #$02
+	bne     L0007
+	ldy     sreg
+	cpy     #$00
+	bne     L0007
+	cpx     #$00
+	bne     L0007
+	cmp     #$00
+	beq     L0005
+	jmp     L0007
+L0008:	bne     L000F
+	ldy     sreg
+	cpy     #$00
+	bne     L0007
+	cpx     #$00
+	bne     L0007
+	cmp     #$00
+	beq     L0006
+	jmp     L0007
+L000F:	cpy     #$FF
+	bne     L0007
+	ldy     sreg
+	cpy     #$FF
+	bne     L0007
+	cpx     #$FF
+	bne     L0007
+	cmp     #$FE
+	bcc     L0007
+L0004:	lda     #<(S001A)
+	ldx     #>(S001A)
+	jmp     L001A
+L0005:	lda     #<(S001B)
+	ldx     #>(S001B)
+	jmp     L001A
+L0006:	lda     #<(S001C)
+	ldx     #>(S001C)
+	jmp     L001A
+L0007:	lda     #<(S001D)
+	ldx     #>(S001D)
+L001A:	jsr     pushax
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     _testbackslash
+	jsr     _f
+	jsr     _g
+	jsr     _h
+	jsr     _testbig
+	jsr     _limit
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
@@ -0,0 +1,1183 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "switch.c", 5408, 1613073744
+	.dbg		file, "common.h", 522, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/stdlib.h", 5999, 1613073744
+	.dbg		file, "/root/repo/include/limits.h", 3146, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_testbig
+	.export		_testbackslash
+	.export		_backslash
+	.export		_f
+	.export		_g
+	.export		_h
+	.export		_limit
+	.export		_big
+	.export		_main
+
+.segment	"RODATA"
+
+S001D:
+	.byte	$78,$20,$3D,$20,$30,$78,$25,$6C,$78,$20,$28,$64,$65,$66,$61,$75
+	.byte	$6C,$74,$29,$0A,$00
+S0019:
+	.byte	$25,$64,$20,$64,$65,$66,$61,$75,$6C,$74,$73,$0A,$00
+S001A:
+	.byte	$78,$20,$3D,$20,$30,$78,$25,$6C,$78,$0A,$00
+S001C	:=	S001A+0
+S001B	:=	S001A+0
+S0002:
+	.byte	$25,$63,$20,$3D,$20,$25,$63,$0A,$00
+S0004:
+	.byte	$78,$20,$3D,$20,$25,$64,$0A,$00
+S0018:
+	.byte	$69,$20,$3D,$20,$25,$64,$0A,$00
+S0017	:=	S0018+0
+S0016	:=	S0018+0
+S0015	:=	S0018+0
+S000D	:=	S0018+0
+S000E	:=	S0018+0
+S000F	:=	S0018+0
+S0010	:=	S0018+0
+S0011	:=	S0018+0
+S0012	:=	S0018+0
+S0013	:=	S0018+0
+S0014	:=	S0018+0
+S0001:
+	.byte	$62,$66,$6E,$72,$74,$76,$78,$00
+S000B:
+	.byte	$36,$20,$25,$64,$0A,$00
+S000A:
+	.byte	$35,$20,$25,$64,$0A,$00
+S0009:
+	.byte	$64,$20,$25,$64,$0A,$00
+S0008:
+	.byte	$33,$20,$25,$64,$0A,$00
+S0006:
+	.byte	$31,$20,$25,$64,$0A,$00
+S0007:
+	.byte	$32,$20,$25,$64,$0A,$00
+S0003:
+	.byte	$66,$3A,$0A,$00
+S0005:
+	.byte	$67,$3A,$0A,$00
+S000C:
+	.byte	$68,$3A,$0A,$00
+S0023:
+	.byte	$35,$0A,$00
+S0024:
+	.byte	$30,$0A,$00
+S0025:
+	.byte	$31,$0A,$00
+S0026:
+	.byte	$32,$0A,$00
+S0027:
+	.byte	$33,$0A,$00
+S0028:
+	.byte	$34,$0A,$00
+S0029	:=	S0023+0
+S0021	:=	S0027+0
+S0020	:=	S0026+0
+S001F	:=	S0025+0
+S001E	:=	S0024+0
+S0022	:=	S0028+0
+
+; ---------------------------------------------------------------
+; int __near__ testbig (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_testbig: near
+
+	.dbg	func, "testbig", "00", extern, "_testbig"
+	.dbg	sym, "i", "00", auto, -4
+
+.segment	"CODE"
+
+	.dbg	line, "switch.c", 49
+	jsr     decsp4
+	ldx     #$00
+	stx     sreg
+	lda     #$01
+	sta     sreg+1
+	lda     #$00
+	ldy     #$00
+	jsr     steaxysp
+	jmp     L0002
+	.dbg	line, "switch.c", 51
+L0005:	ldy     #$03
+	jsr     ldeaxysp
+	jsr     _big
+	.dbg	line, "switch.c", 49
+	ldx     #$00
+	stx     sreg
+	lda     #$01
+	sta     sreg+1
+	lda     #$00
+	ldy     #$00
+	jsr     laddeqysp
+	jmp     L0002
+L0002:	ldy     #$03
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$07
+	sta     sreg+1
+	lda     #$00
+	jsr     tosandeax
+	jsr     tsteax
+	jne     L0005
+	.dbg	line, "switch.c", 53
+	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ testbackslash (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_testbackslash: near
+
+	.dbg	func, "testbackslash", "00", extern, "_testbackslash"
+	.dbg	sym, "s", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "switch.c", 70
+	jsr     decsp2
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	ldy     #$00
+	jsr     staxysp
+	jmp     L0002
+	.dbg	line, "switch.c", 72
+L0005:	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	jsr     _backslash
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "switch.c", 70
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	jne     L0005
+	.dbg	line, "switch.c", 74
+	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ backslash (int c)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_backslash: near
+
+	.dbg	func, "backslash", "00", extern, "_backslash"
+	.dbg	sym, "c", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "switch.c", 77
+	jsr     pushax
+	.dbg	line, "switch.c", 78
+	ldy     #$01
+	jsr     ldaxysp
+	.dbg	line, "switch.c", 79
+	jmp     L0002
+	.dbg	line, "switch.c", 92
+L0002:	cpx     #$00
+	jne     L000A
+	cmp     #$72
+	jcs     L000B
+	cmp     #$62
+	jeq     L0004
+	cmp     #$66
+	jeq     L0005
+	cmp     #$6E
+	jeq     L0006
+	jmp     L0003
+L000B:	jeq     L0007
+	cmp     #$74
+	jeq     L0008
+	cmp     #$76
+	jeq     L0009
+	jmp     L0003
+L000A:	jmp     L0003
+	.dbg	line, "switch.c", 81
+L0004:	ldx     #$00
+	lda     #$62
+	jmp     L0001
+	.dbg	line, "switch.c", 83
+L0005:	ldx     #$00
+	lda     #$66
+	jmp     L0001
+	.dbg	line, "switch.c", 85
+L0006:	ldx     #$00
+	lda     #$6E
+	jmp     L0001
+	.dbg	line, "switch.c", 87
+L0007:	ldx     #$00
+	lda     #$72
+	jmp     L0001
+	.dbg	line, "switch.c", 89
+L0008:	ldx     #$00
+	lda     #$74
+	jmp     L0001
+	.dbg	line, "switch.c", 91
+L0009:	ldx     #$00
+	lda     #$76
+	jmp     L0001
+	.dbg	line, "switch.c", 94
+L0003:	ldx     #$00
+	lda     #$78
+	jmp     L0001
+	.dbg	line, "switch.c", 95
+L0001:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ f (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f: near
+
+	.dbg	func, "f", "00", extern, "_f"
+	.dbg	sym, "i", "00", auto, -2
+	.dbg	sym, "x", "00", auto, -4
+	.dbg	sym, "y", "00", auto, -6
+
+.segment	"CODE"
+
+	.dbg	line, "switch.c", 98
+	jsr     decsp2
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	.dbg	line, "switch.c", 100
+	jsr     decsp2
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "switch.c", 101
+	ldx     #$00
+	lda     #$00
+	ldy     #$04
+	jsr     staxysp
+	jmp     L0002
+	.dbg	line, "switch.c", 102
+L0005:	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "switch.c", 103
+	ldy     #$05
+	jsr     ldaxysp
+	jmp     L0007
+	.dbg	line, "switch.c", 114
+L0007:	cpx     #$00
+	jne     L0013
+	cmp     #$10
+	jcs     L0014
+	cmp     #$07
+	jcs     L0015
+	cmp     #$01
+	jeq     L0009
+	cmp     #$02
+	jeq     L000A
+	jmp     L0008
+L0015:	jeq     L000B
+	cmp     #$08
+	jeq     L000C
+	cmp     #$09
+	jeq     L000D
+	jmp     L0008
+L0014:	cmp     #$12
+	jcs     L0016
+	cmp     #$10
+	jeq     L000E
+	jmp     L000F
+L0016:	jeq     L0010
+	cmp     #$13
+	jeq     L0011
+	cmp     #$14
+	jeq     L0012
+	jmp     L0008
+L0013:	jmp     L0008
+	.dbg	line, "switch.c", 104
+L0009:	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     staxysp
+	jmp     L0008
+	.dbg	line, "switch.c", 105
+L000A:	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     staxysp
+	jmp     L0008
+	.dbg	line, "switch.c", 106
+L000B:	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     staxysp
+	jmp     L0008
+	.dbg	line, "switch.c", 107
+L000C:	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     staxysp
+	jmp     L0008
+	.dbg	line, "switch.c", 108
+L000D:	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     staxysp
+	jmp     L0008
+	.dbg	line, "switch.c", 109
+L000E:	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     staxysp
+	jmp     L0008
+	.dbg	line, "switch.c", 110
+L000F:	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     staxysp
+	jmp     L0008
+	.dbg	line, "switch.c", 111
+L0010:	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     staxysp
+	jmp     L0008
+	.dbg	line, "switch.c", 112
+L0011:	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     staxysp
+	jmp     L0008
+	.dbg	line, "switch.c", 113
+L0012:	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     staxysp
+	jmp     L0008
+	.dbg	line, "switch.c", 115
+L0008:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "switch.c", 101
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0002:	ldy     #$05
+	jsr     ldaxysp
+	cmp     #$15
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0005
+	.dbg	line, "switch.c", 117
+	jsr     incsp6
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ g (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_g: near
+
+	.dbg	func, "g", "00", extern, "_g"
+	.dbg	sym, "i", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "switch.c", 122
+	jsr     decsp2
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "switch.c", 123
+	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	jsr     staxysp
+	jmp     L0002
+	.dbg	line, "switch.c", 124
+L0005:	ldy     #$01
+	jsr     ldaxysp
+	jmp     L0007
+	.dbg	line, "switch.c", 134
+L0007:	cpx     #$00
+	jne     L000F
+	cmp     #$01
+	jcc     L000C
+	cmp     #$03
+	jcc     L0009
+	cmp     #$06
+	jcc     L000A
+	cmp     #$09
+	jcc     L000B
+	jmp     L000C
+L000F:	cpx     #$03
+	jne     L0010
+	cmp     #$E9
+	jcc     L000C
+	cmp     #$ED
+	jcc     L000D
+	jmp     L000C
+L0010:	cpx     #$0B
+	jne     L0011
+	cmp     #$B9
+	jcc     L000C
+	cmp     #$BD
+	jcc     L000E
+	jmp     L000C
+L0011:	jmp     L000C
+	.dbg	line, "switch.c", 125
+L0009:	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jmp     L0008
+	.dbg	line, "switch.c", 126
+L000A:	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jmp     L0008
+	.dbg	line, "switch.c", 127
+L000B:	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "switch.c", 129
+L000C:	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jmp     L0008
+	.dbg	line, "switch.c", 131
+L000D:	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jmp     L0008
+	.dbg	line, "switch.c", 133
+L000E:	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jmp     L0008
+	.dbg	line, "switch.c", 123
+L0008:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	cmp     #$0B
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0005
+	.dbg	line, "switch.c", 135
+	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ h (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_h: near
+
+	.dbg	func, "h", "00", extern, "_h"
+	.dbg	sym, "i", "00", auto, -2
+	.dbg	sym, "n", "00", auto, -4
+
+.segment	"CODE"
+
+	.dbg	line, "switch.c", 139
+	jsr     decsp2
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	.dbg	line, "switch.c", 141
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "switch.c", 142
+	ldx     #$00
+	lda     #$01
+	ldy     #$02
+	jsr     staxysp
+	jmp     L0002
+	.dbg	line, "switch.c", 143
+L0005:	ldy     #$03
+	jsr     ldaxysp
+	jmp     L0007
+	.dbg	line, "switch.c", 157
+L0007:	cpx     #$00
+	jne     L0016
+	cmp     #$78
+	jcs     L0017
+	cmp     #$08
+	jeq     L000C
+	cmp     #$10
+	jeq     L000B
+	jmp     L0009
+L0017:	jeq     L000D
+	cmp     #$80
+	jeq     L000A
+	cmp     #$F8
+	jeq     L0010
+	jmp     L0009
+L0016:	cpx     #$01
+	jne     L0018
+	cmp     #$20
+	jcs     L0019
+	cmp     #$08
+	jeq     L000F
+	cmp     #$10
+	jeq     L0011
+	cmp     #$18
+	jeq     L000E
+	jmp     L0009
+L0019:	jeq     L0014
+	cmp     #$28
+	jeq     L0013
+	cmp     #$30
+	jeq     L0012
+	cmp     #$38
+	jeq     L0015
+	jmp     L0009
+L0018:	jmp     L0009
+	.dbg	line, "switch.c", 144
+L0009:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0008
+	.dbg	line, "switch.c", 145
+L000A:	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jmp     L0008
+	.dbg	line, "switch.c", 146
+L000B:	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jmp     L0008
+	.dbg	line, "switch.c", 147
+L000C:	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jmp     L0008
+	.dbg	line, "switch.c", 148
+L000D:	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jmp     L0008
+	.dbg	line, "switch.c", 149
+L000E:	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jmp     L0008
+	.dbg	line, "switch.c", 150
+L000F:	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jmp     L0008
+	.dbg	line, "switch.c", 151
+L0010:	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jmp     L0008
+	.dbg	line, "switch.c", 152
+L0011:	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jmp     L0008
+	.dbg	line, "switch.c", 153
+L0012:	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jmp     L0008
+	.dbg	line, "switch.c", 154
+L0013:	lda     #<(S0016)
+	ldx     #>(S0016)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jmp     L0008
+	.dbg	line, "switch.c", 155
+L0014:	lda     #<(S0017)
+	ldx     #>(S0017)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jmp     L0008
+	.dbg	line, "switch.c", 156
+L0015:	lda     #<(S0018)
+	ldx     #>(S0018)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jmp     L0008
+	.dbg	line, "switch.c", 142
+L0008:	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0002:	ldy     #$03
+	jsr     ldaxysp
+	cmp     #$F5
+	txa
+	sbc     #$01
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0005
+	.dbg	line, "switch.c", 158
+	lda     #<(S0019)
+	ldx     #>(S0019)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "switch.c", 159
+	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ limit (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_limit: near
+
+	.dbg	func, "limit", "00", extern, "_limit"
+	.dbg	sym, "i", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "switch.c", 198
+	jsr     decsp2
+	ldx     #$80
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+	jmp     L0002
+	.dbg	line, "switch.c", 200
+L0005:	ldy     #$01
+	jsr     ldaxysp
+	jmp     L0007
+	.dbg	line, "switch.c", 207
+L0007:	cpx     #$80
+	jne     L000F
+	cmp     #$02
+	jcs     L0010
+	cmp     #$00
+	jeq     L0009
+	jmp     L000A
+L0010:	jeq     L000B
+	cmp     #$03
+	jeq     L000C
+	cmp     #$04
+	jeq     L000D
+	jmp     L000E
+L000F:	jmp     L000E
+	.dbg	line, "switch.c", 201
+L0009:	lda     #<(S001E)
+	ldx     #>(S001E)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0008
+	.dbg	line, "switch.c", 202
+L000A:	lda     #<(S001F)
+	ldx     #>(S001F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0008
+	.dbg	line, "switch.c", 203
+L000B:	lda     #<(S0020)
+	ldx     #>(S0020)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0008
+	.dbg	line, "switch.c", 204
+L000C:	lda     #<(S0021)
+	ldx     #>(S0021)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0008
+	.dbg	line, "switch.c", 205
+L000D:	lda     #<(S0022)
+	ldx     #>(S0022)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0008
+	.dbg	line, "switch.c", 206
+L000E:	lda     #<(S0023)
+	ldx     #>(S0023)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0008
+	.dbg	line, "switch.c", 198
+L0008:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	cmp     #$06
+	txa
+	sbc     #$80
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0005
+	.dbg	line, "switch.c", 208
+	ldx     #$7F
+	lda     #$FF
+	ldy     #$00
+	jsr     staxysp
+	jmp     L0011
+	.dbg	line, "switch.c", 209
+L0014:	ldy     #$01
+	jsr     ldaxysp
+	jmp     L0016
+	.dbg	line, "switch.c", 216
+L0016:	cpx     #$7F
+	jne     L001E
+	cmp     #$FD
+	jcs     L001F
+	cmp     #$FB
+	jeq     L001C
+	cmp     #$FC
+	jeq     L001B
+	jmp     L001D
+L001F:	jeq     L001A
+	cmp     #$FE
+	jeq     L0019
+	jmp     L0018
+L001E:	jmp     L001D
+	.dbg	line, "switch.c", 210
+L0018:	lda     #<(S0024)
+	ldx     #>(S0024)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0017
+	.dbg	line, "switch.c", 211
+L0019:	lda     #<(S0025)
+	ldx     #>(S0025)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0017
+	.dbg	line, "switch.c", 212
+L001A:	lda     #<(S0026)
+	ldx     #>(S0026)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0017
+	.dbg	line, "switch.c", 213
+L001B:	lda     #<(S0027)
+	ldx     #>(S0027)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0017
+	.dbg	line, "switch.c", 214
+L001C:	lda     #<(S0028)
+	ldx     #>(S0028)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0017
+	.dbg	line, "switch.c", 215
+L001D:	lda     #<(S0029)
+	ldx     #>(S0029)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0017
+	.dbg	line, "switch.c", 208
+L0017:	ldy     #$01
+	jsr     ldaxysp
+	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	jsr     subeqysp
+	jmp     L0011
+L0011:	ldy     #$01
+	jsr     ldaxysp
+	cmp     #$FA
+	txa
+	sbc     #$7F
+	bvs     L0015
+	eor     #$80
+L0015:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0014
+	.dbg	line, "switch.c", 217
+	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ big (unsigned long x)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_big: near
+
+	.dbg	func, "big", "00", extern, "_big"
+	.dbg	sym, "x", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "switch.c", 174
+	jsr     pusheax
+	.dbg	line, "switch.c", 181
+	ldy     #$03
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$06
+	sta     sreg+1
+	lda     #$00
+	jsr     tosandeax
+	jmp     L0002
+	.dbg	line, "switch.c", 192
+L0002:	ldy     sreg+1
+	cpy     #$00
+	jne     L0008
+	ldy     sreg
+	cpy     #$00
+	jne     L0009
+	cpx     #$00
+	jne     L000A
+	cmp     #$00
+	jeq     L0004
+	jmp     L0007
+L000A:	jmp     L0007
+L0009:	jmp     L0007
+L0008:	cpy     #$02
+	jne     L000B
+	ldy     sreg
+	cpy     #$00
+	jne     L000C
+	cpx     #$00
+	jne     L000D
+	cmp     #$00
+	jeq     L0005
+	jmp     L0007
+L000D:	jmp     L0007
+L000C:	jmp     L0007
+L000B:	cpy     #$04
+	jne     L000E
+	ldy     sreg
+	cpy     #$00
+	jne     L000F
+	cpx     #$00
+	jne     L0010
+	cmp     #$00
+	jeq     L0006
+	jmp     L0007
+L0010:	jmp     L0007
+L000F:	jmp     L0007
+L000E:	cpy     #$FF
+	jne     L0011
+	ldy     sreg
+	cpy     #$FF
+	jne     L0012
+	cpx     #$FF
+	jne     L0013
+	cmp     #$FE
+	jcc     L0007
+	jmp     L0004
+L0013:	jmp     L0007
+L0012:	jmp     L0007
+L0011:	jmp     L0007
+	.dbg	line, "switch.c", 185
+L0004:	lda     #<(S001A)
+	ldx     #>(S001A)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+	jmp     L0003
+	.dbg	line, "switch.c", 187
+L0005:	lda     #<(S001B)
+	ldx     #>(S001B)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+	jmp     L0003
+	.dbg	line, "switch.c", 189
+L0006:	lda     #<(S001C)
+	ldx     #>(S001C)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+	jmp     L0003
+	.dbg	line, "switch.c", 191
+L0007:	lda     #<(S001D)
+	ldx     #>(S001D)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+	jmp     L0003
+	.dbg	line, "switch.c", 193
+L0003:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "switch.c", 31
+	jsr     _testbackslash
+	.dbg	line, "switch.c", 32
+	jsr     _f
+	.dbg	line, "switch.c", 33
+	jsr     _g
+	.dbg	line, "switch.c", 34
+	jsr     _h
+	.dbg	line, "switch.c", 35
+	jsr     _testbig
+	.dbg	line, "switch.c", 36
+	jsr     _limit
+	.dbg	line, "switch.c", 38
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "switch.c", 39
+L0001:	rts
+
+	.dbg	line
+.endproc
+
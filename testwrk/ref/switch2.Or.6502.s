@@ -0,0 +1,367 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_testlimits
+	.export		_testdefault1
+	.export		_testdefault2
+	.export		_main
+
+.segment	"RODATA"
+
+S0007:
+	.byte	$3E,$3E,$3E,$64,$65,$66,$61,$75,$6C,$74,$0A,$00
+S0009	:=	S0007+0
+S0004:
+	.byte	$6D,$69,$6E,$0A,$00
+S0003:
+	.byte	$6D,$61,$78,$0A,$00
+S0006:
+	.byte	$3E,$25,$64,$0A,$00
+S0008	:=	S0006+0
+S0002:
+	.byte	$2D,$31,$0A,$00
+S0001:
+	.byte	$25,$64,$3A,$00
+S0005	:=	S0007+10
+
+; ---------------------------------------------------------------
+; void __near__ testlimits (int i)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_testlimits: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	jsr     ldax0sp
+	cpx     #$7F
+	bne     L0007
+	cmp     #$FF
+	beq     L0005
+	jmp     L0003
+L0007:	cpx     #$80
+	bne     L0008
+	cmp     #$00
+	beq     L0006
+	jmp     L0003
+L0008:	cpx     #$FF
+	bne     L0003
+	cmp     #$FF
+	bne     L0003
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jmp     L000C
+L0005:	lda     #<(S0003)
+	ldx     #>(S0003)
+	jmp     L000C
+L0006:	lda     #<(S0004)
+	ldx     #>(S0004)
+L000C:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+L0003:	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ testdefault1 (unsigned char i)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_testdefault1: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	jsr     decsp1
+	jmp     L0002
+L0035:	lda     (sp),y
+	ldy     #$00
+	sta     (sp),y
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$03
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldy     #$01
+	clc
+	tya
+	adc     (sp),y
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	cmp     #$0D
+	bcs     L002D
+	cmp     #$07
+	bcs     L002E
+	cmp     #$04
+	bcs     L002F
+	cmp     #$01
+	jeq     L0002
+	cmp     #$02
+	jeq     L0002
+	cmp     #$03
+	jeq     L0002
+	jmp     L002C
+L002F:	jeq     L0002
+	cmp     #$05
+	jeq     L0002
+	jmp     L0002
+L002E:	cmp     #$0A
+	bcs     L0030
+	cmp     #$07
+	jeq     L0002
+	cmp     #$08
+	beq     L0002
+	jmp     L0002
+L0030:	beq     L0002
+	cmp     #$0B
+	beq     L0002
+	jmp     L0002
+L002D:	cmp     #$14
+	bcs     L0031
+	cmp     #$11
+	bcs     L0032
+	cmp     #$0D
+	beq     L0002
+	cmp     #$0E
+	beq     L0002
+	cmp     #$0F
+	beq     L0002
+	jmp     L002C
+L0032:	beq     L0002
+	cmp     #$12
+	beq     L0002
+	jmp     L0002
+L0031:	cmp     #$17
+	bcs     L0033
+	cmp     #$14
+	beq     L0002
+	cmp     #$15
+	beq     L0002
+	jmp     L0002
+L0033:	beq     L0002
+	cmp     #$18
+	beq     L0036
+	cmp     #$64
+	beq     L0002
+	jmp     L002C
+L0036:	lda     (sp),y
+	cmp     #$04
+	bcs     L002A
+	cmp     #$01
+	beq     L0002
+	cmp     #$02
+	beq     L0002
+	cmp     #$03
+	beq     L0002
+	jmp     L0002
+L002A:	cmp     #$06
+	bcc     L0002
+	cmp     #$08
+	bcc     L0002
+	cmp     #$0A
+	bcs     L0002
+	jmp     L0002
+L002C:	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+L0002:	ldy     #$01
+	lda     (sp),y
+	cmp     #$FE
+	jcc     L0035
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ testdefault2 (unsigned char i)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_testdefault2: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	jsr     decsp1
+	jmp     L0002
+L0033:	lda     (sp),y
+	ldy     #$00
+	sta     (sp),y
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$03
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldy     #$01
+	clc
+	tya
+	adc     (sp),y
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	cmp     #$0D
+	bcs     L002B
+	cmp     #$07
+	bcs     L002C
+	cmp     #$04
+	bcs     L002D
+	cmp     #$01
+	jeq     L0002
+	cmp     #$02
+	jeq     L0002
+	cmp     #$03
+	jeq     L0002
+	jmp     L002A
+L002D:	jeq     L0002
+	cmp     #$05
+	jeq     L0002
+	jmp     L0002
+L002C:	cmp     #$0A
+	bcs     L002E
+	cmp     #$07
+	jeq     L0002
+	cmp     #$08
+	jeq     L0002
+	jmp     L0002
+L002E:	beq     L0002
+	cmp     #$0B
+	beq     L0002
+	jmp     L0002
+L002B:	cmp     #$14
+	bcs     L002F
+	cmp     #$11
+	bcs     L0030
+	cmp     #$0D
+	beq     L0002
+	cmp     #$0E
+	beq     L0002
+	cmp     #$0F
+	beq     L0002
+	jmp     L002A
+L0030:	beq     L0002
+	cmp     #$12
+	beq     L0002
+	jmp     L0002
+L002F:	cmp     #$17
+	bcs     L0031
+	cmp     #$14
+	beq     L0002
+	cmp     #$15
+	beq     L0002
+	jmp     L0002
+L0031:	beq     L0002
+	cmp     #$18
+	beq     L0035
+	cmp     #$64
+	beq     L0002
+	cmp     #$AA
+	beq     L0002
+	jmp     L002A
+L0035:	lda     (sp),y
+	cmp     #$04
+	bcs     L0028
+	cmp     #$01
+	beq     L0002
+	cmp     #$02
+	beq     L0002
+	cmp     #$03
+	beq     L0002
+	jmp     L0002
+L0028:	cmp     #$06
+	bcc     L0002
+	cmp     #$08
+	bcc     L0002
+	cmp     #$0A
+	bcs     L0002
+	jmp     L0002
+L002A:	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+L0002:	ldy     #$01
+	lda     (sp),y
+	cmp     #$FE
+	jcc     L0033
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	ldx     #$7F
+	lda     #$FF
+	jsr     _testlimits
+	ldx     #$80
+	lda     #$00
+	jsr     _testlimits
+	ldx     #$FF
+	txa
+	jsr     _testlimits
+	lda     #$01
+	jsr     _testdefault1
+	lda     #$02
+	jsr     _testdefault1
+	lda     #$03
+	jsr     _testdefault1
+	lda     #$04
+	jsr     _testdefault1
+	lda     #$01
+	jsr     _testdefault2
+	lda     #$02
+	jsr     _testdefault2
+	lda     #$03
+	jsr     _testdefault2
+	lda     #$04
+	jsr     _testdefault2
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
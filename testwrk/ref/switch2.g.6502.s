@@ -0,0 +1,614 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "switch2.c", 6606, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_testlimits
+	.export		_testdefault1
+	.export		_testdefault2
+	.export		_main
+
+.segment	"RODATA"
+
+S0007:
+	.byte	$3E,$3E,$3E,$64,$65,$66,$61,$75,$6C,$74,$0A,$00
+S0009	:=	S0007+0
+S0004:
+	.byte	$6D,$69,$6E,$0A,$00
+S0003:
+	.byte	$6D,$61,$78,$0A,$00
+S0006:
+	.byte	$3E,$25,$64,$0A,$00
+S0008	:=	S0006+0
+S0002:
+	.byte	$2D,$31,$0A,$00
+S0001:
+	.byte	$25,$64,$3A,$00
+S0005	:=	S0007+10
+
+; ---------------------------------------------------------------
+; void __near__ testlimits (int i)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_testlimits: near
+
+	.dbg	func, "testlimits", "00", extern, "_testlimits"
+	.dbg	sym, "i", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "switch2.c", 11
+	jsr     pushax
+	.dbg	line, "switch2.c", 12
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "switch2.c", 14
+	ldy     #$01
+	jsr     ldaxysp
+	jmp     L0002
+	.dbg	line, "switch2.c", 35
+L0002:	cpx     #$7F
+	jne     L0007
+	cmp     #$FF
+	jeq     L0005
+	jmp     L0003
+L0007:	cpx     #$80
+	jne     L0008
+	cmp     #$00
+	jeq     L0006
+	jmp     L0003
+L0008:	cpx     #$FF
+	jne     L0009
+	cmp     #$FF
+	jeq     L0004
+	jmp     L0003
+L0009:	jmp     L0003
+	.dbg	line, "switch2.c", 18
+L0004:	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "switch2.c", 19
+	jmp     L0003
+	.dbg	line, "switch2.c", 26
+L0005:	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "switch2.c", 27
+	jmp     L0003
+	.dbg	line, "switch2.c", 33
+L0006:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "switch2.c", 34
+	jmp     L0003
+	.dbg	line, "switch2.c", 36
+L0003:	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "switch2.c", 37
+	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ testdefault1 (unsigned char i)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_testdefault1: near
+
+	.dbg	func, "testdefault1", "00", extern, "_testdefault1"
+	.dbg	sym, "i", "00", auto, 0
+	.dbg	sym, "k", "00", auto, -1
+
+.segment	"CODE"
+
+	.dbg	line, "switch2.c", 39
+	jsr     pusha
+	.dbg	line, "switch2.c", 43
+	jsr     decsp1
+	jmp     L0002
+	.dbg	line, "switch2.c", 44
+L0005:	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0006
+	dex
+L0006:	ldy     #$00
+	sta     (sp),y
+	.dbg	line, "switch2.c", 45
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$03
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$01
+	ldx     #$00
+	clc
+	lda     #$01
+	adc     (sp),y
+	sta     (sp),y
+	.dbg	line, "switch2.c", 46
+	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0007
+	dex
+L0007:	jmp     L0008
+	.dbg	line, "switch2.c", 124
+L0008:	cmp     #$0D
+	jcs     L002D
+	cmp     #$07
+	jcs     L002E
+	cmp     #$04
+	jcs     L002F
+	cmp     #$01
+	jeq     L000A
+	cmp     #$02
+	jeq     L000B
+	cmp     #$03
+	jeq     L000C
+	jmp     L002C
+L002F:	jeq     L000D
+	cmp     #$05
+	jeq     L000E
+	jmp     L000F
+L002E:	cmp     #$0A
+	jcs     L0030
+	cmp     #$07
+	jeq     L0010
+	cmp     #$08
+	jeq     L0011
+	jmp     L0012
+L0030:	jeq     L0013
+	cmp     #$0B
+	jeq     L0014
+	jmp     L0015
+L002D:	cmp     #$14
+	jcs     L0031
+	cmp     #$11
+	jcs     L0032
+	cmp     #$0D
+	jeq     L0016
+	cmp     #$0E
+	jeq     L0017
+	cmp     #$0F
+	jeq     L0018
+	jmp     L002C
+L0032:	jeq     L0019
+	cmp     #$12
+	jeq     L001A
+	jmp     L001B
+L0031:	cmp     #$17
+	jcs     L0033
+	cmp     #$14
+	jeq     L001C
+	cmp     #$15
+	jeq     L001D
+	jmp     L001E
+L0033:	jeq     L001F
+	cmp     #$18
+	jeq     L0020
+	cmp     #$64
+	jeq     L002B
+	jmp     L002C
+	.dbg	line, "switch2.c", 48
+L000A:	jmp     L0009
+	.dbg	line, "switch2.c", 50
+L000B:	jmp     L0009
+	.dbg	line, "switch2.c", 52
+L000C:	jmp     L0009
+	.dbg	line, "switch2.c", 54
+L000D:	jmp     L0009
+	.dbg	line, "switch2.c", 56
+L000E:	jmp     L0009
+	.dbg	line, "switch2.c", 58
+L000F:	jmp     L0009
+	.dbg	line, "switch2.c", 60
+L0010:	jmp     L0009
+	.dbg	line, "switch2.c", 62
+L0011:	jmp     L0009
+	.dbg	line, "switch2.c", 64
+L0012:	jmp     L0009
+	.dbg	line, "switch2.c", 66
+L0013:	jmp     L0009
+	.dbg	line, "switch2.c", 68
+L0014:	jmp     L0009
+	.dbg	line, "switch2.c", 70
+L0015:	jmp     L0009
+	.dbg	line, "switch2.c", 72
+L0016:	jmp     L0009
+	.dbg	line, "switch2.c", 74
+L0017:	jmp     L0009
+	.dbg	line, "switch2.c", 76
+L0018:	jmp     L0009
+	.dbg	line, "switch2.c", 78
+L0019:	jmp     L0009
+	.dbg	line, "switch2.c", 88
+L001A:	jmp     L0009
+	.dbg	line, "switch2.c", 90
+L001B:	jmp     L0009
+	.dbg	line, "switch2.c", 92
+L001C:	jmp     L0009
+	.dbg	line, "switch2.c", 94
+L001D:	jmp     L0009
+	.dbg	line, "switch2.c", 96
+L001E:	jmp     L0009
+	.dbg	line, "switch2.c", 98
+L001F:	jmp     L0009
+	.dbg	line, "switch2.c", 100
+L0020:	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0021
+	dex
+L0021:	jmp     L0022
+	.dbg	line, "switch2.c", 116
+L0022:	cmp     #$04
+	jcs     L002A
+	cmp     #$01
+	jeq     L0024
+	cmp     #$02
+	jeq     L0025
+	cmp     #$03
+	jeq     L0026
+	jmp     L0023
+L002A:	cmp     #$06
+	jcc     L0027
+	cmp     #$08
+	jcc     L0028
+	cmp     #$0A
+	jcc     L0029
+	jmp     L0023
+	.dbg	line, "switch2.c", 102
+L0024:	jmp     L0023
+	.dbg	line, "switch2.c", 104
+L0025:	jmp     L0023
+	.dbg	line, "switch2.c", 106
+L0026:	jmp     L0023
+	.dbg	line, "switch2.c", 109
+L0027:	jmp     L0023
+	.dbg	line, "switch2.c", 112
+L0028:	jmp     L0023
+	.dbg	line, "switch2.c", 115
+L0029:	jmp     L0023
+	.dbg	line, "switch2.c", 117
+L0023:	jmp     L0009
+	.dbg	line, "switch2.c", 119
+L002B:	jmp     L0009
+	.dbg	line, "switch2.c", 121
+L002C:	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "switch2.c", 124
+	jmp     L0009
+	.dbg	line, "switch2.c", 43
+L0009:	jmp     L0002
+L0002:	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$FE
+	jsr     boolult
+	jne     L0005
+	.dbg	line, "switch2.c", 126
+	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ testdefault2 (unsigned char i)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_testdefault2: near
+
+	.dbg	func, "testdefault2", "00", extern, "_testdefault2"
+	.dbg	sym, "i", "00", auto, 0
+	.dbg	sym, "k", "00", auto, -1
+
+.segment	"CODE"
+
+	.dbg	line, "switch2.c", 128
+	jsr     pusha
+	.dbg	line, "switch2.c", 132
+	jsr     decsp1
+	jmp     L0002
+	.dbg	line, "switch2.c", 133
+L0005:	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$00
+	sta     (sp),y
+	.dbg	line, "switch2.c", 134
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$03
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$01
+	ldx     #$00
+	clc
+	lda     #$01
+	adc     (sp),y
+	sta     (sp),y
+	.dbg	line, "switch2.c", 135
+	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	jmp     L0006
+	.dbg	line, "switch2.c", 210
+L0006:	cmp     #$0D
+	jcs     L002B
+	cmp     #$07
+	jcs     L002C
+	cmp     #$04
+	jcs     L002D
+	cmp     #$01
+	jeq     L0008
+	cmp     #$02
+	jeq     L0009
+	cmp     #$03
+	jeq     L000A
+	jmp     L002A
+L002D:	jeq     L000B
+	cmp     #$05
+	jeq     L000C
+	jmp     L000D
+L002C:	cmp     #$0A
+	jcs     L002E
+	cmp     #$07
+	jeq     L000E
+	cmp     #$08
+	jeq     L000F
+	jmp     L0010
+L002E:	jeq     L0011
+	cmp     #$0B
+	jeq     L0012
+	jmp     L0013
+L002B:	cmp     #$14
+	jcs     L002F
+	cmp     #$11
+	jcs     L0030
+	cmp     #$0D
+	jeq     L0014
+	cmp     #$0E
+	jeq     L0015
+	cmp     #$0F
+	jeq     L0016
+	jmp     L002A
+L0030:	jeq     L0017
+	cmp     #$12
+	jeq     L0019
+	jmp     L001A
+L002F:	cmp     #$17
+	jcs     L0031
+	cmp     #$14
+	jeq     L001B
+	cmp     #$15
+	jeq     L001C
+	jmp     L001D
+L0031:	jeq     L001E
+	cmp     #$18
+	jeq     L001F
+	cmp     #$64
+	jeq     L0029
+	cmp     #$AA
+	jeq     L0018
+	jmp     L002A
+	.dbg	line, "switch2.c", 137
+L0008:	jmp     L0007
+	.dbg	line, "switch2.c", 139
+L0009:	jmp     L0007
+	.dbg	line, "switch2.c", 141
+L000A:	jmp     L0007
+	.dbg	line, "switch2.c", 143
+L000B:	jmp     L0007
+	.dbg	line, "switch2.c", 145
+L000C:	jmp     L0007
+	.dbg	line, "switch2.c", 147
+L000D:	jmp     L0007
+	.dbg	line, "switch2.c", 149
+L000E:	jmp     L0007
+	.dbg	line, "switch2.c", 151
+L000F:	jmp     L0007
+	.dbg	line, "switch2.c", 153
+L0010:	jmp     L0007
+	.dbg	line, "switch2.c", 155
+L0011:	jmp     L0007
+	.dbg	line, "switch2.c", 157
+L0012:	jmp     L0007
+	.dbg	line, "switch2.c", 159
+L0013:	jmp     L0007
+	.dbg	line, "switch2.c", 161
+L0014:	jmp     L0007
+	.dbg	line, "switch2.c", 163
+L0015:	jmp     L0007
+	.dbg	line, "switch2.c", 165
+L0016:	jmp     L0007
+	.dbg	line, "switch2.c", 167
+L0017:	jmp     L0007
+	.dbg	line, "switch2.c", 171
+L0018:	jmp     L0007
+	.dbg	line, "switch2.c", 174
+L0019:	jmp     L0007
+	.dbg	line, "switch2.c", 176
+L001A:	jmp     L0007
+	.dbg	line, "switch2.c", 178
+L001B:	jmp     L0007
+	.dbg	line, "switch2.c", 180
+L001C:	jmp     L0007
+	.dbg	line, "switch2.c", 182
+L001D:	jmp     L0007
+	.dbg	line, "switch2.c", 184
+L001E:	jmp     L0007
+	.dbg	line, "switch2.c", 186
+L001F:	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	jmp     L0020
+	.dbg	line, "switch2.c", 202
+L0020:	cmp     #$04
+	jcs     L0028
+	cmp     #$01
+	jeq     L0022
+	cmp     #$02
+	jeq     L0023
+	cmp     #$03
+	jeq     L0024
+	jmp     L0021
+L0028:	cmp     #$06
+	jcc     L0025
+	cmp     #$08
+	jcc     L0026
+	cmp     #$0A
+	jcc     L0027
+	jmp     L0021
+	.dbg	line, "switch2.c", 188
+L0022:	jmp     L0021
+	.dbg	line, "switch2.c", 190
+L0023:	jmp     L0021
+	.dbg	line, "switch2.c", 192
+L0024:	jmp     L0021
+	.dbg	line, "switch2.c", 195
+L0025:	jmp     L0021
+	.dbg	line, "switch2.c", 198
+L0026:	jmp     L0021
+	.dbg	line, "switch2.c", 201
+L0027:	jmp     L0021
+	.dbg	line, "switch2.c", 203
+L0021:	jmp     L0007
+	.dbg	line, "switch2.c", 205
+L0029:	jmp     L0007
+	.dbg	line, "switch2.c", 207
+L002A:	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "switch2.c", 210
+	jmp     L0007
+	.dbg	line, "switch2.c", 132
+L0007:	jmp     L0002
+L0002:	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$FE
+	jsr     boolult
+	jne     L0005
+	.dbg	line, "switch2.c", 212
+	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "switch2.c", 215
+	ldx     #$7F
+	lda     #$FF
+	jsr     _testlimits
+	.dbg	line, "switch2.c", 216
+	ldx     #$80
+	lda     #$00
+	jsr     _testlimits
+	.dbg	line, "switch2.c", 217
+	ldx     #$FF
+	lda     #$FF
+	jsr     _testlimits
+	.dbg	line, "switch2.c", 219
+	lda     #$01
+	jsr     _testdefault1
+	.dbg	line, "switch2.c", 220
+	lda     #$02
+	jsr     _testdefault1
+	.dbg	line, "switch2.c", 221
+	lda     #$03
+	jsr     _testdefault1
+	.dbg	line, "switch2.c", 222
+	lda     #$04
+	jsr     _testdefault1
+	.dbg	line, "switch2.c", 224
+	lda     #$01
+	jsr     _testdefault2
+	.dbg	line, "switch2.c", 225
+	lda     #$02
+	jsr     _testdefault2
+	.dbg	line, "switch2.c", 226
+	lda     #$03
+	jsr     _testdefault2
+	.dbg	line, "switch2.c", 227
+	lda     #$04
+	jsr     _testdefault2
+	.dbg	line, "switch2.c", 229
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "switch2.c", 230
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,242 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_success
+	.export		_failures
+	.export		_dummy
+	.export		_aint0
+	.export		_aint1
+	.export		_achar0
+	.export		_achar1
+	.export		_achar2
+	.export		_achar3
+	.export		_acharP
+	.export		_done
+	.export		_add_lit2uchar
+	.export		_add_uchar2uchar
+	.export		_add_uchar2uchar2
+	.export		_main
+
+.segment	"DATA"
+
+_success:
+	.byte	$00
+_failures:
+	.byte	$00
+_dummy:
+	.byte	$00
+_aint0:
+	.word	$0000
+_aint1:
+	.word	$0000
+_achar0:
+	.byte	$00
+_achar1:
+	.byte	$00
+_achar2:
+	.byte	$00
+_achar3:
+	.byte	$00
+_acharP:
+	.word	$0000
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ done (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_done: near
+
+.segment	"CODE"
+
+	inc     _dummy
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ add_lit2uchar (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_add_lit2uchar: near
+
+.segment	"CODE"
+
+	lda     _achar0
+	clc
+	adc     #$05
+	sta     _achar0
+	cmp     #$05
+	beq     L000C
+	inc     _failures
+L000C:	lda     #$0A
+	clc
+	adc     _achar0
+	sta     _achar0
+	cmp     #$0F
+	beq     L000D
+	inc     _failures
+L000D:	lda     _achar0
+	ina
+	sta     _achar0
+	cmp     #$10
+	beq     L000F
+	inc     _failures
+L000F:	stz     _achar1
+	bra     L0011
+L0010:	lda     #$02
+	clc
+	adc     _achar0
+	sta     _achar0
+	inc     _achar1
+L0011:	lda     _achar1
+	cmp     #$64
+	bcc     L0010
+	lda     _achar0
+	cmp     #$D8
+	beq     L000B
+	inc     _failures
+L000B:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ add_uchar2uchar (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_add_uchar2uchar: near
+
+.segment	"CODE"
+
+	lda     _achar1
+	clc
+	adc     _achar0
+	sta     _achar1
+	cmp     #$10
+	beq     L0009
+	inc     _failures
+L0009:	stz     _achar2
+	bra     L000B
+L000A:	lda     _achar0
+	clc
+	adc     _achar1
+	sta     _achar1
+	inc     _achar2
+L000B:	lda     _achar2
+	cmp     #$07
+	bcc     L000A
+	lda     _achar1
+	cmp     #$80
+	beq     L0007
+	inc     _failures
+L0007:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ add_uchar2uchar2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_add_uchar2uchar2: near
+
+.segment	"CODE"
+
+	inc     _achar0
+	lda     _achar0
+	ina
+	sta     _achar0
+	clc
+	adc     #$02
+	sta     _achar0
+	clc
+	adc     #$03
+	sta     _achar0
+	cmp     #$07
+	beq     L000E
+	inc     _failures
+L000E:	lda     _achar0
+	clc
+	adc     _achar1
+	sta     _achar1
+	cmp     #$27
+	beq     L000F
+	inc     _failures
+L000F:	lda     _achar1
+	clc
+	adc     _achar0
+	sta     _achar2
+	cmp     #$2E
+	beq     L0010
+	inc     _failures
+L0010:	lda     _achar2
+	clc
+	adc     _achar1
+	bcc     L000C
+	clc
+L000C:	adc     _achar0
+	sta     _achar3
+	cmp     #$5C
+	beq     L0008
+	inc     _failures
+L0008:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     _add_lit2uchar
+	lda     #$10
+	sta     _achar0
+	stz     _achar1
+	jsr     _add_uchar2uchar
+	stz     _achar0
+	lda     #$20
+	sta     _achar1
+	jsr     _add_uchar2uchar2
+	lda     _failures
+	sta     _success
+	jsr     _done
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     _failures
+	rts
+
+.endproc
+
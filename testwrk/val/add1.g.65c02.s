@@ -0,0 +1,426 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "add1.c", 2511, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/limits.h", 3146, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_success
+	.export		_failures
+	.export		_dummy
+	.export		_aint0
+	.export		_aint1
+	.export		_achar0
+	.export		_achar1
+	.export		_achar2
+	.export		_achar3
+	.export		_acharP
+	.export		_done
+	.export		_add_lit2uchar
+	.export		_add_uchar2uchar
+	.export		_add_uchar2uchar2
+	.export		_main
+
+.segment	"DATA"
+
+_success:
+	.byte	$00
+_failures:
+	.byte	$00
+_dummy:
+	.byte	$00
+_aint0:
+	.word	$0000
+_aint1:
+	.word	$0000
+_achar0:
+	.byte	$00
+_achar1:
+	.byte	$00
+_achar2:
+	.byte	$00
+_achar3:
+	.byte	$00
+_acharP:
+	.word	$0000
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ done (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_done: near
+
+	.dbg	func, "done", "00", extern, "_done"
+
+.segment	"CODE"
+
+	.dbg	line, "add1.c", 41
+	ldx     #$00
+	lda     _dummy
+	inc     _dummy
+	.dbg	line, "add1.c", 42
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ add_lit2uchar (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_add_lit2uchar: near
+
+	.dbg	func, "add_lit2uchar", "00", extern, "_add_lit2uchar"
+
+.segment	"CODE"
+
+	.dbg	line, "add1.c", 46
+	ldx     #$00
+	lda     _achar0
+	jsr     incax5
+	ldx     #$00
+	sta     _achar0
+	.dbg	line, "add1.c", 48
+	ldx     #$00
+	lda     _achar0
+	cmp     #$05
+	jsr     boolne
+	jeq     L0002
+	.dbg	line, "add1.c", 49
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add1.c", 51
+L0002:	ldx     #$00
+	lda     #$0A
+	clc
+	adc     _achar0
+	sta     _achar0
+	.dbg	line, "add1.c", 53
+	ldx     #$00
+	lda     _achar0
+	cmp     #$0F
+	jsr     boolne
+	jeq     L0003
+	.dbg	line, "add1.c", 54
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add1.c", 56
+L0003:	ldx     #$00
+	lda     _achar0
+	ina
+	bne     L0004
+	inx
+L0004:	ldx     #$00
+	sta     _achar0
+	.dbg	line, "add1.c", 57
+	ldx     #$00
+	lda     _achar0
+	cmp     #$10
+	jsr     boolne
+	jeq     L0005
+	.dbg	line, "add1.c", 58
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add1.c", 60
+L0005:	ldx     #$00
+	lda     #$00
+	sta     _achar1
+	jmp     L0006
+	.dbg	line, "add1.c", 61
+L0009:	ldx     #$00
+	lda     #$02
+	clc
+	adc     _achar0
+	sta     _achar0
+	.dbg	line, "add1.c", 60
+	ldx     #$00
+	lda     _achar1
+	inc     _achar1
+	jmp     L0006
+L0006:	ldx     #$00
+	lda     _achar1
+	cmp     #$64
+	jsr     boolult
+	jne     L0009
+	.dbg	line, "add1.c", 63
+	ldx     #$00
+	lda     _achar0
+	cmp     #$D8
+	jsr     boolne
+	jeq     L000A
+	.dbg	line, "add1.c", 64
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add1.c", 65
+L000A:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ add_uchar2uchar (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_add_uchar2uchar: near
+
+	.dbg	func, "add_uchar2uchar", "00", extern, "_add_uchar2uchar"
+
+.segment	"CODE"
+
+	.dbg	line, "add1.c", 69
+	ldx     #$00
+	lda     _achar1
+	jsr     pushax
+	ldx     #$00
+	lda     _achar0
+	jsr     tosaddax
+	ldx     #$00
+	sta     _achar1
+	.dbg	line, "add1.c", 71
+	ldx     #$00
+	lda     _achar1
+	cmp     #$10
+	jsr     boolne
+	jeq     L0002
+	.dbg	line, "add1.c", 72
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add1.c", 74
+L0002:	ldx     #$00
+	lda     #$00
+	sta     _achar2
+	jmp     L0003
+	.dbg	line, "add1.c", 75
+L0006:	ldx     #$00
+	lda     _achar0
+	ldx     #$00
+	ldx     #$00
+	clc
+	adc     _achar1
+	sta     _achar1
+	.dbg	line, "add1.c", 74
+	ldx     #$00
+	lda     _achar2
+	inc     _achar2
+	jmp     L0003
+L0003:	ldx     #$00
+	lda     _achar2
+	cmp     #$07
+	jsr     boolult
+	jne     L0006
+	.dbg	line, "add1.c", 77
+	ldx     #$00
+	lda     _achar1
+	cmp     #$80
+	jsr     boolne
+	jeq     L0007
+	.dbg	line, "add1.c", 78
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add1.c", 79
+L0007:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ add_uchar2uchar2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_add_uchar2uchar2: near
+
+	.dbg	func, "add_uchar2uchar2", "00", extern, "_add_uchar2uchar2"
+
+.segment	"CODE"
+
+	.dbg	line, "add1.c", 88
+	ldx     #$00
+	lda     _achar0
+	inc     _achar0
+	.dbg	line, "add1.c", 89
+	ldx     #$00
+	lda     _achar0
+	ina
+	bne     L0002
+	inx
+L0002:	ldx     #$00
+	sta     _achar0
+	.dbg	line, "add1.c", 90
+	ldx     #$00
+	lda     _achar0
+	jsr     incax2
+	ldx     #$00
+	sta     _achar0
+	.dbg	line, "add1.c", 91
+	ldx     #$00
+	lda     _achar0
+	jsr     incax3
+	ldx     #$00
+	sta     _achar0
+	.dbg	line, "add1.c", 92
+	ldx     #$00
+	lda     _achar0
+	cmp     #$07
+	jsr     boolne
+	jeq     L0003
+	.dbg	line, "add1.c", 93
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add1.c", 95
+L0003:	ldx     #$00
+	lda     _achar0
+	ldx     #$00
+	ldx     #$00
+	clc
+	adc     _achar1
+	sta     _achar1
+	.dbg	line, "add1.c", 96
+	ldx     #$00
+	lda     _achar1
+	cmp     #$27
+	jsr     boolne
+	jeq     L0004
+	.dbg	line, "add1.c", 97
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add1.c", 99
+L0004:	ldx     #$00
+	lda     _achar1
+	jsr     pushax
+	ldx     #$00
+	lda     _achar0
+	jsr     tosaddax
+	ldx     #$00
+	sta     _achar2
+	.dbg	line, "add1.c", 100
+	ldx     #$00
+	lda     _achar2
+	cmp     #$2E
+	jsr     boolne
+	jeq     L0005
+	.dbg	line, "add1.c", 101
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add1.c", 103
+L0005:	ldx     #$00
+	lda     _achar2
+	jsr     pushax
+	ldx     #$00
+	lda     _achar1
+	jsr     tosaddax
+	jsr     pushax
+	ldx     #$00
+	lda     _achar0
+	jsr     tosaddax
+	ldx     #$00
+	sta     _achar3
+	.dbg	line, "add1.c", 104
+	ldx     #$00
+	lda     _achar3
+	cmp     #$5C
+	jsr     boolne
+	jeq     L0006
+	.dbg	line, "add1.c", 105
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add1.c", 106
+L0006:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "add1.c", 159
+	jsr     _add_lit2uchar
+	.dbg	line, "add1.c", 161
+	ldx     #$00
+	lda     #$10
+	sta     _achar0
+	.dbg	line, "add1.c", 162
+	ldx     #$00
+	lda     #$00
+	sta     _achar1
+	.dbg	line, "add1.c", 163
+	jsr     _add_uchar2uchar
+	.dbg	line, "add1.c", 165
+	ldx     #$00
+	lda     #$00
+	sta     _achar0
+	.dbg	line, "add1.c", 166
+	ldx     #$00
+	lda     #$20
+	sta     _achar1
+	.dbg	line, "add1.c", 167
+	jsr     _add_uchar2uchar2
+	.dbg	line, "add1.c", 176
+	ldx     #$00
+	lda     _failures
+	sta     _success
+	.dbg	line, "add1.c", 177
+	jsr     _done
+	.dbg	line, "add1.c", 178
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "add1.c", 180
+	ldx     #$00
+	lda     _failures
+	jmp     L0001
+	.dbg	line, "add1.c", 181
+L0001:	rts
+
+	.dbg	line
+.endproc
+
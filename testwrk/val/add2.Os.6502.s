@@ -0,0 +1,701 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_success
+	.export		_failures
+	.export		_dummy
+	.export		_aint0
+	.export		_aint1
+	.export		_aint2
+	.export		_aint3
+	.export		_achar0
+	.export		_achar1
+	.export		_achar2
+	.export		_achar3
+	.export		_acharP
+	.export		_done
+	.export		_add_lit2uint
+	.export		_add_uint2uint
+	.export		_add_uint2uint2
+	.export		_addlits
+	.export		_main
+
+.segment	"DATA"
+
+_success:
+	.byte	$00
+_failures:
+	.byte	$00
+_dummy:
+	.byte	$00
+_aint0:
+	.word	$0000
+_aint1:
+	.word	$0000
+_aint2:
+	.word	$0000
+_aint3:
+	.word	$0000
+_achar0:
+	.byte	$00
+_achar1:
+	.byte	$00
+_achar2:
+	.byte	$00
+_achar3:
+	.byte	$00
+_acharP:
+	.word	$0000
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ done (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_done: near
+
+.segment	"CODE"
+
+	inc     _dummy
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ add_lit2uint (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_add_lit2uint: near
+
+.segment	"CODE"
+
+	lda     _aint0
+	ldx     _aint0+1
+	jsr     incax5
+	sta     _aint0
+	stx     _aint0+1
+	cpx     #$00
+	bne     L0012
+	cmp     #$05
+	beq     L0002
+L0012:	inc     _failures
+L0002:	lda     #$0A
+	clc
+	adc     _aint0
+	sta     _aint0
+	bcc     L0004
+	inc     _aint0+1
+L0004:	lda     _aint0+1
+	bne     L0013
+	lda     _aint0
+	cmp     #$0F
+	beq     L0005
+L0013:	inc     _failures
+L0005:	lda     _aint0
+	ldx     _aint0+1
+	jsr     incax1
+	sta     _aint0
+	stx     _aint0+1
+	cpx     #$00
+	bne     L0014
+	cmp     #$10
+	beq     L0016
+L0014:	inc     _failures
+L0016:	lda     #$00
+	sta     _aint1
+	sta     _aint1+1
+	jmp     L0009
+L000C:	lda     #$02
+	clc
+	adc     _aint0
+	sta     _aint0
+	bcc     L000F
+	inc     _aint0+1
+L000F:	inc     _aint1
+	bne     L0009
+	inc     _aint1+1
+L0009:	lda     _aint1+1
+	cmp     #$00
+	bne     L000D
+	lda     _aint1
+	cmp     #$64
+L000D:	bcc     L000C
+	lda     _aint0+1
+	bne     L0015
+	lda     _aint0
+	cmp     #$D8
+	beq     L0010
+L0015:	inc     _failures
+L0010:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ add_uint2uint (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_add_uint2uint: near
+
+.segment	"CODE"
+
+	lda     _aint1
+	clc
+	adc     _aint0
+	pha
+	lda     _aint1+1
+	adc     _aint0+1
+	tax
+	pla
+	sta     _aint1
+	stx     _aint1+1
+	cpx     #$00
+	bne     L000C
+	cmp     #$10
+	beq     L000E
+L000C:	inc     _failures
+L000E:	lda     #$00
+	sta     _aint2
+	sta     _aint2+1
+	jmp     L0004
+L0007:	lda     _aint0
+	clc
+	adc     _aint1
+	sta     _aint1
+	lda     _aint0+1
+	adc     _aint1+1
+	sta     _aint1+1
+	inc     _aint2
+	bne     L0004
+	inc     _aint2+1
+L0004:	lda     _aint2+1
+	cmp     #$00
+	bne     L0008
+	lda     _aint2
+	cmp     #$07
+L0008:	bcc     L0007
+	lda     _aint1+1
+	bne     L000D
+	lda     _aint1
+	cmp     #$80
+	beq     L000A
+L000D:	inc     _failures
+L000A:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ add_uint2uint2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_add_uint2uint2: near
+
+.segment	"CODE"
+
+	inc     _aint0
+	bne     L0002
+	inc     _aint0+1
+L0002:	lda     _aint0
+	ldx     _aint0+1
+	jsr     incax1
+	sta     _aint0
+	stx     _aint0+1
+	jsr     incax2
+	sta     _aint0
+	stx     _aint0+1
+	jsr     incax3
+	sta     _aint0
+	stx     _aint0+1
+	cpx     #$00
+	bne     L0014
+	cmp     #$07
+	beq     L0003
+L0014:	inc     _failures
+L0003:	lda     _aint0
+	clc
+	adc     _aint1
+	sta     _aint1
+	lda     _aint0+1
+	adc     _aint1+1
+	sta     _aint1+1
+	cmp     #$00
+	bne     L0015
+	lda     _aint1
+	cmp     #$27
+	beq     L0005
+L0015:	inc     _failures
+L0005:	lda     _aint1
+	clc
+	adc     _aint0
+	pha
+	lda     _aint1+1
+	adc     _aint0+1
+	tax
+	pla
+	sta     _aint2
+	stx     _aint2+1
+	cpx     #$00
+	bne     L0016
+	cmp     #$2E
+	beq     L0007
+L0016:	inc     _failures
+L0007:	lda     _aint2
+	clc
+	adc     _aint1
+	pha
+	lda     _aint2+1
+	adc     _aint1+1
+	tax
+	pla
+	clc
+	adc     _aint0
+	pha
+	txa
+	adc     _aint0+1
+	tax
+	pla
+	sta     _aint3
+	stx     _aint3+1
+	cpx     #$00
+	bne     L0017
+	cmp     #$5C
+	beq     L0009
+L0017:	inc     _failures
+L0009:	lda     #$A0
+	clc
+	adc     _aint3
+	sta     _aint3
+	bcc     L000B
+	inc     _aint3+1
+L000B:	lda     _aint3+1
+	bne     L0018
+	lda     _aint3
+	cmp     #$FC
+	beq     L000C
+L0018:	inc     _failures
+L000C:	lda     _aint0
+	clc
+	adc     _aint3
+	sta     _aint3
+	lda     _aint0+1
+	adc     _aint3+1
+	sta     _aint3+1
+	cmp     #$01
+	bne     L0019
+	lda     _aint3
+	cmp     #$03
+	beq     L000E
+L0019:	inc     _failures
+L000E:	lda     #$C0
+	clc
+	adc     _aint1
+	sta     _aint1
+	lda     #$FF
+	adc     _aint1+1
+	sta     _aint1+1
+	cmp     #$FF
+	bne     L001A
+	lda     _aint1
+	cmp     #$E7
+	beq     L0010
+L001A:	inc     _failures
+L0010:	lda     _aint2
+	clc
+	adc     _aint1
+	pha
+	lda     _aint2+1
+	adc     _aint1+1
+	tax
+	pla
+	clc
+	adc     _aint0
+	pha
+	txa
+	adc     _aint0+1
+	tax
+	pla
+	sta     _aint3
+	stx     _aint3+1
+	cpx     #$00
+	bne     L001B
+	cmp     #$1C
+	beq     L0012
+L001B:	inc     _failures
+L0012:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ addlits (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_addlits: near
+
+.segment	"CODE"
+
+	inc     _aint0
+	bne     L0002
+	inc     _aint0+1
+L0002:	lda     _aint0+1
+	bne     L003B
+	lda     _aint0
+	cmp     #$01
+	beq     L0003
+L003B:	inc     _failures
+L0003:	clc
+	lda     _aint0
+	sta     _aint0
+	bcc     L0005
+	inc     _aint0+1
+L0005:	lda     _aint0+1
+	bne     L003C
+	lda     _aint0
+	cmp     #$01
+	beq     L0006
+L003C:	inc     _failures
+L0006:	lda     #$FE
+	clc
+	adc     _aint0
+	sta     _aint0
+	bcc     L0008
+	inc     _aint0+1
+L0008:	lda     _aint0+1
+	bne     L003D
+	lda     _aint0
+	cmp     #$FF
+	beq     L0009
+L003D:	inc     _failures
+L0009:	inc     _aint0
+	bne     L000B
+	inc     _aint0+1
+L000B:	lda     _aint0+1
+	cmp     #$01
+	bne     L003E
+	lda     _aint0
+	beq     L000C
+L003E:	inc     _failures
+L000C:	inc     _aint0
+	bne     L000E
+	inc     _aint0+1
+L000E:	lda     _aint0+1
+	cmp     #$01
+	bne     L003F
+	lda     _aint0
+	cmp     #$01
+	beq     L000F
+L003F:	inc     _failures
+L000F:	lda     #$FF
+	clc
+	adc     _aint0
+	sta     _aint0
+	bcc     L0011
+	inc     _aint0+1
+L0011:	lda     _aint0+1
+	cmp     #$02
+	bne     L0040
+	lda     _aint0
+	beq     L0012
+L0040:	inc     _failures
+L0012:	lda     #$A0
+	clc
+	adc     _aint0
+	sta     _aint0
+	bcc     L0014
+	inc     _aint0+1
+L0014:	lda     _aint0+1
+	cmp     #$02
+	bne     L0041
+	lda     _aint0
+	cmp     #$A0
+	beq     L0015
+L0041:	inc     _failures
+L0015:	lda     #$61
+	clc
+	adc     _aint0
+	sta     _aint0
+	bcc     L0017
+	inc     _aint0+1
+L0017:	lda     _aint0+1
+	cmp     #$03
+	bne     L0042
+	lda     _aint0
+	cmp     #$01
+	beq     L0018
+L0042:	inc     _failures
+L0018:	clc
+	lda     _aint0
+	sta     _aint0
+	lda     #$01
+	adc     _aint0+1
+	sta     _aint0+1
+	cmp     #$04
+	bne     L0043
+	lda     _aint0
+	cmp     #$01
+	beq     L0053
+L0043:	inc     _failures
+	lda     #$01
+L0053:	clc
+	adc     _aint0
+	sta     _aint0
+	lda     #$01
+	adc     _aint0+1
+	sta     _aint0+1
+	cmp     #$05
+	bne     L0044
+	lda     _aint0
+	cmp     #$02
+	beq     L001C
+L0044:	inc     _failures
+L001C:	lda     #$FD
+	clc
+	adc     _aint0
+	sta     _aint0
+	bcc     L001E
+	inc     _aint0+1
+L001E:	lda     _aint0+1
+	cmp     #$05
+	bne     L0045
+	lda     _aint0
+	cmp     #$FF
+	beq     L001F
+L0045:	inc     _failures
+L001F:	lda     #$01
+	clc
+	adc     _aint0
+	sta     _aint0
+	lda     #$01
+	adc     _aint0+1
+	sta     _aint0+1
+	cmp     #$07
+	bne     L0046
+	lda     _aint0
+	beq     L0021
+L0046:	inc     _failures
+L0021:	lda     #$FF
+	clc
+	adc     _aint0
+	sta     _aint0
+	lda     #$01
+	adc     _aint0+1
+	sta     _aint0+1
+	cmp     #$08
+	bne     L0047
+	lda     _aint0
+	cmp     #$FF
+	beq     L0054
+L0047:	inc     _failures
+	lda     #$FF
+L0054:	clc
+	adc     _aint0
+	sta     _aint0
+	lda     #$01
+	adc     _aint0+1
+	sta     _aint0+1
+	cmp     #$0A
+	bne     L0048
+	lda     _aint0
+	cmp     #$FE
+	beq     L0025
+L0048:	inc     _failures
+L0025:	lda     #$02
+	clc
+	adc     _aint0
+	sta     _aint0
+	lda     #$FF
+	adc     _aint0+1
+	sta     _aint0+1
+	cmp     #$0A
+	bne     L0049
+	lda     _aint0
+	beq     L0027
+L0049:	inc     _failures
+L0027:	lda     #$FF
+	clc
+	adc     _aint0
+	sta     _aint0
+	lda     #$FF
+	adc     _aint0+1
+	sta     _aint0+1
+	cmp     #$09
+	bne     L004A
+	lda     _aint0
+	cmp     #$FF
+	beq     L0029
+L004A:	inc     _failures
+L0029:	lda     #$01
+	clc
+	adc     _aint0
+	sta     _aint0
+	lda     #$FF
+	adc     _aint0+1
+	sta     _aint0+1
+	cmp     #$09
+	bne     L004B
+	lda     _aint0
+	beq     L0055
+L004B:	inc     _failures
+L0055:	clc
+	lda     _aint0
+	sta     _aint0
+	lda     #$FF
+	adc     _aint0+1
+	sta     _aint0+1
+	cmp     #$08
+	bne     L004C
+	lda     _aint0
+	beq     L002D
+L004C:	inc     _failures
+L002D:	lda     #$01
+	clc
+	adc     _aint0
+	sta     _aint0
+	lda     #$FF
+	adc     _aint0+1
+	sta     _aint0+1
+	cmp     #$07
+	bne     L004D
+	lda     _aint0
+	cmp     #$01
+	beq     L002F
+L004D:	inc     _failures
+L002F:	clc
+	lda     _aint0
+	sta     _aint0
+	lda     #$03
+	adc     _aint0+1
+	sta     _aint0+1
+	cmp     #$0A
+	bne     L004E
+	lda     _aint0
+	cmp     #$01
+	beq     L0031
+L004E:	inc     _failures
+L0031:	lda     #$FF
+	clc
+	adc     _aint0
+	sta     _aint0
+	lda     #$03
+	adc     _aint0+1
+	sta     _aint0+1
+	cmp     #$0E
+	bne     L004F
+	lda     _aint0
+	beq     L0033
+L004F:	inc     _failures
+L0033:	lda     #$01
+	clc
+	adc     _aint0
+	sta     _aint0
+	lda     #$03
+	adc     _aint0+1
+	sta     _aint0+1
+	cmp     #$11
+	bne     L0050
+	lda     _aint0
+	cmp     #$01
+	beq     L0035
+L0050:	inc     _failures
+L0035:	lda     #$FE
+	clc
+	adc     _aint0
+	sta     _aint0
+	lda     #$03
+	adc     _aint0+1
+	sta     _aint0+1
+	cmp     #$14
+	bne     L0051
+	lda     _aint0
+	cmp     #$FF
+	beq     L0037
+L0051:	inc     _failures
+L0037:	lda     #$01
+	clc
+	adc     _aint0
+	sta     _aint0
+	lda     #$03
+	adc     _aint0+1
+	sta     _aint0+1
+	cmp     #$18
+	bne     L0052
+	lda     _aint0
+	beq     L0039
+L0052:	inc     _failures
+L0039:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     _add_lit2uint
+	ldx     #$00
+	lda     #$10
+	sta     _aint0
+	stx     _aint0+1
+	txa
+	sta     _aint1
+	sta     _aint1+1
+	jsr     _add_uint2uint
+	ldx     #$00
+	txa
+	sta     _aint0
+	sta     _aint0+1
+	lda     #$20
+	sta     _aint1
+	stx     _aint1+1
+	txa
+	sta     _aint2
+	sta     _aint2+1
+	jsr     _add_uint2uint2
+	lda     #$00
+	sta     _aint0
+	sta     _aint0+1
+	jsr     _addlits
+	lda     _failures
+	sta     _success
+	jsr     _done
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     _failures
+	rts
+
+.endproc
+
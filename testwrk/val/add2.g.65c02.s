@@ -0,0 +1,1112 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "add2.c", 4276, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/limits.h", 3146, 1613073744
+	.dbg		file, "/root/repo/include/stdint.h", 6196, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_success
+	.export		_failures
+	.export		_dummy
+	.export		_aint0
+	.export		_aint1
+	.export		_aint2
+	.export		_aint3
+	.export		_achar0
+	.export		_achar1
+	.export		_achar2
+	.export		_achar3
+	.export		_acharP
+	.export		_done
+	.export		_add_lit2uint
+	.export		_add_uint2uint
+	.export		_add_uint2uint2
+	.export		_addlits
+	.export		_main
+
+.segment	"DATA"
+
+_success:
+	.byte	$00
+_failures:
+	.byte	$00
+_dummy:
+	.byte	$00
+_aint0:
+	.word	$0000
+_aint1:
+	.word	$0000
+_aint2:
+	.word	$0000
+_aint3:
+	.word	$0000
+_achar0:
+	.byte	$00
+_achar1:
+	.byte	$00
+_achar2:
+	.byte	$00
+_achar3:
+	.byte	$00
+_acharP:
+	.word	$0000
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ done (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_done: near
+
+	.dbg	func, "done", "00", extern, "_done"
+
+.segment	"CODE"
+
+	.dbg	line, "add2.c", 47
+	ldx     #$00
+	lda     _dummy
+	inc     _dummy
+	.dbg	line, "add2.c", 48
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ add_lit2uint (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_add_lit2uint: near
+
+	.dbg	func, "add_lit2uint", "00", extern, "_add_lit2uint"
+
+.segment	"CODE"
+
+	.dbg	line, "add2.c", 52
+	lda     _aint0
+	ldx     _aint0+1
+	jsr     incax5
+	sta     _aint0
+	stx     _aint0+1
+	.dbg	line, "add2.c", 54
+	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$00
+	bne     L0003
+	cmp     #$05
+L0003:	jsr     boolne
+	jeq     L0002
+	.dbg	line, "add2.c", 55
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add2.c", 57
+L0002:	lda     #$0A
+	clc
+	adc     _aint0
+	sta     _aint0
+	bcc     L0004
+	inc     _aint0+1
+L0004:	ldx     _aint0+1
+	.dbg	line, "add2.c", 59
+	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$00
+	bne     L0006
+	cmp     #$0F
+L0006:	jsr     boolne
+	jeq     L0005
+	.dbg	line, "add2.c", 60
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add2.c", 62
+L0005:	lda     _aint0
+	ldx     _aint0+1
+	ina
+	bne     L0007
+	inx
+L0007:	sta     _aint0
+	stx     _aint0+1
+	.dbg	line, "add2.c", 63
+	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$00
+	bne     L0009
+	cmp     #$10
+L0009:	jsr     boolne
+	jeq     L0008
+	.dbg	line, "add2.c", 64
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add2.c", 66
+L0008:	ldx     #$00
+	lda     #$00
+	sta     _aint1
+	stx     _aint1+1
+	jmp     L000A
+	.dbg	line, "add2.c", 67
+L000D:	lda     #$02
+	clc
+	adc     _aint0
+	sta     _aint0
+	bcc     L0010
+	inc     _aint0+1
+L0010:	ldx     _aint0+1
+	.dbg	line, "add2.c", 66
+	lda     _aint1
+	ldx     _aint1+1
+	inc     _aint1
+	bne     L000F
+	inc     _aint1+1
+L000F:	lda     _aint1
+	ldx     _aint1+1
+	jmp     L000A
+L000A:	lda     _aint1
+	ldx     _aint1+1
+	cpx     #$00
+	bne     L000E
+	cmp     #$64
+L000E:	jsr     boolult
+	jne     L000D
+	.dbg	line, "add2.c", 69
+	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$00
+	bne     L0012
+	cmp     #$D8
+L0012:	jsr     boolne
+	jeq     L0011
+	.dbg	line, "add2.c", 70
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add2.c", 71
+L0011:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ add_uint2uint (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_add_uint2uint: near
+
+	.dbg	func, "add_uint2uint", "00", extern, "_add_uint2uint"
+
+.segment	"CODE"
+
+	.dbg	line, "add2.c", 75
+	lda     _aint1
+	ldx     _aint1+1
+	jsr     pushax
+	lda     _aint0
+	ldx     _aint0+1
+	jsr     tosaddax
+	sta     _aint1
+	stx     _aint1+1
+	.dbg	line, "add2.c", 77
+	lda     _aint1
+	ldx     _aint1+1
+	cpx     #$00
+	bne     L0003
+	cmp     #$10
+L0003:	jsr     boolne
+	jeq     L0002
+	.dbg	line, "add2.c", 78
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add2.c", 80
+L0002:	ldx     #$00
+	lda     #$00
+	sta     _aint2
+	stx     _aint2+1
+	jmp     L0004
+	.dbg	line, "add2.c", 81
+L0007:	lda     _aint0
+	ldx     _aint0+1
+	clc
+	adc     _aint1
+	sta     _aint1
+	txa
+	adc     _aint1+1
+	sta     _aint1+1
+	tax
+	lda     _aint1
+	.dbg	line, "add2.c", 80
+	lda     _aint2
+	ldx     _aint2+1
+	inc     _aint2
+	bne     L0009
+	inc     _aint2+1
+L0009:	lda     _aint2
+	ldx     _aint2+1
+	jmp     L0004
+L0004:	lda     _aint2
+	ldx     _aint2+1
+	cpx     #$00
+	bne     L0008
+	cmp     #$07
+L0008:	jsr     boolult
+	jne     L0007
+	.dbg	line, "add2.c", 83
+	lda     _aint1
+	ldx     _aint1+1
+	cpx     #$00
+	bne     L000B
+	cmp     #$80
+L000B:	jsr     boolne
+	jeq     L000A
+	.dbg	line, "add2.c", 84
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add2.c", 85
+L000A:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ add_uint2uint2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_add_uint2uint2: near
+
+	.dbg	func, "add_uint2uint2", "00", extern, "_add_uint2uint2"
+
+.segment	"CODE"
+
+	.dbg	line, "add2.c", 94
+	lda     _aint0
+	ldx     _aint0+1
+	inc     _aint0
+	bne     L0002
+	inc     _aint0+1
+L0002:	lda     _aint0
+	ldx     _aint0+1
+	.dbg	line, "add2.c", 95
+	lda     _aint0
+	ldx     _aint0+1
+	ina
+	bne     L0003
+	inx
+L0003:	sta     _aint0
+	stx     _aint0+1
+	.dbg	line, "add2.c", 96
+	lda     _aint0
+	ldx     _aint0+1
+	jsr     incax2
+	sta     _aint0
+	stx     _aint0+1
+	.dbg	line, "add2.c", 97
+	lda     _aint0
+	ldx     _aint0+1
+	jsr     incax3
+	sta     _aint0
+	stx     _aint0+1
+	.dbg	line, "add2.c", 98
+	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$00
+	bne     L0005
+	cmp     #$07
+L0005:	jsr     boolne
+	jeq     L0004
+	.dbg	line, "add2.c", 99
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add2.c", 101
+L0004:	lda     _aint0
+	ldx     _aint0+1
+	clc
+	adc     _aint1
+	sta     _aint1
+	txa
+	adc     _aint1+1
+	sta     _aint1+1
+	tax
+	lda     _aint1
+	.dbg	line, "add2.c", 102
+	lda     _aint1
+	ldx     _aint1+1
+	cpx     #$00
+	bne     L0007
+	cmp     #$27
+L0007:	jsr     boolne
+	jeq     L0006
+	.dbg	line, "add2.c", 103
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add2.c", 105
+L0006:	lda     _aint1
+	ldx     _aint1+1
+	jsr     pushax
+	lda     _aint0
+	ldx     _aint0+1
+	jsr     tosaddax
+	sta     _aint2
+	stx     _aint2+1
+	.dbg	line, "add2.c", 106
+	lda     _aint2
+	ldx     _aint2+1
+	cpx     #$00
+	bne     L0009
+	cmp     #$2E
+L0009:	jsr     boolne
+	jeq     L0008
+	.dbg	line, "add2.c", 107
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add2.c", 109
+L0008:	lda     _aint2
+	ldx     _aint2+1
+	jsr     pushax
+	lda     _aint1
+	ldx     _aint1+1
+	jsr     tosaddax
+	jsr     pushax
+	lda     _aint0
+	ldx     _aint0+1
+	jsr     tosaddax
+	sta     _aint3
+	stx     _aint3+1
+	.dbg	line, "add2.c", 110
+	lda     _aint3
+	ldx     _aint3+1
+	cpx     #$00
+	bne     L000B
+	cmp     #$5C
+L000B:	jsr     boolne
+	jeq     L000A
+	.dbg	line, "add2.c", 111
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add2.c", 113
+L000A:	lda     #$A0
+	clc
+	adc     _aint3
+	sta     _aint3
+	bcc     L000C
+	inc     _aint3+1
+L000C:	ldx     _aint3+1
+	.dbg	line, "add2.c", 114
+	lda     _aint3
+	ldx     _aint3+1
+	cpx     #$00
+	bne     L000E
+	cmp     #$FC
+L000E:	jsr     boolne
+	jeq     L000D
+	.dbg	line, "add2.c", 115
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add2.c", 117
+L000D:	lda     _aint0
+	ldx     _aint0+1
+	clc
+	adc     _aint3
+	sta     _aint3
+	txa
+	adc     _aint3+1
+	sta     _aint3+1
+	tax
+	lda     _aint3
+	.dbg	line, "add2.c", 118
+	lda     _aint3
+	ldx     _aint3+1
+	cpx     #$01
+	bne     L0010
+	cmp     #$03
+L0010:	jsr     boolne
+	jeq     L000F
+	.dbg	line, "add2.c", 119
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add2.c", 121
+L000F:	lda     #$C0
+	clc
+	adc     _aint1
+	sta     _aint1
+	lda     #$FF
+	adc     _aint1+1
+	sta     _aint1+1
+	tax
+	lda     _aint1
+	.dbg	line, "add2.c", 122
+	lda     _aint1
+	ldx     _aint1+1
+	cpx     #$FF
+	bne     L0012
+	cmp     #$E7
+L0012:	jsr     boolne
+	jeq     L0011
+	.dbg	line, "add2.c", 123
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add2.c", 125
+L0011:	lda     _aint2
+	ldx     _aint2+1
+	jsr     pushax
+	lda     _aint1
+	ldx     _aint1+1
+	jsr     tosaddax
+	jsr     pushax
+	lda     _aint0
+	ldx     _aint0+1
+	jsr     tosaddax
+	sta     _aint3
+	stx     _aint3+1
+	.dbg	line, "add2.c", 126
+	lda     _aint3
+	ldx     _aint3+1
+	cpx     #$00
+	bne     L0014
+	cmp     #$1C
+L0014:	jsr     boolne
+	jeq     L0013
+	.dbg	line, "add2.c", 127
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add2.c", 128
+L0013:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ addlits (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_addlits: near
+
+	.dbg	func, "addlits", "00", extern, "_addlits"
+
+.segment	"CODE"
+
+	.dbg	line, "add2.c", 181
+	inc     _aint0
+	bne     L0002
+	inc     _aint0+1
+L0002:	lda     _aint0
+	ldx     _aint0+1
+	.dbg	line, "add2.c", 183
+	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$00
+	bne     L0004
+	cmp     #$01
+L0004:	jsr     boolne
+	jeq     L0003
+	.dbg	line, "add2.c", 184
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add2.c", 186
+L0003:	lda     #$00
+	clc
+	adc     _aint0
+	sta     _aint0
+	bcc     L0005
+	inc     _aint0+1
+L0005:	ldx     _aint0+1
+	.dbg	line, "add2.c", 188
+	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$00
+	bne     L0007
+	cmp     #$01
+L0007:	jsr     boolne
+	jeq     L0006
+	.dbg	line, "add2.c", 189
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add2.c", 191
+L0006:	lda     #$FE
+	clc
+	adc     _aint0
+	sta     _aint0
+	bcc     L0008
+	inc     _aint0+1
+L0008:	ldx     _aint0+1
+	.dbg	line, "add2.c", 192
+	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$00
+	bne     L000A
+	cmp     #$FF
+L000A:	jsr     boolne
+	jeq     L0009
+	.dbg	line, "add2.c", 193
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add2.c", 195
+L0009:	inc     _aint0
+	bne     L000B
+	inc     _aint0+1
+L000B:	lda     _aint0
+	ldx     _aint0+1
+	.dbg	line, "add2.c", 197
+	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$01
+	bne     L000D
+	cmp     #$00
+L000D:	jsr     boolne
+	jeq     L000C
+	.dbg	line, "add2.c", 198
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add2.c", 200
+L000C:	lda     _aint0
+	ldx     _aint0+1
+	inc     _aint0
+	bne     L000E
+	inc     _aint0+1
+L000E:	lda     _aint0
+	ldx     _aint0+1
+	.dbg	line, "add2.c", 201
+	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$01
+	bne     L0010
+	cmp     #$01
+L0010:	jsr     boolne
+	jeq     L000F
+	.dbg	line, "add2.c", 202
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add2.c", 204
+L000F:	lda     #$FF
+	clc
+	adc     _aint0
+	sta     _aint0
+	bcc     L0011
+	inc     _aint0+1
+L0011:	ldx     _aint0+1
+	.dbg	line, "add2.c", 205
+	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$02
+	bne     L0013
+	cmp     #$00
+L0013:	jsr     boolne
+	jeq     L0012
+	.dbg	line, "add2.c", 206
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add2.c", 208
+L0012:	lda     #$A0
+	clc
+	adc     _aint0
+	sta     _aint0
+	bcc     L0014
+	inc     _aint0+1
+L0014:	ldx     _aint0+1
+	.dbg	line, "add2.c", 209
+	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$02
+	bne     L0016
+	cmp     #$A0
+L0016:	jsr     boolne
+	jeq     L0015
+	.dbg	line, "add2.c", 210
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add2.c", 212
+L0015:	lda     #$61
+	clc
+	adc     _aint0
+	sta     _aint0
+	bcc     L0017
+	inc     _aint0+1
+L0017:	ldx     _aint0+1
+	.dbg	line, "add2.c", 213
+	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$03
+	bne     L0019
+	cmp     #$01
+L0019:	jsr     boolne
+	jeq     L0018
+	.dbg	line, "add2.c", 214
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add2.c", 216
+L0018:	lda     #$00
+	clc
+	adc     _aint0
+	sta     _aint0
+	lda     #$01
+	adc     _aint0+1
+	sta     _aint0+1
+	tax
+	lda     _aint0
+	.dbg	line, "add2.c", 217
+	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$04
+	bne     L001B
+	cmp     #$01
+L001B:	jsr     boolne
+	jeq     L001A
+	.dbg	line, "add2.c", 218
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add2.c", 220
+L001A:	lda     #$01
+	clc
+	adc     _aint0
+	sta     _aint0
+	lda     #$01
+	adc     _aint0+1
+	sta     _aint0+1
+	tax
+	lda     _aint0
+	.dbg	line, "add2.c", 221
+	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$05
+	bne     L001D
+	cmp     #$02
+L001D:	jsr     boolne
+	jeq     L001C
+	.dbg	line, "add2.c", 222
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add2.c", 224
+L001C:	lda     #$FD
+	clc
+	adc     _aint0
+	sta     _aint0
+	bcc     L001E
+	inc     _aint0+1
+L001E:	ldx     _aint0+1
+	.dbg	line, "add2.c", 225
+	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$05
+	bne     L0020
+	cmp     #$FF
+L0020:	jsr     boolne
+	jeq     L001F
+	.dbg	line, "add2.c", 226
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add2.c", 228
+L001F:	lda     #$01
+	clc
+	adc     _aint0
+	sta     _aint0
+	lda     #$01
+	adc     _aint0+1
+	sta     _aint0+1
+	tax
+	lda     _aint0
+	.dbg	line, "add2.c", 229
+	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$07
+	bne     L0022
+	cmp     #$00
+L0022:	jsr     boolne
+	jeq     L0021
+	.dbg	line, "add2.c", 230
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add2.c", 232
+L0021:	lda     #$FF
+	clc
+	adc     _aint0
+	sta     _aint0
+	lda     #$01
+	adc     _aint0+1
+	sta     _aint0+1
+	tax
+	lda     _aint0
+	.dbg	line, "add2.c", 233
+	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$08
+	bne     L0024
+	cmp     #$FF
+L0024:	jsr     boolne
+	jeq     L0023
+	.dbg	line, "add2.c", 234
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add2.c", 236
+L0023:	lda     #$FF
+	clc
+	adc     _aint0
+	sta     _aint0
+	lda     #$01
+	adc     _aint0+1
+	sta     _aint0+1
+	tax
+	lda     _aint0
+	.dbg	line, "add2.c", 237
+	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$0A
+	bne     L0026
+	cmp     #$FE
+L0026:	jsr     boolne
+	jeq     L0025
+	.dbg	line, "add2.c", 238
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add2.c", 240
+L0025:	lda     #$02
+	clc
+	adc     _aint0
+	sta     _aint0
+	lda     #$FF
+	adc     _aint0+1
+	sta     _aint0+1
+	tax
+	lda     _aint0
+	.dbg	line, "add2.c", 241
+	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$0A
+	bne     L0028
+	cmp     #$00
+L0028:	jsr     boolne
+	jeq     L0027
+	.dbg	line, "add2.c", 242
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add2.c", 244
+L0027:	lda     #$FF
+	clc
+	adc     _aint0
+	sta     _aint0
+	lda     #$FF
+	adc     _aint0+1
+	sta     _aint0+1
+	tax
+	lda     _aint0
+	.dbg	line, "add2.c", 245
+	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$09
+	bne     L002A
+	cmp     #$FF
+L002A:	jsr     boolne
+	jeq     L0029
+	.dbg	line, "add2.c", 246
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add2.c", 248
+L0029:	lda     #$01
+	clc
+	adc     _aint0
+	sta     _aint0
+	lda     #$FF
+	adc     _aint0+1
+	sta     _aint0+1
+	tax
+	lda     _aint0
+	.dbg	line, "add2.c", 249
+	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$09
+	bne     L002C
+	cmp     #$00
+L002C:	jsr     boolne
+	jeq     L002B
+	.dbg	line, "add2.c", 250
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add2.c", 252
+L002B:	lda     #$00
+	clc
+	adc     _aint0
+	sta     _aint0
+	lda     #$FF
+	adc     _aint0+1
+	sta     _aint0+1
+	tax
+	lda     _aint0
+	.dbg	line, "add2.c", 253
+	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$08
+	bne     L002E
+	cmp     #$00
+L002E:	jsr     boolne
+	jeq     L002D
+	.dbg	line, "add2.c", 254
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add2.c", 256
+L002D:	lda     #$01
+	clc
+	adc     _aint0
+	sta     _aint0
+	lda     #$FF
+	adc     _aint0+1
+	sta     _aint0+1
+	tax
+	lda     _aint0
+	.dbg	line, "add2.c", 257
+	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$07
+	bne     L0030
+	cmp     #$01
+L0030:	jsr     boolne
+	jeq     L002F
+	.dbg	line, "add2.c", 258
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add2.c", 260
+L002F:	lda     #$00
+	clc
+	adc     _aint0
+	sta     _aint0
+	lda     #$03
+	adc     _aint0+1
+	sta     _aint0+1
+	tax
+	lda     _aint0
+	.dbg	line, "add2.c", 261
+	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$0A
+	bne     L0032
+	cmp     #$01
+L0032:	jsr     boolne
+	jeq     L0031
+	.dbg	line, "add2.c", 262
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add2.c", 264
+L0031:	lda     #$FF
+	clc
+	adc     _aint0
+	sta     _aint0
+	lda     #$03
+	adc     _aint0+1
+	sta     _aint0+1
+	tax
+	lda     _aint0
+	.dbg	line, "add2.c", 265
+	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$0E
+	bne     L0034
+	cmp     #$00
+L0034:	jsr     boolne
+	jeq     L0033
+	.dbg	line, "add2.c", 266
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add2.c", 268
+L0033:	lda     #$01
+	clc
+	adc     _aint0
+	sta     _aint0
+	lda     #$03
+	adc     _aint0+1
+	sta     _aint0+1
+	tax
+	lda     _aint0
+	.dbg	line, "add2.c", 269
+	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$11
+	bne     L0036
+	cmp     #$01
+L0036:	jsr     boolne
+	jeq     L0035
+	.dbg	line, "add2.c", 270
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add2.c", 272
+L0035:	lda     #$FE
+	clc
+	adc     _aint0
+	sta     _aint0
+	lda     #$03
+	adc     _aint0+1
+	sta     _aint0+1
+	tax
+	lda     _aint0
+	.dbg	line, "add2.c", 273
+	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$14
+	bne     L0038
+	cmp     #$FF
+L0038:	jsr     boolne
+	jeq     L0037
+	.dbg	line, "add2.c", 274
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add2.c", 276
+L0037:	lda     #$01
+	clc
+	adc     _aint0
+	sta     _aint0
+	lda     #$03
+	adc     _aint0+1
+	sta     _aint0+1
+	tax
+	lda     _aint0
+	.dbg	line, "add2.c", 277
+	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$18
+	bne     L003A
+	cmp     #$00
+L003A:	jsr     boolne
+	jeq     L0039
+	.dbg	line, "add2.c", 278
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add2.c", 279
+L0039:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "add2.c", 283
+	jsr     _add_lit2uint
+	.dbg	line, "add2.c", 285
+	ldx     #$00
+	lda     #$10
+	sta     _aint0
+	stx     _aint0+1
+	.dbg	line, "add2.c", 286
+	ldx     #$00
+	lda     #$00
+	sta     _aint1
+	stx     _aint1+1
+	.dbg	line, "add2.c", 287
+	jsr     _add_uint2uint
+	.dbg	line, "add2.c", 289
+	ldx     #$00
+	lda     #$00
+	sta     _aint0
+	stx     _aint0+1
+	.dbg	line, "add2.c", 290
+	ldx     #$00
+	lda     #$20
+	sta     _aint1
+	stx     _aint1+1
+	.dbg	line, "add2.c", 291
+	ldx     #$00
+	lda     #$00
+	sta     _aint2
+	stx     _aint2+1
+	.dbg	line, "add2.c", 292
+	jsr     _add_uint2uint2
+	.dbg	line, "add2.c", 305
+	ldx     #$00
+	lda     #$00
+	sta     _aint0
+	stx     _aint0+1
+	.dbg	line, "add2.c", 306
+	jsr     _addlits
+	.dbg	line, "add2.c", 308
+	ldx     #$00
+	lda     _failures
+	sta     _success
+	.dbg	line, "add2.c", 309
+	jsr     _done
+	.dbg	line, "add2.c", 310
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "add2.c", 312
+	ldx     #$00
+	lda     _failures
+	jmp     L0001
+	.dbg	line, "add2.c", 313
+L0001:	rts
+
+	.dbg	line
+.endproc
+
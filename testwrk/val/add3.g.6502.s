@@ -0,0 +1,1133 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "add3.c", 3663, 1613073744
+	.dbg		file, "common.h", 522, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/stdlib.h", 5999, 1613073744
+	.dbg		file, "/root/repo/include/limits.h", 3146, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.dbg		sym, "exit", "00", extern, "_exit"
+	.import		_printf
+	.import		_exit
+	.export		_failures
+	.export		_char0
+	.export		_char1
+	.export		_char2
+	.export		_int0
+	.export		_int1
+	.export		_long0
+	.export		_long1
+	.export		_ulong0
+	.export		_ulong1
+	.export		_done
+	.export		_add_char2char
+	.export		_add_compound_char
+	.export		_add_int2int
+	.export		_add_compound_int
+	.export		_add_lit2long
+	.export		_add_lit2ulong
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+_char0:
+	.byte	$00
+_char1:
+	.byte	$00
+_char2:
+	.byte	$00
+_int0:
+	.word	$0000
+_int1:
+	.word	$0000
+_long0:
+	.dword	$00000000
+_long1:
+	.dword	$00000000
+_ulong0:
+	.dword	$00000000
+_ulong1:
+	.dword	$00000000
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$25,$73,$20,$64,$6F,$6E,$65,$20,$2D,$20,$66,$61,$69,$6C,$75,$72
+	.byte	$65,$73,$3A,$20,$25,$64,$0A,$00
+S0003:
+	.byte	$61,$64,$64,$5F,$63,$6F,$6D,$70,$6F,$75,$6E,$64,$5F,$63,$68,$61
+	.byte	$72,$00
+S0005:
+	.byte	$61,$64,$64,$5F,$63,$6F,$6D,$70,$6F,$75,$6E,$64,$5F,$69,$6E,$74
+	.byte	$00
+S0007:
+	.byte	$61,$64,$64,$5F,$6C,$69,$74,$32,$75,$6C,$6F,$6E,$67,$00
+S0002:
+	.byte	$61,$64,$64,$5F,$63,$68,$61,$72,$32,$63,$68,$61,$72,$00
+S0006:
+	.byte	$61,$64,$64,$5F,$6C,$69,$74,$32,$6C,$6F,$6E,$67,$00
+S0004:
+	.byte	$61,$64,$64,$5F,$69,$6E,$74,$32,$69,$6E,$74,$00
+
+; ---------------------------------------------------------------
+; void __near__ done (char *name)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_done: near
+
+	.dbg	func, "done", "00", extern, "_done"
+	.dbg	sym, "name", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "add3.c", 76
+	jsr     pushax
+	.dbg	line, "add3.c", 77
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "add3.c", 79
+	lda     _failures
+	jeq     L0002
+	.dbg	line, "add3.c", 80
+	ldx     #$00
+	lda     _failures
+	jsr     _exit
+	.dbg	line, "add3.c", 81
+L0002:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ add_char2char (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_add_char2char: near
+
+	.dbg	func, "add_char2char", "00", extern, "_add_char2char"
+
+.segment	"CODE"
+
+	.dbg	line, "add3.c", 85
+	ldx     #$00
+	lda     _char0
+	cmp     #$04
+	jsr     boolne
+	jeq     L0002
+	.dbg	line, "add3.c", 86
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add3.c", 87
+L0002:	ldx     #$00
+	lda     _char1
+	cmp     #$05
+	jsr     boolne
+	jeq     L0003
+	.dbg	line, "add3.c", 88
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add3.c", 90
+L0003:	ldx     #$00
+	lda     _char0
+	jsr     pushax
+	ldx     #$00
+	lda     _char1
+	jsr     tosaddax
+	ldx     #$00
+	sta     _char0
+	.dbg	line, "add3.c", 92
+	ldx     #$00
+	lda     _char0
+	cmp     #$09
+	jsr     boolne
+	jeq     L0004
+	.dbg	line, "add3.c", 93
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add3.c", 95
+L0004:	ldx     #$00
+	lda     #$7F
+	clc
+	adc     _char0
+	sta     _char0
+	.dbg	line, "add3.c", 98
+	ldx     #$00
+	lda     _char0
+	jmp     L0005
+	.dbg	line, "add3.c", 99
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add3.c", 101
+L0005:	ldx     #$00
+	lda     _char0
+	cmp     #$88
+	jsr     boolne
+	jeq     L0006
+	.dbg	line, "add3.c", 102
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add3.c", 111
+L0006:	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     _done
+	.dbg	line, "add3.c", 112
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ add_compound_char (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_add_compound_char: near
+
+	.dbg	func, "add_compound_char", "00", extern, "_add_compound_char"
+
+.segment	"CODE"
+
+	.dbg	line, "add3.c", 116
+	ldx     #$00
+	lda     _char1
+	jsr     incax5
+	ldx     #$00
+	sta     _char0
+	.dbg	line, "add3.c", 118
+	ldx     #$00
+	lda     _char0
+	cmp     #$09
+	jsr     boolne
+	jeq     L0002
+	.dbg	line, "add3.c", 119
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add3.c", 121
+L0002:	ldx     #$00
+	lda     _char0
+	jsr     pushax
+	ldx     #$00
+	lda     _char1
+	jsr     tosaddax
+	cpx     #$00
+	bne     L0004
+	cmp     #$0D
+L0004:	jsr     boolne
+	jeq     L0003
+	.dbg	line, "add3.c", 122
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add3.c", 124
+L0003:	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     _done
+	.dbg	line, "add3.c", 125
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ add_int2int (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_add_int2int: near
+
+	.dbg	func, "add_int2int", "00", extern, "_add_int2int"
+
+.segment	"CODE"
+
+	.dbg	line, "add3.c", 129
+	lda     _int0
+	ldx     _int0+1
+	cpx     #$00
+	bne     L0003
+	cmp     #$04
+L0003:	jsr     boolne
+	jeq     L0002
+	.dbg	line, "add3.c", 130
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add3.c", 131
+L0002:	lda     _int1
+	ldx     _int1+1
+	cpx     #$00
+	bne     L0005
+	cmp     #$05
+L0005:	jsr     boolne
+	jeq     L0004
+	.dbg	line, "add3.c", 132
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add3.c", 134
+L0004:	lda     _int1
+	ldx     _int1+1
+	clc
+	adc     _int0
+	sta     _int0
+	txa
+	adc     _int0+1
+	sta     _int0+1
+	tax
+	lda     _int0
+	.dbg	line, "add3.c", 135
+	lda     _int0
+	ldx     _int0+1
+	cpx     #$00
+	bne     L0007
+	cmp     #$09
+L0007:	jsr     boolne
+	jeq     L0006
+	.dbg	line, "add3.c", 136
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add3.c", 138
+L0006:	lda     #$FF
+	clc
+	adc     _int0
+	sta     _int0
+	lda     #$7F
+	adc     _int0+1
+	sta     _int0+1
+	tax
+	lda     _int0
+	.dbg	line, "add3.c", 139
+	lda     _int0
+	ldx     _int0+1
+	cpx     #$80
+	bne     L0009
+	cmp     #$08
+L0009:	jsr     boolne
+	jeq     L0008
+	.dbg	line, "add3.c", 140
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add3.c", 142
+L0008:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     _done
+	.dbg	line, "add3.c", 143
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ add_compound_int (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_add_compound_int: near
+
+	.dbg	func, "add_compound_int", "00", extern, "_add_compound_int"
+
+.segment	"CODE"
+
+	.dbg	line, "add3.c", 147
+	lda     _int1
+	ldx     _int1+1
+	jsr     incax5
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "add3.c", 149
+	lda     _int0
+	ldx     _int0+1
+	cpx     #$00
+	bne     L0003
+	cmp     #$09
+L0003:	jsr     boolne
+	jeq     L0002
+	.dbg	line, "add3.c", 150
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add3.c", 152
+L0002:	lda     _int0
+	ldx     _int0+1
+	jsr     pushax
+	lda     _int1
+	ldx     _int1+1
+	jsr     tosaddax
+	cpx     #$00
+	bne     L0005
+	cmp     #$0D
+L0005:	jsr     boolne
+	jeq     L0004
+	.dbg	line, "add3.c", 153
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add3.c", 155
+L0004:	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     _done
+	.dbg	line, "add3.c", 156
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ add_lit2long (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_add_lit2long: near
+
+	.dbg	func, "add_lit2long", "00", extern, "_add_lit2long"
+
+.segment	"CODE"
+
+	.dbg	line, "add3.c", 160
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     tosneeax
+	jeq     L0002
+	.dbg	line, "add3.c", 161
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add3.c", 163
+L0002:	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	ldy     #<(_long0)
+	sty     ptr1
+	ldy     #>(_long0)
+	jsr     laddeq1
+	.dbg	line, "add3.c", 165
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     tosneeax
+	jeq     L0003
+	.dbg	line, "add3.c", 166
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add3.c", 168
+L0003:	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	ldy     #$FF
+	jsr     inceaxy
+	sta     _long0
+	stx     _long0+1
+	ldy     sreg
+	sty     _long0+2
+	ldy     sreg+1
+	sty     _long0+3
+	.dbg	line, "add3.c", 170
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldx     #$01
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     tosneeax
+	jeq     L0004
+	.dbg	line, "add3.c", 171
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add3.c", 173
+L0004:	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldx     #$01
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     tosaddeax
+	sta     _long0
+	stx     _long0+1
+	ldy     sreg
+	sty     _long0+2
+	ldy     sreg+1
+	sty     _long0+3
+	.dbg	line, "add3.c", 174
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldx     #$02
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     tosneeax
+	jeq     L0005
+	.dbg	line, "add3.c", 175
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add3.c", 177
+L0005:	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldx     #$FE
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     tosaddeax
+	sta     _long0
+	stx     _long0+1
+	ldy     sreg
+	sty     _long0+2
+	ldy     sreg+1
+	sty     _long0+3
+	.dbg	line, "add3.c", 178
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg+1
+	lda     #$01
+	sta     sreg
+	lda     #$00
+	jsr     tosneeax
+	jeq     L0006
+	.dbg	line, "add3.c", 179
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add3.c", 181
+L0006:	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg+1
+	lda     #$FF
+	sta     sreg
+	lda     #$00
+	jsr     tosaddeax
+	sta     _long0
+	stx     _long0+1
+	ldy     sreg
+	sty     _long0+2
+	ldy     sreg+1
+	sty     _long0+3
+	.dbg	line, "add3.c", 182
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$01
+	sta     sreg+1
+	lda     #$00
+	jsr     tosneeax
+	jeq     L0007
+	.dbg	line, "add3.c", 183
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add3.c", 185
+L0007:	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$7E
+	sta     sreg+1
+	lda     #$00
+	jsr     tosaddeax
+	sta     _long0
+	stx     _long0+1
+	ldy     sreg
+	sty     _long0+2
+	ldy     sreg+1
+	sty     _long0+3
+	.dbg	line, "add3.c", 186
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$7F
+	sta     sreg+1
+	lda     #$00
+	jsr     tosneeax
+	jeq     L0008
+	.dbg	line, "add3.c", 187
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add3.c", 190
+L0008:	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$02
+	sta     sreg+1
+	lda     #$00
+	jsr     tosaddeax
+	sta     _long0
+	stx     _long0+1
+	ldy     sreg
+	sty     _long0+2
+	ldy     sreg+1
+	sty     _long0+3
+	.dbg	line, "add3.c", 191
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$81
+	sta     sreg+1
+	lda     #$00
+	jsr     tosneeax
+	jeq     L0009
+	.dbg	line, "add3.c", 192
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add3.c", 194
+L0009:	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$7F
+	sta     sreg+1
+	lda     #$00
+	jsr     tosaddeax
+	sta     _long0
+	stx     _long0+1
+	ldy     sreg
+	sty     _long0+2
+	ldy     sreg+1
+	sty     _long0+3
+	.dbg	line, "add3.c", 195
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     tosneeax
+	jeq     L000A
+	.dbg	line, "add3.c", 196
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add3.c", 198
+L000A:	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     _done
+	.dbg	line, "add3.c", 199
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ add_lit2ulong (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_add_lit2ulong: near
+
+	.dbg	func, "add_lit2ulong", "00", extern, "_add_lit2ulong"
+
+.segment	"CODE"
+
+	.dbg	line, "add3.c", 203
+	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     tosneeax
+	jeq     L0002
+	.dbg	line, "add3.c", 204
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add3.c", 206
+L0002:	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	ldy     #<(_ulong0)
+	sty     ptr1
+	ldy     #>(_ulong0)
+	jsr     laddeq1
+	.dbg	line, "add3.c", 208
+	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     tosneeax
+	jeq     L0003
+	.dbg	line, "add3.c", 209
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add3.c", 211
+L0003:	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	ldy     #$FF
+	jsr     inceaxy
+	sta     _ulong0
+	stx     _ulong0+1
+	ldy     sreg
+	sty     _ulong0+2
+	ldy     sreg+1
+	sty     _ulong0+3
+	.dbg	line, "add3.c", 213
+	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	ldx     #$01
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     tosneeax
+	jeq     L0004
+	.dbg	line, "add3.c", 214
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add3.c", 216
+L0004:	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	ldx     #$01
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     tosaddeax
+	sta     _ulong0
+	stx     _ulong0+1
+	ldy     sreg
+	sty     _ulong0+2
+	ldy     sreg+1
+	sty     _ulong0+3
+	.dbg	line, "add3.c", 217
+	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	ldx     #$02
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     tosneeax
+	jeq     L0005
+	.dbg	line, "add3.c", 218
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add3.c", 220
+L0005:	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	ldx     #$FE
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     tosaddeax
+	sta     _ulong0
+	stx     _ulong0+1
+	ldy     sreg
+	sty     _ulong0+2
+	ldy     sreg+1
+	sty     _ulong0+3
+	.dbg	line, "add3.c", 221
+	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg+1
+	lda     #$01
+	sta     sreg
+	lda     #$00
+	jsr     tosneeax
+	jeq     L0006
+	.dbg	line, "add3.c", 222
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add3.c", 224
+L0006:	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg+1
+	lda     #$FF
+	sta     sreg
+	lda     #$00
+	jsr     tosaddeax
+	sta     _ulong0
+	stx     _ulong0+1
+	ldy     sreg
+	sty     _ulong0+2
+	ldy     sreg+1
+	sty     _ulong0+3
+	.dbg	line, "add3.c", 225
+	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$01
+	sta     sreg+1
+	lda     #$00
+	jsr     tosneeax
+	jeq     L0007
+	.dbg	line, "add3.c", 226
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add3.c", 228
+L0007:	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$7E
+	sta     sreg+1
+	lda     #$00
+	jsr     tosaddeax
+	sta     _ulong0
+	stx     _ulong0+1
+	ldy     sreg
+	sty     _ulong0+2
+	ldy     sreg+1
+	sty     _ulong0+3
+	.dbg	line, "add3.c", 229
+	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$7F
+	sta     sreg+1
+	lda     #$00
+	jsr     tosneeax
+	jeq     L0008
+	.dbg	line, "add3.c", 230
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add3.c", 232
+L0008:	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$02
+	sta     sreg+1
+	lda     #$00
+	jsr     tosaddeax
+	sta     _ulong0
+	stx     _ulong0+1
+	ldy     sreg
+	sty     _ulong0+2
+	ldy     sreg+1
+	sty     _ulong0+3
+	.dbg	line, "add3.c", 233
+	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$81
+	sta     sreg+1
+	lda     #$00
+	jsr     tosneeax
+	jeq     L0009
+	.dbg	line, "add3.c", 234
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add3.c", 237
+L0009:	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$7F
+	sta     sreg+1
+	lda     #$00
+	jsr     tosaddeax
+	sta     _ulong0
+	stx     _ulong0+1
+	ldy     sreg
+	sty     _ulong0+2
+	ldy     sreg+1
+	sty     _ulong0+3
+	.dbg	line, "add3.c", 238
+	lda     _ulong0+3
+	ora     _ulong0+2
+	ora     _ulong0+1
+	ora     _ulong0+0
+	jeq     L000A
+	.dbg	line, "add3.c", 239
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add3.c", 241
+L000A:	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     _done
+	.dbg	line, "add3.c", 242
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "add3.c", 246
+	ldx     #$00
+	lda     #$04
+	sta     _char0
+	.dbg	line, "add3.c", 247
+	ldx     #$00
+	lda     _char0
+	jsr     incax1
+	ldx     #$00
+	sta     _char1
+	.dbg	line, "add3.c", 248
+	jsr     _add_char2char
+	.dbg	line, "add3.c", 250
+	ldx     #$00
+	lda     #$04
+	sta     _char1
+	.dbg	line, "add3.c", 251
+	jsr     _add_compound_char
+	.dbg	line, "add3.c", 253
+	ldx     #$00
+	lda     #$04
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "add3.c", 254
+	lda     _int0
+	ldx     _int0+1
+	jsr     incax1
+	sta     _int1
+	stx     _int1+1
+	.dbg	line, "add3.c", 255
+	jsr     _add_int2int
+	.dbg	line, "add3.c", 257
+	ldx     #$00
+	lda     #$04
+	sta     _int1
+	stx     _int1+1
+	.dbg	line, "add3.c", 258
+	jsr     _add_compound_int
+	.dbg	line, "add3.c", 260
+	jsr     _add_lit2long
+	.dbg	line, "add3.c", 261
+	jsr     _add_lit2ulong
+	.dbg	line, "add3.c", 264
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "add3.c", 265
+L0001:	rts
+
+	.dbg	line
+.endproc
+
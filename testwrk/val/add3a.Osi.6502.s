@@ -0,0 +1,182 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_long0
+	.export		_print
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.word	$0000
+_long0:
+	.dword	$00000000
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$6C,$6F,$6E,$67,$30,$3A,$20,$25,$6C,$64,$0A,$00
+S0003:
+	.byte	$66,$61,$69,$6C,$65,$64,$21,$0A,$00
+S0002	:=	S0003+0
+
+; ---------------------------------------------------------------
+; void __near__ print (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_print: near
+
+.segment	"CODE"
+
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldy     #$06
+	jmp     _printf
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	stx     sreg
+	lda     #$7F
+	sta     sreg+1
+	txa
+	sta     _long0
+	sta     _long0+1
+	ldy     sreg
+	sty     _long0+2
+	ldy     sreg+1
+	sty     _long0+3
+	jsr     _print
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$02
+	sta     sreg+1
+	txa
+	jsr     tosaddeax
+	sta     _long0
+	stx     _long0+1
+	ldy     sreg
+	sty     _long0+2
+	ldy     sreg+1
+	sty     _long0+3
+	sty     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$81
+	sta     sreg+1
+	txa
+	jsr     tosneeax
+	beq     L0002
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+	bne     L0002
+	inc     _failures+1
+L0002:	jsr     _print
+	ldx     #$00
+	stx     sreg
+	lda     #$7F
+	sta     sreg+1
+	txa
+	sta     _long0
+	sta     _long0+1
+	ldy     sreg
+	sty     _long0+2
+	ldy     sreg+1
+	sty     _long0+3
+	jsr     _print
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$02
+	sta     sreg+1
+	txa
+	jsr     tosaddeax
+	sta     _long0
+	stx     _long0+1
+	ldy     sreg
+	sty     _long0+2
+	ldy     sreg+1
+	sty     _long0+3
+	jsr     _print
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$81
+	sta     sreg+1
+	txa
+	jsr     tosneeax
+	beq     L0004
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+	bne     L0004
+	inc     _failures+1
+L0004:	jsr     _print
+	lda     _failures
+	ldx     _failures+1
+	rts
+
+.endproc
+
@@ -0,0 +1,338 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "add4.c", 1177, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/limits.h", 3146, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_success
+	.export		_failures
+	.export		_dummy
+	.export		_int0
+	.export		_int1
+	.export		_char0
+	.export		_char1
+	.export		_long0
+	.export		_long1
+	.export		_ulong0
+	.export		_ulong1
+	.export		_cP0
+	.export		_cP1
+	.export		_iP0
+	.export		_iP1
+	.export		_done
+	.export		_pc_add
+	.export		_pi_add
+	.export		_main
+
+.segment	"DATA"
+
+_success:
+	.byte	$00
+_failures:
+	.byte	$00
+_dummy:
+	.byte	$00
+_int0:
+	.word	$0000
+_int1:
+	.word	$0000
+_char0:
+	.byte	$00
+_char1:
+	.byte	$00
+_long0:
+	.dword	$00000000
+_long1:
+	.dword	$00000000
+_ulong0:
+	.dword	$00000000
+_ulong1:
+	.dword	$00000000
+_cP0:
+	.word	$0000
+_cP1:
+	.word	$0000
+_iP0:
+	.word	$0000
+_iP1:
+	.word	$0000
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ done (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_done: near
+
+	.dbg	func, "done", "00", extern, "_done"
+
+.segment	"CODE"
+
+	.dbg	line, "add4.c", 34
+	ldx     #$00
+	lda     _dummy
+	inc     _dummy
+	.dbg	line, "add4.c", 35
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ pc_add (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_pc_add: near
+
+	.dbg	func, "pc_add", "00", extern, "_pc_add"
+
+.segment	"CODE"
+
+	.dbg	line, "add4.c", 41
+	lda     _cP1
+	ldx     _cP1+1
+	ldy     #$00
+	jsr     ldauidx
+	jeq     L0002
+	.dbg	line, "add4.c", 42
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add4.c", 44
+L0002:	lda     _cP1
+	ldx     _cP1+1
+	jsr     pushax
+	ldy     #$00
+	jsr     ldauidx
+	clc
+	adc     #$01
+	ldy     #$00
+	jsr     staspidx
+	.dbg	line, "add4.c", 45
+	lda     _cP1
+	ldx     _cP1+1
+	ldy     #$00
+	jsr     ldauidx
+	cmp     #$01
+	jsr     boolne
+	jeq     L0003
+	.dbg	line, "add4.c", 46
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add4.c", 48
+L0003:	ldx     #$00
+	lda     _char0
+	cmp     #$01
+	jsr     boolne
+	jeq     L0004
+	.dbg	line, "add4.c", 49
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add4.c", 51
+L0004:	ldx     #$00
+	lda     _char0
+	inc     _char0
+	.dbg	line, "add4.c", 53
+	lda     _cP1
+	ldx     _cP1+1
+	ldy     #$00
+	jsr     ldauidx
+	cmp     #$02
+	jsr     boolne
+	jeq     L0005
+	.dbg	line, "add4.c", 54
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add4.c", 56
+L0005:	ldx     #$00
+	lda     _char0
+	jsr     pushax
+	lda     _cP1
+	ldx     _cP1+1
+	ldy     #$00
+	jsr     ldauidx
+	jsr     tosaddax
+	ldx     #$00
+	sta     _char1
+	.dbg	line, "add4.c", 58
+	ldx     #$00
+	lda     _char1
+	cmp     #$04
+	jsr     boolne
+	jeq     L0006
+	.dbg	line, "add4.c", 59
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add4.c", 60
+L0006:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ pi_add (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_pi_add: near
+
+	.dbg	func, "pi_add", "00", extern, "_pi_add"
+
+.segment	"CODE"
+
+	.dbg	line, "add4.c", 65
+	lda     _iP0
+	ldx     _iP0+1
+	ldy     #$00
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	jeq     L0002
+	.dbg	line, "add4.c", 66
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add4.c", 68
+L0002:	lda     _iP0
+	ldx     _iP0+1
+	jsr     pushax
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     incax1
+	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "add4.c", 70
+	lda     _iP0
+	ldx     _iP0+1
+	ldy     #$01
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0004
+	cmp     #$01
+L0004:	jsr     boolne
+	jeq     L0003
+	.dbg	line, "add4.c", 71
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add4.c", 73
+L0003:	lda     _int0
+	ldx     _int0+1
+	cpx     #$00
+	bne     L0006
+	cmp     #$01
+L0006:	jsr     boolne
+	jeq     L0005
+	.dbg	line, "add4.c", 74
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add4.c", 76
+L0005:	lda     _int0
+	ldx     _int0+1
+	jsr     pushax
+	lda     _iP0
+	ldx     _iP0+1
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     tosaddax
+	sta     _int1
+	stx     _int1+1
+	.dbg	line, "add4.c", 77
+	lda     _int1
+	ldx     _int1+1
+	cpx     #$00
+	bne     L0008
+	cmp     #$02
+L0008:	jsr     boolne
+	jeq     L0007
+	.dbg	line, "add4.c", 78
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "add4.c", 79
+L0007:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "add4.c", 83
+	lda     #<(_char0)
+	ldx     #>(_char0)
+	sta     _cP1
+	stx     _cP1+1
+	.dbg	line, "add4.c", 84
+	jsr     _pc_add
+	.dbg	line, "add4.c", 86
+	lda     #<(_int0)
+	ldx     #>(_int0)
+	sta     _iP0
+	stx     _iP0+1
+	.dbg	line, "add4.c", 87
+	jsr     _pi_add
+	.dbg	line, "add4.c", 89
+	ldx     #$00
+	lda     _failures
+	sta     _success
+	.dbg	line, "add4.c", 90
+	jsr     _done
+	.dbg	line, "add4.c", 91
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "add4.c", 93
+	ldx     #$00
+	lda     _failures
+	jmp     L0001
+	.dbg	line, "add4.c", 94
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,705 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$61,$64,$64,$35,$3A,$20,$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20
+	.byte	$25,$75,$0A,$00
+
+.segment	"BSS"
+
+_array:
+	.res	16,$00
+_cPtr:
+	.res	2,$00
+_iPtr:
+	.res	2,$00
+_lPtr:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; void __near__ cPointer_char (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_cPointer_char: near
+
+.segment	"CODE"
+
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+	lda     #$03
+	jsr     pusha
+	ldx     #$00
+	lda     (sp,x)
+	clc
+	ldy     #$01
+	adc     (sp),y
+	pha
+	txa
+	iny
+	adc     (sp),y
+	tax
+	pla
+	sta     _cPtr
+	stx     _cPtr+1
+	cpx     #>(_array+3)
+	bne     L0004
+	cmp     #<(_array+3)
+	beq     L0002
+L0004:	inc     _failures
+L0002:	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ cPointer_int (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_cPointer_int: near
+
+.segment	"CODE"
+
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+	lda     #$03
+	jsr     pusha0
+	jsr     ldax0sp
+	clc
+	ldy     #$02
+	adc     (sp),y
+	pha
+	txa
+	iny
+	adc     (sp),y
+	tax
+	pla
+	sta     _cPtr
+	stx     _cPtr+1
+	cpx     #>(_array+3)
+	bne     L0004
+	cmp     #<(_array+3)
+	beq     L0002
+L0004:	inc     _failures
+L0002:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ cPointer_long (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_cPointer_long: near
+
+.segment	"CODE"
+
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+	ldx     #$00
+	lda     #$03
+	jsr     push0ax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     tosaddax
+	sta     _cPtr
+	stx     _cPtr+1
+	cpx     #>(_array+3)
+	bne     L0004
+	cmp     #<(_array+3)
+	beq     L0002
+L0004:	inc     _failures
+L0002:	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ iPointer_char (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_iPointer_char: near
+
+.segment	"CODE"
+
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+	lda     #$03
+	jsr     pusha
+	ldx     #$00
+	lda     (sp,x)
+	asl     a
+	bcc     L0005
+	inx
+	clc
+L0005:	ldy     #$01
+	adc     (sp),y
+	pha
+	txa
+	iny
+	adc     (sp),y
+	tax
+	pla
+	sta     _iPtr
+	stx     _iPtr+1
+	cpx     #>(_array+6)
+	bne     L0006
+	cmp     #<(_array+6)
+	beq     L0002
+L0006:	inc     _failures
+L0002:	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ iPointer_int (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_iPointer_int: near
+
+.segment	"CODE"
+
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+	lda     #$03
+	jsr     pusha0
+	jsr     ldax0sp
+	jsr     aslax1
+	clc
+	ldy     #$02
+	adc     (sp),y
+	pha
+	txa
+	iny
+	adc     (sp),y
+	tax
+	pla
+	sta     _iPtr
+	stx     _iPtr+1
+	cpx     #>(_array+6)
+	bne     L0004
+	cmp     #<(_array+6)
+	beq     L0002
+L0004:	inc     _failures
+L0002:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ iPointer_long (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_iPointer_long: near
+
+.segment	"CODE"
+
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+	ldx     #$00
+	lda     #$03
+	jsr     push0ax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     aslax1
+	jsr     tosaddax
+	sta     _iPtr
+	stx     _iPtr+1
+	cpx     #>(_array+6)
+	bne     L0004
+	cmp     #<(_array+6)
+	beq     L0002
+L0004:	inc     _failures
+L0002:	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ lPointer_char (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_lPointer_char: near
+
+.segment	"CODE"
+
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+	lda     #$03
+	jsr     pusha
+	ldx     #$00
+	lda     (sp,x)
+	jsr     aslax2
+	clc
+	ldy     #$01
+	adc     (sp),y
+	pha
+	txa
+	iny
+	adc     (sp),y
+	tax
+	pla
+	sta     _lPtr
+	stx     _lPtr+1
+	cpx     #>(_array+12)
+	bne     L0004
+	cmp     #<(_array+12)
+	beq     L0002
+L0004:	inc     _failures
+L0002:	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ lPointer_int (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_lPointer_int: near
+
+.segment	"CODE"
+
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+	lda     #$03
+	jsr     pusha0
+	jsr     ldax0sp
+	jsr     aslax2
+	clc
+	ldy     #$02
+	adc     (sp),y
+	pha
+	txa
+	iny
+	adc     (sp),y
+	tax
+	pla
+	sta     _lPtr
+	stx     _lPtr+1
+	cpx     #>(_array+12)
+	bne     L0004
+	cmp     #<(_array+12)
+	beq     L0002
+L0004:	inc     _failures
+L0002:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ lPointer_long (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_lPointer_long: near
+
+.segment	"CODE"
+
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+	ldx     #$00
+	lda     #$03
+	jsr     push0ax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     aslax2
+	jsr     tosaddax
+	sta     _lPtr
+	stx     _lPtr+1
+	cpx     #>(_array+12)
+	bne     L0004
+	cmp     #<(_array+12)
+	beq     L0002
+L0004:	inc     _failures
+L0002:	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ char_cPointer (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_char_cPointer: near
+
+.segment	"CODE"
+
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+	lda     #$03
+	jsr     pusha
+	ldx     #$00
+	lda     (sp,x)
+	jsr     pusha0
+	ldy     #$04
+	jsr     ldaxysp
+	jsr     swapstk
+	jsr     tosaddax
+	sta     _cPtr
+	stx     _cPtr+1
+	cpx     #>(_array+3)
+	bne     L0004
+	cmp     #<(_array+3)
+	beq     L0002
+L0004:	inc     _failures
+L0002:	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_cPointer (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_cPointer: near
+
+.segment	"CODE"
+
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+	lda     #$03
+	jsr     pusha0
+	jsr     pushw0sp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     swapstk
+	jsr     tosaddax
+	sta     _cPtr
+	stx     _cPtr+1
+	cpx     #>(_array+3)
+	bne     L0004
+	cmp     #<(_array+3)
+	beq     L0002
+L0004:	inc     _failures
+L0002:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ long_cPointer (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_long_cPointer: near
+
+.segment	"CODE"
+
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+	ldx     #$00
+	lda     #$03
+	jsr     push0ax
+	jsr     ldeax0sp
+	jsr     pusheax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     tosint
+	jsr     swapstk
+	jsr     tosaddax
+	sta     _cPtr
+	stx     _cPtr+1
+	cpx     #>(_array+3)
+	bne     L0004
+	cmp     #<(_array+3)
+	beq     L0002
+L0004:	inc     _failures
+L0002:	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ char_iPointer (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_char_iPointer: near
+
+.segment	"CODE"
+
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+	lda     #$03
+	jsr     pusha
+	ldx     #$00
+	lda     (sp,x)
+	jsr     pusha0
+	ldy     #$04
+	jsr     ldaxysp
+	jsr     swapstk
+	jsr     aslax1
+	jsr     tosaddax
+	sta     _iPtr
+	stx     _iPtr+1
+	cpx     #>(_array+6)
+	bne     L0004
+	cmp     #<(_array+6)
+	beq     L0002
+L0004:	inc     _failures
+L0002:	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_iPointer (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_iPointer: near
+
+.segment	"CODE"
+
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+	lda     #$03
+	jsr     pusha0
+	jsr     pushw0sp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     swapstk
+	jsr     aslax1
+	jsr     tosaddax
+	sta     _iPtr
+	stx     _iPtr+1
+	cpx     #>(_array+6)
+	bne     L0004
+	cmp     #<(_array+6)
+	beq     L0002
+L0004:	inc     _failures
+L0002:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ long_iPointer (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_long_iPointer: near
+
+.segment	"CODE"
+
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+	ldx     #$00
+	lda     #$03
+	jsr     push0ax
+	jsr     ldeax0sp
+	jsr     pusheax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     tosint
+	jsr     swapstk
+	jsr     aslax1
+	jsr     tosaddax
+	sta     _iPtr
+	stx     _iPtr+1
+	cpx     #>(_array+6)
+	bne     L0004
+	cmp     #<(_array+6)
+	beq     L0002
+L0004:	inc     _failures
+L0002:	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ char_lPointer (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_char_lPointer: near
+
+.segment	"CODE"
+
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+	lda     #$03
+	jsr     pusha
+	ldx     #$00
+	lda     (sp,x)
+	jsr     pusha0
+	ldy     #$04
+	jsr     ldaxysp
+	jsr     swapstk
+	jsr     aslax2
+	jsr     tosaddax
+	sta     _lPtr
+	stx     _lPtr+1
+	cpx     #>(_array+12)
+	bne     L0004
+	cmp     #<(_array+12)
+	beq     L0002
+L0004:	inc     _failures
+L0002:	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_lPointer (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_lPointer: near
+
+.segment	"CODE"
+
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+	lda     #$03
+	jsr     pusha0
+	jsr     pushw0sp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     swapstk
+	jsr     aslax2
+	jsr     tosaddax
+	sta     _lPtr
+	stx     _lPtr+1
+	cpx     #>(_array+12)
+	bne     L0004
+	cmp     #<(_array+12)
+	beq     L0002
+L0004:	inc     _failures
+L0002:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ long_lPointer (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_long_lPointer: near
+
+.segment	"CODE"
+
+	lda     #<(_array)
+	ldx     #>(_array)
+	jsr     pushax
+	ldx     #$00
+	lda     #$03
+	jsr     push0ax
+	jsr     ldeax0sp
+	jsr     pusheax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     tosint
+	jsr     swapstk
+	jsr     aslax2
+	jsr     tosaddax
+	sta     _lPtr
+	stx     _lPtr+1
+	cpx     #>(_array+12)
+	bne     L0004
+	cmp     #<(_array+12)
+	beq     L0002
+L0004:	inc     _failures
+L0002:	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     _cPointer_char
+	jsr     _cPointer_int
+	jsr     _cPointer_long
+	jsr     _iPointer_char
+	jsr     _iPointer_int
+	jsr     _iPointer_long
+	jsr     _lPointer_char
+	jsr     _lPointer_int
+	jsr     _lPointer_long
+	jsr     _char_cPointer
+	jsr     _int_cPointer
+	jsr     _long_cPointer
+	jsr     _char_iPointer
+	jsr     _int_iPointer
+	jsr     _long_iPointer
+	jsr     _char_lPointer
+	jsr     _int_lPointer
+	jsr     _long_lPointer
+	ldx     #$00
+	lda     _failures
+	beq     L0003
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L0003:	lda     _failures
+	rts
+
+.endproc
+
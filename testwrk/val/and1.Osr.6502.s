@@ -0,0 +1,409 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_success
+	.export		_failures
+	.export		_dummy
+	.export		_uint0
+	.export		_uint1
+	.export		_uchar0
+	.export		_uchar1
+	.export		_ulong0
+	.export		_done
+	.export		_and_lit2uchar
+	.export		_and_lit2uint
+	.export		_and_lit2ulong
+	.export		_and_uchar2uchar
+	.export		_main
+
+.segment	"DATA"
+
+_success:
+	.byte	$00
+_failures:
+	.byte	$00
+_dummy:
+	.byte	$00
+_uint0:
+	.word	$0000
+_uint1:
+	.word	$0000
+_uchar0:
+	.byte	$00
+_uchar1:
+	.byte	$00
+_ulong0:
+	.dword	$00000000
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ done (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_done: near
+
+.segment	"CODE"
+
+	inc     _dummy
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ and_lit2uchar (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_and_lit2uchar: near
+
+.segment	"CODE"
+
+	lda     _uchar0
+	cmp     #$FF
+	beq     L0006
+	inc     _failures
+L0006:	lda     _uchar0
+	and     #$7F
+	sta     _uchar0
+	cmp     #$7F
+	beq     L0007
+	inc     _failures
+L0007:	lda     _uchar0
+	and     #$3F
+	sta     _uchar0
+	cmp     #$3F
+	beq     L0008
+	inc     _failures
+L0008:	lda     _uchar0
+	and     #$DF
+	sta     _uchar0
+	cmp     #$1F
+	beq     L0005
+	inc     _failures
+L0005:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ and_lit2uint (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_and_lit2uint: near
+
+.segment	"CODE"
+
+	lda     _uint0+1
+	cmp     #$FF
+	bne     L0012
+	lda     _uint0
+	cmp     #$FF
+	beq     L0002
+L0012:	inc     _failures
+L0002:	lda     _uint0+1
+	and     #$7F
+	tax
+	lda     _uint0
+	sta     _uint0
+	stx     _uint0+1
+	cpx     #$7F
+	bne     L0013
+	cmp     #$FF
+	beq     L0004
+L0013:	inc     _failures
+L0004:	lda     _uint0+1
+	and     #$3F
+	tax
+	lda     _uint0
+	sta     _uint0
+	stx     _uint0+1
+	cpx     #$3F
+	bne     L0014
+	cmp     #$FF
+	beq     L0006
+L0014:	inc     _failures
+L0006:	lda     _uint0+1
+	and     #$DF
+	tax
+	lda     _uint0
+	sta     _uint0
+	stx     _uint0+1
+	cpx     #$1F
+	bne     L0015
+	cmp     #$FF
+	beq     L0008
+L0015:	inc     _failures
+L0008:	lda     _uint0
+	ldx     _uint0+1
+	and     #$7F
+	sta     _uint0
+	stx     _uint0+1
+	cpx     #$1F
+	bne     L0016
+	cmp     #$7F
+	beq     L000A
+L0016:	inc     _failures
+L000A:	lda     _uint0+1
+	and     #$0F
+	tax
+	lda     _uint0
+	and     #$0F
+	sta     _uint0
+	stx     _uint0+1
+	cpx     #$0F
+	bne     L0017
+	cmp     #$0F
+	beq     L000C
+L0017:	inc     _failures
+L000C:	lda     _uint0+1
+	and     #$FE
+	tax
+	lda     _uint0
+	and     #$FE
+	sta     _uint0
+	stx     _uint0+1
+	cpx     #$0E
+	bne     L0018
+	cmp     #$0E
+	beq     L000E
+L0018:	inc     _failures
+L000E:	lda     _uint0+1
+	and     #$F0
+	tax
+	lda     _uint0
+	and     #$F0
+	sta     _uint0
+	stx     _uint0+1
+	cpx     #$00
+	bne     L0019
+	cmp     #$00
+	beq     L0010
+L0019:	inc     _failures
+L0010:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ and_lit2ulong (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_and_lit2ulong: near
+
+.segment	"CODE"
+
+	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	txa
+	jsr     tosneeax
+	beq     L0002
+	inc     _failures
+L0002:	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	lda     #$7F
+	sta     sreg+1
+	txa
+	jsr     tosandeax
+	sta     _ulong0
+	stx     _ulong0+1
+	ldy     sreg
+	sty     _ulong0+2
+	ldy     sreg+1
+	sty     _ulong0+3
+	sty     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	lda     #$7F
+	sta     sreg+1
+	txa
+	jsr     tosneeax
+	beq     L0003
+	inc     _failures
+L0003:	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg+1
+	lda     #$00
+	sta     sreg
+	txa
+	jsr     tosandeax
+	sta     _ulong0
+	stx     _ulong0+1
+	ldy     sreg
+	sty     _ulong0+2
+	ldy     sreg+1
+	sty     _ulong0+3
+	sty     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	ldx     #$FF
+	lda     #$00
+	sta     sreg
+	lda     #$7F
+	sta     sreg+1
+	txa
+	jsr     tosneeax
+	beq     L0004
+	inc     _failures
+L0004:	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	ldx     #$00
+	lda     #$FE
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	jsr     tosandeax
+	sta     _ulong0
+	stx     _ulong0+1
+	ldy     sreg
+	sty     _ulong0+2
+	ldy     sreg+1
+	sty     _ulong0+3
+	sty     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$7E
+	sta     sreg+1
+	lda     #$FF
+	jsr     tosneeax
+	beq     L0005
+	inc     _failures
+L0005:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ and_uchar2uchar (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_and_uchar2uchar: near
+
+.segment	"CODE"
+
+	lda     _uchar1
+	and     _uchar0
+	sta     _uchar0
+	cmp     #$0F
+	beq     L0004
+	inc     _failures
+L0004:	lda     _uchar1
+	and     #$F7
+	sta     _uchar1
+	and     #$FE
+	sta     _uchar0
+	cmp     #$06
+	beq     L0003
+	inc     _failures
+L0003:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #$FF
+	sta     _uchar0
+	jsr     _and_lit2uchar
+	lda     #$FF
+	sta     _uint0
+	sta     _uint0+1
+	jsr     _and_lit2uint
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	txa
+	sta     _ulong0
+	sta     _ulong0+1
+	ldy     sreg
+	sty     _ulong0+2
+	ldy     sreg+1
+	sty     _ulong0+3
+	jsr     _and_lit2ulong
+	lda     #$FF
+	sta     _uchar0
+	lda     #$0F
+	sta     _uchar1
+	jsr     _and_uchar2uchar
+	lda     _failures
+	sta     _success
+	jsr     _done
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     _failures
+	rts
+
+.endproc
+
@@ -0,0 +1,622 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "and1.c", 1860, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/limits.h", 3146, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_success
+	.export		_failures
+	.export		_dummy
+	.export		_uint0
+	.export		_uint1
+	.export		_uchar0
+	.export		_uchar1
+	.export		_ulong0
+	.export		_done
+	.export		_and_lit2uchar
+	.export		_and_lit2uint
+	.export		_and_lit2ulong
+	.export		_and_uchar2uchar
+	.export		_main
+
+.segment	"DATA"
+
+_success:
+	.byte	$00
+_failures:
+	.byte	$00
+_dummy:
+	.byte	$00
+_uint0:
+	.word	$0000
+_uint1:
+	.word	$0000
+_uchar0:
+	.byte	$00
+_uchar1:
+	.byte	$00
+_ulong0:
+	.dword	$00000000
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ done (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_done: near
+
+	.dbg	func, "done", "00", extern, "_done"
+
+.segment	"CODE"
+
+	.dbg	line, "and1.c", 22
+	ldx     #$00
+	lda     _dummy
+	inc     _dummy
+	.dbg	line, "and1.c", 23
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ and_lit2uchar (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_and_lit2uchar: near
+
+	.dbg	func, "and_lit2uchar", "00", extern, "_and_lit2uchar"
+
+.segment	"CODE"
+
+	.dbg	line, "and1.c", 28
+	ldx     #$00
+	lda     _uchar0
+	cmp     #$FF
+	jsr     boolne
+	jeq     L0002
+	.dbg	line, "and1.c", 29
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "and1.c", 31
+L0002:	ldx     #$00
+	lda     _uchar0
+	and     #$7F
+	sta     _uchar0
+	.dbg	line, "and1.c", 33
+	ldx     #$00
+	lda     _uchar0
+	cmp     #$7F
+	jsr     boolne
+	jeq     L0003
+	.dbg	line, "and1.c", 34
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "and1.c", 36
+L0003:	ldx     #$00
+	lda     _uchar0
+	and     #$3F
+	sta     _uchar0
+	.dbg	line, "and1.c", 38
+	ldx     #$00
+	lda     _uchar0
+	cmp     #$3F
+	jsr     boolne
+	jeq     L0004
+	.dbg	line, "and1.c", 39
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "and1.c", 41
+L0004:	ldx     #$00
+	lda     _uchar0
+	and     #$DF
+	sta     _uchar0
+	.dbg	line, "and1.c", 43
+	ldx     #$00
+	lda     _uchar0
+	cmp     #$1F
+	jsr     boolne
+	jeq     L0005
+	.dbg	line, "and1.c", 44
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "and1.c", 45
+L0005:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ and_lit2uint (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_and_lit2uint: near
+
+	.dbg	func, "and_lit2uint", "00", extern, "_and_lit2uint"
+
+.segment	"CODE"
+
+	.dbg	line, "and1.c", 49
+	lda     _uint0
+	ldx     _uint0+1
+	cpx     #$FF
+	bne     L0003
+	cmp     #$FF
+L0003:	jsr     boolne
+	jeq     L0002
+	.dbg	line, "and1.c", 50
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "and1.c", 52
+L0002:	lda     _uint0
+	ldx     _uint0+1
+	tay
+	txa
+	and     #$7F
+	tax
+	tya
+	sta     _uint0
+	stx     _uint0+1
+	.dbg	line, "and1.c", 54
+	lda     _uint0
+	ldx     _uint0+1
+	cpx     #$7F
+	bne     L0005
+	cmp     #$FF
+L0005:	jsr     boolne
+	jeq     L0004
+	.dbg	line, "and1.c", 55
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "and1.c", 57
+L0004:	lda     _uint0
+	ldx     _uint0+1
+	tay
+	txa
+	and     #$3F
+	tax
+	tya
+	sta     _uint0
+	stx     _uint0+1
+	.dbg	line, "and1.c", 59
+	lda     _uint0
+	ldx     _uint0+1
+	cpx     #$3F
+	bne     L0007
+	cmp     #$FF
+L0007:	jsr     boolne
+	jeq     L0006
+	.dbg	line, "and1.c", 60
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "and1.c", 62
+L0006:	lda     _uint0
+	ldx     _uint0+1
+	tay
+	txa
+	and     #$DF
+	tax
+	tya
+	sta     _uint0
+	stx     _uint0+1
+	.dbg	line, "and1.c", 64
+	lda     _uint0
+	ldx     _uint0+1
+	cpx     #$1F
+	bne     L0009
+	cmp     #$FF
+L0009:	jsr     boolne
+	jeq     L0008
+	.dbg	line, "and1.c", 65
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "and1.c", 67
+L0008:	lda     _uint0
+	ldx     _uint0+1
+	and     #$7F
+	sta     _uint0
+	stx     _uint0+1
+	.dbg	line, "and1.c", 69
+	lda     _uint0
+	ldx     _uint0+1
+	cpx     #$1F
+	bne     L000B
+	cmp     #$7F
+L000B:	jsr     boolne
+	jeq     L000A
+	.dbg	line, "and1.c", 70
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "and1.c", 72
+L000A:	lda     _uint0
+	ldx     _uint0+1
+	tay
+	txa
+	and     #$0F
+	tax
+	tya
+	and     #$0F
+	sta     _uint0
+	stx     _uint0+1
+	.dbg	line, "and1.c", 74
+	lda     _uint0
+	ldx     _uint0+1
+	cpx     #$0F
+	bne     L000D
+	cmp     #$0F
+L000D:	jsr     boolne
+	jeq     L000C
+	.dbg	line, "and1.c", 75
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "and1.c", 77
+L000C:	lda     _uint0
+	ldx     _uint0+1
+	tay
+	txa
+	and     #$FE
+	tax
+	tya
+	and     #$FE
+	sta     _uint0
+	stx     _uint0+1
+	.dbg	line, "and1.c", 79
+	lda     _uint0
+	ldx     _uint0+1
+	cpx     #$0E
+	bne     L000F
+	cmp     #$0E
+L000F:	jsr     boolne
+	jeq     L000E
+	.dbg	line, "and1.c", 80
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "and1.c", 82
+L000E:	lda     _uint0
+	ldx     _uint0+1
+	tay
+	txa
+	and     #$F0
+	tax
+	tya
+	and     #$F0
+	sta     _uint0
+	stx     _uint0+1
+	.dbg	line, "and1.c", 84
+	lda     _uint0
+	ldx     _uint0+1
+	cpx     #$00
+	bne     L0011
+	cmp     #$00
+L0011:	jsr     boolne
+	jeq     L0010
+	.dbg	line, "and1.c", 85
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "and1.c", 86
+L0010:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ and_lit2ulong (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_and_lit2ulong: near
+
+	.dbg	func, "and_lit2ulong", "00", extern, "_and_lit2ulong"
+
+.segment	"CODE"
+
+	.dbg	line, "and1.c", 90
+	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     tosneeax
+	jeq     L0002
+	.dbg	line, "and1.c", 91
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "and1.c", 93
+L0002:	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	lda     #$7F
+	sta     sreg+1
+	lda     #$FF
+	jsr     tosandeax
+	sta     _ulong0
+	stx     _ulong0+1
+	ldy     sreg
+	sty     _ulong0+2
+	ldy     sreg+1
+	sty     _ulong0+3
+	.dbg	line, "and1.c", 95
+	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	lda     #$7F
+	sta     sreg+1
+	lda     #$FF
+	jsr     tosneeax
+	jeq     L0003
+	.dbg	line, "and1.c", 96
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "and1.c", 98
+L0003:	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg+1
+	lda     #$00
+	sta     sreg
+	lda     #$FF
+	jsr     tosandeax
+	sta     _ulong0
+	stx     _ulong0+1
+	ldy     sreg
+	sty     _ulong0+2
+	ldy     sreg+1
+	sty     _ulong0+3
+	.dbg	line, "and1.c", 100
+	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	ldx     #$FF
+	lda     #$00
+	sta     sreg
+	lda     #$7F
+	sta     sreg+1
+	lda     #$FF
+	jsr     tosneeax
+	jeq     L0004
+	.dbg	line, "and1.c", 101
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "and1.c", 103
+L0004:	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	ldx     #$00
+	lda     #$FE
+	sta     sreg+1
+	lda     #$FF
+	sta     sreg
+	jsr     tosandeax
+	sta     _ulong0
+	stx     _ulong0+1
+	ldy     sreg
+	sty     _ulong0+2
+	ldy     sreg+1
+	sty     _ulong0+3
+	.dbg	line, "and1.c", 105
+	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$7E
+	sta     sreg+1
+	lda     #$FF
+	jsr     tosneeax
+	jeq     L0005
+	.dbg	line, "and1.c", 106
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "and1.c", 107
+L0005:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ and_uchar2uchar (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_and_uchar2uchar: near
+
+	.dbg	func, "and_uchar2uchar", "00", extern, "_and_uchar2uchar"
+
+.segment	"CODE"
+
+	.dbg	line, "and1.c", 112
+	ldx     #$00
+	lda     _uchar0
+	jsr     pushax
+	ldx     #$00
+	lda     _uchar1
+	jsr     tosandax
+	sta     _uchar0
+	.dbg	line, "and1.c", 114
+	ldx     #$00
+	lda     _uchar0
+	cmp     #$0F
+	jsr     boolne
+	jeq     L0002
+	.dbg	line, "and1.c", 115
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "and1.c", 117
+L0002:	ldx     #$00
+	lda     _uchar1
+	and     #$F7
+	sta     _uchar1
+	.dbg	line, "and1.c", 119
+	ldx     #$00
+	lda     _uchar1
+	ldx     #$00
+	and     #$FE
+	ldx     #$00
+	sta     _uchar0
+	.dbg	line, "and1.c", 121
+	ldx     #$00
+	lda     _uchar0
+	cmp     #$06
+	jsr     boolne
+	jeq     L0003
+	.dbg	line, "and1.c", 122
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "and1.c", 123
+L0003:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "and1.c", 127
+	ldx     #$00
+	lda     #$FF
+	sta     _uchar0
+	.dbg	line, "and1.c", 128
+	jsr     _and_lit2uchar
+	.dbg	line, "and1.c", 130
+	ldx     #$FF
+	lda     #$FF
+	sta     _uint0
+	stx     _uint0+1
+	.dbg	line, "and1.c", 131
+	jsr     _and_lit2uint
+	.dbg	line, "and1.c", 133
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	sta     _ulong0
+	stx     _ulong0+1
+	ldy     sreg
+	sty     _ulong0+2
+	ldy     sreg+1
+	sty     _ulong0+3
+	.dbg	line, "and1.c", 134
+	jsr     _and_lit2ulong
+	.dbg	line, "and1.c", 136
+	ldx     #$00
+	lda     #$FF
+	sta     _uchar0
+	.dbg	line, "and1.c", 137
+	ldx     #$00
+	lda     #$0F
+	sta     _uchar1
+	.dbg	line, "and1.c", 138
+	jsr     _and_uchar2uchar
+	.dbg	line, "and1.c", 140
+	ldx     #$00
+	lda     _failures
+	sta     _success
+	.dbg	line, "and1.c", 141
+	jsr     _done
+	.dbg	line, "and1.c", 142
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "and1.c", 144
+	ldx     #$00
+	lda     _failures
+	jmp     L0001
+	.dbg	line, "and1.c", 145
+L0001:	rts
+
+	.dbg	line
+.endproc
+
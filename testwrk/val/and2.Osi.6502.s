@@ -0,0 +1,284 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_success
+	.export		_failures
+	.export		_dummy
+	.export		_uint0
+	.export		_uint1
+	.export		_uchar0
+	.export		_uchar1
+	.export		_ulong0
+	.export		_done
+	.export		_and_compound1
+	.export		_and_compound2
+	.export		_or_compound1
+	.export		_or_compound2
+	.export		_xor_compound1
+	.export		_xor_compound2
+	.export		_neg_compound1
+	.export		_main
+
+.segment	"DATA"
+
+_success:
+	.byte	$00
+_failures:
+	.byte	$00
+_dummy:
+	.byte	$00
+_uint0:
+	.word	$0000
+_uint1:
+	.word	$0000
+_uchar0:
+	.byte	$00
+_uchar1:
+	.byte	$00
+_ulong0:
+	.dword	$00000000
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ done (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_done: near
+
+.segment	"CODE"
+
+	inc     _dummy
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ and_compound1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_and_compound1: near
+
+.segment	"CODE"
+
+	lda     _uchar0
+	clc
+	adc     #$01
+	and     #$0F
+	sta     _uchar0
+	cmp     #$04
+	beq     L0003
+	inc     _failures
+L0003:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ and_compound2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_and_compound2: near
+
+.segment	"CODE"
+
+	lda     _uchar1
+	clc
+	adc     #$01
+	and     #$0F
+	sta     _uchar0
+	cmp     #$03
+	beq     L0005
+	inc     _failures
+L0005:	lda     _uchar1
+	cmp     #$42
+	beq     L0004
+	inc     _failures
+L0004:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ or_compound1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_or_compound1: near
+
+.segment	"CODE"
+
+	lda     _uchar0
+	clc
+	adc     #$0E
+	ora     #$0F
+	sta     _uchar0
+	cmp     #$2F
+	beq     L0003
+	inc     _failures
+L0003:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ or_compound2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_or_compound2: near
+
+.segment	"CODE"
+
+	lda     _uchar1
+	clc
+	adc     #$0F
+	ora     #$0F
+	sta     _uchar0
+	cmp     #$5F
+	beq     L0005
+	inc     _failures
+L0005:	lda     _uchar1
+	cmp     #$47
+	beq     L0004
+	inc     _failures
+L0004:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ xor_compound1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_xor_compound1: near
+
+.segment	"CODE"
+
+	lda     _uchar0
+	clc
+	adc     #$01
+	eor     #$0F
+	sta     _uchar0
+	cmp     #$1B
+	beq     L0003
+	inc     _failures
+L0003:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ xor_compound2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_xor_compound2: near
+
+.segment	"CODE"
+
+	lda     _uchar1
+	clc
+	adc     #$0F
+	eor     #$0F
+	sta     _uchar0
+	cmp     #$59
+	beq     L0005
+	inc     _failures
+L0005:	lda     _uchar1
+	cmp     #$47
+	beq     L0004
+	inc     _failures
+L0004:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ neg_compound1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_neg_compound1: near
+
+.segment	"CODE"
+
+	lda     _uchar0
+	clc
+	adc     #$01
+	eor     #$FF
+	sta     _uchar0
+	cmp     #$EB
+	beq     L0003
+	inc     _failures
+L0003:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #$13
+	sta     _uchar0
+	jsr     _and_compound1
+	lda     #$42
+	sta     _uchar1
+	jsr     _and_compound2
+	lda     #$13
+	sta     _uchar0
+	jsr     _or_compound1
+	lda     #$47
+	sta     _uchar1
+	jsr     _or_compound2
+	lda     #$13
+	sta     _uchar0
+	jsr     _xor_compound1
+	lda     #$47
+	sta     _uchar1
+	jsr     _xor_compound2
+	lda     #$13
+	sta     _uchar0
+	jsr     _neg_compound1
+	lda     _failures
+	sta     _success
+	jsr     _done
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     _failures
+	rts
+
+.endproc
+
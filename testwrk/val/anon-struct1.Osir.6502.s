@@ -0,0 +1,190 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_fails:
+	.byte	$00
+
+.segment	"RODATA"
+
+_four:
+	.word	$0004
+_seven:
+	.word	$0007
+_ten:
+	.word	$000A
+S0001:
+	.byte	$73,$31,$5F,$74,$20,$73,$69,$7A,$65,$20,$69,$73,$20,$25,$75,$3B
+	.byte	$20,$69,$74,$20,$73,$68,$6F,$75,$6C,$64,$20,$62,$65,$20,$31,$30
+	.byte	$2E,$0A,$00
+S0003:
+	.byte	$75,$31,$5F,$74,$20,$73,$69,$7A,$65,$20,$69,$73,$20,$25,$75,$3B
+	.byte	$20,$69,$74,$20,$73,$68,$6F,$75,$6C,$64,$20,$62,$65,$20,$37,$2E
+	.byte	$0A,$00
+S0004:
+	.byte	$75,$32,$5F,$74,$20,$73,$69,$7A,$65,$20,$69,$73,$20,$25,$75,$3B
+	.byte	$20,$69,$74,$20,$73,$68,$6F,$75,$6C,$64,$20,$62,$65,$20,$34,$2E
+	.byte	$0A,$00
+S0002:
+	.byte	$73,$32,$5F,$74,$20,$73,$69,$7A,$65,$20,$69,$73,$20,$25,$75,$3B
+	.byte	$20,$69,$74,$20,$73,$68,$6F,$75,$6C,$64,$20,$62,$65,$20,$37,$2E
+	.byte	$0A,$00
+S0005:
+	.byte	$73,$31,$20,$73,$69,$7A,$65,$20,$69,$73,$20,$25,$75,$3B,$20,$69
+	.byte	$74,$20,$73,$68,$6F,$75,$6C,$64,$20,$62,$65,$20,$31,$30,$2E,$0A
+	.byte	$00
+S0007:
+	.byte	$75,$31,$20,$73,$69,$7A,$65,$20,$69,$73,$20,$25,$75,$3B,$20,$69
+	.byte	$74,$20,$73,$68,$6F,$75,$6C,$64,$20,$62,$65,$20,$37,$2E,$0A,$00
+S0008:
+	.byte	$75,$32,$20,$73,$69,$7A,$65,$20,$69,$73,$20,$25,$75,$3B,$20,$69
+	.byte	$74,$20,$73,$68,$6F,$75,$6C,$64,$20,$62,$65,$20,$34,$2E,$0A,$00
+S0006:
+	.byte	$73,$32,$20,$73,$69,$7A,$65,$20,$69,$73,$20,$25,$75,$3B,$20,$69
+	.byte	$74,$20,$73,$68,$6F,$75,$6C,$64,$20,$62,$65,$20,$37,$2E,$0A,$00
+
+.segment	"BSS"
+
+_s1:
+	.res	10,$00
+_s2:
+	.res	7,$00
+_u1:
+	.res	7,$00
+_u2:
+	.res	4,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     _ten+1
+	bne     L0012
+	lda     _ten
+	cmp     #$0A
+	beq     L0002
+L0012:	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     #$0A
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	inc     _fails
+L0002:	lda     _seven+1
+	bne     L0013
+	lda     _seven
+	cmp     #$07
+	beq     L0003
+L0013:	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     #$07
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	inc     _fails
+L0003:	lda     _seven+1
+	bne     L0014
+	lda     _seven
+	cmp     #$07
+	beq     L0004
+L0014:	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     #$07
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	inc     _fails
+L0004:	lda     _four+1
+	bne     L0015
+	lda     _four
+	cmp     #$04
+	beq     L0005
+L0015:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	tay
+	jsr     _printf
+	inc     _fails
+L0005:	lda     _ten+1
+	bne     L0016
+	lda     _ten
+	cmp     #$0A
+	beq     L0006
+L0016:	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     #$0A
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	inc     _fails
+L0006:	lda     _seven+1
+	bne     L0017
+	lda     _seven
+	cmp     #$07
+	beq     L0007
+L0017:	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	lda     #$07
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	inc     _fails
+L0007:	lda     _seven+1
+	bne     L0018
+	lda     _seven
+	cmp     #$07
+	beq     L0008
+L0018:	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	lda     #$07
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	inc     _fails
+L0008:	lda     _four+1
+	bne     L0019
+	lda     _four
+	cmp     #$04
+	beq     L0009
+L0019:	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	tay
+	jsr     _printf
+	inc     _fails
+L0009:	ldx     #$00
+	lda     _fails
+	rts
+
+.endproc
+
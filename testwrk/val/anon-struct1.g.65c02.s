@@ -0,0 +1,265 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "anon-struct1.c", 2207, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_fails:
+	.byte	$00
+
+.segment	"RODATA"
+
+_four:
+	.word	$0004
+_seven:
+	.word	$0007
+_ten:
+	.word	$000A
+S0001:
+	.byte	$73,$31,$5F,$74,$20,$73,$69,$7A,$65,$20,$69,$73,$20,$25,$75,$3B
+	.byte	$20,$69,$74,$20,$73,$68,$6F,$75,$6C,$64,$20,$62,$65,$20,$31,$30
+	.byte	$2E,$0A,$00
+S0003:
+	.byte	$75,$31,$5F,$74,$20,$73,$69,$7A,$65,$20,$69,$73,$20,$25,$75,$3B
+	.byte	$20,$69,$74,$20,$73,$68,$6F,$75,$6C,$64,$20,$62,$65,$20,$37,$2E
+	.byte	$0A,$00
+S0004:
+	.byte	$75,$32,$5F,$74,$20,$73,$69,$7A,$65,$20,$69,$73,$20,$25,$75,$3B
+	.byte	$20,$69,$74,$20,$73,$68,$6F,$75,$6C,$64,$20,$62,$65,$20,$34,$2E
+	.byte	$0A,$00
+S0002:
+	.byte	$73,$32,$5F,$74,$20,$73,$69,$7A,$65,$20,$69,$73,$20,$25,$75,$3B
+	.byte	$20,$69,$74,$20,$73,$68,$6F,$75,$6C,$64,$20,$62,$65,$20,$37,$2E
+	.byte	$0A,$00
+S0005:
+	.byte	$73,$31,$20,$73,$69,$7A,$65,$20,$69,$73,$20,$25,$75,$3B,$20,$69
+	.byte	$74,$20,$73,$68,$6F,$75,$6C,$64,$20,$62,$65,$20,$31,$30,$2E,$0A
+	.byte	$00
+S0007:
+	.byte	$75,$31,$20,$73,$69,$7A,$65,$20,$69,$73,$20,$25,$75,$3B,$20,$69
+	.byte	$74,$20,$73,$68,$6F,$75,$6C,$64,$20,$62,$65,$20,$37,$2E,$0A,$00
+S0008:
+	.byte	$75,$32,$20,$73,$69,$7A,$65,$20,$69,$73,$20,$25,$75,$3B,$20,$69
+	.byte	$74,$20,$73,$68,$6F,$75,$6C,$64,$20,$62,$65,$20,$34,$2E,$0A,$00
+S0006:
+	.byte	$73,$32,$20,$73,$69,$7A,$65,$20,$69,$73,$20,$25,$75,$3B,$20,$69
+	.byte	$74,$20,$73,$68,$6F,$75,$6C,$64,$20,$62,$65,$20,$37,$2E,$0A,$00
+
+.segment	"BSS"
+
+_s1:
+	.res	10,$00
+_s2:
+	.res	7,$00
+_u1:
+	.res	7,$00
+_u2:
+	.res	4,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "anon-struct1.c", 74
+	ldx     #$00
+	lda     #$0A
+	jsr     pushax
+	lda     _ten
+	ldx     _ten+1
+	jsr     tosneax
+	jeq     L0002
+	.dbg	line, "anon-struct1.c", 75
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$0A
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "anon-struct1.c", 76
+	ldx     #$00
+	inc     _fails
+	lda     _fails
+	.dbg	line, "anon-struct1.c", 78
+L0002:	ldx     #$00
+	lda     #$07
+	jsr     pushax
+	lda     _seven
+	ldx     _seven+1
+	jsr     tosneax
+	jeq     L0003
+	.dbg	line, "anon-struct1.c", 79
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldx     #$00
+	lda     #$07
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "anon-struct1.c", 80
+	ldx     #$00
+	inc     _fails
+	lda     _fails
+	.dbg	line, "anon-struct1.c", 82
+L0003:	ldx     #$00
+	lda     #$07
+	jsr     pushax
+	lda     _seven
+	ldx     _seven+1
+	jsr     tosneax
+	jeq     L0004
+	.dbg	line, "anon-struct1.c", 83
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldx     #$00
+	lda     #$07
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "anon-struct1.c", 84
+	ldx     #$00
+	inc     _fails
+	lda     _fails
+	.dbg	line, "anon-struct1.c", 86
+L0004:	ldx     #$00
+	lda     #$04
+	jsr     pushax
+	lda     _four
+	ldx     _four+1
+	jsr     tosneax
+	jeq     L0005
+	.dbg	line, "anon-struct1.c", 87
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldx     #$00
+	lda     #$04
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "anon-struct1.c", 88
+	ldx     #$00
+	inc     _fails
+	lda     _fails
+	.dbg	line, "anon-struct1.c", 93
+L0005:	ldx     #$00
+	lda     #$0A
+	jsr     pushax
+	lda     _ten
+	ldx     _ten+1
+	jsr     tosneax
+	jeq     L0006
+	.dbg	line, "anon-struct1.c", 94
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldx     #$00
+	lda     #$0A
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "anon-struct1.c", 95
+	ldx     #$00
+	inc     _fails
+	lda     _fails
+	.dbg	line, "anon-struct1.c", 97
+L0006:	ldx     #$00
+	lda     #$07
+	jsr     pushax
+	lda     _seven
+	ldx     _seven+1
+	jsr     tosneax
+	jeq     L0007
+	.dbg	line, "anon-struct1.c", 98
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldx     #$00
+	lda     #$07
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "anon-struct1.c", 99
+	ldx     #$00
+	inc     _fails
+	lda     _fails
+	.dbg	line, "anon-struct1.c", 101
+L0007:	ldx     #$00
+	lda     #$07
+	jsr     pushax
+	lda     _seven
+	ldx     _seven+1
+	jsr     tosneax
+	jeq     L0008
+	.dbg	line, "anon-struct1.c", 102
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldx     #$00
+	lda     #$07
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "anon-struct1.c", 103
+	ldx     #$00
+	inc     _fails
+	lda     _fails
+	.dbg	line, "anon-struct1.c", 105
+L0008:	ldx     #$00
+	lda     #$04
+	jsr     pushax
+	lda     _four
+	ldx     _four+1
+	jsr     tosneax
+	jeq     L0009
+	.dbg	line, "anon-struct1.c", 106
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldx     #$00
+	lda     #$04
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "anon-struct1.c", 107
+	ldx     #$00
+	inc     _fails
+	lda     _fails
+	.dbg	line, "anon-struct1.c", 110
+L0009:	ldx     #$00
+	lda     _fails
+	jmp     L0001
+	.dbg	line, "anon-struct1.c", 111
+L0001:	rts
+
+	.dbg	line
+.endproc
+
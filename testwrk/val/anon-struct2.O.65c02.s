@@ -0,0 +1,294 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_fails:
+	.byte	$00
+
+.segment	"RODATA"
+
+_zero:
+	.word	$0000
+_one:
+	.word	$0001
+_three:
+	.word	$0003
+_five:
+	.word	$0005
+_six:
+	.word	$0006
+_seven:
+	.word	$0007
+_nine:
+	.word	$0009
+S0002:
+	.byte	$54,$68,$65,$20,$6F,$66,$66,$73,$65,$74,$20,$6F,$66,$20,$73,$32
+	.byte	$2E,$6C,$31,$20,$69,$73,$20,$25,$75,$3B,$20,$69,$74,$20,$73,$68
+	.byte	$6F,$75,$6C,$64,$20,$62,$65,$20,$31,$2E,$0A,$00
+S0003:
+	.byte	$54,$68,$65,$20,$6F,$66,$66,$73,$65,$74,$20,$6F,$66,$20,$75,$31
+	.byte	$2E,$63,$31,$20,$69,$73,$20,$25,$75,$3B,$20,$69,$74,$20,$73,$68
+	.byte	$6F,$75,$6C,$64,$20,$62,$65,$20,$36,$2E,$0A,$00
+S0004:
+	.byte	$54,$68,$65,$20,$6F,$66,$66,$73,$65,$74,$20,$6F,$66,$20,$75,$32
+	.byte	$2E,$69,$31,$20,$69,$73,$20,$25,$75,$3B,$20,$69,$74,$20,$73,$68
+	.byte	$6F,$75,$6C,$64,$20,$62,$65,$20,$30,$2E,$0A,$00
+S0005:
+	.byte	$54,$68,$65,$20,$6F,$66,$66,$73,$65,$74,$20,$6F,$66,$20,$73,$31
+	.byte	$2E,$63,$32,$20,$69,$73,$20,$25,$75,$3B,$20,$69,$74,$20,$73,$68
+	.byte	$6F,$75,$6C,$64,$20,$62,$65,$20,$39,$2E,$0A,$00
+S0006:
+	.byte	$54,$68,$65,$20,$6F,$66,$66,$73,$65,$74,$20,$6F,$66,$20,$73,$32
+	.byte	$2E,$73,$31,$20,$69,$73,$20,$25,$75,$3B,$20,$69,$74,$20,$73,$68
+	.byte	$6F,$75,$6C,$64,$20,$62,$65,$20,$35,$2E,$0A,$00
+S0007:
+	.byte	$54,$68,$65,$20,$6F,$66,$66,$73,$65,$74,$20,$6F,$66,$20,$75,$31
+	.byte	$2E,$63,$32,$20,$69,$73,$20,$25,$75,$3B,$20,$69,$74,$20,$73,$68
+	.byte	$6F,$75,$6C,$64,$20,$62,$65,$20,$30,$2E,$0A,$00
+S0008:
+	.byte	$54,$68,$65,$20,$6F,$66,$66,$73,$65,$74,$20,$6F,$66,$20,$75,$32
+	.byte	$2E,$63,$32,$20,$69,$73,$20,$25,$75,$3B,$20,$69,$74,$20,$73,$68
+	.byte	$6F,$75,$6C,$64,$20,$62,$65,$20,$30,$2E,$0A,$00
+S0009:
+	.byte	$54,$68,$65,$20,$6F,$66,$66,$73,$65,$74,$20,$6F,$66,$20,$73,$33
+	.byte	$2E,$73,$32,$20,$69,$73,$20,$25,$75,$3B,$20,$69,$74,$20,$73,$68
+	.byte	$6F,$75,$6C,$64,$20,$62,$65,$20,$37,$2E,$0A,$00
+S0001:
+	.byte	$54,$68,$65,$20,$6F,$66,$66,$73,$65,$74,$20,$6F,$66,$20,$73,$31
+	.byte	$2E,$69,$31,$20,$69,$73,$20,$25,$75,$3B,$20,$69,$74,$20,$73,$68
+	.byte	$6F,$75,$6C,$64,$20,$62,$65,$20,$33,$2E,$0A,$00
+
+.segment	"BSS"
+
+_s1:
+	.res	10,$00
+_s2:
+	.res	7,$00
+_u1:
+	.res	7,$00
+_u2:
+	.res	4,$00
+_l2:
+	.res	4,$00
+_i2:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     _s1+5+3
+	sta     sreg+1
+	lda     _s1+5+2
+	sta     sreg
+	ldx     _s1+5+1
+	lda     _s1+5
+	sta     _l2
+	stx     _l2+1
+	ldy     sreg
+	sty     _l2+2
+	ldy     sreg+1
+	sty     _l2+3
+	lda     _s2+1+3
+	sta     sreg+1
+	lda     _s2+1+2
+	sta     sreg
+	ldx     _s2+1+1
+	lda     _s2+1
+	sta     _l2
+	stx     _l2+1
+	ldy     sreg
+	sty     _l2+2
+	ldy     sreg+1
+	sty     _l2+3
+	lda     _u1+2+3
+	sta     sreg+1
+	lda     _u1+2+2
+	sta     sreg
+	ldx     _u1+2+1
+	lda     _u1+2
+	sta     _l2
+	stx     _l2+1
+	ldy     sreg
+	sty     _l2+2
+	ldy     sreg+1
+	sty     _l2+3
+	lda     _u2+3
+	sta     sreg+1
+	lda     _u2+2
+	sta     sreg
+	ldx     _u2+1
+	lda     _u2
+	sta     _l2
+	stx     _l2+1
+	ldy     sreg
+	sty     _l2+2
+	ldy     sreg+1
+	sty     _l2+3
+	ldx     #$00
+	lda     _s1+2
+	sta     _i2
+	stz     _i2+1
+	lda     _s1+9
+	sta     _i2
+	stz     _i2+1
+	lda     _s2+1
+	sta     _i2
+	stz     _i2+1
+	lda     _s2
+	sta     _i2
+	stz     _i2+1
+	lda     _u1+6
+	sta     _i2
+	stz     _i2+1
+	lda     _u1
+	sta     _i2
+	stz     _i2+1
+	lda     _u2
+	sta     _i2
+	stz     _i2+1
+	lda     _u2
+	sta     _i2
+	stz     _i2+1
+	lda     _three+1
+	bne     L0015
+	lda     _three
+	cmp     #$03
+	beq     L0002
+L0015:	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     #$03
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	inc     _fails
+L0002:	lda     _one+1
+	bne     L0016
+	lda     _one
+	cmp     #$01
+	beq     L0003
+L0016:	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	inc     _fails
+L0003:	lda     _six+1
+	bne     L0017
+	lda     _six
+	cmp     #$06
+	beq     L0004
+L0017:	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     #$06
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	inc     _fails
+L0004:	lda     _zero
+	ora     _zero+1
+	beq     L0005
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	jsr     push0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	inc     _fails
+L0005:	lda     _nine+1
+	bne     L0018
+	lda     _nine
+	cmp     #$09
+	beq     L0006
+L0018:	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     #$09
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	inc     _fails
+L0006:	lda     _five+1
+	bne     L0019
+	lda     _five
+	cmp     #$05
+	beq     L0007
+L0019:	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	inc     _fails
+L0007:	lda     _zero
+	ora     _zero+1
+	beq     L0008
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	jsr     push0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	inc     _fails
+L0008:	lda     _zero
+	ora     _zero+1
+	beq     L0009
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	jsr     push0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	inc     _fails
+L0009:	lda     _seven+1
+	bne     L001A
+	lda     _seven
+	cmp     #$07
+	beq     L0014
+L001A:	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	lda     #$07
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	inc     _fails
+	ldx     #$00
+L0014:	lda     _fails
+	rts
+
+.endproc
+
@@ -0,0 +1,397 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "anon-struct2.c", 3256, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_fails:
+	.byte	$00
+
+.segment	"RODATA"
+
+_zero:
+	.word	$0000
+_one:
+	.word	$0001
+_three:
+	.word	$0003
+_five:
+	.word	$0005
+_six:
+	.word	$0006
+_seven:
+	.word	$0007
+_nine:
+	.word	$0009
+S0002:
+	.byte	$54,$68,$65,$20,$6F,$66,$66,$73,$65,$74,$20,$6F,$66,$20,$73,$32
+	.byte	$2E,$6C,$31,$20,$69,$73,$20,$25,$75,$3B,$20,$69,$74,$20,$73,$68
+	.byte	$6F,$75,$6C,$64,$20,$62,$65,$20,$31,$2E,$0A,$00
+S0003:
+	.byte	$54,$68,$65,$20,$6F,$66,$66,$73,$65,$74,$20,$6F,$66,$20,$75,$31
+	.byte	$2E,$63,$31,$20,$69,$73,$20,$25,$75,$3B,$20,$69,$74,$20,$73,$68
+	.byte	$6F,$75,$6C,$64,$20,$62,$65,$20,$36,$2E,$0A,$00
+S0004:
+	.byte	$54,$68,$65,$20,$6F,$66,$66,$73,$65,$74,$20,$6F,$66,$20,$75,$32
+	.byte	$2E,$69,$31,$20,$69,$73,$20,$25,$75,$3B,$20,$69,$74,$20,$73,$68
+	.byte	$6F,$75,$6C,$64,$20,$62,$65,$20,$30,$2E,$0A,$00
+S0005:
+	.byte	$54,$68,$65,$20,$6F,$66,$66,$73,$65,$74,$20,$6F,$66,$20,$73,$31
+	.byte	$2E,$63,$32,$20,$69,$73,$20,$25,$75,$3B,$20,$69,$74,$20,$73,$68
+	.byte	$6F,$75,$6C,$64,$20,$62,$65,$20,$39,$2E,$0A,$00
+S0006:
+	.byte	$54,$68,$65,$20,$6F,$66,$66,$73,$65,$74,$20,$6F,$66,$20,$73,$32
+	.byte	$2E,$73,$31,$20,$69,$73,$20,$25,$75,$3B,$20,$69,$74,$20,$73,$68
+	.byte	$6F,$75,$6C,$64,$20,$62,$65,$20,$35,$2E,$0A,$00
+S0007:
+	.byte	$54,$68,$65,$20,$6F,$66,$66,$73,$65,$74,$20,$6F,$66,$20,$75,$31
+	.byte	$2E,$63,$32,$20,$69,$73,$20,$25,$75,$3B,$20,$69,$74,$20,$73,$68
+	.byte	$6F,$75,$6C,$64,$20,$62,$65,$20,$30,$2E,$0A,$00
+S0008:
+	.byte	$54,$68,$65,$20,$6F,$66,$66,$73,$65,$74,$20,$6F,$66,$20,$75,$32
+	.byte	$2E,$63,$32,$20,$69,$73,$20,$25,$75,$3B,$20,$69,$74,$20,$73,$68
+	.byte	$6F,$75,$6C,$64,$20,$62,$65,$20,$30,$2E,$0A,$00
+S0009:
+	.byte	$54,$68,$65,$20,$6F,$66,$66,$73,$65,$74,$20,$6F,$66,$20,$73,$33
+	.byte	$2E,$73,$32,$20,$69,$73,$20,$25,$75,$3B,$20,$69,$74,$20,$73,$68
+	.byte	$6F,$75,$6C,$64,$20,$62,$65,$20,$37,$2E,$0A,$00
+S0001:
+	.byte	$54,$68,$65,$20,$6F,$66,$66,$73,$65,$74,$20,$6F,$66,$20,$73,$31
+	.byte	$2E,$69,$31,$20,$69,$73,$20,$25,$75,$3B,$20,$69,$74,$20,$73,$68
+	.byte	$6F,$75,$6C,$64,$20,$62,$65,$20,$33,$2E,$0A,$00
+
+.segment	"BSS"
+
+_s1:
+	.res	10,$00
+_s2:
+	.res	7,$00
+_u1:
+	.res	7,$00
+_u2:
+	.res	4,$00
+_l2:
+	.res	4,$00
+_i2:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "anon-struct2.c", 91
+	lda     _s1+5+3
+	sta     sreg+1
+	lda     _s1+5+2
+	sta     sreg
+	ldx     _s1+5+1
+	lda     _s1+5
+	sta     _l2
+	stx     _l2+1
+	ldy     sreg
+	sty     _l2+2
+	ldy     sreg+1
+	sty     _l2+3
+	.dbg	line, "anon-struct2.c", 92
+	lda     _s2+1+3
+	sta     sreg+1
+	lda     _s2+1+2
+	sta     sreg
+	ldx     _s2+1+1
+	lda     _s2+1
+	sta     _l2
+	stx     _l2+1
+	ldy     sreg
+	sty     _l2+2
+	ldy     sreg+1
+	sty     _l2+3
+	.dbg	line, "anon-struct2.c", 93
+	lda     _u1+2+3
+	sta     sreg+1
+	lda     _u1+2+2
+	sta     sreg
+	ldx     _u1+2+1
+	lda     _u1+2
+	sta     _l2
+	stx     _l2+1
+	ldy     sreg
+	sty     _l2+2
+	ldy     sreg+1
+	sty     _l2+3
+	.dbg	line, "anon-struct2.c", 94
+	lda     _u2+3
+	sta     sreg+1
+	lda     _u2+2
+	sta     sreg
+	ldx     _u2+1
+	lda     _u2
+	sta     _l2
+	stx     _l2+1
+	ldy     sreg
+	sty     _l2+2
+	ldy     sreg+1
+	sty     _l2+3
+	.dbg	line, "anon-struct2.c", 96
+	ldx     #$00
+	lda     _s1+2
+	sta     _i2
+	stx     _i2+1
+	.dbg	line, "anon-struct2.c", 97
+	ldx     #$00
+	lda     _s1+9
+	sta     _i2
+	stx     _i2+1
+	.dbg	line, "anon-struct2.c", 98
+	ldx     #$00
+	lda     _s2+1
+	sta     _i2
+	stx     _i2+1
+	.dbg	line, "anon-struct2.c", 99
+	ldx     #$00
+	lda     _s2
+	sta     _i2
+	stx     _i2+1
+	.dbg	line, "anon-struct2.c", 100
+	ldx     #$00
+	lda     _u1+6
+	sta     _i2
+	stx     _i2+1
+	.dbg	line, "anon-struct2.c", 101
+	ldx     #$00
+	lda     _u1
+	sta     _i2
+	stx     _i2+1
+	.dbg	line, "anon-struct2.c", 102
+	ldx     #$00
+	lda     _u2
+	sta     _i2
+	stx     _i2+1
+	.dbg	line, "anon-struct2.c", 103
+	ldx     #$00
+	lda     _u2
+	sta     _i2
+	stx     _i2+1
+	.dbg	line, "anon-struct2.c", 109
+	ldx     #$00
+	lda     #$03
+	jsr     pushax
+	lda     _three
+	ldx     _three+1
+	jsr     tosneax
+	jeq     L0002
+	.dbg	line, "anon-struct2.c", 110
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$03
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "anon-struct2.c", 111
+	ldx     #$00
+	inc     _fails
+	lda     _fails
+	.dbg	line, "anon-struct2.c", 113
+L0002:	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	lda     _one
+	ldx     _one+1
+	jsr     tosneax
+	jeq     L0003
+	.dbg	line, "anon-struct2.c", 114
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "anon-struct2.c", 115
+	ldx     #$00
+	inc     _fails
+	lda     _fails
+	.dbg	line, "anon-struct2.c", 117
+L0003:	ldx     #$00
+	lda     #$06
+	jsr     pushax
+	lda     _six
+	ldx     _six+1
+	jsr     tosneax
+	jeq     L0004
+	.dbg	line, "anon-struct2.c", 118
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldx     #$00
+	lda     #$06
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "anon-struct2.c", 119
+	ldx     #$00
+	inc     _fails
+	lda     _fails
+	.dbg	line, "anon-struct2.c", 121
+L0004:	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	lda     _zero
+	ldx     _zero+1
+	jsr     tosneax
+	jeq     L0005
+	.dbg	line, "anon-struct2.c", 122
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "anon-struct2.c", 123
+	ldx     #$00
+	inc     _fails
+	lda     _fails
+	.dbg	line, "anon-struct2.c", 130
+L0005:	ldx     #$00
+	lda     #$09
+	jsr     pushax
+	lda     _nine
+	ldx     _nine+1
+	jsr     tosneax
+	jeq     L0006
+	.dbg	line, "anon-struct2.c", 131
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldx     #$00
+	lda     #$09
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "anon-struct2.c", 132
+	ldx     #$00
+	inc     _fails
+	lda     _fails
+	.dbg	line, "anon-struct2.c", 134
+L0006:	ldx     #$00
+	lda     #$05
+	jsr     pushax
+	lda     _five
+	ldx     _five+1
+	jsr     tosneax
+	jeq     L0007
+	.dbg	line, "anon-struct2.c", 135
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldx     #$00
+	lda     #$05
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "anon-struct2.c", 136
+	ldx     #$00
+	inc     _fails
+	lda     _fails
+	.dbg	line, "anon-struct2.c", 138
+L0007:	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	lda     _zero
+	ldx     _zero+1
+	jsr     tosneax
+	jeq     L0008
+	.dbg	line, "anon-struct2.c", 139
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "anon-struct2.c", 140
+	ldx     #$00
+	inc     _fails
+	lda     _fails
+	.dbg	line, "anon-struct2.c", 142
+L0008:	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	lda     _zero
+	ldx     _zero+1
+	jsr     tosneax
+	jeq     L0009
+	.dbg	line, "anon-struct2.c", 143
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "anon-struct2.c", 144
+	ldx     #$00
+	inc     _fails
+	lda     _fails
+	.dbg	line, "anon-struct2.c", 146
+L0009:	ldx     #$00
+	lda     #$07
+	jsr     pushax
+	lda     _seven
+	ldx     _seven+1
+	jsr     tosneax
+	jeq     L000A
+	.dbg	line, "anon-struct2.c", 147
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldx     #$00
+	lda     #$07
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "anon-struct2.c", 148
+	ldx     #$00
+	inc     _fails
+	lda     _fails
+	.dbg	line, "anon-struct2.c", 151
+L000A:	ldx     #$00
+	lda     _fails
+	jmp     L0001
+	.dbg	line, "anon-struct2.c", 152
+L0001:	rts
+
+	.dbg	line
+.endproc
+
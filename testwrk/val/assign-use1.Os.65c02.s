@@ -0,0 +1,92 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+
+.segment	"RODATA"
+
+_buffer:
+	.word	$ABCD
+S0002:
+	.byte	$61,$73,$73,$69,$67,$6E,$2D,$75,$73,$65,$31,$3A,$20,$72,$69,$67
+	.byte	$68,$74,$20,$73,$68,$69,$66,$74,$20,$69,$73,$20,$24,$25,$58,$2C
+	.byte	$20,$6E,$6F,$74,$20,$24,$30,$30,$41,$42,$2E,$0A,$00
+S0001:
+	.byte	$61,$73,$73,$69,$67,$6E,$2D,$75,$73,$65,$31,$3A,$20,$6C,$65,$66
+	.byte	$74,$20,$73,$68,$69,$66,$74,$20,$69,$73,$20,$24,$25,$58,$2C,$20
+	.byte	$6E,$6F,$74,$20,$24,$43,$44,$30,$30,$2E,$0A,$00
+
+.segment	"BSS"
+
+_result:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     _buffer+1
+	sta     _result+1
+	lda     _buffer
+	sta     _result
+	tax
+	stz     _result
+	stx     _result+1
+	cpx     #$CD
+	beq     L0002
+	inc     _failures
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _result
+	ldx     _result+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0002:	lda     _buffer
+	ldx     _buffer+1
+	sta     _result
+	stx     _result+1
+	txa
+	ldx     #$00
+	sta     _result
+	stz     _result+1
+	cmp     #$AB
+	beq     L0006
+	inc     _failures
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     _result
+	ldx     _result+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L0006:	lda     _failures
+	rts
+
+.endproc
+
@@ -0,0 +1,242 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "atoi-test.c", 912, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/stdlib.h", 5999, 1613073744
+	.dbg		file, "/root/repo/include/string.h", 5104, 1613073744
+	.dbg		file, "/root/repo/include/limits.h", 3146, 1613073744
+	.dbg		file, "/root/repo/include/errno.h", 5083, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "stderr", "00", extern, "_stderr"
+	.dbg		sym, "fprintf", "00", extern, "_fprintf"
+	.dbg		sym, "atoi", "00", extern, "_atoi"
+	.import		_stderr
+	.import		_fprintf
+	.import		_atoi
+	.export		_main
+
+.segment	"DATA"
+
+_Failures:
+	.word	$0000
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$61,$74,$6F,$69,$20,$65,$72,$72,$6F,$72,$20,$69,$6E,$20,$22,$25
+	.byte	$73,$22,$3A,$0A,$20,$20,$72,$65,$73,$75,$6C,$74,$20,$3D,$20,$25
+	.byte	$64,$2C,$20,$73,$68,$6F,$75,$6C,$64,$20,$62,$65,$20,$25,$64,$0A
+	.byte	$00
+S000D:
+	.byte	$46,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+S000B:
+	.byte	$20,$2B,$30,$78,$37,$46,$46,$46,$00
+S0003:
+	.byte	$09,$20,$2D,$30,$2E,$31,$32,$33,$00
+S000C:
+	.byte	$20,$2D,$30,$78,$37,$46,$46,$46,$00
+S0009:
+	.byte	$20,$2D,$30,$33,$37,$37,$20,$00
+S0008:
+	.byte	$20,$2B,$30,$33,$37,$37,$20,$00
+S0004:
+	.byte	$20,$20,$2D,$33,$32,$20,$20,$00
+S000A	:=	S000B+2
+S0007:
+	.byte	$20,$30,$33,$37,$37,$20,$00
+S0005:
+	.byte	$20,$2B,$33,$32,$20,$20,$00
+S0002:
+	.byte	$09,$20,$2B,$30,$41,$00
+S0006:
+	.byte	$30,$33,$37,$37,$00
+
+; ---------------------------------------------------------------
+; void __near__ CheckAtoi (const char *Str, int Val)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_CheckAtoi: near
+
+	.dbg	func, "CheckAtoi", "00", static, "_CheckAtoi"
+	.dbg	sym, "Str", "00", auto, 2
+	.dbg	sym, "Val", "00", auto, 0
+	.dbg	sym, "Res", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "atoi-test.c", 19
+	jsr     pushax
+	.dbg	line, "atoi-test.c", 20
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _atoi
+	jsr     pushax
+	.dbg	line, "atoi-test.c", 21
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosneax
+	jeq     L0002
+	.dbg	line, "atoi-test.c", 22
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	.dbg	line, "atoi-test.c", 23
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0A
+	jsr     _fprintf
+	.dbg	line, "atoi-test.c", 24
+	inc     _Failures
+	bne     L0003
+	inc     _Failures+1
+L0003:	lda     _Failures
+	ldx     _Failures+1
+	.dbg	line, "atoi-test.c", 26
+L0002:	jsr     incsp6
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "atoi-test.c", 32
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     _CheckAtoi
+	.dbg	line, "atoi-test.c", 33
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     _CheckAtoi
+	.dbg	line, "atoi-test.c", 34
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldx     #$FF
+	lda     #$E0
+	jsr     _CheckAtoi
+	.dbg	line, "atoi-test.c", 35
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldx     #$00
+	lda     #$20
+	jsr     _CheckAtoi
+	.dbg	line, "atoi-test.c", 36
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldx     #$01
+	lda     #$79
+	jsr     _CheckAtoi
+	.dbg	line, "atoi-test.c", 37
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldx     #$01
+	lda     #$79
+	jsr     _CheckAtoi
+	.dbg	line, "atoi-test.c", 38
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldx     #$01
+	lda     #$79
+	jsr     _CheckAtoi
+	.dbg	line, "atoi-test.c", 39
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldx     #$FE
+	lda     #$87
+	jsr     _CheckAtoi
+	.dbg	line, "atoi-test.c", 40
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     _CheckAtoi
+	.dbg	line, "atoi-test.c", 41
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     _CheckAtoi
+	.dbg	line, "atoi-test.c", 42
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     _CheckAtoi
+	.dbg	line, "atoi-test.c", 43
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	lda     _Failures
+	ldx     _Failures+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _fprintf
+	.dbg	line, "atoi-test.c", 44
+	lda     _Failures
+	ldx     _Failures+1
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+L0002:	jsr     boolne
+	jmp     L0001
+	.dbg	line, "atoi-test.c", 45
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,1401 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.export		_main
+
+.segment	"BSS"
+
+_small:
+	.res	256,$00
+_big:
+	.res	512,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	lda     #$00
+	sta     _small
+	lda     #$01
+	sta     _small+1
+	asl     a
+	sta     _small+2
+	lda     #$03
+	sta     _small+3
+	lda     #$04
+	sta     _small+4
+	lda     #$05
+	sta     _small+5
+	lda     #$06
+	sta     _small+6
+	lda     #$07
+	sta     _small+7
+	lda     #$08
+	sta     _small+8
+	lda     #$09
+	sta     _small+9
+	lda     #$0A
+	sta     _small+10
+	lda     #$0B
+	sta     _small+11
+	lda     #$0C
+	sta     _small+12
+	lda     #$0D
+	sta     _small+13
+	lda     #$0E
+	sta     _small+14
+	lda     #$0F
+	sta     _small+15
+	lda     #$10
+	sta     _small+16
+	lda     #$11
+	sta     _small+17
+	lda     #$12
+	sta     _small+18
+	lda     #$13
+	sta     _small+19
+	lda     #$14
+	sta     _small+20
+	lda     #$15
+	sta     _small+21
+	lda     #$16
+	sta     _small+22
+	lda     #$17
+	sta     _small+23
+	lda     #$18
+	sta     _small+24
+	lda     #$19
+	sta     _small+25
+	lda     #$1A
+	sta     _small+26
+	lda     #$1B
+	sta     _small+27
+	lda     #$1C
+	sta     _small+28
+	lda     #$1D
+	sta     _small+29
+	lda     #$1E
+	sta     _small+30
+	lda     #$1F
+	sta     _small+31
+	lda     #$20
+	sta     _small+32
+	lda     #$21
+	sta     _small+33
+	lda     #$22
+	sta     _small+34
+	lda     #$23
+	sta     _small+35
+	lda     #$24
+	sta     _small+36
+	lda     #$25
+	sta     _small+37
+	lda     #$26
+	sta     _small+38
+	lda     #$27
+	sta     _small+39
+	lda     #$28
+	sta     _small+40
+	lda     #$29
+	sta     _small+41
+	lda     #$2A
+	sta     _small+42
+	lda     #$2B
+	sta     _small+43
+	lda     #$2C
+	sta     _small+44
+	lda     #$2D
+	sta     _small+45
+	lda     #$2E
+	sta     _small+46
+	lda     #$2F
+	sta     _small+47
+	lda     #$30
+	sta     _small+48
+	lda     #$31
+	sta     _small+49
+	lda     #$32
+	sta     _small+50
+	lda     #$33
+	sta     _small+51
+	lda     #$34
+	sta     _small+52
+	lda     #$35
+	sta     _small+53
+	lda     #$36
+	sta     _small+54
+	lda     #$37
+	sta     _small+55
+	lda     #$38
+	sta     _small+56
+	lda     #$39
+	sta     _small+57
+	lda     #$3A
+	sta     _small+58
+	lda     #$3B
+	sta     _small+59
+	lda     #$3C
+	sta     _small+60
+	lda     #$3D
+	sta     _small+61
+	lda     #$3E
+	sta     _small+62
+	lda     #$3F
+	sta     _small+63
+	lda     #$40
+	sta     _small+64
+	lda     #$41
+	sta     _small+65
+	lda     #$42
+	sta     _small+66
+	lda     #$43
+	sta     _small+67
+	lda     #$44
+	sta     _small+68
+	lda     #$45
+	sta     _small+69
+	lda     #$46
+	sta     _small+70
+	lda     #$47
+	sta     _small+71
+	lda     #$48
+	sta     _small+72
+	lda     #$49
+	sta     _small+73
+	lda     #$4A
+	sta     _small+74
+	lda     #$4B
+	sta     _small+75
+	lda     #$4C
+	sta     _small+76
+	lda     #$4D
+	sta     _small+77
+	lda     #$4E
+	sta     _small+78
+	lda     #$4F
+	sta     _small+79
+	lda     #$50
+	sta     _small+80
+	lda     #$51
+	sta     _small+81
+	lda     #$52
+	sta     _small+82
+	lda     #$53
+	sta     _small+83
+	lda     #$54
+	sta     _small+84
+	lda     #$55
+	sta     _small+85
+	lda     #$56
+	sta     _small+86
+	lda     #$57
+	sta     _small+87
+	lda     #$58
+	sta     _small+88
+	lda     #$59
+	sta     _small+89
+	lda     #$5A
+	sta     _small+90
+	lda     #$5B
+	sta     _small+91
+	lda     #$5C
+	sta     _small+92
+	lda     #$5D
+	sta     _small+93
+	lda     #$5E
+	sta     _small+94
+	lda     #$5F
+	sta     _small+95
+	lda     #$60
+	sta     _small+96
+	lda     #$61
+	sta     _small+97
+	lda     #$62
+	sta     _small+98
+	lda     #$63
+	sta     _small+99
+	lda     #$64
+	sta     _small+100
+	lda     #$65
+	sta     _small+101
+	lda     #$66
+	sta     _small+102
+	lda     #$67
+	sta     _small+103
+	lda     #$68
+	sta     _small+104
+	lda     #$69
+	sta     _small+105
+	lda     #$6A
+	sta     _small+106
+	lda     #$6B
+	sta     _small+107
+	lda     #$6C
+	sta     _small+108
+	lda     #$6D
+	sta     _small+109
+	lda     #$6E
+	sta     _small+110
+	lda     #$6F
+	sta     _small+111
+	lda     #$70
+	sta     _small+112
+	lda     #$71
+	sta     _small+113
+	lda     #$72
+	sta     _small+114
+	lda     #$73
+	sta     _small+115
+	lda     #$74
+	sta     _small+116
+	lda     #$75
+	sta     _small+117
+	lda     #$76
+	sta     _small+118
+	lda     #$77
+	sta     _small+119
+	lda     #$78
+	sta     _small+120
+	lda     #$79
+	sta     _small+121
+	lda     #$7A
+	sta     _small+122
+	lda     #$7B
+	sta     _small+123
+	lda     #$7C
+	sta     _small+124
+	lda     #$7D
+	sta     _small+125
+	lda     #$7E
+	sta     _small+126
+	lda     #$7F
+	sta     _small+127
+	lda     #$80
+	sta     _small+128
+	lda     #$81
+	sta     _small+129
+	lda     #$82
+	sta     _small+130
+	lda     #$83
+	sta     _small+131
+	lda     #$84
+	sta     _small+132
+	lda     #$85
+	sta     _small+133
+	lda     #$86
+	sta     _small+134
+	lda     #$87
+	sta     _small+135
+	lda     #$88
+	sta     _small+136
+	lda     #$89
+	sta     _small+137
+	lda     #$8A
+	sta     _small+138
+	lda     #$8B
+	sta     _small+139
+	lda     #$8C
+	sta     _small+140
+	lda     #$8D
+	sta     _small+141
+	lda     #$8E
+	sta     _small+142
+	lda     #$8F
+	sta     _small+143
+	lda     #$90
+	sta     _small+144
+	lda     #$91
+	sta     _small+145
+	lda     #$92
+	sta     _small+146
+	lda     #$93
+	sta     _small+147
+	lda     #$94
+	sta     _small+148
+	lda     #$95
+	sta     _small+149
+	lda     #$96
+	sta     _small+150
+	lda     #$97
+	sta     _small+151
+	lda     #$98
+	sta     _small+152
+	lda     #$99
+	sta     _small+153
+	lda     #$9A
+	sta     _small+154
+	lda     #$9B
+	sta     _small+155
+	lda     #$9C
+	sta     _small+156
+	lda     #$9D
+	sta     _small+157
+	lda     #$9E
+	sta     _small+158
+	lda     #$9F
+	sta     _small+159
+	lda     #$A0
+	sta     _small+160
+	lda     #$A1
+	sta     _small+161
+	lda     #$A2
+	sta     _small+162
+	lda     #$A3
+	sta     _small+163
+	lda     #$A4
+	sta     _small+164
+	lda     #$A5
+	sta     _small+165
+	lda     #$A6
+	sta     _small+166
+	lda     #$A7
+	sta     _small+167
+	lda     #$A8
+	sta     _small+168
+	lda     #$A9
+	sta     _small+169
+	lda     #$AA
+	sta     _small+170
+	lda     #$AB
+	sta     _small+171
+	lda     #$AC
+	sta     _small+172
+	lda     #$AD
+	sta     _small+173
+	lda     #$AE
+	sta     _small+174
+	lda     #$AF
+	sta     _small+175
+	lda     #$B0
+	sta     _small+176
+	lda     #$B1
+	sta     _small+177
+	lda     #$B2
+	sta     _small+178
+	lda     #$B3
+	sta     _small+179
+	lda     #$B4
+	sta     _small+180
+	lda     #$B5
+	sta     _small+181
+	lda     #$B6
+	sta     _small+182
+	lda     #$B7
+	sta     _small+183
+	lda     #$B8
+	sta     _small+184
+	lda     #$B9
+	sta     _small+185
+	lda     #$BA
+	sta     _small+186
+	lda     #$BB
+	sta     _small+187
+	lda     #$BC
+	sta     _small+188
+	lda     #$BD
+	sta     _small+189
+	lda     #$BE
+	sta     _small+190
+	lda     #$BF
+	sta     _small+191
+	lda     #$C0
+	sta     _small+192
+	lda     #$C1
+	sta     _small+193
+	lda     #$C2
+	sta     _small+194
+	lda     #$C3
+	sta     _small+195
+	lda     #$C4
+	sta     _small+196
+	lda     #$C5
+	sta     _small+197
+	lda     #$C6
+	sta     _small+198
+	lda     #$C7
+	sta     _small+199
+	lda     #$C8
+	sta     _small+200
+	lda     #$C9
+	sta     _small+201
+	lda     #$CA
+	sta     _small+202
+	lda     #$CB
+	sta     _small+203
+	lda     #$CC
+	sta     _small+204
+	lda     #$CD
+	sta     _small+205
+	lda     #$CE
+	sta     _small+206
+	lda     #$CF
+	sta     _small+207
+	lda     #$D0
+	sta     _small+208
+	lda     #$D1
+	sta     _small+209
+	lda     #$D2
+	sta     _small+210
+	lda     #$D3
+	sta     _small+211
+	lda     #$D4
+	sta     _small+212
+	lda     #$D5
+	sta     _small+213
+	lda     #$D6
+	sta     _small+214
+	lda     #$D7
+	sta     _small+215
+	lda     #$D8
+	sta     _small+216
+	lda     #$D9
+	sta     _small+217
+	lda     #$DA
+	sta     _small+218
+	lda     #$DB
+	sta     _small+219
+	lda     #$DC
+	sta     _small+220
+	lda     #$DD
+	sta     _small+221
+	lda     #$DE
+	sta     _small+222
+	lda     #$DF
+	sta     _small+223
+	lda     #$E0
+	sta     _small+224
+	lda     #$E1
+	sta     _small+225
+	lda     #$E2
+	sta     _small+226
+	lda     #$E3
+	sta     _small+227
+	lda     #$E4
+	sta     _small+228
+	lda     #$E5
+	sta     _small+229
+	lda     #$E6
+	sta     _small+230
+	lda     #$E7
+	sta     _small+231
+	lda     #$E8
+	sta     _small+232
+	lda     #$E9
+	sta     _small+233
+	lda     #$EA
+	sta     _small+234
+	lda     #$EB
+	sta     _small+235
+	lda     #$EC
+	sta     _small+236
+	lda     #$ED
+	sta     _small+237
+	lda     #$EE
+	sta     _small+238
+	lda     #$EF
+	sta     _small+239
+	lda     #$F0
+	sta     _small+240
+	lda     #$F1
+	sta     _small+241
+	lda     #$F2
+	sta     _small+242
+	lda     #$F3
+	sta     _small+243
+	lda     #$F4
+	sta     _small+244
+	lda     #$F5
+	sta     _small+245
+	lda     #$F6
+	sta     _small+246
+	lda     #$F7
+	sta     _small+247
+	lda     #$F8
+	sta     _small+248
+	lda     #$F9
+	sta     _small+249
+	lda     #$FA
+	sta     _small+250
+	lda     #$FB
+	sta     _small+251
+	lda     #$FC
+	sta     _small+252
+	lda     #$FD
+	sta     _small+253
+	lda     #$FE
+	sta     _small+254
+	lda     #$FF
+	sta     _small+255
+	ldy     #$00
+	tya
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L000D
+L0005:	lda     #<(_small)
+	ldy     #$00
+	clc
+	adc     (sp),y
+	sta     ptr1
+	lda     #>(_small)
+	iny
+	adc     (sp),y
+	sta     ptr1+1
+	dey
+	ldx     #$00
+	lda     (ptr1),y
+	cmp     (sp),y
+	bne     L000F
+	txa
+	iny
+	cmp     (sp),y
+	beq     L0006
+L000F:	lda     #$01
+	jmp     L0001
+L0006:	tya
+	jsr     addeq0sp
+	ldy     #$01
+L000D:	lda     (sp),y
+	tax
+	dey
+	cpx     #$01
+	bcc     L0005
+	ldx     #$FF
+	sty     _big
+	stx     _big+1
+	lda     #$01
+	sta     _big+2
+	stx     _big+2+1
+	lda     #$02
+	sta     _big+4
+	stx     _big+4+1
+	lda     #$03
+	sta     _big+6
+	stx     _big+6+1
+	lda     #$04
+	sta     _big+8
+	stx     _big+8+1
+	lda     #$05
+	sta     _big+10
+	stx     _big+10+1
+	lda     #$06
+	sta     _big+12
+	stx     _big+12+1
+	lda     #$07
+	sta     _big+14
+	stx     _big+14+1
+	lda     #$08
+	sta     _big+16
+	stx     _big+16+1
+	lda     #$09
+	sta     _big+18
+	stx     _big+18+1
+	lda     #$0A
+	sta     _big+20
+	stx     _big+20+1
+	lda     #$0B
+	sta     _big+22
+	stx     _big+22+1
+	lda     #$0C
+	sta     _big+24
+	stx     _big+24+1
+	lda     #$0D
+	sta     _big+26
+	stx     _big+26+1
+	lda     #$0E
+	sta     _big+28
+	stx     _big+28+1
+	lda     #$0F
+	sta     _big+30
+	stx     _big+30+1
+	lda     #$10
+	sta     _big+32
+	stx     _big+32+1
+	lda     #$11
+	sta     _big+34
+	stx     _big+34+1
+	lda     #$12
+	sta     _big+36
+	stx     _big+36+1
+	lda     #$13
+	sta     _big+38
+	stx     _big+38+1
+	lda     #$14
+	sta     _big+40
+	stx     _big+40+1
+	lda     #$15
+	sta     _big+42
+	stx     _big+42+1
+	lda     #$16
+	sta     _big+44
+	stx     _big+44+1
+	lda     #$17
+	sta     _big+46
+	stx     _big+46+1
+	lda     #$18
+	sta     _big+48
+	stx     _big+48+1
+	lda     #$19
+	sta     _big+50
+	stx     _big+50+1
+	lda     #$1A
+	sta     _big+52
+	stx     _big+52+1
+	lda     #$1B
+	sta     _big+54
+	stx     _big+54+1
+	lda     #$1C
+	sta     _big+56
+	stx     _big+56+1
+	lda     #$1D
+	sta     _big+58
+	stx     _big+58+1
+	lda     #$1E
+	sta     _big+60
+	stx     _big+60+1
+	lda     #$1F
+	sta     _big+62
+	stx     _big+62+1
+	lda     #$20
+	sta     _big+64
+	stx     _big+64+1
+	lda     #$21
+	sta     _big+66
+	stx     _big+66+1
+	lda     #$22
+	sta     _big+68
+	stx     _big+68+1
+	lda     #$23
+	sta     _big+70
+	stx     _big+70+1
+	lda     #$24
+	sta     _big+72
+	stx     _big+72+1
+	lda     #$25
+	sta     _big+74
+	stx     _big+74+1
+	lda     #$26
+	sta     _big+76
+	stx     _big+76+1
+	lda     #$27
+	sta     _big+78
+	stx     _big+78+1
+	lda     #$28
+	sta     _big+80
+	stx     _big+80+1
+	lda     #$29
+	sta     _big+82
+	stx     _big+82+1
+	lda     #$2A
+	sta     _big+84
+	stx     _big+84+1
+	lda     #$2B
+	sta     _big+86
+	stx     _big+86+1
+	lda     #$2C
+	sta     _big+88
+	stx     _big+88+1
+	lda     #$2D
+	sta     _big+90
+	stx     _big+90+1
+	lda     #$2E
+	sta     _big+92
+	stx     _big+92+1
+	lda     #$2F
+	sta     _big+94
+	stx     _big+94+1
+	lda     #$30
+	sta     _big+96
+	stx     _big+96+1
+	lda     #$31
+	sta     _big+98
+	stx     _big+98+1
+	lda     #$32
+	sta     _big+100
+	stx     _big+100+1
+	lda     #$33
+	sta     _big+102
+	stx     _big+102+1
+	lda     #$34
+	sta     _big+104
+	stx     _big+104+1
+	lda     #$35
+	sta     _big+106
+	stx     _big+106+1
+	lda     #$36
+	sta     _big+108
+	stx     _big+108+1
+	lda     #$37
+	sta     _big+110
+	stx     _big+110+1
+	lda     #$38
+	sta     _big+112
+	stx     _big+112+1
+	lda     #$39
+	sta     _big+114
+	stx     _big+114+1
+	lda     #$3A
+	sta     _big+116
+	stx     _big+116+1
+	lda     #$3B
+	sta     _big+118
+	stx     _big+118+1
+	lda     #$3C
+	sta     _big+120
+	stx     _big+120+1
+	lda     #$3D
+	sta     _big+122
+	stx     _big+122+1
+	lda     #$3E
+	sta     _big+124
+	stx     _big+124+1
+	lda     #$3F
+	sta     _big+126
+	stx     _big+126+1
+	lda     #$40
+	sta     _big+128
+	stx     _big+128+1
+	lda     #$41
+	sta     _big+130
+	stx     _big+130+1
+	lda     #$42
+	sta     _big+132
+	stx     _big+132+1
+	lda     #$43
+	sta     _big+134
+	stx     _big+134+1
+	lda     #$44
+	sta     _big+136
+	stx     _big+136+1
+	lda     #$45
+	sta     _big+138
+	stx     _big+138+1
+	lda     #$46
+	sta     _big+140
+	stx     _big+140+1
+	lda     #$47
+	sta     _big+142
+	stx     _big+142+1
+	lda     #$48
+	sta     _big+144
+	stx     _big+144+1
+	lda     #$49
+	sta     _big+146
+	stx     _big+146+1
+	lda     #$4A
+	sta     _big+148
+	stx     _big+148+1
+	lda     #$4B
+	sta     _big+150
+	stx     _big+150+1
+	lda     #$4C
+	sta     _big+152
+	stx     _big+152+1
+	lda     #$4D
+	sta     _big+154
+	stx     _big+154+1
+	lda     #$4E
+	sta     _big+156
+	stx     _big+156+1
+	lda     #$4F
+	sta     _big+158
+	stx     _big+158+1
+	lda     #$50
+	sta     _big+160
+	stx     _big+160+1
+	lda     #$51
+	sta     _big+162
+	stx     _big+162+1
+	lda     #$52
+	sta     _big+164
+	stx     _big+164+1
+	lda     #$53
+	sta     _big+166
+	stx     _big+166+1
+	lda     #$54
+	sta     _big+168
+	stx     _big+168+1
+	lda     #$55
+	sta     _big+170
+	stx     _big+170+1
+	lda     #$56
+	sta     _big+172
+	stx     _big+172+1
+	lda     #$57
+	sta     _big+174
+	stx     _big+174+1
+	lda     #$58
+	sta     _big+176
+	stx     _big+176+1
+	lda     #$59
+	sta     _big+178
+	stx     _big+178+1
+	lda     #$5A
+	sta     _big+180
+	stx     _big+180+1
+	lda     #$5B
+	sta     _big+182
+	stx     _big+182+1
+	lda     #$5C
+	sta     _big+184
+	stx     _big+184+1
+	lda     #$5D
+	sta     _big+186
+	stx     _big+186+1
+	lda     #$5E
+	sta     _big+188
+	stx     _big+188+1
+	lda     #$5F
+	sta     _big+190
+	stx     _big+190+1
+	lda     #$60
+	sta     _big+192
+	stx     _big+192+1
+	lda     #$61
+	sta     _big+194
+	stx     _big+194+1
+	lda     #$62
+	sta     _big+196
+	stx     _big+196+1
+	lda     #$63
+	sta     _big+198
+	stx     _big+198+1
+	lda     #$64
+	sta     _big+200
+	stx     _big+200+1
+	lda     #$65
+	sta     _big+202
+	stx     _big+202+1
+	lda     #$66
+	sta     _big+204
+	stx     _big+204+1
+	lda     #$67
+	sta     _big+206
+	stx     _big+206+1
+	lda     #$68
+	sta     _big+208
+	stx     _big+208+1
+	lda     #$69
+	sta     _big+210
+	stx     _big+210+1
+	lda     #$6A
+	sta     _big+212
+	stx     _big+212+1
+	lda     #$6B
+	sta     _big+214
+	stx     _big+214+1
+	lda     #$6C
+	sta     _big+216
+	stx     _big+216+1
+	lda     #$6D
+	sta     _big+218
+	stx     _big+218+1
+	lda     #$6E
+	sta     _big+220
+	stx     _big+220+1
+	lda     #$6F
+	sta     _big+222
+	stx     _big+222+1
+	lda     #$70
+	sta     _big+224
+	stx     _big+224+1
+	lda     #$71
+	sta     _big+226
+	stx     _big+226+1
+	lda     #$72
+	sta     _big+228
+	stx     _big+228+1
+	lda     #$73
+	sta     _big+230
+	stx     _big+230+1
+	lda     #$74
+	sta     _big+232
+	stx     _big+232+1
+	lda     #$75
+	sta     _big+234
+	stx     _big+234+1
+	lda     #$76
+	sta     _big+236
+	stx     _big+236+1
+	lda     #$77
+	sta     _big+238
+	stx     _big+238+1
+	lda     #$78
+	sta     _big+240
+	stx     _big+240+1
+	lda     #$79
+	sta     _big+242
+	stx     _big+242+1
+	lda     #$7A
+	sta     _big+244
+	stx     _big+244+1
+	lda     #$7B
+	sta     _big+246
+	stx     _big+246+1
+	lda     #$7C
+	sta     _big+248
+	stx     _big+248+1
+	lda     #$7D
+	sta     _big+250
+	stx     _big+250+1
+	lda     #$7E
+	sta     _big+252
+	stx     _big+252+1
+	lda     #$7F
+	sta     _big+254
+	stx     _big+254+1
+	lda     #$80
+	sta     _big+256
+	stx     _big+256+1
+	lda     #$81
+	sta     _big+258
+	stx     _big+258+1
+	lda     #$82
+	sta     _big+260
+	stx     _big+260+1
+	lda     #$83
+	sta     _big+262
+	stx     _big+262+1
+	lda     #$84
+	sta     _big+264
+	stx     _big+264+1
+	lda     #$85
+	sta     _big+266
+	stx     _big+266+1
+	lda     #$86
+	sta     _big+268
+	stx     _big+268+1
+	lda     #$87
+	sta     _big+270
+	stx     _big+270+1
+	lda     #$88
+	sta     _big+272
+	stx     _big+272+1
+	lda     #$89
+	sta     _big+274
+	stx     _big+274+1
+	lda     #$8A
+	sta     _big+276
+	stx     _big+276+1
+	lda     #$8B
+	sta     _big+278
+	stx     _big+278+1
+	lda     #$8C
+	sta     _big+280
+	stx     _big+280+1
+	lda     #$8D
+	sta     _big+282
+	stx     _big+282+1
+	lda     #$8E
+	sta     _big+284
+	stx     _big+284+1
+	lda     #$8F
+	sta     _big+286
+	stx     _big+286+1
+	lda     #$90
+	sta     _big+288
+	stx     _big+288+1
+	lda     #$91
+	sta     _big+290
+	stx     _big+290+1
+	lda     #$92
+	sta     _big+292
+	stx     _big+292+1
+	lda     #$93
+	sta     _big+294
+	stx     _big+294+1
+	lda     #$94
+	sta     _big+296
+	stx     _big+296+1
+	lda     #$95
+	sta     _big+298
+	stx     _big+298+1
+	lda     #$96
+	sta     _big+300
+	stx     _big+300+1
+	lda     #$97
+	sta     _big+302
+	stx     _big+302+1
+	lda     #$98
+	sta     _big+304
+	stx     _big+304+1
+	lda     #$99
+	sta     _big+306
+	stx     _big+306+1
+	lda     #$9A
+	sta     _big+308
+	stx     _big+308+1
+	lda     #$9B
+	sta     _big+310
+	stx     _big+310+1
+	lda     #$9C
+	sta     _big+312
+	stx     _big+312+1
+	lda     #$9D
+	sta     _big+314
+	stx     _big+314+1
+	lda     #$9E
+	sta     _big+316
+	stx     _big+316+1
+	lda     #$9F
+	sta     _big+318
+	stx     _big+318+1
+	lda     #$A0
+	sta     _big+320
+	stx     _big+320+1
+	lda     #$A1
+	sta     _big+322
+	stx     _big+322+1
+	lda     #$A2
+	sta     _big+324
+	stx     _big+324+1
+	lda     #$A3
+	sta     _big+326
+	stx     _big+326+1
+	lda     #$A4
+	sta     _big+328
+	stx     _big+328+1
+	lda     #$A5
+	sta     _big+330
+	stx     _big+330+1
+	lda     #$A6
+	sta     _big+332
+	stx     _big+332+1
+	lda     #$A7
+	sta     _big+334
+	stx     _big+334+1
+	lda     #$A8
+	sta     _big+336
+	stx     _big+336+1
+	lda     #$A9
+	sta     _big+338
+	stx     _big+338+1
+	lda     #$AA
+	sta     _big+340
+	stx     _big+340+1
+	lda     #$AB
+	sta     _big+342
+	stx     _big+342+1
+	lda     #$AC
+	sta     _big+344
+	stx     _big+344+1
+	lda     #$AD
+	sta     _big+346
+	stx     _big+346+1
+	lda     #$AE
+	sta     _big+348
+	stx     _big+348+1
+	lda     #$AF
+	sta     _big+350
+	stx     _big+350+1
+	lda     #$B0
+	sta     _big+352
+	stx     _big+352+1
+	lda     #$B1
+	sta     _big+354
+	stx     _big+354+1
+	lda     #$B2
+	sta     _big+356
+	stx     _big+356+1
+	lda     #$B3
+	sta     _big+358
+	stx     _big+358+1
+	lda     #$B4
+	sta     _big+360
+	stx     _big+360+1
+	lda     #$B5
+	sta     _big+362
+	stx     _big+362+1
+	lda     #$B6
+	sta     _big+364
+	stx     _big+364+1
+	lda     #$B7
+	sta     _big+366
+	stx     _big+366+1
+	lda     #$B8
+	sta     _big+368
+	stx     _big+368+1
+	lda     #$B9
+	sta     _big+370
+	stx     _big+370+1
+	lda     #$BA
+	sta     _big+372
+	stx     _big+372+1
+	lda     #$BB
+	sta     _big+374
+	stx     _big+374+1
+	lda     #$BC
+	sta     _big+376
+	stx     _big+376+1
+	lda     #$BD
+	sta     _big+378
+	stx     _big+378+1
+	lda     #$BE
+	sta     _big+380
+	stx     _big+380+1
+	lda     #$BF
+	sta     _big+382
+	stx     _big+382+1
+	lda     #$C0
+	sta     _big+384
+	stx     _big+384+1
+	lda     #$C1
+	sta     _big+386
+	stx     _big+386+1
+	lda     #$C2
+	sta     _big+388
+	stx     _big+388+1
+	lda     #$C3
+	sta     _big+390
+	stx     _big+390+1
+	lda     #$C4
+	sta     _big+392
+	stx     _big+392+1
+	lda     #$C5
+	sta     _big+394
+	stx     _big+394+1
+	lda     #$C6
+	sta     _big+396
+	stx     _big+396+1
+	lda     #$C7
+	sta     _big+398
+	stx     _big+398+1
+	lda     #$C8
+	sta     _big+400
+	stx     _big+400+1
+	lda     #$C9
+	sta     _big+402
+	stx     _big+402+1
+	lda     #$CA
+	sta     _big+404
+	stx     _big+404+1
+	lda     #$CB
+	sta     _big+406
+	stx     _big+406+1
+	lda     #$CC
+	sta     _big+408
+	stx     _big+408+1
+	lda     #$CD
+	sta     _big+410
+	stx     _big+410+1
+	lda     #$CE
+	sta     _big+412
+	stx     _big+412+1
+	lda     #$CF
+	sta     _big+414
+	stx     _big+414+1
+	lda     #$D0
+	sta     _big+416
+	stx     _big+416+1
+	lda     #$D1
+	sta     _big+418
+	stx     _big+418+1
+	lda     #$D2
+	sta     _big+420
+	stx     _big+420+1
+	lda     #$D3
+	sta     _big+422
+	stx     _big+422+1
+	lda     #$D4
+	sta     _big+424
+	stx     _big+424+1
+	lda     #$D5
+	sta     _big+426
+	stx     _big+426+1
+	lda     #$D6
+	sta     _big+428
+	stx     _big+428+1
+	lda     #$D7
+	sta     _big+430
+	stx     _big+430+1
+	lda     #$D8
+	sta     _big+432
+	stx     _big+432+1
+	lda     #$D9
+	sta     _big+434
+	stx     _big+434+1
+	lda     #$DA
+	sta     _big+436
+	stx     _big+436+1
+	lda     #$DB
+	sta     _big+438
+	stx     _big+438+1
+	lda     #$DC
+	sta     _big+440
+	stx     _big+440+1
+	lda     #$DD
+	sta     _big+442
+	stx     _big+442+1
+	lda     #$DE
+	sta     _big+444
+	stx     _big+444+1
+	lda     #$DF
+	sta     _big+446
+	stx     _big+446+1
+	lda     #$E0
+	sta     _big+448
+	stx     _big+448+1
+	lda     #$E1
+	sta     _big+450
+	stx     _big+450+1
+	lda     #$E2
+	sta     _big+452
+	stx     _big+452+1
+	lda     #$E3
+	sta     _big+454
+	stx     _big+454+1
+	lda     #$E4
+	sta     _big+456
+	stx     _big+456+1
+	lda     #$E5
+	sta     _big+458
+	stx     _big+458+1
+	lda     #$E6
+	sta     _big+460
+	stx     _big+460+1
+	lda     #$E7
+	sta     _big+462
+	stx     _big+462+1
+	lda     #$E8
+	sta     _big+464
+	stx     _big+464+1
+	lda     #$E9
+	sta     _big+466
+	stx     _big+466+1
+	lda     #$EA
+	sta     _big+468
+	stx     _big+468+1
+	lda     #$EB
+	sta     _big+470
+	stx     _big+470+1
+	lda     #$EC
+	sta     _big+472
+	stx     _big+472+1
+	lda     #$ED
+	sta     _big+474
+	stx     _big+474+1
+	lda     #$EE
+	sta     _big+476
+	stx     _big+476+1
+	lda     #$EF
+	sta     _big+478
+	stx     _big+478+1
+	lda     #$F0
+	sta     _big+480
+	stx     _big+480+1
+	lda     #$F1
+	sta     _big+482
+	stx     _big+482+1
+	lda     #$F2
+	sta     _big+484
+	stx     _big+484+1
+	lda     #$F3
+	sta     _big+486
+	stx     _big+486+1
+	lda     #$F4
+	sta     _big+488
+	stx     _big+488+1
+	lda     #$F5
+	sta     _big+490
+	stx     _big+490+1
+	lda     #$F6
+	sta     _big+492
+	stx     _big+492+1
+	lda     #$F7
+	sta     _big+494
+	stx     _big+494+1
+	lda     #$F8
+	sta     _big+496
+	stx     _big+496+1
+	lda     #$F9
+	sta     _big+498
+	stx     _big+498+1
+	lda     #$FA
+	sta     _big+500
+	stx     _big+500+1
+	lda     #$FB
+	sta     _big+502
+	stx     _big+502+1
+	lda     #$FC
+	sta     _big+504
+	stx     _big+504+1
+	lda     #$FD
+	sta     _big+506
+	stx     _big+506+1
+	lda     #$FE
+	sta     _big+508
+	stx     _big+508+1
+	txa
+	sta     _big+510
+	sta     _big+510+1
+	tya
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L000E
+L000A:	ldy     #$01
+	lda     (sp),y
+	sta     tmp1
+	dey
+	lda     (sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_big)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_big)
+	sta     ptr1+1
+	iny
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     pushax
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	pha
+	txa
+	clc
+	adc     #$FF
+	tax
+	pla
+	jsr     tosicmp
+	beq     L000B
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+L000B:	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	ldy     #$01
+L000E:	lda     (sp),y
+	tax
+	cpx     #$01
+	bcc     L000A
+	ldx     #$00
+	txa
+L0001:	jmp     incsp2
+
+.endproc
+
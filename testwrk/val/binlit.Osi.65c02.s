@@ -0,0 +1,1394 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.export		_main
+
+.segment	"BSS"
+
+_small:
+	.res	256,$00
+_big:
+	.res	512,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	stz     _small
+	lda     #$01
+	sta     _small+1
+	asl     a
+	sta     _small+2
+	ina
+	sta     _small+3
+	ina
+	sta     _small+4
+	ina
+	sta     _small+5
+	ina
+	sta     _small+6
+	ina
+	sta     _small+7
+	ina
+	sta     _small+8
+	ina
+	sta     _small+9
+	ina
+	sta     _small+10
+	ina
+	sta     _small+11
+	ina
+	sta     _small+12
+	ina
+	sta     _small+13
+	ina
+	sta     _small+14
+	ina
+	sta     _small+15
+	ina
+	sta     _small+16
+	ina
+	sta     _small+17
+	ina
+	sta     _small+18
+	ina
+	sta     _small+19
+	ina
+	sta     _small+20
+	ina
+	sta     _small+21
+	ina
+	sta     _small+22
+	ina
+	sta     _small+23
+	ina
+	sta     _small+24
+	ina
+	sta     _small+25
+	ina
+	sta     _small+26
+	ina
+	sta     _small+27
+	ina
+	sta     _small+28
+	ina
+	sta     _small+29
+	ina
+	sta     _small+30
+	ina
+	sta     _small+31
+	ina
+	sta     _small+32
+	ina
+	sta     _small+33
+	ina
+	sta     _small+34
+	ina
+	sta     _small+35
+	ina
+	sta     _small+36
+	ina
+	sta     _small+37
+	ina
+	sta     _small+38
+	ina
+	sta     _small+39
+	ina
+	sta     _small+40
+	ina
+	sta     _small+41
+	ina
+	sta     _small+42
+	ina
+	sta     _small+43
+	ina
+	sta     _small+44
+	ina
+	sta     _small+45
+	ina
+	sta     _small+46
+	ina
+	sta     _small+47
+	ina
+	sta     _small+48
+	ina
+	sta     _small+49
+	ina
+	sta     _small+50
+	ina
+	sta     _small+51
+	ina
+	sta     _small+52
+	ina
+	sta     _small+53
+	ina
+	sta     _small+54
+	ina
+	sta     _small+55
+	ina
+	sta     _small+56
+	ina
+	sta     _small+57
+	ina
+	sta     _small+58
+	ina
+	sta     _small+59
+	ina
+	sta     _small+60
+	ina
+	sta     _small+61
+	ina
+	sta     _small+62
+	ina
+	sta     _small+63
+	ina
+	sta     _small+64
+	ina
+	sta     _small+65
+	ina
+	sta     _small+66
+	ina
+	sta     _small+67
+	ina
+	sta     _small+68
+	ina
+	sta     _small+69
+	ina
+	sta     _small+70
+	ina
+	sta     _small+71
+	ina
+	sta     _small+72
+	ina
+	sta     _small+73
+	ina
+	sta     _small+74
+	ina
+	sta     _small+75
+	ina
+	sta     _small+76
+	ina
+	sta     _small+77
+	ina
+	sta     _small+78
+	ina
+	sta     _small+79
+	ina
+	sta     _small+80
+	ina
+	sta     _small+81
+	ina
+	sta     _small+82
+	ina
+	sta     _small+83
+	ina
+	sta     _small+84
+	ina
+	sta     _small+85
+	ina
+	sta     _small+86
+	ina
+	sta     _small+87
+	ina
+	sta     _small+88
+	ina
+	sta     _small+89
+	ina
+	sta     _small+90
+	ina
+	sta     _small+91
+	ina
+	sta     _small+92
+	ina
+	sta     _small+93
+	ina
+	sta     _small+94
+	ina
+	sta     _small+95
+	ina
+	sta     _small+96
+	ina
+	sta     _small+97
+	ina
+	sta     _small+98
+	ina
+	sta     _small+99
+	ina
+	sta     _small+100
+	ina
+	sta     _small+101
+	ina
+	sta     _small+102
+	ina
+	sta     _small+103
+	ina
+	sta     _small+104
+	ina
+	sta     _small+105
+	ina
+	sta     _small+106
+	ina
+	sta     _small+107
+	ina
+	sta     _small+108
+	ina
+	sta     _small+109
+	ina
+	sta     _small+110
+	ina
+	sta     _small+111
+	ina
+	sta     _small+112
+	ina
+	sta     _small+113
+	ina
+	sta     _small+114
+	ina
+	sta     _small+115
+	ina
+	sta     _small+116
+	ina
+	sta     _small+117
+	ina
+	sta     _small+118
+	ina
+	sta     _small+119
+	ina
+	sta     _small+120
+	ina
+	sta     _small+121
+	ina
+	sta     _small+122
+	ina
+	sta     _small+123
+	ina
+	sta     _small+124
+	ina
+	sta     _small+125
+	ina
+	sta     _small+126
+	ina
+	sta     _small+127
+	ina
+	sta     _small+128
+	ina
+	sta     _small+129
+	ina
+	sta     _small+130
+	ina
+	sta     _small+131
+	ina
+	sta     _small+132
+	ina
+	sta     _small+133
+	ina
+	sta     _small+134
+	ina
+	sta     _small+135
+	ina
+	sta     _small+136
+	ina
+	sta     _small+137
+	ina
+	sta     _small+138
+	ina
+	sta     _small+139
+	ina
+	sta     _small+140
+	ina
+	sta     _small+141
+	ina
+	sta     _small+142
+	ina
+	sta     _small+143
+	ina
+	sta     _small+144
+	ina
+	sta     _small+145
+	ina
+	sta     _small+146
+	ina
+	sta     _small+147
+	ina
+	sta     _small+148
+	ina
+	sta     _small+149
+	ina
+	sta     _small+150
+	ina
+	sta     _small+151
+	ina
+	sta     _small+152
+	ina
+	sta     _small+153
+	ina
+	sta     _small+154
+	ina
+	sta     _small+155
+	ina
+	sta     _small+156
+	ina
+	sta     _small+157
+	ina
+	sta     _small+158
+	ina
+	sta     _small+159
+	ina
+	sta     _small+160
+	ina
+	sta     _small+161
+	ina
+	sta     _small+162
+	ina
+	sta     _small+163
+	ina
+	sta     _small+164
+	ina
+	sta     _small+165
+	ina
+	sta     _small+166
+	ina
+	sta     _small+167
+	ina
+	sta     _small+168
+	ina
+	sta     _small+169
+	ina
+	sta     _small+170
+	ina
+	sta     _small+171
+	ina
+	sta     _small+172
+	ina
+	sta     _small+173
+	ina
+	sta     _small+174
+	ina
+	sta     _small+175
+	ina
+	sta     _small+176
+	ina
+	sta     _small+177
+	ina
+	sta     _small+178
+	ina
+	sta     _small+179
+	ina
+	sta     _small+180
+	ina
+	sta     _small+181
+	ina
+	sta     _small+182
+	ina
+	sta     _small+183
+	ina
+	sta     _small+184
+	ina
+	sta     _small+185
+	ina
+	sta     _small+186
+	ina
+	sta     _small+187
+	ina
+	sta     _small+188
+	ina
+	sta     _small+189
+	ina
+	sta     _small+190
+	ina
+	sta     _small+191
+	ina
+	sta     _small+192
+	ina
+	sta     _small+193
+	ina
+	sta     _small+194
+	ina
+	sta     _small+195
+	ina
+	sta     _small+196
+	ina
+	sta     _small+197
+	ina
+	sta     _small+198
+	ina
+	sta     _small+199
+	ina
+	sta     _small+200
+	ina
+	sta     _small+201
+	ina
+	sta     _small+202
+	ina
+	sta     _small+203
+	ina
+	sta     _small+204
+	ina
+	sta     _small+205
+	ina
+	sta     _small+206
+	ina
+	sta     _small+207
+	ina
+	sta     _small+208
+	ina
+	sta     _small+209
+	ina
+	sta     _small+210
+	ina
+	sta     _small+211
+	ina
+	sta     _small+212
+	ina
+	sta     _small+213
+	ina
+	sta     _small+214
+	ina
+	sta     _small+215
+	ina
+	sta     _small+216
+	ina
+	sta     _small+217
+	ina
+	sta     _small+218
+	ina
+	sta     _small+219
+	ina
+	sta     _small+220
+	ina
+	sta     _small+221
+	ina
+	sta     _small+222
+	ina
+	sta     _small+223
+	ina
+	sta     _small+224
+	ina
+	sta     _small+225
+	ina
+	sta     _small+226
+	ina
+	sta     _small+227
+	ina
+	sta     _small+228
+	ina
+	sta     _small+229
+	ina
+	sta     _small+230
+	ina
+	sta     _small+231
+	ina
+	sta     _small+232
+	ina
+	sta     _small+233
+	ina
+	sta     _small+234
+	ina
+	sta     _small+235
+	ina
+	sta     _small+236
+	ina
+	sta     _small+237
+	ina
+	sta     _small+238
+	ina
+	sta     _small+239
+	ina
+	sta     _small+240
+	ina
+	sta     _small+241
+	ina
+	sta     _small+242
+	ina
+	sta     _small+243
+	ina
+	sta     _small+244
+	ina
+	sta     _small+245
+	ina
+	sta     _small+246
+	ina
+	sta     _small+247
+	ina
+	sta     _small+248
+	ina
+	sta     _small+249
+	ina
+	sta     _small+250
+	ina
+	sta     _small+251
+	ina
+	sta     _small+252
+	ina
+	sta     _small+253
+	ina
+	sta     _small+254
+	ina
+	sta     _small+255
+	ina
+	sta     (sp)
+	ldy     #$01
+	sta     (sp),y
+	bra     L000D
+L0005:	lda     #<(_small)
+	clc
+	adc     (sp)
+	sta     ptr1
+	lda     #>(_small)
+	ldy     #$01
+	adc     (sp),y
+	sta     ptr1+1
+	ldx     #$00
+	lda     (ptr1)
+	cmp     (sp)
+	bne     L000F
+	txa
+	ldy     #$01
+	cmp     (sp),y
+	beq     L0006
+L000F:	tya
+	jmp     L0001
+L0006:	tya
+	jsr     addeq0sp
+	ldy     #$01
+L000D:	lda     (sp),y
+	tax
+	cpx     #$01
+	bcc     L0005
+	ldx     #$FF
+	stz     _big
+	stx     _big+1
+	tya
+	sta     _big+2
+	stx     _big+2+1
+	ina
+	sta     _big+4
+	stx     _big+4+1
+	ina
+	sta     _big+6
+	stx     _big+6+1
+	ina
+	sta     _big+8
+	stx     _big+8+1
+	ina
+	sta     _big+10
+	stx     _big+10+1
+	ina
+	sta     _big+12
+	stx     _big+12+1
+	ina
+	sta     _big+14
+	stx     _big+14+1
+	ina
+	sta     _big+16
+	stx     _big+16+1
+	ina
+	sta     _big+18
+	stx     _big+18+1
+	ina
+	sta     _big+20
+	stx     _big+20+1
+	ina
+	sta     _big+22
+	stx     _big+22+1
+	ina
+	sta     _big+24
+	stx     _big+24+1
+	ina
+	sta     _big+26
+	stx     _big+26+1
+	ina
+	sta     _big+28
+	stx     _big+28+1
+	ina
+	sta     _big+30
+	stx     _big+30+1
+	ina
+	sta     _big+32
+	stx     _big+32+1
+	ina
+	sta     _big+34
+	stx     _big+34+1
+	ina
+	sta     _big+36
+	stx     _big+36+1
+	ina
+	sta     _big+38
+	stx     _big+38+1
+	ina
+	sta     _big+40
+	stx     _big+40+1
+	ina
+	sta     _big+42
+	stx     _big+42+1
+	ina
+	sta     _big+44
+	stx     _big+44+1
+	ina
+	sta     _big+46
+	stx     _big+46+1
+	ina
+	sta     _big+48
+	stx     _big+48+1
+	ina
+	sta     _big+50
+	stx     _big+50+1
+	ina
+	sta     _big+52
+	stx     _big+52+1
+	ina
+	sta     _big+54
+	stx     _big+54+1
+	ina
+	sta     _big+56
+	stx     _big+56+1
+	ina
+	sta     _big+58
+	stx     _big+58+1
+	ina
+	sta     _big+60
+	stx     _big+60+1
+	ina
+	sta     _big+62
+	stx     _big+62+1
+	ina
+	sta     _big+64
+	stx     _big+64+1
+	ina
+	sta     _big+66
+	stx     _big+66+1
+	ina
+	sta     _big+68
+	stx     _big+68+1
+	ina
+	sta     _big+70
+	stx     _big+70+1
+	ina
+	sta     _big+72
+	stx     _big+72+1
+	ina
+	sta     _big+74
+	stx     _big+74+1
+	ina
+	sta     _big+76
+	stx     _big+76+1
+	ina
+	sta     _big+78
+	stx     _big+78+1
+	ina
+	sta     _big+80
+	stx     _big+80+1
+	ina
+	sta     _big+82
+	stx     _big+82+1
+	ina
+	sta     _big+84
+	stx     _big+84+1
+	ina
+	sta     _big+86
+	stx     _big+86+1
+	ina
+	sta     _big+88
+	stx     _big+88+1
+	ina
+	sta     _big+90
+	stx     _big+90+1
+	ina
+	sta     _big+92
+	stx     _big+92+1
+	ina
+	sta     _big+94
+	stx     _big+94+1
+	ina
+	sta     _big+96
+	stx     _big+96+1
+	ina
+	sta     _big+98
+	stx     _big+98+1
+	ina
+	sta     _big+100
+	stx     _big+100+1
+	ina
+	sta     _big+102
+	stx     _big+102+1
+	ina
+	sta     _big+104
+	stx     _big+104+1
+	ina
+	sta     _big+106
+	stx     _big+106+1
+	ina
+	sta     _big+108
+	stx     _big+108+1
+	ina
+	sta     _big+110
+	stx     _big+110+1
+	ina
+	sta     _big+112
+	stx     _big+112+1
+	ina
+	sta     _big+114
+	stx     _big+114+1
+	ina
+	sta     _big+116
+	stx     _big+116+1
+	ina
+	sta     _big+118
+	stx     _big+118+1
+	ina
+	sta     _big+120
+	stx     _big+120+1
+	ina
+	sta     _big+122
+	stx     _big+122+1
+	ina
+	sta     _big+124
+	stx     _big+124+1
+	ina
+	sta     _big+126
+	stx     _big+126+1
+	ina
+	sta     _big+128
+	stx     _big+128+1
+	ina
+	sta     _big+130
+	stx     _big+130+1
+	ina
+	sta     _big+132
+	stx     _big+132+1
+	ina
+	sta     _big+134
+	stx     _big+134+1
+	ina
+	sta     _big+136
+	stx     _big+136+1
+	ina
+	sta     _big+138
+	stx     _big+138+1
+	ina
+	sta     _big+140
+	stx     _big+140+1
+	ina
+	sta     _big+142
+	stx     _big+142+1
+	ina
+	sta     _big+144
+	stx     _big+144+1
+	ina
+	sta     _big+146
+	stx     _big+146+1
+	ina
+	sta     _big+148
+	stx     _big+148+1
+	ina
+	sta     _big+150
+	stx     _big+150+1
+	ina
+	sta     _big+152
+	stx     _big+152+1
+	ina
+	sta     _big+154
+	stx     _big+154+1
+	ina
+	sta     _big+156
+	stx     _big+156+1
+	ina
+	sta     _big+158
+	stx     _big+158+1
+	ina
+	sta     _big+160
+	stx     _big+160+1
+	ina
+	sta     _big+162
+	stx     _big+162+1
+	ina
+	sta     _big+164
+	stx     _big+164+1
+	ina
+	sta     _big+166
+	stx     _big+166+1
+	ina
+	sta     _big+168
+	stx     _big+168+1
+	ina
+	sta     _big+170
+	stx     _big+170+1
+	ina
+	sta     _big+172
+	stx     _big+172+1
+	ina
+	sta     _big+174
+	stx     _big+174+1
+	ina
+	sta     _big+176
+	stx     _big+176+1
+	ina
+	sta     _big+178
+	stx     _big+178+1
+	ina
+	sta     _big+180
+	stx     _big+180+1
+	ina
+	sta     _big+182
+	stx     _big+182+1
+	ina
+	sta     _big+184
+	stx     _big+184+1
+	ina
+	sta     _big+186
+	stx     _big+186+1
+	ina
+	sta     _big+188
+	stx     _big+188+1
+	ina
+	sta     _big+190
+	stx     _big+190+1
+	ina
+	sta     _big+192
+	stx     _big+192+1
+	ina
+	sta     _big+194
+	stx     _big+194+1
+	ina
+	sta     _big+196
+	stx     _big+196+1
+	ina
+	sta     _big+198
+	stx     _big+198+1
+	ina
+	sta     _big+200
+	stx     _big+200+1
+	ina
+	sta     _big+202
+	stx     _big+202+1
+	ina
+	sta     _big+204
+	stx     _big+204+1
+	ina
+	sta     _big+206
+	stx     _big+206+1
+	ina
+	sta     _big+208
+	stx     _big+208+1
+	ina
+	sta     _big+210
+	stx     _big+210+1
+	ina
+	sta     _big+212
+	stx     _big+212+1
+	ina
+	sta     _big+214
+	stx     _big+214+1
+	ina
+	sta     _big+216
+	stx     _big+216+1
+	ina
+	sta     _big+218
+	stx     _big+218+1
+	ina
+	sta     _big+220
+	stx     _big+220+1
+	ina
+	sta     _big+222
+	stx     _big+222+1
+	ina
+	sta     _big+224
+	stx     _big+224+1
+	ina
+	sta     _big+226
+	stx     _big+226+1
+	ina
+	sta     _big+228
+	stx     _big+228+1
+	ina
+	sta     _big+230
+	stx     _big+230+1
+	ina
+	sta     _big+232
+	stx     _big+232+1
+	ina
+	sta     _big+234
+	stx     _big+234+1
+	ina
+	sta     _big+236
+	stx     _big+236+1
+	ina
+	sta     _big+238
+	stx     _big+238+1
+	ina
+	sta     _big+240
+	stx     _big+240+1
+	ina
+	sta     _big+242
+	stx     _big+242+1
+	ina
+	sta     _big+244
+	stx     _big+244+1
+	ina
+	sta     _big+246
+	stx     _big+246+1
+	ina
+	sta     _big+248
+	stx     _big+248+1
+	ina
+	sta     _big+250
+	stx     _big+250+1
+	ina
+	sta     _big+252
+	stx     _big+252+1
+	ina
+	sta     _big+254
+	stx     _big+254+1
+	ina
+	sta     _big+256
+	stx     _big+256+1
+	ina
+	sta     _big+258
+	stx     _big+258+1
+	ina
+	sta     _big+260
+	stx     _big+260+1
+	ina
+	sta     _big+262
+	stx     _big+262+1
+	ina
+	sta     _big+264
+	stx     _big+264+1
+	ina
+	sta     _big+266
+	stx     _big+266+1
+	ina
+	sta     _big+268
+	stx     _big+268+1
+	ina
+	sta     _big+270
+	stx     _big+270+1
+	ina
+	sta     _big+272
+	stx     _big+272+1
+	ina
+	sta     _big+274
+	stx     _big+274+1
+	ina
+	sta     _big+276
+	stx     _big+276+1
+	ina
+	sta     _big+278
+	stx     _big+278+1
+	ina
+	sta     _big+280
+	stx     _big+280+1
+	ina
+	sta     _big+282
+	stx     _big+282+1
+	ina
+	sta     _big+284
+	stx     _big+284+1
+	ina
+	sta     _big+286
+	stx     _big+286+1
+	ina
+	sta     _big+288
+	stx     _big+288+1
+	ina
+	sta     _big+290
+	stx     _big+290+1
+	ina
+	sta     _big+292
+	stx     _big+292+1
+	ina
+	sta     _big+294
+	stx     _big+294+1
+	ina
+	sta     _big+296
+	stx     _big+296+1
+	ina
+	sta     _big+298
+	stx     _big+298+1
+	ina
+	sta     _big+300
+	stx     _big+300+1
+	ina
+	sta     _big+302
+	stx     _big+302+1
+	ina
+	sta     _big+304
+	stx     _big+304+1
+	ina
+	sta     _big+306
+	stx     _big+306+1
+	ina
+	sta     _big+308
+	stx     _big+308+1
+	ina
+	sta     _big+310
+	stx     _big+310+1
+	ina
+	sta     _big+312
+	stx     _big+312+1
+	ina
+	sta     _big+314
+	stx     _big+314+1
+	ina
+	sta     _big+316
+	stx     _big+316+1
+	ina
+	sta     _big+318
+	stx     _big+318+1
+	ina
+	sta     _big+320
+	stx     _big+320+1
+	ina
+	sta     _big+322
+	stx     _big+322+1
+	ina
+	sta     _big+324
+	stx     _big+324+1
+	ina
+	sta     _big+326
+	stx     _big+326+1
+	ina
+	sta     _big+328
+	stx     _big+328+1
+	ina
+	sta     _big+330
+	stx     _big+330+1
+	ina
+	sta     _big+332
+	stx     _big+332+1
+	ina
+	sta     _big+334
+	stx     _big+334+1
+	ina
+	sta     _big+336
+	stx     _big+336+1
+	ina
+	sta     _big+338
+	stx     _big+338+1
+	ina
+	sta     _big+340
+	stx     _big+340+1
+	ina
+	sta     _big+342
+	stx     _big+342+1
+	ina
+	sta     _big+344
+	stx     _big+344+1
+	ina
+	sta     _big+346
+	stx     _big+346+1
+	ina
+	sta     _big+348
+	stx     _big+348+1
+	ina
+	sta     _big+350
+	stx     _big+350+1
+	ina
+	sta     _big+352
+	stx     _big+352+1
+	ina
+	sta     _big+354
+	stx     _big+354+1
+	ina
+	sta     _big+356
+	stx     _big+356+1
+	ina
+	sta     _big+358
+	stx     _big+358+1
+	ina
+	sta     _big+360
+	stx     _big+360+1
+	ina
+	sta     _big+362
+	stx     _big+362+1
+	ina
+	sta     _big+364
+	stx     _big+364+1
+	ina
+	sta     _big+366
+	stx     _big+366+1
+	ina
+	sta     _big+368
+	stx     _big+368+1
+	ina
+	sta     _big+370
+	stx     _big+370+1
+	ina
+	sta     _big+372
+	stx     _big+372+1
+	ina
+	sta     _big+374
+	stx     _big+374+1
+	ina
+	sta     _big+376
+	stx     _big+376+1
+	ina
+	sta     _big+378
+	stx     _big+378+1
+	ina
+	sta     _big+380
+	stx     _big+380+1
+	ina
+	sta     _big+382
+	stx     _big+382+1
+	ina
+	sta     _big+384
+	stx     _big+384+1
+	ina
+	sta     _big+386
+	stx     _big+386+1
+	ina
+	sta     _big+388
+	stx     _big+388+1
+	ina
+	sta     _big+390
+	stx     _big+390+1
+	ina
+	sta     _big+392
+	stx     _big+392+1
+	ina
+	sta     _big+394
+	stx     _big+394+1
+	ina
+	sta     _big+396
+	stx     _big+396+1
+	ina
+	sta     _big+398
+	stx     _big+398+1
+	ina
+	sta     _big+400
+	stx     _big+400+1
+	ina
+	sta     _big+402
+	stx     _big+402+1
+	ina
+	sta     _big+404
+	stx     _big+404+1
+	ina
+	sta     _big+406
+	stx     _big+406+1
+	ina
+	sta     _big+408
+	stx     _big+408+1
+	ina
+	sta     _big+410
+	stx     _big+410+1
+	ina
+	sta     _big+412
+	stx     _big+412+1
+	ina
+	sta     _big+414
+	stx     _big+414+1
+	ina
+	sta     _big+416
+	stx     _big+416+1
+	ina
+	sta     _big+418
+	stx     _big+418+1
+	ina
+	sta     _big+420
+	stx     _big+420+1
+	ina
+	sta     _big+422
+	stx     _big+422+1
+	ina
+	sta     _big+424
+	stx     _big+424+1
+	ina
+	sta     _big+426
+	stx     _big+426+1
+	ina
+	sta     _big+428
+	stx     _big+428+1
+	ina
+	sta     _big+430
+	stx     _big+430+1
+	ina
+	sta     _big+432
+	stx     _big+432+1
+	ina
+	sta     _big+434
+	stx     _big+434+1
+	ina
+	sta     _big+436
+	stx     _big+436+1
+	ina
+	sta     _big+438
+	stx     _big+438+1
+	ina
+	sta     _big+440
+	stx     _big+440+1
+	ina
+	sta     _big+442
+	stx     _big+442+1
+	ina
+	sta     _big+444
+	stx     _big+444+1
+	ina
+	sta     _big+446
+	stx     _big+446+1
+	ina
+	sta     _big+448
+	stx     _big+448+1
+	ina
+	sta     _big+450
+	stx     _big+450+1
+	ina
+	sta     _big+452
+	stx     _big+452+1
+	ina
+	sta     _big+454
+	stx     _big+454+1
+	ina
+	sta     _big+456
+	stx     _big+456+1
+	ina
+	sta     _big+458
+	stx     _big+458+1
+	ina
+	sta     _big+460
+	stx     _big+460+1
+	ina
+	sta     _big+462
+	stx     _big+462+1
+	ina
+	sta     _big+464
+	stx     _big+464+1
+	ina
+	sta     _big+466
+	stx     _big+466+1
+	ina
+	sta     _big+468
+	stx     _big+468+1
+	ina
+	sta     _big+470
+	stx     _big+470+1
+	ina
+	sta     _big+472
+	stx     _big+472+1
+	ina
+	sta     _big+474
+	stx     _big+474+1
+	ina
+	sta     _big+476
+	stx     _big+476+1
+	ina
+	sta     _big+478
+	stx     _big+478+1
+	ina
+	sta     _big+480
+	stx     _big+480+1
+	ina
+	sta     _big+482
+	stx     _big+482+1
+	ina
+	sta     _big+484
+	stx     _big+484+1
+	ina
+	sta     _big+486
+	stx     _big+486+1
+	ina
+	sta     _big+488
+	stx     _big+488+1
+	ina
+	sta     _big+490
+	stx     _big+490+1
+	ina
+	sta     _big+492
+	stx     _big+492+1
+	ina
+	sta     _big+494
+	stx     _big+494+1
+	ina
+	sta     _big+496
+	stx     _big+496+1
+	ina
+	sta     _big+498
+	stx     _big+498+1
+	ina
+	sta     _big+500
+	stx     _big+500+1
+	ina
+	sta     _big+502
+	stx     _big+502+1
+	ina
+	sta     _big+504
+	stx     _big+504+1
+	ina
+	sta     _big+506
+	stx     _big+506+1
+	ina
+	sta     _big+508
+	stx     _big+508+1
+	txa
+	sta     _big+510
+	sta     _big+510+1
+	ina
+	sta     (sp)
+	ldy     #$01
+	sta     (sp),y
+	bra     L000E
+L000A:	ldy     #$01
+	lda     (sp),y
+	sta     tmp1
+	lda     (sp)
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_big)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_big)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	jsr     pushax
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	pha
+	txa
+	clc
+	adc     #$FF
+	tax
+	pla
+	jsr     tosicmp
+	beq     L000B
+	ldx     #$00
+	lda     #$01
+	bra     L0001
+L000B:	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	ldy     #$01
+L000E:	lda     (sp),y
+	tax
+	cpx     #$01
+	bcc     L000A
+	ldx     #$00
+	txa
+L0001:	jmp     incsp2
+
+.endproc
+
@@ -0,0 +1,2439 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "binlit.c", 18351, 1613073744
+	.forceimport	__STARTUP__
+	.export		_main
+
+.segment	"BSS"
+
+_small:
+	.res	256,$00
+_big:
+	.res	512,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+	.dbg	sym, "i", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "binlit.c", 8
+	jsr     decsp2
+	ldx     #$00
+	lda     #$00
+	sta     _small
+	.dbg	line, "binlit.c", 9
+	ldx     #$00
+	lda     #$01
+	sta     _small+1
+	.dbg	line, "binlit.c", 10
+	ldx     #$00
+	lda     #$02
+	sta     _small+2
+	.dbg	line, "binlit.c", 11
+	ldx     #$00
+	lda     #$03
+	sta     _small+3
+	.dbg	line, "binlit.c", 12
+	ldx     #$00
+	lda     #$04
+	sta     _small+4
+	.dbg	line, "binlit.c", 13
+	ldx     #$00
+	lda     #$05
+	sta     _small+5
+	.dbg	line, "binlit.c", 14
+	ldx     #$00
+	lda     #$06
+	sta     _small+6
+	.dbg	line, "binlit.c", 15
+	ldx     #$00
+	lda     #$07
+	sta     _small+7
+	.dbg	line, "binlit.c", 16
+	ldx     #$00
+	lda     #$08
+	sta     _small+8
+	.dbg	line, "binlit.c", 17
+	ldx     #$00
+	lda     #$09
+	sta     _small+9
+	.dbg	line, "binlit.c", 18
+	ldx     #$00
+	lda     #$0A
+	sta     _small+10
+	.dbg	line, "binlit.c", 19
+	ldx     #$00
+	lda     #$0B
+	sta     _small+11
+	.dbg	line, "binlit.c", 20
+	ldx     #$00
+	lda     #$0C
+	sta     _small+12
+	.dbg	line, "binlit.c", 21
+	ldx     #$00
+	lda     #$0D
+	sta     _small+13
+	.dbg	line, "binlit.c", 22
+	ldx     #$00
+	lda     #$0E
+	sta     _small+14
+	.dbg	line, "binlit.c", 23
+	ldx     #$00
+	lda     #$0F
+	sta     _small+15
+	.dbg	line, "binlit.c", 24
+	ldx     #$00
+	lda     #$10
+	sta     _small+16
+	.dbg	line, "binlit.c", 25
+	ldx     #$00
+	lda     #$11
+	sta     _small+17
+	.dbg	line, "binlit.c", 26
+	ldx     #$00
+	lda     #$12
+	sta     _small+18
+	.dbg	line, "binlit.c", 27
+	ldx     #$00
+	lda     #$13
+	sta     _small+19
+	.dbg	line, "binlit.c", 28
+	ldx     #$00
+	lda     #$14
+	sta     _small+20
+	.dbg	line, "binlit.c", 29
+	ldx     #$00
+	lda     #$15
+	sta     _small+21
+	.dbg	line, "binlit.c", 30
+	ldx     #$00
+	lda     #$16
+	sta     _small+22
+	.dbg	line, "binlit.c", 31
+	ldx     #$00
+	lda     #$17
+	sta     _small+23
+	.dbg	line, "binlit.c", 32
+	ldx     #$00
+	lda     #$18
+	sta     _small+24
+	.dbg	line, "binlit.c", 33
+	ldx     #$00
+	lda     #$19
+	sta     _small+25
+	.dbg	line, "binlit.c", 34
+	ldx     #$00
+	lda     #$1A
+	sta     _small+26
+	.dbg	line, "binlit.c", 35
+	ldx     #$00
+	lda     #$1B
+	sta     _small+27
+	.dbg	line, "binlit.c", 36
+	ldx     #$00
+	lda     #$1C
+	sta     _small+28
+	.dbg	line, "binlit.c", 37
+	ldx     #$00
+	lda     #$1D
+	sta     _small+29
+	.dbg	line, "binlit.c", 38
+	ldx     #$00
+	lda     #$1E
+	sta     _small+30
+	.dbg	line, "binlit.c", 39
+	ldx     #$00
+	lda     #$1F
+	sta     _small+31
+	.dbg	line, "binlit.c", 40
+	ldx     #$00
+	lda     #$20
+	sta     _small+32
+	.dbg	line, "binlit.c", 41
+	ldx     #$00
+	lda     #$21
+	sta     _small+33
+	.dbg	line, "binlit.c", 42
+	ldx     #$00
+	lda     #$22
+	sta     _small+34
+	.dbg	line, "binlit.c", 43
+	ldx     #$00
+	lda     #$23
+	sta     _small+35
+	.dbg	line, "binlit.c", 44
+	ldx     #$00
+	lda     #$24
+	sta     _small+36
+	.dbg	line, "binlit.c", 45
+	ldx     #$00
+	lda     #$25
+	sta     _small+37
+	.dbg	line, "binlit.c", 46
+	ldx     #$00
+	lda     #$26
+	sta     _small+38
+	.dbg	line, "binlit.c", 47
+	ldx     #$00
+	lda     #$27
+	sta     _small+39
+	.dbg	line, "binlit.c", 48
+	ldx     #$00
+	lda     #$28
+	sta     _small+40
+	.dbg	line, "binlit.c", 49
+	ldx     #$00
+	lda     #$29
+	sta     _small+41
+	.dbg	line, "binlit.c", 50
+	ldx     #$00
+	lda     #$2A
+	sta     _small+42
+	.dbg	line, "binlit.c", 51
+	ldx     #$00
+	lda     #$2B
+	sta     _small+43
+	.dbg	line, "binlit.c", 52
+	ldx     #$00
+	lda     #$2C
+	sta     _small+44
+	.dbg	line, "binlit.c", 53
+	ldx     #$00
+	lda     #$2D
+	sta     _small+45
+	.dbg	line, "binlit.c", 54
+	ldx     #$00
+	lda     #$2E
+	sta     _small+46
+	.dbg	line, "binlit.c", 55
+	ldx     #$00
+	lda     #$2F
+	sta     _small+47
+	.dbg	line, "binlit.c", 56
+	ldx     #$00
+	lda     #$30
+	sta     _small+48
+	.dbg	line, "binlit.c", 57
+	ldx     #$00
+	lda     #$31
+	sta     _small+49
+	.dbg	line, "binlit.c", 58
+	ldx     #$00
+	lda     #$32
+	sta     _small+50
+	.dbg	line, "binlit.c", 59
+	ldx     #$00
+	lda     #$33
+	sta     _small+51
+	.dbg	line, "binlit.c", 60
+	ldx     #$00
+	lda     #$34
+	sta     _small+52
+	.dbg	line, "binlit.c", 61
+	ldx     #$00
+	lda     #$35
+	sta     _small+53
+	.dbg	line, "binlit.c", 62
+	ldx     #$00
+	lda     #$36
+	sta     _small+54
+	.dbg	line, "binlit.c", 63
+	ldx     #$00
+	lda     #$37
+	sta     _small+55
+	.dbg	line, "binlit.c", 64
+	ldx     #$00
+	lda     #$38
+	sta     _small+56
+	.dbg	line, "binlit.c", 65
+	ldx     #$00
+	lda     #$39
+	sta     _small+57
+	.dbg	line, "binlit.c", 66
+	ldx     #$00
+	lda     #$3A
+	sta     _small+58
+	.dbg	line, "binlit.c", 67
+	ldx     #$00
+	lda     #$3B
+	sta     _small+59
+	.dbg	line, "binlit.c", 68
+	ldx     #$00
+	lda     #$3C
+	sta     _small+60
+	.dbg	line, "binlit.c", 69
+	ldx     #$00
+	lda     #$3D
+	sta     _small+61
+	.dbg	line, "binlit.c", 70
+	ldx     #$00
+	lda     #$3E
+	sta     _small+62
+	.dbg	line, "binlit.c", 71
+	ldx     #$00
+	lda     #$3F
+	sta     _small+63
+	.dbg	line, "binlit.c", 72
+	ldx     #$00
+	lda     #$40
+	sta     _small+64
+	.dbg	line, "binlit.c", 73
+	ldx     #$00
+	lda     #$41
+	sta     _small+65
+	.dbg	line, "binlit.c", 74
+	ldx     #$00
+	lda     #$42
+	sta     _small+66
+	.dbg	line, "binlit.c", 75
+	ldx     #$00
+	lda     #$43
+	sta     _small+67
+	.dbg	line, "binlit.c", 76
+	ldx     #$00
+	lda     #$44
+	sta     _small+68
+	.dbg	line, "binlit.c", 77
+	ldx     #$00
+	lda     #$45
+	sta     _small+69
+	.dbg	line, "binlit.c", 78
+	ldx     #$00
+	lda     #$46
+	sta     _small+70
+	.dbg	line, "binlit.c", 79
+	ldx     #$00
+	lda     #$47
+	sta     _small+71
+	.dbg	line, "binlit.c", 80
+	ldx     #$00
+	lda     #$48
+	sta     _small+72
+	.dbg	line, "binlit.c", 81
+	ldx     #$00
+	lda     #$49
+	sta     _small+73
+	.dbg	line, "binlit.c", 82
+	ldx     #$00
+	lda     #$4A
+	sta     _small+74
+	.dbg	line, "binlit.c", 83
+	ldx     #$00
+	lda     #$4B
+	sta     _small+75
+	.dbg	line, "binlit.c", 84
+	ldx     #$00
+	lda     #$4C
+	sta     _small+76
+	.dbg	line, "binlit.c", 85
+	ldx     #$00
+	lda     #$4D
+	sta     _small+77
+	.dbg	line, "binlit.c", 86
+	ldx     #$00
+	lda     #$4E
+	sta     _small+78
+	.dbg	line, "binlit.c", 87
+	ldx     #$00
+	lda     #$4F
+	sta     _small+79
+	.dbg	line, "binlit.c", 88
+	ldx     #$00
+	lda     #$50
+	sta     _small+80
+	.dbg	line, "binlit.c", 89
+	ldx     #$00
+	lda     #$51
+	sta     _small+81
+	.dbg	line, "binlit.c", 90
+	ldx     #$00
+	lda     #$52
+	sta     _small+82
+	.dbg	line, "binlit.c", 91
+	ldx     #$00
+	lda     #$53
+	sta     _small+83
+	.dbg	line, "binlit.c", 92
+	ldx     #$00
+	lda     #$54
+	sta     _small+84
+	.dbg	line, "binlit.c", 93
+	ldx     #$00
+	lda     #$55
+	sta     _small+85
+	.dbg	line, "binlit.c", 94
+	ldx     #$00
+	lda     #$56
+	sta     _small+86
+	.dbg	line, "binlit.c", 95
+	ldx     #$00
+	lda     #$57
+	sta     _small+87
+	.dbg	line, "binlit.c", 96
+	ldx     #$00
+	lda     #$58
+	sta     _small+88
+	.dbg	line, "binlit.c", 97
+	ldx     #$00
+	lda     #$59
+	sta     _small+89
+	.dbg	line, "binlit.c", 98
+	ldx     #$00
+	lda     #$5A
+	sta     _small+90
+	.dbg	line, "binlit.c", 99
+	ldx     #$00
+	lda     #$5B
+	sta     _small+91
+	.dbg	line, "binlit.c", 100
+	ldx     #$00
+	lda     #$5C
+	sta     _small+92
+	.dbg	line, "binlit.c", 101
+	ldx     #$00
+	lda     #$5D
+	sta     _small+93
+	.dbg	line, "binlit.c", 102
+	ldx     #$00
+	lda     #$5E
+	sta     _small+94
+	.dbg	line, "binlit.c", 103
+	ldx     #$00
+	lda     #$5F
+	sta     _small+95
+	.dbg	line, "binlit.c", 104
+	ldx     #$00
+	lda     #$60
+	sta     _small+96
+	.dbg	line, "binlit.c", 105
+	ldx     #$00
+	lda     #$61
+	sta     _small+97
+	.dbg	line, "binlit.c", 106
+	ldx     #$00
+	lda     #$62
+	sta     _small+98
+	.dbg	line, "binlit.c", 107
+	ldx     #$00
+	lda     #$63
+	sta     _small+99
+	.dbg	line, "binlit.c", 108
+	ldx     #$00
+	lda     #$64
+	sta     _small+100
+	.dbg	line, "binlit.c", 109
+	ldx     #$00
+	lda     #$65
+	sta     _small+101
+	.dbg	line, "binlit.c", 110
+	ldx     #$00
+	lda     #$66
+	sta     _small+102
+	.dbg	line, "binlit.c", 111
+	ldx     #$00
+	lda     #$67
+	sta     _small+103
+	.dbg	line, "binlit.c", 112
+	ldx     #$00
+	lda     #$68
+	sta     _small+104
+	.dbg	line, "binlit.c", 113
+	ldx     #$00
+	lda     #$69
+	sta     _small+105
+	.dbg	line, "binlit.c", 114
+	ldx     #$00
+	lda     #$6A
+	sta     _small+106
+	.dbg	line, "binlit.c", 115
+	ldx     #$00
+	lda     #$6B
+	sta     _small+107
+	.dbg	line, "binlit.c", 116
+	ldx     #$00
+	lda     #$6C
+	sta     _small+108
+	.dbg	line, "binlit.c", 117
+	ldx     #$00
+	lda     #$6D
+	sta     _small+109
+	.dbg	line, "binlit.c", 118
+	ldx     #$00
+	lda     #$6E
+	sta     _small+110
+	.dbg	line, "binlit.c", 119
+	ldx     #$00
+	lda     #$6F
+	sta     _small+111
+	.dbg	line, "binlit.c", 120
+	ldx     #$00
+	lda     #$70
+	sta     _small+112
+	.dbg	line, "binlit.c", 121
+	ldx     #$00
+	lda     #$71
+	sta     _small+113
+	.dbg	line, "binlit.c", 122
+	ldx     #$00
+	lda     #$72
+	sta     _small+114
+	.dbg	line, "binlit.c", 123
+	ldx     #$00
+	lda     #$73
+	sta     _small+115
+	.dbg	line, "binlit.c", 124
+	ldx     #$00
+	lda     #$74
+	sta     _small+116
+	.dbg	line, "binlit.c", 125
+	ldx     #$00
+	lda     #$75
+	sta     _small+117
+	.dbg	line, "binlit.c", 126
+	ldx     #$00
+	lda     #$76
+	sta     _small+118
+	.dbg	line, "binlit.c", 127
+	ldx     #$00
+	lda     #$77
+	sta     _small+119
+	.dbg	line, "binlit.c", 128
+	ldx     #$00
+	lda     #$78
+	sta     _small+120
+	.dbg	line, "binlit.c", 129
+	ldx     #$00
+	lda     #$79
+	sta     _small+121
+	.dbg	line, "binlit.c", 130
+	ldx     #$00
+	lda     #$7A
+	sta     _small+122
+	.dbg	line, "binlit.c", 131
+	ldx     #$00
+	lda     #$7B
+	sta     _small+123
+	.dbg	line, "binlit.c", 132
+	ldx     #$00
+	lda     #$7C
+	sta     _small+124
+	.dbg	line, "binlit.c", 133
+	ldx     #$00
+	lda     #$7D
+	sta     _small+125
+	.dbg	line, "binlit.c", 134
+	ldx     #$00
+	lda     #$7E
+	sta     _small+126
+	.dbg	line, "binlit.c", 135
+	ldx     #$00
+	lda     #$7F
+	sta     _small+127
+	.dbg	line, "binlit.c", 136
+	ldx     #$00
+	lda     #$80
+	sta     _small+128
+	.dbg	line, "binlit.c", 137
+	ldx     #$00
+	lda     #$81
+	sta     _small+129
+	.dbg	line, "binlit.c", 138
+	ldx     #$00
+	lda     #$82
+	sta     _small+130
+	.dbg	line, "binlit.c", 139
+	ldx     #$00
+	lda     #$83
+	sta     _small+131
+	.dbg	line, "binlit.c", 140
+	ldx     #$00
+	lda     #$84
+	sta     _small+132
+	.dbg	line, "binlit.c", 141
+	ldx     #$00
+	lda     #$85
+	sta     _small+133
+	.dbg	line, "binlit.c", 142
+	ldx     #$00
+	lda     #$86
+	sta     _small+134
+	.dbg	line, "binlit.c", 143
+	ldx     #$00
+	lda     #$87
+	sta     _small+135
+	.dbg	line, "binlit.c", 144
+	ldx     #$00
+	lda     #$88
+	sta     _small+136
+	.dbg	line, "binlit.c", 145
+	ldx     #$00
+	lda     #$89
+	sta     _small+137
+	.dbg	line, "binlit.c", 146
+	ldx     #$00
+	lda     #$8A
+	sta     _small+138
+	.dbg	line, "binlit.c", 147
+	ldx     #$00
+	lda     #$8B
+	sta     _small+139
+	.dbg	line, "binlit.c", 148
+	ldx     #$00
+	lda     #$8C
+	sta     _small+140
+	.dbg	line, "binlit.c", 149
+	ldx     #$00
+	lda     #$8D
+	sta     _small+141
+	.dbg	line, "binlit.c", 150
+	ldx     #$00
+	lda     #$8E
+	sta     _small+142
+	.dbg	line, "binlit.c", 151
+	ldx     #$00
+	lda     #$8F
+	sta     _small+143
+	.dbg	line, "binlit.c", 152
+	ldx     #$00
+	lda     #$90
+	sta     _small+144
+	.dbg	line, "binlit.c", 153
+	ldx     #$00
+	lda     #$91
+	sta     _small+145
+	.dbg	line, "binlit.c", 154
+	ldx     #$00
+	lda     #$92
+	sta     _small+146
+	.dbg	line, "binlit.c", 155
+	ldx     #$00
+	lda     #$93
+	sta     _small+147
+	.dbg	line, "binlit.c", 156
+	ldx     #$00
+	lda     #$94
+	sta     _small+148
+	.dbg	line, "binlit.c", 157
+	ldx     #$00
+	lda     #$95
+	sta     _small+149
+	.dbg	line, "binlit.c", 158
+	ldx     #$00
+	lda     #$96
+	sta     _small+150
+	.dbg	line, "binlit.c", 159
+	ldx     #$00
+	lda     #$97
+	sta     _small+151
+	.dbg	line, "binlit.c", 160
+	ldx     #$00
+	lda     #$98
+	sta     _small+152
+	.dbg	line, "binlit.c", 161
+	ldx     #$00
+	lda     #$99
+	sta     _small+153
+	.dbg	line, "binlit.c", 162
+	ldx     #$00
+	lda     #$9A
+	sta     _small+154
+	.dbg	line, "binlit.c", 163
+	ldx     #$00
+	lda     #$9B
+	sta     _small+155
+	.dbg	line, "binlit.c", 164
+	ldx     #$00
+	lda     #$9C
+	sta     _small+156
+	.dbg	line, "binlit.c", 165
+	ldx     #$00
+	lda     #$9D
+	sta     _small+157
+	.dbg	line, "binlit.c", 166
+	ldx     #$00
+	lda     #$9E
+	sta     _small+158
+	.dbg	line, "binlit.c", 167
+	ldx     #$00
+	lda     #$9F
+	sta     _small+159
+	.dbg	line, "binlit.c", 168
+	ldx     #$00
+	lda     #$A0
+	sta     _small+160
+	.dbg	line, "binlit.c", 169
+	ldx     #$00
+	lda     #$A1
+	sta     _small+161
+	.dbg	line, "binlit.c", 170
+	ldx     #$00
+	lda     #$A2
+	sta     _small+162
+	.dbg	line, "binlit.c", 171
+	ldx     #$00
+	lda     #$A3
+	sta     _small+163
+	.dbg	line, "binlit.c", 172
+	ldx     #$00
+	lda     #$A4
+	sta     _small+164
+	.dbg	line, "binlit.c", 173
+	ldx     #$00
+	lda     #$A5
+	sta     _small+165
+	.dbg	line, "binlit.c", 174
+	ldx     #$00
+	lda     #$A6
+	sta     _small+166
+	.dbg	line, "binlit.c", 175
+	ldx     #$00
+	lda     #$A7
+	sta     _small+167
+	.dbg	line, "binlit.c", 176
+	ldx     #$00
+	lda     #$A8
+	sta     _small+168
+	.dbg	line, "binlit.c", 177
+	ldx     #$00
+	lda     #$A9
+	sta     _small+169
+	.dbg	line, "binlit.c", 178
+	ldx     #$00
+	lda     #$AA
+	sta     _small+170
+	.dbg	line, "binlit.c", 179
+	ldx     #$00
+	lda     #$AB
+	sta     _small+171
+	.dbg	line, "binlit.c", 180
+	ldx     #$00
+	lda     #$AC
+	sta     _small+172
+	.dbg	line, "binlit.c", 181
+	ldx     #$00
+	lda     #$AD
+	sta     _small+173
+	.dbg	line, "binlit.c", 182
+	ldx     #$00
+	lda     #$AE
+	sta     _small+174
+	.dbg	line, "binlit.c", 183
+	ldx     #$00
+	lda     #$AF
+	sta     _small+175
+	.dbg	line, "binlit.c", 184
+	ldx     #$00
+	lda     #$B0
+	sta     _small+176
+	.dbg	line, "binlit.c", 185
+	ldx     #$00
+	lda     #$B1
+	sta     _small+177
+	.dbg	line, "binlit.c", 186
+	ldx     #$00
+	lda     #$B2
+	sta     _small+178
+	.dbg	line, "binlit.c", 187
+	ldx     #$00
+	lda     #$B3
+	sta     _small+179
+	.dbg	line, "binlit.c", 188
+	ldx     #$00
+	lda     #$B4
+	sta     _small+180
+	.dbg	line, "binlit.c", 189
+	ldx     #$00
+	lda     #$B5
+	sta     _small+181
+	.dbg	line, "binlit.c", 190
+	ldx     #$00
+	lda     #$B6
+	sta     _small+182
+	.dbg	line, "binlit.c", 191
+	ldx     #$00
+	lda     #$B7
+	sta     _small+183
+	.dbg	line, "binlit.c", 192
+	ldx     #$00
+	lda     #$B8
+	sta     _small+184
+	.dbg	line, "binlit.c", 193
+	ldx     #$00
+	lda     #$B9
+	sta     _small+185
+	.dbg	line, "binlit.c", 194
+	ldx     #$00
+	lda     #$BA
+	sta     _small+186
+	.dbg	line, "binlit.c", 195
+	ldx     #$00
+	lda     #$BB
+	sta     _small+187
+	.dbg	line, "binlit.c", 196
+	ldx     #$00
+	lda     #$BC
+	sta     _small+188
+	.dbg	line, "binlit.c", 197
+	ldx     #$00
+	lda     #$BD
+	sta     _small+189
+	.dbg	line, "binlit.c", 198
+	ldx     #$00
+	lda     #$BE
+	sta     _small+190
+	.dbg	line, "binlit.c", 199
+	ldx     #$00
+	lda     #$BF
+	sta     _small+191
+	.dbg	line, "binlit.c", 200
+	ldx     #$00
+	lda     #$C0
+	sta     _small+192
+	.dbg	line, "binlit.c", 201
+	ldx     #$00
+	lda     #$C1
+	sta     _small+193
+	.dbg	line, "binlit.c", 202
+	ldx     #$00
+	lda     #$C2
+	sta     _small+194
+	.dbg	line, "binlit.c", 203
+	ldx     #$00
+	lda     #$C3
+	sta     _small+195
+	.dbg	line, "binlit.c", 204
+	ldx     #$00
+	lda     #$C4
+	sta     _small+196
+	.dbg	line, "binlit.c", 205
+	ldx     #$00
+	lda     #$C5
+	sta     _small+197
+	.dbg	line, "binlit.c", 206
+	ldx     #$00
+	lda     #$C6
+	sta     _small+198
+	.dbg	line, "binlit.c", 207
+	ldx     #$00
+	lda     #$C7
+	sta     _small+199
+	.dbg	line, "binlit.c", 208
+	ldx     #$00
+	lda     #$C8
+	sta     _small+200
+	.dbg	line, "binlit.c", 209
+	ldx     #$00
+	lda     #$C9
+	sta     _small+201
+	.dbg	line, "binlit.c", 210
+	ldx     #$00
+	lda     #$CA
+	sta     _small+202
+	.dbg	line, "binlit.c", 211
+	ldx     #$00
+	lda     #$CB
+	sta     _small+203
+	.dbg	line, "binlit.c", 212
+	ldx     #$00
+	lda     #$CC
+	sta     _small+204
+	.dbg	line, "binlit.c", 213
+	ldx     #$00
+	lda     #$CD
+	sta     _small+205
+	.dbg	line, "binlit.c", 214
+	ldx     #$00
+	lda     #$CE
+	sta     _small+206
+	.dbg	line, "binlit.c", 215
+	ldx     #$00
+	lda     #$CF
+	sta     _small+207
+	.dbg	line, "binlit.c", 216
+	ldx     #$00
+	lda     #$D0
+	sta     _small+208
+	.dbg	line, "binlit.c", 217
+	ldx     #$00
+	lda     #$D1
+	sta     _small+209
+	.dbg	line, "binlit.c", 218
+	ldx     #$00
+	lda     #$D2
+	sta     _small+210
+	.dbg	line, "binlit.c", 219
+	ldx     #$00
+	lda     #$D3
+	sta     _small+211
+	.dbg	line, "binlit.c", 220
+	ldx     #$00
+	lda     #$D4
+	sta     _small+212
+	.dbg	line, "binlit.c", 221
+	ldx     #$00
+	lda     #$D5
+	sta     _small+213
+	.dbg	line, "binlit.c", 222
+	ldx     #$00
+	lda     #$D6
+	sta     _small+214
+	.dbg	line, "binlit.c", 223
+	ldx     #$00
+	lda     #$D7
+	sta     _small+215
+	.dbg	line, "binlit.c", 224
+	ldx     #$00
+	lda     #$D8
+	sta     _small+216
+	.dbg	line, "binlit.c", 225
+	ldx     #$00
+	lda     #$D9
+	sta     _small+217
+	.dbg	line, "binlit.c", 226
+	ldx     #$00
+	lda     #$DA
+	sta     _small+218
+	.dbg	line, "binlit.c", 227
+	ldx     #$00
+	lda     #$DB
+	sta     _small+219
+	.dbg	line, "binlit.c", 228
+	ldx     #$00
+	lda     #$DC
+	sta     _small+220
+	.dbg	line, "binlit.c", 229
+	ldx     #$00
+	lda     #$DD
+	sta     _small+221
+	.dbg	line, "binlit.c", 230
+	ldx     #$00
+	lda     #$DE
+	sta     _small+222
+	.dbg	line, "binlit.c", 231
+	ldx     #$00
+	lda     #$DF
+	sta     _small+223
+	.dbg	line, "binlit.c", 232
+	ldx     #$00
+	lda     #$E0
+	sta     _small+224
+	.dbg	line, "binlit.c", 233
+	ldx     #$00
+	lda     #$E1
+	sta     _small+225
+	.dbg	line, "binlit.c", 234
+	ldx     #$00
+	lda     #$E2
+	sta     _small+226
+	.dbg	line, "binlit.c", 235
+	ldx     #$00
+	lda     #$E3
+	sta     _small+227
+	.dbg	line, "binlit.c", 236
+	ldx     #$00
+	lda     #$E4
+	sta     _small+228
+	.dbg	line, "binlit.c", 237
+	ldx     #$00
+	lda     #$E5
+	sta     _small+229
+	.dbg	line, "binlit.c", 238
+	ldx     #$00
+	lda     #$E6
+	sta     _small+230
+	.dbg	line, "binlit.c", 239
+	ldx     #$00
+	lda     #$E7
+	sta     _small+231
+	.dbg	line, "binlit.c", 240
+	ldx     #$00
+	lda     #$E8
+	sta     _small+232
+	.dbg	line, "binlit.c", 241
+	ldx     #$00
+	lda     #$E9
+	sta     _small+233
+	.dbg	line, "binlit.c", 242
+	ldx     #$00
+	lda     #$EA
+	sta     _small+234
+	.dbg	line, "binlit.c", 243
+	ldx     #$00
+	lda     #$EB
+	sta     _small+235
+	.dbg	line, "binlit.c", 244
+	ldx     #$00
+	lda     #$EC
+	sta     _small+236
+	.dbg	line, "binlit.c", 245
+	ldx     #$00
+	lda     #$ED
+	sta     _small+237
+	.dbg	line, "binlit.c", 246
+	ldx     #$00
+	lda     #$EE
+	sta     _small+238
+	.dbg	line, "binlit.c", 247
+	ldx     #$00
+	lda     #$EF
+	sta     _small+239
+	.dbg	line, "binlit.c", 248
+	ldx     #$00
+	lda     #$F0
+	sta     _small+240
+	.dbg	line, "binlit.c", 249
+	ldx     #$00
+	lda     #$F1
+	sta     _small+241
+	.dbg	line, "binlit.c", 250
+	ldx     #$00
+	lda     #$F2
+	sta     _small+242
+	.dbg	line, "binlit.c", 251
+	ldx     #$00
+	lda     #$F3
+	sta     _small+243
+	.dbg	line, "binlit.c", 252
+	ldx     #$00
+	lda     #$F4
+	sta     _small+244
+	.dbg	line, "binlit.c", 253
+	ldx     #$00
+	lda     #$F5
+	sta     _small+245
+	.dbg	line, "binlit.c", 254
+	ldx     #$00
+	lda     #$F6
+	sta     _small+246
+	.dbg	line, "binlit.c", 255
+	ldx     #$00
+	lda     #$F7
+	sta     _small+247
+	.dbg	line, "binlit.c", 256
+	ldx     #$00
+	lda     #$F8
+	sta     _small+248
+	.dbg	line, "binlit.c", 257
+	ldx     #$00
+	lda     #$F9
+	sta     _small+249
+	.dbg	line, "binlit.c", 258
+	ldx     #$00
+	lda     #$FA
+	sta     _small+250
+	.dbg	line, "binlit.c", 259
+	ldx     #$00
+	lda     #$FB
+	sta     _small+251
+	.dbg	line, "binlit.c", 260
+	ldx     #$00
+	lda     #$FC
+	sta     _small+252
+	.dbg	line, "binlit.c", 261
+	ldx     #$00
+	lda     #$FD
+	sta     _small+253
+	.dbg	line, "binlit.c", 262
+	ldx     #$00
+	lda     #$FE
+	sta     _small+254
+	.dbg	line, "binlit.c", 263
+	ldx     #$00
+	lda     #$FF
+	sta     _small+255
+	.dbg	line, "binlit.c", 265
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+	jmp     L0002
+	.dbg	line, "binlit.c", 266
+L0005:	lda     #<(_small)
+	ldx     #>(_small)
+	ldy     #$00
+	clc
+	adc     (sp),y
+	pha
+	txa
+	iny
+	adc     (sp),y
+	tax
+	pla
+	ldy     #$00
+	jsr     ldauidx
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosneax
+	jeq     L0006
+	.dbg	line, "binlit.c", 267
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+	.dbg	line, "binlit.c", 265
+L0006:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$01
+	jsr     boolult
+	jne     L0005
+	.dbg	line, "binlit.c", 270
+	ldx     #$FF
+	lda     #$00
+	sta     _big
+	stx     _big+1
+	.dbg	line, "binlit.c", 271
+	ldx     #$FF
+	lda     #$01
+	sta     _big+2
+	stx     _big+2+1
+	.dbg	line, "binlit.c", 272
+	ldx     #$FF
+	lda     #$02
+	sta     _big+4
+	stx     _big+4+1
+	.dbg	line, "binlit.c", 273
+	ldx     #$FF
+	lda     #$03
+	sta     _big+6
+	stx     _big+6+1
+	.dbg	line, "binlit.c", 274
+	ldx     #$FF
+	lda     #$04
+	sta     _big+8
+	stx     _big+8+1
+	.dbg	line, "binlit.c", 275
+	ldx     #$FF
+	lda     #$05
+	sta     _big+10
+	stx     _big+10+1
+	.dbg	line, "binlit.c", 276
+	ldx     #$FF
+	lda     #$06
+	sta     _big+12
+	stx     _big+12+1
+	.dbg	line, "binlit.c", 277
+	ldx     #$FF
+	lda     #$07
+	sta     _big+14
+	stx     _big+14+1
+	.dbg	line, "binlit.c", 278
+	ldx     #$FF
+	lda     #$08
+	sta     _big+16
+	stx     _big+16+1
+	.dbg	line, "binlit.c", 279
+	ldx     #$FF
+	lda     #$09
+	sta     _big+18
+	stx     _big+18+1
+	.dbg	line, "binlit.c", 280
+	ldx     #$FF
+	lda     #$0A
+	sta     _big+20
+	stx     _big+20+1
+	.dbg	line, "binlit.c", 281
+	ldx     #$FF
+	lda     #$0B
+	sta     _big+22
+	stx     _big+22+1
+	.dbg	line, "binlit.c", 282
+	ldx     #$FF
+	lda     #$0C
+	sta     _big+24
+	stx     _big+24+1
+	.dbg	line, "binlit.c", 283
+	ldx     #$FF
+	lda     #$0D
+	sta     _big+26
+	stx     _big+26+1
+	.dbg	line, "binlit.c", 284
+	ldx     #$FF
+	lda     #$0E
+	sta     _big+28
+	stx     _big+28+1
+	.dbg	line, "binlit.c", 285
+	ldx     #$FF
+	lda     #$0F
+	sta     _big+30
+	stx     _big+30+1
+	.dbg	line, "binlit.c", 286
+	ldx     #$FF
+	lda     #$10
+	sta     _big+32
+	stx     _big+32+1
+	.dbg	line, "binlit.c", 287
+	ldx     #$FF
+	lda     #$11
+	sta     _big+34
+	stx     _big+34+1
+	.dbg	line, "binlit.c", 288
+	ldx     #$FF
+	lda     #$12
+	sta     _big+36
+	stx     _big+36+1
+	.dbg	line, "binlit.c", 289
+	ldx     #$FF
+	lda     #$13
+	sta     _big+38
+	stx     _big+38+1
+	.dbg	line, "binlit.c", 290
+	ldx     #$FF
+	lda     #$14
+	sta     _big+40
+	stx     _big+40+1
+	.dbg	line, "binlit.c", 291
+	ldx     #$FF
+	lda     #$15
+	sta     _big+42
+	stx     _big+42+1
+	.dbg	line, "binlit.c", 292
+	ldx     #$FF
+	lda     #$16
+	sta     _big+44
+	stx     _big+44+1
+	.dbg	line, "binlit.c", 293
+	ldx     #$FF
+	lda     #$17
+	sta     _big+46
+	stx     _big+46+1
+	.dbg	line, "binlit.c", 294
+	ldx     #$FF
+	lda     #$18
+	sta     _big+48
+	stx     _big+48+1
+	.dbg	line, "binlit.c", 295
+	ldx     #$FF
+	lda     #$19
+	sta     _big+50
+	stx     _big+50+1
+	.dbg	line, "binlit.c", 296
+	ldx     #$FF
+	lda     #$1A
+	sta     _big+52
+	stx     _big+52+1
+	.dbg	line, "binlit.c", 297
+	ldx     #$FF
+	lda     #$1B
+	sta     _big+54
+	stx     _big+54+1
+	.dbg	line, "binlit.c", 298
+	ldx     #$FF
+	lda     #$1C
+	sta     _big+56
+	stx     _big+56+1
+	.dbg	line, "binlit.c", 299
+	ldx     #$FF
+	lda     #$1D
+	sta     _big+58
+	stx     _big+58+1
+	.dbg	line, "binlit.c", 300
+	ldx     #$FF
+	lda     #$1E
+	sta     _big+60
+	stx     _big+60+1
+	.dbg	line, "binlit.c", 301
+	ldx     #$FF
+	lda     #$1F
+	sta     _big+62
+	stx     _big+62+1
+	.dbg	line, "binlit.c", 302
+	ldx     #$FF
+	lda     #$20
+	sta     _big+64
+	stx     _big+64+1
+	.dbg	line, "binlit.c", 303
+	ldx     #$FF
+	lda     #$21
+	sta     _big+66
+	stx     _big+66+1
+	.dbg	line, "binlit.c", 304
+	ldx     #$FF
+	lda     #$22
+	sta     _big+68
+	stx     _big+68+1
+	.dbg	line, "binlit.c", 305
+	ldx     #$FF
+	lda     #$23
+	sta     _big+70
+	stx     _big+70+1
+	.dbg	line, "binlit.c", 306
+	ldx     #$FF
+	lda     #$24
+	sta     _big+72
+	stx     _big+72+1
+	.dbg	line, "binlit.c", 307
+	ldx     #$FF
+	lda     #$25
+	sta     _big+74
+	stx     _big+74+1
+	.dbg	line, "binlit.c", 308
+	ldx     #$FF
+	lda     #$26
+	sta     _big+76
+	stx     _big+76+1
+	.dbg	line, "binlit.c", 309
+	ldx     #$FF
+	lda     #$27
+	sta     _big+78
+	stx     _big+78+1
+	.dbg	line, "binlit.c", 310
+	ldx     #$FF
+	lda     #$28
+	sta     _big+80
+	stx     _big+80+1
+	.dbg	line, "binlit.c", 311
+	ldx     #$FF
+	lda     #$29
+	sta     _big+82
+	stx     _big+82+1
+	.dbg	line, "binlit.c", 312
+	ldx     #$FF
+	lda     #$2A
+	sta     _big+84
+	stx     _big+84+1
+	.dbg	line, "binlit.c", 313
+	ldx     #$FF
+	lda     #$2B
+	sta     _big+86
+	stx     _big+86+1
+	.dbg	line, "binlit.c", 314
+	ldx     #$FF
+	lda     #$2C
+	sta     _big+88
+	stx     _big+88+1
+	.dbg	line, "binlit.c", 315
+	ldx     #$FF
+	lda     #$2D
+	sta     _big+90
+	stx     _big+90+1
+	.dbg	line, "binlit.c", 316
+	ldx     #$FF
+	lda     #$2E
+	sta     _big+92
+	stx     _big+92+1
+	.dbg	line, "binlit.c", 317
+	ldx     #$FF
+	lda     #$2F
+	sta     _big+94
+	stx     _big+94+1
+	.dbg	line, "binlit.c", 318
+	ldx     #$FF
+	lda     #$30
+	sta     _big+96
+	stx     _big+96+1
+	.dbg	line, "binlit.c", 319
+	ldx     #$FF
+	lda     #$31
+	sta     _big+98
+	stx     _big+98+1
+	.dbg	line, "binlit.c", 320
+	ldx     #$FF
+	lda     #$32
+	sta     _big+100
+	stx     _big+100+1
+	.dbg	line, "binlit.c", 321
+	ldx     #$FF
+	lda     #$33
+	sta     _big+102
+	stx     _big+102+1
+	.dbg	line, "binlit.c", 322
+	ldx     #$FF
+	lda     #$34
+	sta     _big+104
+	stx     _big+104+1
+	.dbg	line, "binlit.c", 323
+	ldx     #$FF
+	lda     #$35
+	sta     _big+106
+	stx     _big+106+1
+	.dbg	line, "binlit.c", 324
+	ldx     #$FF
+	lda     #$36
+	sta     _big+108
+	stx     _big+108+1
+	.dbg	line, "binlit.c", 325
+	ldx     #$FF
+	lda     #$37
+	sta     _big+110
+	stx     _big+110+1
+	.dbg	line, "binlit.c", 326
+	ldx     #$FF
+	lda     #$38
+	sta     _big+112
+	stx     _big+112+1
+	.dbg	line, "binlit.c", 327
+	ldx     #$FF
+	lda     #$39
+	sta     _big+114
+	stx     _big+114+1
+	.dbg	line, "binlit.c", 328
+	ldx     #$FF
+	lda     #$3A
+	sta     _big+116
+	stx     _big+116+1
+	.dbg	line, "binlit.c", 329
+	ldx     #$FF
+	lda     #$3B
+	sta     _big+118
+	stx     _big+118+1
+	.dbg	line, "binlit.c", 330
+	ldx     #$FF
+	lda     #$3C
+	sta     _big+120
+	stx     _big+120+1
+	.dbg	line, "binlit.c", 331
+	ldx     #$FF
+	lda     #$3D
+	sta     _big+122
+	stx     _big+122+1
+	.dbg	line, "binlit.c", 332
+	ldx     #$FF
+	lda     #$3E
+	sta     _big+124
+	stx     _big+124+1
+	.dbg	line, "binlit.c", 333
+	ldx     #$FF
+	lda     #$3F
+	sta     _big+126
+	stx     _big+126+1
+	.dbg	line, "binlit.c", 334
+	ldx     #$FF
+	lda     #$40
+	sta     _big+128
+	stx     _big+128+1
+	.dbg	line, "binlit.c", 335
+	ldx     #$FF
+	lda     #$41
+	sta     _big+130
+	stx     _big+130+1
+	.dbg	line, "binlit.c", 336
+	ldx     #$FF
+	lda     #$42
+	sta     _big+132
+	stx     _big+132+1
+	.dbg	line, "binlit.c", 337
+	ldx     #$FF
+	lda     #$43
+	sta     _big+134
+	stx     _big+134+1
+	.dbg	line, "binlit.c", 338
+	ldx     #$FF
+	lda     #$44
+	sta     _big+136
+	stx     _big+136+1
+	.dbg	line, "binlit.c", 339
+	ldx     #$FF
+	lda     #$45
+	sta     _big+138
+	stx     _big+138+1
+	.dbg	line, "binlit.c", 340
+	ldx     #$FF
+	lda     #$46
+	sta     _big+140
+	stx     _big+140+1
+	.dbg	line, "binlit.c", 341
+	ldx     #$FF
+	lda     #$47
+	sta     _big+142
+	stx     _big+142+1
+	.dbg	line, "binlit.c", 342
+	ldx     #$FF
+	lda     #$48
+	sta     _big+144
+	stx     _big+144+1
+	.dbg	line, "binlit.c", 343
+	ldx     #$FF
+	lda     #$49
+	sta     _big+146
+	stx     _big+146+1
+	.dbg	line, "binlit.c", 344
+	ldx     #$FF
+	lda     #$4A
+	sta     _big+148
+	stx     _big+148+1
+	.dbg	line, "binlit.c", 345
+	ldx     #$FF
+	lda     #$4B
+	sta     _big+150
+	stx     _big+150+1
+	.dbg	line, "binlit.c", 346
+	ldx     #$FF
+	lda     #$4C
+	sta     _big+152
+	stx     _big+152+1
+	.dbg	line, "binlit.c", 347
+	ldx     #$FF
+	lda     #$4D
+	sta     _big+154
+	stx     _big+154+1
+	.dbg	line, "binlit.c", 348
+	ldx     #$FF
+	lda     #$4E
+	sta     _big+156
+	stx     _big+156+1
+	.dbg	line, "binlit.c", 349
+	ldx     #$FF
+	lda     #$4F
+	sta     _big+158
+	stx     _big+158+1
+	.dbg	line, "binlit.c", 350
+	ldx     #$FF
+	lda     #$50
+	sta     _big+160
+	stx     _big+160+1
+	.dbg	line, "binlit.c", 351
+	ldx     #$FF
+	lda     #$51
+	sta     _big+162
+	stx     _big+162+1
+	.dbg	line, "binlit.c", 352
+	ldx     #$FF
+	lda     #$52
+	sta     _big+164
+	stx     _big+164+1
+	.dbg	line, "binlit.c", 353
+	ldx     #$FF
+	lda     #$53
+	sta     _big+166
+	stx     _big+166+1
+	.dbg	line, "binlit.c", 354
+	ldx     #$FF
+	lda     #$54
+	sta     _big+168
+	stx     _big+168+1
+	.dbg	line, "binlit.c", 355
+	ldx     #$FF
+	lda     #$55
+	sta     _big+170
+	stx     _big+170+1
+	.dbg	line, "binlit.c", 356
+	ldx     #$FF
+	lda     #$56
+	sta     _big+172
+	stx     _big+172+1
+	.dbg	line, "binlit.c", 357
+	ldx     #$FF
+	lda     #$57
+	sta     _big+174
+	stx     _big+174+1
+	.dbg	line, "binlit.c", 358
+	ldx     #$FF
+	lda     #$58
+	sta     _big+176
+	stx     _big+176+1
+	.dbg	line, "binlit.c", 359
+	ldx     #$FF
+	lda     #$59
+	sta     _big+178
+	stx     _big+178+1
+	.dbg	line, "binlit.c", 360
+	ldx     #$FF
+	lda     #$5A
+	sta     _big+180
+	stx     _big+180+1
+	.dbg	line, "binlit.c", 361
+	ldx     #$FF
+	lda     #$5B
+	sta     _big+182
+	stx     _big+182+1
+	.dbg	line, "binlit.c", 362
+	ldx     #$FF
+	lda     #$5C
+	sta     _big+184
+	stx     _big+184+1
+	.dbg	line, "binlit.c", 363
+	ldx     #$FF
+	lda     #$5D
+	sta     _big+186
+	stx     _big+186+1
+	.dbg	line, "binlit.c", 364
+	ldx     #$FF
+	lda     #$5E
+	sta     _big+188
+	stx     _big+188+1
+	.dbg	line, "binlit.c", 365
+	ldx     #$FF
+	lda     #$5F
+	sta     _big+190
+	stx     _big+190+1
+	.dbg	line, "binlit.c", 366
+	ldx     #$FF
+	lda     #$60
+	sta     _big+192
+	stx     _big+192+1
+	.dbg	line, "binlit.c", 367
+	ldx     #$FF
+	lda     #$61
+	sta     _big+194
+	stx     _big+194+1
+	.dbg	line, "binlit.c", 368
+	ldx     #$FF
+	lda     #$62
+	sta     _big+196
+	stx     _big+196+1
+	.dbg	line, "binlit.c", 369
+	ldx     #$FF
+	lda     #$63
+	sta     _big+198
+	stx     _big+198+1
+	.dbg	line, "binlit.c", 370
+	ldx     #$FF
+	lda     #$64
+	sta     _big+200
+	stx     _big+200+1
+	.dbg	line, "binlit.c", 371
+	ldx     #$FF
+	lda     #$65
+	sta     _big+202
+	stx     _big+202+1
+	.dbg	line, "binlit.c", 372
+	ldx     #$FF
+	lda     #$66
+	sta     _big+204
+	stx     _big+204+1
+	.dbg	line, "binlit.c", 373
+	ldx     #$FF
+	lda     #$67
+	sta     _big+206
+	stx     _big+206+1
+	.dbg	line, "binlit.c", 374
+	ldx     #$FF
+	lda     #$68
+	sta     _big+208
+	stx     _big+208+1
+	.dbg	line, "binlit.c", 375
+	ldx     #$FF
+	lda     #$69
+	sta     _big+210
+	stx     _big+210+1
+	.dbg	line, "binlit.c", 376
+	ldx     #$FF
+	lda     #$6A
+	sta     _big+212
+	stx     _big+212+1
+	.dbg	line, "binlit.c", 377
+	ldx     #$FF
+	lda     #$6B
+	sta     _big+214
+	stx     _big+214+1
+	.dbg	line, "binlit.c", 378
+	ldx     #$FF
+	lda     #$6C
+	sta     _big+216
+	stx     _big+216+1
+	.dbg	line, "binlit.c", 379
+	ldx     #$FF
+	lda     #$6D
+	sta     _big+218
+	stx     _big+218+1
+	.dbg	line, "binlit.c", 380
+	ldx     #$FF
+	lda     #$6E
+	sta     _big+220
+	stx     _big+220+1
+	.dbg	line, "binlit.c", 381
+	ldx     #$FF
+	lda     #$6F
+	sta     _big+222
+	stx     _big+222+1
+	.dbg	line, "binlit.c", 382
+	ldx     #$FF
+	lda     #$70
+	sta     _big+224
+	stx     _big+224+1
+	.dbg	line, "binlit.c", 383
+	ldx     #$FF
+	lda     #$71
+	sta     _big+226
+	stx     _big+226+1
+	.dbg	line, "binlit.c", 384
+	ldx     #$FF
+	lda     #$72
+	sta     _big+228
+	stx     _big+228+1
+	.dbg	line, "binlit.c", 385
+	ldx     #$FF
+	lda     #$73
+	sta     _big+230
+	stx     _big+230+1
+	.dbg	line, "binlit.c", 386
+	ldx     #$FF
+	lda     #$74
+	sta     _big+232
+	stx     _big+232+1
+	.dbg	line, "binlit.c", 387
+	ldx     #$FF
+	lda     #$75
+	sta     _big+234
+	stx     _big+234+1
+	.dbg	line, "binlit.c", 388
+	ldx     #$FF
+	lda     #$76
+	sta     _big+236
+	stx     _big+236+1
+	.dbg	line, "binlit.c", 389
+	ldx     #$FF
+	lda     #$77
+	sta     _big+238
+	stx     _big+238+1
+	.dbg	line, "binlit.c", 390
+	ldx     #$FF
+	lda     #$78
+	sta     _big+240
+	stx     _big+240+1
+	.dbg	line, "binlit.c", 391
+	ldx     #$FF
+	lda     #$79
+	sta     _big+242
+	stx     _big+242+1
+	.dbg	line, "binlit.c", 392
+	ldx     #$FF
+	lda     #$7A
+	sta     _big+244
+	stx     _big+244+1
+	.dbg	line, "binlit.c", 393
+	ldx     #$FF
+	lda     #$7B
+	sta     _big+246
+	stx     _big+246+1
+	.dbg	line, "binlit.c", 394
+	ldx     #$FF
+	lda     #$7C
+	sta     _big+248
+	stx     _big+248+1
+	.dbg	line, "binlit.c", 395
+	ldx     #$FF
+	lda     #$7D
+	sta     _big+250
+	stx     _big+250+1
+	.dbg	line, "binlit.c", 396
+	ldx     #$FF
+	lda     #$7E
+	sta     _big+252
+	stx     _big+252+1
+	.dbg	line, "binlit.c", 397
+	ldx     #$FF
+	lda     #$7F
+	sta     _big+254
+	stx     _big+254+1
+	.dbg	line, "binlit.c", 398
+	ldx     #$FF
+	lda     #$80
+	sta     _big+256
+	stx     _big+256+1
+	.dbg	line, "binlit.c", 399
+	ldx     #$FF
+	lda     #$81
+	sta     _big+258
+	stx     _big+258+1
+	.dbg	line, "binlit.c", 400
+	ldx     #$FF
+	lda     #$82
+	sta     _big+260
+	stx     _big+260+1
+	.dbg	line, "binlit.c", 401
+	ldx     #$FF
+	lda     #$83
+	sta     _big+262
+	stx     _big+262+1
+	.dbg	line, "binlit.c", 402
+	ldx     #$FF
+	lda     #$84
+	sta     _big+264
+	stx     _big+264+1
+	.dbg	line, "binlit.c", 403
+	ldx     #$FF
+	lda     #$85
+	sta     _big+266
+	stx     _big+266+1
+	.dbg	line, "binlit.c", 404
+	ldx     #$FF
+	lda     #$86
+	sta     _big+268
+	stx     _big+268+1
+	.dbg	line, "binlit.c", 405
+	ldx     #$FF
+	lda     #$87
+	sta     _big+270
+	stx     _big+270+1
+	.dbg	line, "binlit.c", 406
+	ldx     #$FF
+	lda     #$88
+	sta     _big+272
+	stx     _big+272+1
+	.dbg	line, "binlit.c", 407
+	ldx     #$FF
+	lda     #$89
+	sta     _big+274
+	stx     _big+274+1
+	.dbg	line, "binlit.c", 408
+	ldx     #$FF
+	lda     #$8A
+	sta     _big+276
+	stx     _big+276+1
+	.dbg	line, "binlit.c", 409
+	ldx     #$FF
+	lda     #$8B
+	sta     _big+278
+	stx     _big+278+1
+	.dbg	line, "binlit.c", 410
+	ldx     #$FF
+	lda     #$8C
+	sta     _big+280
+	stx     _big+280+1
+	.dbg	line, "binlit.c", 411
+	ldx     #$FF
+	lda     #$8D
+	sta     _big+282
+	stx     _big+282+1
+	.dbg	line, "binlit.c", 412
+	ldx     #$FF
+	lda     #$8E
+	sta     _big+284
+	stx     _big+284+1
+	.dbg	line, "binlit.c", 413
+	ldx     #$FF
+	lda     #$8F
+	sta     _big+286
+	stx     _big+286+1
+	.dbg	line, "binlit.c", 414
+	ldx     #$FF
+	lda     #$90
+	sta     _big+288
+	stx     _big+288+1
+	.dbg	line, "binlit.c", 415
+	ldx     #$FF
+	lda     #$91
+	sta     _big+290
+	stx     _big+290+1
+	.dbg	line, "binlit.c", 416
+	ldx     #$FF
+	lda     #$92
+	sta     _big+292
+	stx     _big+292+1
+	.dbg	line, "binlit.c", 417
+	ldx     #$FF
+	lda     #$93
+	sta     _big+294
+	stx     _big+294+1
+	.dbg	line, "binlit.c", 418
+	ldx     #$FF
+	lda     #$94
+	sta     _big+296
+	stx     _big+296+1
+	.dbg	line, "binlit.c", 419
+	ldx     #$FF
+	lda     #$95
+	sta     _big+298
+	stx     _big+298+1
+	.dbg	line, "binlit.c", 420
+	ldx     #$FF
+	lda     #$96
+	sta     _big+300
+	stx     _big+300+1
+	.dbg	line, "binlit.c", 421
+	ldx     #$FF
+	lda     #$97
+	sta     _big+302
+	stx     _big+302+1
+	.dbg	line, "binlit.c", 422
+	ldx     #$FF
+	lda     #$98
+	sta     _big+304
+	stx     _big+304+1
+	.dbg	line, "binlit.c", 423
+	ldx     #$FF
+	lda     #$99
+	sta     _big+306
+	stx     _big+306+1
+	.dbg	line, "binlit.c", 424
+	ldx     #$FF
+	lda     #$9A
+	sta     _big+308
+	stx     _big+308+1
+	.dbg	line, "binlit.c", 425
+	ldx     #$FF
+	lda     #$9B
+	sta     _big+310
+	stx     _big+310+1
+	.dbg	line, "binlit.c", 426
+	ldx     #$FF
+	lda     #$9C
+	sta     _big+312
+	stx     _big+312+1
+	.dbg	line, "binlit.c", 427
+	ldx     #$FF
+	lda     #$9D
+	sta     _big+314
+	stx     _big+314+1
+	.dbg	line, "binlit.c", 428
+	ldx     #$FF
+	lda     #$9E
+	sta     _big+316
+	stx     _big+316+1
+	.dbg	line, "binlit.c", 429
+	ldx     #$FF
+	lda     #$9F
+	sta     _big+318
+	stx     _big+318+1
+	.dbg	line, "binlit.c", 430
+	ldx     #$FF
+	lda     #$A0
+	sta     _big+320
+	stx     _big+320+1
+	.dbg	line, "binlit.c", 431
+	ldx     #$FF
+	lda     #$A1
+	sta     _big+322
+	stx     _big+322+1
+	.dbg	line, "binlit.c", 432
+	ldx     #$FF
+	lda     #$A2
+	sta     _big+324
+	stx     _big+324+1
+	.dbg	line, "binlit.c", 433
+	ldx     #$FF
+	lda     #$A3
+	sta     _big+326
+	stx     _big+326+1
+	.dbg	line, "binlit.c", 434
+	ldx     #$FF
+	lda     #$A4
+	sta     _big+328
+	stx     _big+328+1
+	.dbg	line, "binlit.c", 435
+	ldx     #$FF
+	lda     #$A5
+	sta     _big+330
+	stx     _big+330+1
+	.dbg	line, "binlit.c", 436
+	ldx     #$FF
+	lda     #$A6
+	sta     _big+332
+	stx     _big+332+1
+	.dbg	line, "binlit.c", 437
+	ldx     #$FF
+	lda     #$A7
+	sta     _big+334
+	stx     _big+334+1
+	.dbg	line, "binlit.c", 438
+	ldx     #$FF
+	lda     #$A8
+	sta     _big+336
+	stx     _big+336+1
+	.dbg	line, "binlit.c", 439
+	ldx     #$FF
+	lda     #$A9
+	sta     _big+338
+	stx     _big+338+1
+	.dbg	line, "binlit.c", 440
+	ldx     #$FF
+	lda     #$AA
+	sta     _big+340
+	stx     _big+340+1
+	.dbg	line, "binlit.c", 441
+	ldx     #$FF
+	lda     #$AB
+	sta     _big+342
+	stx     _big+342+1
+	.dbg	line, "binlit.c", 442
+	ldx     #$FF
+	lda     #$AC
+	sta     _big+344
+	stx     _big+344+1
+	.dbg	line, "binlit.c", 443
+	ldx     #$FF
+	lda     #$AD
+	sta     _big+346
+	stx     _big+346+1
+	.dbg	line, "binlit.c", 444
+	ldx     #$FF
+	lda     #$AE
+	sta     _big+348
+	stx     _big+348+1
+	.dbg	line, "binlit.c", 445
+	ldx     #$FF
+	lda     #$AF
+	sta     _big+350
+	stx     _big+350+1
+	.dbg	line, "binlit.c", 446
+	ldx     #$FF
+	lda     #$B0
+	sta     _big+352
+	stx     _big+352+1
+	.dbg	line, "binlit.c", 447
+	ldx     #$FF
+	lda     #$B1
+	sta     _big+354
+	stx     _big+354+1
+	.dbg	line, "binlit.c", 448
+	ldx     #$FF
+	lda     #$B2
+	sta     _big+356
+	stx     _big+356+1
+	.dbg	line, "binlit.c", 449
+	ldx     #$FF
+	lda     #$B3
+	sta     _big+358
+	stx     _big+358+1
+	.dbg	line, "binlit.c", 450
+	ldx     #$FF
+	lda     #$B4
+	sta     _big+360
+	stx     _big+360+1
+	.dbg	line, "binlit.c", 451
+	ldx     #$FF
+	lda     #$B5
+	sta     _big+362
+	stx     _big+362+1
+	.dbg	line, "binlit.c", 452
+	ldx     #$FF
+	lda     #$B6
+	sta     _big+364
+	stx     _big+364+1
+	.dbg	line, "binlit.c", 453
+	ldx     #$FF
+	lda     #$B7
+	sta     _big+366
+	stx     _big+366+1
+	.dbg	line, "binlit.c", 454
+	ldx     #$FF
+	lda     #$B8
+	sta     _big+368
+	stx     _big+368+1
+	.dbg	line, "binlit.c", 455
+	ldx     #$FF
+	lda     #$B9
+	sta     _big+370
+	stx     _big+370+1
+	.dbg	line, "binlit.c", 456
+	ldx     #$FF
+	lda     #$BA
+	sta     _big+372
+	stx     _big+372+1
+	.dbg	line, "binlit.c", 457
+	ldx     #$FF
+	lda     #$BB
+	sta     _big+374
+	stx     _big+374+1
+	.dbg	line, "binlit.c", 458
+	ldx     #$FF
+	lda     #$BC
+	sta     _big+376
+	stx     _big+376+1
+	.dbg	line, "binlit.c", 459
+	ldx     #$FF
+	lda     #$BD
+	sta     _big+378
+	stx     _big+378+1
+	.dbg	line, "binlit.c", 460
+	ldx     #$FF
+	lda     #$BE
+	sta     _big+380
+	stx     _big+380+1
+	.dbg	line, "binlit.c", 461
+	ldx     #$FF
+	lda     #$BF
+	sta     _big+382
+	stx     _big+382+1
+	.dbg	line, "binlit.c", 462
+	ldx     #$FF
+	lda     #$C0
+	sta     _big+384
+	stx     _big+384+1
+	.dbg	line, "binlit.c", 463
+	ldx     #$FF
+	lda     #$C1
+	sta     _big+386
+	stx     _big+386+1
+	.dbg	line, "binlit.c", 464
+	ldx     #$FF
+	lda     #$C2
+	sta     _big+388
+	stx     _big+388+1
+	.dbg	line, "binlit.c", 465
+	ldx     #$FF
+	lda     #$C3
+	sta     _big+390
+	stx     _big+390+1
+	.dbg	line, "binlit.c", 466
+	ldx     #$FF
+	lda     #$C4
+	sta     _big+392
+	stx     _big+392+1
+	.dbg	line, "binlit.c", 467
+	ldx     #$FF
+	lda     #$C5
+	sta     _big+394
+	stx     _big+394+1
+	.dbg	line, "binlit.c", 468
+	ldx     #$FF
+	lda     #$C6
+	sta     _big+396
+	stx     _big+396+1
+	.dbg	line, "binlit.c", 469
+	ldx     #$FF
+	lda     #$C7
+	sta     _big+398
+	stx     _big+398+1
+	.dbg	line, "binlit.c", 470
+	ldx     #$FF
+	lda     #$C8
+	sta     _big+400
+	stx     _big+400+1
+	.dbg	line, "binlit.c", 471
+	ldx     #$FF
+	lda     #$C9
+	sta     _big+402
+	stx     _big+402+1
+	.dbg	line, "binlit.c", 472
+	ldx     #$FF
+	lda     #$CA
+	sta     _big+404
+	stx     _big+404+1
+	.dbg	line, "binlit.c", 473
+	ldx     #$FF
+	lda     #$CB
+	sta     _big+406
+	stx     _big+406+1
+	.dbg	line, "binlit.c", 474
+	ldx     #$FF
+	lda     #$CC
+	sta     _big+408
+	stx     _big+408+1
+	.dbg	line, "binlit.c", 475
+	ldx     #$FF
+	lda     #$CD
+	sta     _big+410
+	stx     _big+410+1
+	.dbg	line, "binlit.c", 476
+	ldx     #$FF
+	lda     #$CE
+	sta     _big+412
+	stx     _big+412+1
+	.dbg	line, "binlit.c", 477
+	ldx     #$FF
+	lda     #$CF
+	sta     _big+414
+	stx     _big+414+1
+	.dbg	line, "binlit.c", 478
+	ldx     #$FF
+	lda     #$D0
+	sta     _big+416
+	stx     _big+416+1
+	.dbg	line, "binlit.c", 479
+	ldx     #$FF
+	lda     #$D1
+	sta     _big+418
+	stx     _big+418+1
+	.dbg	line, "binlit.c", 480
+	ldx     #$FF
+	lda     #$D2
+	sta     _big+420
+	stx     _big+420+1
+	.dbg	line, "binlit.c", 481
+	ldx     #$FF
+	lda     #$D3
+	sta     _big+422
+	stx     _big+422+1
+	.dbg	line, "binlit.c", 482
+	ldx     #$FF
+	lda     #$D4
+	sta     _big+424
+	stx     _big+424+1
+	.dbg	line, "binlit.c", 483
+	ldx     #$FF
+	lda     #$D5
+	sta     _big+426
+	stx     _big+426+1
+	.dbg	line, "binlit.c", 484
+	ldx     #$FF
+	lda     #$D6
+	sta     _big+428
+	stx     _big+428+1
+	.dbg	line, "binlit.c", 485
+	ldx     #$FF
+	lda     #$D7
+	sta     _big+430
+	stx     _big+430+1
+	.dbg	line, "binlit.c", 486
+	ldx     #$FF
+	lda     #$D8
+	sta     _big+432
+	stx     _big+432+1
+	.dbg	line, "binlit.c", 487
+	ldx     #$FF
+	lda     #$D9
+	sta     _big+434
+	stx     _big+434+1
+	.dbg	line, "binlit.c", 488
+	ldx     #$FF
+	lda     #$DA
+	sta     _big+436
+	stx     _big+436+1
+	.dbg	line, "binlit.c", 489
+	ldx     #$FF
+	lda     #$DB
+	sta     _big+438
+	stx     _big+438+1
+	.dbg	line, "binlit.c", 490
+	ldx     #$FF
+	lda     #$DC
+	sta     _big+440
+	stx     _big+440+1
+	.dbg	line, "binlit.c", 491
+	ldx     #$FF
+	lda     #$DD
+	sta     _big+442
+	stx     _big+442+1
+	.dbg	line, "binlit.c", 492
+	ldx     #$FF
+	lda     #$DE
+	sta     _big+444
+	stx     _big+444+1
+	.dbg	line, "binlit.c", 493
+	ldx     #$FF
+	lda     #$DF
+	sta     _big+446
+	stx     _big+446+1
+	.dbg	line, "binlit.c", 494
+	ldx     #$FF
+	lda     #$E0
+	sta     _big+448
+	stx     _big+448+1
+	.dbg	line, "binlit.c", 495
+	ldx     #$FF
+	lda     #$E1
+	sta     _big+450
+	stx     _big+450+1
+	.dbg	line, "binlit.c", 496
+	ldx     #$FF
+	lda     #$E2
+	sta     _big+452
+	stx     _big+452+1
+	.dbg	line, "binlit.c", 497
+	ldx     #$FF
+	lda     #$E3
+	sta     _big+454
+	stx     _big+454+1
+	.dbg	line, "binlit.c", 498
+	ldx     #$FF
+	lda     #$E4
+	sta     _big+456
+	stx     _big+456+1
+	.dbg	line, "binlit.c", 499
+	ldx     #$FF
+	lda     #$E5
+	sta     _big+458
+	stx     _big+458+1
+	.dbg	line, "binlit.c", 500
+	ldx     #$FF
+	lda     #$E6
+	sta     _big+460
+	stx     _big+460+1
+	.dbg	line, "binlit.c", 501
+	ldx     #$FF
+	lda     #$E7
+	sta     _big+462
+	stx     _big+462+1
+	.dbg	line, "binlit.c", 502
+	ldx     #$FF
+	lda     #$E8
+	sta     _big+464
+	stx     _big+464+1
+	.dbg	line, "binlit.c", 503
+	ldx     #$FF
+	lda     #$E9
+	sta     _big+466
+	stx     _big+466+1
+	.dbg	line, "binlit.c", 504
+	ldx     #$FF
+	lda     #$EA
+	sta     _big+468
+	stx     _big+468+1
+	.dbg	line, "binlit.c", 505
+	ldx     #$FF
+	lda     #$EB
+	sta     _big+470
+	stx     _big+470+1
+	.dbg	line, "binlit.c", 506
+	ldx     #$FF
+	lda     #$EC
+	sta     _big+472
+	stx     _big+472+1
+	.dbg	line, "binlit.c", 507
+	ldx     #$FF
+	lda     #$ED
+	sta     _big+474
+	stx     _big+474+1
+	.dbg	line, "binlit.c", 508
+	ldx     #$FF
+	lda     #$EE
+	sta     _big+476
+	stx     _big+476+1
+	.dbg	line, "binlit.c", 509
+	ldx     #$FF
+	lda     #$EF
+	sta     _big+478
+	stx     _big+478+1
+	.dbg	line, "binlit.c", 510
+	ldx     #$FF
+	lda     #$F0
+	sta     _big+480
+	stx     _big+480+1
+	.dbg	line, "binlit.c", 511
+	ldx     #$FF
+	lda     #$F1
+	sta     _big+482
+	stx     _big+482+1
+	.dbg	line, "binlit.c", 512
+	ldx     #$FF
+	lda     #$F2
+	sta     _big+484
+	stx     _big+484+1
+	.dbg	line, "binlit.c", 513
+	ldx     #$FF
+	lda     #$F3
+	sta     _big+486
+	stx     _big+486+1
+	.dbg	line, "binlit.c", 514
+	ldx     #$FF
+	lda     #$F4
+	sta     _big+488
+	stx     _big+488+1
+	.dbg	line, "binlit.c", 515
+	ldx     #$FF
+	lda     #$F5
+	sta     _big+490
+	stx     _big+490+1
+	.dbg	line, "binlit.c", 516
+	ldx     #$FF
+	lda     #$F6
+	sta     _big+492
+	stx     _big+492+1
+	.dbg	line, "binlit.c", 517
+	ldx     #$FF
+	lda     #$F7
+	sta     _big+494
+	stx     _big+494+1
+	.dbg	line, "binlit.c", 518
+	ldx     #$FF
+	lda     #$F8
+	sta     _big+496
+	stx     _big+496+1
+	.dbg	line, "binlit.c", 519
+	ldx     #$FF
+	lda     #$F9
+	sta     _big+498
+	stx     _big+498+1
+	.dbg	line, "binlit.c", 520
+	ldx     #$FF
+	lda     #$FA
+	sta     _big+500
+	stx     _big+500+1
+	.dbg	line, "binlit.c", 521
+	ldx     #$FF
+	lda     #$FB
+	sta     _big+502
+	stx     _big+502+1
+	.dbg	line, "binlit.c", 522
+	ldx     #$FF
+	lda     #$FC
+	sta     _big+504
+	stx     _big+504+1
+	.dbg	line, "binlit.c", 523
+	ldx     #$FF
+	lda     #$FD
+	sta     _big+506
+	stx     _big+506+1
+	.dbg	line, "binlit.c", 524
+	ldx     #$FF
+	lda     #$FE
+	sta     _big+508
+	stx     _big+508+1
+	.dbg	line, "binlit.c", 525
+	ldx     #$FF
+	lda     #$FF
+	sta     _big+510
+	stx     _big+510+1
+	.dbg	line, "binlit.c", 527
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+	jmp     L0007
+	.dbg	line, "binlit.c", 528
+L000A:	ldy     #$01
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_big)
+	tay
+	txa
+	adc     #>(_big)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldx     #$FF
+	lda     #$00
+	jsr     tosaddax
+	jsr     tosneax
+	jeq     L000B
+	.dbg	line, "binlit.c", 529
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+	.dbg	line, "binlit.c", 527
+L000B:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0007
+L0007:	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$01
+	jsr     boolult
+	jne     L000A
+	.dbg	line, "binlit.c", 532
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "binlit.c", 533
+L0001:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
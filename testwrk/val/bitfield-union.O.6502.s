@@ -0,0 +1,234 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$42,$69,$74,$66,$69,$65,$6C,$64,$3A,$20,$25,$75,$0A,$00
+S0003:
+	.byte	$61,$3D,$30,$3A,$20,$25,$75,$0A,$0A,$00
+S0005:
+	.byte	$62,$3D,$30,$3A,$20,$25,$75,$0A,$0A,$00
+S0007:
+	.byte	$63,$3D,$30,$3A,$20,$25,$75,$0A,$0A,$00
+S0006:
+	.byte	$63,$3D,$31,$3A,$20,$25,$75,$0A,$00
+S0004:
+	.byte	$62,$3D,$31,$3A,$20,$25,$75,$0A,$00
+S0002:
+	.byte	$61,$3D,$31,$3A,$20,$25,$75,$0A,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	ldy     #$01
+L0002:	lda     M0001,y
+	sta     (sp),y
+	dey
+	bpl     L0002
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldy     #$00
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L0003
+	inc     _failures
+L0003:	dey
+	lda     (sp),y
+	and     #$FE
+	sta     ptr1
+	lda     (sp),y
+	and     #$01
+	eor     #$01
+	and     #$01
+	ora     ptr1
+	sta     (sp),y
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldy     #$01
+	lda     (sp),y
+	bne     L0013
+	dey
+	lda     (sp),y
+	cmp     #$01
+	beq     L0016
+L0013:	inc     _failures
+	ldy     #$00
+L0016:	lda     (sp),y
+	and     #$FE
+	sta     ptr1
+	lda     (sp),y
+	and     #$01
+	eor     #$01
+	and     #$01
+	ora     ptr1
+	sta     (sp),y
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldy     #$00
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L0007
+	inc     _failures
+L0007:	dey
+	lda     (sp),y
+	and     #$FD
+	sta     ptr1
+	lda     (sp),y
+	lsr     a
+	and     #$01
+	eor     #$01
+	and     #$01
+	asl     a
+	ora     ptr1
+	sta     (sp),y
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldy     #$01
+	lda     (sp),y
+	bne     L0014
+	dey
+	lda     (sp),y
+	cmp     #$02
+	beq     L0017
+L0014:	inc     _failures
+	ldy     #$00
+L0017:	lda     (sp),y
+	and     #$FD
+	sta     ptr1
+	lda     (sp),y
+	lsr     a
+	and     #$01
+	eor     #$01
+	and     #$01
+	asl     a
+	ora     ptr1
+	sta     (sp),y
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldy     #$00
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L000B
+	inc     _failures
+L000B:	dey
+	lda     (sp),y
+	and     #$FB
+	sta     ptr1
+	lda     (sp),y
+	lsr     a
+	lsr     a
+	and     #$01
+	eor     #$01
+	and     #$01
+	asl     a
+	asl     a
+	ora     ptr1
+	sta     (sp),y
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldy     #$01
+	lda     (sp),y
+	bne     L0015
+	dey
+	lda     (sp),y
+	cmp     #$04
+	beq     L0018
+L0015:	inc     _failures
+	ldy     #$00
+L0018:	lda     (sp),y
+	and     #$FB
+	sta     ptr1
+	lda     (sp),y
+	lsr     a
+	lsr     a
+	and     #$01
+	eor     #$01
+	and     #$01
+	asl     a
+	asl     a
+	ora     ptr1
+	sta     (sp),y
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldy     #$00
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L000F
+	inc     _failures
+L000F:	ldx     #$00
+	lda     _failures
+	jmp     incsp2
+
+.segment	"RODATA"
+
+M0001:
+	.word	$0000
+
+.endproc
+
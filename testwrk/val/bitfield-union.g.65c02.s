@@ -0,0 +1,325 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "bitfield-union.c", 2055, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$42,$69,$74,$66,$69,$65,$6C,$64,$3A,$20,$25,$75,$0A,$00
+S0003:
+	.byte	$61,$3D,$30,$3A,$20,$25,$75,$0A,$0A,$00
+S0005:
+	.byte	$62,$3D,$30,$3A,$20,$25,$75,$0A,$0A,$00
+S0007:
+	.byte	$63,$3D,$30,$3A,$20,$25,$75,$0A,$0A,$00
+S0006:
+	.byte	$63,$3D,$31,$3A,$20,$25,$75,$0A,$00
+S0004:
+	.byte	$62,$3D,$31,$3A,$20,$25,$75,$0A,$00
+S0002:
+	.byte	$61,$3D,$31,$3A,$20,$25,$75,$0A,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+	.dbg	sym, "bitfield", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "bitfield-union.c", 41
+	jsr     decsp2
+	ldy     #$01
+L0002:	lda     M0001,y
+	sta     (sp),y
+	dey
+	bpl     L0002
+	.dbg	line, "bitfield-union.c", 43
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bitfield-union.c", 44
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0004
+	cmp     #$00
+L0004:	jsr     boolne
+	jeq     L0003
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bitfield-union.c", 46
+L0003:	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	and     #$FE
+	jsr     pushax
+	ldy     #$02
+	lda     (sp),y
+	ldx     #$00
+	and     #$01
+	eor     #$01
+	ldx     #$00
+	and     #$01
+	jsr     tosorax
+	ldy     #$00
+	sta     (sp),y
+	.dbg	line, "bitfield-union.c", 47
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bitfield-union.c", 48
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0006
+	cmp     #$01
+L0006:	jsr     boolne
+	jeq     L0005
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bitfield-union.c", 50
+L0005:	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	and     #$FE
+	jsr     pushax
+	ldy     #$02
+	lda     (sp),y
+	ldx     #$00
+	and     #$01
+	eor     #$01
+	ldx     #$00
+	and     #$01
+	jsr     tosorax
+	ldy     #$00
+	sta     (sp),y
+	.dbg	line, "bitfield-union.c", 51
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bitfield-union.c", 52
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0008
+	cmp     #$00
+L0008:	jsr     boolne
+	jeq     L0007
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bitfield-union.c", 54
+L0007:	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	and     #$FD
+	jsr     pushax
+	ldy     #$02
+	lda     (sp),y
+	lsr     a
+	ldx     #$00
+	and     #$01
+	eor     #$01
+	ldx     #$00
+	and     #$01
+	jsr     shlax1
+	jsr     tosorax
+	ldy     #$00
+	sta     (sp),y
+	.dbg	line, "bitfield-union.c", 55
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bitfield-union.c", 56
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L000A
+	cmp     #$02
+L000A:	jsr     boolne
+	jeq     L0009
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bitfield-union.c", 58
+L0009:	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	and     #$FD
+	jsr     pushax
+	ldy     #$02
+	lda     (sp),y
+	lsr     a
+	ldx     #$00
+	and     #$01
+	eor     #$01
+	ldx     #$00
+	and     #$01
+	jsr     shlax1
+	jsr     tosorax
+	ldy     #$00
+	sta     (sp),y
+	.dbg	line, "bitfield-union.c", 59
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bitfield-union.c", 60
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L000C
+	cmp     #$00
+L000C:	jsr     boolne
+	jeq     L000B
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bitfield-union.c", 62
+L000B:	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	and     #$FB
+	jsr     pushax
+	ldy     #$02
+	lda     (sp),y
+	lsr     a
+	lsr     a
+	ldx     #$00
+	and     #$01
+	eor     #$01
+	ldx     #$00
+	and     #$01
+	jsr     shlax2
+	jsr     tosorax
+	ldy     #$00
+	sta     (sp),y
+	.dbg	line, "bitfield-union.c", 63
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bitfield-union.c", 64
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L000E
+	cmp     #$04
+L000E:	jsr     boolne
+	jeq     L000D
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bitfield-union.c", 66
+L000D:	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	and     #$FB
+	jsr     pushax
+	ldy     #$02
+	lda     (sp),y
+	lsr     a
+	lsr     a
+	ldx     #$00
+	and     #$01
+	eor     #$01
+	ldx     #$00
+	and     #$01
+	jsr     shlax2
+	jsr     tosorax
+	ldy     #$00
+	sta     (sp),y
+	.dbg	line, "bitfield-union.c", 67
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bitfield-union.c", 68
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0010
+	cmp     #$00
+L0010:	jsr     boolne
+	jeq     L000F
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bitfield-union.c", 70
+L000F:	ldx     #$00
+	lda     _failures
+	jmp     L0001
+	.dbg	line, "bitfield-union.c", 71
+L0001:	jsr     incsp2
+	rts
+
+	.dbg	line
+.segment	"RODATA"
+
+M0001:
+	.word	$0000
+
+.endproc
+
@@ -0,0 +1,1216 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "bitfield.c", 6561, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+_fb:
+	.byte	$01
+_fbi:
+	.byte	$01
+	.word	$0002
+_o:
+	.byte	$0B
+	.byte	$58
+	.byte	$00
+_oi:
+	.byte	$6F
+	.byte	$78
+	.byte	$03
+	.word	$014D
+_fw:
+	.byte	$FF
+	.byte	$11
+	.byte	$00
+_ae:
+	.byte	$FC
+	.byte	$88
+	.byte	$00
+	.byte	$00
+	.byte	$19
+
+.segment	"RODATA"
+
+S0004:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$28,$73,$74,$72,$75,$63
+	.byte	$74,$20,$66,$6F,$75,$72,$5F,$62,$69,$74,$73,$5F,$77,$69,$74,$68
+	.byte	$5F,$69,$6E,$74,$29,$20,$3D,$20,$25,$7A,$75,$2C,$20,$65,$78,$70
+	.byte	$65,$63,$74,$65,$64,$20,$33,$2E,$0A,$00
+S000E:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$28,$73,$74,$72,$75,$63
+	.byte	$74,$20,$6F,$76,$65,$72,$6C,$61,$70,$5F,$77,$69,$74,$68,$5F,$69
+	.byte	$6E,$74,$29,$20,$3D,$20,$25,$7A,$75,$2C,$20,$65,$78,$70,$65,$63
+	.byte	$74,$65,$64,$20,$35,$2E,$0A,$00
+S001A:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$28,$73,$74,$72,$75,$63
+	.byte	$74,$20,$61,$6C,$69,$67,$6E,$65,$64,$5F,$65,$6E,$64,$29,$20,$3D
+	.byte	$20,$25,$7A,$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$35
+	.byte	$2E,$0A,$00
+S0015:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$28,$73,$74,$72,$75,$63
+	.byte	$74,$20,$66,$75,$6C,$6C,$5F,$77,$69,$64,$74,$68,$29,$20,$3D,$20
+	.byte	$25,$7A,$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$33,$2E
+	.byte	$0A,$00
+S0001:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$28,$73,$74,$72,$75,$63
+	.byte	$74,$20,$66,$6F,$75,$72,$5F,$62,$69,$74,$73,$29,$20,$3D,$20,$25
+	.byte	$7A,$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A
+	.byte	$00
+S0009:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$28,$73,$74,$72,$75,$63
+	.byte	$74,$20,$6F,$76,$65,$72,$6C,$61,$70,$29,$20,$3D,$20,$25,$7A,$75
+	.byte	$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$33,$2E,$0A,$00
+S001F:
+	.byte	$47,$6F,$74,$20,$61,$65,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$32,$33,$2E,$0A,$00
+S0019:
+	.byte	$47,$6F,$74,$20,$66,$77,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$32,$33,$2E,$0A,$00
+S0016:
+	.byte	$47,$6F,$74,$20,$66,$77,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$32,$35,$35,$2E,$0A,$00
+S0014:
+	.byte	$47,$6F,$74,$20,$6F,$69,$2E,$7A,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$36,$36,$36,$2E,$0A,$00
+S0013:
+	.byte	$47,$6F,$74,$20,$6F,$69,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$35,$35,$35,$2E,$0A,$00
+S001D:
+	.byte	$47,$6F,$74,$20,$61,$65,$2E,$7A,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$30,$2E,$0A,$00
+S0012:
+	.byte	$47,$6F,$74,$20,$6F,$69,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$34,$34,$34,$2E,$0A,$00
+S000F:
+	.byte	$47,$6F,$74,$20,$6F,$69,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$31,$31,$2E,$0A,$00
+S0010:
+	.byte	$47,$6F,$74,$20,$6F,$69,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$32,$32,$32,$2E,$0A,$00
+S0011:
+	.byte	$47,$6F,$74,$20,$6F,$69,$2E,$7A,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$33,$33,$33,$2E,$0A,$00
+S0008:
+	.byte	$47,$6F,$74,$20,$66,$62,$69,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$37,$2E,$0A,$00
+S001E:
+	.byte	$47,$6F,$74,$20,$61,$65,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$34,$32,$2E,$0A,$00
+S0007:
+	.byte	$47,$6F,$74,$20,$66,$62,$69,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$33,$2E,$0A,$00
+S001C:
+	.byte	$47,$6F,$74,$20,$61,$65,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$37,$2E,$0A,$00
+S0020:
+	.byte	$47,$6F,$74,$20,$61,$65,$2E,$7A,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$36,$36,$2E,$0A,$00
+S0017:
+	.byte	$47,$6F,$74,$20,$66,$77,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$37,$2E,$0A,$00
+S0018:
+	.byte	$47,$6F,$74,$20,$66,$77,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$34,$32,$2E,$0A,$00
+S0005:
+	.byte	$47,$6F,$74,$20,$66,$62,$69,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A,$00
+S001B:
+	.byte	$47,$6F,$74,$20,$61,$65,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$36,$33,$2E,$0A,$00
+S0006:
+	.byte	$47,$6F,$74,$20,$66,$62,$69,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$32,$2E,$0A,$00
+S0003:
+	.byte	$47,$6F,$74,$20,$66,$62,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$33,$2E,$0A,$00
+S000D:
+	.byte	$47,$6F,$74,$20,$6F,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65,$78
+	.byte	$70,$65,$63,$74,$65,$64,$20,$34,$34,$2E,$0A,$00
+S000C:
+	.byte	$47,$6F,$74,$20,$6F,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65,$78
+	.byte	$70,$65,$63,$74,$65,$64,$20,$33,$33,$2E,$0A,$00
+S000B:
+	.byte	$47,$6F,$74,$20,$6F,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65,$78
+	.byte	$70,$65,$63,$74,$65,$64,$20,$32,$32,$2E,$0A,$00
+S000A:
+	.byte	$47,$6F,$74,$20,$6F,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65,$78
+	.byte	$70,$65,$63,$74,$65,$64,$20,$31,$31,$2E,$0A,$00
+S0002:
+	.byte	$47,$6F,$74,$20,$66,$62,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A,$00
+S0021:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ test_four_bits (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_four_bits: near
+
+	.dbg	func, "test_four_bits", "00", static, "_test_four_bits"
+
+.segment	"CODE"
+
+	.dbg	line, "bitfield.c", 35
+	jmp     L0002
+	.dbg	line, "bitfield.c", 36
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	.dbg	line, "bitfield.c", 37
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bitfield.c", 38
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bitfield.c", 41
+L0002:	lda     _fb
+	ldx     #$00
+	and     #$0F
+	cpx     #$00
+	bne     L0004
+	cmp     #$01
+L0004:	jsr     boolne
+	jeq     L0003
+	.dbg	line, "bitfield.c", 42
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     _fb
+	ldx     #$00
+	and     #$0F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bitfield.c", 43
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bitfield.c", 46
+L0003:	ldx     #$00
+	lda     _fb
+	and     #$F0
+	ora     #$03
+	sta     _fb
+	.dbg	line, "bitfield.c", 48
+	lda     _fb
+	ldx     #$00
+	and     #$0F
+	cpx     #$00
+	bne     L0006
+	cmp     #$03
+L0006:	jsr     boolne
+	jeq     L0005
+	.dbg	line, "bitfield.c", 49
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     _fb
+	ldx     #$00
+	and     #$0F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bitfield.c", 50
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bitfield.c", 52
+L0005:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_four_bits_with_int (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_four_bits_with_int: near
+
+	.dbg	func, "test_four_bits_with_int", "00", static, "_test_four_bits_with_int"
+
+.segment	"CODE"
+
+	.dbg	line, "bitfield.c", 67
+	jmp     L0002
+	.dbg	line, "bitfield.c", 68
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	.dbg	line, "bitfield.c", 69
+	ldx     #$00
+	lda     #$03
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bitfield.c", 70
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bitfield.c", 73
+L0002:	lda     _fbi
+	ldx     #$00
+	and     #$0F
+	cpx     #$00
+	bne     L0004
+	cmp     #$01
+L0004:	jsr     boolne
+	jeq     L0003
+	.dbg	line, "bitfield.c", 74
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     _fbi
+	ldx     #$00
+	and     #$0F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bitfield.c", 75
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bitfield.c", 78
+L0003:	lda     _fbi+1
+	ldx     _fbi+1+1
+	cpx     #$00
+	bne     L0006
+	cmp     #$02
+L0006:	jsr     boolne
+	jeq     L0005
+	.dbg	line, "bitfield.c", 79
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	lda     _fbi+1
+	ldx     _fbi+1+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bitfield.c", 80
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bitfield.c", 83
+L0005:	ldx     #$00
+	lda     _fbi
+	and     #$F0
+	ora     #$03
+	sta     _fbi
+	.dbg	line, "bitfield.c", 84
+	ldx     #$00
+	lda     #$11
+	sta     _fbi+1
+	stx     _fbi+1+1
+	.dbg	line, "bitfield.c", 86
+	lda     _fbi
+	ldx     #$00
+	and     #$0F
+	cpx     #$00
+	bne     L0008
+	cmp     #$03
+L0008:	jsr     boolne
+	jeq     L0007
+	.dbg	line, "bitfield.c", 87
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	lda     _fbi
+	ldx     #$00
+	and     #$0F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bitfield.c", 88
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bitfield.c", 91
+L0007:	lda     _fbi+1
+	ldx     _fbi+1+1
+	cpx     #$00
+	bne     L000A
+	cmp     #$11
+L000A:	jsr     boolne
+	jeq     L0009
+	.dbg	line, "bitfield.c", 92
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	lda     _fbi+1
+	ldx     _fbi+1+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bitfield.c", 93
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bitfield.c", 95
+L0009:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_overlap (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_overlap: near
+
+	.dbg	func, "test_overlap", "00", static, "_test_overlap"
+
+.segment	"CODE"
+
+	.dbg	line, "bitfield.c", 105
+	jmp     L0002
+	.dbg	line, "bitfield.c", 106
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	.dbg	line, "bitfield.c", 107
+	ldx     #$00
+	lda     #$03
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bitfield.c", 108
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bitfield.c", 111
+L0002:	lda     _o
+	ldx     _o+1
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	cpx     #$00
+	bne     L0004
+	cmp     #$0B
+L0004:	jsr     boolne
+	jeq     L0003
+	.dbg	line, "bitfield.c", 112
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	lda     _o
+	ldx     _o+1
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bitfield.c", 113
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bitfield.c", 116
+L0003:	lda     _o+1
+	ldx     _o+1+1
+	jsr     shrax2
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	cpx     #$00
+	bne     L0006
+	cmp     #$16
+L0006:	jsr     boolne
+	jeq     L0005
+	.dbg	line, "bitfield.c", 117
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	lda     _o+1
+	ldx     _o+1+1
+	jsr     shrax2
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bitfield.c", 118
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bitfield.c", 121
+L0005:	lda     _o
+	ldx     _o+1
+	txa
+	and     #$FC
+	tax
+	lda     #$00
+	ora     #$21
+	sta     _o
+	stx     _o+1
+	.dbg	line, "bitfield.c", 122
+	lda     _o+1
+	ldx     _o+1+1
+	tay
+	txa
+	and     #$F0
+	tax
+	tya
+	and     #$03
+	ora     #$B0
+	sta     _o+1
+	stx     _o+1+1
+	.dbg	line, "bitfield.c", 124
+	lda     _o
+	ldx     _o+1
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	cpx     #$00
+	bne     L0008
+	cmp     #$21
+L0008:	jsr     boolne
+	jeq     L0007
+	.dbg	line, "bitfield.c", 125
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	lda     _o
+	ldx     _o+1
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bitfield.c", 126
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bitfield.c", 129
+L0007:	lda     _o+1
+	ldx     _o+1+1
+	jsr     shrax2
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	cpx     #$00
+	bne     L000A
+	cmp     #$2C
+L000A:	jsr     boolne
+	jeq     L0009
+	.dbg	line, "bitfield.c", 130
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	lda     _o+1
+	ldx     _o+1+1
+	jsr     shrax2
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bitfield.c", 131
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bitfield.c", 133
+L0009:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_overlap_with_int (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_overlap_with_int: near
+
+	.dbg	func, "test_overlap_with_int", "00", static, "_test_overlap_with_int"
+
+.segment	"CODE"
+
+	.dbg	line, "bitfield.c", 144
+	jmp     L0002
+	.dbg	line, "bitfield.c", 145
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	.dbg	line, "bitfield.c", 146
+	ldx     #$00
+	lda     #$05
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bitfield.c", 147
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bitfield.c", 150
+L0002:	lda     _oi
+	ldx     _oi+1
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	cpx     #$00
+	bne     L0004
+	cmp     #$6F
+L0004:	jsr     boolne
+	jeq     L0003
+	.dbg	line, "bitfield.c", 151
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	lda     _oi
+	ldx     _oi+1
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bitfield.c", 152
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bitfield.c", 155
+L0003:	lda     _oi+1
+	ldx     _oi+1+1
+	jsr     shrax2
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	cpx     #$00
+	bne     L0006
+	cmp     #$DE
+L0006:	jsr     boolne
+	jeq     L0005
+	.dbg	line, "bitfield.c", 156
+	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	lda     _oi+1
+	ldx     _oi+1+1
+	jsr     shrax2
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bitfield.c", 157
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bitfield.c", 160
+L0005:	lda     _oi+3
+	ldx     _oi+3+1
+	cpx     #$01
+	bne     L0008
+	cmp     #$4D
+L0008:	jsr     boolne
+	jeq     L0007
+	.dbg	line, "bitfield.c", 161
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	lda     _oi+3
+	ldx     _oi+3+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bitfield.c", 162
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bitfield.c", 165
+L0007:	lda     _oi
+	ldx     _oi+1
+	txa
+	and     #$FC
+	tax
+	lda     #$00
+	ora     #$BC
+	pha
+	txa
+	ora     #$01
+	tax
+	pla
+	sta     _oi
+	stx     _oi+1
+	.dbg	line, "bitfield.c", 166
+	lda     _oi+1
+	ldx     _oi+1+1
+	tay
+	txa
+	and     #$F0
+	tax
+	tya
+	and     #$03
+	ora     #$AC
+	pha
+	txa
+	ora     #$08
+	tax
+	pla
+	sta     _oi+1
+	stx     _oi+1+1
+	.dbg	line, "bitfield.c", 167
+	ldx     #$02
+	lda     #$9A
+	sta     _oi+3
+	stx     _oi+3+1
+	.dbg	line, "bitfield.c", 169
+	lda     _oi
+	ldx     _oi+1
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	cpx     #$01
+	bne     L000A
+	cmp     #$BC
+L000A:	jsr     boolne
+	jeq     L0009
+	.dbg	line, "bitfield.c", 170
+	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	lda     _oi
+	ldx     _oi+1
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bitfield.c", 171
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bitfield.c", 174
+L0009:	lda     _oi+1
+	ldx     _oi+1+1
+	jsr     shrax2
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	cpx     #$02
+	bne     L000C
+	cmp     #$2B
+L000C:	jsr     boolne
+	jeq     L000B
+	.dbg	line, "bitfield.c", 175
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	lda     _oi+1
+	ldx     _oi+1+1
+	jsr     shrax2
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bitfield.c", 176
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bitfield.c", 179
+L000B:	lda     _oi+3
+	ldx     _oi+3+1
+	cpx     #$02
+	bne     L000E
+	cmp     #$9A
+L000E:	jsr     boolne
+	jeq     L000D
+	.dbg	line, "bitfield.c", 180
+	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	lda     _oi+3
+	ldx     _oi+3+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bitfield.c", 181
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bitfield.c", 183
+L000D:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_full_width (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_full_width: near
+
+	.dbg	func, "test_full_width", "00", static, "_test_full_width"
+
+.segment	"CODE"
+
+	.dbg	line, "bitfield.c", 192
+	jmp     L0002
+	.dbg	line, "bitfield.c", 193
+	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+	.dbg	line, "bitfield.c", 194
+	ldx     #$00
+	lda     #$03
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bitfield.c", 195
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bitfield.c", 198
+L0002:	ldx     #$00
+	lda     _fw
+	cpx     #$00
+	bne     L0004
+	cmp     #$FF
+L0004:	jsr     boolne
+	jeq     L0003
+	.dbg	line, "bitfield.c", 199
+	lda     #<(S0016)
+	ldx     #>(S0016)
+	jsr     pushax
+	ldx     #$00
+	lda     _fw
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bitfield.c", 200
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bitfield.c", 203
+L0003:	lda     _fw+1
+	ldx     _fw+1+1
+	cpx     #$00
+	bne     L0006
+	cmp     #$11
+L0006:	jsr     boolne
+	jeq     L0005
+	.dbg	line, "bitfield.c", 204
+	lda     #<(S0017)
+	ldx     #>(S0017)
+	jsr     pushax
+	lda     _fw+1
+	ldx     _fw+1+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bitfield.c", 205
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bitfield.c", 208
+L0005:	ldx     #$00
+	lda     _fw
+	lda     #$00
+	ora     #$2A
+	sta     _fw
+	.dbg	line, "bitfield.c", 209
+	lda     _fw+1
+	ldx     _fw+1+1
+	txa
+	and     #$00
+	tax
+	lda     #$00
+	ora     #$FF
+	pha
+	txa
+	ora     #$03
+	tax
+	pla
+	sta     _fw+1
+	stx     _fw+1+1
+	.dbg	line, "bitfield.c", 211
+	ldx     #$00
+	lda     _fw
+	cpx     #$00
+	bne     L0008
+	cmp     #$2A
+L0008:	jsr     boolne
+	jeq     L0007
+	.dbg	line, "bitfield.c", 212
+	lda     #<(S0018)
+	ldx     #>(S0018)
+	jsr     pushax
+	ldx     #$00
+	lda     _fw
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bitfield.c", 213
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bitfield.c", 216
+L0007:	lda     _fw+1
+	ldx     _fw+1+1
+	cpx     #$03
+	bne     L000A
+	cmp     #$FF
+L000A:	jsr     boolne
+	jeq     L0009
+	.dbg	line, "bitfield.c", 217
+	lda     #<(S0019)
+	ldx     #>(S0019)
+	jsr     pushax
+	lda     _fw+1
+	ldx     _fw+1+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bitfield.c", 218
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bitfield.c", 220
+L0009:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_aligned_end (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_aligned_end: near
+
+	.dbg	func, "test_aligned_end", "00", static, "_test_aligned_end"
+
+.segment	"CODE"
+
+	.dbg	line, "bitfield.c", 234
+	jmp     L0002
+	.dbg	line, "bitfield.c", 235
+	lda     #<(S001A)
+	ldx     #>(S001A)
+	jsr     pushax
+	.dbg	line, "bitfield.c", 236
+	ldx     #$00
+	lda     #$05
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bitfield.c", 237
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bitfield.c", 240
+L0002:	lda     _ae
+	lsr     a
+	lsr     a
+	ldx     #$00
+	cpx     #$00
+	bne     L0004
+	cmp     #$3F
+L0004:	jsr     boolne
+	jeq     L0003
+	.dbg	line, "bitfield.c", 241
+	lda     #<(S001B)
+	ldx     #>(S001B)
+	jsr     pushax
+	lda     _ae
+	lsr     a
+	lsr     a
+	ldx     #$00
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bitfield.c", 242
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bitfield.c", 245
+L0003:	lda     _ae+1
+	ldx     _ae+1+1
+	jsr     shrax3
+	cpx     #$00
+	bne     L0006
+	cmp     #$11
+L0006:	jsr     boolne
+	jeq     L0005
+	.dbg	line, "bitfield.c", 246
+	lda     #<(S001C)
+	ldx     #>(S001C)
+	jsr     pushax
+	lda     _ae+1
+	ldx     _ae+1+1
+	jsr     shrax3
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bitfield.c", 247
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bitfield.c", 250
+L0005:	lda     _ae+3
+	ldx     _ae+3+1
+	jsr     shrax4
+	jsr     shrax2
+	ldx     #$00
+	and     #$7F
+	cpx     #$00
+	bne     L0008
+	cmp     #$64
+L0008:	jsr     boolne
+	jeq     L0007
+	.dbg	line, "bitfield.c", 251
+	lda     #<(S001D)
+	ldx     #>(S001D)
+	jsr     pushax
+	lda     _ae+3
+	ldx     _ae+3+1
+	jsr     shrax4
+	jsr     shrax2
+	ldx     #$00
+	and     #$7F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bitfield.c", 252
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bitfield.c", 255
+L0007:	ldx     #$00
+	lda     _ae
+	and     #$03
+	ora     #$A8
+	sta     _ae
+	.dbg	line, "bitfield.c", 256
+	lda     _ae+1
+	ldx     _ae+1+1
+	tay
+	txa
+	and     #$00
+	tax
+	tya
+	and     #$07
+	ora     #$F8
+	pha
+	txa
+	ora     #$1F
+	tax
+	pla
+	sta     _ae+1
+	stx     _ae+1+1
+	.dbg	line, "bitfield.c", 257
+	lda     _ae+3
+	ldx     _ae+3+1
+	tay
+	txa
+	and     #$E0
+	tax
+	tya
+	and     #$3F
+	ora     #$80
+	pha
+	txa
+	ora     #$10
+	tax
+	pla
+	sta     _ae+3
+	stx     _ae+3+1
+	.dbg	line, "bitfield.c", 259
+	lda     _ae
+	lsr     a
+	lsr     a
+	ldx     #$00
+	cpx     #$00
+	bne     L000A
+	cmp     #$2A
+L000A:	jsr     boolne
+	jeq     L0009
+	.dbg	line, "bitfield.c", 260
+	lda     #<(S001E)
+	ldx     #>(S001E)
+	jsr     pushax
+	lda     _ae
+	lsr     a
+	lsr     a
+	ldx     #$00
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bitfield.c", 261
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bitfield.c", 264
+L0009:	lda     _ae+1
+	ldx     _ae+1+1
+	jsr     shrax3
+	cpx     #$03
+	bne     L000C
+	cmp     #$FF
+L000C:	jsr     boolne
+	jeq     L000B
+	.dbg	line, "bitfield.c", 265
+	lda     #<(S001F)
+	ldx     #>(S001F)
+	jsr     pushax
+	lda     _ae+1
+	ldx     _ae+1+1
+	jsr     shrax3
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bitfield.c", 266
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bitfield.c", 269
+L000B:	lda     _ae+3
+	ldx     _ae+3+1
+	jsr     shrax4
+	jsr     shrax2
+	ldx     #$00
+	and     #$7F
+	cpx     #$00
+	bne     L000E
+	cmp     #$42
+L000E:	jsr     boolne
+	jeq     L000D
+	.dbg	line, "bitfield.c", 270
+	lda     #<(S0020)
+	ldx     #>(S0020)
+	jsr     pushax
+	lda     _ae+3
+	ldx     _ae+3+1
+	jsr     shrax4
+	jsr     shrax2
+	ldx     #$00
+	and     #$7F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bitfield.c", 271
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bitfield.c", 273
+L000D:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "bitfield.c", 277
+	jsr     _test_four_bits
+	.dbg	line, "bitfield.c", 278
+	jsr     _test_four_bits_with_int
+	.dbg	line, "bitfield.c", 279
+	jsr     _test_overlap
+	.dbg	line, "bitfield.c", 280
+	jsr     _test_overlap_with_int
+	.dbg	line, "bitfield.c", 281
+	jsr     _test_full_width
+	.dbg	line, "bitfield.c", 282
+	jsr     _test_aligned_end
+	.dbg	line, "bitfield.c", 283
+	lda     #<(S0021)
+	ldx     #>(S0021)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bitfield.c", 284
+	ldx     #$00
+	lda     _failures
+	jmp     L0001
+	.dbg	line, "bitfield.c", 285
+L0001:	rts
+
+	.dbg	line
+.endproc
+
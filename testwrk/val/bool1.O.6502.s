@@ -0,0 +1,339 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_success
+	.export		_failures
+	.export		_dummy
+	.export		_aint0
+	.export		_aint1
+	.export		_achar0
+	.export		_achar1
+	.export		_done
+	.export		_bool_or1
+	.export		_bool_or2
+	.export		_bool_test1
+	.export		_bool_test2
+	.export		_bool_and1
+	.export		_bin_or1
+	.export		_bin_xor1
+	.export		_bool_test3
+	.export		_bool_or_lit1
+	.export		_bool_and_lit1
+	.export		_main
+
+.segment	"DATA"
+
+_success:
+	.byte	$00
+_failures:
+	.byte	$00
+_dummy:
+	.byte	$00
+_aint0:
+	.word	$0000
+_aint1:
+	.word	$0000
+_achar0:
+	.byte	$00
+_achar1:
+	.byte	$00
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ done (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_done: near
+
+.segment	"CODE"
+
+	inc     _dummy
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ bool_or1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_bool_or1: near
+
+.segment	"CODE"
+
+	lda     _achar0
+	bne     L0005
+	lda     _achar1
+	bne     L0005
+	rts
+L0005:	inc     _failures
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ bool_or2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_bool_or2: near
+
+.segment	"CODE"
+
+	lda     _achar0
+	bne     L0003
+	lda     _achar1
+	bne     L0003
+	rts
+L0003:	inc     _failures
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ bool_test1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_bool_test1: near
+
+.segment	"CODE"
+
+	lda     _achar0
+	beq     L0005
+	lda     _achar1
+	bne     L0005
+	rts
+L0005:	inc     _failures
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ bool_test2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_bool_test2: near
+
+.segment	"CODE"
+
+	lda     _achar0
+	beq     L0005
+	lda     _aint0
+	ora     _aint0+1
+	bne     L0005
+	rts
+L0005:	inc     _failures
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ bool_and1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_bool_and1: near
+
+.segment	"CODE"
+
+	lda     _achar0
+	beq     L0003
+	lda     _achar1
+	bne     L0004
+L0003:	rts
+L0004:	inc     _failures
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ bin_or1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_bin_or1: near
+
+.segment	"CODE"
+
+	jsr     decsp1
+	lda     _achar1
+	ora     _achar0
+	ldy     #$00
+	sta     (sp),y
+	lda     (sp),y
+	beq     L0002
+	inc     _failures
+L0002:	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ bin_xor1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_bin_xor1: near
+
+.segment	"CODE"
+
+	lda     _achar1
+	eor     _achar0
+	beq     L0002
+	inc     _failures
+L0002:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ bool_test3 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_bool_test3: near
+
+.segment	"CODE"
+
+	lda     _achar0
+	cmp     #$42
+	beq     L0005
+	lda     _achar1
+	cmp     #$2A
+	beq     L0005
+	rts
+L0005:	inc     _failures
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ bool_or_lit1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_bool_or_lit1: near
+
+.segment	"CODE"
+
+	lda     _achar0
+	ora     #$0F
+	sta     _achar0
+	cmp     #$11
+	bcc     L0005
+	inc     _failures
+L0005:	lda     _achar0
+	ora     #$10
+	cmp     #$F1
+	lda     #$00
+	sbc     #$00
+	bvs     L0004
+	eor     #$80
+L0004:	bpl     L0003
+	inc     _failures
+L0003:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ bool_and_lit1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_bool_and_lit1: near
+
+.segment	"CODE"
+
+	lda     _achar0
+	and     #$F0
+	sta     _achar0
+	cmp     #$11
+	bcc     L0005
+	inc     _failures
+L0005:	lda     _achar0
+	and     #$10
+	cmp     #$F1
+	lda     #$00
+	sbc     #$00
+	bvs     L0004
+	eor     #$80
+L0004:	bpl     L0006
+	inc     _failures
+L0006:	lda     _achar0
+	and     #$EF
+	sta     _achar0
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     _bool_or1
+	jsr     _bool_or2
+	jsr     _bool_and1
+	jsr     _bin_or1
+	jsr     _bin_xor1
+	inc     _achar0
+	jsr     _bool_and1
+	jsr     _bool_test1
+	jsr     _bool_test2
+	jsr     _bool_test3
+	dec     _achar0
+	inc     _achar1
+	jsr     _bool_and1
+	lda     #$00
+	sta     _achar0
+	sta     _achar1
+	jsr     _bool_or_lit1
+	jsr     _bool_and_lit1
+	lda     _failures
+	sta     _success
+	jsr     _done
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     _failures
+	rts
+
+.endproc
+
@@ -0,0 +1,564 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "bool1.c", 1613, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/limits.h", 3146, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_success
+	.export		_failures
+	.export		_dummy
+	.export		_aint0
+	.export		_aint1
+	.export		_achar0
+	.export		_achar1
+	.export		_done
+	.export		_bool_or1
+	.export		_bool_or2
+	.export		_bool_test1
+	.export		_bool_test2
+	.export		_bool_and1
+	.export		_bin_or1
+	.export		_bin_xor1
+	.export		_bool_test3
+	.export		_bool_or_lit1
+	.export		_bool_and_lit1
+	.export		_main
+
+.segment	"DATA"
+
+_success:
+	.byte	$00
+_failures:
+	.byte	$00
+_dummy:
+	.byte	$00
+_aint0:
+	.word	$0000
+_aint1:
+	.word	$0000
+_achar0:
+	.byte	$00
+_achar1:
+	.byte	$00
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ done (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_done: near
+
+	.dbg	func, "done", "00", extern, "_done"
+
+.segment	"CODE"
+
+	.dbg	line, "bool1.c", 24
+	ldx     #$00
+	lda     _dummy
+	inc     _dummy
+	.dbg	line, "bool1.c", 25
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ bool_or1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_bool_or1: near
+
+	.dbg	func, "bool_or1", "00", extern, "_bool_or1"
+
+.segment	"CODE"
+
+	.dbg	line, "bool1.c", 29
+	ldx     #$00
+	lda     _achar0
+	cmp     #$00
+	jsr     boolne
+	jne     L0003
+	ldx     #$00
+	lda     _achar1
+	cmp     #$00
+	jsr     boolne
+	jne     L0003
+	ldx     #$00
+	lda     #$00
+	jeq     L0004
+L0003:	ldx     #$00
+	lda     #$01
+L0004:	jeq     L0002
+	.dbg	line, "bool1.c", 30
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bool1.c", 31
+L0002:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ bool_or2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_bool_or2: near
+
+	.dbg	func, "bool_or2", "00", extern, "_bool_or2"
+
+.segment	"CODE"
+
+	.dbg	line, "bool1.c", 35
+	lda     _achar0
+	jne     L0003
+	lda     _achar1
+	jne     L0003
+	ldx     #$00
+	lda     #$00
+	jeq     L0004
+L0003:	ldx     #$00
+	lda     #$01
+L0004:	jeq     L0002
+	.dbg	line, "bool1.c", 36
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bool1.c", 37
+L0002:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ bool_test1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_bool_test1: near
+
+	.dbg	func, "bool_test1", "00", extern, "_bool_test1"
+
+.segment	"CODE"
+
+	.dbg	line, "bool1.c", 41
+	ldx     #$00
+	lda     _achar0
+	cmp     #$00
+	jsr     booleq
+	jne     L0003
+	lda     _achar1
+	jne     L0003
+	ldx     #$00
+	lda     #$00
+	jeq     L0004
+L0003:	ldx     #$00
+	lda     #$01
+L0004:	jeq     L0002
+	.dbg	line, "bool1.c", 42
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bool1.c", 43
+L0002:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ bool_test2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_bool_test2: near
+
+	.dbg	func, "bool_test2", "00", extern, "_bool_test2"
+
+.segment	"CODE"
+
+	.dbg	line, "bool1.c", 47
+	ldx     #$00
+	lda     _achar0
+	cmp     #$00
+	jsr     booleq
+	jne     L0003
+	lda     _aint0
+	ora     _aint0+1
+	jne     L0003
+	ldx     #$00
+	lda     #$00
+	jeq     L0004
+L0003:	ldx     #$00
+	lda     #$01
+L0004:	jeq     L0002
+	.dbg	line, "bool1.c", 48
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bool1.c", 49
+L0002:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ bool_and1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_bool_and1: near
+
+	.dbg	func, "bool_and1", "00", extern, "_bool_and1"
+
+.segment	"CODE"
+
+	.dbg	line, "bool1.c", 53
+	lda     _achar0
+	jeq     L0003
+	lda     _achar1
+	jne     L0004
+L0003:	ldx     #$00
+	lda     #$00
+	jeq     L0005
+L0004:	ldx     #$00
+	lda     #$01
+L0005:	jeq     L0002
+	.dbg	line, "bool1.c", 54
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bool1.c", 55
+L0002:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ bin_or1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_bin_or1: near
+
+	.dbg	func, "bin_or1", "00", extern, "_bin_or1"
+	.dbg	sym, "t", "00", auto, -1
+
+.segment	"CODE"
+
+	.dbg	line, "bool1.c", 61
+	jsr     decsp1
+	ldx     #$00
+	lda     _achar0
+	jsr     pushax
+	ldx     #$00
+	lda     _achar1
+	jsr     tosorax
+	ldx     #$00
+	ldy     #$00
+	sta     (sp),y
+	.dbg	line, "bool1.c", 62
+	ldy     #$00
+	lda     (sp),y
+	jeq     L0002
+	.dbg	line, "bool1.c", 63
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bool1.c", 64
+L0002:	jsr     incsp1
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ bin_xor1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_bin_xor1: near
+
+	.dbg	func, "bin_xor1", "00", extern, "_bin_xor1"
+
+.segment	"CODE"
+
+	.dbg	line, "bool1.c", 68
+	ldx     #$00
+	lda     _achar0
+	jsr     pushax
+	ldx     #$00
+	lda     _achar1
+	jsr     tosxorax
+	stx     tmp1
+	ora     tmp1
+	jeq     L0002
+	.dbg	line, "bool1.c", 69
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bool1.c", 70
+L0002:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ bool_test3 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_bool_test3: near
+
+	.dbg	func, "bool_test3", "00", extern, "_bool_test3"
+
+.segment	"CODE"
+
+	.dbg	line, "bool1.c", 74
+	ldx     #$00
+	lda     _achar0
+	cmp     #$42
+	jsr     booleq
+	jne     L0003
+	ldx     #$00
+	lda     _achar1
+	cmp     #$2A
+	jsr     booleq
+	jne     L0003
+	ldx     #$00
+	lda     #$00
+	jeq     L0004
+L0003:	ldx     #$00
+	lda     #$01
+L0004:	jeq     L0002
+	.dbg	line, "bool1.c", 75
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bool1.c", 76
+L0002:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ bool_or_lit1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_bool_or_lit1: near
+
+	.dbg	func, "bool_or_lit1", "00", extern, "_bool_or_lit1"
+
+.segment	"CODE"
+
+	.dbg	line, "bool1.c", 80
+	ldx     #$00
+	lda     _achar0
+	ora     #$0F
+	sta     _achar0
+	.dbg	line, "bool1.c", 82
+	ldx     #$00
+	lda     _achar0
+	cmp     #$11
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	.dbg	line, "bool1.c", 83
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bool1.c", 85
+L0002:	ldx     #$00
+	lda     _achar0
+	ora     #$10
+	cmp     #$F1
+	txa
+	sbc     #$00
+	bvs     L0004
+	eor     #$80
+L0004:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0003
+	.dbg	line, "bool1.c", 86
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bool1.c", 87
+L0003:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ bool_and_lit1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_bool_and_lit1: near
+
+	.dbg	func, "bool_and_lit1", "00", extern, "_bool_and_lit1"
+
+.segment	"CODE"
+
+	.dbg	line, "bool1.c", 91
+	ldx     #$00
+	lda     _achar0
+	and     #$F0
+	sta     _achar0
+	.dbg	line, "bool1.c", 93
+	ldx     #$00
+	lda     _achar0
+	cmp     #$11
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	.dbg	line, "bool1.c", 94
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bool1.c", 96
+L0002:	ldx     #$00
+	lda     _achar0
+	ldx     #$00
+	and     #$10
+	cmp     #$F1
+	txa
+	sbc     #$00
+	bvs     L0004
+	eor     #$80
+L0004:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0003
+	.dbg	line, "bool1.c", 97
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bool1.c", 99
+L0003:	ldx     #$00
+	lda     _achar0
+	and     #$EF
+	sta     _achar0
+	.dbg	line, "bool1.c", 100
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "bool1.c", 104
+	jsr     _bool_or1
+	.dbg	line, "bool1.c", 105
+	jsr     _bool_or2
+	.dbg	line, "bool1.c", 106
+	jsr     _bool_and1
+	.dbg	line, "bool1.c", 107
+	jsr     _bin_or1
+	.dbg	line, "bool1.c", 108
+	jsr     _bin_xor1
+	.dbg	line, "bool1.c", 110
+	ldx     #$00
+	lda     _achar0
+	inc     _achar0
+	.dbg	line, "bool1.c", 111
+	jsr     _bool_and1
+	.dbg	line, "bool1.c", 112
+	jsr     _bool_test1
+	.dbg	line, "bool1.c", 113
+	jsr     _bool_test2
+	.dbg	line, "bool1.c", 114
+	jsr     _bool_test3
+	.dbg	line, "bool1.c", 116
+	ldx     #$00
+	lda     _achar0
+	dec     _achar0
+	ldx     #$00
+	lda     _achar1
+	inc     _achar1
+	.dbg	line, "bool1.c", 117
+	jsr     _bool_and1
+	.dbg	line, "bool1.c", 119
+	ldx     #$00
+	lda     #$00
+	sta     _achar0
+	.dbg	line, "bool1.c", 120
+	ldx     #$00
+	lda     #$00
+	sta     _achar1
+	.dbg	line, "bool1.c", 122
+	jsr     _bool_or_lit1
+	.dbg	line, "bool1.c", 123
+	jsr     _bool_and_lit1
+	.dbg	line, "bool1.c", 125
+	ldx     #$00
+	lda     _failures
+	sta     _success
+	.dbg	line, "bool1.c", 126
+	jsr     _done
+	.dbg	line, "bool1.c", 127
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bool1.c", 129
+	ldx     #$00
+	lda     _failures
+	jmp     L0001
+	.dbg	line, "bool1.c", 130
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,208 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_success
+	.export		_failures
+	.export		_dummy
+	.export		_ui0
+	.export		_ui1
+	.export		_uc0
+	.export		_uc1
+	.export		_uL0
+	.export		_uL1
+	.export		_done
+	.export		_compound_compare_uc
+	.export		_compound_compare_ui
+	.export		_compound_compare_ul
+	.export		_compound_compare_uc_lit
+	.export		_main
+
+.segment	"DATA"
+
+_success:
+	.byte	$00
+_failures:
+	.byte	$00
+_dummy:
+	.byte	$00
+_ui0:
+	.word	$0000
+_ui1:
+	.word	$0000
+_uc0:
+	.byte	$00
+_uc1:
+	.byte	$00
+_uL0:
+	.dword	$00000000
+_uL1:
+	.dword	$00000000
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ done (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_done: near
+
+.segment	"CODE"
+
+	inc     _dummy
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ compound_compare_uc (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_compound_compare_uc: near
+
+.segment	"CODE"
+
+	lda     _uc0
+	cmp     _uc1
+	jsr     boolne
+	clc
+	adc     _failures
+	sta     _failures
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ compound_compare_ui (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_compound_compare_ui: near
+
+.segment	"CODE"
+
+	lda     _ui1
+	ldx     _ui1+1
+	cpx     _ui0+1
+	bne     L0002
+	cmp     _ui0
+L0002:	jsr     boolne
+	clc
+	adc     _failures
+	sta     _failures
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ compound_compare_ul (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_compound_compare_ul: near
+
+.segment	"CODE"
+
+	lda     _uL0+3
+	sta     sreg+1
+	lda     _uL0+2
+	sta     sreg
+	ldx     _uL0+1
+	lda     _uL0
+	jsr     pusheax
+	lda     _uL1+3
+	sta     sreg+1
+	lda     _uL1+2
+	sta     sreg
+	ldx     _uL1+1
+	lda     _uL1
+	jsr     tosneeax
+	clc
+	adc     _failures
+	sta     _failures
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ compound_compare_uc_lit (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_compound_compare_uc_lit: near
+
+.segment	"CODE"
+
+	lda     _uc0
+	cmp     #$FF
+	jsr     boolne
+	clc
+	adc     _failures
+	sta     _failures
+	lda     _uc0
+	cmp     #$FF
+	jsr     boolne
+	clc
+	adc     _failures
+	sta     _failures
+	lda     _uc0
+	jsr     booleq
+	clc
+	adc     _failures
+	sta     _failures
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     _compound_compare_uc
+	jsr     _compound_compare_ui
+	jsr     _compound_compare_ul
+	lda     #$FF
+	sta     _uc0
+	jsr     _compound_compare_uc_lit
+	lda     _failures
+	sta     _success
+	jsr     _done
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     _failures
+	rts
+
+.endproc
+
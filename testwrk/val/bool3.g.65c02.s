@@ -0,0 +1,279 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "bool3.c", 1011, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/limits.h", 3146, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_success
+	.export		_failures
+	.export		_dummy
+	.export		_ui0
+	.export		_ui1
+	.export		_uc0
+	.export		_uc1
+	.export		_uL0
+	.export		_uL1
+	.export		_done
+	.export		_compound_compare_uc
+	.export		_compound_compare_ui
+	.export		_compound_compare_ul
+	.export		_compound_compare_uc_lit
+	.export		_main
+
+.segment	"DATA"
+
+_success:
+	.byte	$00
+_failures:
+	.byte	$00
+_dummy:
+	.byte	$00
+_ui0:
+	.word	$0000
+_ui1:
+	.word	$0000
+_uc0:
+	.byte	$00
+_uc1:
+	.byte	$00
+_uL0:
+	.dword	$00000000
+_uL1:
+	.dword	$00000000
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ done (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_done: near
+
+	.dbg	func, "done", "00", extern, "_done"
+
+.segment	"CODE"
+
+	.dbg	line, "bool3.c", 27
+	ldx     #$00
+	lda     _dummy
+	inc     _dummy
+	.dbg	line, "bool3.c", 28
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ compound_compare_uc (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_compound_compare_uc: near
+
+	.dbg	func, "compound_compare_uc", "00", extern, "_compound_compare_uc"
+
+.segment	"CODE"
+
+	.dbg	line, "bool3.c", 32
+	ldx     #$00
+	lda     _uc0
+	jsr     pushax
+	ldx     #$00
+	lda     _uc1
+	jsr     tosneax
+	ldx     #$00
+	ldx     #$00
+	clc
+	adc     _failures
+	sta     _failures
+	.dbg	line, "bool3.c", 33
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ compound_compare_ui (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_compound_compare_ui: near
+
+	.dbg	func, "compound_compare_ui", "00", extern, "_compound_compare_ui"
+
+.segment	"CODE"
+
+	.dbg	line, "bool3.c", 37
+	lda     _ui0
+	ldx     _ui0+1
+	jsr     pushax
+	lda     _ui1
+	ldx     _ui1+1
+	jsr     tosneax
+	ldx     #$00
+	ldx     #$00
+	clc
+	adc     _failures
+	sta     _failures
+	.dbg	line, "bool3.c", 38
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ compound_compare_ul (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_compound_compare_ul: near
+
+	.dbg	func, "compound_compare_ul", "00", extern, "_compound_compare_ul"
+
+.segment	"CODE"
+
+	.dbg	line, "bool3.c", 42
+	lda     _uL0+3
+	sta     sreg+1
+	lda     _uL0+2
+	sta     sreg
+	ldx     _uL0+1
+	lda     _uL0
+	jsr     pusheax
+	lda     _uL1+3
+	sta     sreg+1
+	lda     _uL1+2
+	sta     sreg
+	ldx     _uL1+1
+	lda     _uL1
+	jsr     tosneeax
+	ldx     #$00
+	ldx     #$00
+	clc
+	adc     _failures
+	sta     _failures
+	.dbg	line, "bool3.c", 43
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ compound_compare_uc_lit (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_compound_compare_uc_lit: near
+
+	.dbg	func, "compound_compare_uc_lit", "00", extern, "_compound_compare_uc_lit"
+
+.segment	"CODE"
+
+	.dbg	line, "bool3.c", 47
+	ldx     #$00
+	lda     _uc0
+	cmp     #$FF
+	jsr     boolne
+	ldx     #$00
+	ldx     #$00
+	clc
+	adc     _failures
+	sta     _failures
+	.dbg	line, "bool3.c", 48
+	ldx     #$00
+	lda     _uc0
+	cmp     #$FF
+	jsr     boolne
+	ldx     #$00
+	ldx     #$00
+	clc
+	adc     _failures
+	sta     _failures
+	.dbg	line, "bool3.c", 49
+	ldx     #$00
+	lda     _uc0
+	cmp     #$00
+	jsr     booleq
+	ldx     #$00
+	ldx     #$00
+	clc
+	adc     _failures
+	sta     _failures
+	.dbg	line, "bool3.c", 50
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "bool3.c", 54
+	jsr     _compound_compare_uc
+	.dbg	line, "bool3.c", 55
+	jsr     _compound_compare_ui
+	.dbg	line, "bool3.c", 56
+	jsr     _compound_compare_ul
+	.dbg	line, "bool3.c", 58
+	ldx     #$00
+	lda     #$FF
+	sta     _uc0
+	.dbg	line, "bool3.c", 59
+	jsr     _compound_compare_uc_lit
+	.dbg	line, "bool3.c", 61
+	ldx     #$00
+	lda     _failures
+	sta     _success
+	.dbg	line, "bool3.c", 62
+	jsr     _done
+	.dbg	line, "bool3.c", 63
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bool3.c", 65
+	ldx     #$00
+	lda     _failures
+	jmp     L0001
+	.dbg	line, "bool3.c", 66
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,56 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "bss-name-decl.c", 437, 1613073744
+	.forceimport	__STARTUP__
+	.export		_n
+	.export		_main
+
+.segment	"DATA"
+
+_n:
+	.byte	$01
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "bss-name-decl.c", 21
+	lda     #<(_n)
+	ldx     #>(_n)
+	cmp     #$00
+	txa
+	sbc     #$01
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0003
+L0002:	ldx     #$00
+	lda     #$01
+L0003:	jmp     L0001
+	.dbg	line, "bss-name-decl.c", 22
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,44 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.export		_zp_var
+	.export		_main
+
+.segment	"BSS"
+
+.segment	"ZEROPAGE"
+_zp_var:
+	.res	1,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	ldx     #>(_zp_var)
+	cpx     #$01
+	bcs     L0002
+	ldx     #$00
+	txa
+	rts
+L0002:	ldx     #$00
+	lda     #$01
+	rts
+
+.endproc
+
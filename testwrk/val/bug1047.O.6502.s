@@ -0,0 +1,189 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+_cs:
+	.byte	$0C
+	.byte	$03
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$20,$28,$63,$73,$29,$20
+	.byte	$3D,$20,$25,$7A,$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20
+	.byte	$32,$2E,$0A,$00
+S0003:
+	.byte	$47,$6F,$74,$20,$63,$73,$2E,$62,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A,$00
+S0004:
+	.byte	$47,$6F,$74,$20,$63,$73,$2E,$63,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$33,$2E,$0A,$00
+S0005:
+	.byte	$47,$6F,$74,$20,$63,$73,$2E,$61,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$37,$2E,$0A,$00
+S0006:
+	.byte	$47,$6F,$74,$20,$63,$73,$2E,$62,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$36,$2E,$0A,$00
+S0007:
+	.byte	$47,$6F,$74,$20,$63,$73,$2E,$63,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A,$00
+S0002:
+	.byte	$47,$6F,$74,$20,$63,$73,$2E,$61,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$34,$2E,$0A,$00
+S0008:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ test_char_bitfield (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_char_bitfield: near
+
+.segment	"CODE"
+
+	lda     _cs
+	and     #$07
+	cmp     #$04
+	beq     L0003
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     _cs
+	and     #$07
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0003:	lda     _cs
+	lsr     a
+	lsr     a
+	lsr     a
+	and     #$07
+	cmp     #$01
+	beq     L0004
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     _cs
+	lsr     a
+	lsr     a
+	lsr     a
+	and     #$07
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0004:	lda     _cs+1
+	and     #$07
+	cmp     #$03
+	beq     L0009
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     _cs+1
+	and     #$07
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0009:	lda     _cs
+	ora     #$07
+	sta     _cs
+	and     #$C7
+	ora     #$30
+	sta     _cs
+	lda     _cs+1
+	and     #$F8
+	ora     #$01
+	sta     _cs+1
+	lda     _cs
+	and     #$07
+	cmp     #$07
+	beq     L0006
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     _cs
+	and     #$07
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0006:	lda     _cs
+	lsr     a
+	lsr     a
+	lsr     a
+	and     #$07
+	cmp     #$06
+	beq     L0007
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	lda     _cs
+	lsr     a
+	lsr     a
+	lsr     a
+	and     #$07
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0007:	lda     _cs+1
+	and     #$07
+	cmp     #$01
+	beq     L0008
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	lda     _cs+1
+	and     #$07
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0008:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     _test_char_bitfield
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     _failures
+	rts
+
+.endproc
+
@@ -0,0 +1,277 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "bug1047.c", 2065, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+_cs:
+	.byte	$0C
+	.byte	$03
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$20,$28,$63,$73,$29,$20
+	.byte	$3D,$20,$25,$7A,$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20
+	.byte	$32,$2E,$0A,$00
+S0003:
+	.byte	$47,$6F,$74,$20,$63,$73,$2E,$62,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A,$00
+S0004:
+	.byte	$47,$6F,$74,$20,$63,$73,$2E,$63,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$33,$2E,$0A,$00
+S0005:
+	.byte	$47,$6F,$74,$20,$63,$73,$2E,$61,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$37,$2E,$0A,$00
+S0006:
+	.byte	$47,$6F,$74,$20,$63,$73,$2E,$62,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$36,$2E,$0A,$00
+S0007:
+	.byte	$47,$6F,$74,$20,$63,$73,$2E,$63,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A,$00
+S0002:
+	.byte	$47,$6F,$74,$20,$63,$73,$2E,$61,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$34,$2E,$0A,$00
+S0008:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ test_char_bitfield (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_char_bitfield: near
+
+	.dbg	func, "test_char_bitfield", "00", static, "_test_char_bitfield"
+
+.segment	"CODE"
+
+	.dbg	line, "bug1047.c", 37
+	jmp     L0002
+	.dbg	line, "bug1047.c", 38
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1047.c", 39
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1047.c", 42
+L0002:	lda     _cs
+	ldx     #$00
+	and     #$07
+	cmp     #$04
+	jsr     boolne
+	jeq     L0003
+	.dbg	line, "bug1047.c", 43
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     _cs
+	ldx     #$00
+	and     #$07
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1047.c", 44
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1047.c", 47
+L0003:	lda     _cs
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	and     #$07
+	cmp     #$01
+	jsr     boolne
+	jeq     L0004
+	.dbg	line, "bug1047.c", 48
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     _cs
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	and     #$07
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1047.c", 49
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1047.c", 52
+L0004:	lda     _cs+1
+	ldx     #$00
+	and     #$07
+	cmp     #$03
+	jsr     boolne
+	jeq     L0005
+	.dbg	line, "bug1047.c", 53
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     _cs+1
+	ldx     #$00
+	and     #$07
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1047.c", 54
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1047.c", 57
+L0005:	ldx     #$00
+	lda     _cs
+	ora     #$07
+	sta     _cs
+	.dbg	line, "bug1047.c", 58
+	ldx     #$00
+	lda     _cs
+	and     #$C7
+	ora     #$30
+	sta     _cs
+	.dbg	line, "bug1047.c", 59
+	ldx     #$00
+	lda     _cs+1
+	and     #$F8
+	ora     #$01
+	sta     _cs+1
+	.dbg	line, "bug1047.c", 61
+	lda     _cs
+	ldx     #$00
+	and     #$07
+	cmp     #$07
+	jsr     boolne
+	jeq     L0006
+	.dbg	line, "bug1047.c", 62
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     _cs
+	ldx     #$00
+	and     #$07
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1047.c", 63
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1047.c", 66
+L0006:	lda     _cs
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	and     #$07
+	cmp     #$06
+	jsr     boolne
+	jeq     L0007
+	.dbg	line, "bug1047.c", 67
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	lda     _cs
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	and     #$07
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1047.c", 68
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1047.c", 71
+L0007:	lda     _cs+1
+	ldx     #$00
+	and     #$07
+	cmp     #$01
+	jsr     boolne
+	jeq     L0008
+	.dbg	line, "bug1047.c", 72
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	lda     _cs+1
+	ldx     #$00
+	and     #$07
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1047.c", 73
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1047.c", 75
+L0008:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "bug1047.c", 79
+	jsr     _test_char_bitfield
+	.dbg	line, "bug1047.c", 80
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1047.c", 81
+	ldx     #$00
+	lda     _failures
+	jmp     L0001
+	.dbg	line, "bug1047.c", 82
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,256 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "bug1071.c", 1793, 1613073744
+	.dbg		file, "/root/repo/include/stdlib.h", 5999, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/stdint.h", 6196, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_ghostLevel
+	.export		_level
+	.export		_loop
+	.export		_ghosts
+	.export		_bombs
+	.export		_test1
+	.export		_test2
+	.export		_res
+	.export		_main
+
+.segment	"DATA"
+
+_res:
+	.word	$0000
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$74,$65,$73,$74,$32,$20,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+S0001:
+	.byte	$74,$65,$73,$74,$31,$20,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+
+.segment	"BSS"
+
+_ghostLevel:
+	.res	2,$00
+_level:
+	.res	1,$00
+_loop:
+	.res	2,$00
+_ghosts:
+	.res	50,$00
+_bombs:
+	.res	15,$00
+
+; ---------------------------------------------------------------
+; unsigned int __near__ test1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test1: near
+
+	.dbg	func, "test1", "00", extern, "_test1"
+
+.segment	"CODE"
+
+	.dbg	line, "bug1071.c", 56
+	lda     _loop
+	ldx     _loop+1
+	cpx     #$02
+	bne     L0003
+	cmp     #$58
+L0003:	jsr     boolult
+	jeq     L0004
+	lda     _ghostLevel
+	ldx     _ghostLevel+1
+	cpx     #$01
+	bne     L0005
+	cmp     #$D2
+L0005:	jsr     boolult
+	jne     L0006
+L0004:	ldx     #$00
+	lda     #$00
+	jeq     L0007
+L0006:	ldx     #$00
+	lda     #$01
+L0007:	jeq     L0002
+	.dbg	line, "bug1071.c", 58
+	ldx     #$3E
+	lda     #$80
+	jsr     pushax
+	ldx     #$00
+	lda     _level
+	tax
+	lda     #$00
+	jsr     tossubax
+	jsr     pushax
+	lda     _ghostLevel
+	ldx     _ghostLevel+1
+	jsr     shlax3
+	jsr     tossubax
+	jmp     L0001
+	.dbg	line, "bug1071.c", 60
+L0002:	ldx     #$0B
+	lda     #$B8
+	jmp     L0001
+	.dbg	line, "bug1071.c", 61
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ test2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test2: near
+
+	.dbg	func, "test2", "00", extern, "_test2"
+
+.segment	"CODE"
+
+	.dbg	line, "bug1071.c", 65
+	lda     _loop
+	ldx     _loop+1
+	cpx     #$02
+	bne     L0003
+	cmp     #$58
+L0003:	jsr     boolult
+	jeq     L0004
+	lda     _ghostLevel
+	ldx     _ghostLevel+1
+	cpx     #$01
+	bne     L0005
+	cmp     #$D2
+L0005:	jsr     boolult
+	jne     L0006
+L0004:	ldx     #$00
+	lda     #$00
+	jeq     L0007
+L0006:	ldx     #$00
+	lda     #$01
+L0007:	jeq     L0002
+	.dbg	line, "bug1071.c", 67
+	ldx     #$3E
+	lda     #$80
+	jsr     pushax
+	ldx     #$00
+	lda     _level
+	tax
+	lda     #$00
+	jsr     tossubax
+	jsr     pushax
+	lda     _ghostLevel
+	ldx     _ghostLevel+1
+	jsr     shlax4
+	jsr     tossubax
+	jmp     L0001
+	.dbg	line, "bug1071.c", 69
+L0002:	ldx     #$0B
+	lda     #$B8
+	jmp     L0001
+	.dbg	line, "bug1071.c", 70
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "bug1071.c", 76
+	ldx     #$00
+	lda     #$07
+	sta     _loop
+	stx     _loop+1
+	.dbg	line, "bug1071.c", 77
+	ldx     #$00
+	lda     #$0D
+	sta     _ghostLevel
+	stx     _ghostLevel+1
+	.dbg	line, "bug1071.c", 78
+	ldx     #$00
+	lda     #$03
+	sta     _level
+	.dbg	line, "bug1071.c", 80
+	jsr     _test1
+	sta     _res
+	stx     _res+1
+	.dbg	line, "bug1071.c", 81
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _res
+	ldx     _res+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1071.c", 82
+	lda     _res
+	ldx     _res+1
+	cpx     #$3B
+	bne     L0003
+	cmp     #$18
+L0003:	jsr     boolne
+	jeq     L0002
+	ldx     #$FF
+	lda     #$FF
+	jmp     L0001
+	.dbg	line, "bug1071.c", 83
+L0002:	jsr     _test2
+	sta     _res
+	stx     _res+1
+	.dbg	line, "bug1071.c", 84
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     _res
+	ldx     _res+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1071.c", 85
+	lda     _res
+	ldx     _res+1
+	cpx     #$3A
+	bne     L0005
+	cmp     #$B0
+L0005:	jsr     boolne
+	jeq     L0004
+	ldx     #$FF
+	lda     #$FF
+	jmp     L0001
+	.dbg	line, "bug1071.c", 86
+L0004:	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "bug1071.c", 87
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,124 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.import		_memset
+	.export		_rhs
+	.export		_test
+	.export		_res
+	.export		_main
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+
+.segment	"BSS"
+
+_rhs:
+	.res	4,$00
+_res:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; int __near__ test (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test: near
+
+.segment	"CODE"
+
+	lda     $D77C
+	jsr     pusha0
+	lda     _rhs+3
+	sta     sreg+1
+	lda     _rhs+2
+	sta     sreg
+	ldx     _rhs+1
+	lda     _rhs
+	jsr     tosulong
+	jmp     tosaddeax
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     $D76C
+	sta     ptr1
+	stz     ptr1+1
+	ldy     #$7F
+	lda     #$0B
+L0002:	sta     (ptr1),y
+	dey
+	bpl     L0002
+	stz     sreg
+	stz     sreg+1
+	lda     #$10
+	sta     _rhs
+	stz     _rhs+1
+	ldy     sreg
+	sty     _rhs+2
+	ldy     sreg+1
+	sty     _rhs+3
+	sty     sreg+1
+	lda     _rhs+2
+	sta     sreg
+	ldx     _rhs+1
+	lda     _rhs
+	jsr     pusheax
+	ldx     #$D7
+	lda     #$7C
+	jsr     tosadd0ax
+	sta     sreg
+	stx     sreg+1
+	lda     #$0D
+	sta     (sreg)
+	lda     #$17
+	sta     $D77C
+	lda     #$2A
+	sta     $D78C
+	jsr     _test
+	sta     _res
+	stx     _res+1
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _res
+	ldx     _res+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     _res+1
+	bne     L0005
+	lda     _res
+	cmp     #$27
+	beq     L0003
+L0005:	ldx     #$00
+	lda     #$01
+	rts
+L0003:	ldx     #$00
+	txa
+	rts
+
+.endproc
+
@@ -0,0 +1,167 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "bug1075.c", 599, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/stdlib.h", 5999, 1613073744
+	.dbg		file, "/root/repo/include/string.h", 5104, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.dbg		sym, "memset", "00", extern, "_memset"
+	.import		_printf
+	.import		_memset
+	.export		_rhs
+	.export		_test
+	.export		_res
+	.export		_main
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+
+.segment	"BSS"
+
+_rhs:
+	.res	4,$00
+_res:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; int __near__ test (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test: near
+
+	.dbg	func, "test", "00", extern, "_test"
+
+.segment	"CODE"
+
+	.dbg	line, "bug1075.c", 13
+	ldx     #$00
+	lda     $D77C
+	jsr     pushax
+	lda     _rhs+3
+	sta     sreg+1
+	lda     _rhs+2
+	sta     sreg
+	ldx     _rhs+1
+	lda     _rhs
+	jsr     tosulong
+	jsr     tosaddeax
+	jmp     L0001
+	.dbg	line, "bug1075.c", 14
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "bug1075.c", 20
+	ldx     #$00
+	lda     $D76C
+	jsr     pushax
+	ldx     #$00
+	lda     #$0B
+	jsr     pushax
+	ldx     #$00
+	lda     #$80
+	jsr     _memset
+	.dbg	line, "bug1075.c", 21
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$10
+	sta     _rhs
+	stx     _rhs+1
+	ldy     sreg
+	sty     _rhs+2
+	ldy     sreg+1
+	sty     _rhs+3
+	.dbg	line, "bug1075.c", 22
+	lda     _rhs+3
+	sta     sreg+1
+	lda     _rhs+2
+	sta     sreg
+	ldx     _rhs+1
+	lda     _rhs
+	jsr     pusheax
+	ldx     #$D7
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$7C
+	jsr     tosaddeax
+	jsr     pushax
+	ldx     #$00
+	lda     #$0D
+	ldy     #$00
+	jsr     staspidx
+	.dbg	line, "bug1075.c", 23
+	ldx     #$00
+	lda     #$17
+	sta     $D77C
+	.dbg	line, "bug1075.c", 24
+	ldx     #$00
+	lda     #$2A
+	sta     $D78C
+	.dbg	line, "bug1075.c", 25
+	jsr     _test
+	sta     _res
+	stx     _res+1
+	.dbg	line, "bug1075.c", 26
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _res
+	ldx     _res+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1075.c", 27
+	lda     _res
+	ldx     _res+1
+	cpx     #$00
+	bne     L0003
+	cmp     #$27
+L0003:	jsr     boolne
+	jeq     L0002
+	.dbg	line, "bug1075.c", 28
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+	.dbg	line, "bug1075.c", 30
+L0002:	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "bug1075.c", 31
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,145 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_test1
+	.export		_test2
+	.export		_main
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$25,$64,$0A,$00
+S0001	:=	S0002+0
+
+; ---------------------------------------------------------------
+; int __near__ test1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test1: near
+
+.segment	"CODE"
+
+	jsr     push0
+	jsr     ldax0sp
+	jsr     aslax1
+	clc
+	adc     sp
+	sta     ptr1
+	txa
+	adc     sp+1
+	sta     ptr1+1
+	lda     #$2A
+	sta     (ptr1)
+	ldy     #$01
+	lda     #$00
+	sta     (ptr1),y
+	jsr     ldax0sp
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test2: near
+
+.segment	"CODE"
+
+	jsr     push0
+	jsr     push0
+	jsr     ldax0sp
+	jsr     aslax1
+	clc
+	adc     #$02
+	bcc     L0002
+	inx
+	clc
+L0002:	adc     sp
+	sta     ptr1
+	txa
+	adc     sp+1
+	sta     ptr1+1
+	lda     #$2A
+	sta     (ptr1)
+	ldy     #$01
+	lda     #$00
+	sta     (ptr1),y
+	ldy     #$03
+	jsr     ldaxysp
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	jsr     push0
+	jsr     _test1
+	ldy     #$02
+	jsr     staxysp
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldy     #$03
+	lda     (sp),y
+	bne     L0006
+	dey
+	lda     (sp),y
+	cmp     #$2A
+	beq     L0002
+L0006:	ldx     #$00
+	lda     #$01
+	jsr     stax0sp
+L0002:	jsr     _test2
+	ldy     #$02
+	jsr     staxysp
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldy     #$03
+	lda     (sp),y
+	bne     L0007
+	dey
+	lda     (sp),y
+	cmp     #$2A
+	beq     L0004
+L0007:	ldx     #$00
+	lda     #$01
+	jsr     stax0sp
+L0004:	jsr     ldax0sp
+	jmp     incsp4
+
+.endproc
+
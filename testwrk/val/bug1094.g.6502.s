@@ -0,0 +1,408 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "bug1094.c", 1925, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/stdlib.h", 5999, 1613073744
+	.dbg		file, "/root/repo/include/stdint.h", 6196, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_wwqq
+	.export		_g
+	.export		_h
+	.export		_x
+	.export		_div3
+	.export		_main
+
+.segment	"DATA"
+
+_wwqq:
+	.byte	$00
+	.byte	$52
+	.byte	$00
+	.byte	$43
+	.byte	$00
+_g:
+	.byte	$5D
+	.byte	$00
+_h:
+	.byte	$5D
+	.byte	$00
+_x:
+	.byte	$04
+	.byte	$35
+	.res	1,$00
+
+.segment	"RODATA"
+
+S0008:
+	.byte	$28,$6C,$6F,$6E,$67,$29,$78,$2E,$62,$20,$3D,$20,$25,$6C,$64,$2C
+	.byte	$20,$73,$69,$7A,$65,$6F,$66,$28,$78,$29,$20,$3D,$20,$25,$75,$2C
+	.byte	$20,$73,$69,$7A,$65,$6F,$66,$28,$28,$6C,$6F,$6E,$67,$29,$78,$2E
+	.byte	$61,$29,$20,$3D,$20,$25,$75,$0A,$00
+S0009:
+	.byte	$2D,$78,$2E,$64,$20,$3D,$20,$25,$64,$2C,$20,$28,$6C,$6F,$6E,$67
+	.byte	$29,$28,$2D,$78,$2E,$63,$20,$2B,$20,$31,$29,$20,$3D,$20,$25,$6C
+	.byte	$64,$0A,$00
+S0007:
+	.byte	$78,$2E,$61,$20,$3D,$20,$25,$64,$2C,$20,$78,$2E,$62,$20,$3D,$20
+	.byte	$25,$64,$2C,$20,$78,$2E,$63,$20,$3D,$20,$25,$64,$0A,$00
+S0006:
+	.byte	$67,$2E,$61,$20,$3D,$20,$25,$75,$2C,$20,$67,$2E,$62,$20,$3D,$20
+	.byte	$25,$75,$2C,$20,$67,$2E,$63,$20,$3D,$20,$25,$64,$0A,$00
+S000A:
+	.byte	$68,$2E,$61,$20,$3D,$20,$25,$75,$2C,$20,$68,$2E,$62,$20,$3D,$20
+	.byte	$25,$75,$2C,$20,$68,$2E,$63,$20,$3D,$20,$25,$75,$0A,$00
+S0004:
+	.byte	$71,$75,$6F,$74,$20,$3D,$20,$25,$75,$2C,$20,$72,$65,$6D,$20,$3D
+	.byte	$20,$25,$75,$0A,$00
+S0003	:=	S0004+0
+S0005	:=	S0004+0
+S0002:
+	.byte	$25,$64,$20,$25,$64,$20,$25,$64,$0A,$00
+S0001	:=	S0002+0
+
+; ---------------------------------------------------------------
+; struct $anon-struct-000A __near__ div3 (struct $anon-struct-000A u)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_div3: near
+
+	.dbg	func, "div3", "00", extern, "_div3"
+	.dbg	sym, "u", "00", auto, 0
+	.dbg	sym, "v", "00", auto, -4
+
+.segment	"CODE"
+
+	.dbg	line, "bug1094.c", 68
+	jsr     pusheax
+	.dbg	line, "bug1094.c", 69
+	jsr     decsp4
+	ldy     #$03
+L0002:	lda     M0001,y
+	sta     (sp),y
+	dey
+	bpl     L0002
+	.dbg	line, "bug1094.c", 71
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldx     #$01
+	lda     #$55
+	jsr     tosaddax
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "bug1094.c", 72
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     incax1
+	ldy     #$06
+	jsr     staxysp
+	.dbg	line, "bug1094.c", 74
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     #$00
+	jsr     steaxysp
+	.dbg	line, "bug1094.c", 76
+	ldy     #$03
+	jsr     ldeaxysp
+	jmp     L0001
+	.dbg	line, "bug1094.c", 77
+L0001:	jsr     incsp8
+	rts
+
+	.dbg	line
+.segment	"RODATA"
+
+M0001:
+	.res	4,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+	.dbg	sym, "v", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -16
+
+.segment	"CODE"
+
+	.dbg	line, "bug1094.c", 81
+	jsr     decsp4
+	ldy     #$03
+L0002:	lda     M0001,y
+	sta     (sp),y
+	dey
+	bpl     L0002
+	.dbg	line, "bug1094.c", 82
+	ldy     #$0C
+	jsr     subysp
+	ldy     #$0B
+L0003:	lda     M0002,y
+	sta     (sp),y
+	dey
+	bpl     L0003
+	.dbg	line, "bug1094.c", 84
+	ldy     #$03
+	jsr     ldeaxysp
+	jsr     _div3
+	ldy     #$0C
+	jsr     steaxysp
+	.dbg	line, "bug1094.c", 86
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _wwqq
+	ldx     #$00
+	and     #$0F
+	jsr     pushax
+	lda     _wwqq+1
+	ldx     #$00
+	and     #$0F
+	jsr     pushax
+	lda     _wwqq+1
+	ldx     _wwqq+1+1
+	jsr     shrax4
+	ldx     #$00
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "bug1094.c", 87
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     _wwqq
+	ldx     #$00
+	and     #$0F
+	jsr     pushax
+	lda     _wwqq+3
+	ldx     #$00
+	and     #$0F
+	jsr     pushax
+	lda     _wwqq+3
+	ldx     _wwqq+3+1
+	jsr     shrax4
+	ldx     #$00
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "bug1094.c", 88
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$11
+	jsr     ldeaxysp
+	jsr     _div3
+	jsr     pushax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     _div3
+	ldy     #$00
+	ldx     sreg+1
+	lda     sreg
+	sty     sreg+1
+	sty     sreg
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "bug1094.c", 89
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "bug1094.c", 90
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "bug1094.c", 91
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	lda     _g
+	tay
+	and     #$04
+	beq     L0004
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L0005
+L0004:	tya
+	ldx     #$00
+	and     #$07
+L0005:	jsr     pushax
+	lda     _g
+	lsr     a
+	lsr     a
+	lsr     a
+	tay
+	and     #$04
+	beq     L0006
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L0007
+L0006:	tya
+	ldx     #$00
+	and     #$07
+L0007:	jsr     pushax
+	lda     _g
+	ldx     _g+1
+	jsr     shrax4
+	jsr     shrax2
+	tay
+	and     #$04
+	beq     L0008
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L0009
+L0008:	tya
+	ldx     #$00
+	and     #$07
+L0009:	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "bug1094.c", 92
+	ldx     #$05
+	lda     #$BB
+	sta     _x
+	stx     _x+1
+	.dbg	line, "bug1094.c", 93
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	lda     _x
+	ldx     #$00
+	and     #$07
+	jsr     pushax
+	lda     _x+1
+	ldx     #$00
+	and     #$07
+	jsr     pushax
+	lda     _x+1
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	and     #$07
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "bug1094.c", 94
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	lda     _x+1
+	ldx     #$00
+	and     #$07
+	jsr     axulong
+	jsr     pusheax
+	ldx     #$00
+	lda     #$03
+	jsr     pushax
+	ldx     #$00
+	lda     #$04
+	jsr     pushax
+	ldy     #$0A
+	jsr     _printf
+	.dbg	line, "bug1094.c", 95
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	lda     _x+1
+	ldx     _x+1+1
+	jsr     negax
+	jsr     pushax
+	lda     _x+1
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	and     #$07
+	jsr     negax
+	jsr     incax1
+	jsr     axulong
+	jsr     pusheax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "bug1094.c", 96
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	lda     _h
+	ldx     #$00
+	and     #$07
+	jsr     pushax
+	lda     _h
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	and     #$07
+	jsr     pushax
+	lda     _h
+	ldx     _h+1
+	jsr     shrax4
+	jsr     shrax2
+	ldx     #$00
+	and     #$07
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "bug1094.c", 98
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "bug1094.c", 99
+L0001:	ldy     #$10
+	jsr     addysp
+	rts
+
+	.dbg	line
+.segment	"RODATA"
+
+M0001:
+	.word	$008D
+	.word	$0020
+M0002:
+	.word	$008D
+	.word	$0020
+	.res	8,$00
+
+.endproc
+
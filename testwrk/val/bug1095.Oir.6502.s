@@ -0,0 +1,941 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+_si:
+	.byte	$FC
+	.byte	$18
+	.byte	$04
+	.byte	$9C
+	.byte	$78
+	.byte	$EC
+
+.segment	"RODATA"
+
+S0017:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$66,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$70,$6F,$73,$69,$74,$69,$76,$65
+	.byte	$2E,$0A,$00
+S0003:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$62,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$6E,$65,$67,$61,$74,$69,$76,$65
+	.byte	$2E,$0A,$00
+S0015:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$65,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$70,$6F,$73,$69,$74,$69,$76,$65
+	.byte	$2E,$0A,$00
+S0005:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$63,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$70,$6F,$73,$69,$74,$69,$76,$65
+	.byte	$2E,$0A,$00
+S0013:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$64,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$70,$6F,$73,$69,$74,$69,$76,$65
+	.byte	$2E,$0A,$00
+S0007:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$64,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$6E,$65,$67,$61,$74,$69,$76,$65
+	.byte	$2E,$0A,$00
+S0011:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$63,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$6E,$65,$67,$61,$74,$69,$76,$65
+	.byte	$2E,$0A,$00
+S0009:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$65,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$6E,$65,$67,$61,$74,$69,$76,$65
+	.byte	$2E,$0A,$00
+S000F:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$62,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$70,$6F,$73,$69,$74,$69,$76,$65
+	.byte	$2E,$0A,$00
+S000B:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$66,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$6E,$65,$67,$61,$74,$69,$76,$65
+	.byte	$2E,$0A,$00
+S000D:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$61,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$6E,$65,$67,$61,$74,$69,$76,$65
+	.byte	$2E,$0A,$00
+S0001	:=	S000D+0
+S000C:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$66,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$2D,$35,$30,$30,$30,$2E,$0A,$00
+S000A:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$65,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$2D,$31,$30,$30,$2E,$0A,$00
+S0018:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$66,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$35,$30,$30,$30,$2E,$0A,$00
+S0008:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$64,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$2D,$35,$30,$30,$2E,$0A,$00
+S0014:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$64,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$35,$30,$30,$2E,$0A,$00
+S0016:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$65,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$30,$2E,$0A,$00
+S0012:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$63,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$2D,$32,$2E,$0A,$00
+S0004:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$62,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$2D,$31,$2E,$0A,$00
+S0002:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$61,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$2D,$34,$2E,$0A,$00
+S000E:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$61,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$2D,$33,$2E,$0A,$00
+S0010:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$62,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A,$00
+S0006:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$63,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$33,$2E,$0A,$00
+S0019:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ test_signed_bitfield (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_signed_bitfield: near
+
+.segment	"CODE"
+
+	lda     _si
+	tay
+	and     #$04
+	beq     L0003
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L0004
+L0003:	tya
+	ldx     #$00
+	and     #$07
+L0004:	txa
+	bmi     L0002
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _si
+	tay
+	and     #$04
+	beq     L0005
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L0006
+L0005:	tya
+	ldx     #$00
+	and     #$07
+L0006:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0002:	lda     _si
+	tay
+	and     #$04
+	beq     L0008
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L0009
+L0008:	tya
+	ldx     #$00
+	and     #$07
+L0009:	cpx     #$FF
+	bne     L0074
+	cmp     #$FC
+	beq     L0007
+L0074:	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     _si
+	tay
+	and     #$04
+	beq     L000B
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L000C
+L000B:	tya
+	ldx     #$00
+	and     #$07
+L000C:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0007:	lda     _si
+	lsr     a
+	lsr     a
+	lsr     a
+	tay
+	and     #$04
+	beq     L000E
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L000F
+L000E:	tya
+	ldx     #$00
+	and     #$07
+L000F:	txa
+	bmi     L000D
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     _si
+	lsr     a
+	lsr     a
+	lsr     a
+	tay
+	and     #$04
+	beq     L0010
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L0011
+L0010:	tya
+	ldx     #$00
+	and     #$07
+L0011:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L000D:	lda     _si
+	lsr     a
+	lsr     a
+	lsr     a
+	tay
+	and     #$04
+	beq     L0013
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L0014
+L0013:	tya
+	ldx     #$00
+	and     #$07
+L0014:	cpx     #$FF
+	bne     L0075
+	cmp     #$FF
+	beq     L0012
+L0075:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     _si
+	lsr     a
+	lsr     a
+	lsr     a
+	tay
+	and     #$04
+	beq     L0016
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L0017
+L0016:	tya
+	ldx     #$00
+	and     #$07
+L0017:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0012:	lda     _si
+	ldx     _si+1
+	jsr     shrax4
+	jsr     shrax2
+	tay
+	and     #$04
+	beq     L0019
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L001A
+L0019:	tya
+	ldx     #$00
+	and     #$07
+L001A:	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L001B
+	eor     #$80
+L001B:	bpl     L0018
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     _si
+	ldx     _si+1
+	jsr     shrax4
+	jsr     shrax2
+	tay
+	and     #$04
+	beq     L001C
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L001D
+L001C:	tya
+	ldx     #$00
+	and     #$07
+L001D:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0018:	lda     _si
+	ldx     _si+1
+	jsr     shrax4
+	jsr     shrax2
+	tay
+	and     #$04
+	beq     L001F
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L0020
+L001F:	tya
+	ldx     #$00
+	and     #$07
+L0020:	cpx     #$00
+	bne     L0076
+	cmp     #$03
+	beq     L001E
+L0076:	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	lda     _si
+	ldx     _si+1
+	jsr     shrax4
+	jsr     shrax2
+	tay
+	and     #$04
+	beq     L0022
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L0023
+L0022:	tya
+	ldx     #$00
+	and     #$07
+L0023:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L001E:	lda     _si+1
+	ldx     _si+1+1
+	jsr     shrax1
+	txa
+	and     #$02
+	beq     L0025
+	txa
+	ora     #$FC
+	jmp     L0080
+L0025:	txa
+	and     #$03
+L0080:	bmi     L0024
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	lda     _si+1
+	ldx     _si+1+1
+	jsr     shrax1
+	tay
+	txa
+	and     #$02
+	beq     L0027
+	tya
+	pha
+	txa
+	ora     #$FC
+	tax
+	pla
+	jmp     L0028
+L0027:	txa
+	and     #$03
+	tax
+	tya
+L0028:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0024:	lda     _si+1
+	ldx     _si+1+1
+	jsr     shrax1
+	tay
+	txa
+	and     #$02
+	beq     L002A
+	tya
+	pha
+	txa
+	ora     #$FC
+	tax
+	pla
+	jmp     L002B
+L002A:	txa
+	and     #$03
+	tax
+	tya
+L002B:	cpx     #$FE
+	bne     L0077
+	cmp     #$0C
+	beq     L0029
+L0077:	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	lda     _si+1
+	ldx     _si+1+1
+	jsr     shrax1
+	tay
+	txa
+	and     #$02
+	beq     L002D
+	tya
+	pha
+	txa
+	ora     #$FC
+	tax
+	pla
+	jmp     L002E
+L002D:	txa
+	and     #$03
+	tax
+	tya
+L002E:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0029:	ldx     #$00
+	lda     _si+3
+	bpl     L0030
+	dex
+L0030:	txa
+	bmi     L002F
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldx     #$00
+	lda     _si+3
+	bpl     L0031
+	dex
+L0031:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L002F:	ldx     #$00
+	lda     _si+3
+	bpl     L0033
+	dex
+L0033:	cpx     #$FF
+	bne     L0078
+	cmp     #$9C
+	beq     L0032
+L0078:	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldx     #$00
+	lda     _si+3
+	bpl     L0035
+	dex
+L0035:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0032:	ldx     _si+4+1
+	bmi     L0036
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	lda     _si+4
+	ldx     _si+4+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0036:	lda     _si+4+1
+	cmp     #$EC
+	bne     L0079
+	lda     _si+4
+	cmp     #$78
+	beq     L0037
+L0079:	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	lda     _si+4
+	ldx     _si+4+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0037:	lda     _si
+	and     #$F8
+	ora     #$05
+	sta     _si
+	and     #$C7
+	ora     #$08
+	sta     _si
+	tay
+	lda     _si+1
+	and     #$FE
+	tax
+	tya
+	and     #$3F
+	ora     #$80
+	sta     _si
+	txa
+	ora     #$01
+	sta     _si+1
+	lda     _si+1+1
+	and     #$F8
+	tax
+	lda     _si+1
+	and     #$01
+	ora     #$E8
+	sta     _si+1
+	txa
+	ora     #$03
+	sta     _si+1+1
+	lda     #$64
+	sta     _si+3
+	lda     #$88
+	sta     _si+4
+	ldx     #$13
+	stx     _si+4+1
+	lda     _si
+	tay
+	and     #$04
+	beq     L003A
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L003B
+L003A:	tya
+	ldx     #$00
+	and     #$07
+L003B:	txa
+	bmi     L0039
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	lda     _si
+	tay
+	and     #$04
+	beq     L003C
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L003D
+L003C:	tya
+	ldx     #$00
+	and     #$07
+L003D:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0039:	lda     _si
+	tay
+	and     #$04
+	beq     L003F
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L0040
+L003F:	tya
+	ldx     #$00
+	and     #$07
+L0040:	cpx     #$FF
+	bne     L007A
+	cmp     #$FD
+	beq     L003E
+L007A:	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	lda     _si
+	tay
+	and     #$04
+	beq     L0042
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L0043
+L0042:	tya
+	ldx     #$00
+	and     #$07
+L0043:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L003E:	lda     _si
+	lsr     a
+	lsr     a
+	lsr     a
+	tay
+	and     #$04
+	beq     L0045
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L0046
+L0045:	tya
+	ldx     #$00
+	and     #$07
+L0046:	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0047
+	eor     #$80
+L0047:	bpl     L0044
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	lda     _si
+	lsr     a
+	lsr     a
+	lsr     a
+	tay
+	and     #$04
+	beq     L0048
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L0049
+L0048:	tya
+	ldx     #$00
+	and     #$07
+L0049:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0044:	lda     _si
+	lsr     a
+	lsr     a
+	lsr     a
+	tay
+	and     #$04
+	beq     L004B
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L004C
+L004B:	tya
+	ldx     #$00
+	and     #$07
+L004C:	cpx     #$00
+	bne     L007B
+	cmp     #$01
+	beq     L004A
+L007B:	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	lda     _si
+	lsr     a
+	lsr     a
+	lsr     a
+	tay
+	and     #$04
+	beq     L004E
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L004F
+L004E:	tya
+	ldx     #$00
+	and     #$07
+L004F:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L004A:	lda     _si
+	ldx     _si+1
+	jsr     shrax4
+	jsr     shrax2
+	tay
+	and     #$04
+	beq     L0051
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L0052
+L0051:	tya
+	ldx     #$00
+	and     #$07
+L0052:	txa
+	bmi     L0050
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	lda     _si
+	ldx     _si+1
+	jsr     shrax4
+	jsr     shrax2
+	tay
+	and     #$04
+	beq     L0053
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L0054
+L0053:	tya
+	ldx     #$00
+	and     #$07
+L0054:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0050:	lda     _si
+	ldx     _si+1
+	jsr     shrax4
+	jsr     shrax2
+	tay
+	and     #$04
+	beq     L0056
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L0057
+L0056:	tya
+	ldx     #$00
+	and     #$07
+L0057:	cpx     #$FF
+	bne     L007C
+	cmp     #$FE
+	beq     L0055
+L007C:	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	lda     _si
+	ldx     _si+1
+	jsr     shrax4
+	jsr     shrax2
+	tay
+	and     #$04
+	beq     L0059
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L005A
+L0059:	tya
+	ldx     #$00
+	and     #$07
+L005A:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0055:	lda     _si+1
+	ldx     _si+1+1
+	jsr     shrax1
+	tay
+	txa
+	and     #$02
+	beq     L005C
+	tya
+	pha
+	txa
+	ora     #$FC
+	tax
+	pla
+	jmp     L005D
+L005C:	txa
+	and     #$03
+	tax
+	tya
+L005D:	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L005E
+	eor     #$80
+L005E:	bpl     L005B
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	lda     _si+1
+	ldx     _si+1+1
+	jsr     shrax1
+	tay
+	txa
+	and     #$02
+	beq     L005F
+	tya
+	pha
+	txa
+	ora     #$FC
+	tax
+	pla
+	jmp     L0060
+L005F:	txa
+	and     #$03
+	tax
+	tya
+L0060:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L005B:	lda     _si+1
+	ldx     _si+1+1
+	jsr     shrax1
+	tay
+	txa
+	and     #$02
+	beq     L0062
+	tya
+	pha
+	txa
+	ora     #$FC
+	tax
+	pla
+	jmp     L0063
+L0062:	txa
+	and     #$03
+	tax
+	tya
+L0063:	cpx     #$01
+	bne     L007D
+	cmp     #$F4
+	beq     L0061
+L007D:	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	lda     _si+1
+	ldx     _si+1+1
+	jsr     shrax1
+	tay
+	txa
+	and     #$02
+	beq     L0065
+	tya
+	pha
+	txa
+	ora     #$FC
+	tax
+	pla
+	jmp     L0066
+L0065:	txa
+	and     #$03
+	tax
+	tya
+L0066:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0061:	ldx     #$00
+	lda     _si+3
+	bpl     L0068
+	dex
+L0068:	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0069
+	eor     #$80
+L0069:	asl     a
+	ldx     #$00
+	bcc     L0073
+	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+	ldx     #$00
+	lda     _si+3
+	bpl     L006A
+	dex
+L006A:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	ldx     #$00
+L0073:	lda     _si+3
+	bpl     L006C
+	dex
+L006C:	cpx     #$00
+	bne     L007E
+	cmp     #$64
+	beq     L006B
+L007E:	lda     #<(S0016)
+	ldx     #>(S0016)
+	jsr     pushax
+	ldx     #$00
+	lda     _si+3
+	bpl     L006E
+	dex
+L006E:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L006B:	lda     _si+4
+	cmp     #$01
+	lda     _si+4+1
+	sbc     #$00
+	bvc     L0070
+	eor     #$80
+L0070:	bpl     L006F
+	lda     #<(S0017)
+	ldx     #>(S0017)
+	jsr     pushax
+	lda     _si+4
+	ldx     _si+4+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L006F:	lda     _si+4+1
+	cmp     #$13
+	bne     L007F
+	lda     _si+4
+	cmp     #$88
+	beq     L0071
+L007F:	lda     #<(S0018)
+	ldx     #>(S0018)
+	jsr     pushax
+	lda     _si+4
+	ldx     _si+4+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0071:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     _test_signed_bitfield
+	lda     #<(S0019)
+	ldx     #>(S0019)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     _failures
+	rts
+
+.endproc
+
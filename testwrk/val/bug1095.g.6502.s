@@ -0,0 +1,1184 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "bug1095.c", 4053, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+_si:
+	.byte	$FC
+	.byte	$18
+	.byte	$04
+	.byte	$9C
+	.byte	$78
+	.byte	$EC
+
+.segment	"RODATA"
+
+S0017:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$66,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$70,$6F,$73,$69,$74,$69,$76,$65
+	.byte	$2E,$0A,$00
+S0003:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$62,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$6E,$65,$67,$61,$74,$69,$76,$65
+	.byte	$2E,$0A,$00
+S0015:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$65,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$70,$6F,$73,$69,$74,$69,$76,$65
+	.byte	$2E,$0A,$00
+S0005:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$63,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$70,$6F,$73,$69,$74,$69,$76,$65
+	.byte	$2E,$0A,$00
+S0013:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$64,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$70,$6F,$73,$69,$74,$69,$76,$65
+	.byte	$2E,$0A,$00
+S0007:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$64,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$6E,$65,$67,$61,$74,$69,$76,$65
+	.byte	$2E,$0A,$00
+S0011:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$63,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$6E,$65,$67,$61,$74,$69,$76,$65
+	.byte	$2E,$0A,$00
+S0009:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$65,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$6E,$65,$67,$61,$74,$69,$76,$65
+	.byte	$2E,$0A,$00
+S000F:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$62,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$70,$6F,$73,$69,$74,$69,$76,$65
+	.byte	$2E,$0A,$00
+S000B:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$66,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$6E,$65,$67,$61,$74,$69,$76,$65
+	.byte	$2E,$0A,$00
+S000D:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$61,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$6E,$65,$67,$61,$74,$69,$76,$65
+	.byte	$2E,$0A,$00
+S0001	:=	S000D+0
+S000C:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$66,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$2D,$35,$30,$30,$30,$2E,$0A,$00
+S000A:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$65,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$2D,$31,$30,$30,$2E,$0A,$00
+S0018:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$66,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$35,$30,$30,$30,$2E,$0A,$00
+S0008:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$64,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$2D,$35,$30,$30,$2E,$0A,$00
+S0014:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$64,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$35,$30,$30,$2E,$0A,$00
+S0016:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$65,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$30,$2E,$0A,$00
+S0012:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$63,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$2D,$32,$2E,$0A,$00
+S0004:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$62,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$2D,$31,$2E,$0A,$00
+S0002:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$61,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$2D,$34,$2E,$0A,$00
+S000E:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$61,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$2D,$33,$2E,$0A,$00
+S0010:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$62,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A,$00
+S0006:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$63,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$33,$2E,$0A,$00
+S0019:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ test_signed_bitfield (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_signed_bitfield: near
+
+	.dbg	func, "test_signed_bitfield", "00", static, "_test_signed_bitfield"
+
+.segment	"CODE"
+
+	.dbg	line, "bug1095.c", 41
+	lda     _si
+	tay
+	and     #$04
+	beq     L0003
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L0004
+L0003:	tya
+	ldx     #$00
+	and     #$07
+L0004:	txa
+	jsr     boolge
+	jeq     L0002
+	.dbg	line, "bug1095.c", 42
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _si
+	tay
+	and     #$04
+	beq     L0005
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L0006
+L0005:	tya
+	ldx     #$00
+	and     #$07
+L0006:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1095.c", 43
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1095.c", 45
+L0002:	lda     _si
+	tay
+	and     #$04
+	beq     L0008
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L0009
+L0008:	tya
+	ldx     #$00
+	and     #$07
+L0009:	cpx     #$FF
+	bne     L000A
+	cmp     #$FC
+L000A:	jsr     boolne
+	jeq     L0007
+	.dbg	line, "bug1095.c", 46
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     _si
+	tay
+	and     #$04
+	beq     L000B
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L000C
+L000B:	tya
+	ldx     #$00
+	and     #$07
+L000C:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1095.c", 47
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1095.c", 50
+L0007:	lda     _si
+	lsr     a
+	lsr     a
+	lsr     a
+	tay
+	and     #$04
+	beq     L000E
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L000F
+L000E:	tya
+	ldx     #$00
+	and     #$07
+L000F:	txa
+	jsr     boolge
+	jeq     L000D
+	.dbg	line, "bug1095.c", 51
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     _si
+	lsr     a
+	lsr     a
+	lsr     a
+	tay
+	and     #$04
+	beq     L0010
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L0011
+L0010:	tya
+	ldx     #$00
+	and     #$07
+L0011:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1095.c", 52
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1095.c", 54
+L000D:	lda     _si
+	lsr     a
+	lsr     a
+	lsr     a
+	tay
+	and     #$04
+	beq     L0013
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L0014
+L0013:	tya
+	ldx     #$00
+	and     #$07
+L0014:	cpx     #$FF
+	bne     L0015
+	cmp     #$FF
+L0015:	jsr     boolne
+	jeq     L0012
+	.dbg	line, "bug1095.c", 55
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     _si
+	lsr     a
+	lsr     a
+	lsr     a
+	tay
+	and     #$04
+	beq     L0016
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L0017
+L0016:	tya
+	ldx     #$00
+	and     #$07
+L0017:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1095.c", 56
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1095.c", 59
+L0012:	lda     _si
+	ldx     _si+1
+	jsr     shrax4
+	jsr     shrax2
+	tay
+	and     #$04
+	beq     L0019
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L001A
+L0019:	tya
+	ldx     #$00
+	and     #$07
+L001A:	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L001B
+	eor     #$80
+L001B:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0018
+	.dbg	line, "bug1095.c", 60
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     _si
+	ldx     _si+1
+	jsr     shrax4
+	jsr     shrax2
+	tay
+	and     #$04
+	beq     L001C
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L001D
+L001C:	tya
+	ldx     #$00
+	and     #$07
+L001D:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1095.c", 61
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1095.c", 63
+L0018:	lda     _si
+	ldx     _si+1
+	jsr     shrax4
+	jsr     shrax2
+	tay
+	and     #$04
+	beq     L001F
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L0020
+L001F:	tya
+	ldx     #$00
+	and     #$07
+L0020:	cpx     #$00
+	bne     L0021
+	cmp     #$03
+L0021:	jsr     boolne
+	jeq     L001E
+	.dbg	line, "bug1095.c", 64
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	lda     _si
+	ldx     _si+1
+	jsr     shrax4
+	jsr     shrax2
+	tay
+	and     #$04
+	beq     L0022
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L0023
+L0022:	tya
+	ldx     #$00
+	and     #$07
+L0023:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1095.c", 65
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1095.c", 68
+L001E:	lda     _si+1
+	ldx     _si+1+1
+	jsr     shrax1
+	tay
+	txa
+	and     #$02
+	beq     L0025
+	tya
+	ora     #$00
+	pha
+	txa
+	ora     #$FC
+	tax
+	pla
+	jmp     L0026
+L0025:	tya
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+L0026:	txa
+	jsr     boolge
+	jeq     L0024
+	.dbg	line, "bug1095.c", 69
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	lda     _si+1
+	ldx     _si+1+1
+	jsr     shrax1
+	tay
+	txa
+	and     #$02
+	beq     L0027
+	tya
+	ora     #$00
+	pha
+	txa
+	ora     #$FC
+	tax
+	pla
+	jmp     L0028
+L0027:	tya
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+L0028:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1095.c", 70
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1095.c", 72
+L0024:	lda     _si+1
+	ldx     _si+1+1
+	jsr     shrax1
+	tay
+	txa
+	and     #$02
+	beq     L002A
+	tya
+	ora     #$00
+	pha
+	txa
+	ora     #$FC
+	tax
+	pla
+	jmp     L002B
+L002A:	tya
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+L002B:	cpx     #$FE
+	bne     L002C
+	cmp     #$0C
+L002C:	jsr     boolne
+	jeq     L0029
+	.dbg	line, "bug1095.c", 73
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	lda     _si+1
+	ldx     _si+1+1
+	jsr     shrax1
+	tay
+	txa
+	and     #$02
+	beq     L002D
+	tya
+	ora     #$00
+	pha
+	txa
+	ora     #$FC
+	tax
+	pla
+	jmp     L002E
+L002D:	tya
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+L002E:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1095.c", 74
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1095.c", 77
+L0029:	ldx     #$00
+	lda     _si+3
+	bpl     L0030
+	dex
+L0030:	txa
+	jsr     boolge
+	jeq     L002F
+	.dbg	line, "bug1095.c", 78
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldx     #$00
+	lda     _si+3
+	bpl     L0031
+	dex
+L0031:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1095.c", 79
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1095.c", 81
+L002F:	ldx     #$00
+	lda     _si+3
+	bpl     L0033
+	dex
+L0033:	cpx     #$FF
+	bne     L0034
+	cmp     #$9C
+L0034:	jsr     boolne
+	jeq     L0032
+	.dbg	line, "bug1095.c", 82
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldx     #$00
+	lda     _si+3
+	bpl     L0035
+	dex
+L0035:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1095.c", 83
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1095.c", 86
+L0032:	lda     _si+4
+	ldx     _si+4+1
+	txa
+	jsr     boolge
+	jeq     L0036
+	.dbg	line, "bug1095.c", 87
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	lda     _si+4
+	ldx     _si+4+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1095.c", 88
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1095.c", 90
+L0036:	lda     _si+4
+	ldx     _si+4+1
+	cpx     #$EC
+	bne     L0038
+	cmp     #$78
+L0038:	jsr     boolne
+	jeq     L0037
+	.dbg	line, "bug1095.c", 91
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	lda     _si+4
+	ldx     _si+4+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1095.c", 92
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1095.c", 95
+L0037:	ldx     #$00
+	lda     _si
+	and     #$F8
+	ora     #$05
+	sta     _si
+	.dbg	line, "bug1095.c", 96
+	ldx     #$00
+	lda     _si
+	and     #$C7
+	ora     #$08
+	sta     _si
+	.dbg	line, "bug1095.c", 97
+	lda     _si
+	ldx     _si+1
+	tay
+	txa
+	and     #$FE
+	tax
+	tya
+	and     #$3F
+	ora     #$80
+	pha
+	txa
+	ora     #$01
+	tax
+	pla
+	sta     _si
+	stx     _si+1
+	.dbg	line, "bug1095.c", 98
+	lda     _si+1
+	ldx     _si+1+1
+	tay
+	txa
+	and     #$F8
+	tax
+	tya
+	and     #$01
+	ora     #$E8
+	pha
+	txa
+	ora     #$03
+	tax
+	pla
+	sta     _si+1
+	stx     _si+1+1
+	.dbg	line, "bug1095.c", 99
+	ldx     #$00
+	lda     _si+3
+	lda     #$00
+	ora     #$64
+	sta     _si+3
+	.dbg	line, "bug1095.c", 100
+	lda     _si+4
+	ldx     _si+4+1
+	txa
+	and     #$00
+	tax
+	lda     #$00
+	ora     #$88
+	pha
+	txa
+	ora     #$13
+	tax
+	pla
+	sta     _si+4
+	stx     _si+4+1
+	.dbg	line, "bug1095.c", 102
+	lda     _si
+	tay
+	and     #$04
+	beq     L003A
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L003B
+L003A:	tya
+	ldx     #$00
+	and     #$07
+L003B:	txa
+	jsr     boolge
+	jeq     L0039
+	.dbg	line, "bug1095.c", 103
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	lda     _si
+	tay
+	and     #$04
+	beq     L003C
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L003D
+L003C:	tya
+	ldx     #$00
+	and     #$07
+L003D:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1095.c", 104
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1095.c", 106
+L0039:	lda     _si
+	tay
+	and     #$04
+	beq     L003F
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L0040
+L003F:	tya
+	ldx     #$00
+	and     #$07
+L0040:	cpx     #$FF
+	bne     L0041
+	cmp     #$FD
+L0041:	jsr     boolne
+	jeq     L003E
+	.dbg	line, "bug1095.c", 107
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	lda     _si
+	tay
+	and     #$04
+	beq     L0042
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L0043
+L0042:	tya
+	ldx     #$00
+	and     #$07
+L0043:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1095.c", 108
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1095.c", 111
+L003E:	lda     _si
+	lsr     a
+	lsr     a
+	lsr     a
+	tay
+	and     #$04
+	beq     L0045
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L0046
+L0045:	tya
+	ldx     #$00
+	and     #$07
+L0046:	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0047
+	eor     #$80
+L0047:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0044
+	.dbg	line, "bug1095.c", 112
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	lda     _si
+	lsr     a
+	lsr     a
+	lsr     a
+	tay
+	and     #$04
+	beq     L0048
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L0049
+L0048:	tya
+	ldx     #$00
+	and     #$07
+L0049:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1095.c", 113
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1095.c", 115
+L0044:	lda     _si
+	lsr     a
+	lsr     a
+	lsr     a
+	tay
+	and     #$04
+	beq     L004B
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L004C
+L004B:	tya
+	ldx     #$00
+	and     #$07
+L004C:	cpx     #$00
+	bne     L004D
+	cmp     #$01
+L004D:	jsr     boolne
+	jeq     L004A
+	.dbg	line, "bug1095.c", 116
+	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	lda     _si
+	lsr     a
+	lsr     a
+	lsr     a
+	tay
+	and     #$04
+	beq     L004E
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L004F
+L004E:	tya
+	ldx     #$00
+	and     #$07
+L004F:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1095.c", 117
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1095.c", 120
+L004A:	lda     _si
+	ldx     _si+1
+	jsr     shrax4
+	jsr     shrax2
+	tay
+	and     #$04
+	beq     L0051
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L0052
+L0051:	tya
+	ldx     #$00
+	and     #$07
+L0052:	txa
+	jsr     boolge
+	jeq     L0050
+	.dbg	line, "bug1095.c", 121
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	lda     _si
+	ldx     _si+1
+	jsr     shrax4
+	jsr     shrax2
+	tay
+	and     #$04
+	beq     L0053
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L0054
+L0053:	tya
+	ldx     #$00
+	and     #$07
+L0054:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1095.c", 122
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1095.c", 124
+L0050:	lda     _si
+	ldx     _si+1
+	jsr     shrax4
+	jsr     shrax2
+	tay
+	and     #$04
+	beq     L0056
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L0057
+L0056:	tya
+	ldx     #$00
+	and     #$07
+L0057:	cpx     #$FF
+	bne     L0058
+	cmp     #$FE
+L0058:	jsr     boolne
+	jeq     L0055
+	.dbg	line, "bug1095.c", 125
+	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	lda     _si
+	ldx     _si+1
+	jsr     shrax4
+	jsr     shrax2
+	tay
+	and     #$04
+	beq     L0059
+	tya
+	ora     #$F8
+	ldx     #$FF
+	jmp     L005A
+L0059:	tya
+	ldx     #$00
+	and     #$07
+L005A:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1095.c", 126
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1095.c", 129
+L0055:	lda     _si+1
+	ldx     _si+1+1
+	jsr     shrax1
+	tay
+	txa
+	and     #$02
+	beq     L005C
+	tya
+	ora     #$00
+	pha
+	txa
+	ora     #$FC
+	tax
+	pla
+	jmp     L005D
+L005C:	tya
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+L005D:	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L005E
+	eor     #$80
+L005E:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L005B
+	.dbg	line, "bug1095.c", 130
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	lda     _si+1
+	ldx     _si+1+1
+	jsr     shrax1
+	tay
+	txa
+	and     #$02
+	beq     L005F
+	tya
+	ora     #$00
+	pha
+	txa
+	ora     #$FC
+	tax
+	pla
+	jmp     L0060
+L005F:	tya
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+L0060:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1095.c", 131
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1095.c", 133
+L005B:	lda     _si+1
+	ldx     _si+1+1
+	jsr     shrax1
+	tay
+	txa
+	and     #$02
+	beq     L0062
+	tya
+	ora     #$00
+	pha
+	txa
+	ora     #$FC
+	tax
+	pla
+	jmp     L0063
+L0062:	tya
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+L0063:	cpx     #$01
+	bne     L0064
+	cmp     #$F4
+L0064:	jsr     boolne
+	jeq     L0061
+	.dbg	line, "bug1095.c", 134
+	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	lda     _si+1
+	ldx     _si+1+1
+	jsr     shrax1
+	tay
+	txa
+	and     #$02
+	beq     L0065
+	tya
+	ora     #$00
+	pha
+	txa
+	ora     #$FC
+	tax
+	pla
+	jmp     L0066
+L0065:	tya
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+L0066:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1095.c", 135
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1095.c", 138
+L0061:	ldx     #$00
+	lda     _si+3
+	bpl     L0068
+	dex
+L0068:	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0069
+	eor     #$80
+L0069:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0067
+	.dbg	line, "bug1095.c", 139
+	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+	ldx     #$00
+	lda     _si+3
+	bpl     L006A
+	dex
+L006A:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1095.c", 140
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1095.c", 142
+L0067:	ldx     #$00
+	lda     _si+3
+	bpl     L006C
+	dex
+L006C:	cpx     #$00
+	bne     L006D
+	cmp     #$64
+L006D:	jsr     boolne
+	jeq     L006B
+	.dbg	line, "bug1095.c", 143
+	lda     #<(S0016)
+	ldx     #>(S0016)
+	jsr     pushax
+	ldx     #$00
+	lda     _si+3
+	bpl     L006E
+	dex
+L006E:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1095.c", 144
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1095.c", 147
+L006B:	lda     _si+4
+	ldx     _si+4+1
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0070
+	eor     #$80
+L0070:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L006F
+	.dbg	line, "bug1095.c", 148
+	lda     #<(S0017)
+	ldx     #>(S0017)
+	jsr     pushax
+	lda     _si+4
+	ldx     _si+4+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1095.c", 149
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1095.c", 151
+L006F:	lda     _si+4
+	ldx     _si+4+1
+	cpx     #$13
+	bne     L0072
+	cmp     #$88
+L0072:	jsr     boolne
+	jeq     L0071
+	.dbg	line, "bug1095.c", 152
+	lda     #<(S0018)
+	ldx     #>(S0018)
+	jsr     pushax
+	lda     _si+4
+	ldx     _si+4+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1095.c", 153
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1095.c", 155
+L0071:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "bug1095.c", 159
+	jsr     _test_signed_bitfield
+	.dbg	line, "bug1095.c", 160
+	lda     #<(S0019)
+	ldx     #>(S0019)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1095.c", 161
+	ldx     #$00
+	lda     _failures
+	jmp     L0001
+	.dbg	line, "bug1095.c", 162
+L0001:	rts
+
+	.dbg	line
+.endproc
+
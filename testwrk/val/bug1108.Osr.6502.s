@@ -0,0 +1,137 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_x
+	.export		_main
+
+.segment	"DATA"
+
+_x:
+	.byte	$00
+_ret:
+	.byte	$00
+
+.segment	"RODATA"
+
+S0003:
+	.byte	$63,$78,$3A,$25,$64,$20,$63,$79,$3A,$25,$64,$20,$78,$3A,$25,$64
+	.byte	$0A,$00
+S0002:
+	.byte	$63,$78,$3A,$25,$64,$20,$78,$3A,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; unsigned char __near__ PrintVar1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_PrintVar1: near
+
+.segment	"CODE"
+
+	lda     _x
+	clc
+	adc     #$01
+	sta     M0001
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     M0001
+	jsr     pusha0
+	lda     _x
+	jsr     pusha0
+	ldy     #$06
+	jsr     _printf
+	lda     M0001
+	jmp     booleq
+
+.segment	"BSS"
+
+M0001:
+	.res	1,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ PrintVar2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_PrintVar2: near
+
+.segment	"CODE"
+
+	lda     _x
+	clc
+	adc     #$01
+	sta     M0001
+	lda     _x
+	clc
+	adc     #$01
+	sta     M0002
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     M0001
+	jsr     pusha0
+	lda     M0002
+	jsr     pusha0
+	lda     _x
+	jsr     pusha0
+	ldy     #$08
+	jsr     _printf
+	lda     M0001
+	cmp     M0002
+	jmp     boolne
+
+.segment	"BSS"
+
+M0001:
+	.res	1,$00
+M0002:
+	.res	1,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+L0005:	lda     _ret
+	jsr     pusha0
+	jsr     _PrintVar1
+	jsr     tosorax
+	sta     _ret
+	and     #$FF
+	jsr     pusha0
+	jsr     _PrintVar2
+	jsr     tosorax
+	sta     _ret
+	ldx     #$00
+	inc     _x
+	lda     _x
+	cmp     #$0A
+	bcc     L0005
+	lda     _ret
+	rts
+
+.endproc
+
@@ -0,0 +1,189 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "bug1108.c", 578, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_x
+	.export		_main
+
+.segment	"DATA"
+
+_x:
+	.byte	$00
+_ret:
+	.byte	$00
+
+.segment	"RODATA"
+
+S0003:
+	.byte	$63,$78,$3A,$25,$64,$20,$63,$79,$3A,$25,$64,$20,$78,$3A,$25,$64
+	.byte	$0A,$00
+S0002:
+	.byte	$63,$78,$3A,$25,$64,$20,$78,$3A,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; unsigned char __near__ PrintVar1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_PrintVar1: near
+
+	.dbg	func, "PrintVar1", "00", static, "_PrintVar1"
+
+.segment	"CODE"
+
+	.dbg	line, "bug1108.c", 12
+	ldx     #$00
+	lda     _x
+	jsr     incax1
+	ldx     #$00
+	sta     M0001
+	.dbg	line, "bug1108.c", 14
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldx     #$00
+	lda     M0001
+	jsr     pushax
+	ldx     #$00
+	lda     _x
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "bug1108.c", 15
+	ldx     #$00
+	lda     M0001
+	cmp     #$00
+	jsr     booleq
+	ldx     #$00
+	jmp     L0001
+	.dbg	line, "bug1108.c", 16
+L0001:	rts
+
+	.dbg	line
+.segment	"BSS"
+
+M0001:
+	.res	1,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ PrintVar2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_PrintVar2: near
+
+	.dbg	func, "PrintVar2", "00", static, "_PrintVar2"
+
+.segment	"CODE"
+
+	.dbg	line, "bug1108.c", 20
+	ldx     #$00
+	lda     _x
+	jsr     incax1
+	ldx     #$00
+	sta     M0001
+	.dbg	line, "bug1108.c", 23
+	ldx     #$00
+	lda     _x
+	jsr     incax1
+	ldx     #$00
+	sta     M0002
+	.dbg	line, "bug1108.c", 24
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldx     #$00
+	lda     M0001
+	jsr     pushax
+	ldx     #$00
+	lda     M0002
+	jsr     pushax
+	ldx     #$00
+	lda     _x
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "bug1108.c", 25
+	ldx     #$00
+	lda     M0001
+	jsr     pushax
+	ldx     #$00
+	lda     M0002
+	jsr     tosneax
+	ldx     #$00
+	jmp     L0001
+	.dbg	line, "bug1108.c", 26
+L0001:	rts
+
+	.dbg	line
+.segment	"BSS"
+
+M0001:
+	.res	1,$00
+M0002:
+	.res	1,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "bug1108.c", 33
+L0002:	ldx     #$00
+	lda     _ret
+	jsr     pushax
+	jsr     _PrintVar1
+	jsr     tosorax
+	sta     _ret
+	.dbg	line, "bug1108.c", 34
+	ldx     #$00
+	lda     _ret
+	jsr     pushax
+	jsr     _PrintVar2
+	jsr     tosorax
+	sta     _ret
+	.dbg	line, "bug1108.c", 35
+	ldx     #$00
+	inc     _x
+	lda     _x
+	cmp     #$0A
+	jsr     boolult
+	jne     L0002
+	.dbg	line, "bug1108.c", 36
+	ldx     #$00
+	lda     _ret
+	jmp     L0001
+	.dbg	line, "bug1108.c", 37
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,947 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+_fb:
+	.byte	$01
+_o:
+	.byte	$0B
+	.byte	$58
+	.byte	$00
+_fw:
+	.byte	$FF
+	.byte	$11
+	.byte	$00
+_ae:
+	.byte	$FC
+	.byte	$88
+	.byte	$00
+	.byte	$00
+	.byte	$19
+
+.segment	"RODATA"
+
+S0014:
+	.byte	$42,$61,$64,$2C,$20,$66,$77,$2E,$79,$20,$69,$73,$20,$74,$72,$75
+	.byte	$65,$20,$28,$33,$32,$31,$32,$33,$29,$0A,$00
+S0035	:=	S0014+0
+S003D:
+	.byte	$42,$61,$64,$2C,$20,$61,$65,$2E,$79,$20,$69,$73,$20,$74,$72,$75
+	.byte	$65,$20,$28,$32,$32,$32,$32,$29,$0A,$00
+S001C	:=	S003D+0
+S0010:
+	.byte	$42,$61,$64,$2C,$20,$66,$77,$2E,$78,$20,$69,$73,$20,$74,$72,$75
+	.byte	$65,$20,$28,$31,$31,$37,$29,$0A,$00
+S0031	:=	S0010+0
+S0020:
+	.byte	$42,$61,$64,$2C,$20,$61,$65,$2E,$7A,$20,$69,$73,$20,$74,$72,$75
+	.byte	$65,$20,$28,$31,$31,$31,$29,$0A,$00
+S0041	:=	S0020+0
+S002D:
+	.byte	$42,$61,$64,$2C,$20,$6F,$2E,$79,$20,$69,$73,$20,$74,$72,$75,$65
+	.byte	$20,$28,$33,$32,$31,$29,$0A,$00
+S0008:
+	.byte	$42,$61,$64,$2C,$20,$6F,$2E,$78,$20,$69,$73,$20,$74,$72,$75,$65
+	.byte	$20,$28,$31,$32,$33,$29,$0A,$00
+S000C	:=	S002D+0
+S0029	:=	S0008+0
+S0018:
+	.byte	$42,$61,$64,$2C,$20,$61,$65,$2E,$78,$20,$69,$73,$20,$74,$72,$75
+	.byte	$65,$20,$28,$32,$29,$0A,$00
+S0039	:=	S0018+0
+S0004:
+	.byte	$42,$61,$64,$2C,$20,$66,$62,$2E,$78,$20,$69,$73,$20,$74,$72,$75
+	.byte	$65,$20,$28,$31,$29,$0A,$00
+S0025	:=	S0004+0
+S0034:
+	.byte	$42,$61,$64,$2C,$20,$66,$77,$2E,$78,$20,$69,$73,$20,$66,$61,$6C
+	.byte	$73,$65,$0A,$00
+S003C:
+	.byte	$42,$61,$64,$2C,$20,$61,$65,$2E,$78,$20,$69,$73,$20,$66,$61,$6C
+	.byte	$73,$65,$0A,$00
+S0044:
+	.byte	$42,$61,$64,$2C,$20,$61,$65,$2E,$7A,$20,$69,$73,$20,$66,$61,$6C
+	.byte	$73,$65,$0A,$00
+S0015:
+	.byte	$42,$61,$64,$2C,$20,$66,$77,$2E,$79,$20,$69,$73,$20,$66,$61,$6C
+	.byte	$73,$65,$0A,$00
+S0028:
+	.byte	$42,$61,$64,$2C,$20,$66,$62,$2E,$78,$20,$69,$73,$20,$66,$61,$6C
+	.byte	$73,$65,$0A,$00
+S0040:
+	.byte	$42,$61,$64,$2C,$20,$61,$65,$2E,$79,$20,$69,$73,$20,$66,$61,$6C
+	.byte	$73,$65,$0A,$00
+S0038	:=	S0015+0
+S0019	:=	S003C+0
+S001D	:=	S0040+0
+S0011	:=	S0034+0
+S0005	:=	S0028+0
+S0021	:=	S0044+0
+S0030:
+	.byte	$42,$61,$64,$2C,$20,$6F,$2E,$79,$20,$69,$73,$20,$66,$61,$6C,$73
+	.byte	$65,$0A,$00
+S000D	:=	S0030+0
+S0009:
+	.byte	$42,$61,$64,$2C,$20,$6F,$2E,$78,$20,$69,$73,$20,$66,$61,$6C,$73
+	.byte	$65,$0A,$00
+S002C	:=	S0009+0
+S0024	:=	S0009+0
+S0001	:=	S0009+0
+S0045:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+S001F:
+	.byte	$47,$6F,$6F,$64,$0A,$00
+S0026	:=	S001F+0
+S0027	:=	S001F+0
+S001E	:=	S001F+0
+S001B	:=	S001F+0
+S002A	:=	S001F+0
+S002B	:=	S001F+0
+S001A	:=	S001F+0
+S0017	:=	S001F+0
+S002E	:=	S001F+0
+S002F	:=	S001F+0
+S0016	:=	S001F+0
+S0013	:=	S001F+0
+S0032	:=	S001F+0
+S0033	:=	S001F+0
+S0012	:=	S001F+0
+S000F	:=	S001F+0
+S0036	:=	S001F+0
+S0037	:=	S001F+0
+S000E	:=	S001F+0
+S000B	:=	S001F+0
+S003A	:=	S001F+0
+S003B	:=	S001F+0
+S000A	:=	S001F+0
+S0007	:=	S001F+0
+S003E	:=	S001F+0
+S003F	:=	S001F+0
+S0006	:=	S001F+0
+S0003	:=	S001F+0
+S0042	:=	S001F+0
+S0043	:=	S001F+0
+S0002	:=	S001F+0
+S0022	:=	S001F+0
+S0023	:=	S001F+0
+
+; ---------------------------------------------------------------
+; void __near__ test_if (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_if: near
+
+.segment	"CODE"
+
+	lda     _o+1
+	and     #$FC
+	sta     _o+1
+	lda     #$00
+	sta     _o
+	lda     _o+1+1
+	and     #$F0
+	sta     _o+1+1
+	lda     _o+1
+	and     #$03
+	ora     #$B0
+	sta     _o+1
+	and     #$03
+	sta     tmp1
+	lda     _o
+	ora     tmp1
+	beq     L0002
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+	jmp     L0024
+L0002:	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+L0024:	lda     _fb
+	and     #$F0
+	ora     #$01
+	sta     _fb
+	and     #$0F
+	tax
+	beq     L0004
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0005
+L0004:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+L0005:	lda     _fb
+	and     #$F0
+	sta     _fb
+	and     #$0F
+	tax
+	beq     L0006
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+	jmp     L0007
+L0006:	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+L0007:	lda     _o+1
+	and     #$FC
+	tax
+	lda     #$7B
+	sta     _o
+	stx     _o+1
+	txa
+	and     #$03
+	sta     tmp1
+	lda     #$7B
+	ora     tmp1
+	beq     L0008
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0009
+L0008:	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+L0009:	lda     _o+1
+	and     #$FC
+	tax
+	lda     #$00
+	sta     _o
+	stx     _o+1
+	txa
+	and     #$03
+	beq     L000A
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+	jmp     L000B
+L000A:	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+L000B:	lda     _o+1+1
+	and     #$F0
+	tax
+	lda     _o+1
+	and     #$03
+	ora     #$04
+	pha
+	txa
+	ora     #$05
+	tax
+	pla
+	sta     _o+1
+	stx     _o+1+1
+	tay
+	txa
+	and     #$0F
+	sta     tmp1
+	tya
+	and     #$FC
+	ora     tmp1
+	beq     L000C
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L000D
+L000C:	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+L000D:	lda     _o+1+1
+	and     #$F0
+	tax
+	lda     _o+1
+	and     #$03
+	sta     _o+1
+	stx     _o+1+1
+	tay
+	txa
+	and     #$0F
+	sta     tmp1
+	tya
+	and     #$FC
+	ora     tmp1
+	beq     L000E
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+	jmp     L0025
+L000E:	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+L0025:	lda     #$75
+	sta     _fw
+	and     #$FF
+	beq     L0010
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0011
+L0010:	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+L0011:	lda     #$00
+	sta     _fw
+	and     #$FF
+	beq     L0012
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+	jmp     L0013
+L0012:	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+L0013:	lda     #$7B
+	sta     _fw+1
+	ldx     #$7D
+	stx     _fw+1+1
+	lda     _fw+1
+	ora     _fw+1+1
+	beq     L0014
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0015
+L0014:	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+L0015:	lda     #$00
+	sta     _fw+1
+	sta     _fw+1+1
+	lda     _fw+1
+	ora     _fw+1+1
+	beq     L0016
+	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+	jmp     L0026
+L0016:	lda     #<(S0016)
+	ldx     #>(S0016)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+L0026:	lda     _ae
+	and     #$03
+	ora     #$08
+	sta     _ae
+	and     #$FC
+	tax
+	beq     L0018
+	lda     #<(S0017)
+	ldx     #>(S0017)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0019
+L0018:	lda     #<(S0018)
+	ldx     #>(S0018)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+L0019:	lda     _ae
+	and     #$03
+	sta     _ae
+	and     #$FC
+	tax
+	beq     L001A
+	lda     #<(S0019)
+	ldx     #>(S0019)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+	jmp     L001B
+L001A:	lda     #<(S001A)
+	ldx     #>(S001A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+L001B:	lda     _ae+1
+	and     #$07
+	ora     #$70
+	ldx     #$45
+	sta     _ae+1
+	stx     _ae+1+1
+	and     #$F8
+	stx     tmp1
+	ora     tmp1
+	beq     L001C
+	lda     #<(S001B)
+	ldx     #>(S001B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L001D
+L001C:	lda     #<(S001C)
+	ldx     #>(S001C)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+L001D:	ldx     #$00
+	lda     _ae+1
+	and     #$07
+	sta     _ae+1
+	stx     _ae+1+1
+	and     #$F8
+	beq     L001E
+	lda     #<(S001D)
+	ldx     #>(S001D)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+	jmp     L001F
+L001E:	lda     #<(S001E)
+	ldx     #>(S001E)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+L001F:	lda     _ae+3+1
+	and     #$E0
+	tax
+	lda     _ae+3
+	and     #$3F
+	ora     #$C0
+	pha
+	txa
+	ora     #$1B
+	tax
+	pla
+	sta     _ae+3
+	stx     _ae+3+1
+	tay
+	txa
+	and     #$1F
+	sta     tmp1
+	tya
+	and     #$C0
+	ora     tmp1
+	beq     L0020
+	lda     #<(S001F)
+	ldx     #>(S001F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0021
+L0020:	lda     #<(S0020)
+	ldx     #>(S0020)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+L0021:	lda     _ae+3+1
+	and     #$E0
+	tax
+	lda     _ae+3
+	and     #$3F
+	sta     _ae+3
+	stx     _ae+3+1
+	tay
+	txa
+	and     #$1F
+	sta     tmp1
+	tya
+	and     #$C0
+	ora     tmp1
+	beq     L0022
+	lda     #<(S0021)
+	ldx     #>(S0021)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+	rts
+L0022:	lda     #<(S0022)
+	ldx     #>(S0022)
+	jsr     pushax
+	ldy     #$02
+	jmp     _printf
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_if_not (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_if_not: near
+
+.segment	"CODE"
+
+	lda     _o+1
+	and     #$FC
+	sta     _o+1
+	lda     #$00
+	sta     _o
+	lda     _o+1+1
+	and     #$F0
+	sta     _o+1+1
+	lda     _o+1
+	and     #$03
+	ora     #$B0
+	sta     _o+1
+	and     #$03
+	tax
+	lda     _o
+	jsr     bnegax
+	beq     L0002
+	lda     #<(S0023)
+	ldx     #>(S0023)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0003
+L0002:	lda     #<(S0024)
+	ldx     #>(S0024)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+L0003:	lda     _fb
+	and     #$F0
+	ora     #$01
+	sta     _fb
+	and     #$0F
+	bne     L0004
+	lda     #<(S0025)
+	ldx     #>(S0025)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+	jmp     L0024
+L0004:	lda     #<(S0026)
+	ldx     #>(S0026)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+L0024:	lda     _fb
+	and     #$F0
+	sta     _fb
+	and     #$0F
+	bne     L0006
+	lda     #<(S0027)
+	ldx     #>(S0027)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0007
+L0006:	lda     #<(S0028)
+	ldx     #>(S0028)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+L0007:	lda     _o+1
+	and     #$FC
+	tax
+	lda     #$7B
+	sta     _o
+	stx     _o+1
+	txa
+	and     #$03
+	tax
+	lda     #$7B
+	jsr     bnegax
+	beq     L0008
+	lda     #<(S0029)
+	ldx     #>(S0029)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+	jmp     L0009
+L0008:	lda     #<(S002A)
+	ldx     #>(S002A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+L0009:	lda     _o+1
+	and     #$FC
+	tax
+	lda     #$00
+	sta     _o
+	stx     _o+1
+	txa
+	and     #$03
+	tax
+	lda     #$00
+	jsr     bnegax
+	beq     L000A
+	lda     #<(S002B)
+	ldx     #>(S002B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L000B
+L000A:	lda     #<(S002C)
+	ldx     #>(S002C)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+L000B:	lda     _o+1+1
+	and     #$F0
+	tax
+	lda     _o+1
+	and     #$03
+	ora     #$04
+	pha
+	txa
+	ora     #$05
+	tax
+	pla
+	sta     _o+1
+	stx     _o+1+1
+	jsr     shrax2
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     bnegax
+	beq     L000C
+	lda     #<(S002D)
+	ldx     #>(S002D)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+	jmp     L000D
+L000C:	lda     #<(S002E)
+	ldx     #>(S002E)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+L000D:	lda     _o+1+1
+	and     #$F0
+	tax
+	lda     _o+1
+	and     #$03
+	sta     _o+1
+	stx     _o+1+1
+	jsr     shrax2
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     bnegax
+	beq     L000E
+	lda     #<(S002F)
+	ldx     #>(S002F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L000F
+L000E:	lda     #<(S0030)
+	ldx     #>(S0030)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+L000F:	lda     #$75
+	sta     _fw
+	and     #$FF
+	bne     L0010
+	lda     #<(S0031)
+	ldx     #>(S0031)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+	jmp     L0025
+L0010:	lda     #<(S0032)
+	ldx     #>(S0032)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+L0025:	lda     #$00
+	sta     _fw
+	and     #$FF
+	bne     L0012
+	lda     #<(S0033)
+	ldx     #>(S0033)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0013
+L0012:	lda     #<(S0034)
+	ldx     #>(S0034)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+L0013:	lda     #$7B
+	sta     _fw+1
+	ldx     #$7D
+	stx     _fw+1+1
+	lda     _fw+1
+	ora     _fw+1+1
+	bne     L0014
+	lda     #<(S0035)
+	ldx     #>(S0035)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+	jmp     L0015
+L0014:	lda     #<(S0036)
+	ldx     #>(S0036)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+L0015:	lda     #$00
+	sta     _fw+1
+	sta     _fw+1+1
+	lda     _fw+1
+	ora     _fw+1+1
+	bne     L0016
+	lda     #<(S0037)
+	ldx     #>(S0037)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0017
+L0016:	lda     #<(S0038)
+	ldx     #>(S0038)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+L0017:	lda     _ae
+	and     #$03
+	ora     #$08
+	sta     _ae
+	lsr     a
+	lsr     a
+	jsr     bnega
+	beq     L0018
+	lda     #<(S0039)
+	ldx     #>(S0039)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+	jmp     L0026
+L0018:	lda     #<(S003A)
+	ldx     #>(S003A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+L0026:	lda     _ae
+	and     #$03
+	sta     _ae
+	lsr     a
+	lsr     a
+	jsr     bnega
+	beq     L001A
+	lda     #<(S003B)
+	ldx     #>(S003B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L001B
+L001A:	lda     #<(S003C)
+	ldx     #>(S003C)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+L001B:	lda     _ae+1
+	and     #$07
+	ora     #$70
+	ldx     #$45
+	sta     _ae+1
+	stx     _ae+1+1
+	jsr     shrax3
+	stx     tmp1
+	ora     tmp1
+	bne     L001C
+	lda     #<(S003D)
+	ldx     #>(S003D)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+	jmp     L001D
+L001C:	lda     #<(S003E)
+	ldx     #>(S003E)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+L001D:	ldx     #$00
+	lda     _ae+1
+	and     #$07
+	sta     _ae+1
+	stx     _ae+1+1
+	lsr     a
+	lsr     a
+	lsr     a
+	bne     L001E
+	lda     #<(S003F)
+	ldx     #>(S003F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L001F
+L001E:	lda     #<(S0040)
+	ldx     #>(S0040)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+L001F:	lda     _ae+3+1
+	and     #$E0
+	tax
+	lda     _ae+3
+	and     #$3F
+	ora     #$C0
+	pha
+	txa
+	ora     #$1B
+	tax
+	pla
+	sta     _ae+3
+	stx     _ae+3+1
+	jsr     shrax4
+	jsr     shrax2
+	and     #$7F
+	bne     L0020
+	lda     #<(S0041)
+	ldx     #>(S0041)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+	jmp     L0021
+L0020:	lda     #<(S0042)
+	ldx     #>(S0042)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+L0021:	lda     _ae+3+1
+	and     #$E0
+	tax
+	lda     _ae+3
+	and     #$3F
+	sta     _ae+3
+	stx     _ae+3+1
+	jsr     shrax4
+	jsr     shrax2
+	and     #$7F
+	bne     L0022
+	lda     #<(S0043)
+	ldx     #>(S0043)
+	jsr     pushax
+	ldy     #$02
+	jmp     _printf
+L0022:	lda     #<(S0044)
+	ldx     #>(S0044)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     _test_if
+	jsr     _test_if_not
+	lda     #<(S0045)
+	ldx     #>(S0045)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     _failures
+	rts
+
+.endproc
+
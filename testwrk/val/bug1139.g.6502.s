@@ -0,0 +1,1450 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "bug1139.c", 7018, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+_fb:
+	.byte	$01
+_o:
+	.byte	$0B
+	.byte	$58
+	.byte	$00
+_fw:
+	.byte	$FF
+	.byte	$11
+	.byte	$00
+_ae:
+	.byte	$FC
+	.byte	$88
+	.byte	$00
+	.byte	$00
+	.byte	$19
+
+.segment	"RODATA"
+
+S0014:
+	.byte	$42,$61,$64,$2C,$20,$66,$77,$2E,$79,$20,$69,$73,$20,$74,$72,$75
+	.byte	$65,$20,$28,$33,$32,$31,$32,$33,$29,$0A,$00
+S0035	:=	S0014+0
+S003D:
+	.byte	$42,$61,$64,$2C,$20,$61,$65,$2E,$79,$20,$69,$73,$20,$74,$72,$75
+	.byte	$65,$20,$28,$32,$32,$32,$32,$29,$0A,$00
+S001C	:=	S003D+0
+S0010:
+	.byte	$42,$61,$64,$2C,$20,$66,$77,$2E,$78,$20,$69,$73,$20,$74,$72,$75
+	.byte	$65,$20,$28,$31,$31,$37,$29,$0A,$00
+S0031	:=	S0010+0
+S0020:
+	.byte	$42,$61,$64,$2C,$20,$61,$65,$2E,$7A,$20,$69,$73,$20,$74,$72,$75
+	.byte	$65,$20,$28,$31,$31,$31,$29,$0A,$00
+S0041	:=	S0020+0
+S002D:
+	.byte	$42,$61,$64,$2C,$20,$6F,$2E,$79,$20,$69,$73,$20,$74,$72,$75,$65
+	.byte	$20,$28,$33,$32,$31,$29,$0A,$00
+S0008:
+	.byte	$42,$61,$64,$2C,$20,$6F,$2E,$78,$20,$69,$73,$20,$74,$72,$75,$65
+	.byte	$20,$28,$31,$32,$33,$29,$0A,$00
+S000C	:=	S002D+0
+S0029	:=	S0008+0
+S0018:
+	.byte	$42,$61,$64,$2C,$20,$61,$65,$2E,$78,$20,$69,$73,$20,$74,$72,$75
+	.byte	$65,$20,$28,$32,$29,$0A,$00
+S0039	:=	S0018+0
+S0004:
+	.byte	$42,$61,$64,$2C,$20,$66,$62,$2E,$78,$20,$69,$73,$20,$74,$72,$75
+	.byte	$65,$20,$28,$31,$29,$0A,$00
+S0025	:=	S0004+0
+S0034:
+	.byte	$42,$61,$64,$2C,$20,$66,$77,$2E,$78,$20,$69,$73,$20,$66,$61,$6C
+	.byte	$73,$65,$0A,$00
+S003C:
+	.byte	$42,$61,$64,$2C,$20,$61,$65,$2E,$78,$20,$69,$73,$20,$66,$61,$6C
+	.byte	$73,$65,$0A,$00
+S0044:
+	.byte	$42,$61,$64,$2C,$20,$61,$65,$2E,$7A,$20,$69,$73,$20,$66,$61,$6C
+	.byte	$73,$65,$0A,$00
+S0015:
+	.byte	$42,$61,$64,$2C,$20,$66,$77,$2E,$79,$20,$69,$73,$20,$66,$61,$6C
+	.byte	$73,$65,$0A,$00
+S0028:
+	.byte	$42,$61,$64,$2C,$20,$66,$62,$2E,$78,$20,$69,$73,$20,$66,$61,$6C
+	.byte	$73,$65,$0A,$00
+S0040:
+	.byte	$42,$61,$64,$2C,$20,$61,$65,$2E,$79,$20,$69,$73,$20,$66,$61,$6C
+	.byte	$73,$65,$0A,$00
+S0038	:=	S0015+0
+S0019	:=	S003C+0
+S001D	:=	S0040+0
+S0011	:=	S0034+0
+S0005	:=	S0028+0
+S0021	:=	S0044+0
+S0030:
+	.byte	$42,$61,$64,$2C,$20,$6F,$2E,$79,$20,$69,$73,$20,$66,$61,$6C,$73
+	.byte	$65,$0A,$00
+S000D	:=	S0030+0
+S0009:
+	.byte	$42,$61,$64,$2C,$20,$6F,$2E,$78,$20,$69,$73,$20,$66,$61,$6C,$73
+	.byte	$65,$0A,$00
+S002C	:=	S0009+0
+S0024	:=	S0009+0
+S0001	:=	S0009+0
+S0045:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+S001F:
+	.byte	$47,$6F,$6F,$64,$0A,$00
+S0026	:=	S001F+0
+S0027	:=	S001F+0
+S001E	:=	S001F+0
+S001B	:=	S001F+0
+S002A	:=	S001F+0
+S002B	:=	S001F+0
+S001A	:=	S001F+0
+S0017	:=	S001F+0
+S002E	:=	S001F+0
+S002F	:=	S001F+0
+S0016	:=	S001F+0
+S0013	:=	S001F+0
+S0032	:=	S001F+0
+S0033	:=	S001F+0
+S0012	:=	S001F+0
+S000F	:=	S001F+0
+S0036	:=	S001F+0
+S0037	:=	S001F+0
+S000E	:=	S001F+0
+S000B	:=	S001F+0
+S003A	:=	S001F+0
+S003B	:=	S001F+0
+S000A	:=	S001F+0
+S0007	:=	S001F+0
+S003E	:=	S001F+0
+S003F	:=	S001F+0
+S0006	:=	S001F+0
+S0003	:=	S001F+0
+S0042	:=	S001F+0
+S0043	:=	S001F+0
+S0002	:=	S001F+0
+S0022	:=	S001F+0
+S0023	:=	S001F+0
+
+; ---------------------------------------------------------------
+; void __near__ test_if (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_if: near
+
+	.dbg	func, "test_if", "00", static, "_test_if"
+
+.segment	"CODE"
+
+	.dbg	line, "bug1139.c", 57
+	lda     _o
+	ldx     _o+1
+	txa
+	and     #$FC
+	tax
+	lda     #$00
+	sta     _o
+	stx     _o+1
+	.dbg	line, "bug1139.c", 58
+	lda     _o+1
+	ldx     _o+1+1
+	tay
+	txa
+	and     #$F0
+	tax
+	tya
+	and     #$03
+	ora     #$B0
+	sta     _o+1
+	stx     _o+1+1
+	.dbg	line, "bug1139.c", 59
+	lda     _o
+	ldx     _o+1
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	stx     tmp1
+	ora     tmp1
+	jeq     L0002
+	.dbg	line, "bug1139.c", 60
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 61
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1139.c", 62
+	jmp     L0003
+	.dbg	line, "bug1139.c", 63
+L0002:	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 68
+L0003:	ldx     #$00
+	lda     _fb
+	and     #$F0
+	ora     #$01
+	sta     _fb
+	.dbg	line, "bug1139.c", 69
+	lda     _fb
+	and     #$0F
+	tax
+	jeq     L0004
+	.dbg	line, "bug1139.c", 70
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 71
+	jmp     L0005
+	.dbg	line, "bug1139.c", 72
+L0004:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 73
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1139.c", 76
+L0005:	ldx     #$00
+	lda     _fb
+	and     #$F0
+	sta     _fb
+	.dbg	line, "bug1139.c", 77
+	lda     _fb
+	and     #$0F
+	tax
+	jeq     L0006
+	.dbg	line, "bug1139.c", 78
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 79
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1139.c", 80
+	jmp     L0007
+	.dbg	line, "bug1139.c", 81
+L0006:	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 85
+L0007:	lda     _o
+	ldx     _o+1
+	txa
+	and     #$FC
+	tax
+	lda     #$00
+	ora     #$7B
+	sta     _o
+	stx     _o+1
+	.dbg	line, "bug1139.c", 86
+	lda     _o
+	ldx     _o+1
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	stx     tmp1
+	ora     tmp1
+	jeq     L0008
+	.dbg	line, "bug1139.c", 87
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 88
+	jmp     L0009
+	.dbg	line, "bug1139.c", 89
+L0008:	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 90
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1139.c", 93
+L0009:	lda     _o
+	ldx     _o+1
+	txa
+	and     #$FC
+	tax
+	lda     #$00
+	sta     _o
+	stx     _o+1
+	.dbg	line, "bug1139.c", 94
+	lda     _o
+	ldx     _o+1
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	stx     tmp1
+	ora     tmp1
+	jeq     L000A
+	.dbg	line, "bug1139.c", 95
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 96
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1139.c", 97
+	jmp     L000B
+	.dbg	line, "bug1139.c", 98
+L000A:	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 101
+L000B:	lda     _o+1
+	ldx     _o+1+1
+	tay
+	txa
+	and     #$F0
+	tax
+	tya
+	and     #$03
+	ora     #$04
+	pha
+	txa
+	ora     #$05
+	tax
+	pla
+	sta     _o+1
+	stx     _o+1+1
+	.dbg	line, "bug1139.c", 102
+	lda     _o+1
+	ldx     _o+1+1
+	tay
+	txa
+	and     #$0F
+	tax
+	tya
+	and     #$FC
+	stx     tmp1
+	ora     tmp1
+	jeq     L000C
+	.dbg	line, "bug1139.c", 103
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 104
+	jmp     L000D
+	.dbg	line, "bug1139.c", 105
+L000C:	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 106
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1139.c", 109
+L000D:	lda     _o+1
+	ldx     _o+1+1
+	tay
+	txa
+	and     #$F0
+	tax
+	tya
+	and     #$03
+	sta     _o+1
+	stx     _o+1+1
+	.dbg	line, "bug1139.c", 110
+	lda     _o+1
+	ldx     _o+1+1
+	tay
+	txa
+	and     #$0F
+	tax
+	tya
+	and     #$FC
+	stx     tmp1
+	ora     tmp1
+	jeq     L000E
+	.dbg	line, "bug1139.c", 111
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 112
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1139.c", 113
+	jmp     L000F
+	.dbg	line, "bug1139.c", 114
+L000E:	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 118
+L000F:	ldx     #$00
+	lda     _fw
+	lda     #$00
+	ora     #$75
+	sta     _fw
+	.dbg	line, "bug1139.c", 119
+	lda     _fw
+	jeq     L0010
+	.dbg	line, "bug1139.c", 120
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 121
+	jmp     L0011
+	.dbg	line, "bug1139.c", 122
+L0010:	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 123
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1139.c", 126
+L0011:	ldx     #$00
+	lda     _fw
+	lda     #$00
+	sta     _fw
+	.dbg	line, "bug1139.c", 127
+	lda     _fw
+	jeq     L0012
+	.dbg	line, "bug1139.c", 128
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 129
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1139.c", 130
+	jmp     L0013
+	.dbg	line, "bug1139.c", 131
+L0012:	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 134
+L0013:	lda     _fw+1
+	ldx     _fw+1+1
+	txa
+	and     #$00
+	tax
+	lda     #$00
+	ora     #$7B
+	pha
+	txa
+	ora     #$7D
+	tax
+	pla
+	sta     _fw+1
+	stx     _fw+1+1
+	.dbg	line, "bug1139.c", 135
+	lda     _fw+1
+	ora     _fw+1+1
+	jeq     L0014
+	.dbg	line, "bug1139.c", 136
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 137
+	jmp     L0015
+	.dbg	line, "bug1139.c", 138
+L0014:	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 139
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1139.c", 142
+L0015:	lda     _fw+1
+	ldx     _fw+1+1
+	txa
+	and     #$00
+	tax
+	lda     #$00
+	sta     _fw+1
+	stx     _fw+1+1
+	.dbg	line, "bug1139.c", 143
+	lda     _fw+1
+	ora     _fw+1+1
+	jeq     L0016
+	.dbg	line, "bug1139.c", 144
+	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 145
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1139.c", 146
+	jmp     L0017
+	.dbg	line, "bug1139.c", 147
+L0016:	lda     #<(S0016)
+	ldx     #>(S0016)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 151
+L0017:	ldx     #$00
+	lda     _ae
+	and     #$03
+	ora     #$08
+	sta     _ae
+	.dbg	line, "bug1139.c", 152
+	lda     _ae
+	and     #$FC
+	tax
+	jeq     L0018
+	.dbg	line, "bug1139.c", 153
+	lda     #<(S0017)
+	ldx     #>(S0017)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 154
+	jmp     L0019
+	.dbg	line, "bug1139.c", 155
+L0018:	lda     #<(S0018)
+	ldx     #>(S0018)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 156
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1139.c", 159
+L0019:	ldx     #$00
+	lda     _ae
+	and     #$03
+	sta     _ae
+	.dbg	line, "bug1139.c", 160
+	lda     _ae
+	and     #$FC
+	tax
+	jeq     L001A
+	.dbg	line, "bug1139.c", 161
+	lda     #<(S0019)
+	ldx     #>(S0019)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 162
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1139.c", 163
+	jmp     L001B
+	.dbg	line, "bug1139.c", 164
+L001A:	lda     #<(S001A)
+	ldx     #>(S001A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 167
+L001B:	lda     _ae+1
+	ldx     _ae+1+1
+	tay
+	txa
+	and     #$00
+	tax
+	tya
+	and     #$07
+	ora     #$70
+	pha
+	txa
+	ora     #$45
+	tax
+	pla
+	sta     _ae+1
+	stx     _ae+1+1
+	.dbg	line, "bug1139.c", 168
+	lda     _ae+1
+	ldx     _ae+1+1
+	and     #$F8
+	stx     tmp1
+	ora     tmp1
+	jeq     L001C
+	.dbg	line, "bug1139.c", 169
+	lda     #<(S001B)
+	ldx     #>(S001B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 170
+	jmp     L001D
+	.dbg	line, "bug1139.c", 171
+L001C:	lda     #<(S001C)
+	ldx     #>(S001C)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 172
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1139.c", 175
+L001D:	lda     _ae+1
+	ldx     _ae+1+1
+	tay
+	txa
+	and     #$00
+	tax
+	tya
+	and     #$07
+	sta     _ae+1
+	stx     _ae+1+1
+	.dbg	line, "bug1139.c", 176
+	lda     _ae+1
+	ldx     _ae+1+1
+	and     #$F8
+	stx     tmp1
+	ora     tmp1
+	jeq     L001E
+	.dbg	line, "bug1139.c", 177
+	lda     #<(S001D)
+	ldx     #>(S001D)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 178
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1139.c", 179
+	jmp     L001F
+	.dbg	line, "bug1139.c", 180
+L001E:	lda     #<(S001E)
+	ldx     #>(S001E)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 183
+L001F:	lda     _ae+3
+	ldx     _ae+3+1
+	tay
+	txa
+	and     #$E0
+	tax
+	tya
+	and     #$3F
+	ora     #$C0
+	pha
+	txa
+	ora     #$1B
+	tax
+	pla
+	sta     _ae+3
+	stx     _ae+3+1
+	.dbg	line, "bug1139.c", 184
+	lda     _ae+3
+	ldx     _ae+3+1
+	tay
+	txa
+	and     #$1F
+	tax
+	tya
+	and     #$C0
+	stx     tmp1
+	ora     tmp1
+	jeq     L0020
+	.dbg	line, "bug1139.c", 185
+	lda     #<(S001F)
+	ldx     #>(S001F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 186
+	jmp     L0021
+	.dbg	line, "bug1139.c", 187
+L0020:	lda     #<(S0020)
+	ldx     #>(S0020)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 188
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1139.c", 191
+L0021:	lda     _ae+3
+	ldx     _ae+3+1
+	tay
+	txa
+	and     #$E0
+	tax
+	tya
+	and     #$3F
+	sta     _ae+3
+	stx     _ae+3+1
+	.dbg	line, "bug1139.c", 192
+	lda     _ae+3
+	ldx     _ae+3+1
+	tay
+	txa
+	and     #$1F
+	tax
+	tya
+	and     #$C0
+	stx     tmp1
+	ora     tmp1
+	jeq     L0022
+	.dbg	line, "bug1139.c", 193
+	lda     #<(S0021)
+	ldx     #>(S0021)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 194
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1139.c", 195
+	jmp     L0023
+	.dbg	line, "bug1139.c", 196
+L0022:	lda     #<(S0022)
+	ldx     #>(S0022)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 198
+L0023:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_if_not (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_if_not: near
+
+	.dbg	func, "test_if_not", "00", static, "_test_if_not"
+
+.segment	"CODE"
+
+	.dbg	line, "bug1139.c", 204
+	lda     _o
+	ldx     _o+1
+	txa
+	and     #$FC
+	tax
+	lda     #$00
+	sta     _o
+	stx     _o+1
+	.dbg	line, "bug1139.c", 205
+	lda     _o+1
+	ldx     _o+1+1
+	tay
+	txa
+	and     #$F0
+	tax
+	tya
+	and     #$03
+	ora     #$B0
+	sta     _o+1
+	stx     _o+1+1
+	.dbg	line, "bug1139.c", 206
+	lda     _o
+	ldx     _o+1
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     bnegax
+	jeq     L0002
+	.dbg	line, "bug1139.c", 207
+	lda     #<(S0023)
+	ldx     #>(S0023)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 208
+	jmp     L0003
+	.dbg	line, "bug1139.c", 209
+L0002:	lda     #<(S0024)
+	ldx     #>(S0024)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 210
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1139.c", 215
+L0003:	ldx     #$00
+	lda     _fb
+	and     #$F0
+	ora     #$01
+	sta     _fb
+	.dbg	line, "bug1139.c", 216
+	lda     _fb
+	ldx     #$00
+	and     #$0F
+	jsr     bnegax
+	jeq     L0004
+	.dbg	line, "bug1139.c", 217
+	lda     #<(S0025)
+	ldx     #>(S0025)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 218
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1139.c", 219
+	jmp     L0005
+	.dbg	line, "bug1139.c", 220
+L0004:	lda     #<(S0026)
+	ldx     #>(S0026)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 223
+L0005:	ldx     #$00
+	lda     _fb
+	and     #$F0
+	sta     _fb
+	.dbg	line, "bug1139.c", 224
+	lda     _fb
+	ldx     #$00
+	and     #$0F
+	jsr     bnegax
+	jeq     L0006
+	.dbg	line, "bug1139.c", 225
+	lda     #<(S0027)
+	ldx     #>(S0027)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 226
+	jmp     L0007
+	.dbg	line, "bug1139.c", 227
+L0006:	lda     #<(S0028)
+	ldx     #>(S0028)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 228
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1139.c", 232
+L0007:	lda     _o
+	ldx     _o+1
+	txa
+	and     #$FC
+	tax
+	lda     #$00
+	ora     #$7B
+	sta     _o
+	stx     _o+1
+	.dbg	line, "bug1139.c", 233
+	lda     _o
+	ldx     _o+1
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     bnegax
+	jeq     L0008
+	.dbg	line, "bug1139.c", 234
+	lda     #<(S0029)
+	ldx     #>(S0029)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 235
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1139.c", 236
+	jmp     L0009
+	.dbg	line, "bug1139.c", 237
+L0008:	lda     #<(S002A)
+	ldx     #>(S002A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 240
+L0009:	lda     _o
+	ldx     _o+1
+	txa
+	and     #$FC
+	tax
+	lda     #$00
+	sta     _o
+	stx     _o+1
+	.dbg	line, "bug1139.c", 241
+	lda     _o
+	ldx     _o+1
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     bnegax
+	jeq     L000A
+	.dbg	line, "bug1139.c", 242
+	lda     #<(S002B)
+	ldx     #>(S002B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 243
+	jmp     L000B
+	.dbg	line, "bug1139.c", 244
+L000A:	lda     #<(S002C)
+	ldx     #>(S002C)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 245
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1139.c", 248
+L000B:	lda     _o+1
+	ldx     _o+1+1
+	tay
+	txa
+	and     #$F0
+	tax
+	tya
+	and     #$03
+	ora     #$04
+	pha
+	txa
+	ora     #$05
+	tax
+	pla
+	sta     _o+1
+	stx     _o+1+1
+	.dbg	line, "bug1139.c", 249
+	lda     _o+1
+	ldx     _o+1+1
+	jsr     shrax2
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     bnegax
+	jeq     L000C
+	.dbg	line, "bug1139.c", 250
+	lda     #<(S002D)
+	ldx     #>(S002D)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 251
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1139.c", 252
+	jmp     L000D
+	.dbg	line, "bug1139.c", 253
+L000C:	lda     #<(S002E)
+	ldx     #>(S002E)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 256
+L000D:	lda     _o+1
+	ldx     _o+1+1
+	tay
+	txa
+	and     #$F0
+	tax
+	tya
+	and     #$03
+	sta     _o+1
+	stx     _o+1+1
+	.dbg	line, "bug1139.c", 257
+	lda     _o+1
+	ldx     _o+1+1
+	jsr     shrax2
+	tay
+	txa
+	and     #$03
+	tax
+	tya
+	jsr     bnegax
+	jeq     L000E
+	.dbg	line, "bug1139.c", 258
+	lda     #<(S002F)
+	ldx     #>(S002F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 259
+	jmp     L000F
+	.dbg	line, "bug1139.c", 260
+L000E:	lda     #<(S0030)
+	ldx     #>(S0030)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 261
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1139.c", 265
+L000F:	ldx     #$00
+	lda     _fw
+	lda     #$00
+	ora     #$75
+	sta     _fw
+	.dbg	line, "bug1139.c", 266
+	ldx     #$00
+	lda     _fw
+	jsr     bnegax
+	jeq     L0010
+	.dbg	line, "bug1139.c", 267
+	lda     #<(S0031)
+	ldx     #>(S0031)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 268
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1139.c", 269
+	jmp     L0011
+	.dbg	line, "bug1139.c", 270
+L0010:	lda     #<(S0032)
+	ldx     #>(S0032)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 273
+L0011:	ldx     #$00
+	lda     _fw
+	lda     #$00
+	sta     _fw
+	.dbg	line, "bug1139.c", 274
+	ldx     #$00
+	lda     _fw
+	jsr     bnegax
+	jeq     L0012
+	.dbg	line, "bug1139.c", 275
+	lda     #<(S0033)
+	ldx     #>(S0033)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 276
+	jmp     L0013
+	.dbg	line, "bug1139.c", 277
+L0012:	lda     #<(S0034)
+	ldx     #>(S0034)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 278
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1139.c", 281
+L0013:	lda     _fw+1
+	ldx     _fw+1+1
+	txa
+	and     #$00
+	tax
+	lda     #$00
+	ora     #$7B
+	pha
+	txa
+	ora     #$7D
+	tax
+	pla
+	sta     _fw+1
+	stx     _fw+1+1
+	.dbg	line, "bug1139.c", 282
+	lda     _fw+1
+	ldx     _fw+1+1
+	jsr     bnegax
+	jeq     L0014
+	.dbg	line, "bug1139.c", 283
+	lda     #<(S0035)
+	ldx     #>(S0035)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 284
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1139.c", 285
+	jmp     L0015
+	.dbg	line, "bug1139.c", 286
+L0014:	lda     #<(S0036)
+	ldx     #>(S0036)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 289
+L0015:	lda     _fw+1
+	ldx     _fw+1+1
+	txa
+	and     #$00
+	tax
+	lda     #$00
+	sta     _fw+1
+	stx     _fw+1+1
+	.dbg	line, "bug1139.c", 290
+	lda     _fw+1
+	ldx     _fw+1+1
+	jsr     bnegax
+	jeq     L0016
+	.dbg	line, "bug1139.c", 291
+	lda     #<(S0037)
+	ldx     #>(S0037)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 292
+	jmp     L0017
+	.dbg	line, "bug1139.c", 293
+L0016:	lda     #<(S0038)
+	ldx     #>(S0038)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 294
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1139.c", 298
+L0017:	ldx     #$00
+	lda     _ae
+	and     #$03
+	ora     #$08
+	sta     _ae
+	.dbg	line, "bug1139.c", 299
+	lda     _ae
+	lsr     a
+	lsr     a
+	ldx     #$00
+	jsr     bnegax
+	jeq     L0018
+	.dbg	line, "bug1139.c", 300
+	lda     #<(S0039)
+	ldx     #>(S0039)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 301
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1139.c", 302
+	jmp     L0019
+	.dbg	line, "bug1139.c", 303
+L0018:	lda     #<(S003A)
+	ldx     #>(S003A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 306
+L0019:	ldx     #$00
+	lda     _ae
+	and     #$03
+	sta     _ae
+	.dbg	line, "bug1139.c", 307
+	lda     _ae
+	lsr     a
+	lsr     a
+	ldx     #$00
+	jsr     bnegax
+	jeq     L001A
+	.dbg	line, "bug1139.c", 308
+	lda     #<(S003B)
+	ldx     #>(S003B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 309
+	jmp     L001B
+	.dbg	line, "bug1139.c", 310
+L001A:	lda     #<(S003C)
+	ldx     #>(S003C)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 311
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1139.c", 314
+L001B:	lda     _ae+1
+	ldx     _ae+1+1
+	tay
+	txa
+	and     #$00
+	tax
+	tya
+	and     #$07
+	ora     #$70
+	pha
+	txa
+	ora     #$45
+	tax
+	pla
+	sta     _ae+1
+	stx     _ae+1+1
+	.dbg	line, "bug1139.c", 315
+	lda     _ae+1
+	ldx     _ae+1+1
+	jsr     shrax3
+	jsr     bnegax
+	jeq     L001C
+	.dbg	line, "bug1139.c", 316
+	lda     #<(S003D)
+	ldx     #>(S003D)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 317
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1139.c", 318
+	jmp     L001D
+	.dbg	line, "bug1139.c", 319
+L001C:	lda     #<(S003E)
+	ldx     #>(S003E)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 322
+L001D:	lda     _ae+1
+	ldx     _ae+1+1
+	tay
+	txa
+	and     #$00
+	tax
+	tya
+	and     #$07
+	sta     _ae+1
+	stx     _ae+1+1
+	.dbg	line, "bug1139.c", 323
+	lda     _ae+1
+	ldx     _ae+1+1
+	jsr     shrax3
+	jsr     bnegax
+	jeq     L001E
+	.dbg	line, "bug1139.c", 324
+	lda     #<(S003F)
+	ldx     #>(S003F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 325
+	jmp     L001F
+	.dbg	line, "bug1139.c", 326
+L001E:	lda     #<(S0040)
+	ldx     #>(S0040)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 327
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1139.c", 330
+L001F:	lda     _ae+3
+	ldx     _ae+3+1
+	tay
+	txa
+	and     #$E0
+	tax
+	tya
+	and     #$3F
+	ora     #$C0
+	pha
+	txa
+	ora     #$1B
+	tax
+	pla
+	sta     _ae+3
+	stx     _ae+3+1
+	.dbg	line, "bug1139.c", 331
+	lda     _ae+3
+	ldx     _ae+3+1
+	jsr     shrax4
+	jsr     shrax2
+	ldx     #$00
+	and     #$7F
+	jsr     bnegax
+	jeq     L0020
+	.dbg	line, "bug1139.c", 332
+	lda     #<(S0041)
+	ldx     #>(S0041)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 333
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1139.c", 334
+	jmp     L0021
+	.dbg	line, "bug1139.c", 335
+L0020:	lda     #<(S0042)
+	ldx     #>(S0042)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 338
+L0021:	lda     _ae+3
+	ldx     _ae+3+1
+	tay
+	txa
+	and     #$E0
+	tax
+	tya
+	and     #$3F
+	sta     _ae+3
+	stx     _ae+3+1
+	.dbg	line, "bug1139.c", 339
+	lda     _ae+3
+	ldx     _ae+3+1
+	jsr     shrax4
+	jsr     shrax2
+	ldx     #$00
+	and     #$7F
+	jsr     bnegax
+	jeq     L0022
+	.dbg	line, "bug1139.c", 340
+	lda     #<(S0043)
+	ldx     #>(S0043)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 341
+	jmp     L0023
+	.dbg	line, "bug1139.c", 342
+L0022:	lda     #<(S0044)
+	ldx     #>(S0044)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1139.c", 343
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1139.c", 345
+L0023:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "bug1139.c", 349
+	jsr     _test_if
+	.dbg	line, "bug1139.c", 350
+	jsr     _test_if_not
+	.dbg	line, "bug1139.c", 351
+	lda     #<(S0045)
+	ldx     #>(S0045)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1139.c", 352
+	ldx     #$00
+	lda     _failures
+	jmp     L0001
+	.dbg	line, "bug1139.c", 353
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,43 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "bug1143warn.c", 150, 1613073744
+	.forceimport	__STARTUP__
+	.export		_main
+
+.segment	"BSS"
+
+_y:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "bug1143warn.c", 8
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "bug1143warn.c", 9
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,195 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_StructArray1
+	.export		_test1
+	.export		_StructArray2
+	.export		_test2
+	.export		_res
+	.export		_dotest1
+	.export		_dotest2
+	.export		_main
+
+.segment	"DATA"
+
+_res:
+	.word	$0000
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$74,$65,$73,$74,$32,$3A,$20,$25,$64,$2C,$20,$25,$64,$2C,$20,$25
+	.byte	$64,$2C,$20,$25,$64,$2C,$20,$25,$64,$0A,$00
+S0001:
+	.byte	$74,$65,$73,$74,$31,$3A,$20,$25,$64,$2C,$20,$25,$64,$2C,$20,$25
+	.byte	$64,$2C,$20,$25,$64,$2C,$20,$25,$64,$0A,$00
+
+.segment	"BSS"
+
+_StructArray1:
+	.res	10,$00
+_test1:
+	.res	5,$00
+_StructArray2:
+	.res	8,$00
+_test2:
+	.res	4,$00
+
+; ---------------------------------------------------------------
+; void __near__ dotest1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_dotest1: near
+
+.segment	"CODE"
+
+	lda     #$2A
+	sta     _test1
+	lda     #$0B
+	sta     _test1+1
+	lda     #$17
+	sta     _test1+2
+	lda     #$2F
+	sta     _test1+3
+	lda     #$0D
+	sta     _test1+4
+	lda     #<(_StructArray1)
+	ldx     #>(_StructArray1)
+	jsr     pushax
+	lda     #<(_test1)
+	ldx     #>(_test1)
+	jsr     pushax
+	ldx     #$00
+	lda     #$05
+	jsr     _memcpy
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _StructArray1
+	jsr     pusha0
+	lda     _StructArray1+1
+	jsr     pusha0
+	lda     _StructArray1+2
+	jsr     pusha0
+	lda     _StructArray1+3
+	jsr     pusha0
+	lda     _StructArray1+4
+	jsr     pusha0
+	ldy     #$0C
+	jsr     _printf
+	lda     _StructArray1
+	cmp     #$2A
+	bne     L0005
+	lda     _StructArray1+1
+	cmp     #$0B
+	bne     L0005
+	lda     _StructArray1+2
+	cmp     #$17
+	bne     L0005
+	lda     _StructArray1+3
+	cmp     #$2F
+	bne     L0005
+	lda     _StructArray1+4
+	cmp     #$0D
+	bne     L0005
+	rts
+L0005:	lda     #$01
+	sta     _res
+	stz     _res+1
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ dotest2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_dotest2: near
+
+.segment	"CODE"
+
+	lda     #$2A
+	sta     _test2
+	lda     #$0B
+	sta     _test2+1
+	lda     #$17
+	sta     _test2+2
+	lda     #$2F
+	sta     _test2+3
+	sta     sreg+1
+	lda     _test2+2
+	sta     sreg
+	ldx     _test2+1
+	lda     _test2
+	sta     _StructArray2
+	stx     _StructArray2+1
+	ldy     sreg
+	sty     _StructArray2+2
+	ldy     sreg+1
+	sty     _StructArray2+3
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     _StructArray2
+	jsr     pusha0
+	lda     _StructArray2+1
+	jsr     pusha0
+	lda     _StructArray2+2
+	jsr     pusha0
+	lda     _StructArray2+3
+	jsr     pusha0
+	ldy     #$0A
+	jsr     _printf
+	lda     _StructArray2
+	cmp     #$2A
+	bne     L0005
+	lda     _StructArray2+1
+	cmp     #$0B
+	bne     L0005
+	lda     _StructArray2+2
+	cmp     #$17
+	bne     L0005
+	lda     _StructArray2+3
+	cmp     #$2F
+	bne     L0005
+	rts
+L0005:	lda     #$01
+	sta     _res
+	stz     _res+1
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     _dotest1
+	jsr     _dotest2
+	lda     _res
+	ldx     _res+1
+	rts
+
+.endproc
+
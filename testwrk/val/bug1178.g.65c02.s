@@ -0,0 +1,294 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "bug1178.c", 1573, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/stdlib.h", 5999, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_StructArray1
+	.export		_test1
+	.export		_StructArray2
+	.export		_test2
+	.export		_res
+	.export		_dotest1
+	.export		_dotest2
+	.export		_main
+
+.segment	"DATA"
+
+_res:
+	.word	$0000
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$74,$65,$73,$74,$32,$3A,$20,$25,$64,$2C,$20,$25,$64,$2C,$20,$25
+	.byte	$64,$2C,$20,$25,$64,$2C,$20,$25,$64,$0A,$00
+S0001:
+	.byte	$74,$65,$73,$74,$31,$3A,$20,$25,$64,$2C,$20,$25,$64,$2C,$20,$25
+	.byte	$64,$2C,$20,$25,$64,$2C,$20,$25,$64,$0A,$00
+
+.segment	"BSS"
+
+_StructArray1:
+	.res	10,$00
+_test1:
+	.res	5,$00
+_StructArray2:
+	.res	8,$00
+_test2:
+	.res	4,$00
+
+; ---------------------------------------------------------------
+; void __near__ dotest1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_dotest1: near
+
+	.dbg	func, "dotest1", "00", extern, "_dotest1"
+
+.segment	"CODE"
+
+	.dbg	line, "bug1178.c", 36
+	ldx     #$00
+	lda     #$2A
+	sta     _test1
+	.dbg	line, "bug1178.c", 37
+	ldx     #$00
+	lda     #$0B
+	sta     _test1+1
+	.dbg	line, "bug1178.c", 38
+	ldx     #$00
+	lda     #$17
+	sta     _test1+2
+	.dbg	line, "bug1178.c", 39
+	ldx     #$00
+	lda     #$2F
+	sta     _test1+3
+	.dbg	line, "bug1178.c", 40
+	ldx     #$00
+	lda     #$0D
+	sta     _test1+4
+	.dbg	line, "bug1178.c", 42
+	lda     #<(_StructArray1)
+	ldx     #>(_StructArray1)
+	jsr     pushax
+	lda     #<(_test1)
+	ldx     #>(_test1)
+	jsr     pushax
+	ldx     #$00
+	lda     #$05
+	jsr     _memcpy
+	.dbg	line, "bug1178.c", 44
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	.dbg	line, "bug1178.c", 45
+	ldx     #$00
+	lda     _StructArray1
+	jsr     pushax
+	ldx     #$00
+	lda     _StructArray1+1
+	jsr     pushax
+	ldx     #$00
+	lda     _StructArray1+2
+	jsr     pushax
+	.dbg	line, "bug1178.c", 46
+	ldx     #$00
+	lda     _StructArray1+3
+	jsr     pushax
+	ldx     #$00
+	lda     _StructArray1+4
+	jsr     pushax
+	ldy     #$0C
+	jsr     _printf
+	.dbg	line, "bug1178.c", 47
+	ldx     #$00
+	lda     _StructArray1
+	cmp     #$2A
+	jsr     boolne
+	jne     L0003
+	.dbg	line, "bug1178.c", 48
+	ldx     #$00
+	lda     _StructArray1+1
+	cmp     #$0B
+	jsr     boolne
+	jne     L0003
+	.dbg	line, "bug1178.c", 49
+	ldx     #$00
+	lda     _StructArray1+2
+	cmp     #$17
+	jsr     boolne
+	jne     L0003
+	.dbg	line, "bug1178.c", 50
+	ldx     #$00
+	lda     _StructArray1+3
+	cmp     #$2F
+	jsr     boolne
+	jne     L0003
+	.dbg	line, "bug1178.c", 51
+	ldx     #$00
+	lda     _StructArray1+4
+	cmp     #$0D
+	jsr     boolne
+	jne     L0003
+	ldx     #$00
+	lda     #$00
+	jeq     L0004
+L0003:	ldx     #$00
+	lda     #$01
+L0004:	jeq     L0002
+	.dbg	line, "bug1178.c", 52
+	ldx     #$00
+	lda     #$01
+	sta     _res
+	stx     _res+1
+	.dbg	line, "bug1178.c", 54
+L0002:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ dotest2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_dotest2: near
+
+	.dbg	func, "dotest2", "00", extern, "_dotest2"
+
+.segment	"CODE"
+
+	.dbg	line, "bug1178.c", 58
+	ldx     #$00
+	lda     #$2A
+	sta     _test2
+	.dbg	line, "bug1178.c", 59
+	ldx     #$00
+	lda     #$0B
+	sta     _test2+1
+	.dbg	line, "bug1178.c", 60
+	ldx     #$00
+	lda     #$17
+	sta     _test2+2
+	.dbg	line, "bug1178.c", 61
+	ldx     #$00
+	lda     #$2F
+	sta     _test2+3
+	.dbg	line, "bug1178.c", 63
+	lda     _test2+3
+	sta     sreg+1
+	lda     _test2+2
+	sta     sreg
+	ldx     _test2+1
+	lda     _test2
+	sta     _StructArray2
+	stx     _StructArray2+1
+	ldy     sreg
+	sty     _StructArray2+2
+	ldy     sreg+1
+	sty     _StructArray2+3
+	.dbg	line, "bug1178.c", 65
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	.dbg	line, "bug1178.c", 66
+	ldx     #$00
+	lda     _StructArray2
+	jsr     pushax
+	ldx     #$00
+	lda     _StructArray2+1
+	jsr     pushax
+	.dbg	line, "bug1178.c", 67
+	ldx     #$00
+	lda     _StructArray2+2
+	jsr     pushax
+	ldx     #$00
+	lda     _StructArray2+3
+	jsr     pushax
+	ldy     #$0A
+	jsr     _printf
+	.dbg	line, "bug1178.c", 68
+	ldx     #$00
+	lda     _StructArray2
+	cmp     #$2A
+	jsr     boolne
+	jne     L0003
+	.dbg	line, "bug1178.c", 69
+	ldx     #$00
+	lda     _StructArray2+1
+	cmp     #$0B
+	jsr     boolne
+	jne     L0003
+	.dbg	line, "bug1178.c", 70
+	ldx     #$00
+	lda     _StructArray2+2
+	cmp     #$17
+	jsr     boolne
+	jne     L0003
+	.dbg	line, "bug1178.c", 71
+	ldx     #$00
+	lda     _StructArray2+3
+	cmp     #$2F
+	jsr     boolne
+	jne     L0003
+	ldx     #$00
+	lda     #$00
+	jeq     L0004
+L0003:	ldx     #$00
+	lda     #$01
+L0004:	jeq     L0002
+	.dbg	line, "bug1178.c", 72
+	ldx     #$00
+	lda     #$01
+	sta     _res
+	stx     _res+1
+	.dbg	line, "bug1178.c", 74
+L0002:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "bug1178.c", 78
+	jsr     _dotest1
+	.dbg	line, "bug1178.c", 79
+	jsr     _dotest2
+	.dbg	line, "bug1178.c", 80
+	lda     _res
+	ldx     _res+1
+	jmp     L0001
+	.dbg	line, "bug1178.c", 81
+L0001:	rts
+
+	.dbg	line
+.endproc
+
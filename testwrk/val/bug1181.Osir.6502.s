@@ -0,0 +1,224 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_s
+	.export		_ps
+	.export		_res
+	.export		_test1
+	.export		_optionsitems_menu
+	.export		_menu_getnumitems
+	.export		_main
+
+.segment	"DATA"
+
+_s:
+	.word	$0100
+_ps:
+	.addr	_s
+_res:
+	.word	$0000
+_oi31:
+	.byte	$42,$72,$6F,$77,$73,$65,$72,$20,$45,$78,$65,$63,$20,$53,$65,$74
+	.byte	$75,$70,$00
+_oi36:
+	.byte	$42,$72,$6F,$77,$73,$65,$72,$20,$61,$75,$74,$6F,$20,$73,$6F,$72
+	.byte	$74,$00
+_oi47:
+	.byte	$42,$72,$6F,$77,$73,$65,$72,$20,$73,$74,$61,$72,$74,$75,$70,$00
+_oi49:
+	.byte	$42,$72,$6F,$77,$73,$65,$72,$20,$63,$68,$61,$72,$73,$65,$74,$00
+_oi55:
+	.byte	$4D,$65,$6E,$75,$20,$63,$6F,$6C,$6F,$72,$20,$73,$63,$68,$65,$6D
+	.byte	$65,$00
+_oi63:
+	.byte	$4D,$65,$6E,$75,$20,$69,$6E,$70,$75,$74,$20,$73,$63,$68,$65,$6D
+	.byte	$65,$00
+_oi35:
+	.byte	$62,$61,$63,$6B,$00
+_optionsitems_menu:
+	.addr	_oi31
+	.addr	_oi36
+	.addr	_oi47
+	.addr	_oi49
+	.addr	_oi55
+	.addr	_oi63
+	.addr	_oi35
+	.word	$0000
+_optionsmenu_menu:
+	.addr	_optionsitems_menu
+
+.segment	"RODATA"
+
+S000A:
+	.byte	$6E,$75,$6D,$69,$74,$65,$6D,$73,$20,$28,$65,$78,$70,$65,$63,$74
+	.byte	$65,$64,$20,$37,$29,$3A,$20,$25,$64,$0A,$00
+S0002:
+	.byte	$45,$52,$52,$4F,$52,$3A,$20,$25,$64,$0A,$00
+S000B:
+	.byte	$66,$61,$69,$6C,$65,$64,$0A,$00
+S000C:
+	.byte	$70,$61,$73,$73,$65,$64,$0A,$00
+S0001:
+	.byte	$4F,$4B,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ test1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test1: near
+
+.segment	"CODE"
+
+	lda     _ps
+	ldx     _ps+1
+	ldy     #$00
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	beq     L0002
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$02
+	jmp     _printf
+L0002:	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     _ps+1
+	sta     ptr1+1
+	lda     _ps
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	sta     _res
+	stx     _res+1
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ __fastcall__ menu_getnumitems (struct _MENU *menu)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_menu_getnumitems: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp2
+	lda     #$00
+	sta     M0001
+	ldy     #$03
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	dey
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     stax0sp
+	jmp     L0004
+L0002:	inc     M0001
+	ldx     #$00
+	lda     #$02
+	jsr     addeq0sp
+L0004:	ldy     #$01
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	bne     L0002
+	tax
+	lda     M0001
+	jmp     incsp4
+
+.segment	"BSS"
+
+M0001:
+	.res	1,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #$00
+	jsr     pusha
+	lda     #<(_optionsmenu_menu)
+	ldx     #>(_optionsmenu_menu)
+	jsr     _menu_getnumitems
+	ldy     #$00
+	sta     (sp),y
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldy     #$02
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldy     #$00
+	lda     (sp),y
+	cmp     #$07
+	beq     L0002
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	sta     _res
+	stx     _res+1
+L0002:	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jsr     _test1
+	lda     _res
+	ldx     _res+1
+	jmp     incsp1
+
+.endproc
+
@@ -0,0 +1,52 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.export		_a
+	.export		_b
+	.export		_c
+	.export		_d
+	.export		_e
+	.export		_f
+	.export		_main
+
+.segment	"BSS"
+
+_a:
+	.res	1,$00
+_b:
+	.res	2,$00
+_c:
+	.res	2,$00
+_d:
+	.res	4,$00
+_e:
+	.res	1,$00
+_f:
+	.res	1,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
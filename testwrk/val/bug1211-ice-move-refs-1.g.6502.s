@@ -0,0 +1,144 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "bug1211-ice-move-refs-1.c", 1578, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_f
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$46,$41,$49,$4C,$0A,$00
+S0001:
+	.byte	$50,$41,$53,$53,$0A,$00
+
+; ---------------------------------------------------------------
+; int __near__ f (int x)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f: near
+
+	.dbg	func, "f", "00", extern, "_f"
+	.dbg	sym, "x", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "bug1211-ice-move-refs-1.c", 32
+	jsr     pushax
+	.dbg	line, "bug1211-ice-move-refs-1.c", 34
+	ldy     #$01
+	jsr     ldaxysp
+	asl     a
+	tay
+	lda     M0001,y
+	ldx     M0001+1,y
+	jmp     callax
+	.dbg	line, "bug1211-ice-move-refs-1.c", 35
+L0002:	lda     M0001
+	ldx     M0001+1
+	jsr     pushax
+	lda     M0001+2
+	ldx     M0001+2+1
+	jsr     tosneax
+	jeq     L0004
+	ldx     #$00
+	lda     #$1F
+	jmp     L0001
+	.dbg	line, "bug1211-ice-move-refs-1.c", 36
+	jmp     L0003
+L0004:	ldx     #$00
+	lda     #$0D
+	jmp     L0001
+	.dbg	line, "bug1211-ice-move-refs-1.c", 37
+L0003:	ldx     #$00
+	lda     #$29
+	jmp     L0001
+	.dbg	line, "bug1211-ice-move-refs-1.c", 38
+L0001:	jsr     incsp2
+	rts
+
+	.dbg	line
+.segment	"RODATA"
+
+M0001:
+	.addr	L0002
+	.addr	L0003
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "bug1211-ice-move-refs-1.c", 44
+	ldx     #$00
+	lda     #$00
+	jsr     _f
+	cpx     #$00
+	bne     L0003
+	cmp     #$1F
+L0003:	jsr     boolne
+	jeq     L0002
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1211-ice-move-refs-1.c", 46
+L0002:	ldx     #$00
+	lda     _failures
+	cmp     #$00
+	jsr     booleq
+	jeq     L0004
+	.dbg	line, "bug1211-ice-move-refs-1.c", 47
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1211-ice-move-refs-1.c", 48
+	jmp     L0005
+	.dbg	line, "bug1211-ice-move-refs-1.c", 49
+L0004:	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "bug1211-ice-move-refs-1.c", 52
+L0005:	ldx     #$00
+	lda     _failures
+	jmp     L0001
+	.dbg	line, "bug1211-ice-move-refs-1.c", 53
+L0001:	rts
+
+	.dbg	line
+.endproc
+
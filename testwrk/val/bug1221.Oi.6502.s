@@ -0,0 +1,53 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.export		_a
+	.export		_s1
+	.export		_s2
+	.export		_u1
+	.export		_u2
+	.export		_main
+
+.segment	"BSS"
+
+_a:
+	.res	2,$00
+_s1:
+	.res	2,$00
+_s2:
+	.res	2,$00
+_u1:
+	.res	2,$00
+_u2:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     _a
+	ora     _a+1
+	lda     _a
+	ora     _a+1
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
@@ -0,0 +1,74 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "bug1221.c", 229, 1613073744
+	.forceimport	__STARTUP__
+	.export		_a
+	.export		_s1
+	.export		_s2
+	.export		_u1
+	.export		_u2
+	.export		_main
+
+.segment	"BSS"
+
+_a:
+	.res	2,$00
+_s1:
+	.res	2,$00
+_s2:
+	.res	2,$00
+_u1:
+	.res	2,$00
+_u2:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "bug1221.c", 9
+	lda     _a
+	ora     _a+1
+	jeq     L0002
+	lda     _s1
+	ldx     _s1+1
+	jmp     L0003
+L0002:	lda     _s2
+	ldx     _s2+1
+	.dbg	line, "bug1221.c", 10
+L0003:	lda     _a
+	ora     _a+1
+	jeq     L0004
+	lda     _u1
+	ldx     _u1+1
+	jmp     L0005
+L0004:	lda     _u2
+	ldx     _u2+1
+	.dbg	line, "bug1221.c", 11
+L0005:	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "bug1221.c", 12
+L0001:	rts
+
+	.dbg	line
+.endproc
+
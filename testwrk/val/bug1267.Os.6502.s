@@ -0,0 +1,265 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+_si:
+	.byte	$21
+	.byte	$03
+
+.segment	"RODATA"
+
+S0005:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$75,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$34,$2E,$0A,$00
+S0004:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$61,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$2D,$31,$2E,$0A,$00
+S0006:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$73,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$2D,$33,$2E,$0A,$00
+S0002:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$75,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$32,$2E,$0A,$00
+S0003:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$73,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$33,$2E,$0A,$00
+S0001:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$61,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A,$00
+S0007:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ test_bitfield_typedefs (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_bitfield_typedefs: near
+
+.segment	"CODE"
+
+	lda     _si
+	tay
+	and     #$08
+	beq     L0003
+	tya
+	ora     #$F0
+	ldx     #$FF
+	jmp     L0004
+L0003:	tya
+	ldx     #$00
+	and     #$0F
+L0004:	cpx     #$00
+	bne     L001E
+	cmp     #$01
+	beq     L0002
+L001E:	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _si
+	tay
+	and     #$08
+	beq     L0006
+	tya
+	ora     #$F0
+	ldx     #$FF
+	jmp     L0007
+L0006:	tya
+	ldx     #$00
+	and     #$0F
+L0007:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0002:	lda     _si
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	cmp     #$02
+	beq     L0008
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     _si
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0008:	lda     _si+1
+	tay
+	and     #$08
+	beq     L000B
+	tya
+	ora     #$F0
+	ldx     #$FF
+	jmp     L000C
+L000B:	tya
+	ldx     #$00
+	and     #$0F
+L000C:	cpx     #$00
+	bne     L001F
+	cmp     #$03
+	beq     L000A
+L001F:	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     _si+1
+	tay
+	and     #$08
+	beq     L000E
+	tya
+	ora     #$F0
+	ldx     #$FF
+	jmp     L000F
+L000E:	tya
+	ldx     #$00
+	and     #$0F
+L000F:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L000A:	lda     _si
+	ora     #$0F
+	sta     _si
+	and     #$0F
+	ora     #$E0
+	sta     _si
+	lda     _si+1
+	and     #$F0
+	ora     #$0D
+	sta     _si+1
+	lda     _si
+	tay
+	and     #$08
+	beq     L0011
+	tya
+	ora     #$F0
+	ldx     #$FF
+	jmp     L0012
+L0011:	tya
+	ldx     #$00
+	and     #$0F
+L0012:	cpx     #$FF
+	bne     L0020
+	cmp     #$FF
+	beq     L0010
+L0020:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     _si
+	tay
+	and     #$08
+	beq     L0014
+	tya
+	ora     #$F0
+	ldx     #$FF
+	jmp     L0015
+L0014:	tya
+	ldx     #$00
+	and     #$0F
+L0015:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0010:	lda     _si
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	cmp     #$0E
+	beq     L0016
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     _si
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0016:	lda     _si+1
+	tay
+	and     #$08
+	beq     L0019
+	tya
+	ora     #$F0
+	ldx     #$FF
+	jmp     L001A
+L0019:	tya
+	ldx     #$00
+	and     #$0F
+L001A:	cpx     #$FF
+	bne     L0021
+	cmp     #$FD
+	beq     L0018
+L0021:	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	lda     _si+1
+	tay
+	and     #$08
+	beq     L001C
+	tya
+	ora     #$F0
+	ldx     #$FF
+	jmp     L001D
+L001C:	tya
+	ldx     #$00
+	and     #$0F
+L001D:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0018:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     _test_bitfield_typedefs
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     _failures
+	rts
+
+.endproc
+
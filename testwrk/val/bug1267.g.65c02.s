@@ -0,0 +1,334 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "bug1267.c", 2139, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+_si:
+	.byte	$21
+	.byte	$03
+
+.segment	"RODATA"
+
+S0005:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$75,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$34,$2E,$0A,$00
+S0004:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$61,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$2D,$31,$2E,$0A,$00
+S0006:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$73,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$2D,$33,$2E,$0A,$00
+S0002:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$75,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$32,$2E,$0A,$00
+S0003:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$73,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$33,$2E,$0A,$00
+S0001:
+	.byte	$47,$6F,$74,$20,$73,$69,$2E,$61,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A,$00
+S0007:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ test_bitfield_typedefs (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_bitfield_typedefs: near
+
+	.dbg	func, "test_bitfield_typedefs", "00", static, "_test_bitfield_typedefs"
+
+.segment	"CODE"
+
+	.dbg	line, "bug1267.c", 41
+	lda     _si
+	tay
+	and     #$08
+	beq     L0003
+	tya
+	ora     #$F0
+	ldx     #$FF
+	bra     L0004
+L0003:	tya
+	ldx     #$00
+	and     #$0F
+L0004:	cpx     #$00
+	bne     L0005
+	cmp     #$01
+L0005:	jsr     boolne
+	jeq     L0002
+	.dbg	line, "bug1267.c", 43
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _si
+	tay
+	and     #$08
+	beq     L0006
+	tya
+	ora     #$F0
+	ldx     #$FF
+	bra     L0007
+L0006:	tya
+	ldx     #$00
+	and     #$0F
+L0007:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1267.c", 44
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1267.c", 46
+L0002:	lda     _si
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	cpx     #$00
+	bne     L0009
+	cmp     #$02
+L0009:	jsr     boolne
+	jeq     L0008
+	.dbg	line, "bug1267.c", 47
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     _si
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1267.c", 48
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1267.c", 50
+L0008:	lda     _si+1
+	tay
+	and     #$08
+	beq     L000B
+	tya
+	ora     #$F0
+	ldx     #$FF
+	bra     L000C
+L000B:	tya
+	ldx     #$00
+	and     #$0F
+L000C:	cpx     #$00
+	bne     L000D
+	cmp     #$03
+L000D:	jsr     boolne
+	jeq     L000A
+	.dbg	line, "bug1267.c", 51
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     _si+1
+	tay
+	and     #$08
+	beq     L000E
+	tya
+	ora     #$F0
+	ldx     #$FF
+	bra     L000F
+L000E:	tya
+	ldx     #$00
+	and     #$0F
+L000F:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1267.c", 52
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1267.c", 55
+L000A:	ldx     #$00
+	lda     _si
+	ora     #$0F
+	sta     _si
+	.dbg	line, "bug1267.c", 56
+	ldx     #$00
+	lda     _si
+	and     #$0F
+	ora     #$E0
+	sta     _si
+	.dbg	line, "bug1267.c", 57
+	ldx     #$00
+	lda     _si+1
+	and     #$F0
+	ora     #$0D
+	sta     _si+1
+	.dbg	line, "bug1267.c", 60
+	lda     _si
+	tay
+	and     #$08
+	beq     L0011
+	tya
+	ora     #$F0
+	ldx     #$FF
+	bra     L0012
+L0011:	tya
+	ldx     #$00
+	and     #$0F
+L0012:	cpx     #$FF
+	bne     L0013
+	cmp     #$FF
+L0013:	jsr     boolne
+	jeq     L0010
+	.dbg	line, "bug1267.c", 61
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     _si
+	tay
+	and     #$08
+	beq     L0014
+	tya
+	ora     #$F0
+	ldx     #$FF
+	bra     L0015
+L0014:	tya
+	ldx     #$00
+	and     #$0F
+L0015:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1267.c", 62
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1267.c", 64
+L0010:	lda     _si
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	cpx     #$00
+	bne     L0017
+	cmp     #$0E
+L0017:	jsr     boolne
+	jeq     L0016
+	.dbg	line, "bug1267.c", 65
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     _si
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1267.c", 66
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1267.c", 68
+L0016:	lda     _si+1
+	tay
+	and     #$08
+	beq     L0019
+	tya
+	ora     #$F0
+	ldx     #$FF
+	bra     L001A
+L0019:	tya
+	ldx     #$00
+	and     #$0F
+L001A:	cpx     #$FF
+	bne     L001B
+	cmp     #$FD
+L001B:	jsr     boolne
+	jeq     L0018
+	.dbg	line, "bug1267.c", 69
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	lda     _si+1
+	tay
+	and     #$08
+	beq     L001C
+	tya
+	ora     #$F0
+	ldx     #$FF
+	bra     L001D
+L001C:	tya
+	ldx     #$00
+	and     #$0F
+L001D:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1267.c", 70
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1267.c", 72
+L0018:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "bug1267.c", 76
+	jsr     _test_bitfield_typedefs
+	.dbg	line, "bug1267.c", 77
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1267.c", 78
+	ldx     #$00
+	lda     _failures
+	jmp     L0001
+	.dbg	line, "bug1267.c", 79
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,192 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_stderr
+	.import		_fprintf
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$74,$77,$6F,$5F,$66,$69,$66
+	.byte	$74,$79,$5F,$66,$69,$76,$65,$20,$2A,$20,$74,$77,$6F,$5F,$66,$69
+	.byte	$66,$74,$79,$5F,$66,$69,$76,$65,$20,$3D,$3D,$20,$2D,$35,$31,$31
+	.byte	$2C,$20,$67,$6F,$74,$3A,$20,$25,$64,$0A,$00
+S0005:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$74,$77,$6F,$5F,$66,$69,$66
+	.byte	$74,$79,$5F,$73,$69,$78,$20,$2A,$20,$74,$77,$6F,$5F,$66,$69,$66
+	.byte	$74,$79,$5F,$73,$69,$78,$20,$3D,$3D,$20,$30,$2C,$20,$67,$6F,$74
+	.byte	$3A,$20,$25,$64,$0A,$00
+S0003:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$74,$77,$6F,$5F,$66,$69,$66
+	.byte	$74,$79,$5F,$66,$69,$76,$65,$5F,$73,$71,$75,$61,$72,$65,$64,$20
+	.byte	$3D,$3D,$20,$2D,$35,$31,$31,$2C,$20,$67,$6F,$74,$3A,$20,$25,$64
+	.byte	$0A,$00
+S0006:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$74,$77,$6F,$5F,$66,$69,$66
+	.byte	$74,$79,$5F,$73,$69,$78,$5F,$73,$71,$75,$61,$72,$65,$64,$20,$3D
+	.byte	$3D,$20,$30,$2C,$20,$67,$6F,$74,$3A,$20,$25,$64,$0A,$00
+S0001:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$32,$35,$35,$20,$2A,$20,$32
+	.byte	$35,$35,$20,$3D,$3D,$20,$2D,$35,$31,$31,$2C,$20,$67,$6F,$74,$3A
+	.byte	$20,$25,$64,$0A,$00
+S0004:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$32,$35,$36,$55,$20,$2A,$20
+	.byte	$32,$35,$36,$55,$20,$3D,$3D,$20,$30,$2C,$20,$67,$6F,$74,$3A,$20
+	.byte	$25,$64,$0A,$00
+S0007:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #$FF
+	jsr     pusha0
+	ldx     #$FE
+	lda     #$01
+	jsr     pushax
+	tax
+	lda     #$00
+	jsr     pushax
+	jsr     push0
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldx     #$FE
+	lda     #$01
+	jsr     pushax
+	ldy     #$06
+	jsr     _fprintf
+	inc     _failures
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     tosmulax
+	cpx     #$FE
+	bne     L000C
+	cmp     #$01
+	beq     L0003
+L000C:	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0D
+	jsr     ldaxysp
+	jsr     tosmulax
+	jsr     pushax
+	ldy     #$06
+	jsr     _fprintf
+	inc     _failures
+L0003:	ldy     #$05
+	lda     (sp),y
+	cmp     #$FE
+	bne     L000D
+	dey
+	lda     (sp),y
+	cmp     #$01
+	beq     L0005
+L000D:	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$06
+	jsr     _fprintf
+	inc     _failures
+L0005:	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	jsr     push0
+	ldy     #$06
+	jsr     _fprintf
+	inc     _failures
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosmulax
+	cpx     #$00
+	bne     L000E
+	cmp     #$00
+	beq     L0008
+L000E:	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     tosmulax
+	jsr     pushax
+	ldy     #$06
+	jsr     _fprintf
+	inc     _failures
+L0008:	ldy     #$00
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L000A
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$06
+	jsr     _fprintf
+	inc     _failures
+L000A:	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     _failures
+	jmp     incsp8
+
+.endproc
+
@@ -0,0 +1,262 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "bug1310.c", 2571, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "stderr", "00", extern, "_stderr"
+	.dbg		sym, "fprintf", "00", extern, "_fprintf"
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_stderr
+	.import		_fprintf
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$74,$77,$6F,$5F,$66,$69,$66
+	.byte	$74,$79,$5F,$66,$69,$76,$65,$20,$2A,$20,$74,$77,$6F,$5F,$66,$69
+	.byte	$66,$74,$79,$5F,$66,$69,$76,$65,$20,$3D,$3D,$20,$2D,$35,$31,$31
+	.byte	$2C,$20,$67,$6F,$74,$3A,$20,$25,$64,$0A,$00
+S0005:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$74,$77,$6F,$5F,$66,$69,$66
+	.byte	$74,$79,$5F,$73,$69,$78,$20,$2A,$20,$74,$77,$6F,$5F,$66,$69,$66
+	.byte	$74,$79,$5F,$73,$69,$78,$20,$3D,$3D,$20,$30,$2C,$20,$67,$6F,$74
+	.byte	$3A,$20,$25,$64,$0A,$00
+S0003:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$74,$77,$6F,$5F,$66,$69,$66
+	.byte	$74,$79,$5F,$66,$69,$76,$65,$5F,$73,$71,$75,$61,$72,$65,$64,$20
+	.byte	$3D,$3D,$20,$2D,$35,$31,$31,$2C,$20,$67,$6F,$74,$3A,$20,$25,$64
+	.byte	$0A,$00
+S0006:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$74,$77,$6F,$5F,$66,$69,$66
+	.byte	$74,$79,$5F,$73,$69,$78,$5F,$73,$71,$75,$61,$72,$65,$64,$20,$3D
+	.byte	$3D,$20,$30,$2C,$20,$67,$6F,$74,$3A,$20,$25,$64,$0A,$00
+S0001:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$32,$35,$35,$20,$2A,$20,$32
+	.byte	$35,$35,$20,$3D,$3D,$20,$2D,$35,$31,$31,$2C,$20,$67,$6F,$74,$3A
+	.byte	$20,$25,$64,$0A,$00
+S0004:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$32,$35,$36,$55,$20,$2A,$20
+	.byte	$32,$35,$36,$55,$20,$3D,$3D,$20,$30,$2C,$20,$67,$6F,$74,$3A,$20
+	.byte	$25,$64,$0A,$00
+S0007:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+	.dbg	sym, "two_fifty_five", "00", auto, -2
+	.dbg	sym, "two_fifty_five_squared", "00", auto, -4
+	.dbg	sym, "two_fifty_six", "00", auto, -6
+	.dbg	sym, "two_fifty_six_squared", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "bug1310.c", 34
+	ldx     #$00
+	lda     #$FF
+	jsr     pushax
+	.dbg	line, "bug1310.c", 35
+	ldx     #$FE
+	lda     #$01
+	jsr     pushax
+	.dbg	line, "bug1310.c", 38
+	ldx     #$01
+	lda     #$00
+	jsr     pushax
+	.dbg	line, "bug1310.c", 39
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	.dbg	line, "bug1310.c", 42
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldx     #$FE
+	lda     #$01
+	jsr     pushax
+	ldy     #$06
+	jsr     _fprintf
+	.dbg	line, "bug1310.c", 43
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1310.c", 45
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     tosmulax
+	cpx     #$FE
+	bne     L0004
+	cmp     #$01
+L0004:	jsr     boolne
+	jeq     L0003
+	.dbg	line, "bug1310.c", 46
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	.dbg	line, "bug1310.c", 47
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0D
+	jsr     ldaxysp
+	jsr     tosmulax
+	jsr     pushax
+	ldy     #$06
+	jsr     _fprintf
+	.dbg	line, "bug1310.c", 48
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1310.c", 50
+L0003:	ldy     #$05
+	jsr     ldaxysp
+	cpx     #$FE
+	bne     L0006
+	cmp     #$01
+L0006:	jsr     boolne
+	jeq     L0005
+	.dbg	line, "bug1310.c", 51
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	.dbg	line, "bug1310.c", 52
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$06
+	jsr     _fprintf
+	.dbg	line, "bug1310.c", 53
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1310.c", 57
+L0005:	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldy     #$06
+	jsr     _fprintf
+	.dbg	line, "bug1310.c", 58
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1310.c", 60
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosmulax
+	cpx     #$00
+	bne     L0009
+	cmp     #$00
+L0009:	jsr     boolne
+	jeq     L0008
+	.dbg	line, "bug1310.c", 61
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	.dbg	line, "bug1310.c", 62
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     tosmulax
+	jsr     pushax
+	ldy     #$06
+	jsr     _fprintf
+	.dbg	line, "bug1310.c", 63
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1310.c", 65
+L0008:	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L000B
+	cmp     #$00
+L000B:	jsr     boolne
+	jeq     L000A
+	.dbg	line, "bug1310.c", 66
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	.dbg	line, "bug1310.c", 67
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$06
+	jsr     _fprintf
+	.dbg	line, "bug1310.c", 68
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1310.c", 71
+L000A:	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1310.c", 72
+	ldx     #$00
+	lda     _failures
+	jmp     L0001
+	.dbg	line, "bug1310.c", 73
+L0001:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,59 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.export		_main
+
+.segment	"BSS"
+
+_var:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; void __near__ foo (char *, char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_foo: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     _var
+	ldx     _var+1
+	jsr     pushax
+	inc     _var
+	bne     L0002
+	inc     _var+1
+L0002:	lda     #$62
+	jsr     _foo
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
@@ -0,0 +1,99 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "bug1320.c", 1242, 1613073744
+	.forceimport	__STARTUP__
+	.export		_main
+
+.segment	"BSS"
+
+_var:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; void __near__ foo (char *, char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_foo: near
+
+	.dbg	func, "foo", "00", static, "_foo"
+	.dbg	sym, "$anon-param-0001", "00", auto, 1
+	.dbg	sym, "$anon-param-0002", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "bug1320.c", 32
+	jsr     pusha
+	.dbg	line, "bug1320.c", 33
+	jsr     incsp3
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; char __near__ bar (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_bar: near
+
+	.dbg	func, "bar", "00", static, "_bar"
+
+.segment	"CODE"
+
+	.dbg	line, "bug1320.c", 37
+	ldx     #$00
+	lda     #$62
+	jmp     L0001
+	.dbg	line, "bug1320.c", 38
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "bug1320.c", 42
+	lda     _var
+	ldx     _var+1
+	jsr     pushax
+	inc     _var
+	bne     L0002
+	inc     _var+1
+L0002:	lda     _var
+	ldx     _var+1
+	jsr     _bar
+	jsr     _foo
+	.dbg	line, "bug1320.c", 43
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "bug1320.c", 44
+L0001:	rts
+
+	.dbg	line
+.endproc
+
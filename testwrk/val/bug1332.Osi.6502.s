@@ -0,0 +1,242 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_stderr
+	.import		_fprintf
+	.import		_printf
+	.import		_snprintf
+	.import		_strcmp
+	.export		_test_if_val
+	.export		_test_sprintf
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+
+.segment	"RODATA"
+
+_b:
+	.byte	$01
+	.byte	$80
+S0005:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$3A,$20,$73,$70,$72,$69,$6E,$74
+	.byte	$66,$20,$28,$6D,$73,$62,$29,$20,$3D,$3D,$20,$22,$31,$22,$2C,$20
+	.byte	$67,$6F,$74,$3A,$20,$25,$73,$0A,$00
+S0002:
+	.byte	$69,$66,$20,$28,$6D,$73,$62,$20,$3D,$3D,$20,$31,$29,$20,$46,$41
+	.byte	$49,$4C,$45,$44,$0A,$00
+S0006:
+	.byte	$73,$70,$72,$69,$6E,$74,$66,$20,$28,$6D,$73,$62,$29,$20,$4F,$4B
+	.byte	$0A,$00
+S0001:
+	.byte	$69,$66,$20,$28,$6D,$73,$62,$20,$3D,$3D,$20,$31,$29,$20,$4F,$4B
+	.byte	$0A,$00
+S0007:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+S0003:
+	.byte	$25,$75,$00
+S0004:
+	.byte	$31,$00
+
+.segment	"BSS"
+
+_v:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; void __near__ test_if_val (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_if_val: near
+
+.segment	"CODE"
+
+	ldx     #$12
+	lda     #$34
+	sta     _v
+	stx     _v+1
+	lda     _b+1
+	rol     a
+	rol     a
+	and     #$01
+	cmp     #$01
+	bne     L0002
+	jsr     decsp4
+	lda     _stderr
+	ldy     #$02
+	sta     (sp),y
+	iny
+	lda     _stderr+1
+	sta     (sp),y
+	lda     #<(S0001)
+	ldy     #$00
+	sta     (sp),y
+	iny
+	lda     #>(S0001)
+	sta     (sp),y
+	ldy     #$04
+	jmp     _fprintf
+L0002:	jsr     decsp4
+	lda     _stderr
+	ldy     #$02
+	sta     (sp),y
+	iny
+	lda     _stderr+1
+	sta     (sp),y
+	lda     #<(S0002)
+	ldy     #$00
+	sta     (sp),y
+	iny
+	lda     #>(S0002)
+	sta     (sp),y
+	ldy     #$04
+	jsr     _fprintf
+	inc     _failures
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_sprintf (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_sprintf: near
+
+.segment	"CODE"
+
+	ldy     #$10
+	jsr     subysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$06
+	bcc     L0002
+	inx
+L0002:	ldy     #$04
+	sta     (sp),y
+	iny
+	txa
+	sta     (sp),y
+	lda     #$0A
+	ldy     #$02
+	sta     (sp),y
+	iny
+	lda     #$00
+	sta     (sp),y
+	lda     #<(S0003)
+	ldy     #$00
+	sta     (sp),y
+	iny
+	lda     #>(S0003)
+	sta     (sp),y
+	lda     _b+1
+	rol     a
+	rol     a
+	and     #$01
+	jsr     pusha0
+	ldy     #$08
+	jsr     _snprintf
+	lda     sp+1
+	sta     ptr1+1
+	lda     sp
+	sta     ptr1
+	ldy     #$00
+	jmp     L0004
+L0005:	tax
+	beq     L0006
+	iny
+L0004:	lda     (ptr1),y
+	cmp     S0004,y
+	beq     L0005
+	ldx     #$01
+	bcs     L0006
+	ldx     #$FF
+L0006:	cpx     #$00
+	bne     L000A
+	cmp     #$00
+	beq     L0003
+L000A:	jsr     decsp4
+	lda     _stderr
+	ldy     #$02
+	sta     (sp),y
+	iny
+	lda     _stderr+1
+	sta     (sp),y
+	lda     #<(S0005)
+	ldy     #$00
+	sta     (sp),y
+	iny
+	lda     #>(S0005)
+	sta     (sp),y
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$04
+	bcc     L0008
+	inx
+L0008:	jsr     pushax
+	ldy     #$06
+	jsr     _fprintf
+	inc     _failures
+	jmp     L0009
+L0003:	jsr     decsp4
+	lda     _stderr
+	ldy     #$02
+	sta     (sp),y
+	iny
+	lda     _stderr+1
+	sta     (sp),y
+	lda     #<(S0006)
+	ldy     #$00
+	sta     (sp),y
+	iny
+	lda     #>(S0006)
+	sta     (sp),y
+	ldy     #$04
+	jsr     _fprintf
+L0009:	ldy     #$0A
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     _test_if_val
+	jsr     _test_sprintf
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     _failures
+	rts
+
+.endproc
+
@@ -0,0 +1,240 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "bug1332.c", 1925, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/string.h", 5104, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "stderr", "00", extern, "_stderr"
+	.dbg		sym, "fprintf", "00", extern, "_fprintf"
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.dbg		sym, "snprintf", "00", extern, "_snprintf"
+	.dbg		sym, "strcmp", "00", extern, "_strcmp"
+	.import		_stderr
+	.import		_fprintf
+	.import		_printf
+	.import		_snprintf
+	.import		_strcmp
+	.export		_test_if_val
+	.export		_test_sprintf
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+
+.segment	"RODATA"
+
+_b:
+	.byte	$01
+	.byte	$80
+S0005:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$3A,$20,$73,$70,$72,$69,$6E,$74
+	.byte	$66,$20,$28,$6D,$73,$62,$29,$20,$3D,$3D,$20,$22,$31,$22,$2C,$20
+	.byte	$67,$6F,$74,$3A,$20,$25,$73,$0A,$00
+S0002:
+	.byte	$69,$66,$20,$28,$6D,$73,$62,$20,$3D,$3D,$20,$31,$29,$20,$46,$41
+	.byte	$49,$4C,$45,$44,$0A,$00
+S0006:
+	.byte	$73,$70,$72,$69,$6E,$74,$66,$20,$28,$6D,$73,$62,$29,$20,$4F,$4B
+	.byte	$0A,$00
+S0001:
+	.byte	$69,$66,$20,$28,$6D,$73,$62,$20,$3D,$3D,$20,$31,$29,$20,$4F,$4B
+	.byte	$0A,$00
+S0007:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+S0003:
+	.byte	$25,$75,$00
+S0004:
+	.byte	$31,$00
+
+.segment	"BSS"
+
+_v:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; void __near__ test_if_val (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_if_val: near
+
+	.dbg	func, "test_if_val", "00", extern, "_test_if_val"
+
+.segment	"CODE"
+
+	.dbg	line, "bug1332.c", 41
+	ldx     #$12
+	lda     #$34
+	sta     _v
+	stx     _v+1
+	.dbg	line, "bug1332.c", 43
+	lda     _b+1
+	rol     a
+	rol     a
+	and     #$01
+	ldx     #$00
+	cpx     #$00
+	bne     L0003
+	cmp     #$01
+L0003:	jsr     booleq
+	jeq     L0002
+	.dbg	line, "bug1332.c", 44
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$04
+	jsr     _fprintf
+	.dbg	line, "bug1332.c", 45
+	jmp     L0004
+	.dbg	line, "bug1332.c", 46
+L0002:	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$04
+	jsr     _fprintf
+	.dbg	line, "bug1332.c", 47
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1332.c", 49
+L0004:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_sprintf (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_sprintf: near
+
+	.dbg	func, "test_sprintf", "00", extern, "_test_sprintf"
+	.dbg	sym, "buf", "00", auto, -10
+
+.segment	"CODE"
+
+	.dbg	line, "bug1332.c", 55
+	ldy     #$0A
+	jsr     subysp
+	lda     sp
+	ldx     sp+1
+	jsr     pushax
+	ldx     #$00
+	lda     #$0A
+	jsr     pushax
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     _b+1
+	rol     a
+	rol     a
+	and     #$01
+	ldx     #$00
+	jsr     pushax
+	ldy     #$08
+	jsr     _snprintf
+	.dbg	line, "bug1332.c", 57
+	lda     sp
+	ldx     sp+1
+	jsr     pushax
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     _strcmp
+	cpx     #$00
+	bne     L0003
+	cmp     #$00
+L0003:	jsr     boolne
+	jeq     L0002
+	.dbg	line, "bug1332.c", 58
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     #$04
+	jsr     leaa0sp
+	jsr     pushax
+	ldy     #$06
+	jsr     _fprintf
+	.dbg	line, "bug1332.c", 59
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "bug1332.c", 60
+	jmp     L0004
+	.dbg	line, "bug1332.c", 61
+L0002:	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$04
+	jsr     _fprintf
+	.dbg	line, "bug1332.c", 63
+L0004:	ldy     #$0A
+	jsr     addysp
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "bug1332.c", 67
+	jsr     _test_if_val
+	.dbg	line, "bug1332.c", 68
+	jsr     _test_sprintf
+	.dbg	line, "bug1332.c", 70
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1332.c", 71
+	ldx     #$00
+	lda     _failures
+	jmp     L0001
+	.dbg	line, "bug1332.c", 72
+L0001:	rts
+
+	.dbg	line
+.endproc
+
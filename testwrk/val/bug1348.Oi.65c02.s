@@ -0,0 +1,187 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_notrandcount:
+	.byte	$00
+_err:
+	.byte	$00
+
+.segment	"RODATA"
+
+_notrandtab:
+	.word	$FFFF
+	.word	$7FFF
+	.word	$3FFF
+	.word	$1FFF
+	.word	$0FFF
+	.word	$07FF
+	.word	$03FF
+	.word	$01FF
+	.word	$00FF
+	.word	$007F
+	.word	$003F
+	.word	$001F
+	.word	$000F
+	.word	$0007
+	.word	$0003
+	.word	$0001
+_cmptab:
+	.byte	$FF
+	.byte	$7F
+	.byte	$3F
+	.byte	$1F
+	.byte	$0F
+	.byte	$07
+	.byte	$03
+	.byte	$01
+	.byte	$80
+	.byte	$40
+	.byte	$20
+	.byte	$10
+	.byte	$08
+	.byte	$04
+	.byte	$02
+	.byte	$01
+S0001:
+	.byte	$25,$35,$64,$20,$3E,$20,$25,$33,$64,$20,$25,$75,$28,$25,$30,$32
+	.byte	$78,$29,$20,$25,$75,$28,$25,$30,$32,$78,$29,$20,$20,$25,$73,$0A
+	.byte	$00
+S0003:
+	.byte	$21,$3D,$00
+S0002	:=	S0003+1
+
+.segment	"BSS"
+
+_n1:
+	.res	1,$00
+_n2:
+	.res	1,$00
+_i:
+	.res	1,$00
+_ii:
+	.res	1,$00
+_s:
+	.res	1,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	stz     _ii
+	jmp     L0016
+L0005:	ldy     _ii
+	lda     _cmptab,y
+	sta     _s
+	stz     _i
+	jmp     L0015
+L0012:	stz     _n2
+	stz     _n1
+	lda     _notrandcount
+	and     #$0F
+	asl     a
+	tay
+	lda     _notrandtab,y
+	cmp     _s
+	bcc     L0013
+	beq     L0013
+	lda     #$01
+	sta     _n1
+L0013:	lda     _notrandcount
+	and     #$0F
+	asl     a
+	tay
+	lda     _notrandtab,y
+	cmp     _s
+	bcc     L000C
+	beq     L000C
+	lda     #$01
+	sta     _n2
+L000C:	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldx     #$00
+	lda     _i
+	asl     a
+	bcc     L0011
+	inx
+	clc
+L0011:	adc     #<(_notrandtab)
+	sta     ptr1
+	txa
+	adc     #>(_notrandtab)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	jsr     pushax
+	lda     _s
+	jsr     pusha0
+	lda     _n1
+	jsr     pusha0
+	lda     _notrandcount
+	and     #$0F
+	asl     a
+	tay
+	lda     _notrandtab,y
+	jsr     pusha0
+	lda     _n2
+	jsr     pusha0
+	lda     _notrandcount
+	and     #$0F
+	asl     a
+	tay
+	lda     _notrandtab,y
+	jsr     pusha0
+	lda     _n1
+	cmp     _n2
+	bne     L000D
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	bra     L000E
+L000D:	lda     #<(S0003)
+	ldx     #>(S0003)
+L000E:	jsr     pushax
+	ldy     #$10
+	jsr     _printf
+	lda     _n1
+	cmp     _n2
+	beq     L0014
+	lda     #$01
+	sta     _err
+L0014:	inc     _notrandcount
+	inc     _i
+L0015:	lda     _i
+	cmp     #$10
+	jcc     L0012
+	inc     _ii
+L0016:	lda     _ii
+	cmp     #$10
+	jcc     L0005
+	ldx     #$00
+	lda     _err
+	rts
+
+.endproc
+
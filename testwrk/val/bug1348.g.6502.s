@@ -0,0 +1,277 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "bug1348.c", 1277, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_notrandcount:
+	.byte	$00
+_err:
+	.byte	$00
+
+.segment	"RODATA"
+
+_notrandtab:
+	.word	$FFFF
+	.word	$7FFF
+	.word	$3FFF
+	.word	$1FFF
+	.word	$0FFF
+	.word	$07FF
+	.word	$03FF
+	.word	$01FF
+	.word	$00FF
+	.word	$007F
+	.word	$003F
+	.word	$001F
+	.word	$000F
+	.word	$0007
+	.word	$0003
+	.word	$0001
+_cmptab:
+	.byte	$FF
+	.byte	$7F
+	.byte	$3F
+	.byte	$1F
+	.byte	$0F
+	.byte	$07
+	.byte	$03
+	.byte	$01
+	.byte	$80
+	.byte	$40
+	.byte	$20
+	.byte	$10
+	.byte	$08
+	.byte	$04
+	.byte	$02
+	.byte	$01
+S0001:
+	.byte	$25,$35,$64,$20,$3E,$20,$25,$33,$64,$20,$25,$75,$28,$25,$30,$32
+	.byte	$78,$29,$20,$25,$75,$28,$25,$30,$32,$78,$29,$20,$20,$25,$73,$0A
+	.byte	$00
+S0003:
+	.byte	$21,$3D,$00
+S0002	:=	S0003+1
+
+.segment	"BSS"
+
+_n1:
+	.res	1,$00
+_n2:
+	.res	1,$00
+_i:
+	.res	1,$00
+_ii:
+	.res	1,$00
+_s:
+	.res	1,$00
+
+; ---------------------------------------------------------------
+; int __near__ notrand (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_notrand: near
+
+	.dbg	func, "notrand", "00", static, "_notrand"
+
+.segment	"CODE"
+
+	.dbg	line, "bug1348.c", 16
+	ldx     #$00
+	lda     _notrandcount
+	ldx     #$00
+	and     #$0F
+	jsr     aslax1
+	clc
+	adc     #<(_notrandtab)
+	tay
+	txa
+	adc     #>(_notrandtab)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jmp     L0001
+	.dbg	line, "bug1348.c", 17
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "bug1348.c", 32
+	ldx     #$00
+	lda     #$00
+	sta     _ii
+	jmp     L0002
+	.dbg	line, "bug1348.c", 33
+L0005:	lda     #<(_cmptab)
+	ldx     #>(_cmptab)
+	clc
+	adc     _ii
+	bcc     L0006
+	inx
+L0006:	ldy     #$00
+	jsr     ldauidx
+	sta     _s
+	.dbg	line, "bug1348.c", 34
+	ldx     #$00
+	lda     #$00
+	sta     _i
+	jmp     L0007
+	.dbg	line, "bug1348.c", 35
+L000A:	ldx     #$00
+	lda     #$00
+	sta     _n2
+	sta     _n1
+	.dbg	line, "bug1348.c", 36
+	jsr     _notrand
+	ldx     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     _s
+	jsr     tosgtax
+	jeq     L000B
+	.dbg	line, "bug1348.c", 37
+	ldx     #$00
+	lda     #$01
+	sta     _n1
+	.dbg	line, "bug1348.c", 39
+L000B:	jsr     _notrand
+	ldx     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     _s
+	jsr     tosugtax
+	jeq     L000C
+	.dbg	line, "bug1348.c", 40
+	ldx     #$00
+	lda     #$01
+	sta     _n2
+	.dbg	line, "bug1348.c", 42
+L000C:	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	.dbg	line, "bug1348.c", 43
+	ldx     #$00
+	lda     _i
+	jsr     aslax1
+	clc
+	adc     #<(_notrandtab)
+	tay
+	txa
+	adc     #>(_notrandtab)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldx     #$00
+	lda     _s
+	jsr     pushax
+	.dbg	line, "bug1348.c", 44
+	ldx     #$00
+	lda     _n1
+	jsr     pushax
+	jsr     _notrand
+	ldx     #$00
+	jsr     pushax
+	.dbg	line, "bug1348.c", 45
+	ldx     #$00
+	lda     _n2
+	jsr     pushax
+	jsr     _notrand
+	ldx     #$00
+	jsr     pushax
+	.dbg	line, "bug1348.c", 46
+	ldx     #$00
+	lda     _n1
+	jsr     pushax
+	ldx     #$00
+	lda     _n2
+	jsr     toseqax
+	jeq     L000D
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jmp     L000E
+L000D:	lda     #<(S0003)
+	ldx     #>(S0003)
+L000E:	jsr     pushax
+	ldy     #$10
+	jsr     _printf
+	.dbg	line, "bug1348.c", 47
+	ldx     #$00
+	lda     _n1
+	jsr     pushax
+	ldx     #$00
+	lda     _n2
+	jsr     tosneax
+	jeq     L000F
+	.dbg	line, "bug1348.c", 48
+	ldx     #$00
+	lda     #$01
+	sta     _err
+	.dbg	line, "bug1348.c", 50
+L000F:	ldx     #$00
+	lda     _notrandcount
+	inc     _notrandcount
+	.dbg	line, "bug1348.c", 34
+	ldx     #$00
+	inc     _i
+	lda     _i
+	jmp     L0007
+L0007:	ldx     #$00
+	lda     _i
+	cmp     #$10
+	jsr     boolult
+	jne     L000A
+	.dbg	line, "bug1348.c", 32
+	ldx     #$00
+	inc     _ii
+	lda     _ii
+	jmp     L0002
+L0002:	ldx     #$00
+	lda     _ii
+	cmp     #$10
+	jsr     boolult
+	jne     L0005
+	.dbg	line, "bug1348.c", 53
+	ldx     #$00
+	lda     _err
+	jmp     L0001
+	.dbg	line, "bug1348.c", 54
+L0001:	rts
+
+	.dbg	line
+.endproc
+
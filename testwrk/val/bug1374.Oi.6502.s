@@ -0,0 +1,437 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_test1
+	.export		_test1b
+	.export		_test2
+	.export		_test3
+	.export		_test3b
+	.export		_test4
+	.export		_test4b
+	.export		_main
+
+.segment	"DATA"
+
+_res:
+	.word	$0000
+
+.segment	"RODATA"
+
+S0008:
+	.byte	$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+S0003:
+	.byte	$25,$78,$0A,$00
+S0004	:=	S0003+0
+S0005	:=	S0003+0
+S0006	:=	S0003+0
+S0007	:=	S0003+0
+S0002	:=	S0003+0
+S0001	:=	S0003+0
+
+; ---------------------------------------------------------------
+; int __near__ test1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test1: near
+
+.segment	"CODE"
+
+	lda     #$89
+	jsr     pusha
+	lda     #$AB
+	jsr     pusha
+	ldy     #$00
+	lda     (sp),y
+	pha
+	iny
+	lda     (sp),y
+	tax
+	pla
+	jsr     pushax
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldy     #$01
+	lda     (sp),y
+	cmp     #$89
+	bne     L0003
+	dey
+	lda     (sp),y
+	cmp     #$AB
+	bne     L0003
+	ldx     #$00
+	txa
+	jmp     L0001
+L0003:	ldx     #$00
+	lda     #$01
+L0001:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test1b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test1b: near
+
+.segment	"CODE"
+
+	lda     #$89
+	jsr     pusha
+	lda     #$AB
+	jsr     pusha
+	ldy     #$00
+	lda     (sp),y
+	pha
+	iny
+	lda     (sp),y
+	tax
+	pla
+	jsr     pushax
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldy     #$01
+	lda     (sp),y
+	cmp     #$89
+	bne     L0003
+	dey
+	lda     (sp),y
+	cmp     #$AB
+	bne     L0003
+	ldx     #$00
+	txa
+	jmp     L0001
+L0003:	ldx     #$00
+	lda     #$01
+L0001:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test2: near
+
+.segment	"CODE"
+
+	ldx     #$89
+	lda     #$00
+	jsr     pushax
+	lda     #$AB
+	jsr     pusha
+	ldy     #$00
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	pha
+	iny
+	lda     (sp),y
+	tax
+	pla
+	jsr     pushax
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldy     #$01
+	lda     (sp),y
+	cmp     #$89
+	bne     L0003
+	dey
+	lda     (sp),y
+	cmp     #$AB
+	bne     L0003
+	ldx     #$00
+	txa
+	jmp     L0001
+L0003:	ldx     #$00
+	lda     #$01
+L0001:	jmp     incsp5
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test3 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test3: near
+
+.segment	"CODE"
+
+	lda     #$89
+	jsr     pusha0
+	lda     #$AB
+	jsr     pusha
+	lda     (sp,x)
+	pha
+	ldy     #$01
+	lda     (sp),y
+	tax
+	pla
+	jsr     pushax
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldy     #$01
+	lda     (sp),y
+	cmp     #$89
+	bne     L0003
+	dey
+	lda     (sp),y
+	cmp     #$AB
+	bne     L0003
+	ldx     #$00
+	txa
+	jmp     L0001
+L0003:	ldx     #$00
+	lda     #$01
+L0001:	jmp     incsp5
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test3b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test3b: near
+
+.segment	"CODE"
+
+	lda     #$89
+	jsr     pusha0
+	lda     #$AB
+	jsr     pusha
+	lda     (sp,x)
+	pha
+	ldy     #$01
+	lda     (sp),y
+	tax
+	pla
+	jsr     pushax
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldy     #$01
+	lda     (sp),y
+	cmp     #$89
+	bne     L0003
+	dey
+	lda     (sp),y
+	cmp     #$AB
+	bne     L0003
+	ldx     #$00
+	txa
+	jmp     L0001
+L0003:	ldx     #$00
+	lda     #$01
+L0001:	jmp     incsp5
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test4 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test4: near
+
+.segment	"CODE"
+
+	lda     #$89
+	jsr     pusha
+	lda     #$AB
+	jsr     pusha0
+	ldy     #$02
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	pha
+	txa
+	ora     ptr1+1
+	tax
+	pla
+	jsr     pushax
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldy     #$01
+	lda     (sp),y
+	cmp     #$89
+	bne     L0003
+	dey
+	lda     (sp),y
+	cmp     #$AB
+	bne     L0003
+	ldx     #$00
+	txa
+	jmp     L0001
+L0003:	ldx     #$00
+	lda     #$01
+L0001:	jmp     incsp5
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test4b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test4b: near
+
+.segment	"CODE"
+
+	lda     #$89
+	jsr     pusha
+	lda     #$AB
+	jsr     pusha0
+	ldy     #$02
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	pha
+	txa
+	ora     ptr1+1
+	tax
+	pla
+	jsr     pushax
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldy     #$01
+	lda     (sp),y
+	cmp     #$89
+	bne     L0003
+	dey
+	lda     (sp),y
+	cmp     #$AB
+	bne     L0003
+	ldx     #$00
+	txa
+	jmp     L0001
+L0003:	ldx     #$00
+	lda     #$01
+L0001:	jmp     incsp5
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     _res
+	ldx     _res+1
+	jsr     pushax
+	jsr     _test1
+	jsr     tosorax
+	sta     _res
+	stx     _res+1
+	jsr     pushax
+	jsr     _test2
+	jsr     tosorax
+	sta     _res
+	stx     _res+1
+	jsr     pushax
+	jsr     _test3
+	jsr     tosorax
+	sta     _res
+	stx     _res+1
+	jsr     pushax
+	jsr     _test4
+	jsr     tosorax
+	sta     _res
+	stx     _res+1
+	jsr     pushax
+	jsr     _test1b
+	jsr     tosorax
+	sta     _res
+	stx     _res+1
+	jsr     pushax
+	jsr     _test3b
+	jsr     tosorax
+	sta     _res
+	stx     _res+1
+	jsr     pushax
+	jsr     _test4b
+	jsr     tosorax
+	sta     _res
+	stx     _res+1
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	lda     _res
+	ldx     _res+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     _res
+	ldx     _res+1
+	rts
+
+.endproc
+
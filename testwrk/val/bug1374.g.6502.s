@@ -0,0 +1,573 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "bug1374.c", 1372, 1613073744
+	.dbg		file, "/root/repo/include/stdint.h", 6196, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_test1
+	.export		_test1b
+	.export		_test2
+	.export		_test3
+	.export		_test3b
+	.export		_test4
+	.export		_test4b
+	.export		_main
+
+.segment	"DATA"
+
+_res:
+	.word	$0000
+
+.segment	"RODATA"
+
+S0008:
+	.byte	$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+S0003:
+	.byte	$25,$78,$0A,$00
+S0004	:=	S0003+0
+S0005	:=	S0003+0
+S0006	:=	S0003+0
+S0007	:=	S0003+0
+S0002	:=	S0003+0
+S0001	:=	S0003+0
+
+; ---------------------------------------------------------------
+; int __near__ test1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test1: near
+
+	.dbg	func, "test1", "00", extern, "_test1"
+	.dbg	sym, "x", "00", auto, -1
+	.dbg	sym, "y", "00", auto, -2
+	.dbg	sym, "z", "00", auto, -4
+
+.segment	"CODE"
+
+	.dbg	line, "bug1374.c", 11
+	lda     #$89
+	jsr     pusha
+	.dbg	line, "bug1374.c", 12
+	lda     #$AB
+	jsr     pusha
+	.dbg	line, "bug1374.c", 13
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	tax
+	lda     #$00
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosorax
+	jsr     pushax
+	.dbg	line, "bug1374.c", 14
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1374.c", 15
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$89
+	bne     L0002
+	cmp     #$AB
+L0002:	jsr     booleq
+	jeq     L0003
+	ldx     #$00
+	lda     #$00
+	jmp     L0004
+L0003:	ldx     #$00
+	lda     #$01
+L0004:	jmp     L0001
+	.dbg	line, "bug1374.c", 16
+L0001:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test1b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test1b: near
+
+	.dbg	func, "test1b", "00", extern, "_test1b"
+	.dbg	sym, "x", "00", auto, -1
+	.dbg	sym, "y", "00", auto, -2
+	.dbg	sym, "z", "00", auto, -4
+
+.segment	"CODE"
+
+	.dbg	line, "bug1374.c", 20
+	lda     #$89
+	jsr     pusha
+	.dbg	line, "bug1374.c", 21
+	lda     #$AB
+	jsr     pusha
+	.dbg	line, "bug1374.c", 22
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	tax
+	lda     #$00
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosorax
+	jsr     pushax
+	.dbg	line, "bug1374.c", 23
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1374.c", 24
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$89
+	bne     L0002
+	cmp     #$AB
+L0002:	jsr     booleq
+	jeq     L0003
+	ldx     #$00
+	lda     #$00
+	jmp     L0004
+L0003:	ldx     #$00
+	lda     #$01
+L0004:	jmp     L0001
+	.dbg	line, "bug1374.c", 25
+L0001:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test2: near
+
+	.dbg	func, "test2", "00", extern, "_test2"
+	.dbg	sym, "x", "00", auto, -2
+	.dbg	sym, "y", "00", auto, -3
+	.dbg	sym, "z", "00", auto, -5
+
+.segment	"CODE"
+
+	.dbg	line, "bug1374.c", 29
+	ldx     #$89
+	lda     #$00
+	jsr     pushax
+	.dbg	line, "bug1374.c", 30
+	lda     #$AB
+	jsr     pusha
+	.dbg	line, "bug1374.c", 31
+	ldy     #$02
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosorax
+	jsr     pushax
+	.dbg	line, "bug1374.c", 32
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1374.c", 33
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$89
+	bne     L0002
+	cmp     #$AB
+L0002:	jsr     booleq
+	jeq     L0003
+	ldx     #$00
+	lda     #$00
+	jmp     L0004
+L0003:	ldx     #$00
+	lda     #$01
+L0004:	jmp     L0001
+	.dbg	line, "bug1374.c", 34
+L0001:	jsr     incsp5
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test3 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test3: near
+
+	.dbg	func, "test3", "00", extern, "_test3"
+	.dbg	sym, "x", "00", auto, -2
+	.dbg	sym, "y", "00", auto, -3
+	.dbg	sym, "z", "00", auto, -5
+
+.segment	"CODE"
+
+	.dbg	line, "bug1374.c", 38
+	ldx     #$00
+	lda     #$89
+	jsr     pushax
+	.dbg	line, "bug1374.c", 39
+	lda     #$AB
+	jsr     pusha
+	.dbg	line, "bug1374.c", 40
+	ldy     #$02
+	jsr     ldaxysp
+	tax
+	lda     #$00
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosorax
+	jsr     pushax
+	.dbg	line, "bug1374.c", 41
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1374.c", 42
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$89
+	bne     L0002
+	cmp     #$AB
+L0002:	jsr     booleq
+	jeq     L0003
+	ldx     #$00
+	lda     #$00
+	jmp     L0004
+L0003:	ldx     #$00
+	lda     #$01
+L0004:	jmp     L0001
+	.dbg	line, "bug1374.c", 43
+L0001:	jsr     incsp5
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test3b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test3b: near
+
+	.dbg	func, "test3b", "00", extern, "_test3b"
+	.dbg	sym, "x", "00", auto, -2
+	.dbg	sym, "y", "00", auto, -3
+	.dbg	sym, "z", "00", auto, -5
+
+.segment	"CODE"
+
+	.dbg	line, "bug1374.c", 47
+	ldx     #$00
+	lda     #$89
+	jsr     pushax
+	.dbg	line, "bug1374.c", 48
+	lda     #$AB
+	jsr     pusha
+	.dbg	line, "bug1374.c", 49
+	ldy     #$02
+	jsr     ldaxysp
+	tax
+	lda     #$00
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosorax
+	jsr     pushax
+	.dbg	line, "bug1374.c", 50
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1374.c", 51
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$89
+	bne     L0002
+	cmp     #$AB
+L0002:	jsr     booleq
+	jeq     L0003
+	ldx     #$00
+	lda     #$00
+	jmp     L0004
+L0003:	ldx     #$00
+	lda     #$01
+L0004:	jmp     L0001
+	.dbg	line, "bug1374.c", 52
+L0001:	jsr     incsp5
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test4 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test4: near
+
+	.dbg	func, "test4", "00", extern, "_test4"
+	.dbg	sym, "x", "00", auto, -1
+	.dbg	sym, "y", "00", auto, -3
+	.dbg	sym, "z", "00", auto, -5
+
+.segment	"CODE"
+
+	.dbg	line, "bug1374.c", 56
+	lda     #$89
+	jsr     pusha
+	.dbg	line, "bug1374.c", 57
+	ldx     #$00
+	lda     #$AB
+	jsr     pushax
+	.dbg	line, "bug1374.c", 58
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	tax
+	lda     #$00
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosorax
+	jsr     pushax
+	.dbg	line, "bug1374.c", 59
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1374.c", 60
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$89
+	bne     L0002
+	cmp     #$AB
+L0002:	jsr     booleq
+	jeq     L0003
+	ldx     #$00
+	lda     #$00
+	jmp     L0004
+L0003:	ldx     #$00
+	lda     #$01
+L0004:	jmp     L0001
+	.dbg	line, "bug1374.c", 61
+L0001:	jsr     incsp5
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test4b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test4b: near
+
+	.dbg	func, "test4b", "00", extern, "_test4b"
+	.dbg	sym, "x", "00", auto, -1
+	.dbg	sym, "y", "00", auto, -3
+	.dbg	sym, "z", "00", auto, -5
+
+.segment	"CODE"
+
+	.dbg	line, "bug1374.c", 65
+	lda     #$89
+	jsr     pusha
+	.dbg	line, "bug1374.c", 66
+	ldx     #$00
+	lda     #$AB
+	jsr     pushax
+	.dbg	line, "bug1374.c", 67
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	tax
+	lda     #$00
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosorax
+	jsr     pushax
+	.dbg	line, "bug1374.c", 68
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1374.c", 69
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$89
+	bne     L0002
+	cmp     #$AB
+L0002:	jsr     booleq
+	jeq     L0003
+	ldx     #$00
+	lda     #$00
+	jmp     L0004
+L0003:	ldx     #$00
+	lda     #$01
+L0004:	jmp     L0001
+	.dbg	line, "bug1374.c", 70
+L0001:	jsr     incsp5
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "bug1374.c", 74
+	lda     _res
+	ldx     _res+1
+	jsr     pushax
+	jsr     _test1
+	jsr     tosorax
+	sta     _res
+	stx     _res+1
+	.dbg	line, "bug1374.c", 75
+	lda     _res
+	ldx     _res+1
+	jsr     pushax
+	jsr     _test2
+	jsr     tosorax
+	sta     _res
+	stx     _res+1
+	.dbg	line, "bug1374.c", 76
+	lda     _res
+	ldx     _res+1
+	jsr     pushax
+	jsr     _test3
+	jsr     tosorax
+	sta     _res
+	stx     _res+1
+	.dbg	line, "bug1374.c", 77
+	lda     _res
+	ldx     _res+1
+	jsr     pushax
+	jsr     _test4
+	jsr     tosorax
+	sta     _res
+	stx     _res+1
+	.dbg	line, "bug1374.c", 78
+	lda     _res
+	ldx     _res+1
+	jsr     pushax
+	jsr     _test1b
+	jsr     tosorax
+	sta     _res
+	stx     _res+1
+	.dbg	line, "bug1374.c", 79
+	lda     _res
+	ldx     _res+1
+	jsr     pushax
+	jsr     _test3b
+	jsr     tosorax
+	sta     _res
+	stx     _res+1
+	.dbg	line, "bug1374.c", 80
+	lda     _res
+	ldx     _res+1
+	jsr     pushax
+	jsr     _test4b
+	jsr     tosorax
+	sta     _res
+	stx     _res+1
+	.dbg	line, "bug1374.c", 81
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	lda     _res
+	ldx     _res+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug1374.c", 82
+	lda     _res
+	ldx     _res+1
+	jmp     L0001
+	.dbg	line, "bug1374.c", 83
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,172 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$6C,$72,$3A,$20,$25,$6C,$64,$20,$28,$2D,$34,$29,$0A,$00
+S0003:
+	.byte	$72,$31,$3A,$20,$25,$64,$20,$28,$2D,$33,$31,$29,$0A,$00
+S0004:
+	.byte	$72,$32,$3A,$20,$25,$64,$20,$28,$2D,$33,$31,$29,$0A,$00
+S0001:
+	.byte	$72,$3A,$20,$25,$64,$20,$28,$2D,$34,$29,$0A,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #$02
+	jsr     pusha
+	ldx     #$00
+	jsr     push0ax
+	dex
+	lda     #$FE
+	jsr     pushax
+	stx     sreg
+	stx     sreg+1
+	jsr     pusheax
+	ldy     #$0A
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmulax
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$09
+	jsr     ldeaxysp
+	jsr     tosumuleax
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$A1
+	jsr     pusheax
+	lda     #$03
+	jsr     pusha0
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosdiv0ax
+	jsr     pushax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosdiv0ax
+	jsr     pushax
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldy     #$0F
+	lda     (sp),y
+	cmp     #$FF
+	bne     L0009
+	dey
+	lda     (sp),y
+	cmp     #$FC
+	beq     L0002
+L0009:	ldx     #$00
+	lda     #$01
+	jmp     L0001
+L0002:	dey
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FC
+	jsr     tosneeax
+	beq     L0004
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+L0004:	ldy     #$03
+	lda     (sp),y
+	cmp     #$FF
+	bne     L000A
+	dey
+	lda     (sp),y
+	cmp     #$E1
+	beq     L0005
+L000A:	ldx     #$00
+	lda     #$01
+	jmp     L0001
+L0005:	dey
+	lda     (sp),y
+	cmp     #$FF
+	bne     L000B
+	dey
+	lda     (sp),y
+	cmp     #$E1
+	beq     L0007
+L000B:	ldx     #$00
+	lda     #$01
+	jmp     L0001
+L0007:	ldx     #$00
+	txa
+L0001:	ldy     #$1B
+	jmp     addysp
+
+.endproc
+
@@ -0,0 +1,214 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "bug170.c", 937, 1613073744
+	.dbg		file, "/root/repo/include/stdlib.h", 5999, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/stdint.h", 6196, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_main
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$6C,$72,$3A,$20,$25,$6C,$64,$20,$28,$2D,$34,$29,$0A,$00
+S0003:
+	.byte	$72,$31,$3A,$20,$25,$64,$20,$28,$2D,$33,$31,$29,$0A,$00
+S0004:
+	.byte	$72,$32,$3A,$20,$25,$64,$20,$28,$2D,$33,$31,$29,$0A,$00
+S0001:
+	.byte	$72,$3A,$20,$25,$64,$20,$28,$2D,$34,$29,$0A,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+	.dbg	sym, "c", "00", auto, -1
+	.dbg	sym, "u", "00", auto, -5
+	.dbg	sym, "a", "00", auto, -7
+	.dbg	sym, "l", "00", auto, -11
+	.dbg	sym, "r", "00", auto, -13
+	.dbg	sym, "lr", "00", auto, -17
+	.dbg	sym, "n", "00", auto, -21
+	.dbg	sym, "d", "00", auto, -23
+	.dbg	sym, "r1", "00", auto, -25
+	.dbg	sym, "r2", "00", auto, -27
+
+.segment	"CODE"
+
+	.dbg	line, "bug170.c", 9
+	lda     #$02
+	jsr     pusha
+	.dbg	line, "bug170.c", 10
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	jsr     pusheax
+	.dbg	line, "bug170.c", 11
+	ldx     #$FF
+	lda     #$FE
+	jsr     pushax
+	.dbg	line, "bug170.c", 12
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FE
+	jsr     pusheax
+	.dbg	line, "bug170.c", 15
+	ldy     #$0A
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosmulax
+	jsr     pushax
+	.dbg	line, "bug170.c", 17
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$09
+	jsr     ldeaxysp
+	jsr     tosumuleax
+	jsr     pusheax
+	.dbg	line, "bug170.c", 19
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$A1
+	jsr     pusheax
+	.dbg	line, "bug170.c", 20
+	ldx     #$00
+	lda     #$03
+	jsr     pushax
+	.dbg	line, "bug170.c", 21
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     axulong
+	jsr     tosdiveax
+	jsr     pushax
+	.dbg	line, "bug170.c", 23
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     axulong
+	jsr     tosdiveax
+	jsr     pushax
+	.dbg	line, "bug170.c", 25
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug170.c", 29
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "bug170.c", 31
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug170.c", 32
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug170.c", 34
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$FF
+	bne     L0003
+	cmp     #$FC
+L0003:	jsr     boolne
+	jeq     L0002
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+	.dbg	line, "bug170.c", 35
+L0002:	ldy     #$0D
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FC
+	jsr     tosneeax
+	jeq     L0004
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+	.dbg	line, "bug170.c", 36
+L0004:	ldy     #$03
+	jsr     ldaxysp
+	cpx     #$FF
+	bne     L0006
+	cmp     #$E1
+L0006:	jsr     boolne
+	jeq     L0005
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+	.dbg	line, "bug170.c", 37
+L0005:	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$FF
+	bne     L0008
+	cmp     #$E1
+L0008:	jsr     boolne
+	jeq     L0007
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+	.dbg	line, "bug170.c", 39
+L0007:	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "bug170.c", 40
+L0001:	ldy     #$1B
+	jsr     addysp
+	rts
+
+	.dbg	line
+.endproc
+
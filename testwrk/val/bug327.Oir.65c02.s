@@ -0,0 +1,98 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_res
+	.export		_main
+
+.segment	"DATA"
+
+_res:
+	.byte	$00
+
+.segment	"RODATA"
+
+_arr:
+	.byte	$00
+	.byte	$FF
+S0002:
+	.byte	$56,$61,$6C,$75,$65,$20,$25,$64,$2C,$20,$73,$68,$6F,$75,$6C,$64
+	.byte	$20,$62,$65,$20,$2D,$32,$35,$35,$0A,$00
+S0001	:=	S0002+0
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _arr+1
+	ldx     #$FF
+	eor     #$FF
+	clc
+	adc     #$01
+	bcc     L0006
+	inx
+L0006:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     _arr+1
+	ldx     #$FF
+	eor     #$FF
+	clc
+	adc     #$01
+	bcc     L0007
+	inx
+L0007:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     _arr+1
+	ldx     #$FF
+	eor     #$FF
+	clc
+	adc     #$01
+	bcc     L0008
+	inx
+L0008:	cpx     #$FF
+	bne     L000A
+	cmp     #$01
+	beq     L0002
+L000A:	inc     _res
+L0002:	lda     _arr+1
+	ldx     #$FF
+	eor     #$FF
+	clc
+	adc     #$01
+	bcc     L0009
+	inx
+L0009:	cpx     #$FF
+	bne     L000B
+	cmp     #$01
+	beq     L0004
+L000B:	inc     _res
+L0004:	ldx     #$00
+	lda     _res
+	rts
+
+.endproc
+
@@ -0,0 +1,144 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "bug327.c", 507, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/stdint.h", 6196, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_res
+	.export		_main
+
+.segment	"DATA"
+
+_res:
+	.byte	$00
+
+.segment	"RODATA"
+
+_arr:
+	.byte	$00
+	.byte	$FF
+S0002:
+	.byte	$56,$61,$6C,$75,$65,$20,$25,$64,$2C,$20,$73,$68,$6F,$75,$6C,$64
+	.byte	$20,$62,$65,$20,$2D,$32,$35,$35,$0A,$00
+S0001	:=	S0002+0
+
+; ---------------------------------------------------------------
+; int __near__ get16 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_get16: near
+
+	.dbg	func, "get16", "00", static, "_get16"
+
+.segment	"CODE"
+
+	.dbg	line, "bug327.c", 12
+	ldx     #$00
+	lda     _arr+1
+	jsr     negax
+	jmp     L0001
+	.dbg	line, "bug327.c", 13
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ get16_2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_get16_2: near
+
+	.dbg	func, "get16_2", "00", static, "_get16_2"
+
+.segment	"CODE"
+
+	.dbg	line, "bug327.c", 16
+	ldx     #$00
+	lda     _arr+1
+	jsr     negax
+	jmp     L0001
+	.dbg	line, "bug327.c", 17
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "bug327.c", 23
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	jsr     _get16
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug327.c", 24
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	jsr     _get16_2
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug327.c", 26
+	jsr     _get16
+	cpx     #$FF
+	bne     L0003
+	cmp     #$01
+L0003:	jsr     boolne
+	jeq     L0002
+	.dbg	line, "bug327.c", 27
+	ldx     #$00
+	lda     _res
+	inc     _res
+	.dbg	line, "bug327.c", 29
+L0002:	jsr     _get16_2
+	cpx     #$FF
+	bne     L0005
+	cmp     #$01
+L0005:	jsr     boolne
+	jeq     L0004
+	.dbg	line, "bug327.c", 30
+	ldx     #$00
+	lda     _res
+	inc     _res
+	.dbg	line, "bug327.c", 33
+L0004:	ldx     #$00
+	lda     _res
+	jmp     L0001
+	.dbg	line, "bug327.c", 34
+L0001:	rts
+
+	.dbg	line
+.endproc
+
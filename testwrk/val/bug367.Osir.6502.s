@@ -0,0 +1,148 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.import		_exit
+	.export		_main
+
+.segment	"RODATA"
+
+S0004:
+	.byte	$4D,$75,$6C,$74,$69,$70,$6C,$69,$63,$61,$74,$69,$6F,$6E,$20,$72
+	.byte	$65,$73,$75,$6C,$74,$73,$20,$64,$69,$66,$66,$65,$72,$20,$28,$73
+	.byte	$68,$6F,$75,$6C,$64,$20,$62,$65,$20,$37,$36,$38,$30,$29,$21,$00
+S0006:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$76,$61,$6C,$75,$65,$3A,$20
+	.byte	$25,$75,$2C,$20,$62,$75,$74,$20,$69,$73,$20,$25,$75,$21,$0A,$00
+S0003:
+	.byte	$46,$61,$69,$6C,$20,$61,$74,$20,$6C,$69,$6E,$65,$20,$25,$64,$3A
+	.byte	$0A,$00
+S0002:
+	.byte	$62,$75,$67,$33,$36,$37,$2E,$63,$00
+S0007:
+	.byte	$50,$61,$73,$73,$65,$64,$0A,$00
+S0001:
+	.byte	$25,$73,$3A,$20,$00
+S0005	:=	S0006+30
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #$C0
+	jsr     pusha0
+	ldy     #$01
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	and     #$F8
+	jsr     pushax
+	ldy     #$01
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     shlax4
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	ldx     tmp1
+	sta     ptr1
+	stx     ptr1+1
+	iny
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     shlax3
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	lda     #$28
+	jsr     tosumula0
+	jsr     pushax
+	ldy     #$01
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$02
+	cmp     (sp),y
+	bne     L0004
+	txa
+	iny
+	cmp     (sp),y
+	beq     L0002
+L0004:	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     #$0A
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0002:	jsr     incsp8
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
@@ -0,0 +1,132 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.import		_exit
+	.export		_test
+	.export		_dst
+	.export		_main
+
+.segment	"DATA"
+
+_dst:
+	.addr	_test
+
+.segment	"RODATA"
+
+S0004:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$74,$65,$72,$6E,$61,$72
+	.byte	$79,$20,$65,$78,$70,$72,$65,$73,$73,$69,$6F,$6E,$20,$65,$76,$61
+	.byte	$6C,$75,$61,$74,$69,$6F,$6E,$21,$00
+S0006:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$76,$61,$6C,$75,$65,$3A,$20
+	.byte	$25,$75,$2C,$20,$62,$75,$74,$20,$69,$73,$20,$25,$75,$21,$0A,$00
+S0003:
+	.byte	$46,$61,$69,$6C,$20,$61,$74,$20,$6C,$69,$6E,$65,$20,$25,$64,$3A
+	.byte	$0A,$00
+S0002:
+	.byte	$62,$75,$67,$38,$33,$30,$2E,$63,$00
+S0007:
+	.byte	$50,$61,$73,$73,$65,$64,$0A,$00
+S0001:
+	.byte	$25,$73,$3A,$20,$00
+S0005	:=	S0006+30
+
+.segment	"BSS"
+
+_test:
+	.res	1,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #$00
+	jsr     pusha
+	lda     _dst+1
+	sta     ptr1+1
+	lda     _dst
+	sta     ptr1
+	ldy     #$00
+	lda     (sp),y
+	bne     L0009
+	lda     #$2A
+	jmp     L0007
+L0009:	lda     (sp),y
+L0007:	sta     (ptr1),y
+	lda     _dst+1
+	sta     ptr1+1
+	lda     _dst
+	sta     ptr1
+	lda     (ptr1),y
+	cmp     #$2A
+	beq     L0004
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     #$0B
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	lda     #$2A
+	jsr     pusha0
+	lda     _dst+1
+	sta     ptr1+1
+	lda     _dst
+	sta     ptr1
+	lda     (ptr1,x)
+	jsr     pusha0
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0004:	jsr     incsp1
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
@@ -0,0 +1,12608 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "bug895.c", 5241, 1613073744
+	.dbg		file, "unittest.h", 4753, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/stdlib.h", 5999, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.dbg		sym, "exit", "00", extern, "_exit"
+	.import		_printf
+	.import		_exit
+	.export		_sca
+	.export		_scb
+	.export		_sia
+	.export		_sib
+	.export		_sla
+	.export		_slb
+	.export		_uca
+	.export		_ucb
+	.export		_uia
+	.export		_uib
+	.export		_ula
+	.export		_ulb
+	.export		_signed_char_1
+	.export		_signed_char_2
+	.export		_signed_char_3
+	.export		_signed_char_4
+	.export		_signed_char_5
+	.export		_signed_char_6
+	.export		_signed_char_7
+	.export		_signed_char_8
+	.export		_signed_char_9
+	.export		_signed_char_10
+	.export		_signed_char_11
+	.export		_signed_char_12
+	.export		_signed_char_13
+	.export		_signed_char_14
+	.export		_signed_char_15
+	.export		_signed_char_16
+	.export		_signed_char_17
+	.export		_signed_char_18
+	.export		_signed_char_19
+	.export		_signed_char_20
+	.export		_signed_char_test
+	.export		_unsigned_char_1
+	.export		_unsigned_char_2
+	.export		_unsigned_char_3
+	.export		_unsigned_char_4
+	.export		_unsigned_char_5
+	.export		_unsigned_char_6
+	.export		_unsigned_char_7
+	.export		_unsigned_char_8
+	.export		_unsigned_char_9
+	.export		_unsigned_char_10
+	.export		_unsigned_char_11
+	.export		_unsigned_char_12
+	.export		_unsigned_char_13
+	.export		_unsigned_char_14
+	.export		_unsigned_char_15
+	.export		_unsigned_char_16
+	.export		_unsigned_char_17
+	.export		_unsigned_char_18
+	.export		_unsigned_char_19
+	.export		_unsigned_char_20
+	.export		_unsigned_char_test
+	.export		_signed_int_1
+	.export		_signed_int_2
+	.export		_signed_int_3
+	.export		_signed_int_4
+	.export		_signed_int_5
+	.export		_signed_int_6
+	.export		_signed_int_7
+	.export		_signed_int_8
+	.export		_signed_int_9
+	.export		_signed_int_10
+	.export		_signed_int_11
+	.export		_signed_int_12
+	.export		_signed_int_13
+	.export		_signed_int_14
+	.export		_signed_int_15
+	.export		_signed_int_16
+	.export		_signed_int_17
+	.export		_signed_int_18
+	.export		_signed_int_19
+	.export		_signed_int_20
+	.export		_signed_int_test
+	.export		_unsigned_int_1
+	.export		_unsigned_int_2
+	.export		_unsigned_int_3
+	.export		_unsigned_int_4
+	.export		_unsigned_int_5
+	.export		_unsigned_int_6
+	.export		_unsigned_int_7
+	.export		_unsigned_int_8
+	.export		_unsigned_int_9
+	.export		_unsigned_int_10
+	.export		_unsigned_int_11
+	.export		_unsigned_int_12
+	.export		_unsigned_int_13
+	.export		_unsigned_int_14
+	.export		_unsigned_int_15
+	.export		_unsigned_int_16
+	.export		_unsigned_int_17
+	.export		_unsigned_int_18
+	.export		_unsigned_int_19
+	.export		_unsigned_int_20
+	.export		_unsigned_int_test
+	.export		_signed_long_1
+	.export		_signed_long_2
+	.export		_signed_long_3
+	.export		_signed_long_4
+	.export		_signed_long_5
+	.export		_signed_long_6
+	.export		_signed_long_7
+	.export		_signed_long_8
+	.export		_signed_long_9
+	.export		_signed_long_10
+	.export		_signed_long_11
+	.export		_signed_long_12
+	.export		_signed_long_13
+	.export		_signed_long_14
+	.export		_signed_long_15
+	.export		_signed_long_16
+	.export		_signed_long_17
+	.export		_signed_long_18
+	.export		_signed_long_19
+	.export		_signed_long_20
+	.export		_signed_long_test
+	.export		_unsigned_long_1
+	.export		_unsigned_long_2
+	.export		_unsigned_long_3
+	.export		_unsigned_long_4
+	.export		_unsigned_long_5
+	.export		_unsigned_long_6
+	.export		_unsigned_long_7
+	.export		_unsigned_long_8
+	.export		_unsigned_long_9
+	.export		_unsigned_long_10
+	.export		_unsigned_long_11
+	.export		_unsigned_long_12
+	.export		_unsigned_long_13
+	.export		_unsigned_long_14
+	.export		_unsigned_long_15
+	.export		_unsigned_long_16
+	.export		_unsigned_long_17
+	.export		_unsigned_long_18
+	.export		_unsigned_long_19
+	.export		_unsigned_long_20
+	.export		_unsigned_long_test
+	.export		_main
+
+.segment	"RODATA"
+
+S00BE:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$63,$68,$61,$72,$5F,$31,$38,$3A,$20,$68,$69
+	.byte	$67,$68,$20,$3D,$3D,$20,$68,$69,$67,$68,$2C,$20,$6E,$6F,$70,$29
+	.byte	$2E,$00
+S024E:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$6C,$6F,$6E,$67,$5F,$31,$38,$3A,$20,$68,$69
+	.byte	$67,$68,$20,$3D,$3D,$20,$68,$69,$67,$68,$2C,$20,$6E,$6F,$70,$29
+	.byte	$2E,$00
+S0256:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$6C,$6F,$6E,$67,$5F,$32,$30,$3A,$20,$68,$69
+	.byte	$67,$68,$20,$21,$3D,$20,$68,$69,$67,$68,$2C,$20,$6E,$6F,$70,$29
+	.byte	$2E,$00
+S00C6:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$63,$68,$61,$72,$5F,$32,$30,$3A,$20,$68,$69
+	.byte	$67,$68,$20,$21,$3D,$20,$68,$69,$67,$68,$2C,$20,$6E,$6F,$70,$29
+	.byte	$2E,$00
+S024A:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$6C,$6F,$6E,$67,$5F,$31,$37,$3A,$20,$6C,$6F
+	.byte	$77,$20,$3D,$3D,$20,$68,$69,$67,$68,$2C,$20,$6E,$6F,$70,$29,$2E
+	.byte	$00
+S0236:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$6C,$6F,$6E,$67,$5F,$31,$32,$3A,$20,$68,$69
+	.byte	$67,$68,$20,$3C,$3D,$20,$6C,$6F,$77,$2C,$20,$73,$65,$63,$29,$2E
+	.byte	$00
+S023E:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$6C,$6F,$6E,$67,$5F,$31,$34,$3A,$20,$6C,$6F
+	.byte	$77,$20,$3E,$3D,$20,$68,$69,$67,$68,$2C,$20,$73,$65,$63,$29,$2E
+	.byte	$00
+S00C2:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$63,$68,$61,$72,$5F,$31,$39,$3A,$20,$6C,$6F
+	.byte	$77,$20,$21,$3D,$20,$68,$69,$67,$68,$2C,$20,$6E,$6F,$70,$29,$2E
+	.byte	$00
+S0186:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$69,$6E,$74,$5F,$31,$38,$3A,$20,$68,$69,$67
+	.byte	$68,$20,$3D,$3D,$20,$68,$69,$67,$68,$2C,$20,$6E,$6F,$70,$29,$2E
+	.byte	$00
+S023A:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$6C,$6F,$6E,$67,$5F,$31,$33,$3A,$20,$6C,$6F
+	.byte	$77,$20,$3E,$3D,$20,$68,$69,$67,$68,$2C,$20,$63,$6C,$63,$29,$2E
+	.byte	$00
+S0232:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$6C,$6F,$6E,$67,$5F,$31,$31,$3A,$20,$68,$69
+	.byte	$67,$68,$20,$3C,$3D,$20,$6C,$6F,$77,$2C,$20,$63,$6C,$63,$29,$2E
+	.byte	$00
+S009E:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$63,$68,$61,$72,$5F,$31,$30,$3A,$20,$6C,$6F
+	.byte	$77,$20,$3C,$3D,$20,$68,$69,$67,$68,$2C,$20,$73,$65,$63,$29,$2E
+	.byte	$00
+S00BA:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$63,$68,$61,$72,$5F,$31,$37,$3A,$20,$6C,$6F
+	.byte	$77,$20,$3D,$3D,$20,$68,$69,$67,$68,$2C,$20,$6E,$6F,$70,$29,$2E
+	.byte	$00
+S00A2:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$63,$68,$61,$72,$5F,$31,$31,$3A,$20,$68,$69
+	.byte	$67,$68,$20,$3C,$3D,$20,$6C,$6F,$77,$2C,$20,$63,$6C,$63,$29,$2E
+	.byte	$00
+S0246:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$6C,$6F,$6E,$67,$5F,$31,$36,$3A,$20,$68,$69
+	.byte	$67,$68,$20,$3E,$3D,$20,$6C,$6F,$77,$2C,$20,$73,$65,$63,$29,$2E
+	.byte	$00
+S00B6:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$63,$68,$61,$72,$5F,$31,$36,$3A,$20,$68,$69
+	.byte	$67,$68,$20,$3E,$3D,$20,$6C,$6F,$77,$2C,$20,$73,$65,$63,$29,$2E
+	.byte	$00
+S00A6:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$63,$68,$61,$72,$5F,$31,$32,$3A,$20,$68,$69
+	.byte	$67,$68,$20,$3C,$3D,$20,$6C,$6F,$77,$2C,$20,$73,$65,$63,$29,$2E
+	.byte	$00
+S0252:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$6C,$6F,$6E,$67,$5F,$31,$39,$3A,$20,$6C,$6F
+	.byte	$77,$20,$21,$3D,$20,$68,$69,$67,$68,$2C,$20,$6E,$6F,$70,$29,$2E
+	.byte	$00
+S022E:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$6C,$6F,$6E,$67,$5F,$31,$30,$3A,$20,$6C,$6F
+	.byte	$77,$20,$3C,$3D,$20,$68,$69,$67,$68,$2C,$20,$73,$65,$63,$29,$2E
+	.byte	$00
+S0242:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$6C,$6F,$6E,$67,$5F,$31,$35,$3A,$20,$68,$69
+	.byte	$67,$68,$20,$3E,$3D,$20,$6C,$6F,$77,$2C,$20,$63,$6C,$63,$29,$2E
+	.byte	$00
+S00AA:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$63,$68,$61,$72,$5F,$31,$33,$3A,$20,$6C,$6F
+	.byte	$77,$20,$3E,$3D,$20,$68,$69,$67,$68,$2C,$20,$63,$6C,$63,$29,$2E
+	.byte	$00
+S00B2:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$63,$68,$61,$72,$5F,$31,$35,$3A,$20,$68,$69
+	.byte	$67,$68,$20,$3E,$3D,$20,$6C,$6F,$77,$2C,$20,$63,$6C,$63,$29,$2E
+	.byte	$00
+S00AE:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$63,$68,$61,$72,$5F,$31,$34,$3A,$20,$6C,$6F
+	.byte	$77,$20,$3E,$3D,$20,$68,$69,$67,$68,$2C,$20,$73,$65,$63,$29,$2E
+	.byte	$00
+S018E:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$69,$6E,$74,$5F,$32,$30,$3A,$20,$68,$69,$67
+	.byte	$68,$20,$21,$3D,$20,$68,$69,$67,$68,$2C,$20,$6E,$6F,$70,$29,$2E
+	.byte	$00
+S022A:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$6C,$6F,$6E,$67,$5F,$39,$3A,$20,$6C,$6F,$77
+	.byte	$20,$3C,$3D,$20,$68,$69,$67,$68,$2C,$20,$63,$6C,$63,$29,$2E,$00
+S005A:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$63,$68,$61,$72,$5F,$31,$38,$3A,$20,$68,$69,$67,$68
+	.byte	$20,$3D,$3D,$20,$68,$69,$67,$68,$2C,$20,$6E,$6F,$70,$29,$2E,$00
+S017A:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$69,$6E,$74,$5F,$31,$35,$3A,$20,$68,$69,$67
+	.byte	$68,$20,$3E,$3D,$20,$6C,$6F,$77,$2C,$20,$63,$6C,$63,$29,$2E,$00
+S0172:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$69,$6E,$74,$5F,$31,$33,$3A,$20,$6C,$6F,$77
+	.byte	$20,$3E,$3D,$20,$68,$69,$67,$68,$2C,$20,$63,$6C,$63,$29,$2E,$00
+S017E:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$69,$6E,$74,$5F,$31,$36,$3A,$20,$68,$69,$67
+	.byte	$68,$20,$3E,$3D,$20,$6C,$6F,$77,$2C,$20,$73,$65,$63,$29,$2E,$00
+S009A:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$63,$68,$61,$72,$5F,$39,$3A,$20,$6C,$6F,$77
+	.byte	$20,$3C,$3D,$20,$68,$69,$67,$68,$2C,$20,$63,$6C,$63,$29,$2E,$00
+S016E:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$69,$6E,$74,$5F,$31,$32,$3A,$20,$68,$69,$67
+	.byte	$68,$20,$3C,$3D,$20,$6C,$6F,$77,$2C,$20,$73,$65,$63,$29,$2E,$00
+S01EA:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$6C,$6F,$6E,$67,$5F,$31,$38,$3A,$20,$68,$69,$67,$68
+	.byte	$20,$3D,$3D,$20,$68,$69,$67,$68,$2C,$20,$6E,$6F,$70,$29,$2E,$00
+S0062:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$63,$68,$61,$72,$5F,$32,$30,$3A,$20,$68,$69,$67,$68
+	.byte	$20,$21,$3D,$20,$68,$69,$67,$68,$2C,$20,$6E,$6F,$70,$29,$2E,$00
+S01F2:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$6C,$6F,$6E,$67,$5F,$32,$30,$3A,$20,$68,$69,$67,$68
+	.byte	$20,$21,$3D,$20,$68,$69,$67,$68,$2C,$20,$6E,$6F,$70,$29,$2E,$00
+S016A:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$69,$6E,$74,$5F,$31,$31,$3A,$20,$68,$69,$67
+	.byte	$68,$20,$3C,$3D,$20,$6C,$6F,$77,$2C,$20,$63,$6C,$63,$29,$2E,$00
+S0182:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$69,$6E,$74,$5F,$31,$37,$3A,$20,$6C,$6F,$77
+	.byte	$20,$3D,$3D,$20,$68,$69,$67,$68,$2C,$20,$6E,$6F,$70,$29,$2E,$00
+S0176:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$69,$6E,$74,$5F,$31,$34,$3A,$20,$6C,$6F,$77
+	.byte	$20,$3E,$3D,$20,$68,$69,$67,$68,$2C,$20,$73,$65,$63,$29,$2E,$00
+S0166:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$69,$6E,$74,$5F,$31,$30,$3A,$20,$6C,$6F,$77
+	.byte	$20,$3C,$3D,$20,$68,$69,$67,$68,$2C,$20,$73,$65,$63,$29,$2E,$00
+S018A:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$69,$6E,$74,$5F,$31,$39,$3A,$20,$6C,$6F,$77
+	.byte	$20,$21,$3D,$20,$68,$69,$67,$68,$2C,$20,$6E,$6F,$70,$29,$2E,$00
+S003A:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$63,$68,$61,$72,$5F,$31,$30,$3A,$20,$6C,$6F,$77,$20
+	.byte	$3C,$3D,$20,$68,$69,$67,$68,$2C,$20,$73,$65,$63,$29,$2E,$00
+S003E:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$63,$68,$61,$72,$5F,$31,$31,$3A,$20,$68,$69,$67,$68
+	.byte	$20,$3C,$3D,$20,$6C,$6F,$77,$2C,$20,$63,$6C,$63,$29,$2E,$00
+S0162:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$69,$6E,$74,$5F,$39,$3A,$20,$6C,$6F,$77,$20
+	.byte	$3C,$3D,$20,$68,$69,$67,$68,$2C,$20,$63,$6C,$63,$29,$2E,$00
+S021E:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$6C,$6F,$6E,$67,$5F,$36,$3A,$20,$6C,$6F,$77
+	.byte	$20,$3E,$20,$68,$69,$67,$68,$2C,$20,$73,$65,$63,$29,$2E,$00
+S01E6:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$6C,$6F,$6E,$67,$5F,$31,$37,$3A,$20,$6C,$6F,$77,$20
+	.byte	$3D,$3D,$20,$68,$69,$67,$68,$2C,$20,$6E,$6F,$70,$29,$2E,$00
+S0042:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$63,$68,$61,$72,$5F,$31,$32,$3A,$20,$68,$69,$67,$68
+	.byte	$20,$3C,$3D,$20,$6C,$6F,$77,$2C,$20,$73,$65,$63,$29,$2E,$00
+S01D2:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$6C,$6F,$6E,$67,$5F,$31,$32,$3A,$20,$68,$69,$67,$68
+	.byte	$20,$3C,$3D,$20,$6C,$6F,$77,$2C,$20,$73,$65,$63,$29,$2E,$00
+S0226:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$6C,$6F,$6E,$67,$5F,$38,$3A,$20,$68,$69,$67
+	.byte	$68,$20,$3E,$20,$6C,$6F,$77,$2C,$20,$73,$65,$63,$29,$2E,$00
+S0086:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$63,$68,$61,$72,$5F,$34,$3A,$20,$68,$69,$67
+	.byte	$68,$20,$3C,$20,$6C,$6F,$77,$2C,$20,$73,$65,$63,$29,$2E,$00
+S0046:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$63,$68,$61,$72,$5F,$31,$33,$3A,$20,$6C,$6F,$77,$20
+	.byte	$3E,$3D,$20,$68,$69,$67,$68,$2C,$20,$63,$6C,$63,$29,$2E,$00
+S008A:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$63,$68,$61,$72,$5F,$35,$3A,$20,$6C,$6F,$77
+	.byte	$20,$3E,$20,$68,$69,$67,$68,$2C,$20,$63,$6C,$63,$29,$2E,$00
+S021A:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$6C,$6F,$6E,$67,$5F,$35,$3A,$20,$6C,$6F,$77
+	.byte	$20,$3E,$20,$68,$69,$67,$68,$2C,$20,$63,$6C,$63,$29,$2E,$00
+S012A:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$69,$6E,$74,$5F,$32,$30,$3A,$20,$68,$69,$67,$68,$20
+	.byte	$21,$3D,$20,$68,$69,$67,$68,$2C,$20,$6E,$6F,$70,$29,$2E,$00
+S004A:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$63,$68,$61,$72,$5F,$31,$34,$3A,$20,$6C,$6F,$77,$20
+	.byte	$3E,$3D,$20,$68,$69,$67,$68,$2C,$20,$73,$65,$63,$29,$2E,$00
+S020A:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$6C,$6F,$6E,$67,$5F,$31,$3A,$20,$6C,$6F,$77
+	.byte	$20,$3C,$20,$68,$69,$67,$68,$2C,$20,$63,$6C,$63,$29,$2E,$00
+S0082:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$63,$68,$61,$72,$5F,$33,$3A,$20,$68,$69,$67
+	.byte	$68,$20,$3C,$20,$6C,$6F,$77,$2C,$20,$63,$6C,$63,$29,$2E,$00
+S0216:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$6C,$6F,$6E,$67,$5F,$34,$3A,$20,$68,$69,$67
+	.byte	$68,$20,$3C,$20,$6C,$6F,$77,$2C,$20,$73,$65,$63,$29,$2E,$00
+S004E:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$63,$68,$61,$72,$5F,$31,$35,$3A,$20,$68,$69,$67,$68
+	.byte	$20,$3E,$3D,$20,$6C,$6F,$77,$2C,$20,$63,$6C,$63,$29,$2E,$00
+S01D6:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$6C,$6F,$6E,$67,$5F,$31,$33,$3A,$20,$6C,$6F,$77,$20
+	.byte	$3E,$3D,$20,$68,$69,$67,$68,$2C,$20,$63,$6C,$63,$29,$2E,$00
+S008E:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$63,$68,$61,$72,$5F,$36,$3A,$20,$6C,$6F,$77
+	.byte	$20,$3E,$20,$68,$69,$67,$68,$2C,$20,$73,$65,$63,$29,$2E,$00
+S01EE:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$6C,$6F,$6E,$67,$5F,$31,$39,$3A,$20,$6C,$6F,$77,$20
+	.byte	$21,$3D,$20,$68,$69,$67,$68,$2C,$20,$6E,$6F,$70,$29,$2E,$00
+S0052:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$63,$68,$61,$72,$5F,$31,$36,$3A,$20,$68,$69,$67,$68
+	.byte	$20,$3E,$3D,$20,$6C,$6F,$77,$2C,$20,$73,$65,$63,$29,$2E,$00
+S0092:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$63,$68,$61,$72,$5F,$37,$3A,$20,$68,$69,$67
+	.byte	$68,$20,$3E,$20,$6C,$6F,$77,$2C,$20,$63,$6C,$63,$29,$2E,$00
+S01E2:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$6C,$6F,$6E,$67,$5F,$31,$36,$3A,$20,$68,$69,$67,$68
+	.byte	$20,$3E,$3D,$20,$6C,$6F,$77,$2C,$20,$73,$65,$63,$29,$2E,$00
+S007E:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$63,$68,$61,$72,$5F,$32,$3A,$20,$6C,$6F,$77
+	.byte	$20,$3C,$20,$68,$69,$67,$68,$2C,$20,$73,$65,$63,$29,$2E,$00
+S0056:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$63,$68,$61,$72,$5F,$31,$37,$3A,$20,$6C,$6F,$77,$20
+	.byte	$3D,$3D,$20,$68,$69,$67,$68,$2C,$20,$6E,$6F,$70,$29,$2E,$00
+S01CA:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$6C,$6F,$6E,$67,$5F,$31,$30,$3A,$20,$6C,$6F,$77,$20
+	.byte	$3C,$3D,$20,$68,$69,$67,$68,$2C,$20,$73,$65,$63,$29,$2E,$00
+S0212:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$6C,$6F,$6E,$67,$5F,$33,$3A,$20,$68,$69,$67
+	.byte	$68,$20,$3C,$20,$6C,$6F,$77,$2C,$20,$63,$6C,$63,$29,$2E,$00
+S01DE:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$6C,$6F,$6E,$67,$5F,$31,$35,$3A,$20,$68,$69,$67,$68
+	.byte	$20,$3E,$3D,$20,$6C,$6F,$77,$2C,$20,$63,$6C,$63,$29,$2E,$00
+S01DA:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$6C,$6F,$6E,$67,$5F,$31,$34,$3A,$20,$6C,$6F,$77,$20
+	.byte	$3E,$3D,$20,$68,$69,$67,$68,$2C,$20,$73,$65,$63,$29,$2E,$00
+S007A:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$63,$68,$61,$72,$5F,$31,$3A,$20,$6C,$6F,$77
+	.byte	$20,$3C,$20,$68,$69,$67,$68,$2C,$20,$63,$6C,$63,$29,$2E,$00
+S0122:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$69,$6E,$74,$5F,$31,$38,$3A,$20,$68,$69,$67,$68,$20
+	.byte	$3D,$3D,$20,$68,$69,$67,$68,$2C,$20,$6E,$6F,$70,$29,$2E,$00
+S0096:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$63,$68,$61,$72,$5F,$38,$3A,$20,$68,$69,$67
+	.byte	$68,$20,$3E,$20,$6C,$6F,$77,$2C,$20,$73,$65,$63,$29,$2E,$00
+S005E:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$63,$68,$61,$72,$5F,$31,$39,$3A,$20,$6C,$6F,$77,$20
+	.byte	$21,$3D,$20,$68,$69,$67,$68,$2C,$20,$6E,$6F,$70,$29,$2E,$00
+S01CE:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$6C,$6F,$6E,$67,$5F,$31,$31,$3A,$20,$68,$69,$67,$68
+	.byte	$20,$3C,$3D,$20,$6C,$6F,$77,$2C,$20,$63,$6C,$63,$29,$2E,$00
+S020E:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$6C,$6F,$6E,$67,$5F,$32,$3A,$20,$6C,$6F,$77
+	.byte	$20,$3C,$20,$68,$69,$67,$68,$2C,$20,$73,$65,$63,$29,$2E,$00
+S0222:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$6C,$6F,$6E,$67,$5F,$37,$3A,$20,$68,$69,$67
+	.byte	$68,$20,$3E,$20,$6C,$6F,$77,$2C,$20,$63,$6C,$63,$29,$2E,$00
+S011E:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$69,$6E,$74,$5F,$31,$37,$3A,$20,$6C,$6F,$77,$20,$3D
+	.byte	$3D,$20,$68,$69,$67,$68,$2C,$20,$6E,$6F,$70,$29,$2E,$00
+S0146:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$69,$6E,$74,$5F,$32,$3A,$20,$6C,$6F,$77,$20
+	.byte	$3C,$20,$68,$69,$67,$68,$2C,$20,$73,$65,$63,$29,$2E,$00
+S011A:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$69,$6E,$74,$5F,$31,$36,$3A,$20,$68,$69,$67,$68,$20
+	.byte	$3E,$3D,$20,$6C,$6F,$77,$2C,$20,$73,$65,$63,$29,$2E,$00
+S014A:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$69,$6E,$74,$5F,$33,$3A,$20,$68,$69,$67,$68
+	.byte	$20,$3C,$20,$6C,$6F,$77,$2C,$20,$63,$6C,$63,$29,$2E,$00
+S0116:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$69,$6E,$74,$5F,$31,$35,$3A,$20,$68,$69,$67,$68,$20
+	.byte	$3E,$3D,$20,$6C,$6F,$77,$2C,$20,$63,$6C,$63,$29,$2E,$00
+S014E:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$69,$6E,$74,$5F,$34,$3A,$20,$68,$69,$67,$68
+	.byte	$20,$3C,$20,$6C,$6F,$77,$2C,$20,$73,$65,$63,$29,$2E,$00
+S0112:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$69,$6E,$74,$5F,$31,$34,$3A,$20,$6C,$6F,$77,$20,$3E
+	.byte	$3D,$20,$68,$69,$67,$68,$2C,$20,$73,$65,$63,$29,$2E,$00
+S010E:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$69,$6E,$74,$5F,$31,$33,$3A,$20,$6C,$6F,$77,$20,$3E
+	.byte	$3D,$20,$68,$69,$67,$68,$2C,$20,$63,$6C,$63,$29,$2E,$00
+S010A:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$69,$6E,$74,$5F,$31,$32,$3A,$20,$68,$69,$67,$68,$20
+	.byte	$3C,$3D,$20,$6C,$6F,$77,$2C,$20,$73,$65,$63,$29,$2E,$00
+S0152:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$69,$6E,$74,$5F,$35,$3A,$20,$6C,$6F,$77,$20
+	.byte	$3E,$20,$68,$69,$67,$68,$2C,$20,$63,$6C,$63,$29,$2E,$00
+S0126:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$69,$6E,$74,$5F,$31,$39,$3A,$20,$6C,$6F,$77,$20,$21
+	.byte	$3D,$20,$68,$69,$67,$68,$2C,$20,$6E,$6F,$70,$29,$2E,$00
+S0106:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$69,$6E,$74,$5F,$31,$31,$3A,$20,$68,$69,$67,$68,$20
+	.byte	$3C,$3D,$20,$6C,$6F,$77,$2C,$20,$63,$6C,$63,$29,$2E,$00
+S0102:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$69,$6E,$74,$5F,$31,$30,$3A,$20,$6C,$6F,$77,$20,$3C
+	.byte	$3D,$20,$68,$69,$67,$68,$2C,$20,$73,$65,$63,$29,$2E,$00
+S0156:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$69,$6E,$74,$5F,$36,$3A,$20,$6C,$6F,$77,$20
+	.byte	$3E,$20,$68,$69,$67,$68,$2C,$20,$73,$65,$63,$29,$2E,$00
+S015A:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$69,$6E,$74,$5F,$37,$3A,$20,$68,$69,$67,$68
+	.byte	$20,$3E,$20,$6C,$6F,$77,$2C,$20,$63,$6C,$63,$29,$2E,$00
+S015E:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$69,$6E,$74,$5F,$38,$3A,$20,$68,$69,$67,$68
+	.byte	$20,$3E,$20,$6C,$6F,$77,$2C,$20,$73,$65,$63,$29,$2E,$00
+S0036:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$63,$68,$61,$72,$5F,$39,$3A,$20,$6C,$6F,$77,$20,$3C
+	.byte	$3D,$20,$68,$69,$67,$68,$2C,$20,$63,$6C,$63,$29,$2E,$00
+S01C6:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$6C,$6F,$6E,$67,$5F,$39,$3A,$20,$6C,$6F,$77,$20,$3C
+	.byte	$3D,$20,$68,$69,$67,$68,$2C,$20,$63,$6C,$63,$29,$2E,$00
+S0142:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$75,$6E,$73,$69
+	.byte	$67,$6E,$65,$64,$5F,$69,$6E,$74,$5F,$31,$3A,$20,$6C,$6F,$77,$20
+	.byte	$3C,$20,$68,$69,$67,$68,$2C,$20,$63,$6C,$63,$29,$2E,$00
+S001A:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$63,$68,$61,$72,$5F,$32,$3A,$20,$6C,$6F,$77,$20,$3C
+	.byte	$20,$68,$69,$67,$68,$2C,$20,$73,$65,$63,$29,$2E,$00
+S001E:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$63,$68,$61,$72,$5F,$33,$3A,$20,$68,$69,$67,$68,$20
+	.byte	$3C,$20,$6C,$6F,$77,$2C,$20,$63,$6C,$63,$29,$2E,$00
+S0022:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$63,$68,$61,$72,$5F,$34,$3A,$20,$68,$69,$67,$68,$20
+	.byte	$3C,$20,$6C,$6F,$77,$2C,$20,$73,$65,$63,$29,$2E,$00
+S0026:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$63,$68,$61,$72,$5F,$35,$3A,$20,$6C,$6F,$77,$20,$3E
+	.byte	$20,$68,$69,$67,$68,$2C,$20,$63,$6C,$63,$29,$2E,$00
+S002A:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$63,$68,$61,$72,$5F,$36,$3A,$20,$6C,$6F,$77,$20,$3E
+	.byte	$20,$68,$69,$67,$68,$2C,$20,$73,$65,$63,$29,$2E,$00
+S01C2:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$6C,$6F,$6E,$67,$5F,$38,$3A,$20,$68,$69,$67,$68,$20
+	.byte	$3E,$20,$6C,$6F,$77,$2C,$20,$73,$65,$63,$29,$2E,$00
+S002E:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$63,$68,$61,$72,$5F,$37,$3A,$20,$68,$69,$67,$68,$20
+	.byte	$3E,$20,$6C,$6F,$77,$2C,$20,$63,$6C,$63,$29,$2E,$00
+S00FE:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$69,$6E,$74,$5F,$39,$3A,$20,$6C,$6F,$77,$20,$3C,$3D
+	.byte	$20,$68,$69,$67,$68,$2C,$20,$63,$6C,$63,$29,$2E,$00
+S01BE:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$6C,$6F,$6E,$67,$5F,$37,$3A,$20,$68,$69,$67,$68,$20
+	.byte	$3E,$20,$6C,$6F,$77,$2C,$20,$63,$6C,$63,$29,$2E,$00
+S0032:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$63,$68,$61,$72,$5F,$38,$3A,$20,$68,$69,$67,$68,$20
+	.byte	$3E,$20,$6C,$6F,$77,$2C,$20,$73,$65,$63,$29,$2E,$00
+S01BA:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$6C,$6F,$6E,$67,$5F,$36,$3A,$20,$6C,$6F,$77,$20,$3E
+	.byte	$20,$68,$69,$67,$68,$2C,$20,$73,$65,$63,$29,$2E,$00
+S01B6:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$6C,$6F,$6E,$67,$5F,$35,$3A,$20,$6C,$6F,$77,$20,$3E
+	.byte	$20,$68,$69,$67,$68,$2C,$20,$63,$6C,$63,$29,$2E,$00
+S01B2:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$6C,$6F,$6E,$67,$5F,$34,$3A,$20,$68,$69,$67,$68,$20
+	.byte	$3C,$20,$6C,$6F,$77,$2C,$20,$73,$65,$63,$29,$2E,$00
+S01AE:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$6C,$6F,$6E,$67,$5F,$33,$3A,$20,$68,$69,$67,$68,$20
+	.byte	$3C,$20,$6C,$6F,$77,$2C,$20,$63,$6C,$63,$29,$2E,$00
+S01AA:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$6C,$6F,$6E,$67,$5F,$32,$3A,$20,$6C,$6F,$77,$20,$3C
+	.byte	$20,$68,$69,$67,$68,$2C,$20,$73,$65,$63,$29,$2E,$00
+S01A6:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$6C,$6F,$6E,$67,$5F,$31,$3A,$20,$6C,$6F,$77,$20,$3C
+	.byte	$20,$68,$69,$67,$68,$2C,$20,$63,$6C,$63,$29,$2E,$00
+S0016:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$63,$68,$61,$72,$5F,$31,$3A,$20,$6C,$6F,$77,$20,$3C
+	.byte	$20,$68,$69,$67,$68,$2C,$20,$63,$6C,$63,$29,$2E,$00
+S00F6:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$69,$6E,$74,$5F,$37,$3A,$20,$68,$69,$67,$68,$20,$3E
+	.byte	$20,$6C,$6F,$77,$2C,$20,$63,$6C,$63,$29,$2E,$00
+S00F2:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$69,$6E,$74,$5F,$36,$3A,$20,$6C,$6F,$77,$20,$3E,$20
+	.byte	$68,$69,$67,$68,$2C,$20,$73,$65,$63,$29,$2E,$00
+S00EE:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$69,$6E,$74,$5F,$35,$3A,$20,$6C,$6F,$77,$20,$3E,$20
+	.byte	$68,$69,$67,$68,$2C,$20,$63,$6C,$63,$29,$2E,$00
+S00EA:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$69,$6E,$74,$5F,$34,$3A,$20,$68,$69,$67,$68,$20,$3C
+	.byte	$20,$6C,$6F,$77,$2C,$20,$73,$65,$63,$29,$2E,$00
+S00E6:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$69,$6E,$74,$5F,$33,$3A,$20,$68,$69,$67,$68,$20,$3C
+	.byte	$20,$6C,$6F,$77,$2C,$20,$63,$6C,$63,$29,$2E,$00
+S00E2:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$69,$6E,$74,$5F,$32,$3A,$20,$6C,$6F,$77,$20,$3C,$20
+	.byte	$68,$69,$67,$68,$2C,$20,$73,$65,$63,$29,$2E,$00
+S00DE:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$69,$6E,$74,$5F,$31,$3A,$20,$6C,$6F,$77,$20,$3C,$20
+	.byte	$68,$69,$67,$68,$2C,$20,$63,$6C,$63,$29,$2E,$00
+S00FA:
+	.byte	$49,$6E,$63,$6F,$72,$72,$65,$63,$74,$20,$6F,$70,$74,$69,$6D,$69
+	.byte	$7A,$61,$74,$69,$6F,$6E,$20,$6F,$66,$20,$63,$6F,$6E,$73,$74,$20
+	.byte	$63,$6F,$6D,$70,$61,$72,$69,$73,$6F,$6E,$20,$28,$73,$69,$67,$6E
+	.byte	$65,$64,$5F,$69,$6E,$74,$5F,$38,$3A,$20,$68,$69,$67,$68,$20,$3E
+	.byte	$20,$6C,$6F,$77,$2C,$20,$73,$65,$63,$29,$2E,$00
+S005C:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$76,$61,$6C,$75,$65,$3A,$20
+	.byte	$25,$64,$2C,$20,$62,$75,$74,$20,$69,$73,$20,$25,$64,$21,$0A,$00
+S0230:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$76,$61,$6C,$75,$65,$3A,$20
+	.byte	$25,$75,$2C,$20,$62,$75,$74,$20,$69,$73,$20,$25,$75,$21,$0A,$00
+S00A4	:=	S0230+0
+S0234	:=	S0230+0
+S01D8	:=	S005C+0
+S0058	:=	S005C+0
+S00A8	:=	S0230+0
+S0178	:=	S0230+0
+S01AC	:=	S005C+0
+S0054	:=	S005C+0
+S00AC	:=	S0230+0
+S0244	:=	S0230+0
+S0064	:=	S005C+0
+S022C	:=	S0230+0
+S00B0	:=	S0230+0
+S0174	:=	S0230+0
+S0050	:=	S005C+0
+S01B0	:=	S005C+0
+S00B4	:=	S0230+0
+S01E4	:=	S005C+0
+S004C	:=	S005C+0
+S0190	:=	S0230+0
+S00B8	:=	S0230+0
+S0170	:=	S0230+0
+S0048	:=	S005C+0
+S0228	:=	S0230+0
+S00BC	:=	S0230+0
+S0248	:=	S0230+0
+S01B4	:=	S005C+0
+S0044	:=	S005C+0
+S00C0	:=	S0230+0
+S016C	:=	S0230+0
+S0094	:=	S0230+0
+S01D4	:=	S005C+0
+S00C4	:=	S0230+0
+S0040	:=	S005C+0
+S01B8	:=	S005C+0
+S0224	:=	S0230+0
+S00C8	:=	S0230+0
+S0168	:=	S0230+0
+S00A0	:=	S0230+0
+S003C	:=	S005C+0
+S00E0	:=	S005C+0
+S01E8	:=	S005C+0
+S01A8	:=	S005C+0
+S024C	:=	S0230+0
+S00E4	:=	S005C+0
+S0164	:=	S0230+0
+S0240	:=	S0230+0
+S0220	:=	S0230+0
+S00E8	:=	S005C+0
+S007C	:=	S0230+0
+S01E0	:=	S005C+0
+S0038	:=	S005C+0
+S00EC	:=	S005C+0
+S0160	:=	S0230+0
+S009C	:=	S0230+0
+S01BC	:=	S005C+0
+S00F0	:=	S005C+0
+S0034	:=	S005C+0
+S0060	:=	S005C+0
+S021C	:=	S0230+0
+S00F4	:=	S005C+0
+S015C	:=	S0230+0
+S0098	:=	S0230+0
+S023C	:=	S0230+0
+S00F8	:=	S005C+0
+S01EC	:=	S005C+0
+S017C	:=	S0230+0
+S0184	:=	S0230+0
+S00FC	:=	S005C+0
+S0158	:=	S0230+0
+S0090	:=	S0230+0
+S0218	:=	S0230+0
+S0100	:=	S005C+0
+S0030	:=	S005C+0
+S0250	:=	S0230+0
+S0080	:=	S0230+0
+S0104	:=	S005C+0
+S0154	:=	S0230+0
+S01C0	:=	S005C+0
+S002C	:=	S005C+0
+S0108	:=	S005C+0
+S018C	:=	S0230+0
+S0084	:=	S0230+0
+S0214	:=	S0230+0
+S010C	:=	S005C+0
+S0150	:=	S0230+0
+S01D0	:=	S005C+0
+S0028	:=	S005C+0
+S0110	:=	S005C+0
+S01F0	:=	S005C+0
+S008C	:=	S0230+0
+S01C4	:=	S005C+0
+S0114	:=	S005C+0
+S014C	:=	S0230+0
+S0024	:=	S005C+0
+S0210	:=	S0230+0
+S0118	:=	S005C+0
+S0254	:=	S0230+0
+S0238	:=	S0230+0
+S0020	:=	S005C+0
+S011C	:=	S005C+0
+S0148	:=	S0230+0
+S01DC	:=	S005C+0
+S01C8	:=	S005C+0
+S0120	:=	S005C+0
+S001C	:=	S005C+0
+S0188	:=	S0230+0
+S020C	:=	S0230+0
+S0124	:=	S005C+0
+S0144	:=	S0230+0
+S0018	:=	S005C+0
+S0258	:=	S0230+0
+S0128	:=	S005C+0
+S01F4	:=	S005C+0
+S0180	:=	S0230+0
+S0088	:=	S0230+0
+S012C	:=	S005C+0
+S01CC	:=	S005C+0
+S0209:
+	.byte	$46,$61,$69,$6C,$20,$61,$74,$20,$6C,$69,$6E,$65,$20,$25,$64,$3A
+	.byte	$0A,$00
+S0129	:=	S0209+0
+S0125	:=	S0209+0
+S0145	:=	S0209+0
+S0121	:=	S0209+0
+S020D	:=	S0209+0
+S011D	:=	S0209+0
+S0149	:=	S0209+0
+S0119	:=	S0209+0
+S01F1	:=	S0209+0
+S0115	:=	S0209+0
+S014D	:=	S0209+0
+S0211	:=	S0209+0
+S0111	:=	S0209+0
+S010D	:=	S0209+0
+S0151	:=	S0209+0
+S0109	:=	S0209+0
+S0215	:=	S0209+0
+S0105	:=	S0209+0
+S0155	:=	S0209+0
+S0101	:=	S0209+0
+S01ED	:=	S0209+0
+S00FD	:=	S0209+0
+S0159	:=	S0209+0
+S0219	:=	S0209+0
+S00F9	:=	S0209+0
+S00F5	:=	S0209+0
+S015D	:=	S0209+0
+S00F1	:=	S0209+0
+S021D	:=	S0209+0
+S00ED	:=	S0209+0
+S0161	:=	S0209+0
+S00E9	:=	S0209+0
+S01E9	:=	S0209+0
+S00E5	:=	S0209+0
+S0165	:=	S0209+0
+S0221	:=	S0209+0
+S00E1	:=	S0209+0
+S00DD	:=	S0209+0
+S0169	:=	S0209+0
+S00C5	:=	S0209+0
+S0225	:=	S0209+0
+S00C1	:=	S0209+0
+S016D	:=	S0209+0
+S00BD	:=	S0209+0
+S01E5	:=	S0209+0
+S00B9	:=	S0209+0
+S0171	:=	S0209+0
+S0229	:=	S0209+0
+S00B5	:=	S0209+0
+S00B1	:=	S0209+0
+S0175	:=	S0209+0
+S00AD	:=	S0209+0
+S022D	:=	S0209+0
+S00A9	:=	S0209+0
+S0179	:=	S0209+0
+S00A5	:=	S0209+0
+S01E1	:=	S0209+0
+S00A1	:=	S0209+0
+S017D	:=	S0209+0
+S0231	:=	S0209+0
+S009D	:=	S0209+0
+S0099	:=	S0209+0
+S0181	:=	S0209+0
+S0095	:=	S0209+0
+S0235	:=	S0209+0
+S0091	:=	S0209+0
+S0185	:=	S0209+0
+S008D	:=	S0209+0
+S01DD	:=	S0209+0
+S0089	:=	S0209+0
+S0189	:=	S0209+0
+S0239	:=	S0209+0
+S0085	:=	S0209+0
+S0081	:=	S0209+0
+S018D	:=	S0209+0
+S007D	:=	S0209+0
+S023D	:=	S0209+0
+S0079	:=	S0209+0
+S01A5	:=	S0209+0
+S0061	:=	S0209+0
+S01D9	:=	S0209+0
+S005D	:=	S0209+0
+S01A9	:=	S0209+0
+S0241	:=	S0209+0
+S0059	:=	S0209+0
+S0055	:=	S0209+0
+S01AD	:=	S0209+0
+S0051	:=	S0209+0
+S0245	:=	S0209+0
+S004D	:=	S0209+0
+S01B1	:=	S0209+0
+S0049	:=	S0209+0
+S01D5	:=	S0209+0
+S0045	:=	S0209+0
+S01B5	:=	S0209+0
+S0249	:=	S0209+0
+S0041	:=	S0209+0
+S003D	:=	S0209+0
+S01B9	:=	S0209+0
+S0039	:=	S0209+0
+S024D	:=	S0209+0
+S0035	:=	S0209+0
+S01BD	:=	S0209+0
+S0031	:=	S0209+0
+S01D1	:=	S0209+0
+S002D	:=	S0209+0
+S01C1	:=	S0209+0
+S0251	:=	S0209+0
+S0029	:=	S0209+0
+S0025	:=	S0209+0
+S01C5	:=	S0209+0
+S0021	:=	S0209+0
+S0255	:=	S0209+0
+S001D	:=	S0209+0
+S01C9	:=	S0209+0
+S0019	:=	S0209+0
+S01CD	:=	S0209+0
+S0141	:=	S0209+0
+S0015	:=	S0209+0
+S025A:
+	.byte	$62,$75,$67,$38,$39,$35,$2E,$63,$00
+S025B:
+	.byte	$50,$61,$73,$73,$65,$64,$0A,$00
+S0259:
+	.byte	$25,$73,$3A,$20,$00
+S01BF	:=	S005C+30
+S01BB	:=	S005C+30
+S01D3	:=	S005C+30
+S01B7	:=	S005C+30
+S01B3	:=	S005C+30
+S01AF	:=	S005C+30
+S01D7	:=	S005C+30
+S01AB	:=	S005C+30
+S01A7	:=	S005C+30
+S018F	:=	S005C+30
+S01DB	:=	S005C+30
+S018B	:=	S005C+30
+S0187	:=	S005C+30
+S0183	:=	S005C+30
+S01DF	:=	S005C+30
+S017F	:=	S005C+30
+S017B	:=	S005C+30
+S0177	:=	S005C+30
+S01E3	:=	S005C+30
+S0173	:=	S005C+30
+S016F	:=	S005C+30
+S016B	:=	S005C+30
+S01E7	:=	S005C+30
+S0167	:=	S005C+30
+S0163	:=	S005C+30
+S015F	:=	S005C+30
+S01EB	:=	S005C+30
+S015B	:=	S005C+30
+S0157	:=	S005C+30
+S0153	:=	S005C+30
+S01EF	:=	S005C+30
+S014F	:=	S005C+30
+S014B	:=	S005C+30
+S0147	:=	S005C+30
+S01F3	:=	S005C+30
+S0143	:=	S005C+30
+S012B	:=	S005C+30
+S0127	:=	S005C+30
+S020B	:=	S005C+30
+S0123	:=	S005C+30
+S011F	:=	S005C+30
+S011B	:=	S005C+30
+S020F	:=	S005C+30
+S0117	:=	S005C+30
+S0113	:=	S005C+30
+S010F	:=	S005C+30
+S0213	:=	S005C+30
+S010B	:=	S005C+30
+S0107	:=	S005C+30
+S0103	:=	S005C+30
+S0217	:=	S005C+30
+S00FF	:=	S005C+30
+S00FB	:=	S005C+30
+S00F7	:=	S005C+30
+S021B	:=	S005C+30
+S00F3	:=	S005C+30
+S00EF	:=	S005C+30
+S00EB	:=	S005C+30
+S021F	:=	S005C+30
+S00E7	:=	S005C+30
+S00E3	:=	S005C+30
+S00DF	:=	S005C+30
+S0223	:=	S005C+30
+S00C7	:=	S005C+30
+S00C3	:=	S005C+30
+S00BF	:=	S005C+30
+S0227	:=	S005C+30
+S00BB	:=	S005C+30
+S00B7	:=	S005C+30
+S00B3	:=	S005C+30
+S022B	:=	S005C+30
+S00AF	:=	S005C+30
+S00AB	:=	S005C+30
+S00A7	:=	S005C+30
+S022F	:=	S005C+30
+S00A3	:=	S005C+30
+S009F	:=	S005C+30
+S009B	:=	S005C+30
+S0233	:=	S005C+30
+S0097	:=	S005C+30
+S0093	:=	S005C+30
+S008F	:=	S005C+30
+S0237	:=	S005C+30
+S008B	:=	S005C+30
+S0087	:=	S005C+30
+S0083	:=	S005C+30
+S023B	:=	S005C+30
+S007F	:=	S005C+30
+S007B	:=	S005C+30
+S0063	:=	S005C+30
+S023F	:=	S005C+30
+S005F	:=	S005C+30
+S005B	:=	S005C+30
+S0057	:=	S005C+30
+S0243	:=	S005C+30
+S0053	:=	S005C+30
+S004F	:=	S005C+30
+S004B	:=	S005C+30
+S0247	:=	S005C+30
+S0047	:=	S005C+30
+S0043	:=	S005C+30
+S003F	:=	S005C+30
+S024B	:=	S005C+30
+S003B	:=	S005C+30
+S0037	:=	S005C+30
+S0033	:=	S005C+30
+S024F	:=	S005C+30
+S002F	:=	S005C+30
+S002B	:=	S005C+30
+S0027	:=	S005C+30
+S0253	:=	S005C+30
+S0023	:=	S005C+30
+S001F	:=	S005C+30
+S001B	:=	S005C+30
+S0257	:=	S005C+30
+S0017	:=	S005C+30
+S01C3	:=	S005C+30
+S01C7	:=	S005C+30
+S01CF	:=	S005C+30
+S01CB	:=	S005C+30
+
+.segment	"BSS"
+
+_sca:
+	.res	1,$00
+_scb:
+	.res	1,$00
+_sia:
+	.res	2,$00
+_sib:
+	.res	2,$00
+_sla:
+	.res	4,$00
+_slb:
+	.res	4,$00
+_uca:
+	.res	1,$00
+_ucb:
+	.res	1,$00
+_uia:
+	.res	2,$00
+_uib:
+	.res	2,$00
+_ula:
+	.res	4,$00
+_ulb:
+	.res	4,$00
+
+; ---------------------------------------------------------------
+; signed char __near__ signed_char_1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_char_1: near
+
+	.dbg	func, "signed_char_1", "00", extern, "_signed_char_1"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 90
+	ldx     #$FF
+	lda     #$EC
+	sta     _scb
+	clc
+	ldx     #$00
+	lda     #$3C
+	sta     _sca
+	ldx     #$00
+	lda     _sca
+	bpl     L0003
+	dex
+L0003:	sec
+	sbc     #$64
+	bvc     L0004
+	eor     #$80
+L0004:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$05
+	sta     _scb
+L0002:	ldx     #$00
+	lda     _scb
+	bpl     L0005
+	dex
+L0005:	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; signed char __near__ signed_char_2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_char_2: near
+
+	.dbg	func, "signed_char_2", "00", extern, "_signed_char_2"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 90
+	ldx     #$FF
+	lda     #$EC
+	sta     _scb
+	sec
+	ldx     #$00
+	lda     #$3C
+	sta     _sca
+	ldx     #$00
+	lda     _sca
+	bpl     L0003
+	dex
+L0003:	sec
+	sbc     #$64
+	bvc     L0004
+	eor     #$80
+L0004:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$05
+	sta     _scb
+L0002:	ldx     #$00
+	lda     _scb
+	bpl     L0005
+	dex
+L0005:	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; signed char __near__ signed_char_3 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_char_3: near
+
+	.dbg	func, "signed_char_3", "00", extern, "_signed_char_3"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 90
+	ldx     #$FF
+	lda     #$EC
+	sta     _scb
+	clc
+	ldx     #$00
+	lda     #$64
+	sta     _sca
+	ldx     #$00
+	lda     _sca
+	bpl     L0003
+	dex
+L0003:	sec
+	sbc     #$3C
+	bvc     L0004
+	eor     #$80
+L0004:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$05
+	sta     _scb
+L0002:	ldx     #$00
+	lda     _scb
+	bpl     L0005
+	dex
+L0005:	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; signed char __near__ signed_char_4 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_char_4: near
+
+	.dbg	func, "signed_char_4", "00", extern, "_signed_char_4"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 90
+	ldx     #$FF
+	lda     #$EC
+	sta     _scb
+	sec
+	ldx     #$00
+	lda     #$64
+	sta     _sca
+	ldx     #$00
+	lda     _sca
+	bpl     L0003
+	dex
+L0003:	sec
+	sbc     #$3C
+	bvc     L0004
+	eor     #$80
+L0004:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$05
+	sta     _scb
+L0002:	ldx     #$00
+	lda     _scb
+	bpl     L0005
+	dex
+L0005:	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; signed char __near__ signed_char_5 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_char_5: near
+
+	.dbg	func, "signed_char_5", "00", extern, "_signed_char_5"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 90
+	ldx     #$FF
+	lda     #$EC
+	sta     _scb
+	clc
+	ldx     #$00
+	lda     #$3C
+	sta     _sca
+	ldx     #$00
+	lda     _sca
+	bpl     L0003
+	dex
+L0003:	sec
+	sbc     #$65
+	bvs     L0004
+	eor     #$80
+L0004:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$05
+	sta     _scb
+L0002:	ldx     #$00
+	lda     _scb
+	bpl     L0005
+	dex
+L0005:	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; signed char __near__ signed_char_6 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_char_6: near
+
+	.dbg	func, "signed_char_6", "00", extern, "_signed_char_6"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 90
+	ldx     #$FF
+	lda     #$EC
+	sta     _scb
+	sec
+	ldx     #$00
+	lda     #$3C
+	sta     _sca
+	ldx     #$00
+	lda     _sca
+	bpl     L0003
+	dex
+L0003:	sec
+	sbc     #$65
+	bvs     L0004
+	eor     #$80
+L0004:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$05
+	sta     _scb
+L0002:	ldx     #$00
+	lda     _scb
+	bpl     L0005
+	dex
+L0005:	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; signed char __near__ signed_char_7 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_char_7: near
+
+	.dbg	func, "signed_char_7", "00", extern, "_signed_char_7"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 90
+	ldx     #$FF
+	lda     #$EC
+	sta     _scb
+	clc
+	ldx     #$00
+	lda     #$64
+	sta     _sca
+	ldx     #$00
+	lda     _sca
+	bpl     L0003
+	dex
+L0003:	sec
+	sbc     #$3D
+	bvs     L0004
+	eor     #$80
+L0004:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$05
+	sta     _scb
+L0002:	ldx     #$00
+	lda     _scb
+	bpl     L0005
+	dex
+L0005:	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; signed char __near__ signed_char_8 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_char_8: near
+
+	.dbg	func, "signed_char_8", "00", extern, "_signed_char_8"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 90
+	ldx     #$FF
+	lda     #$EC
+	sta     _scb
+	sec
+	ldx     #$00
+	lda     #$64
+	sta     _sca
+	ldx     #$00
+	lda     _sca
+	bpl     L0003
+	dex
+L0003:	sec
+	sbc     #$3D
+	bvs     L0004
+	eor     #$80
+L0004:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$05
+	sta     _scb
+L0002:	ldx     #$00
+	lda     _scb
+	bpl     L0005
+	dex
+L0005:	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; signed char __near__ signed_char_9 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_char_9: near
+
+	.dbg	func, "signed_char_9", "00", extern, "_signed_char_9"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 90
+	ldx     #$FF
+	lda     #$EC
+	sta     _scb
+	clc
+	ldx     #$00
+	lda     #$3C
+	sta     _sca
+	ldx     #$00
+	lda     _sca
+	bpl     L0003
+	dex
+L0003:	sec
+	sbc     #$65
+	bvc     L0004
+	eor     #$80
+L0004:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$05
+	sta     _scb
+L0002:	ldx     #$00
+	lda     _scb
+	bpl     L0005
+	dex
+L0005:	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; signed char __near__ signed_char_10 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_char_10: near
+
+	.dbg	func, "signed_char_10", "00", extern, "_signed_char_10"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 90
+	ldx     #$FF
+	lda     #$EC
+	sta     _scb
+	sec
+	ldx     #$00
+	lda     #$3C
+	sta     _sca
+	ldx     #$00
+	lda     _sca
+	bpl     L0003
+	dex
+L0003:	sec
+	sbc     #$65
+	bvc     L0004
+	eor     #$80
+L0004:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$05
+	sta     _scb
+L0002:	ldx     #$00
+	lda     _scb
+	bpl     L0005
+	dex
+L0005:	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; signed char __near__ signed_char_11 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_char_11: near
+
+	.dbg	func, "signed_char_11", "00", extern, "_signed_char_11"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 90
+	ldx     #$FF
+	lda     #$EC
+	sta     _scb
+	clc
+	ldx     #$00
+	lda     #$64
+	sta     _sca
+	ldx     #$00
+	lda     _sca
+	bpl     L0003
+	dex
+L0003:	sec
+	sbc     #$3D
+	bvc     L0004
+	eor     #$80
+L0004:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$05
+	sta     _scb
+L0002:	ldx     #$00
+	lda     _scb
+	bpl     L0005
+	dex
+L0005:	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; signed char __near__ signed_char_12 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_char_12: near
+
+	.dbg	func, "signed_char_12", "00", extern, "_signed_char_12"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 90
+	ldx     #$FF
+	lda     #$EC
+	sta     _scb
+	sec
+	ldx     #$00
+	lda     #$64
+	sta     _sca
+	ldx     #$00
+	lda     _sca
+	bpl     L0003
+	dex
+L0003:	sec
+	sbc     #$3D
+	bvc     L0004
+	eor     #$80
+L0004:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$05
+	sta     _scb
+L0002:	ldx     #$00
+	lda     _scb
+	bpl     L0005
+	dex
+L0005:	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; signed char __near__ signed_char_13 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_char_13: near
+
+	.dbg	func, "signed_char_13", "00", extern, "_signed_char_13"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 90
+	ldx     #$FF
+	lda     #$EC
+	sta     _scb
+	clc
+	ldx     #$00
+	lda     #$3C
+	sta     _sca
+	ldx     #$00
+	lda     _sca
+	bpl     L0003
+	dex
+L0003:	sec
+	sbc     #$64
+	bvs     L0004
+	eor     #$80
+L0004:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$05
+	sta     _scb
+L0002:	ldx     #$00
+	lda     _scb
+	bpl     L0005
+	dex
+L0005:	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; signed char __near__ signed_char_14 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_char_14: near
+
+	.dbg	func, "signed_char_14", "00", extern, "_signed_char_14"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 90
+	ldx     #$FF
+	lda     #$EC
+	sta     _scb
+	sec
+	ldx     #$00
+	lda     #$3C
+	sta     _sca
+	ldx     #$00
+	lda     _sca
+	bpl     L0003
+	dex
+L0003:	sec
+	sbc     #$64
+	bvs     L0004
+	eor     #$80
+L0004:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$05
+	sta     _scb
+L0002:	ldx     #$00
+	lda     _scb
+	bpl     L0005
+	dex
+L0005:	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; signed char __near__ signed_char_15 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_char_15: near
+
+	.dbg	func, "signed_char_15", "00", extern, "_signed_char_15"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 90
+	ldx     #$FF
+	lda     #$EC
+	sta     _scb
+	clc
+	ldx     #$00
+	lda     #$64
+	sta     _sca
+	ldx     #$00
+	lda     _sca
+	bpl     L0003
+	dex
+L0003:	sec
+	sbc     #$3C
+	bvs     L0004
+	eor     #$80
+L0004:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$05
+	sta     _scb
+L0002:	ldx     #$00
+	lda     _scb
+	bpl     L0005
+	dex
+L0005:	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; signed char __near__ signed_char_16 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_char_16: near
+
+	.dbg	func, "signed_char_16", "00", extern, "_signed_char_16"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 90
+	ldx     #$FF
+	lda     #$EC
+	sta     _scb
+	sec
+	ldx     #$00
+	lda     #$64
+	sta     _sca
+	ldx     #$00
+	lda     _sca
+	bpl     L0003
+	dex
+L0003:	sec
+	sbc     #$3C
+	bvs     L0004
+	eor     #$80
+L0004:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$05
+	sta     _scb
+L0002:	ldx     #$00
+	lda     _scb
+	bpl     L0005
+	dex
+L0005:	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; signed char __near__ signed_char_17 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_char_17: near
+
+	.dbg	func, "signed_char_17", "00", extern, "_signed_char_17"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 90
+	ldx     #$FF
+	lda     #$EC
+	sta     _scb
+	nop
+	ldx     #$00
+	lda     #$3C
+	sta     _sca
+	ldx     #$00
+	lda     _sca
+	bpl     L0003
+	dex
+L0003:	cmp     #$64
+	jsr     booleq
+	jeq     L0002
+	ldx     #$00
+	lda     #$05
+	sta     _scb
+L0002:	ldx     #$00
+	lda     _scb
+	bpl     L0004
+	dex
+L0004:	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; signed char __near__ signed_char_18 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_char_18: near
+
+	.dbg	func, "signed_char_18", "00", extern, "_signed_char_18"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 90
+	ldx     #$FF
+	lda     #$EC
+	sta     _scb
+	nop
+	ldx     #$00
+	lda     #$64
+	sta     _sca
+	ldx     #$00
+	lda     _sca
+	bpl     L0003
+	dex
+L0003:	cmp     #$64
+	jsr     booleq
+	jeq     L0002
+	ldx     #$00
+	lda     #$05
+	sta     _scb
+L0002:	ldx     #$00
+	lda     _scb
+	bpl     L0004
+	dex
+L0004:	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; signed char __near__ signed_char_19 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_char_19: near
+
+	.dbg	func, "signed_char_19", "00", extern, "_signed_char_19"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 90
+	ldx     #$FF
+	lda     #$EC
+	sta     _scb
+	nop
+	ldx     #$00
+	lda     #$3C
+	sta     _sca
+	ldx     #$00
+	lda     _sca
+	bpl     L0003
+	dex
+L0003:	cmp     #$64
+	jsr     boolne
+	jeq     L0002
+	ldx     #$00
+	lda     #$05
+	sta     _scb
+L0002:	ldx     #$00
+	lda     _scb
+	bpl     L0004
+	dex
+L0004:	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; signed char __near__ signed_char_20 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_char_20: near
+
+	.dbg	func, "signed_char_20", "00", extern, "_signed_char_20"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 90
+	ldx     #$FF
+	lda     #$EC
+	sta     _scb
+	nop
+	ldx     #$00
+	lda     #$64
+	sta     _sca
+	ldx     #$00
+	lda     _sca
+	bpl     L0003
+	dex
+L0003:	cmp     #$64
+	jsr     boolne
+	jeq     L0002
+	ldx     #$00
+	lda     #$05
+	sta     _scb
+L0002:	ldx     #$00
+	lda     _scb
+	bpl     L0004
+	dex
+L0004:	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ signed_char_test (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_char_test: near
+
+	.dbg	func, "signed_char_test", "00", extern, "_signed_char_test"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 90
+	jsr     _signed_char_1
+	cmp     #$05
+	jsr     boolne
+	jeq     L0002
+	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5A
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0016)
+	ldx     #>(S0016)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0017)
+	ldx     #>(S0017)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0018)
+	ldx     #>(S0018)
+	jsr     pushax
+	jsr     _signed_char_1
+	jsr     pushax
+	ldx     #$00
+	lda     #$05
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0002:	jsr     _signed_char_2
+	cmp     #$05
+	jsr     boolne
+	jeq     L0003
+	lda     #<(S0019)
+	ldx     #>(S0019)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5A
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S001A)
+	ldx     #>(S001A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S001B)
+	ldx     #>(S001B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S001C)
+	ldx     #>(S001C)
+	jsr     pushax
+	jsr     _signed_char_2
+	jsr     pushax
+	ldx     #$00
+	lda     #$05
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0003:	jsr     _signed_char_3
+	cmp     #$EC
+	jsr     boolne
+	jeq     L0004
+	lda     #<(S001D)
+	ldx     #>(S001D)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5A
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S001E)
+	ldx     #>(S001E)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S001F)
+	ldx     #>(S001F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0020)
+	ldx     #>(S0020)
+	jsr     pushax
+	jsr     _signed_char_3
+	jsr     pushax
+	ldx     #$FF
+	lda     #$EC
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0004:	jsr     _signed_char_4
+	cmp     #$EC
+	jsr     boolne
+	jeq     L0005
+	lda     #<(S0021)
+	ldx     #>(S0021)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5A
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0022)
+	ldx     #>(S0022)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0023)
+	ldx     #>(S0023)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0024)
+	ldx     #>(S0024)
+	jsr     pushax
+	jsr     _signed_char_4
+	jsr     pushax
+	ldx     #$FF
+	lda     #$EC
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0005:	jsr     _signed_char_5
+	cmp     #$EC
+	jsr     boolne
+	jeq     L0006
+	lda     #<(S0025)
+	ldx     #>(S0025)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5A
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0026)
+	ldx     #>(S0026)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0027)
+	ldx     #>(S0027)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0028)
+	ldx     #>(S0028)
+	jsr     pushax
+	jsr     _signed_char_5
+	jsr     pushax
+	ldx     #$FF
+	lda     #$EC
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0006:	jsr     _signed_char_6
+	cmp     #$EC
+	jsr     boolne
+	jeq     L0007
+	lda     #<(S0029)
+	ldx     #>(S0029)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5A
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S002A)
+	ldx     #>(S002A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S002B)
+	ldx     #>(S002B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S002C)
+	ldx     #>(S002C)
+	jsr     pushax
+	jsr     _signed_char_6
+	jsr     pushax
+	ldx     #$FF
+	lda     #$EC
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0007:	jsr     _signed_char_7
+	cmp     #$05
+	jsr     boolne
+	jeq     L0008
+	lda     #<(S002D)
+	ldx     #>(S002D)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5A
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S002E)
+	ldx     #>(S002E)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S002F)
+	ldx     #>(S002F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0030)
+	ldx     #>(S0030)
+	jsr     pushax
+	jsr     _signed_char_7
+	jsr     pushax
+	ldx     #$00
+	lda     #$05
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0008:	jsr     _signed_char_8
+	cmp     #$05
+	jsr     boolne
+	jeq     L0009
+	lda     #<(S0031)
+	ldx     #>(S0031)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5A
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0032)
+	ldx     #>(S0032)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0033)
+	ldx     #>(S0033)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0034)
+	ldx     #>(S0034)
+	jsr     pushax
+	jsr     _signed_char_8
+	jsr     pushax
+	ldx     #$00
+	lda     #$05
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0009:	jsr     _signed_char_9
+	cmp     #$05
+	jsr     boolne
+	jeq     L000A
+	lda     #<(S0035)
+	ldx     #>(S0035)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5A
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0036)
+	ldx     #>(S0036)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0037)
+	ldx     #>(S0037)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0038)
+	ldx     #>(S0038)
+	jsr     pushax
+	jsr     _signed_char_9
+	jsr     pushax
+	ldx     #$00
+	lda     #$05
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L000A:	jsr     _signed_char_10
+	cmp     #$05
+	jsr     boolne
+	jeq     L000B
+	lda     #<(S0039)
+	ldx     #>(S0039)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5A
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S003A)
+	ldx     #>(S003A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S003B)
+	ldx     #>(S003B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S003C)
+	ldx     #>(S003C)
+	jsr     pushax
+	jsr     _signed_char_10
+	jsr     pushax
+	ldx     #$00
+	lda     #$05
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L000B:	jsr     _signed_char_11
+	cmp     #$EC
+	jsr     boolne
+	jeq     L000C
+	lda     #<(S003D)
+	ldx     #>(S003D)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5A
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S003E)
+	ldx     #>(S003E)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S003F)
+	ldx     #>(S003F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0040)
+	ldx     #>(S0040)
+	jsr     pushax
+	jsr     _signed_char_11
+	jsr     pushax
+	ldx     #$FF
+	lda     #$EC
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L000C:	jsr     _signed_char_12
+	cmp     #$EC
+	jsr     boolne
+	jeq     L000D
+	lda     #<(S0041)
+	ldx     #>(S0041)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5A
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0042)
+	ldx     #>(S0042)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0043)
+	ldx     #>(S0043)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0044)
+	ldx     #>(S0044)
+	jsr     pushax
+	jsr     _signed_char_12
+	jsr     pushax
+	ldx     #$FF
+	lda     #$EC
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L000D:	jsr     _signed_char_13
+	cmp     #$EC
+	jsr     boolne
+	jeq     L000E
+	lda     #<(S0045)
+	ldx     #>(S0045)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5A
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0046)
+	ldx     #>(S0046)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0047)
+	ldx     #>(S0047)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0048)
+	ldx     #>(S0048)
+	jsr     pushax
+	jsr     _signed_char_13
+	jsr     pushax
+	ldx     #$FF
+	lda     #$EC
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L000E:	jsr     _signed_char_14
+	cmp     #$EC
+	jsr     boolne
+	jeq     L000F
+	lda     #<(S0049)
+	ldx     #>(S0049)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5A
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S004A)
+	ldx     #>(S004A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S004B)
+	ldx     #>(S004B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S004C)
+	ldx     #>(S004C)
+	jsr     pushax
+	jsr     _signed_char_14
+	jsr     pushax
+	ldx     #$FF
+	lda     #$EC
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L000F:	jsr     _signed_char_15
+	cmp     #$05
+	jsr     boolne
+	jeq     L0010
+	lda     #<(S004D)
+	ldx     #>(S004D)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5A
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S004E)
+	ldx     #>(S004E)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S004F)
+	ldx     #>(S004F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0050)
+	ldx     #>(S0050)
+	jsr     pushax
+	jsr     _signed_char_15
+	jsr     pushax
+	ldx     #$00
+	lda     #$05
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0010:	jsr     _signed_char_16
+	cmp     #$05
+	jsr     boolne
+	jeq     L0011
+	lda     #<(S0051)
+	ldx     #>(S0051)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5A
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0052)
+	ldx     #>(S0052)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0053)
+	ldx     #>(S0053)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0054)
+	ldx     #>(S0054)
+	jsr     pushax
+	jsr     _signed_char_16
+	jsr     pushax
+	ldx     #$00
+	lda     #$05
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0011:	jsr     _signed_char_17
+	cmp     #$EC
+	jsr     boolne
+	jeq     L0012
+	lda     #<(S0055)
+	ldx     #>(S0055)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5A
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0056)
+	ldx     #>(S0056)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0057)
+	ldx     #>(S0057)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0058)
+	ldx     #>(S0058)
+	jsr     pushax
+	jsr     _signed_char_17
+	jsr     pushax
+	ldx     #$FF
+	lda     #$EC
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0012:	jsr     _signed_char_18
+	cmp     #$05
+	jsr     boolne
+	jeq     L0013
+	lda     #<(S0059)
+	ldx     #>(S0059)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5A
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S005A)
+	ldx     #>(S005A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S005B)
+	ldx     #>(S005B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S005C)
+	ldx     #>(S005C)
+	jsr     pushax
+	jsr     _signed_char_18
+	jsr     pushax
+	ldx     #$00
+	lda     #$05
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0013:	jsr     _signed_char_19
+	cmp     #$05
+	jsr     boolne
+	jeq     L0014
+	lda     #<(S005D)
+	ldx     #>(S005D)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5A
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S005E)
+	ldx     #>(S005E)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S005F)
+	ldx     #>(S005F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0060)
+	ldx     #>(S0060)
+	jsr     pushax
+	jsr     _signed_char_19
+	jsr     pushax
+	ldx     #$00
+	lda     #$05
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0014:	jsr     _signed_char_20
+	cmp     #$EC
+	jsr     boolne
+	jeq     L0015
+	lda     #<(S0061)
+	ldx     #>(S0061)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5A
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0062)
+	ldx     #>(S0062)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0063)
+	ldx     #>(S0063)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0064)
+	ldx     #>(S0064)
+	jsr     pushax
+	jsr     _signed_char_20
+	jsr     pushax
+	ldx     #$FF
+	lda     #$EC
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0015:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ unsigned_char_1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_char_1: near
+
+	.dbg	func, "unsigned_char_1", "00", extern, "_unsigned_char_1"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 91
+	ldx     #$00
+	lda     #$14
+	sta     _ucb
+	clc
+	ldx     #$00
+	lda     #$3C
+	sta     _uca
+	ldx     #$00
+	lda     _uca
+	cmp     #$64
+	jsr     boolult
+	jeq     L0002
+	ldx     #$00
+	lda     #$05
+	sta     _ucb
+L0002:	ldx     #$00
+	lda     _ucb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ unsigned_char_2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_char_2: near
+
+	.dbg	func, "unsigned_char_2", "00", extern, "_unsigned_char_2"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 91
+	ldx     #$00
+	lda     #$14
+	sta     _ucb
+	sec
+	ldx     #$00
+	lda     #$3C
+	sta     _uca
+	ldx     #$00
+	lda     _uca
+	cmp     #$64
+	jsr     boolult
+	jeq     L0002
+	ldx     #$00
+	lda     #$05
+	sta     _ucb
+L0002:	ldx     #$00
+	lda     _ucb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ unsigned_char_3 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_char_3: near
+
+	.dbg	func, "unsigned_char_3", "00", extern, "_unsigned_char_3"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 91
+	ldx     #$00
+	lda     #$14
+	sta     _ucb
+	clc
+	ldx     #$00
+	lda     #$64
+	sta     _uca
+	ldx     #$00
+	lda     _uca
+	cmp     #$3C
+	jsr     boolult
+	jeq     L0002
+	ldx     #$00
+	lda     #$05
+	sta     _ucb
+L0002:	ldx     #$00
+	lda     _ucb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ unsigned_char_4 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_char_4: near
+
+	.dbg	func, "unsigned_char_4", "00", extern, "_unsigned_char_4"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 91
+	ldx     #$00
+	lda     #$14
+	sta     _ucb
+	sec
+	ldx     #$00
+	lda     #$64
+	sta     _uca
+	ldx     #$00
+	lda     _uca
+	cmp     #$3C
+	jsr     boolult
+	jeq     L0002
+	ldx     #$00
+	lda     #$05
+	sta     _ucb
+L0002:	ldx     #$00
+	lda     _ucb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ unsigned_char_5 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_char_5: near
+
+	.dbg	func, "unsigned_char_5", "00", extern, "_unsigned_char_5"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 91
+	ldx     #$00
+	lda     #$14
+	sta     _ucb
+	clc
+	ldx     #$00
+	lda     #$3C
+	sta     _uca
+	ldx     #$00
+	lda     _uca
+	cmp     #$65
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$05
+	sta     _ucb
+L0002:	ldx     #$00
+	lda     _ucb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ unsigned_char_6 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_char_6: near
+
+	.dbg	func, "unsigned_char_6", "00", extern, "_unsigned_char_6"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 91
+	ldx     #$00
+	lda     #$14
+	sta     _ucb
+	sec
+	ldx     #$00
+	lda     #$3C
+	sta     _uca
+	ldx     #$00
+	lda     _uca
+	cmp     #$65
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$05
+	sta     _ucb
+L0002:	ldx     #$00
+	lda     _ucb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ unsigned_char_7 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_char_7: near
+
+	.dbg	func, "unsigned_char_7", "00", extern, "_unsigned_char_7"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 91
+	ldx     #$00
+	lda     #$14
+	sta     _ucb
+	clc
+	ldx     #$00
+	lda     #$64
+	sta     _uca
+	ldx     #$00
+	lda     _uca
+	cmp     #$3D
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$05
+	sta     _ucb
+L0002:	ldx     #$00
+	lda     _ucb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ unsigned_char_8 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_char_8: near
+
+	.dbg	func, "unsigned_char_8", "00", extern, "_unsigned_char_8"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 91
+	ldx     #$00
+	lda     #$14
+	sta     _ucb
+	sec
+	ldx     #$00
+	lda     #$64
+	sta     _uca
+	ldx     #$00
+	lda     _uca
+	cmp     #$3D
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$05
+	sta     _ucb
+L0002:	ldx     #$00
+	lda     _ucb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ unsigned_char_9 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_char_9: near
+
+	.dbg	func, "unsigned_char_9", "00", extern, "_unsigned_char_9"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 91
+	ldx     #$00
+	lda     #$14
+	sta     _ucb
+	clc
+	ldx     #$00
+	lda     #$3C
+	sta     _uca
+	ldx     #$00
+	lda     _uca
+	cmp     #$65
+	jsr     boolult
+	jeq     L0002
+	ldx     #$00
+	lda     #$05
+	sta     _ucb
+L0002:	ldx     #$00
+	lda     _ucb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ unsigned_char_10 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_char_10: near
+
+	.dbg	func, "unsigned_char_10", "00", extern, "_unsigned_char_10"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 91
+	ldx     #$00
+	lda     #$14
+	sta     _ucb
+	sec
+	ldx     #$00
+	lda     #$3C
+	sta     _uca
+	ldx     #$00
+	lda     _uca
+	cmp     #$65
+	jsr     boolult
+	jeq     L0002
+	ldx     #$00
+	lda     #$05
+	sta     _ucb
+L0002:	ldx     #$00
+	lda     _ucb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ unsigned_char_11 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_char_11: near
+
+	.dbg	func, "unsigned_char_11", "00", extern, "_unsigned_char_11"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 91
+	ldx     #$00
+	lda     #$14
+	sta     _ucb
+	clc
+	ldx     #$00
+	lda     #$64
+	sta     _uca
+	ldx     #$00
+	lda     _uca
+	cmp     #$3D
+	jsr     boolult
+	jeq     L0002
+	ldx     #$00
+	lda     #$05
+	sta     _ucb
+L0002:	ldx     #$00
+	lda     _ucb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ unsigned_char_12 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_char_12: near
+
+	.dbg	func, "unsigned_char_12", "00", extern, "_unsigned_char_12"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 91
+	ldx     #$00
+	lda     #$14
+	sta     _ucb
+	sec
+	ldx     #$00
+	lda     #$64
+	sta     _uca
+	ldx     #$00
+	lda     _uca
+	cmp     #$3D
+	jsr     boolult
+	jeq     L0002
+	ldx     #$00
+	lda     #$05
+	sta     _ucb
+L0002:	ldx     #$00
+	lda     _ucb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ unsigned_char_13 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_char_13: near
+
+	.dbg	func, "unsigned_char_13", "00", extern, "_unsigned_char_13"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 91
+	ldx     #$00
+	lda     #$14
+	sta     _ucb
+	clc
+	ldx     #$00
+	lda     #$3C
+	sta     _uca
+	ldx     #$00
+	lda     _uca
+	cmp     #$64
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$05
+	sta     _ucb
+L0002:	ldx     #$00
+	lda     _ucb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ unsigned_char_14 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_char_14: near
+
+	.dbg	func, "unsigned_char_14", "00", extern, "_unsigned_char_14"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 91
+	ldx     #$00
+	lda     #$14
+	sta     _ucb
+	sec
+	ldx     #$00
+	lda     #$3C
+	sta     _uca
+	ldx     #$00
+	lda     _uca
+	cmp     #$64
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$05
+	sta     _ucb
+L0002:	ldx     #$00
+	lda     _ucb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ unsigned_char_15 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_char_15: near
+
+	.dbg	func, "unsigned_char_15", "00", extern, "_unsigned_char_15"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 91
+	ldx     #$00
+	lda     #$14
+	sta     _ucb
+	clc
+	ldx     #$00
+	lda     #$64
+	sta     _uca
+	ldx     #$00
+	lda     _uca
+	cmp     #$3C
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$05
+	sta     _ucb
+L0002:	ldx     #$00
+	lda     _ucb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ unsigned_char_16 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_char_16: near
+
+	.dbg	func, "unsigned_char_16", "00", extern, "_unsigned_char_16"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 91
+	ldx     #$00
+	lda     #$14
+	sta     _ucb
+	sec
+	ldx     #$00
+	lda     #$64
+	sta     _uca
+	ldx     #$00
+	lda     _uca
+	cmp     #$3C
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$05
+	sta     _ucb
+L0002:	ldx     #$00
+	lda     _ucb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ unsigned_char_17 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_char_17: near
+
+	.dbg	func, "unsigned_char_17", "00", extern, "_unsigned_char_17"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 91
+	ldx     #$00
+	lda     #$14
+	sta     _ucb
+	nop
+	ldx     #$00
+	lda     #$3C
+	sta     _uca
+	ldx     #$00
+	lda     _uca
+	cmp     #$64
+	jsr     booleq
+	jeq     L0002
+	ldx     #$00
+	lda     #$05
+	sta     _ucb
+L0002:	ldx     #$00
+	lda     _ucb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ unsigned_char_18 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_char_18: near
+
+	.dbg	func, "unsigned_char_18", "00", extern, "_unsigned_char_18"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 91
+	ldx     #$00
+	lda     #$14
+	sta     _ucb
+	nop
+	ldx     #$00
+	lda     #$64
+	sta     _uca
+	ldx     #$00
+	lda     _uca
+	cmp     #$64
+	jsr     booleq
+	jeq     L0002
+	ldx     #$00
+	lda     #$05
+	sta     _ucb
+L0002:	ldx     #$00
+	lda     _ucb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ unsigned_char_19 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_char_19: near
+
+	.dbg	func, "unsigned_char_19", "00", extern, "_unsigned_char_19"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 91
+	ldx     #$00
+	lda     #$14
+	sta     _ucb
+	nop
+	ldx     #$00
+	lda     #$3C
+	sta     _uca
+	ldx     #$00
+	lda     _uca
+	cmp     #$64
+	jsr     boolne
+	jeq     L0002
+	ldx     #$00
+	lda     #$05
+	sta     _ucb
+L0002:	ldx     #$00
+	lda     _ucb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ unsigned_char_20 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_char_20: near
+
+	.dbg	func, "unsigned_char_20", "00", extern, "_unsigned_char_20"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 91
+	ldx     #$00
+	lda     #$14
+	sta     _ucb
+	nop
+	ldx     #$00
+	lda     #$64
+	sta     _uca
+	ldx     #$00
+	lda     _uca
+	cmp     #$64
+	jsr     boolne
+	jeq     L0002
+	ldx     #$00
+	lda     #$05
+	sta     _ucb
+L0002:	ldx     #$00
+	lda     _ucb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ unsigned_char_test (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_char_test: near
+
+	.dbg	func, "unsigned_char_test", "00", extern, "_unsigned_char_test"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 91
+	jsr     _unsigned_char_1
+	cmp     #$05
+	jsr     boolne
+	jeq     L0002
+	lda     #<(S0079)
+	ldx     #>(S0079)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5B
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S007A)
+	ldx     #>(S007A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S007B)
+	ldx     #>(S007B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S007C)
+	ldx     #>(S007C)
+	jsr     pushax
+	jsr     _unsigned_char_1
+	jsr     pushax
+	ldx     #$00
+	lda     #$05
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0002:	jsr     _unsigned_char_2
+	cmp     #$05
+	jsr     boolne
+	jeq     L0003
+	lda     #<(S007D)
+	ldx     #>(S007D)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5B
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S007E)
+	ldx     #>(S007E)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S007F)
+	ldx     #>(S007F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0080)
+	ldx     #>(S0080)
+	jsr     pushax
+	jsr     _unsigned_char_2
+	jsr     pushax
+	ldx     #$00
+	lda     #$05
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0003:	jsr     _unsigned_char_3
+	cmp     #$14
+	jsr     boolne
+	jeq     L0004
+	lda     #<(S0081)
+	ldx     #>(S0081)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5B
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0082)
+	ldx     #>(S0082)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0083)
+	ldx     #>(S0083)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0084)
+	ldx     #>(S0084)
+	jsr     pushax
+	jsr     _unsigned_char_3
+	jsr     pushax
+	ldx     #$00
+	lda     #$14
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0004:	jsr     _unsigned_char_4
+	cmp     #$14
+	jsr     boolne
+	jeq     L0005
+	lda     #<(S0085)
+	ldx     #>(S0085)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5B
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0086)
+	ldx     #>(S0086)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0087)
+	ldx     #>(S0087)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0088)
+	ldx     #>(S0088)
+	jsr     pushax
+	jsr     _unsigned_char_4
+	jsr     pushax
+	ldx     #$00
+	lda     #$14
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0005:	jsr     _unsigned_char_5
+	cmp     #$14
+	jsr     boolne
+	jeq     L0006
+	lda     #<(S0089)
+	ldx     #>(S0089)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5B
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S008A)
+	ldx     #>(S008A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S008B)
+	ldx     #>(S008B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S008C)
+	ldx     #>(S008C)
+	jsr     pushax
+	jsr     _unsigned_char_5
+	jsr     pushax
+	ldx     #$00
+	lda     #$14
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0006:	jsr     _unsigned_char_6
+	cmp     #$14
+	jsr     boolne
+	jeq     L0007
+	lda     #<(S008D)
+	ldx     #>(S008D)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5B
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S008E)
+	ldx     #>(S008E)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S008F)
+	ldx     #>(S008F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0090)
+	ldx     #>(S0090)
+	jsr     pushax
+	jsr     _unsigned_char_6
+	jsr     pushax
+	ldx     #$00
+	lda     #$14
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0007:	jsr     _unsigned_char_7
+	cmp     #$05
+	jsr     boolne
+	jeq     L0008
+	lda     #<(S0091)
+	ldx     #>(S0091)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5B
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0092)
+	ldx     #>(S0092)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0093)
+	ldx     #>(S0093)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0094)
+	ldx     #>(S0094)
+	jsr     pushax
+	jsr     _unsigned_char_7
+	jsr     pushax
+	ldx     #$00
+	lda     #$05
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0008:	jsr     _unsigned_char_8
+	cmp     #$05
+	jsr     boolne
+	jeq     L0009
+	lda     #<(S0095)
+	ldx     #>(S0095)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5B
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0096)
+	ldx     #>(S0096)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0097)
+	ldx     #>(S0097)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0098)
+	ldx     #>(S0098)
+	jsr     pushax
+	jsr     _unsigned_char_8
+	jsr     pushax
+	ldx     #$00
+	lda     #$05
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0009:	jsr     _unsigned_char_9
+	cmp     #$05
+	jsr     boolne
+	jeq     L000A
+	lda     #<(S0099)
+	ldx     #>(S0099)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5B
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S009A)
+	ldx     #>(S009A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S009B)
+	ldx     #>(S009B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S009C)
+	ldx     #>(S009C)
+	jsr     pushax
+	jsr     _unsigned_char_9
+	jsr     pushax
+	ldx     #$00
+	lda     #$05
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L000A:	jsr     _unsigned_char_10
+	cmp     #$05
+	jsr     boolne
+	jeq     L000B
+	lda     #<(S009D)
+	ldx     #>(S009D)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5B
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S009E)
+	ldx     #>(S009E)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S009F)
+	ldx     #>(S009F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S00A0)
+	ldx     #>(S00A0)
+	jsr     pushax
+	jsr     _unsigned_char_10
+	jsr     pushax
+	ldx     #$00
+	lda     #$05
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L000B:	jsr     _unsigned_char_11
+	cmp     #$14
+	jsr     boolne
+	jeq     L000C
+	lda     #<(S00A1)
+	ldx     #>(S00A1)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5B
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S00A2)
+	ldx     #>(S00A2)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S00A3)
+	ldx     #>(S00A3)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S00A4)
+	ldx     #>(S00A4)
+	jsr     pushax
+	jsr     _unsigned_char_11
+	jsr     pushax
+	ldx     #$00
+	lda     #$14
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L000C:	jsr     _unsigned_char_12
+	cmp     #$14
+	jsr     boolne
+	jeq     L000D
+	lda     #<(S00A5)
+	ldx     #>(S00A5)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5B
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S00A6)
+	ldx     #>(S00A6)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S00A7)
+	ldx     #>(S00A7)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S00A8)
+	ldx     #>(S00A8)
+	jsr     pushax
+	jsr     _unsigned_char_12
+	jsr     pushax
+	ldx     #$00
+	lda     #$14
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L000D:	jsr     _unsigned_char_13
+	cmp     #$14
+	jsr     boolne
+	jeq     L000E
+	lda     #<(S00A9)
+	ldx     #>(S00A9)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5B
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S00AA)
+	ldx     #>(S00AA)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S00AB)
+	ldx     #>(S00AB)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S00AC)
+	ldx     #>(S00AC)
+	jsr     pushax
+	jsr     _unsigned_char_13
+	jsr     pushax
+	ldx     #$00
+	lda     #$14
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L000E:	jsr     _unsigned_char_14
+	cmp     #$14
+	jsr     boolne
+	jeq     L000F
+	lda     #<(S00AD)
+	ldx     #>(S00AD)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5B
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S00AE)
+	ldx     #>(S00AE)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S00AF)
+	ldx     #>(S00AF)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S00B0)
+	ldx     #>(S00B0)
+	jsr     pushax
+	jsr     _unsigned_char_14
+	jsr     pushax
+	ldx     #$00
+	lda     #$14
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L000F:	jsr     _unsigned_char_15
+	cmp     #$05
+	jsr     boolne
+	jeq     L0010
+	lda     #<(S00B1)
+	ldx     #>(S00B1)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5B
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S00B2)
+	ldx     #>(S00B2)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S00B3)
+	ldx     #>(S00B3)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S00B4)
+	ldx     #>(S00B4)
+	jsr     pushax
+	jsr     _unsigned_char_15
+	jsr     pushax
+	ldx     #$00
+	lda     #$05
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0010:	jsr     _unsigned_char_16
+	cmp     #$05
+	jsr     boolne
+	jeq     L0011
+	lda     #<(S00B5)
+	ldx     #>(S00B5)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5B
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S00B6)
+	ldx     #>(S00B6)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S00B7)
+	ldx     #>(S00B7)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S00B8)
+	ldx     #>(S00B8)
+	jsr     pushax
+	jsr     _unsigned_char_16
+	jsr     pushax
+	ldx     #$00
+	lda     #$05
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0011:	jsr     _unsigned_char_17
+	cmp     #$14
+	jsr     boolne
+	jeq     L0012
+	lda     #<(S00B9)
+	ldx     #>(S00B9)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5B
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S00BA)
+	ldx     #>(S00BA)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S00BB)
+	ldx     #>(S00BB)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S00BC)
+	ldx     #>(S00BC)
+	jsr     pushax
+	jsr     _unsigned_char_17
+	jsr     pushax
+	ldx     #$00
+	lda     #$14
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0012:	jsr     _unsigned_char_18
+	cmp     #$05
+	jsr     boolne
+	jeq     L0013
+	lda     #<(S00BD)
+	ldx     #>(S00BD)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5B
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S00BE)
+	ldx     #>(S00BE)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S00BF)
+	ldx     #>(S00BF)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S00C0)
+	ldx     #>(S00C0)
+	jsr     pushax
+	jsr     _unsigned_char_18
+	jsr     pushax
+	ldx     #$00
+	lda     #$05
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0013:	jsr     _unsigned_char_19
+	cmp     #$05
+	jsr     boolne
+	jeq     L0014
+	lda     #<(S00C1)
+	ldx     #>(S00C1)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5B
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S00C2)
+	ldx     #>(S00C2)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S00C3)
+	ldx     #>(S00C3)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S00C4)
+	ldx     #>(S00C4)
+	jsr     pushax
+	jsr     _unsigned_char_19
+	jsr     pushax
+	ldx     #$00
+	lda     #$05
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0014:	jsr     _unsigned_char_20
+	cmp     #$14
+	jsr     boolne
+	jeq     L0015
+	lda     #<(S00C5)
+	ldx     #>(S00C5)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5B
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S00C6)
+	ldx     #>(S00C6)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S00C7)
+	ldx     #>(S00C7)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S00C8)
+	ldx     #>(S00C8)
+	jsr     pushax
+	jsr     _unsigned_char_20
+	jsr     pushax
+	ldx     #$00
+	lda     #$14
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0015:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ signed_int_1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_int_1: near
+
+	.dbg	func, "signed_int_1", "00", extern, "_signed_int_1"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 92
+	ldx     #$F8
+	lda     #$30
+	sta     _sib
+	stx     _sib+1
+	clc
+	ldx     #$02
+	lda     #$58
+	sta     _sia
+	stx     _sia+1
+	lda     _sia
+	ldx     _sia+1
+	cmp     #$E8
+	txa
+	sbc     #$03
+	bvc     L0003
+	eor     #$80
+L0003:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$32
+	sta     _sib
+	stx     _sib+1
+L0002:	lda     _sib
+	ldx     _sib+1
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ signed_int_2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_int_2: near
+
+	.dbg	func, "signed_int_2", "00", extern, "_signed_int_2"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 92
+	ldx     #$F8
+	lda     #$30
+	sta     _sib
+	stx     _sib+1
+	sec
+	ldx     #$02
+	lda     #$58
+	sta     _sia
+	stx     _sia+1
+	lda     _sia
+	ldx     _sia+1
+	cmp     #$E8
+	txa
+	sbc     #$03
+	bvc     L0003
+	eor     #$80
+L0003:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$32
+	sta     _sib
+	stx     _sib+1
+L0002:	lda     _sib
+	ldx     _sib+1
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ signed_int_3 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_int_3: near
+
+	.dbg	func, "signed_int_3", "00", extern, "_signed_int_3"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 92
+	ldx     #$F8
+	lda     #$30
+	sta     _sib
+	stx     _sib+1
+	clc
+	ldx     #$03
+	lda     #$E8
+	sta     _sia
+	stx     _sia+1
+	lda     _sia
+	ldx     _sia+1
+	cmp     #$58
+	txa
+	sbc     #$02
+	bvc     L0003
+	eor     #$80
+L0003:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$32
+	sta     _sib
+	stx     _sib+1
+L0002:	lda     _sib
+	ldx     _sib+1
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ signed_int_4 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_int_4: near
+
+	.dbg	func, "signed_int_4", "00", extern, "_signed_int_4"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 92
+	ldx     #$F8
+	lda     #$30
+	sta     _sib
+	stx     _sib+1
+	sec
+	ldx     #$03
+	lda     #$E8
+	sta     _sia
+	stx     _sia+1
+	lda     _sia
+	ldx     _sia+1
+	cmp     #$58
+	txa
+	sbc     #$02
+	bvc     L0003
+	eor     #$80
+L0003:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$32
+	sta     _sib
+	stx     _sib+1
+L0002:	lda     _sib
+	ldx     _sib+1
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ signed_int_5 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_int_5: near
+
+	.dbg	func, "signed_int_5", "00", extern, "_signed_int_5"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 92
+	ldx     #$F8
+	lda     #$30
+	sta     _sib
+	stx     _sib+1
+	clc
+	ldx     #$02
+	lda     #$58
+	sta     _sia
+	stx     _sia+1
+	lda     _sia
+	ldx     _sia+1
+	cmp     #$E9
+	txa
+	sbc     #$03
+	bvs     L0003
+	eor     #$80
+L0003:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$32
+	sta     _sib
+	stx     _sib+1
+L0002:	lda     _sib
+	ldx     _sib+1
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ signed_int_6 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_int_6: near
+
+	.dbg	func, "signed_int_6", "00", extern, "_signed_int_6"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 92
+	ldx     #$F8
+	lda     #$30
+	sta     _sib
+	stx     _sib+1
+	sec
+	ldx     #$02
+	lda     #$58
+	sta     _sia
+	stx     _sia+1
+	lda     _sia
+	ldx     _sia+1
+	cmp     #$E9
+	txa
+	sbc     #$03
+	bvs     L0003
+	eor     #$80
+L0003:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$32
+	sta     _sib
+	stx     _sib+1
+L0002:	lda     _sib
+	ldx     _sib+1
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ signed_int_7 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_int_7: near
+
+	.dbg	func, "signed_int_7", "00", extern, "_signed_int_7"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 92
+	ldx     #$F8
+	lda     #$30
+	sta     _sib
+	stx     _sib+1
+	clc
+	ldx     #$03
+	lda     #$E8
+	sta     _sia
+	stx     _sia+1
+	lda     _sia
+	ldx     _sia+1
+	cmp     #$59
+	txa
+	sbc     #$02
+	bvs     L0003
+	eor     #$80
+L0003:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$32
+	sta     _sib
+	stx     _sib+1
+L0002:	lda     _sib
+	ldx     _sib+1
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ signed_int_8 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_int_8: near
+
+	.dbg	func, "signed_int_8", "00", extern, "_signed_int_8"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 92
+	ldx     #$F8
+	lda     #$30
+	sta     _sib
+	stx     _sib+1
+	sec
+	ldx     #$03
+	lda     #$E8
+	sta     _sia
+	stx     _sia+1
+	lda     _sia
+	ldx     _sia+1
+	cmp     #$59
+	txa
+	sbc     #$02
+	bvs     L0003
+	eor     #$80
+L0003:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$32
+	sta     _sib
+	stx     _sib+1
+L0002:	lda     _sib
+	ldx     _sib+1
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ signed_int_9 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_int_9: near
+
+	.dbg	func, "signed_int_9", "00", extern, "_signed_int_9"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 92
+	ldx     #$F8
+	lda     #$30
+	sta     _sib
+	stx     _sib+1
+	clc
+	ldx     #$02
+	lda     #$58
+	sta     _sia
+	stx     _sia+1
+	lda     _sia
+	ldx     _sia+1
+	cmp     #$E9
+	txa
+	sbc     #$03
+	bvc     L0003
+	eor     #$80
+L0003:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$32
+	sta     _sib
+	stx     _sib+1
+L0002:	lda     _sib
+	ldx     _sib+1
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ signed_int_10 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_int_10: near
+
+	.dbg	func, "signed_int_10", "00", extern, "_signed_int_10"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 92
+	ldx     #$F8
+	lda     #$30
+	sta     _sib
+	stx     _sib+1
+	sec
+	ldx     #$02
+	lda     #$58
+	sta     _sia
+	stx     _sia+1
+	lda     _sia
+	ldx     _sia+1
+	cmp     #$E9
+	txa
+	sbc     #$03
+	bvc     L0003
+	eor     #$80
+L0003:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$32
+	sta     _sib
+	stx     _sib+1
+L0002:	lda     _sib
+	ldx     _sib+1
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ signed_int_11 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_int_11: near
+
+	.dbg	func, "signed_int_11", "00", extern, "_signed_int_11"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 92
+	ldx     #$F8
+	lda     #$30
+	sta     _sib
+	stx     _sib+1
+	clc
+	ldx     #$03
+	lda     #$E8
+	sta     _sia
+	stx     _sia+1
+	lda     _sia
+	ldx     _sia+1
+	cmp     #$59
+	txa
+	sbc     #$02
+	bvc     L0003
+	eor     #$80
+L0003:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$32
+	sta     _sib
+	stx     _sib+1
+L0002:	lda     _sib
+	ldx     _sib+1
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ signed_int_12 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_int_12: near
+
+	.dbg	func, "signed_int_12", "00", extern, "_signed_int_12"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 92
+	ldx     #$F8
+	lda     #$30
+	sta     _sib
+	stx     _sib+1
+	sec
+	ldx     #$03
+	lda     #$E8
+	sta     _sia
+	stx     _sia+1
+	lda     _sia
+	ldx     _sia+1
+	cmp     #$59
+	txa
+	sbc     #$02
+	bvc     L0003
+	eor     #$80
+L0003:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$32
+	sta     _sib
+	stx     _sib+1
+L0002:	lda     _sib
+	ldx     _sib+1
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ signed_int_13 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_int_13: near
+
+	.dbg	func, "signed_int_13", "00", extern, "_signed_int_13"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 92
+	ldx     #$F8
+	lda     #$30
+	sta     _sib
+	stx     _sib+1
+	clc
+	ldx     #$02
+	lda     #$58
+	sta     _sia
+	stx     _sia+1
+	lda     _sia
+	ldx     _sia+1
+	cmp     #$E8
+	txa
+	sbc     #$03
+	bvs     L0003
+	eor     #$80
+L0003:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$32
+	sta     _sib
+	stx     _sib+1
+L0002:	lda     _sib
+	ldx     _sib+1
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ signed_int_14 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_int_14: near
+
+	.dbg	func, "signed_int_14", "00", extern, "_signed_int_14"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 92
+	ldx     #$F8
+	lda     #$30
+	sta     _sib
+	stx     _sib+1
+	sec
+	ldx     #$02
+	lda     #$58
+	sta     _sia
+	stx     _sia+1
+	lda     _sia
+	ldx     _sia+1
+	cmp     #$E8
+	txa
+	sbc     #$03
+	bvs     L0003
+	eor     #$80
+L0003:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$32
+	sta     _sib
+	stx     _sib+1
+L0002:	lda     _sib
+	ldx     _sib+1
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ signed_int_15 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_int_15: near
+
+	.dbg	func, "signed_int_15", "00", extern, "_signed_int_15"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 92
+	ldx     #$F8
+	lda     #$30
+	sta     _sib
+	stx     _sib+1
+	clc
+	ldx     #$03
+	lda     #$E8
+	sta     _sia
+	stx     _sia+1
+	lda     _sia
+	ldx     _sia+1
+	cmp     #$58
+	txa
+	sbc     #$02
+	bvs     L0003
+	eor     #$80
+L0003:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$32
+	sta     _sib
+	stx     _sib+1
+L0002:	lda     _sib
+	ldx     _sib+1
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ signed_int_16 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_int_16: near
+
+	.dbg	func, "signed_int_16", "00", extern, "_signed_int_16"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 92
+	ldx     #$F8
+	lda     #$30
+	sta     _sib
+	stx     _sib+1
+	sec
+	ldx     #$03
+	lda     #$E8
+	sta     _sia
+	stx     _sia+1
+	lda     _sia
+	ldx     _sia+1
+	cmp     #$58
+	txa
+	sbc     #$02
+	bvs     L0003
+	eor     #$80
+L0003:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$32
+	sta     _sib
+	stx     _sib+1
+L0002:	lda     _sib
+	ldx     _sib+1
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ signed_int_17 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_int_17: near
+
+	.dbg	func, "signed_int_17", "00", extern, "_signed_int_17"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 92
+	ldx     #$F8
+	lda     #$30
+	sta     _sib
+	stx     _sib+1
+	nop
+	ldx     #$02
+	lda     #$58
+	sta     _sia
+	stx     _sia+1
+	lda     _sia
+	ldx     _sia+1
+	cpx     #$03
+	bne     L0003
+	cmp     #$E8
+L0003:	jsr     booleq
+	jeq     L0002
+	ldx     #$00
+	lda     #$32
+	sta     _sib
+	stx     _sib+1
+L0002:	lda     _sib
+	ldx     _sib+1
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ signed_int_18 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_int_18: near
+
+	.dbg	func, "signed_int_18", "00", extern, "_signed_int_18"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 92
+	ldx     #$F8
+	lda     #$30
+	sta     _sib
+	stx     _sib+1
+	nop
+	ldx     #$03
+	lda     #$E8
+	sta     _sia
+	stx     _sia+1
+	lda     _sia
+	ldx     _sia+1
+	cpx     #$03
+	bne     L0003
+	cmp     #$E8
+L0003:	jsr     booleq
+	jeq     L0002
+	ldx     #$00
+	lda     #$32
+	sta     _sib
+	stx     _sib+1
+L0002:	lda     _sib
+	ldx     _sib+1
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ signed_int_19 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_int_19: near
+
+	.dbg	func, "signed_int_19", "00", extern, "_signed_int_19"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 92
+	ldx     #$F8
+	lda     #$30
+	sta     _sib
+	stx     _sib+1
+	nop
+	ldx     #$02
+	lda     #$58
+	sta     _sia
+	stx     _sia+1
+	lda     _sia
+	ldx     _sia+1
+	cpx     #$03
+	bne     L0003
+	cmp     #$E8
+L0003:	jsr     boolne
+	jeq     L0002
+	ldx     #$00
+	lda     #$32
+	sta     _sib
+	stx     _sib+1
+L0002:	lda     _sib
+	ldx     _sib+1
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ signed_int_20 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_int_20: near
+
+	.dbg	func, "signed_int_20", "00", extern, "_signed_int_20"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 92
+	ldx     #$F8
+	lda     #$30
+	sta     _sib
+	stx     _sib+1
+	nop
+	ldx     #$03
+	lda     #$E8
+	sta     _sia
+	stx     _sia+1
+	lda     _sia
+	ldx     _sia+1
+	cpx     #$03
+	bne     L0003
+	cmp     #$E8
+L0003:	jsr     boolne
+	jeq     L0002
+	ldx     #$00
+	lda     #$32
+	sta     _sib
+	stx     _sib+1
+L0002:	lda     _sib
+	ldx     _sib+1
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ signed_int_test (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_int_test: near
+
+	.dbg	func, "signed_int_test", "00", extern, "_signed_int_test"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 92
+	jsr     _signed_int_1
+	cpx     #$00
+	bne     L0003
+	cmp     #$32
+L0003:	jsr     boolne
+	jeq     L0002
+	lda     #<(S00DD)
+	ldx     #>(S00DD)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5C
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S00DE)
+	ldx     #>(S00DE)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S00DF)
+	ldx     #>(S00DF)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S00E0)
+	ldx     #>(S00E0)
+	jsr     pushax
+	jsr     _signed_int_1
+	jsr     pushax
+	ldx     #$00
+	lda     #$32
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0002:	jsr     _signed_int_2
+	cpx     #$00
+	bne     L0005
+	cmp     #$32
+L0005:	jsr     boolne
+	jeq     L0004
+	lda     #<(S00E1)
+	ldx     #>(S00E1)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5C
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S00E2)
+	ldx     #>(S00E2)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S00E3)
+	ldx     #>(S00E3)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S00E4)
+	ldx     #>(S00E4)
+	jsr     pushax
+	jsr     _signed_int_2
+	jsr     pushax
+	ldx     #$00
+	lda     #$32
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0004:	jsr     _signed_int_3
+	cpx     #$F8
+	bne     L0007
+	cmp     #$30
+L0007:	jsr     boolne
+	jeq     L0006
+	lda     #<(S00E5)
+	ldx     #>(S00E5)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5C
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S00E6)
+	ldx     #>(S00E6)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S00E7)
+	ldx     #>(S00E7)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S00E8)
+	ldx     #>(S00E8)
+	jsr     pushax
+	jsr     _signed_int_3
+	jsr     pushax
+	ldx     #$F8
+	lda     #$30
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0006:	jsr     _signed_int_4
+	cpx     #$F8
+	bne     L0009
+	cmp     #$30
+L0009:	jsr     boolne
+	jeq     L0008
+	lda     #<(S00E9)
+	ldx     #>(S00E9)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5C
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S00EA)
+	ldx     #>(S00EA)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S00EB)
+	ldx     #>(S00EB)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S00EC)
+	ldx     #>(S00EC)
+	jsr     pushax
+	jsr     _signed_int_4
+	jsr     pushax
+	ldx     #$F8
+	lda     #$30
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0008:	jsr     _signed_int_5
+	cpx     #$F8
+	bne     L000B
+	cmp     #$30
+L000B:	jsr     boolne
+	jeq     L000A
+	lda     #<(S00ED)
+	ldx     #>(S00ED)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5C
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S00EE)
+	ldx     #>(S00EE)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S00EF)
+	ldx     #>(S00EF)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S00F0)
+	ldx     #>(S00F0)
+	jsr     pushax
+	jsr     _signed_int_5
+	jsr     pushax
+	ldx     #$F8
+	lda     #$30
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L000A:	jsr     _signed_int_6
+	cpx     #$F8
+	bne     L000D
+	cmp     #$30
+L000D:	jsr     boolne
+	jeq     L000C
+	lda     #<(S00F1)
+	ldx     #>(S00F1)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5C
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S00F2)
+	ldx     #>(S00F2)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S00F3)
+	ldx     #>(S00F3)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S00F4)
+	ldx     #>(S00F4)
+	jsr     pushax
+	jsr     _signed_int_6
+	jsr     pushax
+	ldx     #$F8
+	lda     #$30
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L000C:	jsr     _signed_int_7
+	cpx     #$00
+	bne     L000F
+	cmp     #$32
+L000F:	jsr     boolne
+	jeq     L000E
+	lda     #<(S00F5)
+	ldx     #>(S00F5)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5C
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S00F6)
+	ldx     #>(S00F6)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S00F7)
+	ldx     #>(S00F7)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S00F8)
+	ldx     #>(S00F8)
+	jsr     pushax
+	jsr     _signed_int_7
+	jsr     pushax
+	ldx     #$00
+	lda     #$32
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L000E:	jsr     _signed_int_8
+	cpx     #$00
+	bne     L0011
+	cmp     #$32
+L0011:	jsr     boolne
+	jeq     L0010
+	lda     #<(S00F9)
+	ldx     #>(S00F9)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5C
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S00FA)
+	ldx     #>(S00FA)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S00FB)
+	ldx     #>(S00FB)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S00FC)
+	ldx     #>(S00FC)
+	jsr     pushax
+	jsr     _signed_int_8
+	jsr     pushax
+	ldx     #$00
+	lda     #$32
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0010:	jsr     _signed_int_9
+	cpx     #$00
+	bne     L0013
+	cmp     #$32
+L0013:	jsr     boolne
+	jeq     L0012
+	lda     #<(S00FD)
+	ldx     #>(S00FD)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5C
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S00FE)
+	ldx     #>(S00FE)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S00FF)
+	ldx     #>(S00FF)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0100)
+	ldx     #>(S0100)
+	jsr     pushax
+	jsr     _signed_int_9
+	jsr     pushax
+	ldx     #$00
+	lda     #$32
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0012:	jsr     _signed_int_10
+	cpx     #$00
+	bne     L0015
+	cmp     #$32
+L0015:	jsr     boolne
+	jeq     L0014
+	lda     #<(S0101)
+	ldx     #>(S0101)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5C
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0102)
+	ldx     #>(S0102)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0103)
+	ldx     #>(S0103)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0104)
+	ldx     #>(S0104)
+	jsr     pushax
+	jsr     _signed_int_10
+	jsr     pushax
+	ldx     #$00
+	lda     #$32
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0014:	jsr     _signed_int_11
+	cpx     #$F8
+	bne     L0017
+	cmp     #$30
+L0017:	jsr     boolne
+	jeq     L0016
+	lda     #<(S0105)
+	ldx     #>(S0105)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5C
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0106)
+	ldx     #>(S0106)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0107)
+	ldx     #>(S0107)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0108)
+	ldx     #>(S0108)
+	jsr     pushax
+	jsr     _signed_int_11
+	jsr     pushax
+	ldx     #$F8
+	lda     #$30
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0016:	jsr     _signed_int_12
+	cpx     #$F8
+	bne     L0019
+	cmp     #$30
+L0019:	jsr     boolne
+	jeq     L0018
+	lda     #<(S0109)
+	ldx     #>(S0109)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5C
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S010A)
+	ldx     #>(S010A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S010B)
+	ldx     #>(S010B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S010C)
+	ldx     #>(S010C)
+	jsr     pushax
+	jsr     _signed_int_12
+	jsr     pushax
+	ldx     #$F8
+	lda     #$30
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0018:	jsr     _signed_int_13
+	cpx     #$F8
+	bne     L001B
+	cmp     #$30
+L001B:	jsr     boolne
+	jeq     L001A
+	lda     #<(S010D)
+	ldx     #>(S010D)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5C
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S010E)
+	ldx     #>(S010E)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S010F)
+	ldx     #>(S010F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0110)
+	ldx     #>(S0110)
+	jsr     pushax
+	jsr     _signed_int_13
+	jsr     pushax
+	ldx     #$F8
+	lda     #$30
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L001A:	jsr     _signed_int_14
+	cpx     #$F8
+	bne     L001D
+	cmp     #$30
+L001D:	jsr     boolne
+	jeq     L001C
+	lda     #<(S0111)
+	ldx     #>(S0111)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5C
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0112)
+	ldx     #>(S0112)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0113)
+	ldx     #>(S0113)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0114)
+	ldx     #>(S0114)
+	jsr     pushax
+	jsr     _signed_int_14
+	jsr     pushax
+	ldx     #$F8
+	lda     #$30
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L001C:	jsr     _signed_int_15
+	cpx     #$00
+	bne     L001F
+	cmp     #$32
+L001F:	jsr     boolne
+	jeq     L001E
+	lda     #<(S0115)
+	ldx     #>(S0115)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5C
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0116)
+	ldx     #>(S0116)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0117)
+	ldx     #>(S0117)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0118)
+	ldx     #>(S0118)
+	jsr     pushax
+	jsr     _signed_int_15
+	jsr     pushax
+	ldx     #$00
+	lda     #$32
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L001E:	jsr     _signed_int_16
+	cpx     #$00
+	bne     L0021
+	cmp     #$32
+L0021:	jsr     boolne
+	jeq     L0020
+	lda     #<(S0119)
+	ldx     #>(S0119)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5C
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S011A)
+	ldx     #>(S011A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S011B)
+	ldx     #>(S011B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S011C)
+	ldx     #>(S011C)
+	jsr     pushax
+	jsr     _signed_int_16
+	jsr     pushax
+	ldx     #$00
+	lda     #$32
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0020:	jsr     _signed_int_17
+	cpx     #$F8
+	bne     L0023
+	cmp     #$30
+L0023:	jsr     boolne
+	jeq     L0022
+	lda     #<(S011D)
+	ldx     #>(S011D)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5C
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S011E)
+	ldx     #>(S011E)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S011F)
+	ldx     #>(S011F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0120)
+	ldx     #>(S0120)
+	jsr     pushax
+	jsr     _signed_int_17
+	jsr     pushax
+	ldx     #$F8
+	lda     #$30
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0022:	jsr     _signed_int_18
+	cpx     #$00
+	bne     L0025
+	cmp     #$32
+L0025:	jsr     boolne
+	jeq     L0024
+	lda     #<(S0121)
+	ldx     #>(S0121)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5C
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0122)
+	ldx     #>(S0122)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0123)
+	ldx     #>(S0123)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0124)
+	ldx     #>(S0124)
+	jsr     pushax
+	jsr     _signed_int_18
+	jsr     pushax
+	ldx     #$00
+	lda     #$32
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0024:	jsr     _signed_int_19
+	cpx     #$00
+	bne     L0027
+	cmp     #$32
+L0027:	jsr     boolne
+	jeq     L0026
+	lda     #<(S0125)
+	ldx     #>(S0125)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5C
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0126)
+	ldx     #>(S0126)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0127)
+	ldx     #>(S0127)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0128)
+	ldx     #>(S0128)
+	jsr     pushax
+	jsr     _signed_int_19
+	jsr     pushax
+	ldx     #$00
+	lda     #$32
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0026:	jsr     _signed_int_20
+	cpx     #$F8
+	bne     L0029
+	cmp     #$30
+L0029:	jsr     boolne
+	jeq     L0028
+	lda     #<(S0129)
+	ldx     #>(S0129)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5C
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S012A)
+	ldx     #>(S012A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S012B)
+	ldx     #>(S012B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S012C)
+	ldx     #>(S012C)
+	jsr     pushax
+	jsr     _signed_int_20
+	jsr     pushax
+	ldx     #$F8
+	lda     #$30
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0028:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ unsigned_int_1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_int_1: near
+
+	.dbg	func, "unsigned_int_1", "00", extern, "_unsigned_int_1"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 93
+	ldx     #$07
+	lda     #$D0
+	sta     _uib
+	stx     _uib+1
+	clc
+	ldx     #$02
+	lda     #$58
+	sta     _uia
+	stx     _uia+1
+	lda     _uia
+	ldx     _uia+1
+	cpx     #$03
+	bne     L0003
+	cmp     #$E8
+L0003:	jsr     boolult
+	jeq     L0002
+	ldx     #$00
+	lda     #$32
+	sta     _uib
+	stx     _uib+1
+L0002:	lda     _uib
+	ldx     _uib+1
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ unsigned_int_2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_int_2: near
+
+	.dbg	func, "unsigned_int_2", "00", extern, "_unsigned_int_2"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 93
+	ldx     #$07
+	lda     #$D0
+	sta     _uib
+	stx     _uib+1
+	sec
+	ldx     #$02
+	lda     #$58
+	sta     _uia
+	stx     _uia+1
+	lda     _uia
+	ldx     _uia+1
+	cpx     #$03
+	bne     L0003
+	cmp     #$E8
+L0003:	jsr     boolult
+	jeq     L0002
+	ldx     #$00
+	lda     #$32
+	sta     _uib
+	stx     _uib+1
+L0002:	lda     _uib
+	ldx     _uib+1
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ unsigned_int_3 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_int_3: near
+
+	.dbg	func, "unsigned_int_3", "00", extern, "_unsigned_int_3"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 93
+	ldx     #$07
+	lda     #$D0
+	sta     _uib
+	stx     _uib+1
+	clc
+	ldx     #$03
+	lda     #$E8
+	sta     _uia
+	stx     _uia+1
+	lda     _uia
+	ldx     _uia+1
+	cpx     #$02
+	bne     L0003
+	cmp     #$58
+L0003:	jsr     boolult
+	jeq     L0002
+	ldx     #$00
+	lda     #$32
+	sta     _uib
+	stx     _uib+1
+L0002:	lda     _uib
+	ldx     _uib+1
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ unsigned_int_4 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_int_4: near
+
+	.dbg	func, "unsigned_int_4", "00", extern, "_unsigned_int_4"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 93
+	ldx     #$07
+	lda     #$D0
+	sta     _uib
+	stx     _uib+1
+	sec
+	ldx     #$03
+	lda     #$E8
+	sta     _uia
+	stx     _uia+1
+	lda     _uia
+	ldx     _uia+1
+	cpx     #$02
+	bne     L0003
+	cmp     #$58
+L0003:	jsr     boolult
+	jeq     L0002
+	ldx     #$00
+	lda     #$32
+	sta     _uib
+	stx     _uib+1
+L0002:	lda     _uib
+	ldx     _uib+1
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ unsigned_int_5 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_int_5: near
+
+	.dbg	func, "unsigned_int_5", "00", extern, "_unsigned_int_5"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 93
+	ldx     #$07
+	lda     #$D0
+	sta     _uib
+	stx     _uib+1
+	clc
+	ldx     #$02
+	lda     #$58
+	sta     _uia
+	stx     _uia+1
+	lda     _uia
+	ldx     _uia+1
+	cmp     #$E9
+	txa
+	sbc     #$03
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$32
+	sta     _uib
+	stx     _uib+1
+L0002:	lda     _uib
+	ldx     _uib+1
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ unsigned_int_6 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_int_6: near
+
+	.dbg	func, "unsigned_int_6", "00", extern, "_unsigned_int_6"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 93
+	ldx     #$07
+	lda     #$D0
+	sta     _uib
+	stx     _uib+1
+	sec
+	ldx     #$02
+	lda     #$58
+	sta     _uia
+	stx     _uia+1
+	lda     _uia
+	ldx     _uia+1
+	cmp     #$E9
+	txa
+	sbc     #$03
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$32
+	sta     _uib
+	stx     _uib+1
+L0002:	lda     _uib
+	ldx     _uib+1
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ unsigned_int_7 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_int_7: near
+
+	.dbg	func, "unsigned_int_7", "00", extern, "_unsigned_int_7"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 93
+	ldx     #$07
+	lda     #$D0
+	sta     _uib
+	stx     _uib+1
+	clc
+	ldx     #$03
+	lda     #$E8
+	sta     _uia
+	stx     _uia+1
+	lda     _uia
+	ldx     _uia+1
+	cmp     #$59
+	txa
+	sbc     #$02
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$32
+	sta     _uib
+	stx     _uib+1
+L0002:	lda     _uib
+	ldx     _uib+1
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ unsigned_int_8 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_int_8: near
+
+	.dbg	func, "unsigned_int_8", "00", extern, "_unsigned_int_8"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 93
+	ldx     #$07
+	lda     #$D0
+	sta     _uib
+	stx     _uib+1
+	sec
+	ldx     #$03
+	lda     #$E8
+	sta     _uia
+	stx     _uia+1
+	lda     _uia
+	ldx     _uia+1
+	cmp     #$59
+	txa
+	sbc     #$02
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$32
+	sta     _uib
+	stx     _uib+1
+L0002:	lda     _uib
+	ldx     _uib+1
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ unsigned_int_9 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_int_9: near
+
+	.dbg	func, "unsigned_int_9", "00", extern, "_unsigned_int_9"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 93
+	ldx     #$07
+	lda     #$D0
+	sta     _uib
+	stx     _uib+1
+	clc
+	ldx     #$02
+	lda     #$58
+	sta     _uia
+	stx     _uia+1
+	lda     _uia
+	ldx     _uia+1
+	cpx     #$03
+	bne     L0003
+	cmp     #$E9
+L0003:	jsr     boolult
+	jeq     L0002
+	ldx     #$00
+	lda     #$32
+	sta     _uib
+	stx     _uib+1
+L0002:	lda     _uib
+	ldx     _uib+1
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ unsigned_int_10 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_int_10: near
+
+	.dbg	func, "unsigned_int_10", "00", extern, "_unsigned_int_10"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 93
+	ldx     #$07
+	lda     #$D0
+	sta     _uib
+	stx     _uib+1
+	sec
+	ldx     #$02
+	lda     #$58
+	sta     _uia
+	stx     _uia+1
+	lda     _uia
+	ldx     _uia+1
+	cpx     #$03
+	bne     L0003
+	cmp     #$E9
+L0003:	jsr     boolult
+	jeq     L0002
+	ldx     #$00
+	lda     #$32
+	sta     _uib
+	stx     _uib+1
+L0002:	lda     _uib
+	ldx     _uib+1
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ unsigned_int_11 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_int_11: near
+
+	.dbg	func, "unsigned_int_11", "00", extern, "_unsigned_int_11"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 93
+	ldx     #$07
+	lda     #$D0
+	sta     _uib
+	stx     _uib+1
+	clc
+	ldx     #$03
+	lda     #$E8
+	sta     _uia
+	stx     _uia+1
+	lda     _uia
+	ldx     _uia+1
+	cpx     #$02
+	bne     L0003
+	cmp     #$59
+L0003:	jsr     boolult
+	jeq     L0002
+	ldx     #$00
+	lda     #$32
+	sta     _uib
+	stx     _uib+1
+L0002:	lda     _uib
+	ldx     _uib+1
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ unsigned_int_12 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_int_12: near
+
+	.dbg	func, "unsigned_int_12", "00", extern, "_unsigned_int_12"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 93
+	ldx     #$07
+	lda     #$D0
+	sta     _uib
+	stx     _uib+1
+	sec
+	ldx     #$03
+	lda     #$E8
+	sta     _uia
+	stx     _uia+1
+	lda     _uia
+	ldx     _uia+1
+	cpx     #$02
+	bne     L0003
+	cmp     #$59
+L0003:	jsr     boolult
+	jeq     L0002
+	ldx     #$00
+	lda     #$32
+	sta     _uib
+	stx     _uib+1
+L0002:	lda     _uib
+	ldx     _uib+1
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ unsigned_int_13 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_int_13: near
+
+	.dbg	func, "unsigned_int_13", "00", extern, "_unsigned_int_13"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 93
+	ldx     #$07
+	lda     #$D0
+	sta     _uib
+	stx     _uib+1
+	clc
+	ldx     #$02
+	lda     #$58
+	sta     _uia
+	stx     _uia+1
+	lda     _uia
+	ldx     _uia+1
+	cmp     #$E8
+	txa
+	sbc     #$03
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$32
+	sta     _uib
+	stx     _uib+1
+L0002:	lda     _uib
+	ldx     _uib+1
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ unsigned_int_14 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_int_14: near
+
+	.dbg	func, "unsigned_int_14", "00", extern, "_unsigned_int_14"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 93
+	ldx     #$07
+	lda     #$D0
+	sta     _uib
+	stx     _uib+1
+	sec
+	ldx     #$02
+	lda     #$58
+	sta     _uia
+	stx     _uia+1
+	lda     _uia
+	ldx     _uia+1
+	cmp     #$E8
+	txa
+	sbc     #$03
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$32
+	sta     _uib
+	stx     _uib+1
+L0002:	lda     _uib
+	ldx     _uib+1
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ unsigned_int_15 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_int_15: near
+
+	.dbg	func, "unsigned_int_15", "00", extern, "_unsigned_int_15"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 93
+	ldx     #$07
+	lda     #$D0
+	sta     _uib
+	stx     _uib+1
+	clc
+	ldx     #$03
+	lda     #$E8
+	sta     _uia
+	stx     _uia+1
+	lda     _uia
+	ldx     _uia+1
+	cmp     #$58
+	txa
+	sbc     #$02
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$32
+	sta     _uib
+	stx     _uib+1
+L0002:	lda     _uib
+	ldx     _uib+1
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ unsigned_int_16 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_int_16: near
+
+	.dbg	func, "unsigned_int_16", "00", extern, "_unsigned_int_16"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 93
+	ldx     #$07
+	lda     #$D0
+	sta     _uib
+	stx     _uib+1
+	sec
+	ldx     #$03
+	lda     #$E8
+	sta     _uia
+	stx     _uia+1
+	lda     _uia
+	ldx     _uia+1
+	cmp     #$58
+	txa
+	sbc     #$02
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$00
+	lda     #$32
+	sta     _uib
+	stx     _uib+1
+L0002:	lda     _uib
+	ldx     _uib+1
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ unsigned_int_17 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_int_17: near
+
+	.dbg	func, "unsigned_int_17", "00", extern, "_unsigned_int_17"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 93
+	ldx     #$07
+	lda     #$D0
+	sta     _uib
+	stx     _uib+1
+	nop
+	ldx     #$02
+	lda     #$58
+	sta     _uia
+	stx     _uia+1
+	lda     _uia
+	ldx     _uia+1
+	cpx     #$03
+	bne     L0003
+	cmp     #$E8
+L0003:	jsr     booleq
+	jeq     L0002
+	ldx     #$00
+	lda     #$32
+	sta     _uib
+	stx     _uib+1
+L0002:	lda     _uib
+	ldx     _uib+1
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ unsigned_int_18 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_int_18: near
+
+	.dbg	func, "unsigned_int_18", "00", extern, "_unsigned_int_18"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 93
+	ldx     #$07
+	lda     #$D0
+	sta     _uib
+	stx     _uib+1
+	nop
+	ldx     #$03
+	lda     #$E8
+	sta     _uia
+	stx     _uia+1
+	lda     _uia
+	ldx     _uia+1
+	cpx     #$03
+	bne     L0003
+	cmp     #$E8
+L0003:	jsr     booleq
+	jeq     L0002
+	ldx     #$00
+	lda     #$32
+	sta     _uib
+	stx     _uib+1
+L0002:	lda     _uib
+	ldx     _uib+1
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ unsigned_int_19 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_int_19: near
+
+	.dbg	func, "unsigned_int_19", "00", extern, "_unsigned_int_19"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 93
+	ldx     #$07
+	lda     #$D0
+	sta     _uib
+	stx     _uib+1
+	nop
+	ldx     #$02
+	lda     #$58
+	sta     _uia
+	stx     _uia+1
+	lda     _uia
+	ldx     _uia+1
+	cpx     #$03
+	bne     L0003
+	cmp     #$E8
+L0003:	jsr     boolne
+	jeq     L0002
+	ldx     #$00
+	lda     #$32
+	sta     _uib
+	stx     _uib+1
+L0002:	lda     _uib
+	ldx     _uib+1
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ unsigned_int_20 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_int_20: near
+
+	.dbg	func, "unsigned_int_20", "00", extern, "_unsigned_int_20"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 93
+	ldx     #$07
+	lda     #$D0
+	sta     _uib
+	stx     _uib+1
+	nop
+	ldx     #$03
+	lda     #$E8
+	sta     _uia
+	stx     _uia+1
+	lda     _uia
+	ldx     _uia+1
+	cpx     #$03
+	bne     L0003
+	cmp     #$E8
+L0003:	jsr     boolne
+	jeq     L0002
+	ldx     #$00
+	lda     #$32
+	sta     _uib
+	stx     _uib+1
+L0002:	lda     _uib
+	ldx     _uib+1
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ unsigned_int_test (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_int_test: near
+
+	.dbg	func, "unsigned_int_test", "00", extern, "_unsigned_int_test"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 93
+	jsr     _unsigned_int_1
+	cpx     #$00
+	bne     L0003
+	cmp     #$32
+L0003:	jsr     boolne
+	jeq     L0002
+	lda     #<(S0141)
+	ldx     #>(S0141)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5D
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0142)
+	ldx     #>(S0142)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0143)
+	ldx     #>(S0143)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0144)
+	ldx     #>(S0144)
+	jsr     pushax
+	jsr     _unsigned_int_1
+	jsr     pushax
+	ldx     #$00
+	lda     #$32
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0002:	jsr     _unsigned_int_2
+	cpx     #$00
+	bne     L0005
+	cmp     #$32
+L0005:	jsr     boolne
+	jeq     L0004
+	lda     #<(S0145)
+	ldx     #>(S0145)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5D
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0146)
+	ldx     #>(S0146)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0147)
+	ldx     #>(S0147)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0148)
+	ldx     #>(S0148)
+	jsr     pushax
+	jsr     _unsigned_int_2
+	jsr     pushax
+	ldx     #$00
+	lda     #$32
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0004:	jsr     _unsigned_int_3
+	cpx     #$07
+	bne     L0007
+	cmp     #$D0
+L0007:	jsr     boolne
+	jeq     L0006
+	lda     #<(S0149)
+	ldx     #>(S0149)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5D
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S014A)
+	ldx     #>(S014A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S014B)
+	ldx     #>(S014B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S014C)
+	ldx     #>(S014C)
+	jsr     pushax
+	jsr     _unsigned_int_3
+	jsr     pushax
+	ldx     #$07
+	lda     #$D0
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0006:	jsr     _unsigned_int_4
+	cpx     #$07
+	bne     L0009
+	cmp     #$D0
+L0009:	jsr     boolne
+	jeq     L0008
+	lda     #<(S014D)
+	ldx     #>(S014D)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5D
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S014E)
+	ldx     #>(S014E)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S014F)
+	ldx     #>(S014F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0150)
+	ldx     #>(S0150)
+	jsr     pushax
+	jsr     _unsigned_int_4
+	jsr     pushax
+	ldx     #$07
+	lda     #$D0
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0008:	jsr     _unsigned_int_5
+	cpx     #$07
+	bne     L000B
+	cmp     #$D0
+L000B:	jsr     boolne
+	jeq     L000A
+	lda     #<(S0151)
+	ldx     #>(S0151)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5D
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0152)
+	ldx     #>(S0152)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0153)
+	ldx     #>(S0153)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0154)
+	ldx     #>(S0154)
+	jsr     pushax
+	jsr     _unsigned_int_5
+	jsr     pushax
+	ldx     #$07
+	lda     #$D0
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L000A:	jsr     _unsigned_int_6
+	cpx     #$07
+	bne     L000D
+	cmp     #$D0
+L000D:	jsr     boolne
+	jeq     L000C
+	lda     #<(S0155)
+	ldx     #>(S0155)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5D
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0156)
+	ldx     #>(S0156)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0157)
+	ldx     #>(S0157)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0158)
+	ldx     #>(S0158)
+	jsr     pushax
+	jsr     _unsigned_int_6
+	jsr     pushax
+	ldx     #$07
+	lda     #$D0
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L000C:	jsr     _unsigned_int_7
+	cpx     #$00
+	bne     L000F
+	cmp     #$32
+L000F:	jsr     boolne
+	jeq     L000E
+	lda     #<(S0159)
+	ldx     #>(S0159)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5D
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S015A)
+	ldx     #>(S015A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S015B)
+	ldx     #>(S015B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S015C)
+	ldx     #>(S015C)
+	jsr     pushax
+	jsr     _unsigned_int_7
+	jsr     pushax
+	ldx     #$00
+	lda     #$32
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L000E:	jsr     _unsigned_int_8
+	cpx     #$00
+	bne     L0011
+	cmp     #$32
+L0011:	jsr     boolne
+	jeq     L0010
+	lda     #<(S015D)
+	ldx     #>(S015D)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5D
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S015E)
+	ldx     #>(S015E)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S015F)
+	ldx     #>(S015F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0160)
+	ldx     #>(S0160)
+	jsr     pushax
+	jsr     _unsigned_int_8
+	jsr     pushax
+	ldx     #$00
+	lda     #$32
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0010:	jsr     _unsigned_int_9
+	cpx     #$00
+	bne     L0013
+	cmp     #$32
+L0013:	jsr     boolne
+	jeq     L0012
+	lda     #<(S0161)
+	ldx     #>(S0161)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5D
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0162)
+	ldx     #>(S0162)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0163)
+	ldx     #>(S0163)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0164)
+	ldx     #>(S0164)
+	jsr     pushax
+	jsr     _unsigned_int_9
+	jsr     pushax
+	ldx     #$00
+	lda     #$32
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0012:	jsr     _unsigned_int_10
+	cpx     #$00
+	bne     L0015
+	cmp     #$32
+L0015:	jsr     boolne
+	jeq     L0014
+	lda     #<(S0165)
+	ldx     #>(S0165)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5D
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0166)
+	ldx     #>(S0166)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0167)
+	ldx     #>(S0167)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0168)
+	ldx     #>(S0168)
+	jsr     pushax
+	jsr     _unsigned_int_10
+	jsr     pushax
+	ldx     #$00
+	lda     #$32
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0014:	jsr     _unsigned_int_11
+	cpx     #$07
+	bne     L0017
+	cmp     #$D0
+L0017:	jsr     boolne
+	jeq     L0016
+	lda     #<(S0169)
+	ldx     #>(S0169)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5D
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S016A)
+	ldx     #>(S016A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S016B)
+	ldx     #>(S016B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S016C)
+	ldx     #>(S016C)
+	jsr     pushax
+	jsr     _unsigned_int_11
+	jsr     pushax
+	ldx     #$07
+	lda     #$D0
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0016:	jsr     _unsigned_int_12
+	cpx     #$07
+	bne     L0019
+	cmp     #$D0
+L0019:	jsr     boolne
+	jeq     L0018
+	lda     #<(S016D)
+	ldx     #>(S016D)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5D
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S016E)
+	ldx     #>(S016E)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S016F)
+	ldx     #>(S016F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0170)
+	ldx     #>(S0170)
+	jsr     pushax
+	jsr     _unsigned_int_12
+	jsr     pushax
+	ldx     #$07
+	lda     #$D0
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0018:	jsr     _unsigned_int_13
+	cpx     #$07
+	bne     L001B
+	cmp     #$D0
+L001B:	jsr     boolne
+	jeq     L001A
+	lda     #<(S0171)
+	ldx     #>(S0171)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5D
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0172)
+	ldx     #>(S0172)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0173)
+	ldx     #>(S0173)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0174)
+	ldx     #>(S0174)
+	jsr     pushax
+	jsr     _unsigned_int_13
+	jsr     pushax
+	ldx     #$07
+	lda     #$D0
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L001A:	jsr     _unsigned_int_14
+	cpx     #$07
+	bne     L001D
+	cmp     #$D0
+L001D:	jsr     boolne
+	jeq     L001C
+	lda     #<(S0175)
+	ldx     #>(S0175)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5D
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0176)
+	ldx     #>(S0176)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0177)
+	ldx     #>(S0177)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0178)
+	ldx     #>(S0178)
+	jsr     pushax
+	jsr     _unsigned_int_14
+	jsr     pushax
+	ldx     #$07
+	lda     #$D0
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L001C:	jsr     _unsigned_int_15
+	cpx     #$00
+	bne     L001F
+	cmp     #$32
+L001F:	jsr     boolne
+	jeq     L001E
+	lda     #<(S0179)
+	ldx     #>(S0179)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5D
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S017A)
+	ldx     #>(S017A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S017B)
+	ldx     #>(S017B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S017C)
+	ldx     #>(S017C)
+	jsr     pushax
+	jsr     _unsigned_int_15
+	jsr     pushax
+	ldx     #$00
+	lda     #$32
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L001E:	jsr     _unsigned_int_16
+	cpx     #$00
+	bne     L0021
+	cmp     #$32
+L0021:	jsr     boolne
+	jeq     L0020
+	lda     #<(S017D)
+	ldx     #>(S017D)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5D
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S017E)
+	ldx     #>(S017E)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S017F)
+	ldx     #>(S017F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0180)
+	ldx     #>(S0180)
+	jsr     pushax
+	jsr     _unsigned_int_16
+	jsr     pushax
+	ldx     #$00
+	lda     #$32
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0020:	jsr     _unsigned_int_17
+	cpx     #$07
+	bne     L0023
+	cmp     #$D0
+L0023:	jsr     boolne
+	jeq     L0022
+	lda     #<(S0181)
+	ldx     #>(S0181)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5D
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0182)
+	ldx     #>(S0182)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0183)
+	ldx     #>(S0183)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0184)
+	ldx     #>(S0184)
+	jsr     pushax
+	jsr     _unsigned_int_17
+	jsr     pushax
+	ldx     #$07
+	lda     #$D0
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0022:	jsr     _unsigned_int_18
+	cpx     #$00
+	bne     L0025
+	cmp     #$32
+L0025:	jsr     boolne
+	jeq     L0024
+	lda     #<(S0185)
+	ldx     #>(S0185)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5D
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0186)
+	ldx     #>(S0186)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0187)
+	ldx     #>(S0187)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0188)
+	ldx     #>(S0188)
+	jsr     pushax
+	jsr     _unsigned_int_18
+	jsr     pushax
+	ldx     #$00
+	lda     #$32
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0024:	jsr     _unsigned_int_19
+	cpx     #$00
+	bne     L0027
+	cmp     #$32
+L0027:	jsr     boolne
+	jeq     L0026
+	lda     #<(S0189)
+	ldx     #>(S0189)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5D
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S018A)
+	ldx     #>(S018A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S018B)
+	ldx     #>(S018B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S018C)
+	ldx     #>(S018C)
+	jsr     pushax
+	jsr     _unsigned_int_19
+	jsr     pushax
+	ldx     #$00
+	lda     #$32
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0026:	jsr     _unsigned_int_20
+	cpx     #$07
+	bne     L0029
+	cmp     #$D0
+L0029:	jsr     boolne
+	jeq     L0028
+	lda     #<(S018D)
+	ldx     #>(S018D)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5D
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S018E)
+	ldx     #>(S018E)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S018F)
+	ldx     #>(S018F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0190)
+	ldx     #>(S0190)
+	jsr     pushax
+	jsr     _unsigned_int_20
+	jsr     pushax
+	ldx     #$07
+	lda     #$D0
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0028:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; long __near__ signed_long_1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_long_1: near
+
+	.dbg	func, "signed_long_1", "00", extern, "_signed_long_1"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 94
+	ldx     #$F2
+	lda     #$FC
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$C0
+	sta     _slb
+	stx     _slb+1
+	ldy     sreg
+	sty     _slb+2
+	ldy     sreg+1
+	sty     _slb+3
+	clc
+	ldx     #$EA
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$60
+	sta     _sla
+	stx     _sla+1
+	ldy     sreg
+	sty     _sla+2
+	ldy     sreg+1
+	sty     _sla+3
+	lda     _sla+3
+	sta     sreg+1
+	lda     _sla+2
+	sta     sreg
+	ldx     _sla+1
+	lda     _sla
+	jsr     pusheax
+	ldx     #$86
+	lda     #$01
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$A0
+	jsr     toslteax
+	jeq     L0002
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	sta     _slb
+	stx     _slb+1
+	ldy     sreg
+	sty     _slb+2
+	ldy     sreg+1
+	sty     _slb+3
+L0002:	lda     _slb+3
+	sta     sreg+1
+	lda     _slb+2
+	sta     sreg
+	ldx     _slb+1
+	lda     _slb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; long __near__ signed_long_2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_long_2: near
+
+	.dbg	func, "signed_long_2", "00", extern, "_signed_long_2"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 94
+	ldx     #$F2
+	lda     #$FC
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$C0
+	sta     _slb
+	stx     _slb+1
+	ldy     sreg
+	sty     _slb+2
+	ldy     sreg+1
+	sty     _slb+3
+	sec
+	ldx     #$EA
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$60
+	sta     _sla
+	stx     _sla+1
+	ldy     sreg
+	sty     _sla+2
+	ldy     sreg+1
+	sty     _sla+3
+	lda     _sla+3
+	sta     sreg+1
+	lda     _sla+2
+	sta     sreg
+	ldx     _sla+1
+	lda     _sla
+	jsr     pusheax
+	ldx     #$86
+	lda     #$01
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$A0
+	jsr     toslteax
+	jeq     L0002
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	sta     _slb
+	stx     _slb+1
+	ldy     sreg
+	sty     _slb+2
+	ldy     sreg+1
+	sty     _slb+3
+L0002:	lda     _slb+3
+	sta     sreg+1
+	lda     _slb+2
+	sta     sreg
+	ldx     _slb+1
+	lda     _slb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; long __near__ signed_long_3 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_long_3: near
+
+	.dbg	func, "signed_long_3", "00", extern, "_signed_long_3"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 94
+	ldx     #$F2
+	lda     #$FC
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$C0
+	sta     _slb
+	stx     _slb+1
+	ldy     sreg
+	sty     _slb+2
+	ldy     sreg+1
+	sty     _slb+3
+	clc
+	ldx     #$86
+	lda     #$01
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$A0
+	sta     _sla
+	stx     _sla+1
+	ldy     sreg
+	sty     _sla+2
+	ldy     sreg+1
+	sty     _sla+3
+	lda     _sla+3
+	sta     sreg+1
+	lda     _sla+2
+	sta     sreg
+	ldx     _sla+1
+	lda     _sla
+	jsr     pusheax
+	ldx     #$EA
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$60
+	jsr     toslteax
+	jeq     L0002
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	sta     _slb
+	stx     _slb+1
+	ldy     sreg
+	sty     _slb+2
+	ldy     sreg+1
+	sty     _slb+3
+L0002:	lda     _slb+3
+	sta     sreg+1
+	lda     _slb+2
+	sta     sreg
+	ldx     _slb+1
+	lda     _slb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; long __near__ signed_long_4 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_long_4: near
+
+	.dbg	func, "signed_long_4", "00", extern, "_signed_long_4"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 94
+	ldx     #$F2
+	lda     #$FC
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$C0
+	sta     _slb
+	stx     _slb+1
+	ldy     sreg
+	sty     _slb+2
+	ldy     sreg+1
+	sty     _slb+3
+	sec
+	ldx     #$86
+	lda     #$01
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$A0
+	sta     _sla
+	stx     _sla+1
+	ldy     sreg
+	sty     _sla+2
+	ldy     sreg+1
+	sty     _sla+3
+	lda     _sla+3
+	sta     sreg+1
+	lda     _sla+2
+	sta     sreg
+	ldx     _sla+1
+	lda     _sla
+	jsr     pusheax
+	ldx     #$EA
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$60
+	jsr     toslteax
+	jeq     L0002
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	sta     _slb
+	stx     _slb+1
+	ldy     sreg
+	sty     _slb+2
+	ldy     sreg+1
+	sty     _slb+3
+L0002:	lda     _slb+3
+	sta     sreg+1
+	lda     _slb+2
+	sta     sreg
+	ldx     _slb+1
+	lda     _slb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; long __near__ signed_long_5 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_long_5: near
+
+	.dbg	func, "signed_long_5", "00", extern, "_signed_long_5"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 94
+	ldx     #$F2
+	lda     #$FC
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$C0
+	sta     _slb
+	stx     _slb+1
+	ldy     sreg
+	sty     _slb+2
+	ldy     sreg+1
+	sty     _slb+3
+	clc
+	ldx     #$EA
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$60
+	sta     _sla
+	stx     _sla+1
+	ldy     sreg
+	sty     _sla+2
+	ldy     sreg+1
+	sty     _sla+3
+	lda     _sla+3
+	sta     sreg+1
+	lda     _sla+2
+	sta     sreg
+	ldx     _sla+1
+	lda     _sla
+	jsr     pusheax
+	ldx     #$86
+	lda     #$01
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$A1
+	jsr     tosgeeax
+	jeq     L0002
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	sta     _slb
+	stx     _slb+1
+	ldy     sreg
+	sty     _slb+2
+	ldy     sreg+1
+	sty     _slb+3
+L0002:	lda     _slb+3
+	sta     sreg+1
+	lda     _slb+2
+	sta     sreg
+	ldx     _slb+1
+	lda     _slb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; long __near__ signed_long_6 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_long_6: near
+
+	.dbg	func, "signed_long_6", "00", extern, "_signed_long_6"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 94
+	ldx     #$F2
+	lda     #$FC
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$C0
+	sta     _slb
+	stx     _slb+1
+	ldy     sreg
+	sty     _slb+2
+	ldy     sreg+1
+	sty     _slb+3
+	sec
+	ldx     #$EA
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$60
+	sta     _sla
+	stx     _sla+1
+	ldy     sreg
+	sty     _sla+2
+	ldy     sreg+1
+	sty     _sla+3
+	lda     _sla+3
+	sta     sreg+1
+	lda     _sla+2
+	sta     sreg
+	ldx     _sla+1
+	lda     _sla
+	jsr     pusheax
+	ldx     #$86
+	lda     #$01
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$A1
+	jsr     tosgeeax
+	jeq     L0002
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	sta     _slb
+	stx     _slb+1
+	ldy     sreg
+	sty     _slb+2
+	ldy     sreg+1
+	sty     _slb+3
+L0002:	lda     _slb+3
+	sta     sreg+1
+	lda     _slb+2
+	sta     sreg
+	ldx     _slb+1
+	lda     _slb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; long __near__ signed_long_7 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_long_7: near
+
+	.dbg	func, "signed_long_7", "00", extern, "_signed_long_7"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 94
+	ldx     #$F2
+	lda     #$FC
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$C0
+	sta     _slb
+	stx     _slb+1
+	ldy     sreg
+	sty     _slb+2
+	ldy     sreg+1
+	sty     _slb+3
+	clc
+	ldx     #$86
+	lda     #$01
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$A0
+	sta     _sla
+	stx     _sla+1
+	ldy     sreg
+	sty     _sla+2
+	ldy     sreg+1
+	sty     _sla+3
+	lda     _sla+3
+	sta     sreg+1
+	lda     _sla+2
+	sta     sreg
+	ldx     _sla+1
+	lda     _sla
+	jsr     pusheax
+	ldx     #$EA
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$61
+	jsr     tosgeeax
+	jeq     L0002
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	sta     _slb
+	stx     _slb+1
+	ldy     sreg
+	sty     _slb+2
+	ldy     sreg+1
+	sty     _slb+3
+L0002:	lda     _slb+3
+	sta     sreg+1
+	lda     _slb+2
+	sta     sreg
+	ldx     _slb+1
+	lda     _slb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; long __near__ signed_long_8 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_long_8: near
+
+	.dbg	func, "signed_long_8", "00", extern, "_signed_long_8"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 94
+	ldx     #$F2
+	lda     #$FC
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$C0
+	sta     _slb
+	stx     _slb+1
+	ldy     sreg
+	sty     _slb+2
+	ldy     sreg+1
+	sty     _slb+3
+	sec
+	ldx     #$86
+	lda     #$01
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$A0
+	sta     _sla
+	stx     _sla+1
+	ldy     sreg
+	sty     _sla+2
+	ldy     sreg+1
+	sty     _sla+3
+	lda     _sla+3
+	sta     sreg+1
+	lda     _sla+2
+	sta     sreg
+	ldx     _sla+1
+	lda     _sla
+	jsr     pusheax
+	ldx     #$EA
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$61
+	jsr     tosgeeax
+	jeq     L0002
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	sta     _slb
+	stx     _slb+1
+	ldy     sreg
+	sty     _slb+2
+	ldy     sreg+1
+	sty     _slb+3
+L0002:	lda     _slb+3
+	sta     sreg+1
+	lda     _slb+2
+	sta     sreg
+	ldx     _slb+1
+	lda     _slb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; long __near__ signed_long_9 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_long_9: near
+
+	.dbg	func, "signed_long_9", "00", extern, "_signed_long_9"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 94
+	ldx     #$F2
+	lda     #$FC
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$C0
+	sta     _slb
+	stx     _slb+1
+	ldy     sreg
+	sty     _slb+2
+	ldy     sreg+1
+	sty     _slb+3
+	clc
+	ldx     #$EA
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$60
+	sta     _sla
+	stx     _sla+1
+	ldy     sreg
+	sty     _sla+2
+	ldy     sreg+1
+	sty     _sla+3
+	lda     _sla+3
+	sta     sreg+1
+	lda     _sla+2
+	sta     sreg
+	ldx     _sla+1
+	lda     _sla
+	jsr     pusheax
+	ldx     #$86
+	lda     #$01
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$A1
+	jsr     toslteax
+	jeq     L0002
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	sta     _slb
+	stx     _slb+1
+	ldy     sreg
+	sty     _slb+2
+	ldy     sreg+1
+	sty     _slb+3
+L0002:	lda     _slb+3
+	sta     sreg+1
+	lda     _slb+2
+	sta     sreg
+	ldx     _slb+1
+	lda     _slb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; long __near__ signed_long_10 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_long_10: near
+
+	.dbg	func, "signed_long_10", "00", extern, "_signed_long_10"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 94
+	ldx     #$F2
+	lda     #$FC
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$C0
+	sta     _slb
+	stx     _slb+1
+	ldy     sreg
+	sty     _slb+2
+	ldy     sreg+1
+	sty     _slb+3
+	sec
+	ldx     #$EA
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$60
+	sta     _sla
+	stx     _sla+1
+	ldy     sreg
+	sty     _sla+2
+	ldy     sreg+1
+	sty     _sla+3
+	lda     _sla+3
+	sta     sreg+1
+	lda     _sla+2
+	sta     sreg
+	ldx     _sla+1
+	lda     _sla
+	jsr     pusheax
+	ldx     #$86
+	lda     #$01
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$A1
+	jsr     toslteax
+	jeq     L0002
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	sta     _slb
+	stx     _slb+1
+	ldy     sreg
+	sty     _slb+2
+	ldy     sreg+1
+	sty     _slb+3
+L0002:	lda     _slb+3
+	sta     sreg+1
+	lda     _slb+2
+	sta     sreg
+	ldx     _slb+1
+	lda     _slb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; long __near__ signed_long_11 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_long_11: near
+
+	.dbg	func, "signed_long_11", "00", extern, "_signed_long_11"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 94
+	ldx     #$F2
+	lda     #$FC
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$C0
+	sta     _slb
+	stx     _slb+1
+	ldy     sreg
+	sty     _slb+2
+	ldy     sreg+1
+	sty     _slb+3
+	clc
+	ldx     #$86
+	lda     #$01
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$A0
+	sta     _sla
+	stx     _sla+1
+	ldy     sreg
+	sty     _sla+2
+	ldy     sreg+1
+	sty     _sla+3
+	lda     _sla+3
+	sta     sreg+1
+	lda     _sla+2
+	sta     sreg
+	ldx     _sla+1
+	lda     _sla
+	jsr     pusheax
+	ldx     #$EA
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$61
+	jsr     toslteax
+	jeq     L0002
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	sta     _slb
+	stx     _slb+1
+	ldy     sreg
+	sty     _slb+2
+	ldy     sreg+1
+	sty     _slb+3
+L0002:	lda     _slb+3
+	sta     sreg+1
+	lda     _slb+2
+	sta     sreg
+	ldx     _slb+1
+	lda     _slb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; long __near__ signed_long_12 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_long_12: near
+
+	.dbg	func, "signed_long_12", "00", extern, "_signed_long_12"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 94
+	ldx     #$F2
+	lda     #$FC
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$C0
+	sta     _slb
+	stx     _slb+1
+	ldy     sreg
+	sty     _slb+2
+	ldy     sreg+1
+	sty     _slb+3
+	sec
+	ldx     #$86
+	lda     #$01
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$A0
+	sta     _sla
+	stx     _sla+1
+	ldy     sreg
+	sty     _sla+2
+	ldy     sreg+1
+	sty     _sla+3
+	lda     _sla+3
+	sta     sreg+1
+	lda     _sla+2
+	sta     sreg
+	ldx     _sla+1
+	lda     _sla
+	jsr     pusheax
+	ldx     #$EA
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$61
+	jsr     toslteax
+	jeq     L0002
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	sta     _slb
+	stx     _slb+1
+	ldy     sreg
+	sty     _slb+2
+	ldy     sreg+1
+	sty     _slb+3
+L0002:	lda     _slb+3
+	sta     sreg+1
+	lda     _slb+2
+	sta     sreg
+	ldx     _slb+1
+	lda     _slb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; long __near__ signed_long_13 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_long_13: near
+
+	.dbg	func, "signed_long_13", "00", extern, "_signed_long_13"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 94
+	ldx     #$F2
+	lda     #$FC
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$C0
+	sta     _slb
+	stx     _slb+1
+	ldy     sreg
+	sty     _slb+2
+	ldy     sreg+1
+	sty     _slb+3
+	clc
+	ldx     #$EA
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$60
+	sta     _sla
+	stx     _sla+1
+	ldy     sreg
+	sty     _sla+2
+	ldy     sreg+1
+	sty     _sla+3
+	lda     _sla+3
+	sta     sreg+1
+	lda     _sla+2
+	sta     sreg
+	ldx     _sla+1
+	lda     _sla
+	jsr     pusheax
+	ldx     #$86
+	lda     #$01
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$A0
+	jsr     tosgeeax
+	jeq     L0002
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	sta     _slb
+	stx     _slb+1
+	ldy     sreg
+	sty     _slb+2
+	ldy     sreg+1
+	sty     _slb+3
+L0002:	lda     _slb+3
+	sta     sreg+1
+	lda     _slb+2
+	sta     sreg
+	ldx     _slb+1
+	lda     _slb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; long __near__ signed_long_14 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_long_14: near
+
+	.dbg	func, "signed_long_14", "00", extern, "_signed_long_14"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 94
+	ldx     #$F2
+	lda     #$FC
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$C0
+	sta     _slb
+	stx     _slb+1
+	ldy     sreg
+	sty     _slb+2
+	ldy     sreg+1
+	sty     _slb+3
+	sec
+	ldx     #$EA
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$60
+	sta     _sla
+	stx     _sla+1
+	ldy     sreg
+	sty     _sla+2
+	ldy     sreg+1
+	sty     _sla+3
+	lda     _sla+3
+	sta     sreg+1
+	lda     _sla+2
+	sta     sreg
+	ldx     _sla+1
+	lda     _sla
+	jsr     pusheax
+	ldx     #$86
+	lda     #$01
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$A0
+	jsr     tosgeeax
+	jeq     L0002
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	sta     _slb
+	stx     _slb+1
+	ldy     sreg
+	sty     _slb+2
+	ldy     sreg+1
+	sty     _slb+3
+L0002:	lda     _slb+3
+	sta     sreg+1
+	lda     _slb+2
+	sta     sreg
+	ldx     _slb+1
+	lda     _slb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; long __near__ signed_long_15 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_long_15: near
+
+	.dbg	func, "signed_long_15", "00", extern, "_signed_long_15"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 94
+	ldx     #$F2
+	lda     #$FC
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$C0
+	sta     _slb
+	stx     _slb+1
+	ldy     sreg
+	sty     _slb+2
+	ldy     sreg+1
+	sty     _slb+3
+	clc
+	ldx     #$86
+	lda     #$01
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$A0
+	sta     _sla
+	stx     _sla+1
+	ldy     sreg
+	sty     _sla+2
+	ldy     sreg+1
+	sty     _sla+3
+	lda     _sla+3
+	sta     sreg+1
+	lda     _sla+2
+	sta     sreg
+	ldx     _sla+1
+	lda     _sla
+	jsr     pusheax
+	ldx     #$EA
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$60
+	jsr     tosgeeax
+	jeq     L0002
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	sta     _slb
+	stx     _slb+1
+	ldy     sreg
+	sty     _slb+2
+	ldy     sreg+1
+	sty     _slb+3
+L0002:	lda     _slb+3
+	sta     sreg+1
+	lda     _slb+2
+	sta     sreg
+	ldx     _slb+1
+	lda     _slb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; long __near__ signed_long_16 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_long_16: near
+
+	.dbg	func, "signed_long_16", "00", extern, "_signed_long_16"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 94
+	ldx     #$F2
+	lda     #$FC
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$C0
+	sta     _slb
+	stx     _slb+1
+	ldy     sreg
+	sty     _slb+2
+	ldy     sreg+1
+	sty     _slb+3
+	sec
+	ldx     #$86
+	lda     #$01
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$A0
+	sta     _sla
+	stx     _sla+1
+	ldy     sreg
+	sty     _sla+2
+	ldy     sreg+1
+	sty     _sla+3
+	lda     _sla+3
+	sta     sreg+1
+	lda     _sla+2
+	sta     sreg
+	ldx     _sla+1
+	lda     _sla
+	jsr     pusheax
+	ldx     #$EA
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$60
+	jsr     tosgeeax
+	jeq     L0002
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	sta     _slb
+	stx     _slb+1
+	ldy     sreg
+	sty     _slb+2
+	ldy     sreg+1
+	sty     _slb+3
+L0002:	lda     _slb+3
+	sta     sreg+1
+	lda     _slb+2
+	sta     sreg
+	ldx     _slb+1
+	lda     _slb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; long __near__ signed_long_17 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_long_17: near
+
+	.dbg	func, "signed_long_17", "00", extern, "_signed_long_17"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 94
+	ldx     #$F2
+	lda     #$FC
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$C0
+	sta     _slb
+	stx     _slb+1
+	ldy     sreg
+	sty     _slb+2
+	ldy     sreg+1
+	sty     _slb+3
+	nop
+	ldx     #$EA
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$60
+	sta     _sla
+	stx     _sla+1
+	ldy     sreg
+	sty     _sla+2
+	ldy     sreg+1
+	sty     _sla+3
+	lda     _sla+3
+	sta     sreg+1
+	lda     _sla+2
+	sta     sreg
+	ldx     _sla+1
+	lda     _sla
+	jsr     pusheax
+	ldx     #$86
+	lda     #$01
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$A0
+	jsr     toseqeax
+	jeq     L0002
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	sta     _slb
+	stx     _slb+1
+	ldy     sreg
+	sty     _slb+2
+	ldy     sreg+1
+	sty     _slb+3
+L0002:	lda     _slb+3
+	sta     sreg+1
+	lda     _slb+2
+	sta     sreg
+	ldx     _slb+1
+	lda     _slb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; long __near__ signed_long_18 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_long_18: near
+
+	.dbg	func, "signed_long_18", "00", extern, "_signed_long_18"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 94
+	ldx     #$F2
+	lda     #$FC
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$C0
+	sta     _slb
+	stx     _slb+1
+	ldy     sreg
+	sty     _slb+2
+	ldy     sreg+1
+	sty     _slb+3
+	nop
+	ldx     #$86
+	lda     #$01
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$A0
+	sta     _sla
+	stx     _sla+1
+	ldy     sreg
+	sty     _sla+2
+	ldy     sreg+1
+	sty     _sla+3
+	lda     _sla+3
+	sta     sreg+1
+	lda     _sla+2
+	sta     sreg
+	ldx     _sla+1
+	lda     _sla
+	jsr     pusheax
+	ldx     #$86
+	lda     #$01
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$A0
+	jsr     toseqeax
+	jeq     L0002
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	sta     _slb
+	stx     _slb+1
+	ldy     sreg
+	sty     _slb+2
+	ldy     sreg+1
+	sty     _slb+3
+L0002:	lda     _slb+3
+	sta     sreg+1
+	lda     _slb+2
+	sta     sreg
+	ldx     _slb+1
+	lda     _slb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; long __near__ signed_long_19 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_long_19: near
+
+	.dbg	func, "signed_long_19", "00", extern, "_signed_long_19"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 94
+	ldx     #$F2
+	lda     #$FC
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$C0
+	sta     _slb
+	stx     _slb+1
+	ldy     sreg
+	sty     _slb+2
+	ldy     sreg+1
+	sty     _slb+3
+	nop
+	ldx     #$EA
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$60
+	sta     _sla
+	stx     _sla+1
+	ldy     sreg
+	sty     _sla+2
+	ldy     sreg+1
+	sty     _sla+3
+	lda     _sla+3
+	sta     sreg+1
+	lda     _sla+2
+	sta     sreg
+	ldx     _sla+1
+	lda     _sla
+	jsr     pusheax
+	ldx     #$86
+	lda     #$01
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$A0
+	jsr     tosneeax
+	jeq     L0002
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	sta     _slb
+	stx     _slb+1
+	ldy     sreg
+	sty     _slb+2
+	ldy     sreg+1
+	sty     _slb+3
+L0002:	lda     _slb+3
+	sta     sreg+1
+	lda     _slb+2
+	sta     sreg
+	ldx     _slb+1
+	lda     _slb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; long __near__ signed_long_20 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_long_20: near
+
+	.dbg	func, "signed_long_20", "00", extern, "_signed_long_20"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 94
+	ldx     #$F2
+	lda     #$FC
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$C0
+	sta     _slb
+	stx     _slb+1
+	ldy     sreg
+	sty     _slb+2
+	ldy     sreg+1
+	sty     _slb+3
+	nop
+	ldx     #$86
+	lda     #$01
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$A0
+	sta     _sla
+	stx     _sla+1
+	ldy     sreg
+	sty     _sla+2
+	ldy     sreg+1
+	sty     _sla+3
+	lda     _sla+3
+	sta     sreg+1
+	lda     _sla+2
+	sta     sreg
+	ldx     _sla+1
+	lda     _sla
+	jsr     pusheax
+	ldx     #$86
+	lda     #$01
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$A0
+	jsr     tosneeax
+	jeq     L0002
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	sta     _slb
+	stx     _slb+1
+	ldy     sreg
+	sty     _slb+2
+	ldy     sreg+1
+	sty     _slb+3
+L0002:	lda     _slb+3
+	sta     sreg+1
+	lda     _slb+2
+	sta     sreg
+	ldx     _slb+1
+	lda     _slb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ signed_long_test (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signed_long_test: near
+
+	.dbg	func, "signed_long_test", "00", extern, "_signed_long_test"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 94
+	jsr     _signed_long_1
+	jsr     pusheax
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	jsr     tosneeax
+	jeq     L0002
+	lda     #<(S01A5)
+	ldx     #>(S01A5)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5E
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S01A6)
+	ldx     #>(S01A6)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S01A7)
+	ldx     #>(S01A7)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S01A8)
+	ldx     #>(S01A8)
+	jsr     pushax
+	jsr     _signed_long_1
+	jsr     pusheax
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0002:	jsr     _signed_long_2
+	jsr     pusheax
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	jsr     tosneeax
+	jeq     L0003
+	lda     #<(S01A9)
+	ldx     #>(S01A9)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5E
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S01AA)
+	ldx     #>(S01AA)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S01AB)
+	ldx     #>(S01AB)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S01AC)
+	ldx     #>(S01AC)
+	jsr     pushax
+	jsr     _signed_long_2
+	jsr     pusheax
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0003:	jsr     _signed_long_3
+	jsr     pusheax
+	ldx     #$F2
+	lda     #$FC
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$C0
+	jsr     tosneeax
+	jeq     L0004
+	lda     #<(S01AD)
+	ldx     #>(S01AD)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5E
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S01AE)
+	ldx     #>(S01AE)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S01AF)
+	ldx     #>(S01AF)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S01B0)
+	ldx     #>(S01B0)
+	jsr     pushax
+	jsr     _signed_long_3
+	jsr     pusheax
+	ldx     #$F2
+	lda     #$FC
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$C0
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0004:	jsr     _signed_long_4
+	jsr     pusheax
+	ldx     #$F2
+	lda     #$FC
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$C0
+	jsr     tosneeax
+	jeq     L0005
+	lda     #<(S01B1)
+	ldx     #>(S01B1)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5E
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S01B2)
+	ldx     #>(S01B2)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S01B3)
+	ldx     #>(S01B3)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S01B4)
+	ldx     #>(S01B4)
+	jsr     pushax
+	jsr     _signed_long_4
+	jsr     pusheax
+	ldx     #$F2
+	lda     #$FC
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$C0
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0005:	jsr     _signed_long_5
+	jsr     pusheax
+	ldx     #$F2
+	lda     #$FC
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$C0
+	jsr     tosneeax
+	jeq     L0006
+	lda     #<(S01B5)
+	ldx     #>(S01B5)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5E
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S01B6)
+	ldx     #>(S01B6)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S01B7)
+	ldx     #>(S01B7)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S01B8)
+	ldx     #>(S01B8)
+	jsr     pushax
+	jsr     _signed_long_5
+	jsr     pusheax
+	ldx     #$F2
+	lda     #$FC
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$C0
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0006:	jsr     _signed_long_6
+	jsr     pusheax
+	ldx     #$F2
+	lda     #$FC
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$C0
+	jsr     tosneeax
+	jeq     L0007
+	lda     #<(S01B9)
+	ldx     #>(S01B9)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5E
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S01BA)
+	ldx     #>(S01BA)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S01BB)
+	ldx     #>(S01BB)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S01BC)
+	ldx     #>(S01BC)
+	jsr     pushax
+	jsr     _signed_long_6
+	jsr     pusheax
+	ldx     #$F2
+	lda     #$FC
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$C0
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0007:	jsr     _signed_long_7
+	jsr     pusheax
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	jsr     tosneeax
+	jeq     L0008
+	lda     #<(S01BD)
+	ldx     #>(S01BD)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5E
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S01BE)
+	ldx     #>(S01BE)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S01BF)
+	ldx     #>(S01BF)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S01C0)
+	ldx     #>(S01C0)
+	jsr     pushax
+	jsr     _signed_long_7
+	jsr     pusheax
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0008:	jsr     _signed_long_8
+	jsr     pusheax
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	jsr     tosneeax
+	jeq     L0009
+	lda     #<(S01C1)
+	ldx     #>(S01C1)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5E
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S01C2)
+	ldx     #>(S01C2)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S01C3)
+	ldx     #>(S01C3)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S01C4)
+	ldx     #>(S01C4)
+	jsr     pushax
+	jsr     _signed_long_8
+	jsr     pusheax
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0009:	jsr     _signed_long_9
+	jsr     pusheax
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	jsr     tosneeax
+	jeq     L000A
+	lda     #<(S01C5)
+	ldx     #>(S01C5)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5E
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S01C6)
+	ldx     #>(S01C6)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S01C7)
+	ldx     #>(S01C7)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S01C8)
+	ldx     #>(S01C8)
+	jsr     pushax
+	jsr     _signed_long_9
+	jsr     pusheax
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L000A:	jsr     _signed_long_10
+	jsr     pusheax
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	jsr     tosneeax
+	jeq     L000B
+	lda     #<(S01C9)
+	ldx     #>(S01C9)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5E
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S01CA)
+	ldx     #>(S01CA)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S01CB)
+	ldx     #>(S01CB)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S01CC)
+	ldx     #>(S01CC)
+	jsr     pushax
+	jsr     _signed_long_10
+	jsr     pusheax
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L000B:	jsr     _signed_long_11
+	jsr     pusheax
+	ldx     #$F2
+	lda     #$FC
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$C0
+	jsr     tosneeax
+	jeq     L000C
+	lda     #<(S01CD)
+	ldx     #>(S01CD)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5E
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S01CE)
+	ldx     #>(S01CE)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S01CF)
+	ldx     #>(S01CF)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S01D0)
+	ldx     #>(S01D0)
+	jsr     pushax
+	jsr     _signed_long_11
+	jsr     pusheax
+	ldx     #$F2
+	lda     #$FC
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$C0
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L000C:	jsr     _signed_long_12
+	jsr     pusheax
+	ldx     #$F2
+	lda     #$FC
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$C0
+	jsr     tosneeax
+	jeq     L000D
+	lda     #<(S01D1)
+	ldx     #>(S01D1)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5E
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S01D2)
+	ldx     #>(S01D2)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S01D3)
+	ldx     #>(S01D3)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S01D4)
+	ldx     #>(S01D4)
+	jsr     pushax
+	jsr     _signed_long_12
+	jsr     pusheax
+	ldx     #$F2
+	lda     #$FC
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$C0
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L000D:	jsr     _signed_long_13
+	jsr     pusheax
+	ldx     #$F2
+	lda     #$FC
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$C0
+	jsr     tosneeax
+	jeq     L000E
+	lda     #<(S01D5)
+	ldx     #>(S01D5)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5E
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S01D6)
+	ldx     #>(S01D6)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S01D7)
+	ldx     #>(S01D7)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S01D8)
+	ldx     #>(S01D8)
+	jsr     pushax
+	jsr     _signed_long_13
+	jsr     pusheax
+	ldx     #$F2
+	lda     #$FC
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$C0
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L000E:	jsr     _signed_long_14
+	jsr     pusheax
+	ldx     #$F2
+	lda     #$FC
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$C0
+	jsr     tosneeax
+	jeq     L000F
+	lda     #<(S01D9)
+	ldx     #>(S01D9)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5E
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S01DA)
+	ldx     #>(S01DA)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S01DB)
+	ldx     #>(S01DB)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S01DC)
+	ldx     #>(S01DC)
+	jsr     pushax
+	jsr     _signed_long_14
+	jsr     pusheax
+	ldx     #$F2
+	lda     #$FC
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$C0
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L000F:	jsr     _signed_long_15
+	jsr     pusheax
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	jsr     tosneeax
+	jeq     L0010
+	lda     #<(S01DD)
+	ldx     #>(S01DD)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5E
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S01DE)
+	ldx     #>(S01DE)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S01DF)
+	ldx     #>(S01DF)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S01E0)
+	ldx     #>(S01E0)
+	jsr     pushax
+	jsr     _signed_long_15
+	jsr     pusheax
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0010:	jsr     _signed_long_16
+	jsr     pusheax
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	jsr     tosneeax
+	jeq     L0011
+	lda     #<(S01E1)
+	ldx     #>(S01E1)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5E
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S01E2)
+	ldx     #>(S01E2)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S01E3)
+	ldx     #>(S01E3)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S01E4)
+	ldx     #>(S01E4)
+	jsr     pushax
+	jsr     _signed_long_16
+	jsr     pusheax
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0011:	jsr     _signed_long_17
+	jsr     pusheax
+	ldx     #$F2
+	lda     #$FC
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$C0
+	jsr     tosneeax
+	jeq     L0012
+	lda     #<(S01E5)
+	ldx     #>(S01E5)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5E
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S01E6)
+	ldx     #>(S01E6)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S01E7)
+	ldx     #>(S01E7)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S01E8)
+	ldx     #>(S01E8)
+	jsr     pushax
+	jsr     _signed_long_17
+	jsr     pusheax
+	ldx     #$F2
+	lda     #$FC
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$C0
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0012:	jsr     _signed_long_18
+	jsr     pusheax
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	jsr     tosneeax
+	jeq     L0013
+	lda     #<(S01E9)
+	ldx     #>(S01E9)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5E
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S01EA)
+	ldx     #>(S01EA)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S01EB)
+	ldx     #>(S01EB)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S01EC)
+	ldx     #>(S01EC)
+	jsr     pushax
+	jsr     _signed_long_18
+	jsr     pusheax
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0013:	jsr     _signed_long_19
+	jsr     pusheax
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	jsr     tosneeax
+	jeq     L0014
+	lda     #<(S01ED)
+	ldx     #>(S01ED)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5E
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S01EE)
+	ldx     #>(S01EE)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S01EF)
+	ldx     #>(S01EF)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S01F0)
+	ldx     #>(S01F0)
+	jsr     pushax
+	jsr     _signed_long_19
+	jsr     pusheax
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0014:	jsr     _signed_long_20
+	jsr     pusheax
+	ldx     #$F2
+	lda     #$FC
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$C0
+	jsr     tosneeax
+	jeq     L0015
+	lda     #<(S01F1)
+	ldx     #>(S01F1)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5E
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S01F2)
+	ldx     #>(S01F2)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S01F3)
+	ldx     #>(S01F3)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S01F4)
+	ldx     #>(S01F4)
+	jsr     pushax
+	jsr     _signed_long_20
+	jsr     pusheax
+	ldx     #$F2
+	lda     #$FC
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$C0
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0015:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned long __near__ unsigned_long_1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_long_1: near
+
+	.dbg	func, "unsigned_long_1", "00", extern, "_unsigned_long_1"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 95
+	ldx     #$0D
+	lda     #$03
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	sta     _ulb
+	stx     _ulb+1
+	ldy     sreg
+	sty     _ulb+2
+	ldy     sreg+1
+	sty     _ulb+3
+	clc
+	ldx     #$EA
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$60
+	sta     _ula
+	stx     _ula+1
+	ldy     sreg
+	sty     _ula+2
+	ldy     sreg+1
+	sty     _ula+3
+	lda     _ula+3
+	sta     sreg+1
+	lda     _ula+2
+	sta     sreg
+	ldx     _ula+1
+	lda     _ula
+	cmp     #$A0
+	txa
+	sbc     #$86
+	lda     sreg
+	sbc     #$01
+	lda     sreg+1
+	sbc     #$00
+	jsr     boolult
+	jeq     L0002
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	sta     _ulb
+	stx     _ulb+1
+	ldy     sreg
+	sty     _ulb+2
+	ldy     sreg+1
+	sty     _ulb+3
+L0002:	lda     _ulb+3
+	sta     sreg+1
+	lda     _ulb+2
+	sta     sreg
+	ldx     _ulb+1
+	lda     _ulb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned long __near__ unsigned_long_2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_long_2: near
+
+	.dbg	func, "unsigned_long_2", "00", extern, "_unsigned_long_2"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 95
+	ldx     #$0D
+	lda     #$03
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	sta     _ulb
+	stx     _ulb+1
+	ldy     sreg
+	sty     _ulb+2
+	ldy     sreg+1
+	sty     _ulb+3
+	sec
+	ldx     #$EA
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$60
+	sta     _ula
+	stx     _ula+1
+	ldy     sreg
+	sty     _ula+2
+	ldy     sreg+1
+	sty     _ula+3
+	lda     _ula+3
+	sta     sreg+1
+	lda     _ula+2
+	sta     sreg
+	ldx     _ula+1
+	lda     _ula
+	cmp     #$A0
+	txa
+	sbc     #$86
+	lda     sreg
+	sbc     #$01
+	lda     sreg+1
+	sbc     #$00
+	jsr     boolult
+	jeq     L0002
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	sta     _ulb
+	stx     _ulb+1
+	ldy     sreg
+	sty     _ulb+2
+	ldy     sreg+1
+	sty     _ulb+3
+L0002:	lda     _ulb+3
+	sta     sreg+1
+	lda     _ulb+2
+	sta     sreg
+	ldx     _ulb+1
+	lda     _ulb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned long __near__ unsigned_long_3 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_long_3: near
+
+	.dbg	func, "unsigned_long_3", "00", extern, "_unsigned_long_3"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 95
+	ldx     #$0D
+	lda     #$03
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	sta     _ulb
+	stx     _ulb+1
+	ldy     sreg
+	sty     _ulb+2
+	ldy     sreg+1
+	sty     _ulb+3
+	clc
+	ldx     #$86
+	lda     #$01
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$A0
+	sta     _ula
+	stx     _ula+1
+	ldy     sreg
+	sty     _ula+2
+	ldy     sreg+1
+	sty     _ula+3
+	lda     _ula+3
+	sta     sreg+1
+	lda     _ula+2
+	sta     sreg
+	ldx     _ula+1
+	lda     _ula
+	cmp     #$60
+	txa
+	sbc     #$EA
+	lda     sreg
+	sbc     #$00
+	lda     sreg+1
+	sbc     #$00
+	jsr     boolult
+	jeq     L0002
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	sta     _ulb
+	stx     _ulb+1
+	ldy     sreg
+	sty     _ulb+2
+	ldy     sreg+1
+	sty     _ulb+3
+L0002:	lda     _ulb+3
+	sta     sreg+1
+	lda     _ulb+2
+	sta     sreg
+	ldx     _ulb+1
+	lda     _ulb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned long __near__ unsigned_long_4 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_long_4: near
+
+	.dbg	func, "unsigned_long_4", "00", extern, "_unsigned_long_4"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 95
+	ldx     #$0D
+	lda     #$03
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	sta     _ulb
+	stx     _ulb+1
+	ldy     sreg
+	sty     _ulb+2
+	ldy     sreg+1
+	sty     _ulb+3
+	sec
+	ldx     #$86
+	lda     #$01
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$A0
+	sta     _ula
+	stx     _ula+1
+	ldy     sreg
+	sty     _ula+2
+	ldy     sreg+1
+	sty     _ula+3
+	lda     _ula+3
+	sta     sreg+1
+	lda     _ula+2
+	sta     sreg
+	ldx     _ula+1
+	lda     _ula
+	cmp     #$60
+	txa
+	sbc     #$EA
+	lda     sreg
+	sbc     #$00
+	lda     sreg+1
+	sbc     #$00
+	jsr     boolult
+	jeq     L0002
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	sta     _ulb
+	stx     _ulb+1
+	ldy     sreg
+	sty     _ulb+2
+	ldy     sreg+1
+	sty     _ulb+3
+L0002:	lda     _ulb+3
+	sta     sreg+1
+	lda     _ulb+2
+	sta     sreg
+	ldx     _ulb+1
+	lda     _ulb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned long __near__ unsigned_long_5 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_long_5: near
+
+	.dbg	func, "unsigned_long_5", "00", extern, "_unsigned_long_5"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 95
+	ldx     #$0D
+	lda     #$03
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	sta     _ulb
+	stx     _ulb+1
+	ldy     sreg
+	sty     _ulb+2
+	ldy     sreg+1
+	sty     _ulb+3
+	clc
+	ldx     #$EA
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$60
+	sta     _ula
+	stx     _ula+1
+	ldy     sreg
+	sty     _ula+2
+	ldy     sreg+1
+	sty     _ula+3
+	lda     _ula+3
+	sta     sreg+1
+	lda     _ula+2
+	sta     sreg
+	ldx     _ula+1
+	lda     _ula
+	cmp     #$A1
+	txa
+	sbc     #$86
+	lda     sreg
+	sbc     #$01
+	lda     sreg+1
+	sbc     #$00
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	sta     _ulb
+	stx     _ulb+1
+	ldy     sreg
+	sty     _ulb+2
+	ldy     sreg+1
+	sty     _ulb+3
+L0002:	lda     _ulb+3
+	sta     sreg+1
+	lda     _ulb+2
+	sta     sreg
+	ldx     _ulb+1
+	lda     _ulb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned long __near__ unsigned_long_6 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_long_6: near
+
+	.dbg	func, "unsigned_long_6", "00", extern, "_unsigned_long_6"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 95
+	ldx     #$0D
+	lda     #$03
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	sta     _ulb
+	stx     _ulb+1
+	ldy     sreg
+	sty     _ulb+2
+	ldy     sreg+1
+	sty     _ulb+3
+	sec
+	ldx     #$EA
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$60
+	sta     _ula
+	stx     _ula+1
+	ldy     sreg
+	sty     _ula+2
+	ldy     sreg+1
+	sty     _ula+3
+	lda     _ula+3
+	sta     sreg+1
+	lda     _ula+2
+	sta     sreg
+	ldx     _ula+1
+	lda     _ula
+	cmp     #$A1
+	txa
+	sbc     #$86
+	lda     sreg
+	sbc     #$01
+	lda     sreg+1
+	sbc     #$00
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	sta     _ulb
+	stx     _ulb+1
+	ldy     sreg
+	sty     _ulb+2
+	ldy     sreg+1
+	sty     _ulb+3
+L0002:	lda     _ulb+3
+	sta     sreg+1
+	lda     _ulb+2
+	sta     sreg
+	ldx     _ulb+1
+	lda     _ulb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned long __near__ unsigned_long_7 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_long_7: near
+
+	.dbg	func, "unsigned_long_7", "00", extern, "_unsigned_long_7"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 95
+	ldx     #$0D
+	lda     #$03
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	sta     _ulb
+	stx     _ulb+1
+	ldy     sreg
+	sty     _ulb+2
+	ldy     sreg+1
+	sty     _ulb+3
+	clc
+	ldx     #$86
+	lda     #$01
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$A0
+	sta     _ula
+	stx     _ula+1
+	ldy     sreg
+	sty     _ula+2
+	ldy     sreg+1
+	sty     _ula+3
+	lda     _ula+3
+	sta     sreg+1
+	lda     _ula+2
+	sta     sreg
+	ldx     _ula+1
+	lda     _ula
+	cmp     #$61
+	txa
+	sbc     #$EA
+	lda     sreg
+	sbc     #$00
+	lda     sreg+1
+	sbc     #$00
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	sta     _ulb
+	stx     _ulb+1
+	ldy     sreg
+	sty     _ulb+2
+	ldy     sreg+1
+	sty     _ulb+3
+L0002:	lda     _ulb+3
+	sta     sreg+1
+	lda     _ulb+2
+	sta     sreg
+	ldx     _ulb+1
+	lda     _ulb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned long __near__ unsigned_long_8 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_long_8: near
+
+	.dbg	func, "unsigned_long_8", "00", extern, "_unsigned_long_8"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 95
+	ldx     #$0D
+	lda     #$03
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	sta     _ulb
+	stx     _ulb+1
+	ldy     sreg
+	sty     _ulb+2
+	ldy     sreg+1
+	sty     _ulb+3
+	sec
+	ldx     #$86
+	lda     #$01
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$A0
+	sta     _ula
+	stx     _ula+1
+	ldy     sreg
+	sty     _ula+2
+	ldy     sreg+1
+	sty     _ula+3
+	lda     _ula+3
+	sta     sreg+1
+	lda     _ula+2
+	sta     sreg
+	ldx     _ula+1
+	lda     _ula
+	cmp     #$61
+	txa
+	sbc     #$EA
+	lda     sreg
+	sbc     #$00
+	lda     sreg+1
+	sbc     #$00
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	sta     _ulb
+	stx     _ulb+1
+	ldy     sreg
+	sty     _ulb+2
+	ldy     sreg+1
+	sty     _ulb+3
+L0002:	lda     _ulb+3
+	sta     sreg+1
+	lda     _ulb+2
+	sta     sreg
+	ldx     _ulb+1
+	lda     _ulb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned long __near__ unsigned_long_9 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_long_9: near
+
+	.dbg	func, "unsigned_long_9", "00", extern, "_unsigned_long_9"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 95
+	ldx     #$0D
+	lda     #$03
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	sta     _ulb
+	stx     _ulb+1
+	ldy     sreg
+	sty     _ulb+2
+	ldy     sreg+1
+	sty     _ulb+3
+	clc
+	ldx     #$EA
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$60
+	sta     _ula
+	stx     _ula+1
+	ldy     sreg
+	sty     _ula+2
+	ldy     sreg+1
+	sty     _ula+3
+	lda     _ula+3
+	sta     sreg+1
+	lda     _ula+2
+	sta     sreg
+	ldx     _ula+1
+	lda     _ula
+	cmp     #$A1
+	txa
+	sbc     #$86
+	lda     sreg
+	sbc     #$01
+	lda     sreg+1
+	sbc     #$00
+	jsr     boolult
+	jeq     L0002
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	sta     _ulb
+	stx     _ulb+1
+	ldy     sreg
+	sty     _ulb+2
+	ldy     sreg+1
+	sty     _ulb+3
+L0002:	lda     _ulb+3
+	sta     sreg+1
+	lda     _ulb+2
+	sta     sreg
+	ldx     _ulb+1
+	lda     _ulb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned long __near__ unsigned_long_10 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_long_10: near
+
+	.dbg	func, "unsigned_long_10", "00", extern, "_unsigned_long_10"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 95
+	ldx     #$0D
+	lda     #$03
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	sta     _ulb
+	stx     _ulb+1
+	ldy     sreg
+	sty     _ulb+2
+	ldy     sreg+1
+	sty     _ulb+3
+	sec
+	ldx     #$EA
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$60
+	sta     _ula
+	stx     _ula+1
+	ldy     sreg
+	sty     _ula+2
+	ldy     sreg+1
+	sty     _ula+3
+	lda     _ula+3
+	sta     sreg+1
+	lda     _ula+2
+	sta     sreg
+	ldx     _ula+1
+	lda     _ula
+	cmp     #$A1
+	txa
+	sbc     #$86
+	lda     sreg
+	sbc     #$01
+	lda     sreg+1
+	sbc     #$00
+	jsr     boolult
+	jeq     L0002
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	sta     _ulb
+	stx     _ulb+1
+	ldy     sreg
+	sty     _ulb+2
+	ldy     sreg+1
+	sty     _ulb+3
+L0002:	lda     _ulb+3
+	sta     sreg+1
+	lda     _ulb+2
+	sta     sreg
+	ldx     _ulb+1
+	lda     _ulb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned long __near__ unsigned_long_11 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_long_11: near
+
+	.dbg	func, "unsigned_long_11", "00", extern, "_unsigned_long_11"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 95
+	ldx     #$0D
+	lda     #$03
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	sta     _ulb
+	stx     _ulb+1
+	ldy     sreg
+	sty     _ulb+2
+	ldy     sreg+1
+	sty     _ulb+3
+	clc
+	ldx     #$86
+	lda     #$01
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$A0
+	sta     _ula
+	stx     _ula+1
+	ldy     sreg
+	sty     _ula+2
+	ldy     sreg+1
+	sty     _ula+3
+	lda     _ula+3
+	sta     sreg+1
+	lda     _ula+2
+	sta     sreg
+	ldx     _ula+1
+	lda     _ula
+	cmp     #$61
+	txa
+	sbc     #$EA
+	lda     sreg
+	sbc     #$00
+	lda     sreg+1
+	sbc     #$00
+	jsr     boolult
+	jeq     L0002
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	sta     _ulb
+	stx     _ulb+1
+	ldy     sreg
+	sty     _ulb+2
+	ldy     sreg+1
+	sty     _ulb+3
+L0002:	lda     _ulb+3
+	sta     sreg+1
+	lda     _ulb+2
+	sta     sreg
+	ldx     _ulb+1
+	lda     _ulb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned long __near__ unsigned_long_12 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_long_12: near
+
+	.dbg	func, "unsigned_long_12", "00", extern, "_unsigned_long_12"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 95
+	ldx     #$0D
+	lda     #$03
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	sta     _ulb
+	stx     _ulb+1
+	ldy     sreg
+	sty     _ulb+2
+	ldy     sreg+1
+	sty     _ulb+3
+	sec
+	ldx     #$86
+	lda     #$01
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$A0
+	sta     _ula
+	stx     _ula+1
+	ldy     sreg
+	sty     _ula+2
+	ldy     sreg+1
+	sty     _ula+3
+	lda     _ula+3
+	sta     sreg+1
+	lda     _ula+2
+	sta     sreg
+	ldx     _ula+1
+	lda     _ula
+	cmp     #$61
+	txa
+	sbc     #$EA
+	lda     sreg
+	sbc     #$00
+	lda     sreg+1
+	sbc     #$00
+	jsr     boolult
+	jeq     L0002
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	sta     _ulb
+	stx     _ulb+1
+	ldy     sreg
+	sty     _ulb+2
+	ldy     sreg+1
+	sty     _ulb+3
+L0002:	lda     _ulb+3
+	sta     sreg+1
+	lda     _ulb+2
+	sta     sreg
+	ldx     _ulb+1
+	lda     _ulb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned long __near__ unsigned_long_13 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_long_13: near
+
+	.dbg	func, "unsigned_long_13", "00", extern, "_unsigned_long_13"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 95
+	ldx     #$0D
+	lda     #$03
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	sta     _ulb
+	stx     _ulb+1
+	ldy     sreg
+	sty     _ulb+2
+	ldy     sreg+1
+	sty     _ulb+3
+	clc
+	ldx     #$EA
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$60
+	sta     _ula
+	stx     _ula+1
+	ldy     sreg
+	sty     _ula+2
+	ldy     sreg+1
+	sty     _ula+3
+	lda     _ula+3
+	sta     sreg+1
+	lda     _ula+2
+	sta     sreg
+	ldx     _ula+1
+	lda     _ula
+	cmp     #$A0
+	txa
+	sbc     #$86
+	lda     sreg
+	sbc     #$01
+	lda     sreg+1
+	sbc     #$00
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	sta     _ulb
+	stx     _ulb+1
+	ldy     sreg
+	sty     _ulb+2
+	ldy     sreg+1
+	sty     _ulb+3
+L0002:	lda     _ulb+3
+	sta     sreg+1
+	lda     _ulb+2
+	sta     sreg
+	ldx     _ulb+1
+	lda     _ulb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned long __near__ unsigned_long_14 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_long_14: near
+
+	.dbg	func, "unsigned_long_14", "00", extern, "_unsigned_long_14"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 95
+	ldx     #$0D
+	lda     #$03
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	sta     _ulb
+	stx     _ulb+1
+	ldy     sreg
+	sty     _ulb+2
+	ldy     sreg+1
+	sty     _ulb+3
+	sec
+	ldx     #$EA
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$60
+	sta     _ula
+	stx     _ula+1
+	ldy     sreg
+	sty     _ula+2
+	ldy     sreg+1
+	sty     _ula+3
+	lda     _ula+3
+	sta     sreg+1
+	lda     _ula+2
+	sta     sreg
+	ldx     _ula+1
+	lda     _ula
+	cmp     #$A0
+	txa
+	sbc     #$86
+	lda     sreg
+	sbc     #$01
+	lda     sreg+1
+	sbc     #$00
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	sta     _ulb
+	stx     _ulb+1
+	ldy     sreg
+	sty     _ulb+2
+	ldy     sreg+1
+	sty     _ulb+3
+L0002:	lda     _ulb+3
+	sta     sreg+1
+	lda     _ulb+2
+	sta     sreg
+	ldx     _ulb+1
+	lda     _ulb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned long __near__ unsigned_long_15 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_long_15: near
+
+	.dbg	func, "unsigned_long_15", "00", extern, "_unsigned_long_15"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 95
+	ldx     #$0D
+	lda     #$03
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	sta     _ulb
+	stx     _ulb+1
+	ldy     sreg
+	sty     _ulb+2
+	ldy     sreg+1
+	sty     _ulb+3
+	clc
+	ldx     #$86
+	lda     #$01
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$A0
+	sta     _ula
+	stx     _ula+1
+	ldy     sreg
+	sty     _ula+2
+	ldy     sreg+1
+	sty     _ula+3
+	lda     _ula+3
+	sta     sreg+1
+	lda     _ula+2
+	sta     sreg
+	ldx     _ula+1
+	lda     _ula
+	cmp     #$60
+	txa
+	sbc     #$EA
+	lda     sreg
+	sbc     #$00
+	lda     sreg+1
+	sbc     #$00
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	sta     _ulb
+	stx     _ulb+1
+	ldy     sreg
+	sty     _ulb+2
+	ldy     sreg+1
+	sty     _ulb+3
+L0002:	lda     _ulb+3
+	sta     sreg+1
+	lda     _ulb+2
+	sta     sreg
+	ldx     _ulb+1
+	lda     _ulb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned long __near__ unsigned_long_16 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_long_16: near
+
+	.dbg	func, "unsigned_long_16", "00", extern, "_unsigned_long_16"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 95
+	ldx     #$0D
+	lda     #$03
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	sta     _ulb
+	stx     _ulb+1
+	ldy     sreg
+	sty     _ulb+2
+	ldy     sreg+1
+	sty     _ulb+3
+	sec
+	ldx     #$86
+	lda     #$01
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$A0
+	sta     _ula
+	stx     _ula+1
+	ldy     sreg
+	sty     _ula+2
+	ldy     sreg+1
+	sty     _ula+3
+	lda     _ula+3
+	sta     sreg+1
+	lda     _ula+2
+	sta     sreg
+	ldx     _ula+1
+	lda     _ula
+	cmp     #$60
+	txa
+	sbc     #$EA
+	lda     sreg
+	sbc     #$00
+	lda     sreg+1
+	sbc     #$00
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	sta     _ulb
+	stx     _ulb+1
+	ldy     sreg
+	sty     _ulb+2
+	ldy     sreg+1
+	sty     _ulb+3
+L0002:	lda     _ulb+3
+	sta     sreg+1
+	lda     _ulb+2
+	sta     sreg
+	ldx     _ulb+1
+	lda     _ulb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned long __near__ unsigned_long_17 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_long_17: near
+
+	.dbg	func, "unsigned_long_17", "00", extern, "_unsigned_long_17"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 95
+	ldx     #$0D
+	lda     #$03
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	sta     _ulb
+	stx     _ulb+1
+	ldy     sreg
+	sty     _ulb+2
+	ldy     sreg+1
+	sty     _ulb+3
+	nop
+	ldx     #$EA
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$60
+	sta     _ula
+	stx     _ula+1
+	ldy     sreg
+	sty     _ula+2
+	ldy     sreg+1
+	sty     _ula+3
+	lda     _ula+3
+	sta     sreg+1
+	lda     _ula+2
+	sta     sreg
+	ldx     _ula+1
+	lda     _ula
+	jsr     pusheax
+	ldx     #$86
+	lda     #$01
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$A0
+	jsr     toseqeax
+	jeq     L0002
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	sta     _ulb
+	stx     _ulb+1
+	ldy     sreg
+	sty     _ulb+2
+	ldy     sreg+1
+	sty     _ulb+3
+L0002:	lda     _ulb+3
+	sta     sreg+1
+	lda     _ulb+2
+	sta     sreg
+	ldx     _ulb+1
+	lda     _ulb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned long __near__ unsigned_long_18 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_long_18: near
+
+	.dbg	func, "unsigned_long_18", "00", extern, "_unsigned_long_18"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 95
+	ldx     #$0D
+	lda     #$03
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	sta     _ulb
+	stx     _ulb+1
+	ldy     sreg
+	sty     _ulb+2
+	ldy     sreg+1
+	sty     _ulb+3
+	nop
+	ldx     #$86
+	lda     #$01
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$A0
+	sta     _ula
+	stx     _ula+1
+	ldy     sreg
+	sty     _ula+2
+	ldy     sreg+1
+	sty     _ula+3
+	lda     _ula+3
+	sta     sreg+1
+	lda     _ula+2
+	sta     sreg
+	ldx     _ula+1
+	lda     _ula
+	jsr     pusheax
+	ldx     #$86
+	lda     #$01
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$A0
+	jsr     toseqeax
+	jeq     L0002
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	sta     _ulb
+	stx     _ulb+1
+	ldy     sreg
+	sty     _ulb+2
+	ldy     sreg+1
+	sty     _ulb+3
+L0002:	lda     _ulb+3
+	sta     sreg+1
+	lda     _ulb+2
+	sta     sreg
+	ldx     _ulb+1
+	lda     _ulb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned long __near__ unsigned_long_19 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_long_19: near
+
+	.dbg	func, "unsigned_long_19", "00", extern, "_unsigned_long_19"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 95
+	ldx     #$0D
+	lda     #$03
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	sta     _ulb
+	stx     _ulb+1
+	ldy     sreg
+	sty     _ulb+2
+	ldy     sreg+1
+	sty     _ulb+3
+	nop
+	ldx     #$EA
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$60
+	sta     _ula
+	stx     _ula+1
+	ldy     sreg
+	sty     _ula+2
+	ldy     sreg+1
+	sty     _ula+3
+	lda     _ula+3
+	sta     sreg+1
+	lda     _ula+2
+	sta     sreg
+	ldx     _ula+1
+	lda     _ula
+	jsr     pusheax
+	ldx     #$86
+	lda     #$01
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$A0
+	jsr     tosneeax
+	jeq     L0002
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	sta     _ulb
+	stx     _ulb+1
+	ldy     sreg
+	sty     _ulb+2
+	ldy     sreg+1
+	sty     _ulb+3
+L0002:	lda     _ulb+3
+	sta     sreg+1
+	lda     _ulb+2
+	sta     sreg
+	ldx     _ulb+1
+	lda     _ulb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned long __near__ unsigned_long_20 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_long_20: near
+
+	.dbg	func, "unsigned_long_20", "00", extern, "_unsigned_long_20"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 95
+	ldx     #$0D
+	lda     #$03
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	sta     _ulb
+	stx     _ulb+1
+	ldy     sreg
+	sty     _ulb+2
+	ldy     sreg+1
+	sty     _ulb+3
+	nop
+	ldx     #$86
+	lda     #$01
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$A0
+	sta     _ula
+	stx     _ula+1
+	ldy     sreg
+	sty     _ula+2
+	ldy     sreg+1
+	sty     _ula+3
+	lda     _ula+3
+	sta     sreg+1
+	lda     _ula+2
+	sta     sreg
+	ldx     _ula+1
+	lda     _ula
+	jsr     pusheax
+	ldx     #$86
+	lda     #$01
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$A0
+	jsr     tosneeax
+	jeq     L0002
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	sta     _ulb
+	stx     _ulb+1
+	ldy     sreg
+	sty     _ulb+2
+	ldy     sreg+1
+	sty     _ulb+3
+L0002:	lda     _ulb+3
+	sta     sreg+1
+	lda     _ulb+2
+	sta     sreg
+	ldx     _ulb+1
+	lda     _ulb
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ unsigned_long_test (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_unsigned_long_test: near
+
+	.dbg	func, "unsigned_long_test", "00", extern, "_unsigned_long_test"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 95
+	jsr     _unsigned_long_1
+	jsr     pusheax
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	jsr     tosneeax
+	jeq     L0002
+	lda     #<(S0209)
+	ldx     #>(S0209)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S020A)
+	ldx     #>(S020A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S020B)
+	ldx     #>(S020B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S020C)
+	ldx     #>(S020C)
+	jsr     pushax
+	jsr     _unsigned_long_1
+	jsr     pusheax
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0002:	jsr     _unsigned_long_2
+	jsr     pusheax
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	jsr     tosneeax
+	jeq     L0003
+	lda     #<(S020D)
+	ldx     #>(S020D)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S020E)
+	ldx     #>(S020E)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S020F)
+	ldx     #>(S020F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0210)
+	ldx     #>(S0210)
+	jsr     pushax
+	jsr     _unsigned_long_2
+	jsr     pusheax
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0003:	jsr     _unsigned_long_3
+	jsr     pusheax
+	ldx     #$0D
+	lda     #$03
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	jsr     tosneeax
+	jeq     L0004
+	lda     #<(S0211)
+	ldx     #>(S0211)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0212)
+	ldx     #>(S0212)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0213)
+	ldx     #>(S0213)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0214)
+	ldx     #>(S0214)
+	jsr     pushax
+	jsr     _unsigned_long_3
+	jsr     pusheax
+	ldx     #$0D
+	lda     #$03
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0004:	jsr     _unsigned_long_4
+	jsr     pusheax
+	ldx     #$0D
+	lda     #$03
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	jsr     tosneeax
+	jeq     L0005
+	lda     #<(S0215)
+	ldx     #>(S0215)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0216)
+	ldx     #>(S0216)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0217)
+	ldx     #>(S0217)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0218)
+	ldx     #>(S0218)
+	jsr     pushax
+	jsr     _unsigned_long_4
+	jsr     pusheax
+	ldx     #$0D
+	lda     #$03
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0005:	jsr     _unsigned_long_5
+	jsr     pusheax
+	ldx     #$0D
+	lda     #$03
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	jsr     tosneeax
+	jeq     L0006
+	lda     #<(S0219)
+	ldx     #>(S0219)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S021A)
+	ldx     #>(S021A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S021B)
+	ldx     #>(S021B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S021C)
+	ldx     #>(S021C)
+	jsr     pushax
+	jsr     _unsigned_long_5
+	jsr     pusheax
+	ldx     #$0D
+	lda     #$03
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0006:	jsr     _unsigned_long_6
+	jsr     pusheax
+	ldx     #$0D
+	lda     #$03
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	jsr     tosneeax
+	jeq     L0007
+	lda     #<(S021D)
+	ldx     #>(S021D)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S021E)
+	ldx     #>(S021E)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S021F)
+	ldx     #>(S021F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0220)
+	ldx     #>(S0220)
+	jsr     pushax
+	jsr     _unsigned_long_6
+	jsr     pusheax
+	ldx     #$0D
+	lda     #$03
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0007:	jsr     _unsigned_long_7
+	jsr     pusheax
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	jsr     tosneeax
+	jeq     L0008
+	lda     #<(S0221)
+	ldx     #>(S0221)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0222)
+	ldx     #>(S0222)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0223)
+	ldx     #>(S0223)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0224)
+	ldx     #>(S0224)
+	jsr     pushax
+	jsr     _unsigned_long_7
+	jsr     pusheax
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0008:	jsr     _unsigned_long_8
+	jsr     pusheax
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	jsr     tosneeax
+	jeq     L0009
+	lda     #<(S0225)
+	ldx     #>(S0225)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0226)
+	ldx     #>(S0226)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0227)
+	ldx     #>(S0227)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0228)
+	ldx     #>(S0228)
+	jsr     pushax
+	jsr     _unsigned_long_8
+	jsr     pusheax
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0009:	jsr     _unsigned_long_9
+	jsr     pusheax
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	jsr     tosneeax
+	jeq     L000A
+	lda     #<(S0229)
+	ldx     #>(S0229)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S022A)
+	ldx     #>(S022A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S022B)
+	ldx     #>(S022B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S022C)
+	ldx     #>(S022C)
+	jsr     pushax
+	jsr     _unsigned_long_9
+	jsr     pusheax
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L000A:	jsr     _unsigned_long_10
+	jsr     pusheax
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	jsr     tosneeax
+	jeq     L000B
+	lda     #<(S022D)
+	ldx     #>(S022D)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S022E)
+	ldx     #>(S022E)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S022F)
+	ldx     #>(S022F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0230)
+	ldx     #>(S0230)
+	jsr     pushax
+	jsr     _unsigned_long_10
+	jsr     pusheax
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L000B:	jsr     _unsigned_long_11
+	jsr     pusheax
+	ldx     #$0D
+	lda     #$03
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	jsr     tosneeax
+	jeq     L000C
+	lda     #<(S0231)
+	ldx     #>(S0231)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0232)
+	ldx     #>(S0232)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0233)
+	ldx     #>(S0233)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0234)
+	ldx     #>(S0234)
+	jsr     pushax
+	jsr     _unsigned_long_11
+	jsr     pusheax
+	ldx     #$0D
+	lda     #$03
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L000C:	jsr     _unsigned_long_12
+	jsr     pusheax
+	ldx     #$0D
+	lda     #$03
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	jsr     tosneeax
+	jeq     L000D
+	lda     #<(S0235)
+	ldx     #>(S0235)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0236)
+	ldx     #>(S0236)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0237)
+	ldx     #>(S0237)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0238)
+	ldx     #>(S0238)
+	jsr     pushax
+	jsr     _unsigned_long_12
+	jsr     pusheax
+	ldx     #$0D
+	lda     #$03
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L000D:	jsr     _unsigned_long_13
+	jsr     pusheax
+	ldx     #$0D
+	lda     #$03
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	jsr     tosneeax
+	jeq     L000E
+	lda     #<(S0239)
+	ldx     #>(S0239)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S023A)
+	ldx     #>(S023A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S023B)
+	ldx     #>(S023B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S023C)
+	ldx     #>(S023C)
+	jsr     pushax
+	jsr     _unsigned_long_13
+	jsr     pusheax
+	ldx     #$0D
+	lda     #$03
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L000E:	jsr     _unsigned_long_14
+	jsr     pusheax
+	ldx     #$0D
+	lda     #$03
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	jsr     tosneeax
+	jeq     L000F
+	lda     #<(S023D)
+	ldx     #>(S023D)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S023E)
+	ldx     #>(S023E)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S023F)
+	ldx     #>(S023F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0240)
+	ldx     #>(S0240)
+	jsr     pushax
+	jsr     _unsigned_long_14
+	jsr     pusheax
+	ldx     #$0D
+	lda     #$03
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L000F:	jsr     _unsigned_long_15
+	jsr     pusheax
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	jsr     tosneeax
+	jeq     L0010
+	lda     #<(S0241)
+	ldx     #>(S0241)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0242)
+	ldx     #>(S0242)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0243)
+	ldx     #>(S0243)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0244)
+	ldx     #>(S0244)
+	jsr     pushax
+	jsr     _unsigned_long_15
+	jsr     pusheax
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0010:	jsr     _unsigned_long_16
+	jsr     pusheax
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	jsr     tosneeax
+	jeq     L0011
+	lda     #<(S0245)
+	ldx     #>(S0245)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0246)
+	ldx     #>(S0246)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0247)
+	ldx     #>(S0247)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0248)
+	ldx     #>(S0248)
+	jsr     pushax
+	jsr     _unsigned_long_16
+	jsr     pusheax
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0011:	jsr     _unsigned_long_17
+	jsr     pusheax
+	ldx     #$0D
+	lda     #$03
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	jsr     tosneeax
+	jeq     L0012
+	lda     #<(S0249)
+	ldx     #>(S0249)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S024A)
+	ldx     #>(S024A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S024B)
+	ldx     #>(S024B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S024C)
+	ldx     #>(S024C)
+	jsr     pushax
+	jsr     _unsigned_long_17
+	jsr     pusheax
+	ldx     #$0D
+	lda     #$03
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0012:	jsr     _unsigned_long_18
+	jsr     pusheax
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	jsr     tosneeax
+	jeq     L0013
+	lda     #<(S024D)
+	ldx     #>(S024D)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S024E)
+	ldx     #>(S024E)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S024F)
+	ldx     #>(S024F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0250)
+	ldx     #>(S0250)
+	jsr     pushax
+	jsr     _unsigned_long_18
+	jsr     pusheax
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0013:	jsr     _unsigned_long_19
+	jsr     pusheax
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	jsr     tosneeax
+	jeq     L0014
+	lda     #<(S0251)
+	ldx     #>(S0251)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0252)
+	ldx     #>(S0252)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0253)
+	ldx     #>(S0253)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0254)
+	ldx     #>(S0254)
+	jsr     pushax
+	jsr     _unsigned_long_19
+	jsr     pusheax
+	ldx     #$13
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$88
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0014:	jsr     _unsigned_long_20
+	jsr     pusheax
+	ldx     #$0D
+	lda     #$03
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	jsr     tosneeax
+	jeq     L0015
+	lda     #<(S0255)
+	ldx     #>(S0255)
+	jsr     pushax
+	ldx     #$00
+	lda     #$5F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0256)
+	ldx     #>(S0256)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0257)
+	ldx     #>(S0257)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0258)
+	ldx     #>(S0258)
+	jsr     pushax
+	jsr     _unsigned_long_20
+	jsr     pusheax
+	ldx     #$0D
+	lda     #$03
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0015:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "bug895.c", 97
+	lda     #<(S0259)
+	ldx     #>(S0259)
+	jsr     pushax
+	lda     #<(S025A)
+	ldx     #>(S025A)
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "bug895.c", 99
+	jsr     _signed_char_test
+	.dbg	line, "bug895.c", 100
+	jsr     _unsigned_char_test
+	.dbg	line, "bug895.c", 101
+	jsr     _signed_int_test
+	.dbg	line, "bug895.c", 102
+	jsr     _unsigned_int_test
+	.dbg	line, "bug895.c", 103
+	jsr     _signed_long_test
+	.dbg	line, "bug895.c", 104
+	jsr     _unsigned_long_test
+	.dbg	line, "bug895.c", 106
+	lda     #<(S025B)
+	ldx     #>(S025B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,66 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.export		_test2
+	.export		_main
+
+.segment	"RODATA"
+
+_array2:
+	.byte	$00
+	.byte	$01
+	.byte	$02
+_array:
+	.byte	$00
+	.byte	$01
+	.byte	$02
+
+; ---------------------------------------------------------------
+; int __near__ test2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test2: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	lda     _array2
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     _test2
+	cpx     #$00
+	bne     L0004
+	cmp     #$00
+	beq     L0005
+L0004:	ldx     #$00
+	lda     #$01
+	rts
+L0005:	lda     _array
+	rts
+
+.endproc
+
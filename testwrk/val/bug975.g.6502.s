@@ -0,0 +1,83 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "bug975.c", 433, 1613073744
+	.dbg		file, "/root/repo/include/stdlib.h", 5999, 1613073744
+	.forceimport	__STARTUP__
+	.export		_test2
+	.export		_main
+
+.segment	"RODATA"
+
+_array2:
+	.byte	$00
+	.byte	$01
+	.byte	$02
+_array:
+	.byte	$00
+	.byte	$01
+	.byte	$02
+
+; ---------------------------------------------------------------
+; int __near__ test2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test2: near
+
+	.dbg	func, "test2", "00", extern, "_test2"
+
+.segment	"CODE"
+
+	.dbg	line, "bug975.c", 8
+	ldx     #$00
+	lda     _array2
+	jmp     L0001
+	.dbg	line, "bug975.c", 9
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "bug975.c", 15
+	jsr     _test2
+	cpx     #$00
+	bne     L0003
+	cmp     #$00
+L0003:	jsr     boolne
+	jeq     L0002
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+	.dbg	line, "bug975.c", 16
+L0002:	ldx     #$00
+	lda     _array
+	jmp     L0001
+	.dbg	line, "bug975.c", 17
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,609 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "call1.c", 1856, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/limits.h", 3146, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_success
+	.export		_failures
+	.export		_dummy
+	.export		_uint0
+	.export		_uint1
+	.export		_uchar0
+	.export		_uchar1
+	.export		_call3
+	.export		_done
+	.export		_call1
+	.export		_call2
+	.export		_call4
+	.export		_call5
+	.export		_call6a
+	.export		_call6
+	.export		_call7a
+	.export		_call7
+	.export		_call8
+	.export		_call9
+	.export		_main
+
+.segment	"DATA"
+
+_success:
+	.byte	$00
+_failures:
+	.byte	$00
+_dummy:
+	.byte	$00
+_uint0:
+	.word	$0000
+_uint1:
+	.word	$0000
+_uchar0:
+	.byte	$00
+_uchar1:
+	.byte	$00
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; unsigned char __near__ call3 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_call3: near
+
+	.dbg	func, "call3", "00", extern, "_call3"
+
+.segment	"CODE"
+
+	.dbg	line, "call1.c", 47
+	lda     _uchar0
+	jeq     L0002
+	.dbg	line, "call1.c", 48
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "call1.c", 50
+L0002:	ldx     #$00
+	lda     _failures
+	jmp     L0001
+	.dbg	line, "call1.c", 51
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ done (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_done: near
+
+	.dbg	func, "done", "00", extern, "_done"
+
+.segment	"CODE"
+
+	.dbg	line, "call1.c", 27
+	ldx     #$00
+	lda     _dummy
+	inc     _dummy
+	.dbg	line, "call1.c", 28
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ call1 (unsigned char uc0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_call1: near
+
+	.dbg	func, "call1", "00", extern, "_call1"
+	.dbg	sym, "uc0", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "call1.c", 32
+	jsr     pusha
+	.dbg	line, "call1.c", 33
+	ldy     #$00
+	lda     (sp),y
+	jeq     L0002
+	.dbg	line, "call1.c", 34
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "call1.c", 35
+L0002:	jsr     incsp1
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ call2 (unsigned int ui0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_call2: near
+
+	.dbg	func, "call2", "00", extern, "_call2"
+	.dbg	sym, "ui0", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "call1.c", 39
+	jsr     pushax
+	.dbg	line, "call1.c", 40
+	ldy     #$01
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0002
+	.dbg	line, "call1.c", 41
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "call1.c", 42
+L0002:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ call4 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_call4: near
+
+	.dbg	func, "call4", "00", extern, "_call4"
+	.dbg	sym, "i", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "call1.c", 56
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	.dbg	line, "call1.c", 58
+	lda     _uint0
+	ora     _uint0+1
+	jeq     L0002
+	.dbg	line, "call1.c", 59
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	.dbg	line, "call1.c", 61
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	jmp     L0001
+	.dbg	line, "call1.c", 62
+L0001:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ call5 (unsigned int k)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_call5: near
+
+	.dbg	func, "call5", "00", extern, "_call5"
+	.dbg	sym, "k", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "call1.c", 66
+	jsr     pushax
+	.dbg	line, "call1.c", 67
+	ldy     #$01
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0002
+	.dbg	line, "call1.c", 68
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "call1.c", 70
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	jmp     L0001
+	.dbg	line, "call1.c", 71
+L0001:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ call6a (unsigned char uc)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_call6a: near
+
+	.dbg	func, "call6a", "00", extern, "_call6a"
+	.dbg	sym, "uc", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "call1.c", 75
+	jsr     pusha
+	.dbg	line, "call1.c", 76
+	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldx     #$00
+	lda     _uchar1
+	jsr     tosugtax
+	jeq     L0002
+	.dbg	line, "call1.c", 77
+	ldx     #$00
+	lda     #$01
+	jmp     L0003
+	.dbg	line, "call1.c", 78
+	jmp     L0003
+	.dbg	line, "call1.c", 79
+L0002:	ldx     #$00
+	lda     #$00
+	jmp     L0003
+	.dbg	line, "call1.c", 80
+L0003:	jsr     incsp1
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ call6 (unsigned char uc)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_call6: near
+
+	.dbg	func, "call6", "00", extern, "_call6"
+	.dbg	sym, "uc", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "call1.c", 84
+	jsr     pusha
+	.dbg	line, "call1.c", 85
+	ldy     #$00
+	lda     (sp),y
+	jsr     _call6a
+	jmp     L0001
+	.dbg	line, "call1.c", 86
+L0001:	jsr     incsp1
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ call7a (unsigned int ui)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_call7a: near
+
+	.dbg	func, "call7a", "00", extern, "_call7a"
+	.dbg	sym, "ui", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "call1.c", 90
+	jsr     pushax
+	.dbg	line, "call1.c", 91
+	ldy     #$01
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0002
+	.dbg	line, "call1.c", 92
+	ldx     #$00
+	lda     #$01
+	jmp     L0003
+	.dbg	line, "call1.c", 93
+	jmp     L0003
+	.dbg	line, "call1.c", 94
+L0002:	ldx     #$00
+	lda     #$00
+	jmp     L0003
+	.dbg	line, "call1.c", 95
+L0003:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ call7 (unsigned int ui)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_call7: near
+
+	.dbg	func, "call7", "00", extern, "_call7"
+	.dbg	sym, "ui", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "call1.c", 99
+	jsr     pushax
+	.dbg	line, "call1.c", 100
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _call7a
+	jmp     L0001
+	.dbg	line, "call1.c", 101
+L0001:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ call8 (unsigned char uc1, unsigned char uc2)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_call8: near
+
+	.dbg	func, "call8", "00", extern, "_call8"
+	.dbg	sym, "uc1", "00", auto, 1
+	.dbg	sym, "uc2", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "call1.c", 105
+	jsr     pusha
+	.dbg	line, "call1.c", 106
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosaddax
+	ldx     #$00
+	jmp     L0001
+	.dbg	line, "call1.c", 107
+L0001:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ call9 (unsigned int ui1, unsigned int ui2)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_call9: near
+
+	.dbg	func, "call9", "00", extern, "_call9"
+	.dbg	sym, "ui1", "00", auto, 2
+	.dbg	sym, "ui2", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "call1.c", 110
+	jsr     pushax
+	.dbg	line, "call1.c", 111
+	ldy     #$03
+	jsr     ldaxysp
+	cpx     #$12
+	bne     L0003
+	cmp     #$34
+L0003:	jsr     boolne
+	jeq     L0002
+	.dbg	line, "call1.c", 112
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "call1.c", 113
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$56
+	bne     L0005
+	cmp     #$78
+L0005:	jsr     boolne
+	jeq     L0004
+	.dbg	line, "call1.c", 114
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "call1.c", 115
+L0004:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "call1.c", 120
+	lda     _uchar0
+	jsr     _call1
+	.dbg	line, "call1.c", 121
+	lda     _uint0
+	ldx     _uint0+1
+	jsr     _call2
+	.dbg	line, "call1.c", 122
+	jsr     _call3
+	sta     _uchar1
+	.dbg	line, "call1.c", 123
+	jsr     _call4
+	sta     _uint1
+	stx     _uint1+1
+	.dbg	line, "call1.c", 124
+	lda     _uint1
+	ora     _uint1+1
+	jeq     L0002
+	.dbg	line, "call1.c", 125
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "call1.c", 127
+L0002:	lda     _uint0
+	ldx     _uint0+1
+	jsr     _call5
+	sta     _uint1
+	stx     _uint1+1
+	.dbg	line, "call1.c", 128
+	lda     _uint1
+	ora     _uint1+1
+	jeq     L0003
+	.dbg	line, "call1.c", 129
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "call1.c", 131
+L0003:	lda     _uchar0
+	jsr     _call6
+	tax
+	jeq     L0004
+	.dbg	line, "call1.c", 132
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "call1.c", 134
+L0004:	ldx     #$00
+	lda     #$00
+	jsr     _call7
+	stx     tmp1
+	ora     tmp1
+	jeq     L0005
+	.dbg	line, "call1.c", 135
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "call1.c", 137
+L0005:	ldx     #$00
+	lda     #$01
+	jsr     _call7
+	jsr     bnegax
+	jeq     L0006
+	.dbg	line, "call1.c", 138
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "call1.c", 140
+L0006:	ldx     #$FF
+	lda     #$00
+	jsr     _call7
+	jsr     bnegax
+	jeq     L0007
+	.dbg	line, "call1.c", 141
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "call1.c", 143
+L0007:	ldx     #$00
+	lda     #$04
+	sta     _uchar0
+	.dbg	line, "call1.c", 144
+	ldx     #$00
+	lda     #$03
+	sta     _uchar1
+	.dbg	line, "call1.c", 145
+	lda     _uchar0
+	jsr     pusha
+	lda     _uchar1
+	jsr     _call8
+	sta     _uchar0
+	.dbg	line, "call1.c", 147
+	ldx     #$00
+	lda     _uchar0
+	cmp     #$07
+	jsr     boolne
+	jeq     L0008
+	.dbg	line, "call1.c", 148
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "call1.c", 150
+L0008:	ldx     #$12
+	lda     #$34
+	jsr     pushax
+	ldx     #$56
+	lda     #$78
+	jsr     _call9
+	.dbg	line, "call1.c", 152
+	ldx     #$00
+	lda     _failures
+	sta     _success
+	.dbg	line, "call1.c", 153
+	jsr     _done
+	.dbg	line, "call1.c", 154
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "call1.c", 156
+	ldx     #$00
+	lda     _failures
+	jmp     L0001
+	.dbg	line, "call1.c", 157
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,408 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_fp:
+	.addr	_tail
+
+.segment	"RODATA"
+
+S000C:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+S0007:
+	.byte	$62,$75,$66,$5B,$25,$75,$5D,$20,$25,$75,$0A,$00
+S000A:
+	.byte	$63,$6E,$74,$20,$25,$75,$0A,$00
+S000B:
+	.byte	$73,$75,$6D,$20,$25,$75,$0A,$00
+S0008:
+	.byte	$66,$32,$20,$25,$75,$0A,$00
+S0006:
+	.byte	$66,$31,$20,$25,$75,$0A,$00
+S0009:
+	.byte	$66,$33,$0A,$00
+
+.segment	"BSS"
+
+_failures:
+	.res	2,$00
+_buf:
+	.res	16,$00
+_cnt:
+	.res	1,$00
+_total:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; unsigned char __near__ later (unsigned char c)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_later: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	ldy     #$00
+	lda     (sp),y
+	asl     a
+	ldx     #$00
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ clobber (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_clobber: near
+
+.segment	"CODE"
+
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ tail (unsigned char c)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_tail: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	ldy     #$00
+	lda     (sp),y
+	clc
+	adc     #$01
+	ldx     #$00
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ sum (unsigned int n)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_sum: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$00
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	bne     L0005
+	tax
+	jmp     L0001
+L0005:	jsr     pushw0sp
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	sec
+	sbc     #$01
+	bcs     L0004
+	dex
+L0004:	jsr     _sum
+	jsr     tosaddax
+L0001:	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ f1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f1: near
+
+.segment	"CODE"
+
+	jsr     decsp1
+	lda     #$00
+	tay
+	jmp     L0007
+L0008:	lda     (sp),y
+	jsr     pusha
+	ldy     #$00
+	lda     (sp),y
+	tax
+	lda     (sp),y
+	sta     _buf,x
+	jsr     incsp1
+	inc     _cnt
+	clc
+	lda     #$01
+	adc     (sp),y
+L0007:	sta     (sp),y
+	cmp     #$10
+	bcc     L0008
+	ldx     #$00
+	lda     _cnt
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ f2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f2: near
+
+.segment	"CODE"
+
+	jsr     decsp1
+	lda     #$03
+	jsr     pusha
+	lda     #$00
+	ldy     #$01
+	jmp     L0007
+L0005:	jsr     _clobber
+	ldx     #$00
+	lda     (sp,x)
+	clc
+	ldy     #$01
+	adc     (sp),y
+	bcc     L0008
+	inx
+	clc
+L0008:	adc     _total
+	sta     _total
+	txa
+	adc     _total+1
+	sta     _total+1
+	jsr     _clobber
+	clc
+	tya
+	adc     (sp),y
+L0007:	sta     (sp),y
+	cmp     #$0A
+	bcc     L0005
+	lda     _total
+	ldx     _total+1
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ f3 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f3: near
+
+.segment	"CODE"
+
+	jsr     decsp1
+	jsr     push0
+	ldy     #$02
+	jmp     L0007
+L0008:	lda     (sp),y
+	jsr     pusha
+	ldy     #$00
+	lda     (sp),y
+	clc
+	adc     #$01
+	ldx     #$00
+	jsr     incsp1
+	jsr     addeq0sp
+	lda     _fp
+	ldx     _fp+1
+	jsr     pushax
+	ldy     #$04
+	lda     (sp),y
+	pha
+	ldy     #$00
+	lda     (sp),y
+	sta     jmpvec+1
+	iny
+	lda     (sp),y
+	sta     jmpvec+2
+	pla
+	jsr     jmpvec
+	jsr     incsp2
+	jsr     addeq0sp
+	ldy     #$02
+	lda     (sp),y
+	jsr     _later
+	jsr     addeq0sp
+	inc     _cnt
+	ldy     #$02
+	clc
+	lda     #$01
+	adc     (sp),y
+L0007:	sta     (sp),y
+	cmp     #$0A
+	bcc     L0008
+	dey
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp1
+	jsr     _f1
+	cmp     #$10
+	beq     L0002
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	lda     _cnt
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	bne     L0002
+	inc     _failures+1
+L0002:	lda     #$00
+	tay
+	jmp     L0017
+L0018:	lda     (sp),y
+	tay
+	lda     _buf,y
+	jsr     pusha0
+	ldy     #$02
+	lda     (sp),y
+	jsr     tosicmp0
+	beq     L0008
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$02
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	tay
+	lda     _buf,y
+	jsr     pusha0
+	ldy     #$06
+	jsr     _printf
+	inc     _failures
+	bne     L0008
+	inc     _failures+1
+L0008:	ldy     #$00
+	clc
+	lda     #$01
+	adc     (sp),y
+L0017:	sta     (sp),y
+	cmp     #$10
+	bcc     L0018
+	jsr     _f2
+	cpx     #$00
+	bne     L001A
+	cmp     #$4B
+	beq     L000C
+L001A:	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	lda     _total
+	ldx     _total+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	bne     L000C
+	inc     _failures+1
+L000C:	jsr     _f3
+	cpx     #$00
+	bne     L001B
+	cmp     #$C8
+	beq     L001D
+L001B:	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+	bne     L000F
+	inc     _failures+1
+L000F:	ldx     #$00
+L001D:	lda     _cnt
+	cmp     #$1A
+	beq     L0019
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	lda     _cnt
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	bne     L0013
+	inc     _failures+1
+L0013:	ldx     #$00
+L0019:	lda     #$0A
+	jsr     _sum
+	cpx     #$00
+	bne     L001C
+	cmp     #$37
+	beq     L0014
+L001C:	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldx     #$00
+	lda     #$0A
+	jsr     _sum
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	bne     L0014
+	inc     _failures+1
+L0014:	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	lda     _failures
+	ldx     _failures+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     _failures
+	ldx     _failures+1
+	jmp     incsp1
+
+.endproc
+
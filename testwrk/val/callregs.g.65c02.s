@@ -0,0 +1,670 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "callregs.c", 2106, 1792425835
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_fp:
+	.addr	_tail
+
+.segment	"RODATA"
+
+S000C:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+S0007:
+	.byte	$62,$75,$66,$5B,$25,$75,$5D,$20,$25,$75,$0A,$00
+S000A:
+	.byte	$63,$6E,$74,$20,$25,$75,$0A,$00
+S000B:
+	.byte	$73,$75,$6D,$20,$25,$75,$0A,$00
+S0008:
+	.byte	$66,$32,$20,$25,$75,$0A,$00
+S0006:
+	.byte	$66,$31,$20,$25,$75,$0A,$00
+S0009:
+	.byte	$66,$33,$0A,$00
+
+.segment	"BSS"
+
+_failures:
+	.res	2,$00
+_buf:
+	.res	16,$00
+_cnt:
+	.res	1,$00
+_total:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; unsigned char __near__ later (unsigned char c)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_later: near
+
+	.dbg	func, "later", "00", static, "_later"
+	.dbg	sym, "c", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "callregs.c", 93
+	jsr     pusha
+	.dbg	line, "callregs.c", 94
+	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	jsr     aslax1
+	ldx     #$00
+	jmp     L0001
+	.dbg	line, "callregs.c", 95
+L0001:	jsr     incsp1
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ setb (unsigned char i)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_setb: near
+
+	.dbg	func, "setb", "00", static, "_setb"
+	.dbg	sym, "i", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "callregs.c", 18
+	jsr     pusha
+	.dbg	line, "callregs.c", 19
+	lda     #<(_buf)
+	ldx     #>(_buf)
+	ldy     #$00
+	clc
+	adc     (sp),y
+	bcc     L0002
+	inx
+L0002:	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$00
+	jsr     staspidx
+	.dbg	line, "callregs.c", 20
+	jsr     incsp1
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ inc (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_inc: near
+
+	.dbg	func, "inc", "00", static, "_inc"
+
+.segment	"CODE"
+
+	.dbg	line, "callregs.c", 24
+	ldx     #$00
+	inc     _cnt
+	lda     _cnt
+	.dbg	line, "callregs.c", 25
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ clobber (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_clobber: near
+
+	.dbg	func, "clobber", "00", static, "_clobber"
+
+.segment	"CODE"
+
+	.dbg	line, "callregs.c", 30
+	ldx     #$55
+	.dbg	line, "callregs.c", 31
+	ldy     #$AA
+	.dbg	line, "callregs.c", 32
+	sta     tmp1
+	.dbg	line, "callregs.c", 33
+	sta     ptr1
+	.dbg	line, "callregs.c", 34
+	sta     sreg
+	.dbg	line, "callregs.c", 35
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ add (unsigned char a, unsigned char b)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_add: near
+
+	.dbg	func, "add", "00", static, "_add"
+	.dbg	sym, "a", "00", auto, 1
+	.dbg	sym, "b", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "callregs.c", 38
+	jsr     pusha
+	.dbg	line, "callregs.c", 39
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosaddax
+	ldx     #$00
+	jmp     L0001
+	.dbg	line, "callregs.c", 40
+L0001:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ tail (unsigned char c)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_tail: near
+
+	.dbg	func, "tail", "00", static, "_tail"
+	.dbg	sym, "c", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "callregs.c", 43
+	jsr     pusha
+	.dbg	line, "callregs.c", 44
+	ldy     #$00
+	lda     (sp),y
+	jsr     pusha
+	lda     #$01
+	jsr     _add
+	jmp     L0001
+	.dbg	line, "callregs.c", 45
+L0001:	jsr     incsp1
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ sum (unsigned int n)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_sum: near
+
+	.dbg	func, "sum", "00", static, "_sum"
+	.dbg	sym, "n", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "callregs.c", 48
+	jsr     pushax
+	.dbg	line, "callregs.c", 49
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0003
+	cmp     #$00
+L0003:	jsr     booleq
+	jeq     L0002
+	.dbg	line, "callregs.c", 50
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "callregs.c", 52
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     decax1
+	jsr     _sum
+	jsr     tosaddax
+	jmp     L0001
+	.dbg	line, "callregs.c", 53
+L0001:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ f1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f1: near
+
+	.dbg	func, "f1", "00", static, "_f1"
+	.dbg	sym, "i", "00", auto, -1
+
+.segment	"CODE"
+
+	.dbg	line, "callregs.c", 60
+	jsr     decsp1
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	sta     (sp),y
+	jmp     L0002
+	.dbg	line, "callregs.c", 61
+L0005:	ldy     #$00
+	lda     (sp),y
+	jsr     _setb
+	.dbg	line, "callregs.c", 62
+	jsr     _inc
+	.dbg	line, "callregs.c", 60
+	ldy     #$00
+	ldx     #$00
+	clc
+	lda     #$01
+	adc     (sp),y
+	sta     (sp),y
+	jmp     L0002
+L0002:	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$10
+	jsr     boolult
+	jne     L0005
+	.dbg	line, "callregs.c", 64
+	ldx     #$00
+	lda     _cnt
+	jmp     L0001
+	.dbg	line, "callregs.c", 65
+L0001:	jsr     incsp1
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ f2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f2: near
+
+	.dbg	func, "f2", "00", static, "_f2"
+	.dbg	sym, "i", "00", auto, -1
+	.dbg	sym, "j", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "callregs.c", 70
+	jsr     decsp1
+	lda     #$03
+	jsr     pusha
+	.dbg	line, "callregs.c", 71
+	ldx     #$00
+	lda     #$00
+	ldy     #$01
+	sta     (sp),y
+	jmp     L0002
+	.dbg	line, "callregs.c", 72
+L0005:	jsr     _clobber
+	.dbg	line, "callregs.c", 73
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosaddax
+	clc
+	adc     _total
+	sta     _total
+	txa
+	adc     _total+1
+	sta     _total+1
+	tax
+	lda     _total
+	.dbg	line, "callregs.c", 74
+	jsr     _clobber
+	.dbg	line, "callregs.c", 71
+	ldy     #$01
+	ldx     #$00
+	clc
+	lda     #$01
+	adc     (sp),y
+	sta     (sp),y
+	jmp     L0002
+L0002:	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$0A
+	jsr     boolult
+	jne     L0005
+	.dbg	line, "callregs.c", 76
+	lda     _total
+	ldx     _total+1
+	jmp     L0001
+	.dbg	line, "callregs.c", 77
+L0001:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ f3 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f3: near
+
+	.dbg	func, "f3", "00", static, "_f3"
+	.dbg	sym, "i", "00", auto, -1
+	.dbg	sym, "s", "00", auto, -3
+
+.segment	"CODE"
+
+	.dbg	line, "callregs.c", 82
+	jsr     decsp1
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	.dbg	line, "callregs.c", 83
+	ldx     #$00
+	lda     #$00
+	ldy     #$02
+	sta     (sp),y
+	jmp     L0002
+	.dbg	line, "callregs.c", 84
+L0005:	ldy     #$02
+	lda     (sp),y
+	jsr     _tail
+	ldy     #$00
+	jsr     addeqysp
+	.dbg	line, "callregs.c", 85
+	lda     _fp
+	ldx     _fp+1
+	jsr     pushax
+	ldy     #$04
+	lda     (sp),y
+	pha
+	ldy     #$00
+	lda     (sp),y
+	sta     jmpvec+1
+	iny
+	lda     (sp),y
+	sta     jmpvec+2
+	pla
+	jsr     jmpvec
+	jsr     incsp2
+	ldy     #$00
+	jsr     addeqysp
+	.dbg	line, "callregs.c", 86
+	ldy     #$02
+	lda     (sp),y
+	jsr     _later
+	ldy     #$00
+	jsr     addeqysp
+	.dbg	line, "callregs.c", 87
+	jsr     _inc
+	.dbg	line, "callregs.c", 83
+	ldy     #$02
+	ldx     #$00
+	clc
+	lda     #$01
+	adc     (sp),y
+	sta     (sp),y
+	jmp     L0002
+L0002:	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$0A
+	jsr     boolult
+	jne     L0005
+	.dbg	line, "callregs.c", 89
+	ldy     #$01
+	jsr     ldaxysp
+	jmp     L0001
+	.dbg	line, "callregs.c", 90
+L0001:	jsr     incsp3
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+	.dbg	sym, "i", "00", auto, -1
+
+.segment	"CODE"
+
+	.dbg	line, "callregs.c", 100
+	jsr     decsp1
+	jsr     _f1
+	cmp     #$10
+	jsr     boolne
+	jeq     L0002
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldx     #$00
+	lda     _cnt
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	bne     L0003
+	inc     _failures+1
+L0003:	lda     _failures
+	ldx     _failures+1
+	.dbg	line, "callregs.c", 101
+L0002:	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	sta     (sp),y
+	jmp     L0004
+	.dbg	line, "callregs.c", 102
+L0007:	lda     #<(_buf)
+	ldx     #>(_buf)
+	ldy     #$00
+	clc
+	adc     (sp),y
+	bcc     L0009
+	inx
+L0009:	ldy     #$00
+	jsr     ldauidx
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosneax
+	jeq     L0008
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	lda     #<(_buf)
+	ldx     #>(_buf)
+	ldy     #$04
+	clc
+	adc     (sp),y
+	bcc     L000A
+	inx
+L000A:	ldy     #$00
+	jsr     ldauidx
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	inc     _failures
+	bne     L000B
+	inc     _failures+1
+L000B:	lda     _failures
+	ldx     _failures+1
+	.dbg	line, "callregs.c", 101
+L0008:	ldy     #$00
+	ldx     #$00
+	clc
+	lda     #$01
+	adc     (sp),y
+	sta     (sp),y
+	jmp     L0004
+L0004:	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$10
+	jsr     boolult
+	jne     L0007
+	.dbg	line, "callregs.c", 104
+	jsr     _f2
+	cpx     #$00
+	bne     L000D
+	cmp     #$4B
+L000D:	jsr     boolne
+	jeq     L000C
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	lda     _total
+	ldx     _total+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	bne     L000E
+	inc     _failures+1
+L000E:	lda     _failures
+	ldx     _failures+1
+	.dbg	line, "callregs.c", 105
+L000C:	jsr     _f3
+	cpx     #$00
+	bne     L0010
+	cmp     #$C8
+L0010:	jsr     boolne
+	jeq     L000F
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+	bne     L0011
+	inc     _failures+1
+L0011:	lda     _failures
+	ldx     _failures+1
+	.dbg	line, "callregs.c", 106
+L000F:	ldx     #$00
+	lda     _cnt
+	cmp     #$1A
+	jsr     boolne
+	jeq     L0012
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldx     #$00
+	lda     _cnt
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	bne     L0013
+	inc     _failures+1
+L0013:	lda     _failures
+	ldx     _failures+1
+	.dbg	line, "callregs.c", 107
+L0012:	ldx     #$00
+	lda     #$0A
+	jsr     _sum
+	cpx     #$00
+	bne     L0015
+	cmp     #$37
+L0015:	jsr     boolne
+	jeq     L0014
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldx     #$00
+	lda     #$0A
+	jsr     _sum
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	bne     L0016
+	inc     _failures+1
+L0016:	lda     _failures
+	ldx     _failures+1
+	.dbg	line, "callregs.c", 108
+L0014:	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	lda     _failures
+	ldx     _failures+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "callregs.c", 109
+	lda     _failures
+	ldx     _failures+1
+	jmp     L0001
+	.dbg	line, "callregs.c", 110
+L0001:	jsr     incsp1
+	rts
+
+	.dbg	line
+.endproc
+
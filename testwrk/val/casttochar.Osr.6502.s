@@ -0,0 +1,246 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_f1
+	.export		_f2
+	.export		_f3
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.word	$0000
+
+.segment	"RODATA"
+
+S0007:
+	.byte	$66,$33,$3A,$20,$67,$6F,$74,$20,$3A,$25,$30,$34,$78,$20,$00
+S0004:
+	.byte	$66,$32,$3A,$20,$67,$6F,$74,$20,$3A,$25,$30,$34,$78,$20,$00
+S0001:
+	.byte	$66,$31,$3A,$20,$67,$6F,$74,$20,$3A,$25,$30,$34,$78,$20,$00
+S0005:
+	.byte	$2D,$20,$66,$61,$69,$6C,$65,$64,$00
+S0002	:=	S0005+0
+S0008	:=	S0005+0
+S0006:
+	.byte	$0A,$00
+S0009	:=	S0006+0
+S0003	:=	S0006+0
+
+; ---------------------------------------------------------------
+; int __near__ f1 (int i, int j)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f1: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$02
+	lda     (sp),y
+	clc
+	adc     #$01
+	ldx     #$00
+	cmp     #$80
+	bcc     L0002
+	dex
+L0002:	ldy     #$00
+	cmp     (sp),y
+	bne     L0003
+	txa
+	iny
+	cmp     (sp),y
+L0003:	jsr     booleq
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ f2 (int i, int j)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f2: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$02
+	lda     (sp),y
+	clc
+	adc     #$01
+	ldx     #$00
+	ldy     #$00
+	cmp     (sp),y
+	bne     L0002
+	txa
+	iny
+	cmp     (sp),y
+L0002:	jsr     booleq
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ f3 (int i, int j)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f3: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$02
+	lda     (sp),y
+	clc
+	adc     #$01
+	ldx     #$00
+	ldy     #$00
+	cmp     (sp),y
+	bne     L0002
+	txa
+	iny
+	cmp     (sp),y
+L0002:	jsr     booleq
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldx     #$12
+	lda     #$34
+	jsr     pushax
+	ldx     #$00
+	lda     #$35
+	jsr     _f1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldx     #$12
+	lda     #$34
+	jsr     pushax
+	ldx     #$00
+	lda     #$35
+	jsr     _f1
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+	bne     L0002
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+	bne     L0002
+	inc     _failures+1
+L0002:	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldx     #$12
+	lda     #$34
+	jsr     pushax
+	ldx     #$00
+	lda     #$35
+	jsr     _f2
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldx     #$12
+	lda     #$34
+	jsr     pushax
+	ldx     #$00
+	lda     #$35
+	jsr     _f2
+	cpx     #$00
+	bne     L0005
+	cmp     #$00
+	bne     L0005
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+	bne     L0005
+	inc     _failures+1
+L0005:	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldx     #$12
+	lda     #$34
+	jsr     pushax
+	ldx     #$00
+	lda     #$35
+	jsr     _f3
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldx     #$12
+	lda     #$34
+	jsr     pushax
+	ldx     #$00
+	lda     #$35
+	jsr     _f3
+	cpx     #$00
+	bne     L0008
+	cmp     #$00
+	bne     L0008
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+	bne     L0008
+	inc     _failures+1
+L0008:	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     _failures
+	ldx     _failures+1
+	rts
+
+.endproc
+
@@ -0,0 +1,312 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "casttochar.c", 854, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/stdlib.h", 5999, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_f1
+	.export		_f2
+	.export		_f3
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.word	$0000
+
+.segment	"RODATA"
+
+S0007:
+	.byte	$66,$33,$3A,$20,$67,$6F,$74,$20,$3A,$25,$30,$34,$78,$20,$00
+S0004:
+	.byte	$66,$32,$3A,$20,$67,$6F,$74,$20,$3A,$25,$30,$34,$78,$20,$00
+S0001:
+	.byte	$66,$31,$3A,$20,$67,$6F,$74,$20,$3A,$25,$30,$34,$78,$20,$00
+S0005:
+	.byte	$2D,$20,$66,$61,$69,$6C,$65,$64,$00
+S0002	:=	S0005+0
+S0008	:=	S0005+0
+S0006:
+	.byte	$0A,$00
+S0009	:=	S0006+0
+S0003	:=	S0006+0
+
+; ---------------------------------------------------------------
+; int __near__ f1 (int i, int j)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f1: near
+
+	.dbg	func, "f1", "00", extern, "_f1"
+	.dbg	sym, "i", "00", auto, 2
+	.dbg	sym, "j", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "casttochar.c", 13
+	jsr     pushax
+	.dbg	line, "casttochar.c", 14
+	ldy     #$03
+	jsr     ldaxysp
+	ina
+	bne     L0002
+	inx
+L0002:	ldx     #$00
+	cmp     #$80
+	bcc     L0003
+	dex
+L0003:	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     toseqax
+	jmp     L0001
+	.dbg	line, "casttochar.c", 15
+L0001:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ f2 (int i, int j)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f2: near
+
+	.dbg	func, "f2", "00", extern, "_f2"
+	.dbg	sym, "i", "00", auto, 2
+	.dbg	sym, "j", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "casttochar.c", 17
+	jsr     pushax
+	.dbg	line, "casttochar.c", 18
+	ldy     #$03
+	jsr     ldaxysp
+	ina
+	bne     L0002
+	inx
+L0002:	ldx     #$00
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     toseqax
+	jmp     L0001
+	.dbg	line, "casttochar.c", 19
+L0001:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ f3 (int i, int j)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_f3: near
+
+	.dbg	func, "f3", "00", extern, "_f3"
+	.dbg	sym, "i", "00", auto, 2
+	.dbg	sym, "j", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "casttochar.c", 21
+	jsr     pushax
+	.dbg	line, "casttochar.c", 22
+	ldy     #$03
+	jsr     ldaxysp
+	ina
+	bne     L0002
+	inx
+L0002:	ldx     #$00
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     toseqax
+	jmp     L0001
+	.dbg	line, "casttochar.c", 23
+L0001:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "casttochar.c", 27
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldx     #$12
+	lda     #$34
+	jsr     pushax
+	ldx     #$00
+	lda     #$35
+	jsr     _f1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "casttochar.c", 28
+	ldx     #$12
+	lda     #$34
+	jsr     pushax
+	ldx     #$00
+	lda     #$35
+	jsr     _f1
+	cpx     #$00
+	bne     L0003
+	cmp     #$00
+L0003:	jsr     booleq
+	jeq     L0002
+	.dbg	line, "casttochar.c", 29
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "casttochar.c", 30
+	lda     _failures
+	ldx     _failures+1
+	inc     _failures
+	bne     L0004
+	inc     _failures+1
+L0004:	lda     _failures
+	ldx     _failures+1
+	.dbg	line, "casttochar.c", 32
+L0002:	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "casttochar.c", 34
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldx     #$12
+	lda     #$34
+	jsr     pushax
+	ldx     #$00
+	lda     #$35
+	jsr     _f2
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "casttochar.c", 35
+	ldx     #$12
+	lda     #$34
+	jsr     pushax
+	ldx     #$00
+	lda     #$35
+	jsr     _f2
+	cpx     #$00
+	bne     L0006
+	cmp     #$00
+L0006:	jsr     booleq
+	jeq     L0005
+	.dbg	line, "casttochar.c", 36
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "casttochar.c", 37
+	lda     _failures
+	ldx     _failures+1
+	inc     _failures
+	bne     L0007
+	inc     _failures+1
+L0007:	lda     _failures
+	ldx     _failures+1
+	.dbg	line, "casttochar.c", 39
+L0005:	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "casttochar.c", 41
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldx     #$12
+	lda     #$34
+	jsr     pushax
+	ldx     #$00
+	lda     #$35
+	jsr     _f3
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "casttochar.c", 42
+	ldx     #$12
+	lda     #$34
+	jsr     pushax
+	ldx     #$00
+	lda     #$35
+	jsr     _f3
+	cpx     #$00
+	bne     L0009
+	cmp     #$00
+L0009:	jsr     booleq
+	jeq     L0008
+	.dbg	line, "casttochar.c", 43
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "casttochar.c", 44
+	lda     _failures
+	ldx     _failures+1
+	inc     _failures
+	bne     L000A
+	inc     _failures+1
+L000A:	lda     _failures
+	ldx     _failures+1
+	.dbg	line, "casttochar.c", 46
+L0008:	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "casttochar.c", 48
+	lda     _failures
+	ldx     _failures+1
+	jmp     L0001
+	.dbg	line, "casttochar.c", 49
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,68 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.import		__afailed
+	.export		_baz
+	.export		_main
+
+.segment	"DATA"
+
+_baz:
+	.byte	$00
+	.byte	$01
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$69,$74,$20,$77,$6F,$72,$6B,$73,$20,$3A,$29,$0A,$00
+S0001:
+	.byte	$63,$63,$36,$35,$30,$39,$31,$30,$32,$30,$2E,$63,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     _baz
+	ldx     _baz+1
+	jsr     shrax4
+	jsr     shrax3
+	and     #$0F
+	jsr     pusha
+	lda     #$02
+	ldy     #$00
+	cmp     (sp),y
+	beq     L0003
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$13
+	jsr     __afailed
+L0003:	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	txa
+	jmp     incsp1
+
+.endproc
+
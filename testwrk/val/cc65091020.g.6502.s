@@ -0,0 +1,93 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "cc65091020.c", 403, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/assert.h", 3000, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.dbg		sym, "_afailed", "00", extern, "__afailed"
+	.import		_printf
+	.import		__afailed
+	.export		_baz
+	.export		_main
+
+.segment	"DATA"
+
+_baz:
+	.byte	$00
+	.byte	$01
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$69,$74,$20,$77,$6F,$72,$6B,$73,$20,$3A,$29,$0A,$00
+S0001:
+	.byte	$63,$63,$36,$35,$30,$39,$31,$30,$32,$30,$2E,$63,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+	.dbg	sym, "bar", "00", auto, -1
+
+.segment	"CODE"
+
+	.dbg	line, "cc65091020.c", 17
+	lda     _baz
+	ldx     _baz+1
+	jsr     shrax4
+	jsr     shrax3
+	ldx     #$00
+	and     #$0F
+	ldx     #$00
+	jsr     pusha
+	.dbg	line, "cc65091020.c", 19
+	ldx     #$00
+	lda     #$02
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     toseqax
+	jeq     L0002
+	jmp     L0003
+L0002:	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$13
+	jsr     __afailed
+	.dbg	line, "cc65091020.c", 21
+L0003:	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cc65091020.c", 24
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "cc65091020.c", 25
+L0001:	jsr     incsp1
+	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,95 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_printf
+	.export		_udata
+	.export		__signal
+	.export		_main
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$69,$74,$20,$77,$6F,$72,$6B,$73,$0A,$00
+
+.segment	"BSS"
+
+_udata:
+	.res	36,$00
+
+; ---------------------------------------------------------------
+; int __near__ _signal (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	__signal: near
+
+.segment	"CODE"
+
+	lda     _udata+34
+	ora     _udata+34+1
+	bne     L0004
+	lda     _udata+32
+	ldx     _udata+32+1
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_udata)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_udata)
+	sta     ptr1+1
+	lda     _udata+34
+	ldy     #$00
+	sta     (ptr1),y
+	iny
+	lda     _udata+34+1
+	sta     (ptr1),y
+	ldx     #$00
+	txa
+	rts
+L0004:	ldx     #$FF
+	txa
+	rts
+
+.segment	"RODATA"
+
+M0001:
+	.word	$0000
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     __signal
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	txa
+	jmp     incsp4
+
+.endproc
+
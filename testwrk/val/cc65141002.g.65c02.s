@@ -0,0 +1,134 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "cc65141002.c", 721, 1613073744
+	.dbg		file, "/root/repo/include/stdlib.h", 5999, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_udata
+	.export		__signal
+	.export		_main
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$69,$74,$20,$77,$6F,$72,$6B,$73,$0A,$00
+
+.segment	"BSS"
+
+_udata:
+	.res	36,$00
+
+; ---------------------------------------------------------------
+; int __near__ _signal (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	__signal: near
+
+	.dbg	func, "_signal", "00", extern, "__signal"
+
+.segment	"CODE"
+
+	.dbg	line, "cc65141002.c", 29
+	lda     _udata+34
+	ldx     _udata+34+1
+	cpx     #$00
+	bne     L0003
+	cmp     #$00
+L0003:	jsr     boolne
+	jeq     L0002
+	.dbg	line, "cc65141002.c", 30
+	pha
+	lda     M0001
+	clc
+	adc     sp
+	sta     sp
+	lda     M0001+1
+	adc     sp+1
+	sta     sp+1
+	pla
+	jmp     L0004
+	.dbg	line, "cc65141002.c", 32
+L0002:	lda     _udata+32
+	ldx     _udata+32+1
+	jsr     aslax1
+	clc
+	adc     #<(_udata)
+	tay
+	txa
+	adc     #>(_udata)
+	tax
+	tya
+	jsr     pushax
+	lda     _udata+34
+	ldx     _udata+34+1
+	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "cc65141002.c", 33
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "cc65141002.c", 36
+L0004:	ldx     #$FF
+	lda     #$FF
+	jmp     L0001
+	.dbg	line, "cc65141002.c", 37
+L0001:	rts
+
+	.dbg	line
+.segment	"RODATA"
+
+M0001:
+	.word	$0000
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+	.dbg	sym, "n", "00", auto, 2
+	.dbg	sym, "args", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "cc65141002.c", 41
+	jsr     __signal
+	.dbg	line, "cc65141002.c", 42
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cc65141002.c", 44
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "cc65141002.c", 45
+L0001:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
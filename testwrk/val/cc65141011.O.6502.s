@@ -0,0 +1,188 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.import		_sprintf
+	.export		_main
+
+.segment	"DATA"
+
+_fails:
+	.byte	$04
+
+.segment	"RODATA"
+
+S0007:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+S0002:
+	.byte	$67,$6F,$6F,$64,$3A,$20,$25,$75,$0A,$00
+S0006	:=	S0002+0
+S0005:
+	.byte	$62,$61,$64,$3A,$20,$25,$75,$2C,$20,$00
+S0001	:=	S0005+0
+S0008:
+	.byte	$61,$3A,$20,$25,$75,$2C,$20,$00
+S0009:
+	.byte	$62,$3A,$20,$25,$75,$0A,$00
+S0003:
+	.byte	$25,$75,$00
+S0004	:=	S0003+0
+
+.segment	"BSS"
+
+_bad:
+	.res	3,$00
+_good:
+	.res	3,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #$7E
+	jsr     pusha
+	jsr     decsp4
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$06
+	lda     (sp),y
+	and     #$01
+	jsr     booleq
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$06
+	lda     (sp),y
+	and     #$01
+	jsr     booleq
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	lda     #<(_bad)
+	ldx     #>(_bad)
+	jsr     pushax
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$08
+	lda     (sp),y
+	and     #$01
+	jsr     booleq
+	jsr     pusha0
+	ldy     #$06
+	jsr     _sprintf
+	lda     #<(_good)
+	ldx     #>(_good)
+	jsr     pushax
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$08
+	lda     (sp),y
+	and     #$01
+	jsr     booleq
+	jsr     pusha0
+	ldy     #$06
+	jsr     _sprintf
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldx     #$00
+	lda     _bad
+	ldy     #$30
+	jsr     decaxy
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldx     #$00
+	lda     _good
+	ldy     #$30
+	jsr     decaxy
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     _bad
+	ldy     #$30
+	jsr     decaxy
+	eor     #$FF
+	sec
+	adc     _fails
+	sta     _fails
+	ldx     #$00
+	lda     _good
+	jsr     decaxy
+	eor     #$FF
+	sec
+	adc     _fails
+	sta     _fails
+	ldy     #$04
+	lda     (sp),y
+	and     #$01
+	bne     L0009
+	dec     _fails
+L0009:	lda     (sp),y
+	and     #$01
+	bne     L0005
+	dec     _fails
+L0005:	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	lda     _fails
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldy     #$04
+	lda     (sp),y
+	and     #$01
+	jsr     booleq
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$04
+	lda     (sp),y
+	and     #$01
+	jsr     booleq
+	jsr     stax0sp
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     _fails
+	jmp     incsp5
+
+.endproc
+
@@ -0,0 +1,276 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "cc65141011.c", 1642, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.dbg		sym, "sprintf", "00", extern, "_sprintf"
+	.import		_printf
+	.import		_sprintf
+	.export		_main
+
+.segment	"DATA"
+
+_fails:
+	.byte	$04
+
+.segment	"RODATA"
+
+S0007:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+S0002:
+	.byte	$67,$6F,$6F,$64,$3A,$20,$25,$75,$0A,$00
+S0006	:=	S0002+0
+S0005:
+	.byte	$62,$61,$64,$3A,$20,$25,$75,$2C,$20,$00
+S0001	:=	S0005+0
+S0008:
+	.byte	$61,$3A,$20,$25,$75,$2C,$20,$00
+S0009:
+	.byte	$62,$3A,$20,$25,$75,$0A,$00
+S0003:
+	.byte	$25,$75,$00
+S0004	:=	S0003+0
+
+.segment	"BSS"
+
+_bad:
+	.res	3,$00
+_good:
+	.res	3,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+	.dbg	sym, "joy_state", "00", auto, -1
+	.dbg	sym, "a", "00", auto, -3
+	.dbg	sym, "b", "00", auto, -5
+
+.segment	"CODE"
+
+	.dbg	line, "cc65141011.c", 27
+	lda     #$7E
+	jsr     pusha
+	.dbg	line, "cc65141011.c", 32
+	jsr     decsp4
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldy     #$08
+	ldx     #$00
+	lda     (sp),y
+	ldx     #$00
+	and     #$01
+	jsr     toseqax
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cc65141011.c", 33
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$06
+	ldx     #$00
+	lda     (sp),y
+	ldx     #$00
+	and     #$01
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+L0002:	jsr     booleq
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cc65141011.c", 35
+	lda     #<(_bad)
+	ldx     #>(_bad)
+	jsr     pushax
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldy     #$0A
+	ldx     #$00
+	lda     (sp),y
+	ldx     #$00
+	and     #$01
+	jsr     toseqax
+	jsr     pushax
+	ldy     #$06
+	jsr     _sprintf
+	.dbg	line, "cc65141011.c", 36
+	lda     #<(_good)
+	ldx     #>(_good)
+	jsr     pushax
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$08
+	ldx     #$00
+	lda     (sp),y
+	ldx     #$00
+	and     #$01
+	cpx     #$00
+	bne     L0003
+	cmp     #$00
+L0003:	jsr     booleq
+	jsr     pushax
+	ldy     #$06
+	jsr     _sprintf
+	.dbg	line, "cc65141011.c", 38
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldx     #$00
+	lda     _bad
+	ldy     #$30
+	jsr     decaxy
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cc65141011.c", 39
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldx     #$00
+	lda     _good
+	ldy     #$30
+	jsr     decaxy
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cc65141011.c", 41
+	ldx     #$00
+	lda     _bad
+	ldy     #$30
+	jsr     decaxy
+	ldx     #$00
+	ldx     #$00
+	eor     #$FF
+	sec
+	adc     _fails
+	sta     _fails
+	.dbg	line, "cc65141011.c", 42
+	ldx     #$00
+	lda     _good
+	ldy     #$30
+	jsr     decaxy
+	ldx     #$00
+	ldx     #$00
+	eor     #$FF
+	sec
+	adc     _fails
+	sta     _fails
+	.dbg	line, "cc65141011.c", 44
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldy     #$06
+	ldx     #$00
+	lda     (sp),y
+	ldx     #$00
+	and     #$01
+	jsr     toseqax
+	jeq     L0004
+	ldx     #$00
+	lda     _fails
+	dec     _fails
+	.dbg	line, "cc65141011.c", 45
+L0004:	ldy     #$04
+	ldx     #$00
+	lda     (sp),y
+	ldx     #$00
+	and     #$01
+	cpx     #$00
+	bne     L0006
+	cmp     #$00
+L0006:	jsr     booleq
+	jeq     L0005
+	ldx     #$00
+	lda     _fails
+	dec     _fails
+	.dbg	line, "cc65141011.c", 47
+L0005:	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldx     #$00
+	lda     _fails
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cc65141011.c", 52
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldy     #$06
+	ldx     #$00
+	lda     (sp),y
+	ldx     #$00
+	and     #$01
+	jsr     toseqax
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "cc65141011.c", 53
+	ldy     #$04
+	ldx     #$00
+	lda     (sp),y
+	ldx     #$00
+	and     #$01
+	cpx     #$00
+	bne     L0007
+	cmp     #$00
+L0007:	jsr     booleq
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "cc65141011.c", 55
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cc65141011.c", 56
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cc65141011.c", 58
+	ldx     #$00
+	lda     _fails
+	jmp     L0001
+	.dbg	line, "cc65141011.c", 59
+L0001:	jsr     incsp5
+	rts
+
+	.dbg	line
+.endproc
+
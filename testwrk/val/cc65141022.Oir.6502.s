@@ -0,0 +1,179 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_printf
+	.export		_yycrank
+	.export		_yysvec
+	.export		_fails
+	.export		_main
+
+.segment	"DATA"
+
+_yycrank:
+	.byte	$00
+	.byte	$00
+_fails:
+	.byte	$00
+
+.segment	"RODATA"
+
+S0006:
+	.byte	$79,$79,$63,$72,$61,$6E,$6B,$20,$21,$3D,$20,$79,$79,$73,$74,$61
+	.byte	$74,$65,$2D,$3E,$79,$79,$73,$74,$6F,$66,$66,$20,$28,$66,$61,$69
+	.byte	$6C,$29,$0A,$00
+S0005:
+	.byte	$79,$79,$63,$72,$61,$6E,$6B,$20,$3D,$3D,$20,$79,$79,$73,$74,$61
+	.byte	$74,$65,$2D,$3E,$79,$79,$73,$74,$6F,$66,$66,$20,$28,$6F,$6B,$29
+	.byte	$0A,$00
+S0004:
+	.byte	$79,$79,$74,$20,$21,$3D,$20,$79,$79,$73,$74,$61,$74,$65,$2D,$3E
+	.byte	$79,$79,$73,$74,$6F,$66,$66,$20,$28,$66,$61,$69,$6C,$29,$0A,$00
+S0003:
+	.byte	$79,$79,$74,$20,$3D,$3D,$20,$79,$79,$73,$74,$61,$74,$65,$2D,$3E
+	.byte	$79,$79,$73,$74,$6F,$66,$66,$20,$28,$6F,$6B,$29,$0A,$00
+S0002:
+	.byte	$79,$79,$74,$20,$21,$3D,$20,$79,$79,$63,$72,$61,$6E,$6B,$20,$28
+	.byte	$66,$61,$69,$6C,$29,$0A,$00
+S0001:
+	.byte	$79,$79,$74,$20,$3D,$3D,$20,$79,$79,$63,$72,$61,$6E,$6B,$20,$28
+	.byte	$6F,$6B,$29,$0A,$00
+S0007:
+	.byte	$66,$61,$69,$6C,$73,$3A,$20,$25,$64,$0A,$00
+
+.segment	"BSS"
+
+_yysvec:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #<(_yysvec)
+	ldx     #>(_yysvec)
+	jsr     pushax
+	jsr     decsp2
+	ldy     #$03
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	lda     #<(_yycrank)
+	ldy     #$00
+	sta     (ptr1),y
+	iny
+	lda     #>(_yycrank)
+	sta     (ptr1),y
+	ldy     #$03
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	dey
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     stax0sp
+	cpx     #>(_yycrank)
+	bne     L0002
+	cmp     #<(_yycrank)
+	bne     L0002
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0003
+L0002:	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _fails
+L0003:	jsr     pushw0sp
+	ldy     #$05
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     tosicmp
+	bne     L0004
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0005
+L0004:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _fails
+L0005:	lda     #<(_yycrank)
+	ldx     #>(_yycrank)
+	jsr     pushax
+	ldy     #$05
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     tosicmp
+	bne     L0006
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	jmp     L0007
+L0006:	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _fails
+L0007:	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	lda     _fails
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     _fails
+	jmp     incsp8
+
+.endproc
+
@@ -0,0 +1,202 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "cc65141022.c", 1042, 1613073744
+	.dbg		file, "/root/repo/include/stdlib.h", 5999, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_yycrank
+	.export		_yysvec
+	.export		_fails
+	.export		_main
+
+.segment	"DATA"
+
+_yycrank:
+	.byte	$00
+	.byte	$00
+_fails:
+	.byte	$00
+
+.segment	"RODATA"
+
+S0006:
+	.byte	$79,$79,$63,$72,$61,$6E,$6B,$20,$21,$3D,$20,$79,$79,$73,$74,$61
+	.byte	$74,$65,$2D,$3E,$79,$79,$73,$74,$6F,$66,$66,$20,$28,$66,$61,$69
+	.byte	$6C,$29,$0A,$00
+S0005:
+	.byte	$79,$79,$63,$72,$61,$6E,$6B,$20,$3D,$3D,$20,$79,$79,$73,$74,$61
+	.byte	$74,$65,$2D,$3E,$79,$79,$73,$74,$6F,$66,$66,$20,$28,$6F,$6B,$29
+	.byte	$0A,$00
+S0004:
+	.byte	$79,$79,$74,$20,$21,$3D,$20,$79,$79,$73,$74,$61,$74,$65,$2D,$3E
+	.byte	$79,$79,$73,$74,$6F,$66,$66,$20,$28,$66,$61,$69,$6C,$29,$0A,$00
+S0003:
+	.byte	$79,$79,$74,$20,$3D,$3D,$20,$79,$79,$73,$74,$61,$74,$65,$2D,$3E
+	.byte	$79,$79,$73,$74,$6F,$66,$66,$20,$28,$6F,$6B,$29,$0A,$00
+S0002:
+	.byte	$79,$79,$74,$20,$21,$3D,$20,$79,$79,$63,$72,$61,$6E,$6B,$20,$28
+	.byte	$66,$61,$69,$6C,$29,$0A,$00
+S0001:
+	.byte	$79,$79,$74,$20,$3D,$3D,$20,$79,$79,$63,$72,$61,$6E,$6B,$20,$28
+	.byte	$6F,$6B,$29,$0A,$00
+S0007:
+	.byte	$66,$61,$69,$6C,$73,$3A,$20,$25,$64,$0A,$00
+
+.segment	"BSS"
+
+_yysvec:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+	.dbg	sym, "n", "00", auto, 2
+	.dbg	sym, "args", "00", auto, 0
+	.dbg	sym, "yystate", "00", auto, -2
+	.dbg	sym, "yyt", "00", auto, -4
+
+.segment	"CODE"
+
+	.dbg	line, "cc65141022.c", 28
+	lda     #<(_yysvec)
+	ldx     #>(_yysvec)
+	jsr     pushax
+	.dbg	line, "cc65141022.c", 31
+	jsr     decsp2
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	lda     #<(_yycrank)
+	ldx     #>(_yycrank)
+	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "cc65141022.c", 32
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "cc65141022.c", 34
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	lda     #<(_yycrank)
+	ldx     #>(_yycrank)
+	jsr     toseqax
+	jeq     L0002
+	.dbg	line, "cc65141022.c", 35
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cc65141022.c", 36
+	jmp     L0003
+	.dbg	line, "cc65141022.c", 37
+L0002:	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cc65141022.c", 38
+	ldx     #$00
+	inc     _fails
+	lda     _fails
+	.dbg	line, "cc65141022.c", 41
+L0003:	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     toseqax
+	jeq     L0004
+	.dbg	line, "cc65141022.c", 42
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cc65141022.c", 43
+	jmp     L0005
+	.dbg	line, "cc65141022.c", 44
+L0004:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cc65141022.c", 45
+	ldx     #$00
+	inc     _fails
+	lda     _fails
+	.dbg	line, "cc65141022.c", 48
+L0005:	lda     #<(_yycrank)
+	ldx     #>(_yycrank)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     toseqax
+	jeq     L0006
+	.dbg	line, "cc65141022.c", 49
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cc65141022.c", 50
+	jmp     L0007
+	.dbg	line, "cc65141022.c", 51
+L0006:	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cc65141022.c", 52
+	ldx     #$00
+	inc     _fails
+	lda     _fails
+	.dbg	line, "cc65141022.c", 55
+L0007:	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldx     #$00
+	lda     _fails
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cc65141022.c", 56
+	ldx     #$00
+	lda     _fails
+	jmp     L0001
+	.dbg	line, "cc65141022.c", 57
+L0001:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,73 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.export		_main
+
+.segment	"BSS"
+
+_p:
+	.res	2,$00
+_n:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; int __near__ func (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_func: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #>(_func)
+	sta     _p+1
+	lda     #<(_func)
+	sta     _p
+	lda     #<(_func)
+	ldx     #>(_func)
+	cpx     #>(_func)
+	bne     L0002
+	cmp     #<(_func)
+L0002:	jsr     booleq
+	sta     _n
+	stz     _n+1
+	lda     #<(_func)
+	ldx     #>(_func)
+	cpx     _p+1
+	bne     L0003
+	cmp     _p
+L0003:	jsr     booleq
+	sta     _n
+	stz     _n+1
+	txa
+	rts
+
+.endproc
+
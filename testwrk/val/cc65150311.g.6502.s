@@ -0,0 +1,89 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "cc65150311.c", 720, 1613073744
+	.forceimport	__STARTUP__
+	.export		_main
+
+.segment	"BSS"
+
+_p:
+	.res	2,$00
+_n:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; int __near__ func (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_func: near
+
+	.dbg	func, "func", "00", static, "_func"
+
+.segment	"CODE"
+
+	.dbg	line, "cc65150311.c", 13
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "cc65150311.c", 19
+	lda     #<(_func)
+	ldx     #>(_func)
+	sta     _p
+	stx     _p+1
+	.dbg	line, "cc65150311.c", 20
+	lda     _p
+	ldx     _p+1
+	jsr     pushax
+	lda     #<(_func)
+	ldx     #>(_func)
+	jsr     toseqax
+	sta     _n
+	stx     _n+1
+	.dbg	line, "cc65150311.c", 21
+	lda     _p
+	ldx     _p+1
+	jsr     pushax
+	lda     #<(_func)
+	ldx     #>(_func)
+	jsr     toseqax
+	sta     _n
+	stx     _n+1
+	.dbg	line, "cc65150311.c", 37
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "cc65150311.c", 38
+L0001:	rts
+
+	.dbg	line
+.endproc
+
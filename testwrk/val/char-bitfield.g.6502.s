@@ -0,0 +1,846 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "char-bitfield.c", 6356, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_sc
+	.export		_uc
+	.export		_pc
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+_fb:
+	.byte	$01
+_fbs:
+	.byte	$01
+_fbp:
+	.byte	$01
+_fbi:
+	.byte	$01
+	.byte	$02
+_o:
+	.byte	$7B
+_fw:
+	.byte	$FF
+_ae:
+	.byte	$FC
+	.byte	$88
+_sc:
+	.byte	$01
+_uc:
+	.byte	$01
+_pc:
+	.byte	$01
+
+.segment	"RODATA"
+
+S000A:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$20,$28,$73,$74,$72,$75
+	.byte	$63,$74,$20,$66,$6F,$75,$72,$5F,$62,$69,$74,$73,$5F,$77,$69,$74
+	.byte	$68,$5F,$63,$68,$61,$72,$29,$20,$3D,$20,$25,$7A,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$32,$2E,$0A,$00
+S0017:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$20,$28,$73,$74,$72,$75
+	.byte	$63,$74,$20,$61,$6C,$69,$67,$6E,$65,$64,$5F,$65,$6E,$64,$29,$20
+	.byte	$3D,$20,$25,$7A,$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20
+	.byte	$32,$2E,$0A,$00
+S0014:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$20,$28,$73,$74,$72,$75
+	.byte	$63,$74,$20,$66,$75,$6C,$6C,$5F,$77,$69,$64,$74,$68,$29,$20,$3D
+	.byte	$20,$25,$7A,$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31
+	.byte	$2E,$0A,$00
+S000F:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$20,$28,$73,$74,$72,$75
+	.byte	$63,$74,$20,$74,$77,$6F,$5F,$63,$68,$61,$72,$73,$29,$20,$3D,$20
+	.byte	$25,$7A,$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E
+	.byte	$0A,$00
+S0001:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$20,$28,$73,$74,$72,$75
+	.byte	$63,$74,$20,$66,$6F,$75,$72,$5F,$62,$69,$74,$73,$29,$20,$3D,$20
+	.byte	$25,$7A,$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E
+	.byte	$0A,$00
+S000E:
+	.byte	$47,$6F,$74,$20,$66,$62,$69,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$37,$2E,$0A,$00
+S0015:
+	.byte	$47,$6F,$74,$20,$66,$77,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$32,$35,$35,$2E,$0A,$00
+S000B:
+	.byte	$47,$6F,$74,$20,$66,$62,$69,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A,$00
+S001C:
+	.byte	$47,$6F,$74,$20,$73,$63,$2E,$78,$20,$3D,$20,$25,$64,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$2D,$31,$2E,$0A,$00
+S001B:
+	.byte	$47,$6F,$74,$20,$61,$65,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$35,$2E,$0A,$00
+S001A:
+	.byte	$47,$6F,$74,$20,$61,$65,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$34,$32,$2E,$0A,$00
+S0019:
+	.byte	$47,$6F,$74,$20,$61,$65,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$37,$2E,$0A,$00
+S0018:
+	.byte	$47,$6F,$74,$20,$61,$65,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$36,$33,$2E,$0A,$00
+S000D:
+	.byte	$47,$6F,$74,$20,$66,$62,$69,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$33,$2E,$0A,$00
+S0016:
+	.byte	$47,$6F,$74,$20,$66,$77,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$34,$32,$2E,$0A,$00
+S000C:
+	.byte	$47,$6F,$74,$20,$66,$62,$69,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$32,$2E,$0A,$00
+S0003:
+	.byte	$47,$6F,$74,$20,$66,$62,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$33,$2E,$0A,$00
+S001E:
+	.byte	$47,$6F,$74,$20,$70,$63,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A,$00
+S001D:
+	.byte	$47,$6F,$74,$20,$75,$63,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A,$00
+S0010:
+	.byte	$47,$6F,$74,$20,$6F,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65,$78
+	.byte	$70,$65,$63,$74,$65,$64,$20,$31,$31,$2E,$0A,$00
+S0002:
+	.byte	$47,$6F,$74,$20,$66,$62,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A,$00
+S0012:
+	.byte	$47,$6F,$74,$20,$6F,$2E,$78,$20,$3D,$20,$25,$75,$2C,$20,$65,$78
+	.byte	$70,$65,$63,$74,$65,$64,$20,$33,$2E,$0A,$00
+S0013:
+	.byte	$47,$6F,$74,$20,$6F,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65,$78
+	.byte	$70,$65,$63,$74,$65,$64,$20,$34,$2E,$0A,$00
+S0011:
+	.byte	$47,$6F,$74,$20,$6F,$2E,$79,$20,$3D,$20,$25,$75,$2C,$20,$65,$78
+	.byte	$70,$65,$63,$74,$65,$64,$20,$37,$2E,$0A,$00
+S001F:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ test_four_bits (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_four_bits: near
+
+	.dbg	func, "test_four_bits", "00", static, "_test_four_bits"
+
+.segment	"CODE"
+
+	.dbg	line, "char-bitfield.c", 35
+	jmp     L0002
+	.dbg	line, "char-bitfield.c", 36
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	.dbg	line, "char-bitfield.c", 37
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "char-bitfield.c", 38
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "char-bitfield.c", 41
+L0002:	lda     _fb
+	ldx     #$00
+	and     #$0F
+	cmp     #$01
+	jsr     boolne
+	jeq     L0003
+	.dbg	line, "char-bitfield.c", 42
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     _fb
+	ldx     #$00
+	and     #$0F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "char-bitfield.c", 43
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "char-bitfield.c", 46
+L0003:	ldx     #$00
+	lda     _fb
+	and     #$F0
+	ora     #$03
+	sta     _fb
+	.dbg	line, "char-bitfield.c", 48
+	lda     _fb
+	ldx     #$00
+	and     #$0F
+	cmp     #$03
+	jsr     boolne
+	jeq     L0004
+	.dbg	line, "char-bitfield.c", 49
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     _fb
+	ldx     #$00
+	and     #$0F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "char-bitfield.c", 50
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "char-bitfield.c", 52
+L0004:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_four_bits_with_char (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_four_bits_with_char: near
+
+	.dbg	func, "test_four_bits_with_char", "00", static, "_test_four_bits_with_char"
+
+.segment	"CODE"
+
+	.dbg	line, "char-bitfield.c", 116
+	jmp     L0002
+	.dbg	line, "char-bitfield.c", 117
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	.dbg	line, "char-bitfield.c", 118
+	ldx     #$00
+	lda     #$02
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "char-bitfield.c", 119
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "char-bitfield.c", 122
+L0002:	lda     _fbi
+	ldx     #$00
+	and     #$0F
+	cmp     #$01
+	jsr     boolne
+	jeq     L0003
+	.dbg	line, "char-bitfield.c", 123
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	lda     _fbi
+	ldx     #$00
+	and     #$0F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "char-bitfield.c", 124
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "char-bitfield.c", 127
+L0003:	ldx     #$00
+	lda     _fbi+1
+	cmp     #$02
+	jsr     boolne
+	jeq     L0004
+	.dbg	line, "char-bitfield.c", 128
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	ldx     #$00
+	lda     _fbi+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "char-bitfield.c", 129
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "char-bitfield.c", 132
+L0004:	ldx     #$00
+	lda     _fbi
+	and     #$F0
+	ora     #$03
+	sta     _fbi
+	.dbg	line, "char-bitfield.c", 133
+	ldx     #$00
+	lda     #$11
+	sta     _fbi+1
+	.dbg	line, "char-bitfield.c", 135
+	lda     _fbi
+	ldx     #$00
+	and     #$0F
+	cmp     #$03
+	jsr     boolne
+	jeq     L0005
+	.dbg	line, "char-bitfield.c", 136
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	lda     _fbi
+	ldx     #$00
+	and     #$0F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "char-bitfield.c", 137
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "char-bitfield.c", 140
+L0005:	ldx     #$00
+	lda     _fbi+1
+	cmp     #$11
+	jsr     boolne
+	jeq     L0006
+	.dbg	line, "char-bitfield.c", 141
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	ldx     #$00
+	lda     _fbi+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "char-bitfield.c", 142
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "char-bitfield.c", 144
+L0006:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_two_chars (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_two_chars: near
+
+	.dbg	func, "test_two_chars", "00", static, "_test_two_chars"
+
+.segment	"CODE"
+
+	.dbg	line, "char-bitfield.c", 154
+	jmp     L0002
+	.dbg	line, "char-bitfield.c", 155
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	.dbg	line, "char-bitfield.c", 156
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "char-bitfield.c", 157
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "char-bitfield.c", 160
+L0002:	lda     _o
+	ldx     #$00
+	and     #$0F
+	cmp     #$0B
+	jsr     boolne
+	jeq     L0003
+	.dbg	line, "char-bitfield.c", 161
+	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	lda     _o
+	ldx     #$00
+	and     #$0F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "char-bitfield.c", 162
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "char-bitfield.c", 165
+L0003:	lda     _o
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	cmp     #$07
+	jsr     boolne
+	jeq     L0004
+	.dbg	line, "char-bitfield.c", 166
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	lda     _o
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "char-bitfield.c", 167
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "char-bitfield.c", 170
+L0004:	ldx     #$00
+	lda     _o
+	and     #$F0
+	ora     #$03
+	sta     _o
+	.dbg	line, "char-bitfield.c", 171
+	ldx     #$00
+	lda     _o
+	and     #$0F
+	ora     #$40
+	sta     _o
+	.dbg	line, "char-bitfield.c", 173
+	lda     _o
+	ldx     #$00
+	and     #$0F
+	cmp     #$03
+	jsr     boolne
+	jeq     L0005
+	.dbg	line, "char-bitfield.c", 174
+	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	lda     _o
+	ldx     #$00
+	and     #$0F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "char-bitfield.c", 175
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "char-bitfield.c", 178
+L0005:	lda     _o
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	cmp     #$04
+	jsr     boolne
+	jeq     L0006
+	.dbg	line, "char-bitfield.c", 179
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	lda     _o
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "char-bitfield.c", 180
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "char-bitfield.c", 182
+L0006:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_full_width (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_full_width: near
+
+	.dbg	func, "test_full_width", "00", static, "_test_full_width"
+
+.segment	"CODE"
+
+	.dbg	line, "char-bitfield.c", 190
+	jmp     L0002
+	.dbg	line, "char-bitfield.c", 191
+	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	.dbg	line, "char-bitfield.c", 192
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "char-bitfield.c", 193
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "char-bitfield.c", 196
+L0002:	ldx     #$00
+	lda     _fw
+	cmp     #$FF
+	jsr     boolne
+	jeq     L0003
+	.dbg	line, "char-bitfield.c", 197
+	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+	ldx     #$00
+	lda     _fw
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "char-bitfield.c", 198
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "char-bitfield.c", 201
+L0003:	ldx     #$00
+	lda     _fw
+	lda     #$00
+	ora     #$2A
+	sta     _fw
+	.dbg	line, "char-bitfield.c", 203
+	ldx     #$00
+	lda     _fw
+	cmp     #$2A
+	jsr     boolne
+	jeq     L0004
+	.dbg	line, "char-bitfield.c", 204
+	lda     #<(S0016)
+	ldx     #>(S0016)
+	jsr     pushax
+	ldx     #$00
+	lda     _fw
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "char-bitfield.c", 205
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "char-bitfield.c", 207
+L0004:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_aligned_end (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_aligned_end: near
+
+	.dbg	func, "test_aligned_end", "00", static, "_test_aligned_end"
+
+.segment	"CODE"
+
+	.dbg	line, "char-bitfield.c", 218
+	jmp     L0002
+	.dbg	line, "char-bitfield.c", 219
+	lda     #<(S0017)
+	ldx     #>(S0017)
+	jsr     pushax
+	.dbg	line, "char-bitfield.c", 220
+	ldx     #$00
+	lda     #$02
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "char-bitfield.c", 221
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "char-bitfield.c", 224
+L0002:	lda     _ae
+	lsr     a
+	lsr     a
+	ldx     #$00
+	cmp     #$3F
+	jsr     boolne
+	jeq     L0003
+	.dbg	line, "char-bitfield.c", 225
+	lda     #<(S0018)
+	ldx     #>(S0018)
+	jsr     pushax
+	lda     _ae
+	lsr     a
+	lsr     a
+	ldx     #$00
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "char-bitfield.c", 226
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "char-bitfield.c", 229
+L0003:	lda     _ae+1
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	cmp     #$11
+	jsr     boolne
+	jeq     L0004
+	.dbg	line, "char-bitfield.c", 230
+	lda     #<(S0019)
+	ldx     #>(S0019)
+	jsr     pushax
+	lda     _ae+1
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "char-bitfield.c", 231
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "char-bitfield.c", 234
+L0004:	ldx     #$00
+	lda     _ae
+	and     #$03
+	ora     #$A8
+	sta     _ae
+	.dbg	line, "char-bitfield.c", 235
+	ldx     #$00
+	lda     _ae+1
+	and     #$07
+	ora     #$78
+	sta     _ae+1
+	.dbg	line, "char-bitfield.c", 237
+	lda     _ae
+	lsr     a
+	lsr     a
+	ldx     #$00
+	cmp     #$2A
+	jsr     boolne
+	jeq     L0005
+	.dbg	line, "char-bitfield.c", 238
+	lda     #<(S001A)
+	ldx     #>(S001A)
+	jsr     pushax
+	lda     _ae
+	lsr     a
+	lsr     a
+	ldx     #$00
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "char-bitfield.c", 239
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "char-bitfield.c", 242
+L0005:	lda     _ae+1
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	cmp     #$0F
+	jsr     boolne
+	jeq     L0006
+	.dbg	line, "char-bitfield.c", 243
+	lda     #<(S001B)
+	ldx     #>(S001B)
+	jsr     pushax
+	lda     _ae+1
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "char-bitfield.c", 244
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "char-bitfield.c", 246
+L0006:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_signedness (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_signedness: near
+
+	.dbg	func, "test_signedness", "00", static, "_test_signedness"
+
+.segment	"CODE"
+
+	.dbg	line, "char-bitfield.c", 254
+	lda     _sc
+	tay
+	and     #$01
+	beq     L0003
+	tya
+	ora     #$FE
+	ldx     #$FF
+	jmp     L0004
+L0003:	tya
+	ldx     #$00
+	and     #$01
+L0004:	cmp     #$FF
+	jsr     boolne
+	jeq     L0002
+	.dbg	line, "char-bitfield.c", 255
+	lda     #<(S001C)
+	ldx     #>(S001C)
+	jsr     pushax
+	lda     _sc
+	tay
+	and     #$01
+	beq     L0005
+	tya
+	ora     #$FE
+	ldx     #$FF
+	jmp     L0006
+L0005:	tya
+	ldx     #$00
+	and     #$01
+L0006:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "char-bitfield.c", 256
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "char-bitfield.c", 259
+L0002:	lda     _uc
+	ldx     #$00
+	and     #$01
+	cmp     #$01
+	jsr     boolne
+	jeq     L0007
+	.dbg	line, "char-bitfield.c", 260
+	lda     #<(S001D)
+	ldx     #>(S001D)
+	jsr     pushax
+	lda     _uc
+	ldx     #$00
+	and     #$01
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "char-bitfield.c", 261
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "char-bitfield.c", 264
+L0007:	lda     _pc
+	ldx     #$00
+	and     #$01
+	cmp     #$01
+	jsr     boolne
+	jeq     L0008
+	.dbg	line, "char-bitfield.c", 265
+	lda     #<(S001E)
+	ldx     #>(S001E)
+	jsr     pushax
+	lda     _pc
+	ldx     #$00
+	and     #$01
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "char-bitfield.c", 266
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "char-bitfield.c", 268
+L0008:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "char-bitfield.c", 272
+	jsr     _test_four_bits
+	.dbg	line, "char-bitfield.c", 273
+	jsr     _test_four_bits_with_char
+	.dbg	line, "char-bitfield.c", 274
+	jsr     _test_two_chars
+	.dbg	line, "char-bitfield.c", 275
+	jsr     _test_full_width
+	.dbg	line, "char-bitfield.c", 276
+	jsr     _test_aligned_end
+	.dbg	line, "char-bitfield.c", 277
+	jsr     _test_signedness
+	.dbg	line, "char-bitfield.c", 278
+	lda     #<(S001F)
+	ldx     #>(S001F)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "char-bitfield.c", 279
+	ldx     #$00
+	lda     _failures
+	jmp     L0001
+	.dbg	line, "char-bitfield.c", 280
+L0001:	rts
+
+	.dbg	line
+.endproc
+
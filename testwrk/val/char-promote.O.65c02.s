@@ -0,0 +1,409 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_stderr
+	.import		_fprintf
+	.import		_printf
+	.export		_test_sub
+	.export		_test_mul
+	.export		_test_div
+	.export		_test_mod
+	.export		_test_shr
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+
+.segment	"RODATA"
+
+S0005:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$74,$77,$6F,$5F,$66,$69,$66
+	.byte	$74,$79,$5F,$66,$69,$76,$65,$20,$2A,$20,$74,$77,$6F,$5F,$66,$69
+	.byte	$66,$74,$79,$5F,$66,$69,$76,$65,$20,$3D,$3D,$20,$2D,$35,$31,$31
+	.byte	$0A,$00
+S000C:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$28,$75,$38,$29,$20,$34,$32
+	.byte	$20,$3E,$3E,$20,$28,$75,$38,$29,$20,$32,$20,$3D,$3D,$20,$31,$30
+	.byte	$2C,$20,$67,$6F,$74,$3A,$20,$25,$64,$0A,$00
+S000B:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$66,$6F,$72,$74,$79,$5F,$74
+	.byte	$77,$6F,$20,$3E,$3E,$20,$74,$77,$6F,$20,$3D,$3D,$20,$31,$30,$2C
+	.byte	$20,$67,$6F,$74,$3A,$20,$25,$64,$0A,$00
+S0007:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$73,$65,$76,$65,$6E,$74,$65
+	.byte	$65,$6E,$20,$2F,$20,$74,$68,$72,$65,$65,$20,$3D,$3D,$20,$35,$2C
+	.byte	$20,$67,$6F,$74,$3A,$20,$25,$64,$0A,$00
+S0008:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$28,$75,$38,$29,$20,$31,$37
+	.byte	$20,$2F,$20,$28,$75,$38,$29,$20,$33,$20,$3D,$3D,$20,$35,$2C,$20
+	.byte	$67,$6F,$74,$3A,$20,$25,$64,$0A,$00
+S000D:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$66,$6F,$72,$74,$79,$5F,$74
+	.byte	$77,$6F,$20,$3E,$3E,$20,$32,$20,$3D,$3D,$20,$31,$30,$2C,$20,$67
+	.byte	$6F,$74,$3A,$20,$25,$64,$0A,$00
+S000A:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$73,$65,$76,$65,$6E,$74,$65
+	.byte	$65,$6E,$20,$25,$25,$20,$34,$20,$3D,$3D,$20,$31,$2C,$20,$67,$6F
+	.byte	$74,$3A,$20,$25,$64,$0A,$00
+S0009:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$73,$65,$76,$65,$6E,$74,$65
+	.byte	$65,$6E,$20,$2F,$20,$34,$20,$3D,$3D,$20,$34,$2C,$20,$67,$6F,$74
+	.byte	$3A,$20,$25,$64,$0A,$00
+S0006:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$73,$69,$78,$74,$65,$65,$6E
+	.byte	$20,$2A,$20,$34,$20,$3D,$3D,$20,$36,$34,$2C,$20,$67,$6F,$74,$3A
+	.byte	$20,$25,$64,$0A,$00
+S000E:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$34,$32,$20,$3E,$3E,$20,$74
+	.byte	$77,$6F,$20,$3D,$3D,$20,$31,$30,$2C,$20,$67,$6F,$74,$3A,$20,$25
+	.byte	$64,$0A,$00
+S0004:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$32,$35,$35,$55,$20,$2A,$20
+	.byte	$32,$35,$35,$55,$20,$3D,$3D,$20,$36,$35,$30,$32,$35,$55,$0A,$00
+S0003:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$28,$75,$38,$29,$20,$31,$20
+	.byte	$2D,$20,$28,$75,$38,$29,$20,$32,$20,$3C,$20,$30,$0A,$00
+S0002:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$6F,$6E,$65,$20,$2D,$20,$74
+	.byte	$77,$6F,$20,$3C,$20,$30,$0A,$00
+S0001:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$31,$55,$20,$2D,$20,$32,$55
+	.byte	$20,$3E,$20,$30,$0A,$00
+S000F:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ test_sub (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_sub: near
+
+.segment	"CODE"
+
+	lda     #$01
+	jsr     pusha
+	ina
+	jsr     pusha
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	sec
+	sbc     (sp)
+	pha
+	txa
+	sbc     #$00
+	tax
+	pla
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvs     L0004
+	eor     #$80
+L0004:	bpl     L0005
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$04
+	jsr     _fprintf
+	inc     _failures
+L0005:	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_mul (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_mul: near
+
+.segment	"CODE"
+
+	lda     #$FF
+	jsr     pusha
+	lda     #$10
+	jsr     pusha
+	jsr     decsp2
+	ldy     #$03
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosumula0
+	cpx     #$FE
+	bne     L0007
+	cmp     #$01
+	beq     L0003
+L0007:	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$04
+	jsr     _fprintf
+	inc     _failures
+L0003:	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     shlax2
+	jsr     stax0sp
+	cpx     #$00
+	bne     L0008
+	cmp     #$40
+	beq     L0005
+L0008:	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$06
+	jsr     _fprintf
+	inc     _failures
+L0005:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_div (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_div: near
+
+.segment	"CODE"
+
+	lda     #$11
+	jsr     pusha
+	lda     #$03
+	jsr     pusha
+	jsr     decsp2
+	ldy     #$03
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     tosudiva0
+	cpx     #$00
+	bne     L0007
+	cmp     #$05
+	beq     L0004
+L0007:	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$07
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$08
+	lda     (sp),y
+	jsr     tosudiva0
+	jsr     pushax
+	ldy     #$06
+	jsr     _fprintf
+	inc     _failures
+L0004:	ldy     #$03
+	ldx     #$00
+	lda     (sp),y
+	lsr     a
+	lsr     a
+	jsr     stax0sp
+	cmp     #$04
+	beq     L0005
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$06
+	jsr     _fprintf
+	inc     _failures
+L0005:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_mod (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_mod: near
+
+.segment	"CODE"
+
+	lda     #$11
+	jsr     pusha
+	lda     (sp)
+	and     #$03
+	jsr     pusha0
+	ldy     #$01
+	lda     (sp),y
+	bne     L0004
+	lda     (sp)
+	cmp     #$01
+	beq     L0002
+L0004:	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$06
+	jsr     _fprintf
+	inc     _failures
+L0002:	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_shr (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_shr: near
+
+.segment	"CODE"
+
+	lda     #$2A
+	jsr     pusha0
+	lda     #$02
+	jsr     pusha0
+	jsr     decsp2
+	ldy     #$05
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$02
+	lda     (sp),y
+	tay
+	lda     ptr1
+	ldx     ptr1+1
+	jsr     shraxy
+	cpx     #$00
+	bne     L0009
+	cmp     #$0A
+	beq     L0004
+L0009:	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$06
+	lda     (sp),y
+	tay
+	lda     ptr1
+	ldx     ptr1+1
+	jsr     shraxy
+	jsr     pushax
+	ldy     #$06
+	jsr     _fprintf
+	inc     _failures
+L0004:	ldy     #$05
+	jsr     ldaxysp
+	jsr     shrax2
+	jsr     stax0sp
+	cpx     #$00
+	bne     L000A
+	cmp     #$0A
+	beq     L0005
+L000A:	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$06
+	jsr     _fprintf
+	inc     _failures
+L0005:	ldy     #$02
+	lda     (sp),y
+	tay
+	lda     #$2A
+	ldx     #$00
+	jsr     asraxy
+	jsr     stax0sp
+	cpx     #$00
+	bne     L000B
+	cmp     #$0A
+	beq     L0007
+L000B:	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$06
+	jsr     _fprintf
+	inc     _failures
+L0007:	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     _test_sub
+	jsr     _test_mul
+	jsr     _test_div
+	jsr     _test_mod
+	jsr     _test_shr
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     _failures
+	rts
+
+.endproc
+
@@ -0,0 +1,637 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "char-promote.c", 4997, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "stderr", "00", extern, "_stderr"
+	.dbg		sym, "fprintf", "00", extern, "_fprintf"
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_stderr
+	.import		_fprintf
+	.import		_printf
+	.export		_test_sub
+	.export		_test_mul
+	.export		_test_div
+	.export		_test_mod
+	.export		_test_shr
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+
+.segment	"RODATA"
+
+S0005:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$74,$77,$6F,$5F,$66,$69,$66
+	.byte	$74,$79,$5F,$66,$69,$76,$65,$20,$2A,$20,$74,$77,$6F,$5F,$66,$69
+	.byte	$66,$74,$79,$5F,$66,$69,$76,$65,$20,$3D,$3D,$20,$2D,$35,$31,$31
+	.byte	$0A,$00
+S000C:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$28,$75,$38,$29,$20,$34,$32
+	.byte	$20,$3E,$3E,$20,$28,$75,$38,$29,$20,$32,$20,$3D,$3D,$20,$31,$30
+	.byte	$2C,$20,$67,$6F,$74,$3A,$20,$25,$64,$0A,$00
+S000B:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$66,$6F,$72,$74,$79,$5F,$74
+	.byte	$77,$6F,$20,$3E,$3E,$20,$74,$77,$6F,$20,$3D,$3D,$20,$31,$30,$2C
+	.byte	$20,$67,$6F,$74,$3A,$20,$25,$64,$0A,$00
+S0007:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$73,$65,$76,$65,$6E,$74,$65
+	.byte	$65,$6E,$20,$2F,$20,$74,$68,$72,$65,$65,$20,$3D,$3D,$20,$35,$2C
+	.byte	$20,$67,$6F,$74,$3A,$20,$25,$64,$0A,$00
+S0008:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$28,$75,$38,$29,$20,$31,$37
+	.byte	$20,$2F,$20,$28,$75,$38,$29,$20,$33,$20,$3D,$3D,$20,$35,$2C,$20
+	.byte	$67,$6F,$74,$3A,$20,$25,$64,$0A,$00
+S000D:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$66,$6F,$72,$74,$79,$5F,$74
+	.byte	$77,$6F,$20,$3E,$3E,$20,$32,$20,$3D,$3D,$20,$31,$30,$2C,$20,$67
+	.byte	$6F,$74,$3A,$20,$25,$64,$0A,$00
+S000A:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$73,$65,$76,$65,$6E,$74,$65
+	.byte	$65,$6E,$20,$25,$25,$20,$34,$20,$3D,$3D,$20,$31,$2C,$20,$67,$6F
+	.byte	$74,$3A,$20,$25,$64,$0A,$00
+S0009:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$73,$65,$76,$65,$6E,$74,$65
+	.byte	$65,$6E,$20,$2F,$20,$34,$20,$3D,$3D,$20,$34,$2C,$20,$67,$6F,$74
+	.byte	$3A,$20,$25,$64,$0A,$00
+S0006:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$73,$69,$78,$74,$65,$65,$6E
+	.byte	$20,$2A,$20,$34,$20,$3D,$3D,$20,$36,$34,$2C,$20,$67,$6F,$74,$3A
+	.byte	$20,$25,$64,$0A,$00
+S000E:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$34,$32,$20,$3E,$3E,$20,$74
+	.byte	$77,$6F,$20,$3D,$3D,$20,$31,$30,$2C,$20,$67,$6F,$74,$3A,$20,$25
+	.byte	$64,$0A,$00
+S0004:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$32,$35,$35,$55,$20,$2A,$20
+	.byte	$32,$35,$35,$55,$20,$3D,$3D,$20,$36,$35,$30,$32,$35,$55,$0A,$00
+S0003:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$28,$75,$38,$29,$20,$31,$20
+	.byte	$2D,$20,$28,$75,$38,$29,$20,$32,$20,$3C,$20,$30,$0A,$00
+S0002:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$6F,$6E,$65,$20,$2D,$20,$74
+	.byte	$77,$6F,$20,$3C,$20,$30,$0A,$00
+S0001:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$31,$55,$20,$2D,$20,$32,$55
+	.byte	$20,$3E,$20,$30,$0A,$00
+S000F:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ test_sub (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_sub: near
+
+	.dbg	func, "test_sub", "00", extern, "_test_sub"
+	.dbg	sym, "one", "00", auto, -1
+	.dbg	sym, "two", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "char-promote.c", 33
+	lda     #$01
+	jsr     pusha
+	lda     #$02
+	jsr     pusha
+	.dbg	line, "char-promote.c", 36
+	jmp     L0002
+	.dbg	line, "char-promote.c", 37
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$04
+	jsr     _fprintf
+	.dbg	line, "char-promote.c", 38
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "char-promote.c", 42
+L0002:	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     tossubax
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvs     L0004
+	eor     #$80
+L0004:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0003
+	.dbg	line, "char-promote.c", 43
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$04
+	jsr     _fprintf
+	.dbg	line, "char-promote.c", 44
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "char-promote.c", 48
+L0003:	jmp     L0005
+	.dbg	line, "char-promote.c", 49
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$04
+	jsr     _fprintf
+	.dbg	line, "char-promote.c", 50
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "char-promote.c", 52
+L0005:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_mul (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_mul: near
+
+	.dbg	func, "test_mul", "00", extern, "_test_mul"
+	.dbg	sym, "two_fifty_five", "00", auto, -1
+	.dbg	sym, "sixteen", "00", auto, -2
+	.dbg	sym, "x", "00", auto, -4
+
+.segment	"CODE"
+
+	.dbg	line, "char-promote.c", 56
+	lda     #$FF
+	jsr     pusha
+	.dbg	line, "char-promote.c", 57
+	lda     #$10
+	jsr     pusha
+	.dbg	line, "char-promote.c", 60
+	jsr     decsp2
+	jmp     L0002
+	.dbg	line, "char-promote.c", 61
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$04
+	jsr     _fprintf
+	.dbg	line, "char-promote.c", 62
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "char-promote.c", 76
+L0002:	ldy     #$03
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$05
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosumulax
+	cpx     #$FE
+	bne     L0004
+	cmp     #$01
+L0004:	jsr     boolne
+	jeq     L0003
+	.dbg	line, "char-promote.c", 77
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$04
+	jsr     _fprintf
+	.dbg	line, "char-promote.c", 78
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "char-promote.c", 90
+L0003:	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     shlax2
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "char-promote.c", 91
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0006
+	cmp     #$40
+L0006:	jsr     boolne
+	jeq     L0005
+	.dbg	line, "char-promote.c", 92
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$06
+	jsr     _fprintf
+	.dbg	line, "char-promote.c", 93
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "char-promote.c", 95
+L0005:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_div (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_div: near
+
+	.dbg	func, "test_div", "00", extern, "_test_div"
+	.dbg	sym, "seventeen", "00", auto, -1
+	.dbg	sym, "three", "00", auto, -2
+	.dbg	sym, "x", "00", auto, -4
+
+.segment	"CODE"
+
+	.dbg	line, "char-promote.c", 99
+	lda     #$11
+	jsr     pusha
+	.dbg	line, "char-promote.c", 100
+	lda     #$03
+	jsr     pusha
+	.dbg	line, "char-promote.c", 106
+	jsr     decsp2
+	ldy     #$03
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$04
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosudivax
+	cpx     #$00
+	bne     L0003
+	cmp     #$05
+L0003:	jsr     boolne
+	jeq     L0002
+	.dbg	line, "char-promote.c", 107
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$07
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$08
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosudivax
+	jsr     pushax
+	ldy     #$06
+	jsr     _fprintf
+	.dbg	line, "char-promote.c", 108
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "char-promote.c", 110
+L0002:	jmp     L0004
+	.dbg	line, "char-promote.c", 111
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldx     #$00
+	lda     #$05
+	jsr     pushax
+	ldy     #$06
+	jsr     _fprintf
+	.dbg	line, "char-promote.c", 112
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "char-promote.c", 116
+L0004:	ldy     #$03
+	ldx     #$00
+	lda     (sp),y
+	jsr     shrax2
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "char-promote.c", 117
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0006
+	cmp     #$04
+L0006:	jsr     boolne
+	jeq     L0005
+	.dbg	line, "char-promote.c", 118
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$06
+	jsr     _fprintf
+	.dbg	line, "char-promote.c", 119
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "char-promote.c", 121
+L0005:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_mod (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_mod: near
+
+	.dbg	func, "test_mod", "00", extern, "_test_mod"
+	.dbg	sym, "seventeen", "00", auto, -1
+	.dbg	sym, "x", "00", auto, -3
+
+.segment	"CODE"
+
+	.dbg	line, "char-promote.c", 125
+	lda     #$11
+	jsr     pusha
+	.dbg	line, "char-promote.c", 127
+	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	ldx     #$00
+	and     #$03
+	jsr     pushax
+	.dbg	line, "char-promote.c", 128
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0003
+	cmp     #$01
+L0003:	jsr     boolne
+	jeq     L0002
+	.dbg	line, "char-promote.c", 129
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$06
+	jsr     _fprintf
+	.dbg	line, "char-promote.c", 130
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "char-promote.c", 132
+L0002:	jsr     incsp3
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_shr (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_shr: near
+
+	.dbg	func, "test_shr", "00", extern, "_test_shr"
+	.dbg	sym, "forty_two", "00", auto, -2
+	.dbg	sym, "two", "00", auto, -4
+	.dbg	sym, "x", "00", auto, -6
+
+.segment	"CODE"
+
+	.dbg	line, "char-promote.c", 136
+	ldx     #$00
+	lda     #$2A
+	jsr     pushax
+	.dbg	line, "char-promote.c", 137
+	ldx     #$00
+	lda     #$02
+	jsr     pushax
+	.dbg	line, "char-promote.c", 143
+	jsr     decsp2
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosshrax
+	cpx     #$00
+	bne     L0003
+	cmp     #$0A
+L0003:	jsr     boolne
+	jeq     L0002
+	.dbg	line, "char-promote.c", 144
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     tosshrax
+	jsr     pushax
+	ldy     #$06
+	jsr     _fprintf
+	.dbg	line, "char-promote.c", 145
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "char-promote.c", 147
+L0002:	jmp     L0004
+	.dbg	line, "char-promote.c", 148
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	ldx     #$00
+	lda     #$05
+	jsr     pushax
+	ldy     #$06
+	jsr     _fprintf
+	.dbg	line, "char-promote.c", 149
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "char-promote.c", 153
+L0004:	ldy     #$05
+	jsr     ldaxysp
+	jsr     shrax2
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "char-promote.c", 154
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0006
+	cmp     #$0A
+L0006:	jsr     boolne
+	jeq     L0005
+	.dbg	line, "char-promote.c", 155
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$06
+	jsr     _fprintf
+	.dbg	line, "char-promote.c", 156
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "char-promote.c", 160
+L0005:	ldx     #$00
+	lda     #$2A
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosasrax
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "char-promote.c", 161
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0008
+	cmp     #$0A
+L0008:	jsr     boolne
+	jeq     L0007
+	.dbg	line, "char-promote.c", 162
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$06
+	jsr     _fprintf
+	.dbg	line, "char-promote.c", 163
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "char-promote.c", 165
+L0007:	jsr     incsp6
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "char-promote.c", 169
+	jsr     _test_sub
+	.dbg	line, "char-promote.c", 170
+	jsr     _test_mul
+	.dbg	line, "char-promote.c", 171
+	jsr     _test_div
+	.dbg	line, "char-promote.c", 172
+	jsr     _test_mod
+	.dbg	line, "char-promote.c", 173
+	jsr     _test_shr
+	.dbg	line, "char-promote.c", 174
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "char-promote.c", 175
+	ldx     #$00
+	lda     _failures
+	jmp     L0001
+	.dbg	line, "char-promote.c", 176
+L0001:	rts
+
+	.dbg	line
+.endproc
+
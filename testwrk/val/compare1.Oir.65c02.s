@@ -0,0 +1,368 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_success
+	.export		_failures
+	.export		_dummy
+	.export		_achar0
+	.export		_achar1
+	.export		_aint0
+	.export		_aint1
+	.export		_schar0
+	.export		_schar1
+	.export		_done
+	.export		_compare_char_to_lits1
+	.export		_compare_char_to_lits2
+	.export		_compare_char_to_char1
+	.export		_compare_char_to_char2
+	.export		_compare_int_to_lits1
+	.export		_compare_int_to_lits2
+	.export		_compare_int_to_lits3
+	.export		_compare_int_to_int1
+	.export		_compare_int_to_int2
+	.export		_main
+
+.segment	"DATA"
+
+_success:
+	.byte	$00
+_failures:
+	.byte	$00
+_dummy:
+	.byte	$00
+_achar0:
+	.byte	$00
+_achar1:
+	.byte	$00
+_aint0:
+	.word	$0000
+_aint1:
+	.word	$0000
+_schar0:
+	.byte	$00
+_schar1:
+	.byte	$00
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ done (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_done: near
+
+.segment	"CODE"
+
+	inc     _dummy
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ compare_char_to_lits1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_compare_char_to_lits1: near
+
+.segment	"CODE"
+
+	lda     _achar0
+	beq     L0002
+	inc     _failures
+L0002:	lda     _achar0
+	cmp     #$01
+	bne     L0006
+	inc     _failures
+L0006:	lda     _achar0
+	cmp     #$07
+	bne     L0007
+	inc     _failures
+L0007:	lda     _achar0
+	beq     L0005
+	inc     _failures
+L0005:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ compare_char_to_lits2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_compare_char_to_lits2: near
+
+.segment	"CODE"
+
+	lda     _achar0
+	bne     L0002
+	inc     _failures
+L0002:	lda     _achar0
+	cmp     #$01
+	bne     L0006
+	inc     _failures
+L0006:	lda     _achar0
+	cmp     #$07
+	bne     L0007
+	inc     _failures
+L0007:	lda     _achar0
+	cmp     #$05
+	beq     L0005
+	inc     _failures
+L0005:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ compare_char_to_char1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_compare_char_to_char1: near
+
+.segment	"CODE"
+
+	lda     _achar0
+	cmp     _achar1
+	beq     L0004
+	inc     _failures
+L0004:	lda     _schar0
+	cmp     _schar1
+	beq     L0003
+	inc     _failures
+L0003:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ compare_char_to_char2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_compare_char_to_char2: near
+
+.segment	"CODE"
+
+	lda     _achar0
+	cmp     _achar1
+	bne     L0002
+	inc     _failures
+L0002:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ compare_int_to_lits1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_compare_int_to_lits1: near
+
+.segment	"CODE"
+
+	lda     _aint0
+	ora     _aint0+1
+	beq     L0002
+	inc     _failures
+L0002:	lda     _aint0+1
+	bne     L0003
+	lda     _aint0
+	cmp     #$01
+	bne     L0003
+	inc     _failures
+L0003:	lda     _aint0+1
+	bne     L0005
+	lda     _aint0
+	cmp     #$07
+	bne     L0005
+	inc     _failures
+L0005:	lda     _aint0
+	ora     _aint0+1
+	beq     L0007
+	inc     _failures
+L0007:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ compare_int_to_lits2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_compare_int_to_lits2: near
+
+.segment	"CODE"
+
+	lda     _aint0
+	ora     _aint0+1
+	bne     L0002
+	inc     _failures
+L0002:	lda     _aint0+1
+	bne     L0003
+	lda     _aint0
+	cmp     #$01
+	bne     L0003
+	inc     _failures
+L0003:	lda     _aint0+1
+	bne     L0005
+	lda     _aint0
+	cmp     #$07
+	bne     L0005
+	inc     _failures
+L0005:	lda     _aint0+1
+	bne     L0009
+	lda     _aint0
+	cmp     #$05
+	beq     L0007
+L0009:	inc     _failures
+L0007:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ compare_int_to_lits3 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_compare_int_to_lits3: near
+
+.segment	"CODE"
+
+	lda     _aint0
+	ora     _aint0+1
+	bne     L0002
+	inc     _failures
+L0002:	lda     _aint0+1
+	bne     L0003
+	lda     _aint0
+	cmp     #$01
+	bne     L0003
+	inc     _failures
+L0003:	lda     _aint0+1
+	bne     L0005
+	lda     _aint0
+	cmp     #$07
+	bne     L0005
+	inc     _failures
+L0005:	lda     _aint0+1
+	cmp     #$12
+	bne     L0009
+	lda     _aint0
+	cmp     #$34
+	beq     L0007
+L0009:	inc     _failures
+L0007:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ compare_int_to_int1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_compare_int_to_int1: near
+
+.segment	"CODE"
+
+	lda     _aint1
+	ldx     _aint1+1
+	cpx     _aint0+1
+	bne     L0004
+	cmp     _aint0
+	beq     L0002
+L0004:	inc     _failures
+L0002:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ compare_int_to_int2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_compare_int_to_int2: near
+
+.segment	"CODE"
+
+	lda     _aint1
+	ldx     _aint1+1
+	cpx     _aint0+1
+	bne     L0002
+	cmp     _aint0
+	bne     L0002
+	inc     _failures
+L0002:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     _compare_char_to_lits1
+	jsr     _compare_char_to_char1
+	lda     #$05
+	sta     _achar0
+	jsr     _compare_char_to_lits2
+	jsr     _compare_char_to_char2
+	jsr     _compare_int_to_lits1
+	lda     #$05
+	sta     _aint0
+	stz     _aint0+1
+	jsr     _compare_int_to_lits2
+	ldx     #$12
+	lda     #$34
+	sta     _aint0
+	stx     _aint0+1
+	jsr     _compare_int_to_lits3
+	jsr     _compare_int_to_int2
+	stz     _aint0
+	stz     _aint0+1
+	jsr     _compare_int_to_int1
+	lda     _failures
+	sta     _success
+	jsr     _done
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     _failures
+	rts
+
+.endproc
+
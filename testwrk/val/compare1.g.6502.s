@@ -0,0 +1,595 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "compare1.c", 2421, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/limits.h", 3146, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_success
+	.export		_failures
+	.export		_dummy
+	.export		_achar0
+	.export		_achar1
+	.export		_aint0
+	.export		_aint1
+	.export		_schar0
+	.export		_schar1
+	.export		_done
+	.export		_compare_char_to_lits1
+	.export		_compare_char_to_lits2
+	.export		_compare_char_to_char1
+	.export		_compare_char_to_char2
+	.export		_compare_int_to_lits1
+	.export		_compare_int_to_lits2
+	.export		_compare_int_to_lits3
+	.export		_compare_int_to_int1
+	.export		_compare_int_to_int2
+	.export		_main
+
+.segment	"DATA"
+
+_success:
+	.byte	$00
+_failures:
+	.byte	$00
+_dummy:
+	.byte	$00
+_achar0:
+	.byte	$00
+_achar1:
+	.byte	$00
+_aint0:
+	.word	$0000
+_aint1:
+	.word	$0000
+_schar0:
+	.byte	$00
+_schar1:
+	.byte	$00
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ done (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_done: near
+
+	.dbg	func, "done", "00", extern, "_done"
+
+.segment	"CODE"
+
+	.dbg	line, "compare1.c", 34
+	ldx     #$00
+	lda     _dummy
+	inc     _dummy
+	.dbg	line, "compare1.c", 35
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ compare_char_to_lits1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_compare_char_to_lits1: near
+
+	.dbg	func, "compare_char_to_lits1", "00", extern, "_compare_char_to_lits1"
+
+.segment	"CODE"
+
+	.dbg	line, "compare1.c", 42
+	lda     _achar0
+	jeq     L0002
+	.dbg	line, "compare1.c", 43
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare1.c", 45
+L0002:	ldx     #$00
+	lda     _achar0
+	cmp     #$01
+	jsr     booleq
+	jeq     L0003
+	.dbg	line, "compare1.c", 46
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare1.c", 48
+L0003:	ldx     #$00
+	lda     _achar0
+	cmp     #$07
+	jsr     booleq
+	jeq     L0004
+	.dbg	line, "compare1.c", 49
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare1.c", 51
+L0004:	ldx     #$00
+	lda     _achar0
+	cmp     #$00
+	jsr     boolne
+	jeq     L0005
+	.dbg	line, "compare1.c", 52
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare1.c", 53
+L0005:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ compare_char_to_lits2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_compare_char_to_lits2: near
+
+	.dbg	func, "compare_char_to_lits2", "00", extern, "_compare_char_to_lits2"
+
+.segment	"CODE"
+
+	.dbg	line, "compare1.c", 59
+	ldx     #$00
+	lda     _achar0
+	jsr     bnega
+	jeq     L0002
+	.dbg	line, "compare1.c", 60
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare1.c", 62
+L0002:	ldx     #$00
+	lda     _achar0
+	cmp     #$01
+	jsr     booleq
+	jeq     L0003
+	.dbg	line, "compare1.c", 63
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare1.c", 65
+L0003:	ldx     #$00
+	lda     _achar0
+	cmp     #$07
+	jsr     booleq
+	jeq     L0004
+	.dbg	line, "compare1.c", 66
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare1.c", 68
+L0004:	ldx     #$00
+	lda     _achar0
+	cmp     #$05
+	jsr     boolne
+	jeq     L0005
+	.dbg	line, "compare1.c", 69
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare1.c", 70
+L0005:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ compare_char_to_char1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_compare_char_to_char1: near
+
+	.dbg	func, "compare_char_to_char1", "00", extern, "_compare_char_to_char1"
+
+.segment	"CODE"
+
+	.dbg	line, "compare1.c", 76
+	ldx     #$00
+	lda     _achar0
+	jsr     pushax
+	ldx     #$00
+	lda     _achar1
+	jsr     tosneax
+	jeq     L0002
+	.dbg	line, "compare1.c", 77
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare1.c", 79
+L0002:	ldx     #$00
+	lda     _schar0
+	jsr     pushax
+	ldx     #$00
+	lda     _schar1
+	jsr     tosneax
+	jeq     L0003
+	.dbg	line, "compare1.c", 80
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare1.c", 81
+L0003:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ compare_char_to_char2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_compare_char_to_char2: near
+
+	.dbg	func, "compare_char_to_char2", "00", extern, "_compare_char_to_char2"
+
+.segment	"CODE"
+
+	.dbg	line, "compare1.c", 87
+	ldx     #$00
+	lda     _achar0
+	jsr     pushax
+	ldx     #$00
+	lda     _achar1
+	jsr     toseqax
+	jeq     L0002
+	.dbg	line, "compare1.c", 88
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare1.c", 89
+L0002:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ compare_int_to_lits1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_compare_int_to_lits1: near
+
+	.dbg	func, "compare_int_to_lits1", "00", extern, "_compare_int_to_lits1"
+
+.segment	"CODE"
+
+	.dbg	line, "compare1.c", 96
+	lda     _aint0
+	ora     _aint0+1
+	jeq     L0002
+	.dbg	line, "compare1.c", 97
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare1.c", 99
+L0002:	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$00
+	bne     L0004
+	cmp     #$01
+L0004:	jsr     booleq
+	jeq     L0003
+	.dbg	line, "compare1.c", 100
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare1.c", 102
+L0003:	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$00
+	bne     L0006
+	cmp     #$07
+L0006:	jsr     booleq
+	jeq     L0005
+	.dbg	line, "compare1.c", 103
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare1.c", 105
+L0005:	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$00
+	bne     L0008
+	cmp     #$00
+L0008:	jsr     boolne
+	jeq     L0007
+	.dbg	line, "compare1.c", 106
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare1.c", 107
+L0007:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ compare_int_to_lits2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_compare_int_to_lits2: near
+
+	.dbg	func, "compare_int_to_lits2", "00", extern, "_compare_int_to_lits2"
+
+.segment	"CODE"
+
+	.dbg	line, "compare1.c", 113
+	lda     _aint0
+	ldx     _aint0+1
+	jsr     bnegax
+	jeq     L0002
+	.dbg	line, "compare1.c", 114
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare1.c", 116
+L0002:	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$00
+	bne     L0004
+	cmp     #$01
+L0004:	jsr     booleq
+	jeq     L0003
+	.dbg	line, "compare1.c", 117
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare1.c", 119
+L0003:	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$00
+	bne     L0006
+	cmp     #$07
+L0006:	jsr     booleq
+	jeq     L0005
+	.dbg	line, "compare1.c", 120
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare1.c", 122
+L0005:	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$00
+	bne     L0008
+	cmp     #$05
+L0008:	jsr     boolne
+	jeq     L0007
+	.dbg	line, "compare1.c", 123
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare1.c", 124
+L0007:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ compare_int_to_lits3 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_compare_int_to_lits3: near
+
+	.dbg	func, "compare_int_to_lits3", "00", extern, "_compare_int_to_lits3"
+
+.segment	"CODE"
+
+	.dbg	line, "compare1.c", 130
+	lda     _aint0
+	ldx     _aint0+1
+	jsr     bnegax
+	jeq     L0002
+	.dbg	line, "compare1.c", 131
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare1.c", 133
+L0002:	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$00
+	bne     L0004
+	cmp     #$01
+L0004:	jsr     booleq
+	jeq     L0003
+	.dbg	line, "compare1.c", 134
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare1.c", 136
+L0003:	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$00
+	bne     L0006
+	cmp     #$07
+L0006:	jsr     booleq
+	jeq     L0005
+	.dbg	line, "compare1.c", 137
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare1.c", 139
+L0005:	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$12
+	bne     L0008
+	cmp     #$34
+L0008:	jsr     boolne
+	jeq     L0007
+	.dbg	line, "compare1.c", 140
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare1.c", 141
+L0007:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ compare_int_to_int1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_compare_int_to_int1: near
+
+	.dbg	func, "compare_int_to_int1", "00", extern, "_compare_int_to_int1"
+
+.segment	"CODE"
+
+	.dbg	line, "compare1.c", 147
+	lda     _aint0
+	ldx     _aint0+1
+	jsr     pushax
+	lda     _aint1
+	ldx     _aint1+1
+	jsr     tosneax
+	jeq     L0002
+	.dbg	line, "compare1.c", 148
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare1.c", 149
+L0002:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ compare_int_to_int2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_compare_int_to_int2: near
+
+	.dbg	func, "compare_int_to_int2", "00", extern, "_compare_int_to_int2"
+
+.segment	"CODE"
+
+	.dbg	line, "compare1.c", 155
+	lda     _aint0
+	ldx     _aint0+1
+	jsr     pushax
+	lda     _aint1
+	ldx     _aint1+1
+	jsr     toseqax
+	jeq     L0002
+	.dbg	line, "compare1.c", 156
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare1.c", 157
+L0002:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "compare1.c", 162
+	jsr     _compare_char_to_lits1
+	.dbg	line, "compare1.c", 163
+	jsr     _compare_char_to_char1
+	.dbg	line, "compare1.c", 164
+	ldx     #$00
+	lda     #$05
+	sta     _achar0
+	.dbg	line, "compare1.c", 165
+	jsr     _compare_char_to_lits2
+	.dbg	line, "compare1.c", 166
+	jsr     _compare_char_to_char2
+	.dbg	line, "compare1.c", 168
+	jsr     _compare_int_to_lits1
+	.dbg	line, "compare1.c", 169
+	ldx     #$00
+	lda     #$05
+	sta     _aint0
+	stx     _aint0+1
+	.dbg	line, "compare1.c", 170
+	jsr     _compare_int_to_lits2
+	.dbg	line, "compare1.c", 171
+	ldx     #$12
+	lda     #$34
+	sta     _aint0
+	stx     _aint0+1
+	.dbg	line, "compare1.c", 172
+	jsr     _compare_int_to_lits3
+	.dbg	line, "compare1.c", 173
+	jsr     _compare_int_to_int2
+	.dbg	line, "compare1.c", 174
+	ldx     #$00
+	lda     #$00
+	sta     _aint0
+	stx     _aint0+1
+	.dbg	line, "compare1.c", 175
+	jsr     _compare_int_to_int1
+	.dbg	line, "compare1.c", 177
+	ldx     #$00
+	lda     _failures
+	sta     _success
+	.dbg	line, "compare1.c", 178
+	jsr     _done
+	.dbg	line, "compare1.c", 180
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "compare1.c", 182
+	ldx     #$00
+	lda     _failures
+	jmp     L0001
+	.dbg	line, "compare1.c", 183
+L0001:	rts
+
+	.dbg	line
+.endproc
+
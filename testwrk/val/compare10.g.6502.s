@@ -0,0 +1,1259 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "compare10.c", 5129, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/limits.h", 3146, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_success
+	.export		_failures
+	.export		_dummy
+	.export		_result
+	.export		_int0
+	.export		_int1
+	.export		_uchar0
+	.export		_uchar1
+	.export		_char0
+	.export		_char1
+	.export		_long0
+	.export		_long1
+	.export		_done
+	.export		_c_char_gte_lit1
+	.export		_char_compare
+	.export		_c_int_gte_lit1
+	.export		_int_compare1
+	.export		_c_int_gte_lit2
+	.export		_int_compare2
+	.export		_main
+
+.segment	"DATA"
+
+_success:
+	.byte	$00
+_failures:
+	.byte	$00
+_dummy:
+	.byte	$00
+_result:
+	.byte	$00
+_int0:
+	.word	$0000
+_int1:
+	.word	$0000
+_uchar0:
+	.byte	$00
+_uchar1:
+	.byte	$00
+_char0:
+	.byte	$00
+_char1:
+	.byte	$00
+_long0:
+	.byte	$00
+_long1:
+	.byte	$00
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$63,$5F,$63,$68,$61,$72,$5F,$67,$74,$65,$5F,$6C,$69,$74,$31,$3A
+	.byte	$20,$63,$68,$61,$72,$20,$25,$30,$32,$78,$20,$2D,$20,$72,$65,$73
+	.byte	$75,$6C,$74,$20,$25,$30,$32,$78,$20,$65,$78,$70,$65,$63,$74,$65
+	.byte	$64,$3A,$20,$25,$30,$32,$78,$0A,$00
+S0003:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+S0004	:=	S0003+0
+S0002	:=	S0003+0
+
+; ---------------------------------------------------------------
+; void __near__ done (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_done: near
+
+	.dbg	func, "done", "00", extern, "_done"
+
+.segment	"CODE"
+
+	.dbg	line, "compare10.c", 41
+	ldx     #$00
+	lda     _dummy
+	inc     _dummy
+	.dbg	line, "compare10.c", 42
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_char_gte_lit1 (unsigned char expected_result)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_char_gte_lit1: near
+
+	.dbg	func, "c_char_gte_lit1", "00", extern, "_c_char_gte_lit1"
+	.dbg	sym, "expected_result", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "compare10.c", 45
+	jsr     pusha
+	.dbg	line, "compare10.c", 46
+	ldx     #$00
+	lda     #$00
+	sta     _result
+	.dbg	line, "compare10.c", 48
+	ldx     #$00
+	lda     _char0
+	bpl     L0003
+	dex
+L0003:	sec
+	sbc     #$81
+	bvs     L0004
+	eor     #$80
+L0004:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	.dbg	line, "compare10.c", 49
+	ldx     #$00
+	lda     _result
+	ora     #$01
+	sta     _result
+	.dbg	line, "compare10.c", 51
+L0002:	ldx     #$00
+	lda     _char0
+	bpl     L0006
+	dex
+L0006:	sec
+	sbc     #$FF
+	bvs     L0007
+	eor     #$80
+L0007:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0005
+	.dbg	line, "compare10.c", 52
+	ldx     #$00
+	lda     _result
+	ora     #$02
+	sta     _result
+	.dbg	line, "compare10.c", 54
+L0005:	ldx     #$00
+	lda     _char0
+	bpl     L0009
+	dex
+L0009:	tax
+	jsr     boolge
+	jeq     L0008
+	.dbg	line, "compare10.c", 55
+	ldx     #$00
+	lda     _result
+	ora     #$04
+	sta     _result
+	.dbg	line, "compare10.c", 57
+L0008:	ldx     #$00
+	lda     _char0
+	bpl     L000B
+	dex
+L000B:	sec
+	sbc     #$01
+	bvs     L000C
+	eor     #$80
+L000C:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L000A
+	.dbg	line, "compare10.c", 58
+	ldx     #$00
+	lda     _result
+	ora     #$08
+	sta     _result
+	.dbg	line, "compare10.c", 60
+L000A:	ldx     #$00
+	lda     _char0
+	bpl     L000E
+	dex
+L000E:	sec
+	sbc     #$7E
+	bvs     L000F
+	eor     #$80
+L000F:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L000D
+	.dbg	line, "compare10.c", 61
+	ldx     #$00
+	lda     _result
+	ora     #$10
+	sta     _result
+	.dbg	line, "compare10.c", 63
+L000D:	ldx     #$00
+	lda     _char0
+	bpl     L0011
+	dex
+L0011:	sec
+	sbc     #$7F
+	bvs     L0012
+	eor     #$80
+L0012:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0010
+	.dbg	line, "compare10.c", 64
+	ldx     #$00
+	lda     _result
+	ora     #$20
+	sta     _result
+	.dbg	line, "compare10.c", 66
+L0010:	ldx     #$00
+	lda     _result
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosneax
+	jeq     L0013
+	.dbg	line, "compare10.c", 69
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldx     #$00
+	lda     _char0
+	bpl     L0014
+	dex
+L0014:	jsr     pushax
+	ldx     #$00
+	lda     _result
+	jsr     pushax
+	ldy     #$06
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "compare10.c", 70
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare10.c", 74
+L0013:	jsr     incsp1
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ char_compare (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_char_compare: near
+
+	.dbg	func, "char_compare", "00", extern, "_char_compare"
+
+.segment	"CODE"
+
+	.dbg	line, "compare10.c", 78
+	ldx     #$00
+	lda     #$7F
+	sta     _char0
+	.dbg	line, "compare10.c", 79
+	lda     #$3F
+	jsr     _c_char_gte_lit1
+	.dbg	line, "compare10.c", 81
+	ldx     #$00
+	lda     #$7E
+	sta     _char0
+	.dbg	line, "compare10.c", 82
+	lda     #$1F
+	jsr     _c_char_gte_lit1
+	.dbg	line, "compare10.c", 84
+	ldx     #$00
+	lda     #$40
+	sta     _char0
+	.dbg	line, "compare10.c", 85
+	lda     #$0F
+	jsr     _c_char_gte_lit1
+	.dbg	line, "compare10.c", 87
+	ldx     #$00
+	lda     #$02
+	sta     _char0
+	.dbg	line, "compare10.c", 88
+	lda     #$0F
+	jsr     _c_char_gte_lit1
+	.dbg	line, "compare10.c", 90
+	ldx     #$00
+	lda     #$01
+	sta     _char0
+	.dbg	line, "compare10.c", 91
+	lda     #$0F
+	jsr     _c_char_gte_lit1
+	.dbg	line, "compare10.c", 93
+	ldx     #$00
+	lda     #$00
+	sta     _char0
+	.dbg	line, "compare10.c", 94
+	lda     #$07
+	jsr     _c_char_gte_lit1
+	.dbg	line, "compare10.c", 96
+	ldx     #$FF
+	lda     #$FF
+	sta     _char0
+	.dbg	line, "compare10.c", 97
+	lda     #$03
+	jsr     _c_char_gte_lit1
+	.dbg	line, "compare10.c", 99
+	ldx     #$FF
+	lda     #$FE
+	sta     _char0
+	.dbg	line, "compare10.c", 100
+	lda     #$01
+	jsr     _c_char_gte_lit1
+	.dbg	line, "compare10.c", 102
+	ldx     #$FF
+	lda     #$C0
+	sta     _char0
+	.dbg	line, "compare10.c", 103
+	lda     #$01
+	jsr     _c_char_gte_lit1
+	.dbg	line, "compare10.c", 105
+	ldx     #$FF
+	lda     #$82
+	sta     _char0
+	.dbg	line, "compare10.c", 106
+	lda     #$01
+	jsr     _c_char_gte_lit1
+	.dbg	line, "compare10.c", 108
+	ldx     #$FF
+	lda     #$81
+	sta     _char0
+	.dbg	line, "compare10.c", 109
+	lda     #$01
+	jsr     _c_char_gte_lit1
+	.dbg	line, "compare10.c", 111
+	ldx     #$FF
+	lda     #$80
+	sta     _char0
+	.dbg	line, "compare10.c", 112
+	lda     #$00
+	jsr     _c_char_gte_lit1
+	.dbg	line, "compare10.c", 116
+	ldx     #$00
+	lda     #$01
+	sta     _char0
+	jmp     L0002
+	.dbg	line, "compare10.c", 117
+L0005:	lda     #$0F
+	jsr     _c_char_gte_lit1
+	.dbg	line, "compare10.c", 116
+	ldx     #$00
+	lda     _char0
+	bpl     L0007
+	dex
+L0007:	inc     _char0
+	jmp     L0002
+L0002:	ldx     #$00
+	lda     _char0
+	bpl     L0006
+	dex
+L0006:	cmp     #$7E
+	jsr     boolne
+	jne     L0005
+	.dbg	line, "compare10.c", 119
+	ldx     #$FF
+	lda     #$81
+	sta     _char0
+	jmp     L0008
+	.dbg	line, "compare10.c", 120
+L000B:	lda     #$01
+	jsr     _c_char_gte_lit1
+	.dbg	line, "compare10.c", 119
+	ldx     #$00
+	lda     _char0
+	bpl     L000D
+	dex
+L000D:	inc     _char0
+	jmp     L0008
+L0008:	ldx     #$00
+	lda     _char0
+	bpl     L000C
+	dex
+L000C:	cmp     #$FF
+	jsr     boolne
+	jne     L000B
+	.dbg	line, "compare10.c", 121
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_int_gte_lit1 (unsigned char expected_result)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_int_gte_lit1: near
+
+	.dbg	func, "c_int_gte_lit1", "00", extern, "_c_int_gte_lit1"
+	.dbg	sym, "expected_result", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "compare10.c", 124
+	jsr     pusha
+	.dbg	line, "compare10.c", 125
+	ldx     #$00
+	lda     #$00
+	sta     _result
+	.dbg	line, "compare10.c", 127
+	lda     _int0
+	ldx     _int0+1
+	txa
+	jsr     boolge
+	jeq     L0002
+	.dbg	line, "compare10.c", 128
+	ldx     #$00
+	lda     _result
+	ora     #$01
+	sta     _result
+	.dbg	line, "compare10.c", 130
+L0002:	lda     _int0
+	ldx     _int0+1
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvs     L0004
+	eor     #$80
+L0004:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0003
+	.dbg	line, "compare10.c", 131
+	ldx     #$00
+	lda     _result
+	ora     #$02
+	sta     _result
+	.dbg	line, "compare10.c", 133
+L0003:	lda     _int0
+	ldx     _int0+1
+	cmp     #$FF
+	txa
+	sbc     #$00
+	bvs     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0005
+	.dbg	line, "compare10.c", 134
+	ldx     #$00
+	lda     _result
+	ora     #$04
+	sta     _result
+	.dbg	line, "compare10.c", 136
+L0005:	lda     _int0
+	ldx     _int0+1
+	cmp     #$00
+	txa
+	sbc     #$01
+	bvs     L0008
+	eor     #$80
+L0008:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0007
+	.dbg	line, "compare10.c", 137
+	ldx     #$00
+	lda     _result
+	ora     #$08
+	sta     _result
+	.dbg	line, "compare10.c", 139
+L0007:	lda     _int0
+	ldx     _int0+1
+	cmp     #$01
+	txa
+	sbc     #$01
+	bvs     L000A
+	eor     #$80
+L000A:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0009
+	.dbg	line, "compare10.c", 140
+	ldx     #$00
+	lda     _result
+	ora     #$10
+	sta     _result
+	.dbg	line, "compare10.c", 142
+L0009:	lda     _int0
+	ldx     _int0+1
+	cmp     #$FF
+	txa
+	sbc     #$01
+	bvs     L000C
+	eor     #$80
+L000C:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L000B
+	.dbg	line, "compare10.c", 143
+	ldx     #$00
+	lda     _result
+	ora     #$20
+	sta     _result
+	.dbg	line, "compare10.c", 145
+L000B:	lda     _int0
+	ldx     _int0+1
+	cmp     #$00
+	txa
+	sbc     #$02
+	bvs     L000E
+	eor     #$80
+L000E:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L000D
+	.dbg	line, "compare10.c", 146
+	ldx     #$00
+	lda     _result
+	ora     #$40
+	sta     _result
+	.dbg	line, "compare10.c", 148
+L000D:	lda     _int0
+	ldx     _int0+1
+	cmp     #$01
+	txa
+	sbc     #$02
+	bvs     L0010
+	eor     #$80
+L0010:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L000F
+	.dbg	line, "compare10.c", 149
+	ldx     #$00
+	lda     _result
+	ora     #$80
+	sta     _result
+	.dbg	line, "compare10.c", 151
+L000F:	ldx     #$00
+	lda     _result
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosneax
+	jeq     L0011
+	.dbg	line, "compare10.c", 152
+	ldx     #$00
+	lda     #$01
+	sta     _failures
+	.dbg	line, "compare10.c", 153
+L0011:	jsr     incsp1
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_compare1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_compare1: near
+
+	.dbg	func, "int_compare1", "00", extern, "_int_compare1"
+
+.segment	"CODE"
+
+	.dbg	line, "compare10.c", 157
+	ldx     #$FF
+	lda     #$FF
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare10.c", 158
+	lda     #$00
+	jsr     _c_int_gte_lit1
+	.dbg	line, "compare10.c", 160
+	ldx     #$00
+	lda     #$00
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare10.c", 161
+	lda     #$01
+	jsr     _c_int_gte_lit1
+	.dbg	line, "compare10.c", 163
+	ldx     #$00
+	lda     #$01
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare10.c", 164
+	lda     #$03
+	jsr     _c_int_gte_lit1
+	.dbg	line, "compare10.c", 166
+	ldx     #$00
+	lda     #$02
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare10.c", 167
+	lda     #$03
+	jsr     _c_int_gte_lit1
+	.dbg	line, "compare10.c", 169
+	ldx     #$00
+	lda     #$FE
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare10.c", 170
+	lda     #$03
+	jsr     _c_int_gte_lit1
+	.dbg	line, "compare10.c", 172
+	ldx     #$00
+	lda     #$FF
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare10.c", 173
+	lda     #$07
+	jsr     _c_int_gte_lit1
+	.dbg	line, "compare10.c", 175
+	ldx     #$01
+	lda     #$00
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare10.c", 176
+	lda     #$0F
+	jsr     _c_int_gte_lit1
+	.dbg	line, "compare10.c", 178
+	ldx     #$01
+	lda     #$01
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare10.c", 179
+	lda     #$1F
+	jsr     _c_int_gte_lit1
+	.dbg	line, "compare10.c", 181
+	ldx     #$01
+	lda     #$02
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare10.c", 182
+	lda     #$1F
+	jsr     _c_int_gte_lit1
+	.dbg	line, "compare10.c", 184
+	ldx     #$01
+	lda     #$FE
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare10.c", 185
+	lda     #$1F
+	jsr     _c_int_gte_lit1
+	.dbg	line, "compare10.c", 187
+	ldx     #$01
+	lda     #$FF
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare10.c", 188
+	lda     #$3F
+	jsr     _c_int_gte_lit1
+	.dbg	line, "compare10.c", 190
+	ldx     #$02
+	lda     #$00
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare10.c", 191
+	lda     #$7F
+	jsr     _c_int_gte_lit1
+	.dbg	line, "compare10.c", 193
+	ldx     #$02
+	lda     #$01
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare10.c", 194
+	lda     #$FF
+	jsr     _c_int_gte_lit1
+	.dbg	line, "compare10.c", 196
+	ldx     #$7F
+	lda     #$00
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare10.c", 197
+	lda     #$FF
+	jsr     _c_int_gte_lit1
+	.dbg	line, "compare10.c", 201
+	ldx     #$80
+	lda     #$01
+	sta     _int0
+	stx     _int0+1
+	jmp     L0002
+	.dbg	line, "compare10.c", 202
+L0005:	lda     #$00
+	jsr     _c_int_gte_lit1
+	.dbg	line, "compare10.c", 201
+	lda     _int0
+	ldx     _int0+1
+	inc     _int0
+	bne     L0007
+	inc     _int0+1
+L0007:	lda     _int0
+	ldx     _int0+1
+	jmp     L0002
+L0002:	lda     _int0
+	ldx     _int0+1
+	cpx     #$FF
+	bne     L0006
+	cmp     #$FF
+L0006:	jsr     boolne
+	jne     L0005
+	.dbg	line, "compare10.c", 204
+	ldx     #$00
+	lda     #$01
+	sta     _int0
+	stx     _int0+1
+	jmp     L0008
+	.dbg	line, "compare10.c", 205
+L000B:	lda     #$03
+	jsr     _c_int_gte_lit1
+	.dbg	line, "compare10.c", 204
+	lda     _int0
+	ldx     _int0+1
+	inc     _int0
+	bne     L000D
+	inc     _int0+1
+L000D:	lda     _int0
+	ldx     _int0+1
+	jmp     L0008
+L0008:	lda     _int0
+	ldx     _int0+1
+	cpx     #$00
+	bne     L000C
+	cmp     #$FF
+L000C:	jsr     boolne
+	jne     L000B
+	.dbg	line, "compare10.c", 207
+	ldx     #$02
+	lda     #$01
+	sta     _int0
+	stx     _int0+1
+	jmp     L000E
+	.dbg	line, "compare10.c", 208
+L0011:	lda     #$FF
+	jsr     _c_int_gte_lit1
+	.dbg	line, "compare10.c", 207
+	lda     _int0
+	ldx     _int0+1
+	inc     _int0
+	bne     L0013
+	inc     _int0+1
+L0013:	lda     _int0
+	ldx     _int0+1
+	jmp     L000E
+L000E:	lda     _int0
+	ldx     _int0+1
+	cpx     #$7F
+	bne     L0012
+	cmp     #$FF
+L0012:	jsr     boolne
+	jne     L0011
+	.dbg	line, "compare10.c", 209
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_int_gte_lit2 (unsigned char expected_result)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_int_gte_lit2: near
+
+	.dbg	func, "c_int_gte_lit2", "00", extern, "_c_int_gte_lit2"
+	.dbg	sym, "expected_result", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "compare10.c", 212
+	jsr     pusha
+	.dbg	line, "compare10.c", 213
+	ldx     #$00
+	lda     #$00
+	sta     _result
+	.dbg	line, "compare10.c", 215
+	lda     _int0
+	ldx     _int0+1
+	cmp     #$01
+	txa
+	sbc     #$80
+	bvs     L0003
+	eor     #$80
+L0003:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	.dbg	line, "compare10.c", 216
+	ldx     #$00
+	lda     _result
+	ora     #$01
+	sta     _result
+	.dbg	line, "compare10.c", 218
+L0002:	lda     _int0
+	ldx     _int0+1
+	cmp     #$00
+	txa
+	sbc     #$81
+	bvs     L0005
+	eor     #$80
+L0005:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0004
+	.dbg	line, "compare10.c", 219
+	ldx     #$00
+	lda     _result
+	ora     #$02
+	sta     _result
+	.dbg	line, "compare10.c", 221
+L0004:	lda     _int0
+	ldx     _int0+1
+	cmp     #$01
+	txa
+	sbc     #$81
+	bvs     L0007
+	eor     #$80
+L0007:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0006
+	.dbg	line, "compare10.c", 222
+	ldx     #$00
+	lda     _result
+	ora     #$04
+	sta     _result
+	.dbg	line, "compare10.c", 224
+L0006:	lda     _int0
+	ldx     _int0+1
+	cmp     #$00
+	txa
+	sbc     #$82
+	bvs     L0009
+	eor     #$80
+L0009:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0008
+	.dbg	line, "compare10.c", 225
+	ldx     #$00
+	lda     _result
+	ora     #$08
+	sta     _result
+	.dbg	line, "compare10.c", 227
+L0008:	lda     _int0
+	ldx     _int0+1
+	cmp     #$FF
+	txa
+	sbc     #$FE
+	bvs     L000B
+	eor     #$80
+L000B:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L000A
+	.dbg	line, "compare10.c", 228
+	ldx     #$00
+	lda     _result
+	ora     #$10
+	sta     _result
+	.dbg	line, "compare10.c", 230
+L000A:	lda     _int0
+	ldx     _int0+1
+	cmp     #$00
+	txa
+	sbc     #$FF
+	bvs     L000D
+	eor     #$80
+L000D:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L000C
+	.dbg	line, "compare10.c", 231
+	ldx     #$00
+	lda     _result
+	ora     #$20
+	sta     _result
+	.dbg	line, "compare10.c", 233
+L000C:	lda     _int0
+	ldx     _int0+1
+	cmp     #$01
+	txa
+	sbc     #$FF
+	bvs     L000F
+	eor     #$80
+L000F:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L000E
+	.dbg	line, "compare10.c", 234
+	ldx     #$00
+	lda     _result
+	ora     #$40
+	sta     _result
+	.dbg	line, "compare10.c", 236
+L000E:	lda     _int0
+	ldx     _int0+1
+	cmp     #$FF
+	txa
+	sbc     #$FF
+	bvs     L0011
+	eor     #$80
+L0011:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0010
+	.dbg	line, "compare10.c", 237
+	ldx     #$00
+	lda     _result
+	ora     #$80
+	sta     _result
+	.dbg	line, "compare10.c", 239
+L0010:	ldx     #$00
+	lda     _result
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosneax
+	jeq     L0012
+	.dbg	line, "compare10.c", 240
+	ldx     #$00
+	lda     #$01
+	sta     _failures
+	.dbg	line, "compare10.c", 241
+L0012:	jsr     incsp1
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_compare2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_compare2: near
+
+	.dbg	func, "int_compare2", "00", extern, "_int_compare2"
+
+.segment	"CODE"
+
+	.dbg	line, "compare10.c", 245
+	ldx     #$80
+	lda     #$01
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare10.c", 246
+	lda     #$01
+	jsr     _c_int_gte_lit2
+	.dbg	line, "compare10.c", 248
+	ldx     #$81
+	lda     #$00
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare10.c", 249
+	lda     #$03
+	jsr     _c_int_gte_lit2
+	.dbg	line, "compare10.c", 251
+	ldx     #$81
+	lda     #$01
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare10.c", 252
+	lda     #$07
+	jsr     _c_int_gte_lit2
+	.dbg	line, "compare10.c", 254
+	ldx     #$82
+	lda     #$00
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare10.c", 255
+	lda     #$0F
+	jsr     _c_int_gte_lit2
+	.dbg	line, "compare10.c", 257
+	ldx     #$82
+	lda     #$01
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare10.c", 258
+	lda     #$0F
+	jsr     _c_int_gte_lit2
+	.dbg	line, "compare10.c", 260
+	ldx     #$BA
+	lda     #$99
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare10.c", 261
+	lda     #$0F
+	jsr     _c_int_gte_lit2
+	.dbg	line, "compare10.c", 263
+	ldx     #$FE
+	lda     #$00
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare10.c", 264
+	lda     #$0F
+	jsr     _c_int_gte_lit2
+	.dbg	line, "compare10.c", 266
+	ldx     #$FE
+	lda     #$FE
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare10.c", 267
+	lda     #$0F
+	jsr     _c_int_gte_lit2
+	.dbg	line, "compare10.c", 269
+	ldx     #$FE
+	lda     #$FF
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare10.c", 270
+	lda     #$1F
+	jsr     _c_int_gte_lit2
+	.dbg	line, "compare10.c", 272
+	ldx     #$FF
+	lda     #$00
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare10.c", 273
+	lda     #$3F
+	jsr     _c_int_gte_lit2
+	.dbg	line, "compare10.c", 275
+	ldx     #$FF
+	lda     #$01
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare10.c", 276
+	lda     #$7F
+	jsr     _c_int_gte_lit2
+	.dbg	line, "compare10.c", 278
+	ldx     #$FF
+	lda     #$FE
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare10.c", 279
+	lda     #$7F
+	jsr     _c_int_gte_lit2
+	.dbg	line, "compare10.c", 281
+	ldx     #$FF
+	lda     #$FF
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare10.c", 282
+	lda     #$FF
+	jsr     _c_int_gte_lit2
+	.dbg	line, "compare10.c", 284
+	ldx     #$00
+	lda     #$00
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare10.c", 285
+	lda     #$FF
+	jsr     _c_int_gte_lit2
+	.dbg	line, "compare10.c", 287
+	ldx     #$00
+	lda     #$01
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare10.c", 288
+	lda     #$FF
+	jsr     _c_int_gte_lit2
+	.dbg	line, "compare10.c", 290
+	ldx     #$7F
+	lda     #$FF
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare10.c", 291
+	lda     #$FF
+	jsr     _c_int_gte_lit2
+	.dbg	line, "compare10.c", 295
+	ldx     #$80
+	lda     #$01
+	sta     _int0
+	stx     _int0+1
+	jmp     L0002
+	.dbg	line, "compare10.c", 296
+L0005:	lda     #$01
+	jsr     _c_int_gte_lit2
+	.dbg	line, "compare10.c", 295
+	lda     _int0
+	ldx     _int0+1
+	inc     _int0
+	bne     L0007
+	inc     _int0+1
+L0007:	lda     _int0
+	ldx     _int0+1
+	jmp     L0002
+L0002:	lda     _int0
+	ldx     _int0+1
+	cpx     #$81
+	bne     L0006
+	cmp     #$00
+L0006:	jsr     boolne
+	jne     L0005
+	.dbg	line, "compare10.c", 298
+	ldx     #$82
+	lda     #$00
+	sta     _int0
+	stx     _int0+1
+	jmp     L0008
+	.dbg	line, "compare10.c", 299
+L000B:	lda     #$0F
+	jsr     _c_int_gte_lit2
+	.dbg	line, "compare10.c", 298
+	lda     _int0
+	ldx     _int0+1
+	inc     _int0
+	bne     L000D
+	inc     _int0+1
+L000D:	lda     _int0
+	ldx     _int0+1
+	jmp     L0008
+L0008:	lda     _int0
+	ldx     _int0+1
+	cpx     #$FE
+	bne     L000C
+	cmp     #$FF
+L000C:	jsr     boolne
+	jne     L000B
+	.dbg	line, "compare10.c", 301
+	ldx     #$FF
+	lda     #$FF
+	sta     _int0
+	stx     _int0+1
+	jmp     L000E
+	.dbg	line, "compare10.c", 302
+L0011:	lda     #$FF
+	jsr     _c_int_gte_lit2
+	.dbg	line, "compare10.c", 301
+	lda     _int0
+	ldx     _int0+1
+	inc     _int0
+	bne     L0013
+	inc     _int0+1
+L0013:	lda     _int0
+	ldx     _int0+1
+	jmp     L000E
+L000E:	lda     _int0
+	ldx     _int0+1
+	cpx     #$7F
+	bne     L0012
+	cmp     #$FF
+L0012:	jsr     boolne
+	jne     L0011
+	.dbg	line, "compare10.c", 303
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "compare10.c", 308
+	jsr     _char_compare
+	.dbg	line, "compare10.c", 309
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "compare10.c", 310
+	jsr     _int_compare1
+	.dbg	line, "compare10.c", 311
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "compare10.c", 312
+	jsr     _int_compare2
+	.dbg	line, "compare10.c", 314
+	ldx     #$00
+	lda     _failures
+	sta     _success
+	.dbg	line, "compare10.c", 315
+	jsr     _done
+	.dbg	line, "compare10.c", 316
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "compare10.c", 318
+	ldx     #$00
+	lda     _failures
+	jmp     L0001
+	.dbg	line, "compare10.c", 319
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,847 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_success
+	.export		_failures
+	.export		_dummy
+	.export		_aint0
+	.export		_aint1
+	.export		_achar0
+	.export		_achar1
+	.export		_done
+	.export		_char_lt_char
+	.export		_char_gt_char
+	.export		_char_lte_char
+	.export		_char_gte_char
+	.export		_char_lt_lit
+	.export		_char_gt_lit
+	.export		_char_lte_lit
+	.export		_char_gte_lit
+	.export		_char_lt_char_else
+	.export		_char_gt_char_else
+	.export		_char_lte_char_else
+	.export		_char_gte_char_else
+	.export		_char_lt_lit_else
+	.export		_char_gt_lit_else
+	.export		_char_lte_lit_else
+	.export		_char_gte_lit_else
+	.export		_int_lt_int
+	.export		_int_gt_int
+	.export		_int_lte_int
+	.export		_int_gte_int
+	.export		_int_lt_lit
+	.export		_int_gt_lit
+	.export		_int_lte_lit
+	.export		_int_gte_lit
+	.export		_int_lt_int_else
+	.export		_int_gt_int_else
+	.export		_int_lte_int_else
+	.export		_int_gte_int_else
+	.export		_int_lt_lit_else
+	.export		_int_gt_lit_else
+	.export		_int_lte_lit_else
+	.export		_int_gte_lit_else
+	.export		_main
+
+.segment	"DATA"
+
+_success:
+	.byte	$00
+_failures:
+	.byte	$00
+_dummy:
+	.byte	$00
+_aint0:
+	.word	$0000
+_aint1:
+	.word	$0000
+_achar0:
+	.byte	$00
+_achar1:
+	.byte	$00
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ done (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_done: near
+
+.segment	"CODE"
+
+	inc     _dummy
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ char_lt_char (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_char_lt_char: near
+
+.segment	"CODE"
+
+	lda     _achar0
+	cmp     _achar1
+	bcs     L0002
+	inc     _failures
+L0002:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ char_gt_char (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_char_gt_char: near
+
+.segment	"CODE"
+
+	lda     _achar1
+	cmp     _achar0
+	bcc     L0002
+	beq     L0002
+	inc     _failures
+L0002:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ char_lte_char (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_char_lte_char: near
+
+.segment	"CODE"
+
+	lda     _achar0
+	cmp     _achar1
+	beq     L0004
+	bcs     L0002
+L0004:	inc     _failures
+L0002:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ char_gte_char (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_char_gte_char: near
+
+.segment	"CODE"
+
+	lda     _achar1
+	cmp     _achar0
+	bcc     L0002
+	inc     _failures
+L0002:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ char_lt_lit (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_char_lt_lit: near
+
+.segment	"CODE"
+
+	lda     _achar1
+	cmp     #$10
+	bcs     L0002
+	inc     _failures
+L0002:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ char_gt_lit (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_char_gt_lit: near
+
+.segment	"CODE"
+
+	lda     _achar1
+	cmp     #$11
+	bcc     L0002
+	inc     _failures
+L0002:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ char_lte_lit (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_char_lte_lit: near
+
+.segment	"CODE"
+
+	lda     _achar1
+	cmp     #$10
+	bcs     L0002
+	inc     _failures
+L0002:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ char_gte_lit (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_char_gte_lit: near
+
+.segment	"CODE"
+
+	lda     _achar1
+	cmp     #$11
+	bcc     L0002
+	inc     _failures
+L0002:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ char_lt_char_else (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_char_lt_char_else: near
+
+.segment	"CODE"
+
+	lda     _achar0
+	cmp     _achar1
+	bcc     L0004
+	inc     _dummy
+	rts
+L0004:	inc     _failures
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ char_gt_char_else (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_char_gt_char_else: near
+
+.segment	"CODE"
+
+	lda     _achar1
+	cmp     _achar0
+	beq     L0005
+	bcs     L0006
+L0005:	inc     _dummy
+	rts
+L0006:	inc     _failures
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ char_lte_char_else (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_char_lte_char_else: near
+
+.segment	"CODE"
+
+	lda     _achar0
+	cmp     _achar1
+	bcc     L0004
+	beq     L0004
+	inc     _dummy
+	rts
+L0004:	inc     _failures
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ char_gte_char_else (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_char_gte_char_else: near
+
+.segment	"CODE"
+
+	lda     _achar1
+	cmp     _achar0
+	bcs     L0004
+	inc     _dummy
+	rts
+L0004:	inc     _failures
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ char_lt_lit_else (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_char_lt_lit_else: near
+
+.segment	"CODE"
+
+	lda     _achar1
+	cmp     #$10
+	bcc     L0004
+	inc     _dummy
+	rts
+L0004:	inc     _failures
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ char_gt_lit_else (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_char_gt_lit_else: near
+
+.segment	"CODE"
+
+	lda     _achar1
+	cmp     #$11
+	bcs     L0004
+	inc     _dummy
+	rts
+L0004:	inc     _failures
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ char_lte_lit_else (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_char_lte_lit_else: near
+
+.segment	"CODE"
+
+	lda     _achar1
+	cmp     #$10
+	bcc     L0004
+	inc     _dummy
+	rts
+L0004:	inc     _failures
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ char_gte_lit_else (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_char_gte_lit_else: near
+
+.segment	"CODE"
+
+	lda     _achar1
+	cmp     #$11
+	bcs     L0004
+	inc     _dummy
+	rts
+L0004:	inc     _failures
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_lt_int (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_lt_int: near
+
+.segment	"CODE"
+
+	lda     _aint0
+	cmp     _aint1
+	lda     _aint0+1
+	sbc     _aint1+1
+	bcs     L0002
+	inc     _failures
+L0002:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_gt_int (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_gt_int: near
+
+.segment	"CODE"
+
+	lda     _aint1
+	sec
+	sbc     _aint0
+	sta     tmp1
+	lda     _aint1+1
+	sbc     _aint0+1
+	ora     tmp1
+	bcc     L0002
+	beq     L0002
+	inc     _failures
+L0002:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_lte_int (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_lte_int: near
+
+.segment	"CODE"
+
+	lda     _aint0
+	sec
+	sbc     _aint1
+	sta     tmp1
+	lda     _aint0+1
+	sbc     _aint1+1
+	ora     tmp1
+	beq     L0003
+	bcs     L0002
+L0003:	inc     _failures
+L0002:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_gte_int (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_gte_int: near
+
+.segment	"CODE"
+
+	lda     _aint1
+	cmp     _aint0
+	lda     _aint1+1
+	sbc     _aint0+1
+	bcc     L0002
+	inc     _failures
+L0002:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_lt_lit (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_lt_lit: near
+
+.segment	"CODE"
+
+	lda     _aint1+1
+	cmp     #$00
+	bne     L0003
+	lda     _aint1
+	cmp     #$10
+L0003:	bcs     L0002
+	inc     _failures
+L0002:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_gt_lit (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_gt_lit: near
+
+.segment	"CODE"
+
+	lda     _aint1
+	cmp     #$11
+	lda     _aint1+1
+	sbc     #$00
+	bcc     L0002
+	inc     _failures
+L0002:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_lte_lit (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_lte_lit: near
+
+.segment	"CODE"
+
+	lda     _aint1+1
+	cmp     #$00
+	bne     L0003
+	lda     _aint1
+	cmp     #$10
+L0003:	bcs     L0002
+	inc     _failures
+L0002:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_gte_lit (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_gte_lit: near
+
+.segment	"CODE"
+
+	lda     _aint1
+	cmp     #$11
+	lda     _aint1+1
+	sbc     #$00
+	bcc     L0002
+	inc     _failures
+L0002:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_lt_int_else (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_lt_int_else: near
+
+.segment	"CODE"
+
+	lda     _aint0
+	cmp     _aint1
+	lda     _aint0+1
+	sbc     _aint1+1
+	bcc     L0004
+	inc     _dummy
+	rts
+L0004:	inc     _failures
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_gt_int_else (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_gt_int_else: near
+
+.segment	"CODE"
+
+	lda     _aint1
+	sec
+	sbc     _aint0
+	sta     tmp1
+	lda     _aint1+1
+	sbc     _aint0+1
+	ora     tmp1
+	beq     L0004
+	bcs     L0002
+L0004:	inc     _dummy
+	rts
+L0002:	inc     _failures
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_lte_int_else (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_lte_int_else: near
+
+.segment	"CODE"
+
+	lda     _aint0
+	sec
+	sbc     _aint1
+	sta     tmp1
+	lda     _aint0+1
+	sbc     _aint1+1
+	ora     tmp1
+	bcc     L0002
+	beq     L0002
+	inc     _dummy
+	rts
+L0002:	inc     _failures
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_gte_int_else (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_gte_int_else: near
+
+.segment	"CODE"
+
+	lda     _aint1
+	cmp     _aint0
+	lda     _aint1+1
+	sbc     _aint0+1
+	bcs     L0002
+	inc     _dummy
+	rts
+L0002:	inc     _failures
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_lt_lit_else (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_lt_lit_else: near
+
+.segment	"CODE"
+
+	lda     _aint1
+	cmp     #$10
+	lda     _aint1+1
+	sbc     #$00
+	bcc     L0004
+	inc     _dummy
+	rts
+L0004:	inc     _failures
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_gt_lit_else (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_gt_lit_else: near
+
+.segment	"CODE"
+
+	lda     _aint1+1
+	cmp     #$00
+	bne     L0003
+	lda     _aint1
+	cmp     #$11
+L0003:	bcs     L0002
+	inc     _dummy
+	rts
+L0002:	inc     _failures
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_lte_lit_else (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_lte_lit_else: near
+
+.segment	"CODE"
+
+	lda     _aint1
+	cmp     #$10
+	lda     _aint1+1
+	sbc     #$00
+	bcc     L0004
+	inc     _dummy
+	rts
+L0004:	inc     _failures
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_gte_lit_else (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_gte_lit_else: near
+
+.segment	"CODE"
+
+	lda     _aint1+1
+	cmp     #$00
+	bne     L0003
+	lda     _aint1
+	cmp     #$11
+L0003:	bcs     L0002
+	inc     _dummy
+	rts
+L0002:	inc     _failures
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     _char_lt_char
+	jsr     _char_gt_char
+	inc     _achar0
+	jsr     _char_lt_char
+	jsr     _char_gt_char
+	jsr     _char_gte_char
+	jsr     _char_lte_char
+	lda     #$10
+	sta     _achar1
+	jsr     _char_lt_lit
+	jsr     _char_gt_lit
+	jsr     _char_lte_lit
+	jsr     _char_gte_lit
+	stz     _achar0
+	stz     _achar1
+	jsr     _char_lt_char_else
+	jsr     _char_gt_char_else
+	inc     _achar0
+	jsr     _char_lt_char_else
+	jsr     _char_gt_char_else
+	jsr     _char_gte_char_else
+	jsr     _char_lte_char_else
+	lda     #$10
+	sta     _achar1
+	jsr     _char_lt_lit_else
+	jsr     _char_gt_lit_else
+	jsr     _char_lte_lit_else
+	jsr     _char_gte_lit_else
+	jsr     _int_lt_int
+	jsr     _int_gt_int
+	inc     _aint0
+	bne     L0002
+	inc     _aint0+1
+L0002:	jsr     _int_lt_int
+	jsr     _int_gt_int
+	jsr     _int_gte_int
+	jsr     _int_lte_int
+	lda     #$10
+	sta     _aint1
+	stz     _aint1+1
+	jsr     _int_lt_lit
+	jsr     _int_gt_lit
+	jsr     _int_lte_lit
+	jsr     _int_gte_lit
+	stz     _aint0
+	stz     _aint0+1
+	stz     _aint1
+	stz     _aint1+1
+	jsr     _int_lt_int_else
+	jsr     _int_gt_int_else
+	inc     _aint0
+	bne     L0003
+	inc     _aint0+1
+L0003:	jsr     _int_lt_int_else
+	jsr     _int_gt_int_else
+	jsr     _int_gte_int_else
+	jsr     _int_lte_int_else
+	lda     #$10
+	sta     _aint1
+	stz     _aint1+1
+	jsr     _int_lt_lit_else
+	jsr     _int_gt_lit_else
+	jsr     _int_lte_lit_else
+	jsr     _int_gte_lit_else
+	lda     _failures
+	sta     _success
+	jsr     _done
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     _failures
+	rts
+
+.endproc
+
@@ -0,0 +1,1339 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "compare2.c", 4169, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/limits.h", 3146, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_success
+	.export		_failures
+	.export		_dummy
+	.export		_aint0
+	.export		_aint1
+	.export		_achar0
+	.export		_achar1
+	.export		_done
+	.export		_char_lt_char
+	.export		_char_gt_char
+	.export		_char_lte_char
+	.export		_char_gte_char
+	.export		_char_lt_lit
+	.export		_char_gt_lit
+	.export		_char_lte_lit
+	.export		_char_gte_lit
+	.export		_char_lt_char_else
+	.export		_char_gt_char_else
+	.export		_char_lte_char_else
+	.export		_char_gte_char_else
+	.export		_char_lt_lit_else
+	.export		_char_gt_lit_else
+	.export		_char_lte_lit_else
+	.export		_char_gte_lit_else
+	.export		_int_lt_int
+	.export		_int_gt_int
+	.export		_int_lte_int
+	.export		_int_gte_int
+	.export		_int_lt_lit
+	.export		_int_gt_lit
+	.export		_int_lte_lit
+	.export		_int_gte_lit
+	.export		_int_lt_int_else
+	.export		_int_gt_int_else
+	.export		_int_lte_int_else
+	.export		_int_gte_int_else
+	.export		_int_lt_lit_else
+	.export		_int_gt_lit_else
+	.export		_int_lte_lit_else
+	.export		_int_gte_lit_else
+	.export		_main
+
+.segment	"DATA"
+
+_success:
+	.byte	$00
+_failures:
+	.byte	$00
+_dummy:
+	.byte	$00
+_aint0:
+	.word	$0000
+_aint1:
+	.word	$0000
+_achar0:
+	.byte	$00
+_achar1:
+	.byte	$00
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ done (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_done: near
+
+	.dbg	func, "done", "00", extern, "_done"
+
+.segment	"CODE"
+
+	.dbg	line, "compare2.c", 25
+	ldx     #$00
+	lda     _dummy
+	inc     _dummy
+	.dbg	line, "compare2.c", 26
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ char_lt_char (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_char_lt_char: near
+
+	.dbg	func, "char_lt_char", "00", extern, "_char_lt_char"
+
+.segment	"CODE"
+
+	.dbg	line, "compare2.c", 31
+	ldx     #$00
+	lda     _achar0
+	jsr     pushax
+	ldx     #$00
+	lda     _achar1
+	jsr     tosultax
+	jeq     L0002
+	.dbg	line, "compare2.c", 32
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare2.c", 33
+L0002:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ char_gt_char (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_char_gt_char: near
+
+	.dbg	func, "char_gt_char", "00", extern, "_char_gt_char"
+
+.segment	"CODE"
+
+	.dbg	line, "compare2.c", 38
+	ldx     #$00
+	lda     _achar1
+	jsr     pushax
+	ldx     #$00
+	lda     _achar0
+	jsr     tosugtax
+	jeq     L0002
+	.dbg	line, "compare2.c", 39
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare2.c", 40
+L0002:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ char_lte_char (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_char_lte_char: near
+
+	.dbg	func, "char_lte_char", "00", extern, "_char_lte_char"
+
+.segment	"CODE"
+
+	.dbg	line, "compare2.c", 45
+	ldx     #$00
+	lda     _achar0
+	jsr     pushax
+	ldx     #$00
+	lda     _achar1
+	jsr     tosuleax
+	jeq     L0002
+	.dbg	line, "compare2.c", 46
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare2.c", 47
+L0002:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ char_gte_char (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_char_gte_char: near
+
+	.dbg	func, "char_gte_char", "00", extern, "_char_gte_char"
+
+.segment	"CODE"
+
+	.dbg	line, "compare2.c", 52
+	ldx     #$00
+	lda     _achar1
+	jsr     pushax
+	ldx     #$00
+	lda     _achar0
+	jsr     tosugeax
+	jeq     L0002
+	.dbg	line, "compare2.c", 53
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare2.c", 54
+L0002:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ char_lt_lit (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_char_lt_lit: near
+
+	.dbg	func, "char_lt_lit", "00", extern, "_char_lt_lit"
+
+.segment	"CODE"
+
+	.dbg	line, "compare2.c", 59
+	ldx     #$00
+	lda     _achar1
+	cmp     #$10
+	jsr     boolult
+	jeq     L0002
+	.dbg	line, "compare2.c", 60
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare2.c", 61
+L0002:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ char_gt_lit (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_char_gt_lit: near
+
+	.dbg	func, "char_gt_lit", "00", extern, "_char_gt_lit"
+
+.segment	"CODE"
+
+	.dbg	line, "compare2.c", 66
+	ldx     #$00
+	lda     _achar1
+	cmp     #$11
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	.dbg	line, "compare2.c", 67
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare2.c", 68
+L0002:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ char_lte_lit (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_char_lte_lit: near
+
+	.dbg	func, "char_lte_lit", "00", extern, "_char_lte_lit"
+
+.segment	"CODE"
+
+	.dbg	line, "compare2.c", 73
+	ldx     #$00
+	lda     _achar1
+	cmp     #$10
+	jsr     boolult
+	jeq     L0002
+	.dbg	line, "compare2.c", 74
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare2.c", 75
+L0002:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ char_gte_lit (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_char_gte_lit: near
+
+	.dbg	func, "char_gte_lit", "00", extern, "_char_gte_lit"
+
+.segment	"CODE"
+
+	.dbg	line, "compare2.c", 80
+	ldx     #$00
+	lda     _achar1
+	cmp     #$11
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	.dbg	line, "compare2.c", 81
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare2.c", 82
+L0002:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ char_lt_char_else (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_char_lt_char_else: near
+
+	.dbg	func, "char_lt_char_else", "00", extern, "_char_lt_char_else"
+
+.segment	"CODE"
+
+	.dbg	line, "compare2.c", 88
+	ldx     #$00
+	lda     _achar0
+	jsr     pushax
+	ldx     #$00
+	lda     _achar1
+	jsr     tosugeax
+	jeq     L0002
+	.dbg	line, "compare2.c", 89
+	ldx     #$00
+	lda     _dummy
+	inc     _dummy
+	.dbg	line, "compare2.c", 90
+	jmp     L0003
+	.dbg	line, "compare2.c", 91
+L0002:	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare2.c", 92
+L0003:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ char_gt_char_else (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_char_gt_char_else: near
+
+	.dbg	func, "char_gt_char_else", "00", extern, "_char_gt_char_else"
+
+.segment	"CODE"
+
+	.dbg	line, "compare2.c", 97
+	ldx     #$00
+	lda     _achar1
+	jsr     pushax
+	ldx     #$00
+	lda     _achar0
+	jsr     tosuleax
+	jeq     L0002
+	.dbg	line, "compare2.c", 98
+	ldx     #$00
+	lda     _dummy
+	inc     _dummy
+	.dbg	line, "compare2.c", 99
+	jmp     L0003
+	.dbg	line, "compare2.c", 100
+L0002:	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare2.c", 101
+L0003:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ char_lte_char_else (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_char_lte_char_else: near
+
+	.dbg	func, "char_lte_char_else", "00", extern, "_char_lte_char_else"
+
+.segment	"CODE"
+
+	.dbg	line, "compare2.c", 106
+	ldx     #$00
+	lda     _achar0
+	jsr     pushax
+	ldx     #$00
+	lda     _achar1
+	jsr     tosugtax
+	jeq     L0002
+	.dbg	line, "compare2.c", 107
+	ldx     #$00
+	lda     _dummy
+	inc     _dummy
+	.dbg	line, "compare2.c", 108
+	jmp     L0003
+	.dbg	line, "compare2.c", 109
+L0002:	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare2.c", 110
+L0003:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ char_gte_char_else (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_char_gte_char_else: near
+
+	.dbg	func, "char_gte_char_else", "00", extern, "_char_gte_char_else"
+
+.segment	"CODE"
+
+	.dbg	line, "compare2.c", 115
+	ldx     #$00
+	lda     _achar1
+	jsr     pushax
+	ldx     #$00
+	lda     _achar0
+	jsr     tosultax
+	jeq     L0002
+	.dbg	line, "compare2.c", 116
+	ldx     #$00
+	lda     _dummy
+	inc     _dummy
+	.dbg	line, "compare2.c", 117
+	jmp     L0003
+	.dbg	line, "compare2.c", 118
+L0002:	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare2.c", 119
+L0003:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ char_lt_lit_else (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_char_lt_lit_else: near
+
+	.dbg	func, "char_lt_lit_else", "00", extern, "_char_lt_lit_else"
+
+.segment	"CODE"
+
+	.dbg	line, "compare2.c", 124
+	ldx     #$00
+	lda     _achar1
+	cmp     #$10
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	.dbg	line, "compare2.c", 125
+	ldx     #$00
+	lda     _dummy
+	inc     _dummy
+	.dbg	line, "compare2.c", 126
+	jmp     L0003
+	.dbg	line, "compare2.c", 127
+L0002:	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare2.c", 128
+L0003:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ char_gt_lit_else (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_char_gt_lit_else: near
+
+	.dbg	func, "char_gt_lit_else", "00", extern, "_char_gt_lit_else"
+
+.segment	"CODE"
+
+	.dbg	line, "compare2.c", 133
+	ldx     #$00
+	lda     _achar1
+	cmp     #$11
+	jsr     boolult
+	jeq     L0002
+	.dbg	line, "compare2.c", 134
+	ldx     #$00
+	lda     _dummy
+	inc     _dummy
+	.dbg	line, "compare2.c", 135
+	jmp     L0003
+	.dbg	line, "compare2.c", 136
+L0002:	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare2.c", 137
+L0003:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ char_lte_lit_else (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_char_lte_lit_else: near
+
+	.dbg	func, "char_lte_lit_else", "00", extern, "_char_lte_lit_else"
+
+.segment	"CODE"
+
+	.dbg	line, "compare2.c", 142
+	ldx     #$00
+	lda     _achar1
+	cmp     #$10
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	.dbg	line, "compare2.c", 143
+	ldx     #$00
+	lda     _dummy
+	inc     _dummy
+	.dbg	line, "compare2.c", 144
+	jmp     L0003
+	.dbg	line, "compare2.c", 145
+L0002:	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare2.c", 146
+L0003:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ char_gte_lit_else (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_char_gte_lit_else: near
+
+	.dbg	func, "char_gte_lit_else", "00", extern, "_char_gte_lit_else"
+
+.segment	"CODE"
+
+	.dbg	line, "compare2.c", 151
+	ldx     #$00
+	lda     _achar1
+	cmp     #$11
+	jsr     boolult
+	jeq     L0002
+	.dbg	line, "compare2.c", 152
+	ldx     #$00
+	lda     _dummy
+	inc     _dummy
+	.dbg	line, "compare2.c", 153
+	jmp     L0003
+	.dbg	line, "compare2.c", 154
+L0002:	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare2.c", 155
+L0003:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_lt_int (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_lt_int: near
+
+	.dbg	func, "int_lt_int", "00", extern, "_int_lt_int"
+
+.segment	"CODE"
+
+	.dbg	line, "compare2.c", 162
+	lda     _aint0
+	ldx     _aint0+1
+	jsr     pushax
+	lda     _aint1
+	ldx     _aint1+1
+	jsr     tosultax
+	jeq     L0002
+	.dbg	line, "compare2.c", 163
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare2.c", 164
+L0002:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_gt_int (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_gt_int: near
+
+	.dbg	func, "int_gt_int", "00", extern, "_int_gt_int"
+
+.segment	"CODE"
+
+	.dbg	line, "compare2.c", 169
+	lda     _aint1
+	ldx     _aint1+1
+	jsr     pushax
+	lda     _aint0
+	ldx     _aint0+1
+	jsr     tosugtax
+	jeq     L0002
+	.dbg	line, "compare2.c", 170
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare2.c", 171
+L0002:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_lte_int (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_lte_int: near
+
+	.dbg	func, "int_lte_int", "00", extern, "_int_lte_int"
+
+.segment	"CODE"
+
+	.dbg	line, "compare2.c", 176
+	lda     _aint0
+	ldx     _aint0+1
+	jsr     pushax
+	lda     _aint1
+	ldx     _aint1+1
+	jsr     tosuleax
+	jeq     L0002
+	.dbg	line, "compare2.c", 177
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare2.c", 178
+L0002:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_gte_int (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_gte_int: near
+
+	.dbg	func, "int_gte_int", "00", extern, "_int_gte_int"
+
+.segment	"CODE"
+
+	.dbg	line, "compare2.c", 183
+	lda     _aint1
+	ldx     _aint1+1
+	jsr     pushax
+	lda     _aint0
+	ldx     _aint0+1
+	jsr     tosugeax
+	jeq     L0002
+	.dbg	line, "compare2.c", 184
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare2.c", 185
+L0002:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_lt_lit (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_lt_lit: near
+
+	.dbg	func, "int_lt_lit", "00", extern, "_int_lt_lit"
+
+.segment	"CODE"
+
+	.dbg	line, "compare2.c", 190
+	lda     _aint1
+	ldx     _aint1+1
+	cpx     #$00
+	bne     L0003
+	cmp     #$10
+L0003:	jsr     boolult
+	jeq     L0002
+	.dbg	line, "compare2.c", 191
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare2.c", 192
+L0002:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_gt_lit (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_gt_lit: near
+
+	.dbg	func, "int_gt_lit", "00", extern, "_int_gt_lit"
+
+.segment	"CODE"
+
+	.dbg	line, "compare2.c", 197
+	lda     _aint1
+	ldx     _aint1+1
+	cmp     #$11
+	txa
+	sbc     #$00
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	.dbg	line, "compare2.c", 198
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare2.c", 199
+L0002:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_lte_lit (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_lte_lit: near
+
+	.dbg	func, "int_lte_lit", "00", extern, "_int_lte_lit"
+
+.segment	"CODE"
+
+	.dbg	line, "compare2.c", 204
+	lda     _aint1
+	ldx     _aint1+1
+	cpx     #$00
+	bne     L0003
+	cmp     #$10
+L0003:	jsr     boolult
+	jeq     L0002
+	.dbg	line, "compare2.c", 205
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare2.c", 206
+L0002:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_gte_lit (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_gte_lit: near
+
+	.dbg	func, "int_gte_lit", "00", extern, "_int_gte_lit"
+
+.segment	"CODE"
+
+	.dbg	line, "compare2.c", 211
+	lda     _aint1
+	ldx     _aint1+1
+	cmp     #$11
+	txa
+	sbc     #$00
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	.dbg	line, "compare2.c", 212
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare2.c", 213
+L0002:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_lt_int_else (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_lt_int_else: near
+
+	.dbg	func, "int_lt_int_else", "00", extern, "_int_lt_int_else"
+
+.segment	"CODE"
+
+	.dbg	line, "compare2.c", 220
+	lda     _aint0
+	ldx     _aint0+1
+	jsr     pushax
+	lda     _aint1
+	ldx     _aint1+1
+	jsr     tosugeax
+	jeq     L0002
+	.dbg	line, "compare2.c", 221
+	ldx     #$00
+	lda     _dummy
+	inc     _dummy
+	.dbg	line, "compare2.c", 222
+	jmp     L0003
+	.dbg	line, "compare2.c", 223
+L0002:	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare2.c", 224
+L0003:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_gt_int_else (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_gt_int_else: near
+
+	.dbg	func, "int_gt_int_else", "00", extern, "_int_gt_int_else"
+
+.segment	"CODE"
+
+	.dbg	line, "compare2.c", 229
+	lda     _aint1
+	ldx     _aint1+1
+	jsr     pushax
+	lda     _aint0
+	ldx     _aint0+1
+	jsr     tosuleax
+	jeq     L0002
+	.dbg	line, "compare2.c", 230
+	ldx     #$00
+	lda     _dummy
+	inc     _dummy
+	.dbg	line, "compare2.c", 231
+	jmp     L0003
+	.dbg	line, "compare2.c", 232
+L0002:	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare2.c", 233
+L0003:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_lte_int_else (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_lte_int_else: near
+
+	.dbg	func, "int_lte_int_else", "00", extern, "_int_lte_int_else"
+
+.segment	"CODE"
+
+	.dbg	line, "compare2.c", 238
+	lda     _aint0
+	ldx     _aint0+1
+	jsr     pushax
+	lda     _aint1
+	ldx     _aint1+1
+	jsr     tosugtax
+	jeq     L0002
+	.dbg	line, "compare2.c", 239
+	ldx     #$00
+	lda     _dummy
+	inc     _dummy
+	.dbg	line, "compare2.c", 240
+	jmp     L0003
+	.dbg	line, "compare2.c", 241
+L0002:	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare2.c", 242
+L0003:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_gte_int_else (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_gte_int_else: near
+
+	.dbg	func, "int_gte_int_else", "00", extern, "_int_gte_int_else"
+
+.segment	"CODE"
+
+	.dbg	line, "compare2.c", 247
+	lda     _aint1
+	ldx     _aint1+1
+	jsr     pushax
+	lda     _aint0
+	ldx     _aint0+1
+	jsr     tosultax
+	jeq     L0002
+	.dbg	line, "compare2.c", 248
+	ldx     #$00
+	lda     _dummy
+	inc     _dummy
+	.dbg	line, "compare2.c", 249
+	jmp     L0003
+	.dbg	line, "compare2.c", 250
+L0002:	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare2.c", 251
+L0003:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_lt_lit_else (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_lt_lit_else: near
+
+	.dbg	func, "int_lt_lit_else", "00", extern, "_int_lt_lit_else"
+
+.segment	"CODE"
+
+	.dbg	line, "compare2.c", 256
+	lda     _aint1
+	ldx     _aint1+1
+	cmp     #$10
+	txa
+	sbc     #$00
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	.dbg	line, "compare2.c", 257
+	ldx     #$00
+	lda     _dummy
+	inc     _dummy
+	.dbg	line, "compare2.c", 258
+	jmp     L0003
+	.dbg	line, "compare2.c", 259
+L0002:	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare2.c", 260
+L0003:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_gt_lit_else (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_gt_lit_else: near
+
+	.dbg	func, "int_gt_lit_else", "00", extern, "_int_gt_lit_else"
+
+.segment	"CODE"
+
+	.dbg	line, "compare2.c", 265
+	lda     _aint1
+	ldx     _aint1+1
+	cpx     #$00
+	bne     L0003
+	cmp     #$11
+L0003:	jsr     boolult
+	jeq     L0002
+	.dbg	line, "compare2.c", 266
+	ldx     #$00
+	lda     _dummy
+	inc     _dummy
+	.dbg	line, "compare2.c", 267
+	jmp     L0004
+	.dbg	line, "compare2.c", 268
+L0002:	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare2.c", 269
+L0004:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_lte_lit_else (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_lte_lit_else: near
+
+	.dbg	func, "int_lte_lit_else", "00", extern, "_int_lte_lit_else"
+
+.segment	"CODE"
+
+	.dbg	line, "compare2.c", 274
+	lda     _aint1
+	ldx     _aint1+1
+	cmp     #$10
+	txa
+	sbc     #$00
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	.dbg	line, "compare2.c", 275
+	ldx     #$00
+	lda     _dummy
+	inc     _dummy
+	.dbg	line, "compare2.c", 276
+	jmp     L0003
+	.dbg	line, "compare2.c", 277
+L0002:	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare2.c", 278
+L0003:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_gte_lit_else (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_gte_lit_else: near
+
+	.dbg	func, "int_gte_lit_else", "00", extern, "_int_gte_lit_else"
+
+.segment	"CODE"
+
+	.dbg	line, "compare2.c", 283
+	lda     _aint1
+	ldx     _aint1+1
+	cpx     #$00
+	bne     L0003
+	cmp     #$11
+L0003:	jsr     boolult
+	jeq     L0002
+	.dbg	line, "compare2.c", 284
+	ldx     #$00
+	lda     _dummy
+	inc     _dummy
+	.dbg	line, "compare2.c", 285
+	jmp     L0004
+	.dbg	line, "compare2.c", 286
+L0002:	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare2.c", 287
+L0004:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "compare2.c", 292
+	jsr     _char_lt_char
+	.dbg	line, "compare2.c", 293
+	jsr     _char_gt_char
+	.dbg	line, "compare2.c", 295
+	ldx     #$00
+	lda     _achar0
+	inc     _achar0
+	.dbg	line, "compare2.c", 296
+	jsr     _char_lt_char
+	.dbg	line, "compare2.c", 297
+	jsr     _char_gt_char
+	.dbg	line, "compare2.c", 298
+	jsr     _char_gte_char
+	.dbg	line, "compare2.c", 299
+	jsr     _char_lte_char
+	.dbg	line, "compare2.c", 301
+	ldx     #$00
+	lda     #$10
+	sta     _achar1
+	.dbg	line, "compare2.c", 302
+	jsr     _char_lt_lit
+	.dbg	line, "compare2.c", 303
+	jsr     _char_gt_lit
+	.dbg	line, "compare2.c", 304
+	jsr     _char_lte_lit
+	.dbg	line, "compare2.c", 305
+	jsr     _char_gte_lit
+	.dbg	line, "compare2.c", 307
+	ldx     #$00
+	lda     #$00
+	sta     _achar0
+	.dbg	line, "compare2.c", 308
+	ldx     #$00
+	lda     #$00
+	sta     _achar1
+	.dbg	line, "compare2.c", 310
+	jsr     _char_lt_char_else
+	.dbg	line, "compare2.c", 311
+	jsr     _char_gt_char_else
+	.dbg	line, "compare2.c", 313
+	ldx     #$00
+	lda     _achar0
+	inc     _achar0
+	.dbg	line, "compare2.c", 314
+	jsr     _char_lt_char_else
+	.dbg	line, "compare2.c", 315
+	jsr     _char_gt_char_else
+	.dbg	line, "compare2.c", 316
+	jsr     _char_gte_char_else
+	.dbg	line, "compare2.c", 317
+	jsr     _char_lte_char_else
+	.dbg	line, "compare2.c", 319
+	ldx     #$00
+	lda     #$10
+	sta     _achar1
+	.dbg	line, "compare2.c", 320
+	jsr     _char_lt_lit_else
+	.dbg	line, "compare2.c", 321
+	jsr     _char_gt_lit_else
+	.dbg	line, "compare2.c", 322
+	jsr     _char_lte_lit_else
+	.dbg	line, "compare2.c", 323
+	jsr     _char_gte_lit_else
+	.dbg	line, "compare2.c", 325
+	jsr     _int_lt_int
+	.dbg	line, "compare2.c", 326
+	jsr     _int_gt_int
+	.dbg	line, "compare2.c", 328
+	lda     _aint0
+	ldx     _aint0+1
+	inc     _aint0
+	bne     L0002
+	inc     _aint0+1
+L0002:	lda     _aint0
+	ldx     _aint0+1
+	.dbg	line, "compare2.c", 329
+	jsr     _int_lt_int
+	.dbg	line, "compare2.c", 330
+	jsr     _int_gt_int
+	.dbg	line, "compare2.c", 331
+	jsr     _int_gte_int
+	.dbg	line, "compare2.c", 332
+	jsr     _int_lte_int
+	.dbg	line, "compare2.c", 334
+	ldx     #$00
+	lda     #$10
+	sta     _aint1
+	stx     _aint1+1
+	.dbg	line, "compare2.c", 335
+	jsr     _int_lt_lit
+	.dbg	line, "compare2.c", 336
+	jsr     _int_gt_lit
+	.dbg	line, "compare2.c", 337
+	jsr     _int_lte_lit
+	.dbg	line, "compare2.c", 338
+	jsr     _int_gte_lit
+	.dbg	line, "compare2.c", 340
+	ldx     #$00
+	lda     #$00
+	sta     _aint0
+	stx     _aint0+1
+	.dbg	line, "compare2.c", 341
+	ldx     #$00
+	lda     #$00
+	sta     _aint1
+	stx     _aint1+1
+	.dbg	line, "compare2.c", 342
+	jsr     _int_lt_int_else
+	.dbg	line, "compare2.c", 343
+	jsr     _int_gt_int_else
+	.dbg	line, "compare2.c", 345
+	lda     _aint0
+	ldx     _aint0+1
+	inc     _aint0
+	bne     L0003
+	inc     _aint0+1
+L0003:	lda     _aint0
+	ldx     _aint0+1
+	.dbg	line, "compare2.c", 346
+	jsr     _int_lt_int_else
+	.dbg	line, "compare2.c", 347
+	jsr     _int_gt_int_else
+	.dbg	line, "compare2.c", 348
+	jsr     _int_gte_int_else
+	.dbg	line, "compare2.c", 349
+	jsr     _int_lte_int_else
+	.dbg	line, "compare2.c", 351
+	ldx     #$00
+	lda     #$10
+	sta     _aint1
+	stx     _aint1+1
+	.dbg	line, "compare2.c", 352
+	jsr     _int_lt_lit_else
+	.dbg	line, "compare2.c", 353
+	jsr     _int_gt_lit_else
+	.dbg	line, "compare2.c", 354
+	jsr     _int_lte_lit_else
+	.dbg	line, "compare2.c", 355
+	jsr     _int_gte_lit_else
+	.dbg	line, "compare2.c", 357
+	ldx     #$00
+	lda     _failures
+	sta     _success
+	.dbg	line, "compare2.c", 358
+	jsr     _done
+	.dbg	line, "compare2.c", 359
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "compare2.c", 361
+	ldx     #$00
+	lda     _failures
+	jmp     L0001
+	.dbg	line, "compare2.c", 362
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,413 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_success
+	.export		_failures
+	.export		_dummy
+	.export		_aint0
+	.export		_aint1
+	.export		_achar0
+	.export		_achar1
+	.export		_done
+	.export		_c_0
+	.export		_c_1
+	.export		_c_2
+	.export		_c_ff
+	.export		_c_a5
+	.export		_c_a500
+	.export		_c_abcd
+	.export		_c_ifelse1
+	.export		_main
+
+.segment	"DATA"
+
+_success:
+	.byte	$00
+_failures:
+	.byte	$00
+_dummy:
+	.byte	$00
+_aint0:
+	.word	$0000
+_aint1:
+	.word	$0000
+_achar0:
+	.byte	$00
+_achar1:
+	.byte	$00
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ done (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_done: near
+
+.segment	"CODE"
+
+	inc     _dummy
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_0 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_0: near
+
+.segment	"CODE"
+
+	lda     _achar0
+	beq     L0002
+	inc     _failures
+L0002:	lda     _achar0
+	beq     L000C
+	inc     _failures
+L000C:	lda     _achar1
+	bne     L0004
+	inc     _failures
+L0004:	lda     _achar1
+	bne     L0005
+	inc     _failures
+L0005:	lda     _aint0
+	ora     _aint0+1
+	beq     L0006
+	inc     _failures
+L0006:	lda     _aint0
+	ora     _aint0+1
+	beq     L0008
+	inc     _failures
+L0008:	lda     _aint1
+	ora     _aint1+1
+	bne     L0009
+	inc     _failures
+L0009:	lda     _aint1
+	ora     _aint1+1
+	bne     L000B
+	inc     _failures
+L000B:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_1: near
+
+.segment	"CODE"
+
+	lda     _achar0
+	cmp     #$01
+	bne     L0008
+	inc     _failures
+L0008:	lda     _achar1
+	cmp     #$01
+	beq     L0003
+	inc     _failures
+L0003:	lda     _aint0+1
+	bne     L0004
+	lda     _aint0
+	cmp     #$01
+	bne     L0004
+	inc     _failures
+L0004:	lda     _aint1+1
+	bne     L0009
+	lda     _aint1
+	cmp     #$01
+	beq     L0006
+L0009:	inc     _failures
+L0006:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_2: near
+
+.segment	"CODE"
+
+	lda     _achar0
+	cmp     #$02
+	beq     L0002
+	inc     _failures
+L0002:	lda     _aint0+1
+	bne     L0005
+	lda     _aint0
+	cmp     #$02
+	beq     L0003
+L0005:	inc     _failures
+L0003:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_ff (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_ff: near
+
+.segment	"CODE"
+
+	lda     _achar0
+	cmp     #$FF
+	beq     L0002
+	inc     _failures
+L0002:	lda     _aint0+1
+	bne     L0009
+	lda     _aint0
+	cmp     #$FF
+	beq     L0003
+L0009:	inc     _failures
+L0003:	lda     _aint0+1
+	bne     L0005
+	lda     _aint0
+	cmp     #$FE
+	bne     L0005
+	inc     _failures
+L0005:	lda     _aint0+1
+	cmp     #$FF
+	bne     L0007
+	lda     _aint0
+	bne     L0007
+	inc     _failures
+L0007:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_a5 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_a5: near
+
+.segment	"CODE"
+
+	lda     _achar0
+	cmp     #$A5
+	beq     L0002
+	inc     _failures
+L0002:	lda     _aint0+1
+	bne     L0009
+	lda     _aint0
+	cmp     #$A5
+	beq     L0003
+L0009:	inc     _failures
+L0003:	lda     _aint0+1
+	bne     L0005
+	lda     _aint0
+	cmp     #$A4
+	bne     L0005
+	inc     _failures
+L0005:	lda     _aint0+1
+	cmp     #$A5
+	bne     L0007
+	lda     _aint0
+	bne     L0007
+	inc     _failures
+L0007:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_a500 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_a500: near
+
+.segment	"CODE"
+
+	lda     _aint0+1
+	cmp     #$A5
+	bne     L0009
+	lda     _aint0
+	beq     L0003
+L0009:	inc     _failures
+L0003:	lda     _aint0+1
+	cmp     #$A4
+	bne     L0005
+	lda     _aint0
+	bne     L0005
+	inc     _failures
+L0005:	lda     _aint0+1
+	bne     L0007
+	lda     _aint0
+	cmp     #$A5
+	bne     L0007
+	inc     _failures
+L0007:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_abcd (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_abcd: near
+
+.segment	"CODE"
+
+	lda     _aint0+1
+	cmp     #$AB
+	bne     L0011
+	lda     _aint0
+	cmp     #$CD
+	beq     L0003
+L0011:	inc     _failures
+L0003:	lda     _aint0+1
+	cmp     #$AB
+	bne     L0005
+	lda     _aint0
+	bne     L0005
+	inc     _failures
+L0005:	lda     _aint0+1
+	bne     L0007
+	lda     _aint0
+	cmp     #$CD
+	bne     L0007
+	inc     _failures
+L0007:	lda     _aint0+1
+	cmp     #$05
+	bne     L0009
+	lda     _aint0
+	cmp     #$CD
+	bne     L0009
+	inc     _failures
+L0009:	lda     _aint0+1
+	cmp     #$AB
+	bne     L000B
+	lda     _aint0
+	cmp     #$05
+	bne     L000B
+	inc     _failures
+L000B:	lda     _aint0+1
+	cmp     #$AB
+	bne     L000D
+	lda     _aint0
+	cmp     #$01
+	bne     L000D
+	inc     _failures
+L000D:	lda     _aint0+1
+	cmp     #$01
+	bne     L000F
+	lda     _aint0
+	cmp     #$CD
+	bne     L000F
+	inc     _failures
+L000F:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_ifelse1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_ifelse1: near
+
+.segment	"CODE"
+
+	lda     _achar0
+	beq     L0005
+	lda     _achar1
+L0005:	sta     _achar0
+	and     #$FF
+	beq     L0004
+	inc     _failures
+L0004:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #$01
+	sta     _aint1
+	stz     _aint1+1
+	sta     _achar1
+	jsr     _c_0
+	jsr     _c_1
+	lda     #$02
+	sta     _aint0
+	stz     _aint0+1
+	sta     _achar0
+	jsr     _c_2
+	lda     #$FF
+	sta     _aint0
+	stz     _aint0+1
+	sta     _achar0
+	jsr     _c_ff
+	lda     #$A5
+	sta     _aint0
+	stz     _aint0+1
+	sta     _achar0
+	jsr     _c_a5
+	ldx     #$AB
+	lda     #$CD
+	sta     _aint0
+	stx     _aint0+1
+	jsr     _c_abcd
+	stz     _achar0
+	stz     _achar1
+	jsr     _c_ifelse1
+	lda     #$01
+	sta     _achar0
+	jsr     _c_ifelse1
+	lda     _failures
+	sta     _success
+	jsr     _done
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     _failures
+	rts
+
+.endproc
+
@@ -0,0 +1,723 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "compare3.c", 2925, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/limits.h", 3146, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_success
+	.export		_failures
+	.export		_dummy
+	.export		_aint0
+	.export		_aint1
+	.export		_achar0
+	.export		_achar1
+	.export		_done
+	.export		_c_0
+	.export		_c_1
+	.export		_c_2
+	.export		_c_ff
+	.export		_c_a5
+	.export		_c_a500
+	.export		_c_abcd
+	.export		_c_ifelse1
+	.export		_main
+
+.segment	"DATA"
+
+_success:
+	.byte	$00
+_failures:
+	.byte	$00
+_dummy:
+	.byte	$00
+_aint0:
+	.word	$0000
+_aint1:
+	.word	$0000
+_achar0:
+	.byte	$00
+_achar1:
+	.byte	$00
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ done (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_done: near
+
+	.dbg	func, "done", "00", extern, "_done"
+
+.segment	"CODE"
+
+	.dbg	line, "compare3.c", 29
+	ldx     #$00
+	lda     _dummy
+	inc     _dummy
+	.dbg	line, "compare3.c", 30
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_0 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_0: near
+
+	.dbg	func, "c_0", "00", extern, "_c_0"
+
+.segment	"CODE"
+
+	.dbg	line, "compare3.c", 41
+	ldx     #$00
+	lda     _achar0
+	cmp     #$00
+	jsr     boolne
+	jeq     L0002
+	.dbg	line, "compare3.c", 42
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare3.c", 44
+L0002:	lda     _achar0
+	jeq     L0003
+	.dbg	line, "compare3.c", 45
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare3.c", 47
+L0003:	ldx     #$00
+	lda     _achar1
+	cmp     #$00
+	jsr     booleq
+	jeq     L0004
+	.dbg	line, "compare3.c", 48
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare3.c", 50
+L0004:	ldx     #$00
+	lda     _achar1
+	jsr     bnega
+	jeq     L0005
+	.dbg	line, "compare3.c", 51
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare3.c", 53
+L0005:	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$00
+	bne     L0007
+	cmp     #$00
+L0007:	jsr     boolne
+	jeq     L0006
+	.dbg	line, "compare3.c", 54
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare3.c", 56
+L0006:	lda     _aint0
+	ora     _aint0+1
+	jeq     L0008
+	.dbg	line, "compare3.c", 57
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare3.c", 59
+L0008:	lda     _aint1
+	ldx     _aint1+1
+	cpx     #$00
+	bne     L000A
+	cmp     #$00
+L000A:	jsr     booleq
+	jeq     L0009
+	.dbg	line, "compare3.c", 60
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare3.c", 62
+L0009:	lda     _aint1
+	ldx     _aint1+1
+	jsr     bnegax
+	jeq     L000B
+	.dbg	line, "compare3.c", 63
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare3.c", 64
+L000B:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_1: near
+
+	.dbg	func, "c_1", "00", extern, "_c_1"
+
+.segment	"CODE"
+
+	.dbg	line, "compare3.c", 75
+	ldx     #$00
+	lda     _achar0
+	cmp     #$01
+	jsr     booleq
+	jeq     L0002
+	.dbg	line, "compare3.c", 76
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare3.c", 78
+L0002:	ldx     #$00
+	lda     _achar1
+	cmp     #$01
+	jsr     boolne
+	jeq     L0003
+	.dbg	line, "compare3.c", 79
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare3.c", 81
+L0003:	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$00
+	bne     L0005
+	cmp     #$01
+L0005:	jsr     booleq
+	jeq     L0004
+	.dbg	line, "compare3.c", 82
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare3.c", 84
+L0004:	lda     _aint1
+	ldx     _aint1+1
+	cpx     #$00
+	bne     L0007
+	cmp     #$01
+L0007:	jsr     boolne
+	jeq     L0006
+	.dbg	line, "compare3.c", 85
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare3.c", 86
+L0006:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_2: near
+
+	.dbg	func, "c_2", "00", extern, "_c_2"
+
+.segment	"CODE"
+
+	.dbg	line, "compare3.c", 95
+	ldx     #$00
+	lda     _achar0
+	cmp     #$02
+	jsr     boolne
+	jeq     L0002
+	.dbg	line, "compare3.c", 96
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare3.c", 98
+L0002:	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$00
+	bne     L0004
+	cmp     #$02
+L0004:	jsr     boolne
+	jeq     L0003
+	.dbg	line, "compare3.c", 99
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare3.c", 100
+L0003:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_ff (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_ff: near
+
+	.dbg	func, "c_ff", "00", extern, "_c_ff"
+
+.segment	"CODE"
+
+	.dbg	line, "compare3.c", 109
+	ldx     #$00
+	lda     _achar0
+	cmp     #$FF
+	jsr     boolne
+	jeq     L0002
+	.dbg	line, "compare3.c", 110
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare3.c", 112
+L0002:	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$00
+	bne     L0004
+	cmp     #$FF
+L0004:	jsr     boolne
+	jeq     L0003
+	.dbg	line, "compare3.c", 113
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare3.c", 115
+L0003:	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$00
+	bne     L0006
+	cmp     #$FE
+L0006:	jsr     booleq
+	jeq     L0005
+	.dbg	line, "compare3.c", 116
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare3.c", 118
+L0005:	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$FF
+	bne     L0008
+	cmp     #$00
+L0008:	jsr     booleq
+	jeq     L0007
+	.dbg	line, "compare3.c", 119
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare3.c", 120
+L0007:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_a5 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_a5: near
+
+	.dbg	func, "c_a5", "00", extern, "_c_a5"
+
+.segment	"CODE"
+
+	.dbg	line, "compare3.c", 129
+	ldx     #$00
+	lda     _achar0
+	cmp     #$A5
+	jsr     boolne
+	jeq     L0002
+	.dbg	line, "compare3.c", 130
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare3.c", 132
+L0002:	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$00
+	bne     L0004
+	cmp     #$A5
+L0004:	jsr     boolne
+	jeq     L0003
+	.dbg	line, "compare3.c", 133
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare3.c", 135
+L0003:	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$00
+	bne     L0006
+	cmp     #$A4
+L0006:	jsr     booleq
+	jeq     L0005
+	.dbg	line, "compare3.c", 136
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare3.c", 138
+L0005:	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$A5
+	bne     L0008
+	cmp     #$00
+L0008:	jsr     booleq
+	jeq     L0007
+	.dbg	line, "compare3.c", 139
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare3.c", 140
+L0007:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_a500 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_a500: near
+
+	.dbg	func, "c_a500", "00", extern, "_c_a500"
+
+.segment	"CODE"
+
+	.dbg	line, "compare3.c", 149
+	ldx     #$00
+	lda     _achar0
+	jmp     L0002
+	.dbg	line, "compare3.c", 150
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare3.c", 152
+L0002:	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$A5
+	bne     L0004
+	cmp     #$00
+L0004:	jsr     boolne
+	jeq     L0003
+	.dbg	line, "compare3.c", 153
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare3.c", 155
+L0003:	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$A4
+	bne     L0006
+	cmp     #$00
+L0006:	jsr     booleq
+	jeq     L0005
+	.dbg	line, "compare3.c", 156
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare3.c", 158
+L0005:	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$00
+	bne     L0008
+	cmp     #$A5
+L0008:	jsr     booleq
+	jeq     L0007
+	.dbg	line, "compare3.c", 159
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare3.c", 160
+L0007:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_abcd (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_abcd: near
+
+	.dbg	func, "c_abcd", "00", extern, "_c_abcd"
+
+.segment	"CODE"
+
+	.dbg	line, "compare3.c", 169
+	ldx     #$00
+	lda     _achar0
+	jmp     L0002
+	.dbg	line, "compare3.c", 170
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare3.c", 172
+L0002:	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$AB
+	bne     L0004
+	cmp     #$CD
+L0004:	jsr     boolne
+	jeq     L0003
+	.dbg	line, "compare3.c", 173
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare3.c", 175
+L0003:	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$AB
+	bne     L0006
+	cmp     #$00
+L0006:	jsr     booleq
+	jeq     L0005
+	.dbg	line, "compare3.c", 176
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare3.c", 178
+L0005:	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$00
+	bne     L0008
+	cmp     #$CD
+L0008:	jsr     booleq
+	jeq     L0007
+	.dbg	line, "compare3.c", 179
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare3.c", 181
+L0007:	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$05
+	bne     L000A
+	cmp     #$CD
+L000A:	jsr     booleq
+	jeq     L0009
+	.dbg	line, "compare3.c", 182
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare3.c", 184
+L0009:	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$AB
+	bne     L000C
+	cmp     #$05
+L000C:	jsr     booleq
+	jeq     L000B
+	.dbg	line, "compare3.c", 185
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare3.c", 187
+L000B:	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$AB
+	bne     L000E
+	cmp     #$01
+L000E:	jsr     booleq
+	jeq     L000D
+	.dbg	line, "compare3.c", 188
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare3.c", 190
+L000D:	lda     _aint0
+	ldx     _aint0+1
+	cpx     #$01
+	bne     L0010
+	cmp     #$CD
+L0010:	jsr     booleq
+	jeq     L000F
+	.dbg	line, "compare3.c", 191
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare3.c", 197
+L000F:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_ifelse1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_ifelse1: near
+
+	.dbg	func, "c_ifelse1", "00", extern, "_c_ifelse1"
+
+.segment	"CODE"
+
+	.dbg	line, "compare3.c", 202
+	lda     _achar0
+	jeq     L0002
+	.dbg	line, "compare3.c", 203
+	ldx     #$00
+	lda     _achar1
+	sta     _achar0
+	.dbg	line, "compare3.c", 204
+	jmp     L0003
+	.dbg	line, "compare3.c", 205
+L0002:	ldx     #$00
+	lda     #$00
+	sta     _achar0
+	.dbg	line, "compare3.c", 207
+L0003:	lda     _achar0
+	jeq     L0004
+	.dbg	line, "compare3.c", 208
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare3.c", 209
+L0004:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "compare3.c", 214
+	ldx     #$00
+	lda     #$01
+	sta     _aint1
+	stx     _aint1+1
+	.dbg	line, "compare3.c", 215
+	ldx     #$00
+	lda     #$01
+	sta     _achar1
+	.dbg	line, "compare3.c", 216
+	jsr     _c_0
+	.dbg	line, "compare3.c", 217
+	jsr     _c_1
+	.dbg	line, "compare3.c", 219
+	ldx     #$00
+	lda     #$02
+	sta     _aint0
+	stx     _aint0+1
+	.dbg	line, "compare3.c", 220
+	ldx     #$00
+	lda     #$02
+	sta     _achar0
+	.dbg	line, "compare3.c", 221
+	jsr     _c_2
+	.dbg	line, "compare3.c", 223
+	ldx     #$00
+	lda     #$FF
+	sta     _aint0
+	stx     _aint0+1
+	.dbg	line, "compare3.c", 224
+	ldx     #$00
+	lda     #$FF
+	sta     _achar0
+	.dbg	line, "compare3.c", 225
+	jsr     _c_ff
+	.dbg	line, "compare3.c", 227
+	ldx     #$00
+	lda     #$A5
+	sta     _aint0
+	stx     _aint0+1
+	.dbg	line, "compare3.c", 228
+	ldx     #$00
+	lda     #$A5
+	sta     _achar0
+	.dbg	line, "compare3.c", 229
+	jsr     _c_a5
+	.dbg	line, "compare3.c", 231
+	ldx     #$AB
+	lda     #$CD
+	sta     _aint0
+	stx     _aint0+1
+	.dbg	line, "compare3.c", 232
+	jsr     _c_abcd
+	.dbg	line, "compare3.c", 234
+	ldx     #$00
+	lda     #$00
+	sta     _achar0
+	.dbg	line, "compare3.c", 235
+	ldx     #$00
+	lda     #$00
+	sta     _achar1
+	.dbg	line, "compare3.c", 236
+	jsr     _c_ifelse1
+	.dbg	line, "compare3.c", 238
+	ldx     #$00
+	lda     #$01
+	sta     _achar0
+	.dbg	line, "compare3.c", 239
+	jsr     _c_ifelse1
+	.dbg	line, "compare3.c", 241
+	ldx     #$00
+	lda     _failures
+	sta     _success
+	.dbg	line, "compare3.c", 242
+	jsr     _done
+	.dbg	line, "compare3.c", 243
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "compare3.c", 245
+	ldx     #$00
+	lda     _failures
+	jmp     L0001
+	.dbg	line, "compare3.c", 246
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,666 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_success
+	.export		_failures
+	.export		_dummy
+	.export		_int0
+	.export		_int1
+	.export		_char0
+	.export		_char1
+	.export		_done
+	.export		_c_0
+	.export		_c_1
+	.export		_c_2
+	.export		_c_ff
+	.export		_c_a5
+	.export		_c_a500
+	.export		_c_abcd
+	.export		_c_ifelse1
+	.export		_c_minus1
+	.export		_c_c0gtc1
+	.export		_main
+
+.segment	"DATA"
+
+_success:
+	.byte	$00
+_failures:
+	.byte	$00
+_dummy:
+	.byte	$00
+_int0:
+	.word	$0000
+_int1:
+	.word	$0000
+_char0:
+	.byte	$00
+_char1:
+	.byte	$00
+
+.segment	"RODATA"
+
+S000F:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+S000E	:=	S000F+0
+S000D	:=	S000F+0
+S000C	:=	S000F+0
+S000B	:=	S000F+0
+S0007	:=	S000F+0
+S0008	:=	S000F+0
+S0009	:=	S000F+0
+S000A	:=	S000F+0
+S0010	:=	S000F+0
+S0005	:=	S000F+10
+S0004	:=	S000F+10
+S0003	:=	S000F+10
+S0002	:=	S000F+10
+S0006	:=	S000F+10
+S0001	:=	S000F+10
+
+; ---------------------------------------------------------------
+; void __near__ done (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_done: near
+
+.segment	"CODE"
+
+	inc     _dummy
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_0 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_0: near
+
+.segment	"CODE"
+
+	lda     _char0
+	beq     L0002
+	inc     _failures
+L0002:	lda     _char0
+	beq     L0004
+	inc     _failures
+L0004:	lda     _char1
+	bne     L0005
+	inc     _failures
+L0005:	lda     _char1
+	bne     L0007
+	inc     _failures
+L0007:	lda     _int0
+	ora     _int0+1
+	beq     L0009
+	inc     _failures
+L0009:	lda     _int0
+	ora     _int0+1
+	beq     L000B
+	inc     _failures
+L000B:	lda     _int1
+	ora     _int1+1
+	bne     L000C
+	inc     _failures
+L000C:	lda     _int1
+	ora     _int1+1
+	bne     L000E
+	inc     _failures
+L000E:	lda     _char0
+	sec
+	sbc     #$01
+	bvs     L0011
+	eor     #$80
+L0011:	bpl     L000F
+	inc     _failures
+L000F:	lda     _int0
+	cmp     #$01
+	lda     _int0+1
+	sbc     #$00
+	bvs     L0013
+	eor     #$80
+L0013:	bpl     L0017
+	inc     _failures
+L0017:	lda     _char0
+	asl     a
+	bcc     L0014
+	inc     _failures
+L0014:	ldx     _int0+1
+	cpx     #$80
+	bcc     L0016
+	inc     _failures
+L0016:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_1: near
+
+.segment	"CODE"
+
+	lda     _char0
+	cmp     #$01
+	bne     L0002
+	inc     _failures
+L0002:	lda     _char1
+	cmp     #$01
+	beq     L0004
+	inc     _failures
+L0004:	lda     _int0+1
+	bne     L0006
+	lda     _int0
+	cmp     #$01
+	bne     L0006
+	inc     _failures
+L0006:	lda     _int1+1
+	bne     L000D
+	lda     _int1
+	cmp     #$01
+	beq     L0008
+L000D:	inc     _failures
+L0008:	lda     _char0
+	asl     a
+	bcc     L000A
+	inc     _failures
+L000A:	ldx     _int0+1
+	cpx     #$80
+	bcc     L000C
+	inc     _failures
+L000C:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_2: near
+
+.segment	"CODE"
+
+	lda     _char0
+	cmp     #$02
+	beq     L0002
+	inc     _failures
+L0002:	lda     _int0+1
+	bne     L0006
+	lda     _int0
+	cmp     #$02
+	beq     L0004
+L0006:	inc     _failures
+L0004:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_ff (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_ff: near
+
+.segment	"CODE"
+
+	lda     _char0
+	cmp     #$FF
+	beq     L0002
+	inc     _failures
+L0002:	lda     _int0+1
+	bne     L0009
+	lda     _int0
+	cmp     #$FF
+	beq     L0003
+L0009:	inc     _failures
+L0003:	lda     _int0+1
+	bne     L0005
+	lda     _int0
+	cmp     #$FE
+	bne     L0005
+	inc     _failures
+L0005:	lda     _int0+1
+	cmp     #$FF
+	bne     L0007
+	lda     _int0
+	bne     L0007
+	inc     _failures
+L0007:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_a5 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_a5: near
+
+.segment	"CODE"
+
+	lda     _char0
+	cmp     #$A5
+	beq     L0002
+	inc     _failures
+L0002:	lda     _int0+1
+	bne     L0009
+	lda     _int0
+	cmp     #$A5
+	beq     L0003
+L0009:	inc     _failures
+L0003:	lda     _int0+1
+	bne     L0005
+	lda     _int0
+	cmp     #$A4
+	bne     L0005
+	inc     _failures
+L0005:	lda     _int0+1
+	cmp     #$A5
+	bne     L0007
+	lda     _int0
+	bne     L0007
+	inc     _failures
+L0007:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_a500 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_a500: near
+
+.segment	"CODE"
+
+	lda     _int0+1
+	cmp     #$A5
+	bne     L000A
+	lda     _int0
+	beq     L0002
+L000A:	inc     _failures
+L0002:	lda     _int0+1
+	bne     L000B
+	lda     _int0
+	cmp     #$44
+	beq     L0004
+L000B:	ldx     #$00
+	lda     #$28
+	sta     _int0
+	stx     _int0+1
+L0004:	lda     _int0+1
+	cmp     #$A4
+	bne     L0006
+	lda     _int0
+	bne     L0006
+	inc     _failures
+L0006:	lda     _int0+1
+	bne     L0008
+	lda     _int0
+	cmp     #$A5
+	bne     L0008
+	inc     _failures
+L0008:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_abcd (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_abcd: near
+
+.segment	"CODE"
+
+	lda     _int0+1
+	cmp     #$AB
+	bne     L0002
+	lda     _int0
+	bne     L0002
+	inc     _failures
+L0002:	lda     _int0+1
+	bne     L0004
+	lda     _int0
+	cmp     #$CD
+	bne     L0004
+	inc     _failures
+L0004:	lda     _int0+1
+	cmp     #$05
+	bne     L0006
+	lda     _int0
+	cmp     #$CD
+	bne     L0006
+	inc     _failures
+L0006:	lda     _int0+1
+	cmp     #$AB
+	bne     L0008
+	lda     _int0
+	cmp     #$05
+	bne     L0008
+	inc     _failures
+L0008:	lda     _int0+1
+	cmp     #$AB
+	bne     L000A
+	lda     _int0
+	cmp     #$01
+	bne     L000A
+	inc     _failures
+L000A:	lda     _int0+1
+	cmp     #$01
+	bne     L000C
+	lda     _int0
+	cmp     #$CD
+	bne     L000C
+	inc     _failures
+L000C:	lda     _int0
+	cmp     #$01
+	lda     _int0+1
+	sbc     #$00
+	bvs     L000F
+	eor     #$80
+L000F:	bpl     L000E
+	inc     _failures
+L000E:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_ifelse1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_ifelse1: near
+
+.segment	"CODE"
+
+	lda     _char0
+	beq     L0006
+	lda     _char1
+L0006:	sta     _char0
+	and     #$FF
+	beq     L0005
+	inc     _failures
+L0005:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_minus1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_minus1: near
+
+.segment	"CODE"
+
+	lda     _char0
+	cmp     #$FF
+	beq     L0002
+	inc     _failures
+L0002:	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	lda     _int0+1
+	cmp     #$FF
+	bne     L000E
+	lda     _int0
+	cmp     #$FF
+	beq     L0004
+L000E:	inc     _failures
+L0004:	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     _char0
+	bpl     L0007
+	dex
+L0007:	cpx     _int0+1
+	bne     L000F
+	cmp     _int0
+	beq     L0006
+L000F:	inc     _failures
+L0006:	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	lda     _char0
+	sec
+	sbc     #$01
+	bvs     L000A
+	eor     #$80
+L000A:	bpl     L0008
+	inc     _failures
+L0008:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	lda     _int0
+	cmp     #$01
+	lda     _int0+1
+	sbc     #$00
+	bvs     L000C
+	eor     #$80
+L000C:	bpl     L000B
+	inc     _failures
+L000B:	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jmp     _printf
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_c0gtc1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_c0gtc1: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	lda     _char0
+	bpl     L0003
+	dex
+L0003:	jsr     pushax
+	ldx     #$00
+	lda     _char1
+	bpl     L0004
+	dex
+L0004:	jsr     tosicmp
+	bpl     L0002
+	inc     _failures
+L0002:	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jmp     _printf
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	lda     #$01
+	sta     _int1
+	stx     _int1+1
+	sta     _char1
+	jsr     _c_0
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	jsr     _c_1
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     #$02
+	sta     _int0
+	stx     _int0+1
+	sta     _char0
+	jsr     _c_2
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     #$FF
+	sta     _int0
+	stx     _int0+1
+	sta     _char0
+	jsr     _c_ff
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     #$A5
+	sta     _int0
+	stx     _int0+1
+	sta     _char0
+	jsr     _c_a5
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$AB
+	lda     #$CD
+	sta     _int0
+	stx     _int0+1
+	lda     #$00
+	sta     _char0
+	sta     _char1
+	jsr     _c_ifelse1
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	lda     #$01
+	sta     _char0
+	jsr     _c_ifelse1
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	lda     #$FF
+	sta     _char0
+	sta     _int0
+	sta     _int0+1
+	jsr     _c_minus1
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	lda     #$05
+	sta     _char0
+	lda     #$03
+	sta     _char1
+	jsr     _c_c0gtc1
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	lda     #$FD
+	sta     _char1
+	jsr     _c_c0gtc1
+	lda     _failures
+	sta     _success
+	jsr     _done
+	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     _failures
+	rts
+
+.endproc
+
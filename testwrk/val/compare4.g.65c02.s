@@ -0,0 +1,1129 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "compare4.c", 4400, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/limits.h", 3146, 1613073744
+	.dbg		file, "/root/repo/include/stdint.h", 6196, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_success
+	.export		_failures
+	.export		_dummy
+	.export		_int0
+	.export		_int1
+	.export		_char0
+	.export		_char1
+	.export		_done
+	.export		_c_0
+	.export		_c_1
+	.export		_c_2
+	.export		_c_ff
+	.export		_c_a5
+	.export		_c_a500
+	.export		_c_abcd
+	.export		_c_ifelse1
+	.export		_c_minus1
+	.export		_c_c0gtc1
+	.export		_main
+
+.segment	"DATA"
+
+_success:
+	.byte	$00
+_failures:
+	.byte	$00
+_dummy:
+	.byte	$00
+_int0:
+	.word	$0000
+_int1:
+	.word	$0000
+_char0:
+	.byte	$00
+_char1:
+	.byte	$00
+
+.segment	"RODATA"
+
+S000F:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+S000E	:=	S000F+0
+S000D	:=	S000F+0
+S000C	:=	S000F+0
+S000B	:=	S000F+0
+S0007	:=	S000F+0
+S0008	:=	S000F+0
+S0009	:=	S000F+0
+S000A	:=	S000F+0
+S0010	:=	S000F+0
+S0005	:=	S000F+10
+S0004	:=	S000F+10
+S0003	:=	S000F+10
+S0002	:=	S000F+10
+S0006	:=	S000F+10
+S0001	:=	S000F+10
+
+; ---------------------------------------------------------------
+; void __near__ done (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_done: near
+
+	.dbg	func, "done", "00", extern, "_done"
+
+.segment	"CODE"
+
+	.dbg	line, "compare4.c", 36
+	ldx     #$00
+	lda     _dummy
+	inc     _dummy
+	.dbg	line, "compare4.c", 37
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_0 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_0: near
+
+	.dbg	func, "c_0", "00", extern, "_c_0"
+
+.segment	"CODE"
+
+	.dbg	line, "compare4.c", 48
+	ldx     #$00
+	lda     _char0
+	bpl     L0003
+	dex
+L0003:	cmp     #$00
+	jsr     boolne
+	jeq     L0002
+	.dbg	line, "compare4.c", 49
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare4.c", 51
+L0002:	lda     _char0
+	jeq     L0004
+	.dbg	line, "compare4.c", 52
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare4.c", 54
+L0004:	ldx     #$00
+	lda     _char1
+	bpl     L0006
+	dex
+L0006:	cmp     #$00
+	jsr     booleq
+	jeq     L0005
+	.dbg	line, "compare4.c", 55
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare4.c", 57
+L0005:	ldx     #$00
+	lda     _char1
+	bpl     L0008
+	dex
+L0008:	jsr     bnega
+	jeq     L0007
+	.dbg	line, "compare4.c", 58
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare4.c", 60
+L0007:	lda     _int0
+	ldx     _int0+1
+	cpx     #$00
+	bne     L000A
+	cmp     #$00
+L000A:	jsr     boolne
+	jeq     L0009
+	.dbg	line, "compare4.c", 61
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare4.c", 63
+L0009:	lda     _int0
+	ora     _int0+1
+	jeq     L000B
+	.dbg	line, "compare4.c", 64
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare4.c", 66
+L000B:	lda     _int1
+	ldx     _int1+1
+	cpx     #$00
+	bne     L000D
+	cmp     #$00
+L000D:	jsr     booleq
+	jeq     L000C
+	.dbg	line, "compare4.c", 67
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare4.c", 69
+L000C:	lda     _int1
+	ldx     _int1+1
+	jsr     bnegax
+	jeq     L000E
+	.dbg	line, "compare4.c", 70
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare4.c", 72
+L000E:	ldx     #$00
+	lda     _char0
+	bpl     L0010
+	dex
+L0010:	sec
+	sbc     #$01
+	bvs     L0011
+	eor     #$80
+L0011:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L000F
+	.dbg	line, "compare4.c", 73
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare4.c", 75
+L000F:	lda     _int0
+	ldx     _int0+1
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvs     L0013
+	eor     #$80
+L0013:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0012
+	.dbg	line, "compare4.c", 76
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare4.c", 78
+L0012:	ldx     #$00
+	lda     _char0
+	bpl     L0015
+	dex
+L0015:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0014
+	.dbg	line, "compare4.c", 79
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare4.c", 81
+L0014:	lda     _int0
+	ldx     _int0+1
+	cpx     #$80
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0016
+	.dbg	line, "compare4.c", 82
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare4.c", 83
+L0016:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_1: near
+
+	.dbg	func, "c_1", "00", extern, "_c_1"
+
+.segment	"CODE"
+
+	.dbg	line, "compare4.c", 94
+	ldx     #$00
+	lda     _char0
+	bpl     L0003
+	dex
+L0003:	cmp     #$01
+	jsr     booleq
+	jeq     L0002
+	.dbg	line, "compare4.c", 95
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare4.c", 97
+L0002:	ldx     #$00
+	lda     _char1
+	bpl     L0005
+	dex
+L0005:	cmp     #$01
+	jsr     boolne
+	jeq     L0004
+	.dbg	line, "compare4.c", 98
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare4.c", 100
+L0004:	lda     _int0
+	ldx     _int0+1
+	cpx     #$00
+	bne     L0007
+	cmp     #$01
+L0007:	jsr     booleq
+	jeq     L0006
+	.dbg	line, "compare4.c", 101
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare4.c", 103
+L0006:	lda     _int1
+	ldx     _int1+1
+	cpx     #$00
+	bne     L0009
+	cmp     #$01
+L0009:	jsr     boolne
+	jeq     L0008
+	.dbg	line, "compare4.c", 104
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare4.c", 106
+L0008:	ldx     #$00
+	lda     _char0
+	bpl     L000B
+	dex
+L000B:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L000A
+	.dbg	line, "compare4.c", 107
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare4.c", 109
+L000A:	lda     _int0
+	ldx     _int0+1
+	cpx     #$80
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L000C
+	.dbg	line, "compare4.c", 110
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare4.c", 111
+L000C:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_2: near
+
+	.dbg	func, "c_2", "00", extern, "_c_2"
+
+.segment	"CODE"
+
+	.dbg	line, "compare4.c", 120
+	ldx     #$00
+	lda     _char0
+	bpl     L0003
+	dex
+L0003:	cmp     #$02
+	jsr     boolne
+	jeq     L0002
+	.dbg	line, "compare4.c", 121
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare4.c", 123
+L0002:	lda     _int0
+	ldx     _int0+1
+	cpx     #$00
+	bne     L0005
+	cmp     #$02
+L0005:	jsr     boolne
+	jeq     L0004
+	.dbg	line, "compare4.c", 124
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare4.c", 125
+L0004:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_ff (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_ff: near
+
+	.dbg	func, "c_ff", "00", extern, "_c_ff"
+
+.segment	"CODE"
+
+	.dbg	line, "compare4.c", 134
+	ldx     #$00
+	lda     _char0
+	cmp     #$FF
+	jsr     boolne
+	jeq     L0002
+	.dbg	line, "compare4.c", 135
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare4.c", 137
+L0002:	lda     _int0
+	ldx     _int0+1
+	cpx     #$00
+	bne     L0004
+	cmp     #$FF
+L0004:	jsr     boolne
+	jeq     L0003
+	.dbg	line, "compare4.c", 138
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare4.c", 140
+L0003:	lda     _int0
+	ldx     _int0+1
+	cpx     #$00
+	bne     L0006
+	cmp     #$FE
+L0006:	jsr     booleq
+	jeq     L0005
+	.dbg	line, "compare4.c", 141
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare4.c", 143
+L0005:	lda     _int0
+	ldx     _int0+1
+	cpx     #$FF
+	bne     L0008
+	cmp     #$00
+L0008:	jsr     booleq
+	jeq     L0007
+	.dbg	line, "compare4.c", 144
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare4.c", 145
+L0007:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_a5 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_a5: near
+
+	.dbg	func, "c_a5", "00", extern, "_c_a5"
+
+.segment	"CODE"
+
+	.dbg	line, "compare4.c", 154
+	ldx     #$00
+	lda     _char0
+	cmp     #$A5
+	jsr     boolne
+	jeq     L0002
+	.dbg	line, "compare4.c", 155
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare4.c", 157
+L0002:	lda     _int0
+	ldx     _int0+1
+	cpx     #$00
+	bne     L0004
+	cmp     #$A5
+L0004:	jsr     boolne
+	jeq     L0003
+	.dbg	line, "compare4.c", 158
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare4.c", 160
+L0003:	lda     _int0
+	ldx     _int0+1
+	cpx     #$00
+	bne     L0006
+	cmp     #$A4
+L0006:	jsr     booleq
+	jeq     L0005
+	.dbg	line, "compare4.c", 161
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare4.c", 163
+L0005:	lda     _int0
+	ldx     _int0+1
+	cpx     #$A5
+	bne     L0008
+	cmp     #$00
+L0008:	jsr     booleq
+	jeq     L0007
+	.dbg	line, "compare4.c", 164
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare4.c", 165
+L0007:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_a500 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_a500: near
+
+	.dbg	func, "c_a500", "00", extern, "_c_a500"
+
+.segment	"CODE"
+
+	.dbg	line, "compare4.c", 179
+	lda     _int0
+	ldx     _int0+1
+	cpx     #$A5
+	bne     L0003
+	cmp     #$00
+L0003:	jsr     boolne
+	jeq     L0002
+	.dbg	line, "compare4.c", 180
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare4.c", 182
+L0002:	lda     _int0
+	ldx     _int0+1
+	cpx     #$00
+	bne     L0005
+	cmp     #$44
+L0005:	jsr     boolne
+	jeq     L0004
+	.dbg	line, "compare4.c", 183
+	ldx     #$00
+	lda     #$28
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare4.c", 185
+L0004:	lda     _int0
+	ldx     _int0+1
+	cpx     #$A4
+	bne     L0007
+	cmp     #$00
+L0007:	jsr     booleq
+	jeq     L0006
+	.dbg	line, "compare4.c", 186
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare4.c", 188
+L0006:	lda     _int0
+	ldx     _int0+1
+	cpx     #$00
+	bne     L0009
+	cmp     #$A5
+L0009:	jsr     booleq
+	jeq     L0008
+	.dbg	line, "compare4.c", 189
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare4.c", 190
+L0008:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_abcd (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_abcd: near
+
+	.dbg	func, "c_abcd", "00", extern, "_c_abcd"
+
+.segment	"CODE"
+
+	.dbg	line, "compare4.c", 207
+	lda     _int0
+	ldx     _int0+1
+	cpx     #$AB
+	bne     L0003
+	cmp     #$00
+L0003:	jsr     booleq
+	jeq     L0002
+	.dbg	line, "compare4.c", 208
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare4.c", 210
+L0002:	lda     _int0
+	ldx     _int0+1
+	cpx     #$00
+	bne     L0005
+	cmp     #$CD
+L0005:	jsr     booleq
+	jeq     L0004
+	.dbg	line, "compare4.c", 211
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare4.c", 213
+L0004:	lda     _int0
+	ldx     _int0+1
+	cpx     #$05
+	bne     L0007
+	cmp     #$CD
+L0007:	jsr     booleq
+	jeq     L0006
+	.dbg	line, "compare4.c", 214
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare4.c", 216
+L0006:	lda     _int0
+	ldx     _int0+1
+	cpx     #$AB
+	bne     L0009
+	cmp     #$05
+L0009:	jsr     booleq
+	jeq     L0008
+	.dbg	line, "compare4.c", 217
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare4.c", 219
+L0008:	lda     _int0
+	ldx     _int0+1
+	cpx     #$AB
+	bne     L000B
+	cmp     #$01
+L000B:	jsr     booleq
+	jeq     L000A
+	.dbg	line, "compare4.c", 220
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare4.c", 222
+L000A:	lda     _int0
+	ldx     _int0+1
+	cpx     #$01
+	bne     L000D
+	cmp     #$CD
+L000D:	jsr     booleq
+	jeq     L000C
+	.dbg	line, "compare4.c", 223
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare4.c", 225
+L000C:	lda     _int0
+	ldx     _int0+1
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvs     L000F
+	eor     #$80
+L000F:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L000E
+	.dbg	line, "compare4.c", 226
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare4.c", 232
+L000E:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_ifelse1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_ifelse1: near
+
+	.dbg	func, "c_ifelse1", "00", extern, "_c_ifelse1"
+
+.segment	"CODE"
+
+	.dbg	line, "compare4.c", 237
+	lda     _char0
+	jeq     L0002
+	.dbg	line, "compare4.c", 238
+	ldx     #$00
+	lda     _char1
+	bpl     L0003
+	dex
+L0003:	sta     _char0
+	.dbg	line, "compare4.c", 239
+	jmp     L0004
+	.dbg	line, "compare4.c", 240
+L0002:	ldx     #$00
+	lda     #$00
+	sta     _char0
+	.dbg	line, "compare4.c", 242
+L0004:	lda     _char0
+	jeq     L0005
+	.dbg	line, "compare4.c", 243
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare4.c", 244
+L0005:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_minus1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_minus1: near
+
+	.dbg	func, "c_minus1", "00", extern, "_c_minus1"
+
+.segment	"CODE"
+
+	.dbg	line, "compare4.c", 251
+	ldx     #$00
+	lda     _char0
+	bpl     L0003
+	dex
+L0003:	cmp     #$FF
+	jsr     boolne
+	jeq     L0002
+	.dbg	line, "compare4.c", 252
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare4.c", 254
+L0002:	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "compare4.c", 256
+	lda     _int0
+	ldx     _int0+1
+	cpx     #$FF
+	bne     L0005
+	cmp     #$FF
+L0005:	jsr     boolne
+	jeq     L0004
+	.dbg	line, "compare4.c", 257
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare4.c", 259
+L0004:	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "compare4.c", 261
+	ldx     #$00
+	lda     _char0
+	bpl     L0007
+	dex
+L0007:	jsr     pushax
+	lda     _int0
+	ldx     _int0+1
+	jsr     tosneax
+	jeq     L0006
+	.dbg	line, "compare4.c", 262
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare4.c", 264
+L0006:	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "compare4.c", 266
+	ldx     #$00
+	lda     _char0
+	bpl     L0009
+	dex
+L0009:	sec
+	sbc     #$01
+	bvs     L000A
+	eor     #$80
+L000A:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0008
+	.dbg	line, "compare4.c", 267
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare4.c", 269
+L0008:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "compare4.c", 271
+	lda     _int0
+	ldx     _int0+1
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvs     L000C
+	eor     #$80
+L000C:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L000B
+	.dbg	line, "compare4.c", 272
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare4.c", 274
+L000B:	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "compare4.c", 275
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_c0gtc1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_c0gtc1: near
+
+	.dbg	func, "c_c0gtc1", "00", extern, "_c_c0gtc1"
+
+.segment	"CODE"
+
+	.dbg	line, "compare4.c", 279
+	ldx     #$00
+	lda     _char0
+	bpl     L0003
+	dex
+L0003:	jsr     pushax
+	ldx     #$00
+	lda     _char1
+	bpl     L0004
+	dex
+L0004:	jsr     tosltax
+	jeq     L0002
+	.dbg	line, "compare4.c", 280
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare4.c", 282
+L0002:	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "compare4.c", 283
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "compare4.c", 287
+	ldx     #$00
+	lda     #$01
+	sta     _int1
+	stx     _int1+1
+	.dbg	line, "compare4.c", 288
+	ldx     #$00
+	lda     #$01
+	sta     _char1
+	.dbg	line, "compare4.c", 289
+	jsr     _c_0
+	.dbg	line, "compare4.c", 290
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "compare4.c", 291
+	jsr     _c_1
+	.dbg	line, "compare4.c", 292
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "compare4.c", 294
+	ldx     #$00
+	lda     #$02
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare4.c", 295
+	ldx     #$00
+	lda     #$02
+	sta     _char0
+	.dbg	line, "compare4.c", 296
+	jsr     _c_2
+	.dbg	line, "compare4.c", 297
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "compare4.c", 299
+	ldx     #$00
+	lda     #$FF
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare4.c", 300
+	ldx     #$FF
+	lda     #$FF
+	sta     _char0
+	.dbg	line, "compare4.c", 301
+	jsr     _c_ff
+	.dbg	line, "compare4.c", 302
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "compare4.c", 304
+	ldx     #$00
+	lda     #$A5
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare4.c", 305
+	ldx     #$FF
+	lda     #$A5
+	sta     _char0
+	.dbg	line, "compare4.c", 306
+	jsr     _c_a5
+	.dbg	line, "compare4.c", 307
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "compare4.c", 309
+	ldx     #$AB
+	lda     #$CD
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare4.c", 312
+	ldx     #$00
+	lda     #$00
+	sta     _char0
+	.dbg	line, "compare4.c", 313
+	ldx     #$00
+	lda     #$00
+	sta     _char1
+	.dbg	line, "compare4.c", 314
+	jsr     _c_ifelse1
+	.dbg	line, "compare4.c", 315
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "compare4.c", 317
+	ldx     #$00
+	lda     #$01
+	sta     _char0
+	.dbg	line, "compare4.c", 318
+	jsr     _c_ifelse1
+	.dbg	line, "compare4.c", 319
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "compare4.c", 321
+	ldx     #$FF
+	lda     #$FF
+	sta     _char0
+	.dbg	line, "compare4.c", 322
+	ldx     #$FF
+	lda     #$FF
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare4.c", 323
+	jsr     _c_minus1
+	.dbg	line, "compare4.c", 324
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "compare4.c", 326
+	ldx     #$00
+	lda     #$05
+	sta     _char0
+	.dbg	line, "compare4.c", 327
+	ldx     #$00
+	lda     #$03
+	sta     _char1
+	.dbg	line, "compare4.c", 328
+	jsr     _c_c0gtc1
+	.dbg	line, "compare4.c", 329
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "compare4.c", 331
+	ldx     #$FF
+	lda     #$FD
+	sta     _char1
+	.dbg	line, "compare4.c", 332
+	jsr     _c_c0gtc1
+	.dbg	line, "compare4.c", 334
+	ldx     #$00
+	lda     _failures
+	sta     _success
+	.dbg	line, "compare4.c", 335
+	jsr     _done
+	.dbg	line, "compare4.c", 336
+	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "compare4.c", 338
+	ldx     #$00
+	lda     _failures
+	jmp     L0001
+	.dbg	line, "compare4.c", 339
+L0001:	rts
+
+	.dbg	line
+.endproc
+
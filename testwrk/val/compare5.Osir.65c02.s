@@ -0,0 +1,1473 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_success
+	.export		_failures
+	.export		_dummy
+	.export		_int0
+	.export		_int1
+	.export		_char0
+	.export		_char1
+	.export		_long0
+	.export		_long1
+	.export		_ulong0
+	.export		_ulong1
+	.export		_done
+	.export		_c_0
+	.export		_c_1
+	.export		_c_2
+	.export		_c_ff
+	.export		_c_200
+	.export		_c_20000
+	.export		_c_a5
+	.export		_c_a500
+	.export		_c_abcd
+	.export		_c_ifelse1
+	.export		_c_minus1
+	.export		_c_long2long_eq
+	.export		_c_long2long_neq
+	.export		_c_long2neglit
+	.export		_main
+
+.segment	"DATA"
+
+_success:
+	.byte	$00
+_failures:
+	.byte	$00
+_dummy:
+	.byte	$00
+_int0:
+	.word	$0000
+_int1:
+	.word	$0000
+_char0:
+	.byte	$00
+_char1:
+	.byte	$00
+_long0:
+	.dword	$00000000
+_long1:
+	.dword	$00000000
+_ulong0:
+	.dword	$00000000
+_ulong1:
+	.dword	$00000000
+
+.segment	"RODATA"
+
+S0008:
+	.byte	$63,$5F,$6C,$6F,$6E,$67,$32,$6C,$6F,$6E,$67,$5F,$6E,$65,$71,$3A
+	.byte	$20,$25,$64,$0A,$00
+S0001:
+	.byte	$6C,$6F,$6E,$67,$30,$3A,$25,$6C,$64,$20,$6C,$6F,$6E,$67,$31,$3A
+	.byte	$25,$6C,$64,$0A,$00
+S0006:
+	.byte	$63,$5F,$6C,$6F,$6E,$67,$32,$6C,$6F,$6E,$67,$5F,$65,$71,$3A,$20
+	.byte	$25,$64,$0A,$00
+S000E:
+	.byte	$63,$5F,$6C,$6F,$6E,$67,$32,$6E,$65,$67,$6C,$69,$74,$3A,$20,$25
+	.byte	$64,$0A,$00
+S0002:
+	.byte	$28,$6C,$6F,$6E,$67,$30,$20,$21,$3D,$20,$2D,$31,$29,$0A,$00
+S000F:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+S000D:
+	.byte	$63,$5F,$6D,$69,$6E,$75,$73,$31,$3A,$20,$25,$64,$0A,$00
+S0004:
+	.byte	$28,$6C,$6F,$6E,$67,$31,$20,$3C,$20,$30,$29,$0A,$00
+S000C:
+	.byte	$63,$5F,$32,$30,$30,$30,$30,$3A,$20,$25,$64,$0A,$00
+S0003:
+	.byte	$28,$6C,$6F,$6E,$67,$30,$20,$3E,$20,$30,$29,$0A,$00
+S000B:
+	.byte	$63,$5F,$32,$30,$30,$3A,$20,$25,$64,$0A,$00
+S000A:
+	.byte	$63,$5F,$66,$66,$3A,$20,$25,$64,$0A,$00
+S0007:
+	.byte	$63,$5F,$31,$3A,$20,$25,$64,$0A,$00
+S0005:
+	.byte	$63,$5F,$30,$3A,$20,$25,$64,$0A,$00
+S0009:
+	.byte	$63,$5F,$32,$3A,$20,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ done (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_done: near
+
+.segment	"CODE"
+
+	inc     _dummy
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_0 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_0: near
+
+.segment	"CODE"
+
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	jsr     tosneeax
+	beq     L0002
+	inc     _failures
+L0002:	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$01
+	jsr     tosgeeax
+	beq     L0003
+	inc     _failures
+L0003:	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	jsr     tosneeax
+	beq     L0004
+	inc     _failures
+L0004:	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	jsr     tosneeax
+	beq     L0005
+	inc     _failures
+L0005:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_1: near
+
+.segment	"CODE"
+
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$01
+	jsr     toseqeax
+	beq     L0002
+	inc     _failures
+L0002:	lda     _long1+3
+	sta     sreg+1
+	lda     _long1+2
+	sta     sreg
+	ldx     _long1+1
+	lda     _long1
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$01
+	jsr     tosneeax
+	beq     L0003
+	inc     _failures
+L0003:	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$01
+	jsr     toseqeax
+	beq     L0004
+	inc     _failures
+L0004:	lda     _ulong1+3
+	sta     sreg+1
+	lda     _ulong1+2
+	sta     sreg
+	ldx     _ulong1+1
+	lda     _ulong1
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$01
+	jsr     tosneeax
+	beq     L0005
+	inc     _failures
+L0005:	lda     _long1+3
+	asl     a
+	bcc     L0006
+	inc     _failures
+L0006:	lda     _long1+3
+	sta     sreg+1
+	lda     _long1+2
+	sta     sreg
+	ldx     _long1+1
+	lda     _long1
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$01
+	jsr     toslteax
+	beq     L0007
+	inc     _failures
+L0007:	lda     _ulong1+3
+	sta     sreg+1
+	lda     _ulong1+2
+	sta     sreg
+	ldx     _ulong1+1
+	lda     _ulong1
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	jsr     toseqeax
+	beq     L0008
+	inc     _failures
+L0008:	lda     _long1+3
+	sta     sreg+1
+	lda     _long1+2
+	sta     sreg
+	ldx     _long1+1
+	lda     _long1
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	jsr     tosgeeax
+	beq     L0009
+	inc     _failures
+L0009:	lda     _ulong1+3
+	sta     sreg+1
+	lda     _ulong1+2
+	sta     sreg
+	lda     _ulong1
+	cmp     #$02
+	lda     _ulong1+1
+	sbc     #$00
+	lda     sreg
+	sbc     #$00
+	lda     sreg+1
+	sbc     #$00
+	bcc     L000A
+	inc     _failures
+L000A:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_2: near
+
+.segment	"CODE"
+
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	beq     L0002
+	inc     _failures
+L0002:	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	beq     L0003
+	inc     _failures
+L0003:	lda     _long1+3
+	sta     sreg+1
+	lda     _long1+2
+	sta     sreg
+	ldx     _long1+1
+	lda     _long1
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	jsr     toseqeax
+	beq     L0004
+	inc     _failures
+L0004:	lda     _ulong1+3
+	sta     sreg+1
+	lda     _ulong1+2
+	sta     sreg
+	ldx     _ulong1+1
+	lda     _ulong1
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	jsr     toseqeax
+	beq     L0005
+	inc     _failures
+L0005:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_ff (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_ff: near
+
+.segment	"CODE"
+
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$FF
+	jsr     tosneeax
+	beq     L0002
+	inc     _failures
+L0002:	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$FF
+	jsr     tosneeax
+	beq     L0003
+	inc     _failures
+L0003:	lda     _long1+3
+	sta     sreg+1
+	lda     _long1+2
+	sta     sreg
+	ldx     _long1+1
+	lda     _long1
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$FF
+	jsr     toseqeax
+	beq     L0004
+	inc     _failures
+L0004:	lda     _ulong1+3
+	sta     sreg+1
+	lda     _ulong1+2
+	sta     sreg
+	ldx     _ulong1+1
+	lda     _ulong1
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$FF
+	jsr     toseqeax
+	beq     L0005
+	inc     _failures
+L0005:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_200 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_200: near
+
+.segment	"CODE"
+
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldx     #$02
+	lda     #$00
+	stz     sreg
+	stz     sreg+1
+	jsr     tosneeax
+	beq     L0002
+	inc     _failures
+L0002:	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	ldx     #$02
+	lda     #$00
+	stz     sreg
+	stz     sreg+1
+	jsr     tosneeax
+	beq     L0003
+	inc     _failures
+L0003:	lda     _long1+3
+	sta     sreg+1
+	lda     _long1+2
+	sta     sreg
+	ldx     _long1+1
+	lda     _long1
+	jsr     pusheax
+	ldx     #$02
+	lda     #$00
+	stz     sreg
+	stz     sreg+1
+	jsr     toseqeax
+	beq     L0004
+	inc     _failures
+L0004:	lda     _ulong1+3
+	sta     sreg+1
+	lda     _ulong1+2
+	sta     sreg
+	ldx     _ulong1+1
+	lda     _ulong1
+	jsr     pusheax
+	ldx     #$02
+	lda     #$00
+	stz     sreg
+	stz     sreg+1
+	jsr     toseqeax
+	beq     L0005
+	inc     _failures
+L0005:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_20000 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_20000: near
+
+.segment	"CODE"
+
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg+1
+	lda     #$02
+	sta     sreg
+	txa
+	jsr     tosneeax
+	beq     L0002
+	inc     _failures
+L0002:	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg+1
+	lda     #$02
+	sta     sreg
+	txa
+	jsr     tosneeax
+	beq     L0003
+	inc     _failures
+L0003:	lda     _long1+3
+	sta     sreg+1
+	lda     _long1+2
+	sta     sreg
+	ldx     _long1+1
+	lda     _long1
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg+1
+	lda     #$02
+	sta     sreg
+	txa
+	jsr     toseqeax
+	beq     L0004
+	inc     _failures
+L0004:	lda     _ulong1+3
+	sta     sreg+1
+	lda     _ulong1+2
+	sta     sreg
+	ldx     _ulong1+1
+	lda     _ulong1
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg+1
+	lda     #$02
+	sta     sreg
+	txa
+	jsr     toseqeax
+	beq     L0005
+	inc     _failures
+L0005:	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg+1
+	lda     #$01
+	sta     sreg
+	jsr     toslteax
+	beq     L0006
+	inc     _failures
+L0006:	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg+1
+	lda     #$01
+	sta     sreg
+	lsr     a
+	jsr     toslteax
+	beq     L0007
+	inc     _failures
+L0007:	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	jsr     toseqeax
+	beq     L0008
+	inc     _failures
+L0008:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_a5 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_a5: near
+
+.segment	"CODE"
+
+	lda     _char0
+	cmp     #$A5
+	beq     L0002
+	inc     _failures
+L0002:	lda     _int0+1
+	bne     L0009
+	lda     _int0
+	cmp     #$A5
+	beq     L0003
+L0009:	inc     _failures
+L0003:	lda     _int0+1
+	bne     L0005
+	lda     _int0
+	cmp     #$A4
+	bne     L0005
+	inc     _failures
+L0005:	lda     _int0+1
+	cmp     #$A5
+	bne     L0007
+	lda     _int0
+	bne     L0007
+	inc     _failures
+L0007:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_a500 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_a500: near
+
+.segment	"CODE"
+
+	lda     _int0+1
+	cmp     #$A5
+	bne     L0009
+	lda     _int0
+	beq     L0003
+L0009:	inc     _failures
+L0003:	lda     _int0+1
+	cmp     #$A4
+	bne     L0005
+	lda     _int0
+	bne     L0005
+	inc     _failures
+L0005:	lda     _int0+1
+	bne     L0007
+	lda     _int0
+	cmp     #$A5
+	bne     L0007
+	inc     _failures
+L0007:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_abcd (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_abcd: near
+
+.segment	"CODE"
+
+	lda     _int0+1
+	cmp     #$AB
+	bne     L0014
+	lda     _int0
+	cmp     #$CD
+	beq     L0003
+L0014:	inc     _failures
+L0003:	lda     _int0+1
+	cmp     #$AB
+	bne     L0005
+	lda     _int0
+	bne     L0005
+	inc     _failures
+L0005:	lda     _int0+1
+	bne     L0007
+	lda     _int0
+	cmp     #$CD
+	bne     L0007
+	inc     _failures
+L0007:	lda     _int0+1
+	cmp     #$05
+	bne     L0009
+	lda     _int0
+	cmp     #$CD
+	bne     L0009
+	inc     _failures
+L0009:	lda     _int0+1
+	cmp     #$AB
+	bne     L000B
+	lda     _int0
+	cmp     #$05
+	bne     L000B
+	inc     _failures
+L000B:	lda     _int0+1
+	cmp     #$AB
+	bne     L000D
+	lda     _int0
+	cmp     #$01
+	bne     L000D
+	inc     _failures
+L000D:	lda     _int0+1
+	cmp     #$01
+	bne     L000F
+	lda     _int0
+	cmp     #$CD
+	bne     L000F
+	inc     _failures
+L000F:	lda     _int0
+	cmp     #$01
+	lda     _int0+1
+	sbc     #$00
+	bvs     L0012
+	eor     #$80
+L0012:	bpl     L0011
+	inc     _failures
+L0011:	lda     _int0
+	ldx     _int0+1
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$AB
+	lda     #$34
+	sta     sreg
+	lda     #$12
+	sta     sreg+1
+	lda     #$CD
+	jsr     toseqeax
+	beq     L0013
+	inc     _failures
+L0013:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_ifelse1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_ifelse1: near
+
+.segment	"CODE"
+
+	lda     _char0
+	beq     L0005
+	lda     _char1
+L0005:	sta     _char0
+	and     #$FF
+	beq     L0004
+	inc     _failures
+L0004:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_minus1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_minus1: near
+
+.segment	"CODE"
+
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	lda     _long1+3
+	sta     sreg+1
+	lda     _long1+2
+	sta     sreg
+	ldx     _long1+1
+	lda     _long1
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	txa
+	jsr     tosneeax
+	beq     L0002
+	inc     _failures
+L0002:	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$01
+	jsr     tosgeeax
+	beq     L0003
+	inc     _failures
+L0003:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     _long1+3
+	asl     a
+	bcc     L0004
+	inc     _failures
+L0004:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_long2long_eq (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_long2long_eq: near
+
+.segment	"CODE"
+
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	lda     _long1+3
+	sta     sreg+1
+	lda     _long1+2
+	sta     sreg
+	ldx     _long1+1
+	lda     _long1
+	jsr     tosneeax
+	beq     L0002
+	inc     _failures
+L0002:	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	lda     _ulong1+3
+	sta     sreg+1
+	lda     _ulong1+2
+	sta     sreg
+	ldx     _ulong1+1
+	lda     _ulong1
+	jsr     tosneeax
+	beq     L0003
+	inc     _failures
+L0003:	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	lda     _ulong1+3
+	sta     sreg+1
+	lda     _ulong1+2
+	sta     sreg
+	ldx     _ulong1+1
+	lda     _ulong1
+	jsr     tosneeax
+	beq     L0004
+	inc     _failures
+L0004:	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	lda     _long1+3
+	sta     sreg+1
+	lda     _long1+2
+	sta     sreg
+	ldx     _long1+1
+	lda     _long1
+	jsr     tosgteax
+	beq     L0005
+	inc     _failures
+L0005:	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	lda     _long1+3
+	sta     sreg+1
+	lda     _long1+2
+	sta     sreg
+	ldx     _long1+1
+	lda     _long1
+	jsr     toslteax
+	beq     L0006
+	inc     _failures
+L0006:	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     tosugteax
+	beq     L0007
+	inc     _failures
+L0007:	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     tosulteax
+	beq     L0008
+	inc     _failures
+L0008:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_long2long_neq (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_long2long_neq: near
+
+.segment	"CODE"
+
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	lda     _long1+3
+	sta     sreg+1
+	lda     _long1+2
+	sta     sreg
+	ldx     _long1+1
+	lda     _long1
+	jsr     toseqeax
+	beq     L0002
+	inc     _failures
+L0002:	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	lda     _ulong1+3
+	sta     sreg+1
+	lda     _ulong1+2
+	sta     sreg
+	ldx     _ulong1+1
+	lda     _ulong1
+	jsr     toseqeax
+	beq     L0003
+	inc     _failures
+L0003:	lda     _long1+3
+	sta     sreg+1
+	lda     _long1+2
+	sta     sreg
+	ldx     _long1+1
+	lda     _long1
+	jsr     pusheax
+	lda     _ulong1+3
+	sta     sreg+1
+	lda     _ulong1+2
+	sta     sreg
+	ldx     _ulong1+1
+	lda     _ulong1
+	jsr     tosneeax
+	beq     L0004
+	inc     _failures
+L0004:	lda     _long1+3
+	sta     sreg+1
+	lda     _long1+2
+	sta     sreg
+	ldx     _long1+1
+	lda     _long1
+	jsr     pusheax
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     toslteax
+	beq     L0005
+	inc     _failures
+L0005:	lda     _long1+3
+	sta     sreg+1
+	lda     _long1+2
+	sta     sreg
+	ldx     _long1+1
+	lda     _long1
+	jsr     pusheax
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     tosleeax
+	beq     L0006
+	inc     _failures
+L0006:	lda     _ulong1+3
+	sta     sreg+1
+	lda     _ulong1+2
+	sta     sreg
+	ldx     _ulong1+1
+	lda     _ulong1
+	jsr     pusheax
+	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     tosulteax
+	beq     L0007
+	inc     _failures
+L0007:	lda     _ulong1+3
+	sta     sreg+1
+	lda     _ulong1+2
+	sta     sreg
+	ldx     _ulong1+1
+	lda     _ulong1
+	jsr     pusheax
+	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     tosuleeax
+	beq     L0008
+	inc     _failures
+L0008:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_long2neglit (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_long2neglit: near
+
+.segment	"CODE"
+
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$01
+	jsr     tosgeeax
+	beq     L0002
+	inc     _failures
+L0002:	lda     _long1+3
+	sta     sreg+1
+	lda     _long1+2
+	sta     sreg
+	ldx     _long1+1
+	lda     _long1
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$01
+	jsr     tosgeeax
+	beq     L0003
+	inc     _failures
+L0003:	lda     _long1+3
+	sta     sreg+1
+	lda     _long1+2
+	sta     sreg
+	ldx     _long1+1
+	lda     _long1
+	jsr     pusheax
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     tosgteax
+	beq     L0004
+	inc     _failures
+L0004:	lda     _long1+3
+	sta     sreg+1
+	lda     _long1+2
+	sta     sreg
+	ldx     _long1+1
+	lda     _long1
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$65
+	jsr     tosgeeax
+	beq     L0005
+	inc     _failures
+L0005:	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$CF
+	jsr     tosgeeax
+	beq     L0006
+	inc     _failures
+L0006:	lda     _long1+3
+	sta     sreg+1
+	lda     _long1+2
+	sta     sreg
+	ldx     _long1+1
+	lda     _long1
+	jsr     pusheax
+	ldx     #$EC
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	lda     #$78
+	jsr     toslteax
+	beq     L0007
+	inc     _failures
+L0007:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     _c_0
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	jsr     _c_long2long_eq
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	stz     sreg
+	stz     sreg+1
+	lda     #$01
+	sta     _long1
+	stz     _long1+1
+	ldy     sreg
+	sty     _long1+2
+	ldy     sreg+1
+	sty     _long1+3
+	stz     sreg
+	stz     sreg+1
+	sta     _ulong1
+	stz     _ulong1+1
+	ldy     sreg
+	sty     _ulong1+2
+	ldy     sreg+1
+	sty     _ulong1+3
+	jsr     _c_1
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	jsr     _c_long2long_neq
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	sta     _long0
+	stz     _long0+1
+	ldy     sreg
+	sty     _long0+2
+	ldy     sreg+1
+	sty     _long0+3
+	stz     sreg
+	stz     sreg+1
+	sta     _ulong0
+	stz     _ulong0+1
+	ldy     sreg
+	sty     _ulong0+2
+	ldy     sreg+1
+	sty     _ulong0+3
+	jsr     _c_2
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	stz     sreg
+	stz     sreg+1
+	lda     #$FF
+	sta     _long0
+	stz     _long0+1
+	ldy     sreg
+	sty     _long0+2
+	ldy     sreg+1
+	sty     _long0+3
+	stz     sreg
+	stz     sreg+1
+	sta     _ulong0
+	stz     _ulong0+1
+	ldy     sreg
+	sty     _ulong0+2
+	ldy     sreg+1
+	sty     _ulong0+3
+	jsr     _c_ff
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$02
+	stz     sreg
+	stz     sreg+1
+	stz     _long0
+	stx     _long0+1
+	ldy     sreg
+	sty     _long0+2
+	ldy     sreg+1
+	sty     _long0+3
+	stz     sreg
+	stz     sreg+1
+	stz     _ulong0
+	stx     _ulong0+1
+	ldy     sreg
+	sty     _ulong0+2
+	ldy     sreg+1
+	sty     _ulong0+3
+	jsr     _c_200
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	stz     sreg+1
+	lda     #$02
+	sta     sreg
+	stz     _long0
+	stz     _long0+1
+	ldy     sreg
+	sty     _long0+2
+	ldy     sreg+1
+	sty     _long0+3
+	stz     sreg+1
+	lda     #$02
+	sta     sreg
+	stz     _ulong0
+	stz     _ulong0+1
+	ldy     sreg
+	sty     _ulong0+2
+	ldy     sreg+1
+	sty     _ulong0+3
+	jsr     _c_20000
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	txa
+	sta     _long0
+	sta     _long0+1
+	ldy     sreg
+	sty     _long0+2
+	ldy     sreg+1
+	sty     _long0+3
+	jsr     _c_minus1
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$9C
+	sta     _long0
+	stx     _long0+1
+	ldy     sreg
+	sty     _long0+2
+	ldy     sreg+1
+	sty     _long0+3
+	ldx     #$FC
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	lda     #$18
+	sta     _long1
+	stx     _long1+1
+	ldy     sreg
+	sty     _long1+2
+	ldy     sreg+1
+	sty     _long1+3
+	jsr     _c_long2neglit
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	lda     _failures
+	sta     _success
+	jsr     _done
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     _failures
+	rts
+
+.endproc
+
@@ -0,0 +1,1981 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "compare5.c", 5579, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/limits.h", 3146, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_success
+	.export		_failures
+	.export		_dummy
+	.export		_int0
+	.export		_int1
+	.export		_char0
+	.export		_char1
+	.export		_long0
+	.export		_long1
+	.export		_ulong0
+	.export		_ulong1
+	.export		_done
+	.export		_c_0
+	.export		_c_1
+	.export		_c_2
+	.export		_c_ff
+	.export		_c_200
+	.export		_c_20000
+	.export		_c_a5
+	.export		_c_a500
+	.export		_c_abcd
+	.export		_c_ifelse1
+	.export		_c_minus1
+	.export		_c_long2long_eq
+	.export		_c_long2long_neq
+	.export		_c_long2neglit
+	.export		_main
+
+.segment	"DATA"
+
+_success:
+	.byte	$00
+_failures:
+	.byte	$00
+_dummy:
+	.byte	$00
+_int0:
+	.word	$0000
+_int1:
+	.word	$0000
+_char0:
+	.byte	$00
+_char1:
+	.byte	$00
+_long0:
+	.dword	$00000000
+_long1:
+	.dword	$00000000
+_ulong0:
+	.dword	$00000000
+_ulong1:
+	.dword	$00000000
+
+.segment	"RODATA"
+
+S0008:
+	.byte	$63,$5F,$6C,$6F,$6E,$67,$32,$6C,$6F,$6E,$67,$5F,$6E,$65,$71,$3A
+	.byte	$20,$25,$64,$0A,$00
+S0001:
+	.byte	$6C,$6F,$6E,$67,$30,$3A,$25,$6C,$64,$20,$6C,$6F,$6E,$67,$31,$3A
+	.byte	$25,$6C,$64,$0A,$00
+S0006:
+	.byte	$63,$5F,$6C,$6F,$6E,$67,$32,$6C,$6F,$6E,$67,$5F,$65,$71,$3A,$20
+	.byte	$25,$64,$0A,$00
+S000E:
+	.byte	$63,$5F,$6C,$6F,$6E,$67,$32,$6E,$65,$67,$6C,$69,$74,$3A,$20,$25
+	.byte	$64,$0A,$00
+S0002:
+	.byte	$28,$6C,$6F,$6E,$67,$30,$20,$21,$3D,$20,$2D,$31,$29,$0A,$00
+S000F:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+S000D:
+	.byte	$63,$5F,$6D,$69,$6E,$75,$73,$31,$3A,$20,$25,$64,$0A,$00
+S0004:
+	.byte	$28,$6C,$6F,$6E,$67,$31,$20,$3C,$20,$30,$29,$0A,$00
+S000C:
+	.byte	$63,$5F,$32,$30,$30,$30,$30,$3A,$20,$25,$64,$0A,$00
+S0003:
+	.byte	$28,$6C,$6F,$6E,$67,$30,$20,$3E,$20,$30,$29,$0A,$00
+S000B:
+	.byte	$63,$5F,$32,$30,$30,$3A,$20,$25,$64,$0A,$00
+S000A:
+	.byte	$63,$5F,$66,$66,$3A,$20,$25,$64,$0A,$00
+S0007:
+	.byte	$63,$5F,$31,$3A,$20,$25,$64,$0A,$00
+S0005:
+	.byte	$63,$5F,$30,$3A,$20,$25,$64,$0A,$00
+S0009:
+	.byte	$63,$5F,$32,$3A,$20,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ done (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_done: near
+
+	.dbg	func, "done", "00", extern, "_done"
+
+.segment	"CODE"
+
+	.dbg	line, "compare5.c", 32
+	ldx     #$00
+	lda     _dummy
+	inc     _dummy
+	.dbg	line, "compare5.c", 33
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_0 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_0: near
+
+	.dbg	func, "c_0", "00", extern, "_c_0"
+
+.segment	"CODE"
+
+	.dbg	line, "compare5.c", 42
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     tosneeax
+	jeq     L0002
+	.dbg	line, "compare5.c", 43
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 45
+L0002:	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     tosgeeax
+	jeq     L0003
+	.dbg	line, "compare5.c", 46
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 48
+L0003:	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     tosneeax
+	jeq     L0004
+	.dbg	line, "compare5.c", 49
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 51
+L0004:	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     tosneeax
+	jeq     L0005
+	.dbg	line, "compare5.c", 52
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 53
+L0005:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_1: near
+
+	.dbg	func, "c_1", "00", extern, "_c_1"
+
+.segment	"CODE"
+
+	.dbg	line, "compare5.c", 62
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     toseqeax
+	jeq     L0002
+	.dbg	line, "compare5.c", 63
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 65
+L0002:	lda     _long1+3
+	sta     sreg+1
+	lda     _long1+2
+	sta     sreg
+	ldx     _long1+1
+	lda     _long1
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     tosneeax
+	jeq     L0003
+	.dbg	line, "compare5.c", 66
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 68
+L0003:	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     toseqeax
+	jeq     L0004
+	.dbg	line, "compare5.c", 69
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 71
+L0004:	lda     _ulong1+3
+	sta     sreg+1
+	lda     _ulong1+2
+	sta     sreg
+	ldx     _ulong1+1
+	lda     _ulong1
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     tosneeax
+	jeq     L0005
+	.dbg	line, "compare5.c", 72
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 74
+L0005:	lda     _long1+3
+	sta     sreg+1
+	lda     _long1+2
+	sta     sreg
+	ldx     _long1+1
+	lda     _long1
+	lda     sreg+1
+	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0006
+	.dbg	line, "compare5.c", 75
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 77
+L0006:	lda     _long1+3
+	sta     sreg+1
+	lda     _long1+2
+	sta     sreg
+	ldx     _long1+1
+	lda     _long1
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     toslteax
+	jeq     L0007
+	.dbg	line, "compare5.c", 78
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 80
+L0007:	lda     _ulong1+3
+	sta     sreg+1
+	lda     _ulong1+2
+	sta     sreg
+	ldx     _ulong1+1
+	lda     _ulong1
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     toseqeax
+	jeq     L0008
+	.dbg	line, "compare5.c", 81
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 83
+L0008:	lda     _long1+3
+	sta     sreg+1
+	lda     _long1+2
+	sta     sreg
+	ldx     _long1+1
+	lda     _long1
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	jsr     tosgeeax
+	jeq     L0009
+	.dbg	line, "compare5.c", 84
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 86
+L0009:	lda     _ulong1+3
+	sta     sreg+1
+	lda     _ulong1+2
+	sta     sreg
+	ldx     _ulong1+1
+	lda     _ulong1
+	cmp     #$02
+	txa
+	sbc     #$00
+	lda     sreg
+	sbc     #$00
+	lda     sreg+1
+	sbc     #$00
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L000A
+	.dbg	line, "compare5.c", 87
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 88
+L000A:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_2: near
+
+	.dbg	func, "c_2", "00", extern, "_c_2"
+
+.segment	"CODE"
+
+	.dbg	line, "compare5.c", 97
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	jeq     L0002
+	.dbg	line, "compare5.c", 98
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 100
+L0002:	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	jeq     L0003
+	.dbg	line, "compare5.c", 101
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 103
+L0003:	lda     _long1+3
+	sta     sreg+1
+	lda     _long1+2
+	sta     sreg
+	ldx     _long1+1
+	lda     _long1
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	jsr     toseqeax
+	jeq     L0004
+	.dbg	line, "compare5.c", 104
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 106
+L0004:	lda     _ulong1+3
+	sta     sreg+1
+	lda     _ulong1+2
+	sta     sreg
+	ldx     _ulong1+1
+	lda     _ulong1
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	jsr     toseqeax
+	jeq     L0005
+	.dbg	line, "compare5.c", 107
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 108
+L0005:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_ff (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_ff: near
+
+	.dbg	func, "c_ff", "00", extern, "_c_ff"
+
+.segment	"CODE"
+
+	.dbg	line, "compare5.c", 117
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     tosneeax
+	jeq     L0002
+	.dbg	line, "compare5.c", 118
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 120
+L0002:	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     tosneeax
+	jeq     L0003
+	.dbg	line, "compare5.c", 121
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 123
+L0003:	lda     _long1+3
+	sta     sreg+1
+	lda     _long1+2
+	sta     sreg
+	ldx     _long1+1
+	lda     _long1
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     toseqeax
+	jeq     L0004
+	.dbg	line, "compare5.c", 124
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 126
+L0004:	lda     _ulong1+3
+	sta     sreg+1
+	lda     _ulong1+2
+	sta     sreg
+	ldx     _ulong1+1
+	lda     _ulong1
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     toseqeax
+	jeq     L0005
+	.dbg	line, "compare5.c", 127
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 128
+L0005:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_200 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_200: near
+
+	.dbg	func, "c_200", "00", extern, "_c_200"
+
+.segment	"CODE"
+
+	.dbg	line, "compare5.c", 137
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldx     #$02
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     tosneeax
+	jeq     L0002
+	.dbg	line, "compare5.c", 138
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 140
+L0002:	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	ldx     #$02
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     tosneeax
+	jeq     L0003
+	.dbg	line, "compare5.c", 141
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 143
+L0003:	lda     _long1+3
+	sta     sreg+1
+	lda     _long1+2
+	sta     sreg
+	ldx     _long1+1
+	lda     _long1
+	jsr     pusheax
+	ldx     #$02
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     toseqeax
+	jeq     L0004
+	.dbg	line, "compare5.c", 144
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 146
+L0004:	lda     _ulong1+3
+	sta     sreg+1
+	lda     _ulong1+2
+	sta     sreg
+	ldx     _ulong1+1
+	lda     _ulong1
+	jsr     pusheax
+	ldx     #$02
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     toseqeax
+	jeq     L0005
+	.dbg	line, "compare5.c", 147
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 148
+L0005:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_20000 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_20000: near
+
+	.dbg	func, "c_20000", "00", extern, "_c_20000"
+
+.segment	"CODE"
+
+	.dbg	line, "compare5.c", 159
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg+1
+	lda     #$02
+	sta     sreg
+	lda     #$00
+	jsr     tosneeax
+	jeq     L0002
+	.dbg	line, "compare5.c", 160
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 162
+L0002:	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg+1
+	lda     #$02
+	sta     sreg
+	lda     #$00
+	jsr     tosneeax
+	jeq     L0003
+	.dbg	line, "compare5.c", 163
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 165
+L0003:	lda     _long1+3
+	sta     sreg+1
+	lda     _long1+2
+	sta     sreg
+	ldx     _long1+1
+	lda     _long1
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg+1
+	lda     #$02
+	sta     sreg
+	lda     #$00
+	jsr     toseqeax
+	jeq     L0004
+	.dbg	line, "compare5.c", 166
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 168
+L0004:	lda     _ulong1+3
+	sta     sreg+1
+	lda     _ulong1+2
+	sta     sreg
+	ldx     _ulong1+1
+	lda     _ulong1
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg+1
+	lda     #$02
+	sta     sreg
+	lda     #$00
+	jsr     toseqeax
+	jeq     L0005
+	.dbg	line, "compare5.c", 169
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 171
+L0005:	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg+1
+	lda     #$01
+	sta     sreg
+	jsr     toslteax
+	jeq     L0006
+	.dbg	line, "compare5.c", 172
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 174
+L0006:	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg+1
+	lda     #$01
+	sta     sreg
+	lda     #$00
+	jsr     toslteax
+	jeq     L0007
+	.dbg	line, "compare5.c", 175
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 180
+L0007:	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     toseqeax
+	jeq     L0008
+	.dbg	line, "compare5.c", 181
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 182
+L0008:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_a5 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_a5: near
+
+	.dbg	func, "c_a5", "00", extern, "_c_a5"
+
+.segment	"CODE"
+
+	.dbg	line, "compare5.c", 191
+	ldx     #$00
+	lda     _char0
+	cmp     #$A5
+	jsr     boolne
+	jeq     L0002
+	.dbg	line, "compare5.c", 192
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 194
+L0002:	lda     _int0
+	ldx     _int0+1
+	cpx     #$00
+	bne     L0004
+	cmp     #$A5
+L0004:	jsr     boolne
+	jeq     L0003
+	.dbg	line, "compare5.c", 195
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 197
+L0003:	lda     _int0
+	ldx     _int0+1
+	cpx     #$00
+	bne     L0006
+	cmp     #$A4
+L0006:	jsr     booleq
+	jeq     L0005
+	.dbg	line, "compare5.c", 198
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 200
+L0005:	lda     _int0
+	ldx     _int0+1
+	cpx     #$A5
+	bne     L0008
+	cmp     #$00
+L0008:	jsr     booleq
+	jeq     L0007
+	.dbg	line, "compare5.c", 201
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 202
+L0007:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_a500 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_a500: near
+
+	.dbg	func, "c_a500", "00", extern, "_c_a500"
+
+.segment	"CODE"
+
+	.dbg	line, "compare5.c", 212
+	ldx     #$00
+	lda     _char0
+	jmp     L0002
+	.dbg	line, "compare5.c", 213
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 216
+L0002:	lda     _int0
+	ldx     _int0+1
+	cpx     #$A5
+	bne     L0004
+	cmp     #$00
+L0004:	jsr     boolne
+	jeq     L0003
+	.dbg	line, "compare5.c", 217
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 219
+L0003:	lda     _int0
+	ldx     _int0+1
+	cpx     #$A4
+	bne     L0006
+	cmp     #$00
+L0006:	jsr     booleq
+	jeq     L0005
+	.dbg	line, "compare5.c", 220
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 222
+L0005:	lda     _int0
+	ldx     _int0+1
+	cpx     #$00
+	bne     L0008
+	cmp     #$A5
+L0008:	jsr     booleq
+	jeq     L0007
+	.dbg	line, "compare5.c", 223
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 224
+L0007:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_abcd (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_abcd: near
+
+	.dbg	func, "c_abcd", "00", extern, "_c_abcd"
+
+.segment	"CODE"
+
+	.dbg	line, "compare5.c", 234
+	ldx     #$00
+	lda     _char0
+	jmp     L0002
+	.dbg	line, "compare5.c", 235
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 238
+L0002:	lda     _int0
+	ldx     _int0+1
+	cpx     #$AB
+	bne     L0004
+	cmp     #$CD
+L0004:	jsr     boolne
+	jeq     L0003
+	.dbg	line, "compare5.c", 239
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 241
+L0003:	lda     _int0
+	ldx     _int0+1
+	cpx     #$AB
+	bne     L0006
+	cmp     #$00
+L0006:	jsr     booleq
+	jeq     L0005
+	.dbg	line, "compare5.c", 242
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 244
+L0005:	lda     _int0
+	ldx     _int0+1
+	cpx     #$00
+	bne     L0008
+	cmp     #$CD
+L0008:	jsr     booleq
+	jeq     L0007
+	.dbg	line, "compare5.c", 245
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 247
+L0007:	lda     _int0
+	ldx     _int0+1
+	cpx     #$05
+	bne     L000A
+	cmp     #$CD
+L000A:	jsr     booleq
+	jeq     L0009
+	.dbg	line, "compare5.c", 248
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 250
+L0009:	lda     _int0
+	ldx     _int0+1
+	cpx     #$AB
+	bne     L000C
+	cmp     #$05
+L000C:	jsr     booleq
+	jeq     L000B
+	.dbg	line, "compare5.c", 251
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 253
+L000B:	lda     _int0
+	ldx     _int0+1
+	cpx     #$AB
+	bne     L000E
+	cmp     #$01
+L000E:	jsr     booleq
+	jeq     L000D
+	.dbg	line, "compare5.c", 254
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 256
+L000D:	lda     _int0
+	ldx     _int0+1
+	cpx     #$01
+	bne     L0010
+	cmp     #$CD
+L0010:	jsr     booleq
+	jeq     L000F
+	.dbg	line, "compare5.c", 257
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 259
+L000F:	lda     _int0
+	ldx     _int0+1
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvs     L0012
+	eor     #$80
+L0012:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0011
+	.dbg	line, "compare5.c", 260
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 263
+L0011:	lda     _int0
+	ldx     _int0+1
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$AB
+	lda     #$34
+	sta     sreg
+	lda     #$12
+	sta     sreg+1
+	lda     #$CD
+	jsr     toseqeax
+	jeq     L0013
+	.dbg	line, "compare5.c", 264
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 266
+L0013:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_ifelse1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_ifelse1: near
+
+	.dbg	func, "c_ifelse1", "00", extern, "_c_ifelse1"
+
+.segment	"CODE"
+
+	.dbg	line, "compare5.c", 271
+	lda     _char0
+	jeq     L0002
+	.dbg	line, "compare5.c", 272
+	ldx     #$00
+	lda     _char1
+	sta     _char0
+	.dbg	line, "compare5.c", 273
+	jmp     L0003
+	.dbg	line, "compare5.c", 274
+L0002:	ldx     #$00
+	lda     #$00
+	sta     _char0
+	.dbg	line, "compare5.c", 276
+L0003:	lda     _char0
+	jeq     L0004
+	.dbg	line, "compare5.c", 277
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 278
+L0004:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_minus1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_minus1: near
+
+	.dbg	func, "c_minus1", "00", extern, "_c_minus1"
+
+.segment	"CODE"
+
+	.dbg	line, "compare5.c", 286
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	lda     _long1+3
+	sta     sreg+1
+	lda     _long1+2
+	sta     sreg
+	ldx     _long1+1
+	lda     _long1
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	.dbg	line, "compare5.c", 288
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "compare5.c", 289
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     tosneeax
+	jeq     L0002
+	.dbg	line, "compare5.c", 291
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 293
+L0002:	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "compare5.c", 294
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     tosgeeax
+	jeq     L0003
+	.dbg	line, "compare5.c", 296
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 298
+L0003:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "compare5.c", 299
+	lda     _long1+3
+	sta     sreg+1
+	lda     _long1+2
+	sta     sreg
+	ldx     _long1+1
+	lda     _long1
+	lda     sreg+1
+	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0004
+	.dbg	line, "compare5.c", 301
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 307
+L0004:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_long2long_eq (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_long2long_eq: near
+
+	.dbg	func, "c_long2long_eq", "00", extern, "_c_long2long_eq"
+
+.segment	"CODE"
+
+	.dbg	line, "compare5.c", 314
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	lda     _long1+3
+	sta     sreg+1
+	lda     _long1+2
+	sta     sreg
+	ldx     _long1+1
+	lda     _long1
+	jsr     tosneeax
+	jeq     L0002
+	.dbg	line, "compare5.c", 315
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 317
+L0002:	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	lda     _ulong1+3
+	sta     sreg+1
+	lda     _ulong1+2
+	sta     sreg
+	ldx     _ulong1+1
+	lda     _ulong1
+	jsr     tosneeax
+	jeq     L0003
+	.dbg	line, "compare5.c", 318
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 320
+L0003:	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	lda     _ulong1+3
+	sta     sreg+1
+	lda     _ulong1+2
+	sta     sreg
+	ldx     _ulong1+1
+	lda     _ulong1
+	jsr     tosneeax
+	jeq     L0004
+	.dbg	line, "compare5.c", 321
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 323
+L0004:	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	lda     _long1+3
+	sta     sreg+1
+	lda     _long1+2
+	sta     sreg
+	ldx     _long1+1
+	lda     _long1
+	jsr     tosgteax
+	jeq     L0005
+	.dbg	line, "compare5.c", 324
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 326
+L0005:	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	lda     _long1+3
+	sta     sreg+1
+	lda     _long1+2
+	sta     sreg
+	ldx     _long1+1
+	lda     _long1
+	jsr     toslteax
+	jeq     L0006
+	.dbg	line, "compare5.c", 327
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 329
+L0006:	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     tosugteax
+	jeq     L0007
+	.dbg	line, "compare5.c", 330
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 332
+L0007:	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     tosulteax
+	jeq     L0008
+	.dbg	line, "compare5.c", 333
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 334
+L0008:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_long2long_neq (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_long2long_neq: near
+
+	.dbg	func, "c_long2long_neq", "00", extern, "_c_long2long_neq"
+
+.segment	"CODE"
+
+	.dbg	line, "compare5.c", 342
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	lda     _long1+3
+	sta     sreg+1
+	lda     _long1+2
+	sta     sreg
+	ldx     _long1+1
+	lda     _long1
+	jsr     toseqeax
+	jeq     L0002
+	.dbg	line, "compare5.c", 343
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 345
+L0002:	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     pusheax
+	lda     _ulong1+3
+	sta     sreg+1
+	lda     _ulong1+2
+	sta     sreg
+	ldx     _ulong1+1
+	lda     _ulong1
+	jsr     toseqeax
+	jeq     L0003
+	.dbg	line, "compare5.c", 346
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 348
+L0003:	lda     _long1+3
+	sta     sreg+1
+	lda     _long1+2
+	sta     sreg
+	ldx     _long1+1
+	lda     _long1
+	jsr     pusheax
+	lda     _ulong1+3
+	sta     sreg+1
+	lda     _ulong1+2
+	sta     sreg
+	ldx     _ulong1+1
+	lda     _ulong1
+	jsr     tosneeax
+	jeq     L0004
+	.dbg	line, "compare5.c", 349
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 351
+L0004:	lda     _long1+3
+	sta     sreg+1
+	lda     _long1+2
+	sta     sreg
+	ldx     _long1+1
+	lda     _long1
+	jsr     pusheax
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     toslteax
+	jeq     L0005
+	.dbg	line, "compare5.c", 352
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 354
+L0005:	lda     _long1+3
+	sta     sreg+1
+	lda     _long1+2
+	sta     sreg
+	ldx     _long1+1
+	lda     _long1
+	jsr     pusheax
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     tosleeax
+	jeq     L0006
+	.dbg	line, "compare5.c", 355
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 357
+L0006:	lda     _ulong1+3
+	sta     sreg+1
+	lda     _ulong1+2
+	sta     sreg
+	ldx     _ulong1+1
+	lda     _ulong1
+	jsr     pusheax
+	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     tosulteax
+	jeq     L0007
+	.dbg	line, "compare5.c", 358
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 360
+L0007:	lda     _ulong1+3
+	sta     sreg+1
+	lda     _ulong1+2
+	sta     sreg
+	ldx     _ulong1+1
+	lda     _ulong1
+	jsr     pusheax
+	lda     _ulong0+3
+	sta     sreg+1
+	lda     _ulong0+2
+	sta     sreg
+	ldx     _ulong0+1
+	lda     _ulong0
+	jsr     tosuleeax
+	jeq     L0008
+	.dbg	line, "compare5.c", 361
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 362
+L0008:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_long2neglit (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_long2neglit: near
+
+	.dbg	func, "c_long2neglit", "00", extern, "_c_long2neglit"
+
+.segment	"CODE"
+
+	.dbg	line, "compare5.c", 370
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     tosgeeax
+	jeq     L0002
+	.dbg	line, "compare5.c", 371
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 372
+L0002:	lda     _long1+3
+	sta     sreg+1
+	lda     _long1+2
+	sta     sreg
+	ldx     _long1+1
+	lda     _long1
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     tosgeeax
+	jeq     L0003
+	.dbg	line, "compare5.c", 373
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 375
+L0003:	lda     _long1+3
+	sta     sreg+1
+	lda     _long1+2
+	sta     sreg
+	ldx     _long1+1
+	lda     _long1
+	jsr     pusheax
+	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     tosgteax
+	jeq     L0004
+	.dbg	line, "compare5.c", 376
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 378
+L0004:	lda     _long1+3
+	sta     sreg+1
+	lda     _long1+2
+	sta     sreg
+	ldx     _long1+1
+	lda     _long1
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$65
+	jsr     tosgeeax
+	jeq     L0005
+	.dbg	line, "compare5.c", 379
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 381
+L0005:	lda     _long0+3
+	sta     sreg+1
+	lda     _long0+2
+	sta     sreg
+	ldx     _long0+1
+	lda     _long0
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$CF
+	jsr     tosgeeax
+	jeq     L0006
+	.dbg	line, "compare5.c", 382
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 384
+L0006:	lda     _long1+3
+	sta     sreg+1
+	lda     _long1+2
+	sta     sreg
+	ldx     _long1+1
+	lda     _long1
+	jsr     pusheax
+	ldx     #$EC
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$78
+	jsr     toslteax
+	jeq     L0007
+	.dbg	line, "compare5.c", 385
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare5.c", 386
+L0007:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "compare5.c", 391
+	jsr     _c_0
+	.dbg	line, "compare5.c", 392
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "compare5.c", 394
+	jsr     _c_long2long_eq
+	.dbg	line, "compare5.c", 395
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "compare5.c", 397
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	sta     _long1
+	stx     _long1+1
+	ldy     sreg
+	sty     _long1+2
+	ldy     sreg+1
+	sty     _long1+3
+	.dbg	line, "compare5.c", 398
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	sta     _ulong1
+	stx     _ulong1+1
+	ldy     sreg
+	sty     _ulong1+2
+	ldy     sreg+1
+	sty     _ulong1+3
+	.dbg	line, "compare5.c", 399
+	jsr     _c_1
+	.dbg	line, "compare5.c", 400
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "compare5.c", 401
+	jsr     _c_long2long_neq
+	.dbg	line, "compare5.c", 402
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "compare5.c", 404
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	sta     _long0
+	stx     _long0+1
+	ldy     sreg
+	sty     _long0+2
+	ldy     sreg+1
+	sty     _long0+3
+	.dbg	line, "compare5.c", 405
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	sta     _ulong0
+	stx     _ulong0+1
+	ldy     sreg
+	sty     _ulong0+2
+	ldy     sreg+1
+	sty     _ulong0+3
+	.dbg	line, "compare5.c", 406
+	jsr     _c_2
+	.dbg	line, "compare5.c", 407
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "compare5.c", 409
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	sta     _long0
+	stx     _long0+1
+	ldy     sreg
+	sty     _long0+2
+	ldy     sreg+1
+	sty     _long0+3
+	.dbg	line, "compare5.c", 410
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	sta     _ulong0
+	stx     _ulong0+1
+	ldy     sreg
+	sty     _ulong0+2
+	ldy     sreg+1
+	sty     _ulong0+3
+	.dbg	line, "compare5.c", 411
+	jsr     _c_ff
+	.dbg	line, "compare5.c", 412
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "compare5.c", 414
+	ldx     #$02
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	sta     _long0
+	stx     _long0+1
+	ldy     sreg
+	sty     _long0+2
+	ldy     sreg+1
+	sty     _long0+3
+	.dbg	line, "compare5.c", 415
+	ldx     #$02
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	sta     _ulong0
+	stx     _ulong0+1
+	ldy     sreg
+	sty     _ulong0+2
+	ldy     sreg+1
+	sty     _ulong0+3
+	.dbg	line, "compare5.c", 416
+	jsr     _c_200
+	.dbg	line, "compare5.c", 417
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "compare5.c", 419
+	ldx     #$00
+	stx     sreg+1
+	lda     #$02
+	sta     sreg
+	lda     #$00
+	sta     _long0
+	stx     _long0+1
+	ldy     sreg
+	sty     _long0+2
+	ldy     sreg+1
+	sty     _long0+3
+	.dbg	line, "compare5.c", 420
+	ldx     #$00
+	stx     sreg+1
+	lda     #$02
+	sta     sreg
+	lda     #$00
+	sta     _ulong0
+	stx     _ulong0+1
+	ldy     sreg
+	sty     _ulong0+2
+	ldy     sreg+1
+	sty     _ulong0+3
+	.dbg	line, "compare5.c", 421
+	jsr     _c_20000
+	.dbg	line, "compare5.c", 422
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "compare5.c", 424
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	sta     _long0
+	stx     _long0+1
+	ldy     sreg
+	sty     _long0+2
+	ldy     sreg+1
+	sty     _long0+3
+	.dbg	line, "compare5.c", 425
+	jsr     _c_minus1
+	.dbg	line, "compare5.c", 426
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "compare5.c", 428
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$9C
+	sta     _long0
+	stx     _long0+1
+	ldy     sreg
+	sty     _long0+2
+	ldy     sreg+1
+	sty     _long0+3
+	.dbg	line, "compare5.c", 429
+	ldx     #$FC
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$18
+	sta     _long1
+	stx     _long1+1
+	ldy     sreg
+	sty     _long1+2
+	ldy     sreg+1
+	sty     _long1+3
+	.dbg	line, "compare5.c", 430
+	jsr     _c_long2neglit
+	.dbg	line, "compare5.c", 431
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "compare5.c", 433
+	ldx     #$00
+	lda     _failures
+	sta     _success
+	.dbg	line, "compare5.c", 434
+	jsr     _done
+	.dbg	line, "compare5.c", 436
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "compare5.c", 438
+	ldx     #$00
+	lda     _failures
+	jmp     L0001
+	.dbg	line, "compare5.c", 439
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,486 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_success
+	.export		_failures
+	.export		_dummy
+	.export		_int0
+	.export		_int1
+	.export		_uchar0
+	.export		_uchar1
+	.export		_char0
+	.export		_char1
+	.export		_long0
+	.export		_long1
+	.export		_done
+	.export		_c_char
+	.export		_c_int
+	.export		_c_long
+	.export		_c_uminus
+	.export		_main
+
+.segment	"DATA"
+
+_success:
+	.byte	$00
+_failures:
+	.byte	$00
+_dummy:
+	.byte	$00
+_int0:
+	.word	$0000
+_int1:
+	.word	$0000
+_uchar0:
+	.byte	$00
+_uchar1:
+	.byte	$00
+_char0:
+	.byte	$00
+_char1:
+	.byte	$00
+_long0:
+	.byte	$00
+_long1:
+	.byte	$00
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ done (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_done: near
+
+.segment	"CODE"
+
+	inc     _dummy
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_char (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_char: near
+
+.segment	"CODE"
+
+	lda     _char0
+	bne     L0003
+	lda     _char1
+	bne     L0003
+	tax
+	bra     L0002
+L0003:	ldx     #$00
+	inc     _failures
+L0002:	lda     _char0
+	beq     L0025
+	lda     _char1
+	beq     L0025
+	inc     _failures
+L0025:	lda     _char0
+	cmp     _char1
+	bcc     L0026
+	beq     L0026
+	inc     _failures
+L0026:	lda     _char0
+	ina
+	bne     L000B
+	inx
+L000B:	cmp     _char1
+	txa
+	sbc     #$00
+	bvc     L0021
+	eor     #$80
+L0021:	asl     a
+	ldx     #$00
+	bcc     L0027
+	inc     _failures
+L0027:	lda     _char0
+	clc
+	adc     #$05
+	bcc     L000D
+	inx
+L000D:	jsr     pushax
+	ldx     #$00
+	lda     _char1
+	clc
+	adc     #$09
+	bcc     L000E
+	inx
+L000E:	jsr     tosicmp
+	bmi     L000C
+	inc     _failures
+L000C:	inc     _char0
+	beq     L002B
+	lda     _char1
+	beq     L002B
+	inc     _failures
+L002B:	lda     _char0
+	jsr     pusha0
+	lda     _char1
+	ina
+	bne     L0014
+	ldx     #$01
+L0014:	jsr     tosicmp
+	beq     L0013
+	inc     _failures
+L0013:	lda     _char0
+	bne     L0015
+	inc     _failures
+L0015:	lda     _char1
+	bne     L0017
+	lda     _char0
+	bne     L002C
+L0017:	inc     _failures
+L002C:	lda     _char0
+	cmp     #$06
+	bcc     L0030
+	cmp     #$0A
+	bcs     L0030
+	inc     _failures
+L0030:	lda     #$05
+	clc
+	adc     _char0
+	sta     _char0
+	cmp     #$06
+	lda     #$00
+	bcc     L0020
+	lda     _char0
+	cmp     #$0A
+	bcc     L0033
+	lda     #$00
+	bra     L0020
+L0033:	lda     #$01
+L0020:	jsr     bnega
+	beq     L001D
+	inc     _failures
+L001D:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_int (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_int: near
+
+.segment	"CODE"
+
+	lda     _int0
+	ora     _int0+1
+	bne     L0003
+	lda     _int1
+	ora     _int1+1
+	beq     L0002
+L0003:	inc     _failures
+L0002:	lda     _int0
+	ora     _int0+1
+	beq     L0005
+	lda     _int1
+	ora     _int1+1
+	beq     L0005
+	inc     _failures
+L0005:	lda     _int0
+	ldx     _int0+1
+	jsr     pushax
+	lda     _int1
+	ldx     _int1+1
+	jsr     tosicmp
+	bmi     L0009
+	beq     L0009
+	inc     _failures
+L0009:	lda     _int0
+	ldx     _int0+1
+	ina
+	bne     L000B
+	inx
+L000B:	cmp     _int1
+	txa
+	sbc     _int1+1
+	bvc     L0027
+	eor     #$80
+L0027:	bpl     L000A
+	inc     _failures
+L000A:	lda     _int0
+	ldx     _int0+1
+	clc
+	adc     #$05
+	bcc     L000D
+	inx
+L000D:	jsr     pushax
+	lda     _int1
+	ldx     _int1+1
+	clc
+	adc     #$09
+	bcc     L000E
+	inx
+L000E:	jsr     tosicmp
+	bmi     L000C
+	inc     _failures
+L000C:	inc     _int0
+	bne     L000F
+	inc     _int0+1
+L000F:	lda     _int0
+	ora     _int0+1
+	beq     L0010
+	lda     _int1
+	ora     _int1+1
+	beq     L0010
+	inc     _failures
+L0010:	lda     _int0
+	ldx     _int0+1
+	jsr     pushax
+	lda     _int1
+	ldx     _int1+1
+	ina
+	bne     L0015
+	inx
+L0015:	jsr     tosicmp
+	beq     L0014
+	inc     _failures
+L0014:	lda     _int0
+	ora     _int0+1
+	bne     L0016
+	inc     _failures
+L0016:	lda     _int1
+	ora     _int1+1
+	bne     L0018
+	lda     _int0
+	ora     _int0+1
+	bne     L0017
+L0018:	inc     _failures
+L0017:	lda     _int0
+	cmp     #$06
+	lda     _int0+1
+	sbc     #$00
+	bvs     L001B
+	eor     #$80
+L001B:	bpl     L001A
+	lda     _int0
+	cmp     #$0A
+	lda     _int0+1
+	sbc     #$00
+	bvc     L001D
+	eor     #$80
+L001D:	bpl     L001A
+	inc     _failures
+L001A:	lda     #$05
+	clc
+	adc     _int0
+	sta     _int0
+	bcc     L0020
+	inc     _int0+1
+L0020:	lda     _int0
+	cmp     #$06
+	lda     _int0+1
+	sbc     #$00
+	bvs     L0022
+	eor     #$80
+L0022:	asl     a
+	lda     #$00
+	bcc     L0026
+	lda     _int0
+	cmp     #$0A
+	lda     _int0+1
+	sbc     #$00
+	bvc     L0024
+	eor     #$80
+L0024:	bmi     L0030
+	lda     #$00
+	bra     L0026
+L0030:	lda     #$01
+L0026:	jsr     bnega
+	beq     L0021
+	inc     _failures
+L0021:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_long (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_long: near
+
+.segment	"CODE"
+
+	lda     _long0
+	bne     L0003
+	lda     _long1
+	bne     L0003
+	tax
+	bra     L0002
+L0003:	ldx     #$00
+	inc     _failures
+L0002:	lda     _long0
+	beq     L0025
+	lda     _long1
+	beq     L0025
+	inc     _failures
+L0025:	lda     _long0
+	cmp     _long1
+	bcc     L0026
+	beq     L0026
+	inc     _failures
+L0026:	lda     _long0
+	ina
+	bne     L000B
+	inx
+L000B:	cmp     _long1
+	txa
+	sbc     #$00
+	bvc     L0021
+	eor     #$80
+L0021:	asl     a
+	ldx     #$00
+	bcc     L0027
+	inc     _failures
+L0027:	lda     _long0
+	clc
+	adc     #$05
+	bcc     L000D
+	inx
+L000D:	jsr     pushax
+	ldx     #$00
+	lda     _long1
+	clc
+	adc     #$09
+	bcc     L000E
+	inx
+L000E:	jsr     tosicmp
+	bmi     L000C
+	inc     _failures
+L000C:	inc     _long0
+	beq     L002B
+	lda     _long1
+	beq     L002B
+	inc     _failures
+L002B:	lda     _long0
+	jsr     pusha0
+	lda     _long1
+	ina
+	bne     L0014
+	ldx     #$01
+L0014:	jsr     tosicmp
+	beq     L0013
+	inc     _failures
+L0013:	lda     _long0
+	bne     L0015
+	inc     _failures
+L0015:	lda     _long1
+	bne     L0017
+	lda     _long0
+	bne     L002C
+L0017:	inc     _failures
+L002C:	lda     _long0
+	cmp     #$06
+	bcc     L0030
+	cmp     #$0A
+	bcs     L0030
+	inc     _failures
+L0030:	lda     #$05
+	clc
+	adc     _long0
+	sta     _long0
+	cmp     #$06
+	lda     #$00
+	bcc     L0020
+	lda     _long0
+	cmp     #$0A
+	bcc     L0033
+	lda     #$00
+	bra     L0020
+L0033:	lda     #$01
+L0020:	jsr     bnega
+	beq     L001D
+	inc     _failures
+L001D:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_uminus (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_uminus: near
+
+.segment	"CODE"
+
+	lda     _int0
+	ldx     _int0+1
+	jsr     negax
+	sta     _int1
+	stx     _int1+1
+	cpx     #$80
+	bcc     L0002
+	inc     _failures
+L0002:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     _c_char
+	jsr     _c_int
+	jsr     _c_long
+	lda     #$FF
+	sta     _int0
+	sta     _int0+1
+	jsr     _c_uminus
+	lda     _int1+1
+	bne     L0004
+	lda     _int1
+	cmp     #$01
+	beq     L0002
+L0004:	inc     _failures
+L0002:	lda     _failures
+	sta     _success
+	jsr     _done
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     _failures
+	rts
+
+.endproc
+
@@ -0,0 +1,459 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_success
+	.export		_failures
+	.export		_dummy
+	.export		_int0
+	.export		_int1
+	.export		_uchar0
+	.export		_uchar1
+	.export		_char0
+	.export		_char1
+	.export		_long0
+	.export		_long1
+	.export		_done
+	.export		_c_char
+	.export		_c_int
+	.export		_c_long
+	.export		_c_uminus
+	.export		_main
+
+.segment	"DATA"
+
+_success:
+	.byte	$00
+_failures:
+	.byte	$00
+_dummy:
+	.byte	$00
+_int0:
+	.word	$0000
+_int1:
+	.word	$0000
+_uchar0:
+	.byte	$00
+_uchar1:
+	.byte	$00
+_char0:
+	.byte	$00
+_char1:
+	.byte	$00
+_long0:
+	.byte	$00
+_long1:
+	.byte	$00
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ done (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_done: near
+
+.segment	"CODE"
+
+	inc     _dummy
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_char (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_char: near
+
+.segment	"CODE"
+
+	lda     _char0
+	bne     L0003
+	lda     _char1
+	bne     L0003
+	tax
+	jmp     L0002
+L0003:	ldx     #$00
+	inc     _failures
+L0002:	lda     _char0
+	beq     L0021
+	lda     _char1
+	beq     L0021
+	inc     _failures
+L0021:	lda     _char0
+	cmp     _char1
+	bcc     L0022
+	beq     L0022
+	inc     _failures
+L0022:	lda     _char0
+	jsr     incax1
+	cmp     _char1
+	txa
+	sbc     #$00
+	bvc     L001D
+	eor     #$80
+L001D:	asl     a
+	ldx     #$00
+	bcc     L0023
+	inc     _failures
+L0023:	lda     _char0
+	jsr     incax5
+	jsr     pushax
+	ldx     #$00
+	lda     _char1
+	ldy     #$09
+	jsr     incaxy
+	jsr     tosicmp
+	bmi     L000B
+	inc     _failures
+L000B:	inc     _char0
+	beq     L0027
+	lda     _char1
+	beq     L0027
+	inc     _failures
+L0027:	lda     _char0
+	jsr     pusha0
+	lda     _char1
+	jsr     incax1
+	jsr     tosicmp
+	beq     L0010
+	inc     _failures
+L0010:	lda     _char0
+	bne     L0011
+	inc     _failures
+L0011:	lda     _char1
+	bne     L0013
+	lda     _char0
+	bne     L0028
+L0013:	inc     _failures
+L0028:	lda     _char0
+	cmp     #$06
+	bcc     L002C
+	cmp     #$0A
+	bcs     L002C
+	inc     _failures
+L002C:	lda     #$05
+	clc
+	adc     _char0
+	sta     _char0
+	cmp     #$06
+	lda     #$00
+	bcc     L001C
+	lda     _char0
+	cmp     #$0A
+	bcc     L002F
+	lda     #$00
+	jmp     L001C
+L002F:	lda     #$01
+L001C:	jsr     bnega
+	beq     L0019
+	inc     _failures
+L0019:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_int (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_int: near
+
+.segment	"CODE"
+
+	lda     _int0
+	ora     _int0+1
+	bne     L0003
+	lda     _int1
+	ora     _int1+1
+	beq     L0002
+L0003:	inc     _failures
+L0002:	lda     _int0
+	ora     _int0+1
+	beq     L0005
+	lda     _int1
+	ora     _int1+1
+	beq     L0005
+	inc     _failures
+L0005:	lda     _int0
+	ldx     _int0+1
+	jsr     pushax
+	lda     _int1
+	ldx     _int1+1
+	jsr     tosicmp
+	bmi     L0009
+	beq     L0009
+	inc     _failures
+L0009:	lda     _int0
+	ldx     _int0+1
+	jsr     incax1
+	cmp     _int1
+	txa
+	sbc     _int1+1
+	bvc     L0023
+	eor     #$80
+L0023:	bpl     L000A
+	inc     _failures
+L000A:	lda     _int0
+	ldx     _int0+1
+	jsr     incax5
+	jsr     pushax
+	lda     _int1
+	ldx     _int1+1
+	ldy     #$09
+	jsr     incaxy
+	jsr     tosicmp
+	bmi     L000B
+	inc     _failures
+L000B:	inc     _int0
+	bne     L000C
+	inc     _int0+1
+L000C:	lda     _int0
+	ora     _int0+1
+	beq     L000D
+	lda     _int1
+	ora     _int1+1
+	beq     L000D
+	inc     _failures
+L000D:	lda     _int0
+	ldx     _int0+1
+	jsr     pushax
+	lda     _int1
+	ldx     _int1+1
+	jsr     incax1
+	jsr     tosicmp
+	beq     L0011
+	inc     _failures
+L0011:	lda     _int0
+	ora     _int0+1
+	bne     L0012
+	inc     _failures
+L0012:	lda     _int1
+	ora     _int1+1
+	bne     L0014
+	lda     _int0
+	ora     _int0+1
+	bne     L0013
+L0014:	inc     _failures
+L0013:	lda     _int0
+	cmp     #$06
+	lda     _int0+1
+	sbc     #$00
+	bvs     L0017
+	eor     #$80
+L0017:	bpl     L0016
+	lda     _int0
+	cmp     #$0A
+	lda     _int0+1
+	sbc     #$00
+	bvc     L0019
+	eor     #$80
+L0019:	bpl     L0016
+	inc     _failures
+L0016:	lda     #$05
+	clc
+	adc     _int0
+	sta     _int0
+	bcc     L001C
+	inc     _int0+1
+L001C:	lda     _int0
+	cmp     #$06
+	lda     _int0+1
+	sbc     #$00
+	bvs     L001E
+	eor     #$80
+L001E:	asl     a
+	lda     #$00
+	bcc     L0022
+	lda     _int0
+	cmp     #$0A
+	lda     _int0+1
+	sbc     #$00
+	bvc     L0020
+	eor     #$80
+L0020:	bmi     L002C
+	lda     #$00
+	jmp     L0022
+L002C:	lda     #$01
+L0022:	jsr     bnega
+	beq     L001D
+	inc     _failures
+L001D:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_long (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_long: near
+
+.segment	"CODE"
+
+	lda     _long0
+	bne     L0003
+	lda     _long1
+	bne     L0003
+	tax
+	jmp     L0002
+L0003:	ldx     #$00
+	inc     _failures
+L0002:	lda     _long0
+	beq     L0021
+	lda     _long1
+	beq     L0021
+	inc     _failures
+L0021:	lda     _long0
+	cmp     _long1
+	bcc     L0022
+	beq     L0022
+	inc     _failures
+L0022:	lda     _long0
+	jsr     incax1
+	cmp     _long1
+	txa
+	sbc     #$00
+	bvc     L001D
+	eor     #$80
+L001D:	asl     a
+	ldx     #$00
+	bcc     L0023
+	inc     _failures
+L0023:	lda     _long0
+	jsr     incax5
+	jsr     pushax
+	ldx     #$00
+	lda     _long1
+	ldy     #$09
+	jsr     incaxy
+	jsr     tosicmp
+	bmi     L000B
+	inc     _failures
+L000B:	inc     _long0
+	beq     L0027
+	lda     _long1
+	beq     L0027
+	inc     _failures
+L0027:	lda     _long0
+	jsr     pusha0
+	lda     _long1
+	jsr     incax1
+	jsr     tosicmp
+	beq     L0010
+	inc     _failures
+L0010:	lda     _long0
+	bne     L0011
+	inc     _failures
+L0011:	lda     _long1
+	bne     L0013
+	lda     _long0
+	bne     L0028
+L0013:	inc     _failures
+L0028:	lda     _long0
+	cmp     #$06
+	bcc     L002C
+	cmp     #$0A
+	bcs     L002C
+	inc     _failures
+L002C:	lda     #$05
+	clc
+	adc     _long0
+	sta     _long0
+	cmp     #$06
+	lda     #$00
+	bcc     L001C
+	lda     _long0
+	cmp     #$0A
+	bcc     L002F
+	lda     #$00
+	jmp     L001C
+L002F:	lda     #$01
+L001C:	jsr     bnega
+	beq     L0019
+	inc     _failures
+L0019:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_uminus (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_uminus: near
+
+.segment	"CODE"
+
+	lda     _int0
+	ldx     _int0+1
+	jsr     negax
+	sta     _int1
+	stx     _int1+1
+	cpx     #$80
+	bcc     L0002
+	inc     _failures
+L0002:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     _c_char
+	jsr     _c_int
+	jsr     _c_long
+	lda     #$FF
+	sta     _int0
+	sta     _int0+1
+	jsr     _c_uminus
+	lda     _int1+1
+	bne     L0004
+	lda     _int1
+	cmp     #$01
+	beq     L0002
+L0004:	inc     _failures
+L0002:	lda     _failures
+	sta     _success
+	jsr     _done
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     _failures
+	rts
+
+.endproc
+
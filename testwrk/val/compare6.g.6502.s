@@ -0,0 +1,822 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "compare6.c", 2295, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/limits.h", 3146, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_success
+	.export		_failures
+	.export		_dummy
+	.export		_int0
+	.export		_int1
+	.export		_uchar0
+	.export		_uchar1
+	.export		_char0
+	.export		_char1
+	.export		_long0
+	.export		_long1
+	.export		_done
+	.export		_c_char
+	.export		_c_int
+	.export		_c_long
+	.export		_c_uminus
+	.export		_main
+
+.segment	"DATA"
+
+_success:
+	.byte	$00
+_failures:
+	.byte	$00
+_dummy:
+	.byte	$00
+_int0:
+	.word	$0000
+_int1:
+	.word	$0000
+_uchar0:
+	.byte	$00
+_uchar1:
+	.byte	$00
+_char0:
+	.byte	$00
+_char1:
+	.byte	$00
+_long0:
+	.byte	$00
+_long1:
+	.byte	$00
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ done (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_done: near
+
+	.dbg	func, "done", "00", extern, "_done"
+
+.segment	"CODE"
+
+	.dbg	line, "compare6.c", 29
+	ldx     #$00
+	lda     _dummy
+	inc     _dummy
+	.dbg	line, "compare6.c", 30
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_char (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_char: near
+
+	.dbg	func, "c_char", "00", extern, "_c_char"
+
+.segment	"CODE"
+
+	.dbg	line, "compare6.c", 34
+	lda     _char0
+	jne     L0003
+	lda     _char1
+	jne     L0003
+	ldx     #$00
+	lda     #$00
+	jeq     L0004
+L0003:	ldx     #$00
+	lda     #$01
+L0004:	jeq     L0002
+	.dbg	line, "compare6.c", 35
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare6.c", 37
+L0002:	lda     _char0
+	jeq     L0006
+	lda     _char1
+	jne     L0007
+L0006:	ldx     #$00
+	lda     #$00
+	jeq     L0008
+L0007:	ldx     #$00
+	lda     #$01
+L0008:	jeq     L0005
+	.dbg	line, "compare6.c", 38
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare6.c", 40
+L0005:	ldx     #$00
+	lda     _char0
+	jsr     pushax
+	ldx     #$00
+	lda     _char1
+	jsr     tosugtax
+	jeq     L0009
+	.dbg	line, "compare6.c", 41
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare6.c", 43
+L0009:	ldx     #$00
+	lda     _char0
+	jsr     incax1
+	jsr     pushax
+	ldx     #$00
+	lda     _char1
+	jsr     tosltax
+	jeq     L000A
+	.dbg	line, "compare6.c", 44
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare6.c", 46
+L000A:	ldx     #$00
+	lda     _char0
+	jsr     incax5
+	jsr     pushax
+	ldx     #$00
+	lda     _char1
+	ldy     #$09
+	jsr     incaxy
+	jsr     tosgeax
+	jeq     L000B
+	.dbg	line, "compare6.c", 47
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare6.c", 49
+L000B:	ldx     #$00
+	lda     _char0
+	inc     _char0
+	.dbg	line, "compare6.c", 51
+	lda     _char0
+	jeq     L000D
+	lda     _char1
+	jne     L000E
+L000D:	ldx     #$00
+	lda     #$00
+	jeq     L000F
+L000E:	ldx     #$00
+	lda     #$01
+L000F:	jeq     L000C
+	.dbg	line, "compare6.c", 52
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare6.c", 54
+L000C:	ldx     #$00
+	lda     _char0
+	jsr     pushax
+	ldx     #$00
+	lda     _char1
+	jsr     incax1
+	jsr     tosneax
+	jeq     L0010
+	.dbg	line, "compare6.c", 55
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare6.c", 57
+L0010:	ldx     #$00
+	lda     _char0
+	jsr     bnega
+	jeq     L0011
+	.dbg	line, "compare6.c", 58
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare6.c", 60
+L0011:	lda     _char1
+	jne     L0013
+	ldx     #$00
+	lda     _char0
+	jsr     bnega
+	jne     L0013
+	ldx     #$00
+	lda     #$00
+	jeq     L0014
+L0013:	ldx     #$00
+	lda     #$01
+L0014:	jeq     L0012
+	.dbg	line, "compare6.c", 61
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare6.c", 63
+L0012:	ldx     #$00
+	lda     _char0
+	cmp     #$06
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0016
+	ldx     #$00
+	lda     _char0
+	cmp     #$0A
+	jsr     boolult
+	jne     L0017
+L0016:	ldx     #$00
+	lda     #$00
+	jeq     L0018
+L0017:	ldx     #$00
+	lda     #$01
+L0018:	jeq     L0015
+	.dbg	line, "compare6.c", 64
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare6.c", 66
+L0015:	ldx     #$00
+	lda     #$05
+	clc
+	adc     _char0
+	sta     _char0
+	.dbg	line, "compare6.c", 68
+	ldx     #$00
+	lda     _char0
+	cmp     #$06
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L001A
+	ldx     #$00
+	lda     _char0
+	cmp     #$0A
+	jsr     boolult
+	jne     L001B
+L001A:	ldx     #$00
+	lda     #$00
+	jeq     L001C
+L001B:	ldx     #$00
+	lda     #$01
+L001C:	jsr     bnegax
+	jeq     L0019
+	.dbg	line, "compare6.c", 69
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare6.c", 70
+L0019:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_int (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_int: near
+
+	.dbg	func, "c_int", "00", extern, "_c_int"
+
+.segment	"CODE"
+
+	.dbg	line, "compare6.c", 74
+	lda     _int0
+	ora     _int0+1
+	jne     L0003
+	lda     _int1
+	ora     _int1+1
+	jne     L0003
+	ldx     #$00
+	lda     #$00
+	jeq     L0004
+L0003:	ldx     #$00
+	lda     #$01
+L0004:	jeq     L0002
+	.dbg	line, "compare6.c", 75
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare6.c", 77
+L0002:	lda     _int0
+	ora     _int0+1
+	jeq     L0006
+	lda     _int1
+	ora     _int1+1
+	jne     L0007
+L0006:	ldx     #$00
+	lda     #$00
+	jeq     L0008
+L0007:	ldx     #$00
+	lda     #$01
+L0008:	jeq     L0005
+	.dbg	line, "compare6.c", 78
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare6.c", 80
+L0005:	lda     _int0
+	ldx     _int0+1
+	jsr     pushax
+	lda     _int1
+	ldx     _int1+1
+	jsr     tosgtax
+	jeq     L0009
+	.dbg	line, "compare6.c", 81
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare6.c", 83
+L0009:	lda     _int0
+	ldx     _int0+1
+	jsr     incax1
+	jsr     pushax
+	lda     _int1
+	ldx     _int1+1
+	jsr     tosltax
+	jeq     L000A
+	.dbg	line, "compare6.c", 84
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare6.c", 86
+L000A:	lda     _int0
+	ldx     _int0+1
+	jsr     incax5
+	jsr     pushax
+	lda     _int1
+	ldx     _int1+1
+	ldy     #$09
+	jsr     incaxy
+	jsr     tosgeax
+	jeq     L000B
+	.dbg	line, "compare6.c", 87
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare6.c", 89
+L000B:	lda     _int0
+	ldx     _int0+1
+	inc     _int0
+	bne     L000C
+	inc     _int0+1
+L000C:	lda     _int0
+	ldx     _int0+1
+	.dbg	line, "compare6.c", 91
+	lda     _int0
+	ora     _int0+1
+	jeq     L000E
+	lda     _int1
+	ora     _int1+1
+	jne     L000F
+L000E:	ldx     #$00
+	lda     #$00
+	jeq     L0010
+L000F:	ldx     #$00
+	lda     #$01
+L0010:	jeq     L000D
+	.dbg	line, "compare6.c", 92
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare6.c", 94
+L000D:	lda     _int0
+	ldx     _int0+1
+	jsr     pushax
+	lda     _int1
+	ldx     _int1+1
+	jsr     incax1
+	jsr     tosneax
+	jeq     L0011
+	.dbg	line, "compare6.c", 95
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare6.c", 97
+L0011:	lda     _int0
+	ldx     _int0+1
+	jsr     bnegax
+	jeq     L0012
+	.dbg	line, "compare6.c", 98
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare6.c", 100
+L0012:	lda     _int1
+	ora     _int1+1
+	jne     L0014
+	lda     _int0
+	ldx     _int0+1
+	jsr     bnegax
+	jne     L0014
+	ldx     #$00
+	lda     #$00
+	jeq     L0015
+L0014:	ldx     #$00
+	lda     #$01
+L0015:	jeq     L0013
+	.dbg	line, "compare6.c", 101
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare6.c", 103
+L0013:	lda     _int0
+	ldx     _int0+1
+	cmp     #$06
+	txa
+	sbc     #$00
+	bvs     L0017
+	eor     #$80
+L0017:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0018
+	lda     _int0
+	ldx     _int0+1
+	cmp     #$0A
+	txa
+	sbc     #$00
+	bvc     L0019
+	eor     #$80
+L0019:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L001A
+L0018:	ldx     #$00
+	lda     #$00
+	jeq     L001B
+L001A:	ldx     #$00
+	lda     #$01
+L001B:	jeq     L0016
+	.dbg	line, "compare6.c", 104
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare6.c", 106
+L0016:	lda     #$05
+	clc
+	adc     _int0
+	sta     _int0
+	bcc     L001C
+	inc     _int0+1
+L001C:	ldx     _int0+1
+	.dbg	line, "compare6.c", 108
+	lda     _int0
+	ldx     _int0+1
+	cmp     #$06
+	txa
+	sbc     #$00
+	bvs     L001E
+	eor     #$80
+L001E:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L001F
+	lda     _int0
+	ldx     _int0+1
+	cmp     #$0A
+	txa
+	sbc     #$00
+	bvc     L0020
+	eor     #$80
+L0020:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0021
+L001F:	ldx     #$00
+	lda     #$00
+	jeq     L0022
+L0021:	ldx     #$00
+	lda     #$01
+L0022:	jsr     bnegax
+	jeq     L001D
+	.dbg	line, "compare6.c", 109
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare6.c", 110
+L001D:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_long (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_long: near
+
+	.dbg	func, "c_long", "00", extern, "_c_long"
+
+.segment	"CODE"
+
+	.dbg	line, "compare6.c", 114
+	lda     _long0
+	jne     L0003
+	lda     _long1
+	jne     L0003
+	ldx     #$00
+	lda     #$00
+	jeq     L0004
+L0003:	ldx     #$00
+	lda     #$01
+L0004:	jeq     L0002
+	.dbg	line, "compare6.c", 115
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare6.c", 117
+L0002:	lda     _long0
+	jeq     L0006
+	lda     _long1
+	jne     L0007
+L0006:	ldx     #$00
+	lda     #$00
+	jeq     L0008
+L0007:	ldx     #$00
+	lda     #$01
+L0008:	jeq     L0005
+	.dbg	line, "compare6.c", 118
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare6.c", 120
+L0005:	ldx     #$00
+	lda     _long0
+	jsr     pushax
+	ldx     #$00
+	lda     _long1
+	jsr     tosugtax
+	jeq     L0009
+	.dbg	line, "compare6.c", 121
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare6.c", 123
+L0009:	ldx     #$00
+	lda     _long0
+	jsr     incax1
+	jsr     pushax
+	ldx     #$00
+	lda     _long1
+	jsr     tosltax
+	jeq     L000A
+	.dbg	line, "compare6.c", 124
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare6.c", 126
+L000A:	ldx     #$00
+	lda     _long0
+	jsr     incax5
+	jsr     pushax
+	ldx     #$00
+	lda     _long1
+	ldy     #$09
+	jsr     incaxy
+	jsr     tosgeax
+	jeq     L000B
+	.dbg	line, "compare6.c", 127
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare6.c", 129
+L000B:	ldx     #$00
+	lda     _long0
+	inc     _long0
+	.dbg	line, "compare6.c", 131
+	lda     _long0
+	jeq     L000D
+	lda     _long1
+	jne     L000E
+L000D:	ldx     #$00
+	lda     #$00
+	jeq     L000F
+L000E:	ldx     #$00
+	lda     #$01
+L000F:	jeq     L000C
+	.dbg	line, "compare6.c", 132
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare6.c", 134
+L000C:	ldx     #$00
+	lda     _long0
+	jsr     pushax
+	ldx     #$00
+	lda     _long1
+	jsr     incax1
+	jsr     tosneax
+	jeq     L0010
+	.dbg	line, "compare6.c", 135
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare6.c", 137
+L0010:	ldx     #$00
+	lda     _long0
+	jsr     bnega
+	jeq     L0011
+	.dbg	line, "compare6.c", 138
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare6.c", 140
+L0011:	lda     _long1
+	jne     L0013
+	ldx     #$00
+	lda     _long0
+	jsr     bnega
+	jne     L0013
+	ldx     #$00
+	lda     #$00
+	jeq     L0014
+L0013:	ldx     #$00
+	lda     #$01
+L0014:	jeq     L0012
+	.dbg	line, "compare6.c", 141
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare6.c", 143
+L0012:	ldx     #$00
+	lda     _long0
+	cmp     #$06
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0016
+	ldx     #$00
+	lda     _long0
+	cmp     #$0A
+	jsr     boolult
+	jne     L0017
+L0016:	ldx     #$00
+	lda     #$00
+	jeq     L0018
+L0017:	ldx     #$00
+	lda     #$01
+L0018:	jeq     L0015
+	.dbg	line, "compare6.c", 144
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare6.c", 146
+L0015:	ldx     #$00
+	lda     #$05
+	clc
+	adc     _long0
+	sta     _long0
+	.dbg	line, "compare6.c", 148
+	ldx     #$00
+	lda     _long0
+	cmp     #$06
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L001A
+	ldx     #$00
+	lda     _long0
+	cmp     #$0A
+	jsr     boolult
+	jne     L001B
+L001A:	ldx     #$00
+	lda     #$00
+	jeq     L001C
+L001B:	ldx     #$00
+	lda     #$01
+L001C:	jsr     bnegax
+	jeq     L0019
+	.dbg	line, "compare6.c", 149
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare6.c", 150
+L0019:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_uminus (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_uminus: near
+
+	.dbg	func, "c_uminus", "00", extern, "_c_uminus"
+
+.segment	"CODE"
+
+	.dbg	line, "compare6.c", 154
+	lda     _int0
+	ldx     _int0+1
+	jsr     negax
+	sta     _int1
+	stx     _int1+1
+	.dbg	line, "compare6.c", 155
+	lda     _int1
+	ldx     _int1+1
+	cpx     #$80
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	.dbg	line, "compare6.c", 156
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare6.c", 157
+L0002:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "compare6.c", 162
+	jsr     _c_char
+	.dbg	line, "compare6.c", 163
+	jsr     _c_int
+	.dbg	line, "compare6.c", 164
+	jsr     _c_long
+	.dbg	line, "compare6.c", 166
+	ldx     #$FF
+	lda     #$FF
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare6.c", 167
+	jsr     _c_uminus
+	.dbg	line, "compare6.c", 168
+	lda     _int1
+	ldx     _int1+1
+	cpx     #$00
+	bne     L0003
+	cmp     #$01
+L0003:	jsr     boolne
+	jeq     L0002
+	.dbg	line, "compare6.c", 169
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare6.c", 171
+L0002:	ldx     #$00
+	lda     _failures
+	sta     _success
+	.dbg	line, "compare6.c", 172
+	jsr     _done
+	.dbg	line, "compare6.c", 173
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "compare6.c", 175
+	ldx     #$00
+	lda     _failures
+	jmp     L0001
+	.dbg	line, "compare6.c", 176
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,1207 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "compare7.c", 4709, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/limits.h", 3146, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_success
+	.export		_failures
+	.export		_dummy
+	.export		_result
+	.export		_int0
+	.export		_int1
+	.export		_char0
+	.export		_char1
+	.export		_long0
+	.export		_long1
+	.export		_done
+	.export		_c_char_lt_lit1
+	.export		_char_compare
+	.export		_c_int_lt_lit1
+	.export		_int_compare1
+	.export		_c_int_lt_lit2
+	.export		_int_compare2
+	.export		_main
+
+.segment	"DATA"
+
+_success:
+	.byte	$00
+_failures:
+	.byte	$00
+_dummy:
+	.byte	$00
+_result:
+	.byte	$00
+_int0:
+	.word	$0000
+_int1:
+	.word	$0000
+_char0:
+	.byte	$00
+_char1:
+	.byte	$00
+_long0:
+	.byte	$00
+_long1:
+	.byte	$00
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+S0003	:=	S0002+0
+S0001	:=	S0002+0
+
+; ---------------------------------------------------------------
+; void __near__ done (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_done: near
+
+	.dbg	func, "done", "00", extern, "_done"
+
+.segment	"CODE"
+
+	.dbg	line, "compare7.c", 39
+	ldx     #$00
+	lda     _dummy
+	inc     _dummy
+	.dbg	line, "compare7.c", 40
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_char_lt_lit1 (unsigned char expected_result)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_char_lt_lit1: near
+
+	.dbg	func, "c_char_lt_lit1", "00", extern, "_c_char_lt_lit1"
+	.dbg	sym, "expected_result", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "compare7.c", 43
+	jsr     pusha
+	.dbg	line, "compare7.c", 44
+	ldx     #$00
+	lda     #$00
+	sta     _result
+	.dbg	line, "compare7.c", 46
+	ldx     #$00
+	lda     _char0
+	bpl     L0003
+	dex
+L0003:	sec
+	sbc     #$81
+	bvc     L0004
+	eor     #$80
+L0004:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	.dbg	line, "compare7.c", 47
+	ldx     #$00
+	lda     _result
+	ora     #$01
+	sta     _result
+	.dbg	line, "compare7.c", 49
+L0002:	ldx     #$00
+	lda     _char0
+	bpl     L0006
+	dex
+L0006:	sec
+	sbc     #$FF
+	bvc     L0007
+	eor     #$80
+L0007:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0005
+	.dbg	line, "compare7.c", 50
+	ldx     #$00
+	lda     _result
+	ora     #$02
+	sta     _result
+	.dbg	line, "compare7.c", 52
+L0005:	ldx     #$00
+	lda     _char0
+	bpl     L0009
+	dex
+L0009:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0008
+	.dbg	line, "compare7.c", 53
+	ldx     #$00
+	lda     _result
+	ora     #$04
+	sta     _result
+	.dbg	line, "compare7.c", 55
+L0008:	ldx     #$00
+	lda     _char0
+	bpl     L000B
+	dex
+L000B:	sec
+	sbc     #$01
+	bvc     L000C
+	eor     #$80
+L000C:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L000A
+	.dbg	line, "compare7.c", 56
+	ldx     #$00
+	lda     _result
+	ora     #$08
+	sta     _result
+	.dbg	line, "compare7.c", 58
+L000A:	ldx     #$00
+	lda     _char0
+	bpl     L000E
+	dex
+L000E:	sec
+	sbc     #$7F
+	bvc     L000F
+	eor     #$80
+L000F:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L000D
+	.dbg	line, "compare7.c", 59
+	ldx     #$00
+	lda     _result
+	ora     #$10
+	sta     _result
+	.dbg	line, "compare7.c", 61
+L000D:	ldx     #$00
+	lda     _result
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosneax
+	jeq     L0010
+	.dbg	line, "compare7.c", 62
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare7.c", 63
+L0010:	jsr     incsp1
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ char_compare (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_char_compare: near
+
+	.dbg	func, "char_compare", "00", extern, "_char_compare"
+
+.segment	"CODE"
+
+	.dbg	line, "compare7.c", 67
+	ldx     #$00
+	lda     #$7F
+	sta     _char0
+	.dbg	line, "compare7.c", 68
+	lda     #$00
+	jsr     _c_char_lt_lit1
+	.dbg	line, "compare7.c", 72
+	ldx     #$00
+	lda     #$7E
+	sta     _char0
+	.dbg	line, "compare7.c", 73
+	lda     #$10
+	jsr     _c_char_lt_lit1
+	.dbg	line, "compare7.c", 75
+	ldx     #$00
+	lda     #$40
+	sta     _char0
+	.dbg	line, "compare7.c", 76
+	lda     #$10
+	jsr     _c_char_lt_lit1
+	.dbg	line, "compare7.c", 78
+	ldx     #$00
+	lda     #$02
+	sta     _char0
+	.dbg	line, "compare7.c", 79
+	lda     #$10
+	jsr     _c_char_lt_lit1
+	.dbg	line, "compare7.c", 81
+	ldx     #$00
+	lda     #$01
+	sta     _char0
+	.dbg	line, "compare7.c", 82
+	lda     #$10
+	jsr     _c_char_lt_lit1
+	.dbg	line, "compare7.c", 84
+	ldx     #$00
+	lda     #$00
+	sta     _char0
+	.dbg	line, "compare7.c", 85
+	lda     #$18
+	jsr     _c_char_lt_lit1
+	.dbg	line, "compare7.c", 87
+	ldx     #$FF
+	lda     #$FF
+	sta     _char0
+	.dbg	line, "compare7.c", 88
+	lda     #$1C
+	jsr     _c_char_lt_lit1
+	.dbg	line, "compare7.c", 90
+	ldx     #$FF
+	lda     #$FE
+	sta     _char0
+	.dbg	line, "compare7.c", 91
+	lda     #$1E
+	jsr     _c_char_lt_lit1
+	.dbg	line, "compare7.c", 93
+	ldx     #$FF
+	lda     #$C0
+	sta     _char0
+	.dbg	line, "compare7.c", 94
+	lda     #$1E
+	jsr     _c_char_lt_lit1
+	.dbg	line, "compare7.c", 96
+	ldx     #$FF
+	lda     #$82
+	sta     _char0
+	.dbg	line, "compare7.c", 97
+	lda     #$1E
+	jsr     _c_char_lt_lit1
+	.dbg	line, "compare7.c", 99
+	ldx     #$FF
+	lda     #$81
+	sta     _char0
+	.dbg	line, "compare7.c", 100
+	lda     #$1E
+	jsr     _c_char_lt_lit1
+	.dbg	line, "compare7.c", 102
+	ldx     #$FF
+	lda     #$80
+	sta     _char0
+	.dbg	line, "compare7.c", 103
+	lda     #$1F
+	jsr     _c_char_lt_lit1
+	.dbg	line, "compare7.c", 107
+	ldx     #$00
+	lda     #$01
+	sta     _char0
+	jmp     L0002
+	.dbg	line, "compare7.c", 108
+L0005:	lda     #$10
+	jsr     _c_char_lt_lit1
+	.dbg	line, "compare7.c", 107
+	ldx     #$00
+	lda     _char0
+	bpl     L0007
+	dex
+L0007:	inc     _char0
+	jmp     L0002
+L0002:	ldx     #$00
+	lda     _char0
+	bpl     L0006
+	dex
+L0006:	cmp     #$7F
+	jsr     boolne
+	jne     L0005
+	.dbg	line, "compare7.c", 110
+	ldx     #$FF
+	lda     #$81
+	sta     _char0
+	jmp     L0008
+	.dbg	line, "compare7.c", 111
+L000B:	lda     #$1E
+	jsr     _c_char_lt_lit1
+	.dbg	line, "compare7.c", 110
+	ldx     #$00
+	lda     _char0
+	bpl     L000D
+	dex
+L000D:	inc     _char0
+	jmp     L0008
+L0008:	ldx     #$00
+	lda     _char0
+	bpl     L000C
+	dex
+L000C:	cmp     #$FF
+	jsr     boolne
+	jne     L000B
+	.dbg	line, "compare7.c", 112
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_int_lt_lit1 (unsigned char expected_result)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_int_lt_lit1: near
+
+	.dbg	func, "c_int_lt_lit1", "00", extern, "_c_int_lt_lit1"
+	.dbg	sym, "expected_result", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "compare7.c", 115
+	jsr     pusha
+	.dbg	line, "compare7.c", 116
+	ldx     #$00
+	lda     #$00
+	sta     _result
+	.dbg	line, "compare7.c", 118
+	lda     _int0
+	ldx     _int0+1
+	cpx     #$80
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	.dbg	line, "compare7.c", 119
+	ldx     #$00
+	lda     _result
+	ora     #$01
+	sta     _result
+	.dbg	line, "compare7.c", 121
+L0002:	lda     _int0
+	ldx     _int0+1
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0004
+	eor     #$80
+L0004:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0003
+	.dbg	line, "compare7.c", 122
+	ldx     #$00
+	lda     _result
+	ora     #$02
+	sta     _result
+	.dbg	line, "compare7.c", 124
+L0003:	lda     _int0
+	ldx     _int0+1
+	cmp     #$FF
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0005
+	.dbg	line, "compare7.c", 125
+	ldx     #$00
+	lda     _result
+	ora     #$04
+	sta     _result
+	.dbg	line, "compare7.c", 127
+L0005:	lda     _int0
+	ldx     _int0+1
+	cmp     #$00
+	txa
+	sbc     #$01
+	bvc     L0008
+	eor     #$80
+L0008:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0007
+	.dbg	line, "compare7.c", 128
+	ldx     #$00
+	lda     _result
+	ora     #$08
+	sta     _result
+	.dbg	line, "compare7.c", 130
+L0007:	lda     _int0
+	ldx     _int0+1
+	cmp     #$01
+	txa
+	sbc     #$01
+	bvc     L000A
+	eor     #$80
+L000A:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0009
+	.dbg	line, "compare7.c", 131
+	ldx     #$00
+	lda     _result
+	ora     #$10
+	sta     _result
+	.dbg	line, "compare7.c", 133
+L0009:	lda     _int0
+	ldx     _int0+1
+	cmp     #$FF
+	txa
+	sbc     #$01
+	bvc     L000C
+	eor     #$80
+L000C:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L000B
+	.dbg	line, "compare7.c", 134
+	ldx     #$00
+	lda     _result
+	ora     #$20
+	sta     _result
+	.dbg	line, "compare7.c", 136
+L000B:	lda     _int0
+	ldx     _int0+1
+	cmp     #$00
+	txa
+	sbc     #$02
+	bvc     L000E
+	eor     #$80
+L000E:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L000D
+	.dbg	line, "compare7.c", 137
+	ldx     #$00
+	lda     _result
+	ora     #$40
+	sta     _result
+	.dbg	line, "compare7.c", 139
+L000D:	lda     _int0
+	ldx     _int0+1
+	cmp     #$01
+	txa
+	sbc     #$02
+	bvc     L0010
+	eor     #$80
+L0010:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L000F
+	.dbg	line, "compare7.c", 140
+	ldx     #$00
+	lda     _result
+	ora     #$80
+	sta     _result
+	.dbg	line, "compare7.c", 142
+L000F:	ldx     #$00
+	lda     _result
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosneax
+	jeq     L0011
+	.dbg	line, "compare7.c", 143
+	ldx     #$00
+	lda     #$01
+	sta     _failures
+	.dbg	line, "compare7.c", 144
+L0011:	jsr     incsp1
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_compare1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_compare1: near
+
+	.dbg	func, "int_compare1", "00", extern, "_int_compare1"
+
+.segment	"CODE"
+
+	.dbg	line, "compare7.c", 148
+	ldx     #$FF
+	lda     #$FF
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare7.c", 149
+	lda     #$FF
+	jsr     _c_int_lt_lit1
+	.dbg	line, "compare7.c", 151
+	ldx     #$00
+	lda     #$00
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare7.c", 152
+	lda     #$FE
+	jsr     _c_int_lt_lit1
+	.dbg	line, "compare7.c", 154
+	ldx     #$00
+	lda     #$01
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare7.c", 155
+	lda     #$FC
+	jsr     _c_int_lt_lit1
+	.dbg	line, "compare7.c", 157
+	ldx     #$00
+	lda     #$02
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare7.c", 158
+	lda     #$FC
+	jsr     _c_int_lt_lit1
+	.dbg	line, "compare7.c", 160
+	ldx     #$00
+	lda     #$FE
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare7.c", 161
+	lda     #$FC
+	jsr     _c_int_lt_lit1
+	.dbg	line, "compare7.c", 163
+	ldx     #$00
+	lda     #$FF
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare7.c", 164
+	lda     #$F8
+	jsr     _c_int_lt_lit1
+	.dbg	line, "compare7.c", 166
+	ldx     #$01
+	lda     #$00
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare7.c", 167
+	lda     #$F0
+	jsr     _c_int_lt_lit1
+	.dbg	line, "compare7.c", 169
+	ldx     #$01
+	lda     #$01
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare7.c", 170
+	lda     #$E0
+	jsr     _c_int_lt_lit1
+	.dbg	line, "compare7.c", 172
+	ldx     #$01
+	lda     #$FE
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare7.c", 173
+	lda     #$E0
+	jsr     _c_int_lt_lit1
+	.dbg	line, "compare7.c", 175
+	ldx     #$01
+	lda     #$FF
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare7.c", 176
+	lda     #$C0
+	jsr     _c_int_lt_lit1
+	.dbg	line, "compare7.c", 178
+	ldx     #$02
+	lda     #$00
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare7.c", 179
+	lda     #$80
+	jsr     _c_int_lt_lit1
+	.dbg	line, "compare7.c", 181
+	ldx     #$02
+	lda     #$01
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare7.c", 182
+	lda     #$00
+	jsr     _c_int_lt_lit1
+	.dbg	line, "compare7.c", 184
+	ldx     #$7F
+	lda     #$00
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare7.c", 185
+	lda     #$00
+	jsr     _c_int_lt_lit1
+	.dbg	line, "compare7.c", 189
+	ldx     #$80
+	lda     #$01
+	sta     _int0
+	stx     _int0+1
+	jmp     L0002
+	.dbg	line, "compare7.c", 190
+L0005:	lda     #$FF
+	jsr     _c_int_lt_lit1
+	.dbg	line, "compare7.c", 189
+	lda     _int0
+	ldx     _int0+1
+	inc     _int0
+	bne     L0007
+	inc     _int0+1
+L0007:	lda     _int0
+	ldx     _int0+1
+	jmp     L0002
+L0002:	lda     _int0
+	ldx     _int0+1
+	cpx     #$FF
+	bne     L0006
+	cmp     #$FF
+L0006:	jsr     boolne
+	jne     L0005
+	.dbg	line, "compare7.c", 192
+	ldx     #$00
+	lda     #$01
+	sta     _int0
+	stx     _int0+1
+	jmp     L0008
+	.dbg	line, "compare7.c", 193
+L000B:	lda     #$FC
+	jsr     _c_int_lt_lit1
+	.dbg	line, "compare7.c", 192
+	lda     _int0
+	ldx     _int0+1
+	inc     _int0
+	bne     L000D
+	inc     _int0+1
+L000D:	lda     _int0
+	ldx     _int0+1
+	jmp     L0008
+L0008:	lda     _int0
+	ldx     _int0+1
+	cpx     #$00
+	bne     L000C
+	cmp     #$FF
+L000C:	jsr     boolne
+	jne     L000B
+	.dbg	line, "compare7.c", 195
+	ldx     #$02
+	lda     #$01
+	sta     _int0
+	stx     _int0+1
+	jmp     L000E
+	.dbg	line, "compare7.c", 196
+L0011:	lda     #$00
+	jsr     _c_int_lt_lit1
+	.dbg	line, "compare7.c", 195
+	lda     _int0
+	ldx     _int0+1
+	inc     _int0
+	bne     L0013
+	inc     _int0+1
+L0013:	lda     _int0
+	ldx     _int0+1
+	jmp     L000E
+L000E:	lda     _int0
+	ldx     _int0+1
+	cpx     #$7F
+	bne     L0012
+	cmp     #$FF
+L0012:	jsr     boolne
+	jne     L0011
+	.dbg	line, "compare7.c", 197
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_int_lt_lit2 (unsigned char expected_result)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_int_lt_lit2: near
+
+	.dbg	func, "c_int_lt_lit2", "00", extern, "_c_int_lt_lit2"
+	.dbg	sym, "expected_result", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "compare7.c", 200
+	jsr     pusha
+	.dbg	line, "compare7.c", 201
+	ldx     #$00
+	lda     #$00
+	sta     _result
+	.dbg	line, "compare7.c", 203
+	lda     _int0
+	ldx     _int0+1
+	cmp     #$01
+	txa
+	sbc     #$80
+	bvc     L0003
+	eor     #$80
+L0003:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	.dbg	line, "compare7.c", 204
+	ldx     #$00
+	lda     _result
+	ora     #$01
+	sta     _result
+	.dbg	line, "compare7.c", 206
+L0002:	lda     _int0
+	ldx     _int0+1
+	cmp     #$00
+	txa
+	sbc     #$81
+	bvc     L0005
+	eor     #$80
+L0005:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0004
+	.dbg	line, "compare7.c", 207
+	ldx     #$00
+	lda     _result
+	ora     #$02
+	sta     _result
+	.dbg	line, "compare7.c", 209
+L0004:	lda     _int0
+	ldx     _int0+1
+	cmp     #$01
+	txa
+	sbc     #$81
+	bvc     L0007
+	eor     #$80
+L0007:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0006
+	.dbg	line, "compare7.c", 210
+	ldx     #$00
+	lda     _result
+	ora     #$04
+	sta     _result
+	.dbg	line, "compare7.c", 212
+L0006:	lda     _int0
+	ldx     _int0+1
+	cmp     #$00
+	txa
+	sbc     #$82
+	bvc     L0009
+	eor     #$80
+L0009:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0008
+	.dbg	line, "compare7.c", 213
+	ldx     #$00
+	lda     _result
+	ora     #$08
+	sta     _result
+	.dbg	line, "compare7.c", 215
+L0008:	lda     _int0
+	ldx     _int0+1
+	cmp     #$FF
+	txa
+	sbc     #$FE
+	bvc     L000B
+	eor     #$80
+L000B:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L000A
+	.dbg	line, "compare7.c", 216
+	ldx     #$00
+	lda     _result
+	ora     #$10
+	sta     _result
+	.dbg	line, "compare7.c", 218
+L000A:	lda     _int0
+	ldx     _int0+1
+	cmp     #$00
+	txa
+	sbc     #$FF
+	bvc     L000D
+	eor     #$80
+L000D:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L000C
+	.dbg	line, "compare7.c", 219
+	ldx     #$00
+	lda     _result
+	ora     #$20
+	sta     _result
+	.dbg	line, "compare7.c", 221
+L000C:	lda     _int0
+	ldx     _int0+1
+	cmp     #$01
+	txa
+	sbc     #$FF
+	bvc     L000F
+	eor     #$80
+L000F:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L000E
+	.dbg	line, "compare7.c", 222
+	ldx     #$00
+	lda     _result
+	ora     #$40
+	sta     _result
+	.dbg	line, "compare7.c", 224
+L000E:	lda     _int0
+	ldx     _int0+1
+	cmp     #$FF
+	txa
+	sbc     #$FF
+	bvc     L0011
+	eor     #$80
+L0011:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0010
+	.dbg	line, "compare7.c", 225
+	ldx     #$00
+	lda     _result
+	ora     #$80
+	sta     _result
+	.dbg	line, "compare7.c", 227
+L0010:	ldx     #$00
+	lda     _result
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosneax
+	jeq     L0012
+	.dbg	line, "compare7.c", 228
+	ldx     #$00
+	lda     #$01
+	sta     _failures
+	.dbg	line, "compare7.c", 229
+L0012:	jsr     incsp1
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_compare2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_compare2: near
+
+	.dbg	func, "int_compare2", "00", extern, "_int_compare2"
+
+.segment	"CODE"
+
+	.dbg	line, "compare7.c", 233
+	ldx     #$80
+	lda     #$01
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare7.c", 234
+	lda     #$FE
+	jsr     _c_int_lt_lit2
+	.dbg	line, "compare7.c", 236
+	ldx     #$81
+	lda     #$00
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare7.c", 237
+	lda     #$FC
+	jsr     _c_int_lt_lit2
+	.dbg	line, "compare7.c", 239
+	ldx     #$81
+	lda     #$01
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare7.c", 240
+	lda     #$F8
+	jsr     _c_int_lt_lit2
+	.dbg	line, "compare7.c", 242
+	ldx     #$82
+	lda     #$00
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare7.c", 243
+	lda     #$F0
+	jsr     _c_int_lt_lit2
+	.dbg	line, "compare7.c", 245
+	ldx     #$BA
+	lda     #$99
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare7.c", 246
+	lda     #$F0
+	jsr     _c_int_lt_lit2
+	.dbg	line, "compare7.c", 248
+	ldx     #$FE
+	lda     #$00
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare7.c", 249
+	lda     #$F0
+	jsr     _c_int_lt_lit2
+	.dbg	line, "compare7.c", 251
+	ldx     #$FE
+	lda     #$FE
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare7.c", 252
+	lda     #$F0
+	jsr     _c_int_lt_lit2
+	.dbg	line, "compare7.c", 254
+	ldx     #$FE
+	lda     #$FF
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare7.c", 255
+	lda     #$E0
+	jsr     _c_int_lt_lit2
+	.dbg	line, "compare7.c", 257
+	ldx     #$FF
+	lda     #$00
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare7.c", 258
+	lda     #$C0
+	jsr     _c_int_lt_lit2
+	.dbg	line, "compare7.c", 260
+	ldx     #$FF
+	lda     #$01
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare7.c", 261
+	lda     #$80
+	jsr     _c_int_lt_lit2
+	.dbg	line, "compare7.c", 263
+	ldx     #$FF
+	lda     #$FE
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare7.c", 264
+	lda     #$80
+	jsr     _c_int_lt_lit2
+	.dbg	line, "compare7.c", 266
+	ldx     #$FF
+	lda     #$FF
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare7.c", 267
+	lda     #$00
+	jsr     _c_int_lt_lit2
+	.dbg	line, "compare7.c", 269
+	ldx     #$00
+	lda     #$00
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare7.c", 270
+	lda     #$00
+	jsr     _c_int_lt_lit2
+	.dbg	line, "compare7.c", 272
+	ldx     #$00
+	lda     #$01
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare7.c", 273
+	lda     #$00
+	jsr     _c_int_lt_lit2
+	.dbg	line, "compare7.c", 275
+	ldx     #$7F
+	lda     #$FF
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare7.c", 276
+	lda     #$00
+	jsr     _c_int_lt_lit2
+	.dbg	line, "compare7.c", 279
+	ldx     #$80
+	lda     #$FF
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare7.c", 280
+	lda     #$FE
+	jsr     _c_int_lt_lit2
+	.dbg	line, "compare7.c", 282
+	ldx     #$80
+	lda     #$02
+	sta     _int0
+	stx     _int0+1
+	jmp     L0002
+	.dbg	line, "compare7.c", 283
+L0005:	lda     #$FE
+	jsr     _c_int_lt_lit2
+	.dbg	line, "compare7.c", 282
+	lda     _int0
+	ldx     _int0+1
+	inc     _int0
+	bne     L0007
+	inc     _int0+1
+L0007:	lda     _int0
+	ldx     _int0+1
+	jmp     L0002
+L0002:	lda     _int0
+	ldx     _int0+1
+	cpx     #$80
+	bne     L0006
+	cmp     #$FF
+L0006:	jsr     boolne
+	jne     L0005
+	.dbg	line, "compare7.c", 285
+	ldx     #$82
+	lda     #$00
+	sta     _int0
+	stx     _int0+1
+	jmp     L0008
+	.dbg	line, "compare7.c", 286
+L000B:	lda     #$F0
+	jsr     _c_int_lt_lit2
+	.dbg	line, "compare7.c", 285
+	lda     _int0
+	ldx     _int0+1
+	inc     _int0
+	bne     L000D
+	inc     _int0+1
+L000D:	lda     _int0
+	ldx     _int0+1
+	jmp     L0008
+L0008:	lda     _int0
+	ldx     _int0+1
+	cpx     #$FE
+	bne     L000C
+	cmp     #$FF
+L000C:	jsr     boolne
+	jne     L000B
+	.dbg	line, "compare7.c", 288
+	ldx     #$FF
+	lda     #$FF
+	sta     _int0
+	stx     _int0+1
+	jmp     L000E
+	.dbg	line, "compare7.c", 289
+L0011:	lda     #$00
+	jsr     _c_int_lt_lit2
+	.dbg	line, "compare7.c", 288
+	lda     _int0
+	ldx     _int0+1
+	inc     _int0
+	bne     L0013
+	inc     _int0+1
+L0013:	lda     _int0
+	ldx     _int0+1
+	jmp     L000E
+L000E:	lda     _int0
+	ldx     _int0+1
+	cpx     #$7F
+	bne     L0012
+	cmp     #$FF
+L0012:	jsr     boolne
+	jne     L0011
+	.dbg	line, "compare7.c", 290
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "compare7.c", 295
+	jsr     _char_compare
+	.dbg	line, "compare7.c", 296
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "compare7.c", 298
+	jsr     _int_compare1
+	.dbg	line, "compare7.c", 299
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "compare7.c", 300
+	jsr     _int_compare2
+	.dbg	line, "compare7.c", 302
+	ldx     #$00
+	lda     _failures
+	sta     _success
+	.dbg	line, "compare7.c", 303
+	jsr     _done
+	.dbg	line, "compare7.c", 304
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "compare7.c", 306
+	ldx     #$00
+	lda     _failures
+	jmp     L0001
+	.dbg	line, "compare7.c", 307
+L0001:	rts
+
+	.dbg	line
+.endproc
+
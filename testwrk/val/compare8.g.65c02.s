@@ -0,0 +1,1208 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "compare8.c", 4765, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/limits.h", 3146, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_success
+	.export		_failures
+	.export		_dummy
+	.export		_result
+	.export		_int0
+	.export		_int1
+	.export		_uchar0
+	.export		_uchar1
+	.export		_char0
+	.export		_char1
+	.export		_long0
+	.export		_long1
+	.export		_done
+	.export		_c_char_gt_lit1
+	.export		_char_compare
+	.export		_c_int_gt_lit1
+	.export		_int_compare1
+	.export		_c_int_gt_lit2
+	.export		_int_compare2
+	.export		_main
+
+.segment	"DATA"
+
+_success:
+	.byte	$00
+_failures:
+	.byte	$00
+_dummy:
+	.byte	$00
+_result:
+	.byte	$00
+_int0:
+	.word	$0000
+_int1:
+	.word	$0000
+_uchar0:
+	.byte	$00
+_uchar1:
+	.byte	$00
+_char0:
+	.byte	$00
+_char1:
+	.byte	$00
+_long0:
+	.byte	$00
+_long1:
+	.byte	$00
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ done (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_done: near
+
+	.dbg	func, "done", "00", extern, "_done"
+
+.segment	"CODE"
+
+	.dbg	line, "compare8.c", 41
+	ldx     #$00
+	lda     _dummy
+	inc     _dummy
+	.dbg	line, "compare8.c", 42
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_char_gt_lit1 (unsigned char expected_result)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_char_gt_lit1: near
+
+	.dbg	func, "c_char_gt_lit1", "00", extern, "_c_char_gt_lit1"
+	.dbg	sym, "expected_result", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "compare8.c", 45
+	jsr     pusha
+	.dbg	line, "compare8.c", 46
+	ldx     #$00
+	lda     #$00
+	sta     _result
+	.dbg	line, "compare8.c", 48
+	ldx     #$00
+	lda     _char0
+	bpl     L0003
+	dex
+L0003:	sec
+	sbc     #$82
+	bvs     L0004
+	eor     #$80
+L0004:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	.dbg	line, "compare8.c", 49
+	ldx     #$00
+	lda     _result
+	ora     #$01
+	sta     _result
+	.dbg	line, "compare8.c", 51
+L0002:	ldx     #$00
+	lda     _char0
+	bpl     L0006
+	dex
+L0006:	tax
+	jsr     boolge
+	jeq     L0005
+	.dbg	line, "compare8.c", 52
+	ldx     #$00
+	lda     _result
+	ora     #$02
+	sta     _result
+	.dbg	line, "compare8.c", 54
+L0005:	ldx     #$00
+	lda     _char0
+	bpl     L0008
+	dex
+L0008:	sec
+	sbc     #$01
+	bvs     L0009
+	eor     #$80
+L0009:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0007
+	.dbg	line, "compare8.c", 55
+	ldx     #$00
+	lda     _result
+	ora     #$04
+	sta     _result
+	.dbg	line, "compare8.c", 57
+L0007:	ldx     #$00
+	lda     _char0
+	bpl     L000B
+	dex
+L000B:	sec
+	sbc     #$02
+	bvs     L000C
+	eor     #$80
+L000C:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L000A
+	.dbg	line, "compare8.c", 58
+	ldx     #$00
+	lda     _result
+	ora     #$08
+	sta     _result
+	.dbg	line, "compare8.c", 60
+L000A:	ldx     #$00
+	lda     _char0
+	bpl     L000E
+	dex
+L000E:	sec
+	sbc     #$7F
+	bvs     L000F
+	eor     #$80
+L000F:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L000D
+	.dbg	line, "compare8.c", 61
+	ldx     #$00
+	lda     _result
+	ora     #$10
+	sta     _result
+	.dbg	line, "compare8.c", 63
+L000D:	ldx     #$00
+	lda     _char0
+	bpl     L0011
+	dex
+L0011:	jmp     L0010
+	.dbg	line, "compare8.c", 64
+	ldx     #$00
+	lda     _result
+	ora     #$20
+	sta     _result
+	.dbg	line, "compare8.c", 66
+L0010:	ldx     #$00
+	lda     _result
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosneax
+	jeq     L0012
+	.dbg	line, "compare8.c", 67
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare8.c", 68
+L0012:	jsr     incsp1
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ char_compare (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_char_compare: near
+
+	.dbg	func, "char_compare", "00", extern, "_char_compare"
+
+.segment	"CODE"
+
+	.dbg	line, "compare8.c", 72
+	ldx     #$00
+	lda     #$7F
+	sta     _char0
+	.dbg	line, "compare8.c", 73
+	lda     #$1F
+	jsr     _c_char_gt_lit1
+	.dbg	line, "compare8.c", 75
+	ldx     #$00
+	lda     #$7E
+	sta     _char0
+	.dbg	line, "compare8.c", 76
+	lda     #$0F
+	jsr     _c_char_gt_lit1
+	.dbg	line, "compare8.c", 78
+	ldx     #$00
+	lda     #$40
+	sta     _char0
+	.dbg	line, "compare8.c", 79
+	lda     #$0F
+	jsr     _c_char_gt_lit1
+	.dbg	line, "compare8.c", 81
+	ldx     #$00
+	lda     #$02
+	sta     _char0
+	.dbg	line, "compare8.c", 82
+	lda     #$0F
+	jsr     _c_char_gt_lit1
+	.dbg	line, "compare8.c", 84
+	ldx     #$00
+	lda     #$01
+	sta     _char0
+	.dbg	line, "compare8.c", 85
+	lda     #$07
+	jsr     _c_char_gt_lit1
+	.dbg	line, "compare8.c", 87
+	ldx     #$00
+	lda     #$00
+	sta     _char0
+	.dbg	line, "compare8.c", 88
+	lda     #$03
+	jsr     _c_char_gt_lit1
+	.dbg	line, "compare8.c", 90
+	ldx     #$FF
+	lda     #$FF
+	sta     _char0
+	.dbg	line, "compare8.c", 91
+	lda     #$01
+	jsr     _c_char_gt_lit1
+	.dbg	line, "compare8.c", 93
+	ldx     #$FF
+	lda     #$FE
+	sta     _char0
+	.dbg	line, "compare8.c", 94
+	lda     #$01
+	jsr     _c_char_gt_lit1
+	.dbg	line, "compare8.c", 96
+	ldx     #$FF
+	lda     #$C0
+	sta     _char0
+	.dbg	line, "compare8.c", 97
+	lda     #$01
+	jsr     _c_char_gt_lit1
+	.dbg	line, "compare8.c", 99
+	ldx     #$FF
+	lda     #$82
+	sta     _char0
+	.dbg	line, "compare8.c", 100
+	lda     #$01
+	jsr     _c_char_gt_lit1
+	.dbg	line, "compare8.c", 102
+	ldx     #$FF
+	lda     #$81
+	sta     _char0
+	.dbg	line, "compare8.c", 103
+	lda     #$00
+	jsr     _c_char_gt_lit1
+	.dbg	line, "compare8.c", 105
+	ldx     #$FF
+	lda     #$80
+	sta     _char0
+	.dbg	line, "compare8.c", 106
+	lda     #$00
+	jsr     _c_char_gt_lit1
+	.dbg	line, "compare8.c", 110
+	ldx     #$00
+	lda     #$02
+	sta     _char0
+	jmp     L0002
+	.dbg	line, "compare8.c", 111
+L0005:	lda     #$0F
+	jsr     _c_char_gt_lit1
+	.dbg	line, "compare8.c", 110
+	ldx     #$00
+	lda     _char0
+	bpl     L0007
+	dex
+L0007:	inc     _char0
+	jmp     L0002
+L0002:	ldx     #$00
+	lda     _char0
+	bpl     L0006
+	dex
+L0006:	cmp     #$7F
+	jsr     boolne
+	jne     L0005
+	.dbg	line, "compare8.c", 113
+	ldx     #$FF
+	lda     #$82
+	sta     _char0
+	jmp     L0008
+	.dbg	line, "compare8.c", 114
+L000B:	lda     #$01
+	jsr     _c_char_gt_lit1
+	.dbg	line, "compare8.c", 113
+	ldx     #$00
+	lda     _char0
+	bpl     L000D
+	dex
+L000D:	inc     _char0
+	jmp     L0008
+L0008:	ldx     #$00
+	lda     _char0
+	bpl     L000C
+	dex
+L000C:	cmp     #$FF
+	jsr     boolne
+	jne     L000B
+	.dbg	line, "compare8.c", 115
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_int_gt_lit1 (unsigned char expected_result)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_int_gt_lit1: near
+
+	.dbg	func, "c_int_gt_lit1", "00", extern, "_c_int_gt_lit1"
+	.dbg	sym, "expected_result", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "compare8.c", 118
+	jsr     pusha
+	.dbg	line, "compare8.c", 119
+	ldx     #$00
+	lda     #$00
+	sta     _result
+	.dbg	line, "compare8.c", 121
+	lda     _int0
+	ldx     _int0+1
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvs     L0003
+	eor     #$80
+L0003:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	.dbg	line, "compare8.c", 122
+	ldx     #$00
+	lda     _result
+	ora     #$01
+	sta     _result
+	.dbg	line, "compare8.c", 124
+L0002:	lda     _int0
+	ldx     _int0+1
+	cmp     #$02
+	txa
+	sbc     #$00
+	bvs     L0005
+	eor     #$80
+L0005:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0004
+	.dbg	line, "compare8.c", 125
+	ldx     #$00
+	lda     _result
+	ora     #$02
+	sta     _result
+	.dbg	line, "compare8.c", 127
+L0004:	lda     _int0
+	ldx     _int0+1
+	cmp     #$00
+	txa
+	sbc     #$01
+	bvs     L0007
+	eor     #$80
+L0007:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0006
+	.dbg	line, "compare8.c", 128
+	ldx     #$00
+	lda     _result
+	ora     #$04
+	sta     _result
+	.dbg	line, "compare8.c", 130
+L0006:	lda     _int0
+	ldx     _int0+1
+	cmp     #$01
+	txa
+	sbc     #$01
+	bvs     L0009
+	eor     #$80
+L0009:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0008
+	.dbg	line, "compare8.c", 131
+	ldx     #$00
+	lda     _result
+	ora     #$08
+	sta     _result
+	.dbg	line, "compare8.c", 133
+L0008:	lda     _int0
+	ldx     _int0+1
+	cmp     #$02
+	txa
+	sbc     #$01
+	bvs     L000B
+	eor     #$80
+L000B:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L000A
+	.dbg	line, "compare8.c", 134
+	ldx     #$00
+	lda     _result
+	ora     #$10
+	sta     _result
+	.dbg	line, "compare8.c", 136
+L000A:	lda     _int0
+	ldx     _int0+1
+	cmp     #$00
+	txa
+	sbc     #$02
+	bvs     L000D
+	eor     #$80
+L000D:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L000C
+	.dbg	line, "compare8.c", 137
+	ldx     #$00
+	lda     _result
+	ora     #$20
+	sta     _result
+	.dbg	line, "compare8.c", 139
+L000C:	lda     _int0
+	ldx     _int0+1
+	cmp     #$01
+	txa
+	sbc     #$02
+	bvs     L000F
+	eor     #$80
+L000F:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L000E
+	.dbg	line, "compare8.c", 140
+	ldx     #$00
+	lda     _result
+	ora     #$40
+	sta     _result
+	.dbg	line, "compare8.c", 142
+L000E:	lda     _int0
+	ldx     _int0+1
+	cmp     #$02
+	txa
+	sbc     #$02
+	bvs     L0011
+	eor     #$80
+L0011:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0010
+	.dbg	line, "compare8.c", 143
+	ldx     #$00
+	lda     _result
+	ora     #$80
+	sta     _result
+	.dbg	line, "compare8.c", 145
+L0010:	ldx     #$00
+	lda     _result
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosneax
+	jeq     L0012
+	.dbg	line, "compare8.c", 146
+	ldx     #$00
+	lda     #$01
+	sta     _failures
+	.dbg	line, "compare8.c", 147
+L0012:	jsr     incsp1
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_compare1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_compare1: near
+
+	.dbg	func, "int_compare1", "00", extern, "_int_compare1"
+
+.segment	"CODE"
+
+	.dbg	line, "compare8.c", 151
+	ldx     #$FF
+	lda     #$FF
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare8.c", 152
+	lda     #$00
+	jsr     _c_int_gt_lit1
+	.dbg	line, "compare8.c", 154
+	ldx     #$00
+	lda     #$00
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare8.c", 155
+	lda     #$00
+	jsr     _c_int_gt_lit1
+	.dbg	line, "compare8.c", 157
+	ldx     #$00
+	lda     #$01
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare8.c", 158
+	lda     #$01
+	jsr     _c_int_gt_lit1
+	.dbg	line, "compare8.c", 160
+	ldx     #$00
+	lda     #$02
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare8.c", 161
+	lda     #$03
+	jsr     _c_int_gt_lit1
+	.dbg	line, "compare8.c", 163
+	ldx     #$00
+	lda     #$FE
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare8.c", 164
+	lda     #$03
+	jsr     _c_int_gt_lit1
+	.dbg	line, "compare8.c", 166
+	ldx     #$00
+	lda     #$FF
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare8.c", 167
+	lda     #$03
+	jsr     _c_int_gt_lit1
+	.dbg	line, "compare8.c", 169
+	ldx     #$01
+	lda     #$00
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare8.c", 170
+	lda     #$07
+	jsr     _c_int_gt_lit1
+	.dbg	line, "compare8.c", 172
+	ldx     #$01
+	lda     #$01
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare8.c", 173
+	lda     #$0F
+	jsr     _c_int_gt_lit1
+	.dbg	line, "compare8.c", 175
+	ldx     #$01
+	lda     #$02
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare8.c", 176
+	lda     #$1F
+	jsr     _c_int_gt_lit1
+	.dbg	line, "compare8.c", 178
+	ldx     #$01
+	lda     #$FE
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare8.c", 179
+	lda     #$1F
+	jsr     _c_int_gt_lit1
+	.dbg	line, "compare8.c", 181
+	ldx     #$01
+	lda     #$FF
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare8.c", 182
+	lda     #$1F
+	jsr     _c_int_gt_lit1
+	.dbg	line, "compare8.c", 184
+	ldx     #$02
+	lda     #$00
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare8.c", 185
+	lda     #$3F
+	jsr     _c_int_gt_lit1
+	.dbg	line, "compare8.c", 187
+	ldx     #$02
+	lda     #$01
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare8.c", 188
+	lda     #$7F
+	jsr     _c_int_gt_lit1
+	.dbg	line, "compare8.c", 190
+	ldx     #$7F
+	lda     #$00
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare8.c", 191
+	lda     #$FF
+	jsr     _c_int_gt_lit1
+	.dbg	line, "compare8.c", 195
+	ldx     #$80
+	lda     #$01
+	sta     _int0
+	stx     _int0+1
+	jmp     L0002
+	.dbg	line, "compare8.c", 196
+L0005:	lda     #$00
+	jsr     _c_int_gt_lit1
+	.dbg	line, "compare8.c", 195
+	lda     _int0
+	ldx     _int0+1
+	inc     _int0
+	bne     L0007
+	inc     _int0+1
+L0007:	lda     _int0
+	ldx     _int0+1
+	jmp     L0002
+L0002:	lda     _int0
+	ldx     _int0+1
+	cpx     #$FF
+	bne     L0006
+	cmp     #$FF
+L0006:	jsr     boolne
+	jne     L0005
+	.dbg	line, "compare8.c", 198
+	ldx     #$00
+	lda     #$02
+	sta     _int0
+	stx     _int0+1
+	jmp     L0008
+	.dbg	line, "compare8.c", 199
+L000B:	lda     #$03
+	jsr     _c_int_gt_lit1
+	.dbg	line, "compare8.c", 198
+	lda     _int0
+	ldx     _int0+1
+	inc     _int0
+	bne     L000D
+	inc     _int0+1
+L000D:	lda     _int0
+	ldx     _int0+1
+	jmp     L0008
+L0008:	lda     _int0
+	ldx     _int0+1
+	cpx     #$00
+	bne     L000C
+	cmp     #$FF
+L000C:	jsr     boolne
+	jne     L000B
+	.dbg	line, "compare8.c", 201
+	ldx     #$02
+	lda     #$02
+	sta     _int0
+	stx     _int0+1
+	jmp     L000E
+	.dbg	line, "compare8.c", 202
+L0011:	lda     #$FF
+	jsr     _c_int_gt_lit1
+	.dbg	line, "compare8.c", 201
+	lda     _int0
+	ldx     _int0+1
+	inc     _int0
+	bne     L0013
+	inc     _int0+1
+L0013:	lda     _int0
+	ldx     _int0+1
+	jmp     L000E
+L000E:	lda     _int0
+	ldx     _int0+1
+	cpx     #$7F
+	bne     L0012
+	cmp     #$FF
+L0012:	jsr     boolne
+	jne     L0011
+	.dbg	line, "compare8.c", 203
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_int_gt_lit2 (unsigned char expected_result)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_int_gt_lit2: near
+
+	.dbg	func, "c_int_gt_lit2", "00", extern, "_c_int_gt_lit2"
+	.dbg	sym, "expected_result", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "compare8.c", 206
+	jsr     pusha
+	.dbg	line, "compare8.c", 207
+	ldx     #$00
+	lda     #$00
+	sta     _result
+	.dbg	line, "compare8.c", 209
+	lda     _int0
+	ldx     _int0+1
+	cmp     #$02
+	txa
+	sbc     #$80
+	bvs     L0003
+	eor     #$80
+L0003:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	.dbg	line, "compare8.c", 210
+	ldx     #$00
+	lda     _result
+	ora     #$01
+	sta     _result
+	.dbg	line, "compare8.c", 212
+L0002:	lda     _int0
+	ldx     _int0+1
+	cmp     #$01
+	txa
+	sbc     #$81
+	bvs     L0005
+	eor     #$80
+L0005:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0004
+	.dbg	line, "compare8.c", 213
+	ldx     #$00
+	lda     _result
+	ora     #$02
+	sta     _result
+	.dbg	line, "compare8.c", 215
+L0004:	lda     _int0
+	ldx     _int0+1
+	cmp     #$02
+	txa
+	sbc     #$81
+	bvs     L0007
+	eor     #$80
+L0007:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0006
+	.dbg	line, "compare8.c", 216
+	ldx     #$00
+	lda     _result
+	ora     #$04
+	sta     _result
+	.dbg	line, "compare8.c", 218
+L0006:	lda     _int0
+	ldx     _int0+1
+	cmp     #$01
+	txa
+	sbc     #$82
+	bvs     L0009
+	eor     #$80
+L0009:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0008
+	.dbg	line, "compare8.c", 219
+	ldx     #$00
+	lda     _result
+	ora     #$08
+	sta     _result
+	.dbg	line, "compare8.c", 221
+L0008:	lda     _int0
+	ldx     _int0+1
+	cmp     #$00
+	txa
+	sbc     #$FF
+	bvs     L000B
+	eor     #$80
+L000B:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L000A
+	.dbg	line, "compare8.c", 222
+	ldx     #$00
+	lda     _result
+	ora     #$10
+	sta     _result
+	.dbg	line, "compare8.c", 224
+L000A:	lda     _int0
+	ldx     _int0+1
+	cmp     #$01
+	txa
+	sbc     #$FF
+	bvs     L000D
+	eor     #$80
+L000D:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L000C
+	.dbg	line, "compare8.c", 225
+	ldx     #$00
+	lda     _result
+	ora     #$20
+	sta     _result
+	.dbg	line, "compare8.c", 227
+L000C:	lda     _int0
+	ldx     _int0+1
+	cmp     #$02
+	txa
+	sbc     #$FF
+	bvs     L000F
+	eor     #$80
+L000F:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L000E
+	.dbg	line, "compare8.c", 228
+	ldx     #$00
+	lda     _result
+	ora     #$40
+	sta     _result
+	.dbg	line, "compare8.c", 230
+L000E:	lda     _int0
+	ldx     _int0+1
+	txa
+	jsr     boolge
+	jeq     L0010
+	.dbg	line, "compare8.c", 231
+	ldx     #$00
+	lda     _result
+	ora     #$80
+	sta     _result
+	.dbg	line, "compare8.c", 233
+L0010:	ldx     #$00
+	lda     _result
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosneax
+	jeq     L0011
+	.dbg	line, "compare8.c", 234
+	ldx     #$00
+	lda     #$01
+	sta     _failures
+	.dbg	line, "compare8.c", 235
+L0011:	jsr     incsp1
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_compare2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_compare2: near
+
+	.dbg	func, "int_compare2", "00", extern, "_int_compare2"
+
+.segment	"CODE"
+
+	.dbg	line, "compare8.c", 239
+	ldx     #$80
+	lda     #$01
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare8.c", 240
+	lda     #$00
+	jsr     _c_int_gt_lit2
+	.dbg	line, "compare8.c", 242
+	ldx     #$81
+	lda     #$00
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare8.c", 243
+	lda     #$01
+	jsr     _c_int_gt_lit2
+	.dbg	line, "compare8.c", 245
+	ldx     #$81
+	lda     #$01
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare8.c", 246
+	lda     #$03
+	jsr     _c_int_gt_lit2
+	.dbg	line, "compare8.c", 248
+	ldx     #$82
+	lda     #$00
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare8.c", 249
+	lda     #$07
+	jsr     _c_int_gt_lit2
+	.dbg	line, "compare8.c", 251
+	ldx     #$82
+	lda     #$01
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare8.c", 252
+	lda     #$0F
+	jsr     _c_int_gt_lit2
+	.dbg	line, "compare8.c", 254
+	ldx     #$BA
+	lda     #$99
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare8.c", 255
+	lda     #$0F
+	jsr     _c_int_gt_lit2
+	.dbg	line, "compare8.c", 257
+	ldx     #$FE
+	lda     #$00
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare8.c", 258
+	lda     #$0F
+	jsr     _c_int_gt_lit2
+	.dbg	line, "compare8.c", 260
+	ldx     #$FE
+	lda     #$FE
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare8.c", 261
+	lda     #$0F
+	jsr     _c_int_gt_lit2
+	.dbg	line, "compare8.c", 263
+	ldx     #$FE
+	lda     #$FF
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare8.c", 264
+	lda     #$0F
+	jsr     _c_int_gt_lit2
+	.dbg	line, "compare8.c", 266
+	ldx     #$FF
+	lda     #$00
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare8.c", 267
+	lda     #$1F
+	jsr     _c_int_gt_lit2
+	.dbg	line, "compare8.c", 269
+	ldx     #$FF
+	lda     #$01
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare8.c", 270
+	lda     #$3F
+	jsr     _c_int_gt_lit2
+	.dbg	line, "compare8.c", 272
+	ldx     #$FF
+	lda     #$FE
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare8.c", 273
+	lda     #$7F
+	jsr     _c_int_gt_lit2
+	.dbg	line, "compare8.c", 275
+	ldx     #$FF
+	lda     #$FF
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare8.c", 276
+	lda     #$7F
+	jsr     _c_int_gt_lit2
+	.dbg	line, "compare8.c", 278
+	ldx     #$00
+	lda     #$00
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare8.c", 279
+	lda     #$FF
+	jsr     _c_int_gt_lit2
+	.dbg	line, "compare8.c", 281
+	ldx     #$00
+	lda     #$01
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare8.c", 282
+	lda     #$FF
+	jsr     _c_int_gt_lit2
+	.dbg	line, "compare8.c", 284
+	ldx     #$7F
+	lda     #$FF
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare8.c", 285
+	lda     #$FF
+	jsr     _c_int_gt_lit2
+	.dbg	line, "compare8.c", 289
+	ldx     #$80
+	lda     #$02
+	sta     _int0
+	stx     _int0+1
+	jmp     L0002
+	.dbg	line, "compare8.c", 290
+L0005:	lda     #$01
+	jsr     _c_int_gt_lit2
+	.dbg	line, "compare8.c", 289
+	lda     _int0
+	ldx     _int0+1
+	inc     _int0
+	bne     L0007
+	inc     _int0+1
+L0007:	lda     _int0
+	ldx     _int0+1
+	jmp     L0002
+L0002:	lda     _int0
+	ldx     _int0+1
+	cpx     #$80
+	bne     L0006
+	cmp     #$FF
+L0006:	jsr     boolne
+	jne     L0005
+	.dbg	line, "compare8.c", 292
+	ldx     #$82
+	lda     #$01
+	sta     _int0
+	stx     _int0+1
+	jmp     L0008
+	.dbg	line, "compare8.c", 293
+L000B:	lda     #$0F
+	jsr     _c_int_gt_lit2
+	.dbg	line, "compare8.c", 292
+	lda     _int0
+	ldx     _int0+1
+	inc     _int0
+	bne     L000D
+	inc     _int0+1
+L000D:	lda     _int0
+	ldx     _int0+1
+	jmp     L0008
+L0008:	lda     _int0
+	ldx     _int0+1
+	cpx     #$FE
+	bne     L000C
+	cmp     #$FF
+L000C:	jsr     boolne
+	jne     L000B
+	.dbg	line, "compare8.c", 295
+	ldx     #$00
+	lda     #$00
+	sta     _int0
+	stx     _int0+1
+	jmp     L000E
+	.dbg	line, "compare8.c", 296
+L0011:	lda     #$FF
+	jsr     _c_int_gt_lit2
+	.dbg	line, "compare8.c", 295
+	lda     _int0
+	ldx     _int0+1
+	inc     _int0
+	bne     L0013
+	inc     _int0+1
+L0013:	lda     _int0
+	ldx     _int0+1
+	jmp     L000E
+L000E:	lda     _int0
+	ldx     _int0+1
+	cpx     #$7F
+	bne     L0012
+	cmp     #$FF
+L0012:	jsr     boolne
+	jne     L0011
+	.dbg	line, "compare8.c", 297
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "compare8.c", 302
+	jsr     _char_compare
+	.dbg	line, "compare8.c", 303
+	jsr     _int_compare1
+	.dbg	line, "compare8.c", 304
+	jsr     _int_compare2
+	.dbg	line, "compare8.c", 306
+	ldx     #$00
+	lda     _failures
+	sta     _success
+	.dbg	line, "compare8.c", 307
+	jsr     _done
+	.dbg	line, "compare8.c", 308
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "compare8.c", 310
+	ldx     #$00
+	lda     _failures
+	jmp     L0001
+	.dbg	line, "compare8.c", 311
+L0001:	rts
+
+	.dbg	line
+.endproc
+
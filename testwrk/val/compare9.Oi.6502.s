@@ -0,0 +1,705 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_success
+	.export		_failures
+	.export		_dummy
+	.export		_result
+	.export		_int0
+	.export		_int1
+	.export		_char0
+	.export		_char1
+	.export		_done
+	.export		_c_char_lte_lit1
+	.export		_char_compare
+	.export		_c_int_lte_lit1
+	.export		_int_compare1
+	.export		_c_int_lte_lit2
+	.export		_int_compare2
+	.export		_main
+
+.segment	"DATA"
+
+_success:
+	.byte	$00
+_failures:
+	.byte	$00
+_dummy:
+	.byte	$00
+_result:
+	.byte	$00
+_int0:
+	.word	$0000
+_int1:
+	.word	$0000
+_char0:
+	.byte	$00
+_char1:
+	.byte	$00
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ done (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_done: near
+
+.segment	"CODE"
+
+	inc     _dummy
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_char_lte_lit1 (unsigned char expected_result)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_char_lte_lit1: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	lda     #$00
+	sta     _result
+	lda     _char0
+	sec
+	sbc     #$82
+	bvc     L0004
+	eor     #$80
+L0004:	bpl     L0010
+	lda     _result
+	ora     #$01
+	sta     _result
+L0010:	lda     _char0
+	asl     a
+	bcc     L0011
+	lda     _result
+	ora     #$02
+	sta     _result
+L0011:	lda     _char0
+	sec
+	sbc     #$01
+	bvc     L0009
+	eor     #$80
+L0009:	bpl     L0012
+	lda     _result
+	ora     #$04
+	sta     _result
+L0012:	lda     _char0
+	sec
+	sbc     #$02
+	bvc     L000C
+	eor     #$80
+L000C:	bpl     L0013
+	lda     _result
+	ora     #$08
+	sta     _result
+L0013:	lda     _result
+	ora     #$10
+	sta     _result
+	ldy     #$00
+	cmp     (sp),y
+	beq     L000F
+	inc     _failures
+L000F:	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ char_compare (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_char_compare: near
+
+.segment	"CODE"
+
+	lda     #$7F
+	sta     _char0
+	lda     #$10
+	jsr     _c_char_lte_lit1
+	lda     #$7E
+	sta     _char0
+	lda     #$10
+	jsr     _c_char_lte_lit1
+	lda     #$40
+	sta     _char0
+	lda     #$10
+	jsr     _c_char_lte_lit1
+	lda     #$02
+	sta     _char0
+	lda     #$10
+	jsr     _c_char_lte_lit1
+	lda     #$01
+	sta     _char0
+	lda     #$18
+	jsr     _c_char_lte_lit1
+	lda     #$00
+	sta     _char0
+	lda     #$1C
+	jsr     _c_char_lte_lit1
+	lda     #$FF
+	sta     _char0
+	lda     #$1E
+	jsr     _c_char_lte_lit1
+	lda     #$FE
+	sta     _char0
+	lda     #$1E
+	jsr     _c_char_lte_lit1
+	lda     #$C0
+	sta     _char0
+	lda     #$1E
+	jsr     _c_char_lte_lit1
+	lda     #$82
+	sta     _char0
+	lda     #$1E
+	jsr     _c_char_lte_lit1
+	lda     #$81
+	sta     _char0
+	lda     #$1F
+	jsr     _c_char_lte_lit1
+	lda     #$80
+	sta     _char0
+	lda     #$02
+	sta     _char0
+	jmp     L000E
+L0005:	lda     #$10
+	jsr     _c_char_lte_lit1
+	inc     _char0
+L000E:	lda     _char0
+	cmp     #$7F
+	bne     L0005
+	lda     #$82
+	sta     _char0
+	jmp     L0008
+L000B:	lda     #$1E
+	jsr     _c_char_lte_lit1
+	inc     _char0
+L0008:	lda     _char0
+	bne     L000B
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_int_lte_lit1 (unsigned char expected_result)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_int_lte_lit1: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	lda     #$00
+	sta     _result
+	lda     _int0
+	cmp     #$01
+	lda     _int0+1
+	sbc     #$00
+	bvc     L0003
+	eor     #$80
+L0003:	bpl     L0002
+	lda     _result
+	ora     #$01
+	sta     _result
+L0002:	lda     _int0
+	cmp     #$02
+	lda     _int0+1
+	sbc     #$00
+	bvc     L0005
+	eor     #$80
+L0005:	bpl     L0004
+	lda     _result
+	ora     #$02
+	sta     _result
+L0004:	clc
+	lda     #$FF
+	adc     _int0+1
+	bvc     L0007
+	eor     #$80
+L0007:	bpl     L0006
+	lda     _result
+	ora     #$04
+	sta     _result
+L0006:	lda     _int0
+	cmp     #$01
+	lda     _int0+1
+	sbc     #$01
+	bvc     L0009
+	eor     #$80
+L0009:	bpl     L0008
+	lda     _result
+	ora     #$08
+	sta     _result
+L0008:	lda     _int0
+	cmp     #$02
+	lda     _int0+1
+	sbc     #$01
+	bvc     L000B
+	eor     #$80
+L000B:	bpl     L000A
+	lda     _result
+	ora     #$10
+	sta     _result
+L000A:	clc
+	lda     _int0+1
+	sbc     #$01
+	bvc     L000D
+	eor     #$80
+L000D:	bpl     L000C
+	lda     _result
+	ora     #$20
+	sta     _result
+L000C:	lda     _int0
+	cmp     #$01
+	lda     _int0+1
+	sbc     #$02
+	bvc     L000F
+	eor     #$80
+L000F:	bpl     L000E
+	lda     _result
+	ora     #$40
+	sta     _result
+L000E:	lda     _int0
+	cmp     #$02
+	lda     _int0+1
+	sbc     #$02
+	bvc     L0011
+	eor     #$80
+L0011:	bpl     L0013
+	lda     _result
+	ora     #$80
+	sta     _result
+L0013:	lda     _result
+	ldy     #$00
+	cmp     (sp),y
+	beq     L0012
+	lda     #$01
+	sta     _failures
+L0012:	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_compare1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_compare1: near
+
+.segment	"CODE"
+
+	lda     #$FF
+	sta     _int0
+	sta     _int0+1
+	jsr     _c_int_lte_lit1
+	ldx     #$00
+	txa
+	sta     _int0
+	sta     _int0+1
+	lda     #$FF
+	jsr     _c_int_lte_lit1
+	lda     #$01
+	sta     _int0
+	stx     _int0+1
+	lda     #$FE
+	jsr     _c_int_lte_lit1
+	lda     #$02
+	sta     _int0
+	stx     _int0+1
+	lda     #$FC
+	jsr     _c_int_lte_lit1
+	lda     #$FE
+	sta     _int0
+	stx     _int0+1
+	lda     #$FC
+	jsr     _c_int_lte_lit1
+	lda     #$FF
+	sta     _int0
+	stx     _int0+1
+	lda     #$FC
+	jsr     _c_int_lte_lit1
+	inx
+	lda     #$00
+	sta     _int0
+	stx     _int0+1
+	lda     #$F8
+	jsr     _c_int_lte_lit1
+	txa
+	sta     _int0
+	sta     _int0+1
+	lda     #$F0
+	jsr     _c_int_lte_lit1
+	lda     #$FE
+	sta     _int0
+	stx     _int0+1
+	lda     #$E0
+	jsr     _c_int_lte_lit1
+	lda     #$FF
+	sta     _int0
+	stx     _int0+1
+	lda     #$E0
+	jsr     _c_int_lte_lit1
+	inx
+	lda     #$00
+	sta     _int0
+	stx     _int0+1
+	lda     #$C0
+	jsr     _c_int_lte_lit1
+	lda     #$01
+	sta     _int0
+	stx     _int0+1
+	lda     #$80
+	jsr     _c_int_lte_lit1
+	ldx     #$7F
+	lda     #$00
+	sta     _int0
+	stx     _int0+1
+	jsr     _c_int_lte_lit1
+	inx
+	lda     #$01
+	sta     _int0
+	stx     _int0+1
+	jmp     L0002
+L0005:	lda     #$FF
+	jsr     _c_int_lte_lit1
+	inc     _int0
+	bne     L0002
+	inc     _int0+1
+L0002:	lda     _int0+1
+	bne     L0005
+	lda     _int0
+	cmp     #$01
+	bne     L0005
+	ldx     #$00
+	lda     #$02
+	sta     _int0
+	stx     _int0+1
+	jmp     L0008
+L000B:	lda     #$FC
+	jsr     _c_int_lte_lit1
+	inc     _int0
+	bne     L0008
+	inc     _int0+1
+L0008:	lda     _int0+1
+	bne     L000B
+	lda     _int0
+	cmp     #$FF
+	bne     L000B
+	lda     #$02
+	sta     _int0
+	sta     _int0+1
+	jmp     L000E
+L0011:	lda     #$00
+	jsr     _c_int_lte_lit1
+	inc     _int0
+	bne     L000E
+	inc     _int0+1
+L000E:	lda     _int0+1
+	cmp     #$7F
+	bne     L0011
+	lda     _int0
+	cmp     #$FF
+	bne     L0011
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_int_lte_lit2 (unsigned char expected_result)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_int_lte_lit2: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	lda     #$00
+	sta     _result
+	lda     _int0
+	cmp     #$02
+	lda     _int0+1
+	sbc     #$80
+	bvc     L0003
+	eor     #$80
+L0003:	bpl     L0002
+	lda     _result
+	ora     #$01
+	sta     _result
+L0002:	lda     _int0
+	cmp     #$01
+	lda     _int0+1
+	sbc     #$81
+	bvc     L0005
+	eor     #$80
+L0005:	bpl     L0004
+	lda     _result
+	ora     #$02
+	sta     _result
+L0004:	lda     _int0
+	cmp     #$02
+	lda     _int0+1
+	sbc     #$81
+	bvc     L0007
+	eor     #$80
+L0007:	bpl     L0006
+	lda     _result
+	ora     #$04
+	sta     _result
+L0006:	lda     _int0
+	cmp     #$01
+	lda     _int0+1
+	sbc     #$82
+	bvc     L0009
+	eor     #$80
+L0009:	bpl     L0008
+	lda     _result
+	ora     #$08
+	sta     _result
+L0008:	lda     _int0
+	and     #$00
+	sec
+	adc     _int0+1
+	bvc     L000B
+	eor     #$80
+L000B:	bpl     L000A
+	lda     _result
+	ora     #$10
+	sta     _result
+L000A:	lda     _int0
+	cmp     #$01
+	lda     _int0+1
+	sbc     #$FF
+	bvc     L000D
+	eor     #$80
+L000D:	bpl     L000C
+	lda     _result
+	ora     #$20
+	sta     _result
+L000C:	lda     _int0
+	cmp     #$02
+	lda     _int0+1
+	sbc     #$FF
+	bvc     L000F
+	eor     #$80
+L000F:	bpl     L000E
+	lda     _result
+	ora     #$40
+	sta     _result
+L000E:	ldx     _int0+1
+	cpx     #$80
+	bcc     L0012
+	lda     _result
+	ora     #$80
+	sta     _result
+L0012:	lda     _result
+	ldy     #$00
+	cmp     (sp),y
+	beq     L0011
+	lda     #$01
+	sta     _failures
+L0011:	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_compare2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_compare2: near
+
+.segment	"CODE"
+
+	ldx     #$80
+	lda     #$01
+	sta     _int0
+	stx     _int0+1
+	lda     #$FF
+	jsr     _c_int_lte_lit2
+	ldx     #$81
+	lda     #$00
+	sta     _int0
+	stx     _int0+1
+	lda     #$FE
+	jsr     _c_int_lte_lit2
+	ldx     #$81
+	lda     #$01
+	sta     _int0
+	stx     _int0+1
+	lda     #$FC
+	jsr     _c_int_lte_lit2
+	ldx     #$82
+	lda     #$00
+	sta     _int0
+	stx     _int0+1
+	lda     #$F8
+	jsr     _c_int_lte_lit2
+	ldx     #$BA
+	lda     #$99
+	sta     _int0
+	stx     _int0+1
+	lda     #$F0
+	jsr     _c_int_lte_lit2
+	ldx     #$FE
+	lda     #$00
+	sta     _int0
+	stx     _int0+1
+	lda     #$F0
+	jsr     _c_int_lte_lit2
+	lda     #$FE
+	sta     _int0
+	sta     _int0+1
+	lda     #$F0
+	jsr     _c_int_lte_lit2
+	ldx     #$FE
+	lda     #$FF
+	sta     _int0
+	stx     _int0+1
+	lda     #$F0
+	jsr     _c_int_lte_lit2
+	ldx     #$FF
+	lda     #$00
+	sta     _int0
+	stx     _int0+1
+	lda     #$E0
+	jsr     _c_int_lte_lit2
+	ldx     #$FF
+	lda     #$01
+	sta     _int0
+	stx     _int0+1
+	lda     #$C0
+	jsr     _c_int_lte_lit2
+	ldx     #$FF
+	lda     #$FE
+	sta     _int0
+	stx     _int0+1
+	lda     #$80
+	jsr     _c_int_lte_lit2
+	lda     #$FF
+	sta     _int0
+	sta     _int0+1
+	lda     #$80
+	jsr     _c_int_lte_lit2
+	lda     #$00
+	sta     _int0
+	sta     _int0+1
+	jsr     _c_int_lte_lit2
+	ldx     #$00
+	lda     #$01
+	sta     _int0
+	stx     _int0+1
+	txa
+	jsr     _c_int_lte_lit2
+	ldx     #$7F
+	lda     #$FF
+	sta     _int0
+	stx     _int0+1
+	lda     #$00
+	jsr     _c_int_lte_lit2
+	ldx     #$80
+	lda     #$02
+	sta     _int0
+	stx     _int0+1
+	jmp     L0002
+L0005:	lda     #$FE
+	jsr     _c_int_lte_lit2
+	inc     _int0
+	bne     L0002
+	inc     _int0+1
+L0002:	lda     _int0+1
+	cmp     #$81
+	bne     L0005
+	lda     _int0
+	bne     L0005
+	ldx     #$82
+	lda     #$01
+	sta     _int0
+	stx     _int0+1
+	jmp     L0008
+L000B:	lda     #$F0
+	jsr     _c_int_lte_lit2
+	inc     _int0
+	bne     L0008
+	inc     _int0+1
+L0008:	lda     _int0+1
+	cmp     #$FE
+	bne     L000B
+	lda     _int0
+	cmp     #$FF
+	bne     L000B
+	lda     #$00
+	sta     _int0
+	sta     _int0+1
+	jmp     L000E
+L0011:	lda     #$00
+	jsr     _c_int_lte_lit2
+	inc     _int0
+	bne     L000E
+	inc     _int0+1
+L000E:	lda     _int0+1
+	cmp     #$7F
+	bne     L0011
+	lda     _int0
+	cmp     #$FF
+	bne     L0011
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     _char_compare
+	jsr     _int_compare1
+	jsr     _int_compare2
+	lda     _failures
+	sta     _success
+	jsr     _done
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     _failures
+	rts
+
+.endproc
+
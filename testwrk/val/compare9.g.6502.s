@@ -0,0 +1,1161 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "compare9.c", 4593, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/limits.h", 3146, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_success
+	.export		_failures
+	.export		_dummy
+	.export		_result
+	.export		_int0
+	.export		_int1
+	.export		_char0
+	.export		_char1
+	.export		_done
+	.export		_c_char_lte_lit1
+	.export		_char_compare
+	.export		_c_int_lte_lit1
+	.export		_int_compare1
+	.export		_c_int_lte_lit2
+	.export		_int_compare2
+	.export		_main
+
+.segment	"DATA"
+
+_success:
+	.byte	$00
+_failures:
+	.byte	$00
+_dummy:
+	.byte	$00
+_result:
+	.byte	$00
+_int0:
+	.word	$0000
+_int1:
+	.word	$0000
+_char0:
+	.byte	$00
+_char1:
+	.byte	$00
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ done (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_done: near
+
+	.dbg	func, "done", "00", extern, "_done"
+
+.segment	"CODE"
+
+	.dbg	line, "compare9.c", 36
+	ldx     #$00
+	lda     _dummy
+	inc     _dummy
+	.dbg	line, "compare9.c", 37
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_char_lte_lit1 (unsigned char expected_result)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_char_lte_lit1: near
+
+	.dbg	func, "c_char_lte_lit1", "00", extern, "_c_char_lte_lit1"
+	.dbg	sym, "expected_result", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "compare9.c", 40
+	jsr     pusha
+	.dbg	line, "compare9.c", 41
+	ldx     #$00
+	lda     #$00
+	sta     _result
+	.dbg	line, "compare9.c", 43
+	ldx     #$00
+	lda     _char0
+	bpl     L0003
+	dex
+L0003:	sec
+	sbc     #$82
+	bvc     L0004
+	eor     #$80
+L0004:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	.dbg	line, "compare9.c", 44
+	ldx     #$00
+	lda     _result
+	ora     #$01
+	sta     _result
+	.dbg	line, "compare9.c", 46
+L0002:	ldx     #$00
+	lda     _char0
+	bpl     L0006
+	dex
+L0006:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0005
+	.dbg	line, "compare9.c", 47
+	ldx     #$00
+	lda     _result
+	ora     #$02
+	sta     _result
+	.dbg	line, "compare9.c", 49
+L0005:	ldx     #$00
+	lda     _char0
+	bpl     L0008
+	dex
+L0008:	sec
+	sbc     #$01
+	bvc     L0009
+	eor     #$80
+L0009:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0007
+	.dbg	line, "compare9.c", 50
+	ldx     #$00
+	lda     _result
+	ora     #$04
+	sta     _result
+	.dbg	line, "compare9.c", 52
+L0007:	ldx     #$00
+	lda     _char0
+	bpl     L000B
+	dex
+L000B:	sec
+	sbc     #$02
+	bvc     L000C
+	eor     #$80
+L000C:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L000A
+	.dbg	line, "compare9.c", 53
+	ldx     #$00
+	lda     _result
+	ora     #$08
+	sta     _result
+	.dbg	line, "compare9.c", 55
+L000A:	ldx     #$00
+	lda     _char0
+	bpl     L000E
+	dex
+	.dbg	line, "compare9.c", 56
+L000E:	ldx     #$00
+	lda     _result
+	ora     #$10
+	sta     _result
+	.dbg	line, "compare9.c", 58
+	ldx     #$00
+	lda     _result
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosneax
+	jeq     L000F
+	.dbg	line, "compare9.c", 59
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "compare9.c", 60
+L000F:	jsr     incsp1
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ char_compare (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_char_compare: near
+
+	.dbg	func, "char_compare", "00", extern, "_char_compare"
+
+.segment	"CODE"
+
+	.dbg	line, "compare9.c", 64
+	ldx     #$00
+	lda     #$7F
+	sta     _char0
+	.dbg	line, "compare9.c", 65
+	lda     #$10
+	jsr     _c_char_lte_lit1
+	.dbg	line, "compare9.c", 67
+	ldx     #$00
+	lda     #$7E
+	sta     _char0
+	.dbg	line, "compare9.c", 68
+	lda     #$10
+	jsr     _c_char_lte_lit1
+	.dbg	line, "compare9.c", 70
+	ldx     #$00
+	lda     #$40
+	sta     _char0
+	.dbg	line, "compare9.c", 71
+	lda     #$10
+	jsr     _c_char_lte_lit1
+	.dbg	line, "compare9.c", 73
+	ldx     #$00
+	lda     #$02
+	sta     _char0
+	.dbg	line, "compare9.c", 74
+	lda     #$10
+	jsr     _c_char_lte_lit1
+	.dbg	line, "compare9.c", 76
+	ldx     #$00
+	lda     #$01
+	sta     _char0
+	.dbg	line, "compare9.c", 77
+	lda     #$18
+	jsr     _c_char_lte_lit1
+	.dbg	line, "compare9.c", 79
+	ldx     #$00
+	lda     #$00
+	sta     _char0
+	.dbg	line, "compare9.c", 80
+	lda     #$1C
+	jsr     _c_char_lte_lit1
+	.dbg	line, "compare9.c", 82
+	ldx     #$FF
+	lda     #$FF
+	sta     _char0
+	.dbg	line, "compare9.c", 83
+	lda     #$1E
+	jsr     _c_char_lte_lit1
+	.dbg	line, "compare9.c", 85
+	ldx     #$FF
+	lda     #$FE
+	sta     _char0
+	.dbg	line, "compare9.c", 86
+	lda     #$1E
+	jsr     _c_char_lte_lit1
+	.dbg	line, "compare9.c", 88
+	ldx     #$FF
+	lda     #$C0
+	sta     _char0
+	.dbg	line, "compare9.c", 89
+	lda     #$1E
+	jsr     _c_char_lte_lit1
+	.dbg	line, "compare9.c", 91
+	ldx     #$FF
+	lda     #$82
+	sta     _char0
+	.dbg	line, "compare9.c", 92
+	lda     #$1E
+	jsr     _c_char_lte_lit1
+	.dbg	line, "compare9.c", 94
+	ldx     #$FF
+	lda     #$81
+	sta     _char0
+	.dbg	line, "compare9.c", 95
+	lda     #$1F
+	jsr     _c_char_lte_lit1
+	.dbg	line, "compare9.c", 97
+	ldx     #$FF
+	lda     #$80
+	sta     _char0
+	.dbg	line, "compare9.c", 102
+	ldx     #$00
+	lda     #$02
+	sta     _char0
+	jmp     L0002
+	.dbg	line, "compare9.c", 103
+L0005:	lda     #$10
+	jsr     _c_char_lte_lit1
+	.dbg	line, "compare9.c", 102
+	ldx     #$00
+	lda     _char0
+	bpl     L0007
+	dex
+L0007:	inc     _char0
+	jmp     L0002
+L0002:	ldx     #$00
+	lda     _char0
+	bpl     L0006
+	dex
+L0006:	cmp     #$7F
+	jsr     boolne
+	jne     L0005
+	.dbg	line, "compare9.c", 105
+	ldx     #$FF
+	lda     #$82
+	sta     _char0
+	jmp     L0008
+	.dbg	line, "compare9.c", 106
+L000B:	lda     #$1E
+	jsr     _c_char_lte_lit1
+	.dbg	line, "compare9.c", 105
+	ldx     #$00
+	lda     _char0
+	bpl     L000D
+	dex
+L000D:	inc     _char0
+	jmp     L0008
+L0008:	ldx     #$00
+	lda     _char0
+	bpl     L000C
+	dex
+L000C:	cmp     #$00
+	jsr     boolne
+	jne     L000B
+	.dbg	line, "compare9.c", 107
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_int_lte_lit1 (unsigned char expected_result)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_int_lte_lit1: near
+
+	.dbg	func, "c_int_lte_lit1", "00", extern, "_c_int_lte_lit1"
+	.dbg	sym, "expected_result", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "compare9.c", 110
+	jsr     pusha
+	.dbg	line, "compare9.c", 111
+	ldx     #$00
+	lda     #$00
+	sta     _result
+	.dbg	line, "compare9.c", 113
+	lda     _int0
+	ldx     _int0+1
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0003
+	eor     #$80
+L0003:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	.dbg	line, "compare9.c", 114
+	ldx     #$00
+	lda     _result
+	ora     #$01
+	sta     _result
+	.dbg	line, "compare9.c", 116
+L0002:	lda     _int0
+	ldx     _int0+1
+	cmp     #$02
+	txa
+	sbc     #$00
+	bvc     L0005
+	eor     #$80
+L0005:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0004
+	.dbg	line, "compare9.c", 117
+	ldx     #$00
+	lda     _result
+	ora     #$02
+	sta     _result
+	.dbg	line, "compare9.c", 119
+L0004:	lda     _int0
+	ldx     _int0+1
+	cmp     #$00
+	txa
+	sbc     #$01
+	bvc     L0007
+	eor     #$80
+L0007:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0006
+	.dbg	line, "compare9.c", 120
+	ldx     #$00
+	lda     _result
+	ora     #$04
+	sta     _result
+	.dbg	line, "compare9.c", 122
+L0006:	lda     _int0
+	ldx     _int0+1
+	cmp     #$01
+	txa
+	sbc     #$01
+	bvc     L0009
+	eor     #$80
+L0009:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0008
+	.dbg	line, "compare9.c", 123
+	ldx     #$00
+	lda     _result
+	ora     #$08
+	sta     _result
+	.dbg	line, "compare9.c", 125
+L0008:	lda     _int0
+	ldx     _int0+1
+	cmp     #$02
+	txa
+	sbc     #$01
+	bvc     L000B
+	eor     #$80
+L000B:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L000A
+	.dbg	line, "compare9.c", 126
+	ldx     #$00
+	lda     _result
+	ora     #$10
+	sta     _result
+	.dbg	line, "compare9.c", 128
+L000A:	lda     _int0
+	ldx     _int0+1
+	cmp     #$00
+	txa
+	sbc     #$02
+	bvc     L000D
+	eor     #$80
+L000D:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L000C
+	.dbg	line, "compare9.c", 129
+	ldx     #$00
+	lda     _result
+	ora     #$20
+	sta     _result
+	.dbg	line, "compare9.c", 131
+L000C:	lda     _int0
+	ldx     _int0+1
+	cmp     #$01
+	txa
+	sbc     #$02
+	bvc     L000F
+	eor     #$80
+L000F:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L000E
+	.dbg	line, "compare9.c", 132
+	ldx     #$00
+	lda     _result
+	ora     #$40
+	sta     _result
+	.dbg	line, "compare9.c", 134
+L000E:	lda     _int0
+	ldx     _int0+1
+	cmp     #$02
+	txa
+	sbc     #$02
+	bvc     L0011
+	eor     #$80
+L0011:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0010
+	.dbg	line, "compare9.c", 135
+	ldx     #$00
+	lda     _result
+	ora     #$80
+	sta     _result
+	.dbg	line, "compare9.c", 137
+L0010:	ldx     #$00
+	lda     _result
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosneax
+	jeq     L0012
+	.dbg	line, "compare9.c", 138
+	ldx     #$00
+	lda     #$01
+	sta     _failures
+	.dbg	line, "compare9.c", 139
+L0012:	jsr     incsp1
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_compare1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_compare1: near
+
+	.dbg	func, "int_compare1", "00", extern, "_int_compare1"
+
+.segment	"CODE"
+
+	.dbg	line, "compare9.c", 143
+	ldx     #$FF
+	lda     #$FF
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare9.c", 144
+	lda     #$FF
+	jsr     _c_int_lte_lit1
+	.dbg	line, "compare9.c", 146
+	ldx     #$00
+	lda     #$00
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare9.c", 147
+	lda     #$FF
+	jsr     _c_int_lte_lit1
+	.dbg	line, "compare9.c", 149
+	ldx     #$00
+	lda     #$01
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare9.c", 150
+	lda     #$FE
+	jsr     _c_int_lte_lit1
+	.dbg	line, "compare9.c", 152
+	ldx     #$00
+	lda     #$02
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare9.c", 153
+	lda     #$FC
+	jsr     _c_int_lte_lit1
+	.dbg	line, "compare9.c", 155
+	ldx     #$00
+	lda     #$FE
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare9.c", 156
+	lda     #$FC
+	jsr     _c_int_lte_lit1
+	.dbg	line, "compare9.c", 158
+	ldx     #$00
+	lda     #$FF
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare9.c", 159
+	lda     #$FC
+	jsr     _c_int_lte_lit1
+	.dbg	line, "compare9.c", 161
+	ldx     #$01
+	lda     #$00
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare9.c", 162
+	lda     #$F8
+	jsr     _c_int_lte_lit1
+	.dbg	line, "compare9.c", 164
+	ldx     #$01
+	lda     #$01
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare9.c", 165
+	lda     #$F0
+	jsr     _c_int_lte_lit1
+	.dbg	line, "compare9.c", 167
+	ldx     #$01
+	lda     #$FE
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare9.c", 168
+	lda     #$E0
+	jsr     _c_int_lte_lit1
+	.dbg	line, "compare9.c", 170
+	ldx     #$01
+	lda     #$FF
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare9.c", 171
+	lda     #$E0
+	jsr     _c_int_lte_lit1
+	.dbg	line, "compare9.c", 173
+	ldx     #$02
+	lda     #$00
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare9.c", 174
+	lda     #$C0
+	jsr     _c_int_lte_lit1
+	.dbg	line, "compare9.c", 176
+	ldx     #$02
+	lda     #$01
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare9.c", 177
+	lda     #$80
+	jsr     _c_int_lte_lit1
+	.dbg	line, "compare9.c", 179
+	ldx     #$7F
+	lda     #$00
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare9.c", 180
+	lda     #$00
+	jsr     _c_int_lte_lit1
+	.dbg	line, "compare9.c", 184
+	ldx     #$80
+	lda     #$01
+	sta     _int0
+	stx     _int0+1
+	jmp     L0002
+	.dbg	line, "compare9.c", 185
+L0005:	lda     #$FF
+	jsr     _c_int_lte_lit1
+	.dbg	line, "compare9.c", 184
+	lda     _int0
+	ldx     _int0+1
+	inc     _int0
+	bne     L0007
+	inc     _int0+1
+L0007:	lda     _int0
+	ldx     _int0+1
+	jmp     L0002
+L0002:	lda     _int0
+	ldx     _int0+1
+	cpx     #$00
+	bne     L0006
+	cmp     #$01
+L0006:	jsr     boolne
+	jne     L0005
+	.dbg	line, "compare9.c", 187
+	ldx     #$00
+	lda     #$02
+	sta     _int0
+	stx     _int0+1
+	jmp     L0008
+	.dbg	line, "compare9.c", 188
+L000B:	lda     #$FC
+	jsr     _c_int_lte_lit1
+	.dbg	line, "compare9.c", 187
+	lda     _int0
+	ldx     _int0+1
+	inc     _int0
+	bne     L000D
+	inc     _int0+1
+L000D:	lda     _int0
+	ldx     _int0+1
+	jmp     L0008
+L0008:	lda     _int0
+	ldx     _int0+1
+	cpx     #$00
+	bne     L000C
+	cmp     #$FF
+L000C:	jsr     boolne
+	jne     L000B
+	.dbg	line, "compare9.c", 190
+	ldx     #$02
+	lda     #$02
+	sta     _int0
+	stx     _int0+1
+	jmp     L000E
+	.dbg	line, "compare9.c", 191
+L0011:	lda     #$00
+	jsr     _c_int_lte_lit1
+	.dbg	line, "compare9.c", 190
+	lda     _int0
+	ldx     _int0+1
+	inc     _int0
+	bne     L0013
+	inc     _int0+1
+L0013:	lda     _int0
+	ldx     _int0+1
+	jmp     L000E
+L000E:	lda     _int0
+	ldx     _int0+1
+	cpx     #$7F
+	bne     L0012
+	cmp     #$FF
+L0012:	jsr     boolne
+	jne     L0011
+	.dbg	line, "compare9.c", 192
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ c_int_lte_lit2 (unsigned char expected_result)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_c_int_lte_lit2: near
+
+	.dbg	func, "c_int_lte_lit2", "00", extern, "_c_int_lte_lit2"
+	.dbg	sym, "expected_result", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "compare9.c", 195
+	jsr     pusha
+	.dbg	line, "compare9.c", 196
+	ldx     #$00
+	lda     #$00
+	sta     _result
+	.dbg	line, "compare9.c", 198
+	lda     _int0
+	ldx     _int0+1
+	cmp     #$02
+	txa
+	sbc     #$80
+	bvc     L0003
+	eor     #$80
+L0003:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	.dbg	line, "compare9.c", 199
+	ldx     #$00
+	lda     _result
+	ora     #$01
+	sta     _result
+	.dbg	line, "compare9.c", 201
+L0002:	lda     _int0
+	ldx     _int0+1
+	cmp     #$01
+	txa
+	sbc     #$81
+	bvc     L0005
+	eor     #$80
+L0005:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0004
+	.dbg	line, "compare9.c", 202
+	ldx     #$00
+	lda     _result
+	ora     #$02
+	sta     _result
+	.dbg	line, "compare9.c", 204
+L0004:	lda     _int0
+	ldx     _int0+1
+	cmp     #$02
+	txa
+	sbc     #$81
+	bvc     L0007
+	eor     #$80
+L0007:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0006
+	.dbg	line, "compare9.c", 205
+	ldx     #$00
+	lda     _result
+	ora     #$04
+	sta     _result
+	.dbg	line, "compare9.c", 207
+L0006:	lda     _int0
+	ldx     _int0+1
+	cmp     #$01
+	txa
+	sbc     #$82
+	bvc     L0009
+	eor     #$80
+L0009:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0008
+	.dbg	line, "compare9.c", 208
+	ldx     #$00
+	lda     _result
+	ora     #$08
+	sta     _result
+	.dbg	line, "compare9.c", 210
+L0008:	lda     _int0
+	ldx     _int0+1
+	cmp     #$00
+	txa
+	sbc     #$FF
+	bvc     L000B
+	eor     #$80
+L000B:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L000A
+	.dbg	line, "compare9.c", 211
+	ldx     #$00
+	lda     _result
+	ora     #$10
+	sta     _result
+	.dbg	line, "compare9.c", 213
+L000A:	lda     _int0
+	ldx     _int0+1
+	cmp     #$01
+	txa
+	sbc     #$FF
+	bvc     L000D
+	eor     #$80
+L000D:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L000C
+	.dbg	line, "compare9.c", 214
+	ldx     #$00
+	lda     _result
+	ora     #$20
+	sta     _result
+	.dbg	line, "compare9.c", 216
+L000C:	lda     _int0
+	ldx     _int0+1
+	cmp     #$02
+	txa
+	sbc     #$FF
+	bvc     L000F
+	eor     #$80
+L000F:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L000E
+	.dbg	line, "compare9.c", 217
+	ldx     #$00
+	lda     _result
+	ora     #$40
+	sta     _result
+	.dbg	line, "compare9.c", 219
+L000E:	lda     _int0
+	ldx     _int0+1
+	cpx     #$80
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0010
+	.dbg	line, "compare9.c", 220
+	ldx     #$00
+	lda     _result
+	ora     #$80
+	sta     _result
+	.dbg	line, "compare9.c", 222
+L0010:	ldx     #$00
+	lda     _result
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosneax
+	jeq     L0011
+	.dbg	line, "compare9.c", 223
+	ldx     #$00
+	lda     #$01
+	sta     _failures
+	.dbg	line, "compare9.c", 224
+L0011:	jsr     incsp1
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ int_compare2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_int_compare2: near
+
+	.dbg	func, "int_compare2", "00", extern, "_int_compare2"
+
+.segment	"CODE"
+
+	.dbg	line, "compare9.c", 228
+	ldx     #$80
+	lda     #$01
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare9.c", 229
+	lda     #$FF
+	jsr     _c_int_lte_lit2
+	.dbg	line, "compare9.c", 231
+	ldx     #$81
+	lda     #$00
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare9.c", 232
+	lda     #$FE
+	jsr     _c_int_lte_lit2
+	.dbg	line, "compare9.c", 234
+	ldx     #$81
+	lda     #$01
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare9.c", 235
+	lda     #$FC
+	jsr     _c_int_lte_lit2
+	.dbg	line, "compare9.c", 237
+	ldx     #$82
+	lda     #$00
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare9.c", 238
+	lda     #$F8
+	jsr     _c_int_lte_lit2
+	.dbg	line, "compare9.c", 240
+	ldx     #$BA
+	lda     #$99
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare9.c", 241
+	lda     #$F0
+	jsr     _c_int_lte_lit2
+	.dbg	line, "compare9.c", 243
+	ldx     #$FE
+	lda     #$00
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare9.c", 244
+	lda     #$F0
+	jsr     _c_int_lte_lit2
+	.dbg	line, "compare9.c", 246
+	ldx     #$FE
+	lda     #$FE
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare9.c", 247
+	lda     #$F0
+	jsr     _c_int_lte_lit2
+	.dbg	line, "compare9.c", 249
+	ldx     #$FE
+	lda     #$FF
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare9.c", 250
+	lda     #$F0
+	jsr     _c_int_lte_lit2
+	.dbg	line, "compare9.c", 252
+	ldx     #$FF
+	lda     #$00
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare9.c", 253
+	lda     #$E0
+	jsr     _c_int_lte_lit2
+	.dbg	line, "compare9.c", 255
+	ldx     #$FF
+	lda     #$01
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare9.c", 256
+	lda     #$C0
+	jsr     _c_int_lte_lit2
+	.dbg	line, "compare9.c", 258
+	ldx     #$FF
+	lda     #$FE
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare9.c", 259
+	lda     #$80
+	jsr     _c_int_lte_lit2
+	.dbg	line, "compare9.c", 261
+	ldx     #$FF
+	lda     #$FF
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare9.c", 262
+	lda     #$80
+	jsr     _c_int_lte_lit2
+	.dbg	line, "compare9.c", 264
+	ldx     #$00
+	lda     #$00
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare9.c", 265
+	lda     #$00
+	jsr     _c_int_lte_lit2
+	.dbg	line, "compare9.c", 267
+	ldx     #$00
+	lda     #$01
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare9.c", 268
+	lda     #$00
+	jsr     _c_int_lte_lit2
+	.dbg	line, "compare9.c", 270
+	ldx     #$7F
+	lda     #$FF
+	sta     _int0
+	stx     _int0+1
+	.dbg	line, "compare9.c", 271
+	lda     #$00
+	jsr     _c_int_lte_lit2
+	.dbg	line, "compare9.c", 275
+	ldx     #$80
+	lda     #$02
+	sta     _int0
+	stx     _int0+1
+	jmp     L0002
+	.dbg	line, "compare9.c", 276
+L0005:	lda     #$FE
+	jsr     _c_int_lte_lit2
+	.dbg	line, "compare9.c", 275
+	lda     _int0
+	ldx     _int0+1
+	inc     _int0
+	bne     L0007
+	inc     _int0+1
+L0007:	lda     _int0
+	ldx     _int0+1
+	jmp     L0002
+L0002:	lda     _int0
+	ldx     _int0+1
+	cpx     #$81
+	bne     L0006
+	cmp     #$00
+L0006:	jsr     boolne
+	jne     L0005
+	.dbg	line, "compare9.c", 278
+	ldx     #$82
+	lda     #$01
+	sta     _int0
+	stx     _int0+1
+	jmp     L0008
+	.dbg	line, "compare9.c", 279
+L000B:	lda     #$F0
+	jsr     _c_int_lte_lit2
+	.dbg	line, "compare9.c", 278
+	lda     _int0
+	ldx     _int0+1
+	inc     _int0
+	bne     L000D
+	inc     _int0+1
+L000D:	lda     _int0
+	ldx     _int0+1
+	jmp     L0008
+L0008:	lda     _int0
+	ldx     _int0+1
+	cpx     #$FE
+	bne     L000C
+	cmp     #$FF
+L000C:	jsr     boolne
+	jne     L000B
+	.dbg	line, "compare9.c", 281
+	ldx     #$00
+	lda     #$00
+	sta     _int0
+	stx     _int0+1
+	jmp     L000E
+	.dbg	line, "compare9.c", 282
+L0011:	lda     #$00
+	jsr     _c_int_lte_lit2
+	.dbg	line, "compare9.c", 281
+	lda     _int0
+	ldx     _int0+1
+	inc     _int0
+	bne     L0013
+	inc     _int0+1
+L0013:	lda     _int0
+	ldx     _int0+1
+	jmp     L000E
+L000E:	lda     _int0
+	ldx     _int0+1
+	cpx     #$7F
+	bne     L0012
+	cmp     #$FF
+L0012:	jsr     boolne
+	jne     L0011
+	.dbg	line, "compare9.c", 283
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "compare9.c", 288
+	jsr     _char_compare
+	.dbg	line, "compare9.c", 289
+	jsr     _int_compare1
+	.dbg	line, "compare9.c", 290
+	jsr     _int_compare2
+	.dbg	line, "compare9.c", 292
+	ldx     #$00
+	lda     _failures
+	sta     _success
+	.dbg	line, "compare9.c", 293
+	jsr     _done
+	.dbg	line, "compare9.c", 294
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "compare9.c", 296
+	ldx     #$00
+	lda     _failures
+	jmp     L0001
+	.dbg	line, "compare9.c", 297
+L0001:	rts
+
+	.dbg	line
+.endproc
+
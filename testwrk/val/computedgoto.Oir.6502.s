@@ -0,0 +1,110 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.export		_main
+
+.segment	"BSS"
+
+_val:
+	.res	1,$00
+_val2:
+	.res	1,$00
+
+; ---------------------------------------------------------------
+; void __near__ act (const unsigned char op)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_act: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	ldy     #$00
+	lda     (sp),y
+	asl     a
+	tay
+	lda     M0001,y
+	ldx     M0001+1,y
+	jmp     callax
+L0002:	inc     _val
+	jmp     L0001
+L0003:	lda     #$02
+	clc
+	adc     _val
+	sta     _val
+	jmp     L0001
+L0004:	lda     #$03
+	clc
+	adc     _val
+	sta     _val
+	jmp     L0001
+L0005:	inc     _val2
+	jmp     L0001
+L0006:	lda     #$05
+	jmp     L000B
+L0007:	lda     #$07
+	jmp     L000B
+L0008:	lda     #$09
+L000B:	clc
+	adc     _val2
+	sta     _val2
+L0001:	jmp     incsp1
+
+.segment	"RODATA"
+
+M0001:
+	.addr	L0002
+	.addr	L0003
+	.addr	L0004
+	.addr	L0005
+	.addr	L0006
+	.addr	L0007
+	.addr	L0008
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #$00
+	sta     _val2
+	sta     _val
+	lda     #$01
+	jsr     _act
+	lda     #$03
+	jsr     _act
+	lda     #$05
+	jsr     _act
+	ldx     #$00
+	lda     _val
+	cmp     #$02
+	bne     L0009
+	lda     _val2
+	cmp     #$08
+	bne     L0009
+	txa
+	rts
+L0009:	lda     #$01
+	rts
+
+.endproc
+
@@ -0,0 +1,170 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "computedgoto.c", 799, 1613073744
+	.forceimport	__STARTUP__
+	.export		_main
+
+.segment	"BSS"
+
+_val:
+	.res	1,$00
+_val2:
+	.res	1,$00
+
+; ---------------------------------------------------------------
+; void __near__ act (const unsigned char op)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_act: near
+
+	.dbg	func, "act", "00", static, "_act"
+	.dbg	sym, "op", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "computedgoto.c", 3
+	jsr     pusha
+	.dbg	line, "computedgoto.c", 15
+	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	tax
+	jmp     (.loword(M0001),x)
+	.dbg	line, "computedgoto.c", 18
+L0002:	ldx     #$00
+	inc     _val
+	lda     _val
+	.dbg	line, "computedgoto.c", 19
+	jmp     L0001
+	.dbg	line, "computedgoto.c", 22
+L0003:	ldx     #$00
+	lda     #$02
+	clc
+	adc     _val
+	sta     _val
+	.dbg	line, "computedgoto.c", 23
+	jmp     L0001
+	.dbg	line, "computedgoto.c", 26
+L0004:	ldx     #$00
+	lda     #$03
+	clc
+	adc     _val
+	sta     _val
+	.dbg	line, "computedgoto.c", 27
+	jmp     L0001
+	.dbg	line, "computedgoto.c", 30
+L0005:	ldx     #$00
+	inc     _val2
+	lda     _val2
+	.dbg	line, "computedgoto.c", 31
+	jmp     L0001
+	.dbg	line, "computedgoto.c", 34
+L0006:	ldx     #$00
+	lda     #$05
+	clc
+	adc     _val2
+	sta     _val2
+	.dbg	line, "computedgoto.c", 35
+	jmp     L0001
+	.dbg	line, "computedgoto.c", 38
+L0007:	ldx     #$00
+	lda     #$07
+	clc
+	adc     _val2
+	sta     _val2
+	.dbg	line, "computedgoto.c", 39
+	jmp     L0001
+	.dbg	line, "computedgoto.c", 42
+L0008:	ldx     #$00
+	lda     #$09
+	clc
+	adc     _val2
+	sta     _val2
+	.dbg	line, "computedgoto.c", 43
+	jmp     L0001
+	.dbg	line, "computedgoto.c", 44
+L0001:	jsr     incsp1
+	rts
+
+	.dbg	line
+.segment	"RODATA"
+
+M0001:
+	.addr	L0002
+	.addr	L0003
+	.addr	L0004
+	.addr	L0005
+	.addr	L0006
+	.addr	L0007
+	.addr	L0008
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "computedgoto.c", 48
+	ldx     #$00
+	lda     #$00
+	sta     _val2
+	sta     _val
+	.dbg	line, "computedgoto.c", 50
+	lda     #$01
+	jsr     _act
+	.dbg	line, "computedgoto.c", 51
+	lda     #$03
+	jsr     _act
+	.dbg	line, "computedgoto.c", 52
+	lda     #$05
+	jsr     _act
+	.dbg	line, "computedgoto.c", 54
+	ldx     #$00
+	lda     _val
+	cmp     #$02
+	jsr     booleq
+	jeq     L0002
+	ldx     #$00
+	lda     _val2
+	cmp     #$08
+	jsr     booleq
+	jne     L0003
+L0002:	ldx     #$00
+	lda     #$00
+	jeq     L0004
+L0003:	ldx     #$00
+	lda     #$01
+L0004:	jeq     L0005
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+L0005:	ldx     #$00
+	lda     #$01
+L0006:	jmp     L0001
+	.dbg	line, "computedgoto.c", 55
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,333 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_printf
+	.export		_lbits
+	.export		_ubits
+	.export		_fbits
+	.export		_dbits
+	.export		_flgs
+	.export		_flgm
+	.export		_flgd
+	.export		_flgl
+	.export		_rrc
+	.export		_crc
+	.export		_rfs
+	.export		_s22
+	.export		_section
+	.export		_main
+
+.segment	"RODATA"
+
+S0003:
+	.byte	$53,$65,$63,$74,$69,$6F,$6E,$20,$25,$73,$20,$72,$65,$74,$75,$72
+	.byte	$6E,$65,$64,$20,$25,$64,$2E,$0A,$00
+S0004:
+	.byte	$0A,$4E,$6F,$20,$65,$72,$72,$6F,$72,$73,$20,$64,$65,$74,$65,$63
+	.byte	$74,$65,$64,$2E,$0A,$00
+S0005:
+	.byte	$0A,$46,$61,$69,$6C,$65,$64,$2E,$0A,$00
+
+.segment	"BSS"
+
+_lbits:
+	.res	2,$00
+_ubits:
+	.res	2,$00
+_fbits:
+	.res	2,$00
+_dbits:
+	.res	2,$00
+_flgs:
+	.res	2,$00
+_flgm:
+	.res	2,$00
+_flgd:
+	.res	2,$00
+_flgl:
+	.res	2,$00
+_rrc:
+	.res	2,$00
+_crc:
+	.res	2,$00
+_rfs:
+	.res	8,$00
+
+; ---------------------------------------------------------------
+; int __near__ s22 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s22: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$10
+	jsr     subysp
+	ldx     #$00
+	txa
+	ldy     #$04
+	jsr     staxysp
+	lda     #<(M0002)
+	ldx     #>(M0002)
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$11
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     incaxy
+	jsr     stax0sp
+L0002:	jsr     ldax0sp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$03
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	sta     (sreg),y
+	tax
+	php
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	bne     L0002
+	ldx     #$00
+	lda     #$01
+	ldy     #$0C
+	jsr     staxysp
+	lda     #$02
+	ldy     #$0A
+	jsr     staxysp
+	lda     #$03
+	ldy     #$08
+	jsr     staxysp
+	lda     #$04
+	ldy     #$0E
+	jsr     staxysp
+	ldy     #$0B
+	jsr     ldaxysp
+	clc
+	ldy     #$0C
+	adc     (sp),y
+	sta     ptr1
+	txa
+	iny
+	adc     (sp),y
+	sta     ptr1+1
+	ldy     #$09
+	jsr     ldaxysp
+	clc
+	adc     ptr1
+	sta     ptr1
+	txa
+	adc     ptr1+1
+	sta     ptr1+1
+	ldy     #$0F
+	jsr     ldaxysp
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	cpx     #$00
+	bne     L000D
+	cmp     #$0A
+	beq     L0010
+L000D:	ldy     #$05
+	jsr     ldaxysp
+	jsr     incax1
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$11
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L000E
+	cmp     #$00
+	beq     L0010
+L000E:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L0010:	lda     #$02
+	ldy     #$06
+	jsr     staxysp
+	ldy     #$0D
+	lda     (sp),y
+	bne     L000A
+	dey
+	lda     (sp),y
+	cmp     #$02
+	bne     L000A
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     incax4
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$11
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L000F
+	cmp     #$00
+	beq     L000A
+L000F:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	tay
+	jsr     _printf
+L000A:	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$12
+	jmp     addysp
+
+.segment	"DATA"
+
+M0001:
+	.byte	$73,$32,$32,$2C,$65,$72,$25,$64,$0A,$00
+M0002:
+	.byte	$73,$32,$32,$20,$20,$20,$20,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ section (int j, void *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_section: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$02
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	bne     L0003
+	jsr     ldax0sp
+	jsr     _s22
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	ldx     #$00
+	lda     #$01
+	sta     M0001+14
+	stx     M0001+14+1
+	sta     M0001+16
+	stx     M0001+16+1
+	sta     M0001+18
+	stx     M0001+18+1
+	sta     M0001+20
+	stx     M0001+20+1
+	lda     #>(M0001)
+	sta     M0002+1
+	lda     #<(M0001)
+	sta     M0002
+	txa
+	jsr     stax0sp
+	jmp     L0002
+L0005:	jsr     pushw0sp
+	lda     M0002
+	ldx     M0002+1
+	jsr     _section
+	sta     M0001+22
+	stx     M0001+22+1
+	lda     M0001+24
+	clc
+	adc     M0001+22
+	sta     M0001+24
+	lda     M0001+24+1
+	adc     M0001+22+1
+	sta     M0001+24+1
+	lda     M0001+14
+	ora     M0001+14+1
+	beq     L0007
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     #<(M0001+26)
+	ldx     #>(M0001+26)
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+L0007:	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+L0002:	jsr     ldax0sp
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	bmi     L0005
+	lda     M0001+24
+	ora     M0001+24+1
+	bne     L0009
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jmp     L000E
+L0009:	lda     #<(S0005)
+	ldx     #>(S0005)
+L000E:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     M0001+24
+	ldx     M0001+24+1
+	jmp     incsp6
+
+.segment	"BSS"
+
+M0001:
+	.res	34,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
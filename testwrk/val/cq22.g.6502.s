@@ -0,0 +1,439 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "cq22.c", 4117, 1613073744
+	.dbg		file, "common.h", 522, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/stdlib.h", 5999, 1613073744
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_lbits
+	.export		_ubits
+	.export		_fbits
+	.export		_dbits
+	.export		_flgs
+	.export		_flgm
+	.export		_flgd
+	.export		_flgl
+	.export		_rrc
+	.export		_crc
+	.export		_rfs
+	.export		_s22
+	.export		_section
+	.export		_main
+
+.segment	"RODATA"
+
+S0003:
+	.byte	$53,$65,$63,$74,$69,$6F,$6E,$20,$25,$73,$20,$72,$65,$74,$75,$72
+	.byte	$6E,$65,$64,$20,$25,$64,$2E,$0A,$00
+S0004:
+	.byte	$0A,$4E,$6F,$20,$65,$72,$72,$6F,$72,$73,$20,$64,$65,$74,$65,$63
+	.byte	$74,$65,$64,$2E,$0A,$00
+S0005:
+	.byte	$0A,$46,$61,$69,$6C,$65,$64,$2E,$0A,$00
+
+.segment	"BSS"
+
+_lbits:
+	.res	2,$00
+_ubits:
+	.res	2,$00
+_fbits:
+	.res	2,$00
+_dbits:
+	.res	2,$00
+_flgs:
+	.res	2,$00
+_flgm:
+	.res	2,$00
+_flgd:
+	.res	2,$00
+_flgl:
+	.res	2,$00
+_rrc:
+	.res	2,$00
+_crc:
+	.res	2,$00
+_rfs:
+	.res	8,$00
+
+; ---------------------------------------------------------------
+; int __near__ s22 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s22: near
+
+	.dbg	func, "s22", "00", extern, "_s22"
+	.dbg	sym, "pd0", "00", auto, 0
+	.dbg	sym, "a234", "00", auto, -2
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "_", "00", auto, -6
+	.dbg	sym, "_234", "00", auto, -8
+	.dbg	sym, "A", "00", auto, -10
+	.dbg	sym, "rc", "00", auto, -12
+	.dbg	sym, "ps", "00", auto, -14
+	.dbg	sym, "pt", "00", auto, -16
+
+.segment	"CODE"
+
+	.dbg	line, "cq22.c", 56
+	jsr     pushax
+	.dbg	line, "cq22.c", 68
+	ldy     #$10
+	jsr     subysp
+	ldx     #$00
+	lda     #$00
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq22.c", 69
+	lda     #<(M0002)
+	ldx     #>(M0002)
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "cq22.c", 70
+	ldy     #$11
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     incaxy
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "cq22.c", 71
+	jmp     L0002
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$00
+	jsr     staspidx
+	tax
+	php
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	jne     L0002
+	.dbg	line, "cq22.c", 77
+	ldx     #$00
+	lda     #$01
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq22.c", 78
+	ldx     #$00
+	lda     #$02
+	ldy     #$0A
+	jsr     staxysp
+	.dbg	line, "cq22.c", 79
+	ldx     #$00
+	lda     #$03
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "cq22.c", 80
+	ldx     #$00
+	lda     #$04
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq22.c", 81
+	ldy     #$0D
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0D
+	jsr     ldaxysp
+	jsr     tosaddax
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosaddax
+	jsr     pushax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     tosaddax
+	cpx     #$00
+	bne     L0006
+	cmp     #$0A
+L0006:	jsr     boolne
+	jeq     L0007
+	.dbg	line, "cq22.c", 82
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     incax1
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq22.c", 83
+	ldy     #$11
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0008
+	cmp     #$00
+L0008:	jsr     boolne
+	jeq     L0007
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq22.c", 88
+L0007:	ldx     #$00
+	lda     #$02
+	ldy     #$06
+	jsr     staxysp
+	.dbg	line, "cq22.c", 89
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     toseqax
+	jeq     L000A
+	.dbg	line, "cq22.c", 90
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     incax4
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq22.c", 91
+	ldy     #$11
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L000B
+	cmp     #$00
+L000B:	jsr     boolne
+	jeq     L000A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$04
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq22.c", 94
+L000A:	ldy     #$05
+	jsr     ldaxysp
+	jmp     L0001
+	.dbg	line, "cq22.c", 95
+L0001:	ldy     #$12
+	jsr     addysp
+	rts
+
+	.dbg	line
+.segment	"DATA"
+
+M0001:
+	.byte	$73,$32,$32,$2C,$65,$72,$25,$64,$0A,$00
+M0002:
+	.byte	$73,$32,$32,$20,$20,$20,$20,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ section (int j, void *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_section: near
+
+	.dbg	func, "section", "00", extern, "_section"
+	.dbg	sym, "j", "00", auto, 2
+	.dbg	sym, "pd0", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "cq22.c", 106
+	jsr     pushax
+	.dbg	line, "cq22.c", 108
+	ldy     #$03
+	jsr     ldaxysp
+	jmp     L0002
+	.dbg	line, "cq22.c", 110
+L0002:	cpx     #$00
+	jne     L0005
+	cmp     #$00
+	jeq     L0004
+	jmp     L0003
+L0005:	jmp     L0003
+	.dbg	line, "cq22.c", 109
+L0004:	ldy     #$01
+	jsr     ldaxysp
+	jsr     _s22
+	jmp     L0003
+	.dbg	line, "cq22.c", 111
+L0003:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+	.dbg	sym, "n", "00", auto, 2
+	.dbg	sym, "args", "00", auto, 0
+	.dbg	sym, "j", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "cq22.c", 129
+	jsr     decsp2
+	ldx     #$00
+	lda     #$01
+	sta     M0001+14
+	stx     M0001+14+1
+	.dbg	line, "cq22.c", 130
+	ldx     #$00
+	lda     #$01
+	sta     M0001+16
+	stx     M0001+16+1
+	.dbg	line, "cq22.c", 131
+	ldx     #$00
+	lda     #$01
+	sta     M0001+18
+	stx     M0001+18+1
+	.dbg	line, "cq22.c", 132
+	ldx     #$00
+	lda     #$01
+	sta     M0001+20
+	stx     M0001+20+1
+	.dbg	line, "cq22.c", 134
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	sta     M0002
+	stx     M0002+1
+	.dbg	line, "cq22.c", 136
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+	jmp     L0002
+	.dbg	line, "cq22.c", 137
+L0005:	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	lda     M0002
+	ldx     M0002+1
+	jsr     _section
+	sta     M0001+22
+	stx     M0001+22+1
+	.dbg	line, "cq22.c", 138
+	lda     M0001+24
+	ldx     M0001+24+1
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     tosaddax
+	sta     M0001+24
+	stx     M0001+24+1
+	.dbg	line, "cq22.c", 139
+	lda     M0001+14
+	ldx     M0001+14+1
+	cpx     #$00
+	bne     L0008
+	cmp     #$00
+L0008:	jsr     boolne
+	jeq     L0007
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     #<(M0001+26)
+	ldx     #>(M0001+26)
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "cq22.c", 136
+L0007:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0005
+	.dbg	line, "cq22.c", 142
+	lda     M0001+24
+	ldx     M0001+24+1
+	cpx     #$00
+	bne     L000A
+	cmp     #$00
+L000A:	jsr     booleq
+	jeq     L0009
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cq22.c", 143
+	jmp     L000B
+L0009:	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cq22.c", 145
+L000B:	lda     M0001+24
+	ldx     M0001+24+1
+	jmp     L0001
+	.dbg	line, "cq22.c", 146
+L0001:	jsr     incsp6
+	rts
+
+	.dbg	line
+.segment	"BSS"
+
+M0001:
+	.res	34,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
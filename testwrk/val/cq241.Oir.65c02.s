@@ -0,0 +1,1665 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_printf
+	.export		_lbits
+	.export		_ubits
+	.export		_fbits
+	.export		_dbits
+	.export		_flgs
+	.export		_flgm
+	.export		_flgd
+	.export		_flgl
+	.export		_rrc
+	.export		_crc
+	.export		_rfs
+	.export		_pow2
+	.export		_d
+	.export		_o
+	.export		_x
+	.export		_s241
+	.export		_section
+	.export		_main
+
+.segment	"RODATA"
+
+S0003:
+	.byte	$44,$65,$63,$69,$6D,$61,$6C,$20,$61,$6E,$64,$20,$6F,$63,$74,$61
+	.byte	$6C,$2F,$68,$65,$78,$20,$63,$6F,$6E,$73,$74,$61,$6E,$74,$73,$20
+	.byte	$73,$6F,$6D,$65,$74,$69,$6D,$65,$73,$20,$67,$69,$76,$65,$0A,$00
+S0004:
+	.byte	$20,$20,$20,$64,$69,$66,$66,$65,$72,$65,$6E,$74,$20,$72,$65,$73
+	.byte	$75,$6C,$74,$73,$20,$77,$68,$65,$6E,$20,$61,$73,$73,$69,$67,$6E
+	.byte	$65,$64,$20,$74,$6F,$20,$6C,$6F,$6E,$67,$73,$2E,$0A,$00
+S0005:
+	.byte	$53,$65,$63,$74,$69,$6F,$6E,$20,$25,$73,$20,$72,$65,$74,$75,$72
+	.byte	$6E,$65,$64,$20,$25,$64,$2E,$0A,$00
+S0006:
+	.byte	$0A,$4E,$6F,$20,$65,$72,$72,$6F,$72,$73,$20,$64,$65,$74,$65,$63
+	.byte	$74,$65,$64,$2E,$0A,$00
+S0007:
+	.byte	$0A,$46,$61,$69,$6C,$65,$64,$2E,$0A,$00
+
+.segment	"BSS"
+
+_lbits:
+	.res	2,$00
+_ubits:
+	.res	2,$00
+_fbits:
+	.res	2,$00
+_dbits:
+	.res	2,$00
+_flgs:
+	.res	2,$00
+_flgm:
+	.res	2,$00
+_flgd:
+	.res	2,$00
+_flgl:
+	.res	2,$00
+_rrc:
+	.res	2,$00
+_crc:
+	.res	2,$00
+_rfs:
+	.res	8,$00
+_d:
+	.res	156,$00
+_o:
+	.res	156,$00
+_x:
+	.res	156,$00
+
+; ---------------------------------------------------------------
+; long __near__ pow2 (long n)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_pow2: near
+
+.segment	"CODE"
+
+	jsr     pusheax
+	jsr     decsp4
+	lda     #$01
+	sta     (sp)
+	dea
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	bra     L0004
+L0002:	jsr     ldeax0sp
+	jsr     asleax1
+	jsr     steax0sp
+L0004:	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tsteax
+	php
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$01
+	ldy     #$04
+	jsr     lsubeqysp
+	plp
+	bne     L0002
+	jsr     ldeax0sp
+	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ s241 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s241: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$0A
+	jsr     subysp
+	ldy     #$04
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	sta     (sp)
+	ldy     #$01
+	sta     (sp),y
+	lda     #<(M0002)
+	ldx     #>(M0002)
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$0B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$1A
+	bcc     L0002
+	inx
+L0002:	ldy     #$06
+	jsr     staxysp
+L0003:	ldy     #$09
+	jsr     pushwysp
+	ldy     #$0B
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$00
+	lda     (ptr1)
+	jsr     staspidx
+	tax
+	php
+	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$08
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	bne     L0003
+	ldy     #$02
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	bra     L002E
+L0019:	iny
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     aslax2
+	clc
+	adc     #<(M0003)
+	tay
+	txa
+	adc     #>(M0003)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     axlong
+	ldy     #$00
+	jsr     steaxspidx
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$03
+L002E:	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cmp     #$11
+	txa
+	sbc     #$00
+	bvc     L001A
+	eor     #$80
+L001A:	bmi     L0019
+	lda     #$12
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	jmp     L002F
+L001E:	iny
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     aslax2
+	clc
+	adc     #<(M0003)
+	tay
+	txa
+	adc     #>(M0003)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     aslax2
+	clc
+	adc     #<(M0003)
+	tay
+	txa
+	adc     #>(M0003)
+	tax
+	tya
+	jsr     ldeaxi
+	jsr     _pow2
+	ldy     #$00
+	jsr     steaxspidx
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	sec
+	sbc     #$01
+	bcs     L0020
+	dex
+L0020:	jsr     aslax2
+	clc
+	adc     #<(M0003)
+	tay
+	txa
+	adc     #>(M0003)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     aslax2
+	clc
+	adc     #<(M0003)
+	tay
+	txa
+	adc     #>(M0003)
+	tax
+	tya
+	jsr     ldeaxi
+	ldy     #$01
+	jsr     deceaxy
+	dey
+	jsr     steaxspidx
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$02
+	bcc     L0021
+	inx
+L0021:	jsr     staxysp
+	ldy     #$03
+L002F:	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cmp     #$27
+	txa
+	sbc     #$00
+	bvc     L001F
+	eor     #$80
+L001F:	jmi     L001E
+	stz     sreg
+	stz     sreg+1
+	stz     _d
+	stz     _d+1
+	ldy     sreg
+	sty     _d+2
+	ldy     sreg+1
+	sty     _d+3
+	stz     sreg
+	stz     sreg+1
+	stz     _o
+	stz     _o+1
+	ldy     sreg
+	sty     _o+2
+	ldy     sreg+1
+	sty     _o+3
+	stz     sreg
+	stz     sreg+1
+	stz     _x
+	stz     _x+1
+	ldy     sreg
+	sty     _x+2
+	ldy     sreg+1
+	sty     _x+3
+	stz     sreg
+	stz     sreg+1
+	lda     #$01
+	sta     _d+4
+	stz     _d+4+1
+	ldy     sreg
+	sty     _d+4+2
+	ldy     sreg+1
+	sty     _d+4+3
+	stz     sreg
+	stz     sreg+1
+	sta     _o+4
+	stz     _o+4+1
+	ldy     sreg
+	sty     _o+4+2
+	ldy     sreg+1
+	sty     _o+4+3
+	stz     sreg
+	stz     sreg+1
+	sta     _x+4
+	stz     _x+4+1
+	ldy     sreg
+	sty     _x+4+2
+	ldy     sreg+1
+	sty     _x+4+3
+	stz     sreg
+	stz     sreg+1
+	ina
+	sta     _d+8
+	stz     _d+8+1
+	ldy     sreg
+	sty     _d+8+2
+	ldy     sreg+1
+	sty     _d+8+3
+	stz     sreg
+	stz     sreg+1
+	sta     _o+8
+	stz     _o+8+1
+	ldy     sreg
+	sty     _o+8+2
+	ldy     sreg+1
+	sty     _o+8+3
+	stz     sreg
+	stz     sreg+1
+	sta     _x+8
+	stz     _x+8+1
+	ldy     sreg
+	sty     _x+8+2
+	ldy     sreg+1
+	sty     _x+8+3
+	stz     sreg
+	stz     sreg+1
+	ina
+	sta     _d+12
+	stz     _d+12+1
+	ldy     sreg
+	sty     _d+12+2
+	ldy     sreg+1
+	sty     _d+12+3
+	stz     sreg
+	stz     sreg+1
+	sta     _o+12
+	stz     _o+12+1
+	ldy     sreg
+	sty     _o+12+2
+	ldy     sreg+1
+	sty     _o+12+3
+	stz     sreg
+	stz     sreg+1
+	sta     _x+12
+	stz     _x+12+1
+	ldy     sreg
+	sty     _x+12+2
+	ldy     sreg+1
+	sty     _x+12+3
+	stz     sreg
+	stz     sreg+1
+	ina
+	sta     _d+16
+	stz     _d+16+1
+	ldy     sreg
+	sty     _d+16+2
+	ldy     sreg+1
+	sty     _d+16+3
+	stz     sreg
+	stz     sreg+1
+	sta     _o+16
+	stz     _o+16+1
+	ldy     sreg
+	sty     _o+16+2
+	ldy     sreg+1
+	sty     _o+16+3
+	stz     sreg
+	stz     sreg+1
+	sta     _x+16
+	stz     _x+16+1
+	ldy     sreg
+	sty     _x+16+2
+	ldy     sreg+1
+	sty     _x+16+3
+	stz     sreg
+	stz     sreg+1
+	ina
+	sta     _d+20
+	stz     _d+20+1
+	ldy     sreg
+	sty     _d+20+2
+	ldy     sreg+1
+	sty     _d+20+3
+	stz     sreg
+	stz     sreg+1
+	sta     _o+20
+	stz     _o+20+1
+	ldy     sreg
+	sty     _o+20+2
+	ldy     sreg+1
+	sty     _o+20+3
+	stz     sreg
+	stz     sreg+1
+	sta     _x+20
+	stz     _x+20+1
+	ldy     sreg
+	sty     _x+20+2
+	ldy     sreg+1
+	sty     _x+20+3
+	stz     sreg
+	stz     sreg+1
+	ina
+	sta     _d+24
+	stz     _d+24+1
+	ldy     sreg
+	sty     _d+24+2
+	ldy     sreg+1
+	sty     _d+24+3
+	stz     sreg
+	stz     sreg+1
+	sta     _o+24
+	stz     _o+24+1
+	ldy     sreg
+	sty     _o+24+2
+	ldy     sreg+1
+	sty     _o+24+3
+	stz     sreg
+	stz     sreg+1
+	sta     _x+24
+	stz     _x+24+1
+	ldy     sreg
+	sty     _x+24+2
+	ldy     sreg+1
+	sty     _x+24+3
+	stz     sreg
+	stz     sreg+1
+	ina
+	sta     _d+28
+	stz     _d+28+1
+	ldy     sreg
+	sty     _d+28+2
+	ldy     sreg+1
+	sty     _d+28+3
+	stz     sreg
+	stz     sreg+1
+	sta     _o+28
+	stz     _o+28+1
+	ldy     sreg
+	sty     _o+28+2
+	ldy     sreg+1
+	sty     _o+28+3
+	stz     sreg
+	stz     sreg+1
+	sta     _x+28
+	stz     _x+28+1
+	ldy     sreg
+	sty     _x+28+2
+	ldy     sreg+1
+	sty     _x+28+3
+	stz     sreg
+	stz     sreg+1
+	ina
+	sta     _d+32
+	stz     _d+32+1
+	ldy     sreg
+	sty     _d+32+2
+	ldy     sreg+1
+	sty     _d+32+3
+	stz     sreg
+	stz     sreg+1
+	sta     _o+32
+	stz     _o+32+1
+	ldy     sreg
+	sty     _o+32+2
+	ldy     sreg+1
+	sty     _o+32+3
+	stz     sreg
+	stz     sreg+1
+	sta     _x+32
+	stz     _x+32+1
+	ldy     sreg
+	sty     _x+32+2
+	ldy     sreg+1
+	sty     _x+32+3
+	stz     sreg
+	stz     sreg+1
+	ina
+	sta     _d+36
+	stz     _d+36+1
+	ldy     sreg
+	sty     _d+36+2
+	ldy     sreg+1
+	sty     _d+36+3
+	stz     sreg
+	stz     sreg+1
+	sta     _o+36
+	stz     _o+36+1
+	ldy     sreg
+	sty     _o+36+2
+	ldy     sreg+1
+	sty     _o+36+3
+	stz     sreg
+	stz     sreg+1
+	sta     _x+36
+	stz     _x+36+1
+	ldy     sreg
+	sty     _x+36+2
+	ldy     sreg+1
+	sty     _x+36+3
+	stz     sreg
+	stz     sreg+1
+	ina
+	sta     _d+40
+	stz     _d+40+1
+	ldy     sreg
+	sty     _d+40+2
+	ldy     sreg+1
+	sty     _d+40+3
+	stz     sreg
+	stz     sreg+1
+	sta     _o+40
+	stz     _o+40+1
+	ldy     sreg
+	sty     _o+40+2
+	ldy     sreg+1
+	sty     _o+40+3
+	stz     sreg
+	stz     sreg+1
+	sta     _x+40
+	stz     _x+40+1
+	ldy     sreg
+	sty     _x+40+2
+	ldy     sreg+1
+	sty     _x+40+3
+	stz     sreg
+	stz     sreg+1
+	ina
+	sta     _d+44
+	stz     _d+44+1
+	ldy     sreg
+	sty     _d+44+2
+	ldy     sreg+1
+	sty     _d+44+3
+	stz     sreg
+	stz     sreg+1
+	sta     _o+44
+	stz     _o+44+1
+	ldy     sreg
+	sty     _o+44+2
+	ldy     sreg+1
+	sty     _o+44+3
+	stz     sreg
+	stz     sreg+1
+	sta     _x+44
+	stz     _x+44+1
+	ldy     sreg
+	sty     _x+44+2
+	ldy     sreg+1
+	sty     _x+44+3
+	stz     sreg
+	stz     sreg+1
+	ina
+	sta     _d+48
+	stz     _d+48+1
+	ldy     sreg
+	sty     _d+48+2
+	ldy     sreg+1
+	sty     _d+48+3
+	stz     sreg
+	stz     sreg+1
+	sta     _o+48
+	stz     _o+48+1
+	ldy     sreg
+	sty     _o+48+2
+	ldy     sreg+1
+	sty     _o+48+3
+	stz     sreg
+	stz     sreg+1
+	sta     _x+48
+	stz     _x+48+1
+	ldy     sreg
+	sty     _x+48+2
+	ldy     sreg+1
+	sty     _x+48+3
+	stz     sreg
+	stz     sreg+1
+	ina
+	sta     _d+52
+	stz     _d+52+1
+	ldy     sreg
+	sty     _d+52+2
+	ldy     sreg+1
+	sty     _d+52+3
+	stz     sreg
+	stz     sreg+1
+	sta     _o+52
+	stz     _o+52+1
+	ldy     sreg
+	sty     _o+52+2
+	ldy     sreg+1
+	sty     _o+52+3
+	stz     sreg
+	stz     sreg+1
+	sta     _x+52
+	stz     _x+52+1
+	ldy     sreg
+	sty     _x+52+2
+	ldy     sreg+1
+	sty     _x+52+3
+	stz     sreg
+	stz     sreg+1
+	ina
+	sta     _d+56
+	stz     _d+56+1
+	ldy     sreg
+	sty     _d+56+2
+	ldy     sreg+1
+	sty     _d+56+3
+	stz     sreg
+	stz     sreg+1
+	sta     _o+56
+	stz     _o+56+1
+	ldy     sreg
+	sty     _o+56+2
+	ldy     sreg+1
+	sty     _o+56+3
+	stz     sreg
+	stz     sreg+1
+	sta     _x+56
+	stz     _x+56+1
+	ldy     sreg
+	sty     _x+56+2
+	ldy     sreg+1
+	sty     _x+56+3
+	stz     sreg
+	stz     sreg+1
+	ina
+	sta     _d+60
+	stz     _d+60+1
+	ldy     sreg
+	sty     _d+60+2
+	ldy     sreg+1
+	sty     _d+60+3
+	stz     sreg
+	stz     sreg+1
+	sta     _o+60
+	stz     _o+60+1
+	ldy     sreg
+	sty     _o+60+2
+	ldy     sreg+1
+	sty     _o+60+3
+	stz     sreg
+	stz     sreg+1
+	sta     _x+60
+	stz     _x+60+1
+	ldy     sreg
+	sty     _x+60+2
+	ldy     sreg+1
+	sty     _x+60+3
+	stz     sreg
+	stz     sreg+1
+	ina
+	sta     _d+64
+	stz     _d+64+1
+	ldy     sreg
+	sty     _d+64+2
+	ldy     sreg+1
+	sty     _d+64+3
+	stz     sreg
+	stz     sreg+1
+	sta     _o+64
+	stz     _o+64+1
+	ldy     sreg
+	sty     _o+64+2
+	ldy     sreg+1
+	sty     _o+64+3
+	stz     sreg
+	stz     sreg+1
+	sta     _x+64
+	stz     _x+64+1
+	ldy     sreg
+	sty     _x+64+2
+	ldy     sreg+1
+	sty     _x+64+3
+	stz     sreg
+	stz     sreg+1
+	lda     #$3F
+	sta     _d+68
+	stz     _d+68+1
+	ldy     sreg
+	sty     _d+68+2
+	ldy     sreg+1
+	sty     _d+68+3
+	stz     sreg
+	stz     sreg+1
+	sta     _o+68
+	stz     _o+68+1
+	ldy     sreg
+	sty     _o+68+2
+	ldy     sreg+1
+	sty     _o+68+3
+	stz     sreg
+	stz     sreg+1
+	sta     _x+68
+	stz     _x+68+1
+	ldy     sreg
+	sty     _x+68+2
+	ldy     sreg+1
+	sty     _x+68+3
+	stz     sreg
+	stz     sreg+1
+	ina
+	sta     _d+72
+	stz     _d+72+1
+	ldy     sreg
+	sty     _d+72+2
+	ldy     sreg+1
+	sty     _d+72+3
+	stz     sreg
+	stz     sreg+1
+	sta     _o+72
+	stz     _o+72+1
+	ldy     sreg
+	sty     _o+72+2
+	ldy     sreg+1
+	sty     _o+72+3
+	stz     sreg
+	stz     sreg+1
+	sta     _x+72
+	stz     _x+72+1
+	ldy     sreg
+	sty     _x+72+2
+	ldy     sreg+1
+	sty     _x+72+3
+	stz     sreg
+	stz     sreg+1
+	lda     #$FF
+	sta     _d+76
+	stz     _d+76+1
+	ldy     sreg
+	sty     _d+76+2
+	ldy     sreg+1
+	sty     _d+76+3
+	stz     sreg
+	stz     sreg+1
+	sta     _o+76
+	stz     _o+76+1
+	ldy     sreg
+	sty     _o+76+2
+	ldy     sreg+1
+	sty     _o+76+3
+	stz     sreg
+	stz     sreg+1
+	sta     _x+76
+	stz     _x+76+1
+	ldy     sreg
+	sty     _x+76+2
+	ldy     sreg+1
+	sty     _x+76+3
+	ldx     #$01
+	stz     sreg
+	stz     sreg+1
+	stz     _d+80
+	stx     _d+80+1
+	ldy     sreg
+	sty     _d+80+2
+	ldy     sreg+1
+	sty     _d+80+3
+	stz     sreg
+	stz     sreg+1
+	stz     _o+80
+	stx     _o+80+1
+	ldy     sreg
+	sty     _o+80+2
+	ldy     sreg+1
+	sty     _o+80+3
+	stz     sreg
+	stz     sreg+1
+	stz     _x+80
+	stx     _x+80+1
+	ldy     sreg
+	sty     _x+80+2
+	ldy     sreg+1
+	sty     _x+80+3
+	ldx     #$0F
+	stz     sreg
+	stz     sreg+1
+	lda     #$FF
+	sta     _d+84
+	stx     _d+84+1
+	ldy     sreg
+	sty     _d+84+2
+	ldy     sreg+1
+	sty     _d+84+3
+	stz     sreg
+	stz     sreg+1
+	lda     #$FF
+	sta     _o+84
+	stx     _o+84+1
+	ldy     sreg
+	sty     _o+84+2
+	ldy     sreg+1
+	sty     _o+84+3
+	stz     sreg
+	stz     sreg+1
+	lda     #$FF
+	sta     _x+84
+	stx     _x+84+1
+	ldy     sreg
+	sty     _x+84+2
+	ldy     sreg+1
+	sty     _x+84+3
+	inx
+	stz     sreg
+	stz     sreg+1
+	stz     _d+88
+	stx     _d+88+1
+	ldy     sreg
+	sty     _d+88+2
+	ldy     sreg+1
+	sty     _d+88+3
+	stz     sreg
+	stz     sreg+1
+	stz     _o+88
+	stx     _o+88+1
+	ldy     sreg
+	sty     _o+88+2
+	ldy     sreg+1
+	sty     _o+88+3
+	stz     sreg
+	stz     sreg+1
+	stz     _x+88
+	stx     _x+88+1
+	ldy     sreg
+	sty     _x+88+2
+	ldy     sreg+1
+	sty     _x+88+3
+	stz     sreg
+	stz     sreg+1
+	lda     #$FF
+	sta     _d+92
+	sta     _d+92+1
+	ldy     sreg
+	sty     _d+92+2
+	ldy     sreg+1
+	sty     _d+92+3
+	stz     sreg
+	stz     sreg+1
+	lda     #$FF
+	sta     _o+92
+	sta     _o+92+1
+	ldy     sreg
+	sty     _o+92+2
+	ldy     sreg+1
+	sty     _o+92+3
+	stz     sreg
+	stz     sreg+1
+	lda     #$FF
+	sta     _x+92
+	sta     _x+92+1
+	ldy     sreg
+	sty     _x+92+2
+	ldy     sreg+1
+	sty     _x+92+3
+	stz     sreg+1
+	lda     #$01
+	sta     sreg
+	lsr     a
+	stz     _d+96
+	stz     _d+96+1
+	ldy     sreg
+	sty     _d+96+2
+	ldy     sreg+1
+	sty     _d+96+3
+	stz     sreg+1
+	ina
+	sta     sreg
+	lsr     a
+	stz     _o+96
+	stz     _o+96+1
+	ldy     sreg
+	sty     _o+96+2
+	ldy     sreg+1
+	sty     _o+96+3
+	stz     sreg+1
+	ina
+	sta     sreg
+	lsr     a
+	stz     _x+96
+	stz     _x+96+1
+	ldy     sreg
+	sty     _x+96+2
+	ldy     sreg+1
+	sty     _x+96+3
+	lda     #$03
+	sta     sreg
+	stz     sreg+1
+	lda     #$FF
+	sta     _d+100
+	sta     _d+100+1
+	ldy     sreg
+	sty     _d+100+2
+	ldy     sreg+1
+	sty     _d+100+3
+	lda     #$03
+	sta     sreg
+	stz     sreg+1
+	lda     #$FF
+	sta     _o+100
+	sta     _o+100+1
+	ldy     sreg
+	sty     _o+100+2
+	ldy     sreg+1
+	sty     _o+100+3
+	lda     #$03
+	sta     sreg
+	stz     sreg+1
+	lda     #$FF
+	sta     _x+100
+	sta     _x+100+1
+	ldy     sreg
+	sty     _x+100+2
+	ldy     sreg+1
+	sty     _x+100+3
+	stz     sreg+1
+	lda     #$04
+	sta     sreg
+	stz     _d+104
+	stz     _d+104+1
+	ldy     sreg
+	sty     _d+104+2
+	ldy     sreg+1
+	sty     _d+104+3
+	stz     sreg+1
+	lda     #$04
+	sta     sreg
+	stz     _o+104
+	stz     _o+104+1
+	ldy     sreg
+	sty     _o+104+2
+	ldy     sreg+1
+	sty     _o+104+3
+	stz     sreg+1
+	lda     #$04
+	sta     sreg
+	stz     _x+104
+	stz     _x+104+1
+	ldy     sreg
+	sty     _x+104+2
+	ldy     sreg+1
+	sty     _x+104+3
+	lda     #$0F
+	sta     sreg
+	stz     sreg+1
+	lda     #$FF
+	sta     _d+108
+	sta     _d+108+1
+	ldy     sreg
+	sty     _d+108+2
+	ldy     sreg+1
+	sty     _d+108+3
+	lda     #$0F
+	sta     sreg
+	stz     sreg+1
+	lda     #$FF
+	sta     _o+108
+	sta     _o+108+1
+	ldy     sreg
+	sty     _o+108+2
+	ldy     sreg+1
+	sty     _o+108+3
+	lda     #$0F
+	sta     sreg
+	stz     sreg+1
+	lda     #$FF
+	sta     _x+108
+	sta     _x+108+1
+	ldy     sreg
+	sty     _x+108+2
+	ldy     sreg+1
+	sty     _x+108+3
+	stz     sreg+1
+	stx     sreg
+	stz     _d+112
+	stz     _d+112+1
+	ldy     sreg
+	sty     _d+112+2
+	ldy     sreg+1
+	sty     _d+112+3
+	stz     sreg+1
+	stx     sreg
+	stz     _o+112
+	stz     _o+112+1
+	ldy     sreg
+	sty     _o+112+2
+	ldy     sreg+1
+	sty     _o+112+3
+	stz     sreg+1
+	stx     sreg
+	stz     _x+112
+	stz     _x+112+1
+	ldy     sreg
+	sty     _x+112+2
+	ldy     sreg+1
+	sty     _x+112+3
+	ldx     #$FF
+	stx     sreg
+	stz     sreg+1
+	txa
+	sta     _d+116
+	sta     _d+116+1
+	ldy     sreg
+	sty     _d+116+2
+	ldy     sreg+1
+	sty     _d+116+3
+	sta     sreg
+	stz     sreg+1
+	txa
+	sta     _o+116
+	sta     _o+116+1
+	ldy     sreg
+	sty     _o+116+2
+	ldy     sreg+1
+	sty     _o+116+3
+	sta     sreg
+	stz     sreg+1
+	txa
+	sta     _x+116
+	sta     _x+116+1
+	ldy     sreg
+	sty     _x+116+2
+	ldy     sreg+1
+	sty     _x+116+3
+	stz     sreg
+	lda     #$01
+	sta     sreg+1
+	lsr     a
+	stz     _d+120
+	stz     _d+120+1
+	ldy     sreg
+	sty     _d+120+2
+	ldy     sreg+1
+	sty     _d+120+3
+	stz     sreg
+	ina
+	sta     sreg+1
+	lsr     a
+	stz     _o+120
+	stz     _o+120+1
+	ldy     sreg
+	sty     _o+120+2
+	ldy     sreg+1
+	sty     _o+120+3
+	stz     sreg
+	ina
+	sta     sreg+1
+	lsr     a
+	stz     _x+120
+	stz     _x+120+1
+	ldy     sreg
+	sty     _x+120+2
+	ldy     sreg+1
+	sty     _x+120+3
+	ldx     #$FF
+	stx     sreg
+	lda     #$0F
+	sta     sreg+1
+	txa
+	sta     _d+124
+	sta     _d+124+1
+	ldy     sreg
+	sty     _d+124+2
+	ldy     sreg+1
+	sty     _d+124+3
+	sta     sreg
+	lda     #$0F
+	sta     sreg+1
+	txa
+	sta     _o+124
+	sta     _o+124+1
+	ldy     sreg
+	sty     _o+124+2
+	ldy     sreg+1
+	sty     _o+124+3
+	sta     sreg
+	lda     #$0F
+	sta     sreg+1
+	txa
+	sta     _x+124
+	sta     _x+124+1
+	ldy     sreg
+	sty     _x+124+2
+	ldy     sreg+1
+	sty     _x+124+3
+	stz     sreg
+	lda     #$10
+	sta     sreg+1
+	stz     _d+128
+	stz     _d+128+1
+	ldy     sreg
+	sty     _d+128+2
+	ldy     sreg+1
+	sty     _d+128+3
+	stz     sreg
+	lda     #$10
+	sta     sreg+1
+	stz     _o+128
+	stz     _o+128+1
+	ldy     sreg
+	sty     _o+128+2
+	ldy     sreg+1
+	sty     _o+128+3
+	stz     sreg
+	lda     #$10
+	sta     sreg+1
+	stz     _x+128
+	stz     _x+128+1
+	ldy     sreg
+	sty     _x+128+2
+	ldy     sreg+1
+	sty     _x+128+3
+	ldx     #$FF
+	stx     sreg
+	lda     #$3F
+	sta     sreg+1
+	txa
+	sta     _d+132
+	sta     _d+132+1
+	ldy     sreg
+	sty     _d+132+2
+	ldy     sreg+1
+	sty     _d+132+3
+	sta     sreg
+	lda     #$3F
+	sta     sreg+1
+	txa
+	sta     _o+132
+	sta     _o+132+1
+	ldy     sreg
+	sty     _o+132+2
+	ldy     sreg+1
+	sty     _o+132+3
+	sta     sreg
+	lda     #$3F
+	sta     sreg+1
+	txa
+	sta     _x+132
+	sta     _x+132+1
+	ldy     sreg
+	sty     _x+132+2
+	ldy     sreg+1
+	sty     _x+132+3
+	stz     sreg
+	lda     #$40
+	sta     sreg+1
+	stz     _d+136
+	stz     _d+136+1
+	ldy     sreg
+	sty     _d+136+2
+	ldy     sreg+1
+	sty     _d+136+3
+	stz     sreg
+	lda     #$40
+	sta     sreg+1
+	stz     _o+136
+	stz     _o+136+1
+	ldy     sreg
+	sty     _o+136+2
+	ldy     sreg+1
+	sty     _o+136+3
+	stz     sreg
+	lda     #$40
+	sta     sreg+1
+	stz     _x+136
+	stz     _x+136+1
+	ldy     sreg
+	sty     _x+136+2
+	ldy     sreg+1
+	sty     _x+136+3
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	txa
+	sta     _d+140
+	sta     _d+140+1
+	ldy     sreg
+	sty     _d+140+2
+	ldy     sreg+1
+	sty     _d+140+3
+	sta     sreg
+	sta     sreg+1
+	sta     _o+140
+	sta     _o+140+1
+	ldy     sreg
+	sty     _o+140+2
+	ldy     sreg+1
+	sty     _o+140+3
+	sta     sreg
+	sta     sreg+1
+	sta     _x+140
+	sta     _x+140+1
+	ldy     sreg
+	sty     _x+140+2
+	ldy     sreg+1
+	sty     _x+140+3
+	stz     sreg
+	stz     sreg+1
+	stz     _d+144
+	stz     _d+144+1
+	ldy     sreg
+	sty     _d+144+2
+	ldy     sreg+1
+	sty     _d+144+3
+	stz     sreg
+	stz     sreg+1
+	stz     _o+144
+	stz     _o+144+1
+	ldy     sreg
+	sty     _o+144+2
+	ldy     sreg+1
+	sty     _o+144+3
+	stz     sreg
+	stz     sreg+1
+	stz     _x+144
+	stz     _x+144+1
+	ldy     sreg
+	sty     _x+144+2
+	ldy     sreg+1
+	sty     _x+144+3
+	tax
+	stx     sreg
+	stx     sreg+1
+	txa
+	sta     _d+148
+	sta     _d+148+1
+	ldy     sreg
+	sty     _d+148+2
+	ldy     sreg+1
+	sty     _d+148+3
+	sta     sreg
+	sta     sreg+1
+	sta     _o+148
+	sta     _o+148+1
+	ldy     sreg
+	sty     _o+148+2
+	ldy     sreg+1
+	sty     _o+148+3
+	sta     sreg
+	sta     sreg+1
+	sta     _x+148
+	sta     _x+148+1
+	ldy     sreg
+	sty     _x+148+2
+	ldy     sreg+1
+	sty     _x+148+3
+	stz     sreg
+	stz     sreg+1
+	ina
+	stz     _d+152
+	stz     _d+152+1
+	ldy     sreg
+	sty     _d+152+2
+	ldy     sreg+1
+	sty     _d+152+3
+	stz     sreg
+	stz     sreg+1
+	stz     _o+152
+	stz     _o+152+1
+	ldy     sreg
+	sty     _o+152+2
+	ldy     sreg+1
+	sty     _o+152+3
+	stz     sreg
+	stz     sreg+1
+	stz     _x+152
+	stz     _x+152+1
+	ldy     sreg
+	sty     _x+152+2
+	ldy     sreg+1
+	sty     _x+152+3
+	ldy     #$02
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L0030
+L0025:	iny
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     aslax2
+	clc
+	adc     #<(M0003)
+	tay
+	txa
+	adc     #>(M0003)
+	tax
+	tya
+	jsr     ldeaxi
+	jsr     pusheax
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     aslax2
+	clc
+	adc     #<(_d)
+	tay
+	txa
+	adc     #>(_d)
+	tax
+	tya
+	jsr     ldeaxi
+	jsr     tosneeax
+	bne     L0028
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     aslax2
+	clc
+	adc     #<(_d)
+	tay
+	txa
+	adc     #>(_d)
+	tax
+	tya
+	jsr     ldeaxi
+	jsr     pusheax
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     aslax2
+	clc
+	adc     #<(_o)
+	tay
+	txa
+	adc     #>(_o)
+	tax
+	tya
+	jsr     ldeaxi
+	jsr     tosneeax
+	bne     L0028
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     aslax2
+	clc
+	adc     #<(_o)
+	tay
+	txa
+	adc     #>(_o)
+	tax
+	tya
+	jsr     ldeaxi
+	jsr     pusheax
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     aslax2
+	clc
+	adc     #<(_x)
+	tay
+	txa
+	adc     #>(_x)
+	tax
+	tya
+	jsr     ldeaxi
+	jsr     tosneeax
+	beq     L002A
+L0028:	ldy     #$0B
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$11
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     #$00
+	bne     L0031
+	cmp     #$00
+	beq     L002A
+L0031:	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+L002A:	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$03
+L0030:	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cmp     #$27
+	txa
+	sbc     #$00
+	bvc     L0026
+	eor     #$80
+L0026:	jmi     L0025
+	lda     (sp)
+	dey
+	ora     (sp),y
+	beq     L002C
+	ldy     #$04
+	lda     #$10
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+L002C:	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$0C
+	jmp     addysp
+
+.segment	"DATA"
+
+M0001:
+	.byte	$73,$32,$34,$31,$2C,$65,$72,$25,$64,$0A,$00
+M0002:
+	.byte	$73,$32,$34,$31,$20,$20,$20,$00
+M0003:
+	.dword	$00000000
+	.dword	$00000000
+	.dword	$00000000
+	.dword	$00000000
+	.dword	$00000000
+	.dword	$00000000
+	.dword	$00000000
+	.dword	$00000000
+	.dword	$00000000
+	.dword	$00000000
+	.dword	$00000000
+	.dword	$00000000
+	.dword	$00000000
+	.dword	$00000000
+	.dword	$00000000
+	.dword	$00000000
+	.dword	$00000000
+	.dword	$00000000
+	.dword	$00000006
+	.dword	$00000000
+	.dword	$00000008
+	.dword	$00000000
+	.dword	$0000000C
+	.dword	$00000000
+	.dword	$00000010
+	.dword	$00000000
+	.dword	$00000012
+	.dword	$00000000
+	.dword	$00000014
+	.dword	$00000000
+	.dword	$00000018
+	.dword	$00000000
+	.dword	$0000001C
+	.dword	$00000000
+	.dword	$0000001E
+	.dword	$00000000
+	.dword	$00000020
+	.dword	$00000000
+	.dword	$00000024
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ section (int j, void *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_section: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$02
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	bne     L0003
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _s241
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	lda     #$01
+	sta     M0001+14
+	stz     M0001+14+1
+	sta     M0001+16
+	stz     M0001+16+1
+	sta     M0001+18
+	stz     M0001+18+1
+	sta     M0001+20
+	stz     M0001+20+1
+	lda     #>(M0001)
+	sta     M0002+1
+	lda     #<(M0001)
+	sta     M0002
+	lda     #$00
+	sta     (sp)
+	ldy     #$01
+	sta     (sp),y
+	bra     L000D
+L0005:	jsr     pushw0sp
+	lda     M0002
+	ldx     M0002+1
+	jsr     _section
+	sta     M0001+22
+	stx     M0001+22+1
+	lda     M0001+24
+	clc
+	adc     M0001+22
+	sta     M0001+24
+	lda     M0001+24+1
+	adc     M0001+22+1
+	sta     M0001+24+1
+	lda     M0001+14
+	ora     M0001+14+1
+	beq     L0007
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     #<(M0001+26)
+	ldx     #>(M0001+26)
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+L0007:	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	ldy     #$01
+L000D:	lda     (sp),y
+	tax
+	lda     (sp)
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	bmi     L0005
+	lda     M0001+24
+	ora     M0001+24+1
+	bne     L0009
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	bra     L000F
+L0009:	lda     #<(S0007)
+	ldx     #>(S0007)
+L000F:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     M0001+24
+	ldx     M0001+24+1
+	jmp     incsp6
+
+.segment	"BSS"
+
+M0001:
+	.res	34,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
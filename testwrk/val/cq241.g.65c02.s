@@ -0,0 +1,2091 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "cq241.c", 10193, 1613073744
+	.dbg		file, "common.h", 522, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/stdlib.h", 5999, 1613073744
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_lbits
+	.export		_ubits
+	.export		_fbits
+	.export		_dbits
+	.export		_flgs
+	.export		_flgm
+	.export		_flgd
+	.export		_flgl
+	.export		_rrc
+	.export		_crc
+	.export		_rfs
+	.export		_pow2
+	.export		_d
+	.export		_o
+	.export		_x
+	.export		_s241
+	.export		_section
+	.export		_main
+
+.segment	"RODATA"
+
+S0003:
+	.byte	$44,$65,$63,$69,$6D,$61,$6C,$20,$61,$6E,$64,$20,$6F,$63,$74,$61
+	.byte	$6C,$2F,$68,$65,$78,$20,$63,$6F,$6E,$73,$74,$61,$6E,$74,$73,$20
+	.byte	$73,$6F,$6D,$65,$74,$69,$6D,$65,$73,$20,$67,$69,$76,$65,$0A,$00
+S0004:
+	.byte	$20,$20,$20,$64,$69,$66,$66,$65,$72,$65,$6E,$74,$20,$72,$65,$73
+	.byte	$75,$6C,$74,$73,$20,$77,$68,$65,$6E,$20,$61,$73,$73,$69,$67,$6E
+	.byte	$65,$64,$20,$74,$6F,$20,$6C,$6F,$6E,$67,$73,$2E,$0A,$00
+S0005:
+	.byte	$53,$65,$63,$74,$69,$6F,$6E,$20,$25,$73,$20,$72,$65,$74,$75,$72
+	.byte	$6E,$65,$64,$20,$25,$64,$2E,$0A,$00
+S0006:
+	.byte	$0A,$4E,$6F,$20,$65,$72,$72,$6F,$72,$73,$20,$64,$65,$74,$65,$63
+	.byte	$74,$65,$64,$2E,$0A,$00
+S0007:
+	.byte	$0A,$46,$61,$69,$6C,$65,$64,$2E,$0A,$00
+
+.segment	"BSS"
+
+_lbits:
+	.res	2,$00
+_ubits:
+	.res	2,$00
+_fbits:
+	.res	2,$00
+_dbits:
+	.res	2,$00
+_flgs:
+	.res	2,$00
+_flgm:
+	.res	2,$00
+_flgd:
+	.res	2,$00
+_flgl:
+	.res	2,$00
+_rrc:
+	.res	2,$00
+_crc:
+	.res	2,$00
+_rfs:
+	.res	8,$00
+_d:
+	.res	156,$00
+_o:
+	.res	156,$00
+_x:
+	.res	156,$00
+
+; ---------------------------------------------------------------
+; long __near__ pow2 (long n)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_pow2: near
+
+	.dbg	func, "pow2", "00", extern, "_pow2"
+	.dbg	sym, "n", "00", auto, 0
+	.dbg	sym, "s", "00", auto, -4
+
+.segment	"CODE"
+
+	.dbg	line, "cq241.c", 57
+	jsr     pusheax
+	.dbg	line, "cq241.c", 60
+	jsr     decsp4
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	ldy     #$00
+	jsr     steaxysp
+	.dbg	line, "cq241.c", 61
+	jmp     L0004
+L0002:	ldy     #$03
+	jsr     ldeaxysp
+	jsr     asleax1
+	ldy     #$00
+	jsr     steaxysp
+L0004:	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tsteax
+	php
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	ldy     #$04
+	jsr     lsubeqysp
+	plp
+	jne     L0002
+	.dbg	line, "cq241.c", 62
+	ldy     #$03
+	jsr     ldeaxysp
+	jmp     L0001
+	.dbg	line, "cq241.c", 63
+L0001:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ s241 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s241: near
+
+	.dbg	func, "s241", "00", extern, "_s241"
+	.dbg	sym, "pd0", "00", auto, 0
+	.dbg	sym, "ps", "00", auto, -2
+	.dbg	sym, "pt", "00", auto, -4
+	.dbg	sym, "rc", "00", auto, -6
+	.dbg	sym, "j", "00", auto, -8
+	.dbg	sym, "lrc", "00", auto, -10
+
+.segment	"CODE"
+
+	.dbg	line, "cq241.c", 72
+	jsr     pushax
+	.dbg	line, "cq241.c", 85
+	ldy     #$0A
+	jsr     subysp
+	ldx     #$00
+	lda     #$00
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq241.c", 86
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "cq241.c", 87
+	lda     #<(M0002)
+	ldx     #>(M0002)
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "cq241.c", 88
+	ldy     #$0B
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     incaxy
+	ldy     #$06
+	jsr     staxysp
+	.dbg	line, "cq241.c", 89
+	jmp     L0002
+L0002:	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$00
+	jsr     staspidx
+	tax
+	php
+	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$08
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	jne     L0002
+	.dbg	line, "cq241.c", 114
+	jmp     L0005
+	.dbg	line, "cq241.c", 115
+	ldy     #$05
+	jsr     ldaxysp
+	ina
+	bne     L0006
+	inx
+L0006:	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq241.c", 116
+	ldy     #$0B
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0008
+	cmp     #$00
+L0008:	jsr     boolne
+	jeq     L0005
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq241.c", 128
+L0005:	jmp     L0009
+	.dbg	line, "cq241.c", 129
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     incax2
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq241.c", 130
+	ldy     #$0B
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L000B
+	cmp     #$00
+L000B:	jsr     boolne
+	jeq     L0009
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq241.c", 142
+L0009:	jmp     L000D
+	.dbg	line, "cq241.c", 144
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     incax4
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq241.c", 145
+	ldy     #$0B
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L000E
+	cmp     #$00
+L000E:	jsr     boolne
+	jeq     L000D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$04
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq241.c", 156
+L000D:	jmp     L0010
+	.dbg	line, "cq241.c", 157
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     incax8
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq241.c", 158
+	ldy     #$0B
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0011
+	cmp     #$00
+L0011:	jsr     boolne
+	jeq     L0010
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$08
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq241.c", 172
+L0010:	ldx     #$00
+	lda     #$00
+	ldy     #$02
+	jsr     staxysp
+	jmp     L0012
+L0015:	ldy     #$03
+	jsr     ldaxysp
+	jsr     aslax2
+	clc
+	adc     #<(M0003)
+	tay
+	txa
+	adc     #>(M0003)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     axlong
+	ldy     #$00
+	jsr     steaxspidx
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0012
+L0012:	ldy     #$03
+	jsr     ldaxysp
+	cmp     #$11
+	txa
+	sbc     #$00
+	bvc     L0016
+	eor     #$80
+L0016:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0015
+	.dbg	line, "cq241.c", 173
+	ldx     #$00
+	lda     #$12
+	ldy     #$02
+	jsr     staxysp
+	jmp     L0017
+	.dbg	line, "cq241.c", 174
+L001A:	ldy     #$03
+	jsr     ldaxysp
+	jsr     aslax2
+	clc
+	adc     #<(M0003)
+	tay
+	txa
+	adc     #>(M0003)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax2
+	clc
+	adc     #<(M0003)
+	tay
+	txa
+	adc     #>(M0003)
+	tax
+	tya
+	ldy     #$03
+	jsr     ldeaxidx
+	jsr     _pow2
+	ldy     #$00
+	jsr     steaxspidx
+	.dbg	line, "cq241.c", 175
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     decax1
+	jsr     aslax2
+	clc
+	adc     #<(M0003)
+	tay
+	txa
+	adc     #>(M0003)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     aslax2
+	clc
+	adc     #<(M0003)
+	tay
+	txa
+	adc     #>(M0003)
+	tax
+	tya
+	ldy     #$03
+	jsr     ldeaxidx
+	ldy     #$01
+	jsr     deceaxy
+	ldy     #$00
+	jsr     steaxspidx
+	.dbg	line, "cq241.c", 176
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     incax2
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "cq241.c", 173
+	jmp     L0017
+L0017:	ldy     #$03
+	jsr     ldaxysp
+	cmp     #$27
+	txa
+	sbc     #$00
+	bvc     L001B
+	eor     #$80
+L001B:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L001A
+	.dbg	line, "cq241.c", 179
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	sta     _d
+	stx     _d+1
+	ldy     sreg
+	sty     _d+2
+	ldy     sreg+1
+	sty     _d+3
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	sta     _o
+	stx     _o+1
+	ldy     sreg
+	sty     _o+2
+	ldy     sreg+1
+	sty     _o+3
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	sta     _x
+	stx     _x+1
+	ldy     sreg
+	sty     _x+2
+	ldy     sreg+1
+	sty     _x+3
+	.dbg	line, "cq241.c", 180
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	sta     _d+4
+	stx     _d+4+1
+	ldy     sreg
+	sty     _d+4+2
+	ldy     sreg+1
+	sty     _d+4+3
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	sta     _o+4
+	stx     _o+4+1
+	ldy     sreg
+	sty     _o+4+2
+	ldy     sreg+1
+	sty     _o+4+3
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	sta     _x+4
+	stx     _x+4+1
+	ldy     sreg
+	sty     _x+4+2
+	ldy     sreg+1
+	sty     _x+4+3
+	.dbg	line, "cq241.c", 181
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	sta     _d+8
+	stx     _d+8+1
+	ldy     sreg
+	sty     _d+8+2
+	ldy     sreg+1
+	sty     _d+8+3
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	sta     _o+8
+	stx     _o+8+1
+	ldy     sreg
+	sty     _o+8+2
+	ldy     sreg+1
+	sty     _o+8+3
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	sta     _x+8
+	stx     _x+8+1
+	ldy     sreg
+	sty     _x+8+2
+	ldy     sreg+1
+	sty     _x+8+3
+	.dbg	line, "cq241.c", 182
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$03
+	sta     _d+12
+	stx     _d+12+1
+	ldy     sreg
+	sty     _d+12+2
+	ldy     sreg+1
+	sty     _d+12+3
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$03
+	sta     _o+12
+	stx     _o+12+1
+	ldy     sreg
+	sty     _o+12+2
+	ldy     sreg+1
+	sty     _o+12+3
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$03
+	sta     _x+12
+	stx     _x+12+1
+	ldy     sreg
+	sty     _x+12+2
+	ldy     sreg+1
+	sty     _x+12+3
+	.dbg	line, "cq241.c", 183
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$04
+	sta     _d+16
+	stx     _d+16+1
+	ldy     sreg
+	sty     _d+16+2
+	ldy     sreg+1
+	sty     _d+16+3
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$04
+	sta     _o+16
+	stx     _o+16+1
+	ldy     sreg
+	sty     _o+16+2
+	ldy     sreg+1
+	sty     _o+16+3
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$04
+	sta     _x+16
+	stx     _x+16+1
+	ldy     sreg
+	sty     _x+16+2
+	ldy     sreg+1
+	sty     _x+16+3
+	.dbg	line, "cq241.c", 184
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	sta     _d+20
+	stx     _d+20+1
+	ldy     sreg
+	sty     _d+20+2
+	ldy     sreg+1
+	sty     _d+20+3
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	sta     _o+20
+	stx     _o+20+1
+	ldy     sreg
+	sty     _o+20+2
+	ldy     sreg+1
+	sty     _o+20+3
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	sta     _x+20
+	stx     _x+20+1
+	ldy     sreg
+	sty     _x+20+2
+	ldy     sreg+1
+	sty     _x+20+3
+	.dbg	line, "cq241.c", 185
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$06
+	sta     _d+24
+	stx     _d+24+1
+	ldy     sreg
+	sty     _d+24+2
+	ldy     sreg+1
+	sty     _d+24+3
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$06
+	sta     _o+24
+	stx     _o+24+1
+	ldy     sreg
+	sty     _o+24+2
+	ldy     sreg+1
+	sty     _o+24+3
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$06
+	sta     _x+24
+	stx     _x+24+1
+	ldy     sreg
+	sty     _x+24+2
+	ldy     sreg+1
+	sty     _x+24+3
+	.dbg	line, "cq241.c", 186
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$07
+	sta     _d+28
+	stx     _d+28+1
+	ldy     sreg
+	sty     _d+28+2
+	ldy     sreg+1
+	sty     _d+28+3
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$07
+	sta     _o+28
+	stx     _o+28+1
+	ldy     sreg
+	sty     _o+28+2
+	ldy     sreg+1
+	sty     _o+28+3
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$07
+	sta     _x+28
+	stx     _x+28+1
+	ldy     sreg
+	sty     _x+28+2
+	ldy     sreg+1
+	sty     _x+28+3
+	.dbg	line, "cq241.c", 187
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	sta     _d+32
+	stx     _d+32+1
+	ldy     sreg
+	sty     _d+32+2
+	ldy     sreg+1
+	sty     _d+32+3
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	sta     _o+32
+	stx     _o+32+1
+	ldy     sreg
+	sty     _o+32+2
+	ldy     sreg+1
+	sty     _o+32+3
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	sta     _x+32
+	stx     _x+32+1
+	ldy     sreg
+	sty     _x+32+2
+	ldy     sreg+1
+	sty     _x+32+3
+	.dbg	line, "cq241.c", 188
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$09
+	sta     _d+36
+	stx     _d+36+1
+	ldy     sreg
+	sty     _d+36+2
+	ldy     sreg+1
+	sty     _d+36+3
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$09
+	sta     _o+36
+	stx     _o+36+1
+	ldy     sreg
+	sty     _o+36+2
+	ldy     sreg+1
+	sty     _o+36+3
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$09
+	sta     _x+36
+	stx     _x+36+1
+	ldy     sreg
+	sty     _x+36+2
+	ldy     sreg+1
+	sty     _x+36+3
+	.dbg	line, "cq241.c", 189
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0A
+	sta     _d+40
+	stx     _d+40+1
+	ldy     sreg
+	sty     _d+40+2
+	ldy     sreg+1
+	sty     _d+40+3
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0A
+	sta     _o+40
+	stx     _o+40+1
+	ldy     sreg
+	sty     _o+40+2
+	ldy     sreg+1
+	sty     _o+40+3
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0A
+	sta     _x+40
+	stx     _x+40+1
+	ldy     sreg
+	sty     _x+40+2
+	ldy     sreg+1
+	sty     _x+40+3
+	.dbg	line, "cq241.c", 190
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0B
+	sta     _d+44
+	stx     _d+44+1
+	ldy     sreg
+	sty     _d+44+2
+	ldy     sreg+1
+	sty     _d+44+3
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0B
+	sta     _o+44
+	stx     _o+44+1
+	ldy     sreg
+	sty     _o+44+2
+	ldy     sreg+1
+	sty     _o+44+3
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0B
+	sta     _x+44
+	stx     _x+44+1
+	ldy     sreg
+	sty     _x+44+2
+	ldy     sreg+1
+	sty     _x+44+3
+	.dbg	line, "cq241.c", 191
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0C
+	sta     _d+48
+	stx     _d+48+1
+	ldy     sreg
+	sty     _d+48+2
+	ldy     sreg+1
+	sty     _d+48+3
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0C
+	sta     _o+48
+	stx     _o+48+1
+	ldy     sreg
+	sty     _o+48+2
+	ldy     sreg+1
+	sty     _o+48+3
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0C
+	sta     _x+48
+	stx     _x+48+1
+	ldy     sreg
+	sty     _x+48+2
+	ldy     sreg+1
+	sty     _x+48+3
+	.dbg	line, "cq241.c", 192
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0D
+	sta     _d+52
+	stx     _d+52+1
+	ldy     sreg
+	sty     _d+52+2
+	ldy     sreg+1
+	sty     _d+52+3
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0D
+	sta     _o+52
+	stx     _o+52+1
+	ldy     sreg
+	sty     _o+52+2
+	ldy     sreg+1
+	sty     _o+52+3
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0D
+	sta     _x+52
+	stx     _x+52+1
+	ldy     sreg
+	sty     _x+52+2
+	ldy     sreg+1
+	sty     _x+52+3
+	.dbg	line, "cq241.c", 193
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0E
+	sta     _d+56
+	stx     _d+56+1
+	ldy     sreg
+	sty     _d+56+2
+	ldy     sreg+1
+	sty     _d+56+3
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0E
+	sta     _o+56
+	stx     _o+56+1
+	ldy     sreg
+	sty     _o+56+2
+	ldy     sreg+1
+	sty     _o+56+3
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0E
+	sta     _x+56
+	stx     _x+56+1
+	ldy     sreg
+	sty     _x+56+2
+	ldy     sreg+1
+	sty     _x+56+3
+	.dbg	line, "cq241.c", 194
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0F
+	sta     _d+60
+	stx     _d+60+1
+	ldy     sreg
+	sty     _d+60+2
+	ldy     sreg+1
+	sty     _d+60+3
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0F
+	sta     _o+60
+	stx     _o+60+1
+	ldy     sreg
+	sty     _o+60+2
+	ldy     sreg+1
+	sty     _o+60+3
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0F
+	sta     _x+60
+	stx     _x+60+1
+	ldy     sreg
+	sty     _x+60+2
+	ldy     sreg+1
+	sty     _x+60+3
+	.dbg	line, "cq241.c", 195
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$10
+	sta     _d+64
+	stx     _d+64+1
+	ldy     sreg
+	sty     _d+64+2
+	ldy     sreg+1
+	sty     _d+64+3
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$10
+	sta     _o+64
+	stx     _o+64+1
+	ldy     sreg
+	sty     _o+64+2
+	ldy     sreg+1
+	sty     _o+64+3
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$10
+	sta     _x+64
+	stx     _x+64+1
+	ldy     sreg
+	sty     _x+64+2
+	ldy     sreg+1
+	sty     _x+64+3
+	.dbg	line, "cq241.c", 196
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$3F
+	sta     _d+68
+	stx     _d+68+1
+	ldy     sreg
+	sty     _d+68+2
+	ldy     sreg+1
+	sty     _d+68+3
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$3F
+	sta     _o+68
+	stx     _o+68+1
+	ldy     sreg
+	sty     _o+68+2
+	ldy     sreg+1
+	sty     _o+68+3
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$3F
+	sta     _x+68
+	stx     _x+68+1
+	ldy     sreg
+	sty     _x+68+2
+	ldy     sreg+1
+	sty     _x+68+3
+	.dbg	line, "cq241.c", 197
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$40
+	sta     _d+72
+	stx     _d+72+1
+	ldy     sreg
+	sty     _d+72+2
+	ldy     sreg+1
+	sty     _d+72+3
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$40
+	sta     _o+72
+	stx     _o+72+1
+	ldy     sreg
+	sty     _o+72+2
+	ldy     sreg+1
+	sty     _o+72+3
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$40
+	sta     _x+72
+	stx     _x+72+1
+	ldy     sreg
+	sty     _x+72+2
+	ldy     sreg+1
+	sty     _x+72+3
+	.dbg	line, "cq241.c", 198
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	sta     _d+76
+	stx     _d+76+1
+	ldy     sreg
+	sty     _d+76+2
+	ldy     sreg+1
+	sty     _d+76+3
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	sta     _o+76
+	stx     _o+76+1
+	ldy     sreg
+	sty     _o+76+2
+	ldy     sreg+1
+	sty     _o+76+3
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	sta     _x+76
+	stx     _x+76+1
+	ldy     sreg
+	sty     _x+76+2
+	ldy     sreg+1
+	sty     _x+76+3
+	.dbg	line, "cq241.c", 199
+	ldx     #$01
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	sta     _d+80
+	stx     _d+80+1
+	ldy     sreg
+	sty     _d+80+2
+	ldy     sreg+1
+	sty     _d+80+3
+	ldx     #$01
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	sta     _o+80
+	stx     _o+80+1
+	ldy     sreg
+	sty     _o+80+2
+	ldy     sreg+1
+	sty     _o+80+3
+	ldx     #$01
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	sta     _x+80
+	stx     _x+80+1
+	ldy     sreg
+	sty     _x+80+2
+	ldy     sreg+1
+	sty     _x+80+3
+	.dbg	line, "cq241.c", 200
+	ldx     #$0F
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$FF
+	sta     _d+84
+	stx     _d+84+1
+	ldy     sreg
+	sty     _d+84+2
+	ldy     sreg+1
+	sty     _d+84+3
+	ldx     #$0F
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$FF
+	sta     _o+84
+	stx     _o+84+1
+	ldy     sreg
+	sty     _o+84+2
+	ldy     sreg+1
+	sty     _o+84+3
+	ldx     #$0F
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$FF
+	sta     _x+84
+	stx     _x+84+1
+	ldy     sreg
+	sty     _x+84+2
+	ldy     sreg+1
+	sty     _x+84+3
+	.dbg	line, "cq241.c", 201
+	ldx     #$10
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	sta     _d+88
+	stx     _d+88+1
+	ldy     sreg
+	sty     _d+88+2
+	ldy     sreg+1
+	sty     _d+88+3
+	ldx     #$10
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	sta     _o+88
+	stx     _o+88+1
+	ldy     sreg
+	sty     _o+88+2
+	ldy     sreg+1
+	sty     _o+88+3
+	ldx     #$10
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	sta     _x+88
+	stx     _x+88+1
+	ldy     sreg
+	sty     _x+88+2
+	ldy     sreg+1
+	sty     _x+88+3
+	.dbg	line, "cq241.c", 202
+	ldx     #$FF
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$FF
+	sta     _d+92
+	stx     _d+92+1
+	ldy     sreg
+	sty     _d+92+2
+	ldy     sreg+1
+	sty     _d+92+3
+	ldx     #$FF
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$FF
+	sta     _o+92
+	stx     _o+92+1
+	ldy     sreg
+	sty     _o+92+2
+	ldy     sreg+1
+	sty     _o+92+3
+	ldx     #$FF
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$FF
+	sta     _x+92
+	stx     _x+92+1
+	ldy     sreg
+	sty     _x+92+2
+	ldy     sreg+1
+	sty     _x+92+3
+	.dbg	line, "cq241.c", 203
+	ldx     #$00
+	stx     sreg+1
+	lda     #$01
+	sta     sreg
+	lda     #$00
+	sta     _d+96
+	stx     _d+96+1
+	ldy     sreg
+	sty     _d+96+2
+	ldy     sreg+1
+	sty     _d+96+3
+	ldx     #$00
+	stx     sreg+1
+	lda     #$01
+	sta     sreg
+	lda     #$00
+	sta     _o+96
+	stx     _o+96+1
+	ldy     sreg
+	sty     _o+96+2
+	ldy     sreg+1
+	sty     _o+96+3
+	ldx     #$00
+	stx     sreg+1
+	lda     #$01
+	sta     sreg
+	lda     #$00
+	sta     _x+96
+	stx     _x+96+1
+	ldy     sreg
+	sty     _x+96+2
+	ldy     sreg+1
+	sty     _x+96+3
+	.dbg	line, "cq241.c", 204
+	ldx     #$FF
+	lda     #$03
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$FF
+	sta     _d+100
+	stx     _d+100+1
+	ldy     sreg
+	sty     _d+100+2
+	ldy     sreg+1
+	sty     _d+100+3
+	ldx     #$FF
+	lda     #$03
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$FF
+	sta     _o+100
+	stx     _o+100+1
+	ldy     sreg
+	sty     _o+100+2
+	ldy     sreg+1
+	sty     _o+100+3
+	ldx     #$FF
+	lda     #$03
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$FF
+	sta     _x+100
+	stx     _x+100+1
+	ldy     sreg
+	sty     _x+100+2
+	ldy     sreg+1
+	sty     _x+100+3
+	.dbg	line, "cq241.c", 205
+	ldx     #$00
+	stx     sreg+1
+	lda     #$04
+	sta     sreg
+	lda     #$00
+	sta     _d+104
+	stx     _d+104+1
+	ldy     sreg
+	sty     _d+104+2
+	ldy     sreg+1
+	sty     _d+104+3
+	ldx     #$00
+	stx     sreg+1
+	lda     #$04
+	sta     sreg
+	lda     #$00
+	sta     _o+104
+	stx     _o+104+1
+	ldy     sreg
+	sty     _o+104+2
+	ldy     sreg+1
+	sty     _o+104+3
+	ldx     #$00
+	stx     sreg+1
+	lda     #$04
+	sta     sreg
+	lda     #$00
+	sta     _x+104
+	stx     _x+104+1
+	ldy     sreg
+	sty     _x+104+2
+	ldy     sreg+1
+	sty     _x+104+3
+	.dbg	line, "cq241.c", 206
+	ldx     #$FF
+	lda     #$0F
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$FF
+	sta     _d+108
+	stx     _d+108+1
+	ldy     sreg
+	sty     _d+108+2
+	ldy     sreg+1
+	sty     _d+108+3
+	ldx     #$FF
+	lda     #$0F
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$FF
+	sta     _o+108
+	stx     _o+108+1
+	ldy     sreg
+	sty     _o+108+2
+	ldy     sreg+1
+	sty     _o+108+3
+	ldx     #$FF
+	lda     #$0F
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$FF
+	sta     _x+108
+	stx     _x+108+1
+	ldy     sreg
+	sty     _x+108+2
+	ldy     sreg+1
+	sty     _x+108+3
+	.dbg	line, "cq241.c", 207
+	ldx     #$00
+	stx     sreg+1
+	lda     #$10
+	sta     sreg
+	lda     #$00
+	sta     _d+112
+	stx     _d+112+1
+	ldy     sreg
+	sty     _d+112+2
+	ldy     sreg+1
+	sty     _d+112+3
+	ldx     #$00
+	stx     sreg+1
+	lda     #$10
+	sta     sreg
+	lda     #$00
+	sta     _o+112
+	stx     _o+112+1
+	ldy     sreg
+	sty     _o+112+2
+	ldy     sreg+1
+	sty     _o+112+3
+	ldx     #$00
+	stx     sreg+1
+	lda     #$10
+	sta     sreg
+	lda     #$00
+	sta     _x+112
+	stx     _x+112+1
+	ldy     sreg
+	sty     _x+112+2
+	ldy     sreg+1
+	sty     _x+112+3
+	.dbg	line, "cq241.c", 208
+	ldx     #$FF
+	stx     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$FF
+	sta     _d+116
+	stx     _d+116+1
+	ldy     sreg
+	sty     _d+116+2
+	ldy     sreg+1
+	sty     _d+116+3
+	ldx     #$FF
+	stx     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$FF
+	sta     _o+116
+	stx     _o+116+1
+	ldy     sreg
+	sty     _o+116+2
+	ldy     sreg+1
+	sty     _o+116+3
+	ldx     #$FF
+	stx     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$FF
+	sta     _x+116
+	stx     _x+116+1
+	ldy     sreg
+	sty     _x+116+2
+	ldy     sreg+1
+	sty     _x+116+3
+	.dbg	line, "cq241.c", 209
+	ldx     #$00
+	stx     sreg
+	lda     #$01
+	sta     sreg+1
+	lda     #$00
+	sta     _d+120
+	stx     _d+120+1
+	ldy     sreg
+	sty     _d+120+2
+	ldy     sreg+1
+	sty     _d+120+3
+	ldx     #$00
+	stx     sreg
+	lda     #$01
+	sta     sreg+1
+	lda     #$00
+	sta     _o+120
+	stx     _o+120+1
+	ldy     sreg
+	sty     _o+120+2
+	ldy     sreg+1
+	sty     _o+120+3
+	ldx     #$00
+	stx     sreg
+	lda     #$01
+	sta     sreg+1
+	lda     #$00
+	sta     _x+120
+	stx     _x+120+1
+	ldy     sreg
+	sty     _x+120+2
+	ldy     sreg+1
+	sty     _x+120+3
+	.dbg	line, "cq241.c", 210
+	ldx     #$FF
+	stx     sreg
+	lda     #$0F
+	sta     sreg+1
+	lda     #$FF
+	sta     _d+124
+	stx     _d+124+1
+	ldy     sreg
+	sty     _d+124+2
+	ldy     sreg+1
+	sty     _d+124+3
+	ldx     #$FF
+	stx     sreg
+	lda     #$0F
+	sta     sreg+1
+	lda     #$FF
+	sta     _o+124
+	stx     _o+124+1
+	ldy     sreg
+	sty     _o+124+2
+	ldy     sreg+1
+	sty     _o+124+3
+	ldx     #$FF
+	stx     sreg
+	lda     #$0F
+	sta     sreg+1
+	lda     #$FF
+	sta     _x+124
+	stx     _x+124+1
+	ldy     sreg
+	sty     _x+124+2
+	ldy     sreg+1
+	sty     _x+124+3
+	.dbg	line, "cq241.c", 211
+	ldx     #$00
+	stx     sreg
+	lda     #$10
+	sta     sreg+1
+	lda     #$00
+	sta     _d+128
+	stx     _d+128+1
+	ldy     sreg
+	sty     _d+128+2
+	ldy     sreg+1
+	sty     _d+128+3
+	ldx     #$00
+	stx     sreg
+	lda     #$10
+	sta     sreg+1
+	lda     #$00
+	sta     _o+128
+	stx     _o+128+1
+	ldy     sreg
+	sty     _o+128+2
+	ldy     sreg+1
+	sty     _o+128+3
+	ldx     #$00
+	stx     sreg
+	lda     #$10
+	sta     sreg+1
+	lda     #$00
+	sta     _x+128
+	stx     _x+128+1
+	ldy     sreg
+	sty     _x+128+2
+	ldy     sreg+1
+	sty     _x+128+3
+	.dbg	line, "cq241.c", 212
+	ldx     #$FF
+	stx     sreg
+	lda     #$3F
+	sta     sreg+1
+	lda     #$FF
+	sta     _d+132
+	stx     _d+132+1
+	ldy     sreg
+	sty     _d+132+2
+	ldy     sreg+1
+	sty     _d+132+3
+	ldx     #$FF
+	stx     sreg
+	lda     #$3F
+	sta     sreg+1
+	lda     #$FF
+	sta     _o+132
+	stx     _o+132+1
+	ldy     sreg
+	sty     _o+132+2
+	ldy     sreg+1
+	sty     _o+132+3
+	ldx     #$FF
+	stx     sreg
+	lda     #$3F
+	sta     sreg+1
+	lda     #$FF
+	sta     _x+132
+	stx     _x+132+1
+	ldy     sreg
+	sty     _x+132+2
+	ldy     sreg+1
+	sty     _x+132+3
+	.dbg	line, "cq241.c", 213
+	ldx     #$00
+	stx     sreg
+	lda     #$40
+	sta     sreg+1
+	lda     #$00
+	sta     _d+136
+	stx     _d+136+1
+	ldy     sreg
+	sty     _d+136+2
+	ldy     sreg+1
+	sty     _d+136+3
+	ldx     #$00
+	stx     sreg
+	lda     #$40
+	sta     sreg+1
+	lda     #$00
+	sta     _o+136
+	stx     _o+136+1
+	ldy     sreg
+	sty     _o+136+2
+	ldy     sreg+1
+	sty     _o+136+3
+	ldx     #$00
+	stx     sreg
+	lda     #$40
+	sta     sreg+1
+	lda     #$00
+	sta     _x+136
+	stx     _x+136+1
+	ldy     sreg
+	sty     _x+136+2
+	ldy     sreg+1
+	sty     _x+136+3
+	.dbg	line, "cq241.c", 214
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	sta     _d+140
+	stx     _d+140+1
+	ldy     sreg
+	sty     _d+140+2
+	ldy     sreg+1
+	sty     _d+140+3
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	sta     _o+140
+	stx     _o+140+1
+	ldy     sreg
+	sty     _o+140+2
+	ldy     sreg+1
+	sty     _o+140+3
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	sta     _x+140
+	stx     _x+140+1
+	ldy     sreg
+	sty     _x+140+2
+	ldy     sreg+1
+	sty     _x+140+3
+	.dbg	line, "cq241.c", 215
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	sta     _d+144
+	stx     _d+144+1
+	ldy     sreg
+	sty     _d+144+2
+	ldy     sreg+1
+	sty     _d+144+3
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	sta     _o+144
+	stx     _o+144+1
+	ldy     sreg
+	sty     _o+144+2
+	ldy     sreg+1
+	sty     _o+144+3
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	sta     _x+144
+	stx     _x+144+1
+	ldy     sreg
+	sty     _x+144+2
+	ldy     sreg+1
+	sty     _x+144+3
+	.dbg	line, "cq241.c", 216
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	sta     _d+148
+	stx     _d+148+1
+	ldy     sreg
+	sty     _d+148+2
+	ldy     sreg+1
+	sty     _d+148+3
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	sta     _o+148
+	stx     _o+148+1
+	ldy     sreg
+	sty     _o+148+2
+	ldy     sreg+1
+	sty     _o+148+3
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	sta     _x+148
+	stx     _x+148+1
+	ldy     sreg
+	sty     _x+148+2
+	ldy     sreg+1
+	sty     _x+148+3
+	.dbg	line, "cq241.c", 217
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	sta     _d+152
+	stx     _d+152+1
+	ldy     sreg
+	sty     _d+152+2
+	ldy     sreg+1
+	sty     _d+152+3
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	sta     _o+152
+	stx     _o+152+1
+	ldy     sreg
+	sty     _o+152+2
+	ldy     sreg+1
+	sty     _o+152+3
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	sta     _x+152
+	stx     _x+152+1
+	ldy     sreg
+	sty     _x+152+2
+	ldy     sreg+1
+	sty     _x+152+3
+	.dbg	line, "cq241.c", 221
+	ldx     #$00
+	lda     #$00
+	ldy     #$02
+	jsr     staxysp
+	jmp     L001C
+	.dbg	line, "cq241.c", 222
+L001F:	ldy     #$03
+	jsr     ldaxysp
+	jsr     aslax2
+	clc
+	adc     #<(M0003)
+	tay
+	txa
+	adc     #>(M0003)
+	tax
+	tya
+	ldy     #$03
+	jsr     ldeaxidx
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax2
+	clc
+	adc     #<(_d)
+	tay
+	txa
+	adc     #>(_d)
+	tax
+	tya
+	.dbg	line, "cq241.c", 223
+	ldy     #$03
+	jsr     ldeaxidx
+	jsr     tosneeax
+	jne     L0022
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     aslax2
+	clc
+	adc     #<(_d)
+	tay
+	txa
+	adc     #>(_d)
+	tax
+	tya
+	ldy     #$03
+	jsr     ldeaxidx
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax2
+	clc
+	adc     #<(_o)
+	tay
+	txa
+	adc     #>(_o)
+	tax
+	tya
+	.dbg	line, "cq241.c", 224
+	ldy     #$03
+	jsr     ldeaxidx
+	jsr     tosneeax
+	jne     L0022
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     aslax2
+	clc
+	adc     #<(_o)
+	tay
+	txa
+	adc     #>(_o)
+	tax
+	tya
+	ldy     #$03
+	jsr     ldeaxidx
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax2
+	clc
+	adc     #<(_x)
+	tay
+	txa
+	adc     #>(_x)
+	tax
+	tya
+	ldy     #$03
+	jsr     ldeaxidx
+	jsr     tosneeax
+	jne     L0022
+	ldx     #$00
+	lda     #$00
+	jeq     L0023
+L0022:	ldx     #$00
+	lda     #$01
+L0023:	jeq     L0024
+	.dbg	line, "cq241.c", 225
+	ldy     #$0B
+	jsr     ldaxysp
+	ldy     #$11
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0025
+	cmp     #$00
+L0025:	jsr     boolne
+	jeq     L0024
+	.dbg	line, "cq241.c", 227
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cq241.c", 228
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cq241.c", 221
+L0024:	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L001C
+L001C:	ldy     #$03
+	jsr     ldaxysp
+	cmp     #$27
+	txa
+	sbc     #$00
+	bvc     L0020
+	eor     #$80
+L0020:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L001F
+	.dbg	line, "cq241.c", 234
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0027
+	cmp     #$00
+L0027:	jsr     boolne
+	jeq     L0026
+	ldx     #$00
+	lda     #$10
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq241.c", 236
+L0026:	ldy     #$05
+	jsr     ldaxysp
+	jmp     L0001
+	.dbg	line, "cq241.c", 237
+L0001:	ldy     #$0C
+	jsr     addysp
+	rts
+
+	.dbg	line
+.segment	"DATA"
+
+M0001:
+	.byte	$73,$32,$34,$31,$2C,$65,$72,$25,$64,$0A,$00
+M0002:
+	.byte	$73,$32,$34,$31,$20,$20,$20,$00
+M0003:
+	.dword	$00000000
+	.dword	$00000000
+	.dword	$00000000
+	.dword	$00000000
+	.dword	$00000000
+	.dword	$00000000
+	.dword	$00000000
+	.dword	$00000000
+	.dword	$00000000
+	.dword	$00000000
+	.dword	$00000000
+	.dword	$00000000
+	.dword	$00000000
+	.dword	$00000000
+	.dword	$00000000
+	.dword	$00000000
+	.dword	$00000000
+	.dword	$00000000
+	.dword	$00000006
+	.dword	$00000000
+	.dword	$00000008
+	.dword	$00000000
+	.dword	$0000000C
+	.dword	$00000000
+	.dword	$00000010
+	.dword	$00000000
+	.dword	$00000012
+	.dword	$00000000
+	.dword	$00000014
+	.dword	$00000000
+	.dword	$00000018
+	.dword	$00000000
+	.dword	$0000001C
+	.dword	$00000000
+	.dword	$0000001E
+	.dword	$00000000
+	.dword	$00000020
+	.dword	$00000000
+	.dword	$00000024
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ section (int j, void *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_section: near
+
+	.dbg	func, "section", "00", extern, "_section"
+	.dbg	sym, "j", "00", auto, 2
+	.dbg	sym, "pd0", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "cq241.c", 248
+	jsr     pushax
+	.dbg	line, "cq241.c", 250
+	ldy     #$03
+	jsr     ldaxysp
+	jmp     L0002
+	.dbg	line, "cq241.c", 252
+L0002:	cpx     #$00
+	jne     L0005
+	cmp     #$00
+	jeq     L0004
+	jmp     L0003
+L0005:	jmp     L0003
+	.dbg	line, "cq241.c", 251
+L0004:	ldy     #$01
+	jsr     ldaxysp
+	jsr     _s241
+	jmp     L0003
+	.dbg	line, "cq241.c", 253
+L0003:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+	.dbg	sym, "n", "00", auto, 2
+	.dbg	sym, "args", "00", auto, 0
+	.dbg	sym, "j", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "cq241.c", 271
+	jsr     decsp2
+	ldx     #$00
+	lda     #$01
+	sta     M0001+14
+	stx     M0001+14+1
+	.dbg	line, "cq241.c", 272
+	ldx     #$00
+	lda     #$01
+	sta     M0001+16
+	stx     M0001+16+1
+	.dbg	line, "cq241.c", 273
+	ldx     #$00
+	lda     #$01
+	sta     M0001+18
+	stx     M0001+18+1
+	.dbg	line, "cq241.c", 274
+	ldx     #$00
+	lda     #$01
+	sta     M0001+20
+	stx     M0001+20+1
+	.dbg	line, "cq241.c", 276
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	sta     M0002
+	stx     M0002+1
+	.dbg	line, "cq241.c", 278
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+	jmp     L0002
+	.dbg	line, "cq241.c", 279
+L0005:	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	lda     M0002
+	ldx     M0002+1
+	jsr     _section
+	sta     M0001+22
+	stx     M0001+22+1
+	.dbg	line, "cq241.c", 280
+	lda     M0001+24
+	ldx     M0001+24+1
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     tosaddax
+	sta     M0001+24
+	stx     M0001+24+1
+	.dbg	line, "cq241.c", 281
+	lda     M0001+14
+	ldx     M0001+14+1
+	cpx     #$00
+	bne     L0008
+	cmp     #$00
+L0008:	jsr     boolne
+	jeq     L0007
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     #<(M0001+26)
+	ldx     #>(M0001+26)
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "cq241.c", 278
+L0007:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0005
+	.dbg	line, "cq241.c", 284
+	lda     M0001+24
+	ldx     M0001+24+1
+	cpx     #$00
+	bne     L000A
+	cmp     #$00
+L000A:	jsr     booleq
+	jeq     L0009
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cq241.c", 285
+	jmp     L000B
+L0009:	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cq241.c", 287
+L000B:	lda     M0001+24
+	ldx     M0001+24+1
+	jmp     L0001
+	.dbg	line, "cq241.c", 288
+L0001:	jsr     incsp6
+	rts
+
+	.dbg	line
+.segment	"BSS"
+
+M0001:
+	.res	34,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
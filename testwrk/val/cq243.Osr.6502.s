@@ -0,0 +1,469 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_printf
+	.export		_lbits
+	.export		_ubits
+	.export		_fbits
+	.export		_dbits
+	.export		_flgs
+	.export		_flgm
+	.export		_flgd
+	.export		_flgl
+	.export		_rrc
+	.export		_crc
+	.export		_rfs
+	.export		_zerofill
+	.export		_sumof
+	.export		_chars
+	.export		_s243
+	.export		_section
+	.export		_main
+
+.segment	"RODATA"
+
+S0003:
+	.byte	$53,$65,$63,$74,$69,$6F,$6E,$20,$25,$73,$20,$72,$65,$74,$75,$72
+	.byte	$6E,$65,$64,$20,$25,$64,$2E,$0A,$00
+S0004:
+	.byte	$0A,$4E,$6F,$20,$65,$72,$72,$6F,$72,$73,$20,$64,$65,$74,$65,$63
+	.byte	$74,$65,$64,$2E,$0A,$00
+S0005:
+	.byte	$0A,$46,$61,$69,$6C,$65,$64,$2E,$0A,$00
+
+.segment	"BSS"
+
+_lbits:
+	.res	2,$00
+_ubits:
+	.res	2,$00
+_fbits:
+	.res	2,$00
+_dbits:
+	.res	2,$00
+_flgs:
+	.res	2,$00
+_flgm:
+	.res	2,$00
+_flgd:
+	.res	2,$00
+_flgl:
+	.res	2,$00
+_rrc:
+	.res	2,$00
+_crc:
+	.res	2,$00
+_rfs:
+	.res	8,$00
+_chars:
+	.res	256,$00
+
+; ---------------------------------------------------------------
+; void __near__ zerofill (char *x)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_zerofill: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp2
+	ldx     #$00
+	txa
+	jsr     stax0sp
+	jmp     L0002
+L0005:	ldy     #$03
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$00
+	tay
+	sta     (ptr1),y
+	ldy     #$02
+	tax
+	lda     #$01
+	jsr     addeqysp
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+L0002:	jsr     ldax0sp
+	cmp     #$00
+	txa
+	sbc     #$01
+	bvc     L0006
+	eor     #$80
+L0006:	bmi     L0005
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ sumof (char *x)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_sumof: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp6
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$04
+	jsr     staxysp
+	ldx     #$00
+	txa
+	ldy     #$02
+	jsr     staxysp
+	jsr     stax0sp
+	jmp     L0002
+L0005:	ldy     #$05
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	clc
+	ldy     #$02
+	adc     (sp),y
+	pha
+	lda     #$00
+	iny
+	adc     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+L0002:	jsr     ldax0sp
+	cmp     #$00
+	txa
+	sbc     #$01
+	bvc     L0006
+	eor     #$80
+L0006:	bmi     L0005
+	ldy     #$03
+	jsr     ldaxysp
+	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ s243 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s243: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp6
+	ldx     #$00
+	txa
+	jsr     stax0sp
+	lda     #<(M0002)
+	ldx     #>(M0002)
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     incaxy
+	ldy     #$02
+	jsr     staxysp
+L0002:	ldy     #$03
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$05
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	sta     (sreg),y
+	tax
+	php
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	bne     L0002
+	lda     #<(_chars)
+	ldx     #>(_chars)
+	jsr     _zerofill
+	lda     #$01
+	sta     _chars+97
+	sta     _chars+65
+	sta     _chars+126
+	sta     _chars+48
+	sta     _chars+98
+	sta     _chars+66
+	sta     _chars+33
+	sta     _chars+49
+	sta     _chars+99
+	sta     _chars+67
+	sta     _chars+34
+	sta     _chars+50
+	sta     _chars+100
+	sta     _chars+68
+	sta     _chars+35
+	sta     _chars+51
+	sta     _chars+101
+	sta     _chars+69
+	sta     _chars+37
+	sta     _chars+52
+	sta     _chars+102
+	sta     _chars+70
+	sta     _chars+38
+	sta     _chars+53
+	sta     _chars+103
+	sta     _chars+71
+	sta     _chars+40
+	sta     _chars+54
+	sta     _chars+104
+	sta     _chars+72
+	sta     _chars+41
+	sta     _chars+55
+	sta     _chars+105
+	sta     _chars+73
+	sta     _chars+95
+	sta     _chars+56
+	sta     _chars+106
+	sta     _chars+74
+	sta     _chars+61
+	sta     _chars+57
+	sta     _chars+107
+	sta     _chars+75
+	sta     _chars+45
+	sta     _chars+108
+	sta     _chars+76
+	sta     _chars+94
+	sta     _chars+109
+	sta     _chars+77
+	sta     _chars+124
+	sta     _chars+10
+	sta     _chars+110
+	sta     _chars+78
+	sta     _chars+9
+	sta     _chars+111
+	sta     _chars+79
+	sta     _chars+123
+	sta     _chars+8
+	sta     _chars+112
+	sta     _chars+80
+	sta     _chars+125
+	sta     _chars+13
+	sta     _chars+113
+	sta     _chars+81
+	sta     _chars+91
+	sta     _chars+12
+	sta     _chars+114
+	sta     _chars+82
+	sta     _chars+93
+	sta     _chars+115
+	sta     _chars+83
+	sta     _chars+43
+	sta     _chars+92
+	sta     _chars+116
+	sta     _chars+84
+	sta     _chars+59
+	sta     _chars+39
+	sta     _chars+117
+	sta     _chars+85
+	sta     _chars+42
+	sta     _chars+118
+	sta     _chars+86
+	sta     _chars+58
+	sta     _chars
+	sta     _chars+119
+	sta     _chars+87
+	sta     _chars+60
+	sta     _chars+32
+	sta     _chars+120
+	sta     _chars+88
+	sta     _chars+62
+	sta     _chars+121
+	sta     _chars+89
+	sta     _chars+44
+	sta     _chars+122
+	sta     _chars+90
+	sta     _chars+46
+	sta     _chars+63
+	sta     _chars+47
+	lda     #<(_chars)
+	ldx     #>(_chars)
+	jsr     _sumof
+	cpx     #$00
+	bne     L000C
+	cmp     #$62
+	beq     L000A
+L000C:	jsr     ldax0sp
+	jsr     incax1
+	jsr     stax0sp
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L000D
+	cmp     #$00
+	beq     L000A
+L000D:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L000A:	jsr     ldax0sp
+	jmp     incsp8
+
+.segment	"DATA"
+
+M0001:
+	.byte	$73,$32,$34,$33,$2C,$65,$72,$25,$64,$0A,$00
+M0002:
+	.byte	$73,$32,$34,$33,$20,$20,$20,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ section (int j, void *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_section: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$02
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	bne     L0003
+	jsr     ldax0sp
+	jsr     _s243
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	ldx     #$00
+	lda     #$01
+	sta     M0001+14
+	stx     M0001+14+1
+	sta     M0001+16
+	stx     M0001+16+1
+	sta     M0001+18
+	stx     M0001+18+1
+	sta     M0001+20
+	stx     M0001+20+1
+	lda     #>(M0001)
+	sta     M0002+1
+	lda     #<(M0001)
+	sta     M0002
+	txa
+	jsr     stax0sp
+	jmp     L0002
+L0005:	jsr     pushw0sp
+	lda     M0002
+	ldx     M0002+1
+	jsr     _section
+	sta     M0001+22
+	stx     M0001+22+1
+	lda     M0001+24
+	clc
+	adc     M0001+22
+	sta     M0001+24
+	lda     M0001+24+1
+	adc     M0001+22+1
+	sta     M0001+24+1
+	lda     M0001+14
+	ora     M0001+14+1
+	beq     L0007
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     #<(M0001+26)
+	ldx     #>(M0001+26)
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+L0007:	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+L0002:	jsr     ldax0sp
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	bmi     L0005
+	lda     M0001+24
+	ora     M0001+24+1
+	bne     L0009
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jmp     L000E
+L0009:	lda     #<(S0005)
+	ldx     #>(S0005)
+L000E:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     M0001+24
+	ldx     M0001+24+1
+	jmp     incsp6
+
+.segment	"BSS"
+
+M0001:
+	.res	34,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
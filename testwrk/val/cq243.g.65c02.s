@@ -0,0 +1,863 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "cq243.c", 8618, 1613073744
+	.dbg		file, "common.h", 522, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/stdlib.h", 5999, 1613073744
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_lbits
+	.export		_ubits
+	.export		_fbits
+	.export		_dbits
+	.export		_flgs
+	.export		_flgm
+	.export		_flgd
+	.export		_flgl
+	.export		_rrc
+	.export		_crc
+	.export		_rfs
+	.export		_zerofill
+	.export		_sumof
+	.export		_chars
+	.export		_s243
+	.export		_section
+	.export		_main
+
+.segment	"RODATA"
+
+S0003:
+	.byte	$53,$65,$63,$74,$69,$6F,$6E,$20,$25,$73,$20,$72,$65,$74,$75,$72
+	.byte	$6E,$65,$64,$20,$25,$64,$2E,$0A,$00
+S0004:
+	.byte	$0A,$4E,$6F,$20,$65,$72,$72,$6F,$72,$73,$20,$64,$65,$74,$65,$63
+	.byte	$74,$65,$64,$2E,$0A,$00
+S0005:
+	.byte	$0A,$46,$61,$69,$6C,$65,$64,$2E,$0A,$00
+
+.segment	"BSS"
+
+_lbits:
+	.res	2,$00
+_ubits:
+	.res	2,$00
+_fbits:
+	.res	2,$00
+_dbits:
+	.res	2,$00
+_flgs:
+	.res	2,$00
+_flgm:
+	.res	2,$00
+_flgd:
+	.res	2,$00
+_flgl:
+	.res	2,$00
+_rrc:
+	.res	2,$00
+_crc:
+	.res	2,$00
+_rfs:
+	.res	8,$00
+_chars:
+	.res	256,$00
+
+; ---------------------------------------------------------------
+; void __near__ zerofill (char *x)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_zerofill: near
+
+	.dbg	func, "zerofill", "00", extern, "_zerofill"
+	.dbg	sym, "x", "00", auto, 0
+	.dbg	sym, "j", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "cq243.c", 55
+	jsr     pushax
+	.dbg	line, "cq243.c", 59
+	jsr     decsp2
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+	jmp     L0002
+L0005:	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staspidx
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	cmp     #$00
+	txa
+	sbc     #$01
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0005
+	.dbg	line, "cq243.c", 60
+	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ sumof (char *x)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_sumof: near
+
+	.dbg	func, "sumof", "00", extern, "_sumof"
+	.dbg	sym, "x", "00", auto, 0
+	.dbg	sym, "p", "00", auto, -2
+	.dbg	sym, "total", "00", auto, -4
+	.dbg	sym, "j", "00", auto, -6
+
+.segment	"CODE"
+
+	.dbg	line, "cq243.c", 67
+	jsr     pushax
+	.dbg	line, "cq243.c", 72
+	jsr     decsp6
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq243.c", 73
+	ldx     #$00
+	lda     #$00
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "cq243.c", 75
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+	jmp     L0002
+L0005:	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	jsr     tosaddax
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	cmp     #$00
+	txa
+	sbc     #$01
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0005
+	.dbg	line, "cq243.c", 76
+	ldy     #$03
+	jsr     ldaxysp
+	jmp     L0001
+	.dbg	line, "cq243.c", 77
+L0001:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ s243 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s243: near
+
+	.dbg	func, "s243", "00", extern, "_s243"
+	.dbg	sym, "pd0", "00", auto, 0
+	.dbg	sym, "ps", "00", auto, -2
+	.dbg	sym, "pt", "00", auto, -4
+	.dbg	sym, "rc", "00", auto, -6
+
+.segment	"CODE"
+
+	.dbg	line, "cq243.c", 86
+	jsr     pushax
+	.dbg	line, "cq243.c", 94
+	jsr     decsp6
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "cq243.c", 95
+	lda     #<(M0002)
+	ldx     #>(M0002)
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq243.c", 96
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     incaxy
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "cq243.c", 97
+	jmp     L0002
+L0002:	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$00
+	jsr     staspidx
+	tax
+	php
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	jne     L0002
+	.dbg	line, "cq243.c", 132
+	lda     #<(_chars)
+	ldx     #>(_chars)
+	jsr     _zerofill
+	.dbg	line, "cq243.c", 134
+	ldx     #$00
+	lda     #$01
+	sta     _chars+97
+	ldx     #$00
+	lda     #$01
+	sta     _chars+65
+	ldx     #$00
+	lda     #$01
+	sta     _chars+126
+	ldx     #$00
+	lda     #$01
+	sta     _chars+48
+	.dbg	line, "cq243.c", 135
+	ldx     #$00
+	lda     #$01
+	sta     _chars+98
+	ldx     #$00
+	lda     #$01
+	sta     _chars+66
+	ldx     #$00
+	lda     #$01
+	sta     _chars+33
+	ldx     #$00
+	lda     #$01
+	sta     _chars+49
+	.dbg	line, "cq243.c", 136
+	ldx     #$00
+	lda     #$01
+	sta     _chars+99
+	ldx     #$00
+	lda     #$01
+	sta     _chars+67
+	ldx     #$00
+	lda     #$01
+	sta     _chars+34
+	ldx     #$00
+	lda     #$01
+	sta     _chars+50
+	.dbg	line, "cq243.c", 137
+	ldx     #$00
+	lda     #$01
+	sta     _chars+100
+	ldx     #$00
+	lda     #$01
+	sta     _chars+68
+	ldx     #$00
+	lda     #$01
+	sta     _chars+35
+	ldx     #$00
+	lda     #$01
+	sta     _chars+51
+	.dbg	line, "cq243.c", 138
+	ldx     #$00
+	lda     #$01
+	sta     _chars+101
+	ldx     #$00
+	lda     #$01
+	sta     _chars+69
+	ldx     #$00
+	lda     #$01
+	sta     _chars+37
+	ldx     #$00
+	lda     #$01
+	sta     _chars+52
+	.dbg	line, "cq243.c", 139
+	ldx     #$00
+	lda     #$01
+	sta     _chars+102
+	ldx     #$00
+	lda     #$01
+	sta     _chars+70
+	ldx     #$00
+	lda     #$01
+	sta     _chars+38
+	ldx     #$00
+	lda     #$01
+	sta     _chars+53
+	.dbg	line, "cq243.c", 140
+	ldx     #$00
+	lda     #$01
+	sta     _chars+103
+	ldx     #$00
+	lda     #$01
+	sta     _chars+71
+	ldx     #$00
+	lda     #$01
+	sta     _chars+40
+	ldx     #$00
+	lda     #$01
+	sta     _chars+54
+	.dbg	line, "cq243.c", 141
+	ldx     #$00
+	lda     #$01
+	sta     _chars+104
+	ldx     #$00
+	lda     #$01
+	sta     _chars+72
+	ldx     #$00
+	lda     #$01
+	sta     _chars+41
+	ldx     #$00
+	lda     #$01
+	sta     _chars+55
+	.dbg	line, "cq243.c", 142
+	ldx     #$00
+	lda     #$01
+	sta     _chars+105
+	ldx     #$00
+	lda     #$01
+	sta     _chars+73
+	ldx     #$00
+	lda     #$01
+	sta     _chars+95
+	ldx     #$00
+	lda     #$01
+	sta     _chars+56
+	.dbg	line, "cq243.c", 143
+	ldx     #$00
+	lda     #$01
+	sta     _chars+106
+	ldx     #$00
+	lda     #$01
+	sta     _chars+74
+	ldx     #$00
+	lda     #$01
+	sta     _chars+61
+	ldx     #$00
+	lda     #$01
+	sta     _chars+57
+	.dbg	line, "cq243.c", 144
+	ldx     #$00
+	lda     #$01
+	sta     _chars+107
+	ldx     #$00
+	lda     #$01
+	sta     _chars+75
+	ldx     #$00
+	lda     #$01
+	sta     _chars+45
+	.dbg	line, "cq243.c", 145
+	ldx     #$00
+	lda     #$01
+	sta     _chars+108
+	ldx     #$00
+	lda     #$01
+	sta     _chars+76
+	ldx     #$00
+	lda     #$01
+	sta     _chars+94
+	.dbg	line, "cq243.c", 146
+	ldx     #$00
+	lda     #$01
+	sta     _chars+109
+	ldx     #$00
+	lda     #$01
+	sta     _chars+77
+	ldx     #$00
+	lda     #$01
+	sta     _chars+124
+	ldx     #$00
+	lda     #$01
+	sta     _chars+10
+	.dbg	line, "cq243.c", 147
+	ldx     #$00
+	lda     #$01
+	sta     _chars+110
+	ldx     #$00
+	lda     #$01
+	sta     _chars+78
+	ldx     #$00
+	lda     #$01
+	sta     _chars+9
+	.dbg	line, "cq243.c", 148
+	ldx     #$00
+	lda     #$01
+	sta     _chars+111
+	ldx     #$00
+	lda     #$01
+	sta     _chars+79
+	ldx     #$00
+	lda     #$01
+	sta     _chars+123
+	ldx     #$00
+	lda     #$01
+	sta     _chars+8
+	.dbg	line, "cq243.c", 149
+	ldx     #$00
+	lda     #$01
+	sta     _chars+112
+	ldx     #$00
+	lda     #$01
+	sta     _chars+80
+	ldx     #$00
+	lda     #$01
+	sta     _chars+125
+	ldx     #$00
+	lda     #$01
+	sta     _chars+13
+	.dbg	line, "cq243.c", 150
+	ldx     #$00
+	lda     #$01
+	sta     _chars+113
+	ldx     #$00
+	lda     #$01
+	sta     _chars+81
+	ldx     #$00
+	lda     #$01
+	sta     _chars+91
+	ldx     #$00
+	lda     #$01
+	sta     _chars+12
+	.dbg	line, "cq243.c", 151
+	ldx     #$00
+	lda     #$01
+	sta     _chars+114
+	ldx     #$00
+	lda     #$01
+	sta     _chars+82
+	ldx     #$00
+	lda     #$01
+	sta     _chars+93
+	.dbg	line, "cq243.c", 152
+	ldx     #$00
+	lda     #$01
+	sta     _chars+115
+	ldx     #$00
+	lda     #$01
+	sta     _chars+83
+	ldx     #$00
+	lda     #$01
+	sta     _chars+43
+	ldx     #$00
+	lda     #$01
+	sta     _chars+92
+	.dbg	line, "cq243.c", 153
+	ldx     #$00
+	lda     #$01
+	sta     _chars+116
+	ldx     #$00
+	lda     #$01
+	sta     _chars+84
+	ldx     #$00
+	lda     #$01
+	sta     _chars+59
+	ldx     #$00
+	lda     #$01
+	sta     _chars+39
+	.dbg	line, "cq243.c", 154
+	ldx     #$00
+	lda     #$01
+	sta     _chars+117
+	ldx     #$00
+	lda     #$01
+	sta     _chars+85
+	ldx     #$00
+	lda     #$01
+	sta     _chars+42
+	.dbg	line, "cq243.c", 155
+	ldx     #$00
+	lda     #$01
+	sta     _chars+118
+	ldx     #$00
+	lda     #$01
+	sta     _chars+86
+	ldx     #$00
+	lda     #$01
+	sta     _chars+58
+	ldx     #$00
+	lda     #$01
+	sta     _chars
+	.dbg	line, "cq243.c", 156
+	ldx     #$00
+	lda     #$01
+	sta     _chars+119
+	ldx     #$00
+	lda     #$01
+	sta     _chars+87
+	ldx     #$00
+	lda     #$01
+	sta     _chars+60
+	ldx     #$00
+	lda     #$01
+	sta     _chars+32
+	.dbg	line, "cq243.c", 157
+	ldx     #$00
+	lda     #$01
+	sta     _chars+120
+	ldx     #$00
+	lda     #$01
+	sta     _chars+88
+	ldx     #$00
+	lda     #$01
+	sta     _chars+62
+	.dbg	line, "cq243.c", 158
+	ldx     #$00
+	lda     #$01
+	sta     _chars+121
+	ldx     #$00
+	lda     #$01
+	sta     _chars+89
+	ldx     #$00
+	lda     #$01
+	sta     _chars+44
+	.dbg	line, "cq243.c", 159
+	ldx     #$00
+	lda     #$01
+	sta     _chars+122
+	ldx     #$00
+	lda     #$01
+	sta     _chars+90
+	ldx     #$00
+	lda     #$01
+	sta     _chars+46
+	.dbg	line, "cq243.c", 160
+	ldx     #$00
+	lda     #$01
+	sta     _chars+63
+	.dbg	line, "cq243.c", 161
+	ldx     #$00
+	lda     #$01
+	sta     _chars+47
+	.dbg	line, "cq243.c", 163
+	lda     #<(_chars)
+	ldx     #>(_chars)
+	jsr     _sumof
+	cpx     #$00
+	bne     L0006
+	cmp     #$62
+L0006:	jsr     boolne
+	jeq     L0008
+	.dbg	line, "cq243.c", 164
+	ldy     #$01
+	jsr     ldaxysp
+	ina
+	bne     L0007
+	inx
+L0007:	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "cq243.c", 165
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0009
+	cmp     #$00
+L0009:	jsr     boolne
+	jeq     L0008
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq243.c", 202
+L0008:	jmp     L000B
+	.dbg	line, "cq243.c", 205
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     incax8
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "cq243.c", 206
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L000C
+	cmp     #$00
+L000C:	jsr     boolne
+	jeq     L000B
+	.dbg	line, "cq243.c", 208
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$08
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq243.c", 214
+L000B:	ldy     #$01
+	jsr     ldaxysp
+	jmp     L0001
+	.dbg	line, "cq243.c", 215
+L0001:	jsr     incsp8
+	rts
+
+	.dbg	line
+.segment	"DATA"
+
+M0001:
+	.byte	$73,$32,$34,$33,$2C,$65,$72,$25,$64,$0A,$00
+M0002:
+	.byte	$73,$32,$34,$33,$20,$20,$20,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ section (int j, void *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_section: near
+
+	.dbg	func, "section", "00", extern, "_section"
+	.dbg	sym, "j", "00", auto, 2
+	.dbg	sym, "pd0", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "cq243.c", 226
+	jsr     pushax
+	.dbg	line, "cq243.c", 228
+	ldy     #$03
+	jsr     ldaxysp
+	jmp     L0002
+	.dbg	line, "cq243.c", 230
+L0002:	cpx     #$00
+	jne     L0005
+	cmp     #$00
+	jeq     L0004
+	jmp     L0003
+L0005:	jmp     L0003
+	.dbg	line, "cq243.c", 229
+L0004:	ldy     #$01
+	jsr     ldaxysp
+	jsr     _s243
+	jmp     L0003
+	.dbg	line, "cq243.c", 231
+L0003:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+	.dbg	sym, "n", "00", auto, 2
+	.dbg	sym, "args", "00", auto, 0
+	.dbg	sym, "j", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "cq243.c", 249
+	jsr     decsp2
+	ldx     #$00
+	lda     #$01
+	sta     M0001+14
+	stx     M0001+14+1
+	.dbg	line, "cq243.c", 250
+	ldx     #$00
+	lda     #$01
+	sta     M0001+16
+	stx     M0001+16+1
+	.dbg	line, "cq243.c", 251
+	ldx     #$00
+	lda     #$01
+	sta     M0001+18
+	stx     M0001+18+1
+	.dbg	line, "cq243.c", 252
+	ldx     #$00
+	lda     #$01
+	sta     M0001+20
+	stx     M0001+20+1
+	.dbg	line, "cq243.c", 254
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	sta     M0002
+	stx     M0002+1
+	.dbg	line, "cq243.c", 256
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+	jmp     L0002
+	.dbg	line, "cq243.c", 257
+L0005:	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	lda     M0002
+	ldx     M0002+1
+	jsr     _section
+	sta     M0001+22
+	stx     M0001+22+1
+	.dbg	line, "cq243.c", 258
+	lda     M0001+24
+	ldx     M0001+24+1
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     tosaddax
+	sta     M0001+24
+	stx     M0001+24+1
+	.dbg	line, "cq243.c", 259
+	lda     M0001+14
+	ldx     M0001+14+1
+	cpx     #$00
+	bne     L0008
+	cmp     #$00
+L0008:	jsr     boolne
+	jeq     L0007
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     #<(M0001+26)
+	ldx     #>(M0001+26)
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "cq243.c", 256
+L0007:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0005
+	.dbg	line, "cq243.c", 262
+	lda     M0001+24
+	ldx     M0001+24+1
+	cpx     #$00
+	bne     L000A
+	cmp     #$00
+L000A:	jsr     booleq
+	jeq     L0009
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cq243.c", 263
+	jmp     L000B
+L0009:	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cq243.c", 265
+L000B:	lda     M0001+24
+	ldx     M0001+24+1
+	jmp     L0001
+	.dbg	line, "cq243.c", 266
+L0001:	jsr     incsp6
+	rts
+
+	.dbg	line
+.segment	"BSS"
+
+M0001:
+	.res	34,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
@@ -0,0 +1,621 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_printf
+	.export		_lbits
+	.export		_ubits
+	.export		_fbits
+	.export		_dbits
+	.export		_flgs
+	.export		_flgm
+	.export		_flgd
+	.export		_flgl
+	.export		_rrc
+	.export		_crc
+	.export		_rfs
+	.export		_s25
+	.export		_section
+	.export		_main
+
+.segment	"RODATA"
+
+S0009:
+	.byte	$53,$65,$63,$74,$69,$6F,$6E,$20,$25,$73,$20,$72,$65,$74,$75,$72
+	.byte	$6E,$65,$64,$20,$25,$64,$2E,$0A,$00
+S000A:
+	.byte	$0A,$4E,$6F,$20,$65,$72,$72,$6F,$72,$73,$20,$64,$65,$74,$65,$63
+	.byte	$74,$65,$64,$2E,$0A,$00
+S000B:
+	.byte	$0A,$46,$61,$69,$6C,$65,$64,$2E,$0A,$00
+S0005:
+	.byte	$0A,$09,$08,$0D,$0C,$5C,$27,$00
+S0007:
+	.byte	$71,$75,$65,$65,$70,$21,$00
+S0006	:=	S0007+0
+S0004:
+	.byte	$2E,$22,$2E,$00
+S0003:
+	.byte	$2E,$2E,$2E,$00
+
+.segment	"BSS"
+
+_lbits:
+	.res	2,$00
+_ubits:
+	.res	2,$00
+_fbits:
+	.res	2,$00
+_dbits:
+	.res	2,$00
+_flgs:
+	.res	2,$00
+_flgm:
+	.res	2,$00
+_flgd:
+	.res	2,$00
+_flgl:
+	.res	2,$00
+_rrc:
+	.res	2,$00
+_crc:
+	.res	2,$00
+_rfs:
+	.res	8,$00
+
+; ---------------------------------------------------------------
+; int __near__ s25 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s25: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$0E
+	jsr     subysp
+	lda     #<(M0002)
+	ldx     #>(M0002)
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$0F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$1A
+	bcc     L0002
+	inx
+L0002:	jsr     stax0sp
+L0003:	ldy     #$01
+	lda     (sp),y
+	sta     sreg+1
+	lda     (sp)
+	sta     sreg
+	ldy     #$03
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	lda     (ptr1)
+	sta     (sreg)
+	tax
+	php
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	bne     L0003
+	ldy     #$08
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	ldy     #$0C
+	jsr     staxysp
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1)
+	sta     sreg
+	ldy     #$0D
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	cmp     sreg
+	bne     L0025
+	ldy     #$0D
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	sta     sreg
+	ldy     #$0D
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$02
+	lda     (ptr1),y
+	cmp     sreg
+	bne     L0025
+	ldy     #$0D
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$02
+	lda     (ptr1),y
+	cmp     #$2E
+	beq     L0006
+L0025:	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ina
+	bne     L0009
+	inx
+L0009:	jsr     staxysp
+	ldy     #$0F
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$13
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     #$00
+	bne     L0029
+	cmp     #$00
+	beq     L0006
+L0029:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L0006:	ldy     #$0D
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$03
+	lda     (ptr1),y
+	beq     L0026
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$04
+	bcc     L000D
+	inx
+L000D:	jsr     staxysp
+	ldy     #$0F
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$13
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     #$00
+	bne     L002A
+	cmp     #$00
+	beq     L0026
+L002A:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	tay
+	jsr     _printf
+L0026:	lda     S0004+1
+	cmp     #$22
+	beq     L0012
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$08
+	bcc     L0011
+	inx
+L0011:	jsr     staxysp
+	ldy     #$0F
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$13
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     #$00
+	bne     L002B
+	cmp     #$00
+	beq     L0012
+L002B:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$08
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L0012:	lda     #<(S0005)
+	ldx     #>(S0005)
+	ldy     #$0C
+	jsr     staxysp
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1)
+	cmp     #$0A
+	bne     L0027
+	ldy     #$0D
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	cmp     #$09
+	bne     L0027
+	ldy     #$0D
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$02
+	lda     (ptr1),y
+	cmp     #$08
+	bne     L0027
+	ldy     #$0D
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$03
+	lda     (ptr1),y
+	cmp     #$0D
+	bne     L0027
+	tay
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$04
+	lda     (ptr1),y
+	cmp     #$0C
+	bne     L0027
+	ldy     #$0D
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$05
+	lda     (ptr1),y
+	cmp     #$5C
+	bne     L0027
+	ldy     #$0D
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$06
+	lda     (ptr1),y
+	cmp     #$27
+	beq     L0018
+L0027:	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$10
+	bcc     L0017
+	inx
+L0017:	jsr     staxysp
+	ldy     #$0F
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$13
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     #$00
+	bne     L002C
+	cmp     #$00
+	beq     L0018
+L002C:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$10
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L0018:	lda     #<(S0006)
+	ldx     #>(S0006)
+	ldy     #$0A
+	jsr     staxysp
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$06
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$04
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	bra     L0028
+L001D:	ldy     #$0C
+	lda     (sp),y
+	ldy     #$04
+	clc
+	adc     (sp),y
+	sta     ptr1
+	ldy     #$0D
+	lda     (sp),y
+	ldy     #$05
+	adc     (sp),y
+	sta     ptr1+1
+	lda     (ptr1)
+	sta     sreg
+	ldy     #$0A
+	lda     (sp),y
+	clc
+	ldy     #$04
+	adc     (sp),y
+	sta     ptr1
+	ldy     #$0B
+	lda     (sp),y
+	ldy     #$05
+	adc     (sp),y
+	sta     ptr1+1
+	lda     (ptr1)
+	cmp     sreg
+	beq     L001F
+	iny
+	lda     #$01
+	sta     (sp),y
+	dea
+	iny
+	sta     (sp),y
+L001F:	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$05
+L0028:	lda     (sp),y
+	cmp     #$00
+	bne     L001E
+	dey
+	lda     (sp),y
+	cmp     #$07
+L001E:	bcc     L001D
+	ldy     #$06
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L0023
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$20
+	bcc     L0022
+	inx
+L0022:	jsr     staxysp
+	ldy     #$0F
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$13
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     #$00
+	bne     L002D
+	cmp     #$00
+	beq     L0023
+L002D:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$20
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L0023:	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$10
+	jmp     addysp
+
+.segment	"DATA"
+
+M0001:
+	.byte	$73,$32,$35,$2C,$65,$72,$25,$64,$0A,$00
+M0002:
+	.byte	$73,$32,$35,$20,$20,$20,$20,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ section (int j, void *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_section: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$02
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	bne     L0003
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _s25
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	lda     #$01
+	sta     M0001+14
+	stz     M0001+14+1
+	sta     M0001+16
+	stz     M0001+16+1
+	sta     M0001+18
+	stz     M0001+18+1
+	sta     M0001+20
+	stz     M0001+20+1
+	lda     #>(M0001)
+	sta     M0002+1
+	lda     #<(M0001)
+	sta     M0002
+	lda     #$00
+	sta     (sp)
+	ldy     #$01
+	sta     (sp),y
+	bra     L000D
+L0005:	jsr     pushw0sp
+	lda     M0002
+	ldx     M0002+1
+	jsr     _section
+	sta     M0001+22
+	stx     M0001+22+1
+	lda     M0001+24
+	clc
+	adc     M0001+22
+	sta     M0001+24
+	lda     M0001+24+1
+	adc     M0001+22+1
+	sta     M0001+24+1
+	lda     M0001+14
+	ora     M0001+14+1
+	beq     L0007
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	lda     #<(M0001+26)
+	ldx     #>(M0001+26)
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+L0007:	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	ldy     #$01
+L000D:	lda     (sp),y
+	tax
+	lda     (sp)
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	bmi     L0005
+	lda     M0001+24
+	ora     M0001+24+1
+	bne     L0009
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	bra     L000F
+L0009:	lda     #<(S000B)
+	ldx     #>(S000B)
+L000F:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     M0001+24
+	ldx     M0001+24+1
+	jmp     incsp6
+
+.segment	"BSS"
+
+M0001:
+	.res	34,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
@@ -0,0 +1,517 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_printf
+	.export		_lbits
+	.export		_ubits
+	.export		_fbits
+	.export		_dbits
+	.export		_flgs
+	.export		_flgm
+	.export		_flgd
+	.export		_flgl
+	.export		_rrc
+	.export		_crc
+	.export		_rfs
+	.export		_s25
+	.export		_section
+	.export		_main
+
+.segment	"RODATA"
+
+S0009:
+	.byte	$53,$65,$63,$74,$69,$6F,$6E,$20,$25,$73,$20,$72,$65,$74,$75,$72
+	.byte	$6E,$65,$64,$20,$25,$64,$2E,$0A,$00
+S000A:
+	.byte	$0A,$4E,$6F,$20,$65,$72,$72,$6F,$72,$73,$20,$64,$65,$74,$65,$63
+	.byte	$74,$65,$64,$2E,$0A,$00
+S000B:
+	.byte	$0A,$46,$61,$69,$6C,$65,$64,$2E,$0A,$00
+S0005:
+	.byte	$0A,$09,$08,$0D,$0C,$5C,$27,$00
+S0007:
+	.byte	$71,$75,$65,$65,$70,$21,$00
+S0006	:=	S0007+0
+S0004:
+	.byte	$2E,$22,$2E,$00
+S0003:
+	.byte	$2E,$2E,$2E,$00
+
+.segment	"BSS"
+
+_lbits:
+	.res	2,$00
+_ubits:
+	.res	2,$00
+_fbits:
+	.res	2,$00
+_dbits:
+	.res	2,$00
+_flgs:
+	.res	2,$00
+_flgm:
+	.res	2,$00
+_flgd:
+	.res	2,$00
+_flgl:
+	.res	2,$00
+_rrc:
+	.res	2,$00
+_crc:
+	.res	2,$00
+_rfs:
+	.res	8,$00
+
+; ---------------------------------------------------------------
+; int __near__ s25 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s25: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$0E
+	jsr     subysp
+	lda     #<(M0002)
+	ldx     #>(M0002)
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$0F
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     incaxy
+	jsr     stax0sp
+L0002:	jsr     ldax0sp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$03
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1)
+	sta     (sreg)
+	tax
+	php
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	bne     L0002
+	ldx     #$00
+	txa
+	ldy     #$08
+	jsr     staxysp
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	ldy     #$0C
+	jsr     staxysp
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1)
+	sta     sreg
+	ldy     #$0D
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	cmp     sreg
+	bne     L0020
+	ldy     #$0D
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	sta     sreg
+	ldy     #$0D
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$02
+	lda     (ptr1),y
+	cmp     sreg
+	bne     L0020
+	ldy     #$0D
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$02
+	lda     (ptr1),y
+	cmp     #$2E
+	beq     L0005
+L0020:	ldy     #$09
+	jsr     ldaxysp
+	ina
+	bne     L0008
+	inx
+L0008:	ldy     #$08
+	jsr     staxysp
+	ldy     #$0F
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0023
+	cmp     #$00
+	beq     L0005
+L0023:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L0005:	ldy     #$0D
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$03
+	lda     (ptr1),y
+	beq     L0021
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     incax4
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$0F
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0024
+	cmp     #$00
+	beq     L0021
+L0024:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	tay
+	jsr     _printf
+L0021:	lda     S0004+1
+	cmp     #$22
+	beq     L000F
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     incax8
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$0F
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0025
+	cmp     #$00
+	beq     L000F
+L0025:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$08
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L000F:	lda     #<(S0005)
+	ldx     #>(S0005)
+	ldy     #$0C
+	jsr     staxysp
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1)
+	cmp     #$0A
+	bne     L0022
+	ldy     #$0D
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	cmp     #$09
+	bne     L0022
+	ldy     #$0D
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$02
+	lda     (ptr1),y
+	cmp     #$08
+	bne     L0022
+	ldy     #$0D
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$03
+	lda     (ptr1),y
+	cmp     #$0D
+	bne     L0022
+	tay
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$04
+	lda     (ptr1),y
+	cmp     #$0C
+	bne     L0022
+	ldy     #$0D
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$05
+	lda     (ptr1),y
+	cmp     #$5C
+	bne     L0022
+	ldy     #$0D
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$06
+	lda     (ptr1),y
+	cmp     #$27
+	beq     L0014
+L0022:	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$10
+	jsr     incaxy
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$0F
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0026
+	cmp     #$00
+	beq     L0014
+L0026:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$10
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L0014:	lda     #<(S0006)
+	ldx     #>(S0006)
+	ldy     #$0A
+	jsr     staxysp
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	ldy     #$0C
+	jsr     staxysp
+	ldx     #$00
+	txa
+	ldy     #$06
+	jsr     staxysp
+	ldy     #$04
+	jsr     staxysp
+	bra     L0016
+L0019:	ldy     #$05
+	jsr     ldaxysp
+	clc
+	ldy     #$0C
+	adc     (sp),y
+	sta     ptr1
+	txa
+	iny
+	adc     (sp),y
+	sta     ptr1+1
+	lda     (ptr1)
+	sta     sreg
+	ldy     #$05
+	jsr     ldaxysp
+	clc
+	ldy     #$0A
+	adc     (sp),y
+	sta     ptr1
+	txa
+	iny
+	adc     (sp),y
+	sta     ptr1+1
+	lda     (ptr1)
+	cmp     sreg
+	beq     L001B
+	ldx     #$00
+	lda     #$01
+	ldy     #$06
+	jsr     staxysp
+L001B:	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L0016:	ldy     #$05
+	lda     (sp),y
+	cmp     #$00
+	bne     L001A
+	dey
+	lda     (sp),y
+	cmp     #$07
+L001A:	bcc     L0019
+	ldy     #$06
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L001E
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$20
+	jsr     incaxy
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$0F
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0027
+	cmp     #$00
+	beq     L001E
+L0027:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$20
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L001E:	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$10
+	jmp     addysp
+
+.segment	"DATA"
+
+M0001:
+	.byte	$73,$32,$35,$2C,$65,$72,$25,$64,$0A,$00
+M0002:
+	.byte	$73,$32,$35,$20,$20,$20,$20,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ section (int j, void *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_section: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$02
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	bne     L0003
+	jsr     ldax0sp
+	jsr     _s25
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	ldx     #$00
+	lda     #$01
+	sta     M0001+14
+	stz     M0001+14+1
+	sta     M0001+16
+	stz     M0001+16+1
+	sta     M0001+18
+	stz     M0001+18+1
+	sta     M0001+20
+	stz     M0001+20+1
+	lda     #>(M0001)
+	sta     M0002+1
+	lda     #<(M0001)
+	sta     M0002
+	txa
+	jsr     stax0sp
+	bra     L0002
+L0005:	jsr     pushw0sp
+	lda     M0002
+	ldx     M0002+1
+	jsr     _section
+	sta     M0001+22
+	stx     M0001+22+1
+	lda     M0001+24
+	clc
+	adc     M0001+22
+	sta     M0001+24
+	lda     M0001+24+1
+	adc     M0001+22+1
+	sta     M0001+24+1
+	lda     M0001+14
+	ora     M0001+14+1
+	beq     L0007
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	lda     #<(M0001+26)
+	ldx     #>(M0001+26)
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+L0007:	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+L0002:	jsr     ldax0sp
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	bmi     L0005
+	lda     M0001+24
+	ora     M0001+24+1
+	bne     L0009
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	bra     L000E
+L0009:	lda     #<(S000B)
+	ldx     #>(S000B)
+L000E:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     M0001+24
+	ldx     M0001+24+1
+	jmp     incsp6
+
+.segment	"BSS"
+
+M0001:
+	.res	34,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
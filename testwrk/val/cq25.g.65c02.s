@@ -0,0 +1,659 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "cq25.c", 4996, 1613073744
+	.dbg		file, "common.h", 522, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/stdlib.h", 5999, 1613073744
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_lbits
+	.export		_ubits
+	.export		_fbits
+	.export		_dbits
+	.export		_flgs
+	.export		_flgm
+	.export		_flgd
+	.export		_flgl
+	.export		_rrc
+	.export		_crc
+	.export		_rfs
+	.export		_s25
+	.export		_section
+	.export		_main
+
+.segment	"RODATA"
+
+S0009:
+	.byte	$53,$65,$63,$74,$69,$6F,$6E,$20,$25,$73,$20,$72,$65,$74,$75,$72
+	.byte	$6E,$65,$64,$20,$25,$64,$2E,$0A,$00
+S000A:
+	.byte	$0A,$4E,$6F,$20,$65,$72,$72,$6F,$72,$73,$20,$64,$65,$74,$65,$63
+	.byte	$74,$65,$64,$2E,$0A,$00
+S000B:
+	.byte	$0A,$46,$61,$69,$6C,$65,$64,$2E,$0A,$00
+S0005:
+	.byte	$0A,$09,$08,$0D,$0C,$5C,$27,$00
+S0007:
+	.byte	$71,$75,$65,$65,$70,$21,$00
+S0006	:=	S0007+0
+S0004:
+	.byte	$2E,$22,$2E,$00
+S0003:
+	.byte	$2E,$2E,$2E,$00
+
+.segment	"BSS"
+
+_lbits:
+	.res	2,$00
+_ubits:
+	.res	2,$00
+_fbits:
+	.res	2,$00
+_dbits:
+	.res	2,$00
+_flgs:
+	.res	2,$00
+_flgm:
+	.res	2,$00
+_flgd:
+	.res	2,$00
+_flgl:
+	.res	2,$00
+_rrc:
+	.res	2,$00
+_crc:
+	.res	2,$00
+_rfs:
+	.res	8,$00
+
+; ---------------------------------------------------------------
+; int __near__ s25 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s25: near
+
+	.dbg	func, "s25", "00", extern, "_s25"
+	.dbg	sym, "pd0", "00", auto, 0
+	.dbg	sym, "s", "00", auto, -2
+	.dbg	sym, "s2", "00", auto, -4
+	.dbg	sym, "rc", "00", auto, -6
+	.dbg	sym, "lrc", "00", auto, -8
+	.dbg	sym, "j", "00", auto, -10
+	.dbg	sym, "ps", "00", auto, -12
+	.dbg	sym, "pt", "00", auto, -14
+
+.segment	"CODE"
+
+	.dbg	line, "cq25.c", 51
+	jsr     pushax
+	.dbg	line, "cq25.c", 59
+	ldy     #$0E
+	jsr     subysp
+	lda     #<(M0002)
+	ldx     #>(M0002)
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "cq25.c", 60
+	ldy     #$0F
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     incaxy
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "cq25.c", 61
+	jmp     L0002
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$00
+	jsr     staspidx
+	tax
+	php
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	jne     L0002
+	.dbg	line, "cq25.c", 62
+	ldx     #$00
+	lda     #$00
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "cq25.c", 67
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq25.c", 72
+	ldy     #$0D
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldauidx
+	jsr     tosneax
+	jne     L0006
+	ldy     #$0D
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldauidx
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	.dbg	line, "cq25.c", 73
+	ldy     #$02
+	jsr     ldauidx
+	jsr     tosneax
+	jne     L0006
+	ldy     #$0D
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     ldauidx
+	cmp     #$2E
+	jsr     boolne
+	jne     L0006
+	ldx     #$00
+	lda     #$00
+	jeq     L0007
+L0006:	ldx     #$00
+	lda     #$01
+L0007:	jeq     L0005
+	.dbg	line, "cq25.c", 74
+	ldy     #$09
+	jsr     ldaxysp
+	ina
+	bne     L0008
+	inx
+L0008:	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "cq25.c", 75
+	ldy     #$0F
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L000A
+	cmp     #$00
+L000A:	jsr     boolne
+	jeq     L0005
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq25.c", 81
+L0005:	ldy     #$0D
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldauidx
+	cmp     #$00
+	jsr     boolne
+	jeq     L000B
+	.dbg	line, "cq25.c", 82
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     incax4
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "cq25.c", 83
+	ldy     #$0F
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L000D
+	cmp     #$00
+L000D:	jsr     boolne
+	jeq     L000B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$04
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq25.c", 89
+L000B:	ldx     #$00
+	lda     S0004+1
+	cmp     #$22
+	jsr     boolne
+	jeq     L000F
+	.dbg	line, "cq25.c", 90
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     incax8
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "cq25.c", 91
+	ldy     #$0F
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0010
+	cmp     #$00
+L0010:	jsr     boolne
+	jeq     L000F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$08
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq25.c", 97
+L000F:	lda     #<(S0005)
+	ldx     #>(S0005)
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq25.c", 99
+	ldy     #$0D
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	.dbg	line, "cq25.c", 100
+	cmp     #$0A
+	jsr     boolne
+	jne     L0012
+	ldy     #$0D
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldauidx
+	.dbg	line, "cq25.c", 101
+	cmp     #$09
+	jsr     boolne
+	jne     L0012
+	ldy     #$0D
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     ldauidx
+	.dbg	line, "cq25.c", 102
+	cmp     #$08
+	jsr     boolne
+	jne     L0012
+	ldy     #$0D
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldauidx
+	.dbg	line, "cq25.c", 103
+	cmp     #$0D
+	jsr     boolne
+	jne     L0012
+	ldy     #$0D
+	jsr     ldaxysp
+	ldy     #$04
+	jsr     ldauidx
+	.dbg	line, "cq25.c", 104
+	cmp     #$0C
+	jsr     boolne
+	jne     L0012
+	ldy     #$0D
+	jsr     ldaxysp
+	ldy     #$05
+	jsr     ldauidx
+	.dbg	line, "cq25.c", 105
+	cmp     #$5C
+	jsr     boolne
+	jne     L0012
+	ldy     #$0D
+	jsr     ldaxysp
+	ldy     #$06
+	jsr     ldauidx
+	cmp     #$27
+	jsr     boolne
+	jne     L0012
+	ldx     #$00
+	lda     #$00
+	jeq     L0013
+L0012:	ldx     #$00
+	lda     #$01
+L0013:	jeq     L0014
+	.dbg	line, "cq25.c", 106
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$10
+	jsr     incaxy
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "cq25.c", 107
+	ldy     #$0F
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0015
+	cmp     #$00
+L0015:	jsr     boolne
+	jeq     L0014
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$10
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq25.c", 112
+L0014:	lda     #<(S0006)
+	ldx     #>(S0006)
+	ldy     #$0A
+	jsr     staxysp
+	.dbg	line, "cq25.c", 113
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq25.c", 115
+	ldx     #$00
+	lda     #$00
+	ldy     #$06
+	jsr     staxysp
+	.dbg	line, "cq25.c", 116
+	ldx     #$00
+	lda     #$00
+	ldy     #$04
+	jsr     staxysp
+	jmp     L0016
+L0019:	ldy     #$0D
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosaddax
+	ldy     #$00
+	jsr     ldauidx
+	jsr     pushax
+	ldy     #$0D
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     tosaddax
+	ldy     #$00
+	jsr     ldauidx
+	jsr     tosneax
+	jeq     L001B
+	ldx     #$00
+	lda     #$01
+	ldy     #$06
+	jsr     staxysp
+L001B:	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0016
+L0016:	ldy     #$05
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L001A
+	cmp     #$07
+L001A:	jsr     boolult
+	jne     L0019
+	.dbg	line, "cq25.c", 117
+	ldy     #$07
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L001D
+	cmp     #$00
+L001D:	jsr     boolne
+	jeq     L001E
+	.dbg	line, "cq25.c", 118
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$20
+	jsr     incaxy
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "cq25.c", 119
+	ldy     #$0F
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L001F
+	cmp     #$00
+L001F:	jsr     boolne
+	jeq     L001E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$20
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq25.c", 121
+L001E:	ldy     #$09
+	jsr     ldaxysp
+	jmp     L0001
+	.dbg	line, "cq25.c", 122
+L0001:	ldy     #$10
+	jsr     addysp
+	rts
+
+	.dbg	line
+.segment	"DATA"
+
+M0001:
+	.byte	$73,$32,$35,$2C,$65,$72,$25,$64,$0A,$00
+M0002:
+	.byte	$73,$32,$35,$20,$20,$20,$20,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ section (int j, void *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_section: near
+
+	.dbg	func, "section", "00", extern, "_section"
+	.dbg	sym, "j", "00", auto, 2
+	.dbg	sym, "pd0", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "cq25.c", 133
+	jsr     pushax
+	.dbg	line, "cq25.c", 135
+	ldy     #$03
+	jsr     ldaxysp
+	jmp     L0002
+	.dbg	line, "cq25.c", 137
+L0002:	cpx     #$00
+	jne     L0005
+	cmp     #$00
+	jeq     L0004
+	jmp     L0003
+L0005:	jmp     L0003
+	.dbg	line, "cq25.c", 136
+L0004:	ldy     #$01
+	jsr     ldaxysp
+	jsr     _s25
+	jmp     L0003
+	.dbg	line, "cq25.c", 138
+L0003:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+	.dbg	sym, "n", "00", auto, 2
+	.dbg	sym, "args", "00", auto, 0
+	.dbg	sym, "j", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "cq25.c", 156
+	jsr     decsp2
+	ldx     #$00
+	lda     #$01
+	sta     M0001+14
+	stx     M0001+14+1
+	.dbg	line, "cq25.c", 157
+	ldx     #$00
+	lda     #$01
+	sta     M0001+16
+	stx     M0001+16+1
+	.dbg	line, "cq25.c", 158
+	ldx     #$00
+	lda     #$01
+	sta     M0001+18
+	stx     M0001+18+1
+	.dbg	line, "cq25.c", 159
+	ldx     #$00
+	lda     #$01
+	sta     M0001+20
+	stx     M0001+20+1
+	.dbg	line, "cq25.c", 161
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	sta     M0002
+	stx     M0002+1
+	.dbg	line, "cq25.c", 163
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+	jmp     L0002
+	.dbg	line, "cq25.c", 164
+L0005:	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	lda     M0002
+	ldx     M0002+1
+	jsr     _section
+	sta     M0001+22
+	stx     M0001+22+1
+	.dbg	line, "cq25.c", 165
+	lda     M0001+24
+	ldx     M0001+24+1
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     tosaddax
+	sta     M0001+24
+	stx     M0001+24+1
+	.dbg	line, "cq25.c", 166
+	lda     M0001+14
+	ldx     M0001+14+1
+	cpx     #$00
+	bne     L0008
+	cmp     #$00
+L0008:	jsr     boolne
+	jeq     L0007
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	lda     #<(M0001+26)
+	ldx     #>(M0001+26)
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "cq25.c", 163
+L0007:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0005
+	.dbg	line, "cq25.c", 169
+	lda     M0001+24
+	ldx     M0001+24+1
+	cpx     #$00
+	bne     L000A
+	cmp     #$00
+L000A:	jsr     booleq
+	jeq     L0009
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cq25.c", 170
+	jmp     L000B
+L0009:	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cq25.c", 172
+L000B:	lda     M0001+24
+	ldx     M0001+24+1
+	jmp     L0001
+	.dbg	line, "cq25.c", 173
+L0001:	jsr     incsp6
+	rts
+
+	.dbg	line
+.segment	"BSS"
+
+M0001:
+	.res	34,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
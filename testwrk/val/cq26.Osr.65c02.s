@@ -0,0 +1,436 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_printf
+	.export		_lbits
+	.export		_ubits
+	.export		_fbits
+	.export		_dbits
+	.export		_flgs
+	.export		_flgm
+	.export		_flgd
+	.export		_flgl
+	.export		_rrc
+	.export		_crc
+	.export		_rfs
+	.export		_s26
+	.export		_section
+	.export		_main
+
+.segment	"RODATA"
+
+S000C:
+	.byte	$53,$65,$63,$74,$69,$6F,$6E,$20,$25,$73,$20,$72,$65,$74,$75,$72
+	.byte	$6E,$65,$64,$20,$25,$64,$2E,$0A,$00
+S000D:
+	.byte	$0A,$4E,$6F,$20,$65,$72,$72,$6F,$72,$73,$20,$64,$65,$74,$65,$63
+	.byte	$74,$65,$64,$2E,$0A,$00
+S000B:
+	.byte	$4E,$4F,$5F,$46,$4C,$4F,$41,$54,$53,$0A,$00
+S000E:
+	.byte	$0A,$46,$61,$69,$6C,$65,$64,$2E,$0A,$00
+S0008:
+	.byte	$75,$6E,$73,$69,$67,$6E,$65,$64,$00
+S000A:
+	.byte	$64,$6F,$75,$62,$6C,$65,$00
+S0009:
+	.byte	$66,$6C,$6F,$61,$74,$00
+S0006:
+	.byte	$73,$68,$6F,$72,$74,$00
+S0007:
+	.byte	$6C,$6F,$6E,$67,$00
+S0004:
+	.byte	$63,$68,$61,$72,$00
+S0005:
+	.byte	$69,$6E,$74,$00
+
+.segment	"BSS"
+
+_lbits:
+	.res	2,$00
+_ubits:
+	.res	2,$00
+_fbits:
+	.res	2,$00
+_dbits:
+	.res	2,$00
+_flgs:
+	.res	2,$00
+_flgm:
+	.res	2,$00
+_flgd:
+	.res	2,$00
+_flgl:
+	.res	2,$00
+_rrc:
+	.res	2,$00
+_crc:
+	.res	2,$00
+_rfs:
+	.res	8,$00
+
+; ---------------------------------------------------------------
+; int __near__ s26 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s26: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp6
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     incaxy
+	ldy     #$02
+	jsr     staxysp
+L0002:	ldy     #$03
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$05
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1)
+	sta     (sreg)
+	tax
+	php
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	bne     L0002
+	ldy     #$07
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$00
+	sta     (ptr1)
+	ldy     #$01
+	sta     (ptr1),y
+	sta     (sp),y
+	tya
+	sta     (sp)
+	bra     L0007
+L000C:	lda     (sp)
+	asl     a
+	sta     (sp)
+	ldy     #$07
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     ldaxi
+	ina
+	bne     L0008
+	inx
+L0008:	sta     (sreg)
+	ldy     #$01
+	txa
+	sta     (sreg),y
+L0007:	ldy     #$01
+	lda     (sp),y
+	cmp     (sp)
+	bne     L000C
+	ldy     #$07
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     ldaxi
+	jsr     shlax1
+	ldy     #$02
+	sta     (sreg),y
+	iny
+	txa
+	sta     (sreg),y
+	ldy     #$07
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     ldaxi
+	jsr     shlax1
+	ldy     #$04
+	sta     (sreg),y
+	iny
+	txa
+	sta     (sreg),y
+	ldy     #$07
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     ldaxi
+	jsr     shlax2
+	ldy     #$06
+	sta     (sreg),y
+	iny
+	txa
+	sta     (sreg),y
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     ldaxi
+	jsr     shlax1
+	ldy     #$08
+	sta     (sreg),y
+	iny
+	txa
+	sta     (sreg),y
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$11
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L000D
+	cmp     #$00
+	jeq     L000F
+L000D:	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushw
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     pushwidx
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$05
+	jsr     pushwidx
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$07
+	jsr     pushwidx
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$09
+	jsr     pushwidx
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$0B
+	jsr     pushwidx
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$0D
+	jsr     pushwidx
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	txa
+L000F:	jmp     incsp8
+
+.segment	"DATA"
+
+M0001:
+	.byte	$73,$32,$36,$20,$20,$20,$20,$00
+M0002:
+	.byte	$25,$33,$64,$20,$62,$69,$74,$73,$20,$69,$6E,$20,$25,$73,$73,$2E
+	.byte	$0A,$00
+M0003:
+	.byte	$25,$65,$20,$69,$73,$20,$74,$68,$65,$20,$6C,$65,$61,$73,$74,$20
+	.byte	$6E,$75,$6D,$62,$65,$72,$20,$74,$68,$61,$74,$20,$63,$61,$6E,$20
+	.byte	$62,$65,$20,$61,$64,$64,$65,$64,$20,$74,$6F,$20,$31,$2E,$20,$28
+	.byte	$25,$73,$29,$2E,$0A,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ section (int j, void *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_section: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$02
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	bne     L0003
+	jsr     ldax0sp
+	jsr     _s26
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	ldx     #$00
+	lda     #$01
+	sta     M0001+14
+	stz     M0001+14+1
+	sta     M0001+16
+	stz     M0001+16+1
+	sta     M0001+18
+	stz     M0001+18+1
+	sta     M0001+20
+	stz     M0001+20+1
+	lda     #>(M0001)
+	sta     M0002+1
+	lda     #<(M0001)
+	sta     M0002
+	txa
+	jsr     stax0sp
+	bra     L0002
+L0005:	jsr     pushw0sp
+	lda     M0002
+	ldx     M0002+1
+	jsr     _section
+	sta     M0001+22
+	stx     M0001+22+1
+	lda     M0001+24
+	clc
+	adc     M0001+22
+	sta     M0001+24
+	lda     M0001+24+1
+	adc     M0001+22+1
+	sta     M0001+24+1
+	lda     M0001+14
+	ora     M0001+14+1
+	beq     L0007
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	lda     #<(M0001+26)
+	ldx     #>(M0001+26)
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+L0007:	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+L0002:	jsr     ldax0sp
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	bmi     L0005
+	lda     M0001+24
+	ora     M0001+24+1
+	bne     L0009
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	bra     L000E
+L0009:	lda     #<(S000E)
+	ldx     #>(S000E)
+L000E:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     M0001+24
+	ldx     M0001+24+1
+	jmp     incsp6
+
+.segment	"BSS"
+
+M0001:
+	.res	34,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
@@ -0,0 +1,897 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_printf
+	.export		_lbits
+	.export		_ubits
+	.export		_fbits
+	.export		_dbits
+	.export		_flgs
+	.export		_flgm
+	.export		_flgd
+	.export		_flgl
+	.export		_rrc
+	.export		_crc
+	.export		_rfs
+	.export		_s26
+	.export		_extvar
+	.export		_s4
+	.export		_svtest
+	.export		_zero
+	.export		_testev
+	.export		_setev
+	.export		_section
+	.export		_main
+
+.segment	"RODATA"
+
+S0006:
+	.byte	$73,$69,$7A,$65,$6F,$66,$20,$74,$61,$72,$67,$65,$74,$3A,$20,$25
+	.byte	$30,$38,$78,$20,$70,$64,$30,$2D,$3E,$63,$62,$69,$74,$73,$3A,$20
+	.byte	$25,$30,$38,$78,$0A,$00
+S0008:
+	.byte	$6D,$61,$73,$6B,$3A,$20,$25,$30,$38,$78,$20,$74,$61,$72,$67,$65
+	.byte	$74,$3A,$20,$25,$30,$38,$78,$0A,$00
+S0009:
+	.byte	$53,$65,$63,$74,$69,$6F,$6E,$20,$25,$73,$20,$72,$65,$74,$75,$72
+	.byte	$6E,$65,$64,$20,$25,$64,$2E,$0A,$00
+S0007	:=	S0008+0
+S000A:
+	.byte	$0A,$4E,$6F,$20,$65,$72,$72,$6F,$72,$73,$20,$64,$65,$74,$65,$63
+	.byte	$74,$65,$64,$2E,$0A,$00
+S000B:
+	.byte	$0A,$46,$61,$69,$6C,$65,$64,$2E,$0A,$00
+
+.segment	"BSS"
+
+_lbits:
+	.res	2,$00
+_ubits:
+	.res	2,$00
+_fbits:
+	.res	2,$00
+_dbits:
+	.res	2,$00
+_flgs:
+	.res	2,$00
+_flgm:
+	.res	2,$00
+_flgd:
+	.res	2,$00
+_flgl:
+	.res	2,$00
+_rrc:
+	.res	2,$00
+_crc:
+	.res	2,$00
+_rfs:
+	.res	8,$00
+_extvar:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; int __near__ s26 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s26: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp6
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$1A
+	bcc     L0002
+	inx
+L0002:	ldy     #$02
+	jsr     staxysp
+L0003:	ldy     #$03
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	ldy     #$05
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$00
+	lda     (ptr1),y
+	sta     (sreg),y
+	tax
+	php
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	bne     L0003
+	ldy     #$07
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	lda     #$00
+	tay
+	sta     (ptr1),y
+	iny
+	sta     (ptr1),y
+	sta     (sp),y
+	tya
+	dey
+	sta     (sp),y
+	jmp     L0008
+L000B:	lda     (sp),y
+	asl     a
+	sta     (sp),y
+	ldy     #$07
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	iny
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	clc
+	adc     #$01
+	bcc     L000C
+	inx
+L000C:	sta     (sreg),y
+	iny
+	txa
+	sta     (sreg),y
+L0008:	ldy     #$01
+	lda     (sp),y
+	dey
+	cmp     (sp),y
+	bne     L000B
+	ldy     #$07
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	iny
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	sta     tmp1
+	dey
+	lda     (ptr1),y
+	asl     a
+	rol     tmp1
+	ldy     #$02
+	sta     (sreg),y
+	iny
+	lda     tmp1
+	sta     (sreg),y
+	ldy     #$07
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	iny
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	sta     tmp1
+	dey
+	lda     (ptr1),y
+	asl     a
+	rol     tmp1
+	ldy     #$04
+	sta     (sreg),y
+	iny
+	lda     tmp1
+	sta     (sreg),y
+	ldy     #$07
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	iny
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     shlax2
+	ldy     #$06
+	sta     (sreg),y
+	iny
+	txa
+	sta     (sreg),y
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	iny
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	sta     tmp1
+	dey
+	lda     (ptr1),y
+	asl     a
+	rol     tmp1
+	ldy     #$08
+	sta     (sreg),y
+	iny
+	lda     tmp1
+	sta     (sreg),y
+	ldx     #$00
+	txa
+	jmp     incsp8
+
+.segment	"DATA"
+
+M0001:
+	.byte	$73,$32,$36,$20,$20,$20,$20,$00
+M0002:
+	.byte	$25,$33,$64,$20,$62,$69,$74,$73,$20,$69,$6E,$20,$25,$73,$73,$2E
+	.byte	$0A,$00
+M0003:
+	.byte	$25,$65,$20,$69,$73,$20,$74,$68,$65,$20,$6C,$65,$61,$73,$74,$20
+	.byte	$6E,$75,$6D,$62,$65,$72,$20,$74,$68,$61,$74,$20,$63,$61,$6E,$20
+	.byte	$62,$65,$20,$61,$64,$64,$65,$64,$20,$74,$6F,$20,$31,$2E,$20,$28
+	.byte	$25,$73,$29,$2E,$0A,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ s4 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s4: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$14
+	jsr     subysp
+	ldy     #$0C
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #<(M0002)
+	ldx     #>(M0002)
+	ldy     #$12
+	jsr     staxysp
+	ldy     #$15
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$1A
+	bcc     L0002
+	inx
+L0002:	ldy     #$10
+	jsr     staxysp
+L0003:	ldy     #$11
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	ldy     #$13
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$00
+	lda     (ptr1),y
+	sta     (sreg),y
+	tax
+	php
+	ldy     #$10
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$12
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	bne     L0003
+	ldy     #$0E
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L0023
+L0009:	iny
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _svtest
+	jsr     pushax
+	jsr     _zero
+	jsr     tosicmp
+	beq     L000C
+	ldy     #$0C
+	lda     #$01
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$15
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	dey
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     #$00
+	bne     L0025
+	cmp     #$00
+	beq     L000C
+L0025:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L000C:	ldy     #$0E
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$0F
+L0023:	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cmp     #$03
+	txa
+	sbc     #$00
+	bvc     L000A
+	eor     #$80
+L000A:	bmi     L0009
+	jsr     _setev
+	jsr     _testev
+	cpx     #$00
+	bne     L0026
+	cmp     #$00
+	beq     L0015
+L0026:	ldy     #$0D
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$02
+	bcc     L0010
+	inx
+L0010:	jsr     staxysp
+	ldy     #$15
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	dey
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     #$00
+	bne     L0027
+	cmp     #$00
+	beq     L0015
+L0027:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$02
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L0015:	ldy     #$02
+	lda     #$FF
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$00
+	lda     #$01
+	sta     (sp),y
+	tya
+	iny
+	sta     (sp),y
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	lda     #$02
+	jsr     pusha0
+	ldy     #$19
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$06
+	jsr     _printf
+	ldy     #$0E
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L0024
+L001A:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$00
+	and     (sp),y
+	pha
+	txa
+	iny
+	and     (sp),y
+	tax
+	pla
+	jsr     stax0sp
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     shrax1
+	jsr     staxysp
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$06
+	jsr     _printf
+	ldy     #$0E
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L0024:	ldy     #$11
+	jsr     pushwysp
+	ldy     #$17
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	sta     tmp1
+	dey
+	lda     (ptr1),y
+	asl     a
+	rol     tmp1
+	ldx     tmp1
+	jsr     tosicmp
+	bcc     L001A
+	ldy     #$01
+	lda     (sp),y
+	bne     L001D
+	dey
+	lda     (sp),y
+	cmp     #$01
+	bne     L001D
+	ldy     #$02
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L0021
+L001D:	ldy     #$0D
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$08
+	bcc     L0020
+	inx
+L0020:	jsr     staxysp
+	ldy     #$15
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	dey
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     #$00
+	bne     L0028
+	cmp     #$00
+	beq     L0021
+L0028:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$08
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L0021:	ldy     #$0D
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$16
+	jmp     addysp
+
+.segment	"DATA"
+
+M0001:
+	.byte	$73,$34,$2C,$65,$72,$25,$64,$0A,$00
+M0002:
+	.byte	$73,$34,$20,$20,$20,$20,$20,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ svtest (int n)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_svtest: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp2
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cpx     #$00
+	bne     L0003
+	cmp     #$00
+	beq     L0004
+	cmp     #$01
+	beq     L0005
+	cmp     #$02
+	beq     L0009
+	jmp     L0003
+L0004:	ldx     #$07
+	lda     #$BA
+	sta     M0001
+	stx     M0001+1
+	jmp     L000F
+L0005:	lda     M0001+1
+	cmp     #$07
+	bne     L0010
+	lda     M0001
+	cmp     #$BA
+	beq     L0006
+L0010:	ldy     #$00
+	lda     #$01
+	sta     (sp),y
+	txa
+	jmp     L0012
+L0006:	ldx     #$07
+	lda     #$89
+	sta     M0001
+	stx     M0001+1
+	jmp     L000F
+L0009:	lda     M0001+1
+	cmp     #$07
+	bne     L0011
+	lda     M0001
+	cmp     #$89
+	beq     L000F
+L0011:	ldy     #$00
+	lda     #$01
+	sta     (sp),y
+	txa
+	jmp     L0012
+L000F:	ldy     #$00
+	tya
+	sta     (sp),y
+L0012:	iny
+	sta     (sp),y
+L0003:	ldy     #$01
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jmp     incsp4
+
+.segment	"BSS"
+
+M0001:
+	.res	2,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ zero (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_zero: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	ldx     #$00
+	lda     #$02
+	sta     M0001
+	stx     M0001+1
+	txa
+	jsr     stax0sp
+	jmp     incsp2
+
+.segment	"BSS"
+
+M0001:
+	.res	2,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ testev (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_testev: near
+
+.segment	"CODE"
+
+	lda     _extvar+1
+	cmp     #$04
+	bne     L0005
+	lda     _extvar
+	cmp     #$2A
+	beq     L0002
+L0005:	ldx     #$00
+	lda     #$01
+	rts
+L0002:	ldx     #$00
+	txa
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ setev (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_setev: near
+
+	.import		_extvar
+
+.segment	"CODE"
+
+	ldx     #$04
+	lda     #$2A
+	sta     _extvar
+	stx     _extvar+1
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ section (int j, void *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_section: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cpx     #$00
+	bne     L0003
+	cmp     #$00
+	beq     L0004
+	cmp     #$01
+	beq     L0005
+	jmp     L0003
+L0004:	dey
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _s26
+	jmp     L0003
+L0005:	dey
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _s4
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	ldx     #$00
+	lda     #$01
+	sta     M0001+14
+	stx     M0001+14+1
+	sta     M0001+16
+	stx     M0001+16+1
+	sta     M0001+18
+	stx     M0001+18+1
+	sta     M0001+20
+	stx     M0001+20+1
+	lda     #>(M0001)
+	sta     M0002+1
+	lda     #<(M0001)
+	sta     M0002
+	ldy     #$00
+	txa
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L000D
+L0005:	jsr     pushw0sp
+	lda     M0002
+	ldx     M0002+1
+	jsr     _section
+	sta     M0001+22
+	stx     M0001+22+1
+	lda     M0001+24
+	clc
+	adc     M0001+22
+	sta     M0001+24
+	lda     M0001+24+1
+	adc     M0001+22+1
+	sta     M0001+24+1
+	lda     M0001+14
+	ora     M0001+14+1
+	beq     L0007
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	lda     #<(M0001+26)
+	ldx     #>(M0001+26)
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+L0007:	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	ldy     #$01
+L000D:	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cmp     #$02
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	bmi     L0005
+	lda     M0001+24
+	ora     M0001+24+1
+	bne     L0009
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jmp     L000F
+L0009:	lda     #<(S000B)
+	ldx     #>(S000B)
+L000F:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     M0001+24
+	ldx     M0001+24+1
+	jmp     incsp6
+
+.segment	"BSS"
+
+M0001:
+	.res	34,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
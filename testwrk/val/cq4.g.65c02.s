@@ -0,0 +1,989 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "cq4.c", 10633, 1613073744
+	.dbg		file, "common.h", 522, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/stdlib.h", 5999, 1613073744
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_lbits
+	.export		_ubits
+	.export		_fbits
+	.export		_dbits
+	.export		_flgs
+	.export		_flgm
+	.export		_flgd
+	.export		_flgl
+	.export		_rrc
+	.export		_crc
+	.export		_rfs
+	.export		_s26
+	.export		_extvar
+	.export		_s4
+	.export		_svtest
+	.export		_zero
+	.export		_testev
+	.export		_setev
+	.export		_section
+	.export		_main
+
+.segment	"RODATA"
+
+S0006:
+	.byte	$73,$69,$7A,$65,$6F,$66,$20,$74,$61,$72,$67,$65,$74,$3A,$20,$25
+	.byte	$30,$38,$78,$20,$70,$64,$30,$2D,$3E,$63,$62,$69,$74,$73,$3A,$20
+	.byte	$25,$30,$38,$78,$0A,$00
+S0008:
+	.byte	$6D,$61,$73,$6B,$3A,$20,$25,$30,$38,$78,$20,$74,$61,$72,$67,$65
+	.byte	$74,$3A,$20,$25,$30,$38,$78,$0A,$00
+S0009:
+	.byte	$53,$65,$63,$74,$69,$6F,$6E,$20,$25,$73,$20,$72,$65,$74,$75,$72
+	.byte	$6E,$65,$64,$20,$25,$64,$2E,$0A,$00
+S0007	:=	S0008+0
+S000A:
+	.byte	$0A,$4E,$6F,$20,$65,$72,$72,$6F,$72,$73,$20,$64,$65,$74,$65,$63
+	.byte	$74,$65,$64,$2E,$0A,$00
+S000B:
+	.byte	$0A,$46,$61,$69,$6C,$65,$64,$2E,$0A,$00
+
+.segment	"BSS"
+
+_lbits:
+	.res	2,$00
+_ubits:
+	.res	2,$00
+_fbits:
+	.res	2,$00
+_dbits:
+	.res	2,$00
+_flgs:
+	.res	2,$00
+_flgm:
+	.res	2,$00
+_flgd:
+	.res	2,$00
+_flgl:
+	.res	2,$00
+_rrc:
+	.res	2,$00
+_crc:
+	.res	2,$00
+_rfs:
+	.res	8,$00
+_extvar:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; int __near__ s26 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s26: near
+
+	.dbg	func, "s26", "00", extern, "_s26"
+	.dbg	sym, "pd0", "00", auto, 0
+	.dbg	sym, "ps", "00", auto, -2
+	.dbg	sym, "pt", "00", auto, -4
+	.dbg	sym, "c0", "00", auto, -5
+	.dbg	sym, "c1", "00", auto, -6
+
+.segment	"CODE"
+
+	.dbg	line, "cq4.c", 66
+	jsr     pushax
+	.dbg	line, "cq4.c", 78
+	jsr     decsp6
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq4.c", 79
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     incaxy
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "cq4.c", 81
+	jmp     L0002
+L0002:	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$00
+	jsr     staspidx
+	tax
+	php
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	jne     L0002
+	.dbg	line, "cq4.c", 86
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "cq4.c", 87
+	ldx     #$00
+	lda     #$00
+	ldy     #$01
+	sta     (sp),y
+	.dbg	line, "cq4.c", 88
+	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	sta     (sp),y
+	.dbg	line, "cq4.c", 90
+	jmp     L0007
+	.dbg	line, "cq4.c", 91
+L0005:	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	jsr     aslax1
+	ldx     #$00
+	ldy     #$00
+	sta     (sp),y
+	.dbg	line, "cq4.c", 92
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	ina
+	bne     L0008
+	inx
+L0008:	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "cq4.c", 90
+L0007:	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosneax
+	jne     L0005
+	.dbg	line, "cq4.c", 96
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     shlax1
+	ldy     #$02
+	jsr     staxspidx
+	.dbg	line, "cq4.c", 97
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     shlax1
+	ldy     #$04
+	jsr     staxspidx
+	.dbg	line, "cq4.c", 98
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     shlax2
+	ldy     #$06
+	jsr     staxspidx
+	.dbg	line, "cq4.c", 99
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     shlax1
+	ldy     #$08
+	jsr     staxspidx
+	.dbg	line, "cq4.c", 162
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "cq4.c", 163
+L0001:	jsr     incsp8
+	rts
+
+	.dbg	line
+.segment	"DATA"
+
+M0001:
+	.byte	$73,$32,$36,$20,$20,$20,$20,$00
+M0002:
+	.byte	$25,$33,$64,$20,$62,$69,$74,$73,$20,$69,$6E,$20,$25,$73,$73,$2E
+	.byte	$0A,$00
+M0003:
+	.byte	$25,$65,$20,$69,$73,$20,$74,$68,$65,$20,$6C,$65,$61,$73,$74,$20
+	.byte	$6E,$75,$6D,$62,$65,$72,$20,$74,$68,$61,$74,$20,$63,$61,$6E,$20
+	.byte	$62,$65,$20,$61,$64,$64,$65,$64,$20,$74,$6F,$20,$31,$2E,$20,$28
+	.byte	$25,$73,$29,$2E,$0A,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ s4 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s4: near
+
+	.dbg	func, "s4", "00", extern, "_s4"
+	.dbg	sym, "pd0", "00", auto, 0
+	.dbg	sym, "ps", "00", auto, -2
+	.dbg	sym, "pt", "00", auto, -4
+	.dbg	sym, "j", "00", auto, -6
+	.dbg	sym, "rc", "00", auto, -8
+	.dbg	sym, "sint", "00", auto, -10
+	.dbg	sym, "pint", "00", auto, -12
+	.dbg	sym, "lint", "00", auto, -16
+	.dbg	sym, "target", "00", auto, -18
+	.dbg	sym, "mask", "00", auto, -20
+
+.segment	"CODE"
+
+	.dbg	line, "cq4.c", 180
+	jsr     pushax
+	.dbg	line, "cq4.c", 193
+	ldy     #$14
+	jsr     subysp
+	ldx     #$00
+	lda     #$00
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq4.c", 194
+	lda     #<(M0002)
+	ldx     #>(M0002)
+	ldy     #$12
+	jsr     staxysp
+	.dbg	line, "cq4.c", 195
+	ldy     #$15
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     incaxy
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq4.c", 197
+	jmp     L0002
+L0002:	ldy     #$11
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$15
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$00
+	jsr     staspidx
+	tax
+	php
+	ldy     #$10
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$12
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	jne     L0002
+	.dbg	line, "cq4.c", 209
+	ldx     #$00
+	lda     #$00
+	ldy     #$0E
+	jsr     staxysp
+	jmp     L0005
+	.dbg	line, "cq4.c", 210
+L0008:	ldy     #$0F
+	jsr     ldaxysp
+	jsr     _svtest
+	jsr     pushax
+	jsr     _zero
+	jsr     tosneax
+	jeq     L000B
+	.dbg	line, "cq4.c", 211
+	ldx     #$00
+	lda     #$01
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq4.c", 212
+	ldy     #$15
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L000C
+	cmp     #$00
+L000C:	jsr     boolne
+	jeq     L000B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq4.c", 209
+L000B:	ldy     #$0F
+	jsr     ldaxysp
+	ldy     #$0E
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0005
+L0005:	ldy     #$0F
+	jsr     ldaxysp
+	cmp     #$03
+	txa
+	sbc     #$00
+	bvc     L0009
+	eor     #$80
+L0009:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0008
+	.dbg	line, "cq4.c", 221
+	jsr     _setev
+	.dbg	line, "cq4.c", 222
+	jsr     _testev
+	cpx     #$00
+	bne     L000E
+	cmp     #$00
+L000E:	jsr     boolne
+	jeq     L000F
+	.dbg	line, "cq4.c", 223
+	ldy     #$0D
+	jsr     ldaxysp
+	jsr     incax2
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq4.c", 224
+	ldy     #$15
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0010
+	cmp     #$00
+L0010:	jsr     boolne
+	jeq     L000F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq4.c", 236
+L000F:	jmp     L0012
+	.dbg	line, "cq4.c", 237
+	ldy     #$0D
+	jsr     ldaxysp
+	jsr     incax4
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq4.c", 238
+	ldy     #$15
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0013
+	cmp     #$00
+L0013:	jsr     boolne
+	jeq     L0012
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$04
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq4.c", 245
+L0012:	ldx     #$FF
+	lda     #$FF
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "cq4.c", 246
+	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "cq4.c", 247
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     pushax
+	ldy     #$19
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "cq4.c", 248
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "cq4.c", 250
+	ldx     #$00
+	lda     #$00
+	ldy     #$0E
+	jsr     staxysp
+	jmp     L0014
+	.dbg	line, "cq4.c", 251
+L0017:	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosandax
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "cq4.c", 252
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     shrax1
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "cq4.c", 253
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "cq4.c", 250
+	ldy     #$0F
+	jsr     ldaxysp
+	ldy     #$0E
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0014
+L0014:	ldy     #$0F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$17
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     shlax1
+	jsr     tosultax
+	jne     L0017
+	.dbg	line, "cq4.c", 256
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0019
+	cmp     #$01
+L0019:	jsr     boolne
+	jne     L001A
+	ldy     #$03
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L001B
+	cmp     #$00
+L001B:	jsr     boolne
+	jne     L001A
+	ldx     #$00
+	lda     #$00
+	jeq     L001C
+L001A:	ldx     #$00
+	lda     #$01
+L001C:	jeq     L001D
+	.dbg	line, "cq4.c", 257
+	ldy     #$0D
+	jsr     ldaxysp
+	jsr     incax8
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq4.c", 258
+	ldy     #$15
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L001E
+	cmp     #$00
+L001E:	jsr     boolne
+	jeq     L001D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$08
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq4.c", 261
+L001D:	ldy     #$0D
+	jsr     ldaxysp
+	jmp     L0001
+	.dbg	line, "cq4.c", 262
+L0001:	ldy     #$16
+	jsr     addysp
+	rts
+
+	.dbg	line
+.segment	"DATA"
+
+M0001:
+	.byte	$73,$34,$2C,$65,$72,$25,$64,$0A,$00
+M0002:
+	.byte	$73,$34,$20,$20,$20,$20,$20,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ svtest (int n)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_svtest: near
+
+	.dbg	func, "svtest", "00", extern, "_svtest"
+	.dbg	sym, "n", "00", auto, 0
+	.dbg	sym, "rc", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "cq4.c", 269
+	jsr     pushax
+	.dbg	line, "cq4.c", 274
+	jsr     decsp2
+	ldy     #$03
+	jsr     ldaxysp
+	jmp     L0002
+	.dbg	line, "cq4.c", 289
+L0002:	cpx     #$00
+	jne     L000D
+	cmp     #$00
+	jeq     L0004
+	cmp     #$01
+	jeq     L0005
+	cmp     #$02
+	jeq     L0009
+	jmp     L0003
+L000D:	jmp     L0003
+	.dbg	line, "cq4.c", 275
+L0004:	ldx     #$07
+	lda     #$BA
+	sta     M0001
+	stx     M0001+1
+	.dbg	line, "cq4.c", 276
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "cq4.c", 277
+	jmp     L0003
+	.dbg	line, "cq4.c", 279
+L0005:	lda     M0001
+	ldx     M0001+1
+	cpx     #$07
+	bne     L0007
+	cmp     #$BA
+L0007:	jsr     boolne
+	jeq     L0006
+	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "cq4.c", 280
+	jmp     L0008
+	.dbg	line, "cq4.c", 281
+L0006:	ldx     #$07
+	lda     #$89
+	sta     M0001
+	stx     M0001+1
+	.dbg	line, "cq4.c", 282
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "cq4.c", 284
+L0008:	jmp     L0003
+	.dbg	line, "cq4.c", 286
+L0009:	lda     M0001
+	ldx     M0001+1
+	cpx     #$07
+	bne     L000B
+	cmp     #$89
+L000B:	jsr     boolne
+	jeq     L000A
+	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "cq4.c", 287
+	jmp     L000C
+L000A:	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "cq4.c", 288
+L000C:	jmp     L0003
+	.dbg	line, "cq4.c", 290
+L0003:	ldy     #$01
+	jsr     ldaxysp
+	jmp     L0001
+	.dbg	line, "cq4.c", 291
+L0001:	jsr     incsp4
+	rts
+
+	.dbg	line
+.segment	"BSS"
+
+M0001:
+	.res	2,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ zero (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_zero: near
+
+	.dbg	func, "zero", "00", extern, "_zero"
+	.dbg	sym, "rc", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "cq4.c", 295
+	jsr     decsp2
+	ldx     #$00
+	lda     #$02
+	sta     M0001
+	stx     M0001+1
+	.dbg	line, "cq4.c", 296
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "cq4.c", 297
+	ldy     #$01
+	jsr     ldaxysp
+	jmp     L0001
+	.dbg	line, "cq4.c", 298
+L0001:	jsr     incsp2
+	rts
+
+	.dbg	line
+.segment	"BSS"
+
+M0001:
+	.res	2,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ testev (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_testev: near
+
+	.dbg	func, "testev", "00", extern, "_testev"
+
+.segment	"CODE"
+
+	.dbg	line, "cq4.c", 300
+	lda     _extvar
+	ldx     _extvar+1
+	cpx     #$04
+	bne     L0003
+	cmp     #$2A
+L0003:	jsr     boolne
+	jeq     L0002
+	ldx     #$00
+	lda     #$01
+	jmp     L0004
+	.dbg	line, "cq4.c", 301
+	jmp     L0004
+L0002:	ldx     #$00
+	lda     #$00
+	jmp     L0004
+	.dbg	line, "cq4.c", 302
+L0004:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ setev (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_setev: near
+
+	.import		_extvar
+	.dbg	func, "setev", "00", extern, "_setev"
+	.dbg	sym, "extvar", "00", extern, "_extvar"
+
+.segment	"CODE"
+
+	.dbg	line, "cq4.c", 312
+	ldx     #$04
+	lda     #$2A
+	sta     _extvar
+	stx     _extvar+1
+	.dbg	line, "cq4.c", 313
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ section (int j, void *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_section: near
+
+	.dbg	func, "section", "00", extern, "_section"
+	.dbg	sym, "j", "00", auto, 2
+	.dbg	sym, "pd0", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "cq4.c", 322
+	jsr     pushax
+	.dbg	line, "cq4.c", 324
+	ldy     #$03
+	jsr     ldaxysp
+	jmp     L0002
+	.dbg	line, "cq4.c", 327
+L0002:	cpx     #$00
+	jne     L0006
+	cmp     #$00
+	jeq     L0004
+	cmp     #$01
+	jeq     L0005
+	jmp     L0003
+L0006:	jmp     L0003
+	.dbg	line, "cq4.c", 325
+L0004:	ldy     #$01
+	jsr     ldaxysp
+	jsr     _s26
+	jmp     L0003
+	.dbg	line, "cq4.c", 326
+L0005:	ldy     #$01
+	jsr     ldaxysp
+	jsr     _s4
+	jmp     L0003
+	.dbg	line, "cq4.c", 328
+L0003:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+	.dbg	sym, "n", "00", auto, 2
+	.dbg	sym, "args", "00", auto, 0
+	.dbg	sym, "j", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "cq4.c", 348
+	jsr     decsp2
+	ldx     #$00
+	lda     #$01
+	sta     M0001+14
+	stx     M0001+14+1
+	.dbg	line, "cq4.c", 349
+	ldx     #$00
+	lda     #$01
+	sta     M0001+16
+	stx     M0001+16+1
+	.dbg	line, "cq4.c", 350
+	ldx     #$00
+	lda     #$01
+	sta     M0001+18
+	stx     M0001+18+1
+	.dbg	line, "cq4.c", 351
+	ldx     #$00
+	lda     #$01
+	sta     M0001+20
+	stx     M0001+20+1
+	.dbg	line, "cq4.c", 353
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	sta     M0002
+	stx     M0002+1
+	.dbg	line, "cq4.c", 355
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+	jmp     L0002
+	.dbg	line, "cq4.c", 356
+L0005:	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	lda     M0002
+	ldx     M0002+1
+	jsr     _section
+	sta     M0001+22
+	stx     M0001+22+1
+	.dbg	line, "cq4.c", 357
+	lda     M0001+24
+	ldx     M0001+24+1
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     tosaddax
+	sta     M0001+24
+	stx     M0001+24+1
+	.dbg	line, "cq4.c", 358
+	lda     M0001+14
+	ldx     M0001+14+1
+	cpx     #$00
+	bne     L0008
+	cmp     #$00
+L0008:	jsr     boolne
+	jeq     L0007
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	lda     #<(M0001+26)
+	ldx     #>(M0001+26)
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "cq4.c", 355
+L0007:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	cmp     #$02
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0005
+	.dbg	line, "cq4.c", 361
+	lda     M0001+24
+	ldx     M0001+24+1
+	cpx     #$00
+	bne     L000A
+	cmp     #$00
+L000A:	jsr     booleq
+	jeq     L0009
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cq4.c", 362
+	jmp     L000B
+L0009:	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cq4.c", 364
+L000B:	lda     M0001+24
+	ldx     M0001+24+1
+	jmp     L0001
+	.dbg	line, "cq4.c", 365
+L0001:	jsr     incsp6
+	rts
+
+	.dbg	line
+.segment	"BSS"
+
+M0001:
+	.res	34,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
@@ -0,0 +1,507 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_printf
+	.export		_lbits
+	.export		_ubits
+	.export		_fbits
+	.export		_dbits
+	.export		_flgs
+	.export		_flgm
+	.export		_flgd
+	.export		_flgl
+	.export		_rrc
+	.export		_crc
+	.export		_rfs
+	.export		_extvar
+	.export		_s61
+	.export		_section
+	.export		_main
+
+.segment	"RODATA"
+
+S000A:
+	.byte	$53,$65,$63,$74,$69,$6F,$6E,$20,$25,$73,$20,$72,$65,$74,$75,$72
+	.byte	$6E,$65,$64,$20,$25,$64,$2E,$0A,$00
+S000B:
+	.byte	$0A,$4E,$6F,$20,$65,$72,$72,$6F,$72,$73,$20,$64,$65,$74,$65,$63
+	.byte	$74,$65,$64,$2E,$0A,$00
+S000C:
+	.byte	$0A,$46,$61,$69,$6C,$65,$64,$2E,$0A,$00
+
+.segment	"BSS"
+
+_lbits:
+	.res	2,$00
+_ubits:
+	.res	2,$00
+_fbits:
+	.res	2,$00
+_dbits:
+	.res	2,$00
+_flgs:
+	.res	2,$00
+_flgm:
+	.res	2,$00
+_flgd:
+	.res	2,$00
+_flgl:
+	.res	2,$00
+_rrc:
+	.res	2,$00
+_crc:
+	.res	2,$00
+_rfs:
+	.res	8,$00
+_extvar:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; int __near__ s61 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s61: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$26
+	jsr     subysp
+	lda     #<(M0003)
+	ldx     #>(M0003)
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$27
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     incaxy
+	jsr     stax0sp
+	ldx     #$00
+	txa
+	ldy     #$18
+	jsr     staxysp
+	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	jsr     push0
+	ldy     #$04
+	jsr     _printf
+L0002:	jsr     pushw0sp
+	ldy     #$05
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	lda     (ptr1)
+	jsr     staspidx
+	tax
+	php
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	bne     L0002
+	ldx     #$FF
+	lda     #$ED
+	ldy     #$24
+	jsr     staxysp
+	jsr     axlong
+	ldy     #$1E
+	jsr     steaxysp
+	ldy     #$21
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$ED
+	jsr     tosneeax
+	beq     L0005
+	ldy     #$19
+	jsr     ldaxysp
+	ina
+	bne     L0006
+	inx
+L0006:	ldy     #$18
+	jsr     staxysp
+	ldy     #$27
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0038
+	cmp     #$00
+	beq     L0009
+L0038:	lda     #<(M0001)
+	ldx     #>(M0001)
+	bra     L004B
+L0005:	ldy     #$27
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0039
+	cmp     #$00
+	beq     L0009
+L0039:	lda     #<(M0002)
+	ldx     #>(M0002)
+L004B:	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L0009:	lda     #<(M0004)
+	ldx     #>(M0004)
+	ldy     #$04
+	jsr     staxysp
+	lda     #<(M0005)
+	ldx     #>(M0005)
+	ldy     #$06
+	jsr     staxysp
+	lda     #<(M0006)
+	ldx     #>(M0006)
+	ldy     #$08
+	jsr     staxysp
+	lda     #<(M0007)
+	ldx     #>(M0007)
+	ldy     #$0A
+	jsr     staxysp
+	lda     #<(M0008)
+	ldx     #>(M0008)
+	ldy     #$0C
+	jsr     staxysp
+	lda     #<(M0009)
+	ldx     #>(M0009)
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	txa
+	ldy     #$16
+	jsr     staxysp
+	ldy     #$14
+	jsr     staxysp
+	bra     L000C
+L0011:	ldy     #$15
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #$04
+	bcc     L0016
+	inx
+	clc
+L0016:	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	sta     sreg
+	stx     sreg+1
+	jsr     ldaxi
+	sta     regsave
+	stx     regsave+1
+	ina
+	bne     L0017
+	inx
+L0017:	sta     (sreg)
+	ldy     #$01
+	txa
+	sta     (sreg),y
+L0015:	ldy     #$15
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #$04
+	bcc     L0014
+	inx
+	clc
+L0014:	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	jsr     ldaxi
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1)
+	bne     L0011
+	ldy     #$14
+	tax
+	ina
+	jsr     addeqysp
+L000C:	ldy     #$15
+	jsr     ldaxysp
+	cmp     #$06
+	txa
+	sbc     #$00
+	bvc     L0010
+	eor     #$80
+L0010:	bmi     L0015
+	ldy     #$16
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L0018
+	ldy     #$19
+	jsr     ldaxysp
+	jsr     incax2
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$27
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L003A
+	cmp     #$00
+	beq     L0041
+L003A:	lda     #<(M0001)
+	ldx     #>(M0001)
+	bra     L004C
+L0018:	ldy     #$27
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L003B
+	cmp     #$00
+	beq     L0041
+L003B:	lda     #<(M0002)
+	ldx     #>(M0002)
+L004C:	jsr     pushax
+	lda     #$02
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L0041:	stz     sreg+1
+	lda     #$10
+	sta     sreg
+	lda     #$03
+	ldy     #$1A
+	jsr     steaxysp
+	ldy     #$1B
+	jsr     ldaxysp
+	ldy     #$22
+	jsr     staxysp
+	ldy     #$1A
+	lda     (sp),y
+	ldy     #$12
+	sta     (sp),y
+	ldy     #$25
+	jsr     pushwysp
+	ldy     #$1F
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosneeax
+	beq     L002E
+	ldy     #$23
+	lda     (sp),y
+	bne     L0037
+	dey
+	lda     (sp),y
+	cmp     #$03
+	bne     L0037
+L002E:	ldy     #$12
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$1F
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosneeax
+	beq     L001F
+	ldy     #$12
+	lda     (sp),y
+	cmp     #$03
+	beq     L001F
+L0037:	ldy     #$19
+	jsr     ldaxysp
+	jsr     incax8
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$27
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L003C
+	cmp     #$00
+	beq     L002C
+L003C:	lda     #<(M0001)
+	ldx     #>(M0001)
+	bra     L004D
+L001F:	ldy     #$27
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L003D
+	cmp     #$00
+	beq     L002C
+L003D:	lda     #<(M0002)
+	ldx     #>(M0002)
+L004D:	jsr     pushax
+	lda     #$08
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L002C:	ldy     #$19
+	jsr     ldaxysp
+	ldy     #$28
+	jmp     addysp
+
+.segment	"DATA"
+
+M0001:
+	.byte	$73,$36,$31,$2C,$65,$72,$25,$64,$0A,$00
+M0002:
+	.byte	$73,$36,$31,$2C,$6F,$6B,$25,$64,$0A,$00
+M0003:
+	.byte	$73,$36,$31,$20,$20,$20,$20,$00
+M0004:
+	.byte	$41,$42,$43,$44,$45,$46,$47,$48,$49,$4A,$4B,$4C,$4D,$4E,$4F,$50
+	.byte	$51,$52,$53,$54,$55,$56,$57,$58,$59,$5A,$00
+M0005:
+	.byte	$61,$62,$63,$64,$65,$66,$67,$68,$69,$6A,$6B,$6C,$6D,$6E,$6F,$70
+	.byte	$71,$72,$73,$74,$75,$76,$77,$78,$79,$7A,$00
+M0006:
+	.byte	$30,$31,$32,$33,$34,$35,$36,$37,$38,$39,$00
+M0007:
+	.byte	$7E,$21,$22,$23,$25,$26,$28,$29,$5F,$3D,$2D,$5E,$7C,$7B,$7D,$5B
+	.byte	$5D,$2B,$3B,$2A,$3A,$3C,$3E,$2C,$2E,$3F,$2F,$00
+M0008:
+	.byte	$0A,$09,$08,$0D,$0C,$5C,$27,$00
+M0009:
+	.byte	$20,$00,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ section (int j, void *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_section: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$02
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	bne     L0003
+	jsr     ldax0sp
+	jsr     _s61
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	ldx     #$00
+	lda     #$01
+	sta     M0001+14
+	stz     M0001+14+1
+	sta     M0001+16
+	stz     M0001+16+1
+	sta     M0001+18
+	stz     M0001+18+1
+	sta     M0001+20
+	stz     M0001+20+1
+	lda     #>(M0001)
+	sta     M0002+1
+	lda     #<(M0001)
+	sta     M0002
+	txa
+	jsr     stax0sp
+	bra     L0002
+L0005:	jsr     pushw0sp
+	lda     M0002
+	ldx     M0002+1
+	jsr     _section
+	sta     M0001+22
+	stx     M0001+22+1
+	lda     M0001+24
+	clc
+	adc     M0001+22
+	sta     M0001+24
+	lda     M0001+24+1
+	adc     M0001+22+1
+	sta     M0001+24+1
+	lda     M0001+14
+	ora     M0001+14+1
+	beq     L0007
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	lda     #<(M0001+26)
+	ldx     #>(M0001+26)
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+L0007:	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+L0002:	jsr     ldax0sp
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	bmi     L0005
+	lda     M0001+24
+	ora     M0001+24+1
+	bne     L0009
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	bra     L000E
+L0009:	lda     #<(S000C)
+	ldx     #>(S000C)
+L000E:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     M0001+24
+	ldx     M0001+24+1
+	jmp     incsp6
+
+.segment	"BSS"
+
+M0001:
+	.res	34,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
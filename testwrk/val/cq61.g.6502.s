@@ -0,0 +1,712 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "cq61.c", 5702, 1613073744
+	.dbg		file, "common.h", 522, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/stdlib.h", 5999, 1613073744
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_lbits
+	.export		_ubits
+	.export		_fbits
+	.export		_dbits
+	.export		_flgs
+	.export		_flgm
+	.export		_flgd
+	.export		_flgl
+	.export		_rrc
+	.export		_crc
+	.export		_rfs
+	.export		_extvar
+	.export		_s61
+	.export		_section
+	.export		_main
+
+.segment	"RODATA"
+
+S000A:
+	.byte	$53,$65,$63,$74,$69,$6F,$6E,$20,$25,$73,$20,$72,$65,$74,$75,$72
+	.byte	$6E,$65,$64,$20,$25,$64,$2E,$0A,$00
+S000B:
+	.byte	$0A,$4E,$6F,$20,$65,$72,$72,$6F,$72,$73,$20,$64,$65,$74,$65,$63
+	.byte	$74,$65,$64,$2E,$0A,$00
+S000C:
+	.byte	$0A,$46,$61,$69,$6C,$65,$64,$2E,$0A,$00
+
+.segment	"BSS"
+
+_lbits:
+	.res	2,$00
+_ubits:
+	.res	2,$00
+_fbits:
+	.res	2,$00
+_dbits:
+	.res	2,$00
+_flgs:
+	.res	2,$00
+_flgm:
+	.res	2,$00
+_flgd:
+	.res	2,$00
+_flgl:
+	.res	2,$00
+_rrc:
+	.res	2,$00
+_crc:
+	.res	2,$00
+_rfs:
+	.res	8,$00
+_extvar:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; int __near__ s61 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s61: near
+
+	.dbg	func, "s61", "00", extern, "_s61"
+	.dbg	sym, "pd0", "00", auto, 0
+	.dbg	sym, "from", "00", auto, -2
+	.dbg	sym, "shortint", "00", auto, -4
+	.dbg	sym, "to", "00", auto, -8
+	.dbg	sym, "longint", "00", auto, -12
+	.dbg	sym, "rc", "00", auto, -14
+	.dbg	sym, "lrc", "00", auto, -16
+	.dbg	sym, "j", "00", auto, -18
+	.dbg	sym, "fromc", "00", auto, -19
+	.dbg	sym, "charint", "00", auto, -20
+	.dbg	sym, "wd", "00", auto, -22
+	.dbg	sym, "pc", "00", auto, -34
+	.dbg	sym, "ps", "00", auto, -36
+	.dbg	sym, "pt", "00", auto, -38
+
+.segment	"CODE"
+
+	.dbg	line, "cq61.c", 55
+	jsr     pushax
+	.dbg	line, "cq61.c", 75
+	ldy     #$26
+	jsr     subysp
+	lda     #<(M0003)
+	ldx     #>(M0003)
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "cq61.c", 76
+	ldy     #$27
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     incaxy
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "cq61.c", 77
+	ldx     #$00
+	lda     #$00
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq61.c", 79
+	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq61.c", 81
+	jmp     L0002
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$00
+	jsr     staspidx
+	tax
+	php
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	jne     L0002
+	.dbg	line, "cq61.c", 91
+	ldx     #$FF
+	lda     #$ED
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq61.c", 92
+	ldy     #$25
+	jsr     ldaxysp
+	jsr     axlong
+	ldy     #$1E
+	jsr     steaxysp
+	.dbg	line, "cq61.c", 94
+	ldy     #$21
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$ED
+	jsr     tosneeax
+	jeq     L0005
+	.dbg	line, "cq61.c", 95
+	ldy     #$19
+	jsr     ldaxysp
+	jsr     incax1
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq61.c", 96
+	ldy     #$27
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0007
+	cmp     #$00
+L0007:	jsr     boolne
+	jeq     L0006
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq61.c", 98
+L0006:	jmp     L0008
+L0005:	ldy     #$27
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L000A
+	cmp     #$00
+L000A:	jsr     boolne
+	jeq     L0008
+	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq61.c", 103
+L0008:	lda     #<(M0004)
+	ldx     #>(M0004)
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq61.c", 104
+	lda     #<(M0005)
+	ldx     #>(M0005)
+	ldy     #$06
+	jsr     staxysp
+	.dbg	line, "cq61.c", 105
+	lda     #<(M0006)
+	ldx     #>(M0006)
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "cq61.c", 106
+	lda     #<(M0007)
+	ldx     #>(M0007)
+	ldy     #$0A
+	jsr     staxysp
+	.dbg	line, "cq61.c", 107
+	lda     #<(M0008)
+	ldx     #>(M0008)
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq61.c", 108
+	lda     #<(M0009)
+	ldx     #>(M0009)
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq61.c", 110
+	ldx     #$00
+	lda     #$00
+	ldy     #$16
+	jsr     staxysp
+	.dbg	line, "cq61.c", 111
+	ldx     #$00
+	lda     #$00
+	ldy     #$14
+	jsr     staxysp
+	jmp     L000B
+	.dbg	line, "cq61.c", 112
+L000E:	jmp     L0014
+L0010:	ldy     #$15
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #$04
+	bcc     L0015
+	inx
+	clc
+L0015:	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	jsr     pushax
+	ldy     #$01
+	jsr     ldaxidx
+	sta     regsave
+	stx     regsave+1
+	jsr     incax1
+	ldy     #$00
+	jsr     staxspidx
+	lda     regsave
+	ldx     regsave+1
+	ldy     #$00
+	jsr     ldauidx
+	jmp     L0014
+	ldx     #$00
+	lda     #$01
+	ldy     #$16
+	jsr     staxysp
+L0014:	ldy     #$15
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #$04
+	bcc     L0013
+	inx
+	clc
+L0013:	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$00
+	jsr     ldauidx
+	jne     L0010
+	.dbg	line, "cq61.c", 111
+	ldy     #$15
+	jsr     ldaxysp
+	ldy     #$14
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L000B
+L000B:	ldy     #$15
+	jsr     ldaxysp
+	cmp     #$06
+	txa
+	sbc     #$00
+	bvc     L000F
+	eor     #$80
+L000F:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L000E
+	.dbg	line, "cq61.c", 114
+	ldy     #$17
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0017
+	cmp     #$00
+L0017:	jsr     boolne
+	jeq     L0016
+	.dbg	line, "cq61.c", 115
+	ldy     #$19
+	jsr     ldaxysp
+	jsr     incax2
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq61.c", 116
+	ldy     #$27
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0019
+	cmp     #$00
+L0019:	jsr     boolne
+	jeq     L0018
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq61.c", 118
+L0018:	jmp     L001B
+L0016:	ldy     #$27
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L001C
+	cmp     #$00
+L001C:	jsr     boolne
+	jeq     L001B
+	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq61.c", 124
+L001B:	ldx     #$00
+	stx     sreg+1
+	lda     #$10
+	sta     sreg
+	lda     #$03
+	ldy     #$1A
+	jsr     steaxysp
+	.dbg	line, "cq61.c", 125
+	ldy     #$1B
+	jsr     ldaxysp
+	ldy     #$22
+	jsr     staxysp
+	.dbg	line, "cq61.c", 126
+	ldy     #$1A
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$12
+	sta     (sp),y
+	.dbg	line, "cq61.c", 128
+	ldy     #$23
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1F
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosneeax
+	jeq     L001E
+	ldy     #$23
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L001F
+	cmp     #$03
+L001F:	jsr     boolne
+	jne     L0020
+L001E:	ldx     #$00
+	lda     #$00
+	jeq     L0021
+L0020:	ldx     #$00
+	lda     #$01
+L0021:	jne     L0022
+	.dbg	line, "cq61.c", 129
+	ldy     #$12
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$1F
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosneeax
+	jeq     L0023
+	ldy     #$12
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$03
+	jsr     boolne
+	jne     L0024
+L0023:	ldx     #$00
+	lda     #$00
+	jeq     L0025
+L0024:	ldx     #$00
+	lda     #$01
+L0025:	jne     L0022
+	ldx     #$00
+	lda     #$00
+	jeq     L0026
+L0022:	ldx     #$00
+	lda     #$01
+L0026:	jeq     L001D
+	.dbg	line, "cq61.c", 130
+	ldy     #$19
+	jsr     ldaxysp
+	jsr     incax8
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq61.c", 131
+	ldy     #$27
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0028
+	cmp     #$00
+L0028:	jsr     boolne
+	jeq     L0027
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$08
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq61.c", 133
+L0027:	jmp     L002A
+L001D:	ldy     #$27
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L002B
+	cmp     #$00
+L002B:	jsr     boolne
+	jeq     L002A
+	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	ldx     #$00
+	lda     #$08
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq61.c", 135
+L002A:	ldy     #$19
+	jsr     ldaxysp
+	jmp     L0001
+	.dbg	line, "cq61.c", 136
+L0001:	ldy     #$28
+	jsr     addysp
+	rts
+
+	.dbg	line
+.segment	"DATA"
+
+M0001:
+	.byte	$73,$36,$31,$2C,$65,$72,$25,$64,$0A,$00
+M0002:
+	.byte	$73,$36,$31,$2C,$6F,$6B,$25,$64,$0A,$00
+M0003:
+	.byte	$73,$36,$31,$20,$20,$20,$20,$00
+M0004:
+	.byte	$41,$42,$43,$44,$45,$46,$47,$48,$49,$4A,$4B,$4C,$4D,$4E,$4F,$50
+	.byte	$51,$52,$53,$54,$55,$56,$57,$58,$59,$5A,$00
+M0005:
+	.byte	$61,$62,$63,$64,$65,$66,$67,$68,$69,$6A,$6B,$6C,$6D,$6E,$6F,$70
+	.byte	$71,$72,$73,$74,$75,$76,$77,$78,$79,$7A,$00
+M0006:
+	.byte	$30,$31,$32,$33,$34,$35,$36,$37,$38,$39,$00
+M0007:
+	.byte	$7E,$21,$22,$23,$25,$26,$28,$29,$5F,$3D,$2D,$5E,$7C,$7B,$7D,$5B
+	.byte	$5D,$2B,$3B,$2A,$3A,$3C,$3E,$2C,$2E,$3F,$2F,$00
+M0008:
+	.byte	$0A,$09,$08,$0D,$0C,$5C,$27,$00
+M0009:
+	.byte	$20,$00,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ section (int j, void *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_section: near
+
+	.dbg	func, "section", "00", extern, "_section"
+	.dbg	sym, "j", "00", auto, 2
+	.dbg	sym, "pd0", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "cq61.c", 145
+	jsr     pushax
+	.dbg	line, "cq61.c", 147
+	ldy     #$03
+	jsr     ldaxysp
+	jmp     L0002
+	.dbg	line, "cq61.c", 150
+L0002:	cpx     #$00
+	jne     L0005
+	cmp     #$00
+	jeq     L0004
+	jmp     L0003
+L0005:	jmp     L0003
+	.dbg	line, "cq61.c", 149
+L0004:	ldy     #$01
+	jsr     ldaxysp
+	jsr     _s61
+	jmp     L0003
+	.dbg	line, "cq61.c", 151
+L0003:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+	.dbg	sym, "n", "00", auto, 2
+	.dbg	sym, "args", "00", auto, 0
+	.dbg	sym, "j", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "cq61.c", 171
+	jsr     decsp2
+	ldx     #$00
+	lda     #$01
+	sta     M0001+14
+	stx     M0001+14+1
+	.dbg	line, "cq61.c", 172
+	ldx     #$00
+	lda     #$01
+	sta     M0001+16
+	stx     M0001+16+1
+	.dbg	line, "cq61.c", 173
+	ldx     #$00
+	lda     #$01
+	sta     M0001+18
+	stx     M0001+18+1
+	.dbg	line, "cq61.c", 174
+	ldx     #$00
+	lda     #$01
+	sta     M0001+20
+	stx     M0001+20+1
+	.dbg	line, "cq61.c", 176
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	sta     M0002
+	stx     M0002+1
+	.dbg	line, "cq61.c", 178
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+	jmp     L0002
+	.dbg	line, "cq61.c", 179
+L0005:	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	lda     M0002
+	ldx     M0002+1
+	jsr     _section
+	sta     M0001+22
+	stx     M0001+22+1
+	.dbg	line, "cq61.c", 180
+	lda     M0001+24
+	ldx     M0001+24+1
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     tosaddax
+	sta     M0001+24
+	stx     M0001+24+1
+	.dbg	line, "cq61.c", 181
+	lda     M0001+14
+	ldx     M0001+14+1
+	cpx     #$00
+	bne     L0008
+	cmp     #$00
+L0008:	jsr     boolne
+	jeq     L0007
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	lda     #<(M0001+26)
+	ldx     #>(M0001+26)
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "cq61.c", 178
+L0007:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0005
+	.dbg	line, "cq61.c", 184
+	lda     M0001+24
+	ldx     M0001+24+1
+	cpx     #$00
+	bne     L000A
+	cmp     #$00
+L000A:	jsr     booleq
+	jeq     L0009
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cq61.c", 185
+	jmp     L000B
+L0009:	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cq61.c", 187
+L000B:	lda     M0001+24
+	ldx     M0001+24+1
+	jmp     L0001
+	.dbg	line, "cq61.c", 188
+L0001:	jsr     incsp6
+	rts
+
+	.dbg	line
+.segment	"BSS"
+
+M0001:
+	.res	34,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
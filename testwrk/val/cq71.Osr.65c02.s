@@ -0,0 +1,436 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_printf
+	.export		_lbits
+	.export		_ubits
+	.export		_fbits
+	.export		_dbits
+	.export		_flgs
+	.export		_flgm
+	.export		_flgd
+	.export		_flgl
+	.export		_rrc
+	.export		_crc
+	.export		_rfs
+	.export		_extvar
+	.export		_s71
+	.export		_section
+	.export		_main
+
+.segment	"RODATA"
+
+S0004:
+	.byte	$53,$65,$63,$74,$69,$6F,$6E,$20,$25,$73,$20,$72,$65,$74,$75,$72
+	.byte	$6E,$65,$64,$20,$25,$64,$2E,$0A,$00
+S0005:
+	.byte	$0A,$4E,$6F,$20,$65,$72,$72,$6F,$72,$73,$20,$64,$65,$74,$65,$63
+	.byte	$74,$65,$64,$2E,$0A,$00
+S0006:
+	.byte	$0A,$46,$61,$69,$6C,$65,$64,$2E,$0A,$00
+S0003:
+	.byte	$71,$75,$65,$65,$70,$00
+
+.segment	"BSS"
+
+_lbits:
+	.res	2,$00
+_ubits:
+	.res	2,$00
+_fbits:
+	.res	2,$00
+_dbits:
+	.res	2,$00
+_flgs:
+	.res	2,$00
+_flgm:
+	.res	2,$00
+_flgd:
+	.res	2,$00
+_flgl:
+	.res	2,$00
+_rrc:
+	.res	2,$00
+_crc:
+	.res	2,$00
+_rfs:
+	.res	8,$00
+_extvar:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; int __near__ s71 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s71: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$20
+	jsr     subysp
+	lda     #<(M0002)
+	ldx     #>(M0002)
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$21
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     incaxy
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	txa
+	ldy     #$1E
+	jsr     staxysp
+L0002:	ldy     #$1B
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$1D
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1)
+	sta     (sreg)
+	tax
+	php
+	ldy     #$1A
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$1C
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	bne     L0002
+	lda     S0003
+	cmp     M0003
+	beq     L0009
+	ldy     #$1F
+	jsr     ldaxysp
+	ina
+	bne     L0006
+	inx
+L0006:	ldy     #$1E
+	jsr     staxysp
+	ldy     #$21
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L001D
+	cmp     #$00
+	beq     L0009
+L001D:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L0009:	ldx     #$07
+	lda     #$96
+	ldy     #$10
+	jsr     staxysp
+	jsr     pushax
+	lda     #$08
+	jsr     leaa0sp
+	ldy     #$0A
+	jsr     incaxy
+	jsr     ldaxi
+	jsr     tosicmp
+	beq     L0010
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     incax4
+	ldy     #$1E
+	jsr     staxysp
+	ldy     #$21
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L001E
+	cmp     #$00
+	beq     L0010
+L001E:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	tay
+	jsr     _printf
+L0010:	ldx     #$FF
+	lda     #$FB
+	jsr     _McCarthy
+	cpx     #$00
+	bne     L001F
+	cmp     #$5B
+	beq     L0022
+L001F:	ldy     #$1F
+	jsr     ldaxysp
+	jsr     incax8
+	ldy     #$1E
+	jsr     staxysp
+	ldy     #$21
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0020
+	cmp     #$00
+	beq     L0022
+L0020:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$08
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L0022:	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ina
+	ldy     #$02
+	jsr     staxysp
+	dea
+	jsr     leaa0sp
+	jsr     stax0sp
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _clobber
+	ldy     #$05
+	lda     (sp),y
+	bne     L0018
+	dey
+	lda     (sp),y
+	cmp     #$02
+	bne     L0018
+	dey
+	lda     (sp),y
+	bne     L0018
+	dey
+	lda     (sp),y
+	cmp     #$02
+	beq     L001B
+L0018:	ldy     #$1F
+	jsr     ldaxysp
+	ldy     #$10
+	jsr     incaxy
+	ldy     #$1E
+	jsr     staxysp
+	ldy     #$21
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0021
+	cmp     #$00
+	beq     L001B
+L0021:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$10
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L001B:	ldy     #$1F
+	jsr     ldaxysp
+	ldy     #$22
+	jmp     addysp
+
+.segment	"DATA"
+
+M0001:
+	.byte	$73,$37,$31,$2C,$65,$72,$25,$64,$0A,$00
+M0002:
+	.byte	$73,$37,$31,$20,$20,$20,$20,$00
+M0003:
+	.byte	$71
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ McCarthy (int x)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_McCarthy: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     ldax0sp
+	cmp     #$65
+	txa
+	sbc     #$00
+	bvs     L0003
+	eor     #$80
+L0003:	bpl     L0002
+	jsr     ldax0sp
+	ldy     #$0A
+	jsr     decaxy
+	bra     L0004
+L0002:	jsr     ldax0sp
+	ldy     #$0B
+	jsr     incaxy
+	jsr     _McCarthy
+	jsr     _McCarthy
+L0004:	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ clobber (int x, int *y)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_clobber: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldx     #$00
+	lda     #$03
+	ldy     #$02
+	jsr     staxysp
+	jsr     pushw0sp
+	ldx     #$00
+	lda     #$02
+	ldy     #$00
+	jsr     staxspidx
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ section (int j, void *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_section: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$02
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	bne     L0003
+	jsr     ldax0sp
+	jsr     _s71
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	ldx     #$00
+	lda     #$01
+	sta     M0001+14
+	stz     M0001+14+1
+	sta     M0001+16
+	stz     M0001+16+1
+	sta     M0001+18
+	stz     M0001+18+1
+	sta     M0001+20
+	stz     M0001+20+1
+	lda     #>(M0001)
+	sta     M0002+1
+	lda     #<(M0001)
+	sta     M0002
+	txa
+	jsr     stax0sp
+	bra     L0002
+L0005:	jsr     pushw0sp
+	lda     M0002
+	ldx     M0002+1
+	jsr     _section
+	sta     M0001+22
+	stx     M0001+22+1
+	lda     M0001+24
+	clc
+	adc     M0001+22
+	sta     M0001+24
+	lda     M0001+24+1
+	adc     M0001+22+1
+	sta     M0001+24+1
+	lda     M0001+14
+	ora     M0001+14+1
+	beq     L0007
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     #<(M0001+26)
+	ldx     #>(M0001+26)
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+L0007:	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+L0002:	jsr     ldax0sp
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	bmi     L0005
+	lda     M0001+24
+	ora     M0001+24+1
+	bne     L0009
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	bra     L000E
+L0009:	lda     #<(S0006)
+	ldx     #>(S0006)
+L000E:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     M0001+24
+	ldx     M0001+24+1
+	jmp     incsp6
+
+.segment	"BSS"
+
+M0001:
+	.res	34,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
@@ -0,0 +1,642 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "cq71.c", 6692, 1613073744
+	.dbg		file, "common.h", 522, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/stdlib.h", 5999, 1613073744
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_lbits
+	.export		_ubits
+	.export		_fbits
+	.export		_dbits
+	.export		_flgs
+	.export		_flgm
+	.export		_flgd
+	.export		_flgl
+	.export		_rrc
+	.export		_crc
+	.export		_rfs
+	.export		_extvar
+	.export		_s71
+	.export		_section
+	.export		_main
+
+.segment	"RODATA"
+
+S0004:
+	.byte	$53,$65,$63,$74,$69,$6F,$6E,$20,$25,$73,$20,$72,$65,$74,$75,$72
+	.byte	$6E,$65,$64,$20,$25,$64,$2E,$0A,$00
+S0005:
+	.byte	$0A,$4E,$6F,$20,$65,$72,$72,$6F,$72,$73,$20,$64,$65,$74,$65,$63
+	.byte	$74,$65,$64,$2E,$0A,$00
+S0006:
+	.byte	$0A,$46,$61,$69,$6C,$65,$64,$2E,$0A,$00
+S0003:
+	.byte	$71,$75,$65,$65,$70,$00
+
+.segment	"BSS"
+
+_lbits:
+	.res	2,$00
+_ubits:
+	.res	2,$00
+_fbits:
+	.res	2,$00
+_dbits:
+	.res	2,$00
+_flgs:
+	.res	2,$00
+_flgm:
+	.res	2,$00
+_flgd:
+	.res	2,$00
+_flgl:
+	.res	2,$00
+_rrc:
+	.res	2,$00
+_crc:
+	.res	2,$00
+_rfs:
+	.res	8,$00
+_extvar:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; int __near__ s71 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s71: near
+
+	.dbg	func, "s71", "00", extern, "_s71"
+	.dbg	sym, "pd0", "00", auto, 0
+	.dbg	sym, "rc", "00", auto, -2
+	.dbg	sym, "ps", "00", auto, -4
+	.dbg	sym, "pt", "00", auto, -6
+	.dbg	sym, "x", "00", auto, -26
+	.dbg	sym, "a", "00", auto, -28
+	.dbg	sym, "b", "00", auto, -30
+	.dbg	sym, "p", "00", auto, -32
+
+.segment	"CODE"
+
+	.dbg	line, "cq71.c", 55
+	jsr     pushax
+	.dbg	line, "cq71.c", 67
+	ldy     #$20
+	jsr     subysp
+	lda     #<(M0002)
+	ldx     #>(M0002)
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq71.c", 68
+	ldy     #$21
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     incaxy
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq71.c", 69
+	ldx     #$00
+	lda     #$00
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq71.c", 70
+	jmp     L0002
+L0002:	ldy     #$1B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1F
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$00
+	jsr     staspidx
+	tax
+	php
+	ldy     #$1A
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$1C
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	jne     L0002
+	.dbg	line, "cq71.c", 89
+	ldx     #$00
+	lda     S0003
+	jsr     pushax
+	ldx     #$00
+	lda     M0003
+	jsr     tosneax
+	jeq     L0005
+	.dbg	line, "cq71.c", 90
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     incax1
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq71.c", 91
+	ldy     #$21
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0007
+	cmp     #$00
+L0007:	jsr     boolne
+	jeq     L0005
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq71.c", 97
+L0005:	jmp     L0008
+	.dbg	line, "cq71.c", 98
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     incax2
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq71.c", 99
+	ldy     #$21
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L000A
+	cmp     #$00
+L000A:	jsr     boolne
+	jeq     L0008
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq71.c", 108
+L0008:	ldx     #$07
+	lda     #$96
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq71.c", 109
+	ldy     #$11
+	jsr     ldaxysp
+	cpx     #$07
+	bne     L000C
+	cmp     #$96
+L000C:	jsr     boolne
+	jne     L000D
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     pushax
+	lda     #$08
+	jsr     leaa0sp
+	ldy     #$0A
+	jsr     incaxy
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     tosneax
+	jne     L000D
+	ldx     #$00
+	lda     #$00
+	jeq     L000E
+L000D:	ldx     #$00
+	lda     #$01
+L000E:	jeq     L000F
+	.dbg	line, "cq71.c", 110
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     incax4
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq71.c", 111
+	ldy     #$21
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0010
+	cmp     #$00
+L0010:	jsr     boolne
+	jeq     L000F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$04
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq71.c", 119
+L000F:	ldx     #$FF
+	lda     #$FB
+	jsr     _McCarthy
+	cpx     #$00
+	bne     L0012
+	cmp     #$5B
+L0012:	jsr     boolne
+	jeq     L0013
+	.dbg	line, "cq71.c", 120
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     incax8
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq71.c", 121
+	ldy     #$21
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0014
+	cmp     #$00
+L0014:	jsr     boolne
+	jeq     L0013
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$08
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq71.c", 126
+L0013:	ldx     #$00
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq71.c", 127
+	ldx     #$00
+	lda     #$03
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "cq71.c", 128
+	lda     #$02
+	jsr     leaa0sp
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "cq71.c", 130
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _clobber
+	.dbg	line, "cq71.c", 132
+	ldy     #$05
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0016
+	cmp     #$02
+L0016:	jsr     boolne
+	jne     L0017
+	ldy     #$03
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0018
+	cmp     #$02
+L0018:	jsr     boolne
+	jne     L0017
+	ldx     #$00
+	lda     #$00
+	jeq     L0019
+L0017:	ldx     #$00
+	lda     #$01
+L0019:	jeq     L001A
+	.dbg	line, "cq71.c", 133
+	ldy     #$1F
+	jsr     ldaxysp
+	ldy     #$10
+	jsr     incaxy
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq71.c", 134
+	ldy     #$21
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L001B
+	cmp     #$00
+L001B:	jsr     boolne
+	jeq     L001A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$10
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq71.c", 148
+L001A:	ldy     #$1F
+	jsr     ldaxysp
+	jmp     L0001
+	.dbg	line, "cq71.c", 149
+L0001:	ldy     #$22
+	jsr     addysp
+	rts
+
+	.dbg	line
+.segment	"DATA"
+
+M0001:
+	.byte	$73,$37,$31,$2C,$65,$72,$25,$64,$0A,$00
+M0002:
+	.byte	$73,$37,$31,$20,$20,$20,$20,$00
+M0003:
+	.byte	$71
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ McCarthy (int x)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_McCarthy: near
+
+	.dbg	func, "McCarthy", "00", static, "_McCarthy"
+	.dbg	sym, "x", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "cq71.c", 155
+	jsr     pushax
+	.dbg	line, "cq71.c", 157
+	ldy     #$01
+	jsr     ldaxysp
+	cmp     #$65
+	txa
+	sbc     #$00
+	bvs     L0003
+	eor     #$80
+L0003:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0002
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$0A
+	jsr     decaxy
+	jmp     L0004
+	.dbg	line, "cq71.c", 158
+	jmp     L0004
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$0B
+	jsr     incaxy
+	jsr     _McCarthy
+	jsr     _McCarthy
+	jmp     L0004
+	.dbg	line, "cq71.c", 159
+L0004:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ clobber (int x, int *y)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_clobber: near
+
+	.dbg	func, "clobber", "00", static, "_clobber"
+	.dbg	sym, "x", "00", auto, 2
+	.dbg	sym, "y", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "cq71.c", 187
+	jsr     pushax
+	.dbg	line, "cq71.c", 188
+	ldx     #$00
+	lda     #$03
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "cq71.c", 189
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "cq71.c", 190
+	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ section (int j, void *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_section: near
+
+	.dbg	func, "section", "00", extern, "_section"
+	.dbg	sym, "j", "00", auto, 2
+	.dbg	sym, "pd0", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "cq71.c", 199
+	jsr     pushax
+	.dbg	line, "cq71.c", 201
+	ldy     #$03
+	jsr     ldaxysp
+	jmp     L0002
+	.dbg	line, "cq71.c", 204
+L0002:	cpx     #$00
+	jne     L0005
+	cmp     #$00
+	jeq     L0004
+	jmp     L0003
+L0005:	jmp     L0003
+	.dbg	line, "cq71.c", 203
+L0004:	ldy     #$01
+	jsr     ldaxysp
+	jsr     _s71
+	jmp     L0003
+	.dbg	line, "cq71.c", 205
+L0003:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+	.dbg	sym, "n", "00", auto, 2
+	.dbg	sym, "args", "00", auto, 0
+	.dbg	sym, "j", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "cq71.c", 225
+	jsr     decsp2
+	ldx     #$00
+	lda     #$01
+	sta     M0001+14
+	stx     M0001+14+1
+	.dbg	line, "cq71.c", 226
+	ldx     #$00
+	lda     #$01
+	sta     M0001+16
+	stx     M0001+16+1
+	.dbg	line, "cq71.c", 227
+	ldx     #$00
+	lda     #$01
+	sta     M0001+18
+	stx     M0001+18+1
+	.dbg	line, "cq71.c", 228
+	ldx     #$00
+	lda     #$01
+	sta     M0001+20
+	stx     M0001+20+1
+	.dbg	line, "cq71.c", 230
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	sta     M0002
+	stx     M0002+1
+	.dbg	line, "cq71.c", 232
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+	jmp     L0002
+	.dbg	line, "cq71.c", 233
+L0005:	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	lda     M0002
+	ldx     M0002+1
+	jsr     _section
+	sta     M0001+22
+	stx     M0001+22+1
+	.dbg	line, "cq71.c", 234
+	lda     M0001+24
+	ldx     M0001+24+1
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     tosaddax
+	sta     M0001+24
+	stx     M0001+24+1
+	.dbg	line, "cq71.c", 235
+	lda     M0001+14
+	ldx     M0001+14+1
+	cpx     #$00
+	bne     L0008
+	cmp     #$00
+L0008:	jsr     boolne
+	jeq     L0007
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     #<(M0001+26)
+	ldx     #>(M0001+26)
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "cq71.c", 232
+L0007:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0005
+	.dbg	line, "cq71.c", 238
+	lda     M0001+24
+	ldx     M0001+24+1
+	cpx     #$00
+	bne     L000A
+	cmp     #$00
+L000A:	jsr     booleq
+	jeq     L0009
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cq71.c", 239
+	jmp     L000B
+L0009:	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cq71.c", 241
+L000B:	lda     M0001+24
+	ldx     M0001+24+1
+	jmp     L0001
+	.dbg	line, "cq71.c", 242
+L0001:	jsr     incsp6
+	rts
+
+	.dbg	line
+.segment	"BSS"
+
+M0001:
+	.res	34,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
@@ -0,0 +1,10167 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_printf
+	.export		_lbits
+	.export		_ubits
+	.export		_fbits
+	.export		_dbits
+	.export		_flgs
+	.export		_flgm
+	.export		_flgd
+	.export		_flgl
+	.export		_rrc
+	.export		_crc
+	.export		_rfs
+	.export		_s714
+	.export		_section
+	.export		_main
+
+.segment	"RODATA"
+
+S0004:
+	.byte	$53,$65,$63,$74,$69,$6F,$6E,$20,$25,$73,$20,$72,$65,$74,$75,$72
+	.byte	$6E,$65,$64,$20,$25,$64,$2E,$0A,$00
+S0005:
+	.byte	$0A,$4E,$6F,$20,$65,$72,$72,$6F,$72,$73,$20,$64,$65,$74,$65,$63
+	.byte	$74,$65,$64,$2E,$0A,$00
+S0006:
+	.byte	$0A,$46,$61,$69,$6C,$65,$64,$2E,$0A,$00
+
+.segment	"BSS"
+
+_lbits:
+	.res	2,$00
+_ubits:
+	.res	2,$00
+_fbits:
+	.res	2,$00
+_dbits:
+	.res	2,$00
+_flgs:
+	.res	2,$00
+_flgm:
+	.res	2,$00
+_flgd:
+	.res	2,$00
+_flgl:
+	.res	2,$00
+_rrc:
+	.res	2,$00
+_crc:
+	.res	2,$00
+_rfs:
+	.res	8,$00
+
+; ---------------------------------------------------------------
+; int __near__ s714 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s714: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$28
+	jsr     subysp
+	lda     #<(M0003)
+	ldx     #>(M0003)
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$29
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$1A
+	bcc     L0002
+	inx
+L0002:	jsr     stax0sp
+	ldy     #$22
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$29
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$15
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	ldy     #$26
+	jsr     staxysp
+L0003:	ldy     #$01
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	ldy     #$03
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$00
+	lda     (ptr1),y
+	sta     (sreg),y
+	tax
+	php
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	bne     L0003
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	lda     #$02
+	dey
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$05
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$02
+	beq     L02BD
+	ldy     #$24
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02BD
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L02BD:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$02
+	beq     L02BE
+	ldy     #$24
+	lda     #$03
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02BE
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L02BE:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     (sp),y
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$02
+	beq     L02BF
+	ldy     #$24
+	lda     #$04
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02BF
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L02BF:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$02
+	beq     L02C0
+	ldy     #$24
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02C0
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L02C0:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$08
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$02
+	beq     L02C1
+	ldy     #$24
+	lda     #$06
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02C1
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L02C1:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$04
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$02
+	beq     L02C2
+	ldy     #$24
+	lda     #$07
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02C2
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L02C2:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	iny
+	sta     (sp),y
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$1E
+	jsr     staxysp
+	cmp     #$02
+	beq     L02C3
+	ldy     #$24
+	lda     #$08
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02C3
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L02C3:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$1E
+	jsr     staxysp
+	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$1E
+	jsr     staxysp
+	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$11
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L03BA
+	cmp     #$02
+	beq     L02C6
+L03BA:	ldy     #$24
+	lda     #$0B
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02C6
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L02C6:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$1E
+	jsr     staxysp
+	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$1E
+	jsr     staxysp
+	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$1E
+	jsr     staxysp
+	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$1A
+	jsr     staxysp
+	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	lda     #$02
+	iny
+	jsr     staxysp
+	ldy     #$1A
+	jsr     staxysp
+	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$1A
+	jsr     staxysp
+	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$11
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L03BB
+	cmp     #$02
+	beq     L02CD
+L03BB:	ldy     #$24
+	lda     #$12
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02CD
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L02CD:	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$1A
+	jsr     staxysp
+	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$1A
+	jsr     staxysp
+	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$1A
+	jsr     staxysp
+	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	stx     sreg
+	stx     sreg+1
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	beq     L003F
+	ldx     #$00
+	ldy     #$24
+	lda     #$16
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02D1
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L003F:	ldx     #$00
+L02D1:	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	jsr     axlong
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	beq     L0041
+	ldx     #$00
+	ldy     #$24
+	lda     #$17
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02D2
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0041:	ldx     #$00
+L02D2:	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	jsr     axlong
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	beq     L02D3
+	ldy     #$24
+	lda     #$18
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02D3
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L02D3:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jsr     ldeaxysp
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	beq     L0045
+	ldx     #$00
+	ldy     #$24
+	lda     #$19
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02D4
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0045:	ldx     #$00
+L02D4:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$14
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	beq     L0047
+	ldx     #$00
+	ldy     #$24
+	lda     #$1A
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02D5
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0047:	ldx     #$00
+L02D5:	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	jsr     axlong
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	beq     L0049
+	ldx     #$00
+	ldy     #$24
+	lda     #$1B
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02D6
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0049:	ldx     #$00
+L02D6:	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	jsr     axlong
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	beq     L02D7
+	ldy     #$24
+	lda     #$1C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02D7
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L02D7:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$0E
+	jsr     staxysp
+	cmp     #$02
+	beq     L02D8
+	ldy     #$24
+	lda     #$1D
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02D8
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L02D8:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$0E
+	jsr     staxysp
+	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$0E
+	jsr     staxysp
+	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	iny
+	lda     #$02
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$11
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L03BC
+	cmp     #$02
+	beq     L02DB
+L03BC:	ldy     #$24
+	lda     #$20
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02DB
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L02DB:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$0E
+	jsr     staxysp
+	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$0E
+	jsr     staxysp
+	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$0E
+	jsr     staxysp
+	ldy     #$0A
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$0A
+	jsr     staxysp
+	ldy     #$0A
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$0A
+	jsr     staxysp
+	ldy     #$0A
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$0A
+	jsr     staxysp
+	ldy     #$0A
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$11
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$0A
+	jsr     staxysp
+	cpx     #$00
+	bne     L03BD
+	cmp     #$02
+	beq     L02E2
+L03BD:	ldy     #$24
+	lda     #$27
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02E2
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L02E2:	ldy     #$0A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	iny
+	jsr     staxysp
+	ldy     #$0A
+	jsr     staxysp
+	ldy     #$0A
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$0A
+	jsr     staxysp
+	ldy     #$0A
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$0A
+	jsr     staxysp
+	ldy     #$06
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$06
+	jsr     staxysp
+	ldy     #$06
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$06
+	jsr     staxysp
+	ldy     #$06
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$06
+	jsr     staxysp
+	ldy     #$06
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$11
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L03BE
+	cmp     #$02
+	beq     L02E9
+L03BE:	ldy     #$24
+	lda     #$2E
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02E9
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L02E9:	ldy     #$06
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$06
+	jsr     staxysp
+	ldy     #$06
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	lda     #$02
+	iny
+	jsr     staxysp
+	ldy     #$06
+	jsr     staxysp
+	ldy     #$06
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$06
+	jsr     staxysp
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	lda     #$02
+	dey
+	sta     (sp),y
+	iny
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$07
+	beq     L02ED
+	ldy     #$24
+	lda     #$32
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02ED
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L02ED:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$21
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$07
+	beq     L02EE
+	ldy     #$24
+	lda     #$33
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02EE
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L02EE:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$21
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$07
+	beq     L02EF
+	ldy     #$24
+	lda     #$34
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02EF
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L02EF:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jsr     ldeaxysp
+	ldy     #$21
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$07
+	beq     L02F0
+	ldy     #$24
+	lda     #$35
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02F0
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L02F0:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$21
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$07
+	beq     L02F1
+	ldy     #$24
+	lda     #$36
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02F1
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L02F1:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$21
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$07
+	beq     L02F2
+	ldy     #$24
+	lda     #$37
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02F2
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L02F2:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$21
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$07
+	beq     L02F3
+	ldy     #$24
+	lda     #$38
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02F3
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L02F3:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	iny
+	sta     (sp),y
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$1E
+	jsr     addeqysp
+	ldy     #$1F
+	lda     (sp),y
+	bne     L03BF
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L0451
+L03BF:	ldy     #$24
+	lda     #$39
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02F4
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L02F4:	ldy     #$1E
+L0451:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$1E
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$1F
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03C0
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L0452
+L03C0:	ldy     #$24
+	lda     #$3A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02F5
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L02F5:	ldy     #$1E
+L0452:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$1E
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$19
+	lda     (sp),y
+	ldy     #$1F
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03C1
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L0453
+L03C1:	ldy     #$24
+	lda     #$3B
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02F6
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L02F6:	ldy     #$1E
+L0453:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jsr     ldeaxysp
+	ldy     #$1E
+	jsr     addeqysp
+	ldy     #$1F
+	lda     (sp),y
+	bne     L03C2
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L0454
+L03C2:	ldy     #$24
+	lda     #$3C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02F7
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L02F7:	ldy     #$1E
+L0454:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$1E
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$0D
+	lda     (sp),y
+	ldy     #$1F
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03C3
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L0455
+L03C3:	ldy     #$24
+	lda     #$3D
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02F8
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L02F8:	ldy     #$1E
+L0455:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$1E
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	ldy     #$1F
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03C4
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L0456
+L03C4:	ldy     #$24
+	lda     #$3E
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02F9
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L02F9:	ldy     #$1E
+L0456:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$04
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$1E
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$05
+	lda     (sp),y
+	ldy     #$1F
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03C5
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L02FA
+L03C5:	ldy     #$24
+	lda     #$3F
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02FA
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L02FA:	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$1A
+	jsr     addeqysp
+	ldy     #$1B
+	lda     (sp),y
+	bne     L03C6
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L0457
+L03C6:	ldy     #$24
+	lda     #$40
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02FB
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L02FB:	ldy     #$1A
+L0457:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$1A
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$1D
+	lda     (sp),y
+	ldy     #$1B
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03C7
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L0458
+L03C7:	ldy     #$24
+	lda     #$41
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02FC
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L02FC:	ldy     #$1A
+L0458:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$1A
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$1B
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03C8
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L0459
+L03C8:	ldy     #$24
+	lda     #$42
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02FD
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L02FD:	ldy     #$1A
+L0459:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jsr     ldeaxysp
+	ldy     #$1A
+	jsr     addeqysp
+	ldy     #$1B
+	lda     (sp),y
+	bne     L03C9
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L045A
+L03C9:	ldy     #$24
+	lda     #$43
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02FE
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L02FE:	ldy     #$1A
+L045A:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$1A
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$0D
+	lda     (sp),y
+	ldy     #$1B
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03CA
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L045B
+L03CA:	ldy     #$24
+	lda     #$44
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02FF
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L02FF:	ldy     #$1A
+L045B:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$1A
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	ldy     #$1B
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03CB
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L045C
+L03CB:	ldy     #$24
+	lda     #$45
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0300
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0300:	ldy     #$1A
+L045C:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	ldy     #$04
+	lda     #$02
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$1A
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$05
+	lda     (sp),y
+	ldy     #$1B
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03CC
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L0301
+L03CC:	ldy     #$24
+	lda     #$46
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0301
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L0301:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	stx     sreg
+	stx     sreg+1
+	ldy     #$14
+	jsr     laddeqysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$07
+	jsr     tosneeax
+	beq     L00C4
+	ldx     #$00
+	ldy     #$24
+	lda     #$47
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0302
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00C4:	ldx     #$00
+L0302:	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	jsr     axlong
+	ldy     #$14
+	jsr     laddeqysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$07
+	jsr     tosneeax
+	beq     L00C6
+	ldx     #$00
+	ldy     #$24
+	lda     #$48
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0303
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00C6:	ldx     #$00
+L0303:	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	jsr     axlong
+	ldy     #$14
+	jsr     laddeqysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$07
+	jsr     tosneeax
+	beq     L0304
+	ldy     #$24
+	lda     #$49
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0304
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0304:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jsr     ldeaxysp
+	ldy     #$14
+	jsr     laddeqysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$07
+	jsr     tosneeax
+	beq     L00CA
+	ldx     #$00
+	ldy     #$24
+	lda     #$4A
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0305
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00CA:	ldx     #$00
+L0305:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	stx     sreg
+	stx     sreg+1
+	ldy     #$14
+	jsr     laddeqysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$07
+	jsr     tosneeax
+	beq     L00CC
+	ldx     #$00
+	ldy     #$24
+	lda     #$4B
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0306
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00CC:	ldx     #$00
+L0306:	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	jsr     axlong
+	ldy     #$14
+	jsr     laddeqysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$07
+	jsr     tosneeax
+	beq     L00CE
+	ldx     #$00
+	ldy     #$24
+	lda     #$4C
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0307
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00CE:	ldx     #$00
+L0307:	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	jsr     axlong
+	ldy     #$14
+	jsr     laddeqysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$07
+	jsr     tosneeax
+	beq     L0308
+	ldy     #$24
+	lda     #$4D
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0308
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0308:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$0E
+	jsr     addeqysp
+	ldy     #$0F
+	lda     (sp),y
+	bne     L03CD
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L045D
+L03CD:	ldy     #$24
+	lda     #$4E
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0309
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0309:	ldy     #$0E
+L045D:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$0E
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$1D
+	lda     (sp),y
+	ldy     #$0F
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03CE
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L045E
+L03CE:	ldy     #$24
+	lda     #$4F
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L030A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L030A:	ldy     #$0E
+L045E:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$0E
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$19
+	lda     (sp),y
+	ldy     #$0F
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03CF
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L045F
+L03CF:	ldy     #$24
+	lda     #$50
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L030B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L030B:	ldy     #$0E
+L045F:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jsr     ldeaxysp
+	ldy     #$0E
+	jsr     addeqysp
+	ldy     #$0F
+	lda     (sp),y
+	bne     L03D0
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L0460
+L03D0:	ldy     #$24
+	lda     #$51
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L030C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L030C:	ldy     #$0E
+L0460:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$0E
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$0F
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03D1
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L0461
+L03D1:	ldy     #$24
+	lda     #$52
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L030D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L030D:	ldy     #$0E
+L0461:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$0E
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	ldy     #$0F
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03D2
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L0462
+L03D2:	ldy     #$24
+	lda     #$53
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L030E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L030E:	ldy     #$0E
+L0462:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$04
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$0E
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$05
+	lda     (sp),y
+	ldy     #$0F
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03D3
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L030F
+L03D3:	ldy     #$24
+	lda     #$54
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L030F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L030F:	ldy     #$0A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$0A
+	jsr     addeqysp
+	ldy     #$0B
+	lda     (sp),y
+	bne     L03D4
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L0463
+L03D4:	ldy     #$24
+	lda     #$55
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0310
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0310:	ldy     #$0A
+L0463:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$0A
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$1D
+	lda     (sp),y
+	ldy     #$0B
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03D5
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L0464
+L03D5:	ldy     #$24
+	lda     #$56
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0311
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0311:	ldy     #$0A
+L0464:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$0A
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$19
+	lda     (sp),y
+	ldy     #$0B
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03D6
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L0465
+L03D6:	ldy     #$24
+	lda     #$57
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0312
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0312:	ldy     #$0A
+L0465:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jsr     ldeaxysp
+	ldy     #$0A
+	jsr     addeqysp
+	ldy     #$0B
+	lda     (sp),y
+	bne     L03D7
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L0466
+L03D7:	ldy     #$24
+	lda     #$58
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0313
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0313:	ldy     #$0A
+L0466:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$0A
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$0D
+	lda     (sp),y
+	ldy     #$0B
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03D8
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L0467
+L03D8:	ldy     #$24
+	lda     #$59
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0314
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0314:	ldy     #$0A
+L0467:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$0A
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$0B
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03D9
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L0468
+L03D9:	ldy     #$24
+	lda     #$5A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0315
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0315:	ldy     #$0A
+L0468:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$04
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$0A
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$05
+	lda     (sp),y
+	ldy     #$0B
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03DA
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L0316
+L03DA:	ldy     #$24
+	lda     #$5B
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0316
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0316:	ldy     #$06
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$06
+	jsr     addeqysp
+	ldy     #$07
+	lda     (sp),y
+	bne     L03DB
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L0469
+L03DB:	ldy     #$24
+	lda     #$5C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0317
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0317:	ldy     #$06
+L0469:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$06
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$1D
+	lda     (sp),y
+	ldy     #$07
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03DC
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L046A
+L03DC:	ldy     #$24
+	lda     #$5D
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0318
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0318:	ldy     #$06
+L046A:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$06
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$19
+	lda     (sp),y
+	ldy     #$07
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03DD
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L046B
+L03DD:	ldy     #$24
+	lda     #$5E
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0319
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0319:	ldy     #$06
+L046B:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jsr     ldeaxysp
+	ldy     #$06
+	jsr     addeqysp
+	ldy     #$07
+	lda     (sp),y
+	bne     L03DE
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L046C
+L03DE:	ldy     #$24
+	lda     #$5F
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L031A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L031A:	ldy     #$06
+L046C:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$06
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$0D
+	lda     (sp),y
+	ldy     #$07
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03DF
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L046D
+L03DF:	ldy     #$24
+	lda     #$60
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L031B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L031B:	ldy     #$06
+L046D:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$06
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	ldy     #$07
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03E0
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L046E
+L03E0:	ldy     #$24
+	lda     #$61
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L031C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L031C:	ldy     #$06
+L046E:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$04
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$06
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$07
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03E1
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L031D
+L03E1:	ldy     #$24
+	lda     #$62
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L031D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L031D:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	lda     #$02
+	dey
+	sta     (sp),y
+	iny
+	lda     #$FD
+	sec
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$03
+	beq     L031E
+	ldy     #$24
+	lda     #$63
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L031E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L031E:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$21
+	lda     #$FD
+	sec
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$03
+	beq     L031F
+	ldy     #$24
+	lda     #$64
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L031F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L031F:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$21
+	lda     #$FD
+	sec
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$03
+	beq     L0320
+	ldy     #$24
+	lda     #$65
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0320
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0320:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jsr     ldeaxysp
+	ldy     #$21
+	eor     #$FF
+	sec
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$03
+	beq     L0321
+	ldy     #$24
+	lda     #$66
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0321
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0321:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$21
+	lda     #$FD
+	sec
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$03
+	beq     L0322
+	ldy     #$24
+	lda     #$67
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0322
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0322:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$21
+	lda     #$FD
+	sec
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$03
+	beq     L0323
+	ldy     #$24
+	lda     #$68
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0323
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0323:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$21
+	lda     #$FD
+	sec
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$03
+	beq     L0324
+	ldy     #$24
+	lda     #$69
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0324
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0324:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	iny
+	sta     (sp),y
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$1E
+	jsr     subeqysp
+	ldy     #$1F
+	lda     (sp),y
+	bne     L03E2
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L046F
+L03E2:	ldy     #$24
+	lda     #$6A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0325
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0325:	ldy     #$1E
+L046F:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$1E
+	jsr     subeqysp
+	ldy     #$1F
+	lda     (sp),y
+	bne     L03E3
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0470
+L03E3:	ldy     #$24
+	lda     #$6B
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0326
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0326:	ldy     #$1E
+L0470:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$1E
+	jsr     subeqysp
+	ldy     #$1F
+	lda     (sp),y
+	bne     L03E4
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0471
+L03E4:	ldy     #$24
+	lda     #$6C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0327
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0327:	ldy     #$1E
+L0471:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jsr     ldeaxysp
+	ldy     #$1E
+	jsr     subeqysp
+	ldy     #$1F
+	lda     (sp),y
+	bne     L03E5
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0472
+L03E5:	ldy     #$24
+	lda     #$6D
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0328
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0328:	ldy     #$1E
+L0472:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$1E
+	jsr     subeqysp
+	ldy     #$1F
+	lda     (sp),y
+	bne     L03E6
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0473
+L03E6:	ldy     #$24
+	lda     #$6E
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0329
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0329:	ldy     #$1E
+L0473:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$1E
+	jsr     subeqysp
+	ldy     #$1F
+	lda     (sp),y
+	bne     L03E7
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0474
+L03E7:	ldy     #$24
+	lda     #$6F
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L032A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L032A:	ldy     #$1E
+L0474:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$1E
+	jsr     subeqysp
+	ldy     #$1F
+	lda     (sp),y
+	bne     L03E8
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L032B
+L03E8:	ldy     #$24
+	lda     #$70
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L032B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L032B:	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$1A
+	jsr     subeqysp
+	ldy     #$1B
+	lda     (sp),y
+	bne     L03E9
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0475
+L03E9:	ldy     #$24
+	lda     #$71
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L032C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L032C:	ldy     #$1A
+L0475:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	iny
+	jsr     staxysp
+	ldy     #$1A
+	jsr     subeqysp
+	ldy     #$1B
+	lda     (sp),y
+	bne     L03EA
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0476
+L03EA:	ldy     #$24
+	lda     #$72
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L032D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L032D:	ldy     #$1A
+L0476:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$1A
+	jsr     subeqysp
+	ldy     #$1B
+	lda     (sp),y
+	bne     L03EB
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0477
+L03EB:	ldy     #$24
+	lda     #$73
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L032E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L032E:	ldy     #$1A
+L0477:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jsr     ldeaxysp
+	ldy     #$1A
+	jsr     subeqysp
+	ldy     #$1B
+	lda     (sp),y
+	bne     L03EC
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0478
+L03EC:	ldy     #$24
+	lda     #$74
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L032F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L032F:	ldy     #$1A
+L0478:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$1A
+	jsr     subeqysp
+	ldy     #$1B
+	lda     (sp),y
+	bne     L03ED
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0479
+L03ED:	ldy     #$24
+	lda     #$75
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0330
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0330:	ldy     #$1A
+L0479:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$1A
+	jsr     subeqysp
+	ldy     #$1B
+	lda     (sp),y
+	bne     L03EE
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L047A
+L03EE:	ldy     #$24
+	lda     #$76
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0331
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0331:	ldy     #$1A
+L047A:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$1A
+	jsr     subeqysp
+	ldy     #$1B
+	lda     (sp),y
+	bne     L03EF
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0147
+L03EF:	ldx     #$00
+	ldy     #$24
+	lda     #$77
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0332
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0147:	ldx     #$00
+L0332:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	stx     sreg
+	stx     sreg+1
+	ldy     #$14
+	jsr     lsubeqysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$03
+	jsr     tosneeax
+	beq     L0149
+	ldx     #$00
+	ldy     #$24
+	lda     #$78
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0333
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0149:	ldx     #$00
+L0333:	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	jsr     axlong
+	ldy     #$14
+	jsr     lsubeqysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$03
+	jsr     tosneeax
+	beq     L014B
+	ldx     #$00
+	ldy     #$24
+	lda     #$79
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0334
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L014B:	ldx     #$00
+L0334:	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	jsr     axlong
+	ldy     #$14
+	jsr     lsubeqysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$03
+	jsr     tosneeax
+	beq     L0335
+	ldy     #$24
+	lda     #$7A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0335
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0335:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jsr     ldeaxysp
+	ldy     #$14
+	jsr     lsubeqysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$03
+	jsr     tosneeax
+	beq     L014F
+	ldx     #$00
+	ldy     #$24
+	lda     #$7B
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0336
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L014F:	ldx     #$00
+L0336:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	stx     sreg
+	stx     sreg+1
+	ldy     #$14
+	jsr     lsubeqysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$03
+	jsr     tosneeax
+	beq     L0151
+	ldx     #$00
+	ldy     #$24
+	lda     #$7C
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0337
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0151:	ldx     #$00
+L0337:	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	jsr     axlong
+	ldy     #$14
+	jsr     lsubeqysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$03
+	jsr     tosneeax
+	beq     L0153
+	ldx     #$00
+	ldy     #$24
+	lda     #$7D
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0338
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0153:	ldx     #$00
+L0338:	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	jsr     axlong
+	ldy     #$14
+	jsr     lsubeqysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$03
+	jsr     tosneeax
+	beq     L0339
+	ldy     #$24
+	lda     #$7E
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0339
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0339:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$0E
+	jsr     subeqysp
+	ldy     #$0F
+	lda     (sp),y
+	bne     L03F0
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L047B
+L03F0:	ldy     #$24
+	lda     #$7F
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L033A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L033A:	ldy     #$0E
+L047B:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$0E
+	jsr     subeqysp
+	ldy     #$0F
+	lda     (sp),y
+	bne     L03F1
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L047C
+L03F1:	ldy     #$24
+	lda     #$80
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L033B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L033B:	ldy     #$0E
+L047C:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$0E
+	jsr     subeqysp
+	ldy     #$0F
+	lda     (sp),y
+	bne     L03F2
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L047D
+L03F2:	ldy     #$24
+	lda     #$81
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L033C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L033C:	ldy     #$0E
+L047D:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jsr     ldeaxysp
+	ldy     #$0E
+	jsr     subeqysp
+	ldy     #$0F
+	lda     (sp),y
+	bne     L03F3
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L047E
+L03F3:	ldy     #$24
+	lda     #$82
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L033D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L033D:	ldy     #$0E
+L047E:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$0E
+	jsr     subeqysp
+	ldy     #$0F
+	lda     (sp),y
+	bne     L03F4
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L047F
+L03F4:	ldy     #$24
+	lda     #$83
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L033E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L033E:	ldy     #$0E
+L047F:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$0E
+	jsr     subeqysp
+	ldy     #$0F
+	lda     (sp),y
+	bne     L03F5
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0480
+L03F5:	ldy     #$24
+	lda     #$84
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L033F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L033F:	ldy     #$0E
+L0480:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$0E
+	jsr     subeqysp
+	ldy     #$0F
+	lda     (sp),y
+	bne     L03F6
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0340
+L03F6:	ldy     #$24
+	lda     #$85
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0340
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0340:	ldy     #$0A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$0A
+	jsr     subeqysp
+	ldy     #$0B
+	lda     (sp),y
+	bne     L03F7
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0481
+L03F7:	ldy     #$24
+	lda     #$86
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0341
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0341:	ldy     #$0A
+L0481:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$0A
+	jsr     subeqysp
+	ldy     #$0B
+	lda     (sp),y
+	bne     L03F8
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0482
+L03F8:	ldy     #$24
+	lda     #$87
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0342
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0342:	ldy     #$0A
+L0482:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$0A
+	jsr     subeqysp
+	ldy     #$0B
+	lda     (sp),y
+	bne     L03F9
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0483
+L03F9:	ldy     #$24
+	lda     #$88
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0343
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0343:	ldy     #$0A
+L0483:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jsr     ldeaxysp
+	ldy     #$0A
+	jsr     subeqysp
+	ldy     #$0B
+	lda     (sp),y
+	bne     L03FA
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0484
+L03FA:	ldy     #$24
+	lda     #$89
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0344
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0344:	ldy     #$0A
+L0484:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	iny
+	jsr     staxysp
+	ldy     #$0A
+	jsr     subeqysp
+	ldy     #$0B
+	lda     (sp),y
+	bne     L03FB
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0485
+L03FB:	ldy     #$24
+	lda     #$8A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0345
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0345:	ldy     #$0A
+L0485:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$0A
+	jsr     subeqysp
+	ldy     #$0B
+	lda     (sp),y
+	bne     L03FC
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0486
+L03FC:	ldy     #$24
+	lda     #$8B
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0346
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0346:	ldy     #$0A
+L0486:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$0A
+	jsr     subeqysp
+	ldy     #$0B
+	lda     (sp),y
+	bne     L03FD
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0347
+L03FD:	ldy     #$24
+	lda     #$8C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0347
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0347:	ldy     #$06
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$06
+	jsr     subeqysp
+	ldy     #$07
+	lda     (sp),y
+	bne     L03FE
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0487
+L03FE:	ldy     #$24
+	lda     #$8D
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0348
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0348:	ldy     #$06
+L0487:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$06
+	jsr     subeqysp
+	ldy     #$07
+	lda     (sp),y
+	bne     L03FF
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0488
+L03FF:	ldy     #$24
+	lda     #$8E
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0349
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0349:	ldy     #$06
+L0488:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$06
+	jsr     subeqysp
+	ldy     #$07
+	lda     (sp),y
+	bne     L0400
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0489
+L0400:	ldy     #$24
+	lda     #$8F
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L034A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L034A:	ldy     #$06
+L0489:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jsr     ldeaxysp
+	ldy     #$06
+	jsr     subeqysp
+	ldy     #$07
+	lda     (sp),y
+	bne     L0401
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L048A
+L0401:	ldy     #$24
+	lda     #$90
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L034B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L034B:	ldy     #$06
+L048A:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$06
+	jsr     subeqysp
+	ldy     #$07
+	lda     (sp),y
+	bne     L0402
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L048B
+L0402:	ldy     #$24
+	lda     #$91
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L034C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L034C:	ldy     #$06
+L048B:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	iny
+	jsr     staxysp
+	ldy     #$06
+	jsr     subeqysp
+	ldy     #$07
+	lda     (sp),y
+	bne     L0403
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L048C
+L0403:	ldy     #$24
+	lda     #$92
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L034D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L034D:	ldy     #$06
+L048C:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$06
+	jsr     subeqysp
+	ldy     #$07
+	lda     (sp),y
+	bne     L0404
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L034E
+L0404:	ldy     #$24
+	lda     #$93
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L034E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L034E:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	lda     #$02
+	dey
+	sta     (sp),y
+	iny
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$22
+	lda     (sp),y
+	jsr     tosumula0
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$0A
+	beq     L034F
+	ldy     #$24
+	lda     #$94
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L034F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L034F:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$1F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmulax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$0A
+	beq     L0350
+	ldy     #$24
+	lda     #$95
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0350
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0350:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$1B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmulax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$0A
+	beq     L0351
+	ldy     #$24
+	lda     #$96
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0351
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0351:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosmuleax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$0A
+	beq     L0352
+	ldy     #$24
+	lda     #$97
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0352
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0352:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$0F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumulax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$0A
+	beq     L0353
+	ldy     #$24
+	lda     #$98
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0353
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0353:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$08
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$0B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmulax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$0A
+	beq     L0354
+	ldy     #$24
+	lda     #$99
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0354
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0354:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$04
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmulax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$0A
+	beq     L0355
+	ldy     #$24
+	lda     #$9A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0355
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0355:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	iny
+	sta     (sp),y
+	iny
+	jsr     pushwysp
+	ldy     #$22
+	lda     (sp),y
+	jsr     tosmula0
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0405
+	cmp     #$0A
+	beq     L0356
+L0405:	ldy     #$24
+	lda     #$9B
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0356
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0356:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$1F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmulax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0406
+	cmp     #$0A
+	beq     L0357
+L0406:	ldy     #$24
+	lda     #$9C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0357
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0357:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$1B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmulax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0407
+	cmp     #$0A
+	beq     L0358
+L0407:	ldy     #$24
+	lda     #$9D
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0358
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0358:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosmuleax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0408
+	cmp     #$0A
+	beq     L0359
+L0408:	ldy     #$24
+	lda     #$9E
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0359
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0359:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$0F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumulax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0409
+	cmp     #$0A
+	beq     L035A
+L0409:	ldy     #$24
+	lda     #$9F
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L035A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L035A:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$0B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmulax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L040A
+	cmp     #$0A
+	beq     L035B
+L040A:	ldy     #$24
+	lda     #$A0
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L035B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L035B:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$04
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmulax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L040B
+	cmp     #$0A
+	beq     L035C
+L040B:	ldy     #$24
+	lda     #$A1
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L035C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L035C:	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$22
+	lda     (sp),y
+	jsr     tosmula0
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L040C
+	cmp     #$0A
+	beq     L035D
+L040C:	ldy     #$24
+	lda     #$A2
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L035D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L035D:	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	jsr     pushwysp
+	ldy     #$1F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmulax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L040D
+	cmp     #$0A
+	beq     L035E
+L040D:	ldy     #$24
+	lda     #$A3
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L035E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L035E:	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$1B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmulax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L040E
+	cmp     #$0A
+	beq     L035F
+L040E:	ldy     #$24
+	lda     #$A4
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L035F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L035F:	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosmuleax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L040F
+	cmp     #$0A
+	beq     L0360
+L040F:	ldy     #$24
+	lda     #$A5
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0360
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0360:	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$0F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumulax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L0410
+	cmp     #$0A
+	beq     L0361
+L0410:	ldy     #$24
+	lda     #$A6
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0361
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0361:	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$0B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmulax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L0411
+	cmp     #$0A
+	beq     L0362
+L0411:	ldy     #$24
+	lda     #$A7
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0362
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0362:	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$04
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmulax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L0412
+	cmp     #$0A
+	beq     L0363
+L0412:	ldy     #$24
+	lda     #$A8
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0363
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0363:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$24
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosmul0ax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0A
+	jsr     tosneeax
+	beq     L0364
+	ldy     #$24
+	lda     #$A9
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0364
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0364:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$21
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     axlong
+	jsr     tosmuleax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0A
+	jsr     tosneeax
+	beq     L0365
+	ldy     #$24
+	lda     #$AA
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0365
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0365:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$1D
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     axlong
+	jsr     tosmuleax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0A
+	jsr     tosneeax
+	beq     L0366
+	ldy     #$24
+	lda     #$AB
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0366
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0366:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     tosmuleax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0A
+	jsr     tosneeax
+	beq     L0367
+	ldy     #$24
+	lda     #$AC
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0367
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0367:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$11
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmul0ax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0A
+	jsr     tosneeax
+	beq     L0368
+	ldy     #$24
+	lda     #$AD
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0368
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0368:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0D
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     axlong
+	jsr     tosmuleax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0A
+	jsr     tosneeax
+	beq     L0369
+	ldy     #$24
+	lda     #$AE
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0369
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0369:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$04
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     axlong
+	jsr     tosmuleax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0A
+	jsr     tosneeax
+	beq     L036A
+	ldy     #$24
+	lda     #$AF
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L036A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L036A:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$22
+	lda     (sp),y
+	jsr     tosumula0
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0413
+	cmp     #$0A
+	beq     L036B
+L0413:	ldy     #$24
+	lda     #$B0
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L036B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L036B:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$1F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumulax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0414
+	cmp     #$0A
+	beq     L036C
+L0414:	ldy     #$24
+	lda     #$B1
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L036C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L036C:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$1B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumulax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0415
+	cmp     #$0A
+	beq     L036D
+L0415:	ldy     #$24
+	lda     #$B2
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L036D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L036D:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosmuleax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0416
+	cmp     #$0A
+	beq     L036E
+L0416:	ldy     #$24
+	lda     #$B3
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L036E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L036E:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$0F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumulax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0417
+	cmp     #$0A
+	beq     L036F
+L0417:	ldy     #$24
+	lda     #$B4
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L036F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L036F:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$0B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumulax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0418
+	cmp     #$0A
+	beq     L0370
+L0418:	ldy     #$24
+	lda     #$B5
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0370
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0370:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$04
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumulax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0419
+	cmp     #$0A
+	beq     L0371
+L0419:	ldy     #$24
+	lda     #$B6
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0371
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0371:	ldy     #$0A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$22
+	lda     (sp),y
+	jsr     tosmula0
+	ldy     #$0A
+	jsr     staxysp
+	cpx     #$00
+	bne     L041A
+	cmp     #$0A
+	beq     L0372
+L041A:	ldy     #$24
+	lda     #$B7
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0372
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0372:	ldy     #$0A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$1F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmulax
+	ldy     #$0A
+	jsr     staxysp
+	cpx     #$00
+	bne     L041B
+	cmp     #$0A
+	beq     L0373
+L041B:	ldy     #$24
+	lda     #$B8
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0373
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0373:	ldy     #$0A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$1B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmulax
+	ldy     #$0A
+	jsr     staxysp
+	cpx     #$00
+	bne     L041C
+	cmp     #$0A
+	beq     L0374
+L041C:	ldy     #$24
+	lda     #$B9
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0374
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0374:	ldy     #$0A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosmuleax
+	ldy     #$0A
+	jsr     staxysp
+	cpx     #$00
+	bne     L041D
+	cmp     #$0A
+	beq     L0375
+L041D:	ldy     #$24
+	lda     #$BA
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0375
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0375:	ldy     #$0A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	jsr     pushwysp
+	ldy     #$0F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumulax
+	ldy     #$0A
+	jsr     staxysp
+	cpx     #$00
+	bne     L041E
+	cmp     #$0A
+	beq     L0376
+L041E:	ldy     #$24
+	lda     #$BB
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0376
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0376:	ldy     #$0A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmulax
+	ldy     #$0A
+	jsr     staxysp
+	cpx     #$00
+	bne     L041F
+	cmp     #$0A
+	beq     L0377
+L041F:	ldy     #$24
+	lda     #$BC
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0377
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0377:	ldy     #$0A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$04
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmulax
+	ldy     #$0A
+	jsr     staxysp
+	cpx     #$00
+	bne     L0420
+	cmp     #$0A
+	beq     L0378
+L0420:	ldy     #$24
+	lda     #$BD
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0378
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0378:	ldy     #$06
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$22
+	lda     (sp),y
+	jsr     tosmula0
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L0421
+	cmp     #$0A
+	beq     L0379
+L0421:	ldy     #$24
+	lda     #$BE
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0379
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0379:	ldy     #$06
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$1F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmulax
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L0422
+	cmp     #$0A
+	beq     L037A
+L0422:	ldy     #$24
+	lda     #$BF
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L037A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L037A:	ldy     #$06
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$1B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmulax
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L0423
+	cmp     #$0A
+	beq     L037B
+L0423:	ldy     #$24
+	lda     #$C0
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L037B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L037B:	ldy     #$06
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosmuleax
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L0424
+	cmp     #$0A
+	beq     L037C
+L0424:	ldy     #$24
+	lda     #$C1
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L037C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L037C:	ldy     #$06
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$0F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumulax
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L0425
+	cmp     #$0A
+	beq     L037D
+L0425:	ldy     #$24
+	lda     #$C2
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L037D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L037D:	ldy     #$06
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	jsr     pushwysp
+	ldy     #$0B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmulax
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L0426
+	cmp     #$0A
+	beq     L037E
+L0426:	ldy     #$24
+	lda     #$C3
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L037E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L037E:	ldy     #$06
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$04
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmulax
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L0427
+	cmp     #$0A
+	beq     L037F
+L0427:	ldy     #$24
+	lda     #$C4
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L037F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L037F:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	lda     #$02
+	dey
+	sta     (sp),y
+	iny
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$22
+	lda     (sp),y
+	jsr     tosudiva0
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$02
+	beq     L0380
+	ldy     #$24
+	lda     #$C5
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0380
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0380:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$1F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosdivax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$02
+	beq     L0381
+	ldy     #$24
+	lda     #$C6
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0381
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0381:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$1B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosdivax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$02
+	beq     L0382
+	ldy     #$24
+	lda     #$C7
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0382
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0382:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosdiveax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$02
+	beq     L0383
+	ldy     #$24
+	lda     #$C8
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0383
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0383:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$0F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosudivax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$02
+	beq     L0384
+	ldy     #$24
+	lda     #$C9
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0384
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0384:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$08
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$0B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosdivax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$02
+	beq     L0385
+	ldy     #$24
+	lda     #$CA
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0385
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0385:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$04
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosdivax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$02
+	beq     L0386
+	ldy     #$24
+	lda     #$CB
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0386
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0386:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	iny
+	sta     (sp),y
+	iny
+	jsr     pushwysp
+	ldy     #$22
+	lda     (sp),y
+	jsr     tosdiva0
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0428
+	cmp     #$02
+	beq     L0387
+L0428:	ldy     #$24
+	lda     #$CC
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0387
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0387:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$1F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosdivax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0429
+	cmp     #$02
+	beq     L0388
+L0429:	ldy     #$24
+	lda     #$CD
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0388
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0388:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$1B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosdivax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L042A
+	cmp     #$02
+	beq     L0389
+L042A:	ldy     #$24
+	lda     #$CE
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0389
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0389:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosdiveax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L042B
+	cmp     #$02
+	beq     L038A
+L042B:	ldy     #$24
+	lda     #$CF
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L038A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L038A:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$0F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosudivax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L042C
+	cmp     #$02
+	beq     L038B
+L042C:	ldy     #$24
+	lda     #$D0
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L038B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L038B:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$0B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosdivax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L042D
+	cmp     #$02
+	beq     L038C
+L042D:	ldy     #$24
+	lda     #$D1
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L038C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L038C:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$04
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosdivax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L042E
+	cmp     #$02
+	beq     L038D
+L042E:	ldy     #$24
+	lda     #$D2
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L038D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L038D:	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$22
+	lda     (sp),y
+	jsr     tosdiva0
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L042F
+	cmp     #$02
+	beq     L038E
+L042F:	ldy     #$24
+	lda     #$D3
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L038E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L038E:	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	jsr     pushwysp
+	ldy     #$1F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosdivax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L0430
+	cmp     #$02
+	beq     L038F
+L0430:	ldy     #$24
+	lda     #$D4
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L038F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L038F:	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$1B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosdivax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L0431
+	cmp     #$02
+	beq     L0390
+L0431:	ldy     #$24
+	lda     #$D5
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0390
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0390:	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosdiveax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L0432
+	cmp     #$02
+	beq     L0391
+L0432:	ldy     #$24
+	lda     #$D6
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0391
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0391:	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$0F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosudivax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L0433
+	cmp     #$02
+	beq     L0392
+L0433:	ldy     #$24
+	lda     #$D7
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0392
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0392:	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$0B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosdivax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L0434
+	cmp     #$02
+	beq     L0393
+L0434:	ldy     #$24
+	lda     #$D8
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0393
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0393:	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$04
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosdivax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L0435
+	cmp     #$02
+	beq     L0394
+L0435:	ldy     #$24
+	lda     #$D9
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0394
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0394:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$24
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosdiv0ax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	beq     L0395
+	ldy     #$24
+	lda     #$DA
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0395
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0395:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$21
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     axlong
+	jsr     tosdiveax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	beq     L0396
+	ldy     #$24
+	lda     #$DB
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0396
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0396:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$1D
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     axlong
+	jsr     tosdiveax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	beq     L0397
+	ldy     #$24
+	lda     #$DC
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0397
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0397:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	beq     L0398
+	ldy     #$24
+	lda     #$DD
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0398
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0398:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$11
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosdiv0ax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	beq     L0399
+	ldy     #$24
+	lda     #$DE
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0399
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0399:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0D
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     axlong
+	jsr     tosdiveax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	beq     L039A
+	ldy     #$24
+	lda     #$DF
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L039A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L039A:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$04
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     axlong
+	jsr     tosdiveax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	beq     L039B
+	ldy     #$24
+	lda     #$E0
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L039B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L039B:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$22
+	lda     (sp),y
+	jsr     tosudiva0
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0436
+	cmp     #$02
+	beq     L039C
+L0436:	ldy     #$24
+	lda     #$E1
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L039C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L039C:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$1F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosudivax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0437
+	cmp     #$02
+	beq     L039D
+L0437:	ldy     #$24
+	lda     #$E2
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L039D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L039D:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$1B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosudivax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0438
+	cmp     #$02
+	beq     L039E
+L0438:	ldy     #$24
+	lda     #$E3
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L039E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L039E:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosdiveax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0439
+	cmp     #$02
+	beq     L039F
+L0439:	ldy     #$24
+	lda     #$E4
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L039F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L039F:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$0F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosudivax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L043A
+	cmp     #$02
+	beq     L03A0
+L043A:	ldy     #$24
+	lda     #$E5
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03A0
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L03A0:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$0B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosudivax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L043B
+	cmp     #$02
+	beq     L03A1
+L043B:	ldy     #$24
+	lda     #$E6
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03A1
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L03A1:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$04
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosudivax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L043C
+	cmp     #$02
+	beq     L03A2
+L043C:	ldy     #$24
+	lda     #$E7
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03A2
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L03A2:	ldy     #$0A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$22
+	lda     (sp),y
+	jsr     tosdiva0
+	ldy     #$0A
+	jsr     staxysp
+	cpx     #$00
+	bne     L043D
+	cmp     #$02
+	beq     L03A3
+L043D:	ldy     #$24
+	lda     #$E8
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03A3
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L03A3:	ldy     #$0A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$1F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosdivax
+	ldy     #$0A
+	jsr     staxysp
+	cpx     #$00
+	bne     L043E
+	cmp     #$02
+	beq     L03A4
+L043E:	ldy     #$24
+	lda     #$E9
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03A4
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L03A4:	ldy     #$0A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$1B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosdivax
+	ldy     #$0A
+	jsr     staxysp
+	cpx     #$00
+	bne     L043F
+	cmp     #$02
+	beq     L03A5
+L043F:	ldy     #$24
+	lda     #$EA
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03A5
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L03A5:	ldy     #$0A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosdiveax
+	ldy     #$0A
+	jsr     staxysp
+	cpx     #$00
+	bne     L0440
+	cmp     #$02
+	beq     L03A6
+L0440:	ldy     #$24
+	lda     #$EB
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03A6
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L03A6:	ldy     #$0A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	jsr     pushwysp
+	ldy     #$0F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosudivax
+	ldy     #$0A
+	jsr     staxysp
+	cpx     #$00
+	bne     L0441
+	cmp     #$02
+	beq     L03A7
+L0441:	ldy     #$24
+	lda     #$EC
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03A7
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L03A7:	ldy     #$0A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosdivax
+	ldy     #$0A
+	jsr     staxysp
+	cpx     #$00
+	bne     L0442
+	cmp     #$02
+	beq     L03A8
+L0442:	ldy     #$24
+	lda     #$ED
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03A8
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L03A8:	ldy     #$0A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$04
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosdivax
+	ldy     #$0A
+	jsr     staxysp
+	cpx     #$00
+	bne     L0443
+	cmp     #$02
+	beq     L03A9
+L0443:	ldy     #$24
+	lda     #$EE
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03A9
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L03A9:	ldy     #$06
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$22
+	lda     (sp),y
+	jsr     tosdiva0
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L0444
+	cmp     #$02
+	beq     L03AA
+L0444:	ldy     #$24
+	lda     #$EF
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03AA
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L03AA:	ldy     #$06
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$1F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosdivax
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L0445
+	cmp     #$02
+	beq     L03AB
+L0445:	ldy     #$24
+	lda     #$F0
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03AB
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L03AB:	ldy     #$06
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$1B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosdivax
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L0446
+	cmp     #$02
+	beq     L03AC
+L0446:	ldy     #$24
+	lda     #$F1
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03AC
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L03AC:	ldy     #$06
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosdiveax
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L0447
+	cmp     #$02
+	beq     L03AD
+L0447:	ldy     #$24
+	lda     #$F2
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03AD
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L03AD:	ldy     #$06
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$0F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosudivax
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L0448
+	cmp     #$02
+	beq     L03AE
+L0448:	ldy     #$24
+	lda     #$F3
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03AE
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L03AE:	ldy     #$06
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	jsr     pushwysp
+	ldy     #$0B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosdivax
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L0449
+	cmp     #$02
+	beq     L03AF
+L0449:	ldy     #$24
+	lda     #$F4
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03AF
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L03AF:	ldy     #$06
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$04
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosdivax
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L044A
+	cmp     #$02
+	beq     L03B0
+L044A:	ldy     #$24
+	lda     #$F5
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03B0
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L03B0:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	lda     #$02
+	dey
+	sta     (sp),y
+	iny
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$22
+	lda     (sp),y
+	jsr     tosumoda0
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$01
+	beq     L03B1
+	ldy     #$24
+	lda     #$F6
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03B1
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L03B1:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$1F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmodax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$01
+	beq     L03B2
+	ldy     #$24
+	lda     #$F7
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03B2
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L03B2:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$1B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmodax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$01
+	beq     L03B3
+	ldy     #$24
+	lda     #$F8
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03B3
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L03B3:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosmodeax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$01
+	beq     L03B4
+	ldy     #$24
+	lda     #$F9
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03B4
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L03B4:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$0F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumodax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$01
+	beq     L03B5
+	ldy     #$24
+	lda     #$FA
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03B5
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L03B5:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	iny
+	sta     (sp),y
+	iny
+	jsr     pushwysp
+	ldy     #$22
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosmoda0
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L044B
+	cmp     #$01
+	beq     L03B6
+L044B:	ldy     #$24
+	lda     #$FB
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03B6
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L03B6:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$1F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmodax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L044C
+	cmp     #$01
+	beq     L03B7
+L044C:	ldy     #$24
+	lda     #$FC
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03B7
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L03B7:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$1B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmodax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L044D
+	cmp     #$01
+	beq     L03B8
+L044D:	ldy     #$24
+	lda     #$FD
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03B8
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L03B8:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosmodeax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L044E
+	cmp     #$01
+	beq     L03B9
+L044E:	ldy     #$24
+	lda     #$FE
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03B9
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L03B9:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$0F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumodax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L044F
+	cmp     #$01
+	beq     L02B7
+L044F:	ldy     #$24
+	lda     #$FF
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02B7
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L02B7:	ldy     #$24
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L02BA
+	ldy     #$22
+	lda     #$01
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$29
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$13
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     #$00
+	bne     L0450
+	cmp     #$00
+	beq     L02BA
+L0450:	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L02BA:	ldy     #$23
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$2A
+	jmp     addysp
+
+.segment	"DATA"
+
+M0001:
+	.byte	$4C,$6F,$63,$61,$6C,$20,$65,$72,$72,$6F,$72,$20,$25,$64,$2E,$0A
+	.byte	$00
+M0002:
+	.byte	$73,$37,$31,$34,$2C,$65,$72,$25,$64,$0A,$00
+M0003:
+	.byte	$73,$37,$31,$34,$20,$20,$20,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ section (int j, void *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_section: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$02
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	bne     L0003
+	ldy     #$01
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _s714
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	ldx     #$00
+	lda     #$01
+	sta     M0001+14
+	stx     M0001+14+1
+	sta     M0001+16
+	stx     M0001+16+1
+	sta     M0001+18
+	stx     M0001+18+1
+	sta     M0001+20
+	stx     M0001+20+1
+	lda     #>(M0001)
+	sta     M0002+1
+	lda     #<(M0001)
+	sta     M0002
+	ldy     #$00
+	txa
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L000D
+L0005:	jsr     pushw0sp
+	lda     M0002
+	ldx     M0002+1
+	jsr     _section
+	sta     M0001+22
+	stx     M0001+22+1
+	lda     M0001+24
+	clc
+	adc     M0001+22
+	sta     M0001+24
+	lda     M0001+24+1
+	adc     M0001+22+1
+	sta     M0001+24+1
+	lda     M0001+14
+	ora     M0001+14+1
+	beq     L0007
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     #<(M0001+26)
+	ldx     #>(M0001+26)
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+L0007:	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	ldy     #$01
+L000D:	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	bmi     L0005
+	lda     M0001+24
+	ora     M0001+24+1
+	bne     L0009
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jmp     L000F
+L0009:	lda     #<(S0006)
+	ldx     #>(S0006)
+L000F:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     M0001+24
+	ldx     M0001+24+1
+	jmp     incsp6
+
+.segment	"BSS"
+
+M0001:
+	.res	34,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
@@ -0,0 +1,9269 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_printf
+	.export		_lbits
+	.export		_ubits
+	.export		_fbits
+	.export		_dbits
+	.export		_flgs
+	.export		_flgm
+	.export		_flgd
+	.export		_flgl
+	.export		_rrc
+	.export		_crc
+	.export		_rfs
+	.export		_s714
+	.export		_section
+	.export		_main
+
+.segment	"RODATA"
+
+S0004:
+	.byte	$53,$65,$63,$74,$69,$6F,$6E,$20,$25,$73,$20,$72,$65,$74,$75,$72
+	.byte	$6E,$65,$64,$20,$25,$64,$2E,$0A,$00
+S0005:
+	.byte	$0A,$4E,$6F,$20,$65,$72,$72,$6F,$72,$73,$20,$64,$65,$74,$65,$63
+	.byte	$74,$65,$64,$2E,$0A,$00
+S0006:
+	.byte	$0A,$46,$61,$69,$6C,$65,$64,$2E,$0A,$00
+
+.segment	"BSS"
+
+_lbits:
+	.res	2,$00
+_ubits:
+	.res	2,$00
+_fbits:
+	.res	2,$00
+_dbits:
+	.res	2,$00
+_flgs:
+	.res	2,$00
+_flgm:
+	.res	2,$00
+_flgd:
+	.res	2,$00
+_flgl:
+	.res	2,$00
+_rrc:
+	.res	2,$00
+_crc:
+	.res	2,$00
+_rfs:
+	.res	8,$00
+
+; ---------------------------------------------------------------
+; int __near__ s714 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s714: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+3
+	jsr     pushax
+	ldy     #$24
+	jsr     subysp
+	lda     #<(M0003)
+	ldx     #>(M0003)
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$29
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$1A
+	bcc     L0002
+	inx
+L0002:	jsr     stax0sp
+	ldy     #$22
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	stz     regbank+2
+	stz     regbank+2+1
+	ldy     #$29
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$15
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	sta     regbank+4
+	stx     regbank+4+1
+L0003:	ldy     #$01
+	lda     (sp),y
+	sta     sreg+1
+	lda     (sp)
+	sta     sreg
+	ldy     #$03
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	lda     (ptr1)
+	sta     (sreg)
+	tax
+	php
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	bne     L0003
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	lda     #$02
+	dey
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$05
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$02
+	beq     L02BE
+	lda     #$02
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L02BE
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L02BE:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$02
+	beq     L02BF
+	lda     #$03
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L02BF
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L02BF:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     (sp),y
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$02
+	beq     L02C0
+	lda     #$04
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L02C0
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L02C0:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$02
+	beq     L02C1
+	lda     #$05
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L02C1
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L02C1:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$08
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$02
+	beq     L02C2
+	lda     #$06
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L02C2
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L02C2:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$04
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$02
+	beq     L02C3
+	lda     #$07
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L02C3
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L02C3:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	iny
+	sta     (sp),y
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$1E
+	jsr     staxysp
+	cmp     #$02
+	beq     L02C4
+	lda     #$08
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L02C4
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L02C4:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$1E
+	jsr     staxysp
+	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$1E
+	jsr     staxysp
+	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$11
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L03BB
+	cmp     #$02
+	beq     L02C7
+L03BB:	lda     #$0B
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L02C7
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L02C7:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$1E
+	jsr     staxysp
+	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$1E
+	jsr     staxysp
+	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$1E
+	jsr     staxysp
+	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$1A
+	jsr     staxysp
+	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	lda     #$02
+	iny
+	jsr     staxysp
+	ldy     #$1A
+	jsr     staxysp
+	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$1A
+	jsr     staxysp
+	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$11
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L03BC
+	cmp     #$02
+	beq     L02CE
+L03BC:	lda     #$12
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L02CE
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L02CE:	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$1A
+	jsr     staxysp
+	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$1A
+	jsr     staxysp
+	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$1A
+	jsr     staxysp
+	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	stz     sreg
+	stz     sreg+1
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	beq     L003F
+	ldx     #$00
+	lda     #$16
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L02D2
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L003F:	ldx     #$00
+L02D2:	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	jsr     axlong
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	beq     L0041
+	ldx     #$00
+	lda     #$17
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L02D3
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0041:	ldx     #$00
+L02D3:	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	jsr     axlong
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	beq     L02D4
+	lda     #$18
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L02D4
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L02D4:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jsr     ldeaxysp
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	beq     L0045
+	ldx     #$00
+	lda     #$19
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L02D5
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0045:	ldx     #$00
+L02D5:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$14
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	beq     L0047
+	ldx     #$00
+	lda     #$1A
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L02D6
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0047:	ldx     #$00
+L02D6:	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	jsr     axlong
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	beq     L0049
+	ldx     #$00
+	lda     #$1B
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L02D7
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0049:	ldx     #$00
+L02D7:	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	jsr     axlong
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	beq     L02D8
+	lda     #$1C
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L02D8
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L02D8:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$0E
+	jsr     staxysp
+	cmp     #$02
+	beq     L02D9
+	lda     #$1D
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L02D9
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L02D9:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$0E
+	jsr     staxysp
+	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$0E
+	jsr     staxysp
+	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	iny
+	lda     #$02
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$11
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L03BD
+	cmp     #$02
+	beq     L02DC
+L03BD:	lda     #$20
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L02DC
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L02DC:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$0E
+	jsr     staxysp
+	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$0E
+	jsr     staxysp
+	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$0E
+	jsr     staxysp
+	ldy     #$0A
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$0A
+	jsr     staxysp
+	ldy     #$0A
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$0A
+	jsr     staxysp
+	ldy     #$0A
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$0A
+	jsr     staxysp
+	ldy     #$0A
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$11
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$0A
+	jsr     staxysp
+	cpx     #$00
+	bne     L03BE
+	cmp     #$02
+	beq     L02E3
+L03BE:	lda     #$27
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L02E3
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L02E3:	ldy     #$0A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	iny
+	jsr     staxysp
+	ldy     #$0A
+	jsr     staxysp
+	ldy     #$0A
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$0A
+	jsr     staxysp
+	ldy     #$0A
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$0A
+	jsr     staxysp
+	ldy     #$06
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$06
+	jsr     staxysp
+	ldy     #$06
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$06
+	jsr     staxysp
+	ldy     #$06
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$06
+	jsr     staxysp
+	ldy     #$06
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$11
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L03BF
+	cmp     #$02
+	beq     L02EA
+L03BF:	lda     #$2E
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L02EA
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L02EA:	ldy     #$06
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$06
+	jsr     staxysp
+	ldy     #$06
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	lda     #$02
+	iny
+	jsr     staxysp
+	ldy     #$06
+	jsr     staxysp
+	ldy     #$06
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$06
+	jsr     staxysp
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	lda     #$02
+	dey
+	sta     (sp),y
+	iny
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$07
+	beq     L02EE
+	lda     #$32
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L02EE
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L02EE:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$21
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$07
+	beq     L02EF
+	lda     #$33
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L02EF
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L02EF:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$21
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$07
+	beq     L02F0
+	lda     #$34
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L02F0
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L02F0:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jsr     ldeaxysp
+	ldy     #$21
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$07
+	beq     L02F1
+	lda     #$35
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L02F1
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L02F1:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$21
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$07
+	beq     L02F2
+	lda     #$36
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L02F2
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L02F2:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$21
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$07
+	beq     L02F3
+	lda     #$37
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L02F3
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L02F3:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$21
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$07
+	beq     L02F4
+	lda     #$38
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L02F4
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L02F4:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	iny
+	sta     (sp),y
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$1E
+	jsr     addeqysp
+	ldy     #$1F
+	lda     (sp),y
+	bne     L03C0
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L0452
+L03C0:	lda     #$39
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L02F5
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L02F5:	ldy     #$1E
+L0452:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$1E
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$1F
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03C1
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L0453
+L03C1:	lda     #$3A
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L02F6
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L02F6:	ldy     #$1E
+L0453:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$1E
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$19
+	lda     (sp),y
+	ldy     #$1F
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03C2
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L0454
+L03C2:	lda     #$3B
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L02F7
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L02F7:	ldy     #$1E
+L0454:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jsr     ldeaxysp
+	ldy     #$1E
+	jsr     addeqysp
+	ldy     #$1F
+	lda     (sp),y
+	bne     L03C3
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L0455
+L03C3:	lda     #$3C
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L02F8
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L02F8:	ldy     #$1E
+L0455:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$1E
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$0D
+	lda     (sp),y
+	ldy     #$1F
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03C4
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L0456
+L03C4:	lda     #$3D
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L02F9
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L02F9:	ldy     #$1E
+L0456:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$1E
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	ldy     #$1F
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03C5
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L0457
+L03C5:	lda     #$3E
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L02FA
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L02FA:	ldy     #$1E
+L0457:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$04
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$1E
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$05
+	lda     (sp),y
+	ldy     #$1F
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03C6
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L02FB
+L03C6:	lda     #$3F
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L02FB
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L02FB:	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$1A
+	jsr     addeqysp
+	ldy     #$1B
+	lda     (sp),y
+	bne     L03C7
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L0458
+L03C7:	lda     #$40
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L02FC
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L02FC:	ldy     #$1A
+L0458:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$1A
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$1D
+	lda     (sp),y
+	ldy     #$1B
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03C8
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L0459
+L03C8:	lda     #$41
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L02FD
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L02FD:	ldy     #$1A
+L0459:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$1A
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$1B
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03C9
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L045A
+L03C9:	lda     #$42
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L02FE
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L02FE:	ldy     #$1A
+L045A:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jsr     ldeaxysp
+	ldy     #$1A
+	jsr     addeqysp
+	ldy     #$1B
+	lda     (sp),y
+	bne     L03CA
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L045B
+L03CA:	lda     #$43
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L02FF
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L02FF:	ldy     #$1A
+L045B:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$1A
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$0D
+	lda     (sp),y
+	ldy     #$1B
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03CB
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L045C
+L03CB:	lda     #$44
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0300
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0300:	ldy     #$1A
+L045C:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$1A
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	ldy     #$1B
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03CC
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L045D
+L03CC:	lda     #$45
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0301
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0301:	ldy     #$1A
+L045D:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	ldy     #$04
+	lda     #$02
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$1A
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$05
+	lda     (sp),y
+	ldy     #$1B
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03CD
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L0302
+L03CD:	lda     #$46
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0302
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L0302:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	stz     sreg
+	stz     sreg+1
+	ldy     #$14
+	jsr     laddeqysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$07
+	jsr     tosneeax
+	beq     L00C4
+	ldx     #$00
+	lda     #$47
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0303
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00C4:	ldx     #$00
+L0303:	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	jsr     axlong
+	ldy     #$14
+	jsr     laddeqysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$07
+	jsr     tosneeax
+	beq     L00C6
+	ldx     #$00
+	lda     #$48
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0304
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00C6:	ldx     #$00
+L0304:	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	jsr     axlong
+	ldy     #$14
+	jsr     laddeqysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$07
+	jsr     tosneeax
+	beq     L0305
+	lda     #$49
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0305
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0305:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jsr     ldeaxysp
+	ldy     #$14
+	jsr     laddeqysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$07
+	jsr     tosneeax
+	beq     L00CA
+	ldx     #$00
+	lda     #$4A
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0306
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00CA:	ldx     #$00
+L0306:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	stz     sreg
+	stz     sreg+1
+	ldy     #$14
+	jsr     laddeqysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$07
+	jsr     tosneeax
+	beq     L00CC
+	ldx     #$00
+	lda     #$4B
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0307
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00CC:	ldx     #$00
+L0307:	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	jsr     axlong
+	ldy     #$14
+	jsr     laddeqysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$07
+	jsr     tosneeax
+	beq     L00CE
+	ldx     #$00
+	lda     #$4C
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0308
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00CE:	ldx     #$00
+L0308:	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	jsr     axlong
+	ldy     #$14
+	jsr     laddeqysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$07
+	jsr     tosneeax
+	beq     L0309
+	lda     #$4D
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0309
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0309:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$0E
+	jsr     addeqysp
+	ldy     #$0F
+	lda     (sp),y
+	bne     L03CE
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L045E
+L03CE:	lda     #$4E
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L030A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L030A:	ldy     #$0E
+L045E:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$0E
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$1D
+	lda     (sp),y
+	ldy     #$0F
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03CF
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L045F
+L03CF:	lda     #$4F
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L030B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L030B:	ldy     #$0E
+L045F:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$0E
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$19
+	lda     (sp),y
+	ldy     #$0F
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03D0
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L0460
+L03D0:	lda     #$50
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L030C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L030C:	ldy     #$0E
+L0460:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jsr     ldeaxysp
+	ldy     #$0E
+	jsr     addeqysp
+	ldy     #$0F
+	lda     (sp),y
+	bne     L03D1
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L0461
+L03D1:	lda     #$51
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L030D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L030D:	ldy     #$0E
+L0461:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$0E
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$0F
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03D2
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L0462
+L03D2:	lda     #$52
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L030E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L030E:	ldy     #$0E
+L0462:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$0E
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	ldy     #$0F
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03D3
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L0463
+L03D3:	lda     #$53
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L030F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L030F:	ldy     #$0E
+L0463:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$04
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$0E
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$05
+	lda     (sp),y
+	ldy     #$0F
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03D4
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L0310
+L03D4:	lda     #$54
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0310
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0310:	ldy     #$0A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$0A
+	jsr     addeqysp
+	ldy     #$0B
+	lda     (sp),y
+	bne     L03D5
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L0464
+L03D5:	lda     #$55
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0311
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0311:	ldy     #$0A
+L0464:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$0A
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$1D
+	lda     (sp),y
+	ldy     #$0B
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03D6
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L0465
+L03D6:	lda     #$56
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0312
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0312:	ldy     #$0A
+L0465:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$0A
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$19
+	lda     (sp),y
+	ldy     #$0B
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03D7
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L0466
+L03D7:	lda     #$57
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0313
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0313:	ldy     #$0A
+L0466:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jsr     ldeaxysp
+	ldy     #$0A
+	jsr     addeqysp
+	ldy     #$0B
+	lda     (sp),y
+	bne     L03D8
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L0467
+L03D8:	lda     #$58
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0314
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0314:	ldy     #$0A
+L0467:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$0A
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$0D
+	lda     (sp),y
+	ldy     #$0B
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03D9
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L0468
+L03D9:	lda     #$59
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0315
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0315:	ldy     #$0A
+L0468:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$0A
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$0B
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03DA
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L0469
+L03DA:	lda     #$5A
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0316
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0316:	ldy     #$0A
+L0469:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$04
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$0A
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$05
+	lda     (sp),y
+	ldy     #$0B
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03DB
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L0317
+L03DB:	lda     #$5B
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0317
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0317:	ldy     #$06
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$06
+	jsr     addeqysp
+	ldy     #$07
+	lda     (sp),y
+	bne     L03DC
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L046A
+L03DC:	lda     #$5C
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0318
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0318:	ldy     #$06
+L046A:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$06
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$1D
+	lda     (sp),y
+	ldy     #$07
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03DD
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L046B
+L03DD:	lda     #$5D
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0319
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0319:	ldy     #$06
+L046B:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$06
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$19
+	lda     (sp),y
+	ldy     #$07
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03DE
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L046C
+L03DE:	lda     #$5E
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L031A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L031A:	ldy     #$06
+L046C:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jsr     ldeaxysp
+	ldy     #$06
+	jsr     addeqysp
+	ldy     #$07
+	lda     (sp),y
+	bne     L03DF
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L046D
+L03DF:	lda     #$5F
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L031B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L031B:	ldy     #$06
+L046D:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$06
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$0D
+	lda     (sp),y
+	ldy     #$07
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03E0
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L046E
+L03E0:	lda     #$60
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L031C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L031C:	ldy     #$06
+L046E:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$06
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	ldy     #$07
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03E1
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L046F
+L03E1:	lda     #$61
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L031D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L031D:	ldy     #$06
+L046F:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$04
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$06
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	ldy     #$07
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	bne     L03E2
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L031E
+L03E2:	lda     #$62
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L031E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L031E:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	lda     #$02
+	dey
+	sta     (sp),y
+	iny
+	lda     #$FD
+	sec
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$03
+	beq     L031F
+	lda     #$63
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L031F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L031F:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$21
+	lda     #$FD
+	sec
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$03
+	beq     L0320
+	lda     #$64
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0320
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0320:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$21
+	lda     #$FD
+	sec
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$03
+	beq     L0321
+	lda     #$65
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0321
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0321:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jsr     ldeaxysp
+	ldy     #$21
+	eor     #$FF
+	sec
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$03
+	beq     L0322
+	lda     #$66
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0322
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0322:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$21
+	lda     #$FD
+	sec
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$03
+	beq     L0323
+	lda     #$67
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0323
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0323:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$21
+	lda     #$FD
+	sec
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$03
+	beq     L0324
+	lda     #$68
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0324
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0324:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$21
+	lda     #$FD
+	sec
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$03
+	beq     L0325
+	lda     #$69
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0325
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0325:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	iny
+	sta     (sp),y
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$1E
+	jsr     subeqysp
+	ldy     #$1F
+	lda     (sp),y
+	bne     L03E3
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0470
+L03E3:	lda     #$6A
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0326
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0326:	ldy     #$1E
+L0470:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$1E
+	jsr     subeqysp
+	ldy     #$1F
+	lda     (sp),y
+	bne     L03E4
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0471
+L03E4:	lda     #$6B
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0327
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0327:	ldy     #$1E
+L0471:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$1E
+	jsr     subeqysp
+	ldy     #$1F
+	lda     (sp),y
+	bne     L03E5
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0472
+L03E5:	lda     #$6C
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0328
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0328:	ldy     #$1E
+L0472:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jsr     ldeaxysp
+	ldy     #$1E
+	jsr     subeqysp
+	ldy     #$1F
+	lda     (sp),y
+	bne     L03E6
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0473
+L03E6:	lda     #$6D
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0329
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0329:	ldy     #$1E
+L0473:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$1E
+	jsr     subeqysp
+	ldy     #$1F
+	lda     (sp),y
+	bne     L03E7
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0474
+L03E7:	lda     #$6E
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L032A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L032A:	ldy     #$1E
+L0474:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$1E
+	jsr     subeqysp
+	ldy     #$1F
+	lda     (sp),y
+	bne     L03E8
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0475
+L03E8:	lda     #$6F
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L032B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L032B:	ldy     #$1E
+L0475:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$1E
+	jsr     subeqysp
+	ldy     #$1F
+	lda     (sp),y
+	bne     L03E9
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L032C
+L03E9:	lda     #$70
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L032C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L032C:	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$1A
+	jsr     subeqysp
+	ldy     #$1B
+	lda     (sp),y
+	bne     L03EA
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0476
+L03EA:	lda     #$71
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L032D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L032D:	ldy     #$1A
+L0476:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	iny
+	jsr     staxysp
+	ldy     #$1A
+	jsr     subeqysp
+	ldy     #$1B
+	lda     (sp),y
+	bne     L03EB
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0477
+L03EB:	lda     #$72
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L032E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L032E:	ldy     #$1A
+L0477:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$1A
+	jsr     subeqysp
+	ldy     #$1B
+	lda     (sp),y
+	bne     L03EC
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0478
+L03EC:	lda     #$73
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L032F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L032F:	ldy     #$1A
+L0478:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jsr     ldeaxysp
+	ldy     #$1A
+	jsr     subeqysp
+	ldy     #$1B
+	lda     (sp),y
+	bne     L03ED
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0479
+L03ED:	lda     #$74
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0330
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0330:	ldy     #$1A
+L0479:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$1A
+	jsr     subeqysp
+	ldy     #$1B
+	lda     (sp),y
+	bne     L03EE
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L047A
+L03EE:	lda     #$75
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0331
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0331:	ldy     #$1A
+L047A:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$1A
+	jsr     subeqysp
+	ldy     #$1B
+	lda     (sp),y
+	bne     L03EF
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L047B
+L03EF:	lda     #$76
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0332
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0332:	ldy     #$1A
+L047B:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$1A
+	jsr     subeqysp
+	ldy     #$1B
+	lda     (sp),y
+	bne     L03F0
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0147
+L03F0:	ldx     #$00
+	lda     #$77
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0333
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0147:	ldx     #$00
+L0333:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	stz     sreg
+	stz     sreg+1
+	ldy     #$14
+	jsr     lsubeqysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$03
+	jsr     tosneeax
+	beq     L0149
+	ldx     #$00
+	lda     #$78
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0334
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0149:	ldx     #$00
+L0334:	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	jsr     axlong
+	ldy     #$14
+	jsr     lsubeqysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$03
+	jsr     tosneeax
+	beq     L014B
+	ldx     #$00
+	lda     #$79
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0335
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L014B:	ldx     #$00
+L0335:	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	jsr     axlong
+	ldy     #$14
+	jsr     lsubeqysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$03
+	jsr     tosneeax
+	beq     L0336
+	lda     #$7A
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0336
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0336:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jsr     ldeaxysp
+	ldy     #$14
+	jsr     lsubeqysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$03
+	jsr     tosneeax
+	beq     L014F
+	ldx     #$00
+	lda     #$7B
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0337
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L014F:	ldx     #$00
+L0337:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	stz     sreg
+	stz     sreg+1
+	ldy     #$14
+	jsr     lsubeqysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$03
+	jsr     tosneeax
+	beq     L0151
+	ldx     #$00
+	lda     #$7C
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0338
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0151:	ldx     #$00
+L0338:	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	jsr     axlong
+	ldy     #$14
+	jsr     lsubeqysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$03
+	jsr     tosneeax
+	beq     L0153
+	ldx     #$00
+	lda     #$7D
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0339
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0153:	ldx     #$00
+L0339:	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	jsr     axlong
+	ldy     #$14
+	jsr     lsubeqysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$03
+	jsr     tosneeax
+	beq     L033A
+	lda     #$7E
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L033A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L033A:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$0E
+	jsr     subeqysp
+	ldy     #$0F
+	lda     (sp),y
+	bne     L03F1
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L047C
+L03F1:	lda     #$7F
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L033B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L033B:	ldy     #$0E
+L047C:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$0E
+	jsr     subeqysp
+	ldy     #$0F
+	lda     (sp),y
+	bne     L03F2
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L047D
+L03F2:	lda     #$80
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L033C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L033C:	ldy     #$0E
+L047D:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$0E
+	jsr     subeqysp
+	ldy     #$0F
+	lda     (sp),y
+	bne     L03F3
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L047E
+L03F3:	lda     #$81
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L033D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L033D:	ldy     #$0E
+L047E:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jsr     ldeaxysp
+	ldy     #$0E
+	jsr     subeqysp
+	ldy     #$0F
+	lda     (sp),y
+	bne     L03F4
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L047F
+L03F4:	lda     #$82
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L033E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L033E:	ldy     #$0E
+L047F:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$0E
+	jsr     subeqysp
+	ldy     #$0F
+	lda     (sp),y
+	bne     L03F5
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0480
+L03F5:	lda     #$83
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L033F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L033F:	ldy     #$0E
+L0480:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$0E
+	jsr     subeqysp
+	ldy     #$0F
+	lda     (sp),y
+	bne     L03F6
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0481
+L03F6:	lda     #$84
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0340
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0340:	ldy     #$0E
+L0481:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$0E
+	jsr     subeqysp
+	ldy     #$0F
+	lda     (sp),y
+	bne     L03F7
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0341
+L03F7:	lda     #$85
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0341
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0341:	ldy     #$0A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$0A
+	jsr     subeqysp
+	ldy     #$0B
+	lda     (sp),y
+	bne     L03F8
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0482
+L03F8:	lda     #$86
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0342
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0342:	ldy     #$0A
+L0482:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$0A
+	jsr     subeqysp
+	ldy     #$0B
+	lda     (sp),y
+	bne     L03F9
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0483
+L03F9:	lda     #$87
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0343
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0343:	ldy     #$0A
+L0483:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$0A
+	jsr     subeqysp
+	ldy     #$0B
+	lda     (sp),y
+	bne     L03FA
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0484
+L03FA:	lda     #$88
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0344
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0344:	ldy     #$0A
+L0484:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jsr     ldeaxysp
+	ldy     #$0A
+	jsr     subeqysp
+	ldy     #$0B
+	lda     (sp),y
+	bne     L03FB
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0485
+L03FB:	lda     #$89
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0345
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0345:	ldy     #$0A
+L0485:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	iny
+	jsr     staxysp
+	ldy     #$0A
+	jsr     subeqysp
+	ldy     #$0B
+	lda     (sp),y
+	bne     L03FC
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0486
+L03FC:	lda     #$8A
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0346
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0346:	ldy     #$0A
+L0486:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$0A
+	jsr     subeqysp
+	ldy     #$0B
+	lda     (sp),y
+	bne     L03FD
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0487
+L03FD:	lda     #$8B
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0347
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0347:	ldy     #$0A
+L0487:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$0A
+	jsr     subeqysp
+	ldy     #$0B
+	lda     (sp),y
+	bne     L03FE
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0348
+L03FE:	lda     #$8C
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0348
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0348:	ldy     #$06
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$06
+	jsr     subeqysp
+	ldy     #$07
+	lda     (sp),y
+	bne     L03FF
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0488
+L03FF:	lda     #$8D
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0349
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0349:	ldy     #$06
+L0488:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$06
+	jsr     subeqysp
+	ldy     #$07
+	lda     (sp),y
+	bne     L0400
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0489
+L0400:	lda     #$8E
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L034A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L034A:	ldy     #$06
+L0489:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$06
+	jsr     subeqysp
+	ldy     #$07
+	lda     (sp),y
+	bne     L0401
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L048A
+L0401:	lda     #$8F
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L034B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L034B:	ldy     #$06
+L048A:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jsr     ldeaxysp
+	ldy     #$06
+	jsr     subeqysp
+	ldy     #$07
+	lda     (sp),y
+	bne     L0402
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L048B
+L0402:	lda     #$90
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L034C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L034C:	ldy     #$06
+L048B:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$06
+	jsr     subeqysp
+	ldy     #$07
+	lda     (sp),y
+	bne     L0403
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L048C
+L0403:	lda     #$91
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L034D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L034D:	ldy     #$06
+L048C:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	iny
+	jsr     staxysp
+	ldy     #$06
+	jsr     subeqysp
+	ldy     #$07
+	lda     (sp),y
+	bne     L0404
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L048D
+L0404:	lda     #$92
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L034E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L034E:	ldy     #$06
+L048D:	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tax
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$06
+	jsr     subeqysp
+	ldy     #$07
+	lda     (sp),y
+	bne     L0405
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L034F
+L0405:	lda     #$93
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L034F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L034F:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	lda     #$02
+	dey
+	sta     (sp),y
+	iny
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$22
+	lda     (sp),y
+	jsr     tosumula0
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$0A
+	beq     L0350
+	lda     #$94
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0350
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0350:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$1F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmulax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$0A
+	beq     L0351
+	lda     #$95
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0351
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0351:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$1B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmulax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$0A
+	beq     L0352
+	lda     #$96
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0352
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0352:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosmuleax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$0A
+	beq     L0353
+	lda     #$97
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0353
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0353:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$0F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumulax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$0A
+	beq     L0354
+	lda     #$98
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0354
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0354:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$08
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$0B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmulax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$0A
+	beq     L0355
+	lda     #$99
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0355
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0355:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$04
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmulax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$0A
+	beq     L0356
+	lda     #$9A
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0356
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0356:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	iny
+	sta     (sp),y
+	iny
+	jsr     pushwysp
+	ldy     #$22
+	lda     (sp),y
+	jsr     tosmula0
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0406
+	cmp     #$0A
+	beq     L0357
+L0406:	lda     #$9B
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0357
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0357:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$1F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmulax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0407
+	cmp     #$0A
+	beq     L0358
+L0407:	lda     #$9C
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0358
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0358:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$1B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmulax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0408
+	cmp     #$0A
+	beq     L0359
+L0408:	lda     #$9D
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0359
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0359:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosmuleax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0409
+	cmp     #$0A
+	beq     L035A
+L0409:	lda     #$9E
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L035A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L035A:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$0F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumulax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L040A
+	cmp     #$0A
+	beq     L035B
+L040A:	lda     #$9F
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L035B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L035B:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$0B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmulax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L040B
+	cmp     #$0A
+	beq     L035C
+L040B:	lda     #$A0
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L035C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L035C:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$04
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmulax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L040C
+	cmp     #$0A
+	beq     L035D
+L040C:	lda     #$A1
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L035D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L035D:	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$22
+	lda     (sp),y
+	jsr     tosmula0
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L040D
+	cmp     #$0A
+	beq     L035E
+L040D:	lda     #$A2
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L035E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L035E:	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	jsr     pushwysp
+	ldy     #$1F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmulax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L040E
+	cmp     #$0A
+	beq     L035F
+L040E:	lda     #$A3
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L035F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L035F:	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$1B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmulax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L040F
+	cmp     #$0A
+	beq     L0360
+L040F:	lda     #$A4
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0360
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0360:	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosmuleax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L0410
+	cmp     #$0A
+	beq     L0361
+L0410:	lda     #$A5
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0361
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0361:	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$0F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumulax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L0411
+	cmp     #$0A
+	beq     L0362
+L0411:	lda     #$A6
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0362
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0362:	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$0B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmulax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L0412
+	cmp     #$0A
+	beq     L0363
+L0412:	lda     #$A7
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0363
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0363:	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$04
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmulax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L0413
+	cmp     #$0A
+	beq     L0364
+L0413:	lda     #$A8
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0364
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0364:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$24
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosmul0ax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$0A
+	jsr     tosneeax
+	beq     L0365
+	lda     #$A9
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0365
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0365:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$21
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     axlong
+	jsr     tosmuleax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$0A
+	jsr     tosneeax
+	beq     L0366
+	lda     #$AA
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0366
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0366:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$1D
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     axlong
+	jsr     tosmuleax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$0A
+	jsr     tosneeax
+	beq     L0367
+	lda     #$AB
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0367
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0367:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     tosmuleax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$0A
+	jsr     tosneeax
+	beq     L0368
+	lda     #$AC
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0368
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0368:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$11
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmul0ax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$0A
+	jsr     tosneeax
+	beq     L0369
+	lda     #$AD
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0369
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0369:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0D
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     axlong
+	jsr     tosmuleax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$0A
+	jsr     tosneeax
+	beq     L036A
+	lda     #$AE
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L036A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L036A:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$04
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     axlong
+	jsr     tosmuleax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$0A
+	jsr     tosneeax
+	beq     L036B
+	lda     #$AF
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L036B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L036B:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$22
+	lda     (sp),y
+	jsr     tosumula0
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0414
+	cmp     #$0A
+	beq     L036C
+L0414:	lda     #$B0
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L036C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L036C:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$1F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumulax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0415
+	cmp     #$0A
+	beq     L036D
+L0415:	lda     #$B1
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L036D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L036D:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$1B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumulax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0416
+	cmp     #$0A
+	beq     L036E
+L0416:	lda     #$B2
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L036E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L036E:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosmuleax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0417
+	cmp     #$0A
+	beq     L036F
+L0417:	lda     #$B3
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L036F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L036F:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$0F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumulax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0418
+	cmp     #$0A
+	beq     L0370
+L0418:	lda     #$B4
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0370
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0370:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$0B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumulax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0419
+	cmp     #$0A
+	beq     L0371
+L0419:	lda     #$B5
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0371
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0371:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$04
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumulax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L041A
+	cmp     #$0A
+	beq     L0372
+L041A:	lda     #$B6
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0372
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0372:	ldy     #$0A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$22
+	lda     (sp),y
+	jsr     tosmula0
+	ldy     #$0A
+	jsr     staxysp
+	cpx     #$00
+	bne     L041B
+	cmp     #$0A
+	beq     L0373
+L041B:	lda     #$B7
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0373
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0373:	ldy     #$0A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$1F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmulax
+	ldy     #$0A
+	jsr     staxysp
+	cpx     #$00
+	bne     L041C
+	cmp     #$0A
+	beq     L0374
+L041C:	lda     #$B8
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0374
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0374:	ldy     #$0A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$1B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmulax
+	ldy     #$0A
+	jsr     staxysp
+	cpx     #$00
+	bne     L041D
+	cmp     #$0A
+	beq     L0375
+L041D:	lda     #$B9
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0375
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0375:	ldy     #$0A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosmuleax
+	ldy     #$0A
+	jsr     staxysp
+	cpx     #$00
+	bne     L041E
+	cmp     #$0A
+	beq     L0376
+L041E:	lda     #$BA
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0376
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0376:	ldy     #$0A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	jsr     pushwysp
+	ldy     #$0F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumulax
+	ldy     #$0A
+	jsr     staxysp
+	cpx     #$00
+	bne     L041F
+	cmp     #$0A
+	beq     L0377
+L041F:	lda     #$BB
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0377
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0377:	ldy     #$0A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmulax
+	ldy     #$0A
+	jsr     staxysp
+	cpx     #$00
+	bne     L0420
+	cmp     #$0A
+	beq     L0378
+L0420:	lda     #$BC
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0378
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0378:	ldy     #$0A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$04
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmulax
+	ldy     #$0A
+	jsr     staxysp
+	cpx     #$00
+	bne     L0421
+	cmp     #$0A
+	beq     L0379
+L0421:	lda     #$BD
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0379
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0379:	ldy     #$06
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$22
+	lda     (sp),y
+	jsr     tosmula0
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L0422
+	cmp     #$0A
+	beq     L037A
+L0422:	lda     #$BE
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L037A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L037A:	ldy     #$06
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$1F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmulax
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L0423
+	cmp     #$0A
+	beq     L037B
+L0423:	lda     #$BF
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L037B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L037B:	ldy     #$06
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$1B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmulax
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L0424
+	cmp     #$0A
+	beq     L037C
+L0424:	lda     #$C0
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L037C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L037C:	ldy     #$06
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosmuleax
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L0425
+	cmp     #$0A
+	beq     L037D
+L0425:	lda     #$C1
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L037D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L037D:	ldy     #$06
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$0F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumulax
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L0426
+	cmp     #$0A
+	beq     L037E
+L0426:	lda     #$C2
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L037E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L037E:	ldy     #$06
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	jsr     pushwysp
+	ldy     #$0B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmulax
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L0427
+	cmp     #$0A
+	beq     L037F
+L0427:	lda     #$C3
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L037F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L037F:	ldy     #$06
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$04
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmulax
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L0428
+	cmp     #$0A
+	beq     L0380
+L0428:	lda     #$C4
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0380
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0380:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	lda     #$02
+	dey
+	sta     (sp),y
+	iny
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$22
+	lda     (sp),y
+	jsr     tosudiva0
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$02
+	beq     L0381
+	lda     #$C5
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0381
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0381:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$1F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosdivax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$02
+	beq     L0382
+	lda     #$C6
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0382
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0382:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$1B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosdivax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$02
+	beq     L0383
+	lda     #$C7
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0383
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0383:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosdiveax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$02
+	beq     L0384
+	lda     #$C8
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0384
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0384:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$0F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosudivax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$02
+	beq     L0385
+	lda     #$C9
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0385
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0385:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$08
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$0B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosdivax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$02
+	beq     L0386
+	lda     #$CA
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0386
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0386:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$04
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosdivax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$02
+	beq     L0387
+	lda     #$CB
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0387
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0387:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	iny
+	sta     (sp),y
+	iny
+	jsr     pushwysp
+	ldy     #$22
+	lda     (sp),y
+	jsr     tosdiva0
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0429
+	cmp     #$02
+	beq     L0388
+L0429:	lda     #$CC
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0388
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0388:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$1F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosdivax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L042A
+	cmp     #$02
+	beq     L0389
+L042A:	lda     #$CD
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0389
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0389:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$1B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosdivax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L042B
+	cmp     #$02
+	beq     L038A
+L042B:	lda     #$CE
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L038A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L038A:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosdiveax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L042C
+	cmp     #$02
+	beq     L038B
+L042C:	lda     #$CF
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L038B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L038B:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$0F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosudivax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L042D
+	cmp     #$02
+	beq     L038C
+L042D:	lda     #$D0
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L038C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L038C:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$0B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosdivax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L042E
+	cmp     #$02
+	beq     L038D
+L042E:	lda     #$D1
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L038D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L038D:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$04
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosdivax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L042F
+	cmp     #$02
+	beq     L038E
+L042F:	lda     #$D2
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L038E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L038E:	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$22
+	lda     (sp),y
+	jsr     tosdiva0
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L0430
+	cmp     #$02
+	beq     L038F
+L0430:	lda     #$D3
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L038F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L038F:	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	jsr     pushwysp
+	ldy     #$1F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosdivax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L0431
+	cmp     #$02
+	beq     L0390
+L0431:	lda     #$D4
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0390
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0390:	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$1B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosdivax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L0432
+	cmp     #$02
+	beq     L0391
+L0432:	lda     #$D5
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0391
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0391:	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosdiveax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L0433
+	cmp     #$02
+	beq     L0392
+L0433:	lda     #$D6
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0392
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0392:	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$0F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosudivax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L0434
+	cmp     #$02
+	beq     L0393
+L0434:	lda     #$D7
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0393
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0393:	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$0B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosdivax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L0435
+	cmp     #$02
+	beq     L0394
+L0435:	lda     #$D8
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0394
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0394:	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$04
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosdivax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L0436
+	cmp     #$02
+	beq     L0395
+L0436:	lda     #$D9
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0395
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0395:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$24
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosdiv0ax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	beq     L0396
+	lda     #$DA
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0396
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0396:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$21
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     axlong
+	jsr     tosdiveax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	beq     L0397
+	lda     #$DB
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0397
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0397:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$1D
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     axlong
+	jsr     tosdiveax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	beq     L0398
+	lda     #$DC
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0398
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0398:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	beq     L0399
+	lda     #$DD
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0399
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0399:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$11
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosdiv0ax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	beq     L039A
+	lda     #$DE
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L039A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L039A:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0D
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     axlong
+	jsr     tosdiveax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	beq     L039B
+	lda     #$DF
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L039B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L039B:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$04
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     axlong
+	jsr     tosdiveax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	beq     L039C
+	lda     #$E0
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L039C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L039C:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$22
+	lda     (sp),y
+	jsr     tosudiva0
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0437
+	cmp     #$02
+	beq     L039D
+L0437:	lda     #$E1
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L039D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L039D:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$1F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosudivax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0438
+	cmp     #$02
+	beq     L039E
+L0438:	lda     #$E2
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L039E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L039E:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$1B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosudivax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0439
+	cmp     #$02
+	beq     L039F
+L0439:	lda     #$E3
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L039F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L039F:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosdiveax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L043A
+	cmp     #$02
+	beq     L03A0
+L043A:	lda     #$E4
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L03A0
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L03A0:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$0F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosudivax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L043B
+	cmp     #$02
+	beq     L03A1
+L043B:	lda     #$E5
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L03A1
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L03A1:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$0B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosudivax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L043C
+	cmp     #$02
+	beq     L03A2
+L043C:	lda     #$E6
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L03A2
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L03A2:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$04
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosudivax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L043D
+	cmp     #$02
+	beq     L03A3
+L043D:	lda     #$E7
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L03A3
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L03A3:	ldy     #$0A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$22
+	lda     (sp),y
+	jsr     tosdiva0
+	ldy     #$0A
+	jsr     staxysp
+	cpx     #$00
+	bne     L043E
+	cmp     #$02
+	beq     L03A4
+L043E:	lda     #$E8
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L03A4
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L03A4:	ldy     #$0A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$1F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosdivax
+	ldy     #$0A
+	jsr     staxysp
+	cpx     #$00
+	bne     L043F
+	cmp     #$02
+	beq     L03A5
+L043F:	lda     #$E9
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L03A5
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L03A5:	ldy     #$0A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$1B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosdivax
+	ldy     #$0A
+	jsr     staxysp
+	cpx     #$00
+	bne     L0440
+	cmp     #$02
+	beq     L03A6
+L0440:	lda     #$EA
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L03A6
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L03A6:	ldy     #$0A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosdiveax
+	ldy     #$0A
+	jsr     staxysp
+	cpx     #$00
+	bne     L0441
+	cmp     #$02
+	beq     L03A7
+L0441:	lda     #$EB
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L03A7
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L03A7:	ldy     #$0A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	jsr     pushwysp
+	ldy     #$0F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosudivax
+	ldy     #$0A
+	jsr     staxysp
+	cpx     #$00
+	bne     L0442
+	cmp     #$02
+	beq     L03A8
+L0442:	lda     #$EC
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L03A8
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L03A8:	ldy     #$0A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosdivax
+	ldy     #$0A
+	jsr     staxysp
+	cpx     #$00
+	bne     L0443
+	cmp     #$02
+	beq     L03A9
+L0443:	lda     #$ED
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L03A9
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L03A9:	ldy     #$0A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$04
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosdivax
+	ldy     #$0A
+	jsr     staxysp
+	cpx     #$00
+	bne     L0444
+	cmp     #$02
+	beq     L03AA
+L0444:	lda     #$EE
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L03AA
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L03AA:	ldy     #$06
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$22
+	lda     (sp),y
+	jsr     tosdiva0
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L0445
+	cmp     #$02
+	beq     L03AB
+L0445:	lda     #$EF
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L03AB
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L03AB:	ldy     #$06
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$1F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosdivax
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L0446
+	cmp     #$02
+	beq     L03AC
+L0446:	lda     #$F0
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L03AC
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L03AC:	ldy     #$06
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$1B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosdivax
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L0447
+	cmp     #$02
+	beq     L03AD
+L0447:	lda     #$F1
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L03AD
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L03AD:	ldy     #$06
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosdiveax
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L0448
+	cmp     #$02
+	beq     L03AE
+L0448:	lda     #$F2
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L03AE
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L03AE:	ldy     #$06
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$0F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosudivax
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L0449
+	cmp     #$02
+	beq     L03AF
+L0449:	lda     #$F3
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L03AF
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L03AF:	ldy     #$06
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	jsr     pushwysp
+	ldy     #$0B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosdivax
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L044A
+	cmp     #$02
+	beq     L03B0
+L044A:	lda     #$F4
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L03B0
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L03B0:	ldy     #$06
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$04
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosdivax
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L044B
+	cmp     #$02
+	beq     L03B1
+L044B:	lda     #$F5
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L03B1
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L03B1:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	lda     #$02
+	dey
+	sta     (sp),y
+	iny
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$22
+	lda     (sp),y
+	jsr     tosumoda0
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$01
+	beq     L03B2
+	lda     #$F6
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L03B2
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L03B2:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$1F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmodax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$01
+	beq     L03B3
+	lda     #$F7
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L03B3
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L03B3:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$1B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmodax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$01
+	beq     L03B4
+	lda     #$F8
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L03B4
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L03B4:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosmodeax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$01
+	beq     L03B5
+	lda     #$F9
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L03B5
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L03B5:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$0F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumodax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$01
+	beq     L03B6
+	lda     #$FA
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L03B6
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L03B6:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	iny
+	sta     (sp),y
+	iny
+	jsr     pushwysp
+	ldy     #$22
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosmoda0
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L044C
+	cmp     #$01
+	beq     L03B7
+L044C:	lda     #$FB
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L03B7
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L03B7:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$1F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmodax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L044D
+	cmp     #$01
+	beq     L03B8
+L044D:	lda     #$FC
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L03B8
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L03B8:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$1B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmodax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L044E
+	cmp     #$01
+	beq     L03B9
+L044E:	lda     #$FD
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L03B9
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L03B9:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosmodeax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L044F
+	cmp     #$01
+	beq     L03BA
+L044F:	lda     #$FE
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L03BA
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L03BA:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$0F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumodax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0450
+	cmp     #$01
+	beq     L02B7
+L0450:	lda     #$FF
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L02B7
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L02B7:	lda     regbank+2
+	ora     regbank+2+1
+	beq     L02BA
+	ldy     #$22
+	lda     #$01
+	sta     (sp),y
+	dea
+	iny
+	sta     (sp),y
+	ldy     #$29
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$13
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     #$00
+	bne     L0451
+	cmp     #$00
+	beq     L02BA
+L0451:	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L02BA:	ldy     #$23
+	lda     (sp),y
+	sta     tmp1
+	dey
+	lda     (sp),y
+	pha
+	ldy     #$27
+	ldx     #$03
+L02BC:	lda     (sp),y
+	sta     regbank+2,x
+	dey
+	dex
+	bpl     L02BC
+	ldx     tmp1
+	pla
+	ldy     #$2A
+	jmp     addysp
+
+.segment	"DATA"
+
+M0001:
+	.byte	$4C,$6F,$63,$61,$6C,$20,$65,$72,$72,$6F,$72,$20,$25,$64,$2E,$0A
+	.byte	$00
+M0002:
+	.byte	$73,$37,$31,$34,$2C,$65,$72,$25,$64,$0A,$00
+M0003:
+	.byte	$73,$37,$31,$34,$20,$20,$20,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ section (int j, void *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_section: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$02
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	bne     L0003
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _s714
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	lda     #$01
+	sta     M0001+14
+	stz     M0001+14+1
+	sta     M0001+16
+	stz     M0001+16+1
+	sta     M0001+18
+	stz     M0001+18+1
+	sta     M0001+20
+	stz     M0001+20+1
+	lda     #>(M0001)
+	sta     M0002+1
+	lda     #<(M0001)
+	sta     M0002
+	lda     #$00
+	sta     (sp)
+	ldy     #$01
+	sta     (sp),y
+	bra     L000D
+L0005:	jsr     pushw0sp
+	lda     M0002
+	ldx     M0002+1
+	jsr     _section
+	sta     M0001+22
+	stx     M0001+22+1
+	lda     M0001+24
+	clc
+	adc     M0001+22
+	sta     M0001+24
+	lda     M0001+24+1
+	adc     M0001+22+1
+	sta     M0001+24+1
+	lda     M0001+14
+	ora     M0001+14+1
+	beq     L0007
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     #<(M0001+26)
+	ldx     #>(M0001+26)
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+L0007:	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	ldy     #$01
+L000D:	lda     (sp),y
+	tax
+	lda     (sp)
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	bmi     L0005
+	lda     M0001+24
+	ora     M0001+24+1
+	bne     L0009
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	bra     L000F
+L0009:	lda     #<(S0006)
+	ldx     #>(S0006)
+L000F:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     M0001+24
+	ldx     M0001+24+1
+	jmp     incsp6
+
+.segment	"BSS"
+
+M0001:
+	.res	34,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
@@ -0,0 +1,8145 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_printf
+	.export		_lbits
+	.export		_ubits
+	.export		_fbits
+	.export		_dbits
+	.export		_flgs
+	.export		_flgm
+	.export		_flgd
+	.export		_flgl
+	.export		_rrc
+	.export		_crc
+	.export		_rfs
+	.export		_s714
+	.export		_section
+	.export		_main
+
+.segment	"RODATA"
+
+S0004:
+	.byte	$53,$65,$63,$74,$69,$6F,$6E,$20,$25,$73,$20,$72,$65,$74,$75,$72
+	.byte	$6E,$65,$64,$20,$25,$64,$2E,$0A,$00
+S0005:
+	.byte	$0A,$4E,$6F,$20,$65,$72,$72,$6F,$72,$73,$20,$64,$65,$74,$65,$63
+	.byte	$74,$65,$64,$2E,$0A,$00
+S0006:
+	.byte	$0A,$46,$61,$69,$6C,$65,$64,$2E,$0A,$00
+
+.segment	"BSS"
+
+_lbits:
+	.res	2,$00
+_ubits:
+	.res	2,$00
+_fbits:
+	.res	2,$00
+_dbits:
+	.res	2,$00
+_flgs:
+	.res	2,$00
+_flgm:
+	.res	2,$00
+_flgd:
+	.res	2,$00
+_flgl:
+	.res	2,$00
+_rrc:
+	.res	2,$00
+_crc:
+	.res	2,$00
+_rfs:
+	.res	8,$00
+
+; ---------------------------------------------------------------
+; int __near__ s714 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s714: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$28
+	jsr     subysp
+	lda     #<(M0003)
+	ldx     #>(M0003)
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$29
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     incaxy
+	jsr     stax0sp
+	ldx     #$00
+	txa
+	ldy     #$22
+	jsr     staxysp
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$29
+	jsr     ldaxysp
+	ldy     #$15
+	jsr     ldaxidx
+	ldy     #$26
+	jsr     staxysp
+L0002:	jsr     ldax0sp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$03
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1)
+	sta     (sreg)
+	tax
+	php
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	bne     L0002
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	lda     #$02
+	dey
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$05
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$1C
+	lda     (sp),y
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$02
+	beq     L02BC
+	lda     #$02
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02BC
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L02BC:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$18
+	lda     (sp),y
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$02
+	beq     L02BD
+	lda     #$03
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02BD
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L02BD:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$10
+	lda     (sp),y
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$02
+	beq     L02BE
+	lda     #$04
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02BE
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L02BE:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$0C
+	lda     (sp),y
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$02
+	beq     L02BF
+	lda     #$05
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02BF
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L02BF:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$08
+	lda     (sp),y
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$02
+	beq     L02C0
+	lda     #$06
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02C0
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L02C0:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$04
+	lda     (sp),y
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$02
+	beq     L02C1
+	lda     #$07
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02C1
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L02C1:	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$11
+	jsr     ldaxysp
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L03B9
+	cmp     #$02
+	beq     L02C5
+L03B9:	ldx     #$00
+	lda     #$0B
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02C5
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L02C5:	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$11
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L03BA
+	cmp     #$02
+	beq     L02CC
+L03BA:	ldx     #$00
+	lda     #$12
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02CC
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L02CC:	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$1A
+	jsr     staxysp
+	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	jsr     axulong
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	beq     L003E
+	ldx     #$00
+	lda     #$16
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02D0
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L003E:	ldx     #$00
+L02D0:	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	jsr     axlong
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	beq     L0040
+	ldx     #$00
+	lda     #$17
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02D1
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0040:	ldx     #$00
+L02D1:	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	jsr     axlong
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	beq     L0042
+	ldx     #$00
+	lda     #$18
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02D2
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0042:	ldx     #$00
+L02D2:	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$13
+	jsr     ldeaxysp
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	beq     L0044
+	ldx     #$00
+	lda     #$19
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02D3
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0044:	ldx     #$00
+L02D3:	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	jsr     axulong
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	beq     L0046
+	ldx     #$00
+	lda     #$1A
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02D4
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0046:	ldx     #$00
+L02D4:	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	jsr     axlong
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	beq     L0048
+	ldx     #$00
+	lda     #$1B
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02D5
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0048:	ldx     #$00
+L02D5:	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	jsr     axlong
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	beq     L004A
+	ldx     #$00
+	lda     #$1C
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02D6
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L004A:	ldx     #$00
+L02D6:	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$11
+	jsr     ldaxysp
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L03BB
+	cmp     #$02
+	beq     L02DA
+L03BB:	ldx     #$00
+	lda     #$20
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02DA
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L02DA:	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$0A
+	jsr     staxysp
+	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$0A
+	jsr     staxysp
+	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$0A
+	jsr     staxysp
+	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$11
+	jsr     ldaxysp
+	ldy     #$0A
+	jsr     staxysp
+	cpx     #$00
+	bne     L03BC
+	cmp     #$02
+	beq     L02E1
+L03BC:	ldx     #$00
+	lda     #$27
+	ldy     #$24
+	jsr     staxysp
+	tay
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02E1
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L02E1:	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$0A
+	jsr     staxysp
+	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$0A
+	jsr     staxysp
+	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$0A
+	jsr     staxysp
+	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$06
+	jsr     staxysp
+	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$06
+	jsr     staxysp
+	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$06
+	jsr     staxysp
+	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$11
+	jsr     ldaxysp
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L03BD
+	cmp     #$02
+	beq     L02E8
+L03BD:	ldx     #$00
+	lda     #$2E
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02E8
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L02E8:	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$06
+	jsr     staxysp
+	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$06
+	jsr     staxysp
+	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$06
+	jsr     staxysp
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	lda     #$02
+	dey
+	sta     (sp),y
+	iny
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$07
+	beq     L02EC
+	lda     #$32
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02EC
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L02EC:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$21
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$07
+	beq     L02ED
+	lda     #$33
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02ED
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L02ED:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$21
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$07
+	beq     L02EE
+	lda     #$34
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02EE
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L02EE:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$13
+	jsr     ldeaxysp
+	ldy     #$21
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$07
+	beq     L02EF
+	ldx     #$00
+	lda     #$35
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02EF
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L02EF:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$21
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$07
+	beq     L02F0
+	lda     #$36
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02F0
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L02F0:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$21
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$07
+	beq     L02F1
+	lda     #$37
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02F1
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L02F1:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$21
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$07
+	beq     L02F2
+	lda     #$38
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02F2
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L02F2:	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$1E
+	jsr     addeqysp
+	ldy     #$1F
+	lda     (sp),y
+	bne     L03BE
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L009A
+L03BE:	ldx     #$00
+	lda     #$39
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02F3
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L009A:	ldx     #$00
+L02F3:	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$1E
+	jsr     addeqysp
+	ldy     #$1F
+	lda     (sp),y
+	bne     L03BF
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L009D
+L03BF:	ldx     #$00
+	lda     #$3A
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02F4
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L009D:	ldx     #$00
+L02F4:	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$1E
+	jsr     addeqysp
+	ldy     #$1F
+	lda     (sp),y
+	bne     L03C0
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L00A0
+L03C0:	ldx     #$00
+	lda     #$3B
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02F5
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00A0:	ldx     #$00
+L02F5:	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$13
+	jsr     ldeaxysp
+	ldy     #$1E
+	jsr     addeqysp
+	ldy     #$1F
+	lda     (sp),y
+	bne     L03C1
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L00A3
+L03C1:	ldx     #$00
+	lda     #$3C
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02F6
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00A3:	ldx     #$00
+L02F6:	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$1E
+	jsr     addeqysp
+	ldy     #$1F
+	lda     (sp),y
+	bne     L03C2
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L00A6
+L03C2:	ldx     #$00
+	lda     #$3D
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02F7
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00A6:	ldx     #$00
+L02F7:	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$1E
+	jsr     addeqysp
+	ldy     #$1F
+	lda     (sp),y
+	bne     L03C3
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L00A9
+L03C3:	ldx     #$00
+	lda     #$3E
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02F8
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00A9:	ldx     #$00
+L02F8:	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$1E
+	jsr     addeqysp
+	ldy     #$1F
+	lda     (sp),y
+	bne     L03C4
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L00AC
+L03C4:	ldx     #$00
+	lda     #$3F
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02F9
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00AC:	ldx     #$00
+L02F9:	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$1A
+	jsr     addeqysp
+	ldy     #$1B
+	lda     (sp),y
+	bne     L03C5
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L00AF
+L03C5:	ldx     #$00
+	lda     #$40
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02FA
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00AF:	ldx     #$00
+L02FA:	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$1A
+	jsr     addeqysp
+	ldy     #$1B
+	lda     (sp),y
+	bne     L03C6
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L00B2
+L03C6:	ldx     #$00
+	lda     #$41
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02FB
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00B2:	ldx     #$00
+L02FB:	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$1A
+	jsr     addeqysp
+	ldy     #$1B
+	lda     (sp),y
+	bne     L03C7
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L00B5
+L03C7:	ldx     #$00
+	lda     #$42
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02FC
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00B5:	ldx     #$00
+L02FC:	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$13
+	jsr     ldeaxysp
+	ldy     #$1A
+	jsr     addeqysp
+	ldy     #$1B
+	lda     (sp),y
+	bne     L03C8
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L00B8
+L03C8:	ldx     #$00
+	lda     #$43
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02FD
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00B8:	ldx     #$00
+L02FD:	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$1A
+	jsr     addeqysp
+	ldy     #$1B
+	lda     (sp),y
+	bne     L03C9
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L00BB
+L03C9:	ldx     #$00
+	lda     #$44
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02FE
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00BB:	ldx     #$00
+L02FE:	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$1A
+	jsr     addeqysp
+	ldy     #$1B
+	lda     (sp),y
+	bne     L03CA
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L00BE
+L03CA:	ldx     #$00
+	lda     #$45
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02FF
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00BE:	ldx     #$00
+L02FF:	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$1A
+	jsr     addeqysp
+	ldy     #$1B
+	lda     (sp),y
+	bne     L03CB
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L00C1
+L03CB:	ldx     #$00
+	lda     #$46
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0300
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00C1:	ldx     #$00
+L0300:	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	jsr     axulong
+	ldy     #$14
+	jsr     laddeqysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$07
+	jsr     tosneeax
+	beq     L00C3
+	ldx     #$00
+	lda     #$47
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0301
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00C3:	ldx     #$00
+L0301:	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	jsr     axlong
+	ldy     #$14
+	jsr     laddeqysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$07
+	jsr     tosneeax
+	beq     L00C5
+	ldx     #$00
+	lda     #$48
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0302
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00C5:	ldx     #$00
+L0302:	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	jsr     axlong
+	ldy     #$14
+	jsr     laddeqysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$07
+	jsr     tosneeax
+	beq     L00C7
+	ldx     #$00
+	lda     #$49
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0303
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00C7:	ldx     #$00
+L0303:	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$13
+	jsr     ldeaxysp
+	ldy     #$14
+	jsr     laddeqysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$07
+	jsr     tosneeax
+	beq     L00C9
+	ldx     #$00
+	lda     #$4A
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0304
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00C9:	ldx     #$00
+L0304:	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	jsr     axulong
+	ldy     #$14
+	jsr     laddeqysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$07
+	jsr     tosneeax
+	beq     L00CB
+	ldx     #$00
+	lda     #$4B
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0305
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00CB:	ldx     #$00
+L0305:	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	jsr     axlong
+	ldy     #$14
+	jsr     laddeqysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$07
+	jsr     tosneeax
+	beq     L00CD
+	ldx     #$00
+	lda     #$4C
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0306
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00CD:	ldx     #$00
+L0306:	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	jsr     axlong
+	ldy     #$14
+	jsr     laddeqysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$07
+	jsr     tosneeax
+	beq     L00CF
+	ldx     #$00
+	lda     #$4D
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0307
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00CF:	ldx     #$00
+L0307:	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$0E
+	jsr     addeqysp
+	ldy     #$0F
+	lda     (sp),y
+	bne     L03CC
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L00D2
+L03CC:	ldx     #$00
+	lda     #$4E
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0308
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00D2:	ldx     #$00
+L0308:	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$0E
+	jsr     addeqysp
+	ldy     #$0F
+	lda     (sp),y
+	bne     L03CD
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L00D5
+L03CD:	ldx     #$00
+	lda     #$4F
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0309
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00D5:	ldx     #$00
+L0309:	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$0E
+	jsr     addeqysp
+	ldy     #$0F
+	lda     (sp),y
+	bne     L03CE
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L00D8
+L03CE:	ldx     #$00
+	lda     #$50
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L030A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00D8:	ldx     #$00
+L030A:	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$13
+	jsr     ldeaxysp
+	ldy     #$0E
+	jsr     addeqysp
+	ldy     #$0F
+	lda     (sp),y
+	bne     L03CF
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L00DB
+L03CF:	ldx     #$00
+	lda     #$51
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L030B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00DB:	ldx     #$00
+L030B:	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$0E
+	jsr     addeqysp
+	ldy     #$0F
+	lda     (sp),y
+	bne     L03D0
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L00DE
+L03D0:	ldx     #$00
+	lda     #$52
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L030C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00DE:	ldx     #$00
+L030C:	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$0E
+	jsr     addeqysp
+	ldy     #$0F
+	lda     (sp),y
+	bne     L03D1
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L00E1
+L03D1:	ldx     #$00
+	lda     #$53
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L030D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00E1:	ldx     #$00
+L030D:	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$0E
+	jsr     addeqysp
+	ldy     #$0F
+	lda     (sp),y
+	bne     L03D2
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L00E4
+L03D2:	ldx     #$00
+	lda     #$54
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L030E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00E4:	ldx     #$00
+L030E:	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$0A
+	jsr     addeqysp
+	ldy     #$0B
+	lda     (sp),y
+	bne     L03D3
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L00E7
+L03D3:	ldx     #$00
+	lda     #$55
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L030F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00E7:	ldx     #$00
+L030F:	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$0A
+	jsr     addeqysp
+	ldy     #$0B
+	lda     (sp),y
+	bne     L03D4
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L00EA
+L03D4:	ldx     #$00
+	lda     #$56
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0310
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00EA:	ldx     #$00
+L0310:	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$0A
+	jsr     addeqysp
+	ldy     #$0B
+	lda     (sp),y
+	bne     L03D5
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L00ED
+L03D5:	ldx     #$00
+	lda     #$57
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0311
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00ED:	ldx     #$00
+L0311:	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$13
+	jsr     ldeaxysp
+	ldy     #$0A
+	jsr     addeqysp
+	ldy     #$0B
+	lda     (sp),y
+	bne     L03D6
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L00F0
+L03D6:	ldx     #$00
+	lda     #$58
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0312
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00F0:	ldx     #$00
+L0312:	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$0A
+	jsr     addeqysp
+	ldy     #$0B
+	lda     (sp),y
+	bne     L03D7
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L00F3
+L03D7:	ldx     #$00
+	lda     #$59
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0313
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00F3:	ldx     #$00
+L0313:	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$0A
+	jsr     addeqysp
+	ldy     #$0B
+	lda     (sp),y
+	bne     L03D8
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L00F6
+L03D8:	ldx     #$00
+	lda     #$5A
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0314
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00F6:	ldx     #$00
+L0314:	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$0A
+	jsr     addeqysp
+	ldy     #$0B
+	lda     (sp),y
+	bne     L03D9
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L00F9
+L03D9:	ldx     #$00
+	lda     #$5B
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0315
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00F9:	ldx     #$00
+L0315:	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$06
+	jsr     addeqysp
+	ldy     #$07
+	lda     (sp),y
+	bne     L03DA
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L00FC
+L03DA:	ldx     #$00
+	lda     #$5C
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0316
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00FC:	ldx     #$00
+L0316:	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$06
+	jsr     addeqysp
+	ldy     #$07
+	lda     (sp),y
+	bne     L03DB
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L00FF
+L03DB:	ldx     #$00
+	lda     #$5D
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0317
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00FF:	ldx     #$00
+L0317:	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$06
+	jsr     addeqysp
+	ldy     #$07
+	lda     (sp),y
+	bne     L03DC
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L0102
+L03DC:	ldx     #$00
+	lda     #$5E
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0318
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0102:	ldx     #$00
+L0318:	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$13
+	jsr     ldeaxysp
+	ldy     #$06
+	jsr     addeqysp
+	ldy     #$07
+	lda     (sp),y
+	bne     L03DD
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L0105
+L03DD:	ldx     #$00
+	lda     #$5F
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0319
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0105:	ldx     #$00
+L0319:	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$06
+	jsr     addeqysp
+	ldy     #$07
+	lda     (sp),y
+	bne     L03DE
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L0108
+L03DE:	ldx     #$00
+	lda     #$60
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L031A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0108:	ldx     #$00
+L031A:	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$06
+	jsr     addeqysp
+	ldy     #$07
+	lda     (sp),y
+	bne     L03DF
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L010B
+L03DF:	ldx     #$00
+	lda     #$61
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L031B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L010B:	ldx     #$00
+L031B:	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$06
+	jsr     addeqysp
+	ldy     #$07
+	lda     (sp),y
+	bne     L03E0
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L031C
+L03E0:	ldx     #$00
+	lda     #$62
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L031C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L031C:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	lda     #$02
+	dey
+	sta     (sp),y
+	iny
+	lda     #$FD
+	sec
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$03
+	beq     L031D
+	ldx     #$00
+	lda     #$63
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L031D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L031D:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$21
+	lda     #$FD
+	sec
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$03
+	beq     L031E
+	lda     #$64
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L031E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L031E:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$21
+	lda     #$FD
+	sec
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$03
+	beq     L031F
+	lda     #$65
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L031F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L031F:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$13
+	jsr     ldeaxysp
+	ldy     #$21
+	eor     #$FF
+	sec
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$03
+	beq     L0320
+	ldx     #$00
+	lda     #$66
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0320
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0320:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$21
+	lda     #$FD
+	sec
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$03
+	beq     L0321
+	lda     #$67
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0321
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0321:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$21
+	lda     #$FD
+	sec
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$03
+	beq     L0322
+	lda     #$68
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0322
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0322:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$21
+	lda     #$FD
+	sec
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$03
+	beq     L0323
+	lda     #$69
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0323
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L0323:	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$1E
+	jsr     subeqysp
+	ldy     #$1F
+	lda     (sp),y
+	bne     L03E1
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L011F
+L03E1:	ldx     #$00
+	lda     #$6A
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0324
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L011F:	ldx     #$00
+L0324:	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$1E
+	jsr     subeqysp
+	ldy     #$1F
+	lda     (sp),y
+	bne     L03E2
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0122
+L03E2:	ldx     #$00
+	lda     #$6B
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0325
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0122:	ldx     #$00
+L0325:	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$1E
+	jsr     subeqysp
+	ldy     #$1F
+	lda     (sp),y
+	bne     L03E3
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0125
+L03E3:	ldx     #$00
+	lda     #$6C
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0326
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0125:	ldx     #$00
+L0326:	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$13
+	jsr     ldeaxysp
+	ldy     #$1E
+	jsr     subeqysp
+	ldy     #$1F
+	lda     (sp),y
+	bne     L03E4
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0128
+L03E4:	ldx     #$00
+	lda     #$6D
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0327
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0128:	ldx     #$00
+L0327:	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$1E
+	jsr     subeqysp
+	ldy     #$1F
+	lda     (sp),y
+	bne     L03E5
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L012B
+L03E5:	ldx     #$00
+	lda     #$6E
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0328
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L012B:	ldx     #$00
+L0328:	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$1E
+	jsr     subeqysp
+	ldy     #$1F
+	lda     (sp),y
+	bne     L03E6
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L012E
+L03E6:	ldx     #$00
+	lda     #$6F
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0329
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L012E:	ldx     #$00
+L0329:	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$1E
+	jsr     subeqysp
+	ldy     #$1F
+	lda     (sp),y
+	bne     L03E7
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0131
+L03E7:	ldx     #$00
+	lda     #$70
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L032A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0131:	ldx     #$00
+L032A:	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$1A
+	jsr     subeqysp
+	ldy     #$1B
+	lda     (sp),y
+	bne     L03E8
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0134
+L03E8:	ldx     #$00
+	lda     #$71
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L032B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0134:	ldx     #$00
+L032B:	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$1A
+	jsr     subeqysp
+	ldy     #$1B
+	lda     (sp),y
+	bne     L03E9
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0137
+L03E9:	ldx     #$00
+	lda     #$72
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L032C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0137:	ldx     #$00
+L032C:	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$1A
+	jsr     subeqysp
+	ldy     #$1B
+	lda     (sp),y
+	bne     L03EA
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L013A
+L03EA:	ldx     #$00
+	lda     #$73
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L032D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L013A:	ldx     #$00
+L032D:	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$13
+	jsr     ldeaxysp
+	ldy     #$1A
+	jsr     subeqysp
+	ldy     #$1B
+	lda     (sp),y
+	bne     L03EB
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L013D
+L03EB:	ldx     #$00
+	lda     #$74
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L032E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L013D:	ldx     #$00
+L032E:	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$1A
+	jsr     subeqysp
+	ldy     #$1B
+	lda     (sp),y
+	bne     L03EC
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0140
+L03EC:	ldx     #$00
+	lda     #$75
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L032F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0140:	ldx     #$00
+L032F:	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$1A
+	jsr     subeqysp
+	ldy     #$1B
+	lda     (sp),y
+	bne     L03ED
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0143
+L03ED:	ldx     #$00
+	lda     #$76
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0330
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0143:	ldx     #$00
+L0330:	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$1A
+	jsr     subeqysp
+	ldy     #$1B
+	lda     (sp),y
+	bne     L03EE
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0146
+L03EE:	ldx     #$00
+	lda     #$77
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0331
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0146:	ldx     #$00
+L0331:	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	jsr     axulong
+	ldy     #$14
+	jsr     lsubeqysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$03
+	jsr     tosneeax
+	beq     L0148
+	ldx     #$00
+	lda     #$78
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0332
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0148:	ldx     #$00
+L0332:	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	jsr     axlong
+	ldy     #$14
+	jsr     lsubeqysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$03
+	jsr     tosneeax
+	beq     L014A
+	ldx     #$00
+	lda     #$79
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0333
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L014A:	ldx     #$00
+L0333:	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	jsr     axlong
+	ldy     #$14
+	jsr     lsubeqysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$03
+	jsr     tosneeax
+	beq     L014C
+	ldx     #$00
+	lda     #$7A
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0334
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L014C:	ldx     #$00
+L0334:	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$13
+	jsr     ldeaxysp
+	ldy     #$14
+	jsr     lsubeqysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$03
+	jsr     tosneeax
+	beq     L014E
+	ldx     #$00
+	lda     #$7B
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0335
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L014E:	ldx     #$00
+L0335:	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	jsr     axulong
+	ldy     #$14
+	jsr     lsubeqysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$03
+	jsr     tosneeax
+	beq     L0150
+	ldx     #$00
+	lda     #$7C
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0336
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0150:	ldx     #$00
+L0336:	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	jsr     axlong
+	ldy     #$14
+	jsr     lsubeqysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$03
+	jsr     tosneeax
+	beq     L0152
+	ldx     #$00
+	lda     #$7D
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0337
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0152:	ldx     #$00
+L0337:	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	jsr     axlong
+	ldy     #$14
+	jsr     lsubeqysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$03
+	jsr     tosneeax
+	beq     L0154
+	ldx     #$00
+	lda     #$7E
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0338
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0154:	ldx     #$00
+L0338:	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$0E
+	jsr     subeqysp
+	ldy     #$0F
+	lda     (sp),y
+	bne     L03EF
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0157
+L03EF:	ldx     #$00
+	lda     #$7F
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0339
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0157:	ldx     #$00
+L0339:	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$0E
+	jsr     subeqysp
+	ldy     #$0F
+	lda     (sp),y
+	bne     L03F0
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L015A
+L03F0:	ldx     #$00
+	lda     #$80
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L033A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L015A:	ldx     #$00
+L033A:	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$0E
+	jsr     subeqysp
+	ldy     #$0F
+	lda     (sp),y
+	bne     L03F1
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L015D
+L03F1:	ldx     #$00
+	lda     #$81
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L033B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L015D:	ldx     #$00
+L033B:	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$13
+	jsr     ldeaxysp
+	ldy     #$0E
+	jsr     subeqysp
+	ldy     #$0F
+	lda     (sp),y
+	bne     L03F2
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0160
+L03F2:	ldx     #$00
+	lda     #$82
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L033C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0160:	ldx     #$00
+L033C:	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$0E
+	jsr     subeqysp
+	ldy     #$0F
+	lda     (sp),y
+	bne     L03F3
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0163
+L03F3:	ldx     #$00
+	lda     #$83
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L033D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0163:	ldx     #$00
+L033D:	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$0E
+	jsr     subeqysp
+	ldy     #$0F
+	lda     (sp),y
+	bne     L03F4
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0166
+L03F4:	ldx     #$00
+	lda     #$84
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L033E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0166:	ldx     #$00
+L033E:	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$0E
+	jsr     subeqysp
+	ldy     #$0F
+	lda     (sp),y
+	bne     L03F5
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0169
+L03F5:	ldx     #$00
+	lda     #$85
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L033F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0169:	ldx     #$00
+L033F:	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$0A
+	jsr     subeqysp
+	ldy     #$0B
+	lda     (sp),y
+	bne     L03F6
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L016C
+L03F6:	ldx     #$00
+	lda     #$86
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0340
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L016C:	ldx     #$00
+L0340:	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$0A
+	jsr     subeqysp
+	ldy     #$0B
+	lda     (sp),y
+	bne     L03F7
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L016F
+L03F7:	ldx     #$00
+	lda     #$87
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0341
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L016F:	ldx     #$00
+L0341:	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$0A
+	jsr     subeqysp
+	ldy     #$0B
+	lda     (sp),y
+	bne     L03F8
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0172
+L03F8:	ldx     #$00
+	lda     #$88
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0342
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0172:	ldx     #$00
+L0342:	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$13
+	jsr     ldeaxysp
+	ldy     #$0A
+	jsr     subeqysp
+	ldy     #$0B
+	lda     (sp),y
+	bne     L03F9
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0175
+L03F9:	ldx     #$00
+	lda     #$89
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0343
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0175:	ldx     #$00
+L0343:	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$0A
+	jsr     subeqysp
+	ldy     #$0B
+	lda     (sp),y
+	bne     L03FA
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0178
+L03FA:	ldx     #$00
+	lda     #$8A
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0344
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0178:	ldx     #$00
+L0344:	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$0A
+	jsr     subeqysp
+	ldy     #$0B
+	lda     (sp),y
+	bne     L03FB
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L017B
+L03FB:	ldx     #$00
+	lda     #$8B
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0345
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L017B:	ldx     #$00
+L0345:	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$0A
+	jsr     subeqysp
+	ldy     #$0B
+	lda     (sp),y
+	bne     L03FC
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L017E
+L03FC:	ldx     #$00
+	lda     #$8C
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0346
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L017E:	ldx     #$00
+L0346:	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$06
+	jsr     subeqysp
+	ldy     #$07
+	lda     (sp),y
+	bne     L03FD
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0181
+L03FD:	ldx     #$00
+	lda     #$8D
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0347
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0181:	ldx     #$00
+L0347:	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$06
+	jsr     subeqysp
+	ldy     #$07
+	lda     (sp),y
+	bne     L03FE
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0184
+L03FE:	ldx     #$00
+	lda     #$8E
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0348
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0184:	ldx     #$00
+L0348:	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$06
+	jsr     subeqysp
+	ldy     #$07
+	lda     (sp),y
+	bne     L03FF
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0187
+L03FF:	ldx     #$00
+	lda     #$8F
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0349
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0187:	ldx     #$00
+L0349:	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$13
+	jsr     ldeaxysp
+	ldy     #$06
+	jsr     subeqysp
+	ldy     #$07
+	lda     (sp),y
+	bne     L0400
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L018A
+L0400:	ldx     #$00
+	lda     #$90
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L034A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L018A:	ldx     #$00
+L034A:	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$06
+	jsr     subeqysp
+	ldy     #$07
+	lda     (sp),y
+	bne     L0401
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L018D
+L0401:	ldx     #$00
+	lda     #$91
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L034B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L018D:	ldx     #$00
+L034B:	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$06
+	jsr     subeqysp
+	ldy     #$07
+	lda     (sp),y
+	bne     L0402
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L0190
+L0402:	ldx     #$00
+	lda     #$92
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L034C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0190:	ldx     #$00
+L034C:	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$06
+	jsr     subeqysp
+	ldy     #$07
+	lda     (sp),y
+	bne     L0403
+	dey
+	lda     (sp),y
+	cmp     #$03
+	beq     L034D
+L0403:	ldx     #$00
+	lda     #$93
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L034D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L034D:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	lda     #$02
+	dey
+	sta     (sp),y
+	iny
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$22
+	lda     (sp),y
+	jsr     tosumula0
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$0A
+	beq     L034E
+	ldx     #$00
+	lda     #$94
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L034E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L034E:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosmulax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$0A
+	beq     L034F
+	ldx     #$00
+	lda     #$95
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L034F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L034F:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosmulax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$0A
+	beq     L0350
+	ldx     #$00
+	lda     #$96
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0350
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0350:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosmuleax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$0A
+	beq     L0351
+	ldx     #$00
+	lda     #$97
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0351
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0351:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosumulax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$0A
+	beq     L0352
+	ldx     #$00
+	lda     #$98
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0352
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0352:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosmulax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$0A
+	beq     L0353
+	ldx     #$00
+	lda     #$99
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0353
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0353:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosmulax
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$0A
+	beq     L0354
+	lda     #$9A
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0354
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L0354:	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	iny
+	jsr     pushwysp
+	ldy     #$22
+	lda     (sp),y
+	jsr     tosmula0
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0404
+	cmp     #$0A
+	beq     L0355
+L0404:	ldx     #$00
+	lda     #$9B
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0355
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L0355:	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosmulax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0405
+	cmp     #$0A
+	beq     L0356
+L0405:	ldx     #$00
+	lda     #$9C
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0356
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L0356:	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosmulax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0406
+	cmp     #$0A
+	beq     L0357
+L0406:	ldx     #$00
+	lda     #$9D
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0357
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L0357:	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosmuleax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0407
+	cmp     #$0A
+	beq     L0358
+L0407:	ldx     #$00
+	lda     #$9E
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0358
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L0358:	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosumulax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0408
+	cmp     #$0A
+	beq     L0359
+L0408:	ldx     #$00
+	lda     #$9F
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0359
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L0359:	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosmulax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0409
+	cmp     #$0A
+	beq     L035A
+L0409:	ldx     #$00
+	lda     #$A0
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L035A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L035A:	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosmulax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L040A
+	cmp     #$0A
+	beq     L035B
+L040A:	ldx     #$00
+	lda     #$A1
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L035B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L035B:	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$22
+	lda     (sp),y
+	jsr     tosmula0
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L040B
+	cmp     #$0A
+	beq     L035C
+L040B:	ldx     #$00
+	lda     #$A2
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L035C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L035C:	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosmulax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L040C
+	cmp     #$0A
+	beq     L035D
+L040C:	ldx     #$00
+	lda     #$A3
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L035D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L035D:	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosmulax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L040D
+	cmp     #$0A
+	beq     L035E
+L040D:	ldx     #$00
+	lda     #$A4
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L035E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L035E:	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosmuleax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L040E
+	cmp     #$0A
+	beq     L035F
+L040E:	ldx     #$00
+	lda     #$A5
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L035F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L035F:	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosumulax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L040F
+	cmp     #$0A
+	beq     L0360
+L040F:	ldx     #$00
+	lda     #$A6
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0360
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L0360:	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosmulax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L0410
+	cmp     #$0A
+	beq     L0361
+L0410:	ldx     #$00
+	lda     #$A7
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0361
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L0361:	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosmulax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L0411
+	cmp     #$0A
+	beq     L0362
+L0411:	ldx     #$00
+	lda     #$A8
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0362
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L0362:	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$24
+	ldx     #$00
+	lda     (sp),y
+	jsr     axulong
+	jsr     tosmuleax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$0A
+	jsr     tosneeax
+	beq     L01CD
+	ldx     #$00
+	lda     #$A9
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0363
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L01CD:	ldx     #$00
+L0363:	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$21
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosmuleax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$0A
+	jsr     tosneeax
+	beq     L01CF
+	ldx     #$00
+	lda     #$AA
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0364
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L01CF:	ldx     #$00
+L0364:	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$1D
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosmuleax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$0A
+	jsr     tosneeax
+	beq     L01D1
+	ldx     #$00
+	lda     #$AB
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0365
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L01D1:	ldx     #$00
+L0365:	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     tosmuleax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$0A
+	jsr     tosneeax
+	beq     L01D3
+	ldx     #$00
+	lda     #$AC
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0366
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L01D3:	ldx     #$00
+L0366:	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axulong
+	jsr     tosmuleax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$0A
+	jsr     tosneeax
+	beq     L01D5
+	ldx     #$00
+	lda     #$AD
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0367
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L01D5:	ldx     #$00
+L0367:	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0D
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosmuleax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$0A
+	jsr     tosneeax
+	beq     L01D7
+	ldx     #$00
+	lda     #$AE
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0368
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L01D7:	ldx     #$00
+L0368:	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosmuleax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$0A
+	jsr     tosneeax
+	beq     L01D9
+	ldx     #$00
+	lda     #$AF
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0369
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L01D9:	ldx     #$00
+L0369:	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$22
+	lda     (sp),y
+	jsr     tosumula0
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0412
+	cmp     #$0A
+	beq     L036A
+L0412:	ldx     #$00
+	lda     #$B0
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L036A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L036A:	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosumulax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0413
+	cmp     #$0A
+	beq     L036B
+L0413:	ldx     #$00
+	lda     #$B1
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L036B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L036B:	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosumulax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0414
+	cmp     #$0A
+	beq     L036C
+L0414:	ldx     #$00
+	lda     #$B2
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L036C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L036C:	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosmuleax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0415
+	cmp     #$0A
+	beq     L036D
+L0415:	ldx     #$00
+	lda     #$B3
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L036D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L036D:	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosumulax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0416
+	cmp     #$0A
+	beq     L036E
+L0416:	ldx     #$00
+	lda     #$B4
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L036E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L036E:	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosumulax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0417
+	cmp     #$0A
+	beq     L036F
+L0417:	ldx     #$00
+	lda     #$B5
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L036F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L036F:	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosumulax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0418
+	cmp     #$0A
+	beq     L0370
+L0418:	ldx     #$00
+	lda     #$B6
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0370
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L0370:	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$22
+	lda     (sp),y
+	jsr     tosmula0
+	ldy     #$0A
+	jsr     staxysp
+	cpx     #$00
+	bne     L0419
+	cmp     #$0A
+	beq     L0371
+L0419:	ldx     #$00
+	lda     #$B7
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0371
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L0371:	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosmulax
+	ldy     #$0A
+	jsr     staxysp
+	cpx     #$00
+	bne     L041A
+	cmp     #$0A
+	beq     L0372
+L041A:	ldx     #$00
+	lda     #$B8
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0372
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L0372:	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosmulax
+	ldy     #$0A
+	jsr     staxysp
+	cpx     #$00
+	bne     L041B
+	cmp     #$0A
+	beq     L0373
+L041B:	ldx     #$00
+	lda     #$B9
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0373
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L0373:	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosmuleax
+	ldy     #$0A
+	jsr     staxysp
+	cpx     #$00
+	bne     L041C
+	cmp     #$0A
+	beq     L0374
+L041C:	ldx     #$00
+	lda     #$BA
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0374
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L0374:	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosumulax
+	ldy     #$0A
+	jsr     staxysp
+	cpx     #$00
+	bne     L041D
+	cmp     #$0A
+	beq     L0375
+L041D:	ldx     #$00
+	lda     #$BB
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0375
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L0375:	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosmulax
+	ldy     #$0A
+	jsr     staxysp
+	cpx     #$00
+	bne     L041E
+	cmp     #$0A
+	beq     L0376
+L041E:	ldx     #$00
+	lda     #$BC
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0376
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L0376:	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosmulax
+	ldy     #$0A
+	jsr     staxysp
+	cpx     #$00
+	bne     L041F
+	cmp     #$0A
+	beq     L0377
+L041F:	ldx     #$00
+	lda     #$BD
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0377
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L0377:	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$22
+	lda     (sp),y
+	jsr     tosmula0
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L0420
+	cmp     #$0A
+	beq     L0378
+L0420:	ldx     #$00
+	lda     #$BE
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0378
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L0378:	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosmulax
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L0421
+	cmp     #$0A
+	beq     L0379
+L0421:	ldx     #$00
+	lda     #$BF
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0379
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L0379:	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosmulax
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L0422
+	cmp     #$0A
+	beq     L037A
+L0422:	ldx     #$00
+	lda     #$C0
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L037A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L037A:	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosmuleax
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L0423
+	cmp     #$0A
+	beq     L037B
+L0423:	ldx     #$00
+	lda     #$C1
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L037B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L037B:	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosumulax
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L0424
+	cmp     #$0A
+	beq     L037C
+L0424:	ldx     #$00
+	lda     #$C2
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L037C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L037C:	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosmulax
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L0425
+	cmp     #$0A
+	beq     L037D
+L0425:	ldx     #$00
+	lda     #$C3
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L037D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L037D:	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosmulax
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L0426
+	cmp     #$0A
+	beq     L037E
+L0426:	ldx     #$00
+	lda     #$C4
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L037E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L037E:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	lda     #$02
+	dey
+	sta     (sp),y
+	iny
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$22
+	lda     (sp),y
+	jsr     tosudiva0
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$02
+	beq     L037F
+	ldx     #$00
+	lda     #$C5
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L037F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L037F:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosdivax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$02
+	beq     L0380
+	ldx     #$00
+	lda     #$C6
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0380
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0380:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosdivax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$02
+	beq     L0381
+	ldx     #$00
+	lda     #$C7
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0381
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0381:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosdiveax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$02
+	beq     L0382
+	ldx     #$00
+	lda     #$C8
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0382
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0382:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosudivax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$02
+	beq     L0383
+	ldx     #$00
+	lda     #$C9
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0383
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0383:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosdivax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$02
+	beq     L0384
+	ldx     #$00
+	lda     #$CA
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0384
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0384:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosdivax
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$02
+	beq     L0385
+	lda     #$CB
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0385
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L0385:	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	iny
+	jsr     pushwysp
+	ldy     #$22
+	lda     (sp),y
+	jsr     tosdiva0
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0427
+	cmp     #$02
+	beq     L0386
+L0427:	ldx     #$00
+	lda     #$CC
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0386
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L0386:	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosdivax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0428
+	cmp     #$02
+	beq     L0387
+L0428:	ldx     #$00
+	lda     #$CD
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0387
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L0387:	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosdivax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0429
+	cmp     #$02
+	beq     L0388
+L0429:	ldx     #$00
+	lda     #$CE
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0388
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L0388:	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosdiveax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L042A
+	cmp     #$02
+	beq     L0389
+L042A:	ldx     #$00
+	lda     #$CF
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0389
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L0389:	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosudivax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L042B
+	cmp     #$02
+	beq     L038A
+L042B:	ldx     #$00
+	lda     #$D0
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L038A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L038A:	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosdivax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L042C
+	cmp     #$02
+	beq     L038B
+L042C:	ldx     #$00
+	lda     #$D1
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L038B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L038B:	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosdivax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L042D
+	cmp     #$02
+	beq     L038C
+L042D:	ldx     #$00
+	lda     #$D2
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L038C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L038C:	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$22
+	lda     (sp),y
+	jsr     tosdiva0
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L042E
+	cmp     #$02
+	beq     L038D
+L042E:	ldx     #$00
+	lda     #$D3
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L038D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L038D:	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosdivax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L042F
+	cmp     #$02
+	beq     L038E
+L042F:	ldx     #$00
+	lda     #$D4
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L038E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L038E:	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosdivax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L0430
+	cmp     #$02
+	beq     L038F
+L0430:	ldx     #$00
+	lda     #$D5
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L038F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L038F:	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosdiveax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L0431
+	cmp     #$02
+	beq     L0390
+L0431:	ldx     #$00
+	lda     #$D6
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0390
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L0390:	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosudivax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L0432
+	cmp     #$02
+	beq     L0391
+L0432:	ldx     #$00
+	lda     #$D7
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0391
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L0391:	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosdivax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L0433
+	cmp     #$02
+	beq     L0392
+L0433:	ldx     #$00
+	lda     #$D8
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0392
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L0392:	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosdivax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L0434
+	cmp     #$02
+	beq     L0393
+L0434:	ldx     #$00
+	lda     #$D9
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0393
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L0393:	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$24
+	ldx     #$00
+	lda     (sp),y
+	jsr     axulong
+	jsr     tosdiveax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	beq     L0252
+	ldx     #$00
+	lda     #$DA
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0394
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0252:	ldx     #$00
+L0394:	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$21
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosdiveax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	beq     L0254
+	ldx     #$00
+	lda     #$DB
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0395
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0254:	ldx     #$00
+L0395:	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$1D
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosdiveax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	beq     L0256
+	ldx     #$00
+	lda     #$DC
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0396
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0256:	ldx     #$00
+L0396:	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	beq     L0258
+	ldx     #$00
+	lda     #$DD
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0397
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0258:	ldx     #$00
+L0397:	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axulong
+	jsr     tosdiveax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	beq     L025A
+	ldx     #$00
+	lda     #$DE
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0398
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L025A:	ldx     #$00
+L0398:	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0D
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosdiveax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	beq     L025C
+	ldx     #$00
+	lda     #$DF
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0399
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L025C:	ldx     #$00
+L0399:	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosdiveax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	beq     L025E
+	ldx     #$00
+	lda     #$E0
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L039A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L025E:	ldx     #$00
+L039A:	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$22
+	lda     (sp),y
+	jsr     tosudiva0
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0435
+	cmp     #$02
+	beq     L039B
+L0435:	ldx     #$00
+	lda     #$E1
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L039B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L039B:	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosudivax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0436
+	cmp     #$02
+	beq     L039C
+L0436:	ldx     #$00
+	lda     #$E2
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L039C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L039C:	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosudivax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0437
+	cmp     #$02
+	beq     L039D
+L0437:	ldx     #$00
+	lda     #$E3
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L039D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L039D:	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosdiveax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0438
+	cmp     #$02
+	beq     L039E
+L0438:	ldx     #$00
+	lda     #$E4
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L039E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L039E:	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosudivax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0439
+	cmp     #$02
+	beq     L039F
+L0439:	ldx     #$00
+	lda     #$E5
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L039F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L039F:	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosudivax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L043A
+	cmp     #$02
+	beq     L03A0
+L043A:	ldx     #$00
+	lda     #$E6
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03A0
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L03A0:	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosudivax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L043B
+	cmp     #$02
+	beq     L03A1
+L043B:	ldx     #$00
+	lda     #$E7
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03A1
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L03A1:	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$22
+	lda     (sp),y
+	jsr     tosdiva0
+	ldy     #$0A
+	jsr     staxysp
+	cpx     #$00
+	bne     L043C
+	cmp     #$02
+	beq     L03A2
+L043C:	ldx     #$00
+	lda     #$E8
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03A2
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L03A2:	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosdivax
+	ldy     #$0A
+	jsr     staxysp
+	cpx     #$00
+	bne     L043D
+	cmp     #$02
+	beq     L03A3
+L043D:	ldx     #$00
+	lda     #$E9
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03A3
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L03A3:	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosdivax
+	ldy     #$0A
+	jsr     staxysp
+	cpx     #$00
+	bne     L043E
+	cmp     #$02
+	beq     L03A4
+L043E:	ldx     #$00
+	lda     #$EA
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03A4
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L03A4:	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosdiveax
+	ldy     #$0A
+	jsr     staxysp
+	cpx     #$00
+	bne     L043F
+	cmp     #$02
+	beq     L03A5
+L043F:	ldx     #$00
+	lda     #$EB
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03A5
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L03A5:	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosudivax
+	ldy     #$0A
+	jsr     staxysp
+	cpx     #$00
+	bne     L0440
+	cmp     #$02
+	beq     L03A6
+L0440:	ldx     #$00
+	lda     #$EC
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03A6
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L03A6:	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosdivax
+	ldy     #$0A
+	jsr     staxysp
+	cpx     #$00
+	bne     L0441
+	cmp     #$02
+	beq     L03A7
+L0441:	ldx     #$00
+	lda     #$ED
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03A7
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L03A7:	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosdivax
+	ldy     #$0A
+	jsr     staxysp
+	cpx     #$00
+	bne     L0442
+	cmp     #$02
+	beq     L03A8
+L0442:	ldx     #$00
+	lda     #$EE
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03A8
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L03A8:	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$22
+	lda     (sp),y
+	jsr     tosdiva0
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L0443
+	cmp     #$02
+	beq     L03A9
+L0443:	ldx     #$00
+	lda     #$EF
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03A9
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L03A9:	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosdivax
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L0444
+	cmp     #$02
+	beq     L03AA
+L0444:	ldx     #$00
+	lda     #$F0
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03AA
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L03AA:	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosdivax
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L0445
+	cmp     #$02
+	beq     L03AB
+L0445:	ldx     #$00
+	lda     #$F1
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03AB
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L03AB:	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosdiveax
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L0446
+	cmp     #$02
+	beq     L03AC
+L0446:	ldx     #$00
+	lda     #$F2
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03AC
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L03AC:	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosudivax
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L0447
+	cmp     #$02
+	beq     L03AD
+L0447:	ldx     #$00
+	lda     #$F3
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03AD
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L03AD:	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosdivax
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L0448
+	cmp     #$02
+	beq     L03AE
+L0448:	ldx     #$00
+	lda     #$F4
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03AE
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L03AE:	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosdivax
+	ldy     #$06
+	jsr     staxysp
+	cpx     #$00
+	bne     L0449
+	cmp     #$02
+	beq     L03AF
+L0449:	ldx     #$00
+	lda     #$F5
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03AF
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L03AF:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	lda     #$02
+	dey
+	sta     (sp),y
+	iny
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$22
+	lda     (sp),y
+	jsr     tosumoda0
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$01
+	beq     L03B0
+	ldx     #$00
+	lda     #$F6
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03B0
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L03B0:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosmodax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$01
+	beq     L03B1
+	ldx     #$00
+	lda     #$F7
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03B1
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L03B1:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosmodax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$01
+	beq     L03B2
+	ldx     #$00
+	lda     #$F8
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03B2
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L03B2:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosmodeax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$01
+	beq     L03B3
+	ldx     #$00
+	lda     #$F9
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03B3
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L03B3:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosumodax
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$01
+	beq     L03B4
+	lda     #$FA
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03B4
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L03B4:	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	iny
+	jsr     pushwysp
+	ldy     #$22
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosmoda0
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L044A
+	cmp     #$01
+	beq     L03B5
+L044A:	ldx     #$00
+	lda     #$FB
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03B5
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L03B5:	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosmodax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L044B
+	cmp     #$01
+	beq     L03B6
+L044B:	ldx     #$00
+	lda     #$FC
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03B6
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L03B6:	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosmodax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L044C
+	cmp     #$01
+	beq     L03B7
+L044C:	ldx     #$00
+	lda     #$FD
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03B7
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L03B7:	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosmodeax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L044D
+	cmp     #$01
+	beq     L03B8
+L044D:	ldx     #$00
+	lda     #$FE
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L03B8
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L03B8:	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosumodax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L044E
+	cmp     #$01
+	beq     L02B6
+L044E:	ldx     #$00
+	lda     #$FF
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L02B6
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L02B6:	ldy     #$24
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L02B9
+	ldx     #$00
+	lda     #$01
+	ldy     #$22
+	jsr     staxysp
+	ldy     #$29
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L044F
+	cmp     #$00
+	beq     L02B9
+L044F:	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L02B9:	ldy     #$23
+	jsr     ldaxysp
+	ldy     #$2A
+	jmp     addysp
+
+.segment	"DATA"
+
+M0001:
+	.byte	$4C,$6F,$63,$61,$6C,$20,$65,$72,$72,$6F,$72,$20,$25,$64,$2E,$0A
+	.byte	$00
+M0002:
+	.byte	$73,$37,$31,$34,$2C,$65,$72,$25,$64,$0A,$00
+M0003:
+	.byte	$73,$37,$31,$34,$20,$20,$20,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ section (int j, void *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_section: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$02
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	bne     L0003
+	jsr     ldax0sp
+	jsr     _s714
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	ldx     #$00
+	lda     #$01
+	sta     M0001+14
+	stz     M0001+14+1
+	sta     M0001+16
+	stz     M0001+16+1
+	sta     M0001+18
+	stz     M0001+18+1
+	sta     M0001+20
+	stz     M0001+20+1
+	lda     #>(M0001)
+	sta     M0002+1
+	lda     #<(M0001)
+	sta     M0002
+	txa
+	jsr     stax0sp
+	bra     L0002
+L0005:	jsr     pushw0sp
+	lda     M0002
+	ldx     M0002+1
+	jsr     _section
+	sta     M0001+22
+	stx     M0001+22+1
+	lda     M0001+24
+	clc
+	adc     M0001+22
+	sta     M0001+24
+	lda     M0001+24+1
+	adc     M0001+22+1
+	sta     M0001+24+1
+	lda     M0001+14
+	ora     M0001+14+1
+	beq     L0007
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     #<(M0001+26)
+	ldx     #>(M0001+26)
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+L0007:	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+L0002:	jsr     ldax0sp
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	bmi     L0005
+	lda     M0001+24
+	ora     M0001+24+1
+	bne     L0009
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	bra     L000E
+L0009:	lda     #<(S0006)
+	ldx     #>(S0006)
+L000E:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     M0001+24
+	ldx     M0001+24+1
+	jmp     incsp6
+
+.segment	"BSS"
+
+M0001:
+	.res	34,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
@@ -0,0 +1,11625 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "cq714.c", 34247, 1613073744
+	.dbg		file, "common.h", 522, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/stdlib.h", 5999, 1613073744
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_lbits
+	.export		_ubits
+	.export		_fbits
+	.export		_dbits
+	.export		_flgs
+	.export		_flgm
+	.export		_flgd
+	.export		_flgl
+	.export		_rrc
+	.export		_crc
+	.export		_rfs
+	.export		_s714
+	.export		_section
+	.export		_main
+
+.segment	"RODATA"
+
+S0004:
+	.byte	$53,$65,$63,$74,$69,$6F,$6E,$20,$25,$73,$20,$72,$65,$74,$75,$72
+	.byte	$6E,$65,$64,$20,$25,$64,$2E,$0A,$00
+S0005:
+	.byte	$0A,$4E,$6F,$20,$65,$72,$72,$6F,$72,$73,$20,$64,$65,$74,$65,$63
+	.byte	$74,$65,$64,$2E,$0A,$00
+S0006:
+	.byte	$0A,$46,$61,$69,$6C,$65,$64,$2E,$0A,$00
+
+.segment	"BSS"
+
+_lbits:
+	.res	2,$00
+_ubits:
+	.res	2,$00
+_fbits:
+	.res	2,$00
+_dbits:
+	.res	2,$00
+_flgs:
+	.res	2,$00
+_flgm:
+	.res	2,$00
+_flgd:
+	.res	2,$00
+_flgl:
+	.res	2,$00
+_rrc:
+	.res	2,$00
+_crc:
+	.res	2,$00
+_rfs:
+	.res	8,$00
+
+; ---------------------------------------------------------------
+; int __near__ s714 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s714: near
+
+	.dbg	func, "s714", "00", extern, "_s714"
+	.dbg	sym, "pd0", "00", auto, 0
+	.dbg	sym, "prlc", "00", auto, -2
+	.dbg	sym, "lrc", "00", auto, -4
+	.dbg	sym, "rc", "00", auto, -6
+	.dbg	sym, "cl", "00", auto, -7
+	.dbg	sym, "cr", "00", auto, -8
+	.dbg	sym, "sl", "00", auto, -10
+	.dbg	sym, "sr", "00", auto, -12
+	.dbg	sym, "il", "00", auto, -14
+	.dbg	sym, "ir", "00", auto, -16
+	.dbg	sym, "ll", "00", auto, -20
+	.dbg	sym, "lr", "00", auto, -24
+	.dbg	sym, "ul", "00", auto, -26
+	.dbg	sym, "ur", "00", auto, -28
+	.dbg	sym, "fl", "00", auto, -30
+	.dbg	sym, "fr", "00", auto, -32
+	.dbg	sym, "dl", "00", auto, -34
+	.dbg	sym, "dr", "00", auto, -36
+	.dbg	sym, "ps", "00", auto, -38
+	.dbg	sym, "pt", "00", auto, -40
+
+.segment	"CODE"
+
+	.dbg	line, "cq714.c", 51
+	jsr     pushax
+	.dbg	line, "cq714.c", 71
+	ldy     #$28
+	jsr     subysp
+	lda     #<(M0003)
+	ldx     #>(M0003)
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "cq714.c", 72
+	ldy     #$29
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     incaxy
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "cq714.c", 73
+	ldx     #$00
+	lda     #$00
+	ldy     #$22
+	jsr     staxysp
+	.dbg	line, "cq714.c", 74
+	ldx     #$00
+	lda     #$00
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 75
+	ldy     #$29
+	jsr     ldaxysp
+	ldy     #$15
+	jsr     ldaxidx
+	ldy     #$26
+	jsr     staxysp
+	.dbg	line, "cq714.c", 76
+	jmp     L0002
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$00
+	jsr     staspidx
+	tax
+	php
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	jne     L0002
+	.dbg	line, "cq714.c", 122
+	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714.c", 123
+	ldy     #$20
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714.c", 124
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$02
+	jsr     boolne
+	jeq     L0006
+	.dbg	line, "cq714.c", 125
+	ldx     #$00
+	lda     #$01
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 126
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0006
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 128
+L0006:	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 129
+	ldy     #$1C
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714.c", 130
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$02
+	jsr     boolne
+	jeq     L0008
+	.dbg	line, "cq714.c", 131
+	ldx     #$00
+	lda     #$02
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 132
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0008
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 134
+L0008:	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714.c", 135
+	ldy     #$18
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714.c", 136
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$02
+	jsr     boolne
+	jeq     L000A
+	.dbg	line, "cq714.c", 137
+	ldx     #$00
+	lda     #$03
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 138
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L000A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 140
+L000A:	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 141
+	ldy     #$10
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714.c", 142
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$02
+	jsr     boolne
+	jeq     L000C
+	.dbg	line, "cq714.c", 143
+	ldx     #$00
+	lda     #$04
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 144
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L000C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 146
+L000C:	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 147
+	ldy     #$0C
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714.c", 148
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$02
+	jsr     boolne
+	jeq     L000E
+	.dbg	line, "cq714.c", 149
+	ldx     #$00
+	lda     #$05
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 150
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L000E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 152
+L000E:	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "cq714.c", 153
+	ldy     #$08
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714.c", 154
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$02
+	jsr     boolne
+	jeq     L0010
+	.dbg	line, "cq714.c", 155
+	ldx     #$00
+	lda     #$06
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 156
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0010
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 158
+L0010:	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq714.c", 159
+	ldy     #$04
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714.c", 160
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$02
+	jsr     boolne
+	jeq     L0012
+	.dbg	line, "cq714.c", 161
+	ldx     #$00
+	lda     #$07
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 162
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0012
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 164
+L0012:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714.c", 165
+	ldy     #$20
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714.c", 166
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0014
+	cmp     #$02
+L0014:	jsr     boolne
+	jeq     L0015
+	.dbg	line, "cq714.c", 167
+	ldx     #$00
+	lda     #$08
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 168
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0015
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 170
+L0015:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 171
+	ldy     #$1D
+	jsr     ldaxysp
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714.c", 172
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0017
+	cmp     #$02
+L0017:	jsr     boolne
+	jeq     L0018
+	.dbg	line, "cq714.c", 173
+	ldx     #$00
+	lda     #$09
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 174
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0018
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 176
+L0018:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714.c", 177
+	ldy     #$19
+	jsr     ldaxysp
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714.c", 178
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L001A
+	cmp     #$02
+L001A:	jsr     boolne
+	jeq     L001B
+	.dbg	line, "cq714.c", 179
+	ldx     #$00
+	lda     #$0A
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 180
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L001B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 182
+L001B:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 183
+	ldy     #$11
+	jsr     ldaxysp
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714.c", 184
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L001D
+	cmp     #$02
+L001D:	jsr     boolne
+	jeq     L001E
+	.dbg	line, "cq714.c", 185
+	ldx     #$00
+	lda     #$0B
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 186
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L001E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 188
+L001E:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 189
+	ldy     #$0D
+	jsr     ldaxysp
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714.c", 190
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0020
+	cmp     #$02
+L0020:	jsr     boolne
+	jeq     L0021
+	.dbg	line, "cq714.c", 191
+	ldx     #$00
+	lda     #$0C
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 192
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0021
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 194
+L0021:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "cq714.c", 195
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714.c", 196
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0023
+	cmp     #$02
+L0023:	jsr     boolne
+	jeq     L0024
+	.dbg	line, "cq714.c", 197
+	ldx     #$00
+	lda     #$0D
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 198
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0024
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 200
+L0024:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq714.c", 201
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714.c", 202
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0026
+	cmp     #$02
+L0026:	jsr     boolne
+	jeq     L0027
+	.dbg	line, "cq714.c", 203
+	ldx     #$00
+	lda     #$0E
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 204
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0027
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 206
+L0027:	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714.c", 207
+	ldy     #$20
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714.c", 208
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0029
+	cmp     #$02
+L0029:	jsr     boolne
+	jeq     L002A
+	.dbg	line, "cq714.c", 209
+	ldx     #$00
+	lda     #$0F
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 210
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L002A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 212
+L002A:	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 213
+	ldy     #$1D
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714.c", 214
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L002C
+	cmp     #$02
+L002C:	jsr     boolne
+	jeq     L002D
+	.dbg	line, "cq714.c", 215
+	ldx     #$00
+	lda     #$10
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 216
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L002D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 218
+L002D:	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714.c", 219
+	ldy     #$19
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714.c", 220
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L002F
+	cmp     #$02
+L002F:	jsr     boolne
+	jeq     L0030
+	.dbg	line, "cq714.c", 221
+	ldx     #$00
+	lda     #$11
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 222
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0030
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 224
+L0030:	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 225
+	ldy     #$11
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714.c", 226
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0032
+	cmp     #$02
+L0032:	jsr     boolne
+	jeq     L0033
+	.dbg	line, "cq714.c", 227
+	ldx     #$00
+	lda     #$12
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 228
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0033
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 230
+L0033:	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 231
+	ldy     #$0D
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714.c", 232
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0035
+	cmp     #$02
+L0035:	jsr     boolne
+	jeq     L0036
+	.dbg	line, "cq714.c", 233
+	ldx     #$00
+	lda     #$13
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 234
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0036
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 236
+L0036:	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "cq714.c", 237
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714.c", 238
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0038
+	cmp     #$02
+L0038:	jsr     boolne
+	jeq     L0039
+	.dbg	line, "cq714.c", 239
+	ldx     #$00
+	lda     #$14
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 240
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0039
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 242
+L0039:	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq714.c", 243
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714.c", 244
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L003B
+	cmp     #$02
+L003B:	jsr     boolne
+	jeq     L003C
+	.dbg	line, "cq714.c", 245
+	ldx     #$00
+	lda     #$15
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 246
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L003C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 248
+L003C:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714.c", 249
+	ldy     #$20
+	ldx     #$00
+	lda     (sp),y
+	jsr     axulong
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 250
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	jeq     L003E
+	.dbg	line, "cq714.c", 251
+	ldx     #$00
+	lda     #$16
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 252
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L003E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 254
+L003E:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 255
+	ldy     #$1D
+	jsr     ldaxysp
+	jsr     axlong
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 256
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	jeq     L0040
+	.dbg	line, "cq714.c", 257
+	ldx     #$00
+	lda     #$17
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 258
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0040
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 260
+L0040:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714.c", 261
+	ldy     #$19
+	jsr     ldaxysp
+	jsr     axlong
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 262
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	jeq     L0042
+	.dbg	line, "cq714.c", 263
+	ldx     #$00
+	lda     #$18
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 264
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0042
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 266
+L0042:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 267
+	ldy     #$13
+	jsr     ldeaxysp
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 268
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	jeq     L0044
+	.dbg	line, "cq714.c", 269
+	ldx     #$00
+	lda     #$19
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 270
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0044
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 272
+L0044:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 273
+	ldy     #$0D
+	jsr     ldaxysp
+	jsr     axulong
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 274
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	jeq     L0046
+	.dbg	line, "cq714.c", 275
+	ldx     #$00
+	lda     #$1A
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 276
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0046
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 278
+L0046:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "cq714.c", 279
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     axlong
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 280
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	jeq     L0048
+	.dbg	line, "cq714.c", 281
+	ldx     #$00
+	lda     #$1B
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 282
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0048
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 284
+L0048:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq714.c", 285
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     axlong
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 286
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	jeq     L004A
+	.dbg	line, "cq714.c", 287
+	ldx     #$00
+	lda     #$1C
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 288
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L004A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 290
+L004A:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714.c", 291
+	ldy     #$20
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714.c", 292
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L004C
+	cmp     #$02
+L004C:	jsr     boolne
+	jeq     L004D
+	.dbg	line, "cq714.c", 293
+	ldx     #$00
+	lda     #$1D
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 294
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L004D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 296
+L004D:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 297
+	ldy     #$1D
+	jsr     ldaxysp
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714.c", 298
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L004F
+	cmp     #$02
+L004F:	jsr     boolne
+	jeq     L0050
+	.dbg	line, "cq714.c", 299
+	ldx     #$00
+	lda     #$1E
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 300
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0050
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 302
+L0050:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714.c", 303
+	ldy     #$19
+	jsr     ldaxysp
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714.c", 304
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0052
+	cmp     #$02
+L0052:	jsr     boolne
+	jeq     L0053
+	.dbg	line, "cq714.c", 305
+	ldx     #$00
+	lda     #$1F
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 306
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0053
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 308
+L0053:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 309
+	ldy     #$11
+	jsr     ldaxysp
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714.c", 310
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0055
+	cmp     #$02
+L0055:	jsr     boolne
+	jeq     L0056
+	.dbg	line, "cq714.c", 311
+	ldx     #$00
+	lda     #$20
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 312
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0056
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 314
+L0056:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 315
+	ldy     #$0D
+	jsr     ldaxysp
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714.c", 316
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0058
+	cmp     #$02
+L0058:	jsr     boolne
+	jeq     L0059
+	.dbg	line, "cq714.c", 317
+	ldx     #$00
+	lda     #$21
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 318
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0059
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 320
+L0059:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "cq714.c", 321
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714.c", 322
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L005B
+	cmp     #$02
+L005B:	jsr     boolne
+	jeq     L005C
+	.dbg	line, "cq714.c", 323
+	ldx     #$00
+	lda     #$22
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 324
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L005C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 326
+L005C:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq714.c", 327
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714.c", 328
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L005E
+	cmp     #$02
+L005E:	jsr     boolne
+	jeq     L005F
+	.dbg	line, "cq714.c", 329
+	ldx     #$00
+	lda     #$23
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 330
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L005F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 332
+L005F:	ldx     #$00
+	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714.c", 333
+	ldy     #$20
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$0A
+	jsr     staxysp
+	.dbg	line, "cq714.c", 334
+	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0061
+	cmp     #$02
+L0061:	jsr     boolne
+	jeq     L0062
+	.dbg	line, "cq714.c", 335
+	ldx     #$00
+	lda     #$24
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 336
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0062
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 338
+L0062:	ldx     #$00
+	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 339
+	ldy     #$1D
+	jsr     ldaxysp
+	ldy     #$0A
+	jsr     staxysp
+	.dbg	line, "cq714.c", 340
+	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0064
+	cmp     #$02
+L0064:	jsr     boolne
+	jeq     L0065
+	.dbg	line, "cq714.c", 341
+	ldx     #$00
+	lda     #$25
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 342
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0065
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 344
+L0065:	ldx     #$00
+	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714.c", 345
+	ldy     #$19
+	jsr     ldaxysp
+	ldy     #$0A
+	jsr     staxysp
+	.dbg	line, "cq714.c", 346
+	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0067
+	cmp     #$02
+L0067:	jsr     boolne
+	jeq     L0068
+	.dbg	line, "cq714.c", 347
+	ldx     #$00
+	lda     #$26
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 348
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0068
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 350
+L0068:	ldx     #$00
+	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 351
+	ldy     #$11
+	jsr     ldaxysp
+	ldy     #$0A
+	jsr     staxysp
+	.dbg	line, "cq714.c", 352
+	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L006A
+	cmp     #$02
+L006A:	jsr     boolne
+	jeq     L006B
+	.dbg	line, "cq714.c", 353
+	ldx     #$00
+	lda     #$27
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 354
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L006B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 356
+L006B:	ldx     #$00
+	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 357
+	ldy     #$0D
+	jsr     ldaxysp
+	ldy     #$0A
+	jsr     staxysp
+	.dbg	line, "cq714.c", 358
+	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L006D
+	cmp     #$02
+L006D:	jsr     boolne
+	jeq     L006E
+	.dbg	line, "cq714.c", 359
+	ldx     #$00
+	lda     #$28
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 360
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L006E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 362
+L006E:	ldx     #$00
+	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "cq714.c", 363
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$0A
+	jsr     staxysp
+	.dbg	line, "cq714.c", 364
+	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0070
+	cmp     #$02
+L0070:	jsr     boolne
+	jeq     L0071
+	.dbg	line, "cq714.c", 365
+	ldx     #$00
+	lda     #$29
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 366
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0071
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 368
+L0071:	ldx     #$00
+	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq714.c", 369
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$0A
+	jsr     staxysp
+	.dbg	line, "cq714.c", 370
+	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0073
+	cmp     #$02
+L0073:	jsr     boolne
+	jeq     L0074
+	.dbg	line, "cq714.c", 371
+	ldx     #$00
+	lda     #$2A
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 372
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0074
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 374
+L0074:	ldx     #$00
+	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714.c", 375
+	ldy     #$20
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$06
+	jsr     staxysp
+	.dbg	line, "cq714.c", 376
+	ldy     #$07
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0076
+	cmp     #$02
+L0076:	jsr     boolne
+	jeq     L0077
+	.dbg	line, "cq714.c", 377
+	ldx     #$00
+	lda     #$2B
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 378
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0077
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 380
+L0077:	ldx     #$00
+	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 381
+	ldy     #$1D
+	jsr     ldaxysp
+	ldy     #$06
+	jsr     staxysp
+	.dbg	line, "cq714.c", 382
+	ldy     #$07
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0079
+	cmp     #$02
+L0079:	jsr     boolne
+	jeq     L007A
+	.dbg	line, "cq714.c", 383
+	ldx     #$00
+	lda     #$2C
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 384
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L007A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 386
+L007A:	ldx     #$00
+	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714.c", 387
+	ldy     #$19
+	jsr     ldaxysp
+	ldy     #$06
+	jsr     staxysp
+	.dbg	line, "cq714.c", 388
+	ldy     #$07
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L007C
+	cmp     #$02
+L007C:	jsr     boolne
+	jeq     L007D
+	.dbg	line, "cq714.c", 389
+	ldx     #$00
+	lda     #$2D
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 390
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L007D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 392
+L007D:	ldx     #$00
+	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 393
+	ldy     #$11
+	jsr     ldaxysp
+	ldy     #$06
+	jsr     staxysp
+	.dbg	line, "cq714.c", 394
+	ldy     #$07
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L007F
+	cmp     #$02
+L007F:	jsr     boolne
+	jeq     L0080
+	.dbg	line, "cq714.c", 395
+	ldx     #$00
+	lda     #$2E
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 396
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0080
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 398
+L0080:	ldx     #$00
+	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 399
+	ldy     #$0D
+	jsr     ldaxysp
+	ldy     #$06
+	jsr     staxysp
+	.dbg	line, "cq714.c", 400
+	ldy     #$07
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0082
+	cmp     #$02
+L0082:	jsr     boolne
+	jeq     L0083
+	.dbg	line, "cq714.c", 401
+	ldx     #$00
+	lda     #$2F
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 402
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0083
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 404
+L0083:	ldx     #$00
+	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "cq714.c", 405
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$06
+	jsr     staxysp
+	.dbg	line, "cq714.c", 406
+	ldy     #$07
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0085
+	cmp     #$02
+L0085:	jsr     boolne
+	jeq     L0086
+	.dbg	line, "cq714.c", 407
+	ldx     #$00
+	lda     #$30
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 408
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0086
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 410
+L0086:	ldx     #$00
+	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq714.c", 411
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$06
+	jsr     staxysp
+	.dbg	line, "cq714.c", 412
+	ldy     #$07
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0088
+	cmp     #$02
+L0088:	jsr     boolne
+	jeq     L0089
+	.dbg	line, "cq714.c", 413
+	ldx     #$00
+	lda     #$31
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 414
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0089
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 416
+L0089:	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714.c", 417
+	ldy     #$20
+	ldx     #$00
+	lda     (sp),y
+	ldx     #$00
+	ldy     #$21
+	ldx     #$00
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	.dbg	line, "cq714.c", 418
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$07
+	jsr     boolne
+	jeq     L008B
+	.dbg	line, "cq714.c", 419
+	ldx     #$00
+	lda     #$32
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 420
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L008B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 422
+L008B:	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 423
+	ldy     #$1D
+	jsr     ldaxysp
+	ldx     #$00
+	ldy     #$21
+	ldx     #$00
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	.dbg	line, "cq714.c", 424
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$07
+	jsr     boolne
+	jeq     L008D
+	.dbg	line, "cq714.c", 425
+	ldx     #$00
+	lda     #$33
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 426
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L008D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 428
+L008D:	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714.c", 429
+	ldy     #$19
+	jsr     ldaxysp
+	ldx     #$00
+	ldy     #$21
+	ldx     #$00
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	.dbg	line, "cq714.c", 430
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$07
+	jsr     boolne
+	jeq     L008F
+	.dbg	line, "cq714.c", 431
+	ldx     #$00
+	lda     #$34
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 432
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L008F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 434
+L008F:	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 435
+	ldy     #$13
+	jsr     ldeaxysp
+	ldx     #$00
+	ldy     #$21
+	ldx     #$00
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	.dbg	line, "cq714.c", 436
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$07
+	jsr     boolne
+	jeq     L0091
+	.dbg	line, "cq714.c", 437
+	ldx     #$00
+	lda     #$35
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 438
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0091
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 440
+L0091:	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 441
+	ldy     #$0D
+	jsr     ldaxysp
+	ldx     #$00
+	ldy     #$21
+	ldx     #$00
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	.dbg	line, "cq714.c", 442
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$07
+	jsr     boolne
+	jeq     L0093
+	.dbg	line, "cq714.c", 443
+	ldx     #$00
+	lda     #$36
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 444
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0093
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 446
+L0093:	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "cq714.c", 447
+	ldy     #$09
+	jsr     ldaxysp
+	ldx     #$00
+	ldy     #$21
+	ldx     #$00
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	.dbg	line, "cq714.c", 448
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$07
+	jsr     boolne
+	jeq     L0095
+	.dbg	line, "cq714.c", 449
+	ldx     #$00
+	lda     #$37
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 450
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0095
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 452
+L0095:	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq714.c", 453
+	ldy     #$05
+	jsr     ldaxysp
+	ldx     #$00
+	ldy     #$21
+	ldx     #$00
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	.dbg	line, "cq714.c", 454
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$07
+	jsr     boolne
+	jeq     L0097
+	.dbg	line, "cq714.c", 455
+	ldx     #$00
+	lda     #$38
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 456
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0097
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 458
+L0097:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714.c", 459
+	ldy     #$20
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$1E
+	jsr     addeqysp
+	.dbg	line, "cq714.c", 460
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0099
+	cmp     #$07
+L0099:	jsr     boolne
+	jeq     L009A
+	.dbg	line, "cq714.c", 461
+	ldx     #$00
+	lda     #$39
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 462
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L009A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 464
+L009A:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 465
+	ldy     #$1D
+	jsr     ldaxysp
+	ldy     #$1E
+	jsr     addeqysp
+	.dbg	line, "cq714.c", 466
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L009C
+	cmp     #$07
+L009C:	jsr     boolne
+	jeq     L009D
+	.dbg	line, "cq714.c", 467
+	ldx     #$00
+	lda     #$3A
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 468
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L009D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 470
+L009D:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714.c", 471
+	ldy     #$19
+	jsr     ldaxysp
+	ldy     #$1E
+	jsr     addeqysp
+	.dbg	line, "cq714.c", 472
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L009F
+	cmp     #$07
+L009F:	jsr     boolne
+	jeq     L00A0
+	.dbg	line, "cq714.c", 473
+	ldx     #$00
+	lda     #$3B
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 474
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00A0
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 476
+L00A0:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 477
+	ldy     #$13
+	jsr     ldeaxysp
+	ldy     #$1E
+	jsr     addeqysp
+	.dbg	line, "cq714.c", 478
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00A2
+	cmp     #$07
+L00A2:	jsr     boolne
+	jeq     L00A3
+	.dbg	line, "cq714.c", 479
+	ldx     #$00
+	lda     #$3C
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 480
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00A3
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 482
+L00A3:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 483
+	ldy     #$0D
+	jsr     ldaxysp
+	ldy     #$1E
+	jsr     addeqysp
+	.dbg	line, "cq714.c", 484
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00A5
+	cmp     #$07
+L00A5:	jsr     boolne
+	jeq     L00A6
+	.dbg	line, "cq714.c", 485
+	ldx     #$00
+	lda     #$3D
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 486
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00A6
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 488
+L00A6:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "cq714.c", 489
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$1E
+	jsr     addeqysp
+	.dbg	line, "cq714.c", 490
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00A8
+	cmp     #$07
+L00A8:	jsr     boolne
+	jeq     L00A9
+	.dbg	line, "cq714.c", 491
+	ldx     #$00
+	lda     #$3E
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 492
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00A9
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 494
+L00A9:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq714.c", 495
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$1E
+	jsr     addeqysp
+	.dbg	line, "cq714.c", 496
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00AB
+	cmp     #$07
+L00AB:	jsr     boolne
+	jeq     L00AC
+	.dbg	line, "cq714.c", 497
+	ldx     #$00
+	lda     #$3F
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 498
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00AC
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 500
+L00AC:	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714.c", 501
+	ldy     #$20
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$1A
+	jsr     addeqysp
+	.dbg	line, "cq714.c", 502
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00AE
+	cmp     #$07
+L00AE:	jsr     boolne
+	jeq     L00AF
+	.dbg	line, "cq714.c", 503
+	ldx     #$00
+	lda     #$40
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 504
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00AF
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 506
+L00AF:	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 507
+	ldy     #$1D
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     addeqysp
+	.dbg	line, "cq714.c", 508
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00B1
+	cmp     #$07
+L00B1:	jsr     boolne
+	jeq     L00B2
+	.dbg	line, "cq714.c", 509
+	ldx     #$00
+	lda     #$41
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 510
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00B2
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 512
+L00B2:	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714.c", 513
+	ldy     #$19
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     addeqysp
+	.dbg	line, "cq714.c", 514
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00B4
+	cmp     #$07
+L00B4:	jsr     boolne
+	jeq     L00B5
+	.dbg	line, "cq714.c", 515
+	ldx     #$00
+	lda     #$42
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 516
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00B5
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 518
+L00B5:	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 519
+	ldy     #$13
+	jsr     ldeaxysp
+	ldy     #$1A
+	jsr     addeqysp
+	.dbg	line, "cq714.c", 520
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00B7
+	cmp     #$07
+L00B7:	jsr     boolne
+	jeq     L00B8
+	.dbg	line, "cq714.c", 521
+	ldx     #$00
+	lda     #$43
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 522
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00B8
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 524
+L00B8:	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 525
+	ldy     #$0D
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     addeqysp
+	.dbg	line, "cq714.c", 526
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00BA
+	cmp     #$07
+L00BA:	jsr     boolne
+	jeq     L00BB
+	.dbg	line, "cq714.c", 527
+	ldx     #$00
+	lda     #$44
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 528
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00BB
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 530
+L00BB:	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "cq714.c", 531
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     addeqysp
+	.dbg	line, "cq714.c", 532
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00BD
+	cmp     #$07
+L00BD:	jsr     boolne
+	jeq     L00BE
+	.dbg	line, "cq714.c", 533
+	ldx     #$00
+	lda     #$45
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 534
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00BE
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 536
+L00BE:	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq714.c", 537
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     addeqysp
+	.dbg	line, "cq714.c", 538
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00C0
+	cmp     #$07
+L00C0:	jsr     boolne
+	jeq     L00C1
+	.dbg	line, "cq714.c", 539
+	ldx     #$00
+	lda     #$46
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 540
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00C1
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 542
+L00C1:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714.c", 543
+	ldy     #$20
+	ldx     #$00
+	lda     (sp),y
+	jsr     axulong
+	ldy     #$14
+	jsr     laddeqysp
+	.dbg	line, "cq714.c", 544
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$07
+	jsr     tosneeax
+	jeq     L00C3
+	.dbg	line, "cq714.c", 545
+	ldx     #$00
+	lda     #$47
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 546
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00C3
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 548
+L00C3:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 549
+	ldy     #$1D
+	jsr     ldaxysp
+	jsr     axlong
+	ldy     #$14
+	jsr     laddeqysp
+	.dbg	line, "cq714.c", 550
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$07
+	jsr     tosneeax
+	jeq     L00C5
+	.dbg	line, "cq714.c", 551
+	ldx     #$00
+	lda     #$48
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 552
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00C5
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 554
+L00C5:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714.c", 555
+	ldy     #$19
+	jsr     ldaxysp
+	jsr     axlong
+	ldy     #$14
+	jsr     laddeqysp
+	.dbg	line, "cq714.c", 556
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$07
+	jsr     tosneeax
+	jeq     L00C7
+	.dbg	line, "cq714.c", 557
+	ldx     #$00
+	lda     #$49
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 558
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00C7
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 560
+L00C7:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 561
+	ldy     #$13
+	jsr     ldeaxysp
+	ldy     #$14
+	jsr     laddeqysp
+	.dbg	line, "cq714.c", 562
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$07
+	jsr     tosneeax
+	jeq     L00C9
+	.dbg	line, "cq714.c", 563
+	ldx     #$00
+	lda     #$4A
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 564
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00C9
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 566
+L00C9:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 567
+	ldy     #$0D
+	jsr     ldaxysp
+	jsr     axulong
+	ldy     #$14
+	jsr     laddeqysp
+	.dbg	line, "cq714.c", 568
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$07
+	jsr     tosneeax
+	jeq     L00CB
+	.dbg	line, "cq714.c", 569
+	ldx     #$00
+	lda     #$4B
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 570
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00CB
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 572
+L00CB:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "cq714.c", 573
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     axlong
+	ldy     #$14
+	jsr     laddeqysp
+	.dbg	line, "cq714.c", 574
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$07
+	jsr     tosneeax
+	jeq     L00CD
+	.dbg	line, "cq714.c", 575
+	ldx     #$00
+	lda     #$4C
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 576
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00CD
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 578
+L00CD:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq714.c", 579
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     axlong
+	ldy     #$14
+	jsr     laddeqysp
+	.dbg	line, "cq714.c", 580
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$07
+	jsr     tosneeax
+	jeq     L00CF
+	.dbg	line, "cq714.c", 581
+	ldx     #$00
+	lda     #$4D
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 582
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00CF
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 584
+L00CF:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714.c", 585
+	ldy     #$20
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$0E
+	jsr     addeqysp
+	.dbg	line, "cq714.c", 586
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00D1
+	cmp     #$07
+L00D1:	jsr     boolne
+	jeq     L00D2
+	.dbg	line, "cq714.c", 587
+	ldx     #$00
+	lda     #$4E
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 588
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00D2
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 590
+L00D2:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 591
+	ldy     #$1D
+	jsr     ldaxysp
+	ldy     #$0E
+	jsr     addeqysp
+	.dbg	line, "cq714.c", 592
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00D4
+	cmp     #$07
+L00D4:	jsr     boolne
+	jeq     L00D5
+	.dbg	line, "cq714.c", 593
+	ldx     #$00
+	lda     #$4F
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 594
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00D5
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 596
+L00D5:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714.c", 597
+	ldy     #$19
+	jsr     ldaxysp
+	ldy     #$0E
+	jsr     addeqysp
+	.dbg	line, "cq714.c", 598
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00D7
+	cmp     #$07
+L00D7:	jsr     boolne
+	jeq     L00D8
+	.dbg	line, "cq714.c", 599
+	ldx     #$00
+	lda     #$50
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 600
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00D8
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 602
+L00D8:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 603
+	ldy     #$13
+	jsr     ldeaxysp
+	ldy     #$0E
+	jsr     addeqysp
+	.dbg	line, "cq714.c", 604
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00DA
+	cmp     #$07
+L00DA:	jsr     boolne
+	jeq     L00DB
+	.dbg	line, "cq714.c", 605
+	ldx     #$00
+	lda     #$51
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 606
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00DB
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 608
+L00DB:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 609
+	ldy     #$0D
+	jsr     ldaxysp
+	ldy     #$0E
+	jsr     addeqysp
+	.dbg	line, "cq714.c", 610
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00DD
+	cmp     #$07
+L00DD:	jsr     boolne
+	jeq     L00DE
+	.dbg	line, "cq714.c", 611
+	ldx     #$00
+	lda     #$52
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 612
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00DE
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 614
+L00DE:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "cq714.c", 615
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$0E
+	jsr     addeqysp
+	.dbg	line, "cq714.c", 616
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00E0
+	cmp     #$07
+L00E0:	jsr     boolne
+	jeq     L00E1
+	.dbg	line, "cq714.c", 617
+	ldx     #$00
+	lda     #$53
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 618
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00E1
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 620
+L00E1:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq714.c", 621
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$0E
+	jsr     addeqysp
+	.dbg	line, "cq714.c", 622
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00E3
+	cmp     #$07
+L00E3:	jsr     boolne
+	jeq     L00E4
+	.dbg	line, "cq714.c", 623
+	ldx     #$00
+	lda     #$54
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 624
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00E4
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 626
+L00E4:	ldx     #$00
+	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714.c", 627
+	ldy     #$20
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$0A
+	jsr     addeqysp
+	.dbg	line, "cq714.c", 628
+	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00E6
+	cmp     #$07
+L00E6:	jsr     boolne
+	jeq     L00E7
+	.dbg	line, "cq714.c", 629
+	ldx     #$00
+	lda     #$55
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 630
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00E7
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 632
+L00E7:	ldx     #$00
+	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 633
+	ldy     #$1D
+	jsr     ldaxysp
+	ldy     #$0A
+	jsr     addeqysp
+	.dbg	line, "cq714.c", 634
+	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00E9
+	cmp     #$07
+L00E9:	jsr     boolne
+	jeq     L00EA
+	.dbg	line, "cq714.c", 635
+	ldx     #$00
+	lda     #$56
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 636
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00EA
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 638
+L00EA:	ldx     #$00
+	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714.c", 639
+	ldy     #$19
+	jsr     ldaxysp
+	ldy     #$0A
+	jsr     addeqysp
+	.dbg	line, "cq714.c", 640
+	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00EC
+	cmp     #$07
+L00EC:	jsr     boolne
+	jeq     L00ED
+	.dbg	line, "cq714.c", 641
+	ldx     #$00
+	lda     #$57
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 642
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00ED
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 644
+L00ED:	ldx     #$00
+	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 645
+	ldy     #$13
+	jsr     ldeaxysp
+	ldy     #$0A
+	jsr     addeqysp
+	.dbg	line, "cq714.c", 646
+	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00EF
+	cmp     #$07
+L00EF:	jsr     boolne
+	jeq     L00F0
+	.dbg	line, "cq714.c", 647
+	ldx     #$00
+	lda     #$58
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 648
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00F0
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 650
+L00F0:	ldx     #$00
+	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 651
+	ldy     #$0D
+	jsr     ldaxysp
+	ldy     #$0A
+	jsr     addeqysp
+	.dbg	line, "cq714.c", 652
+	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00F2
+	cmp     #$07
+L00F2:	jsr     boolne
+	jeq     L00F3
+	.dbg	line, "cq714.c", 653
+	ldx     #$00
+	lda     #$59
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 654
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00F3
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 656
+L00F3:	ldx     #$00
+	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "cq714.c", 657
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$0A
+	jsr     addeqysp
+	.dbg	line, "cq714.c", 658
+	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00F5
+	cmp     #$07
+L00F5:	jsr     boolne
+	jeq     L00F6
+	.dbg	line, "cq714.c", 659
+	ldx     #$00
+	lda     #$5A
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 660
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00F6
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 662
+L00F6:	ldx     #$00
+	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq714.c", 663
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$0A
+	jsr     addeqysp
+	.dbg	line, "cq714.c", 664
+	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00F8
+	cmp     #$07
+L00F8:	jsr     boolne
+	jeq     L00F9
+	.dbg	line, "cq714.c", 665
+	ldx     #$00
+	lda     #$5B
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 666
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00F9
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 668
+L00F9:	ldx     #$00
+	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714.c", 669
+	ldy     #$20
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$06
+	jsr     addeqysp
+	.dbg	line, "cq714.c", 670
+	ldy     #$07
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00FB
+	cmp     #$07
+L00FB:	jsr     boolne
+	jeq     L00FC
+	.dbg	line, "cq714.c", 671
+	ldx     #$00
+	lda     #$5C
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 672
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00FC
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 674
+L00FC:	ldx     #$00
+	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 675
+	ldy     #$1D
+	jsr     ldaxysp
+	ldy     #$06
+	jsr     addeqysp
+	.dbg	line, "cq714.c", 676
+	ldy     #$07
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00FE
+	cmp     #$07
+L00FE:	jsr     boolne
+	jeq     L00FF
+	.dbg	line, "cq714.c", 677
+	ldx     #$00
+	lda     #$5D
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 678
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00FF
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 680
+L00FF:	ldx     #$00
+	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714.c", 681
+	ldy     #$19
+	jsr     ldaxysp
+	ldy     #$06
+	jsr     addeqysp
+	.dbg	line, "cq714.c", 682
+	ldy     #$07
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0101
+	cmp     #$07
+L0101:	jsr     boolne
+	jeq     L0102
+	.dbg	line, "cq714.c", 683
+	ldx     #$00
+	lda     #$5E
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 684
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0102
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 686
+L0102:	ldx     #$00
+	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 687
+	ldy     #$13
+	jsr     ldeaxysp
+	ldy     #$06
+	jsr     addeqysp
+	.dbg	line, "cq714.c", 688
+	ldy     #$07
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0104
+	cmp     #$07
+L0104:	jsr     boolne
+	jeq     L0105
+	.dbg	line, "cq714.c", 689
+	ldx     #$00
+	lda     #$5F
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 690
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0105
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 692
+L0105:	ldx     #$00
+	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 693
+	ldy     #$0D
+	jsr     ldaxysp
+	ldy     #$06
+	jsr     addeqysp
+	.dbg	line, "cq714.c", 694
+	ldy     #$07
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0107
+	cmp     #$07
+L0107:	jsr     boolne
+	jeq     L0108
+	.dbg	line, "cq714.c", 695
+	ldx     #$00
+	lda     #$60
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 696
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0108
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 698
+L0108:	ldx     #$00
+	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "cq714.c", 699
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$06
+	jsr     addeqysp
+	.dbg	line, "cq714.c", 700
+	ldy     #$07
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L010A
+	cmp     #$07
+L010A:	jsr     boolne
+	jeq     L010B
+	.dbg	line, "cq714.c", 701
+	ldx     #$00
+	lda     #$61
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 702
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L010B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 704
+L010B:	ldx     #$00
+	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq714.c", 705
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$06
+	jsr     addeqysp
+	.dbg	line, "cq714.c", 706
+	ldy     #$07
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L010D
+	cmp     #$07
+L010D:	jsr     boolne
+	jeq     L010E
+	.dbg	line, "cq714.c", 707
+	ldx     #$00
+	lda     #$62
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 708
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L010E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 710
+L010E:	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714.c", 711
+	ldy     #$20
+	ldx     #$00
+	lda     (sp),y
+	ldx     #$00
+	ldy     #$21
+	ldx     #$00
+	eor     #$FF
+	sec
+	adc     (sp),y
+	sta     (sp),y
+	.dbg	line, "cq714.c", 712
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$03
+	jsr     boolne
+	jeq     L0110
+	.dbg	line, "cq714.c", 713
+	ldx     #$00
+	lda     #$63
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 714
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0110
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 716
+L0110:	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 717
+	ldy     #$1D
+	jsr     ldaxysp
+	ldx     #$00
+	ldy     #$21
+	ldx     #$00
+	eor     #$FF
+	sec
+	adc     (sp),y
+	sta     (sp),y
+	.dbg	line, "cq714.c", 718
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$03
+	jsr     boolne
+	jeq     L0112
+	.dbg	line, "cq714.c", 719
+	ldx     #$00
+	lda     #$64
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 720
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0112
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 722
+L0112:	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714.c", 723
+	ldy     #$19
+	jsr     ldaxysp
+	ldx     #$00
+	ldy     #$21
+	ldx     #$00
+	eor     #$FF
+	sec
+	adc     (sp),y
+	sta     (sp),y
+	.dbg	line, "cq714.c", 724
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$03
+	jsr     boolne
+	jeq     L0114
+	.dbg	line, "cq714.c", 725
+	ldx     #$00
+	lda     #$65
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 726
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0114
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 728
+L0114:	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 729
+	ldy     #$13
+	jsr     ldeaxysp
+	ldx     #$00
+	ldy     #$21
+	ldx     #$00
+	eor     #$FF
+	sec
+	adc     (sp),y
+	sta     (sp),y
+	.dbg	line, "cq714.c", 730
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$03
+	jsr     boolne
+	jeq     L0116
+	.dbg	line, "cq714.c", 731
+	ldx     #$00
+	lda     #$66
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 732
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0116
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 734
+L0116:	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 735
+	ldy     #$0D
+	jsr     ldaxysp
+	ldx     #$00
+	ldy     #$21
+	ldx     #$00
+	eor     #$FF
+	sec
+	adc     (sp),y
+	sta     (sp),y
+	.dbg	line, "cq714.c", 736
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$03
+	jsr     boolne
+	jeq     L0118
+	.dbg	line, "cq714.c", 737
+	ldx     #$00
+	lda     #$67
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 738
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0118
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 740
+L0118:	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "cq714.c", 741
+	ldy     #$09
+	jsr     ldaxysp
+	ldx     #$00
+	ldy     #$21
+	ldx     #$00
+	eor     #$FF
+	sec
+	adc     (sp),y
+	sta     (sp),y
+	.dbg	line, "cq714.c", 742
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$03
+	jsr     boolne
+	jeq     L011A
+	.dbg	line, "cq714.c", 743
+	ldx     #$00
+	lda     #$68
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 744
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L011A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 746
+L011A:	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq714.c", 747
+	ldy     #$05
+	jsr     ldaxysp
+	ldx     #$00
+	ldy     #$21
+	ldx     #$00
+	eor     #$FF
+	sec
+	adc     (sp),y
+	sta     (sp),y
+	.dbg	line, "cq714.c", 748
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$03
+	jsr     boolne
+	jeq     L011C
+	.dbg	line, "cq714.c", 749
+	ldx     #$00
+	lda     #$69
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 750
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L011C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 752
+L011C:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714.c", 753
+	ldy     #$20
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$1E
+	jsr     subeqysp
+	.dbg	line, "cq714.c", 754
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L011E
+	cmp     #$03
+L011E:	jsr     boolne
+	jeq     L011F
+	.dbg	line, "cq714.c", 755
+	ldx     #$00
+	lda     #$6A
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 756
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L011F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 758
+L011F:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 759
+	ldy     #$1D
+	jsr     ldaxysp
+	ldy     #$1E
+	jsr     subeqysp
+	.dbg	line, "cq714.c", 760
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0121
+	cmp     #$03
+L0121:	jsr     boolne
+	jeq     L0122
+	.dbg	line, "cq714.c", 761
+	ldx     #$00
+	lda     #$6B
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 762
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0122
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 764
+L0122:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714.c", 765
+	ldy     #$19
+	jsr     ldaxysp
+	ldy     #$1E
+	jsr     subeqysp
+	.dbg	line, "cq714.c", 766
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0124
+	cmp     #$03
+L0124:	jsr     boolne
+	jeq     L0125
+	.dbg	line, "cq714.c", 767
+	ldx     #$00
+	lda     #$6C
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 768
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0125
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 770
+L0125:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 771
+	ldy     #$13
+	jsr     ldeaxysp
+	ldy     #$1E
+	jsr     subeqysp
+	.dbg	line, "cq714.c", 772
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0127
+	cmp     #$03
+L0127:	jsr     boolne
+	jeq     L0128
+	.dbg	line, "cq714.c", 773
+	ldx     #$00
+	lda     #$6D
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 774
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0128
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 776
+L0128:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 777
+	ldy     #$0D
+	jsr     ldaxysp
+	ldy     #$1E
+	jsr     subeqysp
+	.dbg	line, "cq714.c", 778
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L012A
+	cmp     #$03
+L012A:	jsr     boolne
+	jeq     L012B
+	.dbg	line, "cq714.c", 779
+	ldx     #$00
+	lda     #$6E
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 780
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L012B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 782
+L012B:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "cq714.c", 783
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$1E
+	jsr     subeqysp
+	.dbg	line, "cq714.c", 784
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L012D
+	cmp     #$03
+L012D:	jsr     boolne
+	jeq     L012E
+	.dbg	line, "cq714.c", 785
+	ldx     #$00
+	lda     #$6F
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 786
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L012E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 788
+L012E:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq714.c", 789
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$1E
+	jsr     subeqysp
+	.dbg	line, "cq714.c", 790
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0130
+	cmp     #$03
+L0130:	jsr     boolne
+	jeq     L0131
+	.dbg	line, "cq714.c", 791
+	ldx     #$00
+	lda     #$70
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 792
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0131
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 794
+L0131:	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714.c", 795
+	ldy     #$20
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$1A
+	jsr     subeqysp
+	.dbg	line, "cq714.c", 796
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0133
+	cmp     #$03
+L0133:	jsr     boolne
+	jeq     L0134
+	.dbg	line, "cq714.c", 797
+	ldx     #$00
+	lda     #$71
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 798
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0134
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 800
+L0134:	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 801
+	ldy     #$1D
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     subeqysp
+	.dbg	line, "cq714.c", 802
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0136
+	cmp     #$03
+L0136:	jsr     boolne
+	jeq     L0137
+	.dbg	line, "cq714.c", 803
+	ldx     #$00
+	lda     #$72
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 804
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0137
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 806
+L0137:	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714.c", 807
+	ldy     #$19
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     subeqysp
+	.dbg	line, "cq714.c", 808
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0139
+	cmp     #$03
+L0139:	jsr     boolne
+	jeq     L013A
+	.dbg	line, "cq714.c", 809
+	ldx     #$00
+	lda     #$73
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 810
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L013A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 812
+L013A:	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 813
+	ldy     #$13
+	jsr     ldeaxysp
+	ldy     #$1A
+	jsr     subeqysp
+	.dbg	line, "cq714.c", 814
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L013C
+	cmp     #$03
+L013C:	jsr     boolne
+	jeq     L013D
+	.dbg	line, "cq714.c", 815
+	ldx     #$00
+	lda     #$74
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 816
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L013D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 818
+L013D:	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 819
+	ldy     #$0D
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     subeqysp
+	.dbg	line, "cq714.c", 820
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L013F
+	cmp     #$03
+L013F:	jsr     boolne
+	jeq     L0140
+	.dbg	line, "cq714.c", 821
+	ldx     #$00
+	lda     #$75
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 822
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0140
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 824
+L0140:	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "cq714.c", 825
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     subeqysp
+	.dbg	line, "cq714.c", 826
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0142
+	cmp     #$03
+L0142:	jsr     boolne
+	jeq     L0143
+	.dbg	line, "cq714.c", 827
+	ldx     #$00
+	lda     #$76
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 828
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0143
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 830
+L0143:	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq714.c", 831
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     subeqysp
+	.dbg	line, "cq714.c", 832
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0145
+	cmp     #$03
+L0145:	jsr     boolne
+	jeq     L0146
+	.dbg	line, "cq714.c", 833
+	ldx     #$00
+	lda     #$77
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 834
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0146
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 836
+L0146:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714.c", 837
+	ldy     #$20
+	ldx     #$00
+	lda     (sp),y
+	jsr     axulong
+	ldy     #$14
+	jsr     lsubeqysp
+	.dbg	line, "cq714.c", 838
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$03
+	jsr     tosneeax
+	jeq     L0148
+	.dbg	line, "cq714.c", 839
+	ldx     #$00
+	lda     #$78
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 840
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0148
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 842
+L0148:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 843
+	ldy     #$1D
+	jsr     ldaxysp
+	jsr     axlong
+	ldy     #$14
+	jsr     lsubeqysp
+	.dbg	line, "cq714.c", 844
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$03
+	jsr     tosneeax
+	jeq     L014A
+	.dbg	line, "cq714.c", 845
+	ldx     #$00
+	lda     #$79
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 846
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L014A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 848
+L014A:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714.c", 849
+	ldy     #$19
+	jsr     ldaxysp
+	jsr     axlong
+	ldy     #$14
+	jsr     lsubeqysp
+	.dbg	line, "cq714.c", 850
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$03
+	jsr     tosneeax
+	jeq     L014C
+	.dbg	line, "cq714.c", 851
+	ldx     #$00
+	lda     #$7A
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 852
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L014C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 854
+L014C:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 855
+	ldy     #$13
+	jsr     ldeaxysp
+	ldy     #$14
+	jsr     lsubeqysp
+	.dbg	line, "cq714.c", 856
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$03
+	jsr     tosneeax
+	jeq     L014E
+	.dbg	line, "cq714.c", 857
+	ldx     #$00
+	lda     #$7B
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 858
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L014E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 860
+L014E:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 861
+	ldy     #$0D
+	jsr     ldaxysp
+	jsr     axulong
+	ldy     #$14
+	jsr     lsubeqysp
+	.dbg	line, "cq714.c", 862
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$03
+	jsr     tosneeax
+	jeq     L0150
+	.dbg	line, "cq714.c", 863
+	ldx     #$00
+	lda     #$7C
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 864
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0150
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 866
+L0150:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "cq714.c", 867
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     axlong
+	ldy     #$14
+	jsr     lsubeqysp
+	.dbg	line, "cq714.c", 868
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$03
+	jsr     tosneeax
+	jeq     L0152
+	.dbg	line, "cq714.c", 869
+	ldx     #$00
+	lda     #$7D
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 870
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0152
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 872
+L0152:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq714.c", 873
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     axlong
+	ldy     #$14
+	jsr     lsubeqysp
+	.dbg	line, "cq714.c", 874
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$03
+	jsr     tosneeax
+	jeq     L0154
+	.dbg	line, "cq714.c", 875
+	ldx     #$00
+	lda     #$7E
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 876
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0154
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 878
+L0154:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714.c", 879
+	ldy     #$20
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$0E
+	jsr     subeqysp
+	.dbg	line, "cq714.c", 880
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0156
+	cmp     #$03
+L0156:	jsr     boolne
+	jeq     L0157
+	.dbg	line, "cq714.c", 881
+	ldx     #$00
+	lda     #$7F
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 882
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0157
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 884
+L0157:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 885
+	ldy     #$1D
+	jsr     ldaxysp
+	ldy     #$0E
+	jsr     subeqysp
+	.dbg	line, "cq714.c", 886
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0159
+	cmp     #$03
+L0159:	jsr     boolne
+	jeq     L015A
+	.dbg	line, "cq714.c", 887
+	ldx     #$00
+	lda     #$80
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 888
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L015A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 890
+L015A:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714.c", 891
+	ldy     #$19
+	jsr     ldaxysp
+	ldy     #$0E
+	jsr     subeqysp
+	.dbg	line, "cq714.c", 892
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L015C
+	cmp     #$03
+L015C:	jsr     boolne
+	jeq     L015D
+	.dbg	line, "cq714.c", 893
+	ldx     #$00
+	lda     #$81
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 894
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L015D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 896
+L015D:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 897
+	ldy     #$13
+	jsr     ldeaxysp
+	ldy     #$0E
+	jsr     subeqysp
+	.dbg	line, "cq714.c", 898
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L015F
+	cmp     #$03
+L015F:	jsr     boolne
+	jeq     L0160
+	.dbg	line, "cq714.c", 899
+	ldx     #$00
+	lda     #$82
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 900
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0160
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 902
+L0160:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 903
+	ldy     #$0D
+	jsr     ldaxysp
+	ldy     #$0E
+	jsr     subeqysp
+	.dbg	line, "cq714.c", 904
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0162
+	cmp     #$03
+L0162:	jsr     boolne
+	jeq     L0163
+	.dbg	line, "cq714.c", 905
+	ldx     #$00
+	lda     #$83
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 906
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0163
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 908
+L0163:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "cq714.c", 909
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$0E
+	jsr     subeqysp
+	.dbg	line, "cq714.c", 910
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0165
+	cmp     #$03
+L0165:	jsr     boolne
+	jeq     L0166
+	.dbg	line, "cq714.c", 911
+	ldx     #$00
+	lda     #$84
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 912
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0166
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 914
+L0166:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq714.c", 915
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$0E
+	jsr     subeqysp
+	.dbg	line, "cq714.c", 916
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0168
+	cmp     #$03
+L0168:	jsr     boolne
+	jeq     L0169
+	.dbg	line, "cq714.c", 917
+	ldx     #$00
+	lda     #$85
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 918
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0169
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 920
+L0169:	ldx     #$00
+	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714.c", 921
+	ldy     #$20
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$0A
+	jsr     subeqysp
+	.dbg	line, "cq714.c", 922
+	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L016B
+	cmp     #$03
+L016B:	jsr     boolne
+	jeq     L016C
+	.dbg	line, "cq714.c", 923
+	ldx     #$00
+	lda     #$86
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 924
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L016C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 926
+L016C:	ldx     #$00
+	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 927
+	ldy     #$1D
+	jsr     ldaxysp
+	ldy     #$0A
+	jsr     subeqysp
+	.dbg	line, "cq714.c", 928
+	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L016E
+	cmp     #$03
+L016E:	jsr     boolne
+	jeq     L016F
+	.dbg	line, "cq714.c", 929
+	ldx     #$00
+	lda     #$87
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 930
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L016F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 932
+L016F:	ldx     #$00
+	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714.c", 933
+	ldy     #$19
+	jsr     ldaxysp
+	ldy     #$0A
+	jsr     subeqysp
+	.dbg	line, "cq714.c", 934
+	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0171
+	cmp     #$03
+L0171:	jsr     boolne
+	jeq     L0172
+	.dbg	line, "cq714.c", 935
+	ldx     #$00
+	lda     #$88
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 936
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0172
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 938
+L0172:	ldx     #$00
+	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 939
+	ldy     #$13
+	jsr     ldeaxysp
+	ldy     #$0A
+	jsr     subeqysp
+	.dbg	line, "cq714.c", 940
+	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0174
+	cmp     #$03
+L0174:	jsr     boolne
+	jeq     L0175
+	.dbg	line, "cq714.c", 941
+	ldx     #$00
+	lda     #$89
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 942
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0175
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 944
+L0175:	ldx     #$00
+	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 945
+	ldy     #$0D
+	jsr     ldaxysp
+	ldy     #$0A
+	jsr     subeqysp
+	.dbg	line, "cq714.c", 946
+	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0177
+	cmp     #$03
+L0177:	jsr     boolne
+	jeq     L0178
+	.dbg	line, "cq714.c", 947
+	ldx     #$00
+	lda     #$8A
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 948
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0178
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 950
+L0178:	ldx     #$00
+	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "cq714.c", 951
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$0A
+	jsr     subeqysp
+	.dbg	line, "cq714.c", 952
+	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L017A
+	cmp     #$03
+L017A:	jsr     boolne
+	jeq     L017B
+	.dbg	line, "cq714.c", 953
+	ldx     #$00
+	lda     #$8B
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 954
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L017B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 956
+L017B:	ldx     #$00
+	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq714.c", 957
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$0A
+	jsr     subeqysp
+	.dbg	line, "cq714.c", 958
+	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L017D
+	cmp     #$03
+L017D:	jsr     boolne
+	jeq     L017E
+	.dbg	line, "cq714.c", 959
+	ldx     #$00
+	lda     #$8C
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 960
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L017E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 962
+L017E:	ldx     #$00
+	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714.c", 963
+	ldy     #$20
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$06
+	jsr     subeqysp
+	.dbg	line, "cq714.c", 964
+	ldy     #$07
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0180
+	cmp     #$03
+L0180:	jsr     boolne
+	jeq     L0181
+	.dbg	line, "cq714.c", 965
+	ldx     #$00
+	lda     #$8D
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 966
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0181
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 968
+L0181:	ldx     #$00
+	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 969
+	ldy     #$1D
+	jsr     ldaxysp
+	ldy     #$06
+	jsr     subeqysp
+	.dbg	line, "cq714.c", 970
+	ldy     #$07
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0183
+	cmp     #$03
+L0183:	jsr     boolne
+	jeq     L0184
+	.dbg	line, "cq714.c", 971
+	ldx     #$00
+	lda     #$8E
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 972
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0184
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 974
+L0184:	ldx     #$00
+	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714.c", 975
+	ldy     #$19
+	jsr     ldaxysp
+	ldy     #$06
+	jsr     subeqysp
+	.dbg	line, "cq714.c", 976
+	ldy     #$07
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0186
+	cmp     #$03
+L0186:	jsr     boolne
+	jeq     L0187
+	.dbg	line, "cq714.c", 977
+	ldx     #$00
+	lda     #$8F
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 978
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0187
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 980
+L0187:	ldx     #$00
+	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 981
+	ldy     #$13
+	jsr     ldeaxysp
+	ldy     #$06
+	jsr     subeqysp
+	.dbg	line, "cq714.c", 982
+	ldy     #$07
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0189
+	cmp     #$03
+L0189:	jsr     boolne
+	jeq     L018A
+	.dbg	line, "cq714.c", 983
+	ldx     #$00
+	lda     #$90
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 984
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L018A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 986
+L018A:	ldx     #$00
+	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 987
+	ldy     #$0D
+	jsr     ldaxysp
+	ldy     #$06
+	jsr     subeqysp
+	.dbg	line, "cq714.c", 988
+	ldy     #$07
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L018C
+	cmp     #$03
+L018C:	jsr     boolne
+	jeq     L018D
+	.dbg	line, "cq714.c", 989
+	ldx     #$00
+	lda     #$91
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 990
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L018D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 992
+L018D:	ldx     #$00
+	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "cq714.c", 993
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$06
+	jsr     subeqysp
+	.dbg	line, "cq714.c", 994
+	ldy     #$07
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L018F
+	cmp     #$03
+L018F:	jsr     boolne
+	jeq     L0190
+	.dbg	line, "cq714.c", 995
+	ldx     #$00
+	lda     #$92
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 996
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0190
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 998
+L0190:	ldx     #$00
+	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq714.c", 999
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$06
+	jsr     subeqysp
+	.dbg	line, "cq714.c", 1000
+	ldy     #$07
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0192
+	cmp     #$03
+L0192:	jsr     boolne
+	jeq     L0193
+	.dbg	line, "cq714.c", 1001
+	ldx     #$00
+	lda     #$93
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1002
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0193
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1004
+L0193:	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714.c", 1005
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$22
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosumulax
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714.c", 1006
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$0A
+	jsr     boolne
+	jeq     L0195
+	.dbg	line, "cq714.c", 1007
+	ldx     #$00
+	lda     #$94
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1008
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0195
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1010
+L0195:	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1011
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosmulax
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714.c", 1012
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$0A
+	jsr     boolne
+	jeq     L0197
+	.dbg	line, "cq714.c", 1013
+	ldx     #$00
+	lda     #$95
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1014
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0197
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1016
+L0197:	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1017
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosmulax
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714.c", 1018
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$0A
+	jsr     boolne
+	jeq     L0199
+	.dbg	line, "cq714.c", 1019
+	ldx     #$00
+	lda     #$96
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1020
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0199
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1022
+L0199:	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 1023
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosmuleax
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714.c", 1024
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$0A
+	jsr     boolne
+	jeq     L019B
+	.dbg	line, "cq714.c", 1025
+	ldx     #$00
+	lda     #$97
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1026
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L019B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1028
+L019B:	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1029
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosumulax
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714.c", 1030
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$0A
+	jsr     boolne
+	jeq     L019D
+	.dbg	line, "cq714.c", 1031
+	ldx     #$00
+	lda     #$98
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1032
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L019D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1034
+L019D:	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1035
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosmulax
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714.c", 1036
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$0A
+	jsr     boolne
+	jeq     L019F
+	.dbg	line, "cq714.c", 1037
+	ldx     #$00
+	lda     #$99
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1038
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L019F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1040
+L019F:	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1041
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosmulax
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714.c", 1042
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$0A
+	jsr     boolne
+	jeq     L01A1
+	.dbg	line, "cq714.c", 1043
+	ldx     #$00
+	lda     #$9A
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1044
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L01A1
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1046
+L01A1:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714.c", 1047
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$22
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosmulax
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1048
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L01A3
+	cmp     #$0A
+L01A3:	jsr     boolne
+	jeq     L01A4
+	.dbg	line, "cq714.c", 1049
+	ldx     #$00
+	lda     #$9B
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1050
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L01A4
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1052
+L01A4:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1053
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosmulax
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1054
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L01A6
+	cmp     #$0A
+L01A6:	jsr     boolne
+	jeq     L01A7
+	.dbg	line, "cq714.c", 1055
+	ldx     #$00
+	lda     #$9C
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1056
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L01A7
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1058
+L01A7:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1059
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosmulax
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1060
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L01A9
+	cmp     #$0A
+L01A9:	jsr     boolne
+	jeq     L01AA
+	.dbg	line, "cq714.c", 1061
+	ldx     #$00
+	lda     #$9D
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1062
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L01AA
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1064
+L01AA:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 1065
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosmuleax
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1066
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L01AC
+	cmp     #$0A
+L01AC:	jsr     boolne
+	jeq     L01AD
+	.dbg	line, "cq714.c", 1067
+	ldx     #$00
+	lda     #$9E
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1068
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L01AD
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1070
+L01AD:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1071
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosumulax
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1072
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L01AF
+	cmp     #$0A
+L01AF:	jsr     boolne
+	jeq     L01B0
+	.dbg	line, "cq714.c", 1073
+	ldx     #$00
+	lda     #$9F
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1074
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L01B0
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1076
+L01B0:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1077
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosmulax
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1078
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L01B2
+	cmp     #$0A
+L01B2:	jsr     boolne
+	jeq     L01B3
+	.dbg	line, "cq714.c", 1079
+	ldx     #$00
+	lda     #$A0
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1080
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L01B3
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1082
+L01B3:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1083
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosmulax
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1084
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L01B5
+	cmp     #$0A
+L01B5:	jsr     boolne
+	jeq     L01B6
+	.dbg	line, "cq714.c", 1085
+	ldx     #$00
+	lda     #$A1
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1086
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L01B6
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1088
+L01B6:	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714.c", 1089
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$22
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosmulax
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1090
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L01B8
+	cmp     #$0A
+L01B8:	jsr     boolne
+	jeq     L01B9
+	.dbg	line, "cq714.c", 1091
+	ldx     #$00
+	lda     #$A2
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1092
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L01B9
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1094
+L01B9:	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1095
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosmulax
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1096
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L01BB
+	cmp     #$0A
+L01BB:	jsr     boolne
+	jeq     L01BC
+	.dbg	line, "cq714.c", 1097
+	ldx     #$00
+	lda     #$A3
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1098
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L01BC
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1100
+L01BC:	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1101
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosmulax
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1102
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L01BE
+	cmp     #$0A
+L01BE:	jsr     boolne
+	jeq     L01BF
+	.dbg	line, "cq714.c", 1103
+	ldx     #$00
+	lda     #$A4
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1104
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L01BF
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1106
+L01BF:	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 1107
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosmuleax
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1108
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L01C1
+	cmp     #$0A
+L01C1:	jsr     boolne
+	jeq     L01C2
+	.dbg	line, "cq714.c", 1109
+	ldx     #$00
+	lda     #$A5
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1110
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L01C2
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1112
+L01C2:	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1113
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosumulax
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1114
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L01C4
+	cmp     #$0A
+L01C4:	jsr     boolne
+	jeq     L01C5
+	.dbg	line, "cq714.c", 1115
+	ldx     #$00
+	lda     #$A6
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1116
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L01C5
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1118
+L01C5:	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1119
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosmulax
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1120
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L01C7
+	cmp     #$0A
+L01C7:	jsr     boolne
+	jeq     L01C8
+	.dbg	line, "cq714.c", 1121
+	ldx     #$00
+	lda     #$A7
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1122
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L01C8
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1124
+L01C8:	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1125
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosmulax
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1126
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L01CA
+	cmp     #$0A
+L01CA:	jsr     boolne
+	jeq     L01CB
+	.dbg	line, "cq714.c", 1127
+	ldx     #$00
+	lda     #$A8
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1128
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L01CB
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1130
+L01CB:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714.c", 1131
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$24
+	ldx     #$00
+	lda     (sp),y
+	jsr     axulong
+	jsr     tosmuleax
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 1132
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0A
+	jsr     tosneeax
+	jeq     L01CD
+	.dbg	line, "cq714.c", 1133
+	ldx     #$00
+	lda     #$A9
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1134
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L01CD
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1136
+L01CD:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1137
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$21
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosmuleax
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 1138
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0A
+	jsr     tosneeax
+	jeq     L01CF
+	.dbg	line, "cq714.c", 1139
+	ldx     #$00
+	lda     #$AA
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1140
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L01CF
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1142
+L01CF:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1143
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$1D
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosmuleax
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 1144
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0A
+	jsr     tosneeax
+	jeq     L01D1
+	.dbg	line, "cq714.c", 1145
+	ldx     #$00
+	lda     #$AB
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1146
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L01D1
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1148
+L01D1:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 1149
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     tosmuleax
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 1150
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0A
+	jsr     tosneeax
+	jeq     L01D3
+	.dbg	line, "cq714.c", 1151
+	ldx     #$00
+	lda     #$AC
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1152
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L01D3
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1154
+L01D3:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1155
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axulong
+	jsr     tosmuleax
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 1156
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0A
+	jsr     tosneeax
+	jeq     L01D5
+	.dbg	line, "cq714.c", 1157
+	ldx     #$00
+	lda     #$AD
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1158
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L01D5
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1160
+L01D5:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1161
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0D
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosmuleax
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 1162
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0A
+	jsr     tosneeax
+	jeq     L01D7
+	.dbg	line, "cq714.c", 1163
+	ldx     #$00
+	lda     #$AE
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1164
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L01D7
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1166
+L01D7:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1167
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosmuleax
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 1168
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0A
+	jsr     tosneeax
+	jeq     L01D9
+	.dbg	line, "cq714.c", 1169
+	ldx     #$00
+	lda     #$AF
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1170
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L01D9
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1172
+L01D9:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714.c", 1173
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$22
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosumulax
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1174
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L01DB
+	cmp     #$0A
+L01DB:	jsr     boolne
+	jeq     L01DC
+	.dbg	line, "cq714.c", 1175
+	ldx     #$00
+	lda     #$B0
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1176
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L01DC
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1178
+L01DC:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1179
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosumulax
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1180
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L01DE
+	cmp     #$0A
+L01DE:	jsr     boolne
+	jeq     L01DF
+	.dbg	line, "cq714.c", 1181
+	ldx     #$00
+	lda     #$B1
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1182
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L01DF
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1184
+L01DF:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1185
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosumulax
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1186
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L01E1
+	cmp     #$0A
+L01E1:	jsr     boolne
+	jeq     L01E2
+	.dbg	line, "cq714.c", 1187
+	ldx     #$00
+	lda     #$B2
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1188
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L01E2
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1190
+L01E2:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 1191
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosmuleax
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1192
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L01E4
+	cmp     #$0A
+L01E4:	jsr     boolne
+	jeq     L01E5
+	.dbg	line, "cq714.c", 1193
+	ldx     #$00
+	lda     #$B3
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1194
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L01E5
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1196
+L01E5:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1197
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosumulax
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1198
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L01E7
+	cmp     #$0A
+L01E7:	jsr     boolne
+	jeq     L01E8
+	.dbg	line, "cq714.c", 1199
+	ldx     #$00
+	lda     #$B4
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1200
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L01E8
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1202
+L01E8:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1203
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosumulax
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1204
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L01EA
+	cmp     #$0A
+L01EA:	jsr     boolne
+	jeq     L01EB
+	.dbg	line, "cq714.c", 1205
+	ldx     #$00
+	lda     #$B5
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1206
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L01EB
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1208
+L01EB:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1209
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosumulax
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1210
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L01ED
+	cmp     #$0A
+L01ED:	jsr     boolne
+	jeq     L01EE
+	.dbg	line, "cq714.c", 1211
+	ldx     #$00
+	lda     #$B6
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1212
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L01EE
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1214
+L01EE:	ldx     #$00
+	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714.c", 1215
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$22
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosmulax
+	ldy     #$0A
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1216
+	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L01F0
+	cmp     #$0A
+L01F0:	jsr     boolne
+	jeq     L01F1
+	.dbg	line, "cq714.c", 1217
+	ldx     #$00
+	lda     #$B7
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1218
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L01F1
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1220
+L01F1:	ldx     #$00
+	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1221
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosmulax
+	ldy     #$0A
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1222
+	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L01F3
+	cmp     #$0A
+L01F3:	jsr     boolne
+	jeq     L01F4
+	.dbg	line, "cq714.c", 1223
+	ldx     #$00
+	lda     #$B8
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1224
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L01F4
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1226
+L01F4:	ldx     #$00
+	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1227
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosmulax
+	ldy     #$0A
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1228
+	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L01F6
+	cmp     #$0A
+L01F6:	jsr     boolne
+	jeq     L01F7
+	.dbg	line, "cq714.c", 1229
+	ldx     #$00
+	lda     #$B9
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1230
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L01F7
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1232
+L01F7:	ldx     #$00
+	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 1233
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosmuleax
+	ldy     #$0A
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1234
+	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L01F9
+	cmp     #$0A
+L01F9:	jsr     boolne
+	jeq     L01FA
+	.dbg	line, "cq714.c", 1235
+	ldx     #$00
+	lda     #$BA
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1236
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L01FA
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1238
+L01FA:	ldx     #$00
+	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1239
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosumulax
+	ldy     #$0A
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1240
+	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L01FC
+	cmp     #$0A
+L01FC:	jsr     boolne
+	jeq     L01FD
+	.dbg	line, "cq714.c", 1241
+	ldx     #$00
+	lda     #$BB
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1242
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L01FD
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1244
+L01FD:	ldx     #$00
+	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1245
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosmulax
+	ldy     #$0A
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1246
+	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L01FF
+	cmp     #$0A
+L01FF:	jsr     boolne
+	jeq     L0200
+	.dbg	line, "cq714.c", 1247
+	ldx     #$00
+	lda     #$BC
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1248
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0200
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1250
+L0200:	ldx     #$00
+	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1251
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosmulax
+	ldy     #$0A
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1252
+	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0202
+	cmp     #$0A
+L0202:	jsr     boolne
+	jeq     L0203
+	.dbg	line, "cq714.c", 1253
+	ldx     #$00
+	lda     #$BD
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1254
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0203
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1256
+L0203:	ldx     #$00
+	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714.c", 1257
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$22
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosmulax
+	ldy     #$06
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1258
+	ldy     #$07
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0205
+	cmp     #$0A
+L0205:	jsr     boolne
+	jeq     L0206
+	.dbg	line, "cq714.c", 1259
+	ldx     #$00
+	lda     #$BE
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1260
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0206
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1262
+L0206:	ldx     #$00
+	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1263
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosmulax
+	ldy     #$06
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1264
+	ldy     #$07
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0208
+	cmp     #$0A
+L0208:	jsr     boolne
+	jeq     L0209
+	.dbg	line, "cq714.c", 1265
+	ldx     #$00
+	lda     #$BF
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1266
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0209
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1268
+L0209:	ldx     #$00
+	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1269
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosmulax
+	ldy     #$06
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1270
+	ldy     #$07
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L020B
+	cmp     #$0A
+L020B:	jsr     boolne
+	jeq     L020C
+	.dbg	line, "cq714.c", 1271
+	ldx     #$00
+	lda     #$C0
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1272
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L020C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1274
+L020C:	ldx     #$00
+	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 1275
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosmuleax
+	ldy     #$06
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1276
+	ldy     #$07
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L020E
+	cmp     #$0A
+L020E:	jsr     boolne
+	jeq     L020F
+	.dbg	line, "cq714.c", 1277
+	ldx     #$00
+	lda     #$C1
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1278
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L020F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1280
+L020F:	ldx     #$00
+	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1281
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosumulax
+	ldy     #$06
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1282
+	ldy     #$07
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0211
+	cmp     #$0A
+L0211:	jsr     boolne
+	jeq     L0212
+	.dbg	line, "cq714.c", 1283
+	ldx     #$00
+	lda     #$C2
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1284
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0212
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1286
+L0212:	ldx     #$00
+	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1287
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosmulax
+	ldy     #$06
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1288
+	ldy     #$07
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0214
+	cmp     #$0A
+L0214:	jsr     boolne
+	jeq     L0215
+	.dbg	line, "cq714.c", 1289
+	ldx     #$00
+	lda     #$C3
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1290
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0215
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1292
+L0215:	ldx     #$00
+	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1293
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosmulax
+	ldy     #$06
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1294
+	ldy     #$07
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0217
+	cmp     #$0A
+L0217:	jsr     boolne
+	jeq     L0218
+	.dbg	line, "cq714.c", 1295
+	ldx     #$00
+	lda     #$C4
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1296
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0218
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1298
+L0218:	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714.c", 1299
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$22
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosudivax
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714.c", 1300
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$02
+	jsr     boolne
+	jeq     L021A
+	.dbg	line, "cq714.c", 1301
+	ldx     #$00
+	lda     #$C5
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1302
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L021A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1304
+L021A:	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1305
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosdivax
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714.c", 1306
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$02
+	jsr     boolne
+	jeq     L021C
+	.dbg	line, "cq714.c", 1307
+	ldx     #$00
+	lda     #$C6
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1308
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L021C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1310
+L021C:	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1311
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosdivax
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714.c", 1312
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$02
+	jsr     boolne
+	jeq     L021E
+	.dbg	line, "cq714.c", 1313
+	ldx     #$00
+	lda     #$C7
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1314
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L021E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1316
+L021E:	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 1317
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosdiveax
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714.c", 1318
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$02
+	jsr     boolne
+	jeq     L0220
+	.dbg	line, "cq714.c", 1319
+	ldx     #$00
+	lda     #$C8
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1320
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0220
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1322
+L0220:	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1323
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosudivax
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714.c", 1324
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$02
+	jsr     boolne
+	jeq     L0222
+	.dbg	line, "cq714.c", 1325
+	ldx     #$00
+	lda     #$C9
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1326
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0222
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1328
+L0222:	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1329
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosdivax
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714.c", 1330
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$02
+	jsr     boolne
+	jeq     L0224
+	.dbg	line, "cq714.c", 1331
+	ldx     #$00
+	lda     #$CA
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1332
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0224
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1334
+L0224:	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1335
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosdivax
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714.c", 1336
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$02
+	jsr     boolne
+	jeq     L0226
+	.dbg	line, "cq714.c", 1337
+	ldx     #$00
+	lda     #$CB
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1338
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0226
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1340
+L0226:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714.c", 1341
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$22
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosdivax
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1342
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0228
+	cmp     #$02
+L0228:	jsr     boolne
+	jeq     L0229
+	.dbg	line, "cq714.c", 1343
+	ldx     #$00
+	lda     #$CC
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1344
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0229
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1346
+L0229:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1347
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosdivax
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1348
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L022B
+	cmp     #$02
+L022B:	jsr     boolne
+	jeq     L022C
+	.dbg	line, "cq714.c", 1349
+	ldx     #$00
+	lda     #$CD
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1350
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L022C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1352
+L022C:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1353
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosdivax
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1354
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L022E
+	cmp     #$02
+L022E:	jsr     boolne
+	jeq     L022F
+	.dbg	line, "cq714.c", 1355
+	ldx     #$00
+	lda     #$CE
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1356
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L022F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1358
+L022F:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 1359
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosdiveax
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1360
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0231
+	cmp     #$02
+L0231:	jsr     boolne
+	jeq     L0232
+	.dbg	line, "cq714.c", 1361
+	ldx     #$00
+	lda     #$CF
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1362
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0232
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1364
+L0232:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1365
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosudivax
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1366
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0234
+	cmp     #$02
+L0234:	jsr     boolne
+	jeq     L0235
+	.dbg	line, "cq714.c", 1367
+	ldx     #$00
+	lda     #$D0
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1368
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0235
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1370
+L0235:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1371
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosdivax
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1372
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0237
+	cmp     #$02
+L0237:	jsr     boolne
+	jeq     L0238
+	.dbg	line, "cq714.c", 1373
+	ldx     #$00
+	lda     #$D1
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1374
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0238
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1376
+L0238:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1377
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosdivax
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1378
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L023A
+	cmp     #$02
+L023A:	jsr     boolne
+	jeq     L023B
+	.dbg	line, "cq714.c", 1379
+	ldx     #$00
+	lda     #$D2
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1380
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L023B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1382
+L023B:	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714.c", 1383
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$22
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosdivax
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1384
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L023D
+	cmp     #$02
+L023D:	jsr     boolne
+	jeq     L023E
+	.dbg	line, "cq714.c", 1385
+	ldx     #$00
+	lda     #$D3
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1386
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L023E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1388
+L023E:	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1389
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosdivax
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1390
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0240
+	cmp     #$02
+L0240:	jsr     boolne
+	jeq     L0241
+	.dbg	line, "cq714.c", 1391
+	ldx     #$00
+	lda     #$D4
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1392
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0241
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1394
+L0241:	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1395
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosdivax
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1396
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0243
+	cmp     #$02
+L0243:	jsr     boolne
+	jeq     L0244
+	.dbg	line, "cq714.c", 1397
+	ldx     #$00
+	lda     #$D5
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1398
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0244
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1400
+L0244:	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 1401
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosdiveax
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1402
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0246
+	cmp     #$02
+L0246:	jsr     boolne
+	jeq     L0247
+	.dbg	line, "cq714.c", 1403
+	ldx     #$00
+	lda     #$D6
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1404
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0247
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1406
+L0247:	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1407
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosudivax
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1408
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0249
+	cmp     #$02
+L0249:	jsr     boolne
+	jeq     L024A
+	.dbg	line, "cq714.c", 1409
+	ldx     #$00
+	lda     #$D7
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1410
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L024A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1412
+L024A:	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1413
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosdivax
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1414
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L024C
+	cmp     #$02
+L024C:	jsr     boolne
+	jeq     L024D
+	.dbg	line, "cq714.c", 1415
+	ldx     #$00
+	lda     #$D8
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1416
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L024D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1418
+L024D:	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1419
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosdivax
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1420
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L024F
+	cmp     #$02
+L024F:	jsr     boolne
+	jeq     L0250
+	.dbg	line, "cq714.c", 1421
+	ldx     #$00
+	lda     #$D9
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1422
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0250
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1424
+L0250:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714.c", 1425
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$24
+	ldx     #$00
+	lda     (sp),y
+	jsr     axulong
+	jsr     tosdiveax
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 1426
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	jeq     L0252
+	.dbg	line, "cq714.c", 1427
+	ldx     #$00
+	lda     #$DA
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1428
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0252
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1430
+L0252:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1431
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$21
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosdiveax
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 1432
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	jeq     L0254
+	.dbg	line, "cq714.c", 1433
+	ldx     #$00
+	lda     #$DB
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1434
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0254
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1436
+L0254:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1437
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$1D
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosdiveax
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 1438
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	jeq     L0256
+	.dbg	line, "cq714.c", 1439
+	ldx     #$00
+	lda     #$DC
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1440
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0256
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1442
+L0256:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 1443
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 1444
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	jeq     L0258
+	.dbg	line, "cq714.c", 1445
+	ldx     #$00
+	lda     #$DD
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1446
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0258
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1448
+L0258:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1449
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axulong
+	jsr     tosdiveax
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 1450
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	jeq     L025A
+	.dbg	line, "cq714.c", 1451
+	ldx     #$00
+	lda     #$DE
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1452
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L025A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1454
+L025A:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1455
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0D
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosdiveax
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 1456
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	jeq     L025C
+	.dbg	line, "cq714.c", 1457
+	ldx     #$00
+	lda     #$DF
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1458
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L025C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1460
+L025C:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1461
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosdiveax
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 1462
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	jsr     tosneeax
+	jeq     L025E
+	.dbg	line, "cq714.c", 1463
+	ldx     #$00
+	lda     #$E0
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1464
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L025E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1466
+L025E:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714.c", 1467
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$22
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosudivax
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1468
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0260
+	cmp     #$02
+L0260:	jsr     boolne
+	jeq     L0261
+	.dbg	line, "cq714.c", 1469
+	ldx     #$00
+	lda     #$E1
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1470
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0261
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1472
+L0261:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1473
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosudivax
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1474
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0263
+	cmp     #$02
+L0263:	jsr     boolne
+	jeq     L0264
+	.dbg	line, "cq714.c", 1475
+	ldx     #$00
+	lda     #$E2
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1476
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0264
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1478
+L0264:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1479
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosudivax
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1480
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0266
+	cmp     #$02
+L0266:	jsr     boolne
+	jeq     L0267
+	.dbg	line, "cq714.c", 1481
+	ldx     #$00
+	lda     #$E3
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1482
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0267
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1484
+L0267:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 1485
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosdiveax
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1486
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0269
+	cmp     #$02
+L0269:	jsr     boolne
+	jeq     L026A
+	.dbg	line, "cq714.c", 1487
+	ldx     #$00
+	lda     #$E4
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1488
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L026A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1490
+L026A:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1491
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosudivax
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1492
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L026C
+	cmp     #$02
+L026C:	jsr     boolne
+	jeq     L026D
+	.dbg	line, "cq714.c", 1493
+	ldx     #$00
+	lda     #$E5
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1494
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L026D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1496
+L026D:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1497
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosudivax
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1498
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L026F
+	cmp     #$02
+L026F:	jsr     boolne
+	jeq     L0270
+	.dbg	line, "cq714.c", 1499
+	ldx     #$00
+	lda     #$E6
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1500
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0270
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1502
+L0270:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1503
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosudivax
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1504
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0272
+	cmp     #$02
+L0272:	jsr     boolne
+	jeq     L0273
+	.dbg	line, "cq714.c", 1505
+	ldx     #$00
+	lda     #$E7
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1506
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0273
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1510
+L0273:	ldx     #$00
+	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714.c", 1511
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$22
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosdivax
+	ldy     #$0A
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1512
+	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0275
+	cmp     #$02
+L0275:	jsr     boolne
+	jeq     L0276
+	.dbg	line, "cq714.c", 1513
+	ldx     #$00
+	lda     #$E8
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1514
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0276
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1516
+L0276:	ldx     #$00
+	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1517
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosdivax
+	ldy     #$0A
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1518
+	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0278
+	cmp     #$02
+L0278:	jsr     boolne
+	jeq     L0279
+	.dbg	line, "cq714.c", 1519
+	ldx     #$00
+	lda     #$E9
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1520
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0279
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1522
+L0279:	ldx     #$00
+	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1523
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosdivax
+	ldy     #$0A
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1524
+	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L027B
+	cmp     #$02
+L027B:	jsr     boolne
+	jeq     L027C
+	.dbg	line, "cq714.c", 1525
+	ldx     #$00
+	lda     #$EA
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1526
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L027C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1528
+L027C:	ldx     #$00
+	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 1529
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosdiveax
+	ldy     #$0A
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1530
+	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L027E
+	cmp     #$02
+L027E:	jsr     boolne
+	jeq     L027F
+	.dbg	line, "cq714.c", 1531
+	ldx     #$00
+	lda     #$EB
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1532
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L027F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1534
+L027F:	ldx     #$00
+	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1535
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosudivax
+	ldy     #$0A
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1536
+	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0281
+	cmp     #$02
+L0281:	jsr     boolne
+	jeq     L0282
+	.dbg	line, "cq714.c", 1537
+	ldx     #$00
+	lda     #$EC
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1538
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0282
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1540
+L0282:	ldx     #$00
+	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1541
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosdivax
+	ldy     #$0A
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1542
+	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0284
+	cmp     #$02
+L0284:	jsr     boolne
+	jeq     L0285
+	.dbg	line, "cq714.c", 1543
+	ldx     #$00
+	lda     #$ED
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1544
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0285
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1546
+L0285:	ldx     #$00
+	lda     #$05
+	ldy     #$0A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1547
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosdivax
+	ldy     #$0A
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1548
+	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0287
+	cmp     #$02
+L0287:	jsr     boolne
+	jeq     L0288
+	.dbg	line, "cq714.c", 1549
+	ldx     #$00
+	lda     #$EE
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1550
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0288
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1552
+L0288:	ldx     #$00
+	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714.c", 1553
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$22
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosdivax
+	ldy     #$06
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1554
+	ldy     #$07
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L028A
+	cmp     #$02
+L028A:	jsr     boolne
+	jeq     L028B
+	.dbg	line, "cq714.c", 1555
+	ldx     #$00
+	lda     #$EF
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1556
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L028B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1558
+L028B:	ldx     #$00
+	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1559
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosdivax
+	ldy     #$06
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1560
+	ldy     #$07
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L028D
+	cmp     #$02
+L028D:	jsr     boolne
+	jeq     L028E
+	.dbg	line, "cq714.c", 1561
+	ldx     #$00
+	lda     #$F0
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1562
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L028E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1564
+L028E:	ldx     #$00
+	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1565
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosdivax
+	ldy     #$06
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1566
+	ldy     #$07
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0290
+	cmp     #$02
+L0290:	jsr     boolne
+	jeq     L0291
+	.dbg	line, "cq714.c", 1567
+	ldx     #$00
+	lda     #$F1
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1568
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0291
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1570
+L0291:	ldx     #$00
+	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 1571
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosdiveax
+	ldy     #$06
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1572
+	ldy     #$07
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0293
+	cmp     #$02
+L0293:	jsr     boolne
+	jeq     L0294
+	.dbg	line, "cq714.c", 1573
+	ldx     #$00
+	lda     #$F2
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1574
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0294
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1576
+L0294:	ldx     #$00
+	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1577
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosudivax
+	ldy     #$06
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1578
+	ldy     #$07
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0296
+	cmp     #$02
+L0296:	jsr     boolne
+	jeq     L0297
+	.dbg	line, "cq714.c", 1579
+	ldx     #$00
+	lda     #$F3
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1580
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0297
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1582
+L0297:	ldx     #$00
+	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1583
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosdivax
+	ldy     #$06
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1584
+	ldy     #$07
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0299
+	cmp     #$02
+L0299:	jsr     boolne
+	jeq     L029A
+	.dbg	line, "cq714.c", 1585
+	ldx     #$00
+	lda     #$F4
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1586
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L029A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1588
+L029A:	ldx     #$00
+	lda     #$05
+	ldy     #$06
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1589
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosdivax
+	ldy     #$06
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1590
+	ldy     #$07
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L029C
+	cmp     #$02
+L029C:	jsr     boolne
+	jeq     L029D
+	.dbg	line, "cq714.c", 1591
+	ldx     #$00
+	lda     #$F5
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1592
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L029D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1680
+L029D:	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714.c", 1681
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$22
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosumodax
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714.c", 1682
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$01
+	jsr     boolne
+	jeq     L029F
+	.dbg	line, "cq714.c", 1683
+	ldx     #$00
+	lda     #$F6
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1684
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L029F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1686
+L029F:	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1687
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosmodax
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714.c", 1688
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$01
+	jsr     boolne
+	jeq     L02A1
+	.dbg	line, "cq714.c", 1689
+	ldx     #$00
+	lda     #$F7
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1690
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L02A1
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1692
+L02A1:	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1693
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosmodax
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714.c", 1694
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$01
+	jsr     boolne
+	jeq     L02A3
+	.dbg	line, "cq714.c", 1695
+	ldx     #$00
+	lda     #$F8
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1696
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L02A3
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1698
+L02A3:	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 1699
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosmodeax
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714.c", 1700
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$01
+	jsr     boolne
+	jeq     L02A5
+	.dbg	line, "cq714.c", 1701
+	ldx     #$00
+	lda     #$F9
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1702
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L02A5
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1704
+L02A5:	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1705
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosumodax
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714.c", 1706
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$01
+	jsr     boolne
+	jeq     L02A7
+	.dbg	line, "cq714.c", 1707
+	ldx     #$00
+	lda     #$FA
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1708
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L02A7
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1710
+L02A7:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714.c", 1711
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$22
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosmodax
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1712
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L02A9
+	cmp     #$01
+L02A9:	jsr     boolne
+	jeq     L02AA
+	.dbg	line, "cq714.c", 1713
+	ldx     #$00
+	lda     #$FB
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1714
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L02AA
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1716
+L02AA:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1717
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosmodax
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1718
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L02AC
+	cmp     #$01
+L02AC:	jsr     boolne
+	jeq     L02AD
+	.dbg	line, "cq714.c", 1719
+	ldx     #$00
+	lda     #$FC
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1720
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L02AD
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1722
+L02AD:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1723
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosmodax
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1724
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L02AF
+	cmp     #$01
+L02AF:	jsr     boolne
+	jeq     L02B0
+	.dbg	line, "cq714.c", 1725
+	ldx     #$00
+	lda     #$FD
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1726
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L02B0
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1728
+L02B0:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714.c", 1729
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosmodeax
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1730
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L02B2
+	cmp     #$01
+L02B2:	jsr     boolne
+	jeq     L02B3
+	.dbg	line, "cq714.c", 1731
+	ldx     #$00
+	lda     #$FE
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1732
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L02B3
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1734
+L02B3:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1735
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosumodax
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1736
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L02B5
+	cmp     #$01
+L02B5:	jsr     boolne
+	jeq     L02B6
+	.dbg	line, "cq714.c", 1737
+	ldx     #$00
+	lda     #$FF
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1738
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L02B6
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1741
+L02B6:	ldy     #$25
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L02B8
+	cmp     #$00
+L02B8:	jsr     boolne
+	jeq     L02B9
+	.dbg	line, "cq714.c", 1742
+	ldx     #$00
+	lda     #$01
+	ldy     #$22
+	jsr     staxysp
+	.dbg	line, "cq714.c", 1743
+	ldy     #$29
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L02BA
+	cmp     #$00
+L02BA:	jsr     boolne
+	jeq     L02B9
+	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714.c", 1745
+L02B9:	ldy     #$23
+	jsr     ldaxysp
+	jmp     L0001
+	.dbg	line, "cq714.c", 1746
+L0001:	ldy     #$2A
+	jsr     addysp
+	rts
+
+	.dbg	line
+.segment	"DATA"
+
+M0001:
+	.byte	$4C,$6F,$63,$61,$6C,$20,$65,$72,$72,$6F,$72,$20,$25,$64,$2E,$0A
+	.byte	$00
+M0002:
+	.byte	$73,$37,$31,$34,$2C,$65,$72,$25,$64,$0A,$00
+M0003:
+	.byte	$73,$37,$31,$34,$20,$20,$20,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ section (int j, void *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_section: near
+
+	.dbg	func, "section", "00", extern, "_section"
+	.dbg	sym, "j", "00", auto, 2
+	.dbg	sym, "pd0", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "cq714.c", 1755
+	jsr     pushax
+	.dbg	line, "cq714.c", 1757
+	ldy     #$03
+	jsr     ldaxysp
+	jmp     L0002
+	.dbg	line, "cq714.c", 1759
+L0002:	cpx     #$00
+	jne     L0005
+	cmp     #$00
+	jeq     L0004
+	jmp     L0003
+L0005:	jmp     L0003
+	.dbg	line, "cq714.c", 1758
+L0004:	ldy     #$01
+	jsr     ldaxysp
+	jsr     _s714
+	jmp     L0003
+	.dbg	line, "cq714.c", 1760
+L0003:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+	.dbg	sym, "n", "00", auto, 2
+	.dbg	sym, "args", "00", auto, 0
+	.dbg	sym, "j", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "cq714.c", 1780
+	jsr     decsp2
+	ldx     #$00
+	lda     #$01
+	sta     M0001+14
+	stx     M0001+14+1
+	.dbg	line, "cq714.c", 1781
+	ldx     #$00
+	lda     #$01
+	sta     M0001+16
+	stx     M0001+16+1
+	.dbg	line, "cq714.c", 1782
+	ldx     #$00
+	lda     #$01
+	sta     M0001+18
+	stx     M0001+18+1
+	.dbg	line, "cq714.c", 1783
+	ldx     #$00
+	lda     #$01
+	sta     M0001+20
+	stx     M0001+20+1
+	.dbg	line, "cq714.c", 1785
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	sta     M0002
+	stx     M0002+1
+	.dbg	line, "cq714.c", 1787
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+	jmp     L0002
+	.dbg	line, "cq714.c", 1788
+L0005:	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	lda     M0002
+	ldx     M0002+1
+	jsr     _section
+	sta     M0001+22
+	stx     M0001+22+1
+	.dbg	line, "cq714.c", 1789
+	lda     M0001+24
+	ldx     M0001+24+1
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     tosaddax
+	sta     M0001+24
+	stx     M0001+24+1
+	.dbg	line, "cq714.c", 1790
+	lda     M0001+14
+	ldx     M0001+14+1
+	cpx     #$00
+	bne     L0008
+	cmp     #$00
+L0008:	jsr     boolne
+	jeq     L0007
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     #<(M0001+26)
+	ldx     #>(M0001+26)
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "cq714.c", 1787
+L0007:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0005
+	.dbg	line, "cq714.c", 1793
+	lda     M0001+24
+	ldx     M0001+24+1
+	cpx     #$00
+	bne     L000A
+	cmp     #$00
+L000A:	jsr     booleq
+	jeq     L0009
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cq714.c", 1794
+	jmp     L000B
+L0009:	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cq714.c", 1796
+L000B:	lda     M0001+24
+	ldx     M0001+24+1
+	jmp     L0001
+	.dbg	line, "cq714.c", 1797
+L0001:	jsr     incsp6
+	rts
+
+	.dbg	line
+.segment	"BSS"
+
+M0001:
+	.res	34,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
@@ -0,0 +1,5549 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_printf
+	.export		_lbits
+	.export		_ubits
+	.export		_fbits
+	.export		_dbits
+	.export		_flgs
+	.export		_flgm
+	.export		_flgd
+	.export		_flgl
+	.export		_rrc
+	.export		_crc
+	.export		_rfs
+	.export		_s714
+	.export		_section
+	.export		_main
+
+.segment	"RODATA"
+
+S0004:
+	.byte	$53,$65,$63,$74,$69,$6F,$6E,$20,$25,$73,$20,$72,$65,$74,$75,$72
+	.byte	$6E,$65,$64,$20,$25,$64,$2E,$0A,$00
+S0005:
+	.byte	$0A,$4E,$6F,$20,$65,$72,$72,$6F,$72,$73,$20,$64,$65,$74,$65,$63
+	.byte	$74,$65,$64,$2E,$0A,$00
+S0006:
+	.byte	$0A,$46,$61,$69,$6C,$65,$64,$2E,$0A,$00
+
+.segment	"BSS"
+
+_lbits:
+	.res	2,$00
+_ubits:
+	.res	2,$00
+_fbits:
+	.res	2,$00
+_dbits:
+	.res	2,$00
+_flgs:
+	.res	2,$00
+_flgm:
+	.res	2,$00
+_flgd:
+	.res	2,$00
+_flgl:
+	.res	2,$00
+_rrc:
+	.res	2,$00
+_crc:
+	.res	2,$00
+_rfs:
+	.res	8,$00
+
+; ---------------------------------------------------------------
+; int __near__ s714 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s714: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$28
+	jsr     subysp
+	lda     #<(M0003)
+	ldx     #>(M0003)
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$29
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     incaxy
+	jsr     stax0sp
+	ldx     #$00
+	txa
+	ldy     #$22
+	jsr     staxysp
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$29
+	jsr     ldaxysp
+	ldy     #$15
+	jsr     ldaxidx
+	ldy     #$26
+	jsr     staxysp
+L0002:	jsr     pushw0sp
+	ldy     #$05
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	lda     (ptr1)
+	jsr     staspidx
+	tax
+	php
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	bne     L0002
+	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$22
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosmoda0
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L018F
+	cmp     #$01
+	beq     L01E5
+L018F:	ldx     #$01
+	lda     #$00
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0007
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0007:	ldx     #$00
+L01E5:	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosmodax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L0190
+	cmp     #$01
+	beq     L01E6
+L0190:	ldx     #$01
+	txa
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L000A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L000A:	ldx     #$00
+L01E6:	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosmodax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L0191
+	cmp     #$01
+	beq     L01E7
+L0191:	ldx     #$01
+	lda     #$02
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L000D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L000D:	ldx     #$00
+L01E7:	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosmodeax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L0192
+	cmp     #$01
+	beq     L01E8
+L0192:	ldx     #$01
+	lda     #$03
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0010
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0010:	ldx     #$00
+L01E8:	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosumodax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L0193
+	cmp     #$01
+	beq     L01E9
+L0193:	ldx     #$01
+	lda     #$04
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0013
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0013:	ldx     #$00
+L01E9:	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$24
+	ldx     #$00
+	lda     (sp),y
+	jsr     axulong
+	jsr     tosmodeax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$01
+	jsr     tosneeax
+	beq     L0015
+	ldx     #$01
+	lda     #$05
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0015
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0015:	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$21
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosmodeax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$01
+	jsr     tosneeax
+	beq     L0017
+	ldx     #$01
+	lda     #$06
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0017
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0017:	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$1D
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosmodeax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$01
+	jsr     tosneeax
+	beq     L0019
+	ldx     #$01
+	lda     #$07
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0019
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0019:	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     tosmodeax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$01
+	jsr     tosneeax
+	beq     L001B
+	ldx     #$01
+	lda     #$08
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L001B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L001B:	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axulong
+	jsr     tosmodeax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$01
+	jsr     tosneeax
+	beq     L001D
+	ldx     #$01
+	lda     #$09
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L001D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L001D:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$22
+	lda     (sp),y
+	jsr     tosumoda0
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0194
+	cmp     #$01
+	beq     L01EA
+L0194:	ldx     #$01
+	lda     #$0A
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0020
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0020:	ldx     #$00
+L01EA:	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosumodax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0195
+	cmp     #$01
+	beq     L01EB
+L0195:	ldx     #$01
+	lda     #$0B
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0023
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0023:	ldx     #$00
+L01EB:	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosumodax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0196
+	cmp     #$01
+	beq     L01EC
+L0196:	ldx     #$01
+	lda     #$0C
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0026
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0026:	ldx     #$00
+L01EC:	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosmodeax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0197
+	cmp     #$01
+	beq     L01ED
+L0197:	ldx     #$01
+	lda     #$0D
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0029
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0029:	ldx     #$00
+L01ED:	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosumodax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0198
+	cmp     #$01
+	beq     L002C
+L0198:	ldx     #$01
+	lda     #$0E
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L002C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L002C:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	lda     #$02
+	dey
+	sta     (sp),y
+	iny
+	ldx     #$00
+	lda     (sp),y
+	sta     sreg
+	dey
+	lda     (sp),y
+	tay
+	lda     sreg
+	jsr     shraxy
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$01
+	beq     L0176
+	ldx     #$01
+	lda     #$0F
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0176
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0176:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$21
+	lda     (sp),y
+	sta     sreg
+	ldy     #$1C
+	lda     (sp),y
+	tay
+	lda     sreg
+	jsr     asraxy
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$01
+	beq     L0177
+	ldx     #$01
+	lda     #$10
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0177
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0177:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$21
+	lda     (sp),y
+	sta     sreg
+	ldy     #$18
+	lda     (sp),y
+	tay
+	lda     sreg
+	jsr     asraxy
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$01
+	beq     L0178
+	ldx     #$01
+	lda     #$11
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0178
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0178:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosasreax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$01
+	beq     L0179
+	ldx     #$01
+	lda     #$12
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0179
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0179:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$21
+	lda     (sp),y
+	sta     sreg
+	ldy     #$0C
+	lda     (sp),y
+	tay
+	lda     sreg
+	jsr     shraxy
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$01
+	beq     L017A
+	inx
+	lda     #$13
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0036
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0036:	ldx     #$00
+L017A:	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	dey
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$20
+	lda     (sp),y
+	tay
+	lda     sreg
+	ldx     sreg+1
+	jsr     asraxy
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L0199
+	cmp     #$01
+	beq     L01EE
+L0199:	ldx     #$01
+	lda     #$14
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0039
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0039:	ldx     #$00
+L01EE:	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$1F
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$1C
+	lda     (sp),y
+	tay
+	lda     sreg
+	ldx     sreg+1
+	jsr     asraxy
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L019A
+	cmp     #$01
+	beq     L01EF
+L019A:	ldx     #$01
+	lda     #$15
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L003C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L003C:	ldx     #$00
+L01EF:	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$1F
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$18
+	lda     (sp),y
+	tay
+	lda     sreg
+	ldx     sreg+1
+	jsr     asraxy
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L019B
+	cmp     #$01
+	beq     L01F0
+L019B:	ldx     #$01
+	lda     #$16
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L003F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L003F:	ldx     #$00
+L01F0:	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosasreax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L019C
+	cmp     #$01
+	beq     L01F1
+L019C:	ldx     #$01
+	lda     #$17
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0042
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0042:	ldx     #$00
+L01F1:	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$1F
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$0C
+	lda     (sp),y
+	tay
+	lda     sreg
+	ldx     sreg+1
+	jsr     shraxy
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L019D
+	cmp     #$01
+	beq     L01F2
+L019D:	ldx     #$01
+	lda     #$18
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0045
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0045:	ldx     #$00
+L01F2:	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$1B
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$20
+	lda     (sp),y
+	tay
+	lda     sreg
+	ldx     sreg+1
+	jsr     asraxy
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L019E
+	cmp     #$01
+	beq     L01F3
+L019E:	ldx     #$01
+	lda     #$19
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0048
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0048:	ldx     #$00
+L01F3:	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$1B
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$1C
+	lda     (sp),y
+	tay
+	lda     sreg
+	ldx     sreg+1
+	jsr     asraxy
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L019F
+	cmp     #$01
+	beq     L01F4
+L019F:	ldx     #$01
+	lda     #$1A
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L004B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L004B:	ldx     #$00
+L01F4:	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$1B
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$18
+	lda     (sp),y
+	tay
+	lda     sreg
+	ldx     sreg+1
+	jsr     asraxy
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L01A0
+	cmp     #$01
+	beq     L01F5
+L01A0:	ldx     #$01
+	lda     #$1B
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L004E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L004E:	ldx     #$00
+L01F5:	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosasreax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L01A1
+	cmp     #$01
+	beq     L01F6
+L01A1:	ldx     #$01
+	lda     #$1C
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0051
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0051:	ldx     #$00
+L01F6:	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$1B
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$0C
+	lda     (sp),y
+	tay
+	lda     sreg
+	ldx     sreg+1
+	jsr     shraxy
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L01A2
+	cmp     #$01
+	beq     L01F7
+L01A2:	ldx     #$01
+	lda     #$1D
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0054
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0054:	ldx     #$00
+L01F7:	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$24
+	ldx     #$00
+	lda     (sp),y
+	jsr     axulong
+	jsr     tosasreax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$01
+	jsr     tosneeax
+	beq     L0056
+	ldx     #$01
+	lda     #$1E
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0056
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0056:	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$21
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosasreax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$01
+	jsr     tosneeax
+	beq     L0058
+	ldx     #$01
+	lda     #$1F
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0058
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0058:	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$1D
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosasreax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$01
+	jsr     tosneeax
+	beq     L005A
+	ldx     #$01
+	lda     #$20
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L005A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L005A:	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     tosasreax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$01
+	jsr     tosneeax
+	beq     L005C
+	ldx     #$01
+	lda     #$21
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L005C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L005C:	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axulong
+	jsr     tosasreax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$01
+	jsr     tosneeax
+	beq     L005E
+	ldx     #$01
+	lda     #$22
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L005E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L005E:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$0F
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$20
+	lda     (sp),y
+	tay
+	lda     sreg
+	ldx     sreg+1
+	jsr     shraxy
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01A3
+	cmp     #$01
+	beq     L01F8
+L01A3:	ldx     #$01
+	lda     #$23
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0061
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0061:	ldx     #$00
+L01F8:	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$0F
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$1C
+	lda     (sp),y
+	tay
+	lda     sreg
+	ldx     sreg+1
+	jsr     shraxy
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01A4
+	cmp     #$01
+	beq     L01F9
+L01A4:	ldx     #$01
+	lda     #$24
+	tay
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0064
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0064:	ldx     #$00
+L01F9:	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$0F
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$18
+	lda     (sp),y
+	tay
+	lda     sreg
+	ldx     sreg+1
+	jsr     shraxy
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01A5
+	cmp     #$01
+	beq     L01FA
+L01A5:	ldx     #$01
+	lda     #$25
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0067
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0067:	ldx     #$00
+L01FA:	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosasreax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01A6
+	cmp     #$01
+	beq     L01FB
+L01A6:	ldx     #$01
+	lda     #$26
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L006A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L006A:	ldx     #$00
+L01FB:	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$0F
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$0C
+	lda     (sp),y
+	tay
+	lda     sreg
+	ldx     sreg+1
+	jsr     shraxy
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01A7
+	cmp     #$01
+	beq     L006D
+L01A7:	ldx     #$01
+	lda     #$27
+	ldy     #$24
+	jsr     staxysp
+	tay
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L006D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L006D:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	lda     #$02
+	dey
+	sta     (sp),y
+	iny
+	ldx     #$00
+	lda     (sp),y
+	sta     sreg
+	dey
+	lda     (sp),y
+	tay
+	lda     sreg
+	jsr     shlaxy
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$14
+	beq     L017B
+	ldx     #$01
+	lda     #$28
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L017B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L017B:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$21
+	lda     (sp),y
+	sta     sreg
+	ldy     #$1C
+	lda     (sp),y
+	tay
+	lda     sreg
+	jsr     aslaxy
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$14
+	beq     L017C
+	ldx     #$01
+	lda     #$29
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L017C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L017C:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$21
+	lda     (sp),y
+	sta     sreg
+	ldy     #$18
+	lda     (sp),y
+	tay
+	lda     sreg
+	jsr     aslaxy
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$14
+	beq     L017D
+	ldx     #$01
+	lda     #$2A
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L017D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L017D:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosasleax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$14
+	beq     L017E
+	ldx     #$01
+	lda     #$2B
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L017E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L017E:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$21
+	lda     (sp),y
+	sta     sreg
+	ldy     #$0C
+	lda     (sp),y
+	tay
+	lda     sreg
+	jsr     shlaxy
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$14
+	beq     L017F
+	inx
+	lda     #$2C
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0077
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0077:	ldx     #$00
+L017F:	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	dey
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$20
+	lda     (sp),y
+	tay
+	lda     sreg
+	ldx     sreg+1
+	jsr     aslaxy
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01A8
+	cmp     #$14
+	beq     L01FC
+L01A8:	ldx     #$01
+	lda     #$2D
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L007A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L007A:	ldx     #$00
+L01FC:	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$1F
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$1C
+	lda     (sp),y
+	tay
+	lda     sreg
+	ldx     sreg+1
+	jsr     aslaxy
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01A9
+	cmp     #$14
+	beq     L01FD
+L01A9:	ldx     #$01
+	lda     #$2E
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L007D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L007D:	ldx     #$00
+L01FD:	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$1F
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$18
+	lda     (sp),y
+	tay
+	lda     sreg
+	ldx     sreg+1
+	jsr     aslaxy
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01AA
+	cmp     #$14
+	beq     L01FE
+L01AA:	ldx     #$01
+	lda     #$2F
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0080
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0080:	ldx     #$00
+L01FE:	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosasleax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01AB
+	cmp     #$14
+	beq     L01FF
+L01AB:	ldx     #$01
+	lda     #$30
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0083
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0083:	ldx     #$00
+L01FF:	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$1F
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$0C
+	lda     (sp),y
+	tay
+	lda     sreg
+	ldx     sreg+1
+	jsr     shlaxy
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01AC
+	cmp     #$14
+	beq     L0200
+L01AC:	ldx     #$01
+	lda     #$31
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0086
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0086:	ldx     #$00
+L0200:	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$1B
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$20
+	lda     (sp),y
+	tay
+	lda     sreg
+	ldx     sreg+1
+	jsr     aslaxy
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L01AD
+	cmp     #$14
+	beq     L0201
+L01AD:	ldx     #$01
+	lda     #$32
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0089
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0089:	ldx     #$00
+L0201:	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$1B
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$1C
+	lda     (sp),y
+	tay
+	lda     sreg
+	ldx     sreg+1
+	jsr     aslaxy
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L01AE
+	cmp     #$14
+	beq     L0202
+L01AE:	ldx     #$01
+	lda     #$33
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L008C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L008C:	ldx     #$00
+L0202:	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$1B
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$18
+	lda     (sp),y
+	tay
+	lda     sreg
+	ldx     sreg+1
+	jsr     aslaxy
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L01AF
+	cmp     #$14
+	beq     L0203
+L01AF:	ldx     #$01
+	lda     #$34
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L008F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L008F:	ldx     #$00
+L0203:	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosasleax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L01B0
+	cmp     #$14
+	beq     L0204
+L01B0:	ldx     #$01
+	lda     #$35
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0092
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0092:	ldx     #$00
+L0204:	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$1B
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$0C
+	lda     (sp),y
+	tay
+	lda     sreg
+	ldx     sreg+1
+	jsr     shlaxy
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L01B1
+	cmp     #$14
+	beq     L0205
+L01B1:	ldx     #$01
+	lda     #$36
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0095
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0095:	ldx     #$00
+L0205:	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$24
+	ldx     #$00
+	lda     (sp),y
+	jsr     axulong
+	jsr     tosasleax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$14
+	jsr     tosneeax
+	beq     L0097
+	ldx     #$01
+	lda     #$37
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0097
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0097:	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$21
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosasleax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$14
+	jsr     tosneeax
+	beq     L0099
+	ldx     #$01
+	lda     #$38
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0099
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0099:	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$1D
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosasleax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$14
+	jsr     tosneeax
+	beq     L009B
+	ldx     #$01
+	lda     #$39
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L009B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L009B:	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     tosasleax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$14
+	jsr     tosneeax
+	beq     L009D
+	ldx     #$01
+	lda     #$3A
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L009D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L009D:	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axulong
+	jsr     tosasleax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$14
+	jsr     tosneeax
+	beq     L009F
+	ldx     #$01
+	lda     #$3B
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L009F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L009F:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$0F
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$20
+	lda     (sp),y
+	tay
+	lda     sreg
+	ldx     sreg+1
+	jsr     shlaxy
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01B2
+	cmp     #$14
+	beq     L0206
+L01B2:	ldx     #$01
+	lda     #$3C
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00A2
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00A2:	ldx     #$00
+L0206:	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$0F
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$1C
+	lda     (sp),y
+	tay
+	lda     sreg
+	ldx     sreg+1
+	jsr     shlaxy
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01B3
+	cmp     #$14
+	beq     L0207
+L01B3:	ldx     #$01
+	lda     #$3D
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00A5
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00A5:	ldx     #$00
+L0207:	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$0F
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$18
+	lda     (sp),y
+	tay
+	lda     sreg
+	ldx     sreg+1
+	jsr     shlaxy
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01B4
+	cmp     #$14
+	beq     L0208
+L01B4:	ldx     #$01
+	lda     #$3E
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00A8
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00A8:	ldx     #$00
+L0208:	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	stz     sreg
+	stz     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosasleax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01B5
+	cmp     #$14
+	beq     L0209
+L01B5:	ldx     #$01
+	lda     #$3F
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00AB
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00AB:	ldx     #$00
+L0209:	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$0F
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$0C
+	lda     (sp),y
+	tay
+	lda     sreg
+	ldx     sreg+1
+	jsr     shlaxy
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01B6
+	cmp     #$14
+	beq     L00AE
+L01B6:	ldx     #$01
+	lda     #$40
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00AE
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00AE:	lda     #$0C
+	ldy     #$21
+	sta     (sp),y
+	lda     #$0A
+	dey
+	sta     (sp),y
+	iny
+	and     (sp),y
+	sta     (sp),y
+	cmp     #$08
+	beq     L0180
+	ldx     #$01
+	lda     #$41
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0180
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0180:	lda     #$0C
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$0A
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$21
+	lda     (sp),y
+	sta     sreg
+	ldy     #$1C
+	lda     (sp),y
+	and     sreg
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$08
+	beq     L0181
+	inx
+	lda     #$42
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0181
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0181:	lda     #$0C
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$0A
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$21
+	lda     (sp),y
+	sta     sreg
+	ldy     #$18
+	lda     (sp),y
+	and     sreg
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$08
+	beq     L0182
+	inx
+	lda     #$43
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0182
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0182:	lda     #$0C
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$0A
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosandeax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$08
+	beq     L0183
+	ldx     #$01
+	lda     #$44
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0183
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0183:	lda     #$0C
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$0A
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$21
+	lda     (sp),y
+	sta     sreg
+	ldy     #$0C
+	lda     (sp),y
+	and     sreg
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$08
+	beq     L0184
+	inx
+	lda     #$45
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00B8
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00B8:	ldx     #$00
+L0184:	lda     #$0C
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$0A
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$1E
+	and     (sp),y
+	pha
+	txa
+	iny
+	and     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01B7
+	cmp     #$08
+	beq     L020A
+L01B7:	ldx     #$01
+	lda     #$46
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00BB
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00BB:	ldx     #$00
+L020A:	lda     #$0C
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$0A
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$1E
+	and     (sp),y
+	pha
+	txa
+	iny
+	and     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01B8
+	cmp     #$08
+	beq     L020B
+L01B8:	ldx     #$01
+	lda     #$47
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00BE
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00BE:	ldx     #$00
+L020B:	lda     #$0C
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$0A
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$1E
+	and     (sp),y
+	pha
+	txa
+	iny
+	and     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01B9
+	cmp     #$08
+	beq     L020C
+L01B9:	ldx     #$01
+	lda     #$48
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00C1
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00C1:	ldx     #$00
+L020C:	lda     #$0C
+	ldy     #$1E
+	jsr     staxysp
+	stz     sreg
+	stz     sreg+1
+	lda     #$0A
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosandeax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01BA
+	cmp     #$08
+	beq     L020D
+L01BA:	ldx     #$01
+	lda     #$49
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00C4
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00C4:	ldx     #$00
+L020D:	lda     #$0C
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$0A
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$1E
+	and     (sp),y
+	pha
+	txa
+	iny
+	and     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01BB
+	cmp     #$08
+	beq     L020E
+L01BB:	ldx     #$01
+	lda     #$4A
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00C7
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00C7:	ldx     #$00
+L020E:	lda     #$0C
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$0A
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$1A
+	and     (sp),y
+	pha
+	txa
+	iny
+	and     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01BC
+	cmp     #$08
+	beq     L020F
+L01BC:	ldx     #$01
+	lda     #$4B
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00CA
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00CA:	ldx     #$00
+L020F:	lda     #$0C
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$0A
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$1A
+	and     (sp),y
+	pha
+	txa
+	iny
+	and     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01BD
+	cmp     #$08
+	beq     L0210
+L01BD:	ldx     #$01
+	lda     #$4C
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00CD
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00CD:	ldx     #$00
+L0210:	lda     #$0C
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$0A
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$1A
+	and     (sp),y
+	pha
+	txa
+	iny
+	and     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01BE
+	cmp     #$08
+	beq     L0211
+L01BE:	ldx     #$01
+	lda     #$4D
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00D0
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00D0:	ldx     #$00
+L0211:	lda     #$0C
+	ldy     #$1A
+	jsr     staxysp
+	stz     sreg
+	stz     sreg+1
+	lda     #$0A
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosandeax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L01BF
+	cmp     #$08
+	beq     L0212
+L01BF:	ldx     #$01
+	lda     #$4E
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00D3
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00D3:	ldx     #$00
+L0212:	lda     #$0C
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$0A
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$1A
+	and     (sp),y
+	pha
+	txa
+	iny
+	and     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01C0
+	cmp     #$08
+	beq     L0213
+L01C0:	ldx     #$01
+	lda     #$4F
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00D6
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00D6:	ldx     #$00
+L0213:	stz     sreg
+	stz     sreg+1
+	lda     #$0C
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$0A
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$24
+	ldx     #$00
+	lda     (sp),y
+	jsr     axulong
+	jsr     tosandeax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$08
+	jsr     tosneeax
+	beq     L00D8
+	ldx     #$01
+	lda     #$50
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00D8
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00D8:	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$0C
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$0A
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$21
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosandeax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$08
+	jsr     tosneeax
+	beq     L00DA
+	ldx     #$01
+	lda     #$51
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00DA
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00DA:	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$0C
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$0A
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$1D
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosandeax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$08
+	jsr     tosneeax
+	beq     L00DC
+	ldx     #$01
+	lda     #$52
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00DC
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00DC:	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$0C
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$0A
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     tosandeax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$08
+	jsr     tosneeax
+	beq     L00DE
+	ldx     #$01
+	lda     #$53
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00DE
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00DE:	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$0C
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$0A
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axulong
+	jsr     tosandeax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$08
+	jsr     tosneeax
+	beq     L00E0
+	ldx     #$01
+	lda     #$54
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00E0
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00E0:	ldx     #$00
+	lda     #$0C
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$0A
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$0E
+	and     (sp),y
+	pha
+	txa
+	iny
+	and     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01C1
+	cmp     #$08
+	beq     L0214
+L01C1:	ldx     #$01
+	lda     #$55
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00E3
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00E3:	ldx     #$00
+L0214:	lda     #$0C
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$0A
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$0E
+	and     (sp),y
+	pha
+	txa
+	iny
+	and     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01C2
+	cmp     #$08
+	beq     L0215
+L01C2:	ldx     #$01
+	lda     #$56
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00E6
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00E6:	ldx     #$00
+L0215:	lda     #$0C
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$0A
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$0E
+	and     (sp),y
+	pha
+	txa
+	iny
+	and     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01C3
+	cmp     #$08
+	beq     L0216
+L01C3:	ldx     #$01
+	lda     #$57
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00E9
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00E9:	ldx     #$00
+L0216:	lda     #$0C
+	ldy     #$0E
+	jsr     staxysp
+	stz     sreg
+	stz     sreg+1
+	lda     #$0A
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosandeax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01C4
+	cmp     #$08
+	beq     L0217
+L01C4:	ldx     #$01
+	lda     #$58
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00EC
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00EC:	ldx     #$00
+L0217:	lda     #$0C
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$0A
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$0E
+	and     (sp),y
+	pha
+	txa
+	iny
+	and     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01C5
+	cmp     #$08
+	beq     L00EF
+L01C5:	ldx     #$01
+	lda     #$59
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00EF
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00EF:	lda     #$0C
+	ldy     #$21
+	sta     (sp),y
+	lda     #$0A
+	dey
+	sta     (sp),y
+	iny
+	eor     (sp),y
+	sta     (sp),y
+	cmp     #$06
+	beq     L0185
+	ldx     #$01
+	lda     #$5A
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0185
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0185:	lda     #$0C
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$0A
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$21
+	lda     (sp),y
+	sta     sreg
+	ldy     #$1C
+	lda     (sp),y
+	eor     sreg
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$06
+	beq     L0186
+	inx
+	lda     #$5B
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0186
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0186:	lda     #$0C
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$0A
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$21
+	lda     (sp),y
+	sta     sreg
+	ldy     #$18
+	lda     (sp),y
+	eor     sreg
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$06
+	beq     L0187
+	inx
+	lda     #$5C
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0187
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0187:	lda     #$0C
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$0A
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosxoreax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$06
+	beq     L0188
+	ldx     #$01
+	lda     #$5D
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0188
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0188:	lda     #$0C
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$0A
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$21
+	lda     (sp),y
+	sta     sreg
+	ldy     #$0C
+	lda     (sp),y
+	eor     sreg
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$06
+	beq     L0189
+	inx
+	lda     #$5E
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00F9
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00F9:	ldx     #$00
+L0189:	lda     #$0C
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$0A
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$1E
+	eor     (sp),y
+	pha
+	iny
+	lda     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01C6
+	cmp     #$06
+	beq     L0218
+L01C6:	ldx     #$01
+	lda     #$5F
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00FC
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00FC:	ldx     #$00
+L0218:	lda     #$0C
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$0A
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$1E
+	eor     (sp),y
+	pha
+	iny
+	lda     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01C7
+	cmp     #$06
+	beq     L0219
+L01C7:	ldx     #$01
+	lda     #$60
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00FF
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00FF:	ldx     #$00
+L0219:	lda     #$0C
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$0A
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$1E
+	eor     (sp),y
+	pha
+	iny
+	lda     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01C8
+	cmp     #$06
+	beq     L021A
+L01C8:	ldx     #$01
+	lda     #$61
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0102
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0102:	ldx     #$00
+L021A:	lda     #$0C
+	ldy     #$1E
+	jsr     staxysp
+	stz     sreg
+	stz     sreg+1
+	lda     #$0A
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosxoreax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01C9
+	cmp     #$06
+	beq     L021B
+L01C9:	ldx     #$01
+	lda     #$62
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0105
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0105:	ldx     #$00
+L021B:	lda     #$0C
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$0A
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$1E
+	eor     (sp),y
+	pha
+	iny
+	lda     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01CA
+	cmp     #$06
+	beq     L021C
+L01CA:	ldx     #$01
+	lda     #$63
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0108
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0108:	ldx     #$00
+L021C:	lda     #$0C
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$0A
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$1A
+	eor     (sp),y
+	pha
+	iny
+	lda     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01CB
+	cmp     #$06
+	beq     L021D
+L01CB:	ldx     #$01
+	lda     #$64
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L010B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L010B:	ldx     #$00
+L021D:	lda     #$0C
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$0A
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$1A
+	eor     (sp),y
+	pha
+	iny
+	lda     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01CC
+	cmp     #$06
+	beq     L021E
+L01CC:	ldx     #$01
+	lda     #$65
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L010E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L010E:	ldx     #$00
+L021E:	lda     #$0C
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$0A
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$1A
+	eor     (sp),y
+	pha
+	iny
+	lda     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01CD
+	cmp     #$06
+	beq     L021F
+L01CD:	ldx     #$01
+	lda     #$66
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0111
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0111:	ldx     #$00
+L021F:	lda     #$0C
+	ldy     #$1A
+	jsr     staxysp
+	stz     sreg
+	stz     sreg+1
+	lda     #$0A
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosxoreax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L01CE
+	cmp     #$06
+	beq     L0220
+L01CE:	ldx     #$01
+	lda     #$67
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0114
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0114:	ldx     #$00
+L0220:	lda     #$0C
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$0A
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$1A
+	eor     (sp),y
+	pha
+	iny
+	lda     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01CF
+	cmp     #$06
+	beq     L0221
+L01CF:	ldx     #$01
+	lda     #$68
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0117
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0117:	ldx     #$00
+L0221:	stz     sreg
+	stz     sreg+1
+	lda     #$0C
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$0A
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$24
+	ldx     #$00
+	lda     (sp),y
+	jsr     axulong
+	jsr     tosxoreax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$06
+	jsr     tosneeax
+	beq     L0119
+	ldx     #$01
+	lda     #$69
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0119
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0119:	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$0C
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$0A
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$21
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosxoreax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$06
+	jsr     tosneeax
+	beq     L011B
+	ldx     #$01
+	lda     #$6A
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L011B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L011B:	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$0C
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$0A
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$1D
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosxoreax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$06
+	jsr     tosneeax
+	beq     L011D
+	ldx     #$01
+	lda     #$6B
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L011D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L011D:	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$0C
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$0A
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     tosxoreax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$06
+	jsr     tosneeax
+	beq     L011F
+	ldx     #$01
+	lda     #$6C
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L011F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L011F:	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$0C
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$0A
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axulong
+	jsr     tosxoreax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$06
+	jsr     tosneeax
+	beq     L0121
+	ldx     #$01
+	lda     #$6D
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0121
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0121:	ldx     #$00
+	lda     #$0C
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$0A
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$0E
+	eor     (sp),y
+	pha
+	iny
+	lda     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01D0
+	cmp     #$06
+	beq     L0222
+L01D0:	ldx     #$01
+	lda     #$6E
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0124
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0124:	ldx     #$00
+L0222:	lda     #$0C
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$0A
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$0E
+	eor     (sp),y
+	pha
+	iny
+	lda     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01D1
+	cmp     #$06
+	beq     L0223
+L01D1:	ldx     #$01
+	lda     #$6F
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0127
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0127:	ldx     #$00
+L0223:	lda     #$0C
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$0A
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$0E
+	eor     (sp),y
+	pha
+	iny
+	lda     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01D2
+	cmp     #$06
+	beq     L0224
+L01D2:	ldx     #$01
+	lda     #$70
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L012A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L012A:	ldx     #$00
+L0224:	lda     #$0C
+	ldy     #$0E
+	jsr     staxysp
+	stz     sreg
+	stz     sreg+1
+	lda     #$0A
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosxoreax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01D3
+	cmp     #$06
+	beq     L0225
+L01D3:	ldx     #$01
+	lda     #$71
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L012D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L012D:	ldx     #$00
+L0225:	lda     #$0C
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$0A
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$0E
+	eor     (sp),y
+	pha
+	iny
+	lda     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01D4
+	cmp     #$06
+	beq     L0130
+L01D4:	ldx     #$01
+	lda     #$72
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0130
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0130:	lda     #$0C
+	ldy     #$21
+	sta     (sp),y
+	lda     #$0A
+	dey
+	sta     (sp),y
+	iny
+	ora     (sp),y
+	sta     (sp),y
+	cmp     #$0E
+	beq     L018A
+	ldx     #$01
+	lda     #$73
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L018A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L018A:	lda     #$0C
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$0A
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$21
+	lda     (sp),y
+	sta     sreg
+	ldy     #$1C
+	lda     (sp),y
+	ora     sreg
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$0E
+	beq     L018B
+	inx
+	lda     #$74
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L018B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L018B:	lda     #$0C
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$0A
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$21
+	lda     (sp),y
+	sta     sreg
+	ldy     #$18
+	lda     (sp),y
+	ora     sreg
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$0E
+	beq     L018C
+	inx
+	lda     #$75
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L018C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L018C:	lda     #$0C
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$0A
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosoreax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$0E
+	beq     L018D
+	ldx     #$01
+	lda     #$76
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L018D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L018D:	lda     #$0C
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$0A
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$21
+	lda     (sp),y
+	sta     sreg
+	ldy     #$0C
+	lda     (sp),y
+	ora     sreg
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$0E
+	beq     L018E
+	inx
+	lda     #$77
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L013A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L013A:	ldx     #$00
+L018E:	lda     #$0C
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$0A
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$1E
+	ora     (sp),y
+	pha
+	iny
+	lda     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01D5
+	cmp     #$0E
+	beq     L0226
+L01D5:	ldx     #$01
+	lda     #$78
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L013D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L013D:	ldx     #$00
+L0226:	lda     #$0C
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$0A
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$1E
+	ora     (sp),y
+	pha
+	iny
+	lda     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01D6
+	cmp     #$0E
+	beq     L0227
+L01D6:	ldx     #$01
+	lda     #$79
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0140
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0140:	ldx     #$00
+L0227:	lda     #$0C
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$0A
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$1E
+	ora     (sp),y
+	pha
+	iny
+	lda     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01D7
+	cmp     #$0E
+	beq     L0228
+L01D7:	ldx     #$01
+	lda     #$7A
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0143
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0143:	ldx     #$00
+L0228:	lda     #$0C
+	ldy     #$1E
+	jsr     staxysp
+	stz     sreg
+	stz     sreg+1
+	lda     #$0A
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosoreax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01D8
+	cmp     #$0E
+	beq     L0229
+L01D8:	ldx     #$01
+	lda     #$7B
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0146
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0146:	ldx     #$00
+L0229:	lda     #$0C
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$0A
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$1E
+	ora     (sp),y
+	pha
+	iny
+	lda     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01D9
+	cmp     #$0E
+	beq     L022A
+L01D9:	ldx     #$01
+	lda     #$7C
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0149
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0149:	ldx     #$00
+L022A:	lda     #$0C
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$0A
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$1A
+	ora     (sp),y
+	pha
+	iny
+	lda     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01DA
+	cmp     #$0E
+	beq     L022B
+L01DA:	ldx     #$01
+	lda     #$7D
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L014C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L014C:	ldx     #$00
+L022B:	lda     #$0C
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$0A
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$1A
+	ora     (sp),y
+	pha
+	iny
+	lda     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01DB
+	cmp     #$0E
+	beq     L022C
+L01DB:	ldx     #$01
+	lda     #$7E
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L014F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L014F:	ldx     #$00
+L022C:	lda     #$0C
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$0A
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$1A
+	ora     (sp),y
+	pha
+	iny
+	lda     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01DC
+	cmp     #$0E
+	beq     L022D
+L01DC:	ldx     #$01
+	lda     #$7F
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0152
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0152:	ldx     #$00
+L022D:	lda     #$0C
+	ldy     #$1A
+	jsr     staxysp
+	stz     sreg
+	stz     sreg+1
+	lda     #$0A
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosoreax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L01DD
+	cmp     #$0E
+	beq     L022E
+L01DD:	ldx     #$01
+	lda     #$80
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0155
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0155:	ldx     #$00
+L022E:	lda     #$0C
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$0A
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$1A
+	ora     (sp),y
+	pha
+	iny
+	lda     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01DE
+	cmp     #$0E
+	beq     L022F
+L01DE:	ldx     #$01
+	lda     #$81
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0158
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0158:	ldx     #$00
+L022F:	stz     sreg
+	stz     sreg+1
+	lda     #$0C
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$0A
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$24
+	ldx     #$00
+	lda     (sp),y
+	jsr     axulong
+	jsr     tosoreax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$0E
+	jsr     tosneeax
+	beq     L015A
+	ldx     #$01
+	lda     #$82
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L015A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L015A:	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$0C
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$0A
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$21
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosoreax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$0E
+	jsr     tosneeax
+	beq     L015C
+	ldx     #$01
+	lda     #$83
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L015C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L015C:	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$0C
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$0A
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$1D
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosoreax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$0E
+	jsr     tosneeax
+	beq     L015E
+	ldx     #$01
+	lda     #$84
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L015E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L015E:	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$0C
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$0A
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     tosoreax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$0E
+	jsr     tosneeax
+	beq     L0160
+	ldx     #$01
+	lda     #$85
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0160
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0160:	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$0C
+	ldy     #$14
+	jsr     steaxysp
+	lda     #$0A
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axulong
+	jsr     tosoreax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$0E
+	jsr     tosneeax
+	beq     L0162
+	ldx     #$01
+	lda     #$86
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0162
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0162:	ldx     #$00
+	lda     #$0C
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$0A
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$0E
+	ora     (sp),y
+	pha
+	iny
+	lda     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01DF
+	cmp     #$0E
+	beq     L0230
+L01DF:	ldx     #$01
+	lda     #$87
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0165
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0165:	ldx     #$00
+L0230:	lda     #$0C
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$0A
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$0E
+	ora     (sp),y
+	pha
+	iny
+	lda     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01E0
+	cmp     #$0E
+	beq     L0231
+L01E0:	ldx     #$01
+	lda     #$88
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0168
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0168:	ldx     #$00
+L0231:	lda     #$0C
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$0A
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$0E
+	ora     (sp),y
+	pha
+	iny
+	lda     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01E1
+	cmp     #$0E
+	beq     L0232
+L01E1:	ldx     #$01
+	lda     #$89
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L016B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L016B:	ldx     #$00
+L0232:	lda     #$0C
+	ldy     #$0E
+	jsr     staxysp
+	stz     sreg
+	stz     sreg+1
+	lda     #$0A
+	ldy     #$10
+	jsr     steaxysp
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosoreax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01E2
+	cmp     #$0E
+	beq     L0233
+L01E2:	ldx     #$01
+	lda     #$8A
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L016E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L016E:	ldx     #$00
+L0233:	lda     #$0C
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$0A
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$0E
+	ora     (sp),y
+	pha
+	iny
+	lda     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01E3
+	cmp     #$0E
+	beq     L0171
+L01E3:	ldx     #$01
+	lda     #$8B
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0171
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L0171:	ldy     #$24
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L0174
+	ldx     #$00
+	lda     #$01
+	ldy     #$22
+	jsr     staxysp
+	ldy     #$29
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L01E4
+	cmp     #$00
+	beq     L0174
+L01E4:	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L0174:	ldy     #$23
+	jsr     ldaxysp
+	ldy     #$2A
+	jmp     addysp
+
+.segment	"DATA"
+
+M0001:
+	.byte	$4C,$6F,$63,$61,$6C,$20,$65,$72,$72,$6F,$72,$20,$25,$64,$2E,$0A
+	.byte	$00
+M0002:
+	.byte	$73,$37,$31,$34,$2C,$65,$72,$25,$64,$0A,$00
+M0003:
+	.byte	$73,$37,$31,$34,$20,$20,$20,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ section (int j, void *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_section: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$02
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	bne     L0003
+	jsr     ldax0sp
+	jsr     _s714
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	ldx     #$00
+	lda     #$01
+	sta     M0001+14
+	stz     M0001+14+1
+	sta     M0001+16
+	stz     M0001+16+1
+	sta     M0001+18
+	stz     M0001+18+1
+	sta     M0001+20
+	stz     M0001+20+1
+	lda     #>(M0001)
+	sta     M0002+1
+	lda     #<(M0001)
+	sta     M0002
+	txa
+	jsr     stax0sp
+	bra     L0002
+L0005:	jsr     pushw0sp
+	lda     M0002
+	ldx     M0002+1
+	jsr     _section
+	sta     M0001+22
+	stx     M0001+22+1
+	lda     M0001+24
+	clc
+	adc     M0001+22
+	sta     M0001+24
+	lda     M0001+24+1
+	adc     M0001+22+1
+	sta     M0001+24+1
+	lda     M0001+14
+	ora     M0001+14+1
+	beq     L0007
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     #<(M0001+26)
+	ldx     #>(M0001+26)
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+L0007:	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+L0002:	jsr     ldax0sp
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	bmi     L0005
+	lda     M0001+24
+	ora     M0001+24+1
+	bne     L0009
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	bra     L000E
+L0009:	lda     #<(S0006)
+	ldx     #>(S0006)
+L000E:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     M0001+24
+	ldx     M0001+24+1
+	jmp     incsp6
+
+.segment	"BSS"
+
+M0001:
+	.res	34,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
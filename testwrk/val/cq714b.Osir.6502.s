@@ -0,0 +1,6377 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_printf
+	.export		_lbits
+	.export		_ubits
+	.export		_fbits
+	.export		_dbits
+	.export		_flgs
+	.export		_flgm
+	.export		_flgd
+	.export		_flgl
+	.export		_rrc
+	.export		_crc
+	.export		_rfs
+	.export		_s714
+	.export		_section
+	.export		_main
+
+.segment	"RODATA"
+
+S0004:
+	.byte	$53,$65,$63,$74,$69,$6F,$6E,$20,$25,$73,$20,$72,$65,$74,$75,$72
+	.byte	$6E,$65,$64,$20,$25,$64,$2E,$0A,$00
+S0005:
+	.byte	$0A,$4E,$6F,$20,$65,$72,$72,$6F,$72,$73,$20,$64,$65,$74,$65,$63
+	.byte	$74,$65,$64,$2E,$0A,$00
+S0006:
+	.byte	$0A,$46,$61,$69,$6C,$65,$64,$2E,$0A,$00
+
+.segment	"BSS"
+
+_lbits:
+	.res	2,$00
+_ubits:
+	.res	2,$00
+_fbits:
+	.res	2,$00
+_dbits:
+	.res	2,$00
+_flgs:
+	.res	2,$00
+_flgm:
+	.res	2,$00
+_flgd:
+	.res	2,$00
+_flgl:
+	.res	2,$00
+_rrc:
+	.res	2,$00
+_crc:
+	.res	2,$00
+_rfs:
+	.res	8,$00
+
+; ---------------------------------------------------------------
+; int __near__ s714 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s714: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+3
+	jsr     pushax
+	ldy     #$24
+	jsr     subysp
+	lda     #<(M0003)
+	ldx     #>(M0003)
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$29
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$1A
+	bcc     L0002
+	inx
+L0002:	jsr     stax0sp
+	ldy     #$22
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	sta     regbank+2
+	sta     regbank+2+1
+	ldy     #$29
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$15
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	sta     regbank+4
+	stx     regbank+4+1
+L0003:	jsr     pushw0sp
+	ldy     #$05
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$00
+	lda     (ptr1),y
+	jsr     staspidx
+	tax
+	php
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	bne     L0003
+	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$22
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosmoda0
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L0199
+	cmp     #$01
+	beq     L0008
+L0199:	ldx     #$01
+	lda     #$00
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0008
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0008:	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	jsr     pushwysp
+	ldy     #$1F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmodax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L019A
+	cmp     #$01
+	beq     L000B
+L019A:	lda     #$01
+	sta     regbank+2
+	sta     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L000B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L000B:	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$1B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmodax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L019B
+	cmp     #$01
+	beq     L000E
+L019B:	ldx     #$01
+	lda     #$02
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L000E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L000E:	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosmodeax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L019C
+	cmp     #$01
+	beq     L0011
+L019C:	ldx     #$01
+	lda     #$03
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0011
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0011:	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$0F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumodax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L019D
+	cmp     #$01
+	beq     L01EF
+L019D:	ldx     #$01
+	lda     #$04
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L01EF
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L01EF:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$24
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosmod0ax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     tosneeax
+	beq     L0016
+	ldx     #$01
+	lda     #$05
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0016
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0016:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$21
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     axlong
+	jsr     tosmodeax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     tosneeax
+	beq     L0018
+	ldx     #$01
+	lda     #$06
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0018
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0018:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$1D
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     axlong
+	jsr     tosmodeax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     tosneeax
+	beq     L001A
+	ldx     #$01
+	lda     #$07
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L001A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L001A:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     tosmodeax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     tosneeax
+	beq     L001C
+	ldx     #$01
+	lda     #$08
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L001C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L001C:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$11
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosmod0ax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     tosneeax
+	beq     L001E
+	ldx     #$01
+	lda     #$09
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L001E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L001E:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$22
+	lda     (sp),y
+	jsr     tosumoda0
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L019E
+	cmp     #$01
+	beq     L0021
+L019E:	ldx     #$01
+	lda     #$0A
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0021
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0021:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$1F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumodax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L019F
+	cmp     #$01
+	beq     L0024
+L019F:	ldx     #$01
+	lda     #$0B
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0024
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0024:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$1B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumodax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01A0
+	cmp     #$01
+	beq     L0027
+L01A0:	ldx     #$01
+	lda     #$0C
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0027
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0027:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosmodeax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01A1
+	cmp     #$01
+	beq     L002A
+L01A1:	ldx     #$01
+	lda     #$0D
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L002A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L002A:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$0F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumodax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01A2
+	cmp     #$01
+	beq     L002D
+L01A2:	ldx     #$01
+	lda     #$0E
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L002D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L002D:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	lda     #$02
+	dey
+	sta     (sp),y
+	iny
+	lda     (sp),y
+	sta     sreg
+	dey
+	lda     (sp),y
+	tay
+	lda     sreg
+L017C:	lsr     a
+	dey
+	bpl     L017C
+	rol     a
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$01
+	beq     L0180
+	ldx     #$01
+	lda     #$0F
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0180
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0180:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	sta     sreg
+	ldy     #$1C
+	lda     (sp),y
+	tay
+	lda     sreg
+L017D:	lsr     a
+	dey
+	bpl     L017D
+	rol     a
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$01
+	beq     L0181
+	ldx     #$01
+	lda     #$10
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0181
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0181:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	sta     sreg
+	ldy     #$18
+	lda     (sp),y
+	tay
+	lda     sreg
+L017E:	lsr     a
+	dey
+	bpl     L017E
+	rol     a
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$01
+	beq     L0182
+	ldx     #$01
+	lda     #$11
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0182
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0182:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosasreax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$01
+	beq     L0183
+	ldx     #$01
+	lda     #$12
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0183
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0183:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	sta     sreg
+	ldy     #$0C
+	lda     (sp),y
+	tay
+	lda     sreg
+L017F:	lsr     a
+	dey
+	bpl     L017F
+	rol     a
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$01
+	beq     L0184
+	ldx     #$01
+	lda     #$13
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0184
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0184:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	ldy     #$20
+	lda     (sp),y
+	tay
+	lda     sreg
+	ldx     sreg+1
+	jsr     asraxy
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01A3
+	cmp     #$01
+	beq     L003A
+L01A3:	ldx     #$01
+	lda     #$14
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L003A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L003A:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1F
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	ldy     #$1C
+	lda     (sp),y
+	tay
+	lda     sreg
+	ldx     sreg+1
+	jsr     asraxy
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01A4
+	cmp     #$01
+	beq     L003D
+L01A4:	ldx     #$01
+	lda     #$15
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L003D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L003D:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1F
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	ldy     #$18
+	lda     (sp),y
+	tay
+	lda     sreg
+	ldx     sreg+1
+	jsr     asraxy
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01A5
+	cmp     #$01
+	beq     L0040
+L01A5:	ldx     #$01
+	lda     #$16
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0040
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0040:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosasreax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01A6
+	cmp     #$01
+	beq     L0043
+L01A6:	ldx     #$01
+	lda     #$17
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0043
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0043:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1F
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	ldy     #$0C
+	lda     (sp),y
+	tay
+	lda     sreg
+	ldx     sreg+1
+	jsr     shraxy
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01A7
+	cmp     #$01
+	beq     L0046
+L01A7:	ldx     #$01
+	lda     #$18
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0046
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0046:	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$1B
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	ldy     #$20
+	lda     (sp),y
+	tay
+	lda     sreg
+	ldx     sreg+1
+	jsr     asraxy
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L01A8
+	cmp     #$01
+	beq     L0049
+L01A8:	ldx     #$01
+	lda     #$19
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0049
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0049:	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1B
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	ldy     #$1C
+	lda     (sp),y
+	tay
+	lda     sreg
+	ldx     sreg+1
+	jsr     asraxy
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L01A9
+	cmp     #$01
+	beq     L004C
+L01A9:	ldx     #$01
+	lda     #$1A
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L004C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L004C:	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1B
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	ldy     #$18
+	lda     (sp),y
+	tay
+	lda     sreg
+	ldx     sreg+1
+	jsr     asraxy
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L01AA
+	cmp     #$01
+	beq     L004F
+L01AA:	ldx     #$01
+	lda     #$1B
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L004F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L004F:	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosasreax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L01AB
+	cmp     #$01
+	beq     L0052
+L01AB:	ldx     #$01
+	lda     #$1C
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0052
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0052:	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1B
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$0C
+	lda     (sp),y
+	tay
+	lda     ptr1
+	ldx     ptr1+1
+	jsr     shraxy
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L01AC
+	cmp     #$01
+	beq     L01F0
+L01AC:	ldx     #$01
+	lda     #$1D
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L01F0
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L01F0:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$24
+	lda     (sp),y
+	jsr     tosasreax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     tosneeax
+	beq     L0057
+	ldx     #$01
+	lda     #$1E
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0057
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0057:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$21
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     axlong
+	jsr     tosasreax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     tosneeax
+	beq     L0059
+	ldx     #$01
+	lda     #$1F
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0059
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0059:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$1D
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     axlong
+	jsr     tosasreax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     tosneeax
+	beq     L005B
+	ldx     #$01
+	lda     #$20
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L005B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L005B:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     tosasreax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     tosneeax
+	beq     L005D
+	ldx     #$01
+	lda     #$21
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L005D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L005D:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$10
+	lda     (sp),y
+	jsr     tosasreax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     tosneeax
+	beq     L005F
+	ldx     #$01
+	lda     #$22
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L005F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L005F:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$0F
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	ldy     #$20
+	lda     (sp),y
+	tay
+	lda     sreg
+	ldx     sreg+1
+	jsr     shraxy
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01AD
+	cmp     #$01
+	beq     L0062
+L01AD:	ldx     #$01
+	lda     #$23
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0062
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0062:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0F
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	ldy     #$1C
+	lda     (sp),y
+	tay
+	lda     sreg
+	ldx     sreg+1
+	jsr     shraxy
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01AE
+	cmp     #$01
+	beq     L0065
+L01AE:	ldx     #$01
+	lda     #$24
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0065
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0065:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0F
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	ldy     #$18
+	lda     (sp),y
+	tay
+	lda     sreg
+	ldx     sreg+1
+	jsr     shraxy
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01AF
+	cmp     #$01
+	beq     L0068
+L01AF:	ldx     #$01
+	lda     #$25
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0068
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0068:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosasreax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01B0
+	cmp     #$01
+	beq     L006B
+L01B0:	ldx     #$01
+	lda     #$26
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L006B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L006B:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0F
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	ldy     #$0C
+	lda     (sp),y
+	tay
+	lda     sreg
+	ldx     sreg+1
+	jsr     shraxy
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01B1
+	cmp     #$01
+	beq     L006E
+L01B1:	ldx     #$01
+	lda     #$27
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L006E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L006E:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	lda     #$02
+	dey
+	sta     (sp),y
+	iny
+	lda     (sp),y
+	sta     sreg
+	dey
+	lda     (sp),y
+	tay
+	lda     sreg
+L0178:	asl     a
+	dey
+	bpl     L0178
+	ror     a
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$14
+	beq     L0185
+	ldx     #$01
+	lda     #$28
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0185
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0185:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	sta     sreg
+	ldy     #$1C
+	lda     (sp),y
+	tay
+	lda     sreg
+L0179:	asl     a
+	dey
+	bpl     L0179
+	ror     a
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$14
+	beq     L0186
+	ldx     #$01
+	lda     #$29
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0186
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0186:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	sta     sreg
+	ldy     #$18
+	lda     (sp),y
+	tay
+	lda     sreg
+L017A:	asl     a
+	dey
+	bpl     L017A
+	ror     a
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$14
+	beq     L0187
+	ldx     #$01
+	lda     #$2A
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0187
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0187:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosasleax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$14
+	beq     L0188
+	ldx     #$01
+	lda     #$2B
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0188
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0188:	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	sta     sreg
+	ldy     #$0C
+	lda     (sp),y
+	tay
+	lda     sreg
+L017B:	asl     a
+	dey
+	bpl     L017B
+	ror     a
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$14
+	beq     L0189
+	ldx     #$01
+	lda     #$2C
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0189
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0189:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	ldy     #$20
+	lda     (sp),y
+	tay
+	lda     sreg
+	ldx     sreg+1
+	jsr     aslaxy
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01B2
+	cmp     #$14
+	beq     L007B
+L01B2:	ldx     #$01
+	lda     #$2D
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L007B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L007B:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1F
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	ldy     #$1C
+	lda     (sp),y
+	tay
+	lda     sreg
+	ldx     sreg+1
+	jsr     aslaxy
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01B3
+	cmp     #$14
+	beq     L007E
+L01B3:	ldx     #$01
+	lda     #$2E
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L007E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L007E:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1F
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	ldy     #$18
+	lda     (sp),y
+	tay
+	lda     sreg
+	ldx     sreg+1
+	jsr     aslaxy
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01B4
+	cmp     #$14
+	beq     L0081
+L01B4:	ldx     #$01
+	lda     #$2F
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0081
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0081:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosasleax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01B5
+	cmp     #$14
+	beq     L0084
+L01B5:	ldx     #$01
+	lda     #$30
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0084
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0084:	ldy     #$1E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1F
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	ldy     #$0C
+	lda     (sp),y
+	tay
+	lda     sreg
+	ldx     sreg+1
+	jsr     shlaxy
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01B6
+	cmp     #$14
+	beq     L0087
+L01B6:	ldx     #$01
+	lda     #$31
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0087
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0087:	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$1B
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	ldy     #$20
+	lda     (sp),y
+	tay
+	lda     sreg
+	ldx     sreg+1
+	jsr     aslaxy
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L01B7
+	cmp     #$14
+	beq     L008A
+L01B7:	ldx     #$01
+	lda     #$32
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L008A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L008A:	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1B
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	ldy     #$1C
+	lda     (sp),y
+	tay
+	lda     sreg
+	ldx     sreg+1
+	jsr     aslaxy
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L01B8
+	cmp     #$14
+	beq     L008D
+L01B8:	ldx     #$01
+	lda     #$33
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L008D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L008D:	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1B
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	ldy     #$18
+	lda     (sp),y
+	tay
+	lda     sreg
+	ldx     sreg+1
+	jsr     aslaxy
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L01B9
+	cmp     #$14
+	beq     L0090
+L01B9:	ldx     #$01
+	lda     #$34
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0090
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0090:	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosasleax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L01BA
+	cmp     #$14
+	beq     L0093
+L01BA:	ldx     #$01
+	lda     #$35
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0093
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0093:	ldy     #$1A
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1B
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$0C
+	lda     (sp),y
+	tay
+	lda     ptr1
+	ldx     ptr1+1
+	jsr     shlaxy
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L01BB
+	cmp     #$14
+	beq     L01F1
+L01BB:	ldx     #$01
+	lda     #$36
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L01F1
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L01F1:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$24
+	lda     (sp),y
+	jsr     tosasleax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$14
+	jsr     tosneeax
+	beq     L0098
+	ldx     #$01
+	lda     #$37
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0098
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0098:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$21
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     axlong
+	jsr     tosasleax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$14
+	jsr     tosneeax
+	beq     L009A
+	ldx     #$01
+	lda     #$38
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L009A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L009A:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$1D
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     axlong
+	jsr     tosasleax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$14
+	jsr     tosneeax
+	beq     L009C
+	ldx     #$01
+	lda     #$39
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L009C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L009C:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     tosasleax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$14
+	jsr     tosneeax
+	beq     L009E
+	ldx     #$01
+	lda     #$3A
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L009E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L009E:	ldy     #$14
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$10
+	lda     (sp),y
+	jsr     tosasleax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$14
+	jsr     tosneeax
+	beq     L00A0
+	ldx     #$01
+	lda     #$3B
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L00A0
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00A0:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$0F
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	ldy     #$20
+	lda     (sp),y
+	tay
+	lda     sreg
+	ldx     sreg+1
+	jsr     shlaxy
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01BC
+	cmp     #$14
+	beq     L00A3
+L01BC:	ldx     #$01
+	lda     #$3C
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L00A3
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00A3:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0F
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	ldy     #$1C
+	lda     (sp),y
+	tay
+	lda     sreg
+	ldx     sreg+1
+	jsr     shlaxy
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01BD
+	cmp     #$14
+	beq     L00A6
+L01BD:	ldx     #$01
+	lda     #$3D
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L00A6
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00A6:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$18
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0F
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	ldy     #$18
+	lda     (sp),y
+	tay
+	lda     sreg
+	ldx     sreg+1
+	jsr     shlaxy
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01BE
+	cmp     #$14
+	beq     L00A9
+L01BE:	ldx     #$01
+	lda     #$3E
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L00A9
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00A9:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosasleax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01BF
+	cmp     #$14
+	beq     L00AC
+L01BF:	ldx     #$01
+	lda     #$3F
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L00AC
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00AC:	ldy     #$0E
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0F
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	ldy     #$0C
+	lda     (sp),y
+	tay
+	lda     sreg
+	ldx     sreg+1
+	jsr     shlaxy
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01C0
+	cmp     #$14
+	beq     L00AF
+L01C0:	ldx     #$01
+	lda     #$40
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L00AF
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00AF:	lda     #$0C
+	ldy     #$21
+	sta     (sp),y
+	lda     #$0A
+	dey
+	sta     (sp),y
+	iny
+	and     (sp),y
+	sta     (sp),y
+	cmp     #$08
+	beq     L018A
+	ldx     #$01
+	lda     #$41
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L018A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L018A:	lda     #$0C
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	sta     sreg
+	ldy     #$1C
+	lda     (sp),y
+	and     sreg
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$08
+	beq     L018B
+	ldx     #$01
+	lda     #$42
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L018B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L018B:	lda     #$0C
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$18
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	sta     sreg
+	ldy     #$18
+	lda     (sp),y
+	and     sreg
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$08
+	beq     L018C
+	ldx     #$01
+	lda     #$43
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L018C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L018C:	lda     #$0C
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$10
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosandeax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$08
+	beq     L018D
+	ldx     #$01
+	lda     #$44
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L018D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L018D:	lda     #$0C
+	ldy     #$21
+	sta     (sp),y
+	tay
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	sta     sreg
+	ldy     #$0C
+	lda     (sp),y
+	and     sreg
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$08
+	beq     L018E
+	ldx     #$01
+	lda     #$45
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L018E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L018E:	ldy     #$1E
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$0A
+	iny
+	sta     (sp),y
+	ldy     #$1E
+	and     (sp),y
+	pha
+	lda     #$00
+	iny
+	and     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01C1
+	cmp     #$08
+	beq     L00BC
+L01C1:	ldx     #$01
+	lda     #$46
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L00BC
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00BC:	ldy     #$1E
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$1E
+	and     (sp),y
+	pha
+	txa
+	iny
+	and     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01C2
+	cmp     #$08
+	beq     L00BF
+L01C2:	ldx     #$01
+	lda     #$47
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L00BF
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00BF:	ldy     #$1E
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$18
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$1E
+	and     (sp),y
+	pha
+	txa
+	iny
+	and     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01C3
+	cmp     #$08
+	beq     L00C2
+L01C3:	ldx     #$01
+	lda     #$48
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L00C2
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00C2:	ldy     #$1E
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosandeax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01C4
+	cmp     #$08
+	beq     L00C5
+L01C4:	ldx     #$01
+	lda     #$49
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L00C5
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00C5:	ldy     #$1E
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$1E
+	and     (sp),y
+	pha
+	txa
+	iny
+	and     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01C5
+	cmp     #$08
+	beq     L00C8
+L01C5:	ldx     #$01
+	lda     #$4A
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L00C8
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00C8:	ldy     #$1A
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$0A
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$1A
+	and     (sp),y
+	pha
+	lda     #$00
+	iny
+	and     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01C6
+	cmp     #$08
+	beq     L00CB
+L01C6:	ldx     #$01
+	lda     #$4B
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L00CB
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00CB:	ldy     #$1A
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$1A
+	and     (sp),y
+	pha
+	txa
+	iny
+	and     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01C7
+	cmp     #$08
+	beq     L00CE
+L01C7:	ldx     #$01
+	lda     #$4C
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L00CE
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00CE:	ldy     #$1A
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$18
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$1A
+	and     (sp),y
+	pha
+	txa
+	iny
+	and     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01C8
+	cmp     #$08
+	beq     L00D1
+L01C8:	ldx     #$01
+	lda     #$4D
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L00D1
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00D1:	ldy     #$1A
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosandeax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L01C9
+	cmp     #$08
+	beq     L00D4
+L01C9:	ldx     #$01
+	lda     #$4E
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L00D4
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00D4:	ldy     #$1A
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$1A
+	and     (sp),y
+	pha
+	txa
+	iny
+	and     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01CA
+	cmp     #$08
+	beq     L01F2
+L01CA:	ldx     #$01
+	lda     #$4F
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L01F2
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L01F2:	ldy     #$14
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$0A
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$24
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosand0ax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     tosneeax
+	beq     L00D9
+	ldx     #$01
+	lda     #$50
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L00D9
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00D9:	ldy     #$14
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$21
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     axlong
+	jsr     tosandeax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     tosneeax
+	beq     L00DB
+	ldx     #$01
+	lda     #$51
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L00DB
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00DB:	ldy     #$14
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$1D
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     axlong
+	jsr     tosandeax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     tosneeax
+	beq     L00DD
+	ldx     #$01
+	lda     #$52
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L00DD
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00DD:	ldy     #$14
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     tosandeax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     tosneeax
+	beq     L00DF
+	ldx     #$01
+	lda     #$53
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L00DF
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00DF:	ldy     #$14
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$11
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosand0ax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     tosneeax
+	beq     L00E1
+	ldx     #$01
+	lda     #$54
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L00E1
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00E1:	ldy     #$0E
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$0A
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$0E
+	and     (sp),y
+	pha
+	lda     #$00
+	iny
+	and     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01CB
+	cmp     #$08
+	beq     L00E4
+L01CB:	ldx     #$01
+	lda     #$55
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L00E4
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00E4:	ldy     #$0E
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$0E
+	and     (sp),y
+	pha
+	txa
+	iny
+	and     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01CC
+	cmp     #$08
+	beq     L00E7
+L01CC:	ldx     #$01
+	lda     #$56
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L00E7
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00E7:	ldy     #$0E
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$18
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$0E
+	and     (sp),y
+	pha
+	txa
+	iny
+	and     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01CD
+	cmp     #$08
+	beq     L00EA
+L01CD:	ldx     #$01
+	lda     #$57
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L00EA
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00EA:	ldy     #$0E
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosandeax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01CE
+	cmp     #$08
+	beq     L00ED
+L01CE:	ldx     #$01
+	lda     #$58
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L00ED
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00ED:	ldy     #$0E
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$0E
+	and     (sp),y
+	pha
+	txa
+	iny
+	and     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01CF
+	cmp     #$08
+	beq     L00F0
+L01CF:	ldx     #$01
+	lda     #$59
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L00F0
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00F0:	lda     #$0C
+	ldy     #$21
+	sta     (sp),y
+	lda     #$0A
+	dey
+	sta     (sp),y
+	iny
+	eor     (sp),y
+	sta     (sp),y
+	cmp     #$06
+	beq     L018F
+	ldx     #$01
+	lda     #$5A
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L018F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L018F:	lda     #$0C
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	sta     sreg
+	ldy     #$1C
+	lda     (sp),y
+	eor     sreg
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$06
+	beq     L0190
+	ldx     #$01
+	lda     #$5B
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0190
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0190:	lda     #$0C
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$18
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	sta     sreg
+	ldy     #$18
+	lda     (sp),y
+	eor     sreg
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$06
+	beq     L0191
+	ldx     #$01
+	lda     #$5C
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0191
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0191:	lda     #$0C
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$10
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosxoreax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$06
+	beq     L0192
+	ldx     #$01
+	lda     #$5D
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0192
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0192:	lda     #$0C
+	ldy     #$21
+	sta     (sp),y
+	tay
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	sta     sreg
+	ldy     #$0C
+	lda     (sp),y
+	eor     sreg
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$06
+	beq     L0193
+	ldx     #$01
+	lda     #$5E
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0193
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0193:	ldy     #$1E
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$0A
+	iny
+	sta     (sp),y
+	ldy     #$1E
+	eor     (sp),y
+	pha
+	iny
+	lda     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01D0
+	cmp     #$06
+	beq     L00FD
+L01D0:	ldx     #$01
+	lda     #$5F
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L00FD
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00FD:	ldy     #$1E
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$1E
+	eor     (sp),y
+	pha
+	txa
+	iny
+	eor     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01D1
+	cmp     #$06
+	beq     L0100
+L01D1:	ldx     #$01
+	lda     #$60
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0100
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0100:	ldy     #$1E
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$18
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$1E
+	eor     (sp),y
+	pha
+	txa
+	iny
+	eor     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01D2
+	cmp     #$06
+	beq     L0103
+L01D2:	ldx     #$01
+	lda     #$61
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0103
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0103:	ldy     #$1E
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosxoreax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01D3
+	cmp     #$06
+	beq     L0106
+L01D3:	ldx     #$01
+	lda     #$62
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0106
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0106:	ldy     #$1E
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$1E
+	eor     (sp),y
+	pha
+	txa
+	iny
+	eor     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01D4
+	cmp     #$06
+	beq     L0109
+L01D4:	ldx     #$01
+	lda     #$63
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0109
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0109:	ldy     #$1A
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$0A
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$1A
+	eor     (sp),y
+	pha
+	iny
+	lda     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01D5
+	cmp     #$06
+	beq     L010C
+L01D5:	ldx     #$01
+	lda     #$64
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L010C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L010C:	ldy     #$1A
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$1A
+	eor     (sp),y
+	pha
+	txa
+	iny
+	eor     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01D6
+	cmp     #$06
+	beq     L010F
+L01D6:	ldx     #$01
+	lda     #$65
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L010F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L010F:	ldy     #$1A
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$18
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$1A
+	eor     (sp),y
+	pha
+	txa
+	iny
+	eor     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01D7
+	cmp     #$06
+	beq     L0112
+L01D7:	ldx     #$01
+	lda     #$66
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0112
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0112:	ldy     #$1A
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosxoreax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L01D8
+	cmp     #$06
+	beq     L0115
+L01D8:	ldx     #$01
+	lda     #$67
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0115
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0115:	ldy     #$1A
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$1A
+	eor     (sp),y
+	pha
+	txa
+	iny
+	eor     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01D9
+	cmp     #$06
+	beq     L01F3
+L01D9:	ldx     #$01
+	lda     #$68
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L01F3
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L01F3:	ldy     #$14
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$0A
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$24
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosxor0ax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$06
+	jsr     tosneeax
+	beq     L011A
+	ldx     #$01
+	lda     #$69
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L011A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L011A:	ldy     #$14
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$21
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     axlong
+	jsr     tosxoreax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$06
+	jsr     tosneeax
+	beq     L011C
+	ldx     #$01
+	lda     #$6A
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L011C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L011C:	ldy     #$14
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$1D
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     axlong
+	jsr     tosxoreax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$06
+	jsr     tosneeax
+	beq     L011E
+	ldx     #$01
+	lda     #$6B
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L011E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L011E:	ldy     #$14
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     tosxoreax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$06
+	jsr     tosneeax
+	beq     L0120
+	ldx     #$01
+	lda     #$6C
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0120
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0120:	ldy     #$14
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$11
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosxor0ax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$06
+	jsr     tosneeax
+	beq     L0122
+	ldx     #$01
+	lda     #$6D
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0122
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0122:	ldy     #$0E
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$0A
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$0E
+	eor     (sp),y
+	pha
+	iny
+	lda     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01DA
+	cmp     #$06
+	beq     L0125
+L01DA:	ldx     #$01
+	lda     #$6E
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0125
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0125:	ldy     #$0E
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$0E
+	eor     (sp),y
+	pha
+	txa
+	iny
+	eor     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01DB
+	cmp     #$06
+	beq     L0128
+L01DB:	ldx     #$01
+	lda     #$6F
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0128
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0128:	ldy     #$0E
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$18
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$0E
+	eor     (sp),y
+	pha
+	txa
+	iny
+	eor     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01DC
+	cmp     #$06
+	beq     L012B
+L01DC:	ldx     #$01
+	lda     #$70
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L012B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L012B:	ldy     #$0E
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosxoreax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01DD
+	cmp     #$06
+	beq     L012E
+L01DD:	ldx     #$01
+	lda     #$71
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L012E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L012E:	ldy     #$0E
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$0E
+	eor     (sp),y
+	pha
+	txa
+	iny
+	eor     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01DE
+	cmp     #$06
+	beq     L0131
+L01DE:	ldx     #$01
+	lda     #$72
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0131
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0131:	lda     #$0C
+	ldy     #$21
+	sta     (sp),y
+	lda     #$0A
+	dey
+	sta     (sp),y
+	iny
+	ora     (sp),y
+	sta     (sp),y
+	cmp     #$0E
+	beq     L0194
+	ldx     #$01
+	lda     #$73
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0194
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0194:	lda     #$0C
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	sta     sreg
+	ldy     #$1C
+	lda     (sp),y
+	ora     sreg
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$0E
+	beq     L0195
+	ldx     #$01
+	lda     #$74
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0195
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0195:	lda     #$0C
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$18
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	sta     sreg
+	ldy     #$18
+	lda     (sp),y
+	ora     sreg
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$0E
+	beq     L0196
+	ldx     #$01
+	lda     #$75
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0196
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0196:	lda     #$0C
+	ldy     #$21
+	sta     (sp),y
+	ldy     #$10
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosoreax
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$0E
+	beq     L0197
+	ldx     #$01
+	lda     #$76
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0197
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0197:	lda     #$0C
+	ldy     #$21
+	sta     (sp),y
+	tay
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$21
+	lda     (sp),y
+	sta     sreg
+	ldy     #$0C
+	lda     (sp),y
+	ora     sreg
+	ldy     #$21
+	sta     (sp),y
+	cmp     #$0E
+	beq     L0198
+	ldx     #$01
+	lda     #$77
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0198
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0198:	ldy     #$1E
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$0A
+	iny
+	sta     (sp),y
+	ldy     #$1E
+	ora     (sp),y
+	pha
+	iny
+	lda     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01DF
+	cmp     #$0E
+	beq     L013E
+L01DF:	ldx     #$01
+	lda     #$78
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L013E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L013E:	ldy     #$1E
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$1E
+	ora     (sp),y
+	pha
+	txa
+	iny
+	ora     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01E0
+	cmp     #$0E
+	beq     L0141
+L01E0:	ldx     #$01
+	lda     #$79
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0141
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0141:	ldy     #$1E
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$18
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$1E
+	ora     (sp),y
+	pha
+	txa
+	iny
+	ora     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01E1
+	cmp     #$0E
+	beq     L0144
+L01E1:	ldx     #$01
+	lda     #$7A
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0144
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0144:	ldy     #$1E
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$21
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosoreax
+	ldy     #$1E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01E2
+	cmp     #$0E
+	beq     L0147
+L01E2:	ldx     #$01
+	lda     #$7B
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0147
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0147:	ldy     #$1E
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$1E
+	ora     (sp),y
+	pha
+	txa
+	iny
+	ora     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01E3
+	cmp     #$0E
+	beq     L014A
+L01E3:	ldx     #$01
+	lda     #$7C
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L014A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L014A:	ldy     #$1A
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$0A
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$1A
+	ora     (sp),y
+	pha
+	iny
+	lda     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01E4
+	cmp     #$0E
+	beq     L014D
+L01E4:	ldx     #$01
+	lda     #$7D
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L014D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L014D:	ldy     #$1A
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$1A
+	ora     (sp),y
+	pha
+	txa
+	iny
+	ora     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01E5
+	cmp     #$0E
+	beq     L0150
+L01E5:	ldx     #$01
+	lda     #$7E
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0150
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0150:	ldy     #$1A
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$18
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$1A
+	ora     (sp),y
+	pha
+	txa
+	iny
+	ora     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01E6
+	cmp     #$0E
+	beq     L0153
+L01E6:	ldx     #$01
+	lda     #$7F
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0153
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0153:	ldy     #$1A
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$1D
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosoreax
+	ldy     #$1A
+	jsr     staxysp
+	cpx     #$00
+	bne     L01E7
+	cmp     #$0E
+	beq     L0156
+L01E7:	ldx     #$01
+	lda     #$80
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0156
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0156:	ldy     #$1A
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$1A
+	ora     (sp),y
+	pha
+	txa
+	iny
+	ora     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01E8
+	cmp     #$0E
+	beq     L01F4
+L01E8:	ldx     #$01
+	lda     #$81
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L01F4
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L01F4:	ldy     #$14
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$0A
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$24
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosor0ax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0E
+	jsr     tosneeax
+	beq     L015B
+	ldx     #$01
+	lda     #$82
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L015B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L015B:	ldy     #$14
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$21
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     axlong
+	jsr     tosoreax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0E
+	jsr     tosneeax
+	beq     L015D
+	ldx     #$01
+	lda     #$83
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L015D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L015D:	ldy     #$14
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$1D
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     axlong
+	jsr     tosoreax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0E
+	jsr     tosneeax
+	beq     L015F
+	ldx     #$01
+	lda     #$84
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L015F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L015F:	ldy     #$14
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$10
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     tosoreax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0E
+	jsr     tosneeax
+	beq     L0161
+	ldx     #$01
+	lda     #$85
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0161
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0161:	ldy     #$14
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$11
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosor0ax
+	ldy     #$14
+	jsr     steaxysp
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0E
+	jsr     tosneeax
+	beq     L0163
+	ldx     #$01
+	lda     #$86
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0163
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0163:	ldy     #$0E
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$0A
+	ldy     #$20
+	sta     (sp),y
+	ldy     #$0E
+	ora     (sp),y
+	pha
+	iny
+	lda     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01E9
+	cmp     #$0E
+	beq     L0166
+L01E9:	ldx     #$01
+	lda     #$87
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0166
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0166:	ldy     #$0E
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$1C
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$0E
+	ora     (sp),y
+	pha
+	txa
+	iny
+	ora     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01EA
+	cmp     #$0E
+	beq     L0169
+L01EA:	ldx     #$01
+	lda     #$88
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0169
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0169:	ldy     #$0E
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$18
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$0E
+	ora     (sp),y
+	pha
+	txa
+	iny
+	ora     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01EB
+	cmp     #$0E
+	beq     L016C
+L01EB:	ldx     #$01
+	lda     #$89
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L016C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L016C:	ldy     #$0E
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosoreax
+	ldy     #$0E
+	jsr     staxysp
+	cpx     #$00
+	bne     L01EC
+	cmp     #$0E
+	beq     L016F
+L01EC:	ldx     #$01
+	lda     #$8A
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L016F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L016F:	ldy     #$0E
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$0E
+	ora     (sp),y
+	pha
+	txa
+	iny
+	ora     (sp),y
+	tax
+	pla
+	dey
+	jsr     staxysp
+	cpx     #$00
+	bne     L01ED
+	cmp     #$0E
+	beq     L0172
+L01ED:	ldx     #$01
+	lda     #$8B
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0172
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0172:	lda     regbank+2
+	ora     regbank+2+1
+	beq     L0175
+	ldy     #$22
+	lda     #$01
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$29
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$13
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     #$00
+	bne     L01EE
+	cmp     #$00
+	beq     L0175
+L01EE:	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L0175:	ldy     #$23
+	lda     (sp),y
+	sta     tmp1
+	dey
+	lda     (sp),y
+	pha
+	ldy     #$27
+	ldx     #$03
+L0177:	lda     (sp),y
+	sta     regbank+2,x
+	dey
+	dex
+	bpl     L0177
+	ldx     tmp1
+	pla
+	ldy     #$2A
+	jmp     addysp
+
+.segment	"DATA"
+
+M0001:
+	.byte	$4C,$6F,$63,$61,$6C,$20,$65,$72,$72,$6F,$72,$20,$25,$64,$2E,$0A
+	.byte	$00
+M0002:
+	.byte	$73,$37,$31,$34,$2C,$65,$72,$25,$64,$0A,$00
+M0003:
+	.byte	$73,$37,$31,$34,$20,$20,$20,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ section (int j, void *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_section: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$02
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	bne     L0003
+	ldy     #$01
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _s714
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	ldx     #$00
+	lda     #$01
+	sta     M0001+14
+	stx     M0001+14+1
+	sta     M0001+16
+	stx     M0001+16+1
+	sta     M0001+18
+	stx     M0001+18+1
+	sta     M0001+20
+	stx     M0001+20+1
+	lda     #>(M0001)
+	sta     M0002+1
+	lda     #<(M0001)
+	sta     M0002
+	ldy     #$00
+	txa
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L000D
+L0005:	jsr     pushw0sp
+	lda     M0002
+	ldx     M0002+1
+	jsr     _section
+	sta     M0001+22
+	stx     M0001+22+1
+	lda     M0001+24
+	clc
+	adc     M0001+22
+	sta     M0001+24
+	lda     M0001+24+1
+	adc     M0001+22+1
+	sta     M0001+24+1
+	lda     M0001+14
+	ora     M0001+14+1
+	beq     L0007
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     #<(M0001+26)
+	ldx     #>(M0001+26)
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+L0007:	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	ldy     #$01
+L000D:	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	bmi     L0005
+	lda     M0001+24
+	ora     M0001+24+1
+	bne     L0009
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jmp     L000F
+L0009:	lda     #<(S0006)
+	ldx     #>(S0006)
+L000F:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     M0001+24
+	ldx     M0001+24+1
+	jmp     incsp6
+
+.segment	"BSS"
+
+M0001:
+	.res	34,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
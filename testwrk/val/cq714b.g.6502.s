@@ -0,0 +1,6945 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "cq714b.c", 19809, 1613073744
+	.dbg		file, "common.h", 522, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/stdlib.h", 5999, 1613073744
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_lbits
+	.export		_ubits
+	.export		_fbits
+	.export		_dbits
+	.export		_flgs
+	.export		_flgm
+	.export		_flgd
+	.export		_flgl
+	.export		_rrc
+	.export		_crc
+	.export		_rfs
+	.export		_s714
+	.export		_section
+	.export		_main
+
+.segment	"RODATA"
+
+S0004:
+	.byte	$53,$65,$63,$74,$69,$6F,$6E,$20,$25,$73,$20,$72,$65,$74,$75,$72
+	.byte	$6E,$65,$64,$20,$25,$64,$2E,$0A,$00
+S0005:
+	.byte	$0A,$4E,$6F,$20,$65,$72,$72,$6F,$72,$73,$20,$64,$65,$74,$65,$63
+	.byte	$74,$65,$64,$2E,$0A,$00
+S0006:
+	.byte	$0A,$46,$61,$69,$6C,$65,$64,$2E,$0A,$00
+
+.segment	"BSS"
+
+_lbits:
+	.res	2,$00
+_ubits:
+	.res	2,$00
+_fbits:
+	.res	2,$00
+_dbits:
+	.res	2,$00
+_flgs:
+	.res	2,$00
+_flgm:
+	.res	2,$00
+_flgd:
+	.res	2,$00
+_flgl:
+	.res	2,$00
+_rrc:
+	.res	2,$00
+_crc:
+	.res	2,$00
+_rfs:
+	.res	8,$00
+
+; ---------------------------------------------------------------
+; int __near__ s714 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s714: near
+
+	.dbg	func, "s714", "00", extern, "_s714"
+	.dbg	sym, "pd0", "00", auto, 0
+	.dbg	sym, "prlc", "00", auto, -2
+	.dbg	sym, "lrc", "00", auto, -4
+	.dbg	sym, "rc", "00", auto, -6
+	.dbg	sym, "cl", "00", auto, -7
+	.dbg	sym, "cr", "00", auto, -8
+	.dbg	sym, "sl", "00", auto, -10
+	.dbg	sym, "sr", "00", auto, -12
+	.dbg	sym, "il", "00", auto, -14
+	.dbg	sym, "ir", "00", auto, -16
+	.dbg	sym, "ll", "00", auto, -20
+	.dbg	sym, "lr", "00", auto, -24
+	.dbg	sym, "ul", "00", auto, -26
+	.dbg	sym, "ur", "00", auto, -28
+	.dbg	sym, "fl", "00", auto, -30
+	.dbg	sym, "fr", "00", auto, -32
+	.dbg	sym, "dl", "00", auto, -34
+	.dbg	sym, "dr", "00", auto, -36
+	.dbg	sym, "ps", "00", auto, -38
+	.dbg	sym, "pt", "00", auto, -40
+
+.segment	"CODE"
+
+	.dbg	line, "cq714b.c", 51
+	jsr     pushax
+	.dbg	line, "cq714b.c", 71
+	ldy     #$28
+	jsr     subysp
+	lda     #<(M0003)
+	ldx     #>(M0003)
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 72
+	ldy     #$29
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     incaxy
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 73
+	ldx     #$00
+	lda     #$00
+	ldy     #$22
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 74
+	ldx     #$00
+	lda     #$00
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 75
+	ldy     #$29
+	jsr     ldaxysp
+	ldy     #$15
+	jsr     ldaxidx
+	ldy     #$26
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 76
+	jmp     L0002
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$00
+	jsr     staspidx
+	tax
+	php
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	jne     L0002
+	.dbg	line, "cq714b.c", 122
+	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 123
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$22
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosmodax
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 124
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0006
+	cmp     #$01
+L0006:	jsr     boolne
+	jeq     L0007
+	.dbg	line, "cq714b.c", 125
+	ldx     #$01
+	lda     #$00
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 126
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0007
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 128
+L0007:	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 129
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosmodax
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 130
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0009
+	cmp     #$01
+L0009:	jsr     boolne
+	jeq     L000A
+	.dbg	line, "cq714b.c", 131
+	ldx     #$01
+	lda     #$01
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 132
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L000A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 134
+L000A:	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 135
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosmodax
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 136
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L000C
+	cmp     #$01
+L000C:	jsr     boolne
+	jeq     L000D
+	.dbg	line, "cq714b.c", 137
+	ldx     #$01
+	lda     #$02
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 138
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L000D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 140
+L000D:	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 141
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosmodeax
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 142
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L000F
+	cmp     #$01
+L000F:	jsr     boolne
+	jeq     L0010
+	.dbg	line, "cq714b.c", 143
+	ldx     #$01
+	lda     #$03
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 144
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0010
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 146
+L0010:	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 147
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosumodax
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 148
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0012
+	cmp     #$01
+L0012:	jsr     boolne
+	jeq     L0013
+	.dbg	line, "cq714b.c", 149
+	ldx     #$01
+	lda     #$04
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 150
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0013
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 152
+L0013:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 153
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$24
+	ldx     #$00
+	lda     (sp),y
+	jsr     axulong
+	jsr     tosmodeax
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 154
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     tosneeax
+	jeq     L0015
+	.dbg	line, "cq714b.c", 155
+	ldx     #$01
+	lda     #$05
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 156
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0015
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 158
+L0015:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 159
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$21
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosmodeax
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 160
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     tosneeax
+	jeq     L0017
+	.dbg	line, "cq714b.c", 161
+	ldx     #$01
+	lda     #$06
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 162
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0017
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 164
+L0017:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 165
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$1D
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosmodeax
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 166
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     tosneeax
+	jeq     L0019
+	.dbg	line, "cq714b.c", 167
+	ldx     #$01
+	lda     #$07
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 168
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0019
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 170
+L0019:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 171
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     tosmodeax
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 172
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     tosneeax
+	jeq     L001B
+	.dbg	line, "cq714b.c", 173
+	ldx     #$01
+	lda     #$08
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 174
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L001B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 176
+L001B:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 177
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axulong
+	jsr     tosmodeax
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 178
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     tosneeax
+	jeq     L001D
+	.dbg	line, "cq714b.c", 179
+	ldx     #$01
+	lda     #$09
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 180
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L001D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 182
+L001D:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 183
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$22
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosumodax
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 184
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L001F
+	cmp     #$01
+L001F:	jsr     boolne
+	jeq     L0020
+	.dbg	line, "cq714b.c", 185
+	ldx     #$01
+	lda     #$0A
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 186
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0020
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 188
+L0020:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 189
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosumodax
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 190
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0022
+	cmp     #$01
+L0022:	jsr     boolne
+	jeq     L0023
+	.dbg	line, "cq714b.c", 191
+	ldx     #$01
+	lda     #$0B
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 192
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0023
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 194
+L0023:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 195
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosumodax
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 196
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0025
+	cmp     #$01
+L0025:	jsr     boolne
+	jeq     L0026
+	.dbg	line, "cq714b.c", 197
+	ldx     #$01
+	lda     #$0C
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 198
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0026
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 200
+L0026:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 201
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosmodeax
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 202
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0028
+	cmp     #$01
+L0028:	jsr     boolne
+	jeq     L0029
+	.dbg	line, "cq714b.c", 203
+	ldx     #$01
+	lda     #$0D
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 204
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0029
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 206
+L0029:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 207
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosumodax
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 208
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L002B
+	cmp     #$01
+L002B:	jsr     boolne
+	jeq     L002C
+	.dbg	line, "cq714b.c", 209
+	ldx     #$01
+	lda     #$0E
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 210
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L002C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 212
+L002C:	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 213
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$22
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosshrax
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 214
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$01
+	jsr     boolne
+	jeq     L002E
+	.dbg	line, "cq714b.c", 215
+	ldx     #$01
+	lda     #$0F
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 216
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L002E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 218
+L002E:	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 219
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosasrax
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 220
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$01
+	jsr     boolne
+	jeq     L0030
+	.dbg	line, "cq714b.c", 221
+	ldx     #$01
+	lda     #$10
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 222
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0030
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 224
+L0030:	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 225
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosasrax
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 226
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$01
+	jsr     boolne
+	jeq     L0032
+	.dbg	line, "cq714b.c", 227
+	ldx     #$01
+	lda     #$11
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 228
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0032
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 230
+L0032:	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 231
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosasreax
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 232
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$01
+	jsr     boolne
+	jeq     L0034
+	.dbg	line, "cq714b.c", 233
+	ldx     #$01
+	lda     #$12
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 234
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0034
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 236
+L0034:	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 237
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosshrax
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 238
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$01
+	jsr     boolne
+	jeq     L0036
+	.dbg	line, "cq714b.c", 239
+	ldx     #$01
+	lda     #$13
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 240
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0036
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 242
+L0036:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 243
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$22
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosasrax
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 244
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0038
+	cmp     #$01
+L0038:	jsr     boolne
+	jeq     L0039
+	.dbg	line, "cq714b.c", 245
+	ldx     #$01
+	lda     #$14
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 246
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0039
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 248
+L0039:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 249
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosasrax
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 250
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L003B
+	cmp     #$01
+L003B:	jsr     boolne
+	jeq     L003C
+	.dbg	line, "cq714b.c", 251
+	ldx     #$01
+	lda     #$15
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 252
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L003C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 254
+L003C:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 255
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosasrax
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 256
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L003E
+	cmp     #$01
+L003E:	jsr     boolne
+	jeq     L003F
+	.dbg	line, "cq714b.c", 257
+	ldx     #$01
+	lda     #$16
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 258
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L003F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 260
+L003F:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 261
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosasreax
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 262
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0041
+	cmp     #$01
+L0041:	jsr     boolne
+	jeq     L0042
+	.dbg	line, "cq714b.c", 263
+	ldx     #$01
+	lda     #$17
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 264
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0042
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 266
+L0042:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 267
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosshrax
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 268
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0044
+	cmp     #$01
+L0044:	jsr     boolne
+	jeq     L0045
+	.dbg	line, "cq714b.c", 269
+	ldx     #$01
+	lda     #$18
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 270
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0045
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 272
+L0045:	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 273
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$22
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosasrax
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 274
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0047
+	cmp     #$01
+L0047:	jsr     boolne
+	jeq     L0048
+	.dbg	line, "cq714b.c", 275
+	ldx     #$01
+	lda     #$19
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 276
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0048
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 278
+L0048:	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 279
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosasrax
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 280
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L004A
+	cmp     #$01
+L004A:	jsr     boolne
+	jeq     L004B
+	.dbg	line, "cq714b.c", 281
+	ldx     #$01
+	lda     #$1A
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 282
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L004B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 284
+L004B:	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 285
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosasrax
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 286
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L004D
+	cmp     #$01
+L004D:	jsr     boolne
+	jeq     L004E
+	.dbg	line, "cq714b.c", 287
+	ldx     #$01
+	lda     #$1B
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 288
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L004E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 290
+L004E:	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 291
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosasreax
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 292
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0050
+	cmp     #$01
+L0050:	jsr     boolne
+	jeq     L0051
+	.dbg	line, "cq714b.c", 293
+	ldx     #$01
+	lda     #$1C
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 294
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0051
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 296
+L0051:	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 297
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosshrax
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 298
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0053
+	cmp     #$01
+L0053:	jsr     boolne
+	jeq     L0054
+	.dbg	line, "cq714b.c", 299
+	ldx     #$01
+	lda     #$1D
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 300
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0054
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 302
+L0054:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 303
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$24
+	ldx     #$00
+	lda     (sp),y
+	jsr     axulong
+	jsr     tosasreax
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 304
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     tosneeax
+	jeq     L0056
+	.dbg	line, "cq714b.c", 305
+	ldx     #$01
+	lda     #$1E
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 306
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0056
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 308
+L0056:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 309
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$21
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosasreax
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 310
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     tosneeax
+	jeq     L0058
+	.dbg	line, "cq714b.c", 311
+	ldx     #$01
+	lda     #$1F
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 312
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0058
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 314
+L0058:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 315
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$1D
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosasreax
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 316
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     tosneeax
+	jeq     L005A
+	.dbg	line, "cq714b.c", 317
+	ldx     #$01
+	lda     #$20
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 318
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L005A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 320
+L005A:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 321
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     tosasreax
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 322
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     tosneeax
+	jeq     L005C
+	.dbg	line, "cq714b.c", 323
+	ldx     #$01
+	lda     #$21
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 324
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L005C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 326
+L005C:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 327
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axulong
+	jsr     tosasreax
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 328
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     tosneeax
+	jeq     L005E
+	.dbg	line, "cq714b.c", 329
+	ldx     #$01
+	lda     #$22
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 330
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L005E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 332
+L005E:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 333
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$22
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosshrax
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 334
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0060
+	cmp     #$01
+L0060:	jsr     boolne
+	jeq     L0061
+	.dbg	line, "cq714b.c", 335
+	ldx     #$01
+	lda     #$23
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 336
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0061
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 338
+L0061:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 339
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosshrax
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 340
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0063
+	cmp     #$01
+L0063:	jsr     boolne
+	jeq     L0064
+	.dbg	line, "cq714b.c", 341
+	ldx     #$01
+	lda     #$24
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 342
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0064
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 344
+L0064:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 345
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosshrax
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 346
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0066
+	cmp     #$01
+L0066:	jsr     boolne
+	jeq     L0067
+	.dbg	line, "cq714b.c", 347
+	ldx     #$01
+	lda     #$25
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 348
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0067
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 350
+L0067:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 351
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosasreax
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 352
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0069
+	cmp     #$01
+L0069:	jsr     boolne
+	jeq     L006A
+	.dbg	line, "cq714b.c", 353
+	ldx     #$01
+	lda     #$26
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 354
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L006A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 356
+L006A:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 357
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosshrax
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 358
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L006C
+	cmp     #$01
+L006C:	jsr     boolne
+	jeq     L006D
+	.dbg	line, "cq714b.c", 359
+	ldx     #$01
+	lda     #$27
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 360
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L006D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 362
+L006D:	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 363
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$22
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosshlax
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 364
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$14
+	jsr     boolne
+	jeq     L006F
+	.dbg	line, "cq714b.c", 365
+	ldx     #$01
+	lda     #$28
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 366
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L006F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 368
+L006F:	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 369
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosaslax
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 370
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$14
+	jsr     boolne
+	jeq     L0071
+	.dbg	line, "cq714b.c", 371
+	ldx     #$01
+	lda     #$29
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 372
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0071
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 374
+L0071:	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 375
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosaslax
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 376
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$14
+	jsr     boolne
+	jeq     L0073
+	.dbg	line, "cq714b.c", 377
+	ldx     #$01
+	lda     #$2A
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 378
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0073
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 380
+L0073:	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 381
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosasleax
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 382
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$14
+	jsr     boolne
+	jeq     L0075
+	.dbg	line, "cq714b.c", 383
+	ldx     #$01
+	lda     #$2B
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 384
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0075
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 386
+L0075:	ldx     #$00
+	lda     #$05
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 387
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosshlax
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 388
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$14
+	jsr     boolne
+	jeq     L0077
+	.dbg	line, "cq714b.c", 389
+	ldx     #$01
+	lda     #$2C
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 390
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0077
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 392
+L0077:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 393
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$22
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosaslax
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 394
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0079
+	cmp     #$14
+L0079:	jsr     boolne
+	jeq     L007A
+	.dbg	line, "cq714b.c", 395
+	ldx     #$01
+	lda     #$2D
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 396
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L007A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 398
+L007A:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 399
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosaslax
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 400
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L007C
+	cmp     #$14
+L007C:	jsr     boolne
+	jeq     L007D
+	.dbg	line, "cq714b.c", 401
+	ldx     #$01
+	lda     #$2E
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 402
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L007D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 404
+L007D:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 405
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosaslax
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 406
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L007F
+	cmp     #$14
+L007F:	jsr     boolne
+	jeq     L0080
+	.dbg	line, "cq714b.c", 407
+	ldx     #$01
+	lda     #$2F
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 408
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0080
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 410
+L0080:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 411
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosasleax
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 412
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0082
+	cmp     #$14
+L0082:	jsr     boolne
+	jeq     L0083
+	.dbg	line, "cq714b.c", 413
+	ldx     #$01
+	lda     #$30
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 414
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0083
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 416
+L0083:	ldx     #$00
+	lda     #$05
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 417
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosshlax
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 418
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0085
+	cmp     #$14
+L0085:	jsr     boolne
+	jeq     L0086
+	.dbg	line, "cq714b.c", 419
+	ldx     #$01
+	lda     #$31
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 420
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0086
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 422
+L0086:	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 423
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$22
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosaslax
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 424
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0088
+	cmp     #$14
+L0088:	jsr     boolne
+	jeq     L0089
+	.dbg	line, "cq714b.c", 425
+	ldx     #$01
+	lda     #$32
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 426
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0089
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 428
+L0089:	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 429
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosaslax
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 430
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L008B
+	cmp     #$14
+L008B:	jsr     boolne
+	jeq     L008C
+	.dbg	line, "cq714b.c", 431
+	ldx     #$01
+	lda     #$33
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 432
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L008C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 434
+L008C:	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 435
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosaslax
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 436
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L008E
+	cmp     #$14
+L008E:	jsr     boolne
+	jeq     L008F
+	.dbg	line, "cq714b.c", 437
+	ldx     #$01
+	lda     #$34
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 438
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L008F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 440
+L008F:	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 441
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosasleax
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 442
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0091
+	cmp     #$14
+L0091:	jsr     boolne
+	jeq     L0092
+	.dbg	line, "cq714b.c", 443
+	ldx     #$01
+	lda     #$35
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 444
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0092
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 446
+L0092:	ldx     #$00
+	lda     #$05
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 447
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosshlax
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 448
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0094
+	cmp     #$14
+L0094:	jsr     boolne
+	jeq     L0095
+	.dbg	line, "cq714b.c", 449
+	ldx     #$01
+	lda     #$36
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 450
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0095
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 452
+L0095:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 453
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$24
+	ldx     #$00
+	lda     (sp),y
+	jsr     axulong
+	jsr     tosasleax
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 454
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$14
+	jsr     tosneeax
+	jeq     L0097
+	.dbg	line, "cq714b.c", 455
+	ldx     #$01
+	lda     #$37
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 456
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0097
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 458
+L0097:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 459
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$21
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosasleax
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 460
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$14
+	jsr     tosneeax
+	jeq     L0099
+	.dbg	line, "cq714b.c", 461
+	ldx     #$01
+	lda     #$38
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 462
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0099
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 464
+L0099:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 465
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$1D
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosasleax
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 466
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$14
+	jsr     tosneeax
+	jeq     L009B
+	.dbg	line, "cq714b.c", 467
+	ldx     #$01
+	lda     #$39
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 468
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L009B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 470
+L009B:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 471
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     tosasleax
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 472
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$14
+	jsr     tosneeax
+	jeq     L009D
+	.dbg	line, "cq714b.c", 473
+	ldx     #$01
+	lda     #$3A
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 474
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L009D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 476
+L009D:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$05
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 477
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axulong
+	jsr     tosasleax
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 478
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$14
+	jsr     tosneeax
+	jeq     L009F
+	.dbg	line, "cq714b.c", 479
+	ldx     #$01
+	lda     #$3B
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 480
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L009F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 482
+L009F:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 483
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$22
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosshlax
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 484
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00A1
+	cmp     #$14
+L00A1:	jsr     boolne
+	jeq     L00A2
+	.dbg	line, "cq714b.c", 485
+	ldx     #$01
+	lda     #$3C
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 486
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00A2
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 488
+L00A2:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 489
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosshlax
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 490
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00A4
+	cmp     #$14
+L00A4:	jsr     boolne
+	jeq     L00A5
+	.dbg	line, "cq714b.c", 491
+	ldx     #$01
+	lda     #$3D
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 492
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00A5
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 494
+L00A5:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 495
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosshlax
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 496
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00A7
+	cmp     #$14
+L00A7:	jsr     boolne
+	jeq     L00A8
+	.dbg	line, "cq714b.c", 497
+	ldx     #$01
+	lda     #$3E
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 498
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00A8
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 500
+L00A8:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 501
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosasleax
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 502
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00AA
+	cmp     #$14
+L00AA:	jsr     boolne
+	jeq     L00AB
+	.dbg	line, "cq714b.c", 503
+	ldx     #$01
+	lda     #$3F
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 504
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00AB
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 506
+L00AB:	ldx     #$00
+	lda     #$05
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 507
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosshlax
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 508
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00AD
+	cmp     #$14
+L00AD:	jsr     boolne
+	jeq     L00AE
+	.dbg	line, "cq714b.c", 509
+	ldx     #$01
+	lda     #$40
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 510
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00AE
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 512
+L00AE:	ldx     #$00
+	lda     #$0C
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$0A
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 513
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$22
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosandax
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 514
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$08
+	jsr     boolne
+	jeq     L00B0
+	.dbg	line, "cq714b.c", 515
+	ldx     #$01
+	lda     #$41
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 516
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00B0
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 518
+L00B0:	ldx     #$00
+	lda     #$0C
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$0A
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 519
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosandax
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 520
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$08
+	jsr     boolne
+	jeq     L00B2
+	.dbg	line, "cq714b.c", 521
+	ldx     #$01
+	lda     #$42
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 522
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00B2
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 524
+L00B2:	ldx     #$00
+	lda     #$0C
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$0A
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 525
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosandax
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 526
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$08
+	jsr     boolne
+	jeq     L00B4
+	.dbg	line, "cq714b.c", 527
+	ldx     #$01
+	lda     #$43
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 528
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00B4
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 530
+L00B4:	ldx     #$00
+	lda     #$0C
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0A
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 531
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosandeax
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 532
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$08
+	jsr     boolne
+	jeq     L00B6
+	.dbg	line, "cq714b.c", 533
+	ldx     #$01
+	lda     #$44
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 534
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00B6
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 536
+L00B6:	ldx     #$00
+	lda     #$0C
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$0A
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 537
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosandax
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 538
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$08
+	jsr     boolne
+	jeq     L00B8
+	.dbg	line, "cq714b.c", 539
+	ldx     #$01
+	lda     #$45
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 540
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00B8
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 542
+L00B8:	ldx     #$00
+	lda     #$0C
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$0A
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 543
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$22
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosandax
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 544
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00BA
+	cmp     #$08
+L00BA:	jsr     boolne
+	jeq     L00BB
+	.dbg	line, "cq714b.c", 545
+	ldx     #$01
+	lda     #$46
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 546
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00BB
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 548
+L00BB:	ldx     #$00
+	lda     #$0C
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$0A
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 549
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosandax
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 550
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00BD
+	cmp     #$08
+L00BD:	jsr     boolne
+	jeq     L00BE
+	.dbg	line, "cq714b.c", 551
+	ldx     #$01
+	lda     #$47
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 552
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00BE
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 554
+L00BE:	ldx     #$00
+	lda     #$0C
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$0A
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 555
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosandax
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 556
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00C0
+	cmp     #$08
+L00C0:	jsr     boolne
+	jeq     L00C1
+	.dbg	line, "cq714b.c", 557
+	ldx     #$01
+	lda     #$48
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 558
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00C1
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 560
+L00C1:	ldx     #$00
+	lda     #$0C
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0A
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 561
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosandeax
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 562
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00C3
+	cmp     #$08
+L00C3:	jsr     boolne
+	jeq     L00C4
+	.dbg	line, "cq714b.c", 563
+	ldx     #$01
+	lda     #$49
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 564
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00C4
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 566
+L00C4:	ldx     #$00
+	lda     #$0C
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$0A
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 567
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosandax
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 568
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00C6
+	cmp     #$08
+L00C6:	jsr     boolne
+	jeq     L00C7
+	.dbg	line, "cq714b.c", 569
+	ldx     #$01
+	lda     #$4A
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 570
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00C7
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 572
+L00C7:	ldx     #$00
+	lda     #$0C
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$0A
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 573
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$22
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosandax
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 574
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00C9
+	cmp     #$08
+L00C9:	jsr     boolne
+	jeq     L00CA
+	.dbg	line, "cq714b.c", 575
+	ldx     #$01
+	lda     #$4B
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 576
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00CA
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 578
+L00CA:	ldx     #$00
+	lda     #$0C
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$0A
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 579
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosandax
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 580
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00CC
+	cmp     #$08
+L00CC:	jsr     boolne
+	jeq     L00CD
+	.dbg	line, "cq714b.c", 581
+	ldx     #$01
+	lda     #$4C
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 582
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00CD
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 584
+L00CD:	ldx     #$00
+	lda     #$0C
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$0A
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 585
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosandax
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 586
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00CF
+	cmp     #$08
+L00CF:	jsr     boolne
+	jeq     L00D0
+	.dbg	line, "cq714b.c", 587
+	ldx     #$01
+	lda     #$4D
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 588
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00D0
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 590
+L00D0:	ldx     #$00
+	lda     #$0C
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0A
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 591
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosandeax
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 592
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00D2
+	cmp     #$08
+L00D2:	jsr     boolne
+	jeq     L00D3
+	.dbg	line, "cq714b.c", 593
+	ldx     #$01
+	lda     #$4E
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 594
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00D3
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 596
+L00D3:	ldx     #$00
+	lda     #$0C
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$0A
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 597
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosandax
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 598
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00D5
+	cmp     #$08
+L00D5:	jsr     boolne
+	jeq     L00D6
+	.dbg	line, "cq714b.c", 599
+	ldx     #$01
+	lda     #$4F
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 600
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00D6
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 602
+L00D6:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0C
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$0A
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 603
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$24
+	ldx     #$00
+	lda     (sp),y
+	jsr     axulong
+	jsr     tosandeax
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 604
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     tosneeax
+	jeq     L00D8
+	.dbg	line, "cq714b.c", 605
+	ldx     #$01
+	lda     #$50
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 606
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00D8
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 608
+L00D8:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0C
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$0A
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 609
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$21
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosandeax
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 610
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     tosneeax
+	jeq     L00DA
+	.dbg	line, "cq714b.c", 611
+	ldx     #$01
+	lda     #$51
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 612
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00DA
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 614
+L00DA:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0C
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$0A
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 615
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$1D
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosandeax
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 616
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     tosneeax
+	jeq     L00DC
+	.dbg	line, "cq714b.c", 617
+	ldx     #$01
+	lda     #$52
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 618
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00DC
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 620
+L00DC:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0C
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0A
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 621
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     tosandeax
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 622
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     tosneeax
+	jeq     L00DE
+	.dbg	line, "cq714b.c", 623
+	ldx     #$01
+	lda     #$53
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 624
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00DE
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 626
+L00DE:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0C
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$0A
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 627
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axulong
+	jsr     tosandeax
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 628
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     tosneeax
+	jeq     L00E0
+	.dbg	line, "cq714b.c", 629
+	ldx     #$01
+	lda     #$54
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 630
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00E0
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 632
+L00E0:	ldx     #$00
+	lda     #$0C
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$0A
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 633
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$22
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosandax
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 634
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00E2
+	cmp     #$08
+L00E2:	jsr     boolne
+	jeq     L00E3
+	.dbg	line, "cq714b.c", 635
+	ldx     #$01
+	lda     #$55
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 636
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00E3
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 638
+L00E3:	ldx     #$00
+	lda     #$0C
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$0A
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 639
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosandax
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 640
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00E5
+	cmp     #$08
+L00E5:	jsr     boolne
+	jeq     L00E6
+	.dbg	line, "cq714b.c", 641
+	ldx     #$01
+	lda     #$56
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 642
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00E6
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 644
+L00E6:	ldx     #$00
+	lda     #$0C
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$0A
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 645
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosandax
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 646
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00E8
+	cmp     #$08
+L00E8:	jsr     boolne
+	jeq     L00E9
+	.dbg	line, "cq714b.c", 647
+	ldx     #$01
+	lda     #$57
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 648
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00E9
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 650
+L00E9:	ldx     #$00
+	lda     #$0C
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0A
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 651
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosandeax
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 652
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00EB
+	cmp     #$08
+L00EB:	jsr     boolne
+	jeq     L00EC
+	.dbg	line, "cq714b.c", 653
+	ldx     #$01
+	lda     #$58
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 654
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00EC
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 656
+L00EC:	ldx     #$00
+	lda     #$0C
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$0A
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 657
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosandax
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 658
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00EE
+	cmp     #$08
+L00EE:	jsr     boolne
+	jeq     L00EF
+	.dbg	line, "cq714b.c", 659
+	ldx     #$01
+	lda     #$59
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 660
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00EF
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 662
+L00EF:	ldx     #$00
+	lda     #$0C
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$0A
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 663
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$22
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosxorax
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 664
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$06
+	jsr     boolne
+	jeq     L00F1
+	.dbg	line, "cq714b.c", 665
+	ldx     #$01
+	lda     #$5A
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 666
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00F1
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 668
+L00F1:	ldx     #$00
+	lda     #$0C
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$0A
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 669
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosxorax
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 670
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$06
+	jsr     boolne
+	jeq     L00F3
+	.dbg	line, "cq714b.c", 671
+	ldx     #$01
+	lda     #$5B
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 672
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00F3
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 674
+L00F3:	ldx     #$00
+	lda     #$0C
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$0A
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 675
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosxorax
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 676
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$06
+	jsr     boolne
+	jeq     L00F5
+	.dbg	line, "cq714b.c", 677
+	ldx     #$01
+	lda     #$5C
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 678
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00F5
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 680
+L00F5:	ldx     #$00
+	lda     #$0C
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0A
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 681
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosxoreax
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 682
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$06
+	jsr     boolne
+	jeq     L00F7
+	.dbg	line, "cq714b.c", 683
+	ldx     #$01
+	lda     #$5D
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 684
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00F7
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 686
+L00F7:	ldx     #$00
+	lda     #$0C
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$0A
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 687
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosxorax
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 688
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$06
+	jsr     boolne
+	jeq     L00F9
+	.dbg	line, "cq714b.c", 689
+	ldx     #$01
+	lda     #$5E
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 690
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00F9
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 692
+L00F9:	ldx     #$00
+	lda     #$0C
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$0A
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 693
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$22
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosxorax
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 694
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00FB
+	cmp     #$06
+L00FB:	jsr     boolne
+	jeq     L00FC
+	.dbg	line, "cq714b.c", 695
+	ldx     #$01
+	lda     #$5F
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 696
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00FC
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 698
+L00FC:	ldx     #$00
+	lda     #$0C
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$0A
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 699
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosxorax
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 700
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00FE
+	cmp     #$06
+L00FE:	jsr     boolne
+	jeq     L00FF
+	.dbg	line, "cq714b.c", 701
+	ldx     #$01
+	lda     #$60
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 702
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00FF
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 704
+L00FF:	ldx     #$00
+	lda     #$0C
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$0A
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 705
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosxorax
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 706
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0101
+	cmp     #$06
+L0101:	jsr     boolne
+	jeq     L0102
+	.dbg	line, "cq714b.c", 707
+	ldx     #$01
+	lda     #$61
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 708
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0102
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 710
+L0102:	ldx     #$00
+	lda     #$0C
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0A
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 711
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosxoreax
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 712
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0104
+	cmp     #$06
+L0104:	jsr     boolne
+	jeq     L0105
+	.dbg	line, "cq714b.c", 713
+	ldx     #$01
+	lda     #$62
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 714
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0105
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 716
+L0105:	ldx     #$00
+	lda     #$0C
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$0A
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 717
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosxorax
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 718
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0107
+	cmp     #$06
+L0107:	jsr     boolne
+	jeq     L0108
+	.dbg	line, "cq714b.c", 719
+	ldx     #$01
+	lda     #$63
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 720
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0108
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 722
+L0108:	ldx     #$00
+	lda     #$0C
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$0A
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 723
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$22
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosxorax
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 724
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L010A
+	cmp     #$06
+L010A:	jsr     boolne
+	jeq     L010B
+	.dbg	line, "cq714b.c", 725
+	ldx     #$01
+	lda     #$64
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 726
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L010B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 728
+L010B:	ldx     #$00
+	lda     #$0C
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$0A
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 729
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosxorax
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 730
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L010D
+	cmp     #$06
+L010D:	jsr     boolne
+	jeq     L010E
+	.dbg	line, "cq714b.c", 731
+	ldx     #$01
+	lda     #$65
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 732
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L010E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 734
+L010E:	ldx     #$00
+	lda     #$0C
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$0A
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 735
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosxorax
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 736
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0110
+	cmp     #$06
+L0110:	jsr     boolne
+	jeq     L0111
+	.dbg	line, "cq714b.c", 737
+	ldx     #$01
+	lda     #$66
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 738
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0111
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 740
+L0111:	ldx     #$00
+	lda     #$0C
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0A
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 741
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosxoreax
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 742
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0113
+	cmp     #$06
+L0113:	jsr     boolne
+	jeq     L0114
+	.dbg	line, "cq714b.c", 743
+	ldx     #$01
+	lda     #$67
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 744
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0114
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 746
+L0114:	ldx     #$00
+	lda     #$0C
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$0A
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 747
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosxorax
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 748
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0116
+	cmp     #$06
+L0116:	jsr     boolne
+	jeq     L0117
+	.dbg	line, "cq714b.c", 749
+	ldx     #$01
+	lda     #$68
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 750
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0117
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 752
+L0117:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0C
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$0A
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 753
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$24
+	ldx     #$00
+	lda     (sp),y
+	jsr     axulong
+	jsr     tosxoreax
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 754
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$06
+	jsr     tosneeax
+	jeq     L0119
+	.dbg	line, "cq714b.c", 755
+	ldx     #$01
+	lda     #$69
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 756
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0119
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 758
+L0119:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0C
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$0A
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 759
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$21
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosxoreax
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 760
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$06
+	jsr     tosneeax
+	jeq     L011B
+	.dbg	line, "cq714b.c", 761
+	ldx     #$01
+	lda     #$6A
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 762
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L011B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 764
+L011B:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0C
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$0A
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 765
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$1D
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosxoreax
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 766
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$06
+	jsr     tosneeax
+	jeq     L011D
+	.dbg	line, "cq714b.c", 767
+	ldx     #$01
+	lda     #$6B
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 768
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L011D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 770
+L011D:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0C
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0A
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 771
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     tosxoreax
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 772
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$06
+	jsr     tosneeax
+	jeq     L011F
+	.dbg	line, "cq714b.c", 773
+	ldx     #$01
+	lda     #$6C
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 774
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L011F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 776
+L011F:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0C
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$0A
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 777
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axulong
+	jsr     tosxoreax
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 778
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$06
+	jsr     tosneeax
+	jeq     L0121
+	.dbg	line, "cq714b.c", 779
+	ldx     #$01
+	lda     #$6D
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 780
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0121
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 782
+L0121:	ldx     #$00
+	lda     #$0C
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$0A
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 783
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$22
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosxorax
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 784
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0123
+	cmp     #$06
+L0123:	jsr     boolne
+	jeq     L0124
+	.dbg	line, "cq714b.c", 785
+	ldx     #$01
+	lda     #$6E
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 786
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0124
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 788
+L0124:	ldx     #$00
+	lda     #$0C
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$0A
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 789
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosxorax
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 790
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0126
+	cmp     #$06
+L0126:	jsr     boolne
+	jeq     L0127
+	.dbg	line, "cq714b.c", 791
+	ldx     #$01
+	lda     #$6F
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 792
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0127
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 794
+L0127:	ldx     #$00
+	lda     #$0C
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$0A
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 795
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosxorax
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 796
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0129
+	cmp     #$06
+L0129:	jsr     boolne
+	jeq     L012A
+	.dbg	line, "cq714b.c", 797
+	ldx     #$01
+	lda     #$70
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 798
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L012A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 800
+L012A:	ldx     #$00
+	lda     #$0C
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0A
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 801
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosxoreax
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 802
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L012C
+	cmp     #$06
+L012C:	jsr     boolne
+	jeq     L012D
+	.dbg	line, "cq714b.c", 803
+	ldx     #$01
+	lda     #$71
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 804
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L012D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 806
+L012D:	ldx     #$00
+	lda     #$0C
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$0A
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 807
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosxorax
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 808
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L012F
+	cmp     #$06
+L012F:	jsr     boolne
+	jeq     L0130
+	.dbg	line, "cq714b.c", 809
+	ldx     #$01
+	lda     #$72
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 810
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0130
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 812
+L0130:	ldx     #$00
+	lda     #$0C
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$0A
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 813
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$22
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosorax
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 814
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$0E
+	jsr     boolne
+	jeq     L0132
+	.dbg	line, "cq714b.c", 815
+	ldx     #$01
+	lda     #$73
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 816
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0132
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 818
+L0132:	ldx     #$00
+	lda     #$0C
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$0A
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 819
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosorax
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 820
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$0E
+	jsr     boolne
+	jeq     L0134
+	.dbg	line, "cq714b.c", 821
+	ldx     #$01
+	lda     #$74
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 822
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0134
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 824
+L0134:	ldx     #$00
+	lda     #$0C
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$0A
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 825
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosorax
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 826
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$0E
+	jsr     boolne
+	jeq     L0136
+	.dbg	line, "cq714b.c", 827
+	ldx     #$01
+	lda     #$75
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 828
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0136
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 830
+L0136:	ldx     #$00
+	lda     #$0C
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0A
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 831
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosoreax
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 832
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$0E
+	jsr     boolne
+	jeq     L0138
+	.dbg	line, "cq714b.c", 833
+	ldx     #$01
+	lda     #$76
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 834
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0138
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 836
+L0138:	ldx     #$00
+	lda     #$0C
+	ldy     #$21
+	sta     (sp),y
+	ldx     #$00
+	lda     #$0A
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 837
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosorax
+	ldy     #$21
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 838
+	ldy     #$21
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$0E
+	jsr     boolne
+	jeq     L013A
+	.dbg	line, "cq714b.c", 839
+	ldx     #$01
+	lda     #$77
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 840
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L013A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 842
+L013A:	ldx     #$00
+	lda     #$0C
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$0A
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 843
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$22
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosorax
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 844
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L013C
+	cmp     #$0E
+L013C:	jsr     boolne
+	jeq     L013D
+	.dbg	line, "cq714b.c", 845
+	ldx     #$01
+	lda     #$78
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 846
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L013D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 848
+L013D:	ldx     #$00
+	lda     #$0C
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$0A
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 849
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosorax
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 850
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L013F
+	cmp     #$0E
+L013F:	jsr     boolne
+	jeq     L0140
+	.dbg	line, "cq714b.c", 851
+	ldx     #$01
+	lda     #$79
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 852
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0140
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 854
+L0140:	ldx     #$00
+	lda     #$0C
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$0A
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 855
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosorax
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 856
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0142
+	cmp     #$0E
+L0142:	jsr     boolne
+	jeq     L0143
+	.dbg	line, "cq714b.c", 857
+	ldx     #$01
+	lda     #$7A
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 858
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0143
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 860
+L0143:	ldx     #$00
+	lda     #$0C
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0A
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 861
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosoreax
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 862
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0145
+	cmp     #$0E
+L0145:	jsr     boolne
+	jeq     L0146
+	.dbg	line, "cq714b.c", 863
+	ldx     #$01
+	lda     #$7B
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 864
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0146
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 866
+L0146:	ldx     #$00
+	lda     #$0C
+	ldy     #$1E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$0A
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 867
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosorax
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 868
+	ldy     #$1F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0148
+	cmp     #$0E
+L0148:	jsr     boolne
+	jeq     L0149
+	.dbg	line, "cq714b.c", 869
+	ldx     #$01
+	lda     #$7C
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 870
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0149
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 872
+L0149:	ldx     #$00
+	lda     #$0C
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$0A
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 873
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$22
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosorax
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 874
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L014B
+	cmp     #$0E
+L014B:	jsr     boolne
+	jeq     L014C
+	.dbg	line, "cq714b.c", 875
+	ldx     #$01
+	lda     #$7D
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 876
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L014C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 878
+L014C:	ldx     #$00
+	lda     #$0C
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$0A
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 879
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosorax
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 880
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L014E
+	cmp     #$0E
+L014E:	jsr     boolne
+	jeq     L014F
+	.dbg	line, "cq714b.c", 881
+	ldx     #$01
+	lda     #$7E
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 882
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L014F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 884
+L014F:	ldx     #$00
+	lda     #$0C
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$0A
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 885
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosorax
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 886
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0151
+	cmp     #$0E
+L0151:	jsr     boolne
+	jeq     L0152
+	.dbg	line, "cq714b.c", 887
+	ldx     #$01
+	lda     #$7F
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 888
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0152
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 890
+L0152:	ldx     #$00
+	lda     #$0C
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0A
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 891
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     toslong
+	jsr     tosoreax
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 892
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0154
+	cmp     #$0E
+L0154:	jsr     boolne
+	jeq     L0155
+	.dbg	line, "cq714b.c", 893
+	ldx     #$01
+	lda     #$80
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 894
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0155
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 896
+L0155:	ldx     #$00
+	lda     #$0C
+	ldy     #$1A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$0A
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 897
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosorax
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 898
+	ldy     #$1B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0157
+	cmp     #$0E
+L0157:	jsr     boolne
+	jeq     L0158
+	.dbg	line, "cq714b.c", 899
+	ldx     #$01
+	lda     #$81
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 900
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0158
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 902
+L0158:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0C
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$0A
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 903
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$24
+	ldx     #$00
+	lda     (sp),y
+	jsr     axulong
+	jsr     tosoreax
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 904
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0E
+	jsr     tosneeax
+	jeq     L015A
+	.dbg	line, "cq714b.c", 905
+	ldx     #$01
+	lda     #$82
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 906
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L015A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 908
+L015A:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0C
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$0A
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 909
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$21
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosoreax
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 910
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0E
+	jsr     tosneeax
+	jeq     L015C
+	.dbg	line, "cq714b.c", 911
+	ldx     #$01
+	lda     #$83
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 912
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L015C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 914
+L015C:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0C
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$0A
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 915
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$1D
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     tosoreax
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 916
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0E
+	jsr     tosneeax
+	jeq     L015E
+	.dbg	line, "cq714b.c", 917
+	ldx     #$01
+	lda     #$84
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 918
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L015E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 920
+L015E:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0C
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0A
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 921
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     tosoreax
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 922
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0E
+	jsr     tosneeax
+	jeq     L0160
+	.dbg	line, "cq714b.c", 923
+	ldx     #$01
+	lda     #$85
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 924
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0160
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 926
+L0160:	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0C
+	ldy     #$14
+	jsr     steaxysp
+	ldx     #$00
+	lda     #$0A
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 927
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axulong
+	jsr     tosoreax
+	ldy     #$14
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 928
+	ldy     #$17
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0E
+	jsr     tosneeax
+	jeq     L0162
+	.dbg	line, "cq714b.c", 929
+	ldx     #$01
+	lda     #$86
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 930
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0162
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 932
+L0162:	ldx     #$00
+	lda     #$0C
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$0A
+	ldy     #$20
+	sta     (sp),y
+	.dbg	line, "cq714b.c", 933
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$22
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosorax
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 934
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0164
+	cmp     #$0E
+L0164:	jsr     boolne
+	jeq     L0165
+	.dbg	line, "cq714b.c", 935
+	ldx     #$01
+	lda     #$87
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 936
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0165
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 938
+L0165:	ldx     #$00
+	lda     #$0C
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$0A
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 939
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1F
+	jsr     ldaxysp
+	jsr     tosorax
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 940
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0167
+	cmp     #$0E
+L0167:	jsr     boolne
+	jeq     L0168
+	.dbg	line, "cq714b.c", 941
+	ldx     #$01
+	lda     #$88
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 942
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0168
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 944
+L0168:	ldx     #$00
+	lda     #$0C
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$0A
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 945
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1B
+	jsr     ldaxysp
+	jsr     tosorax
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 946
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L016A
+	cmp     #$0E
+L016A:	jsr     boolne
+	jeq     L016B
+	.dbg	line, "cq714b.c", 947
+	ldx     #$01
+	lda     #$89
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 948
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L016B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 950
+L016B:	ldx     #$00
+	lda     #$0C
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$0A
+	ldy     #$10
+	jsr     steaxysp
+	.dbg	line, "cq714b.c", 951
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$15
+	jsr     ldeaxysp
+	jsr     tosulong
+	jsr     tosoreax
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 952
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L016D
+	cmp     #$0E
+L016D:	jsr     boolne
+	jeq     L016E
+	.dbg	line, "cq714b.c", 953
+	ldx     #$01
+	lda     #$8A
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 954
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L016E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 956
+L016E:	ldx     #$00
+	lda     #$0C
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$0A
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 957
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosorax
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 958
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0170
+	cmp     #$0E
+L0170:	jsr     boolne
+	jeq     L0171
+	.dbg	line, "cq714b.c", 959
+	ldx     #$01
+	lda     #$8B
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 960
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0171
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$27
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 962
+L0171:	ldy     #$25
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0173
+	cmp     #$00
+L0173:	jsr     boolne
+	jeq     L0174
+	.dbg	line, "cq714b.c", 963
+	ldx     #$00
+	lda     #$01
+	ldy     #$22
+	jsr     staxysp
+	.dbg	line, "cq714b.c", 964
+	ldy     #$29
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0175
+	cmp     #$00
+L0175:	jsr     boolne
+	jeq     L0174
+	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq714b.c", 966
+L0174:	ldy     #$23
+	jsr     ldaxysp
+	jmp     L0001
+	.dbg	line, "cq714b.c", 967
+L0001:	ldy     #$2A
+	jsr     addysp
+	rts
+
+	.dbg	line
+.segment	"DATA"
+
+M0001:
+	.byte	$4C,$6F,$63,$61,$6C,$20,$65,$72,$72,$6F,$72,$20,$25,$64,$2E,$0A
+	.byte	$00
+M0002:
+	.byte	$73,$37,$31,$34,$2C,$65,$72,$25,$64,$0A,$00
+M0003:
+	.byte	$73,$37,$31,$34,$20,$20,$20,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ section (int j, void *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_section: near
+
+	.dbg	func, "section", "00", extern, "_section"
+	.dbg	sym, "j", "00", auto, 2
+	.dbg	sym, "pd0", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "cq714b.c", 976
+	jsr     pushax
+	.dbg	line, "cq714b.c", 978
+	ldy     #$03
+	jsr     ldaxysp
+	jmp     L0002
+	.dbg	line, "cq714b.c", 980
+L0002:	cpx     #$00
+	jne     L0005
+	cmp     #$00
+	jeq     L0004
+	jmp     L0003
+L0005:	jmp     L0003
+	.dbg	line, "cq714b.c", 979
+L0004:	ldy     #$01
+	jsr     ldaxysp
+	jsr     _s714
+	jmp     L0003
+	.dbg	line, "cq714b.c", 981
+L0003:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+	.dbg	sym, "n", "00", auto, 2
+	.dbg	sym, "args", "00", auto, 0
+	.dbg	sym, "j", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "cq714b.c", 1001
+	jsr     decsp2
+	ldx     #$00
+	lda     #$01
+	sta     M0001+14
+	stx     M0001+14+1
+	.dbg	line, "cq714b.c", 1002
+	ldx     #$00
+	lda     #$01
+	sta     M0001+16
+	stx     M0001+16+1
+	.dbg	line, "cq714b.c", 1003
+	ldx     #$00
+	lda     #$01
+	sta     M0001+18
+	stx     M0001+18+1
+	.dbg	line, "cq714b.c", 1004
+	ldx     #$00
+	lda     #$01
+	sta     M0001+20
+	stx     M0001+20+1
+	.dbg	line, "cq714b.c", 1006
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	sta     M0002
+	stx     M0002+1
+	.dbg	line, "cq714b.c", 1008
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+	jmp     L0002
+	.dbg	line, "cq714b.c", 1009
+L0005:	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	lda     M0002
+	ldx     M0002+1
+	jsr     _section
+	sta     M0001+22
+	stx     M0001+22+1
+	.dbg	line, "cq714b.c", 1010
+	lda     M0001+24
+	ldx     M0001+24+1
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     tosaddax
+	sta     M0001+24
+	stx     M0001+24+1
+	.dbg	line, "cq714b.c", 1011
+	lda     M0001+14
+	ldx     M0001+14+1
+	cpx     #$00
+	bne     L0008
+	cmp     #$00
+L0008:	jsr     boolne
+	jeq     L0007
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     #<(M0001+26)
+	ldx     #>(M0001+26)
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "cq714b.c", 1008
+L0007:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0005
+	.dbg	line, "cq714b.c", 1014
+	lda     M0001+24
+	ldx     M0001+24+1
+	cpx     #$00
+	bne     L000A
+	cmp     #$00
+L000A:	jsr     booleq
+	jeq     L0009
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cq714b.c", 1015
+	jmp     L000B
+L0009:	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cq714b.c", 1017
+L000B:	lda     M0001+24
+	ldx     M0001+24+1
+	jmp     L0001
+	.dbg	line, "cq714b.c", 1018
+L0001:	jsr     incsp6
+	rts
+
+	.dbg	line
+.segment	"BSS"
+
+M0001:
+	.res	34,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
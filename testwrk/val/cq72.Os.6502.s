@@ -0,0 +1,798 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_printf
+	.export		_lbits
+	.export		_ubits
+	.export		_fbits
+	.export		_dbits
+	.export		_flgs
+	.export		_flgm
+	.export		_flgd
+	.export		_flgl
+	.export		_rrc
+	.export		_crc
+	.export		_rfs
+	.export		_s26
+	.export		_s72
+	.export		_section
+	.export		_main
+
+.segment	"RODATA"
+
+S0006:
+	.byte	$53,$65,$63,$74,$69,$6F,$6E,$20,$25,$73,$20,$72,$65,$74,$75,$72
+	.byte	$6E,$65,$64,$20,$25,$64,$2E,$0A,$00
+S0007:
+	.byte	$0A,$4E,$6F,$20,$65,$72,$72,$6F,$72,$73,$20,$64,$65,$74,$65,$63
+	.byte	$74,$65,$64,$2E,$0A,$00
+S0008:
+	.byte	$0A,$46,$61,$69,$6C,$65,$64,$2E,$0A,$00
+
+.segment	"BSS"
+
+_lbits:
+	.res	2,$00
+_ubits:
+	.res	2,$00
+_fbits:
+	.res	2,$00
+_dbits:
+	.res	2,$00
+_flgs:
+	.res	2,$00
+_flgm:
+	.res	2,$00
+_flgd:
+	.res	2,$00
+_flgl:
+	.res	2,$00
+_rrc:
+	.res	2,$00
+_crc:
+	.res	2,$00
+_rfs:
+	.res	8,$00
+
+; ---------------------------------------------------------------
+; int __near__ s26 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s26: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp6
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     incaxy
+	ldy     #$02
+	jsr     staxysp
+L0002:	ldy     #$03
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$05
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	sta     (sreg),y
+	tax
+	php
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	bne     L0002
+	ldy     #$07
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$00
+	tay
+	sta     (ptr1),y
+	iny
+	sta     (ptr1),y
+	sta     (sp),y
+	tya
+	dey
+	sta     (sp),y
+	jmp     L0007
+L0009:	lda     (sp),y
+	asl     a
+	sta     (sp),y
+	ldy     #$07
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     ldaxi
+	jsr     incax1
+	ldy     #$00
+	sta     (sreg),y
+	iny
+	txa
+	sta     (sreg),y
+L0007:	ldy     #$01
+	lda     (sp),y
+	dey
+	cmp     (sp),y
+	bne     L0009
+	ldy     #$07
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     ldaxi
+	jsr     shlax1
+	ldy     #$02
+	sta     (sreg),y
+	iny
+	txa
+	sta     (sreg),y
+	ldy     #$07
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     ldaxi
+	jsr     shlax1
+	ldy     #$04
+	sta     (sreg),y
+	iny
+	txa
+	sta     (sreg),y
+	ldy     #$07
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     ldaxi
+	jsr     shlax2
+	ldy     #$06
+	sta     (sreg),y
+	iny
+	txa
+	sta     (sreg),y
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     ldaxi
+	jsr     shlax1
+	ldy     #$08
+	sta     (sreg),y
+	iny
+	txa
+	sta     (sreg),y
+	ldx     #$00
+	txa
+	jmp     incsp8
+
+.segment	"DATA"
+
+M0001:
+	.byte	$73,$32,$36,$20,$20,$20,$20,$00
+M0002:
+	.byte	$25,$33,$64,$20,$62,$69,$74,$73,$20,$69,$6E,$20,$25,$73,$73,$2E
+	.byte	$0A,$00
+M0003:
+	.byte	$25,$65,$20,$69,$73,$20,$74,$68,$65,$20,$6C,$65,$61,$73,$74,$20
+	.byte	$6E,$75,$6D,$62,$65,$72,$20,$74,$68,$61,$74,$20,$63,$61,$6E,$20
+	.byte	$62,$65,$20,$61,$64,$64,$65,$64,$20,$74,$6F,$20,$31,$2E,$20,$28
+	.byte	$25,$73,$29,$2E,$0A,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ s72 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s72: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$1B
+	jsr     subysp
+	lda     #<(M0002)
+	ldx     #>(M0002)
+	ldy     #$17
+	jsr     staxysp
+	ldy     #$1C
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     incaxy
+	ldy     #$15
+	jsr     staxysp
+	ldx     #$00
+	txa
+	ldy     #$19
+	jsr     staxysp
+L0002:	ldy     #$16
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$18
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	sta     (sreg),y
+	tax
+	php
+	ldy     #$15
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$17
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	bne     L0002
+	ldx     #$00
+	lda     #$02
+	ldy     #$13
+	jsr     staxysp
+	jsr     negax
+	clc
+	ldy     #$13
+	adc     (sp),y
+	pha
+	txa
+	iny
+	adc     (sp),y
+	tax
+	pla
+	cpx     #$00
+	bne     L003F
+	cmp     #$00
+	beq     L0042
+L003F:	ldy     #$1A
+	jsr     ldaxysp
+	jsr     incax2
+	ldy     #$19
+	jsr     staxysp
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$02
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	txa
+L0042:	ldy     #$13
+	jsr     staxysp
+	ldy     #$11
+	jsr     staxysp
+	jmp     L0009
+L000C:	ldy     #$14
+	jsr     ldaxysp
+	jsr     aslax1
+	ora     #$01
+	ldy     #$13
+	jsr     staxysp
+	ldy     #$11
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L0009:	ldy     #$14
+	jsr     pushwysp
+	ldy     #$1E
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldaxidx
+	jsr     tosicmp
+	bmi     L000C
+	ldy     #$14
+	jsr     ldaxysp
+	jsr     complax
+	cpx     #$00
+	bne     L0040
+	cmp     #$00
+	beq     L0043
+L0040:	ldy     #$1A
+	jsr     ldaxysp
+	jsr     incax4
+	ldy     #$19
+	jsr     staxysp
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	tay
+	jsr     _printf
+	ldx     #$00
+L0043:	lda     #$05
+	ldy     #$13
+	jsr     staxysp
+	ldy     #$13
+	lda     #$01
+	jsr     addeqysp
+	cpx     #$00
+	bne     L0011
+	cmp     #$06
+	bne     L0011
+	lda     #$01
+	ldy     #$13
+	jsr     subeqysp
+	cpx     #$00
+	bne     L0011
+	cmp     #$05
+	bne     L0011
+	ldy     #$14
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0013
+	cmp     #$05
+L0013:	jsr     boolne
+	php
+	ldy     #$13
+	lda     #$01
+	jsr     addeqysp
+	plp
+	bne     L0011
+	ldy     #$14
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0014
+	cmp     #$06
+L0014:	jsr     boolne
+	php
+	lda     #$01
+	ldy     #$13
+	jsr     subeqysp
+	plp
+	bne     L0011
+	ldy     #$14
+	lda     (sp),y
+	bne     L0011
+	dey
+	lda     (sp),y
+	cmp     #$05
+	beq     L003A
+L0011:	ldy     #$1A
+	jsr     ldaxysp
+	jsr     incax8
+	ldy     #$19
+	jsr     staxysp
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$08
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L003A:	lda     #$1A
+	ldy     #$0C
+	sta     (sp),y
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	ldy     #$06
+	jsr     steaxysp
+	ldy     #$0A
+	jsr     staxysp
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$0F
+	jsr     staxysp
+	jsr     stax0sp
+	ldy     #$02
+	jsr     staxysp
+	txa
+	ldy     #$0D
+	jsr     staxysp
+	ldy     #$0A
+	lda     (sp),y
+	cmp     #$1A
+	bne     L003B
+	ldy     #$0F
+	lda     (sp),y
+	cmp     #$1A
+	bne     L003B
+	ldy     #$06
+	lda     (sp),y
+	cmp     #$1A
+	bne     L003B
+	ldy     #$04
+	lda     (sp),y
+	cmp     #$1A
+	bne     L003B
+	lda     (sp,x)
+	cmp     #$1A
+	bne     L003B
+	ldy     #$02
+	lda     (sp),y
+	cmp     #$1A
+	beq     L0017
+L003B:	ldy     #$0E
+	jsr     ldaxysp
+	jsr     incax1
+	ldy     #$0D
+	jsr     staxysp
+L0017:	ldy     #$0C
+	lda     (sp),y
+	cmp     #$1A
+	bne     L003C
+	ldy     #$10
+	lda     (sp),y
+	bne     L003C
+	dey
+	lda     (sp),y
+	cmp     #$1A
+	bne     L003C
+	ldy     #$07
+	lda     (sp),y
+	bne     L003C
+	dey
+	lda     (sp),y
+	cmp     #$1A
+	bne     L003C
+	dey
+	lda     (sp),y
+	bne     L003C
+	dey
+	lda     (sp),y
+	cmp     #$1A
+	bne     L003C
+	ldy     #$01
+	lda     (sp),y
+	bne     L003C
+	dey
+	lda     (sp),y
+	cmp     #$1A
+	bne     L003C
+	ldy     #$03
+	lda     (sp),y
+	bne     L003C
+	dey
+	lda     (sp),y
+	cmp     #$1A
+	beq     L001A
+L003C:	ldy     #$0E
+	jsr     ldaxysp
+	jsr     incax2
+	ldy     #$0D
+	jsr     staxysp
+L001A:	ldy     #$0C
+	lda     (sp),y
+	cmp     #$1A
+	bne     L003D
+	dey
+	lda     (sp),y
+	bne     L003D
+	dey
+	lda     (sp),y
+	cmp     #$1A
+	bne     L003D
+	ldy     #$07
+	lda     (sp),y
+	bne     L003D
+	dey
+	lda     (sp),y
+	cmp     #$1A
+	bne     L003D
+	dey
+	lda     (sp),y
+	bne     L003D
+	dey
+	lda     (sp),y
+	cmp     #$1A
+	bne     L003D
+	ldy     #$01
+	lda     (sp),y
+	bne     L003D
+	dey
+	lda     (sp),y
+	cmp     #$1A
+	bne     L003D
+	ldy     #$03
+	lda     (sp),y
+	bne     L003D
+	dey
+	lda     (sp),y
+	cmp     #$1A
+	beq     L0023
+L003D:	ldy     #$0E
+	jsr     ldaxysp
+	jsr     incax4
+	ldy     #$0D
+	jsr     staxysp
+L0023:	ldy     #$0C
+	ldx     #$00
+	lda     (sp),y
+	jsr     axulong
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$1A
+	jsr     tosneeax
+	bne     L002D
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$1A
+	jsr     tosneeax
+	bne     L002D
+	ldy     #$10
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$1A
+	jsr     tosneeax
+	bne     L002D
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     axulong
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$1A
+	jsr     tosneeax
+	bne     L002D
+	jsr     ldax0sp
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$1A
+	jsr     tosneeax
+	bne     L002D
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$1A
+	jsr     tosneeax
+	beq     L002C
+L002D:	ldy     #$0E
+	jsr     ldaxysp
+	jsr     incax8
+	ldy     #$0D
+	jsr     staxysp
+L002C:	ldy     #$0C
+	lda     (sp),y
+	cmp     #$1A
+	bne     L003E
+	dey
+	lda     (sp),y
+	bne     L003E
+	dey
+	lda     (sp),y
+	cmp     #$1A
+	bne     L003E
+	ldy     #$10
+	lda     (sp),y
+	bne     L003E
+	dey
+	lda     (sp),y
+	cmp     #$1A
+	bne     L003E
+	ldy     #$07
+	lda     (sp),y
+	bne     L003E
+	dey
+	lda     (sp),y
+	cmp     #$1A
+	bne     L003E
+	ldy     #$01
+	lda     (sp),y
+	bne     L003E
+	dey
+	lda     (sp),y
+	cmp     #$1A
+	bne     L003E
+	ldy     #$03
+	lda     (sp),y
+	bne     L003E
+	dey
+	lda     (sp),y
+	cmp     #$1A
+	beq     L002F
+L003E:	ldy     #$0E
+	jsr     ldaxysp
+	ldy     #$10
+	jsr     incaxy
+	ldy     #$0D
+	jsr     staxysp
+L002F:	ldy     #$0D
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L0038
+	ldy     #$1A
+	jsr     ldaxysp
+	ldy     #$10
+	jsr     incaxy
+	ldy     #$19
+	jsr     staxysp
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$10
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L0038:	ldy     #$1A
+	jsr     ldaxysp
+	ldy     #$1D
+	jmp     addysp
+
+.segment	"DATA"
+
+M0001:
+	.byte	$73,$37,$32,$2C,$65,$72,$25,$64,$0A,$00
+M0002:
+	.byte	$73,$37,$32,$20,$20,$20,$20,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ section (int j, void *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_section: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0003
+	cmp     #$00
+	beq     L0004
+	cmp     #$01
+	beq     L0005
+	jmp     L0003
+L0004:	jsr     ldax0sp
+	jsr     _s26
+	jmp     L0003
+L0005:	jsr     ldax0sp
+	jsr     _s72
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	ldx     #$00
+	lda     #$01
+	sta     M0001+14
+	stx     M0001+14+1
+	sta     M0001+16
+	stx     M0001+16+1
+	sta     M0001+18
+	stx     M0001+18+1
+	sta     M0001+20
+	stx     M0001+20+1
+	lda     #>(M0001)
+	sta     M0002+1
+	lda     #<(M0001)
+	sta     M0002
+	txa
+	jsr     stax0sp
+	jmp     L0002
+L0005:	jsr     pushw0sp
+	lda     M0002
+	ldx     M0002+1
+	jsr     _section
+	sta     M0001+22
+	stx     M0001+22+1
+	lda     M0001+24
+	clc
+	adc     M0001+22
+	sta     M0001+24
+	lda     M0001+24+1
+	adc     M0001+22+1
+	sta     M0001+24+1
+	lda     M0001+14
+	ora     M0001+14+1
+	beq     L0007
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	lda     #<(M0001+26)
+	ldx     #>(M0001+26)
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+L0007:	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+L0002:	jsr     ldax0sp
+	cmp     #$02
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	bmi     L0005
+	lda     M0001+24
+	ora     M0001+24+1
+	bne     L0009
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jmp     L000E
+L0009:	lda     #<(S0008)
+	ldx     #>(S0008)
+L000E:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     M0001+24
+	ldx     M0001+24+1
+	jmp     incsp6
+
+.segment	"BSS"
+
+M0001:
+	.res	34,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
@@ -0,0 +1,1003 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_printf
+	.export		_lbits
+	.export		_ubits
+	.export		_fbits
+	.export		_dbits
+	.export		_flgs
+	.export		_flgm
+	.export		_flgd
+	.export		_flgl
+	.export		_rrc
+	.export		_crc
+	.export		_rfs
+	.export		_s26
+	.export		_s72
+	.export		_section
+	.export		_main
+
+.segment	"RODATA"
+
+S0006:
+	.byte	$53,$65,$63,$74,$69,$6F,$6E,$20,$25,$73,$20,$72,$65,$74,$75,$72
+	.byte	$6E,$65,$64,$20,$25,$64,$2E,$0A,$00
+S0007:
+	.byte	$0A,$4E,$6F,$20,$65,$72,$72,$6F,$72,$73,$20,$64,$65,$74,$65,$63
+	.byte	$74,$65,$64,$2E,$0A,$00
+S0008:
+	.byte	$0A,$46,$61,$69,$6C,$65,$64,$2E,$0A,$00
+
+.segment	"BSS"
+
+_lbits:
+	.res	2,$00
+_ubits:
+	.res	2,$00
+_fbits:
+	.res	2,$00
+_dbits:
+	.res	2,$00
+_flgs:
+	.res	2,$00
+_flgm:
+	.res	2,$00
+_flgd:
+	.res	2,$00
+_flgl:
+	.res	2,$00
+_rrc:
+	.res	2,$00
+_crc:
+	.res	2,$00
+_rfs:
+	.res	8,$00
+
+; ---------------------------------------------------------------
+; int __near__ s26 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s26: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp6
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$1A
+	bcc     L0002
+	inx
+L0002:	ldy     #$02
+	jsr     staxysp
+L0003:	ldy     #$03
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	ldy     #$05
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$00
+	lda     (ptr1),y
+	sta     (sreg),y
+	tax
+	php
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	bne     L0003
+	ldy     #$07
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	lda     #$00
+	tay
+	sta     (ptr1),y
+	iny
+	sta     (ptr1),y
+	sta     (sp),y
+	tya
+	dey
+	sta     (sp),y
+	jmp     L0008
+L000B:	lda     (sp),y
+	asl     a
+	sta     (sp),y
+	ldy     #$07
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	iny
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	clc
+	adc     #$01
+	bcc     L000C
+	inx
+L000C:	sta     (sreg),y
+	iny
+	txa
+	sta     (sreg),y
+L0008:	ldy     #$01
+	lda     (sp),y
+	dey
+	cmp     (sp),y
+	bne     L000B
+	ldy     #$07
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	iny
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	sta     tmp1
+	dey
+	lda     (ptr1),y
+	asl     a
+	rol     tmp1
+	ldy     #$02
+	sta     (sreg),y
+	iny
+	lda     tmp1
+	sta     (sreg),y
+	ldy     #$07
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	iny
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	sta     tmp1
+	dey
+	lda     (ptr1),y
+	asl     a
+	rol     tmp1
+	ldy     #$04
+	sta     (sreg),y
+	iny
+	lda     tmp1
+	sta     (sreg),y
+	ldy     #$07
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	iny
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     shlax2
+	ldy     #$06
+	sta     (sreg),y
+	iny
+	txa
+	sta     (sreg),y
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	iny
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	sta     tmp1
+	dey
+	lda     (ptr1),y
+	asl     a
+	rol     tmp1
+	ldy     #$08
+	sta     (sreg),y
+	iny
+	lda     tmp1
+	sta     (sreg),y
+	ldx     #$00
+	txa
+	jmp     incsp8
+
+.segment	"DATA"
+
+M0001:
+	.byte	$73,$32,$36,$20,$20,$20,$20,$00
+M0002:
+	.byte	$25,$33,$64,$20,$62,$69,$74,$73,$20,$69,$6E,$20,$25,$73,$73,$2E
+	.byte	$0A,$00
+M0003:
+	.byte	$25,$65,$20,$69,$73,$20,$74,$68,$65,$20,$6C,$65,$61,$73,$74,$20
+	.byte	$6E,$75,$6D,$62,$65,$72,$20,$74,$68,$61,$74,$20,$63,$61,$6E,$20
+	.byte	$62,$65,$20,$61,$64,$64,$65,$64,$20,$74,$6F,$20,$31,$2E,$20,$28
+	.byte	$25,$73,$29,$2E,$0A,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ s72 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s72: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$1B
+	jsr     subysp
+	lda     #<(M0002)
+	ldx     #>(M0002)
+	ldy     #$17
+	jsr     staxysp
+	ldy     #$1C
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$1A
+	bcc     L0002
+	inx
+L0002:	ldy     #$15
+	jsr     staxysp
+	ldy     #$19
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+L0003:	ldy     #$16
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	ldy     #$18
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$00
+	lda     (ptr1),y
+	sta     (sreg),y
+	tax
+	php
+	ldy     #$15
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$17
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	bne     L0003
+	ldx     #$00
+	lda     #$02
+	ldy     #$13
+	jsr     staxysp
+	dex
+	lda     #$FD
+	clc
+	adc     #$01
+	bcc     L004E
+	inx
+	clc
+L004E:	ldy     #$13
+	adc     (sp),y
+	pha
+	txa
+	iny
+	adc     (sp),y
+	tax
+	pla
+	cpx     #$00
+	bne     L004B
+	cmp     #$00
+	beq     L0009
+L004B:	ldy     #$1A
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$02
+	bcc     L000B
+	inx
+L000B:	jsr     staxysp
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$02
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L0009:	ldy     #$13
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$11
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L0045
+L000F:	ldy     #$14
+	lda     (sp),y
+	sta     tmp1
+	dey
+	lda     (sp),y
+	asl     a
+	rol     tmp1
+	ldx     tmp1
+	ora     #$01
+	jsr     staxysp
+	ldy     #$11
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L0045:	ldy     #$14
+	jsr     pushwysp
+	ldy     #$1E
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$03
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     tosicmp
+	bmi     L000F
+	ldy     #$14
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     complax
+	cpx     #$00
+	bne     L004C
+	cmp     #$00
+	beq     L0010
+L004C:	ldy     #$1A
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$04
+	bcc     L0012
+	inx
+L0012:	jsr     staxysp
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	tay
+	jsr     _printf
+L0010:	ldy     #$13
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	dey
+	tax
+	lda     #$01
+	jsr     addeqysp
+	cpx     #$00
+	bne     L0015
+	cmp     #$06
+	bne     L0015
+	lda     #$01
+	ldy     #$13
+	jsr     subeqysp
+	cpx     #$00
+	bne     L0015
+	cmp     #$05
+	bne     L0015
+	ldy     #$14
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cpx     #$00
+	bne     L0017
+	cmp     #$05
+L0017:	jsr     boolne
+	php
+	lda     #$01
+	jsr     addeqysp
+	plp
+	bne     L0015
+	ldy     #$14
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cpx     #$00
+	bne     L0018
+	cmp     #$06
+L0018:	jsr     boolne
+	php
+	lda     #$01
+	jsr     subeqysp
+	plp
+	bne     L0015
+	ldy     #$14
+	lda     (sp),y
+	bne     L0015
+	dey
+	lda     (sp),y
+	cmp     #$05
+	beq     L0046
+L0015:	ldy     #$1A
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$08
+	bcc     L001B
+	inx
+L001B:	jsr     staxysp
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$08
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L0046:	lda     #$1A
+	ldy     #$0C
+	sta     (sp),y
+	ldy     #$06
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	lda     #$1A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$04
+	lda     #$1A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0F
+	lda     #$1A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tay
+	lda     #$1A
+	sta     (sp),y
+	tya
+	iny
+	sta     (sp),y
+	iny
+	lda     #$1A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$0A
+	lda     (sp),y
+	cmp     #$1A
+	bne     L0047
+	ldy     #$0F
+	lda     (sp),y
+	cmp     #$1A
+	bne     L0047
+	ldy     #$06
+	lda     (sp),y
+	cmp     #$1A
+	bne     L0047
+	ldy     #$04
+	lda     (sp),y
+	cmp     #$1A
+	bne     L0047
+	ldy     #$00
+	lda     (sp),y
+	cmp     #$1A
+	bne     L0047
+	ldy     #$02
+	lda     (sp),y
+	cmp     #$1A
+	beq     L001C
+L0047:	ldy     #$0E
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$01
+	bcc     L001F
+	inx
+L001F:	jsr     staxysp
+L001C:	ldy     #$0C
+	lda     (sp),y
+	cmp     #$1A
+	bne     L0048
+	ldy     #$10
+	lda     (sp),y
+	bne     L0048
+	dey
+	lda     (sp),y
+	cmp     #$1A
+	bne     L0048
+	ldy     #$07
+	lda     (sp),y
+	bne     L0048
+	dey
+	lda     (sp),y
+	cmp     #$1A
+	bne     L0048
+	dey
+	lda     (sp),y
+	bne     L0048
+	dey
+	lda     (sp),y
+	cmp     #$1A
+	bne     L0048
+	ldy     #$01
+	lda     (sp),y
+	bne     L0048
+	dey
+	lda     (sp),y
+	cmp     #$1A
+	bne     L0048
+	ldy     #$03
+	lda     (sp),y
+	bne     L0048
+	dey
+	lda     (sp),y
+	cmp     #$1A
+	beq     L0020
+L0048:	ldy     #$0E
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$02
+	bcc     L0029
+	inx
+L0029:	jsr     staxysp
+L0020:	ldy     #$0C
+	lda     (sp),y
+	cmp     #$1A
+	bne     L0049
+	dey
+	lda     (sp),y
+	bne     L0049
+	dey
+	lda     (sp),y
+	cmp     #$1A
+	bne     L0049
+	ldy     #$07
+	lda     (sp),y
+	bne     L0049
+	dey
+	lda     (sp),y
+	cmp     #$1A
+	bne     L0049
+	dey
+	lda     (sp),y
+	bne     L0049
+	dey
+	lda     (sp),y
+	cmp     #$1A
+	bne     L0049
+	ldy     #$01
+	lda     (sp),y
+	bne     L0049
+	dey
+	lda     (sp),y
+	cmp     #$1A
+	bne     L0049
+	ldy     #$03
+	lda     (sp),y
+	bne     L0049
+	dey
+	lda     (sp),y
+	cmp     #$1A
+	beq     L002A
+L0049:	ldy     #$0E
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$04
+	bcc     L0033
+	inx
+L0033:	jsr     staxysp
+L002A:	ldy     #$0C
+	ldx     #$00
+	lda     (sp),y
+	jsr     push0ax
+	lda     #$1A
+	jsr     tosneeax
+	jne     L0035
+	ldy     #$0B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$1A
+	jsr     tosneeax
+	bne     L0035
+	ldy     #$10
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$1A
+	jsr     tosneeax
+	bne     L0035
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     push0ax
+	ldx     #$00
+	lda     #$1A
+	jsr     tosneeax
+	bne     L0035
+	ldy     #$01
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$1A
+	jsr     tosneeax
+	bne     L0035
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$1A
+	jsr     tosneeax
+	beq     L0034
+L0035:	ldy     #$0E
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$08
+	bcc     L0037
+	inx
+L0037:	jsr     staxysp
+L0034:	ldy     #$0C
+	lda     (sp),y
+	cmp     #$1A
+	bne     L004A
+	dey
+	lda     (sp),y
+	bne     L004A
+	dey
+	lda     (sp),y
+	cmp     #$1A
+	bne     L004A
+	ldy     #$10
+	lda     (sp),y
+	bne     L004A
+	dey
+	lda     (sp),y
+	cmp     #$1A
+	bne     L004A
+	ldy     #$07
+	lda     (sp),y
+	bne     L004A
+	dey
+	lda     (sp),y
+	cmp     #$1A
+	bne     L004A
+	ldy     #$01
+	lda     (sp),y
+	bne     L004A
+	dey
+	lda     (sp),y
+	cmp     #$1A
+	bne     L004A
+	ldy     #$03
+	lda     (sp),y
+	bne     L004A
+	dey
+	lda     (sp),y
+	cmp     #$1A
+	beq     L0038
+L004A:	ldy     #$0E
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$10
+	bcc     L0041
+	inx
+L0041:	jsr     staxysp
+L0038:	ldy     #$0D
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L0042
+	ldy     #$1A
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$10
+	bcc     L0044
+	inx
+L0044:	jsr     staxysp
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$10
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L0042:	ldy     #$1A
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$1D
+	jmp     addysp
+
+.segment	"DATA"
+
+M0001:
+	.byte	$73,$37,$32,$2C,$65,$72,$25,$64,$0A,$00
+M0002:
+	.byte	$73,$37,$32,$20,$20,$20,$20,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ section (int j, void *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_section: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cpx     #$00
+	bne     L0003
+	cmp     #$00
+	beq     L0004
+	cmp     #$01
+	beq     L0005
+	jmp     L0003
+L0004:	dey
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _s26
+	jmp     L0003
+L0005:	dey
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _s72
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	ldx     #$00
+	lda     #$01
+	sta     M0001+14
+	stx     M0001+14+1
+	sta     M0001+16
+	stx     M0001+16+1
+	sta     M0001+18
+	stx     M0001+18+1
+	sta     M0001+20
+	stx     M0001+20+1
+	lda     #>(M0001)
+	sta     M0002+1
+	lda     #<(M0001)
+	sta     M0002
+	ldy     #$00
+	txa
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L000D
+L0005:	jsr     pushw0sp
+	lda     M0002
+	ldx     M0002+1
+	jsr     _section
+	sta     M0001+22
+	stx     M0001+22+1
+	lda     M0001+24
+	clc
+	adc     M0001+22
+	sta     M0001+24
+	lda     M0001+24+1
+	adc     M0001+22+1
+	sta     M0001+24+1
+	lda     M0001+14
+	ora     M0001+14+1
+	beq     L0007
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	lda     #<(M0001+26)
+	ldx     #>(M0001+26)
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+L0007:	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	ldy     #$01
+L000D:	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cmp     #$02
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	bmi     L0005
+	lda     M0001+24
+	ora     M0001+24+1
+	bne     L0009
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jmp     L000F
+L0009:	lda     #<(S0008)
+	ldx     #>(S0008)
+L000F:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     M0001+24
+	ldx     M0001+24+1
+	jmp     incsp6
+
+.segment	"BSS"
+
+M0001:
+	.res	34,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
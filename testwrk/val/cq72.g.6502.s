@@ -0,0 +1,1077 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "cq72.c", 10143, 1613073744
+	.dbg		file, "common.h", 522, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/stdlib.h", 5999, 1613073744
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_lbits
+	.export		_ubits
+	.export		_fbits
+	.export		_dbits
+	.export		_flgs
+	.export		_flgm
+	.export		_flgd
+	.export		_flgl
+	.export		_rrc
+	.export		_crc
+	.export		_rfs
+	.export		_s26
+	.export		_s72
+	.export		_section
+	.export		_main
+
+.segment	"RODATA"
+
+S0006:
+	.byte	$53,$65,$63,$74,$69,$6F,$6E,$20,$25,$73,$20,$72,$65,$74,$75,$72
+	.byte	$6E,$65,$64,$20,$25,$64,$2E,$0A,$00
+S0007:
+	.byte	$0A,$4E,$6F,$20,$65,$72,$72,$6F,$72,$73,$20,$64,$65,$74,$65,$63
+	.byte	$74,$65,$64,$2E,$0A,$00
+S0008:
+	.byte	$0A,$46,$61,$69,$6C,$65,$64,$2E,$0A,$00
+
+.segment	"BSS"
+
+_lbits:
+	.res	2,$00
+_ubits:
+	.res	2,$00
+_fbits:
+	.res	2,$00
+_dbits:
+	.res	2,$00
+_flgs:
+	.res	2,$00
+_flgm:
+	.res	2,$00
+_flgd:
+	.res	2,$00
+_flgl:
+	.res	2,$00
+_rrc:
+	.res	2,$00
+_crc:
+	.res	2,$00
+_rfs:
+	.res	8,$00
+
+; ---------------------------------------------------------------
+; int __near__ s26 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s26: near
+
+	.dbg	func, "s26", "00", extern, "_s26"
+	.dbg	sym, "pd0", "00", auto, 0
+	.dbg	sym, "ps", "00", auto, -2
+	.dbg	sym, "pt", "00", auto, -4
+	.dbg	sym, "c0", "00", auto, -5
+	.dbg	sym, "c1", "00", auto, -6
+
+.segment	"CODE"
+
+	.dbg	line, "cq72.c", 66
+	jsr     pushax
+	.dbg	line, "cq72.c", 78
+	jsr     decsp6
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq72.c", 79
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     incaxy
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "cq72.c", 81
+	jmp     L0002
+L0002:	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$00
+	jsr     staspidx
+	tax
+	php
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	jne     L0002
+	.dbg	line, "cq72.c", 86
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "cq72.c", 87
+	ldx     #$00
+	lda     #$00
+	ldy     #$01
+	sta     (sp),y
+	.dbg	line, "cq72.c", 88
+	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	sta     (sp),y
+	.dbg	line, "cq72.c", 90
+	jmp     L0007
+	.dbg	line, "cq72.c", 91
+L0005:	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	jsr     aslax1
+	ldx     #$00
+	ldy     #$00
+	sta     (sp),y
+	.dbg	line, "cq72.c", 92
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     incax1
+	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "cq72.c", 90
+L0007:	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosneax
+	jne     L0005
+	.dbg	line, "cq72.c", 96
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     shlax1
+	ldy     #$02
+	jsr     staxspidx
+	.dbg	line, "cq72.c", 97
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     shlax1
+	ldy     #$04
+	jsr     staxspidx
+	.dbg	line, "cq72.c", 98
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     shlax2
+	ldy     #$06
+	jsr     staxspidx
+	.dbg	line, "cq72.c", 99
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     shlax1
+	ldy     #$08
+	jsr     staxspidx
+	.dbg	line, "cq72.c", 162
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "cq72.c", 163
+L0001:	jsr     incsp8
+	rts
+
+	.dbg	line
+.segment	"DATA"
+
+M0001:
+	.byte	$73,$32,$36,$20,$20,$20,$20,$00
+M0002:
+	.byte	$25,$33,$64,$20,$62,$69,$74,$73,$20,$69,$6E,$20,$25,$73,$73,$2E
+	.byte	$0A,$00
+M0003:
+	.byte	$25,$65,$20,$69,$73,$20,$74,$68,$65,$20,$6C,$65,$61,$73,$74,$20
+	.byte	$6E,$75,$6D,$62,$65,$72,$20,$74,$68,$61,$74,$20,$63,$61,$6E,$20
+	.byte	$62,$65,$20,$61,$64,$64,$65,$64,$20,$74,$6F,$20,$31,$2E,$20,$28
+	.byte	$25,$73,$29,$2E,$0A,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ s72 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s72: near
+
+	.dbg	func, "s72", "00", extern, "_s72"
+	.dbg	sym, "pd0", "00", auto, 0
+	.dbg	sym, "rc", "00", auto, -2
+	.dbg	sym, "ps", "00", auto, -4
+	.dbg	sym, "pt", "00", auto, -6
+	.dbg	sym, "k", "00", auto, -8
+	.dbg	sym, "j", "00", auto, -10
+	.dbg	sym, "i", "00", auto, -12
+	.dbg	sym, "lrc", "00", auto, -14
+	.dbg	sym, "c", "00", auto, -15
+	.dbg	sym, "s", "00", auto, -17
+	.dbg	sym, "l", "00", auto, -21
+	.dbg	sym, "u", "00", auto, -23
+	.dbg	sym, "d", "00", auto, -25
+	.dbg	sym, "f", "00", auto, -27
+
+.segment	"CODE"
+
+	.dbg	line, "cq72.c", 170
+	jsr     pushax
+	.dbg	line, "cq72.c", 190
+	ldy     #$1B
+	jsr     subysp
+	lda     #<(M0002)
+	ldx     #>(M0002)
+	ldy     #$17
+	jsr     staxysp
+	.dbg	line, "cq72.c", 191
+	ldy     #$1C
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     incaxy
+	ldy     #$15
+	jsr     staxysp
+	.dbg	line, "cq72.c", 192
+	ldx     #$00
+	lda     #$00
+	ldy     #$19
+	jsr     staxysp
+	.dbg	line, "cq72.c", 193
+	jmp     L0002
+L0002:	ldy     #$16
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1A
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$00
+	jsr     staspidx
+	tax
+	php
+	ldy     #$15
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$17
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	jne     L0002
+	.dbg	line, "cq72.c", 199
+	ldx     #$00
+	lda     #$02
+	ldy     #$13
+	jsr     staxysp
+	.dbg	line, "cq72.c", 200
+	ldy     #$14
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0006
+	cmp     #$02
+L0006:	jsr     boolne
+	jeq     L0005
+	.dbg	line, "cq72.c", 201
+	ldy     #$1A
+	jsr     ldaxysp
+	jsr     incax1
+	ldy     #$19
+	jsr     staxysp
+	.dbg	line, "cq72.c", 202
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq72.c", 207
+L0005:	ldy     #$14
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$16
+	jsr     ldaxysp
+	jsr     negax
+	jsr     tosaddax
+	cpx     #$00
+	bne     L0008
+	cmp     #$00
+L0008:	jsr     boolne
+	jeq     L0007
+	.dbg	line, "cq72.c", 208
+	ldy     #$1A
+	jsr     ldaxysp
+	jsr     incax2
+	ldy     #$19
+	jsr     staxysp
+	.dbg	line, "cq72.c", 209
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq72.c", 216
+L0007:	ldx     #$00
+	lda     #$00
+	ldy     #$13
+	jsr     staxysp
+	.dbg	line, "cq72.c", 217
+	ldx     #$00
+	lda     #$00
+	ldy     #$11
+	jsr     staxysp
+	jmp     L0009
+L000C:	ldy     #$14
+	jsr     ldaxysp
+	jsr     aslax1
+	ora     #$01
+	ldy     #$13
+	jsr     staxysp
+	ldy     #$12
+	jsr     ldaxysp
+	ldy     #$11
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0009
+L0009:	ldy     #$12
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1E
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldaxidx
+	jsr     tosltax
+	jne     L000C
+	.dbg	line, "cq72.c", 218
+	ldy     #$14
+	jsr     ldaxysp
+	jsr     complax
+	cpx     #$00
+	bne     L000E
+	cmp     #$00
+L000E:	jsr     boolne
+	jeq     L000D
+	.dbg	line, "cq72.c", 219
+	ldy     #$1A
+	jsr     ldaxysp
+	jsr     incax4
+	ldy     #$19
+	jsr     staxysp
+	.dbg	line, "cq72.c", 220
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$04
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq72.c", 227
+L000D:	ldx     #$00
+	lda     #$05
+	ldy     #$13
+	jsr     staxysp
+	.dbg	line, "cq72.c", 229
+	ldy     #$13
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	cpx     #$00
+	bne     L0010
+	cmp     #$06
+L0010:	jsr     boolne
+	jne     L0011
+	ldx     #$00
+	lda     #$01
+	ldy     #$13
+	jsr     subeqysp
+	.dbg	line, "cq72.c", 230
+	cpx     #$00
+	bne     L0012
+	cmp     #$05
+L0012:	jsr     boolne
+	jne     L0011
+	ldy     #$14
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0013
+	cmp     #$05
+L0013:	jsr     boolne
+	php
+	ldy     #$13
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	jne     L0011
+	ldy     #$14
+	jsr     ldaxysp
+	.dbg	line, "cq72.c", 231
+	cpx     #$00
+	bne     L0014
+	cmp     #$06
+L0014:	jsr     boolne
+	php
+	ldx     #$00
+	lda     #$01
+	ldy     #$13
+	jsr     subeqysp
+	plp
+	jne     L0011
+	ldy     #$14
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0015
+	cmp     #$05
+L0015:	jsr     boolne
+	jne     L0011
+	ldx     #$00
+	lda     #$00
+	jeq     L0016
+L0011:	ldx     #$00
+	lda     #$01
+L0016:	jeq     L000F
+	.dbg	line, "cq72.c", 232
+	ldy     #$1A
+	jsr     ldaxysp
+	jsr     incax8
+	ldy     #$19
+	jsr     staxysp
+	.dbg	line, "cq72.c", 233
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$08
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq72.c", 244
+L000F:	ldx     #$00
+	lda     #$1A
+	ldy     #$0C
+	sta     (sp),y
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$1A
+	ldy     #$06
+	jsr     steaxysp
+	.dbg	line, "cq72.c", 245
+	ldx     #$00
+	lda     #$1A
+	ldy     #$0A
+	jsr     staxysp
+	ldx     #$00
+	lda     #$1A
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq72.c", 246
+	ldx     #$00
+	lda     #$1A
+	ldy     #$0F
+	jsr     staxysp
+	.dbg	line, "cq72.c", 251
+	ldx     #$00
+	lda     #$1A
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "cq72.c", 252
+	ldx     #$00
+	lda     #$1A
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "cq72.c", 255
+	ldx     #$00
+	lda     #$00
+	ldy     #$0D
+	jsr     staxysp
+	.dbg	line, "cq72.c", 257
+	ldy     #$0A
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$1A
+	jsr     boolne
+	jne     L0018
+	ldy     #$0F
+	ldx     #$00
+	lda     (sp),y
+	.dbg	line, "cq72.c", 258
+	cmp     #$1A
+	jsr     boolne
+	jne     L0018
+	ldy     #$06
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$1A
+	jsr     boolne
+	jne     L0018
+	ldy     #$04
+	ldx     #$00
+	lda     (sp),y
+	.dbg	line, "cq72.c", 259
+	cmp     #$1A
+	jsr     boolne
+	jne     L0018
+	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$1A
+	jsr     boolne
+	jne     L0018
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$1A
+	jsr     boolne
+	jne     L0018
+	ldx     #$00
+	lda     #$00
+	jeq     L0019
+L0018:	ldx     #$00
+	lda     #$01
+L0019:	jeq     L0017
+	ldy     #$0E
+	jsr     ldaxysp
+	jsr     incax1
+	ldy     #$0D
+	jsr     staxysp
+	.dbg	line, "cq72.c", 261
+L0017:	ldy     #$0C
+	ldx     #$00
+	lda     (sp),y
+	cpx     #$00
+	bne     L001B
+	cmp     #$1A
+L001B:	jsr     boolne
+	jne     L001C
+	ldy     #$10
+	jsr     ldaxysp
+	.dbg	line, "cq72.c", 262
+	cpx     #$00
+	bne     L001D
+	cmp     #$1A
+L001D:	jsr     boolne
+	jne     L001C
+	ldy     #$07
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L001E
+	cmp     #$1A
+L001E:	jsr     boolne
+	jne     L001C
+	ldy     #$05
+	jsr     ldaxysp
+	.dbg	line, "cq72.c", 263
+	cpx     #$00
+	bne     L001F
+	cmp     #$1A
+L001F:	jsr     boolne
+	jne     L001C
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0020
+	cmp     #$1A
+L0020:	jsr     boolne
+	jne     L001C
+	ldy     #$03
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0021
+	cmp     #$1A
+L0021:	jsr     boolne
+	jne     L001C
+	ldx     #$00
+	lda     #$00
+	jeq     L0022
+L001C:	ldx     #$00
+	lda     #$01
+L0022:	jeq     L001A
+	ldy     #$0E
+	jsr     ldaxysp
+	jsr     incax2
+	ldy     #$0D
+	jsr     staxysp
+	.dbg	line, "cq72.c", 265
+L001A:	ldy     #$0C
+	ldx     #$00
+	lda     (sp),y
+	cpx     #$00
+	bne     L0024
+	cmp     #$1A
+L0024:	jsr     boolne
+	jne     L0025
+	ldy     #$0B
+	jsr     ldaxysp
+	.dbg	line, "cq72.c", 266
+	cpx     #$00
+	bne     L0026
+	cmp     #$1A
+L0026:	jsr     boolne
+	jne     L0025
+	ldy     #$07
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0027
+	cmp     #$1A
+L0027:	jsr     boolne
+	jne     L0025
+	ldy     #$05
+	jsr     ldaxysp
+	.dbg	line, "cq72.c", 267
+	cpx     #$00
+	bne     L0028
+	cmp     #$1A
+L0028:	jsr     boolne
+	jne     L0025
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0029
+	cmp     #$1A
+L0029:	jsr     boolne
+	jne     L0025
+	ldy     #$03
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L002A
+	cmp     #$1A
+L002A:	jsr     boolne
+	jne     L0025
+	ldx     #$00
+	lda     #$00
+	jeq     L002B
+L0025:	ldx     #$00
+	lda     #$01
+L002B:	jeq     L0023
+	ldy     #$0E
+	jsr     ldaxysp
+	jsr     incax4
+	ldy     #$0D
+	jsr     staxysp
+	.dbg	line, "cq72.c", 269
+L0023:	ldy     #$0C
+	ldx     #$00
+	lda     (sp),y
+	jsr     axulong
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$1A
+	jsr     tosneeax
+	jne     L002D
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     axlong
+	.dbg	line, "cq72.c", 270
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$1A
+	jsr     tosneeax
+	jne     L002D
+	ldy     #$10
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$1A
+	jsr     tosneeax
+	jne     L002D
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     axulong
+	.dbg	line, "cq72.c", 271
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$1A
+	jsr     tosneeax
+	jne     L002D
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$1A
+	jsr     tosneeax
+	jne     L002D
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$1A
+	jsr     tosneeax
+	jne     L002D
+	ldx     #$00
+	lda     #$00
+	jeq     L002E
+L002D:	ldx     #$00
+	lda     #$01
+L002E:	jeq     L002C
+	ldy     #$0E
+	jsr     ldaxysp
+	jsr     incax8
+	ldy     #$0D
+	jsr     staxysp
+	.dbg	line, "cq72.c", 273
+L002C:	ldy     #$0C
+	ldx     #$00
+	lda     (sp),y
+	cpx     #$00
+	bne     L0030
+	cmp     #$1A
+L0030:	jsr     boolne
+	jne     L0031
+	ldy     #$0B
+	jsr     ldaxysp
+	.dbg	line, "cq72.c", 274
+	cpx     #$00
+	bne     L0032
+	cmp     #$1A
+L0032:	jsr     boolne
+	jne     L0031
+	ldy     #$10
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0033
+	cmp     #$1A
+L0033:	jsr     boolne
+	jne     L0031
+	ldy     #$07
+	jsr     ldaxysp
+	.dbg	line, "cq72.c", 275
+	cpx     #$00
+	bne     L0034
+	cmp     #$1A
+L0034:	jsr     boolne
+	jne     L0031
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0035
+	cmp     #$1A
+L0035:	jsr     boolne
+	jne     L0031
+	ldy     #$03
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0036
+	cmp     #$1A
+L0036:	jsr     boolne
+	jne     L0031
+	ldx     #$00
+	lda     #$00
+	jeq     L0037
+L0031:	ldx     #$00
+	lda     #$01
+L0037:	jeq     L002F
+	ldy     #$0E
+	jsr     ldaxysp
+	ldy     #$10
+	jsr     incaxy
+	ldy     #$0D
+	jsr     staxysp
+	.dbg	line, "cq72.c", 287
+L002F:	ldy     #$0E
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0039
+	cmp     #$00
+L0039:	jsr     boolne
+	jeq     L0038
+	.dbg	line, "cq72.c", 288
+	ldy     #$1A
+	jsr     ldaxysp
+	ldy     #$10
+	jsr     incaxy
+	ldy     #$19
+	jsr     staxysp
+	.dbg	line, "cq72.c", 289
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$10
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq72.c", 294
+L0038:	ldy     #$1A
+	jsr     ldaxysp
+	jmp     L0001
+	.dbg	line, "cq72.c", 295
+L0001:	ldy     #$1D
+	jsr     addysp
+	rts
+
+	.dbg	line
+.segment	"DATA"
+
+M0001:
+	.byte	$73,$37,$32,$2C,$65,$72,$25,$64,$0A,$00
+M0002:
+	.byte	$73,$37,$32,$20,$20,$20,$20,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ section (int j, void *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_section: near
+
+	.dbg	func, "section", "00", extern, "_section"
+	.dbg	sym, "j", "00", auto, 2
+	.dbg	sym, "pd0", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "cq72.c", 304
+	jsr     pushax
+	.dbg	line, "cq72.c", 306
+	ldy     #$03
+	jsr     ldaxysp
+	jmp     L0002
+	.dbg	line, "cq72.c", 309
+L0002:	cpx     #$00
+	jne     L0006
+	cmp     #$00
+	jeq     L0004
+	cmp     #$01
+	jeq     L0005
+	jmp     L0003
+L0006:	jmp     L0003
+	.dbg	line, "cq72.c", 307
+L0004:	ldy     #$01
+	jsr     ldaxysp
+	jsr     _s26
+	jmp     L0003
+	.dbg	line, "cq72.c", 308
+L0005:	ldy     #$01
+	jsr     ldaxysp
+	jsr     _s72
+	jmp     L0003
+	.dbg	line, "cq72.c", 310
+L0003:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+	.dbg	sym, "n", "00", auto, 2
+	.dbg	sym, "args", "00", auto, 0
+	.dbg	sym, "j", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "cq72.c", 330
+	jsr     decsp2
+	ldx     #$00
+	lda     #$01
+	sta     M0001+14
+	stx     M0001+14+1
+	.dbg	line, "cq72.c", 331
+	ldx     #$00
+	lda     #$01
+	sta     M0001+16
+	stx     M0001+16+1
+	.dbg	line, "cq72.c", 332
+	ldx     #$00
+	lda     #$01
+	sta     M0001+18
+	stx     M0001+18+1
+	.dbg	line, "cq72.c", 333
+	ldx     #$00
+	lda     #$01
+	sta     M0001+20
+	stx     M0001+20+1
+	.dbg	line, "cq72.c", 335
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	sta     M0002
+	stx     M0002+1
+	.dbg	line, "cq72.c", 337
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+	jmp     L0002
+	.dbg	line, "cq72.c", 338
+L0005:	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	lda     M0002
+	ldx     M0002+1
+	jsr     _section
+	sta     M0001+22
+	stx     M0001+22+1
+	.dbg	line, "cq72.c", 339
+	lda     M0001+24
+	ldx     M0001+24+1
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     tosaddax
+	sta     M0001+24
+	stx     M0001+24+1
+	.dbg	line, "cq72.c", 340
+	lda     M0001+14
+	ldx     M0001+14+1
+	cpx     #$00
+	bne     L0008
+	cmp     #$00
+L0008:	jsr     boolne
+	jeq     L0007
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	lda     #<(M0001+26)
+	ldx     #>(M0001+26)
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "cq72.c", 337
+L0007:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	cmp     #$02
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0005
+	.dbg	line, "cq72.c", 343
+	lda     M0001+24
+	ldx     M0001+24+1
+	cpx     #$00
+	bne     L000A
+	cmp     #$00
+L000A:	jsr     booleq
+	jeq     L0009
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cq72.c", 344
+	jmp     L000B
+L0009:	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cq72.c", 346
+L000B:	lda     M0001+24
+	ldx     M0001+24+1
+	jmp     L0001
+	.dbg	line, "cq72.c", 347
+L0001:	jsr     incsp6
+	rts
+
+	.dbg	line
+.segment	"BSS"
+
+M0001:
+	.res	34,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
@@ -0,0 +1,1247 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_printf
+	.export		_lbits
+	.export		_ubits
+	.export		_fbits
+	.export		_dbits
+	.export		_flgs
+	.export		_flgm
+	.export		_flgd
+	.export		_flgl
+	.export		_rrc
+	.export		_crc
+	.export		_rfs
+	.export		_s26
+	.export		_s757
+	.export		_section
+	.export		_main
+
+.segment	"RODATA"
+
+S0006:
+	.byte	$49,$6E,$63,$72,$65,$61,$73,$69,$6E,$67,$20,$61,$72,$72,$61,$79
+	.byte	$20,$65,$6C,$65,$6D,$65,$6E,$74,$73,$20,$61,$73,$73,$69,$67,$6E
+	.byte	$65,$64,$20,$74,$6F,$20,$64,$65,$63,$72,$65,$61,$73,$69,$6E,$67
+	.byte	$20,$6C,$6F,$63,$61,$74,$69,$6F,$6E,$73,$0A,$00
+S0007:
+	.byte	$53,$65,$63,$74,$69,$6F,$6E,$20,$25,$73,$20,$72,$65,$74,$75,$72
+	.byte	$6E,$65,$64,$20,$25,$64,$2E,$0A,$00
+S0008:
+	.byte	$0A,$4E,$6F,$20,$65,$72,$72,$6F,$72,$73,$20,$64,$65,$74,$65,$63
+	.byte	$74,$65,$64,$2E,$0A,$00
+S0009:
+	.byte	$0A,$46,$61,$69,$6C,$65,$64,$2E,$0A,$00
+
+.segment	"BSS"
+
+_lbits:
+	.res	2,$00
+_ubits:
+	.res	2,$00
+_fbits:
+	.res	2,$00
+_dbits:
+	.res	2,$00
+_flgs:
+	.res	2,$00
+_flgm:
+	.res	2,$00
+_flgd:
+	.res	2,$00
+_flgl:
+	.res	2,$00
+_rrc:
+	.res	2,$00
+_crc:
+	.res	2,$00
+_rfs:
+	.res	8,$00
+
+; ---------------------------------------------------------------
+; int __near__ s26 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s26: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp6
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$1A
+	bcc     L0002
+	inx
+L0002:	ldy     #$02
+	jsr     staxysp
+L0003:	ldy     #$03
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	ldy     #$05
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$00
+	lda     (ptr1),y
+	sta     (sreg),y
+	tax
+	php
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	bne     L0003
+	ldy     #$07
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	lda     #$00
+	tay
+	sta     (ptr1),y
+	iny
+	sta     (ptr1),y
+	sta     (sp),y
+	tya
+	dey
+	sta     (sp),y
+	jmp     L0008
+L000B:	lda     (sp),y
+	asl     a
+	sta     (sp),y
+	ldy     #$07
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	iny
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	clc
+	adc     #$01
+	bcc     L000C
+	inx
+L000C:	sta     (sreg),y
+	iny
+	txa
+	sta     (sreg),y
+L0008:	ldy     #$01
+	lda     (sp),y
+	dey
+	cmp     (sp),y
+	bne     L000B
+	ldy     #$07
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	iny
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	sta     tmp1
+	dey
+	lda     (ptr1),y
+	asl     a
+	rol     tmp1
+	ldy     #$02
+	sta     (sreg),y
+	iny
+	lda     tmp1
+	sta     (sreg),y
+	ldy     #$07
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	iny
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	sta     tmp1
+	dey
+	lda     (ptr1),y
+	asl     a
+	rol     tmp1
+	ldy     #$04
+	sta     (sreg),y
+	iny
+	lda     tmp1
+	sta     (sreg),y
+	ldy     #$07
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	iny
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     shlax2
+	ldy     #$06
+	sta     (sreg),y
+	iny
+	txa
+	sta     (sreg),y
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	iny
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$01
+	lda     (ptr1),y
+	sta     tmp1
+	dey
+	lda     (ptr1),y
+	asl     a
+	rol     tmp1
+	ldy     #$08
+	sta     (sreg),y
+	iny
+	lda     tmp1
+	sta     (sreg),y
+	ldx     #$00
+	txa
+	jmp     incsp8
+
+.segment	"DATA"
+
+M0001:
+	.byte	$73,$32,$36,$20,$20,$20,$20,$00
+M0002:
+	.byte	$25,$33,$64,$20,$62,$69,$74,$73,$20,$69,$6E,$20,$25,$73,$73,$2E
+	.byte	$0A,$00
+M0003:
+	.byte	$25,$65,$20,$69,$73,$20,$74,$68,$65,$20,$6C,$65,$61,$73,$74,$20
+	.byte	$6E,$75,$6D,$62,$65,$72,$20,$74,$68,$61,$74,$20,$63,$61,$6E,$20
+	.byte	$62,$65,$20,$61,$64,$64,$65,$64,$20,$74,$6F,$20,$31,$2E,$20,$28
+	.byte	$25,$73,$29,$2E,$0A,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ s757 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s757: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$40
+	jsr     subysp
+	lda     #<(M0002)
+	ldx     #>(M0002)
+	ldy     #$3C
+	jsr     staxysp
+	ldy     #$41
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$1A
+	bcc     L0002
+	inx
+L0002:	ldy     #$3A
+	jsr     staxysp
+	ldy     #$3E
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+L0003:	ldy     #$3B
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	ldy     #$3D
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$00
+	lda     (ptr1),y
+	sta     (sreg),y
+	tax
+	php
+	ldy     #$3A
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$3C
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	bne     L0003
+	ldx     #$00
+	lda     #$28
+	ldy     #$38
+	jsr     staxysp
+	jsr     aslax3
+	jsr     aslax2
+	cpx     #$05
+	bne     L0008
+	cmp     #$00
+	bne     L0008
+	ldy     #$39
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     asrax3
+	jsr     asrax2
+	cpx     #$00
+	bne     L0008
+	cmp     #$01
+	beq     L0068
+L0008:	ldy     #$3F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$01
+	bcc     L000B
+	inx
+L000B:	jsr     staxysp
+	ldy     #$41
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$13
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     #$00
+	bne     L0078
+	cmp     #$00
+	beq     L0068
+L0078:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L0068:	ldy     #$36
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$34
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L006A
+L0011:	ldx     #$00
+	lda     #$01
+	ldy     #$06
+	jsr     staxysp
+	ldy     #$41
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$08
+	lda     (ptr1),y
+	sec
+	sbc     #$01
+	tay
+	lda     #$01
+	jsr     shlaxy
+	ldy     #$04
+	jsr     staxysp
+	ldx     #$00
+	txa
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$34
+	lda     (sp),y
+	tay
+	lda     #$FF
+	dex
+	jsr     shraxy
+	jsr     stax0sp
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     complax
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$34
+	lda     (sp),y
+	tay
+	lda     ptr1
+	ldx     ptr1+1
+	jsr     shlaxy
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$32
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L0069
+L0016:	ldy     #$33
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$34
+	cmp     (sp),y
+	txa
+	iny
+	sbc     (sp),y
+	bvc     L0061
+	eor     #$80
+L0061:	asl     a
+	lda     #$00
+	rol     a
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$08
+	and     (sp),y
+	pha
+	txa
+	iny
+	and     (sp),y
+	tax
+	pla
+	cpx     #$00
+	bne     L0018
+	cmp     #$00
+L0018:	jsr     booleq
+	jsr     tosicmp0
+	bne     L0019
+	ldy     #$33
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$34
+	cmp     (sp),y
+	txa
+	iny
+	sbc     (sp),y
+	bvc     L0062
+	eor     #$80
+L0062:	asl     a
+	lda     #$00
+	rol     a
+	jsr     pusha0
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$06
+	and     (sp),y
+	pha
+	txa
+	iny
+	and     (sp),y
+	tax
+	pla
+	cpx     #$00
+	bne     L001A
+	cmp     #$00
+L001A:	jsr     booleq
+	jsr     tosicmp0
+	beq     L0017
+L0019:	ldy     #$36
+	lda     #$01
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+L0017:	ldy     #$07
+	lda     (sp),y
+	sta     tmp1
+	dey
+	lda     (sp),y
+	asl     a
+	rol     tmp1
+	ldx     tmp1
+	jsr     staxysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     shrax1
+	jsr     staxysp
+	ldy     #$32
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L0069:	ldy     #$35
+	jsr     pushwysp
+	ldy     #$43
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$09
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     tosicmp
+	jmi     L0016
+	ldy     #$34
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L006A:	ldy     #$37
+	jsr     pushwysp
+	ldy     #$43
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$09
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     tosicmp
+	jmi     L0011
+	ldy     #$36
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L001F
+	ldy     #$3F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$02
+	bcc     L001E
+	inx
+L001E:	jsr     staxysp
+	ldy     #$41
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$13
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     #$00
+	bne     L0079
+	cmp     #$00
+	beq     L001F
+L0079:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$02
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L001F:	ldy     #$30
+	lda     #$03
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$2E
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$2C
+	lda     #$01
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$31
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$2E
+	cmp     (sp),y
+	txa
+	iny
+	sbc     (sp),y
+	bvc     L0063
+	eor     #$80
+L0063:	asl     a
+	lda     #$00
+	rol     a
+	ldy     #$2C
+	cmp     (sp),y
+	lda     #$00
+	iny
+	sbc     (sp),y
+	bvc     L0064
+	eor     #$80
+L0064:	asl     a
+	lda     #$00
+	rol     a
+	cmp     #$01
+	beq     L0021
+	ldy     #$3F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$04
+	bcc     L0023
+	inx
+L0023:	jsr     staxysp
+	ldy     #$41
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$13
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     #$00
+	bne     L007A
+	cmp     #$00
+	beq     L0021
+L007A:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	tay
+	jsr     _printf
+L0021:	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$0C
+	bcc     L0028
+	inx
+L0028:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$0C
+	bcc     L002A
+	inx
+L002A:	jsr     tosicmp
+	bne     L0026
+	ldy     #$3F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$08
+	bcc     L002B
+	inx
+L002B:	jsr     staxysp
+	ldy     #$41
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$13
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     #$00
+	bne     L007B
+	cmp     #$00
+	beq     L0026
+L007B:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$08
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L0026:	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$0C
+	bcc     L0030
+	inx
+L0030:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$0C
+	bcc     L0032
+	inx
+L0032:	jsr     tosicmp
+	bcs     L0033
+	ldy     #$41
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$11
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     #$00
+	bne     L007C
+	cmp     #$00
+	beq     L0033
+L007C:	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+L0033:	ldy     #$36
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$32
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L006B
+L0038:	iny
+	lda     (sp),y
+	sta     tmp1
+	dey
+	lda     (sp),y
+	asl     a
+	rol     tmp1
+	ldx     tmp1
+	clc
+	adc     #$0A
+	bcc     L003A
+	inx
+	clc
+L003A:	adc     sp
+	sta     ptr1
+	txa
+	adc     sp+1
+	sta     ptr1+1
+	lda     #$01
+	ldy     #$00
+	sta     (ptr1),y
+	iny
+	lda     #$00
+	sta     (ptr1),y
+	ldy     #$32
+	tax
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$33
+L006B:	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cmp     #$10
+	txa
+	sbc     #$00
+	bvc     L0039
+	eor     #$80
+L0039:	bmi     L0038
+	ldy     #$0C
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$12
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$16
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$1C
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$24
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$30
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L0075
+L006D:	ldy     #$2E
+	txa
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L0074
+L006F:	ldy     #$2C
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L0073
+L0071:	ldy     #$2A
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L0072
+L0053:	ldy     #$31
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$2E
+	cmp     (sp),y
+	txa
+	iny
+	sbc     (sp),y
+	bvc     L0065
+	eor     #$80
+L0065:	asl     a
+	lda     #$00
+	rol     a
+	sta     ptr1
+	ldy     #$2D
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$2A
+	cmp     (sp),y
+	txa
+	iny
+	sbc     (sp),y
+	bvc     L0066
+	eor     #$80
+L0066:	asl     a
+	lda     #$00
+	rol     a
+	cmp     ptr1
+	jsr     booleq
+	jsr     pusha0
+	ldy     #$33
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     aslax3
+	sta     ptr1
+	stx     ptr1+1
+	dey
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     aslax2
+	clc
+	adc     ptr1
+	sta     ptr1
+	txa
+	adc     ptr1+1
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     tmp1
+	dey
+	lda     (sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	sta     ptr1
+	lda     tmp1
+	adc     ptr1+1
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	sta     tmp1
+	pla
+	asl     a
+	rol     tmp1
+	ldx     tmp1
+	clc
+	adc     #$0C
+	bcc     L0056
+	inx
+	clc
+L0056:	adc     sp
+	sta     ptr1
+	txa
+	adc     sp+1
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     tosicmp
+	beq     L0055
+	ldy     #$36
+	lda     #$01
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+L0055:	ldy     #$2A
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$2B
+L0072:	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cmp     #$02
+	txa
+	sbc     #$00
+	bvc     L0054
+	eor     #$80
+L0054:	jmi     L0053
+	ldy     #$2C
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$2D
+L0073:	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cmp     #$02
+	txa
+	sbc     #$00
+	bvc     L004F
+	eor     #$80
+L004F:	jmi     L0071
+	ldy     #$2E
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$2F
+L0074:	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cmp     #$02
+	txa
+	sbc     #$00
+	bvc     L004A
+	eor     #$80
+L004A:	jmi     L006F
+	ldy     #$30
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$31
+L0075:	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cmp     #$02
+	txa
+	sbc     #$00
+	bvc     L0045
+	eor     #$80
+L0045:	asl     a
+	ldx     #$00
+	jcs     L006D
+	ldy     #$36
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L0077
+	ldy     #$3F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$10
+	bcc     L0059
+	inx
+L0059:	jsr     staxysp
+	ldy     #$41
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$13
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     #$00
+	bne     L007D
+	cmp     #$00
+	beq     L0077
+L007D:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$10
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	txa
+L0077:	ldy     #$08
+	jsr     staxysp
+	ldy     #$3F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$42
+	jmp     addysp
+
+.segment	"DATA"
+
+M0001:
+	.byte	$73,$37,$35,$37,$2C,$65,$72,$25,$64,$0A,$00
+M0002:
+	.byte	$73,$37,$35,$37,$20,$20,$20,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ section (int j, void *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_section: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cpx     #$00
+	bne     L0003
+	cmp     #$00
+	beq     L0004
+	cmp     #$01
+	beq     L0005
+	jmp     L0003
+L0004:	dey
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _s26
+	jmp     L0003
+L0005:	dey
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _s757
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	ldx     #$00
+	lda     #$01
+	sta     M0001+14
+	stx     M0001+14+1
+	sta     M0001+16
+	stx     M0001+16+1
+	sta     M0001+18
+	stx     M0001+18+1
+	sta     M0001+20
+	stx     M0001+20+1
+	lda     #>(M0001)
+	sta     M0002+1
+	lda     #<(M0001)
+	sta     M0002
+	ldy     #$00
+	txa
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L000D
+L0005:	jsr     pushw0sp
+	lda     M0002
+	ldx     M0002+1
+	jsr     _section
+	sta     M0001+22
+	stx     M0001+22+1
+	lda     M0001+24
+	clc
+	adc     M0001+22
+	sta     M0001+24
+	lda     M0001+24+1
+	adc     M0001+22+1
+	sta     M0001+24+1
+	lda     M0001+14
+	ora     M0001+14+1
+	beq     L0007
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	lda     #<(M0001+26)
+	ldx     #>(M0001+26)
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+L0007:	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	ldy     #$01
+L000D:	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cmp     #$02
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	bmi     L0005
+	lda     M0001+24
+	ora     M0001+24+1
+	bne     L0009
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jmp     L000F
+L0009:	lda     #<(S0009)
+	ldx     #>(S0009)
+L000F:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     M0001+24
+	ldx     M0001+24+1
+	jmp     incsp6
+
+.segment	"BSS"
+
+M0001:
+	.res	34,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
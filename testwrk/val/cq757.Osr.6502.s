@@ -0,0 +1,944 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_printf
+	.export		_lbits
+	.export		_ubits
+	.export		_fbits
+	.export		_dbits
+	.export		_flgs
+	.export		_flgm
+	.export		_flgd
+	.export		_flgl
+	.export		_rrc
+	.export		_crc
+	.export		_rfs
+	.export		_s26
+	.export		_s757
+	.export		_section
+	.export		_main
+
+.segment	"RODATA"
+
+S0006:
+	.byte	$49,$6E,$63,$72,$65,$61,$73,$69,$6E,$67,$20,$61,$72,$72,$61,$79
+	.byte	$20,$65,$6C,$65,$6D,$65,$6E,$74,$73,$20,$61,$73,$73,$69,$67,$6E
+	.byte	$65,$64,$20,$74,$6F,$20,$64,$65,$63,$72,$65,$61,$73,$69,$6E,$67
+	.byte	$20,$6C,$6F,$63,$61,$74,$69,$6F,$6E,$73,$0A,$00
+S0007:
+	.byte	$53,$65,$63,$74,$69,$6F,$6E,$20,$25,$73,$20,$72,$65,$74,$75,$72
+	.byte	$6E,$65,$64,$20,$25,$64,$2E,$0A,$00
+S0008:
+	.byte	$0A,$4E,$6F,$20,$65,$72,$72,$6F,$72,$73,$20,$64,$65,$74,$65,$63
+	.byte	$74,$65,$64,$2E,$0A,$00
+S0009:
+	.byte	$0A,$46,$61,$69,$6C,$65,$64,$2E,$0A,$00
+
+.segment	"BSS"
+
+_lbits:
+	.res	2,$00
+_ubits:
+	.res	2,$00
+_fbits:
+	.res	2,$00
+_dbits:
+	.res	2,$00
+_flgs:
+	.res	2,$00
+_flgm:
+	.res	2,$00
+_flgd:
+	.res	2,$00
+_flgl:
+	.res	2,$00
+_rrc:
+	.res	2,$00
+_crc:
+	.res	2,$00
+_rfs:
+	.res	8,$00
+
+; ---------------------------------------------------------------
+; int __near__ s26 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s26: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp6
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     incaxy
+	ldy     #$02
+	jsr     staxysp
+L0002:	ldy     #$03
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$05
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	sta     (sreg),y
+	tax
+	php
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	bne     L0002
+	ldy     #$07
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$00
+	tay
+	sta     (ptr1),y
+	iny
+	sta     (ptr1),y
+	sta     (sp),y
+	tya
+	dey
+	sta     (sp),y
+	jmp     L0007
+L0009:	lda     (sp),y
+	asl     a
+	sta     (sp),y
+	ldy     #$07
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     ldaxi
+	jsr     incax1
+	ldy     #$00
+	sta     (sreg),y
+	iny
+	txa
+	sta     (sreg),y
+L0007:	ldy     #$01
+	lda     (sp),y
+	dey
+	cmp     (sp),y
+	bne     L0009
+	ldy     #$07
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     ldaxi
+	jsr     shlax1
+	ldy     #$02
+	sta     (sreg),y
+	iny
+	txa
+	sta     (sreg),y
+	ldy     #$07
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     ldaxi
+	jsr     shlax1
+	ldy     #$04
+	sta     (sreg),y
+	iny
+	txa
+	sta     (sreg),y
+	ldy     #$07
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     ldaxi
+	jsr     shlax2
+	ldy     #$06
+	sta     (sreg),y
+	iny
+	txa
+	sta     (sreg),y
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     ldaxi
+	jsr     shlax1
+	ldy     #$08
+	sta     (sreg),y
+	iny
+	txa
+	sta     (sreg),y
+	ldx     #$00
+	txa
+	jmp     incsp8
+
+.segment	"DATA"
+
+M0001:
+	.byte	$73,$32,$36,$20,$20,$20,$20,$00
+M0002:
+	.byte	$25,$33,$64,$20,$62,$69,$74,$73,$20,$69,$6E,$20,$25,$73,$73,$2E
+	.byte	$0A,$00
+M0003:
+	.byte	$25,$65,$20,$69,$73,$20,$74,$68,$65,$20,$6C,$65,$61,$73,$74,$20
+	.byte	$6E,$75,$6D,$62,$65,$72,$20,$74,$68,$61,$74,$20,$63,$61,$6E,$20
+	.byte	$62,$65,$20,$61,$64,$64,$65,$64,$20,$74,$6F,$20,$31,$2E,$20,$28
+	.byte	$25,$73,$29,$2E,$0A,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ s757 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s757: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$40
+	jsr     subysp
+	lda     #<(M0002)
+	ldx     #>(M0002)
+	ldy     #$3C
+	jsr     staxysp
+	ldy     #$41
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     incaxy
+	ldy     #$3A
+	jsr     staxysp
+	ldx     #$00
+	txa
+	ldy     #$3E
+	jsr     staxysp
+L0002:	ldy     #$3B
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$3D
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	sta     (sreg),y
+	tax
+	php
+	ldy     #$3A
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$3C
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	bne     L0002
+	ldx     #$00
+	lda     #$28
+	ldy     #$38
+	jsr     staxysp
+	jsr     aslax3
+	jsr     aslax2
+	cpx     #$05
+	bne     L0007
+	cmp     #$00
+	bne     L0007
+	ldy     #$39
+	jsr     ldaxysp
+	jsr     asrax3
+	jsr     asrax2
+	cpx     #$00
+	bne     L0007
+	cmp     #$01
+	beq     L0062
+L0007:	ldy     #$3F
+	jsr     ldaxysp
+	jsr     incax1
+	ldy     #$3E
+	jsr     staxysp
+	ldy     #$41
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L005B
+	cmp     #$00
+	beq     L0063
+L005B:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+L0062:	txa
+L0063:	ldy     #$36
+	jsr     staxysp
+	ldy     #$34
+	jsr     staxysp
+	jmp     L000C
+L000F:	ldx     #$00
+	lda     #$01
+	ldy     #$06
+	jsr     staxysp
+	ldy     #$41
+	jsr     ldaxysp
+	ldy     #$09
+	jsr     ldaxidx
+	sec
+	sbc     #$01
+	tay
+	lda     #$01
+	ldx     #$00
+	jsr     shlaxy
+	ldy     #$04
+	jsr     staxysp
+	ldx     #$00
+	txa
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$34
+	lda     (sp),y
+	tay
+	lda     #$FF
+	dex
+	jsr     shraxy
+	jsr     stax0sp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     complax
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$34
+	lda     (sp),y
+	tay
+	lda     ptr1
+	ldx     ptr1+1
+	jsr     shlaxy
+	ldy     #$02
+	jsr     staxysp
+	ldx     #$00
+	txa
+	ldy     #$32
+	jsr     staxysp
+	jmp     L0010
+L0013:	ldy     #$33
+	jsr     ldaxysp
+	ldy     #$34
+	cmp     (sp),y
+	txa
+	iny
+	sbc     (sp),y
+	bvc     L004B
+	eor     #$80
+L004B:	asl     a
+	lda     #$00
+	rol     a
+	jsr     pusha0
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$08
+	and     (sp),y
+	pha
+	txa
+	iny
+	and     (sp),y
+	tax
+	pla
+	cpx     #$00
+	bne     L0015
+	cmp     #$00
+L0015:	jsr     booleq
+	jsr     tosicmp0
+	bne     L0016
+	ldy     #$33
+	jsr     ldaxysp
+	ldy     #$34
+	cmp     (sp),y
+	txa
+	iny
+	sbc     (sp),y
+	bvc     L004C
+	eor     #$80
+L004C:	asl     a
+	lda     #$00
+	rol     a
+	jsr     pusha0
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$06
+	and     (sp),y
+	pha
+	txa
+	iny
+	and     (sp),y
+	tax
+	pla
+	cpx     #$00
+	bne     L0017
+	cmp     #$00
+L0017:	jsr     booleq
+	jsr     tosicmp0
+	beq     L0014
+L0016:	ldx     #$00
+	lda     #$01
+	ldy     #$36
+	jsr     staxysp
+L0014:	ldy     #$07
+	jsr     ldaxysp
+	jsr     shlax1
+	ldy     #$06
+	jsr     staxysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     shrax1
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$32
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L0010:	ldy     #$35
+	jsr     pushwysp
+	ldy     #$43
+	jsr     ldaxysp
+	ldy     #$09
+	jsr     ldaxidx
+	jsr     tosicmp
+	jmi     L0013
+	ldy     #$34
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L000C:	ldy     #$37
+	jsr     pushwysp
+	ldy     #$43
+	jsr     ldaxysp
+	ldy     #$09
+	jsr     ldaxidx
+	jsr     tosicmp
+	jmi     L000F
+	ldy     #$36
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L001B
+	ldy     #$3F
+	jsr     ldaxysp
+	jsr     incax2
+	ldy     #$3E
+	jsr     staxysp
+	ldy     #$41
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L005C
+	cmp     #$00
+	beq     L0064
+L005C:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$02
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L001B:	ldx     #$00
+L0064:	lda     #$03
+	ldy     #$30
+	jsr     staxysp
+	lda     #$02
+	ldy     #$2E
+	jsr     staxysp
+	lda     #$01
+	ldy     #$2C
+	jsr     staxysp
+	ldy     #$31
+	jsr     ldaxysp
+	ldy     #$2E
+	cmp     (sp),y
+	txa
+	iny
+	sbc     (sp),y
+	bvc     L004D
+	eor     #$80
+L004D:	asl     a
+	lda     #$00
+	rol     a
+	ldy     #$2C
+	cmp     (sp),y
+	lda     #$00
+	iny
+	sbc     (sp),y
+	bvc     L004E
+	eor     #$80
+L004E:	asl     a
+	lda     #$00
+	rol     a
+	cmp     #$01
+	beq     L001D
+	ldy     #$3F
+	jsr     ldaxysp
+	jsr     incax4
+	ldy     #$3E
+	jsr     staxysp
+	ldy     #$41
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L005D
+	cmp     #$00
+	beq     L001D
+L005D:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	tay
+	jsr     _printf
+L001D:	lda     #$0C
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$0C
+	jsr     leaa0sp
+	jsr     tosicmp
+	bne     L0021
+	ldy     #$3F
+	jsr     ldaxysp
+	jsr     incax8
+	ldy     #$3E
+	jsr     staxysp
+	ldy     #$41
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L005E
+	cmp     #$00
+	beq     L0021
+L005E:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$08
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L0021:	lda     #$0C
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$0C
+	jsr     leaa0sp
+	jsr     tosicmp
+	bcs     L0025
+	ldy     #$41
+	jsr     ldaxysp
+	ldy     #$11
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L005F
+	cmp     #$00
+	beq     L0066
+L005F:	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+L0025:	ldx     #$00
+	txa
+L0066:	ldy     #$36
+	jsr     staxysp
+	ldy     #$32
+	jsr     staxysp
+	jmp     L0027
+L002A:	ldy     #$33
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #$0A
+	bcc     L002C
+	inx
+	clc
+L002C:	adc     sp
+	sta     ptr1
+	txa
+	adc     sp+1
+	sta     ptr1+1
+	lda     #$01
+	ldy     #$00
+	sta     (ptr1),y
+	iny
+	lda     #$00
+	sta     (ptr1),y
+	ldy     #$32
+	tax
+	lda     #$01
+	jsr     addeqysp
+L0027:	ldy     #$33
+	jsr     ldaxysp
+	cmp     #$10
+	txa
+	sbc     #$00
+	bvc     L002B
+	eor     #$80
+L002B:	bmi     L002A
+	ldx     #$00
+	txa
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$12
+	jsr     staxysp
+	ldy     #$16
+	jsr     staxysp
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$1C
+	jsr     staxysp
+	ldy     #$24
+	jsr     staxysp
+	ldy     #$30
+	jsr     staxysp
+	jmp     L002D
+L0054:	ldy     #$2E
+	jsr     staxysp
+	jmp     L0032
+L0056:	ldy     #$2C
+	jsr     staxysp
+	jmp     L0037
+L0058:	ldy     #$2A
+	jsr     staxysp
+	jmp     L003C
+L003F:	ldy     #$31
+	jsr     ldaxysp
+	ldy     #$2E
+	cmp     (sp),y
+	txa
+	iny
+	sbc     (sp),y
+	bvc     L004F
+	eor     #$80
+L004F:	asl     a
+	lda     #$00
+	rol     a
+	sta     ptr1
+	ldy     #$2D
+	jsr     ldaxysp
+	ldy     #$2A
+	cmp     (sp),y
+	txa
+	iny
+	sbc     (sp),y
+	bvc     L0050
+	eor     #$80
+L0050:	asl     a
+	lda     #$00
+	rol     a
+	cmp     ptr1
+	jsr     booleq
+	jsr     pusha0
+	ldy     #$33
+	jsr     ldaxysp
+	jsr     aslax3
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$31
+	jsr     ldaxysp
+	jsr     aslax2
+	clc
+	adc     ptr1
+	sta     ptr1
+	txa
+	adc     ptr1+1
+	sta     ptr1+1
+	ldy     #$2F
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     ptr1
+	sta     ptr1
+	txa
+	adc     ptr1+1
+	sta     ptr1+1
+	ldy     #$2D
+	jsr     ldaxysp
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	jsr     aslax1
+	clc
+	adc     #$0C
+	bcc     L0042
+	inx
+	clc
+L0042:	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	jsr     ldaxi
+	jsr     tosicmp
+	beq     L0041
+	ldx     #$00
+	lda     #$01
+	ldy     #$36
+	jsr     staxysp
+L0041:	ldy     #$2A
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L003C:	ldy     #$2B
+	jsr     ldaxysp
+	cmp     #$02
+	txa
+	sbc     #$00
+	bvc     L0040
+	eor     #$80
+L0040:	jmi     L003F
+	ldy     #$2C
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L0037:	ldy     #$2D
+	jsr     ldaxysp
+	cmp     #$02
+	txa
+	sbc     #$00
+	bvc     L003B
+	eor     #$80
+L003B:	asl     a
+	lda     #$00
+	tax
+	jcs     L0058
+	ldy     #$2E
+	lda     #$01
+	jsr     addeqysp
+L0032:	ldy     #$2F
+	jsr     ldaxysp
+	cmp     #$02
+	txa
+	sbc     #$00
+	bvc     L0036
+	eor     #$80
+L0036:	asl     a
+	lda     #$00
+	tax
+	jcs     L0056
+	ldy     #$30
+	lda     #$01
+	jsr     addeqysp
+L002D:	ldy     #$31
+	jsr     ldaxysp
+	cmp     #$02
+	txa
+	sbc     #$00
+	bvc     L0031
+	eor     #$80
+L0031:	asl     a
+	lda     #$00
+	tax
+	jcs     L0054
+	ldy     #$36
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L005A
+	ldy     #$3F
+	jsr     ldaxysp
+	ldy     #$10
+	jsr     incaxy
+	ldy     #$3E
+	jsr     staxysp
+	ldy     #$41
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0060
+	cmp     #$00
+	beq     L005A
+L0060:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$10
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	txa
+L005A:	ldy     #$08
+	jsr     staxysp
+	ldy     #$3F
+	jsr     ldaxysp
+	ldy     #$42
+	jmp     addysp
+
+.segment	"DATA"
+
+M0001:
+	.byte	$73,$37,$35,$37,$2C,$65,$72,$25,$64,$0A,$00
+M0002:
+	.byte	$73,$37,$35,$37,$20,$20,$20,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ section (int j, void *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_section: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0003
+	cmp     #$00
+	beq     L0004
+	cmp     #$01
+	beq     L0005
+	jmp     L0003
+L0004:	jsr     ldax0sp
+	jsr     _s26
+	jmp     L0003
+L0005:	jsr     ldax0sp
+	jsr     _s757
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	ldx     #$00
+	lda     #$01
+	sta     M0001+14
+	stx     M0001+14+1
+	sta     M0001+16
+	stx     M0001+16+1
+	sta     M0001+18
+	stx     M0001+18+1
+	sta     M0001+20
+	stx     M0001+20+1
+	lda     #>(M0001)
+	sta     M0002+1
+	lda     #<(M0001)
+	sta     M0002
+	txa
+	jsr     stax0sp
+	jmp     L0002
+L0005:	jsr     pushw0sp
+	lda     M0002
+	ldx     M0002+1
+	jsr     _section
+	sta     M0001+22
+	stx     M0001+22+1
+	lda     M0001+24
+	clc
+	adc     M0001+22
+	sta     M0001+24
+	lda     M0001+24+1
+	adc     M0001+22+1
+	sta     M0001+24+1
+	lda     M0001+14
+	ora     M0001+14+1
+	beq     L0007
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	lda     #<(M0001+26)
+	ldx     #>(M0001+26)
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+L0007:	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+L0002:	jsr     ldax0sp
+	cmp     #$02
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	bmi     L0005
+	lda     M0001+24
+	ora     M0001+24+1
+	bne     L0009
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jmp     L000E
+L0009:	lda     #<(S0009)
+	ldx     #>(S0009)
+L000E:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     M0001+24
+	ldx     M0001+24+1
+	jmp     incsp6
+
+.segment	"BSS"
+
+M0001:
+	.res	34,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
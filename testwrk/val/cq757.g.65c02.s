@@ -0,0 +1,1193 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "cq757.c", 9965, 1613073744
+	.dbg		file, "common.h", 522, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/stdlib.h", 5999, 1613073744
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_lbits
+	.export		_ubits
+	.export		_fbits
+	.export		_dbits
+	.export		_flgs
+	.export		_flgm
+	.export		_flgd
+	.export		_flgl
+	.export		_rrc
+	.export		_crc
+	.export		_rfs
+	.export		_s26
+	.export		_s757
+	.export		_section
+	.export		_main
+
+.segment	"RODATA"
+
+S0006:
+	.byte	$49,$6E,$63,$72,$65,$61,$73,$69,$6E,$67,$20,$61,$72,$72,$61,$79
+	.byte	$20,$65,$6C,$65,$6D,$65,$6E,$74,$73,$20,$61,$73,$73,$69,$67,$6E
+	.byte	$65,$64,$20,$74,$6F,$20,$64,$65,$63,$72,$65,$61,$73,$69,$6E,$67
+	.byte	$20,$6C,$6F,$63,$61,$74,$69,$6F,$6E,$73,$0A,$00
+S0007:
+	.byte	$53,$65,$63,$74,$69,$6F,$6E,$20,$25,$73,$20,$72,$65,$74,$75,$72
+	.byte	$6E,$65,$64,$20,$25,$64,$2E,$0A,$00
+S0008:
+	.byte	$0A,$4E,$6F,$20,$65,$72,$72,$6F,$72,$73,$20,$64,$65,$74,$65,$63
+	.byte	$74,$65,$64,$2E,$0A,$00
+S0009:
+	.byte	$0A,$46,$61,$69,$6C,$65,$64,$2E,$0A,$00
+
+.segment	"BSS"
+
+_lbits:
+	.res	2,$00
+_ubits:
+	.res	2,$00
+_fbits:
+	.res	2,$00
+_dbits:
+	.res	2,$00
+_flgs:
+	.res	2,$00
+_flgm:
+	.res	2,$00
+_flgd:
+	.res	2,$00
+_flgl:
+	.res	2,$00
+_rrc:
+	.res	2,$00
+_crc:
+	.res	2,$00
+_rfs:
+	.res	8,$00
+
+; ---------------------------------------------------------------
+; int __near__ s26 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s26: near
+
+	.dbg	func, "s26", "00", extern, "_s26"
+	.dbg	sym, "pd0", "00", auto, 0
+	.dbg	sym, "ps", "00", auto, -2
+	.dbg	sym, "pt", "00", auto, -4
+	.dbg	sym, "c0", "00", auto, -5
+	.dbg	sym, "c1", "00", auto, -6
+
+.segment	"CODE"
+
+	.dbg	line, "cq757.c", 66
+	jsr     pushax
+	.dbg	line, "cq757.c", 78
+	jsr     decsp6
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq757.c", 79
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     incaxy
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "cq757.c", 81
+	jmp     L0002
+L0002:	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$00
+	jsr     staspidx
+	tax
+	php
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	jne     L0002
+	.dbg	line, "cq757.c", 86
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "cq757.c", 87
+	ldx     #$00
+	lda     #$00
+	ldy     #$01
+	sta     (sp),y
+	.dbg	line, "cq757.c", 88
+	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	sta     (sp),y
+	.dbg	line, "cq757.c", 90
+	jmp     L0007
+	.dbg	line, "cq757.c", 91
+L0005:	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	jsr     aslax1
+	ldx     #$00
+	ldy     #$00
+	sta     (sp),y
+	.dbg	line, "cq757.c", 92
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	ina
+	bne     L0008
+	inx
+L0008:	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "cq757.c", 90
+L0007:	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosneax
+	jne     L0005
+	.dbg	line, "cq757.c", 96
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     shlax1
+	ldy     #$02
+	jsr     staxspidx
+	.dbg	line, "cq757.c", 97
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     shlax1
+	ldy     #$04
+	jsr     staxspidx
+	.dbg	line, "cq757.c", 98
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     shlax2
+	ldy     #$06
+	jsr     staxspidx
+	.dbg	line, "cq757.c", 99
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     shlax1
+	ldy     #$08
+	jsr     staxspidx
+	.dbg	line, "cq757.c", 162
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "cq757.c", 163
+L0001:	jsr     incsp8
+	rts
+
+	.dbg	line
+.segment	"DATA"
+
+M0001:
+	.byte	$73,$32,$36,$20,$20,$20,$20,$00
+M0002:
+	.byte	$25,$33,$64,$20,$62,$69,$74,$73,$20,$69,$6E,$20,$25,$73,$73,$2E
+	.byte	$0A,$00
+M0003:
+	.byte	$25,$65,$20,$69,$73,$20,$74,$68,$65,$20,$6C,$65,$61,$73,$74,$20
+	.byte	$6E,$75,$6D,$62,$65,$72,$20,$74,$68,$61,$74,$20,$63,$61,$6E,$20
+	.byte	$62,$65,$20,$61,$64,$64,$65,$64,$20,$74,$6F,$20,$31,$2E,$20,$28
+	.byte	$25,$73,$29,$2E,$0A,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ s757 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s757: near
+
+	.dbg	func, "s757", "00", extern, "_s757"
+	.dbg	sym, "pd0", "00", auto, 0
+	.dbg	sym, "rc", "00", auto, -2
+	.dbg	sym, "ps", "00", auto, -4
+	.dbg	sym, "pt", "00", auto, -6
+	.dbg	sym, "t", "00", auto, -8
+	.dbg	sym, "lrc", "00", auto, -10
+	.dbg	sym, "k", "00", auto, -12
+	.dbg	sym, "j", "00", auto, -14
+	.dbg	sym, "a", "00", auto, -16
+	.dbg	sym, "b", "00", auto, -18
+	.dbg	sym, "c", "00", auto, -20
+	.dbg	sym, "d", "00", auto, -22
+	.dbg	sym, "x", "00", auto, -54
+	.dbg	sym, "p", "00", auto, -56
+	.dbg	sym, "rs", "00", auto, -58
+	.dbg	sym, "ls", "00", auto, -60
+	.dbg	sym, "rt", "00", auto, -62
+	.dbg	sym, "lt", "00", auto, -64
+
+.segment	"CODE"
+
+	.dbg	line, "cq757.c", 172
+	jsr     pushax
+	.dbg	line, "cq757.c", 180
+	ldy     #$40
+	jsr     subysp
+	lda     #<(M0002)
+	ldx     #>(M0002)
+	ldy     #$3C
+	jsr     staxysp
+	.dbg	line, "cq757.c", 181
+	ldy     #$41
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     incaxy
+	ldy     #$3A
+	jsr     staxysp
+	.dbg	line, "cq757.c", 182
+	ldx     #$00
+	lda     #$00
+	ldy     #$3E
+	jsr     staxysp
+	.dbg	line, "cq757.c", 183
+	jmp     L0002
+L0002:	ldy     #$3B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$3F
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$00
+	jsr     staspidx
+	tax
+	php
+	ldy     #$3A
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$3C
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	jne     L0002
+	.dbg	line, "cq757.c", 188
+	ldx     #$00
+	lda     #$28
+	ldy     #$38
+	jsr     staxysp
+	.dbg	line, "cq757.c", 189
+	ldy     #$39
+	jsr     ldaxysp
+	jsr     aslax3
+	jsr     aslax2
+	cpx     #$05
+	bne     L0006
+	cmp     #$00
+L0006:	jsr     boolne
+	jne     L0007
+	ldy     #$39
+	jsr     ldaxysp
+	jsr     asrax3
+	jsr     asrax2
+	cpx     #$00
+	bne     L0008
+	cmp     #$01
+L0008:	jsr     boolne
+	jne     L0007
+	ldx     #$00
+	lda     #$00
+	jeq     L0009
+L0007:	ldx     #$00
+	lda     #$01
+L0009:	jeq     L000B
+	.dbg	line, "cq757.c", 190
+	ldy     #$3F
+	jsr     ldaxysp
+	ina
+	bne     L000A
+	inx
+L000A:	ldy     #$3E
+	jsr     staxysp
+	.dbg	line, "cq757.c", 191
+	ldy     #$41
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L000C
+	cmp     #$00
+L000C:	jsr     boolne
+	jeq     L000B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq757.c", 200
+L000B:	ldx     #$00
+	lda     #$00
+	ldy     #$36
+	jsr     staxysp
+	.dbg	line, "cq757.c", 201
+	ldx     #$00
+	lda     #$00
+	ldy     #$34
+	jsr     staxysp
+	jmp     L000D
+	.dbg	line, "cq757.c", 202
+L0010:	ldx     #$00
+	lda     #$01
+	ldy     #$06
+	jsr     staxysp
+	.dbg	line, "cq757.c", 203
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$43
+	jsr     ldaxysp
+	ldy     #$09
+	jsr     ldaxidx
+	jsr     decax1
+	jsr     tosshlax
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq757.c", 205
+	ldx     #$00
+	lda     #$00
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "cq757.c", 206
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     complax
+	jsr     pushax
+	ldy     #$37
+	jsr     ldaxysp
+	jsr     tosshrax
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "cq757.c", 207
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     complax
+	jsr     pushax
+	ldy     #$37
+	jsr     ldaxysp
+	jsr     tosshlax
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "cq757.c", 209
+	ldx     #$00
+	lda     #$00
+	ldy     #$32
+	jsr     staxysp
+	jmp     L0011
+	.dbg	line, "cq757.c", 210
+L0014:	ldy     #$33
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$37
+	jsr     ldaxysp
+	jsr     tosltax
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosandax
+	cpx     #$00
+	bne     L0016
+	cmp     #$00
+L0016:	jsr     booleq
+	jsr     tosneax
+	jne     L0017
+	ldy     #$33
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$37
+	jsr     ldaxysp
+	jsr     tosltax
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosandax
+	cpx     #$00
+	bne     L0018
+	cmp     #$00
+L0018:	jsr     booleq
+	jsr     tosneax
+	jne     L0017
+	ldx     #$00
+	lda     #$00
+	jeq     L0019
+L0017:	ldx     #$00
+	lda     #$01
+L0019:	jeq     L0015
+	ldx     #$00
+	lda     #$01
+	ldy     #$36
+	jsr     staxysp
+	.dbg	line, "cq757.c", 211
+L0015:	ldy     #$07
+	jsr     ldaxysp
+	jsr     shlax1
+	ldy     #$06
+	jsr     staxysp
+	.dbg	line, "cq757.c", 212
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     shrax1
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq757.c", 209
+	ldy     #$33
+	jsr     ldaxysp
+	ldy     #$32
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0011
+L0011:	ldy     #$33
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$43
+	jsr     ldaxysp
+	ldy     #$09
+	jsr     ldaxidx
+	jsr     tosltax
+	jne     L0014
+	.dbg	line, "cq757.c", 201
+	ldy     #$35
+	jsr     ldaxysp
+	ldy     #$34
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L000D
+L000D:	ldy     #$35
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$43
+	jsr     ldaxysp
+	ldy     #$09
+	jsr     ldaxidx
+	jsr     tosltax
+	jne     L0010
+	.dbg	line, "cq757.c", 216
+	ldy     #$37
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L001B
+	cmp     #$00
+L001B:	jsr     boolne
+	jeq     L001C
+	.dbg	line, "cq757.c", 217
+	ldy     #$3F
+	jsr     ldaxysp
+	jsr     incax2
+	ldy     #$3E
+	jsr     staxysp
+	.dbg	line, "cq757.c", 218
+	ldy     #$41
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L001D
+	cmp     #$00
+L001D:	jsr     boolne
+	jeq     L001C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq757.c", 226
+L001C:	ldx     #$00
+	lda     #$03
+	ldy     #$30
+	jsr     staxysp
+	.dbg	line, "cq757.c", 227
+	ldx     #$00
+	lda     #$02
+	ldy     #$2E
+	jsr     staxysp
+	.dbg	line, "cq757.c", 228
+	ldx     #$00
+	lda     #$01
+	ldy     #$2C
+	jsr     staxysp
+	.dbg	line, "cq757.c", 230
+	ldy     #$31
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$31
+	jsr     ldaxysp
+	jsr     tosltax
+	jsr     pushax
+	ldy     #$2F
+	jsr     ldaxysp
+	jsr     tosltax
+	cpx     #$00
+	bne     L001F
+	cmp     #$01
+L001F:	jsr     boolne
+	jeq     L001E
+	.dbg	line, "cq757.c", 231
+	ldy     #$3F
+	jsr     ldaxysp
+	jsr     incax4
+	ldy     #$3E
+	jsr     staxysp
+	.dbg	line, "cq757.c", 232
+	ldy     #$41
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0021
+	cmp     #$00
+L0021:	jsr     boolne
+	jeq     L001E
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$04
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq757.c", 241
+L001E:	lda     #$0C
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$0C
+	jsr     leaa0sp
+	jsr     toseqax
+	jeq     L0022
+	.dbg	line, "cq757.c", 242
+	ldy     #$3F
+	jsr     ldaxysp
+	jsr     incax8
+	ldy     #$3E
+	jsr     staxysp
+	.dbg	line, "cq757.c", 243
+	ldy     #$41
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0024
+	cmp     #$00
+L0024:	jsr     boolne
+	jeq     L0022
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$08
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq757.c", 246
+L0022:	lda     #$0C
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$0C
+	jsr     leaa0sp
+	jsr     tosultax
+	jeq     L0026
+	ldy     #$41
+	jsr     ldaxysp
+	ldy     #$11
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0027
+	cmp     #$00
+L0027:	jsr     boolne
+	jeq     L0026
+	.dbg	line, "cq757.c", 247
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cq757.c", 252
+L0026:	ldx     #$00
+	lda     #$00
+	ldy     #$36
+	jsr     staxysp
+	.dbg	line, "cq757.c", 254
+	ldx     #$00
+	lda     #$00
+	ldy     #$32
+	jsr     staxysp
+	jmp     L0028
+L002B:	ldy     #$33
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #$0A
+	bcc     L002D
+	inx
+	clc
+L002D:	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$33
+	jsr     ldaxysp
+	ldy     #$32
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0028
+L0028:	ldy     #$33
+	jsr     ldaxysp
+	cmp     #$10
+	txa
+	sbc     #$00
+	bvc     L002C
+	eor     #$80
+L002C:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L002B
+	.dbg	line, "cq757.c", 255
+	ldx     #$00
+	lda     #$00
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq757.c", 256
+	ldx     #$00
+	lda     #$00
+	ldy     #$12
+	jsr     staxysp
+	.dbg	line, "cq757.c", 257
+	ldx     #$00
+	lda     #$00
+	ldy     #$16
+	jsr     staxysp
+	.dbg	line, "cq757.c", 258
+	ldx     #$00
+	lda     #$00
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq757.c", 259
+	ldx     #$00
+	lda     #$00
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq757.c", 260
+	ldx     #$00
+	lda     #$00
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq757.c", 262
+	ldx     #$00
+	lda     #$00
+	ldy     #$30
+	jsr     staxysp
+	jmp     L002E
+	.dbg	line, "cq757.c", 263
+L0031:	ldx     #$00
+	lda     #$00
+	ldy     #$2E
+	jsr     staxysp
+	jmp     L0033
+	.dbg	line, "cq757.c", 264
+L0036:	ldx     #$00
+	lda     #$00
+	ldy     #$2C
+	jsr     staxysp
+	jmp     L0038
+	.dbg	line, "cq757.c", 265
+L003B:	ldx     #$00
+	lda     #$00
+	ldy     #$2A
+	jsr     staxysp
+	jmp     L003D
+	.dbg	line, "cq757.c", 266
+L0040:	ldy     #$31
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$31
+	jsr     ldaxysp
+	jsr     tosltax
+	jsr     pushax
+	ldy     #$2F
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$2F
+	jsr     ldaxysp
+	jsr     tosltax
+	jsr     toseqax
+	jsr     pushax
+	ldy     #$33
+	jsr     ldaxysp
+	jsr     aslax3
+	jsr     pushax
+	ldy     #$33
+	jsr     ldaxysp
+	jsr     aslax2
+	jsr     tosaddax
+	jsr     pushax
+	ldy     #$31
+	jsr     ldaxysp
+	jsr     aslax1
+	jsr     tosaddax
+	jsr     pushax
+	ldy     #$2F
+	jsr     ldaxysp
+	jsr     tosaddax
+	jsr     aslax1
+	clc
+	adc     #$0C
+	bcc     L0043
+	inx
+	clc
+L0043:	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     tosneax
+	jeq     L0042
+	ldx     #$00
+	lda     #$01
+	ldy     #$36
+	jsr     staxysp
+	.dbg	line, "cq757.c", 265
+L0042:	ldy     #$2B
+	jsr     ldaxysp
+	ldy     #$2A
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L003D
+L003D:	ldy     #$2B
+	jsr     ldaxysp
+	cmp     #$02
+	txa
+	sbc     #$00
+	bvc     L0041
+	eor     #$80
+L0041:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0040
+	.dbg	line, "cq757.c", 264
+	ldy     #$2D
+	jsr     ldaxysp
+	ldy     #$2C
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0038
+L0038:	ldy     #$2D
+	jsr     ldaxysp
+	cmp     #$02
+	txa
+	sbc     #$00
+	bvc     L003C
+	eor     #$80
+L003C:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L003B
+	.dbg	line, "cq757.c", 263
+	ldy     #$2F
+	jsr     ldaxysp
+	ldy     #$2E
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0033
+L0033:	ldy     #$2F
+	jsr     ldaxysp
+	cmp     #$02
+	txa
+	sbc     #$00
+	bvc     L0037
+	eor     #$80
+L0037:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0036
+	.dbg	line, "cq757.c", 262
+	ldy     #$31
+	jsr     ldaxysp
+	ldy     #$30
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L002E
+L002E:	ldy     #$31
+	jsr     ldaxysp
+	cmp     #$02
+	txa
+	sbc     #$00
+	bvc     L0032
+	eor     #$80
+L0032:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0031
+	.dbg	line, "cq757.c", 268
+	ldy     #$37
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0045
+	cmp     #$00
+L0045:	jsr     boolne
+	jeq     L0046
+	.dbg	line, "cq757.c", 269
+	ldy     #$3F
+	jsr     ldaxysp
+	ldy     #$10
+	jsr     incaxy
+	ldy     #$3E
+	jsr     staxysp
+	.dbg	line, "cq757.c", 270
+	ldy     #$41
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0047
+	cmp     #$00
+L0047:	jsr     boolne
+	jeq     L0046
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$10
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq757.c", 277
+L0046:	ldx     #$00
+	lda     #$00
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "cq757.c", 279
+	ldy     #$09
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0049
+	cmp     #$00
+L0049:	jsr     boolne
+	jeq     L004A
+	.dbg	line, "cq757.c", 280
+	ldy     #$3F
+	jsr     ldaxysp
+	ldy     #$20
+	jsr     incaxy
+	ldy     #$3E
+	jsr     staxysp
+	.dbg	line, "cq757.c", 281
+	ldy     #$41
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L004B
+	cmp     #$00
+L004B:	jsr     boolne
+	jeq     L004A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$20
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq757.c", 284
+L004A:	ldy     #$3F
+	jsr     ldaxysp
+	jmp     L0001
+	.dbg	line, "cq757.c", 285
+L0001:	ldy     #$42
+	jsr     addysp
+	rts
+
+	.dbg	line
+.segment	"DATA"
+
+M0001:
+	.byte	$73,$37,$35,$37,$2C,$65,$72,$25,$64,$0A,$00
+M0002:
+	.byte	$73,$37,$35,$37,$20,$20,$20,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ section (int j, void *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_section: near
+
+	.dbg	func, "section", "00", extern, "_section"
+	.dbg	sym, "j", "00", auto, 2
+	.dbg	sym, "pd0", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "cq757.c", 294
+	jsr     pushax
+	.dbg	line, "cq757.c", 296
+	ldy     #$03
+	jsr     ldaxysp
+	jmp     L0002
+	.dbg	line, "cq757.c", 299
+L0002:	cpx     #$00
+	jne     L0006
+	cmp     #$00
+	jeq     L0004
+	cmp     #$01
+	jeq     L0005
+	jmp     L0003
+L0006:	jmp     L0003
+	.dbg	line, "cq757.c", 297
+L0004:	ldy     #$01
+	jsr     ldaxysp
+	jsr     _s26
+	jmp     L0003
+	.dbg	line, "cq757.c", 298
+L0005:	ldy     #$01
+	jsr     ldaxysp
+	jsr     _s757
+	jmp     L0003
+	.dbg	line, "cq757.c", 300
+L0003:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+	.dbg	sym, "n", "00", auto, 2
+	.dbg	sym, "args", "00", auto, 0
+	.dbg	sym, "j", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "cq757.c", 320
+	jsr     decsp2
+	ldx     #$00
+	lda     #$01
+	sta     M0001+14
+	stx     M0001+14+1
+	.dbg	line, "cq757.c", 321
+	ldx     #$00
+	lda     #$01
+	sta     M0001+16
+	stx     M0001+16+1
+	.dbg	line, "cq757.c", 322
+	ldx     #$00
+	lda     #$01
+	sta     M0001+18
+	stx     M0001+18+1
+	.dbg	line, "cq757.c", 323
+	ldx     #$00
+	lda     #$01
+	sta     M0001+20
+	stx     M0001+20+1
+	.dbg	line, "cq757.c", 325
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	sta     M0002
+	stx     M0002+1
+	.dbg	line, "cq757.c", 327
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+	jmp     L0002
+	.dbg	line, "cq757.c", 328
+L0005:	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	lda     M0002
+	ldx     M0002+1
+	jsr     _section
+	sta     M0001+22
+	stx     M0001+22+1
+	.dbg	line, "cq757.c", 329
+	lda     M0001+24
+	ldx     M0001+24+1
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     tosaddax
+	sta     M0001+24
+	stx     M0001+24+1
+	.dbg	line, "cq757.c", 330
+	lda     M0001+14
+	ldx     M0001+14+1
+	cpx     #$00
+	bne     L0008
+	cmp     #$00
+L0008:	jsr     boolne
+	jeq     L0007
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	lda     #<(M0001+26)
+	ldx     #>(M0001+26)
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "cq757.c", 327
+L0007:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	cmp     #$02
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0005
+	.dbg	line, "cq757.c", 333
+	lda     M0001+24
+	ldx     M0001+24+1
+	cpx     #$00
+	bne     L000A
+	cmp     #$00
+L000A:	jsr     booleq
+	jeq     L0009
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cq757.c", 334
+	jmp     L000B
+L0009:	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cq757.c", 336
+L000B:	lda     M0001+24
+	ldx     M0001+24+1
+	jmp     L0001
+	.dbg	line, "cq757.c", 337
+L0001:	jsr     incsp6
+	rts
+
+	.dbg	line
+.segment	"BSS"
+
+M0001:
+	.res	34,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
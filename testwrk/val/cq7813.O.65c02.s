@@ -0,0 +1,1173 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_printf
+	.export		_lbits
+	.export		_ubits
+	.export		_fbits
+	.export		_dbits
+	.export		_flgs
+	.export		_flgm
+	.export		_flgd
+	.export		_flgl
+	.export		_rrc
+	.export		_crc
+	.export		_rfs
+	.export		_s7813
+	.export		_section
+	.export		_main
+
+.segment	"RODATA"
+
+S0004:
+	.byte	$53,$65,$63,$74,$69,$6F,$6E,$20,$25,$73,$20,$72,$65,$74,$75,$72
+	.byte	$6E,$65,$64,$20,$25,$64,$2E,$0A,$00
+S0005:
+	.byte	$0A,$4E,$6F,$20,$65,$72,$72,$6F,$72,$73,$20,$64,$65,$74,$65,$63
+	.byte	$74,$65,$64,$2E,$0A,$00
+S0006:
+	.byte	$0A,$46,$61,$69,$6C,$65,$64,$2E,$0A,$00
+
+.segment	"BSS"
+
+_lbits:
+	.res	2,$00
+_ubits:
+	.res	2,$00
+_fbits:
+	.res	2,$00
+_dbits:
+	.res	2,$00
+_flgs:
+	.res	2,$00
+_flgm:
+	.res	2,$00
+_flgd:
+	.res	2,$00
+_flgl:
+	.res	2,$00
+_rrc:
+	.res	2,$00
+_crc:
+	.res	2,$00
+_rfs:
+	.res	8,$00
+
+; ---------------------------------------------------------------
+; int __near__ s7813 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s7813: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$14
+	jsr     subysp
+	lda     #<(M0003)
+	ldx     #>(M0003)
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$15
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     incaxy
+	jsr     stax0sp
+	ldx     #$00
+	txa
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$15
+	jsr     ldaxysp
+	ldy     #$15
+	jsr     ldaxidx
+	ldy     #$12
+	jsr     staxysp
+L0002:	jsr     ldax0sp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$03
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1)
+	sta     (sreg)
+	tax
+	php
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	bne     L0002
+	ldy     #$10
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L009B
+	ldy     #$15
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L011C
+	cmp     #$00
+	beq     L009D
+L011C:	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L009D:	ldy     #$05
+	jsr     ldaxysp
+	ina
+	bne     L009F
+	inx
+L009F:	ldy     #$04
+	jsr     staxysp
+L009B:	ldx     #$00
+	txa
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$0E
+	jsr     staxysp
+	txa
+	php
+	ldy     #$0E
+	ina
+	jsr     addeqysp
+	plp
+	beq     L00A0
+	ldy     #$0D
+	jsr     ldaxysp
+	stx     tmp1
+	ora     tmp1
+	php
+	ldy     #$0C
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	bne     L00A1
+L00A0:	ldx     #$00
+	txa
+	bra     L00A2
+L00A1:	ldx     #$00
+	lda     #$01
+L00A2:	ldy     #$0A
+	jsr     staxysp
+	ldy     #$0F
+	lda     (sp),y
+	bne     L011D
+	dey
+	lda     (sp),y
+	cmp     #$01
+	beq     L00A5
+L011D:	lda     #$01
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00A5
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00A5:	ldy     #$0C
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L00A8
+	ldx     #$00
+	lda     #$02
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00A8
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00A8:	ldy     #$0A
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L00AB
+	ldx     #$00
+	lda     #$03
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00AB
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00AB:	ldy     #$0F
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00AC
+	dey
+	jsr     ldaxysp
+	stx     tmp1
+	ora     tmp1
+	php
+	ldy     #$0C
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	bne     L00AD
+L00AC:	ldx     #$00
+	txa
+	bra     L00AE
+L00AD:	ldx     #$00
+	lda     #$01
+L00AE:	ldy     #$0A
+	jsr     staxysp
+	ldy     #$0F
+	lda     (sp),y
+	bne     L011E
+	dey
+	lda     (sp),y
+	cmp     #$01
+	beq     L00B1
+L011E:	lda     #$04
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00B1
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00B1:	ldy     #$0D
+	lda     (sp),y
+	bne     L011F
+	dey
+	lda     (sp),y
+	cmp     #$01
+	beq     L00B4
+L011F:	ldx     #$00
+	lda     #$05
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00B4
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00B4:	ldy     #$0A
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L00B7
+	ldx     #$00
+	lda     #$06
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00B7
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00B7:	ldy     #$0F
+	jsr     ldaxysp
+	stx     tmp1
+	ora     tmp1
+	php
+	ldx     #$00
+	lda     #$01
+	ldy     #$0E
+	jsr     subeqysp
+	plp
+	beq     L00B8
+	ldy     #$0D
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	bne     L00B9
+L00B8:	ldx     #$00
+	txa
+	bra     L00BA
+L00B9:	ldx     #$00
+	lda     #$01
+L00BA:	ldy     #$0A
+	jsr     staxysp
+	ldy     #$0E
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L00BD
+	lda     #$07
+	iny
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00BD
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00BD:	ldy     #$0D
+	lda     (sp),y
+	bne     L0120
+	dey
+	lda     (sp),y
+	cmp     #$01
+	beq     L00C0
+L0120:	ldx     #$00
+	lda     #$08
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00C0
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00C0:	ldy     #$0B
+	lda     (sp),y
+	bne     L0121
+	dey
+	lda     (sp),y
+	cmp     #$01
+	beq     L00C3
+L0121:	ldx     #$00
+	lda     #$09
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00C3
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00C3:	ldy     #$0F
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00C4
+	dey
+	jsr     ldaxysp
+	stx     tmp1
+	ora     tmp1
+	php
+	ldx     #$00
+	lda     #$01
+	ldy     #$0C
+	jsr     subeqysp
+	plp
+	bne     L00C5
+L00C4:	ldx     #$00
+	txa
+	bra     L00C6
+L00C5:	ldx     #$00
+	lda     #$01
+L00C6:	ldy     #$0A
+	jsr     staxysp
+	ldy     #$0E
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L00C9
+	lda     #$0A
+	iny
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00C9
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00C9:	ldy     #$0D
+	lda     (sp),y
+	bne     L0122
+	dey
+	lda     (sp),y
+	cmp     #$01
+	beq     L00CC
+L0122:	ldx     #$00
+	lda     #$0B
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00CC
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00CC:	ldy     #$0A
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L00CF
+	ldx     #$00
+	lda     #$0C
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00CF
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00CF:	ldy     #$10
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L00D0
+	ldy     #$15
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0123
+	cmp     #$00
+	beq     L00D2
+L0123:	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	lda     #$02
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L00D2:	ldy     #$05
+	jsr     ldaxysp
+	jsr     incax2
+	ldy     #$04
+	jsr     staxysp
+L00D0:	ldx     #$00
+	txa
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$0E
+	jsr     staxysp
+	txa
+	php
+	ldy     #$0E
+	ina
+	jsr     addeqysp
+	plp
+	bne     L00D4
+	ldy     #$0D
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	bne     L00D4
+	tax
+	bra     L00D5
+L00D4:	ldx     #$00
+	lda     #$01
+L00D5:	ldy     #$0A
+	jsr     staxysp
+	ldy     #$0F
+	lda     (sp),y
+	bne     L0124
+	dey
+	lda     (sp),y
+	cmp     #$01
+	beq     L00D8
+L0124:	lda     #$01
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00D8
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00D8:	ldy     #$0C
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L00DB
+	ldx     #$00
+	lda     #$02
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00DB
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00DB:	ldy     #$0A
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L00DE
+	ldx     #$00
+	lda     #$03
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00DE
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00DE:	ldy     #$0D
+	jsr     ldaxysp
+	stx     tmp1
+	ora     tmp1
+	php
+	ldy     #$0C
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	bne     L00DF
+	ldy     #$0F
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	bne     L00DF
+	tax
+	bra     L00E0
+L00DF:	ldx     #$00
+	lda     #$01
+L00E0:	ldy     #$0A
+	jsr     staxysp
+	ldy     #$0F
+	lda     (sp),y
+	bne     L0125
+	dey
+	lda     (sp),y
+	cmp     #$01
+	beq     L00E3
+L0125:	lda     #$04
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00E3
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00E3:	ldy     #$0D
+	lda     (sp),y
+	bne     L0126
+	dey
+	lda     (sp),y
+	cmp     #$01
+	beq     L00E6
+L0126:	ldx     #$00
+	lda     #$05
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00E6
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00E6:	ldy     #$0B
+	lda     (sp),y
+	bne     L0127
+	dey
+	lda     (sp),y
+	cmp     #$01
+	beq     L00E9
+L0127:	ldx     #$00
+	lda     #$06
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00E9
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00E9:	ldy     #$0F
+	jsr     ldaxysp
+	stx     tmp1
+	ora     tmp1
+	php
+	ldx     #$00
+	lda     #$01
+	ldy     #$0E
+	jsr     subeqysp
+	plp
+	bne     L00EA
+	ldy     #$0D
+	jsr     ldaxysp
+	stx     tmp1
+	ora     tmp1
+	php
+	ldx     #$00
+	lda     #$01
+	ldy     #$0C
+	jsr     subeqysp
+	plp
+	bne     L00EA
+	ldx     #$00
+	txa
+	bra     L00EB
+L00EA:	ldx     #$00
+	lda     #$01
+L00EB:	ldy     #$0A
+	jsr     staxysp
+	ldy     #$0E
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L00EE
+	lda     #$07
+	iny
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00EE
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00EE:	ldy     #$0D
+	lda     (sp),y
+	bne     L0128
+	dey
+	lda     (sp),y
+	cmp     #$01
+	beq     L00F1
+L0128:	ldx     #$00
+	lda     #$08
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00F1
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00F1:	ldy     #$0B
+	lda     (sp),y
+	bne     L0129
+	dey
+	lda     (sp),y
+	cmp     #$01
+	beq     L00F4
+L0129:	ldx     #$00
+	lda     #$09
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00F4
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00F4:	ldy     #$0F
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	bne     L00F5
+	dey
+	jsr     ldaxysp
+	stx     tmp1
+	ora     tmp1
+	php
+	ldx     #$00
+	lda     #$01
+	ldy     #$0C
+	jsr     subeqysp
+	plp
+	bne     L00F5
+	ldx     #$00
+	txa
+	bra     L00F6
+L00F5:	ldx     #$00
+	lda     #$01
+L00F6:	ldy     #$0A
+	jsr     staxysp
+	ldy     #$0E
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L00F9
+	lda     #$0A
+	iny
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00F9
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00F9:	ldy     #$0C
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L00FC
+	ldx     #$00
+	lda     #$0B
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00FC
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00FC:	ldy     #$0B
+	lda     (sp),y
+	bne     L012A
+	dey
+	lda     (sp),y
+	cmp     #$01
+	beq     L00FF
+L012A:	ldx     #$00
+	lda     #$0C
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00FF
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00FF:	ldy     #$10
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L0100
+	ldy     #$15
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L012B
+	cmp     #$00
+	beq     L0102
+L012B:	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	tay
+	jsr     _printf
+L0102:	ldy     #$05
+	jsr     ldaxysp
+	jsr     incax4
+	ldy     #$04
+	jsr     staxysp
+L0100:	ldx     #$00
+	txa
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$0E
+	jsr     staxysp
+	ldy     #$08
+	jsr     staxysp
+	ina
+	ldy     #$06
+	jsr     staxysp
+	ldy     #$07
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0104
+	ldy     #$09
+	jsr     ldaxysp
+	bra     L0107
+L0104:	iny
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0106
+	ldy     #$0F
+	jsr     ldaxysp
+	sta     regsave
+	stx     regsave+1
+	ldy     #$0E
+	bra     L0131
+L0106:	ldy     #$0D
+	jsr     ldaxysp
+	sta     regsave
+	stx     regsave+1
+	ldy     #$0C
+L0131:	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	lda     regsave
+	ldx     regsave+1
+L0107:	ldy     #$0A
+	jsr     staxysp
+	cpx     #$00
+	bne     L010A
+	cmp     #$00
+	bne     L010A
+	ldy     #$0E
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	bne     L010A
+	ldy     #$0C
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L0108
+L010A:	ldy     #$15
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L012C
+	cmp     #$00
+	beq     L010E
+L012C:	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	lda     #$08
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L010E:	ldy     #$05
+	jsr     ldaxysp
+	jsr     incax8
+	ldy     #$04
+	jsr     staxysp
+L0108:	ldy     #$07
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0111
+	ldy     #$09
+	jsr     ldaxysp
+	bra     L0112
+L0111:	tax
+	ina
+L0112:	cpx     #$00
+	bne     L0114
+	cmp     #$00
+	bne     L0114
+	ldy     #$09
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0115
+	lda     #$01
+	bra     L0116
+L0115:	iny
+	jsr     ldaxysp
+L0116:	cpx     #$00
+	bne     L0114
+	cmp     #$00
+	beq     L0110
+L0114:	ldy     #$15
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L012D
+	cmp     #$00
+	beq     L0119
+L012D:	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	lda     #$10
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L0119:	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$10
+	jsr     incaxy
+	ldy     #$04
+	jsr     staxysp
+L0110:	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$16
+	jmp     addysp
+
+.segment	"DATA"
+
+M0001:
+	.byte	$4C,$6F,$63,$61,$6C,$20,$65,$72,$72,$6F,$72,$20,$25,$64,$2E,$0A
+	.byte	$00
+M0002:
+	.byte	$73,$37,$38,$31,$33,$2C,$65,$72,$25,$64,$0A,$00
+M0003:
+	.byte	$73,$37,$38,$31,$33,$20,$20,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ section (int j, void *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_section: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$02
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	bne     L0003
+	jsr     ldax0sp
+	jsr     _s7813
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	ldx     #$00
+	lda     #$01
+	sta     M0001+14
+	stz     M0001+14+1
+	sta     M0001+16
+	stz     M0001+16+1
+	sta     M0001+18
+	stz     M0001+18+1
+	sta     M0001+20
+	stz     M0001+20+1
+	lda     #>(M0001)
+	sta     M0002+1
+	lda     #<(M0001)
+	sta     M0002
+	txa
+	jsr     stax0sp
+	bra     L0002
+L0005:	jsr     pushw0sp
+	lda     M0002
+	ldx     M0002+1
+	jsr     _section
+	sta     M0001+22
+	stx     M0001+22+1
+	lda     M0001+24
+	clc
+	adc     M0001+22
+	sta     M0001+24
+	lda     M0001+24+1
+	adc     M0001+22+1
+	sta     M0001+24+1
+	lda     M0001+14
+	ora     M0001+14+1
+	beq     L0007
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     #<(M0001+26)
+	ldx     #>(M0001+26)
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+L0007:	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+L0002:	jsr     ldax0sp
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	bmi     L0005
+	lda     M0001+24
+	ora     M0001+24+1
+	bne     L0009
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	bra     L000E
+L0009:	lda     #<(S0006)
+	ldx     #>(S0006)
+L000E:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     M0001+24
+	ldx     M0001+24+1
+	jmp     incsp6
+
+.segment	"BSS"
+
+M0001:
+	.res	34,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
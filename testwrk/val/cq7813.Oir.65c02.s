@@ -0,0 +1,1246 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_printf
+	.export		_lbits
+	.export		_ubits
+	.export		_fbits
+	.export		_dbits
+	.export		_flgs
+	.export		_flgm
+	.export		_flgd
+	.export		_flgl
+	.export		_rrc
+	.export		_crc
+	.export		_rfs
+	.export		_s7813
+	.export		_section
+	.export		_main
+
+.segment	"RODATA"
+
+S0004:
+	.byte	$53,$65,$63,$74,$69,$6F,$6E,$20,$25,$73,$20,$72,$65,$74,$75,$72
+	.byte	$6E,$65,$64,$20,$25,$64,$2E,$0A,$00
+S0005:
+	.byte	$0A,$4E,$6F,$20,$65,$72,$72,$6F,$72,$73,$20,$64,$65,$74,$65,$63
+	.byte	$74,$65,$64,$2E,$0A,$00
+S0006:
+	.byte	$0A,$46,$61,$69,$6C,$65,$64,$2E,$0A,$00
+
+.segment	"BSS"
+
+_lbits:
+	.res	2,$00
+_ubits:
+	.res	2,$00
+_fbits:
+	.res	2,$00
+_dbits:
+	.res	2,$00
+_flgs:
+	.res	2,$00
+_flgm:
+	.res	2,$00
+_flgd:
+	.res	2,$00
+_flgl:
+	.res	2,$00
+_rrc:
+	.res	2,$00
+_crc:
+	.res	2,$00
+_rfs:
+	.res	8,$00
+
+; ---------------------------------------------------------------
+; int __near__ s7813 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s7813: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+3
+	jsr     pushax
+	ldy     #$10
+	jsr     subysp
+	lda     #<(M0003)
+	ldx     #>(M0003)
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$15
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$1A
+	bcc     L0002
+	inx
+L0002:	jsr     stax0sp
+	lda     #$00
+	stz     regbank+2
+	stz     regbank+2+1
+	ldy     #$04
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$15
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	iny
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	sta     regbank+4
+	stx     regbank+4+1
+L0003:	ldy     #$01
+	lda     (sp),y
+	sta     sreg+1
+	lda     (sp)
+	sta     sreg
+	ldy     #$03
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	lda     (ptr1)
+	sta     (sreg)
+	tax
+	php
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	bne     L0003
+	lda     regbank+2
+	ora     regbank+2+1
+	beq     L009C
+	ldy     #$15
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	dey
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     #$00
+	bne     L0122
+	cmp     #$00
+	beq     L009E
+L0122:	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L009E:	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ina
+	bne     L00A0
+	inx
+L00A0:	jsr     staxysp
+L009C:	ldx     #$00
+	txa
+	stz     regbank+2
+	stz     regbank+2+1
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$0E
+	jsr     staxysp
+	txa
+	php
+	ldy     #$0E
+	ina
+	jsr     addeqysp
+	plp
+	beq     L00A1
+	ldy     #$0D
+	lda     (sp),y
+	sta     tmp1
+	dey
+	lda     (sp),y
+	ora     tmp1
+	php
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	bne     L00A2
+L00A1:	ldx     #$00
+	txa
+	bra     L00A3
+L00A2:	ldx     #$00
+	lda     #$01
+L00A3:	ldy     #$0A
+	jsr     staxysp
+	ldy     #$0F
+	lda     (sp),y
+	bne     L0123
+	dey
+	lda     (sp),y
+	cmp     #$01
+	beq     L00A6
+L0123:	lda     #$01
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L00A6
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00A6:	ldy     #$0C
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L00A9
+	lda     #$02
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L00A9
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00A9:	ldy     #$0A
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L00AC
+	lda     #$03
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L00AC
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00AC:	ldy     #$0F
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00AD
+	dey
+	lda     (sp),y
+	sta     tmp1
+	dey
+	lda     (sp),y
+	ora     tmp1
+	php
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	bne     L00AE
+L00AD:	ldx     #$00
+	txa
+	bra     L00AF
+L00AE:	ldx     #$00
+	lda     #$01
+L00AF:	ldy     #$0A
+	jsr     staxysp
+	ldy     #$0F
+	lda     (sp),y
+	bne     L0124
+	dey
+	lda     (sp),y
+	cmp     #$01
+	beq     L00B2
+L0124:	lda     #$04
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L00B2
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00B2:	ldy     #$0D
+	lda     (sp),y
+	bne     L0125
+	dey
+	lda     (sp),y
+	cmp     #$01
+	beq     L00B5
+L0125:	lda     #$05
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L00B5
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00B5:	ldy     #$0A
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L00B8
+	lda     #$06
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L00B8
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00B8:	ldy     #$0F
+	lda     (sp),y
+	sta     tmp1
+	dey
+	lda     (sp),y
+	ora     tmp1
+	php
+	ldx     #$00
+	lda     #$01
+	jsr     subeqysp
+	plp
+	beq     L00B9
+	ldy     #$0D
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	bne     L00BA
+L00B9:	ldx     #$00
+	txa
+	bra     L00BB
+L00BA:	ldx     #$00
+	lda     #$01
+L00BB:	ldy     #$0A
+	jsr     staxysp
+	ldy     #$0E
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L00BE
+	lda     #$07
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L00BE
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00BE:	ldy     #$0D
+	lda     (sp),y
+	bne     L0126
+	dey
+	lda     (sp),y
+	cmp     #$01
+	beq     L00C1
+L0126:	lda     #$08
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L00C1
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00C1:	ldy     #$0B
+	lda     (sp),y
+	bne     L0127
+	dey
+	lda     (sp),y
+	cmp     #$01
+	beq     L00C4
+L0127:	lda     #$09
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L00C4
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00C4:	ldy     #$0F
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00C5
+	dey
+	lda     (sp),y
+	sta     tmp1
+	dey
+	lda     (sp),y
+	ora     tmp1
+	php
+	ldx     #$00
+	lda     #$01
+	jsr     subeqysp
+	plp
+	bne     L00C6
+L00C5:	ldx     #$00
+	txa
+	bra     L00C7
+L00C6:	ldx     #$00
+	lda     #$01
+L00C7:	ldy     #$0A
+	jsr     staxysp
+	ldy     #$0E
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L00CA
+	lda     #$0A
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L00CA
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00CA:	ldy     #$0D
+	lda     (sp),y
+	bne     L0128
+	dey
+	lda     (sp),y
+	cmp     #$01
+	beq     L00CD
+L0128:	lda     #$0B
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L00CD
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00CD:	ldy     #$0A
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L00D0
+	lda     #$0C
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L00D0
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00D0:	lda     regbank+2
+	ora     regbank+2+1
+	beq     L00D1
+	ldy     #$15
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	dey
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     #$00
+	bne     L0129
+	cmp     #$00
+	beq     L00D3
+L0129:	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	lda     #$02
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L00D3:	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$02
+	bcc     L00D5
+	inx
+L00D5:	jsr     staxysp
+L00D1:	ldx     #$00
+	txa
+	stz     regbank+2
+	stz     regbank+2+1
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$0E
+	jsr     staxysp
+	txa
+	php
+	ldy     #$0E
+	ina
+	jsr     addeqysp
+	plp
+	bne     L00D6
+	ldy     #$0D
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	bne     L00D6
+	tax
+	bra     L00D7
+L00D6:	ldx     #$00
+	lda     #$01
+L00D7:	ldy     #$0A
+	jsr     staxysp
+	ldy     #$0F
+	lda     (sp),y
+	bne     L012A
+	dey
+	lda     (sp),y
+	cmp     #$01
+	beq     L00DA
+L012A:	lda     #$01
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L00DA
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00DA:	ldy     #$0C
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L00DD
+	lda     #$02
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L00DD
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00DD:	ldy     #$0A
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L00E0
+	lda     #$03
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L00E0
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00E0:	ldy     #$0D
+	lda     (sp),y
+	sta     tmp1
+	dey
+	lda     (sp),y
+	ora     tmp1
+	php
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	bne     L00E1
+	ldy     #$0F
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	bne     L00E1
+	tax
+	bra     L00E2
+L00E1:	ldx     #$00
+	lda     #$01
+L00E2:	ldy     #$0A
+	jsr     staxysp
+	ldy     #$0F
+	lda     (sp),y
+	bne     L012B
+	dey
+	lda     (sp),y
+	cmp     #$01
+	beq     L00E5
+L012B:	lda     #$04
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L00E5
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00E5:	ldy     #$0D
+	lda     (sp),y
+	bne     L012C
+	dey
+	lda     (sp),y
+	cmp     #$01
+	beq     L00E8
+L012C:	lda     #$05
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L00E8
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00E8:	ldy     #$0B
+	lda     (sp),y
+	bne     L012D
+	dey
+	lda     (sp),y
+	cmp     #$01
+	beq     L00EB
+L012D:	lda     #$06
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L00EB
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00EB:	ldy     #$0F
+	lda     (sp),y
+	sta     tmp1
+	dey
+	lda     (sp),y
+	ora     tmp1
+	php
+	ldx     #$00
+	lda     #$01
+	jsr     subeqysp
+	plp
+	bne     L00EC
+	ldy     #$0D
+	lda     (sp),y
+	sta     tmp1
+	dey
+	lda     (sp),y
+	ora     tmp1
+	php
+	ldx     #$00
+	lda     #$01
+	jsr     subeqysp
+	plp
+	bne     L00EC
+	ldx     #$00
+	txa
+	bra     L00ED
+L00EC:	ldx     #$00
+	lda     #$01
+L00ED:	ldy     #$0A
+	jsr     staxysp
+	ldy     #$0E
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L00F0
+	lda     #$07
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L00F0
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00F0:	ldy     #$0D
+	lda     (sp),y
+	bne     L012E
+	dey
+	lda     (sp),y
+	cmp     #$01
+	beq     L00F3
+L012E:	lda     #$08
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L00F3
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00F3:	ldy     #$0B
+	lda     (sp),y
+	bne     L012F
+	dey
+	lda     (sp),y
+	cmp     #$01
+	beq     L00F6
+L012F:	lda     #$09
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L00F6
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00F6:	ldy     #$0F
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	bne     L00F7
+	dey
+	lda     (sp),y
+	sta     tmp1
+	dey
+	lda     (sp),y
+	ora     tmp1
+	php
+	ldx     #$00
+	lda     #$01
+	jsr     subeqysp
+	plp
+	bne     L00F7
+	ldx     #$00
+	txa
+	bra     L00F8
+L00F7:	ldx     #$00
+	lda     #$01
+L00F8:	ldy     #$0A
+	jsr     staxysp
+	ldy     #$0E
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L00FB
+	lda     #$0A
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L00FB
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00FB:	ldy     #$0C
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L00FE
+	lda     #$0B
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L00FE
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L00FE:	ldy     #$0B
+	lda     (sp),y
+	bne     L0130
+	dey
+	lda     (sp),y
+	cmp     #$01
+	beq     L0101
+L0130:	lda     #$0C
+	sta     regbank+2
+	stz     regbank+2+1
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L0101
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+L0101:	lda     regbank+2
+	ora     regbank+2+1
+	beq     L0102
+	ldy     #$15
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	dey
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     #$00
+	bne     L0131
+	cmp     #$00
+	beq     L0104
+L0131:	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	tay
+	jsr     _printf
+L0104:	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$04
+	bcc     L0106
+	inx
+L0106:	jsr     staxysp
+L0102:	ldy     #$0C
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$06
+	ina
+	sta     (sp),y
+	dea
+	iny
+	sta     (sp),y
+	dey
+	lda     (sp),y
+	beq     L0107
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	bra     L010A
+L0107:	iny
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0109
+	ldy     #$0F
+	bra     L013C
+L0109:	ldy     #$0D
+L013C:	lda     (sp),y
+	sta     regsave+1
+	dey
+	lda     (sp),y
+	sta     regsave
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	lda     regsave
+	ldx     regsave+1
+L010A:	ldy     #$0A
+	jsr     staxysp
+	cpx     #$00
+	bne     L010D
+	cmp     #$00
+	bne     L010D
+	ldy     #$0E
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	bne     L010D
+	ldy     #$0C
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L010B
+L010D:	ldy     #$15
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	dey
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     #$00
+	bne     L0132
+	cmp     #$00
+	beq     L0111
+L0132:	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	lda     #$08
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L0111:	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$08
+	bcc     L0113
+	inx
+L0113:	jsr     staxysp
+L010B:	ldy     #$07
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0115
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	bra     L0116
+L0115:	tax
+	ina
+L0116:	cpx     #$00
+	bne     L0118
+	cmp     #$00
+	bne     L0118
+	ldy     #$09
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0119
+	lda     #$01
+	bra     L011A
+L0119:	iny
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+L011A:	cpx     #$00
+	bne     L0118
+	cmp     #$00
+	beq     L0114
+L0118:	ldy     #$15
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	dey
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     #$00
+	bne     L0133
+	cmp     #$00
+	beq     L011D
+L0133:	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	lda     #$10
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L011D:	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$10
+	bcc     L011F
+	inx
+L011F:	jsr     staxysp
+L0114:	ldy     #$05
+	lda     (sp),y
+	sta     tmp1
+	dey
+	lda     (sp),y
+	pha
+	ldy     #$13
+	ldx     #$03
+L0120:	lda     (sp),y
+	sta     regbank+2,x
+	dey
+	dex
+	bpl     L0120
+	ldx     tmp1
+	pla
+	ldy     #$16
+	jmp     addysp
+
+.segment	"DATA"
+
+M0001:
+	.byte	$4C,$6F,$63,$61,$6C,$20,$65,$72,$72,$6F,$72,$20,$25,$64,$2E,$0A
+	.byte	$00
+M0002:
+	.byte	$73,$37,$38,$31,$33,$2C,$65,$72,$25,$64,$0A,$00
+M0003:
+	.byte	$73,$37,$38,$31,$33,$20,$20,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ section (int j, void *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_section: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$02
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	bne     L0003
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _s7813
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	lda     #$01
+	sta     M0001+14
+	stz     M0001+14+1
+	sta     M0001+16
+	stz     M0001+16+1
+	sta     M0001+18
+	stz     M0001+18+1
+	sta     M0001+20
+	stz     M0001+20+1
+	lda     #>(M0001)
+	sta     M0002+1
+	lda     #<(M0001)
+	sta     M0002
+	lda     #$00
+	sta     (sp)
+	ldy     #$01
+	sta     (sp),y
+	bra     L000D
+L0005:	jsr     pushw0sp
+	lda     M0002
+	ldx     M0002+1
+	jsr     _section
+	sta     M0001+22
+	stx     M0001+22+1
+	lda     M0001+24
+	clc
+	adc     M0001+22
+	sta     M0001+24
+	lda     M0001+24+1
+	adc     M0001+22+1
+	sta     M0001+24+1
+	lda     M0001+14
+	ora     M0001+14+1
+	beq     L0007
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     #<(M0001+26)
+	ldx     #>(M0001+26)
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+L0007:	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	ldy     #$01
+L000D:	lda     (sp),y
+	tax
+	lda     (sp)
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	bmi     L0005
+	lda     M0001+24
+	ora     M0001+24+1
+	bne     L0009
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	bra     L000F
+L0009:	lda     #<(S0006)
+	ldx     #>(S0006)
+L000F:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     M0001+24
+	ldx     M0001+24+1
+	jmp     incsp6
+
+.segment	"BSS"
+
+M0001:
+	.res	34,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
@@ -0,0 +1,1172 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_printf
+	.export		_lbits
+	.export		_ubits
+	.export		_fbits
+	.export		_dbits
+	.export		_flgs
+	.export		_flgm
+	.export		_flgd
+	.export		_flgl
+	.export		_rrc
+	.export		_crc
+	.export		_rfs
+	.export		_s7813
+	.export		_section
+	.export		_main
+
+.segment	"RODATA"
+
+S0004:
+	.byte	$53,$65,$63,$74,$69,$6F,$6E,$20,$25,$73,$20,$72,$65,$74,$75,$72
+	.byte	$6E,$65,$64,$20,$25,$64,$2E,$0A,$00
+S0005:
+	.byte	$0A,$4E,$6F,$20,$65,$72,$72,$6F,$72,$73,$20,$64,$65,$74,$65,$63
+	.byte	$74,$65,$64,$2E,$0A,$00
+S0006:
+	.byte	$0A,$46,$61,$69,$6C,$65,$64,$2E,$0A,$00
+
+.segment	"BSS"
+
+_lbits:
+	.res	2,$00
+_ubits:
+	.res	2,$00
+_fbits:
+	.res	2,$00
+_dbits:
+	.res	2,$00
+_flgs:
+	.res	2,$00
+_flgm:
+	.res	2,$00
+_flgd:
+	.res	2,$00
+_flgl:
+	.res	2,$00
+_rrc:
+	.res	2,$00
+_crc:
+	.res	2,$00
+_rfs:
+	.res	8,$00
+
+; ---------------------------------------------------------------
+; int __near__ s7813 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s7813: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$14
+	jsr     subysp
+	lda     #<(M0003)
+	ldx     #>(M0003)
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$15
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     incaxy
+	jsr     stax0sp
+	ldx     #$00
+	txa
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$15
+	jsr     ldaxysp
+	ldy     #$15
+	jsr     ldaxidx
+	ldy     #$12
+	jsr     staxysp
+L0002:	jsr     ldax0sp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$03
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	sta     (sreg),y
+	tax
+	php
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	bne     L0002
+	ldy     #$10
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L009B
+	ldy     #$15
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L011B
+	cmp     #$00
+	beq     L009D
+L011B:	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L009D:	ldy     #$05
+	jsr     ldaxysp
+	jsr     incax1
+	ldy     #$04
+	jsr     staxysp
+L009B:	ldx     #$00
+	txa
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$0E
+	jsr     staxysp
+	txa
+	php
+	ldy     #$0E
+	lda     #$01
+	jsr     addeqysp
+	plp
+	beq     L009F
+	ldy     #$0D
+	jsr     ldaxysp
+	stx     tmp1
+	ora     tmp1
+	php
+	ldy     #$0C
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	bne     L00A0
+L009F:	ldx     #$00
+	txa
+	jmp     L00A1
+L00A0:	ldx     #$00
+	lda     #$01
+L00A1:	ldy     #$0A
+	jsr     staxysp
+	ldy     #$0F
+	lda     (sp),y
+	bne     L011C
+	dey
+	lda     (sp),y
+	cmp     #$01
+	beq     L00A4
+L011C:	lda     #$01
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00A4
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00A4:	ldy     #$0C
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L00A7
+	ldx     #$00
+	lda     #$02
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00A7
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00A7:	ldy     #$0A
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L00AA
+	ldx     #$00
+	lda     #$03
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00AA
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00AA:	ldy     #$0F
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00AB
+	dey
+	jsr     ldaxysp
+	stx     tmp1
+	ora     tmp1
+	php
+	ldy     #$0C
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	bne     L00AC
+L00AB:	ldx     #$00
+	txa
+	jmp     L00AD
+L00AC:	ldx     #$00
+	lda     #$01
+L00AD:	ldy     #$0A
+	jsr     staxysp
+	ldy     #$0F
+	lda     (sp),y
+	bne     L011D
+	dey
+	lda     (sp),y
+	cmp     #$01
+	beq     L00B0
+L011D:	lda     #$04
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00B0
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00B0:	ldy     #$0D
+	lda     (sp),y
+	bne     L011E
+	dey
+	lda     (sp),y
+	cmp     #$01
+	beq     L00B3
+L011E:	ldx     #$00
+	lda     #$05
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00B3
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00B3:	ldy     #$0A
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L00B6
+	ldx     #$00
+	lda     #$06
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00B6
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00B6:	ldy     #$0F
+	jsr     ldaxysp
+	stx     tmp1
+	ora     tmp1
+	php
+	ldx     #$00
+	lda     #$01
+	ldy     #$0E
+	jsr     subeqysp
+	plp
+	beq     L00B7
+	ldy     #$0D
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	bne     L00B8
+L00B7:	ldx     #$00
+	txa
+	jmp     L00B9
+L00B8:	ldx     #$00
+	lda     #$01
+L00B9:	ldy     #$0A
+	jsr     staxysp
+	ldy     #$0E
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L00BC
+	lda     #$07
+	iny
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00BC
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00BC:	ldy     #$0D
+	lda     (sp),y
+	bne     L011F
+	dey
+	lda     (sp),y
+	cmp     #$01
+	beq     L00BF
+L011F:	ldx     #$00
+	lda     #$08
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00BF
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00BF:	ldy     #$0B
+	lda     (sp),y
+	bne     L0120
+	dey
+	lda     (sp),y
+	cmp     #$01
+	beq     L00C2
+L0120:	ldx     #$00
+	lda     #$09
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00C2
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00C2:	ldy     #$0F
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00C3
+	dey
+	jsr     ldaxysp
+	stx     tmp1
+	ora     tmp1
+	php
+	ldx     #$00
+	lda     #$01
+	ldy     #$0C
+	jsr     subeqysp
+	plp
+	bne     L00C4
+L00C3:	ldx     #$00
+	txa
+	jmp     L00C5
+L00C4:	ldx     #$00
+	lda     #$01
+L00C5:	ldy     #$0A
+	jsr     staxysp
+	ldy     #$0E
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L00C8
+	lda     #$0A
+	iny
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00C8
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00C8:	ldy     #$0D
+	lda     (sp),y
+	bne     L0121
+	dey
+	lda     (sp),y
+	cmp     #$01
+	beq     L00CB
+L0121:	ldx     #$00
+	lda     #$0B
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00CB
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00CB:	ldy     #$0A
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L00CE
+	ldx     #$00
+	lda     #$0C
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00CE
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00CE:	ldy     #$10
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L00CF
+	ldy     #$15
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0122
+	cmp     #$00
+	beq     L00D1
+L0122:	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	lda     #$02
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L00D1:	ldy     #$05
+	jsr     ldaxysp
+	jsr     incax2
+	ldy     #$04
+	jsr     staxysp
+L00CF:	ldx     #$00
+	txa
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$0E
+	jsr     staxysp
+	txa
+	php
+	ldy     #$0E
+	lda     #$01
+	jsr     addeqysp
+	plp
+	bne     L00D3
+	ldy     #$0D
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	bne     L00D3
+	tax
+	jmp     L00D4
+L00D3:	ldx     #$00
+	lda     #$01
+L00D4:	ldy     #$0A
+	jsr     staxysp
+	ldy     #$0F
+	lda     (sp),y
+	bne     L0123
+	dey
+	lda     (sp),y
+	cmp     #$01
+	beq     L00D7
+L0123:	lda     #$01
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00D7
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00D7:	ldy     #$0C
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L00DA
+	ldx     #$00
+	lda     #$02
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00DA
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00DA:	ldy     #$0A
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L00DD
+	ldx     #$00
+	lda     #$03
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00DD
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00DD:	ldy     #$0D
+	jsr     ldaxysp
+	stx     tmp1
+	ora     tmp1
+	php
+	ldy     #$0C
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	bne     L00DE
+	ldy     #$0F
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	bne     L00DE
+	tax
+	jmp     L00DF
+L00DE:	ldx     #$00
+	lda     #$01
+L00DF:	ldy     #$0A
+	jsr     staxysp
+	ldy     #$0F
+	lda     (sp),y
+	bne     L0124
+	dey
+	lda     (sp),y
+	cmp     #$01
+	beq     L00E2
+L0124:	lda     #$04
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00E2
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00E2:	ldy     #$0D
+	lda     (sp),y
+	bne     L0125
+	dey
+	lda     (sp),y
+	cmp     #$01
+	beq     L00E5
+L0125:	ldx     #$00
+	lda     #$05
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00E5
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00E5:	ldy     #$0B
+	lda     (sp),y
+	bne     L0126
+	dey
+	lda     (sp),y
+	cmp     #$01
+	beq     L00E8
+L0126:	ldx     #$00
+	lda     #$06
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00E8
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00E8:	ldy     #$0F
+	jsr     ldaxysp
+	stx     tmp1
+	ora     tmp1
+	php
+	ldx     #$00
+	lda     #$01
+	ldy     #$0E
+	jsr     subeqysp
+	plp
+	bne     L00E9
+	ldy     #$0D
+	jsr     ldaxysp
+	stx     tmp1
+	ora     tmp1
+	php
+	ldx     #$00
+	lda     #$01
+	ldy     #$0C
+	jsr     subeqysp
+	plp
+	bne     L00E9
+	ldx     #$00
+	txa
+	jmp     L00EA
+L00E9:	ldx     #$00
+	lda     #$01
+L00EA:	ldy     #$0A
+	jsr     staxysp
+	ldy     #$0E
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L00ED
+	lda     #$07
+	iny
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00ED
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00ED:	ldy     #$0D
+	lda     (sp),y
+	bne     L0127
+	dey
+	lda     (sp),y
+	cmp     #$01
+	beq     L00F0
+L0127:	ldx     #$00
+	lda     #$08
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00F0
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00F0:	ldy     #$0B
+	lda     (sp),y
+	bne     L0128
+	dey
+	lda     (sp),y
+	cmp     #$01
+	beq     L00F3
+L0128:	ldx     #$00
+	lda     #$09
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00F3
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00F3:	ldy     #$0F
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	bne     L00F4
+	dey
+	jsr     ldaxysp
+	stx     tmp1
+	ora     tmp1
+	php
+	ldx     #$00
+	lda     #$01
+	ldy     #$0C
+	jsr     subeqysp
+	plp
+	bne     L00F4
+	ldx     #$00
+	txa
+	jmp     L00F5
+L00F4:	ldx     #$00
+	lda     #$01
+L00F5:	ldy     #$0A
+	jsr     staxysp
+	ldy     #$0E
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L00F8
+	lda     #$0A
+	iny
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00F8
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00F8:	ldy     #$0C
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L00FB
+	ldx     #$00
+	lda     #$0B
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00FB
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00FB:	ldy     #$0B
+	lda     (sp),y
+	bne     L0129
+	dey
+	lda     (sp),y
+	cmp     #$01
+	beq     L00FE
+L0129:	ldx     #$00
+	lda     #$0C
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L00FE
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$15
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+L00FE:	ldy     #$10
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L00FF
+	ldy     #$15
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L012A
+	cmp     #$00
+	beq     L0101
+L012A:	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	tay
+	jsr     _printf
+L0101:	ldy     #$05
+	jsr     ldaxysp
+	jsr     incax4
+	ldy     #$04
+	jsr     staxysp
+L00FF:	ldx     #$00
+	txa
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$0E
+	jsr     staxysp
+	ldy     #$08
+	jsr     staxysp
+	lda     #$01
+	ldy     #$06
+	jsr     staxysp
+	ldy     #$07
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0103
+	ldy     #$09
+	jsr     ldaxysp
+	jmp     L0106
+L0103:	iny
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0105
+	ldy     #$0F
+	jsr     ldaxysp
+	sta     regsave
+	stx     regsave+1
+	ldy     #$0E
+	jmp     L0130
+L0105:	ldy     #$0D
+	jsr     ldaxysp
+	sta     regsave
+	stx     regsave+1
+	ldy     #$0C
+L0130:	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	lda     regsave
+	ldx     regsave+1
+L0106:	ldy     #$0A
+	jsr     staxysp
+	cpx     #$00
+	bne     L0109
+	cmp     #$00
+	bne     L0109
+	ldy     #$0E
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	bne     L0109
+	ldy     #$0C
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L0107
+L0109:	ldy     #$15
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L012B
+	cmp     #$00
+	beq     L010D
+L012B:	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	lda     #$08
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L010D:	ldy     #$05
+	jsr     ldaxysp
+	jsr     incax8
+	ldy     #$04
+	jsr     staxysp
+L0107:	ldy     #$07
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0110
+	ldy     #$09
+	jsr     ldaxysp
+	jmp     L0111
+L0110:	tax
+	lda     #$01
+L0111:	cpx     #$00
+	bne     L0113
+	cmp     #$00
+	bne     L0113
+	ldy     #$09
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0114
+	lda     #$01
+	jmp     L0115
+L0114:	iny
+	jsr     ldaxysp
+L0115:	cpx     #$00
+	bne     L0113
+	cmp     #$00
+	beq     L010F
+L0113:	ldy     #$15
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L012C
+	cmp     #$00
+	beq     L0118
+L012C:	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	lda     #$10
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L0118:	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$10
+	jsr     incaxy
+	ldy     #$04
+	jsr     staxysp
+L010F:	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$16
+	jmp     addysp
+
+.segment	"DATA"
+
+M0001:
+	.byte	$4C,$6F,$63,$61,$6C,$20,$65,$72,$72,$6F,$72,$20,$25,$64,$2E,$0A
+	.byte	$00
+M0002:
+	.byte	$73,$37,$38,$31,$33,$2C,$65,$72,$25,$64,$0A,$00
+M0003:
+	.byte	$73,$37,$38,$31,$33,$20,$20,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ section (int j, void *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_section: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$02
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	bne     L0003
+	jsr     ldax0sp
+	jsr     _s7813
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	ldx     #$00
+	lda     #$01
+	sta     M0001+14
+	stx     M0001+14+1
+	sta     M0001+16
+	stx     M0001+16+1
+	sta     M0001+18
+	stx     M0001+18+1
+	sta     M0001+20
+	stx     M0001+20+1
+	lda     #>(M0001)
+	sta     M0002+1
+	lda     #<(M0001)
+	sta     M0002
+	txa
+	jsr     stax0sp
+	jmp     L0002
+L0005:	jsr     pushw0sp
+	lda     M0002
+	ldx     M0002+1
+	jsr     _section
+	sta     M0001+22
+	stx     M0001+22+1
+	lda     M0001+24
+	clc
+	adc     M0001+22
+	sta     M0001+24
+	lda     M0001+24+1
+	adc     M0001+22+1
+	sta     M0001+24+1
+	lda     M0001+14
+	ora     M0001+14+1
+	beq     L0007
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     #<(M0001+26)
+	ldx     #>(M0001+26)
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+L0007:	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+L0002:	jsr     ldax0sp
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	bmi     L0005
+	lda     M0001+24
+	ora     M0001+24+1
+	bne     L0009
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jmp     L000E
+L0009:	lda     #<(S0006)
+	ldx     #>(S0006)
+L000E:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     M0001+24
+	ldx     M0001+24+1
+	jmp     incsp6
+
+.segment	"BSS"
+
+M0001:
+	.res	34,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
@@ -0,0 +1,2944 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "cq7813.c", 13958, 1613073744
+	.dbg		file, "common.h", 522, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/stdlib.h", 5999, 1613073744
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_lbits
+	.export		_ubits
+	.export		_fbits
+	.export		_dbits
+	.export		_flgs
+	.export		_flgm
+	.export		_flgd
+	.export		_flgl
+	.export		_rrc
+	.export		_crc
+	.export		_rfs
+	.export		_s7813
+	.export		_section
+	.export		_main
+
+.segment	"RODATA"
+
+S0004:
+	.byte	$53,$65,$63,$74,$69,$6F,$6E,$20,$25,$73,$20,$72,$65,$74,$75,$72
+	.byte	$6E,$65,$64,$20,$25,$64,$2E,$0A,$00
+S0005:
+	.byte	$0A,$4E,$6F,$20,$65,$72,$72,$6F,$72,$73,$20,$64,$65,$74,$65,$63
+	.byte	$74,$65,$64,$2E,$0A,$00
+S0006:
+	.byte	$0A,$46,$61,$69,$6C,$65,$64,$2E,$0A,$00
+
+.segment	"BSS"
+
+_lbits:
+	.res	2,$00
+_ubits:
+	.res	2,$00
+_fbits:
+	.res	2,$00
+_dbits:
+	.res	2,$00
+_flgs:
+	.res	2,$00
+_flgm:
+	.res	2,$00
+_flgd:
+	.res	2,$00
+_flgl:
+	.res	2,$00
+_rrc:
+	.res	2,$00
+_crc:
+	.res	2,$00
+_rfs:
+	.res	8,$00
+
+; ---------------------------------------------------------------
+; int __near__ s7813 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s7813: near
+
+	.dbg	func, "s7813", "00", extern, "_s7813"
+	.dbg	sym, "pd0", "00", auto, 0
+	.dbg	sym, "prlc", "00", auto, -2
+	.dbg	sym, "lrc", "00", auto, -4
+	.dbg	sym, "i", "00", auto, -6
+	.dbg	sym, "j", "00", auto, -8
+	.dbg	sym, "r", "00", auto, -10
+	.dbg	sym, "zero", "00", auto, -12
+	.dbg	sym, "one", "00", auto, -14
+	.dbg	sym, "rc", "00", auto, -16
+	.dbg	sym, "ps", "00", auto, -18
+	.dbg	sym, "pt", "00", auto, -20
+
+.segment	"CODE"
+
+	.dbg	line, "cq7813.c", 56
+	jsr     pushax
+	.dbg	line, "cq7813.c", 65
+	ldy     #$14
+	jsr     subysp
+	lda     #<(M0003)
+	ldx     #>(M0003)
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 66
+	ldy     #$15
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     incaxy
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 67
+	ldx     #$00
+	lda     #$00
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 68
+	ldx     #$00
+	lda     #$00
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 69
+	ldy     #$15
+	jsr     ldaxysp
+	ldy     #$15
+	jsr     ldaxidx
+	ldy     #$12
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 70
+	jmp     L0002
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$00
+	jsr     staspidx
+	tax
+	php
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	jne     L0002
+	.dbg	line, "cq7813.c", 95
+	jmp     L0005
+	ldx     #$00
+	lda     #$01
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 96
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0005
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 97
+L0005:	jmp     L0007
+	ldx     #$00
+	lda     #$02
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 98
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0007
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 99
+L0007:	jmp     L0009
+	ldx     #$00
+	lda     #$03
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 100
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0009
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 101
+L0009:	jmp     L000B
+	ldx     #$00
+	lda     #$04
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 102
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L000B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 103
+L000B:	jmp     L000D
+	ldx     #$00
+	lda     #$05
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 104
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L000D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 105
+L000D:	jmp     L000F
+	ldx     #$00
+	lda     #$06
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 106
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L000F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 107
+L000F:	jmp     L0011
+	ldx     #$00
+	lda     #$07
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 108
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0011
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 109
+L0011:	jmp     L0013
+	ldx     #$00
+	lda     #$08
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 110
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0013
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 111
+L0013:	jmp     L0015
+	ldx     #$00
+	lda     #$09
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 112
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0015
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 113
+L0015:	jmp     L0017
+	ldx     #$00
+	lda     #$0A
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 114
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0017
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 115
+L0017:	jmp     L0019
+	ldx     #$00
+	lda     #$0B
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 116
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0019
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 117
+L0019:	jmp     L001B
+	ldx     #$00
+	lda     #$0C
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 118
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L001B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 119
+L001B:	jmp     L001D
+	ldx     #$00
+	lda     #$0D
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 120
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L001D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 121
+L001D:	jmp     L001F
+	ldx     #$00
+	lda     #$0E
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 122
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L001F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 123
+L001F:	jmp     L0021
+	ldx     #$00
+	lda     #$0F
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 124
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0021
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 125
+L0021:	jmp     L0023
+	ldx     #$00
+	lda     #$10
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 126
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0023
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 127
+L0023:	jmp     L0025
+	ldx     #$00
+	lda     #$11
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 128
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0025
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 129
+L0025:	jmp     L0027
+	ldx     #$00
+	lda     #$12
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 130
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0027
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 131
+L0027:	jmp     L0029
+	ldx     #$00
+	lda     #$10
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 132
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0029
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 133
+L0029:	jmp     L002B
+	ldx     #$00
+	lda     #$14
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 134
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L002B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 135
+L002B:	jmp     L002D
+	ldx     #$00
+	lda     #$15
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 136
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L002D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 137
+L002D:	jmp     L002F
+	ldx     #$00
+	lda     #$16
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 138
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L002F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 139
+L002F:	jmp     L0031
+	ldx     #$00
+	lda     #$17
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 140
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0031
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 141
+L0031:	jmp     L0033
+	ldx     #$00
+	lda     #$18
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 142
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0033
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 143
+L0033:	jmp     L0035
+	ldx     #$00
+	lda     #$19
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 144
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0035
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 145
+L0035:	jmp     L0037
+	ldx     #$00
+	lda     #$1A
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 146
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0037
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 147
+L0037:	jmp     L0039
+	ldx     #$00
+	lda     #$1B
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 148
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0039
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 149
+L0039:	jmp     L003B
+	ldx     #$00
+	lda     #$1C
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 150
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L003B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 151
+L003B:	jmp     L003D
+	ldx     #$00
+	lda     #$1A
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 152
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L003D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 153
+L003D:	jmp     L003F
+	ldx     #$00
+	lda     #$1E
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 154
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L003F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 155
+L003F:	jmp     L0041
+	ldx     #$00
+	lda     #$1F
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 156
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0041
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 157
+L0041:	jmp     L0043
+	ldx     #$00
+	lda     #$20
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 158
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0043
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 159
+L0043:	jmp     L0045
+	ldx     #$00
+	lda     #$21
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 160
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0045
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 161
+L0045:	jmp     L0047
+	ldx     #$00
+	lda     #$22
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 162
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0047
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 163
+L0047:	jmp     L0049
+	ldx     #$00
+	lda     #$23
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 164
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0049
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 165
+L0049:	jmp     L004B
+	ldx     #$00
+	lda     #$24
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 166
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L004B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 167
+L004B:	jmp     L004D
+	ldx     #$00
+	lda     #$25
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 168
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L004D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 169
+L004D:	jmp     L004F
+	ldx     #$00
+	lda     #$26
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 170
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L004F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 171
+L004F:	jmp     L0051
+	ldx     #$00
+	lda     #$27
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 172
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0051
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 173
+L0051:	jmp     L0053
+	ldx     #$00
+	lda     #$28
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 174
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0053
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 175
+L0053:	jmp     L0055
+	ldx     #$00
+	lda     #$29
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 176
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0055
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 177
+L0055:	jmp     L0057
+	ldx     #$00
+	lda     #$2A
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 178
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0057
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 179
+L0057:	jmp     L0059
+	ldx     #$00
+	lda     #$2B
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 180
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0059
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 181
+L0059:	jmp     L005B
+	ldx     #$00
+	lda     #$2C
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 182
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L005B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 183
+L005B:	jmp     L005D
+	ldx     #$00
+	lda     #$2D
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 184
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L005D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 185
+L005D:	jmp     L005F
+	ldx     #$00
+	lda     #$2E
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 186
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L005F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 187
+L005F:	jmp     L0061
+	ldx     #$00
+	lda     #$2F
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 188
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0061
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 189
+L0061:	jmp     L0063
+	ldx     #$00
+	lda     #$30
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 190
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0063
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 191
+L0063:	jmp     L0065
+	ldx     #$00
+	lda     #$31
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 192
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0065
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 193
+L0065:	jmp     L0067
+	ldx     #$00
+	lda     #$32
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 194
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0067
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 195
+L0067:	jmp     L0069
+	ldx     #$00
+	lda     #$33
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 196
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0069
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 197
+L0069:	jmp     L006B
+	ldx     #$00
+	lda     #$34
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 198
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L006B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 199
+L006B:	jmp     L006D
+	ldx     #$00
+	lda     #$35
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 200
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L006D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 201
+L006D:	jmp     L006F
+	ldx     #$00
+	lda     #$36
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 202
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L006F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 203
+L006F:	jmp     L0071
+	ldx     #$00
+	lda     #$37
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 204
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0071
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 205
+L0071:	jmp     L0073
+	ldx     #$00
+	lda     #$38
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 206
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0073
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 207
+L0073:	jmp     L0075
+	ldx     #$00
+	lda     #$39
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 208
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0075
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 209
+L0075:	jmp     L0077
+	ldx     #$00
+	lda     #$3A
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 210
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0077
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 211
+L0077:	jmp     L0079
+	ldx     #$00
+	lda     #$38
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 212
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0079
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 213
+L0079:	jmp     L007B
+	ldx     #$00
+	lda     #$3C
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 214
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L007B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 215
+L007B:	jmp     L007D
+	ldx     #$00
+	lda     #$3D
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 216
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L007D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 217
+L007D:	jmp     L007F
+	ldx     #$00
+	lda     #$3E
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 218
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L007F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 219
+L007F:	jmp     L0081
+	ldx     #$00
+	lda     #$3F
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 220
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0081
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 221
+L0081:	jmp     L0083
+	ldx     #$00
+	lda     #$40
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 222
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0083
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 223
+L0083:	jmp     L0085
+	ldx     #$00
+	lda     #$41
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 224
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0085
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 225
+L0085:	jmp     L0087
+	ldx     #$00
+	lda     #$42
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 226
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0087
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 227
+L0087:	jmp     L0089
+	ldx     #$00
+	lda     #$43
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 228
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0089
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 229
+L0089:	jmp     L008B
+	ldx     #$00
+	lda     #$44
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 230
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L008B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 231
+L008B:	jmp     L008D
+	ldx     #$00
+	lda     #$45
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 232
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L008D
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 233
+L008D:	jmp     L008F
+	ldx     #$00
+	lda     #$46
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 234
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L008F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 235
+L008F:	jmp     L0091
+	ldx     #$00
+	lda     #$47
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 236
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0091
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 237
+L0091:	jmp     L0093
+	ldx     #$00
+	lda     #$48
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 238
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0093
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 239
+L0093:	jmp     L0095
+	ldx     #$00
+	lda     #$49
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0095
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 240
+L0095:	jmp     L0097
+	ldx     #$00
+	lda     #$4A
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0097
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 241
+L0097:	jmp     L009A
+	ldx     #$00
+	lda     #$4B
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L009A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 243
+L009A:	ldy     #$11
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L009C
+	cmp     #$00
+L009C:	jsr     boolne
+	jeq     L009B
+	.dbg	line, "cq7813.c", 244
+	ldy     #$15
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L009E
+	cmp     #$00
+L009E:	jsr     boolne
+	jeq     L009D
+	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 245
+L009D:	ldy     #$05
+	jsr     ldaxysp
+	jsr     incax1
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 255
+L009B:	ldx     #$00
+	lda     #$00
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 256
+	ldx     #$00
+	lda     #$00
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 258
+	ldy     #$0F
+	jsr     ldaxysp
+	stx     tmp1
+	ora     tmp1
+	php
+	ldy     #$0E
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	jeq     L009F
+	ldy     #$0D
+	jsr     ldaxysp
+	stx     tmp1
+	ora     tmp1
+	php
+	ldy     #$0C
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	jne     L00A0
+L009F:	ldx     #$00
+	lda     #$00
+	jeq     L00A1
+L00A0:	ldx     #$00
+	lda     #$01
+L00A1:	ldy     #$0A
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 259
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00A3
+	cmp     #$01
+L00A3:	jsr     boolne
+	jeq     L00A4
+	ldx     #$00
+	lda     #$01
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00A4
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 260
+L00A4:	ldy     #$0D
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00A6
+	cmp     #$00
+L00A6:	jsr     boolne
+	jeq     L00A7
+	ldx     #$00
+	lda     #$02
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00A7
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 261
+L00A7:	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00A9
+	cmp     #$00
+L00A9:	jsr     boolne
+	jeq     L00AA
+	ldx     #$00
+	lda     #$03
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00AA
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 262
+L00AA:	ldy     #$0F
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00AB
+	ldy     #$0D
+	jsr     ldaxysp
+	stx     tmp1
+	ora     tmp1
+	php
+	ldy     #$0C
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	jne     L00AC
+L00AB:	ldx     #$00
+	lda     #$00
+	jeq     L00AD
+L00AC:	ldx     #$00
+	lda     #$01
+L00AD:	ldy     #$0A
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 263
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00AF
+	cmp     #$01
+L00AF:	jsr     boolne
+	jeq     L00B0
+	ldx     #$00
+	lda     #$04
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00B0
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 264
+L00B0:	ldy     #$0D
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00B2
+	cmp     #$01
+L00B2:	jsr     boolne
+	jeq     L00B3
+	ldx     #$00
+	lda     #$05
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00B3
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 265
+L00B3:	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00B5
+	cmp     #$00
+L00B5:	jsr     boolne
+	jeq     L00B6
+	ldx     #$00
+	lda     #$06
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00B6
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 266
+L00B6:	ldy     #$0F
+	jsr     ldaxysp
+	stx     tmp1
+	ora     tmp1
+	php
+	ldx     #$00
+	lda     #$01
+	ldy     #$0E
+	jsr     subeqysp
+	plp
+	jeq     L00B7
+	ldy     #$0D
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jne     L00B8
+L00B7:	ldx     #$00
+	lda     #$00
+	jeq     L00B9
+L00B8:	ldx     #$00
+	lda     #$01
+L00B9:	ldy     #$0A
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 267
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00BB
+	cmp     #$00
+L00BB:	jsr     boolne
+	jeq     L00BC
+	ldx     #$00
+	lda     #$07
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00BC
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 268
+L00BC:	ldy     #$0D
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00BE
+	cmp     #$01
+L00BE:	jsr     boolne
+	jeq     L00BF
+	ldx     #$00
+	lda     #$08
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00BF
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 269
+L00BF:	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00C1
+	cmp     #$01
+L00C1:	jsr     boolne
+	jeq     L00C2
+	ldx     #$00
+	lda     #$09
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00C2
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 270
+L00C2:	ldy     #$0F
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00C3
+	ldy     #$0D
+	jsr     ldaxysp
+	stx     tmp1
+	ora     tmp1
+	php
+	ldx     #$00
+	lda     #$01
+	ldy     #$0C
+	jsr     subeqysp
+	plp
+	jne     L00C4
+L00C3:	ldx     #$00
+	lda     #$00
+	jeq     L00C5
+L00C4:	ldx     #$00
+	lda     #$01
+L00C5:	ldy     #$0A
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 271
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00C7
+	cmp     #$00
+L00C7:	jsr     boolne
+	jeq     L00C8
+	ldx     #$00
+	lda     #$0A
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00C8
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 272
+L00C8:	ldy     #$0D
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00CA
+	cmp     #$01
+L00CA:	jsr     boolne
+	jeq     L00CB
+	ldx     #$00
+	lda     #$0B
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00CB
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 273
+L00CB:	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00CD
+	cmp     #$00
+L00CD:	jsr     boolne
+	jeq     L00CE
+	ldx     #$00
+	lda     #$0C
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00CE
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 275
+L00CE:	ldy     #$11
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00D0
+	cmp     #$00
+L00D0:	jsr     boolne
+	jeq     L00CF
+	.dbg	line, "cq7813.c", 276
+	ldy     #$15
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L00D2
+	cmp     #$00
+L00D2:	jsr     boolne
+	jeq     L00D1
+	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 277
+L00D1:	ldy     #$05
+	jsr     ldaxysp
+	jsr     incax2
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 287
+L00CF:	ldx     #$00
+	lda     #$00
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 288
+	ldx     #$00
+	lda     #$00
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 289
+	ldy     #$0F
+	jsr     ldaxysp
+	stx     tmp1
+	ora     tmp1
+	php
+	ldy     #$0E
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	jne     L00D3
+	ldy     #$0D
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jne     L00D3
+	ldx     #$00
+	lda     #$00
+	jeq     L00D4
+L00D3:	ldx     #$00
+	lda     #$01
+L00D4:	ldy     #$0A
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 290
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00D6
+	cmp     #$01
+L00D6:	jsr     boolne
+	jeq     L00D7
+	ldx     #$00
+	lda     #$01
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00D7
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 291
+L00D7:	ldy     #$0D
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00D9
+	cmp     #$00
+L00D9:	jsr     boolne
+	jeq     L00DA
+	ldx     #$00
+	lda     #$02
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00DA
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 292
+L00DA:	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00DC
+	cmp     #$00
+L00DC:	jsr     boolne
+	jeq     L00DD
+	ldx     #$00
+	lda     #$03
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00DD
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 293
+L00DD:	ldy     #$0D
+	jsr     ldaxysp
+	stx     tmp1
+	ora     tmp1
+	php
+	ldy     #$0C
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	jne     L00DE
+	ldy     #$0F
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jne     L00DE
+	ldx     #$00
+	lda     #$00
+	jeq     L00DF
+L00DE:	ldx     #$00
+	lda     #$01
+L00DF:	ldy     #$0A
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 294
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00E1
+	cmp     #$01
+L00E1:	jsr     boolne
+	jeq     L00E2
+	ldx     #$00
+	lda     #$04
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00E2
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 295
+L00E2:	ldy     #$0D
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00E4
+	cmp     #$01
+L00E4:	jsr     boolne
+	jeq     L00E5
+	ldx     #$00
+	lda     #$05
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00E5
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 296
+L00E5:	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00E7
+	cmp     #$01
+L00E7:	jsr     boolne
+	jeq     L00E8
+	ldx     #$00
+	lda     #$06
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00E8
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 297
+L00E8:	ldy     #$0F
+	jsr     ldaxysp
+	stx     tmp1
+	ora     tmp1
+	php
+	ldx     #$00
+	lda     #$01
+	ldy     #$0E
+	jsr     subeqysp
+	plp
+	jne     L00E9
+	ldy     #$0D
+	jsr     ldaxysp
+	stx     tmp1
+	ora     tmp1
+	php
+	ldx     #$00
+	lda     #$01
+	ldy     #$0C
+	jsr     subeqysp
+	plp
+	jne     L00E9
+	ldx     #$00
+	lda     #$00
+	jeq     L00EA
+L00E9:	ldx     #$00
+	lda     #$01
+L00EA:	ldy     #$0A
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 298
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00EC
+	cmp     #$00
+L00EC:	jsr     boolne
+	jeq     L00ED
+	ldx     #$00
+	lda     #$07
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00ED
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 299
+L00ED:	ldy     #$0D
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00EF
+	cmp     #$01
+L00EF:	jsr     boolne
+	jeq     L00F0
+	ldx     #$00
+	lda     #$08
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00F0
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 300
+L00F0:	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00F2
+	cmp     #$01
+L00F2:	jsr     boolne
+	jeq     L00F3
+	ldx     #$00
+	lda     #$09
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00F3
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 301
+L00F3:	ldy     #$0F
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jne     L00F4
+	ldy     #$0D
+	jsr     ldaxysp
+	stx     tmp1
+	ora     tmp1
+	php
+	ldx     #$00
+	lda     #$01
+	ldy     #$0C
+	jsr     subeqysp
+	plp
+	jne     L00F4
+	ldx     #$00
+	lda     #$00
+	jeq     L00F5
+L00F4:	ldx     #$00
+	lda     #$01
+L00F5:	ldy     #$0A
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 302
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00F7
+	cmp     #$00
+L00F7:	jsr     boolne
+	jeq     L00F8
+	ldx     #$00
+	lda     #$0A
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00F8
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 303
+L00F8:	ldy     #$0D
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00FA
+	cmp     #$00
+L00FA:	jsr     boolne
+	jeq     L00FB
+	ldx     #$00
+	lda     #$0B
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00FB
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 304
+L00FB:	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00FD
+	cmp     #$01
+L00FD:	jsr     boolne
+	jeq     L00FE
+	ldx     #$00
+	lda     #$0C
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$13
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L00FE
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 306
+L00FE:	ldy     #$11
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0100
+	cmp     #$00
+L0100:	jsr     boolne
+	jeq     L00FF
+	.dbg	line, "cq7813.c", 307
+	ldy     #$15
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0102
+	cmp     #$00
+L0102:	jsr     boolne
+	jeq     L0101
+	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	ldx     #$00
+	lda     #$04
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 308
+L0101:	ldy     #$05
+	jsr     ldaxysp
+	jsr     incax4
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 313
+L00FF:	ldx     #$00
+	lda     #$00
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 314
+	ldx     #$00
+	lda     #$00
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 315
+	ldx     #$00
+	lda     #$01
+	ldy     #$06
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 316
+	ldy     #$07
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0103
+	ldy     #$09
+	jsr     ldaxysp
+	jmp     L0106
+L0103:	ldy     #$07
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0105
+	ldy     #$0F
+	jsr     ldaxysp
+	sta     regsave
+	stx     regsave+1
+	ldy     #$0E
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	lda     regsave
+	ldx     regsave+1
+	jmp     L0106
+L0105:	ldy     #$0D
+	jsr     ldaxysp
+	sta     regsave
+	stx     regsave+1
+	ldy     #$0C
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	lda     regsave
+	ldx     regsave+1
+L0106:	ldy     #$0A
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 317
+	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0108
+	cmp     #$00
+L0108:	jsr     boolne
+	jne     L0109
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L010A
+	cmp     #$00
+L010A:	jsr     boolne
+	jne     L0109
+	ldy     #$0D
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L010B
+	cmp     #$00
+L010B:	jsr     boolne
+	jne     L0109
+	ldx     #$00
+	lda     #$00
+	jeq     L010C
+L0109:	ldx     #$00
+	lda     #$01
+L010C:	jeq     L0107
+	.dbg	line, "cq7813.c", 318
+	ldy     #$15
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L010E
+	cmp     #$00
+L010E:	jsr     boolne
+	jeq     L010D
+	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	ldx     #$00
+	lda     #$08
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 319
+L010D:	ldy     #$05
+	jsr     ldaxysp
+	jsr     incax8
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 327
+L0107:	ldy     #$07
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0110
+	ldy     #$09
+	jsr     ldaxysp
+	jmp     L0111
+L0110:	ldx     #$00
+	lda     #$01
+L0111:	cpx     #$00
+	bne     L0112
+	cmp     #$00
+L0112:	jsr     boolne
+	jne     L0113
+	ldy     #$09
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0114
+	ldx     #$00
+	lda     #$01
+	jmp     L0115
+L0114:	ldy     #$09
+	jsr     ldaxysp
+L0115:	cpx     #$00
+	bne     L0116
+	cmp     #$00
+L0116:	jsr     boolne
+	jne     L0113
+	ldx     #$00
+	lda     #$00
+	jeq     L0117
+L0113:	ldx     #$00
+	lda     #$01
+L0117:	jeq     L010F
+	.dbg	line, "cq7813.c", 328
+	ldy     #$15
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0119
+	cmp     #$00
+L0119:	jsr     boolne
+	jeq     L0118
+	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	ldx     #$00
+	lda     #$10
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq7813.c", 329
+L0118:	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$10
+	jsr     incaxy
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq7813.c", 331
+L010F:	ldy     #$05
+	jsr     ldaxysp
+	jmp     L0001
+	.dbg	line, "cq7813.c", 332
+L0001:	ldy     #$16
+	jsr     addysp
+	rts
+
+	.dbg	line
+.segment	"DATA"
+
+M0001:
+	.byte	$4C,$6F,$63,$61,$6C,$20,$65,$72,$72,$6F,$72,$20,$25,$64,$2E,$0A
+	.byte	$00
+M0002:
+	.byte	$73,$37,$38,$31,$33,$2C,$65,$72,$25,$64,$0A,$00
+M0003:
+	.byte	$73,$37,$38,$31,$33,$20,$20,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ section (int j, void *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_section: near
+
+	.dbg	func, "section", "00", extern, "_section"
+	.dbg	sym, "j", "00", auto, 2
+	.dbg	sym, "pd0", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "cq7813.c", 341
+	jsr     pushax
+	.dbg	line, "cq7813.c", 343
+	ldy     #$03
+	jsr     ldaxysp
+	jmp     L0002
+	.dbg	line, "cq7813.c", 345
+L0002:	cpx     #$00
+	jne     L0005
+	cmp     #$00
+	jeq     L0004
+	jmp     L0003
+L0005:	jmp     L0003
+	.dbg	line, "cq7813.c", 344
+L0004:	ldy     #$01
+	jsr     ldaxysp
+	jsr     _s7813
+	jmp     L0003
+	.dbg	line, "cq7813.c", 346
+L0003:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+	.dbg	sym, "n", "00", auto, 2
+	.dbg	sym, "args", "00", auto, 0
+	.dbg	sym, "j", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "cq7813.c", 366
+	jsr     decsp2
+	ldx     #$00
+	lda     #$01
+	sta     M0001+14
+	stx     M0001+14+1
+	.dbg	line, "cq7813.c", 367
+	ldx     #$00
+	lda     #$01
+	sta     M0001+16
+	stx     M0001+16+1
+	.dbg	line, "cq7813.c", 368
+	ldx     #$00
+	lda     #$01
+	sta     M0001+18
+	stx     M0001+18+1
+	.dbg	line, "cq7813.c", 369
+	ldx     #$00
+	lda     #$01
+	sta     M0001+20
+	stx     M0001+20+1
+	.dbg	line, "cq7813.c", 371
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	sta     M0002
+	stx     M0002+1
+	.dbg	line, "cq7813.c", 373
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+	jmp     L0002
+	.dbg	line, "cq7813.c", 374
+L0005:	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	lda     M0002
+	ldx     M0002+1
+	jsr     _section
+	sta     M0001+22
+	stx     M0001+22+1
+	.dbg	line, "cq7813.c", 375
+	lda     M0001+24
+	ldx     M0001+24+1
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     tosaddax
+	sta     M0001+24
+	stx     M0001+24+1
+	.dbg	line, "cq7813.c", 376
+	lda     M0001+14
+	ldx     M0001+14+1
+	cpx     #$00
+	bne     L0008
+	cmp     #$00
+L0008:	jsr     boolne
+	jeq     L0007
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     #<(M0001+26)
+	ldx     #>(M0001+26)
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "cq7813.c", 373
+L0007:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0005
+	.dbg	line, "cq7813.c", 379
+	lda     M0001+24
+	ldx     M0001+24+1
+	cpx     #$00
+	bne     L000A
+	cmp     #$00
+L000A:	jsr     booleq
+	jeq     L0009
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cq7813.c", 380
+	jmp     L000B
+L0009:	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cq7813.c", 382
+L000B:	lda     M0001+24
+	ldx     M0001+24+1
+	jmp     L0001
+	.dbg	line, "cq7813.c", 383
+L0001:	jsr     incsp6
+	rts
+
+	.dbg	line
+.segment	"BSS"
+
+M0001:
+	.res	34,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
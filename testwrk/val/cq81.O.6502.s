@@ -0,0 +1,2097 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_printf
+	.export		_lbits
+	.export		_ubits
+	.export		_fbits
+	.export		_dbits
+	.export		_flgs
+	.export		_flgm
+	.export		_flgd
+	.export		_flgl
+	.export		_rrc
+	.export		_crc
+	.export		_rfs
+	.export		_regc
+	.export		_regp
+	.export		_regi
+	.export		_s81
+	.export		_section
+	.export		_main
+
+.segment	"RODATA"
+
+S000B:
+	.byte	$53,$65,$63,$74,$69,$6F,$6E,$20,$25,$73,$20,$72,$65,$74,$75,$72
+	.byte	$6E,$65,$64,$20,$25,$64,$2E,$0A,$00
+S000C:
+	.byte	$0A,$4E,$6F,$20,$65,$72,$72,$6F,$72,$73,$20,$64,$65,$74,$65,$63
+	.byte	$74,$65,$64,$2E,$0A,$00
+S000D:
+	.byte	$0A,$46,$61,$69,$6C,$65,$64,$2E,$0A,$00
+S0008:
+	.byte	$70,$6F,$69,$6E,$74,$65,$72,$00
+S0007	:=	S0008+0
+S0006:
+	.byte	$63,$68,$61,$72,$00
+S0005	:=	S0006+0
+S0009:
+	.byte	$69,$6E,$74,$00
+S000A	:=	S0009+0
+
+.segment	"BSS"
+
+_lbits:
+	.res	2,$00
+_ubits:
+	.res	2,$00
+_fbits:
+	.res	2,$00
+_dbits:
+	.res	2,$00
+_flgs:
+	.res	2,$00
+_flgm:
+	.res	2,$00
+_flgd:
+	.res	2,$00
+_flgl:
+	.res	2,$00
+_rrc:
+	.res	2,$00
+_crc:
+	.res	2,$00
+_rfs:
+	.res	8,$00
+
+; ---------------------------------------------------------------
+; int __near__ regc (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_regc: near
+
+.segment	"CODE"
+
+	ldy     #$5D
+	jsr     subysp
+	lda     #$00
+	ldy     #$5C
+	sta     (sp),y
+	lda     #$01
+	dey
+	sta     (sp),y
+	lda     #$02
+	dey
+	sta     (sp),y
+	lda     #$03
+	dey
+	sta     (sp),y
+	lda     #$04
+	dey
+	sta     (sp),y
+	lda     #$05
+	dey
+	sta     (sp),y
+	lda     #$06
+	dey
+	sta     (sp),y
+	lda     #$07
+	dey
+	sta     (sp),y
+	lda     #$08
+	dey
+	sta     (sp),y
+	lda     #$09
+	dey
+	sta     (sp),y
+	lda     #$0A
+	dey
+	sta     (sp),y
+	lda     #$0B
+	dey
+	sta     (sp),y
+	lda     #$0C
+	dey
+	sta     (sp),y
+	lda     #$0D
+	dey
+	sta     (sp),y
+	lda     #$0E
+	dey
+	sta     (sp),y
+	lda     #$0F
+	dey
+	sta     (sp),y
+	lda     #$10
+	dey
+	sta     (sp),y
+	lda     #$11
+	dey
+	sta     (sp),y
+	lda     #$12
+	dey
+	sta     (sp),y
+	lda     #$13
+	dey
+	sta     (sp),y
+	lda     #$14
+	dey
+	sta     (sp),y
+	lda     #$15
+	dey
+	sta     (sp),y
+	lda     #$16
+	dey
+	sta     (sp),y
+	lda     #$17
+	dey
+	sta     (sp),y
+	lda     #$18
+	dey
+	sta     (sp),y
+	lda     #$19
+	dey
+	sta     (sp),y
+	lda     #$1A
+	dey
+	sta     (sp),y
+	lda     #$1B
+	dey
+	sta     (sp),y
+	lda     #$1C
+	dey
+	sta     (sp),y
+	lda     #$1D
+	dey
+	sta     (sp),y
+	lda     #$1E
+	dey
+	sta     (sp),y
+	lda     #$1F
+	dey
+	sta     (sp),y
+	lda     #$20
+	dey
+	sta     (sp),y
+	lda     #$21
+	dey
+	sta     (sp),y
+	lda     #$22
+	dey
+	sta     (sp),y
+	lda     #$23
+	dey
+	sta     (sp),y
+	lda     #$24
+	dey
+	sta     (sp),y
+	lda     #$25
+	dey
+	sta     (sp),y
+	lda     #$26
+	dey
+	sta     (sp),y
+	lda     #$5B
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$5E
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     stax0sp
+	lda     #$5A
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$5D
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$02
+	jsr     staxysp
+	lda     #$59
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$5C
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$04
+	jsr     staxysp
+	lda     #$57
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$5B
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$06
+	jsr     staxysp
+	lda     #$55
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$59
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$08
+	jsr     staxysp
+	lda     #$53
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$57
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$0A
+	jsr     staxysp
+	lda     #$51
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$55
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$0C
+	jsr     staxysp
+	lda     #$4F
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$53
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$4D
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$51
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$10
+	jsr     staxysp
+	lda     #$4B
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$4F
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$12
+	jsr     staxysp
+	lda     #$49
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$4D
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$14
+	jsr     staxysp
+	lda     #$47
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$4B
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$16
+	jsr     staxysp
+	lda     #$45
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$49
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$18
+	jsr     staxysp
+	lda     #$43
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$47
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$41
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$45
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$1C
+	jsr     staxysp
+	lda     #$3F
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$43
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$3D
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$41
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$20
+	jsr     staxysp
+	lda     #$3B
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$3F
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$22
+	jsr     staxysp
+	lda     #$39
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$3D
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$24
+	jsr     staxysp
+	lda     #$38
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$3B
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$26
+	jsr     staxysp
+	lda     #$37
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$3A
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$28
+	jsr     staxysp
+	lda     #$36
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$39
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$2A
+	jsr     staxysp
+	jsr     ldax0sp
+	ldy     #$32
+	jsr     staxysp
+	ldx     #$00
+	lda     #$01
+	ldy     #$34
+	jsr     staxysp
+	txa
+	ldy     #$2C
+	jsr     staxysp
+	jmp     L0002
+L0005:	ldy     #$35
+	jsr     ldaxysp
+	cpx     #$00
+	jne     L0008
+	cmp     #$01
+	beq     L0009
+	cmp     #$02
+	beq     L000B
+	cmp     #$03
+	jeq     L000E
+	jmp     L0008
+L0009:	ldy     #$2D
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	jsr     ldaxi
+	ldy     #$32
+	cmp     (sp),y
+	bne     L0019
+	txa
+	iny
+	cmp     (sp),y
+	jeq     L0008
+L0019:	ldy     #$2D
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	jsr     ldaxi
+	ldy     #$30
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$34
+	jsr     staxysp
+	lda     #$01
+	ldy     #$2E
+	jmp     L0018
+L000B:	ldy     #$2D
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	jsr     ldaxi
+	ldy     #$32
+	cmp     (sp),y
+	bne     L000C
+	txa
+	iny
+	cmp     (sp),y
+	bne     L000C
+	ldx     #$00
+	lda     #$03
+	jmp     L001B
+L000C:	ldy     #$2D
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	jsr     ldaxi
+	ldy     #$30
+	cmp     (sp),y
+	bne     L001A
+	txa
+	iny
+	cmp     (sp),y
+	bne     L001A
+	ldy     #$2F
+	jsr     ldaxysp
+	jsr     incax1
+	ldy     #$2E
+	jmp     L0018
+L000E:	ldy     #$2D
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	jsr     ldaxi
+	ldy     #$32
+	cmp     (sp),y
+	bne     L001A
+	txa
+	iny
+	cmp     (sp),y
+	beq     L0008
+L001A:	ldx     #$00
+	lda     #$04
+L001B:	ldy     #$34
+L0018:	jsr     staxysp
+L0008:	ldy     #$2C
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L0002:	ldy     #$2D
+	jsr     ldaxysp
+	cmp     #$16
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	jmi     L0005
+	ldy     #$35
+	lda     (sp),y
+	bne     L0011
+	dey
+	lda     (sp),y
+	cmp     #$03
+	bne     L0011
+	lda     #$10
+	sec
+	ldy     #$2E
+	sbc     (sp),y
+	pha
+	lda     #$00
+	iny
+	sbc     (sp),y
+	tax
+	pla
+	jmp     L0013
+L0011:	ldx     #$FF
+	txa
+L0013:	ldy     #$5D
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ regp (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_regp: near
+
+.segment	"CODE"
+
+	ldy     #$84
+	jsr     subysp
+	lda     #$82
+	jsr     leaa0sp
+	ldy     #$82
+	jsr     staxysp
+	lda     #$80
+	jsr     leaa0sp
+	ldy     #$80
+	jsr     staxysp
+	lda     #$7E
+	jsr     leaa0sp
+	ldy     #$7E
+	jsr     staxysp
+	lda     #$7C
+	jsr     leaa0sp
+	ldy     #$7C
+	jsr     staxysp
+	lda     #$78
+	jsr     leaa0sp
+	ldy     #$7A
+	jsr     staxysp
+	lda     #$78
+	jsr     leaa0sp
+	ldy     #$78
+	jsr     staxysp
+	lda     #$74
+	jsr     leaa0sp
+	ldy     #$76
+	jsr     staxysp
+	lda     #$74
+	jsr     leaa0sp
+	ldy     #$74
+	jsr     staxysp
+	lda     #$70
+	jsr     leaa0sp
+	ldy     #$72
+	jsr     staxysp
+	lda     #$70
+	jsr     leaa0sp
+	ldy     #$70
+	jsr     staxysp
+	lda     #$6C
+	jsr     leaa0sp
+	ldy     #$6E
+	jsr     staxysp
+	lda     #$6C
+	jsr     leaa0sp
+	ldy     #$6C
+	jsr     staxysp
+	lda     #$68
+	jsr     leaa0sp
+	ldy     #$6A
+	jsr     staxysp
+	lda     #$68
+	jsr     leaa0sp
+	ldy     #$68
+	jsr     staxysp
+	lda     #$64
+	jsr     leaa0sp
+	ldy     #$66
+	jsr     staxysp
+	lda     #$64
+	jsr     leaa0sp
+	ldy     #$64
+	jsr     staxysp
+	lda     #$60
+	jsr     leaa0sp
+	ldy     #$62
+	jsr     staxysp
+	lda     #$60
+	jsr     leaa0sp
+	ldy     #$60
+	jsr     staxysp
+	lda     #$5C
+	jsr     leaa0sp
+	ldy     #$5E
+	jsr     staxysp
+	lda     #$5C
+	jsr     leaa0sp
+	ldy     #$5C
+	jsr     staxysp
+	lda     #$58
+	jsr     leaa0sp
+	ldy     #$5A
+	jsr     staxysp
+	lda     #$58
+	jsr     leaa0sp
+	ldy     #$58
+	jsr     staxysp
+	lda     #$54
+	jsr     leaa0sp
+	ldy     #$56
+	jsr     staxysp
+	lda     #$54
+	jsr     leaa0sp
+	ldy     #$54
+	jsr     staxysp
+	lda     #$50
+	jsr     leaa0sp
+	ldy     #$52
+	jsr     staxysp
+	lda     #$50
+	jsr     leaa0sp
+	ldy     #$50
+	jsr     staxysp
+	lda     #$4C
+	jsr     leaa0sp
+	ldy     #$4E
+	jsr     staxysp
+	lda     #$4C
+	jsr     leaa0sp
+	ldy     #$4C
+	jsr     staxysp
+	lda     #$48
+	jsr     leaa0sp
+	ldy     #$4A
+	jsr     staxysp
+	lda     #$48
+	jsr     leaa0sp
+	ldy     #$48
+	jsr     staxysp
+	lda     #$44
+	jsr     leaa0sp
+	ldy     #$46
+	jsr     staxysp
+	lda     #$44
+	jsr     leaa0sp
+	ldy     #$44
+	jsr     staxysp
+	lda     #$40
+	jsr     leaa0sp
+	ldy     #$42
+	jsr     staxysp
+	lda     #$40
+	jsr     leaa0sp
+	ldy     #$40
+	jsr     staxysp
+	lda     #$3C
+	jsr     leaa0sp
+	ldy     #$3E
+	jsr     staxysp
+	lda     #$3C
+	jsr     leaa0sp
+	ldy     #$3C
+	jsr     staxysp
+	lda     #$3A
+	jsr     leaa0sp
+	ldy     #$3A
+	jsr     staxysp
+	lda     #$38
+	jsr     leaa0sp
+	ldy     #$38
+	jsr     staxysp
+	lda     #$36
+	jsr     leaa0sp
+	ldy     #$36
+	jsr     staxysp
+	lda     #$80
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$84
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	jsr     stax0sp
+	lda     #$7E
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$82
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	ldy     #$02
+	jsr     staxysp
+	lda     #$7C
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$80
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	ldy     #$04
+	jsr     staxysp
+	lda     #$78
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$7E
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	ldy     #$06
+	jsr     staxysp
+	lda     #$74
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$7A
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	ldy     #$08
+	jsr     staxysp
+	lda     #$70
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$76
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	ldy     #$0A
+	jsr     staxysp
+	lda     #$6C
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$72
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	ldy     #$0C
+	jsr     staxysp
+	lda     #$68
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$6E
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$64
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$6A
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	ldy     #$10
+	jsr     staxysp
+	lda     #$60
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$66
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	ldy     #$12
+	jsr     staxysp
+	lda     #$5C
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$62
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	ldy     #$14
+	jsr     staxysp
+	lda     #$58
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$5E
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	ldy     #$16
+	jsr     staxysp
+	lda     #$54
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$5A
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	ldy     #$18
+	jsr     staxysp
+	lda     #$50
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$56
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$4C
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$52
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	ldy     #$1C
+	jsr     staxysp
+	lda     #$48
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$4E
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$44
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$4A
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	ldy     #$20
+	jsr     staxysp
+	lda     #$40
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$46
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	ldy     #$22
+	jsr     staxysp
+	lda     #$3C
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$42
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	ldy     #$24
+	jsr     staxysp
+	lda     #$3A
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$3E
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	ldy     #$26
+	jsr     staxysp
+	lda     #$38
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$3C
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	ldy     #$28
+	jsr     staxysp
+	lda     #$36
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$3A
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	ldy     #$2A
+	jsr     staxysp
+	jsr     ldax0sp
+	ldy     #$32
+	jsr     staxysp
+	ldx     #$00
+	lda     #$01
+	ldy     #$34
+	jsr     staxysp
+	txa
+	ldy     #$2C
+	jsr     staxysp
+	jmp     L0002
+L0005:	ldy     #$35
+	jsr     ldaxysp
+	cpx     #$00
+	jne     L0008
+	cmp     #$01
+	beq     L0009
+	cmp     #$02
+	beq     L000B
+	cmp     #$03
+	jeq     L000E
+	jmp     L0008
+L0009:	ldy     #$2D
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	jsr     ldaxi
+	ldy     #$32
+	cmp     (sp),y
+	bne     L0019
+	txa
+	iny
+	cmp     (sp),y
+	jeq     L0008
+L0019:	ldy     #$2D
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	jsr     ldaxi
+	ldy     #$30
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$34
+	jsr     staxysp
+	lda     #$01
+	ldy     #$2E
+	jmp     L0018
+L000B:	ldy     #$2D
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	jsr     ldaxi
+	ldy     #$32
+	cmp     (sp),y
+	bne     L000C
+	txa
+	iny
+	cmp     (sp),y
+	bne     L000C
+	ldx     #$00
+	lda     #$03
+	jmp     L001B
+L000C:	ldy     #$2D
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	jsr     ldaxi
+	ldy     #$30
+	cmp     (sp),y
+	bne     L001A
+	txa
+	iny
+	cmp     (sp),y
+	bne     L001A
+	ldy     #$2F
+	jsr     ldaxysp
+	jsr     incax1
+	ldy     #$2E
+	jmp     L0018
+L000E:	ldy     #$2D
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	jsr     ldaxi
+	ldy     #$32
+	cmp     (sp),y
+	bne     L001A
+	txa
+	iny
+	cmp     (sp),y
+	beq     L0008
+L001A:	ldx     #$00
+	lda     #$04
+L001B:	ldy     #$34
+L0018:	jsr     staxysp
+L0008:	ldy     #$2C
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L0002:	ldy     #$2D
+	jsr     ldaxysp
+	cmp     #$16
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	jmi     L0005
+	ldy     #$35
+	lda     (sp),y
+	bne     L0011
+	dey
+	lda     (sp),y
+	cmp     #$03
+	bne     L0011
+	lda     #$10
+	sec
+	ldy     #$2E
+	sbc     (sp),y
+	pha
+	lda     #$00
+	iny
+	sbc     (sp),y
+	tax
+	pla
+	jmp     L0013
+L0011:	ldx     #$FF
+	txa
+L0013:	ldy     #$84
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ regi (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_regi: near
+
+.segment	"CODE"
+
+	ldy     #$84
+	jsr     subysp
+	ldx     #$00
+	txa
+	ldy     #$82
+	jsr     staxysp
+	lda     #$01
+	ldy     #$80
+	jsr     staxysp
+	lda     #$02
+	ldy     #$7E
+	jsr     staxysp
+	lda     #$03
+	ldy     #$7C
+	jsr     staxysp
+	lda     #$04
+	ldy     #$7A
+	jsr     staxysp
+	lda     #$05
+	ldy     #$78
+	jsr     staxysp
+	lda     #$06
+	ldy     #$76
+	jsr     staxysp
+	lda     #$07
+	ldy     #$74
+	jsr     staxysp
+	lda     #$08
+	ldy     #$72
+	jsr     staxysp
+	lda     #$09
+	ldy     #$70
+	jsr     staxysp
+	lda     #$0A
+	ldy     #$6E
+	jsr     staxysp
+	lda     #$0B
+	ldy     #$6C
+	jsr     staxysp
+	lda     #$0C
+	ldy     #$6A
+	jsr     staxysp
+	lda     #$0D
+	ldy     #$68
+	jsr     staxysp
+	lda     #$0E
+	ldy     #$66
+	jsr     staxysp
+	lda     #$0F
+	ldy     #$64
+	jsr     staxysp
+	lda     #$10
+	ldy     #$62
+	jsr     staxysp
+	lda     #$11
+	ldy     #$60
+	jsr     staxysp
+	lda     #$12
+	ldy     #$5E
+	jsr     staxysp
+	lda     #$13
+	ldy     #$5C
+	jsr     staxysp
+	lda     #$14
+	ldy     #$5A
+	jsr     staxysp
+	lda     #$15
+	ldy     #$58
+	jsr     staxysp
+	lda     #$16
+	ldy     #$56
+	jsr     staxysp
+	lda     #$17
+	ldy     #$54
+	jsr     staxysp
+	lda     #$18
+	ldy     #$52
+	jsr     staxysp
+	lda     #$19
+	ldy     #$50
+	jsr     staxysp
+	lda     #$1A
+	ldy     #$4E
+	jsr     staxysp
+	lda     #$1B
+	ldy     #$4C
+	jsr     staxysp
+	lda     #$1C
+	ldy     #$4A
+	jsr     staxysp
+	lda     #$1D
+	ldy     #$48
+	jsr     staxysp
+	lda     #$1E
+	ldy     #$46
+	jsr     staxysp
+	lda     #$1F
+	ldy     #$44
+	jsr     staxysp
+	lda     #$20
+	ldy     #$42
+	jsr     staxysp
+	lda     #$21
+	ldy     #$40
+	jsr     staxysp
+	lda     #$22
+	ldy     #$3E
+	jsr     staxysp
+	lda     #$23
+	ldy     #$3C
+	jsr     staxysp
+	lda     #$24
+	ldy     #$3A
+	jsr     staxysp
+	lda     #$25
+	ldy     #$38
+	jsr     staxysp
+	lda     #$26
+	ldy     #$36
+	jsr     staxysp
+	lda     #$80
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$84
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	jsr     stax0sp
+	lda     #$7E
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$82
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	ldy     #$02
+	jsr     staxysp
+	lda     #$7C
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$80
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	ldy     #$04
+	jsr     staxysp
+	lda     #$78
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$7E
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	ldy     #$06
+	jsr     staxysp
+	lda     #$74
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$7A
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	ldy     #$08
+	jsr     staxysp
+	lda     #$70
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$76
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	ldy     #$0A
+	jsr     staxysp
+	lda     #$6C
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$72
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	ldy     #$0C
+	jsr     staxysp
+	lda     #$68
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$6E
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	ldy     #$0E
+	jsr     staxysp
+	lda     #$64
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$6A
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	ldy     #$10
+	jsr     staxysp
+	lda     #$60
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$66
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	ldy     #$12
+	jsr     staxysp
+	lda     #$5C
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$62
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	ldy     #$14
+	jsr     staxysp
+	lda     #$58
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$5E
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	ldy     #$16
+	jsr     staxysp
+	lda     #$54
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$5A
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	ldy     #$18
+	jsr     staxysp
+	lda     #$50
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$56
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	ldy     #$1A
+	jsr     staxysp
+	lda     #$4C
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$52
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	ldy     #$1C
+	jsr     staxysp
+	lda     #$48
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$4E
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	ldy     #$1E
+	jsr     staxysp
+	lda     #$44
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$4A
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	ldy     #$20
+	jsr     staxysp
+	lda     #$40
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$46
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	ldy     #$22
+	jsr     staxysp
+	lda     #$3C
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$42
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	ldy     #$24
+	jsr     staxysp
+	lda     #$3A
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$3E
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	ldy     #$26
+	jsr     staxysp
+	lda     #$38
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$3C
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	ldy     #$28
+	jsr     staxysp
+	lda     #$36
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$3A
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	lda     #$02
+	jsr     tosdiva0
+	ldy     #$2A
+	jsr     staxysp
+	jsr     ldax0sp
+	ldy     #$32
+	jsr     staxysp
+	ldx     #$00
+	lda     #$01
+	ldy     #$34
+	jsr     staxysp
+	txa
+	ldy     #$2C
+	jsr     staxysp
+	jmp     L0002
+L0005:	ldy     #$35
+	jsr     ldaxysp
+	cpx     #$00
+	jne     L0008
+	cmp     #$01
+	beq     L0009
+	cmp     #$02
+	beq     L000B
+	cmp     #$03
+	jeq     L000E
+	jmp     L0008
+L0009:	ldy     #$2D
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	jsr     ldaxi
+	ldy     #$32
+	cmp     (sp),y
+	bne     L0019
+	txa
+	iny
+	cmp     (sp),y
+	jeq     L0008
+L0019:	ldy     #$2D
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	jsr     ldaxi
+	ldy     #$30
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$34
+	jsr     staxysp
+	lda     #$01
+	ldy     #$2E
+	jmp     L0018
+L000B:	ldy     #$2D
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	jsr     ldaxi
+	ldy     #$32
+	cmp     (sp),y
+	bne     L000C
+	txa
+	iny
+	cmp     (sp),y
+	bne     L000C
+	ldx     #$00
+	lda     #$03
+	jmp     L001B
+L000C:	ldy     #$2D
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	jsr     ldaxi
+	ldy     #$30
+	cmp     (sp),y
+	bne     L001A
+	txa
+	iny
+	cmp     (sp),y
+	bne     L001A
+	ldy     #$2F
+	jsr     ldaxysp
+	jsr     incax1
+	ldy     #$2E
+	jmp     L0018
+L000E:	ldy     #$2D
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	jsr     ldaxi
+	ldy     #$32
+	cmp     (sp),y
+	bne     L001A
+	txa
+	iny
+	cmp     (sp),y
+	beq     L0008
+L001A:	ldx     #$00
+	lda     #$04
+L001B:	ldy     #$34
+L0018:	jsr     staxysp
+L0008:	ldy     #$2C
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L0002:	ldy     #$2D
+	jsr     ldaxysp
+	cmp     #$16
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	jmi     L0005
+	ldy     #$35
+	lda     (sp),y
+	bne     L0011
+	dey
+	lda     (sp),y
+	cmp     #$03
+	bne     L0011
+	lda     #$10
+	sec
+	ldy     #$2E
+	sbc     (sp),y
+	pha
+	lda     #$00
+	iny
+	sbc     (sp),y
+	tax
+	pla
+	jmp     L0013
+L0011:	ldx     #$FF
+	txa
+L0013:	ldy     #$84
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ s81 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s81: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$1A
+	jsr     subysp
+	ldx     #$00
+	txa
+	ldy     #$12
+	jsr     staxysp
+	ldy     #$0E
+	jsr     staxysp
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$0A
+	jsr     staxysp
+	lda     #<(M0002)
+	ldx     #>(M0002)
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$1B
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     incaxy
+	ldy     #$16
+	jsr     staxysp
+L0002:	ldy     #$17
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$19
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	sta     (sreg),y
+	tax
+	php
+	ldy     #$16
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$18
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	bne     L0002
+	ldx     #$00
+	lda     #$01
+	ldy     #$14
+	jsr     staxysp
+	txa
+	ldy     #$10
+	jsr     staxysp
+	jmp     L0005
+L0008:	ldy     #$14
+	lda     (sp),y
+	ldy     #$09
+	sta     (sp),y
+	ldy     #$14
+	lda     (sp),y
+	ldy     #$08
+	sta     (sp),y
+	lda     #$14
+	jsr     leaa0sp
+	ldy     #$06
+	jsr     staxysp
+	lda     #$14
+	jsr     leaa0sp
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$15
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$15
+	jsr     ldaxysp
+	jsr     stax0sp
+	ldy     #$09
+	lda     (sp),y
+	dey
+	cmp     (sp),y
+	beq     L000A
+	ldx     #$00
+	lda     #$01
+	ldy     #$0E
+	jsr     staxysp
+L000A:	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$04
+	cmp     (sp),y
+	bne     L002A
+	txa
+	iny
+	cmp     (sp),y
+	beq     L000B
+L002A:	ldx     #$00
+	lda     #$01
+	ldy     #$0C
+	jsr     staxysp
+L000B:	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$00
+	cmp     (sp),y
+	bne     L002B
+	txa
+	iny
+	cmp     (sp),y
+	beq     L000C
+L002B:	ldx     #$00
+	lda     #$01
+	ldy     #$0A
+	jsr     staxysp
+L000C:	ldy     #$15
+	jsr     ldaxysp
+	jsr     aslax1
+	ldy     #$14
+	jsr     staxysp
+	ldy     #$10
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L0005:	ldy     #$11
+	jsr     ldaxysp
+	cmp     #$32
+	txa
+	sbc     #$00
+	bvc     L0009
+	eor     #$80
+L0009:	jmi     L0008
+	ldy     #$0E
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L000F
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     incax1
+	ldy     #$12
+	jsr     staxysp
+	ldy     #$1B
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L002C
+	cmp     #$00
+	beq     L000F
+L002C:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L000F:	ldy     #$0C
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L0013
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     incax2
+	ldy     #$12
+	jsr     staxysp
+	ldy     #$1B
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L002D
+	cmp     #$00
+	beq     L0013
+L002D:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$02
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L0013:	ldy     #$0A
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L0017
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     incax4
+	ldy     #$12
+	jsr     staxysp
+	ldy     #$1B
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L002E
+	cmp     #$00
+	beq     L0017
+L002E:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	tay
+	jsr     _printf
+L0017:	jsr     _regc
+	ldy     #$14
+	jsr     staxysp
+	ldy     #$1B
+	jsr     ldaxysp
+	ldy     #$11
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L002F
+	cmp     #$00
+	beq     L001C
+L002F:	ldy     #$15
+	jsr     ldaxysp
+	cpx     #$80
+	bcc     L001B
+	lda     #<(M0003)
+	ldx     #>(M0003)
+	jsr     pushax
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$04
+	jmp     L0027
+L001B:	lda     #<(M0004)
+	ldx     #>(M0004)
+	jsr     pushax
+	ldy     #$19
+	jsr     pushwysp
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$06
+L0027:	jsr     _printf
+L001C:	jsr     _regp
+	ldy     #$14
+	jsr     staxysp
+	ldy     #$1B
+	jsr     ldaxysp
+	ldy     #$11
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0030
+	cmp     #$00
+	beq     L0020
+L0030:	ldy     #$15
+	jsr     ldaxysp
+	cpx     #$80
+	bcc     L001F
+	lda     #<(M0003)
+	ldx     #>(M0003)
+	jsr     pushax
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$04
+	jmp     L0028
+L001F:	lda     #<(M0004)
+	ldx     #>(M0004)
+	jsr     pushax
+	ldy     #$19
+	jsr     pushwysp
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$06
+L0028:	jsr     _printf
+L0020:	jsr     _regi
+	ldy     #$14
+	jsr     staxysp
+	ldy     #$1B
+	jsr     ldaxysp
+	ldy     #$11
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0031
+	cmp     #$00
+	beq     L0024
+L0031:	ldy     #$15
+	jsr     ldaxysp
+	cpx     #$80
+	bcc     L0023
+	lda     #<(M0003)
+	ldx     #>(M0003)
+	jsr     pushax
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldy     #$04
+	jmp     L0029
+L0023:	lda     #<(M0004)
+	ldx     #>(M0004)
+	jsr     pushax
+	ldy     #$19
+	jsr     pushwysp
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldy     #$06
+L0029:	jsr     _printf
+L0024:	ldy     #$13
+	jsr     ldaxysp
+	ldy     #$1C
+	jmp     addysp
+
+.segment	"DATA"
+
+M0001:
+	.byte	$73,$38,$31,$2C,$65,$72,$25,$64,$0A,$00
+M0002:
+	.byte	$73,$38,$31,$20,$20,$20,$20,$00
+M0003:
+	.byte	$52,$65,$67,$69,$73,$74,$65,$72,$20,$63,$6F,$75,$6E,$74,$20,$66
+	.byte	$6F,$72,$20,$25,$73,$20,$69,$73,$20,$75,$6E,$72,$65,$6C,$69,$61
+	.byte	$62,$6C,$65,$2E,$0A,$00
+M0004:
+	.byte	$25,$64,$20,$72,$65,$67,$69,$73,$74,$65,$72,$73,$20,$61,$73,$73
+	.byte	$69,$67,$6E,$65,$64,$20,$74,$6F,$20,$25,$73,$20,$76,$61,$72,$69
+	.byte	$61,$62,$6C,$65,$73,$2E,$0A,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ section (int j, void *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_section: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$02
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	bne     L0003
+	jsr     ldax0sp
+	jsr     _s81
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	ldx     #$00
+	lda     #$01
+	sta     M0001+14
+	stx     M0001+14+1
+	sta     M0001+16
+	stx     M0001+16+1
+	sta     M0001+18
+	stx     M0001+18+1
+	sta     M0001+20
+	stx     M0001+20+1
+	lda     #>(M0001)
+	sta     M0002+1
+	lda     #<(M0001)
+	sta     M0002
+	txa
+	jsr     stax0sp
+	jmp     L0002
+L0005:	jsr     pushw0sp
+	lda     M0002
+	ldx     M0002+1
+	jsr     _section
+	sta     M0001+22
+	stx     M0001+22+1
+	lda     M0001+24
+	clc
+	adc     M0001+22
+	sta     M0001+24
+	lda     M0001+24+1
+	adc     M0001+22+1
+	sta     M0001+24+1
+	lda     M0001+14
+	ora     M0001+14+1
+	beq     L0007
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	lda     #<(M0001+26)
+	ldx     #>(M0001+26)
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+L0007:	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+L0002:	jsr     ldax0sp
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	bmi     L0005
+	lda     M0001+24
+	ora     M0001+24+1
+	bne     L0009
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jmp     L000E
+L0009:	lda     #<(S000D)
+	ldx     #>(S000D)
+L000E:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     M0001+24
+	ldx     M0001+24+1
+	jmp     incsp6
+
+.segment	"BSS"
+
+M0001:
+	.res	34,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
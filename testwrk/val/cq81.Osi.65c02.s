@@ -0,0 +1,3746 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_printf
+	.export		_lbits
+	.export		_ubits
+	.export		_fbits
+	.export		_dbits
+	.export		_flgs
+	.export		_flgm
+	.export		_flgd
+	.export		_flgl
+	.export		_rrc
+	.export		_crc
+	.export		_rfs
+	.export		_regc
+	.export		_regp
+	.export		_regi
+	.export		_s81
+	.export		_section
+	.export		_main
+
+.segment	"RODATA"
+
+S000B:
+	.byte	$53,$65,$63,$74,$69,$6F,$6E,$20,$25,$73,$20,$72,$65,$74,$75,$72
+	.byte	$6E,$65,$64,$20,$25,$64,$2E,$0A,$00
+S000C:
+	.byte	$0A,$4E,$6F,$20,$65,$72,$72,$6F,$72,$73,$20,$64,$65,$74,$65,$63
+	.byte	$74,$65,$64,$2E,$0A,$00
+S000D:
+	.byte	$0A,$46,$61,$69,$6C,$65,$64,$2E,$0A,$00
+S0008:
+	.byte	$70,$6F,$69,$6E,$74,$65,$72,$00
+S0007	:=	S0008+0
+S0006:
+	.byte	$63,$68,$61,$72,$00
+S0005	:=	S0006+0
+S0009:
+	.byte	$69,$6E,$74,$00
+S000A	:=	S0009+0
+
+.segment	"BSS"
+
+_lbits:
+	.res	2,$00
+_ubits:
+	.res	2,$00
+_fbits:
+	.res	2,$00
+_dbits:
+	.res	2,$00
+_flgs:
+	.res	2,$00
+_flgm:
+	.res	2,$00
+_flgd:
+	.res	2,$00
+_flgl:
+	.res	2,$00
+_rrc:
+	.res	2,$00
+_crc:
+	.res	2,$00
+_rfs:
+	.res	8,$00
+
+; ---------------------------------------------------------------
+; int __near__ regc (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_regc: near
+
+.segment	"CODE"
+
+	ldy     #$5D
+	jsr     subysp
+	lda     #$00
+	ldy     #$5C
+	sta     (sp),y
+	ina
+	dey
+	sta     (sp),y
+	ina
+	dey
+	sta     (sp),y
+	ina
+	dey
+	sta     (sp),y
+	ina
+	dey
+	sta     (sp),y
+	ina
+	dey
+	sta     (sp),y
+	ina
+	dey
+	sta     (sp),y
+	ina
+	dey
+	sta     (sp),y
+	ina
+	dey
+	sta     (sp),y
+	ina
+	dey
+	sta     (sp),y
+	ina
+	dey
+	sta     (sp),y
+	ina
+	dey
+	sta     (sp),y
+	ina
+	dey
+	sta     (sp),y
+	ina
+	dey
+	sta     (sp),y
+	ina
+	dey
+	sta     (sp),y
+	ina
+	dey
+	sta     (sp),y
+	ina
+	dey
+	sta     (sp),y
+	ina
+	dey
+	sta     (sp),y
+	ina
+	dey
+	sta     (sp),y
+	ina
+	dey
+	sta     (sp),y
+	ina
+	dey
+	sta     (sp),y
+	ina
+	dey
+	sta     (sp),y
+	ina
+	dey
+	sta     (sp),y
+	ina
+	dey
+	sta     (sp),y
+	ina
+	dey
+	sta     (sp),y
+	ina
+	dey
+	sta     (sp),y
+	ina
+	dey
+	sta     (sp),y
+	ina
+	dey
+	sta     (sp),y
+	ina
+	dey
+	sta     (sp),y
+	ina
+	dey
+	sta     (sp),y
+	ina
+	dey
+	sta     (sp),y
+	ina
+	dey
+	sta     (sp),y
+	ina
+	dey
+	sta     (sp),y
+	ina
+	dey
+	sta     (sp),y
+	ina
+	dey
+	sta     (sp),y
+	ina
+	dey
+	sta     (sp),y
+	ina
+	dey
+	sta     (sp),y
+	ina
+	dey
+	sta     (sp),y
+	ina
+	dey
+	sta     (sp),y
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$5B
+	bcc     L0002
+	inx
+L0002:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$5E
+	bcc     L0003
+	inx
+L0003:	jsr     tossubax
+	jsr     stax0sp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$5A
+	bcc     L0004
+	inx
+L0004:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$5D
+	bcc     L0005
+	inx
+L0005:	jsr     tossubax
+	ldy     #$02
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$59
+	bcc     L0006
+	inx
+L0006:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$5C
+	bcc     L0007
+	inx
+L0007:	jsr     tossubax
+	ldy     #$04
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$57
+	bcc     L0008
+	inx
+L0008:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$5B
+	bcc     L0009
+	inx
+L0009:	jsr     tossubax
+	ldy     #$06
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$55
+	bcc     L000A
+	inx
+L000A:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$59
+	bcc     L000B
+	inx
+L000B:	jsr     tossubax
+	ldy     #$08
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$53
+	bcc     L000C
+	inx
+L000C:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$57
+	bcc     L000D
+	inx
+L000D:	jsr     tossubax
+	ldy     #$0A
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$51
+	bcc     L000E
+	inx
+L000E:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$55
+	bcc     L000F
+	inx
+L000F:	jsr     tossubax
+	ldy     #$0C
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$4F
+	bcc     L0010
+	inx
+L0010:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$53
+	bcc     L0011
+	inx
+L0011:	jsr     tossubax
+	ldy     #$0E
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$4D
+	bcc     L0012
+	inx
+L0012:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$51
+	bcc     L0013
+	inx
+L0013:	jsr     tossubax
+	ldy     #$10
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$4B
+	bcc     L0014
+	inx
+L0014:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$4F
+	bcc     L0015
+	inx
+L0015:	jsr     tossubax
+	ldy     #$12
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$49
+	bcc     L0016
+	inx
+L0016:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$4D
+	bcc     L0017
+	inx
+L0017:	jsr     tossubax
+	ldy     #$14
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$47
+	bcc     L0018
+	inx
+L0018:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$4B
+	bcc     L0019
+	inx
+L0019:	jsr     tossubax
+	ldy     #$16
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$45
+	bcc     L001A
+	inx
+L001A:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$49
+	bcc     L001B
+	inx
+L001B:	jsr     tossubax
+	ldy     #$18
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$43
+	bcc     L001C
+	inx
+L001C:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$47
+	bcc     L001D
+	inx
+L001D:	jsr     tossubax
+	ldy     #$1A
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$41
+	bcc     L001E
+	inx
+L001E:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$45
+	bcc     L001F
+	inx
+L001F:	jsr     tossubax
+	ldy     #$1C
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$3F
+	bcc     L0020
+	inx
+L0020:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$43
+	bcc     L0021
+	inx
+L0021:	jsr     tossubax
+	ldy     #$1E
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$3D
+	bcc     L0022
+	inx
+L0022:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$41
+	bcc     L0023
+	inx
+L0023:	jsr     tossubax
+	ldy     #$20
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$3B
+	bcc     L0024
+	inx
+L0024:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$3F
+	bcc     L0025
+	inx
+L0025:	jsr     tossubax
+	ldy     #$22
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$39
+	bcc     L0026
+	inx
+L0026:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$3D
+	bcc     L0027
+	inx
+L0027:	jsr     tossubax
+	ldy     #$24
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$38
+	bcc     L0028
+	inx
+L0028:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$3B
+	bcc     L0029
+	inx
+L0029:	jsr     tossubax
+	ldy     #$26
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$37
+	bcc     L002A
+	inx
+L002A:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$3A
+	bcc     L002B
+	inx
+L002B:	jsr     tossubax
+	ldy     #$28
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$36
+	bcc     L002C
+	inx
+L002C:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$39
+	bcc     L002D
+	inx
+L002D:	jsr     tossubax
+	ldy     #$2A
+	jsr     staxysp
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	ldy     #$32
+	jsr     staxysp
+	ldy     #$34
+	lda     #$01
+	sta     (sp),y
+	dea
+	iny
+	sta     (sp),y
+	ldy     #$2C
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L0046
+L0031:	ldy     #$35
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cpx     #$00
+	jne     L0034
+	cmp     #$01
+	beq     L0035
+	cmp     #$02
+	beq     L0037
+	cmp     #$03
+	jeq     L003B
+	jmp     L0034
+L0035:	ldy     #$2D
+	lda     (sp),y
+	sta     tmp1
+	dey
+	lda     (sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     sp
+	sta     ptr1
+	lda     tmp1
+	adc     sp+1
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	ldy     #$32
+	cmp     (sp),y
+	bne     L0047
+	txa
+	iny
+	cmp     (sp),y
+	jeq     L0034
+L0047:	ldy     #$2D
+	lda     (sp),y
+	sta     tmp1
+	dey
+	lda     (sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     sp
+	sta     ptr1
+	lda     tmp1
+	adc     sp+1
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	ldy     #$30
+	jsr     staxysp
+	ldy     #$34
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$2E
+	ina
+	sta     (sp),y
+	dea
+	jmp     L004D
+L0037:	ldy     #$2D
+	lda     (sp),y
+	sta     tmp1
+	dey
+	lda     (sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     sp
+	sta     ptr1
+	lda     tmp1
+	adc     sp+1
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	ldy     #$32
+	cmp     (sp),y
+	bne     L0038
+	txa
+	iny
+	cmp     (sp),y
+	bne     L0038
+	iny
+	lda     #$03
+	bra     L004B
+L0038:	ldy     #$2D
+	lda     (sp),y
+	sta     tmp1
+	dey
+	lda     (sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     sp
+	sta     ptr1
+	lda     tmp1
+	adc     sp+1
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	ldy     #$30
+	cmp     (sp),y
+	bne     L0048
+	txa
+	iny
+	cmp     (sp),y
+	bne     L0048
+	ldy     #$2F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ina
+	bne     L003A
+	inx
+L003A:	jsr     staxysp
+	bra     L0034
+L003B:	ldy     #$2D
+	lda     (sp),y
+	sta     tmp1
+	dey
+	lda     (sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     sp
+	sta     ptr1
+	lda     tmp1
+	adc     sp+1
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	ldy     #$32
+	cmp     (sp),y
+	bne     L0048
+	txa
+	iny
+	cmp     (sp),y
+	beq     L0034
+L0048:	ldy     #$34
+	lda     #$04
+L004B:	sta     (sp),y
+	lda     #$00
+L004D:	iny
+	sta     (sp),y
+L0034:	ldy     #$2C
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$2D
+L0046:	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cmp     #$16
+	txa
+	sbc     #$00
+	bvc     L0032
+	eor     #$80
+L0032:	jmi     L0031
+	ldy     #$35
+	lda     (sp),y
+	bne     L003E
+	dey
+	lda     (sp),y
+	cmp     #$03
+	bne     L003E
+	lda     #$10
+	sec
+	ldy     #$2E
+	sbc     (sp),y
+	pha
+	lda     #$00
+	iny
+	sbc     (sp),y
+	tax
+	pla
+	bra     L0040
+L003E:	ldx     #$FF
+	txa
+L0040:	ldy     #$5D
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ regp (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_regp: near
+
+.segment	"CODE"
+
+	ldy     #$84
+	jsr     subysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$82
+	bcc     L0002
+	inx
+L0002:	ldy     #$82
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$80
+	bcc     L0003
+	inx
+L0003:	ldy     #$80
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$7E
+	bcc     L0004
+	inx
+L0004:	ldy     #$7E
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$7C
+	bcc     L0005
+	inx
+L0005:	ldy     #$7C
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$78
+	bcc     L0006
+	inx
+L0006:	ldy     #$7A
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$78
+	bcc     L0007
+	inx
+L0007:	ldy     #$78
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$74
+	bcc     L0008
+	inx
+L0008:	ldy     #$76
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$74
+	bcc     L0009
+	inx
+L0009:	ldy     #$74
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$70
+	bcc     L000A
+	inx
+L000A:	ldy     #$72
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$70
+	bcc     L000B
+	inx
+L000B:	ldy     #$70
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$6C
+	bcc     L000C
+	inx
+L000C:	ldy     #$6E
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$6C
+	bcc     L000D
+	inx
+L000D:	ldy     #$6C
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$68
+	bcc     L000E
+	inx
+L000E:	ldy     #$6A
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$68
+	bcc     L000F
+	inx
+L000F:	ldy     #$68
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$64
+	bcc     L0010
+	inx
+L0010:	ldy     #$66
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$64
+	bcc     L0011
+	inx
+L0011:	ldy     #$64
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$60
+	bcc     L0012
+	inx
+L0012:	ldy     #$62
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$60
+	bcc     L0013
+	inx
+L0013:	ldy     #$60
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$5C
+	bcc     L0014
+	inx
+L0014:	ldy     #$5E
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$5C
+	bcc     L0015
+	inx
+L0015:	ldy     #$5C
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$58
+	bcc     L0016
+	inx
+L0016:	ldy     #$5A
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$58
+	bcc     L0017
+	inx
+L0017:	ldy     #$58
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$54
+	bcc     L0018
+	inx
+L0018:	ldy     #$56
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$54
+	bcc     L0019
+	inx
+L0019:	ldy     #$54
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$50
+	bcc     L001A
+	inx
+L001A:	ldy     #$52
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$50
+	bcc     L001B
+	inx
+L001B:	ldy     #$50
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$4C
+	bcc     L001C
+	inx
+L001C:	ldy     #$4E
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$4C
+	bcc     L001D
+	inx
+L001D:	ldy     #$4C
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$48
+	bcc     L001E
+	inx
+L001E:	ldy     #$4A
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$48
+	bcc     L001F
+	inx
+L001F:	ldy     #$48
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$44
+	bcc     L0020
+	inx
+L0020:	ldy     #$46
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$44
+	bcc     L0021
+	inx
+L0021:	ldy     #$44
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$40
+	bcc     L0022
+	inx
+L0022:	ldy     #$42
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$40
+	bcc     L0023
+	inx
+L0023:	ldy     #$40
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$3C
+	bcc     L0024
+	inx
+L0024:	ldy     #$3E
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$3C
+	bcc     L0025
+	inx
+L0025:	ldy     #$3C
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$3A
+	bcc     L0026
+	inx
+L0026:	ldy     #$3A
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$38
+	bcc     L0027
+	inx
+L0027:	ldy     #$38
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$36
+	bcc     L0028
+	inx
+L0028:	ldy     #$36
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$80
+	bcc     L0029
+	inx
+L0029:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$84
+	bcc     L002A
+	inx
+L002A:	jsr     tossubax
+	cpx     #$00
+	bpl     L002B
+	sta     regsave
+	stx     regsave+1
+	cpx     #$FF
+	bne     L002D
+	cmp     #$FF
+L002D:	jsr     boolult
+	lsr     a
+	lda     regsave
+	ldx     regsave+1
+	bcs     L002B
+	ldx     #$00
+	txa
+	bra     L002C
+L002B:	jsr     asrax1
+L002C:	jsr     stax0sp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$7E
+	bcc     L002E
+	inx
+L002E:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$82
+	bcc     L002F
+	inx
+L002F:	jsr     tossubax
+	cpx     #$00
+	bpl     L0030
+	sta     regsave
+	stx     regsave+1
+	cpx     #$FF
+	bne     L0032
+	cmp     #$FF
+L0032:	jsr     boolult
+	lsr     a
+	lda     regsave
+	ldx     regsave+1
+	bcs     L0030
+	ldx     #$00
+	txa
+	bra     L0031
+L0030:	jsr     asrax1
+L0031:	ldy     #$02
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$7C
+	bcc     L0033
+	inx
+L0033:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$80
+	bcc     L0034
+	inx
+L0034:	jsr     tossubax
+	cpx     #$00
+	bpl     L0035
+	sta     regsave
+	stx     regsave+1
+	cpx     #$FF
+	bne     L0037
+	cmp     #$FF
+L0037:	jsr     boolult
+	lsr     a
+	lda     regsave
+	ldx     regsave+1
+	bcs     L0035
+	ldx     #$00
+	txa
+	bra     L0036
+L0035:	jsr     asrax1
+L0036:	ldy     #$04
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$78
+	bcc     L0038
+	inx
+L0038:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$7E
+	bcc     L0039
+	inx
+L0039:	jsr     tossubax
+	cpx     #$00
+	bpl     L003A
+	sta     regsave
+	stx     regsave+1
+	cpx     #$FF
+	bne     L003C
+	cmp     #$FF
+L003C:	jsr     boolult
+	lsr     a
+	lda     regsave
+	ldx     regsave+1
+	bcs     L003A
+	ldx     #$00
+	txa
+	bra     L003B
+L003A:	jsr     asrax1
+L003B:	ldy     #$06
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$74
+	bcc     L003D
+	inx
+L003D:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$7A
+	bcc     L003E
+	inx
+L003E:	jsr     tossubax
+	cpx     #$00
+	bpl     L003F
+	sta     regsave
+	stx     regsave+1
+	cpx     #$FF
+	bne     L0041
+	cmp     #$FF
+L0041:	jsr     boolult
+	lsr     a
+	lda     regsave
+	ldx     regsave+1
+	bcs     L003F
+	ldx     #$00
+	txa
+	bra     L0040
+L003F:	jsr     asrax1
+L0040:	ldy     #$08
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$70
+	bcc     L0042
+	inx
+L0042:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$76
+	bcc     L0043
+	inx
+L0043:	jsr     tossubax
+	cpx     #$00
+	bpl     L0044
+	sta     regsave
+	stx     regsave+1
+	cpx     #$FF
+	bne     L0046
+	cmp     #$FF
+L0046:	jsr     boolult
+	lsr     a
+	lda     regsave
+	ldx     regsave+1
+	bcs     L0044
+	ldx     #$00
+	txa
+	bra     L0045
+L0044:	jsr     asrax1
+L0045:	ldy     #$0A
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$6C
+	bcc     L0047
+	inx
+L0047:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$72
+	bcc     L0048
+	inx
+L0048:	jsr     tossubax
+	cpx     #$00
+	bpl     L0049
+	sta     regsave
+	stx     regsave+1
+	cpx     #$FF
+	bne     L004B
+	cmp     #$FF
+L004B:	jsr     boolult
+	lsr     a
+	lda     regsave
+	ldx     regsave+1
+	bcs     L0049
+	ldx     #$00
+	txa
+	bra     L004A
+L0049:	jsr     asrax1
+L004A:	ldy     #$0C
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$68
+	bcc     L004C
+	inx
+L004C:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$6E
+	bcc     L004D
+	inx
+L004D:	jsr     tossubax
+	cpx     #$00
+	bpl     L004E
+	sta     regsave
+	stx     regsave+1
+	cpx     #$FF
+	bne     L0050
+	cmp     #$FF
+L0050:	jsr     boolult
+	lsr     a
+	lda     regsave
+	ldx     regsave+1
+	bcs     L004E
+	ldx     #$00
+	txa
+	bra     L004F
+L004E:	jsr     asrax1
+L004F:	ldy     #$0E
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$64
+	bcc     L0051
+	inx
+L0051:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$6A
+	bcc     L0052
+	inx
+L0052:	jsr     tossubax
+	cpx     #$00
+	bpl     L0053
+	sta     regsave
+	stx     regsave+1
+	cpx     #$FF
+	bne     L0055
+	cmp     #$FF
+L0055:	jsr     boolult
+	lsr     a
+	lda     regsave
+	ldx     regsave+1
+	bcs     L0053
+	ldx     #$00
+	txa
+	bra     L0054
+L0053:	jsr     asrax1
+L0054:	ldy     #$10
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$60
+	bcc     L0056
+	inx
+L0056:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$66
+	bcc     L0057
+	inx
+L0057:	jsr     tossubax
+	cpx     #$00
+	bpl     L0058
+	sta     regsave
+	stx     regsave+1
+	cpx     #$FF
+	bne     L005A
+	cmp     #$FF
+L005A:	jsr     boolult
+	lsr     a
+	lda     regsave
+	ldx     regsave+1
+	bcs     L0058
+	ldx     #$00
+	txa
+	bra     L0059
+L0058:	jsr     asrax1
+L0059:	ldy     #$12
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$5C
+	bcc     L005B
+	inx
+L005B:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$62
+	bcc     L005C
+	inx
+L005C:	jsr     tossubax
+	cpx     #$00
+	bpl     L005D
+	sta     regsave
+	stx     regsave+1
+	cpx     #$FF
+	bne     L005F
+	cmp     #$FF
+L005F:	jsr     boolult
+	lsr     a
+	lda     regsave
+	ldx     regsave+1
+	bcs     L005D
+	ldx     #$00
+	txa
+	bra     L005E
+L005D:	jsr     asrax1
+L005E:	ldy     #$14
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$58
+	bcc     L0060
+	inx
+L0060:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$5E
+	bcc     L0061
+	inx
+L0061:	jsr     tossubax
+	cpx     #$00
+	bpl     L0062
+	sta     regsave
+	stx     regsave+1
+	cpx     #$FF
+	bne     L0064
+	cmp     #$FF
+L0064:	jsr     boolult
+	lsr     a
+	lda     regsave
+	ldx     regsave+1
+	bcs     L0062
+	ldx     #$00
+	txa
+	bra     L0063
+L0062:	jsr     asrax1
+L0063:	ldy     #$16
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$54
+	bcc     L0065
+	inx
+L0065:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$5A
+	bcc     L0066
+	inx
+L0066:	jsr     tossubax
+	cpx     #$00
+	bpl     L0067
+	sta     regsave
+	stx     regsave+1
+	cpx     #$FF
+	bne     L0069
+	cmp     #$FF
+L0069:	jsr     boolult
+	lsr     a
+	lda     regsave
+	ldx     regsave+1
+	bcs     L0067
+	ldx     #$00
+	txa
+	bra     L0068
+L0067:	jsr     asrax1
+L0068:	ldy     #$18
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$50
+	bcc     L006A
+	inx
+L006A:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$56
+	bcc     L006B
+	inx
+L006B:	jsr     tossubax
+	cpx     #$00
+	bpl     L006C
+	sta     regsave
+	stx     regsave+1
+	cpx     #$FF
+	bne     L006E
+	cmp     #$FF
+L006E:	jsr     boolult
+	lsr     a
+	lda     regsave
+	ldx     regsave+1
+	bcs     L006C
+	ldx     #$00
+	txa
+	bra     L006D
+L006C:	jsr     asrax1
+L006D:	ldy     #$1A
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$4C
+	bcc     L006F
+	inx
+L006F:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$52
+	bcc     L0070
+	inx
+L0070:	jsr     tossubax
+	cpx     #$00
+	bpl     L0071
+	sta     regsave
+	stx     regsave+1
+	cpx     #$FF
+	bne     L0073
+	cmp     #$FF
+L0073:	jsr     boolult
+	lsr     a
+	lda     regsave
+	ldx     regsave+1
+	bcs     L0071
+	ldx     #$00
+	txa
+	bra     L0072
+L0071:	jsr     asrax1
+L0072:	ldy     #$1C
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$48
+	bcc     L0074
+	inx
+L0074:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$4E
+	bcc     L0075
+	inx
+L0075:	jsr     tossubax
+	cpx     #$00
+	bpl     L0076
+	sta     regsave
+	stx     regsave+1
+	cpx     #$FF
+	bne     L0078
+	cmp     #$FF
+L0078:	jsr     boolult
+	lsr     a
+	lda     regsave
+	ldx     regsave+1
+	bcs     L0076
+	ldx     #$00
+	txa
+	bra     L0077
+L0076:	jsr     asrax1
+L0077:	ldy     #$1E
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$44
+	bcc     L0079
+	inx
+L0079:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$4A
+	bcc     L007A
+	inx
+L007A:	jsr     tossubax
+	cpx     #$00
+	bpl     L007B
+	sta     regsave
+	stx     regsave+1
+	cpx     #$FF
+	bne     L007D
+	cmp     #$FF
+L007D:	jsr     boolult
+	lsr     a
+	lda     regsave
+	ldx     regsave+1
+	bcs     L007B
+	ldx     #$00
+	txa
+	bra     L007C
+L007B:	jsr     asrax1
+L007C:	ldy     #$20
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$40
+	bcc     L007E
+	inx
+L007E:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$46
+	bcc     L007F
+	inx
+L007F:	jsr     tossubax
+	cpx     #$00
+	bpl     L0080
+	sta     regsave
+	stx     regsave+1
+	cpx     #$FF
+	bne     L0082
+	cmp     #$FF
+L0082:	jsr     boolult
+	lsr     a
+	lda     regsave
+	ldx     regsave+1
+	bcs     L0080
+	ldx     #$00
+	txa
+	bra     L0081
+L0080:	jsr     asrax1
+L0081:	ldy     #$22
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$3C
+	bcc     L0083
+	inx
+L0083:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$42
+	bcc     L0084
+	inx
+L0084:	jsr     tossubax
+	cpx     #$00
+	bpl     L0085
+	sta     regsave
+	stx     regsave+1
+	cpx     #$FF
+	bne     L0087
+	cmp     #$FF
+L0087:	jsr     boolult
+	lsr     a
+	lda     regsave
+	ldx     regsave+1
+	bcs     L0085
+	ldx     #$00
+	txa
+	bra     L0086
+L0085:	jsr     asrax1
+L0086:	ldy     #$24
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$3A
+	bcc     L0088
+	inx
+L0088:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$3E
+	bcc     L0089
+	inx
+L0089:	jsr     tossubax
+	cpx     #$00
+	bpl     L008A
+	sta     regsave
+	stx     regsave+1
+	cpx     #$FF
+	bne     L008C
+	cmp     #$FF
+L008C:	jsr     boolult
+	lsr     a
+	lda     regsave
+	ldx     regsave+1
+	bcs     L008A
+	ldx     #$00
+	txa
+	bra     L008B
+L008A:	jsr     asrax1
+L008B:	ldy     #$26
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$38
+	bcc     L008D
+	inx
+L008D:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$3C
+	bcc     L008E
+	inx
+L008E:	jsr     tossubax
+	cpx     #$00
+	bpl     L008F
+	sta     regsave
+	stx     regsave+1
+	cpx     #$FF
+	bne     L0091
+	cmp     #$FF
+L0091:	jsr     boolult
+	lsr     a
+	lda     regsave
+	ldx     regsave+1
+	bcs     L008F
+	ldx     #$00
+	txa
+	bra     L0090
+L008F:	jsr     asrax1
+L0090:	ldy     #$28
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$36
+	bcc     L0092
+	inx
+L0092:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$3A
+	bcc     L0093
+	inx
+L0093:	jsr     tossubax
+	cpx     #$00
+	bpl     L0094
+	sta     regsave
+	stx     regsave+1
+	cpx     #$FF
+	bne     L0096
+	cmp     #$FF
+L0096:	jsr     boolult
+	lsr     a
+	lda     regsave
+	ldx     regsave+1
+	bcs     L0094
+	ldx     #$00
+	txa
+	bra     L0095
+L0094:	jsr     asrax1
+L0095:	ldy     #$2A
+	jsr     staxysp
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	ldy     #$32
+	jsr     staxysp
+	ldy     #$34
+	lda     #$01
+	sta     (sp),y
+	dea
+	iny
+	sta     (sp),y
+	ldy     #$2C
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L00AF
+L009A:	ldy     #$35
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cpx     #$00
+	jne     L009D
+	cmp     #$01
+	beq     L009E
+	cmp     #$02
+	beq     L00A0
+	cmp     #$03
+	jeq     L00A4
+	jmp     L009D
+L009E:	ldy     #$2D
+	lda     (sp),y
+	sta     tmp1
+	dey
+	lda     (sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     sp
+	sta     ptr1
+	lda     tmp1
+	adc     sp+1
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	ldy     #$32
+	cmp     (sp),y
+	bne     L00B0
+	txa
+	iny
+	cmp     (sp),y
+	jeq     L009D
+L00B0:	ldy     #$2D
+	lda     (sp),y
+	sta     tmp1
+	dey
+	lda     (sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     sp
+	sta     ptr1
+	lda     tmp1
+	adc     sp+1
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	ldy     #$30
+	jsr     staxysp
+	ldy     #$34
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$2E
+	ina
+	sta     (sp),y
+	dea
+	jmp     L00B6
+L00A0:	ldy     #$2D
+	lda     (sp),y
+	sta     tmp1
+	dey
+	lda     (sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     sp
+	sta     ptr1
+	lda     tmp1
+	adc     sp+1
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	ldy     #$32
+	cmp     (sp),y
+	bne     L00A1
+	txa
+	iny
+	cmp     (sp),y
+	bne     L00A1
+	iny
+	lda     #$03
+	bra     L00B4
+L00A1:	ldy     #$2D
+	lda     (sp),y
+	sta     tmp1
+	dey
+	lda     (sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     sp
+	sta     ptr1
+	lda     tmp1
+	adc     sp+1
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	ldy     #$30
+	cmp     (sp),y
+	bne     L00B1
+	txa
+	iny
+	cmp     (sp),y
+	bne     L00B1
+	ldy     #$2F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ina
+	bne     L00A3
+	inx
+L00A3:	jsr     staxysp
+	bra     L009D
+L00A4:	ldy     #$2D
+	lda     (sp),y
+	sta     tmp1
+	dey
+	lda     (sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     sp
+	sta     ptr1
+	lda     tmp1
+	adc     sp+1
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	ldy     #$32
+	cmp     (sp),y
+	bne     L00B1
+	txa
+	iny
+	cmp     (sp),y
+	beq     L009D
+L00B1:	ldy     #$34
+	lda     #$04
+L00B4:	sta     (sp),y
+	lda     #$00
+L00B6:	iny
+	sta     (sp),y
+L009D:	ldy     #$2C
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$2D
+L00AF:	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cmp     #$16
+	txa
+	sbc     #$00
+	bvc     L009B
+	eor     #$80
+L009B:	jmi     L009A
+	ldy     #$35
+	lda     (sp),y
+	bne     L00A7
+	dey
+	lda     (sp),y
+	cmp     #$03
+	bne     L00A7
+	lda     #$10
+	sec
+	ldy     #$2E
+	sbc     (sp),y
+	pha
+	lda     #$00
+	iny
+	sbc     (sp),y
+	tax
+	pla
+	bra     L00A9
+L00A7:	ldx     #$FF
+	txa
+L00A9:	ldy     #$84
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ regi (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_regi: near
+
+.segment	"CODE"
+
+	ldy     #$84
+	jsr     subysp
+	ldy     #$82
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$80
+	ina
+	sta     (sp),y
+	dea
+	iny
+	sta     (sp),y
+	ldy     #$7E
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$7C
+	lda     #$03
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$7A
+	lda     #$04
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$78
+	lda     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$76
+	lda     #$06
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$74
+	lda     #$07
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$72
+	lda     #$08
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$70
+	lda     #$09
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$6E
+	lda     #$0A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$6C
+	lda     #$0B
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$6A
+	lda     #$0C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$68
+	lda     #$0D
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$66
+	lda     #$0E
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$64
+	lda     #$0F
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$62
+	lda     #$10
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$60
+	lda     #$11
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$5E
+	lda     #$12
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$5C
+	lda     #$13
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$5A
+	lda     #$14
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$58
+	lda     #$15
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$56
+	lda     #$16
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$54
+	lda     #$17
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$52
+	lda     #$18
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$50
+	lda     #$19
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$4E
+	lda     #$1A
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$4C
+	lda     #$1B
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$4A
+	lda     #$1C
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$48
+	lda     #$1D
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$46
+	lda     #$1E
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$44
+	lda     #$1F
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$42
+	lda     #$20
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$40
+	lda     #$21
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$3E
+	lda     #$22
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$3C
+	lda     #$23
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$3A
+	lda     #$24
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$38
+	lda     #$25
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$36
+	lda     #$26
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$80
+	bcc     L0002
+	inx
+L0002:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$84
+	bcc     L0003
+	inx
+L0003:	jsr     tossubax
+	cpx     #$00
+	bpl     L0004
+	sta     regsave
+	stx     regsave+1
+	cpx     #$FF
+	bne     L0006
+	cmp     #$FF
+L0006:	jsr     boolult
+	lsr     a
+	lda     regsave
+	ldx     regsave+1
+	bcs     L0004
+	ldx     #$00
+	txa
+	bra     L0005
+L0004:	jsr     asrax1
+L0005:	jsr     stax0sp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$7E
+	bcc     L0007
+	inx
+L0007:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$82
+	bcc     L0008
+	inx
+L0008:	jsr     tossubax
+	cpx     #$00
+	bpl     L0009
+	sta     regsave
+	stx     regsave+1
+	cpx     #$FF
+	bne     L000B
+	cmp     #$FF
+L000B:	jsr     boolult
+	lsr     a
+	lda     regsave
+	ldx     regsave+1
+	bcs     L0009
+	ldx     #$00
+	txa
+	bra     L000A
+L0009:	jsr     asrax1
+L000A:	ldy     #$02
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$7C
+	bcc     L000C
+	inx
+L000C:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$80
+	bcc     L000D
+	inx
+L000D:	jsr     tossubax
+	cpx     #$00
+	bpl     L000E
+	sta     regsave
+	stx     regsave+1
+	cpx     #$FF
+	bne     L0010
+	cmp     #$FF
+L0010:	jsr     boolult
+	lsr     a
+	lda     regsave
+	ldx     regsave+1
+	bcs     L000E
+	ldx     #$00
+	txa
+	bra     L000F
+L000E:	jsr     asrax1
+L000F:	ldy     #$04
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$78
+	bcc     L0011
+	inx
+L0011:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$7E
+	bcc     L0012
+	inx
+L0012:	jsr     tossubax
+	cpx     #$00
+	bpl     L0013
+	sta     regsave
+	stx     regsave+1
+	cpx     #$FF
+	bne     L0015
+	cmp     #$FF
+L0015:	jsr     boolult
+	lsr     a
+	lda     regsave
+	ldx     regsave+1
+	bcs     L0013
+	ldx     #$00
+	txa
+	bra     L0014
+L0013:	jsr     asrax1
+L0014:	ldy     #$06
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$74
+	bcc     L0016
+	inx
+L0016:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$7A
+	bcc     L0017
+	inx
+L0017:	jsr     tossubax
+	cpx     #$00
+	bpl     L0018
+	sta     regsave
+	stx     regsave+1
+	cpx     #$FF
+	bne     L001A
+	cmp     #$FF
+L001A:	jsr     boolult
+	lsr     a
+	lda     regsave
+	ldx     regsave+1
+	bcs     L0018
+	ldx     #$00
+	txa
+	bra     L0019
+L0018:	jsr     asrax1
+L0019:	ldy     #$08
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$70
+	bcc     L001B
+	inx
+L001B:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$76
+	bcc     L001C
+	inx
+L001C:	jsr     tossubax
+	cpx     #$00
+	bpl     L001D
+	sta     regsave
+	stx     regsave+1
+	cpx     #$FF
+	bne     L001F
+	cmp     #$FF
+L001F:	jsr     boolult
+	lsr     a
+	lda     regsave
+	ldx     regsave+1
+	bcs     L001D
+	ldx     #$00
+	txa
+	bra     L001E
+L001D:	jsr     asrax1
+L001E:	ldy     #$0A
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$6C
+	bcc     L0020
+	inx
+L0020:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$72
+	bcc     L0021
+	inx
+L0021:	jsr     tossubax
+	cpx     #$00
+	bpl     L0022
+	sta     regsave
+	stx     regsave+1
+	cpx     #$FF
+	bne     L0024
+	cmp     #$FF
+L0024:	jsr     boolult
+	lsr     a
+	lda     regsave
+	ldx     regsave+1
+	bcs     L0022
+	ldx     #$00
+	txa
+	bra     L0023
+L0022:	jsr     asrax1
+L0023:	ldy     #$0C
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$68
+	bcc     L0025
+	inx
+L0025:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$6E
+	bcc     L0026
+	inx
+L0026:	jsr     tossubax
+	cpx     #$00
+	bpl     L0027
+	sta     regsave
+	stx     regsave+1
+	cpx     #$FF
+	bne     L0029
+	cmp     #$FF
+L0029:	jsr     boolult
+	lsr     a
+	lda     regsave
+	ldx     regsave+1
+	bcs     L0027
+	ldx     #$00
+	txa
+	bra     L0028
+L0027:	jsr     asrax1
+L0028:	ldy     #$0E
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$64
+	bcc     L002A
+	inx
+L002A:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$6A
+	bcc     L002B
+	inx
+L002B:	jsr     tossubax
+	cpx     #$00
+	bpl     L002C
+	sta     regsave
+	stx     regsave+1
+	cpx     #$FF
+	bne     L002E
+	cmp     #$FF
+L002E:	jsr     boolult
+	lsr     a
+	lda     regsave
+	ldx     regsave+1
+	bcs     L002C
+	ldx     #$00
+	txa
+	bra     L002D
+L002C:	jsr     asrax1
+L002D:	ldy     #$10
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$60
+	bcc     L002F
+	inx
+L002F:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$66
+	bcc     L0030
+	inx
+L0030:	jsr     tossubax
+	cpx     #$00
+	bpl     L0031
+	sta     regsave
+	stx     regsave+1
+	cpx     #$FF
+	bne     L0033
+	cmp     #$FF
+L0033:	jsr     boolult
+	lsr     a
+	lda     regsave
+	ldx     regsave+1
+	bcs     L0031
+	ldx     #$00
+	txa
+	bra     L0032
+L0031:	jsr     asrax1
+L0032:	ldy     #$12
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$5C
+	bcc     L0034
+	inx
+L0034:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$62
+	bcc     L0035
+	inx
+L0035:	jsr     tossubax
+	cpx     #$00
+	bpl     L0036
+	sta     regsave
+	stx     regsave+1
+	cpx     #$FF
+	bne     L0038
+	cmp     #$FF
+L0038:	jsr     boolult
+	lsr     a
+	lda     regsave
+	ldx     regsave+1
+	bcs     L0036
+	ldx     #$00
+	txa
+	bra     L0037
+L0036:	jsr     asrax1
+L0037:	ldy     #$14
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$58
+	bcc     L0039
+	inx
+L0039:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$5E
+	bcc     L003A
+	inx
+L003A:	jsr     tossubax
+	cpx     #$00
+	bpl     L003B
+	sta     regsave
+	stx     regsave+1
+	cpx     #$FF
+	bne     L003D
+	cmp     #$FF
+L003D:	jsr     boolult
+	lsr     a
+	lda     regsave
+	ldx     regsave+1
+	bcs     L003B
+	ldx     #$00
+	txa
+	bra     L003C
+L003B:	jsr     asrax1
+L003C:	ldy     #$16
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$54
+	bcc     L003E
+	inx
+L003E:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$5A
+	bcc     L003F
+	inx
+L003F:	jsr     tossubax
+	cpx     #$00
+	bpl     L0040
+	sta     regsave
+	stx     regsave+1
+	cpx     #$FF
+	bne     L0042
+	cmp     #$FF
+L0042:	jsr     boolult
+	lsr     a
+	lda     regsave
+	ldx     regsave+1
+	bcs     L0040
+	ldx     #$00
+	txa
+	bra     L0041
+L0040:	jsr     asrax1
+L0041:	ldy     #$18
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$50
+	bcc     L0043
+	inx
+L0043:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$56
+	bcc     L0044
+	inx
+L0044:	jsr     tossubax
+	cpx     #$00
+	bpl     L0045
+	sta     regsave
+	stx     regsave+1
+	cpx     #$FF
+	bne     L0047
+	cmp     #$FF
+L0047:	jsr     boolult
+	lsr     a
+	lda     regsave
+	ldx     regsave+1
+	bcs     L0045
+	ldx     #$00
+	txa
+	bra     L0046
+L0045:	jsr     asrax1
+L0046:	ldy     #$1A
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$4C
+	bcc     L0048
+	inx
+L0048:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$52
+	bcc     L0049
+	inx
+L0049:	jsr     tossubax
+	cpx     #$00
+	bpl     L004A
+	sta     regsave
+	stx     regsave+1
+	cpx     #$FF
+	bne     L004C
+	cmp     #$FF
+L004C:	jsr     boolult
+	lsr     a
+	lda     regsave
+	ldx     regsave+1
+	bcs     L004A
+	ldx     #$00
+	txa
+	bra     L004B
+L004A:	jsr     asrax1
+L004B:	ldy     #$1C
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$48
+	bcc     L004D
+	inx
+L004D:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$4E
+	bcc     L004E
+	inx
+L004E:	jsr     tossubax
+	cpx     #$00
+	bpl     L004F
+	sta     regsave
+	stx     regsave+1
+	cpx     #$FF
+	bne     L0051
+	cmp     #$FF
+L0051:	jsr     boolult
+	lsr     a
+	lda     regsave
+	ldx     regsave+1
+	bcs     L004F
+	ldx     #$00
+	txa
+	bra     L0050
+L004F:	jsr     asrax1
+L0050:	ldy     #$1E
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$44
+	bcc     L0052
+	inx
+L0052:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$4A
+	bcc     L0053
+	inx
+L0053:	jsr     tossubax
+	cpx     #$00
+	bpl     L0054
+	sta     regsave
+	stx     regsave+1
+	cpx     #$FF
+	bne     L0056
+	cmp     #$FF
+L0056:	jsr     boolult
+	lsr     a
+	lda     regsave
+	ldx     regsave+1
+	bcs     L0054
+	ldx     #$00
+	txa
+	bra     L0055
+L0054:	jsr     asrax1
+L0055:	ldy     #$20
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$40
+	bcc     L0057
+	inx
+L0057:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$46
+	bcc     L0058
+	inx
+L0058:	jsr     tossubax
+	cpx     #$00
+	bpl     L0059
+	sta     regsave
+	stx     regsave+1
+	cpx     #$FF
+	bne     L005B
+	cmp     #$FF
+L005B:	jsr     boolult
+	lsr     a
+	lda     regsave
+	ldx     regsave+1
+	bcs     L0059
+	ldx     #$00
+	txa
+	bra     L005A
+L0059:	jsr     asrax1
+L005A:	ldy     #$22
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$3C
+	bcc     L005C
+	inx
+L005C:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$42
+	bcc     L005D
+	inx
+L005D:	jsr     tossubax
+	cpx     #$00
+	bpl     L005E
+	sta     regsave
+	stx     regsave+1
+	cpx     #$FF
+	bne     L0060
+	cmp     #$FF
+L0060:	jsr     boolult
+	lsr     a
+	lda     regsave
+	ldx     regsave+1
+	bcs     L005E
+	ldx     #$00
+	txa
+	bra     L005F
+L005E:	jsr     asrax1
+L005F:	ldy     #$24
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$3A
+	bcc     L0061
+	inx
+L0061:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$3E
+	bcc     L0062
+	inx
+L0062:	jsr     tossubax
+	cpx     #$00
+	bpl     L0063
+	sta     regsave
+	stx     regsave+1
+	cpx     #$FF
+	bne     L0065
+	cmp     #$FF
+L0065:	jsr     boolult
+	lsr     a
+	lda     regsave
+	ldx     regsave+1
+	bcs     L0063
+	ldx     #$00
+	txa
+	bra     L0064
+L0063:	jsr     asrax1
+L0064:	ldy     #$26
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$38
+	bcc     L0066
+	inx
+L0066:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$3C
+	bcc     L0067
+	inx
+L0067:	jsr     tossubax
+	cpx     #$00
+	bpl     L0068
+	sta     regsave
+	stx     regsave+1
+	cpx     #$FF
+	bne     L006A
+	cmp     #$FF
+L006A:	jsr     boolult
+	lsr     a
+	lda     regsave
+	ldx     regsave+1
+	bcs     L0068
+	ldx     #$00
+	txa
+	bra     L0069
+L0068:	jsr     asrax1
+L0069:	ldy     #$28
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$36
+	bcc     L006B
+	inx
+L006B:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$3A
+	bcc     L006C
+	inx
+L006C:	jsr     tossubax
+	cpx     #$00
+	bpl     L006D
+	sta     regsave
+	stx     regsave+1
+	cpx     #$FF
+	bne     L006F
+	cmp     #$FF
+L006F:	jsr     boolult
+	lsr     a
+	lda     regsave
+	ldx     regsave+1
+	bcs     L006D
+	ldx     #$00
+	txa
+	bra     L006E
+L006D:	jsr     asrax1
+L006E:	ldy     #$2A
+	jsr     staxysp
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	ldy     #$32
+	jsr     staxysp
+	ldy     #$34
+	lda     #$01
+	sta     (sp),y
+	dea
+	iny
+	sta     (sp),y
+	ldy     #$2C
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L0088
+L0073:	ldy     #$35
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cpx     #$00
+	jne     L0076
+	cmp     #$01
+	beq     L0077
+	cmp     #$02
+	beq     L0079
+	cmp     #$03
+	jeq     L007D
+	jmp     L0076
+L0077:	ldy     #$2D
+	lda     (sp),y
+	sta     tmp1
+	dey
+	lda     (sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     sp
+	sta     ptr1
+	lda     tmp1
+	adc     sp+1
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	ldy     #$32
+	cmp     (sp),y
+	bne     L0089
+	txa
+	iny
+	cmp     (sp),y
+	jeq     L0076
+L0089:	ldy     #$2D
+	lda     (sp),y
+	sta     tmp1
+	dey
+	lda     (sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     sp
+	sta     ptr1
+	lda     tmp1
+	adc     sp+1
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	ldy     #$30
+	jsr     staxysp
+	ldy     #$34
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$2E
+	ina
+	sta     (sp),y
+	dea
+	jmp     L008F
+L0079:	ldy     #$2D
+	lda     (sp),y
+	sta     tmp1
+	dey
+	lda     (sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     sp
+	sta     ptr1
+	lda     tmp1
+	adc     sp+1
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	ldy     #$32
+	cmp     (sp),y
+	bne     L007A
+	txa
+	iny
+	cmp     (sp),y
+	bne     L007A
+	iny
+	lda     #$03
+	bra     L008D
+L007A:	ldy     #$2D
+	lda     (sp),y
+	sta     tmp1
+	dey
+	lda     (sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     sp
+	sta     ptr1
+	lda     tmp1
+	adc     sp+1
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	ldy     #$30
+	cmp     (sp),y
+	bne     L008A
+	txa
+	iny
+	cmp     (sp),y
+	bne     L008A
+	ldy     #$2F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ina
+	bne     L007C
+	inx
+L007C:	jsr     staxysp
+	bra     L0076
+L007D:	ldy     #$2D
+	lda     (sp),y
+	sta     tmp1
+	dey
+	lda     (sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     sp
+	sta     ptr1
+	lda     tmp1
+	adc     sp+1
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	ldy     #$32
+	cmp     (sp),y
+	bne     L008A
+	txa
+	iny
+	cmp     (sp),y
+	beq     L0076
+L008A:	ldy     #$34
+	lda     #$04
+L008D:	sta     (sp),y
+	lda     #$00
+L008F:	iny
+	sta     (sp),y
+L0076:	ldy     #$2C
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$2D
+L0088:	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cmp     #$16
+	txa
+	sbc     #$00
+	bvc     L0074
+	eor     #$80
+L0074:	jmi     L0073
+	ldy     #$35
+	lda     (sp),y
+	bne     L0080
+	dey
+	lda     (sp),y
+	cmp     #$03
+	bne     L0080
+	lda     #$10
+	sec
+	ldy     #$2E
+	sbc     (sp),y
+	pha
+	lda     #$00
+	iny
+	sbc     (sp),y
+	tax
+	pla
+	bra     L0082
+L0080:	ldx     #$FF
+	txa
+L0082:	ldy     #$84
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ s81 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s81: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$1A
+	jsr     subysp
+	ldy     #$12
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$0E
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$0C
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$0A
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #<(M0002)
+	ldx     #>(M0002)
+	ldy     #$18
+	jsr     staxysp
+	ldy     #$1B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$1A
+	bcc     L0002
+	inx
+L0002:	ldy     #$16
+	jsr     staxysp
+L0003:	ldy     #$17
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	ldy     #$19
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	lda     (ptr1)
+	sta     (sreg)
+	tax
+	php
+	ldy     #$16
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$18
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	bne     L0003
+	ldy     #$14
+	lda     #$01
+	sta     (sp),y
+	dea
+	iny
+	sta     (sp),y
+	ldy     #$10
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L0030
+L0009:	ldy     #$14
+	lda     (sp),y
+	ldy     #$09
+	sta     (sp),y
+	ldy     #$14
+	lda     (sp),y
+	ldy     #$08
+	sta     (sp),y
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$14
+	bcc     L000B
+	inx
+L000B:	ldy     #$06
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$14
+	bcc     L000C
+	inx
+L000C:	ldy     #$04
+	jsr     staxysp
+	ldy     #$15
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$15
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     stax0sp
+	ldy     #$09
+	lda     (sp),y
+	dey
+	cmp     (sp),y
+	beq     L000D
+	ldy     #$0E
+	lda     #$01
+	sta     (sp),y
+	dea
+	iny
+	sta     (sp),y
+L000D:	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$04
+	cmp     (sp),y
+	bne     L0031
+	txa
+	iny
+	cmp     (sp),y
+	beq     L000E
+L0031:	ldy     #$0C
+	lda     #$01
+	sta     (sp),y
+	dea
+	iny
+	sta     (sp),y
+L000E:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cmp     (sp)
+	bne     L0032
+	txa
+	dey
+	cmp     (sp),y
+	beq     L000F
+L0032:	ldy     #$0A
+	lda     #$01
+	sta     (sp),y
+	dea
+	iny
+	sta     (sp),y
+L000F:	ldy     #$15
+	lda     (sp),y
+	sta     tmp1
+	dey
+	lda     (sp),y
+	asl     a
+	rol     tmp1
+	ldx     tmp1
+	jsr     staxysp
+	ldy     #$10
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$11
+L0030:	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cmp     #$32
+	txa
+	sbc     #$00
+	bvc     L000A
+	eor     #$80
+L000A:	jmi     L0009
+	ldy     #$0E
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L0013
+	ldy     #$13
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ina
+	bne     L0012
+	inx
+L0012:	jsr     staxysp
+	ldy     #$1B
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$13
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     #$00
+	bne     L0033
+	cmp     #$00
+	beq     L0013
+L0033:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L0013:	ldy     #$0C
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L0018
+	ldy     #$13
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$02
+	bcc     L0017
+	inx
+L0017:	jsr     staxysp
+	ldy     #$1B
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$13
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     #$00
+	bne     L0034
+	cmp     #$00
+	beq     L0018
+L0034:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$02
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L0018:	ldy     #$0A
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L001D
+	ldy     #$13
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$04
+	bcc     L001C
+	inx
+L001C:	jsr     staxysp
+	ldy     #$1B
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$13
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     #$00
+	bne     L0035
+	cmp     #$00
+	beq     L001D
+L0035:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	tay
+	jsr     _printf
+L001D:	jsr     _regc
+	ldy     #$14
+	jsr     staxysp
+	ldy     #$1B
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$11
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     #$00
+	bne     L0036
+	cmp     #$00
+	beq     L0022
+L0036:	ldy     #$15
+	lda     (sp),y
+	tax
+	cpx     #$80
+	bcc     L0021
+	lda     #<(M0003)
+	ldx     #>(M0003)
+	jsr     pushax
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$04
+	bra     L002D
+L0021:	lda     #<(M0004)
+	ldx     #>(M0004)
+	jsr     pushax
+	ldy     #$19
+	jsr     pushwysp
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$06
+L002D:	jsr     _printf
+L0022:	jsr     _regp
+	ldy     #$14
+	jsr     staxysp
+	ldy     #$1B
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$11
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     #$00
+	bne     L0037
+	cmp     #$00
+	beq     L0026
+L0037:	ldy     #$15
+	lda     (sp),y
+	tax
+	cpx     #$80
+	bcc     L0025
+	lda     #<(M0003)
+	ldx     #>(M0003)
+	jsr     pushax
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$04
+	bra     L002E
+L0025:	lda     #<(M0004)
+	ldx     #>(M0004)
+	jsr     pushax
+	ldy     #$19
+	jsr     pushwysp
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$06
+L002E:	jsr     _printf
+L0026:	jsr     _regi
+	ldy     #$14
+	jsr     staxysp
+	ldy     #$1B
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$11
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     #$00
+	bne     L0038
+	cmp     #$00
+	beq     L002A
+L0038:	ldy     #$15
+	lda     (sp),y
+	tax
+	cpx     #$80
+	bcc     L0029
+	lda     #<(M0003)
+	ldx     #>(M0003)
+	jsr     pushax
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldy     #$04
+	bra     L002F
+L0029:	lda     #<(M0004)
+	ldx     #>(M0004)
+	jsr     pushax
+	ldy     #$19
+	jsr     pushwysp
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldy     #$06
+L002F:	jsr     _printf
+L002A:	ldy     #$13
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$1C
+	jmp     addysp
+
+.segment	"DATA"
+
+M0001:
+	.byte	$73,$38,$31,$2C,$65,$72,$25,$64,$0A,$00
+M0002:
+	.byte	$73,$38,$31,$20,$20,$20,$20,$00
+M0003:
+	.byte	$52,$65,$67,$69,$73,$74,$65,$72,$20,$63,$6F,$75,$6E,$74,$20,$66
+	.byte	$6F,$72,$20,$25,$73,$20,$69,$73,$20,$75,$6E,$72,$65,$6C,$69,$61
+	.byte	$62,$6C,$65,$2E,$0A,$00
+M0004:
+	.byte	$25,$64,$20,$72,$65,$67,$69,$73,$74,$65,$72,$73,$20,$61,$73,$73
+	.byte	$69,$67,$6E,$65,$64,$20,$74,$6F,$20,$25,$73,$20,$76,$61,$72,$69
+	.byte	$61,$62,$6C,$65,$73,$2E,$0A,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ section (int j, void *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_section: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$02
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	bne     L0003
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _s81
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	lda     #$01
+	sta     M0001+14
+	stz     M0001+14+1
+	sta     M0001+16
+	stz     M0001+16+1
+	sta     M0001+18
+	stz     M0001+18+1
+	sta     M0001+20
+	stz     M0001+20+1
+	lda     #>(M0001)
+	sta     M0002+1
+	lda     #<(M0001)
+	sta     M0002
+	lda     #$00
+	sta     (sp)
+	ldy     #$01
+	sta     (sp),y
+	bra     L000D
+L0005:	jsr     pushw0sp
+	lda     M0002
+	ldx     M0002+1
+	jsr     _section
+	sta     M0001+22
+	stx     M0001+22+1
+	lda     M0001+24
+	clc
+	adc     M0001+22
+	sta     M0001+24
+	lda     M0001+24+1
+	adc     M0001+22+1
+	sta     M0001+24+1
+	lda     M0001+14
+	ora     M0001+14+1
+	beq     L0007
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	lda     #<(M0001+26)
+	ldx     #>(M0001+26)
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+L0007:	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	ldy     #$01
+L000D:	lda     (sp),y
+	tax
+	lda     (sp)
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	bmi     L0005
+	lda     M0001+24
+	ora     M0001+24+1
+	bne     L0009
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	bra     L000F
+L0009:	lda     #<(S000D)
+	ldx     #>(S000D)
+L000F:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     M0001+24
+	ldx     M0001+24+1
+	jmp     incsp6
+
+.segment	"BSS"
+
+M0001:
+	.res	34,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
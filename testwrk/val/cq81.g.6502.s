@@ -0,0 +1,2861 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "cq81.c", 20173, 1613073744
+	.dbg		file, "common.h", 522, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/stdlib.h", 5999, 1613073744
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_lbits
+	.export		_ubits
+	.export		_fbits
+	.export		_dbits
+	.export		_flgs
+	.export		_flgm
+	.export		_flgd
+	.export		_flgl
+	.export		_rrc
+	.export		_crc
+	.export		_rfs
+	.export		_regc
+	.export		_regp
+	.export		_regi
+	.export		_s81
+	.export		_section
+	.export		_main
+
+.segment	"RODATA"
+
+S000B:
+	.byte	$53,$65,$63,$74,$69,$6F,$6E,$20,$25,$73,$20,$72,$65,$74,$75,$72
+	.byte	$6E,$65,$64,$20,$25,$64,$2E,$0A,$00
+S000C:
+	.byte	$0A,$4E,$6F,$20,$65,$72,$72,$6F,$72,$73,$20,$64,$65,$74,$65,$63
+	.byte	$74,$65,$64,$2E,$0A,$00
+S000D:
+	.byte	$0A,$46,$61,$69,$6C,$65,$64,$2E,$0A,$00
+S0008:
+	.byte	$70,$6F,$69,$6E,$74,$65,$72,$00
+S0007	:=	S0008+0
+S0006:
+	.byte	$63,$68,$61,$72,$00
+S0005	:=	S0006+0
+S0009:
+	.byte	$69,$6E,$74,$00
+S000A	:=	S0009+0
+
+.segment	"BSS"
+
+_lbits:
+	.res	2,$00
+_ubits:
+	.res	2,$00
+_fbits:
+	.res	2,$00
+_dbits:
+	.res	2,$00
+_flgs:
+	.res	2,$00
+_flgm:
+	.res	2,$00
+_flgd:
+	.res	2,$00
+_flgl:
+	.res	2,$00
+_rrc:
+	.res	2,$00
+_crc:
+	.res	2,$00
+_rfs:
+	.res	8,$00
+
+; ---------------------------------------------------------------
+; int __near__ regc (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_regc: near
+
+	.dbg	func, "regc", "00", extern, "_regc"
+	.dbg	sym, "r00", "00", auto, -1
+	.dbg	sym, "r01", "00", auto, -2
+	.dbg	sym, "r02", "00", auto, -3
+	.dbg	sym, "r03", "00", auto, -4
+	.dbg	sym, "r04", "00", auto, -5
+	.dbg	sym, "r05", "00", auto, -6
+	.dbg	sym, "r06", "00", auto, -7
+	.dbg	sym, "r07", "00", auto, -8
+	.dbg	sym, "r08", "00", auto, -9
+	.dbg	sym, "r09", "00", auto, -10
+	.dbg	sym, "r10", "00", auto, -11
+	.dbg	sym, "r11", "00", auto, -12
+	.dbg	sym, "r12", "00", auto, -13
+	.dbg	sym, "r13", "00", auto, -14
+	.dbg	sym, "r14", "00", auto, -15
+	.dbg	sym, "r15", "00", auto, -16
+	.dbg	sym, "r16", "00", auto, -17
+	.dbg	sym, "r17", "00", auto, -18
+	.dbg	sym, "r18", "00", auto, -19
+	.dbg	sym, "r19", "00", auto, -20
+	.dbg	sym, "r20", "00", auto, -21
+	.dbg	sym, "r21", "00", auto, -22
+	.dbg	sym, "r22", "00", auto, -23
+	.dbg	sym, "r23", "00", auto, -24
+	.dbg	sym, "r24", "00", auto, -25
+	.dbg	sym, "r25", "00", auto, -26
+	.dbg	sym, "r26", "00", auto, -27
+	.dbg	sym, "r27", "00", auto, -28
+	.dbg	sym, "r28", "00", auto, -29
+	.dbg	sym, "r29", "00", auto, -30
+	.dbg	sym, "r30", "00", auto, -31
+	.dbg	sym, "r31", "00", auto, -32
+	.dbg	sym, "r32", "00", auto, -33
+	.dbg	sym, "r33", "00", auto, -34
+	.dbg	sym, "r34", "00", auto, -35
+	.dbg	sym, "r35", "00", auto, -36
+	.dbg	sym, "r36", "00", auto, -37
+	.dbg	sym, "r37", "00", auto, -38
+	.dbg	sym, "r38", "00", auto, -39
+	.dbg	sym, "s", "00", auto, -41
+	.dbg	sym, "n1", "00", auto, -43
+	.dbg	sym, "n2", "00", auto, -45
+	.dbg	sym, "nr", "00", auto, -47
+	.dbg	sym, "j", "00", auto, -49
+	.dbg	sym, "d", "00", auto, -93
+
+.segment	"CODE"
+
+	.dbg	line, "cq81.c", 228
+	ldy     #$5D
+	jsr     subysp
+	ldx     #$00
+	lda     #$00
+	ldy     #$5C
+	sta     (sp),y
+	.dbg	line, "cq81.c", 229
+	ldx     #$00
+	lda     #$01
+	ldy     #$5B
+	sta     (sp),y
+	.dbg	line, "cq81.c", 230
+	ldx     #$00
+	lda     #$02
+	ldy     #$5A
+	sta     (sp),y
+	.dbg	line, "cq81.c", 231
+	ldx     #$00
+	lda     #$03
+	ldy     #$59
+	sta     (sp),y
+	.dbg	line, "cq81.c", 232
+	ldx     #$00
+	lda     #$04
+	ldy     #$58
+	sta     (sp),y
+	.dbg	line, "cq81.c", 233
+	ldx     #$00
+	lda     #$05
+	ldy     #$57
+	sta     (sp),y
+	.dbg	line, "cq81.c", 234
+	ldx     #$00
+	lda     #$06
+	ldy     #$56
+	sta     (sp),y
+	.dbg	line, "cq81.c", 235
+	ldx     #$00
+	lda     #$07
+	ldy     #$55
+	sta     (sp),y
+	.dbg	line, "cq81.c", 236
+	ldx     #$00
+	lda     #$08
+	ldy     #$54
+	sta     (sp),y
+	.dbg	line, "cq81.c", 237
+	ldx     #$00
+	lda     #$09
+	ldy     #$53
+	sta     (sp),y
+	.dbg	line, "cq81.c", 238
+	ldx     #$00
+	lda     #$0A
+	ldy     #$52
+	sta     (sp),y
+	.dbg	line, "cq81.c", 239
+	ldx     #$00
+	lda     #$0B
+	ldy     #$51
+	sta     (sp),y
+	.dbg	line, "cq81.c", 240
+	ldx     #$00
+	lda     #$0C
+	ldy     #$50
+	sta     (sp),y
+	.dbg	line, "cq81.c", 241
+	ldx     #$00
+	lda     #$0D
+	ldy     #$4F
+	sta     (sp),y
+	.dbg	line, "cq81.c", 242
+	ldx     #$00
+	lda     #$0E
+	ldy     #$4E
+	sta     (sp),y
+	.dbg	line, "cq81.c", 243
+	ldx     #$00
+	lda     #$0F
+	ldy     #$4D
+	sta     (sp),y
+	.dbg	line, "cq81.c", 244
+	ldx     #$00
+	lda     #$10
+	ldy     #$4C
+	sta     (sp),y
+	.dbg	line, "cq81.c", 245
+	ldx     #$00
+	lda     #$11
+	ldy     #$4B
+	sta     (sp),y
+	.dbg	line, "cq81.c", 246
+	ldx     #$00
+	lda     #$12
+	ldy     #$4A
+	sta     (sp),y
+	.dbg	line, "cq81.c", 247
+	ldx     #$00
+	lda     #$13
+	ldy     #$49
+	sta     (sp),y
+	.dbg	line, "cq81.c", 248
+	ldx     #$00
+	lda     #$14
+	ldy     #$48
+	sta     (sp),y
+	.dbg	line, "cq81.c", 249
+	ldx     #$00
+	lda     #$15
+	ldy     #$47
+	sta     (sp),y
+	.dbg	line, "cq81.c", 250
+	ldx     #$00
+	lda     #$16
+	ldy     #$46
+	sta     (sp),y
+	.dbg	line, "cq81.c", 251
+	ldx     #$00
+	lda     #$17
+	ldy     #$45
+	sta     (sp),y
+	.dbg	line, "cq81.c", 252
+	ldx     #$00
+	lda     #$18
+	ldy     #$44
+	sta     (sp),y
+	.dbg	line, "cq81.c", 253
+	ldx     #$00
+	lda     #$19
+	ldy     #$43
+	sta     (sp),y
+	.dbg	line, "cq81.c", 254
+	ldx     #$00
+	lda     #$1A
+	ldy     #$42
+	sta     (sp),y
+	.dbg	line, "cq81.c", 255
+	ldx     #$00
+	lda     #$1B
+	ldy     #$41
+	sta     (sp),y
+	.dbg	line, "cq81.c", 256
+	ldx     #$00
+	lda     #$1C
+	ldy     #$40
+	sta     (sp),y
+	.dbg	line, "cq81.c", 257
+	ldx     #$00
+	lda     #$1D
+	ldy     #$3F
+	sta     (sp),y
+	.dbg	line, "cq81.c", 258
+	ldx     #$00
+	lda     #$1E
+	ldy     #$3E
+	sta     (sp),y
+	.dbg	line, "cq81.c", 259
+	ldx     #$00
+	lda     #$1F
+	ldy     #$3D
+	sta     (sp),y
+	.dbg	line, "cq81.c", 260
+	ldx     #$00
+	lda     #$20
+	ldy     #$3C
+	sta     (sp),y
+	.dbg	line, "cq81.c", 261
+	ldx     #$00
+	lda     #$21
+	ldy     #$3B
+	sta     (sp),y
+	.dbg	line, "cq81.c", 262
+	ldx     #$00
+	lda     #$22
+	ldy     #$3A
+	sta     (sp),y
+	.dbg	line, "cq81.c", 263
+	ldx     #$00
+	lda     #$23
+	ldy     #$39
+	sta     (sp),y
+	.dbg	line, "cq81.c", 264
+	ldx     #$00
+	lda     #$24
+	ldy     #$38
+	sta     (sp),y
+	.dbg	line, "cq81.c", 265
+	ldx     #$00
+	lda     #$25
+	ldy     #$37
+	sta     (sp),y
+	.dbg	line, "cq81.c", 266
+	ldx     #$00
+	lda     #$26
+	ldy     #$36
+	sta     (sp),y
+	.dbg	line, "cq81.c", 268
+	lda     #$5B
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$5E
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "cq81.c", 269
+	lda     #$5A
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$5D
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "cq81.c", 270
+	lda     #$59
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$5C
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq81.c", 271
+	lda     #$57
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$5B
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$06
+	jsr     staxysp
+	.dbg	line, "cq81.c", 272
+	lda     #$55
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$59
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "cq81.c", 273
+	lda     #$53
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$57
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$0A
+	jsr     staxysp
+	.dbg	line, "cq81.c", 274
+	lda     #$51
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$55
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq81.c", 275
+	lda     #$4F
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$53
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq81.c", 276
+	lda     #$4D
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$51
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq81.c", 277
+	lda     #$4B
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$4F
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$12
+	jsr     staxysp
+	.dbg	line, "cq81.c", 278
+	lda     #$49
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$4D
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$14
+	jsr     staxysp
+	.dbg	line, "cq81.c", 279
+	lda     #$47
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$4B
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$16
+	jsr     staxysp
+	.dbg	line, "cq81.c", 280
+	lda     #$45
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$49
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq81.c", 281
+	lda     #$43
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$47
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq81.c", 282
+	lda     #$41
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$45
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq81.c", 283
+	lda     #$3F
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$43
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq81.c", 284
+	lda     #$3D
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$41
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$20
+	jsr     staxysp
+	.dbg	line, "cq81.c", 285
+	lda     #$3B
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$3F
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$22
+	jsr     staxysp
+	.dbg	line, "cq81.c", 286
+	lda     #$39
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$3D
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq81.c", 287
+	lda     #$38
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$3B
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$26
+	jsr     staxysp
+	.dbg	line, "cq81.c", 288
+	lda     #$37
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$3A
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$28
+	jsr     staxysp
+	.dbg	line, "cq81.c", 289
+	lda     #$36
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$39
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$2A
+	jsr     staxysp
+	.dbg	line, "cq81.c", 297
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$32
+	jsr     staxysp
+	.dbg	line, "cq81.c", 298
+	ldx     #$00
+	lda     #$01
+	ldy     #$34
+	jsr     staxysp
+	.dbg	line, "cq81.c", 300
+	ldx     #$00
+	lda     #$00
+	ldy     #$2C
+	jsr     staxysp
+	jmp     L0002
+	.dbg	line, "cq81.c", 301
+L0005:	ldy     #$35
+	jsr     ldaxysp
+	jmp     L0007
+	.dbg	line, "cq81.c", 320
+L0007:	cpx     #$00
+	jne     L0010
+	cmp     #$01
+	jeq     L0009
+	cmp     #$02
+	jeq     L000B
+	cmp     #$03
+	jeq     L000E
+	jmp     L0008
+L0010:	jmp     L0008
+	.dbg	line, "cq81.c", 302
+L0009:	ldy     #$2D
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$35
+	jsr     ldaxysp
+	jsr     tosneax
+	jeq     L000A
+	.dbg	line, "cq81.c", 303
+	ldy     #$2D
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$30
+	jsr     staxysp
+	.dbg	line, "cq81.c", 304
+	ldx     #$00
+	lda     #$02
+	ldy     #$34
+	jsr     staxysp
+	.dbg	line, "cq81.c", 305
+	ldx     #$00
+	lda     #$01
+	ldy     #$2E
+	jsr     staxysp
+	.dbg	line, "cq81.c", 307
+L000A:	jmp     L0008
+	.dbg	line, "cq81.c", 308
+L000B:	ldy     #$2D
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$35
+	jsr     ldaxysp
+	jsr     toseqax
+	jeq     L000C
+	.dbg	line, "cq81.c", 309
+	ldx     #$00
+	lda     #$03
+	ldy     #$34
+	jsr     staxysp
+	.dbg	line, "cq81.c", 310
+	jmp     L0008
+	.dbg	line, "cq81.c", 312
+L000C:	ldy     #$2D
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$33
+	jsr     ldaxysp
+	jsr     toseqax
+	jeq     L000D
+	.dbg	line, "cq81.c", 313
+	ldy     #$2F
+	jsr     ldaxysp
+	jsr     incax1
+	ldy     #$2E
+	jsr     staxysp
+	.dbg	line, "cq81.c", 314
+	jmp     L0008
+	.dbg	line, "cq81.c", 316
+L000D:	ldx     #$00
+	lda     #$04
+	ldy     #$34
+	jsr     staxysp
+	.dbg	line, "cq81.c", 317
+	jmp     L0008
+	.dbg	line, "cq81.c", 318
+L000E:	ldy     #$2D
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$35
+	jsr     ldaxysp
+	jsr     tosneax
+	jeq     L000F
+	ldx     #$00
+	lda     #$04
+	ldy     #$34
+	jsr     staxysp
+	.dbg	line, "cq81.c", 319
+L000F:	jmp     L0008
+	.dbg	line, "cq81.c", 300
+L0008:	ldy     #$2D
+	jsr     ldaxysp
+	ldy     #$2C
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0002:	ldy     #$2D
+	jsr     ldaxysp
+	cmp     #$16
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0005
+	.dbg	line, "cq81.c", 323
+	ldy     #$35
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0012
+	cmp     #$03
+L0012:	jsr     booleq
+	jeq     L0011
+	ldx     #$00
+	lda     #$10
+	jsr     pushax
+	ldy     #$31
+	jsr     ldaxysp
+	jsr     tossubax
+	jmp     L0013
+	.dbg	line, "cq81.c", 324
+	jmp     L0013
+L0011:	ldx     #$FF
+	lda     #$FF
+	jmp     L0013
+	.dbg	line, "cq81.c", 325
+L0013:	ldy     #$5D
+	jsr     addysp
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ regp (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_regp: near
+
+	.dbg	func, "regp", "00", extern, "_regp"
+	.dbg	sym, "r00", "00", auto, -2
+	.dbg	sym, "r01", "00", auto, -4
+	.dbg	sym, "r02", "00", auto, -6
+	.dbg	sym, "r03", "00", auto, -8
+	.dbg	sym, "r04", "00", auto, -10
+	.dbg	sym, "r05", "00", auto, -12
+	.dbg	sym, "r06", "00", auto, -14
+	.dbg	sym, "r07", "00", auto, -16
+	.dbg	sym, "r08", "00", auto, -18
+	.dbg	sym, "r09", "00", auto, -20
+	.dbg	sym, "r10", "00", auto, -22
+	.dbg	sym, "r11", "00", auto, -24
+	.dbg	sym, "r12", "00", auto, -26
+	.dbg	sym, "r13", "00", auto, -28
+	.dbg	sym, "r14", "00", auto, -30
+	.dbg	sym, "r15", "00", auto, -32
+	.dbg	sym, "r16", "00", auto, -34
+	.dbg	sym, "r17", "00", auto, -36
+	.dbg	sym, "r18", "00", auto, -38
+	.dbg	sym, "r19", "00", auto, -40
+	.dbg	sym, "r20", "00", auto, -42
+	.dbg	sym, "r21", "00", auto, -44
+	.dbg	sym, "r22", "00", auto, -46
+	.dbg	sym, "r23", "00", auto, -48
+	.dbg	sym, "r24", "00", auto, -50
+	.dbg	sym, "r25", "00", auto, -52
+	.dbg	sym, "r26", "00", auto, -54
+	.dbg	sym, "r27", "00", auto, -56
+	.dbg	sym, "r28", "00", auto, -58
+	.dbg	sym, "r29", "00", auto, -60
+	.dbg	sym, "r30", "00", auto, -62
+	.dbg	sym, "r31", "00", auto, -64
+	.dbg	sym, "r32", "00", auto, -66
+	.dbg	sym, "r33", "00", auto, -68
+	.dbg	sym, "r34", "00", auto, -70
+	.dbg	sym, "r35", "00", auto, -72
+	.dbg	sym, "r36", "00", auto, -74
+	.dbg	sym, "r37", "00", auto, -76
+	.dbg	sym, "r38", "00", auto, -78
+	.dbg	sym, "s", "00", auto, -80
+	.dbg	sym, "n1", "00", auto, -82
+	.dbg	sym, "n2", "00", auto, -84
+	.dbg	sym, "nr", "00", auto, -86
+	.dbg	sym, "j", "00", auto, -88
+	.dbg	sym, "d", "00", auto, -132
+
+.segment	"CODE"
+
+	.dbg	line, "cq81.c", 582
+	ldy     #$84
+	jsr     subysp
+	lda     #$82
+	jsr     leaa0sp
+	ldy     #$82
+	jsr     staxysp
+	.dbg	line, "cq81.c", 583
+	lda     #$80
+	jsr     leaa0sp
+	ldy     #$80
+	jsr     staxysp
+	.dbg	line, "cq81.c", 584
+	lda     #$7E
+	jsr     leaa0sp
+	ldy     #$7E
+	jsr     staxysp
+	.dbg	line, "cq81.c", 585
+	lda     #$7C
+	jsr     leaa0sp
+	ldy     #$7C
+	jsr     staxysp
+	.dbg	line, "cq81.c", 586
+	lda     #$78
+	jsr     leaa0sp
+	ldy     #$7A
+	jsr     staxysp
+	.dbg	line, "cq81.c", 587
+	lda     #$78
+	jsr     leaa0sp
+	ldy     #$78
+	jsr     staxysp
+	.dbg	line, "cq81.c", 588
+	lda     #$74
+	jsr     leaa0sp
+	ldy     #$76
+	jsr     staxysp
+	.dbg	line, "cq81.c", 589
+	lda     #$74
+	jsr     leaa0sp
+	ldy     #$74
+	jsr     staxysp
+	.dbg	line, "cq81.c", 590
+	lda     #$70
+	jsr     leaa0sp
+	ldy     #$72
+	jsr     staxysp
+	.dbg	line, "cq81.c", 591
+	lda     #$70
+	jsr     leaa0sp
+	ldy     #$70
+	jsr     staxysp
+	.dbg	line, "cq81.c", 592
+	lda     #$6C
+	jsr     leaa0sp
+	ldy     #$6E
+	jsr     staxysp
+	.dbg	line, "cq81.c", 593
+	lda     #$6C
+	jsr     leaa0sp
+	ldy     #$6C
+	jsr     staxysp
+	.dbg	line, "cq81.c", 594
+	lda     #$68
+	jsr     leaa0sp
+	ldy     #$6A
+	jsr     staxysp
+	.dbg	line, "cq81.c", 595
+	lda     #$68
+	jsr     leaa0sp
+	ldy     #$68
+	jsr     staxysp
+	.dbg	line, "cq81.c", 596
+	lda     #$64
+	jsr     leaa0sp
+	ldy     #$66
+	jsr     staxysp
+	.dbg	line, "cq81.c", 597
+	lda     #$64
+	jsr     leaa0sp
+	ldy     #$64
+	jsr     staxysp
+	.dbg	line, "cq81.c", 598
+	lda     #$60
+	jsr     leaa0sp
+	ldy     #$62
+	jsr     staxysp
+	.dbg	line, "cq81.c", 599
+	lda     #$60
+	jsr     leaa0sp
+	ldy     #$60
+	jsr     staxysp
+	.dbg	line, "cq81.c", 600
+	lda     #$5C
+	jsr     leaa0sp
+	ldy     #$5E
+	jsr     staxysp
+	.dbg	line, "cq81.c", 601
+	lda     #$5C
+	jsr     leaa0sp
+	ldy     #$5C
+	jsr     staxysp
+	.dbg	line, "cq81.c", 602
+	lda     #$58
+	jsr     leaa0sp
+	ldy     #$5A
+	jsr     staxysp
+	.dbg	line, "cq81.c", 603
+	lda     #$58
+	jsr     leaa0sp
+	ldy     #$58
+	jsr     staxysp
+	.dbg	line, "cq81.c", 604
+	lda     #$54
+	jsr     leaa0sp
+	ldy     #$56
+	jsr     staxysp
+	.dbg	line, "cq81.c", 605
+	lda     #$54
+	jsr     leaa0sp
+	ldy     #$54
+	jsr     staxysp
+	.dbg	line, "cq81.c", 606
+	lda     #$50
+	jsr     leaa0sp
+	ldy     #$52
+	jsr     staxysp
+	.dbg	line, "cq81.c", 607
+	lda     #$50
+	jsr     leaa0sp
+	ldy     #$50
+	jsr     staxysp
+	.dbg	line, "cq81.c", 608
+	lda     #$4C
+	jsr     leaa0sp
+	ldy     #$4E
+	jsr     staxysp
+	.dbg	line, "cq81.c", 609
+	lda     #$4C
+	jsr     leaa0sp
+	ldy     #$4C
+	jsr     staxysp
+	.dbg	line, "cq81.c", 610
+	lda     #$48
+	jsr     leaa0sp
+	ldy     #$4A
+	jsr     staxysp
+	.dbg	line, "cq81.c", 611
+	lda     #$48
+	jsr     leaa0sp
+	ldy     #$48
+	jsr     staxysp
+	.dbg	line, "cq81.c", 612
+	lda     #$44
+	jsr     leaa0sp
+	ldy     #$46
+	jsr     staxysp
+	.dbg	line, "cq81.c", 613
+	lda     #$44
+	jsr     leaa0sp
+	ldy     #$44
+	jsr     staxysp
+	.dbg	line, "cq81.c", 614
+	lda     #$40
+	jsr     leaa0sp
+	ldy     #$42
+	jsr     staxysp
+	.dbg	line, "cq81.c", 615
+	lda     #$40
+	jsr     leaa0sp
+	ldy     #$40
+	jsr     staxysp
+	.dbg	line, "cq81.c", 616
+	lda     #$3C
+	jsr     leaa0sp
+	ldy     #$3E
+	jsr     staxysp
+	.dbg	line, "cq81.c", 617
+	lda     #$3C
+	jsr     leaa0sp
+	ldy     #$3C
+	jsr     staxysp
+	.dbg	line, "cq81.c", 618
+	lda     #$3A
+	jsr     leaa0sp
+	ldy     #$3A
+	jsr     staxysp
+	.dbg	line, "cq81.c", 619
+	lda     #$38
+	jsr     leaa0sp
+	ldy     #$38
+	jsr     staxysp
+	.dbg	line, "cq81.c", 620
+	lda     #$36
+	jsr     leaa0sp
+	ldy     #$36
+	jsr     staxysp
+	.dbg	line, "cq81.c", 622
+	lda     #$80
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$84
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "cq81.c", 623
+	lda     #$7E
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$82
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "cq81.c", 624
+	lda     #$7C
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$80
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq81.c", 625
+	lda     #$78
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$7E
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	ldy     #$06
+	jsr     staxysp
+	.dbg	line, "cq81.c", 626
+	lda     #$74
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$7A
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "cq81.c", 627
+	lda     #$70
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$76
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	ldy     #$0A
+	jsr     staxysp
+	.dbg	line, "cq81.c", 628
+	lda     #$6C
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$72
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq81.c", 629
+	lda     #$68
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$6E
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq81.c", 630
+	lda     #$64
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$6A
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq81.c", 631
+	lda     #$60
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$66
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	ldy     #$12
+	jsr     staxysp
+	.dbg	line, "cq81.c", 632
+	lda     #$5C
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$62
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	ldy     #$14
+	jsr     staxysp
+	.dbg	line, "cq81.c", 633
+	lda     #$58
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$5E
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	ldy     #$16
+	jsr     staxysp
+	.dbg	line, "cq81.c", 634
+	lda     #$54
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$5A
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq81.c", 635
+	lda     #$50
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$56
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq81.c", 636
+	lda     #$4C
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$52
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq81.c", 637
+	lda     #$48
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$4E
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq81.c", 638
+	lda     #$44
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$4A
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	ldy     #$20
+	jsr     staxysp
+	.dbg	line, "cq81.c", 639
+	lda     #$40
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$46
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	ldy     #$22
+	jsr     staxysp
+	.dbg	line, "cq81.c", 640
+	lda     #$3C
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$42
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq81.c", 641
+	lda     #$3A
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$3E
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	ldy     #$26
+	jsr     staxysp
+	.dbg	line, "cq81.c", 642
+	lda     #$38
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$3C
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	ldy     #$28
+	jsr     staxysp
+	.dbg	line, "cq81.c", 643
+	lda     #$36
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$3A
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	ldy     #$2A
+	jsr     staxysp
+	.dbg	line, "cq81.c", 651
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$32
+	jsr     staxysp
+	.dbg	line, "cq81.c", 652
+	ldx     #$00
+	lda     #$01
+	ldy     #$34
+	jsr     staxysp
+	.dbg	line, "cq81.c", 653
+	ldx     #$00
+	lda     #$00
+	ldy     #$2C
+	jsr     staxysp
+	jmp     L0002
+	.dbg	line, "cq81.c", 654
+L0005:	ldy     #$35
+	jsr     ldaxysp
+	jmp     L0007
+	.dbg	line, "cq81.c", 673
+L0007:	cpx     #$00
+	jne     L0010
+	cmp     #$01
+	jeq     L0009
+	cmp     #$02
+	jeq     L000B
+	cmp     #$03
+	jeq     L000E
+	jmp     L0008
+L0010:	jmp     L0008
+	.dbg	line, "cq81.c", 655
+L0009:	ldy     #$2D
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$35
+	jsr     ldaxysp
+	jsr     tosneax
+	jeq     L000A
+	.dbg	line, "cq81.c", 656
+	ldy     #$2D
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$30
+	jsr     staxysp
+	.dbg	line, "cq81.c", 657
+	ldx     #$00
+	lda     #$02
+	ldy     #$34
+	jsr     staxysp
+	.dbg	line, "cq81.c", 658
+	ldx     #$00
+	lda     #$01
+	ldy     #$2E
+	jsr     staxysp
+	.dbg	line, "cq81.c", 660
+L000A:	jmp     L0008
+	.dbg	line, "cq81.c", 661
+L000B:	ldy     #$2D
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$35
+	jsr     ldaxysp
+	jsr     toseqax
+	jeq     L000C
+	.dbg	line, "cq81.c", 662
+	ldx     #$00
+	lda     #$03
+	ldy     #$34
+	jsr     staxysp
+	.dbg	line, "cq81.c", 663
+	jmp     L0008
+	.dbg	line, "cq81.c", 665
+L000C:	ldy     #$2D
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$33
+	jsr     ldaxysp
+	jsr     toseqax
+	jeq     L000D
+	.dbg	line, "cq81.c", 666
+	ldy     #$2F
+	jsr     ldaxysp
+	jsr     incax1
+	ldy     #$2E
+	jsr     staxysp
+	.dbg	line, "cq81.c", 667
+	jmp     L0008
+	.dbg	line, "cq81.c", 669
+L000D:	ldx     #$00
+	lda     #$04
+	ldy     #$34
+	jsr     staxysp
+	.dbg	line, "cq81.c", 670
+	jmp     L0008
+	.dbg	line, "cq81.c", 671
+L000E:	ldy     #$2D
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$35
+	jsr     ldaxysp
+	jsr     tosneax
+	jeq     L000F
+	ldx     #$00
+	lda     #$04
+	ldy     #$34
+	jsr     staxysp
+	.dbg	line, "cq81.c", 672
+L000F:	jmp     L0008
+	.dbg	line, "cq81.c", 653
+L0008:	ldy     #$2D
+	jsr     ldaxysp
+	ldy     #$2C
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0002:	ldy     #$2D
+	jsr     ldaxysp
+	cmp     #$16
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0005
+	.dbg	line, "cq81.c", 676
+	ldy     #$35
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0012
+	cmp     #$03
+L0012:	jsr     booleq
+	jeq     L0011
+	ldx     #$00
+	lda     #$10
+	jsr     pushax
+	ldy     #$31
+	jsr     ldaxysp
+	jsr     tossubax
+	jmp     L0013
+	.dbg	line, "cq81.c", 677
+	jmp     L0013
+L0011:	ldx     #$FF
+	lda     #$FF
+	jmp     L0013
+	.dbg	line, "cq81.c", 678
+L0013:	ldy     #$84
+	jsr     addysp
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ regi (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_regi: near
+
+	.dbg	func, "regi", "00", extern, "_regi"
+	.dbg	sym, "r00", "00", auto, -2
+	.dbg	sym, "r01", "00", auto, -4
+	.dbg	sym, "r02", "00", auto, -6
+	.dbg	sym, "r03", "00", auto, -8
+	.dbg	sym, "r04", "00", auto, -10
+	.dbg	sym, "r05", "00", auto, -12
+	.dbg	sym, "r06", "00", auto, -14
+	.dbg	sym, "r07", "00", auto, -16
+	.dbg	sym, "r08", "00", auto, -18
+	.dbg	sym, "r09", "00", auto, -20
+	.dbg	sym, "r10", "00", auto, -22
+	.dbg	sym, "r11", "00", auto, -24
+	.dbg	sym, "r12", "00", auto, -26
+	.dbg	sym, "r13", "00", auto, -28
+	.dbg	sym, "r14", "00", auto, -30
+	.dbg	sym, "r15", "00", auto, -32
+	.dbg	sym, "r16", "00", auto, -34
+	.dbg	sym, "r17", "00", auto, -36
+	.dbg	sym, "r18", "00", auto, -38
+	.dbg	sym, "r19", "00", auto, -40
+	.dbg	sym, "r20", "00", auto, -42
+	.dbg	sym, "r21", "00", auto, -44
+	.dbg	sym, "r22", "00", auto, -46
+	.dbg	sym, "r23", "00", auto, -48
+	.dbg	sym, "r24", "00", auto, -50
+	.dbg	sym, "r25", "00", auto, -52
+	.dbg	sym, "r26", "00", auto, -54
+	.dbg	sym, "r27", "00", auto, -56
+	.dbg	sym, "r28", "00", auto, -58
+	.dbg	sym, "r29", "00", auto, -60
+	.dbg	sym, "r30", "00", auto, -62
+	.dbg	sym, "r31", "00", auto, -64
+	.dbg	sym, "r32", "00", auto, -66
+	.dbg	sym, "r33", "00", auto, -68
+	.dbg	sym, "r34", "00", auto, -70
+	.dbg	sym, "r35", "00", auto, -72
+	.dbg	sym, "r36", "00", auto, -74
+	.dbg	sym, "r37", "00", auto, -76
+	.dbg	sym, "r38", "00", auto, -78
+	.dbg	sym, "s", "00", auto, -80
+	.dbg	sym, "n1", "00", auto, -82
+	.dbg	sym, "n2", "00", auto, -84
+	.dbg	sym, "nr", "00", auto, -86
+	.dbg	sym, "j", "00", auto, -88
+	.dbg	sym, "d", "00", auto, -132
+
+.segment	"CODE"
+
+	.dbg	line, "cq81.c", 405
+	ldy     #$84
+	jsr     subysp
+	ldx     #$00
+	lda     #$00
+	ldy     #$82
+	jsr     staxysp
+	.dbg	line, "cq81.c", 406
+	ldx     #$00
+	lda     #$01
+	ldy     #$80
+	jsr     staxysp
+	.dbg	line, "cq81.c", 407
+	ldx     #$00
+	lda     #$02
+	ldy     #$7E
+	jsr     staxysp
+	.dbg	line, "cq81.c", 408
+	ldx     #$00
+	lda     #$03
+	ldy     #$7C
+	jsr     staxysp
+	.dbg	line, "cq81.c", 409
+	ldx     #$00
+	lda     #$04
+	ldy     #$7A
+	jsr     staxysp
+	.dbg	line, "cq81.c", 410
+	ldx     #$00
+	lda     #$05
+	ldy     #$78
+	jsr     staxysp
+	.dbg	line, "cq81.c", 411
+	ldx     #$00
+	lda     #$06
+	ldy     #$76
+	jsr     staxysp
+	.dbg	line, "cq81.c", 412
+	ldx     #$00
+	lda     #$07
+	ldy     #$74
+	jsr     staxysp
+	.dbg	line, "cq81.c", 413
+	ldx     #$00
+	lda     #$08
+	ldy     #$72
+	jsr     staxysp
+	.dbg	line, "cq81.c", 414
+	ldx     #$00
+	lda     #$09
+	ldy     #$70
+	jsr     staxysp
+	.dbg	line, "cq81.c", 415
+	ldx     #$00
+	lda     #$0A
+	ldy     #$6E
+	jsr     staxysp
+	.dbg	line, "cq81.c", 416
+	ldx     #$00
+	lda     #$0B
+	ldy     #$6C
+	jsr     staxysp
+	.dbg	line, "cq81.c", 417
+	ldx     #$00
+	lda     #$0C
+	ldy     #$6A
+	jsr     staxysp
+	.dbg	line, "cq81.c", 418
+	ldx     #$00
+	lda     #$0D
+	ldy     #$68
+	jsr     staxysp
+	.dbg	line, "cq81.c", 419
+	ldx     #$00
+	lda     #$0E
+	ldy     #$66
+	jsr     staxysp
+	.dbg	line, "cq81.c", 420
+	ldx     #$00
+	lda     #$0F
+	ldy     #$64
+	jsr     staxysp
+	.dbg	line, "cq81.c", 421
+	ldx     #$00
+	lda     #$10
+	ldy     #$62
+	jsr     staxysp
+	.dbg	line, "cq81.c", 422
+	ldx     #$00
+	lda     #$11
+	ldy     #$60
+	jsr     staxysp
+	.dbg	line, "cq81.c", 423
+	ldx     #$00
+	lda     #$12
+	ldy     #$5E
+	jsr     staxysp
+	.dbg	line, "cq81.c", 424
+	ldx     #$00
+	lda     #$13
+	ldy     #$5C
+	jsr     staxysp
+	.dbg	line, "cq81.c", 425
+	ldx     #$00
+	lda     #$14
+	ldy     #$5A
+	jsr     staxysp
+	.dbg	line, "cq81.c", 426
+	ldx     #$00
+	lda     #$15
+	ldy     #$58
+	jsr     staxysp
+	.dbg	line, "cq81.c", 427
+	ldx     #$00
+	lda     #$16
+	ldy     #$56
+	jsr     staxysp
+	.dbg	line, "cq81.c", 428
+	ldx     #$00
+	lda     #$17
+	ldy     #$54
+	jsr     staxysp
+	.dbg	line, "cq81.c", 429
+	ldx     #$00
+	lda     #$18
+	ldy     #$52
+	jsr     staxysp
+	.dbg	line, "cq81.c", 430
+	ldx     #$00
+	lda     #$19
+	ldy     #$50
+	jsr     staxysp
+	.dbg	line, "cq81.c", 431
+	ldx     #$00
+	lda     #$1A
+	ldy     #$4E
+	jsr     staxysp
+	.dbg	line, "cq81.c", 432
+	ldx     #$00
+	lda     #$1B
+	ldy     #$4C
+	jsr     staxysp
+	.dbg	line, "cq81.c", 433
+	ldx     #$00
+	lda     #$1C
+	ldy     #$4A
+	jsr     staxysp
+	.dbg	line, "cq81.c", 434
+	ldx     #$00
+	lda     #$1D
+	ldy     #$48
+	jsr     staxysp
+	.dbg	line, "cq81.c", 435
+	ldx     #$00
+	lda     #$1E
+	ldy     #$46
+	jsr     staxysp
+	.dbg	line, "cq81.c", 436
+	ldx     #$00
+	lda     #$1F
+	ldy     #$44
+	jsr     staxysp
+	.dbg	line, "cq81.c", 437
+	ldx     #$00
+	lda     #$20
+	ldy     #$42
+	jsr     staxysp
+	.dbg	line, "cq81.c", 438
+	ldx     #$00
+	lda     #$21
+	ldy     #$40
+	jsr     staxysp
+	.dbg	line, "cq81.c", 439
+	ldx     #$00
+	lda     #$22
+	ldy     #$3E
+	jsr     staxysp
+	.dbg	line, "cq81.c", 440
+	ldx     #$00
+	lda     #$23
+	ldy     #$3C
+	jsr     staxysp
+	.dbg	line, "cq81.c", 441
+	ldx     #$00
+	lda     #$24
+	ldy     #$3A
+	jsr     staxysp
+	.dbg	line, "cq81.c", 442
+	ldx     #$00
+	lda     #$25
+	ldy     #$38
+	jsr     staxysp
+	.dbg	line, "cq81.c", 443
+	ldx     #$00
+	lda     #$26
+	ldy     #$36
+	jsr     staxysp
+	.dbg	line, "cq81.c", 445
+	lda     #$80
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$84
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "cq81.c", 446
+	lda     #$7E
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$82
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "cq81.c", 447
+	lda     #$7C
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$80
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq81.c", 448
+	lda     #$78
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$7E
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	ldy     #$06
+	jsr     staxysp
+	.dbg	line, "cq81.c", 449
+	lda     #$74
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$7A
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	ldy     #$08
+	jsr     staxysp
+	.dbg	line, "cq81.c", 450
+	lda     #$70
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$76
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	ldy     #$0A
+	jsr     staxysp
+	.dbg	line, "cq81.c", 451
+	lda     #$6C
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$72
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq81.c", 452
+	lda     #$68
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$6E
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq81.c", 453
+	lda     #$64
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$6A
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq81.c", 454
+	lda     #$60
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$66
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	ldy     #$12
+	jsr     staxysp
+	.dbg	line, "cq81.c", 455
+	lda     #$5C
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$62
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	ldy     #$14
+	jsr     staxysp
+	.dbg	line, "cq81.c", 456
+	lda     #$58
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$5E
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	ldy     #$16
+	jsr     staxysp
+	.dbg	line, "cq81.c", 457
+	lda     #$54
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$5A
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq81.c", 458
+	lda     #$50
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$56
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	ldy     #$1A
+	jsr     staxysp
+	.dbg	line, "cq81.c", 459
+	lda     #$4C
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$52
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	ldy     #$1C
+	jsr     staxysp
+	.dbg	line, "cq81.c", 460
+	lda     #$48
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$4E
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	ldy     #$1E
+	jsr     staxysp
+	.dbg	line, "cq81.c", 461
+	lda     #$44
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$4A
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	ldy     #$20
+	jsr     staxysp
+	.dbg	line, "cq81.c", 462
+	lda     #$40
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$46
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	ldy     #$22
+	jsr     staxysp
+	.dbg	line, "cq81.c", 463
+	lda     #$3C
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$42
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	ldy     #$24
+	jsr     staxysp
+	.dbg	line, "cq81.c", 464
+	lda     #$3A
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$3E
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	ldy     #$26
+	jsr     staxysp
+	.dbg	line, "cq81.c", 465
+	lda     #$38
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$3C
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	ldy     #$28
+	jsr     staxysp
+	.dbg	line, "cq81.c", 466
+	lda     #$36
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$3A
+	jsr     leaa0sp
+	jsr     tossubax
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     tosdivax
+	ldy     #$2A
+	jsr     staxysp
+	.dbg	line, "cq81.c", 474
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$32
+	jsr     staxysp
+	.dbg	line, "cq81.c", 475
+	ldx     #$00
+	lda     #$01
+	ldy     #$34
+	jsr     staxysp
+	.dbg	line, "cq81.c", 477
+	ldx     #$00
+	lda     #$00
+	ldy     #$2C
+	jsr     staxysp
+	jmp     L0002
+	.dbg	line, "cq81.c", 478
+L0005:	ldy     #$35
+	jsr     ldaxysp
+	jmp     L0007
+	.dbg	line, "cq81.c", 497
+L0007:	cpx     #$00
+	jne     L0010
+	cmp     #$01
+	jeq     L0009
+	cmp     #$02
+	jeq     L000B
+	cmp     #$03
+	jeq     L000E
+	jmp     L0008
+L0010:	jmp     L0008
+	.dbg	line, "cq81.c", 479
+L0009:	ldy     #$2D
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$35
+	jsr     ldaxysp
+	jsr     tosneax
+	jeq     L000A
+	.dbg	line, "cq81.c", 480
+	ldy     #$2D
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$30
+	jsr     staxysp
+	.dbg	line, "cq81.c", 481
+	ldx     #$00
+	lda     #$02
+	ldy     #$34
+	jsr     staxysp
+	.dbg	line, "cq81.c", 482
+	ldx     #$00
+	lda     #$01
+	ldy     #$2E
+	jsr     staxysp
+	.dbg	line, "cq81.c", 484
+L000A:	jmp     L0008
+	.dbg	line, "cq81.c", 485
+L000B:	ldy     #$2D
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$35
+	jsr     ldaxysp
+	jsr     toseqax
+	jeq     L000C
+	.dbg	line, "cq81.c", 486
+	ldx     #$00
+	lda     #$03
+	ldy     #$34
+	jsr     staxysp
+	.dbg	line, "cq81.c", 487
+	jmp     L0008
+	.dbg	line, "cq81.c", 489
+L000C:	ldy     #$2D
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$33
+	jsr     ldaxysp
+	jsr     toseqax
+	jeq     L000D
+	.dbg	line, "cq81.c", 490
+	ldy     #$2F
+	jsr     ldaxysp
+	jsr     incax1
+	ldy     #$2E
+	jsr     staxysp
+	.dbg	line, "cq81.c", 491
+	jmp     L0008
+	.dbg	line, "cq81.c", 493
+L000D:	ldx     #$00
+	lda     #$04
+	ldy     #$34
+	jsr     staxysp
+	.dbg	line, "cq81.c", 494
+	jmp     L0008
+	.dbg	line, "cq81.c", 495
+L000E:	ldy     #$2D
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$35
+	jsr     ldaxysp
+	jsr     tosneax
+	jeq     L000F
+	ldx     #$00
+	lda     #$04
+	ldy     #$34
+	jsr     staxysp
+	.dbg	line, "cq81.c", 496
+L000F:	jmp     L0008
+	.dbg	line, "cq81.c", 477
+L0008:	ldy     #$2D
+	jsr     ldaxysp
+	ldy     #$2C
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0002:	ldy     #$2D
+	jsr     ldaxysp
+	cmp     #$16
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0005
+	.dbg	line, "cq81.c", 500
+	ldy     #$35
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0012
+	cmp     #$03
+L0012:	jsr     booleq
+	jeq     L0011
+	ldx     #$00
+	lda     #$10
+	jsr     pushax
+	ldy     #$31
+	jsr     ldaxysp
+	jsr     tossubax
+	jmp     L0013
+	.dbg	line, "cq81.c", 501
+	jmp     L0013
+L0011:	ldx     #$FF
+	lda     #$FF
+	jmp     L0013
+	.dbg	line, "cq81.c", 502
+L0013:	ldy     #$84
+	jsr     addysp
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ s81 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s81: near
+
+	.dbg	func, "s81", "00", extern, "_s81"
+	.dbg	sym, "pd0", "00", auto, 0
+	.dbg	sym, "ps", "00", auto, -2
+	.dbg	sym, "pt", "00", auto, -4
+	.dbg	sym, "k", "00", auto, -6
+	.dbg	sym, "rc", "00", auto, -8
+	.dbg	sym, "j", "00", auto, -10
+	.dbg	sym, "crc", "00", auto, -12
+	.dbg	sym, "prc", "00", auto, -14
+	.dbg	sym, "irc", "00", auto, -16
+	.dbg	sym, "rchar", "00", auto, -17
+	.dbg	sym, "nrchar", "00", auto, -18
+	.dbg	sym, "rptr", "00", auto, -20
+	.dbg	sym, "nrptr", "00", auto, -22
+	.dbg	sym, "rint", "00", auto, -24
+	.dbg	sym, "nrint", "00", auto, -26
+
+.segment	"CODE"
+
+	.dbg	line, "cq81.c", 58
+	jsr     pushax
+	.dbg	line, "cq81.c", 72
+	ldy     #$1A
+	jsr     subysp
+	ldx     #$00
+	lda     #$00
+	ldy     #$12
+	jsr     staxysp
+	.dbg	line, "cq81.c", 73
+	ldx     #$00
+	lda     #$00
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq81.c", 74
+	ldx     #$00
+	lda     #$00
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq81.c", 75
+	ldx     #$00
+	lda     #$00
+	ldy     #$0A
+	jsr     staxysp
+	.dbg	line, "cq81.c", 76
+	lda     #<(M0002)
+	ldx     #>(M0002)
+	ldy     #$18
+	jsr     staxysp
+	.dbg	line, "cq81.c", 77
+	ldy     #$1B
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     incaxy
+	ldy     #$16
+	jsr     staxysp
+	.dbg	line, "cq81.c", 79
+	jmp     L0002
+L0002:	ldy     #$17
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1B
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$00
+	jsr     staspidx
+	tax
+	php
+	ldy     #$16
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$18
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	jne     L0002
+	.dbg	line, "cq81.c", 97
+	ldx     #$00
+	lda     #$01
+	ldy     #$14
+	jsr     staxysp
+	.dbg	line, "cq81.c", 98
+	ldx     #$00
+	lda     #$00
+	ldy     #$10
+	jsr     staxysp
+	jmp     L0005
+	.dbg	line, "cq81.c", 99
+L0008:	ldy     #$14
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$09
+	sta     (sp),y
+	.dbg	line, "cq81.c", 100
+	ldy     #$14
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$08
+	sta     (sp),y
+	.dbg	line, "cq81.c", 101
+	lda     #$14
+	jsr     leaa0sp
+	ldy     #$06
+	jsr     staxysp
+	.dbg	line, "cq81.c", 102
+	lda     #$14
+	jsr     leaa0sp
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq81.c", 103
+	ldy     #$15
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "cq81.c", 104
+	ldy     #$15
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "cq81.c", 106
+	ldy     #$09
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$0A
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosneax
+	jeq     L000A
+	ldx     #$00
+	lda     #$01
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq81.c", 107
+L000A:	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosneax
+	jeq     L000B
+	ldx     #$00
+	lda     #$01
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq81.c", 108
+L000B:	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosneax
+	jeq     L000C
+	ldx     #$00
+	lda     #$01
+	ldy     #$0A
+	jsr     staxysp
+	.dbg	line, "cq81.c", 109
+L000C:	ldy     #$15
+	jsr     ldaxysp
+	jsr     aslax1
+	ldy     #$14
+	jsr     staxysp
+	.dbg	line, "cq81.c", 98
+	ldy     #$11
+	jsr     ldaxysp
+	ldy     #$10
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0005
+L0005:	ldy     #$11
+	jsr     ldaxysp
+	cmp     #$32
+	txa
+	sbc     #$00
+	bvc     L0009
+	eor     #$80
+L0009:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0008
+	.dbg	line, "cq81.c", 112
+	ldy     #$0F
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L000E
+	cmp     #$00
+L000E:	jsr     boolne
+	jeq     L000F
+	.dbg	line, "cq81.c", 113
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     incax1
+	ldy     #$12
+	jsr     staxysp
+	.dbg	line, "cq81.c", 114
+	ldy     #$1B
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0010
+	cmp     #$00
+L0010:	jsr     boolne
+	jeq     L000F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq81.c", 117
+L000F:	ldy     #$0D
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0012
+	cmp     #$00
+L0012:	jsr     boolne
+	jeq     L0013
+	.dbg	line, "cq81.c", 118
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     incax2
+	ldy     #$12
+	jsr     staxysp
+	.dbg	line, "cq81.c", 119
+	ldy     #$1B
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0014
+	cmp     #$00
+L0014:	jsr     boolne
+	jeq     L0013
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq81.c", 122
+L0013:	ldy     #$0B
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0016
+	cmp     #$00
+L0016:	jsr     boolne
+	jeq     L0017
+	.dbg	line, "cq81.c", 123
+	ldy     #$13
+	jsr     ldaxysp
+	jsr     incax4
+	ldy     #$12
+	jsr     staxysp
+	.dbg	line, "cq81.c", 124
+	ldy     #$1B
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0018
+	cmp     #$00
+L0018:	jsr     boolne
+	jeq     L0017
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$04
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq81.c", 130
+L0017:	jsr     _regc
+	ldy     #$14
+	jsr     staxysp
+	.dbg	line, "cq81.c", 131
+	ldy     #$1B
+	jsr     ldaxysp
+	ldy     #$11
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L001A
+	cmp     #$00
+L001A:	jsr     boolne
+	jeq     L001C
+	.dbg	line, "cq81.c", 132
+	ldy     #$15
+	jsr     ldaxysp
+	cpx     #$80
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L001B
+	lda     #<(M0003)
+	ldx     #>(M0003)
+	jsr     pushax
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq81.c", 133
+	jmp     L001C
+L001B:	lda     #<(M0004)
+	ldx     #>(M0004)
+	jsr     pushax
+	ldy     #$17
+	jsr     ldaxysp
+	jsr     pushax
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "cq81.c", 136
+L001C:	jsr     _regp
+	ldy     #$14
+	jsr     staxysp
+	.dbg	line, "cq81.c", 137
+	ldy     #$1B
+	jsr     ldaxysp
+	ldy     #$11
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L001E
+	cmp     #$00
+L001E:	jsr     boolne
+	jeq     L0020
+	.dbg	line, "cq81.c", 138
+	ldy     #$15
+	jsr     ldaxysp
+	cpx     #$80
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L001F
+	lda     #<(M0003)
+	ldx     #>(M0003)
+	jsr     pushax
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq81.c", 139
+	jmp     L0020
+L001F:	lda     #<(M0004)
+	ldx     #>(M0004)
+	jsr     pushax
+	ldy     #$17
+	jsr     ldaxysp
+	jsr     pushax
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "cq81.c", 142
+L0020:	jsr     _regi
+	ldy     #$14
+	jsr     staxysp
+	.dbg	line, "cq81.c", 143
+	ldy     #$1B
+	jsr     ldaxysp
+	ldy     #$11
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0022
+	cmp     #$00
+L0022:	jsr     boolne
+	jeq     L0024
+	.dbg	line, "cq81.c", 144
+	ldy     #$15
+	jsr     ldaxysp
+	cpx     #$80
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L0023
+	lda     #<(M0003)
+	ldx     #>(M0003)
+	jsr     pushax
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq81.c", 145
+	jmp     L0024
+L0023:	lda     #<(M0004)
+	ldx     #>(M0004)
+	jsr     pushax
+	ldy     #$17
+	jsr     ldaxysp
+	jsr     pushax
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "cq81.c", 148
+L0024:	ldy     #$13
+	jsr     ldaxysp
+	jmp     L0001
+	.dbg	line, "cq81.c", 149
+L0001:	ldy     #$1C
+	jsr     addysp
+	rts
+
+	.dbg	line
+.segment	"DATA"
+
+M0001:
+	.byte	$73,$38,$31,$2C,$65,$72,$25,$64,$0A,$00
+M0002:
+	.byte	$73,$38,$31,$20,$20,$20,$20,$00
+M0003:
+	.byte	$52,$65,$67,$69,$73,$74,$65,$72,$20,$63,$6F,$75,$6E,$74,$20,$66
+	.byte	$6F,$72,$20,$25,$73,$20,$69,$73,$20,$75,$6E,$72,$65,$6C,$69,$61
+	.byte	$62,$6C,$65,$2E,$0A,$00
+M0004:
+	.byte	$25,$64,$20,$72,$65,$67,$69,$73,$74,$65,$72,$73,$20,$61,$73,$73
+	.byte	$69,$67,$6E,$65,$64,$20,$74,$6F,$20,$25,$73,$20,$76,$61,$72,$69
+	.byte	$61,$62,$6C,$65,$73,$2E,$0A,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ section (int j, void *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_section: near
+
+	.dbg	func, "section", "00", extern, "_section"
+	.dbg	sym, "j", "00", auto, 2
+	.dbg	sym, "pd0", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "cq81.c", 687
+	jsr     pushax
+	.dbg	line, "cq81.c", 689
+	ldy     #$03
+	jsr     ldaxysp
+	jmp     L0002
+	.dbg	line, "cq81.c", 691
+L0002:	cpx     #$00
+	jne     L0005
+	cmp     #$00
+	jeq     L0004
+	jmp     L0003
+L0005:	jmp     L0003
+	.dbg	line, "cq81.c", 690
+L0004:	ldy     #$01
+	jsr     ldaxysp
+	jsr     _s81
+	jmp     L0003
+	.dbg	line, "cq81.c", 692
+L0003:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+	.dbg	sym, "n", "00", auto, 2
+	.dbg	sym, "args", "00", auto, 0
+	.dbg	sym, "j", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "cq81.c", 712
+	jsr     decsp2
+	ldx     #$00
+	lda     #$01
+	sta     M0001+14
+	stx     M0001+14+1
+	.dbg	line, "cq81.c", 713
+	ldx     #$00
+	lda     #$01
+	sta     M0001+16
+	stx     M0001+16+1
+	.dbg	line, "cq81.c", 714
+	ldx     #$00
+	lda     #$01
+	sta     M0001+18
+	stx     M0001+18+1
+	.dbg	line, "cq81.c", 715
+	ldx     #$00
+	lda     #$01
+	sta     M0001+20
+	stx     M0001+20+1
+	.dbg	line, "cq81.c", 717
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	sta     M0002
+	stx     M0002+1
+	.dbg	line, "cq81.c", 719
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+	jmp     L0002
+	.dbg	line, "cq81.c", 720
+L0005:	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	lda     M0002
+	ldx     M0002+1
+	jsr     _section
+	sta     M0001+22
+	stx     M0001+22+1
+	.dbg	line, "cq81.c", 721
+	lda     M0001+24
+	ldx     M0001+24+1
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     tosaddax
+	sta     M0001+24
+	stx     M0001+24+1
+	.dbg	line, "cq81.c", 722
+	lda     M0001+14
+	ldx     M0001+14+1
+	cpx     #$00
+	bne     L0008
+	cmp     #$00
+L0008:	jsr     boolne
+	jeq     L0007
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	lda     #<(M0001+26)
+	ldx     #>(M0001+26)
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "cq81.c", 719
+L0007:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0005
+	.dbg	line, "cq81.c", 725
+	lda     M0001+24
+	ldx     M0001+24+1
+	cpx     #$00
+	bne     L000A
+	cmp     #$00
+L000A:	jsr     booleq
+	jeq     L0009
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cq81.c", 726
+	jmp     L000B
+L0009:	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cq81.c", 728
+L000B:	lda     M0001+24
+	ldx     M0001+24+1
+	jmp     L0001
+	.dbg	line, "cq81.c", 729
+L0001:	jsr     incsp6
+	rts
+
+	.dbg	line
+.segment	"BSS"
+
+M0001:
+	.res	34,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
@@ -0,0 +1,998 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_printf
+	.export		_lbits
+	.export		_ubits
+	.export		_fbits
+	.export		_dbits
+	.export		_flgs
+	.export		_flgm
+	.export		_flgd
+	.export		_flgl
+	.export		_rrc
+	.export		_crc
+	.export		_rfs
+	.export		_s84
+	.export		_section
+	.export		_main
+
+.segment	"RODATA"
+
+S0003:
+	.byte	$53,$65,$63,$74,$69,$6F,$6E,$20,$25,$73,$20,$72,$65,$74,$75,$72
+	.byte	$6E,$65,$64,$20,$25,$64,$2E,$0A,$00
+S0004:
+	.byte	$0A,$4E,$6F,$20,$65,$72,$72,$6F,$72,$73,$20,$64,$65,$74,$65,$63
+	.byte	$74,$65,$64,$2E,$0A,$00
+S0005:
+	.byte	$0A,$46,$61,$69,$6C,$65,$64,$2E,$0A,$00
+
+.segment	"BSS"
+
+_lbits:
+	.res	2,$00
+_ubits:
+	.res	2,$00
+_fbits:
+	.res	2,$00
+_dbits:
+	.res	2,$00
+_flgs:
+	.res	2,$00
+_flgm:
+	.res	2,$00
+_flgd:
+	.res	2,$00
+_flgl:
+	.res	2,$00
+_rrc:
+	.res	2,$00
+_crc:
+	.res	2,$00
+_rfs:
+	.res	8,$00
+
+; ---------------------------------------------------------------
+; int __near__ s84 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s84: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$56
+	jsr     subysp
+	lda     #<(M0003)
+	ldx     #>(M0003)
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$57
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$1A
+	bcc     L0002
+	inx
+L0002:	jsr     stax0sp
+	ldy     #$04
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+L0003:	ldy     #$01
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	ldy     #$03
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$00
+	lda     (ptr1),y
+	sta     (sreg),y
+	tax
+	php
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	bne     L0003
+	ldx     #$00
+	lda     #$03
+	jsr     _fip
+	ldy     #$54
+	jsr     staxysp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     #$00
+	bne     L0041
+	cmp     #$03
+	beq     L0048
+L0041:	ldy     #$57
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$13
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     #$00
+	bne     L0042
+	cmp     #$00
+	beq     L0008
+L0042:	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L0008:	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$01
+	bcc     L000A
+	inx
+L000A:	jsr     staxysp
+	ldx     #$00
+L0048:	lda     #$04
+	jsr     _glork
+	cpx     #$00
+	bne     L0043
+	cmp     #$04
+	beq     L000B
+L0043:	ldy     #$57
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$13
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     #$00
+	bne     L0044
+	cmp     #$00
+	beq     L000D
+L0044:	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	lda     #$02
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L000D:	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$02
+	bcc     L000F
+	inx
+L000F:	jsr     staxysp
+L000B:	ldy     #$4E
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L0037
+L0013:	iny
+	lda     (sp),y
+	sta     tmp1
+	dey
+	lda     (sp),y
+	asl     a
+	rol     tmp1
+	ldx     tmp1
+	clc
+	adc     #$2A
+	bcc     L0015
+	inx
+	clc
+L0015:	adc     sp
+	sta     ptr1
+	txa
+	adc     sp+1
+	sta     ptr1+1
+	iny
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$00
+	sta     (ptr1),y
+	iny
+	txa
+	sta     (ptr1),y
+	ldy     #$4F
+	lda     (sp),y
+	sta     tmp1
+	dey
+	lda     (sp),y
+	asl     a
+	rol     tmp1
+	ldx     tmp1
+	clc
+	adc     #$08
+	bcc     L0016
+	inx
+	clc
+L0016:	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	jsr     pushax
+	ldy     #$51
+	lda     (sp),y
+	sta     tmp1
+	dey
+	lda     (sp),y
+	asl     a
+	rol     tmp1
+	ldx     tmp1
+	clc
+	adc     #$2C
+	bcc     L0017
+	inx
+	clc
+L0017:	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$4E
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$4F
+L0037:	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cmp     #$11
+	txa
+	sbc     #$00
+	bvc     L0014
+	eor     #$80
+L0014:	jmi     L0013
+	ldy     #$06
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$4E
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L0038
+L001B:	iny
+	lda     (sp),y
+	sta     tmp1
+	dey
+	lda     (sp),y
+	asl     a
+	rol     tmp1
+	ldx     tmp1
+	clc
+	adc     #$08
+	bcc     L001D
+	inx
+	clc
+L001D:	adc     sp
+	sta     ptr1
+	txa
+	adc     sp+1
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	sta     ptr1
+	stx     ptr1+1
+	iny
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	ldy     #$06
+	jsr     addeqysp
+	ldy     #$4E
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$4F
+L0038:	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cmp     #$11
+	txa
+	sbc     #$00
+	bvc     L001C
+	eor     #$80
+L001C:	bmi     L001B
+	ldy     #$07
+	lda     (sp),y
+	bne     L0045
+	dey
+	lda     (sp),y
+	cmp     #$88
+	beq     L0039
+L0045:	ldy     #$57
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$13
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     #$00
+	bne     L0046
+	cmp     #$00
+	beq     L0020
+L0046:	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	tay
+	jsr     _printf
+L0020:	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$04
+	bcc     L0022
+	inx
+L0022:	jsr     staxysp
+L0039:	ldy     #$52
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L0040
+L003B:	ldy     #$4E
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L003F
+L003D:	ldy     #$4C
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L003E
+L0030:	ldy     #$55
+	jsr     pushwysp
+	lda     #$46
+	jsr     tosmula0
+	clc
+	adc     #<(M0001)
+	sta     sreg
+	txa
+	adc     #>(M0001)
+	sta     sreg+1
+	ldy     #$4F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	sta     ptr1
+	stx     ptr1+1
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	sec
+	sbc     ptr1
+	tay
+	lda     tmp1
+	sbc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	clc
+	adc     sreg
+	sta     ptr1
+	lda     tmp1
+	adc     sreg+1
+	sta     ptr1+1
+	ldy     #$4D
+	lda     (sp),y
+	sta     tmp1
+	dey
+	lda     (sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	pha
+	lda     tmp1
+	adc     ptr1+1
+	tax
+	pla
+	jsr     pushax
+	ldy     #$57
+	jsr     pushwysp
+	lda     #$23
+	jsr     tosmula0
+	jsr     pushax
+	ldy     #$53
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     mulax7
+	jsr     tosaddax
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$4F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$4C
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$4D
+L003E:	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cmp     #$07
+	txa
+	sbc     #$00
+	bvc     L0031
+	eor     #$80
+L0031:	jmi     L0030
+	ldy     #$4E
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$4F
+L003F:	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cmp     #$05
+	txa
+	sbc     #$00
+	bvc     L002C
+	eor     #$80
+L002C:	jmi     L003D
+	ldy     #$52
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$53
+L0040:	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cmp     #$03
+	txa
+	sbc     #$00
+	bvc     L0027
+	eor     #$80
+L0027:	jmi     L003B
+	lda     #$01
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$4E
+	lda     #$02
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$4C
+	lda     #$03
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$69
+	jsr     pusha0
+	lda     #$00
+	jsr     _array
+	jsr     pushax
+	ldy     #$57
+	jsr     pushwysp
+	lda     #$46
+	jsr     tosmula0
+	clc
+	adc     #<(M0001)
+	tay
+	txa
+	adc     #>(M0001)
+	tax
+	tya
+	jsr     pushax
+	lda     #$23
+	jsr     pusha0
+	jsr     _array
+	jsr     tosaddax
+	jsr     pushax
+	ldy     #$57
+	jsr     pushwysp
+	lda     #$46
+	jsr     tosmula0
+	clc
+	adc     #<(M0001)
+	sta     sreg
+	txa
+	adc     #>(M0001)
+	sta     sreg+1
+	ldy     #$51
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	sta     ptr1
+	stx     ptr1+1
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	sec
+	sbc     ptr1
+	tay
+	lda     tmp1
+	sbc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	clc
+	adc     sreg
+	pha
+	lda     tmp1
+	adc     sreg+1
+	tax
+	pla
+	jsr     pushax
+	lda     #$07
+	jsr     pusha0
+	lda     #$31
+	jsr     _array
+	jsr     tosaddax
+	jsr     pushax
+	ldy     #$57
+	jsr     pushwysp
+	lda     #$46
+	jsr     tosmula0
+	clc
+	adc     #<(M0001)
+	sta     sreg
+	txa
+	adc     #>(M0001)
+	sta     sreg+1
+	ldy     #$51
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	sta     ptr1
+	stx     ptr1+1
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	sec
+	sbc     ptr1
+	tay
+	lda     tmp1
+	sbc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	clc
+	adc     sreg
+	sta     ptr1
+	lda     tmp1
+	adc     sreg+1
+	sta     ptr1+1
+	ldy     #$4F
+	lda     (sp),y
+	sta     tmp1
+	dey
+	lda     (sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	sta     ptr1
+	lda     tmp1
+	adc     ptr1+1
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     tosaddax
+	sec
+	sbc     #$34
+	bcs     L0033
+	dex
+L0033:	stx     tmp1
+	ora     tmp1
+	beq     L0032
+	ldy     #$57
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$13
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     #$00
+	bne     L0047
+	cmp     #$00
+	beq     L0034
+L0047:	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	lda     #$08
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L0034:	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$08
+	bcc     L0036
+	inx
+L0036:	jsr     staxysp
+L0032:	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$58
+	jmp     addysp
+
+.segment	"DATA"
+
+M0002:
+	.byte	$73,$38,$34,$2C,$65,$72,$25,$64,$0A,$00
+M0003:
+	.byte	$73,$38,$34,$20,$20,$20,$20,$00
+
+.segment	"BSS"
+
+M0001:
+	.res	210,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int *__near__ fip (int x)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fip: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$01
+	lda     (sp),y
+	sta     M0001+1
+	dey
+	lda     (sp),y
+	sta     M0001
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jmp     incsp2
+
+.segment	"BSS"
+
+M0001:
+	.res	2,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ array (int *a, int size, int start)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_array: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp2
+	ldy     #$00
+	tya
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L0008
+L0005:	ldy     #$01
+	lda     (sp),y
+	sta     tmp1
+	dey
+	lda     (sp),y
+	asl     a
+	rol     tmp1
+	clc
+	ldy     #$06
+	adc     (sp),y
+	sta     ptr1
+	lda     tmp1
+	iny
+	adc     (sp),y
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     pushax
+	ldy     #$02
+	lda     (sp),y
+	ldy     #$04
+	clc
+	adc     (sp),y
+	pha
+	dey
+	lda     (sp),y
+	ldy     #$05
+	adc     (sp),y
+	tax
+	pla
+	jsr     tosicmp
+	beq     L0006
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+L0006:	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	ldy     #$01
+L0008:	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$04
+	cmp     (sp),y
+	txa
+	iny
+	sbc     (sp),y
+	bvc     L0007
+	eor     #$80
+L0007:	bmi     L0005
+	ldx     #$00
+	txa
+L0001:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ glork (int x)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_glork: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$01
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ section (int j, void *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_section: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$02
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	bne     L0003
+	ldy     #$01
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _s84
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	ldx     #$00
+	lda     #$01
+	sta     M0001+14
+	stx     M0001+14+1
+	sta     M0001+16
+	stx     M0001+16+1
+	sta     M0001+18
+	stx     M0001+18+1
+	sta     M0001+20
+	stx     M0001+20+1
+	lda     #>(M0001)
+	sta     M0002+1
+	lda     #<(M0001)
+	sta     M0002
+	ldy     #$00
+	txa
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L000D
+L0005:	jsr     pushw0sp
+	lda     M0002
+	ldx     M0002+1
+	jsr     _section
+	sta     M0001+22
+	stx     M0001+22+1
+	lda     M0001+24
+	clc
+	adc     M0001+22
+	sta     M0001+24
+	lda     M0001+24+1
+	adc     M0001+22+1
+	sta     M0001+24+1
+	lda     M0001+14
+	ora     M0001+14+1
+	beq     L0007
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     #<(M0001+26)
+	ldx     #>(M0001+26)
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+L0007:	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	ldy     #$01
+L000D:	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	bmi     L0005
+	lda     M0001+24
+	ora     M0001+24+1
+	bne     L0009
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jmp     L000F
+L0009:	lda     #<(S0005)
+	ldx     #>(S0005)
+L000F:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     M0001+24
+	ldx     M0001+24+1
+	jmp     incsp6
+
+.segment	"BSS"
+
+M0001:
+	.res	34,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
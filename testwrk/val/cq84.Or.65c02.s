@@ -0,0 +1,755 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_printf
+	.export		_lbits
+	.export		_ubits
+	.export		_fbits
+	.export		_dbits
+	.export		_flgs
+	.export		_flgm
+	.export		_flgd
+	.export		_flgl
+	.export		_rrc
+	.export		_crc
+	.export		_rfs
+	.export		_s84
+	.export		_section
+	.export		_main
+
+.segment	"RODATA"
+
+S0003:
+	.byte	$53,$65,$63,$74,$69,$6F,$6E,$20,$25,$73,$20,$72,$65,$74,$75,$72
+	.byte	$6E,$65,$64,$20,$25,$64,$2E,$0A,$00
+S0004:
+	.byte	$0A,$4E,$6F,$20,$65,$72,$72,$6F,$72,$73,$20,$64,$65,$74,$65,$63
+	.byte	$74,$65,$64,$2E,$0A,$00
+S0005:
+	.byte	$0A,$46,$61,$69,$6C,$65,$64,$2E,$0A,$00
+
+.segment	"BSS"
+
+_lbits:
+	.res	2,$00
+_ubits:
+	.res	2,$00
+_fbits:
+	.res	2,$00
+_dbits:
+	.res	2,$00
+_flgs:
+	.res	2,$00
+_flgm:
+	.res	2,$00
+_flgd:
+	.res	2,$00
+_flgl:
+	.res	2,$00
+_rrc:
+	.res	2,$00
+_crc:
+	.res	2,$00
+_rfs:
+	.res	8,$00
+
+; ---------------------------------------------------------------
+; int __near__ s84 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s84: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$56
+	jsr     subysp
+	lda     #<(M0003)
+	ldx     #>(M0003)
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$57
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     incaxy
+	jsr     stax0sp
+	ldx     #$00
+	txa
+	ldy     #$04
+	jsr     staxysp
+L0002:	jsr     ldax0sp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$03
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1)
+	sta     (sreg)
+	tax
+	php
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	bne     L0002
+	ldx     #$00
+	lda     #$03
+	jsr     _fip
+	ldy     #$54
+	jsr     staxysp
+	jsr     ldaxi
+	cpx     #$00
+	bne     L0037
+	cmp     #$03
+	beq     L003E
+L0037:	ldy     #$57
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0038
+	cmp     #$00
+	beq     L0007
+L0038:	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L0007:	ldy     #$05
+	jsr     ldaxysp
+	ina
+	bne     L0009
+	inx
+L0009:	ldy     #$04
+	jsr     staxysp
+	ldx     #$00
+L003E:	lda     #$04
+	jsr     _glork
+	cpx     #$00
+	bne     L0039
+	cmp     #$04
+	beq     L003F
+L0039:	ldy     #$57
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L003A
+	cmp     #$00
+	beq     L000C
+L003A:	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	lda     #$02
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L000C:	ldy     #$05
+	jsr     ldaxysp
+	jsr     incax2
+	ldy     #$04
+	jsr     staxysp
+	ldx     #$00
+L003F:	txa
+	ldy     #$4E
+	jsr     staxysp
+	bra     L000E
+L0011:	ldy     #$4F
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #$2A
+	bcc     L0013
+	inx
+	clc
+L0013:	adc     sp
+	sta     ptr1
+	txa
+	adc     sp+1
+	sta     ptr1+1
+	ldy     #$4F
+	jsr     ldaxysp
+	sta     (ptr1)
+	ldy     #$01
+	txa
+	sta     (ptr1),y
+	ldy     #$4F
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #$08
+	bcc     L0014
+	inx
+	clc
+L0014:	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	jsr     pushax
+	ldy     #$51
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #$2C
+	bcc     L0015
+	inx
+	clc
+L0015:	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$4E
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L000E:	ldy     #$4F
+	jsr     ldaxysp
+	cmp     #$11
+	txa
+	sbc     #$00
+	bvc     L0012
+	eor     #$80
+L0012:	bmi     L0011
+	ldx     #$00
+	txa
+	ldy     #$06
+	jsr     staxysp
+	ldy     #$4E
+	jsr     staxysp
+	bra     L0016
+L0019:	ldy     #$4F
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #$08
+	bcc     L001B
+	inx
+	clc
+L001B:	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	jsr     ldaxi
+	jsr     ldaxi
+	ldy     #$06
+	jsr     addeqysp
+	ldy     #$4E
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L0016:	ldy     #$4F
+	jsr     ldaxysp
+	cmp     #$11
+	txa
+	sbc     #$00
+	bvc     L001A
+	eor     #$80
+L001A:	asl     a
+	ldx     #$00
+	bcs     L0019
+	ldy     #$07
+	lda     (sp),y
+	bne     L003B
+	dey
+	lda     (sp),y
+	cmp     #$88
+	beq     L0032
+L003B:	ldy     #$57
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L003C
+	cmp     #$00
+	beq     L001E
+L003C:	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	tay
+	jsr     _printf
+L001E:	ldy     #$05
+	jsr     ldaxysp
+	jsr     incax4
+	ldy     #$04
+	jsr     staxysp
+	ldx     #$00
+L0032:	txa
+	ldy     #$52
+	jsr     staxysp
+	jmp     L0020
+L0034:	ldy     #$4E
+	jsr     staxysp
+	jmp     L0025
+L0036:	ldy     #$4C
+	jsr     staxysp
+	bra     L002A
+L002D:	ldy     #$55
+	jsr     pushwysp
+	lda     #$46
+	jsr     tosmula0
+	clc
+	adc     #<(M0001)
+	tay
+	txa
+	adc     #>(M0001)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$53
+	jsr     pushwysp
+	lda     #$0E
+	jsr     tosmula0
+	jsr     tosaddax
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$4D
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	jsr     pushax
+	ldy     #$57
+	jsr     pushwysp
+	lda     #$23
+	jsr     tosmula0
+	jsr     pushax
+	ldy     #$53
+	jsr     ldaxysp
+	jsr     mulax7
+	jsr     tosaddax
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$4F
+	jsr     ldaxysp
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$4C
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L002A:	ldy     #$4D
+	jsr     ldaxysp
+	cmp     #$07
+	txa
+	sbc     #$00
+	bvc     L002E
+	eor     #$80
+L002E:	jmi     L002D
+	ldy     #$4E
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L0025:	ldy     #$4F
+	jsr     ldaxysp
+	cmp     #$05
+	txa
+	sbc     #$00
+	bvc     L0029
+	eor     #$80
+L0029:	asl     a
+	lda     #$00
+	tax
+	jcs     L0036
+	ldy     #$52
+	ina
+	jsr     addeqysp
+L0020:	ldy     #$53
+	jsr     ldaxysp
+	cmp     #$03
+	txa
+	sbc     #$00
+	bvc     L0024
+	eor     #$80
+L0024:	asl     a
+	lda     #$00
+	tax
+	jcs     L0034
+	ina
+	ldy     #$52
+	jsr     staxysp
+	ina
+	ldy     #$4E
+	jsr     staxysp
+	ina
+	ldy     #$4C
+	jsr     staxysp
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$69
+	jsr     pusha0
+	lda     #$00
+	jsr     _array
+	jsr     pushax
+	ldy     #$57
+	jsr     pushwysp
+	lda     #$46
+	jsr     tosmula0
+	clc
+	adc     #<(M0001)
+	tay
+	txa
+	adc     #>(M0001)
+	tax
+	tya
+	jsr     pushax
+	lda     #$23
+	jsr     pusha0
+	jsr     _array
+	jsr     tosaddax
+	jsr     pushax
+	ldy     #$57
+	jsr     pushwysp
+	lda     #$46
+	jsr     tosmula0
+	clc
+	adc     #<(M0001)
+	tay
+	txa
+	adc     #>(M0001)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$55
+	jsr     pushwysp
+	lda     #$0E
+	jsr     tosmula0
+	jsr     tosaddax
+	jsr     pushax
+	lda     #$07
+	jsr     pusha0
+	lda     #$31
+	jsr     _array
+	jsr     tosaddax
+	jsr     pushax
+	ldy     #$57
+	jsr     pushwysp
+	lda     #$46
+	jsr     tosmula0
+	clc
+	adc     #<(M0001)
+	tay
+	txa
+	adc     #>(M0001)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$55
+	jsr     pushwysp
+	lda     #$0E
+	jsr     tosmula0
+	jsr     tosaddax
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$4F
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	jsr     ldaxi
+	jsr     tosaddax
+	ldy     #$34
+	jsr     decaxy
+	stx     tmp1
+	ora     tmp1
+	beq     L002F
+	ldy     #$57
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L003D
+	cmp     #$00
+	beq     L0030
+L003D:	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	lda     #$08
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L0030:	ldy     #$05
+	jsr     ldaxysp
+	jsr     incax8
+	ldy     #$04
+	jsr     staxysp
+L002F:	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$58
+	jmp     addysp
+
+.segment	"DATA"
+
+M0002:
+	.byte	$73,$38,$34,$2C,$65,$72,$25,$64,$0A,$00
+M0003:
+	.byte	$73,$38,$34,$20,$20,$20,$20,$00
+
+.segment	"BSS"
+
+M0001:
+	.res	210,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int *__near__ fip (int x)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fip: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     ldax0sp
+	sta     M0001
+	stx     M0001+1
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jmp     incsp2
+
+.segment	"BSS"
+
+M0001:
+	.res	2,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ array (int *a, int size, int start)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_array: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp2
+	ldx     #$00
+	txa
+	jsr     stax0sp
+	bra     L0002
+L0005:	jsr     ldax0sp
+	jsr     aslax1
+	clc
+	ldy     #$06
+	adc     (sp),y
+	pha
+	txa
+	iny
+	adc     (sp),y
+	tax
+	pla
+	jsr     pushw
+	ldy     #$05
+	jsr     ldaxysp
+	clc
+	ldy     #$02
+	adc     (sp),y
+	pha
+	txa
+	iny
+	adc     (sp),y
+	tax
+	pla
+	jsr     tosicmp
+	beq     L0006
+	ldx     #$00
+	lda     #$01
+	bra     L0001
+L0006:	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+L0002:	jsr     ldax0sp
+	ldy     #$04
+	cmp     (sp),y
+	txa
+	iny
+	sbc     (sp),y
+	bvc     L0007
+	eor     #$80
+L0007:	bmi     L0005
+	ldx     #$00
+	txa
+L0001:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ glork (int x)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_glork: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     ldax0sp
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ section (int j, void *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_section: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$02
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	bne     L0003
+	jsr     ldax0sp
+	jsr     _s84
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	ldx     #$00
+	lda     #$01
+	sta     M0001+14
+	stz     M0001+14+1
+	sta     M0001+16
+	stz     M0001+16+1
+	sta     M0001+18
+	stz     M0001+18+1
+	sta     M0001+20
+	stz     M0001+20+1
+	lda     #>(M0001)
+	sta     M0002+1
+	lda     #<(M0001)
+	sta     M0002
+	txa
+	jsr     stax0sp
+	bra     L0002
+L0005:	jsr     pushw0sp
+	lda     M0002
+	ldx     M0002+1
+	jsr     _section
+	sta     M0001+22
+	stx     M0001+22+1
+	lda     M0001+24
+	clc
+	adc     M0001+22
+	sta     M0001+24
+	lda     M0001+24+1
+	adc     M0001+22+1
+	sta     M0001+24+1
+	lda     M0001+14
+	ora     M0001+14+1
+	beq     L0007
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     #<(M0001+26)
+	ldx     #>(M0001+26)
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+L0007:	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+L0002:	jsr     ldax0sp
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	bmi     L0005
+	lda     M0001+24
+	ora     M0001+24+1
+	bne     L0009
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	bra     L000E
+L0009:	lda     #<(S0005)
+	ldx     #>(S0005)
+L000E:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     M0001+24
+	ldx     M0001+24+1
+	jmp     incsp6
+
+.segment	"BSS"
+
+M0001:
+	.res	34,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
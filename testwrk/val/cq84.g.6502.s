@@ -0,0 +1,973 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "cq84.c", 6796, 1613073744
+	.dbg		file, "common.h", 522, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/stdlib.h", 5999, 1613073744
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_lbits
+	.export		_ubits
+	.export		_fbits
+	.export		_dbits
+	.export		_flgs
+	.export		_flgm
+	.export		_flgd
+	.export		_flgl
+	.export		_rrc
+	.export		_crc
+	.export		_rfs
+	.export		_s84
+	.export		_section
+	.export		_main
+
+.segment	"RODATA"
+
+S0003:
+	.byte	$53,$65,$63,$74,$69,$6F,$6E,$20,$25,$73,$20,$72,$65,$74,$75,$72
+	.byte	$6E,$65,$64,$20,$25,$64,$2E,$0A,$00
+S0004:
+	.byte	$0A,$4E,$6F,$20,$65,$72,$72,$6F,$72,$73,$20,$64,$65,$74,$65,$63
+	.byte	$74,$65,$64,$2E,$0A,$00
+S0005:
+	.byte	$0A,$46,$61,$69,$6C,$65,$64,$2E,$0A,$00
+
+.segment	"BSS"
+
+_lbits:
+	.res	2,$00
+_ubits:
+	.res	2,$00
+_fbits:
+	.res	2,$00
+_dbits:
+	.res	2,$00
+_flgs:
+	.res	2,$00
+_flgm:
+	.res	2,$00
+_flgd:
+	.res	2,$00
+_flgl:
+	.res	2,$00
+_rrc:
+	.res	2,$00
+_crc:
+	.res	2,$00
+_rfs:
+	.res	8,$00
+
+; ---------------------------------------------------------------
+; int __near__ s84 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s84: near
+
+	.dbg	func, "s84", "00", extern, "_s84"
+	.dbg	sym, "pd0", "00", auto, 0
+	.dbg	sym, "ip", "00", auto, -2
+	.dbg	sym, "i", "00", auto, -4
+	.dbg	sym, "pfi", "00", auto, -6
+	.dbg	sym, "j", "00", auto, -8
+	.dbg	sym, "k", "00", auto, -10
+	.dbg	sym, "fa", "00", auto, -44
+	.dbg	sym, "afp", "00", auto, -78
+	.dbg	sym, "sum", "00", auto, -80
+	.dbg	sym, "rc", "00", auto, -82
+	.dbg	sym, "ps", "00", auto, -84
+	.dbg	sym, "pt", "00", auto, -86
+
+.segment	"CODE"
+
+	.dbg	line, "cq84.c", 57
+	jsr     pushax
+	.dbg	line, "cq84.c", 82
+	ldy     #$56
+	jsr     subysp
+	lda     #<(M0003)
+	ldx     #>(M0003)
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "cq84.c", 83
+	ldy     #$57
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     incaxy
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "cq84.c", 84
+	ldx     #$00
+	lda     #$00
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq84.c", 85
+	jmp     L0002
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$00
+	jsr     staspidx
+	tax
+	php
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	jne     L0002
+	.dbg	line, "cq84.c", 92
+	ldx     #$00
+	lda     #$03
+	jsr     _fip
+	ldy     #$54
+	jsr     staxysp
+	.dbg	line, "cq84.c", 93
+	ldy     #$55
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0006
+	cmp     #$03
+L0006:	jsr     boolne
+	jeq     L0005
+	.dbg	line, "cq84.c", 94
+	ldy     #$57
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0008
+	cmp     #$00
+L0008:	jsr     boolne
+	jeq     L0007
+	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq84.c", 95
+L0007:	ldy     #$05
+	jsr     ldaxysp
+	jsr     incax1
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq84.c", 100
+L0005:	ldx     #$00
+	lda     #$04
+	jsr     _glork
+	cpx     #$00
+	bne     L000A
+	cmp     #$04
+L000A:	jsr     boolne
+	jeq     L0009
+	.dbg	line, "cq84.c", 101
+	ldy     #$57
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L000C
+	cmp     #$00
+L000C:	jsr     boolne
+	jeq     L000B
+	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq84.c", 102
+L000B:	ldy     #$05
+	jsr     ldaxysp
+	jsr     incax2
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq84.c", 117
+L0009:	ldx     #$00
+	lda     #$00
+	ldy     #$4E
+	jsr     staxysp
+	jmp     L000D
+	.dbg	line, "cq84.c", 118
+L0010:	ldy     #$4F
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #$2A
+	bcc     L0012
+	inx
+	clc
+L0012:	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	jsr     pushax
+	ldy     #$51
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "cq84.c", 119
+	ldy     #$4F
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #$08
+	bcc     L0013
+	inx
+	clc
+L0013:	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	jsr     pushax
+	ldy     #$51
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #$2C
+	bcc     L0014
+	inx
+	clc
+L0014:	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "cq84.c", 117
+	ldy     #$4F
+	jsr     ldaxysp
+	ldy     #$4E
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L000D
+L000D:	ldy     #$4F
+	jsr     ldaxysp
+	cmp     #$11
+	txa
+	sbc     #$00
+	bvc     L0011
+	eor     #$80
+L0011:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0010
+	.dbg	line, "cq84.c", 125
+	ldx     #$00
+	lda     #$00
+	ldy     #$06
+	jsr     staxysp
+	.dbg	line, "cq84.c", 127
+	ldx     #$00
+	lda     #$00
+	ldy     #$4E
+	jsr     staxysp
+	jmp     L0015
+L0018:	ldy     #$4F
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #$08
+	bcc     L001A
+	inx
+	clc
+L001A:	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$06
+	jsr     addeqysp
+	ldy     #$4F
+	jsr     ldaxysp
+	ldy     #$4E
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0015
+L0015:	ldy     #$4F
+	jsr     ldaxysp
+	cmp     #$11
+	txa
+	sbc     #$00
+	bvc     L0019
+	eor     #$80
+L0019:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0018
+	.dbg	line, "cq84.c", 128
+	ldy     #$07
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L001C
+	cmp     #$88
+L001C:	jsr     boolne
+	jeq     L001B
+	.dbg	line, "cq84.c", 129
+	ldy     #$57
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L001E
+	cmp     #$00
+L001E:	jsr     boolne
+	jeq     L001D
+	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	ldx     #$00
+	lda     #$04
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq84.c", 130
+L001D:	ldy     #$05
+	jsr     ldaxysp
+	jsr     incax4
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq84.c", 144
+L001B:	ldx     #$00
+	lda     #$00
+	ldy     #$52
+	jsr     staxysp
+	jmp     L001F
+	.dbg	line, "cq84.c", 145
+L0022:	ldx     #$00
+	lda     #$00
+	ldy     #$4E
+	jsr     staxysp
+	jmp     L0024
+	.dbg	line, "cq84.c", 146
+L0027:	ldx     #$00
+	lda     #$00
+	ldy     #$4C
+	jsr     staxysp
+	jmp     L0029
+	.dbg	line, "cq84.c", 147
+L002C:	ldy     #$53
+	jsr     ldaxysp
+	jsr     pushax
+	ldx     #$00
+	lda     #$46
+	jsr     tosmulax
+	clc
+	adc     #<(M0001)
+	tay
+	txa
+	adc     #>(M0001)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$51
+	jsr     ldaxysp
+	jsr     pushax
+	ldx     #$00
+	lda     #$0E
+	jsr     tosmulax
+	jsr     tosaddax
+	jsr     pushax
+	ldy     #$4F
+	jsr     ldaxysp
+	jsr     aslax1
+	jsr     tosaddax
+	jsr     pushax
+	ldy     #$55
+	jsr     ldaxysp
+	jsr     pushax
+	ldx     #$00
+	lda     #$23
+	jsr     tosmulax
+	jsr     pushax
+	ldy     #$53
+	jsr     ldaxysp
+	jsr     mulax7
+	jsr     tosaddax
+	jsr     pushax
+	ldy     #$51
+	jsr     ldaxysp
+	jsr     tosaddax
+	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "cq84.c", 146
+	ldy     #$4D
+	jsr     ldaxysp
+	ldy     #$4C
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0029
+L0029:	ldy     #$4D
+	jsr     ldaxysp
+	cmp     #$07
+	txa
+	sbc     #$00
+	bvc     L002D
+	eor     #$80
+L002D:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L002C
+	.dbg	line, "cq84.c", 145
+	ldy     #$4F
+	jsr     ldaxysp
+	ldy     #$4E
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0024
+L0024:	ldy     #$4F
+	jsr     ldaxysp
+	cmp     #$05
+	txa
+	sbc     #$00
+	bvc     L0028
+	eor     #$80
+L0028:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0027
+	.dbg	line, "cq84.c", 144
+	ldy     #$53
+	jsr     ldaxysp
+	ldy     #$52
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L001F
+L001F:	ldy     #$53
+	jsr     ldaxysp
+	cmp     #$03
+	txa
+	sbc     #$00
+	bvc     L0023
+	eor     #$80
+L0023:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0022
+	.dbg	line, "cq84.c", 149
+	ldx     #$00
+	lda     #$01
+	ldy     #$52
+	jsr     staxysp
+	ldx     #$00
+	lda     #$02
+	ldy     #$4E
+	jsr     staxysp
+	ldx     #$00
+	lda     #$03
+	ldy     #$4C
+	jsr     staxysp
+	.dbg	line, "cq84.c", 153
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$69
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	.dbg	line, "cq84.c", 154
+	jsr     _array
+	jsr     pushax
+	ldy     #$55
+	jsr     ldaxysp
+	jsr     pushax
+	ldx     #$00
+	lda     #$46
+	jsr     tosmulax
+	clc
+	adc     #<(M0001)
+	tay
+	txa
+	adc     #>(M0001)
+	tax
+	tya
+	jsr     pushax
+	ldx     #$00
+	lda     #$23
+	jsr     pushax
+	ldx     #$00
+	lda     #$23
+	.dbg	line, "cq84.c", 159
+	jsr     _array
+	jsr     tosaddax
+	jsr     pushax
+	ldy     #$55
+	jsr     ldaxysp
+	jsr     pushax
+	ldx     #$00
+	lda     #$46
+	jsr     tosmulax
+	clc
+	adc     #<(M0001)
+	tay
+	txa
+	adc     #>(M0001)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$53
+	jsr     ldaxysp
+	jsr     pushax
+	ldx     #$00
+	lda     #$0E
+	jsr     tosmulax
+	jsr     tosaddax
+	jsr     pushax
+	ldx     #$00
+	lda     #$07
+	jsr     pushax
+	ldx     #$00
+	lda     #$31
+	.dbg	line, "cq84.c", 160
+	jsr     _array
+	jsr     tosaddax
+	jsr     pushax
+	ldy     #$55
+	jsr     ldaxysp
+	jsr     pushax
+	ldx     #$00
+	lda     #$46
+	jsr     tosmulax
+	clc
+	adc     #<(M0001)
+	tay
+	txa
+	adc     #>(M0001)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$53
+	jsr     ldaxysp
+	jsr     pushax
+	ldx     #$00
+	lda     #$0E
+	jsr     tosmulax
+	jsr     tosaddax
+	jsr     pushax
+	ldy     #$51
+	jsr     ldaxysp
+	jsr     aslax1
+	jsr     tosaddax
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     tosaddax
+	ldy     #$34
+	jsr     decaxy
+	stx     tmp1
+	ora     tmp1
+	jeq     L002E
+	.dbg	line, "cq84.c", 161
+	ldy     #$57
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0030
+	cmp     #$00
+L0030:	jsr     boolne
+	jeq     L002F
+	lda     #<(M0002)
+	ldx     #>(M0002)
+	jsr     pushax
+	ldx     #$00
+	lda     #$08
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq84.c", 162
+L002F:	ldy     #$05
+	jsr     ldaxysp
+	jsr     incax8
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq84.c", 165
+L002E:	ldy     #$05
+	jsr     ldaxysp
+	jmp     L0001
+	.dbg	line, "cq84.c", 166
+L0001:	ldy     #$58
+	jsr     addysp
+	rts
+
+	.dbg	line
+.segment	"DATA"
+
+M0002:
+	.byte	$73,$38,$34,$2C,$65,$72,$25,$64,$0A,$00
+M0003:
+	.byte	$73,$38,$34,$20,$20,$20,$20,$00
+
+.segment	"BSS"
+
+M0001:
+	.res	210,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int *__near__ fip (int x)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fip: near
+
+	.dbg	func, "fip", "00", static, "_fip"
+	.dbg	sym, "x", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "cq84.c", 206
+	jsr     pushax
+	.dbg	line, "cq84.c", 209
+	ldy     #$01
+	jsr     ldaxysp
+	sta     M0001
+	stx     M0001+1
+	.dbg	line, "cq84.c", 210
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jmp     L0001
+	.dbg	line, "cq84.c", 211
+L0001:	jsr     incsp2
+	rts
+
+	.dbg	line
+.segment	"BSS"
+
+M0001:
+	.res	2,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ array (int *a, int size, int start)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_array: near
+
+	.dbg	func, "array", "00", static, "_array"
+	.dbg	sym, "a", "00", auto, 4
+	.dbg	sym, "size", "00", auto, 2
+	.dbg	sym, "start", "00", auto, 0
+	.dbg	sym, "i", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "cq84.c", 174
+	jsr     pushax
+	.dbg	line, "cq84.c", 196
+	jsr     decsp2
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+	jmp     L0002
+	.dbg	line, "cq84.c", 197
+L0005:	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     aslax1
+	jsr     tosaddax
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosaddax
+	jsr     tosneax
+	jeq     L0006
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+	.dbg	line, "cq84.c", 196
+L0006:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosltax
+	jne     L0005
+	.dbg	line, "cq84.c", 199
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "cq84.c", 200
+L0001:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ glork (int x)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_glork: near
+
+	.dbg	func, "glork", "00", static, "_glork"
+	.dbg	sym, "x", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "cq84.c", 217
+	jsr     pushax
+	.dbg	line, "cq84.c", 219
+	ldy     #$01
+	jsr     ldaxysp
+	jmp     L0001
+L0001:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ section (int j, void *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_section: near
+
+	.dbg	func, "section", "00", extern, "_section"
+	.dbg	sym, "j", "00", auto, 2
+	.dbg	sym, "pd0", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "cq84.c", 228
+	jsr     pushax
+	.dbg	line, "cq84.c", 230
+	ldy     #$03
+	jsr     ldaxysp
+	jmp     L0002
+	.dbg	line, "cq84.c", 232
+L0002:	cpx     #$00
+	jne     L0005
+	cmp     #$00
+	jeq     L0004
+	jmp     L0003
+L0005:	jmp     L0003
+	.dbg	line, "cq84.c", 231
+L0004:	ldy     #$01
+	jsr     ldaxysp
+	jsr     _s84
+	jmp     L0003
+	.dbg	line, "cq84.c", 233
+L0003:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+	.dbg	sym, "n", "00", auto, 2
+	.dbg	sym, "args", "00", auto, 0
+	.dbg	sym, "j", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "cq84.c", 253
+	jsr     decsp2
+	ldx     #$00
+	lda     #$01
+	sta     M0001+14
+	stx     M0001+14+1
+	.dbg	line, "cq84.c", 254
+	ldx     #$00
+	lda     #$01
+	sta     M0001+16
+	stx     M0001+16+1
+	.dbg	line, "cq84.c", 255
+	ldx     #$00
+	lda     #$01
+	sta     M0001+18
+	stx     M0001+18+1
+	.dbg	line, "cq84.c", 256
+	ldx     #$00
+	lda     #$01
+	sta     M0001+20
+	stx     M0001+20+1
+	.dbg	line, "cq84.c", 258
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	sta     M0002
+	stx     M0002+1
+	.dbg	line, "cq84.c", 260
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+	jmp     L0002
+	.dbg	line, "cq84.c", 261
+L0005:	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	lda     M0002
+	ldx     M0002+1
+	jsr     _section
+	sta     M0001+22
+	stx     M0001+22+1
+	.dbg	line, "cq84.c", 262
+	lda     M0001+24
+	ldx     M0001+24+1
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     tosaddax
+	sta     M0001+24
+	stx     M0001+24+1
+	.dbg	line, "cq84.c", 263
+	lda     M0001+14
+	ldx     M0001+14+1
+	cpx     #$00
+	bne     L0008
+	cmp     #$00
+L0008:	jsr     boolne
+	jeq     L0007
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     #<(M0001+26)
+	ldx     #>(M0001+26)
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "cq84.c", 260
+L0007:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0005
+	.dbg	line, "cq84.c", 266
+	lda     M0001+24
+	ldx     M0001+24+1
+	cpx     #$00
+	bne     L000A
+	cmp     #$00
+L000A:	jsr     booleq
+	jeq     L0009
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cq84.c", 267
+	jmp     L000B
+L0009:	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cq84.c", 269
+L000B:	lda     M0001+24
+	ldx     M0001+24+1
+	jmp     L0001
+	.dbg	line, "cq84.c", 270
+L0001:	jsr     incsp6
+	rts
+
+	.dbg	line
+.segment	"BSS"
+
+M0001:
+	.res	34,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
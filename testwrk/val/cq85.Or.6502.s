@@ -0,0 +1,653 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_printf
+	.export		_lbits
+	.export		_ubits
+	.export		_fbits
+	.export		_dbits
+	.export		_flgs
+	.export		_flgm
+	.export		_flgd
+	.export		_flgl
+	.export		_rrc
+	.export		_crc
+	.export		_rfs
+	.export		_s85
+	.export		_section
+	.export		_main
+
+.segment	"RODATA"
+
+S000D:
+	.byte	$42,$65,$20,$65,$73,$70,$65,$63,$69,$61,$6C,$6C,$79,$20,$63,$61
+	.byte	$72,$65,$66,$75,$6C,$20,$77,$69,$74,$68,$20,$31,$2D,$62,$69,$74
+	.byte	$20,$66,$69,$65,$6C,$64,$73,$21,$0A,$00
+S000C:
+	.byte	$53,$69,$67,$6E,$20,$65,$78,$74,$65,$6E,$73,$69,$6F,$6E,$20,$69
+	.byte	$6E,$20,$66,$69,$65,$6C,$64,$73,$0A,$00
+S000E:
+	.byte	$53,$65,$63,$74,$69,$6F,$6E,$20,$25,$73,$20,$72,$65,$74,$75,$72
+	.byte	$6E,$65,$64,$20,$25,$64,$2E,$0A,$00
+S000F:
+	.byte	$0A,$4E,$6F,$20,$65,$72,$72,$6F,$72,$73,$20,$64,$65,$74,$65,$63
+	.byte	$74,$65,$64,$2E,$0A,$00
+S0010:
+	.byte	$0A,$46,$61,$69,$6C,$65,$64,$2E,$0A,$00
+S0007:
+	.byte	$75,$6E,$73,$69,$67,$6E,$65,$64,$00
+S000B:
+	.byte	$25,$73,$25,$73,$25,$64,$0A,$00
+S0008	:=	S0007+2
+S0009	:=	S0007+2
+S0004:
+	.byte	$73,$68,$6F,$72,$74,$00
+S0006:
+	.byte	$6C,$6F,$6E,$67,$00
+S0003:
+	.byte	$63,$68,$61,$72,$00
+S0005:
+	.byte	$69,$6E,$74,$00
+
+.segment	"BSS"
+
+_lbits:
+	.res	2,$00
+_ubits:
+	.res	2,$00
+_fbits:
+	.res	2,$00
+_dbits:
+	.res	2,$00
+_flgs:
+	.res	2,$00
+_flgm:
+	.res	2,$00
+_flgd:
+	.res	2,$00
+_flgl:
+	.res	2,$00
+_rrc:
+	.res	2,$00
+_crc:
+	.res	2,$00
+_rfs:
+	.res	8,$00
+
+; ---------------------------------------------------------------
+; int __near__ s85 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s85: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$DB
+	jsr     subysp
+	lda     #<(M0002)
+	ldx     #>(M0002)
+	ldy     #$D7
+	jsr     staxysp
+	ldy     #$DC
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     incaxy
+	ldy     #$D5
+	jsr     staxysp
+	ldx     #$00
+	txa
+	ldy     #$D9
+	jsr     staxysp
+L0002:	ldy     #$D6
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$D8
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	sta     (sreg),y
+	tax
+	php
+	ldy     #$D5
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$D7
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	bne     L0002
+	lda     #$CF
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$BD
+	jsr     leaa0sp
+	jsr     tossubax
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	bmi     L0034
+	lda     #$D1
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$D1
+	jsr     leaa0sp
+	jsr     tossubax
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0008
+	eor     #$80
+L0008:	bmi     L0034
+	lda     #$D3
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$D3
+	jsr     leaa0sp
+	jsr     tossubax
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0009
+	eor     #$80
+L0009:	bpl     L0005
+L0034:	ldy     #$DC
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0037
+	cmp     #$00
+	beq     L000B
+L0037:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L000B:	ldy     #$DA
+	jsr     ldaxysp
+	jsr     incax1
+	ldy     #$D9
+	jsr     staxysp
+L0005:	lda     #$9E
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$9F
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$7B
+	jsr     staxysp
+	lda     #$9B
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$9C
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$7D
+	jsr     staxysp
+	lda     #$98
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$99
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$7F
+	jsr     staxysp
+	lda     #$93
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$94
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$81
+	jsr     staxysp
+	lda     #$90
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$91
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$83
+	jsr     staxysp
+	lda     #$8D
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$8E
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$85
+	jsr     staxysp
+	lda     #$8A
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$8B
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$87
+	jsr     staxysp
+	ldy     #$DC
+	jsr     ldaxysp
+	ldy     #$11
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0038
+	cmp     #$00
+	beq     L0010
+L0038:	ldx     #$00
+	txa
+	ldy     #$79
+	jsr     staxysp
+	jmp     L000F
+L0012:	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldy     #$7C
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(M0003)
+	tay
+	txa
+	adc     #>(M0003)
+	tax
+	tya
+	jsr     pushw
+	lda     #<(M0004)
+	ldx     #>(M0004)
+	jsr     pushax
+	ldy     #$80
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #$81
+	bcc     L0014
+	inx
+	clc
+L0014:	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	jsr     pushw
+	ldy     #$08
+	jsr     _printf
+	ldy     #$79
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L000F:	ldy     #$7A
+	jsr     ldaxysp
+	cmp     #$07
+	txa
+	sbc     #$00
+	bvc     L0013
+	eor     #$80
+L0013:	bmi     L0012
+L0010:	ldy     #$78
+	lda     (sp),y
+	ora     #$38
+	sta     (sp),y
+	and     #$FC
+	sta     ptr1
+	lda     (sp),y
+	lsr     a
+	lsr     a
+	lsr     a
+	and     #$07
+	and     #$03
+	ora     ptr1
+	sta     (sp),y
+	and     #$C7
+	sta     ptr1
+	lda     (sp),y
+	and     #$03
+	and     #$07
+	asl     a
+	asl     a
+	asl     a
+	ora     ptr1
+	sta     (sp),y
+	lsr     a
+	lsr     a
+	lsr     a
+	and     #$07
+	cmp     #$03
+	beq     L0036
+	lda     (sp),y
+	lsr     a
+	lsr     a
+	lsr     a
+	and     #$07
+	ldy     #$DC
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L003A
+	cmp     #$00
+	beq     L001C
+L003A:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$02
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L001C:	ldy     #$DA
+	jsr     ldaxysp
+	jsr     incax2
+	ldy     #$D9
+	jsr     staxysp
+	ldy     #$78
+L0036:	lda     (sp),y
+	ora     #$40
+	sta     (sp),y
+	rol     a
+	rol     a
+	rol     a
+	and     #$03
+	and     #$01
+	cmp     #$01
+	beq     L0020
+	ldy     #$DC
+	jsr     ldaxysp
+	ldy     #$11
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L003B
+	cmp     #$00
+	beq     L0020
+L003B:	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+L0020:	lda     sp
+	ldx     sp+1
+	jsr     pushax
+	lda     #$02
+	jsr     leaa0sp
+	jsr     tossubax
+	cpx     #$00
+	jne     L0024
+	cmp     #$00
+	jne     L0024
+	lda     sp
+	ldx     sp+1
+	jsr     pushax
+	lda     #$02
+	jsr     leaa0sp
+	jsr     tossubax
+	cpx     #$00
+	bne     L0024
+	cmp     #$00
+	bne     L0024
+	lda     sp
+	ldx     sp+1
+	jsr     pushax
+	lda     #$02
+	jsr     leaa0sp
+	jsr     tossubax
+	cpx     #$00
+	bne     L0024
+	cmp     #$00
+	bne     L0024
+	lda     sp
+	ldx     sp+1
+	jsr     pushax
+	lda     #$02
+	jsr     leaa0sp
+	jsr     tossubax
+	cpx     #$00
+	bne     L0024
+	cmp     #$00
+	bne     L0024
+	lda     sp
+	ldx     sp+1
+	jsr     pushax
+	lda     #$02
+	jsr     leaa0sp
+	jsr     tossubax
+	cpx     #$00
+	bne     L0024
+	cmp     #$00
+	bne     L0024
+	lda     sp
+	ldx     sp+1
+	jsr     pushax
+	lda     #$02
+	jsr     leaa0sp
+	jsr     tossubax
+	cpx     #$00
+	bne     L0024
+	cmp     #$00
+	bne     L0024
+	lda     sp
+	ldx     sp+1
+	jsr     pushax
+	lda     #$02
+	jsr     leaa0sp
+	jsr     tossubax
+	cpx     #$00
+	bne     L0024
+	cmp     #$00
+	beq     L002E
+L0024:	ldy     #$DC
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L003C
+	cmp     #$00
+	beq     L002C
+L003C:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	tay
+	jsr     _printf
+L002C:	ldy     #$DA
+	jsr     ldaxysp
+	jsr     incax4
+	ldy     #$D9
+	jsr     staxysp
+L002E:	lda     #$A1
+	jsr     leaa0sp
+	ldy     #$D3
+	jsr     staxysp
+	lda     #$02
+	ldy     #$A1
+	sta     (sp),y
+	ldy     #$D4
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	clc
+	adc     #$01
+	sta     (ptr1),y
+	ldy     #$A1
+	lda     (sp),y
+	cmp     #$03
+	beq     L0031
+	ldy     #$DC
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L003D
+	cmp     #$00
+	beq     L0032
+L003D:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$10
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L0032:	ldy     #$DA
+	jsr     ldaxysp
+	ldy     #$10
+	jsr     incaxy
+	ldy     #$D9
+	jsr     staxysp
+L0031:	ldy     #$DA
+	jsr     ldaxysp
+	ldy     #$DD
+	jmp     addysp
+
+.segment	"DATA"
+
+M0001:
+	.byte	$73,$38,$35,$2C,$65,$72,$25,$64,$0A,$00
+M0002:
+	.byte	$73,$38,$35,$20,$20,$20,$20,$00
+M0003:
+	.addr	S0003
+	.addr	S0004
+	.addr	S0005
+	.addr	S0006
+	.addr	S0007
+	.addr	S0008
+	.addr	S0009
+M0004:
+	.byte	$20,$61,$6C,$69,$67,$6E,$6D,$65,$6E,$74,$3A,$20,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ section (int j, void *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_section: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$02
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	bne     L0003
+	jsr     ldax0sp
+	jsr     _s85
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	ldx     #$00
+	lda     #$01
+	sta     M0001+14
+	stx     M0001+14+1
+	sta     M0001+16
+	stx     M0001+16+1
+	sta     M0001+18
+	stx     M0001+18+1
+	sta     M0001+20
+	stx     M0001+20+1
+	lda     #>(M0001)
+	sta     M0002+1
+	lda     #<(M0001)
+	sta     M0002
+	txa
+	jsr     stax0sp
+	jmp     L0002
+L0005:	jsr     pushw0sp
+	lda     M0002
+	ldx     M0002+1
+	jsr     _section
+	sta     M0001+22
+	stx     M0001+22+1
+	lda     M0001+24
+	clc
+	adc     M0001+22
+	sta     M0001+24
+	lda     M0001+24+1
+	adc     M0001+22+1
+	sta     M0001+24+1
+	lda     M0001+14
+	ora     M0001+14+1
+	beq     L0007
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	lda     #<(M0001+26)
+	ldx     #>(M0001+26)
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+L0007:	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+L0002:	jsr     ldax0sp
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	bmi     L0005
+	lda     M0001+24
+	ora     M0001+24+1
+	bne     L0009
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jmp     L000E
+L0009:	lda     #<(S0010)
+	ldx     #>(S0010)
+L000E:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     M0001+24
+	ldx     M0001+24+1
+	jmp     incsp6
+
+.segment	"BSS"
+
+M0001:
+	.res	34,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
@@ -0,0 +1,866 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_printf
+	.export		_lbits
+	.export		_ubits
+	.export		_fbits
+	.export		_dbits
+	.export		_flgs
+	.export		_flgm
+	.export		_flgd
+	.export		_flgl
+	.export		_rrc
+	.export		_crc
+	.export		_rfs
+	.export		_s85
+	.export		_section
+	.export		_main
+
+.segment	"RODATA"
+
+S000D:
+	.byte	$42,$65,$20,$65,$73,$70,$65,$63,$69,$61,$6C,$6C,$79,$20,$63,$61
+	.byte	$72,$65,$66,$75,$6C,$20,$77,$69,$74,$68,$20,$31,$2D,$62,$69,$74
+	.byte	$20,$66,$69,$65,$6C,$64,$73,$21,$0A,$00
+S000C:
+	.byte	$53,$69,$67,$6E,$20,$65,$78,$74,$65,$6E,$73,$69,$6F,$6E,$20,$69
+	.byte	$6E,$20,$66,$69,$65,$6C,$64,$73,$0A,$00
+S000E:
+	.byte	$53,$65,$63,$74,$69,$6F,$6E,$20,$25,$73,$20,$72,$65,$74,$75,$72
+	.byte	$6E,$65,$64,$20,$25,$64,$2E,$0A,$00
+S000F:
+	.byte	$0A,$4E,$6F,$20,$65,$72,$72,$6F,$72,$73,$20,$64,$65,$74,$65,$63
+	.byte	$74,$65,$64,$2E,$0A,$00
+S0010:
+	.byte	$0A,$46,$61,$69,$6C,$65,$64,$2E,$0A,$00
+S0007:
+	.byte	$75,$6E,$73,$69,$67,$6E,$65,$64,$00
+S000B:
+	.byte	$25,$73,$25,$73,$25,$64,$0A,$00
+S0008	:=	S0007+2
+S0009	:=	S0007+2
+S0004:
+	.byte	$73,$68,$6F,$72,$74,$00
+S0006:
+	.byte	$6C,$6F,$6E,$67,$00
+S0003:
+	.byte	$63,$68,$61,$72,$00
+S0005:
+	.byte	$69,$6E,$74,$00
+
+.segment	"BSS"
+
+_lbits:
+	.res	2,$00
+_ubits:
+	.res	2,$00
+_fbits:
+	.res	2,$00
+_dbits:
+	.res	2,$00
+_flgs:
+	.res	2,$00
+_flgm:
+	.res	2,$00
+_flgd:
+	.res	2,$00
+_flgl:
+	.res	2,$00
+_rrc:
+	.res	2,$00
+_crc:
+	.res	2,$00
+_rfs:
+	.res	8,$00
+
+; ---------------------------------------------------------------
+; int __near__ s85 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s85: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$DB
+	jsr     subysp
+	lda     #<(M0002)
+	ldx     #>(M0002)
+	ldy     #$D7
+	jsr     staxysp
+	ldy     #$DC
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$1A
+	bcc     L0002
+	inx
+L0002:	ldy     #$D5
+	jsr     staxysp
+	ldy     #$D9
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+L0003:	ldy     #$D6
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	ldy     #$D8
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	lda     (ptr1)
+	sta     (sreg)
+	tax
+	php
+	ldy     #$D5
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$D7
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	bne     L0003
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$CF
+	bcc     L0007
+	inx
+L0007:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$BD
+	bcc     L0009
+	inx
+L0009:	jsr     tossubax
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L000A
+	eor     #$80
+L000A:	bmi     L0060
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$D1
+	bcc     L000C
+	inx
+L000C:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$D1
+	bcc     L000D
+	inx
+L000D:	jsr     tossubax
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L000E
+	eor     #$80
+L000E:	bmi     L0060
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$D3
+	bcc     L000F
+	inx
+L000F:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$D3
+	bcc     L0010
+	inx
+L0010:	jsr     tossubax
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0011
+	eor     #$80
+L0011:	bpl     L0006
+L0060:	ldy     #$DC
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$13
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     #$00
+	bne     L0064
+	cmp     #$00
+	beq     L0013
+L0064:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L0013:	ldy     #$DA
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ina
+	bne     L0015
+	inx
+L0015:	jsr     staxysp
+L0006:	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$9E
+	bcc     L0017
+	inx
+L0017:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$9F
+	bcc     L0018
+	inx
+L0018:	jsr     tossubax
+	ldy     #$7B
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$9B
+	bcc     L001A
+	inx
+L001A:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$9C
+	bcc     L001B
+	inx
+L001B:	jsr     tossubax
+	ldy     #$7D
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$98
+	bcc     L001D
+	inx
+L001D:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$99
+	bcc     L001E
+	inx
+L001E:	jsr     tossubax
+	ldy     #$7F
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$93
+	bcc     L0020
+	inx
+L0020:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$94
+	bcc     L0021
+	inx
+L0021:	jsr     tossubax
+	ldy     #$81
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$90
+	bcc     L0023
+	inx
+L0023:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$91
+	bcc     L0024
+	inx
+L0024:	jsr     tossubax
+	ldy     #$83
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$8D
+	bcc     L0026
+	inx
+L0026:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$8E
+	bcc     L0027
+	inx
+L0027:	jsr     tossubax
+	ldy     #$85
+	jsr     staxysp
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$8A
+	bcc     L0029
+	inx
+L0029:	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$8B
+	bcc     L002A
+	inx
+L002A:	jsr     tossubax
+	ldy     #$87
+	jsr     staxysp
+	ldy     #$DC
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$11
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     #$00
+	bne     L0065
+	cmp     #$00
+	jeq     L002E
+L0065:	ldy     #$79
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	bra     L0061
+L0030:	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldy     #$7C
+	lda     (sp),y
+	sta     tmp1
+	dey
+	lda     (sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(M0003)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(M0003)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	jsr     pushax
+	lda     #<(M0004)
+	ldx     #>(M0004)
+	jsr     pushax
+	ldy     #$80
+	lda     (sp),y
+	sta     tmp1
+	dey
+	lda     (sp),y
+	asl     a
+	rol     tmp1
+	ldx     tmp1
+	clc
+	adc     #$81
+	bcc     L0032
+	inx
+	clc
+L0032:	adc     sp
+	sta     ptr1
+	txa
+	adc     sp+1
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	ldy     #$79
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$7A
+L0061:	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cmp     #$07
+	txa
+	sbc     #$00
+	bvc     L0031
+	eor     #$80
+L0031:	bmi     L0030
+L002E:	ldy     #$78
+	lda     (sp),y
+	ora     #$38
+	sta     (sp),y
+	and     #$FC
+	sta     ptr1
+	lda     (sp),y
+	lsr     a
+	lsr     a
+	lsr     a
+	and     #$07
+	and     #$03
+	ora     ptr1
+	sta     (sp),y
+	and     #$C7
+	sta     ptr1
+	lda     (sp),y
+	and     #$03
+	and     #$07
+	asl     a
+	asl     a
+	asl     a
+	ora     ptr1
+	sta     (sp),y
+	lsr     a
+	lsr     a
+	lsr     a
+	and     #$07
+	cmp     #$03
+	beq     L0063
+	lda     (sp),y
+	lsr     a
+	lsr     a
+	lsr     a
+	and     #$07
+	ldy     #$DC
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$13
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     #$00
+	bne     L0067
+	cmp     #$00
+	beq     L003A
+L0067:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$02
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L003A:	ldy     #$DA
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$02
+	bcc     L003C
+	inx
+L003C:	jsr     staxysp
+	ldy     #$78
+L0063:	lda     (sp),y
+	ora     #$40
+	sta     (sp),y
+	rol     a
+	rol     a
+	rol     a
+	and     #$03
+	and     #$01
+	cmp     #$01
+	beq     L003F
+	ldy     #$DC
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$11
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     #$00
+	bne     L0068
+	cmp     #$00
+	beq     L003F
+L0068:	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+L003F:	lda     sp
+	ldx     sp+1
+	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$02
+	bcc     L0042
+	inx
+L0042:	jsr     tossubax
+	cpx     #$00
+	jne     L0044
+	cmp     #$00
+	jne     L0044
+	lda     sp
+	ldx     sp+1
+	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$02
+	bcc     L0045
+	inx
+L0045:	jsr     tossubax
+	cpx     #$00
+	jne     L0044
+	cmp     #$00
+	jne     L0044
+	lda     sp
+	ldx     sp+1
+	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$02
+	bcc     L0047
+	inx
+L0047:	jsr     tossubax
+	cpx     #$00
+	bne     L0044
+	cmp     #$00
+	bne     L0044
+	lda     sp
+	ldx     sp+1
+	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$02
+	bcc     L0049
+	inx
+L0049:	jsr     tossubax
+	cpx     #$00
+	bne     L0044
+	cmp     #$00
+	bne     L0044
+	lda     sp
+	ldx     sp+1
+	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$02
+	bcc     L004B
+	inx
+L004B:	jsr     tossubax
+	cpx     #$00
+	bne     L0044
+	cmp     #$00
+	bne     L0044
+	lda     sp
+	ldx     sp+1
+	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$02
+	bcc     L004D
+	inx
+L004D:	jsr     tossubax
+	cpx     #$00
+	bne     L0044
+	cmp     #$00
+	bne     L0044
+	lda     sp
+	ldx     sp+1
+	jsr     pushax
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$02
+	bcc     L004F
+	inx
+L004F:	jsr     tossubax
+	cpx     #$00
+	bne     L0044
+	cmp     #$00
+	beq     L0055
+L0044:	ldy     #$DC
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$13
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     #$00
+	bne     L0069
+	cmp     #$00
+	beq     L0052
+L0069:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	tay
+	jsr     _printf
+L0052:	ldy     #$DA
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$04
+	bcc     L0054
+	inx
+L0054:	jsr     staxysp
+L0055:	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$A1
+	bcc     L0059
+	inx
+L0059:	ldy     #$D3
+	jsr     staxysp
+	lda     #$02
+	ldy     #$A1
+	sta     (sp),y
+	ldy     #$D4
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	sta     sreg
+	stx     sreg+1
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1)
+	ina
+	sta     (sreg)
+	ldy     #$A1
+	lda     (sp),y
+	cmp     #$03
+	beq     L005B
+	ldy     #$DC
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$13
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     #$00
+	bne     L006A
+	cmp     #$00
+	beq     L005D
+L006A:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$10
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L005D:	ldy     #$DA
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$10
+	bcc     L005F
+	inx
+L005F:	jsr     staxysp
+L005B:	ldy     #$DA
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$DD
+	jmp     addysp
+
+.segment	"DATA"
+
+M0001:
+	.byte	$73,$38,$35,$2C,$65,$72,$25,$64,$0A,$00
+M0002:
+	.byte	$73,$38,$35,$20,$20,$20,$20,$00
+M0003:
+	.addr	S0003
+	.addr	S0004
+	.addr	S0005
+	.addr	S0006
+	.addr	S0007
+	.addr	S0008
+	.addr	S0009
+M0004:
+	.byte	$20,$61,$6C,$69,$67,$6E,$6D,$65,$6E,$74,$3A,$20,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ section (int j, void *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_section: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$02
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	bne     L0003
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _s85
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	lda     #$01
+	sta     M0001+14
+	stz     M0001+14+1
+	sta     M0001+16
+	stz     M0001+16+1
+	sta     M0001+18
+	stz     M0001+18+1
+	sta     M0001+20
+	stz     M0001+20+1
+	lda     #>(M0001)
+	sta     M0002+1
+	lda     #<(M0001)
+	sta     M0002
+	lda     #$00
+	sta     (sp)
+	ldy     #$01
+	sta     (sp),y
+	bra     L000D
+L0005:	jsr     pushw0sp
+	lda     M0002
+	ldx     M0002+1
+	jsr     _section
+	sta     M0001+22
+	stx     M0001+22+1
+	lda     M0001+24
+	clc
+	adc     M0001+22
+	sta     M0001+24
+	lda     M0001+24+1
+	adc     M0001+22+1
+	sta     M0001+24+1
+	lda     M0001+14
+	ora     M0001+14+1
+	beq     L0007
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	lda     #<(M0001+26)
+	ldx     #>(M0001+26)
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+L0007:	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	ldy     #$01
+L000D:	lda     (sp),y
+	tax
+	lda     (sp)
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	bmi     L0005
+	lda     M0001+24
+	ora     M0001+24+1
+	bne     L0009
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	bra     L000F
+L0009:	lda     #<(S0010)
+	ldx     #>(S0010)
+L000F:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     M0001+24
+	ldx     M0001+24+1
+	jmp     incsp6
+
+.segment	"BSS"
+
+M0001:
+	.res	34,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
@@ -0,0 +1,934 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "cq85.c", 7988, 1613073744
+	.dbg		file, "common.h", 522, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/stdlib.h", 5999, 1613073744
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_lbits
+	.export		_ubits
+	.export		_fbits
+	.export		_dbits
+	.export		_flgs
+	.export		_flgm
+	.export		_flgd
+	.export		_flgl
+	.export		_rrc
+	.export		_crc
+	.export		_rfs
+	.export		_s85
+	.export		_section
+	.export		_main
+
+.segment	"RODATA"
+
+S000D:
+	.byte	$42,$65,$20,$65,$73,$70,$65,$63,$69,$61,$6C,$6C,$79,$20,$63,$61
+	.byte	$72,$65,$66,$75,$6C,$20,$77,$69,$74,$68,$20,$31,$2D,$62,$69,$74
+	.byte	$20,$66,$69,$65,$6C,$64,$73,$21,$0A,$00
+S000C:
+	.byte	$53,$69,$67,$6E,$20,$65,$78,$74,$65,$6E,$73,$69,$6F,$6E,$20,$69
+	.byte	$6E,$20,$66,$69,$65,$6C,$64,$73,$0A,$00
+S000E:
+	.byte	$53,$65,$63,$74,$69,$6F,$6E,$20,$25,$73,$20,$72,$65,$74,$75,$72
+	.byte	$6E,$65,$64,$20,$25,$64,$2E,$0A,$00
+S000F:
+	.byte	$0A,$4E,$6F,$20,$65,$72,$72,$6F,$72,$73,$20,$64,$65,$74,$65,$63
+	.byte	$74,$65,$64,$2E,$0A,$00
+S0010:
+	.byte	$0A,$46,$61,$69,$6C,$65,$64,$2E,$0A,$00
+S0007:
+	.byte	$75,$6E,$73,$69,$67,$6E,$65,$64,$00
+S000B:
+	.byte	$25,$73,$25,$73,$25,$64,$0A,$00
+S0008	:=	S0007+2
+S0009	:=	S0007+2
+S0004:
+	.byte	$73,$68,$6F,$72,$74,$00
+S0006:
+	.byte	$6C,$6F,$6E,$67,$00
+S0003:
+	.byte	$63,$68,$61,$72,$00
+S0005:
+	.byte	$69,$6E,$74,$00
+
+.segment	"BSS"
+
+_lbits:
+	.res	2,$00
+_ubits:
+	.res	2,$00
+_fbits:
+	.res	2,$00
+_dbits:
+	.res	2,$00
+_flgs:
+	.res	2,$00
+_flgm:
+	.res	2,$00
+_flgd:
+	.res	2,$00
+_flgl:
+	.res	2,$00
+_rrc:
+	.res	2,$00
+_crc:
+	.res	2,$00
+_rfs:
+	.res	8,$00
+
+; ---------------------------------------------------------------
+; int __near__ s85 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s85: near
+
+	.dbg	func, "s85", "00", extern, "_s85"
+	.dbg	sym, "pd0", "00", auto, 0
+	.dbg	sym, "rc", "00", auto, -2
+	.dbg	sym, "ps", "00", auto, -4
+	.dbg	sym, "pt", "00", auto, -6
+	.dbg	sym, "s1", "00", auto, -32
+	.dbg	sym, "s2", "00", auto, -58
+	.dbg	sym, "sp", "00", auto, -60
+	.dbg	sym, "sc", "00", auto, -62
+	.dbg	sym, "ss", "00", auto, -65
+	.dbg	sym, "si", "00", auto, -68
+	.dbg	sym, "sl", "00", auto, -73
+	.dbg	sym, "su", "00", auto, -76
+	.dbg	sym, "sf", "00", auto, -79
+	.dbg	sym, "sd", "00", auto, -82
+	.dbg	sym, "diff", "00", auto, -96
+	.dbg	sym, "j", "00", auto, -98
+	.dbg	sym, "s3", "00", auto, -99
+	.dbg	sym, "u0", "00", auto, -219
+
+.segment	"CODE"
+
+	.dbg	line, "cq85.c", 51
+	jsr     pushax
+	.dbg	line, "cq85.c", 159
+	ldy     #$DB
+	jsr     subysp
+	lda     #<(M0002)
+	ldx     #>(M0002)
+	ldy     #$D7
+	jsr     staxysp
+	.dbg	line, "cq85.c", 160
+	ldy     #$DC
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     incaxy
+	ldy     #$D5
+	jsr     staxysp
+	.dbg	line, "cq85.c", 161
+	ldx     #$00
+	lda     #$00
+	ldy     #$D9
+	jsr     staxysp
+	.dbg	line, "cq85.c", 162
+	jmp     L0002
+L0002:	ldy     #$D6
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$DA
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$00
+	jsr     staspidx
+	tax
+	php
+	ldy     #$D5
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$D7
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	jne     L0002
+	.dbg	line, "cq85.c", 169
+	lda     #$CF
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$BD
+	jsr     leaa0sp
+	jsr     tossubax
+	.dbg	line, "cq85.c", 170
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0007
+	lda     #$D1
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$D1
+	jsr     leaa0sp
+	jsr     tossubax
+	.dbg	line, "cq85.c", 171
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0008
+	eor     #$80
+L0008:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0007
+	lda     #$D3
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$D3
+	jsr     leaa0sp
+	jsr     tossubax
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0009
+	eor     #$80
+L0009:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0007
+	ldx     #$00
+	lda     #$00
+	jeq     L000A
+L0007:	ldx     #$00
+	lda     #$01
+L000A:	jeq     L0005
+	.dbg	line, "cq85.c", 172
+	ldy     #$DC
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L000C
+	cmp     #$00
+L000C:	jsr     boolne
+	jeq     L000B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq85.c", 173
+L000B:	ldy     #$DA
+	jsr     ldaxysp
+	jsr     incax1
+	ldy     #$D9
+	jsr     staxysp
+	.dbg	line, "cq85.c", 180
+L0005:	lda     #$9E
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$9F
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$7B
+	jsr     staxysp
+	.dbg	line, "cq85.c", 181
+	lda     #$9B
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$9C
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$7D
+	jsr     staxysp
+	.dbg	line, "cq85.c", 182
+	lda     #$98
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$99
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$7F
+	jsr     staxysp
+	.dbg	line, "cq85.c", 183
+	lda     #$93
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$94
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$81
+	jsr     staxysp
+	.dbg	line, "cq85.c", 184
+	lda     #$90
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$91
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$83
+	jsr     staxysp
+	.dbg	line, "cq85.c", 185
+	lda     #$8D
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$8E
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$85
+	jsr     staxysp
+	.dbg	line, "cq85.c", 186
+	lda     #$8A
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$8B
+	jsr     leaa0sp
+	jsr     tossubax
+	ldy     #$87
+	jsr     staxysp
+	.dbg	line, "cq85.c", 188
+	ldy     #$DC
+	jsr     ldaxysp
+	ldy     #$11
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L000E
+	cmp     #$00
+L000E:	jsr     boolne
+	jeq     L0010
+	.dbg	line, "cq85.c", 189
+	ldx     #$00
+	lda     #$00
+	ldy     #$79
+	jsr     staxysp
+	jmp     L000F
+	.dbg	line, "cq85.c", 190
+L0012:	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldy     #$7C
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(M0003)
+	tay
+	txa
+	adc     #>(M0003)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	lda     #<(M0004)
+	ldx     #>(M0004)
+	jsr     pushax
+	ldy     #$80
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #$81
+	bcc     L0014
+	inx
+	clc
+L0014:	adc     sp
+	tay
+	txa
+	adc     sp+1
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "cq85.c", 189
+	ldy     #$7A
+	jsr     ldaxysp
+	ldy     #$79
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L000F
+L000F:	ldy     #$7A
+	jsr     ldaxysp
+	cmp     #$07
+	txa
+	sbc     #$00
+	bvc     L0013
+	eor     #$80
+L0013:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0012
+	.dbg	line, "cq85.c", 199
+L0010:	ldy     #$78
+	ldx     #$00
+	lda     (sp),y
+	ora     #$38
+	ldy     #$78
+	sta     (sp),y
+	.dbg	line, "cq85.c", 200
+	ldy     #$78
+	ldx     #$00
+	lda     (sp),y
+	and     #$FC
+	jsr     pushax
+	ldy     #$7A
+	lda     (sp),y
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	and     #$07
+	ldx     #$00
+	and     #$03
+	jsr     tosorax
+	ldy     #$78
+	sta     (sp),y
+	.dbg	line, "cq85.c", 201
+	ldy     #$78
+	ldx     #$00
+	lda     (sp),y
+	and     #$C7
+	jsr     pushax
+	ldy     #$7A
+	lda     (sp),y
+	ldx     #$00
+	and     #$03
+	ldx     #$00
+	and     #$07
+	jsr     shlax3
+	jsr     tosorax
+	ldy     #$78
+	sta     (sp),y
+	.dbg	line, "cq85.c", 203
+	ldy     #$78
+	lda     (sp),y
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	and     #$07
+	cpx     #$00
+	bne     L0016
+	cmp     #$03
+L0016:	jsr     boolne
+	jeq     L001B
+	.dbg	line, "cq85.c", 204
+	ldy     #$78
+	lda     (sp),y
+	lsr     a
+	lsr     a
+	lsr     a
+	ldx     #$00
+	and     #$07
+	cpx     #$FF
+	bne     L0018
+	cmp     #$FF
+L0018:	jsr     booleq
+	jeq     L0017
+	.dbg	line, "cq85.c", 205
+	ldy     #$DC
+	jsr     ldaxysp
+	ldy     #$11
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L001A
+	cmp     #$00
+L001A:	jsr     boolne
+	jeq     L0019
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cq85.c", 207
+L0019:	jmp     L001B
+	.dbg	line, "cq85.c", 211
+L0017:	ldy     #$DC
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L001D
+	cmp     #$00
+L001D:	jsr     boolne
+	jeq     L001C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq85.c", 212
+L001C:	ldy     #$DA
+	jsr     ldaxysp
+	jsr     incax2
+	ldy     #$D9
+	jsr     staxysp
+	.dbg	line, "cq85.c", 217
+L001B:	ldy     #$78
+	ldx     #$00
+	lda     (sp),y
+	ora     #$40
+	ldy     #$78
+	sta     (sp),y
+	.dbg	line, "cq85.c", 218
+	ldy     #$78
+	lda     (sp),y
+	rol     a
+	rol     a
+	rol     a
+	and     #$03
+	ldx     #$00
+	and     #$01
+	cpx     #$00
+	bne     L001F
+	cmp     #$01
+L001F:	jsr     boolne
+	jeq     L0020
+	.dbg	line, "cq85.c", 219
+	ldy     #$DC
+	jsr     ldaxysp
+	ldy     #$11
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0021
+	cmp     #$00
+L0021:	jsr     boolne
+	jeq     L0020
+	.dbg	line, "cq85.c", 220
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cq85.c", 228
+L0020:	lda     sp
+	ldx     sp+1
+	jsr     pushax
+	lda     #$02
+	jsr     leaa0sp
+	jsr     tossubax
+	.dbg	line, "cq85.c", 229
+	cpx     #$00
+	bne     L0023
+	cmp     #$00
+L0023:	jsr     boolne
+	jne     L0024
+	lda     sp
+	ldx     sp+1
+	jsr     pushax
+	lda     #$02
+	jsr     leaa0sp
+	jsr     tossubax
+	.dbg	line, "cq85.c", 230
+	cpx     #$00
+	bne     L0025
+	cmp     #$00
+L0025:	jsr     boolne
+	jne     L0024
+	lda     sp
+	ldx     sp+1
+	jsr     pushax
+	lda     #$02
+	jsr     leaa0sp
+	jsr     tossubax
+	.dbg	line, "cq85.c", 231
+	cpx     #$00
+	bne     L0026
+	cmp     #$00
+L0026:	jsr     boolne
+	jne     L0024
+	lda     sp
+	ldx     sp+1
+	jsr     pushax
+	lda     #$02
+	jsr     leaa0sp
+	jsr     tossubax
+	.dbg	line, "cq85.c", 232
+	cpx     #$00
+	bne     L0027
+	cmp     #$00
+L0027:	jsr     boolne
+	jne     L0024
+	lda     sp
+	ldx     sp+1
+	jsr     pushax
+	lda     #$02
+	jsr     leaa0sp
+	jsr     tossubax
+	.dbg	line, "cq85.c", 233
+	cpx     #$00
+	bne     L0028
+	cmp     #$00
+L0028:	jsr     boolne
+	jne     L0024
+	lda     sp
+	ldx     sp+1
+	jsr     pushax
+	lda     #$02
+	jsr     leaa0sp
+	jsr     tossubax
+	.dbg	line, "cq85.c", 234
+	cpx     #$00
+	bne     L0029
+	cmp     #$00
+L0029:	jsr     boolne
+	jne     L0024
+	lda     sp
+	ldx     sp+1
+	jsr     pushax
+	lda     #$02
+	jsr     leaa0sp
+	jsr     tossubax
+	cpx     #$00
+	bne     L002A
+	cmp     #$00
+L002A:	jsr     boolne
+	jne     L0024
+	ldx     #$00
+	lda     #$00
+	jeq     L002B
+L0024:	ldx     #$00
+	lda     #$01
+L002B:	jeq     L0022
+	.dbg	line, "cq85.c", 235
+	ldy     #$DC
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L002D
+	cmp     #$00
+L002D:	jsr     boolne
+	jeq     L002C
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$04
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq85.c", 236
+L002C:	ldy     #$DA
+	jsr     ldaxysp
+	jsr     incax4
+	ldy     #$D9
+	jsr     staxysp
+	.dbg	line, "cq85.c", 245
+L0022:	jmp     L002E
+	.dbg	line, "cq85.c", 246
+	ldy     #$DC
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0030
+	cmp     #$00
+L0030:	jsr     boolne
+	jeq     L002F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$08
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq85.c", 247
+L002F:	ldy     #$DA
+	jsr     ldaxysp
+	jsr     incax8
+	ldy     #$D9
+	jsr     staxysp
+	.dbg	line, "cq85.c", 252
+L002E:	lda     #$A1
+	jsr     leaa0sp
+	ldy     #$D3
+	jsr     staxysp
+	.dbg	line, "cq85.c", 253
+	ldx     #$00
+	lda     #$02
+	ldy     #$A1
+	sta     (sp),y
+	.dbg	line, "cq85.c", 254
+	ldy     #$D4
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$00
+	jsr     ldauidx
+	clc
+	adc     #$01
+	ldy     #$00
+	jsr     staspidx
+	.dbg	line, "cq85.c", 255
+	ldy     #$A1
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$03
+	jsr     boolne
+	jeq     L0031
+	.dbg	line, "cq85.c", 256
+	ldy     #$DC
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0033
+	cmp     #$00
+L0033:	jsr     boolne
+	jeq     L0032
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$10
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq85.c", 257
+L0032:	ldy     #$DA
+	jsr     ldaxysp
+	ldy     #$10
+	jsr     incaxy
+	ldy     #$D9
+	jsr     staxysp
+	.dbg	line, "cq85.c", 259
+L0031:	ldy     #$DA
+	jsr     ldaxysp
+	jmp     L0001
+	.dbg	line, "cq85.c", 260
+L0001:	ldy     #$DD
+	jsr     addysp
+	rts
+
+	.dbg	line
+.segment	"DATA"
+
+M0001:
+	.byte	$73,$38,$35,$2C,$65,$72,$25,$64,$0A,$00
+M0002:
+	.byte	$73,$38,$35,$20,$20,$20,$20,$00
+M0003:
+	.addr	S0003
+	.addr	S0004
+	.addr	S0005
+	.addr	S0006
+	.addr	S0007
+	.addr	S0008
+	.addr	S0009
+M0004:
+	.byte	$20,$61,$6C,$69,$67,$6E,$6D,$65,$6E,$74,$3A,$20,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ section (int j, void *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_section: near
+
+	.dbg	func, "section", "00", extern, "_section"
+	.dbg	sym, "j", "00", auto, 2
+	.dbg	sym, "pd0", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "cq85.c", 273
+	jsr     pushax
+	.dbg	line, "cq85.c", 275
+	ldy     #$03
+	jsr     ldaxysp
+	jmp     L0002
+	.dbg	line, "cq85.c", 277
+L0002:	cpx     #$00
+	jne     L0005
+	cmp     #$00
+	jeq     L0004
+	jmp     L0003
+L0005:	jmp     L0003
+	.dbg	line, "cq85.c", 276
+L0004:	ldy     #$01
+	jsr     ldaxysp
+	jsr     _s85
+	jmp     L0003
+	.dbg	line, "cq85.c", 278
+L0003:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+	.dbg	sym, "n", "00", auto, 2
+	.dbg	sym, "args", "00", auto, 0
+	.dbg	sym, "j", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "cq85.c", 298
+	jsr     decsp2
+	ldx     #$00
+	lda     #$01
+	sta     M0001+14
+	stx     M0001+14+1
+	.dbg	line, "cq85.c", 299
+	ldx     #$00
+	lda     #$01
+	sta     M0001+16
+	stx     M0001+16+1
+	.dbg	line, "cq85.c", 300
+	ldx     #$00
+	lda     #$01
+	sta     M0001+18
+	stx     M0001+18+1
+	.dbg	line, "cq85.c", 301
+	ldx     #$00
+	lda     #$01
+	sta     M0001+20
+	stx     M0001+20+1
+	.dbg	line, "cq85.c", 303
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	sta     M0002
+	stx     M0002+1
+	.dbg	line, "cq85.c", 305
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+	jmp     L0002
+	.dbg	line, "cq85.c", 306
+L0005:	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	lda     M0002
+	ldx     M0002+1
+	jsr     _section
+	sta     M0001+22
+	stx     M0001+22+1
+	.dbg	line, "cq85.c", 307
+	lda     M0001+24
+	ldx     M0001+24+1
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     tosaddax
+	sta     M0001+24
+	stx     M0001+24+1
+	.dbg	line, "cq85.c", 308
+	lda     M0001+14
+	ldx     M0001+14+1
+	cpx     #$00
+	bne     L0008
+	cmp     #$00
+L0008:	jsr     boolne
+	jeq     L0007
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	lda     #<(M0001+26)
+	ldx     #>(M0001+26)
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "cq85.c", 305
+L0007:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0005
+	.dbg	line, "cq85.c", 311
+	lda     M0001+24
+	ldx     M0001+24+1
+	cpx     #$00
+	bne     L000A
+	cmp     #$00
+L000A:	jsr     booleq
+	jeq     L0009
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cq85.c", 312
+	jmp     L000B
+L0009:	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cq85.c", 314
+L000B:	lda     M0001+24
+	ldx     M0001+24+1
+	jmp     L0001
+	.dbg	line, "cq85.c", 315
+L0001:	jsr     incsp6
+	rts
+
+	.dbg	line
+.segment	"BSS"
+
+M0001:
+	.res	34,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
@@ -0,0 +1,694 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_printf
+	.export		_lbits
+	.export		_ubits
+	.export		_fbits
+	.export		_dbits
+	.export		_flgs
+	.export		_flgm
+	.export		_flgd
+	.export		_flgl
+	.export		_rrc
+	.export		_crc
+	.export		_rfs
+	.export		_s86
+	.export		_metricp
+	.export		_section
+	.export		_main
+
+.segment	"RODATA"
+
+S0003:
+	.byte	$53,$65,$63,$74,$69,$6F,$6E,$20,$25,$73,$20,$72,$65,$74,$75,$72
+	.byte	$6E,$65,$64,$20,$25,$64,$2E,$0A,$00
+S0004:
+	.byte	$0A,$4E,$6F,$20,$65,$72,$72,$6F,$72,$73,$20,$64,$65,$74,$65,$63
+	.byte	$74,$65,$64,$2E,$0A,$00
+S0005:
+	.byte	$0A,$46,$61,$69,$6C,$65,$64,$2E,$0A,$00
+
+.segment	"BSS"
+
+_lbits:
+	.res	2,$00
+_ubits:
+	.res	2,$00
+_fbits:
+	.res	2,$00
+_dbits:
+	.res	2,$00
+_flgs:
+	.res	2,$00
+_flgm:
+	.res	2,$00
+_flgd:
+	.res	2,$00
+_flgl:
+	.res	2,$00
+_rrc:
+	.res	2,$00
+_crc:
+	.res	2,$00
+_rfs:
+	.res	8,$00
+_metricp:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; int __near__ s86 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s86: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$0E
+	jsr     subysp
+	lda     M0004
+	ldx     M0004+1
+	jsr     decax2
+	jsr     pushax
+	jsr     pushw0sp
+	jsr     _one
+	jsr     aslax1
+	jsr     tosaddax
+	jsr     pushax
+	lda     #<(M0002)
+	ldx     #>(M0002)
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$13
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     incaxy
+	ldy     #$0A
+	jsr     staxysp
+	ldx     #$00
+	txa
+	ldy     #$0E
+	jsr     staxysp
+L0002:	ldy     #$0B
+	jsr     ldaxysp
+	sta     sreg
+	stx     sreg+1
+	ldy     #$0D
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1)
+	sta     (sreg)
+	tax
+	php
+	ldy     #$0A
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$0C
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	bne     L0002
+	lda     M0004
+	ldx     M0004+1
+	jsr     ldaxi
+	cpx     #$00
+	bne     L003F
+	cmp     #$05
+	beq     L0005
+L003F:	ldy     #$13
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0040
+	cmp     #$00
+	beq     L0007
+L0040:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L0007:	ldy     #$0F
+	jsr     ldaxysp
+	ina
+	bne     L0009
+	inx
+L0009:	ldy     #$0E
+	jsr     staxysp
+L0005:	ldy     #$03
+	jsr     ldaxysp
+	jsr     ldaxi
+	cpx     #$00
+	bne     L0041
+	cmp     #$03
+	beq     L000A
+L0041:	ldy     #$13
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0042
+	cmp     #$00
+	beq     L000C
+L0042:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$02
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L000C:	ldy     #$0F
+	jsr     ldaxysp
+	jsr     incax2
+	ldy     #$0E
+	jsr     staxysp
+L000A:	jsr     ldax0sp
+	jsr     ldaxi
+	cpx     #$00
+	bne     L0043
+	cmp     #$05
+	beq     L0049
+L0043:	ldy     #$13
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0044
+	cmp     #$00
+	beq     L0010
+L0044:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	tay
+	jsr     _printf
+L0010:	ldy     #$0F
+	jsr     ldaxysp
+	jsr     incax4
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+L0049:	txa
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$06
+	jsr     staxysp
+	bra     L0012
+L0015:	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(M0005)
+	tay
+	txa
+	adc     #>(M0005)
+	tax
+	tya
+	jsr     ldaxi
+	cpx     #$00
+	bne     L0045
+	cmp     #$00
+	beq     L0017
+L0045:	ldx     #$00
+	lda     #$01
+	ldy     #$10
+	jsr     staxysp
+L0017:	ldy     #$06
+	lda     #$01
+	jsr     addeqysp
+L0012:	ldy     #$07
+	jsr     ldaxysp
+	cmp     #$0A
+	txa
+	sbc     #$00
+	bvc     L0016
+	eor     #$80
+L0016:	asl     a
+	ldx     #$00
+	bcs     L0015
+	ldy     #$10
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L003A
+	ldy     #$13
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0046
+	cmp     #$00
+	beq     L001B
+L0046:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$08
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L001B:	ldy     #$0F
+	jsr     ldaxysp
+	jsr     incax8
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	txa
+L003A:	ldy     #$10
+	jsr     staxysp
+	ldy     #$08
+	jsr     staxysp
+	jmp     L001D
+L003C:	ldy     #$06
+	jsr     staxysp
+	jmp     L0022
+L0025:	ldy     #$09
+	jsr     ldaxysp
+	jsr     mulax3
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$07
+	jsr     ldaxysp
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	ldy     #$04
+	jsr     staxysp
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     mulax6
+	clc
+	adc     #<(M0007)
+	sta     ptr1
+	txa
+	adc     #>(M0007)
+	sta     ptr1+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	jsr     pushw
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     mulax6
+	clc
+	adc     #<(M0008)
+	sta     ptr1
+	txa
+	adc     #>(M0008)
+	sta     ptr1+1
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	jsr     ldaxi
+	jsr     tosicmp
+	bne     L0028
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     mulax6
+	clc
+	adc     #<(M0007)
+	sta     ptr1
+	txa
+	adc     #>(M0007)
+	sta     ptr1+1
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	jsr     pushw
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(M0006)
+	tay
+	txa
+	adc     #>(M0006)
+	tax
+	tya
+	jsr     ldaxi
+	jsr     tosicmp
+	beq     L0027
+L0028:	ldx     #$00
+	lda     #$01
+	ldy     #$10
+	jsr     staxysp
+L0027:	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L0022:	ldy     #$07
+	jsr     ldaxysp
+	cmp     #$03
+	txa
+	sbc     #$00
+	bvc     L0026
+	eor     #$80
+L0026:	jmi     L0025
+	ldy     #$08
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L001D:	ldy     #$09
+	jsr     ldaxysp
+	cmp     #$04
+	txa
+	sbc     #$00
+	bvc     L0021
+	eor     #$80
+L0021:	asl     a
+	lda     #$00
+	tax
+	jcs     L003C
+	ldy     #$10
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L003E
+	ldy     #$13
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0047
+	cmp     #$00
+	beq     L002C
+L0047:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$10
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L002C:	ldy     #$0F
+	jsr     ldaxysp
+	ldy     #$10
+	jsr     incaxy
+	ldy     #$0E
+	jsr     staxysp
+	ldx     #$00
+	txa
+L003E:	ldy     #$10
+	jsr     staxysp
+	ldy     #$06
+	jsr     staxysp
+	bra     L002E
+L0031:	ldy     #$07
+	jsr     ldaxysp
+	jsr     mulax6
+	clc
+	adc     #<(M0009)
+	tay
+	txa
+	adc     #>(M0009)
+	tax
+	tya
+	jsr     pushw
+	ldy     #$09
+	jsr     ldaxysp
+	ina
+	bne     L0034
+	inx
+L0034:	jsr     tosicmp
+	beq     L0033
+	ldx     #$00
+	lda     #$01
+	ldy     #$10
+	jsr     staxysp
+L0033:	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L002E:	ldy     #$07
+	jsr     ldaxysp
+	cmp     #$04
+	txa
+	sbc     #$00
+	bvc     L0032
+	eor     #$80
+L0032:	bmi     L0031
+	ldy     #$10
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L0035
+	ldy     #$13
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0048
+	cmp     #$00
+	beq     L0037
+L0048:	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	lda     #$20
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+L0037:	ldy     #$0F
+	jsr     ldaxysp
+	ldy     #$20
+	jsr     incaxy
+	ldy     #$0E
+	jsr     staxysp
+L0035:	ldy     #$0F
+	jsr     ldaxysp
+	ldy     #$14
+	jmp     addysp
+
+.segment	"DATA"
+
+M0001:
+	.byte	$73,$38,$36,$2C,$65,$72,$25,$64,$0A,$00
+M0002:
+	.byte	$73,$38,$36,$20,$20,$20,$20,$00
+M0003:
+	.word	$0001
+	.word	$0003
+	.word	$0005
+M0004:
+	.addr	M0003+4
+M0006:
+	.word	$0001
+	.word	$0003
+	.word	$0005
+	.word	$0002
+	.word	$0004
+	.word	$0006
+	.word	$0003
+	.word	$0005
+	.word	$0007
+	.word	$0000
+	.word	$0000
+	.word	$0000
+M0007:
+	.word	$0001
+	.word	$0003
+	.word	$0005
+	.word	$0002
+	.word	$0004
+	.word	$0006
+	.word	$0003
+	.word	$0005
+	.word	$0007
+	.res	6,$00
+M0008:
+	.word	$0001
+	.word	$0003
+	.word	$0005
+	.word	$0002
+	.word	$0004
+	.word	$0006
+	.word	$0003
+	.word	$0005
+	.word	$0007
+	.res	6,$00
+M0009:
+	.word	$0001
+	.res	4,$00
+	.word	$0002
+	.res	4,$00
+	.word	$0003
+	.res	4,$00
+	.word	$0004
+	.res	4,$00
+
+.segment	"BSS"
+
+M0005:
+	.res	20,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ one (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_one: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	lda     #$01
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ section (int j, void *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_section: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$02
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	bne     L0003
+	jsr     ldax0sp
+	jsr     _s86
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	ldx     #$00
+	lda     #$01
+	sta     M0001+14
+	stz     M0001+14+1
+	sta     M0001+16
+	stz     M0001+16+1
+	sta     M0001+18
+	stz     M0001+18+1
+	sta     M0001+20
+	stz     M0001+20+1
+	lda     #>(M0001)
+	sta     M0002+1
+	lda     #<(M0001)
+	sta     M0002
+	txa
+	jsr     stax0sp
+	bra     L0002
+L0005:	jsr     pushw0sp
+	lda     M0002
+	ldx     M0002+1
+	jsr     _section
+	sta     M0001+22
+	stx     M0001+22+1
+	lda     M0001+24
+	clc
+	adc     M0001+22
+	sta     M0001+24
+	lda     M0001+24+1
+	adc     M0001+22+1
+	sta     M0001+24+1
+	lda     M0001+14
+	ora     M0001+14+1
+	beq     L0007
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     #<(M0001+26)
+	ldx     #>(M0001+26)
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+L0007:	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+L0002:	jsr     ldax0sp
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	bmi     L0005
+	lda     M0001+24
+	ora     M0001+24+1
+	bne     L0009
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	bra     L000E
+L0009:	lda     #<(S0005)
+	ldx     #>(S0005)
+L000E:	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     M0001+24
+	ldx     M0001+24+1
+	jmp     incsp6
+
+.segment	"BSS"
+
+M0001:
+	.res	34,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
@@ -0,0 +1,885 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "cq86.c", 6346, 1613073744
+	.dbg		file, "common.h", 522, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/stdlib.h", 5999, 1613073744
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_lbits
+	.export		_ubits
+	.export		_fbits
+	.export		_dbits
+	.export		_flgs
+	.export		_flgm
+	.export		_flgd
+	.export		_flgl
+	.export		_rrc
+	.export		_crc
+	.export		_rfs
+	.export		_s86
+	.export		_metricp
+	.export		_section
+	.export		_main
+
+.segment	"RODATA"
+
+S0003:
+	.byte	$53,$65,$63,$74,$69,$6F,$6E,$20,$25,$73,$20,$72,$65,$74,$75,$72
+	.byte	$6E,$65,$64,$20,$25,$64,$2E,$0A,$00
+S0004:
+	.byte	$0A,$4E,$6F,$20,$65,$72,$72,$6F,$72,$73,$20,$64,$65,$74,$65,$63
+	.byte	$74,$65,$64,$2E,$0A,$00
+S0005:
+	.byte	$0A,$46,$61,$69,$6C,$65,$64,$2E,$0A,$00
+
+.segment	"BSS"
+
+_lbits:
+	.res	2,$00
+_ubits:
+	.res	2,$00
+_fbits:
+	.res	2,$00
+_dbits:
+	.res	2,$00
+_flgs:
+	.res	2,$00
+_flgm:
+	.res	2,$00
+_flgd:
+	.res	2,$00
+_flgl:
+	.res	2,$00
+_rrc:
+	.res	2,$00
+_crc:
+	.res	2,$00
+_rfs:
+	.res	8,$00
+_metricp:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; int __near__ s86 (struct defs *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_s86: near
+
+	.dbg	func, "s86", "00", extern, "_s86"
+	.dbg	sym, "pd0", "00", auto, 0
+	.dbg	sym, "lrc", "00", auto, -2
+	.dbg	sym, "rc", "00", auto, -4
+	.dbg	sym, "ps", "00", auto, -6
+	.dbg	sym, "pt", "00", auto, -8
+	.dbg	sym, "i", "00", auto, -10
+	.dbg	sym, "j", "00", auto, -12
+	.dbg	sym, "k", "00", auto, -14
+	.dbg	sym, "apint", "00", auto, -16
+	.dbg	sym, "rpint", "00", auto, -18
+
+.segment	"CODE"
+
+	.dbg	line, "cq86.c", 55
+	jsr     pushax
+	.dbg	line, "cq86.c", 68
+	ldy     #$0E
+	jsr     subysp
+	lda     M0004
+	ldx     M0004+1
+	jsr     decax2
+	jsr     pushax
+	.dbg	line, "cq86.c", 69
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	jsr     _one
+	jsr     aslax1
+	jsr     tosaddax
+	jsr     pushax
+	.dbg	line, "cq86.c", 99
+	lda     #<(M0002)
+	ldx     #>(M0002)
+	ldy     #$0C
+	jsr     staxysp
+	.dbg	line, "cq86.c", 100
+	ldy     #$13
+	jsr     ldaxysp
+	ldy     #$1A
+	jsr     incaxy
+	ldy     #$0A
+	jsr     staxysp
+	.dbg	line, "cq86.c", 101
+	ldx     #$00
+	lda     #$00
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq86.c", 102
+	jmp     L0002
+L0002:	ldy     #$0B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$00
+	jsr     staspidx
+	tax
+	php
+	ldy     #$0A
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$0C
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	plp
+	jne     L0002
+	.dbg	line, "cq86.c", 111
+	lda     M0004
+	ldx     M0004+1
+	ldy     #$01
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0006
+	cmp     #$05
+L0006:	jsr     boolne
+	jeq     L0005
+	.dbg	line, "cq86.c", 112
+	ldy     #$13
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0008
+	cmp     #$00
+L0008:	jsr     boolne
+	jeq     L0007
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq86.c", 113
+L0007:	ldy     #$0F
+	jsr     ldaxysp
+	jsr     incax1
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq86.c", 121
+L0005:	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L000A
+	cmp     #$03
+L000A:	jsr     boolne
+	jeq     L0009
+	.dbg	line, "cq86.c", 122
+	ldy     #$13
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L000C
+	cmp     #$00
+L000C:	jsr     boolne
+	jeq     L000B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq86.c", 123
+L000B:	ldy     #$0F
+	jsr     ldaxysp
+	jsr     incax2
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq86.c", 126
+L0009:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L000E
+	cmp     #$05
+L000E:	jsr     boolne
+	jeq     L000D
+	.dbg	line, "cq86.c", 127
+	ldy     #$13
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0010
+	cmp     #$00
+L0010:	jsr     boolne
+	jeq     L000F
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$04
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq86.c", 128
+L000F:	ldy     #$0F
+	jsr     ldaxysp
+	jsr     incax4
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq86.c", 135
+L000D:	ldx     #$00
+	lda     #$00
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq86.c", 136
+	ldx     #$00
+	lda     #$00
+	ldy     #$06
+	jsr     staxysp
+	jmp     L0011
+	.dbg	line, "cq86.c", 137
+L0014:	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(M0005)
+	tay
+	txa
+	adc     #>(M0005)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0017
+	cmp     #$00
+L0017:	jsr     boolne
+	jeq     L0016
+	ldx     #$00
+	lda     #$01
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq86.c", 136
+L0016:	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0011
+L0011:	ldy     #$07
+	jsr     ldaxysp
+	cmp     #$0A
+	txa
+	sbc     #$00
+	bvc     L0015
+	eor     #$80
+L0015:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0014
+	.dbg	line, "cq86.c", 138
+	ldy     #$11
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0019
+	cmp     #$00
+L0019:	jsr     boolne
+	jeq     L0018
+	.dbg	line, "cq86.c", 139
+	ldy     #$13
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L001B
+	cmp     #$00
+L001B:	jsr     boolne
+	jeq     L001A
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$08
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq86.c", 140
+L001A:	ldy     #$0F
+	jsr     ldaxysp
+	jsr     incax8
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq86.c", 146
+L0018:	ldx     #$00
+	lda     #$00
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq86.c", 147
+	ldx     #$00
+	lda     #$00
+	ldy     #$08
+	jsr     staxysp
+	jmp     L001C
+	.dbg	line, "cq86.c", 148
+L001F:	ldx     #$00
+	lda     #$00
+	ldy     #$06
+	jsr     staxysp
+	jmp     L0021
+	.dbg	line, "cq86.c", 149
+L0024:	ldy     #$09
+	jsr     ldaxysp
+	jsr     mulax3
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     tosaddax
+	ldy     #$04
+	jsr     staxysp
+	.dbg	line, "cq86.c", 150
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     mulax6
+	clc
+	adc     #<(M0007)
+	tay
+	txa
+	adc     #>(M0007)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     aslax1
+	jsr     tosaddax
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     mulax6
+	clc
+	adc     #<(M0008)
+	tay
+	txa
+	adc     #>(M0008)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     aslax1
+	jsr     tosaddax
+	.dbg	line, "cq86.c", 151
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     tosneax
+	jne     L0027
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     mulax6
+	clc
+	adc     #<(M0007)
+	tay
+	txa
+	adc     #>(M0007)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     aslax1
+	jsr     tosaddax
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(M0006)
+	tay
+	txa
+	adc     #>(M0006)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     tosneax
+	jne     L0027
+	ldx     #$00
+	lda     #$00
+	jeq     L0028
+L0027:	ldx     #$00
+	lda     #$01
+L0028:	jeq     L0026
+	ldx     #$00
+	lda     #$01
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq86.c", 148
+L0026:	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0021
+L0021:	ldy     #$07
+	jsr     ldaxysp
+	cmp     #$03
+	txa
+	sbc     #$00
+	bvc     L0025
+	eor     #$80
+L0025:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0024
+	.dbg	line, "cq86.c", 147
+	ldy     #$09
+	jsr     ldaxysp
+	ldy     #$08
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L001C
+L001C:	ldy     #$09
+	jsr     ldaxysp
+	cmp     #$04
+	txa
+	sbc     #$00
+	bvc     L0020
+	eor     #$80
+L0020:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L001F
+	.dbg	line, "cq86.c", 154
+	ldy     #$11
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L002A
+	cmp     #$00
+L002A:	jsr     boolne
+	jeq     L0029
+	.dbg	line, "cq86.c", 155
+	ldy     #$13
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L002C
+	cmp     #$00
+L002C:	jsr     boolne
+	jeq     L002B
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$10
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq86.c", 156
+L002B:	ldy     #$0F
+	jsr     ldaxysp
+	ldy     #$10
+	jsr     incaxy
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq86.c", 163
+L0029:	ldx     #$00
+	lda     #$00
+	ldy     #$10
+	jsr     staxysp
+	.dbg	line, "cq86.c", 164
+	ldx     #$00
+	lda     #$00
+	ldy     #$06
+	jsr     staxysp
+	jmp     L002D
+L0030:	ldy     #$07
+	jsr     ldaxysp
+	jsr     mulax6
+	clc
+	adc     #<(M0009)
+	tay
+	txa
+	adc     #>(M0009)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     incax1
+	jsr     tosneax
+	jeq     L0032
+	ldx     #$00
+	lda     #$01
+	ldy     #$10
+	jsr     staxysp
+L0032:	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L002D
+L002D:	ldy     #$07
+	jsr     ldaxysp
+	cmp     #$04
+	txa
+	sbc     #$00
+	bvc     L0031
+	eor     #$80
+L0031:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0030
+	.dbg	line, "cq86.c", 166
+	ldy     #$11
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0034
+	cmp     #$00
+L0034:	jsr     boolne
+	jeq     L0033
+	.dbg	line, "cq86.c", 167
+	ldy     #$13
+	jsr     ldaxysp
+	ldy     #$13
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0036
+	cmp     #$00
+L0036:	jsr     boolne
+	jeq     L0035
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$20
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "cq86.c", 168
+L0035:	ldy     #$0F
+	jsr     ldaxysp
+	ldy     #$20
+	jsr     incaxy
+	ldy     #$0E
+	jsr     staxysp
+	.dbg	line, "cq86.c", 170
+L0033:	ldy     #$0F
+	jsr     ldaxysp
+	jmp     L0001
+	.dbg	line, "cq86.c", 171
+L0001:	ldy     #$14
+	jsr     addysp
+	rts
+
+	.dbg	line
+.segment	"DATA"
+
+M0001:
+	.byte	$73,$38,$36,$2C,$65,$72,$25,$64,$0A,$00
+M0002:
+	.byte	$73,$38,$36,$20,$20,$20,$20,$00
+M0003:
+	.word	$0001
+	.word	$0003
+	.word	$0005
+M0004:
+	.addr	M0003+4
+M0006:
+	.word	$0001
+	.word	$0003
+	.word	$0005
+	.word	$0002
+	.word	$0004
+	.word	$0006
+	.word	$0003
+	.word	$0005
+	.word	$0007
+	.word	$0000
+	.word	$0000
+	.word	$0000
+M0007:
+	.word	$0001
+	.word	$0003
+	.word	$0005
+	.word	$0002
+	.word	$0004
+	.word	$0006
+	.word	$0003
+	.word	$0005
+	.word	$0007
+	.res	6,$00
+M0008:
+	.word	$0001
+	.word	$0003
+	.word	$0005
+	.word	$0002
+	.word	$0004
+	.word	$0006
+	.word	$0003
+	.word	$0005
+	.word	$0007
+	.res	6,$00
+M0009:
+	.word	$0001
+	.res	4,$00
+	.word	$0002
+	.res	4,$00
+	.word	$0003
+	.res	4,$00
+	.word	$0004
+	.res	4,$00
+
+.segment	"BSS"
+
+M0005:
+	.res	20,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ one (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_one: near
+
+	.dbg	func, "one", "00", static, "_one"
+
+.segment	"CODE"
+
+	.dbg	line, "cq86.c", 177
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+	.dbg	line, "cq86.c", 178
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ section (int j, void *pd0)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_section: near
+
+	.dbg	func, "section", "00", extern, "_section"
+	.dbg	sym, "j", "00", auto, 2
+	.dbg	sym, "pd0", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "cq86.c", 188
+	jsr     pushax
+	.dbg	line, "cq86.c", 190
+	ldy     #$03
+	jsr     ldaxysp
+	jmp     L0002
+	.dbg	line, "cq86.c", 192
+L0002:	cpx     #$00
+	jne     L0005
+	cmp     #$00
+	jeq     L0004
+	jmp     L0003
+L0005:	jmp     L0003
+	.dbg	line, "cq86.c", 191
+L0004:	ldy     #$01
+	jsr     ldaxysp
+	jsr     _s86
+	jmp     L0003
+	.dbg	line, "cq86.c", 193
+L0003:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int n, char **args)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+	.dbg	sym, "n", "00", auto, 2
+	.dbg	sym, "args", "00", auto, 0
+	.dbg	sym, "j", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "cq86.c", 213
+	jsr     decsp2
+	ldx     #$00
+	lda     #$01
+	sta     M0001+14
+	stx     M0001+14+1
+	.dbg	line, "cq86.c", 214
+	ldx     #$00
+	lda     #$01
+	sta     M0001+16
+	stx     M0001+16+1
+	.dbg	line, "cq86.c", 215
+	ldx     #$00
+	lda     #$01
+	sta     M0001+18
+	stx     M0001+18+1
+	.dbg	line, "cq86.c", 216
+	ldx     #$00
+	lda     #$01
+	sta     M0001+20
+	stx     M0001+20+1
+	.dbg	line, "cq86.c", 218
+	lda     #<(M0001)
+	ldx     #>(M0001)
+	sta     M0002
+	stx     M0002+1
+	.dbg	line, "cq86.c", 220
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+	jmp     L0002
+	.dbg	line, "cq86.c", 221
+L0005:	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	lda     M0002
+	ldx     M0002+1
+	jsr     _section
+	sta     M0001+22
+	stx     M0001+22+1
+	.dbg	line, "cq86.c", 222
+	lda     M0001+24
+	ldx     M0001+24+1
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     tosaddax
+	sta     M0001+24
+	stx     M0001+24+1
+	.dbg	line, "cq86.c", 223
+	lda     M0001+14
+	ldx     M0001+14+1
+	cpx     #$00
+	bne     L0008
+	cmp     #$00
+L0008:	jsr     boolne
+	jeq     L0007
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     #<(M0001+26)
+	ldx     #>(M0001+26)
+	jsr     pushax
+	lda     M0001+22
+	ldx     M0001+22+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "cq86.c", 220
+L0007:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0005
+	.dbg	line, "cq86.c", 226
+	lda     M0001+24
+	ldx     M0001+24+1
+	cpx     #$00
+	bne     L000A
+	cmp     #$00
+L000A:	jsr     booleq
+	jeq     L0009
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cq86.c", 227
+	jmp     L000B
+L0009:	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "cq86.c", 229
+L000B:	lda     M0001+24
+	ldx     M0001+24+1
+	jmp     L0001
+	.dbg	line, "cq86.c", 230
+L0001:	jsr     incsp6
+	rts
+
+	.dbg	line
+.segment	"BSS"
+
+M0001:
+	.res	34,$00
+M0002:
+	.res	2,$00
+
+.endproc
+
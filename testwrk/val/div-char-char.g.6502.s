@@ -0,0 +1,5023 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "div-char-char.c", 1581, 1613073744
+	.dbg		file, "/root/repo/include/stdint.h", 6196, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "div-common.h", 1838, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_res
+	.export		_test1a
+	.export		_test1b
+	.export		_test2a
+	.export		_test2b
+	.export		_test3a
+	.export		_test3b
+	.export		_test4a
+	.export		_test4b
+	.export		_test5a
+	.export		_test5b
+	.export		_test6a
+	.export		_test6b
+	.export		_test7a
+	.export		_test7b
+	.export		_test8a
+	.export		_test8b
+	.export		_test11a
+	.export		_test11b
+	.export		_test12a
+	.export		_test12b
+	.export		_test13a
+	.export		_test13b
+	.export		_test14a
+	.export		_test14b
+	.export		_test15a
+	.export		_test15b
+	.export		_test16a
+	.export		_test16b
+	.export		_test17a
+	.export		_test17b
+	.export		_test18a
+	.export		_test18b
+	.export		_test101a
+	.export		_test101b
+	.export		_test102a
+	.export		_test102b
+	.export		_test103a
+	.export		_test103b
+	.export		_main
+
+.segment	"DATA"
+
+_res:
+	.word	$0000
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$25,$64,$09,$6E,$6F,$74,$20,$65,$71,$75,$61,$6C,$3A,$20,$25,$6C
+	.byte	$64,$20,$21,$3D,$20,$25,$6C,$64,$2C,$20,$61,$20,$3D,$20,$25,$6C
+	.byte	$64,$2C,$20,$62,$20,$3D,$20,$25,$6C,$64,$0A,$09,$65,$78,$70,$65
+	.byte	$63,$74,$65,$64,$3A,$20,$20,$25,$6C,$64,$2F,$25,$6C,$64,$20,$3D
+	.byte	$20,$25,$6C,$64,$0A,$00
+S0024	:=	S0002+0
+S0004	:=	S0002+0
+S0022	:=	S0002+0
+S0006	:=	S0002+0
+S0020	:=	S0002+0
+S0008	:=	S0002+0
+S001E	:=	S0002+0
+S000A	:=	S0002+0
+S001C	:=	S0002+0
+S000C	:=	S0002+0
+S001A	:=	S0002+0
+S000E	:=	S0002+0
+S0018	:=	S0002+0
+S0010	:=	S0002+0
+S0016	:=	S0002+0
+S0012	:=	S0002+0
+S0014	:=	S0002+0
+S0026	:=	S0002+0
+S0015:
+	.byte	$25,$64,$09,$69,$6E,$63,$6F,$72,$72,$65,$63,$74,$3A,$20,$61,$2F
+	.byte	$25,$6C,$64,$20,$3D,$20,$25,$6C,$64,$2C,$20,$61,$2F,$62,$20,$3D
+	.byte	$20,$25,$6C,$64,$0A,$09,$65,$78,$70,$65,$63,$74,$65,$64,$3A,$20
+	.byte	$20,$25,$6C,$64,$2F,$25,$6C,$64,$20,$3D,$20,$25,$6C,$64,$0A,$00
+S0011	:=	S0015+0
+S0017	:=	S0015+0
+S000F	:=	S0015+0
+S0019	:=	S0015+0
+S000D	:=	S0015+0
+S001B	:=	S0015+0
+S000B	:=	S0015+0
+S001D	:=	S0015+0
+S0009	:=	S0015+0
+S001F	:=	S0015+0
+S0007	:=	S0015+0
+S0021	:=	S0015+0
+S0005	:=	S0015+0
+S0023	:=	S0015+0
+S0003	:=	S0015+0
+S0025	:=	S0015+0
+S0013	:=	S0015+0
+S0001	:=	S0015+0
+
+; ---------------------------------------------------------------
+; int __near__ test1a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test1a: near
+
+	.dbg	func, "test1a", "00", extern, "_test1a"
+	.dbg	sym, "a", "00", auto, -1
+	.dbg	sym, "b", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "div-char-char.c", 14
+	lda     #$01
+	jsr     pusha
+	lda     #$08
+	jsr     pusha
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0003
+	dex
+L0003:	jsr     pushax
+	ldx     #$00
+	lda     #$08
+	jsr     tosdivax
+	cpx     #$00
+	bne     L0004
+	cmp     #$00
+L0004:	jsr     booleq
+	jeq     L0005
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0006
+	dex
+L0006:	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0007
+	dex
+L0007:	jsr     tosdivax
+	cpx     #$00
+	bne     L0008
+	cmp     #$00
+L0008:	jsr     booleq
+	jne     L0009
+L0005:	ldx     #$00
+	lda     #$00
+	jeq     L000A
+L0009:	ldx     #$00
+	lda     #$01
+L000A:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L000B
+	jmp     L000B
+L0002:	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     pusheax
+	ldy     #$09
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000C
+	dex
+L000C:	jsr     pushax
+	ldx     #$00
+	lda     #$08
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000D
+	dex
+L000D:	jsr     pushax
+	ldy     #$0E
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000E
+	dex
+L000E:	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L000B
+L000B:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test1b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test1b: near
+
+	.dbg	func, "test1b", "00", extern, "_test1b"
+	.dbg	sym, "a", "00", auto, -1
+	.dbg	sym, "b", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "div-char-char.c", 14
+	lda     #$01
+	jsr     pusha
+	lda     #$08
+	jsr     pusha
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0003
+	dex
+L0003:	jsr     pushax
+	ldx     #$00
+	lda     #$08
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$03
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0004
+	dex
+L0004:	jsr     pushax
+	ldy     #$04
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0005
+	dex
+L0005:	jsr     tosdivax
+	jsr     toseqax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldy     #$05
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0007
+	dex
+L0007:	jsr     pushax
+	ldx     #$00
+	lda     #$08
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$09
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0008
+	dex
+L0008:	jsr     pushax
+	ldy     #$0A
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0009
+	dex
+L0009:	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000A
+	dex
+L000A:	jsr     axlong
+	jsr     pusheax
+	ldy     #$10
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000B
+	dex
+L000B:	jsr     axlong
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test2a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test2a: near
+
+	.dbg	func, "test2a", "00", extern, "_test2a"
+	.dbg	sym, "a", "00", auto, -1
+	.dbg	sym, "b", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "div-char-char.c", 15
+	lda     #$FF
+	jsr     pusha
+	lda     #$08
+	jsr     pusha
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0003
+	dex
+L0003:	jsr     pushax
+	ldx     #$00
+	lda     #$08
+	jsr     tosdivax
+	cpx     #$00
+	bne     L0004
+	cmp     #$00
+L0004:	jsr     booleq
+	jeq     L0005
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0006
+	dex
+L0006:	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0007
+	dex
+L0007:	jsr     tosdivax
+	cpx     #$00
+	bne     L0008
+	cmp     #$00
+L0008:	jsr     booleq
+	jne     L0009
+L0005:	ldx     #$00
+	lda     #$00
+	jeq     L000A
+L0009:	ldx     #$00
+	lda     #$01
+L000A:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L000B
+	jmp     L000B
+L0002:	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     pushax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     pusheax
+	ldy     #$09
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000C
+	dex
+L000C:	jsr     pushax
+	ldx     #$00
+	lda     #$08
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000D
+	dex
+L000D:	jsr     pushax
+	ldy     #$0E
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000E
+	dex
+L000E:	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L000B
+L000B:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test2b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test2b: near
+
+	.dbg	func, "test2b", "00", extern, "_test2b"
+	.dbg	sym, "a", "00", auto, -1
+	.dbg	sym, "b", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "div-char-char.c", 15
+	lda     #$FF
+	jsr     pusha
+	lda     #$08
+	jsr     pusha
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0003
+	dex
+L0003:	jsr     pushax
+	ldx     #$00
+	lda     #$08
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$03
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0004
+	dex
+L0004:	jsr     pushax
+	ldy     #$04
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0005
+	dex
+L0005:	jsr     tosdivax
+	jsr     toseqax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     pushax
+	ldy     #$05
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0007
+	dex
+L0007:	jsr     pushax
+	ldx     #$00
+	lda     #$08
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$09
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0008
+	dex
+L0008:	jsr     pushax
+	ldy     #$0A
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0009
+	dex
+L0009:	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000A
+	dex
+L000A:	jsr     axlong
+	jsr     pusheax
+	ldy     #$10
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000B
+	dex
+L000B:	jsr     axlong
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test3a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test3a: near
+
+	.dbg	func, "test3a", "00", extern, "_test3a"
+	.dbg	sym, "a", "00", auto, -1
+	.dbg	sym, "b", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "div-char-char.c", 16
+	lda     #$01
+	jsr     pusha
+	lda     #$F8
+	jsr     pusha
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0003
+	dex
+L0003:	jsr     pushax
+	ldx     #$FF
+	lda     #$F8
+	jsr     tosdivax
+	cpx     #$00
+	bne     L0004
+	cmp     #$00
+L0004:	jsr     booleq
+	jeq     L0005
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0006
+	dex
+L0006:	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0007
+	dex
+L0007:	jsr     tosdivax
+	cpx     #$00
+	bne     L0008
+	cmp     #$00
+L0008:	jsr     booleq
+	jne     L0009
+L0005:	ldx     #$00
+	lda     #$00
+	jeq     L000A
+L0009:	ldx     #$00
+	lda     #$01
+L000A:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L000B
+	jmp     L000B
+L0002:	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldx     #$00
+	lda     #$03
+	jsr     pushax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	ldy     #$09
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000C
+	dex
+L000C:	jsr     pushax
+	ldx     #$FF
+	lda     #$F8
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000D
+	dex
+L000D:	jsr     pushax
+	ldy     #$0E
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000E
+	dex
+L000E:	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L000B
+L000B:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test3b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test3b: near
+
+	.dbg	func, "test3b", "00", extern, "_test3b"
+	.dbg	sym, "a", "00", auto, -1
+	.dbg	sym, "b", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "div-char-char.c", 16
+	lda     #$01
+	jsr     pusha
+	lda     #$F8
+	jsr     pusha
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0003
+	dex
+L0003:	jsr     pushax
+	ldx     #$FF
+	lda     #$F8
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$03
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0004
+	dex
+L0004:	jsr     pushax
+	ldy     #$04
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0005
+	dex
+L0005:	jsr     tosdivax
+	jsr     toseqax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldx     #$00
+	lda     #$03
+	jsr     pushax
+	ldy     #$05
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0007
+	dex
+L0007:	jsr     pushax
+	ldx     #$FF
+	lda     #$F8
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$09
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0008
+	dex
+L0008:	jsr     pushax
+	ldy     #$0A
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0009
+	dex
+L0009:	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000A
+	dex
+L000A:	jsr     axlong
+	jsr     pusheax
+	ldy     #$10
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000B
+	dex
+L000B:	jsr     axlong
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test4a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test4a: near
+
+	.dbg	func, "test4a", "00", extern, "_test4a"
+	.dbg	sym, "a", "00", auto, -1
+	.dbg	sym, "b", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "div-char-char.c", 17
+	lda     #$FF
+	jsr     pusha
+	lda     #$F8
+	jsr     pusha
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0003
+	dex
+L0003:	jsr     pushax
+	ldx     #$FF
+	lda     #$F8
+	jsr     tosdivax
+	cpx     #$00
+	bne     L0004
+	cmp     #$00
+L0004:	jsr     booleq
+	jeq     L0005
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0006
+	dex
+L0006:	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0007
+	dex
+L0007:	jsr     tosdivax
+	cpx     #$00
+	bne     L0008
+	cmp     #$00
+L0008:	jsr     booleq
+	jne     L0009
+L0005:	ldx     #$00
+	lda     #$00
+	jeq     L000A
+L0009:	ldx     #$00
+	lda     #$01
+L000A:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L000B
+	jmp     L000B
+L0002:	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldx     #$00
+	lda     #$04
+	jsr     pushax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	ldy     #$09
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000C
+	dex
+L000C:	jsr     pushax
+	ldx     #$FF
+	lda     #$F8
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000D
+	dex
+L000D:	jsr     pushax
+	ldy     #$0E
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000E
+	dex
+L000E:	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L000B
+L000B:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test4b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test4b: near
+
+	.dbg	func, "test4b", "00", extern, "_test4b"
+	.dbg	sym, "a", "00", auto, -1
+	.dbg	sym, "b", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "div-char-char.c", 17
+	lda     #$FF
+	jsr     pusha
+	lda     #$F8
+	jsr     pusha
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0003
+	dex
+L0003:	jsr     pushax
+	ldx     #$FF
+	lda     #$F8
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$03
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0004
+	dex
+L0004:	jsr     pushax
+	ldy     #$04
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0005
+	dex
+L0005:	jsr     tosdivax
+	jsr     toseqax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldx     #$00
+	lda     #$04
+	jsr     pushax
+	ldy     #$05
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0007
+	dex
+L0007:	jsr     pushax
+	ldx     #$FF
+	lda     #$F8
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$09
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0008
+	dex
+L0008:	jsr     pushax
+	ldy     #$0A
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0009
+	dex
+L0009:	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000A
+	dex
+L000A:	jsr     axlong
+	jsr     pusheax
+	ldy     #$10
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000B
+	dex
+L000B:	jsr     axlong
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test5a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test5a: near
+
+	.dbg	func, "test5a", "00", extern, "_test5a"
+	.dbg	sym, "a", "00", auto, -1
+	.dbg	sym, "b", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "div-char-char.c", 18
+	lda     #$08
+	jsr     pusha
+	lda     #$01
+	jsr     pusha
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0003
+	dex
+L0003:	cpx     #$00
+	bne     L0004
+	cmp     #$08
+L0004:	jsr     booleq
+	jeq     L0005
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0006
+	dex
+L0006:	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0007
+	dex
+L0007:	jsr     tosdivax
+	cpx     #$00
+	bne     L0008
+	cmp     #$08
+L0008:	jsr     booleq
+	jne     L0009
+L0005:	ldx     #$00
+	lda     #$00
+	jeq     L000A
+L0009:	ldx     #$00
+	lda     #$01
+L000A:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L000B
+	jmp     L000B
+L0002:	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldx     #$00
+	lda     #$05
+	jsr     pushax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     pusheax
+	ldy     #$09
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000C
+	dex
+L000C:	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000D
+	dex
+L000D:	jsr     pushax
+	ldy     #$0E
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000E
+	dex
+L000E:	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L000B
+L000B:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test5b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test5b: near
+
+	.dbg	func, "test5b", "00", extern, "_test5b"
+	.dbg	sym, "a", "00", auto, -1
+	.dbg	sym, "b", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "div-char-char.c", 18
+	lda     #$08
+	jsr     pusha
+	lda     #$01
+	jsr     pusha
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0003
+	dex
+L0003:	jsr     pushax
+	ldy     #$03
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0004
+	dex
+L0004:	jsr     pushax
+	ldy     #$04
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0005
+	dex
+L0005:	jsr     tosdivax
+	jsr     toseqax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldx     #$00
+	lda     #$05
+	jsr     pushax
+	ldy     #$05
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0007
+	dex
+L0007:	jsr     axlong
+	jsr     pusheax
+	ldy     #$09
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0008
+	dex
+L0008:	jsr     pushax
+	ldy     #$0A
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0009
+	dex
+L0009:	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000A
+	dex
+L000A:	jsr     axlong
+	jsr     pusheax
+	ldy     #$10
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000B
+	dex
+L000B:	jsr     axlong
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test6a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test6a: near
+
+	.dbg	func, "test6a", "00", extern, "_test6a"
+	.dbg	sym, "a", "00", auto, -1
+	.dbg	sym, "b", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "div-char-char.c", 19
+	lda     #$F8
+	jsr     pusha
+	lda     #$01
+	jsr     pusha
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0003
+	dex
+L0003:	cpx     #$FF
+	bne     L0004
+	cmp     #$F8
+L0004:	jsr     booleq
+	jeq     L0005
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0006
+	dex
+L0006:	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0007
+	dex
+L0007:	jsr     tosdivax
+	cpx     #$FF
+	bne     L0008
+	cmp     #$F8
+L0008:	jsr     booleq
+	jne     L0009
+L0005:	ldx     #$00
+	lda     #$00
+	jeq     L000A
+L0009:	ldx     #$00
+	lda     #$01
+L000A:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L000B
+	jmp     L000B
+L0002:	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldx     #$00
+	lda     #$06
+	jsr     pushax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     pusheax
+	ldy     #$09
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000C
+	dex
+L000C:	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000D
+	dex
+L000D:	jsr     pushax
+	ldy     #$0E
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000E
+	dex
+L000E:	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L000B
+L000B:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test6b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test6b: near
+
+	.dbg	func, "test6b", "00", extern, "_test6b"
+	.dbg	sym, "a", "00", auto, -1
+	.dbg	sym, "b", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "div-char-char.c", 19
+	lda     #$F8
+	jsr     pusha
+	lda     #$01
+	jsr     pusha
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0003
+	dex
+L0003:	jsr     pushax
+	ldy     #$03
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0004
+	dex
+L0004:	jsr     pushax
+	ldy     #$04
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0005
+	dex
+L0005:	jsr     tosdivax
+	jsr     toseqax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	ldx     #$00
+	lda     #$06
+	jsr     pushax
+	ldy     #$05
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0007
+	dex
+L0007:	jsr     axlong
+	jsr     pusheax
+	ldy     #$09
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0008
+	dex
+L0008:	jsr     pushax
+	ldy     #$0A
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0009
+	dex
+L0009:	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000A
+	dex
+L000A:	jsr     axlong
+	jsr     pusheax
+	ldy     #$10
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000B
+	dex
+L000B:	jsr     axlong
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test7a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test7a: near
+
+	.dbg	func, "test7a", "00", extern, "_test7a"
+	.dbg	sym, "a", "00", auto, -1
+	.dbg	sym, "b", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "div-char-char.c", 20
+	lda     #$08
+	jsr     pusha
+	lda     #$FF
+	jsr     pusha
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0003
+	dex
+L0003:	jsr     negax
+	cpx     #$FF
+	bne     L0004
+	cmp     #$F8
+L0004:	jsr     booleq
+	jeq     L0005
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0006
+	dex
+L0006:	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0007
+	dex
+L0007:	jsr     tosdivax
+	cpx     #$FF
+	bne     L0008
+	cmp     #$F8
+L0008:	jsr     booleq
+	jne     L0009
+L0005:	ldx     #$00
+	lda     #$00
+	jeq     L000A
+L0009:	ldx     #$00
+	lda     #$01
+L000A:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L000B
+	jmp     L000B
+L0002:	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	ldx     #$00
+	lda     #$07
+	jsr     pushax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldy     #$09
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000C
+	dex
+L000C:	jsr     negax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000D
+	dex
+L000D:	jsr     pushax
+	ldy     #$0E
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000E
+	dex
+L000E:	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L000B
+L000B:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test7b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test7b: near
+
+	.dbg	func, "test7b", "00", extern, "_test7b"
+	.dbg	sym, "a", "00", auto, -1
+	.dbg	sym, "b", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "div-char-char.c", 20
+	lda     #$08
+	jsr     pusha
+	lda     #$FF
+	jsr     pusha
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0003
+	dex
+L0003:	jsr     negax
+	jsr     pushax
+	ldy     #$03
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0004
+	dex
+L0004:	jsr     pushax
+	ldy     #$04
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0005
+	dex
+L0005:	jsr     tosdivax
+	jsr     toseqax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	ldx     #$00
+	lda     #$07
+	jsr     pushax
+	ldy     #$05
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0007
+	dex
+L0007:	jsr     negax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$09
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0008
+	dex
+L0008:	jsr     pushax
+	ldy     #$0A
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0009
+	dex
+L0009:	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000A
+	dex
+L000A:	jsr     axlong
+	jsr     pusheax
+	ldy     #$10
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000B
+	dex
+L000B:	jsr     axlong
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test8a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test8a: near
+
+	.dbg	func, "test8a", "00", extern, "_test8a"
+	.dbg	sym, "a", "00", auto, -1
+	.dbg	sym, "b", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "div-char-char.c", 21
+	lda     #$F8
+	jsr     pusha
+	lda     #$FF
+	jsr     pusha
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0003
+	dex
+L0003:	jsr     negax
+	cpx     #$00
+	bne     L0004
+	cmp     #$08
+L0004:	jsr     booleq
+	jeq     L0005
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0006
+	dex
+L0006:	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0007
+	dex
+L0007:	jsr     tosdivax
+	cpx     #$00
+	bne     L0008
+	cmp     #$08
+L0008:	jsr     booleq
+	jne     L0009
+L0005:	ldx     #$00
+	lda     #$00
+	jeq     L000A
+L0009:	ldx     #$00
+	lda     #$01
+L000A:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L000B
+	jmp     L000B
+L0002:	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	ldx     #$00
+	lda     #$08
+	jsr     pushax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldy     #$09
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000C
+	dex
+L000C:	jsr     negax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000D
+	dex
+L000D:	jsr     pushax
+	ldy     #$0E
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000E
+	dex
+L000E:	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L000B
+L000B:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test8b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test8b: near
+
+	.dbg	func, "test8b", "00", extern, "_test8b"
+	.dbg	sym, "a", "00", auto, -1
+	.dbg	sym, "b", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "div-char-char.c", 21
+	lda     #$F8
+	jsr     pusha
+	lda     #$FF
+	jsr     pusha
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0003
+	dex
+L0003:	jsr     negax
+	jsr     pushax
+	ldy     #$03
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0004
+	dex
+L0004:	jsr     pushax
+	ldy     #$04
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0005
+	dex
+L0005:	jsr     tosdivax
+	jsr     toseqax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	ldx     #$00
+	lda     #$08
+	jsr     pushax
+	ldy     #$05
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0007
+	dex
+L0007:	jsr     negax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$09
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0008
+	dex
+L0008:	jsr     pushax
+	ldy     #$0A
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0009
+	dex
+L0009:	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000A
+	dex
+L000A:	jsr     axlong
+	jsr     pusheax
+	ldy     #$10
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000B
+	dex
+L000B:	jsr     axlong
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test11a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test11a: near
+
+	.dbg	func, "test11a", "00", extern, "_test11a"
+	.dbg	sym, "a", "00", auto, -1
+	.dbg	sym, "b", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "div-char-char.c", 23
+	lda     #$20
+	jsr     pusha
+	lda     #$40
+	jsr     pusha
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0003
+	dex
+L0003:	jsr     pushax
+	ldx     #$00
+	lda     #$40
+	jsr     tosdivax
+	cpx     #$00
+	bne     L0004
+	cmp     #$00
+L0004:	jsr     booleq
+	jeq     L0005
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0006
+	dex
+L0006:	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0007
+	dex
+L0007:	jsr     tosdivax
+	cpx     #$00
+	bne     L0008
+	cmp     #$00
+L0008:	jsr     booleq
+	jne     L0009
+L0005:	ldx     #$00
+	lda     #$00
+	jeq     L000A
+L0009:	ldx     #$00
+	lda     #$01
+L000A:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L000B
+	jmp     L000B
+L0002:	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	ldx     #$00
+	lda     #$0B
+	jsr     pushax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$40
+	jsr     pusheax
+	ldy     #$09
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000C
+	dex
+L000C:	jsr     pushax
+	ldx     #$00
+	lda     #$40
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000D
+	dex
+L000D:	jsr     pushax
+	ldy     #$0E
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000E
+	dex
+L000E:	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$20
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$40
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L000B
+L000B:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test11b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test11b: near
+
+	.dbg	func, "test11b", "00", extern, "_test11b"
+	.dbg	sym, "a", "00", auto, -1
+	.dbg	sym, "b", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "div-char-char.c", 23
+	lda     #$20
+	jsr     pusha
+	lda     #$40
+	jsr     pusha
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0003
+	dex
+L0003:	jsr     pushax
+	ldx     #$00
+	lda     #$40
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$03
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0004
+	dex
+L0004:	jsr     pushax
+	ldy     #$04
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0005
+	dex
+L0005:	jsr     tosdivax
+	jsr     toseqax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	ldx     #$00
+	lda     #$0B
+	jsr     pushax
+	ldy     #$05
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0007
+	dex
+L0007:	jsr     pushax
+	ldx     #$00
+	lda     #$40
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$09
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0008
+	dex
+L0008:	jsr     pushax
+	ldy     #$0A
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0009
+	dex
+L0009:	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000A
+	dex
+L000A:	jsr     axlong
+	jsr     pusheax
+	ldy     #$10
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000B
+	dex
+L000B:	jsr     axlong
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$20
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$40
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test12a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test12a: near
+
+	.dbg	func, "test12a", "00", extern, "_test12a"
+	.dbg	sym, "a", "00", auto, -1
+	.dbg	sym, "b", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "div-char-char.c", 24
+	lda     #$E0
+	jsr     pusha
+	lda     #$40
+	jsr     pusha
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0003
+	dex
+L0003:	jsr     pushax
+	ldx     #$00
+	lda     #$40
+	jsr     tosdivax
+	cpx     #$00
+	bne     L0004
+	cmp     #$00
+L0004:	jsr     booleq
+	jeq     L0005
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0006
+	dex
+L0006:	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0007
+	dex
+L0007:	jsr     tosdivax
+	cpx     #$00
+	bne     L0008
+	cmp     #$00
+L0008:	jsr     booleq
+	jne     L0009
+L0005:	ldx     #$00
+	lda     #$00
+	jeq     L000A
+L0009:	ldx     #$00
+	lda     #$01
+L000A:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L000B
+	jmp     L000B
+L0002:	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	ldx     #$00
+	lda     #$0C
+	jsr     pushax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$40
+	jsr     pusheax
+	ldy     #$09
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000C
+	dex
+L000C:	jsr     pushax
+	ldx     #$00
+	lda     #$40
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000D
+	dex
+L000D:	jsr     pushax
+	ldy     #$0E
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000E
+	dex
+L000E:	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$E0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$40
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L000B
+L000B:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test12b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test12b: near
+
+	.dbg	func, "test12b", "00", extern, "_test12b"
+	.dbg	sym, "a", "00", auto, -1
+	.dbg	sym, "b", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "div-char-char.c", 24
+	lda     #$E0
+	jsr     pusha
+	lda     #$40
+	jsr     pusha
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0003
+	dex
+L0003:	jsr     pushax
+	ldx     #$00
+	lda     #$40
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$03
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0004
+	dex
+L0004:	jsr     pushax
+	ldy     #$04
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0005
+	dex
+L0005:	jsr     tosdivax
+	jsr     toseqax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	ldx     #$00
+	lda     #$0C
+	jsr     pushax
+	ldy     #$05
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0007
+	dex
+L0007:	jsr     pushax
+	ldx     #$00
+	lda     #$40
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$09
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0008
+	dex
+L0008:	jsr     pushax
+	ldy     #$0A
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0009
+	dex
+L0009:	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000A
+	dex
+L000A:	jsr     axlong
+	jsr     pusheax
+	ldy     #$10
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000B
+	dex
+L000B:	jsr     axlong
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$E0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$40
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test13a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test13a: near
+
+	.dbg	func, "test13a", "00", extern, "_test13a"
+	.dbg	sym, "a", "00", auto, -1
+	.dbg	sym, "b", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "div-char-char.c", 25
+	lda     #$20
+	jsr     pusha
+	lda     #$C0
+	jsr     pusha
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0003
+	dex
+L0003:	jsr     pushax
+	ldx     #$FF
+	lda     #$C0
+	jsr     tosdivax
+	cpx     #$00
+	bne     L0004
+	cmp     #$00
+L0004:	jsr     booleq
+	jeq     L0005
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0006
+	dex
+L0006:	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0007
+	dex
+L0007:	jsr     tosdivax
+	cpx     #$00
+	bne     L0008
+	cmp     #$00
+L0008:	jsr     booleq
+	jne     L0009
+L0005:	ldx     #$00
+	lda     #$00
+	jeq     L000A
+L0009:	ldx     #$00
+	lda     #$01
+L000A:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L000B
+	jmp     L000B
+L0002:	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+	ldx     #$00
+	lda     #$0D
+	jsr     pushax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$C0
+	jsr     pusheax
+	ldy     #$09
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000C
+	dex
+L000C:	jsr     pushax
+	ldx     #$FF
+	lda     #$C0
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000D
+	dex
+L000D:	jsr     pushax
+	ldy     #$0E
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000E
+	dex
+L000E:	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$20
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$C0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L000B
+L000B:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test13b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test13b: near
+
+	.dbg	func, "test13b", "00", extern, "_test13b"
+	.dbg	sym, "a", "00", auto, -1
+	.dbg	sym, "b", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "div-char-char.c", 25
+	lda     #$20
+	jsr     pusha
+	lda     #$C0
+	jsr     pusha
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0003
+	dex
+L0003:	jsr     pushax
+	ldx     #$FF
+	lda     #$C0
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$03
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0004
+	dex
+L0004:	jsr     pushax
+	ldy     #$04
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0005
+	dex
+L0005:	jsr     tosdivax
+	jsr     toseqax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S0016)
+	ldx     #>(S0016)
+	jsr     pushax
+	ldx     #$00
+	lda     #$0D
+	jsr     pushax
+	ldy     #$05
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0007
+	dex
+L0007:	jsr     pushax
+	ldx     #$FF
+	lda     #$C0
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$09
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0008
+	dex
+L0008:	jsr     pushax
+	ldy     #$0A
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0009
+	dex
+L0009:	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000A
+	dex
+L000A:	jsr     axlong
+	jsr     pusheax
+	ldy     #$10
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000B
+	dex
+L000B:	jsr     axlong
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$20
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$C0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test14a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test14a: near
+
+	.dbg	func, "test14a", "00", extern, "_test14a"
+	.dbg	sym, "a", "00", auto, -1
+	.dbg	sym, "b", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "div-char-char.c", 26
+	lda     #$E0
+	jsr     pusha
+	lda     #$C0
+	jsr     pusha
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0003
+	dex
+L0003:	jsr     pushax
+	ldx     #$FF
+	lda     #$C0
+	jsr     tosdivax
+	cpx     #$00
+	bne     L0004
+	cmp     #$00
+L0004:	jsr     booleq
+	jeq     L0005
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0006
+	dex
+L0006:	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0007
+	dex
+L0007:	jsr     tosdivax
+	cpx     #$00
+	bne     L0008
+	cmp     #$00
+L0008:	jsr     booleq
+	jne     L0009
+L0005:	ldx     #$00
+	lda     #$00
+	jeq     L000A
+L0009:	ldx     #$00
+	lda     #$01
+L000A:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L000B
+	jmp     L000B
+L0002:	lda     #<(S0017)
+	ldx     #>(S0017)
+	jsr     pushax
+	ldx     #$00
+	lda     #$0E
+	jsr     pushax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$C0
+	jsr     pusheax
+	ldy     #$09
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000C
+	dex
+L000C:	jsr     pushax
+	ldx     #$FF
+	lda     #$C0
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000D
+	dex
+L000D:	jsr     pushax
+	ldy     #$0E
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000E
+	dex
+L000E:	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$E0
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$C0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L000B
+L000B:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test14b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test14b: near
+
+	.dbg	func, "test14b", "00", extern, "_test14b"
+	.dbg	sym, "a", "00", auto, -1
+	.dbg	sym, "b", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "div-char-char.c", 26
+	lda     #$E0
+	jsr     pusha
+	lda     #$C0
+	jsr     pusha
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0003
+	dex
+L0003:	jsr     pushax
+	ldx     #$FF
+	lda     #$C0
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$03
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0004
+	dex
+L0004:	jsr     pushax
+	ldy     #$04
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0005
+	dex
+L0005:	jsr     tosdivax
+	jsr     toseqax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S0018)
+	ldx     #>(S0018)
+	jsr     pushax
+	ldx     #$00
+	lda     #$0E
+	jsr     pushax
+	ldy     #$05
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0007
+	dex
+L0007:	jsr     pushax
+	ldx     #$FF
+	lda     #$C0
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$09
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0008
+	dex
+L0008:	jsr     pushax
+	ldy     #$0A
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0009
+	dex
+L0009:	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000A
+	dex
+L000A:	jsr     axlong
+	jsr     pusheax
+	ldy     #$10
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000B
+	dex
+L000B:	jsr     axlong
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$E0
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$C0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test15a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test15a: near
+
+	.dbg	func, "test15a", "00", extern, "_test15a"
+	.dbg	sym, "a", "00", auto, -1
+	.dbg	sym, "b", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "div-char-char.c", 27
+	lda     #$40
+	jsr     pusha
+	lda     #$20
+	jsr     pusha
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0003
+	dex
+L0003:	jsr     pushax
+	ldx     #$00
+	lda     #$20
+	jsr     tosdivax
+	cpx     #$00
+	bne     L0004
+	cmp     #$02
+L0004:	jsr     booleq
+	jeq     L0005
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0006
+	dex
+L0006:	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0007
+	dex
+L0007:	jsr     tosdivax
+	cpx     #$00
+	bne     L0008
+	cmp     #$02
+L0008:	jsr     booleq
+	jne     L0009
+L0005:	ldx     #$00
+	lda     #$00
+	jeq     L000A
+L0009:	ldx     #$00
+	lda     #$01
+L000A:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L000B
+	jmp     L000B
+L0002:	lda     #<(S0019)
+	ldx     #>(S0019)
+	jsr     pushax
+	ldx     #$00
+	lda     #$0F
+	jsr     pushax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$20
+	jsr     pusheax
+	ldy     #$09
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000C
+	dex
+L000C:	jsr     pushax
+	ldx     #$00
+	lda     #$20
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000D
+	dex
+L000D:	jsr     pushax
+	ldy     #$0E
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000E
+	dex
+L000E:	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$40
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$20
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L000B
+L000B:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test15b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test15b: near
+
+	.dbg	func, "test15b", "00", extern, "_test15b"
+	.dbg	sym, "a", "00", auto, -1
+	.dbg	sym, "b", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "div-char-char.c", 27
+	lda     #$40
+	jsr     pusha
+	lda     #$20
+	jsr     pusha
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0003
+	dex
+L0003:	jsr     pushax
+	ldx     #$00
+	lda     #$20
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$03
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0004
+	dex
+L0004:	jsr     pushax
+	ldy     #$04
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0005
+	dex
+L0005:	jsr     tosdivax
+	jsr     toseqax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S001A)
+	ldx     #>(S001A)
+	jsr     pushax
+	ldx     #$00
+	lda     #$0F
+	jsr     pushax
+	ldy     #$05
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0007
+	dex
+L0007:	jsr     pushax
+	ldx     #$00
+	lda     #$20
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$09
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0008
+	dex
+L0008:	jsr     pushax
+	ldy     #$0A
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0009
+	dex
+L0009:	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000A
+	dex
+L000A:	jsr     axlong
+	jsr     pusheax
+	ldy     #$10
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000B
+	dex
+L000B:	jsr     axlong
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$40
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$20
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test16a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test16a: near
+
+	.dbg	func, "test16a", "00", extern, "_test16a"
+	.dbg	sym, "a", "00", auto, -1
+	.dbg	sym, "b", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "div-char-char.c", 28
+	lda     #$C0
+	jsr     pusha
+	lda     #$20
+	jsr     pusha
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0003
+	dex
+L0003:	jsr     pushax
+	ldx     #$00
+	lda     #$20
+	jsr     tosdivax
+	cpx     #$FF
+	bne     L0004
+	cmp     #$FE
+L0004:	jsr     booleq
+	jeq     L0005
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0006
+	dex
+L0006:	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0007
+	dex
+L0007:	jsr     tosdivax
+	cpx     #$FF
+	bne     L0008
+	cmp     #$FE
+L0008:	jsr     booleq
+	jne     L0009
+L0005:	ldx     #$00
+	lda     #$00
+	jeq     L000A
+L0009:	ldx     #$00
+	lda     #$01
+L000A:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L000B
+	jmp     L000B
+L0002:	lda     #<(S001B)
+	ldx     #>(S001B)
+	jsr     pushax
+	ldx     #$00
+	lda     #$10
+	jsr     pushax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$20
+	jsr     pusheax
+	ldy     #$09
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000C
+	dex
+L000C:	jsr     pushax
+	ldx     #$00
+	lda     #$20
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000D
+	dex
+L000D:	jsr     pushax
+	ldy     #$0E
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000E
+	dex
+L000E:	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$C0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$20
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FE
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L000B
+L000B:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test16b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test16b: near
+
+	.dbg	func, "test16b", "00", extern, "_test16b"
+	.dbg	sym, "a", "00", auto, -1
+	.dbg	sym, "b", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "div-char-char.c", 28
+	lda     #$C0
+	jsr     pusha
+	lda     #$20
+	jsr     pusha
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0003
+	dex
+L0003:	jsr     pushax
+	ldx     #$00
+	lda     #$20
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$03
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0004
+	dex
+L0004:	jsr     pushax
+	ldy     #$04
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0005
+	dex
+L0005:	jsr     tosdivax
+	jsr     toseqax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S001C)
+	ldx     #>(S001C)
+	jsr     pushax
+	ldx     #$00
+	lda     #$10
+	jsr     pushax
+	ldy     #$05
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0007
+	dex
+L0007:	jsr     pushax
+	ldx     #$00
+	lda     #$20
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$09
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0008
+	dex
+L0008:	jsr     pushax
+	ldy     #$0A
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0009
+	dex
+L0009:	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000A
+	dex
+L000A:	jsr     axlong
+	jsr     pusheax
+	ldy     #$10
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000B
+	dex
+L000B:	jsr     axlong
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$C0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$20
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FE
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test17a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test17a: near
+
+	.dbg	func, "test17a", "00", extern, "_test17a"
+	.dbg	sym, "a", "00", auto, -1
+	.dbg	sym, "b", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "div-char-char.c", 29
+	lda     #$40
+	jsr     pusha
+	lda     #$E0
+	jsr     pusha
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0003
+	dex
+L0003:	jsr     pushax
+	ldx     #$FF
+	lda     #$E0
+	jsr     tosdivax
+	cpx     #$FF
+	bne     L0004
+	cmp     #$FE
+L0004:	jsr     booleq
+	jeq     L0005
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0006
+	dex
+L0006:	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0007
+	dex
+L0007:	jsr     tosdivax
+	cpx     #$FF
+	bne     L0008
+	cmp     #$FE
+L0008:	jsr     booleq
+	jne     L0009
+L0005:	ldx     #$00
+	lda     #$00
+	jeq     L000A
+L0009:	ldx     #$00
+	lda     #$01
+L000A:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L000B
+	jmp     L000B
+L0002:	lda     #<(S001D)
+	ldx     #>(S001D)
+	jsr     pushax
+	ldx     #$00
+	lda     #$11
+	jsr     pushax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$E0
+	jsr     pusheax
+	ldy     #$09
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000C
+	dex
+L000C:	jsr     pushax
+	ldx     #$FF
+	lda     #$E0
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000D
+	dex
+L000D:	jsr     pushax
+	ldy     #$0E
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000E
+	dex
+L000E:	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$40
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$E0
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FE
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L000B
+L000B:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test17b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test17b: near
+
+	.dbg	func, "test17b", "00", extern, "_test17b"
+	.dbg	sym, "a", "00", auto, -1
+	.dbg	sym, "b", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "div-char-char.c", 29
+	lda     #$40
+	jsr     pusha
+	lda     #$E0
+	jsr     pusha
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0003
+	dex
+L0003:	jsr     pushax
+	ldx     #$FF
+	lda     #$E0
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$03
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0004
+	dex
+L0004:	jsr     pushax
+	ldy     #$04
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0005
+	dex
+L0005:	jsr     tosdivax
+	jsr     toseqax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S001E)
+	ldx     #>(S001E)
+	jsr     pushax
+	ldx     #$00
+	lda     #$11
+	jsr     pushax
+	ldy     #$05
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0007
+	dex
+L0007:	jsr     pushax
+	ldx     #$FF
+	lda     #$E0
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$09
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0008
+	dex
+L0008:	jsr     pushax
+	ldy     #$0A
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0009
+	dex
+L0009:	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000A
+	dex
+L000A:	jsr     axlong
+	jsr     pusheax
+	ldy     #$10
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000B
+	dex
+L000B:	jsr     axlong
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$40
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$E0
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FE
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test18a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test18a: near
+
+	.dbg	func, "test18a", "00", extern, "_test18a"
+	.dbg	sym, "a", "00", auto, -1
+	.dbg	sym, "b", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "div-char-char.c", 30
+	lda     #$C0
+	jsr     pusha
+	lda     #$E0
+	jsr     pusha
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0003
+	dex
+L0003:	jsr     pushax
+	ldx     #$FF
+	lda     #$E0
+	jsr     tosdivax
+	cpx     #$00
+	bne     L0004
+	cmp     #$02
+L0004:	jsr     booleq
+	jeq     L0005
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0006
+	dex
+L0006:	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0007
+	dex
+L0007:	jsr     tosdivax
+	cpx     #$00
+	bne     L0008
+	cmp     #$02
+L0008:	jsr     booleq
+	jne     L0009
+L0005:	ldx     #$00
+	lda     #$00
+	jeq     L000A
+L0009:	ldx     #$00
+	lda     #$01
+L000A:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L000B
+	jmp     L000B
+L0002:	lda     #<(S001F)
+	ldx     #>(S001F)
+	jsr     pushax
+	ldx     #$00
+	lda     #$12
+	jsr     pushax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$E0
+	jsr     pusheax
+	ldy     #$09
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000C
+	dex
+L000C:	jsr     pushax
+	ldx     #$FF
+	lda     #$E0
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000D
+	dex
+L000D:	jsr     pushax
+	ldy     #$0E
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000E
+	dex
+L000E:	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$C0
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$E0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L000B
+L000B:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test18b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test18b: near
+
+	.dbg	func, "test18b", "00", extern, "_test18b"
+	.dbg	sym, "a", "00", auto, -1
+	.dbg	sym, "b", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "div-char-char.c", 30
+	lda     #$C0
+	jsr     pusha
+	lda     #$E0
+	jsr     pusha
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0003
+	dex
+L0003:	jsr     pushax
+	ldx     #$FF
+	lda     #$E0
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$03
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0004
+	dex
+L0004:	jsr     pushax
+	ldy     #$04
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0005
+	dex
+L0005:	jsr     tosdivax
+	jsr     toseqax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S0020)
+	ldx     #>(S0020)
+	jsr     pushax
+	ldx     #$00
+	lda     #$12
+	jsr     pushax
+	ldy     #$05
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0007
+	dex
+L0007:	jsr     pushax
+	ldx     #$FF
+	lda     #$E0
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$09
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0008
+	dex
+L0008:	jsr     pushax
+	ldy     #$0A
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0009
+	dex
+L0009:	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000A
+	dex
+L000A:	jsr     axlong
+	jsr     pusheax
+	ldy     #$10
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000B
+	dex
+L000B:	jsr     axlong
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$C0
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$E0
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$02
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test101a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test101a: near
+
+	.dbg	func, "test101a", "00", extern, "_test101a"
+	.dbg	sym, "a", "00", auto, -1
+	.dbg	sym, "b", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "div-char-char.c", 33
+	lda     #$7F
+	jsr     pusha
+	lda     #$80
+	jsr     pusha
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0003
+	dex
+L0003:	jsr     pushax
+	ldx     #$FF
+	lda     #$80
+	jsr     tosdivax
+	cpx     #$00
+	bne     L0004
+	cmp     #$00
+L0004:	jsr     booleq
+	jeq     L0005
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0006
+	dex
+L0006:	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0007
+	dex
+L0007:	jsr     tosdivax
+	cpx     #$00
+	bne     L0008
+	cmp     #$00
+L0008:	jsr     booleq
+	jne     L0009
+L0005:	ldx     #$00
+	lda     #$00
+	jeq     L000A
+L0009:	ldx     #$00
+	lda     #$01
+L000A:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L000B
+	jmp     L000B
+L0002:	lda     #<(S0021)
+	ldx     #>(S0021)
+	jsr     pushax
+	ldx     #$00
+	lda     #$65
+	jsr     pushax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldy     #$09
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000C
+	dex
+L000C:	jsr     pushax
+	ldx     #$FF
+	lda     #$80
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000D
+	dex
+L000D:	jsr     pushax
+	ldy     #$0E
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000E
+	dex
+L000E:	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$7F
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L000B
+L000B:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test101b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test101b: near
+
+	.dbg	func, "test101b", "00", extern, "_test101b"
+	.dbg	sym, "a", "00", auto, -1
+	.dbg	sym, "b", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "div-char-char.c", 33
+	lda     #$7F
+	jsr     pusha
+	lda     #$80
+	jsr     pusha
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0003
+	dex
+L0003:	jsr     pushax
+	ldx     #$FF
+	lda     #$80
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$03
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0004
+	dex
+L0004:	jsr     pushax
+	ldy     #$04
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0005
+	dex
+L0005:	jsr     tosdivax
+	jsr     toseqax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S0022)
+	ldx     #>(S0022)
+	jsr     pushax
+	ldx     #$00
+	lda     #$65
+	jsr     pushax
+	ldy     #$05
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0007
+	dex
+L0007:	jsr     pushax
+	ldx     #$FF
+	lda     #$80
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$09
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0008
+	dex
+L0008:	jsr     pushax
+	ldy     #$0A
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0009
+	dex
+L0009:	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000A
+	dex
+L000A:	jsr     axlong
+	jsr     pusheax
+	ldy     #$10
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000B
+	dex
+L000B:	jsr     axlong
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$7F
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test102a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test102a: near
+
+	.dbg	func, "test102a", "00", extern, "_test102a"
+	.dbg	sym, "a", "00", auto, -1
+	.dbg	sym, "b", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "div-char-char.c", 34
+	lda     #$81
+	jsr     pusha
+	lda     #$80
+	jsr     pusha
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0003
+	dex
+L0003:	jsr     pushax
+	ldx     #$FF
+	lda     #$80
+	jsr     tosdivax
+	cpx     #$00
+	bne     L0004
+	cmp     #$00
+L0004:	jsr     booleq
+	jeq     L0005
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0006
+	dex
+L0006:	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0007
+	dex
+L0007:	jsr     tosdivax
+	cpx     #$00
+	bne     L0008
+	cmp     #$00
+L0008:	jsr     booleq
+	jne     L0009
+L0005:	ldx     #$00
+	lda     #$00
+	jeq     L000A
+L0009:	ldx     #$00
+	lda     #$01
+L000A:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L000B
+	jmp     L000B
+L0002:	lda     #<(S0023)
+	ldx     #>(S0023)
+	jsr     pushax
+	ldx     #$00
+	lda     #$66
+	jsr     pushax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldy     #$09
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000C
+	dex
+L000C:	jsr     pushax
+	ldx     #$FF
+	lda     #$80
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000D
+	dex
+L000D:	jsr     pushax
+	ldy     #$0E
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000E
+	dex
+L000E:	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$81
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L000B
+L000B:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test102b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test102b: near
+
+	.dbg	func, "test102b", "00", extern, "_test102b"
+	.dbg	sym, "a", "00", auto, -1
+	.dbg	sym, "b", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "div-char-char.c", 34
+	lda     #$81
+	jsr     pusha
+	lda     #$80
+	jsr     pusha
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0003
+	dex
+L0003:	jsr     pushax
+	ldx     #$FF
+	lda     #$80
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$03
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0004
+	dex
+L0004:	jsr     pushax
+	ldy     #$04
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0005
+	dex
+L0005:	jsr     tosdivax
+	jsr     toseqax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S0024)
+	ldx     #>(S0024)
+	jsr     pushax
+	ldx     #$00
+	lda     #$66
+	jsr     pushax
+	ldy     #$05
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0007
+	dex
+L0007:	jsr     pushax
+	ldx     #$FF
+	lda     #$80
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$09
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0008
+	dex
+L0008:	jsr     pushax
+	ldy     #$0A
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0009
+	dex
+L0009:	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000A
+	dex
+L000A:	jsr     axlong
+	jsr     pusheax
+	ldy     #$10
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000B
+	dex
+L000B:	jsr     axlong
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$81
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test103a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test103a: near
+
+	.dbg	func, "test103a", "00", extern, "_test103a"
+	.dbg	sym, "a", "00", auto, -1
+	.dbg	sym, "b", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "div-char-char.c", 35
+	lda     #$80
+	jsr     pusha
+	lda     #$80
+	jsr     pusha
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0003
+	dex
+L0003:	jsr     pushax
+	ldx     #$FF
+	lda     #$80
+	jsr     tosdivax
+	cpx     #$00
+	bne     L0004
+	cmp     #$01
+L0004:	jsr     booleq
+	jeq     L0005
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0006
+	dex
+L0006:	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0007
+	dex
+L0007:	jsr     tosdivax
+	cpx     #$00
+	bne     L0008
+	cmp     #$01
+L0008:	jsr     booleq
+	jne     L0009
+L0005:	ldx     #$00
+	lda     #$00
+	jeq     L000A
+L0009:	ldx     #$00
+	lda     #$01
+L000A:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L000B
+	jmp     L000B
+L0002:	lda     #<(S0025)
+	ldx     #>(S0025)
+	jsr     pushax
+	ldx     #$00
+	lda     #$67
+	jsr     pushax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldy     #$09
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000C
+	dex
+L000C:	jsr     pushax
+	ldx     #$FF
+	lda     #$80
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000D
+	dex
+L000D:	jsr     pushax
+	ldy     #$0E
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000E
+	dex
+L000E:	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L000B
+L000B:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test103b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test103b: near
+
+	.dbg	func, "test103b", "00", extern, "_test103b"
+	.dbg	sym, "a", "00", auto, -1
+	.dbg	sym, "b", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "div-char-char.c", 35
+	lda     #$80
+	jsr     pusha
+	lda     #$80
+	jsr     pusha
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0003
+	dex
+L0003:	jsr     pushax
+	ldx     #$FF
+	lda     #$80
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$03
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0004
+	dex
+L0004:	jsr     pushax
+	ldy     #$04
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0005
+	dex
+L0005:	jsr     tosdivax
+	jsr     toseqax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S0026)
+	ldx     #>(S0026)
+	jsr     pushax
+	ldx     #$00
+	lda     #$67
+	jsr     pushax
+	ldy     #$05
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0007
+	dex
+L0007:	jsr     pushax
+	ldx     #$FF
+	lda     #$80
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$09
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0008
+	dex
+L0008:	jsr     pushax
+	ldy     #$0A
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0009
+	dex
+L0009:	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000A
+	dex
+L000A:	jsr     axlong
+	jsr     pusheax
+	ldy     #$10
+	ldx     #$00
+	lda     (sp),y
+	bpl     L000B
+	dex
+L000B:	jsr     axlong
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "div-char-char.c", 40
+	jsr     _test1a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-char-char.c", 41
+	jsr     _test2a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-char-char.c", 42
+	jsr     _test3a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-char-char.c", 43
+	jsr     _test4a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-char-char.c", 44
+	jsr     _test5a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-char-char.c", 45
+	jsr     _test6a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-char-char.c", 46
+	jsr     _test7a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-char-char.c", 47
+	jsr     _test8a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-char-char.c", 49
+	jsr     _test11a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-char-char.c", 50
+	jsr     _test12a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-char-char.c", 51
+	jsr     _test13a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-char-char.c", 52
+	jsr     _test14a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-char-char.c", 53
+	jsr     _test15a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-char-char.c", 54
+	jsr     _test16a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-char-char.c", 55
+	jsr     _test17a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-char-char.c", 56
+	jsr     _test18a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-char-char.c", 58
+	jsr     _test101a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-char-char.c", 59
+	jsr     _test102a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-char-char.c", 60
+	jsr     _test103a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-char-char.c", 63
+	jsr     _test1b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-char-char.c", 64
+	jsr     _test2b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-char-char.c", 65
+	jsr     _test3b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-char-char.c", 66
+	jsr     _test4b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-char-char.c", 67
+	jsr     _test5b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-char-char.c", 68
+	jsr     _test6b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-char-char.c", 69
+	jsr     _test7b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-char-char.c", 70
+	jsr     _test8b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-char-char.c", 72
+	jsr     _test11b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-char-char.c", 73
+	jsr     _test12b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-char-char.c", 74
+	jsr     _test13b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-char-char.c", 75
+	jsr     _test14b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-char-char.c", 76
+	jsr     _test15b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-char-char.c", 77
+	jsr     _test16b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-char-char.c", 78
+	jsr     _test17b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-char-char.c", 79
+	jsr     _test18b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-char-char.c", 81
+	jsr     _test101b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-char-char.c", 82
+	jsr     _test102b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-char-char.c", 83
+	jsr     _test103b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-char-char.c", 85
+	lda     _res
+	ldx     _res+1
+	jmp     L0001
+	.dbg	line, "div-char-char.c", 86
+L0001:	rts
+
+	.dbg	line
+.endproc
+
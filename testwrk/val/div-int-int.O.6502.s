@@ -0,0 +1,4495 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_res
+	.export		_test1a
+	.export		_test1b
+	.export		_test2a
+	.export		_test2b
+	.export		_test3a
+	.export		_test3b
+	.export		_test4a
+	.export		_test4b
+	.export		_test5a
+	.export		_test5b
+	.export		_test6a
+	.export		_test6b
+	.export		_test7a
+	.export		_test7b
+	.export		_test8a
+	.export		_test8b
+	.export		_test11a
+	.export		_test11b
+	.export		_test12a
+	.export		_test12b
+	.export		_test13a
+	.export		_test13b
+	.export		_test14a
+	.export		_test14b
+	.export		_test15a
+	.export		_test15b
+	.export		_test16a
+	.export		_test16b
+	.export		_test17a
+	.export		_test17b
+	.export		_test18a
+	.export		_test18b
+	.export		_test101a
+	.export		_test101b
+	.export		_test102a
+	.export		_test102b
+	.export		_test103a
+	.export		_test103b
+	.export		_test104a
+	.export		_test104b
+	.export		_test105a
+	.export		_test105b
+	.export		_test106a
+	.export		_test106b
+	.export		_test107a
+	.export		_test107b
+	.export		_test108a
+	.export		_test108b
+	.export		_test201a
+	.export		_test201b
+	.export		_test202a
+	.export		_test202b
+	.export		_test203a
+	.export		_test203b
+	.export		_main
+
+.segment	"DATA"
+
+_res:
+	.word	$0000
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$25,$64,$09,$6E,$6F,$74,$20,$65,$71,$75,$61,$6C,$3A,$20,$25,$6C
+	.byte	$64,$20,$21,$3D,$20,$25,$6C,$64,$2C,$20,$61,$20,$3D,$20,$25,$6C
+	.byte	$64,$2C,$20,$62,$20,$3D,$20,$25,$6C,$64,$0A,$09,$65,$78,$70,$65
+	.byte	$63,$74,$65,$64,$3A,$20,$20,$25,$6C,$64,$2F,$25,$6C,$64,$20,$3D
+	.byte	$20,$25,$6C,$64,$0A,$00
+S0034	:=	S0002+0
+S0004	:=	S0002+0
+S0032	:=	S0002+0
+S0006	:=	S0002+0
+S0030	:=	S0002+0
+S0008	:=	S0002+0
+S002E	:=	S0002+0
+S000A	:=	S0002+0
+S002C	:=	S0002+0
+S000C	:=	S0002+0
+S002A	:=	S0002+0
+S000E	:=	S0002+0
+S0028	:=	S0002+0
+S0010	:=	S0002+0
+S0026	:=	S0002+0
+S0012	:=	S0002+0
+S0024	:=	S0002+0
+S0014	:=	S0002+0
+S0022	:=	S0002+0
+S0016	:=	S0002+0
+S0020	:=	S0002+0
+S0018	:=	S0002+0
+S001E	:=	S0002+0
+S001A	:=	S0002+0
+S001C	:=	S0002+0
+S0036	:=	S0002+0
+S001D:
+	.byte	$25,$64,$09,$69,$6E,$63,$6F,$72,$72,$65,$63,$74,$3A,$20,$61,$2F
+	.byte	$25,$6C,$64,$20,$3D,$20,$25,$6C,$64,$2C,$20,$61,$2F,$62,$20,$3D
+	.byte	$20,$25,$6C,$64,$0A,$09,$65,$78,$70,$65,$63,$74,$65,$64,$3A,$20
+	.byte	$20,$25,$6C,$64,$2F,$25,$6C,$64,$20,$3D,$20,$25,$6C,$64,$0A,$00
+S0019	:=	S001D+0
+S001F	:=	S001D+0
+S0017	:=	S001D+0
+S0021	:=	S001D+0
+S0015	:=	S001D+0
+S0023	:=	S001D+0
+S0013	:=	S001D+0
+S0025	:=	S001D+0
+S0011	:=	S001D+0
+S0027	:=	S001D+0
+S000F	:=	S001D+0
+S0029	:=	S001D+0
+S000D	:=	S001D+0
+S002B	:=	S001D+0
+S000B	:=	S001D+0
+S002D	:=	S001D+0
+S0009	:=	S001D+0
+S002F	:=	S001D+0
+S0007	:=	S001D+0
+S0031	:=	S001D+0
+S0005	:=	S001D+0
+S0033	:=	S001D+0
+S0003	:=	S001D+0
+S0035	:=	S001D+0
+S001B	:=	S001D+0
+S0001	:=	S001D+0
+
+; ---------------------------------------------------------------
+; int __near__ test1a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test1a: near
+
+.segment	"CODE"
+
+	lda     #$01
+	jsr     pusha0
+	lda     #$08
+	jsr     pusha0
+	ldy     #$05
+	jsr     pushwysp
+	lda     #$08
+	jsr     tosdiva0
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+	bne     L0002
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosdivax
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+	beq     L0008
+L0002:	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	lda     #$08
+	jsr     push0ax
+	ldy     #$0D
+	jsr     pushwysp
+	lda     #$08
+	jsr     tosdiva0
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$00
+	lda     #$01
+	jsr     push0ax
+	lda     #$08
+	jsr     push0ax
+	jsr     pushl0
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0008:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test1b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test1b: near
+
+.segment	"CODE"
+
+	lda     #$01
+	jsr     pusha0
+	lda     #$08
+	jsr     pusha0
+	ldy     #$05
+	jsr     pushwysp
+	lda     #$08
+	jsr     tosdiva0
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     tosicmp
+	bne     L0002
+	ldx     #$00
+	txa
+	jmp     L0003
+L0002:	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	ldy     #$09
+	jsr     pushwysp
+	lda     #$08
+	jsr     tosdiva0
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$00
+	lda     #$01
+	jsr     push0ax
+	lda     #$08
+	jsr     push0ax
+	jsr     pushl0
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test2a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test2a: near
+
+.segment	"CODE"
+
+	ldx     #$FF
+	txa
+	jsr     pushax
+	lda     #$08
+	jsr     pusha0
+	ldy     #$05
+	jsr     pushwysp
+	lda     #$08
+	jsr     tosdiva0
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+	bne     L0002
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosdivax
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+	beq     L0008
+L0002:	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     #$02
+	jsr     pusha0
+	lda     #$08
+	jsr     push0ax
+	ldy     #$0D
+	jsr     pushwysp
+	lda     #$08
+	jsr     tosdiva0
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	txa
+	jsr     pusheax
+	inx
+	lda     #$08
+	jsr     push0ax
+	jsr     pushl0
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0008:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test2b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test2b: near
+
+.segment	"CODE"
+
+	ldx     #$FF
+	txa
+	jsr     pushax
+	lda     #$08
+	jsr     pusha0
+	ldy     #$05
+	jsr     pushwysp
+	lda     #$08
+	jsr     tosdiva0
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     tosicmp
+	bne     L0002
+	ldx     #$00
+	txa
+	jmp     L0003
+L0002:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     #$02
+	jsr     pusha0
+	ldy     #$09
+	jsr     pushwysp
+	lda     #$08
+	jsr     tosdiva0
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	txa
+	jsr     pusheax
+	inx
+	lda     #$08
+	jsr     push0ax
+	jsr     pushl0
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test3a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test3a: near
+
+.segment	"CODE"
+
+	lda     #$01
+	jsr     pusha0
+	ldx     #$FF
+	lda     #$F8
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldx     #$FF
+	lda     #$F8
+	jsr     tosdivax
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+	bne     L0002
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosdivax
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+	beq     L0008
+L0002:	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     #$03
+	jsr     pusha0
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	ldy     #$0D
+	jsr     pushwysp
+	ldx     #$FF
+	lda     #$F8
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$00
+	lda     #$01
+	jsr     push0ax
+	dex
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	jsr     pushl0
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0008:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test3b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test3b: near
+
+.segment	"CODE"
+
+	lda     #$01
+	jsr     pusha0
+	ldx     #$FF
+	lda     #$F8
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldx     #$FF
+	lda     #$F8
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     tosicmp
+	bne     L0002
+	ldx     #$00
+	txa
+	jmp     L0003
+L0002:	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	lda     #$03
+	jsr     pusha0
+	ldy     #$09
+	jsr     pushwysp
+	ldx     #$FF
+	lda     #$F8
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$00
+	lda     #$01
+	jsr     push0ax
+	dex
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	jsr     pushl0
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test4a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test4a: near
+
+.segment	"CODE"
+
+	ldx     #$FF
+	txa
+	jsr     pushax
+	lda     #$F8
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldx     #$FF
+	lda     #$F8
+	jsr     tosdivax
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+	bne     L0002
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosdivax
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+	beq     L0008
+L0002:	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	ldy     #$0D
+	jsr     pushwysp
+	ldx     #$FF
+	lda     #$F8
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	txa
+	jsr     pusheax
+	lda     #$F8
+	jsr     pusheax
+	jsr     pushl0
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0008:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test4b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test4b: near
+
+.segment	"CODE"
+
+	ldx     #$FF
+	txa
+	jsr     pushax
+	lda     #$F8
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldx     #$FF
+	lda     #$F8
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     tosicmp
+	bne     L0002
+	ldx     #$00
+	txa
+	jmp     L0003
+L0002:	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	ldy     #$09
+	jsr     pushwysp
+	ldx     #$FF
+	lda     #$F8
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	txa
+	jsr     pusheax
+	lda     #$F8
+	jsr     pusheax
+	jsr     pushl0
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test5a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test5a: near
+
+.segment	"CODE"
+
+	lda     #$08
+	jsr     pusha0
+	lda     #$01
+	jsr     pusha0
+	ldy     #$03
+	lda     (sp),y
+	bne     L0002
+	dey
+	lda     (sp),y
+	cmp     #$08
+	bne     L0002
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosdivax
+	cpx     #$00
+	bne     L0002
+	cmp     #$08
+	bne     L0002
+	txa
+	jmp     L0008
+L0002:	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #$01
+	jsr     push0ax
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$00
+	lda     #$08
+	jsr     push0ax
+	lda     #$01
+	jsr     push0ax
+	lda     #$08
+	jsr     push0ax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0008:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test5b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test5b: near
+
+.segment	"CODE"
+
+	lda     #$08
+	jsr     pusha0
+	lda     #$01
+	jsr     pusha0
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     tosicmp
+	bne     L0002
+	ldx     #$00
+	txa
+	jmp     L0003
+L0002:	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$00
+	lda     #$08
+	jsr     push0ax
+	lda     #$01
+	jsr     push0ax
+	lda     #$08
+	jsr     push0ax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test6a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test6a: near
+
+.segment	"CODE"
+
+	ldx     #$FF
+	lda     #$F8
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	ldy     #$03
+	lda     (sp),y
+	cmp     #$FF
+	bne     L0002
+	dey
+	lda     (sp),y
+	cmp     #$F8
+	bne     L0002
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosdivax
+	cpx     #$FF
+	bne     L0002
+	cmp     #$F8
+	bne     L0002
+	inx
+	txa
+	jmp     L0008
+L0002:	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	lda     #$06
+	jsr     pusha0
+	lda     #$01
+	jsr     push0ax
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	inx
+	lda     #$01
+	jsr     push0ax
+	dex
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0008:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test6b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test6b: near
+
+.segment	"CODE"
+
+	ldx     #$FF
+	lda     #$F8
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     tosicmp
+	bne     L0002
+	ldx     #$00
+	txa
+	jmp     L0003
+L0002:	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	lda     #$06
+	jsr     pusha0
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	inx
+	lda     #$01
+	jsr     push0ax
+	dex
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test7a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test7a: near
+
+.segment	"CODE"
+
+	lda     #$08
+	jsr     pusha0
+	ldx     #$FF
+	txa
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     negax
+	cpx     #$FF
+	bne     L0002
+	cmp     #$F8
+	bne     L0002
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosdivax
+	cpx     #$FF
+	bne     L0002
+	cmp     #$F8
+	bne     L0002
+	inx
+	txa
+	jmp     L0008
+L0002:	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	lda     #$07
+	jsr     pusha0
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	txa
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     negax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$00
+	lda     #$08
+	jsr     push0ax
+	dex
+	stx     sreg
+	stx     sreg+1
+	txa
+	jsr     pusheax
+	lda     #$F8
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0008:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test7b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test7b: near
+
+.segment	"CODE"
+
+	lda     #$08
+	jsr     pusha0
+	ldx     #$FF
+	txa
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     negax
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     tosicmp
+	bne     L0002
+	ldx     #$00
+	txa
+	jmp     L0003
+L0002:	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	lda     #$07
+	jsr     pusha0
+	tay
+	jsr     ldaxysp
+	jsr     negax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$00
+	lda     #$08
+	jsr     push0ax
+	dex
+	stx     sreg
+	stx     sreg+1
+	txa
+	jsr     pusheax
+	lda     #$F8
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test8a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test8a: near
+
+.segment	"CODE"
+
+	ldx     #$FF
+	lda     #$F8
+	jsr     pushax
+	txa
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     negax
+	cpx     #$00
+	bne     L0002
+	cmp     #$08
+	bne     L0002
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosdivax
+	cpx     #$00
+	bne     L0002
+	cmp     #$08
+	bne     L0002
+	txa
+	jmp     L0008
+L0002:	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	lda     #$08
+	jsr     pusha0
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	txa
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     negax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	txa
+	jsr     pusheax
+	inx
+	lda     #$08
+	jsr     push0ax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0008:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test8b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test8b: near
+
+.segment	"CODE"
+
+	ldx     #$FF
+	lda     #$F8
+	jsr     pushax
+	txa
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     negax
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     tosicmp
+	bne     L0002
+	ldx     #$00
+	txa
+	jmp     L0003
+L0002:	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	lda     #$08
+	jsr     pusha0
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     negax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	txa
+	jsr     pusheax
+	inx
+	lda     #$08
+	jsr     push0ax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test11a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test11a: near
+
+.segment	"CODE"
+
+	ldx     #$08
+	lda     #$00
+	jsr     pushax
+	ldx     #$02
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldx     #$02
+	lda     #$00
+	jsr     tosdivax
+	cpx     #$00
+	bne     L0002
+	cmp     #$04
+	bne     L0002
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosdivax
+	cpx     #$00
+	bne     L0002
+	cmp     #$04
+	bne     L0002
+	txa
+	jmp     L0008
+L0002:	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	lda     #$0B
+	jsr     pusha0
+	ldx     #$02
+	lda     #$00
+	jsr     push0ax
+	ldy     #$0D
+	jsr     pushwysp
+	ldx     #$02
+	lda     #$00
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$08
+	lda     #$00
+	jsr     push0ax
+	ldx     #$02
+	jsr     push0ax
+	tax
+	lda     #$04
+	jsr     push0ax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0008:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test11b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test11b: near
+
+.segment	"CODE"
+
+	ldx     #$08
+	lda     #$00
+	jsr     pushax
+	ldx     #$02
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldx     #$02
+	lda     #$00
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     tosicmp
+	bne     L0002
+	ldx     #$00
+	txa
+	jmp     L0003
+L0002:	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	lda     #$0B
+	jsr     pusha0
+	ldy     #$09
+	jsr     pushwysp
+	ldx     #$02
+	lda     #$00
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$08
+	lda     #$00
+	jsr     push0ax
+	ldx     #$02
+	jsr     push0ax
+	tax
+	lda     #$04
+	jsr     push0ax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test12a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test12a: near
+
+.segment	"CODE"
+
+	ldx     #$F8
+	lda     #$00
+	jsr     pushax
+	ldx     #$02
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldx     #$02
+	lda     #$00
+	jsr     tosdivax
+	cpx     #$FF
+	bne     L0002
+	cmp     #$FC
+	bne     L0002
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosdivax
+	cpx     #$FF
+	bne     L0002
+	cmp     #$FC
+	bne     L0002
+	inx
+	txa
+	jmp     L0008
+L0002:	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	lda     #$0C
+	jsr     pusha0
+	ldx     #$02
+	lda     #$00
+	jsr     push0ax
+	ldy     #$0D
+	jsr     pushwysp
+	ldx     #$02
+	lda     #$00
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$F8
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$02
+	jsr     push0ax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FC
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0008:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test12b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test12b: near
+
+.segment	"CODE"
+
+	ldx     #$F8
+	lda     #$00
+	jsr     pushax
+	ldx     #$02
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldx     #$02
+	lda     #$00
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     tosicmp
+	bne     L0002
+	ldx     #$00
+	txa
+	jmp     L0003
+L0002:	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	lda     #$0C
+	jsr     pusha0
+	ldy     #$09
+	jsr     pushwysp
+	ldx     #$02
+	lda     #$00
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$F8
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$02
+	jsr     push0ax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FC
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test13a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test13a: near
+
+.segment	"CODE"
+
+	ldx     #$08
+	lda     #$00
+	jsr     pushax
+	ldx     #$FE
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldx     #$FE
+	lda     #$00
+	jsr     tosdivax
+	cpx     #$FF
+	bne     L0002
+	cmp     #$FC
+	bne     L0002
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosdivax
+	cpx     #$FF
+	bne     L0002
+	cmp     #$FC
+	bne     L0002
+	inx
+	txa
+	jmp     L0008
+L0002:	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+	lda     #$0D
+	jsr     pusha0
+	ldx     #$FE
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$0D
+	jsr     pushwysp
+	ldx     #$FE
+	lda     #$00
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$08
+	lda     #$00
+	jsr     push0ax
+	ldx     #$FE
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	inx
+	lda     #$FC
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0008:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test13b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test13b: near
+
+.segment	"CODE"
+
+	ldx     #$08
+	lda     #$00
+	jsr     pushax
+	ldx     #$FE
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldx     #$FE
+	lda     #$00
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     tosicmp
+	bne     L0002
+	ldx     #$00
+	txa
+	jmp     L0003
+L0002:	lda     #<(S0016)
+	ldx     #>(S0016)
+	jsr     pushax
+	lda     #$0D
+	jsr     pusha0
+	ldy     #$09
+	jsr     pushwysp
+	ldx     #$FE
+	lda     #$00
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$08
+	lda     #$00
+	jsr     push0ax
+	ldx     #$FE
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	inx
+	lda     #$FC
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test14a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test14a: near
+
+.segment	"CODE"
+
+	ldx     #$F8
+	lda     #$00
+	jsr     pushax
+	ldx     #$FE
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldx     #$FE
+	lda     #$00
+	jsr     tosdivax
+	cpx     #$00
+	bne     L0002
+	cmp     #$04
+	bne     L0002
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosdivax
+	cpx     #$00
+	bne     L0002
+	cmp     #$04
+	bne     L0002
+	txa
+	jmp     L0008
+L0002:	lda     #<(S0017)
+	ldx     #>(S0017)
+	jsr     pushax
+	lda     #$0E
+	jsr     pusha0
+	ldx     #$FE
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$0D
+	jsr     pushwysp
+	ldx     #$FE
+	lda     #$00
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$F8
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$FE
+	jsr     pusheax
+	tax
+	lda     #$04
+	jsr     push0ax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0008:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test14b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test14b: near
+
+.segment	"CODE"
+
+	ldx     #$F8
+	lda     #$00
+	jsr     pushax
+	ldx     #$FE
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldx     #$FE
+	lda     #$00
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     tosicmp
+	bne     L0002
+	ldx     #$00
+	txa
+	jmp     L0003
+L0002:	lda     #<(S0018)
+	ldx     #>(S0018)
+	jsr     pushax
+	lda     #$0E
+	jsr     pusha0
+	ldy     #$09
+	jsr     pushwysp
+	ldx     #$FE
+	lda     #$00
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$F8
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$FE
+	jsr     pusheax
+	tax
+	lda     #$04
+	jsr     push0ax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test15a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test15a: near
+
+.segment	"CODE"
+
+	ldx     #$02
+	lda     #$00
+	jsr     pushax
+	ldx     #$08
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldx     #$08
+	lda     #$00
+	jsr     tosdivax
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+	bne     L0002
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosdivax
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+	beq     L0008
+L0002:	lda     #<(S0019)
+	ldx     #>(S0019)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$08
+	lda     #$00
+	jsr     push0ax
+	ldy     #$0D
+	jsr     pushwysp
+	ldx     #$08
+	lda     #$00
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$02
+	lda     #$00
+	jsr     push0ax
+	ldx     #$08
+	jsr     push0ax
+	jsr     pushl0
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0008:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test15b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test15b: near
+
+.segment	"CODE"
+
+	ldx     #$02
+	lda     #$00
+	jsr     pushax
+	ldx     #$08
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldx     #$08
+	lda     #$00
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     tosicmp
+	bne     L0002
+	ldx     #$00
+	txa
+	jmp     L0003
+L0002:	lda     #<(S001A)
+	ldx     #>(S001A)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	ldy     #$09
+	jsr     pushwysp
+	ldx     #$08
+	lda     #$00
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$02
+	lda     #$00
+	jsr     push0ax
+	ldx     #$08
+	jsr     push0ax
+	jsr     pushl0
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test16a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test16a: near
+
+.segment	"CODE"
+
+	ldx     #$FE
+	lda     #$00
+	jsr     pushax
+	ldx     #$08
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldx     #$08
+	lda     #$00
+	jsr     tosdivax
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+	bne     L0002
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosdivax
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+	beq     L0008
+L0002:	lda     #<(S001B)
+	ldx     #>(S001B)
+	jsr     pushax
+	lda     #$10
+	jsr     pusha0
+	ldx     #$08
+	lda     #$00
+	jsr     push0ax
+	ldy     #$0D
+	jsr     pushwysp
+	ldx     #$08
+	lda     #$00
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$FE
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$08
+	jsr     push0ax
+	jsr     pushl0
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0008:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test16b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test16b: near
+
+.segment	"CODE"
+
+	ldx     #$FE
+	lda     #$00
+	jsr     pushax
+	ldx     #$08
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldx     #$08
+	lda     #$00
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     tosicmp
+	bne     L0002
+	ldx     #$00
+	txa
+	jmp     L0003
+L0002:	lda     #<(S001C)
+	ldx     #>(S001C)
+	jsr     pushax
+	lda     #$10
+	jsr     pusha0
+	ldy     #$09
+	jsr     pushwysp
+	ldx     #$08
+	lda     #$00
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$FE
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$08
+	jsr     push0ax
+	jsr     pushl0
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test17a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test17a: near
+
+.segment	"CODE"
+
+	ldx     #$02
+	lda     #$00
+	jsr     pushax
+	ldx     #$F8
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldx     #$F8
+	lda     #$00
+	jsr     tosdivax
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+	bne     L0002
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosdivax
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+	beq     L0008
+L0002:	lda     #<(S001D)
+	ldx     #>(S001D)
+	jsr     pushax
+	lda     #$11
+	jsr     pusha0
+	ldx     #$F8
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$0D
+	jsr     pushwysp
+	ldx     #$F8
+	lda     #$00
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$02
+	lda     #$00
+	jsr     push0ax
+	ldx     #$F8
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	jsr     pushl0
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0008:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test17b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test17b: near
+
+.segment	"CODE"
+
+	ldx     #$02
+	lda     #$00
+	jsr     pushax
+	ldx     #$F8
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldx     #$F8
+	lda     #$00
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     tosicmp
+	bne     L0002
+	ldx     #$00
+	txa
+	jmp     L0003
+L0002:	lda     #<(S001E)
+	ldx     #>(S001E)
+	jsr     pushax
+	lda     #$11
+	jsr     pusha0
+	ldy     #$09
+	jsr     pushwysp
+	ldx     #$F8
+	lda     #$00
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$02
+	lda     #$00
+	jsr     push0ax
+	ldx     #$F8
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	jsr     pushl0
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test18a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test18a: near
+
+.segment	"CODE"
+
+	ldx     #$FE
+	lda     #$00
+	jsr     pushax
+	ldx     #$F8
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldx     #$F8
+	lda     #$00
+	jsr     tosdivax
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+	bne     L0002
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosdivax
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+	beq     L0008
+L0002:	lda     #<(S001F)
+	ldx     #>(S001F)
+	jsr     pushax
+	lda     #$12
+	jsr     pusha0
+	ldx     #$F8
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$0D
+	jsr     pushwysp
+	ldx     #$F8
+	lda     #$00
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$FE
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$F8
+	jsr     pusheax
+	jsr     pushl0
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0008:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test18b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test18b: near
+
+.segment	"CODE"
+
+	ldx     #$FE
+	lda     #$00
+	jsr     pushax
+	ldx     #$F8
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldx     #$F8
+	lda     #$00
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     tosicmp
+	bne     L0002
+	ldx     #$00
+	txa
+	jmp     L0003
+L0002:	lda     #<(S0020)
+	ldx     #>(S0020)
+	jsr     pushax
+	lda     #$12
+	jsr     pusha0
+	ldy     #$09
+	jsr     pushwysp
+	ldx     #$F8
+	lda     #$00
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$FE
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$F8
+	jsr     pusheax
+	jsr     pushl0
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test101a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test101a: near
+
+.segment	"CODE"
+
+	lda     #$7F
+	jsr     pusha0
+	lda     #$80
+	jsr     pusha0
+	ldy     #$05
+	jsr     pushwysp
+	lda     #$80
+	jsr     tosdiva0
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+	bne     L0002
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosdivax
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+	beq     L0008
+L0002:	lda     #<(S0021)
+	ldx     #>(S0021)
+	jsr     pushax
+	lda     #$65
+	jsr     pusha0
+	lda     #$80
+	jsr     push0ax
+	ldy     #$0D
+	jsr     pushwysp
+	lda     #$80
+	jsr     tosdiva0
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$00
+	lda     #$7F
+	jsr     push0ax
+	lda     #$80
+	jsr     push0ax
+	jsr     pushl0
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0008:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test101b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test101b: near
+
+.segment	"CODE"
+
+	lda     #$7F
+	jsr     pusha0
+	lda     #$80
+	jsr     pusha0
+	ldy     #$05
+	jsr     pushwysp
+	lda     #$80
+	jsr     tosdiva0
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     tosicmp
+	bne     L0002
+	ldx     #$00
+	txa
+	jmp     L0003
+L0002:	lda     #<(S0022)
+	ldx     #>(S0022)
+	jsr     pushax
+	lda     #$65
+	jsr     pusha0
+	ldy     #$09
+	jsr     pushwysp
+	lda     #$80
+	jsr     tosdiva0
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$00
+	lda     #$7F
+	jsr     push0ax
+	lda     #$80
+	jsr     push0ax
+	jsr     pushl0
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test102a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test102a: near
+
+.segment	"CODE"
+
+	ldx     #$FF
+	lda     #$81
+	jsr     pushax
+	lda     #$80
+	jsr     pusha0
+	ldy     #$05
+	jsr     pushwysp
+	lda     #$80
+	jsr     tosdiva0
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+	bne     L0002
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosdivax
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+	beq     L0008
+L0002:	lda     #<(S0023)
+	ldx     #>(S0023)
+	jsr     pushax
+	lda     #$66
+	jsr     pusha0
+	lda     #$80
+	jsr     push0ax
+	ldy     #$0D
+	jsr     pushwysp
+	lda     #$80
+	jsr     tosdiva0
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$81
+	jsr     pusheax
+	inx
+	lda     #$80
+	jsr     push0ax
+	jsr     pushl0
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0008:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test102b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test102b: near
+
+.segment	"CODE"
+
+	ldx     #$FF
+	lda     #$81
+	jsr     pushax
+	lda     #$80
+	jsr     pusha0
+	ldy     #$05
+	jsr     pushwysp
+	lda     #$80
+	jsr     tosdiva0
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     tosicmp
+	bne     L0002
+	ldx     #$00
+	txa
+	jmp     L0003
+L0002:	lda     #<(S0024)
+	ldx     #>(S0024)
+	jsr     pushax
+	lda     #$66
+	jsr     pusha0
+	ldy     #$09
+	jsr     pushwysp
+	lda     #$80
+	jsr     tosdiva0
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$81
+	jsr     pusheax
+	inx
+	lda     #$80
+	jsr     push0ax
+	jsr     pushl0
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test103a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test103a: near
+
+.segment	"CODE"
+
+	lda     #$7F
+	jsr     pusha0
+	ldx     #$FF
+	lda     #$80
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldx     #$FF
+	lda     #$80
+	jsr     tosdivax
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+	bne     L0002
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosdivax
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+	beq     L0008
+L0002:	lda     #<(S0025)
+	ldx     #>(S0025)
+	jsr     pushax
+	lda     #$67
+	jsr     pusha0
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldy     #$0D
+	jsr     pushwysp
+	ldx     #$FF
+	lda     #$80
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$00
+	lda     #$7F
+	jsr     push0ax
+	dex
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	jsr     pushl0
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0008:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test103b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test103b: near
+
+.segment	"CODE"
+
+	lda     #$7F
+	jsr     pusha0
+	ldx     #$FF
+	lda     #$80
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldx     #$FF
+	lda     #$80
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     tosicmp
+	bne     L0002
+	ldx     #$00
+	txa
+	jmp     L0003
+L0002:	lda     #<(S0026)
+	ldx     #>(S0026)
+	jsr     pushax
+	lda     #$67
+	jsr     pusha0
+	ldy     #$09
+	jsr     pushwysp
+	ldx     #$FF
+	lda     #$80
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$00
+	lda     #$7F
+	jsr     push0ax
+	dex
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	jsr     pushl0
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test104a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test104a: near
+
+.segment	"CODE"
+
+	ldx     #$FF
+	lda     #$81
+	jsr     pushax
+	lda     #$80
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldx     #$FF
+	lda     #$80
+	jsr     tosdivax
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+	bne     L0002
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosdivax
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+	beq     L0008
+L0002:	lda     #<(S0027)
+	ldx     #>(S0027)
+	jsr     pushax
+	lda     #$68
+	jsr     pusha0
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldy     #$0D
+	jsr     pushwysp
+	ldx     #$FF
+	lda     #$80
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$81
+	jsr     pusheax
+	lda     #$80
+	jsr     pusheax
+	jsr     pushl0
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0008:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test104b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test104b: near
+
+.segment	"CODE"
+
+	ldx     #$FF
+	lda     #$81
+	jsr     pushax
+	lda     #$80
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldx     #$FF
+	lda     #$80
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     tosicmp
+	bne     L0002
+	ldx     #$00
+	txa
+	jmp     L0003
+L0002:	lda     #<(S0028)
+	ldx     #>(S0028)
+	jsr     pushax
+	lda     #$68
+	jsr     pusha0
+	ldy     #$09
+	jsr     pushwysp
+	ldx     #$FF
+	lda     #$80
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$81
+	jsr     pusheax
+	lda     #$80
+	jsr     pusheax
+	jsr     pushl0
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test105a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test105a: near
+
+.segment	"CODE"
+
+	lda     #$80
+	jsr     pusha0
+	jsr     pusha0
+	ldy     #$05
+	jsr     pushwysp
+	lda     #$80
+	jsr     tosdiva0
+	cpx     #$00
+	bne     L0002
+	cmp     #$01
+	bne     L0002
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosdivax
+	cpx     #$00
+	bne     L0002
+	cmp     #$01
+	bne     L0002
+	txa
+	jmp     L0008
+L0002:	lda     #<(S0029)
+	ldx     #>(S0029)
+	jsr     pushax
+	lda     #$69
+	jsr     pusha0
+	lda     #$80
+	jsr     push0ax
+	ldy     #$0D
+	jsr     pushwysp
+	lda     #$80
+	jsr     tosdiva0
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$00
+	lda     #$80
+	jsr     push0ax
+	jsr     push0ax
+	lda     #$01
+	jsr     push0ax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0008:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test105b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test105b: near
+
+.segment	"CODE"
+
+	lda     #$80
+	jsr     pusha0
+	jsr     pusha0
+	ldy     #$05
+	jsr     pushwysp
+	lda     #$80
+	jsr     tosdiva0
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     tosicmp
+	bne     L0002
+	ldx     #$00
+	txa
+	jmp     L0003
+L0002:	lda     #<(S002A)
+	ldx     #>(S002A)
+	jsr     pushax
+	lda     #$69
+	jsr     pusha0
+	ldy     #$09
+	jsr     pushwysp
+	lda     #$80
+	jsr     tosdiva0
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$00
+	lda     #$80
+	jsr     push0ax
+	jsr     push0ax
+	lda     #$01
+	jsr     push0ax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test106a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test106a: near
+
+.segment	"CODE"
+
+	lda     #$80
+	jsr     pusha0
+	ldx     #$FF
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldx     #$FF
+	lda     #$80
+	jsr     tosdivax
+	cpx     #$FF
+	bne     L0002
+	cmp     #$FF
+	bne     L0002
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosdivax
+	cpx     #$FF
+	bne     L0002
+	cmp     #$FF
+	bne     L0002
+	inx
+	txa
+	jmp     L0008
+L0002:	lda     #<(S002B)
+	ldx     #>(S002B)
+	jsr     pushax
+	lda     #$6A
+	jsr     pusha0
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldy     #$0D
+	jsr     pushwysp
+	ldx     #$FF
+	lda     #$80
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$00
+	lda     #$80
+	jsr     push0ax
+	dex
+	stx     sreg
+	stx     sreg+1
+	jsr     pusheax
+	txa
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0008:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test106b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test106b: near
+
+.segment	"CODE"
+
+	lda     #$80
+	jsr     pusha0
+	ldx     #$FF
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldx     #$FF
+	lda     #$80
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     tosicmp
+	bne     L0002
+	ldx     #$00
+	txa
+	jmp     L0003
+L0002:	lda     #<(S002C)
+	ldx     #>(S002C)
+	jsr     pushax
+	lda     #$6A
+	jsr     pusha0
+	ldy     #$09
+	jsr     pushwysp
+	ldx     #$FF
+	lda     #$80
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$00
+	lda     #$80
+	jsr     push0ax
+	dex
+	stx     sreg
+	stx     sreg+1
+	jsr     pusheax
+	txa
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test107a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test107a: near
+
+.segment	"CODE"
+
+	ldx     #$FF
+	lda     #$80
+	jsr     pushax
+	jsr     pusha0
+	ldy     #$05
+	jsr     pushwysp
+	lda     #$80
+	jsr     tosdiva0
+	cpx     #$FF
+	bne     L0002
+	cmp     #$FF
+	bne     L0002
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosdivax
+	cpx     #$FF
+	bne     L0002
+	cmp     #$FF
+	bne     L0002
+	inx
+	txa
+	jmp     L0008
+L0002:	lda     #<(S002D)
+	ldx     #>(S002D)
+	jsr     pushax
+	lda     #$6B
+	jsr     pusha0
+	lda     #$80
+	jsr     push0ax
+	ldy     #$0D
+	jsr     pushwysp
+	lda     #$80
+	jsr     tosdiva0
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	inx
+	jsr     push0ax
+	dex
+	stx     sreg
+	stx     sreg+1
+	txa
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0008:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test107b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test107b: near
+
+.segment	"CODE"
+
+	ldx     #$FF
+	lda     #$80
+	jsr     pushax
+	jsr     pusha0
+	ldy     #$05
+	jsr     pushwysp
+	lda     #$80
+	jsr     tosdiva0
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     tosicmp
+	bne     L0002
+	ldx     #$00
+	txa
+	jmp     L0003
+L0002:	lda     #<(S002E)
+	ldx     #>(S002E)
+	jsr     pushax
+	lda     #$6B
+	jsr     pusha0
+	ldy     #$09
+	jsr     pushwysp
+	lda     #$80
+	jsr     tosdiva0
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	inx
+	jsr     push0ax
+	dex
+	stx     sreg
+	stx     sreg+1
+	txa
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test108a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test108a: near
+
+.segment	"CODE"
+
+	ldx     #$FF
+	lda     #$80
+	jsr     pushax
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldx     #$FF
+	lda     #$80
+	jsr     tosdivax
+	cpx     #$00
+	bne     L0002
+	cmp     #$01
+	bne     L0002
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosdivax
+	cpx     #$00
+	bne     L0002
+	cmp     #$01
+	bne     L0002
+	txa
+	jmp     L0008
+L0002:	lda     #<(S002F)
+	ldx     #>(S002F)
+	jsr     pushax
+	lda     #$6C
+	jsr     pusha0
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldy     #$0D
+	jsr     pushwysp
+	ldx     #$FF
+	lda     #$80
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	jsr     pusheax
+	inx
+	lda     #$01
+	jsr     push0ax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0008:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test108b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test108b: near
+
+.segment	"CODE"
+
+	ldx     #$FF
+	lda     #$80
+	jsr     pushax
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldx     #$FF
+	lda     #$80
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     tosicmp
+	bne     L0002
+	ldx     #$00
+	txa
+	jmp     L0003
+L0002:	lda     #<(S0030)
+	ldx     #>(S0030)
+	jsr     pushax
+	lda     #$6C
+	jsr     pusha0
+	ldy     #$09
+	jsr     pushwysp
+	ldx     #$FF
+	lda     #$80
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	jsr     pusheax
+	inx
+	lda     #$01
+	jsr     push0ax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test201a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test201a: near
+
+.segment	"CODE"
+
+	ldx     #$7F
+	lda     #$FF
+	jsr     pushax
+	inx
+	lda     #$00
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldx     #$80
+	lda     #$00
+	jsr     tosdivax
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+	bne     L0002
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosdivax
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+	beq     L0008
+L0002:	lda     #<(S0031)
+	ldx     #>(S0031)
+	jsr     pushax
+	lda     #$C9
+	jsr     pusha0
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$0D
+	jsr     pushwysp
+	ldx     #$80
+	lda     #$00
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$7F
+	lda     #$FF
+	jsr     push0ax
+	inx
+	sta     sreg
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	jsr     pushl0
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0008:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test201b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test201b: near
+
+.segment	"CODE"
+
+	ldx     #$7F
+	lda     #$FF
+	jsr     pushax
+	inx
+	lda     #$00
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldx     #$80
+	lda     #$00
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     tosicmp
+	bne     L0002
+	ldx     #$00
+	txa
+	jmp     L0003
+L0002:	lda     #<(S0032)
+	ldx     #>(S0032)
+	jsr     pushax
+	lda     #$C9
+	jsr     pusha0
+	ldy     #$09
+	jsr     pushwysp
+	ldx     #$80
+	lda     #$00
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$7F
+	lda     #$FF
+	jsr     push0ax
+	inx
+	sta     sreg
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	jsr     pushl0
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test202a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test202a: near
+
+.segment	"CODE"
+
+	ldx     #$7F
+	lda     #$FF
+	jsr     pushax
+	inx
+	lda     #$00
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldx     #$80
+	lda     #$00
+	jsr     tosdivax
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+	bne     L0002
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosdivax
+	cpx     #$00
+	bne     L0002
+	cmp     #$00
+	beq     L0008
+L0002:	lda     #<(S0033)
+	ldx     #>(S0033)
+	jsr     pushax
+	lda     #$CA
+	jsr     pusha0
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$0D
+	jsr     pushwysp
+	ldx     #$80
+	lda     #$00
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$7F
+	lda     #$FF
+	jsr     push0ax
+	inx
+	sta     sreg
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	jsr     pushl0
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0008:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test202b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test202b: near
+
+.segment	"CODE"
+
+	ldx     #$7F
+	lda     #$FF
+	jsr     pushax
+	inx
+	lda     #$00
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldx     #$80
+	lda     #$00
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     tosicmp
+	bne     L0002
+	ldx     #$00
+	txa
+	jmp     L0003
+L0002:	lda     #<(S0034)
+	ldx     #>(S0034)
+	jsr     pushax
+	lda     #$CA
+	jsr     pusha0
+	ldy     #$09
+	jsr     pushwysp
+	ldx     #$80
+	lda     #$00
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$7F
+	lda     #$FF
+	jsr     push0ax
+	inx
+	sta     sreg
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	jsr     pushl0
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test203a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test203a: near
+
+.segment	"CODE"
+
+	ldx     #$80
+	lda     #$00
+	jsr     pushax
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldx     #$80
+	lda     #$00
+	jsr     tosdivax
+	cpx     #$00
+	bne     L0002
+	cmp     #$01
+	bne     L0002
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosdivax
+	cpx     #$00
+	bne     L0002
+	cmp     #$01
+	bne     L0002
+	txa
+	jmp     L0008
+L0002:	lda     #<(S0035)
+	ldx     #>(S0035)
+	jsr     pushax
+	lda     #$CB
+	jsr     pusha0
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$0D
+	jsr     pushwysp
+	ldx     #$80
+	lda     #$00
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	jsr     pusheax
+	tax
+	lda     #$01
+	jsr     push0ax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0008:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test203b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test203b: near
+
+.segment	"CODE"
+
+	ldx     #$80
+	lda     #$00
+	jsr     pushax
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldx     #$80
+	lda     #$00
+	jsr     tosdivax
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     tosicmp
+	bne     L0002
+	ldx     #$00
+	txa
+	jmp     L0003
+L0002:	lda     #<(S0036)
+	ldx     #>(S0036)
+	jsr     pushax
+	lda     #$CB
+	jsr     pusha0
+	ldy     #$09
+	jsr     pushwysp
+	ldx     #$80
+	lda     #$00
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     tosdivax
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     axlong
+	jsr     pusheax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	jsr     pusheax
+	tax
+	lda     #$01
+	jsr     push0ax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     _test1a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test2a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test3a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test4a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test5a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test6a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test7a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test8a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test11a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test12a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test13a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test14a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test15a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test16a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test17a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test18a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test101a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test102a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test103a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test104a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test105a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test106a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test107a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test108a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test201a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test202a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test203a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test1b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test2b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test3b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test4b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test5b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test6b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test7b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test8b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test11b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test12b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test13b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test14b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test15b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test16b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test17b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test18b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test101b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test102b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test103b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test104b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test105b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test106b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test107b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test108b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test201b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test202b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test203b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	lda     _res
+	ldx     _res+1
+	rts
+
+.endproc
+
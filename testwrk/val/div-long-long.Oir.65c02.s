@@ -0,0 +1,9132 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_res
+	.export		_test1a
+	.export		_test1b
+	.export		_test2a
+	.export		_test2b
+	.export		_test3a
+	.export		_test3b
+	.export		_test4a
+	.export		_test4b
+	.export		_test5a
+	.export		_test5b
+	.export		_test6a
+	.export		_test6b
+	.export		_test7a
+	.export		_test7b
+	.export		_test8a
+	.export		_test8b
+	.export		_test11a
+	.export		_test11b
+	.export		_test12a
+	.export		_test12b
+	.export		_test13a
+	.export		_test13b
+	.export		_test14a
+	.export		_test14b
+	.export		_test15a
+	.export		_test15b
+	.export		_test16a
+	.export		_test16b
+	.export		_test17a
+	.export		_test17b
+	.export		_test18a
+	.export		_test18b
+	.export		_test101a
+	.export		_test101b
+	.export		_test102a
+	.export		_test102b
+	.export		_test103a
+	.export		_test103b
+	.export		_test104a
+	.export		_test104b
+	.export		_test105a
+	.export		_test105b
+	.export		_test106a
+	.export		_test106b
+	.export		_test107a
+	.export		_test107b
+	.export		_test108a
+	.export		_test108b
+	.export		_test201a
+	.export		_test201b
+	.export		_test202a
+	.export		_test202b
+	.export		_test203a
+	.export		_test203b
+	.export		_test204a
+	.export		_test204b
+	.export		_test205a
+	.export		_test205b
+	.export		_test206a
+	.export		_test206b
+	.export		_test207a
+	.export		_test207b
+	.export		_test208a
+	.export		_test208b
+	.export		_test401a
+	.export		_test401b
+	.export		_test402a
+	.export		_test402b
+	.export		_test403a
+	.export		_test403b
+	.export		_main
+
+.segment	"DATA"
+
+_res:
+	.word	$0000
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$25,$64,$09,$6E,$6F,$74,$20,$65,$71,$75,$61,$6C,$3A,$20,$25,$6C
+	.byte	$64,$20,$21,$3D,$20,$25,$6C,$64,$2C,$20,$61,$20,$3D,$20,$25,$6C
+	.byte	$64,$2C,$20,$62,$20,$3D,$20,$25,$6C,$64,$0A,$09,$65,$78,$70,$65
+	.byte	$63,$74,$65,$64,$3A,$20,$20,$25,$6C,$64,$2F,$25,$6C,$64,$20,$3D
+	.byte	$20,$25,$6C,$64,$0A,$00
+S0044	:=	S0002+0
+S0004	:=	S0002+0
+S0042	:=	S0002+0
+S0006	:=	S0002+0
+S0040	:=	S0002+0
+S0008	:=	S0002+0
+S003E	:=	S0002+0
+S000A	:=	S0002+0
+S003C	:=	S0002+0
+S000C	:=	S0002+0
+S003A	:=	S0002+0
+S000E	:=	S0002+0
+S0038	:=	S0002+0
+S0010	:=	S0002+0
+S0036	:=	S0002+0
+S0012	:=	S0002+0
+S0034	:=	S0002+0
+S0014	:=	S0002+0
+S0032	:=	S0002+0
+S0016	:=	S0002+0
+S0030	:=	S0002+0
+S0018	:=	S0002+0
+S002E	:=	S0002+0
+S001A	:=	S0002+0
+S002C	:=	S0002+0
+S001C	:=	S0002+0
+S002A	:=	S0002+0
+S001E	:=	S0002+0
+S0028	:=	S0002+0
+S0020	:=	S0002+0
+S0026	:=	S0002+0
+S0022	:=	S0002+0
+S0024	:=	S0002+0
+S0046	:=	S0002+0
+S0025:
+	.byte	$25,$64,$09,$69,$6E,$63,$6F,$72,$72,$65,$63,$74,$3A,$20,$61,$2F
+	.byte	$25,$6C,$64,$20,$3D,$20,$25,$6C,$64,$2C,$20,$61,$2F,$62,$20,$3D
+	.byte	$20,$25,$6C,$64,$0A,$09,$65,$78,$70,$65,$63,$74,$65,$64,$3A,$20
+	.byte	$20,$25,$6C,$64,$2F,$25,$6C,$64,$20,$3D,$20,$25,$6C,$64,$0A,$00
+S0021	:=	S0025+0
+S0027	:=	S0025+0
+S001F	:=	S0025+0
+S0029	:=	S0025+0
+S001D	:=	S0025+0
+S002B	:=	S0025+0
+S001B	:=	S0025+0
+S002D	:=	S0025+0
+S0019	:=	S0025+0
+S002F	:=	S0025+0
+S0017	:=	S0025+0
+S0031	:=	S0025+0
+S0015	:=	S0025+0
+S0033	:=	S0025+0
+S0013	:=	S0025+0
+S0035	:=	S0025+0
+S0011	:=	S0025+0
+S0037	:=	S0025+0
+S000F	:=	S0025+0
+S0039	:=	S0025+0
+S000D	:=	S0025+0
+S003B	:=	S0025+0
+S000B	:=	S0025+0
+S003D	:=	S0025+0
+S0009	:=	S0025+0
+S003F	:=	S0025+0
+S0007	:=	S0025+0
+S0041	:=	S0025+0
+S0005	:=	S0025+0
+S0043	:=	S0025+0
+S0003	:=	S0025+0
+S0045	:=	S0025+0
+S0023	:=	S0025+0
+S0001	:=	S0025+0
+
+; ---------------------------------------------------------------
+; int __near__ test1a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test1a: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	lda     #$01
+	jsr     push0ax
+	lda     #$08
+	jsr     push0ax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$F9
+	txa
+	sbc     #$FF
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	jsr     asreax3
+L0004:	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	jsr     toseqeax
+	beq     L0002
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	bra     L0008
+L0002:	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	lda     #$08
+	jsr     push0ax
+	ldy     #$0F
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0009
+	jsr     saveeax
+	cmp     #$F9
+	txa
+	sbc     #$FF
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0009
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L000A
+L0009:	jsr     asreax3
+L000A:	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	lda     #$01
+	jsr     push0ax
+	lda     #$08
+	jsr     push0ax
+	jsr     pushl0
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0008:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test1b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test1b: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	lda     #$01
+	jsr     push0ax
+	lda     #$08
+	jsr     push0ax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$F9
+	txa
+	sbc     #$FF
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	jsr     asreax3
+L0004:	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	bra     L0005
+L0002:	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	ldy     #$0B
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0006
+	jsr     saveeax
+	cmp     #$F9
+	txa
+	sbc     #$FF
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0006
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0007
+L0006:	jsr     asreax3
+L0007:	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	lda     #$01
+	jsr     push0ax
+	lda     #$08
+	jsr     push0ax
+	jsr     pushl0
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0005:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test2a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test2a: near
+
+.segment	"CODE"
+
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	txa
+	jsr     pusheax
+	inx
+	lda     #$08
+	jsr     push0ax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$F9
+	txa
+	sbc     #$FF
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	jsr     asreax3
+L0004:	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	jsr     toseqeax
+	beq     L0002
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	bra     L0008
+L0002:	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     #$02
+	jsr     pusha0
+	lda     #$08
+	jsr     push0ax
+	ldy     #$0F
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0009
+	jsr     saveeax
+	cmp     #$F9
+	txa
+	sbc     #$FF
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0009
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L000A
+L0009:	jsr     asreax3
+L000A:	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	txa
+	jsr     pusheax
+	inx
+	lda     #$08
+	jsr     push0ax
+	jsr     pushl0
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0008:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test2b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test2b: near
+
+.segment	"CODE"
+
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	txa
+	jsr     pusheax
+	inx
+	lda     #$08
+	jsr     push0ax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$F9
+	txa
+	sbc     #$FF
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	jsr     asreax3
+L0004:	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	bra     L0005
+L0002:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     #$02
+	jsr     pusha0
+	ldy     #$0B
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0006
+	jsr     saveeax
+	cmp     #$F9
+	txa
+	sbc     #$FF
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0006
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0007
+L0006:	jsr     asreax3
+L0007:	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	txa
+	jsr     pusheax
+	inx
+	lda     #$08
+	jsr     push0ax
+	jsr     pushl0
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0005:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test3a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test3a: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	lda     #$01
+	jsr     push0ax
+	dex
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$F9
+	txa
+	sbc     #$FF
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	jsr     asreax3
+L0004:	jsr     negeax
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	jsr     toseqeax
+	beq     L0002
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	bra     L0008
+L0002:	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     #$03
+	jsr     pusha0
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0009
+	jsr     saveeax
+	cmp     #$F9
+	txa
+	sbc     #$FF
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0009
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L000A
+L0009:	jsr     asreax3
+L000A:	jsr     negeax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	lda     #$01
+	jsr     push0ax
+	dex
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	jsr     pushl0
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0008:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test3b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test3b: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	lda     #$01
+	jsr     push0ax
+	dex
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$F9
+	txa
+	sbc     #$FF
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	jsr     asreax3
+L0004:	jsr     negeax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	jmp     L0005
+L0002:	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	lda     #$03
+	jsr     pusha0
+	ldy     #$0B
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0006
+	jsr     saveeax
+	cmp     #$F9
+	txa
+	sbc     #$FF
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0006
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0007
+L0006:	jsr     asreax3
+L0007:	jsr     negeax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	lda     #$01
+	jsr     push0ax
+	dex
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	jsr     pushl0
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0005:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test4a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test4a: near
+
+.segment	"CODE"
+
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	txa
+	jsr     pusheax
+	lda     #$F8
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$F9
+	txa
+	sbc     #$FF
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	jsr     asreax3
+L0004:	jsr     negeax
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	jsr     toseqeax
+	beq     L0002
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	bra     L0008
+L0002:	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0009
+	jsr     saveeax
+	cmp     #$F9
+	txa
+	sbc     #$FF
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0009
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L000A
+L0009:	jsr     asreax3
+L000A:	jsr     negeax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	txa
+	jsr     pusheax
+	lda     #$F8
+	jsr     pusheax
+	jsr     pushl0
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0008:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test4b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test4b: near
+
+.segment	"CODE"
+
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	txa
+	jsr     pusheax
+	lda     #$F8
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$F9
+	txa
+	sbc     #$FF
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	jsr     asreax3
+L0004:	jsr     negeax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	jmp     L0005
+L0002:	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	lda     #$04
+	jsr     pusha0
+	ldy     #$0B
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0006
+	jsr     saveeax
+	cmp     #$F9
+	txa
+	sbc     #$FF
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0006
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0007
+L0006:	jsr     asreax3
+L0007:	jsr     negeax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	txa
+	jsr     pusheax
+	lda     #$F8
+	jsr     pusheax
+	jsr     pushl0
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0005:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test5a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test5a: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	lda     #$08
+	jsr     push0ax
+	lda     #$01
+	jsr     push0ax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$08
+	jsr     toseqeax
+	beq     L0002
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$08
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	bra     L0006
+L0002:	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	lda     #$01
+	jsr     push0ax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	lda     #$08
+	jsr     push0ax
+	lda     #$01
+	jsr     push0ax
+	lda     #$08
+	jsr     push0ax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0006:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test5b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test5b: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	lda     #$08
+	jsr     push0ax
+	lda     #$01
+	jsr     push0ax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	bra     L0003
+L0002:	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	lda     #$05
+	jsr     pusha0
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	lda     #$08
+	jsr     push0ax
+	lda     #$01
+	jsr     push0ax
+	lda     #$08
+	jsr     push0ax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0003:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test6a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test6a: near
+
+.segment	"CODE"
+
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	inx
+	lda     #$01
+	jsr     push0ax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     toseqeax
+	beq     L0002
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	bra     L0006
+L0002:	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	lda     #$06
+	jsr     pusha0
+	lda     #$01
+	jsr     push0ax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	inx
+	lda     #$01
+	jsr     push0ax
+	dex
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0006:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test6b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test6b: near
+
+.segment	"CODE"
+
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	inx
+	lda     #$01
+	jsr     push0ax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	bra     L0003
+L0002:	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	lda     #$06
+	jsr     pusha0
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	inx
+	lda     #$01
+	jsr     push0ax
+	dex
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0003:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test7a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test7a: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	lda     #$08
+	jsr     push0ax
+	dex
+	stx     sreg
+	stx     sreg+1
+	txa
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     negeax
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     toseqeax
+	beq     L0002
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	bra     L0006
+L0002:	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	lda     #$07
+	jsr     pusha0
+	ldx     #$FF
+	txa
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     negeax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	lda     #$08
+	jsr     push0ax
+	dex
+	stx     sreg
+	stx     sreg+1
+	txa
+	jsr     pusheax
+	lda     #$F8
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0006:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test7b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test7b: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	lda     #$08
+	jsr     push0ax
+	dex
+	stx     sreg
+	stx     sreg+1
+	txa
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     negeax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	bra     L0003
+L0002:	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	lda     #$07
+	jsr     pusha0
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     negeax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	lda     #$08
+	jsr     push0ax
+	dex
+	stx     sreg
+	stx     sreg+1
+	txa
+	jsr     pusheax
+	lda     #$F8
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0003:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test8a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test8a: near
+
+.segment	"CODE"
+
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	txa
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     negeax
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$08
+	jsr     toseqeax
+	beq     L0002
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$08
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	bra     L0006
+L0002:	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	lda     #$08
+	jsr     pusha0
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	txa
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     negeax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	txa
+	jsr     pusheax
+	inx
+	lda     #$08
+	jsr     push0ax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0006:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test8b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test8b: near
+
+.segment	"CODE"
+
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	txa
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     negeax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	bra     L0003
+L0002:	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	lda     #$08
+	jsr     pusha0
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     negeax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	txa
+	jsr     pusheax
+	inx
+	lda     #$08
+	jsr     push0ax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0003:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test11a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test11a: near
+
+.segment	"CODE"
+
+	ldx     #$08
+	lda     #$00
+	jsr     push0ax
+	ldx     #$02
+	jsr     push0ax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$FE
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0005
+	dey
+L0005:	sty     sreg+1
+	jsr     asreax1
+L0004:	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$04
+	jsr     toseqeax
+	beq     L0002
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$04
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	jmp     L0009
+L0002:	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	lda     #$0B
+	jsr     pusha0
+	ldx     #$02
+	lda     #$00
+	jsr     push0ax
+	ldy     #$0F
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L000A
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$FE
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L000A
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L000B
+L000A:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L000C
+	dey
+L000C:	sty     sreg+1
+	jsr     asreax1
+L000B:	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$08
+	lda     #$00
+	jsr     push0ax
+	ldx     #$02
+	jsr     push0ax
+	tax
+	lda     #$04
+	jsr     push0ax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0009:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test11b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test11b: near
+
+.segment	"CODE"
+
+	ldx     #$08
+	lda     #$00
+	jsr     push0ax
+	ldx     #$02
+	jsr     push0ax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$FE
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0005
+	dey
+L0005:	sty     sreg+1
+	jsr     asreax1
+L0004:	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	jmp     L0006
+L0002:	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	lda     #$0B
+	jsr     pusha0
+	tay
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0007
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$FE
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0007
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0008
+L0007:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0009
+	dey
+L0009:	sty     sreg+1
+	jsr     asreax1
+L0008:	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$08
+	lda     #$00
+	jsr     push0ax
+	ldx     #$02
+	jsr     push0ax
+	tax
+	lda     #$04
+	jsr     push0ax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0006:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test12a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test12a: near
+
+.segment	"CODE"
+
+	ldx     #$F8
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	ldx     #$02
+	jsr     push0ax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$FE
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0005
+	dey
+L0005:	sty     sreg+1
+	jsr     asreax1
+L0004:	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FC
+	jsr     toseqeax
+	beq     L0002
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FC
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	jmp     L0009
+L0002:	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	lda     #$0C
+	jsr     pusha0
+	ldx     #$02
+	lda     #$00
+	jsr     push0ax
+	ldy     #$0F
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L000A
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$FE
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L000A
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L000B
+L000A:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L000C
+	dey
+L000C:	sty     sreg+1
+	jsr     asreax1
+L000B:	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$F8
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	ldx     #$02
+	jsr     push0ax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FC
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0009:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test12b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test12b: near
+
+.segment	"CODE"
+
+	ldx     #$F8
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	ldx     #$02
+	jsr     push0ax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$FE
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0005
+	dey
+L0005:	sty     sreg+1
+	jsr     asreax1
+L0004:	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	jmp     L0006
+L0002:	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	lda     #$0C
+	jsr     pusha0
+	ldy     #$0B
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0007
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$FE
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0007
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0008
+L0007:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0009
+	dey
+L0009:	sty     sreg+1
+	jsr     asreax1
+L0008:	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$F8
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	ldx     #$02
+	jsr     push0ax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FC
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0006:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test13a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test13a: near
+
+.segment	"CODE"
+
+	ldx     #$08
+	lda     #$00
+	jsr     push0ax
+	ldx     #$FE
+	dea
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$FE
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0005
+	dey
+L0005:	sty     sreg+1
+	jsr     asreax1
+L0004:	jsr     negeax
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FC
+	jsr     toseqeax
+	beq     L0002
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FC
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	jmp     L0009
+L0002:	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+	lda     #$0D
+	jsr     pusha0
+	ldx     #$FE
+	lda     #$00
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L000A
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$FE
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L000A
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L000B
+L000A:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L000C
+	dey
+L000C:	sty     sreg+1
+	jsr     asreax1
+L000B:	jsr     negeax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$08
+	lda     #$00
+	jsr     push0ax
+	ldx     #$FE
+	dea
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	inx
+	lda     #$FC
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0009:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test13b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test13b: near
+
+.segment	"CODE"
+
+	ldx     #$08
+	lda     #$00
+	jsr     push0ax
+	ldx     #$FE
+	dea
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$FE
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0005
+	dey
+L0005:	sty     sreg+1
+	jsr     asreax1
+L0004:	jsr     negeax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	jmp     L0006
+L0002:	lda     #<(S0016)
+	ldx     #>(S0016)
+	jsr     pushax
+	lda     #$0D
+	jsr     pusha0
+	ldy     #$0B
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0007
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$FE
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0007
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0008
+L0007:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0009
+	dey
+L0009:	sty     sreg+1
+	jsr     asreax1
+L0008:	jsr     negeax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$08
+	lda     #$00
+	jsr     push0ax
+	ldx     #$FE
+	dea
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	inx
+	lda     #$FC
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0006:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test14a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test14a: near
+
+.segment	"CODE"
+
+	ldx     #$F8
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	ldx     #$FE
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$FE
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0005
+	dey
+L0005:	sty     sreg+1
+	jsr     asreax1
+L0004:	jsr     negeax
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$04
+	jsr     toseqeax
+	beq     L0002
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$04
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	jmp     L0009
+L0002:	lda     #<(S0017)
+	ldx     #>(S0017)
+	jsr     pushax
+	lda     #$0E
+	jsr     pusha0
+	ldx     #$FE
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L000A
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$FE
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L000A
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L000B
+L000A:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L000C
+	dey
+L000C:	sty     sreg+1
+	jsr     asreax1
+L000B:	jsr     negeax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$F8
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	ldx     #$FE
+	jsr     pusheax
+	tax
+	lda     #$04
+	jsr     push0ax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0009:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test14b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test14b: near
+
+.segment	"CODE"
+
+	ldx     #$F8
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	ldx     #$FE
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$FE
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0005
+	dey
+L0005:	sty     sreg+1
+	jsr     asreax1
+L0004:	jsr     negeax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	jmp     L0006
+L0002:	lda     #<(S0018)
+	ldx     #>(S0018)
+	jsr     pushax
+	lda     #$0E
+	jsr     pusha0
+	ldy     #$0B
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0007
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$FE
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0007
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0008
+L0007:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0009
+	dey
+L0009:	sty     sreg+1
+	jsr     asreax1
+L0008:	jsr     negeax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$F8
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	ldx     #$FE
+	jsr     pusheax
+	tax
+	lda     #$04
+	jsr     push0ax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0006:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test15a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test15a: near
+
+.segment	"CODE"
+
+	ldx     #$02
+	lda     #$00
+	jsr     push0ax
+	ldx     #$08
+	jsr     push0ax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$F8
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0005
+	dey
+L0005:	sty     sreg+1
+	jsr     asreax3
+L0004:	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	jsr     toseqeax
+	beq     L0002
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	jmp     L0009
+L0002:	lda     #<(S0019)
+	ldx     #>(S0019)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	ldx     #$08
+	lda     #$00
+	jsr     push0ax
+	ldy     #$0F
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L000A
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$F8
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L000A
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L000B
+L000A:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L000C
+	dey
+L000C:	sty     sreg+1
+	jsr     asreax3
+L000B:	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$02
+	lda     #$00
+	jsr     push0ax
+	ldx     #$08
+	jsr     push0ax
+	jsr     pushl0
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0009:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test15b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test15b: near
+
+.segment	"CODE"
+
+	ldx     #$02
+	lda     #$00
+	jsr     push0ax
+	ldx     #$08
+	jsr     push0ax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$F8
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0005
+	dey
+L0005:	sty     sreg+1
+	jsr     asreax3
+L0004:	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	jmp     L0006
+L0002:	lda     #<(S001A)
+	ldx     #>(S001A)
+	jsr     pushax
+	lda     #$0F
+	jsr     pusha0
+	ldy     #$0B
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0007
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$F8
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0007
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0008
+L0007:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0009
+	dey
+L0009:	sty     sreg+1
+	jsr     asreax3
+L0008:	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$02
+	lda     #$00
+	jsr     push0ax
+	ldx     #$08
+	jsr     push0ax
+	jsr     pushl0
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0006:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test16a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test16a: near
+
+.segment	"CODE"
+
+	ldx     #$FE
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	ldx     #$08
+	jsr     push0ax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$F8
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0005
+	dey
+L0005:	sty     sreg+1
+	jsr     asreax3
+L0004:	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	jsr     toseqeax
+	beq     L0002
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	jmp     L0009
+L0002:	lda     #<(S001B)
+	ldx     #>(S001B)
+	jsr     pushax
+	lda     #$10
+	jsr     pusha0
+	ldx     #$08
+	lda     #$00
+	jsr     push0ax
+	ldy     #$0F
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L000A
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$F8
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L000A
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L000B
+L000A:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L000C
+	dey
+L000C:	sty     sreg+1
+	jsr     asreax3
+L000B:	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$FE
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	ldx     #$08
+	jsr     push0ax
+	jsr     pushl0
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0009:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test16b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test16b: near
+
+.segment	"CODE"
+
+	ldx     #$FE
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	ldx     #$08
+	jsr     push0ax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$F8
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0005
+	dey
+L0005:	sty     sreg+1
+	jsr     asreax3
+L0004:	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	jmp     L0006
+L0002:	lda     #<(S001C)
+	ldx     #>(S001C)
+	jsr     pushax
+	lda     #$10
+	jsr     pusha0
+	ldy     #$0B
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0007
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$F8
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0007
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0008
+L0007:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0009
+	dey
+L0009:	sty     sreg+1
+	jsr     asreax3
+L0008:	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FE
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	ldx     #$08
+	jsr     push0ax
+	jsr     pushl0
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0006:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test17a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test17a: near
+
+.segment	"CODE"
+
+	ldx     #$02
+	lda     #$00
+	jsr     push0ax
+	ldx     #$F8
+	dea
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$F8
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0005
+	dey
+L0005:	sty     sreg+1
+	jsr     asreax3
+L0004:	jsr     negeax
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	jsr     toseqeax
+	beq     L0002
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	jmp     L0009
+L0002:	lda     #<(S001D)
+	ldx     #>(S001D)
+	jsr     pushax
+	lda     #$11
+	jsr     pusha0
+	ldx     #$F8
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L000A
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$F8
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L000A
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L000B
+L000A:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L000C
+	dey
+L000C:	sty     sreg+1
+	jsr     asreax3
+L000B:	jsr     negeax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$02
+	lda     #$00
+	jsr     push0ax
+	ldx     #$F8
+	dea
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	jsr     pushl0
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0009:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test17b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test17b: near
+
+.segment	"CODE"
+
+	ldx     #$02
+	lda     #$00
+	jsr     push0ax
+	ldx     #$F8
+	dea
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$F8
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0005
+	dey
+L0005:	sty     sreg+1
+	jsr     asreax3
+L0004:	jsr     negeax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	jmp     L0006
+L0002:	lda     #<(S001E)
+	ldx     #>(S001E)
+	jsr     pushax
+	lda     #$11
+	jsr     pusha0
+	ldy     #$0B
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0007
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$F8
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0007
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0008
+L0007:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0009
+	dey
+L0009:	sty     sreg+1
+	jsr     asreax3
+L0008:	jsr     negeax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$02
+	lda     #$00
+	jsr     push0ax
+	ldx     #$F8
+	dea
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	jsr     pushl0
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0006:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test18a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test18a: near
+
+.segment	"CODE"
+
+	ldx     #$FE
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	ldx     #$F8
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$F8
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0005
+	dey
+L0005:	sty     sreg+1
+	jsr     asreax3
+L0004:	jsr     negeax
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	jsr     toseqeax
+	beq     L0002
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	jmp     L0009
+L0002:	lda     #<(S001F)
+	ldx     #>(S001F)
+	jsr     pushax
+	lda     #$12
+	jsr     pusha0
+	ldx     #$F8
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L000A
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$F8
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L000A
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L000B
+L000A:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L000C
+	dey
+L000C:	sty     sreg+1
+	jsr     asreax3
+L000B:	jsr     negeax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$FE
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	ldx     #$F8
+	jsr     pusheax
+	jsr     pushl0
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0009:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test18b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test18b: near
+
+.segment	"CODE"
+
+	ldx     #$FE
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	ldx     #$F8
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$F8
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0005
+	dey
+L0005:	sty     sreg+1
+	jsr     asreax3
+L0004:	jsr     negeax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	jmp     L0006
+L0002:	lda     #<(S0020)
+	ldx     #>(S0020)
+	jsr     pushax
+	lda     #$12
+	jsr     pusha0
+	ldy     #$0B
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0007
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$F8
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0007
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0008
+L0007:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0009
+	dey
+L0009:	sty     sreg+1
+	jsr     asreax3
+L0008:	jsr     negeax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FE
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	ldx     #$F8
+	jsr     pusheax
+	jsr     pushl0
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0006:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test101a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test101a: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	lda     #$7F
+	jsr     push0ax
+	ina
+	jsr     push0ax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$81
+	txa
+	sbc     #$FF
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	jsr     asreax4
+	jsr     asreax3
+L0004:	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	jsr     toseqeax
+	beq     L0002
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	bra     L0008
+L0002:	lda     #<(S0021)
+	ldx     #>(S0021)
+	jsr     pushax
+	lda     #$65
+	jsr     pusha0
+	lda     #$80
+	jsr     push0ax
+	ldy     #$0F
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0009
+	jsr     saveeax
+	cmp     #$81
+	txa
+	sbc     #$FF
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0009
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L000A
+L0009:	jsr     asreax4
+	jsr     asreax3
+L000A:	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	lda     #$7F
+	jsr     push0ax
+	ina
+	jsr     push0ax
+	jsr     pushl0
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0008:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test101b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test101b: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	lda     #$7F
+	jsr     push0ax
+	ina
+	jsr     push0ax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$81
+	txa
+	sbc     #$FF
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	jsr     asreax4
+	jsr     asreax3
+L0004:	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	bra     L0005
+L0002:	lda     #<(S0022)
+	ldx     #>(S0022)
+	jsr     pushax
+	lda     #$65
+	jsr     pusha0
+	ldy     #$0B
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0006
+	jsr     saveeax
+	cmp     #$81
+	txa
+	sbc     #$FF
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0006
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0007
+L0006:	jsr     asreax4
+	jsr     asreax3
+L0007:	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	lda     #$7F
+	jsr     push0ax
+	ina
+	jsr     push0ax
+	jsr     pushl0
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0005:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test102a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test102a: near
+
+.segment	"CODE"
+
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$81
+	jsr     pusheax
+	inx
+	dea
+	jsr     push0ax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$81
+	txa
+	sbc     #$FF
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	jsr     asreax4
+	jsr     asreax3
+L0004:	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	jsr     toseqeax
+	beq     L0002
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	bra     L0008
+L0002:	lda     #<(S0023)
+	ldx     #>(S0023)
+	jsr     pushax
+	lda     #$66
+	jsr     pusha0
+	lda     #$80
+	jsr     push0ax
+	ldy     #$0F
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0009
+	jsr     saveeax
+	cmp     #$81
+	txa
+	sbc     #$FF
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0009
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L000A
+L0009:	jsr     asreax4
+	jsr     asreax3
+L000A:	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$81
+	jsr     pusheax
+	inx
+	dea
+	jsr     push0ax
+	jsr     pushl0
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0008:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test102b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test102b: near
+
+.segment	"CODE"
+
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$81
+	jsr     pusheax
+	inx
+	dea
+	jsr     push0ax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$81
+	txa
+	sbc     #$FF
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	jsr     asreax4
+	jsr     asreax3
+L0004:	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	jmp     L0005
+L0002:	lda     #<(S0024)
+	ldx     #>(S0024)
+	jsr     pushax
+	lda     #$66
+	jsr     pusha0
+	ldy     #$0B
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0006
+	jsr     saveeax
+	cmp     #$81
+	txa
+	sbc     #$FF
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0006
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0007
+L0006:	jsr     asreax4
+	jsr     asreax3
+L0007:	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$81
+	jsr     pusheax
+	inx
+	dea
+	jsr     push0ax
+	jsr     pushl0
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0005:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test103a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test103a: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	lda     #$7F
+	jsr     push0ax
+	dex
+	stx     sreg
+	stx     sreg+1
+	ina
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$81
+	txa
+	sbc     #$FF
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	jsr     asreax4
+	jsr     asreax3
+L0004:	jsr     negeax
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	jsr     toseqeax
+	beq     L0002
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	bra     L0008
+L0002:	lda     #<(S0025)
+	ldx     #>(S0025)
+	jsr     pushax
+	lda     #$67
+	jsr     pusha0
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0009
+	jsr     saveeax
+	cmp     #$81
+	txa
+	sbc     #$FF
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0009
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L000A
+L0009:	jsr     asreax4
+	jsr     asreax3
+L000A:	jsr     negeax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	lda     #$7F
+	jsr     push0ax
+	dex
+	stx     sreg
+	stx     sreg+1
+	ina
+	jsr     pusheax
+	jsr     pushl0
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0008:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test103b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test103b: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	lda     #$7F
+	jsr     push0ax
+	dex
+	stx     sreg
+	stx     sreg+1
+	ina
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$81
+	txa
+	sbc     #$FF
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	jsr     asreax4
+	jsr     asreax3
+L0004:	jsr     negeax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	jmp     L0005
+L0002:	lda     #<(S0026)
+	ldx     #>(S0026)
+	jsr     pushax
+	lda     #$67
+	jsr     pusha0
+	ldy     #$0B
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0006
+	jsr     saveeax
+	cmp     #$81
+	txa
+	sbc     #$FF
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0006
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0007
+L0006:	jsr     asreax4
+	jsr     asreax3
+L0007:	jsr     negeax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	lda     #$7F
+	jsr     push0ax
+	dex
+	stx     sreg
+	stx     sreg+1
+	ina
+	jsr     pusheax
+	jsr     pushl0
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0005:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test104a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test104a: near
+
+.segment	"CODE"
+
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$81
+	jsr     pusheax
+	dea
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$81
+	txa
+	sbc     #$FF
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	jsr     asreax4
+	jsr     asreax3
+L0004:	jsr     negeax
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	jsr     toseqeax
+	beq     L0002
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	bra     L0008
+L0002:	lda     #<(S0027)
+	ldx     #>(S0027)
+	jsr     pushax
+	lda     #$68
+	jsr     pusha0
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0009
+	jsr     saveeax
+	cmp     #$81
+	txa
+	sbc     #$FF
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0009
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L000A
+L0009:	jsr     asreax4
+	jsr     asreax3
+L000A:	jsr     negeax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$81
+	jsr     pusheax
+	dea
+	jsr     pusheax
+	jsr     pushl0
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0008:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test104b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test104b: near
+
+.segment	"CODE"
+
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$81
+	jsr     pusheax
+	dea
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$81
+	txa
+	sbc     #$FF
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	jsr     asreax4
+	jsr     asreax3
+L0004:	jsr     negeax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	jmp     L0005
+L0002:	lda     #<(S0028)
+	ldx     #>(S0028)
+	jsr     pushax
+	lda     #$68
+	jsr     pusha0
+	ldy     #$0B
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0006
+	jsr     saveeax
+	cmp     #$81
+	txa
+	sbc     #$FF
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0006
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0007
+L0006:	jsr     asreax4
+	jsr     asreax3
+L0007:	jsr     negeax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$81
+	jsr     pusheax
+	dea
+	jsr     pusheax
+	jsr     pushl0
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0005:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test105a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test105a: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	lda     #$80
+	jsr     push0ax
+	jsr     push0ax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$81
+	txa
+	sbc     #$FF
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	jsr     asreax4
+	jsr     asreax3
+L0004:	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$01
+	jsr     toseqeax
+	beq     L0002
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$01
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	bra     L0008
+L0002:	lda     #<(S0029)
+	ldx     #>(S0029)
+	jsr     pushax
+	lda     #$69
+	jsr     pusha0
+	lda     #$80
+	jsr     push0ax
+	ldy     #$0F
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0009
+	jsr     saveeax
+	cmp     #$81
+	txa
+	sbc     #$FF
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0009
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L000A
+L0009:	jsr     asreax4
+	jsr     asreax3
+L000A:	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	lda     #$80
+	jsr     push0ax
+	jsr     push0ax
+	lda     #$01
+	jsr     push0ax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0008:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test105b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test105b: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	lda     #$80
+	jsr     push0ax
+	jsr     push0ax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$81
+	txa
+	sbc     #$FF
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	jsr     asreax4
+	jsr     asreax3
+L0004:	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	bra     L0005
+L0002:	lda     #<(S002A)
+	ldx     #>(S002A)
+	jsr     pushax
+	lda     #$69
+	jsr     pusha0
+	ldy     #$0B
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0006
+	jsr     saveeax
+	cmp     #$81
+	txa
+	sbc     #$FF
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0006
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0007
+L0006:	jsr     asreax4
+	jsr     asreax3
+L0007:	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	lda     #$80
+	jsr     push0ax
+	jsr     push0ax
+	lda     #$01
+	jsr     push0ax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0005:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test106a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test106a: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	lda     #$80
+	jsr     push0ax
+	dex
+	stx     sreg
+	stx     sreg+1
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$81
+	txa
+	sbc     #$FF
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	jsr     asreax4
+	jsr     asreax3
+L0004:	jsr     negeax
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	txa
+	jsr     toseqeax
+	beq     L0002
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	txa
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	bra     L0008
+L0002:	lda     #<(S002B)
+	ldx     #>(S002B)
+	jsr     pushax
+	lda     #$6A
+	jsr     pusha0
+	ldx     #$FF
+	lda     #$80
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0009
+	jsr     saveeax
+	cmp     #$81
+	txa
+	sbc     #$FF
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0009
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L000A
+L0009:	jsr     asreax4
+	jsr     asreax3
+L000A:	jsr     negeax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	lda     #$80
+	jsr     push0ax
+	dex
+	stx     sreg
+	stx     sreg+1
+	jsr     pusheax
+	txa
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0008:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test106b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test106b: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	lda     #$80
+	jsr     push0ax
+	dex
+	stx     sreg
+	stx     sreg+1
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$81
+	txa
+	sbc     #$FF
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	jsr     asreax4
+	jsr     asreax3
+L0004:	jsr     negeax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	jmp     L0005
+L0002:	lda     #<(S002C)
+	ldx     #>(S002C)
+	jsr     pushax
+	lda     #$6A
+	jsr     pusha0
+	ldy     #$0B
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0006
+	jsr     saveeax
+	cmp     #$81
+	txa
+	sbc     #$FF
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0006
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0007
+L0006:	jsr     asreax4
+	jsr     asreax3
+L0007:	jsr     negeax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	lda     #$80
+	jsr     push0ax
+	dex
+	stx     sreg
+	stx     sreg+1
+	jsr     pusheax
+	txa
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0005:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test107a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test107a: near
+
+.segment	"CODE"
+
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	inx
+	jsr     push0ax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$81
+	txa
+	sbc     #$FF
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	jsr     asreax4
+	jsr     asreax3
+L0004:	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	txa
+	jsr     toseqeax
+	beq     L0002
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	txa
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	bra     L0008
+L0002:	lda     #<(S002D)
+	ldx     #>(S002D)
+	jsr     pushax
+	lda     #$6B
+	jsr     pusha0
+	lda     #$80
+	jsr     push0ax
+	ldy     #$0F
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0009
+	jsr     saveeax
+	cmp     #$81
+	txa
+	sbc     #$FF
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0009
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L000A
+L0009:	jsr     asreax4
+	jsr     asreax3
+L000A:	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	inx
+	jsr     push0ax
+	dex
+	stx     sreg
+	stx     sreg+1
+	txa
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0008:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test107b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test107b: near
+
+.segment	"CODE"
+
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	inx
+	jsr     push0ax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$81
+	txa
+	sbc     #$FF
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	jsr     asreax4
+	jsr     asreax3
+L0004:	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	jmp     L0005
+L0002:	lda     #<(S002E)
+	ldx     #>(S002E)
+	jsr     pushax
+	lda     #$6B
+	jsr     pusha0
+	ldy     #$0B
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0006
+	jsr     saveeax
+	cmp     #$81
+	txa
+	sbc     #$FF
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0006
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0007
+L0006:	jsr     asreax4
+	jsr     asreax3
+L0007:	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	inx
+	jsr     push0ax
+	dex
+	stx     sreg
+	stx     sreg+1
+	txa
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0005:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test108a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test108a: near
+
+.segment	"CODE"
+
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$81
+	txa
+	sbc     #$FF
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	jsr     asreax4
+	jsr     asreax3
+L0004:	jsr     negeax
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$01
+	jsr     toseqeax
+	beq     L0002
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$01
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	jmp     L0008
+L0002:	lda     #<(S002F)
+	ldx     #>(S002F)
+	jsr     pushax
+	lda     #$6C
+	jsr     pusha0
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0009
+	jsr     saveeax
+	cmp     #$81
+	txa
+	sbc     #$FF
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0009
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L000A
+L0009:	jsr     asreax4
+	jsr     asreax3
+L000A:	jsr     negeax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	jsr     pusheax
+	inx
+	lda     #$01
+	jsr     push0ax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0008:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test108b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test108b: near
+
+.segment	"CODE"
+
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$81
+	txa
+	sbc     #$FF
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	jsr     asreax4
+	jsr     asreax3
+L0004:	jsr     negeax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	jmp     L0005
+L0002:	lda     #<(S0030)
+	ldx     #>(S0030)
+	jsr     pushax
+	lda     #$6C
+	jsr     pusha0
+	ldy     #$0B
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0006
+	jsr     saveeax
+	cmp     #$81
+	txa
+	sbc     #$FF
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0006
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0007
+L0006:	jsr     asreax4
+	jsr     asreax3
+L0007:	jsr     negeax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	jsr     pusheax
+	inx
+	lda     #$01
+	jsr     push0ax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0005:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test201a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test201a: near
+
+.segment	"CODE"
+
+	ldx     #$7F
+	lda     #$FF
+	jsr     push0ax
+	inx
+	ina
+	jsr     push0ax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$80
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0005
+	dey
+L0005:	sty     sreg+1
+	jsr     asreax4
+	jsr     asreax3
+L0004:	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	jsr     toseqeax
+	beq     L0002
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	jmp     L0009
+L0002:	lda     #<(S0031)
+	ldx     #>(S0031)
+	jsr     pushax
+	lda     #$C9
+	jsr     pusha0
+	ldx     #$80
+	lda     #$00
+	jsr     push0ax
+	ldy     #$0F
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L000A
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$80
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L000A
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L000B
+L000A:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L000C
+	dey
+L000C:	sty     sreg+1
+	jsr     asreax4
+	jsr     asreax3
+L000B:	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$7F
+	lda     #$FF
+	jsr     push0ax
+	inx
+	ina
+	jsr     push0ax
+	jsr     pushl0
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0009:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test201b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test201b: near
+
+.segment	"CODE"
+
+	ldx     #$7F
+	lda     #$FF
+	jsr     push0ax
+	inx
+	ina
+	jsr     push0ax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$80
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0005
+	dey
+L0005:	sty     sreg+1
+	jsr     asreax4
+	jsr     asreax3
+L0004:	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	jmp     L0006
+L0002:	lda     #<(S0032)
+	ldx     #>(S0032)
+	jsr     pushax
+	lda     #$C9
+	jsr     pusha0
+	ldy     #$0B
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0007
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$80
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0007
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0008
+L0007:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0009
+	dey
+L0009:	sty     sreg+1
+	jsr     asreax4
+	jsr     asreax3
+L0008:	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$7F
+	lda     #$FF
+	jsr     push0ax
+	inx
+	ina
+	jsr     push0ax
+	jsr     pushl0
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0006:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test202a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test202a: near
+
+.segment	"CODE"
+
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	lda     #$01
+	jsr     pusheax
+	dea
+	jsr     push0ax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$80
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0005
+	dey
+L0005:	sty     sreg+1
+	jsr     asreax4
+	jsr     asreax3
+L0004:	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	jsr     toseqeax
+	beq     L0002
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	jmp     L0009
+L0002:	lda     #<(S0033)
+	ldx     #>(S0033)
+	jsr     pushax
+	lda     #$CA
+	jsr     pusha0
+	ldx     #$80
+	lda     #$00
+	jsr     push0ax
+	ldy     #$0F
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L000A
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$80
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L000A
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L000B
+L000A:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L000C
+	dey
+L000C:	sty     sreg+1
+	jsr     asreax4
+	jsr     asreax3
+L000B:	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	lda     #$01
+	jsr     pusheax
+	dea
+	jsr     push0ax
+	jsr     pushl0
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0009:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test202b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test202b: near
+
+.segment	"CODE"
+
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	lda     #$01
+	jsr     pusheax
+	dea
+	jsr     push0ax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$80
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0005
+	dey
+L0005:	sty     sreg+1
+	jsr     asreax4
+	jsr     asreax3
+L0004:	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	jmp     L0006
+L0002:	lda     #<(S0034)
+	ldx     #>(S0034)
+	jsr     pushax
+	lda     #$CA
+	jsr     pusha0
+	ldy     #$0B
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0007
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$80
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0007
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0008
+L0007:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0009
+	dey
+L0009:	sty     sreg+1
+	jsr     asreax4
+	jsr     asreax3
+L0008:	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	lda     #$01
+	jsr     pusheax
+	dea
+	jsr     push0ax
+	jsr     pushl0
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0006:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test203a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test203a: near
+
+.segment	"CODE"
+
+	ldx     #$7F
+	lda     #$FF
+	jsr     push0ax
+	inx
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$80
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0005
+	dey
+L0005:	sty     sreg+1
+	jsr     asreax4
+	jsr     asreax3
+L0004:	jsr     negeax
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	jsr     toseqeax
+	beq     L0002
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	jmp     L0009
+L0002:	lda     #<(S0035)
+	ldx     #>(S0035)
+	jsr     pushax
+	lda     #$CB
+	jsr     pusha0
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L000A
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$80
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L000A
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L000B
+L000A:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L000C
+	dey
+L000C:	sty     sreg+1
+	jsr     asreax4
+	jsr     asreax3
+L000B:	jsr     negeax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$7F
+	lda     #$FF
+	jsr     push0ax
+	inx
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	jsr     pushl0
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0009:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test203b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test203b: near
+
+.segment	"CODE"
+
+	ldx     #$7F
+	lda     #$FF
+	jsr     push0ax
+	inx
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$80
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0005
+	dey
+L0005:	sty     sreg+1
+	jsr     asreax4
+	jsr     asreax3
+L0004:	jsr     negeax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	jmp     L0006
+L0002:	lda     #<(S0036)
+	ldx     #>(S0036)
+	jsr     pushax
+	lda     #$CB
+	jsr     pusha0
+	ldy     #$0B
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0007
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$80
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0007
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0008
+L0007:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0009
+	dey
+L0009:	sty     sreg+1
+	jsr     asreax4
+	jsr     asreax3
+L0008:	jsr     negeax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$7F
+	lda     #$FF
+	jsr     push0ax
+	inx
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	jsr     pushl0
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0006:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test204a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test204a: near
+
+.segment	"CODE"
+
+	ldx     #$7F
+	lda     #$FF
+	jsr     push0ax
+	inx
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$80
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0005
+	dey
+L0005:	sty     sreg+1
+	jsr     asreax4
+	jsr     asreax3
+L0004:	jsr     negeax
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	jsr     toseqeax
+	beq     L0002
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	jmp     L0009
+L0002:	lda     #<(S0037)
+	ldx     #>(S0037)
+	jsr     pushax
+	lda     #$CC
+	jsr     pusha0
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L000A
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$80
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L000A
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L000B
+L000A:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L000C
+	dey
+L000C:	sty     sreg+1
+	jsr     asreax4
+	jsr     asreax3
+L000B:	jsr     negeax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$7F
+	lda     #$FF
+	jsr     push0ax
+	inx
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	jsr     pushl0
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0009:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test204b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test204b: near
+
+.segment	"CODE"
+
+	ldx     #$7F
+	lda     #$FF
+	jsr     push0ax
+	inx
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$80
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0005
+	dey
+L0005:	sty     sreg+1
+	jsr     asreax4
+	jsr     asreax3
+L0004:	jsr     negeax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	jmp     L0006
+L0002:	lda     #<(S0038)
+	ldx     #>(S0038)
+	jsr     pushax
+	lda     #$CC
+	jsr     pusha0
+	ldy     #$0B
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0007
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$80
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0007
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0008
+L0007:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0009
+	dey
+L0009:	sty     sreg+1
+	jsr     asreax4
+	jsr     asreax3
+L0008:	jsr     negeax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$7F
+	lda     #$FF
+	jsr     push0ax
+	inx
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	jsr     pushl0
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0006:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test205a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test205a: near
+
+.segment	"CODE"
+
+	ldx     #$80
+	lda     #$00
+	jsr     push0ax
+	jsr     push0ax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$80
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0005
+	dey
+L0005:	sty     sreg+1
+	jsr     asreax4
+	jsr     asreax3
+L0004:	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$01
+	jsr     toseqeax
+	beq     L0002
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$01
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	jmp     L0009
+L0002:	lda     #<(S0039)
+	ldx     #>(S0039)
+	jsr     pushax
+	lda     #$CD
+	jsr     pusha0
+	ldx     #$80
+	lda     #$00
+	jsr     push0ax
+	ldy     #$0F
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L000A
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$80
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L000A
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L000B
+L000A:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L000C
+	dey
+L000C:	sty     sreg+1
+	jsr     asreax4
+	jsr     asreax3
+L000B:	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$80
+	lda     #$00
+	jsr     push0ax
+	jsr     push0ax
+	tax
+	ina
+	jsr     push0ax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0009:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test205b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test205b: near
+
+.segment	"CODE"
+
+	ldx     #$80
+	lda     #$00
+	jsr     push0ax
+	jsr     push0ax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$80
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0005
+	dey
+L0005:	sty     sreg+1
+	jsr     asreax4
+	jsr     asreax3
+L0004:	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	jmp     L0006
+L0002:	lda     #<(S003A)
+	ldx     #>(S003A)
+	jsr     pushax
+	lda     #$CD
+	jsr     pusha0
+	ldy     #$0B
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0007
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$80
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0007
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0008
+L0007:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0009
+	dey
+L0009:	sty     sreg+1
+	jsr     asreax4
+	jsr     asreax3
+L0008:	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$80
+	lda     #$00
+	jsr     push0ax
+	jsr     push0ax
+	tax
+	ina
+	jsr     push0ax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0006:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test206a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test206a: near
+
+.segment	"CODE"
+
+	ldx     #$80
+	lda     #$00
+	jsr     push0ax
+	dea
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$80
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0005
+	dey
+L0005:	sty     sreg+1
+	jsr     asreax4
+	jsr     asreax3
+L0004:	jsr     negeax
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	txa
+	jsr     toseqeax
+	beq     L0002
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	txa
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	jmp     L0009
+L0002:	lda     #<(S003B)
+	ldx     #>(S003B)
+	jsr     pushax
+	lda     #$CE
+	jsr     pusha0
+	ldx     #$80
+	lda     #$00
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L000A
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$80
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L000A
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L000B
+L000A:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L000C
+	dey
+L000C:	sty     sreg+1
+	jsr     asreax4
+	jsr     asreax3
+L000B:	jsr     negeax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$80
+	lda     #$00
+	jsr     push0ax
+	dea
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	ldx     #$FF
+	txa
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0009:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test206b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test206b: near
+
+.segment	"CODE"
+
+	ldx     #$80
+	lda     #$00
+	jsr     push0ax
+	dea
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$80
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0005
+	dey
+L0005:	sty     sreg+1
+	jsr     asreax4
+	jsr     asreax3
+L0004:	jsr     negeax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	jmp     L0006
+L0002:	lda     #<(S003C)
+	ldx     #>(S003C)
+	jsr     pushax
+	lda     #$CE
+	jsr     pusha0
+	ldy     #$0B
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0007
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$80
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0007
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0008
+L0007:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0009
+	dey
+L0009:	sty     sreg+1
+	jsr     asreax4
+	jsr     asreax3
+L0008:	jsr     negeax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$80
+	lda     #$00
+	jsr     push0ax
+	dea
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	ldx     #$FF
+	txa
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0006:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test207a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test207a: near
+
+.segment	"CODE"
+
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	jsr     push0ax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$80
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0005
+	dey
+L0005:	sty     sreg+1
+	jsr     asreax4
+	jsr     asreax3
+L0004:	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	txa
+	jsr     toseqeax
+	beq     L0002
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	txa
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	jmp     L0009
+L0002:	lda     #<(S003D)
+	ldx     #>(S003D)
+	jsr     pushax
+	lda     #$CF
+	jsr     pusha0
+	ldx     #$80
+	lda     #$00
+	jsr     push0ax
+	ldy     #$0F
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L000A
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$80
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L000A
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L000B
+L000A:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L000C
+	dey
+L000C:	sty     sreg+1
+	jsr     asreax4
+	jsr     asreax3
+L000B:	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	jsr     push0ax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	txa
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0009:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test207b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test207b: near
+
+.segment	"CODE"
+
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	jsr     push0ax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$80
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0005
+	dey
+L0005:	sty     sreg+1
+	jsr     asreax4
+	jsr     asreax3
+L0004:	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	jmp     L0006
+L0002:	lda     #<(S003E)
+	ldx     #>(S003E)
+	jsr     pushax
+	lda     #$CF
+	jsr     pusha0
+	ldy     #$0B
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0007
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$80
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0007
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0008
+L0007:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0009
+	dey
+L0009:	sty     sreg+1
+	jsr     asreax4
+	jsr     asreax3
+L0008:	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	jsr     push0ax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	txa
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0006:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test208a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test208a: near
+
+.segment	"CODE"
+
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$80
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0005
+	dey
+L0005:	sty     sreg+1
+	jsr     asreax4
+	jsr     asreax3
+L0004:	jsr     negeax
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$01
+	jsr     toseqeax
+	beq     L0002
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$01
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	jmp     L0009
+L0002:	lda     #<(S003F)
+	ldx     #>(S003F)
+	jsr     pushax
+	lda     #$D0
+	jsr     pusha0
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L000A
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$80
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L000A
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L000B
+L000A:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L000C
+	dey
+L000C:	sty     sreg+1
+	jsr     asreax4
+	jsr     asreax3
+L000B:	jsr     negeax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	jsr     pusheax
+	tax
+	ina
+	jsr     push0ax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0009:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test208b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test208b: near
+
+.segment	"CODE"
+
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$80
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0005
+	dey
+L0005:	sty     sreg+1
+	jsr     asreax4
+	jsr     asreax3
+L0004:	jsr     negeax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	jmp     L0006
+L0002:	lda     #<(S0040)
+	ldx     #>(S0040)
+	jsr     pushax
+	lda     #$D0
+	jsr     pusha0
+	ldy     #$0B
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0007
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$80
+	lda     sreg
+	sbc     #$FF
+	lda     sreg+1
+	sbc     #$FF
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0007
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0008
+L0007:	txa
+	ldx     sreg
+	ldy     sreg+1
+	sty     sreg
+	cpy     #$80
+	ldy     #$00
+	bcc     L0009
+	dey
+L0009:	sty     sreg+1
+	jsr     asreax4
+	jsr     asreax3
+L0008:	jsr     negeax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	ina
+	jsr     pusheax
+	jsr     pusheax
+	tax
+	ina
+	jsr     push0ax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0006:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test401a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test401a: near
+
+.segment	"CODE"
+
+	ldx     #$FF
+	stx     sreg
+	lda     #$7F
+	sta     sreg+1
+	txa
+	jsr     pusheax
+	inx
+	stz     sreg
+	lda     #$80
+	sta     sreg+1
+	txa
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$00
+	lda     sreg
+	sbc     #$00
+	lda     sreg+1
+	sbc     #$80
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	ldx     #$00
+	lda     sreg+1
+	bpl     L0005
+	dex
+L0005:	stx     sreg
+	stx     sreg+1
+	jsr     asreax4
+	jsr     asreax3
+L0004:	jsr     negeax
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	jsr     toseqeax
+	beq     L0002
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	jmp     L0009
+L0002:	lda     #<(S0041)
+	ldx     #>(S0041)
+	jsr     pushax
+	ldx     #$01
+	lda     #$91
+	jsr     pushax
+	dex
+	lda     #$80
+	sta     sreg+1
+	txa
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L000A
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$00
+	lda     sreg
+	sbc     #$00
+	lda     sreg+1
+	sbc     #$80
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L000A
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L000B
+L000A:	ldx     #$00
+	lda     sreg+1
+	bpl     L000C
+	dex
+L000C:	stx     sreg
+	stx     sreg+1
+	jsr     asreax4
+	jsr     asreax3
+L000B:	jsr     negeax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	lda     #$7F
+	sta     sreg+1
+	txa
+	jsr     pusheax
+	inx
+	stz     sreg
+	lda     #$80
+	sta     sreg+1
+	txa
+	jsr     pusheax
+	jsr     pushl0
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0009:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test401b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test401b: near
+
+.segment	"CODE"
+
+	ldx     #$FF
+	stx     sreg
+	lda     #$7F
+	sta     sreg+1
+	txa
+	jsr     pusheax
+	inx
+	stz     sreg
+	lda     #$80
+	sta     sreg+1
+	txa
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$00
+	lda     sreg
+	sbc     #$00
+	lda     sreg+1
+	sbc     #$80
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	ldx     #$00
+	lda     sreg+1
+	bpl     L0005
+	dex
+L0005:	stx     sreg
+	stx     sreg+1
+	jsr     asreax4
+	jsr     asreax3
+L0004:	jsr     negeax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	jmp     L0006
+L0002:	lda     #<(S0042)
+	ldx     #>(S0042)
+	jsr     pushax
+	ldx     #$01
+	lda     #$91
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0007
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$00
+	lda     sreg
+	sbc     #$00
+	lda     sreg+1
+	sbc     #$80
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0007
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0008
+L0007:	ldx     #$00
+	lda     sreg+1
+	bpl     L0009
+	dex
+L0009:	stx     sreg
+	stx     sreg+1
+	jsr     asreax4
+	jsr     asreax3
+L0008:	jsr     negeax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	lda     #$7F
+	sta     sreg+1
+	txa
+	jsr     pusheax
+	inx
+	stz     sreg
+	lda     #$80
+	sta     sreg+1
+	txa
+	jsr     pusheax
+	jsr     pushl0
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0006:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test402a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test402a: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	stz     sreg
+	lda     #$80
+	sta     sreg+1
+	lda     #$01
+	jsr     pusheax
+	txa
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$00
+	lda     sreg
+	sbc     #$00
+	lda     sreg+1
+	sbc     #$80
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	ldx     #$00
+	lda     sreg+1
+	bpl     L0005
+	dex
+L0005:	stx     sreg
+	stx     sreg+1
+	jsr     asreax4
+	jsr     asreax3
+L0004:	jsr     negeax
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	jsr     toseqeax
+	beq     L0002
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	jmp     L0009
+L0002:	lda     #<(S0043)
+	ldx     #>(S0043)
+	jsr     pushax
+	ldx     #$01
+	lda     #$92
+	jsr     pushax
+	dex
+	lda     #$80
+	sta     sreg+1
+	txa
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L000A
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$00
+	lda     sreg
+	sbc     #$00
+	lda     sreg+1
+	sbc     #$80
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L000A
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L000B
+L000A:	ldx     #$00
+	lda     sreg+1
+	bpl     L000C
+	dex
+L000C:	stx     sreg
+	stx     sreg+1
+	jsr     asreax4
+	jsr     asreax3
+L000B:	jsr     negeax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	lda     #$80
+	sta     sreg+1
+	lda     #$01
+	jsr     pusheax
+	txa
+	jsr     pusheax
+	jsr     pushl0
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0009:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test402b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test402b: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	stz     sreg
+	lda     #$80
+	sta     sreg+1
+	lda     #$01
+	jsr     pusheax
+	txa
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$00
+	lda     sreg
+	sbc     #$00
+	lda     sreg+1
+	sbc     #$80
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	ldx     #$00
+	lda     sreg+1
+	bpl     L0005
+	dex
+L0005:	stx     sreg
+	stx     sreg+1
+	jsr     asreax4
+	jsr     asreax3
+L0004:	jsr     negeax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	jmp     L0006
+L0002:	lda     #<(S0044)
+	ldx     #>(S0044)
+	jsr     pushax
+	ldx     #$01
+	lda     #$92
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0007
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$00
+	lda     sreg
+	sbc     #$00
+	lda     sreg+1
+	sbc     #$80
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0007
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0008
+L0007:	ldx     #$00
+	lda     sreg+1
+	bpl     L0009
+	dex
+L0009:	stx     sreg
+	stx     sreg+1
+	jsr     asreax4
+	jsr     asreax3
+L0008:	jsr     negeax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	lda     #$80
+	sta     sreg+1
+	lda     #$01
+	jsr     pusheax
+	txa
+	jsr     pusheax
+	jsr     pushl0
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0006:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test403a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test403a: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	stz     sreg
+	lda     #$80
+	sta     sreg+1
+	txa
+	jsr     pusheax
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$00
+	lda     sreg
+	sbc     #$00
+	lda     sreg+1
+	sbc     #$80
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	ldx     #$00
+	lda     sreg+1
+	bpl     L0005
+	dex
+L0005:	stx     sreg
+	stx     sreg+1
+	jsr     asreax4
+	jsr     asreax3
+L0004:	jsr     negeax
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$01
+	jsr     toseqeax
+	beq     L0002
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$01
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	jmp     L0009
+L0002:	lda     #<(S0045)
+	ldx     #>(S0045)
+	jsr     pushax
+	ldx     #$01
+	lda     #$93
+	jsr     pushax
+	dex
+	lda     #$80
+	sta     sreg+1
+	txa
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L000A
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$00
+	lda     sreg
+	sbc     #$00
+	lda     sreg+1
+	sbc     #$80
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L000A
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L000B
+L000A:	ldx     #$00
+	lda     sreg+1
+	bpl     L000C
+	dex
+L000C:	stx     sreg
+	stx     sreg+1
+	jsr     asreax4
+	jsr     asreax3
+L000B:	jsr     negeax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	lda     #$80
+	sta     sreg+1
+	txa
+	jsr     pusheax
+	jsr     pusheax
+	ina
+	jsr     push0ax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0009:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test403b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test403b: near
+
+.segment	"CODE"
+
+	ldx     #$00
+	stz     sreg
+	lda     #$80
+	sta     sreg+1
+	txa
+	jsr     pusheax
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0003
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$00
+	lda     sreg
+	sbc     #$00
+	lda     sreg+1
+	sbc     #$80
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0003
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0004
+L0003:	ldx     #$00
+	lda     sreg+1
+	bpl     L0005
+	dex
+L0005:	stx     sreg
+	stx     sreg+1
+	jsr     asreax4
+	jsr     asreax3
+L0004:	jsr     negeax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	jmp     L0006
+L0002:	lda     #<(S0046)
+	ldx     #>(S0046)
+	jsr     pushax
+	ldx     #$01
+	lda     #$93
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldeaxysp
+	ldy     sreg+1
+	bpl     L0007
+	jsr     saveeax
+	cmp     #$01
+	txa
+	sbc     #$00
+	lda     sreg
+	sbc     #$00
+	lda     sreg+1
+	sbc     #$80
+	jsr     boolult
+	lsr     a
+	jsr     resteax
+	bcs     L0007
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	txa
+	bra     L0008
+L0007:	ldx     #$00
+	lda     sreg+1
+	bpl     L0009
+	dex
+L0009:	stx     sreg
+	stx     sreg+1
+	jsr     asreax4
+	jsr     asreax3
+L0008:	jsr     negeax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	lda     #$80
+	sta     sreg+1
+	txa
+	jsr     pusheax
+	jsr     pusheax
+	ina
+	jsr     push0ax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+L0006:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     _test1a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test2a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test3a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test4a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test5a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test6a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test7a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test8a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test11a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test12a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test13a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test14a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test15a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test16a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test17a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test18a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test101a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test102a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test103a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test104a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test105a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test106a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test107a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test108a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test201a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test202a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test203a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test204a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test205a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test206a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test207a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test208a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test401a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test402a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test403a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test1b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test2b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test3b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test4b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test5b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test6b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test7b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test8b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test11b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test12b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test13b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test14b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test15b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test16b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test17b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test18b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test101b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test102b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test103b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test104b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test105b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test106b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test107b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test108b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test201b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test202b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test203b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test204b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test205b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test206b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test207b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test208b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test401b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test402b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	jsr     _test403b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	lda     _res
+	ldx     _res+1
+	rts
+
+.endproc
+
@@ -0,0 +1,8638 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "div-long-long.c", 2840, 1613073744
+	.dbg		file, "/root/repo/include/stdint.h", 6196, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "div-common.h", 1838, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_res
+	.export		_test1a
+	.export		_test1b
+	.export		_test2a
+	.export		_test2b
+	.export		_test3a
+	.export		_test3b
+	.export		_test4a
+	.export		_test4b
+	.export		_test5a
+	.export		_test5b
+	.export		_test6a
+	.export		_test6b
+	.export		_test7a
+	.export		_test7b
+	.export		_test8a
+	.export		_test8b
+	.export		_test11a
+	.export		_test11b
+	.export		_test12a
+	.export		_test12b
+	.export		_test13a
+	.export		_test13b
+	.export		_test14a
+	.export		_test14b
+	.export		_test15a
+	.export		_test15b
+	.export		_test16a
+	.export		_test16b
+	.export		_test17a
+	.export		_test17b
+	.export		_test18a
+	.export		_test18b
+	.export		_test101a
+	.export		_test101b
+	.export		_test102a
+	.export		_test102b
+	.export		_test103a
+	.export		_test103b
+	.export		_test104a
+	.export		_test104b
+	.export		_test105a
+	.export		_test105b
+	.export		_test106a
+	.export		_test106b
+	.export		_test107a
+	.export		_test107b
+	.export		_test108a
+	.export		_test108b
+	.export		_test201a
+	.export		_test201b
+	.export		_test202a
+	.export		_test202b
+	.export		_test203a
+	.export		_test203b
+	.export		_test204a
+	.export		_test204b
+	.export		_test205a
+	.export		_test205b
+	.export		_test206a
+	.export		_test206b
+	.export		_test207a
+	.export		_test207b
+	.export		_test208a
+	.export		_test208b
+	.export		_test401a
+	.export		_test401b
+	.export		_test402a
+	.export		_test402b
+	.export		_test403a
+	.export		_test403b
+	.export		_main
+
+.segment	"DATA"
+
+_res:
+	.word	$0000
+
+.segment	"RODATA"
+
+S0002:
+	.byte	$25,$64,$09,$6E,$6F,$74,$20,$65,$71,$75,$61,$6C,$3A,$20,$25,$6C
+	.byte	$64,$20,$21,$3D,$20,$25,$6C,$64,$2C,$20,$61,$20,$3D,$20,$25,$6C
+	.byte	$64,$2C,$20,$62,$20,$3D,$20,$25,$6C,$64,$0A,$09,$65,$78,$70,$65
+	.byte	$63,$74,$65,$64,$3A,$20,$20,$25,$6C,$64,$2F,$25,$6C,$64,$20,$3D
+	.byte	$20,$25,$6C,$64,$0A,$00
+S0044	:=	S0002+0
+S0004	:=	S0002+0
+S0042	:=	S0002+0
+S0006	:=	S0002+0
+S0040	:=	S0002+0
+S0008	:=	S0002+0
+S003E	:=	S0002+0
+S000A	:=	S0002+0
+S003C	:=	S0002+0
+S000C	:=	S0002+0
+S003A	:=	S0002+0
+S000E	:=	S0002+0
+S0038	:=	S0002+0
+S0010	:=	S0002+0
+S0036	:=	S0002+0
+S0012	:=	S0002+0
+S0034	:=	S0002+0
+S0014	:=	S0002+0
+S0032	:=	S0002+0
+S0016	:=	S0002+0
+S0030	:=	S0002+0
+S0018	:=	S0002+0
+S002E	:=	S0002+0
+S001A	:=	S0002+0
+S002C	:=	S0002+0
+S001C	:=	S0002+0
+S002A	:=	S0002+0
+S001E	:=	S0002+0
+S0028	:=	S0002+0
+S0020	:=	S0002+0
+S0026	:=	S0002+0
+S0022	:=	S0002+0
+S0024	:=	S0002+0
+S0046	:=	S0002+0
+S0025:
+	.byte	$25,$64,$09,$69,$6E,$63,$6F,$72,$72,$65,$63,$74,$3A,$20,$61,$2F
+	.byte	$25,$6C,$64,$20,$3D,$20,$25,$6C,$64,$2C,$20,$61,$2F,$62,$20,$3D
+	.byte	$20,$25,$6C,$64,$0A,$09,$65,$78,$70,$65,$63,$74,$65,$64,$3A,$20
+	.byte	$20,$25,$6C,$64,$2F,$25,$6C,$64,$20,$3D,$20,$25,$6C,$64,$0A,$00
+S0021	:=	S0025+0
+S0027	:=	S0025+0
+S001F	:=	S0025+0
+S0029	:=	S0025+0
+S001D	:=	S0025+0
+S002B	:=	S0025+0
+S001B	:=	S0025+0
+S002D	:=	S0025+0
+S0019	:=	S0025+0
+S002F	:=	S0025+0
+S0017	:=	S0025+0
+S0031	:=	S0025+0
+S0015	:=	S0025+0
+S0033	:=	S0025+0
+S0013	:=	S0025+0
+S0035	:=	S0025+0
+S0011	:=	S0025+0
+S0037	:=	S0025+0
+S000F	:=	S0025+0
+S0039	:=	S0025+0
+S000D	:=	S0025+0
+S003B	:=	S0025+0
+S000B	:=	S0025+0
+S003D	:=	S0025+0
+S0009	:=	S0025+0
+S003F	:=	S0025+0
+S0007	:=	S0025+0
+S0041	:=	S0025+0
+S0005	:=	S0025+0
+S0043	:=	S0025+0
+S0003	:=	S0025+0
+S0045	:=	S0025+0
+S0023	:=	S0025+0
+S0001	:=	S0025+0
+
+; ---------------------------------------------------------------
+; int __near__ test1a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test1a: near
+
+	.dbg	func, "test1a", "00", extern, "_test1a"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 14
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     toseqeax
+	jeq     L0003
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     toseqeax
+	jne     L0004
+L0003:	ldx     #$00
+	lda     #$00
+	jeq     L0005
+L0004:	ldx     #$00
+	lda     #$01
+L0005:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test1b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test1b: near
+
+	.dbg	func, "test1b", "00", extern, "_test1b"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 14
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0003
+	jmp     L0003
+L0002:	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0003
+L0003:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test2a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test2a: near
+
+	.dbg	func, "test2a", "00", extern, "_test2a"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 15
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     toseqeax
+	jeq     L0003
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     toseqeax
+	jne     L0004
+L0003:	ldx     #$00
+	lda     #$00
+	jeq     L0005
+L0004:	ldx     #$00
+	lda     #$01
+L0005:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     pushax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test2b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test2b: near
+
+	.dbg	func, "test2b", "00", extern, "_test2b"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 15
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0003
+	jmp     L0003
+L0002:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldx     #$00
+	lda     #$02
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0003
+L0003:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test3a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test3a: near
+
+	.dbg	func, "test3a", "00", extern, "_test3a"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 16
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     toseqeax
+	jeq     L0003
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     toseqeax
+	jne     L0004
+L0003:	ldx     #$00
+	lda     #$00
+	jeq     L0005
+L0004:	ldx     #$00
+	lda     #$01
+L0005:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldx     #$00
+	lda     #$03
+	jsr     pushax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test3b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test3b: near
+
+	.dbg	func, "test3b", "00", extern, "_test3b"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 16
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0003
+	jmp     L0003
+L0002:	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldx     #$00
+	lda     #$03
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0003
+L0003:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test4a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test4a: near
+
+	.dbg	func, "test4a", "00", extern, "_test4a"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 17
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     toseqeax
+	jeq     L0003
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     toseqeax
+	jne     L0004
+L0003:	ldx     #$00
+	lda     #$00
+	jeq     L0005
+L0004:	ldx     #$00
+	lda     #$01
+L0005:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldx     #$00
+	lda     #$04
+	jsr     pushax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test4b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test4b: near
+
+	.dbg	func, "test4b", "00", extern, "_test4b"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 17
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0003
+	jmp     L0003
+L0002:	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldx     #$00
+	lda     #$04
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0003
+L0003:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test5a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test5a: near
+
+	.dbg	func, "test5a", "00", extern, "_test5a"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 18
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     toseqeax
+	jeq     L0003
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     toseqeax
+	jne     L0004
+L0003:	ldx     #$00
+	lda     #$00
+	jeq     L0005
+L0004:	ldx     #$00
+	lda     #$01
+L0005:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldx     #$00
+	lda     #$05
+	jsr     pushax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test5b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test5b: near
+
+	.dbg	func, "test5b", "00", extern, "_test5b"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 18
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0003
+	jmp     L0003
+L0002:	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldx     #$00
+	lda     #$05
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0003
+L0003:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test6a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test6a: near
+
+	.dbg	func, "test6a", "00", extern, "_test6a"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 19
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     toseqeax
+	jeq     L0003
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     toseqeax
+	jne     L0004
+L0003:	ldx     #$00
+	lda     #$00
+	jeq     L0005
+L0004:	ldx     #$00
+	lda     #$01
+L0005:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldx     #$00
+	lda     #$06
+	jsr     pushax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test6b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test6b: near
+
+	.dbg	func, "test6b", "00", extern, "_test6b"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 19
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0003
+	jmp     L0003
+L0002:	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	ldx     #$00
+	lda     #$06
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0003
+L0003:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test7a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test7a: near
+
+	.dbg	func, "test7a", "00", extern, "_test7a"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 20
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     negeax
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     toseqeax
+	jeq     L0003
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     toseqeax
+	jne     L0004
+L0003:	ldx     #$00
+	lda     #$00
+	jeq     L0005
+L0004:	ldx     #$00
+	lda     #$01
+L0005:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	ldx     #$00
+	lda     #$07
+	jsr     pushax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     negeax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test7b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test7b: near
+
+	.dbg	func, "test7b", "00", extern, "_test7b"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 20
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     negeax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0003
+	jmp     L0003
+L0002:	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	ldx     #$00
+	lda     #$07
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     negeax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0003
+L0003:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test8a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test8a: near
+
+	.dbg	func, "test8a", "00", extern, "_test8a"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 21
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     negeax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     toseqeax
+	jeq     L0003
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     toseqeax
+	jne     L0004
+L0003:	ldx     #$00
+	lda     #$00
+	jeq     L0005
+L0004:	ldx     #$00
+	lda     #$01
+L0005:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	ldx     #$00
+	lda     #$08
+	jsr     pushax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     negeax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test8b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test8b: near
+
+	.dbg	func, "test8b", "00", extern, "_test8b"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 21
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     negeax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0003
+	jmp     L0003
+L0002:	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	ldx     #$00
+	lda     #$08
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     negeax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F8
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$08
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0003
+L0003:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test11a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test11a: near
+
+	.dbg	func, "test11a", "00", extern, "_test11a"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 23
+	ldx     #$08
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldx     #$02
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$02
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$04
+	jsr     toseqeax
+	jeq     L0003
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$04
+	jsr     toseqeax
+	jne     L0004
+L0003:	ldx     #$00
+	lda     #$00
+	jeq     L0005
+L0004:	ldx     #$00
+	lda     #$01
+L0005:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	ldx     #$00
+	lda     #$0B
+	jsr     pushax
+	ldx     #$02
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$02
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$08
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldx     #$02
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$04
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test11b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test11b: near
+
+	.dbg	func, "test11b", "00", extern, "_test11b"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 23
+	ldx     #$08
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldx     #$02
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$02
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0003
+	jmp     L0003
+L0002:	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	ldx     #$00
+	lda     #$0B
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$02
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$08
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldx     #$02
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$04
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0003
+L0003:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test12a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test12a: near
+
+	.dbg	func, "test12a", "00", extern, "_test12a"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 24
+	ldx     #$F8
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$02
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$02
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FC
+	jsr     toseqeax
+	jeq     L0003
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FC
+	jsr     toseqeax
+	jne     L0004
+L0003:	ldx     #$00
+	lda     #$00
+	jeq     L0005
+L0004:	ldx     #$00
+	lda     #$01
+L0005:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	ldx     #$00
+	lda     #$0C
+	jsr     pushax
+	ldx     #$02
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$02
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$F8
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$02
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FC
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test12b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test12b: near
+
+	.dbg	func, "test12b", "00", extern, "_test12b"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 24
+	ldx     #$F8
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$02
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$02
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0003
+	jmp     L0003
+L0002:	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	ldx     #$00
+	lda     #$0C
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$02
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$F8
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$02
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FC
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0003
+L0003:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test13a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test13a: near
+
+	.dbg	func, "test13a", "00", extern, "_test13a"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 25
+	ldx     #$08
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldx     #$FE
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FE
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FC
+	jsr     toseqeax
+	jeq     L0003
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FC
+	jsr     toseqeax
+	jne     L0004
+L0003:	ldx     #$00
+	lda     #$00
+	jeq     L0005
+L0004:	ldx     #$00
+	lda     #$01
+L0005:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+	ldx     #$00
+	lda     #$0D
+	jsr     pushax
+	ldx     #$FE
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FE
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$08
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldx     #$FE
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FC
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test13b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test13b: near
+
+	.dbg	func, "test13b", "00", extern, "_test13b"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 25
+	ldx     #$08
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldx     #$FE
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FE
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0003
+	jmp     L0003
+L0002:	lda     #<(S0016)
+	ldx     #>(S0016)
+	jsr     pushax
+	ldx     #$00
+	lda     #$0D
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FE
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$08
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldx     #$FE
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FC
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0003
+L0003:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test14a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test14a: near
+
+	.dbg	func, "test14a", "00", extern, "_test14a"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 26
+	ldx     #$F8
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$FE
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FE
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$04
+	jsr     toseqeax
+	jeq     L0003
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$04
+	jsr     toseqeax
+	jne     L0004
+L0003:	ldx     #$00
+	lda     #$00
+	jeq     L0005
+L0004:	ldx     #$00
+	lda     #$01
+L0005:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S0017)
+	ldx     #>(S0017)
+	jsr     pushax
+	ldx     #$00
+	lda     #$0E
+	jsr     pushax
+	ldx     #$FE
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FE
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$F8
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$FE
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$04
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test14b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test14b: near
+
+	.dbg	func, "test14b", "00", extern, "_test14b"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 26
+	ldx     #$F8
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$FE
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FE
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0003
+	jmp     L0003
+L0002:	lda     #<(S0018)
+	ldx     #>(S0018)
+	jsr     pushax
+	ldx     #$00
+	lda     #$0E
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FE
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$F8
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$FE
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$04
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0003
+L0003:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test15a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test15a: near
+
+	.dbg	func, "test15a", "00", extern, "_test15a"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 27
+	ldx     #$02
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldx     #$08
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$08
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     toseqeax
+	jeq     L0003
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     toseqeax
+	jne     L0004
+L0003:	ldx     #$00
+	lda     #$00
+	jeq     L0005
+L0004:	ldx     #$00
+	lda     #$01
+L0005:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S0019)
+	ldx     #>(S0019)
+	jsr     pushax
+	ldx     #$00
+	lda     #$0F
+	jsr     pushax
+	ldx     #$08
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$08
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$02
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldx     #$08
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test15b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test15b: near
+
+	.dbg	func, "test15b", "00", extern, "_test15b"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 27
+	ldx     #$02
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldx     #$08
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$08
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0003
+	jmp     L0003
+L0002:	lda     #<(S001A)
+	ldx     #>(S001A)
+	jsr     pushax
+	ldx     #$00
+	lda     #$0F
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$08
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$02
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldx     #$08
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0003
+L0003:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test16a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test16a: near
+
+	.dbg	func, "test16a", "00", extern, "_test16a"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 28
+	ldx     #$FE
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$08
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$08
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     toseqeax
+	jeq     L0003
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     toseqeax
+	jne     L0004
+L0003:	ldx     #$00
+	lda     #$00
+	jeq     L0005
+L0004:	ldx     #$00
+	lda     #$01
+L0005:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S001B)
+	ldx     #>(S001B)
+	jsr     pushax
+	ldx     #$00
+	lda     #$10
+	jsr     pushax
+	ldx     #$08
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$08
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$FE
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$08
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test16b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test16b: near
+
+	.dbg	func, "test16b", "00", extern, "_test16b"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 28
+	ldx     #$FE
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$08
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$08
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0003
+	jmp     L0003
+L0002:	lda     #<(S001C)
+	ldx     #>(S001C)
+	jsr     pushax
+	ldx     #$00
+	lda     #$10
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$08
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FE
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$08
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0003
+L0003:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test17a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test17a: near
+
+	.dbg	func, "test17a", "00", extern, "_test17a"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 29
+	ldx     #$02
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldx     #$F8
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$F8
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     toseqeax
+	jeq     L0003
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     toseqeax
+	jne     L0004
+L0003:	ldx     #$00
+	lda     #$00
+	jeq     L0005
+L0004:	ldx     #$00
+	lda     #$01
+L0005:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S001D)
+	ldx     #>(S001D)
+	jsr     pushax
+	ldx     #$00
+	lda     #$11
+	jsr     pushax
+	ldx     #$F8
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$F8
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$02
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldx     #$F8
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test17b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test17b: near
+
+	.dbg	func, "test17b", "00", extern, "_test17b"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 29
+	ldx     #$02
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldx     #$F8
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$F8
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0003
+	jmp     L0003
+L0002:	lda     #<(S001E)
+	ldx     #>(S001E)
+	jsr     pushax
+	ldx     #$00
+	lda     #$11
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$F8
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$02
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldx     #$F8
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0003
+L0003:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test18a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test18a: near
+
+	.dbg	func, "test18a", "00", extern, "_test18a"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 30
+	ldx     #$FE
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$F8
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$F8
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     toseqeax
+	jeq     L0003
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     toseqeax
+	jne     L0004
+L0003:	ldx     #$00
+	lda     #$00
+	jeq     L0005
+L0004:	ldx     #$00
+	lda     #$01
+L0005:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S001F)
+	ldx     #>(S001F)
+	jsr     pushax
+	ldx     #$00
+	lda     #$12
+	jsr     pushax
+	ldx     #$F8
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$F8
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$FE
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$F8
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test18b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test18b: near
+
+	.dbg	func, "test18b", "00", extern, "_test18b"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 30
+	ldx     #$FE
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$F8
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$F8
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0003
+	jmp     L0003
+L0002:	lda     #<(S0020)
+	ldx     #>(S0020)
+	jsr     pushax
+	ldx     #$00
+	lda     #$12
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$F8
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FE
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$F8
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0003
+L0003:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test101a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test101a: near
+
+	.dbg	func, "test101a", "00", extern, "_test101a"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 33
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$7F
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     toseqeax
+	jeq     L0003
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     toseqeax
+	jne     L0004
+L0003:	ldx     #$00
+	lda     #$00
+	jeq     L0005
+L0004:	ldx     #$00
+	lda     #$01
+L0005:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S0021)
+	ldx     #>(S0021)
+	jsr     pushax
+	ldx     #$00
+	lda     #$65
+	jsr     pushax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$7F
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test101b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test101b: near
+
+	.dbg	func, "test101b", "00", extern, "_test101b"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 33
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$7F
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0003
+	jmp     L0003
+L0002:	lda     #<(S0022)
+	ldx     #>(S0022)
+	jsr     pushax
+	ldx     #$00
+	lda     #$65
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$7F
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0003
+L0003:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test102a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test102a: near
+
+	.dbg	func, "test102a", "00", extern, "_test102a"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 34
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$81
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     toseqeax
+	jeq     L0003
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     toseqeax
+	jne     L0004
+L0003:	ldx     #$00
+	lda     #$00
+	jeq     L0005
+L0004:	ldx     #$00
+	lda     #$01
+L0005:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S0023)
+	ldx     #>(S0023)
+	jsr     pushax
+	ldx     #$00
+	lda     #$66
+	jsr     pushax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$81
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test102b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test102b: near
+
+	.dbg	func, "test102b", "00", extern, "_test102b"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 34
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$81
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0003
+	jmp     L0003
+L0002:	lda     #<(S0024)
+	ldx     #>(S0024)
+	jsr     pushax
+	ldx     #$00
+	lda     #$66
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$81
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0003
+L0003:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test103a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test103a: near
+
+	.dbg	func, "test103a", "00", extern, "_test103a"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 35
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$7F
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     toseqeax
+	jeq     L0003
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     toseqeax
+	jne     L0004
+L0003:	ldx     #$00
+	lda     #$00
+	jeq     L0005
+L0004:	ldx     #$00
+	lda     #$01
+L0005:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S0025)
+	ldx     #>(S0025)
+	jsr     pushax
+	ldx     #$00
+	lda     #$67
+	jsr     pushax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$7F
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test103b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test103b: near
+
+	.dbg	func, "test103b", "00", extern, "_test103b"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 35
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$7F
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0003
+	jmp     L0003
+L0002:	lda     #<(S0026)
+	ldx     #>(S0026)
+	jsr     pushax
+	ldx     #$00
+	lda     #$67
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$7F
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0003
+L0003:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test104a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test104a: near
+
+	.dbg	func, "test104a", "00", extern, "_test104a"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 36
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$81
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     toseqeax
+	jeq     L0003
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     toseqeax
+	jne     L0004
+L0003:	ldx     #$00
+	lda     #$00
+	jeq     L0005
+L0004:	ldx     #$00
+	lda     #$01
+L0005:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S0027)
+	ldx     #>(S0027)
+	jsr     pushax
+	ldx     #$00
+	lda     #$68
+	jsr     pushax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$81
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test104b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test104b: near
+
+	.dbg	func, "test104b", "00", extern, "_test104b"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 36
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$81
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0003
+	jmp     L0003
+L0002:	lda     #<(S0028)
+	ldx     #>(S0028)
+	jsr     pushax
+	ldx     #$00
+	lda     #$68
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$81
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0003
+L0003:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test105a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test105a: near
+
+	.dbg	func, "test105a", "00", extern, "_test105a"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 37
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     toseqeax
+	jeq     L0003
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     toseqeax
+	jne     L0004
+L0003:	ldx     #$00
+	lda     #$00
+	jeq     L0005
+L0004:	ldx     #$00
+	lda     #$01
+L0005:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S0029)
+	ldx     #>(S0029)
+	jsr     pushax
+	ldx     #$00
+	lda     #$69
+	jsr     pushax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test105b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test105b: near
+
+	.dbg	func, "test105b", "00", extern, "_test105b"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 37
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0003
+	jmp     L0003
+L0002:	lda     #<(S002A)
+	ldx     #>(S002A)
+	jsr     pushax
+	ldx     #$00
+	lda     #$69
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0003
+L0003:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test106a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test106a: near
+
+	.dbg	func, "test106a", "00", extern, "_test106a"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 38
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     toseqeax
+	jeq     L0003
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     toseqeax
+	jne     L0004
+L0003:	ldx     #$00
+	lda     #$00
+	jeq     L0005
+L0004:	ldx     #$00
+	lda     #$01
+L0005:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S002B)
+	ldx     #>(S002B)
+	jsr     pushax
+	ldx     #$00
+	lda     #$6A
+	jsr     pushax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test106b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test106b: near
+
+	.dbg	func, "test106b", "00", extern, "_test106b"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 38
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0003
+	jmp     L0003
+L0002:	lda     #<(S002C)
+	ldx     #>(S002C)
+	jsr     pushax
+	ldx     #$00
+	lda     #$6A
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0003
+L0003:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test107a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test107a: near
+
+	.dbg	func, "test107a", "00", extern, "_test107a"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 39
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     toseqeax
+	jeq     L0003
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     toseqeax
+	jne     L0004
+L0003:	ldx     #$00
+	lda     #$00
+	jeq     L0005
+L0004:	ldx     #$00
+	lda     #$01
+L0005:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S002D)
+	ldx     #>(S002D)
+	jsr     pushax
+	ldx     #$00
+	lda     #$6B
+	jsr     pushax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test107b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test107b: near
+
+	.dbg	func, "test107b", "00", extern, "_test107b"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 39
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0003
+	jmp     L0003
+L0002:	lda     #<(S002E)
+	ldx     #>(S002E)
+	jsr     pushax
+	ldx     #$00
+	lda     #$6B
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0003
+L0003:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test108a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test108a: near
+
+	.dbg	func, "test108a", "00", extern, "_test108a"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 40
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     toseqeax
+	jeq     L0003
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     toseqeax
+	jne     L0004
+L0003:	ldx     #$00
+	lda     #$00
+	jeq     L0005
+L0004:	ldx     #$00
+	lda     #$01
+L0005:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S002F)
+	ldx     #>(S002F)
+	jsr     pushax
+	ldx     #$00
+	lda     #$6C
+	jsr     pushax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test108b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test108b: near
+
+	.dbg	func, "test108b", "00", extern, "_test108b"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 40
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0003
+	jmp     L0003
+L0002:	lda     #<(S0030)
+	ldx     #>(S0030)
+	jsr     pushax
+	ldx     #$00
+	lda     #$6C
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0003
+L0003:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test201a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test201a: near
+
+	.dbg	func, "test201a", "00", extern, "_test201a"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 42
+	ldx     #$7F
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldx     #$80
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$80
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     toseqeax
+	jeq     L0003
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     toseqeax
+	jne     L0004
+L0003:	ldx     #$00
+	lda     #$00
+	jeq     L0005
+L0004:	ldx     #$00
+	lda     #$01
+L0005:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S0031)
+	ldx     #>(S0031)
+	jsr     pushax
+	ldx     #$00
+	lda     #$C9
+	jsr     pushax
+	ldx     #$80
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$80
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$7F
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldx     #$80
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test201b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test201b: near
+
+	.dbg	func, "test201b", "00", extern, "_test201b"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 42
+	ldx     #$7F
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldx     #$80
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$80
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0003
+	jmp     L0003
+L0002:	lda     #<(S0032)
+	ldx     #>(S0032)
+	jsr     pushax
+	ldx     #$00
+	lda     #$C9
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$80
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$7F
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldx     #$80
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0003
+L0003:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test202a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test202a: near
+
+	.dbg	func, "test202a", "00", extern, "_test202a"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 43
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$01
+	jsr     pusheax
+	ldx     #$80
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$80
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     toseqeax
+	jeq     L0003
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     toseqeax
+	jne     L0004
+L0003:	ldx     #$00
+	lda     #$00
+	jeq     L0005
+L0004:	ldx     #$00
+	lda     #$01
+L0005:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S0033)
+	ldx     #>(S0033)
+	jsr     pushax
+	ldx     #$00
+	lda     #$CA
+	jsr     pushax
+	ldx     #$80
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$80
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$01
+	jsr     pusheax
+	ldx     #$80
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test202b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test202b: near
+
+	.dbg	func, "test202b", "00", extern, "_test202b"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 43
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$01
+	jsr     pusheax
+	ldx     #$80
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$80
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0003
+	jmp     L0003
+L0002:	lda     #<(S0034)
+	ldx     #>(S0034)
+	jsr     pushax
+	ldx     #$00
+	lda     #$CA
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$80
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$01
+	jsr     pusheax
+	ldx     #$80
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0003
+L0003:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test203a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test203a: near
+
+	.dbg	func, "test203a", "00", extern, "_test203a"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 44
+	ldx     #$7F
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     toseqeax
+	jeq     L0003
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     toseqeax
+	jne     L0004
+L0003:	ldx     #$00
+	lda     #$00
+	jeq     L0005
+L0004:	ldx     #$00
+	lda     #$01
+L0005:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S0035)
+	ldx     #>(S0035)
+	jsr     pushax
+	ldx     #$00
+	lda     #$CB
+	jsr     pushax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$7F
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test203b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test203b: near
+
+	.dbg	func, "test203b", "00", extern, "_test203b"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 44
+	ldx     #$7F
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0003
+	jmp     L0003
+L0002:	lda     #<(S0036)
+	ldx     #>(S0036)
+	jsr     pushax
+	ldx     #$00
+	lda     #$CB
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$7F
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0003
+L0003:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test204a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test204a: near
+
+	.dbg	func, "test204a", "00", extern, "_test204a"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 45
+	ldx     #$7F
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     toseqeax
+	jeq     L0003
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     toseqeax
+	jne     L0004
+L0003:	ldx     #$00
+	lda     #$00
+	jeq     L0005
+L0004:	ldx     #$00
+	lda     #$01
+L0005:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S0037)
+	ldx     #>(S0037)
+	jsr     pushax
+	ldx     #$00
+	lda     #$CC
+	jsr     pushax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$7F
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test204b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test204b: near
+
+	.dbg	func, "test204b", "00", extern, "_test204b"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 45
+	ldx     #$7F
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0003
+	jmp     L0003
+L0002:	lda     #<(S0038)
+	ldx     #>(S0038)
+	jsr     pushax
+	ldx     #$00
+	lda     #$CC
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$7F
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0003
+L0003:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test205a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test205a: near
+
+	.dbg	func, "test205a", "00", extern, "_test205a"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 46
+	ldx     #$80
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldx     #$80
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$80
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     toseqeax
+	jeq     L0003
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     toseqeax
+	jne     L0004
+L0003:	ldx     #$00
+	lda     #$00
+	jeq     L0005
+L0004:	ldx     #$00
+	lda     #$01
+L0005:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S0039)
+	ldx     #>(S0039)
+	jsr     pushax
+	ldx     #$00
+	lda     #$CD
+	jsr     pushax
+	ldx     #$80
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$80
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$80
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldx     #$80
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test205b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test205b: near
+
+	.dbg	func, "test205b", "00", extern, "_test205b"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 46
+	ldx     #$80
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldx     #$80
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$80
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0003
+	jmp     L0003
+L0002:	lda     #<(S003A)
+	ldx     #>(S003A)
+	jsr     pushax
+	ldx     #$00
+	lda     #$CD
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$80
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$80
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldx     #$80
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0003
+L0003:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test206a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test206a: near
+
+	.dbg	func, "test206a", "00", extern, "_test206a"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 47
+	ldx     #$80
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     toseqeax
+	jeq     L0003
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     toseqeax
+	jne     L0004
+L0003:	ldx     #$00
+	lda     #$00
+	jeq     L0005
+L0004:	ldx     #$00
+	lda     #$01
+L0005:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S003B)
+	ldx     #>(S003B)
+	jsr     pushax
+	ldx     #$00
+	lda     #$CE
+	jsr     pushax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$80
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test206b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test206b: near
+
+	.dbg	func, "test206b", "00", extern, "_test206b"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 47
+	ldx     #$80
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0003
+	jmp     L0003
+L0002:	lda     #<(S003C)
+	ldx     #>(S003C)
+	jsr     pushax
+	ldx     #$00
+	lda     #$CE
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$80
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0003
+L0003:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test207a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test207a: near
+
+	.dbg	func, "test207a", "00", extern, "_test207a"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 48
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$80
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$80
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     toseqeax
+	jeq     L0003
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     toseqeax
+	jne     L0004
+L0003:	ldx     #$00
+	lda     #$00
+	jeq     L0005
+L0004:	ldx     #$00
+	lda     #$01
+L0005:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S003D)
+	ldx     #>(S003D)
+	jsr     pushax
+	ldx     #$00
+	lda     #$CF
+	jsr     pushax
+	ldx     #$80
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$80
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$80
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test207b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test207b: near
+
+	.dbg	func, "test207b", "00", extern, "_test207b"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 48
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$80
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$80
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0003
+	jmp     L0003
+L0002:	lda     #<(S003E)
+	ldx     #>(S003E)
+	jsr     pushax
+	ldx     #$00
+	lda     #$CF
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$80
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$80
+	lda     #$00
+	sta     sreg
+	sta     sreg+1
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0003
+L0003:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test208a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test208a: near
+
+	.dbg	func, "test208a", "00", extern, "_test208a"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 49
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     toseqeax
+	jeq     L0003
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     toseqeax
+	jne     L0004
+L0003:	ldx     #$00
+	lda     #$00
+	jeq     L0005
+L0004:	ldx     #$00
+	lda     #$01
+L0005:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S003F)
+	ldx     #>(S003F)
+	jsr     pushax
+	ldx     #$00
+	lda     #$D0
+	jsr     pushax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test208b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test208b: near
+
+	.dbg	func, "test208b", "00", extern, "_test208b"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 49
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0003
+	jmp     L0003
+L0002:	lda     #<(S0040)
+	ldx     #>(S0040)
+	jsr     pushax
+	ldx     #$00
+	lda     #$D0
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$80
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0003
+L0003:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test401a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test401a: near
+
+	.dbg	func, "test401a", "00", extern, "_test401a"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 52
+	ldx     #$FF
+	stx     sreg
+	lda     #$7F
+	sta     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$80
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$80
+	sta     sreg+1
+	lda     #$00
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     toseqeax
+	jeq     L0003
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     toseqeax
+	jne     L0004
+L0003:	ldx     #$00
+	lda     #$00
+	jeq     L0005
+L0004:	ldx     #$00
+	lda     #$01
+L0005:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S0041)
+	ldx     #>(S0041)
+	jsr     pushax
+	ldx     #$01
+	lda     #$91
+	jsr     pushax
+	ldx     #$00
+	stx     sreg
+	lda     #$80
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$80
+	sta     sreg+1
+	lda     #$00
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	lda     #$7F
+	sta     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$80
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test401b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test401b: near
+
+	.dbg	func, "test401b", "00", extern, "_test401b"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 52
+	ldx     #$FF
+	stx     sreg
+	lda     #$7F
+	sta     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$80
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$80
+	sta     sreg+1
+	lda     #$00
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0003
+	jmp     L0003
+L0002:	lda     #<(S0042)
+	ldx     #>(S0042)
+	jsr     pushax
+	ldx     #$01
+	lda     #$91
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$80
+	sta     sreg+1
+	lda     #$00
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$FF
+	stx     sreg
+	lda     #$7F
+	sta     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$80
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0003
+L0003:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test402a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test402a: near
+
+	.dbg	func, "test402a", "00", extern, "_test402a"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 53
+	ldx     #$00
+	stx     sreg
+	lda     #$80
+	sta     sreg+1
+	lda     #$01
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$80
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$80
+	sta     sreg+1
+	lda     #$00
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     toseqeax
+	jeq     L0003
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     toseqeax
+	jne     L0004
+L0003:	ldx     #$00
+	lda     #$00
+	jeq     L0005
+L0004:	ldx     #$00
+	lda     #$01
+L0005:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S0043)
+	ldx     #>(S0043)
+	jsr     pushax
+	ldx     #$01
+	lda     #$92
+	jsr     pushax
+	ldx     #$00
+	stx     sreg
+	lda     #$80
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$80
+	sta     sreg+1
+	lda     #$00
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$80
+	sta     sreg+1
+	lda     #$01
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$80
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test402b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test402b: near
+
+	.dbg	func, "test402b", "00", extern, "_test402b"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 53
+	ldx     #$00
+	stx     sreg
+	lda     #$80
+	sta     sreg+1
+	lda     #$01
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$80
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$80
+	sta     sreg+1
+	lda     #$00
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0003
+	jmp     L0003
+L0002:	lda     #<(S0044)
+	ldx     #>(S0044)
+	jsr     pushax
+	ldx     #$01
+	lda     #$92
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$80
+	sta     sreg+1
+	lda     #$00
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$80
+	sta     sreg+1
+	lda     #$01
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$80
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0003
+L0003:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test403a (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test403a: near
+
+	.dbg	func, "test403a", "00", extern, "_test403a"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 54
+	ldx     #$00
+	stx     sreg
+	lda     #$80
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$80
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$80
+	sta     sreg+1
+	lda     #$00
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     toseqeax
+	jeq     L0003
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     toseqeax
+	jne     L0004
+L0003:	ldx     #$00
+	lda     #$00
+	jeq     L0005
+L0004:	ldx     #$00
+	lda     #$01
+L0005:	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	jmp     L0006
+L0002:	lda     #<(S0045)
+	ldx     #>(S0045)
+	jsr     pushax
+	ldx     #$01
+	lda     #$93
+	jsr     pushax
+	ldx     #$00
+	stx     sreg
+	lda     #$80
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$80
+	sta     sreg+1
+	lda     #$00
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$80
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$80
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     pusheax
+	ldy     #$1C
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+L0006:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ test403b (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test403b: near
+
+	.dbg	func, "test403b", "00", extern, "_test403b"
+	.dbg	sym, "a", "00", auto, -4
+	.dbg	sym, "b", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 54
+	ldx     #$00
+	stx     sreg
+	lda     #$80
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$80
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$80
+	sta     sreg+1
+	lda     #$00
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     toseqeax
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0003
+	jmp     L0003
+L0002:	lda     #<(S0046)
+	ldx     #>(S0046)
+	jsr     pushax
+	ldx     #$01
+	lda     #$93
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$80
+	sta     sreg+1
+	lda     #$00
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0F
+	jsr     ldeaxysp
+	jsr     tosdiveax
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$13
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$80
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	lda     #$80
+	sta     sreg+1
+	lda     #$00
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     pusheax
+	ldy     #$20
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0003
+L0003:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "div-long-long.c", 59
+	jsr     _test1a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 60
+	jsr     _test2a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 61
+	jsr     _test3a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 62
+	jsr     _test4a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 63
+	jsr     _test5a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 64
+	jsr     _test6a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 65
+	jsr     _test7a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 66
+	jsr     _test8a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 68
+	jsr     _test11a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 69
+	jsr     _test12a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 70
+	jsr     _test13a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 71
+	jsr     _test14a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 72
+	jsr     _test15a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 73
+	jsr     _test16a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 74
+	jsr     _test17a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 75
+	jsr     _test18a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 77
+	jsr     _test101a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 78
+	jsr     _test102a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 79
+	jsr     _test103a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 80
+	jsr     _test104a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 81
+	jsr     _test105a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 82
+	jsr     _test106a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 83
+	jsr     _test107a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 84
+	jsr     _test108a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 86
+	jsr     _test201a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 87
+	jsr     _test202a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 88
+	jsr     _test203a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 89
+	jsr     _test204a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 90
+	jsr     _test205a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 91
+	jsr     _test206a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 92
+	jsr     _test207a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 93
+	jsr     _test208a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 95
+	jsr     _test401a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 96
+	jsr     _test402a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 97
+	jsr     _test403a
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 100
+	jsr     _test1b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 101
+	jsr     _test2b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 102
+	jsr     _test3b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 103
+	jsr     _test4b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 104
+	jsr     _test5b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 105
+	jsr     _test6b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 106
+	jsr     _test7b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 107
+	jsr     _test8b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 109
+	jsr     _test11b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 110
+	jsr     _test12b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 111
+	jsr     _test13b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 112
+	jsr     _test14b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 113
+	jsr     _test15b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 114
+	jsr     _test16b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 115
+	jsr     _test17b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 116
+	jsr     _test18b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 118
+	jsr     _test101b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 119
+	jsr     _test102b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 120
+	jsr     _test103b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 121
+	jsr     _test104b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 122
+	jsr     _test105b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 123
+	jsr     _test106b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 124
+	jsr     _test107b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 125
+	jsr     _test108b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 127
+	jsr     _test201b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 128
+	jsr     _test202b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 129
+	jsr     _test203b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 130
+	jsr     _test204b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 131
+	jsr     _test205b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 132
+	jsr     _test206b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 133
+	jsr     _test207b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 134
+	jsr     _test208b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 136
+	jsr     _test401b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 137
+	jsr     _test402b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 138
+	jsr     _test403b
+	clc
+	adc     _res
+	sta     _res
+	txa
+	adc     _res+1
+	sta     _res+1
+	tax
+	lda     _res
+	.dbg	line, "div-long-long.c", 140
+	lda     _res
+	ldx     _res+1
+	jmp     L0001
+	.dbg	line, "div-long-long.c", 141
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,501 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_success
+	.export		_failures
+	.export		_dummy
+	.export		_done
+	.export		_acmp
+	.export		_duffit
+	.export		_main
+
+.segment	"DATA"
+
+_success:
+	.byte	$00
+_failures:
+	.byte	$00
+_dummy:
+	.byte	$00
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ done (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_done: near
+
+.segment	"CODE"
+
+	inc     _dummy
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ acmp (char *a, char *b, int count)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_acmp: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp2
+	lda     #$00
+	sta     (sp)
+	ldy     #$01
+	sta     (sp),y
+	bra     L0008
+L0005:	ldy     #$06
+	lda     (sp),y
+	clc
+	adc     (sp)
+	sta     ptr1
+	iny
+	lda     (sp),y
+	ldy     #$01
+	adc     (sp),y
+	sta     ptr1+1
+	lda     (ptr1)
+	sta     sreg
+	ldy     #$04
+	lda     (sp),y
+	clc
+	adc     (sp)
+	sta     ptr1
+	iny
+	lda     (sp),y
+	ldy     #$01
+	adc     (sp),y
+	sta     ptr1+1
+	lda     (ptr1)
+	cmp     sreg
+	beq     L0006
+	ldx     #$00
+	tya
+	bra     L0001
+L0006:	ldx     #$00
+	tya
+	jsr     addeq0sp
+	ldy     #$01
+L0008:	lda     (sp),y
+	tax
+	lda     (sp)
+	iny
+	cmp     (sp),y
+	txa
+	iny
+	sbc     (sp),y
+	bvc     L0007
+	eor     #$80
+L0007:	bmi     L0005
+	ldx     #$00
+	txa
+L0001:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ duffit (char *to, char *from, int count)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_duffit: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	clc
+	adc     #$07
+	bcc     L0002
+	inx
+L0002:	cpx     #$00
+	bpl     L0003
+	sta     regsave
+	stx     regsave+1
+	cpx     #$FF
+	bne     L0005
+	cmp     #$F9
+L0005:	jsr     boolult
+	lsr     a
+	lda     regsave
+	ldx     regsave+1
+	bcs     L0003
+	ldx     #$00
+	txa
+	bra     L0004
+L0003:	jsr     asrax3
+L0004:	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$00
+	ldx     #$00
+	lda     #$08
+	jsr     tosmoda0
+	cpx     #$00
+	jne     L0007
+	cmp     #$04
+	bcs     L0015
+	cmp     #$02
+	bcs     L0016
+	cmp     #$00
+	beq     L0008
+	jmp     L0012
+L0016:	jeq     L0011
+	jmp     L0010
+L0015:	cmp     #$06
+	bcs     L0017
+	cmp     #$04
+	jeq     L000F
+	jmp     L000E
+L0017:	beq     L000D
+	cmp     #$07
+	beq     L000C
+	jmp     L0007
+L0008:	ldy     #$07
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	dey
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	lda     (ptr1)
+	sta     (sreg)
+	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L000C:	ldy     #$07
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	dey
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	lda     (ptr1)
+	sta     (sreg)
+	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L000D:	ldy     #$07
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	dey
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	lda     (ptr1)
+	sta     (sreg)
+	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L000E:	ldy     #$07
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	dey
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	lda     (ptr1)
+	sta     (sreg)
+	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L000F:	ldy     #$07
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	dey
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	lda     (ptr1)
+	sta     (sreg)
+	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L0010:	ldy     #$07
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	dey
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	lda     (ptr1)
+	sta     (sreg)
+	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L0011:	ldy     #$07
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	dey
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	lda     (ptr1)
+	sta     (sreg)
+	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L0012:	ldy     #$07
+	lda     (sp),y
+	sta     sreg+1
+	dey
+	lda     (sp),y
+	sta     sreg
+	dey
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	lda     (ptr1)
+	sta     (sreg)
+	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldx     #$00
+	lda     #$01
+	jsr     subeq0sp
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvs     L0013
+	eor     #$80
+L0013:	jmi     L0008
+L0007:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	ldy     #$64
+	jsr     subysp
+	ldy     #$63
+L0002:	lda     M0001,y
+	sta     (sp),y
+	dey
+	bpl     L0002
+	ldy     #$64
+	jsr     subysp
+	ldy     #$63
+L0003:	lda     M0002,y
+	sta     (sp),y
+	dey
+	bpl     L0003
+	jsr     decsp4
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$68
+	bcc     L0005
+	inx
+L0005:	ldy     #$02
+	sta     (sp),y
+	iny
+	txa
+	sta     (sp),y
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$04
+	bcc     L0006
+	inx
+L0006:	sta     (sp)
+	ldy     #$01
+	txa
+	sta     (sp),y
+	ldx     #$00
+	lda     #$64
+	jsr     _acmp
+	stx     tmp1
+	ora     tmp1
+	bne     L0004
+	inc     _failures
+L0004:	jsr     decsp4
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$68
+	bcc     L0007
+	inx
+L0007:	ldy     #$02
+	sta     (sp),y
+	iny
+	txa
+	sta     (sp),y
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$04
+	bcc     L0008
+	inx
+L0008:	sta     (sp)
+	ldy     #$01
+	txa
+	sta     (sp),y
+	ldx     #$00
+	lda     #$64
+	jsr     _duffit
+	jsr     decsp4
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$68
+	bcc     L000A
+	inx
+L000A:	ldy     #$02
+	sta     (sp),y
+	iny
+	txa
+	sta     (sp),y
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$04
+	bcc     L000B
+	inx
+L000B:	sta     (sp)
+	ldy     #$01
+	txa
+	sta     (sp),y
+	ldx     #$00
+	lda     #$64
+	jsr     _acmp
+	stx     tmp1
+	ora     tmp1
+	beq     L0009
+	inc     _failures
+L0009:	lda     _failures
+	sta     _success
+	jsr     _done
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     _failures
+	ldy     #$C8
+	jmp     addysp
+
+.segment	"RODATA"
+
+M0001:
+	.byte	$01
+	.res	99,$00
+M0002:
+	.byte	$02
+	.res	99,$00
+
+.endproc
+
@@ -0,0 +1,472 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "duffs-device.c", 1263, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/limits.h", 3146, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_success
+	.export		_failures
+	.export		_dummy
+	.export		_done
+	.export		_acmp
+	.export		_duffit
+	.export		_main
+
+.segment	"DATA"
+
+_success:
+	.byte	$00
+_failures:
+	.byte	$00
+_dummy:
+	.byte	$00
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ done (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_done: near
+
+	.dbg	func, "done", "00", extern, "_done"
+
+.segment	"CODE"
+
+	.dbg	line, "duffs-device.c", 22
+	ldx     #$00
+	lda     _dummy
+	inc     _dummy
+	.dbg	line, "duffs-device.c", 23
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ acmp (char *a, char *b, int count)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_acmp: near
+
+	.dbg	func, "acmp", "00", extern, "_acmp"
+	.dbg	sym, "a", "00", auto, 4
+	.dbg	sym, "b", "00", auto, 2
+	.dbg	sym, "count", "00", auto, 0
+	.dbg	sym, "i", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "duffs-device.c", 26
+	jsr     pushax
+	.dbg	line, "duffs-device.c", 29
+	jsr     decsp2
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+	jmp     L0002
+	.dbg	line, "duffs-device.c", 30
+L0005:	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosaddax
+	ldy     #$00
+	jsr     ldauidx
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosaddax
+	ldy     #$00
+	jsr     ldauidx
+	jsr     tosneax
+	jeq     L0006
+	.dbg	line, "duffs-device.c", 31
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+	.dbg	line, "duffs-device.c", 29
+L0006:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosltax
+	jne     L0005
+	.dbg	line, "duffs-device.c", 34
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "duffs-device.c", 35
+L0001:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ duffit (char *to, char *from, int count)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_duffit: near
+
+	.dbg	func, "duffit", "00", extern, "_duffit"
+	.dbg	sym, "to", "00", auto, 4
+	.dbg	sym, "from", "00", auto, 2
+	.dbg	sym, "count", "00", auto, 0
+	.dbg	sym, "n", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "duffs-device.c", 38
+	jsr     pushax
+	.dbg	line, "duffs-device.c", 39
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     incax7
+	jsr     pushax
+	ldx     #$00
+	lda     #$08
+	jsr     tosdivax
+	jsr     pushax
+	.dbg	line, "duffs-device.c", 41
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldx     #$00
+	lda     #$08
+	jsr     tosmodax
+	jmp     L0002
+	.dbg	line, "duffs-device.c", 51
+L0002:	cpx     #$00
+	jne     L0010
+	cmp     #$04
+	jcs     L0011
+	cmp     #$00
+	jeq     L0004
+	cmp     #$01
+	jeq     L000E
+	cmp     #$02
+	jeq     L000D
+	jmp     L000C
+L0011:	jeq     L000B
+	cmp     #$05
+	jeq     L000A
+	cmp     #$06
+	jeq     L0009
+	cmp     #$07
+	jeq     L0008
+	jmp     L0003
+L0010:	jmp     L0003
+	.dbg	line, "duffs-device.c", 42
+L0004:	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$00
+	jsr     staspidx
+	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	.dbg	line, "duffs-device.c", 43
+L0008:	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$00
+	jsr     staspidx
+	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	.dbg	line, "duffs-device.c", 44
+L0009:	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$00
+	jsr     staspidx
+	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	.dbg	line, "duffs-device.c", 45
+L000A:	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$00
+	jsr     staspidx
+	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	.dbg	line, "duffs-device.c", 46
+L000B:	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$00
+	jsr     staspidx
+	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	.dbg	line, "duffs-device.c", 47
+L000C:	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$00
+	jsr     staspidx
+	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	.dbg	line, "duffs-device.c", 48
+L000D:	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$00
+	jsr     staspidx
+	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	.dbg	line, "duffs-device.c", 49
+L000E:	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	ldy     #$00
+	jsr     staspidx
+	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	.dbg	line, "duffs-device.c", 50
+	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	jsr     subeqysp
+	cmp     #$01
+	txa
+	sbc     #$00
+	bvs     L000F
+	eor     #$80
+L000F:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0004
+	.dbg	line, "duffs-device.c", 51
+	jmp     L0003
+	.dbg	line, "duffs-device.c", 52
+L0003:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+	.dbg	sym, "a", "00", auto, -100
+	.dbg	sym, "b", "00", auto, -200
+
+.segment	"CODE"
+
+	.dbg	line, "duffs-device.c", 56
+	ldy     #$64
+	jsr     subysp
+	ldy     #$63
+L0002:	lda     M0001,y
+	sta     (sp),y
+	dey
+	bpl     L0002
+	.dbg	line, "duffs-device.c", 57
+	ldy     #$64
+	jsr     subysp
+	ldy     #$63
+L0003:	lda     M0002,y
+	sta     (sp),y
+	dey
+	bpl     L0003
+	.dbg	line, "duffs-device.c", 60
+	lda     #$64
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$02
+	jsr     leaa0sp
+	jsr     pushax
+	ldx     #$00
+	lda     #$64
+	jsr     _acmp
+	jsr     bnegax
+	jeq     L0004
+	.dbg	line, "duffs-device.c", 61
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "duffs-device.c", 64
+L0004:	lda     #$64
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$02
+	jsr     leaa0sp
+	jsr     pushax
+	ldx     #$00
+	lda     #$64
+	jsr     _duffit
+	.dbg	line, "duffs-device.c", 67
+	lda     #$64
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$02
+	jsr     leaa0sp
+	jsr     pushax
+	ldx     #$00
+	lda     #$64
+	jsr     _acmp
+	stx     tmp1
+	ora     tmp1
+	jeq     L0005
+	.dbg	line, "duffs-device.c", 68
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "duffs-device.c", 71
+L0005:	ldx     #$00
+	lda     _failures
+	sta     _success
+	.dbg	line, "duffs-device.c", 72
+	jsr     _done
+	.dbg	line, "duffs-device.c", 73
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "duffs-device.c", 75
+	ldx     #$00
+	lda     _failures
+	jmp     L0001
+	.dbg	line, "duffs-device.c", 76
+L0001:	ldy     #$C8
+	jsr     addysp
+	rts
+
+	.dbg	line
+.segment	"RODATA"
+
+M0001:
+	.byte	$01
+	.res	99,$00
+M0002:
+	.byte	$02
+	.res	99,$00
+
+.endproc
+
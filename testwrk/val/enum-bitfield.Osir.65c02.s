@@ -0,0 +1,816 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+_e10ubf:
+	.byte	$90
+	.byte	$01
+	.byte	$E8
+	.byte	$03
+_e11ibf:
+	.byte	$93
+	.byte	$01
+	.byte	$E8
+	.byte	$03
+_e7ucbf:
+	.byte	$14
+	.byte	$64
+_e8scbf:
+	.byte	$0A
+	.byte	$64
+
+.segment	"RODATA"
+
+S0011:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$28,$73,$74,$72,$75,$63
+	.byte	$74,$20,$65,$6E,$75,$6D,$5F,$62,$69,$74,$66,$69,$65,$6C,$64,$5F
+	.byte	$75,$63,$68,$61,$72,$29,$20,$3D,$20,$25,$7A,$75,$2C,$20,$65,$78
+	.byte	$70,$65,$63,$74,$65,$64,$20,$32,$2E,$0A,$00
+S0018:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$28,$73,$74,$72,$75,$63
+	.byte	$74,$20,$65,$6E,$75,$6D,$5F,$62,$69,$74,$66,$69,$65,$6C,$64,$5F
+	.byte	$63,$68,$61,$72,$29,$20,$3D,$20,$25,$7A,$75,$2C,$20,$65,$78,$70
+	.byte	$65,$63,$74,$65,$64,$20,$32,$2E,$0A,$00
+S0001:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$28,$73,$74,$72,$75,$63
+	.byte	$74,$20,$65,$6E,$75,$6D,$5F,$62,$69,$74,$66,$69,$65,$6C,$64,$5F
+	.byte	$75,$69,$6E,$74,$29,$20,$3D,$20,$25,$7A,$75,$2C,$20,$65,$78,$70
+	.byte	$65,$63,$74,$65,$64,$20,$34,$2E,$0A,$00
+S0009:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$28,$73,$74,$72,$75,$63
+	.byte	$74,$20,$65,$6E,$75,$6D,$5F,$62,$69,$74,$66,$69,$65,$6C,$64,$5F
+	.byte	$69,$6E,$74,$29,$20,$3D,$20,$25,$7A,$75,$2C,$20,$65,$78,$70,$65
+	.byte	$63,$74,$65,$64,$20,$34,$2E,$0A,$00
+S0006:
+	.byte	$47,$6F,$74,$20,$6E,$65,$67,$61,$74,$69,$76,$65,$20,$76,$20,$3D
+	.byte	$20,$25,$6C,$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$6C
+	.byte	$61,$72,$67,$65,$20,$70,$6F,$73,$69,$74,$69,$76,$65,$2E,$0A,$00
+S000E:
+	.byte	$47,$6F,$74,$20,$70,$6F,$73,$69,$74,$69,$76,$65,$20,$76,$20,$3D
+	.byte	$20,$25,$6C,$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$6E
+	.byte	$65,$67,$61,$74,$69,$76,$65,$2E,$0A,$00
+S0008:
+	.byte	$47,$6F,$74,$20,$65,$31,$30,$75,$62,$66,$2E,$7A,$20,$3D,$20,$25
+	.byte	$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$32,$33
+	.byte	$2E,$0A,$00
+S0010:
+	.byte	$47,$6F,$74,$20,$65,$31,$31,$69,$62,$66,$2E,$7A,$20,$3D,$20,$25
+	.byte	$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$32,$33
+	.byte	$2E,$0A,$00
+S000C:
+	.byte	$47,$6F,$74,$20,$65,$31,$31,$69,$62,$66,$2E,$7A,$20,$3D,$20,$25
+	.byte	$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$30,$30
+	.byte	$2E,$0A,$00
+S0004:
+	.byte	$47,$6F,$74,$20,$65,$31,$30,$75,$62,$66,$2E,$7A,$20,$3D,$20,$25
+	.byte	$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$30,$30
+	.byte	$2E,$0A,$00
+S001E:
+	.byte	$47,$6F,$74,$20,$65,$38,$73,$63,$62,$66,$2E,$7A,$20,$3D,$20,$25
+	.byte	$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$32,$37,$2E
+	.byte	$0A,$00
+S001B:
+	.byte	$47,$6F,$74,$20,$65,$38,$73,$63,$62,$66,$2E,$7A,$20,$3D,$20,$25
+	.byte	$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$30,$2E
+	.byte	$0A,$00
+S0017:
+	.byte	$47,$6F,$74,$20,$65,$37,$75,$63,$62,$66,$2E,$7A,$20,$3D,$20,$25
+	.byte	$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$32,$37,$2E
+	.byte	$0A,$00
+S0014:
+	.byte	$47,$6F,$74,$20,$65,$37,$75,$63,$62,$66,$2E,$7A,$20,$3D,$20,$25
+	.byte	$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$30,$2E
+	.byte	$0A,$00
+S0003:
+	.byte	$47,$6F,$74,$20,$65,$31,$30,$75,$62,$66,$2E,$79,$20,$3D,$20,$25
+	.byte	$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$32,$30,$30,$2E
+	.byte	$0A,$00
+S000B:
+	.byte	$47,$6F,$74,$20,$65,$31,$31,$69,$62,$66,$2E,$79,$20,$3D,$20,$25
+	.byte	$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$30,$2E
+	.byte	$0A,$00
+S001D:
+	.byte	$47,$6F,$74,$20,$65,$38,$73,$63,$62,$66,$2E,$79,$20,$3D,$20,$25
+	.byte	$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$33,$2E,$0A
+	.byte	$00
+S0013:
+	.byte	$47,$6F,$74,$20,$65,$37,$75,$63,$62,$66,$2E,$79,$20,$3D,$20,$25
+	.byte	$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$2E,$0A
+	.byte	$00
+S000F:
+	.byte	$47,$6F,$74,$20,$65,$31,$31,$69,$62,$66,$2E,$79,$20,$3D,$20,$25
+	.byte	$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$37,$2E,$0A
+	.byte	$00
+S001C:
+	.byte	$47,$6F,$74,$20,$65,$38,$73,$63,$62,$66,$2E,$78,$20,$3D,$20,$25
+	.byte	$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$31,$2E,$0A
+	.byte	$00
+S0016:
+	.byte	$47,$6F,$74,$20,$65,$37,$75,$63,$62,$66,$2E,$79,$20,$3D,$20,$25
+	.byte	$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$35,$2E,$0A
+	.byte	$00
+S0007:
+	.byte	$47,$6F,$74,$20,$65,$31,$30,$75,$62,$66,$2E,$79,$20,$3D,$20,$25
+	.byte	$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$37,$2E,$0A
+	.byte	$00
+S001A:
+	.byte	$47,$6F,$74,$20,$65,$38,$73,$63,$62,$66,$2E,$79,$20,$3D,$20,$25
+	.byte	$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$2E,$0A
+	.byte	$00
+S000A:
+	.byte	$47,$6F,$74,$20,$65,$31,$31,$69,$62,$66,$2E,$78,$20,$3D,$20,$25
+	.byte	$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$31,$2E,$0A
+	.byte	$00
+S0002:
+	.byte	$47,$6F,$74,$20,$65,$31,$30,$75,$62,$66,$2E,$78,$20,$3D,$20,$25
+	.byte	$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$30,$2E,$0A,$00
+S000D:
+	.byte	$47,$6F,$74,$20,$65,$31,$31,$69,$62,$66,$2E,$78,$20,$3D,$20,$25
+	.byte	$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A,$00
+S0015:
+	.byte	$47,$6F,$74,$20,$65,$37,$75,$63,$62,$66,$2E,$78,$20,$3D,$20,$25
+	.byte	$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A,$00
+S0012:
+	.byte	$47,$6F,$74,$20,$65,$37,$75,$63,$62,$66,$2E,$78,$20,$3D,$20,$25
+	.byte	$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$30,$2E,$0A,$00
+S0019:
+	.byte	$47,$6F,$74,$20,$65,$38,$73,$63,$62,$66,$2E,$78,$20,$3D,$20,$25
+	.byte	$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$30,$2E,$0A,$00
+S0005:
+	.byte	$47,$6F,$74,$20,$65,$31,$30,$75,$62,$66,$2E,$78,$20,$3D,$20,$25
+	.byte	$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A,$00
+S001F:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ test_enum_bitfield_uint (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_enum_bitfield_uint: near
+
+.segment	"CODE"
+
+	lda     _e10ubf
+	and     #$01
+	beq     L0003
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     _e10ubf
+	and     #$01
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0003:	lda     _e10ubf
+	ldx     _e10ubf+1
+	jsr     shrax1
+	cmp     #$C8
+	beq     L0005
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     _e10ubf
+	ldx     _e10ubf+1
+	jsr     shrax1
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0005:	lda     _e10ubf+2+1
+	cmp     #$03
+	bne     L0012
+	lda     _e10ubf+2
+	cmp     #$E8
+	beq     L0011
+L0012:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     _e10ubf+2
+	ldx     _e10ubf+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0011:	lda     _e10ubf
+	ora     #$01
+	sta     _e10ubf
+	tay
+	lda     #$01
+	trb     _e10ubf+1
+	tya
+	and     #$01
+	ora     #$22
+	sta     _e10ubf
+	lda     #$FF
+	sta     _e10ubf+2
+	ldx     #$03
+	stx     _e10ubf+2+1
+	lda     _e10ubf
+	and     #$01
+	cmp     #$01
+	beq     L0009
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     _e10ubf
+	and     #$01
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0009:	lda     _e10ubf
+	ldx     #$00
+	and     #$01
+	sec
+	sbc     #$02
+	bcs     L000B
+	dex
+L000B:	jsr     push0ax
+	jsr     ldeax0sp
+	lda     sreg+1
+	asl     a
+	bcc     L000C
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+	inc     _failures
+L000C:	jsr     incsp4
+	lda     _e10ubf
+	ldx     _e10ubf+1
+	jsr     shrax1
+	cmp     #$11
+	beq     L000D
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	lda     _e10ubf
+	ldx     _e10ubf+1
+	jsr     shrax1
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L000D:	lda     _e10ubf+2+1
+	cmp     #$03
+	bne     L0013
+	lda     _e10ubf+2
+	cmp     #$FF
+	beq     L000F
+L0013:	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	lda     _e10ubf+2
+	ldx     _e10ubf+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L000F:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_enum_bitfield_int (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_enum_bitfield_int: near
+
+.segment	"CODE"
+
+	lda     _e11ibf
+	tay
+	and     #$02
+	beq     L0004
+	tya
+	ora     #$FC
+	ldx     #$FF
+	bra     L0005
+L0004:	tya
+	ldx     #$00
+	and     #$03
+L0005:	cpx     #$FF
+	bne     L0023
+	cmp     #$FF
+	beq     L0003
+L0023:	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	lda     _e11ibf
+	tay
+	and     #$02
+	beq     L0007
+	tya
+	ora     #$FC
+	ldx     #$FF
+	bra     L0008
+L0007:	tya
+	ldx     #$00
+	and     #$03
+L0008:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0003:	lda     _e11ibf
+	ldx     _e11ibf+1
+	jsr     shrax2
+	tay
+	and     #$80
+	beq     L000A
+	tya
+	ldx     #$FF
+	bra     L000B
+L000A:	tya
+	ldx     #$00
+L000B:	cpx     #$00
+	bne     L0024
+	cmp     #$64
+	beq     L0009
+L0024:	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	lda     _e11ibf
+	ldx     _e11ibf+1
+	jsr     shrax2
+	tay
+	and     #$80
+	beq     L000D
+	tya
+	ldx     #$FF
+	bra     L000E
+L000D:	tya
+	ldx     #$00
+L000E:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0009:	lda     _e11ibf+2+1
+	cmp     #$03
+	bne     L0025
+	lda     _e11ibf+2
+	cmp     #$E8
+	beq     L000F
+L0025:	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	lda     _e11ibf+2
+	ldx     _e11ibf+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L000F:	lda     _e11ibf
+	and     #$FC
+	ora     #$01
+	sta     _e11ibf
+	tay
+	lda     #$03
+	trb     _e11ibf+1
+	tya
+	and     #$03
+	ora     #$44
+	sta     _e11ibf
+	lda     #$FF
+	sta     _e11ibf+2
+	ldx     #$03
+	stx     _e11ibf+2+1
+	lda     _e11ibf
+	tay
+	and     #$02
+	beq     L0012
+	tya
+	ora     #$FC
+	ldx     #$FF
+	bra     L0013
+L0012:	tya
+	ldx     #$00
+	and     #$03
+L0013:	cpx     #$00
+	bne     L0026
+	cmp     #$01
+	beq     L0011
+L0026:	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	lda     _e11ibf
+	tay
+	and     #$02
+	beq     L0015
+	tya
+	ora     #$FC
+	ldx     #$FF
+	bra     L0016
+L0015:	tya
+	ldx     #$00
+	and     #$03
+L0016:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0011:	lda     _e11ibf
+	tay
+	and     #$02
+	beq     L0017
+	tya
+	ora     #$FC
+	ldx     #$FF
+	bra     L0018
+L0017:	tya
+	ldx     #$00
+	and     #$03
+L0018:	sec
+	sbc     #$02
+	bcs     L0019
+	dex
+L0019:	jsr     axlong
+	jsr     pusheax
+	jsr     ldeax0sp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$01
+	jsr     tosgeeax
+	beq     L001A
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+	inc     _failures
+L001A:	jsr     incsp4
+	lda     _e11ibf
+	ldx     _e11ibf+1
+	jsr     shrax2
+	tay
+	and     #$80
+	beq     L001C
+	tya
+	ldx     #$FF
+	bra     L001D
+L001C:	tya
+	ldx     #$00
+L001D:	cpx     #$00
+	bne     L0027
+	cmp     #$11
+	beq     L001B
+L0027:	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	lda     _e11ibf
+	ldx     _e11ibf+1
+	jsr     shrax2
+	tay
+	and     #$80
+	beq     L001F
+	tya
+	ldx     #$FF
+	bra     L0020
+L001F:	tya
+	ldx     #$00
+L0020:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L001B:	lda     _e11ibf+2+1
+	cmp     #$03
+	bne     L0028
+	lda     _e11ibf+2
+	cmp     #$FF
+	beq     L0021
+L0028:	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	lda     _e11ibf+2
+	ldx     _e11ibf+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0021:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_enum_bitfield_uchar (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_enum_bitfield_uchar: near
+
+.segment	"CODE"
+
+	lda     _e7ucbf
+	and     #$01
+	beq     L0003
+	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	lda     _e7ucbf
+	and     #$01
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0003:	lda     _e7ucbf
+	lsr     a
+	and     #$0F
+	cmp     #$0A
+	beq     L0009
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	lda     _e7ucbf
+	lsr     a
+	and     #$0F
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0009:	lda     _e7ucbf+1
+	cmp     #$64
+	beq     L000A
+	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	lda     _e7ucbf+1
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L000A:	lda     _e7ucbf
+	ora     #$01
+	sta     _e7ucbf
+	ora     #$1E
+	sta     _e7ucbf
+	lda     #$7F
+	sta     _e7ucbf+1
+	lda     _e7ucbf
+	and     #$01
+	cmp     #$01
+	beq     L0006
+	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+	lda     _e7ucbf
+	and     #$01
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0006:	lda     _e7ucbf
+	lsr     a
+	and     #$0F
+	cmp     #$0F
+	beq     L000B
+	lda     #<(S0016)
+	ldx     #>(S0016)
+	jsr     pushax
+	lda     _e7ucbf
+	lsr     a
+	and     #$0F
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L000B:	lda     _e7ucbf+1
+	cmp     #$7F
+	beq     L0008
+	lda     #<(S0017)
+	ldx     #>(S0017)
+	jsr     pushax
+	lda     _e7ucbf+1
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0008:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_enum_bitfield_char (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_enum_bitfield_char: near
+
+.segment	"CODE"
+
+	lda     _e8scbf
+	tay
+	and     #$01
+	beq     L0004
+	tya
+	ora     #$FE
+	bra     L0005
+L0004:	tya
+	and     #$01
+L0005:	cmp     #$00
+	beq     L0003
+	lda     #<(S0019)
+	ldx     #>(S0019)
+	jsr     pushax
+	lda     _e8scbf
+	tay
+	and     #$01
+	beq     L0006
+	tya
+	ora     #$FE
+	ldx     #$FF
+	bra     L0007
+L0006:	tya
+	ldx     #$00
+	and     #$01
+L0007:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0003:	lda     _e8scbf
+	lsr     a
+	tay
+	and     #$08
+	beq     L0009
+	tya
+	ora     #$F0
+	bra     L000A
+L0009:	tya
+	and     #$0F
+L000A:	cmp     #$05
+	beq     L0008
+	lda     #<(S001A)
+	ldx     #>(S001A)
+	jsr     pushax
+	lda     _e8scbf
+	lsr     a
+	tay
+	and     #$08
+	beq     L000B
+	tya
+	ora     #$F0
+	ldx     #$FF
+	bra     L000C
+L000B:	tya
+	ldx     #$00
+	and     #$0F
+L000C:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0008:	lda     _e8scbf+1
+	cmp     #$64
+	beq     L000D
+	lda     #<(S001B)
+	ldx     #>(S001B)
+	jsr     pushax
+	ldx     #$00
+	lda     _e8scbf+1
+	bpl     L000F
+	dex
+L000F:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L000D:	lda     _e8scbf
+	ora     #$01
+	sta     _e8scbf
+	and     #$E1
+	ora     #$1A
+	sta     _e8scbf
+	lda     #$7F
+	sta     _e8scbf+1
+	lda     _e8scbf
+	tay
+	and     #$01
+	beq     L0011
+	tya
+	ora     #$FE
+	bra     L0012
+L0011:	tya
+	and     #$01
+L0012:	cmp     #$FF
+	beq     L0010
+	lda     #<(S001C)
+	ldx     #>(S001C)
+	jsr     pushax
+	lda     _e8scbf
+	tay
+	and     #$01
+	beq     L0013
+	tya
+	ora     #$FE
+	ldx     #$FF
+	bra     L0014
+L0013:	tya
+	ldx     #$00
+	and     #$01
+L0014:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0010:	lda     _e8scbf
+	lsr     a
+	tay
+	and     #$08
+	beq     L0016
+	tya
+	ora     #$F0
+	bra     L0017
+L0016:	tya
+	and     #$0F
+L0017:	cmp     #$FD
+	beq     L0015
+	lda     #<(S001D)
+	ldx     #>(S001D)
+	jsr     pushax
+	lda     _e8scbf
+	lsr     a
+	tay
+	and     #$08
+	beq     L0018
+	tya
+	ora     #$F0
+	ldx     #$FF
+	bra     L0019
+L0018:	tya
+	ldx     #$00
+	and     #$0F
+L0019:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0015:	lda     _e8scbf+1
+	cmp     #$7F
+	beq     L001A
+	lda     #<(S001E)
+	ldx     #>(S001E)
+	jsr     pushax
+	ldx     #$00
+	lda     _e8scbf+1
+	bpl     L001C
+	dex
+L001C:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L001A:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     _test_enum_bitfield_uint
+	jsr     _test_enum_bitfield_int
+	jsr     _test_enum_bitfield_uchar
+	jsr     _test_enum_bitfield_char
+	lda     #<(S001F)
+	ldx     #>(S001F)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     _failures
+	rts
+
+.endproc
+
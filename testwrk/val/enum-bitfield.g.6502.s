@@ -0,0 +1,1169 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "enum-bitfield.c", 6872, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+_e10ubf:
+	.byte	$90
+	.byte	$01
+	.byte	$E8
+	.byte	$03
+_e11ibf:
+	.byte	$93
+	.byte	$01
+	.byte	$E8
+	.byte	$03
+_e7ucbf:
+	.byte	$14
+	.byte	$64
+_e8scbf:
+	.byte	$0A
+	.byte	$64
+
+.segment	"RODATA"
+
+S0011:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$28,$73,$74,$72,$75,$63
+	.byte	$74,$20,$65,$6E,$75,$6D,$5F,$62,$69,$74,$66,$69,$65,$6C,$64,$5F
+	.byte	$75,$63,$68,$61,$72,$29,$20,$3D,$20,$25,$7A,$75,$2C,$20,$65,$78
+	.byte	$70,$65,$63,$74,$65,$64,$20,$32,$2E,$0A,$00
+S0018:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$28,$73,$74,$72,$75,$63
+	.byte	$74,$20,$65,$6E,$75,$6D,$5F,$62,$69,$74,$66,$69,$65,$6C,$64,$5F
+	.byte	$63,$68,$61,$72,$29,$20,$3D,$20,$25,$7A,$75,$2C,$20,$65,$78,$70
+	.byte	$65,$63,$74,$65,$64,$20,$32,$2E,$0A,$00
+S0001:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$28,$73,$74,$72,$75,$63
+	.byte	$74,$20,$65,$6E,$75,$6D,$5F,$62,$69,$74,$66,$69,$65,$6C,$64,$5F
+	.byte	$75,$69,$6E,$74,$29,$20,$3D,$20,$25,$7A,$75,$2C,$20,$65,$78,$70
+	.byte	$65,$63,$74,$65,$64,$20,$34,$2E,$0A,$00
+S0009:
+	.byte	$47,$6F,$74,$20,$73,$69,$7A,$65,$6F,$66,$28,$73,$74,$72,$75,$63
+	.byte	$74,$20,$65,$6E,$75,$6D,$5F,$62,$69,$74,$66,$69,$65,$6C,$64,$5F
+	.byte	$69,$6E,$74,$29,$20,$3D,$20,$25,$7A,$75,$2C,$20,$65,$78,$70,$65
+	.byte	$63,$74,$65,$64,$20,$34,$2E,$0A,$00
+S0006:
+	.byte	$47,$6F,$74,$20,$6E,$65,$67,$61,$74,$69,$76,$65,$20,$76,$20,$3D
+	.byte	$20,$25,$6C,$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$6C
+	.byte	$61,$72,$67,$65,$20,$70,$6F,$73,$69,$74,$69,$76,$65,$2E,$0A,$00
+S000E:
+	.byte	$47,$6F,$74,$20,$70,$6F,$73,$69,$74,$69,$76,$65,$20,$76,$20,$3D
+	.byte	$20,$25,$6C,$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$6E
+	.byte	$65,$67,$61,$74,$69,$76,$65,$2E,$0A,$00
+S0008:
+	.byte	$47,$6F,$74,$20,$65,$31,$30,$75,$62,$66,$2E,$7A,$20,$3D,$20,$25
+	.byte	$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$32,$33
+	.byte	$2E,$0A,$00
+S0010:
+	.byte	$47,$6F,$74,$20,$65,$31,$31,$69,$62,$66,$2E,$7A,$20,$3D,$20,$25
+	.byte	$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$32,$33
+	.byte	$2E,$0A,$00
+S000C:
+	.byte	$47,$6F,$74,$20,$65,$31,$31,$69,$62,$66,$2E,$7A,$20,$3D,$20,$25
+	.byte	$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$30,$30
+	.byte	$2E,$0A,$00
+S0004:
+	.byte	$47,$6F,$74,$20,$65,$31,$30,$75,$62,$66,$2E,$7A,$20,$3D,$20,$25
+	.byte	$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$30,$30
+	.byte	$2E,$0A,$00
+S001E:
+	.byte	$47,$6F,$74,$20,$65,$38,$73,$63,$62,$66,$2E,$7A,$20,$3D,$20,$25
+	.byte	$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$32,$37,$2E
+	.byte	$0A,$00
+S001B:
+	.byte	$47,$6F,$74,$20,$65,$38,$73,$63,$62,$66,$2E,$7A,$20,$3D,$20,$25
+	.byte	$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$30,$2E
+	.byte	$0A,$00
+S0017:
+	.byte	$47,$6F,$74,$20,$65,$37,$75,$63,$62,$66,$2E,$7A,$20,$3D,$20,$25
+	.byte	$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$32,$37,$2E
+	.byte	$0A,$00
+S0014:
+	.byte	$47,$6F,$74,$20,$65,$37,$75,$63,$62,$66,$2E,$7A,$20,$3D,$20,$25
+	.byte	$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$30,$2E
+	.byte	$0A,$00
+S0003:
+	.byte	$47,$6F,$74,$20,$65,$31,$30,$75,$62,$66,$2E,$79,$20,$3D,$20,$25
+	.byte	$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$32,$30,$30,$2E
+	.byte	$0A,$00
+S000B:
+	.byte	$47,$6F,$74,$20,$65,$31,$31,$69,$62,$66,$2E,$79,$20,$3D,$20,$25
+	.byte	$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$30,$2E
+	.byte	$0A,$00
+S001D:
+	.byte	$47,$6F,$74,$20,$65,$38,$73,$63,$62,$66,$2E,$79,$20,$3D,$20,$25
+	.byte	$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$33,$2E,$0A
+	.byte	$00
+S0013:
+	.byte	$47,$6F,$74,$20,$65,$37,$75,$63,$62,$66,$2E,$79,$20,$3D,$20,$25
+	.byte	$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$2E,$0A
+	.byte	$00
+S000F:
+	.byte	$47,$6F,$74,$20,$65,$31,$31,$69,$62,$66,$2E,$79,$20,$3D,$20,$25
+	.byte	$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$37,$2E,$0A
+	.byte	$00
+S001C:
+	.byte	$47,$6F,$74,$20,$65,$38,$73,$63,$62,$66,$2E,$78,$20,$3D,$20,$25
+	.byte	$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$31,$2E,$0A
+	.byte	$00
+S0016:
+	.byte	$47,$6F,$74,$20,$65,$37,$75,$63,$62,$66,$2E,$79,$20,$3D,$20,$25
+	.byte	$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$35,$2E,$0A
+	.byte	$00
+S0007:
+	.byte	$47,$6F,$74,$20,$65,$31,$30,$75,$62,$66,$2E,$79,$20,$3D,$20,$25
+	.byte	$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$37,$2E,$0A
+	.byte	$00
+S001A:
+	.byte	$47,$6F,$74,$20,$65,$38,$73,$63,$62,$66,$2E,$79,$20,$3D,$20,$25
+	.byte	$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$30,$2E,$0A
+	.byte	$00
+S000A:
+	.byte	$47,$6F,$74,$20,$65,$31,$31,$69,$62,$66,$2E,$78,$20,$3D,$20,$25
+	.byte	$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$2D,$31,$2E,$0A
+	.byte	$00
+S0002:
+	.byte	$47,$6F,$74,$20,$65,$31,$30,$75,$62,$66,$2E,$78,$20,$3D,$20,$25
+	.byte	$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$30,$2E,$0A,$00
+S000D:
+	.byte	$47,$6F,$74,$20,$65,$31,$31,$69,$62,$66,$2E,$78,$20,$3D,$20,$25
+	.byte	$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A,$00
+S0015:
+	.byte	$47,$6F,$74,$20,$65,$37,$75,$63,$62,$66,$2E,$78,$20,$3D,$20,$25
+	.byte	$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A,$00
+S0012:
+	.byte	$47,$6F,$74,$20,$65,$37,$75,$63,$62,$66,$2E,$78,$20,$3D,$20,$25
+	.byte	$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$30,$2E,$0A,$00
+S0019:
+	.byte	$47,$6F,$74,$20,$65,$38,$73,$63,$62,$66,$2E,$78,$20,$3D,$20,$25
+	.byte	$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$30,$2E,$0A,$00
+S0005:
+	.byte	$47,$6F,$74,$20,$65,$31,$30,$75,$62,$66,$2E,$78,$20,$3D,$20,$25
+	.byte	$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$31,$2E,$0A,$00
+S001F:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ test_enum_bitfield_uint (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_enum_bitfield_uint: near
+
+	.dbg	func, "test_enum_bitfield_uint", "00", static, "_test_enum_bitfield_uint"
+
+.segment	"CODE"
+
+	.dbg	line, "enum-bitfield.c", 43
+	jmp     L0002
+	.dbg	line, "enum-bitfield.c", 44
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	.dbg	line, "enum-bitfield.c", 45
+	ldx     #$00
+	lda     #$04
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "enum-bitfield.c", 46
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "enum-bitfield.c", 49
+L0002:	lda     _e10ubf
+	ldx     #$00
+	and     #$01
+	cpx     #$00
+	bne     L0004
+	cmp     #$00
+L0004:	jsr     boolne
+	jeq     L0003
+	.dbg	line, "enum-bitfield.c", 50
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     _e10ubf
+	ldx     #$00
+	and     #$01
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "enum-bitfield.c", 51
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "enum-bitfield.c", 53
+L0003:	lda     _e10ubf
+	ldx     _e10ubf+1
+	jsr     shrax1
+	ldx     #$00
+	cpx     #$00
+	bne     L0006
+	cmp     #$C8
+L0006:	jsr     boolne
+	jeq     L0005
+	.dbg	line, "enum-bitfield.c", 54
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     _e10ubf
+	ldx     _e10ubf+1
+	jsr     shrax1
+	ldx     #$00
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "enum-bitfield.c", 55
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "enum-bitfield.c", 57
+L0005:	lda     _e10ubf+2
+	ldx     _e10ubf+2+1
+	cpx     #$03
+	bne     L0008
+	cmp     #$E8
+L0008:	jsr     boolne
+	jeq     L0007
+	.dbg	line, "enum-bitfield.c", 58
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     _e10ubf+2
+	ldx     _e10ubf+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "enum-bitfield.c", 59
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "enum-bitfield.c", 62
+L0007:	ldx     #$00
+	lda     _e10ubf
+	ora     #$01
+	sta     _e10ubf
+	.dbg	line, "enum-bitfield.c", 63
+	lda     _e10ubf
+	ldx     _e10ubf+1
+	tay
+	txa
+	and     #$FE
+	tax
+	tya
+	and     #$01
+	ora     #$22
+	sta     _e10ubf
+	stx     _e10ubf+1
+	.dbg	line, "enum-bitfield.c", 64
+	lda     _e10ubf+2
+	ldx     _e10ubf+2+1
+	txa
+	and     #$00
+	tax
+	lda     #$00
+	ora     #$FF
+	pha
+	txa
+	ora     #$03
+	tax
+	pla
+	sta     _e10ubf+2
+	stx     _e10ubf+2+1
+	.dbg	line, "enum-bitfield.c", 66
+	lda     _e10ubf
+	ldx     #$00
+	and     #$01
+	cpx     #$00
+	bne     L000A
+	cmp     #$01
+L000A:	jsr     boolne
+	jeq     L0009
+	.dbg	line, "enum-bitfield.c", 67
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     _e10ubf
+	ldx     #$00
+	and     #$01
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "enum-bitfield.c", 68
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "enum-bitfield.c", 73
+L0009:	lda     _e10ubf
+	ldx     #$00
+	and     #$01
+	jsr     decax2
+	jsr     axulong
+	jsr     pusheax
+	.dbg	line, "enum-bitfield.c", 74
+	ldy     #$03
+	jsr     ldeaxysp
+	lda     sreg+1
+	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jeq     L000B
+	.dbg	line, "enum-bitfield.c", 75
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "enum-bitfield.c", 76
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "enum-bitfield.c", 78
+L000B:	jsr     incsp4
+	.dbg	line, "enum-bitfield.c", 80
+	lda     _e10ubf
+	ldx     _e10ubf+1
+	jsr     shrax1
+	ldx     #$00
+	cpx     #$00
+	bne     L000D
+	cmp     #$11
+L000D:	jsr     boolne
+	jeq     L000C
+	.dbg	line, "enum-bitfield.c", 81
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	lda     _e10ubf
+	ldx     _e10ubf+1
+	jsr     shrax1
+	ldx     #$00
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "enum-bitfield.c", 82
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "enum-bitfield.c", 84
+L000C:	lda     _e10ubf+2
+	ldx     _e10ubf+2+1
+	cpx     #$03
+	bne     L000F
+	cmp     #$FF
+L000F:	jsr     boolne
+	jeq     L000E
+	.dbg	line, "enum-bitfield.c", 85
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	lda     _e10ubf+2
+	ldx     _e10ubf+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "enum-bitfield.c", 86
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "enum-bitfield.c", 88
+L000E:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_enum_bitfield_int (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_enum_bitfield_int: near
+
+	.dbg	func, "test_enum_bitfield_int", "00", static, "_test_enum_bitfield_int"
+
+.segment	"CODE"
+
+	.dbg	line, "enum-bitfield.c", 105
+	jmp     L0002
+	.dbg	line, "enum-bitfield.c", 106
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	.dbg	line, "enum-bitfield.c", 107
+	ldx     #$00
+	lda     #$04
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "enum-bitfield.c", 108
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "enum-bitfield.c", 111
+L0002:	lda     _e11ibf
+	tay
+	and     #$02
+	beq     L0004
+	tya
+	ora     #$FC
+	ldx     #$FF
+	jmp     L0005
+L0004:	tya
+	ldx     #$00
+	and     #$03
+L0005:	cpx     #$FF
+	bne     L0006
+	cmp     #$FF
+L0006:	jsr     boolne
+	jeq     L0003
+	.dbg	line, "enum-bitfield.c", 112
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	lda     _e11ibf
+	tay
+	and     #$02
+	beq     L0007
+	tya
+	ora     #$FC
+	ldx     #$FF
+	jmp     L0008
+L0007:	tya
+	ldx     #$00
+	and     #$03
+L0008:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "enum-bitfield.c", 113
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "enum-bitfield.c", 115
+L0003:	lda     _e11ibf
+	ldx     _e11ibf+1
+	jsr     shrax2
+	tay
+	and     #$80
+	beq     L000A
+	tya
+	ldx     #$FF
+	jmp     L000B
+L000A:	tya
+	ldx     #$00
+L000B:	cpx     #$00
+	bne     L000C
+	cmp     #$64
+L000C:	jsr     boolne
+	jeq     L0009
+	.dbg	line, "enum-bitfield.c", 116
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	lda     _e11ibf
+	ldx     _e11ibf+1
+	jsr     shrax2
+	tay
+	and     #$80
+	beq     L000D
+	tya
+	ldx     #$FF
+	jmp     L000E
+L000D:	tya
+	ldx     #$00
+L000E:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "enum-bitfield.c", 117
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "enum-bitfield.c", 119
+L0009:	lda     _e11ibf+2
+	ldx     _e11ibf+2+1
+	cpx     #$03
+	bne     L0010
+	cmp     #$E8
+L0010:	jsr     boolne
+	jeq     L000F
+	.dbg	line, "enum-bitfield.c", 120
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	lda     _e11ibf+2
+	ldx     _e11ibf+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "enum-bitfield.c", 121
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "enum-bitfield.c", 124
+L000F:	ldx     #$00
+	lda     _e11ibf
+	and     #$FC
+	ora     #$01
+	sta     _e11ibf
+	.dbg	line, "enum-bitfield.c", 125
+	lda     _e11ibf
+	ldx     _e11ibf+1
+	tay
+	txa
+	and     #$FC
+	tax
+	tya
+	and     #$03
+	ora     #$44
+	sta     _e11ibf
+	stx     _e11ibf+1
+	.dbg	line, "enum-bitfield.c", 126
+	lda     _e11ibf+2
+	ldx     _e11ibf+2+1
+	txa
+	and     #$00
+	tax
+	lda     #$00
+	ora     #$FF
+	pha
+	txa
+	ora     #$03
+	tax
+	pla
+	sta     _e11ibf+2
+	stx     _e11ibf+2+1
+	.dbg	line, "enum-bitfield.c", 128
+	lda     _e11ibf
+	tay
+	and     #$02
+	beq     L0012
+	tya
+	ora     #$FC
+	ldx     #$FF
+	jmp     L0013
+L0012:	tya
+	ldx     #$00
+	and     #$03
+L0013:	cpx     #$00
+	bne     L0014
+	cmp     #$01
+L0014:	jsr     boolne
+	jeq     L0011
+	.dbg	line, "enum-bitfield.c", 129
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	lda     _e11ibf
+	tay
+	and     #$02
+	beq     L0015
+	tya
+	ora     #$FC
+	ldx     #$FF
+	jmp     L0016
+L0015:	tya
+	ldx     #$00
+	and     #$03
+L0016:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "enum-bitfield.c", 130
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "enum-bitfield.c", 135
+L0011:	lda     _e11ibf
+	tay
+	and     #$02
+	beq     L0017
+	tya
+	ora     #$FC
+	ldx     #$FF
+	jmp     L0018
+L0017:	tya
+	ldx     #$00
+	and     #$03
+L0018:	jsr     decax2
+	jsr     axlong
+	jsr     pusheax
+	.dbg	line, "enum-bitfield.c", 136
+	ldy     #$03
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     tosgeeax
+	jeq     L0019
+	.dbg	line, "enum-bitfield.c", 137
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "enum-bitfield.c", 138
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "enum-bitfield.c", 140
+L0019:	jsr     incsp4
+	.dbg	line, "enum-bitfield.c", 142
+	lda     _e11ibf
+	ldx     _e11ibf+1
+	jsr     shrax2
+	tay
+	and     #$80
+	beq     L001B
+	tya
+	ldx     #$FF
+	jmp     L001C
+L001B:	tya
+	ldx     #$00
+L001C:	cpx     #$00
+	bne     L001D
+	cmp     #$11
+L001D:	jsr     boolne
+	jeq     L001A
+	.dbg	line, "enum-bitfield.c", 143
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	lda     _e11ibf
+	ldx     _e11ibf+1
+	jsr     shrax2
+	tay
+	and     #$80
+	beq     L001E
+	tya
+	ldx     #$FF
+	jmp     L001F
+L001E:	tya
+	ldx     #$00
+L001F:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "enum-bitfield.c", 144
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "enum-bitfield.c", 146
+L001A:	lda     _e11ibf+2
+	ldx     _e11ibf+2+1
+	cpx     #$03
+	bne     L0021
+	cmp     #$FF
+L0021:	jsr     boolne
+	jeq     L0020
+	.dbg	line, "enum-bitfield.c", 147
+	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	lda     _e11ibf+2
+	ldx     _e11ibf+2+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "enum-bitfield.c", 148
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "enum-bitfield.c", 150
+L0020:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_enum_bitfield_uchar (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_enum_bitfield_uchar: near
+
+	.dbg	func, "test_enum_bitfield_uchar", "00", static, "_test_enum_bitfield_uchar"
+
+.segment	"CODE"
+
+	.dbg	line, "enum-bitfield.c", 165
+	jmp     L0002
+	.dbg	line, "enum-bitfield.c", 166
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	.dbg	line, "enum-bitfield.c", 167
+	ldx     #$00
+	lda     #$02
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "enum-bitfield.c", 168
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "enum-bitfield.c", 171
+L0002:	lda     _e7ucbf
+	ldx     #$00
+	and     #$01
+	cmp     #$00
+	jsr     boolne
+	jeq     L0003
+	.dbg	line, "enum-bitfield.c", 172
+	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	lda     _e7ucbf
+	ldx     #$00
+	and     #$01
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "enum-bitfield.c", 173
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "enum-bitfield.c", 175
+L0003:	lda     _e7ucbf
+	lsr     a
+	ldx     #$00
+	and     #$0F
+	cmp     #$0A
+	jsr     boolne
+	jeq     L0004
+	.dbg	line, "enum-bitfield.c", 176
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	lda     _e7ucbf
+	lsr     a
+	ldx     #$00
+	and     #$0F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "enum-bitfield.c", 177
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "enum-bitfield.c", 179
+L0004:	ldx     #$00
+	lda     _e7ucbf+1
+	cmp     #$64
+	jsr     boolne
+	jeq     L0005
+	.dbg	line, "enum-bitfield.c", 180
+	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	ldx     #$00
+	lda     _e7ucbf+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "enum-bitfield.c", 181
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "enum-bitfield.c", 184
+L0005:	ldx     #$00
+	lda     _e7ucbf
+	ora     #$01
+	sta     _e7ucbf
+	.dbg	line, "enum-bitfield.c", 185
+	ldx     #$00
+	lda     _e7ucbf
+	ora     #$1E
+	sta     _e7ucbf
+	.dbg	line, "enum-bitfield.c", 186
+	ldx     #$00
+	lda     _e7ucbf+1
+	lda     #$00
+	ora     #$7F
+	sta     _e7ucbf+1
+	.dbg	line, "enum-bitfield.c", 191
+	lda     _e7ucbf
+	ldx     #$00
+	and     #$01
+	cmp     #$01
+	jsr     boolne
+	jeq     L0006
+	.dbg	line, "enum-bitfield.c", 192
+	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+	lda     _e7ucbf
+	ldx     #$00
+	and     #$01
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "enum-bitfield.c", 193
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "enum-bitfield.c", 196
+L0006:	lda     _e7ucbf
+	lsr     a
+	ldx     #$00
+	and     #$0F
+	cmp     #$0F
+	jsr     boolne
+	jeq     L0007
+	.dbg	line, "enum-bitfield.c", 197
+	lda     #<(S0016)
+	ldx     #>(S0016)
+	jsr     pushax
+	lda     _e7ucbf
+	lsr     a
+	ldx     #$00
+	and     #$0F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "enum-bitfield.c", 198
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "enum-bitfield.c", 200
+L0007:	ldx     #$00
+	lda     _e7ucbf+1
+	cmp     #$7F
+	jsr     boolne
+	jeq     L0008
+	.dbg	line, "enum-bitfield.c", 201
+	lda     #<(S0017)
+	ldx     #>(S0017)
+	jsr     pushax
+	ldx     #$00
+	lda     _e7ucbf+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "enum-bitfield.c", 202
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "enum-bitfield.c", 204
+L0008:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test_enum_bitfield_char (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test_enum_bitfield_char: near
+
+	.dbg	func, "test_enum_bitfield_char", "00", static, "_test_enum_bitfield_char"
+
+.segment	"CODE"
+
+	.dbg	line, "enum-bitfield.c", 220
+	jmp     L0002
+	.dbg	line, "enum-bitfield.c", 221
+	lda     #<(S0018)
+	ldx     #>(S0018)
+	jsr     pushax
+	.dbg	line, "enum-bitfield.c", 222
+	ldx     #$00
+	lda     #$02
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "enum-bitfield.c", 223
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "enum-bitfield.c", 226
+L0002:	lda     _e8scbf
+	tay
+	and     #$01
+	beq     L0004
+	tya
+	ora     #$FE
+	ldx     #$FF
+	jmp     L0005
+L0004:	tya
+	ldx     #$00
+	and     #$01
+L0005:	cmp     #$00
+	jsr     boolne
+	jeq     L0003
+	.dbg	line, "enum-bitfield.c", 227
+	lda     #<(S0019)
+	ldx     #>(S0019)
+	jsr     pushax
+	lda     _e8scbf
+	tay
+	and     #$01
+	beq     L0006
+	tya
+	ora     #$FE
+	ldx     #$FF
+	jmp     L0007
+L0006:	tya
+	ldx     #$00
+	and     #$01
+L0007:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "enum-bitfield.c", 228
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "enum-bitfield.c", 230
+L0003:	lda     _e8scbf
+	lsr     a
+	tay
+	and     #$08
+	beq     L0009
+	tya
+	ora     #$F0
+	ldx     #$FF
+	jmp     L000A
+L0009:	tya
+	ldx     #$00
+	and     #$0F
+L000A:	cmp     #$05
+	jsr     boolne
+	jeq     L0008
+	.dbg	line, "enum-bitfield.c", 231
+	lda     #<(S001A)
+	ldx     #>(S001A)
+	jsr     pushax
+	lda     _e8scbf
+	lsr     a
+	tay
+	and     #$08
+	beq     L000B
+	tya
+	ora     #$F0
+	ldx     #$FF
+	jmp     L000C
+L000B:	tya
+	ldx     #$00
+	and     #$0F
+L000C:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "enum-bitfield.c", 232
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "enum-bitfield.c", 234
+L0008:	ldx     #$00
+	lda     _e8scbf+1
+	bpl     L000E
+	dex
+L000E:	cmp     #$64
+	jsr     boolne
+	jeq     L000D
+	.dbg	line, "enum-bitfield.c", 235
+	lda     #<(S001B)
+	ldx     #>(S001B)
+	jsr     pushax
+	ldx     #$00
+	lda     _e8scbf+1
+	bpl     L000F
+	dex
+L000F:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "enum-bitfield.c", 236
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "enum-bitfield.c", 239
+L000D:	ldx     #$00
+	lda     _e8scbf
+	ora     #$01
+	sta     _e8scbf
+	.dbg	line, "enum-bitfield.c", 240
+	ldx     #$00
+	lda     _e8scbf
+	and     #$E1
+	ora     #$1A
+	sta     _e8scbf
+	.dbg	line, "enum-bitfield.c", 241
+	ldx     #$00
+	lda     _e8scbf+1
+	lda     #$00
+	ora     #$7F
+	sta     _e8scbf+1
+	.dbg	line, "enum-bitfield.c", 243
+	lda     _e8scbf
+	tay
+	and     #$01
+	beq     L0011
+	tya
+	ora     #$FE
+	ldx     #$FF
+	jmp     L0012
+L0011:	tya
+	ldx     #$00
+	and     #$01
+L0012:	cmp     #$FF
+	jsr     boolne
+	jeq     L0010
+	.dbg	line, "enum-bitfield.c", 244
+	lda     #<(S001C)
+	ldx     #>(S001C)
+	jsr     pushax
+	lda     _e8scbf
+	tay
+	and     #$01
+	beq     L0013
+	tya
+	ora     #$FE
+	ldx     #$FF
+	jmp     L0014
+L0013:	tya
+	ldx     #$00
+	and     #$01
+L0014:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "enum-bitfield.c", 245
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "enum-bitfield.c", 247
+L0010:	lda     _e8scbf
+	lsr     a
+	tay
+	and     #$08
+	beq     L0016
+	tya
+	ora     #$F0
+	ldx     #$FF
+	jmp     L0017
+L0016:	tya
+	ldx     #$00
+	and     #$0F
+L0017:	cmp     #$FD
+	jsr     boolne
+	jeq     L0015
+	.dbg	line, "enum-bitfield.c", 248
+	lda     #<(S001D)
+	ldx     #>(S001D)
+	jsr     pushax
+	lda     _e8scbf
+	lsr     a
+	tay
+	and     #$08
+	beq     L0018
+	tya
+	ora     #$F0
+	ldx     #$FF
+	jmp     L0019
+L0018:	tya
+	ldx     #$00
+	and     #$0F
+L0019:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "enum-bitfield.c", 249
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "enum-bitfield.c", 251
+L0015:	ldx     #$00
+	lda     _e8scbf+1
+	bpl     L001B
+	dex
+L001B:	cmp     #$7F
+	jsr     boolne
+	jeq     L001A
+	.dbg	line, "enum-bitfield.c", 252
+	lda     #<(S001E)
+	ldx     #>(S001E)
+	jsr     pushax
+	ldx     #$00
+	lda     _e8scbf+1
+	bpl     L001C
+	dex
+L001C:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "enum-bitfield.c", 253
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "enum-bitfield.c", 255
+L001A:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "enum-bitfield.c", 259
+	jsr     _test_enum_bitfield_uint
+	.dbg	line, "enum-bitfield.c", 260
+	jsr     _test_enum_bitfield_int
+	.dbg	line, "enum-bitfield.c", 261
+	jsr     _test_enum_bitfield_uchar
+	.dbg	line, "enum-bitfield.c", 262
+	jsr     _test_enum_bitfield_char
+	.dbg	line, "enum-bitfield.c", 263
+	lda     #<(S001F)
+	ldx     #>(S001F)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "enum-bitfield.c", 264
+	ldx     #$00
+	lda     _failures
+	jmp     L0001
+	.dbg	line, "enum-bitfield.c", 265
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,310 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_success
+	.export		_failures
+	.export		_dummy
+	.export		_uint0
+	.export		_uint1
+	.export		_uchar0
+	.export		_uchar1
+	.export		_done
+	.export		_for1
+	.export		_for2
+	.export		_for3
+	.export		_for4
+	.export		_for5
+	.export		_inc_uchar0
+	.export		_for6
+	.export		_main
+
+.segment	"DATA"
+
+_success:
+	.byte	$00
+_failures:
+	.byte	$00
+_dummy:
+	.byte	$00
+_uint0:
+	.word	$0000
+_uint1:
+	.word	$0000
+_uchar0:
+	.byte	$00
+_uchar1:
+	.byte	$00
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ done (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_done: near
+
+.segment	"CODE"
+
+	inc     _dummy
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ for1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_for1: near
+
+.segment	"CODE"
+
+	lda     #$00
+	jsr     pusha
+	bra     L0007
+L0008:	inc     _uchar0
+	clc
+	lda     #$01
+	adc     (sp)
+L0007:	sta     (sp)
+	cmp     #$0A
+	bcc     L0008
+	lda     _uchar0
+	cmp     #$0A
+	beq     L0006
+	inc     _failures
+L0006:	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ for2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_for2: near
+
+.segment	"CODE"
+
+	lda     #$00
+	jsr     pusha
+	bra     L0007
+L0008:	inc     _uchar0
+	clc
+	lda     #$01
+	adc     (sp)
+L0007:	sta     (sp)
+	cmp     #$0A
+	bcc     L0008
+	lda     (sp)
+	cmp     #$0A
+	bcs     L0006
+	inc     _failures
+L0006:	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ for3 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_for3: near
+
+.segment	"CODE"
+
+	jsr     push0
+	sta     (sp)
+	ldy     #$01
+	sta     (sp),y
+	bra     L000A
+L0005:	inc     _uint0
+	bne     L0007
+	inc     _uint0+1
+L0007:	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	ldy     #$01
+L000A:	lda     (sp),y
+	cmp     #$00
+	bne     L0006
+	lda     (sp)
+	cmp     #$0A
+L0006:	bcc     L0005
+	ldy     #$01
+	lda     (sp),y
+	cmp     #$00
+	bne     L0009
+	lda     (sp)
+	cmp     #$0A
+L0009:	bcs     L0008
+	inc     _failures
+L0008:	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ for4 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_for4: near
+
+.segment	"CODE"
+
+	lda     #$01
+	sta     _uint0
+	stz     _uint0+1
+	bra     L0002
+L0005:	inc     _uchar0
+	inc     _uint0
+	bne     L0002
+	inc     _uint0+1
+L0002:	lda     _uint0+1
+	cmp     #$00
+	bne     L0006
+	lda     _uint0
+	cmp     #$0A
+L0006:	bcc     L0005
+	lda     _uchar0
+	cmp     #$09
+	beq     L0008
+	inc     _failures
+L0008:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ for5 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_for5: near
+
+.segment	"CODE"
+
+	lda     #$01
+	sta     _uint0
+	stz     _uint0+1
+	bra     L0002
+L0005:	inc     _uchar0
+	inc     _uint0
+	bne     L0002
+	inc     _uint0+1
+L0002:	lda     _uint0+1
+	cmp     #$00
+	bne     L0006
+	lda     _uint0
+	cmp     #$0B
+L0006:	bcc     L0005
+	lda     _uchar0
+	cmp     #$0A
+	beq     L0008
+	inc     _failures
+L0008:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ inc_uchar0 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_inc_uchar0: near
+
+.segment	"CODE"
+
+	inc     _uchar0
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ for6 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_for6: near
+
+.segment	"CODE"
+
+	stz     _uchar0
+	lda     #$01
+	sta     _uint0
+	stz     _uint0+1
+	bra     L0002
+L0005:	jsr     _inc_uchar0
+	inc     _uint0
+	bne     L0002
+	inc     _uint0+1
+L0002:	lda     _uint0+1
+	cmp     #$00
+	bne     L0006
+	lda     _uint0
+	cmp     #$0B
+L0006:	bcc     L0005
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     _for1
+	jsr     _for2
+	jsr     _for3
+	stz     _uchar0
+	jsr     _for4
+	stz     _uchar0
+	jsr     _for5
+	jsr     _for6
+	lda     _uchar0
+	cmp     #$0A
+	beq     L0003
+	inc     _failures
+L0003:	lda     _failures
+	sta     _success
+	jsr     _done
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _failures
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     _failures
+	rts
+
+.endproc
+
@@ -0,0 +1,510 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "for.c", 1296, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/limits.h", 3146, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_success
+	.export		_failures
+	.export		_dummy
+	.export		_uint0
+	.export		_uint1
+	.export		_uchar0
+	.export		_uchar1
+	.export		_done
+	.export		_for1
+	.export		_for2
+	.export		_for3
+	.export		_for4
+	.export		_for5
+	.export		_inc_uchar0
+	.export		_for6
+	.export		_main
+
+.segment	"DATA"
+
+_success:
+	.byte	$00
+_failures:
+	.byte	$00
+_dummy:
+	.byte	$00
+_uint0:
+	.word	$0000
+_uint1:
+	.word	$0000
+_uchar0:
+	.byte	$00
+_uchar1:
+	.byte	$00
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; void __near__ done (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_done: near
+
+	.dbg	func, "done", "00", extern, "_done"
+
+.segment	"CODE"
+
+	.dbg	line, "for.c", 24
+	ldx     #$00
+	lda     _dummy
+	inc     _dummy
+	.dbg	line, "for.c", 25
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ for1 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_for1: near
+
+	.dbg	func, "for1", "00", extern, "_for1"
+	.dbg	sym, "i", "00", auto, -1
+
+.segment	"CODE"
+
+	.dbg	line, "for.c", 29
+	lda     #$00
+	jsr     pusha
+	.dbg	line, "for.c", 31
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	sta     (sp),y
+	jmp     L0002
+	.dbg	line, "for.c", 32
+L0005:	ldx     #$00
+	lda     _uchar0
+	inc     _uchar0
+	.dbg	line, "for.c", 31
+	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$00
+	ldx     #$00
+	clc
+	lda     #$01
+	adc     (sp),y
+	sta     (sp),y
+	jmp     L0002
+L0002:	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$0A
+	jsr     boolult
+	jne     L0005
+	.dbg	line, "for.c", 34
+	ldx     #$00
+	lda     _uchar0
+	cmp     #$0A
+	jsr     boolne
+	jeq     L0006
+	.dbg	line, "for.c", 35
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "for.c", 36
+L0006:	jsr     incsp1
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ for2 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_for2: near
+
+	.dbg	func, "for2", "00", extern, "_for2"
+	.dbg	sym, "i", "00", auto, -1
+
+.segment	"CODE"
+
+	.dbg	line, "for.c", 40
+	lda     #$00
+	jsr     pusha
+	.dbg	line, "for.c", 42
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	sta     (sp),y
+	jmp     L0002
+	.dbg	line, "for.c", 43
+L0005:	ldx     #$00
+	lda     _uchar0
+	inc     _uchar0
+	.dbg	line, "for.c", 42
+	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$00
+	ldx     #$00
+	clc
+	lda     #$01
+	adc     (sp),y
+	sta     (sp),y
+	jmp     L0002
+L0002:	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$0A
+	jsr     boolult
+	jne     L0005
+	.dbg	line, "for.c", 45
+	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$0A
+	jsr     boolult
+	jeq     L0006
+	.dbg	line, "for.c", 46
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "for.c", 47
+L0006:	jsr     incsp1
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ for3 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_for3: near
+
+	.dbg	func, "for3", "00", extern, "_for3"
+	.dbg	sym, "i", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "for.c", 51
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	.dbg	line, "for.c", 53
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+	jmp     L0002
+	.dbg	line, "for.c", 54
+L0005:	lda     _uint0
+	ldx     _uint0+1
+	inc     _uint0
+	bne     L0007
+	inc     _uint0+1
+L0007:	lda     _uint0
+	ldx     _uint0+1
+	.dbg	line, "for.c", 53
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0002:	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0006
+	cmp     #$0A
+L0006:	jsr     boolult
+	jne     L0005
+	.dbg	line, "for.c", 56
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0009
+	cmp     #$0A
+L0009:	jsr     boolult
+	jeq     L0008
+	.dbg	line, "for.c", 57
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "for.c", 58
+L0008:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ for4 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_for4: near
+
+	.dbg	func, "for4", "00", extern, "_for4"
+
+.segment	"CODE"
+
+	.dbg	line, "for.c", 62
+	ldx     #$00
+	lda     #$01
+	sta     _uint0
+	stx     _uint0+1
+	jmp     L0002
+	.dbg	line, "for.c", 63
+L0005:	ldx     #$00
+	lda     _uchar0
+	inc     _uchar0
+	.dbg	line, "for.c", 62
+	lda     _uint0
+	ldx     _uint0+1
+	inc     _uint0
+	bne     L0007
+	inc     _uint0+1
+L0007:	lda     _uint0
+	ldx     _uint0+1
+	jmp     L0002
+L0002:	lda     _uint0
+	ldx     _uint0+1
+	cpx     #$00
+	bne     L0006
+	cmp     #$0A
+L0006:	jsr     boolult
+	jne     L0005
+	.dbg	line, "for.c", 65
+	ldx     #$00
+	lda     _uchar0
+	cmp     #$09
+	jsr     boolne
+	jeq     L0008
+	.dbg	line, "for.c", 66
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "for.c", 67
+L0008:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ for5 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_for5: near
+
+	.dbg	func, "for5", "00", extern, "_for5"
+
+.segment	"CODE"
+
+	.dbg	line, "for.c", 71
+	ldx     #$00
+	lda     #$01
+	sta     _uint0
+	stx     _uint0+1
+	jmp     L0002
+	.dbg	line, "for.c", 72
+L0005:	ldx     #$00
+	lda     _uchar0
+	inc     _uchar0
+	.dbg	line, "for.c", 71
+	lda     _uint0
+	ldx     _uint0+1
+	inc     _uint0
+	bne     L0007
+	inc     _uint0+1
+L0007:	lda     _uint0
+	ldx     _uint0+1
+	jmp     L0002
+L0002:	lda     _uint0
+	ldx     _uint0+1
+	cpx     #$00
+	bne     L0006
+	cmp     #$0B
+L0006:	jsr     boolult
+	jne     L0005
+	.dbg	line, "for.c", 74
+	ldx     #$00
+	lda     _uchar0
+	cmp     #$0A
+	jsr     boolne
+	jeq     L0008
+	.dbg	line, "for.c", 75
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "for.c", 76
+L0008:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ inc_uchar0 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_inc_uchar0: near
+
+	.dbg	func, "inc_uchar0", "00", extern, "_inc_uchar0"
+
+.segment	"CODE"
+
+	.dbg	line, "for.c", 80
+	ldx     #$00
+	lda     _uchar0
+	inc     _uchar0
+	.dbg	line, "for.c", 81
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ for6 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_for6: near
+
+	.dbg	func, "for6", "00", extern, "_for6"
+
+.segment	"CODE"
+
+	.dbg	line, "for.c", 85
+	ldx     #$00
+	lda     #$00
+	sta     _uchar0
+	.dbg	line, "for.c", 86
+	ldx     #$00
+	lda     #$01
+	sta     _uint0
+	stx     _uint0+1
+	jmp     L0002
+	.dbg	line, "for.c", 87
+L0005:	jsr     _inc_uchar0
+	.dbg	line, "for.c", 86
+	lda     _uint0
+	ldx     _uint0+1
+	inc     _uint0
+	bne     L0007
+	inc     _uint0+1
+L0007:	lda     _uint0
+	ldx     _uint0+1
+	jmp     L0002
+L0002:	lda     _uint0
+	ldx     _uint0+1
+	cpx     #$00
+	bne     L0006
+	cmp     #$0B
+L0006:	jsr     boolult
+	jne     L0005
+	.dbg	line, "for.c", 88
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "for.c", 92
+	jsr     _for1
+	.dbg	line, "for.c", 93
+	jsr     _for2
+	.dbg	line, "for.c", 94
+	jsr     _for3
+	.dbg	line, "for.c", 95
+	ldx     #$00
+	lda     #$00
+	sta     _uchar0
+	.dbg	line, "for.c", 96
+	jsr     _for4
+	.dbg	line, "for.c", 97
+	ldx     #$00
+	lda     #$00
+	sta     _uchar0
+	.dbg	line, "for.c", 98
+	jsr     _for5
+	.dbg	line, "for.c", 100
+	jsr     _for6
+	.dbg	line, "for.c", 101
+	ldx     #$00
+	lda     _uchar0
+	cmp     #$0A
+	jsr     boolne
+	jeq     L0002
+	.dbg	line, "for.c", 102
+	ldx     #$00
+	lda     _failures
+	inc     _failures
+	.dbg	line, "for.c", 104
+L0002:	ldx     #$00
+	lda     _failures
+	sta     _success
+	.dbg	line, "for.c", 105
+	jsr     _done
+	.dbg	line, "for.c", 106
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldx     #$00
+	lda     _failures
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "for.c", 108
+	ldx     #$00
+	lda     _failures
+	jmp     L0001
+	.dbg	line, "for.c", 109
+L0001:	rts
+
+	.dbg	line
+.endproc
+
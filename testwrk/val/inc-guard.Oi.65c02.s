@@ -0,0 +1,117 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_first
+	.export		_second
+	.export		_noguard
+	.export		_once
+	.export		_main
+
+.segment	"DATA"
+
+_first:
+	.word	$0001
+_second:
+	.word	$0002
+_noguard:
+	.word	$0002
+_once:
+	.word	$0001
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$67,$75,$61,$72,$64,$3A,$20,$25,$64,$20,$25,$64,$0A,$00
+S0002:
+	.byte	$6E,$6F,$67,$75,$61,$72,$64,$3A,$20,$25,$64,$0A,$00
+S0003:
+	.byte	$6F,$6E,$63,$65,$3A,$20,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     push0
+	lda     _first
+	clc
+	adc     _second
+	pha
+	lda     _first+1
+	adc     _second+1
+	tax
+	pla
+	cpx     #$00
+	bne     L0008
+	cmp     #$03
+	beq     L0002
+L0008:	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _first
+	ldx     _first+1
+	jsr     pushax
+	lda     _second
+	ldx     _second+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+L0002:	lda     _noguard+1
+	bne     L0009
+	lda     _noguard
+	cmp     #$02
+	beq     L0004
+L0009:	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     _noguard
+	ldx     _noguard+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+L0004:	lda     _once+1
+	bne     L000A
+	lda     _once
+	cmp     #$01
+	beq     L0006
+L000A:	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     _once
+	ldx     _once+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+L0006:	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jmp     incsp2
+
+.endproc
+
@@ -0,0 +1,149 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "inc-guard.c", 932, 1792420604
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "inc-guard.h", 182, 1792420604
+	.dbg		file, "inc-noguard.h", 117, 1792420604
+	.dbg		file, "inc-once.h", 70, 1792420604
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_first
+	.export		_second
+	.export		_noguard
+	.export		_once
+	.export		_main
+
+.segment	"DATA"
+
+_first:
+	.word	$0001
+_second:
+	.word	$0002
+_noguard:
+	.word	$0002
+_once:
+	.word	$0001
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$67,$75,$61,$72,$64,$3A,$20,$25,$64,$20,$25,$64,$0A,$00
+S0002:
+	.byte	$6E,$6F,$67,$75,$61,$72,$64,$3A,$20,$25,$64,$0A,$00
+S0003:
+	.byte	$6F,$6E,$63,$65,$3A,$20,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+	.dbg	sym, "failures", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "inc-guard.c", 32
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	.dbg	line, "inc-guard.c", 34
+	lda     _first
+	ldx     _first+1
+	jsr     pushax
+	lda     _second
+	ldx     _second+1
+	jsr     tosaddax
+	cpx     #$00
+	bne     L0003
+	cmp     #$03
+L0003:	jsr     boolne
+	jeq     L0002
+	.dbg	line, "inc-guard.c", 35
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _first
+	ldx     _first+1
+	jsr     pushax
+	lda     _second
+	ldx     _second+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "inc-guard.c", 36
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	.dbg	line, "inc-guard.c", 38
+L0002:	lda     _noguard
+	ldx     _noguard+1
+	cpx     #$00
+	bne     L0005
+	cmp     #$02
+L0005:	jsr     boolne
+	jeq     L0004
+	.dbg	line, "inc-guard.c", 39
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     _noguard
+	ldx     _noguard+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "inc-guard.c", 40
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	.dbg	line, "inc-guard.c", 42
+L0004:	lda     _once
+	ldx     _once+1
+	cpx     #$00
+	bne     L0007
+	cmp     #$01
+L0007:	jsr     boolne
+	jeq     L0006
+	.dbg	line, "inc-guard.c", 43
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     _once
+	ldx     _once+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "inc-guard.c", 44
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	.dbg	line, "inc-guard.c", 46
+L0006:	ldy     #$01
+	jsr     ldaxysp
+	jmp     L0001
+	.dbg	line, "inc-guard.c", 47
+L0001:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
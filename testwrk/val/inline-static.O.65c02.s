@@ -0,0 +1,578 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_glob:
+	.word	$0064
+_fp:
+	.addr	_twice
+
+.segment	"RODATA"
+
+S000C:
+	.byte	$62,$75,$6D,$70,$20,$72,$65,$67,$69,$73,$74,$65,$72,$20,$25,$64
+	.byte	$0A,$00
+S0004:
+	.byte	$74,$77,$69,$63,$65,$20,$72,$65,$67,$69,$73,$74,$65,$72,$0A,$00
+S0005:
+	.byte	$74,$77,$69,$63,$65,$20,$6E,$65,$73,$74,$65,$64,$0A,$00
+S0013:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+S0003:
+	.byte	$74,$77,$69,$63,$65,$20,$6C,$6F,$63,$61,$6C,$0A,$00
+S0002:
+	.byte	$74,$77,$69,$63,$65,$20,$63,$6F,$6E,$73,$74,$0A,$00
+S000E:
+	.byte	$73,$68,$61,$64,$6F,$77,$20,$25,$64,$0A,$00
+S000F:
+	.byte	$66,$61,$63,$74,$20,$25,$75,$0A,$00
+S000B:
+	.byte	$62,$75,$6D,$70,$20,$25,$64,$0A,$00
+S000D:
+	.byte	$61,$64,$64,$67,$6C,$6F,$62,$0A,$00
+S0011:
+	.byte	$70,$6F,$73,$20,$25,$75,$0A,$00
+S0010:
+	.byte	$73,$75,$62,$20,$25,$75,$0A,$00
+S0001:
+	.byte	$63,$6E,$74,$20,$25,$75,$0A,$00
+S0012:
+	.byte	$6F,$72,$64,$65,$72,$0A,$00
+S000A:
+	.byte	$66,$69,$72,$73,$74,$0A,$00
+S0008:
+	.byte	$6C,$6D,$75,$6C,$0A,$00
+S0007:
+	.byte	$6C,$6F,$77,$0A,$00
+S0006:
+	.byte	$66,$70,$0A,$00
+S0009:
+	.byte	$61,$62,$63,$00
+
+.segment	"BSS"
+
+_failures:
+	.res	2,$00
+_cnt:
+	.res	1,$00
+_order:
+	.res	8,$00
+_pos:
+	.res	1,$00
+
+; ---------------------------------------------------------------
+; int __near__ twice (int x)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_twice: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     ldax0sp
+	clc
+	adc     (sp)
+	pha
+	txa
+	ldy     #$01
+	adc     (sp),y
+	tax
+	pla
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ getglob (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_getglob: near
+
+.segment	"CODE"
+
+	lda     _glob
+	ldx     _glob+1
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ fact (unsigned int n)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fact: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$01
+	lda     (sp),y
+	ora     (sp)
+	beq     L0002
+	jsr     pushw0sp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     decax1
+	jsr     _fact
+	jsr     tosumulax
+	bra     L0001
+L0002:	tax
+	tya
+L0001:	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ note (unsigned int v)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_note: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldx     #$00
+	lda     _pos
+	inc     _pos
+	asl     a
+	bcc     L0003
+	inx
+	clc
+L0003:	adc     #<(_order)
+	sta     ptr1
+	txa
+	adc     #>(_order)
+	sta     ptr1+1
+	jsr     ldax0sp
+	sta     (ptr1)
+	ldy     #$01
+	txa
+	sta     (ptr1),y
+	jsr     ldax0sp
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ shadow (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_shadow: near
+
+.segment	"CODE"
+
+	lda     #$01
+	jsr     pusha0
+	jsr     _getglob
+	sta     ptr1
+	stx     ptr1+1
+	jsr     ldax0sp
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	lda     #$07
+	jsr     pusha0
+	lda     #$05
+	jsr     pusha0
+	jsr     decsp2
+	lda     #$00
+	ldy     #$06
+	jsr     staxysp
+	bra     L0002
+L003C:	inc     _cnt
+	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L0002:	ldy     #$07
+	jsr     ldaxysp
+	cmp     #$0A
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	bmi     L003C
+	lda     #$05
+	jsr     pusha
+	lda     (sp)
+	clc
+	adc     _cnt
+	sta     _cnt
+	jsr     incsp1
+	lda     _cnt
+	jsr     pusha
+	lda     (sp)
+	clc
+	adc     _cnt
+	sta     _cnt
+	jsr     incsp1
+	lda     _cnt
+	cmp     #$1E
+	beq     L0009
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     _cnt
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	bne     L0009
+	inc     _failures+1
+L0009:	ldy     #$07
+	jsr     pushwysp
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosaddax
+	cpx     #$00
+	bne     L003E
+	cmp     #$0E
+	beq     L000C
+L003E:	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+	bne     L000C
+	inc     _failures+1
+L000C:	ldy     #$05
+	jsr     pushwysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosaddax
+	cpx     #$00
+	bne     L003F
+	cmp     #$0A
+	beq     L000F
+L003F:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+	bne     L000F
+	inc     _failures+1
+L000F:	ldy     #$07
+	jsr     pushwysp
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosaddax
+	ina
+	bne     L0013
+	inx
+L0013:	jsr     pushax
+	jsr     pushw0sp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosaddax
+	jsr     incsp2
+	cpx     #$00
+	bne     L0040
+	cmp     #$1E
+	beq     L0012
+L0040:	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+	bne     L0012
+	inc     _failures+1
+L0012:	lda     _fp
+	ldx     _fp+1
+	jsr     pushax
+	ldx     #$00
+	lda     #$04
+	pha
+	lda     (sp)
+	sta     jmpvec+1
+	ldy     #$01
+	lda     (sp),y
+	sta     jmpvec+2
+	pla
+	jsr     jmpvec
+	jsr     incsp2
+	cpx     #$00
+	bne     L0041
+	cmp     #$08
+	beq     L0019
+L0041:	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+	bne     L0019
+	inc     _failures+1
+L0019:	ldx     #$42
+	lda     #$0F
+	sta     sreg
+	stz     sreg+1
+	lda     #$40
+	jsr     pusheax
+	jsr     tosneeax
+	beq     L001B
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+	bne     L001B
+	inc     _failures+1
+L001B:	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	jsr     ldax0sp
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1)
+	jsr     incsp2
+	cmp     #$61
+	beq     L001D
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+	bne     L001D
+	inc     _failures+1
+L001D:	ldy     #$07
+	jsr     pushwysp
+	ldx     #$00
+	lda     #$03
+	jsr     addeq0sp
+	jsr     ldax0sp
+	jsr     incsp2
+	cpx     #$00
+	bne     L0021
+	cmp     #$0A
+	bne     L0021
+	ldy     #$05
+	lda     (sp),y
+	bne     L0021
+	dey
+	lda     (sp),y
+	cmp     #$07
+	beq     L001F
+L0021:	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	bne     L001F
+	inc     _failures+1
+L001F:	ldy     #$05
+	jsr     pushwysp
+	ldx     #$00
+	lda     #$03
+	jsr     addeq0sp
+	jsr     ldax0sp
+	jsr     incsp2
+	cpx     #$00
+	bne     L0027
+	cmp     #$08
+	bne     L0027
+	ldy     #$03
+	lda     (sp),y
+	bne     L0027
+	dey
+	lda     (sp),y
+	cmp     #$05
+	beq     L0025
+L0027:	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	bne     L0025
+	inc     _failures+1
+L0025:	ldy     #$07
+	jsr     pushwysp
+	jsr     ldax0sp
+	clc
+	adc     _glob
+	pha
+	txa
+	adc     _glob+1
+	tax
+	pla
+	jsr     incsp2
+	cpx     #$00
+	bne     L0042
+	cmp     #$6B
+	beq     L002B
+L0042:	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+	bne     L002B
+	inc     _failures+1
+L002B:	jsr     _shadow
+	cpx     #$00
+	bne     L0043
+	cmp     #$65
+	beq     L0047
+L0043:	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	jsr     _shadow
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	bne     L002E
+	inc     _failures+1
+L002E:	ldx     #$00
+L0047:	lda     #$06
+	jsr     _fact
+	cpx     #$02
+	bne     L0044
+	cmp     #$D0
+	beq     L0031
+L0044:	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	ldx     #$00
+	lda     #$06
+	jsr     _fact
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	bne     L0031
+	inc     _failures+1
+L0031:	ldx     #$00
+	lda     #$0A
+	jsr     _note
+	jsr     pushax
+	ldx     #$00
+	lda     #$03
+	jsr     _note
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	sec
+	sbc     (sp)
+	pha
+	txa
+	ldy     #$01
+	sbc     (sp),y
+	tax
+	pla
+	jsr     incsp4
+	jsr     stax0sp
+	cpx     #$00
+	bne     L0045
+	cmp     #$07
+	beq     L0034
+L0045:	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	bne     L0034
+	inc     _failures+1
+L0034:	lda     _pos
+	cmp     #$02
+	beq     L0037
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	lda     _pos
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	bne     L0037
+	inc     _failures+1
+L0037:	lda     _order
+	clc
+	adc     _order+2
+	pha
+	lda     _order+1
+	adc     _order+2+1
+	tax
+	pla
+	cpx     #$00
+	bne     L0046
+	cmp     #$0D
+	beq     L0039
+L0046:	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+	bne     L0039
+	inc     _failures+1
+L0039:	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	lda     _failures
+	ldx     _failures+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     _failures
+	ldx     _failures+1
+	jmp     incsp8
+
+.endproc
+
@@ -0,0 +1,958 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "inline-static.c", 2708, 1792427131
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_glob:
+	.word	$0064
+_fp:
+	.addr	_twice
+
+.segment	"RODATA"
+
+S000C:
+	.byte	$62,$75,$6D,$70,$20,$72,$65,$67,$69,$73,$74,$65,$72,$20,$25,$64
+	.byte	$0A,$00
+S0004:
+	.byte	$74,$77,$69,$63,$65,$20,$72,$65,$67,$69,$73,$74,$65,$72,$0A,$00
+S0005:
+	.byte	$74,$77,$69,$63,$65,$20,$6E,$65,$73,$74,$65,$64,$0A,$00
+S0013:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+S0003:
+	.byte	$74,$77,$69,$63,$65,$20,$6C,$6F,$63,$61,$6C,$0A,$00
+S0002:
+	.byte	$74,$77,$69,$63,$65,$20,$63,$6F,$6E,$73,$74,$0A,$00
+S000E:
+	.byte	$73,$68,$61,$64,$6F,$77,$20,$25,$64,$0A,$00
+S000F:
+	.byte	$66,$61,$63,$74,$20,$25,$75,$0A,$00
+S000B:
+	.byte	$62,$75,$6D,$70,$20,$25,$64,$0A,$00
+S000D:
+	.byte	$61,$64,$64,$67,$6C,$6F,$62,$0A,$00
+S0011:
+	.byte	$70,$6F,$73,$20,$25,$75,$0A,$00
+S0010:
+	.byte	$73,$75,$62,$20,$25,$75,$0A,$00
+S0001:
+	.byte	$63,$6E,$74,$20,$25,$75,$0A,$00
+S0012:
+	.byte	$6F,$72,$64,$65,$72,$0A,$00
+S000A:
+	.byte	$66,$69,$72,$73,$74,$0A,$00
+S0008:
+	.byte	$6C,$6D,$75,$6C,$0A,$00
+S0007:
+	.byte	$6C,$6F,$77,$0A,$00
+S0006:
+	.byte	$66,$70,$0A,$00
+S0009:
+	.byte	$61,$62,$63,$00
+
+.segment	"BSS"
+
+_failures:
+	.res	2,$00
+_cnt:
+	.res	1,$00
+_order:
+	.res	8,$00
+_pos:
+	.res	1,$00
+
+; ---------------------------------------------------------------
+; void __near__ inc (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_inc: near
+
+	.dbg	func, "inc", "00", static, "_inc"
+
+.segment	"CODE"
+
+	.dbg	line, "inline-static.c", 18
+	ldx     #$00
+	inc     _cnt
+	lda     _cnt
+	.dbg	line, "inline-static.c", 19
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ addcnt (unsigned char n)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_addcnt: near
+
+	.dbg	func, "addcnt", "00", static, "_addcnt"
+	.dbg	sym, "n", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "inline-static.c", 22
+	jsr     pusha
+	.dbg	line, "inline-static.c", 23
+	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	ldx     #$00
+	ldx     #$00
+	clc
+	adc     _cnt
+	sta     _cnt
+	.dbg	line, "inline-static.c", 24
+	jsr     incsp1
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ twice (int x)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_twice: near
+
+	.dbg	func, "twice", "00", static, "_twice"
+	.dbg	sym, "x", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "inline-static.c", 27
+	jsr     pushax
+	.dbg	line, "inline-static.c", 28
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosaddax
+	jmp     L0001
+	.dbg	line, "inline-static.c", 29
+L0001:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ low (unsigned int x)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_low: near
+
+	.dbg	func, "low", "00", static, "_low"
+	.dbg	sym, "x", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "inline-static.c", 32
+	jsr     pushax
+	.dbg	line, "inline-static.c", 33
+	ldy     #$01
+	jsr     ldaxysp
+	ldx     #$00
+	ldx     #$00
+	jmp     L0001
+	.dbg	line, "inline-static.c", 34
+L0001:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; long __near__ lmul (long a, long b)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_lmul: near
+
+	.dbg	func, "lmul", "00", static, "_lmul"
+	.dbg	sym, "a", "00", auto, 4
+	.dbg	sym, "b", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "inline-static.c", 37
+	jsr     pusheax
+	.dbg	line, "inline-static.c", 38
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     tosmuleax
+	jmp     L0001
+	.dbg	line, "inline-static.c", 39
+L0001:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; char __near__ first (const char *s)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_first: near
+
+	.dbg	func, "first", "00", static, "_first"
+	.dbg	sym, "s", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "inline-static.c", 42
+	jsr     pushax
+	.dbg	line, "inline-static.c", 43
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	jmp     L0001
+	.dbg	line, "inline-static.c", 44
+L0001:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ bump (int x)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_bump: near
+
+	.dbg	func, "bump", "00", static, "_bump"
+	.dbg	sym, "x", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "inline-static.c", 47
+	jsr     pushax
+	.dbg	line, "inline-static.c", 49
+	ldy     #$00
+	ldx     #$00
+	lda     #$03
+	jsr     addeqysp
+	.dbg	line, "inline-static.c", 50
+	ldy     #$01
+	jsr     ldaxysp
+	jmp     L0001
+	.dbg	line, "inline-static.c", 51
+L0001:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ getglob (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_getglob: near
+
+	.dbg	func, "getglob", "00", static, "_getglob"
+
+.segment	"CODE"
+
+	.dbg	line, "inline-static.c", 55
+	lda     _glob
+	ldx     _glob+1
+	jmp     L0001
+	.dbg	line, "inline-static.c", 56
+L0001:	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ addglob (int x)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_addglob: near
+
+	.dbg	func, "addglob", "00", static, "_addglob"
+	.dbg	sym, "x", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "inline-static.c", 59
+	jsr     pushax
+	.dbg	line, "inline-static.c", 60
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	jsr     _getglob
+	jsr     tosaddax
+	jmp     L0001
+	.dbg	line, "inline-static.c", 61
+L0001:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ fact (unsigned int n)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fact: near
+
+	.dbg	func, "fact", "00", static, "_fact"
+	.dbg	sym, "n", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "inline-static.c", 64
+	jsr     pushax
+	.dbg	line, "inline-static.c", 65
+	ldy     #$01
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0002
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     decax1
+	jsr     _fact
+	jsr     tosumulax
+	jmp     L0003
+L0002:	ldx     #$00
+	lda     #$01
+L0003:	jmp     L0001
+	.dbg	line, "inline-static.c", 66
+L0001:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ note (unsigned int v)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_note: near
+
+	.dbg	func, "note", "00", static, "_note"
+	.dbg	sym, "v", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "inline-static.c", 69
+	jsr     pushax
+	.dbg	line, "inline-static.c", 70
+	ldx     #$00
+	lda     _pos
+	inc     _pos
+	jsr     aslax1
+	clc
+	adc     #<(_order)
+	tay
+	txa
+	adc     #>(_order)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "inline-static.c", 71
+	ldy     #$01
+	jsr     ldaxysp
+	jmp     L0001
+	.dbg	line, "inline-static.c", 72
+L0001:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ sub (unsigned int a, unsigned int b)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_sub: near
+
+	.dbg	func, "sub", "00", static, "_sub"
+	.dbg	sym, "a", "00", auto, 2
+	.dbg	sym, "b", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "inline-static.c", 75
+	jsr     pushax
+	.dbg	line, "inline-static.c", 76
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tossubax
+	jmp     L0001
+	.dbg	line, "inline-static.c", 77
+L0001:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ shadow (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_shadow: near
+
+	.dbg	func, "shadow", "00", static, "_shadow"
+	.dbg	sym, "glob", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "inline-static.c", 84
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	.dbg	line, "inline-static.c", 85
+	jsr     _getglob
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosaddax
+	jmp     L0001
+	.dbg	line, "inline-static.c", 86
+L0001:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+	.dbg	sym, "i", "00", auto, -2
+	.dbg	sym, "k", "00", auto, -4
+	.dbg	sym, "r", "00", auto, -6
+	.dbg	sym, "u", "00", auto, -8
+
+.segment	"CODE"
+
+	.dbg	line, "inline-static.c", 91
+	jsr     decsp2
+	ldx     #$00
+	lda     #$07
+	jsr     pushax
+	.dbg	line, "inline-static.c", 92
+	ldx     #$00
+	lda     #$05
+	jsr     pushax
+	.dbg	line, "inline-static.c", 95
+	jsr     decsp2
+	ldx     #$00
+	lda     #$00
+	ldy     #$06
+	jsr     staxysp
+	jmp     L0002
+	.dbg	line, "inline-static.c", 96
+L0005:	jsr     _inc
+	.dbg	line, "inline-static.c", 95
+	ldy     #$06
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0002:	ldy     #$07
+	jsr     ldaxysp
+	cmp     #$0A
+	txa
+	sbc     #$00
+	bvc     L0006
+	eor     #$80
+L0006:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0005
+	.dbg	line, "inline-static.c", 98
+	lda     #$05
+	jsr     _addcnt
+	.dbg	line, "inline-static.c", 99
+	lda     _cnt
+	jsr     _addcnt
+	.dbg	line, "inline-static.c", 100
+	ldx     #$00
+	lda     _cnt
+	cmp     #$1E
+	jsr     boolne
+	jeq     L0007
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldx     #$00
+	lda     _cnt
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	bne     L0008
+	inc     _failures+1
+L0008:	lda     _failures
+	ldx     _failures+1
+	.dbg	line, "inline-static.c", 102
+L0007:	ldx     #$00
+	lda     #$15
+	jsr     _twice
+	cpx     #$00
+	bne     L000A
+	cmp     #$2A
+L000A:	jsr     boolne
+	jeq     L0009
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+	bne     L000B
+	inc     _failures+1
+L000B:	lda     _failures
+	ldx     _failures+1
+	.dbg	line, "inline-static.c", 103
+L0009:	ldy     #$05
+	jsr     ldaxysp
+	jsr     _twice
+	cpx     #$00
+	bne     L000D
+	cmp     #$0E
+L000D:	jsr     boolne
+	jeq     L000C
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+	bne     L000E
+	inc     _failures+1
+L000E:	lda     _failures
+	ldx     _failures+1
+	.dbg	line, "inline-static.c", 104
+L000C:	ldy     #$03
+	jsr     ldaxysp
+	jsr     _twice
+	cpx     #$00
+	bne     L0010
+	cmp     #$0A
+L0010:	jsr     boolne
+	jeq     L000F
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+	bne     L0011
+	inc     _failures+1
+L0011:	lda     _failures
+	ldx     _failures+1
+	.dbg	line, "inline-static.c", 105
+L000F:	ldy     #$05
+	jsr     ldaxysp
+	jsr     _twice
+	ina
+	bne     L0013
+	inx
+L0013:	jsr     _twice
+	cpx     #$00
+	bne     L0014
+	cmp     #$1E
+L0014:	jsr     boolne
+	jeq     L0012
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+	bne     L0015
+	inc     _failures+1
+L0015:	lda     _failures
+	ldx     _failures+1
+	.dbg	line, "inline-static.c", 106
+L0012:	lda     _fp
+	ldx     _fp+1
+	jsr     pushax
+	ldx     #$00
+	lda     #$04
+	pha
+	ldy     #$00
+	lda     (sp),y
+	sta     jmpvec+1
+	iny
+	lda     (sp),y
+	sta     jmpvec+2
+	pla
+	jsr     jmpvec
+	jsr     incsp2
+	cpx     #$00
+	bne     L0017
+	cmp     #$08
+L0017:	jsr     boolne
+	jeq     L0016
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+	bne     L0018
+	inc     _failures+1
+L0018:	lda     _failures
+	ldx     _failures+1
+	.dbg	line, "inline-static.c", 108
+L0016:	ldx     #$12
+	lda     #$34
+	jsr     _low
+	cmp     #$34
+	jsr     boolne
+	jeq     L0019
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+	bne     L001A
+	inc     _failures+1
+L001A:	lda     _failures
+	ldx     _failures+1
+	.dbg	line, "inline-static.c", 109
+L0019:	ldx     #$03
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$E8
+	jsr     pusheax
+	ldx     #$03
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$E8
+	jsr     _lmul
+	jsr     pusheax
+	ldx     #$42
+	lda     #$0F
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$40
+	jsr     tosneeax
+	jeq     L001B
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+	bne     L001C
+	inc     _failures+1
+L001C:	lda     _failures
+	ldx     _failures+1
+	.dbg	line, "inline-static.c", 110
+L001B:	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     _first
+	cmp     #$61
+	jsr     boolne
+	jeq     L001D
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+	bne     L001E
+	inc     _failures+1
+L001E:	lda     _failures
+	ldx     _failures+1
+	.dbg	line, "inline-static.c", 112
+L001D:	ldy     #$05
+	jsr     ldaxysp
+	jsr     _bump
+	cpx     #$00
+	bne     L0020
+	cmp     #$0A
+L0020:	jsr     boolne
+	jne     L0021
+	ldy     #$05
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0022
+	cmp     #$07
+L0022:	jsr     boolne
+	jne     L0021
+	ldx     #$00
+	lda     #$00
+	jeq     L0023
+L0021:	ldx     #$00
+	lda     #$01
+L0023:	jeq     L001F
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	bne     L0024
+	inc     _failures+1
+L0024:	lda     _failures
+	ldx     _failures+1
+	.dbg	line, "inline-static.c", 113
+L001F:	ldy     #$03
+	jsr     ldaxysp
+	jsr     _bump
+	cpx     #$00
+	bne     L0026
+	cmp     #$08
+L0026:	jsr     boolne
+	jne     L0027
+	ldy     #$03
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0028
+	cmp     #$05
+L0028:	jsr     boolne
+	jne     L0027
+	ldx     #$00
+	lda     #$00
+	jeq     L0029
+L0027:	ldx     #$00
+	lda     #$01
+L0029:	jeq     L0025
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	bne     L002A
+	inc     _failures+1
+L002A:	lda     _failures
+	ldx     _failures+1
+	.dbg	line, "inline-static.c", 115
+L0025:	ldy     #$05
+	jsr     ldaxysp
+	jsr     _addglob
+	cpx     #$00
+	bne     L002C
+	cmp     #$6B
+L002C:	jsr     boolne
+	jeq     L002B
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+	bne     L002D
+	inc     _failures+1
+L002D:	lda     _failures
+	ldx     _failures+1
+	.dbg	line, "inline-static.c", 116
+L002B:	jsr     _shadow
+	cpx     #$00
+	bne     L002F
+	cmp     #$65
+L002F:	jsr     boolne
+	jeq     L002E
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	jsr     _shadow
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	bne     L0030
+	inc     _failures+1
+L0030:	lda     _failures
+	ldx     _failures+1
+	.dbg	line, "inline-static.c", 117
+L002E:	ldx     #$00
+	lda     #$06
+	jsr     _fact
+	cpx     #$02
+	bne     L0032
+	cmp     #$D0
+L0032:	jsr     boolne
+	jeq     L0031
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	ldx     #$00
+	lda     #$06
+	jsr     _fact
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	bne     L0033
+	inc     _failures+1
+L0033:	lda     _failures
+	ldx     _failures+1
+	.dbg	line, "inline-static.c", 119
+L0031:	ldx     #$00
+	lda     #$0A
+	jsr     _note
+	jsr     pushax
+	ldx     #$00
+	lda     #$03
+	jsr     _note
+	jsr     _sub
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "inline-static.c", 120
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0035
+	cmp     #$07
+L0035:	jsr     boolne
+	jeq     L0034
+	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	bne     L0036
+	inc     _failures+1
+L0036:	lda     _failures
+	ldx     _failures+1
+	.dbg	line, "inline-static.c", 121
+L0034:	ldx     #$00
+	lda     _pos
+	cmp     #$02
+	jsr     boolne
+	jeq     L0037
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	ldx     #$00
+	lda     _pos
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	bne     L0038
+	inc     _failures+1
+L0038:	lda     _failures
+	ldx     _failures+1
+	.dbg	line, "inline-static.c", 122
+L0037:	lda     _order
+	ldx     _order+1
+	jsr     pushax
+	lda     _order+2
+	ldx     _order+2+1
+	jsr     tosaddax
+	cpx     #$00
+	bne     L003A
+	cmp     #$0D
+L003A:	jsr     boolne
+	jeq     L0039
+	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+	bne     L003B
+	inc     _failures+1
+L003B:	lda     _failures
+	ldx     _failures+1
+	.dbg	line, "inline-static.c", 124
+L0039:	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	lda     _failures
+	ldx     _failures+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "inline-static.c", 125
+	lda     _failures
+	ldx     _failures+1
+	jmp     L0001
+	.dbg	line, "inline-static.c", 126
+L0001:	jsr     incsp8
+	rts
+
+	.dbg	line
+.endproc
+
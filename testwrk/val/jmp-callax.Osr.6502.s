@@ -0,0 +1,76 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.export		_main
+
+.segment	"BSS"
+
+_val:
+	.res	1,$00
+
+; ---------------------------------------------------------------
+; void __near__ foo (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_foo: near
+
+.segment	"CODE"
+
+	lda     #$05
+	sta     _val
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ wrap (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_wrap: near
+
+.segment	"CODE"
+
+	lda     #<_foo
+	ldx     #>_foo
+	jmp     callax
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #$00
+	sta     _val
+	jsr     _wrap
+	ldx     #$00
+	lda     _val
+	cmp     #$05
+	bne     L0004
+	txa
+	rts
+L0004:	lda     #$01
+	rts
+
+.endproc
+
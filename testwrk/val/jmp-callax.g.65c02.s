@@ -0,0 +1,103 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "jmp-callax.c", 275, 1613073744
+	.forceimport	__STARTUP__
+	.export		_main
+
+.segment	"BSS"
+
+_val:
+	.res	1,$00
+
+; ---------------------------------------------------------------
+; void __near__ foo (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_foo: near
+
+	.dbg	func, "foo", "00", static, "_foo"
+
+.segment	"CODE"
+
+	.dbg	line, "jmp-callax.c", 4
+	ldx     #$00
+	lda     #$05
+	sta     _val
+	.dbg	line, "jmp-callax.c", 5
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ wrap (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_wrap: near
+
+	.dbg	func, "wrap", "00", static, "_wrap"
+
+.segment	"CODE"
+
+	.dbg	line, "jmp-callax.c", 9
+	lda     #<_foo
+	.dbg	line, "jmp-callax.c", 10
+	ldx     #>_foo
+	.dbg	line, "jmp-callax.c", 11
+	jmp     callax
+	.dbg	line, "jmp-callax.c", 13
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "jmp-callax.c", 17
+	ldx     #$00
+	lda     #$00
+	sta     _val
+	.dbg	line, "jmp-callax.c", 18
+	jsr     _wrap
+	.dbg	line, "jmp-callax.c", 20
+	ldx     #$00
+	lda     _val
+	cmp     #$05
+	jsr     booleq
+	jeq     L0002
+	ldx     #$00
+	lda     #$00
+	jmp     L0003
+L0002:	ldx     #$00
+	lda     #$01
+L0003:	jmp     L0001
+	.dbg	line, "jmp-callax.c", 21
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,529 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_memmove
+	.import		_printf
+	.import		_exit
+	.export		_main
+
+.segment	"RODATA"
+
+S0020:
+	.byte	$55,$6E,$65,$78,$70,$65,$63,$74,$65,$64,$20,$76,$61,$6C,$75,$65
+	.byte	$20,$69,$6E,$20,$62,$75,$66,$66,$65,$72,$20,$61,$74,$20,$70,$6F
+	.byte	$73,$69,$74,$69,$6F,$6E,$20,$25,$75,$21,$00
+S0010	:=	S0020+0
+S0008:
+	.byte	$55,$6E,$65,$78,$70,$65,$63,$74,$65,$64,$20,$76,$61,$6C,$75,$65
+	.byte	$20,$61,$74,$20,$72,$61,$6E,$67,$65,$20,$73,$74,$61,$72,$74,$21
+	.byte	$00
+S001A:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$76,$61,$6C,$75,$65,$3A,$20
+	.byte	$25,$75,$2C,$20,$62,$75,$74,$20,$69,$73,$20,$25,$75,$21,$0A,$00
+S0006	:=	S001A+0
+S001E	:=	S001A+0
+S0012	:=	S001A+0
+S0022	:=	S001A+0
+S000A	:=	S001A+0
+S000E	:=	S001A+0
+S0016	:=	S001A+0
+S0018:
+	.byte	$55,$6E,$65,$78,$70,$65,$63,$74,$65,$64,$20,$76,$61,$6C,$75,$65
+	.byte	$20,$61,$74,$20,$72,$61,$6E,$67,$65,$20,$65,$6E,$64,$21,$00
+S0014:
+	.byte	$55,$6E,$65,$78,$70,$65,$63,$74,$65,$64,$20,$76,$61,$6C,$75,$65
+	.byte	$20,$62,$65,$66,$6F,$72,$65,$20,$72,$61,$6E,$67,$65,$21,$00
+S0004	:=	S0014+0
+S000C:
+	.byte	$55,$6E,$65,$78,$70,$65,$63,$74,$65,$64,$20,$76,$61,$6C,$75,$65
+	.byte	$20,$61,$66,$74,$65,$72,$20,$72,$61,$6E,$67,$65,$21,$00
+S001C	:=	S000C+0
+S0002:
+	.byte	$6C,$69,$62,$5F,$63,$6F,$6D,$6D,$6F,$6E,$5F,$6D,$65,$6D,$6D,$6F
+	.byte	$76,$65,$2E,$63,$00
+S0013:
+	.byte	$46,$61,$69,$6C,$20,$61,$74,$20,$6C,$69,$6E,$65,$20,$25,$64,$3A
+	.byte	$0A,$00
+S000B	:=	S0013+0
+S0007	:=	S0013+0
+S0003	:=	S0013+0
+S0017	:=	S0013+0
+S000F	:=	S0013+0
+S001F	:=	S0013+0
+S001B	:=	S0013+0
+S0023:
+	.byte	$50,$61,$73,$73,$65,$64,$0A,$00
+S0001:
+	.byte	$25,$73,$3A,$20,$00
+S001D	:=	S001A+30
+S0015	:=	S001A+30
+S0011	:=	S001A+30
+S000D	:=	S001A+30
+S0021	:=	S001A+30
+S0009	:=	S001A+30
+S0005	:=	S001A+30
+S0019	:=	S001A+30
+
+.segment	"BSS"
+
+_Buffer:
+	.res	387,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jsr     decsp6
+	ldx     #$00
+	txa
+	ldy     #$04
+	jsr     staxysp
+	bra     L0002
+L0005:	ldy     #$05
+	jsr     ldaxysp
+	ina
+	bne     L0007
+	inx
+L0007:	clc
+	adc     #<(_Buffer)
+	sta     ptr1
+	txa
+	adc     #>(_Buffer)
+	sta     ptr1+1
+	ldy     #$04
+	lda     (sp),y
+	and     #$7F
+	sta     (ptr1)
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L0002:	ldy     #$05
+	lda     (sp),y
+	cmp     #$01
+	bne     L0006
+	dey
+	lda     (sp),y
+	cmp     #$80
+L0006:	bcc     L0005
+	lda     #$FF
+	sta     _Buffer
+	sta     _Buffer+386
+	lda     #<(_Buffer+2)
+	ldx     #>(_Buffer+2)
+	jsr     pushax
+	lda     #<(_Buffer+1)
+	ldx     #>(_Buffer+1)
+	jsr     pushax
+	ldx     #$01
+	lda     #$80
+	jsr     _memmove
+	jsr     stax0sp
+	ldx     #$00
+	lda     #$FF
+	cmp     _Buffer
+	beq     L001E
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     #$18
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	lda     #$FF
+	jsr     pusha0
+	lda     _Buffer
+	jsr     pusha0
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+	ldx     #$00
+L001E:	txa
+	cmp     _Buffer+1
+	beq     L001F
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	lda     #$1B
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	jsr     push0
+	lda     _Buffer+1
+	jsr     pusha0
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+	ldx     #$00
+L001F:	lda     #$FF
+	cmp     _Buffer+386
+	beq     L0020
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	lda     #$1E
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	lda     #$FF
+	jsr     pusha0
+	lda     _Buffer+386
+	jsr     pusha0
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+	ldx     #$00
+L0020:	txa
+	ldy     #$04
+	jsr     staxysp
+	jmp     L000B
+L000E:	ldy     #$04
+	lda     (sp),y
+	and     #$7F
+	sta     sreg
+	iny
+	jsr     ldaxysp
+	jsr     incax2
+	sta     ptr1
+	txa
+	clc
+	adc     #>(_Buffer)
+	sta     ptr1+1
+	ldy     #<(_Buffer)
+	lda     (ptr1),y
+	cmp     sreg
+	beq     L0010
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	lda     #$23
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     incax2
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	ldy     #$06
+	lda     (sp),y
+	and     #$7F
+	jsr     pusha0
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     incax2
+	sta     ptr1
+	txa
+	clc
+	adc     #>(_Buffer)
+	sta     ptr1+1
+	ldy     #<(_Buffer)
+	lda     (ptr1),y
+	jsr     pusha0
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0010:	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L000B:	ldy     #$05
+	lda     (sp),y
+	cmp     #$01
+	bne     L000F
+	dey
+	lda     (sp),y
+	cmp     #$80
+L000F:	jcc     L000E
+	ldx     #$00
+	lda     _Buffer+385
+	ldy     #$02
+	jsr     staxysp
+	lda     #<(_Buffer+1)
+	ldx     #>(_Buffer+1)
+	jsr     pushax
+	lda     #<(_Buffer+2)
+	ldx     #>(_Buffer+2)
+	jsr     pushax
+	ldx     #$01
+	lda     #$80
+	jsr     _memmove
+	jsr     stax0sp
+	lda     #$FF
+	cmp     _Buffer
+	beq     L0011
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	lda     #$2C
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0016)
+	ldx     #>(S0016)
+	jsr     pushax
+	lda     #$FF
+	jsr     pusha0
+	lda     _Buffer
+	jsr     pusha0
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0011:	ldy     #$03
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0022
+	cmp     _Buffer+385
+	beq     L0023
+L0022:	lda     #<(S0017)
+	ldx     #>(S0017)
+	jsr     pushax
+	lda     #$2F
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0018)
+	ldx     #>(S0018)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0019)
+	ldx     #>(S0019)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S001A)
+	ldx     #>(S001A)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	lda     _Buffer+385
+	jsr     pusha0
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+	ldx     #$00
+L0023:	lda     #$FF
+	cmp     _Buffer+386
+	beq     L0021
+	lda     #<(S001B)
+	ldx     #>(S001B)
+	jsr     pushax
+	lda     #$32
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S001C)
+	ldx     #>(S001C)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S001D)
+	ldx     #>(S001D)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S001E)
+	ldx     #>(S001E)
+	jsr     pushax
+	lda     #$FF
+	jsr     pusha0
+	lda     _Buffer+386
+	jsr     pusha0
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+	ldx     #$00
+L0021:	txa
+	ldy     #$04
+	jsr     staxysp
+	jmp     L0014
+L0017:	ldy     #$04
+	lda     (sp),y
+	and     #$7F
+	sta     sreg
+	iny
+	jsr     ldaxysp
+	ina
+	bne     L001A
+	inx
+L001A:	sta     ptr1
+	txa
+	clc
+	adc     #>(_Buffer)
+	sta     ptr1+1
+	ldy     #<(_Buffer)
+	lda     (ptr1),y
+	cmp     sreg
+	beq     L0019
+	lda     #<(S001F)
+	ldx     #>(S001F)
+	jsr     pushax
+	lda     #$37
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0020)
+	ldx     #>(S0020)
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	ina
+	bne     L001B
+	inx
+L001B:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0021)
+	ldx     #>(S0021)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0022)
+	ldx     #>(S0022)
+	jsr     pushax
+	ldy     #$06
+	lda     (sp),y
+	and     #$7F
+	jsr     pusha0
+	ldy     #$09
+	jsr     ldaxysp
+	ina
+	bne     L001C
+	inx
+L001C:	sta     ptr1
+	txa
+	clc
+	adc     #>(_Buffer)
+	sta     ptr1+1
+	ldy     #<(_Buffer)
+	lda     (ptr1),y
+	jsr     pusha0
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0019:	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L0014:	ldy     #$05
+	lda     (sp),y
+	cmp     #$01
+	bne     L0018
+	dey
+	lda     (sp),y
+	cmp     #$80
+L0018:	jcc     L0017
+	jsr     incsp6
+	lda     #<(S0023)
+	ldx     #>(S0023)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
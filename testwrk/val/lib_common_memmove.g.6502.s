@@ -0,0 +1,618 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "lib_common_memmove.c", 1924, 1613073744
+	.dbg		file, "/root/repo/include/string.h", 5104, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "unittest.h", 4753, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/stdlib.h", 5999, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "memmove", "00", extern, "_memmove"
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.dbg		sym, "exit", "00", extern, "_exit"
+	.import		_memmove
+	.import		_printf
+	.import		_exit
+	.export		_main
+
+.segment	"RODATA"
+
+S0020:
+	.byte	$55,$6E,$65,$78,$70,$65,$63,$74,$65,$64,$20,$76,$61,$6C,$75,$65
+	.byte	$20,$69,$6E,$20,$62,$75,$66,$66,$65,$72,$20,$61,$74,$20,$70,$6F
+	.byte	$73,$69,$74,$69,$6F,$6E,$20,$25,$75,$21,$00
+S0010	:=	S0020+0
+S0008:
+	.byte	$55,$6E,$65,$78,$70,$65,$63,$74,$65,$64,$20,$76,$61,$6C,$75,$65
+	.byte	$20,$61,$74,$20,$72,$61,$6E,$67,$65,$20,$73,$74,$61,$72,$74,$21
+	.byte	$00
+S001A:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$76,$61,$6C,$75,$65,$3A,$20
+	.byte	$25,$75,$2C,$20,$62,$75,$74,$20,$69,$73,$20,$25,$75,$21,$0A,$00
+S0006	:=	S001A+0
+S001E	:=	S001A+0
+S0012	:=	S001A+0
+S0022	:=	S001A+0
+S000A	:=	S001A+0
+S000E	:=	S001A+0
+S0016	:=	S001A+0
+S0018:
+	.byte	$55,$6E,$65,$78,$70,$65,$63,$74,$65,$64,$20,$76,$61,$6C,$75,$65
+	.byte	$20,$61,$74,$20,$72,$61,$6E,$67,$65,$20,$65,$6E,$64,$21,$00
+S0014:
+	.byte	$55,$6E,$65,$78,$70,$65,$63,$74,$65,$64,$20,$76,$61,$6C,$75,$65
+	.byte	$20,$62,$65,$66,$6F,$72,$65,$20,$72,$61,$6E,$67,$65,$21,$00
+S0004	:=	S0014+0
+S000C:
+	.byte	$55,$6E,$65,$78,$70,$65,$63,$74,$65,$64,$20,$76,$61,$6C,$75,$65
+	.byte	$20,$61,$66,$74,$65,$72,$20,$72,$61,$6E,$67,$65,$21,$00
+S001C	:=	S000C+0
+S0002:
+	.byte	$6C,$69,$62,$5F,$63,$6F,$6D,$6D,$6F,$6E,$5F,$6D,$65,$6D,$6D,$6F
+	.byte	$76,$65,$2E,$63,$00
+S0013:
+	.byte	$46,$61,$69,$6C,$20,$61,$74,$20,$6C,$69,$6E,$65,$20,$25,$64,$3A
+	.byte	$0A,$00
+S000B	:=	S0013+0
+S0007	:=	S0013+0
+S0003	:=	S0013+0
+S0017	:=	S0013+0
+S000F	:=	S0013+0
+S001F	:=	S0013+0
+S001B	:=	S0013+0
+S0023:
+	.byte	$50,$61,$73,$73,$65,$64,$0A,$00
+S0001:
+	.byte	$25,$73,$3A,$20,$00
+S001D	:=	S001A+30
+S0015	:=	S001A+30
+S0011	:=	S001A+30
+S000D	:=	S001A+30
+S0021	:=	S001A+30
+S0009	:=	S001A+30
+S0005	:=	S001A+30
+S0019	:=	S001A+30
+
+.segment	"BSS"
+
+_Buffer:
+	.res	387,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "lib_common_memmove.c", 9
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "lib_common_memmove.c", 14
+	jsr     decsp6
+	ldx     #$00
+	lda     #$00
+	ldy     #$04
+	jsr     staxysp
+	jmp     L0002
+	.dbg	line, "lib_common_memmove.c", 15
+L0005:	ldy     #$05
+	jsr     ldaxysp
+	jsr     incax1
+	clc
+	adc     #<(_Buffer)
+	tay
+	txa
+	adc     #>(_Buffer)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	ldx     #$00
+	and     #$7F
+	ldx     #$00
+	ldy     #$00
+	jsr     staspidx
+	.dbg	line, "lib_common_memmove.c", 14
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0002:	ldy     #$05
+	jsr     ldaxysp
+	cpx     #$01
+	bne     L0006
+	cmp     #$80
+L0006:	jsr     boolult
+	jne     L0005
+	.dbg	line, "lib_common_memmove.c", 17
+	ldx     #$00
+	lda     #$FF
+	sta     _Buffer
+	.dbg	line, "lib_common_memmove.c", 18
+	ldx     #$00
+	lda     #$FF
+	sta     _Buffer+386
+	.dbg	line, "lib_common_memmove.c", 21
+	lda     #<(_Buffer+2)
+	ldx     #>(_Buffer+2)
+	jsr     pushax
+	lda     #<(_Buffer+1)
+	ldx     #>(_Buffer+1)
+	jsr     pushax
+	ldx     #$01
+	lda     #$80
+	jsr     _memmove
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "lib_common_memmove.c", 24
+	ldx     #$00
+	lda     #$FF
+	jsr     pushax
+	ldx     #$00
+	lda     _Buffer
+	jsr     tosneax
+	jeq     L0007
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldx     #$00
+	lda     #$18
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldx     #$00
+	lda     #$FF
+	jsr     pushax
+	ldx     #$00
+	lda     _Buffer
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+	.dbg	line, "lib_common_memmove.c", 27
+L0007:	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     _Buffer+1
+	jsr     tosneax
+	jeq     L0008
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldx     #$00
+	lda     #$1B
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	lda     _Buffer+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+	.dbg	line, "lib_common_memmove.c", 30
+L0008:	ldx     #$00
+	lda     #$FF
+	jsr     pushax
+	ldx     #$00
+	lda     _Buffer+386
+	jsr     tosneax
+	jeq     L0009
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldx     #$00
+	lda     #$1E
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	ldx     #$00
+	lda     #$FF
+	jsr     pushax
+	ldx     #$00
+	lda     _Buffer+386
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+	.dbg	line, "lib_common_memmove.c", 33
+L0009:	ldx     #$00
+	lda     #$00
+	ldy     #$04
+	jsr     staxysp
+	jmp     L000A
+	.dbg	line, "lib_common_memmove.c", 35
+L000D:	ldy     #$05
+	jsr     ldaxysp
+	ldx     #$00
+	and     #$7F
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     incax2
+	clc
+	adc     #<(_Buffer)
+	tay
+	txa
+	adc     #>(_Buffer)
+	tax
+	tya
+	ldy     #$00
+	jsr     ldauidx
+	jsr     tosneax
+	jeq     L000F
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	ldx     #$00
+	lda     #$23
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     incax2
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	ldx     #$00
+	and     #$7F
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     incax2
+	clc
+	adc     #<(_Buffer)
+	tay
+	txa
+	adc     #>(_Buffer)
+	tax
+	tya
+	ldy     #$00
+	jsr     ldauidx
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+	.dbg	line, "lib_common_memmove.c", 33
+L000F:	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L000A
+L000A:	ldy     #$05
+	jsr     ldaxysp
+	cpx     #$01
+	bne     L000E
+	cmp     #$80
+L000E:	jsr     boolult
+	jne     L000D
+	.dbg	line, "lib_common_memmove.c", 38
+	ldx     #$00
+	lda     _Buffer+385
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "lib_common_memmove.c", 41
+	lda     #<(_Buffer+1)
+	ldx     #>(_Buffer+1)
+	jsr     pushax
+	lda     #<(_Buffer+2)
+	ldx     #>(_Buffer+2)
+	jsr     pushax
+	ldx     #$01
+	lda     #$80
+	jsr     _memmove
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "lib_common_memmove.c", 44
+	ldx     #$00
+	lda     #$FF
+	jsr     pushax
+	ldx     #$00
+	lda     _Buffer
+	jsr     tosneax
+	jeq     L0010
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	ldx     #$00
+	lda     #$2C
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0016)
+	ldx     #>(S0016)
+	jsr     pushax
+	ldx     #$00
+	lda     #$FF
+	jsr     pushax
+	ldx     #$00
+	lda     _Buffer
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+	.dbg	line, "lib_common_memmove.c", 47
+L0010:	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldx     #$00
+	lda     _Buffer+385
+	jsr     tosneax
+	jeq     L0011
+	lda     #<(S0017)
+	ldx     #>(S0017)
+	jsr     pushax
+	ldx     #$00
+	lda     #$2F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0018)
+	ldx     #>(S0018)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0019)
+	ldx     #>(S0019)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S001A)
+	ldx     #>(S001A)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldx     #$00
+	lda     _Buffer+385
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+	.dbg	line, "lib_common_memmove.c", 50
+L0011:	ldx     #$00
+	lda     #$FF
+	jsr     pushax
+	ldx     #$00
+	lda     _Buffer+386
+	jsr     tosneax
+	jeq     L0012
+	lda     #<(S001B)
+	ldx     #>(S001B)
+	jsr     pushax
+	ldx     #$00
+	lda     #$32
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S001C)
+	ldx     #>(S001C)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S001D)
+	ldx     #>(S001D)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S001E)
+	ldx     #>(S001E)
+	jsr     pushax
+	ldx     #$00
+	lda     #$FF
+	jsr     pushax
+	ldx     #$00
+	lda     _Buffer+386
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+	.dbg	line, "lib_common_memmove.c", 53
+L0012:	ldx     #$00
+	lda     #$00
+	ldy     #$04
+	jsr     staxysp
+	jmp     L0013
+	.dbg	line, "lib_common_memmove.c", 55
+L0016:	ldy     #$05
+	jsr     ldaxysp
+	ldx     #$00
+	and     #$7F
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     incax1
+	clc
+	adc     #<(_Buffer)
+	tay
+	txa
+	adc     #>(_Buffer)
+	tax
+	tya
+	ldy     #$00
+	jsr     ldauidx
+	jsr     tosneax
+	jeq     L0018
+	lda     #<(S001F)
+	ldx     #>(S001F)
+	jsr     pushax
+	ldx     #$00
+	lda     #$37
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0020)
+	ldx     #>(S0020)
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     incax1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0021)
+	ldx     #>(S0021)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0022)
+	ldx     #>(S0022)
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	ldx     #$00
+	and     #$7F
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     incax1
+	clc
+	adc     #<(_Buffer)
+	tay
+	txa
+	adc     #>(_Buffer)
+	tax
+	tya
+	ldy     #$00
+	jsr     ldauidx
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+	.dbg	line, "lib_common_memmove.c", 53
+L0018:	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0013
+L0013:	ldy     #$05
+	jsr     ldaxysp
+	cpx     #$01
+	bne     L0017
+	cmp     #$80
+L0017:	jsr     boolult
+	jne     L0016
+	.dbg	line, "lib_common_memmove.c", 57
+	jsr     incsp6
+	.dbg	line, "lib_common_memmove.c", 58
+	lda     #<(S0023)
+	ldx     #>(S0023)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
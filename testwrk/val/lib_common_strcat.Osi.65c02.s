@@ -0,0 +1,492 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_strcat
+	.import		_strlen
+	.import		_printf
+	.import		_exit
+	.export		_main
+
+.segment	"RODATA"
+
+S0010:
+	.byte	$55,$6E,$65,$78,$70,$65,$63,$74,$65,$64,$20,$73,$74,$72,$69,$6E
+	.byte	$67,$20,$6C,$65,$6E,$67,$74,$68,$20,$77,$68,$69,$6C,$65,$20,$73
+	.byte	$74,$72,$69,$6E,$67,$20,$63,$6F,$6E,$63,$61,$74,$65,$6E,$61,$74
+	.byte	$69,$6F,$6E,$20,$74,$6F,$20,$6E,$6F,$6E,$2D,$65,$6D,$70,$74,$79
+	.byte	$20,$62,$75,$66,$66,$65,$72,$21,$00
+S000C:
+	.byte	$55,$6E,$65,$78,$70,$65,$63,$74,$65,$64,$20,$73,$74,$72,$69,$6E
+	.byte	$67,$20,$6C,$65,$6E,$67,$74,$68,$20,$77,$68,$69,$6C,$65,$20,$73
+	.byte	$74,$72,$69,$6E,$67,$20,$63,$6F,$6E,$63,$61,$74,$65,$6E,$61,$74
+	.byte	$69,$6F,$6E,$20,$74,$6F,$20,$65,$6D,$70,$74,$79,$20,$62,$75,$66
+	.byte	$66,$65,$72,$21,$00
+S0008:
+	.byte	$44,$65,$73,$74,$69,$6E,$61,$74,$69,$6F,$6E,$20,$73,$74,$72,$69
+	.byte	$6E,$67,$20,$69,$6E,$69,$74,$69,$61,$6C,$69,$7A,$61,$74,$69,$6F
+	.byte	$6E,$20,$6F,$72,$20,$27,$73,$74,$72,$6C,$65,$6E,$28,$29,$27,$20
+	.byte	$70,$72,$6F,$62,$6C,$65,$6D,$21,$00
+S0018:
+	.byte	$55,$6E,$65,$78,$70,$65,$63,$74,$65,$64,$20,$64,$65,$73,$74,$69
+	.byte	$6E,$61,$74,$69,$6F,$6E,$20,$62,$75,$66,$66,$65,$72,$20,$63,$6F
+	.byte	$6E,$74,$65,$6E,$74,$73,$20,$61,$74,$20,$70,$6F,$73,$69,$74,$69
+	.byte	$6F,$6E,$20,$25,$75,$21,$0A,$00
+S0004:
+	.byte	$53,$6F,$75,$72,$63,$65,$20,$73,$74,$72,$69,$6E,$67,$20,$69,$6E
+	.byte	$69,$74,$69,$61,$6C,$69,$7A,$61,$74,$69,$6F,$6E,$20,$6F,$72,$20
+	.byte	$27,$73,$74,$72,$6C,$65,$6E,$28,$29,$27,$20,$70,$72,$6F,$62,$6C
+	.byte	$65,$6D,$21,$00
+S0016:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$73,$74,$61,$74,$75,$73,$20
+	.byte	$73,$68,$6F,$75,$6C,$64,$20,$62,$65,$20,$74,$72,$75,$65,$20,$62
+	.byte	$75,$74,$20,$77,$61,$73,$6E,$27,$74,$21,$0A,$00
+S0006:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$76,$61,$6C,$75,$65,$3A,$20
+	.byte	$25,$75,$2C,$20,$62,$75,$74,$20,$69,$73,$20,$25,$75,$21,$0A,$00
+S001A	:=	S0006+0
+S000A	:=	S0006+0
+S000E	:=	S0006+0
+S0012	:=	S0006+0
+S0014:
+	.byte	$49,$6E,$76,$61,$6C,$69,$64,$20,$72,$65,$74,$75,$72,$6E,$20,$76
+	.byte	$61,$6C,$75,$65,$21,$00
+S0002:
+	.byte	$6C,$69,$62,$5F,$63,$6F,$6D,$6D,$6F,$6E,$5F,$73,$74,$72,$63,$61
+	.byte	$74,$2E,$63,$00
+S000F:
+	.byte	$46,$61,$69,$6C,$20,$61,$74,$20,$6C,$69,$6E,$65,$20,$25,$64,$3A
+	.byte	$0A,$00
+S000B	:=	S000F+0
+S0017	:=	S000F+0
+S0003	:=	S000F+0
+S0013	:=	S000F+0
+S0007	:=	S000F+0
+S001B:
+	.byte	$50,$61,$73,$73,$65,$64,$0A,$00
+S0001:
+	.byte	$25,$73,$3A,$20,$00
+S0011	:=	S0018+54
+S000D	:=	S0018+54
+S0019	:=	S0018+54
+S0009	:=	S0018+54
+S0005	:=	S0018+54
+S0015	:=	S0018+54
+
+.segment	"BSS"
+
+_SourceString:
+	.res	258,$00
+_DestinationString:
+	.res	515,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jsr     decsp6
+	ldy     #$04
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	bra     L001C
+L0005:	lda     #<(_SourceString)
+	ldy     #$04
+	clc
+	adc     (sp),y
+	sta     ptr1
+	lda     #>(_SourceString)
+	iny
+	adc     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	and     #$7F
+	ina
+	sta     (ptr1)
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$05
+L001C:	lda     (sp),y
+	cmp     #$01
+	bne     L0006
+	dey
+	lda     (sp),y
+	cmp     #$01
+L0006:	bcc     L0005
+	lda     #<(_SourceString)
+	ldy     #$04
+	clc
+	adc     (sp),y
+	sta     ptr1
+	lda     #>(_SourceString)
+	iny
+	adc     (sp),y
+	sta     ptr1+1
+	lda     #$00
+	sta     (ptr1)
+	ldx     #$01
+	txa
+	jsr     pushax
+	lda     #<(_SourceString)
+	ldx     #>(_SourceString)
+	jsr     _strlen
+	jsr     tosicmp
+	beq     L0008
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     #$14
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldx     #$01
+	txa
+	jsr     pushax
+	lda     #<(_SourceString)
+	ldx     #>(_SourceString)
+	jsr     _strlen
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0008:	stz     _DestinationString
+	jsr     push0
+	lda     #<(_DestinationString)
+	ldx     #>(_DestinationString)
+	jsr     _strlen
+	jsr     tosicmp
+	beq     L0009
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	lda     #$19
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	jsr     push0
+	lda     #<(_DestinationString)
+	ldx     #>(_DestinationString)
+	jsr     _strlen
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0009:	lda     #<(_DestinationString)
+	ldx     #>(_DestinationString)
+	jsr     pushax
+	lda     #<(_SourceString)
+	ldx     #>(_SourceString)
+	jsr     _strcat
+	ldx     #$01
+	txa
+	jsr     pushax
+	lda     #<(_DestinationString)
+	ldx     #>(_DestinationString)
+	jsr     _strlen
+	jsr     tosicmp
+	beq     L000A
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	lda     #$1F
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	ldx     #$01
+	txa
+	jsr     pushax
+	lda     #<(_DestinationString)
+	ldx     #>(_DestinationString)
+	jsr     _strlen
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L000A:	lda     #<(_DestinationString)
+	ldx     #>(_DestinationString)
+	jsr     pushax
+	lda     #<(_SourceString)
+	ldx     #>(_SourceString)
+	jsr     _strcat
+	jsr     stax0sp
+	ldx     #$02
+	txa
+	jsr     pushax
+	lda     #<(_DestinationString)
+	ldx     #>(_DestinationString)
+	jsr     _strlen
+	jsr     tosicmp
+	beq     L000B
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	lda     #$25
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	ldx     #$02
+	txa
+	jsr     pushax
+	lda     #<(_DestinationString)
+	ldx     #>(_DestinationString)
+	jsr     _strlen
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L000B:	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	cpx     #>(_DestinationString)
+	bne     L0019
+	cmp     #<(_DestinationString)
+L0019:	jsr     booleq
+	tax
+	bne     L000C
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	lda     #$29
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0016)
+	ldx     #>(S0016)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L000C:	ldy     #$02
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L001E
+L0010:	ldy     #$04
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L001D
+L0015:	ldy     #$03
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	sta     tmp1
+	clc
+	lda     ptr1
+	sta     ptr1
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     tmp1
+	tax
+	pla
+	jsr     pushax
+	lda     #<(_DestinationString)
+	clc
+	adc     (sp)
+	sta     ptr1
+	lda     #>(_DestinationString)
+	ldy     #$01
+	adc     (sp),y
+	sta     ptr1+1
+	lda     (ptr1)
+	jsr     pusha0
+	ldy     #$08
+	lda     (sp),y
+	and     #$7F
+	ina
+	bne     L0017
+	ldx     #$01
+L0017:	jsr     pushax
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	iny
+	cmp     (sp),y
+	bne     L001F
+	txa
+	iny
+	cmp     (sp),y
+	beq     L0018
+L001F:	lda     #<(S0017)
+	ldx     #>(S0017)
+	jsr     pushax
+	lda     #$33
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0018)
+	ldx     #>(S0018)
+	jsr     pushax
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0019)
+	ldx     #>(S0019)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S001A)
+	ldx     #>(S001A)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0018:	jsr     incsp6
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$05
+L001D:	lda     (sp),y
+	cmp     #$01
+	bne     L0016
+	dey
+	lda     (sp),y
+	cmp     #$01
+L0016:	jcc     L0015
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$03
+L001E:	lda     (sp),y
+	cmp     #$00
+	bne     L0011
+	dey
+	lda     (sp),y
+	cmp     #$02
+L0011:	jcc     L0010
+	jsr     incsp6
+	lda     #<(S001B)
+	ldx     #>(S001B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
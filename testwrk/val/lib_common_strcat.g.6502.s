@@ -0,0 +1,537 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "lib_common_strcat.c", 1795, 1613073744
+	.dbg		file, "/root/repo/include/string.h", 5104, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "unittest.h", 4753, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/stdlib.h", 5999, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "strcat", "00", extern, "_strcat"
+	.dbg		sym, "strlen", "00", extern, "_strlen"
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.dbg		sym, "exit", "00", extern, "_exit"
+	.import		_strcat
+	.import		_strlen
+	.import		_printf
+	.import		_exit
+	.export		_main
+
+.segment	"RODATA"
+
+S0010:
+	.byte	$55,$6E,$65,$78,$70,$65,$63,$74,$65,$64,$20,$73,$74,$72,$69,$6E
+	.byte	$67,$20,$6C,$65,$6E,$67,$74,$68,$20,$77,$68,$69,$6C,$65,$20,$73
+	.byte	$74,$72,$69,$6E,$67,$20,$63,$6F,$6E,$63,$61,$74,$65,$6E,$61,$74
+	.byte	$69,$6F,$6E,$20,$74,$6F,$20,$6E,$6F,$6E,$2D,$65,$6D,$70,$74,$79
+	.byte	$20,$62,$75,$66,$66,$65,$72,$21,$00
+S000C:
+	.byte	$55,$6E,$65,$78,$70,$65,$63,$74,$65,$64,$20,$73,$74,$72,$69,$6E
+	.byte	$67,$20,$6C,$65,$6E,$67,$74,$68,$20,$77,$68,$69,$6C,$65,$20,$73
+	.byte	$74,$72,$69,$6E,$67,$20,$63,$6F,$6E,$63,$61,$74,$65,$6E,$61,$74
+	.byte	$69,$6F,$6E,$20,$74,$6F,$20,$65,$6D,$70,$74,$79,$20,$62,$75,$66
+	.byte	$66,$65,$72,$21,$00
+S0008:
+	.byte	$44,$65,$73,$74,$69,$6E,$61,$74,$69,$6F,$6E,$20,$73,$74,$72,$69
+	.byte	$6E,$67,$20,$69,$6E,$69,$74,$69,$61,$6C,$69,$7A,$61,$74,$69,$6F
+	.byte	$6E,$20,$6F,$72,$20,$27,$73,$74,$72,$6C,$65,$6E,$28,$29,$27,$20
+	.byte	$70,$72,$6F,$62,$6C,$65,$6D,$21,$00
+S0018:
+	.byte	$55,$6E,$65,$78,$70,$65,$63,$74,$65,$64,$20,$64,$65,$73,$74,$69
+	.byte	$6E,$61,$74,$69,$6F,$6E,$20,$62,$75,$66,$66,$65,$72,$20,$63,$6F
+	.byte	$6E,$74,$65,$6E,$74,$73,$20,$61,$74,$20,$70,$6F,$73,$69,$74,$69
+	.byte	$6F,$6E,$20,$25,$75,$21,$0A,$00
+S0004:
+	.byte	$53,$6F,$75,$72,$63,$65,$20,$73,$74,$72,$69,$6E,$67,$20,$69,$6E
+	.byte	$69,$74,$69,$61,$6C,$69,$7A,$61,$74,$69,$6F,$6E,$20,$6F,$72,$20
+	.byte	$27,$73,$74,$72,$6C,$65,$6E,$28,$29,$27,$20,$70,$72,$6F,$62,$6C
+	.byte	$65,$6D,$21,$00
+S0016:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$73,$74,$61,$74,$75,$73,$20
+	.byte	$73,$68,$6F,$75,$6C,$64,$20,$62,$65,$20,$74,$72,$75,$65,$20,$62
+	.byte	$75,$74,$20,$77,$61,$73,$6E,$27,$74,$21,$0A,$00
+S0006:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$76,$61,$6C,$75,$65,$3A,$20
+	.byte	$25,$75,$2C,$20,$62,$75,$74,$20,$69,$73,$20,$25,$75,$21,$0A,$00
+S001A	:=	S0006+0
+S000A	:=	S0006+0
+S000E	:=	S0006+0
+S0012	:=	S0006+0
+S0014:
+	.byte	$49,$6E,$76,$61,$6C,$69,$64,$20,$72,$65,$74,$75,$72,$6E,$20,$76
+	.byte	$61,$6C,$75,$65,$21,$00
+S0002:
+	.byte	$6C,$69,$62,$5F,$63,$6F,$6D,$6D,$6F,$6E,$5F,$73,$74,$72,$63,$61
+	.byte	$74,$2E,$63,$00
+S000F:
+	.byte	$46,$61,$69,$6C,$20,$61,$74,$20,$6C,$69,$6E,$65,$20,$25,$64,$3A
+	.byte	$0A,$00
+S000B	:=	S000F+0
+S0017	:=	S000F+0
+S0003	:=	S000F+0
+S0013	:=	S000F+0
+S0007	:=	S000F+0
+S001B:
+	.byte	$50,$61,$73,$73,$65,$64,$0A,$00
+S0001:
+	.byte	$25,$73,$3A,$20,$00
+S0011	:=	S0018+54
+S000D	:=	S0018+54
+S0019	:=	S0018+54
+S0009	:=	S0018+54
+S0005	:=	S0018+54
+S0015	:=	S0018+54
+
+.segment	"BSS"
+
+_SourceString:
+	.res	258,$00
+_DestinationString:
+	.res	515,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "lib_common_strcat.c", 10
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "lib_common_strcat.c", 15
+	jsr     decsp6
+	ldx     #$00
+	lda     #$00
+	ldy     #$04
+	jsr     staxysp
+	jmp     L0002
+	.dbg	line, "lib_common_strcat.c", 16
+L0005:	lda     #<(_SourceString)
+	ldx     #>(_SourceString)
+	ldy     #$04
+	clc
+	adc     (sp),y
+	pha
+	txa
+	iny
+	adc     (sp),y
+	tax
+	pla
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	ldx     #$00
+	and     #$7F
+	jsr     incax1
+	ldx     #$00
+	ldy     #$00
+	jsr     staspidx
+	.dbg	line, "lib_common_strcat.c", 15
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0002
+L0002:	ldy     #$05
+	jsr     ldaxysp
+	cpx     #$01
+	bne     L0006
+	cmp     #$01
+L0006:	jsr     boolult
+	jne     L0005
+	.dbg	line, "lib_common_strcat.c", 18
+	lda     #<(_SourceString)
+	ldx     #>(_SourceString)
+	ldy     #$04
+	clc
+	adc     (sp),y
+	pha
+	txa
+	iny
+	adc     (sp),y
+	tax
+	pla
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staspidx
+	.dbg	line, "lib_common_strcat.c", 20
+	ldx     #$01
+	lda     #$01
+	jsr     pushax
+	lda     #<(_SourceString)
+	ldx     #>(_SourceString)
+	jsr     _strlen
+	jsr     tosneax
+	jeq     L0007
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldx     #$00
+	lda     #$14
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldx     #$01
+	lda     #$01
+	jsr     pushax
+	lda     #<(_SourceString)
+	ldx     #>(_SourceString)
+	jsr     _strlen
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+	.dbg	line, "lib_common_strcat.c", 23
+L0007:	ldx     #$00
+	lda     #$00
+	sta     _DestinationString
+	.dbg	line, "lib_common_strcat.c", 25
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	lda     #<(_DestinationString)
+	ldx     #>(_DestinationString)
+	jsr     _strlen
+	jsr     tosneax
+	jeq     L0008
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldx     #$00
+	lda     #$19
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	lda     #<(_DestinationString)
+	ldx     #>(_DestinationString)
+	jsr     _strlen
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+	.dbg	line, "lib_common_strcat.c", 29
+L0008:	lda     #<(_DestinationString)
+	ldx     #>(_DestinationString)
+	jsr     pushax
+	lda     #<(_SourceString)
+	ldx     #>(_SourceString)
+	jsr     _strcat
+	.dbg	line, "lib_common_strcat.c", 31
+	ldx     #$01
+	lda     #$01
+	jsr     pushax
+	lda     #<(_DestinationString)
+	ldx     #>(_DestinationString)
+	jsr     _strlen
+	jsr     tosneax
+	jeq     L0009
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldx     #$00
+	lda     #$1F
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	ldx     #$01
+	lda     #$01
+	jsr     pushax
+	lda     #<(_DestinationString)
+	ldx     #>(_DestinationString)
+	jsr     _strlen
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+	.dbg	line, "lib_common_strcat.c", 35
+L0009:	lda     #<(_DestinationString)
+	ldx     #>(_DestinationString)
+	jsr     pushax
+	lda     #<(_SourceString)
+	ldx     #>(_SourceString)
+	jsr     _strcat
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "lib_common_strcat.c", 37
+	ldx     #$02
+	lda     #$02
+	jsr     pushax
+	lda     #<(_DestinationString)
+	ldx     #>(_DestinationString)
+	jsr     _strlen
+	jsr     tosneax
+	jeq     L000A
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	ldx     #$00
+	lda     #$25
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	ldx     #$02
+	lda     #$02
+	jsr     pushax
+	lda     #<(_DestinationString)
+	ldx     #>(_DestinationString)
+	jsr     _strlen
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+	.dbg	line, "lib_common_strcat.c", 41
+L000A:	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	lda     #<(_DestinationString)
+	ldx     #>(_DestinationString)
+	jsr     toseqax
+	jsr     bnegax
+	jeq     L000B
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	ldx     #$00
+	lda     #$29
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0016)
+	ldx     #>(S0016)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+	.dbg	line, "lib_common_strcat.c", 45
+L000B:	ldx     #$00
+	lda     #$00
+	ldy     #$02
+	jsr     staxysp
+	jmp     L000C
+	.dbg	line, "lib_common_strcat.c", 46
+L000F:	ldx     #$00
+	lda     #$00
+	ldy     #$04
+	jsr     staxysp
+	jmp     L0011
+	.dbg	line, "lib_common_strcat.c", 48
+L0014:	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldx     #$01
+	lda     #$01
+	jsr     tosumulax
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosaddax
+	jsr     pushax
+	.dbg	line, "lib_common_strcat.c", 49
+	lda     #<(_DestinationString)
+	ldx     #>(_DestinationString)
+	ldy     #$00
+	clc
+	adc     (sp),y
+	pha
+	txa
+	iny
+	adc     (sp),y
+	tax
+	pla
+	ldy     #$00
+	jsr     ldauidx
+	jsr     pushax
+	.dbg	line, "lib_common_strcat.c", 50
+	ldy     #$09
+	jsr     ldaxysp
+	ldx     #$00
+	and     #$7F
+	jsr     incax1
+	jsr     pushax
+	.dbg	line, "lib_common_strcat.c", 51
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosneax
+	jeq     L0016
+	lda     #<(S0017)
+	ldx     #>(S0017)
+	jsr     pushax
+	ldx     #$00
+	lda     #$33
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0018)
+	ldx     #>(S0018)
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0019)
+	ldx     #>(S0019)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S001A)
+	ldx     #>(S001A)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+	.dbg	line, "lib_common_strcat.c", 52
+L0016:	jsr     incsp6
+	.dbg	line, "lib_common_strcat.c", 46
+	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L0011
+L0011:	ldy     #$05
+	jsr     ldaxysp
+	cpx     #$01
+	bne     L0015
+	cmp     #$01
+L0015:	jsr     boolult
+	jne     L0014
+	.dbg	line, "lib_common_strcat.c", 45
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	jmp     L000C
+L000C:	ldy     #$03
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0010
+	cmp     #$02
+L0010:	jsr     boolult
+	jne     L000F
+	.dbg	line, "lib_common_strcat.c", 53
+	jsr     incsp6
+	.dbg	line, "lib_common_strcat.c", 54
+	lda     #<(S001B)
+	ldx     #>(S001B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     #$00
+	jmp     L0001
+L0001:	rts
+
+	.dbg	line
+.endproc
+
@@ -0,0 +1,276 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_strchr
+	.import		_strlen
+	.import		_printf
+	.import		_exit
+	.export		_main
+
+.segment	"DATA"
+
+_S:
+	.byte	$48,$65,$6C,$6F,$20,$77,$72,$64,$21,$0A,$00
+
+.segment	"RODATA"
+
+S0005:
+	.byte	$46,$6F,$72,$20,$63,$6F,$64,$65,$20,$30,$78,$25,$30,$32,$58,$2C
+	.byte	$20,$6F,$66,$66,$73,$65,$74,$20,$25,$75,$21,$0A,$50,$20,$3D,$20
+	.byte	$25,$30,$34,$58,$20,$6F,$66,$66,$73,$65,$74,$20,$3D,$20,$25,$30
+	.byte	$34,$58,$0A,$00
+S000B:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$73,$74,$61,$74,$75,$73,$20
+	.byte	$73,$68,$6F,$75,$6C,$64,$20,$62,$65,$20,$66,$61,$6C,$73,$65,$20
+	.byte	$62,$75,$74,$20,$77,$61,$73,$6E,$27,$74,$21,$0A,$00
+S0007	:=	S000B+0
+S0009:
+	.byte	$46,$61,$69,$6C,$65,$64,$20,$66,$6F,$72,$20,$63,$6F,$64,$65,$20
+	.byte	$30,$78,$25,$30,$32,$58,$0A,$00
+S0003:
+	.byte	$6C,$69,$62,$5F,$63,$6F,$6D,$6D,$6F,$6E,$5F,$73,$74,$72,$63,$68
+	.byte	$72,$2E,$63,$00
+S0004:
+	.byte	$46,$61,$69,$6C,$20,$61,$74,$20,$6C,$69,$6E,$65,$20,$25,$64,$3A
+	.byte	$0A,$00
+S0008	:=	S0004+0
+S000C:
+	.byte	$50,$61,$73,$73,$65,$64,$0A,$00
+S0002:
+	.byte	$25,$73,$3A,$20,$00
+S000A	:=	S0005+50
+S0006	:=	S0005+50
+
+.segment	"BSS"
+
+_Found:
+	.res	256,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jsr     decsp6
+	lda     #<(_S)
+	ldx     #>(_S)
+	jsr     _strlen
+	ldy     #$04
+	jsr     staxysp
+	ldx     #$00
+	txa
+	ldy     #$02
+	jsr     staxysp
+	jmp     L0002
+L0005:	lda     #<(_S)
+	ldx     #>(_S)
+	jsr     pushax
+	lda     #<(_S)
+	ldy     #$04
+	clc
+	adc     (sp),y
+	sta     ptr1
+	lda     #>(_S)
+	iny
+	adc     (sp),y
+	sta     ptr1+1
+	ldx     #$00
+	lda     (ptr1,x)
+	jsr     _strchr
+	jsr     stax0sp
+	cpx     #$00
+	bne     L0011
+	cmp     #$00
+	beq     L0008
+L0011:	jsr     ldax0sp
+	sec
+	sbc     #<(_S)
+	pha
+	txa
+	sbc     #>(_S)
+	tax
+	pla
+	ldy     #$02
+	cmp     (sp),y
+	bne     L0008
+	txa
+	iny
+	cmp     (sp),y
+	beq     L0006
+L0008:	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	lda     #$1C
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     #<(_S)
+	ldy     #$04
+	clc
+	adc     (sp),y
+	sta     ptr1
+	lda     #>(_S)
+	iny
+	adc     (sp),y
+	sta     ptr1+1
+	ldx     #$00
+	lda     (ptr1,x)
+	jsr     pusha0
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$09
+	jsr     ldaxysp
+	sec
+	sbc     #<(_S)
+	pha
+	txa
+	sbc     #>(_S)
+	tax
+	pla
+	jsr     pushax
+	ldy     #$0A
+	jsr     _printf
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0006:	lda     #<(_S)
+	ldy     #$02
+	clc
+	adc     (sp),y
+	sta     ptr1
+	lda     #>(_S)
+	iny
+	adc     (sp),y
+	sta     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	clc
+	adc     #<(_Found)
+	sta     ptr1
+	tya
+	adc     #>(_Found)
+	sta     ptr1+1
+	lda     #$01
+	sta     (ptr1),y
+	ldy     #$02
+	ldx     #$00
+	jsr     addeqysp
+L0002:	ldy     #$05
+	jsr     pushwysp
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     incax1
+	jsr     tosicmp
+	jcc     L0005
+	ldx     #$00
+	txa
+	ldy     #$02
+	jsr     staxysp
+	jmp     L000A
+L000D:	lda     #<(_Found)
+	ldy     #$02
+	clc
+	adc     (sp),y
+	sta     ptr1
+	lda     #>(_Found)
+	iny
+	adc     (sp),y
+	sta     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	bne     L000F
+	lda     #<(_S)
+	ldx     #>(_S)
+	jsr     pushax
+	ldy     #$04
+	ldx     #$00
+	lda     (sp),y
+	jsr     _strchr
+	stx     tmp1
+	ora     tmp1
+	beq     L000F
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	lda     #$26
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L000F:	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L000A:	ldy     #$03
+	jsr     ldaxysp
+	cpx     #$01
+	bcc     L000D
+	jsr     incsp6
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
@@ -0,0 +1,295 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_strcspn
+	.import		_strlen
+	.import		_printf
+	.import		_exit
+	.export		_main
+
+.segment	"DATA"
+
+_EmptyTestChars:
+	.addr	S0001
+_TestChars:
+	.addr	S0002
+
+.segment	"RODATA"
+
+S0006:
+	.byte	$55,$6E,$78,$70,$65,$63,$74,$65,$64,$20,$70,$6F,$73,$69,$74,$69
+	.byte	$6F,$6E,$20,$72,$65,$74,$75,$72,$6E,$65,$64,$20,$66,$6F,$72,$20
+	.byte	$6E,$6F,$6E,$2D,$70,$61,$72,$74,$69,$63,$69,$70,$61,$6E,$74,$20
+	.byte	$63,$61,$73,$65,$21,$00
+S000A:
+	.byte	$55,$6E,$78,$70,$65,$63,$74,$65,$64,$20,$70,$6F,$73,$69,$74,$69
+	.byte	$6F,$6E,$20,$72,$65,$74,$75,$72,$6E,$65,$64,$20,$66,$6F,$72,$20
+	.byte	$70,$61,$72,$74,$69,$63,$69,$70,$61,$6E,$74,$20,$63,$61,$73,$65
+	.byte	$21,$00
+S000E:
+	.byte	$55,$6E,$78,$70,$65,$63,$74,$65,$64,$20,$70,$6F,$73,$69,$74,$69
+	.byte	$6F,$6E,$20,$72,$65,$74,$75,$72,$6E,$65,$64,$20,$66,$6F,$72,$20
+	.byte	$65,$6D,$70,$74,$79,$20,$74,$65,$73,$74,$20,$63,$61,$73,$65,$21
+	.byte	$00
+S0008:
+	.byte	$45,$78,$70,$65,$63,$74,$65,$64,$20,$76,$61,$6C,$75,$65,$3A,$20
+	.byte	$25,$75,$2C,$20,$62,$75,$74,$20,$69,$73,$20,$25,$75,$21,$0A,$00
+S0010	:=	S0008+0
+S000C	:=	S0008+0
+S0004:
+	.byte	$6C,$69,$62,$5F,$63,$6F,$6D,$6D,$6F,$6E,$5F,$73,$74,$72,$63,$73
+	.byte	$70,$6E,$2E,$63,$00
+S0009:
+	.byte	$46,$61,$69,$6C,$20,$61,$74,$20,$6C,$69,$6E,$65,$20,$25,$64,$3A
+	.byte	$0A,$00
+S000D	:=	S0009+0
+S0005	:=	S0009+0
+S0002:
+	.byte	$31,$32,$33,$34,$35,$36,$37,$38,$39,$30,$00
+S0011:
+	.byte	$50,$61,$73,$73,$65,$64,$0A,$00
+S0003:
+	.byte	$25,$73,$3A,$20,$00
+S000F	:=	S0008+30
+S0007	:=	S0008+30
+S000B	:=	S0008+30
+S0001	:=	S0006+53
+
+.segment	"BSS"
+
+_EstimatedString:
+	.res	385,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	jsr     decsp2
+	ldy     #$00
+	tya
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L000C
+L0005:	lda     #<(_EstimatedString)
+	ldy     #$00
+	clc
+	adc     (sp),y
+	pha
+	lda     #>(_EstimatedString)
+	iny
+	adc     (sp),y
+	tax
+	pla
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	lda     #$1A
+	jsr     tosumoda0
+	clc
+	adc     #$41
+	ldy     #$00
+	jsr     staspidx
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	ldy     #$01
+L000C:	lda     (sp),y
+	cmp     #$01
+	bne     L0006
+	dey
+	lda     (sp),y
+	cmp     #$80
+L0006:	bcc     L0005
+	lda     #<(_EstimatedString)
+	ldx     #>(_EstimatedString)
+	jsr     _strlen
+	jsr     pushax
+	lda     #<(_EstimatedString)
+	ldx     #>(_EstimatedString)
+	jsr     pushax
+	lda     _TestChars
+	ldx     _TestChars+1
+	jsr     _strcspn
+	jsr     tosicmp
+	beq     L0008
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     #$12
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	lda     #<(_EstimatedString)
+	ldx     #>(_EstimatedString)
+	jsr     _strlen
+	jsr     pushax
+	lda     #<(_EstimatedString)
+	ldx     #>(_EstimatedString)
+	jsr     pushax
+	lda     _TestChars
+	ldx     _TestChars+1
+	jsr     _strcspn
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0008:	lda     _TestChars
+	ldx     _TestChars+1
+	jsr     pushax
+	lda     _TestChars
+	ldx     _TestChars+1
+	sec
+	sbc     #$01
+	bcs     L0009
+	dex
+L0009:	jsr     _strlen
+	jsr     tosaddax
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	sta     _EstimatedString+192
+	lda     #$C0
+	jsr     pusha0
+	lda     #<(_EstimatedString)
+	ldx     #>(_EstimatedString)
+	jsr     pushax
+	lda     _TestChars
+	ldx     _TestChars+1
+	jsr     _strcspn
+	jsr     tosicmp
+	beq     L000A
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	lda     #$15
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	lda     #$C0
+	jsr     pusha0
+	lda     #<(_EstimatedString)
+	ldx     #>(_EstimatedString)
+	jsr     pushax
+	lda     _TestChars
+	ldx     _TestChars+1
+	jsr     _strcspn
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L000A:	lda     #<(_EstimatedString)
+	ldx     #>(_EstimatedString)
+	jsr     _strlen
+	jsr     pushax
+	lda     #<(_EstimatedString)
+	ldx     #>(_EstimatedString)
+	jsr     pushax
+	lda     _EmptyTestChars
+	ldx     _EmptyTestChars+1
+	jsr     _strcspn
+	jsr     tosicmp
+	beq     L000B
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	lda     #$17
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	lda     #<(_EstimatedString)
+	ldx     #>(_EstimatedString)
+	jsr     _strlen
+	jsr     pushax
+	lda     #<(_EstimatedString)
+	ldx     #>(_EstimatedString)
+	jsr     pushax
+	lda     _EmptyTestChars
+	ldx     _EmptyTestChars+1
+	jsr     _strcspn
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L000B:	jsr     incsp2
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	txa
+	rts
+
+.endproc
+
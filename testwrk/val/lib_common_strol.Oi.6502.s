@@ -0,0 +1,1165 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.import		_sprintf
+	.import		_strtol
+	.import		_strlen
+	.import		__errno
+	.export		_main
+
+.segment	"DATA"
+
+_Failures:
+	.word	$0000
+
+.segment	"RODATA"
+
+S0003:
+	.byte	$73,$74,$72,$74,$6F,$6C,$20,$65,$72,$72,$6F,$72,$20,$69,$6E,$20
+	.byte	$22,$25,$73,$22,$3A,$0A,$20,$20,$72,$65,$73,$75,$6C,$74,$20,$3D
+	.byte	$20,$25,$6C,$64,$2C,$20,$73,$68,$6F,$75,$6C,$64,$20,$62,$65,$20
+	.byte	$25,$6C,$64,$2C,$20,$63,$68,$61,$72,$73,$20,$3D,$20,$25,$64,$0A
+	.byte	$00
+S0001	:=	S0003+0
+S0002:
+	.byte	$73,$74,$72,$74,$6F,$6C,$20,$65,$72,$72,$6F,$72,$20,$69,$6E,$20
+	.byte	$22,$25,$73,$22,$3A,$0A,$20,$20,$73,$68,$6F,$75,$6C,$64,$20,$6E
+	.byte	$6F,$74,$20,$63,$6F,$6E,$76,$65,$72,$74,$2C,$20,$62,$75,$74,$20
+	.byte	$65,$72,$72,$6E,$6F,$20,$3D,$20,$25,$64,$0A,$00
+S001A:
+	.byte	$2D,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39
+	.byte	$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39
+	.byte	$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39
+	.byte	$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$00
+S001C:
+	.byte	$20,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39
+	.byte	$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39
+	.byte	$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39
+	.byte	$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$00
+S001B:
+	.byte	$2B,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39
+	.byte	$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39
+	.byte	$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39
+	.byte	$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$00
+S0020:
+	.byte	$46,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+S0013:
+	.byte	$09,$20,$2D,$30,$78,$31,$32,$33,$34,$20,$00
+S0012:
+	.byte	$09,$20,$30,$78,$31,$32,$33,$34,$20,$00
+S0008:
+	.byte	$09,$20,$2D,$30,$78,$31,$30,$47,$20,$00
+S000F:
+	.byte	$09,$20,$2D,$30,$58,$31,$30,$47,$20,$00
+S000E	:=	S0008+0
+S0009	:=	S000F+0
+S0005:
+	.byte	$09,$20,$30,$58,$31,$30,$47,$20,$00
+S0010:
+	.byte	$20,$09,$2D,$30,$33,$37,$37,$09,$00
+S0014:
+	.byte	$09,$20,$2D,$30,$31,$30,$47,$20,$00
+S000A	:=	S0010+0
+S000D:
+	.byte	$09,$20,$2D,$31,$32,$33,$34,$20,$00
+S0004:
+	.byte	$09,$20,$30,$78,$31,$30,$47,$20,$00
+S0006:
+	.byte	$20,$09,$30,$33,$37,$37,$09,$00
+S000C:
+	.byte	$09,$20,$31,$32,$33,$34,$20,$00
+S0015:
+	.byte	$09,$20,$31,$30,$47,$20,$00
+S000B:
+	.byte	$20,$2D,$33,$37,$37,$00
+S0011:
+	.byte	$20,$30,$33,$37,$37,$00
+S001E:
+	.byte	$7A,$79,$61,$42,$00
+S001D:
+	.byte	$61,$42,$63,$44,$00
+S0007:
+	.byte	$20,$33,$37,$37,$00
+S001F	:=	S001E+0
+S0018:
+	.byte	$25,$6C,$64,$00
+S0017	:=	S0018+0
+S0016	:=	S0018+0
+S0019	:=	S0018+0
+
+; ---------------------------------------------------------------
+; void __near__ IncStr (char *Buf)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_IncStr: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$01
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _strlen
+	jsr     pushax
+	jmp     L0006
+L0002:	ldy     #$02
+	lda     (sp),y
+	ldy     #$00
+	clc
+	adc     (sp),y
+	sta     ptr1
+	ldy     #$03
+	lda     (sp),y
+	ldy     #$01
+	adc     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (ptr1),y
+	cmp     #$39
+	bne     L0008
+	ldy     #$02
+	lda     (sp),y
+	ldy     #$00
+	clc
+	adc     (sp),y
+	sta     ptr1
+	ldy     #$03
+	lda     (sp),y
+	ldy     #$01
+	adc     (sp),y
+	sta     ptr1+1
+	ldx     #$00
+	lda     #$30
+	dey
+	sta     (ptr1),y
+	jmp     L0009
+L0008:	ldy     #$02
+	lda     (sp),y
+	ldy     #$00
+	clc
+	adc     (sp),y
+	sta     ptr1
+	ldy     #$03
+	lda     (sp),y
+	ldy     #$01
+	adc     (sp),y
+	sta     ptr1+1
+	dey
+	lda     #$01
+	clc
+	adc     (ptr1),y
+	sta     (ptr1),y
+	jmp     L0003
+L0006:	ldx     #$00
+L0009:	lda     #$01
+	jsr     subeq0sp
+	txa
+	bpl     L0002
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ CheckStrToL (const char *Str, int Base, long Val, unsigned char Ok)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_CheckStrToL: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	jsr     decsp6
+	ldy     #$0E
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$02
+	sta     (sp),y
+	iny
+	txa
+	sta     (sp),y
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$04
+	bcc     L0002
+	inx
+L0002:	ldy     #$00
+	sta     (sp),y
+	iny
+	txa
+	sta     (sp),y
+	ldy     #$0C
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _strtol
+	jsr     pusheax
+	ldy     #$06
+	lda     (sp),y
+	beq     L0003
+	jsr     ldeax0sp
+	jsr     pusheax
+	ldy     #$0E
+	jsr     ldeaxysp
+	jsr     tosneeax
+	jeq     L000A
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jmp     L0028
+L0003:	lda     __errno+1
+	bne     L000D
+	lda     __errno
+	cmp     #$0F
+	beq     L0007
+L000D:	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$12
+	jsr     pushwysp
+	lda     __errno
+	ldx     __errno+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	inc     _Failures
+	bne     L0007
+	inc     _Failures+1
+L0007:	jsr     ldeax0sp
+	jsr     pusheax
+	ldy     #$0E
+	jsr     ldeaxysp
+	jsr     tosneeax
+	beq     L000A
+	lda     #<(S0003)
+	ldx     #>(S0003)
+L0028:	jsr     pushax
+	ldy     #$12
+	jsr     pushwysp
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$12
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$11
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	sec
+	ldy     #$19
+	sbc     (sp),y
+	pha
+	txa
+	iny
+	sbc     (sp),y
+	tax
+	pla
+	jsr     pushax
+	ldy     #$0E
+	jsr     _printf
+	inc     _Failures
+	bne     L000A
+	inc     _Failures+1
+L000A:	ldy     #$0F
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	ldy     #$58
+	jsr     subysp
+	lda     #<(S0004)
+	ldy     #$06
+	sta     (sp),y
+	iny
+	lda     #>(S0004)
+	sta     (sp),y
+	lda     #$00
+	ldy     #$04
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	tay
+	lda     #$10
+	sta     (sp),y
+	tya
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$01
+	jsr     _CheckStrToL
+	jsr     decsp8
+	lda     #<(S0005)
+	ldy     #$06
+	sta     (sp),y
+	iny
+	lda     #>(S0005)
+	sta     (sp),y
+	lda     #$00
+	ldy     #$04
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	tay
+	lda     #$10
+	sta     (sp),y
+	tya
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$01
+	jsr     _CheckStrToL
+	jsr     decsp8
+	lda     #<(S0006)
+	ldy     #$06
+	sta     (sp),y
+	iny
+	lda     #>(S0006)
+	sta     (sp),y
+	lda     #$00
+	ldy     #$04
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	tay
+	lda     #$FF
+	sta     (sp),y
+	tya
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$01
+	jsr     _CheckStrToL
+	jsr     decsp8
+	lda     #<(S0007)
+	ldy     #$06
+	sta     (sp),y
+	iny
+	lda     #>(S0007)
+	sta     (sp),y
+	lda     #$00
+	ldy     #$04
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	tay
+	lda     #$79
+	sta     (sp),y
+	lda     #$01
+	iny
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$01
+	jsr     _CheckStrToL
+	jsr     decsp8
+	lda     #<(S0008)
+	ldy     #$06
+	sta     (sp),y
+	iny
+	lda     #>(S0008)
+	sta     (sp),y
+	lda     #$00
+	ldy     #$04
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	tay
+	lda     #$F0
+	sta     (sp),y
+	lda     #$FF
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$01
+	jsr     _CheckStrToL
+	jsr     decsp8
+	lda     #<(S0009)
+	ldy     #$06
+	sta     (sp),y
+	iny
+	lda     #>(S0009)
+	sta     (sp),y
+	lda     #$00
+	ldy     #$04
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	tay
+	lda     #$F0
+	sta     (sp),y
+	lda     #$FF
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$01
+	jsr     _CheckStrToL
+	jsr     decsp8
+	lda     #<(S000A)
+	ldy     #$06
+	sta     (sp),y
+	iny
+	lda     #>(S000A)
+	sta     (sp),y
+	lda     #$00
+	ldy     #$04
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	tay
+	lda     #$01
+	sta     (sp),y
+	lda     #$FF
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$01
+	jsr     _CheckStrToL
+	jsr     decsp8
+	lda     #<(S000B)
+	ldy     #$06
+	sta     (sp),y
+	iny
+	lda     #>(S000B)
+	sta     (sp),y
+	lda     #$00
+	ldy     #$04
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	tay
+	lda     #$87
+	sta     (sp),y
+	lda     #$FE
+	iny
+	sta     (sp),y
+	lda     #$FF
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$01
+	jsr     _CheckStrToL
+	jsr     decsp8
+	lda     #<(S000C)
+	ldy     #$06
+	sta     (sp),y
+	iny
+	lda     #>(S000C)
+	sta     (sp),y
+	lda     #$0A
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #$00
+	sta     (sp),y
+	tay
+	lda     #$D2
+	sta     (sp),y
+	lda     #$04
+	iny
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$01
+	jsr     _CheckStrToL
+	jsr     decsp8
+	lda     #<(S000D)
+	ldy     #$06
+	sta     (sp),y
+	iny
+	lda     #>(S000D)
+	sta     (sp),y
+	lda     #$0A
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #$00
+	sta     (sp),y
+	tay
+	lda     #$2E
+	sta     (sp),y
+	lda     #$FB
+	iny
+	sta     (sp),y
+	lda     #$FF
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$01
+	jsr     _CheckStrToL
+	jsr     decsp8
+	lda     #<(S000E)
+	ldy     #$06
+	sta     (sp),y
+	iny
+	lda     #>(S000E)
+	sta     (sp),y
+	lda     #$0A
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #$00
+	sta     (sp),y
+	tay
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$01
+	jsr     _CheckStrToL
+	jsr     decsp8
+	lda     #<(S000F)
+	ldy     #$06
+	sta     (sp),y
+	iny
+	lda     #>(S000F)
+	sta     (sp),y
+	lda     #$0A
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #$00
+	sta     (sp),y
+	tay
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$01
+	jsr     _CheckStrToL
+	jsr     decsp8
+	lda     #<(S0010)
+	ldy     #$06
+	sta     (sp),y
+	iny
+	lda     #>(S0010)
+	sta     (sp),y
+	lda     #$0A
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #$00
+	sta     (sp),y
+	tay
+	lda     #$87
+	sta     (sp),y
+	lda     #$FE
+	iny
+	sta     (sp),y
+	lda     #$FF
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$01
+	jsr     _CheckStrToL
+	jsr     decsp8
+	lda     #<(S0011)
+	ldy     #$06
+	sta     (sp),y
+	iny
+	lda     #>(S0011)
+	sta     (sp),y
+	lda     #$0A
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #$00
+	sta     (sp),y
+	tay
+	lda     #$79
+	sta     (sp),y
+	lda     #$01
+	iny
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$01
+	jsr     _CheckStrToL
+	jsr     decsp8
+	lda     #<(S0012)
+	ldy     #$06
+	sta     (sp),y
+	iny
+	lda     #>(S0012)
+	sta     (sp),y
+	lda     #$10
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #$00
+	sta     (sp),y
+	tay
+	lda     #$34
+	sta     (sp),y
+	lda     #$12
+	iny
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$01
+	jsr     _CheckStrToL
+	jsr     decsp8
+	lda     #<(S0013)
+	ldy     #$06
+	sta     (sp),y
+	iny
+	lda     #>(S0013)
+	sta     (sp),y
+	lda     #$10
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #$00
+	sta     (sp),y
+	tay
+	lda     #$CC
+	sta     (sp),y
+	lda     #$ED
+	iny
+	sta     (sp),y
+	lda     #$FF
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$01
+	jsr     _CheckStrToL
+	jsr     decsp8
+	lda     #<(S0014)
+	ldy     #$06
+	sta     (sp),y
+	iny
+	lda     #>(S0014)
+	sta     (sp),y
+	lda     #$10
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #$00
+	sta     (sp),y
+	tay
+	lda     #$F0
+	sta     (sp),y
+	lda     #$FF
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$01
+	jsr     _CheckStrToL
+	jsr     decsp8
+	lda     #<(S0015)
+	ldy     #$06
+	sta     (sp),y
+	iny
+	lda     #>(S0015)
+	sta     (sp),y
+	lda     #$10
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #$00
+	sta     (sp),y
+	tay
+	lda     #$10
+	sta     (sp),y
+	tya
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$01
+	jsr     _CheckStrToL
+	jsr     decsp4
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$04
+	bcc     L0002
+	inx
+L0002:	ldy     #$02
+	sta     (sp),y
+	iny
+	txa
+	sta     (sp),y
+	lda     #<(S0016)
+	ldy     #$00
+	sta     (sp),y
+	iny
+	lda     #>(S0016)
+	sta     (sp),y
+	ldx     #$00
+	stx     sreg
+	lda     #$80
+	sta     sreg+1
+	txa
+	jsr     pusheax
+	ldy     #$08
+	jsr     _sprintf
+	jsr     decsp8
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$08
+	bcc     L0003
+	inx
+L0003:	ldy     #$06
+	sta     (sp),y
+	iny
+	txa
+	sta     (sp),y
+	lda     #$00
+	ldy     #$04
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	tay
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$80
+	iny
+	sta     (sp),y
+	lda     #$01
+	jsr     _CheckStrToL
+	jsr     decsp4
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$04
+	bcc     L0004
+	inx
+L0004:	ldy     #$02
+	sta     (sp),y
+	iny
+	txa
+	sta     (sp),y
+	lda     #<(S0017)
+	ldy     #$00
+	sta     (sp),y
+	iny
+	lda     #>(S0017)
+	sta     (sp),y
+	ldx     #$FF
+	stx     sreg
+	lda     #$7F
+	sta     sreg+1
+	txa
+	jsr     pusheax
+	ldy     #$08
+	jsr     _sprintf
+	jsr     decsp8
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$08
+	bcc     L0005
+	inx
+L0005:	ldy     #$06
+	sta     (sp),y
+	iny
+	txa
+	sta     (sp),y
+	lda     #$00
+	ldy     #$04
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	tay
+	lda     #$FF
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$7F
+	iny
+	sta     (sp),y
+	lda     #$01
+	jsr     _CheckStrToL
+	jsr     decsp4
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$04
+	bcc     L0011
+	inx
+	clc
+L0011:	adc     #$01
+	bcc     L0007
+	inx
+L0007:	ldy     #$02
+	sta     (sp),y
+	iny
+	txa
+	sta     (sp),y
+	lda     #<(S0018)
+	ldy     #$00
+	sta     (sp),y
+	iny
+	lda     #>(S0018)
+	sta     (sp),y
+	ldx     #$00
+	stx     sreg
+	lda     #$80
+	sta     sreg+1
+	txa
+	jsr     pusheax
+	ldy     #$08
+	jsr     _sprintf
+	lda     #$30
+	ldy     #$01
+	sta     (sp),y
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$01
+	bcc     L0008
+	inx
+L0008:	jsr     _IncStr
+	ldy     #$01
+	lda     (sp),y
+	cmp     #$30
+	bne     L0013
+	lda     #$2D
+	sta     (sp),y
+	lda     #$20
+	jmp     L0014
+L0013:	lda     #$2D
+L0014:	dey
+	sta     (sp),y
+	jsr     decsp8
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$08
+	bcc     L000B
+	inx
+L000B:	ldy     #$06
+	sta     (sp),y
+	iny
+	txa
+	sta     (sp),y
+	lda     #$00
+	ldy     #$04
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	tay
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$80
+	iny
+	sta     (sp),y
+	lda     #$00
+	jsr     _CheckStrToL
+	jsr     decsp4
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$04
+	bcc     L0012
+	inx
+	clc
+L0012:	adc     #$01
+	bcc     L000D
+	inx
+L000D:	ldy     #$02
+	sta     (sp),y
+	iny
+	txa
+	sta     (sp),y
+	lda     #<(S0019)
+	ldy     #$00
+	sta     (sp),y
+	iny
+	lda     #>(S0019)
+	sta     (sp),y
+	ldx     #$FF
+	stx     sreg
+	lda     #$7F
+	sta     sreg+1
+	txa
+	jsr     pusheax
+	ldy     #$08
+	jsr     _sprintf
+	lda     #$30
+	ldy     #$00
+	sta     (sp),y
+	lda     sp
+	ldx     sp+1
+	jsr     _IncStr
+	ldy     #$00
+	lda     (sp),y
+	cmp     #$30
+	bne     L000E
+	lda     #$20
+	sta     (sp),y
+L000E:	jsr     decsp8
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$08
+	bcc     L000F
+	inx
+L000F:	ldy     #$06
+	sta     (sp),y
+	iny
+	txa
+	sta     (sp),y
+	lda     #$00
+	ldy     #$04
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	tay
+	lda     #$FF
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$7F
+	iny
+	sta     (sp),y
+	lda     #$00
+	jsr     _CheckStrToL
+	jsr     decsp8
+	lda     #<(S001A)
+	ldy     #$06
+	sta     (sp),y
+	iny
+	lda     #>(S001A)
+	sta     (sp),y
+	lda     #$00
+	ldy     #$04
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	tay
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$80
+	iny
+	sta     (sp),y
+	lda     #$00
+	jsr     _CheckStrToL
+	jsr     decsp8
+	lda     #<(S001B)
+	ldy     #$06
+	sta     (sp),y
+	iny
+	lda     #>(S001B)
+	sta     (sp),y
+	lda     #$00
+	ldy     #$04
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	tay
+	lda     #$FF
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$7F
+	iny
+	sta     (sp),y
+	lda     #$00
+	jsr     _CheckStrToL
+	jsr     decsp8
+	lda     #<(S001C)
+	ldy     #$06
+	sta     (sp),y
+	iny
+	lda     #>(S001C)
+	sta     (sp),y
+	lda     #$00
+	ldy     #$04
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	tay
+	lda     #$FF
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	lda     #$7F
+	iny
+	sta     (sp),y
+	lda     #$00
+	jsr     _CheckStrToL
+	jsr     decsp8
+	lda     #<(S001D)
+	ldy     #$06
+	sta     (sp),y
+	iny
+	lda     #>(S001D)
+	sta     (sp),y
+	lda     #$24
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #$00
+	sta     (sp),y
+	tay
+	lda     #$ED
+	sta     (sp),y
+	lda     #$57
+	iny
+	sta     (sp),y
+	lda     #$07
+	iny
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	lda     #$01
+	jsr     _CheckStrToL
+	jsr     decsp8
+	lda     #<(S001E)
+	ldy     #$06
+	sta     (sp),y
+	iny
+	lda     #>(S001E)
+	sta     (sp),y
+	lda     #$23
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #$00
+	sta     (sp),y
+	tay
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jsr     _CheckStrToL
+	jsr     decsp8
+	lda     #<(S001F)
+	ldy     #$06
+	sta     (sp),y
+	iny
+	lda     #>(S001F)
+	sta     (sp),y
+	lda     #$24
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #$00
+	sta     (sp),y
+	tay
+	lda     #$53
+	sta     (sp),y
+	lda     #$98
+	iny
+	sta     (sp),y
+	lda     #$19
+	iny
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	jsr     _CheckStrToL
+	lda     #<(S0020)
+	ldx     #>(S0020)
+	jsr     pushax
+	lda     _Failures
+	ldx     _Failures+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     _Failures
+	ldx     _Failures+1
+	ldy     #$50
+	jmp     addysp
+
+.endproc
+
@@ -0,0 +1,592 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.import		_sprintf
+	.import		_strtoul
+	.import		_strlen
+	.import		__errno
+	.export		_main
+
+.segment	"DATA"
+
+_Failures:
+	.word	$0000
+
+.segment	"RODATA"
+
+S0003:
+	.byte	$73,$74,$72,$74,$6F,$6C,$20,$65,$72,$72,$6F,$72,$20,$69,$6E,$20
+	.byte	$22,$25,$73,$22,$3A,$0A,$20,$20,$72,$65,$73,$75,$6C,$74,$20,$3D
+	.byte	$20,$25,$6C,$75,$2C,$20,$73,$68,$6F,$75,$6C,$64,$20,$62,$65,$20
+	.byte	$25,$6C,$75,$2C,$20,$63,$68,$61,$72,$73,$20,$3D,$20,$25,$64,$0A
+	.byte	$00
+S0001	:=	S0003+0
+S0002:
+	.byte	$73,$74,$72,$74,$6F,$6C,$20,$65,$72,$72,$6F,$72,$20,$69,$6E,$20
+	.byte	$22,$25,$73,$22,$3A,$0A,$20,$20,$73,$68,$6F,$75,$6C,$64,$20,$6E
+	.byte	$6F,$74,$20,$63,$6F,$6E,$76,$65,$72,$74,$2C,$20,$62,$75,$74,$20
+	.byte	$65,$72,$72,$6E,$6F,$20,$3D,$20,$25,$64,$0A,$00
+S0018:
+	.byte	$2D,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39
+	.byte	$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39
+	.byte	$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39
+	.byte	$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$00
+S001A:
+	.byte	$20,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39
+	.byte	$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39
+	.byte	$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39
+	.byte	$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$00
+S0019:
+	.byte	$2B,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39
+	.byte	$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39
+	.byte	$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39
+	.byte	$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$00
+S001E:
+	.byte	$46,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+S0013:
+	.byte	$09,$20,$2D,$30,$78,$31,$32,$33,$34,$20,$00
+S0012:
+	.byte	$09,$20,$30,$78,$31,$32,$33,$34,$20,$00
+S0008:
+	.byte	$09,$20,$2D,$30,$78,$31,$30,$47,$20,$00
+S000F:
+	.byte	$09,$20,$2D,$30,$58,$31,$30,$47,$20,$00
+S000E	:=	S0008+0
+S0009	:=	S000F+0
+S0005:
+	.byte	$09,$20,$30,$58,$31,$30,$47,$20,$00
+S0010:
+	.byte	$20,$09,$2D,$30,$33,$37,$37,$09,$00
+S0014:
+	.byte	$09,$20,$2D,$30,$31,$30,$47,$20,$00
+S000A	:=	S0010+0
+S000D:
+	.byte	$09,$20,$2D,$31,$32,$33,$34,$20,$00
+S0004:
+	.byte	$09,$20,$30,$78,$31,$30,$47,$20,$00
+S0006:
+	.byte	$20,$09,$30,$33,$37,$37,$09,$00
+S000C:
+	.byte	$09,$20,$31,$32,$33,$34,$20,$00
+S0015:
+	.byte	$09,$20,$31,$30,$47,$20,$00
+S000B:
+	.byte	$20,$2D,$33,$37,$37,$00
+S0011:
+	.byte	$20,$30,$33,$37,$37,$00
+S0007:
+	.byte	$20,$33,$37,$37,$00
+S001B:
+	.byte	$61,$42,$63,$44,$00
+S001C:
+	.byte	$7A,$79,$61,$42,$00
+S001D	:=	S001C+0
+S0016:
+	.byte	$25,$6C,$75,$00
+S0017	:=	S0016+0
+
+; ---------------------------------------------------------------
+; void __near__ IncStr (char *Buf)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_IncStr: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     ldax0sp
+	jsr     _strlen
+	jsr     pushax
+	jmp     L0006
+L0002:	jsr     ldax0sp
+	clc
+	ldy     #$02
+	adc     (sp),y
+	sta     ptr1
+	txa
+	iny
+	adc     (sp),y
+	sta     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	cmp     #$39
+	bne     L0008
+	jsr     ldax0sp
+	clc
+	ldy     #$02
+	adc     (sp),y
+	sta     ptr1
+	txa
+	iny
+	adc     (sp),y
+	sta     ptr1+1
+	ldx     #$00
+	lda     #$30
+	ldy     #$00
+	sta     (ptr1),y
+	jmp     L0009
+L0008:	jsr     ldax0sp
+	clc
+	ldy     #$02
+	adc     (sp),y
+	sta     ptr1
+	txa
+	iny
+	adc     (sp),y
+	sta     ptr1+1
+	ldy     #$00
+	lda     #$01
+	clc
+	adc     (ptr1),y
+	sta     (ptr1),y
+	jmp     L0003
+L0006:	ldx     #$00
+L0009:	lda     #$01
+	jsr     subeq0sp
+	txa
+	bpl     L0002
+L0003:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ CheckStrToUL (const char *Str, int Base, unsigned long Val, unsigned char Ok)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_CheckStrToUL: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	jsr     decsp2
+	ldy     #$0C
+	jsr     pushwysp
+	lda     #$02
+	jsr     leaa0sp
+	jsr     pushax
+	ldy     #$0C
+	jsr     ldaxysp
+	jsr     _strtoul
+	jsr     pusheax
+	ldy     #$06
+	lda     (sp),y
+	beq     L0002
+	jsr     ldeax0sp
+	jsr     pusheax
+	ldy     #$0E
+	jsr     ldeaxysp
+	jsr     tosneeax
+	jeq     L0009
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jmp     L0027
+L0002:	lda     __errno+1
+	bne     L000C
+	lda     __errno
+	cmp     #$0F
+	beq     L0006
+L000C:	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$12
+	jsr     pushwysp
+	lda     __errno
+	ldx     __errno+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	inc     _Failures
+	bne     L0006
+	inc     _Failures+1
+L0006:	jsr     ldeax0sp
+	jsr     pusheax
+	ldy     #$0E
+	jsr     ldeaxysp
+	jsr     tosneeax
+	beq     L0009
+	lda     #<(S0003)
+	ldx     #>(S0003)
+L0027:	jsr     pushax
+	ldy     #$12
+	jsr     pushwysp
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$12
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	sec
+	ldy     #$19
+	sbc     (sp),y
+	pha
+	txa
+	iny
+	sbc     (sp),y
+	tax
+	pla
+	jsr     pushax
+	ldy     #$0E
+	jsr     _printf
+	inc     _Failures
+	bne     L0009
+	inc     _Failures+1
+L0009:	ldy     #$0F
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	ldy     #$50
+	jsr     subysp
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	jsr     push0
+	lda     #$10
+	jsr     push0ax
+	lda     #$01
+	jsr     _CheckStrToUL
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	jsr     push0
+	lda     #$10
+	jsr     push0ax
+	lda     #$01
+	jsr     _CheckStrToUL
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	jsr     push0
+	lda     #$FF
+	jsr     push0ax
+	lda     #$01
+	jsr     _CheckStrToUL
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	jsr     push0
+	ldx     #$01
+	lda     #$79
+	jsr     push0ax
+	txa
+	jsr     _CheckStrToUL
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	jsr     push0
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F0
+	jsr     pusheax
+	lda     #$01
+	jsr     _CheckStrToUL
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	jsr     push0
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F0
+	jsr     pusheax
+	lda     #$01
+	jsr     _CheckStrToUL
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	jsr     push0
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     pusheax
+	jsr     _CheckStrToUL
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	jsr     push0
+	ldx     #$FE
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	lda     #$87
+	jsr     pusheax
+	lda     #$01
+	jsr     _CheckStrToUL
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	lda     #$0A
+	jsr     pusha0
+	ldx     #$04
+	lda     #$D2
+	jsr     push0ax
+	lda     #$01
+	jsr     _CheckStrToUL
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	lda     #$0A
+	jsr     pusha0
+	ldx     #$FB
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	lda     #$2E
+	jsr     pusheax
+	lda     #$01
+	jsr     _CheckStrToUL
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	lda     #$0A
+	jsr     pusha0
+	jsr     pushl0
+	lda     #$01
+	jsr     _CheckStrToUL
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	lda     #$0A
+	jsr     pusha0
+	jsr     pushl0
+	lda     #$01
+	jsr     _CheckStrToUL
+	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	lda     #$0A
+	jsr     pusha0
+	ldx     #$FE
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	lda     #$87
+	jsr     pusheax
+	lda     #$01
+	jsr     _CheckStrToUL
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	lda     #$0A
+	jsr     pusha0
+	ldx     #$01
+	lda     #$79
+	jsr     push0ax
+	txa
+	jsr     _CheckStrToUL
+	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	lda     #$10
+	jsr     pusha0
+	ldx     #$12
+	lda     #$34
+	jsr     push0ax
+	lda     #$01
+	jsr     _CheckStrToUL
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	lda     #$10
+	jsr     pusha0
+	ldx     #$ED
+	lda     #$FF
+	sta     sreg
+	sta     sreg+1
+	lda     #$CC
+	jsr     pusheax
+	lda     #$01
+	jsr     _CheckStrToUL
+	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	lda     #$10
+	jsr     pusha0
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F0
+	jsr     pusheax
+	lda     #$01
+	jsr     _CheckStrToUL
+	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+	lda     #$10
+	jsr     pusha0
+	jsr     push0ax
+	lda     #$01
+	jsr     _CheckStrToUL
+	lda     sp
+	ldx     sp+1
+	jsr     pushax
+	lda     #<(S0016)
+	ldx     #>(S0016)
+	jsr     pushax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	txa
+	jsr     pusheax
+	ldy     #$08
+	jsr     _sprintf
+	lda     sp
+	ldx     sp+1
+	jsr     pushax
+	jsr     push0
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	txa
+	jsr     pusheax
+	lda     #$01
+	jsr     _CheckStrToUL
+	lda     sp
+	ldx     sp+1
+	jsr     incax1
+	jsr     pushax
+	lda     #<(S0017)
+	ldx     #>(S0017)
+	jsr     pushax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	txa
+	jsr     pusheax
+	ldy     #$08
+	jsr     _sprintf
+	lda     #$30
+	ldy     #$00
+	sta     (sp),y
+	lda     sp
+	ldx     sp+1
+	jsr     _IncStr
+	ldy     #$00
+	lda     (sp),y
+	cmp     #$30
+	bne     L0002
+	lda     #$20
+	sta     (sp),y
+L0002:	lda     sp
+	ldx     sp+1
+	jsr     pushax
+	jsr     push0
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	txa
+	jsr     pusheax
+	lda     #$00
+	jsr     _CheckStrToUL
+	lda     #<(S0018)
+	ldx     #>(S0018)
+	jsr     pushax
+	jsr     push0
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	txa
+	jsr     pusheax
+	lda     #$00
+	jsr     _CheckStrToUL
+	lda     #<(S0019)
+	ldx     #>(S0019)
+	jsr     pushax
+	jsr     push0
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	txa
+	jsr     pusheax
+	lda     #$00
+	jsr     _CheckStrToUL
+	lda     #<(S001A)
+	ldx     #>(S001A)
+	jsr     pushax
+	jsr     push0
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	txa
+	jsr     pusheax
+	lda     #$00
+	jsr     _CheckStrToUL
+	lda     #<(S001B)
+	ldx     #>(S001B)
+	jsr     pushax
+	lda     #$24
+	jsr     pusha0
+	ldx     #$57
+	lda     #$07
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$ED
+	jsr     pusheax
+	lda     #$01
+	jsr     _CheckStrToUL
+	lda     #<(S001C)
+	ldx     #>(S001C)
+	jsr     pushax
+	lda     #$23
+	jsr     pusha0
+	jsr     pushl0
+	jsr     _CheckStrToUL
+	lda     #<(S001D)
+	ldx     #>(S001D)
+	jsr     pushax
+	lda     #$24
+	jsr     pusha0
+	ldx     #$98
+	lda     #$19
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$53
+	jsr     pusheax
+	lda     #$00
+	jsr     _CheckStrToUL
+	lda     #<(S001E)
+	ldx     #>(S001E)
+	jsr     pushax
+	lda     _Failures
+	ldx     _Failures+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     _Failures
+	ldx     _Failures+1
+	ldy     #$50
+	jmp     addysp
+
+.endproc
+
@@ -0,0 +1,813 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "lib_common_strtoul.c", 3600, 1613073744
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/stdlib.h", 5999, 1613073744
+	.dbg		file, "/root/repo/include/string.h", 5104, 1613073744
+	.dbg		file, "/root/repo/include/limits.h", 3146, 1613073744
+	.dbg		file, "/root/repo/include/errno.h", 5083, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.dbg		sym, "sprintf", "00", extern, "_sprintf"
+	.dbg		sym, "strtoul", "00", extern, "_strtoul"
+	.dbg		sym, "strlen", "00", extern, "_strlen"
+	.dbg		sym, "_errno", "00", extern, "__errno"
+	.import		_printf
+	.import		_sprintf
+	.import		_strtoul
+	.import		_strlen
+	.import		__errno
+	.export		_main
+
+.segment	"DATA"
+
+_Failures:
+	.word	$0000
+
+.segment	"RODATA"
+
+S0003:
+	.byte	$73,$74,$72,$74,$6F,$6C,$20,$65,$72,$72,$6F,$72,$20,$69,$6E,$20
+	.byte	$22,$25,$73,$22,$3A,$0A,$20,$20,$72,$65,$73,$75,$6C,$74,$20,$3D
+	.byte	$20,$25,$6C,$75,$2C,$20,$73,$68,$6F,$75,$6C,$64,$20,$62,$65,$20
+	.byte	$25,$6C,$75,$2C,$20,$63,$68,$61,$72,$73,$20,$3D,$20,$25,$64,$0A
+	.byte	$00
+S0001	:=	S0003+0
+S0002:
+	.byte	$73,$74,$72,$74,$6F,$6C,$20,$65,$72,$72,$6F,$72,$20,$69,$6E,$20
+	.byte	$22,$25,$73,$22,$3A,$0A,$20,$20,$73,$68,$6F,$75,$6C,$64,$20,$6E
+	.byte	$6F,$74,$20,$63,$6F,$6E,$76,$65,$72,$74,$2C,$20,$62,$75,$74,$20
+	.byte	$65,$72,$72,$6E,$6F,$20,$3D,$20,$25,$64,$0A,$00
+S0018:
+	.byte	$2D,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39
+	.byte	$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39
+	.byte	$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39
+	.byte	$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$00
+S001A:
+	.byte	$20,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39
+	.byte	$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39
+	.byte	$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39
+	.byte	$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$00
+S0019:
+	.byte	$2B,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39
+	.byte	$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39
+	.byte	$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$39
+	.byte	$39,$39,$39,$39,$39,$39,$39,$39,$39,$39,$00
+S001E:
+	.byte	$46,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+S0013:
+	.byte	$09,$20,$2D,$30,$78,$31,$32,$33,$34,$20,$00
+S0012:
+	.byte	$09,$20,$30,$78,$31,$32,$33,$34,$20,$00
+S0008:
+	.byte	$09,$20,$2D,$30,$78,$31,$30,$47,$20,$00
+S000F:
+	.byte	$09,$20,$2D,$30,$58,$31,$30,$47,$20,$00
+S000E	:=	S0008+0
+S0009	:=	S000F+0
+S0005:
+	.byte	$09,$20,$30,$58,$31,$30,$47,$20,$00
+S0010:
+	.byte	$20,$09,$2D,$30,$33,$37,$37,$09,$00
+S0014:
+	.byte	$09,$20,$2D,$30,$31,$30,$47,$20,$00
+S000A	:=	S0010+0
+S000D:
+	.byte	$09,$20,$2D,$31,$32,$33,$34,$20,$00
+S0004:
+	.byte	$09,$20,$30,$78,$31,$30,$47,$20,$00
+S0006:
+	.byte	$20,$09,$30,$33,$37,$37,$09,$00
+S000C:
+	.byte	$09,$20,$31,$32,$33,$34,$20,$00
+S0015:
+	.byte	$09,$20,$31,$30,$47,$20,$00
+S000B:
+	.byte	$20,$2D,$33,$37,$37,$00
+S0011:
+	.byte	$20,$30,$33,$37,$37,$00
+S0007:
+	.byte	$20,$33,$37,$37,$00
+S001B:
+	.byte	$61,$42,$63,$44,$00
+S001C:
+	.byte	$7A,$79,$61,$42,$00
+S001D	:=	S001C+0
+S0016:
+	.byte	$25,$6C,$75,$00
+S0017	:=	S0016+0
+
+; ---------------------------------------------------------------
+; void __near__ IncStr (char *Buf)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_IncStr: near
+
+	.dbg	func, "IncStr", "00", static, "_IncStr"
+	.dbg	sym, "Buf", "00", auto, 0
+	.dbg	sym, "Len", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "lib_common_strtoul.c", 23
+	jsr     pushax
+	.dbg	line, "lib_common_strtoul.c", 24
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _strlen
+	jsr     pushax
+	.dbg	line, "lib_common_strtoul.c", 26
+	jmp     L0006
+	.dbg	line, "lib_common_strtoul.c", 27
+L0002:	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosaddax
+	ldy     #$00
+	jsr     ldauidx
+	jmp     L0005
+	.dbg	line, "lib_common_strtoul.c", 35
+L0005:	cmp     #$39
+	jeq     L0007
+	jmp     L0008
+	.dbg	line, "lib_common_strtoul.c", 29
+L0007:	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosaddax
+	jsr     pushax
+	ldx     #$00
+	lda     #$30
+	ldy     #$00
+	jsr     staspidx
+	.dbg	line, "lib_common_strtoul.c", 30
+	jmp     L0006
+	.dbg	line, "lib_common_strtoul.c", 33
+L0008:	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosaddax
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	clc
+	adc     (ptr1),y
+	sta     (ptr1),y
+	.dbg	line, "lib_common_strtoul.c", 34
+	jmp     L0003
+	.dbg	line, "lib_common_strtoul.c", 26
+L0006:	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	jsr     subeqysp
+	txa
+	jsr     boolge
+	jne     L0002
+	.dbg	line, "lib_common_strtoul.c", 37
+L0003:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ CheckStrToUL (const char *Str, int Base, unsigned long Val, unsigned char Ok)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_CheckStrToUL: near
+
+	.dbg	func, "CheckStrToUL", "00", static, "_CheckStrToUL"
+	.dbg	sym, "Str", "00", auto, 7
+	.dbg	sym, "Base", "00", auto, 5
+	.dbg	sym, "Val", "00", auto, 1
+	.dbg	sym, "Ok", "00", auto, 0
+	.dbg	sym, "EndPtr", "00", auto, -2
+	.dbg	sym, "Res", "00", auto, -6
+
+.segment	"CODE"
+
+	.dbg	line, "lib_common_strtoul.c", 40
+	jsr     pusha
+	.dbg	line, "lib_common_strtoul.c", 42
+	jsr     decsp2
+	ldy     #$0A
+	jsr     ldaxysp
+	jsr     pushax
+	lda     #$02
+	jsr     leaa0sp
+	jsr     pushax
+	ldy     #$0C
+	jsr     ldaxysp
+	jsr     _strtoul
+	jsr     pusheax
+	.dbg	line, "lib_common_strtoul.c", 43
+	ldy     #$06
+	lda     (sp),y
+	jeq     L0002
+	.dbg	line, "lib_common_strtoul.c", 44
+	ldy     #$03
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0E
+	jsr     ldeaxysp
+	jsr     tosneeax
+	jeq     L0003
+	.dbg	line, "lib_common_strtoul.c", 46
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	.dbg	line, "lib_common_strtoul.c", 47
+	ldy     #$10
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$12
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1C
+	jsr     ldaxysp
+	jsr     tossubax
+	jsr     pushax
+	ldy     #$0E
+	jsr     _printf
+	.dbg	line, "lib_common_strtoul.c", 48
+	inc     _Failures
+	bne     L0004
+	inc     _Failures+1
+L0004:	lda     _Failures
+	ldx     _Failures+1
+	.dbg	line, "lib_common_strtoul.c", 50
+L0003:	jmp     L0009
+	.dbg	line, "lib_common_strtoul.c", 51
+L0002:	lda     __errno
+	ldx     __errno+1
+	cpx     #$00
+	bne     L0007
+	cmp     #$0F
+L0007:	jsr     boolne
+	jeq     L0006
+	.dbg	line, "lib_common_strtoul.c", 53
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	.dbg	line, "lib_common_strtoul.c", 54
+	ldy     #$10
+	jsr     ldaxysp
+	jsr     pushax
+	lda     __errno
+	ldx     __errno+1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "lib_common_strtoul.c", 55
+	inc     _Failures
+	bne     L0008
+	inc     _Failures+1
+L0008:	lda     _Failures
+	ldx     _Failures+1
+	.dbg	line, "lib_common_strtoul.c", 57
+L0006:	ldy     #$03
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0E
+	jsr     ldeaxysp
+	jsr     tosneeax
+	jeq     L0009
+	.dbg	line, "lib_common_strtoul.c", 59
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	.dbg	line, "lib_common_strtoul.c", 60
+	ldy     #$10
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$12
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$1C
+	jsr     ldaxysp
+	jsr     tossubax
+	jsr     pushax
+	ldy     #$0E
+	jsr     _printf
+	.dbg	line, "lib_common_strtoul.c", 61
+	inc     _Failures
+	bne     L000A
+	inc     _Failures+1
+L000A:	lda     _Failures
+	ldx     _Failures+1
+	.dbg	line, "lib_common_strtoul.c", 64
+L0009:	ldy     #$0F
+	jsr     addysp
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+	.dbg	sym, "Buf", "00", auto, -80
+
+.segment	"CODE"
+
+	.dbg	line, "lib_common_strtoul.c", 71
+	ldy     #$50
+	jsr     subysp
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$10
+	jsr     pusheax
+	lda     #$01
+	jsr     _CheckStrToUL
+	.dbg	line, "lib_common_strtoul.c", 72
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$10
+	jsr     pusheax
+	lda     #$01
+	jsr     _CheckStrToUL
+	.dbg	line, "lib_common_strtoul.c", 73
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	lda     #$01
+	jsr     _CheckStrToUL
+	.dbg	line, "lib_common_strtoul.c", 74
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$01
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$79
+	jsr     pusheax
+	lda     #$01
+	jsr     _CheckStrToUL
+	.dbg	line, "lib_common_strtoul.c", 76
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F0
+	jsr     pusheax
+	lda     #$01
+	jsr     _CheckStrToUL
+	.dbg	line, "lib_common_strtoul.c", 77
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F0
+	jsr     pusheax
+	lda     #$01
+	jsr     _CheckStrToUL
+	.dbg	line, "lib_common_strtoul.c", 78
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$01
+	jsr     pusheax
+	lda     #$01
+	jsr     _CheckStrToUL
+	.dbg	line, "lib_common_strtoul.c", 79
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$FE
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$87
+	jsr     pusheax
+	lda     #$01
+	jsr     _CheckStrToUL
+	.dbg	line, "lib_common_strtoul.c", 82
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	ldx     #$00
+	lda     #$0A
+	jsr     pushax
+	ldx     #$04
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$D2
+	jsr     pusheax
+	lda     #$01
+	jsr     _CheckStrToUL
+	.dbg	line, "lib_common_strtoul.c", 83
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	ldx     #$00
+	lda     #$0A
+	jsr     pushax
+	ldx     #$FB
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$2E
+	jsr     pusheax
+	lda     #$01
+	jsr     _CheckStrToUL
+	.dbg	line, "lib_common_strtoul.c", 84
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	ldx     #$00
+	lda     #$0A
+	jsr     pushax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	lda     #$01
+	jsr     _CheckStrToUL
+	.dbg	line, "lib_common_strtoul.c", 85
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	ldx     #$00
+	lda     #$0A
+	jsr     pushax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	lda     #$01
+	jsr     _CheckStrToUL
+	.dbg	line, "lib_common_strtoul.c", 86
+	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	ldx     #$00
+	lda     #$0A
+	jsr     pushax
+	ldx     #$FE
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$87
+	jsr     pusheax
+	lda     #$01
+	jsr     _CheckStrToUL
+	.dbg	line, "lib_common_strtoul.c", 87
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	ldx     #$00
+	lda     #$0A
+	jsr     pushax
+	ldx     #$01
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$79
+	jsr     pusheax
+	lda     #$01
+	jsr     _CheckStrToUL
+	.dbg	line, "lib_common_strtoul.c", 90
+	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	ldx     #$00
+	lda     #$10
+	jsr     pushax
+	ldx     #$12
+	lda     #$00
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$34
+	jsr     pusheax
+	lda     #$01
+	jsr     _CheckStrToUL
+	.dbg	line, "lib_common_strtoul.c", 91
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	ldx     #$00
+	lda     #$10
+	jsr     pushax
+	ldx     #$ED
+	lda     #$FF
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$CC
+	jsr     pusheax
+	lda     #$01
+	jsr     _CheckStrToUL
+	.dbg	line, "lib_common_strtoul.c", 92
+	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	ldx     #$00
+	lda     #$10
+	jsr     pushax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$F0
+	jsr     pusheax
+	lda     #$01
+	jsr     _CheckStrToUL
+	.dbg	line, "lib_common_strtoul.c", 93
+	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+	ldx     #$00
+	lda     #$10
+	jsr     pushax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$10
+	jsr     pusheax
+	lda     #$01
+	jsr     _CheckStrToUL
+	.dbg	line, "lib_common_strtoul.c", 96
+	lda     sp
+	ldx     sp+1
+	jsr     pushax
+	lda     #<(S0016)
+	ldx     #>(S0016)
+	jsr     pushax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldy     #$08
+	jsr     _sprintf
+	.dbg	line, "lib_common_strtoul.c", 97
+	lda     sp
+	ldx     sp+1
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	lda     #$01
+	jsr     _CheckStrToUL
+	.dbg	line, "lib_common_strtoul.c", 100
+	lda     sp
+	ldx     sp+1
+	ina
+	bne     L0002
+	inx
+L0002:	jsr     pushax
+	lda     #<(S0017)
+	ldx     #>(S0017)
+	jsr     pushax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	ldy     #$08
+	jsr     _sprintf
+	.dbg	line, "lib_common_strtoul.c", 101
+	ldx     #$00
+	lda     #$30
+	ldy     #$00
+	sta     (sp),y
+	.dbg	line, "lib_common_strtoul.c", 102
+	lda     sp
+	ldx     sp+1
+	jsr     _IncStr
+	.dbg	line, "lib_common_strtoul.c", 103
+	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$30
+	jsr     booleq
+	jeq     L0003
+	.dbg	line, "lib_common_strtoul.c", 104
+	ldx     #$00
+	lda     #$20
+	ldy     #$00
+	sta     (sp),y
+	.dbg	line, "lib_common_strtoul.c", 106
+L0003:	lda     sp
+	ldx     sp+1
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	lda     #$00
+	jsr     _CheckStrToUL
+	.dbg	line, "lib_common_strtoul.c", 109
+	lda     #<(S0018)
+	ldx     #>(S0018)
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	lda     #$00
+	jsr     _CheckStrToUL
+	.dbg	line, "lib_common_strtoul.c", 110
+	lda     #<(S0019)
+	ldx     #>(S0019)
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	lda     #$00
+	jsr     _CheckStrToUL
+	.dbg	line, "lib_common_strtoul.c", 111
+	lda     #<(S001A)
+	ldx     #>(S001A)
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	lda     #$FF
+	jsr     pusheax
+	lda     #$00
+	jsr     _CheckStrToUL
+	.dbg	line, "lib_common_strtoul.c", 114
+	lda     #<(S001B)
+	ldx     #>(S001B)
+	jsr     pushax
+	ldx     #$00
+	lda     #$24
+	jsr     pushax
+	ldx     #$57
+	lda     #$07
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$ED
+	jsr     pusheax
+	lda     #$01
+	jsr     _CheckStrToUL
+	.dbg	line, "lib_common_strtoul.c", 115
+	lda     #<(S001C)
+	ldx     #>(S001C)
+	jsr     pushax
+	ldx     #$00
+	lda     #$23
+	jsr     pushax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$00
+	jsr     pusheax
+	lda     #$00
+	jsr     _CheckStrToUL
+	.dbg	line, "lib_common_strtoul.c", 116
+	lda     #<(S001D)
+	ldx     #>(S001D)
+	jsr     pushax
+	ldx     #$00
+	lda     #$24
+	jsr     pushax
+	ldx     #$98
+	lda     #$19
+	sta     sreg
+	lda     #$00
+	sta     sreg+1
+	lda     #$53
+	jsr     pusheax
+	lda     #$00
+	jsr     _CheckStrToUL
+	.dbg	line, "lib_common_strtoul.c", 118
+	lda     #<(S001E)
+	ldx     #>(S001E)
+	jsr     pushax
+	lda     _Failures
+	ldx     _Failures+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "lib_common_strtoul.c", 120
+	lda     _Failures
+	ldx     _Failures+1
+	jmp     L0001
+	.dbg	line, "lib_common_strtoul.c", 121
+L0001:	ldy     #$50
+	jsr     addysp
+	rts
+
+	.dbg	line
+.endproc
+
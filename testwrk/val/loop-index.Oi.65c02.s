@@ -0,0 +1,1214 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.import		_memcmp
+	.import		_memset
+	.export		_main
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$25,$73,$3A,$20,$25,$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64
+	.byte	$20,$25,$75,$0A,$00
+S0017:
+	.byte	$73,$74,$61,$74,$69,$63,$6E,$65,$67,$20,$6E,$6F,$6E,$65,$00
+S0011:
+	.byte	$6E,$65,$67,$73,$74,$61,$72,$74,$20,$6E,$6F,$6E,$65,$00
+S001B:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+S0012:
+	.byte	$6E,$65,$67,$73,$74,$61,$72,$74,$20,$6E,$65,$67,$00
+S0014:
+	.byte	$72,$65,$67,$6E,$65,$67,$20,$6E,$6F,$6E,$65,$00
+S000A:
+	.byte	$63,$6F,$75,$6E,$74,$20,$30,$20,$32,$35,$35,$00
+S0019:
+	.byte	$73,$69,$67,$6E,$65,$64,$77,$72,$61,$70,$00
+S0010:
+	.byte	$6E,$65,$67,$73,$74,$61,$72,$74,$20,$61,$00
+S0008:
+	.byte	$63,$6F,$75,$6E,$74,$20,$33,$20,$38,$00
+S0016:
+	.byte	$73,$74,$61,$74,$69,$63,$6E,$65,$67,$00
+S0006:
+	.byte	$66,$69,$6E,$64,$20,$6E,$6F,$6E,$65,$00
+S0009:
+	.byte	$63,$6F,$75,$6E,$74,$20,$38,$20,$33,$00
+S000F:
+	.byte	$6E,$65,$67,$73,$74,$61,$72,$74,$00
+S0015:
+	.byte	$72,$65,$67,$6E,$65,$67,$20,$61,$00
+S0018:
+	.byte	$64,$6F,$77,$6E,$6E,$65,$67,$00
+S001A:
+	.byte	$72,$65,$76,$65,$72,$73,$65,$00
+S0013:
+	.byte	$72,$65,$67,$6E,$65,$67,$00
+S000D:
+	.byte	$73,$6B,$69,$70,$20,$61,$00
+S000E:
+	.byte	$6E,$65,$73,$74,$65,$64,$00
+S0002:
+	.byte	$66,$69,$6C,$6C,$20,$69,$00
+S000B:
+	.byte	$63,$61,$6C,$6C,$73,$00
+S0007:
+	.byte	$66,$69,$6C,$6C,$00
+S0005:
+	.byte	$66,$69,$6E,$64,$00
+S0003:
+	.byte	$63,$6F,$70,$79,$00
+S000C:
+	.byte	$73,$6B,$69,$70,$00
+S0004:
+	.byte	$73,$75,$6D,$00
+
+.segment	"BSS"
+
+_failures:
+	.res	2,$00
+_a:
+	.res	256,$00
+_b:
+	.res	256,$00
+_calls:
+	.res	1,$00
+
+; ---------------------------------------------------------------
+; void __near__ check (const char *name, unsigned int got, unsigned int expected)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_check: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cmp     (sp)
+	bne     L0005
+	txa
+	dey
+	cmp     (sp),y
+	beq     L0002
+L0005:	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$08
+	jsr     _printf
+	inc     _failures
+	bne     L0002
+	inc     _failures+1
+L0002:	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ copy (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_copy: near
+
+.segment	"CODE"
+
+	jsr     decsp1
+	lda     #$00
+	bra     L0008
+L0005:	lda     #<(_a)
+	ldx     #>(_a)
+	clc
+	adc     (sp)
+	bcc     L0006
+	inx
+L0006:	sta     ptr1
+	stx     ptr1+1
+	lda     (sp)
+	tay
+	lda     _b,y
+	sta     (ptr1)
+	clc
+	lda     #$01
+	adc     (sp)
+L0008:	sta     (sp)
+	cmp     #$64
+	bcc     L0005
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ fill (unsigned char v)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fill: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	lda     #$0A
+	sta     M0001
+	bra     L0007
+L0005:	lda     (sp)
+	ldy     M0001
+	sta     _a,y
+	inc     M0001
+L0007:	lda     M0001
+	cmp     #$3C
+	bne     L0005
+	jsr     decsp4
+	lda     #<(S0002)
+	ldy     #$02
+	sta     (sp),y
+	iny
+	lda     #>(S0002)
+	sta     (sp),y
+	lda     M0001
+	sta     (sp)
+	ldy     #$01
+	lda     #$00
+	sta     (sp),y
+	tax
+	lda     #$3C
+	jsr     _check
+	jmp     incsp1
+
+.segment	"BSS"
+
+M0001:
+	.res	1,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ sum (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_sum: near
+
+.segment	"CODE"
+
+	jsr     decsp1
+	jsr     push0
+	ldy     #$02
+	bra     L0007
+L0008:	lda     (sp),y
+	tay
+	ldx     #$00
+	lda     _a,y
+	jsr     addeq0sp
+	ldy     #$02
+	clc
+	lda     #$01
+	adc     (sp),y
+L0007:	sta     (sp),y
+	cmp     #$C8
+	bcc     L0008
+	dey
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ count (unsigned char start, unsigned char end)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_count: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	jsr     decsp1
+	lda     #$00
+	jsr     pusha
+	ldy     #$03
+	lda     (sp),y
+	ldy     #$01
+	bra     L0006
+L0005:	clc
+	lda     #$01
+	adc     (sp)
+	sta     (sp)
+	ldy     #$01
+	clc
+	tya
+	adc     (sp),y
+L0006:	sta     (sp),y
+	iny
+	cmp     (sp),y
+	bcc     L0005
+	ldx     #$00
+	lda     (sp)
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ repeat (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_repeat: near
+
+.segment	"CODE"
+
+	jsr     decsp1
+	lda     #$00
+	bra     L000E
+L0011:	inc     _calls
+	clc
+	lda     #$01
+	adc     (sp)
+L000E:	sta     (sp)
+	cmp     #$0A
+	bcc     L0011
+	lda     #$05
+	bra     L000F
+L0012:	inc     _calls
+	clc
+	lda     #$01
+	adc     (sp)
+L000F:	sta     (sp)
+	cmp     #$05
+	bcc     L0012
+	lda     #$00
+	bra     L0010
+L0013:	inc     _calls
+	clc
+	lda     #$01
+	adc     (sp)
+L0010:	sta     (sp)
+	lda     (sp)
+	bne     L0013
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ find (unsigned char c)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_find: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	jsr     decsp1
+	lda     #$00
+	tay
+	bra     L0008
+L0009:	lda     (sp),y
+	tay
+	lda     _a,y
+	ldy     #$01
+	cmp     (sp),y
+	beq     L0003
+	dey
+	clc
+	lda     #$01
+	adc     (sp)
+L0008:	sta     (sp)
+	cmp     #$64
+	bcc     L0009
+L0003:	ldx     #$00
+	lda     (sp)
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ skip (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_skip: near
+
+.segment	"CODE"
+
+	jsr     decsp1
+	lda     #$00
+	jsr     pusha
+	ldy     #$01
+	bra     L0008
+L000A:	lda     (sp),y
+	and     #$01
+	bne     L000C
+	lda     (sp),y
+	tax
+	lda     (sp),y
+	sta     _a,x
+	clc
+	lda     #$01
+	adc     (sp)
+	sta     (sp)
+	ldy     #$01
+L000C:	clc
+	lda     #$01
+	adc     (sp),y
+L0008:	sta     (sp),y
+	cmp     #$32
+	bcc     L000A
+	ldx     #$00
+	lda     (sp)
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ nested (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_nested: near
+
+.segment	"CODE"
+
+	jsr     decsp2
+	jsr     push0
+	ldy     #$03
+	bra     L000C
+L000E:	lda     #$00
+	ldy     #$02
+	bra     L000D
+L000F:	lda     (sp),y
+	tax
+	ldy     #$03
+	lda     (sp),y
+	sta     _a,x
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	ldy     #$02
+	clc
+	lda     #$01
+	adc     (sp),y
+L000D:	sta     (sp),y
+	cmp     #$14
+	bcc     L000F
+	iny
+	clc
+	lda     #$01
+	adc     (sp),y
+L000C:	sta     (sp),y
+	cmp     #$0A
+	bcc     L000E
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	clc
+	adc     _a+19
+	bcc     L0001
+	inx
+L0001:	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ negstart (signed char n)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_negstart: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	jsr     decsp1
+	lda     #$00
+	jsr     pusha
+	lda     #$FB
+	ldy     #$01
+	sta     (sp),y
+	bra     L000C
+L0005:	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0009
+	dex
+L0009:	clc
+	adc     #$05
+	bcc     L000B
+	inx
+	clc
+L000B:	adc     #<(_a)
+	sta     ptr1
+	txa
+	adc     #>(_a)
+	sta     ptr1+1
+	lda     (sp),y
+	sta     (ptr1)
+	clc
+	tya
+	adc     (sp)
+	sta     (sp)
+	ldy     #$01
+	ldx     #$00
+	clc
+	tya
+	adc     (sp),y
+	sta     (sp),y
+	bpl     L000D
+L000C:	ldx     #$00
+L000D:	lda     (sp),y
+	bpl     L0006
+	dex
+L0006:	jsr     pushax
+	ldy     #$04
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0007
+	dex
+L0007:	jsr     tosicmp
+	bmi     L0005
+	ldx     #$00
+	lda     (sp)
+	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ regneg (signed char n)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_regneg: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	jsr     decsp1
+	lda     #$00
+	jsr     pusha
+	lda     #$FB
+	ldy     #$01
+	sta     (sp),y
+	bra     L000C
+L0005:	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0009
+	dex
+L0009:	clc
+	adc     #$05
+	bcc     L000B
+	inx
+	clc
+L000B:	adc     #<(_a)
+	sta     ptr1
+	txa
+	adc     #>(_a)
+	sta     ptr1+1
+	lda     (sp),y
+	sta     (ptr1)
+	clc
+	tya
+	adc     (sp)
+	sta     (sp)
+	ldy     #$01
+	ldx     #$00
+	clc
+	tya
+	adc     (sp),y
+	sta     (sp),y
+	bpl     L000D
+L000C:	ldx     #$00
+L000D:	lda     (sp),y
+	bpl     L0006
+	dex
+L0006:	jsr     pushax
+	ldy     #$04
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0007
+	dex
+L0007:	jsr     tosicmp
+	bmi     L0005
+	ldx     #$00
+	lda     (sp)
+	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ staticneg (signed char n)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_staticneg: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	lda     #$00
+	jsr     pusha
+	lda     #$9C
+	sta     M0001
+	bra     L0002
+L0005:	clc
+	lda     #$01
+	adc     (sp)
+	sta     (sp)
+	ldx     #$00
+	lda     #$03
+	clc
+	adc     M0001
+	sta     M0001
+	bpl     L0009
+L0002:	ldx     #$00
+L0009:	lda     M0001
+	bpl     L0006
+	dex
+L0006:	jsr     pushax
+	ldy     #$03
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0007
+	dex
+L0007:	jsr     tosicmp
+	bmi     L0005
+	ldx     #$00
+	lda     (sp)
+	jmp     incsp2
+
+.segment	"BSS"
+
+M0001:
+	.res	1,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ downneg (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_downneg: near
+
+.segment	"CODE"
+
+	jsr     decsp1
+	lda     #$00
+	jsr     pusha
+	lda     #$05
+	ldy     #$01
+	bra     L000B
+L0005:	clc
+	lda     #$01
+	adc     (sp)
+	sta     (sp)
+	ldy     #$01
+	lda     (sp),y
+	sec
+	sbc     #$01
+L000B:	sta     (sp),y
+	sec
+	sbc     #$FD
+	bvs     L0007
+	eor     #$80
+L0007:	bmi     L0005
+	ldx     #$00
+	lda     (sp)
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ signedwrap (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signedwrap: near
+
+.segment	"CODE"
+
+	jsr     decsp1
+	lda     #$00
+	jsr     pusha
+	lda     #$78
+	ldy     #$01
+	bra     L000B
+L0005:	clc
+	lda     #$01
+	adc     (sp)
+	sta     (sp)
+	ldy     #$01
+	clc
+	tya
+	adc     (sp),y
+L000B:	sta     (sp),y
+	sec
+	sbc     #$01
+	bvs     L0007
+	eor     #$80
+L0007:	bmi     L0005
+	ldx     #$00
+	lda     (sp)
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ reverse (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_reverse: near
+
+.segment	"CODE"
+
+	jsr     decsp1
+	lda     #$64
+	ldy     #$00
+	sta     (sp)
+	bra     L0009
+L0008:	lda     (sp),y
+	sec
+	sbc     #$01
+	sta     (sp),y
+	lda     #<(_b)
+	ldx     #>(_b)
+	clc
+	adc     (sp),y
+	bcc     L0005
+	inx
+L0005:	sta     ptr1
+	stx     ptr1+1
+	lda     (sp),y
+	tay
+	lda     _a,y
+	ldy     #$00
+	sta     (ptr1)
+L0009:	lda     (sp)
+	bne     L0008
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp1
+	lda     #$00
+	bra     L000D
+L0005:	lda     #<(_b)
+	ldx     #>(_b)
+	clc
+	adc     (sp)
+	bcc     L0006
+	inx
+L0006:	sta     ptr1
+	stx     ptr1+1
+	lda     (sp)
+	ina
+	sta     (ptr1)
+	clc
+	lda     #$01
+	adc     (sp)
+L000D:	sta     (sp)
+	cmp     #$64
+	bcc     L0005
+	jsr     _copy
+	jsr     decsp4
+	lda     #<(S0003)
+	ldy     #$02
+	sta     (sp),y
+	iny
+	lda     #>(S0003)
+	sta     (sp),y
+	jsr     decsp4
+	lda     #<(_a)
+	dey
+	sta     (sp),y
+	iny
+	lda     #>(_a)
+	sta     (sp),y
+	lda     #<(_b)
+	sta     (sp)
+	ldy     #$01
+	lda     #>(_b)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$64
+	jsr     _memcmp
+	sta     (sp)
+	ldy     #$01
+	txa
+	sta     (sp),y
+	ldx     #$00
+	txa
+	jsr     _check
+	jsr     decsp4
+	lda     #<(S0004)
+	ldy     #$02
+	sta     (sp),y
+	iny
+	lda     #>(S0004)
+	sta     (sp),y
+	jsr     _sum
+	sta     (sp)
+	ldy     #$01
+	txa
+	sta     (sp),y
+	ldx     #$13
+	lda     #$BA
+	jsr     _check
+	jsr     decsp4
+	lda     #<(S0005)
+	ldy     #$02
+	sta     (sp),y
+	iny
+	lda     #>(S0005)
+	sta     (sp),y
+	lda     #$32
+	jsr     _find
+	sta     (sp)
+	ldy     #$01
+	txa
+	sta     (sp),y
+	ldx     #$00
+	lda     #$31
+	jsr     _check
+	jsr     decsp4
+	lda     #<(S0006)
+	ldy     #$02
+	sta     (sp),y
+	iny
+	lda     #>(S0006)
+	sta     (sp),y
+	lda     #$00
+	jsr     _find
+	sta     (sp)
+	ldy     #$01
+	txa
+	sta     (sp),y
+	ldx     #$00
+	lda     #$64
+	jsr     _check
+	lda     #$07
+	jsr     _fill
+	jsr     decsp4
+	lda     #<(S0007)
+	ldy     #$02
+	sta     (sp),y
+	iny
+	lda     #>(S0007)
+	sta     (sp),y
+	ldx     #$00
+	lda     _a+10
+	clc
+	adc     _a+59
+	bcc     L000E
+	inx
+	clc
+L000E:	adc     _a+9
+	bcc     L000F
+	inx
+	clc
+L000F:	adc     _a+60
+	bcc     L000A
+	inx
+L000A:	sta     (sp)
+	ldy     #$01
+	txa
+	sta     (sp),y
+	ldx     #$00
+	lda     #$55
+	jsr     _check
+	jsr     decsp4
+	lda     #<(S0008)
+	ldy     #$02
+	sta     (sp),y
+	iny
+	lda     #>(S0008)
+	sta     (sp),y
+	tya
+	jsr     pusha
+	lda     #$08
+	jsr     _count
+	sta     (sp)
+	ldy     #$01
+	txa
+	sta     (sp),y
+	ldx     #$00
+	lda     #$05
+	jsr     _check
+	jsr     decsp4
+	lda     #<(S0009)
+	ldy     #$02
+	sta     (sp),y
+	iny
+	lda     #>(S0009)
+	sta     (sp),y
+	lda     #$08
+	jsr     pusha
+	lda     #$03
+	jsr     _count
+	sta     (sp)
+	ldy     #$01
+	txa
+	sta     (sp),y
+	ldx     #$00
+	txa
+	jsr     _check
+	jsr     decsp4
+	lda     #<(S000A)
+	ldy     #$02
+	sta     (sp),y
+	iny
+	lda     #>(S000A)
+	sta     (sp),y
+	lda     #$00
+	jsr     pusha
+	dea
+	jsr     _count
+	sta     (sp)
+	ldy     #$01
+	txa
+	sta     (sp),y
+	ldx     #$00
+	lda     #$FF
+	jsr     _check
+	jsr     _repeat
+	jsr     decsp4
+	lda     #<(S000B)
+	ldy     #$02
+	sta     (sp),y
+	iny
+	lda     #>(S000B)
+	sta     (sp),y
+	lda     _calls
+	sta     (sp)
+	ldy     #$01
+	lda     #$00
+	sta     (sp),y
+	tax
+	lda     #$0A
+	jsr     _check
+	jsr     decsp4
+	lda     #<(S000C)
+	ldy     #$02
+	sta     (sp),y
+	iny
+	lda     #>(S000C)
+	sta     (sp),y
+	jsr     _skip
+	sta     (sp)
+	ldy     #$01
+	txa
+	sta     (sp),y
+	ldx     #$00
+	lda     #$19
+	jsr     _check
+	jsr     decsp4
+	lda     #<(S000D)
+	ldy     #$02
+	sta     (sp),y
+	iny
+	lda     #>(S000D)
+	sta     (sp),y
+	ldx     #$00
+	lda     _a+48
+	clc
+	adc     _a+49
+	bcc     L000B
+	inx
+L000B:	sta     (sp)
+	ldy     #$01
+	txa
+	sta     (sp),y
+	ldx     #$00
+	lda     #$37
+	jsr     _check
+	jsr     decsp4
+	lda     #<(S000E)
+	ldy     #$02
+	sta     (sp),y
+	iny
+	lda     #>(S000E)
+	sta     (sp),y
+	jsr     _nested
+	sta     (sp)
+	ldy     #$01
+	txa
+	sta     (sp),y
+	ldx     #$00
+	lda     #$D1
+	jsr     _check
+	jsr     decsp4
+	lda     #<(S000F)
+	ldy     #$02
+	sta     (sp),y
+	iny
+	lda     #>(S000F)
+	sta     (sp),y
+	tya
+	jsr     _negstart
+	sta     (sp)
+	ldy     #$01
+	txa
+	sta     (sp),y
+	ldx     #$00
+	lda     #$08
+	jsr     _check
+	jsr     decsp4
+	lda     #<(S0010)
+	ldy     #$02
+	sta     (sp),y
+	iny
+	lda     #>(S0010)
+	sta     (sp),y
+	ldx     #$00
+	lda     _a
+	clc
+	adc     _a+7
+	bcc     L000C
+	inx
+L000C:	sta     (sp)
+	ldy     #$01
+	txa
+	sta     (sp),y
+	ldx     #$00
+	lda     #$FD
+	jsr     _check
+	jsr     decsp4
+	lda     #<(S0011)
+	ldy     #$02
+	sta     (sp),y
+	iny
+	lda     #>(S0011)
+	sta     (sp),y
+	lda     #$FB
+	jsr     _negstart
+	sta     (sp)
+	ldy     #$01
+	txa
+	sta     (sp),y
+	ldx     #$00
+	txa
+	jsr     _check
+	jsr     decsp4
+	lda     #<(S0012)
+	ldy     #$02
+	sta     (sp),y
+	iny
+	lda     #>(S0012)
+	sta     (sp),y
+	lda     #$FE
+	jsr     _negstart
+	sta     (sp)
+	ldy     #$01
+	txa
+	sta     (sp),y
+	ldx     #$00
+	lda     #$03
+	jsr     _check
+	jsr     decsp4
+	lda     #<(S0013)
+	ldy     #$02
+	sta     (sp),y
+	iny
+	lda     #>(S0013)
+	sta     (sp),y
+	tya
+	jsr     _regneg
+	sta     (sp)
+	ldy     #$01
+	txa
+	sta     (sp),y
+	ldx     #$00
+	lda     #$08
+	jsr     _check
+	jsr     decsp4
+	lda     #<(S0014)
+	ldy     #$02
+	sta     (sp),y
+	iny
+	lda     #>(S0014)
+	sta     (sp),y
+	lda     #$FA
+	jsr     _regneg
+	sta     (sp)
+	ldy     #$01
+	txa
+	sta     (sp),y
+	ldx     #$00
+	txa
+	jsr     _check
+	jsr     decsp4
+	lda     #<(S0015)
+	ldy     #$02
+	sta     (sp),y
+	iny
+	lda     #>(S0015)
+	sta     (sp),y
+	lda     _a+4
+	sta     (sp)
+	ldy     #$01
+	lda     #$00
+	sta     (sp),y
+	tax
+	dea
+	jsr     _check
+	jsr     decsp4
+	lda     #<(S0016)
+	ldy     #$02
+	sta     (sp),y
+	iny
+	lda     #>(S0016)
+	sta     (sp),y
+	lda     #$14
+	jsr     _staticneg
+	sta     (sp)
+	ldy     #$01
+	txa
+	sta     (sp),y
+	ldx     #$00
+	lda     #$28
+	jsr     _check
+	jsr     decsp4
+	lda     #<(S0017)
+	ldy     #$02
+	sta     (sp),y
+	iny
+	lda     #>(S0017)
+	sta     (sp),y
+	lda     #$9C
+	jsr     _staticneg
+	sta     (sp)
+	ldy     #$01
+	txa
+	sta     (sp),y
+	ldx     #$00
+	txa
+	jsr     _check
+	jsr     decsp4
+	lda     #<(S0018)
+	ldy     #$02
+	sta     (sp),y
+	iny
+	lda     #>(S0018)
+	sta     (sp),y
+	jsr     _downneg
+	sta     (sp)
+	ldy     #$01
+	txa
+	sta     (sp),y
+	ldx     #$00
+	lda     #$09
+	jsr     _check
+	jsr     decsp4
+	lda     #<(S0019)
+	ldy     #$02
+	sta     (sp),y
+	iny
+	lda     #>(S0019)
+	sta     (sp),y
+	jsr     _signedwrap
+	sta     (sp)
+	ldy     #$01
+	txa
+	sta     (sp),y
+	ldx     #$00
+	lda     #$08
+	jsr     _check
+	lda     #<(_b)
+	ldx     #>(_b)
+	jsr     pushax
+	ldx     #$01
+	lda     #$00
+	jsr     __bzero
+	jsr     _reverse
+	jsr     decsp4
+	lda     #<(S001A)
+	ldy     #$02
+	sta     (sp),y
+	iny
+	lda     #>(S001A)
+	sta     (sp),y
+	jsr     decsp4
+	lda     #<(_a)
+	dey
+	sta     (sp),y
+	iny
+	lda     #>(_a)
+	sta     (sp),y
+	lda     #<(_b)
+	sta     (sp)
+	ldy     #$01
+	lda     #>(_b)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$64
+	jsr     _memcmp
+	sta     (sp)
+	ldy     #$01
+	txa
+	sta     (sp),y
+	ldx     #$00
+	txa
+	jsr     _check
+	lda     #<(S001B)
+	ldx     #>(S001B)
+	jsr     pushax
+	lda     _failures
+	ldx     _failures+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     _failures
+	ldx     _failures+1
+	jmp     incsp1
+
+.endproc
+
@@ -0,0 +1,1021 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.import		_memcmp
+	.import		_memset
+	.export		_main
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$25,$73,$3A,$20,$25,$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64
+	.byte	$20,$25,$75,$0A,$00
+S0017:
+	.byte	$73,$74,$61,$74,$69,$63,$6E,$65,$67,$20,$6E,$6F,$6E,$65,$00
+S0011:
+	.byte	$6E,$65,$67,$73,$74,$61,$72,$74,$20,$6E,$6F,$6E,$65,$00
+S001B:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+S0012:
+	.byte	$6E,$65,$67,$73,$74,$61,$72,$74,$20,$6E,$65,$67,$00
+S0014:
+	.byte	$72,$65,$67,$6E,$65,$67,$20,$6E,$6F,$6E,$65,$00
+S000A:
+	.byte	$63,$6F,$75,$6E,$74,$20,$30,$20,$32,$35,$35,$00
+S0019:
+	.byte	$73,$69,$67,$6E,$65,$64,$77,$72,$61,$70,$00
+S0010:
+	.byte	$6E,$65,$67,$73,$74,$61,$72,$74,$20,$61,$00
+S0008:
+	.byte	$63,$6F,$75,$6E,$74,$20,$33,$20,$38,$00
+S0016:
+	.byte	$73,$74,$61,$74,$69,$63,$6E,$65,$67,$00
+S0006:
+	.byte	$66,$69,$6E,$64,$20,$6E,$6F,$6E,$65,$00
+S0009:
+	.byte	$63,$6F,$75,$6E,$74,$20,$38,$20,$33,$00
+S000F:
+	.byte	$6E,$65,$67,$73,$74,$61,$72,$74,$00
+S0015:
+	.byte	$72,$65,$67,$6E,$65,$67,$20,$61,$00
+S0018:
+	.byte	$64,$6F,$77,$6E,$6E,$65,$67,$00
+S001A:
+	.byte	$72,$65,$76,$65,$72,$73,$65,$00
+S0013:
+	.byte	$72,$65,$67,$6E,$65,$67,$00
+S000D:
+	.byte	$73,$6B,$69,$70,$20,$61,$00
+S000E:
+	.byte	$6E,$65,$73,$74,$65,$64,$00
+S0002:
+	.byte	$66,$69,$6C,$6C,$20,$69,$00
+S000B:
+	.byte	$63,$61,$6C,$6C,$73,$00
+S0007:
+	.byte	$66,$69,$6C,$6C,$00
+S0005:
+	.byte	$66,$69,$6E,$64,$00
+S0003:
+	.byte	$63,$6F,$70,$79,$00
+S000C:
+	.byte	$73,$6B,$69,$70,$00
+S0004:
+	.byte	$73,$75,$6D,$00
+
+.segment	"BSS"
+
+_failures:
+	.res	2,$00
+_a:
+	.res	256,$00
+_b:
+	.res	256,$00
+_calls:
+	.res	1,$00
+
+; ---------------------------------------------------------------
+; void __near__ check (const char *name, unsigned int got, unsigned int expected)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_check: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	cmp     (sp)
+	bne     L0005
+	txa
+	ldy     #$01
+	cmp     (sp),y
+	beq     L0002
+L0005:	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$08
+	jsr     _printf
+	inc     _failures
+	bne     L0002
+	inc     _failures+1
+L0002:	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ copy (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_copy: near
+
+.segment	"CODE"
+
+	lda     regbank+5
+	jsr     pusha
+	lda     #$00
+	stz     regbank+5
+	tay
+	bra     L0008
+L0005:	lda     _b,y
+	sta     _a,y
+	iny
+L0008:	cpy     #$64
+	bcc     L0005
+	lda     (sp)
+	sta     regbank+5
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ fill (unsigned char v)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fill: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	lda     #$0A
+	sta     M0001
+	bra     L0007
+L0005:	lda     (sp)
+	ldy     M0001
+	sta     _a,y
+	inc     M0001
+L0007:	lda     M0001
+	cmp     #$3C
+	bne     L0005
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	lda     M0001
+	jsr     pusha0
+	lda     #$3C
+	jsr     _check
+	jmp     incsp1
+
+.segment	"BSS"
+
+M0001:
+	.res	1,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ sum (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_sum: near
+
+.segment	"CODE"
+
+	lda     regbank+5
+	jsr     pusha
+	lda     regbank+3
+	ldx     regbank+4
+	jsr     pushax
+	lda     #$00
+	stz     regbank+3
+	stz     regbank+3+1
+	stz     regbank+5
+	tay
+	bra     L0008
+L0005:	lda     _a,y
+	clc
+	adc     regbank+3
+	sta     regbank+3
+	lda     #$00
+	adc     regbank+3+1
+	sta     regbank+3+1
+	iny
+L0008:	cpy     #$C8
+	bcc     L0005
+	sty     regbank+5
+	lda     regbank+3
+	ldx     regbank+3+1
+	pha
+	ldy     #$00
+L0007:	lda     (sp),y
+	sta     regbank+3,y
+	iny
+	cpy     #$03
+	bne     L0007
+	pla
+	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ count (unsigned char start, unsigned char end)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_count: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	lda     regbank+5
+	jsr     pusha
+	lda     #$00
+	jsr     pusha
+	ldy     #$03
+	lda     (sp),y
+	sta     regbank+5
+	tax
+	bra     L0006
+L0005:	clc
+	lda     #$01
+	adc     (sp)
+	sta     (sp)
+	inx
+L0006:	txa
+	ldy     #$02
+	cmp     (sp),y
+	bcc     L0005
+	ldx     #$00
+	lda     (sp)
+	pha
+	dey
+	lda     (sp),y
+	sta     regbank+5
+	pla
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ repeat (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_repeat: near
+
+.segment	"CODE"
+
+	lda     regbank+5
+	jsr     pusha
+	lda     #$0A
+	sta     regbank+5
+	tay
+L000E:	inc     _calls
+	dey
+	bne     L000E
+	lda     #$05
+	sta     regbank+5
+	tay
+	bra     L0011
+L0010:	inc     _calls
+	iny
+L0011:	cpy     #$05
+	bcc     L0010
+	lda     #$00
+	stz     regbank+5
+	tay
+	bra     L0013
+L0012:	inc     _calls
+	iny
+L0013:	tya
+	bne     L0012
+	lda     (sp)
+	sta     regbank+5
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ find (unsigned char c)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_find: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	lda     regbank+5
+	jsr     pusha
+	stz     regbank+5
+	bra     L0008
+L0005:	ldy     regbank+5
+	ldx     #$00
+	lda     _a,y
+	ldy     #$01
+	cmp     (sp),y
+	beq     L0009
+	inc     regbank+5
+L0008:	lda     regbank+5
+	cmp     #$64
+	bcc     L0005
+	ldx     #$00
+L0009:	lda     regbank+5
+	pha
+	lda     (sp)
+	sta     regbank+5
+	pla
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ skip (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_skip: near
+
+.segment	"CODE"
+
+	lda     regbank+5
+	jsr     pusha
+	lda     #$00
+	jsr     pusha
+	stz     regbank+5
+	bra     L000A
+L0008:	lda     regbank+5
+	and     #$01
+	bne     L0009
+	ldy     regbank+5
+	lda     regbank+5
+	sta     _a,y
+	clc
+	lda     #$01
+	adc     (sp)
+	sta     (sp)
+L0009:	inc     regbank+5
+L000A:	lda     regbank+5
+	cmp     #$32
+	bcc     L0008
+	ldx     #$00
+	lda     (sp)
+	pha
+	ldy     #$01
+	lda     (sp),y
+	sta     regbank+5
+	pla
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ nested (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_nested: near
+
+.segment	"CODE"
+
+	lda     regbank+5
+	jsr     pusha
+	lda     regbank+4
+	jsr     pusha
+	jsr     push0
+	stz     regbank+5
+	bra     L000E
+L000C:	stz     regbank+4
+	bra     L000D
+L0009:	ldy     regbank+4
+	lda     regbank+5
+	sta     _a,y
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	inc     regbank+4
+L000D:	lda     regbank+4
+	cmp     #$14
+	bcc     L0009
+	inc     regbank+5
+L000E:	lda     regbank+5
+	cmp     #$0A
+	bcc     L000C
+	jsr     ldax0sp
+	clc
+	adc     _a+19
+	bcc     L0001
+	inx
+L0001:	pha
+	ldy     #$02
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	pla
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ negstart (signed char n)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_negstart: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	jsr     decsp1
+	lda     #$00
+	jsr     pusha
+	lda     #$FB
+	ldy     #$01
+	sta     (sp),y
+	bra     L000A
+L0005:	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0009
+	dex
+L0009:	jsr     incax5
+	clc
+	adc     #<(_a)
+	sta     ptr1
+	txa
+	adc     #>(_a)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (sp),y
+	sta     (ptr1)
+	clc
+	tya
+	adc     (sp)
+	sta     (sp)
+	ldy     #$01
+	ldx     #$00
+	clc
+	tya
+	adc     (sp),y
+	sta     (sp),y
+	bpl     L000B
+L000A:	ldx     #$00
+L000B:	lda     (sp),y
+	bpl     L0006
+	dex
+L0006:	jsr     pushax
+	ldy     #$04
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0007
+	dex
+L0007:	jsr     tosicmp
+	bmi     L0005
+	ldx     #$00
+	lda     (sp)
+	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ regneg (signed char n)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_regneg: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	lda     regbank+5
+	jsr     pusha
+	lda     #$00
+	jsr     pusha
+	lda     #$FB
+	sta     regbank+5
+	bra     L0002
+L0005:	ldx     #$00
+	lda     regbank+5
+	bpl     L0009
+	dex
+L0009:	jsr     incax5
+	clc
+	adc     #<(_a)
+	sta     ptr1
+	txa
+	adc     #>(_a)
+	sta     ptr1+1
+	lda     regbank+5
+	sta     (ptr1)
+	clc
+	lda     #$01
+	adc     (sp)
+	sta     (sp)
+	ldx     #$00
+	inc     regbank+5
+	bpl     L000A
+L0002:	ldx     #$00
+L000A:	lda     regbank+5
+	bpl     L0006
+	dex
+L0006:	jsr     pushax
+	ldy     #$04
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0007
+	dex
+L0007:	jsr     tosicmp
+	bmi     L0005
+	ldx     #$00
+	lda     (sp)
+	pha
+	ldy     #$01
+	lda     (sp),y
+	sta     regbank+5
+	pla
+	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ staticneg (signed char n)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_staticneg: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	lda     #$00
+	jsr     pusha
+	lda     #$9C
+	sta     M0001
+	bra     L0002
+L0005:	clc
+	lda     #$01
+	adc     (sp)
+	sta     (sp)
+	ldx     #$00
+	lda     #$03
+	clc
+	adc     M0001
+	sta     M0001
+	bpl     L0009
+L0002:	ldx     #$00
+L0009:	lda     M0001
+	bpl     L0006
+	dex
+L0006:	jsr     pushax
+	ldy     #$03
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0007
+	dex
+L0007:	jsr     tosicmp
+	bmi     L0005
+	ldx     #$00
+	lda     (sp)
+	jmp     incsp2
+
+.segment	"BSS"
+
+M0001:
+	.res	1,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ downneg (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_downneg: near
+
+.segment	"CODE"
+
+	lda     regbank+5
+	jsr     pusha
+	lda     #$00
+	jsr     pusha
+	lda     #$05
+	sta     regbank+5
+	tax
+	bra     L0009
+L0005:	clc
+	lda     #$01
+	adc     (sp)
+	sta     (sp)
+	dex
+L0009:	txa
+	sec
+	sbc     #$FD
+	bvs     L0007
+	eor     #$80
+L0007:	bmi     L0005
+	ldx     #$00
+	lda     (sp)
+	pha
+	ldy     #$01
+	lda     (sp),y
+	sta     regbank+5
+	pla
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ signedwrap (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signedwrap: near
+
+.segment	"CODE"
+
+	lda     regbank+5
+	jsr     pusha
+	lda     #$00
+	jsr     pusha
+	lda     #$78
+	sta     regbank+5
+	tax
+	bra     L0009
+L0005:	clc
+	lda     #$01
+	adc     (sp)
+	sta     (sp)
+	inx
+L0009:	txa
+	sec
+	sbc     #$01
+	bvs     L0007
+	eor     #$80
+L0007:	bmi     L0005
+	ldx     #$00
+	lda     (sp)
+	pha
+	ldy     #$01
+	lda     (sp),y
+	sta     regbank+5
+	pla
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ reverse (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_reverse: near
+
+.segment	"CODE"
+
+	lda     regbank+5
+	jsr     pusha
+	lda     #$64
+	sta     regbank+5
+	tay
+	bra     L0004
+L0007:	dey
+	lda     _a,y
+	sta     _b,y
+L0004:	tya
+	bne     L0007
+	lda     (sp)
+	sta     regbank+5
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp1
+	lda     #$00
+	bra     L000D
+L0005:	lda     #<(_b)
+	ldx     #>(_b)
+	clc
+	adc     (sp)
+	bcc     L0006
+	inx
+L0006:	sta     ptr1
+	stx     ptr1+1
+	lda     (sp)
+	ina
+	sta     (ptr1)
+	clc
+	lda     #$01
+	adc     (sp)
+L000D:	sta     (sp)
+	cmp     #$64
+	bcc     L0005
+	jsr     _copy
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     #<(_a)
+	ldx     #>(_a)
+	jsr     pushax
+	lda     #<(_b)
+	ldx     #>(_b)
+	jsr     pushax
+	ldx     #$00
+	lda     #$64
+	jsr     _memcmp
+	jsr     pushax
+	ldx     #$00
+	txa
+	jsr     _check
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	jsr     _sum
+	jsr     pushax
+	ldx     #$13
+	lda     #$BA
+	jsr     _check
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     #$32
+	jsr     _find
+	jsr     pushax
+	ldx     #$00
+	lda     #$31
+	jsr     _check
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	lda     #$00
+	jsr     _find
+	jsr     pushax
+	ldx     #$00
+	lda     #$64
+	jsr     _check
+	lda     #$07
+	jsr     _fill
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldx     #$00
+	lda     _a+10
+	clc
+	adc     _a+59
+	bcc     L000E
+	inx
+	clc
+L000E:	adc     _a+9
+	bcc     L000F
+	inx
+	clc
+L000F:	adc     _a+60
+	bcc     L000A
+	inx
+L000A:	jsr     pushax
+	ldx     #$00
+	lda     #$55
+	jsr     _check
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	lda     #$03
+	jsr     pusha
+	lda     #$08
+	jsr     _count
+	jsr     pushax
+	ldx     #$00
+	lda     #$05
+	jsr     _check
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	lda     #$08
+	jsr     pusha
+	lda     #$03
+	jsr     _count
+	jsr     pushax
+	ldx     #$00
+	txa
+	jsr     _check
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	lda     #$00
+	jsr     pusha
+	dea
+	jsr     _count
+	jsr     pushax
+	ldx     #$00
+	lda     #$FF
+	jsr     _check
+	jsr     _repeat
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	lda     _calls
+	jsr     pusha0
+	lda     #$0A
+	jsr     _check
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	jsr     _skip
+	jsr     pushax
+	ldx     #$00
+	lda     #$19
+	jsr     _check
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	ldx     #$00
+	lda     _a+48
+	clc
+	adc     _a+49
+	bcc     L000B
+	inx
+L000B:	jsr     pushax
+	ldx     #$00
+	lda     #$37
+	jsr     _check
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	jsr     _nested
+	jsr     pushax
+	ldx     #$00
+	lda     #$D1
+	jsr     _check
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	lda     #$03
+	jsr     _negstart
+	jsr     pushax
+	ldx     #$00
+	lda     #$08
+	jsr     _check
+	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	ldx     #$00
+	lda     _a
+	clc
+	adc     _a+7
+	bcc     L000C
+	inx
+L000C:	jsr     pushax
+	ldx     #$00
+	lda     #$FD
+	jsr     _check
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	lda     #$FB
+	jsr     _negstart
+	jsr     pushax
+	ldx     #$00
+	txa
+	jsr     _check
+	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	lda     #$FE
+	jsr     _negstart
+	jsr     pushax
+	ldx     #$00
+	lda     #$03
+	jsr     _check
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	lda     #$03
+	jsr     _regneg
+	jsr     pushax
+	ldx     #$00
+	lda     #$08
+	jsr     _check
+	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	lda     #$FA
+	jsr     _regneg
+	jsr     pushax
+	ldx     #$00
+	txa
+	jsr     _check
+	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+	lda     _a+4
+	jsr     pusha0
+	lda     #$FF
+	jsr     _check
+	lda     #<(S0016)
+	ldx     #>(S0016)
+	jsr     pushax
+	lda     #$14
+	jsr     _staticneg
+	jsr     pushax
+	ldx     #$00
+	lda     #$28
+	jsr     _check
+	lda     #<(S0017)
+	ldx     #>(S0017)
+	jsr     pushax
+	lda     #$9C
+	jsr     _staticneg
+	jsr     pushax
+	ldx     #$00
+	txa
+	jsr     _check
+	lda     #<(S0018)
+	ldx     #>(S0018)
+	jsr     pushax
+	jsr     _downneg
+	jsr     pushax
+	ldx     #$00
+	lda     #$09
+	jsr     _check
+	lda     #<(S0019)
+	ldx     #>(S0019)
+	jsr     pushax
+	jsr     _signedwrap
+	jsr     pushax
+	ldx     #$00
+	lda     #$08
+	jsr     _check
+	lda     #<(_b)
+	ldx     #>(_b)
+	jsr     pushax
+	ldx     #$01
+	lda     #$00
+	jsr     __bzero
+	jsr     _reverse
+	lda     #<(S001A)
+	ldx     #>(S001A)
+	jsr     pushax
+	lda     #<(_a)
+	ldx     #>(_a)
+	jsr     pushax
+	lda     #<(_b)
+	ldx     #>(_b)
+	jsr     pushax
+	ldx     #$00
+	lda     #$64
+	jsr     _memcmp
+	jsr     pushax
+	ldx     #$00
+	txa
+	jsr     _check
+	lda     #<(S001B)
+	ldx     #>(S001B)
+	jsr     pushax
+	lda     _failures
+	ldx     _failures+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     _failures
+	ldx     _failures+1
+	jmp     incsp1
+
+.endproc
+
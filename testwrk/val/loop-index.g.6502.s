@@ -0,0 +1,1554 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "loop-index.c", 4409, 1792434024
+	.dbg		file, "/root/repo/include/stdio.h", 6189, 1613073744
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1613073744
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1613073744
+	.dbg		file, "/root/repo/include/string.h", 5104, 1613073744
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.dbg		sym, "memcmp", "00", extern, "_memcmp"
+	.dbg		sym, "memset", "00", extern, "_memset"
+	.import		_printf
+	.import		_memcmp
+	.import		_memset
+	.export		_main
+
+.segment	"RODATA"
+
+S0001:
+	.byte	$25,$73,$3A,$20,$25,$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64
+	.byte	$20,$25,$75,$0A,$00
+S0017:
+	.byte	$73,$74,$61,$74,$69,$63,$6E,$65,$67,$20,$6E,$6F,$6E,$65,$00
+S0011:
+	.byte	$6E,$65,$67,$73,$74,$61,$72,$74,$20,$6E,$6F,$6E,$65,$00
+S001B:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+S0012:
+	.byte	$6E,$65,$67,$73,$74,$61,$72,$74,$20,$6E,$65,$67,$00
+S0014:
+	.byte	$72,$65,$67,$6E,$65,$67,$20,$6E,$6F,$6E,$65,$00
+S000A:
+	.byte	$63,$6F,$75,$6E,$74,$20,$30,$20,$32,$35,$35,$00
+S0019:
+	.byte	$73,$69,$67,$6E,$65,$64,$77,$72,$61,$70,$00
+S0010:
+	.byte	$6E,$65,$67,$73,$74,$61,$72,$74,$20,$61,$00
+S0008:
+	.byte	$63,$6F,$75,$6E,$74,$20,$33,$20,$38,$00
+S0016:
+	.byte	$73,$74,$61,$74,$69,$63,$6E,$65,$67,$00
+S0006:
+	.byte	$66,$69,$6E,$64,$20,$6E,$6F,$6E,$65,$00
+S0009:
+	.byte	$63,$6F,$75,$6E,$74,$20,$38,$20,$33,$00
+S000F:
+	.byte	$6E,$65,$67,$73,$74,$61,$72,$74,$00
+S0015:
+	.byte	$72,$65,$67,$6E,$65,$67,$20,$61,$00
+S0018:
+	.byte	$64,$6F,$77,$6E,$6E,$65,$67,$00
+S001A:
+	.byte	$72,$65,$76,$65,$72,$73,$65,$00
+S0013:
+	.byte	$72,$65,$67,$6E,$65,$67,$00
+S000D:
+	.byte	$73,$6B,$69,$70,$20,$61,$00
+S000E:
+	.byte	$6E,$65,$73,$74,$65,$64,$00
+S0002:
+	.byte	$66,$69,$6C,$6C,$20,$69,$00
+S000B:
+	.byte	$63,$61,$6C,$6C,$73,$00
+S0007:
+	.byte	$66,$69,$6C,$6C,$00
+S0005:
+	.byte	$66,$69,$6E,$64,$00
+S0003:
+	.byte	$63,$6F,$70,$79,$00
+S000C:
+	.byte	$73,$6B,$69,$70,$00
+S0004:
+	.byte	$73,$75,$6D,$00
+
+.segment	"BSS"
+
+_failures:
+	.res	2,$00
+_a:
+	.res	256,$00
+_b:
+	.res	256,$00
+_calls:
+	.res	1,$00
+
+; ---------------------------------------------------------------
+; void __near__ touch (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_touch: near
+
+	.dbg	func, "touch", "00", static, "_touch"
+
+.segment	"CODE"
+
+	.dbg	line, "loop-index.c", 17
+	ldx     #$00
+	inc     _calls
+	lda     _calls
+	.dbg	line, "loop-index.c", 18
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ check (const char *name, unsigned int got, unsigned int expected)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_check: near
+
+	.dbg	func, "check", "00", static, "_check"
+	.dbg	sym, "name", "00", auto, 4
+	.dbg	sym, "got", "00", auto, 2
+	.dbg	sym, "expected", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "loop-index.c", 21
+	jsr     pushax
+	.dbg	line, "loop-index.c", 22
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosneax
+	jeq     L0002
+	.dbg	line, "loop-index.c", 23
+	lda     #<(S0001)
+	ldx     #>(S0001)
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "loop-index.c", 24
+	inc     _failures
+	bne     L0003
+	inc     _failures+1
+L0003:	lda     _failures
+	ldx     _failures+1
+	.dbg	line, "loop-index.c", 26
+L0002:	jsr     incsp6
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ copy (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_copy: near
+
+	.dbg	func, "copy", "00", static, "_copy"
+	.dbg	sym, "i", "00", auto, -1
+
+.segment	"CODE"
+
+	.dbg	line, "loop-index.c", 31
+	jsr     decsp1
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	sta     (sp),y
+	jmp     L0002
+	.dbg	line, "loop-index.c", 32
+L0005:	lda     #<(_a)
+	ldx     #>(_a)
+	ldy     #$00
+	clc
+	adc     (sp),y
+	bcc     L0006
+	inx
+L0006:	jsr     pushax
+	lda     #<(_b)
+	ldx     #>(_b)
+	ldy     #$02
+	clc
+	adc     (sp),y
+	bcc     L0007
+	inx
+L0007:	ldy     #$00
+	jsr     ldauidx
+	ldy     #$00
+	jsr     staspidx
+	.dbg	line, "loop-index.c", 31
+	ldy     #$00
+	ldx     #$00
+	clc
+	lda     #$01
+	adc     (sp),y
+	sta     (sp),y
+	jmp     L0002
+L0002:	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$64
+	jsr     boolult
+	jne     L0005
+	.dbg	line, "loop-index.c", 34
+	jsr     incsp1
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ fill (unsigned char v)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fill: near
+
+	.dbg	func, "fill", "00", static, "_fill"
+	.dbg	sym, "v", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "loop-index.c", 37
+	jsr     pusha
+	.dbg	line, "loop-index.c", 39
+	ldx     #$00
+	lda     #$0A
+	sta     M0001
+	jmp     L0002
+	.dbg	line, "loop-index.c", 40
+L0005:	lda     #<(_a)
+	ldx     #>(_a)
+	clc
+	adc     M0001
+	bcc     L0006
+	inx
+L0006:	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$00
+	jsr     staspidx
+	.dbg	line, "loop-index.c", 39
+	ldx     #$00
+	inc     M0001
+	lda     M0001
+	jmp     L0002
+L0002:	ldx     #$00
+	lda     M0001
+	cmp     #$3C
+	jsr     boolne
+	jne     L0005
+	.dbg	line, "loop-index.c", 43
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldx     #$00
+	lda     M0001
+	jsr     pushax
+	ldx     #$00
+	lda     #$3C
+	jsr     _check
+	.dbg	line, "loop-index.c", 44
+	jsr     incsp1
+	rts
+
+	.dbg	line
+.segment	"BSS"
+
+M0001:
+	.res	1,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ sum (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_sum: near
+
+	.dbg	func, "sum", "00", static, "_sum"
+	.dbg	sym, "i", "00", auto, -1
+	.dbg	sym, "s", "00", auto, -3
+
+.segment	"CODE"
+
+	.dbg	line, "loop-index.c", 49
+	jsr     decsp1
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	.dbg	line, "loop-index.c", 50
+	ldx     #$00
+	lda     #$00
+	ldy     #$02
+	sta     (sp),y
+	jmp     L0002
+	.dbg	line, "loop-index.c", 51
+L0005:	lda     #<(_a)
+	ldx     #>(_a)
+	ldy     #$02
+	clc
+	adc     (sp),y
+	bcc     L0006
+	inx
+L0006:	ldy     #$00
+	jsr     ldauidx
+	ldy     #$00
+	jsr     addeqysp
+	.dbg	line, "loop-index.c", 50
+	ldy     #$02
+	ldx     #$00
+	clc
+	lda     #$01
+	adc     (sp),y
+	sta     (sp),y
+	jmp     L0002
+L0002:	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$C8
+	jsr     boolult
+	jne     L0005
+	.dbg	line, "loop-index.c", 53
+	ldy     #$01
+	jsr     ldaxysp
+	jmp     L0001
+	.dbg	line, "loop-index.c", 54
+L0001:	jsr     incsp3
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ count (unsigned char start, unsigned char end)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_count: near
+
+	.dbg	func, "count", "00", static, "_count"
+	.dbg	sym, "start", "00", auto, 1
+	.dbg	sym, "end", "00", auto, 0
+	.dbg	sym, "i", "00", auto, -1
+	.dbg	sym, "n", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "loop-index.c", 57
+	jsr     pusha
+	.dbg	line, "loop-index.c", 59
+	jsr     decsp1
+	lda     #$00
+	jsr     pusha
+	.dbg	line, "loop-index.c", 60
+	ldy     #$03
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$01
+	sta     (sp),y
+	jmp     L0002
+	.dbg	line, "loop-index.c", 61
+L0005:	ldy     #$00
+	ldx     #$00
+	clc
+	lda     #$01
+	adc     (sp),y
+	sta     (sp),y
+	.dbg	line, "loop-index.c", 60
+	ldy     #$01
+	ldx     #$00
+	clc
+	lda     #$01
+	adc     (sp),y
+	sta     (sp),y
+	jmp     L0002
+L0002:	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$04
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosultax
+	jne     L0005
+	.dbg	line, "loop-index.c", 63
+	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	jmp     L0001
+	.dbg	line, "loop-index.c", 64
+L0001:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ repeat (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_repeat: near
+
+	.dbg	func, "repeat", "00", static, "_repeat"
+	.dbg	sym, "i", "00", auto, -1
+
+.segment	"CODE"
+
+	.dbg	line, "loop-index.c", 69
+	jsr     decsp1
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	sta     (sp),y
+	jmp     L0002
+	.dbg	line, "loop-index.c", 70
+L0005:	jsr     _touch
+	.dbg	line, "loop-index.c", 69
+	ldy     #$00
+	ldx     #$00
+	clc
+	lda     #$01
+	adc     (sp),y
+	sta     (sp),y
+	jmp     L0002
+L0002:	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$0A
+	jsr     boolult
+	jne     L0005
+	.dbg	line, "loop-index.c", 72
+	ldx     #$00
+	lda     #$05
+	ldy     #$00
+	sta     (sp),y
+	jmp     L0006
+	.dbg	line, "loop-index.c", 73
+L0009:	jsr     _touch
+	.dbg	line, "loop-index.c", 72
+	ldy     #$00
+	ldx     #$00
+	clc
+	lda     #$01
+	adc     (sp),y
+	sta     (sp),y
+	jmp     L0006
+L0006:	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$05
+	jsr     boolult
+	jne     L0009
+	.dbg	line, "loop-index.c", 75
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	sta     (sp),y
+	jmp     L000A
+	.dbg	line, "loop-index.c", 76
+L000D:	jsr     _touch
+	.dbg	line, "loop-index.c", 75
+	ldy     #$00
+	ldx     #$00
+	clc
+	lda     #$01
+	adc     (sp),y
+	sta     (sp),y
+	jmp     L000A
+L000A:	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$00
+	jsr     boolne
+	jne     L000D
+	.dbg	line, "loop-index.c", 78
+	jsr     incsp1
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ find (unsigned char c)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_find: near
+
+	.dbg	func, "find", "00", static, "_find"
+	.dbg	sym, "c", "00", auto, 0
+	.dbg	sym, "i", "00", auto, -1
+
+.segment	"CODE"
+
+	.dbg	line, "loop-index.c", 81
+	jsr     pusha
+	.dbg	line, "loop-index.c", 83
+	jsr     decsp1
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	sta     (sp),y
+	jmp     L0002
+	.dbg	line, "loop-index.c", 84
+L0005:	lda     #<(_a)
+	ldx     #>(_a)
+	ldy     #$00
+	clc
+	adc     (sp),y
+	bcc     L0007
+	inx
+L0007:	ldy     #$00
+	jsr     ldauidx
+	jsr     pushax
+	ldy     #$03
+	ldx     #$00
+	lda     (sp),y
+	jsr     toseqax
+	jeq     L0006
+	.dbg	line, "loop-index.c", 85
+	jmp     L0003
+	.dbg	line, "loop-index.c", 83
+L0006:	ldy     #$00
+	ldx     #$00
+	clc
+	lda     #$01
+	adc     (sp),y
+	sta     (sp),y
+	jmp     L0002
+L0002:	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$64
+	jsr     boolult
+	jne     L0005
+	.dbg	line, "loop-index.c", 88
+L0003:	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	jmp     L0001
+	.dbg	line, "loop-index.c", 89
+L0001:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ skip (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_skip: near
+
+	.dbg	func, "skip", "00", static, "_skip"
+	.dbg	sym, "i", "00", auto, -1
+	.dbg	sym, "n", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "loop-index.c", 94
+	jsr     decsp1
+	lda     #$00
+	jsr     pusha
+	.dbg	line, "loop-index.c", 95
+	ldx     #$00
+	lda     #$00
+	ldy     #$01
+	sta     (sp),y
+	jmp     L0002
+	.dbg	line, "loop-index.c", 96
+L0005:	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	ldx     #$00
+	and     #$01
+	stx     tmp1
+	ora     tmp1
+	jeq     L0006
+	.dbg	line, "loop-index.c", 97
+	jmp     L0004
+	.dbg	line, "loop-index.c", 99
+L0006:	lda     #<(_a)
+	ldx     #>(_a)
+	ldy     #$01
+	clc
+	adc     (sp),y
+	bcc     L0007
+	inx
+L0007:	jsr     pushax
+	ldy     #$03
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$00
+	jsr     staspidx
+	.dbg	line, "loop-index.c", 100
+	ldy     #$00
+	ldx     #$00
+	clc
+	lda     #$01
+	adc     (sp),y
+	sta     (sp),y
+	.dbg	line, "loop-index.c", 95
+L0004:	ldy     #$01
+	ldx     #$00
+	clc
+	lda     #$01
+	adc     (sp),y
+	sta     (sp),y
+	jmp     L0002
+L0002:	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$32
+	jsr     boolult
+	jne     L0005
+	.dbg	line, "loop-index.c", 102
+	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	jmp     L0001
+	.dbg	line, "loop-index.c", 103
+L0001:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ nested (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_nested: near
+
+	.dbg	func, "nested", "00", static, "_nested"
+	.dbg	sym, "i", "00", auto, -1
+	.dbg	sym, "j", "00", auto, -2
+	.dbg	sym, "n", "00", auto, -4
+
+.segment	"CODE"
+
+	.dbg	line, "loop-index.c", 108
+	jsr     decsp2
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	.dbg	line, "loop-index.c", 109
+	ldx     #$00
+	lda     #$00
+	ldy     #$03
+	sta     (sp),y
+	jmp     L0002
+	.dbg	line, "loop-index.c", 110
+L0005:	ldx     #$00
+	lda     #$00
+	ldy     #$02
+	sta     (sp),y
+	jmp     L0006
+	.dbg	line, "loop-index.c", 111
+L0009:	lda     #<(_a)
+	ldx     #>(_a)
+	ldy     #$02
+	clc
+	adc     (sp),y
+	bcc     L000A
+	inx
+L000A:	jsr     pushax
+	ldy     #$05
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$00
+	jsr     staspidx
+	.dbg	line, "loop-index.c", 112
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	.dbg	line, "loop-index.c", 110
+	ldy     #$02
+	ldx     #$00
+	clc
+	lda     #$01
+	adc     (sp),y
+	sta     (sp),y
+	jmp     L0006
+L0006:	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$14
+	jsr     boolult
+	jne     L0009
+	.dbg	line, "loop-index.c", 109
+	ldy     #$03
+	ldx     #$00
+	clc
+	lda     #$01
+	adc     (sp),y
+	sta     (sp),y
+	jmp     L0002
+L0002:	ldy     #$03
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$0A
+	jsr     boolult
+	jne     L0005
+	.dbg	line, "loop-index.c", 115
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldx     #$00
+	lda     _a+19
+	jsr     tosaddax
+	jmp     L0001
+	.dbg	line, "loop-index.c", 116
+L0001:	jsr     incsp4
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ negstart (signed char n)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_negstart: near
+
+	.dbg	func, "negstart", "00", static, "_negstart"
+	.dbg	sym, "n", "00", auto, 0
+	.dbg	sym, "i", "00", auto, -1
+	.dbg	sym, "k", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "loop-index.c", 119
+	jsr     pusha
+	.dbg	line, "loop-index.c", 122
+	jsr     decsp1
+	lda     #$00
+	jsr     pusha
+	.dbg	line, "loop-index.c", 123
+	ldx     #$FF
+	lda     #$FB
+	ldy     #$01
+	sta     (sp),y
+	jmp     L0002
+	.dbg	line, "loop-index.c", 124
+L0005:	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0009
+	dex
+L0009:	jsr     incax5
+	clc
+	adc     #<(_a)
+	tay
+	txa
+	adc     #>(_a)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$03
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$00
+	jsr     staspidx
+	.dbg	line, "loop-index.c", 125
+	ldy     #$00
+	ldx     #$00
+	clc
+	lda     #$01
+	adc     (sp),y
+	sta     (sp),y
+	.dbg	line, "loop-index.c", 123
+	ldy     #$01
+	ldx     #$00
+	clc
+	lda     #$01
+	adc     (sp),y
+	sta     (sp),y
+	bpl     L0008
+	dex
+L0008:	jmp     L0002
+L0002:	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0006
+	dex
+L0006:	jsr     pushax
+	ldy     #$04
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0007
+	dex
+L0007:	jsr     tosltax
+	jne     L0005
+	.dbg	line, "loop-index.c", 127
+	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	jmp     L0001
+	.dbg	line, "loop-index.c", 128
+L0001:	jsr     incsp3
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ regneg (signed char n)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_regneg: near
+
+	.dbg	func, "regneg", "00", static, "_regneg"
+	.dbg	sym, "n", "00", auto, 0
+	.dbg	sym, "i", "00", auto, -1
+	.dbg	sym, "k", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "loop-index.c", 131
+	jsr     pusha
+	.dbg	line, "loop-index.c", 133
+	jsr     decsp1
+	lda     #$00
+	jsr     pusha
+	.dbg	line, "loop-index.c", 134
+	ldx     #$FF
+	lda     #$FB
+	ldy     #$01
+	sta     (sp),y
+	jmp     L0002
+	.dbg	line, "loop-index.c", 135
+L0005:	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0009
+	dex
+L0009:	jsr     incax5
+	clc
+	adc     #<(_a)
+	tay
+	txa
+	adc     #>(_a)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$03
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$00
+	jsr     staspidx
+	.dbg	line, "loop-index.c", 136
+	ldy     #$00
+	ldx     #$00
+	clc
+	lda     #$01
+	adc     (sp),y
+	sta     (sp),y
+	.dbg	line, "loop-index.c", 134
+	ldy     #$01
+	ldx     #$00
+	clc
+	lda     #$01
+	adc     (sp),y
+	sta     (sp),y
+	bpl     L0008
+	dex
+L0008:	jmp     L0002
+L0002:	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0006
+	dex
+L0006:	jsr     pushax
+	ldy     #$04
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0007
+	dex
+L0007:	jsr     tosltax
+	jne     L0005
+	.dbg	line, "loop-index.c", 138
+	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	jmp     L0001
+	.dbg	line, "loop-index.c", 139
+L0001:	jsr     incsp3
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ staticneg (signed char n)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_staticneg: near
+
+	.dbg	func, "staticneg", "00", static, "_staticneg"
+	.dbg	sym, "n", "00", auto, 0
+	.dbg	sym, "k", "00", auto, -1
+
+.segment	"CODE"
+
+	.dbg	line, "loop-index.c", 142
+	jsr     pusha
+	.dbg	line, "loop-index.c", 144
+	lda     #$00
+	jsr     pusha
+	.dbg	line, "loop-index.c", 145
+	ldx     #$FF
+	lda     #$9C
+	sta     M0001
+	jmp     L0002
+	.dbg	line, "loop-index.c", 146
+L0005:	ldy     #$00
+	ldx     #$00
+	clc
+	lda     #$01
+	adc     (sp),y
+	sta     (sp),y
+	.dbg	line, "loop-index.c", 145
+	ldx     #$00
+	lda     #$03
+	clc
+	adc     M0001
+	sta     M0001
+	bpl     L0008
+	dex
+L0008:	jmp     L0002
+L0002:	ldx     #$00
+	lda     M0001
+	bpl     L0006
+	dex
+L0006:	jsr     pushax
+	ldy     #$03
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0007
+	dex
+L0007:	jsr     tosltax
+	jne     L0005
+	.dbg	line, "loop-index.c", 148
+	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	jmp     L0001
+	.dbg	line, "loop-index.c", 149
+L0001:	jsr     incsp2
+	rts
+
+	.dbg	line
+.segment	"BSS"
+
+M0001:
+	.res	1,$00
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ downneg (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_downneg: near
+
+	.dbg	func, "downneg", "00", static, "_downneg"
+	.dbg	sym, "i", "00", auto, -1
+	.dbg	sym, "k", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "loop-index.c", 154
+	jsr     decsp1
+	lda     #$00
+	jsr     pusha
+	.dbg	line, "loop-index.c", 155
+	ldx     #$00
+	lda     #$05
+	ldy     #$01
+	sta     (sp),y
+	jmp     L0002
+	.dbg	line, "loop-index.c", 156
+L0005:	ldy     #$00
+	ldx     #$00
+	clc
+	lda     #$01
+	adc     (sp),y
+	sta     (sp),y
+	.dbg	line, "loop-index.c", 155
+	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	sec
+	sbc     #$01
+	sta     (sp),y
+	bpl     L0008
+	dex
+L0008:	jmp     L0002
+L0002:	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0006
+	dex
+L0006:	sec
+	sbc     #$FD
+	bvs     L0007
+	eor     #$80
+L0007:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0005
+	.dbg	line, "loop-index.c", 158
+	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	jmp     L0001
+	.dbg	line, "loop-index.c", 159
+L0001:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ signedwrap (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_signedwrap: near
+
+	.dbg	func, "signedwrap", "00", static, "_signedwrap"
+	.dbg	sym, "i", "00", auto, -1
+	.dbg	sym, "k", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "loop-index.c", 164
+	jsr     decsp1
+	lda     #$00
+	jsr     pusha
+	.dbg	line, "loop-index.c", 165
+	ldx     #$00
+	lda     #$78
+	ldy     #$01
+	sta     (sp),y
+	jmp     L0002
+	.dbg	line, "loop-index.c", 166
+L0005:	ldy     #$00
+	ldx     #$00
+	clc
+	lda     #$01
+	adc     (sp),y
+	sta     (sp),y
+	.dbg	line, "loop-index.c", 165
+	ldy     #$01
+	ldx     #$00
+	clc
+	lda     #$01
+	adc     (sp),y
+	sta     (sp),y
+	bpl     L0008
+	dex
+L0008:	jmp     L0002
+L0002:	ldy     #$01
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0006
+	dex
+L0006:	sec
+	sbc     #$01
+	bvs     L0007
+	eor     #$80
+L0007:	asl     a
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L0005
+	.dbg	line, "loop-index.c", 168
+	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	jmp     L0001
+	.dbg	line, "loop-index.c", 169
+L0001:	jsr     incsp2
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ reverse (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_reverse: near
+
+	.dbg	func, "reverse", "00", static, "_reverse"
+	.dbg	sym, "i", "00", auto, -1
+
+.segment	"CODE"
+
+	.dbg	line, "loop-index.c", 174
+	jsr     decsp1
+	ldx     #$00
+	lda     #$64
+	ldy     #$00
+	sta     (sp),y
+	.dbg	line, "loop-index.c", 175
+	jmp     L0004
+	.dbg	line, "loop-index.c", 176
+L0002:	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	sec
+	sbc     #$01
+	sta     (sp),y
+	.dbg	line, "loop-index.c", 177
+	lda     #<(_b)
+	ldx     #>(_b)
+	ldy     #$00
+	clc
+	adc     (sp),y
+	bcc     L0005
+	inx
+L0005:	jsr     pushax
+	lda     #<(_a)
+	ldx     #>(_a)
+	ldy     #$02
+	clc
+	adc     (sp),y
+	bcc     L0006
+	inx
+L0006:	ldy     #$00
+	jsr     ldauidx
+	ldy     #$00
+	jsr     staspidx
+	.dbg	line, "loop-index.c", 175
+L0004:	ldy     #$00
+	lda     (sp),y
+	jne     L0002
+	.dbg	line, "loop-index.c", 179
+	jsr     incsp1
+	rts
+
+	.dbg	line
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+	.dbg	sym, "i", "00", auto, -1
+
+.segment	"CODE"
+
+	.dbg	line, "loop-index.c", 185
+	jsr     decsp1
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	sta     (sp),y
+	jmp     L0002
+	.dbg	line, "loop-index.c", 186
+L0005:	lda     #<(_b)
+	ldx     #>(_b)
+	ldy     #$00
+	clc
+	adc     (sp),y
+	bcc     L0006
+	inx
+L0006:	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     incax1
+	ldx     #$00
+	ldy     #$00
+	jsr     staspidx
+	.dbg	line, "loop-index.c", 185
+	ldy     #$00
+	ldx     #$00
+	clc
+	lda     #$01
+	adc     (sp),y
+	sta     (sp),y
+	jmp     L0002
+L0002:	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$64
+	jsr     boolult
+	jne     L0005
+	.dbg	line, "loop-index.c", 188
+	jsr     _copy
+	.dbg	line, "loop-index.c", 189
+	lda     #<(S0003)
+	ldx     #>(S0003)
+	jsr     pushax
+	lda     #<(_a)
+	ldx     #>(_a)
+	jsr     pushax
+	lda     #<(_b)
+	ldx     #>(_b)
+	jsr     pushax
+	ldx     #$00
+	lda     #$64
+	jsr     _memcmp
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     _check
+	.dbg	line, "loop-index.c", 190
+	lda     #<(S0004)
+	ldx     #>(S0004)
+	jsr     pushax
+	jsr     _sum
+	jsr     pushax
+	ldx     #$13
+	lda     #$BA
+	jsr     _check
+	.dbg	line, "loop-index.c", 191
+	lda     #<(S0005)
+	ldx     #>(S0005)
+	jsr     pushax
+	lda     #$32
+	jsr     _find
+	jsr     pushax
+	ldx     #$00
+	lda     #$31
+	jsr     _check
+	.dbg	line, "loop-index.c", 192
+	lda     #<(S0006)
+	ldx     #>(S0006)
+	jsr     pushax
+	lda     #$00
+	jsr     _find
+	jsr     pushax
+	ldx     #$00
+	lda     #$64
+	jsr     _check
+	.dbg	line, "loop-index.c", 194
+	lda     #$07
+	jsr     _fill
+	.dbg	line, "loop-index.c", 195
+	lda     #<(S0007)
+	ldx     #>(S0007)
+	jsr     pushax
+	ldx     #$00
+	lda     _a+10
+	jsr     pushax
+	ldx     #$00
+	lda     _a+59
+	jsr     tosaddax
+	jsr     pushax
+	ldx     #$00
+	lda     _a+9
+	jsr     tosaddax
+	jsr     pushax
+	ldx     #$00
+	lda     _a+60
+	jsr     tosaddax
+	jsr     pushax
+	ldx     #$00
+	lda     #$55
+	jsr     _check
+	.dbg	line, "loop-index.c", 197
+	lda     #<(S0008)
+	ldx     #>(S0008)
+	jsr     pushax
+	lda     #$03
+	jsr     pusha
+	lda     #$08
+	jsr     _count
+	jsr     pushax
+	ldx     #$00
+	lda     #$05
+	jsr     _check
+	.dbg	line, "loop-index.c", 198
+	lda     #<(S0009)
+	ldx     #>(S0009)
+	jsr     pushax
+	lda     #$08
+	jsr     pusha
+	lda     #$03
+	jsr     _count
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     _check
+	.dbg	line, "loop-index.c", 199
+	lda     #<(S000A)
+	ldx     #>(S000A)
+	jsr     pushax
+	lda     #$00
+	jsr     pusha
+	lda     #$FF
+	jsr     _count
+	jsr     pushax
+	ldx     #$00
+	lda     #$FF
+	jsr     _check
+	.dbg	line, "loop-index.c", 201
+	jsr     _repeat
+	.dbg	line, "loop-index.c", 202
+	lda     #<(S000B)
+	ldx     #>(S000B)
+	jsr     pushax
+	ldx     #$00
+	lda     _calls
+	jsr     pushax
+	ldx     #$00
+	lda     #$0A
+	jsr     _check
+	.dbg	line, "loop-index.c", 204
+	lda     #<(S000C)
+	ldx     #>(S000C)
+	jsr     pushax
+	jsr     _skip
+	jsr     pushax
+	ldx     #$00
+	lda     #$19
+	jsr     _check
+	.dbg	line, "loop-index.c", 205
+	lda     #<(S000D)
+	ldx     #>(S000D)
+	jsr     pushax
+	ldx     #$00
+	lda     _a+48
+	jsr     pushax
+	ldx     #$00
+	lda     _a+49
+	jsr     tosaddax
+	jsr     pushax
+	ldx     #$00
+	lda     #$37
+	jsr     _check
+	.dbg	line, "loop-index.c", 207
+	lda     #<(S000E)
+	ldx     #>(S000E)
+	jsr     pushax
+	jsr     _nested
+	jsr     pushax
+	ldx     #$00
+	lda     #$D1
+	jsr     _check
+	.dbg	line, "loop-index.c", 209
+	lda     #<(S000F)
+	ldx     #>(S000F)
+	jsr     pushax
+	lda     #$03
+	jsr     _negstart
+	jsr     pushax
+	ldx     #$00
+	lda     #$08
+	jsr     _check
+	.dbg	line, "loop-index.c", 210
+	lda     #<(S0010)
+	ldx     #>(S0010)
+	jsr     pushax
+	ldx     #$00
+	lda     _a
+	jsr     pushax
+	ldx     #$00
+	lda     _a+7
+	jsr     tosaddax
+	jsr     pushax
+	ldx     #$00
+	lda     #$FD
+	jsr     _check
+	.dbg	line, "loop-index.c", 211
+	lda     #<(S0011)
+	ldx     #>(S0011)
+	jsr     pushax
+	lda     #$FB
+	jsr     _negstart
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     _check
+	.dbg	line, "loop-index.c", 212
+	lda     #<(S0012)
+	ldx     #>(S0012)
+	jsr     pushax
+	lda     #$FE
+	jsr     _negstart
+	jsr     pushax
+	ldx     #$00
+	lda     #$03
+	jsr     _check
+	.dbg	line, "loop-index.c", 213
+	lda     #<(S0013)
+	ldx     #>(S0013)
+	jsr     pushax
+	lda     #$03
+	jsr     _regneg
+	jsr     pushax
+	ldx     #$00
+	lda     #$08
+	jsr     _check
+	.dbg	line, "loop-index.c", 214
+	lda     #<(S0014)
+	ldx     #>(S0014)
+	jsr     pushax
+	lda     #$FA
+	jsr     _regneg
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     _check
+	.dbg	line, "loop-index.c", 215
+	lda     #<(S0015)
+	ldx     #>(S0015)
+	jsr     pushax
+	ldx     #$00
+	lda     _a+4
+	jsr     pushax
+	ldx     #$00
+	lda     #$FF
+	jsr     _check
+	.dbg	line, "loop-index.c", 216
+	lda     #<(S0016)
+	ldx     #>(S0016)
+	jsr     pushax
+	lda     #$14
+	jsr     _staticneg
+	jsr     pushax
+	ldx     #$00
+	lda     #$28
+	jsr     _check
+	.dbg	line, "loop-index.c", 217
+	lda     #<(S0017)
+	ldx     #>(S0017)
+	jsr     pushax
+	lda     #$9C
+	jsr     _staticneg
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     _check
+	.dbg	line, "loop-index.c", 218
+	lda     #<(S0018)
+	ldx     #>(S0018)
+	jsr     pushax
+	jsr     _downneg
+	jsr     pushax
+	ldx     #$00
+	lda     #$09
+	jsr     _check
+	.dbg	line, "loop-index.c", 219
+	lda     #<(S0019)
+	ldx     #>(S0019)
+	jsr     pushax
+	jsr     _signedwrap
+	jsr     pushax
+	ldx     #$00
+	lda     #$08
+	jsr     _check
+	.dbg	line, "loop-index.c", 221
+	lda     #<(_b)
+	ldx     #>(_b)
+	jsr     pushax
+	ldx     #$01
+	lda     #$00
+	jsr     __bzero
+	.dbg	line, "loop-index.c", 222
+	jsr     _reverse
+	.dbg	line, "loop-index.c", 223
+	lda     #<(S001A)
+	ldx     #>(S001A)
+	jsr     pushax
+	lda     #<(_a)
+	ldx     #>(_a)
+	jsr     pushax
+	lda     #<(_b)
+	ldx     #>(_b)
+	jsr     pushax
+	ldx     #$00
+	lda     #$64
+	jsr     _memcmp
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     _check
+	.dbg	line, "loop-index.c", 225
+	lda     #<(S001B)
+	ldx     #>(S001B)
+	jsr     pushax
+	lda     _failures
+	ldx     _failures+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "loop-index.c", 226
+	lda     _failures
+	ldx     _failures+1
+	jmp     L0001
+	.dbg	line, "loop-index.c", 227
+L0001:	jsr     incsp1
+	rts
+
+	.dbg	line
+.endproc
+
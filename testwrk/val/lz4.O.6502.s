@@ -0,0 +1,7789 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_adler32
+	.import		_decompress_lz4
+	.export		_main
+
+.segment	"RODATA"
+
+_compressed:
+	.byte	$F0
+	.byte	$1A
+	.byte	$2F
+	.byte	$2A
+	.byte	$0A
+	.byte	$20
+	.byte	$20
+	.byte	$20
+	.byte	$4C
+	.byte	$5A
+	.byte	$34
+	.byte	$20
+	.byte	$2D
+	.byte	$20
+	.byte	$46
+	.byte	$61
+	.byte	$73
+	.byte	$74
+	.byte	$20
+	.byte	$4C
+	.byte	$5A
+	.byte	$20
+	.byte	$63
+	.byte	$6F
+	.byte	$6D
+	.byte	$70
+	.byte	$72
+	.byte	$65
+	.byte	$73
+	.byte	$73
+	.byte	$69
+	.byte	$6F
+	.byte	$6E
+	.byte	$20
+	.byte	$61
+	.byte	$6C
+	.byte	$67
+	.byte	$6F
+	.byte	$72
+	.byte	$69
+	.byte	$74
+	.byte	$68
+	.byte	$6D
+	.byte	$27
+	.byte	$00
+	.byte	$B0
+	.byte	$48
+	.byte	$65
+	.byte	$61
+	.byte	$64
+	.byte	$65
+	.byte	$72
+	.byte	$20
+	.byte	$46
+	.byte	$69
+	.byte	$6C
+	.byte	$65
+	.byte	$0F
+	.byte	$00
+	.byte	$F0
+	.byte	$17
+	.byte	$43
+	.byte	$6F
+	.byte	$70
+	.byte	$79
+	.byte	$72
+	.byte	$69
+	.byte	$67
+	.byte	$68
+	.byte	$74
+	.byte	$20
+	.byte	$28
+	.byte	$43
+	.byte	$29
+	.byte	$20
+	.byte	$32
+	.byte	$30
+	.byte	$31
+	.byte	$31
+	.byte	$2D
+	.byte	$32
+	.byte	$30
+	.byte	$31
+	.byte	$35
+	.byte	$2C
+	.byte	$20
+	.byte	$59
+	.byte	$61
+	.byte	$6E
+	.byte	$6E
+	.byte	$20
+	.byte	$43
+	.byte	$6F
+	.byte	$6C
+	.byte	$6C
+	.byte	$65
+	.byte	$74
+	.byte	$2E
+	.byte	$0A
+	.byte	$2A
+	.byte	$00
+	.byte	$F2
+	.byte	$22
+	.byte	$42
+	.byte	$53
+	.byte	$44
+	.byte	$20
+	.byte	$32
+	.byte	$2D
+	.byte	$43
+	.byte	$6C
+	.byte	$61
+	.byte	$75
+	.byte	$73
+	.byte	$65
+	.byte	$20
+	.byte	$4C
+	.byte	$69
+	.byte	$63
+	.byte	$65
+	.byte	$6E
+	.byte	$73
+	.byte	$65
+	.byte	$20
+	.byte	$28
+	.byte	$68
+	.byte	$74
+	.byte	$74
+	.byte	$70
+	.byte	$3A
+	.byte	$2F
+	.byte	$2F
+	.byte	$77
+	.byte	$77
+	.byte	$77
+	.byte	$2E
+	.byte	$6F
+	.byte	$70
+	.byte	$65
+	.byte	$6E
+	.byte	$73
+	.byte	$6F
+	.byte	$75
+	.byte	$72
+	.byte	$63
+	.byte	$65
+	.byte	$2E
+	.byte	$6F
+	.byte	$72
+	.byte	$67
+	.byte	$2F
+	.byte	$6C
+	.byte	$23
+	.byte	$00
+	.byte	$63
+	.byte	$73
+	.byte	$2F
+	.byte	$62
+	.byte	$73
+	.byte	$64
+	.byte	$2D
+	.byte	$0D
+	.byte	$00
+	.byte	$51
+	.byte	$2E
+	.byte	$70
+	.byte	$68
+	.byte	$70
+	.byte	$29
+	.byte	$4E
+	.byte	$00
+	.byte	$B1
+	.byte	$52
+	.byte	$65
+	.byte	$64
+	.byte	$69
+	.byte	$73
+	.byte	$74
+	.byte	$72
+	.byte	$69
+	.byte	$62
+	.byte	$75
+	.byte	$74
+	.byte	$A3
+	.byte	$00
+	.byte	$30
+	.byte	$6E
+	.byte	$64
+	.byte	$20
+	.byte	$58
+	.byte	$00
+	.byte	$32
+	.byte	$69
+	.byte	$6E
+	.byte	$20
+	.byte	$43
+	.byte	$00
+	.byte	$01
+	.byte	$12
+	.byte	$00
+	.byte	$F1
+	.byte	$06
+	.byte	$62
+	.byte	$69
+	.byte	$6E
+	.byte	$61
+	.byte	$72
+	.byte	$79
+	.byte	$20
+	.byte	$66
+	.byte	$6F
+	.byte	$72
+	.byte	$6D
+	.byte	$73
+	.byte	$2C
+	.byte	$20
+	.byte	$77
+	.byte	$69
+	.byte	$74
+	.byte	$68
+	.byte	$20
+	.byte	$6F
+	.byte	$72
+	.byte	$08
+	.byte	$00
+	.byte	$30
+	.byte	$6F
+	.byte	$75
+	.byte	$74
+	.byte	$46
+	.byte	$00
+	.byte	$80
+	.byte	$6D
+	.byte	$6F
+	.byte	$64
+	.byte	$69
+	.byte	$66
+	.byte	$69
+	.byte	$63
+	.byte	$61
+	.byte	$44
+	.byte	$00
+	.byte	$F0
+	.byte	$22
+	.byte	$2C
+	.byte	$20
+	.byte	$61
+	.byte	$72
+	.byte	$65
+	.byte	$20
+	.byte	$70
+	.byte	$65
+	.byte	$72
+	.byte	$6D
+	.byte	$69
+	.byte	$74
+	.byte	$74
+	.byte	$65
+	.byte	$64
+	.byte	$20
+	.byte	$70
+	.byte	$72
+	.byte	$6F
+	.byte	$76
+	.byte	$69
+	.byte	$64
+	.byte	$65
+	.byte	$64
+	.byte	$20
+	.byte	$74
+	.byte	$68
+	.byte	$61
+	.byte	$74
+	.byte	$20
+	.byte	$74
+	.byte	$68
+	.byte	$65
+	.byte	$20
+	.byte	$66
+	.byte	$6F
+	.byte	$6C
+	.byte	$6C
+	.byte	$6F
+	.byte	$77
+	.byte	$69
+	.byte	$6E
+	.byte	$67
+	.byte	$20
+	.byte	$63
+	.byte	$6F
+	.byte	$6E
+	.byte	$64
+	.byte	$69
+	.byte	$35
+	.byte	$00
+	.byte	$10
+	.byte	$73
+	.byte	$35
+	.byte	$00
+	.byte	$01
+	.byte	$4A
+	.byte	$00
+	.byte	$31
+	.byte	$65
+	.byte	$74
+	.byte	$3A
+	.byte	$99
+	.byte	$00
+	.byte	$00
+	.byte	$01
+	.byte	$00
+	.byte	$1B
+	.byte	$2A
+	.byte	$9F
+	.byte	$00
+	.byte	$44
+	.byte	$73
+	.byte	$20
+	.byte	$6F
+	.byte	$66
+	.byte	$98
+	.byte	$00
+	.byte	$F1
+	.byte	$01
+	.byte	$63
+	.byte	$6F
+	.byte	$64
+	.byte	$65
+	.byte	$20
+	.byte	$6D
+	.byte	$75
+	.byte	$73
+	.byte	$74
+	.byte	$20
+	.byte	$72
+	.byte	$65
+	.byte	$74
+	.byte	$61
+	.byte	$69
+	.byte	$6E
+	.byte	$5A
+	.byte	$00
+	.byte	$40
+	.byte	$61
+	.byte	$62
+	.byte	$6F
+	.byte	$76
+	.byte	$1B
+	.byte	$00
+	.byte	$03
+	.byte	$4C
+	.byte	$01
+	.byte	$00
+	.byte	$48
+	.byte	$00
+	.byte	$F0
+	.byte	$02
+	.byte	$6E
+	.byte	$6F
+	.byte	$74
+	.byte	$69
+	.byte	$63
+	.byte	$65
+	.byte	$2C
+	.byte	$20
+	.byte	$74
+	.byte	$68
+	.byte	$69
+	.byte	$73
+	.byte	$20
+	.byte	$6C
+	.byte	$69
+	.byte	$73
+	.byte	$74
+	.byte	$44
+	.byte	$00
+	.byte	$08
+	.byte	$78
+	.byte	$00
+	.byte	$2B
+	.byte	$6E
+	.byte	$64
+	.byte	$95
+	.byte	$00
+	.byte	$BF
+	.byte	$64
+	.byte	$69
+	.byte	$73
+	.byte	$63
+	.byte	$6C
+	.byte	$61
+	.byte	$69
+	.byte	$6D
+	.byte	$65
+	.byte	$72
+	.byte	$2E
+	.byte	$89
+	.byte	$00
+	.byte	$07
+	.byte	$28
+	.byte	$69
+	.byte	$6E
+	.byte	$16
+	.byte	$01
+	.byte	$04
+	.byte	$89
+	.byte	$00
+	.byte	$76
+	.byte	$70
+	.byte	$72
+	.byte	$6F
+	.byte	$64
+	.byte	$75
+	.byte	$63
+	.byte	$65
+	.byte	$8C
+	.byte	$00
+	.byte	$00
+	.byte	$41
+	.byte	$00
+	.byte	$05
+	.byte	$8F
+	.byte	$00
+	.byte	$0F
+	.byte	$8C
+	.byte	$00
+	.byte	$2A
+	.byte	$00
+	.byte	$4A
+	.byte	$00
+	.byte	$03
+	.byte	$E6
+	.byte	$00
+	.byte	$94
+	.byte	$64
+	.byte	$6F
+	.byte	$63
+	.byte	$75
+	.byte	$6D
+	.byte	$65
+	.byte	$6E
+	.byte	$74
+	.byte	$61
+	.byte	$B3
+	.byte	$01
+	.byte	$F6
+	.byte	$04
+	.byte	$2F
+	.byte	$6F
+	.byte	$72
+	.byte	$20
+	.byte	$6F
+	.byte	$74
+	.byte	$68
+	.byte	$65
+	.byte	$72
+	.byte	$20
+	.byte	$6D
+	.byte	$61
+	.byte	$74
+	.byte	$65
+	.byte	$72
+	.byte	$69
+	.byte	$61
+	.byte	$6C
+	.byte	$73
+	.byte	$77
+	.byte	$01
+	.byte	$01
+	.byte	$AF
+	.byte	$01
+	.byte	$21
+	.byte	$74
+	.byte	$68
+	.byte	$8B
+	.byte	$00
+	.byte	$08
+	.byte	$C4
+	.byte	$00
+	.byte	$02
+	.byte	$4E
+	.byte	$02
+	.byte	$F0
+	.byte	$34
+	.byte	$54
+	.byte	$48
+	.byte	$49
+	.byte	$53
+	.byte	$20
+	.byte	$53
+	.byte	$4F
+	.byte	$46
+	.byte	$54
+	.byte	$57
+	.byte	$41
+	.byte	$52
+	.byte	$45
+	.byte	$20
+	.byte	$49
+	.byte	$53
+	.byte	$20
+	.byte	$50
+	.byte	$52
+	.byte	$4F
+	.byte	$56
+	.byte	$49
+	.byte	$44
+	.byte	$45
+	.byte	$44
+	.byte	$20
+	.byte	$42
+	.byte	$59
+	.byte	$20
+	.byte	$54
+	.byte	$48
+	.byte	$45
+	.byte	$20
+	.byte	$43
+	.byte	$4F
+	.byte	$50
+	.byte	$59
+	.byte	$52
+	.byte	$49
+	.byte	$47
+	.byte	$48
+	.byte	$54
+	.byte	$20
+	.byte	$48
+	.byte	$4F
+	.byte	$4C
+	.byte	$44
+	.byte	$45
+	.byte	$52
+	.byte	$53
+	.byte	$20
+	.byte	$41
+	.byte	$4E
+	.byte	$44
+	.byte	$20
+	.byte	$43
+	.byte	$4F
+	.byte	$4E
+	.byte	$54
+	.byte	$52
+	.byte	$49
+	.byte	$42
+	.byte	$55
+	.byte	$54
+	.byte	$4F
+	.byte	$52
+	.byte	$53
+	.byte	$47
+	.byte	$00
+	.byte	$71
+	.byte	$22
+	.byte	$41
+	.byte	$53
+	.byte	$20
+	.byte	$49
+	.byte	$53
+	.byte	$22
+	.byte	$1C
+	.byte	$00
+	.byte	$F1
+	.byte	$26
+	.byte	$41
+	.byte	$4E
+	.byte	$59
+	.byte	$20
+	.byte	$45
+	.byte	$58
+	.byte	$50
+	.byte	$52
+	.byte	$45
+	.byte	$53
+	.byte	$53
+	.byte	$20
+	.byte	$4F
+	.byte	$52
+	.byte	$20
+	.byte	$49
+	.byte	$4D
+	.byte	$50
+	.byte	$4C
+	.byte	$49
+	.byte	$45
+	.byte	$44
+	.byte	$20
+	.byte	$57
+	.byte	$41
+	.byte	$52
+	.byte	$52
+	.byte	$41
+	.byte	$4E
+	.byte	$54
+	.byte	$49
+	.byte	$45
+	.byte	$53
+	.byte	$2C
+	.byte	$20
+	.byte	$49
+	.byte	$4E
+	.byte	$43
+	.byte	$4C
+	.byte	$55
+	.byte	$44
+	.byte	$49
+	.byte	$4E
+	.byte	$47
+	.byte	$2C
+	.byte	$20
+	.byte	$42
+	.byte	$55
+	.byte	$54
+	.byte	$20
+	.byte	$4E
+	.byte	$4F
+	.byte	$54
+	.byte	$3A
+	.byte	$03
+	.byte	$A1
+	.byte	$49
+	.byte	$4D
+	.byte	$49
+	.byte	$54
+	.byte	$45
+	.byte	$44
+	.byte	$20
+	.byte	$54
+	.byte	$4F
+	.byte	$2C
+	.byte	$7B
+	.byte	$00
+	.byte	$0E
+	.byte	$3A
+	.byte	$00
+	.byte	$F1
+	.byte	$04
+	.byte	$20
+	.byte	$4F
+	.byte	$46
+	.byte	$20
+	.byte	$4D
+	.byte	$45
+	.byte	$52
+	.byte	$43
+	.byte	$48
+	.byte	$41
+	.byte	$4E
+	.byte	$54
+	.byte	$41
+	.byte	$42
+	.byte	$49
+	.byte	$4C
+	.byte	$49
+	.byte	$54
+	.byte	$59
+	.byte	$73
+	.byte	$00
+	.byte	$40
+	.byte	$46
+	.byte	$49
+	.byte	$54
+	.byte	$4E
+	.byte	$6F
+	.byte	$00
+	.byte	$30
+	.byte	$46
+	.byte	$4F
+	.byte	$52
+	.byte	$49
+	.byte	$00
+	.byte	$F0
+	.byte	$06
+	.byte	$41
+	.byte	$20
+	.byte	$50
+	.byte	$41
+	.byte	$52
+	.byte	$54
+	.byte	$49
+	.byte	$43
+	.byte	$55
+	.byte	$4C
+	.byte	$41
+	.byte	$52
+	.byte	$20
+	.byte	$50
+	.byte	$55
+	.byte	$52
+	.byte	$50
+	.byte	$4F
+	.byte	$53
+	.byte	$45
+	.byte	$20
+	.byte	$E0
+	.byte	$00
+	.byte	$FA
+	.byte	$0E
+	.byte	$44
+	.byte	$49
+	.byte	$53
+	.byte	$43
+	.byte	$4C
+	.byte	$41
+	.byte	$49
+	.byte	$4D
+	.byte	$45
+	.byte	$44
+	.byte	$2E
+	.byte	$20
+	.byte	$49
+	.byte	$4E
+	.byte	$20
+	.byte	$4E
+	.byte	$4F
+	.byte	$20
+	.byte	$45
+	.byte	$56
+	.byte	$45
+	.byte	$4E
+	.byte	$54
+	.byte	$20
+	.byte	$53
+	.byte	$48
+	.byte	$41
+	.byte	$4C
+	.byte	$4C
+	.byte	$EF
+	.byte	$00
+	.byte	$00
+	.byte	$48
+	.byte	$00
+	.byte	$50
+	.byte	$4F
+	.byte	$57
+	.byte	$4E
+	.byte	$45
+	.byte	$52
+	.byte	$C4
+	.byte	$00
+	.byte	$08
+	.byte	$EF
+	.byte	$00
+	.byte	$A0
+	.byte	$20
+	.byte	$42
+	.byte	$45
+	.byte	$20
+	.byte	$4C
+	.byte	$49
+	.byte	$41
+	.byte	$42
+	.byte	$4C
+	.byte	$45
+	.byte	$6F
+	.byte	$00
+	.byte	$01
+	.byte	$EE
+	.byte	$00
+	.byte	$60
+	.byte	$44
+	.byte	$49
+	.byte	$52
+	.byte	$45
+	.byte	$43
+	.byte	$54
+	.byte	$D7
+	.byte	$00
+	.byte	$06
+	.byte	$0A
+	.byte	$00
+	.byte	$90
+	.byte	$43
+	.byte	$49
+	.byte	$44
+	.byte	$45
+	.byte	$4E
+	.byte	$54
+	.byte	$41
+	.byte	$4C
+	.byte	$2C
+	.byte	$49
+	.byte	$00
+	.byte	$F3
+	.byte	$04
+	.byte	$53
+	.byte	$50
+	.byte	$45
+	.byte	$43
+	.byte	$49
+	.byte	$41
+	.byte	$4C
+	.byte	$2C
+	.byte	$20
+	.byte	$45
+	.byte	$58
+	.byte	$45
+	.byte	$4D
+	.byte	$50
+	.byte	$4C
+	.byte	$41
+	.byte	$52
+	.byte	$59
+	.byte	$2C
+	.byte	$57
+	.byte	$00
+	.byte	$FF
+	.byte	$05
+	.byte	$53
+	.byte	$45
+	.byte	$51
+	.byte	$55
+	.byte	$45
+	.byte	$4E
+	.byte	$54
+	.byte	$49
+	.byte	$41
+	.byte	$4C
+	.byte	$20
+	.byte	$44
+	.byte	$41
+	.byte	$4D
+	.byte	$41
+	.byte	$47
+	.byte	$45
+	.byte	$53
+	.byte	$20
+	.byte	$28
+	.byte	$1E
+	.byte	$01
+	.byte	$0F
+	.byte	$80
+	.byte	$50
+	.byte	$52
+	.byte	$4F
+	.byte	$43
+	.byte	$55
+	.byte	$52
+	.byte	$45
+	.byte	$4D
+	.byte	$BC
+	.byte	$00
+	.byte	$F1
+	.byte	$03
+	.byte	$4F
+	.byte	$46
+	.byte	$20
+	.byte	$53
+	.byte	$55
+	.byte	$42
+	.byte	$53
+	.byte	$54
+	.byte	$49
+	.byte	$54
+	.byte	$55
+	.byte	$54
+	.byte	$45
+	.byte	$20
+	.byte	$47
+	.byte	$4F
+	.byte	$4F
+	.byte	$44
+	.byte	$77
+	.byte	$01
+	.byte	$D1
+	.byte	$53
+	.byte	$45
+	.byte	$52
+	.byte	$56
+	.byte	$49
+	.byte	$43
+	.byte	$45
+	.byte	$53
+	.byte	$3B
+	.byte	$20
+	.byte	$4C
+	.byte	$4F
+	.byte	$53
+	.byte	$39
+	.byte	$01
+	.byte	$31
+	.byte	$55
+	.byte	$53
+	.byte	$45
+	.byte	$8D
+	.byte	$00
+	.byte	$41
+	.byte	$44
+	.byte	$41
+	.byte	$54
+	.byte	$41
+	.byte	$7F
+	.byte	$00
+	.byte	$80
+	.byte	$50
+	.byte	$52
+	.byte	$4F
+	.byte	$46
+	.byte	$49
+	.byte	$54
+	.byte	$53
+	.byte	$3B
+	.byte	$0C
+	.byte	$00
+	.byte	$41
+	.byte	$42
+	.byte	$55
+	.byte	$53
+	.byte	$49
+	.byte	$43
+	.byte	$01
+	.byte	$F1
+	.byte	$0D
+	.byte	$49
+	.byte	$4E
+	.byte	$54
+	.byte	$45
+	.byte	$52
+	.byte	$52
+	.byte	$55
+	.byte	$50
+	.byte	$54
+	.byte	$49
+	.byte	$4F
+	.byte	$4E
+	.byte	$29
+	.byte	$20
+	.byte	$48
+	.byte	$4F
+	.byte	$57
+	.byte	$45
+	.byte	$56
+	.byte	$45
+	.byte	$52
+	.byte	$20
+	.byte	$43
+	.byte	$41
+	.byte	$55
+	.byte	$53
+	.byte	$45
+	.byte	$44
+	.byte	$6C
+	.byte	$01
+	.byte	$20
+	.byte	$4F
+	.byte	$4E
+	.byte	$F4
+	.byte	$00
+	.byte	$02
+	.byte	$3C
+	.byte	$02
+	.byte	$40
+	.byte	$45
+	.byte	$4F
+	.byte	$52
+	.byte	$59
+	.byte	$5B
+	.byte	$00
+	.byte	$23
+	.byte	$4C
+	.byte	$49
+	.byte	$8E
+	.byte	$01
+	.byte	$90
+	.byte	$2C
+	.byte	$20
+	.byte	$57
+	.byte	$48
+	.byte	$45
+	.byte	$54
+	.byte	$48
+	.byte	$45
+	.byte	$52
+	.byte	$5F
+	.byte	$01
+	.byte	$01
+	.byte	$36
+	.byte	$01
+	.byte	$10
+	.byte	$41
+	.byte	$0F
+	.byte	$01
+	.byte	$68
+	.byte	$53
+	.byte	$54
+	.byte	$52
+	.byte	$49
+	.byte	$43
+	.byte	$54
+	.byte	$27
+	.byte	$00
+	.byte	$61
+	.byte	$4F
+	.byte	$52
+	.byte	$20
+	.byte	$54
+	.byte	$4F
+	.byte	$52
+	.byte	$D9
+	.byte	$00
+	.byte	$06
+	.byte	$F0
+	.byte	$00
+	.byte	$B0
+	.byte	$20
+	.byte	$4E
+	.byte	$45
+	.byte	$47
+	.byte	$4C
+	.byte	$49
+	.byte	$47
+	.byte	$45
+	.byte	$4E
+	.byte	$43
+	.byte	$45
+	.byte	$21
+	.byte	$00
+	.byte	$10
+	.byte	$4F
+	.byte	$49
+	.byte	$00
+	.byte	$A0
+	.byte	$57
+	.byte	$49
+	.byte	$53
+	.byte	$45
+	.byte	$29
+	.byte	$20
+	.byte	$41
+	.byte	$52
+	.byte	$49
+	.byte	$53
+	.byte	$21
+	.byte	$00
+	.byte	$11
+	.byte	$49
+	.byte	$7D
+	.byte	$00
+	.byte	$71
+	.byte	$20
+	.byte	$57
+	.byte	$41
+	.byte	$59
+	.byte	$20
+	.byte	$4F
+	.byte	$55
+	.byte	$FC
+	.byte	$00
+	.byte	$00
+	.byte	$B5
+	.byte	$01
+	.byte	$31
+	.byte	$55
+	.byte	$53
+	.byte	$45
+	.byte	$AF
+	.byte	$01
+	.byte	$1A
+	.byte	$46
+	.byte	$CF
+	.byte	$02
+	.byte	$11
+	.byte	$2C
+	.byte	$DE
+	.byte	$01
+	.byte	$80
+	.byte	$20
+	.byte	$49
+	.byte	$46
+	.byte	$20
+	.byte	$41
+	.byte	$44
+	.byte	$56
+	.byte	$49
+	.byte	$C0
+	.byte	$00
+	.byte	$03
+	.byte	$30
+	.byte	$00
+	.byte	$53
+	.byte	$50
+	.byte	$4F
+	.byte	$53
+	.byte	$53
+	.byte	$49
+	.byte	$3F
+	.byte	$02
+	.byte	$01
+	.byte	$3F
+	.byte	$01
+	.byte	$23
+	.byte	$43
+	.byte	$48
+	.byte	$7E
+	.byte	$01
+	.byte	$02
+	.byte	$15
+	.byte	$03
+	.byte	$70
+	.byte	$59
+	.byte	$6F
+	.byte	$75
+	.byte	$20
+	.byte	$63
+	.byte	$61
+	.byte	$6E
+	.byte	$9B
+	.byte	$03
+	.byte	$32
+	.byte	$74
+	.byte	$61
+	.byte	$63
+	.byte	$B5
+	.byte	$04
+	.byte	$B0
+	.byte	$61
+	.byte	$75
+	.byte	$74
+	.byte	$68
+	.byte	$6F
+	.byte	$72
+	.byte	$20
+	.byte	$61
+	.byte	$74
+	.byte	$20
+	.byte	$3A
+	.byte	$23
+	.byte	$00
+	.byte	$11
+	.byte	$2D
+	.byte	$E8
+	.byte	$05
+	.byte	$03
+	.byte	$8C
+	.byte	$04
+	.byte	$D0
+	.byte	$72
+	.byte	$65
+	.byte	$70
+	.byte	$6F
+	.byte	$73
+	.byte	$69
+	.byte	$74
+	.byte	$6F
+	.byte	$72
+	.byte	$79
+	.byte	$20
+	.byte	$3A
+	.byte	$20
+	.byte	$8A
+	.byte	$05
+	.byte	$F6
+	.byte	$0C
+	.byte	$73
+	.byte	$3A
+	.byte	$2F
+	.byte	$2F
+	.byte	$67
+	.byte	$69
+	.byte	$74
+	.byte	$68
+	.byte	$75
+	.byte	$62
+	.byte	$2E
+	.byte	$63
+	.byte	$6F
+	.byte	$6D
+	.byte	$2F
+	.byte	$43
+	.byte	$79
+	.byte	$61
+	.byte	$6E
+	.byte	$34
+	.byte	$39
+	.byte	$37
+	.byte	$33
+	.byte	$2F
+	.byte	$6C
+	.byte	$7A
+	.byte	$34
+	.byte	$3D
+	.byte	$00
+	.byte	$60
+	.byte	$70
+	.byte	$75
+	.byte	$62
+	.byte	$6C
+	.byte	$69
+	.byte	$63
+	.byte	$40
+	.byte	$04
+	.byte	$28
+	.byte	$75
+	.byte	$6D
+	.byte	$38
+	.byte	$00
+	.byte	$C1
+	.byte	$72
+	.byte	$6F
+	.byte	$75
+	.byte	$70
+	.byte	$73
+	.byte	$2E
+	.byte	$67
+	.byte	$6F
+	.byte	$6F
+	.byte	$67
+	.byte	$6C
+	.byte	$65
+	.byte	$3F
+	.byte	$00
+	.byte	$01
+	.byte	$22
+	.byte	$00
+	.byte	$32
+	.byte	$2F
+	.byte	$23
+	.byte	$21
+	.byte	$08
+	.byte	$00
+	.byte	$F0
+	.byte	$1B
+	.byte	$6C
+	.byte	$7A
+	.byte	$34
+	.byte	$63
+	.byte	$0A
+	.byte	$2A
+	.byte	$2F
+	.byte	$0A
+	.byte	$23
+	.byte	$70
+	.byte	$72
+	.byte	$61
+	.byte	$67
+	.byte	$6D
+	.byte	$61
+	.byte	$20
+	.byte	$6F
+	.byte	$6E
+	.byte	$63
+	.byte	$65
+	.byte	$0A
+	.byte	$0A
+	.byte	$23
+	.byte	$69
+	.byte	$66
+	.byte	$20
+	.byte	$64
+	.byte	$65
+	.byte	$66
+	.byte	$69
+	.byte	$6E
+	.byte	$65
+	.byte	$64
+	.byte	$20
+	.byte	$28
+	.byte	$5F
+	.byte	$5F
+	.byte	$63
+	.byte	$70
+	.byte	$6C
+	.byte	$75
+	.byte	$73
+	.byte	$04
+	.byte	$00
+	.byte	$F0
+	.byte	$08
+	.byte	$29
+	.byte	$0A
+	.byte	$65
+	.byte	$78
+	.byte	$74
+	.byte	$65
+	.byte	$72
+	.byte	$6E
+	.byte	$20
+	.byte	$22
+	.byte	$43
+	.byte	$22
+	.byte	$20
+	.byte	$7B
+	.byte	$0A
+	.byte	$23
+	.byte	$65
+	.byte	$6E
+	.byte	$64
+	.byte	$69
+	.byte	$66
+	.byte	$0A
+	.byte	$0A
+	.byte	$AB
+	.byte	$06
+	.byte	$74
+	.byte	$2A
+	.byte	$20
+	.byte	$6C
+	.byte	$7A
+	.byte	$34
+	.byte	$2E
+	.byte	$68
+	.byte	$2A
+	.byte	$04
+	.byte	$79
+	.byte	$73
+	.byte	$20
+	.byte	$62
+	.byte	$6C
+	.byte	$6F
+	.byte	$63
+	.byte	$6B
+	.byte	$B2
+	.byte	$06
+	.byte	$41
+	.byte	$66
+	.byte	$75
+	.byte	$6E
+	.byte	$63
+	.byte	$9B
+	.byte	$04
+	.byte	$11
+	.byte	$2C
+	.byte	$9C
+	.byte	$04
+	.byte	$F1
+	.byte	$02
+	.byte	$67
+	.byte	$69
+	.byte	$76
+	.byte	$65
+	.byte	$73
+	.byte	$20
+	.byte	$66
+	.byte	$75
+	.byte	$6C
+	.byte	$6C
+	.byte	$20
+	.byte	$62
+	.byte	$75
+	.byte	$66
+	.byte	$66
+	.byte	$65
+	.byte	$72
+	.byte	$22
+	.byte	$01
+	.byte	$60
+	.byte	$72
+	.byte	$6F
+	.byte	$6C
+	.byte	$20
+	.byte	$74
+	.byte	$6F
+	.byte	$47
+	.byte	$00
+	.byte	$42
+	.byte	$67
+	.byte	$72
+	.byte	$61
+	.byte	$6D
+	.byte	$37
+	.byte	$05
+	.byte	$B0
+	.byte	$2A
+	.byte	$20
+	.byte	$49
+	.byte	$66
+	.byte	$20
+	.byte	$79
+	.byte	$6F
+	.byte	$75
+	.byte	$20
+	.byte	$6E
+	.byte	$65
+	.byte	$FA
+	.byte	$05
+	.byte	$90
+	.byte	$6F
+	.byte	$20
+	.byte	$67
+	.byte	$65
+	.byte	$6E
+	.byte	$65
+	.byte	$72
+	.byte	$61
+	.byte	$74
+	.byte	$5A
+	.byte	$06
+	.byte	$C5
+	.byte	$74
+	.byte	$65
+	.byte	$72
+	.byte	$2D
+	.byte	$6F
+	.byte	$70
+	.byte	$65
+	.byte	$72
+	.byte	$61
+	.byte	$62
+	.byte	$6C
+	.byte	$65
+	.byte	$6E
+	.byte	$00
+	.byte	$F0
+	.byte	$01
+	.byte	$65
+	.byte	$64
+	.byte	$20
+	.byte	$64
+	.byte	$61
+	.byte	$74
+	.byte	$61
+	.byte	$20
+	.byte	$28
+	.byte	$72
+	.byte	$65
+	.byte	$73
+	.byte	$70
+	.byte	$65
+	.byte	$63
+	.byte	$74
+	.byte	$FD
+	.byte	$04
+	.byte	$00
+	.byte	$25
+	.byte	$01
+	.byte	$60
+	.byte	$66
+	.byte	$72
+	.byte	$61
+	.byte	$6D
+	.byte	$65
+	.byte	$20
+	.byte	$13
+	.byte	$00
+	.byte	$05
+	.byte	$61
+	.byte	$06
+	.byte	$20
+	.byte	$29
+	.byte	$2C
+	.byte	$60
+	.byte	$00
+	.byte	$00
+	.byte	$90
+	.byte	$00
+	.byte	$00
+	.byte	$A4
+	.byte	$01
+	.byte	$22
+	.byte	$6C
+	.byte	$65
+	.byte	$A0
+	.byte	$01
+	.byte	$40
+	.byte	$6C
+	.byte	$69
+	.byte	$62
+	.byte	$72
+	.byte	$8F
+	.byte	$05
+	.byte	$F1
+	.byte	$0E
+	.byte	$68
+	.byte	$61
+	.byte	$6E
+	.byte	$64
+	.byte	$6C
+	.byte	$65
+	.byte	$20
+	.byte	$69
+	.byte	$74
+	.byte	$73
+	.byte	$20
+	.byte	$6F
+	.byte	$77
+	.byte	$6E
+	.byte	$20
+	.byte	$6D
+	.byte	$65
+	.byte	$6D
+	.byte	$6F
+	.byte	$72
+	.byte	$79
+	.byte	$2C
+	.byte	$20
+	.byte	$70
+	.byte	$6C
+	.byte	$65
+	.byte	$61
+	.byte	$73
+	.byte	$65
+	.byte	$DC
+	.byte	$06
+	.byte	$31
+	.byte	$6C
+	.byte	$7A
+	.byte	$34
+	.byte	$56
+	.byte	$00
+	.byte	$B0
+	.byte	$2E
+	.byte	$68
+	.byte	$20
+	.byte	$69
+	.byte	$6E
+	.byte	$73
+	.byte	$74
+	.byte	$65
+	.byte	$61
+	.byte	$64
+	.byte	$2E
+	.byte	$50
+	.byte	$01
+	.byte	$3F
+	.byte	$0A
+	.byte	$2F
+	.byte	$2A
+	.byte	$01
+	.byte	$00
+	.byte	$12
+	.byte	$70
+	.byte	$0A
+	.byte	$2A
+	.byte	$20
+	.byte	$20
+	.byte	$56
+	.byte	$65
+	.byte	$72
+	.byte	$20
+	.byte	$01
+	.byte	$1F
+	.byte	$0A
+	.byte	$32
+	.byte	$00
+	.byte	$13
+	.byte	$32
+	.byte	$2F
+	.byte	$0A
+	.byte	$23
+	.byte	$9B
+	.byte	$01
+	.byte	$00
+	.byte	$D2
+	.byte	$00
+	.byte	$E0
+	.byte	$5F
+	.byte	$56
+	.byte	$45
+	.byte	$52
+	.byte	$53
+	.byte	$49
+	.byte	$4F
+	.byte	$4E
+	.byte	$5F
+	.byte	$4D
+	.byte	$41
+	.byte	$4A
+	.byte	$4F
+	.byte	$52
+	.byte	$5D
+	.byte	$06
+	.byte	$10
+	.byte	$31
+	.byte	$05
+	.byte	$00
+	.byte	$20
+	.byte	$2F
+	.byte	$2A
+	.byte	$09
+	.byte	$02
+	.byte	$60
+	.byte	$20
+	.byte	$62
+	.byte	$72
+	.byte	$65
+	.byte	$61
+	.byte	$6B
+	.byte	$FC
+	.byte	$00
+	.byte	$01
+	.byte	$27
+	.byte	$01
+	.byte	$20
+	.byte	$66
+	.byte	$61
+	.byte	$E9
+	.byte	$06
+	.byte	$8F
+	.byte	$68
+	.byte	$61
+	.byte	$6E
+	.byte	$67
+	.byte	$65
+	.byte	$73
+	.byte	$20
+	.byte	$20
+	.byte	$48
+	.byte	$00
+	.byte	$05
+	.byte	$22
+	.byte	$49
+	.byte	$4E
+	.byte	$48
+	.byte	$00
+	.byte	$17
+	.byte	$37
+	.byte	$48
+	.byte	$00
+	.byte	$94
+	.byte	$6E
+	.byte	$65
+	.byte	$77
+	.byte	$20
+	.byte	$28
+	.byte	$6E
+	.byte	$6F
+	.byte	$6E
+	.byte	$2D
+	.byte	$51
+	.byte	$00
+	.byte	$18
+	.byte	$29
+	.byte	$52
+	.byte	$00
+	.byte	$BF
+	.byte	$61
+	.byte	$70
+	.byte	$61
+	.byte	$62
+	.byte	$69
+	.byte	$6C
+	.byte	$69
+	.byte	$74
+	.byte	$69
+	.byte	$65
+	.byte	$73
+	.byte	$56
+	.byte	$00
+	.byte	$05
+	.byte	$7A
+	.byte	$52
+	.byte	$45
+	.byte	$4C
+	.byte	$45
+	.byte	$41
+	.byte	$53
+	.byte	$45
+	.byte	$9E
+	.byte	$00
+	.byte	$F0
+	.byte	$03
+	.byte	$74
+	.byte	$77
+	.byte	$65
+	.byte	$61
+	.byte	$6B
+	.byte	$73
+	.byte	$2C
+	.byte	$20
+	.byte	$62
+	.byte	$75
+	.byte	$67
+	.byte	$2D
+	.byte	$66
+	.byte	$69
+	.byte	$78
+	.byte	$65
+	.byte	$73
+	.byte	$2C
+	.byte	$08
+	.byte	$08
+	.byte	$70
+	.byte	$64
+	.byte	$65
+	.byte	$76
+	.byte	$65
+	.byte	$6C
+	.byte	$6F
+	.byte	$70
+	.byte	$92
+	.byte	$06
+	.byte	$0F
+	.byte	$4E
+	.byte	$00
+	.byte	$05
+	.byte	$8E
+	.byte	$4E
+	.byte	$55
+	.byte	$4D
+	.byte	$42
+	.byte	$45
+	.byte	$52
+	.byte	$20
+	.byte	$28
+	.byte	$00
+	.byte	$01
+	.byte	$40
+	.byte	$2A
+	.byte	$31
+	.byte	$30
+	.byte	$30
+	.byte	$04
+	.byte	$00
+	.byte	$2F
+	.byte	$20
+	.byte	$2B
+	.byte	$D5
+	.byte	$00
+	.byte	$00
+	.byte	$0E
+	.byte	$19
+	.byte	$00
+	.byte	$04
+	.byte	$98
+	.byte	$00
+	.byte	$51
+	.byte	$29
+	.byte	$0A
+	.byte	$69
+	.byte	$6E
+	.byte	$74
+	.byte	$19
+	.byte	$00
+	.byte	$12
+	.byte	$76
+	.byte	$8B
+	.byte	$01
+	.byte	$EF
+	.byte	$4E
+	.byte	$75
+	.byte	$6D
+	.byte	$62
+	.byte	$65
+	.byte	$72
+	.byte	$20
+	.byte	$28
+	.byte	$76
+	.byte	$6F
+	.byte	$69
+	.byte	$64
+	.byte	$29
+	.byte	$3B
+	.byte	$CD
+	.byte	$01
+	.byte	$1A
+	.byte	$30
+	.byte	$54
+	.byte	$75
+	.byte	$6E
+	.byte	$72
+	.byte	$01
+	.byte	$20
+	.byte	$70
+	.byte	$61
+	.byte	$15
+	.byte	$02
+	.byte	$3F
+	.byte	$74
+	.byte	$65
+	.byte	$72
+	.byte	$D6
+	.byte	$01
+	.byte	$16
+	.byte	$02
+	.byte	$45
+	.byte	$03
+	.byte	$00
+	.byte	$85
+	.byte	$00
+	.byte	$C0
+	.byte	$4D
+	.byte	$45
+	.byte	$4D
+	.byte	$4F
+	.byte	$52
+	.byte	$59
+	.byte	$5F
+	.byte	$55
+	.byte	$53
+	.byte	$41
+	.byte	$47
+	.byte	$45
+	.byte	$20
+	.byte	$04
+	.byte	$31
+	.byte	$2A
+	.byte	$20
+	.byte	$4D
+	.byte	$78
+	.byte	$02
+	.byte	$61
+	.byte	$20
+	.byte	$75
+	.byte	$73
+	.byte	$61
+	.byte	$67
+	.byte	$65
+	.byte	$23
+	.byte	$08
+	.byte	$F0
+	.byte	$1D
+	.byte	$75
+	.byte	$6C
+	.byte	$61
+	.byte	$20
+	.byte	$3A
+	.byte	$20
+	.byte	$4E
+	.byte	$2D
+	.byte	$3E
+	.byte	$32
+	.byte	$5E
+	.byte	$4E
+	.byte	$20
+	.byte	$42
+	.byte	$79
+	.byte	$74
+	.byte	$65
+	.byte	$73
+	.byte	$20
+	.byte	$28
+	.byte	$65
+	.byte	$78
+	.byte	$61
+	.byte	$6D
+	.byte	$70
+	.byte	$6C
+	.byte	$65
+	.byte	$73
+	.byte	$20
+	.byte	$3A
+	.byte	$20
+	.byte	$31
+	.byte	$30
+	.byte	$20
+	.byte	$2D
+	.byte	$3E
+	.byte	$20
+	.byte	$31
+	.byte	$4B
+	.byte	$42
+	.byte	$3B
+	.byte	$20
+	.byte	$31
+	.byte	$32
+	.byte	$0B
+	.byte	$00
+	.byte	$80
+	.byte	$34
+	.byte	$4B
+	.byte	$42
+	.byte	$20
+	.byte	$3B
+	.byte	$20
+	.byte	$31
+	.byte	$36
+	.byte	$0C
+	.byte	$00
+	.byte	$20
+	.byte	$36
+	.byte	$34
+	.byte	$18
+	.byte	$00
+	.byte	$12
+	.byte	$32
+	.byte	$23
+	.byte	$00
+	.byte	$91
+	.byte	$4D
+	.byte	$42
+	.byte	$3B
+	.byte	$20
+	.byte	$65
+	.byte	$74
+	.byte	$63
+	.byte	$2E
+	.byte	$29
+	.byte	$66
+	.byte	$03
+	.byte	$60
+	.byte	$6E
+	.byte	$63
+	.byte	$72
+	.byte	$65
+	.byte	$61
+	.byte	$73
+	.byte	$C0
+	.byte	$00
+	.byte	$18
+	.byte	$6D
+	.byte	$72
+	.byte	$00
+	.byte	$20
+	.byte	$69
+	.byte	$6D
+	.byte	$D6
+	.byte	$03
+	.byte	$29
+	.byte	$65
+	.byte	$73
+	.byte	$CE
+	.byte	$03
+	.byte	$10
+	.byte	$72
+	.byte	$3F
+	.byte	$03
+	.byte	$12
+	.byte	$0A
+	.byte	$CD
+	.byte	$08
+	.byte	$4A
+	.byte	$75
+	.byte	$63
+	.byte	$65
+	.byte	$64
+	.byte	$33
+	.byte	$00
+	.byte	$00
+	.byte	$4D
+	.byte	$03
+	.byte	$03
+	.byte	$37
+	.byte	$00
+	.byte	$00
+	.byte	$70
+	.byte	$03
+	.byte	$70
+	.byte	$65
+	.byte	$64
+	.byte	$2C
+	.byte	$20
+	.byte	$64
+	.byte	$75
+	.byte	$65
+	.byte	$BC
+	.byte	$03
+	.byte	$C0
+	.byte	$63
+	.byte	$61
+	.byte	$63
+	.byte	$68
+	.byte	$65
+	.byte	$20
+	.byte	$65
+	.byte	$66
+	.byte	$66
+	.byte	$65
+	.byte	$63
+	.byte	$74
+	.byte	$3F
+	.byte	$00
+	.byte	$F1
+	.byte	$05
+	.byte	$44
+	.byte	$65
+	.byte	$66
+	.byte	$61
+	.byte	$75
+	.byte	$6C
+	.byte	$74
+	.byte	$20
+	.byte	$76
+	.byte	$61
+	.byte	$6C
+	.byte	$75
+	.byte	$65
+	.byte	$20
+	.byte	$69
+	.byte	$73
+	.byte	$20
+	.byte	$31
+	.byte	$34
+	.byte	$2C
+	.byte	$20
+	.byte	$02
+	.byte	$F0
+	.byte	$05
+	.byte	$31
+	.byte	$36
+	.byte	$4B
+	.byte	$42
+	.byte	$2C
+	.byte	$20
+	.byte	$77
+	.byte	$68
+	.byte	$69
+	.byte	$63
+	.byte	$68
+	.byte	$20
+	.byte	$6E
+	.byte	$69
+	.byte	$63
+	.byte	$65
+	.byte	$6C
+	.byte	$79
+	.byte	$20
+	.byte	$66
+	.byte	$89
+	.byte	$03
+	.byte	$F2
+	.byte	$02
+	.byte	$69
+	.byte	$6E
+	.byte	$74
+	.byte	$6F
+	.byte	$20
+	.byte	$49
+	.byte	$6E
+	.byte	$74
+	.byte	$65
+	.byte	$6C
+	.byte	$20
+	.byte	$78
+	.byte	$38
+	.byte	$36
+	.byte	$20
+	.byte	$4C
+	.byte	$31
+	.byte	$53
+	.byte	$00
+	.byte	$1C
+	.byte	$0A
+	.byte	$2F
+	.byte	$02
+	.byte	$09
+	.byte	$47
+	.byte	$01
+	.byte	$3F
+	.byte	$31
+	.byte	$34
+	.byte	$0A
+	.byte	$C7
+	.byte	$01
+	.byte	$1A
+	.byte	$20
+	.byte	$53
+	.byte	$69
+	.byte	$4C
+	.byte	$01
+	.byte	$24
+	.byte	$20
+	.byte	$46
+	.byte	$B3
+	.byte	$04
+	.byte	$0F
+	.byte	$C7
+	.byte	$01
+	.byte	$16
+	.byte	$05
+	.byte	$4B
+	.byte	$02
+	.byte	$04
+	.byte	$2C
+	.byte	$01
+	.byte	$22
+	.byte	$5F
+	.byte	$64
+	.byte	$E1
+	.byte	$00
+	.byte	$60
+	.byte	$28
+	.byte	$63
+	.byte	$6F
+	.byte	$6E
+	.byte	$73
+	.byte	$74
+	.byte	$81
+	.byte	$03
+	.byte	$23
+	.byte	$72
+	.byte	$2A
+	.byte	$EB
+	.byte	$05
+	.byte	$13
+	.byte	$2C
+	.byte	$0E
+	.byte	$00
+	.byte	$50
+	.byte	$64
+	.byte	$65
+	.byte	$73
+	.byte	$74
+	.byte	$2C
+	.byte	$D8
+	.byte	$00
+	.byte	$03
+	.byte	$18
+	.byte	$00
+	.byte	$42
+	.byte	$53
+	.byte	$69
+	.byte	$7A
+	.byte	$65
+	.byte	$10
+	.byte	$00
+	.byte	$70
+	.byte	$6D
+	.byte	$61
+	.byte	$78
+	.byte	$44
+	.byte	$65
+	.byte	$73
+	.byte	$74
+	.byte	$11
+	.byte	$00
+	.byte	$25
+	.byte	$29
+	.byte	$3B
+	.byte	$5B
+	.byte	$00
+	.byte	$25
+	.byte	$64
+	.byte	$65
+	.byte	$5D
+	.byte	$00
+	.byte	$5F
+	.byte	$73
+	.byte	$61
+	.byte	$66
+	.byte	$65
+	.byte	$20
+	.byte	$5B
+	.byte	$00
+	.byte	$12
+	.byte	$06
+	.byte	$1C
+	.byte	$05
+	.byte	$0B
+	.byte	$5F
+	.byte	$00
+	.byte	$0A
+	.byte	$19
+	.byte	$00
+	.byte	$02
+	.byte	$EF
+	.byte	$02
+	.byte	$1F
+	.byte	$0A
+	.byte	$C2
+	.byte	$00
+	.byte	$02
+	.byte	$12
+	.byte	$29
+	.byte	$AE
+	.byte	$06
+	.byte	$24
+	.byte	$20
+	.byte	$43
+	.byte	$32
+	.byte	$00
+	.byte	$36
+	.byte	$73
+	.byte	$20
+	.byte	$27
+	.byte	$B2
+	.byte	$00
+	.byte	$31
+	.byte	$27
+	.byte	$20
+	.byte	$62
+	.byte	$89
+	.byte	$02
+	.byte	$44
+	.byte	$66
+	.byte	$72
+	.byte	$6F
+	.byte	$6D
+	.byte	$D2
+	.byte	$05
+	.byte	$03
+	.byte	$1F
+	.byte	$00
+	.byte	$11
+	.byte	$27
+	.byte	$37
+	.byte	$00
+	.byte	$01
+	.byte	$B9
+	.byte	$01
+	.byte	$E0
+	.byte	$61
+	.byte	$6C
+	.byte	$72
+	.byte	$65
+	.byte	$61
+	.byte	$64
+	.byte	$79
+	.byte	$20
+	.byte	$61
+	.byte	$6C
+	.byte	$6C
+	.byte	$6F
+	.byte	$63
+	.byte	$61
+	.byte	$D3
+	.byte	$0B
+	.byte	$10
+	.byte	$27
+	.byte	$A4
+	.byte	$00
+	.byte	$14
+	.byte	$27
+	.byte	$32
+	.byte	$00
+	.byte	$00
+	.byte	$94
+	.byte	$0B
+	.byte	$57
+	.byte	$69
+	.byte	$7A
+	.byte	$65
+	.byte	$20
+	.byte	$27
+	.byte	$FB
+	.byte	$00
+	.byte	$29
+	.byte	$27
+	.byte	$2E
+	.byte	$77
+	.byte	$00
+	.byte	$00
+	.byte	$7E
+	.byte	$02
+	.byte	$A3
+	.byte	$69
+	.byte	$73
+	.byte	$20
+	.byte	$67
+	.byte	$75
+	.byte	$61
+	.byte	$72
+	.byte	$61
+	.byte	$6E
+	.byte	$74
+	.byte	$13
+	.byte	$06
+	.byte	$40
+	.byte	$73
+	.byte	$75
+	.byte	$63
+	.byte	$63
+	.byte	$0B
+	.byte	$00
+	.byte	$2A
+	.byte	$69
+	.byte	$66
+	.byte	$3B
+	.byte	$00
+	.byte	$39
+	.byte	$20
+	.byte	$3E
+	.byte	$3D
+	.byte	$8F
+	.byte	$01
+	.byte	$66
+	.byte	$42
+	.byte	$6F
+	.byte	$75
+	.byte	$6E
+	.byte	$64
+	.byte	$28
+	.byte	$B6
+	.byte	$00
+	.byte	$12
+	.byte	$29
+	.byte	$5C
+	.byte	$00
+	.byte	$F0
+	.byte	$11
+	.byte	$49
+	.byte	$74
+	.byte	$20
+	.byte	$61
+	.byte	$6C
+	.byte	$73
+	.byte	$6F
+	.byte	$20
+	.byte	$72
+	.byte	$75
+	.byte	$6E
+	.byte	$73
+	.byte	$20
+	.byte	$66
+	.byte	$61
+	.byte	$73
+	.byte	$74
+	.byte	$65
+	.byte	$72
+	.byte	$2C
+	.byte	$20
+	.byte	$73
+	.byte	$6F
+	.byte	$20
+	.byte	$69
+	.byte	$74
+	.byte	$27
+	.byte	$73
+	.byte	$20
+	.byte	$61
+	.byte	$20
+	.byte	$72
+	.byte	$26
+	.byte	$01
+	.byte	$30
+	.byte	$6D
+	.byte	$65
+	.byte	$6E
+	.byte	$03
+	.byte	$0B
+	.byte	$30
+	.byte	$73
+	.byte	$65
+	.byte	$74
+	.byte	$51
+	.byte	$06
+	.byte	$03
+	.byte	$38
+	.byte	$00
+	.byte	$12
+	.byte	$66
+	.byte	$64
+	.byte	$0B
+	.byte	$03
+	.byte	$DB
+	.byte	$06
+	.byte	$00
+	.byte	$F8
+	.byte	$02
+	.byte	$26
+	.byte	$6E
+	.byte	$6F
+	.byte	$6D
+	.byte	$01
+	.byte	$05
+	.byte	$01
+	.byte	$01
+	.byte	$03
+	.byte	$FD
+	.byte	$00
+	.byte	$40
+	.byte	$20
+	.byte	$6D
+	.byte	$6F
+	.byte	$72
+	.byte	$5E
+	.byte	$06
+	.byte	$29
+	.byte	$6D
+	.byte	$69
+	.byte	$FA
+	.byte	$00
+	.byte	$41
+	.byte	$64
+	.byte	$67
+	.byte	$65
+	.byte	$74
+	.byte	$4E
+	.byte	$09
+	.byte	$09
+	.byte	$62
+	.byte	$03
+	.byte	$F2
+	.byte	$04
+	.byte	$73
+	.byte	$74
+	.byte	$6F
+	.byte	$70
+	.byte	$73
+	.byte	$20
+	.byte	$2A
+	.byte	$69
+	.byte	$6D
+	.byte	$6D
+	.byte	$65
+	.byte	$64
+	.byte	$69
+	.byte	$61
+	.byte	$74
+	.byte	$65
+	.byte	$6C
+	.byte	$79
+	.byte	$2A
+	.byte	$3A
+	.byte	$07
+	.byte	$09
+	.byte	$72
+	.byte	$00
+	.byte	$30
+	.byte	$72
+	.byte	$65
+	.byte	$73
+	.byte	$3F
+	.byte	$03
+	.byte	$72
+	.byte	$69
+	.byte	$73
+	.byte	$20
+	.byte	$7A
+	.byte	$65
+	.byte	$72
+	.byte	$6F
+	.byte	$96
+	.byte	$00
+	.byte	$10
+	.byte	$41
+	.byte	$B4
+	.byte	$00
+	.byte	$00
+	.byte	$15
+	.byte	$02
+	.byte	$50
+	.byte	$65
+	.byte	$71
+	.byte	$75
+	.byte	$65
+	.byte	$6E
+	.byte	$0E
+	.byte	$02
+	.byte	$03
+	.byte	$6B
+	.byte	$00
+	.byte	$00
+	.byte	$62
+	.byte	$07
+	.byte	$21
+	.byte	$65
+	.byte	$6E
+	.byte	$2E
+	.byte	$00
+	.byte	$21
+	.byte	$6E
+	.byte	$6F
+	.byte	$74
+	.byte	$03
+	.byte	$22
+	.byte	$69
+	.byte	$64
+	.byte	$33
+	.byte	$00
+	.byte	$10
+	.byte	$54
+	.byte	$46
+	.byte	$0C
+	.byte	$05
+	.byte	$55
+	.byte	$00
+	.byte	$90
+	.byte	$6E
+	.byte	$65
+	.byte	$76
+	.byte	$65
+	.byte	$72
+	.byte	$20
+	.byte	$77
+	.byte	$72
+	.byte	$69
+	.byte	$D1
+	.byte	$01
+	.byte	$7A
+	.byte	$6F
+	.byte	$75
+	.byte	$74
+	.byte	$73
+	.byte	$69
+	.byte	$64
+	.byte	$65
+	.byte	$A9
+	.byte	$01
+	.byte	$60
+	.byte	$2C
+	.byte	$20
+	.byte	$6E
+	.byte	$6F
+	.byte	$72
+	.byte	$20
+	.byte	$CC
+	.byte	$01
+	.byte	$06
+	.byte	$20
+	.byte	$00
+	.byte	$04
+	.byte	$EC
+	.byte	$00
+	.byte	$02
+	.byte	$22
+	.byte	$00
+	.byte	$05
+	.byte	$F0
+	.byte	$0C
+	.byte	$07
+	.byte	$D6
+	.byte	$02
+	.byte	$E0
+	.byte	$20
+	.byte	$20
+	.byte	$3A
+	.byte	$20
+	.byte	$4D
+	.byte	$61
+	.byte	$78
+	.byte	$20
+	.byte	$73
+	.byte	$75
+	.byte	$70
+	.byte	$70
+	.byte	$6F
+	.byte	$72
+	.byte	$04
+	.byte	$01
+	.byte	$05
+	.byte	$F7
+	.byte	$03
+	.byte	$01
+	.byte	$B3
+	.byte	$03
+	.byte	$E5
+	.byte	$41
+	.byte	$58
+	.byte	$5F
+	.byte	$49
+	.byte	$4E
+	.byte	$50
+	.byte	$55
+	.byte	$54
+	.byte	$5F
+	.byte	$56
+	.byte	$41
+	.byte	$4C
+	.byte	$55
+	.byte	$45
+	.byte	$41
+	.byte	$00
+	.byte	$07
+	.byte	$D1
+	.byte	$01
+	.byte	$22
+	.byte	$20
+	.byte	$3A
+	.byte	$33
+	.byte	$08
+	.byte	$20
+	.byte	$6F
+	.byte	$72
+	.byte	$64
+	.byte	$05
+	.byte	$42
+	.byte	$74
+	.byte	$69
+	.byte	$61
+	.byte	$6C
+	.byte	$30
+	.byte	$02
+	.byte	$25
+	.byte	$6F
+	.byte	$66
+	.byte	$74
+	.byte	$02
+	.byte	$02
+	.byte	$A7
+	.byte	$00
+	.byte	$12
+	.byte	$28
+	.byte	$3A
+	.byte	$04
+	.byte	$01
+	.byte	$4C
+	.byte	$0D
+	.byte	$2E
+	.byte	$62
+	.byte	$65
+	.byte	$78
+	.byte	$02
+	.byte	$15
+	.byte	$29
+	.byte	$5E
+	.byte	$00
+	.byte	$81
+	.byte	$72
+	.byte	$65
+	.byte	$74
+	.byte	$75
+	.byte	$72
+	.byte	$6E
+	.byte	$20
+	.byte	$3A
+	.byte	$58
+	.byte	$01
+	.byte	$12
+	.byte	$6E
+	.byte	$FB
+	.byte	$05
+	.byte	$23
+	.byte	$6F
+	.byte	$66
+	.byte	$CE
+	.byte	$02
+	.byte	$00
+	.byte	$04
+	.byte	$01
+	.byte	$32
+	.byte	$74
+	.byte	$65
+	.byte	$6E
+	.byte	$C0
+	.byte	$01
+	.byte	$0B
+	.byte	$62
+	.byte	$00
+	.byte	$E0
+	.byte	$6E
+	.byte	$65
+	.byte	$63
+	.byte	$65
+	.byte	$73
+	.byte	$73
+	.byte	$61
+	.byte	$72
+	.byte	$69
+	.byte	$6C
+	.byte	$79
+	.byte	$20
+	.byte	$3C
+	.byte	$3D
+	.byte	$A6
+	.byte	$00
+	.byte	$52
+	.byte	$4F
+	.byte	$75
+	.byte	$74
+	.byte	$70
+	.byte	$75
+	.byte	$AF
+	.byte	$03
+	.byte	$29
+	.byte	$0A
+	.byte	$20
+	.byte	$01
+	.byte	$00
+	.byte	$40
+	.byte	$6F
+	.byte	$72
+	.byte	$20
+	.byte	$30
+	.byte	$9D
+	.byte	$02
+	.byte	$09
+	.byte	$11
+	.byte	$09
+	.byte	$6F
+	.byte	$61
+	.byte	$69
+	.byte	$6C
+	.byte	$73
+	.byte	$0A
+	.byte	$0A
+	.byte	$D3
+	.byte	$03
+	.byte	$00
+	.byte	$05
+	.byte	$6B
+	.byte	$03
+	.byte	$0A
+	.byte	$9D
+	.byte	$03
+	.byte	$20
+	.byte	$20
+	.byte	$3A
+	.byte	$2A
+	.byte	$01
+	.byte	$00
+	.byte	$A7
+	.byte	$00
+	.byte	$72
+	.byte	$70
+	.byte	$72
+	.byte	$65
+	.byte	$63
+	.byte	$69
+	.byte	$73
+	.byte	$65
+	.byte	$0C
+	.byte	$01
+	.byte	$04
+	.byte	$01
+	.byte	$01
+	.byte	$29
+	.byte	$74
+	.byte	$68
+	.byte	$03
+	.byte	$09
+	.byte	$01
+	.byte	$82
+	.byte	$09
+	.byte	$02
+	.byte	$86
+	.byte	$01
+	.byte	$0E
+	.byte	$E9
+	.byte	$03
+	.byte	$07
+	.byte	$4C
+	.byte	$00
+	.byte	$04
+	.byte	$3F
+	.byte	$00
+	.byte	$00
+	.byte	$D6
+	.byte	$00
+	.byte	$22
+	.byte	$69
+	.byte	$6E
+	.byte	$08
+	.byte	$0E
+	.byte	$04
+	.byte	$E5
+	.byte	$01
+	.byte	$0F
+	.byte	$45
+	.byte	$01
+	.byte	$0C
+	.byte	$2F
+	.byte	$2E
+	.byte	$0A
+	.byte	$41
+	.byte	$01
+	.byte	$0E
+	.byte	$17
+	.byte	$64
+	.byte	$78
+	.byte	$00
+	.byte	$02
+	.byte	$46
+	.byte	$01
+	.byte	$0E
+	.byte	$68
+	.byte	$00
+	.byte	$0E
+	.byte	$4B
+	.byte	$01
+	.byte	$0F
+	.byte	$99
+	.byte	$04
+	.byte	$00
+	.byte	$0A
+	.byte	$51
+	.byte	$01
+	.byte	$1F
+	.byte	$49
+	.byte	$B0
+	.byte	$00
+	.byte	$01
+	.byte	$04
+	.byte	$D8
+	.byte	$02
+	.byte	$D1
+	.byte	$6C
+	.byte	$61
+	.byte	$72
+	.byte	$67
+	.byte	$65
+	.byte	$20
+	.byte	$65
+	.byte	$6E
+	.byte	$6F
+	.byte	$75
+	.byte	$67
+	.byte	$68
+	.byte	$2C
+	.byte	$82
+	.byte	$00
+	.byte	$10
+	.byte	$64
+	.byte	$D5
+	.byte	$06
+	.byte	$41
+	.byte	$77
+	.byte	$69
+	.byte	$6C
+	.byte	$6C
+	.byte	$56
+	.byte	$03
+	.byte	$01
+	.byte	$46
+	.byte	$03
+	.byte	$11
+	.byte	$6F
+	.byte	$AC
+	.byte	$01
+	.byte	$92
+	.byte	$20
+	.byte	$61
+	.byte	$6E
+	.byte	$20
+	.byte	$65
+	.byte	$72
+	.byte	$72
+	.byte	$6F
+	.byte	$72
+	.byte	$04
+	.byte	$10
+	.byte	$5D
+	.byte	$28
+	.byte	$3C
+	.byte	$30
+	.byte	$29
+	.byte	$2E
+	.byte	$6A
+	.byte	$00
+	.byte	$01
+	.byte	$26
+	.byte	$01
+	.byte	$02
+	.byte	$9E
+	.byte	$0B
+	.byte	$60
+	.byte	$73
+	.byte	$74
+	.byte	$72
+	.byte	$65
+	.byte	$61
+	.byte	$6D
+	.byte	$69
+	.byte	$00
+	.byte	$50
+	.byte	$64
+	.byte	$65
+	.byte	$74
+	.byte	$65
+	.byte	$63
+	.byte	$C3
+	.byte	$02
+	.byte	$30
+	.byte	$6D
+	.byte	$61
+	.byte	$6C
+	.byte	$94
+	.byte	$07
+	.byte	$00
+	.byte	$E4
+	.byte	$06
+	.byte	$09
+	.byte	$9A
+	.byte	$03
+	.byte	$06
+	.byte	$6F
+	.byte	$00
+	.byte	$05
+	.byte	$82
+	.byte	$00
+	.byte	$00
+	.byte	$78
+	.byte	$00
+	.byte	$03
+	.byte	$2E
+	.byte	$01
+	.byte	$A3
+	.byte	$61
+	.byte	$20
+	.byte	$6E
+	.byte	$65
+	.byte	$67
+	.byte	$61
+	.byte	$74
+	.byte	$69
+	.byte	$76
+	.byte	$65
+	.byte	$C3
+	.byte	$03
+	.byte	$0B
+	.byte	$77
+	.byte	$00
+	.byte	$0A
+	.byte	$91
+	.byte	$03
+	.byte	$11
+	.byte	$69
+	.byte	$84
+	.byte	$0F
+	.byte	$03
+	.byte	$71
+	.byte	$00
+	.byte	$30
+	.byte	$61
+	.byte	$67
+	.byte	$61
+	.byte	$6C
+	.byte	$0A
+	.byte	$05
+	.byte	$33
+	.byte	$05
+	.byte	$F0
+	.byte	$01
+	.byte	$76
+	.byte	$65
+	.byte	$72
+	.byte	$66
+	.byte	$6C
+	.byte	$6F
+	.byte	$77
+	.byte	$20
+	.byte	$65
+	.byte	$78
+	.byte	$70
+	.byte	$6C
+	.byte	$6F
+	.byte	$69
+	.byte	$74
+	.byte	$73
+	.byte	$DD
+	.byte	$05
+	.byte	$31
+	.byte	$63
+	.byte	$6C
+	.byte	$75
+	.byte	$72
+	.byte	$00
+	.byte	$92
+	.byte	$6D
+	.byte	$61
+	.byte	$6C
+	.byte	$69
+	.byte	$63
+	.byte	$69
+	.byte	$6F
+	.byte	$75
+	.byte	$73
+	.byte	$12
+	.byte	$0B
+	.byte	$7C
+	.byte	$70
+	.byte	$61
+	.byte	$63
+	.byte	$6B
+	.byte	$65
+	.byte	$74
+	.byte	$73
+	.byte	$E3
+	.byte	$00
+	.byte	$1F
+	.byte	$74
+	.byte	$F2
+	.byte	$03
+	.byte	$03
+	.byte	$03
+	.byte	$23
+	.byte	$01
+	.byte	$0C
+	.byte	$F2
+	.byte	$03
+	.byte	$06
+	.byte	$21
+	.byte	$00
+	.byte	$26
+	.byte	$69
+	.byte	$6E
+	.byte	$20
+	.byte	$00
+	.byte	$02
+	.byte	$F8
+	.byte	$0A
+	.byte	$0F
+	.byte	$65
+	.byte	$07
+	.byte	$19
+	.byte	$50
+	.byte	$41
+	.byte	$64
+	.byte	$76
+	.byte	$61
+	.byte	$6E
+	.byte	$3B
+	.byte	$08
+	.byte	$0E
+	.byte	$67
+	.byte	$07
+	.byte	$0F
+	.byte	$04
+	.byte	$0B
+	.byte	$19
+	.byte	$06
+	.byte	$36
+	.byte	$04
+	.byte	$44
+	.byte	$53
+	.byte	$49
+	.byte	$5A
+	.byte	$45
+	.byte	$D4
+	.byte	$00
+	.byte	$51
+	.byte	$30
+	.byte	$78
+	.byte	$37
+	.byte	$45
+	.byte	$30
+	.byte	$01
+	.byte	$00
+	.byte	$02
+	.byte	$73
+	.byte	$0A
+	.byte	$D3
+	.byte	$32
+	.byte	$20
+	.byte	$31
+	.byte	$31
+	.byte	$33
+	.byte	$20
+	.byte	$39
+	.byte	$32
+	.byte	$39
+	.byte	$20
+	.byte	$32
+	.byte	$31
+	.byte	$36
+	.byte	$9C
+	.byte	$02
+	.byte	$0B
+	.byte	$AF
+	.byte	$0A
+	.byte	$31
+	.byte	$43
+	.byte	$4F
+	.byte	$4D
+	.byte	$69
+	.byte	$10
+	.byte	$70
+	.byte	$42
+	.byte	$4F
+	.byte	$55
+	.byte	$4E
+	.byte	$44
+	.byte	$28
+	.byte	$69
+	.byte	$18
+	.byte	$03
+	.byte	$E4
+	.byte	$29
+	.byte	$20
+	.byte	$20
+	.byte	$28
+	.byte	$28
+	.byte	$75
+	.byte	$6E
+	.byte	$73
+	.byte	$69
+	.byte	$67
+	.byte	$6E
+	.byte	$65
+	.byte	$64
+	.byte	$29
+	.byte	$14
+	.byte	$00
+	.byte	$26
+	.byte	$3E
+	.byte	$20
+	.byte	$14
+	.byte	$00
+	.byte	$0F
+	.byte	$82
+	.byte	$00
+	.byte	$00
+	.byte	$64
+	.byte	$3F
+	.byte	$20
+	.byte	$30
+	.byte	$20
+	.byte	$3A
+	.byte	$20
+	.byte	$2D
+	.byte	$00
+	.byte	$33
+	.byte	$2B
+	.byte	$20
+	.byte	$28
+	.byte	$0B
+	.byte	$00
+	.byte	$40
+	.byte	$2F
+	.byte	$32
+	.byte	$35
+	.byte	$35
+	.byte	$10
+	.byte	$00
+	.byte	$3D
+	.byte	$31
+	.byte	$36
+	.byte	$29
+	.byte	$65
+	.byte	$07
+	.byte	$02
+	.byte	$98
+	.byte	$06
+	.byte	$04
+	.byte	$F7
+	.byte	$03
+	.byte	$14
+	.byte	$50
+	.byte	$46
+	.byte	$0D
+	.byte	$00
+	.byte	$51
+	.byte	$02
+	.byte	$72
+	.byte	$6D
+	.byte	$61
+	.byte	$78
+	.byte	$69
+	.byte	$6D
+	.byte	$75
+	.byte	$6D
+	.byte	$A8
+	.byte	$03
+	.byte	$01
+	.byte	$F8
+	.byte	$12
+	.byte	$00
+	.byte	$CC
+	.byte	$0C
+	.byte	$08
+	.byte	$49
+	.byte	$04
+	.byte	$34
+	.byte	$6D
+	.byte	$61
+	.byte	$79
+	.byte	$AC
+	.byte	$01
+	.byte	$10
+	.byte	$69
+	.byte	$5A
+	.byte	$02
+	.byte	$40
+	.byte	$22
+	.byte	$77
+	.byte	$6F
+	.byte	$72
+	.byte	$11
+	.byte	$08
+	.byte	$F2
+	.byte	$00
+	.byte	$61
+	.byte	$73
+	.byte	$65
+	.byte	$22
+	.byte	$20
+	.byte	$73
+	.byte	$63
+	.byte	$65
+	.byte	$6E
+	.byte	$61
+	.byte	$72
+	.byte	$69
+	.byte	$6F
+	.byte	$20
+	.byte	$28
+	.byte	$AE
+	.byte	$01
+	.byte	$01
+	.byte	$08
+	.byte	$02
+	.byte	$08
+	.byte	$A5
+	.byte	$06
+	.byte	$33
+	.byte	$69
+	.byte	$62
+	.byte	$6C
+	.byte	$5E
+	.byte	$03
+	.byte	$0F
+	.byte	$74
+	.byte	$02
+	.byte	$00
+	.byte	$22
+	.byte	$69
+	.byte	$6D
+	.byte	$95
+	.byte	$03
+	.byte	$61
+	.byte	$75
+	.byte	$73
+	.byte	$65
+	.byte	$66
+	.byte	$75
+	.byte	$6C
+	.byte	$99
+	.byte	$09
+	.byte	$03
+	.byte	$E9
+	.byte	$09
+	.byte	$03
+	.byte	$05
+	.byte	$04
+	.byte	$00
+	.byte	$2A
+	.byte	$00
+	.byte	$50
+	.byte	$70
+	.byte	$75
+	.byte	$72
+	.byte	$70
+	.byte	$6F
+	.byte	$0F
+	.byte	$08
+	.byte	$1F
+	.byte	$28
+	.byte	$94
+	.byte	$03
+	.byte	$00
+	.byte	$16
+	.byte	$73
+	.byte	$66
+	.byte	$07
+	.byte	$5F
+	.byte	$4D
+	.byte	$61
+	.byte	$63
+	.byte	$72
+	.byte	$6F
+	.byte	$6B
+	.byte	$01
+	.byte	$00
+	.byte	$10
+	.byte	$29
+	.byte	$6C
+	.byte	$00
+	.byte	$01
+	.byte	$80
+	.byte	$07
+	.byte	$05
+	.byte	$69
+	.byte	$12
+	.byte	$11
+	.byte	$66
+	.byte	$92
+	.byte	$03
+	.byte	$41
+	.byte	$6D
+	.byte	$70
+	.byte	$69
+	.byte	$6C
+	.byte	$4D
+	.byte	$00
+	.byte	$70
+	.byte	$2D
+	.byte	$74
+	.byte	$69
+	.byte	$6D
+	.byte	$65
+	.byte	$20
+	.byte	$65
+	.byte	$2E
+	.byte	$06
+	.byte	$02
+	.byte	$5D
+	.byte	$00
+	.byte	$6F
+	.byte	$28
+	.byte	$73
+	.byte	$74
+	.byte	$61
+	.byte	$63
+	.byte	$6B
+	.byte	$8C
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$39
+	.byte	$00
+	.byte	$03
+	.byte	$0B
+	.byte	$0B
+	.byte	$03
+	.byte	$76
+	.byte	$00
+	.byte	$36
+	.byte	$4E
+	.byte	$6F
+	.byte	$74
+	.byte	$38
+	.byte	$01
+	.byte	$0F
+	.byte	$D6
+	.byte	$08
+	.byte	$01
+	.byte	$05
+	.byte	$AE
+	.byte	$07
+	.byte	$02
+	.byte	$F9
+	.byte	$07
+	.byte	$51
+	.byte	$20
+	.byte	$77
+	.byte	$68
+	.byte	$65
+	.byte	$6E
+	.byte	$5E
+	.byte	$04
+	.byte	$08
+	.byte	$C3
+	.byte	$00
+	.byte	$00
+	.byte	$A3
+	.byte	$00
+	.byte	$0F
+	.byte	$4C
+	.byte	$08
+	.byte	$03
+	.byte	$2A
+	.byte	$72
+	.byte	$63
+	.byte	$A0
+	.byte	$04
+	.byte	$01
+	.byte	$67
+	.byte	$01
+	.byte	$04
+	.byte	$EE
+	.byte	$06
+	.byte	$1F
+	.byte	$6D
+	.byte	$EE
+	.byte	$06
+	.byte	$11
+	.byte	$00
+	.byte	$36
+	.byte	$02
+	.byte	$0E
+	.byte	$8F
+	.byte	$06
+	.byte	$04
+	.byte	$F8
+	.byte	$01
+	.byte	$03
+	.byte	$DA
+	.byte	$01
+	.byte	$02
+	.byte	$85
+	.byte	$00
+	.byte	$0F
+	.byte	$DF
+	.byte	$01
+	.byte	$06
+	.byte	$0F
+	.byte	$70
+	.byte	$06
+	.byte	$00
+	.byte	$10
+	.byte	$2C
+	.byte	$71
+	.byte	$06
+	.byte	$26
+	.byte	$69
+	.byte	$6E
+	.byte	$3D
+	.byte	$00
+	.byte	$53
+	.byte	$73
+	.byte	$20
+	.byte	$74
+	.byte	$6F
+	.byte	$6F
+	.byte	$1E
+	.byte	$05
+	.byte	$3F
+	.byte	$28
+	.byte	$20
+	.byte	$3E
+	.byte	$86
+	.byte	$00
+	.byte	$00
+	.byte	$10
+	.byte	$29
+	.byte	$C5
+	.byte	$03
+	.byte	$0C
+	.byte	$C3
+	.byte	$0A
+	.byte	$02
+	.byte	$E8
+	.byte	$00
+	.byte	$00
+	.byte	$16
+	.byte	$00
+	.byte	$05
+	.byte	$DB
+	.byte	$00
+	.byte	$0F
+	.byte	$27
+	.byte	$0A
+	.byte	$01
+	.byte	$00
+	.byte	$3E
+	.byte	$01
+	.byte	$05
+	.byte	$C2
+	.byte	$02
+	.byte	$10
+	.byte	$53
+	.byte	$6A
+	.byte	$0F
+	.byte	$2F
+	.byte	$61
+	.byte	$73
+	.byte	$73
+	.byte	$01
+	.byte	$04
+	.byte	$00
+	.byte	$F6
+	.byte	$0D
+	.byte	$11
+	.byte	$74
+	.byte	$B6
+	.byte	$01
+	.byte	$21
+	.byte	$77
+	.byte	$73
+	.byte	$BE
+	.byte	$09
+	.byte	$41
+	.byte	$65
+	.byte	$6C
+	.byte	$65
+	.byte	$63
+	.byte	$8C
+	.byte	$05
+	.byte	$81
+	.byte	$22
+	.byte	$61
+	.byte	$63
+	.byte	$63
+	.byte	$65
+	.byte	$6C
+	.byte	$65
+	.byte	$72
+	.byte	$CD
+	.byte	$01
+	.byte	$84
+	.byte	$22
+	.byte	$20
+	.byte	$66
+	.byte	$61
+	.byte	$63
+	.byte	$74
+	.byte	$6F
+	.byte	$72
+	.byte	$A3
+	.byte	$08
+	.byte	$12
+	.byte	$65
+	.byte	$BC
+	.byte	$00
+	.byte	$12
+	.byte	$72
+	.byte	$44
+	.byte	$11
+	.byte	$07
+	.byte	$29
+	.byte	$00
+	.byte	$02
+	.byte	$59
+	.byte	$01
+	.byte	$03
+	.byte	$80
+	.byte	$05
+	.byte	$02
+	.byte	$C5
+	.byte	$01
+	.byte	$01
+	.byte	$23
+	.byte	$00
+	.byte	$04
+	.byte	$24
+	.byte	$17
+	.byte	$04
+	.byte	$70
+	.byte	$00
+	.byte	$22
+	.byte	$73
+	.byte	$6F
+	.byte	$DF
+	.byte	$0F
+	.byte	$00
+	.byte	$56
+	.byte	$06
+	.byte	$19
+	.byte	$72
+	.byte	$30
+	.byte	$07
+	.byte	$01
+	.byte	$C4
+	.byte	$14
+	.byte	$02
+	.byte	$0A
+	.byte	$0A
+	.byte	$01
+	.byte	$F2
+	.byte	$09
+	.byte	$A0
+	.byte	$74
+	.byte	$72
+	.byte	$61
+	.byte	$64
+	.byte	$65
+	.byte	$2D
+	.byte	$6F
+	.byte	$66
+	.byte	$66
+	.byte	$2E
+	.byte	$1E
+	.byte	$05
+	.byte	$00
+	.byte	$CF
+	.byte	$0C
+	.byte	$31
+	.byte	$62
+	.byte	$65
+	.byte	$20
+	.byte	$2A
+	.byte	$04
+	.byte	$53
+	.byte	$74
+	.byte	$75
+	.byte	$6E
+	.byte	$65
+	.byte	$64
+	.byte	$B9
+	.byte	$16
+	.byte	$42
+	.byte	$65
+	.byte	$61
+	.byte	$63
+	.byte	$68
+	.byte	$7B
+	.byte	$0A
+	.byte	$20
+	.byte	$73
+	.byte	$73
+	.byte	$CA
+	.byte	$05
+	.byte	$02
+	.byte	$E0
+	.byte	$01
+	.byte	$02
+	.byte	$C5
+	.byte	$02
+	.byte	$00
+	.byte	$7E
+	.byte	$05
+	.byte	$10
+	.byte	$72
+	.byte	$82
+	.byte	$06
+	.byte	$71
+	.byte	$6C
+	.byte	$79
+	.byte	$20
+	.byte	$2B
+	.byte	$7E
+	.byte	$33
+	.byte	$25
+	.byte	$E8
+	.byte	$00
+	.byte	$00
+	.byte	$0B
+	.byte	$0D
+	.byte	$03
+	.byte	$A4
+	.byte	$09
+	.byte	$1F
+	.byte	$6E
+	.byte	$C2
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$37
+	.byte	$07
+	.byte	$35
+	.byte	$22
+	.byte	$31
+	.byte	$22
+	.byte	$9A
+	.byte	$07
+	.byte	$03
+	.byte	$45
+	.byte	$01
+	.byte	$7F
+	.byte	$72
+	.byte	$65
+	.byte	$67
+	.byte	$75
+	.byte	$6C
+	.byte	$61
+	.byte	$72
+	.byte	$4D
+	.byte	$01
+	.byte	$04
+	.byte	$01
+	.byte	$4F
+	.byte	$00
+	.byte	$10
+	.byte	$56
+	.byte	$3F
+	.byte	$00
+	.byte	$10
+	.byte	$73
+	.byte	$3C
+	.byte	$07
+	.byte	$12
+	.byte	$30
+	.byte	$79
+	.byte	$06
+	.byte	$11
+	.byte	$62
+	.byte	$4A
+	.byte	$12
+	.byte	$20
+	.byte	$6C
+	.byte	$61
+	.byte	$60
+	.byte	$05
+	.byte	$B0
+	.byte	$62
+	.byte	$79
+	.byte	$20
+	.byte	$41
+	.byte	$43
+	.byte	$43
+	.byte	$45
+	.byte	$4C
+	.byte	$45
+	.byte	$52
+	.byte	$41
+	.byte	$8A
+	.byte	$13
+	.byte	$C1
+	.byte	$5F
+	.byte	$44
+	.byte	$45
+	.byte	$46
+	.byte	$41
+	.byte	$55
+	.byte	$4C
+	.byte	$54
+	.byte	$20
+	.byte	$28
+	.byte	$73
+	.byte	$65
+	.byte	$C2
+	.byte	$10
+	.byte	$34
+	.byte	$2E
+	.byte	$63
+	.byte	$29
+	.byte	$EB
+	.byte	$07
+	.byte	$00
+	.byte	$81
+	.byte	$0D
+	.byte	$1F
+	.byte	$2E
+	.byte	$05
+	.byte	$02
+	.byte	$01
+	.byte	$01
+	.byte	$DF
+	.byte	$01
+	.byte	$1F
+	.byte	$20
+	.byte	$C6
+	.byte	$0C
+	.byte	$2D
+	.byte	$02
+	.byte	$11
+	.byte	$00
+	.byte	$08
+	.byte	$F9
+	.byte	$00
+	.byte	$00
+	.byte	$4A
+	.byte	$02
+	.byte	$0F
+	.byte	$4B
+	.byte	$02
+	.byte	$02
+	.byte	$9A
+	.byte	$5F
+	.byte	$65
+	.byte	$78
+	.byte	$74
+	.byte	$53
+	.byte	$74
+	.byte	$61
+	.byte	$74
+	.byte	$65
+	.byte	$54
+	.byte	$02
+	.byte	$0F
+	.byte	$52
+	.byte	$12
+	.byte	$01
+	.byte	$30
+	.byte	$2C
+	.byte	$20
+	.byte	$6A
+	.byte	$A2
+	.byte	$08
+	.byte	$22
+	.byte	$75
+	.byte	$73
+	.byte	$64
+	.byte	$07
+	.byte	$12
+	.byte	$20
+	.byte	$A6
+	.byte	$12
+	.byte	$38
+	.byte	$61
+	.byte	$6C
+	.byte	$6C
+	.byte	$68
+	.byte	$0C
+	.byte	$03
+	.byte	$2B
+	.byte	$04
+	.byte	$41
+	.byte	$73
+	.byte	$70
+	.byte	$61
+	.byte	$63
+	.byte	$89
+	.byte	$0E
+	.byte	$20
+	.byte	$73
+	.byte	$74
+	.byte	$8C
+	.byte	$0B
+	.byte	$0A
+	.byte	$71
+	.byte	$0B
+	.byte	$32
+	.byte	$61
+	.byte	$74
+	.byte	$65
+	.byte	$9E
+	.byte	$01
+	.byte	$22
+	.byte	$55
+	.byte	$73
+	.byte	$13
+	.byte	$06
+	.byte	$00
+	.byte	$38
+	.byte	$03
+	.byte	$24
+	.byte	$6F
+	.byte	$66
+	.byte	$87
+	.byte	$00
+	.byte	$F4
+	.byte	$01
+	.byte	$74
+	.byte	$6F
+	.byte	$20
+	.byte	$6B
+	.byte	$6E
+	.byte	$6F
+	.byte	$77
+	.byte	$20
+	.byte	$68
+	.byte	$6F
+	.byte	$77
+	.byte	$20
+	.byte	$6D
+	.byte	$75
+	.byte	$63
+	.byte	$68
+	.byte	$54
+	.byte	$00
+	.byte	$06
+	.byte	$20
+	.byte	$09
+	.byte	$03
+	.byte	$6D
+	.byte	$00
+	.byte	$02
+	.byte	$CD
+	.byte	$0B
+	.byte	$00
+	.byte	$EE
+	.byte	$07
+	.byte	$04
+	.byte	$13
+	.byte	$00
+	.byte	$92
+	.byte	$20
+	.byte	$69
+	.byte	$74
+	.byte	$20
+	.byte	$6F
+	.byte	$6E
+	.byte	$20
+	.byte	$38
+	.byte	$2D
+	.byte	$7A
+	.byte	$06
+	.byte	$10
+	.byte	$62
+	.byte	$53
+	.byte	$03
+	.byte	$20
+	.byte	$61
+	.byte	$72
+	.byte	$34
+	.byte	$11
+	.byte	$33
+	.byte	$28
+	.byte	$75
+	.byte	$73
+	.byte	$A9
+	.byte	$07
+	.byte	$30
+	.byte	$6C
+	.byte	$6F
+	.byte	$63
+	.byte	$65
+	.byte	$00
+	.byte	$40
+	.byte	$79
+	.byte	$70
+	.byte	$69
+	.byte	$63
+	.byte	$BC
+	.byte	$00
+	.byte	$15
+	.byte	$29
+	.byte	$F7
+	.byte	$02
+	.byte	$24
+	.byte	$6E
+	.byte	$2C
+	.byte	$19
+	.byte	$05
+	.byte	$00
+	.byte	$47
+	.byte	$00
+	.byte	$40
+	.byte	$61
+	.byte	$73
+	.byte	$20
+	.byte	$27
+	.byte	$9A
+	.byte	$10
+	.byte	$12
+	.byte	$2A
+	.byte	$B1
+	.byte	$00
+	.byte	$11
+	.byte	$27
+	.byte	$56
+	.byte	$0F
+	.byte	$0F
+	.byte	$16
+	.byte	$01
+	.byte	$00
+	.byte	$09
+	.byte	$C7
+	.byte	$01
+	.byte	$08
+	.byte	$C9
+	.byte	$00
+	.byte	$03
+	.byte	$D7
+	.byte	$10
+	.byte	$04
+	.byte	$4F
+	.byte	$0E
+	.byte	$0F
+	.byte	$76
+	.byte	$01
+	.byte	$03
+	.byte	$27
+	.byte	$20
+	.byte	$28
+	.byte	$64
+	.byte	$00
+	.byte	$2F
+	.byte	$2C
+	.byte	$20
+	.byte	$F8
+	.byte	$01
+	.byte	$11
+	.byte	$05
+	.byte	$1E
+	.byte	$04
+	.byte	$0F
+	.byte	$F7
+	.byte	$01
+	.byte	$25
+	.byte	$13
+	.byte	$64
+	.byte	$2F
+	.byte	$00
+	.byte	$05
+	.byte	$F2
+	.byte	$01
+	.byte	$10
+	.byte	$52
+	.byte	$96
+	.byte	$08
+	.byte	$12
+	.byte	$73
+	.byte	$03
+	.byte	$19
+	.byte	$60
+	.byte	$6C
+	.byte	$6F
+	.byte	$67
+	.byte	$69
+	.byte	$63
+	.byte	$2C
+	.byte	$CC
+	.byte	$02
+	.byte	$05
+	.byte	$ED
+	.byte	$00
+	.byte	$00
+	.byte	$EE
+	.byte	$01
+	.byte	$12
+	.byte	$73
+	.byte	$8A
+	.byte	$01
+	.byte	$01
+	.byte	$D6
+	.byte	$06
+	.byte	$52
+	.byte	$61
+	.byte	$73
+	.byte	$20
+	.byte	$70
+	.byte	$6F
+	.byte	$D1
+	.byte	$06
+	.byte	$02
+	.byte	$87
+	.byte	$0E
+	.byte	$0B
+	.byte	$93
+	.byte	$0C
+	.byte	$0F
+	.byte	$87
+	.byte	$0E
+	.byte	$09
+	.byte	$0A
+	.byte	$DC
+	.byte	$0B
+	.byte	$05
+	.byte	$87
+	.byte	$0E
+	.byte	$10
+	.byte	$74
+	.byte	$71
+	.byte	$04
+	.byte	$1B
+	.byte	$74
+	.byte	$8A
+	.byte	$0E
+	.byte	$0A
+	.byte	$2D
+	.byte	$0D
+	.byte	$21
+	.byte	$65
+	.byte	$69
+	.byte	$2E
+	.byte	$19
+	.byte	$16
+	.byte	$63
+	.byte	$16
+	.byte	$0F
+	.byte	$00
+	.byte	$AF
+	.byte	$00
+	.byte	$57
+	.byte	$65
+	.byte	$6E
+	.byte	$74
+	.byte	$69
+	.byte	$72
+	.byte	$15
+	.byte	$0D
+	.byte	$05
+	.byte	$7B
+	.byte	$0D
+	.byte	$00
+	.byte	$7F
+	.byte	$00
+	.byte	$03
+	.byte	$66
+	.byte	$00
+	.byte	$22
+	.byte	$69
+	.byte	$66
+	.byte	$61
+	.byte	$0E
+	.byte	$09
+	.byte	$B0
+	.byte	$0A
+	.byte	$13
+	.byte	$0A
+	.byte	$BF
+	.byte	$05
+	.byte	$10
+	.byte	$66
+	.byte	$C6
+	.byte	$03
+	.byte	$0A
+	.byte	$1D
+	.byte	$0F
+	.byte	$00
+	.byte	$63
+	.byte	$00
+	.byte	$20
+	.byte	$6C
+	.byte	$65
+	.byte	$0A
+	.byte	$0E
+	.byte	$02
+	.byte	$7F
+	.byte	$04
+	.byte	$0F
+	.byte	$FD
+	.byte	$00
+	.byte	$13
+	.byte	$06
+	.byte	$ED
+	.byte	$09
+	.byte	$16
+	.byte	$2A
+	.byte	$9A
+	.byte	$03
+	.byte	$55
+	.byte	$50
+	.byte	$74
+	.byte	$72
+	.byte	$20
+	.byte	$3A
+	.byte	$2A
+	.byte	$04
+	.byte	$02
+	.byte	$73
+	.byte	$1B
+	.byte	$02
+	.byte	$4A
+	.byte	$0F
+	.byte	$41
+	.byte	$69
+	.byte	$6E
+	.byte	$64
+	.byte	$69
+	.byte	$B2
+	.byte	$02
+	.byte	$01
+	.byte	$E6
+	.byte	$02
+	.byte	$34
+	.byte	$61
+	.byte	$6E
+	.byte	$79
+	.byte	$0A
+	.byte	$0D
+	.byte	$42
+	.byte	$68
+	.byte	$65
+	.byte	$72
+	.byte	$65
+	.byte	$F2
+	.byte	$0D
+	.byte	$0A
+	.byte	$5C
+	.byte	$01
+	.byte	$28
+	.byte	$74
+	.byte	$6F
+	.byte	$AC
+	.byte	$00
+	.byte	$0B
+	.byte	$5B
+	.byte	$0A
+	.byte	$08
+	.byte	$01
+	.byte	$00
+	.byte	$36
+	.byte	$4E
+	.byte	$65
+	.byte	$77
+	.byte	$02
+	.byte	$07
+	.byte	$0B
+	.byte	$F2
+	.byte	$0B
+	.byte	$23
+	.byte	$6F
+	.byte	$6C
+	.byte	$1E
+	.byte	$07
+	.byte	$1E
+	.byte	$2E
+	.byte	$09
+	.byte	$07
+	.byte	$2F
+	.byte	$4E
+	.byte	$62
+	.byte	$8D
+	.byte	$0D
+	.byte	$01
+	.byte	$0F
+	.byte	$86
+	.byte	$0D
+	.byte	$04
+	.byte	$0A
+	.byte	$B1
+	.byte	$01
+	.byte	$0F
+	.byte	$87
+	.byte	$0D
+	.byte	$17
+	.byte	$0E
+	.byte	$F3
+	.byte	$04
+	.byte	$06
+	.byte	$90
+	.byte	$02
+	.byte	$0F
+	.byte	$F7
+	.byte	$04
+	.byte	$12
+	.byte	$29
+	.byte	$2A
+	.byte	$20
+	.byte	$5E
+	.byte	$01
+	.byte	$02
+	.byte	$F3
+	.byte	$02
+	.byte	$0B
+	.byte	$8E
+	.byte	$00
+	.byte	$07
+	.byte	$F5
+	.byte	$02
+	.byte	$2F
+	.byte	$64
+	.byte	$65
+	.byte	$39
+	.byte	$07
+	.byte	$03
+	.byte	$8A
+	.byte	$6F
+	.byte	$72
+	.byte	$69
+	.byte	$67
+	.byte	$69
+	.byte	$6E
+	.byte	$61
+	.byte	$6C
+	.byte	$A4
+	.byte	$0D
+	.byte	$04
+	.byte	$16
+	.byte	$00
+	.byte	$04
+	.byte	$00
+	.byte	$10
+	.byte	$30
+	.byte	$72
+	.byte	$65
+	.byte	$66
+	.byte	$BE
+	.byte	$04
+	.byte	$27
+	.byte	$75
+	.byte	$6E
+	.byte	$5D
+	.byte	$0D
+	.byte	$00
+	.byte	$B1
+	.byte	$02
+	.byte	$0F
+	.byte	$90
+	.byte	$0D
+	.byte	$0F
+	.byte	$06
+	.byte	$C1
+	.byte	$01
+	.byte	$07
+	.byte	$D6
+	.byte	$0C
+	.byte	$04
+	.byte	$87
+	.byte	$0D
+	.byte	$23
+	.byte	$69
+	.byte	$6E
+	.byte	$FB
+	.byte	$1B
+	.byte	$6C
+	.byte	$77
+	.byte	$6F
+	.byte	$72
+	.byte	$64
+	.byte	$73
+	.byte	$2C
+	.byte	$52
+	.byte	$0E
+	.byte	$01
+	.byte	$CB
+	.byte	$09
+	.byte	$0F
+	.byte	$1E
+	.byte	$0D
+	.byte	$72
+	.byte	$1E
+	.byte	$44
+	.byte	$68
+	.byte	$0A
+	.byte	$0F
+	.byte	$A5
+	.byte	$0E
+	.byte	$07
+	.byte	$42
+	.byte	$20
+	.byte	$49
+	.byte	$74
+	.byte	$73
+	.byte	$CF
+	.byte	$03
+	.byte	$05
+	.byte	$24
+	.byte	$00
+	.byte	$42
+	.byte	$20
+	.byte	$6D
+	.byte	$69
+	.byte	$6E
+	.byte	$5D
+	.byte	$09
+	.byte	$38
+	.byte	$66
+	.byte	$20
+	.byte	$27
+	.byte	$73
+	.byte	$01
+	.byte	$03
+	.byte	$C6
+	.byte	$12
+	.byte	$02
+	.byte	$6F
+	.byte	$00
+	.byte	$10
+	.byte	$6E
+	.byte	$3A
+	.byte	$0A
+	.byte	$1B
+	.byte	$3A
+	.byte	$EF
+	.byte	$03
+	.byte	$00
+	.byte	$73
+	.byte	$0F
+	.byte	$23
+	.byte	$79
+	.byte	$20
+	.byte	$5A
+	.byte	$18
+	.byte	$04
+	.byte	$02
+	.byte	$06
+	.byte	$07
+	.byte	$D0
+	.byte	$05
+	.byte	$00
+	.byte	$81
+	.byte	$0A
+	.byte	$20
+	.byte	$70
+	.byte	$72
+	.byte	$94
+	.byte	$18
+	.byte	$12
+	.byte	$6C
+	.byte	$D0
+	.byte	$1D
+	.byte	$2C
+	.byte	$65
+	.byte	$64
+	.byte	$99
+	.byte	$18
+	.byte	$2A
+	.byte	$2E
+	.byte	$0A
+	.byte	$7D
+	.byte	$0D
+	.byte	$00
+	.byte	$FE
+	.byte	$0A
+	.byte	$46
+	.byte	$20
+	.byte	$62
+	.byte	$69
+	.byte	$74
+	.byte	$BC
+	.byte	$08
+	.byte	$3F
+	.byte	$61
+	.byte	$6E
+	.byte	$20
+	.byte	$17
+	.byte	$10
+	.byte	$02
+	.byte	$09
+	.byte	$3A
+	.byte	$00
+	.byte	$30
+	.byte	$48
+	.byte	$6F
+	.byte	$77
+	.byte	$20
+	.byte	$05
+	.byte	$10
+	.byte	$2C
+	.byte	$15
+	.byte	$06
+	.byte	$32
+	.byte	$64
+	.byte	$6F
+	.byte	$65
+	.byte	$FC
+	.byte	$0E
+	.byte	$04
+	.byte	$29
+	.byte	$06
+	.byte	$00
+	.byte	$B9
+	.byte	$03
+	.byte	$03
+	.byte	$33
+	.byte	$0E
+	.byte	$01
+	.byte	$D9
+	.byte	$1D
+	.byte	$03
+	.byte	$34
+	.byte	$0E
+	.byte	$11
+	.byte	$69
+	.byte	$86
+	.byte	$04
+	.byte	$22
+	.byte	$69
+	.byte	$6F
+	.byte	$1E
+	.byte	$07
+	.byte	$05
+	.byte	$F8
+	.byte	$03
+	.byte	$01
+	.byte	$42
+	.byte	$04
+	.byte	$03
+	.byte	$BE
+	.byte	$01
+	.byte	$16
+	.byte	$28
+	.byte	$34
+	.byte	$0E
+	.byte	$01
+	.byte	$D2
+	.byte	$05
+	.byte	$0A
+	.byte	$75
+	.byte	$00
+	.byte	$00
+	.byte	$1A
+	.byte	$07
+	.byte	$1A
+	.byte	$74
+	.byte	$28
+	.byte	$0C
+	.byte	$60
+	.byte	$6E
+	.byte	$20
+	.byte	$74
+	.byte	$72
+	.byte	$75
+	.byte	$73
+	.byte	$ED
+	.byte	$01
+	.byte	$71
+	.byte	$65
+	.byte	$6E
+	.byte	$76
+	.byte	$69
+	.byte	$72
+	.byte	$6F
+	.byte	$6E
+	.byte	$BE
+	.byte	$17
+	.byte	$61
+	.byte	$6F
+	.byte	$6E
+	.byte	$6C
+	.byte	$79
+	.byte	$20
+	.byte	$28
+	.byte	$59
+	.byte	$00
+	.byte	$22
+	.byte	$74
+	.byte	$6F
+	.byte	$E5
+	.byte	$01
+	.byte	$01
+	.byte	$4D
+	.byte	$02
+	.byte	$04
+	.byte	$23
+	.byte	$14
+	.byte	$15
+	.byte	$61
+	.byte	$36
+	.byte	$00
+	.byte	$02
+	.byte	$3D
+	.byte	$02
+	.byte	$19
+	.byte	$29
+	.byte	$B0
+	.byte	$06
+	.byte	$2F
+	.byte	$64
+	.byte	$65
+	.byte	$79
+	.byte	$08
+	.byte	$20
+	.byte	$08
+	.byte	$C9
+	.byte	$01
+	.byte	$2F
+	.byte	$29
+	.byte	$3B
+	.byte	$6B
+	.byte	$03
+	.byte	$01
+	.byte	$00
+	.byte	$46
+	.byte	$01
+	.byte	$13
+	.byte	$5F
+	.byte	$39
+	.byte	$12
+	.byte	$05
+	.byte	$73
+	.byte	$03
+	.byte	$0A
+	.byte	$CF
+	.byte	$05
+	.byte	$06
+	.byte	$2E
+	.byte	$00
+	.byte	$2D
+	.byte	$20
+	.byte	$61
+	.byte	$4F
+	.byte	$11
+	.byte	$06
+	.byte	$19
+	.byte	$06
+	.byte	$0A
+	.byte	$9E
+	.byte	$10
+	.byte	$10
+	.byte	$27
+	.byte	$CC
+	.byte	$1B
+	.byte	$01
+	.byte	$B8
+	.byte	$1B
+	.byte	$00
+	.byte	$43
+	.byte	$00
+	.byte	$0E
+	.byte	$F7
+	.byte	$14
+	.byte	$0E
+	.byte	$F4
+	.byte	$10
+	.byte	$0D
+	.byte	$6A
+	.byte	$06
+	.byte	$0F
+	.byte	$F4
+	.byte	$10
+	.byte	$00
+	.byte	$05
+	.byte	$6F
+	.byte	$06
+	.byte	$07
+	.byte	$38
+	.byte	$03
+	.byte	$11
+	.byte	$74
+	.byte	$65
+	.byte	$02
+	.byte	$26
+	.byte	$74
+	.byte	$6F
+	.byte	$3C
+	.byte	$03
+	.byte	$06
+	.byte	$0D
+	.byte	$07
+	.byte	$24
+	.byte	$6F
+	.byte	$70
+	.byte	$4E
+	.byte	$0A
+	.byte	$52
+	.byte	$61
+	.byte	$73
+	.byte	$20
+	.byte	$73
+	.byte	$6F
+	.byte	$08
+	.byte	$00
+	.byte	$03
+	.byte	$C3
+	.byte	$06
+	.byte	$06
+	.byte	$9B
+	.byte	$12
+	.byte	$90
+	.byte	$27
+	.byte	$20
+	.byte	$68
+	.byte	$61
+	.byte	$73
+	.byte	$20
+	.byte	$62
+	.byte	$65
+	.byte	$65
+	.byte	$3D
+	.byte	$14
+	.byte	$00
+	.byte	$3B
+	.byte	$17
+	.byte	$03
+	.byte	$AF
+	.byte	$08
+	.byte	$10
+	.byte	$72
+	.byte	$C9
+	.byte	$17
+	.byte	$01
+	.byte	$28
+	.byte	$20
+	.byte	$18
+	.byte	$65
+	.byte	$1F
+	.byte	$05
+	.byte	$00
+	.byte	$7A
+	.byte	$0D
+	.byte	$0F
+	.byte	$E8
+	.byte	$11
+	.byte	$14
+	.byte	$00
+	.byte	$B9
+	.byte	$0D
+	.byte	$04
+	.byte	$57
+	.byte	$20
+	.byte	$0F
+	.byte	$E5
+	.byte	$11
+	.byte	$2B
+	.byte	$12
+	.byte	$4E
+	.byte	$7A
+	.byte	$03
+	.byte	$01
+	.byte	$69
+	.byte	$02
+	.byte	$03
+	.byte	$6A
+	.byte	$00
+	.byte	$03
+	.byte	$84
+	.byte	$0B
+	.byte	$1F
+	.byte	$3C
+	.byte	$D1
+	.byte	$00
+	.byte	$01
+	.byte	$6F
+	.byte	$73
+	.byte	$68
+	.byte	$6F
+	.byte	$75
+	.byte	$6C
+	.byte	$64
+	.byte	$01
+	.byte	$13
+	.byte	$02
+	.byte	$07
+	.byte	$7D
+	.byte	$02
+	.byte	$40
+	.byte	$62
+	.byte	$65
+	.byte	$20
+	.byte	$73
+	.byte	$67
+	.byte	$09
+	.byte	$2B
+	.byte	$65
+	.byte	$72
+	.byte	$4E
+	.byte	$04
+	.byte	$65
+	.byte	$41
+	.byte	$6C
+	.byte	$77
+	.byte	$61
+	.byte	$79
+	.byte	$73
+	.byte	$80
+	.byte	$1C
+	.byte	$0C
+	.byte	$F9
+	.byte	$06
+	.byte	$00
+	.byte	$F8
+	.byte	$06
+	.byte	$03
+	.byte	$DF
+	.byte	$00
+	.byte	$0F
+	.byte	$1C
+	.byte	$12
+	.byte	$81
+	.byte	$0F
+	.byte	$BB
+	.byte	$11
+	.byte	$03
+	.byte	$1C
+	.byte	$66
+	.byte	$BE
+	.byte	$11
+	.byte	$00
+	.byte	$60
+	.byte	$00
+	.byte	$02
+	.byte	$2B
+	.byte	$00
+	.byte	$0A
+	.byte	$C4
+	.byte	$11
+	.byte	$2A
+	.byte	$6F
+	.byte	$66
+	.byte	$C7
+	.byte	$11
+	.byte	$03
+	.byte	$91
+	.byte	$04
+	.byte	$06
+	.byte	$65
+	.byte	$06
+	.byte	$0E
+	.byte	$79
+	.byte	$12
+	.byte	$0F
+	.byte	$55
+	.byte	$12
+	.byte	$03
+	.byte	$0E
+	.byte	$BF
+	.byte	$03
+	.byte	$0D
+	.byte	$73
+	.byte	$03
+	.byte	$0F
+	.byte	$AB
+	.byte	$18
+	.byte	$27
+	.byte	$0C
+	.byte	$F4
+	.byte	$01
+	.byte	$0F
+	.byte	$C1
+	.byte	$18
+	.byte	$0A
+	.byte	$0E
+	.byte	$85
+	.byte	$12
+	.byte	$0F
+	.byte	$F3
+	.byte	$19
+	.byte	$11
+	.byte	$01
+	.byte	$BE
+	.byte	$01
+	.byte	$00
+	.byte	$8A
+	.byte	$01
+	.byte	$08
+	.byte	$69
+	.byte	$18
+	.byte	$0F
+	.byte	$9B
+	.byte	$12
+	.byte	$00
+	.byte	$0F
+	.byte	$A4
+	.byte	$12
+	.byte	$21
+	.byte	$60
+	.byte	$53
+	.byte	$54
+	.byte	$52
+	.byte	$45
+	.byte	$41
+	.byte	$4D
+	.byte	$62
+	.byte	$0F
+	.byte	$DC
+	.byte	$5F
+	.byte	$55
+	.byte	$36
+	.byte	$34
+	.byte	$20
+	.byte	$28
+	.byte	$28
+	.byte	$31
+	.byte	$20
+	.byte	$3C
+	.byte	$3C
+	.byte	$20
+	.byte	$28
+	.byte	$A8
+	.byte	$1A
+	.byte	$30
+	.byte	$2D
+	.byte	$33
+	.byte	$29
+	.byte	$21
+	.byte	$12
+	.byte	$2F
+	.byte	$34
+	.byte	$29
+	.byte	$3D
+	.byte	$00
+	.byte	$04
+	.byte	$01
+	.byte	$FE
+	.byte	$01
+	.byte	$1F
+	.byte	$28
+	.byte	$51
+	.byte	$00
+	.byte	$00
+	.byte	$22
+	.byte	$2A
+	.byte	$20
+	.byte	$E1
+	.byte	$0B
+	.byte	$60
+	.byte	$28
+	.byte	$6C
+	.byte	$6F
+	.byte	$6E
+	.byte	$67
+	.byte	$20
+	.byte	$05
+	.byte	$00
+	.byte	$27
+	.byte	$29
+	.byte	$29
+	.byte	$53
+	.byte	$1C
+	.byte	$02
+	.byte	$9A
+	.byte	$02
+	.byte	$11
+	.byte	$5F
+	.byte	$71
+	.byte	$1B
+	.byte	$20
+	.byte	$69
+	.byte	$6E
+	.byte	$92
+	.byte	$02
+	.byte	$02
+	.byte	$9A
+	.byte	$03
+	.byte	$81
+	.byte	$73
+	.byte	$74
+	.byte	$72
+	.byte	$75
+	.byte	$63
+	.byte	$74
+	.byte	$75
+	.byte	$72
+	.byte	$11
+	.byte	$0D
+	.byte	$20
+	.byte	$74
+	.byte	$72
+	.byte	$52
+	.byte	$11
+	.byte	$02
+	.byte	$7A
+	.byte	$06
+	.byte	$03
+	.byte	$CC
+	.byte	$02
+	.byte	$01
+	.byte	$7D
+	.byte	$1F
+	.byte	$20
+	.byte	$69
+	.byte	$6D
+	.byte	$BE
+	.byte	$10
+	.byte	$30
+	.byte	$61
+	.byte	$6E
+	.byte	$74
+	.byte	$8F
+	.byte	$08
+	.byte	$32
+	.byte	$6E
+	.byte	$69
+	.byte	$74
+	.byte	$96
+	.byte	$03
+	.byte	$06
+	.byte	$3B
+	.byte	$00
+	.byte	$04
+	.byte	$DA
+	.byte	$0A
+	.byte	$12
+	.byte	$62
+	.byte	$2F
+	.byte	$02
+	.byte	$31
+	.byte	$66
+	.byte	$69
+	.byte	$72
+	.byte	$8C
+	.byte	$0D
+	.byte	$30
+	.byte	$65
+	.byte	$20
+	.byte	$21
+	.byte	$3E
+	.byte	$00
+	.byte	$03
+	.byte	$44
+	.byte	$07
+	.byte	$29
+	.byte	$6F
+	.byte	$6E
+	.byte	$8D
+	.byte	$0D
+	.byte	$82
+	.byte	$64
+	.byte	$69
+	.byte	$72
+	.byte	$65
+	.byte	$63
+	.byte	$74
+	.byte	$6C
+	.byte	$79
+	.byte	$3F
+	.byte	$03
+	.byte	$05
+	.byte	$4B
+	.byte	$00
+	.byte	$12
+	.byte	$69
+	.byte	$E8
+	.byte	$1F
+	.byte	$00
+	.byte	$F4
+	.byte	$25
+	.byte	$00
+	.byte	$78
+	.byte	$0C
+	.byte	$02
+	.byte	$08
+	.byte	$0D
+	.byte	$53
+	.byte	$20
+	.byte	$6C
+	.byte	$69
+	.byte	$6E
+	.byte	$6B
+	.byte	$C3
+	.byte	$1F
+	.byte	$00
+	.byte	$52
+	.byte	$00
+	.byte	$06
+	.byte	$7C
+	.byte	$03
+	.byte	$04
+	.byte	$2C
+	.byte	$00
+	.byte	$02
+	.byte	$42
+	.byte	$0D
+	.byte	$60
+	.byte	$6C
+	.byte	$69
+	.byte	$62
+	.byte	$6C
+	.byte	$7A
+	.byte	$34
+	.byte	$F3
+	.byte	$04
+	.byte	$59
+	.byte	$61
+	.byte	$20
+	.byte	$44
+	.byte	$4C
+	.byte	$4C
+	.byte	$A7
+	.byte	$1F
+	.byte	$20
+	.byte	$62
+	.byte	$65
+	.byte	$21
+	.byte	$15
+	.byte	$01
+	.byte	$7D
+	.byte	$02
+	.byte	$00
+	.byte	$6C
+	.byte	$00
+	.byte	$01
+	.byte	$35
+	.byte	$13
+	.byte	$66
+	.byte	$65
+	.byte	$74
+	.byte	$68
+	.byte	$6F
+	.byte	$64
+	.byte	$73
+	.byte	$B7
+	.byte	$1F
+	.byte	$00
+	.byte	$0F
+	.byte	$14
+	.byte	$73
+	.byte	$74
+	.byte	$79
+	.byte	$70
+	.byte	$65
+	.byte	$64
+	.byte	$65
+	.byte	$66
+	.byte	$93
+	.byte	$00
+	.byte	$35
+	.byte	$20
+	.byte	$7B
+	.byte	$20
+	.byte	$50
+	.byte	$01
+	.byte	$20
+	.byte	$20
+	.byte	$74
+	.byte	$63
+	.byte	$20
+	.byte	$1E
+	.byte	$5B
+	.byte	$7C
+	.byte	$01
+	.byte	$49
+	.byte	$5D
+	.byte	$3B
+	.byte	$20
+	.byte	$7D
+	.byte	$65
+	.byte	$01
+	.byte	$27
+	.byte	$3B
+	.byte	$0A
+	.byte	$7A
+	.byte	$01
+	.byte	$52
+	.byte	$72
+	.byte	$65
+	.byte	$73
+	.byte	$65
+	.byte	$74
+	.byte	$5B
+	.byte	$02
+	.byte	$00
+	.byte	$13
+	.byte	$00
+	.byte	$0E
+	.byte	$3E
+	.byte	$07
+	.byte	$22
+	.byte	$74
+	.byte	$6F
+	.byte	$55
+	.byte	$01
+	.byte	$27
+	.byte	$61
+	.byte	$6E
+	.byte	$1F
+	.byte	$01
+	.byte	$08
+	.byte	$4F
+	.byte	$00
+	.byte	$06
+	.byte	$1F
+	.byte	$01
+	.byte	$01
+	.byte	$A2
+	.byte	$00
+	.byte	$00
+	.byte	$96
+	.byte	$0D
+	.byte	$0C
+	.byte	$5A
+	.byte	$00
+	.byte	$28
+	.byte	$20
+	.byte	$28
+	.byte	$31
+	.byte	$00
+	.byte	$13
+	.byte	$2A
+	.byte	$BD
+	.byte	$01
+	.byte	$49
+	.byte	$50
+	.byte	$74
+	.byte	$72
+	.byte	$29
+	.byte	$8C
+	.byte	$00
+	.byte	$00
+	.byte	$DE
+	.byte	$1D
+	.byte	$23
+	.byte	$74
+	.byte	$65
+	.byte	$33
+	.byte	$00
+	.byte	$01
+	.byte	$82
+	.byte	$04
+	.byte	$05
+	.byte	$9E
+	.byte	$0E
+	.byte	$00
+	.byte	$1D
+	.byte	$04
+	.byte	$00
+	.byte	$87
+	.byte	$00
+	.byte	$30
+	.byte	$69
+	.byte	$61
+	.byte	$6C
+	.byte	$8D
+	.byte	$06
+	.byte	$2F
+	.byte	$61
+	.byte	$6E
+	.byte	$83
+	.byte	$00
+	.byte	$07
+	.byte	$01
+	.byte	$1A
+	.byte	$00
+	.byte	$34
+	.byte	$66
+	.byte	$72
+	.byte	$65
+	.byte	$49
+	.byte	$00
+	.byte	$21
+	.byte	$72
+	.byte	$65
+	.byte	$67
+	.byte	$01
+	.byte	$11
+	.byte	$73
+	.byte	$26
+	.byte	$21
+	.byte	$02
+	.byte	$0F
+	.byte	$09
+	.byte	$02
+	.byte	$B4
+	.byte	$21
+	.byte	$02
+	.byte	$09
+	.byte	$06
+	.byte	$01
+	.byte	$1E
+	.byte	$02
+	.byte	$11
+	.byte	$78
+	.byte	$9D
+	.byte	$26
+	.byte	$01
+	.byte	$97
+	.byte	$01
+	.byte	$22
+	.byte	$20
+	.byte	$28
+	.byte	$A8
+	.byte	$01
+	.byte	$19
+	.byte	$29
+	.byte	$A0
+	.byte	$01
+	.byte	$55
+	.byte	$74
+	.byte	$68
+	.byte	$65
+	.byte	$73
+	.byte	$65
+	.byte	$93
+	.byte	$01
+	.byte	$44
+	.byte	$72
+	.byte	$61
+	.byte	$74
+	.byte	$68
+	.byte	$07
+	.byte	$09
+	.byte	$24
+	.byte	$74
+	.byte	$68
+	.byte	$0C
+	.byte	$02
+	.byte	$03
+	.byte	$86
+	.byte	$00
+	.byte	$01
+	.byte	$5D
+	.byte	$00
+	.byte	$41
+	.byte	$54
+	.byte	$68
+	.byte	$65
+	.byte	$79
+	.byte	$FB
+	.byte	$01
+	.byte	$01
+	.byte	$51
+	.byte	$1B
+	.byte	$42
+	.byte	$66
+	.byte	$75
+	.byte	$74
+	.byte	$75
+	.byte	$A9
+	.byte	$04
+	.byte	$20
+	.byte	$6F
+	.byte	$66
+	.byte	$19
+	.byte	$04
+	.byte	$01
+	.byte	$1B
+	.byte	$13
+	.byte	$02
+	.byte	$72
+	.byte	$00
+	.byte	$02
+	.byte	$F1
+	.byte	$20
+	.byte	$00
+	.byte	$0C
+	.byte	$00
+	.byte	$0A
+	.byte	$D1
+	.byte	$00
+	.byte	$32
+	.byte	$69
+	.byte	$7A
+	.byte	$65
+	.byte	$F2
+	.byte	$01
+	.byte	$0A
+	.byte	$3A
+	.byte	$01
+	.byte	$0C
+	.byte	$27
+	.byte	$01
+	.byte	$08
+	.byte	$2C
+	.byte	$0F
+	.byte	$06
+	.byte	$01
+	.byte	$00
+	.byte	$0B
+	.byte	$02
+	.byte	$01
+	.byte	$0F
+	.byte	$7E
+	.byte	$01
+	.byte	$13
+	.byte	$8F
+	.byte	$6C
+	.byte	$6F
+	.byte	$61
+	.byte	$64
+	.byte	$44
+	.byte	$69
+	.byte	$63
+	.byte	$74
+	.byte	$07
+	.byte	$02
+	.byte	$06
+	.byte	$00
+	.byte	$21
+	.byte	$00
+	.byte	$24
+	.byte	$20
+	.byte	$61
+	.byte	$ED
+	.byte	$00
+	.byte	$21
+	.byte	$64
+	.byte	$69
+	.byte	$19
+	.byte	$00
+	.byte	$00
+	.byte	$86
+	.byte	$22
+	.byte	$01
+	.byte	$42
+	.byte	$08
+	.byte	$06
+	.byte	$64
+	.byte	$00
+	.byte	$01
+	.byte	$95
+	.byte	$03
+	.byte	$11
+	.byte	$41
+	.byte	$DF
+	.byte	$09
+	.byte	$26
+	.byte	$65
+	.byte	$76
+	.byte	$86
+	.byte	$05
+	.byte	$04
+	.byte	$CC
+	.byte	$0D
+	.byte	$50
+	.byte	$66
+	.byte	$6F
+	.byte	$72
+	.byte	$67
+	.byte	$6F
+	.byte	$27
+	.byte	$0D
+	.byte	$12
+	.byte	$2C
+	.byte	$75
+	.byte	$03
+	.byte	$16
+	.byte	$27
+	.byte	$4A
+	.byte	$00
+	.byte	$12
+	.byte	$27
+	.byte	$25
+	.byte	$00
+	.byte	$30
+	.byte	$72
+	.byte	$65
+	.byte	$6D
+	.byte	$E4
+	.byte	$28
+	.byte	$28
+	.byte	$69
+	.byte	$6E
+	.byte	$AF
+	.byte	$01
+	.byte	$32
+	.byte	$4C
+	.byte	$6F
+	.byte	$61
+	.byte	$87
+	.byte	$06
+	.byte	$05
+	.byte	$10
+	.byte	$1A
+	.byte	$12
+	.byte	$30
+	.byte	$96
+	.byte	$15
+	.byte	$31
+	.byte	$6C
+	.byte	$6F
+	.byte	$77
+	.byte	$F8
+	.byte	$06
+	.byte	$00
+	.byte	$EA
+	.byte	$1F
+	.byte	$03
+	.byte	$00
+	.byte	$08
+	.byte	$07
+	.byte	$9C
+	.byte	$00
+	.byte	$13
+	.byte	$73
+	.byte	$8C
+	.byte	$05
+	.byte	$03
+	.byte	$2C
+	.byte	$07
+	.byte	$0C
+	.byte	$E4
+	.byte	$07
+	.byte	$50
+	.byte	$36
+	.byte	$34
+	.byte	$20
+	.byte	$4B
+	.byte	$42
+	.byte	$5D
+	.byte	$20
+	.byte	$06
+	.byte	$1B
+	.byte	$06
+	.byte	$04
+	.byte	$08
+	.byte	$01
+	.byte	$0F
+	.byte	$37
+	.byte	$01
+	.byte	$06
+	.byte	$0A
+	.byte	$6D
+	.byte	$10
+	.byte	$06
+	.byte	$6C
+	.byte	$00
+	.byte	$02
+	.byte	$F3
+	.byte	$05
+	.byte	$00
+	.byte	$10
+	.byte	$00
+	.byte	$07
+	.byte	$E0
+	.byte	$09
+	.byte	$2F
+	.byte	$20
+	.byte	$2A
+	.byte	$C4
+	.byte	$10
+	.byte	$00
+	.byte	$00
+	.byte	$74
+	.byte	$02
+	.byte	$31
+	.byte	$69
+	.byte	$6E
+	.byte	$75
+	.byte	$AE
+	.byte	$02
+	.byte	$04
+	.byte	$CD
+	.byte	$05
+	.byte	$08
+	.byte	$65
+	.byte	$24
+	.byte	$00
+	.byte	$AE
+	.byte	$04
+	.byte	$63
+	.byte	$27
+	.byte	$73
+	.byte	$72
+	.byte	$63
+	.byte	$27
+	.byte	$2C
+	.byte	$3B
+	.byte	$04
+	.byte	$01
+	.byte	$41
+	.byte	$01
+	.byte	$01
+	.byte	$96
+	.byte	$0A
+	.byte	$04
+	.byte	$54
+	.byte	$01
+	.byte	$2D
+	.byte	$6C
+	.byte	$79
+	.byte	$4A
+	.byte	$08
+	.byte	$10
+	.byte	$73
+	.byte	$5B
+	.byte	$04
+	.byte	$07
+	.byte	$FB
+	.byte	$00
+	.byte	$25
+	.byte	$74
+	.byte	$6F
+	.byte	$E3
+	.byte	$20
+	.byte	$0D
+	.byte	$19
+	.byte	$21
+	.byte	$02
+	.byte	$02
+	.byte	$03
+	.byte	$07
+	.byte	$39
+	.byte	$05
+	.byte	$19
+	.byte	$50
+	.byte	$AC
+	.byte	$01
+	.byte	$04
+	.byte	$50
+	.byte	$00
+	.byte	$10
+	.byte	$72
+	.byte	$DF
+	.byte	$13
+	.byte	$33
+	.byte	$73
+	.byte	$75
+	.byte	$6D
+	.byte	$C4
+	.byte	$1E
+	.byte	$13
+	.byte	$74
+	.byte	$C3
+	.byte	$01
+	.byte	$00
+	.byte	$4C
+	.byte	$00
+	.byte	$00
+	.byte	$A4
+	.byte	$00
+	.byte	$01
+	.byte	$41
+	.byte	$2B
+	.byte	$15
+	.byte	$6E
+	.byte	$A5
+	.byte	$0B
+	.byte	$01
+	.byte	$50
+	.byte	$05
+	.byte	$27
+	.byte	$27
+	.byte	$64
+	.byte	$11
+	.byte	$10
+	.byte	$0F
+	.byte	$99
+	.byte	$1B
+	.byte	$09
+	.byte	$01
+	.byte	$36
+	.byte	$25
+	.byte	$00
+	.byte	$21
+	.byte	$07
+	.byte	$03
+	.byte	$C4
+	.byte	$0E
+	.byte	$0F
+	.byte	$BD
+	.byte	$16
+	.byte	$0A
+	.byte	$00
+	.byte	$74
+	.byte	$01
+	.byte	$0F
+	.byte	$5E
+	.byte	$1F
+	.byte	$0F
+	.byte	$02
+	.byte	$45
+	.byte	$08
+	.byte	$07
+	.byte	$24
+	.byte	$1F
+	.byte	$04
+	.byte	$67
+	.byte	$00
+	.byte	$32
+	.byte	$6E
+	.byte	$6F
+	.byte	$74
+	.byte	$1C
+	.byte	$00
+	.byte	$2D
+	.byte	$69
+	.byte	$66
+	.byte	$85
+	.byte	$25
+	.byte	$03
+	.byte	$13
+	.byte	$1F
+	.byte	$25
+	.byte	$66
+	.byte	$69
+	.byte	$FC
+	.byte	$10
+	.byte	$07
+	.byte	$C1
+	.byte	$00
+	.byte	$02
+	.byte	$3F
+	.byte	$02
+	.byte	$0D
+	.byte	$F6
+	.byte	$1E
+	.byte	$02
+	.byte	$4D
+	.byte	$00
+	.byte	$07
+	.byte	$E4
+	.byte	$1E
+	.byte	$00
+	.byte	$79
+	.byte	$02
+	.byte	$00
+	.byte	$D8
+	.byte	$05
+	.byte	$03
+	.byte	$E4
+	.byte	$1E
+	.byte	$07
+	.byte	$4F
+	.byte	$02
+	.byte	$0F
+	.byte	$FA
+	.byte	$01
+	.byte	$03
+	.byte	$0F
+	.byte	$5D
+	.byte	$02
+	.byte	$14
+	.byte	$35
+	.byte	$73
+	.byte	$72
+	.byte	$63
+	.byte	$7F
+	.byte	$08
+	.byte	$05
+	.byte	$BE
+	.byte	$14
+	.byte	$2A
+	.byte	$72
+	.byte	$63
+	.byte	$61
+	.byte	$08
+	.byte	$0F
+	.byte	$C3
+	.byte	$12
+	.byte	$09
+	.byte	$07
+	.byte	$63
+	.byte	$07
+	.byte	$34
+	.byte	$61
+	.byte	$76
+	.byte	$65
+	.byte	$DF
+	.byte	$03
+	.byte	$2F
+	.byte	$49
+	.byte	$66
+	.byte	$48
+	.byte	$02
+	.byte	$04
+	.byte	$06
+	.byte	$FD
+	.byte	$01
+	.byte	$04
+	.byte	$AB
+	.byte	$1C
+	.byte	$0A
+	.byte	$68
+	.byte	$01
+	.byte	$03
+	.byte	$9A
+	.byte	$03
+	.byte	$51
+	.byte	$61
+	.byte	$76
+	.byte	$61
+	.byte	$69
+	.byte	$6C
+	.byte	$D2
+	.byte	$26
+	.byte	$27
+	.byte	$61
+	.byte	$74
+	.byte	$57
+	.byte	$05
+	.byte	$14
+	.byte	$20
+	.byte	$E5
+	.byte	$18
+	.byte	$00
+	.byte	$64
+	.byte	$00
+	.byte	$00
+	.byte	$70
+	.byte	$00
+	.byte	$14
+	.byte	$20
+	.byte	$54
+	.byte	$01
+	.byte	$20
+	.byte	$61
+	.byte	$20
+	.byte	$66
+	.byte	$09
+	.byte	$21
+	.byte	$72
+	.byte	$20
+	.byte	$F0
+	.byte	$15
+	.byte	$23
+	.byte	$20
+	.byte	$28
+	.byte	$DD
+	.byte	$00
+	.byte	$41
+	.byte	$61
+	.byte	$66
+	.byte	$65
+	.byte	$42
+	.byte	$67
+	.byte	$01
+	.byte	$01
+	.byte	$DE
+	.byte	$23
+	.byte	$03
+	.byte	$53
+	.byte	$0B
+	.byte	$00
+	.byte	$34
+	.byte	$07
+	.byte	$55
+	.byte	$64
+	.byte	$6F
+	.byte	$6E
+	.byte	$27
+	.byte	$74
+	.byte	$4E
+	.byte	$27
+	.byte	$00
+	.byte	$65
+	.byte	$07
+	.byte	$09
+	.byte	$9A
+	.byte	$03
+	.byte	$A0
+	.byte	$28
+	.byte	$29
+	.byte	$20
+	.byte	$61
+	.byte	$66
+	.byte	$74
+	.byte	$65
+	.byte	$72
+	.byte	$77
+	.byte	$61
+	.byte	$05
+	.byte	$10
+	.byte	$07
+	.byte	$73
+	.byte	$07
+	.byte	$08
+	.byte	$94
+	.byte	$04
+	.byte	$27
+	.byte	$73
+	.byte	$20
+	.byte	$99
+	.byte	$20
+	.byte	$00
+	.byte	$F6
+	.byte	$23
+	.byte	$63
+	.byte	$62
+	.byte	$6C
+	.byte	$65
+	.byte	$2C
+	.byte	$20
+	.byte	$79
+	.byte	$ED
+	.byte	$28
+	.byte	$06
+	.byte	$3E
+	.byte	$0A
+	.byte	$05
+	.byte	$5E
+	.byte	$00
+	.byte	$0F
+	.byte	$A9
+	.byte	$01
+	.byte	$03
+	.byte	$29
+	.byte	$28
+	.byte	$29
+	.byte	$5A
+	.byte	$04
+	.byte	$00
+	.byte	$D6
+	.byte	$00
+	.byte	$1C
+	.byte	$64
+	.byte	$60
+	.byte	$04
+	.byte	$0F
+	.byte	$5F
+	.byte	$04
+	.byte	$07
+	.byte	$05
+	.byte	$0D
+	.byte	$04
+	.byte	$15
+	.byte	$2C
+	.byte	$DA
+	.byte	$11
+	.byte	$01
+	.byte	$CD
+	.byte	$1D
+	.byte	$09
+	.byte	$22
+	.byte	$02
+	.byte	$04
+	.byte	$9A
+	.byte	$01
+	.byte	$0F
+	.byte	$71
+	.byte	$04
+	.byte	$09
+	.byte	$0B
+	.byte	$31
+	.byte	$01
+	.byte	$0E
+	.byte	$6B
+	.byte	$04
+	.byte	$0E
+	.byte	$53
+	.byte	$0A
+	.byte	$0F
+	.byte	$54
+	.byte	$0A
+	.byte	$1B
+	.byte	$06
+	.byte	$A7
+	.byte	$0A
+	.byte	$0F
+	.byte	$56
+	.byte	$0A
+	.byte	$2A
+	.byte	$00
+	.byte	$63
+	.byte	$1D
+	.byte	$0E
+	.byte	$1B
+	.byte	$0A
+	.byte	$65
+	.byte	$44
+	.byte	$45
+	.byte	$43
+	.byte	$4F
+	.byte	$44
+	.byte	$45
+	.byte	$0D
+	.byte	$0A
+	.byte	$2F
+	.byte	$20
+	.byte	$34
+	.byte	$24
+	.byte	$00
+	.byte	$0A
+	.byte	$0C
+	.byte	$45
+	.byte	$0A
+	.byte	$0B
+	.byte	$3E
+	.byte	$00
+	.byte	$05
+	.byte	$4B
+	.byte	$0A
+	.byte	$04
+	.byte	$E3
+	.byte	$1C
+	.byte	$18
+	.byte	$20
+	.byte	$54
+	.byte	$0A
+	.byte	$0D
+	.byte	$21
+	.byte	$09
+	.byte	$0E
+	.byte	$26
+	.byte	$00
+	.byte	$0D
+	.byte	$2A
+	.byte	$09
+	.byte	$0A
+	.byte	$61
+	.byte	$00
+	.byte	$0B
+	.byte	$30
+	.byte	$09
+	.byte	$11
+	.byte	$44
+	.byte	$59
+	.byte	$0D
+	.byte	$00
+	.byte	$36
+	.byte	$09
+	.byte	$0C
+	.byte	$AF
+	.byte	$0A
+	.byte	$04
+	.byte	$1A
+	.byte	$00
+	.byte	$0F
+	.byte	$B5
+	.byte	$0A
+	.byte	$23
+	.byte	$0F
+	.byte	$A9
+	.byte	$0A
+	.byte	$08
+	.byte	$23
+	.byte	$75
+	.byte	$73
+	.byte	$4E
+	.byte	$0A
+	.byte	$15
+	.byte	$5F
+	.byte	$42
+	.byte	$09
+	.byte	$02
+	.byte	$6C
+	.byte	$00
+	.byte	$12
+	.byte	$20
+	.byte	$DE
+	.byte	$1C
+	.byte	$20
+	.byte	$73
+	.byte	$65
+	.byte	$03
+	.byte	$03
+	.byte	$0F
+	.byte	$CF
+	.byte	$0A
+	.byte	$02
+	.byte	$0F
+	.byte	$D9
+	.byte	$08
+	.byte	$11
+	.byte	$04
+	.byte	$D8
+	.byte	$08
+	.byte	$30
+	.byte	$70
+	.byte	$72
+	.byte	$65
+	.byte	$94
+	.byte	$03
+	.byte	$02
+	.byte	$11
+	.byte	$27
+	.byte	$2F
+	.byte	$6F
+	.byte	$66
+	.byte	$7E
+	.byte	$0A
+	.byte	$03
+	.byte	$01
+	.byte	$99
+	.byte	$0A
+	.byte	$0F
+	.byte	$D3
+	.byte	$08
+	.byte	$2F
+	.byte	$04
+	.byte	$2C
+	.byte	$01
+	.byte	$05
+	.byte	$30
+	.byte	$03
+	.byte	$24
+	.byte	$74
+	.byte	$68
+	.byte	$44
+	.byte	$00
+	.byte	$1F
+	.byte	$2E
+	.byte	$FF
+	.byte	$09
+	.byte	$01
+	.byte	$03
+	.byte	$F0
+	.byte	$00
+	.byte	$0F
+	.byte	$05
+	.byte	$0A
+	.byte	$17
+	.byte	$06
+	.byte	$61
+	.byte	$00
+	.byte	$0F
+	.byte	$0B
+	.byte	$0A
+	.byte	$07
+	.byte	$03
+	.byte	$55
+	.byte	$00
+	.byte	$0F
+	.byte	$11
+	.byte	$0A
+	.byte	$04
+	.byte	$2E
+	.byte	$2F
+	.byte	$0A
+	.byte	$4E
+	.byte	$00
+	.byte	$0F
+	.byte	$99
+	.byte	$00
+	.byte	$05
+	.byte	$0E
+	.byte	$77
+	.byte	$09
+	.byte	$0F
+	.byte	$7D
+	.byte	$09
+	.byte	$05
+	.byte	$03
+	.byte	$74
+	.byte	$00
+	.byte	$1F
+	.byte	$28
+	.byte	$5C
+	.byte	$00
+	.byte	$05
+	.byte	$02
+	.byte	$14
+	.byte	$00
+	.byte	$0B
+	.byte	$AB
+	.byte	$05
+	.byte	$0A
+	.byte	$F6
+	.byte	$01
+	.byte	$0F
+	.byte	$98
+	.byte	$0B
+	.byte	$08
+	.byte	$03
+	.byte	$E6
+	.byte	$02
+	.byte	$02
+	.byte	$FB
+	.byte	$16
+	.byte	$01
+	.byte	$E8
+	.byte	$16
+	.byte	$03
+	.byte	$7F
+	.byte	$25
+	.byte	$06
+	.byte	$A2
+	.byte	$04
+	.byte	$01
+	.byte	$5F
+	.byte	$01
+	.byte	$12
+	.byte	$53
+	.byte	$14
+	.byte	$26
+	.byte	$0F
+	.byte	$3D
+	.byte	$09
+	.byte	$04
+	.byte	$21
+	.byte	$20
+	.byte	$28
+	.byte	$C9
+	.byte	$1B
+	.byte	$02
+	.byte	$F4
+	.byte	$28
+	.byte	$02
+	.byte	$D0
+	.byte	$1B
+	.byte	$4A
+	.byte	$73
+	.byte	$65
+	.byte	$74
+	.byte	$29
+	.byte	$54
+	.byte	$09
+	.byte	$10
+	.byte	$31
+	.byte	$BD
+	.byte	$04
+	.byte	$3F
+	.byte	$4F
+	.byte	$4B
+	.byte	$2C
+	.byte	$C6
+	.byte	$04
+	.byte	$06
+	.byte	$2F
+	.byte	$65
+	.byte	$74
+	.byte	$F2
+	.byte	$00
+	.byte	$19
+	.byte	$02
+	.byte	$14
+	.byte	$00
+	.byte	$0F
+	.byte	$4B
+	.byte	$09
+	.byte	$1A
+	.byte	$17
+	.byte	$2A
+	.byte	$95
+	.byte	$05
+	.byte	$05
+	.byte	$1A
+	.byte	$13
+	.byte	$00
+	.byte	$97
+	.byte	$0B
+	.byte	$05
+	.byte	$A3
+	.byte	$10
+	.byte	$05
+	.byte	$C2
+	.byte	$2D
+	.byte	$02
+	.byte	$DA
+	.byte	$00
+	.byte	$0B
+	.byte	$29
+	.byte	$12
+	.byte	$80
+	.byte	$6F
+	.byte	$66
+	.byte	$20
+	.byte	$6D
+	.byte	$75
+	.byte	$6C
+	.byte	$74
+	.byte	$69
+	.byte	$39
+	.byte	$29
+	.byte	$03
+	.byte	$E1
+	.byte	$08
+	.byte	$54
+	.byte	$69
+	.byte	$6E
+	.byte	$20
+	.byte	$22
+	.byte	$73
+	.byte	$04
+	.byte	$05
+	.byte	$10
+	.byte	$22
+	.byte	$6F
+	.byte	$14
+	.byte	$03
+	.byte	$4B
+	.byte	$12
+	.byte	$16
+	.byte	$50
+	.byte	$1F
+	.byte	$07
+	.byte	$04
+	.byte	$39
+	.byte	$12
+	.byte	$03
+	.byte	$64
+	.byte	$09
+	.byte	$10
+	.byte	$2A
+	.byte	$D4
+	.byte	$08
+	.byte	$1F
+	.byte	$2A
+	.byte	$0A
+	.byte	$07
+	.byte	$02
+	.byte	$01
+	.byte	$0D
+	.byte	$21
+	.byte	$02
+	.byte	$0A
+	.byte	$07
+	.byte	$05
+	.byte	$6B
+	.byte	$13
+	.byte	$03
+	.byte	$9B
+	.byte	$01
+	.byte	$00
+	.byte	$3C
+	.byte	$03
+	.byte	$08
+	.byte	$A8
+	.byte	$11
+	.byte	$40
+	.byte	$20
+	.byte	$28
+	.byte	$75
+	.byte	$70
+	.byte	$B1
+	.byte	$01
+	.byte	$04
+	.byte	$80
+	.byte	$0A
+	.byte	$25
+	.byte	$20
+	.byte	$20
+	.byte	$B7
+	.byte	$03
+	.byte	$05
+	.byte	$48
+	.byte	$03
+	.byte	$10
+	.byte	$72
+	.byte	$D3
+	.byte	$00
+	.byte	$02
+	.byte	$88
+	.byte	$08
+	.byte	$17
+	.byte	$73
+	.byte	$26
+	.byte	$24
+	.byte	$0B
+	.byte	$5B
+	.byte	$09
+	.byte	$03
+	.byte	$DE
+	.byte	$19
+	.byte	$02
+	.byte	$10
+	.byte	$01
+	.byte	$51
+	.byte	$2D
+	.byte	$20
+	.byte	$45
+	.byte	$78
+	.byte	$61
+	.byte	$B8
+	.byte	$0E
+	.byte	$01
+	.byte	$D2
+	.byte	$01
+	.byte	$01
+	.byte	$3A
+	.byte	$25
+	.byte	$59
+	.byte	$61
+	.byte	$73
+	.byte	$20
+	.byte	$65
+	.byte	$6E
+	.byte	$3C
+	.byte	$00
+	.byte	$03
+	.byte	$1D
+	.byte	$1E
+	.byte	$01
+	.byte	$23
+	.byte	$00
+	.byte	$30
+	.byte	$75
+	.byte	$70
+	.byte	$64
+	.byte	$5B
+	.byte	$03
+	.byte	$62
+	.byte	$72
+	.byte	$75
+	.byte	$6C
+	.byte	$65
+	.byte	$20
+	.byte	$28
+	.byte	$FA
+	.byte	$07
+	.byte	$07
+	.byte	$2C
+	.byte	$16
+	.byte	$22
+	.byte	$61
+	.byte	$74
+	.byte	$26
+	.byte	$00
+	.byte	$04
+	.byte	$CF
+	.byte	$00
+	.byte	$14
+	.byte	$73
+	.byte	$01
+	.byte	$13
+	.byte	$23
+	.byte	$49
+	.byte	$6E
+	.byte	$90
+	.byte	$1D
+	.byte	$00
+	.byte	$AF
+	.byte	$00
+	.byte	$02
+	.byte	$3C
+	.byte	$12
+	.byte	$05
+	.byte	$86
+	.byte	$01
+	.byte	$16
+	.byte	$26
+	.byte	$70
+	.byte	$00
+	.byte	$07
+	.byte	$C3
+	.byte	$00
+	.byte	$01
+	.byte	$77
+	.byte	$07
+	.byte	$32
+	.byte	$68
+	.byte	$61
+	.byte	$76
+	.byte	$FA
+	.byte	$15
+	.byte	$04
+	.byte	$97
+	.byte	$0B
+	.byte	$04
+	.byte	$07
+	.byte	$24
+	.byte	$42
+	.byte	$76
+	.byte	$65
+	.byte	$72
+	.byte	$79
+	.byte	$FD
+	.byte	$12
+	.byte	$30
+	.byte	$20
+	.byte	$6F
+	.byte	$6E
+	.byte	$49
+	.byte	$07
+	.byte	$23
+	.byte	$20
+	.byte	$3C
+	.byte	$1C
+	.byte	$01
+	.byte	$13
+	.byte	$2E
+	.byte	$D9
+	.byte	$00
+	.byte	$14
+	.byte	$4C
+	.byte	$5A
+	.byte	$1F
+	.byte	$2E
+	.byte	$61
+	.byte	$6E
+	.byte	$D0
+	.byte	$00
+	.byte	$2A
+	.byte	$62
+	.byte	$79
+	.byte	$33
+	.byte	$17
+	.byte	$40
+	.byte	$6D
+	.byte	$61
+	.byte	$78
+	.byte	$42
+	.byte	$CC
+	.byte	$00
+	.byte	$01
+	.byte	$59
+	.byte	$0A
+	.byte	$01
+	.byte	$B0
+	.byte	$04
+	.byte	$07
+	.byte	$36
+	.byte	$17
+	.byte	$1A
+	.byte	$20
+	.byte	$1F
+	.byte	$00
+	.byte	$01
+	.byte	$2A
+	.byte	$08
+	.byte	$36
+	.byte	$70
+	.byte	$6C
+	.byte	$65
+	.byte	$65
+	.byte	$34
+	.byte	$30
+	.byte	$64
+	.byte	$65
+	.byte	$70
+	.byte	$4B
+	.byte	$29
+	.byte	$32
+	.byte	$6E
+	.byte	$74
+	.byte	$2E
+	.byte	$6E
+	.byte	$1F
+	.byte	$0D
+	.byte	$E5
+	.byte	$22
+	.byte	$00
+	.byte	$46
+	.byte	$08
+	.byte	$01
+	.byte	$A9
+	.byte	$16
+	.byte	$18
+	.byte	$64
+	.byte	$DC
+	.byte	$1C
+	.byte	$05
+	.byte	$EB
+	.byte	$08
+	.byte	$34
+	.byte	$69
+	.byte	$6E
+	.byte	$67
+	.byte	$63
+	.byte	$02
+	.byte	$1F
+	.byte	$2E
+	.byte	$30
+	.byte	$01
+	.byte	$03
+	.byte	$27
+	.byte	$65
+	.byte	$6E
+	.byte	$55
+	.byte	$13
+	.byte	$0B
+	.byte	$DA
+	.byte	$01
+	.byte	$41
+	.byte	$73
+	.byte	$20
+	.byte	$64
+	.byte	$6F
+	.byte	$7B
+	.byte	$09
+	.byte	$04
+	.byte	$00
+	.byte	$09
+	.byte	$00
+	.byte	$17
+	.byte	$14
+	.byte	$94
+	.byte	$79
+	.byte	$6E
+	.byte	$63
+	.byte	$68
+	.byte	$72
+	.byte	$6F
+	.byte	$6E
+	.byte	$69
+	.byte	$7A
+	.byte	$0D
+	.byte	$15
+	.byte	$02
+	.byte	$BE
+	.byte	$1D
+	.byte	$0F
+	.byte	$69
+	.byte	$01
+	.byte	$1F
+	.byte	$0F
+	.byte	$64
+	.byte	$01
+	.byte	$0A
+	.byte	$40
+	.byte	$5F
+	.byte	$41
+	.byte	$74
+	.byte	$20
+	.byte	$1C
+	.byte	$05
+	.byte	$22
+	.byte	$74
+	.byte	$5F
+	.byte	$19
+	.byte	$00
+	.byte	$43
+	.byte	$20
+	.byte	$2B
+	.byte	$20
+	.byte	$38
+	.byte	$DA
+	.byte	$08
+	.byte	$19
+	.byte	$2B
+	.byte	$35
+	.byte	$01
+	.byte	$0F
+	.byte	$D7
+	.byte	$00
+	.byte	$7E
+	.byte	$17
+	.byte	$6C
+	.byte	$1E
+	.byte	$02
+	.byte	$0B
+	.byte	$79
+	.byte	$00
+	.byte	$02
+	.byte	$AC
+	.byte	$00
+	.byte	$32
+	.byte	$57
+	.byte	$68
+	.byte	$65
+	.byte	$5D
+	.byte	$14
+	.byte	$02
+	.byte	$CA
+	.byte	$0F
+	.byte	$0A
+	.byte	$8C
+	.byte	$37
+	.byte	$02
+	.byte	$99
+	.byte	$18
+	.byte	$03
+	.byte	$9D
+	.byte	$1C
+	.byte	$12
+	.byte	$2C
+	.byte	$BB
+	.byte	$0A
+	.byte	$01
+	.byte	$D3
+	.byte	$1D
+	.byte	$00
+	.byte	$DA
+	.byte	$17
+	.byte	$00
+	.byte	$90
+	.byte	$2E
+	.byte	$02
+	.byte	$7F
+	.byte	$28
+	.byte	$02
+	.byte	$BA
+	.byte	$03
+	.byte	$01
+	.byte	$24
+	.byte	$0B
+	.byte	$07
+	.byte	$D6
+	.byte	$0A
+	.byte	$04
+	.byte	$85
+	.byte	$02
+	.byte	$05
+	.byte	$53
+	.byte	$1F
+	.byte	$05
+	.byte	$A1
+	.byte	$1C
+	.byte	$02
+	.byte	$FC
+	.byte	$03
+	.byte	$11
+	.byte	$69
+	.byte	$AF
+	.byte	$14
+	.byte	$02
+	.byte	$39
+	.byte	$0A
+	.byte	$0F
+	.byte	$DA
+	.byte	$07
+	.byte	$06
+	.byte	$2F
+	.byte	$28
+	.byte	$29
+	.byte	$9E
+	.byte	$14
+	.byte	$09
+	.byte	$0E
+	.byte	$36
+	.byte	$0C
+	.byte	$0F
+	.byte	$55
+	.byte	$05
+	.byte	$0B
+	.byte	$0F
+	.byte	$70
+	.byte	$2D
+	.byte	$3B
+	.byte	$0F
+	.byte	$F3
+	.byte	$18
+	.byte	$04
+	.byte	$0F
+	.byte	$96
+	.byte	$00
+	.byte	$42
+	.byte	$0C
+	.byte	$22
+	.byte	$19
+	.byte	$00
+	.byte	$F8
+	.byte	$05
+	.byte	$05
+	.byte	$87
+	.byte	$27
+	.byte	$0F
+	.byte	$E8
+	.byte	$05
+	.byte	$00
+	.byte	$41
+	.byte	$3A
+	.byte	$0A
+	.byte	$2A
+	.byte	$5F
+	.byte	$55
+	.byte	$01
+	.byte	$03
+	.byte	$18
+	.byte	$0C
+	.byte	$0F
+	.byte	$17
+	.byte	$06
+	.byte	$0C
+	.byte	$48
+	.byte	$77
+	.byte	$6F
+	.byte	$72
+	.byte	$6B
+	.byte	$BA
+	.byte	$22
+	.byte	$02
+	.byte	$B4
+	.byte	$01
+	.byte	$00
+	.byte	$0C
+	.byte	$01
+	.byte	$14
+	.byte	$62
+	.byte	$0D
+	.byte	$18
+	.byte	$2F
+	.byte	$6F
+	.byte	$66
+	.byte	$A0
+	.byte	$01
+	.byte	$03
+	.byte	$03
+	.byte	$A8
+	.byte	$38
+	.byte	$02
+	.byte	$AE
+	.byte	$22
+	.byte	$0B
+	.byte	$0F
+	.byte	$01
+	.byte	$19
+	.byte	$78
+	.byte	$2F
+	.byte	$0C
+	.byte	$26
+	.byte	$20
+	.byte	$20
+	.byte	$2C
+	.byte	$09
+	.byte	$C2
+	.byte	$73
+	.byte	$74
+	.byte	$61
+	.byte	$6E
+	.byte	$64
+	.byte	$2D
+	.byte	$61
+	.byte	$6C
+	.byte	$6F
+	.byte	$6E
+	.byte	$65
+	.byte	$2E
+	.byte	$16
+	.byte	$00
+	.byte	$07
+	.byte	$DC
+	.byte	$0C
+	.byte	$00
+	.byte	$B0
+	.byte	$28
+	.byte	$03
+	.byte	$80
+	.byte	$05
+	.byte	$0F
+	.byte	$CC
+	.byte	$08
+	.byte	$0C
+	.byte	$1F
+	.byte	$2E
+	.byte	$1E
+	.byte	$02
+	.byte	$09
+	.byte	$05
+	.byte	$00
+	.byte	$01
+	.byte	$0F
+	.byte	$69
+	.byte	$2F
+	.byte	$3A
+	.byte	$0E
+	.byte	$9B
+	.byte	$07
+	.byte	$5D
+	.byte	$53
+	.byte	$74
+	.byte	$61
+	.byte	$72
+	.byte	$74
+	.byte	$9A
+	.byte	$07
+	.byte	$0F
+	.byte	$1E
+	.byte	$02
+	.byte	$05
+	.byte	$0E
+	.byte	$96
+	.byte	$00
+	.byte	$0F
+	.byte	$1B
+	.byte	$1B
+	.byte	$12
+	.byte	$0F
+	.byte	$7B
+	.byte	$00
+	.byte	$19
+	.byte	$0F
+	.byte	$CE
+	.byte	$29
+	.byte	$1B
+	.byte	$40
+	.byte	$4F
+	.byte	$62
+	.byte	$73
+	.byte	$6F
+	.byte	$9D
+	.byte	$20
+	.byte	$0F
+	.byte	$CE
+	.byte	$29
+	.byte	$20
+	.byte	$10
+	.byte	$2F
+	.byte	$07
+	.byte	$32
+	.byte	$00
+	.byte	$D3
+	.byte	$2C
+	.byte	$00
+	.byte	$AB
+	.byte	$01
+	.byte	$30
+	.byte	$57
+	.byte	$61
+	.byte	$72
+	.byte	$43
+	.byte	$33
+	.byte	$22
+	.byte	$73
+	.byte	$20
+	.byte	$19
+	.byte	$00
+	.byte	$15
+	.byte	$53
+	.byte	$DB
+	.byte	$19
+	.byte	$44
+	.byte	$73
+	.byte	$65
+	.byte	$20
+	.byte	$77
+	.byte	$1C
+	.byte	$00
+	.byte	$10
+	.byte	$6D
+	.byte	$06
+	.byte	$0E
+	.byte	$00
+	.byte	$C9
+	.byte	$34
+	.byte	$01
+	.byte	$CD
+	.byte	$1D
+	.byte	$71
+	.byte	$70
+	.byte	$72
+	.byte	$6F
+	.byte	$62
+	.byte	$6C
+	.byte	$65
+	.byte	$6D
+	.byte	$23
+	.byte	$04
+	.byte	$02
+	.byte	$0F
+	.byte	$04
+	.byte	$02
+	.byte	$22
+	.byte	$36
+	.byte	$00
+	.byte	$3D
+	.byte	$16
+	.byte	$05
+	.byte	$14
+	.byte	$21
+	.byte	$00
+	.byte	$08
+	.byte	$1A
+	.byte	$11
+	.byte	$69
+	.byte	$A7
+	.byte	$0E
+	.byte	$00
+	.byte	$4D
+	.byte	$00
+	.byte	$02
+	.byte	$2D
+	.byte	$00
+	.byte	$01
+	.byte	$A8
+	.byte	$07
+	.byte	$64
+	.byte	$2D
+	.byte	$57
+	.byte	$6E
+	.byte	$6F
+	.byte	$2D
+	.byte	$64
+	.byte	$80
+	.byte	$00
+	.byte	$72
+	.byte	$64
+	.byte	$2D
+	.byte	$64
+	.byte	$65
+	.byte	$63
+	.byte	$6C
+	.byte	$61
+	.byte	$E3
+	.byte	$0F
+	.byte	$02
+	.byte	$CE
+	.byte	$1D
+	.byte	$42
+	.byte	$67
+	.byte	$63
+	.byte	$63
+	.byte	$0A
+	.byte	$3C
+	.byte	$20
+	.byte	$70
+	.byte	$5F
+	.byte	$43
+	.byte	$52
+	.byte	$54
+	.byte	$5F
+	.byte	$53
+	.byte	$45
+	.byte	$2F
+	.byte	$39
+	.byte	$C0
+	.byte	$5F
+	.byte	$4E
+	.byte	$4F
+	.byte	$5F
+	.byte	$57
+	.byte	$41
+	.byte	$52
+	.byte	$4E
+	.byte	$49
+	.byte	$4E
+	.byte	$47
+	.byte	$53
+	.byte	$E8
+	.byte	$08
+	.byte	$68
+	.byte	$56
+	.byte	$69
+	.byte	$73
+	.byte	$75
+	.byte	$61
+	.byte	$6C
+	.byte	$7F
+	.byte	$28
+	.byte	$18
+	.byte	$2E
+	.byte	$FE
+	.byte	$37
+	.byte	$01
+	.byte	$7C
+	.byte	$26
+	.byte	$07
+	.byte	$95
+	.byte	$0D
+	.byte	$94
+	.byte	$44
+	.byte	$45
+	.byte	$50
+	.byte	$52
+	.byte	$45
+	.byte	$43
+	.byte	$41
+	.byte	$54
+	.byte	$45
+	.byte	$45
+	.byte	$00
+	.byte	$00
+	.byte	$95
+	.byte	$25
+	.byte	$61
+	.byte	$42
+	.byte	$4C
+	.byte	$4F
+	.byte	$43
+	.byte	$4B
+	.byte	$2E
+	.byte	$97
+	.byte	$2A
+	.byte	$30
+	.byte	$69
+	.byte	$66
+	.byte	$6E
+	.byte	$67
+	.byte	$0D
+	.byte	$0F
+	.byte	$2B
+	.byte	$00
+	.byte	$0B
+	.byte	$3E
+	.byte	$0A
+	.byte	$23
+	.byte	$20
+	.byte	$54
+	.byte	$00
+	.byte	$0F
+	.byte	$29
+	.byte	$00
+	.byte	$10
+	.byte	$34
+	.byte	$47
+	.byte	$43
+	.byte	$43
+	.byte	$04
+	.byte	$35
+	.byte	$00
+	.byte	$E0
+	.byte	$37
+	.byte	$92
+	.byte	$47
+	.byte	$4E
+	.byte	$55
+	.byte	$43
+	.byte	$5F
+	.byte	$5F
+	.byte	$20
+	.byte	$2A
+	.byte	$20
+	.byte	$22
+	.byte	$35
+	.byte	$03
+	.byte	$11
+	.byte	$00
+	.byte	$01
+	.byte	$36
+	.byte	$35
+	.byte	$30
+	.byte	$5F
+	.byte	$5F
+	.byte	$29
+	.byte	$3C
+	.byte	$00
+	.byte	$4C
+	.byte	$69
+	.byte	$66
+	.byte	$20
+	.byte	$28
+	.byte	$39
+	.byte	$00
+	.byte	$A4
+	.byte	$3E
+	.byte	$3D
+	.byte	$20
+	.byte	$34
+	.byte	$30
+	.byte	$35
+	.byte	$29
+	.byte	$20
+	.byte	$7C
+	.byte	$7C
+	.byte	$2C
+	.byte	$38
+	.byte	$00
+	.byte	$2B
+	.byte	$38
+	.byte	$43
+	.byte	$6C
+	.byte	$61
+	.byte	$6E
+	.byte	$67
+	.byte	$35
+	.byte	$00
+	.byte	$0F
+	.byte	$9C
+	.byte	$00
+	.byte	$03
+	.byte	$23
+	.byte	$44
+	.byte	$28
+	.byte	$BC
+	.byte	$01
+	.byte	$62
+	.byte	$29
+	.byte	$20
+	.byte	$5F
+	.byte	$5F
+	.byte	$61
+	.byte	$74
+	.byte	$42
+	.byte	$3C
+	.byte	$56
+	.byte	$65
+	.byte	$5F
+	.byte	$5F
+	.byte	$28
+	.byte	$28
+	.byte	$83
+	.byte	$01
+	.byte	$05
+	.byte	$23
+	.byte	$00
+	.byte	$11
+	.byte	$29
+	.byte	$49
+	.byte	$00
+	.byte	$2F
+	.byte	$65
+	.byte	$6C
+	.byte	$80
+	.byte	$00
+	.byte	$04
+	.byte	$3F
+	.byte	$33
+	.byte	$30
+	.byte	$31
+	.byte	$6A
+	.byte	$00
+	.byte	$2C
+	.byte	$07
+	.byte	$61
+	.byte	$00
+	.byte	$05
+	.byte	$C5
+	.byte	$00
+	.byte	$21
+	.byte	$4D
+	.byte	$53
+	.byte	$65
+	.byte	$00
+	.byte	$0F
+	.byte	$5A
+	.byte	$00
+	.byte	$15
+	.byte	$00
+	.byte	$2F
+	.byte	$02
+	.byte	$00
+	.byte	$0C
+	.byte	$20
+	.byte	$0F
+	.byte	$C0
+	.byte	$00
+	.byte	$02
+	.byte	$02
+	.byte	$5E
+	.byte	$00
+	.byte	$22
+	.byte	$73
+	.byte	$65
+	.byte	$4C
+	.byte	$00
+	.byte	$03
+	.byte	$65
+	.byte	$39
+	.byte	$03
+	.byte	$1E
+	.byte	$00
+	.byte	$23
+	.byte	$28
+	.byte	$22
+	.byte	$A7
+	.byte	$01
+	.byte	$37
+	.byte	$3A
+	.byte	$20
+	.byte	$59
+	.byte	$DD
+	.byte	$38
+	.byte	$05
+	.byte	$2D
+	.byte	$09
+	.byte	$0B
+	.byte	$74
+	.byte	$00
+	.byte	$02
+	.byte	$35
+	.byte	$37
+	.byte	$00
+	.byte	$A4
+	.byte	$0C
+	.byte	$02
+	.byte	$18
+	.byte	$2B
+	.byte	$3F
+	.byte	$65
+	.byte	$72
+	.byte	$22
+	.byte	$A3
+	.byte	$00
+	.byte	$12
+	.byte	$01
+	.byte	$83
+	.byte	$00
+	.byte	$01
+	.byte	$A9
+	.byte	$39
+	.byte	$02
+	.byte	$B0
+	.byte	$39
+	.byte	$00
+	.byte	$0D
+	.byte	$2D
+	.byte	$0F
+	.byte	$2E
+	.byte	$02
+	.byte	$0B
+	.byte	$12
+	.byte	$20
+	.byte	$C1
+	.byte	$38
+	.byte	$06
+	.byte	$D2
+	.byte	$03
+	.byte	$0F
+	.byte	$C6
+	.byte	$39
+	.byte	$02
+	.byte	$03
+	.byte	$A0
+	.byte	$03
+	.byte	$02
+	.byte	$0C
+	.byte	$06
+	.byte	$07
+	.byte	$1A
+	.byte	$0C
+	.byte	$00
+	.byte	$B6
+	.byte	$0E
+	.byte	$44
+	.byte	$6C
+	.byte	$61
+	.byte	$6E
+	.byte	$6E
+	.byte	$D4
+	.byte	$14
+	.byte	$36
+	.byte	$61
+	.byte	$72
+	.byte	$74
+	.byte	$B1
+	.byte	$39
+	.byte	$05
+	.byte	$C1
+	.byte	$03
+	.byte	$F2
+	.byte	$01
+	.byte	$62
+	.byte	$79
+	.byte	$20
+	.byte	$72
+	.byte	$31
+	.byte	$33
+	.byte	$31
+	.byte	$20
+	.byte	$61
+	.byte	$70
+	.byte	$70
+	.byte	$72
+	.byte	$6F
+	.byte	$78
+	.byte	$69
+	.byte	$6D
+	.byte	$47
+	.byte	$12
+	.byte	$0F
+	.byte	$D8
+	.byte	$13
+	.byte	$00
+	.byte	$0B
+	.byte	$FE
+	.byte	$0D
+	.byte	$0F
+	.byte	$81
+	.byte	$28
+	.byte	$1C
+	.byte	$0F
+	.byte	$E7
+	.byte	$26
+	.byte	$01
+	.byte	$03
+	.byte	$7F
+	.byte	$33
+	.byte	$02
+	.byte	$4C
+	.byte	$1C
+	.byte	$0F
+	.byte	$D2
+	.byte	$28
+	.byte	$26
+	.byte	$07
+	.byte	$EB
+	.byte	$31
+	.byte	$0F
+	.byte	$64
+	.byte	$00
+	.byte	$00
+	.byte	$00
+	.byte	$59
+	.byte	$04
+	.byte	$02
+	.byte	$47
+	.byte	$27
+	.byte	$0B
+	.byte	$BF
+	.byte	$00
+	.byte	$0F
+	.byte	$55
+	.byte	$27
+	.byte	$27
+	.byte	$0F
+	.byte	$CB
+	.byte	$00
+	.byte	$0E
+	.byte	$07
+	.byte	$75
+	.byte	$00
+	.byte	$0F
+	.byte	$BC
+	.byte	$27
+	.byte	$31
+	.byte	$0F
+	.byte	$E1
+	.byte	$00
+	.byte	$0B
+	.byte	$05
+	.byte	$9D
+	.byte	$08
+	.byte	$0C
+	.byte	$E1
+	.byte	$00
+	.byte	$0E
+	.byte	$50
+	.byte	$19
+	.byte	$0E
+	.byte	$7C
+	.byte	$15
+	.byte	$0F
+	.byte	$F1
+	.byte	$00
+	.byte	$35
+	.byte	$06
+	.byte	$85
+	.byte	$00
+	.byte	$0F
+	.byte	$77
+	.byte	$00
+	.byte	$38
+	.byte	$0F
+	.byte	$01
+	.byte	$01
+	.byte	$03
+	.byte	$09
+	.byte	$10
+	.byte	$03
+	.byte	$2F
+	.byte	$64
+	.byte	$65
+	.byte	$12
+	.byte	$03
+	.byte	$17
+	.byte	$30
+	.byte	$20
+	.byte	$6E
+	.byte	$61
+	.byte	$F3
+	.byte	$22
+	.byte	$13
+	.byte	$61
+	.byte	$6C
+	.byte	$2A
+	.byte	$03
+	.byte	$BF
+	.byte	$27
+	.byte	$06
+	.byte	$2C
+	.byte	$04
+	.byte	$01
+	.byte	$D3
+	.byte	$0A
+	.byte	$01
+	.byte	$6D
+	.byte	$0E
+	.byte	$21
+	.byte	$6E
+	.byte	$6F
+	.byte	$3F
+	.byte	$13
+	.byte	$41
+	.byte	$65
+	.byte	$72
+	.byte	$20
+	.byte	$62
+	.byte	$15
+	.byte	$1B
+	.byte	$02
+	.byte	$6D
+	.byte	$20
+	.byte	$05
+	.byte	$EB
+	.byte	$08
+	.byte	$01
+	.byte	$CD
+	.byte	$19
+	.byte	$05
+	.byte	$20
+	.byte	$2F
+	.byte	$01
+	.byte	$FB
+	.byte	$0A
+	.byte	$04
+	.byte	$25
+	.byte	$2F
+	.byte	$31
+	.byte	$61
+	.byte	$74
+	.byte	$69
+	.byte	$83
+	.byte	$3B
+	.byte	$03
+	.byte	$17
+	.byte	$28
+	.byte	$20
+	.byte	$6F
+	.byte	$6C
+	.byte	$0D
+	.byte	$44
+	.byte	$03
+	.byte	$43
+	.byte	$3D
+	.byte	$15
+	.byte	$73
+	.byte	$E1
+	.byte	$0D
+	.byte	$36
+	.byte	$5A
+	.byte	$34
+	.byte	$5F
+	.byte	$30
+	.byte	$26
+	.byte	$0C
+	.byte	$63
+	.byte	$2C
+	.byte	$0F
+	.byte	$63
+	.byte	$08
+	.byte	$00
+	.byte	$0F
+	.byte	$38
+	.byte	$00
+	.byte	$02
+	.byte	$30
+	.byte	$5F
+	.byte	$75
+	.byte	$6E
+	.byte	$03
+	.byte	$2B
+	.byte	$16
+	.byte	$6E
+	.byte	$1D
+	.byte	$01
+	.byte	$0F
+	.byte	$4A
+	.byte	$00
+	.byte	$0C
+	.byte	$00
+	.byte	$43
+	.byte	$09
+	.byte	$03
+	.byte	$C8
+	.byte	$00
+	.byte	$08
+	.byte	$16
+	.byte	$01
+	.byte	$00
+	.byte	$55
+	.byte	$20
+	.byte	$10
+	.byte	$6F
+	.byte	$4D
+	.byte	$14
+	.byte	$04
+	.byte	$21
+	.byte	$0C
+	.byte	$14
+	.byte	$77
+	.byte	$9E
+	.byte	$07
+	.byte	$22
+	.byte	$64
+	.byte	$3B
+	.byte	$D7
+	.byte	$26
+	.byte	$01
+	.byte	$03
+	.byte	$05
+	.byte	$00
+	.byte	$AA
+	.byte	$07
+	.byte	$02
+	.byte	$FA
+	.byte	$00
+	.byte	$03
+	.byte	$1B
+	.byte	$1E
+	.byte	$21
+	.byte	$72
+	.byte	$65
+	.byte	$D6
+	.byte	$07
+	.byte	$02
+	.byte	$2D
+	.byte	$05
+	.byte	$20
+	.byte	$68
+	.byte	$65
+	.byte	$ED
+	.byte	$13
+	.byte	$04
+	.byte	$43
+	.byte	$25
+	.byte	$21
+	.byte	$68
+	.byte	$69
+	.byte	$6C
+	.byte	$2D
+	.byte	$08
+	.byte	$AC
+	.byte	$37
+	.byte	$04
+	.byte	$27
+	.byte	$23
+	.byte	$02
+	.byte	$18
+	.byte	$0C
+	.byte	$02
+	.byte	$44
+	.byte	$08
+	.byte	$08
+	.byte	$7A
+	.byte	$00
+	.byte	$00
+	.byte	$7B
+	.byte	$01
+	.byte	$21
+	.byte	$69
+	.byte	$67
+	.byte	$9A
+	.byte	$04
+	.byte	$30
+	.byte	$74
+	.byte	$6F
+	.byte	$20
+	.byte	$72
+	.byte	$10
+	.byte	$21
+	.byte	$74
+	.byte	$61
+	.byte	$F6
+	.byte	$3E
+	.byte	$01
+	.byte	$C1
+	.byte	$0D
+	.byte	$02
+	.byte	$CF
+	.byte	$01
+	.byte	$04
+	.byte	$84
+	.byte	$02
+	.byte	$07
+	.byte	$3C
+	.byte	$01
+	.byte	$0F
+	.byte	$72
+	.byte	$09
+	.byte	$13
+	.byte	$07
+	.byte	$3F
+	.byte	$02
+	.byte	$0E
+	.byte	$4B
+	.byte	$00
+	.byte	$0F
+	.byte	$4F
+	.byte	$01
+	.byte	$01
+	.byte	$0F
+	.byte	$6C
+	.byte	$28
+	.byte	$17
+	.byte	$3F
+	.byte	$20
+	.byte	$69
+	.byte	$73
+	.byte	$AA
+	.byte	$02
+	.byte	$05
+	.byte	$0D
+	.byte	$BD
+	.byte	$05
+	.byte	$05
+	.byte	$80
+	.byte	$11
+	.byte	$06
+	.byte	$A8
+	.byte	$0B
+	.byte	$11
+	.byte	$3B
+	.byte	$D0
+	.byte	$14
+	.byte	$00
+	.byte	$D7
+	.byte	$3D
+	.byte	$06
+	.byte	$1D
+	.byte	$00
+	.byte	$06
+	.byte	$24
+	.byte	$3E
+	.byte	$14
+	.byte	$77
+	.byte	$CB
+	.byte	$0D
+	.byte	$05
+	.byte	$3B
+	.byte	$09
+	.byte	$03
+	.byte	$BC
+	.byte	$13
+	.byte	$07
+	.byte	$5D
+	.byte	$06
+	.byte	$11
+	.byte	$22
+	.byte	$30
+	.byte	$46
+	.byte	$0C
+	.byte	$2D
+	.byte	$1D
+	.byte	$14
+	.byte	$29
+	.byte	$4D
+	.byte	$1F
+	.byte	$32
+	.byte	$22
+	.byte	$29
+	.byte	$20
+	.byte	$82
+	.byte	$04
+	.byte	$06
+	.byte	$DF
+	.byte	$13
+	.byte	$04
+	.byte	$96
+	.byte	$18
+	.byte	$01
+	.byte	$68
+	.byte	$03
+	.byte	$03
+	.byte	$97
+	.byte	$18
+	.byte	$1F
+	.byte	$3B
+	.byte	$57
+	.byte	$00
+	.byte	$1F
+	.byte	$02
+	.byte	$12
+	.byte	$14
+	.byte	$08
+	.byte	$D2
+	.byte	$2C
+	.byte	$00
+	.byte	$23
+	.byte	$00
+	.byte	$09
+	.byte	$D8
+	.byte	$2C
+	.byte	$0F
+	.byte	$54
+	.byte	$00
+	.byte	$05
+	.byte	$07
+	.byte	$31
+	.byte	$1F
+	.byte	$09
+	.byte	$53
+	.byte	$00
+	.byte	$07
+	.byte	$54
+	.byte	$00
+	.byte	$07
+	.byte	$23
+	.byte	$00
+	.byte	$06
+	.byte	$53
+	.byte	$00
+	.byte	$06
+	.byte	$48
+	.byte	$05
+	.byte	$0F
+	.byte	$C1
+	.byte	$00
+	.byte	$18
+	.byte	$04
+	.byte	$75
+	.byte	$18
+	.byte	$0A
+	.byte	$6A
+	.byte	$00
+	.byte	$23
+	.byte	$20
+	.byte	$20
+	.byte	$45
+	.byte	$00
+	.byte	$01
+	.byte	$23
+	.byte	$00
+	.byte	$56
+	.byte	$6C
+	.byte	$69
+	.byte	$64
+	.byte	$65
+	.byte	$49
+	.byte	$4E
+	.byte	$00
+	.byte	$09
+	.byte	$B6
+	.byte	$05
+	.byte	$2F
+	.byte	$29
+	.byte	$3B
+	.byte	$C6
+	.byte	$01
+	.byte	$05
+	.byte	$0F
+	.byte	$77
+	.byte	$0D
+	.byte	$00
+	.byte	$0F
+	.byte	$A0
+	.byte	$01
+	.byte	$03
+	.byte	$0F
+	.byte	$CD
+	.byte	$0C
+	.byte	$0B
+	.byte	$0D
+	.byte	$56
+	.byte	$01
+	.byte	$0F
+	.byte	$FB
+	.byte	$0C
+	.byte	$01
+	.byte	$00
+	.byte	$4F
+	.byte	$04
+	.byte	$BF
+	.byte	$50
+	.byte	$72
+	.byte	$65
+	.byte	$66
+	.byte	$69
+	.byte	$78
+	.byte	$36
+	.byte	$34
+	.byte	$6B
+	.byte	$20
+	.byte	$28
+	.byte	$3B
+	.byte	$1B
+	.byte	$0D
+	.byte	$0F
+	.byte	$FB
+	.byte	$0C
+	.byte	$05
+	.byte	$05
+	.byte	$FE
+	.byte	$2A
+	.byte	$0F
+	.byte	$A6
+	.byte	$00
+	.byte	$10
+	.byte	$0A
+	.byte	$DD
+	.byte	$0C
+	.byte	$0F
+	.byte	$A6
+	.byte	$00
+	.byte	$0D
+	.byte	$01
+	.byte	$2E
+	.byte	$00
+	.byte	$0F
+	.byte	$A6
+	.byte	$00
+	.byte	$1C
+	.byte	$0D
+	.byte	$04
+	.byte	$0F
+	.byte	$0F
+	.byte	$EF
+	.byte	$42
+	.byte	$07
+	.byte	$90
+	.byte	$7D
+	.byte	$0A
+	.byte	$23
+	.byte	$65
+	.byte	$6E
+	.byte	$64
+	.byte	$69
+	.byte	$66
+	.byte	$0A
+
+.segment	"BSS"
+
+_buf:
+	.res	18830,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     pushl0
+	jsr     push0
+	jsr     _adler32
+	jsr     pusheax
+	lda     #<(_compressed)
+	ldx     #>(_compressed)
+	jsr     pushax
+	lda     #<(_buf)
+	ldx     #>(_buf)
+	jsr     pushax
+	ldx     #$49
+	lda     #$8E
+	jsr     _decompress_lz4
+	jsr     ldeax0sp
+	jsr     pusheax
+	lda     #<(_buf)
+	ldx     #>(_buf)
+	jsr     pushax
+	ldx     #$49
+	lda     #$8E
+	jsr     _adler32
+	jsr     steax0sp
+	jsr     ldeax0sp
+	jsr     pusheax
+	ldx     #$26
+	lda     #$48
+	sta     sreg
+	lda     #$F7
+	sta     sreg+1
+	lda     #$9D
+	jsr     toseqeax
+	beq     L0002
+	ldx     #$00
+	txa
+	jmp     L0001
+L0002:	ldx     #$00
+	lda     #$01
+L0001:	jmp     incsp4
+
+.endproc
+
@@ -0,0 +1,9510 @@
+;
+; File generated by cc65 v 2.19 - Git d694810
+;
+	.fopt		compiler,"cc65 v 2.19 - Git d694810"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"RODATA"
+
+_v8:
+	.byte	$00
+	.byte	$01
+	.byte	$02
+	.byte	$03
+	.byte	$07
+	.byte	$09
+	.byte	$0A
+	.byte	$0B
+	.byte	$63
+	.byte	$64
+	.byte	$7F
+	.byte	$80
+	.byte	$C7
+	.byte	$C8
+	.byte	$FE
+	.byte	$FF
+_v16:
+	.word	$0000
+	.word	$0001
+	.word	$0003
+	.word	$0009
+	.word	$000A
+	.word	$0063
+	.word	$0064
+	.word	$00FF
+	.word	$0100
+	.word	$03E7
+	.word	$03E8
+	.word	$0FFF
+	.word	$270F
+	.word	$3039
+	.word	$7FFF
+	.word	$8000
+	.word	$AAAA
+	.word	$D431
+	.word	$FFFE
+	.word	$FFFF
+_v32:
+	.dword	$00000000
+	.dword	$00000001
+	.dword	$00000009
+	.dword	$0000000A
+	.dword	$000000FF
+	.dword	$0000FFFF
+	.dword	$00010000
+	.dword	$000F423F
+	.dword	$000F4240
+	.dword	$0001517F
+	.dword	$00015180
+	.dword	$12345678
+	.dword	$7FFFFFFF
+	.dword	$80000000
+	.dword	$AAAAAAAA
+	.dword	$FFFFFFFE
+	.dword	$FFFFFFFF
+S00A5:
+	.byte	$66,$61,$69,$6C,$75,$72,$65,$73,$3A,$20,$25,$75,$0A,$00
+S0002:
+	.byte	$25,$73,$20,$25,$6C,$75,$20,$78,$3D,$25,$6C,$75,$0A,$00
+S00A0:
+	.byte	$6D,$75,$6C,$73,$33,$32,$00
+S009C	:=	S00A0+0
+S0098	:=	S00A0+0
+S0094	:=	S00A0+0
+S0090	:=	S00A0+0
+S008C	:=	S00A0+0
+S0088	:=	S00A0+0
+S0084:
+	.byte	$6D,$75,$6C,$73,$31,$36,$00
+S0080	:=	S0084+0
+S007C	:=	S0084+0
+S0078	:=	S0084+0
+S0074	:=	S0084+0
+S0070	:=	S0084+0
+S006C	:=	S0084+0
+S0068	:=	S0084+0
+S0064	:=	S0084+0
+S0060	:=	S0084+0
+S005C	:=	S0084+0
+S0058	:=	S0084+0
+S0054	:=	S0084+0
+S0050	:=	S0084+0
+S004C	:=	S0084+0
+S0048	:=	S0084+0
+S00A4	:=	S00A0+0
+S00A2:
+	.byte	$64,$69,$76,$33,$32,$00
+S001E:
+	.byte	$6D,$75,$6C,$38,$3D,$00
+S001F:
+	.byte	$64,$69,$76,$38,$3D,$00
+S0020:
+	.byte	$6D,$6F,$64,$38,$3D,$00
+S00A1:
+	.byte	$6D,$75,$6C,$33,$32,$00
+S009F:
+	.byte	$6D,$6F,$64,$33,$32,$00
+S009E	:=	S00A2+0
+S0024	:=	S001E+0
+S0025	:=	S001F+0
+S0026	:=	S0020+0
+S009D	:=	S00A1+0
+S0006	:=	S001E+0
+S009B	:=	S009F+0
+S002A	:=	S001E+0
+S002B	:=	S001F+0
+S002C	:=	S0020+0
+S009A	:=	S00A2+0
+S0099	:=	S00A1+0
+S0007	:=	S001F+0
+S0030	:=	S001E+0
+S0031	:=	S001F+0
+S0032	:=	S0020+0
+S0097	:=	S009F+0
+S0096	:=	S00A2+0
+S0095	:=	S00A1+0
+S0036	:=	S001E+0
+S0037	:=	S001F+0
+S0038	:=	S0020+0
+S0008	:=	S0020+0
+S0093	:=	S009F+0
+S0092	:=	S00A2+0
+S003C	:=	S001E+0
+S003D	:=	S001F+0
+S003E	:=	S0020+0
+S0091	:=	S00A1+0
+S008F	:=	S009F+0
+S008E	:=	S00A2+0
+S0042	:=	S001E+0
+S0043	:=	S001F+0
+S0044	:=	S0020+0
+S0045:
+	.byte	$6D,$75,$6C,$31,$36,$00
+S0046:
+	.byte	$64,$69,$76,$31,$36,$00
+S0047:
+	.byte	$6D,$6F,$64,$31,$36,$00
+S008D	:=	S00A1+0
+S0049	:=	S0045+0
+S004A	:=	S0046+0
+S004B	:=	S0047+0
+S001A	:=	S0020+0
+S004D	:=	S0045+0
+S004E	:=	S0046+0
+S004F	:=	S0047+0
+S0019	:=	S001F+0
+S0051	:=	S0045+0
+S0052	:=	S0046+0
+S0053	:=	S0047+0
+S0018	:=	S001E+0
+S0055	:=	S0045+0
+S0056	:=	S0046+0
+S0057	:=	S0047+0
+S008B	:=	S009F+0
+S0059	:=	S0045+0
+S005A	:=	S0046+0
+S005B	:=	S0047+0
+S008A	:=	S00A2+0
+S005D	:=	S0045+0
+S005E	:=	S0046+0
+S005F	:=	S0047+0
+S0089	:=	S00A1+0
+S0061	:=	S0045+0
+S0062	:=	S0046+0
+S0063	:=	S0047+0
+S0014	:=	S0020+0
+S0065	:=	S0045+0
+S0066	:=	S0046+0
+S0067	:=	S0047+0
+S0013	:=	S001F+0
+S0069	:=	S0045+0
+S006A	:=	S0046+0
+S006B	:=	S0047+0
+S0012	:=	S001E+0
+S006D	:=	S0045+0
+S006E	:=	S0046+0
+S006F	:=	S0047+0
+S0087	:=	S009F+0
+S0071	:=	S0045+0
+S0072	:=	S0046+0
+S0073	:=	S0047+0
+S0086	:=	S00A2+0
+S0075	:=	S0045+0
+S0076	:=	S0046+0
+S0077	:=	S0047+0
+S0085	:=	S00A1+0
+S0079	:=	S0045+0
+S007A	:=	S0046+0
+S007B	:=	S0047+0
+S000E	:=	S0020+0
+S007D	:=	S0045+0
+S007E	:=	S0046+0
+S007F	:=	S0047+0
+S000D	:=	S001F+0
+S0081	:=	S0045+0
+S0082	:=	S0046+0
+S0083	:=	S0047+0
+S000C	:=	S001E+0
+S00A3	:=	S009F+0
+S0010:
+	.byte	$64,$69,$76,$38,$00
+S0011:
+	.byte	$6D,$6F,$64,$38,$00
+S000B	:=	S0011+0
+S0015:
+	.byte	$6D,$75,$6C,$38,$00
+S0016	:=	S0010+0
+S0017	:=	S0011+0
+S000A	:=	S0010+0
+S001B	:=	S0015+0
+S0041	:=	S0011+0
+S0040	:=	S0010+0
+S0009	:=	S0015+0
+S003F	:=	S0015+0
+S003B	:=	S0011+0
+S003A	:=	S0010+0
+S0039	:=	S0015+0
+S0035	:=	S0011+0
+S0034	:=	S0010+0
+S0033	:=	S0015+0
+S002F	:=	S0011+0
+S002E	:=	S0010+0
+S002D	:=	S0015+0
+S0029	:=	S0011+0
+S0028	:=	S0010+0
+S0027	:=	S0015+0
+S0023	:=	S0011+0
+S0022	:=	S0010+0
+S0005	:=	S0011+0
+S0021	:=	S0015+0
+S001D	:=	S0011+0
+S000F	:=	S0015+0
+S001C	:=	S0010+0
+S0003	:=	S0015+0
+S0004	:=	S0010+0
+
+.segment	"BSS"
+
+_failures:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; void __near__ fail (const char *op, unsigned long c, unsigned long x)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fail: near
+
+.segment	"CODE"
+
+	jsr     pusheax
+	lda     #<(S0002)
+	ldx     #>(S0002)
+	jsr     pushax
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0C
+	jsr     _printf
+	inc     _failures
+	bne     L0002
+	inc     _failures+1
+L0002:	ldy     #$0A
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test8 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test8: near
+
+.segment	"CODE"
+
+	jsr     decsp1
+	lda     #$00
+	tay
+	jmp     L006A
+L006B:	lda     (sp),y
+	tay
+	lda     _v8,y
+	jsr     pusha
+	lda     #$03
+	jsr     pusha
+	ldy     #$01
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     mulax3
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosumula0
+	jsr     tosicmp0
+	beq     L000A
+	jsr     decsp6
+	lda     #<(S0003)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0003)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$03
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L000A:	ldy     #$02
+	lda     (sp),y
+	sta     tmp1
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosudiva0
+	jsr     tosicmp
+	beq     L000B
+	jsr     decsp6
+	lda     #<(S0004)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0004)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$03
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L000B:	ldy     #$02
+	lda     (sp),y
+	sta     tmp2
+	sta     tmp1
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	sta     tmp1
+	asl     a
+	clc
+	adc     tmp1
+	eor     #$FF
+	sec
+	adc     tmp2
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosumoda0
+	jsr     tosicmp
+	beq     L000C
+	jsr     decsp6
+	lda     #<(S0005)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0005)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$03
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L000C:	lda     (sp)
+	sta     tmp1
+	asl     a
+	clc
+	adc     tmp1
+	sta     (sp)
+	lda     (sp)
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosumula0
+	jsr     tosicmp0
+	beq     L000D
+	jsr     decsp6
+	lda     #<(S0006)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0006)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$03
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L000D:	ldy     #$02
+	lda     (sp),y
+	sta     (sp)
+	sta     tmp1
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	sta     (sp)
+	lda     (sp)
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosudiva0
+	jsr     tosicmp
+	beq     L000E
+	jsr     decsp6
+	lda     #<(S0007)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0007)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$03
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L000E:	ldy     #$02
+	lda     (sp),y
+	sta     (sp)
+	sta     tmp2
+	sta     tmp1
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	sta     tmp1
+	asl     a
+	clc
+	adc     tmp1
+	eor     #$FF
+	sec
+	adc     tmp2
+	sta     (sp)
+	lda     (sp)
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosumoda0
+	jsr     tosicmp
+	beq     L000F
+	jsr     decsp6
+	lda     #<(S0008)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0008)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$03
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L000F:	jsr     incsp2
+	lda     #$05
+	jsr     pusha
+	ldy     #$01
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     mulax5
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosumula0
+	jsr     tosicmp0
+	beq     L0013
+	jsr     decsp6
+	lda     #<(S0009)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0009)
+	sta     (sp),y
+	ldx     #$00
+	tya
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0013:	ldy     #$02
+	lda     (sp),y
+	sta     tmp1
+	lsr     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosudiva0
+	jsr     tosicmp
+	beq     L0014
+	jsr     decsp6
+	lda     #<(S000A)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S000A)
+	sta     (sp),y
+	ldx     #$00
+	tya
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0014:	ldy     #$02
+	lda     (sp),y
+	sta     tmp2
+	sta     tmp1
+	lsr     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	sta     tmp1
+	asl     a
+	asl     a
+	clc
+	adc     tmp1
+	eor     #$FF
+	sec
+	adc     tmp2
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosumoda0
+	jsr     tosicmp
+	beq     L0015
+	jsr     decsp6
+	lda     #<(S000B)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S000B)
+	sta     (sp),y
+	ldx     #$00
+	tya
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0015:	lda     (sp)
+	sta     tmp1
+	asl     a
+	asl     a
+	clc
+	adc     tmp1
+	sta     (sp)
+	lda     (sp)
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosumula0
+	jsr     tosicmp0
+	beq     L0016
+	jsr     decsp6
+	lda     #<(S000C)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S000C)
+	sta     (sp),y
+	ldx     #$00
+	tya
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0016:	ldy     #$02
+	lda     (sp),y
+	sta     (sp)
+	sta     tmp1
+	lsr     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	sta     (sp)
+	lda     (sp)
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosudiva0
+	jsr     tosicmp
+	beq     L0017
+	jsr     decsp6
+	lda     #<(S000D)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S000D)
+	sta     (sp),y
+	ldx     #$00
+	tya
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0017:	ldy     #$02
+	lda     (sp),y
+	sta     (sp)
+	sta     tmp2
+	sta     tmp1
+	lsr     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	sta     tmp1
+	asl     a
+	asl     a
+	clc
+	adc     tmp1
+	eor     #$FF
+	sec
+	adc     tmp2
+	sta     (sp)
+	lda     (sp)
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosumoda0
+	jsr     tosicmp
+	beq     L0018
+	jsr     decsp6
+	lda     #<(S000E)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S000E)
+	sta     (sp),y
+	ldx     #$00
+	tya
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0018:	jsr     incsp2
+	lda     #$06
+	jsr     pusha
+	ldy     #$01
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     mulax6
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosumula0
+	jsr     tosicmp0
+	beq     L001C
+	jsr     decsp6
+	lda     #<(S000F)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S000F)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$06
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L001C:	ldy     #$02
+	lda     (sp),y
+	sta     tmp1
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosudiva0
+	jsr     tosicmp
+	beq     L001D
+	jsr     decsp6
+	lda     #<(S0010)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0010)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$06
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L001D:	ldy     #$02
+	lda     (sp),y
+	sta     tmp2
+	sta     tmp1
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	sta     tmp1
+	asl     a
+	clc
+	adc     tmp1
+	asl     a
+	eor     #$FF
+	sec
+	adc     tmp2
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosumoda0
+	jsr     tosicmp
+	beq     L001E
+	jsr     decsp6
+	lda     #<(S0011)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0011)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$06
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L001E:	lda     (sp)
+	sta     tmp1
+	asl     a
+	clc
+	adc     tmp1
+	asl     a
+	sta     (sp)
+	lda     (sp)
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosumula0
+	jsr     tosicmp0
+	beq     L001F
+	jsr     decsp6
+	lda     #<(S0012)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0012)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$06
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L001F:	ldy     #$02
+	lda     (sp),y
+	sta     (sp)
+	sta     tmp1
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	sta     (sp)
+	lda     (sp)
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosudiva0
+	jsr     tosicmp
+	beq     L0020
+	jsr     decsp6
+	lda     #<(S0013)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0013)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$06
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0020:	ldy     #$02
+	lda     (sp),y
+	sta     (sp)
+	sta     tmp2
+	sta     tmp1
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	sta     tmp1
+	asl     a
+	clc
+	adc     tmp1
+	asl     a
+	eor     #$FF
+	sec
+	adc     tmp2
+	sta     (sp)
+	lda     (sp)
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosumoda0
+	jsr     tosicmp
+	beq     L0021
+	jsr     decsp6
+	lda     #<(S0014)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0014)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$06
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0021:	jsr     incsp2
+	lda     #$07
+	jsr     pusha
+	ldy     #$01
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     mulax7
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosumula0
+	jsr     tosicmp0
+	beq     L0025
+	jsr     decsp6
+	lda     #<(S0015)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0015)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$07
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0025:	ldy     #$02
+	lda     (sp),y
+	sta     tmp1
+	lsr     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosudiva0
+	jsr     tosicmp
+	beq     L0026
+	jsr     decsp6
+	lda     #<(S0016)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0016)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$07
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0026:	ldy     #$02
+	lda     (sp),y
+	sta     tmp2
+	sta     tmp1
+	lsr     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	sta     tmp1
+	asl     a
+	asl     a
+	asl     a
+	sec
+	sbc     tmp1
+	eor     #$FF
+	sec
+	adc     tmp2
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosumoda0
+	jsr     tosicmp
+	beq     L0027
+	jsr     decsp6
+	lda     #<(S0017)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0017)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$07
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0027:	lda     (sp)
+	sta     tmp1
+	asl     a
+	asl     a
+	asl     a
+	sec
+	sbc     tmp1
+	sta     (sp)
+	lda     (sp)
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosumula0
+	jsr     tosicmp0
+	beq     L0028
+	jsr     decsp6
+	lda     #<(S0018)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0018)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$07
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0028:	ldy     #$02
+	lda     (sp),y
+	sta     (sp)
+	sta     tmp1
+	lsr     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	sta     (sp)
+	lda     (sp)
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosudiva0
+	jsr     tosicmp
+	beq     L0029
+	jsr     decsp6
+	lda     #<(S0019)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0019)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$07
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0029:	ldy     #$02
+	lda     (sp),y
+	sta     (sp)
+	sta     tmp2
+	sta     tmp1
+	lsr     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	sta     tmp1
+	asl     a
+	asl     a
+	asl     a
+	sec
+	sbc     tmp1
+	eor     #$FF
+	sec
+	adc     tmp2
+	sta     (sp)
+	lda     (sp)
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosumoda0
+	jsr     tosicmp
+	beq     L002A
+	jsr     decsp6
+	lda     #<(S001A)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S001A)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$07
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L002A:	jsr     incsp2
+	lda     #$0A
+	jsr     pusha
+	ldy     #$01
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     mulax10
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosumula0
+	jsr     tosicmp0
+	beq     L002E
+	jsr     decsp6
+	lda     #<(S001B)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S001B)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$0A
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L002E:	ldy     #$02
+	lda     (sp),y
+	sta     tmp1
+	lsr     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	lsr     a
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosudiva0
+	jsr     tosicmp
+	beq     L002F
+	jsr     decsp6
+	lda     #<(S001C)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S001C)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$0A
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L002F:	ldy     #$02
+	lda     (sp),y
+	sta     tmp2
+	sta     tmp1
+	lsr     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	lsr     a
+	sta     tmp1
+	asl     a
+	asl     a
+	clc
+	adc     tmp1
+	asl     a
+	eor     #$FF
+	sec
+	adc     tmp2
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosumoda0
+	jsr     tosicmp
+	beq     L0030
+	jsr     decsp6
+	lda     #<(S001D)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S001D)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$0A
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0030:	lda     (sp)
+	sta     tmp1
+	asl     a
+	asl     a
+	clc
+	adc     tmp1
+	asl     a
+	sta     (sp)
+	lda     (sp)
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosumula0
+	jsr     tosicmp0
+	beq     L0031
+	jsr     decsp6
+	lda     #<(S001E)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S001E)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$0A
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0031:	ldy     #$02
+	lda     (sp),y
+	sta     (sp)
+	sta     tmp1
+	lsr     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	lsr     a
+	sta     (sp)
+	lda     (sp)
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosudiva0
+	jsr     tosicmp
+	beq     L0032
+	jsr     decsp6
+	lda     #<(S001F)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S001F)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$0A
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0032:	ldy     #$02
+	lda     (sp),y
+	sta     (sp)
+	sta     tmp2
+	sta     tmp1
+	lsr     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	lsr     a
+	sta     tmp1
+	asl     a
+	asl     a
+	clc
+	adc     tmp1
+	asl     a
+	eor     #$FF
+	sec
+	adc     tmp2
+	sta     (sp)
+	lda     (sp)
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosumoda0
+	jsr     tosicmp
+	beq     L0033
+	jsr     decsp6
+	lda     #<(S0020)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0020)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$0A
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0033:	jsr     incsp2
+	lda     #$0D
+	jsr     pusha
+	ldy     #$01
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$02
+	lda     (sp),y
+	sta     ptr1
+	stz     ptr1+1
+	stz     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	tya
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosumula0
+	jsr     tosicmp0
+	beq     L0037
+	jsr     decsp6
+	lda     #<(S0021)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0021)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$0D
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0037:	ldy     #$02
+	lda     (sp),y
+	sta     tmp1
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	clc
+	adc     tmp1
+	ror     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	lsr     a
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosudiva0
+	jsr     tosicmp
+	beq     L0038
+	jsr     decsp6
+	lda     #<(S0022)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0022)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$0D
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0038:	ldy     #$02
+	lda     (sp),y
+	sta     tmp2
+	sta     tmp1
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	clc
+	adc     tmp1
+	ror     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	lsr     a
+	sta     tmp1
+	asl     a
+	clc
+	adc     tmp1
+	asl     a
+	asl     a
+	clc
+	adc     tmp1
+	eor     #$FF
+	sec
+	adc     tmp2
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosumoda0
+	jsr     tosicmp
+	beq     L0039
+	jsr     decsp6
+	lda     #<(S0023)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0023)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$0D
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0039:	lda     (sp)
+	sta     tmp1
+	asl     a
+	clc
+	adc     tmp1
+	asl     a
+	asl     a
+	clc
+	adc     tmp1
+	sta     (sp)
+	lda     (sp)
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosumula0
+	jsr     tosicmp0
+	beq     L003A
+	jsr     decsp6
+	lda     #<(S0024)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0024)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$0D
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L003A:	ldy     #$02
+	lda     (sp),y
+	sta     (sp)
+	sta     tmp1
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	clc
+	adc     tmp1
+	ror     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	lsr     a
+	sta     (sp)
+	lda     (sp)
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosudiva0
+	jsr     tosicmp
+	beq     L003B
+	jsr     decsp6
+	lda     #<(S0025)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0025)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$0D
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L003B:	ldy     #$02
+	lda     (sp),y
+	sta     (sp)
+	sta     tmp2
+	sta     tmp1
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	clc
+	adc     tmp1
+	ror     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	lsr     a
+	sta     tmp1
+	asl     a
+	clc
+	adc     tmp1
+	asl     a
+	asl     a
+	clc
+	adc     tmp1
+	eor     #$FF
+	sec
+	adc     tmp2
+	sta     (sp)
+	lda     (sp)
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosumoda0
+	jsr     tosicmp
+	beq     L003C
+	jsr     decsp6
+	lda     #<(S0026)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0026)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$0D
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L003C:	jsr     incsp2
+	lda     #$19
+	jsr     pusha
+	ldy     #$01
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$02
+	lda     (sp),y
+	sta     ptr1
+	stz     ptr1+1
+	stz     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	tya
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosumula0
+	jsr     tosicmp0
+	beq     L0040
+	jsr     decsp6
+	lda     #<(S0027)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0027)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$19
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0040:	ldy     #$02
+	lda     (sp),y
+	sta     tmp1
+	lsr     a
+	lsr     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosudiva0
+	jsr     tosicmp
+	beq     L0041
+	jsr     decsp6
+	lda     #<(S0028)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0028)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$19
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0041:	ldy     #$02
+	lda     (sp),y
+	sta     tmp2
+	sta     tmp1
+	lsr     a
+	lsr     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	sta     tmp1
+	asl     a
+	clc
+	adc     tmp1
+	asl     a
+	asl     a
+	asl     a
+	clc
+	adc     tmp1
+	eor     #$FF
+	sec
+	adc     tmp2
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosumoda0
+	jsr     tosicmp
+	beq     L0042
+	jsr     decsp6
+	lda     #<(S0029)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0029)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$19
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0042:	lda     (sp)
+	sta     tmp1
+	asl     a
+	clc
+	adc     tmp1
+	asl     a
+	asl     a
+	asl     a
+	clc
+	adc     tmp1
+	sta     (sp)
+	lda     (sp)
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosumula0
+	jsr     tosicmp0
+	beq     L0043
+	jsr     decsp6
+	lda     #<(S002A)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S002A)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$19
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0043:	ldy     #$02
+	lda     (sp),y
+	sta     (sp)
+	sta     tmp1
+	lsr     a
+	lsr     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	sta     (sp)
+	lda     (sp)
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosudiva0
+	jsr     tosicmp
+	beq     L0044
+	jsr     decsp6
+	lda     #<(S002B)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S002B)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$19
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0044:	ldy     #$02
+	lda     (sp),y
+	sta     (sp)
+	sta     tmp2
+	sta     tmp1
+	lsr     a
+	lsr     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	sta     tmp1
+	asl     a
+	clc
+	adc     tmp1
+	asl     a
+	asl     a
+	asl     a
+	clc
+	adc     tmp1
+	eor     #$FF
+	sec
+	adc     tmp2
+	sta     (sp)
+	lda     (sp)
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosumoda0
+	jsr     tosicmp
+	beq     L0045
+	jsr     decsp6
+	lda     #<(S002C)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S002C)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$19
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0045:	jsr     incsp2
+	lda     #$64
+	jsr     pusha
+	ldy     #$01
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$02
+	lda     (sp),y
+	sta     ptr1
+	stz     ptr1+1
+	stz     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosumula0
+	jsr     tosicmp0
+	beq     L0049
+	jsr     decsp6
+	lda     #<(S002D)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S002D)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$64
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0049:	ldy     #$02
+	lda     (sp),y
+	sta     tmp1
+	lsr     a
+	lsr     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosudiva0
+	jsr     tosicmp
+	beq     L004A
+	jsr     decsp6
+	lda     #<(S002E)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S002E)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$64
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L004A:	ldy     #$02
+	lda     (sp),y
+	sta     tmp2
+	sta     tmp1
+	lsr     a
+	lsr     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	sta     tmp1
+	asl     a
+	clc
+	adc     tmp1
+	asl     a
+	asl     a
+	asl     a
+	clc
+	adc     tmp1
+	asl     a
+	asl     a
+	eor     #$FF
+	sec
+	adc     tmp2
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosumoda0
+	jsr     tosicmp
+	beq     L004B
+	jsr     decsp6
+	lda     #<(S002F)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S002F)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$64
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L004B:	lda     (sp)
+	sta     tmp1
+	asl     a
+	clc
+	adc     tmp1
+	asl     a
+	asl     a
+	asl     a
+	clc
+	adc     tmp1
+	asl     a
+	asl     a
+	sta     (sp)
+	lda     (sp)
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosumula0
+	jsr     tosicmp0
+	beq     L004C
+	jsr     decsp6
+	lda     #<(S0030)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0030)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$64
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L004C:	ldy     #$02
+	lda     (sp),y
+	sta     (sp)
+	sta     tmp1
+	lsr     a
+	lsr     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	sta     (sp)
+	lda     (sp)
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosudiva0
+	jsr     tosicmp
+	beq     L004D
+	jsr     decsp6
+	lda     #<(S0031)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0031)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$64
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L004D:	ldy     #$02
+	lda     (sp),y
+	sta     (sp)
+	sta     tmp2
+	sta     tmp1
+	lsr     a
+	lsr     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	sta     tmp1
+	asl     a
+	clc
+	adc     tmp1
+	asl     a
+	asl     a
+	asl     a
+	clc
+	adc     tmp1
+	asl     a
+	asl     a
+	eor     #$FF
+	sec
+	adc     tmp2
+	sta     (sp)
+	lda     (sp)
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosumoda0
+	jsr     tosicmp
+	beq     L004E
+	jsr     decsp6
+	lda     #<(S0032)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0032)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$64
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L004E:	jsr     incsp2
+	lda     #$81
+	jsr     pusha
+	ldy     #$01
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$02
+	lda     (sp),y
+	sta     ptr1
+	stz     ptr1+1
+	stz     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	tya
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosumula0
+	jsr     tosicmp0
+	beq     L0052
+	jsr     decsp6
+	lda     #<(S0033)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0033)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$81
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0052:	ldy     #$02
+	lda     (sp),y
+	sta     tmp1
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	clc
+	adc     tmp1
+	ror     a
+	clc
+	adc     tmp1
+	ror     a
+	clc
+	adc     tmp1
+	ror     a
+	clc
+	adc     tmp1
+	ror     a
+	clc
+	adc     tmp1
+	ror     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosudiva0
+	jsr     tosicmp
+	beq     L0053
+	jsr     decsp6
+	lda     #<(S0034)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0034)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$81
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0053:	ldy     #$02
+	lda     (sp),y
+	sta     tmp2
+	sta     tmp1
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	clc
+	adc     tmp1
+	ror     a
+	clc
+	adc     tmp1
+	ror     a
+	clc
+	adc     tmp1
+	ror     a
+	clc
+	adc     tmp1
+	ror     a
+	clc
+	adc     tmp1
+	ror     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	sta     tmp1
+	asl     a
+	asl     a
+	asl     a
+	asl     a
+	asl     a
+	asl     a
+	asl     a
+	clc
+	adc     tmp1
+	eor     #$FF
+	sec
+	adc     tmp2
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosumoda0
+	jsr     tosicmp
+	beq     L0054
+	jsr     decsp6
+	lda     #<(S0035)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0035)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$81
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0054:	lda     (sp)
+	sta     tmp1
+	asl     a
+	asl     a
+	asl     a
+	asl     a
+	asl     a
+	asl     a
+	asl     a
+	clc
+	adc     tmp1
+	sta     (sp)
+	lda     (sp)
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosumula0
+	jsr     tosicmp0
+	beq     L0055
+	jsr     decsp6
+	lda     #<(S0036)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0036)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$81
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0055:	ldy     #$02
+	lda     (sp),y
+	sta     (sp)
+	sta     tmp1
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	clc
+	adc     tmp1
+	ror     a
+	clc
+	adc     tmp1
+	ror     a
+	clc
+	adc     tmp1
+	ror     a
+	clc
+	adc     tmp1
+	ror     a
+	clc
+	adc     tmp1
+	ror     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	sta     (sp)
+	lda     (sp)
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosudiva0
+	jsr     tosicmp
+	beq     L0056
+	jsr     decsp6
+	lda     #<(S0037)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0037)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$81
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0056:	ldy     #$02
+	lda     (sp),y
+	sta     (sp)
+	sta     tmp2
+	sta     tmp1
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	clc
+	adc     tmp1
+	ror     a
+	clc
+	adc     tmp1
+	ror     a
+	clc
+	adc     tmp1
+	ror     a
+	clc
+	adc     tmp1
+	ror     a
+	clc
+	adc     tmp1
+	ror     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	sta     tmp1
+	asl     a
+	asl     a
+	asl     a
+	asl     a
+	asl     a
+	asl     a
+	asl     a
+	clc
+	adc     tmp1
+	eor     #$FF
+	sec
+	adc     tmp2
+	sta     (sp)
+	lda     (sp)
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosumoda0
+	jsr     tosicmp
+	beq     L0057
+	jsr     decsp6
+	lda     #<(S0038)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0038)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$81
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0057:	jsr     incsp2
+	lda     #$C8
+	jsr     pusha
+	ldy     #$01
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$02
+	lda     (sp),y
+	sta     ptr1
+	stz     ptr1+1
+	stz     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosumula0
+	jsr     tosicmp0
+	beq     L005B
+	jsr     decsp6
+	lda     #<(S0039)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0039)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$C8
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L005B:	ldy     #$02
+	lda     (sp),y
+	sta     tmp1
+	lsr     a
+	lsr     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosudiva0
+	jsr     tosicmp
+	beq     L005C
+	jsr     decsp6
+	lda     #<(S003A)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S003A)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$C8
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L005C:	ldy     #$02
+	lda     (sp),y
+	sta     tmp2
+	sta     tmp1
+	lsr     a
+	lsr     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	sta     tmp1
+	asl     a
+	clc
+	adc     tmp1
+	asl     a
+	asl     a
+	asl     a
+	clc
+	adc     tmp1
+	asl     a
+	asl     a
+	asl     a
+	eor     #$FF
+	sec
+	adc     tmp2
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosumoda0
+	jsr     tosicmp
+	beq     L005D
+	jsr     decsp6
+	lda     #<(S003B)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S003B)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$C8
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L005D:	lda     (sp)
+	sta     tmp1
+	asl     a
+	asl     a
+	asl     a
+	sec
+	sbc     tmp1
+	asl     a
+	asl     a
+	asl     a
+	eor     #$FF
+	clc
+	adc     #$01
+	sta     (sp)
+	lda     (sp)
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosumula0
+	jsr     tosicmp0
+	beq     L005E
+	jsr     decsp6
+	lda     #<(S003C)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S003C)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$C8
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L005E:	ldy     #$02
+	lda     (sp),y
+	sta     (sp)
+	sta     tmp1
+	lsr     a
+	lsr     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	sta     (sp)
+	lda     (sp)
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosudiva0
+	jsr     tosicmp
+	beq     L005F
+	jsr     decsp6
+	lda     #<(S003D)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S003D)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$C8
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L005F:	ldy     #$02
+	lda     (sp),y
+	sta     (sp)
+	sta     tmp2
+	sta     tmp1
+	lsr     a
+	lsr     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	sta     tmp1
+	asl     a
+	clc
+	adc     tmp1
+	asl     a
+	asl     a
+	asl     a
+	clc
+	adc     tmp1
+	asl     a
+	asl     a
+	asl     a
+	eor     #$FF
+	sec
+	adc     tmp2
+	sta     (sp)
+	lda     (sp)
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosumoda0
+	jsr     tosicmp
+	beq     L0060
+	jsr     decsp6
+	lda     #<(S003E)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S003E)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$C8
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0060:	jsr     incsp2
+	lda     #$FF
+	jsr     pusha
+	ldy     #$01
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$02
+	lda     (sp),y
+	sta     ptr1
+	stz     ptr1+1
+	sta     tmp1
+	lda     #$00
+	sec
+	sbc     ptr1
+	tay
+	lda     tmp1
+	sbc     ptr1+1
+	tya
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosumula0
+	jsr     tosicmp0
+	beq     L0064
+	jsr     decsp6
+	lda     #<(S003F)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S003F)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$FF
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0064:	ldy     #$02
+	lda     (sp),y
+	sta     tmp1
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosudiva0
+	jsr     tosicmp
+	beq     L0065
+	jsr     decsp6
+	lda     #<(S0040)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0040)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$FF
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0065:	ldy     #$02
+	lda     (sp),y
+	sta     tmp2
+	sta     tmp1
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	sta     tmp1
+	asl     a
+	clc
+	adc     tmp1
+	asl     a
+	clc
+	adc     tmp1
+	asl     a
+	clc
+	adc     tmp1
+	asl     a
+	clc
+	adc     tmp1
+	asl     a
+	clc
+	adc     tmp1
+	asl     a
+	clc
+	adc     tmp1
+	asl     a
+	clc
+	adc     tmp1
+	eor     #$FF
+	sec
+	adc     tmp2
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosumoda0
+	jsr     tosicmp
+	beq     L0066
+	jsr     decsp6
+	lda     #<(S0041)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0041)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$FF
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0066:	lda     (sp)
+	eor     #$FF
+	clc
+	adc     #$01
+	sta     (sp)
+	lda     (sp)
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosumula0
+	jsr     tosicmp0
+	beq     L0067
+	jsr     decsp6
+	lda     #<(S0042)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0042)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$FF
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0067:	ldy     #$02
+	lda     (sp),y
+	sta     (sp)
+	sta     tmp1
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	sta     (sp)
+	lda     (sp)
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosudiva0
+	jsr     tosicmp
+	beq     L0068
+	jsr     decsp6
+	lda     #<(S0043)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0043)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$FF
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0068:	ldy     #$02
+	lda     (sp),y
+	sta     (sp)
+	sta     tmp2
+	sta     tmp1
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	clc
+	adc     tmp1
+	ror     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	lsr     a
+	sta     tmp1
+	asl     a
+	clc
+	adc     tmp1
+	asl     a
+	clc
+	adc     tmp1
+	asl     a
+	clc
+	adc     tmp1
+	asl     a
+	clc
+	adc     tmp1
+	asl     a
+	clc
+	adc     tmp1
+	asl     a
+	clc
+	adc     tmp1
+	asl     a
+	clc
+	adc     tmp1
+	eor     #$FF
+	sec
+	adc     tmp2
+	sta     (sp)
+	lda     (sp)
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	jsr     tosumoda0
+	jsr     tosicmp
+	beq     L0069
+	jsr     decsp6
+	lda     #<(S0044)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0044)
+	sta     (sp),y
+	ldx     #$00
+	lda     #$FF
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$08
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0069:	jsr     incsp2
+	jsr     incsp1
+	ldy     #$00
+	clc
+	lda     #$01
+	adc     (sp)
+L006A:	sta     (sp)
+	cmp     #$10
+	jcc     L006B
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test16 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test16: near
+
+.segment	"CODE"
+
+	jsr     decsp1
+	lda     #$00
+	tay
+	jmp     L0077
+L007A:	lda     (sp),y
+	asl     a
+	bcc     L0078
+	ldx     #$01
+	clc
+L0078:	adc     #<(_v16)
+	sta     ptr1
+	txa
+	adc     #>(_v16)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	jsr     pushax
+	lda     #$03
+	jsr     pusha0
+	tay
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     mulax3
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumulax
+	jsr     tosicmp
+	beq     L0009
+	jsr     decsp6
+	lda     #<(S0045)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0045)
+	sta     (sp),y
+	lda     #$03
+	sta     (sp)
+	lda     #$00
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0009:	ldy     #$05
+	jsr     pushwysp
+	lda     #$03
+	jsr     tosudiva0
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosudivax
+	jsr     tosicmp
+	beq     L000A
+	jsr     decsp6
+	lda     #<(S0046)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0046)
+	sta     (sp),y
+	lda     #$03
+	sta     (sp)
+	lda     #$00
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L000A:	ldy     #$05
+	jsr     pushwysp
+	lda     #$03
+	jsr     tosumoda0
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumodax
+	jsr     tosicmp
+	beq     L000B
+	jsr     decsp6
+	lda     #<(S0047)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0047)
+	sta     (sp),y
+	lda     #$03
+	sta     (sp)
+	lda     #$00
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L000B:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	sta     ptr1
+	stx     ptr1+1
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	ldx     tmp1
+	jsr     negax
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     negax
+	jsr     tosmulax
+	jsr     tosicmp
+	beq     L000C
+	jsr     decsp6
+	lda     #<(S0048)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0048)
+	sta     (sp),y
+	lda     #$03
+	sta     (sp)
+	lda     #$00
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L000C:	jsr     incsp2
+	lda     #$07
+	jsr     pusha0
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     mulax7
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumulax
+	jsr     tosicmp
+	beq     L0010
+	jsr     decsp6
+	lda     #<(S0049)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0049)
+	sta     (sp),y
+	lda     #$07
+	sta     (sp)
+	lda     #$00
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0010:	ldy     #$05
+	jsr     pushwysp
+	lda     #$07
+	jsr     tosudiva0
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosudivax
+	jsr     tosicmp
+	beq     L0011
+	jsr     decsp6
+	lda     #<(S004A)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S004A)
+	sta     (sp),y
+	lda     #$07
+	sta     (sp)
+	lda     #$00
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0011:	ldy     #$05
+	jsr     pushwysp
+	lda     #$07
+	jsr     tosumoda0
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumodax
+	jsr     tosicmp
+	beq     L0012
+	jsr     decsp6
+	lda     #<(S004B)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S004B)
+	sta     (sp),y
+	lda     #$07
+	sta     (sp)
+	lda     #$00
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0012:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	sta     ptr1
+	stx     ptr1+1
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	sec
+	sbc     ptr1
+	tay
+	lda     tmp1
+	sbc     ptr1+1
+	sta     tmp1
+	tya
+	ldx     tmp1
+	jsr     negax
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     negax
+	jsr     tosmulax
+	jsr     tosicmp
+	beq     L0013
+	jsr     decsp6
+	lda     #<(S004C)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S004C)
+	sta     (sp),y
+	lda     #$07
+	sta     (sp)
+	lda     #$00
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0013:	jsr     incsp2
+	lda     #$0A
+	jsr     pusha0
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     mulax10
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumulax
+	jsr     tosicmp
+	beq     L0017
+	jsr     decsp6
+	lda     #<(S004D)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S004D)
+	sta     (sp),y
+	lda     #$0A
+	sta     (sp)
+	lda     #$00
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0017:	ldy     #$05
+	jsr     pushwysp
+	lda     #$0A
+	jsr     tosudiva0
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosudivax
+	jsr     tosicmp
+	beq     L0018
+	jsr     decsp6
+	lda     #<(S004E)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S004E)
+	sta     (sp),y
+	lda     #$0A
+	sta     (sp)
+	lda     #$00
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0018:	ldy     #$05
+	jsr     pushwysp
+	lda     #$0A
+	jsr     tosumoda0
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumodax
+	jsr     tosicmp
+	beq     L0019
+	jsr     decsp6
+	lda     #<(S004F)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S004F)
+	sta     (sp),y
+	lda     #$0A
+	sta     (sp)
+	lda     #$00
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0019:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	sta     ptr1
+	stx     ptr1+1
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	ldx     tmp1
+	jsr     negax
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     negax
+	jsr     tosmulax
+	jsr     tosicmp
+	beq     L001A
+	jsr     decsp6
+	lda     #<(S0050)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0050)
+	sta     (sp),y
+	lda     #$0A
+	sta     (sp)
+	lda     #$00
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L001A:	jsr     incsp2
+	lda     #$0B
+	jsr     pusha0
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	sta     ptr1
+	stx     ptr1+1
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	ldx     tmp1
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumulax
+	jsr     tosicmp
+	beq     L001E
+	jsr     decsp6
+	lda     #<(S0051)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0051)
+	sta     (sp),y
+	lda     #$0B
+	sta     (sp)
+	lda     #$00
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L001E:	ldy     #$05
+	jsr     pushwysp
+	lda     #$0B
+	jsr     tosudiva0
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosudivax
+	jsr     tosicmp
+	beq     L001F
+	jsr     decsp6
+	lda     #<(S0052)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0052)
+	sta     (sp),y
+	lda     #$0B
+	sta     (sp)
+	lda     #$00
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L001F:	ldy     #$05
+	jsr     pushwysp
+	lda     #$0B
+	jsr     tosumoda0
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumodax
+	jsr     tosicmp
+	beq     L0020
+	jsr     decsp6
+	lda     #<(S0053)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0053)
+	sta     (sp),y
+	lda     #$0B
+	sta     (sp)
+	lda     #$00
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0020:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	sta     ptr1
+	stx     ptr1+1
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	ldx     tmp1
+	jsr     negax
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     negax
+	jsr     tosmulax
+	jsr     tosicmp
+	beq     L0021
+	jsr     decsp6
+	lda     #<(S0054)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0054)
+	sta     (sp),y
+	lda     #$0B
+	sta     (sp)
+	lda     #$00
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0021:	jsr     incsp2
+	lda     #$0C
+	jsr     pusha0
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	sta     ptr1
+	stx     ptr1+1
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	ldx     tmp1
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumulax
+	jsr     tosicmp
+	beq     L0025
+	jsr     decsp6
+	lda     #<(S0055)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0055)
+	sta     (sp),y
+	lda     #$0C
+	sta     (sp)
+	lda     #$00
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0025:	ldy     #$05
+	jsr     pushwysp
+	lda     #$0C
+	jsr     tosudiva0
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosudivax
+	jsr     tosicmp
+	beq     L0026
+	jsr     decsp6
+	lda     #<(S0056)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0056)
+	sta     (sp),y
+	lda     #$0C
+	sta     (sp)
+	lda     #$00
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0026:	ldy     #$05
+	jsr     pushwysp
+	lda     #$0C
+	jsr     tosumoda0
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumodax
+	jsr     tosicmp
+	beq     L0027
+	jsr     decsp6
+	lda     #<(S0057)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0057)
+	sta     (sp),y
+	lda     #$0C
+	sta     (sp)
+	lda     #$00
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0027:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	sta     ptr1
+	stx     ptr1+1
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	ldx     tmp1
+	jsr     negax
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     negax
+	jsr     tosmulax
+	jsr     tosicmp
+	beq     L0028
+	jsr     decsp6
+	lda     #<(S0058)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0058)
+	sta     (sp),y
+	lda     #$0C
+	sta     (sp)
+	lda     #$00
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0028:	jsr     incsp2
+	lda     #$3C
+	jsr     pusha0
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	sta     ptr1
+	stx     ptr1+1
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	sec
+	sbc     ptr1
+	tay
+	lda     tmp1
+	sbc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	ldx     tmp1
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumulax
+	jsr     tosicmp
+	beq     L002C
+	jsr     decsp6
+	lda     #<(S0059)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0059)
+	sta     (sp),y
+	lda     #$3C
+	sta     (sp)
+	lda     #$00
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L002C:	ldy     #$05
+	jsr     pushwysp
+	lda     #$3C
+	jsr     tosudiva0
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosudivax
+	jsr     tosicmp
+	beq     L002D
+	jsr     decsp6
+	lda     #<(S005A)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S005A)
+	sta     (sp),y
+	lda     #$3C
+	sta     (sp)
+	lda     #$00
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L002D:	ldy     #$05
+	jsr     pushwysp
+	lda     #$3C
+	jsr     tosumoda0
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumodax
+	jsr     tosicmp
+	beq     L002E
+	jsr     decsp6
+	lda     #<(S005B)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S005B)
+	sta     (sp),y
+	lda     #$3C
+	sta     (sp)
+	lda     #$00
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L002E:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	sta     ptr1
+	stx     ptr1+1
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	sec
+	sbc     ptr1
+	tay
+	lda     tmp1
+	sbc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	ldx     tmp1
+	jsr     negax
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     negax
+	jsr     tosmulax
+	jsr     tosicmp
+	beq     L002F
+	jsr     decsp6
+	lda     #<(S005C)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S005C)
+	sta     (sp),y
+	lda     #$3C
+	sta     (sp)
+	lda     #$00
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L002F:	jsr     incsp2
+	lda     #$64
+	jsr     pusha0
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	sta     ptr1
+	stx     ptr1+1
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	ldx     tmp1
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumulax
+	jsr     tosicmp
+	beq     L0033
+	jsr     decsp6
+	lda     #<(S005D)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S005D)
+	sta     (sp),y
+	lda     #$64
+	sta     (sp)
+	lda     #$00
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0033:	ldy     #$05
+	jsr     pushwysp
+	lda     #$64
+	jsr     tosudiva0
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosudivax
+	jsr     tosicmp
+	beq     L0034
+	jsr     decsp6
+	lda     #<(S005E)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S005E)
+	sta     (sp),y
+	lda     #$64
+	sta     (sp)
+	lda     #$00
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0034:	ldy     #$05
+	jsr     pushwysp
+	lda     #$64
+	jsr     tosumoda0
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumodax
+	jsr     tosicmp
+	beq     L0035
+	jsr     decsp6
+	lda     #<(S005F)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S005F)
+	sta     (sp),y
+	lda     #$64
+	sta     (sp)
+	lda     #$00
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0035:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	sta     ptr1
+	stx     ptr1+1
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	ldx     tmp1
+	jsr     negax
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     negax
+	jsr     tosmulax
+	jsr     tosicmp
+	beq     L0036
+	jsr     decsp6
+	lda     #<(S0060)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0060)
+	sta     (sp),y
+	lda     #$64
+	sta     (sp)
+	lda     #$00
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0036:	jsr     incsp2
+	lda     #$FF
+	jsr     pusha0
+	ldy     #$03
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	sta     tmp1
+	lda     #$00
+	sec
+	sbc     ptr1
+	tay
+	lda     tmp1
+	sbc     ptr1+1
+	sta     tmp1
+	tya
+	ldx     tmp1
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumulax
+	jsr     tosicmp
+	beq     L003A
+	jsr     decsp6
+	lda     #<(S0061)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0061)
+	sta     (sp),y
+	lda     #$FF
+	sta     (sp)
+	ina
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L003A:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	sta     ptr1
+	stx     ptr1+1
+	stx     tmp1
+	lsr     tmp1
+	ror     a
+	lsr     tmp1
+	ror     a
+	lsr     tmp1
+	ror     a
+	lsr     tmp1
+	ror     a
+	lsr     tmp1
+	ror     a
+	lsr     tmp1
+	ror     a
+	lsr     tmp1
+	ror     a
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	ror     tmp1
+	ror     a
+	lsr     tmp1
+	ror     a
+	lsr     tmp1
+	ror     a
+	lsr     tmp1
+	ror     a
+	lsr     tmp1
+	ror     a
+	lsr     tmp1
+	ror     a
+	lsr     tmp1
+	ror     a
+	lsr     tmp1
+	ror     a
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	ror     tmp1
+	ror     a
+	lsr     tmp1
+	ror     a
+	lsr     tmp1
+	ror     a
+	lsr     tmp1
+	ror     a
+	lsr     tmp1
+	ror     a
+	lsr     tmp1
+	ror     a
+	lsr     tmp1
+	ror     a
+	lsr     tmp1
+	ror     a
+	ldx     tmp1
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosudivax
+	jsr     tosicmp
+	beq     L003B
+	jsr     decsp6
+	lda     #<(S0062)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0062)
+	sta     (sp),y
+	lda     #$FF
+	sta     (sp)
+	ina
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L003B:	ldy     #$05
+	jsr     pushwysp
+	lda     #$FF
+	jsr     tosumoda0
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumodax
+	jsr     tosicmp
+	beq     L003C
+	jsr     decsp6
+	lda     #<(S0063)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0063)
+	sta     (sp),y
+	lda     #$FF
+	sta     (sp)
+	ina
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L003C:	ldy     #$03
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	sta     tmp1
+	lda     #$00
+	sec
+	sbc     ptr1
+	tay
+	lda     tmp1
+	sbc     ptr1+1
+	sta     tmp1
+	tya
+	ldx     tmp1
+	jsr     negax
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     negax
+	jsr     tosmulax
+	jsr     tosicmp
+	beq     L003D
+	jsr     decsp6
+	lda     #<(S0064)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0064)
+	sta     (sp),y
+	lda     #$FF
+	sta     (sp)
+	ina
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L003D:	jsr     incsp2
+	ldx     #$01
+	txa
+	jsr     pushax
+	ldy     #$03
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	clc
+	and     #$FF
+	adc     ptr1+1
+	sta     tmp1
+	lda     ptr1
+	ldx     tmp1
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumulax
+	jsr     tosicmp
+	beq     L0041
+	jsr     decsp6
+	lda     #<(S0065)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0065)
+	sta     (sp),y
+	lda     #$01
+	sta     (sp)
+	tay
+	sta     (sp),y
+	dea
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0041:	ldy     #$05
+	jsr     pushwysp
+	ldx     #$01
+	txa
+	jsr     tosudivax
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosudivax
+	jsr     tosicmp
+	beq     L0042
+	jsr     decsp6
+	lda     #<(S0066)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0066)
+	sta     (sp),y
+	lda     #$01
+	sta     (sp)
+	tay
+	sta     (sp),y
+	dea
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0042:	ldy     #$05
+	jsr     pushwysp
+	ldx     #$01
+	txa
+	jsr     tosumodax
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumodax
+	jsr     tosicmp
+	beq     L0043
+	jsr     decsp6
+	lda     #<(S0067)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0067)
+	sta     (sp),y
+	lda     #$01
+	sta     (sp)
+	tay
+	sta     (sp),y
+	dea
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0043:	ldy     #$03
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	clc
+	and     #$FF
+	adc     ptr1+1
+	sta     tmp1
+	lda     ptr1
+	ldx     tmp1
+	jsr     negax
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     negax
+	jsr     tosmulax
+	jsr     tosicmp
+	beq     L0044
+	jsr     decsp6
+	lda     #<(S0068)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0068)
+	sta     (sp),y
+	lda     #$01
+	sta     (sp)
+	tay
+	sta     (sp),y
+	dea
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0044:	jsr     incsp2
+	ldx     #$02
+	lda     #$81
+	jsr     pushax
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	sta     ptr1
+	stx     ptr1+1
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	ldx     tmp1
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumulax
+	jsr     tosicmp
+	beq     L0048
+	jsr     decsp6
+	lda     #<(S0069)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0069)
+	sta     (sp),y
+	lda     #$81
+	sta     (sp)
+	lda     #$02
+	ldy     #$01
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0048:	ldy     #$05
+	jsr     pushwysp
+	ldx     #$02
+	lda     #$81
+	jsr     tosudivax
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosudivax
+	jsr     tosicmp
+	beq     L0049
+	jsr     decsp6
+	lda     #<(S006A)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S006A)
+	sta     (sp),y
+	lda     #$81
+	sta     (sp)
+	lda     #$02
+	ldy     #$01
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0049:	ldy     #$05
+	jsr     pushwysp
+	ldx     #$02
+	lda     #$81
+	jsr     tosumodax
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumodax
+	jsr     tosicmp
+	beq     L004A
+	jsr     decsp6
+	lda     #<(S006B)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S006B)
+	sta     (sp),y
+	lda     #$81
+	sta     (sp)
+	lda     #$02
+	ldy     #$01
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L004A:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	sta     ptr1
+	stx     ptr1+1
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	ldx     tmp1
+	jsr     negax
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     negax
+	jsr     tosmulax
+	jsr     tosicmp
+	beq     L004B
+	jsr     decsp6
+	lda     #<(S006C)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S006C)
+	sta     (sp),y
+	lda     #$81
+	sta     (sp)
+	lda     #$02
+	ldy     #$01
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L004B:	jsr     incsp2
+	ldx     #$03
+	lda     #$E8
+	jsr     pushax
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	sta     ptr1
+	stx     ptr1+1
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	sec
+	sbc     ptr1
+	tay
+	lda     tmp1
+	sbc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	ldx     tmp1
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumulax
+	jsr     tosicmp
+	beq     L004F
+	jsr     decsp6
+	lda     #<(S006D)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S006D)
+	sta     (sp),y
+	lda     #$E8
+	sta     (sp)
+	lda     #$03
+	ldy     #$01
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L004F:	ldy     #$05
+	jsr     pushwysp
+	ldx     #$03
+	lda     #$E8
+	jsr     tosudivax
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosudivax
+	jsr     tosicmp
+	beq     L0050
+	jsr     decsp6
+	lda     #<(S006E)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S006E)
+	sta     (sp),y
+	lda     #$E8
+	sta     (sp)
+	lda     #$03
+	ldy     #$01
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0050:	ldy     #$05
+	jsr     pushwysp
+	ldx     #$03
+	lda     #$E8
+	jsr     tosumodax
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumodax
+	jsr     tosicmp
+	beq     L0051
+	jsr     decsp6
+	lda     #<(S006F)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S006F)
+	sta     (sp),y
+	lda     #$E8
+	sta     (sp)
+	lda     #$03
+	ldy     #$01
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0051:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	sta     ptr1
+	stx     ptr1+1
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	sec
+	sbc     ptr1
+	tay
+	lda     tmp1
+	sbc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	ldx     tmp1
+	jsr     negax
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     negax
+	jsr     tosmulax
+	jsr     tosicmp
+	beq     L0052
+	jsr     decsp6
+	lda     #<(S0070)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0070)
+	sta     (sp),y
+	lda     #$E8
+	sta     (sp)
+	lda     #$03
+	ldy     #$01
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0052:	jsr     incsp2
+	ldx     #$0E
+	lda     #$10
+	jsr     pushax
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	sta     ptr1
+	stx     ptr1+1
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	sec
+	sbc     ptr1
+	tay
+	lda     tmp1
+	sbc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	ldx     tmp1
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumulax
+	jsr     tosicmp
+	beq     L0056
+	jsr     decsp6
+	lda     #<(S0071)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0071)
+	sta     (sp),y
+	lda     #$10
+	sta     (sp)
+	lda     #$0E
+	ldy     #$01
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0056:	ldy     #$05
+	jsr     pushwysp
+	ldx     #$0E
+	lda     #$10
+	jsr     tosudivax
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosudivax
+	jsr     tosicmp
+	beq     L0057
+	jsr     decsp6
+	lda     #<(S0072)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0072)
+	sta     (sp),y
+	lda     #$10
+	sta     (sp)
+	lda     #$0E
+	ldy     #$01
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0057:	ldy     #$05
+	jsr     pushwysp
+	ldx     #$0E
+	lda     #$10
+	jsr     tosumodax
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumodax
+	jsr     tosicmp
+	beq     L0058
+	jsr     decsp6
+	lda     #<(S0073)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0073)
+	sta     (sp),y
+	lda     #$10
+	sta     (sp)
+	lda     #$0E
+	ldy     #$01
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0058:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	sta     ptr1
+	stx     ptr1+1
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	sec
+	sbc     ptr1
+	tay
+	lda     tmp1
+	sbc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	ldx     tmp1
+	jsr     negax
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     negax
+	jsr     tosmulax
+	jsr     tosicmp
+	beq     L0059
+	jsr     decsp6
+	lda     #<(S0074)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0074)
+	sta     (sp),y
+	lda     #$10
+	sta     (sp)
+	lda     #$0E
+	ldy     #$01
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0059:	jsr     incsp2
+	ldx     #$27
+	lda     #$10
+	jsr     pushax
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	sta     ptr1
+	stx     ptr1+1
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	sec
+	sbc     ptr1
+	tay
+	lda     tmp1
+	sbc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	ldx     tmp1
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumulax
+	jsr     tosicmp
+	beq     L005D
+	jsr     decsp6
+	lda     #<(S0075)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0075)
+	sta     (sp),y
+	lda     #$10
+	sta     (sp)
+	lda     #$27
+	ldy     #$01
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L005D:	ldy     #$05
+	jsr     pushwysp
+	ldx     #$27
+	lda     #$10
+	jsr     tosudivax
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosudivax
+	jsr     tosicmp
+	beq     L005E
+	jsr     decsp6
+	lda     #<(S0076)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0076)
+	sta     (sp),y
+	lda     #$10
+	sta     (sp)
+	lda     #$27
+	ldy     #$01
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L005E:	ldy     #$05
+	jsr     pushwysp
+	ldx     #$27
+	lda     #$10
+	jsr     tosumodax
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumodax
+	jsr     tosicmp
+	beq     L005F
+	jsr     decsp6
+	lda     #<(S0077)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0077)
+	sta     (sp),y
+	lda     #$10
+	sta     (sp)
+	lda     #$27
+	ldy     #$01
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L005F:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	sta     ptr1
+	stx     ptr1+1
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	sec
+	sbc     ptr1
+	tay
+	lda     tmp1
+	sbc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	ldx     tmp1
+	jsr     negax
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     negax
+	jsr     tosmulax
+	jsr     tosicmp
+	beq     L0060
+	jsr     decsp6
+	lda     #<(S0078)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0078)
+	sta     (sp),y
+	lda     #$10
+	sta     (sp)
+	lda     #$27
+	ldy     #$01
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0060:	jsr     incsp2
+	ldx     #$30
+	lda     #$39
+	jsr     pushax
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	sta     ptr1
+	stx     ptr1+1
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	sec
+	sbc     ptr1
+	tay
+	lda     tmp1
+	sbc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	sec
+	sbc     ptr1
+	tay
+	lda     tmp1
+	sbc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	ldx     tmp1
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumulax
+	jsr     tosicmp
+	beq     L0064
+	jsr     decsp6
+	lda     #<(S0079)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0079)
+	sta     (sp),y
+	lda     #$39
+	sta     (sp)
+	lda     #$30
+	ldy     #$01
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0064:	ldy     #$05
+	jsr     pushwysp
+	ldx     #$30
+	lda     #$39
+	jsr     tosudivax
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosudivax
+	jsr     tosicmp
+	beq     L0065
+	jsr     decsp6
+	lda     #<(S007A)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S007A)
+	sta     (sp),y
+	lda     #$39
+	sta     (sp)
+	lda     #$30
+	ldy     #$01
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0065:	ldy     #$05
+	jsr     pushwysp
+	ldx     #$30
+	lda     #$39
+	jsr     tosumodax
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumodax
+	jsr     tosicmp
+	beq     L0066
+	jsr     decsp6
+	lda     #<(S007B)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S007B)
+	sta     (sp),y
+	lda     #$39
+	sta     (sp)
+	lda     #$30
+	ldy     #$01
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0066:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	sta     ptr1
+	stx     ptr1+1
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	sec
+	sbc     ptr1
+	tay
+	lda     tmp1
+	sbc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	sec
+	sbc     ptr1
+	tay
+	lda     tmp1
+	sbc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	ldx     tmp1
+	jsr     negax
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     negax
+	jsr     tosmulax
+	jsr     tosicmp
+	beq     L0067
+	jsr     decsp6
+	lda     #<(S007C)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S007C)
+	sta     (sp),y
+	lda     #$39
+	sta     (sp)
+	lda     #$30
+	ldy     #$01
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0067:	jsr     incsp2
+	ldx     #$7F
+	lda     #$FF
+	jsr     pushax
+	ldy     #$03
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	sta     tmp1
+	and     #$00
+	asl     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	sec
+	sbc     ptr1
+	tay
+	lda     tmp1
+	sbc     ptr1+1
+	sta     tmp1
+	tya
+	ldx     tmp1
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumulax
+	jsr     tosicmp
+	beq     L006B
+	jsr     decsp6
+	lda     #<(S007D)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S007D)
+	sta     (sp),y
+	lda     #$FF
+	sta     (sp)
+	lda     #$7F
+	ldy     #$01
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L006B:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	sta     ptr1
+	stx     ptr1+1
+	stx     tmp1
+	lsr     tmp1
+	ror     a
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	ror     tmp1
+	ror     a
+	lsr     tmp1
+	ror     a
+	lsr     tmp1
+	ror     a
+	lsr     tmp1
+	ror     a
+	lsr     tmp1
+	ror     a
+	lsr     tmp1
+	ror     a
+	lsr     tmp1
+	ror     a
+	lsr     tmp1
+	ror     a
+	lsr     tmp1
+	ror     a
+	lsr     tmp1
+	ror     a
+	lsr     tmp1
+	ror     a
+	lsr     tmp1
+	ror     a
+	lsr     tmp1
+	ror     a
+	lsr     tmp1
+	ror     a
+	lsr     tmp1
+	ror     a
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	ror     tmp1
+	ror     a
+	lsr     tmp1
+	ror     a
+	lsr     tmp1
+	ror     a
+	lsr     tmp1
+	ror     a
+	lsr     tmp1
+	ror     a
+	lsr     tmp1
+	ror     a
+	lsr     tmp1
+	ror     a
+	lda     tmp1
+	jsr     pusha0
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosudivax
+	jsr     tosicmp
+	beq     L006C
+	jsr     decsp6
+	lda     #<(S007E)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S007E)
+	sta     (sp),y
+	lda     #$FF
+	sta     (sp)
+	lda     #$7F
+	ldy     #$01
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L006C:	ldy     #$05
+	jsr     pushwysp
+	ldx     #$7F
+	lda     #$FF
+	jsr     tosumodax
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumodax
+	jsr     tosicmp
+	beq     L006D
+	jsr     decsp6
+	lda     #<(S007F)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S007F)
+	sta     (sp),y
+	lda     #$FF
+	sta     (sp)
+	lda     #$7F
+	ldy     #$01
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L006D:	ldy     #$03
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	sta     tmp1
+	and     #$00
+	asl     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	lda     ptr1
+	ldx     tmp1
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     negax
+	jsr     tosmulax
+	jsr     tosicmp
+	beq     L006E
+	jsr     decsp6
+	lda     #<(S0080)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0080)
+	sta     (sp),y
+	lda     #$FF
+	sta     (sp)
+	lda     #$7F
+	ldy     #$01
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L006E:	jsr     incsp2
+	ldx     #$75
+	lda     #$30
+	jsr     pushax
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	sta     ptr1
+	stx     ptr1+1
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	sec
+	sbc     ptr1
+	tay
+	lda     tmp1
+	sbc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	sec
+	sbc     ptr1
+	tay
+	lda     tmp1
+	sbc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	ldx     tmp1
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumulax
+	jsr     tosicmp
+	beq     L0072
+	jsr     decsp6
+	lda     #<(S0081)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0081)
+	sta     (sp),y
+	lda     #$30
+	sta     (sp)
+	lda     #$75
+	ldy     #$01
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0072:	ldy     #$05
+	jsr     pushwysp
+	ldx     #$75
+	lda     #$30
+	jsr     tosudivax
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosudivax
+	jsr     tosicmp
+	beq     L0073
+	jsr     decsp6
+	lda     #<(S0082)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0082)
+	sta     (sp),y
+	lda     #$30
+	sta     (sp)
+	lda     #$75
+	ldy     #$01
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0073:	ldy     #$05
+	jsr     pushwysp
+	ldx     #$75
+	lda     #$30
+	jsr     tosumodax
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     tosumodax
+	jsr     tosicmp
+	beq     L0074
+	jsr     decsp6
+	lda     #<(S0083)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0083)
+	sta     (sp),y
+	lda     #$30
+	sta     (sp)
+	lda     #$75
+	ldy     #$01
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0074:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	sta     ptr1
+	stx     ptr1+1
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	tya
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	ldx     tmp1
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     negax
+	jsr     tosmulax
+	jsr     tosicmp
+	beq     L0075
+	jsr     decsp6
+	lda     #<(S0084)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0084)
+	sta     (sp),y
+	lda     #$30
+	sta     (sp)
+	lda     #$75
+	ldy     #$01
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stz     sreg
+	stz     sreg+1
+	jsr     _fail
+L0075:	jsr     incsp2
+	jsr     incsp2
+	ldy     #$00
+	clc
+	lda     #$01
+	adc     (sp)
+L0077:	sta     (sp)
+	ldx     #$00
+	lda     (sp)
+	cmp     #$14
+	jcc     L007A
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ test32 (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_test32: near
+
+.segment	"CODE"
+
+	jsr     decsp1
+	lda     #$00
+	tay
+	jmp     L003E
+L0040:	lda     (sp),y
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_v32)
+	tay
+	lda     tmp1
+	adc     #>(_v32)
+	tax
+	tya
+	jsr     ldeaxi
+	jsr     pusheax
+	ldx     #$00
+	lda     #$03
+	jsr     push0ax
+	ldy     #$07
+	jsr     ldeaxysp
+	sta     ptr1
+	stx     ptr1+1
+	stx     tmp1
+	ldy     sreg
+	sty     ptr2
+	ldy     sreg+1
+	sty     ptr2+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	lda     sreg
+	adc     ptr2
+	sta     sreg
+	lda     sreg+1
+	adc     ptr2+1
+	sta     sreg+1
+	tya
+	ldx     tmp1
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosumuleax
+	jsr     tosneeax
+	beq     L0009
+	jsr     decsp6
+	lda     #<(S0085)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0085)
+	sta     (sp),y
+	lda     #$03
+	sta     (sp)
+	lda     #$00
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     ldeaxysp
+	jsr     _fail
+L0009:	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	lda     #$03
+	jsr     tosudiv0ax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosudiveax
+	jsr     tosneeax
+	beq     L000A
+	jsr     decsp6
+	lda     #<(S0086)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0086)
+	sta     (sp),y
+	lda     #$03
+	sta     (sp)
+	lda     #$00
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     ldeaxysp
+	jsr     _fail
+L000A:	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	lda     #$03
+	jsr     tosumod0ax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosumodeax
+	jsr     tosneeax
+	beq     L000B
+	jsr     decsp6
+	lda     #<(S0087)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0087)
+	sta     (sp),y
+	lda     #$03
+	sta     (sp)
+	lda     #$00
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     ldeaxysp
+	jsr     _fail
+L000B:	ldy     #$07
+	jsr     ldeaxysp
+	sta     ptr1
+	stx     ptr1+1
+	stx     tmp1
+	ldy     sreg
+	sty     ptr2
+	ldy     sreg+1
+	sty     ptr2+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	lda     sreg
+	adc     ptr2
+	sta     sreg
+	lda     sreg+1
+	adc     ptr2+1
+	sta     sreg+1
+	tya
+	ldx     tmp1
+	jsr     negeax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     negeax
+	jsr     tosmuleax
+	jsr     tosneeax
+	beq     L000C
+	jsr     decsp6
+	lda     #<(S0088)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0088)
+	sta     (sp),y
+	lda     #$03
+	sta     (sp)
+	lda     #$00
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     ldeaxysp
+	jsr     _fail
+L000C:	jsr     incsp4
+	ldx     #$00
+	lda     #$0A
+	jsr     push0ax
+	ldy     #$07
+	jsr     ldeaxysp
+	sta     ptr1
+	stx     ptr1+1
+	stx     tmp1
+	ldy     sreg
+	sty     ptr2
+	ldy     sreg+1
+	sty     ptr2+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	lda     sreg
+	adc     ptr2
+	sta     sreg
+	lda     sreg+1
+	adc     ptr2+1
+	sta     sreg+1
+	tya
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	ldx     tmp1
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosumuleax
+	jsr     tosneeax
+	beq     L0010
+	jsr     decsp6
+	lda     #<(S0089)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0089)
+	sta     (sp),y
+	lda     #$0A
+	sta     (sp)
+	lda     #$00
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     ldeaxysp
+	jsr     _fail
+L0010:	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	lda     #$0A
+	jsr     tosudiv0ax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosudiveax
+	jsr     tosneeax
+	beq     L0011
+	jsr     decsp6
+	lda     #<(S008A)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S008A)
+	sta     (sp),y
+	lda     #$0A
+	sta     (sp)
+	lda     #$00
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     ldeaxysp
+	jsr     _fail
+L0011:	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	lda     #$0A
+	jsr     tosumod0ax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosumodeax
+	jsr     tosneeax
+	beq     L0012
+	jsr     decsp6
+	lda     #<(S008B)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S008B)
+	sta     (sp),y
+	lda     #$0A
+	sta     (sp)
+	lda     #$00
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     ldeaxysp
+	jsr     _fail
+L0012:	ldy     #$07
+	jsr     ldeaxysp
+	sta     ptr1
+	stx     ptr1+1
+	stx     tmp1
+	ldy     sreg
+	sty     ptr2
+	ldy     sreg+1
+	sty     ptr2+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	lda     sreg
+	adc     ptr2
+	sta     sreg
+	lda     sreg+1
+	adc     ptr2+1
+	sta     sreg+1
+	tya
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	ldx     tmp1
+	jsr     negeax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     negeax
+	jsr     tosmuleax
+	jsr     tosneeax
+	beq     L0013
+	jsr     decsp6
+	lda     #<(S008C)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S008C)
+	sta     (sp),y
+	lda     #$0A
+	sta     (sp)
+	lda     #$00
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     ldeaxysp
+	jsr     _fail
+L0013:	jsr     incsp4
+	ldx     #$00
+	lda     #$3C
+	jsr     push0ax
+	ldy     #$07
+	jsr     ldeaxysp
+	sta     ptr1
+	stx     ptr1+1
+	stx     tmp1
+	ldy     sreg
+	sty     ptr2
+	ldy     sreg+1
+	sty     ptr2+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	sec
+	sbc     ptr1
+	tay
+	lda     tmp1
+	sbc     ptr1+1
+	sta     tmp1
+	lda     sreg
+	sbc     ptr2
+	sta     sreg
+	lda     sreg+1
+	sbc     ptr2+1
+	sta     sreg+1
+	tya
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	ldx     tmp1
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosumuleax
+	jsr     tosneeax
+	beq     L0017
+	jsr     decsp6
+	lda     #<(S008D)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S008D)
+	sta     (sp),y
+	lda     #$3C
+	sta     (sp)
+	lda     #$00
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     ldeaxysp
+	jsr     _fail
+L0017:	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	lda     #$3C
+	jsr     tosudiv0ax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosudiveax
+	jsr     tosneeax
+	beq     L0018
+	jsr     decsp6
+	lda     #<(S008E)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S008E)
+	sta     (sp),y
+	lda     #$3C
+	sta     (sp)
+	lda     #$00
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     ldeaxysp
+	jsr     _fail
+L0018:	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$00
+	lda     #$3C
+	jsr     tosumod0ax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosumodeax
+	jsr     tosneeax
+	beq     L0019
+	jsr     decsp6
+	lda     #<(S008F)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S008F)
+	sta     (sp),y
+	lda     #$3C
+	sta     (sp)
+	lda     #$00
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     ldeaxysp
+	jsr     _fail
+L0019:	ldy     #$07
+	jsr     ldeaxysp
+	sta     ptr1
+	stx     ptr1+1
+	stx     tmp1
+	ldy     sreg
+	sty     ptr2
+	ldy     sreg+1
+	sty     ptr2+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	sec
+	sbc     ptr1
+	tay
+	lda     tmp1
+	sbc     ptr1+1
+	sta     tmp1
+	lda     sreg
+	sbc     ptr2
+	sta     sreg
+	lda     sreg+1
+	sbc     ptr2+1
+	sta     sreg+1
+	tya
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	ldx     tmp1
+	jsr     negeax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     negeax
+	jsr     tosmuleax
+	jsr     tosneeax
+	beq     L001A
+	jsr     decsp6
+	lda     #<(S0090)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0090)
+	sta     (sp),y
+	lda     #$3C
+	sta     (sp)
+	lda     #$00
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     ldeaxysp
+	jsr     _fail
+L001A:	jsr     incsp4
+	ldx     #$03
+	lda     #$E8
+	jsr     push0ax
+	ldy     #$07
+	jsr     ldeaxysp
+	sta     ptr1
+	stx     ptr1+1
+	stx     tmp1
+	ldy     sreg
+	sty     ptr2
+	ldy     sreg+1
+	sty     ptr2+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	sec
+	sbc     ptr1
+	tay
+	lda     tmp1
+	sbc     ptr1+1
+	sta     tmp1
+	lda     sreg
+	sbc     ptr2
+	sta     sreg
+	lda     sreg+1
+	sbc     ptr2+1
+	sta     sreg+1
+	tya
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	lda     sreg
+	adc     ptr2
+	sta     sreg
+	lda     sreg+1
+	adc     ptr2+1
+	sta     sreg+1
+	tya
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	ldx     tmp1
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosumuleax
+	jsr     tosneeax
+	beq     L001E
+	jsr     decsp6
+	lda     #<(S0091)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0091)
+	sta     (sp),y
+	lda     #$E8
+	sta     (sp)
+	lda     #$03
+	ldy     #$01
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     ldeaxysp
+	jsr     _fail
+L001E:	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$03
+	lda     #$E8
+	jsr     tosudiv0ax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosudiveax
+	jsr     tosneeax
+	beq     L001F
+	jsr     decsp6
+	lda     #<(S0092)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0092)
+	sta     (sp),y
+	lda     #$E8
+	sta     (sp)
+	lda     #$03
+	ldy     #$01
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     ldeaxysp
+	jsr     _fail
+L001F:	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$03
+	lda     #$E8
+	jsr     tosumod0ax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosumodeax
+	jsr     tosneeax
+	beq     L0020
+	jsr     decsp6
+	lda     #<(S0093)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0093)
+	sta     (sp),y
+	lda     #$E8
+	sta     (sp)
+	lda     #$03
+	ldy     #$01
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     ldeaxysp
+	jsr     _fail
+L0020:	ldy     #$07
+	jsr     ldeaxysp
+	sta     ptr1
+	stx     ptr1+1
+	stx     tmp1
+	ldy     sreg
+	sty     ptr2
+	ldy     sreg+1
+	sty     ptr2+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	sec
+	sbc     ptr1
+	tay
+	lda     tmp1
+	sbc     ptr1+1
+	sta     tmp1
+	lda     sreg
+	sbc     ptr2
+	sta     sreg
+	lda     sreg+1
+	sbc     ptr2+1
+	sta     sreg+1
+	tya
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	lda     sreg
+	adc     ptr2
+	sta     sreg
+	lda     sreg+1
+	adc     ptr2+1
+	sta     sreg+1
+	tya
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	ldx     tmp1
+	jsr     negeax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     negeax
+	jsr     tosmuleax
+	jsr     tosneeax
+	beq     L0021
+	jsr     decsp6
+	lda     #<(S0094)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0094)
+	sta     (sp),y
+	lda     #$E8
+	sta     (sp)
+	lda     #$03
+	ldy     #$01
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     ldeaxysp
+	jsr     _fail
+L0021:	jsr     incsp4
+	ldx     #$0E
+	lda     #$10
+	jsr     push0ax
+	ldy     #$07
+	jsr     ldeaxysp
+	sta     ptr1
+	stx     ptr1+1
+	stx     tmp1
+	ldy     sreg
+	sty     ptr2
+	ldy     sreg+1
+	sty     ptr2+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	sec
+	sbc     ptr1
+	tay
+	lda     tmp1
+	sbc     ptr1+1
+	sta     tmp1
+	lda     sreg
+	sbc     ptr2
+	sta     sreg
+	lda     sreg+1
+	sbc     ptr2+1
+	sta     sreg+1
+	tya
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	lda     sreg
+	adc     ptr2
+	sta     sreg
+	lda     sreg+1
+	adc     ptr2+1
+	sta     sreg+1
+	tya
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	ldx     tmp1
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosumuleax
+	jsr     tosneeax
+	beq     L0025
+	jsr     decsp6
+	lda     #<(S0095)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0095)
+	sta     (sp),y
+	lda     #$10
+	sta     (sp)
+	lda     #$0E
+	ldy     #$01
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     ldeaxysp
+	jsr     _fail
+L0025:	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$0E
+	lda     #$10
+	jsr     tosudiv0ax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosudiveax
+	jsr     tosneeax
+	beq     L0026
+	jsr     decsp6
+	lda     #<(S0096)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0096)
+	sta     (sp),y
+	lda     #$10
+	sta     (sp)
+	lda     #$0E
+	ldy     #$01
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     ldeaxysp
+	jsr     _fail
+L0026:	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$0E
+	lda     #$10
+	jsr     tosumod0ax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosumodeax
+	jsr     tosneeax
+	beq     L0027
+	jsr     decsp6
+	lda     #<(S0097)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0097)
+	sta     (sp),y
+	lda     #$10
+	sta     (sp)
+	lda     #$0E
+	ldy     #$01
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     ldeaxysp
+	jsr     _fail
+L0027:	ldy     #$07
+	jsr     ldeaxysp
+	sta     ptr1
+	stx     ptr1+1
+	stx     tmp1
+	ldy     sreg
+	sty     ptr2
+	ldy     sreg+1
+	sty     ptr2+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	sec
+	sbc     ptr1
+	tay
+	lda     tmp1
+	sbc     ptr1+1
+	sta     tmp1
+	lda     sreg
+	sbc     ptr2
+	sta     sreg
+	lda     sreg+1
+	sbc     ptr2+1
+	sta     sreg+1
+	tya
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	clc
+	adc     ptr1
+	tay
+	lda     tmp1
+	adc     ptr1+1
+	sta     tmp1
+	lda     sreg
+	adc     ptr2
+	sta     sreg
+	lda     sreg+1
+	adc     ptr2+1
+	sta     sreg+1
+	tya
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	asl     a
+	rol     tmp1
+	rol     sreg
+	rol     sreg+1
+	ldx     tmp1
+	jsr     negeax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     negeax
+	jsr     tosmuleax
+	jsr     tosneeax
+	beq     L0028
+	jsr     decsp6
+	lda     #<(S0098)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0098)
+	sta     (sp),y
+	lda     #$10
+	sta     (sp)
+	lda     #$0E
+	ldy     #$01
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     ldeaxysp
+	jsr     _fail
+L0028:	jsr     incsp4
+	ldx     #$51
+	lda     #$01
+	sta     sreg
+	lsr     a
+	stz     sreg+1
+	lda     #$80
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$51
+	lda     #$01
+	sta     sreg
+	lsr     a
+	stz     sreg+1
+	lda     #$80
+	jsr     tosumuleax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosumuleax
+	jsr     tosneeax
+	beq     L002C
+	jsr     decsp6
+	lda     #<(S0099)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S0099)
+	sta     (sp),y
+	lda     #$80
+	sta     (sp)
+	lda     #$51
+	ldy     #$01
+	sta     (sp),y
+	tya
+	iny
+	sta     (sp),y
+	dea
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     ldeaxysp
+	jsr     _fail
+L002C:	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$51
+	lda     #$01
+	sta     sreg
+	lsr     a
+	stz     sreg+1
+	lda     #$80
+	jsr     tosudiveax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosudiveax
+	jsr     tosneeax
+	beq     L002D
+	jsr     decsp6
+	lda     #<(S009A)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S009A)
+	sta     (sp),y
+	lda     #$80
+	sta     (sp)
+	lda     #$51
+	ldy     #$01
+	sta     (sp),y
+	tya
+	iny
+	sta     (sp),y
+	dea
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     ldeaxysp
+	jsr     _fail
+L002D:	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$51
+	lda     #$01
+	sta     sreg
+	lsr     a
+	stz     sreg+1
+	lda     #$80
+	jsr     tosumodeax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosumodeax
+	jsr     tosneeax
+	beq     L002E
+	jsr     decsp6
+	lda     #<(S009B)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S009B)
+	sta     (sp),y
+	lda     #$80
+	sta     (sp)
+	lda     #$51
+	ldy     #$01
+	sta     (sp),y
+	tya
+	iny
+	sta     (sp),y
+	dea
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     ldeaxysp
+	jsr     _fail
+L002E:	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$AE
+	lda     #$FE
+	sta     sreg
+	ina
+	sta     sreg+1
+	lda     #$80
+	jsr     tosmuleax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     negeax
+	jsr     tosmuleax
+	jsr     tosneeax
+	beq     L002F
+	jsr     decsp6
+	lda     #<(S009C)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S009C)
+	sta     (sp),y
+	lda     #$80
+	sta     (sp)
+	lda     #$51
+	ldy     #$01
+	sta     (sp),y
+	tya
+	iny
+	sta     (sp),y
+	dea
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     ldeaxysp
+	jsr     _fail
+L002F:	jsr     incsp4
+	ldx     #$42
+	lda     #$0F
+	sta     sreg
+	stz     sreg+1
+	lda     #$40
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$42
+	lda     #$0F
+	sta     sreg
+	stz     sreg+1
+	lda     #$40
+	jsr     tosumuleax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosumuleax
+	jsr     tosneeax
+	beq     L0033
+	jsr     decsp6
+	lda     #<(S009D)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S009D)
+	sta     (sp),y
+	lda     #$40
+	sta     (sp)
+	lda     #$42
+	ldy     #$01
+	sta     (sp),y
+	lda     #$0F
+	iny
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     ldeaxysp
+	jsr     _fail
+L0033:	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$42
+	lda     #$0F
+	sta     sreg
+	stz     sreg+1
+	lda     #$40
+	jsr     tosudiveax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosudiveax
+	jsr     tosneeax
+	beq     L0034
+	jsr     decsp6
+	lda     #<(S009E)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S009E)
+	sta     (sp),y
+	lda     #$40
+	sta     (sp)
+	lda     #$42
+	ldy     #$01
+	sta     (sp),y
+	lda     #$0F
+	iny
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     ldeaxysp
+	jsr     _fail
+L0034:	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$42
+	lda     #$0F
+	sta     sreg
+	stz     sreg+1
+	lda     #$40
+	jsr     tosumodeax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosumodeax
+	jsr     tosneeax
+	beq     L0035
+	jsr     decsp6
+	lda     #<(S009F)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S009F)
+	sta     (sp),y
+	lda     #$40
+	sta     (sp)
+	lda     #$42
+	ldy     #$01
+	sta     (sp),y
+	lda     #$0F
+	iny
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     ldeaxysp
+	jsr     _fail
+L0035:	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$BD
+	lda     #$F0
+	sta     sreg
+	lda     #$FF
+	sta     sreg+1
+	lda     #$C0
+	jsr     tosmuleax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     negeax
+	jsr     tosmuleax
+	jsr     tosneeax
+	beq     L0036
+	jsr     decsp6
+	lda     #<(S00A0)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S00A0)
+	sta     (sp),y
+	lda     #$40
+	sta     (sp)
+	lda     #$42
+	ldy     #$01
+	sta     (sp),y
+	lda     #$0F
+	iny
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     ldeaxysp
+	jsr     _fail
+L0036:	jsr     incsp4
+	ldx     #$56
+	lda     #$34
+	sta     sreg
+	lda     #$12
+	sta     sreg+1
+	lda     #$79
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$56
+	lda     #$34
+	sta     sreg
+	lda     #$12
+	sta     sreg+1
+	lda     #$79
+	jsr     tosumuleax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosumuleax
+	jsr     tosneeax
+	beq     L003A
+	jsr     decsp6
+	lda     #<(S00A1)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S00A1)
+	sta     (sp),y
+	lda     #$79
+	sta     (sp)
+	lda     #$56
+	ldy     #$01
+	sta     (sp),y
+	lda     #$34
+	iny
+	sta     (sp),y
+	lda     #$12
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     ldeaxysp
+	jsr     _fail
+L003A:	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$56
+	lda     #$34
+	sta     sreg
+	lda     #$12
+	sta     sreg+1
+	lda     #$79
+	jsr     tosudiveax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosudiveax
+	jsr     tosneeax
+	beq     L003B
+	jsr     decsp6
+	lda     #<(S00A2)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S00A2)
+	sta     (sp),y
+	lda     #$79
+	sta     (sp)
+	lda     #$56
+	ldy     #$01
+	sta     (sp),y
+	lda     #$34
+	iny
+	sta     (sp),y
+	lda     #$12
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     ldeaxysp
+	jsr     _fail
+L003B:	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$56
+	lda     #$34
+	sta     sreg
+	lda     #$12
+	sta     sreg+1
+	lda     #$79
+	jsr     tosumodeax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     tosumodeax
+	jsr     tosneeax
+	beq     L003C
+	jsr     decsp6
+	lda     #<(S00A3)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S00A3)
+	sta     (sp),y
+	lda     #$79
+	sta     (sp)
+	lda     #$56
+	ldy     #$01
+	sta     (sp),y
+	lda     #$34
+	iny
+	sta     (sp),y
+	lda     #$12
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     ldeaxysp
+	jsr     _fail
+L003C:	ldy     #$07
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldx     #$A9
+	lda     #$CB
+	sta     sreg
+	lda     #$ED
+	sta     sreg+1
+	lda     #$87
+	jsr     tosmuleax
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     negeax
+	jsr     tosmuleax
+	jsr     tosneeax
+	beq     L003D
+	jsr     decsp6
+	lda     #<(S00A4)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(S00A4)
+	sta     (sp),y
+	lda     #$79
+	sta     (sp)
+	lda     #$56
+	ldy     #$01
+	sta     (sp),y
+	lda     #$34
+	iny
+	sta     (sp),y
+	lda     #$12
+	iny
+	sta     (sp),y
+	ldy     #$0D
+	jsr     ldeaxysp
+	jsr     _fail
+L003D:	jsr     incsp4
+	jsr     incsp4
+	ldy     #$00
+	clc
+	lda     #$01
+	adc     (sp)
+L003E:	sta     (sp)
+	ldx     #$00
+	lda     (sp)
+	cmp     #$11
+	jcc     L0040
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     _test8
+	jsr     _test16
+	jsr     _test32
+	lda     #<(S00A5)
+	ldx     #>(S00A5)
+	jsr     pushax
+	lda     _failures
+	ldx     _failures+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     _failures
+	ldx     _failures+1
+	rts
+
+.endproc
+